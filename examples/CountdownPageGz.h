@@ -0,0 +1,711 @@
+// Généré par tools/web_gzip.py depuis examples/fullscreen_countdown_web.cpp : ne pas modifier
+#ifndef COUNTDOWNPAGEGZ_H
+#define COUNTDOWNPAGEGZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MAIN_page : 38368 octets -> 11163 octets gzip (29 %)
+static const uint8_t MAIN_page_gz[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x7D, 0xDB, 0x72, 0xDB, 0x48,
+  0x96, 0xE0, 0xBB, 0xBE, 0x22, 0x4D, 0x57, 0x37, 0xC0, 0x32, 0x49, 0x81, 0xA4, 0x28, 0xCB, 0x94,
+  0xA8, 0x1A, 0x5B, 0x96, 0x55, 0x9E, 0xF1, 0x2D, 0x2C, 0x55, 0x75, 0x57, 0x54, 0x38, 0xBA, 0x40,
+  0x20, 0x49, 0xA2, 0x0C, 0x02, 0x2C, 0x00, 0xD4, 0xA5, 0x54, 0x8A, 0x98, 0x87, 0x99, 0x88, 0xED,
+  0x89, 0x89, 0xDD, 0x8D, 0xBD, 0xBC, 0xCD, 0xC4, 0x76, 0xEC, 0xCB, 0x96, 0x67, 0x5F, 0xF6, 0x61,
+  0x9E, 0xF7, 0x45, 0x7F, 0xD2, 0x5F, 0xB0, 0x9F, 0xB0, 0xE7, 0x9C, 0xCC, 0x04, 0x32, 0x01, 0x90,
+  0xA2, 0xDD, 0x55, 0xB1, 0x31, 0x11, 0xEB, 0xAE, 0xB6, 0x81, 0xBC, 0x9C, 0xCC, 0x3C, 0x79, 0xEE,
+  0x79, 0x90, 0xDC, 0x3A, 0xB8, 0xF7, 0xF4, 0xF5, 0xD1, 0xD9, 0x37, 0x6F, 0x8E, 0xD9, 0x2C, 0x9B,
+  0x87, 0x87, 0x07, 0xF8, 0x37, 0x0B, 0xDD, 0x68, 0x3A, 0x6A, 0x4C, 0x92, 0x06, 0xBC, 0x73, 0xD7,
+  0x3F, 0xDC, 0x3A, 0x98, 0xF3, 0xCC, 0x65, 0xDE, 0xCC, 0x4D, 0x52, 0x9E, 0x8D, 0x1A, 0xCB, 0x6C,
+  0xD2, 0xDE, 0x6B, 0xB0, 0x6D, 0x55, 0x11, 0xB9, 0x73, 0x3E, 0x6A, 0xB8, 0xCB, 0x6C, 0x16, 0x27,
+  0x0D, 0xE6, 0xC5, 0x51, 0xC6, 0x23, 0x68, 0x76, 0x14, 0xDE, 0x7E, 0x98, 0xC3, 0x13, 0x3B, 0x75,
+  0x83, 0x10, 0x60, 0x66, 0xCC, 0xE6, 0x21, 0xF7, 0xB2, 0x24, 0x8E, 0xDA, 0x89, 0x9B, 0xF0, 0x66,
+  0x03, 0x00, 0x64, 0x41, 0x16, 0xF2, 0xC3, 0xE3, 0xD3, 0x37, 0xFD, 0x1E, 0x7B, 0xD3, 0x75, 0xD8,
+  0x51, 0xBC, 0x8C, 0x32, 0x3F, 0xBE, 0x88, 0x0E, 0xB6, 0x45, 0x95, 0x31, 0xC6, 0x79, 0xC0, 0x2F,
+  0x16, 0x71, 0x92, 0x69, 0xA3, 0x5C, 0x04, 0x7E, 0x36, 0x1B, 0xF9, 0xFC, 0x3C, 0xF0, 0x78, 0x9B,
+  0x5E, 0x5A, 0x41, 0x14, 0x64, 0x81, 0x1B, 0xB6, 0x53, 0xCF, 0x0D, 0xF9, 0xA8, 0x2B, 0x66, 0x9A,
+  0x66, 0x57, 0x08, 0x6D, 0x98, 0xC4, 0x71, 0xC6, 0xAE, 0x59, 0xBB, 0xED, 0x7A, 0x1E, 0x00, 0x18,
+  0xDE, 0x77, 0x9C, 0x47, 0xBB, 0x7B, 0x7B, 0xFB, 0x79, 0x49, 0x7B, 0x16, 0x9F, 0xF3, 0x04, 0xCA,
+  0xBB, 0x0F, 0xDD, 0xDD, 0x09, 0x96, 0xFB, 0x80, 0x0F, 0x2C, 0xF1, 0xFB, 0xBD, 0x49, 0x8F, 0x4A,
+  0xC6, 0xD3, 0xE1, 0xFD, 0xAE, 0xD3, 0xDD, 0xE9, 0x52, 0xBF, 0x85, 0x1B, 0xF1, 0x10, 0x0A, 0xBC,
+  0xDE, 0x4E, 0x6F, 0x9C, 0x17, 0xB4, 0xDD, 0x10, 0xA0, 0xF7, 0xFA, 0x3D, 0xDE, 0xDF, 0xC5, 0xC2,
+  0x8C, 0x5F, 0xC2, 0x3B, 0x1F, 0x70, 0x8F, 0x7B, 0xF8, 0x3E, 0x5F, 0x66, 0xDC, 0x1F, 0xDE, 0x7F,
+  0xE8, 0xEF, 0x8D, 0x1F, 0x75, 0xB1, 0x20, 0x7E, 0x3F, 0xBC, 0xBF, 0xE3, 0xB9, 0x93, 0x81, 0x83,
+  0x6F, 0x17, 0x6E, 0x12, 0x0D, 0xEF, 0x4F, 0x26, 0x5E, 0xD7, 0x79, 0xB8, 0xCF, 0x26, 0xB0, 0xDC,
+  0x76, 0x1A, 0xFC, 0xC8, 0x87, 0xDD, 0xDD, 0xC5, 0xE5, 0x3E, 0xBB, 0xD9, 0xFA, 0x1C, 0x16, 0x31,
+  0x8E, 0x2F, 0xB1, 0x30, 0x88, 0xA6, 0xC3, 0x71, 0x9C, 0xF8, 0x3C, 0x69, 0x43, 0x09, 0x56, 0x8E,
+  0x63, 0xFF, 0x0A, 0xEA, 0xE7, 0x6E, 0x32, 0x0D, 0xA2, 0xA1, 0x23, 0xFB, 0x4F, 0xDC, 0x79, 0x10,
+  0x5E, 0x0D, 0xDB, 0xEE, 0x62, 0x11, 0xF2, 0x76, 0x7A, 0x95, 0x66, 0x7C, 0xDE, 0x7A, 0x12, 0x06,
+  0xD1, 0xFB, 0x97, 0xAE, 0x77, 0x4A, 0xAF, 0xCF, 0xA0, 0x5D, 0xAB, 0x71, 0xCA, 0xA7, 0x31, 0x67,
+  0x5F, 0x3D, 0x6F, 0xB4, 0xDE, 0xC6, 0xE3, 0x38, 0x8B, 0x5B, 0x8F, 0x13, 0xC0, 0x67, 0x2B, 0x75,
+  0xA3, 0xB4, 0x9D, 0xF2, 0x24, 0x00, 0x1C, 0x8C, 0x5D, 0xEF, 0xFD, 0x34, 0x81, 0xCD, 0xF2, 0x87,
+  0xE7, 0x6E, 0x62, 0x23, 0x4A, 0x9A, 0xFB, 0xB0, 0x2B, 0x61, 0x9C, 0xC8, 0x02, 0x5C, 0x2F, 0x14,
+  0xB5, 0x2F, 0xF8, 0xF8, 0x7D, 0x00, 0x83, 0xD3, 0x0A, 0xE6, 0x80, 0xFD, 0x19, 0xCE, 0x17, 0xC8,
+  0x01, 0x40, 0x06, 0x6E, 0xCA, 0x7D, 0x9C, 0xF0, 0xAC, 0x0B, 0xD3, 0xD5, 0x16, 0xD9, 0xE9, 0x0F,
+  0x12, 0x3E, 0xDF, 0xCF, 0x57, 0xC0, 0x1C, 0xD6, 0xA5, 0x02, 0x84, 0x0A, 0x98, 0x0D, 0xA6, 0xD1,
+  0x10, 0x37, 0x8B, 0x27, 0xFB, 0x2C, 0xE4, 0x19, 0xFC, 0xDB, 0x4E, 0x17, 0xAE, 0x87, 0x90, 0x3B,
+  0x03, 0x81, 0xA0, 0x59, 0xCF, 0x00, 0xD9, 0x79, 0x64, 0x40, 0xEC, 0x76, 0xF0, 0x15, 0xC0, 0x76,
+  0x1E, 0x0E, 0x0A, 0xC0, 0x59, 0x02, 0x4B, 0x9C, 0xC4, 0xC9, 0x7C, 0xB8, 0x5C, 0x2C, 0x78, 0xE2,
+  0xC1, 0xF4, 0xAA, 0xF0, 0x9D, 0x3D, 0x6C, 0xAF, 0x2F, 0x95, 0xB6, 0xB2, 0x89, 0x83, 0xBA, 0x30,
+  0xA6, 0x5E, 0x23, 0x48, 0x8A, 0xAA, 0x3A, 0x17, 0x89, 0xBB, 0xA0, 0x4D, 0xB9, 0x14, 0x74, 0x3A,
+  0x7C, 0xB8, 0xEB, 0xE0, 0x54, 0xF3, 0x35, 0x02, 0x07, 0xC5, 0xFB, 0x6C, 0xE1, 0xFA, 0x3E, 0x8E,
+  0xE3, 0x85, 0xEE, 0x7C, 0x61, 0x77, 0x7B, 0x8B, 0xCB, 0x56, 0xEF, 0xFC, 0xA2, 0xD5, 0x87, 0x07,
+  0x01, 0x67, 0x9A, 0x04, 0x3E, 0xC0, 0xF1, 0x83, 0x74, 0x11, 0xBA, 0x57, 0x43, 0x7C, 0xDD, 0x67,
+  0x53, 0x77, 0x31, 0xEC, 0xEE, 0x88, 0x95, 0x77, 0x3C, 0x37, 0xC1, 0x16, 0xDA, 0x1E, 0xC1, 0x26,
+  0x73, 0x37, 0x69, 0x4F, 0x13, 0xD7, 0x0F, 0x60, 0x42, 0x76, 0x77, 0x67, 0xE0, 0xF3, 0x69, 0x4B,
+  0x4C, 0x92, 0xC8, 0xB5, 0xC9, 0x9C, 0xDF, 0xE8, 0xEF, 0x48, 0xBE, 0x4D, 0xD6, 0x75, 0x9C, 0xDF,
+  0x34, 0x8B, 0x39, 0x75, 0xF7, 0x16, 0x97, 0xAC, 0xE7, 0xE0, 0x5F, 0x3D, 0x1C, 0x4B, 0x52, 0x1D,
+  0x42, 0x5D, 0xA6, 0x72, 0xFC, 0x45, 0x9C, 0x02, 0xFB, 0xC5, 0xD1, 0x30, 0xE1, 0xA1, 0x9B, 0x05,
+  0xE7, 0x7C, 0x5F, 0xD0, 0xE9, 0xCC, 0x05, 0xB6, 0x86, 0x55, 0x42, 0x47, 0x06, 0x0D, 0x59, 0x32,
+  0x1D, 0xBB, 0xB6, 0xD3, 0xC2, 0xFF, 0x75, 0xFA, 0xCD, 0x96, 0xC3, 0x10, 0x36, 0xAE, 0x92, 0xB5,
+  0xF7, 0x4A, 0xD5, 0x3B, 0x03, 0x98, 0x03, 0x72, 0xE5, 0x24, 0x04, 0x10, 0xB3, 0xC0, 0xF7, 0x79,
+  0x84, 0x0B, 0xC5, 0x9D, 0x62, 0x9D, 0x49, 0xC0, 0x43, 0x1D, 0x21, 0x93, 0x90, 0xC3, 0x34, 0xF0,
+  0xEF, 0xB6, 0x1F, 0x24, 0x20, 0x70, 0x70, 0x32, 0xB0, 0x29, 0xCB, 0x79, 0x24, 0xF0, 0xA4, 0xD0,
+  0x44, 0x1D, 0xDB, 0x88, 0xA1, 0xC5, 0xC7, 0x74, 0xDF, 0xAB, 0xE9, 0x7E, 0x08, 0x42, 0x73, 0xCC,
+  0x43, 0x93, 0xE2, 0x24, 0x65, 0x51, 0xC9, 0x05, 0x0F, 0xA6, 0xB3, 0x6C, 0xB8, 0xEB, 0x38, 0x35,
+  0x04, 0xB5, 0x5B, 0x26, 0xA8, 0x9C, 0x6C, 0x04, 0x6D, 0x00, 0x5B, 0x67, 0x59, 0x3C, 0x57, 0x13,
+  0xAF, 0x1B, 0xCA, 0xF9, 0x98, 0xA1, 0x56, 0xD3, 0x7A, 0x3D, 0x55, 0x07, 0xD1, 0x62, 0x99, 0x0D,
+  0xA3, 0x38, 0xB3, 0xBF, 0xCD, 0xAE, 0x16, 0x7C, 0x44, 0xAD, 0xDE, 0x35, 0x5B, 0x2C, 0x25, 0x81,
+  0x6E, 0x92, 0xDA, 0x7D, 0xC7, 0x17, 0x82, 0x51, 0x10, 0xC7, 0xB0, 0x0B, 0x9B, 0x99, 0xC6, 0x21,
+  0xD0, 0x2C, 0x08, 0xC3, 0xBE, 0xD3, 0xDF, 0x2B, 0x93, 0x0D, 0xE1, 0x33, 0xA7, 0x30, 0x24, 0xAE,
+  0x6E, 0x17, 0x8B, 0x70, 0x31, 0xC3, 0x20, 0x9A, 0x81, 0xC0, 0xC9, 0x6A, 0x45, 0x4B, 0xBC, 0xCC,
+  0x90, 0xAE, 0x61, 0x62, 0x11, 0x4C, 0x9D, 0xD6, 0x23, 0x28, 0xAF, 0xD3, 0x4B, 0xD5, 0x18, 0xD4,
+  0xAD, 0x45, 0x05, 0xF9, 0x14, 0x8B, 0x25, 0x4D, 0x62, 0x6F, 0x99, 0xAA, 0x65, 0x88, 0x37, 0x12,
+  0xAB, 0x45, 0xD7, 0xF2, 0x86, 0xE8, 0x0B, 0xED, 0x76, 0xBB, 0xE3, 0x9E, 0x23, 0x38, 0x0E, 0xDB,
+  0xB6, 0x09, 0xE8, 0x0A, 0x82, 0x22, 0x99, 0xD5, 0x0E, 0x40, 0xC6, 0xA6, 0xB9, 0xE4, 0x22, 0xA6,
+  0xED, 0x29, 0xA6, 0x25, 0x10, 0x17, 0x33, 0x0E, 0xBC, 0x87, 0xDA, 0xCD, 0x85, 0xA5, 0x25, 0x00,
+  0xA6, 0x86, 0x9F, 0x84, 0xF8, 0xE8, 0xF6, 0x48, 0x7C, 0xCC, 0xC4, 0x76, 0xCB, 0x37, 0x13, 0x10,
+  0x74, 0x5F, 0xD3, 0xD6, 0xDC, 0x86, 0x81, 0xF3, 0x1B, 0x63, 0x79, 0x30, 0x87, 0xC0, 0x2B, 0x24,
+  0xC6, 0x24, 0x89, 0x41, 0x5C, 0xA2, 0xD0, 0x60, 0xA0, 0x95, 0x1C, 0xF8, 0x53, 0xBC, 0xE1, 0x3B,
+  0xDB, 0x95, 0xAF, 0x8E, 0x43, 0xAF, 0x30, 0x46, 0xF1, 0x3E, 0x99, 0xB0, 0xEE, 0x5E, 0xFE, 0x8E,
+  0x25, 0xAC, 0xB7, 0xA3, 0x01, 0x83, 0xF7, 0xBE, 0x63, 0x02, 0xEF, 0x13, 0x3C, 0xD4, 0x29, 0xCB,
+  0x24, 0x85, 0x7D, 0xF0, 0x92, 0x38, 0x05, 0x19, 0x12, 0x24, 0x2B, 0x24, 0x0C, 0xD1, 0x5A, 0xBF,
+  0xA0, 0xB5, 0x7E, 0xBF, 0x5F, 0x12, 0x3C, 0x28, 0x74, 0x10, 0xDB, 0xBA, 0x68, 0x71, 0x40, 0xF4,
+  0x54, 0xB0, 0x1F, 0x44, 0x02, 0xF3, 0x02, 0x75, 0x3B, 0x3A, 0xE6, 0x76, 0x36, 0x40, 0x1C, 0x16,
+  0x83, 0xF5, 0x91, 0x63, 0xCE, 0x0B, 0x12, 0x2F, 0xE4, 0x2D, 0x31, 0x6C, 0x6F, 0x30, 0x68, 0xA9,
+  0xFF, 0x77, 0x49, 0xE6, 0x56, 0xCB, 0x9D, 0x26, 0x7B, 0x28, 0xC4, 0xAE, 0x5A, 0xA8, 0x3B, 0x86,
+  0x55, 0x01, 0x3B, 0x02, 0x95, 0xC7, 0x0B, 0x31, 0x60, 0xC8, 0x27, 0x99, 0x78, 0x2A, 0x18, 0x99,
+  0x9E, 0x00, 0x25, 0xDC, 0x6E, 0x0F, 0x10, 0x32, 0xFE, 0x4D, 0x60, 0x02, 0xA4, 0xB7, 0x36, 0x3F,
+  0x87, 0xE9, 0xA4, 0x92, 0x5D, 0xCA, 0x14, 0x47, 0x58, 0x2E, 0xE8, 0x65, 0x57, 0x27, 0x97, 0xDD,
+  0x62, 0xD1, 0x3A, 0x8A, 0x61, 0x5B, 0x6B, 0x71, 0x51, 0x37, 0xED, 0x4F, 0x9A, 0x63, 0x45, 0x6F,
+  0xEC, 0x96, 0x77, 0x6F, 0xA7, 0x69, 0x30, 0xBE, 0x1B, 0x86, 0xCC, 0xE9, 0x74, 0x53, 0xC6, 0x49,
+  0x9A, 0xE5, 0x6B, 0x5C, 0x24, 0x1C, 0x4D, 0xC7, 0x7C, 0x79, 0xBB, 0xFA, 0x9E, 0xEE, 0xD6, 0xEC,
+  0x69, 0xB7, 0x57, 0xBF, 0x64, 0x41, 0x55, 0x65, 0xDB, 0x47, 0x82, 0x97, 0xC2, 0x46, 0x72, 0x40,
+  0xB3, 0x66, 0xFE, 0x7B, 0x15, 0xBD, 0x57, 0x4B, 0xCD, 0xE5, 0x79, 0x0F, 0x87, 0xEE, 0x24, 0x23,
+  0x92, 0x94, 0x66, 0xEF, 0xD0, 0xB2, 0x6A, 0xD1, 0x1C, 0x44, 0x60, 0xA0, 0xE3, 0x7C, 0x6B, 0x65,
+  0xAC, 0x36, 0xEF, 0x5C, 0xAC, 0xC2, 0x50, 0x68, 0x76, 0xB4, 0x53, 0xF7, 0x9C, 0x03, 0xE1, 0xFB,
+  0x81, 0xE7, 0x66, 0xB1, 0x21, 0x76, 0x26, 0xC1, 0x25, 0xDA, 0x68, 0x48, 0x78, 0x42, 0x6C, 0x24,
+  0x84, 0x35, 0x29, 0x42, 0x2A, 0xA8, 0x20, 0x5B, 0xA2, 0x90, 0xE7, 0xB8, 0x62, 0x9D, 0x7E, 0x8C,
+  0x09, 0x15, 0x0A, 0xCC, 0xE9, 0xEC, 0x25, 0x2B, 0x95, 0xE0, 0x86, 0x5C, 0x5C, 0x43, 0x63, 0xBF,
+  0xB7, 0xA5, 0x01, 0x13, 0xA3, 0x02, 0xCC, 0xAE, 0xD0, 0x14, 0xAE, 0x90, 0x4B, 0x5F, 0x91, 0xCB,
+  0x8F, 0x88, 0x00, 0x7E, 0x09, 0x3A, 0xC8, 0x71, 0x56, 0x61, 0xA6, 0x93, 0xCE, 0x62, 0xA4, 0xA3,
+  0xDA, 0xC1, 0x1C, 0x6D, 0xA4, 0xEE, 0x6A, 0x08, 0x4B, 0x58, 0x58, 0x9A, 0x96, 0x2C, 0xC5, 0xF8,
+  0x7D, 0x73, 0x65, 0x0F, 0x9E, 0x24, 0x71, 0x52, 0x6A, 0x2F, 0x9C, 0x12, 0xD1, 0x27, 0x88, 0x50,
+  0x0F, 0x56, 0x54, 0x0E, 0xA9, 0x17, 0xA5, 0x15, 0x64, 0x9B, 0x43, 0x86, 0x8E, 0x03, 0xD6, 0xAB,
+  0x19, 0x92, 0x81, 0x93, 0xD6, 0x1B, 0x40, 0x68, 0xB2, 0x0E, 0xF1, 0x2F, 0x1D, 0x98, 0xB4, 0x49,
+  0x90, 0x20, 0xA4, 0x29, 0x34, 0x5E, 0x82, 0x79, 0x12, 0x91, 0x57, 0x35, 0x2E, 0x6F, 0x9E, 0x1A,
+  0x4A, 0x8A, 0x71, 0xC9, 0xE7, 0x39, 0x6F, 0x29, 0x46, 0x37, 0x98, 0xCF, 0x31, 0x2C, 0x02, 0xDC,
+  0xEC, 0x6E, 0x4E, 0x2F, 0x68, 0xD7, 0xB0, 0xCE, 0x23, 0xA0, 0x96, 0xED, 0x2E, 0x13, 0x3E, 0x4C,
+  0x7B, 0x19, 0xD4, 0x58, 0x3A, 0x3B, 0x48, 0x4F, 0xEB, 0x4C, 0xE0, 0xBE, 0x66, 0x02, 0x8F, 0x85,
+  0x28, 0x06, 0xD6, 0x1D, 0xF7, 0x1F, 0x71, 0x65, 0xF6, 0x0A, 0x7C, 0x2B, 0x39, 0xA7, 0x11, 0x21,
+  0x4A, 0x04, 0xB2, 0x54, 0xDA, 0x25, 0x4A, 0xEC, 0x0C, 0x9A, 0x25, 0x4B, 0x64, 0x90, 0x16, 0xB4,
+  0xD2, 0xA2, 0xD7, 0x49, 0x10, 0x12, 0x06, 0x14, 0xDE, 0x86, 0xE4, 0x70, 0xD6, 0xD3, 0xD4, 0x37,
+  0x76, 0x5B, 0xD8, 0xFD, 0xA2, 0xD3, 0x70, 0x4C, 0xCC, 0x17, 0x01, 0xF9, 0xD8, 0x5D, 0x70, 0x44,
+  0x9A, 0x1A, 0x14, 0xDC, 0xC8, 0x73, 0xBE, 0x0A, 0x8C, 0x53, 0x0B, 0xA3, 0xF3, 0xA8, 0xA7, 0x81,
+  0xE8, 0x2C, 0x92, 0x00, 0x36, 0xF7, 0xAA, 0x7E, 0x23, 0x37, 0x45, 0xA5, 0xEC, 0xD0, 0x92, 0xB8,
+  0xD4, 0xE1, 0xA7, 0x1C, 0xE4, 0x97, 0x5F, 0x8C, 0x70, 0xBF, 0xE7, 0xF7, 0xDD, 0x9D, 0xEE, 0x26,
+  0xB0, 0x65, 0xD3, 0xD6, 0xFD, 0xFE, 0xC3, 0x9D, 0xDD, 0x9D, 0x89, 0x0E, 0x55, 0x70, 0x82, 0x31,
+  0xE9, 0x9C, 0x39, 0x36, 0x00, 0xEC, 0x77, 0xFB, 0x0F, 0xFB, 0x0F, 0x5B, 0xF7, 0xF9, 0x64, 0xD0,
+  0x1F, 0x38, 0x82, 0xA1, 0xD2, 0x0B, 0x37, 0xF3, 0x66, 0xB9, 0xBA, 0xE8, 0xED, 0x69, 0xEA, 0x42,
+  0xBC, 0x98, 0x14, 0x4B, 0x02, 0xAE, 0x4C, 0xE1, 0x77, 0x39, 0x42, 0xF8, 0x3F, 0x24, 0x9F, 0xFB,
+  0x60, 0x2E, 0x7B, 0xBD, 0x5E, 0x8B, 0x89, 0xA2, 0x9D, 0x1A, 0x1D, 0x51, 0xB2, 0x6D, 0x75, 0x82,
+  0x4A, 0x35, 0xA0, 0xDA, 0xDC, 0x6B, 0x88, 0x8A, 0xC2, 0x21, 0x40, 0x36, 0xDD, 0xE6, 0xCA, 0x89,
+  0x4C, 0x00, 0xCB, 0x60, 0x7F, 0x50, 0xC9, 0xA0, 0x4C, 0xD9, 0x03, 0x1D, 0x37, 0x9D, 0x9C, 0xDC,
+  0x94, 0x15, 0xDE, 0x2B, 0x19, 0x06, 0xD0, 0x54, 0xE9, 0x45, 0x52, 0x0A, 0xA8, 0x53, 0x74, 0x37,
+  0x92, 0xF8, 0xBA, 0xB7, 0x53, 0xA3, 0x7B, 0x77, 0x4B, 0x9A, 0xE5, 0x3E, 0xC9, 0xE3, 0x1A, 0x74,
+  0x9A, 0x12, 0xEB, 0xFB, 0x65, 0x9A, 0x05, 0x93, 0xAB, 0xB6, 0xD2, 0x91, 0xCA, 0xCA, 0xAE, 0xB3,
+  0xBC, 0x61, 0x72, 0x21, 0xF7, 0xDB, 0x73, 0x37, 0x4B, 0x82, 0x4B, 0x4D, 0xF6, 0x8D, 0xC3, 0xD8,
+  0x7B, 0x9F, 0x1B, 0xD8, 0x0E, 0x5A, 0x33, 0x85, 0xBF, 0x3E, 0x78, 0xA8, 0x5B, 0x45, 0xC2, 0x5B,
+  0x07, 0x86, 0x99, 0xF2, 0x76, 0xC2, 0x41, 0x71, 0x24, 0xB8, 0xB4, 0x05, 0x68, 0x4B, 0xE4, 0x38,
+  0xBF, 0x66, 0x05, 0x52, 0xE4, 0xF5, 0x4A, 0xE6, 0x84, 0xC2, 0xCA, 0xCE, 0x0A, 0x2D, 0x79, 0xB3,
+  0x75, 0x9F, 0x42, 0x61, 0x6F, 0x72, 0x23, 0xA6, 0x34, 0x5B, 0xCD, 0x0F, 0xDC, 0xD5, 0x83, 0x1C,
+  0x85, 0x88, 0xAE, 0x73, 0xEB, 0x6A, 0x22, 0x29, 0xF9, 0xEE, 0xF2, 0xCD, 0xF4, 0xC1, 0x6E, 0x49,
+  0x1D, 0xC8, 0xD0, 0x54, 0x99, 0x7D, 0xFA, 0xBA, 0xB5, 0xD5, 0x77, 0xFE, 0x3F, 0xFB, 0x6C, 0xC8,
+  0x3E, 0x3F, 0x2C, 0x03, 0xEF, 0xFD, 0x27, 0x6D, 0x84, 0x8A, 0x70, 0x08, 0x08, 0xB9, 0x7A, 0x16,
+  0xBA, 0x98, 0x91, 0x73, 0x66, 0xDA, 0x5F, 0x8A, 0x70, 0x0C, 0xB3, 0xAD, 0x6C, 0xE1, 0xDD, 0xEF,
+  0x0D, 0xFA, 0xBD, 0xBE, 0xAB, 0x99, 0x13, 0xED, 0x28, 0xCE, 0xB8, 0x19, 0x89, 0x90, 0x80, 0xEA,
+  0x28, 0x4E, 0x06, 0xBA, 0xD0, 0x88, 0x27, 0x8C, 0x09, 0x7C, 0xAC, 0x34, 0x3C, 0x4D, 0xA7, 0xA7,
+  0xAB, 0xD9, 0x9E, 0x22, 0xD0, 0x54, 0x1D, 0xB4, 0x6C, 0x03, 0x74, 0xB1, 0x70, 0x33, 0x37, 0x7C,
+  0x77, 0x15, 0x9B, 0x54, 0xA6, 0x58, 0x6C, 0xDD, 0xAA, 0x40, 0x9F, 0x4F, 0x11, 0x66, 0x41, 0xFB,
+  0x8F, 0x34, 0xD2, 0x7F, 0x74, 0xB7, 0xEF, 0x68, 0x8E, 0x5D, 0xC3, 0x02, 0x35, 0x51, 0xB0, 0x15,
+  0xF3, 0x93, 0xD3, 0xA8, 0x00, 0xAF, 0x37, 0xAB, 0x4B, 0xAC, 0xD3, 0x1D, 0xC0, 0xFF, 0xFB, 0xBB,
+  0x68, 0xB0, 0x88, 0x35, 0x65, 0xB1, 0x9B, 0x66, 0x2B, 0xDC, 0x02, 0xB1, 0x1D, 0x6B, 0x1D, 0xD2,
+  0xDF, 0x93, 0xB7, 0xD7, 0x64, 0x86, 0x61, 0xE3, 0x90, 0x65, 0x63, 0x44, 0x54, 0xF6, 0x7A, 0xDD,
+  0xDE, 0xA0, 0x36, 0xD8, 0x63, 0x06, 0x88, 0x6A, 0x74, 0xF0, 0xA3, 0x47, 0x8F, 0x4A, 0x54, 0xF1,
+  0xB0, 0x96, 0x28, 0x44, 0xF8, 0x56, 0x73, 0x08, 0x6A, 0x5D, 0x4F, 0x5D, 0x64, 0xF4, 0x07, 0x69,
+  0x8D, 0x13, 0xD2, 0xA3, 0x50, 0x65, 0xC9, 0x23, 0xED, 0xEC, 0x6A, 0xE8, 0x52, 0xBE, 0x82, 0xE6,
+  0x12, 0x6C, 0x86, 0x1A, 0x69, 0x85, 0x24, 0xF1, 0x45, 0xBB, 0x57, 0x1F, 0xE9, 0x25, 0xEE, 0xC1,
+  0x77, 0x40, 0xCF, 0x7C, 0x81, 0xBD, 0xDA, 0x22, 0x44, 0x99, 0x02, 0xAD, 0x2C, 0xB8, 0x9B, 0xD9,
+  0xE4, 0x47, 0x4C, 0x82, 0xAC, 0x35, 0x0F, 0x22, 0x50, 0x61, 0x36, 0xB1, 0x7C, 0xAB, 0x3B, 0x49,
+  0x9A, 0x4D, 0x11, 0x3A, 0x8D, 0x85, 0x47, 0x29, 0x99, 0x12, 0x03, 0x1B, 0x28, 0x18, 0x88, 0xCB,
+  0x6A, 0x54, 0x83, 0xCE, 0x6C, 0xF5, 0xBC, 0x36, 0x58, 0x1D, 0x15, 0xFF, 0xAB, 0x39, 0xF7, 0x03,
+  0x97, 0xD9, 0x85, 0x2A, 0xDD, 0xDD, 0xC3, 0xCD, 0xBF, 0x66, 0xF9, 0x1A, 0x3F, 0x6E, 0x2D, 0x8E,
+  0xBE, 0x16, 0x18, 0xE0, 0x60, 0x5B, 0x1E, 0xEF, 0x1C, 0x6C, 0xD3, 0x89, 0xD5, 0x01, 0x1E, 0x80,
+  0xC0, 0x9B, 0x1F, 0x9C, 0x33, 0x2F, 0x74, 0xD3, 0x94, 0x8E, 0xA7, 0xCA, 0x7E, 0x55, 0x83, 0x05,
+  0xBE, 0xA8, 0x38, 0x85, 0xF2, 0xE7, 0x79, 0xF1, 0xE1, 0xFF, 0xF9, 0x6F, 0xFF, 0xE9, 0x7F, 0xB3,
+  0x53, 0x77, 0x79, 0xCE, 0xA7, 0x2E, 0x90, 0x18, 0x05, 0xE6, 0xC1, 0x54, 0x08, 0x7E, 0x58, 0xF2,
+  0x4E, 0xA7, 0x73, 0xB0, 0x0D, 0x60, 0x4D, 0xE0, 0x14, 0xDA, 0xC7, 0x25, 0x34, 0x18, 0x4D, 0x64,
+  0xD4, 0xA0, 0x5D, 0x42, 0x2A, 0x6D, 0x1C, 0x6E, 0x31, 0xA6, 0xB7, 0xA5, 0xE0, 0xBC, 0x61, 0x19,
+  0x89, 0x79, 0xC8, 0xA2, 0x23, 0xA8, 0xA6, 0x3E, 0x66, 0xAF, 0xBA, 0x99, 0x63, 0xD9, 0x69, 0x06,
+  0xF8, 0x6A, 0x1C, 0x1E, 0xC0, 0x3E, 0x44, 0xAA, 0x2D, 0x30, 0x3E, 0x94, 0x6C, 0x63, 0x91, 0xAC,
+  0x50, 0xAD, 0x5F, 0x60, 0xE4, 0xB8, 0x71, 0xF8, 0xE6, 0xED, 0xED, 0x3F, 0x9C, 0xA9, 0x06, 0x62,
+  0x35, 0x34, 0x9E, 0xE7, 0x46, 0xE7, 0x6E, 0xAA, 0xC0, 0x14, 0x06, 0x92, 0x18, 0x0E, 0xDE, 0x5F,
+  0xCA, 0x57, 0x71, 0xE8, 0xD6, 0x78, 0xB4, 0xDB, 0x90, 0xB2, 0x6D, 0xD4, 0xE8, 0xEE, 0xE2, 0x98,
+  0x02, 0x82, 0x04, 0x97, 0x0F, 0xAD, 0x9B, 0x2F, 0xF9, 0xCC, 0x2A, 0x4B, 0xD4, 0x54, 0x8A, 0x18,
+  0x90, 0x5F, 0x2E, 0x82, 0x84, 0xBF, 0xA2, 0x77, 0x89, 0x56, 0xC5, 0x0A, 0xC4, 0xA4, 0x8D, 0xC3,
+  0x17, 0x1C, 0x28, 0x6E, 0xBE, 0x00, 0x1D, 0x74, 0xFB, 0x27, 0x96, 0xF0, 0x71, 0x0C, 0x36, 0x04,
+  0xE3, 0x20, 0xA8, 0x80, 0x34, 0x81, 0x56, 0x6E, 0x3F, 0x74, 0xF4, 0xE5, 0x69, 0x63, 0x91, 0x62,
+  0x6C, 0x30, 0x37, 0x09, 0xDC, 0x36, 0x85, 0xD3, 0x47, 0x8D, 0xC7, 0x68, 0x3F, 0x72, 0x3C, 0xB0,
+  0x4C, 0x19, 0x6C, 0x67, 0xE0, 0xF3, 0x54, 0xEE, 0x03, 0x74, 0x95, 0x2A, 0x94, 0xA2, 0xDF, 0x0D,
+  0xF1, 0xD2, 0x60, 0xBE, 0x9B, 0xB9, 0x6D, 0x10, 0x4B, 0xA3, 0xC6, 0xAE, 0xD3, 0x38, 0x7C, 0xD0,
+  0x65, 0x30, 0xE4, 0xC1, 0xB6, 0xA8, 0xDD, 0xB4, 0x67, 0xDF, 0xC1, 0xAE, 0x83, 0x4F, 0xEA, 0xBA,
+  0xEB, 0x88, 0x61, 0x67, 0x1F, 0xDB, 0x73, 0x6F, 0x77, 0x47, 0x76, 0xFD, 0x1E, 0x30, 0xF6, 0xB1,
+  0xBD, 0xDB, 0x34, 0xE7, 0xF6, 0xC7, 0xCE, 0x99, 0x8E, 0x8E, 0x8F, 0x5F, 0x3F, 0x6D, 0x1C, 0x3E,
+  0x0B, 0x22, 0x06, 0x5C, 0x85, 0x63, 0xC3, 0x16, 0x71, 0x13, 0x46, 0xBE, 0x61, 0xF9, 0x03, 0x3E,
+  0xDF, 0x6B, 0xB7, 0xD9, 0xA9, 0x38, 0x8B, 0x61, 0x47, 0x71, 0x34, 0x09, 0xA6, 0xCB, 0xC4, 0x95,
+  0x6F, 0xF2, 0xC0, 0x18, 0xDC, 0xBF, 0x3A, 0x56, 0x53, 0xBC, 0x34, 0xEB, 0x1D, 0xFE, 0xF9, 0x3F,
+  0xFC, 0xAF, 0x52, 0x67, 0x7F, 0xA9, 0x1F, 0x38, 0x43, 0x13, 0xD1, 0x96, 0xCE, 0x95, 0x44, 0x60,
+  0x64, 0xD4, 0xD8, 0x86, 0x89, 0x67, 0x20, 0xE2, 0xD2, 0x06, 0x9B, 0xF3, 0x6C, 0x16, 0x03, 0x06,
+  0xDE, 0xBC, 0x3E, 0x3D, 0x93, 0x2C, 0x28, 0xEB, 0x9E, 0x41, 0x8F, 0x06, 0xC9, 0x09, 0xA4, 0x47,
+  0x90, 0x8D, 0xB0, 0xFA, 0x78, 0x32, 0x29, 0x08, 0x48, 0x9B, 0x55, 0x55, 0x4E, 0xEC, 0x2A, 0x39,
+  0x51, 0x6D, 0x4C, 0x87, 0x4C, 0x5A, 0x1D, 0xD4, 0x8A, 0xE3, 0x1F, 0x98, 0xA3, 0x64, 0x2C, 0x94,
+  0x57, 0xFF, 0xF9, 0x9F, 0xD9, 0x59, 0x90, 0x25, 0x1C, 0x57, 0xE4, 0x15, 0x2B, 0xA2, 0xA6, 0x46,
+  0x67, 0x3A, 0xA2, 0x28, 0x98, 0xB2, 0x21, 0x0F, 0xD6, 0xE5, 0x0B, 0x08, 0xD7, 0x90, 0x47, 0x53,
+  0xE4, 0xED, 0x81, 0xD3, 0x00, 0x8E, 0x02, 0x3E, 0x49, 0x38, 0x88, 0xAB, 0xD0, 0xF5, 0xF8, 0x2C,
+  0x0E, 0x41, 0xDD, 0x8E, 0x1A, 0x4F, 0x5E, 0xBF, 0x7A, 0x75, 0xCC, 0x1E, 0xBF, 0x7A, 0x75, 0xFB,
+  0xC7, 0x63, 0xD6, 0x73, 0x7A, 0xBB, 0x74, 0xC0, 0xAE, 0x8D, 0x91, 0xCE, 0x31, 0xB0, 0x26, 0x17,
+  0x58, 0xA7, 0x11, 0xF4, 0xB8, 0xDF, 0xC3, 0xB2, 0xC3, 0xB2, 0x43, 0xC8, 0x38, 0xE2, 0xA4, 0x85,
+  0x38, 0x4B, 0x2D, 0x77, 0x32, 0x09, 0xC0, 0x25, 0x61, 0x3F, 0x2C, 0xDD, 0xC8, 0x07, 0xBD, 0x53,
+  0x2C, 0x90, 0xA5, 0x5C, 0x72, 0x3A, 0x10, 0x11, 0x8D, 0xAA, 0x21, 0xB1, 0x60, 0x7C, 0xFC, 0xB3,
+  0x1A, 0xB9, 0xE2, 0xBC, 0xA6, 0x06, 0xC5, 0x88, 0xD6, 0xBF, 0x67, 0x4F, 0x41, 0xBE, 0x32, 0x9E,
+  0x81, 0x9C, 0x5B, 0x02, 0x7A, 0xBD, 0x60, 0x1C, 0xF2, 0x3A, 0xBC, 0x56, 0xE4, 0x98, 0x01, 0xB0,
+  0x76, 0x4F, 0xE5, 0x5E, 0x08, 0x56, 0xF1, 0x5D, 0x25, 0xF5, 0xC4, 0x93, 0xD8, 0x16, 0xF1, 0x9C,
+  0x6F, 0xC3, 0xF6, 0x61, 0x69, 0x55, 0x9B, 0x40, 0xCE, 0x82, 0xB9, 0x84, 0x2C, 0x9E, 0xD4, 0x86,
+  0xCF, 0x49, 0xAA, 0xF2, 0x05, 0x88, 0xEE, 0xF5, 0x43, 0x94, 0x0A, 0x7E, 0x11, 0xC4, 0xFE, 0xFB,
+  0x9F, 0xD9, 0x29, 0xD2, 0x07, 0xF3, 0xE5, 0xF6, 0x82, 0x17, 0xFD, 0x0B, 0xA1, 0xD5, 0xA8, 0x37,
+  0xD9, 0x05, 0xE9, 0x8E, 0x86, 0x05, 0x15, 0x08, 0xAE, 0x96, 0x57, 0x37, 0xA4, 0xA0, 0x60, 0x71,
+  0xAE, 0x89, 0x48, 0x2B, 0xFA, 0x48, 0xCC, 0x69, 0x40, 0x4A, 0xDD, 0xA0, 0x63, 0xBC, 0x20, 0xB9,
+  0x72, 0xEE, 0x86, 0x4B, 0x68, 0x0A, 0x62, 0xF2, 0x29, 0xFF, 0xDE, 0xFD, 0x7A, 0xC9, 0x5E, 0x81,
+  0x7C, 0x70, 0xC3, 0x83, 0x6D, 0x51, 0x7F, 0x67, 0xC7, 0x6E, 0xDE, 0xF1, 0x24, 0x71, 0xD3, 0x8D,
+  0xBB, 0xF5, 0xF2, 0x6E, 0xCF, 0x33, 0x30, 0xDF, 0xC0, 0x5C, 0x59, 0xD5, 0x15, 0xD8, 0x85, 0x96,
+  0x58, 0xC2, 0xE6, 0x46, 0xD4, 0xB5, 0x06, 0xC1, 0xC4, 0xEC, 0xBF, 0xC3, 0x03, 0x25, 0xE0, 0xE0,
+  0x78, 0x19, 0x72, 0xD4, 0x2E, 0xF5, 0x28, 0xD6, 0xC5, 0x74, 0xF9, 0xF0, 0xB4, 0x0E, 0xB3, 0x95,
+  0xF6, 0xA5, 0x93, 0xD2, 0x9A, 0x3E, 0x2B, 0x7B, 0x09, 0x76, 0xD0, 0x27, 0x5B, 0xD3, 0x77, 0xF5,
+  0x98, 0x74, 0x3E, 0xD8, 0xA8, 0xE3, 0xC5, 0x3B, 0x67, 0x4B, 0x31, 0x0E, 0x6D, 0xF8, 0x23, 0x51,
+  0xB0, 0x1A, 0xD6, 0x8A, 0x8A, 0x55, 0xC5, 0x95, 0x71, 0xA5, 0x55, 0xA9, 0x0D, 0xA9, 0xD9, 0x61,
+  0x35, 0x30, 0xEA, 0x48, 0xE0, 0x0E, 0x81, 0x50, 0x32, 0x54, 0x65, 0x00, 0x49, 0xEA, 0x47, 0xF5,
+  0x76, 0xB8, 0x4E, 0x8A, 0x18, 0x2F, 0xAA, 0x4C, 0x57, 0xF9, 0x52, 0x56, 0x2C, 0x41, 0x03, 0xA7,
+  0x29, 0x88, 0x0A, 0x34, 0x1F, 0x26, 0x81, 0x52, 0xF9, 0x95, 0x95, 0x17, 0x6A, 0x5F, 0xA8, 0xFE,
+  0xBE, 0x21, 0x71, 0xCA, 0x50, 0x40, 0xF1, 0xF7, 0xB5, 0xD6, 0x8B, 0xC3, 0x37, 0x1C, 0x36, 0x25,
+  0x8A, 0x80, 0x83, 0x52, 0xFE, 0x23, 0x0B, 0x2D, 0x77, 0xB1, 0x70, 0x13, 0x1E, 0x79, 0xD4, 0x37,
+  0x23, 0x35, 0x7B, 0x87, 0x2E, 0x5A, 0xDC, 0x21, 0x1F, 0xC9, 0xDB, 0xE9, 0x35, 0x56, 0xE1, 0xB0,
+  0x8E, 0xD1, 0x74, 0x36, 0xE3, 0x91, 0x7F, 0x3C, 0x99, 0x00, 0x6E, 0x1A, 0x87, 0x7F, 0xFE, 0xA7,
+  0x9F, 0x19, 0x3E, 0x67, 0x77, 0x48, 0x52, 0x53, 0xA8, 0x15, 0x00, 0xA4, 0x50, 0xD3, 0x20, 0x6E,
+  0xAD, 0x15, 0x31, 0x29, 0xF8, 0x1B, 0x81, 0x87, 0x26, 0xC7, 0x7F, 0xF9, 0x57, 0x86, 0xCE, 0xC7,
+  0x5A, 0x29, 0x63, 0xF6, 0x1D, 0x63, 0xAA, 0x19, 0x79, 0x57, 0xFF, 0x93, 0x1D, 0xA1, 0x77, 0x19,
+  0x67, 0x6E, 0x94, 0x6D, 0xD8, 0x79, 0xE2, 0xFA, 0x64, 0xE9, 0xFC, 0xE3, 0x3F, 0xB0, 0x67, 0xF0,
+  0xC8, 0x82, 0x68, 0x3B, 0x5E, 0x6E, 0xDA, 0x39, 0x01, 0x11, 0x31, 0x8E, 0x2F, 0xA8, 0xFF, 0xBF,
+  0x63, 0x8F, 0x13, 0xAF, 0xCD, 0xA3, 0xB6, 0x07, 0x58, 0xAE, 0xEF, 0x5F, 0x27, 0x1D, 0xD7, 0x12,
+  0xFD, 0x06, 0x1B, 0x76, 0x54, 0x15, 0x8D, 0x1A, 0x29, 0xD6, 0xEF, 0xD8, 0x47, 0xC9, 0xC8, 0x4F,
+  0x91, 0x90, 0x6B, 0xE5, 0x63, 0x69, 0xD2, 0x5B, 0xBF, 0x9C, 0x80, 0xDC, 0x44, 0x3C, 0xAA, 0xD1,
+  0xEF, 0x90, 0x90, 0x9B, 0x0A, 0xB1, 0x3B, 0x65, 0xA3, 0x1A, 0x6F, 0x9D, 0x78, 0xFC, 0x48, 0xD3,
+  0x68, 0xB5, 0x58, 0x84, 0xC1, 0x4E, 0xEB, 0x25, 0xE3, 0x4A, 0x51, 0x78, 0x34, 0x73, 0xE7, 0x0B,
+  0xF0, 0xCD, 0x5D, 0x6F, 0x76, 0xFB, 0x21, 0x65, 0x0B, 0x70, 0x9E, 0x58, 0xE8, 0xB2, 0x34, 0x5E,
+  0xCE, 0x83, 0x34, 0x45, 0x5A, 0xD7, 0x84, 0xA1, 0x6E, 0xFF, 0x89, 0x40, 0xA1, 0xA6, 0x00, 0xDE,
+  0x2A, 0xA6, 0x57, 0x6F, 0xB9, 0xB5, 0x52, 0xD8, 0xF1, 0xEB, 0x21, 0x9C, 0x18, 0x10, 0x4E, 0x72,
+  0x08, 0xBD, 0xC1, 0x60, 0x63, 0x18, 0x4F, 0x0C, 0x18, 0x4F, 0x3E, 0x6E, 0x16, 0x6A, 0xB3, 0xDE,
+  0x6A, 0xF2, 0xEB, 0xC8, 0x5C, 0xCD, 0x86, 0x73, 0x51, 0x1D, 0x4F, 0xCA, 0x90, 0xB4, 0x55, 0x75,
+  0x3F, 0x0A, 0xD2, 0x93, 0x32, 0xA4, 0xBA, 0xB5, 0x1D, 0x6C, 0xA3, 0x8F, 0x59, 0xEB, 0xE6, 0x3E,
+  0x01, 0xB1, 0x86, 0x07, 0xF2, 0x20, 0xCF, 0x85, 0xF2, 0x5B, 0x24, 0x41, 0xE4, 0x05, 0x0B, 0x77,
+  0x79, 0x79, 0x87, 0x8B, 0xAB, 0x47, 0xBB, 0xC4, 0xA9, 0xFE, 0x1D, 0x01, 0x0C, 0x9C, 0xF6, 0x38,
+  0x8B, 0x30, 0xFA, 0x95, 0xBB, 0xC1, 0x0D, 0x05, 0x42, 0x1E, 0x06, 0x57, 0xA2, 0x61, 0x89, 0xE9,
+  0x43, 0x6F, 0x16, 0x01, 0x50, 0x23, 0x5D, 0x45, 0xDE, 0x19, 0x79, 0x1E, 0x8A, 0x2D, 0xD4, 0x89,
+  0x30, 0x0E, 0xF3, 0x5F, 0xFF, 0x23, 0xC3, 0x06, 0xB3, 0x24, 0x8E, 0x40, 0xF3, 0x26, 0xEC, 0x4B,
+  0x74, 0xB9, 0x3E, 0x0A, 0xFE, 0x5B, 0x0E, 0x0E, 0x79, 0x0E, 0x5C, 0x9C, 0x02, 0x93, 0xAE, 0xFA,
+  0x3B, 0x46, 0x55, 0x9B, 0x84, 0x1A, 0xCA, 0xC8, 0x95, 0x5E, 0x40, 0x32, 0xCF, 0x23, 0x73, 0x07,
+  0xB3, 0xEE, 0xE1, 0x1B, 0x37, 0x71, 0xE7, 0xB7, 0x3F, 0x83, 0x2D, 0x90, 0xB2, 0xC7, 0xE7, 0x6E,
+  0xE4, 0x21, 0x53, 0x16, 0x11, 0xAF, 0xC9, 0xC5, 0xD7, 0x30, 0xB2, 0xF2, 0x81, 0xB5, 0xE0, 0xE9,
+  0x80, 0x4E, 0x2A, 0x54, 0x44, 0xB8, 0xB3, 0xBB, 0x7F, 0xCE, 0x13, 0x50, 0xA8, 0x6E, 0x28, 0xE3,
+  0xAD, 0x73, 0xA0, 0xA8, 0x10, 0x43, 0x5B, 0x79, 0x78, 0x0E, 0x06, 0xFB, 0xD8, 0xA8, 0x84, 0xEB,
+  0xE3, 0x8C, 0xB8, 0x7F, 0x57, 0x54, 0x62, 0x15, 0x36, 0x2B, 0x9B, 0x53, 0xDD, 0x3F, 0x0A, 0x18,
+  0x8C, 0x1A, 0xC6, 0x7E, 0x81, 0x39, 0xF4, 0xF6, 0xEC, 0x88, 0x01, 0x35, 0x79, 0x60, 0x35, 0x09,
+  0x87, 0x39, 0x8C, 0xF1, 0xD8, 0x0C, 0x35, 0x5D, 0xE4, 0x9E, 0x07, 0x53, 0xF0, 0x67, 0x97, 0xB0,
+  0x23, 0xD8, 0xAD, 0x7E, 0x7B, 0xEF, 0x98, 0x92, 0xDC, 0x52, 0x73, 0xBF, 0x0F, 0xDF, 0xDE, 0x7E,
+  0x90, 0x39, 0xFF, 0x38, 0x8F, 0x0A, 0xC5, 0x18, 0xF2, 0x75, 0xD6, 0x3B, 0x94, 0xB6, 0x07, 0xC5,
+  0xFA, 0x8A, 0xA8, 0x8F, 0xB9, 0xF5, 0x14, 0x97, 0xFE, 0xA4, 0x98, 0x0C, 0x59, 0x39, 0xC7, 0x91,
+  0x3B, 0x0E, 0x39, 0x34, 0x7A, 0x4C, 0x87, 0x31, 0x09, 0x33, 0xC7, 0xAC, 0x3A, 0xBA, 0x9A, 0x71,
+  0x66, 0x00, 0x90, 0xB2, 0xC4, 0x04, 0xBA, 0xB5, 0xD6, 0x75, 0x94, 0xE9, 0xAC, 0xDC, 0x3F, 0x7C,
+  0xBD, 0x0C, 0x56, 0x18, 0x38, 0x15, 0x3F, 0xF5, 0x15, 0x72, 0x72, 0xB5, 0x69, 0xD5, 0x12, 0x5A,
+  0xA3, 0xE3, 0x36, 0xC0, 0xCB, 0x73, 0x3C, 0x4D, 0x80, 0x51, 0x1B, 0x87, 0xEA, 0x09, 0x88, 0xC3,
+  0x9E, 0xA7, 0xCD, 0xD5, 0xB1, 0x2A, 0x41, 0x07, 0xD1, 0x72, 0x3E, 0xCE, 0x37, 0xDE, 0x80, 0xA4,
+  0x63, 0xA8, 0x28, 0x04, 0x3B, 0x5C, 0xC4, 0xB0, 0xE6, 0xEE, 0x25, 0x3E, 0x38, 0x8E, 0x8A, 0x76,
+  0x60, 0xA1, 0x5C, 0xF7, 0xC0, 0x71, 0x8C, 0xD8, 0xD5, 0x9D, 0x6B, 0xCB, 0xA3, 0x76, 0x68, 0xBF,
+  0x8B, 0x43, 0x8A, 0x61, 0x77, 0xBB, 0xDD, 0xDD, 0x5F, 0xBF, 0xEA, 0xDF, 0x05, 0x91, 0x8F, 0xD6,
+  0xE7, 0x53, 0x9E, 0x44, 0xC1, 0xED, 0xCF, 0x28, 0x33, 0x04, 0x6F, 0xC1, 0x83, 0x3D, 0xE1, 0xD1,
+  0xED, 0xBF, 0x80, 0x1C, 0xF9, 0x78, 0x14, 0x48, 0xB0, 0x3A, 0x02, 0x54, 0x11, 0x2D, 0xBF, 0x2B,
+  0x57, 0x4F, 0x81, 0xE2, 0x22, 0xD6, 0xA3, 0x08, 0x65, 0xCD, 0xDA, 0x2B, 0x2C, 0xF3, 0xF4, 0xF6,
+  0xC3, 0x24, 0x08, 0x7F, 0x25, 0x8E, 0x01, 0x35, 0x03, 0x4E, 0x04, 0xAF, 0xF0, 0x8C, 0x31, 0xE8,
+  0x5A, 0x96, 0x29, 0x41, 0x90, 0x18, 0x29, 0xC3, 0xFD, 0x37, 0xC9, 0x36, 0x72, 0x11, 0x05, 0xE3,
+  0x7C, 0x1D, 0x64, 0xE0, 0x33, 0x10, 0xD7, 0x6C, 0x53, 0xB6, 0xC9, 0x47, 0x11, 0x4E, 0x19, 0x9C,
+  0x89, 0xAA, 0x32, 0xFF, 0x14, 0xEC, 0x93, 0x73, 0x4F, 0x4E, 0x3F, 0x3B, 0x1F, 0xC9, 0x3B, 0x77,
+  0x2C, 0xF0, 0xC4, 0x05, 0x97, 0xE6, 0x18, 0x8F, 0x13, 0x61, 0x69, 0x8B, 0xCB, 0x4F, 0x59, 0x14,
+  0x82, 0x30, 0xD7, 0x43, 0x25, 0xB4, 0x94, 0x1D, 0xB9, 0x94, 0xDE, 0x60, 0x57, 0x2D, 0xA5, 0x57,
+  0x58, 0x78, 0x3B, 0xBF, 0xB6, 0x18, 0x90, 0xF3, 0x79, 0x19, 0xA3, 0x13, 0x8B, 0x7F, 0x6F, 0x46,
+  0xD0, 0xD4, 0xDE, 0x5C, 0x92, 0x00, 0xB1, 0x9E, 0x2C, 0x0B, 0x52, 0x7E, 0x0C, 0xBA, 0x9F, 0xD9,
+  0x69, 0xC0, 0xFC, 0xDB, 0x0F, 0x0B, 0x58, 0x01, 0x4A, 0x99, 0x0D, 0x28, 0xBB, 0xDB, 0x38, 0x3C,
+  0x8B, 0x97, 0xDF, 0xD3, 0x71, 0x9A, 0x3D, 0x75, 0x97, 0xE0, 0xA8, 0x6C, 0xD6, 0x11, 0x04, 0xC0,
+  0x63, 0x10, 0xE9, 0x49, 0xFB, 0x2D, 0xCF, 0xE8, 0x68, 0x69, 0x83, 0x3E, 0xFD, 0xC6, 0xE1, 0x57,
+  0x11, 0x87, 0x39, 0x83, 0x53, 0x0C, 0xD8, 0x0A, 0xD2, 0xCD, 0x38, 0x6A, 0xF5, 0xE1, 0xA1, 0x31,
+  0x05, 0x8C, 0xDD, 0x9B, 0xE0, 0x59, 0x74, 0xFB, 0x01, 0x13, 0x70, 0x03, 0xCC, 0x12, 0x63, 0xCB,
+  0x48, 0x1E, 0x34, 0x2C, 0xC2, 0x65, 0x0A, 0x1E, 0x55, 0x32, 0xC5, 0xE8, 0x0E, 0xC7, 0xB0, 0x8F,
+  0x38, 0x77, 0x00, 0x10, 0x76, 0xEA, 0x2E, 0x27, 0x4C, 0x61, 0xA4, 0xD9, 0xD9, 0xDC, 0xED, 0xDB,
+  0x88, 0xF4, 0x61, 0xA2, 0xCB, 0x24, 0xAA, 0x72, 0xB8, 0x5C, 0xC0, 0x5F, 0xC4, 0xE8, 0x25, 0xD8,
+  0x26, 0x2D, 0x95, 0x2B, 0xEF, 0x66, 0xFA, 0xDD, 0x5F, 0x96, 0xE9, 0xC1, 0xD7, 0x01, 0x3B, 0xF5,
+  0x8D, 0xBB, 0x4C, 0xF9, 0x0B, 0x3E, 0x01, 0x4B, 0x8E, 0x1E, 0xD9, 0x09, 0x51, 0xDC, 0x47, 0xDB,
+  0x05, 0x2B, 0x80, 0x9A, 0x6B, 0xAE, 0xD4, 0xD2, 0xA2, 0x95, 0xA1, 0xD0, 0xAF, 0x37, 0x14, 0x76,
+  0x9C, 0x5F, 0x6D, 0xDD, 0x6F, 0xF1, 0xF8, 0x5C, 0x2D, 0xFC, 0x69, 0x12, 0xC3, 0xDE, 0xFF, 0x02,
+  0x0B, 0x17, 0x50, 0x57, 0xAE, 0x5C, 0x56, 0xFF, 0xBF, 0x58, 0xFA, 0xEB, 0x88, 0x9F, 0xCE, 0xE2,
+  0xEC, 0x29, 0x0F, 0x5D, 0x70, 0xFA, 0x40, 0xC5, 0x87, 0x6E, 0xC0, 0x8E, 0x80, 0x13, 0x93, 0xDB,
+  0x0F, 0x0C, 0x2A, 0xDB, 0x58, 0xFB, 0xA9, 0x18, 0x30, 0x80, 0x9B, 0xAB, 0x37, 0xAB, 0x8C, 0x95,
+  0xEB, 0xD6, 0x61, 0xD7, 0x29, 0x96, 0xBE, 0xF7, 0xEB, 0x2C, 0xFD, 0x34, 0x8B, 0x17, 0x47, 0x94,
+  0x56, 0xD3, 0x38, 0xCC, 0x17, 0x8C, 0x67, 0xE2, 0x12, 0x0B, 0x1B, 0xEA, 0x86, 0x2A, 0xB4, 0xDA,
+  0x05, 0xEB, 0xA3, 0xFD, 0x5B, 0x36, 0x80, 0xE4, 0x72, 0xC0, 0xE3, 0xCB, 0xDC, 0x04, 0x7D, 0x3E,
+  0xF1, 0xA0, 0x91, 0xCC, 0x5F, 0x42, 0x31, 0x0A, 0x6C, 0x2D, 0x0A, 0xF3, 0x4A, 0x83, 0x6A, 0x44,
+  0x12, 0x45, 0xC5, 0xAC, 0xFE, 0x15, 0x3D, 0x0A, 0x30, 0x8C, 0x3D, 0xE0, 0x97, 0xDB, 0x0F, 0x32,
+  0x7B, 0xE1, 0x4D, 0x12, 0x4F, 0x13, 0x54, 0x64, 0xE7, 0x2B, 0xCF, 0x4E, 0x4B, 0x69, 0x33, 0x94,
+  0x03, 0xA9, 0xBE, 0x61, 0x2D, 0x25, 0x92, 0xEA, 0x99, 0x91, 0x54, 0xC5, 0x23, 0x7F, 0xBF, 0xB1,
+  0xFA, 0x0C, 0x41, 0xE2, 0x08, 0xE6, 0xC4, 0xC3, 0x7A, 0xC3, 0xDB, 0xA8, 0xBA, 0x23, 0x42, 0xAF,
+  0x1B, 0x2D, 0xAF, 0x27, 0x93, 0x0D, 0xE3, 0xFA, 0x5D, 0xE4, 0xA0, 0xCD, 0x63, 0xF8, 0x39, 0x61,
+  0x55, 0xE2, 0x32, 0x94, 0x50, 0x47, 0xE2, 0x68, 0xBC, 0xCC, 0x48, 0xF8, 0xDC, 0x41, 0x37, 0xB4,
+  0xB6, 0xD3, 0x1A, 0x9A, 0xD1, 0x2B, 0xEE, 0xD6, 0xA7, 0x7B, 0x4E, 0x4E, 0x01, 0x22, 0x31, 0x0E,
+  0xF3, 0xE2, 0xF6, 0x65, 0x36, 0x04, 0x65, 0x54, 0x52, 0x3A, 0x04, 0x1D, 0xCB, 0xD7, 0x9D, 0x10,
+  0xAC, 0x5F, 0x0E, 0x08, 0x95, 0x8D, 0xD7, 0x72, 0x1C, 0xAD, 0xD8, 0x3E, 0x7F, 0x93, 0x75, 0xF4,
+  0x7F, 0xD5, 0x75, 0x3C, 0x5D, 0xA2, 0x58, 0xDC, 0x78, 0x29, 0x4F, 0x65, 0x68, 0xB2, 0x6E, 0x3D,
+  0x45, 0x9D, 0x70, 0x91, 0x1D, 0xC5, 0xCE, 0x3D, 0x67, 0x85, 0x16, 0x50, 0x7A, 0x51, 0x5B, 0xDC,
+  0xA3, 0x8F, 0x58, 0xDC, 0xDA, 0x73, 0x23, 0xC3, 0x6A, 0x25, 0x3B, 0x6C, 0x11, 0x87, 0x82, 0xB9,
+  0x43, 0x4C, 0x5F, 0x73, 0x83, 0x84, 0x33, 0xD4, 0x0A, 0x9C, 0x9D, 0x4B, 0xA3, 0xD0, 0x27, 0x12,
+  0x45, 0xAB, 0x16, 0x0F, 0x40, 0x6F, 0xFF, 0x84, 0xD7, 0x72, 0xA0, 0xBD, 0xEA, 0x5D, 0x79, 0x18,
+  0x4A, 0xC1, 0x80, 0x4A, 0xD2, 0x62, 0x89, 0x30, 0x1D, 0xE3, 0x25, 0x1B, 0xC7, 0x4B, 0x2F, 0x14,
+  0x69, 0x72, 0x18, 0x00, 0x5C, 0x6F, 0xBC, 0x56, 0xFC, 0xFE, 0x17, 0x4B, 0x40, 0x13, 0xA6, 0xFC,
+  0xDE, 0x7E, 0xF8, 0x15, 0x22, 0x65, 0xF9, 0x87, 0x48, 0x1B, 0xFB, 0x45, 0xE5, 0x2E, 0xEB, 0xB4,
+  0x13, 0xC6, 0x3D, 0x4B, 0xAE, 0xD0, 0x46, 0x5A, 0x6D, 0xEE, 0x46, 0x4B, 0x34, 0xC3, 0x5F, 0xC2,
+  0xBF, 0xF5, 0x27, 0x84, 0x9F, 0xA0, 0xDD, 0x3E, 0x21, 0x72, 0x94, 0x2F, 0x15, 0x3C, 0x02, 0x97,
+  0xCE, 0x0B, 0x6D, 0xA7, 0xDD, 0x1B, 0x0C, 0xEE, 0x54, 0x73, 0x09, 0x06, 0x49, 0x1B, 0x25, 0x7C,
+  0xE5, 0x61, 0x22, 0xAD, 0xC4, 0xD0, 0x67, 0x74, 0x60, 0xA2, 0xE4, 0xEA, 0xC0, 0x29, 0x27, 0x75,
+  0x69, 0xDA, 0x64, 0xA3, 0x6C, 0xFF, 0x86, 0xF0, 0x3D, 0x47, 0xAC, 0xDD, 0x05, 0xAA, 0xF4, 0xDD,
+  0x05, 0x90, 0x10, 0x73, 0x97, 0x2C, 0x8A, 0xE7, 0xE3, 0x84, 0x8E, 0xDE, 0x17, 0x6E, 0x14, 0x71,
+  0x77, 0x89, 0xAE, 0x7E, 0x99, 0x45, 0x56, 0x9D, 0xB1, 0x14, 0x93, 0xFF, 0x52, 0x96, 0x56, 0x17,
+  0x25, 0x97, 0xD0, 0xEE, 0x6E, 0x1A, 0xDE, 0x5A, 0xC5, 0x8F, 0x2F, 0x78, 0xCA, 0xE6, 0xB1, 0x1F,
+  0x4C, 0x30, 0xE7, 0x96, 0xBE, 0x91, 0x4C, 0x61, 0xE1, 0x0C, 0x6F, 0x4F, 0x09, 0x7E, 0x58, 0x82,
+  0x40, 0x4A, 0x59, 0x30, 0x9F, 0xDF, 0x7E, 0xF0, 0x03, 0x57, 0xC4, 0x75, 0x59, 0x8A, 0x67, 0x72,
+  0x9A, 0xDF, 0xE8, 0x2E, 0x92, 0xDB, 0x9F, 0x53, 0x60, 0xE0, 0xF3, 0x38, 0x30, 0x32, 0x51, 0xAB,
+  0xA7, 0x3F, 0x07, 0x22, 0x21, 0x5B, 0xBB, 0x09, 0xE7, 0xED, 0xC9, 0x13, 0xF6, 0x6C, 0x19, 0x86,
+  0xA9, 0x97, 0x70, 0xAE, 0xE7, 0x39, 0xFE, 0xF9, 0x6F, 0xFF, 0x3B, 0xA6, 0xDD, 0x0D, 0xE8, 0xE1,
+  0xCE, 0x4B, 0x76, 0x98, 0x7D, 0xE0, 0xB2, 0x59, 0xC2, 0x27, 0x80, 0xC9, 0x2C, 0x5B, 0xA4, 0xC3,
+  0xED, 0xED, 0x69, 0x90, 0xCD, 0x96, 0xE3, 0x0E, 0x88, 0x84, 0x6D, 0xA3, 0x6D, 0xC3, 0xCC, 0xD9,
+  0x93, 0x97, 0xD1, 0x34, 0x58, 0x86, 0x4E, 0x71, 0x36, 0x6A, 0xFC, 0x61, 0x0C, 0x03, 0xBC, 0xC7,
+  0x64, 0xB1, 0x10, 0x84, 0x6F, 0x1C, 0x2F, 0x38, 0x1D, 0xF3, 0x9E, 0x04, 0xD9, 0x97, 0xCB, 0xF1,
+  0xC1, 0xB6, 0x7B, 0xD8, 0xA4, 0x29, 0xE5, 0xE3, 0x6D, 0xBB, 0x20, 0x7C, 0xB2, 0x32, 0xD4, 0xBD,
+  0xBD, 0xBD, 0xC6, 0xE1, 0xED, 0xDF, 0xB2, 0x45, 0x12, 0x2F, 0xE2, 0x14, 0xBB, 0x21, 0x3A, 0x68,
+  0xF1, 0x5B, 0x35, 0xA9, 0xD5, 0x94, 0x49, 0x2F, 0xF3, 0xD7, 0xE8, 0x51, 0x9D, 0x97, 0x1E, 0x00,
+  0x62, 0x82, 0x05, 0xF0, 0xE0, 0xF6, 0x36, 0x1B, 0x8D, 0x46, 0xEC, 0xAB, 0x2C, 0x08, 0x83, 0x0C,
+  0x25, 0x66, 0xCA, 0xD4, 0x01, 0x3B, 0x94, 0x6F, 0x79, 0xB0, 0x73, 0x98, 0xBE, 0x77, 0x09, 0xB4,
+  0x18, 0xB1, 0xD1, 0x21, 0x8B, 0x3A, 0x59, 0x7C, 0x9A, 0xE1, 0xD7, 0x5A, 0x76, 0x77, 0xB7, 0xD9,
+  0x59, 0xB8, 0x3E, 0xA9, 0x6B, 0xBB, 0xD7, 0xB2, 0x1C, 0xAB, 0xB9, 0xBF, 0x35, 0x01, 0x37, 0x89,
+  0xE4, 0x01, 0xF4, 0x39, 0x8B, 0xDF, 0x4E, 0xC7, 0xF6, 0xAC, 0x79, 0x3D, 0x1B, 0xCD, 0x3A, 0x09,
+  0xA7, 0x3C, 0x48, 0xDB, 0xBA, 0x6F, 0xB5, 0x2C, 0x68, 0x99, 0x90, 0xFB, 0xCC, 0xAE, 0x93, 0xE1,
+  0x02, 0x6F, 0x46, 0x02, 0xF9, 0x6D, 0xCF, 0x3A, 0xE9, 0x72, 0x9C, 0x66, 0x89, 0xED, 0xB4, 0x7A,
+  0xCD, 0x16, 0x80, 0x6F, 0x4D, 0x6B, 0x2A, 0x7B, 0xAA, 0x72, 0x5C, 0x53, 0xB9, 0x23, 0x2B, 0x6F,
+  0xF6, 0x6F, 0x8A, 0xA9, 0x24, 0xD3, 0xF1, 0x59, 0xFC, 0x25, 0xBF, 0xB4, 0x93, 0xD6, 0xB4, 0x35,
+  0x6E, 0x5E, 0xCB, 0xA1, 0x61, 0x26, 0x0F, 0x66, 0x58, 0xDA, 0xA4, 0x7F, 0xA6, 0xE2, 0x9F, 0x71,
+  0x73, 0xFF, 0x86, 0x6D, 0x29, 0xBC, 0xDC, 0xFE, 0x51, 0x92, 0x48, 0xCA, 0x9E, 0xBE, 0x7E, 0xA9,
+  0xA1, 0x04, 0x04, 0xCD, 0x08, 0xF0, 0x8A, 0x28, 0xF1, 0x63, 0x6F, 0x89, 0x4D, 0x3A, 0xB0, 0xCF,
+  0xC7, 0x22, 0xE2, 0xFA, 0xE4, 0xEA, 0xB9, 0x6F, 0x07, 0xC0, 0xC8, 0xB2, 0x75, 0x9E, 0xFD, 0x0D,
+  0x9D, 0x78, 0x68, 0x5B, 0xF9, 0xBB, 0x95, 0x37, 0x31, 0xBE, 0x52, 0x13, 0xAD, 0xF4, 0xA2, 0xA2,
+  0x61, 0x91, 0xD8, 0x2D, 0x9B, 0x15, 0x05, 0x45, 0x23, 0x3A, 0xEE, 0x12, 0xD5, 0x7A, 0x96, 0x6D,
+  0xD1, 0x20, 0x4F, 0x7F, 0x57, 0xAD, 0xD4, 0xBB, 0xD9, 0x84, 0x72, 0xDE, 0xB5, 0x26, 0xF4, 0xAE,
+  0x4D, 0x9A, 0x3E, 0x6C, 0x91, 0xB3, 0xC5, 0x67, 0xAD, 0xB7, 0x3C, 0xA2, 0x7F, 0x12, 0xAB, 0x45,
+  0xAB, 0x92, 0xA2, 0x4D, 0xE5, 0xEB, 0x01, 0xD9, 0xB2, 0x52, 0x8E, 0x5D, 0xD4, 0x96, 0x9C, 0x80,
+  0x43, 0x41, 0xE9, 0xC7, 0x9C, 0x8E, 0xF0, 0x6B, 0x3F, 0x34, 0xA0, 0x8D, 0x02, 0x8D, 0x9D, 0x8F,
+  0x80, 0xE7, 0x6E, 0xC0, 0x4E, 0x48, 0xC5, 0x20, 0x15, 0xF6, 0xA9, 0x2E, 0x48, 0x1F, 0x8B, 0x5A,
+  0xC0, 0x0E, 0x54, 0x4C, 0xDC, 0x30, 0xE5, 0x30, 0x4C, 0x4E, 0x36, 0xF8, 0x01, 0xCA, 0xE3, 0xF2,
+  0x4C, 0x6C, 0x99, 0x73, 0xD2, 0x22, 0x01, 0x0B, 0xDD, 0xAC, 0x20, 0x9A, 0xC4, 0x56, 0x93, 0x5D,
+  0x83, 0x1C, 0xAA, 0xCC, 0xBB, 0x83, 0xD1, 0xB1, 0x23, 0xF1, 0x49, 0x25, 0xB4, 0x95, 0x7D, 0xF7,
+  0x6B, 0x9B, 0x12, 0xCB, 0xBE, 0x02, 0x89, 0x0C, 0x0D, 0xBF, 0xAB, 0xBB, 0x56, 0x80, 0x3E, 0x88,
+  0xF9, 0xEC, 0x1A, 0xC7, 0xBD, 0xF9, 0x0E, 0x61, 0xC0, 0xCE, 0xCA, 0x75, 0xD9, 0x76, 0x13, 0x29,
+  0xF1, 0x9A, 0x04, 0xE4, 0x0A, 0xD0, 0x2F, 0x82, 0x34, 0x03, 0x2E, 0x9C, 0xC7, 0xE7, 0xC0, 0x84,
+  0x08, 0x0B, 0x91, 0xCA, 0xD8, 0x4D, 0x8B, 0xA1, 0xF5, 0x06, 0xCF, 0x37, 0xDA, 0xDA, 0x81, 0x36,
+  0xA7, 0x53, 0x9E, 0xA8, 0xE5, 0xDB, 0x62, 0x7D, 0xC1, 0x84, 0xD9, 0x25, 0x8C, 0x36, 0x41, 0xD4,
+  0x70, 0x37, 0x51, 0xF3, 0x28, 0xD7, 0xEE, 0x8B, 0x73, 0xE1, 0xEA, 0x36, 0xDC, 0x31, 0xF7, 0xF2,
+  0x7E, 0x61, 0x1D, 0x8E, 0x7E, 0x4F, 0xDF, 0xB4, 0xA6, 0xEC, 0xC4, 0xD8, 0x82, 0x27, 0x48, 0xF1,
+  0xC5, 0x74, 0x45, 0x8F, 0x1B, 0xB1, 0x3E, 0x50, 0xC8, 0xF8, 0x51, 0x10, 0xD0, 0xCF, 0xE3, 0x0C,
+  0x76, 0xC2, 0x07, 0x0D, 0xDA, 0xED, 0x0C, 0x52, 0xA5, 0x61, 0x80, 0x8A, 0x7C, 0x75, 0xB6, 0x64,
+  0xE8, 0x2C, 0xC4, 0x08, 0x74, 0xD2, 0x4F, 0xAB, 0x31, 0xE9, 0x28, 0xF6, 0x31, 0x18, 0x9A, 0xF1,
+  0x30, 0xA5, 0x58, 0xE7, 0x62, 0x39, 0x0E, 0x03, 0x3C, 0xC0, 0xB6, 0xB7, 0x41, 0x00, 0x9C, 0x4A,
+  0x6E, 0x83, 0xE2, 0x20, 0x65, 0x60, 0x79, 0x2F, 0x80, 0xD2, 0xB1, 0x23, 0x67, 0xDB, 0xEE, 0x22,
+  0xC8, 0x4F, 0x9E, 0x9B, 0x44, 0x82, 0xB8, 0xC3, 0x7E, 0xDE, 0x45, 0x2D, 0x56, 0x30, 0xC7, 0xF1,
+  0xAB, 0xA7, 0x7F, 0x38, 0x7E, 0xF6, 0xEC, 0xF8, 0xE8, 0xEC, 0x14, 0x6A, 0xBE, 0xB5, 0x44, 0xF2,
+  0x98, 0xD5, 0x62, 0x16, 0x1D, 0x56, 0xE1, 0x03, 0xA6, 0x75, 0xE1, 0xBF, 0x32, 0x43, 0xCB, 0x7A,
+  0x27, 0xB8, 0x04, 0x39, 0x7D, 0x19, 0x92, 0xF9, 0x2B, 0x8E, 0x93, 0x39, 0x7E, 0x96, 0x82, 0x53,
+  0x2C, 0xCF, 0xA2, 0xD8, 0x70, 0x44, 0x9F, 0x9A, 0x88, 0xDC, 0x6D, 0x31, 0x0D, 0xF0, 0x13, 0x72,
+  0x49, 0x97, 0xCB, 0x5B, 0x60, 0x52, 0x90, 0x6E, 0x1D, 0xB2, 0x16, 0x00, 0xBF, 0x0E, 0xE1, 0x5B,
+  0x4A, 0x9E, 0xD0, 0x9D, 0xE6, 0x1D, 0xF4, 0x76, 0xC4, 0xBC, 0x56, 0xD7, 0x2A, 0x9A, 0xFA, 0x92,
+  0xDD, 0x7D, 0x12, 0x3B, 0xA2, 0x55, 0x07, 0x7C, 0xED, 0x20, 0xB3, 0xAD, 0x36, 0x14, 0xCC, 0xDD,
+  0x85, 0xFD, 0x8A, 0xDC, 0x14, 0x0D, 0x3E, 0xD2, 0x84, 0x2D, 0xA4, 0xE3, 0x3C, 0xEF, 0xC5, 0x7E,
+  0xFA, 0x89, 0x59, 0x8E, 0x33, 0xA4, 0xFF, 0xA0, 0x50, 0x02, 0x19, 0x56, 0x81, 0x28, 0xB5, 0x43,
+  0xF4, 0x41, 0x02, 0x76, 0x58, 0xC8, 0x5A, 0x05, 0xAE, 0x45, 0xB5, 0x57, 0x40, 0xD7, 0x43, 0xE6,
+  0x7F, 0xEB, 0xBC, 0x6B, 0xC1, 0xA6, 0x47, 0xE0, 0xBA, 0xC0, 0x4B, 0x17, 0x5E, 0x7C, 0xF7, 0x0A,
+  0x1F, 0x7B, 0xEF, 0x44, 0xBB, 0x19, 0x38, 0x0B, 0x43, 0x96, 0x41, 0x3B, 0x9C, 0x86, 0xD3, 0x42,
+  0xCB, 0x10, 0xCC, 0x38, 0x2C, 0xEA, 0xAA, 0x22, 0x71, 0x62, 0x89, 0x45, 0x3D, 0x59, 0x44, 0x5D,
+  0xF3, 0x74, 0xE8, 0x21, 0xE2, 0xD9, 0xB6, 0xF2, 0x77, 0xAB, 0x29, 0x1A, 0x88, 0x2C, 0x23, 0x59,
+  0x2B, 0x5E, 0xA0, 0x4A, 0x14, 0x9F, 0xE8, 0xC5, 0x27, 0x79, 0xF1, 0x13, 0xBD, 0xF8, 0x89, 0x02,
+  0x94, 0xE7, 0xF8, 0xC8, 0xDA, 0xFC, 0x1D, 0xFB, 0xE5, 0x69, 0x3B, 0xA5, 0xCA, 0x13, 0xBD, 0xF2,
+  0x49, 0xA9, 0x52, 0x07, 0x2D, 0xD2, 0x1F, 0x87, 0x3A, 0xCD, 0x76, 0xE8, 0x3A, 0x90, 0xD7, 0x13,
+  0xDA, 0xAB, 0xBC, 0x89, 0xC2, 0xB0, 0xEC, 0xAA, 0x9F, 0xCC, 0x0F, 0x89, 0x74, 0x6C, 0x4B, 0x2F,
+  0xB3, 0xF4, 0x76, 0x2A, 0xD4, 0xFE, 0x32, 0x95, 0x33, 0x31, 0x4A, 0x8D, 0xA6, 0xE2, 0x24, 0x57,
+  0x6F, 0x26, 0x4A, 0x54, 0x23, 0xF3, 0x70, 0x53, 0x8D, 0x6C, 0x96, 0x96, 0xDA, 0x56, 0x46, 0x2F,
+  0x95, 0x97, 0x9A, 0x9F, 0xB8, 0x0B, 0xB3, 0x1D, 0x14, 0x94, 0x9A, 0xA0, 0x13, 0x66, 0xB6, 0xC1,
+  0x92, 0x52, 0x23, 0xF3, 0x94, 0xA1, 0x3C, 0xB8, 0x59, 0x5B, 0xEA, 0x5A, 0x0A, 0xD6, 0x97, 0xFB,
+  0x96, 0xAA, 0x57, 0x77, 0xA6, 0x78, 0xF7, 0x9A, 0xDE, 0x54, 0x5F, 0xEA, 0xAE, 0x07, 0x8C, 0xCB,
+  0x5D, 0xF5, 0xBA, 0xFA, 0x6E, 0x45, 0xD8, 0xB5, 0xB4, 0x35, 0x95, 0xFA, 0xFA, 0xFE, 0x32, 0xE6,
+  0x78, 0xCA, 0xBD, 0xDA, 0x91, 0x65, 0x75, 0xA9, 0xAF, 0x1E, 0x70, 0x2B, 0x0D, 0xAB, 0x57, 0xD5,
+  0xF5, 0x22, 0x13, 0x78, 0xD5, 0x1E, 0x15, 0x2D, 0xEA, 0x07, 0xF4, 0xD7, 0x76, 0x84, 0xFA, 0xBA,
+  0x6E, 0x2A, 0x12, 0x53, 0xDB, 0x47, 0x55, 0xE6, 0x2C, 0x91, 0x3B, 0x78, 0x8A, 0x23, 0x4A, 0x9E,
+  0xA0, 0xD5, 0x44, 0x45, 0xB9, 0x2F, 0xF5, 0xDD, 0x31, 0x7A, 0x5C, 0xF2, 0xCC, 0x8F, 0xBC, 0x23,
+  0xD2, 0x1F, 0x22, 0x83, 0x52, 0xA8, 0x47, 0x54, 0x25, 0x43, 0xCC, 0x58, 0x92, 0xBA, 0x10, 0x26,
+  0x1F, 0xA0, 0x39, 0x06, 0x5A, 0x31, 0xA6, 0xF0, 0x0A, 0x82, 0xA1, 0xD4, 0x6F, 0xFA, 0x8E, 0x82,
+  0xF9, 0xD6, 0x32, 0x62, 0x78, 0xDF, 0x42, 0x0B, 0x83, 0x2A, 0xE0, 0xDE, 0xE0, 0x71, 0x8D, 0x50,
+  0x4D, 0x2E, 0x03, 0xE5, 0x05, 0xAE, 0x61, 0xA1, 0x89, 0x2A, 0xBA, 0x5C, 0x53, 0x46, 0xD2, 0xAC,
+  0x35, 0x95, 0x55, 0xA1, 0x1B, 0x16, 0x74, 0x73, 0xC2, 0x88, 0x5D, 0xDF, 0x60, 0x19, 0xB4, 0x62,
+  0xB6, 0xA8, 0x78, 0xCF, 0x02, 0xA1, 0xE2, 0x94, 0xC9, 0x20, 0x8A, 0xCF, 0x25, 0xAC, 0x6F, 0xDF,
+  0xBF, 0x2B, 0x4C, 0x0C, 0xB4, 0xAF, 0xE2, 0x09, 0xD6, 0xA1, 0xBE, 0x12, 0x61, 0x32, 0x8B, 0xFD,
+  0xF6, 0xB7, 0x60, 0x2F, 0xBE, 0x72, 0x5F, 0xD9, 0xE7, 0xCD, 0x26, 0x5D, 0x24, 0x05, 0x32, 0x9E,
+  0x6B, 0x76, 0x89, 0xA9, 0xC9, 0x41, 0xC2, 0x1B, 0x05, 0x30, 0x00, 0xBB, 0x07, 0xE0, 0x4A, 0xC0,
+  0xC7, 0x71, 0x0C, 0xC6, 0x53, 0x64, 0xB1, 0x2F, 0xD8, 0x83, 0x73, 0xC0, 0x28, 0xC2, 0xA6, 0x35,
+  0x60, 0xFB, 0x11, 0x3B, 0x27, 0xFB, 0x4C, 0xDA, 0x5D, 0xAF, 0xC7, 0xDF, 0x83, 0xFC, 0xEC, 0xBC,
+  0xE7, 0x57, 0xA9, 0x4D, 0x6D, 0x9A, 0x1D, 0xF1, 0xB5, 0x19, 0x81, 0x72, 0xD4, 0xC2, 0xEA, 0x8D,
+  0x56, 0xEB, 0xCF, 0xFF, 0xF4, 0xF7, 0x98, 0x11, 0xF2, 0xFD, 0xED, 0x9F, 0x30, 0xEA, 0x85, 0x27,
+  0xB1, 0x68, 0x37, 0xC8, 0xCB, 0x94, 0x2C, 0x69, 0x2E, 0x09, 0xDD, 0x98, 0x0F, 0x6A, 0x9A, 0xC7,
+  0x59, 0x22, 0xD6, 0xBB, 0x62, 0x80, 0xF2, 0x57, 0xBF, 0xE0, 0x74, 0x7B, 0x78, 0xDE, 0xDB, 0xE9,
+  0x74, 0x70, 0x24, 0x61, 0x24, 0xD3, 0xAE, 0x70, 0x98, 0xBB, 0x6D, 0x19, 0x66, 0x08, 0xB4, 0x10,
+  0xB3, 0x17, 0xD9, 0x78, 0x43, 0x66, 0x61, 0x3A, 0x9E, 0x25, 0xD5, 0x2B, 0x07, 0x2B, 0x27, 0x01,
+  0xD2, 0xBD, 0x66, 0x96, 0x34, 0xA5, 0xDB, 0x67, 0x80, 0x46, 0x0B, 0x9A, 0x11, 0x85, 0x09, 0x63,
+  0x6D, 0xFB, 0x7B, 0xA0, 0x22, 0x0B, 0xCC, 0x3D, 0x41, 0xF2, 0xB1, 0x0F, 0x3A, 0xFA, 0xAF, 0x4F,
+  0x5F, 0xBF, 0xEA, 0xA4, 0xE4, 0xAD, 0x06, 0x93, 0x2B, 0x89, 0x36, 0x5C, 0x1E, 0xFE, 0xD5, 0xC9,
+  0x66, 0x3C, 0xB2, 0x13, 0x34, 0x53, 0x92, 0x0E, 0x76, 0xB6, 0x9B, 0x5A, 0x31, 0x90, 0x7C, 0x6E,
+  0x94, 0xD6, 0x3B, 0x0A, 0x6A, 0xEB, 0xA1, 0x69, 0x07, 0x6D, 0xB3, 0x65, 0x4A, 0x5B, 0x6C, 0xBD,
+  0xFE, 0x1B, 0xAB, 0x30, 0x4C, 0x57, 0x6D, 0xC7, 0x3F, 0xFF, 0x23, 0x7B, 0x8B, 0x6C, 0x70, 0xFB,
+  0x01, 0xB6, 0xDD, 0x62, 0x0F, 0x18, 0x42, 0x99, 0xA7, 0x53, 0x40, 0x15, 0xDD, 0x57, 0xA5, 0xB6,
+  0x44, 0xDF, 0x14, 0xB1, 0x2D, 0x62, 0x50, 0x83, 0xBA, 0x8A, 0xE1, 0xCA, 0x24, 0x2F, 0x56, 0x5C,
+  0xA5, 0xC5, 0x11, 0x93, 0x84, 0x58, 0x50, 0x5B, 0x99, 0x1E, 0xF3, 0x9A, 0x61, 0xDE, 0x48, 0x9F,
+  0xC4, 0x1A, 0x3A, 0xCB, 0xA9, 0x80, 0x62, 0x56, 0xB9, 0x4F, 0x86, 0xA2, 0xA4, 0x42, 0x74, 0x62,
+  0x27, 0x3C, 0x1C, 0xC0, 0xF0, 0x03, 0xD6, 0xE0, 0xED, 0x38, 0x49, 0x28, 0xFD, 0x9F, 0x6B, 0xBE,
+  0x9F, 0x55, 0xC6, 0xDB, 0xAA, 0x2D, 0xBB, 0x69, 0x2A, 0x29, 0x87, 0x0B, 0x3E, 0x42, 0xBF, 0x88,
+  0x8B, 0x74, 0xF0, 0xE9, 0xED, 0x87, 0x84, 0xD2, 0x30, 0xC1, 0x6A, 0x8F, 0x97, 0xC2, 0x62, 0xF7,
+  0xF4, 0x48, 0x08, 0xB6, 0x65, 0x45, 0x4E, 0x7F, 0x21, 0x95, 0x92, 0xA5, 0x87, 0x93, 0xA3, 0x2C,
+  0xFC, 0xE7, 0x7E, 0x4B, 0xDE, 0xC5, 0x82, 0x4F, 0x32, 0x47, 0x1E, 0x1F, 0xE3, 0x48, 0x24, 0xE4,
+  0xCF, 0x30, 0xBC, 0xA8, 0x36, 0x2C, 0x9B, 0x05, 0x69, 0x47, 0xDC, 0x35, 0x49, 0x96, 0xB0, 0x04,
+  0x21, 0xD7, 0x40, 0xB5, 0xF2, 0x6A, 0x41, 0xAA, 0x56, 0x80, 0xF5, 0xFA, 0x85, 0x1E, 0x31, 0xC8,
+  0xC7, 0xD3, 0x5B, 0x18, 0x23, 0x43, 0x3B, 0xE3, 0x5D, 0x6B, 0x17, 0xA4, 0x4F, 0x13, 0x77, 0x3A,
+  0xAD, 0xD0, 0xB8, 0x9A, 0x46, 0x02, 0xFB, 0x47, 0x3D, 0xD1, 0xE9, 0x95, 0xD7, 0xF4, 0x59, 0xA2,
+  0x49, 0xD1, 0x0E, 0x38, 0x7A, 0xB9, 0x38, 0xA6, 0xBB, 0x20, 0x6C, 0x7D, 0x12, 0x50, 0x4E, 0x7D,
+  0xED, 0xBC, 0x67, 0x53, 0xC9, 0x19, 0xE1, 0xC8, 0x16, 0xBD, 0x2A, 0xB8, 0xE9, 0xB8, 0xBE, 0x4F,
+  0x95, 0xE8, 0xC1, 0x62, 0xD4, 0x0C, 0xB4, 0x5D, 0x0C, 0x1A, 0x04, 0xE3, 0x79, 0xB0, 0xF1, 0x36,
+  0x27, 0xBA, 0x11, 0xC3, 0xA0, 0x9A, 0xC5, 0x65, 0x40, 0xA1, 0x3E, 0xFC, 0x2A, 0x38, 0xA0, 0xAE,
+  0xBC, 0x99, 0x30, 0x06, 0xEE, 0x04, 0x94, 0x87, 0x79, 0x56, 0x4C, 0x07, 0x1D, 0xEB, 0x12, 0x14,
+  0x7F, 0x53, 0x00, 0x34, 0x8F, 0xBF, 0x04, 0x00, 0xCD, 0x60, 0xB9, 0xC0, 0xEE, 0xFA, 0x22, 0xE2,
+  0x05, 0xAD, 0x61, 0xD3, 0x19, 0x80, 0x99, 0xBE, 0x16, 0x82, 0xDA, 0x2E, 0x0D, 0x39, 0xFA, 0x6E,
+  0x19, 0x14, 0xA4, 0xF4, 0x85, 0xAC, 0x5B, 0x2E, 0xD0, 0xCB, 0x13, 0x34, 0xC0, 0xE5, 0x74, 0x38,
+  0x51, 0x2F, 0x4C, 0xE3, 0x29, 0x9F, 0xB8, 0xCB, 0x30, 0xB3, 0xF5, 0x41, 0x7C, 0x03, 0x3E, 0xE9,
+  0xD8, 0xD2, 0x20, 0x4D, 0x43, 0x36, 0x7E, 0xDA, 0x28, 0xC5, 0x02, 0x57, 0x2E, 0xA4, 0x90, 0x1D,
+  0xA2, 0x8B, 0x39, 0x86, 0x61, 0x4F, 0xE0, 0x85, 0xC7, 0xB8, 0xF4, 0x82, 0xE4, 0xA6, 0x3C, 0x43,
+  0x4B, 0x19, 0x2F, 0x5F, 0x39, 0x0A, 0xF1, 0xE6, 0xB4, 0xB7, 0xD0, 0x44, 0x71, 0x86, 0xE8, 0x24,
+  0x2E, 0x09, 0xF9, 0x3D, 0xF4, 0xC3, 0xEE, 0x1D, 0x3A, 0x24, 0x63, 0xDB, 0xAC, 0x57, 0x6D, 0xF3,
+  0x8D, 0x6A, 0x23, 0xAE, 0x8D, 0x28, 0x1A, 0xD1, 0x5F, 0x18, 0x4F, 0xB8, 0x6C, 0xB1, 0xAB, 0x42,
+  0x33, 0xF1, 0x8E, 0xD8, 0x55, 0x4D, 0x41, 0x50, 0x2C, 0x4E, 0x15, 0x83, 0xC7, 0xDA, 0xF1, 0x68,
+  0x56, 0xBF, 0x67, 0x6D, 0x01, 0x19, 0x0F, 0xE4, 0xE0, 0x59, 0xCE, 0x49, 0xE9, 0xA0, 0xAB, 0xFA,
+  0x5E, 0xDF, 0xA8, 0x5E, 0x80, 0xC4, 0xBC, 0xD3, 0x37, 0x52, 0x4B, 0x80, 0x3C, 0x02, 0xD1, 0x6A,
+  0x8E, 0xFB, 0x11, 0x83, 0x6D, 0x30, 0x42, 0xB1, 0x74, 0x19, 0x4D, 0x8C, 0xA6, 0x21, 0x0A, 0xB8,
+  0x97, 0x6E, 0x36, 0xEB, 0xB8, 0x99, 0x1B, 0xF5, 0xEC, 0xAB, 0x16, 0xBB, 0x6C, 0xB2, 0xCF, 0xF1,
+  0xFE, 0x5C, 0xC0, 0x16, 0x55, 0xBC, 0x79, 0xAE, 0x23, 0xD6, 0x07, 0x06, 0xC0, 0x6C, 0x7F, 0xD5,
+  0x0D, 0x5C, 0x77, 0x9B, 0x1E, 0xD2, 0x1F, 0x92, 0xCC, 0xBE, 0xFC, 0xFC, 0x12, 0x54, 0xF3, 0xD5,
+  0xE7, 0x57, 0xE8, 0x5B, 0xCB, 0x6D, 0x6A, 0xAB, 0x70, 0x87, 0x1C, 0x1B, 0x54, 0x09, 0x58, 0x25,
+  0xF4, 0x21, 0x02, 0x9D, 0x5F, 0xD0, 0x24, 0x84, 0xF5, 0x43, 0xBA, 0xE3, 0xCB, 0xD3, 0xAF, 0xF3,
+  0xED, 0x99, 0x61, 0x14, 0x84, 0xD9, 0xA2, 0xCD, 0x03, 0xBC, 0xA5, 0xB7, 0xC9, 0x7E, 0x83, 0xFF,
+  0xE8, 0x53, 0x4A, 0xC1, 0x94, 0x90, 0x39, 0x0A, 0xDA, 0xA4, 0xF2, 0x89, 0x6E, 0x83, 0x82, 0xD7,
+  0xA7, 0xD2, 0x62, 0x5D, 0x5A, 0xA1, 0x63, 0x00, 0x91, 0x11, 0x97, 0xA2, 0xB8, 0x3A, 0x57, 0x98,
+  0x18, 0xCE, 0xF3, 0xED, 0xC9, 0x13, 0x9D, 0x82, 0xA7, 0x63, 0x45, 0xC0, 0xB3, 0xF4, 0x5C, 0x06,
+  0xF0, 0x31, 0xC6, 0x53, 0xCC, 0xAA, 0x25, 0x80, 0x9B, 0x34, 0x2C, 0xF5, 0xC2, 0x77, 0xD0, 0xDF,
+  0xFE, 0xEC, 0x1A, 0xFE, 0xEE, 0x24, 0x37, 0x2D, 0x26, 0x9E, 0xA6, 0xF9, 0xD3, 0xF8, 0xA6, 0xF9,
+  0x9D, 0xDE, 0x4D, 0x9C, 0x2B, 0xD0, 0x68, 0x45, 0x8C, 0x1E, 0xFB, 0xD2, 0xBD, 0xBE, 0x9D, 0xA9,
+  0xF8, 0x67, 0xDC, 0x2C, 0x6B, 0x99, 0x92, 0x36, 0x02, 0x30, 0x75, 0xAA, 0x06, 0x8A, 0x4B, 0x1B,
+  0xF5, 0x46, 0xDE, 0xBF, 0x44, 0x17, 0x3D, 0x80, 0x32, 0x85, 0xFD, 0xD1, 0x17, 0x41, 0xEA, 0x15,
+  0x19, 0x51, 0x21, 0xF8, 0x81, 0xC0, 0xBF, 0x17, 0xA7, 0x72, 0xCF, 0x3E, 0x57, 0x34, 0x04, 0xDB,
+  0x00, 0x34, 0x85, 0x88, 0x57, 0x1B, 0xB3, 0x5F, 0x81, 0xF4, 0x4D, 0x0E, 0xE9, 0x1B, 0x05, 0x29,
+  0x85, 0x9D, 0xDC, 0x10, 0x92, 0xA6, 0xFD, 0x3B, 0x74, 0x06, 0x24, 0xD8, 0x65, 0x94, 0x4F, 0xF3,
+  0x01, 0xB3, 0x16, 0x97, 0xD6, 0xAA, 0xC6, 0xC8, 0x30, 0xA3, 0x7C, 0x22, 0x7A, 0xDB, 0xC2, 0xD1,
+  0xA9, 0x58, 0x07, 0x85, 0x9C, 0xA8, 0xD6, 0x21, 0x3A, 0x69, 0x3F, 0xF4, 0xD8, 0x6A, 0xAE, 0xBE,
+  0x0B, 0x8C, 0xEB, 0x72, 0x74, 0xED, 0x3E, 0x49, 0x63, 0x45, 0xCE, 0xB7, 0xB8, 0xC8, 0x6A, 0x93,
+  0xD6, 0x30, 0xE2, 0x9B, 0x24, 0x06, 0x4F, 0x31, 0xBB, 0xB2, 0xAD, 0xD2, 0x15, 0xC2, 0xA0, 0xC1,
+  0xD4, 0xCE, 0xCB, 0xF9, 0x15, 0x94, 0x0C, 0x74, 0x0C, 0xE4, 0xAB, 0xE6, 0x08, 0x62, 0x76, 0x54,
+  0x70, 0x5F, 0x8A, 0x6F, 0x39, 0xBF, 0x9C, 0x1B, 0x6F, 0xFA, 0xDE, 0xA2, 0x63, 0x06, 0xBB, 0x95,
+  0xEA, 0x1B, 0x8E, 0x64, 0xEC, 0x41, 0xA1, 0xDD, 0x05, 0xA6, 0x14, 0xF2, 0x67, 0x9C, 0xDA, 0xB6,
+  0x3D, 0x83, 0xB2, 0x5D, 0xE4, 0xF1, 0x5E, 0x13, 0xB9, 0xB5, 0x69, 0x30, 0xCD, 0x9C, 0x20, 0x81,
+  0x54, 0x2B, 0x09, 0x71, 0xA0, 0x7E, 0xA0, 0xFC, 0x71, 0x21, 0xC7, 0x67, 0xEC, 0x80, 0x75, 0xB7,
+  0x01, 0xCE, 0x35, 0x43, 0xC4, 0x78, 0xFB, 0x0C, 0xF5, 0x12, 0xDE, 0xE1, 0x05, 0xFF, 0xD0, 0x65,
+  0xBB, 0xA4, 0xE7, 0x50, 0xDE, 0xAA, 0xE6, 0xBD, 0xA2, 0xF9, 0xA5, 0x68, 0xEE, 0xAD, 0x6B, 0xDE,
+  0x2F, 0x9A, 0x3B, 0x46, 0xF3, 0xCB, 0xDA, 0xE6, 0x3B, 0x95, 0xE6, 0x72, 0x32, 0x5E, 0x6D, 0xF3,
+  0x41, 0x65, 0x32, 0x4E, 0x5D, 0x73, 0x63, 0x75, 0x4E, 0x69, 0x7C, 0xCD, 0x41, 0xCD, 0x89, 0x34,
+  0x19, 0x0A, 0x5C, 0x13, 0xD9, 0xD8, 0xE0, 0xCA, 0x3D, 0x60, 0x73, 0x64, 0x24, 0x3C, 0xE6, 0x6F,
+  0xC9, 0x36, 0x53, 0xB3, 0xCD, 0xB4, 0xAE, 0xCD, 0xD8, 0x6C, 0x33, 0xD6, 0xDB, 0x08, 0x5A, 0xD7,
+  0x88, 0x49, 0x3B, 0x4C, 0xA4, 0x6D, 0x52, 0xC4, 0x24, 0xE7, 0xF6, 0xDD, 0xFD, 0xCF, 0xAE, 0x6D,
+  0x20, 0x83, 0x03, 0xD8, 0x83, 0x9D, 0x26, 0x40, 0x82, 0x69, 0xC1, 0x73, 0x77, 0x97, 0x9E, 0xA7,
+  0xF8, 0xBC, 0x87, 0x8F, 0xE3, 0xA6, 0x79, 0x90, 0x9A, 0xE2, 0x8D, 0x1A, 0x76, 0xB7, 0x29, 0x4E,
+  0x76, 0x6E, 0x34, 0x27, 0xE5, 0x31, 0x90, 0xF9, 0xED, 0xFF, 0x58, 0xB2, 0x49, 0xE0, 0xDF, 0xFE,
+  0x0C, 0x92, 0x63, 0x88, 0x97, 0x9D, 0xCD, 0x39, 0x13, 0x27, 0xE5, 0xB7, 0x1F, 0x30, 0x17, 0x20,
+  0xD1, 0x82, 0x31, 0xF6, 0xF6, 0x04, 0xEB, 0x9B, 0xE4, 0xB5, 0x00, 0x8C, 0x33, 0x6A, 0x0D, 0x62,
+  0x7E, 0xB0, 0x3B, 0x00, 0xCA, 0xF3, 0x55, 0x8F, 0x45, 0xE8, 0x4E, 0xF1, 0x13, 0x9A, 0x34, 0xF1,
+  0xB6, 0x9F, 0x61, 0x9B, 0xD3, 0xC8, 0x5D, 0x80, 0xDF, 0x05, 0xE6, 0x05, 0x45, 0x7D, 0xC1, 0x01,
+  0x0A, 0x33, 0x57, 0x1C, 0xB3, 0x21, 0x9C, 0xE2, 0x8C, 0x44, 0x8C, 0x9F, 0x70, 0x98, 0x15, 0x67,
+  0xFB, 0x6C, 0x19, 0x71, 0xBA, 0x02, 0xE5, 0xF6, 0x5F, 0xC4, 0x55, 0x52, 0xA1, 0x4B, 0x99, 0xE2,
+  0x2D, 0xF6, 0xEC, 0xED, 0xE3, 0x97, 0xC7, 0x7F, 0x78, 0xFE, 0xEA, 0xEC, 0xF8, 0xED, 0xD7, 0x8F,
+  0x5F, 0xFC, 0xE1, 0xE5, 0xA9, 0xC8, 0xC6, 0x11, 0xC0, 0x96, 0x97, 0xF0, 0xD7, 0xDC, 0xC5, 0xCF,
+  0x78, 0x3A, 0xEA, 0xC8, 0x39, 0xC5, 0x53, 0x15, 0xF4, 0xC0, 0x7E, 0x58, 0x5A, 0x78, 0xEE, 0x7F,
+  0x45, 0x79, 0x02, 0xEE, 0x52, 0x65, 0x3B, 0x60, 0x3A, 0xFD, 0x7C, 0xEE, 0x52, 0x3E, 0x4E, 0x12,
+  0xA4, 0xCD, 0x8E, 0x3C, 0x2A, 0xA9, 0x0E, 0x24, 0x79, 0x57, 0x46, 0x8D, 0x70, 0xBE, 0x47, 0x19,
+  0x32, 0x69, 0x7E, 0xF0, 0x8A, 0x96, 0x19, 0x45, 0x13, 0x2E, 0x33, 0xDB, 0xEA, 0xF9, 0xE8, 0x8E,
+  0x20, 0xEF, 0x51, 0xD3, 0xE7, 0x78, 0x2D, 0xA9, 0x71, 0x54, 0x48, 0xC5, 0xA7, 0xFC, 0x07, 0x41,
+  0x98, 0x30, 0x7F, 0x07, 0xB6, 0xC1, 0x5D, 0x7A, 0xB8, 0x74, 0xC2, 0x46, 0x4B, 0xDB, 0x00, 0x71,
+  0xE8, 0xE3, 0x13, 0x5E, 0xE8, 0x86, 0x53, 0x91, 0x3F, 0x74, 0xFB, 0x73, 0xC6, 0xB5, 0x13, 0x36,
+  0x9F, 0xC3, 0x5E, 0x70, 0x42, 0xBC, 0x3D, 0x5E, 0x4E, 0xF4, 0x28, 0x17, 0x86, 0xA5, 0x22, 0xF0,
+  0xE9, 0x9E, 0x82, 0x11, 0xF3, 0x35, 0xC8, 0x35, 0xAA, 0xDF, 0x97, 0x71, 0x20, 0x78, 0xEE, 0x8C,
+  0xAF, 0x32, 0xFE, 0x42, 0x04, 0x7F, 0x80, 0xB4, 0x76, 0x30, 0xDC, 0x74, 0x8E, 0x0B, 0xFA, 0x2A,
+  0x88, 0xB2, 0x3D, 0x1B, 0x94, 0x09, 0x06, 0x22, 0x1E, 0x3A, 0xCA, 0x40, 0x96, 0x26, 0x2C, 0xCE,
+  0xDB, 0x7A, 0x66, 0xE5, 0xC3, 0xBC, 0x0F, 0x22, 0x3C, 0x81, 0xD1, 0x7A, 0x76, 0x61, 0xE3, 0x2F,
+  0xF4, 0xA2, 0xEE, 0xAE, 0xDD, 0x6B, 0x91, 0x29, 0x0F, 0x35, 0xB3, 0x52, 0xCD, 0x8E, 0xAC, 0x29,
+  0xE2, 0x6F, 0x29, 0x61, 0x28, 0x6F, 0xD3, 0xEF, 0xD9, 0xBB, 0x79, 0xEF, 0xB1, 0x9B, 0xF2, 0x52,
+  0x65, 0xD7, 0xD1, 0x20, 0xE0, 0xDA, 0xC4, 0x8C, 0x60, 0xEE, 0xBD, 0x7C, 0xEA, 0xE4, 0x46, 0xE0,
+  0xCC, 0x05, 0xD1, 0xF9, 0x46, 0x0C, 0x4B, 0x76, 0xBB, 0xA7, 0xED, 0x1A, 0xA0, 0xA2, 0x78, 0x93,
+  0xC6, 0x34, 0x62, 0xE3, 0xA2, 0x54, 0x23, 0x4D, 0x68, 0xAC, 0x9A, 0xE9, 0x4E, 0x06, 0x4D, 0xE1,
+  0x9E, 0x88, 0xA8, 0x19, 0xD8, 0x93, 0xE2, 0x59, 0x91, 0x8F, 0x80, 0x0C, 0x70, 0xF7, 0xB5, 0x42,
+  0x09, 0x14, 0x40, 0x8A, 0xE6, 0x06, 0x35, 0x29, 0x2A, 0xEC, 0x78, 0x09, 0x07, 0x07, 0x82, 0x8A,
+  0x71, 0x87, 0xED, 0x0B, 0x40, 0x6D, 0x53, 0x0F, 0xF5, 0xE5, 0x68, 0xE8, 0x62, 0xD8, 0x91, 0x10,
+  0x87, 0x33, 0x52, 0x44, 0x58, 0x9D, 0x98, 0x8C, 0x7E, 0x5E, 0xAA, 0x51, 0xC4, 0x12, 0xF1, 0xE2,
+  0xB0, 0x16, 0x66, 0x6D, 0xC0, 0xE2, 0x3F, 0x17, 0x53, 0x42, 0x5A, 0x46, 0xBB, 0x00, 0x10, 0x8F,
+  0xD9, 0x45, 0xDD, 0x1D, 0xAD, 0x37, 0x9D, 0xB6, 0x7A, 0x5A, 0xD4, 0x0B, 0x66, 0xB2, 0x60, 0x87,
+  0x40, 0x8A, 0xA6, 0xA3, 0x25, 0x9A, 0xE3, 0x46, 0xEF, 0x00, 0xD8, 0xC5, 0x83, 0x07, 0xA2, 0x78,
+  0x71, 0xF9, 0xED, 0x0F, 0x18, 0x58, 0xB2, 0x3D, 0x76, 0x78, 0xC8, 0xF6, 0xD8, 0x6F, 0x99, 0x73,
+  0xF9, 0x0C, 0x44, 0xDD, 0x4F, 0x8C, 0x0A, 0xBA, 0xFD, 0xA2, 0x19, 0x88, 0xBF, 0x6E, 0xD1, 0xB4,
+  0x2F, 0x9A, 0x1E, 0x61, 0x53, 0x51, 0xF2, 0x08, 0x4A, 0xFA, 0x4D, 0xA3, 0x7D, 0x4F, 0xB6, 0x07,
+  0xF1, 0xD9, 0xD7, 0x40, 0x8B, 0xF6, 0x3D, 0x28, 0x79, 0x68, 0xB6, 0xEF, 0x63, 0x7B, 0x90, 0xDF,
+  0xFB, 0x5B, 0x52, 0x7A, 0x5F, 0xCC, 0x02, 0x94, 0x8D, 0x0B, 0x60, 0x98, 0x08, 0xB1, 0x1A, 0xC3,
+  0x83, 0xC9, 0x4A, 0xA6, 0x2B, 0x97, 0x99, 0x9C, 0x11, 0x3F, 0x78, 0xD0, 0xD4, 0x42, 0xC4, 0xD0,
+  0xD9, 0xB9, 0xDC, 0xC1, 0xA0, 0x2B, 0xA0, 0xF3, 0x01, 0x98, 0xB0, 0xB8, 0x24, 0xBC, 0x4D, 0xB1,
+  0xFE, 0x0F, 0x90, 0x2F, 0x7D, 0x83, 0x92, 0xB2, 0x20, 0xF2, 0xD0, 0x9A, 0xBA, 0xFD, 0x90, 0x9A,
+  0x6A, 0x52, 0x40, 0xDC, 0x23, 0x88, 0x77, 0xFC, 0x41, 0x60, 0x21, 0x5D, 0xC0, 0x62, 0xA1, 0x84,
+  0x91, 0x7E, 0x86, 0x54, 0x65, 0x9A, 0x8D, 0xA2, 0x71, 0x6A, 0xAC, 0xF8, 0x0C, 0x96, 0x0D, 0xB3,
+  0xED, 0xED, 0xEB, 0xE1, 0x42, 0xA4, 0x89, 0xF7, 0x42, 0xB0, 0xBD, 0x67, 0x07, 0x18, 0xA3, 0x26,
+  0x04, 0xF7, 0x9F, 0x41, 0xF3, 0xF7, 0xB0, 0x6C, 0xA4, 0x0C, 0xDB, 0x6B, 0x9A, 0x6E, 0x1D, 0xFB,
+  0x88, 0x3F, 0x30, 0x61, 0x4F, 0xC9, 0xF7, 0x30, 0xC8, 0x32, 0x4C, 0xC1, 0x06, 0x21, 0xBF, 0xC1,
+  0x1C, 0x1E, 0xCA, 0x39, 0xB4, 0xE4, 0xBC, 0xC5, 0x5C, 0xEA, 0x56, 0x56, 0x32, 0x4A, 0x73, 0x5E,
+  0x83, 0xF6, 0x05, 0xA3, 0x15, 0xBC, 0xD1, 0x42, 0x0E, 0x10, 0x6E, 0x9C, 0x26, 0xDA, 0x41, 0x7C,
+  0x69, 0x47, 0xC4, 0x22, 0x80, 0xA1, 0x27, 0x45, 0x2C, 0xE2, 0x30, 0x14, 0x02, 0x5B, 0x97, 0xD6,
+  0x22, 0x93, 0x7E, 0x44, 0x77, 0x9D, 0x75, 0xA2, 0xF8, 0xC2, 0x36, 0xC2, 0xDC, 0x04, 0xFE, 0x0B,
+  0xB0, 0xFB, 0x3D, 0x3E, 0xC2, 0x38, 0xAF, 0x1A, 0xAE, 0x85, 0x57, 0xE0, 0xBA, 0xE0, 0x4F, 0x0F,
+  0x99, 0x15, 0xC5, 0xED, 0x34, 0x8B, 0x13, 0x6E, 0x89, 0x70, 0x68, 0x29, 0x34, 0x1D, 0xBF, 0x67,
+  0x5F, 0xC0, 0x3F, 0x6E, 0x92, 0xB8, 0x57, 0x4F, 0x96, 0x93, 0x09, 0x4F, 0x60, 0xF8, 0x21, 0x29,
+  0x27, 0xBD, 0xF5, 0x98, 0x38, 0x57, 0xC8, 0xC3, 0x31, 0x0A, 0xBB, 0x7B, 0x86, 0x86, 0x69, 0x36,
+  0x4B, 0x4A, 0x4C, 0x0D, 0x65, 0xC4, 0x5E, 0x57, 0xB4, 0x99, 0x04, 0x91, 0x1B, 0x86, 0x57, 0x46,
+  0x84, 0x56, 0x2D, 0xFF, 0xC2, 0x0D, 0x70, 0xF5, 0x79, 0x68, 0x49, 0x64, 0x1C, 0xC2, 0x94, 0xF1,
+  0x87, 0x20, 0x60, 0x9E, 0x55, 0xDD, 0xDC, 0x66, 0x76, 0x81, 0x2B, 0x78, 0x23, 0x04, 0xE6, 0xF1,
+  0x6E, 0x2D, 0x31, 0x24, 0xC7, 0x77, 0x4B, 0xFA, 0xC1, 0xEE, 0xA5, 0x0D, 0xFB, 0x86, 0x23, 0xE6,
+  0x1B, 0x6E, 0xC6, 0x73, 0xCD, 0xFB, 0x09, 0xF1, 0x4B, 0x61, 0x75, 0x23, 0x77, 0x91, 0xB9, 0x75,
+  0xFA, 0xBB, 0xC7, 0x67, 0x47, 0x5F, 0x1E, 0x8B, 0xA4, 0x0A, 0x15, 0x8D, 0x6C, 0x59, 0xF4, 0x4B,
+  0x3C, 0x93, 0x89, 0x78, 0xC2, 0x74, 0x66, 0x7C, 0x72, 0x9C, 0xB1, 0xE7, 0xEF, 0x88, 0x32, 0x3E,
+  0xEE, 0x8F, 0xC5, 0xD3, 0xA3, 0x3D, 0xD5, 0x03, 0x7B, 0xE3, 0x53, 0xAF, 0xFB, 0x68, 0x77, 0xD2,
+  0xC7, 0xA7, 0x47, 0x5E, 0xEF, 0xE1, 0x98, 0x6A, 0x45, 0x02, 0x60, 0x91, 0x93, 0x91, 0x13, 0xD1,
+  0x32, 0x61, 0x1E, 0xA6, 0x64, 0x8B, 0x60, 0xB3, 0x9A, 0x61, 0x41, 0x66, 0x42, 0x3F, 0xA8, 0x2B,
+  0x4E, 0xEC, 0xFC, 0x0A, 0x1A, 0x8A, 0x2D, 0xE7, 0xF1, 0x67, 0x9D, 0x04, 0x8B, 0x5F, 0x3C, 0x12,
+  0x71, 0xE2, 0xA2, 0x87, 0x4A, 0xC0, 0xC9, 0x8B, 0x3A, 0x74, 0xBD, 0xCC, 0x97, 0x67, 0x2F, 0x5F,
+  0x60, 0x18, 0x97, 0x5C, 0x42, 0x85, 0x90, 0x0E, 0xB0, 0xE2, 0x31, 0x90, 0xA4, 0x2D, 0xBD, 0xF9,
+  0x43, 0x43, 0x20, 0xCA, 0x6B, 0xC9, 0xB5, 0x9D, 0x16, 0xF3, 0x94, 0x19, 0x6F, 0xB6, 0xE5, 0x07,
+  0xE7, 0x2A, 0xFA, 0x2E, 0xAF, 0xE9, 0xD6, 0x33, 0x9A, 0x64, 0xF6, 0x97, 0x65, 0x34, 0x28, 0xBB,
+  0x7E, 0xA8, 0x80, 0x70, 0x6C, 0xA3, 0x11, 0xAA, 0x31, 0x20, 0x8A, 0x8E, 0x8A, 0x31, 0x54, 0x5B,
+  0x50, 0xEE, 0x46, 0x6D, 0x4D, 0x35, 0xCE, 0xE9, 0x81, 0x9D, 0xFD, 0x3E, 0x0F, 0x72, 0x16, 0xA4,
+  0xAC, 0xD0, 0x5A, 0x84, 0x0F, 0xA8, 0x2C, 0x27, 0x4B, 0xE4, 0x2B, 0xAD, 0xD5, 0x0A, 0xB7, 0xD9,
+  0x0C, 0xA3, 0xE4, 0x29, 0x90, 0x26, 0x28, 0x63, 0x38, 0xD3, 0xC7, 0x16, 0xBF, 0x81, 0xA3, 0x79,
+  0xD9, 0x2A, 0xCC, 0x25, 0x4E, 0x44, 0xCE, 0x30, 0xC5, 0xCE, 0xB6, 0x54, 0x82, 0x66, 0x91, 0x4C,
+  0x6B, 0x69, 0xEC, 0x20, 0x67, 0x21, 0xB7, 0x1B, 0xDA, 0x60, 0xC2, 0x06, 0x68, 0x3F, 0xDF, 0x16,
+  0x48, 0x69, 0x56, 0xCF, 0x41, 0xBE, 0xC6, 0xAB, 0x5C, 0xC7, 0xA1, 0x38, 0xF4, 0x08, 0xE3, 0xA9,
+  0x91, 0x42, 0x27, 0x12, 0x58, 0x95, 0x39, 0x8C, 0xD2, 0x9C, 0x6E, 0x75, 0x94, 0xC5, 0x7F, 0x7D,
+  0x4A, 0x8D, 0x44, 0x0E, 0xA2, 0x3F, 0x92, 0x26, 0x09, 0x16, 0xC1, 0xE6, 0x67, 0xA7, 0x3C, 0x39,
+  0xE7, 0x09, 0x5D, 0x58, 0x41, 0x02, 0x05, 0xCB, 0xE3, 0xC9, 0x04, 0x70, 0xFC, 0x32, 0xCD, 0x6D,
+  0xE9, 0xA7, 0xC1, 0x64, 0xC2, 0x44, 0xBC, 0x6F, 0x5B, 0xF9, 0x30, 0x09, 0xF7, 0xDC, 0x50, 0x79,
+  0x2A, 0xDB, 0xE2, 0x72, 0xE9, 0x66, 0x29, 0x37, 0x4F, 0x60, 0x03, 0x0F, 0xCD, 0xE2, 0xF7, 0x23,
+  0xD2, 0x02, 0xD7, 0xE2, 0xE6, 0x68, 0x2D, 0xE9, 0x6E, 0x04, 0xD5, 0xFB, 0xA2, 0xB4, 0x48, 0x82,
+  0x03, 0xAA, 0xC8, 0x33, 0xE0, 0xE4, 0x5D, 0xD3, 0x25, 0x42, 0x1C, 0xB1, 0xF8, 0xFD, 0x17, 0xD6,
+  0xFD, 0x2E, 0xEF, 0x79, 0xFD, 0xAE, 0x35, 0x04, 0x66, 0x1E, 0xF4, 0xE0, 0x8F, 0xB5, 0x6F, 0xE6,
+  0xAD, 0x8D, 0x0E, 0xCB, 0xA0, 0xCD, 0xFC, 0xBA, 0x56, 0x6F, 0x17, 0x33, 0xCF, 0x30, 0x9F, 0xB4,
+  0x98, 0x39, 0xCF, 0xC4, 0xB1, 0x94, 0x2D, 0xAE, 0x1A, 0x6F, 0x51, 0x3A, 0x7A, 0xF3, 0x3A, 0x98,
+  0xC8, 0x82, 0xE6, 0x75, 0x9E, 0x8B, 0x59, 0x9E, 0xB3, 0x68, 0x00, 0xB3, 0xCE, 0x53, 0x31, 0x8D,
+  0xB5, 0x12, 0xA4, 0x9F, 0x7E, 0xB2, 0x4E, 0x1F, 0x7F, 0xF5, 0xF5, 0xF1, 0xC9, 0xE3, 0xB7, 0x4F,
+  0x8F, 0xAD, 0xFD, 0x1B, 0xD4, 0xD7, 0xB5, 0x10, 0xD5, 0x54, 0x37, 0x04, 0x4A, 0xD7, 0x1E, 0x03,
+  0x3C, 0x5D, 0x21, 0xEA, 0xA1, 0xF0, 0x73, 0x37, 0x6C, 0xE1, 0xCF, 0x9C, 0x09, 0xB9, 0x25, 0x08,
+  0xA1, 0x59, 0x88, 0xA8, 0x6B, 0xCA, 0xBD, 0xBD, 0x19, 0xE5, 0x3C, 0x01, 0xED, 0x41, 0xB9, 0x6F,
+  0x31, 0xCA, 0xBE, 0x52, 0x99, 0x4D, 0x22, 0x39, 0x68, 0x94, 0x98, 0x15, 0x27, 0x79, 0xC5, 0xD4,
+  0xAC, 0x78, 0x92, 0x57, 0x8C, 0xA9, 0x22, 0x17, 0x4D, 0x40, 0xBF, 0xC9, 0xD5, 0x29, 0xE5, 0x67,
+  0xC7, 0xC9, 0xE3, 0x10, 0xDA, 0xCB, 0x9F, 0x0E, 0x80, 0x0E, 0x4A, 0xCA, 0xA5, 0xA3, 0xC3, 0x54,
+  0x43, 0x47, 0x16, 0x4F, 0xA7, 0x61, 0x81, 0x8E, 0x56, 0x6A, 0x0A, 0x1E, 0xE0, 0x06, 0x9C, 0xB1,
+  0x98, 0x32, 0xEC, 0x55, 0xB1, 0x54, 0xD8, 0xAF, 0x3B, 0x58, 0xF3, 0xA6, 0x38, 0x36, 0x78, 0xC1,
+  0x7D, 0x99, 0xD0, 0x6B, 0xE7, 0x5E, 0xCF, 0x1C, 0x38, 0xF5, 0xA8, 0x24, 0xD7, 0x31, 0xDB, 0x43,
+  0x2F, 0x2D, 0xC4, 0x12, 0xE1, 0x4D, 0x85, 0x08, 0x0A, 0xD3, 0x04, 0x33, 0xF3, 0x30, 0xEF, 0x0F,
+  0x79, 0x13, 0x09, 0xD4, 0x6E, 0x5E, 0xAB, 0x10, 0xF7, 0xA8, 0x9C, 0x63, 0xB7, 0xAF, 0x6C, 0xDC,
+  0xD1, 0xFA, 0x3C, 0xBA, 0x7D, 0x5C, 0xE8, 0x3D, 0x3F, 0xF7, 0x37, 0x84, 0x00, 0x50, 0xA9, 0x16,
+  0x49, 0x86, 0x2C, 0xEC, 0xAF, 0x4A, 0xD8, 0x53, 0x63, 0x00, 0xF4, 0x51, 0xB6, 0x2A, 0x21, 0x2F,
+  0x87, 0x2C, 0xBC, 0x5D, 0x6E, 0x13, 0x58, 0xCC, 0xB8, 0x13, 0x0F, 0xDD, 0x77, 0xED, 0xAE, 0x7C,
+  0xEC, 0xBD, 0x6B, 0x21, 0x2C, 0xA8, 0xFB, 0xE9, 0x27, 0x47, 0x3C, 0x76, 0x8B, 0xC7, 0x1E, 0x3E,
+  0xD2, 0x75, 0xE9, 0x5A, 0xDA, 0x37, 0x9F, 0x24, 0x3C, 0x9D, 0x9D, 0x91, 0xA0, 0x42, 0x7C, 0xE4,
+  0x92, 0xAC, 0x06, 0x5B, 0xD4, 0x15, 0x84, 0x11, 0xE5, 0x55, 0xCB, 0x0B, 0x12, 0x87, 0x18, 0xCA,
+  0xA0, 0x4B, 0xBC, 0x3D, 0x15, 0x6E, 0xA1, 0x9C, 0x63, 0xE9, 0x8A, 0xE6, 0xA9, 0xA0, 0x85, 0xA1,
+  0x42, 0xBF, 0xEA, 0x08, 0x45, 0x22, 0xFF, 0xE5, 0xF6, 0x03, 0xC6, 0x67, 0x28, 0x6A, 0x8F, 0xD7,
+  0x6A, 0x83, 0xEF, 0xEA, 0x2F, 0x03, 0x01, 0x1E, 0xA0, 0xD0, 0x6D, 0xB8, 0x08, 0x65, 0x92, 0xA7,
+  0x6B, 0x96, 0x39, 0x4B, 0xA7, 0x16, 0x99, 0x80, 0x6B, 0xDF, 0x13, 0xAB, 0xD0, 0x7D, 0x32, 0x99,
+  0xA8, 0x19, 0x5F, 0x14, 0x71, 0x03, 0xAE, 0x99, 0x58, 0x0F, 0x94, 0xC4, 0x25, 0xBA, 0x91, 0x92,
+  0x1A, 0xDD, 0x29, 0x89, 0x8F, 0x36, 0x76, 0x6D, 0xA2, 0xD9, 0xED, 0x14, 0x0D, 0x10, 0x0F, 0x52,
+  0x2C, 0xCA, 0xEF, 0x1F, 0xD1, 0xB6, 0x90, 0x7D, 0xBF, 0xC0, 0x1C, 0xD4, 0x18, 0xF4, 0x28, 0x23,
+  0xEB, 0x35, 0xE2, 0x96, 0x69, 0x28, 0x8B, 0xD9, 0xCB, 0xA9, 0xBF, 0x88, 0xE3, 0x85, 0x0D, 0xD2,
+  0xFB, 0x7A, 0x35, 0x17, 0x60, 0xF4, 0x08, 0x30, 0xF4, 0x38, 0x0A, 0xE6, 0x64, 0xBA, 0x09, 0x9B,
+  0xB5, 0x02, 0x05, 0x99, 0xEF, 0x66, 0x6B, 0xE3, 0xC6, 0x5A, 0x12, 0x3F, 0x88, 0x3E, 0x8A, 0x68,
+  0xD1, 0x4F, 0x92, 0xA2, 0x09, 0x96, 0x62, 0xE6, 0x45, 0x29, 0x6E, 0x76, 0x7A, 0x7A, 0xAC, 0x54,
+  0x4D, 0x0B, 0x5C, 0x6F, 0xAC, 0x95, 0x17, 0xCD, 0xE4, 0xB1, 0xB4, 0xB7, 0x9C, 0x2E, 0x64, 0x0A,
+  0xAD, 0x59, 0x9C, 0x80, 0x9E, 0x14, 0x5B, 0x69, 0xB9, 0x32, 0x42, 0x87, 0x5F, 0xB0, 0x78, 0x18,
+  0xC0, 0xD2, 0x69, 0x23, 0x47, 0x7E, 0x7E, 0xED, 0x25, 0x02, 0x2A, 0xF6, 0x9C, 0x45, 0x96, 0x0B,
+  0x63, 0x91, 0xEA, 0xD5, 0x93, 0x8F, 0x71, 0xBE, 0x2E, 0xA6, 0x2B, 0x23, 0xC1, 0x58, 0xE2, 0x2B,
+  0x18, 0xD2, 0xAB, 0xE2, 0xD7, 0x9A, 0x55, 0xEE, 0xBE, 0x9E, 0x31, 0x9C, 0x0B, 0xF0, 0x94, 0x6C,
+  0x5B, 0x21, 0xB1, 0x5B, 0x4C, 0xD7, 0x07, 0xF2, 0xED, 0xF6, 0x8F, 0xF8, 0x74, 0xFB, 0x47, 0x30,
+  0xFB, 0x8E, 0xD0, 0x42, 0x45, 0x31, 0x74, 0x41, 0x19, 0x92, 0x1D, 0xB2, 0x97, 0x4E, 0xC1, 0x48,
+  0xF5, 0xB8, 0x6E, 0x62, 0x86, 0xF8, 0xAB, 0x18, 0x82, 0xBC, 0xB4, 0x16, 0xE0, 0xE0, 0x08, 0x84,
+  0x09, 0x03, 0x04, 0x1B, 0xD5, 0xD8, 0x5C, 0x29, 0x7D, 0x57, 0xD0, 0x62, 0xBC, 0x6C, 0x53, 0x22,
+  0x15, 0x52, 0x8E, 0x0E, 0x31, 0xA4, 0x2D, 0x42, 0x16, 0xEA, 0xAC, 0xDA, 0x58, 0xA6, 0xAF, 0x39,
+  0xDF, 0x82, 0x6A, 0xC1, 0x87, 0xBF, 0x57, 0xCE, 0x16, 0xC7, 0x32, 0x23, 0xF3, 0x03, 0x0A, 0x40,
+  0x40, 0x51, 0xF4, 0x84, 0x62, 0x29, 0xF7, 0xFC, 0xCE, 0x65, 0xB3, 0xE4, 0xC0, 0x60, 0x20, 0x44,
+  0xC0, 0x44, 0xBF, 0x52, 0x48, 0x03, 0xE0, 0x09, 0xBF, 0x93, 0x88, 0x63, 0x35, 0x07, 0x5E, 0x4C,
+  0xDF, 0x4E, 0xCD, 0x24, 0x0F, 0xF4, 0xC7, 0xD0, 0xA4, 0xD8, 0xE7, 0x43, 0xEA, 0xD5, 0xD4, 0x0D,
+  0x9D, 0x98, 0x0C, 0x9D, 0x84, 0xC4, 0x00, 0x38, 0x72, 0x40, 0x53, 0x81, 0x8C, 0x94, 0x4A, 0x0A,
+  0xD3, 0x33, 0x6B, 0x72, 0x03, 0x01, 0xA7, 0x4E, 0x61, 0xA0, 0x96, 0xB6, 0xB5, 0xDF, 0x42, 0xE9,
+  0xBB, 0xDC, 0x86, 0x93, 0x38, 0x07, 0x16, 0xA4, 0x5F, 0xB9, 0x1B, 0x49, 0xBB, 0xB6, 0x80, 0x41,
+  0x7A, 0x18, 0xF6, 0xFA, 0xCB, 0xD7, 0x6F, 0x4F, 0xD9, 0x8B, 0xE7, 0x27, 0xAF, 0x8E, 0xAD, 0x52,
+  0xAA, 0x7F, 0x0A, 0xD6, 0xD9, 0x33, 0xFC, 0xCC, 0x2E, 0x3D, 0x8B, 0x73, 0xAE, 0x24, 0x66, 0xD5,
+  0xBF, 0x3F, 0x29, 0x7D, 0xC9, 0x60, 0x57, 0x72, 0xA6, 0xC1, 0x44, 0xB0, 0x30, 0xA6, 0xFD, 0x15,
+  0xFE, 0x1E, 0xEE, 0x11, 0x28, 0x4E, 0x5B, 0xE8, 0xCA, 0x92, 0x14, 0xDE, 0x5F, 0x25, 0x05, 0x84,
+  0xF8, 0x95, 0x1F, 0x77, 0x44, 0xE2, 0x4B, 0x24, 0x1F, 0x44, 0xE8, 0xF9, 0xED, 0x87, 0x48, 0xFE,
+  0xB0, 0x80, 0xB8, 0xB6, 0xB1, 0x48, 0x46, 0x2C, 0xEE, 0xF6, 0xDB, 0xFA, 0x56, 0x4E, 0xA6, 0x25,
+  0x14, 0x5D, 0x4B, 0x68, 0xB5, 0x96, 0x96, 0x50, 0xFD, 0x2E, 0x57, 0xFC, 0x22, 0x35, 0xFD, 0x5A,
+  0x18, 0x12, 0x98, 0x9E, 0x5E, 0xA5, 0x58, 0xFA, 0x84, 0xAE, 0xE4, 0x25, 0xD4, 0xE2, 0x49, 0x9E,
+  0x50, 0x95, 0xBF, 0x96, 0xC8, 0x4D, 0x6C, 0x29, 0x85, 0x9E, 0xAB, 0x0B, 0xD6, 0x0A, 0xCF, 0xB4,
+  0x9C, 0x64, 0x44, 0xBC, 0x6D, 0x2A, 0xFD, 0x22, 0xF7, 0x9A, 0x5E, 0xF5, 0x6F, 0x53, 0xD4, 0x8D,
+  0x6D, 0x3F, 0xF2, 0xA2, 0x5E, 0xE5, 0xCE, 0xA0, 0x9C, 0x8A, 0x97, 0x5C, 0x4F, 0x60, 0x52, 0x98,
+  0x12, 0xCA, 0x8A, 0xB0, 0x58, 0x5C, 0xBE, 0x8B, 0x4E, 0xBE, 0x39, 0xB0, 0x64, 0xF4, 0xA2, 0x40,
+  0xDA, 0x5B, 0xF4, 0x8C, 0x92, 0x43, 0xBB, 0x7E, 0x39, 0x7F, 0x55, 0x1F, 0x2A, 0x01, 0xD6, 0xF2,
+  0xA3, 0xC2, 0x02, 0x7B, 0x55, 0x2B, 0x0F, 0x93, 0x19, 0xF0, 0xAC, 0x77, 0xDF, 0xAC, 0x3F, 0x29,
+  0xD5, 0x4F, 0x4B, 0xF5, 0x4F, 0x4A, 0xF5, 0xF2, 0x9C, 0xAC, 0x5E, 0xB1, 0xAC, 0xD9, 0x1A, 0x72,
+  0x8B, 0xEB, 0x50, 0x25, 0xD1, 0x63, 0x5E, 0x73, 0xBC, 0xC5, 0xCC, 0xBD, 0xA8, 0xC1, 0x90, 0x51,
+  0x4F, 0x09, 0x69, 0xC6, 0x25, 0xAC, 0x7A, 0xC9, 0xDD, 0xA8, 0xD2, 0xD2, 0xF3, 0x57, 0x61, 0x4B,
+  0x4B, 0xD2, 0x5F, 0x85, 0x30, 0x2D, 0x55, 0xFF, 0x17, 0xC5, 0x99, 0xB2, 0x72, 0x51, 0x45, 0x82,
+  0x55, 0x33, 0x01, 0x39, 0xBC, 0x02, 0x6F, 0xCC, 0xF6, 0xE3, 0xE4, 0xF6, 0x43, 0xB3, 0x8C, 0x3F,
+  0x3D, 0x21, 0xEC, 0xD9, 0xB3, 0xA7, 0x0F, 0x45, 0x42, 0x98, 0x90, 0x01, 0xE2, 0x0E, 0x4F, 0x33,
+  0xC1, 0x8F, 0xCD, 0xE9, 0x7B, 0x62, 0x52, 0xA8, 0xF4, 0x45, 0x31, 0xFE, 0x26, 0x1E, 0x12, 0x2D,
+  0x30, 0xAC, 0x1B, 0x65, 0xCD, 0x2D, 0x5C, 0x6E, 0xF9, 0x36, 0x4E, 0xAB, 0xB9, 0x51, 0x00, 0x00,
+  0x45, 0xB9, 0xF9, 0x59, 0x51, 0x61, 0x5A, 0xD5, 0x7C, 0x58, 0xA4, 0x78, 0x5A, 0x4E, 0x33, 0xC1,
+  0x5B, 0x14, 0xD5, 0xF0, 0x74, 0xA5, 0xE2, 0xC6, 0xC3, 0xDA, 0xF7, 0x3C, 0x0C, 0x58, 0x25, 0x73,
+  0xDB, 0x32, 0x2F, 0x61, 0xC4, 0x34, 0xEA, 0x94, 0x24, 0xDD, 0x42, 0xFB, 0xF6, 0xE8, 0x0B, 0xAB,
+  0xA9, 0x4F, 0x4D, 0x45, 0x18, 0x13, 0x31, 0xA6, 0x16, 0x0A, 0x34, 0x63, 0x1B, 0x9A, 0x77, 0x42,
+  0xD3, 0x63, 0x9C, 0xBE, 0xC4, 0x00, 0xDF, 0xC4, 0xAA, 0x0B, 0xBA, 0x89, 0xCE, 0x78, 0xF3, 0x24,
+  0xA2, 0x19, 0xBC, 0xC4, 0x30, 0x76, 0x7D, 0x1B, 0xD3, 0x4C, 0xC4, 0x57, 0x62, 0x22, 0xCC, 0x50,
+  0x8D, 0x1D, 0x6A, 0xC3, 0xC8, 0x0C, 0x4D, 0x31, 0xB1, 0x96, 0x38, 0xA6, 0x68, 0x6A, 0x98, 0x2B,
+  0xEE, 0xBD, 0x74, 0xF3, 0x2F, 0xF9, 0xE4, 0x8D, 0x97, 0x6F, 0xCF, 0x8E, 0xF2, 0xAD, 0x94, 0xD7,
+  0x65, 0x6E, 0x88, 0xCE, 0x5A, 0x23, 0x58, 0x3B, 0x9B, 0xE2, 0x8B, 0x98, 0xC2, 0x57, 0xD0, 0xA2,
+  0xD0, 0xF3, 0xDA, 0x67, 0x45, 0x3F, 0x9A, 0x75, 0x3F, 0x82, 0x4A, 0x7D, 0x4D, 0x0A, 0x5C, 0xB4,
+  0xD2, 0x97, 0x87, 0xB6, 0x18, 0xD3, 0x6F, 0xE8, 0xC4, 0x24, 0x67, 0x2D, 0xEA, 0xFB, 0xDD, 0x76,
+  0x2A, 0xE7, 0xFE, 0x05, 0x8D, 0x3A, 0xFA, 0xEC, 0x9A, 0xFE, 0xBD, 0xF9, 0x6D, 0xF6, 0x23, 0x3C,
+  0x67, 0x3F, 0xDE, 0x7C, 0x57, 0x13, 0xE7, 0x2D, 0x52, 0x90, 0x55, 0xC5, 0xF7, 0xFA, 0x36, 0x02,
+  0xB9, 0x7C, 0xAF, 0xF2, 0x8C, 0x47, 0x95, 0x3C, 0xE3, 0xB5, 0x09, 0xB9, 0x78, 0xAF, 0x68, 0x9A,
+  0xE3, 0x1C, 0xF6, 0xBD, 0x9A, 0xFA, 0x5D, 0x49, 0xD8, 0xDA, 0x24, 0x05, 0x17, 0x61, 0x5A, 0xD5,
+  0x8C, 0xE5, 0x9B, 0xB5, 0x34, 0xB2, 0x1E, 0x24, 0xC8, 0x8A, 0x14, 0x0F, 0x7A, 0x4B, 0xA0, 0x35,
+  0xE2, 0xA9, 0xF9, 0xA5, 0xA1, 0xAD, 0x75, 0x7E, 0xBF, 0xFE, 0x2B, 0x7E, 0xDF, 0xAA, 0xDF, 0xE1,
+  0x79, 0xD7, 0x62, 0x35, 0x15, 0xB0, 0xD9, 0xEF, 0xB4, 0x00, 0x01, 0xD0, 0xE0, 0xE8, 0x10, 0xFE,
+  0x5A, 0x4D, 0x7E, 0x18, 0x01, 0xAA, 0xBA, 0x65, 0x55, 0x7B, 0x07, 0xEA, 0x11, 0x8E, 0x0A, 0x28,
+  0xE0, 0x8F, 0xF9, 0x8C, 0x46, 0xD6, 0xF1, 0xEB, 0xA7, 0x96, 0x30, 0xB4, 0x72, 0xEA, 0x1D, 0x69,
+  0x94, 0x2B, 0x2A, 0xF0, 0x77, 0x5F, 0xB3, 0x2F, 0x31, 0x93, 0xDE, 0xEE, 0xF5, 0x5B, 0x83, 0x47,
+  0xF8, 0x9F, 0xA3, 0x2A, 0xE5, 0xB7, 0xE5, 0x11, 0xBD, 0xE6, 0x47, 0x33, 0x7A, 0x4A, 0x9C, 0xEF,
+  0x8F, 0xF2, 0x8F, 0xF6, 0xF4, 0x29, 0x40, 0x45, 0xAB, 0x5B, 0x82, 0xA3, 0x33, 0x8E, 0xB4, 0xB2,
+  0xBF, 0x10, 0xFF, 0x0C, 0x8B, 0x69, 0x35, 0x0B, 0xE6, 0x79, 0x00, 0x40, 0x3E, 0x17, 0x52, 0x81,
+  0xC9, 0x73, 0x97, 0x72, 0xA4, 0xA1, 0x30, 0xAD, 0xB3, 0xF8, 0xF9, 0xE9, 0x6B, 0x99, 0xEF, 0x90,
+  0x7F, 0x9F, 0x77, 0x66, 0x35, 0xC1, 0x9F, 0xDF, 0x67, 0xC6, 0xC7, 0x7D, 0x79, 0x07, 0x1C, 0xA5,
+  0xDC, 0x83, 0x15, 0x3D, 0x2A, 0xB1, 0x0B, 0xE8, 0x4A, 0x15, 0xF5, 0x86, 0x1A, 0x33, 0x99, 0xF8,
+  0x55, 0x0C, 0xAA, 0x05, 0xF5, 0x09, 0xB9, 0xE1, 0x22, 0x07, 0x3F, 0x13, 0xAD, 0xAA, 0xEA, 0x0F,
+  0xDC, 0xCE, 0xA6, 0x24, 0xBF, 0xA3, 0x19, 0x4E, 0x8F, 0x3E, 0x8B, 0x91, 0x02, 0x1B, 0xC4, 0x17,
+  0x7D, 0xEB, 0x19, 0x5A, 0x74, 0xFD, 0xC0, 0x96, 0xF4, 0xA3, 0xAA, 0x44, 0x83, 0x82, 0xB4, 0xA0,
+  0x19, 0x24, 0x65, 0xE9, 0x37, 0x8A, 0x78, 0x80, 0x0A, 0x34, 0xC8, 0xFC, 0x0E, 0xED, 0x5B, 0x53,
+  0xD4, 0x43, 0xC5, 0xD1, 0x53, 0xA1, 0x86, 0x9F, 0x6B, 0x1A, 0xA3, 0x2E, 0x6F, 0x1D, 0x29, 0xAF,
+  0xDE, 0x4E, 0xD4, 0x54, 0x79, 0xCD, 0x49, 0x04, 0x2B, 0x1F, 0x41, 0x14, 0x9F, 0x6E, 0xB7, 0x4A,
+  0x96, 0xA2, 0x31, 0x1B, 0xFC, 0x40, 0x05, 0x60, 0x9D, 0xF3, 0x84, 0xAE, 0x54, 0x47, 0xCD, 0x76,
+  0xE1, 0x82, 0x90, 0xB4, 0x27, 0xF8, 0x63, 0x55, 0x01, 0xF3, 0x6E, 0xFF, 0x15, 0xEF, 0xB1, 0x38,
+  0x7A, 0xF0, 0x80, 0x9D, 0x07, 0x2E, 0x1A, 0x04, 0xF4, 0xEB, 0x81, 0x6C, 0xB2, 0xCC, 0xC4, 0x75,
+  0x2B, 0xDA, 0x2F, 0x25, 0x51, 0xCE, 0x44, 0x10, 0x0A, 0xD3, 0x61, 0xD5, 0x17, 0xF6, 0x16, 0xDD,
+  0x14, 0x8D, 0x6E, 0x87, 0xE1, 0x9C, 0x58, 0xDD, 0x8E, 0xD3, 0x71, 0x2C, 0x23, 0x34, 0x62, 0x70,
+  0x96, 0xFA, 0x78, 0x7D, 0x1E, 0x83, 0x78, 0xD1, 0xAA, 0x0C, 0xDD, 0xF0, 0x80, 0xEE, 0xA8, 0x12,
+  0xE4, 0x5D, 0xA6, 0xEB, 0x91, 0xEA, 0xBB, 0x9E, 0xAE, 0xCB, 0x24, 0x3A, 0xB2, 0x7A, 0xFD, 0xE1,
+  0xE0, 0x11, 0xFC, 0x67, 0xE9, 0x1A, 0x5C, 0xFB, 0x6C, 0x18, 0xD7, 0x42, 0x3A, 0x61, 0x74, 0x98,
+  0x6B, 0x04, 0x51, 0xE2, 0x03, 0xD9, 0x98, 0x1F, 0x72, 0x8C, 0xFC, 0xFD, 0xEA, 0xA7, 0xAB, 0x23,
+  0x5F, 0x1C, 0x87, 0xA8, 0x45, 0xFA, 0xE9, 0xE8, 0xBB, 0xCF, 0xAE, 0xFD, 0x0E, 0x7E, 0xCC, 0x7A,
+  0xD3, 0xFE, 0xEC, 0x5A, 0x4E, 0xD5, 0xEF, 0xD0, 0x17, 0xAD, 0x95, 0x0B, 0x1C, 0x8C, 0x26, 0xBE,
+  0x7B, 0x55, 0x6D, 0xF0, 0x5D, 0x0D, 0x36, 0xFC, 0x34, 0xC7, 0x29, 0x0D, 0x97, 0x43, 0xC0, 0x4F,
+  0x63, 0xAB, 0x20, 0x86, 0xFA, 0x34, 0xE8, 0x5B, 0xD9, 0xF5, 0x6D, 0x84, 0x8F, 0xBC, 0x72, 0x2A,
+  0x06, 0x86, 0xB3, 0x94, 0xA2, 0x96, 0x7E, 0x47, 0xFF, 0x8C, 0x14, 0xFC, 0xFF, 0x25, 0x38, 0xD9,
+  0x60, 0x8F, 0x72, 0x1F, 0x24, 0x2E, 0x19, 0x18, 0xC6, 0x57, 0xA6, 0xB9, 0x04, 0x31, 0xFB, 0x61,
+  0xA0, 0xAB, 0x4B, 0x41, 0x2E, 0x0C, 0x86, 0xDE, 0x68, 0x80, 0x8B, 0x6F, 0xF6, 0x56, 0xC1, 0x2E,
+  0x3E, 0xCA, 0x2C, 0x03, 0x2F, 0xFA, 0x9A, 0x30, 0xC5, 0x27, 0xAA, 0xAB, 0xE0, 0xA9, 0x0F, 0x58,
+  0xCB, 0xD0, 0x44, 0x79, 0x0E, 0xC9, 0xFC, 0x86, 0xB5, 0x06, 0x58, 0xF9, 0x23, 0x57, 0x0D, 0x9E,
+  0x59, 0x25, 0x16, 0x3F, 0xD4, 0x97, 0x5E, 0xF9, 0x14, 0x76, 0x35, 0xFC, 0xDA, 0xE5, 0x57, 0xFA,
+  0x97, 0x21, 0x9F, 0xB8, 0x8B, 0xD5, 0x20, 0xE9, 0x0B, 0xDA, 0x2A, 0xB4, 0x13, 0xFC, 0x1D, 0x5F,
+  0x13, 0x0C, 0x7E, 0x47, 0xBB, 0x1A, 0x8E, 0xF8, 0xCA, 0xB6, 0x0A, 0x08, 0xCB, 0xCB, 0x90, 0xCA,
+  0x9F, 0xDF, 0xAE, 0x86, 0x5A, 0xFE, 0x14, 0xB7, 0x0A, 0xBF, 0x0C, 0xAB, 0x3C, 0x56, 0xE5, 0x7B,
+  0xDD, 0xD5, 0x83, 0x55, 0xBE, 0xDD, 0xAD, 0x8E, 0x56, 0x81, 0xB6, 0x66, 0x38, 0xF9, 0x85, 0xEF,
+  0x46, 0xE3, 0xC9, 0xAF, 0x7D, 0xD7, 0x0E, 0x28, 0xE1, 0x95, 0x47, 0x34, 0x3F, 0x0A, 0x5E, 0x3D,
+  0x9A, 0xF9, 0x81, 0x70, 0x75, 0x24, 0x13, 0xCE, 0x8A, 0x51, 0x8A, 0x6F, 0x84, 0xEF, 0x1C, 0x48,
+  0xFF, 0x9C, 0x78, 0xE5, 0x68, 0x45, 0xA3, 0x95, 0x7C, 0x51, 0xF9, 0xFA, 0xF8, 0xCE, 0x91, 0xF3,
+  0x2F, 0x91, 0x57, 0x0E, 0x5B, 0x00, 0x2B, 0x8F, 0xA6, 0x7F, 0x94, 0xBC, 0x7A, 0x20, 0xF3, 0xD3,
+  0xE5, 0xEA, 0x30, 0x7A, 0xFD, 0xCA, 0x85, 0xD5, 0x7D, 0xE4, 0x7C, 0xC7, 0x90, 0xA7, 0xAB, 0xD6,
+  0x55, 0x07, 0x6B, 0xC5, 0xD2, 0xFC, 0x8D, 0x47, 0xA3, 0xAF, 0xA4, 0x57, 0x2E, 0xCE, 0xBF, 0x63,
+  0xA4, 0xE2, 0x63, 0xEA, 0x3B, 0x86, 0x29, 0x3E, 0xAC, 0x5E, 0x31, 0x56, 0x01, 0xA9, 0x10, 0xED,
+  0xF9, 0xB7, 0xD6, 0x25, 0xE0, 0x50, 0x9B, 0x9B, 0xE6, 0x7A, 0x33, 0xB4, 0xCB, 0xC1, 0x3D, 0x68,
+  0x77, 0x95, 0xF4, 0x37, 0x6E, 0x6D, 0x2B, 0x4C, 0x09, 0x0C, 0x7E, 0x5B, 0xFB, 0xA5, 0x26, 0xEA,
+  0x7B, 0x6E, 0xD5, 0xA8, 0xDD, 0xA5, 0xCD, 0x94, 0x9E, 0xC1, 0x3A, 0x70, 0xE2, 0xE2, 0xB6, 0x0A,
+  0x40, 0xCD, 0xAE, 0x28, 0x0A, 0xEF, 0x18, 0xD5, 0x6C, 0x7A, 0xA3, 0x30, 0x91, 0xC7, 0x62, 0x6B,
+  0xB0, 0xAC, 0x5D, 0x7C, 0xA1, 0xA1, 0x36, 0x2F, 0xCD, 0xB1, 0x99, 0x5F, 0x24, 0x51, 0x03, 0xA3,
+  0x72, 0xC9, 0x04, 0xC0, 0xD0, 0x2E, 0xA4, 0xF8, 0x56, 0xEB, 0xFD, 0x4E, 0x07, 0x28, 0x02, 0x6D,
+  0xF5, 0x00, 0xCD, 0x20, 0xDC, 0x48, 0x6B, 0xBF, 0x5F, 0x1F, 0x84, 0xD3, 0x9A, 0x9C, 0xEC, 0xD7,
+  0x07, 0xE1, 0xB4, 0x26, 0x4F, 0xF6, 0x57, 0x85, 0xC5, 0xF2, 0x34, 0x73, 0x6D, 0xC8, 0x96, 0x06,
+  0x5B, 0x7B, 0x7E, 0x22, 0x7E, 0xC8, 0x59, 0xFB, 0x12, 0x67, 0xA4, 0xF5, 0xF6, 0x54, 0x57, 0x4F,
+  0xF5, 0x13, 0x61, 0x54, 0x69, 0xD5, 0x8A, 0xD0, 0x2D, 0x78, 0xB3, 0x85, 0xF0, 0x1B, 0x89, 0x3C,
+  0x1A, 0xE3, 0x74, 0x5F, 0x66, 0xB0, 0xAC, 0xF2, 0xAD, 0xCA, 0xE7, 0x0D, 0xF2, 0xEC, 0x09, 0x6B,
+  0x0A, 0x97, 0x4B, 0xBF, 0x47, 0xC7, 0x43, 0x37, 0x0A, 0x7C, 0x7D, 0x6C, 0x72, 0xD3, 0xCC, 0x83,
+  0x04, 0x64, 0xE3, 0x16, 0x3D, 0x6E, 0xFF, 0x08, 0x4E, 0x87, 0x27, 0x1A, 0x0B, 0x9F, 0x4B, 0x8B,
+  0x87, 0x59, 0x2D, 0x11, 0x58, 0xAA, 0x19, 0xDD, 0x38, 0xEC, 0x58, 0x35, 0x67, 0x15, 0x9F, 0x3F,
+  0xD8, 0x56, 0x77, 0xA1, 0x1D, 0x6C, 0xD3, 0x2F, 0x5F, 0x1F, 0x6C, 0xCF, 0xB2, 0x79, 0x78, 0xB8,
+  0xF5, 0x7F, 0x01, 0x59, 0xA7, 0x75, 0xE5, 0xE0, 0x95, 0x00, 0x00,
+};
+static const size_t MAIN_page_gz_len = sizeof(MAIN_page_gz);
+
+#endif // COUNTDOWNPAGEGZ_H
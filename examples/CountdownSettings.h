@@ -0,0 +1,162 @@
+/**
+ * Paramètres du compte à rebours web en une structure (POST /api/settings)
+ *
+ * Partagé entre examples/fullscreen_countdown_web.cpp et son test natif
+ * (examples/settings_patch_test.cpp). Les clés sont celles de /getSettings,
+ * plus endColorR/G/B et endEffect (0 fixe, 1 clignotant, 2 fondu,
+ * 3 arc-en-ciel). Les bornes reprennent celles de handleSettings, mais une
+ * valeur hors bornes refuse tout le corps au lieu d'être ramenée dans
+ * l'intervalle.
+ *
+ * countdownSettingsPatch() applique un corps JSON à une copie de travail
+ * puis vérifie la cohérence entre champs (jour du mois si le corps touche
+ * à la date, titre UTF-8 non vide) : la copie n'est publiée que si tout
+ * est valide. Une date déjà publiée hors du mois (ancien /settings, NVS)
+ * ne bloque donc pas les corps qui n'y touchent pas ; /settings et
+ * loadSettings ramènent le jour dans le mois.
+ * countdownSettingsToJson() écrit la même table (réponse de /getSettings),
+ * relisible telle quelle par countdownSettingsPatch().
+ */
+#ifndef COUNTDOWNSETTINGS_H
+#define COUNTDOWNSETTINGS_H
+
+#include <stddef.h>
+#include "JsonPatch.h"
+#include "JsonWriter.h"
+
+struct CountdownSettings {
+  char title[51];            // taille de countdownTitle
+  int year, month, day, hour, minute, second;
+  int fontStyle;             // 0=Normal, 1=Gras, 2=Italique
+  int colorR, colorG, colorB;
+  int endColorR, endColorG, endColorB;
+  int endEffect;
+  bool blinkEnabled;
+  int blinkIntervalMs, blinkWindow;
+  bool marqueeEnabled;
+  int marqueeIntervalMs, marqueeGap, marqueeMode, marqueeReturnIntervalMs;
+  int marqueeBouncePauseLeftMs, marqueeBouncePauseRightMs;
+  int marqueeOneShotDelayMs;
+  bool marqueeOneShotStopCenter;
+  int marqueeOneShotRestartSec;
+  bool marqueeAccelEnabled;
+  int marqueeAccelStartIntervalMs, marqueeAccelEndIntervalMs, marqueeAccelDurationMs;
+  int brightness;            // -1 = auto
+};
+
+#define CS_INT(key, member, lo, hi) { key, JSON_PATCH_INT, offsetof(CountdownSettings, member), lo, hi }
+#define CS_BOOL(key, member)        { key, JSON_PATCH_BOOL, offsetof(CountdownSettings, member), 0, 1 }
+
+static const JsonPatchField countdownSettingsFields[] = {
+  { "title", JSON_PATCH_STRING, offsetof(CountdownSettings, title), 0, sizeof(CountdownSettings::title) },
+  CS_INT("year", year, 2000, 2099),          // plage de DateTime (RTClib)
+  CS_INT("month", month, 1, 12),
+  CS_INT("day", day, 1, 31),
+  CS_INT("hour", hour, 0, 23),
+  CS_INT("minute", minute, 0, 59),
+  CS_INT("second", second, 0, 59),
+  CS_INT("fontStyle", fontStyle, 0, 2),
+  CS_INT("colorR", colorR, 0, 255),
+  CS_INT("colorG", colorG, 0, 255),
+  CS_INT("colorB", colorB, 0, 255),
+  CS_INT("endColorR", endColorR, 0, 255),
+  CS_INT("endColorG", endColorG, 0, 255),
+  CS_INT("endColorB", endColorB, 0, 255),
+  CS_INT("endEffect", endEffect, 0, 3),
+  CS_BOOL("blinkEnabled", blinkEnabled),
+  CS_INT("blinkIntervalMs", blinkIntervalMs, 50, 5000),
+  CS_INT("blinkWindow", blinkWindow, 1, 3600),
+  CS_BOOL("marqueeEnabled", marqueeEnabled),
+  CS_INT("marqueeIntervalMs", marqueeIntervalMs, 5, 500),
+  CS_INT("marqueeGap", marqueeGap, 4, 256),
+  CS_INT("marqueeMode", marqueeMode, 0, 3),
+  CS_INT("marqueeReturnIntervalMs", marqueeReturnIntervalMs, 5, 500),
+  CS_INT("marqueeBouncePauseLeftMs", marqueeBouncePauseLeftMs, 0, 5000),
+  CS_INT("marqueeBouncePauseRightMs", marqueeBouncePauseRightMs, 0, 5000),
+  CS_INT("marqueeOneShotDelayMs", marqueeOneShotDelayMs, 0, 10000),
+  CS_BOOL("marqueeOneShotStopCenter", marqueeOneShotStopCenter),
+  CS_INT("marqueeOneShotRestartSec", marqueeOneShotRestartSec, 0, 86400),
+  CS_BOOL("marqueeAccelEnabled", marqueeAccelEnabled),
+  CS_INT("marqueeAccelStartIntervalMs", marqueeAccelStartIntervalMs, 5, 500),
+  CS_INT("marqueeAccelEndIntervalMs", marqueeAccelEndIntervalMs, 5, 500),
+  CS_INT("marqueeAccelDurationMs", marqueeAccelDurationMs, 50, 600000),
+  CS_INT("brightness", brightness, -1, 255),
+};
+
+#undef CS_INT
+#undef CS_BOOL
+
+inline int countdownDaysInMonth(int year, int month) {
+  static const uint8_t days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  return month == 2 && leap ? 29 : days[month - 1];
+}
+
+// Titre : UTF-8 valide (séquences complètes, pas de surlongueur)
+inline bool countdownTitleValid(const char *s) {
+  const uint8_t *p = (const uint8_t *)s;
+  while (*p) {
+    const uint8_t c = *p;
+    size_t n;
+    uint32_t cp;
+    if (c < 0x80) { p++; continue; }
+    if ((c & 0xE0) == 0xC0) { n = 1; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { n = 2; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { n = 3; cp = c & 0x07; }
+    else return false;
+    for (size_t k = 1; k <= n; k++) {
+      if ((p[k] & 0xC0) != 0x80) return false;
+      cp = cp << 6 | (p[k] & 0x3F);
+    }
+    static const uint32_t minimum[4] = { 0, 0x80, 0x800, 0x10000 };
+    if (cp < minimum[n] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return false;
+    p += n + 1;
+  }
+  return true;
+}
+
+// Applique json à staging puis valide l'ensemble ; nombre de champs reçus,
+// -1 si refusé (message dans err, staging à jeter)
+inline int countdownSettingsPatch(CountdownSettings &staging, const char *json, size_t len, char *err,
+                                  size_t errSize) {
+  const size_t count = sizeof(countdownSettingsFields) / sizeof(countdownSettingsFields[0]);
+  uint64_t present;
+  const int n = jsonPatchApply(json, len, countdownSettingsFields, count, &staging, err, errSize, &present);
+  if (n < 0) return -1;
+  JsonPatchReader r = { json, json + len, err, errSize };
+  if (staging.title[0] == '\0') { jsonPatchFail(r, "title", "vide"); return -1; }
+  if (!countdownTitleValid(staging.title)) { jsonPatchFail(r, "title", "UTF-8 invalide"); return -1; }
+  uint64_t date = 0;  // year, month, day
+  for (size_t i = 0; i < count; i++) {
+    const char *key = countdownSettingsFields[i].key;
+    if (strcmp(key, "year") == 0 || strcmp(key, "month") == 0 || strcmp(key, "day") == 0) date |= (uint64_t)1 << i;
+  }
+  if ((present & date) && staging.day > countdownDaysInMonth(staging.year, staging.month)) {
+    jsonPatchFail(r, "day", "hors du mois");
+    return -1;
+  }
+  return n;
+}
+
+// Tous les champs de s en JSON dans buf ; longueur, 0 si buf est trop petit
+inline size_t countdownSettingsToJson(const CountdownSettings &s, char *buf, size_t size) {
+  JsonWriter w;
+  jsonBegin(w, buf, size);
+  for (const JsonPatchField &f : countdownSettingsFields) {
+    const uint8_t *src = (const uint8_t *)&s + f.offset;
+    if (f.type == JSON_PATCH_STRING) {
+      jsonAddString(w, f.key, (const char *)src);
+    } else if (f.type == JSON_PATCH_BOOL) {
+      bool b;
+      memcpy(&b, src, sizeof(b));
+      jsonAddInt(w, f.key, b ? 1 : 0);
+    } else {
+      int v;
+      memcpy(&v, src, sizeof(v));
+      jsonAddInt(w, f.key, v);
+    }
+  }
+  return jsonEnd(w);
+}
+
+#endif // COUNTDOWNSETTINGS_H
@@ -513,4 +513,235 @@ const GFXfont DejaVuSans9pt8b PROGMEM = {
 #endif
 
 // Approx. 4863 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans9pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   3,   7,   5 },   // 0x21
+  {   1,   8,   7 },   // 0x22
+  {   1,  15,  13 },   // 0x23
+  {   1,  11,  10 },   // 0x24
+  {   1,  17,  16 },   // 0x25
+  {   1,  13,  13 },   // 0x26
+  {   1,   4,   3 },   // 0x27
+  {   2,   7,   6 },   // 0x28
+  {   1,   7,   5 },   // 0x29
+  {   1,   9,   8 },   // 0x2A
+  {   2,  15,  14 },   // 0x2B
+  {   1,   6,   4 },   // 0x2C
+  {   1,   7,   6 },   // 0x2D
+  {   2,   6,   4 },   // 0x2E
+  {   0,   6,   6 },   // 0x2F
+  {   1,  11,  10 },   // 0x30
+  {   2,  11,  10 },   // 0x31
+  {   1,  11,   9 },   // 0x32
+  {   1,  11,  10 },   // 0x33
+  {   1,  11,  11 },   // 0x34
+  {   1,  11,   9 },   // 0x35
+  {   1,  11,  10 },   // 0x36
+  {   1,  11,   9 },   // 0x37
+  {   1,  11,  10 },   // 0x38
+  {   1,  11,  10 },   // 0x39
+  {   2,   6,   4 },   // 0x3A
+  {   1,   6,   4 },   // 0x3B
+  {   2,  15,  13 },   // 0x3C
+  {   2,  15,  13 },   // 0x3D
+  {   2,  15,  13 },   // 0x3E
+  {   1,  10,   8 },   // 0x3F
+  {   1,  18,  17 },   // 0x40
+  {   0,  12,  12 },   // 0x41
+  {   2,  12,  11 },   // 0x42
+  {   1,  13,  12 },   // 0x43
+  {   2,  14,  13 },   // 0x44
+  {   2,  11,  10 },   // 0x45
+  {   2,  10,  10 },   // 0x46
+  {   1,  14,  12 },   // 0x47
+  {   2,  14,  12 },   // 0x48
+  {   2,   6,   4 },   // 0x49
+  {  -1,   6,   4 },   // 0x4A
+  {   2,  12,  13 },   // 0x4B
+  {   2,  10,  10 },   // 0x4C
+  {   2,  16,  14 },   // 0x4D
+  {   2,  14,  12 },   // 0x4E
+  {   1,  14,  13 },   // 0x4F
+  {   2,  11,  10 },   // 0x50
+  {   1,  14,  13 },   // 0x51
+  {   2,  13,  12 },   // 0x52
+  {   1,  11,  10 },   // 0x53
+  {   0,  12,  12 },   // 0x54
+  {   2,  14,  12 },   // 0x55
+  {   0,  12,  12 },   // 0x56
+  {   1,  19,  18 },   // 0x57
+  {   1,  13,  12 },   // 0x58
+  {   0,  12,  12 },   // 0x59
+  {   1,  13,  12 },   // 0x5A
+  {   1,   7,   5 },   // 0x5B
+  {   0,   6,   6 },   // 0x5C
+  {   2,   7,   6 },   // 0x5D
+  {   2,  15,  13 },   // 0x5E
+  {   0,   9,   9 },   // 0x5F
+  {   2,   9,   6 },   // 0x60
+  {   1,  10,   9 },   // 0x61
+  {   2,  11,  11 },   // 0x62
+  {   1,   9,   9 },   // 0x63
+  {   1,  11,  10 },   // 0x64
+  {   1,  11,  11 },   // 0x65
+  {   0,   6,   7 },   // 0x66
+  {   1,  11,  10 },   // 0x67
+  {   2,  11,  10 },   // 0x68
+  {   2,   5,   4 },   // 0x69
+  {   0,   5,   4 },   // 0x6A
+  {   2,  10,  11 },   // 0x6B
+  {   2,   5,   4 },   // 0x6C
+  {   2,  17,  16 },   // 0x6D
+  {   2,  11,  10 },   // 0x6E
+  {   1,  11,  11 },   // 0x6F
+  {   2,  11,  11 },   // 0x70
+  {   1,  11,  10 },   // 0x71
+  {   2,   8,   8 },   // 0x72
+  {   1,   8,   8 },   // 0x73
+  {   1,   7,   7 },   // 0x74
+  {   2,  11,  10 },   // 0x75
+  {   1,  11,  11 },   // 0x76
+  {   2,  16,  15 },   // 0x77
+  {   1,  11,  11 },   // 0x78
+  {   1,  11,  11 },   // 0x79
+  {   1,   9,   9 },   // 0x7A
+  {   2,  11,  10 },   // 0x7B
+  {   2,   6,   4 },   // 0x7C
+  {   2,  11,  10 },   // 0x7D
+  {   2,  15,  13 },   // 0x7E
+  {   1,  11,  10 },   // 0x7F
+  {   1,  11,  10 },   // 0x80
+  {   1,  11,  10 },   // 0x81
+  {   1,  11,  10 },   // 0x82
+  {   1,  11,  10 },   // 0x83
+  {   1,  11,  10 },   // 0x84
+  {   1,  11,  10 },   // 0x85
+  {   1,  11,  10 },   // 0x86
+  {   1,  11,  10 },   // 0x87
+  {   1,  11,  10 },   // 0x88
+  {   1,  11,  10 },   // 0x89
+  {   1,  11,  10 },   // 0x8A
+  {   1,  11,  10 },   // 0x8B
+  {   1,  11,  10 },   // 0x8C
+  {   1,  11,  10 },   // 0x8D
+  {   1,  11,  10 },   // 0x8E
+  {   1,  11,  10 },   // 0x8F
+  {   1,  11,  10 },   // 0x90
+  {   1,  11,  10 },   // 0x91
+  {   1,  11,  10 },   // 0x92
+  {   1,  11,  10 },   // 0x93
+  {   1,  11,  10 },   // 0x94
+  {   1,  11,  10 },   // 0x95
+  {   1,  11,  10 },   // 0x96
+  {   1,  11,  10 },   // 0x97
+  {   1,  11,  10 },   // 0x98
+  {   1,  11,  10 },   // 0x99
+  {   1,  11,  10 },   // 0x9A
+  {   1,  11,  10 },   // 0x9B
+  {   1,  11,  10 },   // 0x9C
+  {   1,  11,  10 },   // 0x9D
+  {   1,  11,  10 },   // 0x9E
+  {   1,  11,  10 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   3,   7,   5 },   // 0xA1
+  {   2,  11,  10 },   // 0xA2
+  {   1,  11,  10 },   // 0xA3
+  {   1,  11,  10 },   // 0xA4
+  {   1,  11,  11 },   // 0xA5
+  {   2,   6,   4 },   // 0xA6
+  {   1,   9,   8 },   // 0xA7
+  {   2,   9,   8 },   // 0xA8
+  {   2,  18,  15 },   // 0xA9
+  {   1,   8,   8 },   // 0xAA
+  {   1,  11,   9 },   // 0xAB
+  {   2,  15,  13 },   // 0xAC
+  {   1,   7,   6 },   // 0xAD
+  {   2,  18,  15 },   // 0xAE
+  {   2,   9,   7 },   // 0xAF
+  {   2,   9,   8 },   // 0xB0
+  {   2,  15,  14 },   // 0xB1
+  {   1,   7,   6 },   // 0xB2
+  {   1,   7,   6 },   // 0xB3
+  {   3,   9,   7 },   // 0xB4
+  {   2,  11,  11 },   // 0xB5
+  {   1,  11,   9 },   // 0xB6
+  {   2,   6,   4 },   // 0xB7
+  {   3,   9,   7 },   // 0xB8
+  {   1,   7,   6 },   // 0xB9
+  {   1,   8,   8 },   // 0xBA
+  {   2,  11,  10 },   // 0xBB
+  {   1,  17,  17 },   // 0xBC
+  {   1,  17,  16 },   // 0xBD
+  {   1,  17,  17 },   // 0xBE
+  {   2,  10,   9 },   // 0xBF
+  {   0,  12,  12 },   // 0xC0
+  {   0,  12,  12 },   // 0xC1
+  {   0,  12,  12 },   // 0xC2
+  {   0,  12,  12 },   // 0xC3
+  {   0,  12,  12 },   // 0xC4
+  {   0,  12,  12 },   // 0xC5
+  {   0,  17,  16 },   // 0xC6
+  {   1,  13,  12 },   // 0xC7
+  {   2,  11,  10 },   // 0xC8
+  {   2,  11,  10 },   // 0xC9
+  {   2,  11,  10 },   // 0xCA
+  {   2,  11,  10 },   // 0xCB
+  {   0,   6,   4 },   // 0xCC
+  {   1,   6,   4 },   // 0xCD
+  {   0,   6,   6 },   // 0xCE
+  {   0,   6,   6 },   // 0xCF
+  {   0,  14,  13 },   // 0xD0
+  {   2,  14,  12 },   // 0xD1
+  {   1,  14,  13 },   // 0xD2
+  {   1,  14,  13 },   // 0xD3
+  {   1,  14,  13 },   // 0xD4
+  {   1,  14,  13 },   // 0xD5
+  {   1,  14,  13 },   // 0xD6
+  {   2,  15,  12 },   // 0xD7
+  {   1,  14,  13 },   // 0xD8
+  {   2,  14,  12 },   // 0xD9
+  {   2,  14,  12 },   // 0xDA
+  {   2,  14,  12 },   // 0xDB
+  {   2,  14,  12 },   // 0xDC
+  {   0,  12,  12 },   // 0xDD
+  {   2,  11,  10 },   // 0xDE
+  {   2,  11,  11 },   // 0xDF
+  {   1,  10,   9 },   // 0xE0
+  {   1,  10,   9 },   // 0xE1
+  {   1,  10,   9 },   // 0xE2
+  {   1,  10,   9 },   // 0xE3
+  {   1,  10,   9 },   // 0xE4
+  {   1,  10,   9 },   // 0xE5
+  {   1,  17,  16 },   // 0xE6
+  {   1,   9,   9 },   // 0xE7
+  {   1,  11,  11 },   // 0xE8
+  {   1,  11,  11 },   // 0xE9
+  {   1,  11,  11 },   // 0xEA
+  {   1,  11,  11 },   // 0xEB
+  {   0,   5,   4 },   // 0xEC
+  {   1,   5,   5 },   // 0xED
+  {   0,   5,   6 },   // 0xEE
+  {   0,   5,   6 },   // 0xEF
+  {   1,  11,  11 },   // 0xF0
+  {   2,  11,  10 },   // 0xF1
+  {   1,  11,  11 },   // 0xF2
+  {   1,  11,  11 },   // 0xF3
+  {   1,  11,  11 },   // 0xF4
+  {   1,  11,  11 },   // 0xF5
+  {   1,  11,  11 },   // 0xF6
+  {   2,  15,  14 },   // 0xF7
+  {   1,  11,  11 },   // 0xF8
+  {   2,  11,  10 },   // 0xF9
+  {   2,  11,  10 },   // 0xFA
+  {   2,  11,  10 },   // 0xFB
+  {   2,  11,  10 },   // 0xFC
+  {   1,  11,  11 },   // 0xFD
+  {   2,  11,  11 },   // 0xFE
+  {   1,  11,  11 }    // 0xFF
+};
+const FontMetrics DejaVuSans9pt8bWidths = { DejaVuSans9pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
 #endif // DEJAVUSANS9PTLAT1__H
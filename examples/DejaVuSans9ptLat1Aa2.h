@@ -0,0 +1,802 @@
+#ifndef DEJAVUSANS9PT8BAA2_H
+#define DEJAVUSANS9PT8BAA2_H
+// Police anti-aliasée 2 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans9pt8bAa2Bitmaps[] PROGMEM = {
+  0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x24, 0x01, 0x1D, 0x74, 0x70, 0xD7,
+  0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD0, 0x00, 0x28, 0x38, 0x00, 0x0D, 0x0D,
+  0x00, 0x07, 0x07, 0x00, 0x01, 0xC2, 0xC0, 0x2F, 0xFF, 0xFF, 0x41, 0x79,
+  0x75, 0x40, 0x1C, 0x1C, 0x00, 0x0B, 0x0A, 0x00, 0xBF, 0xFF, 0xFD, 0x05,
+  0xE5, 0xD5, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x28, 0x00, 0x0A, 0x0A, 0x00,
+  0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x6F, 0xF8, 0x39, 0xD6,
+  0x1C, 0x30, 0x07, 0x4C, 0x00, 0xFB, 0x40, 0x0B, 0xFD, 0x00, 0x36, 0xD0,
+  0x0C, 0x38, 0x03, 0x0E, 0xA5, 0xDB, 0x4A, 0xFE, 0x40, 0x0C, 0x00, 0x03,
+  0x00, 0x00, 0x40, 0x00, 0x2F, 0x80, 0x0A, 0x02, 0xD7, 0x80, 0x74, 0x0D,
+  0x0A, 0x02, 0x80, 0x34, 0x2C, 0x1C, 0x00, 0xA0, 0xE0, 0xD0, 0x00, 0xBE,
+  0x0A, 0x00, 0x00, 0x00, 0x70, 0xB9, 0x00, 0x03, 0x4B, 0x5D, 0x00, 0x28,
+  0x34, 0x28, 0x01, 0xD0, 0xD0, 0xA0, 0x0A, 0x03, 0x42, 0x80, 0x70, 0x0A,
+  0x5D, 0x03, 0x40, 0x0B, 0xD0, 0x02, 0xF9, 0x00, 0x0F, 0x9B, 0x00, 0x1D,
+  0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x38,
+  0xF0, 0x0E, 0xB0, 0x3C, 0x1D, 0xE0, 0x1F, 0x2C, 0xB0, 0x07, 0xF4, 0xB4,
+  0x01, 0xF0, 0x2E, 0x5B, 0xB8, 0x0B, 0xF9, 0x1E, 0x77, 0x77, 0x70, 0x07,
+  0x42, 0x81, 0xD0, 0xB0, 0x38, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07,
+  0x40, 0xE0, 0x2C, 0x07, 0x40, 0xA0, 0x1D, 0x70, 0x0E, 0x01, 0xC0, 0x34,
+  0x0A, 0x02, 0xC0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0xB0, 0x28, 0x0D, 0x07,
+  0x03, 0x81, 0xC0, 0x00, 0xC0, 0x10, 0xC1, 0x78, 0xCA, 0x07, 0xF4, 0x07,
+  0xE4, 0x29, 0xDA, 0x10, 0xC1, 0x00, 0xC0, 0x00, 0x10, 0x00, 0x01, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xD0, 0x0F,
+  0xFF, 0xFF, 0xD5, 0x6D, 0x55, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07,
+  0x00, 0x00, 0x1C, 0x00, 0x14, 0xF3, 0x9D, 0xA0, 0xFF, 0x95, 0x40, 0x4E,
+  0xE0, 0x00, 0xA0, 0x0D, 0x01, 0xC0, 0x2C, 0x03, 0x80, 0x74, 0x0B, 0x00,
+  0xE0, 0x0D, 0x01, 0xC0, 0x28, 0x03, 0x40, 0x70, 0x0A, 0x00, 0x50, 0x00,
+  0x07, 0xF8, 0x0B, 0x9B, 0x83, 0x80, 0xB5, 0xD0, 0x0E, 0xB0, 0x03, 0xEC,
+  0x00, 0xBF, 0x00, 0x2E, 0xC0, 0x0B, 0xB0, 0x03, 0xDD, 0x00, 0xE3, 0x80,
+  0xB4, 0xB9, 0xB8, 0x07, 0xF8, 0x00, 0x6F, 0x80, 0xFB, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x57, 0xD5, 0xBF, 0xFE, 0x2B, 0xE4, 0x2E, 0xAF,
+  0x84, 0x00, 0xB4, 0x00, 0x1D, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x02, 0xD0,
+  0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xE5, 0x55, 0xBF,
+  0xFF, 0x40, 0x2B, 0xF8, 0x1E, 0xAB, 0xC0, 0x00, 0x74, 0x00, 0x1D, 0x00,
+  0x1F, 0x41, 0xFF, 0x40, 0x16, 0xD0, 0x00, 0x1D, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x00, 0xBA, 0xEA, 0xBC, 0x6F, 0xE8, 0x00, 0x00, 0x3D, 0x00, 0x0B,
+  0xD0, 0x01, 0xDD, 0x00, 0x39, 0xD0, 0x0B, 0x1D, 0x01, 0xD1, 0xD0, 0x28,
+  0x1D, 0x07, 0x01, 0xD0, 0xE0, 0x1D, 0x0F, 0xFF, 0xFD, 0x55, 0x6E, 0x40,
+  0x01, 0xD0, 0x00, 0x1D, 0x00, 0x3F, 0xFE, 0x0E, 0x55, 0x43, 0x80, 0x00,
+  0xE0, 0x00, 0x3F, 0xF8, 0x09, 0x5B, 0x80, 0x00, 0xB4, 0x00, 0x1E, 0x00,
+  0x03, 0x80, 0x01, 0xE0, 0x00, 0xB6, 0xEA, 0xF8, 0x6F, 0xE4, 0x00, 0x02,
+  0xFE, 0x03, 0xEA, 0x92, 0xD0, 0x01, 0xD0, 0x00, 0xB6, 0xF9, 0x2F, 0x97,
+  0xDB, 0x80, 0x3A, 0xD0, 0x0B, 0xB4, 0x02, 0xDD, 0x00, 0xB3, 0x80, 0x78,
+  0x79, 0xBD, 0x06, 0xF9, 0x00, 0xBF, 0xFF, 0x95, 0x56, 0xD0, 0x00, 0xB0,
+  0x00, 0x38, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x02, 0xC0, 0x00,
+  0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x0B,
+  0xF9, 0x0F, 0x9B, 0xD7, 0x40, 0x79, 0xD0, 0x0E, 0x7D, 0x1B, 0x07, 0xFF,
+  0x01, 0xA5, 0xF1, 0xD0, 0x0E, 0xB0, 0x02, 0xEC, 0x00, 0xBB, 0x40, 0x78,
+  0xF9, 0xBD, 0x0B, 0xF9, 0x00, 0x0B, 0xF4, 0x0F, 0x9B, 0x8B, 0x40, 0xB7,
+  0xC0, 0x0E, 0xF0, 0x03, 0xAC, 0x01, 0xF7, 0xD1, 0xFC, 0x7F, 0xEF, 0x01,
+  0x43, 0x80, 0x01, 0xD0, 0x00, 0xF0, 0xEA, 0xF4, 0x2F, 0xE4, 0x00, 0x5F,
+  0xF0, 0x00, 0x05, 0xFF, 0x14, 0xF3, 0xC0, 0x00, 0x00, 0x05, 0x3C, 0xE7,
+  0x68, 0x00, 0x00, 0x04, 0x00, 0x01, 0xF0, 0x01, 0xBE, 0x41, 0xBE, 0x40,
+  0xBF, 0x80, 0x03, 0xE0, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x6F, 0x90, 0x00,
+  0x1B, 0xF8, 0x00, 0x01, 0xB0, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x50, 0xE4, 0x00,
+  0x01, 0xBE, 0x40, 0x00, 0x2F, 0xE4, 0x00, 0x06, 0xF9, 0x00, 0x01, 0xBC,
+  0x00, 0x6F, 0x90, 0x6F, 0x90, 0x2F, 0xD0, 0x00, 0xE4, 0x00, 0x00, 0x2F,
+  0xE2, 0xE6, 0xE4, 0x02, 0xC0, 0x0B, 0x00, 0x78, 0x07, 0x80, 0x38, 0x02,
+  0xC0, 0x0B, 0x00, 0x18, 0x00, 0x10, 0x02, 0xC0, 0x0B, 0x00, 0x00, 0x6F,
+  0xF9, 0x00, 0x02, 0xE5, 0x5B, 0x80, 0x0B, 0x40, 0x01, 0xA0, 0x2C, 0x00,
+  0x00, 0x38, 0x74, 0x1F, 0xD9, 0x1C, 0xA0, 0x79, 0x7D, 0x0D, 0xA0, 0xA0,
+  0x0D, 0x0D, 0x90, 0xA0, 0x0D, 0x0D, 0x90, 0xA0, 0x0D, 0x1C, 0xA0, 0x74,
+  0x2E, 0x74, 0x70, 0x1F, 0xEB, 0xD0, 0x28, 0x01, 0x00, 0x00, 0x0E, 0x00,
+  0x01, 0x00, 0x03, 0xD4, 0x1B, 0x80, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x01,
+  0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB, 0x00, 0x01,
+  0xD7, 0x40, 0x02, 0xC3, 0x80, 0x03, 0x81, 0xC0, 0x07, 0x40, 0xD0, 0x0B,
+  0x00, 0xB0, 0x0F, 0xFF, 0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00, 0x2C, 0x74,
+  0x00, 0x1D, 0xB0, 0x00, 0x0E, 0x7F, 0xFE, 0x07, 0x95, 0xBC, 0x74, 0x02,
+  0xD7, 0x40, 0x2D, 0x78, 0x07, 0x87, 0xFF, 0xE0, 0x79, 0x5B, 0x87, 0x40,
+  0x1D, 0x74, 0x00, 0xE7, 0x40, 0x0E, 0x74, 0x01, 0xE7, 0x95, 0xBC, 0x7F,
+  0xFE, 0x00, 0x01, 0xBF, 0x90, 0x3E, 0x9B, 0xD3, 0xD0, 0x01, 0x5D, 0x00,
+  0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xB0, 0x00, 0x01, 0xD0, 0x00, 0x03, 0xD0, 0x01, 0x47, 0xE9, 0xBD, 0x01,
+  0xBF, 0x90, 0x7F, 0xFA, 0x40, 0x79, 0x6B, 0xE0, 0x74, 0x00, 0xB8, 0x74,
+  0x00, 0x3C, 0x74, 0x00, 0x2D, 0x74, 0x00, 0x1D, 0x74, 0x00, 0x1E, 0x74,
+  0x00, 0x1D, 0x74, 0x00, 0x2D, 0x74, 0x00, 0x3C, 0x74, 0x00, 0xB8, 0x79,
+  0x6B, 0xE0, 0x7F, 0xFA, 0x40, 0x7F, 0xFF, 0xDE, 0x55, 0x57, 0x40, 0x01,
+  0xD0, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xE7, 0x95, 0x55, 0xD0, 0x00, 0x74,
+  0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xE5, 0x55, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xFF, 0x79, 0x55, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7F, 0xFE, 0x79,
+  0x55, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74,
+  0x00, 0x01, 0xBF, 0x90, 0x0F, 0xA6, 0xB8, 0x3D, 0x00, 0x08, 0x74, 0x00,
+  0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x07, 0xFD, 0xF0, 0x01,
+  0x6D, 0xB0, 0x00, 0x2D, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x2D, 0x0F, 0xA6,
+  0xBC, 0x01, 0xBF, 0x90, 0x74, 0x00, 0x79, 0xD0, 0x01, 0xE7, 0x40, 0x07,
+  0x9D, 0x00, 0x1E, 0x78, 0x00, 0x79, 0xFF, 0xFF, 0xE7, 0x95, 0x57, 0x9D,
+  0x00, 0x1E, 0x74, 0x00, 0x79, 0xD0, 0x01, 0xE7, 0x40, 0x07, 0x9D, 0x00,
+  0x1E, 0x74, 0x00, 0x78, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7,
+  0x5D, 0x74, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D,
+  0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0xB5, 0xB8, 0xF8, 0x00,
+  0x74, 0x01, 0xF1, 0xD0, 0x1E, 0x07, 0x41, 0xE0, 0x1D, 0x1E, 0x00, 0x75,
+  0xE0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1E, 0xB8, 0x00, 0x74, 0xB4,
+  0x01, 0xD0, 0xB4, 0x07, 0x40, 0xB4, 0x1D, 0x00, 0xB4, 0x74, 0x00, 0xB4,
+  0x74, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x1D,
+  0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x07, 0x40,
+  0x01, 0xE5, 0x55, 0x7F, 0xFF, 0x80, 0x7D, 0x00, 0x1F, 0x5F, 0xC0, 0x0B,
+  0xD7, 0xB4, 0x03, 0xB5, 0xDE, 0x01, 0xDD, 0x75, 0xC0, 0xA7, 0x5D, 0x34,
+  0x35, 0xD7, 0x4A, 0x2C, 0x75, 0xD1, 0xCE, 0x1D, 0x74, 0x3B, 0x47, 0x5D,
+  0x0B, 0xC1, 0xD7, 0x41, 0x90, 0x75, 0xD0, 0x00, 0x1D, 0x74, 0x00, 0x07,
+  0x40, 0x7D, 0x00, 0x75, 0xFC, 0x01, 0xD7, 0xB4, 0x07, 0x5D, 0xF0, 0x1D,
+  0x75, 0xD0, 0x75, 0xD2, 0xC1, 0xD7, 0x47, 0x47, 0x5D, 0x0B, 0x1D, 0x74,
+  0x1E, 0x75, 0xD0, 0x2D, 0xD7, 0x40, 0x7B, 0x5D, 0x00, 0xBD, 0x74, 0x00,
+  0xF4, 0x02, 0xBE, 0x40, 0x1F, 0x96, 0xF0, 0x3D, 0x00, 0x78, 0x78, 0x00,
+  0x2D, 0xB0, 0x00, 0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0E, 0xB0, 0x00, 0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96,
+  0xF0, 0x02, 0xFE, 0x40, 0x7F, 0xF9, 0x1E, 0x5B, 0xD7, 0x40, 0x7D, 0xD0,
+  0x0F, 0x74, 0x03, 0xDE, 0x06, 0xE7, 0xFF, 0xE1, 0xE5, 0x40, 0x74, 0x00,
+  0x1D, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x00, 0x02, 0xBE,
+  0x40, 0x1F, 0x96, 0xE0, 0x3D, 0x00, 0x78, 0x78, 0x00, 0x2D, 0xB0, 0x00,
+  0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0E, 0xB0, 0x00,
+  0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96, 0xE0, 0x02, 0xFF,
+  0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF4, 0x7F, 0xF9, 0x01, 0xE5, 0xBD,
+  0x07, 0x40, 0x3C, 0x1D, 0x00, 0xF0, 0x74, 0x03, 0xC1, 0xE0, 0x6E, 0x07,
+  0xFF, 0xE0, 0x1E, 0x5B, 0x80, 0x74, 0x07, 0x41, 0xD0, 0x0B, 0x07, 0x40,
+  0x1D, 0x1D, 0x00, 0x3C, 0x74, 0x00, 0x74, 0x0B, 0xFA, 0x47, 0xE6, 0xB4,
+  0xB4, 0x00, 0x0B, 0x00, 0x00, 0xB4, 0x00, 0x07, 0xE9, 0x00, 0x0B, 0xFE,
+  0x00, 0x01, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x40, 0x03, 0xCB, 0x96,
+  0xF4, 0x6B, 0xF9, 0x00, 0xFF, 0xFF, 0xF9, 0x56, 0xE5, 0x50, 0x07, 0x40,
+  0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00,
+  0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D,
+  0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x75, 0xD0, 0x01, 0xD7, 0x40, 0x07,
+  0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x01, 0xD7, 0x40, 0x07, 0x5D,
+  0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x02, 0xD3, 0xC0, 0x0F, 0x07, 0xE6,
+  0xF4, 0x06, 0xFE, 0x40, 0xB0, 0x00, 0x0E, 0x78, 0x00, 0x1D, 0x3C, 0x00,
+  0x2C, 0x2D, 0x00, 0x78, 0x0E, 0x00, 0xB4, 0x0B, 0x00, 0xF0, 0x07, 0x41,
+  0xD0, 0x03, 0x82, 0xC0, 0x02, 0xC3, 0x80, 0x01, 0xD7, 0x40, 0x00, 0xFB,
+  0x00, 0x00, 0xBE, 0x00, 0x00, 0x3D, 0x00, 0x74, 0x01, 0xE0, 0x03, 0x8E,
+  0x00, 0xBC, 0x01, 0xD2, 0xC0, 0x3B, 0x40, 0xB4, 0xB4, 0x0D, 0xE0, 0x2C,
+  0x1D, 0x07, 0x28, 0x0E, 0x03, 0x82, 0x87, 0x07, 0x40, 0xB0, 0xE0, 0xD2,
+  0xD0, 0x2D, 0x34, 0x38, 0xB0, 0x07, 0x5C, 0x0A, 0x38, 0x00, 0xEB, 0x01,
+  0xDD, 0x00, 0x2F, 0x80, 0x7B, 0x40, 0x0B, 0xD0, 0x0F, 0xC0, 0x01, 0xF0,
+  0x02, 0xE0, 0x00, 0xB4, 0x00, 0xF0, 0xF0, 0x0B, 0x41, 0xE0, 0x78, 0x02,
+  0xD3, 0xC0, 0x03, 0xED, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBF,
+  0x00, 0x0B, 0x5E, 0x00, 0x78, 0x2D, 0x02, 0xC0, 0x3C, 0x1D, 0x00, 0x78,
+  0xE0, 0x00, 0xB4, 0xB4, 0x00, 0x74, 0xE0, 0x03, 0x81, 0xD0, 0x2C, 0x02,
+  0xD1, 0xD0, 0x03, 0x8E, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x1D,
+  0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00,
+  0x00, 0x74, 0x00, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0xBC, 0x00, 0x00, 0xF4,
+  0x00, 0x02, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF4, 0x00, 0x02, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x3E, 0x55, 0x54, 0x7F, 0xFF, 0xFD, 0x7F, 0x75, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7F, 0x15, 0xE0,
+  0x0B, 0x00, 0x74, 0x03, 0x80, 0x2C, 0x01, 0xC0, 0x0D, 0x00, 0xA0, 0x07,
+  0x00, 0x34, 0x02, 0x80, 0x1C, 0x00, 0xD0, 0x0E, 0x00, 0x50, 0x7F, 0x45,
+  0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74,
+  0x1D, 0x07, 0x41, 0xD0, 0x75, 0xFD, 0x15, 0x00, 0x00, 0xF8, 0x00, 0x0B,
+  0xB8, 0x00, 0xB4, 0x78, 0x0B, 0x40, 0x78, 0xB4, 0x00, 0x74, 0x7F, 0xFF,
+  0xF1, 0x55, 0x55, 0x80, 0xA0, 0x38, 0x1D, 0x2B, 0xE4, 0x1E, 0x5B, 0x40,
+  0x00, 0xB0, 0x00, 0x1C, 0x1B, 0xFF, 0x5E, 0x56, 0xDE, 0x00, 0xB7, 0x80,
+  0x3D, 0xB9, 0x7B, 0x4B, 0xF5, 0xD0, 0x74, 0x00, 0x07, 0x40, 0x00, 0x74,
+  0x00, 0x07, 0x40, 0x00, 0x76, 0xF9, 0x07, 0xA5, 0xF4, 0x78, 0x03, 0x87,
+  0x40, 0x2C, 0x74, 0x01, 0xD7, 0x40, 0x1D, 0x74, 0x02, 0xC7, 0x80, 0x38,
+  0x7A, 0x5F, 0x47, 0x6F, 0x90, 0x0B, 0xF9, 0x2E, 0x5A, 0xB4, 0x00, 0xF0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x2E, 0x5A, 0x0B,
+  0xF9, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x0B, 0xE3,
+  0x8F, 0x9A, 0xEB, 0x40, 0xBB, 0x80, 0x1E, 0xE0, 0x03, 0xB8, 0x00, 0xEE,
+  0x00, 0x7A, 0xD0, 0x2E, 0x3E, 0x6B, 0x82, 0xF8, 0xE0, 0x0B, 0xF8, 0x0B,
+  0x9B, 0xC7, 0x40, 0x3B, 0x80, 0x0A, 0xFF, 0xFF, 0xF9, 0x55, 0x5F, 0x00,
+  0x02, 0xD0, 0x00, 0x2E, 0x5B, 0x81, 0xBF, 0x90, 0x02, 0xF8, 0x2D, 0x50,
+  0xE0, 0x03, 0x80, 0xBF, 0xF0, 0x79, 0x40, 0xE0, 0x03, 0x80, 0x0E, 0x00,
+  0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x0B, 0xE3, 0x8F,
+  0x9A, 0xEB, 0x40, 0xBB, 0x80, 0x1E, 0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00,
+  0x7A, 0xD0, 0x2E, 0x3E, 0x6B, 0x82, 0xF8, 0xE0, 0x00, 0x74, 0x00, 0x2D,
+  0x29, 0x6E, 0x0B, 0xFD, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01,
+  0xD0, 0x00, 0x75, 0xF9, 0x1E, 0x97, 0xC7, 0x80, 0x75, 0xD0, 0x0E, 0x74,
+  0x03, 0x9D, 0x00, 0xE7, 0x40, 0x39, 0xD0, 0x0E, 0x74, 0x03, 0x9D, 0x00,
+  0xE0, 0x75, 0xD0, 0x00, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD0,
+  0x07, 0x41, 0xD0, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41,
+  0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1C, 0x1F, 0x1E, 0x40, 0x74,
+  0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x0B, 0x5D, 0x0B,
+  0x47, 0x4B, 0x41, 0xDB, 0x40, 0x7F, 0x00, 0x1E, 0xE0, 0x07, 0x5E, 0x01,
+  0xD1, 0xE0, 0x74, 0x1E, 0x1D, 0x01, 0xE0, 0x75, 0xD7, 0x5D, 0x75, 0xD7,
+  0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD0, 0x76, 0xF8, 0x1F, 0xD1, 0xE9, 0xBD,
+  0xE7, 0xC7, 0x80, 0x7C, 0x07, 0x5D, 0x01, 0xE0, 0x0E, 0x74, 0x03, 0x40,
+  0x39, 0xD0, 0x0D, 0x00, 0xE7, 0x40, 0x34, 0x03, 0x9D, 0x00, 0xD0, 0x0E,
+  0x74, 0x03, 0x40, 0x39, 0xD0, 0x0D, 0x00, 0xE0, 0x76, 0xF9, 0x1F, 0x96,
+  0xC7, 0x80, 0x75, 0xD0, 0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE7, 0x40, 0x39,
+  0xD0, 0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE0, 0x0B, 0xF8, 0x0F, 0x9B, 0x8B,
+  0x40, 0xB7, 0xC0, 0x0E, 0xE0, 0x03, 0xB8, 0x00, 0xEF, 0x00, 0x3A, 0xD0,
+  0x2D, 0x3E, 0x6E, 0x02, 0xFE, 0x00, 0x76, 0xF9, 0x07, 0xE1, 0xB4, 0x78,
+  0x03, 0x87, 0x40, 0x2C, 0x74, 0x01, 0xD7, 0x40, 0x1D, 0x74, 0x02, 0xC7,
+  0xC0, 0x38, 0x7A, 0x5F, 0x47, 0x6F, 0x90, 0x74, 0x00, 0x07, 0x40, 0x00,
+  0x74, 0x00, 0x07, 0x40, 0x00, 0x0B, 0xE3, 0x8F, 0x9A, 0xEB, 0x40, 0xBB,
+  0x80, 0x1E, 0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00, 0x7A, 0xD0, 0x2E, 0x3E,
+  0x6B, 0x82, 0xF8, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x76, 0xF5, 0xF9, 0x47, 0x80, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x07,
+  0x40, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x00, 0x2F, 0xE4, 0xB9, 0x68, 0xE0,
+  0x00, 0xF0, 0x00, 0x7F, 0x90, 0x06, 0xF8, 0x00, 0x2D, 0x00, 0x1D, 0xE5,
+  0xBC, 0xAF, 0xE0, 0x18, 0x00, 0x74, 0x01, 0xD0, 0x2F, 0xFD, 0x2D, 0x50,
+  0x74, 0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x03, 0x94,
+  0x07, 0xF4, 0xB0, 0x03, 0xAC, 0x00, 0xEB, 0x00, 0x3A, 0xC0, 0x0E, 0xB0,
+  0x03, 0x9C, 0x00, 0xE7, 0x00, 0x79, 0xD0, 0x2E, 0x3E, 0x6B, 0x82, 0xF8,
+  0xE0, 0x74, 0x00, 0xE3, 0x80, 0x1D, 0x2C, 0x02, 0xC1, 0xD0, 0x38, 0x0E,
+  0x07, 0x40, 0x74, 0xB0, 0x03, 0x8E, 0x00, 0x2D, 0xD0, 0x01, 0xFC, 0x00,
+  0x0F, 0x40, 0xD0, 0x3D, 0x03, 0xB8, 0x0F, 0x81, 0xDB, 0x07, 0xA0, 0xB1,
+  0xD2, 0x9C, 0x28, 0x34, 0xE3, 0x4E, 0x0E, 0x34, 0xE7, 0x42, 0xDC, 0x2A,
+  0xC0, 0x7E, 0x07, 0xE0, 0x0F, 0x80, 0xF8, 0x03, 0xD0, 0x3D, 0x00, 0x2C,
+  0x02, 0xD0, 0xE0, 0x78, 0x07, 0x4F, 0x00, 0x2E, 0xD0, 0x00, 0xF4, 0x00,
+  0x1F, 0x80, 0x03, 0xED, 0x00, 0xB4, 0xB0, 0x1D, 0x03, 0x87, 0x80, 0x1E,
+  0x74, 0x00, 0xE3, 0x80, 0x1D, 0x2C, 0x02, 0xC0, 0xE0, 0x38, 0x0B, 0x07,
+  0x40, 0x74, 0xE0, 0x03, 0x9D, 0x00, 0x2E, 0xC0, 0x01, 0xF8, 0x00, 0x0B,
+  0x40, 0x00, 0xB0, 0x00, 0x1E, 0x00, 0x16, 0xC0, 0x02, 0xF4, 0x00, 0x3F,
+  0xFF, 0x85, 0x56, 0xD0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xB4,
+  0x00, 0xB4, 0x00, 0x78, 0x00, 0x3D, 0x55, 0x1F, 0xFF, 0xE0, 0x01, 0xBC,
+  0x0F, 0x50, 0x38, 0x00, 0xD0, 0x03, 0x40, 0x0D, 0x00, 0x74, 0x02, 0xC0,
+  0xBD, 0x01, 0x6C, 0x00, 0x74, 0x00, 0xD0, 0x03, 0x40, 0x0E, 0x00, 0x38,
+  0x00, 0x7F, 0x00, 0x14, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xB9, 0x01, 0x6C, 0x00, 0x74, 0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00,
+  0x74, 0x00, 0xF4, 0x01, 0xFC, 0x0F, 0x50, 0x74, 0x01, 0xD0, 0x07, 0x40,
+  0x1D, 0x00, 0xB4, 0x2F, 0x80, 0x50, 0x00, 0x6F, 0xE4, 0x6F, 0x96, 0xFF,
+  0xD0, 0x00, 0x14, 0x00, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0x75, 0xD1, 0x00, 0x25, 0xD7, 0x5D, 0x75, 0xD7,
+  0x5D, 0x74, 0x00, 0x10, 0x00, 0x60, 0x00, 0x60, 0x06, 0xFE, 0x1F, 0xA6,
+  0x3C, 0x60, 0x74, 0x60, 0x74, 0x60, 0x74, 0x60, 0x74, 0x60, 0x38, 0x60,
+  0x2E, 0x66, 0x0B, 0xFF, 0x00, 0x64, 0x00, 0x60, 0x00, 0x20, 0x01, 0xBE,
+  0x41, 0xF5, 0x90, 0xB0, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x0B,
+  0xFF, 0xD0, 0x7D, 0x50, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0x7D,
+  0x55, 0xFF, 0xFF, 0x80, 0xA0, 0x01, 0xD7, 0xBF, 0xB8, 0x2E, 0x6E, 0x02,
+  0x80, 0x70, 0x34, 0x03, 0x43, 0x80, 0x70, 0x2D, 0x1E, 0x07, 0xBF, 0xB4,
+  0xE0, 0x41, 0xC0, 0xE0, 0x01, 0xD7, 0x00, 0x38, 0x38, 0x07, 0x01, 0xD0,
+  0xE0, 0x0E, 0x2C, 0x0B, 0xF7, 0xFC, 0x02, 0xF0, 0x00, 0x1E, 0x00, 0xBF,
+  0xFF, 0xC0, 0x1E, 0x00, 0x01, 0xD0, 0x00, 0x1D, 0x00, 0x01, 0xD0, 0x00,
+  0x5A, 0xAA, 0xAA, 0xA0, 0x05, 0xAA, 0xAA, 0xAA, 0x1F, 0xE1, 0xE5, 0x8B,
+  0x00, 0x1D, 0x00, 0x3E, 0x02, 0xDF, 0x4D, 0x0B, 0x74, 0x0B, 0xB4, 0x1C,
+  0xB9, 0xD0, 0x7E, 0x00, 0x2D, 0x00, 0x75, 0x42, 0xD7, 0xFD, 0x00, 0x40,
+  0x92, 0xB8, 0xB0, 0x00, 0x6F, 0x90, 0x01, 0xD0, 0x1A, 0x01, 0xC6, 0xF9,
+  0x60, 0x97, 0x91, 0x49, 0x62, 0x80, 0x00, 0xD4, 0xD0, 0x00, 0x29, 0x34,
+  0x00, 0x09, 0x4A, 0x00, 0x02, 0x61, 0xD0, 0x00, 0xC9, 0x1F, 0xF4, 0x91,
+  0xD0, 0x00, 0x60, 0x1D, 0x01, 0xA0, 0x00, 0x6F, 0x90, 0x00, 0x6F, 0x85,
+  0x0A, 0x00, 0x76, 0xFF, 0xE0, 0x7E, 0x0B, 0x7E, 0x70, 0x00, 0xBF, 0xF0,
+  0x01, 0x42, 0x0B, 0x4B, 0x2D, 0x2C, 0xB4, 0xA0, 0x78, 0x74, 0x1E, 0x1D,
+  0x03, 0x47, 0x00, 0x41, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0xB0, 0x00, 0x02,
+  0xC0, 0x00, 0x0B, 0x00, 0x00, 0x18, 0xFF, 0x95, 0x40, 0x00, 0x6F, 0x90,
+  0x01, 0xD0, 0x1A, 0x01, 0xC0, 0x00, 0x60, 0x92, 0xFE, 0x09, 0x60, 0xA0,
+  0xE0, 0xD4, 0x28, 0x38, 0x29, 0x0B, 0xF8, 0x09, 0x42, 0x8A, 0x02, 0x60,
+  0xA0, 0xD0, 0xC9, 0x28, 0x2C, 0x91, 0xD0, 0x00, 0x60, 0x1D, 0x01, 0xA0,
+  0x00, 0x6F, 0x90, 0x00, 0x7F, 0xF1, 0x55, 0x1B, 0x83, 0x5A, 0x60, 0x33,
+  0x47, 0x1F, 0xD0, 0x00, 0x10, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00,
+  0x1D, 0x00, 0xFF, 0xFF, 0xFD, 0x56, 0xD5, 0x50, 0x07, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x7F, 0xFF, 0xFF,
+  0x2F, 0x91, 0x0A, 0x00, 0xA0, 0x1C, 0x07, 0x42, 0xC0, 0x7F, 0xF0, 0xBE,
+  0x40, 0xB0, 0x28, 0xBD, 0x01, 0xC0, 0x7B, 0xE4, 0x05, 0x0E, 0x28, 0x70,
+  0xB0, 0x03, 0x8B, 0x00, 0x38, 0xB0, 0x03, 0x8B, 0x00, 0x38, 0xB0, 0x03,
+  0x8B, 0x00, 0x38, 0xB0, 0x03, 0x8B, 0x40, 0x78, 0xBE, 0x6F, 0xDB, 0x6F,
+  0x6E, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0x0B,
+  0xFF, 0x4F, 0xF4, 0xD7, 0xFD, 0x36, 0xFF, 0x4D, 0x7F, 0xD3, 0x4F, 0xF4,
+  0xD1, 0xFD, 0x34, 0x02, 0x4D, 0x00, 0x93, 0x40, 0x24, 0xD0, 0x09, 0x34,
+  0x02, 0x4D, 0x00, 0x93, 0x40, 0x24, 0xD0, 0x05, 0x24, 0x4E, 0xE0, 0x04,
+  0x06, 0x07, 0x7E, 0xBD, 0x13, 0x40, 0xD0, 0x34, 0x0D, 0x03, 0x4B, 0xFC,
+  0x2F, 0x82, 0xC2, 0xCD, 0x03, 0x74, 0x0D, 0xD0, 0x36, 0xC2, 0xC2, 0xF8,
+  0x00, 0x00, 0xBF, 0xF0, 0x50, 0x90, 0x1E, 0x1D, 0x01, 0xE1, 0xD0, 0x0E,
+  0x1D, 0x0B, 0x4B, 0x0B, 0x4A, 0x07, 0x4A, 0x01, 0x01, 0x00, 0x59, 0x00,
+  0x02, 0x00, 0xAD, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x0D, 0x00,
+  0x34, 0x00, 0x0D, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0xD0, 0x00, 0x0D, 0x02,
+  0x80, 0x24, 0xBF, 0xC7, 0x00, 0xB4, 0x00, 0x0D, 0x02, 0x74, 0x00, 0x2C,
+  0x06, 0x34, 0x00, 0x34, 0x18, 0x34, 0x00, 0xA0, 0x1F, 0xFD, 0x01, 0xC0,
+  0x00, 0x34, 0x02, 0x40, 0x00, 0x24, 0xBD, 0x00, 0x07, 0x01, 0x74, 0x00,
+  0x34, 0x00, 0xD0, 0x02, 0x80, 0x03, 0x40, 0x1C, 0x00, 0x0D, 0x00, 0xD0,
+  0x00, 0x34, 0x0A, 0x00, 0x0B, 0xFC, 0x74, 0xFE, 0x00, 0x02, 0x80, 0x0A,
+  0x00, 0x1C, 0x00, 0x28, 0x00, 0xD0, 0x01, 0xC0, 0x0A, 0x00, 0x1D, 0x00,
+  0x70, 0x02, 0x80, 0x02, 0x80, 0x1F, 0xFC, 0xBE, 0x40, 0x07, 0x00, 0x42,
+  0xC0, 0x0D, 0x00, 0x02, 0xC0, 0x28, 0x00, 0x2F, 0x40, 0x34, 0x00, 0x02,
+  0x80, 0xA0, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x42, 0xC3, 0x80, 0x64, 0xBE,
+  0x47, 0x00, 0xB4, 0x00, 0x0D, 0x02, 0x74, 0x00, 0x28, 0x06, 0x34, 0x00,
+  0x74, 0x18, 0x34, 0x00, 0xA0, 0x1F, 0xFD, 0x01, 0xC0, 0x00, 0x34, 0x02,
+  0x40, 0x00, 0x24, 0x02, 0xC0, 0x0B, 0x00, 0x04, 0x00, 0x50, 0x02, 0xC0,
+  0x0B, 0x00, 0x38, 0x03, 0xD0, 0x2D, 0x01, 0xD0, 0x0B, 0x00, 0x2D, 0x01,
+  0x7E, 0x6C, 0x6F, 0x90, 0x00, 0x50, 0x00, 0x00, 0x74, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB,
+  0x00, 0x01, 0xD7, 0x40, 0x02, 0xC3, 0x80, 0x03, 0x81, 0xC0, 0x07, 0x40,
+  0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xFF, 0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00,
+  0x2C, 0x74, 0x00, 0x1D, 0xB0, 0x00, 0x0E, 0x00, 0x05, 0x00, 0x00, 0x1D,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBE,
+  0x00, 0x00, 0xEB, 0x00, 0x01, 0xD7, 0x40, 0x02, 0xC3, 0x80, 0x03, 0x81,
+  0xC0, 0x07, 0x40, 0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xFF, 0xF4, 0x2D, 0x55,
+  0x78, 0x38, 0x00, 0x2C, 0x74, 0x00, 0x1D, 0xB0, 0x00, 0x0E, 0x00, 0x14,
+  0x00, 0x00, 0xAA, 0x00, 0x01, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D,
+  0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB, 0x00, 0x01, 0xD7, 0x40, 0x02, 0xC3,
+  0x80, 0x03, 0x81, 0xC0, 0x07, 0x40, 0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xFF,
+  0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00, 0x2C, 0x74, 0x00, 0x1D, 0xB0, 0x00,
+  0x0E, 0x01, 0xE5, 0x80, 0x02, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB, 0x00, 0x01, 0xD7,
+  0x40, 0x02, 0xC3, 0x80, 0x03, 0x81, 0xC0, 0x07, 0x40, 0xD0, 0x0B, 0x00,
+  0xB0, 0x0F, 0xFF, 0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00, 0x2C, 0x74, 0x00,
+  0x1D, 0xB0, 0x00, 0x0E, 0x02, 0xD7, 0x80, 0x01, 0x82, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB, 0x00, 0x01, 0xD7,
+  0x40, 0x02, 0xC3, 0x80, 0x03, 0x81, 0xC0, 0x07, 0x40, 0xD0, 0x0B, 0x00,
+  0xB0, 0x0F, 0xFF, 0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00, 0x2C, 0x74, 0x00,
+  0x1D, 0xB0, 0x00, 0x0E, 0x00, 0x6D, 0x00, 0x00, 0xD7, 0x00, 0x01, 0x82,
+  0x40, 0x00, 0xD3, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB,
+  0x00, 0x01, 0xD7, 0x40, 0x02, 0xC3, 0x80, 0x03, 0x81, 0xC0, 0x07, 0x40,
+  0xE0, 0x0F, 0x00, 0xB0, 0x1F, 0xFF, 0xF4, 0x2D, 0x55, 0x78, 0x38, 0x00,
+  0x2C, 0x74, 0x00, 0x1D, 0xB0, 0x00, 0x0E, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
+  0x7A, 0xE5, 0x55, 0x00, 0xB5, 0xE0, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x01,
+  0xD1, 0xE0, 0x00, 0x02, 0xC1, 0xFF, 0xFE, 0x07, 0x41, 0xE5, 0x55, 0x0B,
+  0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1D, 0x55, 0xE0, 0x00, 0x38,
+  0x01, 0xE0, 0x00, 0x74, 0x01, 0xE5, 0x55, 0xB0, 0x01, 0xFF, 0xFF, 0x01,
+  0xBF, 0x90, 0x3E, 0x9B, 0xD3, 0xD0, 0x01, 0x5D, 0x00, 0x00, 0xB0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB0, 0x00, 0x01,
+  0xD0, 0x00, 0x03, 0xD0, 0x01, 0x47, 0xE9, 0xBD, 0x01, 0xBF, 0x90, 0x00,
+  0x30, 0x00, 0x00, 0xA0, 0x00, 0x12, 0x80, 0x00, 0xB8, 0x00, 0x01, 0x40,
+  0x00, 0x74, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xDE, 0x55, 0x57,
+  0x40, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xE7, 0x95, 0x55, 0xD0,
+  0x00, 0x74, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xE5, 0x55, 0x7F, 0xFF,
+  0xC0, 0x00, 0x14, 0x00, 0x28, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xDE, 0x55, 0x57, 0x40, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xE7,
+  0x95, 0x55, 0xD0, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xE5,
+  0x55, 0x7F, 0xFF, 0xC0, 0x00, 0x90, 0x00, 0xD9, 0x00, 0x50, 0x40, 0x00,
+  0x00, 0x7F, 0xFF, 0xDE, 0x55, 0x57, 0x40, 0x01, 0xD0, 0x00, 0x78, 0x00,
+  0x1F, 0xFF, 0xE7, 0x95, 0x55, 0xD0, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x07,
+  0x40, 0x01, 0xE5, 0x55, 0x7F, 0xFF, 0xC0, 0x0B, 0x1D, 0x02, 0x86, 0x40,
+  0x00, 0x01, 0xFF, 0xFF, 0x79, 0x55, 0x5D, 0x00, 0x07, 0x40, 0x01, 0xE0,
+  0x00, 0x7F, 0xFF, 0x9E, 0x55, 0x57, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x00,
+  0x1D, 0x00, 0x07, 0x95, 0x55, 0xFF, 0xFF, 0x82, 0xC1, 0x40, 0x75, 0xD7,
+  0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x74, 0x05, 0x28, 0x50, 0x00,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x19, 0x1D, 0xD5, 0x04, 0x00, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D,
+  0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x00, 0xE2,
+  0xE8, 0x60, 0x00, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41,
+  0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1F, 0xFE, 0x90, 0x07, 0x96,
+  0xBE, 0x01, 0xE0, 0x02, 0xE0, 0x78, 0x00, 0x3C, 0x1E, 0x00, 0x07, 0x47,
+  0x80, 0x01, 0xEF, 0xFF, 0x40, 0x79, 0x79, 0x40, 0x1E, 0x1E, 0x00, 0x07,
+  0x47, 0x80, 0x03, 0xC1, 0xE0, 0x02, 0xE0, 0x79, 0x6B, 0xE0, 0x1F, 0xFE,
+  0x90, 0x00, 0x02, 0xE2, 0x40, 0x0D, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7D, 0x00, 0x75, 0xFC, 0x01, 0xD7, 0xB4, 0x07, 0x5D, 0xF0, 0x1D,
+  0x75, 0xD0, 0x75, 0xD2, 0xC1, 0xD7, 0x47, 0x47, 0x5D, 0x0B, 0x1D, 0x74,
+  0x1E, 0x75, 0xD0, 0x2D, 0xD7, 0x40, 0x7B, 0x5D, 0x00, 0xBD, 0x74, 0x00,
+  0xF4, 0x00, 0xA0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xBE, 0x40, 0x1F, 0x96, 0xF0, 0x3D, 0x00, 0x78, 0x78, 0x00,
+  0x2D, 0xB0, 0x00, 0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0E, 0xB0, 0x00, 0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96,
+  0xF0, 0x02, 0xFE, 0x40, 0x00, 0x0E, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0x40, 0x1F, 0x96, 0xF0, 0x3D, 0x00,
+  0x78, 0x78, 0x00, 0x2D, 0xB0, 0x00, 0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x0E, 0xB0, 0x00, 0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00,
+  0x78, 0x1F, 0x96, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xD6,
+  0x00, 0x01, 0x41, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBE, 0x40, 0x1F, 0x96,
+  0xF0, 0x3D, 0x00, 0x78, 0x78, 0x00, 0x2D, 0xB0, 0x00, 0x1E, 0xF0, 0x00,
+  0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0E, 0xB0, 0x00, 0x1E, 0x74, 0x00,
+  0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96, 0xF0, 0x02, 0xFE, 0x40, 0x01, 0xE5,
+  0x80, 0x02, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE,
+  0x40, 0x1F, 0x96, 0xF0, 0x3D, 0x00, 0x78, 0x78, 0x00, 0x2D, 0xB0, 0x00,
+  0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0E, 0xB0, 0x00,
+  0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96, 0xF0, 0x02, 0xFE,
+  0x40, 0x01, 0x86, 0x40, 0x02, 0xC7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xBE, 0x40, 0x1F, 0x96, 0xF0, 0x3D, 0x00, 0x78, 0x78, 0x00,
+  0x2D, 0xB0, 0x00, 0x1E, 0xF0, 0x00, 0x0E, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0E, 0xB0, 0x00, 0x1E, 0x74, 0x00, 0x2D, 0x3D, 0x00, 0x78, 0x1F, 0x96,
+  0xF0, 0x02, 0xFE, 0x40, 0x10, 0x00, 0x17, 0x80, 0x0B, 0x2E, 0x02, 0xD0,
+  0xB8, 0xB4, 0x02, 0xFD, 0x00, 0x0F, 0x80, 0x02, 0xEE, 0x00, 0xB4, 0xB4,
+  0x2D, 0x02, 0xD7, 0x40, 0x0B, 0x10, 0x00, 0x10, 0x02, 0xBE, 0x4A, 0x1F,
+  0x96, 0xFC, 0x3D, 0x00, 0xB8, 0x78, 0x01, 0xED, 0xB0, 0x03, 0x4E, 0xF0,
+  0x0D, 0x0E, 0xF0, 0x28, 0x0F, 0xF0, 0xA0, 0x0E, 0xB2, 0x80, 0x1E, 0x7B,
+  0x00, 0x2D, 0x3D, 0x00, 0x78, 0x7F, 0x96, 0xF0, 0xD1, 0xBE, 0x40, 0x01,
+  0xD0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x74, 0x00,
+  0x75, 0xD0, 0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75,
+  0xD0, 0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0,
+  0x02, 0xD3, 0xC0, 0x0F, 0x07, 0xE6, 0xF4, 0x06, 0xFE, 0x40, 0x00, 0x1D,
+  0x00, 0x00, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x75,
+  0xD0, 0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0,
+  0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x02,
+  0xD3, 0xC0, 0x0F, 0x07, 0xE6, 0xF4, 0x06, 0xFE, 0x40, 0x00, 0xB8, 0x00,
+  0x06, 0x34, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x74, 0x00, 0x75, 0xD0,
+  0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x01,
+  0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x02, 0xD3,
+  0xC0, 0x0F, 0x07, 0xE6, 0xF4, 0x06, 0xFE, 0x40, 0x02, 0x4A, 0x00, 0x0E,
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x75, 0xD0, 0x01,
+  0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x01, 0xD7,
+  0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x02, 0xD3, 0xC0,
+  0x0F, 0x07, 0xE6, 0xF4, 0x06, 0xFE, 0x40, 0x00, 0x14, 0x00, 0x00, 0xD0,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x74, 0xE0, 0x03, 0x81,
+  0xD0, 0x2C, 0x02, 0xD1, 0xD0, 0x03, 0x8E, 0x00, 0x07, 0xF0, 0x00, 0x0B,
+  0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40,
+  0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x1E, 0x00, 0x07, 0xFF,
+  0xD1, 0xE5, 0x7D, 0x74, 0x07, 0x9D, 0x00, 0xF7, 0x40, 0x3D, 0xD0, 0x0F,
+  0x78, 0x1B, 0x5F, 0xFF, 0x87, 0x95, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x00,
+  0x0B, 0xF8, 0x02, 0xE6, 0xE0, 0x74, 0x0B, 0x07, 0x41, 0xB0, 0x74, 0x74,
+  0x07, 0x4E, 0x00, 0x74, 0xE0, 0x07, 0x4B, 0x80, 0x74, 0x2F, 0x07, 0x40,
+  0x7C, 0x74, 0x01, 0xD7, 0x40, 0x1D, 0x76, 0x57, 0x87, 0x6F, 0xE0, 0x14,
+  0x00, 0x02, 0x80, 0x00, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0xF9,
+  0x07, 0x96, 0xD0, 0x00, 0x2C, 0x00, 0x07, 0x06, 0xFF, 0xD7, 0x95, 0xB7,
+  0x80, 0x2D, 0xE0, 0x0F, 0x6E, 0x5E, 0xD2, 0xFD, 0x74, 0x00, 0x14, 0x00,
+  0x1C, 0x00, 0x1D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x07, 0x96,
+  0xD0, 0x00, 0x2C, 0x00, 0x07, 0x06, 0xFF, 0xD7, 0x95, 0xB7, 0x80, 0x2D,
+  0xE0, 0x0F, 0x6E, 0x5E, 0xD2, 0xFD, 0x74, 0x01, 0x40, 0x01, 0xF4, 0x00,
+  0xD7, 0x40, 0x50, 0x50, 0x00, 0x00, 0x0A, 0xF9, 0x07, 0x96, 0xD0, 0x00,
+  0x2C, 0x00, 0x07, 0x06, 0xFF, 0xD7, 0x95, 0xB7, 0x80, 0x2D, 0xE0, 0x0F,
+  0x6E, 0x5E, 0xD2, 0xFD, 0x74, 0x1F, 0x5C, 0x0A, 0x7D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2B, 0xE4, 0x1E, 0x5B, 0x40, 0x00, 0xB0, 0x00, 0x1C, 0x1B,
+  0xFF, 0x5E, 0x56, 0xDE, 0x00, 0xB7, 0x80, 0x3D, 0xB9, 0x7B, 0x4B, 0xF5,
+  0xD0, 0x1D, 0x38, 0x06, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xE4,
+  0x1E, 0x5B, 0x40, 0x00, 0xB0, 0x00, 0x1C, 0x1B, 0xFF, 0x5E, 0x56, 0xDE,
+  0x00, 0xB7, 0x80, 0x3D, 0xB9, 0x7B, 0x4B, 0xF5, 0xD0, 0x06, 0xD0, 0x03,
+  0x5D, 0x01, 0xC2, 0x40, 0x34, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xBE,
+  0x41, 0xE5, 0xB4, 0x00, 0x0B, 0x00, 0x01, 0xC1, 0xBF, 0xF5, 0xE5, 0x6D,
+  0xE0, 0x0B, 0x78, 0x03, 0xDB, 0x97, 0xB4, 0xBF, 0x5D, 0x2B, 0xE4, 0x6F,
+  0x90, 0x79, 0x6E, 0xE5, 0xB4, 0x00, 0x0B, 0x80, 0x2C, 0x00, 0x07, 0x40,
+  0x1D, 0x1B, 0xFF, 0xFF, 0xFD, 0x79, 0x5B, 0x55, 0x54, 0xE0, 0x0B, 0x40,
+  0x00, 0xE0, 0x0F, 0xC0, 0x00, 0xB9, 0x79, 0xF9, 0x6C, 0x2F, 0xE0, 0x6F,
+  0xE4, 0x0B, 0xF9, 0x2E, 0x5A, 0xB4, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xF0, 0x00, 0xB4, 0x00, 0x2E, 0x5A, 0x0B, 0xF9, 0x00, 0x60, 0x00,
+  0x34, 0x00, 0x74, 0x07, 0xE0, 0x05, 0x00, 0x01, 0xD0, 0x00, 0x1C, 0x00,
+  0x01, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x02, 0xE6, 0xF1, 0xD0, 0x0E, 0xE0,
+  0x02, 0xBF, 0xFF, 0xFE, 0x55, 0x57, 0xC0, 0x00, 0xB4, 0x00, 0x0B, 0x96,
+  0xE0, 0x6F, 0xE4, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x02, 0xFE, 0x02, 0xE6, 0xF1, 0xD0, 0x0E, 0xE0, 0x02, 0xBF,
+  0xFF, 0xFE, 0x55, 0x57, 0xC0, 0x00, 0xB4, 0x00, 0x0B, 0x96, 0xE0, 0x6F,
+  0xE4, 0x00, 0x90, 0x00, 0xBC, 0x00, 0x62, 0x80, 0x10, 0x10, 0x00, 0x00,
+  0x02, 0xFE, 0x02, 0xE6, 0xF1, 0xD0, 0x0E, 0xE0, 0x02, 0xBF, 0xFF, 0xFE,
+  0x55, 0x57, 0xC0, 0x00, 0xB4, 0x00, 0x0B, 0x96, 0xE0, 0x6F, 0xE4, 0x0E,
+  0x2C, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0x9B,
+  0xC7, 0x40, 0x3B, 0x80, 0x0A, 0xFF, 0xFF, 0xF9, 0x55, 0x5F, 0x00, 0x02,
+  0xD0, 0x00, 0x2E, 0x5B, 0x81, 0xBF, 0x90, 0x90, 0xB0, 0x38, 0x0D, 0x00,
+  0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x05, 0x0E,
+  0x28, 0x70, 0x00, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x18, 0x0B, 0x87, 0x37, 0x47, 0x00, 0x07, 0x41, 0xD0, 0x74, 0x1D,
+  0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0xE2, 0xE4, 0xA0, 0x00,
+  0x00, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1D,
+  0x07, 0x40, 0x0B, 0x05, 0x00, 0xFE, 0x42, 0xEE, 0x00, 0x41, 0xE0, 0x0B,
+  0xFD, 0x0F, 0x97, 0xCB, 0x40, 0x77, 0xC0, 0x0E, 0xE0, 0x03, 0xB8, 0x00,
+  0xEF, 0x00, 0x3A, 0xD0, 0x2D, 0x2E, 0x6E, 0x02, 0xFD, 0x00, 0x0B, 0x89,
+  0x03, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xF9, 0x1F, 0x96, 0xC7,
+  0x80, 0x75, 0xD0, 0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE7, 0x40, 0x39, 0xD0,
+  0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE0, 0x09, 0x00, 0x02, 0xC0, 0x00, 0x28,
+  0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xE6, 0xE2, 0xD0, 0x2D,
+  0xF0, 0x03, 0xB8, 0x00, 0xEE, 0x00, 0x3B, 0xC0, 0x0E, 0xB4, 0x0B, 0x4F,
+  0x9B, 0x80, 0xBF, 0x80, 0x00, 0x14, 0x00, 0x1D, 0x00, 0x0D, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xE6, 0xE2, 0xD0, 0x2D, 0xF0, 0x03,
+  0xB8, 0x00, 0xEE, 0x00, 0x3B, 0xC0, 0x0E, 0xB4, 0x0B, 0x4F, 0x9B, 0x80,
+  0xBF, 0x80, 0x01, 0x80, 0x00, 0xF8, 0x00, 0xA2, 0x40, 0x10, 0x10, 0x00,
+  0x00, 0x02, 0xFE, 0x03, 0xE6, 0xE2, 0xD0, 0x2D, 0xF0, 0x03, 0xB8, 0x00,
+  0xEE, 0x00, 0x3B, 0xC0, 0x0E, 0xB4, 0x0B, 0x4F, 0x9B, 0x80, 0xBF, 0x80,
+  0x0B, 0x8C, 0x06, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F,
+  0x9B, 0x8B, 0x40, 0xB7, 0xC0, 0x0E, 0xE0, 0x03, 0xB8, 0x00, 0xEF, 0x00,
+  0x3A, 0xD0, 0x2D, 0x3E, 0x6E, 0x02, 0xFE, 0x00, 0x0E, 0x2C, 0x02, 0x4A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0x9B, 0x8B, 0x40, 0xB7,
+  0xC0, 0x0E, 0xE0, 0x03, 0xB8, 0x00, 0xEF, 0x00, 0x3A, 0xD0, 0x2D, 0x3E,
+  0x6E, 0x02, 0xFE, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
+  0x2D, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x42, 0xF9, 0xA3, 0xE6, 0xF2,
+  0xD0, 0x7D, 0xF0, 0x37, 0xB8, 0x24, 0xEE, 0x28, 0x3B, 0xA8, 0x0E, 0x7C,
+  0x0B, 0x5F, 0x9B, 0x8D, 0xBF, 0x81, 0x00, 0x00, 0x09, 0x00, 0x02, 0xC0,
+  0x00, 0x28, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2C, 0x00, 0xEB, 0x00, 0x3A,
+  0xC0, 0x0E, 0xB0, 0x03, 0xAC, 0x00, 0xE7, 0x00, 0x39, 0xC0, 0x1E, 0x74,
+  0x0B, 0x8F, 0x9A, 0xE0, 0xBE, 0x38, 0x00, 0x14, 0x00, 0x1D, 0x00, 0x0D,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xEB, 0x00, 0x3A, 0xC0, 0x0E,
+  0xB0, 0x03, 0xAC, 0x00, 0xE7, 0x00, 0x39, 0xC0, 0x1E, 0x74, 0x0B, 0x8F,
+  0x9A, 0xE0, 0xBE, 0x38, 0x01, 0x80, 0x00, 0xF8, 0x00, 0xA2, 0x80, 0x10,
+  0x10, 0x00, 0x00, 0x2C, 0x00, 0xEB, 0x00, 0x3A, 0xC0, 0x0E, 0xB0, 0x03,
+  0xAC, 0x00, 0xE7, 0x00, 0x39, 0xC0, 0x1E, 0x74, 0x0B, 0x8F, 0x9A, 0xE0,
+  0xBE, 0x38, 0x0E, 0x2C, 0x02, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+  0x03, 0xAC, 0x00, 0xEB, 0x00, 0x3A, 0xC0, 0x0E, 0xB0, 0x03, 0x9C, 0x00,
+  0xE7, 0x00, 0x79, 0xD0, 0x2E, 0x3E, 0x6B, 0x82, 0xF8, 0xE0, 0x00, 0x0E,
+  0x00, 0x02, 0xC0, 0x00, 0x70, 0x00, 0x05, 0x00, 0x74, 0x00, 0xE3, 0x80,
+  0x1D, 0x2C, 0x02, 0xC0, 0xE0, 0x38, 0x0B, 0x07, 0x40, 0x74, 0xE0, 0x03,
+  0x9D, 0x00, 0x2E, 0xC0, 0x01, 0xF8, 0x00, 0x0B, 0x40, 0x00, 0xB0, 0x00,
+  0x1E, 0x00, 0x16, 0xC0, 0x02, 0xF4, 0x00, 0x74, 0x00, 0x07, 0x40, 0x00,
+  0x74, 0x00, 0x07, 0x40, 0x00, 0x76, 0xF9, 0x07, 0xA5, 0xF4, 0x78, 0x03,
+  0x87, 0x40, 0x2C, 0x74, 0x01, 0xD7, 0x40, 0x1D, 0x74, 0x02, 0xC7, 0x80,
+  0x38, 0x7A, 0x5F, 0x47, 0x6F, 0x90, 0x74, 0x00, 0x07, 0x40, 0x00, 0x74,
+  0x00, 0x07, 0x40, 0x00, 0x07, 0x4E, 0x00, 0x64, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x74, 0x00, 0xE3, 0x80, 0x1D, 0x2C, 0x02, 0xC0, 0xE0, 0x38,
+  0x0B, 0x07, 0x40, 0x74, 0xE0, 0x03, 0x9D, 0x00, 0x2E, 0xC0, 0x01, 0xF8,
+  0x00, 0x0B, 0x40, 0x00, 0xB0, 0x00, 0x1E, 0x00, 0x16, 0xC0, 0x02, 0xF4,
+  0x00 };
+
+const GFXglyph DejaVuSans9pt8bAa2Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   3,  13,   7,    2,  -13 },   // 0x21 '!'
+  {    10,   6,   5,   8,    1,  -13 },   // 0x22 '"'
+  {    18,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {    61,   9,  17,  11,    1,  -14 },   // 0x24 '$'
+  {   100,  15,  13,  17,    1,  -13 },   // 0x25 '%'
+  {   149,  12,  13,  14,    1,  -13 },   // 0x26 '&'
+  {   188,   2,   5,   5,    1,  -13 },   // 0x27 '''
+  {   191,   5,  16,   7,    1,  -14 },   // 0x28 '('
+  {   211,   5,  16,   7,    1,  -14 },   // 0x29 ')'
+  {   231,   8,   8,   9,    0,  -13 },   // 0x2A '*'
+  {   247,  11,  12,  15,    2,  -12 },   // 0x2B '+'
+  {   280,   3,   5,   6,    1,   -3 },   // 0x2C ','
+  {   284,   5,   2,   6,    1,   -5 },   // 0x2D '-'
+  {   287,   2,   3,   6,    2,   -3 },   // 0x2E '.'
+  {   289,   6,  15,   6,    0,  -13 },   // 0x2F '/'
+  {   312,   9,  13,  11,    1,  -13 },   // 0x30 '0'
+  {   342,   8,  13,  11,    2,  -13 },   // 0x31 '1'
+  {   368,   9,  13,  11,    1,  -13 },   // 0x32 '2'
+  {   398,   9,  13,  11,    1,  -13 },   // 0x33 '3'
+  {   428,  10,  13,  11,    1,  -13 },   // 0x34 '4'
+  {   461,   9,  13,  11,    1,  -13 },   // 0x35 '5'
+  {   491,   9,  13,  11,    1,  -13 },   // 0x36 '6'
+  {   521,   9,  13,  11,    1,  -13 },   // 0x37 '7'
+  {   551,   9,  13,  11,    1,  -13 },   // 0x38 '8'
+  {   581,   9,  13,  11,    1,  -13 },   // 0x39 '9'
+  {   611,   2,  10,   6,    2,  -10 },   // 0x3A ':'
+  {   616,   3,  12,   6,    1,  -10 },   // 0x3B ';'
+  {   625,  11,  10,  15,    2,  -11 },   // 0x3C '<'
+  {   653,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {   670,  11,   9,  15,    2,  -10 },   // 0x3E '>'
+  {   695,   7,  13,   9,    1,  -13 },   // 0x3F '?'
+  {   718,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {   782,  12,  13,  12,    0,  -13 },   // 0x41 'A'
+  {   821,  10,  13,  12,    1,  -13 },   // 0x42 'B'
+  {   854,  11,  13,  12,    1,  -13 },   // 0x43 'C'
+  {   890,  12,  13,  14,    1,  -13 },   // 0x44 'D'
+  {   929,   9,  13,  11,    1,  -13 },   // 0x45 'E'
+  {   959,   8,  13,  10,    1,  -13 },   // 0x46 'F'
+  {   985,  12,  13,  14,    1,  -13 },   // 0x47 'G'
+  {  1024,  11,  13,  13,    1,  -13 },   // 0x48 'H'
+  {  1060,   3,  13,   5,    1,  -13 },   // 0x49 'I'
+  {  1070,   5,  17,   5,   -1,  -13 },   // 0x4A 'J'
+  {  1092,  11,  13,  12,    1,  -13 },   // 0x4B 'K'
+  {  1128,   9,  13,  10,    1,  -13 },   // 0x4C 'L'
+  {  1158,  13,  13,  15,    1,  -13 },   // 0x4D 'M'
+  {  1201,  11,  13,  13,    1,  -13 },   // 0x4E 'N'
+  {  1237,  12,  13,  14,    1,  -13 },   // 0x4F 'O'
+  {  1276,   9,  13,  11,    1,  -13 },   // 0x50 'P'
+  {  1306,  12,  15,  14,    1,  -13 },   // 0x51 'Q'
+  {  1351,  11,  13,  12,    1,  -13 },   // 0x52 'R'
+  {  1387,  10,  13,  11,    1,  -13 },   // 0x53 'S'
+  {  1420,  11,  13,  11,    0,  -13 },   // 0x54 'T'
+  {  1456,  11,  13,  13,    1,  -13 },   // 0x55 'U'
+  {  1492,  12,  13,  12,    0,  -13 },   // 0x56 'V'
+  {  1531,  17,  13,  17,    0,  -13 },   // 0x57 'W'
+  {  1587,  11,  13,  12,    1,  -13 },   // 0x58 'X'
+  {  1623,  11,  13,  11,    0,  -13 },   // 0x59 'Y'
+  {  1659,  12,  13,  12,    0,  -13 },   // 0x5A 'Z'
+  {  1698,   4,  17,   7,    1,  -14 },   // 0x5B '['
+  {  1715,   6,  15,   6,    0,  -13 },   // 0x5C '\'
+  {  1738,   5,  17,   7,    1,  -14 },   // 0x5D ']'
+  {  1760,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  1774,  10,   2,   9,   -1,    3 },   // 0x5F '_'
+  {  1779,   4,   4,   9,    2,  -15 },   // 0x60 '`'
+  {  1783,   9,  10,  11,    1,  -10 },   // 0x61 'a'
+  {  1806,  10,  14,  11,    1,  -14 },   // 0x62 'b'
+  {  1841,   8,  10,  10,    1,  -10 },   // 0x63 'c'
+  {  1861,   9,  14,  11,    1,  -14 },   // 0x64 'd'
+  {  1893,   9,  10,  11,    1,  -10 },   // 0x65 'e'
+  {  1916,   7,  14,   6,    0,  -14 },   // 0x66 'f'
+  {  1941,   9,  14,  11,    1,  -10 },   // 0x67 'g'
+  {  1973,   9,  14,  11,    1,  -14 },   // 0x68 'h'
+  {  2005,   3,  14,   5,    1,  -14 },   // 0x69 'i'
+  {  2016,   5,  18,   5,   -1,  -14 },   // 0x6A 'j'
+  {  2039,   9,  14,  10,    1,  -14 },   // 0x6B 'k'
+  {  2071,   3,  14,   5,    1,  -14 },   // 0x6C 'l'
+  {  2082,  15,  10,  17,    1,  -10 },   // 0x6D 'm'
+  {  2120,   9,  10,  11,    1,  -10 },   // 0x6E 'n'
+  {  2143,   9,  10,  11,    1,  -10 },   // 0x6F 'o'
+  {  2166,  10,  14,  11,    1,  -10 },   // 0x70 'p'
+  {  2201,   9,  14,  11,    1,  -10 },   // 0x71 'q'
+  {  2233,   7,  10,   7,    1,  -10 },   // 0x72 'r'
+  {  2251,   8,  10,   9,    1,  -10 },   // 0x73 's'
+  {  2271,   7,  13,   7,    0,  -13 },   // 0x74 't'
+  {  2294,   9,  10,  11,    1,  -10 },   // 0x75 'u'
+  {  2317,  10,  10,  10,    0,  -10 },   // 0x76 'v'
+  {  2342,  13,  10,  14,    1,  -10 },   // 0x77 'w'
+  {  2375,  10,  10,  10,    0,  -10 },   // 0x78 'x'
+  {  2400,  10,  14,  10,    0,  -10 },   // 0x79 'y'
+  {  2435,   9,  10,   9,    0,  -10 },   // 0x7A 'z'
+  {  2458,   7,  17,  11,    2,  -14 },   // 0x7B '{'
+  {  2488,   2,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  2497,   7,  17,  11,    2,  -14 },   // 0x7D '}'
+  {  2527,  11,   3,  15,    2,   -7 },   // 0x7E '~'
+  {  2536,   9,  16,  11,    1,  -13 },   // 0x7F
+  {  2572,   9,  16,  11,    1,  -13 },   // 0x80
+  {  2608,   9,  16,  11,    1,  -13 },   // 0x81
+  {  2644,   9,  16,  11,    1,  -13 },   // 0x82
+  {  2680,   9,  16,  11,    1,  -13 },   // 0x83
+  {  2716,   9,  16,  11,    1,  -13 },   // 0x84
+  {  2752,   9,  16,  11,    1,  -13 },   // 0x85
+  {  2788,   9,  16,  11,    1,  -13 },   // 0x86
+  {  2824,   9,  16,  11,    1,  -13 },   // 0x87
+  {  2860,   9,  16,  11,    1,  -13 },   // 0x88
+  {  2896,   9,  16,  11,    1,  -13 },   // 0x89
+  {  2932,   9,  16,  11,    1,  -13 },   // 0x8A
+  {  2968,   9,  16,  11,    1,  -13 },   // 0x8B
+  {  3004,   9,  16,  11,    1,  -13 },   // 0x8C
+  {  3040,   9,  16,  11,    1,  -13 },   // 0x8D
+  {  3076,   9,  16,  11,    1,  -13 },   // 0x8E
+  {  3112,   9,  16,  11,    1,  -13 },   // 0x8F
+  {  3148,   9,  16,  11,    1,  -13 },   // 0x90
+  {  3184,   9,  16,  11,    1,  -13 },   // 0x91
+  {  3220,   9,  16,  11,    1,  -13 },   // 0x92
+  {  3256,   9,  16,  11,    1,  -13 },   // 0x93
+  {  3292,   9,  16,  11,    1,  -13 },   // 0x94
+  {  3328,   9,  16,  11,    1,  -13 },   // 0x95
+  {  3364,   9,  16,  11,    1,  -13 },   // 0x96
+  {  3400,   9,  16,  11,    1,  -13 },   // 0x97
+  {  3436,   9,  16,  11,    1,  -13 },   // 0x98
+  {  3472,   9,  16,  11,    1,  -13 },   // 0x99
+  {  3508,   9,  16,  11,    1,  -13 },   // 0x9A
+  {  3544,   9,  16,  11,    1,  -13 },   // 0x9B
+  {  3580,   9,  16,  11,    1,  -13 },   // 0x9C
+  {  3616,   9,  16,  11,    1,  -13 },   // 0x9D
+  {  3652,   9,  16,  11,    1,  -13 },   // 0x9E
+  {  3688,   9,  16,  11,    1,  -13 },   // 0x9F
+  {  3724,   0,   0,   6,    0,    1 },   // 0xA0
+  {  3724,   3,  13,   7,    2,  -10 },   // 0xA1
+  {  3734,   8,  16,  11,    1,  -13 },   // 0xA2
+  {  3766,   9,  13,  11,    1,  -13 },   // 0xA3
+  {  3796,  10,   9,  11,    1,  -10 },   // 0xA4
+  {  3819,  10,  13,  11,    1,  -13 },   // 0xA5
+  {  3852,   2,  16,   6,    2,  -13 },   // 0xA6
+  {  3860,   7,  16,   9,    1,  -13 },   // 0xA7
+  {  3888,   5,   2,   9,    2,  -14 },   // 0xA8
+  {  3891,  13,  13,  18,    2,  -13 },   // 0xA9
+  {  3934,   6,   9,   8,    1,  -13 },   // 0xAA
+  {  3948,   8,   8,  11,    1,   -9 },   // 0xAB
+  {  3964,  11,   5,  15,    2,   -7 },   // 0xAC
+  {  3978,   5,   2,   6,    1,   -5 },   // 0xAD
+  {  3981,  13,  13,  18,    2,  -13 },   // 0xAE
+  {  4024,   6,   2,   9,    1,  -13 },   // 0xAF
+  {  4027,   6,   5,   9,    1,  -13 },   // 0xB0
+  {  4035,  11,  12,  15,    2,  -12 },   // 0xB1
+  {  4068,   6,   7,   7,    0,  -13 },   // 0xB2
+  {  4079,   5,   7,   7,    1,  -13 },   // 0xB3
+  {  4088,   4,   4,   9,    3,  -15 },   // 0xB4
+  {  4092,  10,  14,  11,    1,  -10 },   // 0xB5
+  {  4127,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  4161,   2,   3,   6,    2,   -8 },   // 0xB7
+  {  4163,   4,   4,   9,    2,   -1 },   // 0xB8
+  {  4167,   5,   7,   7,    1,  -13 },   // 0xB9
+  {  4176,   7,   9,   8,    1,  -13 },   // 0xBA
+  {  4192,   9,   8,  11,    1,   -9 },   // 0xBB
+  {  4210,  16,  14,  17,    1,  -14 },   // 0xBC
+  {  4266,  15,  13,  17,    1,  -13 },   // 0xBD
+  {  4315,  16,  14,  17,    1,  -14 },   // 0xBE
+  {  4371,   7,  14,   9,    1,  -10 },   // 0xBF
+  {  4396,  12,  17,  12,    0,  -17 },   // 0xC0
+  {  4447,  12,  17,  12,    0,  -17 },   // 0xC1
+  {  4498,  12,  17,  12,    0,  -17 },   // 0xC2
+  {  4549,  12,  17,  12,    0,  -17 },   // 0xC3
+  {  4600,  12,  16,  12,    0,  -16 },   // 0xC4
+  {  4648,  12,  17,  12,    0,  -17 },   // 0xC5
+  {  4699,  16,  13,  17,    0,  -13 },   // 0xC6
+  {  4751,  11,  17,  12,    1,  -13 },   // 0xC7
+  {  4798,   9,  17,  11,    1,  -17 },   // 0xC8
+  {  4837,   9,  17,  11,    1,  -17 },   // 0xC9
+  {  4876,   9,  17,  11,    1,  -17 },   // 0xCA
+  {  4915,   9,  16,  11,    1,  -16 },   // 0xCB
+  {  4951,   3,  17,   5,    1,  -17 },   // 0xCC
+  {  4964,   4,  17,   5,    1,  -17 },   // 0xCD
+  {  4981,   5,  17,   5,    0,  -17 },   // 0xCE
+  {  5003,   5,  16,   5,    0,  -16 },   // 0xCF
+  {  5023,  13,  13,  14,    0,  -13 },   // 0xD0
+  {  5066,  11,  17,  13,    1,  -17 },   // 0xD1
+  {  5113,  12,  17,  14,    1,  -17 },   // 0xD2
+  {  5164,  12,  17,  14,    1,  -17 },   // 0xD3
+  {  5215,  12,  17,  14,    1,  -17 },   // 0xD4
+  {  5266,  12,  17,  14,    1,  -17 },   // 0xD5
+  {  5317,  12,  17,  14,    1,  -17 },   // 0xD6
+  {  5368,  10,  11,  15,    2,  -11 },   // 0xD7
+  {  5396,  12,  13,  14,    1,  -13 },   // 0xD8
+  {  5435,  11,  17,  13,    1,  -17 },   // 0xD9
+  {  5482,  11,  17,  13,    1,  -17 },   // 0xDA
+  {  5529,  11,  17,  13,    1,  -17 },   // 0xDB
+  {  5576,  11,  17,  13,    1,  -17 },   // 0xDC
+  {  5623,  11,  17,  11,    0,  -17 },   // 0xDD
+  {  5670,   9,  13,  11,    1,  -13 },   // 0xDE
+  {  5700,  10,  14,  11,    1,  -14 },   // 0xDF
+  {  5735,   9,  15,  11,    1,  -15 },   // 0xE0
+  {  5769,   9,  15,  11,    1,  -15 },   // 0xE1
+  {  5803,   9,  15,  11,    1,  -15 },   // 0xE2
+  {  5837,   9,  14,  11,    1,  -14 },   // 0xE3
+  {  5869,   9,  14,  11,    1,  -14 },   // 0xE4
+  {  5901,   9,  16,  11,    1,  -16 },   // 0xE5
+  {  5937,  16,  10,  17,    1,  -10 },   // 0xE6
+  {  5977,   8,  14,  10,    1,  -10 },   // 0xE7
+  {  6005,   9,  15,  11,    1,  -15 },   // 0xE8
+  {  6039,   9,  15,  11,    1,  -15 },   // 0xE9
+  {  6073,   9,  15,  11,    1,  -15 },   // 0xEA
+  {  6107,   9,  14,  11,    1,  -14 },   // 0xEB
+  {  6139,   4,  15,   5,    0,  -15 },   // 0xEC
+  {  6154,   4,  15,   5,    1,  -15 },   // 0xED
+  {  6169,   5,  15,   5,    0,  -15 },   // 0xEE
+  {  6188,   5,  14,   5,    0,  -14 },   // 0xEF
+  {  6206,   9,  14,  11,    1,  -14 },   // 0xF0
+  {  6238,   9,  14,  11,    1,  -14 },   // 0xF1
+  {  6270,   9,  15,  11,    1,  -15 },   // 0xF2
+  {  6304,   9,  15,  11,    1,  -15 },   // 0xF3
+  {  6338,   9,  15,  11,    1,  -15 },   // 0xF4
+  {  6372,   9,  14,  11,    1,  -14 },   // 0xF5
+  {  6404,   9,  14,  11,    1,  -14 },   // 0xF6
+  {  6436,  11,   9,  15,    2,  -10 },   // 0xF7
+  {  6461,   9,  12,  11,    1,  -11 },   // 0xF8
+  {  6488,   9,  15,  11,    1,  -15 },   // 0xF9
+  {  6522,   9,  15,  11,    1,  -15 },   // 0xFA
+  {  6556,   9,  15,  11,    1,  -15 },   // 0xFB
+  {  6590,   9,  14,  11,    1,  -14 },   // 0xFC
+  {  6622,  10,  18,  10,    0,  -14 },   // 0xFD
+  {  6667,  10,  18,  11,    1,  -14 },   // 0xFE
+  {  6712,  10,  18,  10,    0,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans9pt8bAa2 = {
+  DejaVuSans9pt8bAa2Bitmaps, DejaVuSans9pt8bAa2Glyphs, 0x20, 0xFF, 21, 2 };
+
+// Approx. 8333 bytes
+#endif // DEJAVUSANS9PT8BAA2_H
@@ -0,0 +1,1422 @@
+#ifndef DEJAVUSANS9PT8BAA4_H
+#define DEJAVUSANS9PT8BAA4_H
+// Police anti-aliasée 4 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans9pt8bAa4Bitmaps[] PROGMEM = {
+  0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x54, 0xF5,
+  0x2C, 0x30, 0x00, 0x13, 0x15, 0xF6, 0x5F, 0x60, 0x4F, 0x21, 0xF6, 0x4F,
+  0x21, 0xF6, 0x4F, 0x21, 0xF6, 0x4F, 0x21, 0xF6, 0x4D, 0x21, 0xD5, 0x00,
+  0x00, 0x0C, 0x90, 0x0D, 0x80, 0x00, 0x00, 0x00, 0xF6, 0x02, 0xF4, 0x00,
+  0x00, 0x00, 0x3F, 0x20, 0x5F, 0x10, 0x00, 0x11, 0x17, 0xE1, 0x19, 0xD1,
+  0x10, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x24, 0x4F, 0x84, 0x5F,
+  0x74, 0x42, 0x00, 0x03, 0xF2, 0x05, 0xF1, 0x00, 0x01, 0x11, 0x8E, 0x11,
+  0x9C, 0x11, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x02, 0x44, 0xF8,
+  0x45, 0xF7, 0x44, 0x20, 0x00, 0x3F, 0x20, 0x5F, 0x10, 0x00, 0x00, 0x07,
+  0xE0, 0x09, 0xC0, 0x00, 0x00, 0x00, 0xBA, 0x00, 0xC9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xD0,
+  0x00, 0x00, 0x3B, 0xEF, 0xED, 0xA0, 0x2E, 0xC4, 0xD4, 0x6B, 0x07, 0xF2,
+  0x0D, 0x00, 0x00, 0x7F, 0x40, 0xD0, 0x00, 0x02, 0xEE, 0x9E, 0x30, 0x00,
+  0x02, 0x9D, 0xFF, 0xD6, 0x00, 0x00, 0x0D, 0x4B, 0xF5, 0x00, 0x00, 0xD0,
+  0x0E, 0xA1, 0x00, 0x0D, 0x01, 0xE9, 0x8C, 0x64, 0xD6, 0xCF, 0x42, 0x8C,
+  0xEF, 0xEC, 0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x19, 0xEE, 0x80, 0x00, 0x00, 0x9B, 0x00,
+  0x0A, 0xD3, 0x4E, 0x80, 0x00, 0x3F, 0x30, 0x00, 0xE6, 0x00, 0x8C, 0x00,
+  0x0C, 0x80, 0x00, 0x0E, 0x60, 0x08, 0xD0, 0x07, 0xD1, 0x00, 0x00, 0xBC,
+  0x12, 0xD9, 0x02, 0xE4, 0x00, 0x00, 0x02, 0xCF, 0xFB, 0x10, 0xAA, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x5E, 0x21, 0x9D, 0xC5, 0x00, 0x00, 0x00,
+  0x1D, 0x70, 0xAD, 0x36, 0xF4, 0x00, 0x00, 0x08, 0xC0, 0x0F, 0x50, 0x0B,
+  0x90, 0x00, 0x03, 0xF3, 0x02, 0xF4, 0x00, 0xAB, 0x00, 0x00, 0xC9, 0x00,
+  0x0F, 0x50, 0x0B, 0xA0, 0x00, 0x6E, 0x10, 0x00, 0xAC, 0x36, 0xF4, 0x00,
+  0x1E, 0x50, 0x00, 0x01, 0xAE, 0xD6, 0x00, 0x00, 0x2A, 0xEE, 0xC7, 0x00,
+  0x00, 0x01, 0xDE, 0x86, 0x9D, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x01, 0x00,
+  0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0x10, 0x00, 0x00,
+  0x00, 0x03, 0xDE, 0xC1, 0x00, 0x00, 0x00, 0x2E, 0xA2, 0xED, 0x10, 0x01,
+  0xF8, 0x9E, 0x10, 0x2E, 0xD1, 0x04, 0xF4, 0xDC, 0x00, 0x03, 0xED, 0x2A,
+  0xD0, 0xCE, 0x00, 0x00, 0x3E, 0xDF, 0x50, 0x8F, 0x70, 0x00, 0x07, 0xFE,
+  0x10, 0x1C, 0xFB, 0x77, 0xAF, 0xBF, 0xC1, 0x01, 0x8D, 0xFE, 0xB5, 0x06,
+  0xFB, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4D, 0x20, 0x00, 0x3F, 0x30,
+  0x0B, 0xB0, 0x03, 0xF4, 0x00, 0xAE, 0x00, 0x0E, 0xA0, 0x03, 0xF6, 0x00,
+  0x5F, 0x40, 0x07, 0xF3, 0x00, 0x7F, 0x30, 0x05, 0xF4, 0x00, 0x3F, 0x60,
+  0x00, 0xEA, 0x00, 0x09, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xBB, 0x00, 0x03,
+  0xF3, 0x5E, 0x10, 0x00, 0xD9, 0x00, 0x06, 0xF2, 0x00, 0x1F, 0x70, 0x00,
+  0xCC, 0x00, 0x08, 0xF1, 0x00, 0x6F, 0x40, 0x05, 0xF5, 0x00, 0x5F, 0x50,
+  0x06, 0xF4, 0x00, 0x8F, 0x10, 0x0C, 0xC0, 0x01, 0xF7, 0x00, 0x6F, 0x20,
+  0x0D, 0x90, 0x05, 0xE1, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x01, 0x30, 0x1D,
+  0x00, 0x40, 0x3D, 0x92, 0xD2, 0xBC, 0x10, 0x07, 0xDF, 0xD5, 0x00, 0x00,
+  0x5D, 0xFB, 0x30, 0x02, 0xBB, 0x3D, 0x4C, 0xA1, 0x15, 0x01, 0xD0, 0x06,
+  0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x02, 0x22, 0x27, 0xF4, 0x22, 0x22, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x58, 0xF6, 0x55, 0x54, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x04, 0x40,
+  0xED, 0x1F, 0xB4, 0xF3, 0x8B, 0x00, 0x02, 0x22, 0x21, 0x2F, 0xFF, 0xF8,
+  0x15, 0x55, 0x52, 0x03, 0x22, 0xFB, 0x2F, 0xB0, 0x00, 0x00, 0xAC, 0x00,
+  0x01, 0xE7, 0x00, 0x05, 0xF2, 0x00, 0x09, 0xD0, 0x00, 0x0E, 0x80, 0x00,
+  0x3F, 0x40, 0x00, 0x8E, 0x00, 0x00, 0xD9, 0x00, 0x02, 0xF5, 0x00, 0x07,
+  0xF1, 0x00, 0x0C, 0xB0, 0x00, 0x1F, 0x60, 0x00, 0x6F, 0x10, 0x00, 0xAC,
+  0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x6D, 0xFD, 0x81, 0x00, 0x8F, 0xB6,
+  0x9F, 0xB0, 0x2F, 0xB0, 0x00, 0x8F, 0x57, 0xF4, 0x00, 0x01, 0xFA, 0xAF,
+  0x10, 0x00, 0x0D, 0xDC, 0xE0, 0x00, 0x00, 0xBF, 0xDE, 0x00, 0x00, 0x0A,
+  0xFC, 0xE0, 0x00, 0x00, 0xBF, 0xAF, 0x10, 0x00, 0x0D, 0xD7, 0xF4, 0x00,
+  0x01, 0xFA, 0x2F, 0xB0, 0x00, 0x8F, 0x50, 0x8F, 0xB6, 0x9F, 0xB0, 0x00,
+  0x7D, 0xFD, 0x81, 0x00, 0x07, 0xAD, 0xFB, 0x00, 0x01, 0xFE, 0xBF, 0xB0,
+  0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+  0xFB, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00,
+  0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xB0,
+  0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x67, 0x7F, 0xD7, 0x74, 0x0C, 0xFF,
+  0xFF, 0xFF, 0x90, 0x28, 0xCE, 0xEC, 0x60, 0x09, 0xFB, 0x88, 0xDF, 0x90,
+  0x41, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00,
+  0x8F, 0x40, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00,
+  0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00,
+  0x0A, 0xF6, 0x00, 0x00, 0x09, 0xFC, 0x77, 0x77, 0x73, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x70, 0x29, 0xCE, 0xED, 0x81, 0x04, 0xDA, 0x88, 0xBF, 0xD1, 0x00,
+  0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x12, 0x25, 0xDF,
+  0x30, 0x07, 0xFF, 0xFD, 0x50, 0x00, 0x25, 0x69, 0xD6, 0x00, 0x00, 0x00,
+  0x05, 0xF5, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x01, 0xFB, 0x20,
+  0x00, 0x00, 0x8F, 0x8A, 0xD9, 0x89, 0xCF, 0xD1, 0x4A, 0xDF, 0xEC, 0x81,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xBE, 0xF6, 0x00,
+  0x00, 0x00, 0x5F, 0x7F, 0x60, 0x00, 0x00, 0x1E, 0x85, 0xF6, 0x00, 0x00,
+  0x09, 0xD1, 0x5F, 0x60, 0x00, 0x03, 0xF4, 0x05, 0xF6, 0x00, 0x00, 0xCA,
+  0x00, 0x5F, 0x60, 0x00, 0x7E, 0x20, 0x05, 0xF6, 0x00, 0x1E, 0x92, 0x22,
+  0x7F, 0x72, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x15, 0x55, 0x55, 0x8F,
+  0x95, 0x10, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x60,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFB, 0x01, 0xFB, 0x77, 0x77, 0x50, 0x1F, 0x80,
+  0x00, 0x00, 0x01, 0xF8, 0x12, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x80, 0x01,
+  0xC7, 0x57, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x03,
+  0xF9, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x04, 0xF8, 0x20, 0x00,
+  0x01, 0xCF, 0x4A, 0xD9, 0x89, 0xEF, 0x90, 0x5B, 0xDF, 0xEC, 0x60, 0x00,
+  0x00, 0x19, 0xDF, 0xDA, 0x20, 0x02, 0xEF, 0xA8, 0x9B, 0x40, 0x0C, 0xE3,
+  0x00, 0x00, 0x00, 0x4F, 0x60, 0x11, 0x00, 0x00, 0x8F, 0x5C, 0xFF, 0xC4,
+  0x00, 0xBF, 0xEB, 0x67, 0xEF, 0x40, 0xBF, 0xC0, 0x00, 0x2F, 0xC0, 0xBF,
+  0x60, 0x00, 0x0C, 0xF0, 0x9F, 0x50, 0x00, 0x0A, 0xF1, 0x6F, 0x60, 0x00,
+  0x0C, 0xF0, 0x1E, 0xC0, 0x00, 0x3F, 0xB0, 0x06, 0xFC, 0x78, 0xEE, 0x30,
+  0x00, 0x5C, 0xFE, 0xA3, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xA4, 0x77, 0x77,
+  0x7B, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x10, 0x00, 0x00, 0x2F, 0xA0, 0x00,
+  0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x4F, 0x80,
+  0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x7F,
+  0x60, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00,
+  0x9F, 0x40, 0x00, 0x00, 0x01, 0x9D, 0xFD, 0xA3, 0x01, 0xDE, 0x96, 0x8E,
+  0xF4, 0x6F, 0x60, 0x00, 0x3F, 0xA7, 0xF5, 0x00, 0x01, 0xF9, 0x3F, 0xD4,
+  0x23, 0xBE, 0x20, 0x6E, 0xFF, 0xFD, 0x20, 0x04, 0xB8, 0x57, 0xDD, 0x24,
+  0xF5, 0x00, 0x02, 0xFB, 0xAF, 0x00, 0x00, 0x0C, 0xEC, 0xF0, 0x00, 0x00,
+  0xCF, 0x9F, 0x60, 0x00, 0x3F, 0xB2, 0xEF, 0x96, 0x8E, 0xF4, 0x02, 0x9D,
+  0xFE, 0xB3, 0x00, 0x02, 0x9E, 0xFD, 0x70, 0x02, 0xEF, 0x97, 0xAF, 0x90,
+  0x9F, 0x50, 0x00, 0x8F, 0x4D, 0xE0, 0x00, 0x02, 0xF9, 0xDE, 0x00, 0x00,
+  0x2F, 0xCB, 0xF2, 0x00, 0x06, 0xFE, 0x4F, 0xD4, 0x25, 0xEF, 0xE0, 0x6E,
+  0xFF, 0xF8, 0xDE, 0x00, 0x03, 0x41, 0x0F, 0xB0, 0x00, 0x00, 0x05, 0xF7,
+  0x00, 0x00, 0x02, 0xDE, 0x11, 0xEA, 0x89, 0xEF, 0x40, 0x09, 0xDF, 0xEA,
+  0x30, 0x00, 0x33, 0xED, 0xED, 0x00, 0x00, 0x00, 0x00, 0x33, 0xED, 0xED,
+  0x03, 0x30, 0xED, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+  0x0E, 0xD1, 0xFB, 0x4F, 0x38, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0xDE, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xB5,
+  0x00, 0x04, 0xAE, 0xFC, 0x71, 0x00, 0x18, 0xEF, 0xD8, 0x20, 0x00, 0x00,
+  0x2F, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFB, 0x51, 0x00, 0x00,
+  0x00, 0x02, 0x7C, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xE8,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x07, 0xCF, 0xFA, 0x50, 0x00, 0x00,
+  0x00, 0x02, 0x8D, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xC7,
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0x00, 0x00, 0x01, 0x6C, 0xFE, 0xA4,
+  0x00, 0x15, 0xBF, 0xFB, 0x61, 0x00, 0x19, 0xEF, 0xD7, 0x20, 0x00, 0x00,
+  0x2E, 0x93, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xD8, 0x10, 0xBD, 0x87,
+  0xBF, 0xA0, 0x40, 0x00, 0x0C, 0xF1, 0x00, 0x00, 0x0B, 0xF1, 0x00, 0x00,
+  0x5F, 0x90, 0x00, 0x04, 0xFB, 0x10, 0x00, 0x2F, 0xB1, 0x00, 0x00, 0x8F,
+  0x20, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x23,
+  0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+  0x39, 0xDF, 0xFD, 0x94, 0x00, 0x00, 0x00, 0x1A, 0xFB, 0x64, 0x46, 0xAF,
+  0xA1, 0x00, 0x01, 0xCD, 0x30, 0x00, 0x00, 0x03, 0xCB, 0x10, 0x09, 0xD1,
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x80, 0x3F, 0x30, 0x05, 0xDF, 0xD6, 0xB7,
+  0x04, 0xE1, 0x8C, 0x00, 0x3F, 0xA4, 0x5D, 0xF7, 0x00, 0xE4, 0xB8, 0x00,
+  0xAC, 0x00, 0x02, 0xF7, 0x00, 0xD6, 0xC6, 0x00, 0xC9, 0x00, 0x00, 0xE7,
+  0x00, 0xF4, 0xB7, 0x00, 0xAB, 0x00, 0x01, 0xF7, 0x06, 0xE1, 0x9A, 0x00,
+  0x5F, 0x71, 0x2B, 0xF8, 0x6E, 0x60, 0x4E, 0x20, 0x07, 0xFF, 0xF9, 0xCF,
+  0xD5, 0x00, 0x0C, 0xB0, 0x00, 0x13, 0x10, 0x21, 0x00, 0x00, 0x02, 0xEA,
+  0x10, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x2D, 0xE7, 0x31, 0x14, 0x9F,
+  0x80, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x8E, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x9E, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0, 0x0D, 0xB0, 0x00,
+  0x00, 0x1F, 0x80, 0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30, 0x02, 0xF7, 0x00,
+  0x00, 0xCD, 0x22, 0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+  0x08, 0xF5, 0x55, 0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00, 0x00, 0x0A, 0xE0,
+  0x4F, 0x70, 0x00, 0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB,
+  0x4F, 0xFF, 0xFE, 0xD8, 0x10, 0x4F, 0xB7, 0x77, 0xBF, 0xD0, 0x4F, 0x70,
+  0x00, 0x0A, 0xF4, 0x4F, 0x70, 0x00, 0x08, 0xF3, 0x4F, 0x82, 0x22, 0x5E,
+  0xC0, 0x4F, 0xFF, 0xFF, 0xFB, 0x10, 0x4F, 0x94, 0x45, 0x8E, 0xC1, 0x4F,
+  0x70, 0x00, 0x05, 0xF7, 0x4F, 0x70, 0x00, 0x01, 0xFB, 0x4F, 0x70, 0x00,
+  0x01, 0xFC, 0x4F, 0x70, 0x00, 0x06, 0xF9, 0x4F, 0xB7, 0x77, 0xAF, 0xE2,
+  0x4F, 0xFF, 0xFF, 0xDA, 0x20, 0x00, 0x17, 0xCE, 0xFD, 0x93, 0x00, 0x2D,
+  0xFC, 0x87, 0x9D, 0xF4, 0x1D, 0xF5, 0x00, 0x00, 0x06, 0x57, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0x10, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00,
+  0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x1D, 0xF5, 0x00, 0x00, 0x06, 0x40, 0x3D, 0xFB, 0x87, 0x9D, 0xF4, 0x00,
+  0x17, 0xCE, 0xFD, 0xA3, 0x00, 0x4F, 0xFF, 0xFE, 0xC9, 0x30, 0x00, 0x4F,
+  0xB7, 0x78, 0xAE, 0xF9, 0x00, 0x4F, 0x70, 0x00, 0x01, 0xBF, 0x80, 0x4F,
+  0x70, 0x00, 0x00, 0x1E, 0xE1, 0x4F, 0x70, 0x00, 0x00, 0x08, 0xF5, 0x4F,
+  0x70, 0x00, 0x00, 0x05, 0xF7, 0x4F, 0x70, 0x00, 0x00, 0x05, 0xF8, 0x4F,
+  0x70, 0x00, 0x00, 0x06, 0xF7, 0x4F, 0x70, 0x00, 0x00, 0x08, 0xF5, 0x4F,
+  0x70, 0x00, 0x00, 0x1E, 0xE1, 0x4F, 0x70, 0x00, 0x01, 0xBF, 0x80, 0x4F,
+  0xB7, 0x78, 0xAE, 0xF9, 0x00, 0x4F, 0xFF, 0xFE, 0xC9, 0x30, 0x00, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xD4, 0xFB, 0x77, 0x77, 0x76, 0x4F, 0x70, 0x00, 0x00,
+  0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x82, 0x22, 0x22, 0x14, 0xFF, 0xFF,
+  0xFF, 0xF9, 0x4F, 0xA5, 0x55, 0x55, 0x34, 0xF7, 0x00, 0x00, 0x00, 0x4F,
+  0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00,
+  0x04, 0xFB, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF,
+  0xFF, 0xFF, 0x24, 0xFB, 0x77, 0x77, 0x71, 0x4F, 0x70, 0x00, 0x00, 0x04,
+  0xF7, 0x00, 0x00, 0x00, 0x4F, 0x82, 0x22, 0x21, 0x04, 0xFF, 0xFF, 0xFF,
+  0x80, 0x4F, 0xA5, 0x55, 0x53, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70,
+  0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04,
+  0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE,
+  0xFE, 0xB6, 0x10, 0x02, 0xDF, 0xC8, 0x78, 0xBF, 0xC0, 0x1D, 0xF5, 0x00,
+  0x00, 0x02, 0x80, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x12, 0x22, 0x20, 0xFD, 0x00, 0x00,
+  0x5F, 0xFF, 0xF3, 0xED, 0x00, 0x00, 0x25, 0x5A, 0xF3, 0xCF, 0x10, 0x00,
+  0x00, 0x08, 0xF3, 0x7F, 0x70, 0x00, 0x00, 0x08, 0xF3, 0x1D, 0xF5, 0x00,
+  0x00, 0x08, 0xF3, 0x02, 0xDF, 0xC8, 0x78, 0xBF, 0xE2, 0x00, 0x17, 0xCE,
+  0xFE, 0xB7, 0x10, 0x4F, 0x70, 0x00, 0x00, 0x3F, 0x84, 0xF7, 0x00, 0x00,
+  0x03, 0xF8, 0x4F, 0x70, 0x00, 0x00, 0x3F, 0x84, 0xF7, 0x00, 0x00, 0x03,
+  0xF8, 0x4F, 0x82, 0x22, 0x22, 0x5F, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x4F, 0xA5, 0x55, 0x55, 0x7F, 0x84, 0xF7, 0x00, 0x00, 0x03, 0xF8, 0x4F,
+  0x70, 0x00, 0x00, 0x3F, 0x84, 0xF7, 0x00, 0x00, 0x03, 0xF8, 0x4F, 0x70,
+  0x00, 0x00, 0x3F, 0x84, 0xF7, 0x00, 0x00, 0x03, 0xF8, 0x4F, 0x70, 0x00,
+  0x00, 0x3F, 0x80, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7,
+  0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x70, 0x00,
+  0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70,
+  0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7,
+  0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70, 0x05, 0xF6, 0x00, 0x9F,
+  0x37, 0xAF, 0xC0, 0xEE, 0xA2, 0x00, 0x4F, 0x70, 0x00, 0x05, 0xFD, 0x24,
+  0xF7, 0x00, 0x05, 0xFC, 0x10, 0x4F, 0x70, 0x06, 0xFC, 0x10, 0x04, 0xF7,
+  0x07, 0xFB, 0x10, 0x00, 0x4F, 0x77, 0xFB, 0x00, 0x00, 0x04, 0xFD, 0xFA,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xF8, 0xBF, 0x80,
+  0x00, 0x00, 0x4F, 0x71, 0xBF, 0x70, 0x00, 0x04, 0xF7, 0x01, 0xBF, 0x70,
+  0x00, 0x4F, 0x70, 0x01, 0xCF, 0x70, 0x04, 0xF7, 0x00, 0x01, 0xCF, 0x70,
+  0x4F, 0x70, 0x00, 0x01, 0xCF, 0x60, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7,
+  0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00,
+  0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00,
+  0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7,
+  0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xFB, 0x77, 0x77, 0x75,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xF7, 0x00, 0x00, 0x04, 0xFF, 0x74,
+  0xFF, 0xD0, 0x00, 0x00, 0xAF, 0xF7, 0x4F, 0xAF, 0x40, 0x00, 0x1F, 0xAF,
+  0x74, 0xF6, 0xD9, 0x00, 0x06, 0xF4, 0xF7, 0x4F, 0x67, 0xE1, 0x00, 0xCB,
+  0x3F, 0x74, 0xF6, 0x2F, 0x50, 0x2F, 0x53, 0xF7, 0x4F, 0x60, 0xBB, 0x08,
+  0xE0, 0x3F, 0x74, 0xF6, 0x06, 0xF2, 0xD9, 0x03, 0xF7, 0x4F, 0x60, 0x1E,
+  0xBF, 0x30, 0x3F, 0x74, 0xF6, 0x00, 0xAF, 0xD0, 0x03, 0xF7, 0x4F, 0x60,
+  0x03, 0x84, 0x00, 0x3F, 0x74, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x4F,
+  0x60, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x4F, 0xF5, 0x00, 0x00, 0x4F, 0x74,
+  0xFF, 0xD0, 0x00, 0x04, 0xF7, 0x4F, 0xCF, 0x60, 0x00, 0x4F, 0x74, 0xF7,
+  0xDD, 0x00, 0x04, 0xF7, 0x4F, 0x65, 0xF6, 0x00, 0x4F, 0x74, 0xF6, 0x0C,
+  0xE1, 0x04, 0xF7, 0x4F, 0x60, 0x4F, 0x70, 0x4F, 0x74, 0xF6, 0x00, 0xCE,
+  0x14, 0xF7, 0x4F, 0x60, 0x04, 0xF8, 0x4F, 0x74, 0xF6, 0x00, 0x0B, 0xE5,
+  0xF7, 0x4F, 0x60, 0x00, 0x3F, 0xCF, 0x74, 0xF6, 0x00, 0x00, 0xAF, 0xF7,
+  0x4F, 0x60, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x18, 0xCE, 0xEC, 0x71, 0x00,
+  0x03, 0xDF, 0xB7, 0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0,
+  0x7F, 0x80, 0x00, 0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA,
+  0xEE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD,
+  0xED, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA,
+  0x7F, 0x70, 0x00, 0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0,
+  0x03, 0xEF, 0xA7, 0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE, 0xEC, 0x71, 0x00,
+  0x4F, 0xFF, 0xFE, 0xB5, 0x04, 0xFB, 0x77, 0x9E, 0xF6, 0x4F, 0x70, 0x00,
+  0x3F, 0xD4, 0xF7, 0x00, 0x00, 0xDF, 0x4F, 0x70, 0x00, 0x1E, 0xE4, 0xF8,
+  0x22, 0x4B, 0xF9, 0x4F, 0xFF, 0xFF, 0xFA, 0x14, 0xFA, 0x55, 0x41, 0x00,
+  0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00,
+  0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xCE, 0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7, 0x7B, 0xFC, 0x20, 0x1D,
+  0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0A, 0xF5, 0xCF,
+  0x20, 0x00, 0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0xFD, 0xED, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xCF,
+  0x10, 0x00, 0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00, 0x00, 0x09, 0xF4, 0x1D,
+  0xF4, 0x00, 0x00, 0x5F, 0xC0, 0x03, 0xEF, 0xA7, 0x7B, 0xFC, 0x10, 0x00,
+  0x18, 0xDE, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xDE, 0x40, 0x4F, 0xFF, 0xFE, 0xB5, 0x00, 0x04, 0xFB,
+  0x77, 0x9E, 0xF6, 0x00, 0x4F, 0x70, 0x00, 0x2F, 0xD0, 0x04, 0xF7, 0x00,
+  0x00, 0xDF, 0x00, 0x4F, 0x70, 0x00, 0x1E, 0xE0, 0x04, 0xF8, 0x22, 0x4B,
+  0xF9, 0x00, 0x4F, 0xFF, 0xFF, 0xF9, 0x00, 0x04, 0xFA, 0x55, 0x8F, 0xA0,
+  0x00, 0x4F, 0x70, 0x00, 0x6F, 0x70, 0x04, 0xF7, 0x00, 0x00, 0xCE, 0x10,
+  0x4F, 0x70, 0x00, 0x05, 0xF7, 0x04, 0xF7, 0x00, 0x00, 0x0D, 0xE1, 0x4F,
+  0x70, 0x00, 0x00, 0x5F, 0x70, 0x02, 0x9D, 0xFE, 0xC9, 0x30, 0x3E, 0xFA,
+  0x78, 0xAE, 0x70, 0xAF, 0x40, 0x00, 0x01, 0x20, 0xCE, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x85, 0x10, 0x00, 0x02,
+  0x9D, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x15, 0xBF, 0xA0, 0x00, 0x00, 0x00,
+  0x0D, 0xF1, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x51, 0x00, 0x00, 0x1E, 0xF1,
+  0xCE, 0xA7, 0x79, 0xEF, 0x70, 0x38, 0xCE, 0xFE, 0xB5, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0x77, 0x7B, 0xF9, 0x77, 0x76, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00,
+  0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00,
+  0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06,
+  0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6,
+  0x7F, 0x50, 0x00, 0x00, 0x6F, 0x55, 0xF7, 0x00, 0x00, 0x09, 0xF3, 0x1E,
+  0xD1, 0x00, 0x02, 0xED, 0x00, 0x6F, 0xE9, 0x79, 0xEF, 0x50, 0x00, 0x4B,
+  0xEF, 0xEA, 0x30, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x4F, 0x80,
+  0x00, 0x00, 0x07, 0xF5, 0x0E, 0xD0, 0x00, 0x00, 0x0C, 0xE0, 0x08, 0xF4,
+  0x00, 0x00, 0x3F, 0x90, 0x02, 0xF9, 0x00, 0x00, 0x9F, 0x30, 0x00, 0xCE,
+  0x10, 0x00, 0xED, 0x00, 0x00, 0x6F, 0x60, 0x05, 0xF7, 0x00, 0x00, 0x1F,
+  0xB0, 0x0A, 0xF1, 0x00, 0x00, 0x0A, 0xF2, 0x1F, 0xB0, 0x00, 0x00, 0x04,
+  0xF7, 0x7F, 0x50, 0x00, 0x00, 0x00, 0xDD, 0xCE, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x5F, 0x70,
+  0x00, 0x06, 0xFC, 0x00, 0x00, 0x1F, 0xB1, 0xFB, 0x00, 0x00, 0xAF, 0xF1,
+  0x00, 0x04, 0xF7, 0x0C, 0xE0, 0x00, 0x0D, 0x9F, 0x40, 0x00, 0x8F, 0x30,
+  0x8F, 0x30, 0x02, 0xF4, 0xD8, 0x00, 0x0C, 0xE0, 0x05, 0xF7, 0x00, 0x6F,
+  0x19, 0xC0, 0x01, 0xFB, 0x00, 0x1F, 0xA0, 0x09, 0xC0, 0x6F, 0x10, 0x4F,
+  0x70, 0x00, 0xCE, 0x00, 0xD8, 0x02, 0xF4, 0x08, 0xF3, 0x00, 0x09, 0xF3,
+  0x2F, 0x50, 0x0D, 0x80, 0xBE, 0x00, 0x00, 0x5F, 0x65, 0xF1, 0x00, 0xAC,
+  0x0F, 0xB0, 0x00, 0x01, 0xFA, 0x9D, 0x00, 0x06, 0xF4, 0xF7, 0x00, 0x00,
+  0x0C, 0xED, 0x90, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x9F, 0xF5, 0x00,
+  0x00, 0xEF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x0A, 0xFB, 0x00,
+  0x00, 0x08, 0xF5, 0x00, 0x00, 0x1D, 0xD1, 0x01, 0xDE, 0x10, 0x00, 0x9F,
+  0x40, 0x00, 0x4F, 0xA0, 0x04, 0xF9, 0x00, 0x00, 0x09, 0xF4, 0x1D, 0xD1,
+  0x00, 0x00, 0x01, 0xDD, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xDD, 0x10,
+  0x00, 0x00, 0x08, 0xF5, 0x4F, 0x90, 0x00, 0x00, 0x3F, 0xB0, 0x09, 0xF4,
+  0x00, 0x00, 0xCE, 0x20, 0x01, 0xED, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x5F,
+  0x80, 0x2F, 0xB0, 0x00, 0x00, 0x0A, 0xF3, 0xAF, 0x30, 0x00, 0x00, 0x6F,
+  0x71, 0xEC, 0x00, 0x00, 0x2E, 0xC0, 0x05, 0xF7, 0x00, 0x0B, 0xF2, 0x00,
+  0x0A, 0xF3, 0x06, 0xF7, 0x00, 0x00, 0x1E, 0xC2, 0xEC, 0x00, 0x00, 0x00,
+  0x5F, 0xEF, 0x20, 0x00, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x07,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0x07, 0x77, 0x77, 0x77, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xDE,
+  0x30, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xD1, 0x00,
+  0x00, 0x00, 0x01, 0xDE, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0xF9, 0x77, 0x77, 0x77, 0x72, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0x7F, 0xFF, 0x27, 0xF5, 0x41, 0x7F, 0x10, 0x07, 0xF1, 0x00, 0x7F,
+  0x10, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x07,
+  0xF1, 0x00, 0x7F, 0x10, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x07, 0xF1, 0x00,
+  0x7F, 0x20, 0x07, 0xFF, 0xF2, 0x23, 0x33, 0x00, 0xD9, 0x00, 0x00, 0x8E,
+  0x00, 0x00, 0x3F, 0x40, 0x00, 0x0E, 0x80, 0x00, 0x09, 0xD0, 0x00, 0x05,
+  0xF2, 0x00, 0x01, 0xE7, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x6F, 0x10, 0x00,
+  0x1F, 0x60, 0x00, 0x0C, 0xB0, 0x00, 0x07, 0xF1, 0x00, 0x02, 0xF5, 0x00,
+  0x00, 0xD9, 0x00, 0x00, 0x56, 0x4F, 0xFF, 0x51, 0x46, 0xF5, 0x00, 0x4F,
+  0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04,
+  0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00,
+  0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x54, 0xFF, 0xF5, 0x13, 0x33, 0x10,
+  0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x01, 0xCF, 0xAF, 0x90, 0x00, 0x01,
+  0xBF, 0x50, 0x7F, 0x90, 0x00, 0xBE, 0x40, 0x00, 0x6F, 0x80, 0xAE, 0x30,
+  0x00, 0x00, 0x6F, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x28, 0x20, 0x00, 0xBC, 0x00, 0x01, 0xD8, 0x00, 0x03, 0xE4,
+  0x18, 0xCE, 0xFC, 0x60, 0x04, 0xD8, 0x67, 0xCF, 0x70, 0x10, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x06, 0xCF, 0xFF, 0xFF, 0x37, 0xF9,
+  0x54, 0x38, 0xF3, 0xDB, 0x00, 0x00, 0x8F, 0x3D, 0xC0, 0x00, 0x1E, 0xF3,
+  0x8F, 0xA6, 0x7E, 0xCF, 0x30, 0x8D, 0xFD, 0x66, 0xF3, 0x6F, 0x30, 0x00,
+  0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00,
+  0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x38, 0xEF, 0xC3, 0x00, 0x6F, 0xCC,
+  0x67, 0xEF, 0x30, 0x6F, 0xC1, 0x00, 0x2F, 0xB0, 0x6F, 0x60, 0x00, 0x0A,
+  0xF1, 0x6F, 0x40, 0x00, 0x07, 0xF3, 0x6F, 0x40, 0x00, 0x07, 0xF3, 0x6F,
+  0x60, 0x00, 0x0A, 0xF1, 0x6F, 0xC0, 0x00, 0x2F, 0xB0, 0x6F, 0xCC, 0x67,
+  0xDF, 0x30, 0x6F, 0x38, 0xEF, 0xC4, 0x00, 0x01, 0x8D, 0xFE, 0xB4, 0x1C,
+  0xFA, 0x67, 0xA8, 0x8F, 0x70, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xFB,
+  0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x8F,
+  0x60, 0x00, 0x00, 0x1C, 0xFA, 0x67, 0xA8, 0x01, 0x8D, 0xFE, 0xB4, 0x00,
+  0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+  0x90, 0x00, 0x00, 0x00, 0xF9, 0x02, 0xAE, 0xEA, 0x1F, 0x91, 0xDE, 0x86,
+  0xBC, 0xF9, 0x8F, 0x40, 0x00, 0xAF, 0x9D, 0xC0, 0x00, 0x03, 0xF9, 0xFA,
+  0x00, 0x00, 0x1F, 0x9F, 0xA0, 0x00, 0x01, 0xF9, 0xDC, 0x00, 0x00, 0x3F,
+  0x99, 0xF4, 0x00, 0x0A, 0xF9, 0x1E, 0xE8, 0x6B, 0xCF, 0x90, 0x2B, 0xEE,
+  0xA1, 0xF9, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0xCF, 0x96, 0x8E, 0xD1, 0x7F,
+  0x40, 0x00, 0x2F, 0x8D, 0xC0, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDF, 0xC3, 0x33, 0x33, 0x33, 0xDD, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x00,
+  0x00, 0x01, 0x1C, 0xFB, 0x76, 0x8D, 0x80, 0x07, 0xCF, 0xED, 0x93, 0x00,
+  0x2A, 0xEF, 0x80, 0x0B, 0xE6, 0x53, 0x00, 0xF9, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x9F, 0xFF, 0xFF, 0x22, 0x5F, 0xA4, 0x40, 0x01, 0xF8, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x02, 0xBE, 0xEA, 0x1F, 0x91, 0xEE, 0x86, 0xBC, 0xF9, 0x9F, 0x40, 0x00,
+  0xAF, 0x9D, 0xC0, 0x00, 0x03, 0xF9, 0xFA, 0x00, 0x00, 0x1F, 0x9F, 0xA0,
+  0x00, 0x01, 0xF9, 0xDC, 0x00, 0x00, 0x3F, 0x99, 0xF4, 0x00, 0x0A, 0xF9,
+  0x2E, 0xE8, 0x6A, 0xCF, 0x90, 0x2B, 0xEE, 0xA2, 0xF8, 0x00, 0x00, 0x00,
+  0x3F, 0x70, 0x00, 0x00, 0x0A, 0xF3, 0x0C, 0x96, 0x6B, 0xFA, 0x00, 0x8D,
+  0xEF, 0xD7, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00,
+  0x6F, 0x30, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0x37, 0xDF,
+  0xC4, 0x06, 0xFC, 0xC7, 0x7E, 0xE1, 0x6F, 0xB0, 0x00, 0x4F, 0x76, 0xF5,
+  0x00, 0x00, 0xF9, 0x6F, 0x30, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA,
+  0x6F, 0x30, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x6F, 0x30, 0x00,
+  0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x5F, 0x45, 0xF4, 0x00, 0x00, 0x00,
+  0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4,
+  0x5F, 0x45, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00,
+  0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40,
+  0x05, 0xF4, 0x00, 0x5F, 0x40, 0x07, 0xF2, 0x26, 0xDD, 0x05, 0xEC, 0x30,
+  0x6F, 0x30, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00,
+  0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x9F, 0x66, 0xF3,
+  0x00, 0xAF, 0x50, 0x6F, 0x31, 0xBE, 0x40, 0x06, 0xF4, 0xCE, 0x30, 0x00,
+  0x6F, 0xEF, 0x20, 0x00, 0x06, 0xF9, 0xFA, 0x00, 0x00, 0x6F, 0x36, 0xFA,
+  0x00, 0x06, 0xF3, 0x06, 0xFA, 0x00, 0x6F, 0x30, 0x06, 0xFA, 0x06, 0xF3,
+  0x00, 0x06, 0xFA, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4,
+  0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4,
+  0x6F, 0x38, 0xDE, 0xB2, 0x06, 0xDF, 0xD4, 0x06, 0xFC, 0xC7, 0x8F, 0xD6,
+  0xD8, 0x7E, 0xE1, 0x6F, 0xB0, 0x00, 0x7F, 0xE1, 0x00, 0x4F, 0x76, 0xF5,
+  0x00, 0x03, 0xF9, 0x00, 0x00, 0xF9, 0x6F, 0x30, 0x00, 0x2F, 0x70, 0x00,
+  0x0E, 0xA6, 0xF3, 0x00, 0x02, 0xF7, 0x00, 0x00, 0xEA, 0x6F, 0x30, 0x00,
+  0x2F, 0x70, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x02, 0xF7, 0x00, 0x00, 0xEA,
+  0x6F, 0x30, 0x00, 0x2F, 0x70, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x02, 0xF7,
+  0x00, 0x00, 0xEA, 0x6F, 0x38, 0xEF, 0xC4, 0x06, 0xFD, 0x94, 0x4C, 0xE1,
+  0x6F, 0xA0, 0x00, 0x3F, 0x76, 0xF5, 0x00, 0x00, 0xE9, 0x6F, 0x30, 0x00,
+  0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x6F, 0x30, 0x00, 0x0E, 0xA6, 0xF3,
+  0x00, 0x00, 0xEA, 0x6F, 0x30, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA,
+  0x01, 0x9E, 0xFD, 0x80, 0x01, 0xDF, 0x96, 0xAF, 0xB0, 0x8F, 0x50, 0x00,
+  0x9F, 0x5D, 0xD0, 0x00, 0x01, 0xFA, 0xFB, 0x00, 0x00, 0x0E, 0xCF, 0xB0,
+  0x00, 0x00, 0xEC, 0xDD, 0x00, 0x00, 0x1F, 0xA8, 0xF5, 0x00, 0x08, 0xF5,
+  0x1D, 0xF8, 0x6A, 0xFB, 0x00, 0x29, 0xEF, 0xD8, 0x00, 0x6F, 0x49, 0xEF,
+  0xC3, 0x00, 0x6F, 0xE9, 0x23, 0xBF, 0x30, 0x6F, 0xB0, 0x00, 0x1E, 0xB0,
+  0x6F, 0x50, 0x00, 0x09, 0xF1, 0x6F, 0x30, 0x00, 0x07, 0xF3, 0x6F, 0x40,
+  0x00, 0x07, 0xF3, 0x6F, 0x60, 0x00, 0x0A, 0xF1, 0x6F, 0xD1, 0x00, 0x2F,
+  0xB0, 0x6F, 0xCC, 0x67, 0xEF, 0x30, 0x6F, 0x38, 0xEF, 0xC4, 0x00, 0x6F,
+  0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00,
+  0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xEA, 0x1F, 0x91,
+  0xDE, 0x86, 0xBC, 0xF9, 0x8F, 0x40, 0x00, 0xAF, 0x9D, 0xC0, 0x00, 0x03,
+  0xF9, 0xFA, 0x00, 0x00, 0x1F, 0x9F, 0xA0, 0x00, 0x01, 0xF9, 0xDC, 0x00,
+  0x00, 0x3F, 0x99, 0xF4, 0x00, 0x0A, 0xF9, 0x1E, 0xE8, 0x6B, 0xCF, 0x90,
+  0x2B, 0xEE, 0xA1, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+  0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x6F, 0x49,
+  0xEF, 0x46, 0xFD, 0xA4, 0x42, 0x6F, 0xB0, 0x00, 0x06, 0xF5, 0x00, 0x00,
+  0x6F, 0x30, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x06, 0xF3,
+  0x00, 0x00, 0x6F, 0x30, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x8D, 0xFE,
+  0xC7, 0x00, 0x9F, 0x96, 0x69, 0xB0, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0xDD,
+  0x20, 0x00, 0x00, 0x04, 0xEF, 0xD9, 0x40, 0x00, 0x01, 0x69, 0xDF, 0xA0,
+  0x00, 0x00, 0x00, 0x9F, 0x30, 0x10, 0x00, 0x06, 0xF4, 0x1E, 0xA7, 0x68,
+  0xED, 0x10, 0x8C, 0xEF, 0xD9, 0x20, 0x03, 0x82, 0x00, 0x00, 0x5F, 0x40,
+  0x00, 0x05, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 0xF7, 0x28, 0xF6, 0x44, 0x20,
+  0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF4,
+  0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x2F, 0xC6, 0x52,
+  0x00, 0x6D, 0xFF, 0x70, 0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00,
+  0xF8, 0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10,
+  0x00, 0x0F, 0x87, 0xF1, 0x00, 0x00, 0xF8, 0x6F, 0x20, 0x00, 0x3F, 0x84,
+  0xF6, 0x00, 0x09, 0xF8, 0x0D, 0xF8, 0x7B, 0xCF, 0x80, 0x2B, 0xFE, 0x91,
+  0xF8, 0x4F, 0x60, 0x00, 0x00, 0xEB, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09,
+  0xF2, 0x00, 0x0A, 0xE1, 0x03, 0xF7, 0x00, 0x1F, 0xA0, 0x00, 0xDC, 0x00,
+  0x6F, 0x40, 0x00, 0x7F, 0x30, 0xBE, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00,
+  0x00, 0x0B, 0xD7, 0xF3, 0x00, 0x00, 0x06, 0xFE, 0xD0, 0x00, 0x00, 0x01,
+  0xFF, 0x70, 0x00, 0x2F, 0x70, 0x00, 0xDF, 0x40, 0x01, 0xF8, 0x0D, 0xB0,
+  0x02, 0xFF, 0x80, 0x04, 0xF4, 0x0A, 0xE0, 0x05, 0xFA, 0xC0, 0x08, 0xF1,
+  0x06, 0xF3, 0x09, 0xC5, 0xF1, 0x0C, 0xC0, 0x02, 0xF7, 0x0D, 0x82, 0xF4,
+  0x1F, 0x80, 0x00, 0xDB, 0x2F, 0x40, 0xD8, 0x4F, 0x40, 0x00, 0x9E, 0x6F,
+  0x10, 0x9C, 0x8F, 0x10, 0x00, 0x6F, 0xDB, 0x00, 0x5F, 0xDC, 0x00, 0x00,
+  0x2F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x0D, 0xF4,
+  0x00, 0x0C, 0xE2, 0x00, 0x08, 0xF5, 0x02, 0xEB, 0x00, 0x4F, 0x90, 0x00,
+  0x6F, 0x71, 0xED, 0x10, 0x00, 0x0A, 0xFC, 0xF3, 0x00, 0x00, 0x01, 0xEF,
+  0x70, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x1E, 0xD8, 0xF5, 0x00,
+  0x00, 0xBF, 0x30, 0xCE, 0x20, 0x06, 0xF7, 0x00, 0x2E, 0xC0, 0x3F, 0xB0,
+  0x00, 0x06, 0xF8, 0x4F, 0x60, 0x00, 0x00, 0xEB, 0x0D, 0xC0, 0x00, 0x05,
+  0xF5, 0x08, 0xF2, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x2F, 0x90, 0x00,
+  0xBD, 0x00, 0x7F, 0x30, 0x00, 0x5F, 0x40, 0xDC, 0x00, 0x00, 0x0E, 0xA3,
+  0xF6, 0x00, 0x00, 0x08, 0xFA, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x03, 0x6C, 0xE1, 0x00, 0x00, 0x09, 0xFD, 0x40, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x44, 0x44, 0x4A, 0xF6, 0x00, 0x00,
+  0x04, 0xFA, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x01, 0xDE, 0x20, 0x00,
+  0x00, 0xBF, 0x30, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x6F, 0x80, 0x00,
+  0x00, 0x2F, 0xD4, 0x44, 0x44, 0x24, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
+  0xBE, 0xF0, 0x00, 0xDE, 0x64, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF7, 0x00,
+  0x00, 0x2F, 0x70, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x2B,
+  0xF2, 0x00, 0xCF, 0xF5, 0x00, 0x03, 0x5C, 0xE2, 0x00, 0x00, 0x4F, 0x60,
+  0x00, 0x02, 0xF7, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x02, 0xF8, 0x00, 0x00,
+  0x0F, 0xC2, 0x10, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x13, 0x30, 0xCB, 0xCB,
+  0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+  0xCB, 0xCB, 0xCB, 0xCB, 0xCE, 0xC5, 0x00, 0x03, 0x5C, 0xF1, 0x00, 0x00,
+  0x5F, 0x40, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5,
+  0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0xED, 0x31, 0x00, 0x03, 0xEF, 0xF0,
+  0x00, 0xDD, 0x63, 0x00, 0x3F, 0x70, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F,
+  0x50, 0x00, 0x05, 0xF5, 0x00, 0x01, 0xAF, 0x30, 0x0C, 0xFF, 0xA0, 0x00,
+  0x33, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x05, 0xCF,
+  0xFE, 0xA5, 0x23, 0x8D, 0x2F, 0x95, 0x69, 0xDF, 0xFF, 0xD6, 0x12, 0x00,
+  0x00, 0x02, 0x43, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x5F, 0x65, 0xF6, 0x13, 0x10, 0x00, 0x2C, 0x34, 0xF5, 0x4F, 0x55,
+  0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x60, 0x00, 0x00, 0x27,
+  0x00, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x03,
+  0xBE, 0xFD, 0xA1, 0x05, 0xFD, 0x9C, 0x7C, 0x21, 0xED, 0x13, 0xB0, 0x00,
+  0x5F, 0x60, 0x3B, 0x00, 0x07, 0xF3, 0x03, 0xB0, 0x00, 0x7F, 0x30, 0x3B,
+  0x00, 0x06, 0xF5, 0x03, 0xB0, 0x00, 0x2F, 0xB0, 0x3B, 0x00, 0x00, 0x8F,
+  0xA5, 0xB3, 0x81, 0x00, 0x8E, 0xFF, 0xFE, 0x10, 0x00, 0x15, 0xC3, 0x00,
+  0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x05, 0xCF,
+  0xEB, 0x40, 0x04, 0xFD, 0x77, 0xA7, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x0C,
+  0xE0, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00,
+  0x9F, 0xFF, 0xFF, 0xF4, 0x02, 0x3D, 0xD3, 0x33, 0x10, 0x00, 0xDD, 0x00,
+  0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x06, 0x7E,
+  0xE7, 0x77, 0x75, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0xC8, 0x00, 0x10, 0x05, 0xE3, 0x07, 0xFA, 0xDF, 0xE9, 0xFA,
+  0x00, 0x09, 0xF9, 0x58, 0xEC, 0x00, 0x00, 0xC9, 0x00, 0x06, 0xF1, 0x00,
+  0x0F, 0x50, 0x00, 0x2F, 0x40, 0x00, 0xD8, 0x00, 0x05, 0xF2, 0x00, 0x09,
+  0xF6, 0x25, 0xDC, 0x00, 0x04, 0xFC, 0xFF, 0xFC, 0xF7, 0x01, 0xEA, 0x01,
+  0x42, 0x07, 0xF2, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1E, 0x90, 0x00,
+  0x00, 0x6F, 0x30, 0x7F, 0x20, 0x00, 0x1E, 0xA0, 0x01, 0xEA, 0x00, 0x07,
+  0xF2, 0x00, 0x06, 0xF3, 0x01, 0xE9, 0x00, 0x00, 0x0D, 0xC0, 0x8E, 0x10,
+  0x00, 0xCE, 0xFF, 0x7F, 0xFE, 0xE0, 0x02, 0x22, 0xCF, 0xE2, 0x22, 0x00,
+  0x00, 0x05, 0xF8, 0x00, 0x00, 0x0C, 0xEE, 0xEF, 0xFE, 0xEE, 0x00, 0x22,
+  0x25, 0xF8, 0x22, 0x20, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x04,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x76, 0xCB, 0xCB,
+  0xCB, 0xCB, 0xCB, 0xCB, 0x00, 0x00, 0x76, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+  0xCB, 0x00, 0x6D, 0xFD, 0xA1, 0x05, 0xFA, 0x56, 0xB2, 0x09, 0xF0, 0x00,
+  0x00, 0x06, 0xF7, 0x00, 0x00, 0x00, 0xDF, 0xB2, 0x00, 0x0A, 0xD7, 0xEE,
+  0x60, 0x2F, 0x40, 0x1A, 0xF7, 0x2F, 0x60, 0x00, 0xAE, 0x0B, 0xE5, 0x00,
+  0x7E, 0x01, 0xAF, 0xB5, 0xE7, 0x00, 0x04, 0xDF, 0xB0, 0x00, 0x00, 0x1B,
+  0xF3, 0x00, 0x00, 0x03, 0xF6, 0x05, 0x51, 0x19, 0xF3, 0x06, 0xEF, 0xFE,
+  0x70, 0x00, 0x02, 0x31, 0x00, 0x2C, 0x70, 0x9B, 0x2F, 0x90, 0xCF, 0x00,
+  0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1,
+  0x00, 0x03, 0xD2, 0x3A, 0xDD, 0xB3, 0x6B, 0x00, 0x0C, 0x33, 0xFA, 0x32,
+  0x54, 0x09, 0x60, 0x4A, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x76, 0x0E,
+  0x70, 0x00, 0x00, 0x00, 0xC1, 0x85, 0x0E, 0x70, 0x00, 0x00, 0x00, 0xB2,
+  0x76, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0xC1, 0x4A, 0x05, 0xF7, 0x10, 0x22,
+  0x01, 0xD0, 0x0C, 0x30, 0x5D, 0xFE, 0xD4, 0x09, 0x70, 0x03, 0xD3, 0x00,
+  0x11, 0x00, 0x6B, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1, 0x00, 0x00,
+  0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x4C, 0xEE, 0xA2, 0x04, 0x40, 0x1B,
+  0xB0, 0x00, 0x00, 0x4F, 0x03, 0xBE, 0xFF, 0xF1, 0xD8, 0x10, 0x4F, 0x1E,
+  0x81, 0x2B, 0xF1, 0x5D, 0xFC, 0x6F, 0x10, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+  0xFF, 0x20, 0x00, 0x06, 0x60, 0x0A, 0x20, 0x08, 0xF4, 0x1B, 0xD1, 0x09,
+  0xE4, 0x1C, 0xD2, 0x08, 0xF3, 0x0C, 0xC1, 0x00, 0x4E, 0x90, 0x7F, 0x60,
+  0x00, 0x3E, 0xA0, 0x6F, 0x70, 0x00, 0x2D, 0x60, 0x5F, 0x20, 0x00, 0x13,
+  0x00, 0x41, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x15, 0x55, 0x55, 0x55, 0x55, 0xAE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7B, 0x02, 0x22, 0x21, 0x2F, 0xFF, 0xF8, 0x15, 0x55, 0x52, 0x00,
+  0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1,
+  0x00, 0x03, 0xD2, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x0C, 0x30, 0xCE, 0xED,
+  0x91, 0x09, 0x60, 0x4A, 0x00, 0xC8, 0x01, 0xD8, 0x01, 0xD0, 0x76, 0x00,
+  0xC8, 0x01, 0xD8, 0x00, 0xC1, 0x85, 0x00, 0xCE, 0xEF, 0x81, 0x00, 0xB2,
+  0x76, 0x00, 0xC8, 0x1C, 0xA0, 0x00, 0xC1, 0x4A, 0x00, 0xC8, 0x02, 0xF5,
+  0x01, 0xD0, 0x0C, 0x30, 0xC8, 0x00, 0x8E, 0x19, 0x70, 0x03, 0xD3, 0x00,
+  0x00, 0x00, 0x6B, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1, 0x00, 0x00,
+  0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x01, 0x11, 0x11, 0x3F, 0xFF, 0xFF,
+  0x14, 0x44, 0x43, 0x03, 0xCE, 0xA2, 0x01, 0xE7, 0x39, 0xC0, 0x4C, 0x00,
+  0x0F, 0x12, 0xE4, 0x06, 0xE0, 0x06, 0xEF, 0xD4, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x02, 0x22, 0x27, 0xF4, 0x22, 0x22,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x58, 0xF6, 0x55, 0x54,
+  0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x1B, 0xDE, 0xB3, 0x14, 0x00, 0xAC, 0x00, 0x00, 0x9B, 0x00, 0x05, 0xE2,
+  0x00, 0x6E, 0x30, 0x08, 0xD2, 0x00, 0x3F, 0xFE, 0xEE, 0x0B, 0xDE, 0xC4,
+  0x00, 0x20, 0x08, 0xE0, 0x00, 0x00, 0x9A, 0x00, 0x0A, 0xFE, 0x50, 0x00,
+  0x00, 0x7F, 0x11, 0x10, 0x06, 0xF1, 0x2C, 0xEE, 0xC4, 0x00, 0x00, 0x47,
+  0x10, 0x2E, 0x80, 0x0B, 0xB0, 0x07, 0xD1, 0x00, 0x8F, 0x10, 0x00, 0x0F,
+  0x80, 0x8F, 0x10, 0x00, 0x0F, 0x80, 0x8F, 0x10, 0x00, 0x0F, 0x80, 0x8F,
+  0x10, 0x00, 0x0F, 0x80, 0x8F, 0x10, 0x00, 0x0F, 0x80, 0x8F, 0x10, 0x00,
+  0x0F, 0x80, 0x8F, 0x20, 0x00, 0x2F, 0x80, 0x8F, 0x60, 0x00, 0x7F, 0x90,
+  0x8F, 0xE9, 0x69, 0xEE, 0xD6, 0x8F, 0x5C, 0xFD, 0x48, 0xE9, 0x8F, 0x10,
+  0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00,
+  0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFF, 0x41, 0xDF,
+  0xFF, 0x71, 0xE4, 0x7F, 0xFF, 0xF7, 0x0E, 0x49, 0xFF, 0xFF, 0x70, 0xE4,
+  0x7F, 0xFF, 0xF7, 0x0E, 0x42, 0xEF, 0xFF, 0x70, 0xE4, 0x04, 0xDF, 0xF7,
+  0x0E, 0x40, 0x00, 0x2C, 0x70, 0xE4, 0x00, 0x00, 0xC7, 0x0E, 0x40, 0x00,
+  0x0C, 0x70, 0xE4, 0x00, 0x00, 0xC7, 0x0E, 0x40, 0x00, 0x0C, 0x70, 0xE4,
+  0x00, 0x00, 0xC7, 0x0E, 0x40, 0x00, 0x0C, 0x70, 0xE4, 0x00, 0x00, 0x74,
+  0x08, 0x30, 0x03, 0x22, 0xFB, 0x2F, 0xB0, 0x00, 0x41, 0x00, 0x6B, 0x10,
+  0x4F, 0x7F, 0xFA, 0x01, 0x10, 0x9D, 0xF5, 0x00, 0x31, 0xE5, 0x00, 0x00,
+  0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE5, 0x00, 0x9E,
+  0xFE, 0xE1, 0x01, 0x9D, 0xEB, 0x20, 0x09, 0xD2, 0x19, 0xD1, 0x0F, 0x50,
+  0x01, 0xF5, 0x2F, 0x30, 0x00, 0xD6, 0x0F, 0x50, 0x01, 0xF5, 0x09, 0xD2,
+  0x19, 0xD1, 0x01, 0x9D, 0xEB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+  0xFF, 0xF2, 0x57, 0x00, 0x84, 0x00, 0x03, 0xE9, 0x07, 0xF5, 0x00, 0x03,
+  0xEA, 0x07, 0xF7, 0x00, 0x02, 0xE9, 0x06, 0xF5, 0x00, 0x8F, 0x51, 0xBD,
+  0x20, 0xAE, 0x42, 0xCC, 0x10, 0x5D, 0x30, 0x9B, 0x10, 0x03, 0x20, 0x04,
+  0x00, 0x00, 0x36, 0x83, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0xA9, 0xE5,
+  0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x05, 0xE1,
+  0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x1D, 0x70, 0x00, 0x00, 0x00, 0xE5,
+  0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x02, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0xE5, 0x00, 0x0B, 0xA0, 0x00, 0x28, 0x30, 0x9E, 0xFE,
+  0xE2, 0x5E, 0x20, 0x01, 0xCE, 0x50, 0x00, 0x00, 0x01, 0xD7, 0x00, 0x09,
+  0x6D, 0x50, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x69, 0x0D, 0x50, 0x00, 0x00,
+  0x2F, 0x40, 0x03, 0xC1, 0x0D, 0x50, 0x00, 0x00, 0xAA, 0x00, 0x07, 0xEE,
+  0xEF, 0xF7, 0x00, 0x04, 0xE2, 0x00, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x0C,
+  0x70, 0x00, 0x00, 0x00, 0x09, 0x40, 0x9D, 0xF5, 0x00, 0x00, 0x00, 0x7D,
+  0x10, 0x04, 0x3E, 0x50, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0xE5, 0x00,
+  0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x04, 0xE2, 0x00, 0x00,
+  0x00, 0xE5, 0x00, 0x01, 0xD7, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x8C,
+  0x00, 0x00, 0x00, 0x9E, 0xFE, 0xE2, 0x3F, 0x32, 0xEE, 0xEB, 0x20, 0x00,
+  0x00, 0x0B, 0x90, 0x00, 0x01, 0xAC, 0x00, 0x00, 0x06, 0xE1, 0x00, 0x00,
+  0x09, 0xB0, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x9B,
+  0x00, 0x00, 0x06, 0xD3, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x08, 0xC2, 0x00,
+  0x00, 0x0C, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x0A, 0xEE, 0xB3, 0x00,
+  0x00, 0x06, 0xD1, 0x00, 0x00, 0x30, 0x09, 0xD0, 0x00, 0x01, 0xE6, 0x00,
+  0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x0B, 0xFE,
+  0x30, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x00, 0x0B, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x04, 0xF2, 0x00, 0x00, 0x00, 0x14,
+  0x01, 0x9E, 0x00, 0xD8, 0x00, 0x04, 0xB4, 0x01, 0xBE, 0xEB, 0x30, 0x7D,
+  0x10, 0x01, 0xCE, 0x50, 0x00, 0x00, 0x00, 0x1E, 0x50, 0x00, 0xA5, 0xD5,
+  0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x69, 0x0D, 0x50, 0x00, 0x00, 0x03,
+  0xF3, 0x00, 0x3C, 0x00, 0xD5, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x07, 0xEE,
+  0xEF, 0xF7, 0x00, 0x00, 0x5E, 0x20, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00,
+  0x0C, 0x70, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+  0x0B, 0xF0, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00,
+  0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x01,
+  0xDE, 0x30, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0xBF,
+  0x10, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x51, 0x4F, 0xE8, 0x7C, 0xF1, 0x04,
+  0xCE, 0xDB, 0x40, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x8E,
+  0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x9E, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0, 0x0D, 0xB0, 0x00, 0x00, 0x1F, 0x80,
+  0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30, 0x02, 0xF7, 0x00, 0x00, 0xCD, 0x22,
+  0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x08, 0xF5, 0x55,
+  0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00, 0x00, 0x0A, 0xE0, 0x4F, 0x70, 0x00,
+  0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9,
+  0x9E, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0,
+  0x0D, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30,
+  0x02, 0xF7, 0x00, 0x00, 0xCD, 0x22, 0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x30, 0x08, 0xF5, 0x55, 0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00,
+  0x00, 0x0A, 0xE0, 0x4F, 0x70, 0x00, 0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00,
+  0x00, 0x01, 0xFB, 0x00, 0x00, 0x07, 0x71, 0x00, 0x00, 0x00, 0x00, 0xAA,
+  0x9B, 0x00, 0x00, 0x00, 0x03, 0x60, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x8E,
+  0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x9E, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0, 0x0D, 0xB0, 0x00, 0x00, 0x1F, 0x80,
+  0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30, 0x02, 0xF7, 0x00, 0x00, 0xCD, 0x22,
+  0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x08, 0xF5, 0x55,
+  0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00, 0x00, 0x0A, 0xE0, 0x4F, 0x70, 0x00,
+  0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x03, 0xDB,
+  0x35, 0xB0, 0x00, 0x00, 0x0B, 0x76, 0xEF, 0x50, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9,
+  0x9E, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0,
+  0x0D, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30,
+  0x02, 0xF7, 0x00, 0x00, 0xCD, 0x22, 0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x30, 0x08, 0xF5, 0x55, 0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00,
+  0x00, 0x0A, 0xE0, 0x4F, 0x70, 0x00, 0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00,
+  0x00, 0x01, 0xFB, 0x00, 0x08, 0xF3, 0x3F, 0x90, 0x00, 0x00, 0x06, 0xC2,
+  0x2C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xD9,
+  0x9E, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x3F, 0x50, 0x00, 0x00, 0x0A, 0xD0,
+  0x0D, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF1, 0x00, 0x00, 0x6F, 0x30,
+  0x02, 0xF7, 0x00, 0x00, 0xCD, 0x22, 0x22, 0xCD, 0x00, 0x02, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x30, 0x08, 0xF5, 0x55, 0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00,
+  0x00, 0x0A, 0xE0, 0x4F, 0x70, 0x00, 0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00,
+  0x00, 0x01, 0xFB, 0x00, 0x00, 0x5C, 0xD5, 0x00, 0x00, 0x00, 0x02, 0xE5,
+  0x4E, 0x20, 0x00, 0x00, 0x04, 0xB0, 0x0B, 0x50, 0x00, 0x00, 0x02, 0xE3,
+  0x2E, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAE,
+  0xEA, 0x00, 0x00, 0x00, 0x01, 0xE9, 0x9F, 0x10, 0x00, 0x00, 0x06, 0xF4,
+  0x3F, 0x60, 0x00, 0x00, 0x0B, 0xD0, 0x0D, 0xC0, 0x00, 0x00, 0x2F, 0x80,
+  0x07, 0xF2, 0x00, 0x00, 0x7F, 0x30, 0x02, 0xF8, 0x00, 0x00, 0xDD, 0x22,
+  0x22, 0xCD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x09, 0xF5, 0x55,
+  0x55, 0x5E, 0x90, 0x0E, 0xB0, 0x00, 0x00, 0x0A, 0xE1, 0x5F, 0x70, 0x00,
+  0x00, 0x06, 0xF5, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x0B,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0x9F, 0xB7, 0x77,
+  0x77, 0x60, 0x00, 0x00, 0x9F, 0x34, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0xB0, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x04, 0xF9,
+  0x22, 0x22, 0x21, 0x00, 0x00, 0xCD, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x90,
+  0x00, 0x4F, 0x60, 0x04, 0xFA, 0x55, 0x55, 0x53, 0x00, 0x0A, 0xE2, 0x22,
+  0x5F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x65, 0x55, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xB0,
+  0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x4F, 0xB7,
+  0x77, 0x77, 0x70, 0xBE, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+  0x00, 0x17, 0xCE, 0xFD, 0x93, 0x00, 0x2D, 0xFC, 0x87, 0x9D, 0xF4, 0x1D,
+  0xF5, 0x00, 0x00, 0x06, 0x57, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x10,
+  0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
+  0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x10, 0x00, 0x00,
+  0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF5, 0x00, 0x00, 0x06,
+  0x40, 0x3D, 0xFB, 0x87, 0x9D, 0xF4, 0x00, 0x17, 0xCF, 0xFD, 0xA3, 0x00,
+  0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x03, 0x2B, 0x90, 0x00, 0x00, 0x00, 0xCF, 0xC2, 0x00, 0x00, 0x00, 0x17,
+  0x40, 0x00, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xD4, 0xFB, 0x77, 0x77,
+  0x76, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x82,
+  0x22, 0x22, 0x14, 0xFF, 0xFF, 0xFF, 0xF9, 0x4F, 0xA5, 0x55, 0x55, 0x34,
+  0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00,
+  0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xFB, 0x77, 0x77, 0x77, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x09, 0xC1, 0x00,
+  0x00, 0x02, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xD4, 0xFB, 0x77, 0x77, 0x76, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7,
+  0x00, 0x00, 0x00, 0x4F, 0x82, 0x22, 0x22, 0x14, 0xFF, 0xFF, 0xFF, 0xF9,
+  0x4F, 0xA5, 0x55, 0x55, 0x34, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00,
+  0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xFB,
+  0x77, 0x77, 0x77, 0x4F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0x86, 0x00,
+  0x00, 0x01, 0xD7, 0xC7, 0x00, 0x00, 0x55, 0x01, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xD4, 0xFB, 0x77, 0x77, 0x76, 0x4F,
+  0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x82, 0x22, 0x22,
+  0x14, 0xFF, 0xFF, 0xFF, 0xF9, 0x4F, 0xA5, 0x55, 0x55, 0x34, 0xF7, 0x00,
+  0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F,
+  0x70, 0x00, 0x00, 0x04, 0xFB, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0xCE, 0x06, 0xF5, 0x00, 0x09, 0xB0, 0x5C, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFD, 0x4F, 0xB7, 0x77, 0x77, 0x64,
+  0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF8, 0x22, 0x22,
+  0x21, 0x4F, 0xFF, 0xFF, 0xFF, 0x94, 0xFA, 0x55, 0x55, 0x53, 0x4F, 0x70,
+  0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04,
+  0xF7, 0x00, 0x00, 0x00, 0x4F, 0xB7, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x28, 0x20, 0x08, 0xD1, 0x00, 0x64, 0x00, 0x00, 0x04, 0xF7, 0x04,
+  0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04,
+  0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x04, 0xF7, 0x01,
+  0x73, 0x0B, 0xA0, 0x37, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x4F, 0x70, 0x4F,
+  0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F,
+  0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F, 0x70, 0x4F, 0x70, 0x03, 0x85, 0x03,
+  0xD6, 0xD5, 0x63, 0x02, 0x70, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x4F, 0x70,
+  0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7,
+  0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F, 0x70, 0x04, 0xF7, 0x00, 0x4F,
+  0x70, 0x04, 0xF7, 0x00, 0xEC, 0x09, 0xF2, 0xB9, 0x07, 0xC2, 0x00, 0x00,
+  0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7,
+  0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7,
+  0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7, 0x00, 0x04, 0xF7,
+  0x00, 0x04, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xEC, 0x94, 0x00, 0x00, 0x3F,
+  0xB7, 0x78, 0xAE, 0xFA, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1A, 0xF9, 0x00,
+  0x3F, 0x80, 0x00, 0x00, 0x0D, 0xF2, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+  0x60, 0x3F, 0x90, 0x00, 0x00, 0x04, 0xF8, 0xEF, 0xFF, 0xFF, 0x70, 0x00,
+  0x4F, 0x93, 0x5F, 0xA3, 0x31, 0x00, 0x04, 0xF8, 0x03, 0xF8, 0x00, 0x00,
+  0x00, 0x7F, 0x60, 0x3F, 0x80, 0x00, 0x00, 0x0D, 0xF2, 0x03, 0xF8, 0x00,
+  0x00, 0x1A, 0xF9, 0x00, 0x3F, 0xB7, 0x78, 0xAE, 0xFA, 0x00, 0x03, 0xFF,
+  0xFF, 0xEC, 0x94, 0x00, 0x00, 0x00, 0x09, 0xD8, 0x1B, 0x50, 0x00, 0x02,
+  0xE3, 0x9F, 0xD1, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x4F, 0x74, 0xFF, 0xD0, 0x00,
+  0x04, 0xF7, 0x4F, 0xCF, 0x60, 0x00, 0x4F, 0x74, 0xF7, 0xDD, 0x00, 0x04,
+  0xF7, 0x4F, 0x65, 0xF6, 0x00, 0x4F, 0x74, 0xF6, 0x0C, 0xE1, 0x04, 0xF7,
+  0x4F, 0x60, 0x4F, 0x70, 0x4F, 0x74, 0xF6, 0x00, 0xCE, 0x14, 0xF7, 0x4F,
+  0x60, 0x04, 0xF8, 0x4F, 0x74, 0xF6, 0x00, 0x0B, 0xE5, 0xF7, 0x4F, 0x60,
+  0x00, 0x3F, 0xCF, 0x74, 0xF6, 0x00, 0x00, 0xAF, 0xF7, 0x4F, 0x60, 0x00,
+  0x02, 0xFF, 0x70, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7,
+  0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00,
+  0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xED, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00,
+  0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x03, 0xEF, 0xA7,
+  0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE, 0xEC, 0x71, 0x00, 0x00, 0x00, 0x01,
+  0xD9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE,
+  0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7, 0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00,
+  0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00,
+  0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
+  0x00, 0x00, 0xFD, 0xED, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00,
+  0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00, 0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00,
+  0x00, 0x6F, 0xC0, 0x03, 0xEF, 0xA7, 0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE,
+  0xEC, 0x71, 0x00, 0x00, 0x00, 0x4F, 0xE2, 0x00, 0x00, 0x00, 0x01, 0xD6,
+  0x7C, 0x00, 0x00, 0x00, 0x04, 0x50, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7,
+  0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00,
+  0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xED, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00,
+  0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x03, 0xEF, 0xA7,
+  0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE, 0xEC, 0x71, 0x00, 0x00, 0x04, 0xDB,
+  0x36, 0xA0, 0x00, 0x00, 0x0C, 0x66, 0xEE, 0x40, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE,
+  0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7, 0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00,
+  0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00,
+  0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
+  0x00, 0x00, 0xFD, 0xED, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00,
+  0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00, 0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00,
+  0x00, 0x6F, 0xC0, 0x03, 0xEF, 0xA7, 0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE,
+  0xEC, 0x71, 0x00, 0x00, 0x07, 0xC2, 0x3C, 0x60, 0x00, 0x00, 0x09, 0xF2,
+  0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xEC, 0x71, 0x00, 0x03, 0xDF, 0xB7,
+  0x7B, 0xFD, 0x20, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x7F, 0x80, 0x00,
+  0x00, 0x09, 0xF5, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0xEE, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xED, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0xCF, 0x10, 0x00, 0x00, 0x03, 0xFA, 0x7F, 0x70, 0x00,
+  0x00, 0x09, 0xF5, 0x1D, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x03, 0xEF, 0xA7,
+  0x7B, 0xFD, 0x20, 0x00, 0x18, 0xDE, 0xEC, 0x71, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x15, 0x05, 0xF8, 0x00, 0x00, 0x1B, 0xF2, 0x08, 0xF8, 0x00, 0x1B,
+  0xF5, 0x00, 0x08, 0xF8, 0x0B, 0xF5, 0x00, 0x00, 0x08, 0xFD, 0xF5, 0x00,
+  0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00,
+  0x0A, 0xF5, 0x09, 0xF7, 0x00, 0x0A, 0xF6, 0x00, 0x09, 0xF7, 0x05, 0xF6,
+  0x00, 0x00, 0x09, 0xF2, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0xCE, 0xEC, 0x70, 0x9B, 0x03, 0xDF,
+  0xB7, 0x7C, 0xFD, 0xE2, 0x1D, 0xF4, 0x00, 0x00, 0x9F, 0xB0, 0x7F, 0x80,
+  0x00, 0x03, 0xD9, 0xF4, 0xCF, 0x10, 0x00, 0x2D, 0x42, 0xF9, 0xEE, 0x00,
+  0x01, 0xD6, 0x00, 0xFC, 0xFD, 0x00, 0x1C, 0x80, 0x00, 0xFD, 0xEE, 0x00,
+  0xAA, 0x00, 0x01, 0xFC, 0xCF, 0x28, 0xC1, 0x00, 0x04, 0xFA, 0x7F, 0xCE,
+  0x20, 0x00, 0x0A, 0xF5, 0x1D, 0xF7, 0x00, 0x00, 0x6F, 0xC0, 0x3E, 0xEF,
+  0xB7, 0x7B, 0xFD, 0x20, 0xD7, 0x17, 0xCF, 0xEC, 0x71, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xE1, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06,
+  0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6,
+  0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F,
+  0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x50,
+  0x00, 0x00, 0x6F, 0x55, 0xF7, 0x00, 0x00, 0x09, 0xF3, 0x1E, 0xD1, 0x00,
+  0x02, 0xED, 0x00, 0x6F, 0xE9, 0x79, 0xEF, 0x50, 0x00, 0x4B, 0xEF, 0xEA,
+  0x30, 0x00, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x02, 0xE5, 0x00,
+  0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F,
+  0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40,
+  0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00,
+  0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x50, 0x00, 0x00,
+  0x6F, 0x55, 0xF7, 0x00, 0x00, 0x09, 0xF3, 0x1E, 0xD1, 0x00, 0x02, 0xED,
+  0x00, 0x6F, 0xE9, 0x79, 0xEF, 0x50, 0x00, 0x4B, 0xEF, 0xEA, 0x30, 0x00,
+  0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x50, 0x00, 0x00,
+  0x07, 0x20, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
+  0x00, 0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00,
+  0x00, 0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00,
+  0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F,
+  0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x50, 0x00, 0x00, 0x6F, 0x55,
+  0xF7, 0x00, 0x00, 0x09, 0xF3, 0x1E, 0xD1, 0x00, 0x02, 0xED, 0x00, 0x6F,
+  0xE9, 0x79, 0xEF, 0x50, 0x00, 0x4B, 0xEF, 0xEA, 0x30, 0x00, 0x00, 0x1C,
+  0x70, 0x8C, 0x00, 0x00, 0x01, 0xFA, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+  0x6F, 0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F,
+  0x67, 0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67,
+  0xF4, 0x00, 0x00, 0x06, 0xF6, 0x7F, 0x40, 0x00, 0x00, 0x6F, 0x67, 0xF4,
+  0x00, 0x00, 0x06, 0xF6, 0x7F, 0x50, 0x00, 0x00, 0x6F, 0x55, 0xF7, 0x00,
+  0x00, 0x09, 0xF3, 0x1E, 0xD1, 0x00, 0x02, 0xED, 0x00, 0x6F, 0xE9, 0x79,
+  0xEF, 0x50, 0x00, 0x4B, 0xEF, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x03, 0x72,
+  0x00, 0x00, 0x00, 0x01, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x6F, 0x71,
+  0xEC, 0x00, 0x00, 0x2E, 0xC0, 0x05, 0xF7, 0x00, 0x0B, 0xF2, 0x00, 0x0A,
+  0xF3, 0x06, 0xF7, 0x00, 0x00, 0x1E, 0xC2, 0xEC, 0x00, 0x00, 0x00, 0x5F,
+  0xEF, 0x20, 0x00, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x07, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x04, 0xF8,
+  0x22, 0x10, 0x00, 0x4F, 0xFF, 0xFF, 0xD5, 0x04, 0xFA, 0x55, 0x7E, 0xF5,
+  0x4F, 0x70, 0x00, 0x3F, 0xC4, 0xF7, 0x00, 0x00, 0xDF, 0x4F, 0x70, 0x00,
+  0x0D, 0xF4, 0xF7, 0x00, 0x02, 0xFD, 0x4F, 0x82, 0x24, 0xCF, 0x74, 0xFF,
+  0xFF, 0xFF, 0x80, 0x4F, 0xA5, 0x54, 0x10, 0x04, 0xF7, 0x00, 0x00, 0x00,
+  0x4F, 0x70, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0x0B, 0xF8,
+  0x68, 0xF8, 0x00, 0x3F, 0x70, 0x00, 0x8E, 0x00, 0x6F, 0x40, 0x04, 0xBF,
+  0x20, 0x6F, 0x30, 0x7F, 0x72, 0x00, 0x6F, 0x30, 0xE9, 0x00, 0x00, 0x6F,
+  0x30, 0xFA, 0x00, 0x00, 0x6F, 0x30, 0xAF, 0x91, 0x00, 0x6F, 0x30, 0x1A,
+  0xFD, 0x20, 0x6F, 0x30, 0x00, 0x5E, 0xD0, 0x6F, 0x30, 0x00, 0x07, 0xF4,
+  0x6F, 0x30, 0x00, 0x07, 0xF3, 0x6F, 0x39, 0x76, 0x7E, 0xC0, 0x6F, 0x3A,
+  0xEF, 0xD9, 0x20, 0x04, 0x71, 0x00, 0x00, 0x00, 0x1C, 0xA0, 0x00, 0x00,
+  0x00, 0x1D, 0x70, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x8C, 0xEF, 0xC6, 0x00, 0x4D, 0x86, 0x7C, 0xF7, 0x01, 0x00,
+  0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x6C, 0xFF, 0xFF, 0xF3,
+  0x7F, 0x95, 0x43, 0x8F, 0x3D, 0xB0, 0x00, 0x08, 0xF3, 0xDC, 0x00, 0x01,
+  0xEF, 0x38, 0xFA, 0x67, 0xEC, 0xF3, 0x08, 0xDF, 0xD6, 0x6F, 0x30, 0x00,
+  0x00, 0x07, 0x60, 0x00, 0x00, 0x07, 0xE2, 0x00, 0x00, 0x04, 0xE3, 0x00,
+  0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF,
+  0xC6, 0x00, 0x4D, 0x86, 0x7C, 0xF7, 0x01, 0x00, 0x00, 0x0B, 0xE0, 0x00,
+  0x00, 0x00, 0x7F, 0x20, 0x6C, 0xFF, 0xFF, 0xF3, 0x7F, 0x95, 0x43, 0x8F,
+  0x3D, 0xB0, 0x00, 0x08, 0xF3, 0xDC, 0x00, 0x01, 0xEF, 0x38, 0xFA, 0x67,
+  0xEC, 0xF3, 0x08, 0xDF, 0xD6, 0x6F, 0x30, 0x00, 0x05, 0x70, 0x00, 0x00,
+  0x04, 0xED, 0x70, 0x00, 0x01, 0xD5, 0x3E, 0x30, 0x00, 0x36, 0x00, 0x45,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xC6, 0x00, 0x4D, 0x86,
+  0x7C, 0xF7, 0x01, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x20,
+  0x6C, 0xFF, 0xFF, 0xF3, 0x7F, 0x95, 0x43, 0x8F, 0x3D, 0xB0, 0x00, 0x08,
+  0xF3, 0xDC, 0x00, 0x01, 0xEF, 0x38, 0xFA, 0x67, 0xEC, 0xF3, 0x08, 0xDF,
+  0xD6, 0x6F, 0x30, 0x03, 0xDD, 0x54, 0xD0, 0x00, 0x98, 0x5E, 0xF7, 0x00,
+  0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xFC,
+  0x60, 0x04, 0xD8, 0x67, 0xCF, 0x70, 0x10, 0x00, 0x00, 0xBE, 0x00, 0x00,
+  0x00, 0x07, 0xF2, 0x06, 0xCF, 0xFF, 0xFF, 0x37, 0xF9, 0x54, 0x38, 0xF3,
+  0xDB, 0x00, 0x00, 0x8F, 0x3D, 0xC0, 0x00, 0x1E, 0xF3, 0x8F, 0xA6, 0x7E,
+  0xCF, 0x30, 0x8D, 0xFD, 0x66, 0xF3, 0x07, 0xF4, 0x1F, 0xA0, 0x00, 0x5C,
+  0x31, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xCE, 0xFC, 0x60, 0x04, 0xD8, 0x67, 0xCF, 0x70, 0x10, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x06, 0xCF, 0xFF, 0xFF, 0x37, 0xF9,
+  0x54, 0x38, 0xF3, 0xDB, 0x00, 0x00, 0x8F, 0x3D, 0xC0, 0x00, 0x1E, 0xF3,
+  0x8F, 0xA6, 0x7E, 0xCF, 0x30, 0x8D, 0xFD, 0x66, 0xF3, 0x00, 0x4C, 0xD6,
+  0x00, 0x00, 0x1E, 0x54, 0xE3, 0x00, 0x03, 0xD0, 0x09, 0x60, 0x00, 0x1E,
+  0x31, 0xD4, 0x00, 0x00, 0x6E, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x18, 0xCE, 0xFC, 0x60, 0x04, 0xD8, 0x67, 0xCF, 0x70, 0x10, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x06, 0xCF, 0xFF, 0xFF, 0x37, 0xF9,
+  0x54, 0x38, 0xF3, 0xDB, 0x00, 0x00, 0x8F, 0x3D, 0xC0, 0x00, 0x1E, 0xF3,
+  0x8F, 0xA6, 0x7E, 0xCF, 0x30, 0x8D, 0xFD, 0x66, 0xF3, 0x18, 0xCE, 0xEC,
+  0x60, 0x3B, 0xEF, 0xC5, 0x00, 0x4D, 0x86, 0x7C, 0xFA, 0xFC, 0x76, 0xBF,
+  0x70, 0x10, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x00,
+  0x7F, 0x40, 0x00, 0x05, 0xF4, 0x06, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF5, 0x7F, 0x95, 0x43, 0x8F, 0x53, 0x33, 0x33, 0x31, 0xDB, 0x00, 0x00,
+  0x8F, 0x60, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x01, 0xEF, 0xD1, 0x00, 0x00,
+  0x10, 0x8F, 0xA6, 0x7E, 0xB5, 0xFD, 0x86, 0x7A, 0xF0, 0x08, 0xDF, 0xD8,
+  0x00, 0x3A, 0xEF, 0xDB, 0x60, 0x01, 0x8D, 0xFE, 0xB4, 0x1C, 0xFA, 0x67,
+  0xA8, 0x8F, 0x70, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00,
+  0x00, 0xFB, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00,
+  0x00, 0x1C, 0xFA, 0x67, 0xA8, 0x01, 0x8D, 0xFF, 0xB4, 0x00, 0x00, 0x5C,
+  0x00, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x22, 0x3F, 0x30, 0x00, 0x3E, 0xEA,
+  0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x07,
+  0xD1, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xDF, 0xEA, 0x20, 0x0C, 0xF9, 0x68, 0xED, 0x17, 0xF4, 0x00, 0x02,
+  0xF8, 0xDC, 0x00, 0x00, 0x0C, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0x33,
+  0x33, 0x33, 0x3D, 0xD0, 0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x11,
+  0xCF, 0xB7, 0x68, 0xD8, 0x00, 0x7C, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0x03,
+  0x82, 0x00, 0x00, 0x02, 0xE9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x20,
+  0x0C, 0xF9, 0x68, 0xED, 0x17, 0xF4, 0x00, 0x02, 0xF8, 0xDC, 0x00, 0x00,
+  0x0C, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0x33, 0x33, 0x33, 0x3D, 0xD0,
+  0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x11, 0xCF, 0xB7, 0x68, 0xD8,
+  0x00, 0x7C, 0xFE, 0xD9, 0x30, 0x00, 0x02, 0x83, 0x00, 0x00, 0x00, 0xBD,
+  0xD1, 0x00, 0x00, 0x7C, 0x1A, 0xA0, 0x00, 0x07, 0x20, 0x17, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x20, 0x0C, 0xF9, 0x68, 0xED,
+  0x17, 0xF4, 0x00, 0x02, 0xF8, 0xDC, 0x00, 0x00, 0x0C, 0xCF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xFC, 0x33, 0x33, 0x33, 0x3D, 0xD0, 0x00, 0x00, 0x00, 0x8F,
+  0x70, 0x00, 0x00, 0x11, 0xCF, 0xB7, 0x68, 0xD8, 0x00, 0x7C, 0xFE, 0xD9,
+  0x30, 0x00, 0xEC, 0x09, 0xF2, 0x00, 0x0B, 0x90, 0x7C, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00,
+  0xCF, 0x96, 0x8E, 0xD1, 0x7F, 0x40, 0x00, 0x2F, 0x8D, 0xC0, 0x00, 0x00,
+  0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xC3, 0x33, 0x33, 0x33, 0xDD, 0x00,
+  0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, 0x01, 0x1C, 0xFB, 0x76, 0x8D, 0x80,
+  0x07, 0xCF, 0xED, 0x93, 0x28, 0x30, 0x00, 0xAD, 0x10, 0x01, 0xD9, 0x00,
+  0x02, 0xE4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4,
+  0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F,
+  0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x00, 0x47, 0x10, 0x2E, 0x80, 0x0B,
+  0xB0, 0x06, 0xD1, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05,
+  0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x05, 0xF4, 0x00,
+  0x5F, 0x40, 0x05, 0xF4, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x38, 0x20, 0x00,
+  0xCE, 0xA0, 0x06, 0xD2, 0xE4, 0x1E, 0x40, 0x5D, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00,
+  0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00,
+  0x5F, 0x40, 0x00, 0x5F, 0x40, 0x2F, 0xA0, 0xBF, 0x1C, 0x70, 0x8C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00,
+  0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00,
+  0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x5F, 0x40, 0x01,
+  0xCE, 0x21, 0x57, 0x00, 0x02, 0xEE, 0xD9, 0x40, 0x1A, 0xDA, 0xEB, 0x00,
+  0x00, 0x40, 0x05, 0xF9, 0x00, 0x01, 0x9E, 0xFF, 0xF6, 0x01, 0xDF, 0x85,
+  0x6D, 0xE1, 0x8F, 0x50, 0x00, 0x5F, 0x6D, 0xD0, 0x00, 0x00, 0xFA, 0xFB,
+  0x00, 0x00, 0x0D, 0xCF, 0xB0, 0x00, 0x00, 0xEC, 0xDD, 0x00, 0x00, 0x1F,
+  0x98, 0xF5, 0x00, 0x09, 0xF4, 0x1C, 0xF9, 0x6A, 0xFA, 0x00, 0x19, 0xEF,
+  0xD7, 0x00, 0x00, 0x8E, 0xB2, 0xA7, 0x00, 0x1F, 0x39, 0xFE, 0x20, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x38, 0xEF, 0xC4,
+  0x06, 0xFD, 0x94, 0x4C, 0xE1, 0x6F, 0xA0, 0x00, 0x3F, 0x76, 0xF5, 0x00,
+  0x00, 0xE9, 0x6F, 0x30, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x6F,
+  0x30, 0x00, 0x0E, 0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x6F, 0x30, 0x00, 0x0E,
+  0xA6, 0xF3, 0x00, 0x00, 0xEA, 0x02, 0x83, 0x00, 0x00, 0x00, 0x09, 0xD1,
+  0x00, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xD8, 0x00, 0x1D, 0xF9, 0x6A, 0xFB,
+  0x08, 0xF5, 0x00, 0x09, 0xF5, 0xDD, 0x00, 0x00, 0x1F, 0xAF, 0xB0, 0x00,
+  0x00, 0xEC, 0xFB, 0x00, 0x00, 0x0E, 0xCD, 0xD0, 0x00, 0x01, 0xFA, 0x8F,
+  0x50, 0x00, 0x8F, 0x51, 0xDF, 0x86, 0xAF, 0xB0, 0x02, 0x9E, 0xFD, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x71, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x02,
+  0xE7, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xEF, 0xD8, 0x00, 0x1D, 0xF9, 0x6A, 0xFB, 0x08, 0xF5, 0x00, 0x09,
+  0xF5, 0xDD, 0x00, 0x00, 0x1F, 0xAF, 0xB0, 0x00, 0x00, 0xEC, 0xFB, 0x00,
+  0x00, 0x0E, 0xCD, 0xD0, 0x00, 0x01, 0xFA, 0x8F, 0x50, 0x00, 0x8F, 0x51,
+  0xDF, 0x86, 0xAF, 0xB0, 0x02, 0x9E, 0xFD, 0x80, 0x00, 0x00, 0x03, 0x82,
+  0x00, 0x00, 0x01, 0xDD, 0xB0, 0x00, 0x00, 0xAA, 0x1C, 0x70, 0x00, 0x17,
+  0x10, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xD8, 0x00,
+  0x1D, 0xF9, 0x6A, 0xFB, 0x08, 0xF5, 0x00, 0x09, 0xF5, 0xDD, 0x00, 0x00,
+  0x1F, 0xAF, 0xB0, 0x00, 0x00, 0xEC, 0xFB, 0x00, 0x00, 0x0E, 0xCD, 0xD0,
+  0x00, 0x01, 0xFA, 0x8F, 0x50, 0x00, 0x8F, 0x51, 0xDF, 0x86, 0xAF, 0xB0,
+  0x02, 0x9E, 0xFD, 0x80, 0x00, 0x01, 0xBE, 0x81, 0xE2, 0x00, 0x5C, 0x3C,
+  0xFB, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x9E, 0xFD, 0x80, 0x01, 0xDF, 0x96, 0xAF, 0xB0, 0x8F, 0x50, 0x00, 0x9F,
+  0x5D, 0xD0, 0x00, 0x01, 0xFA, 0xFB, 0x00, 0x00, 0x0E, 0xCF, 0xB0, 0x00,
+  0x00, 0xEC, 0xDD, 0x00, 0x00, 0x1F, 0xA8, 0xF5, 0x00, 0x08, 0xF5, 0x1D,
+  0xF8, 0x6A, 0xFB, 0x00, 0x29, 0xEF, 0xD8, 0x00, 0x02, 0xF9, 0x0C, 0xE0,
+  0x00, 0x2C, 0x70, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x9E, 0xFD, 0x80, 0x01, 0xDF, 0x96, 0xAF, 0xB0, 0x8F,
+  0x50, 0x00, 0x9F, 0x5D, 0xD0, 0x00, 0x01, 0xFA, 0xFB, 0x00, 0x00, 0x0E,
+  0xCF, 0xB0, 0x00, 0x00, 0xEC, 0xDD, 0x00, 0x00, 0x1F, 0xA8, 0xF5, 0x00,
+  0x08, 0xF5, 0x1D, 0xF8, 0x6A, 0xFB, 0x00, 0x29, 0xEF, 0xD8, 0x00, 0x00,
+  0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x21, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00,
+  0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x19,
+  0xEE, 0xC7, 0x8C, 0x01, 0xDF, 0x96, 0xAF, 0xF2, 0x08, 0xF5, 0x00, 0x3E,
+  0xF4, 0x0D, 0xD0, 0x02, 0xD4, 0xF9, 0x0F, 0xB0, 0x1C, 0x60, 0xDB, 0x0F,
+  0xA0, 0xB9, 0x00, 0xEC, 0x0D, 0xC8, 0xB0, 0x01, 0xFA, 0x07, 0xFD, 0x10,
+  0x09, 0xF5, 0x05, 0xFE, 0x86, 0xAF, 0xB0, 0x2E, 0x69, 0xDF, 0xD8, 0x10,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x00, 0x08, 0xE2,
+  0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00, 0x0F,
+  0x88, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00,
+  0x00, 0xF8, 0x7F, 0x10, 0x00, 0x0F, 0x86, 0xF2, 0x00, 0x03, 0xF8, 0x4F,
+  0x60, 0x00, 0x9F, 0x80, 0xDF, 0x87, 0xBC, 0xF8, 0x02, 0xBF, 0xE9, 0x1F,
+  0x80, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x03, 0xE7, 0x00, 0x00, 0x01,
+  0xD7, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00,
+  0xF8, 0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00, 0xF8, 0x7F, 0x10,
+  0x00, 0x0F, 0x86, 0xF2, 0x00, 0x03, 0xF8, 0x4F, 0x60, 0x00, 0x9F, 0x80,
+  0xDF, 0x87, 0xBC, 0xF8, 0x02, 0xBF, 0xE9, 0x1F, 0x80, 0x00, 0x03, 0x82,
+  0x00, 0x00, 0x01, 0xDD, 0xC0, 0x00, 0x00, 0x9B, 0x0B, 0x80, 0x00, 0x17,
+  0x10, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xF8,
+  0x8F, 0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00,
+  0x0F, 0x88, 0xF1, 0x00, 0x00, 0xF8, 0x7F, 0x10, 0x00, 0x0F, 0x86, 0xF2,
+  0x00, 0x03, 0xF8, 0x4F, 0x60, 0x00, 0x9F, 0x80, 0xDF, 0x87, 0xBC, 0xF8,
+  0x02, 0xBF, 0xE9, 0x1F, 0x80, 0x01, 0xFA, 0x0B, 0xF0, 0x00, 0x1C, 0x80,
+  0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x10, 0x00, 0x0F, 0x88, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00, 0x0F,
+  0x88, 0xF1, 0x00, 0x00, 0xF8, 0x8F, 0x10, 0x00, 0x0F, 0x87, 0xF1, 0x00,
+  0x00, 0xF8, 0x6F, 0x20, 0x00, 0x3F, 0x84, 0xF6, 0x00, 0x09, 0xF8, 0x0D,
+  0xF8, 0x7B, 0xCF, 0x80, 0x2B, 0xFE, 0x91, 0xF8, 0x00, 0x00, 0x01, 0xDB,
+  0x00, 0x00, 0x00, 0x09, 0xD1, 0x00, 0x00, 0x00, 0x5E, 0x20, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0xEB, 0x0D, 0xC0, 0x00,
+  0x05, 0xF5, 0x08, 0xF2, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x2F, 0x90,
+  0x00, 0xBD, 0x00, 0x7F, 0x30, 0x00, 0x5F, 0x40, 0xDC, 0x00, 0x00, 0x0E,
+  0xA3, 0xF6, 0x00, 0x00, 0x08, 0xFA, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x03, 0x6C, 0xE1, 0x00, 0x00, 0x09, 0xFD, 0x40,
+  0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00,
+  0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x38,
+  0xEF, 0xC3, 0x00, 0x6F, 0xCC, 0x67, 0xEF, 0x30, 0x6F, 0xC1, 0x00, 0x2F,
+  0xB0, 0x6F, 0x60, 0x00, 0x0A, 0xF1, 0x6F, 0x40, 0x00, 0x07, 0xF3, 0x6F,
+  0x40, 0x00, 0x07, 0xF3, 0x6F, 0x60, 0x00, 0x0A, 0xF1, 0x6F, 0xC0, 0x00,
+  0x2F, 0xB0, 0x6F, 0xCC, 0x67, 0xDF, 0x30, 0x6F, 0x38, 0xEF, 0xC4, 0x00,
+  0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x30,
+  0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x60, 0xFC,
+  0x00, 0x00, 0x4C, 0x50, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0xEB, 0x0D, 0xC0, 0x00,
+  0x05, 0xF5, 0x08, 0xF2, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x2F, 0x90,
+  0x00, 0xBD, 0x00, 0x7F, 0x30, 0x00, 0x5F, 0x40, 0xDC, 0x00, 0x00, 0x0E,
+  0xA3, 0xF6, 0x00, 0x00, 0x08, 0xFA, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x03, 0x6C, 0xE1, 0x00, 0x00, 0x09, 0xFD, 0x40,
+  0x00, 0x00 };
+
+const GFXglyph DejaVuSans9pt8bAa4Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   3,  13,   7,    2,  -13 },   // 0x21 '!'
+  {    20,   6,   5,   8,    1,  -13 },   // 0x22 '"'
+  {    35,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {   120,   9,  17,  11,    1,  -14 },   // 0x24 '$'
+  {   197,  15,  13,  17,    1,  -13 },   // 0x25 '%'
+  {   295,  12,  13,  14,    1,  -13 },   // 0x26 '&'
+  {   373,   3,   5,   5,    1,  -13 },   // 0x27 '''
+  {   381,   5,  16,   7,    1,  -14 },   // 0x28 '('
+  {   421,   5,  16,   7,    1,  -14 },   // 0x29 ')'
+  {   461,   9,   9,   9,    0,  -13 },   // 0x2A '*'
+  {   502,  12,  12,  15,    1,  -12 },   // 0x2B '+'
+  {   574,   3,   5,   6,    1,   -3 },   // 0x2C ','
+  {   582,   6,   3,   6,    0,   -6 },   // 0x2D '-'
+  {   591,   3,   3,   6,    1,   -3 },   // 0x2E '.'
+  {   596,   6,  15,   6,    0,  -13 },   // 0x2F '/'
+  {   641,   9,  13,  11,    1,  -13 },   // 0x30 '0'
+  {   700,   9,  13,  11,    1,  -13 },   // 0x31 '1'
+  {   759,   9,  13,  11,    1,  -13 },   // 0x32 '2'
+  {   818,   9,  13,  11,    1,  -13 },   // 0x33 '3'
+  {   877,  11,  13,  11,    0,  -13 },   // 0x34 '4'
+  {   949,   9,  13,  11,    1,  -13 },   // 0x35 '5'
+  {  1008,  10,  13,  11,    1,  -13 },   // 0x36 '6'
+  {  1073,   9,  13,  11,    1,  -13 },   // 0x37 '7'
+  {  1132,   9,  13,  11,    1,  -13 },   // 0x38 '8'
+  {  1191,   9,  13,  11,    1,  -13 },   // 0x39 '9'
+  {  1250,   2,  10,   6,    2,  -10 },   // 0x3A ':'
+  {  1260,   3,  12,   6,    1,  -10 },   // 0x3B ';'
+  {  1278,  12,  11,  15,    1,  -11 },   // 0x3C '<'
+  {  1344,  12,   7,  15,    1,   -9 },   // 0x3D '='
+  {  1386,  12,  10,  15,    1,  -11 },   // 0x3E '>'
+  {  1446,   8,  13,   9,    1,  -13 },   // 0x3F '?'
+  {  1498,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {  1626,  12,  13,  12,    0,  -13 },   // 0x41 'A'
+  {  1704,  10,  13,  12,    1,  -13 },   // 0x42 'B'
+  {  1769,  11,  13,  12,    1,  -13 },   // 0x43 'C'
+  {  1841,  12,  13,  14,    1,  -13 },   // 0x44 'D'
+  {  1919,   9,  13,  11,    1,  -13 },   // 0x45 'E'
+  {  1978,   9,  13,  10,    1,  -13 },   // 0x46 'F'
+  {  2037,  12,  13,  14,    1,  -13 },   // 0x47 'G'
+  {  2115,  11,  13,  13,    1,  -13 },   // 0x48 'H'
+  {  2187,   3,  13,   5,    1,  -13 },   // 0x49 'I'
+  {  2207,   5,  17,   5,   -1,  -13 },   // 0x4A 'J'
+  {  2250,  11,  13,  12,    1,  -13 },   // 0x4B 'K'
+  {  2322,   9,  13,  10,    1,  -13 },   // 0x4C 'L'
+  {  2381,  13,  13,  15,    1,  -13 },   // 0x4D 'M'
+  {  2466,  11,  13,  13,    1,  -13 },   // 0x4E 'N'
+  {  2538,  12,  13,  14,    1,  -13 },   // 0x4F 'O'
+  {  2616,   9,  13,  11,    1,  -13 },   // 0x50 'P'
+  {  2675,  12,  15,  14,    1,  -13 },   // 0x51 'Q'
+  {  2765,  11,  13,  12,    1,  -13 },   // 0x52 'R'
+  {  2837,  10,  13,  11,    1,  -13 },   // 0x53 'S'
+  {  2902,  12,  13,  11,   -1,  -13 },   // 0x54 'T'
+  {  2980,  11,  13,  13,    1,  -13 },   // 0x55 'U'
+  {  3052,  12,  13,  12,    0,  -13 },   // 0x56 'V'
+  {  3130,  17,  13,  17,    0,  -13 },   // 0x57 'W'
+  {  3241,  12,  13,  12,    0,  -13 },   // 0x58 'X'
+  {  3319,  11,  13,  11,    0,  -13 },   // 0x59 'Y'
+  {  3391,  12,  13,  12,    0,  -13 },   // 0x5A 'Z'
+  {  3469,   5,  17,   7,    1,  -14 },   // 0x5B '['
+  {  3512,   6,  15,   6,    0,  -13 },   // 0x5C '\'
+  {  3557,   5,  17,   7,    1,  -14 },   // 0x5D ']'
+  {  3600,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  3628,  10,   2,   9,   -1,    3 },   // 0x5F '_'
+  {  3638,   5,   4,   9,    1,  -15 },   // 0x60 '`'
+  {  3648,   9,  10,  11,    1,  -10 },   // 0x61 'a'
+  {  3693,  10,  14,  11,    1,  -14 },   // 0x62 'b'
+  {  3763,   8,  10,  10,    1,  -10 },   // 0x63 'c'
+  {  3803,   9,  14,  11,    1,  -14 },   // 0x64 'd'
+  {  3866,   9,  10,  11,    1,  -10 },   // 0x65 'e'
+  {  3911,   7,  14,   6,    0,  -14 },   // 0x66 'f'
+  {  3960,   9,  14,  11,    1,  -10 },   // 0x67 'g'
+  {  4023,   9,  14,  11,    1,  -14 },   // 0x68 'h'
+  {  4086,   3,  14,   5,    1,  -14 },   // 0x69 'i'
+  {  4107,   5,  18,   5,   -1,  -14 },   // 0x6A 'j'
+  {  4152,   9,  14,  10,    1,  -14 },   // 0x6B 'k'
+  {  4215,   3,  14,   5,    1,  -14 },   // 0x6C 'l'
+  {  4236,  15,  10,  17,    1,  -10 },   // 0x6D 'm'
+  {  4311,   9,  10,  11,    1,  -10 },   // 0x6E 'n'
+  {  4356,   9,  10,  11,    1,  -10 },   // 0x6F 'o'
+  {  4401,  10,  14,  11,    1,  -10 },   // 0x70 'p'
+  {  4471,   9,  14,  11,    1,  -10 },   // 0x71 'q'
+  {  4534,   7,  10,   7,    1,  -10 },   // 0x72 'r'
+  {  4569,   9,  10,   9,    0,  -10 },   // 0x73 's'
+  {  4614,   7,  13,   7,    0,  -13 },   // 0x74 't'
+  {  4660,   9,  10,  11,    1,  -10 },   // 0x75 'u'
+  {  4705,  10,  10,  10,    0,  -10 },   // 0x76 'v'
+  {  4755,  14,  10,  14,    0,  -10 },   // 0x77 'w'
+  {  4825,  10,  10,  10,    0,  -10 },   // 0x78 'x'
+  {  4875,  10,  14,  10,    0,  -10 },   // 0x79 'y'
+  {  4945,   9,  10,   9,    0,  -10 },   // 0x7A 'z'
+  {  4990,   7,  17,  11,    2,  -14 },   // 0x7B '{'
+  {  5050,   2,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  5068,   7,  17,  11,    2,  -14 },   // 0x7D '}'
+  {  5128,  12,   4,  15,    1,   -8 },   // 0x7E '~'
+  {  5152,  10,  17,  11,    0,  -13 },   // 0x7F
+  {  5237,  10,  17,  11,    0,  -13 },   // 0x80
+  {  5322,  10,  17,  11,    0,  -13 },   // 0x81
+  {  5407,  10,  17,  11,    0,  -13 },   // 0x82
+  {  5492,  10,  17,  11,    0,  -13 },   // 0x83
+  {  5577,  10,  17,  11,    0,  -13 },   // 0x84
+  {  5662,  10,  17,  11,    0,  -13 },   // 0x85
+  {  5747,  10,  17,  11,    0,  -13 },   // 0x86
+  {  5832,  10,  17,  11,    0,  -13 },   // 0x87
+  {  5917,  10,  17,  11,    0,  -13 },   // 0x88
+  {  6002,  10,  17,  11,    0,  -13 },   // 0x89
+  {  6087,  10,  17,  11,    0,  -13 },   // 0x8A
+  {  6172,  10,  17,  11,    0,  -13 },   // 0x8B
+  {  6257,  10,  17,  11,    0,  -13 },   // 0x8C
+  {  6342,  10,  17,  11,    0,  -13 },   // 0x8D
+  {  6427,  10,  17,  11,    0,  -13 },   // 0x8E
+  {  6512,  10,  17,  11,    0,  -13 },   // 0x8F
+  {  6597,  10,  17,  11,    0,  -13 },   // 0x90
+  {  6682,  10,  17,  11,    0,  -13 },   // 0x91
+  {  6767,  10,  17,  11,    0,  -13 },   // 0x92
+  {  6852,  10,  17,  11,    0,  -13 },   // 0x93
+  {  6937,  10,  17,  11,    0,  -13 },   // 0x94
+  {  7022,  10,  17,  11,    0,  -13 },   // 0x95
+  {  7107,  10,  17,  11,    0,  -13 },   // 0x96
+  {  7192,  10,  17,  11,    0,  -13 },   // 0x97
+  {  7277,  10,  17,  11,    0,  -13 },   // 0x98
+  {  7362,  10,  17,  11,    0,  -13 },   // 0x99
+  {  7447,  10,  17,  11,    0,  -13 },   // 0x9A
+  {  7532,  10,  17,  11,    0,  -13 },   // 0x9B
+  {  7617,  10,  17,  11,    0,  -13 },   // 0x9C
+  {  7702,  10,  17,  11,    0,  -13 },   // 0x9D
+  {  7787,  10,  17,  11,    0,  -13 },   // 0x9E
+  {  7872,  10,  17,  11,    0,  -13 },   // 0x9F
+  {  7957,   0,   0,   6,    0,    1 },   // 0xA0
+  {  7957,   3,  13,   7,    2,  -10 },   // 0xA1
+  {  7977,   9,  16,  11,    1,  -13 },   // 0xA2
+  {  8049,   9,  13,  11,    1,  -13 },   // 0xA3
+  {  8108,  11,  11,  11,    0,  -11 },   // 0xA4
+  {  8169,  11,  13,  11,    0,  -13 },   // 0xA5
+  {  8241,   2,  16,   6,    2,  -13 },   // 0xA6
+  {  8257,   8,  16,   9,    0,  -13 },   // 0xA7
+  {  8321,   6,   2,   9,    1,  -14 },   // 0xA8
+  {  8327,  14,  13,  18,    2,  -13 },   // 0xA9
+  {  8418,   7,   9,   8,    1,  -13 },   // 0xAA
+  {  8450,   9,   8,  11,    1,   -9 },   // 0xAB
+  {  8486,  12,   6,  15,    1,   -8 },   // 0xAC
+  {  8522,   6,   3,   6,    0,   -6 },   // 0xAD
+  {  8531,  14,  13,  18,    2,  -13 },   // 0xAE
+  {  8622,   6,   3,   9,    1,  -14 },   // 0xAF
+  {  8631,   7,   6,   9,    1,  -13 },   // 0xB0
+  {  8652,  12,  12,  15,    1,  -12 },   // 0xB1
+  {  8724,   6,   7,   7,    0,  -13 },   // 0xB2
+  {  8745,   7,   7,   7,    0,  -13 },   // 0xB3
+  {  8770,   5,   4,   9,    3,  -15 },   // 0xB4
+  {  8780,  10,  14,  11,    1,  -10 },   // 0xB5
+  {  8850,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  8918,   3,   3,   6,    1,   -8 },   // 0xB7
+  {  8923,   4,   5,   9,    2,   -1 },   // 0xB8
+  {  8933,   6,   7,   7,    1,  -13 },   // 0xB9
+  {  8954,   8,   9,   8,    0,  -13 },   // 0xBA
+  {  8990,   9,   8,  11,    1,   -9 },   // 0xBB
+  {  9026,  16,  14,  17,    1,  -14 },   // 0xBC
+  {  9138,  15,  13,  17,    1,  -13 },   // 0xBD
+  {  9236,  17,  14,  17,    0,  -14 },   // 0xBE
+  {  9355,   8,  14,   9,    1,  -10 },   // 0xBF
+  {  9411,  12,  17,  12,    0,  -17 },   // 0xC0
+  {  9513,  12,  17,  12,    0,  -17 },   // 0xC1
+  {  9615,  12,  17,  12,    0,  -17 },   // 0xC2
+  {  9717,  12,  17,  12,    0,  -17 },   // 0xC3
+  {  9819,  12,  16,  12,    0,  -16 },   // 0xC4
+  {  9915,  12,  17,  12,    0,  -17 },   // 0xC5
+  { 10017,  17,  13,  17,    0,  -13 },   // 0xC6
+  { 10128,  11,  17,  12,    1,  -13 },   // 0xC7
+  { 10222,   9,  17,  11,    1,  -17 },   // 0xC8
+  { 10299,   9,  17,  11,    1,  -17 },   // 0xC9
+  { 10376,   9,  17,  11,    1,  -17 },   // 0xCA
+  { 10453,   9,  16,  11,    1,  -16 },   // 0xCB
+  { 10525,   4,  17,   5,    0,  -17 },   // 0xCC
+  { 10559,   4,  17,   5,    1,  -17 },   // 0xCD
+  { 10593,   5,  17,   5,    0,  -17 },   // 0xCE
+  { 10636,   6,  16,   5,    0,  -16 },   // 0xCF
+  { 10684,  13,  13,  14,    0,  -13 },   // 0xD0
+  { 10769,  11,  17,  13,    1,  -17 },   // 0xD1
+  { 10863,  12,  17,  14,    1,  -17 },   // 0xD2
+  { 10965,  12,  17,  14,    1,  -17 },   // 0xD3
+  { 11067,  12,  17,  14,    1,  -17 },   // 0xD4
+  { 11169,  12,  17,  14,    1,  -17 },   // 0xD5
+  { 11271,  12,  17,  14,    1,  -17 },   // 0xD6
+  { 11373,  11,  11,  15,    2,  -11 },   // 0xD7
+  { 11434,  12,  15,  14,    1,  -14 },   // 0xD8
+  { 11524,  11,  17,  13,    1,  -17 },   // 0xD9
+  { 11618,  11,  17,  13,    1,  -17 },   // 0xDA
+  { 11712,  11,  17,  13,    1,  -17 },   // 0xDB
+  { 11806,  11,  17,  13,    1,  -17 },   // 0xDC
+  { 11900,  11,  17,  11,    0,  -17 },   // 0xDD
+  { 11994,   9,  13,  11,    1,  -13 },   // 0xDE
+  { 12053,  10,  14,  11,    1,  -14 },   // 0xDF
+  { 12123,   9,  15,  11,    1,  -15 },   // 0xE0
+  { 12191,   9,  15,  11,    1,  -15 },   // 0xE1
+  { 12259,   9,  15,  11,    1,  -15 },   // 0xE2
+  { 12327,   9,  14,  11,    1,  -14 },   // 0xE3
+  { 12390,   9,  14,  11,    1,  -14 },   // 0xE4
+  { 12453,   9,  16,  11,    1,  -16 },   // 0xE5
+  { 12525,  16,  10,  17,    1,  -10 },   // 0xE6
+  { 12605,   8,  14,  10,    1,  -10 },   // 0xE7
+  { 12661,   9,  15,  11,    1,  -15 },   // 0xE8
+  { 12729,   9,  15,  11,    1,  -15 },   // 0xE9
+  { 12797,   9,  15,  11,    1,  -15 },   // 0xEA
+  { 12865,   9,  14,  11,    1,  -14 },   // 0xEB
+  { 12928,   5,  15,   5,   -1,  -15 },   // 0xEC
+  { 12966,   5,  15,   5,    1,  -15 },   // 0xED
+  { 13004,   6,  15,   5,   -1,  -15 },   // 0xEE
+  { 13049,   6,  14,   5,   -1,  -14 },   // 0xEF
+  { 13091,   9,  14,  11,    1,  -14 },   // 0xF0
+  { 13154,   9,  14,  11,    1,  -14 },   // 0xF1
+  { 13217,   9,  15,  11,    1,  -15 },   // 0xF2
+  { 13285,   9,  15,  11,    1,  -15 },   // 0xF3
+  { 13353,   9,  15,  11,    1,  -15 },   // 0xF4
+  { 13421,   9,  14,  11,    1,  -14 },   // 0xF5
+  { 13484,   9,  14,  11,    1,  -14 },   // 0xF6
+  { 13547,  12,   9,  15,    1,  -10 },   // 0xF7
+  { 13601,  10,  12,  11,    0,  -11 },   // 0xF8
+  { 13661,   9,  15,  11,    1,  -15 },   // 0xF9
+  { 13729,   9,  15,  11,    1,  -15 },   // 0xFA
+  { 13797,   9,  15,  11,    1,  -15 },   // 0xFB
+  { 13865,   9,  14,  11,    1,  -14 },   // 0xFC
+  { 13928,  10,  18,  10,    0,  -14 },   // 0xFD
+  { 14018,  10,  18,  11,    1,  -14 },   // 0xFE
+  { 14108,  10,  18,  10,    0,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans9pt8bAa4 = {
+  DejaVuSans9pt8bAa4Bitmaps, DejaVuSans9pt8bAa4Glyphs, 0x20, 0xFF, 21, 4 };
+
+// Approx. 15774 bytes
+#endif // DEJAVUSANS9PT8BAA4_H
@@ -0,0 +1,494 @@
+#ifndef DEJAVUSANS9PT8B_RLE_H
+#define DEJAVUSANS9PT8B_RLE_H
+// Police RLE (tools/font_rle.py, src/RleFont.h) : 3073 octets de plages, 3288 octets en bitmap 1 bpp
+#include "RleFont.h"
+const uint8_t DejaVuSans9pt8bRleRuns[] PROGMEM = {
+  0x1F, 0xC9, 0x00, 0x09, 0x45, 0x14, 0x51, 0x20, 0xA5, 0x9E, 0x0B, 0x39,
+  0x25, 0x92, 0x33, 0xC3, 0xE4, 0x29, 0x64, 0x8C, 0xF0, 0xF9, 0x0A, 0x59,
+  0x25, 0x92, 0x3C, 0x16, 0x40, 0x87, 0x93, 0xAB, 0xE0, 0xB2, 0x51, 0x29,
+  0x19, 0x6E, 0xB6, 0x94, 0xA1, 0x4D, 0x93, 0xE2, 0xD8, 0xF2, 0x79, 0x20,
+  0x33, 0x16, 0x92, 0x86, 0x24, 0x9A, 0x89, 0x26, 0x6A, 0x49, 0x1C, 0x92,
+  0x47, 0x88, 0x8A, 0x9C, 0x14, 0x92, 0xC5, 0x24, 0xA9, 0x69, 0x28, 0x9A,
+  0x4A, 0x18, 0x92, 0x67, 0x40, 0x93, 0x8D, 0x54, 0x35, 0x76, 0xFA, 0x9C,
+  0x22, 0xD2, 0x29, 0xB2, 0x8A, 0x91, 0x2A, 0x9B, 0x8D, 0xF6, 0xEA, 0x60,
+  0x1D, 0x80, 0x49, 0x14, 0x92, 0x45, 0x24, 0x92, 0x49, 0x24, 0x99, 0x69,
+  0x26, 0x5A, 0x09, 0x96, 0x92, 0x65, 0xA4, 0x92, 0x49, 0x24, 0x91, 0x49,
+  0x24, 0x52, 0x65, 0x94, 0x51, 0x24, 0x92, 0x5B, 0x8D, 0x92, 0x49, 0x25,
+  0x14, 0x59, 0xAB, 0xB5, 0xDA, 0xED, 0x76, 0xAF, 0xFD, 0xD5, 0xDA, 0xED,
+  0x76, 0xBB, 0x40, 0x28, 0xA2, 0x49, 0x1D, 0x80, 0x10, 0x8A, 0x26, 0xA2,
+  0x89, 0xB6, 0xA2, 0x89, 0xB6, 0xA2, 0x89, 0xA8, 0x80, 0x55, 0xF0, 0x93,
+  0x45, 0x59, 0x65, 0x96, 0x59, 0x65, 0x45, 0x34, 0xB8, 0x74, 0x4D, 0xD6,
+  0x8A, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB2, 0x7F, 0xA0, 0x35, 0x70, 0x4C,
+  0x79, 0x65, 0x5D, 0x55, 0x55, 0x55, 0x57, 0xF4, 0x39, 0x72, 0x4D, 0x7C,
+  0x2C, 0xD6, 0x7B, 0x87, 0xC2, 0xE1, 0xDF, 0x16, 0xAF, 0x87, 0x89, 0x55,
+  0x15, 0x4A, 0x50, 0xB4, 0xD3, 0x4C, 0xC4, 0xBF, 0xD9, 0x72, 0xB9, 0x40,
+  0x39, 0x64, 0xB2, 0xD5, 0xE4, 0x5B, 0xCB, 0x2C, 0xE7, 0x6A, 0x80, 0x72,
+  0x64, 0xD9, 0x2F, 0x2E, 0x11, 0x8B, 0x92, 0xDD, 0xB2, 0xA2, 0x9B, 0x3C,
+  0x3A, 0x1F, 0xAA, 0xB2, 0xCA, 0xBA, 0xB2, 0xAE, 0xAC, 0xAB, 0xA8, 0x55,
+  0xF0, 0x5B, 0xB6, 0xB6, 0x78, 0x5C, 0x16, 0xED, 0x96, 0xB6, 0x78, 0x74,
+  0x55, 0xF0, 0x5B, 0x45, 0x59, 0x6B, 0x67, 0x95, 0x0A, 0xE1, 0x66, 0x4B,
+  0x6B, 0x48, 0x13, 0xB8, 0x28, 0xAF, 0xD2, 0x28, 0x92, 0x40, 0xEC, 0xF1,
+  0x2D, 0x76, 0x5D, 0x79, 0xBD, 0x5E, 0x67, 0x64, 0x1F, 0xF3, 0xFF, 0x3F,
+  0xF2, 0x07, 0xB9, 0xCD, 0xEA, 0xF3, 0x75, 0x95, 0xDB, 0x38, 0x20, 0x31,
+  0x73, 0x15, 0x55, 0x45, 0x14, 0x55, 0x55, 0xEA, 0xA8, 0xBB, 0x9E, 0xEC,
+  0xAD, 0xBE, 0x92, 0x5E, 0x56, 0x8A, 0x71, 0xE7, 0x1A, 0x49, 0xC6, 0x92,
+  0x48, 0xA7, 0xD2, 0x6D, 0x17, 0x57, 0xE1, 0xFE, 0x1E, 0x3C, 0x75, 0xD5,
+  0xAB, 0xB5, 0xD4, 0xE6, 0x70, 0x92, 0xC9, 0x2C, 0x92, 0xAA, 0x29, 0xCB,
+  0xED, 0x2C, 0x92, 0xC8, 0xAE, 0x50, 0x1C, 0x2E, 0x4A, 0x88, 0xA8, 0x8A,
+  0x88, 0xF0, 0xB8, 0x4A, 0x22, 0xAC, 0xB2, 0x78, 0x78, 0x99, 0xF4, 0x5E,
+  0x25, 0x72, 0xBA, 0x5D, 0x2E, 0x97, 0x4B, 0xB5, 0xD3, 0xC5, 0x75, 0x30,
+  0x1C, 0x4E, 0x92, 0xAC, 0xAD, 0x78, 0x9C, 0x4E, 0x27, 0x13, 0x89, 0xAD,
+  0x67, 0xA5, 0xC0, 0x1F, 0xCC, 0xB2, 0xDF, 0xCC, 0xB2, 0xCB, 0x7E, 0x80,
+  0x1F, 0xCC, 0xB2, 0xDC, 0x1E, 0x0A, 0xCB, 0x2C, 0xB2, 0xC8, 0x99, 0xF4,
+  0x5E, 0x25, 0x72, 0xBA, 0x53, 0x89, 0xC7, 0x13, 0x84, 0x56, 0x45, 0xD4,
+  0xB9, 0x98, 0x0B, 0x4D, 0x34, 0xD3, 0x7F, 0xDE, 0x9A, 0x69, 0xA6, 0x99,
+  0x00, 0x1F, 0xFA, 0x69, 0xA6, 0x9A, 0x69, 0xA6, 0x9A, 0x69, 0xA6, 0x9A,
+  0x69, 0xA5, 0xC1, 0x60, 0x0A, 0xA4, 0xA2, 0x69, 0xA8, 0x92, 0xA8, 0xAD,
+  0x38, 0x9C, 0x22, 0xB2, 0x4A, 0xA6, 0xA2, 0x89, 0xAA, 0x92, 0xC8, 0x0B,
+  0x2C, 0xB2, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB7, 0xE8, 0x0F, 0x71, 0x39,
+  0x98, 0xA6, 0x4C, 0x29, 0x23, 0x0A, 0x48, 0xC5, 0x14, 0x51, 0x46, 0x9C,
+  0x69, 0xCE, 0x67, 0x33, 0x94, 0x0E, 0xDB, 0xA6, 0x90, 0xA7, 0x0A, 0x71,
+  0x25, 0x1A, 0x31, 0xA3, 0x26, 0x9A, 0xDA, 0xC0, 0x7A, 0xF2, 0xDC, 0x69,
+  0x64, 0x57, 0x33, 0x99, 0xCC, 0xE6, 0x72, 0x8A, 0xC9, 0x38, 0xDF, 0x37,
+  0x00, 0x19, 0x70, 0x53, 0xB2, 0x48, 0xFB, 0x39, 0x2C, 0xB2, 0xCB, 0x20,
+  0x7A, 0xF2, 0xDC, 0x69, 0x64, 0x57, 0x33, 0x99, 0xCC, 0xE6, 0x72, 0x8A,
+  0xC9, 0x38, 0xDF, 0x37, 0x76, 0xBC, 0x40, 0x1A, 0x70, 0xD3, 0x69, 0x44,
+  0x94, 0x49, 0x36, 0xB8, 0x7A, 0x26, 0x9A, 0x89, 0x28, 0x92, 0xA8, 0xAA,
+  0xC0, 0x55, 0xF0, 0x5C, 0x25, 0x70, 0xB9, 0xB7, 0x70, 0xF8, 0x5C, 0x3B,
+  0xE2, 0xC0, 0x1F, 0xF7, 0x57, 0x6B, 0xB5, 0xDA, 0xED, 0x76, 0xBB, 0x5D,
+  0xAE, 0xD7, 0x6B, 0xB4, 0x0B, 0x4D, 0x34, 0xD3, 0x4D, 0x34, 0xD3, 0x4C,
+  0x8A, 0x89, 0x72, 0xF0, 0x0B, 0x94, 0x56, 0x49, 0x64, 0x96, 0x4D, 0x45,
+  0x14, 0x55, 0x25, 0x92, 0x59, 0x25, 0xC4, 0xE6, 0x74, 0xBB, 0x40, 0x0A,
+  0xBB, 0x2B, 0xA8, 0xA6, 0x8A, 0x69, 0x26, 0x8A, 0x69, 0x26, 0x8A, 0x69,
+  0x26, 0x8A, 0x69, 0xA2, 0x9A, 0x2A, 0x22, 0x9A, 0x2A, 0x22, 0x9A, 0x2A,
+  0x22, 0x9A, 0x2A, 0xBA, 0xF3, 0xAF, 0x3A, 0xC0, 0x2E, 0x34, 0xA2, 0x6D,
+  0x2A, 0x8B, 0xD3, 0x87, 0xCB, 0xE6, 0x64, 0x55, 0x69, 0x44, 0xDA, 0x55,
+  0x17, 0x58, 0x0F, 0x32, 0xB2, 0x6A, 0x2A, 0x92, 0xC9, 0x2E, 0x27, 0x4B,
+  0xB5, 0xDA, 0xED, 0x76, 0xBB, 0x5D, 0xA0, 0x1F, 0xF3, 0xC3, 0xE1, 0xF2,
+  0xB9, 0x7C, 0x3E, 0x1F, 0x2B, 0x95, 0xCB, 0xE3, 0xFE, 0x40, 0x1D, 0xA4,
+  0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x4B, 0x90, 0x0A, 0x2A, 0xA2,
+  0x8A, 0x38, 0xA2, 0x8A, 0x38, 0xA2, 0x8A, 0xA8, 0x80, 0x1C, 0xA4, 0x92,
+  0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x4B, 0xB0, 0x8F, 0x84, 0x55, 0x4D,
+  0x35, 0x51, 0x5C, 0x20, 0x1F, 0xC0, 0x09, 0xA6, 0x80, 0x51, 0xE4, 0x5B,
+  0xC9, 0x7E, 0xA4, 0x7E, 0x18, 0x50, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0x8C,
+  0x5C, 0x96, 0xED, 0x96, 0x59, 0x6B, 0xF0, 0xA3, 0x00, 0x71, 0x70, 0x54,
+  0x79, 0x65, 0x97, 0x0A, 0x13, 0xC3, 0x80, 0xE1, 0x70, 0xB8, 0x5C, 0x25,
+  0x0A, 0x3E, 0x3B, 0x65, 0x96, 0x5A, 0xD9, 0xE5, 0x42, 0x80, 0x75, 0xF2,
+  0x94, 0xBB, 0xFE, 0xFA, 0x58, 0x9E, 0x9E, 0x71, 0x54, 0xAA, 0x7F, 0x84,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0xA3, 0xE3, 0xB6, 0x59, 0x65,
+  0xAD, 0x9E, 0x54, 0x2B, 0x84, 0x4C, 0x4B, 0x87, 0x40, 0x0B, 0x2C, 0xB2,
+  0xC8, 0xC3, 0xC1, 0x6A, 0xC9, 0x24, 0x92, 0x49, 0x24, 0x40, 0x12, 0x7F,
+  0x80, 0x49, 0x2E, 0xD2, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x2E,
+  0x80, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xA2, 0x29, 0xA4, 0x92, 0x68, 0xA9,
+  0x2C, 0xA8, 0xA8, 0x92, 0x69, 0xA4, 0xA2, 0x1F, 0xFE, 0x00, 0x08, 0xC5,
+  0x0F, 0x06, 0x96, 0xDB, 0x91, 0x49, 0x14, 0x91, 0x49, 0x14, 0x91, 0x49,
+  0x14, 0x91, 0x44, 0x08, 0xC3, 0xC1, 0x6A, 0xC9, 0x24, 0x92, 0x49, 0x24,
+  0x40, 0x72, 0x72, 0x94, 0x45, 0x69, 0xA6, 0x99, 0x15, 0x12, 0xE6, 0x40,
+  0x08, 0xC5, 0xC9, 0x6E, 0xD9, 0x65, 0x96, 0xBF, 0x0A, 0x31, 0x2E, 0x17,
+  0x0B, 0x84, 0x50, 0xA3, 0xE3, 0xB6, 0x59, 0x65, 0xAD, 0x9E, 0x54, 0x2B,
+  0x85, 0xC2, 0xE1, 0x70, 0x80, 0x08, 0xFA, 0xD4, 0x51, 0x45, 0x14, 0x51,
+  0x00, 0x34, 0xF5, 0x25, 0xB2, 0x57, 0x3A, 0x34, 0x2A, 0x28, 0x9F, 0xA5,
+  0x45, 0x14, 0x51, 0x45, 0x2A, 0x80, 0x0A, 0x49, 0x24, 0x92, 0x49, 0x25,
+  0x4C, 0xF0, 0x61, 0x40, 0x0B, 0x4C, 0x8A, 0x89, 0x28, 0x9A, 0x4A, 0x24,
+  0xA2, 0x4A, 0xCD, 0x38, 0x40, 0x09, 0xB7, 0x1B, 0x71, 0x92, 0x5A, 0x28,
+  0xA2, 0x8A, 0x48, 0xA2, 0x8A, 0x48, 0xA2, 0x8A, 0x48, 0x96, 0x4A, 0x6D,
+  0xB8, 0xDB, 0x8D, 0xB0, 0x0E, 0x32, 0xA2, 0x69, 0x28, 0x92, 0xB3, 0x4A,
+  0x92, 0x89, 0x26, 0xA2, 0x2E, 0x30, 0x0B, 0x4C, 0x8A, 0x89, 0x28, 0x9A,
+  0x4A, 0x24, 0xAC, 0xD3, 0x85, 0xCA, 0xE5, 0x70, 0xB4, 0xCC, 0x1F, 0xAA,
+  0xAA, 0xAE, 0x3A, 0xAB, 0x9F, 0xA0, 0x91, 0xD6, 0xB2, 0xCB, 0x2C, 0x9C,
+  0x93, 0x3C, 0xB2, 0xCB, 0x2C, 0xB5, 0x90, 0x1F, 0xFF, 0xC8, 0x12, 0x5C,
+  0xB2, 0xCB, 0x2C, 0xB8, 0x92, 0x37, 0x56, 0x59, 0x65, 0x93, 0xAE, 0x00,
+  0x36, 0x7D, 0x28, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2,
+  0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x12, 0x7F, 0x00,
+  0xA7, 0x83, 0xC1, 0xB1, 0x70, 0x52, 0x25, 0xB2, 0x93, 0x29, 0x32, 0x93,
+  0x2D, 0x22, 0x49, 0xE1, 0xCC, 0x78, 0x3C, 0x10, 0x92, 0x64, 0xD9, 0x4B,
+  0x85, 0xC2, 0xBC, 0x2E, 0x22, 0xE1, 0x70, 0xAF, 0xF0, 0x07, 0x82, 0x51,
+  0x25, 0x2E, 0x19, 0x65, 0xA6, 0x99, 0x65, 0xF0, 0x91, 0x25, 0x13, 0xC1,
+  0x0B, 0x22, 0xA2, 0x4A, 0x26, 0x92, 0x89, 0x25, 0xDB, 0x9C, 0x29, 0xDC,
+  0x5C, 0xAE, 0x57, 0x28, 0x1F, 0x89, 0xF8, 0x51, 0x54, 0xAA, 0xCA, 0x44,
+  0x95, 0x68, 0xA4, 0x94, 0x8B, 0x2A, 0x95, 0x50, 0x09, 0x44, 0x80, 0x97,
+  0x2A, 0x9A, 0xE1, 0x22, 0xE2, 0x24, 0xB3, 0xC2, 0x47, 0x94, 0x8F, 0x29,
+  0x1E, 0x53, 0x2C, 0xB2, 0x4B, 0x6C, 0xA5, 0xC2, 0x6A, 0xAD, 0x40, 0x37,
+  0x82, 0x79, 0x8A, 0xA8, 0x8C, 0x27, 0x8E, 0x00, 0x65, 0x94, 0x92, 0x29,
+  0x22, 0x92, 0x49, 0x26, 0x92, 0x69, 0x26, 0x59, 0x1F, 0xF3, 0xD2, 0xE9,
+  0x74, 0x80, 0x1D, 0x80, 0x97, 0x2A, 0x9A, 0xE1, 0x22, 0xA3, 0x24, 0xB2,
+  0xCB, 0x4C, 0xB2, 0xD3, 0x91, 0x32, 0x8C, 0x4C, 0xB2, 0xC9, 0x28, 0xB4,
+  0x4A, 0x5C, 0x26, 0xAA, 0xD4, 0x1D, 0x80, 0x30, 0xA4, 0xE2, 0x8D, 0x23,
+  0x00, 0xAB, 0xB5, 0xDA, 0xBF, 0xF7, 0x57, 0x6B, 0xB5, 0xFB, 0xFF, 0xB0,
+  0x2C, 0x96, 0x61, 0x65, 0x96, 0x5D, 0x16, 0x12, 0xE9, 0x86, 0x50, 0x48,
+  0xA2, 0x80, 0x0A, 0x22, 0xA2, 0x2A, 0x22, 0xA2, 0x2A, 0x22, 0xA2, 0x2A,
+  0x22, 0xD3, 0x3E, 0x14, 0xA7, 0x0B, 0x85, 0xC2, 0x58, 0xC5, 0x96, 0x59,
+  0x64, 0x4C, 0x46, 0x14, 0x61, 0x46, 0x14, 0x61, 0x46, 0x14, 0x61, 0x46,
+  0x14, 0x61, 0x44, 0x10, 0x45, 0xE0, 0x0E, 0x18, 0x61, 0x86, 0x15, 0x40,
+  0x51, 0x16, 0xEA, 0xAA, 0xB6, 0x94, 0xE7, 0x80, 0x05, 0x96, 0x92, 0x69,
+  0x26, 0x92, 0x49, 0x22, 0x92, 0x29, 0x24, 0x59, 0x0F, 0x95, 0x4F, 0x27,
+  0x1E, 0x0F, 0x07, 0x2E, 0x0E, 0x3C, 0x9A, 0x78, 0xA9, 0x45, 0xC9, 0x84,
+  0x9E, 0x0C, 0x28, 0xE4, 0xCB, 0x38, 0xCD, 0x0F, 0x46, 0x2E, 0x88, 0x0F,
+  0x95, 0x0F, 0x26, 0x9E, 0x0E, 0x39, 0x63, 0x8F, 0x06, 0x9D, 0x52, 0x4F,
+  0x92, 0x8B, 0x38, 0xF0, 0x6A, 0xC7, 0x1C, 0x71, 0xC7, 0x2B, 0x40, 0x17,
+  0x2E, 0x0E, 0x35, 0xE3, 0xD1, 0x8B, 0xA3, 0x0F, 0x65, 0x9E, 0x23, 0x51,
+  0x72, 0x61, 0x27, 0x83, 0x0A, 0x39, 0x32, 0xCE, 0x33, 0x43, 0xD1, 0x8B,
+  0xA2, 0x6A, 0xAF, 0x55, 0x55, 0x47, 0x14, 0x51, 0x55, 0x5B, 0x27, 0x28,
+  0xAB, 0xC5, 0xFF, 0x0B, 0xB5, 0xD4, 0xE6, 0x70, 0x92, 0xC9, 0x2C, 0x92,
+  0xAA, 0x29, 0xCB, 0xED, 0x2C, 0x92, 0xC8, 0xAE, 0x50, 0xCB, 0xA5, 0xFF,
+  0x2B, 0xB5, 0xD4, 0xE6, 0x70, 0x92, 0xC9, 0x2C, 0x92, 0xAA, 0x29, 0xCB,
+  0xED, 0x2C, 0x92, 0xC8, 0xAE, 0x50, 0xAB, 0xA2, 0x8F, 0xFC, 0x2E, 0xD7,
+  0x53, 0x99, 0xC2, 0x4B, 0x24, 0xB2, 0x4A, 0xA8, 0xA7, 0x2F, 0xB4, 0xB2,
+  0x4B, 0x22, 0xB9, 0x40, 0x89, 0x1C, 0x52, 0xFF, 0x85, 0xDA, 0xEA, 0x73,
+  0x38, 0x49, 0x64, 0x96, 0x49, 0x55, 0x14, 0xE5, 0xF6, 0x96, 0x49, 0x64,
+  0x57, 0x28, 0x69, 0x2C, 0x92, 0xFF, 0x2E, 0xD7, 0x53, 0x99, 0xC2, 0x4B,
+  0x24, 0xB2, 0x4A, 0xA8, 0xA7, 0x2F, 0xB4, 0xB2, 0x4B, 0x22, 0xB9, 0x40,
+  0xAB, 0xA2, 0x8F, 0x25, 0x1E, 0x4A, 0x3D, 0x2E, 0xD7, 0x53, 0x99, 0xC2,
+  0x4B, 0x24, 0xB2, 0x4A, 0xA8, 0xA7, 0x2F, 0xB4, 0xB2, 0x4B, 0x22, 0xB9,
+  0x40, 0xBE, 0x5F, 0x2A, 0x2B, 0xB4, 0x97, 0x69, 0x2E, 0x93, 0xE5, 0xA7,
+  0xCA, 0x51, 0x73, 0xCF, 0x3C, 0xF0, 0xAA, 0xE1, 0x5E, 0xF7, 0x20, 0x99,
+  0xF4, 0x5E, 0x25, 0x72, 0xBA, 0x5D, 0x2E, 0x97, 0x4B, 0xB5, 0xD3, 0xC5,
+  0x75, 0x37, 0x27, 0xB5, 0xC4, 0x4B, 0x85, 0xE7, 0xF3, 0x2C, 0xB7, 0xF3,
+  0x2C, 0xB2, 0xDF, 0xA0, 0x6A, 0xAF, 0x7F, 0x99, 0x65, 0xBF, 0x99, 0x65,
+  0x96, 0xFD, 0x00, 0x4E, 0x22, 0xBB, 0xFE, 0x65, 0x96, 0xFE, 0x65, 0x96,
+  0x5B, 0xF4, 0x29, 0x24, 0x92, 0xEB, 0xF9, 0x96, 0x5B, 0xF9, 0x96, 0x59,
+  0x6F, 0xD0, 0x29, 0xAC, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+  0x24, 0x80, 0x32, 0xA2, 0x8A, 0x28, 0xA2, 0x8A, 0x28, 0xA2, 0x8A, 0x28,
+  0xA0, 0x49, 0x94, 0x7A, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x51, 0x45,
+  0x14, 0x40, 0x09, 0x44, 0xB9, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x51,
+  0x45, 0x14, 0x40, 0x5C, 0x6E, 0xA2, 0xAD, 0xAC, 0xD2, 0xE3, 0xA9, 0xD4,
+  0x49, 0x70, 0x92, 0xE1, 0x25, 0x9A, 0x55, 0xBE, 0xA7, 0x00, 0x69, 0x18,
+  0x52, 0xF9, 0xDB, 0x74, 0xD2, 0x14, 0xE1, 0x4E, 0x24, 0xA3, 0x46, 0x34,
+  0x64, 0xD3, 0x5B, 0x58, 0xAB, 0xC5, 0xFD, 0xD7, 0x96, 0xE3, 0x4B, 0x22,
+  0xB9, 0x9C, 0xCE, 0x67, 0x33, 0x94, 0x56, 0x49, 0xC6, 0xF9, 0xB8, 0xCB,
+  0xA5, 0xFE, 0xD7, 0x96, 0xE3, 0x4B, 0x22, 0xB9, 0x9C, 0xCE, 0x67, 0x33,
+  0x94, 0x56, 0x49, 0xC6, 0xF9, 0xB8, 0xAB, 0xA2, 0x8F, 0xF7, 0x5E, 0x5B,
+  0x8D, 0x2C, 0x8A, 0xE6, 0x73, 0x39, 0x9C, 0xCE, 0x51, 0x59, 0x27, 0x1B,
+  0xE6, 0xE0, 0x89, 0x1C, 0x52, 0xFE, 0xEB, 0xCB, 0x71, 0xA5, 0x91, 0x5C,
+  0xCE, 0x67, 0x33, 0x99, 0xCA, 0x2B, 0x24, 0xE3, 0x7C, 0xDC, 0x69, 0x2C,
+  0x92, 0xFE, 0x6B, 0xCB, 0x71, 0xA5, 0x91, 0x5C, 0xCE, 0x67, 0x33, 0x99,
+  0xCA, 0x2B, 0x24, 0xE3, 0x7C, 0xDC, 0x27, 0x12, 0xE3, 0x2D, 0x37, 0xAC,
+  0xD2, 0xE6, 0xD3, 0x2E, 0x32, 0x71, 0x75, 0x95, 0xC1, 0x29, 0xC6, 0x5D,
+  0x65, 0x54, 0x64, 0x4A, 0x34, 0xE2, 0x52, 0x15, 0x51, 0x75, 0x97, 0x1A,
+  0x27, 0x84, 0x5D, 0x6B, 0xA5, 0xF8, 0x5A, 0x69, 0xA6, 0x9A, 0x69, 0xA6,
+  0x9A, 0x64, 0x54, 0x4B, 0x97, 0x80, 0x8B, 0x85, 0xF9, 0x5A, 0x69, 0xA6,
+  0x9A, 0x69, 0xA6, 0x9A, 0x64, 0x54, 0x4B, 0x97, 0x80, 0x8B, 0x82, 0x8F,
+  0xCB, 0x4D, 0x34, 0xD3, 0x4D, 0x34, 0xD3, 0x4C, 0x8A, 0x89, 0x72, 0xF0,
+  0x49, 0x28, 0x92, 0xF5, 0x69, 0xA6, 0x9A, 0x69, 0xA6, 0x9A, 0x69, 0x91,
+  0x51, 0x2E, 0x5E, 0xAB, 0xA5, 0xFC, 0x79, 0x95, 0x93, 0x51, 0x54, 0x96,
+  0x49, 0x71, 0x3A, 0x5D, 0xAE, 0xD7, 0x6B, 0xB5, 0xDA, 0xED, 0x00, 0x0B,
+  0x2D, 0x97, 0x05, 0x3B, 0x24, 0x8F, 0xB3, 0x92, 0xCB, 0x20, 0x52, 0x64,
+  0xDA, 0x2A, 0x22, 0x93, 0x49, 0x26, 0x92, 0x69, 0xA4, 0xA2, 0x2A, 0xCB,
+  0x09, 0x70, 0xF2, 0xA0, 0x4B, 0x85, 0xC2, 0xF6, 0x3C, 0x8B, 0x79, 0x2F,
+  0xD4, 0x8F, 0xC3, 0x0A, 0xAA, 0xAA, 0xBE, 0x8F, 0x22, 0xDE, 0x4B, 0xF5,
+  0x23, 0xF0, 0xC2, 0x80, 0x6A, 0xC6, 0x92, 0xF2, 0x3C, 0x8B, 0x79, 0x2F,
+  0xD4, 0x8F, 0xC3, 0x0A, 0x2D, 0x14, 0x53, 0xFE, 0xC7, 0x91, 0x6F, 0x25,
+  0xFA, 0x91, 0xF8, 0x61, 0x40, 0x29, 0x24, 0x92, 0xFE, 0xC7, 0x91, 0x6F,
+  0x25, 0xFA, 0x91, 0xF8, 0x61, 0x40, 0x6E, 0x16, 0x59, 0x65, 0x96, 0x63,
+  0xF6, 0x3C, 0x8B, 0x79, 0x2F, 0xD4, 0x8F, 0xC3, 0x0A, 0x51, 0xC7, 0x8E,
+  0x45, 0xC6, 0xF2, 0xA9, 0x7F, 0xFA, 0x8B, 0x84, 0xE5, 0xE0, 0xF2, 0x64,
+  0xA0, 0x71, 0x70, 0x54, 0x79, 0x65, 0x97, 0x0A, 0x13, 0xC3, 0x98, 0xF0,
+  0xA4, 0x4B, 0xA5, 0xD2, 0xFD, 0xD7, 0xCA, 0x52, 0xEF, 0xFB, 0xE9, 0x62,
+  0x7A, 0x78, 0xAB, 0x85, 0xC2, 0xFE, 0x57, 0xCA, 0x52, 0xEF, 0xFB, 0xE9,
+  0x62, 0x7A, 0x78, 0x8B, 0x89, 0x52, 0x5F, 0x9A, 0xF9, 0x4A, 0x5D, 0xFF,
+  0x7D, 0x2C, 0x4F, 0x4F, 0x00, 0x49, 0x28, 0x92, 0xFF, 0xCA, 0xF9, 0x4A,
+  0x5D, 0xFF, 0x7D, 0x2C, 0x4F, 0x4F, 0x00, 0x09, 0xA6, 0xB2, 0x49, 0x24,
+  0x92, 0x49, 0x24, 0x92, 0x48, 0x48, 0xA2, 0xB8, 0x49, 0x24, 0x92, 0x49,
+  0x24, 0x92, 0x49, 0x00, 0x49, 0xC2, 0x92, 0xE5, 0x45, 0x14, 0x51, 0x45,
+  0x14, 0x51, 0x44, 0x09, 0x44, 0xBF, 0x0A, 0x28, 0xA2, 0x8A, 0x28, 0xA2,
+  0x8A, 0x20, 0x66, 0x19, 0x5D, 0xE9, 0x6A, 0xF9, 0x4A, 0x5D, 0x34, 0xD3,
+  0x22, 0xA2, 0x5C, 0xC8, 0x2D, 0x14, 0x53, 0xFD, 0xA3, 0x0F, 0x05, 0xAB,
+  0x24, 0x92, 0x49, 0x24, 0x91, 0x00, 0x4B, 0xA5, 0xD2, 0xFD, 0xC9, 0xCA,
+  0x51, 0x15, 0xA6, 0x9A, 0x64, 0x54, 0x4B, 0x99, 0x00, 0xAB, 0x85, 0xC2,
+  0xFE, 0x49, 0xCA, 0x51, 0x15, 0xA6, 0x9A, 0x64, 0x54, 0x4B, 0x99, 0x00,
+  0x8B, 0x89, 0x52, 0x5F, 0x99, 0x39, 0x4A, 0x22, 0xB4, 0xD3, 0x4C, 0x8A,
+  0x89, 0x73, 0x20, 0x4D, 0x18, 0x53, 0xFF, 0xC9, 0x39, 0x4A, 0x22, 0xB4,
+  0xD3, 0x4C, 0x8A, 0x89, 0x73, 0x20, 0x49, 0x28, 0x92, 0xFF, 0xC9, 0x39,
+  0x4A, 0x22, 0xB4, 0xD3, 0x4C, 0x8A, 0x89, 0x73, 0x20, 0xAB, 0xB5, 0xFB,
+  0xFF, 0xBF, 0xDA, 0xED, 0x00, 0xE8, 0xB8, 0x89, 0xE5, 0x28, 0x8A, 0x84,
+  0xC6, 0x54, 0x45, 0xC2, 0x62, 0x2A, 0x25, 0xC9, 0x2A, 0x32, 0x2B, 0x85,
+  0xC2, 0xF1, 0x49, 0x24, 0x92, 0x49, 0x24, 0xA9, 0x9E, 0x0C, 0x28, 0x8A,
+  0xAA, 0xBD, 0x52, 0x49, 0x24, 0x92, 0x49, 0x2A, 0x67, 0x83, 0x0A, 0x6A,
+  0xC6, 0x92, 0xE9, 0x49, 0x24, 0x92, 0x49, 0x24, 0xA9, 0x9E, 0x0C, 0x28,
+  0x29, 0x24, 0x92, 0xFD, 0xA9, 0x24, 0x92, 0x49, 0x24, 0x95, 0x33, 0xC1,
+  0x85, 0x00, 0xAB, 0x85, 0xC2, 0xFC, 0xAD, 0x32, 0x2A, 0x24, 0xA2, 0x69,
+  0x28, 0x92, 0xB3, 0x4E, 0x17, 0x2B, 0x95, 0xC2, 0xD3, 0x30, 0x0B, 0x85,
+  0xC2, 0xE1, 0x70, 0x8C, 0x5C, 0x96, 0xED, 0x96, 0x59, 0x6B, 0xF0, 0xA3,
+  0x12, 0xE1, 0x70, 0xB8, 0x40, 0x48, 0xAA, 0x8A, 0xFF, 0xA5, 0xA6, 0x45,
+  0x44, 0x94, 0x4D, 0x25, 0x12, 0x56, 0x69, 0xC2, 0xE5, 0x72, 0xB8, 0x5A,
+  0x66
+};
+
+const GFXglyph DejaVuSans9pt8bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20
+  {     0,   2,  13,   7,    3,  -12 },   // 0x21
+  {     3,   6,   5,   8,    1,  -12 },   // 0x22
+  {     8,  12,  14,  15,    1,  -13 },   // 0x23
+  {    29,   9,  17,  11,    1,  -13 },   // 0x24
+  {    48,  15,  13,  17,    1,  -12 },   // 0x25
+  {    77,  12,  13,  13,    1,  -12 },   // 0x26
+  {    96,   2,   5,   4,    1,  -12 },   // 0x27
+  {    98,   4,  16,   7,    2,  -13 },   // 0x28
+  {   110,   4,  16,   7,    1,  -13 },   // 0x29
+  {   122,   7,   8,   9,    1,  -12 },   // 0x2A
+  {   134,  12,  12,  15,    2,  -11 },   // 0x2B
+  {   147,   3,   4,   6,    1,   -1 },   // 0x2C
+  {   150,   5,   2,   7,    1,   -5 },   // 0x2D
+  {   152,   2,   2,   6,    2,   -1 },   // 0x2E
+  {   153,   6,  15,   6,    0,  -12 },   // 0x2F
+  {   165,   9,  13,  11,    1,  -12 },   // 0x30
+  {   178,   8,  13,  11,    2,  -12 },   // 0x31
+  {   189,   8,  13,  11,    1,  -12 },   // 0x32
+  {   200,   9,  13,  11,    1,  -12 },   // 0x33
+  {   212,  10,  13,  11,    1,  -12 },   // 0x34
+  {   228,   8,  13,  11,    1,  -12 },   // 0x35
+  {   239,   9,  13,  11,    1,  -12 },   // 0x36
+  {   253,   8,  13,  11,    1,  -12 },   // 0x37
+  {   263,   9,  13,  11,    1,  -12 },   // 0x38
+  {   276,   9,  13,  11,    1,  -12 },   // 0x39
+  {   290,   2,   9,   6,    2,   -8 },   // 0x3A
+  {   292,   3,  11,   6,    1,   -8 },   // 0x3B
+  {   298,  11,  10,  15,    2,   -9 },   // 0x3C
+  {   308,  11,   6,  15,    2,   -8 },   // 0x3D
+  {   313,  11,  10,  15,    2,   -9 },   // 0x3E
+  {   323,   7,  13,  10,    1,  -12 },   // 0x3F
+  {   333,  16,  16,  18,    1,  -12 },   // 0x40
+  {   360,  12,  13,  12,    0,  -12 },   // 0x41
+  {   378,   9,  13,  12,    2,  -12 },   // 0x42
+  {   393,  11,  13,  13,    1,  -12 },   // 0x43
+  {   408,  11,  13,  14,    2,  -12 },   // 0x44
+  {   423,   8,  13,  11,    2,  -12 },   // 0x45
+  {   432,   8,  13,  10,    2,  -12 },   // 0x46
+  {   442,  11,  13,  14,    1,  -12 },   // 0x47
+  {   458,  10,  13,  14,    2,  -12 },   // 0x48
+  {   469,   2,  13,   6,    2,  -12 },   // 0x49
+  {   471,   5,  17,   6,   -1,  -12 },   // 0x4A
+  {   484,  11,  13,  12,    2,  -12 },   // 0x4B
+  {   503,   8,  13,  10,    2,  -12 },   // 0x4C
+  {   513,  12,  13,  16,    2,  -12 },   // 0x4D
+  {   533,  10,  13,  14,    2,  -12 },   // 0x4E
+  {   548,  12,  13,  14,    1,  -12 },   // 0x4F
+  {   565,   8,  13,  11,    2,  -12 },   // 0x50
+  {   576,  12,  15,  14,    1,  -12 },   // 0x51
+  {   595,  10,  13,  13,    2,  -12 },   // 0x52
+  {   613,   9,  13,  11,    1,  -12 },   // 0x53
+  {   626,  12,  13,  12,    0,  -12 },   // 0x54
+  {   640,  10,  13,  14,    2,  -12 },   // 0x55
+  {   652,  12,  13,  12,    0,  -12 },   // 0x56
+  {   671,  17,  13,  19,    1,  -12 },   // 0x57
+  {   704,  11,  13,  13,    1,  -12 },   // 0x58
+  {   722,  12,  13,  12,    0,  -12 },   // 0x59
+  {   739,  11,  13,  13,    1,  -12 },   // 0x5A
+  {   754,   4,  16,   7,    1,  -13 },   // 0x5B
+  {   765,   6,  15,   6,    0,  -12 },   // 0x5C
+  {   777,   4,  16,   7,    2,  -13 },   // 0x5D
+  {   788,  11,   5,  15,    2,  -12 },   // 0x5E
+  {   796,   9,   2,   9,    0,    3 },   // 0x5F
+  {   798,   4,   3,   9,    2,  -13 },   // 0x60
+  {   801,   8,  10,  10,    1,   -9 },   // 0x61
+  {   810,   9,  14,  11,    2,  -13 },   // 0x62
+  {   825,   8,  10,   9,    1,   -9 },   // 0x63
+  {   835,   9,  14,  11,    1,  -13 },   // 0x64
+  {   850,  10,  10,  11,    1,   -9 },   // 0x65
+  {   859,   7,  14,   6,    0,  -13 },   // 0x66
+  {   870,   9,  14,  11,    1,   -9 },   // 0x67
+  {   885,   8,  14,  11,    2,  -13 },   // 0x68
+  {   898,   2,  14,   5,    2,  -13 },   // 0x69
+  {   901,   4,  18,   5,    0,  -13 },   // 0x6A
+  {   913,   9,  14,  10,    2,  -13 },   // 0x6B
+  {   931,   2,  14,   5,    2,  -13 },   // 0x6C
+  {   934,  14,  10,  17,    2,   -9 },   // 0x6D
+  {   951,   8,  10,  11,    2,   -9 },   // 0x6E
+  {   961,  10,  10,  11,    1,   -9 },   // 0x6F
+  {   972,   9,  14,  11,    2,   -9 },   // 0x70
+  {   986,   9,  14,  11,    1,   -9 },   // 0x71
+  {  1001,   6,  10,   8,    2,   -9 },   // 0x72
+  {  1009,   7,  10,   8,    1,   -9 },   // 0x73
+  {  1016,   6,  13,   7,    1,  -12 },   // 0x74
+  {  1026,   8,  10,  11,    2,   -9 },   // 0x75
+  {  1036,  10,  10,  11,    1,   -9 },   // 0x76
+  {  1049,  13,  10,  16,    2,   -9 },   // 0x77
+  {  1072,  10,  10,  11,    1,   -9 },   // 0x78
+  {  1086,  10,  14,  11,    1,   -9 },   // 0x79
+  {  1102,   8,  10,   9,    1,   -9 },   // 0x7A
+  {  1110,   8,  17,  11,    2,  -13 },   // 0x7B
+  {  1123,   2,  18,   6,    2,  -13 },   // 0x7C
+  {  1126,   8,  17,  11,    2,  -13 },   // 0x7D
+  {  1140,  11,   3,  15,    2,   -7 },   // 0x7E
+  {  1143,   9,  16,  11,    1,  -12 },   // 0x7F
+  {  1161,   9,  16,  11,    1,  -12 },   // 0x80
+  {  1179,   9,  16,  11,    1,  -12 },   // 0x81
+  {  1197,   9,  16,  11,    1,  -12 },   // 0x82
+  {  1215,   9,  16,  11,    1,  -12 },   // 0x83
+  {  1233,   9,  16,  11,    1,  -12 },   // 0x84
+  {  1251,   9,  16,  11,    1,  -12 },   // 0x85
+  {  1269,   9,  16,  11,    1,  -12 },   // 0x86
+  {  1287,   9,  16,  11,    1,  -12 },   // 0x87
+  {  1305,   9,  16,  11,    1,  -12 },   // 0x88
+  {  1323,   9,  16,  11,    1,  -12 },   // 0x89
+  {  1341,   9,  16,  11,    1,  -12 },   // 0x8A
+  {  1359,   9,  16,  11,    1,  -12 },   // 0x8B
+  {  1377,   9,  16,  11,    1,  -12 },   // 0x8C
+  {  1395,   9,  16,  11,    1,  -12 },   // 0x8D
+  {  1413,   9,  16,  11,    1,  -12 },   // 0x8E
+  {  1431,   9,  16,  11,    1,  -12 },   // 0x8F
+  {  1449,   9,  16,  11,    1,  -12 },   // 0x90
+  {  1467,   9,  16,  11,    1,  -12 },   // 0x91
+  {  1485,   9,  16,  11,    1,  -12 },   // 0x92
+  {  1503,   9,  16,  11,    1,  -12 },   // 0x93
+  {  1521,   9,  16,  11,    1,  -12 },   // 0x94
+  {  1539,   9,  16,  11,    1,  -12 },   // 0x95
+  {  1557,   9,  16,  11,    1,  -12 },   // 0x96
+  {  1575,   9,  16,  11,    1,  -12 },   // 0x97
+  {  1593,   9,  16,  11,    1,  -12 },   // 0x98
+  {  1611,   9,  16,  11,    1,  -12 },   // 0x99
+  {  1629,   9,  16,  11,    1,  -12 },   // 0x9A
+  {  1647,   9,  16,  11,    1,  -12 },   // 0x9B
+  {  1665,   9,  16,  11,    1,  -12 },   // 0x9C
+  {  1683,   9,  16,  11,    1,  -12 },   // 0x9D
+  {  1701,   9,  16,  11,    1,  -12 },   // 0x9E
+  {  1719,   9,  16,  11,    1,  -12 },   // 0x9F
+  {  1737,   1,   1,   6,    0,    0 },   // 0xA0
+  {  1737,   2,  13,   7,    3,   -9 },   // 0xA1
+  {  1740,   8,  16,  11,    2,  -12 },   // 0xA2
+  {  1760,   9,  13,  11,    1,  -12 },   // 0xA3
+  {  1773,   9,   9,  11,    1,   -9 },   // 0xA4
+  {  1788,  10,  13,  11,    1,  -12 },   // 0xA5
+  {  1804,   2,  16,   6,    2,  -12 },   // 0xA6
+  {  1807,   7,  15,   9,    1,  -12 },   // 0xA7
+  {  1820,   6,   2,   9,    2,  -13 },   // 0xA8
+  {  1823,  13,  13,  18,    2,  -12 },   // 0xA9
+  {  1847,   7,   9,   8,    1,  -12 },   // 0xAA
+  {  1856,   8,   8,  11,    1,   -8 },   // 0xAB
+  {  1868,  11,   5,  15,    2,   -7 },   // 0xAC
+  {  1874,   5,   2,   7,    1,   -5 },   // 0xAD
+  {  1876,  13,  13,  18,    2,  -12 },   // 0xAE
+  {  1901,   5,   2,   9,    2,  -12 },   // 0xAF
+  {  1903,   6,   6,   9,    2,  -12 },   // 0xB0
+  {  1909,  12,  11,  15,    2,  -10 },   // 0xB1
+  {  1920,   5,   7,   7,    1,  -12 },   // 0xB2
+  {  1926,   5,   7,   7,    1,  -12 },   // 0xB3
+  {  1931,   4,   3,   9,    3,  -13 },   // 0xB4
+  {  1934,   9,  14,  11,    2,   -9 },   // 0xB5
+  {  1952,   8,  15,  11,    1,  -12 },   // 0xB6
+  {  1971,   2,   2,   6,    2,   -6 },   // 0xB7
+  {  1972,   4,   3,   9,    3,    1 },   // 0xB8
+  {  1974,   5,   7,   7,    1,  -12 },   // 0xB9
+  {  1980,   7,   9,   8,    1,  -12 },   // 0xBA
+  {  1988,   8,   8,  11,    2,   -8 },   // 0xBB
+  {  2000,  16,  13,  17,    1,  -12 },   // 0xBC
+  {  2027,  15,  13,  17,    1,  -12 },   // 0xBD
+  {  2051,  16,  13,  17,    1,  -12 },   // 0xBE
+  {  2077,   7,  14,  10,    2,   -9 },   // 0xBF
+  {  2088,  12,  16,  12,    0,  -15 },   // 0xC0
+  {  2109,  12,  16,  12,    0,  -15 },   // 0xC1
+  {  2130,  12,  16,  12,    0,  -15 },   // 0xC2
+  {  2152,  12,  16,  12,    0,  -15 },   // 0xC3
+  {  2174,  12,  16,  12,    0,  -15 },   // 0xC4
+  {  2196,  12,  17,  12,    0,  -16 },   // 0xC5
+  {  2221,  16,  13,  17,    0,  -12 },   // 0xC6
+  {  2243,  11,  16,  13,    1,  -12 },   // 0xC7
+  {  2261,   8,  16,  11,    2,  -15 },   // 0xC8
+  {  2272,   8,  16,  11,    2,  -15 },   // 0xC9
+  {  2283,   8,  16,  11,    2,  -15 },   // 0xCA
+  {  2294,   8,  16,  11,    2,  -15 },   // 0xCB
+  {  2306,   4,  16,   6,    0,  -15 },   // 0xCC
+  {  2318,   3,  16,   6,    1,  -15 },   // 0xCD
+  {  2329,   6,  16,   6,    0,  -15 },   // 0xCE
+  {  2342,   6,  16,   6,    0,  -15 },   // 0xCF
+  {  2355,  13,  13,  14,    0,  -12 },   // 0xD0
+  {  2374,  10,  16,  14,    2,  -15 },   // 0xD1
+  {  2392,  12,  16,  14,    1,  -15 },   // 0xD2
+  {  2411,  12,  16,  14,    1,  -15 },   // 0xD3
+  {  2430,  12,  16,  14,    1,  -15 },   // 0xD4
+  {  2450,  12,  16,  14,    1,  -15 },   // 0xD5
+  {  2470,  12,  16,  14,    1,  -15 },   // 0xD6
+  {  2490,  10,  10,  15,    2,  -10 },   // 0xD7
+  {  2502,  12,  13,  14,    1,  -12 },   // 0xD8
+  {  2523,  10,  16,  14,    2,  -15 },   // 0xD9
+  {  2538,  10,  16,  14,    2,  -15 },   // 0xDA
+  {  2553,  10,  16,  14,    2,  -15 },   // 0xDB
+  {  2568,  10,  16,  14,    2,  -15 },   // 0xDC
+  {  2583,  12,  16,  12,    0,  -15 },   // 0xDD
+  {  2603,   8,  13,  11,    2,  -12 },   // 0xDE
+  {  2614,   9,  14,  11,    2,  -13 },   // 0xDF
+  {  2632,   8,  14,  10,    1,  -13 },   // 0xE0
+  {  2644,   8,  14,  10,    1,  -13 },   // 0xE1
+  {  2656,   8,  14,  10,    1,  -13 },   // 0xE2
+  {  2668,   8,  14,  10,    1,  -13 },   // 0xE3
+  {  2681,   8,  14,  10,    1,  -13 },   // 0xE4
+  {  2694,   8,  16,  10,    1,  -15 },   // 0xE5
+  {  2709,  15,  10,  17,    1,   -9 },   // 0xE6
+  {  2725,   8,  13,   9,    1,   -9 },   // 0xE7
+  {  2737,  10,  14,  11,    1,  -13 },   // 0xE8
+  {  2750,  10,  14,  11,    1,  -13 },   // 0xE9
+  {  2763,  10,  14,  11,    1,  -13 },   // 0xEA
+  {  2777,  10,  14,  11,    1,  -13 },   // 0xEB
+  {  2791,   4,  14,   5,    0,  -13 },   // 0xEC
+  {  2801,   4,  14,   5,    1,  -13 },   // 0xED
+  {  2812,   6,  14,   5,    0,  -13 },   // 0xEE
+  {  2823,   6,  14,   5,    0,  -13 },   // 0xEF
+  {  2834,  10,  14,  11,    1,  -13 },   // 0xF0
+  {  2848,   8,  14,  11,    2,  -13 },   // 0xF1
+  {  2862,  10,  14,  11,    1,  -13 },   // 0xF2
+  {  2877,  10,  14,  11,    1,  -13 },   // 0xF3
+  {  2892,  10,  14,  11,    1,  -13 },   // 0xF4
+  {  2907,  10,  14,  11,    1,  -13 },   // 0xF5
+  {  2922,  10,  14,  11,    1,  -13 },   // 0xF6
+  {  2937,  12,   8,  15,    2,   -9 },   // 0xF7
+  {  2945,  10,  12,  11,    1,  -10 },   // 0xF8
+  {  2962,   8,  14,  11,    2,  -13 },   // 0xF9
+  {  2975,   8,  14,  11,    2,  -13 },   // 0xFA
+  {  2987,   8,  14,  11,    2,  -13 },   // 0xFB
+  {  3000,   8,  14,  11,    2,  -13 },   // 0xFC
+  {  3014,  10,  18,  11,    1,  -13 },   // 0xFD
+  {  3034,   9,  18,  11,    2,  -13 },   // 0xFE
+  {  3053,  10,  18,  11,    1,  -13 }    // 0xFF
+};
+
+const RleFont DejaVuSans9pt8bRle = {
+  DejaVuSans9pt8bRleRuns, DejaVuSans9pt8bRleGlyphs, sizeof(DejaVuSans9pt8bRleRuns), 0x20, 0xFF, 21 };
+#endif // DEJAVUSANS9PT8B_RLE_H
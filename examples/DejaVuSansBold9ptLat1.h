@@ -542,4 +542,235 @@ const GFXfont DejaVuSans_Bold9pt8b PROGMEM = {
   0x20, 0xFF, 21 };
 
 // Approx. 5267 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold9pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   3,   8,   6 },   // 0x21
+  {   2,   9,   8 },   // 0x22
+  {   1,  15,  14 },   // 0x23
+  {   1,  13,  11 },   // 0x24
+  {   1,  18,  18 },   // 0x25
+  {   1,  16,  15 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   8,   7 },   // 0x28
+  {   2,   8,   7 },   // 0x29
+  {   0,   9,  10 },   // 0x2A
+  {   2,  15,  14 },   // 0x2B
+  {   1,   7,   5 },   // 0x2C
+  {   1,   7,   7 },   // 0x2D
+  {   2,   7,   5 },   // 0x2E
+  {   0,   7,   7 },   // 0x2F
+  {   1,  13,  12 },   // 0x30
+  {   2,  13,  11 },   // 0x31
+  {   1,  13,  11 },   // 0x32
+  {   1,  13,  11 },   // 0x33
+  {   1,  13,  12 },   // 0x34
+  {   1,  13,  11 },   // 0x35
+  {   1,  13,  11 },   // 0x36
+  {   1,  13,  11 },   // 0x37
+  {   1,  13,  11 },   // 0x38
+  {   1,  13,  11 },   // 0x39
+  {   2,   7,   5 },   // 0x3A
+  {   1,   7,   5 },   // 0x3B
+  {   2,  15,  13 },   // 0x3C
+  {   2,  15,  13 },   // 0x3D
+  {   2,  15,  13 },   // 0x3E
+  {   1,  10,   9 },   // 0x3F
+  {   1,  18,  17 },   // 0x40
+  {   0,  14,  14 },   // 0x41
+  {   2,  14,  13 },   // 0x42
+  {   1,  13,  12 },   // 0x43
+  {   2,  15,  14 },   // 0x44
+  {   2,  12,  11 },   // 0x45
+  {   2,  12,  11 },   // 0x46
+  {   1,  15,  14 },   // 0x47
+  {   2,  16,  14 },   // 0x48
+  {   2,   7,   5 },   // 0x49
+  {  -1,   7,   5 },   // 0x4A
+  {   2,  14,  15 },   // 0x4B
+  {   2,  11,  11 },   // 0x4C
+  {   2,  18,  17 },   // 0x4D
+  {   2,  15,  14 },   // 0x4E
+  {   1,  15,  14 },   // 0x4F
+  {   2,  13,  13 },   // 0x50
+  {   1,  15,  14 },   // 0x51
+  {   2,  14,  14 },   // 0x52
+  {   1,  13,  11 },   // 0x53
+  {   0,  12,  11 },   // 0x54
+  {   2,  16,  14 },   // 0x55
+  {   0,  14,  14 },   // 0x56
+  {   1,  20,  20 },   // 0x57
+  {   0,  14,  13 },   // 0x58
+  {   0,  13,  13 },   // 0x59
+  {   1,  13,  12 },   // 0x5A
+  {   2,   8,   7 },   // 0x5B
+  {   0,   7,   7 },   // 0x5C
+  {   2,   8,   7 },   // 0x5D
+  {   2,  15,  13 },   // 0x5E
+  {   0,   9,   9 },   // 0x5F
+  {   1,   9,   6 },   // 0x60
+  {   1,  12,  11 },   // 0x61
+  {   2,  13,  13 },   // 0x62
+  {   1,  11,  10 },   // 0x63
+  {   1,  13,  12 },   // 0x64
+  {   1,  12,  12 },   // 0x65
+  {   0,   8,   8 },   // 0x66
+  {   1,  13,  12 },   // 0x67
+  {   2,  13,  12 },   // 0x68
+  {   2,   6,   5 },   // 0x69
+  {   0,   6,   5 },   // 0x6A
+  {   2,  12,  13 },   // 0x6B
+  {   2,   6,   5 },   // 0x6C
+  {   2,  18,  17 },   // 0x6D
+  {   2,  13,  12 },   // 0x6E
+  {   1,  12,  12 },   // 0x6F
+  {   2,  13,  13 },   // 0x70
+  {   1,  13,  12 },   // 0x71
+  {   2,   9,   9 },   // 0x72
+  {   1,  11,  10 },   // 0x73
+  {   1,   9,   9 },   // 0x74
+  {   2,  13,  12 },   // 0x75
+  {   1,  12,  12 },   // 0x76
+  {   1,  16,  16 },   // 0x77
+  {   1,  12,  12 },   // 0x78
+  {   1,  12,  12 },   // 0x79
+  {   1,  10,  10 },   // 0x7A
+  {   2,  13,  11 },   // 0x7B
+  {   2,   7,   4 },   // 0x7C
+  {   2,  13,  11 },   // 0x7D
+  {   2,  15,  13 },   // 0x7E
+  {   1,  11,  10 },   // 0x7F
+  {   1,  11,  10 },   // 0x80
+  {   1,  11,  10 },   // 0x81
+  {   1,  11,  10 },   // 0x82
+  {   1,  11,  10 },   // 0x83
+  {   1,  11,  10 },   // 0x84
+  {   1,  11,  10 },   // 0x85
+  {   1,  11,  10 },   // 0x86
+  {   1,  11,  10 },   // 0x87
+  {   1,  11,  10 },   // 0x88
+  {   1,  11,  10 },   // 0x89
+  {   1,  11,  10 },   // 0x8A
+  {   1,  11,  10 },   // 0x8B
+  {   1,  11,  10 },   // 0x8C
+  {   1,  11,  10 },   // 0x8D
+  {   1,  11,  10 },   // 0x8E
+  {   1,  11,  10 },   // 0x8F
+  {   1,  11,  10 },   // 0x90
+  {   1,  11,  10 },   // 0x91
+  {   1,  11,  10 },   // 0x92
+  {   1,  11,  10 },   // 0x93
+  {   1,  11,  10 },   // 0x94
+  {   1,  11,  10 },   // 0x95
+  {   1,  11,  10 },   // 0x96
+  {   1,  11,  10 },   // 0x97
+  {   1,  11,  10 },   // 0x98
+  {   1,  11,  10 },   // 0x99
+  {   1,  11,  10 },   // 0x9A
+  {   1,  11,  10 },   // 0x9B
+  {   1,  11,  10 },   // 0x9C
+  {   1,  11,  10 },   // 0x9D
+  {   1,  11,  10 },   // 0x9E
+  {   1,  11,  10 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   3,   8,   6 },   // 0xA1
+  {   2,  13,  10 },   // 0xA2
+  {   1,  13,  11 },   // 0xA3
+  {   1,  11,  11 },   // 0xA4
+  {   1,  13,  12 },   // 0xA5
+  {   2,   7,   4 },   // 0xA6
+  {   1,   9,  10 },   // 0xA7
+  {   2,   9,   7 },   // 0xA8
+  {   2,  18,  15 },   // 0xA9
+  {   1,  10,   8 },   // 0xAA
+  {   1,  12,   9 },   // 0xAB
+  {   2,  15,  13 },   // 0xAC
+  {   1,   7,   7 },   // 0xAD
+  {   2,  18,  15 },   // 0xAE
+  {   2,   9,   8 },   // 0xAF
+  {   2,   9,   8 },   // 0xB0
+  {   2,  15,  14 },   // 0xB1
+  {   1,   8,   7 },   // 0xB2
+  {   1,   8,   7 },   // 0xB3
+  {   3,   9,   8 },   // 0xB4
+  {   2,  13,  13 },   // 0xB5
+  {   1,  11,  11 },   // 0xB6
+  {   2,   7,   5 },   // 0xB7
+  {   2,   9,   6 },   // 0xB8
+  {   1,   8,   7 },   // 0xB9
+  {   1,  10,   9 },   // 0xBA
+  {   2,  12,  10 },   // 0xBB
+  {   1,  19,  17 },   // 0xBC
+  {   1,  19,  18 },   // 0xBD
+  {   1,  19,  17 },   // 0xBE
+  {   1,  10,   9 },   // 0xBF
+  {   0,  14,  14 },   // 0xC0
+  {   0,  14,  14 },   // 0xC1
+  {   0,  14,  14 },   // 0xC2
+  {   0,  14,  14 },   // 0xC3
+  {   0,  14,  14 },   // 0xC4
+  {   0,  14,  14 },   // 0xC5
+  {   0,  20,  18 },   // 0xC6
+  {   1,  13,  12 },   // 0xC7
+  {   2,  12,  11 },   // 0xC8
+  {   2,  12,  11 },   // 0xC9
+  {   2,  12,  11 },   // 0xCA
+  {   2,  12,  11 },   // 0xCB
+  {   1,   7,   5 },   // 0xCC
+  {   2,   7,   6 },   // 0xCD
+  {   0,   7,   7 },   // 0xCE
+  {   1,   7,   6 },   // 0xCF
+  {   0,  15,  14 },   // 0xD0
+  {   2,  15,  14 },   // 0xD1
+  {   1,  15,  14 },   // 0xD2
+  {   1,  15,  14 },   // 0xD3
+  {   1,  15,  14 },   // 0xD4
+  {   1,  15,  14 },   // 0xD5
+  {   1,  15,  14 },   // 0xD6
+  {   2,  15,  13 },   // 0xD7
+  {   0,  15,  14 },   // 0xD8
+  {   2,  16,  14 },   // 0xD9
+  {   2,  16,  14 },   // 0xDA
+  {   2,  16,  14 },   // 0xDB
+  {   2,  16,  14 },   // 0xDC
+  {   0,  13,  13 },   // 0xDD
+  {   2,  13,  13 },   // 0xDE
+  {   2,  14,  13 },   // 0xDF
+  {   1,  12,  11 },   // 0xE0
+  {   1,  12,  11 },   // 0xE1
+  {   1,  12,  11 },   // 0xE2
+  {   1,  12,  11 },   // 0xE3
+  {   1,  12,  11 },   // 0xE4
+  {   1,  12,  11 },   // 0xE5
+  {   1,  18,  18 },   // 0xE6
+  {   1,  11,  10 },   // 0xE7
+  {   1,  12,  12 },   // 0xE8
+  {   1,  12,  12 },   // 0xE9
+  {   1,  12,  12 },   // 0xEA
+  {   1,  12,  12 },   // 0xEB
+  {   0,   6,   5 },   // 0xEC
+  {   2,   6,   7 },   // 0xED
+  {   0,   6,   7 },   // 0xEE
+  {   1,   6,   6 },   // 0xEF
+  {   1,  12,  12 },   // 0xF0
+  {   2,  13,  12 },   // 0xF1
+  {   1,  12,  12 },   // 0xF2
+  {   1,  12,  12 },   // 0xF3
+  {   1,  12,  12 },   // 0xF4
+  {   1,  12,  12 },   // 0xF5
+  {   1,  12,  12 },   // 0xF6
+  {   2,  15,  13 },   // 0xF7
+  {   1,  12,  12 },   // 0xF8
+  {   2,  13,  12 },   // 0xF9
+  {   2,  13,  12 },   // 0xFA
+  {   2,  13,  12 },   // 0xFB
+  {   2,  13,  12 },   // 0xFC
+  {   1,  12,  12 },   // 0xFD
+  {   2,  13,  13 },   // 0xFE
+  {   1,  12,  12 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold9pt8bWidths = { DejaVuSans_Bold9pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
 #endif // DEJAVUSANSBOLD9PTLAT1__H
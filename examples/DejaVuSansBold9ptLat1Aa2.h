@@ -0,0 +1,872 @@
+#ifndef DEJAVUSANS_BOLD9PT8BAA2_H
+#define DEJAVUSANS_BOLD9PT8BAA2_H
+// Police anti-aliasée 2 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans_Bold9pt8bAa2Bitmaps[] PROGMEM = {
+  0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x7E, 0x7D, 0x7D, 0x28, 0x00, 0xBE, 0xBE,
+  0xBE, 0x78, 0xB9, 0xE2, 0xE7, 0x8B, 0x9E, 0x2E, 0x78, 0x74, 0x00, 0x78,
+  0x3C, 0x00, 0x1D, 0x1E, 0x00, 0x0B, 0x0B, 0x40, 0xBF, 0xFF, 0xFE, 0x2F,
+  0xFF, 0xFF, 0x40, 0xB4, 0x78, 0x00, 0x2D, 0x2D, 0x00, 0x0F, 0x0B, 0x40,
+  0xBF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x80, 0xB4, 0x78, 0x00, 0x3C, 0x2D,
+  0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x0A, 0xFE,
+  0x83, 0xFF, 0xFD, 0x7D, 0xB1, 0x9B, 0xDB, 0x00, 0x7F, 0xF4, 0x03, 0xFF,
+  0xF8, 0x0B, 0xFF, 0xE0, 0x0B, 0xBF, 0x00, 0xB2, 0xFA, 0x4B, 0x3F, 0xBF,
+  0xFF, 0xD6, 0xBF, 0xE4, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x0B, 0xE0, 0x01,
+  0xD0, 0x0F, 0xAF, 0x00, 0xF0, 0x07, 0x83, 0xD0, 0xB4, 0x01, 0xE0, 0xB4,
+  0x78, 0x00, 0x3D, 0x7C, 0x3C, 0x00, 0x07, 0xFD, 0x2D, 0x00, 0x00, 0x14,
+  0x0E, 0x1F, 0xE0, 0x00, 0x0B, 0x5F, 0x6E, 0x00, 0x07, 0x8B, 0x47, 0xC0,
+  0x03, 0xC2, 0xD0, 0xF0, 0x02, 0xD0, 0xB8, 0x7C, 0x01, 0xE0, 0x1F, 0xBE,
+  0x00, 0xB0, 0x01, 0xBD, 0x00, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0xFD, 0x00,
+  0x0F, 0xD1, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFF,
+  0x80, 0xA8, 0x7F, 0xBE, 0x0F, 0xCB, 0xD2, 0xF9, 0xF8, 0xFC, 0x0B, 0xFF,
+  0x0F, 0xD0, 0x3F, 0xD0, 0xBF, 0x97, 0xFE, 0x02, 0xFF, 0xFF, 0xF4, 0x06,
+  0xFE, 0x5F, 0xD0, 0x79, 0xE7, 0x9E, 0x78, 0x07, 0xD0, 0xBC, 0x1F, 0x82,
+  0xF4, 0x3F, 0x07, 0xE0, 0x7E, 0x07, 0xD0, 0x7D, 0x07, 0xE0, 0x7E, 0x03,
+  0xF0, 0x2F, 0x41, 0xF8, 0x0B, 0xC0, 0x3D, 0x7D, 0x03, 0xE0, 0x1F, 0x40,
+  0xF8, 0x0F, 0xC0, 0xBD, 0x07, 0xD0, 0x7E, 0x07, 0xE0, 0xBD, 0x0B, 0xD0,
+  0xFC, 0x0F, 0x82, 0xF4, 0x3E, 0x07, 0xD0, 0x00, 0xD0, 0x04, 0x34, 0x57,
+  0x9D, 0xB8, 0x6F, 0xF4, 0x07, 0xF8, 0x1F, 0xBB, 0xD6, 0x0D, 0x24, 0x03,
+  0x40, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40,
+  0x00, 0x2D, 0x00, 0x00, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D,
+  0x00, 0x7E, 0x7F, 0x7F, 0x7D, 0xB8, 0xF0, 0xAA, 0x9F, 0xFD, 0xFF, 0xD0,
+  0x15, 0x7F, 0x7F, 0x7F, 0x00, 0xB4, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x03,
+  0xC0, 0x1E, 0x00, 0xB4, 0x02, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0x0F,
+  0x00, 0x78, 0x02, 0xD0, 0x05, 0x00, 0x00, 0x06, 0xF9, 0x00, 0xBF, 0xFE,
+  0x07, 0xF5, 0xFE, 0x2F, 0x81, 0xFC, 0xFD, 0x03, 0xF7, 0xF4, 0x0F, 0xDF,
+  0xC0, 0x3F, 0x7F, 0x40, 0xFD, 0xFD, 0x03, 0xF6, 0xF8, 0x1F, 0xC7, 0xF5,
+  0xFE, 0x0B, 0xFF, 0xE0, 0x06, 0xFD, 0x00, 0x6F, 0xF0, 0x3F, 0xFC, 0x0A,
+  0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x05, 0x7F, 0x57, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x6B, 0xF9, 0x0B, 0xFF, 0xF8, 0xB9, 0x6F, 0xD4, 0x00, 0xFE, 0x00,
+  0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x07, 0xF4, 0x01,
+  0xFD, 0x00, 0x7F, 0x95, 0x5B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE0, 0x2B, 0xFA,
+  0x07, 0xFF, 0xFC, 0x65, 0x6F, 0xD0, 0x00, 0xBE, 0x00, 0x1F, 0xD0, 0xBF,
+  0xF4, 0x0B, 0xFF, 0x40, 0x05, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0xA5,
+  0x6F, 0xEB, 0xFF, 0xFC, 0x6F, 0xF9, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
+  0xE0, 0x00, 0xBF, 0xE0, 0x01, 0xFB, 0xE0, 0x03, 0xDB, 0xE0, 0x0B, 0x8B,
+  0xE0, 0x1F, 0x0B, 0xE0, 0x3D, 0x0B, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF,
+  0xFD, 0x15, 0x5B, 0xE5, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x3F, 0xFF,
+  0xC3, 0xFF, 0xFC, 0x3E, 0x55, 0x43, 0xE0, 0x00, 0x3F, 0xFE, 0x03, 0xFF,
+  0xFC, 0x39, 0x6F, 0xE0, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0xB9,
+  0x6F, 0xEB, 0xFF, 0xF8, 0x1B, 0xF9, 0x00, 0x01, 0xBF, 0x90, 0x3F, 0xFF,
+  0x42, 0xF9, 0x59, 0x1F, 0x80, 0x00, 0xBE, 0xBE, 0x42, 0xFF, 0xFF, 0x4F,
+  0xF5, 0xBF, 0x3F, 0x80, 0xFD, 0xBE, 0x03, 0xF5, 0xF8, 0x0F, 0xC3, 0xF4,
+  0xBE, 0x07, 0xFF, 0xF4, 0x06, 0xFE, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF,
+  0x55, 0x5F, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7E,
+  0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xBE,
+  0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFE, 0x43, 0xFF, 0xFD, 0xBF, 0x4B, 0xEB,
+  0xE0, 0x7E, 0x7F, 0x4B, 0xE1, 0xFF, 0xF4, 0x1F, 0xFF, 0x87, 0xE0, 0xBE,
+  0xBD, 0x03, 0xFF, 0xD0, 0x3F, 0xBE, 0x5B, 0xF7, 0xFF, 0xFD, 0x0B, 0xFE,
+  0x40, 0x0B, 0xF9, 0x03, 0xFF, 0xF8, 0xBE, 0x5F, 0xDF, 0xD0, 0x7E, 0xFD,
+  0x07, 0xFF, 0xE0, 0xFF, 0x7F, 0xFF, 0xF1, 0xFF, 0xBF, 0x00, 0x07, 0xF0,
+  0x00, 0xBE, 0x65, 0x6F, 0xC7, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xFF,
+  0xD5, 0x00, 0x05, 0x7F, 0xFF, 0xF0, 0x3F, 0x3F, 0x3F, 0x15, 0x00, 0x00,
+  0x3F, 0x3F, 0x3F, 0x7E, 0x7C, 0xB4, 0x00, 0x00, 0x04, 0x00, 0x06, 0xF0,
+  0x06, 0xFF, 0x86, 0xFF, 0x90, 0xFF, 0x90, 0x03, 0xF4, 0x00, 0x0B, 0xFE,
+  0x40, 0x01, 0xBF, 0xE4, 0x00, 0x1F, 0xF8, 0x00, 0x06, 0xF0, 0x00, 0x00,
+  0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x40, 0x00, 0x03, 0xE4, 0x00, 0x0B,
+  0xFE, 0x40, 0x01, 0xBF, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xF0, 0x06,
+  0xFF, 0x86, 0xFF, 0x90, 0xFF, 0x90, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x6F, 0xE4, 0xBF, 0xFE, 0xA5, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x01,
+  0xFD, 0x07, 0xF4, 0x0F, 0xD0, 0x0A, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
+  0xC0, 0x0F, 0xC0, 0x00, 0x16, 0x94, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07,
+  0xE4, 0x1B, 0xD0, 0x1E, 0x00, 0x00, 0xB4, 0x3C, 0x06, 0x59, 0x38, 0x74,
+  0x3F, 0xFD, 0x2C, 0xB0, 0x78, 0x7D, 0x1D, 0xB0, 0xB4, 0x2D, 0x1D, 0xA0,
+  0xB4, 0x2D, 0x1D, 0xB0, 0xB4, 0x2D, 0x3C, 0x74, 0x3E, 0xBF, 0xF4, 0x38,
+  0x1F, 0x9F, 0x80, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x07, 0x40, 0x02,
+  0xFA, 0xBF, 0x40, 0x00, 0x6F, 0xE8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
+  0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0x00, 0x02, 0xF6, 0xF4,
+  0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0B, 0xE0, 0x1F,
+  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0x6F, 0x87, 0xF0, 0x01,
+  0xFC, 0xBE, 0x00, 0x0F, 0xD0, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0xC7, 0xF5,
+  0x7F, 0x9F, 0xC0, 0xBE, 0x7F, 0x03, 0xF5, 0xFF, 0xFF, 0x87, 0xFF, 0xFE,
+  0x1F, 0xD5, 0xBE, 0x7F, 0x01, 0xFD, 0xFC, 0x07, 0xF7, 0xF5, 0x6F, 0xDF,
+  0xFF, 0xFD, 0x7F, 0xFF, 0x90, 0x01, 0xBF, 0xA0, 0x2F, 0xFF, 0xE3, 0xFE,
+  0x5B, 0x9F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
+  0x3F, 0x40, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x13, 0xFE, 0x5B, 0x82,
+  0xFF, 0xFE, 0x01, 0xBF, 0xA0, 0x7F, 0xFE, 0x80, 0x1F, 0xFF, 0xFD, 0x07,
+  0xFA, 0xBF, 0xD1, 0xFC, 0x02, 0xFC, 0x7F, 0x00, 0x3F, 0x5F, 0xC0, 0x0B,
+  0xE7, 0xF0, 0x02, 0xF9, 0xFC, 0x00, 0xBE, 0x7F, 0x00, 0x3F, 0x5F, 0xC0,
+  0x2F, 0xC7, 0xFA, 0xBF, 0xD1, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0x80, 0x00,
+  0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x7F, 0xAA, 0x97, 0xF0, 0x00, 0x7F, 0x00,
+  0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFA, 0xA8, 0x7F, 0x00, 0x07, 0xF0,
+  0x00, 0x7F, 0xAA, 0x97, 0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE7,
+  0xFF, 0xFE, 0x7F, 0xAA, 0x97, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xFD,
+  0x7F, 0xFF, 0xD7, 0xFA, 0xA8, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00,
+  0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x02, 0xFF, 0xFF,
+  0x82, 0xFE, 0x9A, 0xE1, 0xFD, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x3F, 0x40,
+  0x55, 0x4F, 0xD0, 0x3F, 0xF7, 0xF4, 0x0F, 0xFD, 0xFE, 0x00, 0x3F, 0x5F,
+  0xD0, 0x0F, 0xD3, 0xFE, 0x5B, 0xF4, 0x2F, 0xFF, 0xFC, 0x01, 0xBF, 0xE4,
+  0x00, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00,
+  0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xAA,
+  0xBF, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00,
+  0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
+  0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
+  0xF0, 0xBE, 0xAF, 0xDF, 0xF8, 0xF9, 0x00, 0x7F, 0x00, 0xBF, 0x1F, 0xC0,
+  0xBF, 0x07, 0xF0, 0xBF, 0x01, 0xFC, 0xBF, 0x00, 0x7F, 0xBF, 0x00, 0x1F,
+  0xFF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0x7F, 0x80,
+  0x1F, 0xC7, 0xF8, 0x07, 0xF0, 0x7F, 0x81, 0xFC, 0x07, 0xF8, 0x7F, 0x00,
+  0x7F, 0x80, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
+  0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00,
+  0x07, 0xF0, 0x00, 0x7F, 0xAA, 0x97, 0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x0B, 0xFD, 0xFF, 0x40, 0x3F, 0xF7, 0xFF, 0x01, 0xFF, 0xDF, 0xFD,
+  0x0B, 0xFF, 0x7E, 0xB8, 0x7E, 0xFD, 0xF9, 0xF2, 0xF7, 0xF7, 0xE3, 0xEF,
+  0x9F, 0xDF, 0x8B, 0xFC, 0x7F, 0x7E, 0x0F, 0xE1, 0xFD, 0xF8, 0x2F, 0x47,
+  0xF7, 0xE0, 0x64, 0x1F, 0xDF, 0x80, 0x00, 0x7F, 0x7E, 0x00, 0x01, 0xFC,
+  0x7F, 0x80, 0x3F, 0x7F, 0xC0, 0x3F, 0x7F, 0xE0, 0x3F, 0x7F, 0xF0, 0x3F,
+  0x7F, 0xF8, 0x3F, 0x7E, 0x7D, 0x3F, 0x7E, 0x3E, 0x3F, 0x7E, 0x1F, 0x7F,
+  0x7E, 0x0F, 0xBF, 0x7E, 0x07, 0xFF, 0x7E, 0x03, 0xFF, 0x7E, 0x01, 0xFF,
+  0x7E, 0x00, 0xBF, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF, 0x03, 0xFE, 0x6F,
+  0xF2, 0xFD, 0x01, 0xFE, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xD0,
+  0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xEF, 0xD0, 0x1F, 0xE3,
+  0xFE, 0x6F, 0xF0, 0x7F, 0xFF, 0xF0, 0x01, 0xBF, 0x90, 0x00, 0x7F, 0xFF,
+  0x91, 0xFF, 0xFF, 0xD7, 0xF5, 0xBF, 0xDF, 0xC0, 0x7F, 0x7F, 0x01, 0xFD,
+  0xFC, 0x0B, 0xF7, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x7F, 0x55, 0x01, 0xFC,
+  0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xBF,
+  0x90, 0x07, 0xFF, 0xFF, 0x43, 0xFE, 0x6F, 0xF2, 0xFD, 0x01, 0xFE, 0xFE,
+  0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F,
+  0xFE, 0x00, 0x2F, 0xAF, 0xC0, 0x1F, 0xD3, 0xFE, 0x6F, 0xE0, 0x7F, 0xFF,
+  0xE0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00,
+  0x00, 0xA4, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x7F, 0x5B, 0xF4, 0x7F,
+  0x03, 0xF8, 0x7F, 0x02, 0xF4, 0x7F, 0x5B, 0xF0, 0x7F, 0xFF, 0x80, 0x7F,
+  0xFF, 0xD0, 0x7F, 0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x7F, 0x02, 0xFC, 0x7F,
+  0x00, 0xFD, 0x7F, 0x00, 0xBF, 0x0B, 0xFE, 0x90, 0xFF, 0xFF, 0x8B, 0xF9,
+  0xAE, 0x2F, 0x40, 0x00, 0xBE, 0x00, 0x01, 0xFF, 0xE4, 0x01, 0xFF, 0xFD,
+  0x00, 0x6F, 0xFC, 0x00, 0x07, 0xF5, 0x40, 0x0F, 0xDB, 0xA5, 0xBF, 0x2F,
+  0xFF, 0xF8, 0x1B, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A,
+  0xFF, 0xAA, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x3F,
+  0x40, 0xFD, 0x2F, 0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0x90, 0xBE,
+  0x00, 0x0F, 0xD7, 0xF0, 0x01, 0xFC, 0x3F, 0x40, 0x2F, 0x82, 0xF8, 0x03,
+  0xF4, 0x1F, 0xC0, 0x7F, 0x00, 0xFD, 0x0B, 0xE0, 0x0B, 0xE0, 0xFD, 0x00,
+  0x7F, 0x1F, 0x80, 0x02, 0xF6, 0xF4, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7E, 0x00, 0xFD,
+  0x01, 0xF8, 0xFC, 0x07, 0xF8, 0x0B, 0xE3, 0xF4, 0x1F, 0xF0, 0x3F, 0x4B,
+  0xE0, 0xBB, 0xC0, 0xFC, 0x1F, 0x83, 0xDF, 0x47, 0xF0, 0x7F, 0x0F, 0x2E,
+  0x2F, 0x80, 0xFD, 0x7C, 0x78, 0xBD, 0x02, 0xF6, 0xE1, 0xF3, 0xF0, 0x07,
+  0xEF, 0x43, 0xEF, 0xC0, 0x1F, 0xFD, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x2F,
+  0xF4, 0x00, 0xBF, 0x80, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
+  0x40, 0x2F, 0x87, 0xF0, 0x1F, 0xC0, 0xBE, 0x0F, 0xD0, 0x0F, 0xDB, 0xE0,
+  0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF,
+  0x80, 0x02, 0xFF, 0xF4, 0x01, 0xFD, 0xBF, 0x00, 0xFD, 0x0F, 0xE0, 0xBE,
+  0x01, 0xFD, 0x7F, 0x00, 0x2F, 0xC0, 0xBE, 0x00, 0x3F, 0x9F, 0xD0, 0x2F,
+  0xC2, 0xFC, 0x1F, 0xD0, 0x3F, 0x8F, 0xE0, 0x07, 0xFB, 0xF0, 0x00, 0xBF,
+  0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x2A, 0xAA, 0xFD, 0x00, 0x03,
+  0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x40, 0x01, 0xFD,
+  0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xEA, 0xAA, 0x7F, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0x7D, 0x07, 0xD0, 0x7D, 0x07,
+  0xD0, 0x7D, 0x07, 0xD0, 0x7D, 0x07, 0xD0, 0x7D, 0x07, 0xD0, 0x7D, 0x07,
+  0xD0, 0x7F, 0xF7, 0xFF, 0xF0, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x2D,
+  0x00, 0x78, 0x00, 0xF0, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x2D, 0x00,
+  0x74, 0x00, 0xE0, 0x02, 0xC0, 0x06, 0x40, 0xBF, 0xEB, 0xFE, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0xBF, 0xEB, 0xFE, 0x01, 0xF8, 0x00, 0x0F, 0xF8,
+  0x00, 0xFD, 0xF8, 0x0B, 0x81, 0xF8, 0xB8, 0x00, 0xB8, 0xAA, 0xAA, 0xBF,
+  0xFF, 0xE0, 0x64, 0x1F, 0x01, 0xE0, 0x1D, 0x1B, 0xFE, 0x40, 0x7F, 0xFF,
+  0x81, 0x50, 0x7F, 0x41, 0xAF, 0xFD, 0x2F, 0xFF, 0xF8, 0xFD, 0x0B, 0xE7,
+  0xF0, 0x2F, 0x8F, 0xD2, 0xFE, 0x2F, 0xFE, 0xF8, 0x2F, 0x9B, 0xE0, 0xBE,
+  0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x6F,
+  0x82, 0xFB, 0xFF, 0x8B, 0xF9, 0xBF, 0x6F, 0xC0, 0xBE, 0xBE, 0x01, 0xFA,
+  0xF8, 0x07, 0xEB, 0xF0, 0x2F, 0xAF, 0xE6, 0xFD, 0xBF, 0xFF, 0xE2, 0xF9,
+  0xBE, 0x00, 0x01, 0xBF, 0x80, 0xBF, 0xFD, 0x2F, 0xD5, 0x93, 0xF4, 0x00,
+  0x7F, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x59, 0x0F, 0xFF,
+  0xD0, 0x1B, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x06, 0xF8, 0xFC, 0x3F, 0xFB, 0xF2, 0xFD, 0x7F, 0xCF, 0xD0,
+  0x7F, 0x7F, 0x00, 0xFD, 0xFC, 0x03, 0xF3, 0xF4, 0x1F, 0xCB, 0xF5, 0xFF,
+  0x0F, 0xFF, 0xFC, 0x1B, 0xE3, 0xF0, 0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82,
+  0xF9, 0x2F, 0x8F, 0xC0, 0x3F, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3, 0xF0,
+  0x00, 0x0B, 0xE4, 0x1A, 0x0F, 0xFF, 0xF8, 0x06, 0xFE, 0x40, 0x02, 0xFE,
+  0x0B, 0xFE, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0xFE, 0xBF, 0xFE, 0x1F, 0xD4,
+  0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x0F, 0xC0, 0x06, 0xF8, 0xFC, 0x3F, 0xFB, 0xF2, 0xFD, 0x7F, 0xCF, 0xD0,
+  0x7F, 0x7F, 0x00, 0xFD, 0xFC, 0x03, 0xF3, 0xF4, 0x1F, 0xCB, 0xF5, 0xFF,
+  0x0F, 0xFE, 0xFC, 0x1B, 0xE3, 0xF0, 0x00, 0x1F, 0xC2, 0x51, 0xFE, 0x0F,
+  0xFF, 0xE0, 0x2B, 0xF9, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0,
+  0x00, 0x2F, 0x80, 0x00, 0xBE, 0x6F, 0x82, 0xFB, 0xFF, 0x8B, 0xF9, 0xBF,
+  0x2F, 0xC0, 0xFC, 0xBE, 0x03, 0xF6, 0xF8, 0x0F, 0xDB, 0xE0, 0x3F, 0x6F,
+  0x80, 0xFD, 0xBE, 0x03, 0xF6, 0xF8, 0x0F, 0xD0, 0xBE, 0xBE, 0x69, 0x00,
+  0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x0B, 0xE0,
+  0xBE, 0x06, 0x90, 0x00, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0,
+  0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xD0, 0xFD, 0xBF, 0xCB,
+  0xE0, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00,
+  0xBE, 0x07, 0xF6, 0xF8, 0x7F, 0x4B, 0xE7, 0xF4, 0x2F, 0xBF, 0x40, 0xBF,
+  0xF4, 0x02, 0xFF, 0xE0, 0x0B, 0xEB, 0xE0, 0x2F, 0x8F, 0xE0, 0xBE, 0x0F,
+  0xE2, 0xF8, 0x1F, 0xE0, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+  0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x6E, 0x46, 0xF4, 0xBE, 0xFF,
+  0xDF, 0xFD, 0xBF, 0x9F, 0xF9, 0xBE, 0xBF, 0x07, 0xF0, 0x7F, 0xBE, 0x07,
+  0xF0, 0x3F, 0xBE, 0x07, 0xE0, 0x3F, 0xBE, 0x07, 0xE0, 0x3F, 0xBE, 0x07,
+  0xE0, 0x3F, 0xBE, 0x07, 0xE0, 0x3F, 0xBE, 0x07, 0xE0, 0x3F, 0xBE, 0x6F,
+  0x82, 0xFF, 0xFF, 0x8B, 0xF9, 0xBF, 0x2F, 0xC0, 0xFC, 0xBE, 0x03, 0xF6,
+  0xF8, 0x0F, 0xDB, 0xE0, 0x3F, 0x6F, 0x80, 0xFD, 0xBE, 0x03, 0xF6, 0xF8,
+  0x0F, 0xD0, 0x02, 0xBF, 0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0xD6, 0xF8, 0x3F,
+  0x40, 0xFC, 0x7F, 0x00, 0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40, 0xFC, 0x2F,
+  0xD6, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xBF, 0x80, 0xBE, 0x6F, 0x82, 0xFF,
+  0xFF, 0x8B, 0xF4, 0x7F, 0x6F, 0x80, 0xBE, 0xBE, 0x01, 0xFA, 0xF8, 0x07,
+  0xEB, 0xF0, 0x2F, 0xAF, 0xE6, 0xFD, 0xBE, 0xFF, 0xE2, 0xF9, 0xBE, 0x0B,
+  0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06,
+  0xF8, 0xFC, 0x3F, 0xFB, 0xF2, 0xFD, 0x7F, 0xCF, 0xD0, 0x7F, 0x7F, 0x00,
+  0xFD, 0xFC, 0x03, 0xF3, 0xF4, 0x1F, 0xCB, 0xF5, 0xFF, 0x0F, 0xFE, 0xFC,
+  0x1B, 0xE3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
+  0x03, 0xF0, 0xBE, 0x6E, 0xBF, 0xFE, 0xBF, 0x95, 0xBF, 0x00, 0xBE, 0x00,
+  0xBE, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0x2F, 0xFA,
+  0x2F, 0xFF, 0xCF, 0x91, 0x63, 0xF4, 0x00, 0xBF, 0xF9, 0x06, 0xFF, 0xD0,
+  0x02, 0xFA, 0x50, 0xBE, 0xFF, 0xFF, 0x5B, 0xFE, 0x40, 0x0A, 0x40, 0x1F,
+  0xC0, 0x1F, 0xC0, 0xBF, 0xFF, 0xBF, 0xFF, 0x5F, 0xD5, 0x1F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x0F, 0xD5, 0x0F, 0xFE, 0x06, 0xFE, 0xBD,
+  0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB,
+  0xD0, 0x3F, 0xBE, 0x07, 0xF7, 0xF5, 0xFF, 0x3F, 0xFB, 0xF1, 0xBE, 0x3F,
+  0xBE, 0x00, 0xFD, 0xFC, 0x07, 0xE2, 0xF4, 0x2F, 0x47, 0xE0, 0xFC, 0x0F,
+  0xC7, 0xE0, 0x2F, 0x6F, 0x00, 0x7E, 0xF8, 0x00, 0xFF, 0xD0, 0x02, 0xFF,
+  0x00, 0x03, 0xF8, 0x00, 0x7E, 0x07, 0xE0, 0x7E, 0x3F, 0x07, 0xE0, 0xBD,
+  0x2F, 0x4B, 0xF0, 0xFC, 0x1F, 0x4F, 0xB4, 0xF8, 0x1F, 0x9E, 0xB5, 0xF8,
+  0x0F, 0xDE, 0x7A, 0xF4, 0x0B, 0xED, 0x3F, 0xF0, 0x07, 0xFC, 0x2F, 0xE0,
+  0x07, 0xFC, 0x2F, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0x7F, 0x02, 0xF8, 0x7E,
+  0x1F, 0x80, 0xBD, 0xFD, 0x00, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xFC,
+  0x00, 0x7F, 0xF8, 0x03, 0xF7, 0xF4, 0x2F, 0x87, 0xF1, 0xFC, 0x0B, 0xE0,
+  0xBD, 0x00, 0xFD, 0xFC, 0x07, 0xE2, 0xF4, 0x2F, 0x47, 0xE0, 0xFC, 0x0F,
+  0xC7, 0xE0, 0x2F, 0x6F, 0x00, 0x3E, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF,
+  0x00, 0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00,
+  0x7F, 0x40, 0x00, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x15, 0x6F, 0xD0, 0x07,
+  0xF4, 0x01, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF9, 0x54, 0x7F,
+  0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0xBF, 0x40, 0xBF, 0xD0, 0x3F, 0x40, 0x0F,
+  0xC0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0xBE, 0x02, 0xFE, 0x00, 0xBF, 0xD0,
+  0x02, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xFD, 0x00,
+  0x2F, 0xF4, 0x02, 0xFD, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB,
+  0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xC0, 0xBF, 0x40, 0x2F, 0xF4, 0x00, 0xBE,
+  0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xFD,
+  0x02, 0xFF, 0x40, 0xFD, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x02,
+  0xF8, 0x0B, 0xFD, 0x02, 0xFD, 0x00, 0x6F, 0xA4, 0x1B, 0xFF, 0xFF, 0xF9,
+  0x06, 0xFE, 0x00, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0xFF, 0xFF, 0xBE, 0xBE, 0xBE, 0x00, 0x28, 0x7D, 0x7D, 0x7E, 0xBE,
+  0xBE, 0xBE, 0xBE, 0xBE, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x0B,
+  0xFE, 0x1F, 0xFF, 0xCF, 0xFE, 0x67, 0xF3, 0x41, 0xF8, 0xD0, 0x7E, 0x34,
+  0x1F, 0xCD, 0x03, 0xFF, 0x98, 0x7F, 0xFF, 0x02, 0xFF, 0x80, 0x0D, 0x00,
+  0x03, 0x40, 0x00, 0x40, 0x01, 0xBF, 0x90, 0x7F, 0xFE, 0x0B, 0xF5, 0xA0,
+  0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xF4,
+  0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x5F, 0xD5, 0x5F, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xE0, 0xA0, 0x01, 0x8F, 0xAA, 0xBD, 0x3F, 0xFF, 0x42, 0xD1, 0xF0, 0x3C,
+  0x0B, 0x43, 0x80, 0xB4, 0x3D, 0x0F, 0x03, 0xFF, 0xF4, 0xBA, 0xFB, 0xDA,
+  0x00, 0x2C, 0x7F, 0x00, 0xBE, 0x3F, 0x81, 0xFD, 0x1F, 0xC2, 0xF8, 0x0B,
+  0xE7, 0xF0, 0x07, 0xFF, 0xD0, 0x7F, 0xFF, 0xFE, 0x6A, 0xFF, 0xA9, 0x00,
+  0xBE, 0x00, 0x7F, 0xFF, 0xFE, 0x6A, 0xFF, 0xA9, 0x00, 0xBE, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0xBE, 0x00, 0x62, 0xDB, 0x6D, 0xB6, 0xDB, 0x40, 0x01,
+  0x8B, 0x6D, 0xB6, 0xDB, 0x6D, 0x0B, 0xF9, 0x0B, 0xFF, 0x83, 0xE0, 0x10,
+  0xFD, 0x00, 0x1F, 0xF4, 0x0F, 0xFF, 0x8B, 0x82, 0xFB, 0xE0, 0x2E, 0xBE,
+  0x0F, 0x8F, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFC, 0x10, 0x3F, 0x0F, 0xFF,
+  0x82, 0xFF, 0x80, 0x78, 0xF7, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0x6E,
+  0x01, 0xE0, 0x00, 0xE0, 0xA1, 0xBF, 0x4D, 0x70, 0xFE, 0xD2, 0xDC, 0xB8,
+  0x00, 0x7A, 0x2D, 0x00, 0x0D, 0x8B, 0x80, 0x07, 0x71, 0xF4, 0x51, 0xCE,
+  0x2F, 0xF4, 0xE1, 0xD1, 0xA4, 0xB0, 0x1E, 0x41, 0xF4, 0x01, 0xBF, 0xE0,
+  0x00, 0x01, 0x40, 0x00, 0x2F, 0xE4, 0x39, 0xBD, 0x00, 0x2E, 0x2F, 0xFE,
+  0x79, 0x6E, 0xB9, 0x7E, 0x2F, 0xAE, 0x00, 0x00, 0x6A, 0xA9, 0x7F, 0xFE,
+  0x01, 0x81, 0x82, 0xE2, 0xE7, 0xE6, 0xE2, 0xD2, 0xE0, 0xBD, 0x7D, 0x07,
+  0xD7, 0xD0, 0x78, 0x78, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x90, 0xAA,
+  0x9F, 0xFD, 0xFF, 0xD0, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0x6E, 0x01, 0xE0,
+  0x00, 0xE0, 0xA2, 0xFE, 0x0D, 0x70, 0xB6, 0xE2, 0xDC, 0x2C, 0xB8, 0x7A,
+  0x0B, 0xF8, 0x0D, 0x82, 0xDE, 0x07, 0x70, 0xB2, 0xD1, 0xCE, 0x2C, 0x78,
+  0xE1, 0xD5, 0x05, 0xB0, 0x1E, 0x41, 0xF4, 0x01, 0xBF, 0xE0, 0x00, 0x01,
+  0x40, 0x00, 0x6A, 0xA7, 0xFF, 0x1F, 0xD1, 0xE6, 0xC7, 0x07, 0x5D, 0x2C,
+  0x2F, 0xD0, 0x04, 0x00, 0x00, 0x10, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40,
+  0x00, 0x2D, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0x40, 0x00,
+  0x2D, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xBF, 0x89, 0x6E, 0x02, 0xE0, 0x7C, 0x2E, 0x0B, 0xD5, 0xFF, 0xE0,
+  0xBF, 0x89, 0x6D, 0x02, 0xD3, 0xF8, 0x06, 0xE5, 0x6E, 0xBF, 0x80, 0x06,
+  0x43, 0xC2, 0xD2, 0xD0, 0xBE, 0x03, 0xF4, 0xBE, 0x03, 0xF4, 0xBE, 0x03,
+  0xF4, 0xBE, 0x03, 0xF4, 0xBE, 0x03, 0xF4, 0xBE, 0x03, 0xF4, 0xBE, 0x03,
+  0xF4, 0xBF, 0x9B, 0xF9, 0xBF, 0xFF, 0xFD, 0xBE, 0xB8, 0xBD, 0xBE, 0x00,
+  0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1B, 0xFF,
+  0x9F, 0xF9, 0xEB, 0xFD, 0x3B, 0xFF, 0x4E, 0xBF, 0xD3, 0x9F, 0xF4, 0xE1,
+  0xFD, 0x38, 0x07, 0x4E, 0x01, 0xD3, 0x80, 0x74, 0xE0, 0x1D, 0x38, 0x07,
+  0x4E, 0x01, 0xD3, 0x80, 0x74, 0xE0, 0x19, 0x28, 0x15, 0x7F, 0x7F, 0x7F,
+  0x04, 0x0A, 0x07, 0xBE, 0x14, 0xBF, 0x09, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x05, 0xF5, 0xBF, 0xE0, 0x1B, 0xE4, 0x7E, 0xBD, 0xF8, 0x2E, 0xF4, 0x2F,
+  0xF8, 0x2E, 0x7E, 0xBD, 0x1B, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x6A, 0xA9,
+  0x60, 0x60, 0x1E, 0x1F, 0x41, 0xF5, 0xF4, 0x1F, 0x1F, 0x0B, 0x8B, 0xCF,
+  0x8B, 0x87, 0x47, 0x81, 0x40, 0x40, 0x6A, 0x00, 0x02, 0x80, 0xFE, 0x00,
+  0x07, 0x80, 0x5E, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x2D, 0x00, 0x1E, 0x00,
+  0x38, 0x00, 0x1E, 0x00, 0xB4, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0xFF, 0xE3,
+  0xC0, 0xF8, 0x55, 0x47, 0x42, 0xF8, 0x00, 0x0F, 0x0A, 0x78, 0x00, 0x2D,
+  0x1D, 0x78, 0x00, 0x78, 0x2F, 0xFF, 0x00, 0xF0, 0x15, 0x79, 0x01, 0x90,
+  0x00, 0x24, 0x04, 0x00, 0x00, 0x40, 0x2F, 0x80, 0x00, 0xF0, 0x0A, 0xE0,
+  0x00, 0xB4, 0x00, 0x78, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x2D, 0x00, 0x07,
+  0x80, 0x1E, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x03, 0xFF, 0x8B, 0x5B, 0xF4,
+  0xAA, 0x93, 0x86, 0x5F, 0x40, 0x02, 0xD0, 0x03, 0xD0, 0x01, 0xE0, 0x02,
+  0xE0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0xB4, 0x02, 0xE0, 0x00, 0x38, 0x01,
+  0xFF, 0xD0, 0x14, 0x00, 0x15, 0x50, 0xBF, 0x80, 0x03, 0xC0, 0x96, 0xE0,
+  0x07, 0x40, 0x02, 0xE0, 0x0F, 0x00, 0x2F, 0x80, 0x2D, 0x00, 0x06, 0xD0,
+  0x78, 0x00, 0x01, 0xF0, 0xB0, 0x00, 0x82, 0xE1, 0xE0, 0x54, 0xFF, 0xD3,
+  0xC1, 0xF8, 0x04, 0x0B, 0x43, 0xB8, 0x00, 0x0E, 0x0A, 0x78, 0x00, 0x2D,
+  0x1D, 0x78, 0x00, 0x78, 0x2F, 0xFF, 0x00, 0xF0, 0x15, 0x79, 0x01, 0x90,
+  0x00, 0x24, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x50,
+  0x03, 0xF4, 0x0B, 0xF0, 0x2F, 0xD0, 0x7F, 0x40, 0xBE, 0x00, 0xBD, 0x01,
+  0xBF, 0x5B, 0x7F, 0xFF, 0x1B, 0xF9, 0x00, 0x64, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0x00, 0x02, 0xF6,
+  0xF4, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0B, 0xE0,
+  0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0x6F, 0x87, 0xF0,
+  0x01, 0xFC, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0xB4,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0x00, 0x02, 0xF6,
+  0xF4, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0B, 0xE0,
+  0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0x6F, 0x87, 0xF0,
+  0x01, 0xFC, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0x1A, 0x40, 0x00, 0x07, 0xAD,
+  0x00, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0x00, 0x02, 0xF6,
+  0xF4, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0B, 0xE0,
+  0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0x6F, 0x87, 0xF0,
+  0x01, 0xFC, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0xB9, 0xA0, 0x00, 0x0D, 0xBD,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0x00, 0x02, 0xF6,
+  0xF4, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0B, 0xE0,
+  0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0x6F, 0x87, 0xF0,
+  0x01, 0xFC, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0xF2, 0xD0, 0x00, 0x0F, 0x2D,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00,
+  0x0F, 0xFE, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x2F, 0x6F, 0x40, 0x03, 0xF1,
+  0xF8, 0x00, 0xBE, 0x0F, 0xD0, 0x0F, 0xD0, 0xBE, 0x01, 0xFF, 0xFF, 0xF0,
+  0x2F, 0xFF, 0xFF, 0x43, 0xF5, 0x56, 0xF8, 0x7F, 0x00, 0x1F, 0xCB, 0xE0,
+  0x00, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0x07, 0x6C, 0x00, 0x00, 0xB1, 0xD0,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01,
+  0xFB, 0xF0, 0x00, 0x2F, 0x6F, 0x40, 0x03, 0xF1, 0xF8, 0x00, 0x7E, 0x0F,
+  0xC0, 0x0B, 0xD0, 0xBD, 0x01, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x43,
+  0xF5, 0x56, 0xF8, 0x7F, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0xFD, 0x00, 0x2F,
+  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xBE, 0x7F, 0xAA, 0x90,
+  0x0F, 0xC7, 0xF0, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0x3F, 0x47, 0xFF,
+  0xFD, 0x07, 0xF0, 0x7F, 0xFF, 0xD0, 0xBE, 0x5B, 0xFA, 0xA8, 0x0F, 0xFF,
+  0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x7F, 0xAA, 0x97,
+  0xE0, 0x07, 0xFF, 0xFF, 0xBD, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xBF, 0xA0,
+  0x2F, 0xFF, 0xE3, 0xFE, 0x5B, 0x9F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4,
+  0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
+  0x13, 0xFE, 0x5B, 0x82, 0xFF, 0xFE, 0x01, 0xBF, 0xA0, 0x00, 0x1C, 0x00,
+  0x00, 0x34, 0x00, 0x16, 0xD0, 0x00, 0x7E, 0x00, 0x06, 0x40, 0x00, 0x2D,
+  0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x7F,
+  0xAA, 0x97, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7,
+  0xFA, 0xA8, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xAA, 0x97, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xE0, 0x00, 0x19, 0x00, 0x07, 0x80, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x7F, 0xAA, 0x97, 0xF0, 0x00, 0x7F,
+  0x00, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFA, 0xA8, 0x7F, 0x00, 0x07,
+  0xF0, 0x00, 0x7F, 0xAA, 0x97, 0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x01, 0xA4,
+  0x00, 0x7A, 0xD0, 0x05, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE7, 0xFF,
+  0xFE, 0x7F, 0xAA, 0x97, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xFD, 0x7F,
+  0xFF, 0xD7, 0xFA, 0xA8, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xAA, 0x97,
+  0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x0B, 0x5E, 0x00, 0xB5, 0xE0, 0x00, 0x00,
+  0x07, 0xFF, 0xFE, 0x7F, 0xFF, 0xE7, 0xFA, 0xA9, 0x7F, 0x00, 0x07, 0xF0,
+  0x00, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xAA, 0x87, 0xF0, 0x00, 0x7F,
+  0x00, 0x07, 0xFA, 0xA9, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x64, 0x0B, 0x40,
+  0x50, 0x00, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F,
+  0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC0, 0x06, 0x47, 0x81, 0x40, 0x00,
+  0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F,
+  0xC7, 0xF1, 0xFC, 0x7F, 0x00, 0x0A, 0x43, 0x9E, 0x50, 0x60, 0x00, 0x1F,
+  0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F,
+  0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0x78, 0xF7, 0x8F, 0x00, 0x01,
+  0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1,
+  0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xFF, 0xA4, 0x01, 0xFF,
+  0xFF, 0xE0, 0x1F, 0xEA, 0xFF, 0x81, 0xFC, 0x02, 0xFD, 0x1F, 0xC0, 0x0F,
+  0xEB, 0xFF, 0xC0, 0xBE, 0xBF, 0xFC, 0x0B, 0xF5, 0xFD, 0x40, 0xBE, 0x1F,
+  0xC0, 0x0F, 0xE1, 0xFC, 0x02, 0xFD, 0x1F, 0xEA, 0xFF, 0x81, 0xFF, 0xFF,
+  0xE0, 0x1F, 0xFF, 0xA4, 0x00, 0x01, 0xF5, 0xC0, 0x03, 0x9F, 0x80, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0x7F, 0xC0, 0x3F, 0x7F,
+  0xE0, 0x3F, 0x7F, 0xF0, 0x3F, 0x7F, 0xF8, 0x3F, 0x7E, 0x7D, 0x3F, 0x7E,
+  0x3E, 0x3F, 0x7E, 0x1F, 0x7F, 0x7E, 0x0F, 0xBF, 0x7E, 0x07, 0xFF, 0x7E,
+  0x03, 0xFF, 0x7E, 0x01, 0xFF, 0x7E, 0x00, 0xBF, 0x01, 0xF4, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90,
+  0x07, 0xFF, 0xFF, 0x03, 0xFE, 0x6F, 0xF2, 0xFD, 0x01, 0xFE, 0xFE, 0x00,
+  0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFE,
+  0x00, 0x2F, 0xEF, 0xD0, 0x1F, 0xE3, 0xFE, 0x6F, 0xF0, 0x7F, 0xFF, 0xF0,
+  0x01, 0xBF, 0x90, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF, 0x03,
+  0xFE, 0x6F, 0xF2, 0xFD, 0x01, 0xFE, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x07,
+  0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xEF, 0xD0,
+  0x1F, 0xE3, 0xFE, 0x6F, 0xF0, 0x7F, 0xFF, 0xF0, 0x01, 0xBF, 0x90, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x14, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF, 0x03, 0xFE, 0x6F, 0xF2, 0xFD,
+  0x01, 0xFE, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF,
+  0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xEF, 0xD0, 0x1F, 0xE3, 0xFE, 0x6F,
+  0xF0, 0x7F, 0xFF, 0xF0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0xB8, 0xD0, 0x00,
+  0x76, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90,
+  0x07, 0xFF, 0xFF, 0x03, 0xFE, 0x6F, 0xF2, 0xFD, 0x01, 0xFE, 0xFE, 0x00,
+  0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFE,
+  0x00, 0x2F, 0xEF, 0xD0, 0x1F, 0xE3, 0xFE, 0x6F, 0xF0, 0x7F, 0xFF, 0xF0,
+  0x01, 0xBF, 0x90, 0x00, 0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF, 0x03,
+  0xFE, 0x6F, 0xF2, 0xFD, 0x01, 0xFE, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x07,
+  0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xEF, 0xD0,
+  0x1F, 0xE3, 0xFE, 0x6F, 0xF0, 0x7F, 0xFF, 0xF0, 0x01, 0xBF, 0x90, 0x00,
+  0x20, 0x00, 0x52, 0xF0, 0x07, 0xD3, 0xF0, 0x7E, 0x03, 0xF7, 0xE0, 0x03,
+  0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xE3, 0xE0, 0x7E, 0x03,
+  0xE1, 0xE0, 0x03, 0xD1, 0x00, 0x01, 0x00, 0x00, 0x6F, 0xE4, 0x74, 0x1F,
+  0xFF, 0xFF, 0x80, 0xFF, 0x9B, 0xFC, 0x0B, 0xF4, 0x0B, 0xF4, 0x3F, 0x80,
+  0x7F, 0xE0, 0xFD, 0x07, 0x5F, 0xC3, 0xF4, 0xB4, 0x7F, 0x0F, 0xDB, 0x41,
+  0xFC, 0x3F, 0xF4, 0x0B, 0xF0, 0xBF, 0x40, 0x7F, 0x80, 0xFF, 0x9B, 0xFC,
+  0x0B, 0xFF, 0xFF, 0xC0, 0x74, 0x6F, 0xE4, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x3F,
+  0x40, 0xFD, 0x2F, 0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0x90, 0x00,
+  0x0F, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x3F, 0x40, 0xFD, 0x2F, 0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x02,
+  0xFF, 0x90, 0x00, 0xBE, 0x00, 0x01, 0xE7, 0x80, 0x01, 0x41, 0x80, 0x00,
+  0x00, 0x00, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x3F, 0x40, 0xFD, 0x2F, 0xEB, 0xFC, 0x1F,
+  0xFF, 0xF4, 0x02, 0xFF, 0x90, 0x02, 0xD3, 0xC0, 0x02, 0xD3, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
+  0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x3F, 0x40, 0xFD, 0x2F,
+  0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x06, 0x40, 0x00,
+  0x07, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F,
+  0x9F, 0xD0, 0x2F, 0xC2, 0xFC, 0x1F, 0xD0, 0x3F, 0x8F, 0xE0, 0x07, 0xFB,
+  0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xFD, 0x7F, 0x5B, 0xF9, 0xFC, 0x07, 0xF7, 0xF0, 0x1F, 0xDF,
+  0xC0, 0x7F, 0x7F, 0x5B, 0xF9, 0xFF, 0xFF, 0xD7, 0xFF, 0xF8, 0x1F, 0xC0,
+  0x00, 0x7F, 0x00, 0x00, 0x0A, 0xFE, 0x00, 0xBF, 0xFF, 0x07, 0xF4, 0xBD,
+  0x1F, 0x81, 0xF8, 0xBE, 0x2F, 0x92, 0xF9, 0xF4, 0x0B, 0xE7, 0xD0, 0x2F,
+  0x9F, 0xE0, 0xBE, 0x2F, 0xF6, 0xF8, 0x1F, 0xEB, 0xE0, 0x1F, 0xEF, 0x94,
+  0xBE, 0xBE, 0x7F, 0xF6, 0xF9, 0xFE, 0x40, 0x02, 0x40, 0x00, 0x0B, 0x80,
+  0x00, 0x07, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x01,
+  0xFF, 0xFE, 0x05, 0x41, 0xFD, 0x06, 0xBF, 0xF4, 0xBF, 0xFF, 0xE3, 0xF4,
+  0x2F, 0x9F, 0xC0, 0xBE, 0x3F, 0x4B, 0xF8, 0xBF, 0xFB, 0xE0, 0xBE, 0x6F,
+  0x80, 0x00, 0x01, 0x90, 0x00, 0x2E, 0x00, 0x01, 0xD0, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xF9, 0x01, 0xFF, 0xFE, 0x05, 0x41, 0xFD, 0x06,
+  0xBF, 0xF4, 0xBF, 0xFF, 0xE3, 0xF4, 0x2F, 0x9F, 0xC0, 0xBE, 0x3F, 0x4B,
+  0xF8, 0xBF, 0xFB, 0xE0, 0xBE, 0x6F, 0x80, 0x00, 0x28, 0x00, 0x02, 0xF8,
+  0x00, 0x2D, 0x78, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x01,
+  0xFF, 0xFE, 0x05, 0x41, 0xFD, 0x06, 0xBF, 0xF4, 0xBF, 0xFF, 0xE3, 0xF4,
+  0x2F, 0x9F, 0xC0, 0xBE, 0x3F, 0x4B, 0xF8, 0xBF, 0xFB, 0xE0, 0xBE, 0x6F,
+  0x80, 0x01, 0xE5, 0xC0, 0x0E, 0xBE, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x1B, 0xFE, 0x40, 0x7F, 0xFF, 0x81, 0x50, 0x7F, 0x41, 0xAF, 0xFD, 0x2F,
+  0xFF, 0xF8, 0xFD, 0x0B, 0xE7, 0xF0, 0x2F, 0x8F, 0xD2, 0xFE, 0x2F, 0xFE,
+  0xF8, 0x2F, 0x9B, 0xE0, 0x02, 0xD7, 0x80, 0x0B, 0x5E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x7F, 0xFF, 0x81, 0x50, 0x7F, 0x41,
+  0xAF, 0xFD, 0x2F, 0xFF, 0xF8, 0xFD, 0x0B, 0xE7, 0xF0, 0x2F, 0x8F, 0xD2,
+  0xFE, 0x2F, 0xFE, 0xF8, 0x2F, 0x9B, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0x5D,
+  0x00, 0x1C, 0x34, 0x00, 0x75, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01,
+  0xBF, 0xE4, 0x07, 0xFF, 0xF8, 0x15, 0x07, 0xF4, 0x1A, 0xFF, 0xD2, 0xFF,
+  0xFF, 0x8F, 0xD0, 0xBE, 0x7F, 0x02, 0xF8, 0xFD, 0x2F, 0xE2, 0xFF, 0xEF,
+  0x82, 0xF9, 0xBE, 0x1B, 0xFE, 0x4B, 0xF9, 0x01, 0xFF, 0xFF, 0xFF, 0xF4,
+  0x15, 0x07, 0xFD, 0x1F, 0xC0, 0x6B, 0xFF, 0x80, 0xBD, 0x2F, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xF4, 0x2F, 0xFF, 0xFE, 0x7F, 0x02, 0xF8, 0x00, 0x03, 0xF4,
+  0xBF, 0xD0, 0x5D, 0x2F, 0xFF, 0x7F, 0xFF, 0xD0, 0xBF, 0x81, 0xBF, 0xE4,
+  0x01, 0xBF, 0x80, 0xBF, 0xFD, 0x2F, 0xD5, 0x93, 0xF4, 0x00, 0x7F, 0x00,
+  0x07, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x59, 0x0F, 0xFF, 0xD0, 0x1B,
+  0xF8, 0x00, 0x0D, 0x00, 0x00, 0xA0, 0x00, 0x5E, 0x00, 0x0F, 0xD0, 0x01,
+  0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xF9, 0x00, 0xFF, 0xFE, 0x0B, 0xE4, 0xBE, 0x3F, 0x00, 0xFD,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x2F, 0x90, 0x68, 0x3F,
+  0xFF, 0xE0, 0x1B, 0xF9, 0x00, 0x00, 0x01, 0x90, 0x00, 0x1E, 0x00, 0x01,
+  0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0xFF, 0xFE,
+  0x0B, 0xE4, 0xBE, 0x3F, 0x00, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF,
+  0xC0, 0x00, 0x2F, 0x90, 0x68, 0x3F, 0xFF, 0xE0, 0x1B, 0xF9, 0x00, 0x00,
+  0x19, 0x00, 0x02, 0xFC, 0x00, 0x1E, 0x38, 0x00, 0x50, 0x20, 0x00, 0x00,
+  0x00, 0x06, 0xF9, 0x00, 0xFF, 0xFE, 0x0B, 0xE4, 0xBE, 0x3F, 0x00, 0xFD,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x2F, 0x90, 0x68, 0x3F,
+  0xFF, 0xE0, 0x1B, 0xF9, 0x00, 0x01, 0xE3, 0xC0, 0x07, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82, 0xF9, 0x2F,
+  0x8F, 0xC0, 0x3F, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3, 0xF0, 0x00, 0x0B,
+  0xE4, 0x1A, 0x0F, 0xFF, 0xF8, 0x06, 0xFE, 0x40, 0x60, 0x1E, 0x02, 0xD0,
+  0x2D, 0x00, 0x0B, 0xE2, 0xF8, 0xBE, 0x2F, 0x8B, 0xE2, 0xF8, 0xBE, 0x2F,
+  0x8B, 0xE2, 0xF8, 0x01, 0x90, 0x7C, 0x0F, 0x02, 0xD0, 0x00, 0x0B, 0xE0,
+  0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0,
+  0xBE, 0x00, 0x0A, 0x02, 0xF8, 0x7A, 0xDE, 0x0B, 0x00, 0x02, 0xF8, 0x2F,
+  0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F,
+  0x80, 0xB5, 0xEB, 0x5E, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x2F, 0x82,
+  0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x02, 0xF4,
+  0x64, 0x00, 0xFF, 0xE0, 0x06, 0xFF, 0x00, 0x0E, 0x5F, 0x80, 0x00, 0x1B,
+  0xE0, 0x07, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x3F, 0x81, 0xFD, 0x7F, 0x00,
+  0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40, 0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x02, 0xBF, 0x80, 0x02, 0xE3, 0x40, 0x1D, 0xFC, 0x00, 0x10, 0x40,
+  0x00, 0x00, 0x00, 0xBE, 0x6F, 0x82, 0xFF, 0xFF, 0x8B, 0xF9, 0xBF, 0x2F,
+  0xC0, 0xFC, 0xBE, 0x03, 0xF6, 0xF8, 0x0F, 0xDB, 0xE0, 0x3F, 0x6F, 0x80,
+  0xFD, 0xBE, 0x03, 0xF6, 0xF8, 0x0F, 0xD0, 0x01, 0x80, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
+  0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0xD6, 0xF8, 0x3F, 0x40, 0xFC, 0x7F, 0x00,
+  0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40, 0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x02, 0xBF, 0x80, 0x00, 0x01, 0x90, 0x00, 0x07, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0F, 0xFF,
+  0xF0, 0x2F, 0xD6, 0xF8, 0x3F, 0x40, 0xFC, 0x7F, 0x00, 0xFD, 0x7F, 0x00,
+  0xFD, 0x3F, 0x40, 0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xBF,
+  0x80, 0x00, 0x18, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xD7, 0x80, 0x01, 0x41,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0xD6,
+  0xF8, 0x3F, 0x40, 0xFC, 0x7F, 0x00, 0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40,
+  0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xBF, 0x80, 0x01, 0xE5,
+  0xC0, 0x03, 0xAF, 0x80, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
+  0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0xD6, 0xF8, 0x3F, 0x40, 0xFC, 0x7F, 0x00,
+  0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40, 0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x02, 0xBF, 0x80, 0x02, 0xD7, 0x80, 0x02, 0xD7, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0xD6,
+  0xF8, 0x3F, 0x40, 0xFC, 0x7F, 0x00, 0xFD, 0x7F, 0x00, 0xFD, 0x3F, 0x40,
+  0xFC, 0x2F, 0xD6, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xBF, 0x80, 0x00, 0xA4,
+  0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xF8, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x00, 0x04, 0x02, 0xBE, 0x6C, 0x0F, 0xFF, 0xF4, 0x2F,
+  0xD7, 0xF8, 0x3F, 0x47, 0xFC, 0x7F, 0x1D, 0xFD, 0x7F, 0x74, 0xFD, 0x3F,
+  0xD0, 0xFC, 0x2F, 0xD6, 0xF8, 0x1F, 0xFF, 0xF0, 0x39, 0xBF, 0x80, 0x10,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x40,
+  0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03,
+  0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xE0, 0x7F, 0x7F, 0x5F, 0xF3, 0xFF,
+  0xBF, 0x1B, 0xE3, 0xF0, 0x00, 0x06, 0x40, 0x01, 0xF0, 0x00, 0x3C, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F,
+  0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xE0, 0x7F, 0x7F, 0x5F,
+  0xF3, 0xFF, 0xBF, 0x1B, 0xE3, 0xF0, 0x00, 0x64, 0x00, 0x2F, 0xC0, 0x07,
+  0x4E, 0x00, 0x50, 0x20, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xBD, 0x03, 0xFB,
+  0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xE0, 0x7F,
+  0x7F, 0x5F, 0xF3, 0xFF, 0xBF, 0x1B, 0xE3, 0xF0, 0x07, 0x8F, 0x00, 0x78,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD,
+  0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBE, 0x07, 0xF7,
+  0xF5, 0xFF, 0x3F, 0xFB, 0xF1, 0xBE, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0x78,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xFD, 0xFC, 0x07, 0xE2,
+  0xF4, 0x2F, 0x47, 0xE0, 0xFC, 0x0F, 0xC7, 0xE0, 0x2F, 0x6F, 0x00, 0x3E,
+  0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xD0,
+  0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBE, 0x00, 0x02,
+  0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x6F, 0x82, 0xFB,
+  0xFF, 0x8B, 0xF9, 0xBF, 0x6F, 0xC0, 0xBE, 0xBE, 0x01, 0xFA, 0xF8, 0x07,
+  0xEB, 0xF0, 0x2F, 0xAF, 0xE6, 0xFD, 0xBE, 0xFF, 0xE2, 0xF9, 0xBE, 0x0B,
+  0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03,
+  0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
+  0xFD, 0xFC, 0x07, 0xE2, 0xF4, 0x2F, 0x47, 0xE0, 0xFC, 0x0F, 0xC7, 0xE0,
+  0x2F, 0x6F, 0x00, 0x3E, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x00, 0x03,
+  0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x40,
+  0x00 };
+
+const GFXglyph DejaVuSans_Bold9pt8bAa2Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   4,  13,   8,    2,  -13 },   // 0x21 '!'
+  {    13,   7,   5,   9,    1,  -13 },   // 0x22 '"'
+  {    22,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {    65,  10,  16,  12,    1,  -14 },   // 0x24 '$'
+  {   105,  17,  13,  18,    0,  -13 },   // 0x25 '%'
+  {   161,  14,  13,  15,    1,  -13 },   // 0x26 '&'
+  {   207,   3,   5,   5,    1,  -13 },   // 0x27 '''
+  {   211,   6,  16,   8,    1,  -14 },   // 0x28 '('
+  {   235,   6,  16,   8,    1,  -14 },   // 0x29 ')'
+  {   259,   9,   9,   9,    0,  -13 },   // 0x2A '*'
+  {   280,  11,  12,  15,    2,  -12 },   // 0x2B '+'
+  {   313,   4,   6,   7,    1,   -3 },   // 0x2C ','
+  {   319,   6,   3,   7,    1,   -7 },   // 0x2D '-'
+  {   324,   4,   4,   7,    1,   -4 },   // 0x2E '.'
+  {   328,   7,  15,   6,    0,  -13 },   // 0x2F '/'
+  {   355,  11,  13,  12,    1,  -13 },   // 0x30 '0'
+  {   391,   9,  13,  12,    2,  -13 },   // 0x31 '1'
+  {   421,  10,  13,  12,    1,  -13 },   // 0x32 '2'
+  {   454,  10,  13,  12,    1,  -13 },   // 0x33 '3'
+  {   487,  12,  13,  12,    0,  -13 },   // 0x34 '4'
+  {   526,  10,  13,  12,    1,  -13 },   // 0x35 '5'
+  {   559,  11,  13,  12,    1,  -13 },   // 0x36 '6'
+  {   595,  10,  13,  12,    1,  -13 },   // 0x37 '7'
+  {   628,  10,  13,  12,    1,  -13 },   // 0x38 '8'
+  {   661,  10,  13,  12,    1,  -13 },   // 0x39 '9'
+  {   694,   3,  10,   7,    2,  -10 },   // 0x3A ':'
+  {   702,   4,  12,   7,    1,  -10 },   // 0x3B ';'
+  {   714,  11,  11,  15,    2,  -11 },   // 0x3C '<'
+  {   745,  11,   6,  15,    2,   -9 },   // 0x3D '='
+  {   762,  11,  11,  15,    2,  -11 },   // 0x3E '>'
+  {   793,   8,  13,  10,    1,  -13 },   // 0x3F '?'
+  {   819,  16,  16,  18,    1,  -13 },   // 0x40 '@'
+  {   883,  14,  13,  14,    0,  -13 },   // 0x41 'A'
+  {   929,  11,  13,  13,    1,  -13 },   // 0x42 'B'
+  {   965,  11,  13,  13,    1,  -13 },   // 0x43 'C'
+  {  1001,  13,  13,  15,    1,  -13 },   // 0x44 'D'
+  {  1044,  10,  13,  12,    1,  -13 },   // 0x45 'E'
+  {  1077,  10,  13,  12,    1,  -13 },   // 0x46 'F'
+  {  1110,  13,  13,  14,    1,  -13 },   // 0x47 'G'
+  {  1153,  12,  13,  15,    1,  -13 },   // 0x48 'H'
+  {  1192,   4,  13,   7,    1,  -13 },   // 0x49 'I'
+  {  1205,   6,  17,   7,   -1,  -13 },   // 0x4A 'J'
+  {  1231,  13,  13,  14,    1,  -13 },   // 0x4B 'K'
+  {  1274,  10,  13,  11,    1,  -13 },   // 0x4C 'L'
+  {  1307,  15,  13,  18,    1,  -13 },   // 0x4D 'M'
+  {  1356,  12,  13,  15,    1,  -13 },   // 0x4E 'N'
+  {  1395,  13,  13,  15,    1,  -13 },   // 0x4F 'O'
+  {  1438,  11,  13,  13,    1,  -13 },   // 0x50 'P'
+  {  1474,  13,  16,  15,    1,  -13 },   // 0x51 'Q'
+  {  1526,  12,  13,  14,    1,  -13 },   // 0x52 'R'
+  {  1565,  11,  13,  13,    1,  -13 },   // 0x53 'S'
+  {  1601,  12,  13,  12,    0,  -13 },   // 0x54 'T'
+  {  1640,  12,  13,  14,    1,  -13 },   // 0x55 'U'
+  {  1679,  14,  13,  14,    0,  -13 },   // 0x56 'V'
+  {  1725,  19,  13,  19,    0,  -13 },   // 0x57 'W'
+  {  1787,  13,  13,  14,    0,  -13 },   // 0x58 'X'
+  {  1830,  13,  13,  13,    0,  -13 },   // 0x59 'Y'
+  {  1873,  12,  13,  13,    0,  -13 },   // 0x5A 'Z'
+  {  1912,   6,  16,   8,    1,  -14 },   // 0x5B '['
+  {  1936,   7,  15,   6,    0,  -13 },   // 0x5C '\'
+  {  1963,   6,  16,   8,    1,  -14 },   // 0x5D ']'
+  {  1987,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  2001,   9,   2,   9,    0,    2 },   // 0x5F '_'
+  {  2006,   5,   4,   9,    1,  -15 },   // 0x60 '`'
+  {  2011,  11,  10,  12,    0,  -10 },   // 0x61 'a'
+  {  2039,  11,  14,  13,    1,  -14 },   // 0x62 'b'
+  {  2078,  10,  10,  10,    0,  -10 },   // 0x63 'c'
+  {  2103,  11,  14,  13,    0,  -14 },   // 0x64 'd'
+  {  2142,  11,  10,  12,    0,  -10 },   // 0x65 'e'
+  {  2170,   8,  14,   8,    0,  -14 },   // 0x66 'f'
+  {  2198,  11,  14,  13,    0,  -10 },   // 0x67 'g'
+  {  2237,  11,  14,  13,    1,  -14 },   // 0x68 'h'
+  {  2276,   4,  14,   6,    1,  -14 },   // 0x69 'i'
+  {  2290,   6,  18,   6,   -1,  -14 },   // 0x6A 'j'
+  {  2317,  11,  14,  12,    1,  -14 },   // 0x6B 'k'
+  {  2356,   4,  14,   6,    1,  -14 },   // 0x6C 'l'
+  {  2370,  16,  10,  18,    1,  -10 },   // 0x6D 'm'
+  {  2410,  11,  10,  13,    1,  -10 },   // 0x6E 'n'
+  {  2438,  12,  10,  12,    0,  -10 },   // 0x6F 'o'
+  {  2468,  11,  14,  13,    1,  -10 },   // 0x70 'p'
+  {  2507,  11,  14,  13,    0,  -10 },   // 0x71 'q'
+  {  2546,   8,  10,   9,    1,  -10 },   // 0x72 'r'
+  {  2566,   9,  10,  10,    1,  -10 },   // 0x73 's'
+  {  2589,   8,  13,   8,    0,  -13 },   // 0x74 't'
+  {  2615,  10,  10,  13,    1,  -10 },   // 0x75 'u'
+  {  2640,  11,  10,  11,    0,  -10 },   // 0x76 'v'
+  {  2668,  16,  10,  16,    0,  -10 },   // 0x77 'w'
+  {  2708,  11,  10,  11,    0,  -10 },   // 0x78 'x'
+  {  2736,  11,  14,  11,    0,  -10 },   // 0x79 'y'
+  {  2775,  10,  10,  10,    0,  -10 },   // 0x7A 'z'
+  {  2800,   9,  16,  13,    2,  -14 },   // 0x7B '{'
+  {  2836,   3,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  2850,   9,  16,  13,    2,  -14 },   // 0x7D '}'
+  {  2886,  11,   3,  15,    2,   -7 },   // 0x7E '~'
+  {  2895,   9,  16,  11,    1,  -13 },   // 0x7F
+  {  2931,   9,  16,  11,    1,  -13 },   // 0x80
+  {  2967,   9,  16,  11,    1,  -13 },   // 0x81
+  {  3003,   9,  16,  11,    1,  -13 },   // 0x82
+  {  3039,   9,  16,  11,    1,  -13 },   // 0x83
+  {  3075,   9,  16,  11,    1,  -13 },   // 0x84
+  {  3111,   9,  16,  11,    1,  -13 },   // 0x85
+  {  3147,   9,  16,  11,    1,  -13 },   // 0x86
+  {  3183,   9,  16,  11,    1,  -13 },   // 0x87
+  {  3219,   9,  16,  11,    1,  -13 },   // 0x88
+  {  3255,   9,  16,  11,    1,  -13 },   // 0x89
+  {  3291,   9,  16,  11,    1,  -13 },   // 0x8A
+  {  3327,   9,  16,  11,    1,  -13 },   // 0x8B
+  {  3363,   9,  16,  11,    1,  -13 },   // 0x8C
+  {  3399,   9,  16,  11,    1,  -13 },   // 0x8D
+  {  3435,   9,  16,  11,    1,  -13 },   // 0x8E
+  {  3471,   9,  16,  11,    1,  -13 },   // 0x8F
+  {  3507,   9,  16,  11,    1,  -13 },   // 0x90
+  {  3543,   9,  16,  11,    1,  -13 },   // 0x91
+  {  3579,   9,  16,  11,    1,  -13 },   // 0x92
+  {  3615,   9,  16,  11,    1,  -13 },   // 0x93
+  {  3651,   9,  16,  11,    1,  -13 },   // 0x94
+  {  3687,   9,  16,  11,    1,  -13 },   // 0x95
+  {  3723,   9,  16,  11,    1,  -13 },   // 0x96
+  {  3759,   9,  16,  11,    1,  -13 },   // 0x97
+  {  3795,   9,  16,  11,    1,  -13 },   // 0x98
+  {  3831,   9,  16,  11,    1,  -13 },   // 0x99
+  {  3867,   9,  16,  11,    1,  -13 },   // 0x9A
+  {  3903,   9,  16,  11,    1,  -13 },   // 0x9B
+  {  3939,   9,  16,  11,    1,  -13 },   // 0x9C
+  {  3975,   9,  16,  11,    1,  -13 },   // 0x9D
+  {  4011,   9,  16,  11,    1,  -13 },   // 0x9E
+  {  4047,   9,  16,  11,    1,  -13 },   // 0x9F
+  {  4083,   0,   0,   6,    0,    1 },   // 0xA0
+  {  4083,   4,  13,   8,    2,  -10 },   // 0xA1
+  {  4096,   9,  16,  12,    1,  -13 },   // 0xA2
+  {  4132,  10,  13,  12,    1,  -13 },   // 0xA3
+  {  4165,  10,  10,  11,    1,  -11 },   // 0xA4
+  {  4190,  12,  13,  12,    0,  -13 },   // 0xA5
+  {  4229,   3,  16,   6,    2,  -13 },   // 0xA6
+  {  4241,   9,  15,   9,    0,  -13 },   // 0xA7
+  {  4275,   6,   2,   9,    1,  -14 },   // 0xA8
+  {  4278,  13,  14,  18,    2,  -13 },   // 0xA9
+  {  4324,   8,  10,  10,    1,  -13 },   // 0xAA
+  {  4344,   9,   8,  11,    1,   -9 },   // 0xAB
+  {  4362,  11,   6,  15,    2,   -8 },   // 0xAC
+  {  4379,   6,   3,   7,    1,   -7 },   // 0xAD
+  {  4384,  13,  14,  18,    2,  -13 },   // 0xAE
+  {  4430,   6,   2,   9,    1,  -14 },   // 0xAF
+  {  4433,   7,   6,   9,    1,  -13 },   // 0xB0
+  {  4444,  11,  12,  15,    2,  -12 },   // 0xB1
+  {  4477,   6,   7,   8,    1,  -13 },   // 0xB2
+  {  4488,   6,   7,   8,    1,  -13 },   // 0xB3
+  {  4499,   5,   4,   9,    3,  -15 },   // 0xB4
+  {  4504,  12,  14,  13,    1,  -10 },   // 0xB5
+  {  4546,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  4580,   4,   4,   7,    1,   -9 },   // 0xB7
+  {  4584,   4,   5,   9,    2,   -1 },   // 0xB8
+  {  4589,   6,   7,   8,    1,  -13 },   // 0xB9
+  {  4600,   8,  10,  10,    1,  -13 },   // 0xBA
+  {  4620,   9,   8,  11,    1,   -9 },   // 0xBB
+  {  4638,  16,  14,  18,    1,  -14 },   // 0xBC
+  {  4694,  17,  15,  18,    1,  -14 },   // 0xBD
+  {  4758,  16,  14,  18,    1,  -14 },   // 0xBE
+  {  4814,   8,  14,  10,    1,  -10 },   // 0xBF
+  {  4842,  14,  17,  14,    0,  -17 },   // 0xC0
+  {  4902,  14,  17,  14,    0,  -17 },   // 0xC1
+  {  4962,  14,  17,  14,    0,  -17 },   // 0xC2
+  {  5022,  14,  17,  14,    0,  -17 },   // 0xC3
+  {  5082,  14,  16,  14,    0,  -16 },   // 0xC4
+  {  5138,  14,  16,  14,    0,  -16 },   // 0xC5
+  {  5194,  18,  13,  19,    0,  -13 },   // 0xC6
+  {  5253,  11,  17,  13,    1,  -13 },   // 0xC7
+  {  5300,  10,  17,  12,    1,  -17 },   // 0xC8
+  {  5343,  10,  17,  12,    1,  -17 },   // 0xC9
+  {  5386,  10,  17,  12,    1,  -17 },   // 0xCA
+  {  5429,  10,  16,  12,    1,  -16 },   // 0xCB
+  {  5469,   5,  17,   7,    0,  -17 },   // 0xCC
+  {  5491,   5,  17,   7,    1,  -17 },   // 0xCD
+  {  5513,   6,  17,   7,    0,  -17 },   // 0xCE
+  {  5539,   6,  16,   7,    0,  -16 },   // 0xCF
+  {  5563,  14,  13,  15,    0,  -13 },   // 0xD0
+  {  5609,  12,  17,  15,    1,  -17 },   // 0xD1
+  {  5660,  13,  17,  15,    1,  -17 },   // 0xD2
+  {  5716,  13,  17,  15,    1,  -17 },   // 0xD3
+  {  5772,  13,  17,  15,    1,  -17 },   // 0xD4
+  {  5828,  13,  17,  15,    1,  -17 },   // 0xD5
+  {  5884,  13,  17,  15,    1,  -17 },   // 0xD6
+  {  5940,  11,  11,  15,    2,  -11 },   // 0xD7
+  {  5971,  15,  13,  15,    0,  -13 },   // 0xD8
+  {  6020,  12,  17,  14,    1,  -17 },   // 0xD9
+  {  6071,  12,  17,  14,    1,  -17 },   // 0xDA
+  {  6122,  12,  17,  14,    1,  -17 },   // 0xDB
+  {  6173,  12,  17,  14,    1,  -17 },   // 0xDC
+  {  6224,  13,  17,  13,    0,  -17 },   // 0xDD
+  {  6280,  11,  13,  13,    1,  -13 },   // 0xDE
+  {  6316,  11,  14,  13,    1,  -14 },   // 0xDF
+  {  6355,  11,  15,  12,    0,  -15 },   // 0xE0
+  {  6397,  11,  15,  12,    0,  -15 },   // 0xE1
+  {  6439,  11,  15,  12,    0,  -15 },   // 0xE2
+  {  6481,  11,  14,  12,    0,  -14 },   // 0xE3
+  {  6520,  11,  14,  12,    0,  -14 },   // 0xE4
+  {  6559,  11,  16,  12,    0,  -16 },   // 0xE5
+  {  6603,  18,  10,  18,    0,  -10 },   // 0xE6
+  {  6648,  10,  14,  10,    0,  -10 },   // 0xE7
+  {  6683,  11,  15,  12,    0,  -15 },   // 0xE8
+  {  6725,  11,  15,  12,    0,  -15 },   // 0xE9
+  {  6767,  11,  15,  12,    0,  -15 },   // 0xEA
+  {  6809,  11,  14,  12,    0,  -14 },   // 0xEB
+  {  6848,   5,  15,   6,    0,  -15 },   // 0xEC
+  {  6867,   6,  15,   6,    1,  -15 },   // 0xED
+  {  6890,   6,  15,   6,    0,  -15 },   // 0xEE
+  {  6913,   6,  14,   6,    0,  -14 },   // 0xEF
+  {  6934,  12,  14,  12,    0,  -14 },   // 0xF0
+  {  6976,  11,  14,  13,    1,  -14 },   // 0xF1
+  {  7015,  12,  15,  12,    0,  -15 },   // 0xF2
+  {  7060,  12,  15,  12,    0,  -15 },   // 0xF3
+  {  7105,  12,  15,  12,    0,  -15 },   // 0xF4
+  {  7150,  12,  14,  12,    0,  -14 },   // 0xF5
+  {  7192,  12,  14,  12,    0,  -14 },   // 0xF6
+  {  7234,  11,  10,  15,    2,  -11 },   // 0xF7
+  {  7262,  12,  12,  12,    0,  -11 },   // 0xF8
+  {  7298,  10,  15,  13,    1,  -15 },   // 0xF9
+  {  7336,  10,  15,  13,    1,  -15 },   // 0xFA
+  {  7374,  10,  15,  13,    1,  -15 },   // 0xFB
+  {  7412,  10,  14,  13,    1,  -14 },   // 0xFC
+  {  7447,  11,  18,  11,    0,  -14 },   // 0xFD
+  {  7497,  11,  18,  13,    1,  -14 },   // 0xFE
+  {  7547,  11,  18,  11,    0,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans_Bold9pt8bAa2 = {
+  DejaVuSans_Bold9pt8bAa2Bitmaps, DejaVuSans_Bold9pt8bAa2Glyphs, 0x20, 0xFF, 21, 2 };
+
+// Approx. 9173 bytes
+#endif // DEJAVUSANS_BOLD9PT8BAA2_H
@@ -0,0 +1,1583 @@
+#ifndef DEJAVUSANS_BOLD9PT8BAA4_H
+#define DEJAVUSANS_BOLD9PT8BAA4_H
+// Police anti-aliasée 4 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans_Bold9pt8bAa4Bitmaps[] PROGMEM = {
+  0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x7F, 0xF8,
+  0x5F, 0xF6, 0x3F, 0xF4, 0x1A, 0xA2, 0x12, 0x21, 0x8F, 0xF8, 0x8F, 0xF8,
+  0x8F, 0xF8, 0x5F, 0xB0, 0x8F, 0x85, 0xFB, 0x08, 0xF8, 0x5F, 0xB0, 0x8F,
+  0x85, 0xFB, 0x08, 0xF8, 0x4D, 0x90, 0x7D, 0x60, 0x00, 0x00, 0x3F, 0xB0,
+  0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF6, 0x05, 0xF9, 0x00, 0x00, 0x00, 0xCF,
+  0x20, 0x9F, 0x50, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x0A, 0xDE,
+  0xFE, 0xDD, 0xFE, 0xDD, 0x70, 0x00, 0x8F, 0x60, 0x5F, 0x90, 0x00, 0x00,
+  0x0A, 0xF3, 0x08, 0xF6, 0x00, 0x00, 0x00, 0xDF, 0x10, 0xBF, 0x40, 0x00,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x0A, 0xDE, 0xFE, 0xDE, 0xFE, 0xDD,
+  0x80, 0x00, 0x9F, 0x50, 0x6F, 0x80, 0x00, 0x00, 0x0D, 0xF1, 0x0A, 0xF4,
+  0x00, 0x00, 0x02, 0xFC, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D,
+  0x00, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x9C, 0xEF, 0xEC, 0x92,
+  0x1E, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xF6, 0x8D, 0x13, 0x84, 0x9F, 0xF3,
+  0x8D, 0x00, 0x00, 0x7F, 0xFE, 0xDE, 0x40, 0x00, 0x1E, 0xFF, 0xFF, 0xFE,
+  0x80, 0x02, 0xAE, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x9E, 0x9F, 0xFE, 0x00,
+  0x00, 0x8D, 0x0B, 0xFF, 0x9A, 0x41, 0x8D, 0x2D, 0xFE, 0x9F, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x38, 0xCE, 0xFF, 0xEC, 0x60, 0x00, 0x00, 0x8D, 0x00, 0x00,
+  0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x02, 0xBE,
+  0xEB, 0x20, 0x00, 0x06, 0xF7, 0x00, 0x00, 0x1D, 0xF9, 0xAF, 0xD1, 0x00,
+  0x1E, 0xD0, 0x00, 0x00, 0x5F, 0xC0, 0x0D, 0xF5, 0x00, 0xAF, 0x40, 0x00,
+  0x00, 0x6F, 0xB0, 0x0B, 0xF6, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x2F, 0xF4,
+  0x4F, 0xF2, 0x0D, 0xE1, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFE, 0x60, 0x8F,
+  0x60, 0x01, 0x00, 0x00, 0x00, 0x14, 0x41, 0x02, 0xFC, 0x06, 0xEF, 0xF9,
+  0x10, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x4F, 0xE6, 0xBF, 0x90, 0x00, 0x00,
+  0x00, 0x5F, 0x80, 0xAF, 0x70, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xED, 0x10,
+  0xBF, 0x60, 0x1F, 0xF1, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x9F, 0x80, 0x3F,
+  0xE0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0xE8, 0xDF, 0x80, 0x00, 0x00,
+  0xCE, 0x20, 0x00, 0x04, 0xCE, 0xD7, 0x00, 0x00, 0x06, 0xCE, 0xED, 0xA3,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0xEF, 0xF6,
+  0x24, 0x85, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xC1, 0x00, 0x8C,
+  0xC0, 0x3E, 0xFD, 0xAF, 0xFC, 0x10, 0xDF, 0xD0, 0xAF, 0xF3, 0x0B, 0xFF,
+  0xB4, 0xFF, 0x80, 0xDF, 0xF1, 0x01, 0xCF, 0xFF, 0xFF, 0x20, 0xDF, 0xF6,
+  0x00, 0x1D, 0xFF, 0xF7, 0x00, 0x8F, 0xFF, 0x84, 0x7D, 0xFF, 0xF8, 0x00,
+  0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x7C, 0xEF, 0xDA, 0x46,
+  0xFF, 0xF4, 0x5F, 0xB5, 0xFB, 0x5F, 0xB5, 0xFB, 0x4D, 0x90, 0x00, 0x3F,
+  0xF6, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x80, 0x09, 0xFF, 0x30, 0x0E, 0xFD,
+  0x00, 0x3F, 0xFA, 0x00, 0x6F, 0xF8, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7,
+  0x00, 0x5F, 0xF8, 0x00, 0x3F, 0xFB, 0x00, 0x0E, 0xFE, 0x00, 0x09, 0xFF,
+  0x30, 0x03, 0xFF, 0x80, 0x00, 0xAF, 0xE1, 0x00, 0x2D, 0xE6, 0x5F, 0xF4,
+  0x00, 0x0D, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x02, 0xFF, 0xA0, 0x00, 0xDF,
+  0xF0, 0x00, 0xAF, 0xF4, 0x00, 0x7F, 0xF6, 0x00, 0x6F, 0xF8, 0x00, 0x7F,
+  0xF8, 0x00, 0x8F, 0xF6, 0x00, 0xAF, 0xF3, 0x00, 0xDF, 0xE0, 0x02, 0xFF,
+  0x90, 0x08, 0xFF, 0x30, 0x0E, 0xFB, 0x00, 0x5E, 0xE3, 0x00, 0x00, 0x02,
+  0xF5, 0x00, 0x01, 0x50, 0x2F, 0x50, 0x33, 0x6F, 0xB5, 0xF7, 0xAF, 0x90,
+  0x4C, 0xFF, 0xFD, 0x50, 0x00, 0x7F, 0xFF, 0x91, 0x04, 0xDE, 0x9F, 0xAE,
+  0xE7, 0x39, 0x22, 0xF5, 0x18, 0x60, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x01,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0x11, 0x1A,
+  0xF7, 0x11, 0x11, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xF6, 0x00, 0x00, 0x3E, 0xEC, 0x3F, 0xFD, 0x3F, 0xFD, 0x6F, 0xF6, 0xAF,
+  0xB0, 0xEE, 0x20, 0x08, 0x88, 0x88, 0x31, 0xFF, 0xFF, 0xF5, 0x1F, 0xFF,
+  0xFF, 0x50, 0x16, 0x65, 0x3F, 0xFD, 0x3F, 0xFD, 0x3F, 0xFD, 0x00, 0x00,
+  0x9F, 0x40, 0x00, 0x0E, 0xE0, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x9F, 0x50,
+  0x00, 0x0D, 0xF1, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x0C,
+  0xF1, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x0B, 0xF2, 0x00,
+  0x01, 0xFD, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x77,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xBE, 0xEC, 0x71, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFC, 0x10, 0x04, 0xFF, 0xF7, 0x6D, 0xFF, 0x80, 0x0B, 0xFF, 0x80,
+  0x04, 0xFF, 0xE0, 0x0E, 0xFF, 0x40, 0x00, 0xFF, 0xF3, 0x1F, 0xFF, 0x30,
+  0x00, 0xEF, 0xF5, 0x2F, 0xFF, 0x20, 0x00, 0xEF, 0xF6, 0x1F, 0xFF, 0x30,
+  0x00, 0xEF, 0xF5, 0x0E, 0xFF, 0x40, 0x00, 0xFF, 0xF3, 0x0B, 0xFF, 0x80,
+  0x04, 0xFF, 0xE0, 0x04, 0xFF, 0xF7, 0x6D, 0xFF, 0x80, 0x00, 0x9F, 0xFF,
+  0xFF, 0xFC, 0x10, 0x00, 0x05, 0xBE, 0xFD, 0x71, 0x00, 0x7A, 0xEF, 0xFF,
+  0x20, 0x00, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xC9, 0x6F, 0xFF, 0x20, 0x00,
+  0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x0F,
+  0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x20,
+  0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x45,
+  0x5F, 0xFF, 0x65, 0x50, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0x38, 0xBD, 0xFE, 0xC7, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x9E, 0x95, 0x5B, 0xFF, 0xF6, 0x41, 0x00, 0x00, 0xDF, 0xF9, 0x00, 0x00,
+  0x00, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x2D, 0xFF,
+  0x80, 0x00, 0x03, 0xEF, 0xF8, 0x00, 0x00, 0x5E, 0xFF, 0x70, 0x00, 0x06,
+  0xFF, 0xE5, 0x00, 0x00, 0x7F, 0xFF, 0xA7, 0x77, 0x75, 0x9F, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x9F, 0xFF, 0xFF, 0xFF, 0xFB, 0x29, 0xCE, 0xFE, 0xC8, 0x20,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xE1, 0x3A, 0x75, 0x59, 0xFF, 0xF7, 0x00, 0x00,
+  0x00, 0xCF, 0xF8, 0x00, 0x00, 0x15, 0xFF, 0xF4, 0x00, 0x9F, 0xFF, 0xFD,
+  0x60, 0x00, 0x9F, 0xFF, 0xFD, 0x60, 0x00, 0x12, 0x37, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x9F, 0xFB, 0x10, 0x00, 0x00, 0x9F, 0xFC, 0xCB, 0x75, 0x59,
+  0xFF, 0xF9, 0xCF, 0xFF, 0xFF, 0xFF, 0xD1, 0x6A, 0xDE, 0xFE, 0xB7, 0x10,
+  0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFD, 0x9F, 0xF9, 0x00,
+  0x00, 0x2F, 0xF4, 0x8F, 0xF9, 0x00, 0x00, 0xCF, 0x80, 0x8F, 0xF9, 0x00,
+  0x07, 0xFD, 0x10, 0x8F, 0xF9, 0x00, 0x2F, 0xF3, 0x00, 0x8F, 0xF9, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x16, 0x66, 0x66, 0xBF, 0xFC, 0x63, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x2F,
+  0xFF, 0xFF, 0xFF, 0xF2, 0x2F, 0xFB, 0x77, 0x77, 0x71, 0x2F, 0xF8, 0x00,
+  0x00, 0x00, 0x2F, 0xFE, 0xEF, 0xD8, 0x10, 0x2F, 0xFF, 0xFF, 0xFF, 0xD2,
+  0x2D, 0x86, 0x59, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFE, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0x30, 0x00, 0x00, 0x9F, 0xFE, 0xAE, 0x85, 0x59, 0xFF,
+  0xF9, 0xAF, 0xFF, 0xFF, 0xFF, 0xC1, 0x27, 0xCD, 0xFE, 0xC7, 0x10, 0x00,
+  0x17, 0xCE, 0xFD, 0xA3, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0x70, 0x0C, 0xFF,
+  0xB5, 0x35, 0x85, 0x05, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xAF, 0xF9, 0xBE,
+  0xEB, 0x40, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xDF, 0xFF, 0x73, 0x9F,
+  0xFE, 0x0D, 0xFF, 0xC0, 0x01, 0xFF, 0xF3, 0xBF, 0xFA, 0x00, 0x0E, 0xFF,
+  0x47, 0xFF, 0xC0, 0x01, 0xFF, 0xF2, 0x2E, 0xFF, 0x62, 0x9F, 0xFC, 0x00,
+  0x6F, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x4B, 0xEF, 0xD9, 0x20, 0x00, 0xCF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x67, 0x77, 0x77,
+  0xDF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xF2, 0x00, 0x00, 0x08, 0xFF, 0xA0,
+  0x00, 0x00, 0x1E, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+  0xDF, 0xF5, 0x00, 0x00, 0x05, 0xFF, 0xD0, 0x00, 0x00, 0x0C, 0xFF, 0x60,
+  0x00, 0x00, 0x4F, 0xFE, 0x10, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x02,
+  0xFF, 0xF2, 0x00, 0x00, 0x02, 0x9D, 0xFF, 0xEB, 0x40, 0x02, 0xEF, 0xFF,
+  0xFF, 0xFF, 0x50, 0x8F, 0xFD, 0x42, 0xAF, 0xFC, 0x09, 0xFF, 0x80, 0x04,
+  0xFF, 0xC0, 0x5F, 0xFD, 0x32, 0xAF, 0xF8, 0x00, 0x7E, 0xFF, 0xFF, 0xE7,
+  0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xA1, 0x06, 0xFF, 0xB2, 0x19, 0xFF, 0xB0,
+  0xCF, 0xF4, 0x00, 0x1F, 0xFF, 0x1D, 0xFF, 0x40, 0x01, 0xFF, 0xF2, 0xBF,
+  0xFC, 0x33, 0xAF, 0xFE, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x60, 0x02, 0x9D,
+  0xFF, 0xEA, 0x40, 0x00, 0x00, 0x18, 0xDF, 0xEB, 0x50, 0x00, 0x02, 0xEF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xB3, 0x4D, 0xFF, 0x40, 0x0F, 0xFF,
+  0x30, 0x07, 0xFF, 0xB0, 0x1F, 0xFF, 0x30, 0x07, 0xFF, 0xE0, 0x0D, 0xFF,
+  0x91, 0x2D, 0xFF, 0xF1, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x6D,
+  0xFF, 0xE9, 0xFF, 0xF1, 0x00, 0x00, 0x22, 0x04, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0x80, 0x03, 0xB6, 0x35, 0xBF, 0xFE, 0x20, 0x04, 0xFF,
+  0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xAD, 0xEF, 0xD9, 0x20, 0x00, 0xFF, 0xF1,
+  0xFF, 0xF1, 0xFF, 0xF1, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x66, 0x60,
+  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xF1, 0x0F, 0xFF, 0x10, 0xFF, 0xF1, 0x0F,
+  0xFF, 0x10, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0x10,
+  0xFF, 0xF1, 0x1F, 0xFF, 0x13, 0xFF, 0x90, 0x7F, 0xD1, 0x0B, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFE,
+  0x00, 0x00, 0x05, 0xAF, 0xFF, 0xE9, 0x00, 0x39, 0xEF, 0xFF, 0xB5, 0x10,
+  0x1D, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x2F, 0xFE, 0x60, 0x00, 0x00, 0x00,
+  0x1A, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xD8, 0x30,
+  0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x93, 0x00, 0x00,
+  0x00, 0x16, 0xCF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x02, 0x7C, 0xFF, 0xFB,
+  0x00, 0x00, 0x00, 0x01, 0x8F, 0xFE, 0x00, 0x00, 0x05, 0xAE, 0xFF, 0xE8,
+  0x00, 0x49, 0xEF, 0xFF, 0xA5, 0x00, 0x1E, 0xFF, 0xFC, 0x61, 0x00, 0x00,
+  0x2F, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5A, 0xDE, 0xEC, 0x60, 0x0C, 0xFF, 0xFF, 0xFF, 0x80, 0xCB, 0x65, 0xAF,
+  0xFE, 0x02, 0x00, 0x01, 0xFF, 0xF1, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00,
+  0x6F, 0xFF, 0x40, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x0D, 0xFF, 0x60, 0x00,
+  0x00, 0xAA, 0xA1, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0xFF, 0xF2,
+  0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x79, 0x97, 0x30, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xFF,
+  0xFC, 0x40, 0x00, 0x00, 0x6F, 0xE9, 0x31, 0x13, 0x8E, 0xF6, 0x00, 0x04,
+  0xFC, 0x20, 0x00, 0x00, 0x02, 0xCF, 0x40, 0x0D, 0xE1, 0x01, 0x79, 0x63,
+  0x95, 0x2E, 0xC0, 0x5F, 0x60, 0x1D, 0xFF, 0xFD, 0xF7, 0x08, 0xF2, 0xAF,
+  0x10, 0x7F, 0xB1, 0x3E, 0xF7, 0x05, 0xF5, 0xCD, 0x00, 0xBF, 0x40, 0x09,
+  0xF7, 0x04, 0xF5, 0xCC, 0x00, 0xBF, 0x30, 0x08, 0xF7, 0x07, 0xF3, 0xBE,
+  0x00, 0x9F, 0x70, 0x0C, 0xF7, 0x2E, 0xD0, 0x7F, 0x30, 0x2F, 0xFB, 0xCF,
+  0xFD, 0xEE, 0x30, 0x2F, 0xB0, 0x05, 0xDF, 0xC7, 0xFD, 0x92, 0x00, 0x09,
+  0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xA2, 0x00, 0x00,
+  0x4D, 0x60, 0x00, 0x00, 0x09, 0xFF, 0xCA, 0xAD, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x39, 0xDE, 0xEC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE1,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xAE, 0xFF, 0x10, 0x00, 0x00,
+  0x0C, 0xFF, 0x4A, 0xFF, 0x70, 0x00, 0x00, 0x2F, 0xFE, 0x04, 0xFF, 0xC0,
+  0x00, 0x00, 0x8F, 0xF9, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0xDF, 0xF4, 0x00,
+  0x9F, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1E, 0xFF, 0x76, 0x66, 0x6A, 0xFF, 0x90,
+  0x5F, 0xFD, 0x00, 0x00, 0x04, 0xFF, 0xE1, 0xBF, 0xF9, 0x00, 0x00, 0x00,
+  0xEF, 0xF5, 0x6F, 0xFF, 0xFF, 0xED, 0x92, 0x00, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x20, 0x6F, 0xFE, 0x44, 0x7F, 0xFF, 0x80, 0x6F, 0xFE, 0x00, 0x0A,
+  0xFF, 0xA0, 0x6F, 0xFE, 0x00, 0x2D, 0xFF, 0x70, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x10, 0x6F, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x6F, 0xFE, 0x44, 0x6C,
+  0xFF, 0xB0, 0x6F, 0xFE, 0x00, 0x03, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x03,
+  0xFF, 0xF2, 0x6F, 0xFE, 0x44, 0x6C, 0xFF, 0xE1, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x70, 0x6F, 0xFF, 0xFF, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x5A, 0xDF,
+  0xEC, 0x82, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xDF, 0xFF, 0xB7,
+  0x79, 0xEC, 0x07, 0xFF, 0xF6, 0x00, 0x00, 0x04, 0x0D, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x00, 0x04, 0x01, 0xDF, 0xFF, 0xB7,
+  0x79, 0xDC, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x5B, 0xEF,
+  0xEC, 0x82, 0x6F, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x00, 0x6F, 0xFF, 0x89, 0xBF, 0xFF, 0xF7, 0x06, 0xFF, 0xE0,
+  0x00, 0x2C, 0xFF, 0xE1, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x66, 0xFF,
+  0xE0, 0x00, 0x00, 0xCF, 0xF9, 0x6F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xA6,
+  0xFF, 0xE0, 0x00, 0x00, 0xCF, 0xF9, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
+  0x66, 0xFF, 0xE0, 0x00, 0x2C, 0xFF, 0xF1, 0x6F, 0xFF, 0x88, 0xAE, 0xFF,
+  0xF7, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x6F, 0xFF, 0xFF, 0xEC,
+  0x82, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F,
+  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88, 0x86, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F,
+  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82,
+  0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE,
+  0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5A, 0xDE, 0xED, 0xB6, 0x10, 0x00, 0x2C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xA0, 0x01, 0xCF, 0xFF, 0xC8, 0x78, 0xBF, 0xA0, 0x07, 0xFF,
+  0xF7, 0x00, 0x00, 0x01, 0x40, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x60, 0x00, 0x44, 0x44, 0x41, 0x2F, 0xFF, 0x50, 0x00, 0xFF,
+  0xFF, 0xF3, 0x1F, 0xFF, 0x60, 0x00, 0xFF, 0xFF, 0xF3, 0x0D, 0xFF, 0xA0,
+  0x00, 0x00, 0xFF, 0xF3, 0x07, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF3, 0x01,
+  0xDF, 0xFF, 0xB7, 0x78, 0xFF, 0xF3, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF2, 0x00, 0x00, 0x5B, 0xEF, 0xFD, 0xB7, 0x10, 0x6F, 0xFE, 0x00, 0x00,
+  0x3F, 0xFF, 0x26, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF2, 0x6F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFF, 0x26, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF2, 0x6F, 0xFE,
+  0x00, 0x00, 0x3F, 0xFF, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x6F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xFF, 0xF8, 0x88, 0x89, 0xFF, 0xF2,
+  0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x26, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+  0xF2, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x26, 0xFF, 0xE0, 0x00, 0x03,
+  0xFF, 0xF2, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x20, 0x6F, 0xFE, 0x6F,
+  0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F,
+  0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x00,
+  0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00,
+  0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00,
+  0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00,
+  0x6F, 0xFE, 0x00, 0xBF, 0xFC, 0x8C, 0xFF, 0xF7, 0xFF, 0xFF, 0xC1, 0xFE,
+  0xC7, 0x00, 0x6F, 0xFE, 0x00, 0x01, 0xBF, 0xFD, 0x26, 0xFF, 0xE0, 0x01,
+  0xBF, 0xFD, 0x20, 0x6F, 0xFE, 0x01, 0xBF, 0xFD, 0x20, 0x06, 0xFF, 0xE1,
+  0xBF, 0xFD, 0x20, 0x00, 0x6F, 0xFE, 0xBF, 0xFD, 0x20, 0x00, 0x06, 0xFF,
+  0xFF, 0xFD, 0x20, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x6F, 0xFE, 0x7F, 0xFF, 0xA0, 0x00,
+  0x06, 0xFF, 0xE0, 0x7F, 0xFF, 0xA0, 0x00, 0x6F, 0xFE, 0x00, 0x7F, 0xFF,
+  0xA0, 0x06, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xA0, 0x6F, 0xFE, 0x00, 0x00,
+  0x7F, 0xFF, 0xA0, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00,
+  0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F,
+  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
+  0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88, 0x86, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xE1, 0x00,
+  0x00, 0x8F, 0xFF, 0xE6, 0xFF, 0xFF, 0x70, 0x00, 0x0E, 0xFF, 0xFE, 0x6F,
+  0xFF, 0xFD, 0x00, 0x05, 0xFF, 0xFF, 0xE6, 0xFF, 0xEF, 0xF5, 0x00, 0xCF,
+  0xEF, 0xFE, 0x6F, 0xFC, 0xCF, 0xB0, 0x3F, 0xF9, 0xFF, 0xE6, 0xFF, 0xC6,
+  0xFF, 0x29, 0xFE, 0x4F, 0xFE, 0x6F, 0xFC, 0x1E, 0xFA, 0xFF, 0x83, 0xFF,
+  0xE6, 0xFF, 0xC0, 0x8F, 0xFF, 0xF2, 0x3F, 0xFE, 0x6F, 0xFC, 0x02, 0xFF,
+  0xFA, 0x03, 0xFF, 0xE6, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0x3F, 0xFE, 0x6F,
+  0xFC, 0x00, 0x38, 0x70, 0x03, 0xFF, 0xE6, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x3F, 0xFE, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x6F, 0xFF,
+  0x90, 0x00, 0x0F, 0xFF, 0x26, 0xFF, 0xFF, 0x20, 0x00, 0xFF, 0xF2, 0x6F,
+  0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0x26, 0xFF, 0xFF, 0xF2, 0x00, 0xFF, 0xF2,
+  0x6F, 0xFD, 0xEF, 0xA0, 0x0F, 0xFF, 0x26, 0xFF, 0xC7, 0xFF, 0x30, 0xFF,
+  0xF2, 0x6F, 0xFC, 0x1E, 0xFB, 0x0F, 0xFF, 0x26, 0xFF, 0xC0, 0x7F, 0xF4,
+  0xFF, 0xF2, 0x6F, 0xFC, 0x00, 0xDF, 0xCF, 0xFF, 0x26, 0xFF, 0xC0, 0x06,
+  0xFF, 0xFF, 0xF2, 0x6F, 0xFC, 0x00, 0x0D, 0xFF, 0xFF, 0x26, 0xFF, 0xC0,
+  0x00, 0x5F, 0xFF, 0xF2, 0x6F, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0x20, 0x00,
+  0x01, 0x7B, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF,
+  0xD2, 0x00, 0x01, 0xDF, 0xFE, 0x97, 0x9F, 0xFF, 0xD1, 0x00, 0x8F, 0xFF,
+  0x30, 0x00, 0x4F, 0xFF, 0x80, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD,
+  0x01, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x50, 0x00,
+  0x00, 0x5F, 0xFF, 0x11, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0D,
+  0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x3F,
+  0xFF, 0x80, 0x01, 0xEF, 0xFE, 0x97, 0x9E, 0xFF, 0xD1, 0x00, 0x03, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00,
+  0x00, 0x6F, 0xFF, 0xFF, 0xFD, 0x93, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x40, 0x6F, 0xFF, 0x77, 0x9E, 0xFF, 0xD0, 0x6F, 0xFE, 0x00, 0x06, 0xFF,
+  0xF2, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF2, 0x6F, 0xFE, 0x00, 0x2B, 0xFF,
+  0xF1, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x6F, 0xFF, 0xFF, 0xFF, 0xF9,
+  0x00, 0x6F, 0xFF, 0x77, 0x65, 0x10, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xEB,
+  0x71, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x01, 0xDF,
+  0xFE, 0x97, 0x9F, 0xFF, 0xD1, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x4F, 0xFF,
+  0x80, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x01, 0xFF, 0xF6, 0x00,
+  0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0x11,
+  0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0D, 0xFF, 0x90, 0x00, 0x00,
+  0xAF, 0xFC, 0x00, 0x8F, 0xFF, 0x20, 0x00, 0x3F, 0xFF, 0x70, 0x01, 0xEF,
+  0xFE, 0x86, 0x9E, 0xFF, 0xC1, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xC2,
+  0x00, 0x00, 0x01, 0x7B, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x87, 0x00, 0x6F, 0xFF, 0xFF, 0xED, 0x92,
+  0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x6F, 0xFF, 0x77, 0xAF,
+  0xFF, 0x70, 0x06, 0xFF, 0xE0, 0x00, 0xDF, 0xF8, 0x00, 0x6F, 0xFE, 0x00,
+  0x0C, 0xFF, 0x70, 0x06, 0xFF, 0xE5, 0x59, 0xFF, 0xE1, 0x00, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xB2, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x6F,
+  0xFE, 0x02, 0xBF, 0xFE, 0x10, 0x06, 0xFF, 0xE0, 0x01, 0xEF, 0xF8, 0x00,
+  0x6F, 0xFE, 0x00, 0x08, 0xFF, 0xE1, 0x06, 0xFF, 0xE0, 0x00, 0x1E, 0xFF,
+  0x70, 0x6F, 0xFE, 0x00, 0x00, 0x8F, 0xFE, 0x10, 0x01, 0x8D, 0xFF, 0xDC,
+  0x93, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0xFE, 0x87, 0x8B, 0xE8,
+  0x0B, 0xFF, 0x50, 0x00, 0x01, 0x20, 0x9F, 0xFA, 0x20, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0xEB, 0x72, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x01,
+  0x69, 0xDF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x55, 0x30, 0x00,
+  0x00, 0xDF, 0xF5, 0x9F, 0xC9, 0x77, 0xBF, 0xFF, 0x29, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x90, 0x26, 0xAD, 0xEF, 0xEB, 0x60, 0x00, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x78, 0x88, 0xDF, 0xFD,
+  0x88, 0x88, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA,
+  0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00,
+  0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00,
+  0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00,
+  0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00,
+  0x9F, 0xFA, 0x5F, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x2F, 0xFF, 0x50, 0x01,
+  0xEF, 0xF7, 0x0C, 0xFF, 0xE9, 0x8D, 0xFF, 0xF2, 0x03, 0xEF, 0xFF, 0xFF,
+  0xFF, 0x60, 0x00, 0x29, 0xDE, 0xFD, 0xA4, 0x00, 0xBF, 0xF9, 0x00, 0x00,
+  0x00, 0xEF, 0xF5, 0x5F, 0xFE, 0x00, 0x00, 0x05, 0xFF, 0xE1, 0x1E, 0xFF,
+  0x50, 0x00, 0x0A, 0xFF, 0x90, 0x09, 0xFF, 0xA0, 0x00, 0x1F, 0xFF, 0x40,
+  0x04, 0xFF, 0xE1, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0xDF, 0xF6, 0x00, 0xBF,
+  0xF8, 0x00, 0x00, 0x8F, 0xFB, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x3F, 0xFF,
+  0x17, 0xFF, 0xC0, 0x00, 0x00, 0x0C, 0xFF, 0x7C, 0xFF, 0x70, 0x00, 0x00,
+  0x07, 0xFF, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xE1, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x06, 0xFF,
+  0xC2, 0xFF, 0xF1, 0x00, 0x3F, 0xFF, 0xA0, 0x00, 0x9F, 0xF8, 0x0D, 0xFF,
+  0x40, 0x07, 0xFF, 0xFD, 0x00, 0x0D, 0xFF, 0x50, 0xAF, 0xF8, 0x00, 0xAF,
+  0xCF, 0xF2, 0x01, 0xFF, 0xF1, 0x06, 0xFF, 0xB0, 0x0E, 0xF6, 0xEF, 0x50,
+  0x5F, 0xFD, 0x00, 0x3F, 0xFF, 0x02, 0xFF, 0x2B, 0xF9, 0x08, 0xFF, 0x90,
+  0x00, 0xEF, 0xF3, 0x6F, 0xE0, 0x7F, 0xC0, 0xCF, 0xF6, 0x00, 0x0B, 0xFF,
+  0x79, 0xFA, 0x04, 0xFF, 0x2F, 0xFF, 0x20, 0x00, 0x7F, 0xFA, 0xDF, 0x70,
+  0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x04, 0xFF, 0xEF, 0xF3, 0x00, 0xCF, 0xEF,
+  0xFA, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x08, 0xFF,
+  0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x50, 0x00, 0x0B,
+  0xFF, 0xB0, 0x07, 0xFF, 0xE1, 0x00, 0x6F, 0xFE, 0x20, 0x00, 0xCF, 0xFA,
+  0x02, 0xEF, 0xF6, 0x00, 0x00, 0x2F, 0xFF, 0x5B, 0xFF, 0xB0, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xDF, 0xFF, 0x30, 0x00, 0x00, 0x5F,
+  0xFF, 0x39, 0xFF, 0xD0, 0x00, 0x01, 0xEF, 0xF7, 0x01, 0xDF, 0xF8, 0x00,
+  0x0A, 0xFF, 0xC0, 0x00, 0x4F, 0xFF, 0x30, 0x5F, 0xFF, 0x20, 0x00, 0x08,
+  0xFF, 0xD1, 0xCF, 0xFB, 0x00, 0x00, 0x1E, 0xFF, 0x93, 0xFF, 0xF6, 0x00,
+  0x0A, 0xFF, 0xD1, 0x08, 0xFF, 0xE1, 0x04, 0xFF, 0xF5, 0x00, 0x1D, 0xFF,
+  0xA1, 0xDF, 0xFA, 0x00, 0x00, 0x4F, 0xFF, 0xBF, 0xFE, 0x10, 0x00, 0x00,
+  0x9F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x08, 0x88, 0x88, 0x8C, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x2E, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xDF, 0xFB, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0xD1, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x30, 0x00, 0x00, 0x06, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xEF, 0xFA,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF9, 0x88, 0x88, 0x88, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFD,
+  0x7F, 0xFF, 0xFD, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00,
+  0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00,
+  0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x00,
+  0x7F, 0xF7, 0x00, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xDF, 0x10, 0x00,
+  0x08, 0xF6, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0xEE, 0x10, 0x00, 0x09,
+  0xF5, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x0A, 0xF4,
+  0x00, 0x00, 0x5F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF3, 0x00,
+  0x00, 0x6F, 0x70, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00,
+  0x48, 0x30, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0x00, 0x6F, 0xF8, 0x00,
+  0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00,
+  0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00,
+  0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF,
+  0xFF, 0xF8, 0x00, 0x03, 0xEF, 0xC1, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB1,
+  0x00, 0x01, 0xDF, 0xD7, 0xEF, 0xA0, 0x01, 0xCF, 0xB1, 0x03, 0xDF, 0x90,
+  0xBF, 0x80, 0x00, 0x01, 0xAF, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x78, 0x30, 0x04, 0xFD, 0x10, 0x06, 0xF9, 0x00, 0x07,
+  0xF5, 0x03, 0xAD, 0xEF, 0xEC, 0x70, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xB0,
+  0x03, 0x63, 0x22, 0x3D, 0xFF, 0x30, 0x05, 0xAC, 0xDD, 0xEF, 0xF7, 0x08,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xF5, 0x10, 0x9F, 0xF8, 0x3F, 0xFE,
+  0x00, 0x0C, 0xFF, 0x82, 0xFF, 0xF5, 0x28, 0xFF, 0xF8, 0x0A, 0xFF, 0xFF,
+  0xFC, 0xFF, 0x80, 0x19, 0xDE, 0xC4, 0x9F, 0xF8, 0x8F, 0xF8, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x4C, 0xFE, 0x80, 0x08,
+  0xFF, 0xCF, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xA5, 0x8F, 0xFF, 0x58, 0xFF,
+  0xD0, 0x00, 0xAF, 0xFA, 0x8F, 0xF9, 0x00, 0x06, 0xFF, 0xC8, 0xFF, 0x90,
+  0x00, 0x6F, 0xFC, 0x8F, 0xFD, 0x00, 0x0A, 0xFF, 0xA8, 0xFF, 0xFA, 0x58,
+  0xFF, 0xF5, 0x8F, 0xFD, 0xFF, 0xFF, 0xFB, 0x08, 0xFF, 0x84, 0xCF, 0xE8,
+  0x10, 0x00, 0x17, 0xCE, 0xFD, 0xA2, 0x01, 0xCF, 0xFF, 0xFF, 0xF4, 0x0A,
+  0xFF, 0xE7, 0x45, 0xA4, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0x10,
+  0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00,
+  0x0A, 0xFF, 0xE7, 0x45, 0xA4, 0x01, 0xDF, 0xFF, 0xFF, 0xF4, 0x00, 0x17,
+  0xCE, 0xFD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xF2, 0x00, 0x3B, 0xEE, 0x91, 0xFF, 0xF2, 0x02, 0xEF, 0xFF,
+  0xFC, 0xFF, 0xF2, 0x0B, 0xFF, 0xD6, 0x6D, 0xFF, 0xF2, 0x1F, 0xFF, 0x40,
+  0x04, 0xFF, 0xF2, 0x3F, 0xFF, 0x10, 0x00, 0xFF, 0xF2, 0x3F, 0xFF, 0x10,
+  0x00, 0xFF, 0xF2, 0x1F, 0xFF, 0x40, 0x04, 0xFF, 0xF2, 0x0B, 0xFF, 0xD6,
+  0x6D, 0xFF, 0xF2, 0x02, 0xEF, 0xFF, 0xFD, 0xFF, 0xF2, 0x00, 0x3B, 0xEE,
+  0xA1, 0xFF, 0xF2, 0x00, 0x17, 0xCE, 0xFC, 0x70, 0x00, 0x01, 0xDF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xB3, 0x2B, 0xFF, 0x80, 0x1F, 0xFF, 0x10,
+  0x02, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F, 0xFF, 0xEE,
+  0xEE, 0xEE, 0xE1, 0x1F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC4,
+  0x22, 0x5A, 0x90, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x17, 0xCE,
+  0xFD, 0xB7, 0x20, 0x00, 0x19, 0xDF, 0xFC, 0x00, 0xAF, 0xFF, 0xFC, 0x00,
+  0xFF, 0xF3, 0x11, 0x02, 0xFF, 0xE0, 0x00, 0xAF, 0xFF, 0xFF, 0xF9, 0xAF,
+  0xFF, 0xFF, 0xF9, 0x25, 0xFF, 0xE4, 0x42, 0x02, 0xFF, 0xE0, 0x00, 0x02,
+  0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02,
+  0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
+  0x3B, 0xEE, 0x91, 0xFF, 0xF2, 0x02, 0xEF, 0xFF, 0xFC, 0xFF, 0xF2, 0x0B,
+  0xFF, 0xD5, 0x5D, 0xFF, 0xF2, 0x1F, 0xFF, 0x40, 0x04, 0xFF, 0xF2, 0x3F,
+  0xFF, 0x10, 0x00, 0xFF, 0xF2, 0x3F, 0xFF, 0x10, 0x00, 0xFF, 0xF2, 0x1F,
+  0xFF, 0x40, 0x04, 0xFF, 0xF2, 0x0B, 0xFF, 0xD6, 0x6D, 0xFF, 0xF2, 0x02,
+  0xEF, 0xFF, 0xFC, 0xFF, 0xF2, 0x00, 0x3B, 0xEE, 0xA2, 0xFF, 0xF1, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0xC5, 0x32, 0x5D, 0xFF, 0x90, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x9C, 0xEF, 0xEB, 0x60, 0x00, 0x8F,
+  0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x3B,
+  0xEE, 0x90, 0x08, 0xFF, 0xCF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xC6, 0xBF,
+  0xFE, 0x08, 0xFF, 0xE0, 0x01, 0xFF, 0xF1, 0x8F, 0xFA, 0x00, 0x0E, 0xFF,
+  0x38, 0xFF, 0x80, 0x00, 0xEF, 0xF3, 0x8F, 0xF8, 0x00, 0x0E, 0xFF, 0x38,
+  0xFF, 0x80, 0x00, 0xEF, 0xF3, 0x8F, 0xF8, 0x00, 0x0E, 0xFF, 0x38, 0xFF,
+  0x80, 0x00, 0xEF, 0xF3, 0x8F, 0xF8, 0x8F, 0xF8, 0x48, 0x85, 0x00, 0x00,
+  0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8,
+  0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x48, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x8F, 0xF7, 0x12, 0xDF, 0xF5, 0x9F, 0xFF, 0xD0, 0x9F,
+  0xEB, 0x20, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x8F, 0xF8, 0x00, 0x6F, 0xFE, 0x38, 0xFF, 0x80, 0x5F, 0xFE, 0x30, 0x8F,
+  0xF8, 0x5F, 0xFE, 0x30, 0x08, 0xFF, 0xCF, 0xFE, 0x30, 0x00, 0x8F, 0xFF,
+  0xFF, 0x40, 0x00, 0x08, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x8F, 0xF9, 0xCF,
+  0xFB, 0x00, 0x08, 0xFF, 0x81, 0xDF, 0xFA, 0x00, 0x8F, 0xF8, 0x02, 0xEF,
+  0xFA, 0x08, 0xFF, 0x80, 0x03, 0xEF, 0xF9, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F,
+  0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F,
+  0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F,
+  0xF8, 0x5C, 0xFC, 0x40, 0x4C, 0xFD, 0x70, 0x8F, 0xFC, 0xFF, 0xFF, 0xF7,
+  0xFF, 0xFF, 0xF5, 0x8F, 0xFF, 0xB6, 0xDF, 0xFF, 0xC6, 0xBF, 0xFB, 0x8F,
+  0xFD, 0x00, 0x6F, 0xFF, 0x20, 0x3F, 0xFD, 0x8F, 0xF9, 0x00, 0x5F, 0xFD,
+  0x00, 0x2F, 0xFF, 0x8F, 0xF8, 0x00, 0x5F, 0xFC, 0x00, 0x2F, 0xFF, 0x8F,
+  0xF8, 0x00, 0x5F, 0xFC, 0x00, 0x2F, 0xFF, 0x8F, 0xF8, 0x00, 0x5F, 0xFC,
+  0x00, 0x2F, 0xFF, 0x8F, 0xF8, 0x00, 0x5F, 0xFC, 0x00, 0x2F, 0xFF, 0x8F,
+  0xF8, 0x00, 0x5F, 0xFC, 0x00, 0x2F, 0xFF, 0x8F, 0xF8, 0x5C, 0xFE, 0x90,
+  0x08, 0xFF, 0xDF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0x93, 0x8F, 0xFE, 0x08,
+  0xFF, 0xD0, 0x00, 0xFF, 0xF1, 0x8F, 0xF9, 0x00, 0x0E, 0xFF, 0x38, 0xFF,
+  0x80, 0x00, 0xEF, 0xF3, 0x8F, 0xF8, 0x00, 0x0E, 0xFF, 0x38, 0xFF, 0x80,
+  0x00, 0xEF, 0xF3, 0x8F, 0xF8, 0x00, 0x0E, 0xFF, 0x38, 0xFF, 0x80, 0x00,
+  0xEF, 0xF3, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF, 0xFF, 0xFF,
+  0xFE, 0x20, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x02,
+  0xFF, 0xF2, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF, 0x00, 0x00,
+  0xEF, 0xF5, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF, 0xD5, 0x5C,
+  0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18, 0xCE, 0xFD,
+  0x81, 0x00, 0x8F, 0xF8, 0x5C, 0xFE, 0x80, 0x08, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xB0, 0x8F, 0xFF, 0x71, 0x5E, 0xFF, 0x58, 0xFF, 0xC0, 0x00, 0x9F, 0xFA,
+  0x8F, 0xF9, 0x00, 0x06, 0xFF, 0xC8, 0xFF, 0x90, 0x00, 0x6F, 0xFC, 0x8F,
+  0xFD, 0x00, 0x0A, 0xFF, 0xA8, 0xFF, 0xFA, 0x58, 0xFF, 0xF5, 0x8F, 0xFC,
+  0xFF, 0xFF, 0xFB, 0x08, 0xFF, 0x84, 0xCF, 0xE8, 0x10, 0x8F, 0xF8, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0x91, 0xFF,
+  0xF2, 0x02, 0xEF, 0xFF, 0xFC, 0xFF, 0xF2, 0x0B, 0xFF, 0xD5, 0x5D, 0xFF,
+  0xF2, 0x1F, 0xFF, 0x40, 0x04, 0xFF, 0xF2, 0x3F, 0xFF, 0x10, 0x00, 0xFF,
+  0xF2, 0x3F, 0xFF, 0x10, 0x00, 0xFF, 0xF2, 0x1F, 0xFF, 0x40, 0x04, 0xFF,
+  0xF2, 0x0B, 0xFF, 0xD6, 0x6D, 0xFF, 0xF2, 0x02, 0xEF, 0xFF, 0xFC, 0xFF,
+  0xF2, 0x00, 0x3B, 0xEE, 0xA1, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x8F,
+  0xF8, 0x5C, 0xF9, 0x8F, 0xFD, 0xFF, 0xFA, 0x8F, 0xFF, 0xC6, 0x55, 0x8F,
+  0xFE, 0x10, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x8F,
+  0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F,
+  0xF8, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xDB, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x1F, 0xFC, 0x32, 0x36, 0xB0, 0x0F, 0xFD, 0x52, 0x00, 0x00, 0x0A,
+  0xFF, 0xFF, 0xFB, 0x50, 0x00, 0x7C, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x02,
+  0x8F, 0xF9, 0x0B, 0x73, 0x22, 0x9F, 0xF9, 0x0E, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x07, 0xBD, 0xEF, 0xEA, 0x30, 0x02, 0x88, 0x60, 0x00, 0x04, 0xFF, 0xD0,
+  0x00, 0x04, 0xFF, 0xD0, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xFF, 0x36, 0xFF, 0xD4, 0x44, 0x04, 0xFF, 0xD0, 0x00, 0x04, 0xFF, 0xD0,
+  0x00, 0x04, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF5,
+  0x43, 0x00, 0xDF, 0xFF, 0xFB, 0x00, 0x3B, 0xEF, 0xFB, 0x9F, 0xF7, 0x00,
+  0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7, 0x00, 0x0F,
+  0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7, 0x00, 0x0F, 0xFF,
+  0x19, 0xFF, 0x70, 0x01, 0xFF, 0xF1, 0x8F, 0xF9, 0x00, 0x6F, 0xFF, 0x16,
+  0xFF, 0xE7, 0x7E, 0xFF, 0xF1, 0x1E, 0xFF, 0xFF, 0xCF, 0xFF, 0x10, 0x3C,
+  0xFE, 0x91, 0xFF, 0xF1, 0x8F, 0xF8, 0x00, 0x01, 0xFF, 0xF1, 0x3F, 0xFD,
+  0x00, 0x06, 0xFF, 0xA0, 0x0C, 0xFF, 0x30, 0x0B, 0xFF, 0x40, 0x06, 0xFF,
+  0x80, 0x1F, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x6F, 0xF8, 0x00, 0x00, 0xAF,
+  0xF4, 0xCF, 0xF2, 0x00, 0x00, 0x4F, 0xFB, 0xFF, 0xB0, 0x00, 0x00, 0x0D,
+  0xFF, 0xFF, 0x60, 0x00, 0x00, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x02,
+  0xFF, 0xF9, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x4F, 0xF8, 0x00, 0x7F, 0xF8,
+  0x0F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0xAF, 0xF4, 0x0B, 0xFF, 0x30, 0xBF,
+  0xFF, 0x10, 0xEF, 0xF1, 0x07, 0xFF, 0x70, 0xEF, 0xCF, 0x42, 0xFF, 0xC0,
+  0x04, 0xFF, 0xA3, 0xFC, 0x8F, 0x76, 0xFF, 0x80, 0x00, 0xEF, 0xE7, 0xF9,
+  0x5F, 0xBA, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0xF5, 0x1F, 0xED, 0xFF, 0x10,
+  0x00, 0x7F, 0xFF, 0xF2, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
+  0x09, 0xFF, 0xF8, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x05, 0xFF, 0xF4, 0x00,
+  0x3F, 0xFE, 0x10, 0x0A, 0xFF, 0x80, 0x7F, 0xFA, 0x05, 0xFF, 0xC0, 0x00,
+  0xBF, 0xF7, 0xEF, 0xF3, 0x00, 0x02, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x05,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD1, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0x90, 0x00, 0x1D, 0xFF, 0x4D, 0xFF, 0x50, 0x0A, 0xFF, 0x80, 0x3F,
+  0xFE, 0x26, 0xFF, 0xD0, 0x00, 0x8F, 0xFB, 0x9F, 0xF7, 0x00, 0x01, 0xFF,
+  0xE1, 0x3F, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0x40, 0x0B, 0xFF,
+  0x40, 0x05, 0xFF, 0x90, 0x1F, 0xFD, 0x00, 0x00, 0xEF, 0xE1, 0x5F, 0xF8,
+  0x00, 0x00, 0x8F, 0xF6, 0xAF, 0xF2, 0x00, 0x00, 0x2F, 0xFC, 0xEF, 0xC0,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10,
+  0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF4, 0x00,
+  0x00, 0x00, 0x13, 0xEF, 0xD0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00,
+  0x00, 0x04, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF6,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xF6, 0x04, 0x44, 0x49, 0xFF, 0xE3, 0x00, 0x00,
+  0x4F, 0xFF, 0x40, 0x00, 0x03, 0xEF, 0xF5, 0x00, 0x00, 0x2E, 0xFF, 0x60,
+  0x00, 0x02, 0xDF, 0xF7, 0x00, 0x00, 0x1D, 0xFF, 0xB4, 0x44, 0x41, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x02, 0xAE,
+  0xFF, 0x50, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x1F, 0xFF, 0x30, 0x00, 0x02,
+  0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0x01, 0xAF, 0xFA, 0x00, 0x0B, 0xFF, 0xFC, 0x20, 0x00, 0xCF, 0xFF, 0xD3,
+  0x00, 0x00, 0x2A, 0xFF, 0xA0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02,
+  0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x2A, 0xEF, 0xF5, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3A, 0xD2,
+  0xCF, 0xFD, 0x60, 0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x9F, 0xF9,
+  0x00, 0x00, 0x05, 0xFF, 0xA0, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xFF, 0xF5,
+  0x00, 0x08, 0xFF, 0xFF, 0x50, 0x02, 0xFF, 0xF5, 0x10, 0x00, 0x4F, 0xFB,
+  0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x09,
+  0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0C, 0xFF, 0xD7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0xBF, 0xFC, 0x84, 0x12, 0x6C,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2C, 0x41, 0x14, 0x9D, 0xFD, 0x92,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x8F, 0xF8, 0x8F,
+  0xF8, 0x8F, 0xF8, 0x12, 0x21, 0x1A, 0xA2, 0x3F, 0xF4, 0x5F, 0xF6, 0x7F,
+  0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x8F, 0xF8, 0x00,
+  0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0E, 0x70,
+  0x00, 0x02, 0x9E, 0xFF, 0xD9, 0x04, 0xFF, 0xFF, 0xFF, 0xF1, 0xEF, 0xFD,
+  0xF9, 0x6C, 0x5F, 0xFF, 0x2E, 0x70, 0x07, 0xFF, 0xB0, 0xE7, 0x00, 0x7F,
+  0xFB, 0x0E, 0x70, 0x04, 0xFF, 0xE1, 0xE7, 0x00, 0x0D, 0xFF, 0xDF, 0x96,
+  0xC0, 0x3E, 0xFF, 0xFF, 0xFF, 0x00, 0x28, 0xDF, 0xFD, 0x90, 0x00, 0x00,
+  0xE7, 0x00, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+  0x03, 0xAE, 0xFE, 0xC6, 0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0x00, 0xAF, 0xFD,
+  0x65, 0x89, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00,
+  0x11, 0xFF, 0xF4, 0x11, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x60, 0xAF, 0xFF,
+  0xFF, 0xFF, 0x60, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00,
+  0x00, 0x45, 0xFF, 0xF6, 0x55, 0x54, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC, 0xEF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0x80, 0x00, 0x00, 0x5C, 0x12, 0xEF, 0x99,
+  0xCA, 0x8F, 0xF4, 0x02, 0xEF, 0xFF, 0xFF, 0xF5, 0x00, 0x0B, 0xF7, 0x15,
+  0xFE, 0x00, 0x00, 0xFD, 0x00, 0x09, 0xF3, 0x00, 0x0F, 0xC0, 0x00, 0x9F,
+  0x40, 0x00, 0xDF, 0x40, 0x2E, 0xF1, 0x00, 0x1D, 0xFF, 0xDF, 0xFE, 0x30,
+  0x1C, 0xFC, 0xCF, 0xDA, 0xFE, 0x31, 0xCB, 0x10, 0x00, 0x08, 0xD2, 0x01,
+  0x10, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xFD, 0x10, 0x00, 0xAF, 0xFC, 0x1D,
+  0xFF, 0x80, 0x04, 0xFF, 0xF3, 0x05, 0xFF, 0xF2, 0x0C, 0xFF, 0x90, 0x00,
+  0xCF, 0xFA, 0x6F, 0xFE, 0x10, 0x00, 0x3F, 0xFF, 0xEF, 0xF7, 0x00, 0x6F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x4A, 0xAA, 0xEF, 0xFF, 0xBA, 0xA7, 0x00,
+  0x00, 0x8F, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x4A,
+  0xAA, 0xDF, 0xFE, 0xAA, 0xA7, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x79,
+  0x2C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x00, 0x00,
+  0x07, 0x92, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0x01,
+  0x9D, 0xFE, 0xB5, 0x00, 0xCF, 0xFD, 0xEF, 0x90, 0x1F, 0xFB, 0x00, 0x24,
+  0x01, 0xEF, 0xF7, 0x10, 0x00, 0x05, 0xFF, 0xFE, 0x70, 0x02, 0xDF, 0xEF,
+  0xFF, 0xC1, 0xAF, 0xC1, 0x2A, 0xFF, 0x8D, 0xFA, 0x00, 0x0B, 0xFB, 0xAF,
+  0xF9, 0x21, 0xDF, 0x82, 0xDF, 0xFF, 0xEF, 0xC1, 0x01, 0x8E, 0xFF, 0xF3,
+  0x00, 0x00, 0x18, 0xFF, 0xD0, 0x06, 0x20, 0x0D, 0xFF, 0x10, 0xFF, 0xEE,
+  0xFF, 0xB0, 0x09, 0xDE, 0xED, 0x81, 0x00, 0x12, 0x10, 0x22, 0x04, 0xFB,
+  0x0E, 0xF2, 0x4F, 0xB0, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x9E, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x4E, 0xD7, 0x55,
+  0x9F, 0xC1, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x0C, 0xB0,
+  0x3A, 0xEF, 0xD4, 0x2E, 0x70, 0x4F, 0x22, 0xEF, 0xDA, 0xD6, 0x08, 0xD0,
+  0x7D, 0x09, 0xFB, 0x00, 0x01, 0x04, 0xF1, 0x8B, 0x0C, 0xF7, 0x00, 0x00,
+  0x02, 0xF2, 0x7C, 0x0C, 0xF8, 0x00, 0x00, 0x03, 0xF2, 0x4F, 0x17, 0xFE,
+  0x31, 0x33, 0x07, 0xE0, 0x0D, 0x91, 0xBF, 0xFF, 0xF6, 0x1E, 0x80, 0x05,
+  0xF6, 0x05, 0x99, 0x72, 0xBD, 0x10, 0x00, 0x7F, 0xA4, 0x22, 0x6D, 0xE3,
+  0x00, 0x00, 0x04, 0xCF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x02, 0x33,
+  0x10, 0x00, 0x00, 0x0A, 0xDF, 0xEB, 0x40, 0x1E, 0x97, 0x8F, 0xF3, 0x01,
+  0x00, 0x0B, 0xF8, 0x08, 0xDE, 0xFF, 0xF9, 0x7F, 0xC4, 0x3C, 0xF9, 0x8F,
+  0xB4, 0x7F, 0xF9, 0x1A, 0xEE, 0xA9, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5A,
+  0xAA, 0xAA, 0xA5, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x10,
+  0x00, 0x69, 0x00, 0x5A, 0x01, 0xAF, 0x90, 0x9F, 0xB3, 0xDF, 0xA3, 0xCF,
+  0xB2, 0xAF, 0x70, 0x8F, 0x90, 0x08, 0xFD, 0x36, 0xFE, 0x40, 0x07, 0xFE,
+  0x56, 0xEF, 0x60, 0x03, 0xD9, 0x03, 0xDB, 0x00, 0x01, 0x50, 0x01, 0x60,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0x08, 0x88, 0x88, 0x31, 0xFF, 0xFF,
+  0xF5, 0x1F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x9E, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x4E, 0xD7, 0x55, 0x9F,
+  0xC1, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x0C, 0xB0, 0xCF,
+  0xFE, 0xA1, 0x2E, 0x70, 0x4F, 0x20, 0xCF, 0x3A, 0xF8, 0x08, 0xD0, 0x7D,
+  0x00, 0xCF, 0x08, 0xF9, 0x04, 0xF1, 0x8B, 0x00, 0xCF, 0xFF, 0xB2, 0x02,
+  0xF2, 0x7C, 0x00, 0xCF, 0x7F, 0x80, 0x03, 0xF2, 0x4F, 0x10, 0xCF, 0x0C,
+  0xF3, 0x07, 0xE0, 0x0D, 0x90, 0xCF, 0x04, 0xFB, 0x1E, 0x80, 0x05, 0xF6,
+  0x44, 0x00, 0x45, 0xBD, 0x10, 0x00, 0x7F, 0xA4, 0x22, 0x6D, 0xE3, 0x00,
+  0x00, 0x04, 0xCF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x02, 0x33, 0x10,
+  0x00, 0x00, 0x3A, 0xAA, 0xAA, 0x14, 0xFF, 0xFF, 0xF2, 0x00, 0x01, 0x00,
+  0x00, 0x6E, 0xFD, 0x30, 0x3F, 0xA5, 0xBE, 0x16, 0xF0, 0x03, 0xF3, 0x4F,
+  0x72, 0x9F, 0x10, 0x9F, 0xFE, 0x60, 0x00, 0x24, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x31, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xF6, 0x00, 0x00, 0x01, 0x11, 0x1A, 0xF7, 0x11, 0x11, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xF6, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0xDF,
+  0xEA, 0x10, 0xC6, 0x4B, 0xF9, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x5F, 0xD2,
+  0x00, 0x8F, 0xC1, 0x00, 0xBF, 0xE7, 0x64, 0x1F, 0xFF, 0xFF, 0xB0, 0x0C,
+  0xEF, 0xEA, 0x10, 0x95, 0x4C, 0xF7, 0x00, 0x01, 0xBF, 0x40, 0x0D, 0xFF,
+  0xB2, 0x00, 0x23, 0xAF, 0xA2, 0x74, 0x4A, 0xF9, 0x2C, 0xEF, 0xD9, 0x10,
+  0x00, 0x58, 0x60, 0x2F, 0xE2, 0x0C, 0xE3, 0x08, 0xF4, 0x00, 0x8F, 0xF9,
+  0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xF9, 0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xF9,
+  0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xF9, 0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xF9,
+  0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xF9, 0x00, 0x0E, 0xFF, 0x30, 0x8F, 0xFB,
+  0x00, 0x1F, 0xFF, 0x30, 0x8F, 0xFF, 0x86, 0xBF, 0xFF, 0x93, 0x8F, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xF6, 0x8F, 0xFB, 0xCF, 0xB2, 0x9E, 0xD4, 0x8F, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE,
+  0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0x94, 0xFA, 0xAF, 0xFF, 0xF6, 0x0F, 0xAD,
+  0xFF, 0xFF, 0x60, 0xFA, 0xBF, 0xFF, 0xF6, 0x0F, 0xA6, 0xFF, 0xFF, 0x60,
+  0xFA, 0x07, 0xFF, 0xF6, 0x0F, 0xA0, 0x01, 0x7F, 0x60, 0xFA, 0x00, 0x03,
+  0xF6, 0x0F, 0xA0, 0x00, 0x3F, 0x60, 0xFA, 0x00, 0x03, 0xF6, 0x0F, 0xA0,
+  0x00, 0x3F, 0x60, 0xFA, 0x00, 0x03, 0xF6, 0x0F, 0xA0, 0x00, 0x3F, 0x60,
+  0xFA, 0x00, 0x03, 0xC5, 0x0B, 0x80, 0x16, 0x65, 0x3F, 0xFD, 0x3F, 0xFD,
+  0x3F, 0xFD, 0x00, 0x41, 0x00, 0x08, 0xB0, 0x21, 0x7F, 0x1B, 0xFF, 0xC0,
+  0x13, 0x30, 0x00, 0xAD, 0xFF, 0x00, 0x96, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x45, 0xFF, 0x53, 0xCF, 0xFF, 0xFB,
+  0x04, 0xBE, 0xEB, 0x40, 0x6F, 0xF8, 0x9F, 0xF5, 0xDF, 0xA0, 0x0B, 0xFC,
+  0xFF, 0x70, 0x08, 0xFE, 0xDF, 0xA0, 0x0B, 0xFC, 0x6F, 0xF8, 0x9F, 0xF5,
+  0x05, 0xCE, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF8,
+  0x6A, 0xAA, 0xAA, 0xA5, 0x10, 0x00, 0x10, 0x00, 0x05, 0x91, 0x03, 0xB1,
+  0x00, 0x5F, 0xC2, 0x3F, 0xD3, 0x00, 0x7F, 0xE5, 0x6F, 0xF7, 0x00, 0x4F,
+  0xD0, 0x3E, 0xF0, 0x1B, 0xFC, 0x09, 0xFE, 0x2D, 0xFA, 0x2C, 0xFB, 0x15,
+  0xF6, 0x03, 0xF8, 0x00, 0x43, 0x00, 0x24, 0x00, 0x00, 0x05, 0x9B, 0x90,
+  0x00, 0x00, 0x00, 0x9B, 0x20, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x5F,
+  0x90, 0x00, 0x14, 0x4F, 0xC0, 0x00, 0x00, 0x1D, 0xE1, 0x00, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
+  0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00,
+  0x02, 0x5F, 0xC2, 0x10, 0x4F, 0xA0, 0x01, 0x21, 0x00, 0xFF, 0xFF, 0xF8,
+  0x0D, 0xE1, 0x01, 0xDF, 0xA0, 0x05, 0x55, 0x55, 0x27, 0xF7, 0x00, 0xBE,
+  0xFA, 0x00, 0x00, 0x00, 0x02, 0xED, 0x00, 0x9C, 0x5F, 0xA0, 0x00, 0x00,
+  0x00, 0xAF, 0x40, 0x6E, 0x35, 0xFB, 0x10, 0x00, 0x00, 0x4F, 0xA0, 0x0A,
+  0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0xE2, 0x00, 0x34, 0x47, 0xFC, 0x30,
+  0x00, 0x04, 0xC6, 0x00, 0x00, 0x00, 0x28, 0x60, 0x00, 0x13, 0x20, 0x00,
+  0x00, 0x00, 0x23, 0x10, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xEE,
+  0x10, 0x00, 0x2C, 0x9F, 0xC0, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1E, 0xE1, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0x80, 0x8F, 0x63, 0xBE, 0xFD, 0x60, 0x09, 0x99, 0x99, 0x52,
+  0xFC, 0x05, 0xB6, 0x6E, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00,
+  0x0D, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x8F, 0xC0, 0x00,
+  0x00, 0x01, 0xDE, 0x10, 0x00, 0x09, 0xFB, 0x10, 0x00, 0x00, 0x08, 0xF6,
+  0x00, 0x01, 0xBF, 0xB2, 0x21, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x06, 0xFF,
+  0xFF, 0xF6, 0x00, 0x00, 0x35, 0x20, 0x00, 0x02, 0x55, 0x55, 0x52, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xFE, 0xA1, 0x00,
+  0x00, 0x0D, 0xE1, 0x00, 0x08, 0x54, 0xBF, 0x90, 0x00, 0x07, 0xF7, 0x00,
+  0x00, 0x00, 0x19, 0xF9, 0x00, 0x02, 0xED, 0x00, 0x00, 0x00, 0xBF, 0xFC,
+  0x10, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x02, 0x4B, 0xF6, 0x00, 0x3F, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x0C, 0xF2, 0x00, 0x00, 0x01, 0x82,
+  0x29, 0xFB, 0x06, 0xF8, 0x00, 0x47, 0x50, 0x1F, 0xFF, 0xFD, 0x31, 0xEE,
+  0x10, 0x3F, 0xFA, 0x00, 0x02, 0x32, 0x00, 0x8F, 0x60, 0x1D, 0xCF, 0xA0,
+  0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0A, 0xB5, 0xFA, 0x00, 0x00, 0x00, 0x0B,
+  0xF3, 0x06, 0xE3, 0x5F, 0xB1, 0x00, 0x00, 0x04, 0xF9, 0x00, 0xAF, 0xFF,
+  0xFF, 0xD0, 0x00, 0x00, 0xDE, 0x10, 0x03, 0x44, 0x7F, 0xC3, 0x00, 0x00,
+  0x4C, 0x60, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x0C, 0xFF, 0x40, 0x00,
+  0x00, 0xCF, 0xF4, 0x00, 0x00, 0x0C, 0xFF, 0x40, 0x00, 0x00, 0x12, 0x20,
+  0x00, 0x00, 0x06, 0x77, 0x20, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x9F,
+  0xFD, 0x00, 0x00, 0x9F, 0xFE, 0x30, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x0A,
+  0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF6, 0x00, 0x03, 0x19, 0xFF, 0xD5, 0x5A,
+  0xF1, 0x3F, 0xFF, 0xFF, 0xFF, 0x10, 0x3A, 0xDF, 0xEB, 0x70, 0x00, 0x00,
+  0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xE2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xAE, 0xFF, 0x10, 0x00, 0x00, 0x0C, 0xFF, 0x4A, 0xFF, 0x70,
+  0x00, 0x00, 0x2F, 0xFE, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x8F, 0xF9, 0x00,
+  0xEF, 0xF3, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x9F, 0xF8, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0x1E, 0xFF, 0x76, 0x66, 0x6A, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x00, 0x04,
+  0xFF, 0xE1, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00,
+  0x17, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xAE, 0xFF, 0x10, 0x00, 0x00, 0x0C, 0xFF, 0x4A, 0xFF, 0x70, 0x00,
+  0x00, 0x2F, 0xFE, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0xEF,
+  0xF3, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x9F, 0xF8, 0x00, 0x04, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1E,
+  0xFF, 0x76, 0x66, 0x6A, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x00, 0x04, 0xFF,
+  0xE1, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x06, 0x88,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xE3, 0x00, 0x00, 0x00, 0x01,
+  0x73, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xAE, 0xFF, 0x10, 0x00, 0x00, 0x0C, 0xFF, 0x4A, 0xFF, 0x70, 0x00, 0x00,
+  0x2F, 0xFE, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0xEF, 0xF3,
+  0x00, 0x00, 0xDF, 0xF4, 0x00, 0x9F, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1E, 0xFF,
+  0x76, 0x66, 0x6A, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x00, 0x04, 0xFF, 0xE1,
+  0xBF, 0xF9, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x9F, 0xC3, 0x8B, 0x00, 0x00, 0x00, 0x01, 0xF6,
+  0x9F, 0xF6, 0x00, 0x00, 0x00, 0x01, 0x30, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFB, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xAE, 0xFF, 0x10, 0x00, 0x00, 0x0C,
+  0xFF, 0x4A, 0xFF, 0x70, 0x00, 0x00, 0x2F, 0xFE, 0x04, 0xFF, 0xC0, 0x00,
+  0x00, 0x8F, 0xF9, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x9F,
+  0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x40, 0x1E, 0xFF, 0x76, 0x66, 0x6A, 0xFF, 0x90, 0x5F,
+  0xFD, 0x00, 0x00, 0x04, 0xFF, 0xE1, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xEF,
+  0xF5, 0x00, 0x00, 0x22, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x18,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x18, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xAE, 0xFF, 0x10, 0x00, 0x00, 0x0C, 0xFF,
+  0x4A, 0xFF, 0x70, 0x00, 0x00, 0x2F, 0xFE, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+  0x8F, 0xF9, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x9F, 0xF8,
+  0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x40, 0x1E, 0xFF, 0x76, 0x66, 0x6A, 0xFF, 0x90, 0x5F, 0xFD,
+  0x00, 0x00, 0x04, 0xFF, 0xE1, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xEF, 0xF5,
+  0x00, 0x00, 0x0A, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x58, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x9D, 0x24, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xAE, 0xFE, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x49, 0xFF, 0x50, 0x00, 0x00, 0x1F, 0xFE, 0x04,
+  0xFF, 0xB0, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0xEF, 0xF2, 0x00, 0x00, 0xCF,
+  0xF4, 0x00, 0x9F, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x0E, 0xFF, 0x76, 0x66, 0x6A,
+  0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x00, 0x04, 0xFF, 0xE1, 0xBF, 0xF9, 0x00,
+  0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+  0xAF, 0xF9, 0x7F, 0xFF, 0x88, 0x88, 0x85, 0x00, 0x01, 0xFF, 0xF2, 0x4F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xB0, 0x4F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0x50, 0x4F, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x5F,
+  0xFD, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0xBF, 0xFB, 0x66, 0x9F,
+  0xFF, 0x88, 0x88, 0x82, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0xFF,
+  0x40, 0x00, 0x4F, 0xFF, 0x88, 0x88, 0x87, 0x6F, 0xFC, 0x00, 0x00, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xCF, 0xF6, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x00, 0x00, 0x5A, 0xDF, 0xEC, 0x82, 0x00, 0x2C, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x01, 0xDF, 0xFF, 0xB7, 0x79, 0xEC, 0x07, 0xFF, 0xF6, 0x00, 0x00,
+  0x04, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x00,
+  0x04, 0x01, 0xDF, 0xFF, 0xB7, 0x79, 0xDC, 0x00, 0x2C, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x5B, 0xEF, 0xFC, 0x82, 0x00, 0x00, 0x00, 0x07, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, 0x05, 0x58, 0xF4,
+  0x00, 0x00, 0x00, 0x07, 0xEE, 0xA0, 0x00, 0x00, 0x58, 0x50, 0x00, 0x00,
+  0x00, 0x1A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F,
+  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88, 0x86, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x06, 0x84,
+  0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x01, 0x75, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F, 0xFE, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82, 0x6F, 0xFE, 0x00, 0x00,
+  0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88, 0x86, 0x6F,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x05, 0x88,
+  0x40, 0x00, 0x00, 0x5F, 0x9A, 0xF4, 0x00, 0x01, 0x74, 0x00, 0x57, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F, 0xFE, 0x00, 0x00,
+  0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F,
+  0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82, 0x6F, 0xFE, 0x00,
+  0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88, 0x86,
+  0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x22,
+  0x11, 0x21, 0x00, 0x00, 0xBF, 0x45, 0xFA, 0x00, 0x00, 0xBF, 0x45, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0x88, 0x88, 0x85, 0x6F, 0xFE, 0x00,
+  0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x6F, 0xFF, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0x88, 0x88, 0x82, 0x6F, 0xFE,
+  0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x88, 0x88,
+  0x86, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFF, 0xFF, 0xFB, 0x48,
+  0x60, 0x00, 0x9F, 0x70, 0x00, 0x57, 0x10, 0x00, 0x00, 0x06, 0xFF, 0xE0,
+  0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE,
+  0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF,
+  0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x00, 0x58, 0x50, 0x5F, 0xA1, 0x07,
+  0x60, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06,
+  0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0,
+  0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE, 0x06, 0xFF, 0xE0, 0x6F, 0xFE,
+  0x00, 0x02, 0x88, 0x60, 0x02, 0xDC, 0x7F, 0x80, 0x56, 0x00, 0x38, 0x20,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x00, 0x06, 0xFF,
+  0xE0, 0x00, 0x6F, 0xFE, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x00,
+  0x06, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x6F,
+  0xFE, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x00, 0x06, 0xFF, 0xE0,
+  0x00, 0x12, 0x10, 0x22, 0x7F, 0x91, 0xFF, 0x7F, 0x91, 0xFF, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF,
+  0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF,
+  0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF, 0xE0, 0x06, 0xFF,
+  0xE0, 0x06, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0xC9, 0x30, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xF9, 0x8A, 0xEF, 0xFF,
+  0x90, 0x03, 0xFF, 0xF1, 0x00, 0x1B, 0xFF, 0xF3, 0x03, 0xFF, 0xF1, 0x00,
+  0x01, 0xEF, 0xF9, 0xBF, 0xFF, 0xFF, 0xF2, 0x00, 0xAF, 0xFC, 0xBF, 0xFF,
+  0xFF, 0xF2, 0x00, 0x9F, 0xFD, 0x36, 0xFF, 0xF5, 0x40, 0x00, 0xAF, 0xFC,
+  0x03, 0xFF, 0xF1, 0x00, 0x01, 0xEF, 0xF9, 0x03, 0xFF, 0xF1, 0x00, 0x1A,
+  0xFF, 0xF3, 0x03, 0xFF, 0xF9, 0x8A, 0xEF, 0xFF, 0x90, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xC9, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xD5, 0x5F, 0x00, 0x00,
+  0x00, 0x0D, 0x97, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x31, 0x01, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
+  0xFF, 0xF2, 0x6F, 0xFF, 0xF2, 0x00, 0x0F, 0xFF, 0x26, 0xFF, 0xFF, 0x90,
+  0x00, 0xFF, 0xF2, 0x6F, 0xFF, 0xFF, 0x20, 0x0F, 0xFF, 0x26, 0xFF, 0xDE,
+  0xFA, 0x00, 0xFF, 0xF2, 0x6F, 0xFC, 0x7F, 0xF3, 0x0F, 0xFF, 0x26, 0xFF,
+  0xC1, 0xEF, 0xB0, 0xFF, 0xF2, 0x6F, 0xFC, 0x07, 0xFF, 0x4F, 0xFF, 0x26,
+  0xFF, 0xC0, 0x0D, 0xFC, 0xFF, 0xF2, 0x6F, 0xFC, 0x00, 0x6F, 0xFF, 0xFF,
+  0x26, 0xFF, 0xC0, 0x00, 0xDF, 0xFF, 0xF2, 0x6F, 0xFC, 0x00, 0x05, 0xFF,
+  0xFF, 0x26, 0xFF, 0xC0, 0x00, 0x0C, 0xFF, 0xF2, 0x00, 0x00, 0x3E, 0xF3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x03, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x01, 0xDF, 0xFE, 0x97, 0x9F, 0xFF, 0xD1,
+  0x00, 0x8F, 0xFF, 0x30, 0x00, 0x4F, 0xFF, 0x80, 0x0D, 0xFF, 0xA0, 0x00,
+  0x00, 0xAF, 0xFD, 0x01, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x2F,
+  0xFF, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0x11, 0xFF, 0xF6, 0x00, 0x00, 0x07,
+  0xFF, 0xF0, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x8F, 0xFF,
+  0x30, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xEF, 0xFE, 0x97, 0x9E, 0xFF, 0xD1,
+  0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x01, 0x7C, 0xEF,
+  0xEB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x7B, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2,
+  0x00, 0x01, 0xDF, 0xFE, 0x97, 0x9F, 0xFF, 0xD1, 0x00, 0x8F, 0xFF, 0x30,
+  0x00, 0x4F, 0xFF, 0x80, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x01,
+  0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x50, 0x00, 0x00,
+  0x5F, 0xFF, 0x11, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0D, 0xFF,
+  0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x3F, 0xFF,
+  0x80, 0x01, 0xEF, 0xFE, 0x97, 0x9E, 0xFF, 0xD1, 0x00, 0x03, 0xDF, 0xFF,
+  0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x4E,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x28, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xEB, 0x71,
+  0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x01, 0xDF, 0xFE,
+  0x97, 0x9F, 0xFF, 0xD1, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x4F, 0xFF, 0x80,
+  0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x01, 0xFF, 0xF6, 0x00, 0x00,
+  0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0x11, 0xFF,
+  0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF,
+  0xFD, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xEF, 0xFE,
+  0x97, 0x9E, 0xFF, 0xD1, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00,
+  0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF9,
+  0x2D, 0x60, 0x00, 0x00, 0x00, 0x06, 0xE5, 0xCF, 0xE2, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x03, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x01, 0xDF, 0xFE, 0x97, 0x9F, 0xFF, 0xD1,
+  0x00, 0x8F, 0xFF, 0x30, 0x00, 0x4F, 0xFF, 0x80, 0x0D, 0xFF, 0xA0, 0x00,
+  0x00, 0xAF, 0xFD, 0x01, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x2F,
+  0xFF, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0x11, 0xFF, 0xF6, 0x00, 0x00, 0x07,
+  0xFF, 0xF0, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x8F, 0xFF,
+  0x30, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xEF, 0xFE, 0x97, 0x9E, 0xFF, 0xD1,
+  0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x01, 0x7C, 0xEF,
+  0xEB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xCF, 0x30, 0x00, 0x00,
+  0x00, 0x03, 0xFC, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x7B, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xD2,
+  0x00, 0x01, 0xDF, 0xFE, 0x97, 0x9F, 0xFF, 0xD1, 0x00, 0x8F, 0xFF, 0x30,
+  0x00, 0x4F, 0xFF, 0x80, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x01,
+  0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x50, 0x00, 0x00,
+  0x5F, 0xFF, 0x11, 0xFF, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0D, 0xFF,
+  0xA0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x3F, 0xFF,
+  0x80, 0x01, 0xEF, 0xFE, 0x97, 0x9E, 0xFF, 0xD1, 0x00, 0x03, 0xDF, 0xFF,
+  0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00, 0x00,
+  0x08, 0x20, 0x00, 0x00, 0x46, 0x08, 0xFD, 0x20, 0x00, 0x4E, 0xF4, 0x1D,
+  0xFD, 0x20, 0x3E, 0xFA, 0x00, 0x1D, 0xFD, 0x5E, 0xFA, 0x00, 0x00, 0x2D,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x00, 0x00, 0x3E, 0xFF,
+  0xFC, 0x10, 0x00, 0x3E, 0xFB, 0x2D, 0xFC, 0x10, 0x3E, 0xFB, 0x10, 0x2D,
+  0xFC, 0x17, 0xFB, 0x10, 0x00, 0x2D, 0xF4, 0x05, 0x10, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x17, 0xBE,
+  0xFE, 0xB6, 0x06, 0xF4, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0x00,
+  0x1D, 0xFF, 0xE9, 0x7A, 0xFF, 0xFE, 0x10, 0x08, 0xFF, 0xF3, 0x00, 0x08,
+  0xFF, 0xF7, 0x00, 0xDF, 0xFA, 0x00, 0x06, 0xFD, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x60, 0x07, 0xF7, 0x6F, 0xFF, 0x02, 0xFF, 0xF5, 0x08, 0xF6, 0x05, 0xFF,
+  0xF1, 0x1F, 0xFF, 0x68, 0xF6, 0x00, 0x7F, 0xFF, 0x00, 0xDF, 0xFE, 0xF5,
+  0x00, 0x0A, 0xFF, 0xD0, 0x08, 0xFF, 0xF7, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+  0x1F, 0xFF, 0xE9, 0x79, 0xEF, 0xFD, 0x10, 0x0A, 0xED, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x20, 0x05, 0xF4, 0x16, 0xBE, 0xFE, 0xB7, 0x10, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x5F, 0xFF, 0x00, 0x00, 0xBF, 0xF9,
+  0x2F, 0xFF, 0x50, 0x01, 0xEF, 0xF7, 0x0C, 0xFF, 0xE9, 0x8D, 0xFF, 0xF2,
+  0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x29, 0xDE, 0xFD, 0xA4, 0x00,
+  0x00, 0x00, 0x01, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x5F, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x2F, 0xFF, 0x50, 0x01, 0xEF, 0xF7,
+  0x0C, 0xFF, 0xE9, 0x8D, 0xFF, 0xF2, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x29, 0xDE, 0xFD, 0xA4, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x10, 0x00,
+  0x00, 0x05, 0xF8, 0x4E, 0xA0, 0x00, 0x00, 0x07, 0x50, 0x03, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x5F, 0xFF, 0x00, 0x00, 0xBF, 0xF9,
+  0x2F, 0xFF, 0x50, 0x01, 0xEF, 0xF7, 0x0C, 0xFF, 0xE9, 0x8D, 0xFF, 0xF2,
+  0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x29, 0xDE, 0xFD, 0xA4, 0x00,
+  0x00, 0x08, 0xF7, 0x2F, 0xD0, 0x00, 0x00, 0x08, 0xF7, 0x2F, 0xD0, 0x00,
+  0x00, 0x01, 0x21, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0x9F, 0xFA,
+  0x5F, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x2F, 0xFF, 0x50, 0x01, 0xEF, 0xF7,
+  0x0C, 0xFF, 0xE9, 0x8D, 0xFF, 0xF2, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x29, 0xDE, 0xFD, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x58, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0x00, 0x00,
+  0x1E, 0xFF, 0x93, 0xFF, 0xF6, 0x00, 0x0A, 0xFF, 0xD1, 0x08, 0xFF, 0xE1,
+  0x04, 0xFF, 0xF5, 0x00, 0x1D, 0xFF, 0xA1, 0xDF, 0xFA, 0x00, 0x00, 0x4F,
+  0xFF, 0xBF, 0xFE, 0x10, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x01, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFD, 0x92, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x6F, 0xFE, 0x66,
+  0x9F, 0xFF, 0xC0, 0x6F, 0xFE, 0x00, 0x07, 0xFF, 0xF1, 0x6F, 0xFE, 0x00,
+  0x04, 0xFF, 0xF2, 0x6F, 0xFE, 0x00, 0x07, 0xFF, 0xF1, 0x6F, 0xFF, 0x77,
+  0x9F, 0xFF, 0xC0, 0x6F, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x6F, 0xFF, 0xFF,
+  0xFD, 0x92, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xD9, 0x20, 0x00, 0xCF, 0xFF, 0xFF,
+  0xFD, 0x10, 0x4F, 0xFE, 0x42, 0x8F, 0xF7, 0x07, 0xFF, 0xA0, 0x04, 0xFF,
+  0xA0, 0x8F, 0xF8, 0x09, 0xFF, 0xB6, 0x08, 0xFF, 0x85, 0xFF, 0x50, 0x00,
+  0x8F, 0xF8, 0x7F, 0xF7, 0x00, 0x08, 0xFF, 0x85, 0xFF, 0xFB, 0x20, 0x8F,
+  0xF8, 0x09, 0xFF, 0xFE, 0x38, 0xFF, 0x80, 0x04, 0xDF, 0xFA, 0x8F, 0xF8,
+  0x00, 0x03, 0xFF, 0xD8, 0xFF, 0x83, 0x42, 0x8F, 0xFB, 0x8F, 0xF8, 0x7F,
+  0xFF, 0xFF, 0x68, 0xFF, 0x85, 0xEF, 0xEC, 0x60, 0x00, 0x28, 0x71, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x57, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3A, 0xDE, 0xFE, 0xC7, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x36,
+  0x32, 0x23, 0xDF, 0xF3, 0x00, 0x5A, 0xCD, 0xDE, 0xFF, 0x70, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x51, 0x09, 0xFF, 0x83, 0xFF, 0xE0, 0x00,
+  0xCF, 0xF8, 0x2F, 0xFF, 0x52, 0x8F, 0xFF, 0x80, 0xAF, 0xFF, 0xFF, 0xCF,
+  0xF8, 0x01, 0x9D, 0xEC, 0x49, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00,
+  0x00, 0x01, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A,
+  0xDE, 0xFE, 0xC7, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x36, 0x32,
+  0x23, 0xDF, 0xF3, 0x00, 0x5A, 0xCD, 0xDE, 0xFF, 0x70, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0x51, 0x09, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0xCF,
+  0xF8, 0x2F, 0xFF, 0x52, 0x8F, 0xFF, 0x80, 0xAF, 0xFF, 0xFF, 0xCF, 0xF8,
+  0x01, 0x9D, 0xEC, 0x49, 0xFF, 0x80, 0x00, 0x00, 0x28, 0x82, 0x00, 0x00,
+  0x00, 0x0B, 0xEE, 0xB0, 0x00, 0x00, 0x08, 0xF4, 0x4F, 0x80, 0x00, 0x01,
+  0x74, 0x00, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xDE,
+  0xFE, 0xC7, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x36, 0x32, 0x23,
+  0xDF, 0xF3, 0x00, 0x5A, 0xCD, 0xDE, 0xFF, 0x70, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x1F, 0xFF, 0x51, 0x09, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0xCF, 0xF8,
+  0x2F, 0xFF, 0x52, 0x8F, 0xFF, 0x80, 0xAF, 0xFF, 0xFF, 0xCF, 0xF8, 0x01,
+  0x9D, 0xEC, 0x49, 0xFF, 0x80, 0x00, 0x06, 0xEC, 0x45, 0xE0, 0x00, 0x00,
+  0xDA, 0x9F, 0xF9, 0x00, 0x00, 0x04, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xAD, 0xEF, 0xEC, 0x70, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xB0, 0x03, 0x63, 0x22, 0x3D, 0xFF, 0x30, 0x05, 0xAC, 0xDD, 0xEF,
+  0xF7, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xF5, 0x10, 0x9F, 0xF8,
+  0x3F, 0xFE, 0x00, 0x0C, 0xFF, 0x82, 0xFF, 0xF5, 0x28, 0xFF, 0xF8, 0x0A,
+  0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x19, 0xDE, 0xC4, 0x9F, 0xF8, 0x00, 0x0B,
+  0xF5, 0x4F, 0xB0, 0x00, 0x00, 0xBF, 0x54, 0xFB, 0x00, 0x00, 0x01, 0x21,
+  0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAD, 0xEF, 0xEC,
+  0x70, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xB0, 0x03, 0x63, 0x22, 0x3D, 0xFF,
+  0x30, 0x05, 0xAC, 0xDD, 0xEF, 0xF7, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
+  0xFF, 0xF5, 0x10, 0x9F, 0xF8, 0x3F, 0xFE, 0x00, 0x0C, 0xFF, 0x82, 0xFF,
+  0xF5, 0x28, 0xFF, 0xF8, 0x0A, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x19, 0xDE,
+  0xC4, 0x9F, 0xF8, 0x00, 0x00, 0x7E, 0xE6, 0x00, 0x00, 0x00, 0x3F, 0x77,
+  0xF3, 0x00, 0x00, 0x06, 0xE0, 0x0E, 0x60, 0x00, 0x00, 0x4F, 0x44, 0xF4,
+  0x00, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+  0x03, 0xAD, 0xEF, 0xEC, 0x70, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xB0, 0x03,
+  0x63, 0x22, 0x3D, 0xFF, 0x30, 0x05, 0xAC, 0xDD, 0xEF, 0xF7, 0x08, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xF5, 0x10, 0x9F, 0xF8, 0x3F, 0xFE, 0x00,
+  0x0C, 0xFF, 0x82, 0xFF, 0xF5, 0x28, 0xFF, 0xF8, 0x0A, 0xFF, 0xFF, 0xFC,
+  0xFF, 0x80, 0x19, 0xDE, 0xC4, 0x9F, 0xF8, 0x03, 0xAD, 0xEF, 0xEA, 0x31,
+  0x8D, 0xFE, 0xA3, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+  0x50, 0x03, 0x63, 0x22, 0x3D, 0xFF, 0xF6, 0x25, 0xFF, 0xE1, 0x00, 0x5A,
+  0xCD, 0xDE, 0xFF, 0x90, 0x00, 0xAF, 0xF6, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF9, 0x1F, 0xFF, 0x51, 0x09, 0xFF, 0xEE, 0xEE, 0xEE,
+  0xE9, 0x3F, 0xFE, 0x00, 0x0C, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+  0x52, 0x8F, 0xFF, 0xF7, 0x22, 0x37, 0xD3, 0x0A, 0xFF, 0xFF, 0xFD, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF3, 0x01, 0x8D, 0xFD, 0x81, 0x03, 0xAD, 0xFE, 0xDA,
+  0x50, 0x00, 0x17, 0xCE, 0xFD, 0xA2, 0x01, 0xCF, 0xFF, 0xFF, 0xF4, 0x0A,
+  0xFF, 0xE7, 0x45, 0xA4, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0x10,
+  0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00,
+  0x0A, 0xFF, 0xE7, 0x45, 0xA4, 0x01, 0xDF, 0xFF, 0xFF, 0xF4, 0x00, 0x17,
+  0xCF, 0xFD, 0xA2, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB9,
+  0x00, 0x00, 0x01, 0x75, 0xEA, 0x00, 0x00, 0x02, 0xDF, 0xD3, 0x00, 0x00,
+  0x17, 0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x4E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFC, 0x70, 0x00, 0x01,
+  0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xB3, 0x2B, 0xFF, 0x80, 0x1F,
+  0xFF, 0x10, 0x02, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F,
+  0xFF, 0xEE, 0xEE, 0xEE, 0xE1, 0x1F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xC4, 0x22, 0x5A, 0x90, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+  0x17, 0xCE, 0xFD, 0xB7, 0x20, 0x00, 0x00, 0x00, 0x06, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xB1, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x10, 0x00, 0x00,
+  0x00, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xCE, 0xFC, 0x70, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A,
+  0xFF, 0xB3, 0x2B, 0xFF, 0x80, 0x1F, 0xFF, 0x10, 0x02, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F, 0xFF, 0xEE, 0xEE, 0xEE, 0xE1, 0x1F,
+  0xFF, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC4, 0x22, 0x5A, 0x90, 0x01,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x17, 0xCE, 0xFD, 0xB7, 0x20, 0x00,
+  0x00, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xEE, 0x20, 0x00, 0x00,
+  0x04, 0xF8, 0x2D, 0xB0, 0x00, 0x00, 0x06, 0x60, 0x02, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFC, 0x70, 0x00, 0x01,
+  0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xB3, 0x2B, 0xFF, 0x80, 0x1F,
+  0xFF, 0x10, 0x02, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F,
+  0xFF, 0xEE, 0xEE, 0xEE, 0xE1, 0x1F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xC4, 0x22, 0x5A, 0x90, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+  0x17, 0xCE, 0xFD, 0xB7, 0x20, 0x00, 0x07, 0xF9, 0x0F, 0xF0, 0x00, 0x00,
+  0x07, 0xF9, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0x21, 0x02, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFC, 0x70, 0x00, 0x01,
+  0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xB3, 0x2B, 0xFF, 0x80, 0x1F,
+  0xFF, 0x10, 0x02, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F,
+  0xFF, 0xEE, 0xEE, 0xEE, 0xE1, 0x1F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xC4, 0x22, 0x5A, 0x90, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+  0x17, 0xCE, 0xFD, 0xB7, 0x20, 0x17, 0x82, 0x00, 0x07, 0xFB, 0x00, 0x00,
+  0x8F, 0x70, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00,
+  0x8F, 0xF8, 0x00, 0x06, 0x84, 0x00, 0x5F, 0xD1, 0x01, 0xED, 0x20, 0x0A,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F,
+  0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F,
+  0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+  0x18, 0x82, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x04, 0xF8, 0x8F, 0x50, 0x1D,
+  0xB0, 0x0A, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+  0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+  0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+  0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0xBF,
+  0x54, 0xFB, 0xBF, 0x54, 0xFB, 0x12, 0x11, 0x21, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08,
+  0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08, 0xFF, 0x80, 0x08,
+  0xFF, 0x80, 0x08, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x52, 0x7C, 0x30, 0x00,
+  0x01, 0xDF, 0xFF, 0xD8, 0x20, 0x00, 0x6B, 0xFF, 0xFE, 0x20, 0x00, 0x00,
+  0xD9, 0x43, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x23, 0x8F, 0xFA, 0x00, 0x00,
+  0x6D, 0xFF, 0xFF, 0xFF, 0x60, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1E,
+  0xFF, 0xA1, 0x15, 0xFF, 0xF3, 0x3F, 0xFF, 0x10, 0x00, 0xEF, 0xF5, 0x3F,
+  0xFF, 0x00, 0x00, 0xEF, 0xF4, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A,
+  0xFF, 0xD5, 0x5C, 0xFF, 0xB0, 0x02, 0xDF, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+  0x18, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x1C, 0xE8, 0x1D, 0x60, 0x00, 0x06,
+  0xE7, 0xDF, 0xE2, 0x00, 0x00, 0x23, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF8, 0x5C, 0xFE, 0x90, 0x08, 0xFF, 0xDF, 0xFF,
+  0xFF, 0x80, 0x8F, 0xFF, 0x93, 0x8F, 0xFE, 0x08, 0xFF, 0xD0, 0x00, 0xFF,
+  0xF1, 0x8F, 0xF9, 0x00, 0x0E, 0xFF, 0x38, 0xFF, 0x80, 0x00, 0xEF, 0xF3,
+  0x8F, 0xF8, 0x00, 0x0E, 0xFF, 0x38, 0xFF, 0x80, 0x00, 0xEF, 0xF3, 0x8F,
+  0xF8, 0x00, 0x0E, 0xFF, 0x38, 0xFF, 0x80, 0x00, 0xEF, 0xF3, 0x00, 0x17,
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x4E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x40, 0x02, 0xFF, 0xF2, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF,
+  0x00, 0x00, 0xEF, 0xF5, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF,
+  0xD5, 0x5C, 0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18,
+  0xCE, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xB1, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x0A, 0xFF,
+  0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x3F, 0xFF,
+  0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x1F, 0xFF,
+  0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x02, 0xDF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x00,
+  0x17, 0x82, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEC, 0x00, 0x00, 0x00, 0x07,
+  0xF5, 0x4E, 0x80, 0x00, 0x00, 0x07, 0x40, 0x04, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x40, 0x02, 0xFF, 0xF2, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF,
+  0x00, 0x00, 0xEF, 0xF5, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF,
+  0xD5, 0x5C, 0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18,
+  0xCE, 0xFD, 0x81, 0x00, 0x00, 0x05, 0xEC, 0x45, 0xF0, 0x00, 0x00, 0x0D,
+  0xA9, 0xFF, 0xA0, 0x00, 0x00, 0x04, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x40, 0x02, 0xFF, 0xF2, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF,
+  0x00, 0x00, 0xEF, 0xF5, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF,
+  0xD5, 0x5C, 0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18,
+  0xCE, 0xFD, 0x81, 0x00, 0x00, 0x0A, 0xF5, 0x4F, 0xB0, 0x00, 0x00, 0x0A,
+  0xF5, 0x4F, 0xB0, 0x00, 0x00, 0x01, 0x21, 0x12, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xFD, 0x81, 0x00, 0x01, 0xDF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x0A, 0xFF, 0xD5, 0x5C, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x40, 0x02, 0xFF, 0xF2, 0x3F, 0xFF, 0x00, 0x00, 0xEF, 0xF5, 0x3F, 0xFF,
+  0x00, 0x00, 0xEF, 0xF5, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF2, 0x0A, 0xFF,
+  0xD5, 0x5C, 0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x18,
+  0xCE, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x0A, 0xA7, 0x00, 0x00, 0x00, 0x00,
+  0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x0A, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x18,
+  0xCE, 0xEC, 0x79, 0xE2, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0x60, 0x0A, 0xFF,
+  0xD5, 0x5D, 0xFF, 0xB0, 0x1F, 0xFF, 0x40, 0x6F, 0xFF, 0xF2, 0x3F, 0xFF,
+  0x06, 0xF6, 0xDF, 0xF5, 0x3F, 0xFF, 0x5F, 0x60, 0xEF, 0xF5, 0x1F, 0xFF,
+  0xF7, 0x02, 0xFF, 0xF2, 0x0A, 0xFF, 0xE5, 0x5C, 0xFF, 0xC0, 0x05, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x20, 0x2E, 0xA7, 0xCE, 0xFD, 0x81, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x40, 0x00, 0x00, 0x00, 0x02, 0xDE,
+  0x30, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x02, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0xFF,
+  0xF1, 0x9F, 0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1,
+  0x9F, 0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F,
+  0xF7, 0x00, 0x1F, 0xFF, 0x18, 0xFF, 0x90, 0x06, 0xFF, 0xF1, 0x6F, 0xFE,
+  0x77, 0xEF, 0xFF, 0x11, 0xEF, 0xFF, 0xFC, 0xFF, 0xF1, 0x03, 0xCF, 0xE9,
+  0x1F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x48, 0x60, 0x00, 0x00, 0x00, 0x3E,
+  0xD2, 0x00, 0x00, 0x00, 0x1D, 0xD2, 0x00, 0x00, 0x00, 0x04, 0x71, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0xFF, 0xF1,
+  0x9F, 0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F,
+  0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7,
+  0x00, 0x1F, 0xFF, 0x18, 0xFF, 0x90, 0x06, 0xFF, 0xF1, 0x6F, 0xFE, 0x77,
+  0xEF, 0xFF, 0x11, 0xEF, 0xFF, 0xFC, 0xFF, 0xF1, 0x03, 0xCF, 0xE9, 0x1F,
+  0xFF, 0x10, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xEE, 0x10,
+  0x00, 0x00, 0x4F, 0x72, 0xDB, 0x00, 0x00, 0x06, 0x60, 0x02, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F,
+  0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7,
+  0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7, 0x00,
+  0x1F, 0xFF, 0x18, 0xFF, 0x90, 0x06, 0xFF, 0xF1, 0x6F, 0xFE, 0x77, 0xEF,
+  0xFF, 0x11, 0xEF, 0xFF, 0xFC, 0xFF, 0xF1, 0x03, 0xCF, 0xE9, 0x1F, 0xFF,
+  0x10, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00,
+  0x00, 0x12, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xF7, 0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7,
+  0x00, 0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x00, 0xFF, 0xF1, 0x9F, 0xF7, 0x00,
+  0x0F, 0xFF, 0x19, 0xFF, 0x70, 0x01, 0xFF, 0xF1, 0x8F, 0xF9, 0x00, 0x6F,
+  0xFF, 0x16, 0xFF, 0xE7, 0x7E, 0xFF, 0xF1, 0x1E, 0xFF, 0xFF, 0xCF, 0xFF,
+  0x10, 0x3C, 0xFE, 0x91, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xB1, 0x00,
+  0x00, 0x00, 0x05, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x2E, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00, 0x01, 0xFF, 0xE1,
+  0x3F, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x40,
+  0x05, 0xFF, 0x90, 0x1F, 0xFD, 0x00, 0x00, 0xEF, 0xE1, 0x5F, 0xF8, 0x00,
+  0x00, 0x8F, 0xF6, 0xAF, 0xF2, 0x00, 0x00, 0x2F, 0xFC, 0xEF, 0xC0, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00,
+  0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0x00,
+  0x00, 0x13, 0xEF, 0xD0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x04, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x4C, 0xFE, 0x80, 0x08, 0xFF, 0xCF,
+  0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xA5, 0x8F, 0xFF, 0x58, 0xFF, 0xD0, 0x00,
+  0xAF, 0xFA, 0x8F, 0xF9, 0x00, 0x06, 0xFF, 0xC8, 0xFF, 0x90, 0x00, 0x6F,
+  0xFC, 0x8F, 0xFD, 0x00, 0x0A, 0xFF, 0xA8, 0xFF, 0xFA, 0x58, 0xFF, 0xF5,
+  0x8F, 0xFC, 0xFF, 0xFF, 0xFB, 0x08, 0xFF, 0x84, 0xCF, 0xE8, 0x10, 0x8F,
+  0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF8,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1,
+  0x8F, 0x70, 0x00, 0x00, 0x0F, 0xF1, 0x8F, 0x70, 0x00, 0x00, 0x02, 0x20,
+  0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00,
+  0x01, 0xFF, 0xE1, 0x3F, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0x40,
+  0x0B, 0xFF, 0x40, 0x05, 0xFF, 0x90, 0x1F, 0xFD, 0x00, 0x00, 0xEF, 0xE1,
+  0x5F, 0xF8, 0x00, 0x00, 0x8F, 0xF6, 0xAF, 0xF2, 0x00, 0x00, 0x2F, 0xFC,
+  0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x10, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xF4, 0x00, 0x00, 0x00, 0x13, 0xEF, 0xD0, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x50, 0x00, 0x00, 0x04, 0xFF, 0xD6, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Bold9pt8bAa4Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   4,  13,   8,    2,  -13 },   // 0x21 '!'
+  {    26,   7,   5,   9,    1,  -13 },   // 0x22 '"'
+  {    44,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {   129,  10,  17,  12,    1,  -14 },   // 0x24 '$'
+  {   214,  18,  13,  18,    0,  -13 },   // 0x25 '%'
+  {   331,  14,  13,  15,    1,  -13 },   // 0x26 '&'
+  {   422,   3,   5,   5,    1,  -13 },   // 0x27 '''
+  {   430,   6,  16,   8,    1,  -14 },   // 0x28 '('
+  {   478,   6,  16,   8,    1,  -14 },   // 0x29 ')'
+  {   526,   9,   9,   9,    0,  -13 },   // 0x2A '*'
+  {   567,  12,  12,  15,    1,  -12 },   // 0x2B '+'
+  {   639,   4,   6,   7,    1,   -3 },   // 0x2C ','
+  {   651,   7,   3,   7,    0,   -7 },   // 0x2D '-'
+  {   662,   4,   4,   7,    1,   -4 },   // 0x2E '.'
+  {   670,   7,  15,   6,    0,  -13 },   // 0x2F '/'
+  {   723,  12,  13,  12,    0,  -13 },   // 0x30 '0'
+  {   801,  10,  13,  12,    2,  -13 },   // 0x31 '1'
+  {   866,  10,  13,  12,    1,  -13 },   // 0x32 '2'
+  {   931,  10,  13,  12,    1,  -13 },   // 0x33 '3'
+  {   996,  12,  13,  12,    0,  -13 },   // 0x34 '4'
+  {  1074,  10,  13,  12,    1,  -13 },   // 0x35 '5'
+  {  1139,  11,  13,  12,    1,  -13 },   // 0x36 '6'
+  {  1211,  10,  13,  12,    1,  -13 },   // 0x37 '7'
+  {  1276,  11,  13,  12,    1,  -13 },   // 0x38 '8'
+  {  1348,  12,  13,  12,    0,  -13 },   // 0x39 '9'
+  {  1426,   4,  10,   7,    2,  -10 },   // 0x3A ':'
+  {  1446,   5,  12,   7,    1,  -10 },   // 0x3B ';'
+  {  1476,  12,  11,  15,    1,  -11 },   // 0x3C '<'
+  {  1542,  12,   6,  15,    1,   -9 },   // 0x3D '='
+  {  1578,  12,  11,  15,    1,  -11 },   // 0x3E '>'
+  {  1644,   9,  13,  10,    1,  -13 },   // 0x3F '?'
+  {  1703,  16,  16,  18,    1,  -13 },   // 0x40 '@'
+  {  1831,  14,  13,  14,    0,  -13 },   // 0x41 'A'
+  {  1922,  12,  13,  13,    1,  -13 },   // 0x42 'B'
+  {  2000,  12,  13,  13,    0,  -13 },   // 0x43 'C'
+  {  2078,  13,  13,  15,    1,  -13 },   // 0x44 'D'
+  {  2163,  10,  13,  12,    1,  -13 },   // 0x45 'E'
+  {  2228,  10,  13,  12,    1,  -13 },   // 0x46 'F'
+  {  2293,  14,  13,  14,    0,  -13 },   // 0x47 'G'
+  {  2384,  13,  13,  15,    1,  -13 },   // 0x48 'H'
+  {  2469,   4,  13,   7,    1,  -13 },   // 0x49 'I'
+  {  2495,   6,  17,   7,   -1,  -13 },   // 0x4A 'J'
+  {  2546,  13,  13,  14,    1,  -13 },   // 0x4B 'K'
+  {  2631,  10,  13,  11,    1,  -13 },   // 0x4C 'L'
+  {  2696,  15,  13,  18,    1,  -13 },   // 0x4D 'M'
+  {  2794,  13,  13,  15,    1,  -13 },   // 0x4E 'N'
+  {  2879,  15,  13,  15,    0,  -13 },   // 0x4F 'O'
+  {  2977,  12,  13,  13,    1,  -13 },   // 0x50 'P'
+  {  3055,  15,  16,  15,    0,  -13 },   // 0x51 'Q'
+  {  3175,  13,  13,  14,    1,  -13 },   // 0x52 'R'
+  {  3260,  11,  13,  13,    1,  -13 },   // 0x53 'S'
+  {  3332,  12,  13,  12,    0,  -13 },   // 0x54 'T'
+  {  3410,  12,  13,  14,    1,  -13 },   // 0x55 'U'
+  {  3488,  14,  13,  14,    0,  -13 },   // 0x56 'V'
+  {  3579,  19,  13,  19,    0,  -13 },   // 0x57 'W'
+  {  3703,  14,  13,  14,    0,  -13 },   // 0x58 'X'
+  {  3794,  13,  13,  13,    0,  -13 },   // 0x59 'Y'
+  {  3879,  12,  13,  13,    0,  -13 },   // 0x5A 'Z'
+  {  3957,   6,  16,   8,    1,  -14 },   // 0x5B '['
+  {  4005,   7,  15,   6,    0,  -13 },   // 0x5C '\'
+  {  4058,   6,  16,   8,    1,  -14 },   // 0x5D ']'
+  {  4106,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  4134,   9,   2,   9,    0,    2 },   // 0x5F '_'
+  {  4143,   5,   4,   9,    1,  -15 },   // 0x60 '`'
+  {  4153,  11,  10,  12,    0,  -10 },   // 0x61 'a'
+  {  4208,  11,  14,  13,    1,  -14 },   // 0x62 'b'
+  {  4285,  10,  10,  10,    0,  -10 },   // 0x63 'c'
+  {  4335,  12,  14,  13,    0,  -14 },   // 0x64 'd'
+  {  4419,  12,  10,  12,    0,  -10 },   // 0x65 'e'
+  {  4479,   8,  14,   8,    0,  -14 },   // 0x66 'f'
+  {  4535,  12,  14,  13,    0,  -10 },   // 0x67 'g'
+  {  4619,  11,  14,  13,    1,  -14 },   // 0x68 'h'
+  {  4696,   4,  14,   6,    1,  -14 },   // 0x69 'i'
+  {  4724,   6,  18,   6,   -1,  -14 },   // 0x6A 'j'
+  {  4778,  11,  14,  12,    1,  -14 },   // 0x6B 'k'
+  {  4855,   4,  14,   6,    1,  -14 },   // 0x6C 'l'
+  {  4883,  16,  10,  18,    1,  -10 },   // 0x6D 'm'
+  {  4963,  11,  10,  13,    1,  -10 },   // 0x6E 'n'
+  {  5018,  12,  10,  12,    0,  -10 },   // 0x6F 'o'
+  {  5078,  11,  14,  13,    1,  -10 },   // 0x70 'p'
+  {  5155,  12,  14,  13,    0,  -10 },   // 0x71 'q'
+  {  5239,   8,  11,   9,    1,  -11 },   // 0x72 'r'
+  {  5283,  10,  10,  10,    0,  -10 },   // 0x73 's'
+  {  5333,   8,  13,   8,    0,  -13 },   // 0x74 't'
+  {  5385,  11,  10,  13,    1,  -10 },   // 0x75 'u'
+  {  5440,  12,  10,  11,    0,  -10 },   // 0x76 'v'
+  {  5500,  16,  10,  16,    0,  -10 },   // 0x77 'w'
+  {  5580,  11,  10,  11,    0,  -10 },   // 0x78 'x'
+  {  5635,  12,  14,  11,    0,  -10 },   // 0x79 'y'
+  {  5719,  10,  10,  10,    0,  -10 },   // 0x7A 'z'
+  {  5769,   9,  16,  13,    2,  -14 },   // 0x7B '{'
+  {  5841,   3,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  5868,   9,  16,  13,    2,  -14 },   // 0x7D '}'
+  {  5940,  12,   4,  15,    1,   -8 },   // 0x7E '~'
+  {  5964,  10,  17,  11,    0,  -13 },   // 0x7F
+  {  6049,  10,  17,  11,    0,  -13 },   // 0x80
+  {  6134,  10,  17,  11,    0,  -13 },   // 0x81
+  {  6219,  10,  17,  11,    0,  -13 },   // 0x82
+  {  6304,  10,  17,  11,    0,  -13 },   // 0x83
+  {  6389,  10,  17,  11,    0,  -13 },   // 0x84
+  {  6474,  10,  17,  11,    0,  -13 },   // 0x85
+  {  6559,  10,  17,  11,    0,  -13 },   // 0x86
+  {  6644,  10,  17,  11,    0,  -13 },   // 0x87
+  {  6729,  10,  17,  11,    0,  -13 },   // 0x88
+  {  6814,  10,  17,  11,    0,  -13 },   // 0x89
+  {  6899,  10,  17,  11,    0,  -13 },   // 0x8A
+  {  6984,  10,  17,  11,    0,  -13 },   // 0x8B
+  {  7069,  10,  17,  11,    0,  -13 },   // 0x8C
+  {  7154,  10,  17,  11,    0,  -13 },   // 0x8D
+  {  7239,  10,  17,  11,    0,  -13 },   // 0x8E
+  {  7324,  10,  17,  11,    0,  -13 },   // 0x8F
+  {  7409,  10,  17,  11,    0,  -13 },   // 0x90
+  {  7494,  10,  17,  11,    0,  -13 },   // 0x91
+  {  7579,  10,  17,  11,    0,  -13 },   // 0x92
+  {  7664,  10,  17,  11,    0,  -13 },   // 0x93
+  {  7749,  10,  17,  11,    0,  -13 },   // 0x94
+  {  7834,  10,  17,  11,    0,  -13 },   // 0x95
+  {  7919,  10,  17,  11,    0,  -13 },   // 0x96
+  {  8004,  10,  17,  11,    0,  -13 },   // 0x97
+  {  8089,  10,  17,  11,    0,  -13 },   // 0x98
+  {  8174,  10,  17,  11,    0,  -13 },   // 0x99
+  {  8259,  10,  17,  11,    0,  -13 },   // 0x9A
+  {  8344,  10,  17,  11,    0,  -13 },   // 0x9B
+  {  8429,  10,  17,  11,    0,  -13 },   // 0x9C
+  {  8514,  10,  17,  11,    0,  -13 },   // 0x9D
+  {  8599,  10,  17,  11,    0,  -13 },   // 0x9E
+  {  8684,  10,  17,  11,    0,  -13 },   // 0x9F
+  {  8769,   0,   0,   6,    0,    1 },   // 0xA0
+  {  8769,   4,  13,   8,    2,  -10 },   // 0xA1
+  {  8795,   9,  16,  12,    1,  -13 },   // 0xA2
+  {  8867,  10,  13,  12,    1,  -13 },   // 0xA3
+  {  8932,  11,  11,  11,    0,  -11 },   // 0xA4
+  {  8993,  12,  13,  12,    0,  -13 },   // 0xA5
+  {  9071,   3,  16,   6,    2,  -13 },   // 0xA6
+  {  9095,   9,  15,   9,    0,  -13 },   // 0xA7
+  {  9163,   7,   3,   9,    1,  -15 },   // 0xA8
+  {  9174,  14,  15,  18,    2,  -14 },   // 0xA9
+  {  9279,   8,  10,  10,    1,  -13 },   // 0xAA
+  {  9319,   9,   9,  11,    1,  -10 },   // 0xAB
+  {  9360,  12,   7,  15,    1,   -9 },   // 0xAC
+  {  9402,   7,   3,   7,    0,   -7 },   // 0xAD
+  {  9413,  14,  15,  18,    2,  -14 },   // 0xAE
+  {  9518,   7,   2,   9,    1,  -14 },   // 0xAF
+  {  9525,   7,   7,   9,    1,  -14 },   // 0xB0
+  {  9550,  12,  12,  15,    1,  -12 },   // 0xB1
+  {  9622,   7,   7,   8,    0,  -13 },   // 0xB2
+  {  9647,   7,   7,   8,    0,  -13 },   // 0xB3
+  {  9672,   5,   4,   9,    3,  -15 },   // 0xB4
+  {  9682,  12,  14,  13,    1,  -10 },   // 0xB5
+  {  9766,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  9834,   4,   4,   7,    1,   -9 },   // 0xB7
+  {  9842,   5,   5,   9,    2,   -1 },   // 0xB8
+  {  9855,   6,   7,   8,    1,  -13 },   // 0xB9
+  {  9876,   8,  10,  10,    1,  -13 },   // 0xBA
+  {  9916,   9,   9,  11,    1,  -10 },   // 0xBB
+  {  9957,  17,  14,  18,    0,  -14 },   // 0xBC
+  { 10076,  18,  15,  18,    0,  -14 },   // 0xBD
+  { 10211,  17,  15,  18,    0,  -15 },   // 0xBE
+  { 10339,   9,  14,  10,    1,  -10 },   // 0xBF
+  { 10402,  14,  17,  14,    0,  -17 },   // 0xC0
+  { 10521,  14,  17,  14,    0,  -17 },   // 0xC1
+  { 10640,  14,  17,  14,    0,  -17 },   // 0xC2
+  { 10759,  14,  18,  14,    0,  -18 },   // 0xC3
+  { 10885,  14,  17,  14,    0,  -17 },   // 0xC4
+  { 11004,  14,  16,  14,    0,  -16 },   // 0xC5
+  { 11116,  18,  13,  19,    0,  -13 },   // 0xC6
+  { 11233,  12,  17,  13,    0,  -13 },   // 0xC7
+  { 11335,  10,  17,  12,    1,  -17 },   // 0xC8
+  { 11420,  10,  17,  12,    1,  -17 },   // 0xC9
+  { 11505,  10,  17,  12,    1,  -17 },   // 0xCA
+  { 11590,  10,  17,  12,    1,  -17 },   // 0xCB
+  { 11675,   5,  17,   7,    0,  -17 },   // 0xCC
+  { 11718,   5,  17,   7,    1,  -17 },   // 0xCD
+  { 11761,   7,  17,   7,    0,  -17 },   // 0xCE
+  { 11821,   6,  17,   7,    0,  -17 },   // 0xCF
+  { 11872,  14,  13,  15,    0,  -13 },   // 0xD0
+  { 11963,  13,  18,  15,    1,  -18 },   // 0xD1
+  { 12080,  15,  17,  15,    0,  -17 },   // 0xD2
+  { 12208,  15,  17,  15,    0,  -17 },   // 0xD3
+  { 12336,  15,  17,  15,    0,  -17 },   // 0xD4
+  { 12464,  15,  17,  15,    0,  -17 },   // 0xD5
+  { 12592,  15,  17,  15,    0,  -17 },   // 0xD6
+  { 12720,  11,  11,  15,    2,  -11 },   // 0xD7
+  { 12781,  15,  15,  15,    0,  -14 },   // 0xD8
+  { 12894,  12,  17,  14,    1,  -17 },   // 0xD9
+  { 12996,  12,  17,  14,    1,  -17 },   // 0xDA
+  { 13098,  12,  17,  14,    1,  -17 },   // 0xDB
+  { 13200,  12,  17,  14,    1,  -17 },   // 0xDC
+  { 13302,  13,  17,  13,    0,  -17 },   // 0xDD
+  { 13413,  12,  13,  13,    1,  -13 },   // 0xDE
+  { 13491,  11,  14,  13,    1,  -14 },   // 0xDF
+  { 13568,  11,  15,  12,    0,  -15 },   // 0xE0
+  { 13651,  11,  15,  12,    0,  -15 },   // 0xE1
+  { 13734,  11,  15,  12,    0,  -15 },   // 0xE2
+  { 13817,  11,  14,  12,    0,  -14 },   // 0xE3
+  { 13894,  11,  14,  12,    0,  -14 },   // 0xE4
+  { 13971,  11,  16,  12,    0,  -16 },   // 0xE5
+  { 14059,  18,  10,  18,    0,  -10 },   // 0xE6
+  { 14149,  10,  14,  10,    0,  -10 },   // 0xE7
+  { 14219,  12,  15,  12,    0,  -15 },   // 0xE8
+  { 14309,  12,  15,  12,    0,  -15 },   // 0xE9
+  { 14399,  12,  15,  12,    0,  -15 },   // 0xEA
+  { 14489,  12,  14,  12,    0,  -14 },   // 0xEB
+  { 14573,   6,  15,   6,   -1,  -15 },   // 0xEC
+  { 14618,   6,  15,   6,    1,  -15 },   // 0xED
+  { 14663,   8,  15,   6,   -1,  -15 },   // 0xEE
+  { 14723,   6,  14,   6,    0,  -14 },   // 0xEF
+  { 14765,  12,  14,  12,    0,  -14 },   // 0xF0
+  { 14849,  11,  14,  13,    1,  -14 },   // 0xF1
+  { 14926,  12,  15,  12,    0,  -15 },   // 0xF2
+  { 15016,  12,  15,  12,    0,  -15 },   // 0xF3
+  { 15106,  12,  15,  12,    0,  -15 },   // 0xF4
+  { 15196,  12,  14,  12,    0,  -14 },   // 0xF5
+  { 15280,  12,  14,  12,    0,  -14 },   // 0xF6
+  { 15364,  12,  10,  15,    1,  -11 },   // 0xF7
+  { 15424,  12,  12,  12,    0,  -11 },   // 0xF8
+  { 15496,  11,  15,  13,    1,  -15 },   // 0xF9
+  { 15579,  11,  15,  13,    1,  -15 },   // 0xFA
+  { 15662,  11,  15,  13,    1,  -15 },   // 0xFB
+  { 15745,  11,  14,  13,    1,  -14 },   // 0xFC
+  { 15822,  12,  18,  11,    0,  -14 },   // 0xFD
+  { 15930,  11,  18,  13,    1,  -14 },   // 0xFE
+  { 16029,  12,  18,  11,    0,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans_Bold9pt8bAa4 = {
+  DejaVuSans_Bold9pt8bAa4Bitmaps, DejaVuSans_Bold9pt8bAa4Glyphs, 0x20, 0xFF, 21, 4 };
+
+// Approx. 17713 bytes
+#endif // DEJAVUSANS_BOLD9PT8BAA4_H
@@ -0,0 +1,503 @@
+#ifndef DEJAVUSANS_BOLD9PT8B_RLE_H
+#define DEJAVUSANS_BOLD9PT8B_RLE_H
+// Police RLE (tools/font_rle.py, src/RleFont.h) : 3183 octets de plages, 3692 octets en bitmap 1 bpp
+#include "RleFont.h"
+const uint8_t DejaVuSans_Bold9pt8bRleRuns[] PROGMEM = {
+  0x1F, 0xFC, 0xFA, 0x09, 0x45, 0x14, 0x51, 0x20, 0xA9, 0x2E, 0x12, 0x59,
+  0x35, 0x93, 0x4F, 0xD3, 0xEB, 0x4D, 0x64, 0xD3, 0xF4, 0xFA, 0xD3, 0x59,
+  0x25, 0xC2, 0x48, 0x87, 0xA3, 0xC6, 0x7C, 0x96, 0x4B, 0x25, 0x93, 0x6D,
+  0xE6, 0x71, 0x74, 0x2A, 0x32, 0xBD, 0x5C, 0x63, 0xD1, 0xE8, 0x80, 0x36,
+  0xB6, 0x9A, 0x8A, 0x26, 0x9A, 0xA9, 0xA4, 0xEA, 0x69, 0x2C, 0x9A, 0x2B,
+  0x9A, 0x59, 0xBC, 0xA2, 0x9A, 0xC9, 0x26, 0xAB, 0x49, 0xAA, 0x9A, 0x6A,
+  0x2A, 0x59, 0x8E, 0xC0, 0x97, 0x8E, 0x73, 0x87, 0x3F, 0x5F, 0x75, 0xB5,
+  0xC2, 0x65, 0xA8, 0x52, 0x6F, 0x27, 0x23, 0x91, 0xCF, 0x2D, 0x30, 0x1D,
+  0x80, 0x4D, 0x24, 0xD3, 0x49, 0x34, 0xD3, 0x4D, 0x34, 0xDA, 0x6D, 0x36,
+  0x9B, 0x0D, 0xA6, 0xD3, 0x69, 0xB4, 0xD3, 0x4D, 0x34, 0xD2, 0x4D, 0x34,
+  0x93, 0x8A, 0x24, 0x97, 0xAB, 0x4C, 0xBD, 0x49, 0x28, 0x80, 0xAB, 0xB5,
+  0xDA, 0xED, 0x76, 0xAF, 0xFD, 0xD5, 0xDA, 0xED, 0x76, 0xBB, 0x40, 0x2C,
+  0xB2, 0xCE, 0x28, 0x1F, 0xC0, 0x1D, 0x00, 0xAA, 0x38, 0xAA, 0x8E, 0x2A,
+  0xA3, 0x8A, 0xA8, 0xE2, 0xAA, 0x38, 0x80, 0x76, 0xF0, 0xDB, 0x65, 0xDD,
+  0x75, 0xD7, 0x5D, 0x75, 0x65, 0xB6, 0xF8, 0xB4, 0x35, 0xE6, 0x8B, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0x7F, 0xC0, 0x3C, 0x2E, 0x8A, 0x97, 0x3E,
+  0x1F, 0x0F, 0x4B, 0x25, 0x96, 0x59, 0xFE, 0x3C, 0x2E, 0x89, 0xB3, 0x87,
+  0xA2, 0xD3, 0x8E, 0x27, 0x0F, 0x89, 0x7E, 0x58, 0xB3, 0x5B, 0xAA, 0x2E,
+  0x24, 0xDB, 0x4D, 0xA6, 0xD2, 0x8D, 0x7F, 0xCE, 0x7C, 0xBE, 0x58, 0x3C,
+  0xAE, 0x53, 0xE1, 0xF1, 0xC3, 0xE5, 0x19, 0x38, 0x7C, 0x3E, 0x25, 0xF9,
+  0x60, 0x76, 0x70, 0x9C, 0x29, 0x71, 0xCA, 0xE8, 0xC5, 0xC4, 0xD3, 0x46,
+  0x5A, 0x87, 0x99, 0x40, 0x1F, 0xED, 0x33, 0xD3, 0x3E, 0x1E, 0x7C, 0x3C,
+  0xF8, 0x7A, 0x66, 0x59, 0xF2, 0x5C, 0xD3, 0x46, 0x79, 0x5C, 0x98, 0xB8,
+  0x9A, 0x70, 0xA1, 0xE5, 0xE0, 0x56, 0x72, 0x62, 0x65, 0xCD, 0x34, 0xE1,
+  0x43, 0xD2, 0xE7, 0x84, 0x8C, 0x6B, 0x89, 0x40, 0x1D, 0x7B, 0xD0, 0x2C,
+  0xB2, 0xFF, 0x6C, 0xB2, 0xCE, 0x28, 0xEC, 0xF1, 0x26, 0x5A, 0x4E, 0x27,
+  0x3B, 0x9D, 0xCC, 0xEC, 0x80, 0x1F, 0xF3, 0xFF, 0x3F, 0xF2, 0x07, 0xB9,
+  0xCE, 0xE7, 0x73, 0x38, 0x93, 0x2D, 0x27, 0x04, 0x35, 0x70, 0x4C, 0x75,
+  0xD7, 0x1C, 0x71, 0xD7, 0xF3, 0xAE, 0xB0, 0xBB, 0x9E, 0xEC, 0xAD, 0xBE,
+  0x5A, 0x4D, 0x94, 0x72, 0xE1, 0x44, 0xD3, 0x51, 0x28, 0x94, 0x4A, 0x25,
+  0x13, 0x4C, 0xA2, 0xD7, 0x69, 0x36, 0x5C, 0x7C, 0x9B, 0x23, 0xDD, 0x75,
+  0x40, 0xB3, 0xB9, 0xD6, 0xE5, 0x25, 0xC3, 0x4F, 0x34, 0xF2, 0x8A, 0xB8,
+  0xE7, 0x6F, 0xD4, 0xF3, 0x4F, 0x32, 0xF9, 0x60, 0x1C, 0xBE, 0xCB, 0x8C,
+  0xB8, 0xCB, 0x8C, 0xF4, 0xBB, 0x2E, 0x71, 0x75, 0xD3, 0xF0, 0x7A, 0x99,
+  0xF4, 0x65, 0x25, 0xF0, 0xF9, 0x7C, 0xBE, 0x5F, 0x2F, 0xA7, 0xCC, 0xA5,
+  0x75, 0x30, 0x1C, 0xCE, 0xD3, 0x90, 0xBA, 0xCB, 0xDB, 0x6D, 0xB6, 0xDA,
+  0xB2, 0xE4, 0x3D, 0xAE, 0x40, 0x1F, 0xF1, 0x9E, 0x7B, 0x93, 0xC9, 0x79,
+  0xE7, 0x9E, 0xFE, 0x00, 0x1F, 0xF1, 0x9E, 0x7B, 0xFE, 0x33, 0xCF, 0x3C,
+  0xF3, 0x9C, 0x4E, 0xD4, 0xC5, 0x3E, 0x9F, 0x6F, 0xB7, 0x79, 0xBC, 0xF0,
+  0xCB, 0xCC, 0xCA, 0xD7, 0x93, 0x80, 0x0F, 0x6D, 0xB6, 0xDB, 0x7F, 0xFA,
+  0xDB, 0x6D, 0xB6, 0xDB, 0x30, 0x1F, 0xFF, 0xE0, 0x6D, 0xB6, 0xDB, 0x6D,
+  0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB5, 0xD1, 0x80, 0x0E, 0x44, 0xDC,
+  0x6D, 0x48, 0xCC, 0xBC, 0x6D, 0xC6, 0xE3, 0x8C, 0xCC, 0xAD, 0x48, 0xDC,
+  0x6E, 0x44, 0xEC, 0x0F, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF7,
+  0xF0, 0x13, 0x8E, 0x78, 0xEA, 0xF7, 0x79, 0x29, 0xA3, 0x8A, 0x68, 0xE2,
+  0xCB, 0x39, 0x22, 0x96, 0x55, 0x66, 0xDE, 0x6D, 0xEE, 0xB7, 0x4C, 0x12,
+  0xF1, 0x79, 0x9C, 0xCC, 0x53, 0xC5, 0xAC, 0x92, 0xC9, 0x9C, 0xD1, 0xCF,
+  0xA9, 0xCD, 0xE2, 0xC0, 0x97, 0x74, 0xE3, 0x89, 0xD6, 0x5F, 0x1B, 0x8D,
+  0xC6, 0xE3, 0x70, 0xCB, 0xAD, 0x47, 0x1F, 0x5A, 0x80, 0x1D, 0x2E, 0xCB,
+  0x9C, 0x5D, 0x75, 0xD3, 0xF0, 0x7A, 0x4F, 0x97, 0xCB, 0xE5, 0x80, 0x97,
+  0x74, 0xE3, 0x89, 0xD6, 0x5F, 0x1B, 0x8D, 0xC6, 0xE3, 0x70, 0xCB, 0xB0,
+  0xC7, 0x1F, 0x5B, 0x76, 0xFC, 0x7E, 0x30, 0x1C, 0xCE, 0x9B, 0x8D, 0x38,
+  0xD3, 0x8D, 0x37, 0x17, 0x4F, 0xA6, 0xDB, 0x6E, 0x34, 0xE4, 0x2E, 0xB2,
+  0xEC, 0x5C, 0x2E, 0x4B, 0xA4, 0xBE, 0x26, 0xE2, 0x73, 0x76, 0x9C, 0x4D,
+  0xEA, 0xE0, 0x1F, 0xF3, 0x1F, 0x2F, 0x97, 0xCB, 0xE5, 0xF2, 0xF9, 0x7C,
+  0xBE, 0x5F, 0x2F, 0x96, 0x0F, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6C,
+  0xCB, 0x8D, 0x77, 0x30, 0x0F, 0x96, 0x5E, 0x69, 0xE6, 0xA4, 0x8D, 0xC7,
+  0x1C, 0x72, 0x29, 0x5A, 0x79, 0xA7, 0xC6, 0xE7, 0x73, 0xBA, 0x80, 0x0E,
+  0xBB, 0xA5, 0x8C, 0xB6, 0x8A, 0x6D, 0x36, 0x8A, 0x6D, 0x36, 0x8A, 0x6D,
+  0x36, 0x8A, 0x6D, 0xB2, 0x9A, 0x2E, 0x32, 0x9A, 0x2E, 0x32, 0x9A, 0x2E,
+  0x32, 0x9A, 0x2E, 0xCB, 0x34, 0xB3, 0x4B, 0x00, 0x12, 0xC3, 0x1C, 0x6D,
+  0xB9, 0x0C, 0xBC, 0x71, 0x79, 0xBC, 0xDE, 0x38, 0xB0, 0xC8, 0xDB, 0x71,
+  0xC3, 0x2C, 0x12, 0xC3, 0x1C, 0x6D, 0xB9, 0x0C, 0xBC, 0x71, 0x79, 0xBD,
+  0x3E, 0xDF, 0x6F, 0xB7, 0xDB, 0xED, 0x80, 0x1F, 0xF3, 0xC4, 0xD3, 0x4D,
+  0x38, 0x7C, 0x4D, 0x34, 0xD3, 0x8F, 0xF9, 0x1F, 0x26, 0x9A, 0x69, 0xA6,
+  0x9A, 0x69, 0xA6, 0x9A, 0x6B, 0xB0, 0x0A, 0xBA, 0xAA, 0xAE, 0xAA, 0xAB,
+  0xAA, 0xAA, 0xEA, 0xAA, 0xBA, 0x80, 0x1D, 0xA6, 0x9A, 0x69, 0xA6, 0x9A,
+  0x69, 0xA6, 0x9A, 0x6B, 0xE0, 0x8F, 0x8B, 0x59, 0x6D, 0xB6, 0x5D, 0x60,
+  0x1F, 0xC0, 0x2A, 0x28, 0x80, 0x59, 0xF2, 0x8D, 0x7C, 0x35, 0xFF, 0x13,
+  0x3F, 0xC1, 0xA5, 0x80, 0x0F, 0x97, 0xCB, 0xE5, 0xF2, 0xD4, 0x5D, 0x98,
+  0xD9, 0x77, 0x5D, 0x75, 0xE1, 0xB3, 0xD9, 0x6A, 0x00, 0x75, 0x72, 0x5C,
+  0x99, 0xE7, 0x9F, 0x0E, 0x13, 0xCB, 0xA0, 0xE5, 0xF2, 0xF9, 0x7C, 0xB5,
+  0x13, 0x3D, 0x96, 0xF8, 0xBA, 0xEB, 0xAB, 0x2D, 0xC3, 0xDA, 0x89, 0x80,
+  0x76, 0x74, 0x9B, 0x65, 0xDF, 0xFF, 0x1D, 0x3C, 0x4F, 0x6F, 0x80, 0x75,
+  0x64, 0xEB, 0x7F, 0xA4, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xB0, 0x51, 0x33,
+  0xD9, 0x6F, 0x8B, 0xAE, 0xBA, 0xB2, 0xDC, 0x3D, 0xA8, 0x9F, 0x2C, 0x9A,
+  0xD7, 0x4F, 0x00, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xD4, 0x3D, 0x18, 0xF4,
+  0xD3, 0x4D, 0x34, 0xD3, 0x46, 0x1D, 0x3F, 0xFF, 0x40, 0x4D, 0x34, 0xF8,
+  0x69, 0xA6, 0x9A, 0x69, 0xA6, 0x9A, 0x69, 0xA6, 0xB8, 0x2C, 0x0F, 0x97,
+  0xCB, 0xE5, 0xF2, 0xE3, 0x2D, 0xB4, 0xD3, 0x6C, 0xB9, 0xAE, 0xAC, 0xB8,
+  0xD3, 0x6D, 0xB4, 0xE3, 0x1F, 0xFF, 0xF8, 0x0C, 0xC5, 0x0F, 0x27, 0xB5,
+  0x16, 0x6D, 0xE6, 0xDE, 0x6D, 0xE6, 0xDE, 0x6D, 0xE6, 0xDE, 0x6D, 0xB0,
+  0x0D, 0x43, 0xD1, 0x8F, 0x4D, 0x34, 0xD3, 0x4D, 0x34, 0x60, 0x76, 0x74,
+  0x9B, 0x65, 0xDD, 0x75, 0xD5, 0x96, 0xDA, 0xEA, 0x50, 0x0D, 0x45, 0xD9,
+  0x8D, 0x97, 0x75, 0xD7, 0x5E, 0x1B, 0x3D, 0x96, 0xA2, 0x7C, 0xBE, 0x5F,
+  0x2C, 0x51, 0x33, 0xD9, 0x6F, 0x8B, 0xAE, 0xBA, 0xB2, 0xDC, 0x3D, 0xA8,
+  0x9F, 0x2F, 0x97, 0xCB, 0xE5, 0x80, 0x0C, 0xFE, 0x1B, 0x8E, 0x38, 0xE3,
+  0x8E, 0x30, 0x58, 0xFB, 0x66, 0xE2, 0x71, 0xA5, 0xF4, 0xE0, 0x4E, 0xBA,
+  0xDF, 0xE9, 0x3A, 0xEB, 0xAE, 0xBA, 0xEE, 0x74, 0x0E, 0x69, 0xA6, 0x9A,
+  0x69, 0xA6, 0x70, 0xF4, 0x9A, 0x60, 0x0E, 0xE9, 0x0B, 0x6D, 0x36, 0xDB,
+  0x2E, 0x32, 0xEA, 0x2B, 0x5E, 0x1F, 0x2C, 0x0D, 0xB7, 0x9B, 0x6C, 0xB4,
+  0xD3, 0x4C, 0xA2, 0x8B, 0x4C, 0xA2, 0x8B, 0x68, 0xA2, 0x8A, 0x94, 0xD9,
+  0x15, 0xAD, 0xBC, 0xDB, 0x11, 0xC2, 0xDB, 0x6C, 0xB8, 0xCB, 0xB7, 0x5A,
+  0xCB, 0x8C, 0xB6, 0xDB, 0x31, 0xC0, 0x0E, 0xB2, 0xDB, 0x4D, 0xB4, 0xDB,
+  0x6C, 0xB8, 0xCB, 0xA8, 0xAD, 0x78, 0x9C, 0x3E, 0x5F, 0x2F, 0x4E, 0x18,
+  0x1F, 0xCC, 0xEB, 0xAE, 0xBA, 0xEB, 0xBF, 0xC0, 0x95, 0xE6, 0xF3, 0xCF,
+  0x3C, 0xEC, 0x76, 0x5E, 0x1E, 0x79, 0xE7, 0x9E, 0xD2, 0x80, 0x1F, 0xFF,
+  0xC8, 0x16, 0x6C, 0xF3, 0xCF, 0x3C, 0xF4, 0xD6, 0x56, 0xF3, 0xCF, 0x3C,
+  0xDE, 0x74, 0x36, 0x7D, 0x28, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C,
+  0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B,
+  0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D,
+  0x3F, 0xFE, 0x87, 0x83, 0xC1, 0xB5, 0x7A, 0xA1, 0x2D, 0x92, 0xD9, 0x2D,
+  0x93, 0x22, 0x27, 0x87, 0x29, 0xE0, 0xF0, 0x40, 0x96, 0x70, 0xA3, 0x29,
+  0xF0, 0xF8, 0x77, 0x95, 0xCC, 0x7C, 0x3E, 0x1D, 0xFF, 0x00, 0x27, 0x7A,
+  0x79, 0x4D, 0x34, 0xA2, 0x4A, 0x24, 0xD3, 0x5C, 0x9F, 0x71, 0x11, 0xC2,
+  0xDB, 0x4D, 0xB6, 0xCB, 0x8C, 0xB5, 0xFF, 0x31, 0xCF, 0xF9, 0x8F, 0x97,
+  0xCB, 0x1F, 0x89, 0xF8, 0x59, 0x70, 0x9B, 0x29, 0xF1, 0x27, 0x05, 0xAE,
+  0x1F, 0x09, 0x9E, 0x24, 0xE1, 0xA2, 0xDA, 0xE1, 0x60, 0x08, 0xC2, 0x80,
+  0x97, 0x2A, 0x9A, 0xE1, 0x22, 0xE2, 0x24, 0xB4, 0x8B, 0x49, 0x70, 0x92,
+  0xE1, 0x25, 0xC2, 0x6B, 0x12, 0x5C, 0x45, 0x2E, 0x13, 0x55, 0x6A, 0x37,
+  0x23, 0xCB, 0x8E, 0x26, 0x77, 0x1F, 0x80, 0x65, 0x94, 0x92, 0x2C, 0xA2,
+  0x92, 0x49, 0x26, 0xCA, 0x69, 0x26, 0x59, 0x1F, 0xF3, 0xD2, 0xE9, 0x74,
+  0x80, 0x1F, 0xC0, 0x97, 0x2A, 0x9A, 0xE1, 0x22, 0xA3, 0x24, 0xB4, 0x53,
+  0x4D, 0x14, 0xD3, 0x91, 0x39, 0x13, 0x45, 0x32, 0x4A, 0x45, 0x22, 0x97,
+  0x09, 0xAA, 0xB5, 0x1E, 0x80, 0x30, 0xA4, 0xE2, 0x8D, 0x23, 0x00, 0xAB,
+  0xB5, 0xDA, 0xBF, 0xF7, 0x57, 0x6B, 0xB5, 0xFB, 0xFF, 0xB0, 0x14, 0x96,
+  0xA2, 0x89, 0xA4, 0xD3, 0x78, 0x16, 0xA8, 0x8C, 0xAA, 0x37, 0xC0, 0x49,
+  0x24, 0x80, 0x0E, 0x32, 0xE3, 0x2E, 0x32, 0xE3, 0x2E, 0x32, 0xE3, 0x2E,
+  0x33, 0x14, 0x3F, 0xC3, 0xB9, 0x7C, 0xBE, 0x58, 0x5C, 0x9A, 0xB9, 0x5C,
+  0xAE, 0x52, 0x35, 0x25, 0x12, 0x89, 0x28, 0x92, 0x89, 0x28, 0x92, 0x89,
+  0x28, 0x92, 0x89, 0x28, 0x92, 0x1D, 0x00, 0x49, 0x97, 0x40, 0x12, 0x28,
+  0xA2, 0x8A, 0x28, 0x96, 0x51, 0xA4, 0x8A, 0x92, 0x48, 0x8A, 0x49, 0xCE,
+  0xFF, 0x40, 0x05, 0x96, 0x92, 0x68, 0xB6, 0x92, 0x49, 0x22, 0x8B, 0x29,
+  0x24, 0x59, 0x13, 0x3A, 0xB2, 0xCA, 0xBC, 0xAA, 0xE1, 0x45, 0xCA, 0x6F,
+  0x94, 0xD3, 0x67, 0xA6, 0xF8, 0x4C, 0x95, 0x93, 0x29, 0x56, 0xB8, 0x89,
+  0xF0, 0xDF, 0x08, 0x13, 0x3C, 0xB2, 0xE1, 0x57, 0xC2, 0xAB, 0x95, 0x17,
+  0x49, 0xBE, 0x93, 0x4A, 0x9E, 0x91, 0x6B, 0x2E, 0x15, 0x5C, 0xA8, 0xF8,
+  0x55, 0x67, 0x5D, 0x7F, 0x8C, 0x16, 0xBE, 0x14, 0x5C, 0xA6, 0xEC, 0x8B,
+  0xA4, 0x97, 0x68, 0xBC, 0x5A, 0x29, 0xB3, 0x4B, 0x6F, 0x84, 0xC9, 0x59,
+  0x32, 0x95, 0x6B, 0x88, 0x9F, 0x0D, 0xF0, 0x80, 0x6E, 0xBA, 0xFE, 0x75,
+  0xC8, 0xE3, 0x91, 0xD7, 0x5C, 0x27, 0x85, 0x40, 0xAB, 0xE5, 0xFF, 0x93,
+  0xB9, 0xD6, 0xE5, 0x25, 0xC3, 0x4F, 0x34, 0xF2, 0x8A, 0xB8, 0xE7, 0x6F,
+  0xD4, 0xF3, 0x4F, 0x32, 0xF9, 0x60, 0xCB, 0xC5, 0xFF, 0xB3, 0xB9, 0xD6,
+  0xE5, 0x25, 0xC3, 0x4F, 0x34, 0xF2, 0x8A, 0xB8, 0xE7, 0x6F, 0xD4, 0xF3,
+  0x4F, 0x32, 0xF9, 0x60, 0xB3, 0xA4, 0x97, 0xFD, 0x4E, 0xE7, 0x5B, 0x94,
+  0x97, 0x0D, 0x3C, 0xD3, 0xCA, 0x2A, 0xE3, 0x9D, 0xBF, 0x53, 0xCD, 0x3C,
+  0xCB, 0xE5, 0x80, 0xA9, 0x1E, 0x77, 0x25, 0x2F, 0xFB, 0x9D, 0xCE, 0xB7,
+  0x29, 0x2E, 0x1A, 0x79, 0xA7, 0x94, 0x55, 0xC7, 0x3B, 0x7E, 0xA7, 0x9A,
+  0x79, 0x97, 0xCB, 0x89, 0x2E, 0x52, 0x5F, 0xF5, 0x3B, 0x9D, 0x6E, 0x52,
+  0x5C, 0x34, 0xF3, 0x4F, 0x28, 0xAB, 0x8E, 0x76, 0xFD, 0x4F, 0x34, 0xF3,
+  0x2F, 0x96, 0xB3, 0xA4, 0x97, 0x26, 0x1E, 0x52, 0x5D, 0x4E, 0xB7, 0x3B,
+  0x86, 0x9E, 0x69, 0xE6, 0x9D, 0x71, 0xC7, 0x1C, 0xED, 0xFA, 0x9E, 0x69,
+  0xE6, 0x5F, 0x2C, 0xBF, 0x5F, 0xA4, 0x2F, 0xB6, 0x9F, 0x6D, 0x3E, 0x9B,
+  0xE6, 0x37, 0xCB, 0xEF, 0x9E, 0xF8, 0x91, 0xF0, 0xEB, 0xE1, 0xDF, 0x77,
+  0x40, 0x99, 0xF4, 0x65, 0x25, 0xF0, 0xF9, 0x7C, 0xBE, 0x5F, 0x2F, 0xA7,
+  0xCC, 0xA5, 0x75, 0x37, 0x0B, 0xB3, 0xD9, 0xE2, 0x00, 0x6B, 0x95, 0xEF,
+  0xFC, 0x67, 0x9E, 0xE4, 0xF2, 0x5E, 0x79, 0xE7, 0xBF, 0x80, 0x8B, 0x2F,
+  0xBF, 0xE3, 0x3C, 0xF7, 0x27, 0x92, 0xF3, 0xCF, 0x3D, 0xFC, 0x6E, 0x96,
+  0x7C, 0xFF, 0x8C, 0xF3, 0xDC, 0x9E, 0x4B, 0xCF, 0x3C, 0xF7, 0xF0, 0x48,
+  0xA8, 0x8A, 0xF3, 0xFE, 0x33, 0xCF, 0x72, 0x79, 0x2F, 0x3C, 0xF3, 0xDF,
+  0xC0, 0x29, 0xAA, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB2,
+  0xC0, 0x28, 0xAC, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB2,
+  0xC0, 0x4D, 0x96, 0x7B, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+  0x1C, 0x60, 0x08, 0xC2, 0xB3, 0x4D, 0x34, 0xD3, 0x4D, 0x34, 0xD3, 0x4D,
+  0x34, 0xD3, 0x5C, 0xEE, 0xE3, 0x91, 0xBA, 0xDB, 0xDD, 0xCE, 0xE3, 0x4F,
+  0x34, 0xF3, 0x4E, 0xB6, 0xE4, 0x7D, 0xCE, 0x40, 0x69, 0x1D, 0xB1, 0x4B,
+  0xF7, 0x2F, 0x17, 0x99, 0xCC, 0xC5, 0x3C, 0x5A, 0xC9, 0x2C, 0x99, 0xCD,
+  0x1C, 0xFA, 0x9C, 0xDE, 0x2C, 0xAB, 0xD5, 0xFF, 0x37, 0x74, 0xE3, 0x89,
+  0xD6, 0x5F, 0x1B, 0x8D, 0xC6, 0xE3, 0x70, 0xCB, 0xAD, 0x47, 0x1F, 0x5A,
+  0x80, 0xCB, 0xB5, 0xFF, 0x57, 0x74, 0xE3, 0x89, 0xD6, 0x5F, 0x1B, 0x8D,
+  0xC6, 0xE3, 0x70, 0xCB, 0xAD, 0x47, 0x1F, 0x5A, 0x80, 0xAF, 0xA2, 0xCF,
+  0xFC, 0x5D, 0xD3, 0x8E, 0x27, 0x59, 0x7C, 0x6E, 0x37, 0x1B, 0x8D, 0xC3,
+  0x2E, 0xB5, 0x1C, 0x7D, 0x6A, 0xA8, 0x9E, 0x6F, 0x24, 0xAF, 0xF9, 0xBB,
+  0xA7, 0x1C, 0x4E, 0xB2, 0xF8, 0xDC, 0x6E, 0x37, 0x1B, 0x86, 0x5D, 0x6A,
+  0x38, 0xFA, 0xD4, 0x88, 0xAE, 0x51, 0x5F, 0xF1, 0x77, 0x4E, 0x38, 0x9D,
+  0x65, 0xF1, 0xB8, 0xDC, 0x6E, 0x37, 0x0C, 0xBA, 0xD4, 0x71, 0xF5, 0xA8,
+  0x27, 0x82, 0x5D, 0x65, 0xB6, 0xD9, 0x76, 0xF0, 0xF8, 0xB5, 0x96, 0xDB,
+  0x65, 0xD6, 0x4F, 0x04, 0xB9, 0x17, 0xDB, 0x8E, 0x37, 0x29, 0x71, 0x16,
+  0x5B, 0x49, 0x96, 0x93, 0x65, 0x95, 0x19, 0xB5, 0x99, 0x5B, 0x8E, 0x3E,
+  0xD9, 0x58, 0x8B, 0xC5, 0xFB, 0x7B, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB,
+  0x66, 0x5C, 0x6B, 0xB9, 0x80, 0xAB, 0xA5, 0xFC, 0x7B, 0x6D, 0xB6, 0xDB,
+  0x6D, 0xB6, 0xDB, 0x66, 0x5C, 0x6B, 0xB9, 0x80, 0x93, 0x84, 0x97, 0xE5,
+  0xED, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0x99, 0x71, 0xAE, 0xE6, 0x69,
+  0x2C, 0x92, 0xFC, 0xBD, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB3, 0x2E,
+  0x35, 0xDC, 0xC0, 0xCB, 0xB5, 0xFD, 0x96, 0x18, 0xE3, 0x6D, 0xC8, 0x65,
+  0xE3, 0x8B, 0xCD, 0xE9, 0xF6, 0xFB, 0x7D, 0xBE, 0xDF, 0x6C, 0x0F, 0x97,
+  0xCF, 0x4B, 0xB2, 0xE7, 0x17, 0x5D, 0x74, 0xFC, 0x1E, 0x93, 0xE5, 0x80,
+  0x5A, 0x72, 0xA3, 0x65, 0xC6, 0x5A, 0xA5, 0x97, 0x19, 0x71, 0x98, 0xDA,
+  0xA5, 0xBE, 0x6E, 0xB8, 0xF6, 0x68, 0x6B, 0xA5, 0xD2, 0xFC, 0xE7, 0xCA,
+  0x35, 0xF0, 0xD7, 0xFC, 0x4C, 0xFF, 0x06, 0x96, 0xCB, 0x85, 0xC2, 0xFD,
+  0x67, 0xCA, 0x35, 0xF0, 0xD7, 0xFC, 0x4C, 0xFF, 0x06, 0x96, 0x8F, 0x22,
+  0xA2, 0x6B, 0xEC, 0xF9, 0x46, 0xBE, 0x1A, 0xFF, 0x89, 0x9F, 0xE0, 0xD2,
+  0xC0, 0x88, 0x9B, 0x69, 0x2B, 0xF3, 0x9F, 0x28, 0xD7, 0xC3, 0x5F, 0xF1,
+  0x33, 0xFC, 0x1A, 0x58, 0x68, 0xAA, 0x8A, 0xFF, 0xBC, 0xF9, 0x46, 0xBE,
+  0x1A, 0xFF, 0x89, 0x9F, 0xE0, 0xD2, 0xC0, 0x8F, 0x16, 0x69, 0x66, 0x96,
+  0x73, 0xFC, 0xE7, 0xCA, 0x35, 0xF0, 0xD7, 0xFC, 0x4C, 0xFF, 0x06, 0x96,
+  0x59, 0x49, 0xF9, 0x46, 0xC4, 0xF9, 0x71, 0xAF, 0xFF, 0xE2, 0x3E, 0x1B,
+  0xB7, 0x93, 0xD1, 0xB3, 0x00, 0x75, 0x72, 0x5C, 0x99, 0xE7, 0x9F, 0x0E,
+  0x13, 0xCB, 0xB9, 0x72, 0x79, 0x36, 0x00, 0x6B, 0xB5, 0xDA, 0xFE, 0x59,
+  0xD2, 0x6D, 0x97, 0x7F, 0xFC, 0x74, 0xF1, 0x3D, 0xBE, 0x00, 0xCB, 0x95,
+  0xCA, 0xFE, 0xD9, 0xD2, 0x6D, 0x97, 0x7F, 0xFC, 0x74, 0xF1, 0x3D, 0xBE,
+  0x00, 0x8F, 0x84, 0x55, 0x4D, 0x7E, 0xAC, 0xE9, 0x36, 0xCB, 0xBF, 0xFE,
+  0x3A, 0x78, 0x9E, 0xDF, 0x00, 0x68, 0xAC, 0x8A, 0xFF, 0xF1, 0x67, 0x49,
+  0xB6, 0x5D, 0xFF, 0xF1, 0xD3, 0xC4, 0xF6, 0xF8, 0x2A, 0x28, 0xB8, 0x69,
+  0xA6, 0x9A, 0x69, 0xA6, 0x9A, 0x69, 0x80, 0x49, 0x24, 0xB9, 0x69, 0xA6,
+  0x9A, 0x69, 0xA6, 0x9A, 0x69, 0x80, 0x4D, 0xA2, 0x8A, 0x6B, 0xA7, 0x1C,
+  0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x18, 0x08, 0xC2, 0xBC, 0x69, 0xA6, 0x9A,
+  0x69, 0xA6, 0x9A, 0x69, 0x80, 0x6D, 0x9B, 0xAC, 0xA9, 0x2E, 0xD4, 0xE5,
+  0x74, 0x64, 0xD7, 0x5D, 0x59, 0x6D, 0xAE, 0xA5, 0x49, 0x19, 0xA1, 0x4B,
+  0xF0, 0xD4, 0x3D, 0x18, 0xF4, 0xD3, 0x4D, 0x34, 0xD3, 0x46, 0x6B, 0xB5,
+  0xDA, 0xFE, 0x59, 0xD2, 0x6D, 0x97, 0x75, 0xD7, 0x56, 0x5B, 0x6B, 0xA9,
+  0x40, 0xCB, 0x95, 0xCA, 0xFE, 0xD9, 0xD2, 0x6D, 0x97, 0x75, 0xD7, 0x56,
+  0x5B, 0x6B, 0xA9, 0x40, 0x8F, 0x84, 0x55, 0x4D, 0x7E, 0xAC, 0xE9, 0x36,
+  0xCB, 0xBA, 0xEB, 0xAB, 0x2D, 0xB5, 0xD4, 0xA0, 0x6D, 0x19, 0xC4, 0x29,
+  0xFE, 0xEC, 0xE9, 0x36, 0xCB, 0xBA, 0xEB, 0xAB, 0x2D, 0xB5, 0xD4, 0xA0,
+  0x68, 0xAC, 0x8A, 0xFF, 0xF1, 0x67, 0x49, 0xB6, 0x5D, 0xD7, 0x5D, 0x59,
+  0x6D, 0xAE, 0xA5, 0x8F, 0x97, 0xCB, 0xFC, 0xFF, 0xCF, 0xE5, 0xF2, 0xF9,
+  0x60, 0xFC, 0x72, 0x7A, 0x4D, 0xF0, 0xF9, 0x48, 0xE2, 0x97, 0x2F, 0x86,
+  0xD7, 0x47, 0x90, 0x4B, 0xA5, 0xD2, 0xFC, 0x39, 0xA6, 0x9A, 0x69, 0xA6,
+  0x99, 0xC3, 0xD2, 0x69, 0x80, 0xAB, 0x85, 0xC2, 0xFC, 0xB9, 0xA6, 0x9A,
+  0x69, 0xA6, 0x99, 0xC3, 0xD2, 0x69, 0x80, 0x73, 0x4A, 0x92, 0xF5, 0xCD,
+  0x34, 0xD3, 0x4D, 0x34, 0xCE, 0x1E, 0x93, 0x4C, 0x49, 0x28, 0x92, 0xFF,
+  0x97, 0x34, 0xD3, 0x4D, 0x34, 0xD3, 0x38, 0x7A, 0x4D, 0x30, 0xAB, 0x95,
+  0xCA, 0xFD, 0xBA, 0xCB, 0x6D, 0x36, 0xD3, 0x6D, 0xB2, 0xE3, 0x2E, 0xA2,
+  0xB5, 0xE2, 0x70, 0xF9, 0x7C, 0xBD, 0x38, 0x60, 0x0F, 0x97, 0xCB, 0xE5,
+  0xF2, 0xD4, 0x5D, 0x98, 0xD9, 0x77, 0x5D, 0x75, 0xE1, 0xB3, 0xD9, 0x6A,
+  0x27, 0xCB, 0xE5, 0xF2, 0xC0, 0x48, 0xAC, 0x8A, 0xFF, 0xD7, 0x59, 0x6D,
+  0xA6, 0xDA, 0x6D, 0xB6, 0x5C, 0x65, 0xD4, 0x56, 0xBC, 0x4E, 0x1F, 0x2F,
+  0x97, 0xA7, 0x0C
+};
+
+const GFXglyph DejaVuSans_Bold9pt8bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20
+  {     0,   3,  13,   8,    3,  -12 },   // 0x21
+  {     3,   6,   5,   9,    2,  -12 },   // 0x22
+  {     8,  13,  13,  15,    1,  -12 },   // 0x23
+  {    27,  10,  17,  13,    1,  -13 },   // 0x24
+  {    47,  17,  13,  18,    1,  -12 },   // 0x25
+  {    76,  14,  13,  16,    1,  -12 },   // 0x26
+  {    95,   2,   5,   6,    2,  -12 },   // 0x27
+  {    97,   5,  16,   8,    2,  -13 },   // 0x28
+  {   109,   5,  16,   8,    2,  -13 },   // 0x29
+  {   121,  10,   8,   9,    0,  -12 },   // 0x2A
+  {   130,  12,  12,  15,    2,  -11 },   // 0x2B
+  {   143,   4,   6,   7,    1,   -2 },   // 0x2C
+  {   147,   6,   3,   7,    1,   -6 },   // 0x2D
+  {   149,   3,   3,   7,    2,   -2 },   // 0x2E
+  {   151,   7,  15,   7,    0,  -12 },   // 0x2F
+  {   163,  11,  13,  13,    1,  -12 },   // 0x30
+  {   176,   9,  13,  13,    2,  -12 },   // 0x31
+  {   187,  10,  13,  13,    1,  -12 },   // 0x32
+  {   199,  10,  13,  13,    1,  -12 },   // 0x33
+  {   212,  11,  13,  13,    1,  -12 },   // 0x34
+  {   227,  10,  13,  13,    1,  -12 },   // 0x35
+  {   241,  10,  13,  13,    1,  -12 },   // 0x36
+  {   256,  10,  13,  13,    1,  -12 },   // 0x37
+  {   267,  10,  13,  13,    1,  -12 },   // 0x38
+  {   281,  10,  13,  13,    1,  -12 },   // 0x39
+  {   296,   3,  10,   7,    2,   -9 },   // 0x3A
+  {   299,   4,  13,   7,    1,   -9 },   // 0x3B
+  {   306,  11,  10,  15,    2,  -10 },   // 0x3C
+  {   317,  11,   6,  15,    2,   -8 },   // 0x3D
+  {   322,  11,  10,  15,    2,  -10 },   // 0x3E
+  {   332,   8,  13,  10,    1,  -12 },   // 0x3F
+  {   343,  16,  16,  18,    1,  -12 },   // 0x40
+  {   373,  14,  13,  14,    0,  -12 },   // 0x41
+  {   392,  11,  13,  14,    2,  -12 },   // 0x42
+  {   407,  11,  13,  13,    1,  -12 },   // 0x43
+  {   422,  12,  13,  15,    2,  -12 },   // 0x44
+  {   437,   9,  13,  12,    2,  -12 },   // 0x45
+  {   448,   9,  13,  12,    2,  -12 },   // 0x46
+  {   457,  13,  13,  15,    1,  -12 },   // 0x47
+  {   474,  12,  13,  16,    2,  -12 },   // 0x48
+  {   485,   3,  13,   7,    2,  -12 },   // 0x49
+  {   488,   6,  17,   7,   -1,  -12 },   // 0x4A
+  {   501,  13,  13,  14,    2,  -12 },   // 0x4B
+  {   519,   9,  13,  11,    2,  -12 },   // 0x4C
+  {   529,  15,  13,  18,    2,  -12 },   // 0x4D
+  {   551,  12,  13,  15,    2,  -12 },   // 0x4E
+  {   568,  13,  13,  15,    1,  -12 },   // 0x4F
+  {   585,  11,  13,  13,    2,  -12 },   // 0x50
+  {   599,  13,  16,  15,    1,  -12 },   // 0x51
+  {   619,  12,  13,  14,    2,  -12 },   // 0x52
+  {   637,  10,  13,  13,    1,  -12 },   // 0x53
+  {   650,  11,  13,  12,    0,  -12 },   // 0x54
+  {   664,  12,  13,  16,    2,  -12 },   // 0x55
+  {   676,  14,  13,  14,    0,  -12 },   // 0x56
+  {   695,  19,  13,  20,    1,  -12 },   // 0x57
+  {   728,  13,  13,  14,    0,  -12 },   // 0x58
+  {   746,  13,  13,  13,    0,  -12 },   // 0x59
+  {   763,  11,  13,  13,    1,  -12 },   // 0x5A
+  {   775,   5,  16,   8,    2,  -13 },   // 0x5B
+  {   786,   7,  15,   7,    0,  -12 },   // 0x5C
+  {   798,   5,  16,   8,    2,  -13 },   // 0x5D
+  {   809,  11,   5,  15,    2,  -12 },   // 0x5E
+  {   816,   9,   2,   9,    0,    3 },   // 0x5F
+  {   818,   5,   3,   9,    1,  -13 },   // 0x60
+  {   821,  10,  10,  12,    1,   -9 },   // 0x61
+  {   832,  11,  14,  13,    2,  -13 },   // 0x62
+  {   849,   9,  10,  11,    1,   -9 },   // 0x63
+  {   859,  11,  14,  13,    1,  -13 },   // 0x64
+  {   876,  11,  10,  12,    1,   -9 },   // 0x65
+  {   887,   8,  14,   8,    0,  -13 },   // 0x66
+  {   898,  11,  14,  13,    1,   -9 },   // 0x67
+  {   915,  10,  14,  13,    2,  -13 },   // 0x68
+  {   929,   3,  14,   6,    2,  -13 },   // 0x69
+  {   933,   5,  18,   6,    0,  -13 },   // 0x6A
+  {   946,  11,  14,  12,    2,  -13 },   // 0x6B
+  {   964,   3,  14,   6,    2,  -13 },   // 0x6C
+  {   967,  15,  10,  18,    2,   -9 },   // 0x6D
+  {   984,  10,  10,  13,    2,   -9 },   // 0x6E
+  {   994,  11,  10,  12,    1,   -9 },   // 0x6F
+  {  1005,  11,  14,  13,    2,   -9 },   // 0x70
+  {  1021,  11,  14,  13,    1,   -9 },   // 0x71
+  {  1038,   7,  10,   9,    2,   -9 },   // 0x72
+  {  1046,   9,  10,  11,    1,   -9 },   // 0x73
+  {  1054,   8,  13,   9,    1,  -12 },   // 0x74
+  {  1064,  10,  10,  13,    2,   -9 },   // 0x75
+  {  1074,  11,  10,  12,    1,   -9 },   // 0x76
+  {  1087,  15,  10,  16,    1,   -9 },   // 0x77
+  {  1108,  11,  10,  12,    1,   -9 },   // 0x78
+  {  1122,  11,  14,  12,    1,   -9 },   // 0x79
+  {  1140,   9,  10,  10,    1,   -9 },   // 0x7A
+  {  1148,   9,  17,  13,    2,  -13 },   // 0x7B
+  {  1162,   2,  18,   7,    2,  -13 },   // 0x7C
+  {  1165,   9,  17,  13,    2,  -13 },   // 0x7D
+  {  1178,  11,   3,  15,    2,   -6 },   // 0x7E
+  {  1181,   9,  16,  11,    1,  -12 },   // 0x7F
+  {  1199,   9,  16,  11,    1,  -12 },   // 0x80
+  {  1217,   9,  16,  11,    1,  -12 },   // 0x81
+  {  1235,   9,  16,  11,    1,  -12 },   // 0x82
+  {  1253,   9,  16,  11,    1,  -12 },   // 0x83
+  {  1271,   9,  16,  11,    1,  -12 },   // 0x84
+  {  1289,   9,  16,  11,    1,  -12 },   // 0x85
+  {  1307,   9,  16,  11,    1,  -12 },   // 0x86
+  {  1325,   9,  16,  11,    1,  -12 },   // 0x87
+  {  1343,   9,  16,  11,    1,  -12 },   // 0x88
+  {  1361,   9,  16,  11,    1,  -12 },   // 0x89
+  {  1379,   9,  16,  11,    1,  -12 },   // 0x8A
+  {  1397,   9,  16,  11,    1,  -12 },   // 0x8B
+  {  1415,   9,  16,  11,    1,  -12 },   // 0x8C
+  {  1433,   9,  16,  11,    1,  -12 },   // 0x8D
+  {  1451,   9,  16,  11,    1,  -12 },   // 0x8E
+  {  1469,   9,  16,  11,    1,  -12 },   // 0x8F
+  {  1487,   9,  16,  11,    1,  -12 },   // 0x90
+  {  1505,   9,  16,  11,    1,  -12 },   // 0x91
+  {  1523,   9,  16,  11,    1,  -12 },   // 0x92
+  {  1541,   9,  16,  11,    1,  -12 },   // 0x93
+  {  1559,   9,  16,  11,    1,  -12 },   // 0x94
+  {  1577,   9,  16,  11,    1,  -12 },   // 0x95
+  {  1595,   9,  16,  11,    1,  -12 },   // 0x96
+  {  1613,   9,  16,  11,    1,  -12 },   // 0x97
+  {  1631,   9,  16,  11,    1,  -12 },   // 0x98
+  {  1649,   9,  16,  11,    1,  -12 },   // 0x99
+  {  1667,   9,  16,  11,    1,  -12 },   // 0x9A
+  {  1685,   9,  16,  11,    1,  -12 },   // 0x9B
+  {  1703,   9,  16,  11,    1,  -12 },   // 0x9C
+  {  1721,   9,  16,  11,    1,  -12 },   // 0x9D
+  {  1739,   9,  16,  11,    1,  -12 },   // 0x9E
+  {  1757,   9,  16,  11,    1,  -12 },   // 0x9F
+  {  1775,   1,   1,   6,    0,    0 },   // 0xA0
+  {  1775,   3,  13,   8,    3,   -9 },   // 0xA1
+  {  1778,   8,  16,  13,    2,  -12 },   // 0xA2
+  {  1796,  10,  13,  13,    1,  -12 },   // 0xA3
+  {  1810,  10,  10,  11,    1,   -9 },   // 0xA4
+  {  1822,  11,  13,  13,    1,  -12 },   // 0xA5
+  {  1837,   2,  16,   7,    2,  -12 },   // 0xA6
+  {  1840,   9,  15,   9,    1,  -12 },   // 0xA7
+  {  1857,   5,   2,   9,    2,  -13 },   // 0xA8
+  {  1860,  13,  13,  18,    2,  -12 },   // 0xA9
+  {  1883,   7,  10,  10,    1,  -12 },   // 0xAA
+  {  1891,   8,   8,  12,    1,   -8 },   // 0xAB
+  {  1903,  11,   5,  15,    2,   -7 },   // 0xAC
+  {  1909,   6,   3,   7,    1,   -6 },   // 0xAD
+  {  1911,  13,  13,  18,    2,  -12 },   // 0xAE
+  {  1935,   6,   2,   9,    2,  -13 },   // 0xAF
+  {  1937,   6,   6,   9,    2,  -12 },   // 0xB0
+  {  1943,  12,  11,  15,    2,  -10 },   // 0xB1
+  {  1954,   6,   8,   8,    1,  -12 },   // 0xB2
+  {  1961,   6,   8,   8,    1,  -12 },   // 0xB3
+  {  1967,   5,   3,   9,    3,  -13 },   // 0xB4
+  {  1970,  11,  14,  13,    2,   -9 },   // 0xB5
+  {  1988,  10,  15,  11,    1,  -12 },   // 0xB6
+  {  2009,   3,   3,   7,    2,   -7 },   // 0xB7
+  {  2011,   4,   4,   9,    2,    1 },   // 0xB8
+  {  2014,   6,   8,   8,    1,  -12 },   // 0xB9
+  {  2020,   8,  10,  10,    1,  -12 },   // 0xBA
+  {  2030,   8,   8,  12,    2,   -8 },   // 0xBB
+  {  2042,  16,  13,  19,    1,  -12 },   // 0xBC
+  {  2067,  17,  14,  19,    1,  -12 },   // 0xBD
+  {  2093,  16,  13,  19,    1,  -12 },   // 0xBE
+  {  2120,   8,  14,  10,    1,   -9 },   // 0xBF
+  {  2132,  14,  16,  14,    0,  -15 },   // 0xC0
+  {  2154,  14,  16,  14,    0,  -15 },   // 0xC1
+  {  2176,  14,  16,  14,    0,  -15 },   // 0xC2
+  {  2199,  14,  17,  14,    0,  -16 },   // 0xC3
+  {  2223,  14,  16,  14,    0,  -15 },   // 0xC4
+  {  2246,  14,  17,  14,    0,  -16 },   // 0xC5
+  {  2271,  18,  13,  20,    0,  -12 },   // 0xC6
+  {  2293,  11,  17,  13,    1,  -12 },   // 0xC7
+  {  2313,   9,  16,  12,    2,  -15 },   // 0xC8
+  {  2326,   9,  16,  12,    2,  -15 },   // 0xC9
+  {  2338,   9,  16,  12,    2,  -15 },   // 0xCA
+  {  2351,   9,  16,  12,    2,  -15 },   // 0xCB
+  {  2365,   4,  16,   7,    1,  -15 },   // 0xCC
+  {  2377,   4,  16,   7,    2,  -15 },   // 0xCD
+  {  2389,   7,  16,   7,    0,  -15 },   // 0xCE
+  {  2402,   5,  16,   7,    1,  -15 },   // 0xCF
+  {  2414,  14,  13,  15,    0,  -12 },   // 0xD0
+  {  2432,  12,  17,  15,    2,  -16 },   // 0xD1
+  {  2453,  13,  16,  15,    1,  -15 },   // 0xD2
+  {  2473,  13,  16,  15,    1,  -15 },   // 0xD3
+  {  2493,  13,  16,  15,    1,  -15 },   // 0xD4
+  {  2513,  13,  17,  15,    1,  -16 },   // 0xD5
+  {  2535,  13,  16,  15,    1,  -15 },   // 0xD6
+  {  2556,  11,  11,  15,    2,  -10 },   // 0xD7
+  {  2572,  14,  13,  15,    0,  -12 },   // 0xD8
+  {  2594,  12,  16,  16,    2,  -15 },   // 0xD9
+  {  2609,  12,  16,  16,    2,  -15 },   // 0xDA
+  {  2624,  12,  16,  16,    2,  -15 },   // 0xDB
+  {  2639,  12,  16,  16,    2,  -15 },   // 0xDC
+  {  2655,  13,  16,  13,    0,  -15 },   // 0xDD
+  {  2674,  11,  13,  13,    2,  -12 },   // 0xDE
+  {  2688,  11,  14,  14,    2,  -13 },   // 0xDF
+  {  2706,  10,  14,  12,    1,  -13 },   // 0xE0
+  {  2720,  10,  14,  12,    1,  -13 },   // 0xE1
+  {  2734,  10,  14,  12,    1,  -13 },   // 0xE2
+  {  2749,  10,  14,  12,    1,  -13 },   // 0xE3
+  {  2764,  10,  14,  12,    1,  -13 },   // 0xE4
+  {  2779,  10,  16,  12,    1,  -15 },   // 0xE5
+  {  2796,  17,  10,  18,    1,   -9 },   // 0xE6
+  {  2813,   9,  14,  11,    1,   -9 },   // 0xE7
+  {  2827,  11,  14,  12,    1,  -13 },   // 0xE8
+  {  2842,  11,  14,  12,    1,  -13 },   // 0xE9
+  {  2857,  11,  14,  12,    1,  -13 },   // 0xEA
+  {  2873,  11,  14,  12,    1,  -13 },   // 0xEB
+  {  2888,   5,  14,   6,    0,  -13 },   // 0xEC
+  {  2899,   5,  14,   6,    2,  -13 },   // 0xED
+  {  2910,   7,  14,   6,    0,  -13 },   // 0xEE
+  {  2922,   5,  14,   6,    1,  -13 },   // 0xEF
+  {  2933,  11,  14,  12,    1,  -13 },   // 0xF0
+  {  2948,  10,  14,  13,    2,  -13 },   // 0xF1
+  {  2962,  11,  14,  12,    1,  -13 },   // 0xF2
+  {  2977,  11,  14,  12,    1,  -13 },   // 0xF3
+  {  2992,  11,  14,  12,    1,  -13 },   // 0xF4
+  {  3008,  11,  14,  12,    1,  -13 },   // 0xF5
+  {  3024,  11,  14,  12,    1,  -13 },   // 0xF6
+  {  3039,  11,  10,  15,    2,  -10 },   // 0xF7
+  {  3049,  11,  12,  12,    1,  -10 },   // 0xF8
+  {  3063,  10,  14,  13,    2,  -13 },   // 0xF9
+  {  3077,  10,  14,  13,    2,  -13 },   // 0xFA
+  {  3091,  10,  14,  13,    2,  -13 },   // 0xFB
+  {  3104,  10,  14,  13,    2,  -13 },   // 0xFC
+  {  3118,  11,  18,  12,    1,  -13 },   // 0xFD
+  {  3140,  11,  18,  13,    2,  -13 },   // 0xFE
+  {  3161,  11,  18,  12,    1,  -13 }    // 0xFF
+};
+
+const RleFont DejaVuSans_Bold9pt8bRle = {
+  DejaVuSans_Bold9pt8bRleRuns, DejaVuSans_Bold9pt8bRleGlyphs, sizeof(DejaVuSans_Bold9pt8bRleRuns), 0x20, 0xFF, 21 };
+#endif // DEJAVUSANS_BOLD9PT8B_RLE_H
@@ -538,4 +538,235 @@ const GFXfont DejaVuSans_Oblique9pt8b PROGMEM = {
   0x20, 0xFF, 21 };
 
 // Approx. 5218 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique9pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   0,   7,   5 },   // 0x21
+  {   2,   8,   8 },   // 0x22
+  {   1,  15,  14 },   // 0x23
+  {   1,  11,  11 },   // 0x24
+  {   2,  17,  16 },   // 0x25
+  {   0,  14,  12 },   // 0x26
+  {   2,   5,   4 },   // 0x27
+  {   1,   7,   8 },   // 0x28
+  {  -1,   7,   6 },   // 0x29
+  {   1,   9,   8 },   // 0x2A
+  {   2,  15,  14 },   // 0x2B
+  {   1,   6,   4 },   // 0x2C
+  {   1,   7,   6 },   // 0x2D
+  {   1,   6,   3 },   // 0x2E
+  {  -1,   6,   8 },   // 0x2F
+  {   1,  11,  11 },   // 0x30
+  {   1,  11,   9 },   // 0x31
+  {   0,  11,  10 },   // 0x32
+  {   0,  11,  10 },   // 0x33
+  {   0,  11,  10 },   // 0x34
+  {   0,  11,  10 },   // 0x35
+  {   1,  11,  11 },   // 0x36
+  {   2,  11,  12 },   // 0x37
+  {   1,  11,  11 },   // 0x38
+  {   1,  11,  11 },   // 0x39
+  {   1,   6,   5 },   // 0x3A
+  {   1,   6,   5 },   // 0x3B
+  {   2,  15,  13 },   // 0x3C
+  {   2,  15,  13 },   // 0x3D
+  {   2,  15,  13 },   // 0x3E
+  {   2,  10,   9 },   // 0x3F
+  {   1,  18,  17 },   // 0x40
+  {  -1,  12,  11 },   // 0x41
+  {   0,  12,  11 },   // 0x42
+  {   0,  13,  12 },   // 0x43
+  {   0,  14,  13 },   // 0x44
+  {   0,  11,  11 },   // 0x45
+  {   0,  10,  10 },   // 0x46
+  {   0,  14,  12 },   // 0x47
+  {   0,  14,  13 },   // 0x48
+  {   0,   5,   5 },   // 0x49
+  {  -3,   5,   5 },   // 0x4A
+  {   0,  12,  13 },   // 0x4B
+  {   0,  10,   8 },   // 0x4C
+  {   0,  16,  15 },   // 0x4D
+  {   0,  13,  13 },   // 0x4E
+  {   0,  14,  13 },   // 0x4F
+  {   0,  11,  10 },   // 0x50
+  {   0,  14,  13 },   // 0x51
+  {   0,  13,  10 },   // 0x52
+  {   0,  11,  11 },   // 0x53
+  {   1,  11,  13 },   // 0x54
+  {   1,  13,  13 },   // 0x55
+  {   1,  12,  13 },   // 0x56
+  {   2,  18,  19 },   // 0x57
+  {   0,  12,  12 },   // 0x58
+  {   1,  11,  12 },   // 0x59
+  {   0,  12,  13 },   // 0x5A
+  {   1,   7,   8 },   // 0x5B
+  {   2,   6,   5 },   // 0x5C
+  {  -1,   7,   6 },   // 0x5D
+  {   2,  15,  13 },   // 0x5E
+  {   0,   9,   9 },   // 0x5F
+  {   3,   9,   7 },   // 0x60
+  {   1,  10,  10 },   // 0x61
+  {   1,  11,  11 },   // 0x62
+  {   1,  10,  10 },   // 0x63
+  {   1,  11,  12 },   // 0x64
+  {   1,  11,  11 },   // 0x65
+  {   1,   6,   8 },   // 0x66
+  {   1,  11,  11 },   // 0x67
+  {   1,  11,  11 },   // 0x68
+  {   1,   5,   6 },   // 0x69
+  {  -2,   5,   6 },   // 0x6A
+  {   1,  10,  11 },   // 0x6B
+  {   1,   5,   6 },   // 0x6C
+  {   1,  17,  16 },   // 0x6D
+  {   1,  11,  11 },   // 0x6E
+  {   1,  11,  11 },   // 0x6F
+  {   0,  11,  11 },   // 0x70
+  {   1,  11,  11 },   // 0x71
+  {   0,   8,   8 },   // 0x72
+  {   0,   9,   9 },   // 0x73
+  {   1,   7,   7 },   // 0x74
+  {   1,  11,  11 },   // 0x75
+  {   1,  10,  11 },   // 0x76
+  {   1,  14,  15 },   // 0x77
+  {   0,  10,  11 },   // 0x78
+  {   0,  11,  12 },   // 0x79
+  {   0,   9,  10 },   // 0x7A
+  {   2,  11,  11 },   // 0x7B
+  {   2,   6,   4 },   // 0x7C
+  {   0,  11,   9 },   // 0x7D
+  {   2,  15,  13 },   // 0x7E
+  {   1,  11,  10 },   // 0x7F
+  {   1,  11,  10 },   // 0x80
+  {   1,  11,  10 },   // 0x81
+  {   1,  11,  10 },   // 0x82
+  {   1,  11,  10 },   // 0x83
+  {   1,  11,  10 },   // 0x84
+  {   1,  11,  10 },   // 0x85
+  {   1,  11,  10 },   // 0x86
+  {   1,  11,  10 },   // 0x87
+  {   1,  11,  10 },   // 0x88
+  {   1,  11,  10 },   // 0x89
+  {   1,  11,  10 },   // 0x8A
+  {   1,  11,  10 },   // 0x8B
+  {   1,  11,  10 },   // 0x8C
+  {   1,  11,  10 },   // 0x8D
+  {   1,  11,  10 },   // 0x8E
+  {   1,  11,  10 },   // 0x8F
+  {   1,  11,  10 },   // 0x90
+  {   1,  11,  10 },   // 0x91
+  {   1,  11,  10 },   // 0x92
+  {   1,  11,  10 },   // 0x93
+  {   1,  11,  10 },   // 0x94
+  {   1,  11,  10 },   // 0x95
+  {   1,  11,  10 },   // 0x96
+  {   1,  11,  10 },   // 0x97
+  {   1,  11,  10 },   // 0x98
+  {   1,  11,  10 },   // 0x99
+  {   1,  11,  10 },   // 0x9A
+  {   1,  11,  10 },   // 0x9B
+  {   1,  11,  10 },   // 0x9C
+  {   1,  11,  10 },   // 0x9D
+  {   1,  11,  10 },   // 0x9E
+  {   1,  11,  10 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   2,   7,   7 },   // 0xA1
+  {   1,  11,  10 },   // 0xA2
+  {   0,  11,  11 },   // 0xA3
+  {   1,  11,  10 },   // 0xA4
+  {   1,  11,  12 },   // 0xA5
+  {   2,   6,   4 },   // 0xA6
+  {  -1,   9,   9 },   // 0xA7
+  {   3,   9,   8 },   // 0xA8
+  {   2,  18,  15 },   // 0xA9
+  {   1,   8,   8 },   // 0xAA
+  {   1,  11,  10 },   // 0xAB
+  {   2,  15,  13 },   // 0xAC
+  {   1,   7,   6 },   // 0xAD
+  {   2,  18,  15 },   // 0xAE
+  {   3,   9,   9 },   // 0xAF
+  {   2,   9,   8 },   // 0xB0
+  {   2,  15,  14 },   // 0xB1
+  {   0,   7,   6 },   // 0xB2
+  {   0,   7,   6 },   // 0xB3
+  {   5,   9,  10 },   // 0xB4
+  {   0,  11,  11 },   // 0xB5
+  {   1,  11,  10 },   // 0xB6
+  {   2,   6,   4 },   // 0xB7
+  {   1,   9,   5 },   // 0xB8
+  {   1,   7,   5 },   // 0xB9
+  {   1,   8,   8 },   // 0xBA
+  {   1,  11,  10 },   // 0xBB
+  {   1,  17,  16 },   // 0xBC
+  {   1,  17,  16 },   // 0xBD
+  {   0,  17,  16 },   // 0xBE
+  {   0,  10,   7 },   // 0xBF
+  {  -1,  12,  11 },   // 0xC0
+  {  -1,  12,  11 },   // 0xC1
+  {  -1,  12,  11 },   // 0xC2
+  {  -1,  12,  11 },   // 0xC3
+  {  -1,  12,  11 },   // 0xC4
+  {  -1,  12,  11 },   // 0xC5
+  {  -1,  18,  18 },   // 0xC6
+  {   0,  13,  12 },   // 0xC7
+  {   0,  11,  11 },   // 0xC8
+  {   0,  11,  11 },   // 0xC9
+  {   0,  11,  11 },   // 0xCA
+  {   0,  11,  11 },   // 0xCB
+  {   0,   5,   5 },   // 0xCC
+  {   0,   5,   7 },   // 0xCD
+  {   0,   5,   7 },   // 0xCE
+  {   0,   5,   7 },   // 0xCF
+  {   0,  14,  13 },   // 0xD0
+  {   0,  13,  13 },   // 0xD1
+  {   0,  14,  13 },   // 0xD2
+  {   0,  14,  13 },   // 0xD3
+  {   0,  14,  13 },   // 0xD4
+  {   0,  14,  13 },   // 0xD5
+  {   0,  14,  13 },   // 0xD6
+  {   2,  15,  12 },   // 0xD7
+  {  -1,  14,  14 },   // 0xD8
+  {   1,  13,  13 },   // 0xD9
+  {   1,  13,  13 },   // 0xDA
+  {   1,  13,  13 },   // 0xDB
+  {   1,  13,  13 },   // 0xDC
+  {   1,  11,  12 },   // 0xDD
+  {   0,  11,  10 },   // 0xDE
+  {   0,  11,  10 },   // 0xDF
+  {   1,  10,  10 },   // 0xE0
+  {   1,  10,  11 },   // 0xE1
+  {   1,  10,  10 },   // 0xE2
+  {   1,  10,  10 },   // 0xE3
+  {   1,  10,  10 },   // 0xE4
+  {   1,  10,  10 },   // 0xE5
+  {   1,  18,  17 },   // 0xE6
+  {   1,  10,  10 },   // 0xE7
+  {   1,  11,  11 },   // 0xE8
+  {   1,  11,  11 },   // 0xE9
+  {   1,  11,  11 },   // 0xEA
+  {   1,  11,  11 },   // 0xEB
+  {   1,   5,   5 },   // 0xEC
+  {   1,   5,   8 },   // 0xED
+  {   1,   5,   7 },   // 0xEE
+  {   1,   5,   6 },   // 0xEF
+  {   1,  11,  10 },   // 0xF0
+  {   1,  11,  11 },   // 0xF1
+  {   1,  11,  11 },   // 0xF2
+  {   1,  11,  11 },   // 0xF3
+  {   1,  11,  11 },   // 0xF4
+  {   1,  11,  11 },   // 0xF5
+  {   1,  11,  11 },   // 0xF6
+  {   2,  15,  14 },   // 0xF7
+  {   0,  11,  11 },   // 0xF8
+  {   1,  11,  11 },   // 0xF9
+  {   1,  11,  11 },   // 0xFA
+  {   1,  11,  11 },   // 0xFB
+  {   1,  11,  11 },   // 0xFC
+  {   0,  11,  12 },   // 0xFD
+  {   0,  12,  11 },   // 0xFE
+  {   0,  11,  12 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique9pt8bWidths = { DejaVuSans_Oblique9pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
 #endif // DEJAVUSANSOBLIQUE9PTLAT1__H
@@ -0,0 +1,852 @@
+#ifndef DEJAVUSANS_OBLIQUE9PT8BAA2_H
+#define DEJAVUSANS_OBLIQUE9PT8BAA2_H
+// Police anti-aliasée 2 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans_Oblique9pt8bAa2Bitmaps[] PROGMEM = {
+  0x07, 0x81, 0xD0, 0xB0, 0x2C, 0x0E, 0x03, 0x81, 0xD0, 0x70, 0x18, 0x00,
+  0x01, 0x01, 0xD0, 0xB4, 0x00, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70,
+  0xD0, 0x00, 0x28, 0x38, 0x00, 0x0D, 0x0D, 0x00, 0x07, 0x07, 0x00, 0x01,
+  0xC2, 0xC0, 0x2F, 0xFF, 0xFF, 0x45, 0x79, 0x75, 0x40, 0x1C, 0x1C, 0x00,
+  0x0B, 0x0A, 0x00, 0xBF, 0xFF, 0xFD, 0x15, 0xE5, 0xD5, 0x00, 0x70, 0x70,
+  0x00, 0x1C, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x90, 0x00, 0x6D, 0x00, 0x2F, 0xFE, 0x0B, 0x9D, 0xA0, 0xE1, 0x80, 0x0E,
+  0x14, 0x00, 0xBA, 0x40, 0x01, 0xFF, 0x40, 0x03, 0x7C, 0x00, 0x61, 0xD0,
+  0x05, 0x1D, 0x79, 0x9B, 0x82, 0xFF, 0x90, 0x00, 0x80, 0x00, 0x18, 0x00,
+  0x01, 0x40, 0x00, 0x0B, 0xE0, 0x01, 0xC2, 0x97, 0x80, 0x74, 0x74, 0x28,
+  0x0D, 0x07, 0x02, 0x82, 0x80, 0x74, 0x74, 0xA0, 0x02, 0xFD, 0x1C, 0x00,
+  0x00, 0x07, 0x5B, 0x80, 0x00, 0xD3, 0x5A, 0x00, 0x28, 0xA0, 0x70, 0x0A,
+  0x0D, 0x07, 0x01, 0xC0, 0xD0, 0xB0, 0x70, 0x0A, 0x5D, 0x0D, 0x00, 0x2F,
+  0x40, 0x00, 0x7F, 0x80, 0x02, 0xE6, 0xD0, 0x07, 0x40, 0x00, 0x07, 0x40,
+  0x00, 0x07, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x2D, 0xF4, 0x0A, 0xB4, 0x7C,
+  0x1D, 0xE0, 0x1E, 0x2C, 0xE0, 0x0B, 0xF4, 0xF0, 0x03, 0xE0, 0xBE, 0x6F,
+  0xF4, 0x1B, 0xE4, 0x7C, 0x77, 0x77, 0x70, 0x00, 0x74, 0x07, 0x40, 0x38,
+  0x02, 0xC0, 0x0E, 0x00, 0xB0, 0x03, 0x80, 0x1D, 0x00, 0x74, 0x02, 0xC0,
+  0x0B, 0x00, 0x2C, 0x00, 0x74, 0x00, 0xD0, 0x02, 0x80, 0x07, 0x00, 0x02,
+  0x80, 0x1D, 0x00, 0xE0, 0x0A, 0x00, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00,
+  0xE0, 0x1D, 0x02, 0xC0, 0x78, 0x0B, 0x01, 0xD0, 0x38, 0x0A, 0x00, 0x00,
+  0xC0, 0x10, 0xC1, 0x78, 0xCA, 0x07, 0xF4, 0x07, 0xE4, 0x29, 0xDA, 0x10,
+  0xC1, 0x00, 0xC0, 0x00, 0x10, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xD0, 0x0F, 0xFF, 0xFF, 0xD5, 0x6D,
+  0x55, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00,
+  0x19, 0x2D, 0x38, 0x74, 0x90, 0xFF, 0x95, 0x40, 0x1B, 0xF0, 0x00, 0x07,
+  0x40, 0x02, 0x80, 0x01, 0xD0, 0x00, 0xA0, 0x00, 0x74, 0x00, 0x28, 0x00,
+  0x1D, 0x00, 0x0A, 0x00, 0x07, 0x40, 0x02, 0x80, 0x01, 0xD0, 0x00, 0xA0,
+  0x00, 0x74, 0x00, 0x28, 0x00, 0x09, 0x00, 0x00, 0x01, 0xBE, 0x00, 0xB9,
+  0xB8, 0x1E, 0x02, 0xC3, 0xC0, 0x1D, 0x74, 0x01, 0xDB, 0x00, 0x1D, 0xF0,
+  0x02, 0xCE, 0x00, 0x3C, 0xE0, 0x07, 0x8E, 0x00, 0xB0, 0xF0, 0x1E, 0x07,
+  0x9B, 0x80, 0x1F, 0xD0, 0x00, 0x06, 0xFC, 0x1E, 0xB8, 0x00, 0x74, 0x00,
+  0x74, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xD0, 0x01, 0xD0, 0x02,
+  0xC0, 0x02, 0xC0, 0x57, 0xD5, 0xFF, 0xFD, 0x01, 0xBF, 0x40, 0xBA, 0xBE,
+  0x04, 0x00, 0xF0, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x0B,
+  0x40, 0x02, 0xD0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x07, 0xD5,
+  0x54, 0xFF, 0xFF, 0x80, 0x02, 0xBF, 0x80, 0x69, 0x6E, 0x00, 0x00, 0xB0,
+  0x00, 0x0F, 0x00, 0x06, 0xD0, 0x1F, 0xE0, 0x01, 0x5B, 0x80, 0x00, 0x2C,
+  0x00, 0x02, 0xD0, 0x00, 0x2C, 0x00, 0x07, 0x8B, 0x9A, 0xE0, 0x6F, 0xE4,
+  0x00, 0x00, 0x02, 0xE0, 0x00, 0xBD, 0x00, 0x1E, 0xD0, 0x07, 0x6C, 0x00,
+  0xE2, 0xC0, 0x28, 0x38, 0x0B, 0x03, 0x81, 0xD0, 0x74, 0x74, 0x0B, 0x4B,
+  0xFF, 0xFE, 0x55, 0x5F, 0x50, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xFF,
+  0xF0, 0x39, 0x55, 0x07, 0x40, 0x00, 0x74, 0x00, 0x0B, 0xFE, 0x00, 0xA5,
+  0xBC, 0x00, 0x02, 0xD0, 0x00, 0x1D, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00,
+  0x07, 0x87, 0x96, 0xE0, 0x6F, 0xE4, 0x00, 0x00, 0xAF, 0x90, 0x7E, 0xA9,
+  0x0E, 0x00, 0x02, 0xC0, 0x00, 0x3A, 0xFD, 0x07, 0xE5, 0xF4, 0xB8, 0x07,
+  0x8B, 0x40, 0x38, 0xF0, 0x03, 0x8F, 0x00, 0x74, 0xB4, 0x0B, 0x07, 0xD7,
+  0xD0, 0x1B, 0xE4, 0x00, 0xFF, 0xFF, 0xD5, 0x56, 0xD0, 0x00, 0xE0, 0x00,
+  0xB4, 0x00, 0x78, 0x00, 0x2C, 0x00, 0x1D, 0x00, 0x0E, 0x00, 0x0B, 0x40,
+  0x07, 0x80, 0x03, 0xC0, 0x01, 0xD0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xBF,
+  0x80, 0x1F, 0x9B, 0xC0, 0xB0, 0x07, 0x43, 0xC0, 0x1D, 0x07, 0x81, 0xF0,
+  0x0B, 0xFE, 0x00, 0xF5, 0xB4, 0x0B, 0x00, 0x70, 0x74, 0x01, 0xD1, 0xD0,
+  0x07, 0x47, 0x80, 0x2D, 0x0B, 0x9B, 0xE0, 0x0B, 0xF9, 0x00, 0x02, 0xF9,
+  0x07, 0xE6, 0xD3, 0xC0, 0x3D, 0xD0, 0x0B, 0xB0, 0x02, 0xED, 0x01, 0xF7,
+  0x91, 0xFC, 0x7F, 0xDE, 0x01, 0x47, 0x40, 0x03, 0x80, 0x02, 0xD3, 0x9B,
+  0xD0, 0xBF, 0x80, 0x00, 0x04, 0x1D, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0xB0, 0xE0, 0x01, 0x01, 0xE0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x2D, 0x0F, 0x07, 0x42, 0x40, 0x00, 0x00, 0x04, 0x00, 0x01, 0xF0, 0x01,
+  0xBE, 0x41, 0xBE, 0x40, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x06, 0xF9, 0x00,
+  0x00, 0x6F, 0x90, 0x00, 0x1B, 0xF8, 0x00, 0x01, 0xB0, 0xFF, 0xFF, 0xFD,
+  0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x55,
+  0x55, 0x50, 0xE4, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xE4, 0x00, 0x06,
+  0xF9, 0x00, 0x01, 0xBC, 0x00, 0x6F, 0x90, 0x6F, 0x90, 0x2F, 0xD0, 0x00,
+  0xE4, 0x00, 0x00, 0x1B, 0xE2, 0xE6, 0xE4, 0x03, 0xC0, 0x0E, 0x00, 0xB4,
+  0x0B, 0x40, 0xF0, 0x0B, 0x00, 0x38, 0x00, 0x90, 0x01, 0x00, 0x1D, 0x00,
+  0xB0, 0x00, 0x00, 0x1A, 0xFE, 0x40, 0x00, 0xB9, 0x56, 0xE0, 0x03, 0x90,
+  0x00, 0x28, 0x0E, 0x00, 0x00, 0x0D, 0x28, 0x0B, 0xE7, 0x0A, 0x74, 0x2D,
+  0x6F, 0x0A, 0xA0, 0x70, 0x0E, 0x0A, 0x90, 0xA0, 0x0E, 0x0D, 0xD0, 0xE0,
+  0x1D, 0x2C, 0xD0, 0xB4, 0x7D, 0xB0, 0xA0, 0x2F, 0xEF, 0x80, 0x70, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x05, 0x00, 0x0F, 0x40, 0x6D, 0x00, 0x02, 0xFF,
+  0xE4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xE0,
+  0x00, 0x0D, 0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x34, 0x74, 0x00, 0xA0, 0x74,
+  0x01, 0xD0, 0x38, 0x02, 0x80, 0x38, 0x07, 0xFF, 0xFC, 0x0E, 0x55, 0x6D,
+  0x2C, 0x00, 0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00, 0x0E, 0x03, 0xFF, 0xE0,
+  0x1E, 0x56, 0xE0, 0xB4, 0x03, 0xC2, 0xC0, 0x0E, 0x0E, 0x01, 0xB4, 0x3F,
+  0xFE, 0x01, 0xE5, 0x6E, 0x07, 0x40, 0x2D, 0x2C, 0x00, 0x74, 0xF0, 0x02,
+  0xD3, 0x80, 0x1F, 0x1E, 0x56, 0xF4, 0x7F, 0xFE, 0x00, 0x00, 0x1B, 0xF9,
+  0x01, 0xFA, 0x6F, 0x07, 0xD0, 0x02, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x2D, 0x00, 0x14, 0x0F, 0xA6, 0xF4, 0x02, 0xFF, 0x90,
+  0x03, 0xFF, 0xE4, 0x01, 0xE5, 0xAF, 0x40, 0xB4, 0x00, 0xF0, 0x2C, 0x00,
+  0x1E, 0x0F, 0x00, 0x03, 0x83, 0x80, 0x00, 0xE1, 0xD0, 0x00, 0x78, 0x74,
+  0x00, 0x1D, 0x2C, 0x00, 0x0B, 0x0F, 0x00, 0x07, 0x83, 0x80, 0x0B, 0x81,
+  0xE5, 0xAF, 0x80, 0x7F, 0xFA, 0x40, 0x00, 0x03, 0xFF, 0xFC, 0x1E, 0x55,
+  0x50, 0xB4, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0xFF, 0x81,
+  0xE5, 0x55, 0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80,
+  0x00, 0x1E, 0x55, 0x50, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1E, 0x55,
+  0x40, 0xB4, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0xFE, 0x01,
+  0xE5, 0x54, 0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80,
+  0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x7E,
+  0x9A, 0xE0, 0x7D, 0x00, 0x14, 0x2D, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B,
+  0x00, 0x00, 0x03, 0x80, 0x1F, 0xF0, 0xE0, 0x01, 0x7C, 0x78, 0x00, 0x0E,
+  0x0F, 0x00, 0x03, 0x82, 0xD0, 0x01, 0xD0, 0x3E, 0x9A, 0xF0, 0x02, 0xFF,
+  0x90, 0x00, 0x03, 0x80, 0x03, 0x81, 0xD0, 0x01, 0xD0, 0xB4, 0x00, 0x74,
+  0x2C, 0x00, 0x2C, 0x0E, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0x81, 0xE5, 0x56,
+  0xE0, 0x74, 0x00, 0x74, 0x2C, 0x00, 0x2C, 0x0F, 0x00, 0x0F, 0x03, 0x80,
+  0x03, 0x81, 0xD0, 0x01, 0xE0, 0x74, 0x00, 0x74, 0x00, 0x03, 0x81, 0xD0,
+  0xB4, 0x2C, 0x0F, 0x03, 0x81, 0xD0, 0x74, 0x2C, 0x0F, 0x03, 0x81, 0xE0,
+  0x74, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x3C,
+  0x00, 0x38, 0x00, 0x74, 0x00, 0x74, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xE0,
+  0x01, 0xE0, 0x01, 0xD0, 0x02, 0xC0, 0x03, 0x80, 0x6F, 0x40, 0xB9, 0x00,
+  0x03, 0x80, 0x1F, 0x41, 0xD0, 0x1E, 0x00, 0xB4, 0x2E, 0x00, 0x2C, 0x2D,
+  0x00, 0x0F, 0x7D, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x77,
+  0xD0, 0x00, 0x2C, 0x3C, 0x00, 0x0F, 0x07, 0x80, 0x03, 0x80, 0x78, 0x01,
+  0xE0, 0x0B, 0x40, 0x74, 0x00, 0xB4, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00,
+  0xB4, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0x74,
+  0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x01, 0xE5, 0x55, 0x7F, 0xFF,
+  0x80, 0x03, 0xE0, 0x01, 0xF8, 0x1F, 0xC0, 0x0B, 0xD0, 0xBB, 0x00, 0x7B,
+  0x42, 0xDD, 0x03, 0xAC, 0x0E, 0x34, 0x1C, 0xB0, 0x38, 0xE0, 0xE3, 0x81,
+  0xD2, 0x8B, 0x1D, 0x07, 0x4B, 0x74, 0x74, 0x2C, 0x1E, 0x82, 0xC0, 0xF0,
+  0x7D, 0x0B, 0x03, 0x80, 0x90, 0x38, 0x1D, 0x00, 0x00, 0xE0, 0x74, 0x00,
+  0x07, 0x40, 0x03, 0xD0, 0x03, 0x81, 0xF8, 0x01, 0xD0, 0xBB, 0x00, 0x74,
+  0x2C, 0xD0, 0x2C, 0x0E, 0x28, 0x0F, 0x03, 0x8B, 0x03, 0x81, 0xD1, 0xD1,
+  0xD0, 0x74, 0x38, 0x74, 0x2C, 0x0B, 0x2C, 0x0F, 0x01, 0xDB, 0x03, 0x80,
+  0x3B, 0x81, 0xD0, 0x0B, 0xD0, 0x74, 0x01, 0xF4, 0x00, 0x00, 0x1B, 0xF8,
+  0x00, 0x7E, 0xAB, 0x80, 0x7D, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x1D, 0x00,
+  0x02, 0xCF, 0x00, 0x00, 0xB3, 0x80, 0x00, 0x3D, 0xE0, 0x00, 0x0E, 0x78,
+  0x00, 0x0B, 0x4E, 0x00, 0x07, 0x82, 0xD0, 0x07, 0xC0, 0x3E, 0x6B, 0xC0,
+  0x02, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0x90, 0x1E, 0x5B, 0xD0, 0xB4, 0x07,
+  0x42, 0xC0, 0x1E, 0x0E, 0x00, 0xB4, 0x38, 0x1B, 0x81, 0xFF, 0xF8, 0x07,
+  0x55, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1D, 0x00,
+  0x00, 0x74, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7E, 0xAB, 0x80, 0x7D,
+  0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x1D, 0x00, 0x02, 0xCF, 0x00, 0x00, 0xB3,
+  0x80, 0x00, 0x3D, 0xE0, 0x00, 0x0E, 0x78, 0x00, 0x0B, 0x4E, 0x00, 0x07,
+  0x82, 0xD0, 0x07, 0xC0, 0x3E, 0x6B, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x2D, 0x00, 0x03, 0xFF, 0x90, 0x1E, 0x5B, 0xC0, 0xB4,
+  0x07, 0x42, 0xC0, 0x1E, 0x0F, 0x00, 0xB4, 0x38, 0x1B, 0x81, 0xFF, 0xF4,
+  0x07, 0x56, 0xE0, 0x2C, 0x02, 0xC0, 0xF0, 0x07, 0x43, 0x80, 0x0E, 0x1D,
+  0x00, 0x2C, 0x74, 0x00, 0x74, 0x00, 0xBF, 0xE4, 0x1F, 0x9A, 0xD0, 0xF0,
+  0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x2F, 0xF8,
+  0x00, 0x01, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x84, 0x00, 0x2D, 0x2E,
+  0x5B, 0xE0, 0x6B, 0xF9, 0x00, 0xFF, 0xFF, 0xF9, 0x57, 0xD5, 0x50, 0x0F,
+  0x00, 0x00, 0x38, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x2C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x74, 0x00, 0x02,
+  0xC0, 0x00, 0x0B, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x2D, 0x00, 0x1D, 0x2C,
+  0x00, 0x2C, 0x38, 0x00, 0x3C, 0x38, 0x00, 0x38, 0x74, 0x00, 0x74, 0xB4,
+  0x00, 0x74, 0xB0, 0x00, 0xB0, 0xF0, 0x00, 0xF0, 0xF0, 0x01, 0xE0, 0xB0,
+  0x02, 0xC0, 0x7E, 0x6F, 0x40, 0x1B, 0xF9, 0x00, 0xB0, 0x00, 0x0E, 0x74,
+  0x00, 0x2D, 0x74, 0x00, 0x78, 0x38, 0x00, 0xB0, 0x38, 0x01, 0xE0, 0x2C,
+  0x03, 0xC0, 0x2C, 0x07, 0x40, 0x1D, 0x0E, 0x00, 0x0E, 0x2D, 0x00, 0x0E,
+  0x38, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x74,
+  0x01, 0xE0, 0x03, 0x9D, 0x00, 0xBC, 0x01, 0xD3, 0x80, 0x7B, 0x00, 0xF0,
+  0xE0, 0x2D, 0xC0, 0x74, 0x38, 0x0D, 0x70, 0x2C, 0x0E, 0x0B, 0x1C, 0x1E,
+  0x03, 0x83, 0x87, 0x0B, 0x00, 0xE1, 0xC1, 0xD3, 0x80, 0x2C, 0xE0, 0x75,
+  0xD0, 0x0B, 0x74, 0x0D, 0xE0, 0x02, 0xE8, 0x03, 0xB4, 0x00, 0xBD, 0x00,
+  0xFC, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xD0, 0x03, 0xC0, 0x3C,
+  0x03, 0xD0, 0x07, 0x42, 0xD0, 0x00, 0xE2, 0xD0, 0x00, 0x1E, 0xE0, 0x00,
+  0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xB6, 0xD0,
+  0x00, 0xB4, 0x38, 0x00, 0xB4, 0x0B, 0x00, 0x78, 0x01, 0xE0, 0x78, 0x00,
+  0x2C, 0x00, 0xB4, 0x00, 0x75, 0xE0, 0x07, 0x82, 0xC0, 0x78, 0x07, 0x83,
+  0xC0, 0x0B, 0x3C, 0x00, 0x1F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0xB0, 0x00,
+  0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x0B,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0xBC, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x1F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
+  0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x40, 0x7F, 0xFF, 0xFD, 0x00,
+  0x07, 0xF4, 0x2D, 0x40, 0xB0, 0x03, 0x80, 0x0D, 0x00, 0x74, 0x01, 0xC0,
+  0x0B, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x40, 0x1C, 0x00, 0xB0, 0x02, 0x80,
+  0x0E, 0x00, 0x3F, 0x40, 0x54, 0x00, 0x70, 0x70, 0x74, 0x34, 0x34, 0x38,
+  0x28, 0x28, 0x2C, 0x1C, 0x1C, 0x1D, 0x0D, 0x0E, 0x05, 0x02, 0xFC, 0x05,
+  0xE0, 0x03, 0x80, 0x1D, 0x00, 0x74, 0x02, 0xC0, 0x0A, 0x00, 0x38, 0x01,
+  0xD0, 0x07, 0x40, 0x2C, 0x00, 0xB0, 0x03, 0x80, 0x0D, 0x00, 0x74, 0x2F,
+  0xC0, 0x15, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xB8, 0x00, 0xB4, 0x78, 0x0B,
+  0x40, 0x78, 0xB4, 0x00, 0x74, 0x7F, 0xFF, 0xF1, 0x55, 0x55, 0x60, 0x38,
+  0x1C, 0x0A, 0x02, 0xBE, 0x40, 0x69, 0x7D, 0x00, 0x00, 0xE0, 0x00, 0x0E,
+  0x06, 0xFF, 0xD2, 0xE5, 0x5D, 0x38, 0x02, 0xC7, 0x40, 0x7C, 0x3D, 0x6B,
+  0x81, 0xBE, 0x34, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x01,
+  0xD0, 0x00, 0x0B, 0x2F, 0x80, 0x2F, 0x9B, 0x80, 0xF4, 0x0B, 0x43, 0x80,
+  0x1D, 0x1D, 0x00, 0x74, 0xB0, 0x02, 0xC2, 0xC0, 0x0E, 0x0F, 0x40, 0xB4,
+  0x3B, 0x5B, 0x41, 0xD7, 0xE4, 0x00, 0x02, 0xFE, 0x47, 0xE5, 0xD3, 0xC0,
+  0x02, 0xD0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xB9, 0x68, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x74, 0x00, 0x02, 0xC0, 0x00,
+  0x0A, 0x00, 0x00, 0x38, 0x06, 0xF8, 0xD0, 0x79, 0x7B, 0x43, 0x80, 0x3C,
+  0x2C, 0x00, 0xF0, 0xE0, 0x03, 0x83, 0x80, 0x0D, 0x0E, 0x00, 0xB4, 0x38,
+  0x07, 0xC0, 0xB9, 0xBF, 0x00, 0xBE, 0x78, 0x00, 0x02, 0xFD, 0x07, 0xD6,
+  0xD3, 0x80, 0x2E, 0xC0, 0x0B, 0xFF, 0xFF, 0xF9, 0x55, 0x5D, 0x00, 0x03,
+  0x80, 0x00, 0xB9, 0x6A, 0x06, 0xFE, 0x40, 0x01, 0xBD, 0x07, 0x94, 0x0B,
+  0x00, 0x0E, 0x00, 0xBF, 0xF4, 0x1E, 0x50, 0x1D, 0x00, 0x2C, 0x00, 0x28,
+  0x00, 0x38, 0x00, 0x34, 0x00, 0x74, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x01,
+  0xBE, 0x74, 0x1E, 0x5E, 0xD0, 0xE0, 0x1F, 0x0B, 0x00, 0x3C, 0x38, 0x00,
+  0xE0, 0xE0, 0x03, 0x43, 0x40, 0x1D, 0x0E, 0x00, 0xF0, 0x2E, 0x6F, 0xC0,
+  0x2F, 0x9E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xC0, 0x65, 0x7D, 0x01, 0xBF,
+  0x90, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x74, 0x00,
+  0x0B, 0x2F, 0x80, 0xBE, 0x6E, 0x0F, 0x40, 0xB0, 0xE0, 0x0B, 0x1D, 0x00,
+  0xA2, 0xC0, 0x0E, 0x2C, 0x01, 0xD3, 0x80, 0x1C, 0x34, 0x02, 0xC7, 0x40,
+  0x28, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x0B, 0x02, 0x80, 0xE0, 0x34, 0x1D,
+  0x0B, 0x02, 0xC0, 0xE0, 0x34, 0x1D, 0x00, 0x00, 0x28, 0x00, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0xB0, 0x02, 0xC0, 0x0E, 0x00, 0x34, 0x01, 0xD0, 0x07,
+  0x00, 0x2C, 0x00, 0xA0, 0x03, 0x80, 0x1D, 0x00, 0x74, 0x02, 0xC0, 0x6E,
+  0x03, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x01,
+  0xC0, 0x00, 0x0B, 0x00, 0xB4, 0x28, 0x1E, 0x00, 0xE2, 0xE0, 0x03, 0x6D,
+  0x00, 0x1F, 0xD0, 0x00, 0xBB, 0x40, 0x02, 0xCB, 0x40, 0x0E, 0x0B, 0x00,
+  0x34, 0x0E, 0x01, 0xD0, 0x1E, 0x00, 0x03, 0x80, 0xE0, 0x74, 0x1C, 0x0B,
+  0x02, 0x80, 0xE0, 0x34, 0x1D, 0x0B, 0x02, 0xC0, 0xE0, 0x34, 0x1D, 0x00,
+  0x0B, 0x2F, 0x82, 0xF8, 0x0B, 0xD6, 0xEA, 0x5E, 0x0F, 0x00, 0xF4, 0x0B,
+  0x0E, 0x00, 0xE0, 0x0B, 0x1D, 0x00, 0xD0, 0x0E, 0x2C, 0x01, 0xD0, 0x0E,
+  0x2C, 0x01, 0xC0, 0x1D, 0x38, 0x02, 0xC0, 0x1D, 0x34, 0x03, 0x80, 0x2C,
+  0x74, 0x03, 0x80, 0x28, 0x0B, 0x2F, 0x80, 0xBD, 0x5E, 0x0F, 0x40, 0xB1,
+  0xE0, 0x0B, 0x1D, 0x00, 0xE2, 0xC0, 0x0E, 0x2C, 0x01, 0xD3, 0x80, 0x1C,
+  0x34, 0x02, 0xC7, 0x40, 0x28, 0x06, 0xF9, 0x07, 0x96, 0xD3, 0x80, 0x3A,
+  0xC0, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xEE, 0x00, 0x77, 0x80, 0x3C, 0x79,
+  0x7D, 0x07, 0xF8, 0x00, 0x0B, 0x6F, 0x80, 0x2F, 0x9B, 0xC0, 0xF4, 0x0B,
+  0x43, 0x80, 0x1D, 0x1D, 0x00, 0x74, 0x70, 0x02, 0xC2, 0xC0, 0x0E, 0x0F,
+  0x40, 0xB4, 0x3B, 0x5B, 0x41, 0xD7, 0xE4, 0x07, 0x00, 0x00, 0x2C, 0x00,
+  0x00, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x06, 0xF9, 0xD1, 0xE5, 0xED,
+  0x38, 0x03, 0xCB, 0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x07,
+  0x4E, 0x01, 0xF0, 0xB9, 0xBF, 0x02, 0xF8, 0xE0, 0x00, 0x0E, 0x00, 0x01,
+  0xD0, 0x00, 0x1D, 0x00, 0x02, 0xC0, 0x0B, 0x6F, 0x0B, 0xE5, 0x0F, 0x40,
+  0x0E, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x34, 0x00,
+  0x74, 0x00, 0x02, 0xFE, 0x43, 0xE5, 0xA1, 0xD0, 0x00, 0x74, 0x00, 0x0F,
+  0xE4, 0x00, 0x6F, 0x80, 0x00, 0xB0, 0x00, 0x2C, 0xB9, 0x6D, 0x1B, 0xF9,
+  0x00, 0x05, 0x00, 0x38, 0x01, 0xD0, 0x2F, 0xFD, 0x6D, 0x50, 0xA0, 0x03,
+  0x80, 0x0D, 0x00, 0x74, 0x02, 0xC0, 0x0B, 0x00, 0x1E, 0x50, 0x2F, 0x80,
+  0x28, 0x01, 0xD3, 0x80, 0x2C, 0x74, 0x02, 0xC7, 0x40, 0x38, 0xB0, 0x03,
+  0x8A, 0x00, 0x74, 0xE0, 0x0B, 0x0E, 0x01, 0xF0, 0xB9, 0xBE, 0x02, 0xF8,
+  0xE0, 0xB0, 0x01, 0xD7, 0x40, 0x28, 0x74, 0x07, 0x43, 0x80, 0xE0, 0x38,
+  0x1D, 0x02, 0xC3, 0x80, 0x2C, 0xB0, 0x01, 0xDE, 0x00, 0x1F, 0xC0, 0x00,
+  0xF4, 0x00, 0x70, 0x0F, 0x01, 0xD7, 0x02, 0xF0, 0x28, 0x74, 0x3B, 0x07,
+  0x47, 0x4B, 0x70, 0xB0, 0x74, 0xD3, 0x4D, 0x03, 0x5C, 0x35, 0xC0, 0x37,
+  0x83, 0x78, 0x03, 0xB0, 0x3B, 0x00, 0x3E, 0x03, 0xE0, 0x03, 0xD0, 0x3D,
+  0x00, 0x0E, 0x00, 0xB4, 0x1D, 0x0B, 0x40, 0x3C, 0xB4, 0x00, 0x7B, 0x40,
+  0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x7A, 0xC0, 0x07, 0x87, 0x80, 0x78,
+  0x0B, 0x03, 0xC0, 0x1E, 0x00, 0x0B, 0x00, 0x1D, 0x07, 0x40, 0x38, 0x07,
+  0x40, 0x74, 0x03, 0x80, 0xE0, 0x02, 0xC2, 0xC0, 0x02, 0xC3, 0x80, 0x01,
+  0xDB, 0x00, 0x00, 0xED, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB4, 0x00, 0x00,
+  0xE0, 0x00, 0x02, 0xC0, 0x00, 0x1B, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x0F,
+  0xFF, 0xD0, 0x55, 0x7D, 0x00, 0x0B, 0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00,
+  0x2D, 0x00, 0x0B, 0x40, 0x02, 0xD0, 0x00, 0xB9, 0x55, 0x0F, 0xFF, 0xF0,
+  0x00, 0x2F, 0x80, 0x1D, 0x40, 0x0E, 0x00, 0x03, 0x40, 0x01, 0xD0, 0x00,
+  0x70, 0x00, 0x2C, 0x00, 0x1D, 0x00, 0xBD, 0x00, 0x17, 0xC0, 0x00, 0xB0,
+  0x00, 0x2C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x2F, 0x80,
+  0x00, 0x40, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0x02, 0xE4, 0x00, 0x5E, 0x00, 0x02, 0xC0, 0x00, 0xA0, 0x00, 0x38, 0x00,
+  0x1D, 0x00, 0x07, 0x40, 0x00, 0xE0, 0x00, 0x2F, 0x80, 0x2E, 0x40, 0x0E,
+  0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xA0, 0x00, 0x74, 0x02, 0xF8, 0x00,
+  0x50, 0x00, 0x00, 0x6F, 0xE4, 0x6F, 0x96, 0xFF, 0xD0, 0x00, 0x14, 0x00,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x55, 0x55, 0x7A, 0xAA, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0x03, 0x81, 0xD0, 0x10, 0x00, 0x05, 0x03, 0x80, 0xE0, 0x74, 0x2D, 0x0B,
+  0x03, 0xC0, 0xE0, 0x78, 0x1D, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x80, 0x06, 0xFE, 0x0B, 0xAA, 0x8B, 0x48, 0x03, 0x83, 0x01, 0xC0, 0x80,
+  0xB0, 0x60, 0x2C, 0x24, 0x0B, 0x48, 0x00, 0xF7, 0x64, 0x1B, 0xF8, 0x00,
+  0x60, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x06, 0xF8, 0x00, 0xB9, 0xA0,
+  0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0xFF,
+  0xF8, 0x01, 0xB5, 0x40, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00,
+  0x06, 0xE5, 0x50, 0x7F, 0xFF, 0xC0, 0xA0, 0x01, 0xD7, 0xBF, 0xB8, 0x2E,
+  0x6E, 0x02, 0x80, 0x70, 0x34, 0x03, 0x43, 0x80, 0x70, 0x2D, 0x1E, 0x07,
+  0xBF, 0xB4, 0xE0, 0x41, 0xC0, 0x2C, 0x00, 0x74, 0x74, 0x03, 0x80, 0xE0,
+  0x2C, 0x02, 0xC1, 0xD0, 0x07, 0x4E, 0x02, 0xFE, 0xBF, 0x40, 0x2F, 0x40,
+  0x00, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xE0, 0x00, 0x07, 0x40, 0x00, 0x5A, 0xAA, 0xAA, 0xA0, 0x05, 0xAA, 0xAA,
+  0xAA, 0x01, 0xBE, 0x41, 0xE5, 0x90, 0xB0, 0x00, 0x2D, 0x00, 0x07, 0xD0,
+  0x07, 0x6E, 0x03, 0x81, 0xE0, 0xD0, 0x2C, 0x2D, 0x0A, 0x02, 0xE7, 0x40,
+  0x2F, 0x40, 0x01, 0xE0, 0x00, 0x38, 0x14, 0x2D, 0x0B, 0xFD, 0x00, 0x10,
+  0x00, 0x64, 0x9B, 0x1D, 0x00, 0x6F, 0x90, 0x01, 0xD0, 0x1A, 0x01, 0xC6,
+  0xF9, 0x60, 0x97, 0x91, 0x49, 0x62, 0x80, 0x00, 0xD4, 0xD0, 0x00, 0x29,
+  0x34, 0x00, 0x09, 0x4A, 0x00, 0x02, 0x61, 0xD0, 0x00, 0xC9, 0x1F, 0xF4,
+  0x91, 0xD0, 0x00, 0x60, 0x1D, 0x01, 0xA0, 0x00, 0x6F, 0x90, 0x00, 0x06,
+  0xF9, 0x05, 0x0A, 0x00, 0x06, 0x06, 0xFE, 0x28, 0x09, 0x28, 0x2D, 0x1F,
+  0x9C, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x81, 0x81, 0xD1, 0xD2, 0xD2, 0xD2,
+  0xD3, 0x80, 0xB4, 0xB0, 0x0B, 0x0B, 0x00, 0xA0, 0xD0, 0x04, 0x04, 0xFF,
+  0xFF, 0xFD, 0x55, 0x55, 0xB0, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x00, 0x00,
+  0x18, 0xFF, 0x95, 0x40, 0x00, 0x6F, 0x90, 0x01, 0xD0, 0x1A, 0x01, 0xC0,
+  0x00, 0x60, 0x92, 0xFE, 0x09, 0x60, 0xA0, 0xE0, 0xD4, 0x28, 0x38, 0x29,
+  0x0B, 0xF8, 0x09, 0x42, 0x8A, 0x02, 0x60, 0xA0, 0xD0, 0xC9, 0x28, 0x2C,
+  0x91, 0xD0, 0x00, 0x60, 0x1D, 0x01, 0xA0, 0x00, 0x6F, 0x90, 0x00, 0xBF,
+  0xE1, 0x54, 0x1B, 0x83, 0x5A, 0x60, 0x33, 0x47, 0x1F, 0xD0, 0x00, 0x10,
+  0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1D, 0x00, 0xFF, 0xFF, 0xFD,
+  0x56, 0xD5, 0x50, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x05, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0x0B, 0xE4, 0x10, 0xA0, 0x02,
+  0x80, 0x28, 0x07, 0x40, 0x74, 0x07, 0xFF, 0x00, 0x0B, 0xE0, 0x00, 0xD0,
+  0x07, 0x42, 0xF4, 0x00, 0xB0, 0x02, 0x87, 0xF8, 0x00, 0x01, 0x41, 0xD1,
+  0xD1, 0xD0, 0x0B, 0x00, 0x74, 0x38, 0x01, 0xC0, 0xD0, 0x0B, 0x07, 0x40,
+  0x28, 0x1C, 0x00, 0xE0, 0xB0, 0x07, 0x43, 0x80, 0x2D, 0x0E, 0x00, 0xF0,
+  0x7E, 0x6F, 0xD1, 0xDB, 0xD7, 0x8B, 0x00, 0x00, 0x28, 0x00, 0x00, 0xE0,
+  0x00, 0x03, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xC7, 0xFC, 0x67, 0xFE, 0x2A,
+  0xFF, 0x89, 0xBF, 0xD3, 0x5F, 0xF4, 0xC2, 0xFC, 0x70, 0x0A, 0x28, 0x02,
+  0x89, 0x00, 0x93, 0x40, 0x34, 0xC0, 0x1C, 0x70, 0x07, 0x28, 0x02, 0x89,
+  0x00, 0x52, 0x40, 0x1B, 0xF0, 0x04, 0x0A, 0x0A, 0xFD, 0x2F, 0x44, 0xD0,
+  0x70, 0x1C, 0x0A, 0x02, 0x4B, 0xFC, 0x02, 0xF8, 0x0A, 0x0B, 0x1C, 0x07,
+  0x28, 0x07, 0x28, 0x0A, 0x1D, 0x1D, 0x0B, 0xE4, 0x00, 0x00, 0x7F, 0xF8,
+  0x24, 0x24, 0x07, 0x4B, 0x00, 0xB4, 0xB0, 0x0A, 0x0E, 0x0B, 0x4B, 0x4B,
+  0x5E, 0x0A, 0x0E, 0x01, 0x01, 0x00, 0x06, 0x40, 0x00, 0x90, 0x2B, 0x40,
+  0x02, 0x80, 0x03, 0x40, 0x0B, 0x00, 0x07, 0x00, 0x1D, 0x00, 0x06, 0x00,
+  0x34, 0x00, 0x0A, 0x00, 0xE0, 0x00, 0x09, 0x02, 0x80, 0x09, 0xBF, 0xC7,
+  0x00, 0x2D, 0x00, 0x1D, 0x00, 0x9D, 0x00, 0x38, 0x02, 0x5C, 0x00, 0xA0,
+  0x09, 0x18, 0x02, 0xC0, 0x0F, 0xFE, 0x07, 0x40, 0x00, 0x24, 0x1D, 0x00,
+  0x00, 0x24, 0x2F, 0x40, 0x01, 0xD0, 0x17, 0x40, 0x07, 0x40, 0x07, 0x00,
+  0x0E, 0x00, 0x07, 0x00, 0x28, 0x00, 0x0A, 0x00, 0xB0, 0x00, 0x09, 0x01,
+  0xD0, 0x00, 0xBF, 0xC7, 0x42, 0xF9, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x28,
+  0x00, 0x0A, 0x00, 0xA0, 0x00, 0x28, 0x02, 0xC0, 0x01, 0x90, 0x07, 0x40,
+  0x06, 0x40, 0x1D, 0x00, 0x1F, 0xFC, 0x0B, 0xE0, 0x00, 0x74, 0x00, 0x0D,
+  0x00, 0x34, 0x00, 0x07, 0x40, 0x28, 0x00, 0x2F, 0x40, 0x2C, 0x00, 0x00,
+  0xB0, 0x1D, 0x00, 0x00, 0x1C, 0x0D, 0x00, 0x04, 0x0A, 0x0A, 0x00, 0x25,
+  0xFD, 0x0B, 0x00, 0x2D, 0x00, 0x07, 0x40, 0x27, 0x40, 0x07, 0x40, 0x25,
+  0xC0, 0x03, 0x80, 0x24, 0x60, 0x02, 0xC0, 0x1F, 0xFE, 0x01, 0xC0, 0x00,
+  0x09, 0x01, 0xD0, 0x00, 0x02, 0x40, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x04,
+  0x00, 0x14, 0x00, 0x38, 0x00, 0x74, 0x00, 0xF0, 0x03, 0xD0, 0x0F, 0x40,
+  0x2D, 0x00, 0x78, 0x00, 0x78, 0x01, 0x3E, 0x6D, 0x1B, 0xE4, 0x00, 0x01,
+  0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x34,
+  0x74, 0x00, 0xA0, 0x74, 0x01, 0xD0, 0x38, 0x02, 0x80, 0x38, 0x07, 0xFF,
+  0xFC, 0x0E, 0x55, 0x6D, 0x2C, 0x00, 0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00,
+  0x0E, 0x00, 0x00, 0x14, 0x00, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x2C,
+  0xB0, 0x00, 0x34, 0x74, 0x00, 0xA0, 0x74, 0x01, 0xD0, 0x38, 0x02, 0x80,
+  0x38, 0x07, 0xFF, 0xFC, 0x0E, 0x55, 0x6D, 0x2C, 0x00, 0x1D, 0x38, 0x00,
+  0x1E, 0xB0, 0x00, 0x0E, 0x00, 0x00, 0x50, 0x00, 0x07, 0x68, 0x00, 0x05,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0D,
+  0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x34, 0x74, 0x00, 0xA0, 0x74, 0x01, 0xD0,
+  0x38, 0x02, 0x80, 0x38, 0x07, 0xFF, 0xFC, 0x0E, 0x55, 0x6D, 0x2C, 0x00,
+  0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00, 0x0E, 0x00, 0x07, 0x86, 0x00, 0x0D,
+  0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x34, 0x74, 0x00, 0xA0,
+  0x74, 0x01, 0xD0, 0x38, 0x02, 0x80, 0x38, 0x07, 0xFF, 0xFC, 0x0E, 0x55,
+  0x6D, 0x2C, 0x00, 0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00, 0x0E, 0x00, 0x0B,
+  0x1D, 0x00, 0x0A, 0x18, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x34, 0x74, 0x00, 0xA0,
+  0x74, 0x01, 0xD0, 0x38, 0x02, 0x80, 0x38, 0x07, 0xFF, 0xFC, 0x0E, 0x55,
+  0x6D, 0x2C, 0x00, 0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00, 0x0E, 0x00, 0x02,
+  0xE0, 0x00, 0x0A, 0x68, 0x00, 0x0D, 0x18, 0x00, 0x0A, 0x28, 0x00, 0x03,
+  0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x2C, 0xB0, 0x00, 0x74,
+  0x74, 0x00, 0xA0, 0x74, 0x01, 0xD0, 0x38, 0x03, 0x80, 0x3C, 0x07, 0xFF,
+  0xFC, 0x0E, 0x55, 0x6D, 0x2C, 0x00, 0x1D, 0x38, 0x00, 0x1E, 0xB0, 0x00,
+  0x0E, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0x7D, 0x55, 0x40, 0x00,
+  0x74, 0xE0, 0x00, 0x00, 0x03, 0x87, 0x40, 0x00, 0x00, 0x2C, 0x2D, 0x00,
+  0x00, 0x01, 0xD0, 0xBF, 0xFF, 0x00, 0x0E, 0x03, 0xD5, 0x54, 0x00, 0x74,
+  0x1E, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x2D, 0x56, 0xD0, 0x00,
+  0x01, 0xD0, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x3D, 0x55, 0x50, 0x74, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xF9, 0x01, 0xFA, 0x6F, 0x07, 0xD0, 0x02,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2D, 0x00, 0x14,
+  0x0F, 0xA6, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00,
+  0x01, 0x1C, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x1E, 0x55, 0x50, 0xB4,
+  0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xE5, 0x55,
+  0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E,
+  0x55, 0x50, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x1D, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x1E, 0x55, 0x50, 0xB4, 0x00,
+  0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xE5, 0x55, 0x07,
+  0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x55,
+  0x50, 0x7F, 0xFF, 0xC0, 0x00, 0x06, 0x40, 0x00, 0xA7, 0x00, 0x05, 0x05,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x1E, 0x55, 0x50, 0xB4, 0x00, 0x02,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xE5, 0x55, 0x07, 0x40,
+  0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x55, 0x50,
+  0x7F, 0xFF, 0xC0, 0x00, 0x78, 0xF0, 0x01, 0x92, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x07, 0x95, 0x54, 0x2D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80,
+  0x00, 0x0F, 0xFF, 0xE0, 0x79, 0x55, 0x41, 0xD0, 0x00, 0x0B, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x95, 0x54, 0x1F, 0xFF, 0xF0, 0x05,
+  0x00, 0xA0, 0x04, 0x00, 0x03, 0x81, 0xD0, 0xB4, 0x2C, 0x0F, 0x03, 0x81,
+  0xD0, 0x74, 0x2C, 0x0F, 0x03, 0x81, 0xE0, 0x74, 0x00, 0x00, 0x24, 0x07,
+  0x40, 0x14, 0x00, 0x00, 0x03, 0x80, 0x1D, 0x00, 0xB4, 0x02, 0xC0, 0x0F,
+  0x00, 0x38, 0x01, 0xD0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0x80, 0x1E,
+  0x00, 0x74, 0x00, 0x01, 0x90, 0x29, 0xC1, 0x41, 0x40, 0x00, 0x03, 0x80,
+  0x1D, 0x00, 0xB4, 0x02, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xD0, 0x07, 0x40,
+  0x2C, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x74, 0x00, 0x1D, 0x38, 0x64,
+  0x90, 0x00, 0x00, 0xE0, 0x07, 0x40, 0x2D, 0x00, 0xB0, 0x03, 0xC0, 0x0E,
+  0x00, 0x74, 0x01, 0xD0, 0x0B, 0x00, 0x3C, 0x00, 0xE0, 0x07, 0x80, 0x1D,
+  0x00, 0x03, 0xFF, 0xE4, 0x01, 0xE5, 0x6F, 0x40, 0x74, 0x00, 0xF4, 0x2C,
+  0x00, 0x1E, 0x0B, 0x00, 0x03, 0x83, 0x80, 0x00, 0xEF, 0xFF, 0x80, 0x39,
+  0x79, 0x40, 0x1D, 0x2D, 0x00, 0x0B, 0x0B, 0x00, 0x07, 0x83, 0x80, 0x07,
+  0xC0, 0xE5, 0xAF, 0x80, 0x7F, 0xFA, 0x40, 0x00, 0x00, 0x0A, 0x4C, 0x00,
+  0x0A, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x03,
+  0x81, 0xF8, 0x01, 0xD0, 0xBB, 0x00, 0x74, 0x2C, 0xD0, 0x2C, 0x0E, 0x28,
+  0x0F, 0x03, 0x8B, 0x03, 0x81, 0xD1, 0xD1, 0xD0, 0x74, 0x38, 0x74, 0x2C,
+  0x0B, 0x2C, 0x0F, 0x01, 0xDB, 0x03, 0x80, 0x3B, 0x81, 0xD0, 0x0B, 0xD0,
+  0x74, 0x01, 0xF4, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x34, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7E, 0xAB, 0x80,
+  0x7D, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x1D, 0x00, 0x02, 0xCF, 0x00, 0x00,
+  0xB3, 0x80, 0x00, 0x3D, 0xE0, 0x00, 0x0E, 0x78, 0x00, 0x0B, 0x4E, 0x00,
+  0x07, 0x82, 0xD0, 0x07, 0xC0, 0x3E, 0x6B, 0xC0, 0x02, 0xFE, 0x40, 0x00,
+  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7E, 0xAB, 0x80, 0x7D, 0x00, 0xB8, 0x3C,
+  0x00, 0x0F, 0x1D, 0x00, 0x02, 0xCF, 0x00, 0x00, 0xB3, 0x80, 0x00, 0x3D,
+  0xE0, 0x00, 0x0E, 0x78, 0x00, 0x0B, 0x4E, 0x00, 0x07, 0x82, 0xD0, 0x07,
+  0xC0, 0x3E, 0x6B, 0xC0, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00,
+  0x01, 0xDA, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
+  0x00, 0x7E, 0xAB, 0x80, 0x7D, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x1D, 0x00,
+  0x02, 0xCF, 0x00, 0x00, 0xB3, 0x80, 0x00, 0x3D, 0xE0, 0x00, 0x0E, 0x78,
+  0x00, 0x0B, 0x4E, 0x00, 0x07, 0x82, 0xD0, 0x07, 0xC0, 0x3E, 0x6B, 0xC0,
+  0x02, 0xFE, 0x40, 0x00, 0x00, 0x07, 0x86, 0x00, 0x03, 0x5F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7E, 0xAB, 0x80,
+  0x7D, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x1D, 0x00, 0x02, 0xCF, 0x00, 0x00,
+  0xB3, 0x80, 0x00, 0x3D, 0xE0, 0x00, 0x0E, 0x78, 0x00, 0x0B, 0x4E, 0x00,
+  0x07, 0x82, 0xD0, 0x07, 0xC0, 0x3E, 0x6B, 0xC0, 0x02, 0xFE, 0x40, 0x00,
+  0x00, 0x0A, 0x19, 0x00, 0x02, 0xC7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7E, 0xAB, 0x80, 0x7D, 0x00, 0xB8, 0x3C,
+  0x00, 0x0F, 0x1D, 0x00, 0x02, 0xCF, 0x00, 0x00, 0xB3, 0x80, 0x00, 0x3D,
+  0xE0, 0x00, 0x0E, 0x78, 0x00, 0x0B, 0x4E, 0x00, 0x07, 0x82, 0xD0, 0x07,
+  0xC0, 0x3E, 0x6B, 0xC0, 0x02, 0xFE, 0x40, 0x00, 0x10, 0x00, 0x17, 0x80,
+  0x0B, 0x2E, 0x02, 0xD0, 0xB8, 0xB4, 0x02, 0xFD, 0x00, 0x0F, 0x80, 0x02,
+  0xEE, 0x00, 0xB4, 0xB4, 0x2D, 0x02, 0xD7, 0x40, 0x0B, 0x10, 0x00, 0x10,
+  0x00, 0x06, 0xF9, 0x1C, 0x01, 0xFA, 0xAF, 0xD0, 0x1F, 0x40, 0x2E, 0x00,
+  0xF0, 0x02, 0xBC, 0x07, 0x40, 0x28, 0xB0, 0x3C, 0x02, 0x82, 0xC0, 0xE0,
+  0x34, 0x0F, 0x07, 0x87, 0x40, 0x78, 0x1E, 0x74, 0x02, 0xD0, 0x3F, 0x40,
+  0x1E, 0x00, 0xB8, 0x01, 0xF0, 0x0B, 0xF9, 0xAF, 0x00, 0x70, 0xBF, 0x90,
+  0x00, 0x00, 0x2C, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x1D, 0x00, 0x1D, 0x2D, 0x00, 0x1D, 0x2C, 0x00, 0x2C, 0x38, 0x00,
+  0x3C, 0x38, 0x00, 0x38, 0x74, 0x00, 0x74, 0xB4, 0x00, 0x74, 0xB0, 0x00,
+  0xB0, 0xF0, 0x00, 0xF0, 0xF0, 0x01, 0xE0, 0xB0, 0x02, 0xC0, 0x7E, 0x6F,
+  0x40, 0x1B, 0xF9, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x2D, 0x00, 0x1D, 0x2C, 0x00,
+  0x2C, 0x38, 0x00, 0x3C, 0x38, 0x00, 0x38, 0x74, 0x00, 0x74, 0xB4, 0x00,
+  0x74, 0xB0, 0x00, 0xB0, 0xF0, 0x00, 0xF0, 0xF0, 0x01, 0xE0, 0xB0, 0x02,
+  0xC0, 0x7E, 0x6F, 0x40, 0x1B, 0xF9, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x35,
+  0xC0, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x2D, 0x00,
+  0x1D, 0x2C, 0x00, 0x2C, 0x38, 0x00, 0x3C, 0x38, 0x00, 0x38, 0x74, 0x00,
+  0x74, 0xB4, 0x00, 0x74, 0xB0, 0x00, 0xB0, 0xF0, 0x00, 0xF0, 0xF0, 0x01,
+  0xE0, 0xB0, 0x02, 0xC0, 0x7E, 0x6F, 0x40, 0x1B, 0xF9, 0x00, 0x00, 0x64,
+  0xA0, 0x00, 0xB1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
+  0x1D, 0x2D, 0x00, 0x1D, 0x2C, 0x00, 0x2C, 0x38, 0x00, 0x3C, 0x38, 0x00,
+  0x38, 0x74, 0x00, 0x74, 0xB4, 0x00, 0x74, 0xB0, 0x00, 0xB0, 0xF0, 0x00,
+  0xF0, 0xF0, 0x01, 0xE0, 0xB0, 0x02, 0xC0, 0x7E, 0x6F, 0x40, 0x1B, 0xF9,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xB4, 0x00, 0x75, 0xE0, 0x07, 0x82, 0xC0, 0x78, 0x07, 0x83, 0xC0, 0x0B,
+  0x3C, 0x00, 0x1F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80,
+  0x00, 0x1E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x74, 0x00, 0x0B, 0xFF, 0x80, 0xB5, 0x6E, 0x0E, 0x00,
+  0xF0, 0xE0, 0x0B, 0x1D, 0x00, 0xB1, 0xD0, 0x1E, 0x2D, 0x17, 0xD3, 0xFF,
+  0xF4, 0x39, 0x50, 0x07, 0x80, 0x00, 0x74, 0x00, 0x00, 0x01, 0xBE, 0x00,
+  0x79, 0x6C, 0x0A, 0x01, 0xD1, 0xD0, 0x6D, 0x1C, 0x2D, 0x02, 0xC7, 0x40,
+  0x28, 0x74, 0x03, 0x87, 0xC0, 0x34, 0x1F, 0x47, 0x40, 0x7C, 0xB0, 0x02,
+  0xCB, 0x00, 0x2C, 0xE6, 0x5B, 0x4E, 0x7F, 0x90, 0x00, 0x50, 0x00, 0x03,
+  0x80, 0x00, 0x1C, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x06,
+  0x97, 0xD0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x6F, 0xFD, 0x2E, 0x55, 0xD3,
+  0x80, 0x2C, 0x74, 0x07, 0xC3, 0xD6, 0xB8, 0x1B, 0xE3, 0x40, 0x00, 0x00,
+  0x50, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2B,
+  0xE4, 0x06, 0x97, 0xD0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x6F, 0xFD, 0x2E,
+  0x55, 0xD3, 0x80, 0x2C, 0x74, 0x07, 0xC3, 0xD6, 0xB8, 0x1B, 0xE3, 0x40,
+  0x00, 0x05, 0x00, 0x01, 0xF4, 0x00, 0x72, 0x80, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x2B, 0xE4, 0x06, 0x97, 0xD0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x6F,
+  0xFD, 0x2E, 0x55, 0xD3, 0x80, 0x2C, 0x74, 0x07, 0xC3, 0xD6, 0xB8, 0x1B,
+  0xE3, 0x40, 0x00, 0x7D, 0x60, 0x0D, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xBE, 0x40, 0x69, 0x7D, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x06, 0xFF,
+  0xD2, 0xE5, 0x5D, 0x38, 0x02, 0xC7, 0x40, 0x7C, 0x3D, 0x6B, 0x81, 0xBE,
+  0x34, 0x00, 0xB1, 0xD0, 0x0A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xBE, 0x40, 0x69, 0x7D, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x06, 0xFF, 0xD2,
+  0xE5, 0x5D, 0x38, 0x02, 0xC7, 0x40, 0x7C, 0x3D, 0x6B, 0x81, 0xBE, 0x34,
+  0x00, 0x1E, 0x40, 0x07, 0x5C, 0x00, 0x60, 0xD0, 0x07, 0x0C, 0x00, 0x2F,
+  0x40, 0x00, 0x00, 0x02, 0xBE, 0x40, 0x69, 0x7D, 0x00, 0x00, 0xE0, 0x00,
+  0x0E, 0x06, 0xFF, 0xD2, 0xE5, 0x5D, 0x38, 0x02, 0xC7, 0x40, 0x7C, 0x3D,
+  0x6B, 0x81, 0xBE, 0x34, 0x02, 0xBE, 0x46, 0xF9, 0x01, 0xA5, 0xFB, 0x97,
+  0xD0, 0x00, 0x0F, 0x40, 0x38, 0x00, 0x03, 0x80, 0x0A, 0x06, 0xFF, 0xFF,
+  0xFF, 0x8B, 0x95, 0x75, 0x55, 0x43, 0x80, 0x2C, 0x00, 0x01, 0xD0, 0x1F,
+  0x80, 0x00, 0x3D, 0x6D, 0xB9, 0x6D, 0x06, 0xF9, 0x0B, 0xFA, 0x00, 0x02,
+  0xFE, 0x47, 0xE5, 0xD3, 0xC0, 0x02, 0xD0, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x0E, 0x00, 0x03, 0x80, 0x00, 0xB9, 0x68, 0x06, 0xF9, 0x00, 0x24, 0x00,
+  0x06, 0x00, 0x12, 0x80, 0x0F, 0x80, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00,
+  0x07, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xF5, 0xB4, 0xE0,
+  0x0B, 0xB0, 0x02, 0xFF, 0xFF, 0xFE, 0x55, 0x57, 0x40, 0x00, 0xE0, 0x00,
+  0x2E, 0x5A, 0x81, 0xBF, 0x90, 0x00, 0x01, 0x40, 0x02, 0xC0, 0x02, 0x80,
+  0x01, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xF5, 0xB4, 0xE0, 0x0B, 0xB0,
+  0x02, 0xFF, 0xFF, 0xFE, 0x55, 0x57, 0x40, 0x00, 0xE0, 0x00, 0x2E, 0x5A,
+  0x81, 0xBF, 0x90, 0x00, 0x14, 0x00, 0x1F, 0x40, 0x1D, 0x70, 0x04, 0x04,
+  0x00, 0x00, 0x00, 0xBF, 0x41, 0xF5, 0xB4, 0xE0, 0x0B, 0xB0, 0x02, 0xFF,
+  0xFF, 0xFE, 0x55, 0x57, 0x40, 0x00, 0xE0, 0x00, 0x2E, 0x5A, 0x81, 0xBF,
+  0x90, 0x02, 0xD7, 0x80, 0xA1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
+  0x07, 0xD6, 0xD3, 0x80, 0x2E, 0xC0, 0x0B, 0xFF, 0xFF, 0xF9, 0x55, 0x5D,
+  0x00, 0x03, 0x80, 0x00, 0xB9, 0x6A, 0x06, 0xFE, 0x40, 0x14, 0x07, 0x40,
+  0xB0, 0x09, 0x00, 0x02, 0xC0, 0xA0, 0x38, 0x0D, 0x07, 0x42, 0xC0, 0xB0,
+  0x38, 0x0D, 0x07, 0x40, 0x00, 0x14, 0x02, 0xC0, 0x1C, 0x01, 0xC0, 0x00,
+  0x00, 0x2C, 0x00, 0xA0, 0x03, 0x80, 0x0D, 0x00, 0x74, 0x02, 0xC0, 0x0B,
+  0x00, 0x38, 0x00, 0xD0, 0x07, 0x40, 0x00, 0x01, 0x40, 0x7C, 0x1D, 0xA3,
+  0x47, 0x00, 0x00, 0xB0, 0x0A, 0x00, 0xE0, 0x0D, 0x01, 0xD0, 0x2C, 0x02,
+  0xC0, 0x38, 0x03, 0x40, 0x74, 0x00, 0x2C, 0x74, 0xA1, 0x80, 0x00, 0x00,
+  0x00, 0x0B, 0x00, 0x28, 0x00, 0xE0, 0x03, 0x40, 0x1D, 0x00, 0xB0, 0x02,
+  0xC0, 0x0E, 0x00, 0x34, 0x01, 0xD0, 0x00, 0x00, 0x78, 0x60, 0x02, 0xF9,
+  0x02, 0xEF, 0x00, 0x10, 0x78, 0x01, 0xBF, 0xD0, 0x79, 0x6E, 0x0E, 0x00,
+  0xA2, 0xC0, 0x0B, 0x38, 0x00, 0xB3, 0x40, 0x0E, 0x74, 0x01, 0xD3, 0x80,
+  0x38, 0x2E, 0x6F, 0x00, 0x7F, 0x80, 0x00, 0x2D, 0x30, 0x0A, 0x7D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0x2F, 0x80, 0xBD, 0x5E, 0x0F, 0x40, 0xB1,
+  0xE0, 0x0B, 0x1D, 0x00, 0xE2, 0xC0, 0x0E, 0x2C, 0x01, 0xD3, 0x80, 0x1C,
+  0x34, 0x02, 0xC7, 0x40, 0x28, 0x01, 0x80, 0x00, 0x38, 0x00, 0x07, 0x40,
+  0x00, 0x50, 0x00, 0x00, 0x01, 0xBE, 0x41, 0xE5, 0xB4, 0xE0, 0x0E, 0xB0,
+  0x02, 0xF8, 0x00, 0xBE, 0x00, 0x3B, 0x80, 0x1D, 0xE0, 0x0F, 0x1E, 0x5F,
+  0x41, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x02, 0xC0, 0x02, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0xBE, 0x41, 0xE5, 0xB4, 0xE0, 0x0E, 0xB0, 0x02, 0xF8,
+  0x00, 0xBE, 0x00, 0x3B, 0x80, 0x1D, 0xE0, 0x0F, 0x1E, 0x5F, 0x41, 0xFE,
+  0x00, 0x00, 0x14, 0x00, 0x1F, 0x40, 0x1D, 0x70, 0x05, 0x04, 0x00, 0x00,
+  0x01, 0xBE, 0x41, 0xE5, 0xB4, 0xE0, 0x0E, 0xB0, 0x02, 0xF8, 0x00, 0xBE,
+  0x00, 0x3B, 0x80, 0x1D, 0xE0, 0x0F, 0x1E, 0x5F, 0x41, 0xFE, 0x00, 0x01,
+  0xF5, 0xC0, 0xD7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x07, 0x96,
+  0xD3, 0x80, 0x3A, 0xC0, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xEE, 0x00, 0x77,
+  0x80, 0x3C, 0x79, 0x7D, 0x07, 0xF8, 0x00, 0x02, 0xD3, 0x80, 0xA1, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x07, 0x96, 0xD3, 0x80, 0x3A, 0xC0,
+  0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xEE, 0x00, 0x77, 0x80, 0x3C, 0x79, 0x7D,
+  0x07, 0xF8, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x2D,
+  0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x04, 0x06, 0xF9, 0xA0, 0x79, 0x6E,
+  0x03, 0x80, 0xB8, 0x2C, 0x09, 0xB0, 0xE0, 0xA2, 0xC3, 0x8A, 0x0E, 0x0E,
+  0xA0, 0x74, 0x3E, 0x03, 0xC0, 0xF9, 0x7D, 0x0A, 0x7F, 0x80, 0x10, 0x00,
+  0x00, 0x01, 0x40, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x01, 0x40, 0x00,
+  0x00, 0x02, 0x80, 0x1D, 0x38, 0x02, 0xC7, 0x40, 0x2C, 0x74, 0x03, 0x8B,
+  0x00, 0x38, 0xA0, 0x07, 0x4E, 0x00, 0xB0, 0xE0, 0x1F, 0x0B, 0x9B, 0xE0,
+  0x2F, 0x8E, 0x00, 0x00, 0x01, 0x40, 0x00, 0xB0, 0x00, 0x28, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x02, 0x80, 0x1D, 0x38, 0x02, 0xC7, 0x40, 0x2C, 0x74,
+  0x03, 0x8B, 0x00, 0x38, 0xA0, 0x07, 0x4E, 0x00, 0xB0, 0xE0, 0x1F, 0x0B,
+  0x9B, 0xE0, 0x2F, 0x8E, 0x00, 0x00, 0x04, 0x00, 0x07, 0xD0, 0x00, 0xDA,
+  0x00, 0x24, 0x20, 0x00, 0x00, 0x02, 0x80, 0x1D, 0x38, 0x02, 0xC7, 0x40,
+  0x2C, 0x74, 0x03, 0x8B, 0x00, 0x38, 0xA0, 0x07, 0x4E, 0x00, 0xB0, 0xE0,
+  0x1F, 0x0B, 0x9B, 0xE0, 0x2F, 0x8E, 0x00, 0x02, 0xC7, 0x80, 0x28, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0xD3, 0x80, 0x2C, 0x74, 0x02,
+  0xC7, 0x40, 0x38, 0xB0, 0x03, 0x8A, 0x00, 0x74, 0xE0, 0x0B, 0x0E, 0x01,
+  0xF0, 0xB9, 0xBE, 0x02, 0xF8, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0xE0,
+  0x00, 0x02, 0x80, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x1D, 0x07, 0x40, 0x38,
+  0x07, 0x40, 0x74, 0x03, 0x80, 0xE0, 0x02, 0xC2, 0xC0, 0x02, 0xC3, 0x80,
+  0x01, 0xDB, 0x00, 0x00, 0xED, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB4, 0x00,
+  0x00, 0xE0, 0x00, 0x02, 0xC0, 0x00, 0x1B, 0x40, 0x00, 0x7E, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x0B,
+  0x2F, 0x80, 0x2F, 0x9B, 0xC0, 0xF4, 0x0B, 0x43, 0x80, 0x1D, 0x1D, 0x00,
+  0x74, 0xB0, 0x02, 0xC2, 0xC0, 0x0E, 0x0F, 0x40, 0xB4, 0x3B, 0x5B, 0x41,
+  0xD7, 0xE4, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xA0, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x2C, 0x74, 0x00, 0x28, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0x00, 0x1D, 0x07, 0x40, 0x38, 0x07, 0x40, 0x74, 0x03,
+  0x80, 0xE0, 0x02, 0xC2, 0xC0, 0x02, 0xC3, 0x80, 0x01, 0xDB, 0x00, 0x00,
+  0xED, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xE0, 0x00, 0x02,
+  0xC0, 0x00, 0x1B, 0x40, 0x00, 0x7E, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique9pt8bAa2Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   5,  13,   7,    1,  -13 },   // 0x21 '!'
+  {    17,   6,   5,   8,    1,  -13 },   // 0x22 '"'
+  {    25,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {    68,  10,  17,  11,    0,  -14 },   // 0x24 '$'
+  {   111,  14,  13,  17,    1,  -13 },   // 0x25 '%'
+  {   157,  12,  13,  14,    1,  -13 },   // 0x26 '&'
+  {   196,   2,   5,   5,    1,  -13 },   // 0x27 '''
+  {   199,   7,  16,   7,    1,  -14 },   // 0x28 '('
+  {   227,   6,  16,   7,   -1,  -14 },   // 0x29 ')'
+  {   251,   8,   8,   9,    0,  -13 },   // 0x2A '*'
+  {   267,  11,  12,  15,    2,  -12 },   // 0x2B '+'
+  {   300,   4,   5,   6,    0,   -3 },   // 0x2C ','
+  {   305,   5,   2,   6,    1,   -5 },   // 0x2D '-'
+  {   308,   2,   3,   6,    1,   -3 },   // 0x2E '.'
+  {   310,   9,  15,   6,   -1,  -13 },   // 0x2F '/'
+  {   344,  10,  13,  11,    1,  -13 },   // 0x30 '0'
+  {   377,   8,  13,  11,    1,  -13 },   // 0x31 '1'
+  {   403,  10,  13,  11,    0,  -13 },   // 0x32 '2'
+  {   436,  10,  13,  11,    0,  -13 },   // 0x33 '3'
+  {   469,  10,  13,  11,    0,  -13 },   // 0x34 '4'
+  {   502,  10,  13,  11,    0,  -13 },   // 0x35 '5'
+  {   535,  10,  13,  11,    1,  -13 },   // 0x36 '6'
+  {   568,   9,  13,  11,    2,  -13 },   // 0x37 '7'
+  {   598,  11,  13,  11,    0,  -13 },   // 0x38 '8'
+  {   634,   9,  13,  11,    1,  -13 },   // 0x39 '9'
+  {   664,   4,  10,   6,    1,  -10 },   // 0x3A ':'
+  {   674,   5,  12,   6,    0,  -10 },   // 0x3B ';'
+  {   689,  11,  10,  15,    2,  -11 },   // 0x3C '<'
+  {   717,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {   734,  11,   9,  15,    2,  -10 },   // 0x3E '>'
+  {   759,   7,  13,   9,    2,  -13 },   // 0x3F '?'
+  {   782,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {   846,  12,  13,  12,   -1,  -13 },   // 0x41 'A'
+  {   885,  11,  13,  12,    0,  -13 },   // 0x42 'B'
+  {   921,  12,  13,  12,    0,  -13 },   // 0x43 'C'
+  {   960,  13,  13,  14,    0,  -13 },   // 0x44 'D'
+  {  1003,  11,  13,  11,    0,  -13 },   // 0x45 'E'
+  {  1039,  11,  13,  10,    0,  -13 },   // 0x46 'F'
+  {  1075,  13,  13,  14,    0,  -13 },   // 0x47 'G'
+  {  1118,  13,  13,  13,    0,  -13 },   // 0x48 'H'
+  {  1161,   5,  13,   5,    0,  -13 },   // 0x49 'I'
+  {  1178,   8,  17,   5,   -3,  -13 },   // 0x4A 'J'
+  {  1212,  13,  13,  12,    0,  -13 },   // 0x4B 'K'
+  {  1255,   9,  13,  10,    0,  -13 },   // 0x4C 'L'
+  {  1285,  15,  13,  15,    0,  -13 },   // 0x4D 'M'
+  {  1334,  13,  13,  13,    0,  -13 },   // 0x4E 'N'
+  {  1377,  13,  13,  14,    0,  -13 },   // 0x4F 'O'
+  {  1420,  11,  13,  11,    0,  -13 },   // 0x50 'P'
+  {  1456,  13,  15,  14,    0,  -13 },   // 0x51 'Q'
+  {  1505,  11,  13,  12,    0,  -13 },   // 0x52 'R'
+  {  1541,  11,  13,  11,    0,  -13 },   // 0x53 'S'
+  {  1577,  11,  13,  11,    1,  -13 },   // 0x54 'T'
+  {  1613,  12,  13,  13,    1,  -13 },   // 0x55 'U'
+  {  1652,  12,  13,  12,    1,  -13 },   // 0x56 'V'
+  {  1691,  17,  13,  17,    1,  -13 },   // 0x57 'W'
+  {  1747,  13,  13,  12,   -1,  -13 },   // 0x58 'X'
+  {  1790,  11,  13,  11,    1,  -13 },   // 0x59 'Y'
+  {  1826,  14,  13,  12,   -1,  -13 },   // 0x5A 'Z'
+  {  1872,   7,  17,   7,    1,  -14 },   // 0x5B '['
+  {  1902,   4,  15,   6,    1,  -13 },   // 0x5C '\'
+  {  1917,   7,  17,   7,   -1,  -14 },   // 0x5D ']'
+  {  1947,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  1961,  10,   2,   9,   -1,    3 },   // 0x5F '_'
+  {  1966,   4,   4,   9,    3,  -15 },   // 0x60 '`'
+  {  1970,  10,  10,  11,    0,  -10 },   // 0x61 'a'
+  {  1995,  11,  14,  11,    0,  -14 },   // 0x62 'b'
+  {  2034,   9,  10,  10,    1,  -10 },   // 0x63 'c'
+  {  2057,  11,  14,  11,    1,  -14 },   // 0x64 'd'
+  {  2096,   9,  10,  11,    1,  -10 },   // 0x65 'e'
+  {  2119,   8,  14,   6,    1,  -14 },   // 0x66 'f'
+  {  2147,  11,  14,  11,    0,  -10 },   // 0x67 'g'
+  {  2186,  10,  14,  11,    0,  -14 },   // 0x68 'h'
+  {  2221,   5,  14,   5,    0,  -14 },   // 0x69 'i'
+  {  2239,   7,  18,   5,   -2,  -14 },   // 0x6A 'j'
+  {  2271,  11,  14,  10,    0,  -14 },   // 0x6B 'k'
+  {  2310,   5,  14,   5,    0,  -14 },   // 0x6C 'l'
+  {  2328,  16,  10,  17,    0,  -10 },   // 0x6D 'm'
+  {  2368,  10,  10,  11,    0,  -10 },   // 0x6E 'n'
+  {  2393,   9,  10,  11,    1,  -10 },   // 0x6F 'o'
+  {  2416,  11,  14,  11,    0,  -10 },   // 0x70 'p'
+  {  2455,  10,  14,  11,    1,  -10 },   // 0x71 'q'
+  {  2490,   8,  10,   7,    0,  -10 },   // 0x72 'r'
+  {  2510,   9,  10,   9,    0,  -10 },   // 0x73 's'
+  {  2533,   7,  13,   7,    1,  -13 },   // 0x74 't'
+  {  2556,  10,  10,  11,    1,  -10 },   // 0x75 'u'
+  {  2581,  10,  10,  10,    1,  -10 },   // 0x76 'v'
+  {  2606,  14,  10,  14,    1,  -10 },   // 0x77 'w'
+  {  2641,  11,  10,  10,    0,  -10 },   // 0x78 'x'
+  {  2669,  12,  14,  10,   -1,  -10 },   // 0x79 'y'
+  {  2711,  10,  10,   9,    0,  -10 },   // 0x7A 'z'
+  {  2736,   9,  17,  11,    2,  -14 },   // 0x7B '{'
+  {  2775,   2,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  2784,   9,  17,  11,    0,  -14 },   // 0x7D '}'
+  {  2823,  11,   3,  15,    2,   -7 },   // 0x7E '~'
+  {  2832,   9,  16,  11,    1,  -13 },   // 0x7F
+  {  2868,   9,  16,  11,    1,  -13 },   // 0x80
+  {  2904,   9,  16,  11,    1,  -13 },   // 0x81
+  {  2940,   9,  16,  11,    1,  -13 },   // 0x82
+  {  2976,   9,  16,  11,    1,  -13 },   // 0x83
+  {  3012,   9,  16,  11,    1,  -13 },   // 0x84
+  {  3048,   9,  16,  11,    1,  -13 },   // 0x85
+  {  3084,   9,  16,  11,    1,  -13 },   // 0x86
+  {  3120,   9,  16,  11,    1,  -13 },   // 0x87
+  {  3156,   9,  16,  11,    1,  -13 },   // 0x88
+  {  3192,   9,  16,  11,    1,  -13 },   // 0x89
+  {  3228,   9,  16,  11,    1,  -13 },   // 0x8A
+  {  3264,   9,  16,  11,    1,  -13 },   // 0x8B
+  {  3300,   9,  16,  11,    1,  -13 },   // 0x8C
+  {  3336,   9,  16,  11,    1,  -13 },   // 0x8D
+  {  3372,   9,  16,  11,    1,  -13 },   // 0x8E
+  {  3408,   9,  16,  11,    1,  -13 },   // 0x8F
+  {  3444,   9,  16,  11,    1,  -13 },   // 0x90
+  {  3480,   9,  16,  11,    1,  -13 },   // 0x91
+  {  3516,   9,  16,  11,    1,  -13 },   // 0x92
+  {  3552,   9,  16,  11,    1,  -13 },   // 0x93
+  {  3588,   9,  16,  11,    1,  -13 },   // 0x94
+  {  3624,   9,  16,  11,    1,  -13 },   // 0x95
+  {  3660,   9,  16,  11,    1,  -13 },   // 0x96
+  {  3696,   9,  16,  11,    1,  -13 },   // 0x97
+  {  3732,   9,  16,  11,    1,  -13 },   // 0x98
+  {  3768,   9,  16,  11,    1,  -13 },   // 0x99
+  {  3804,   9,  16,  11,    1,  -13 },   // 0x9A
+  {  3840,   9,  16,  11,    1,  -13 },   // 0x9B
+  {  3876,   9,  16,  11,    1,  -13 },   // 0x9C
+  {  3912,   9,  16,  11,    1,  -13 },   // 0x9D
+  {  3948,   9,  16,  11,    1,  -13 },   // 0x9E
+  {  3984,   9,  16,  11,    1,  -13 },   // 0x9F
+  {  4020,   0,   0,   6,    0,    1 },   // 0xA0
+  {  4020,   5,  14,   7,    1,  -10 },   // 0xA1
+  {  4038,   9,  16,  11,    1,  -13 },   // 0xA2
+  {  4074,  11,  13,  11,    0,  -13 },   // 0xA3
+  {  4110,  10,   9,  11,    1,  -10 },   // 0xA4
+  {  4133,  11,  13,  11,    1,  -13 },   // 0xA5
+  {  4169,   2,  16,   6,    2,  -13 },   // 0xA6
+  {  4177,   9,  16,   9,    0,  -13 },   // 0xA7
+  {  4213,   6,   2,   9,    3,  -14 },   // 0xA8
+  {  4216,  13,  13,  18,    2,  -13 },   // 0xA9
+  {  4259,   8,   9,   8,    0,  -13 },   // 0xAA
+  {  4277,   9,   8,  11,    1,   -9 },   // 0xAB
+  {  4295,  11,   5,  15,    2,   -7 },   // 0xAC
+  {  4309,   5,   2,   6,    1,   -5 },   // 0xAD
+  {  4312,  13,  13,  18,    2,  -13 },   // 0xAE
+  {  4355,   6,   2,   9,    3,  -13 },   // 0xAF
+  {  4358,   6,   5,   9,    1,  -13 },   // 0xB0
+  {  4366,  11,  12,  15,    2,  -12 },   // 0xB1
+  {  4399,   7,   7,   7,    0,  -13 },   // 0xB2
+  {  4412,   7,   7,   7,    0,  -13 },   // 0xB3
+  {  4425,   5,   4,   9,    4,  -15 },   // 0xB4
+  {  4430,  11,  14,  11,    0,  -10 },   // 0xB5
+  {  4469,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  4503,   2,   3,   6,    2,   -8 },   // 0xB7
+  {  4505,   4,   4,   9,    1,   -1 },   // 0xB8
+  {  4509,   5,   7,   7,    1,  -13 },   // 0xB9
+  {  4518,   8,   9,   8,    0,  -13 },   // 0xBA
+  {  4536,   9,   8,  11,    1,   -9 },   // 0xBB
+  {  4554,  16,  14,  17,    1,  -14 },   // 0xBC
+  {  4610,  16,  13,  17,    1,  -13 },   // 0xBD
+  {  4662,  17,  14,  17,    0,  -14 },   // 0xBE
+  {  4722,   8,  14,   9,    0,  -10 },   // 0xBF
+  {  4750,  12,  17,  12,   -1,  -17 },   // 0xC0
+  {  4801,  12,  17,  12,   -1,  -17 },   // 0xC1
+  {  4852,  12,  17,  12,   -1,  -17 },   // 0xC2
+  {  4903,  12,  17,  12,   -1,  -17 },   // 0xC3
+  {  4954,  12,  16,  12,   -1,  -16 },   // 0xC4
+  {  5002,  12,  17,  12,   -1,  -17 },   // 0xC5
+  {  5053,  19,  13,  17,   -1,  -13 },   // 0xC6
+  {  5115,  12,  17,  12,    0,  -13 },   // 0xC7
+  {  5166,  11,  17,  11,    0,  -17 },   // 0xC8
+  {  5213,  11,  17,  11,    0,  -17 },   // 0xC9
+  {  5260,  11,  17,  11,    0,  -17 },   // 0xCA
+  {  5307,  11,  16,  11,    0,  -16 },   // 0xCB
+  {  5351,   5,  17,   5,    0,  -17 },   // 0xCC
+  {  5373,   7,  17,   5,    0,  -17 },   // 0xCD
+  {  5403,   7,  17,   5,    0,  -17 },   // 0xCE
+  {  5433,   7,  16,   5,    0,  -16 },   // 0xCF
+  {  5461,  13,  13,  14,    0,  -13 },   // 0xD0
+  {  5504,  13,  17,  13,    0,  -17 },   // 0xD1
+  {  5560,  13,  17,  14,    0,  -17 },   // 0xD2
+  {  5616,  13,  17,  14,    0,  -17 },   // 0xD3
+  {  5672,  13,  17,  14,    0,  -17 },   // 0xD4
+  {  5728,  13,  17,  14,    0,  -17 },   // 0xD5
+  {  5784,  13,  17,  14,    0,  -17 },   // 0xD6
+  {  5840,  10,  11,  15,    2,  -11 },   // 0xD7
+  {  5868,  15,  13,  14,   -1,  -13 },   // 0xD8
+  {  5917,  12,  17,  13,    1,  -17 },   // 0xD9
+  {  5968,  12,  17,  13,    1,  -17 },   // 0xDA
+  {  6019,  12,  17,  13,    1,  -17 },   // 0xDB
+  {  6070,  12,  17,  13,    1,  -17 },   // 0xDC
+  {  6121,  11,  17,  11,    1,  -17 },   // 0xDD
+  {  6168,  10,  13,  11,    0,  -13 },   // 0xDE
+  {  6201,  10,  14,  11,    1,  -14 },   // 0xDF
+  {  6236,  10,  15,  11,    0,  -15 },   // 0xE0
+  {  6274,  10,  15,  11,    0,  -15 },   // 0xE1
+  {  6312,  10,  15,  11,    0,  -15 },   // 0xE2
+  {  6350,  10,  14,  11,    0,  -14 },   // 0xE3
+  {  6385,  10,  14,  11,    0,  -14 },   // 0xE4
+  {  6420,  10,  16,  11,    0,  -16 },   // 0xE5
+  {  6460,  17,  10,  18,    0,  -10 },   // 0xE6
+  {  6503,   9,  14,  10,    1,  -10 },   // 0xE7
+  {  6535,   9,  15,  11,    1,  -15 },   // 0xE8
+  {  6569,   9,  15,  11,    1,  -15 },   // 0xE9
+  {  6603,   9,  15,  11,    1,  -15 },   // 0xEA
+  {  6637,   9,  14,  11,    1,  -14 },   // 0xEB
+  {  6669,   5,  15,   5,    0,  -15 },   // 0xEC
+  {  6688,   7,  15,   5,    0,  -15 },   // 0xED
+  {  6715,   6,  15,   5,    0,  -15 },   // 0xEE
+  {  6738,   7,  14,   5,    0,  -14 },   // 0xEF
+  {  6763,  10,  14,  11,    0,  -14 },   // 0xF0
+  {  6798,  10,  14,  11,    0,  -14 },   // 0xF1
+  {  6833,   9,  15,  11,    1,  -15 },   // 0xF2
+  {  6867,   9,  15,  11,    1,  -15 },   // 0xF3
+  {  6901,   9,  15,  11,    1,  -15 },   // 0xF4
+  {  6935,   9,  14,  11,    1,  -14 },   // 0xF5
+  {  6967,   9,  14,  11,    1,  -14 },   // 0xF6
+  {  6999,  11,   9,  15,    2,  -10 },   // 0xF7
+  {  7024,  11,  12,  11,    0,  -11 },   // 0xF8
+  {  7057,  10,  15,  11,    1,  -15 },   // 0xF9
+  {  7095,  10,  15,  11,    1,  -15 },   // 0xFA
+  {  7133,  10,  15,  11,    1,  -15 },   // 0xFB
+  {  7171,  10,  14,  11,    1,  -14 },   // 0xFC
+  {  7206,  12,  18,  10,   -1,  -14 },   // 0xFD
+  {  7260,  11,  18,  11,    0,  -14 },   // 0xFE
+  {  7310,  12,  18,  10,   -1,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans_Oblique9pt8bAa2 = {
+  DejaVuSans_Oblique9pt8bAa2Bitmaps, DejaVuSans_Oblique9pt8bAa2Glyphs, 0x20, 0xFF, 21, 2 };
+
+// Approx. 8940 bytes
+#endif // DEJAVUSANS_OBLIQUE9PT8BAA2_H
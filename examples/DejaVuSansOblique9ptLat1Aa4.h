@@ -0,0 +1,1536 @@
+#ifndef DEJAVUSANS_OBLIQUE9PT8BAA4_H
+#define DEJAVUSANS_OBLIQUE9PT8BAA4_H
+// Police anti-aliasée 4 bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)
+#include "AaFont.h"
+const uint8_t DejaVuSans_Oblique9pt8bAa4Bitmaps[] PROGMEM = {
+  0x00, 0x3F, 0x80, 0x06, 0xF5, 0x00, 0x9F, 0x20, 0x0C, 0xE0, 0x00, 0xEC,
+  0x00, 0x2F, 0x90, 0x05, 0xF5, 0x00, 0x7F, 0x10, 0x07, 0xB0, 0x00, 0x00,
+  0x00, 0x13, 0x20, 0x05, 0xF7, 0x00, 0x8F, 0x40, 0x00, 0x4F, 0x21, 0xF6,
+  0x4F, 0x21, 0xF6, 0x4F, 0x21, 0xF6, 0x4F, 0x21, 0xF6, 0x4D, 0x21, 0xD5,
+  0x00, 0x00, 0x0C, 0x90, 0x0D, 0x80, 0x00, 0x00, 0x00, 0xF6, 0x02, 0xF4,
+  0x00, 0x00, 0x00, 0x3F, 0x20, 0x5F, 0x10, 0x00, 0x01, 0x17, 0xE1, 0x19,
+  0xD1, 0x11, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x34, 0x4F, 0x84,
+  0x5F, 0x74, 0x41, 0x00, 0x03, 0xF2, 0x05, 0xF1, 0x00, 0x00, 0x11, 0x8E,
+  0x11, 0x9C, 0x11, 0x10, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x03, 0x44,
+  0xF8, 0x45, 0xF7, 0x44, 0x10, 0x00, 0x3F, 0x20, 0x5F, 0x10, 0x00, 0x00,
+  0x07, 0xE0, 0x09, 0xC0, 0x00, 0x00, 0x00, 0xBA, 0x00, 0xC9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00,
+  0x00, 0x5A, 0xE3, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xDA, 0x00, 0xAF, 0x93,
+  0xD5, 0x8B, 0x00, 0xFB, 0x04, 0x90, 0x00, 0x00, 0xFA, 0x07, 0x60, 0x00,
+  0x00, 0x9F, 0xAC, 0x50, 0x00, 0x00, 0x07, 0xDF, 0xFD, 0x40, 0x00, 0x00,
+  0x1D, 0x5D, 0xF2, 0x00, 0x00, 0x49, 0x05, 0xF6, 0x11, 0x00, 0x76, 0x07,
+  0xF4, 0x4E, 0x85, 0xB7, 0x8F, 0xB0, 0x29, 0xDE, 0xFE, 0xC6, 0x00, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x03, 0x30,
+  0x00, 0x00, 0x01, 0x9E, 0xEA, 0x10, 0x00, 0x05, 0xE2, 0x00, 0xBC, 0x33,
+  0xE8, 0x00, 0x03, 0xE4, 0x00, 0x3F, 0x30, 0x0A, 0xA0, 0x01, 0xD7, 0x00,
+  0x05, 0xF0, 0x00, 0xC8, 0x00, 0xB9, 0x00, 0x00, 0x4F, 0x40, 0x6F, 0x30,
+  0x9C, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x40, 0x6D, 0x10, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x3E, 0x34, 0xBE, 0xB2, 0x00, 0x00, 0x00, 0x2E, 0x52, 0xF7,
+  0x3A, 0xC0, 0x00, 0x00, 0x1C, 0x80, 0xAB, 0x00, 0x4F, 0x10, 0x00, 0x0A,
+  0xB0, 0x0D, 0x70, 0x05, 0xF1, 0x00, 0x07, 0xD1, 0x00, 0xE6, 0x00, 0x8D,
+  0x00, 0x04, 0xE2, 0x00, 0x0A, 0xC3, 0x5E, 0x50, 0x02, 0xE4, 0x00, 0x00,
+  0x2B, 0xED, 0x60, 0x00, 0x00, 0x00, 0x17, 0xDF, 0xEA, 0x20, 0x00, 0x00,
+  0x0B, 0xF9, 0x68, 0xD3, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x4D, 0xF3, 0x00,
+  0x0C, 0xB0, 0x8F, 0x30, 0x3E, 0xE2, 0x03, 0xF5, 0x0E, 0xA0, 0x00, 0x5F,
+  0xC1, 0xBD, 0x02, 0xF9, 0x00, 0x00, 0x8F, 0xDF, 0x30, 0x1F, 0xD1, 0x00,
+  0x01, 0xEF, 0x90, 0x00, 0x9F, 0xD8, 0x79, 0xEE, 0xDF, 0x30, 0x00, 0x6C,
+  0xEE, 0xC7, 0x14, 0xFD, 0x10, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4D,
+  0x20, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x3F, 0x60, 0x00, 0x1D, 0xB0, 0x00,
+  0x09, 0xF2, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x1E, 0xB0,
+  0x00, 0x04, 0xF6, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x09, 0xF1, 0x00, 0x00,
+  0x9F, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x02, 0xF6,
+  0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x0A, 0xB0,
+  0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x0B, 0xC0, 0x00,
+  0x00, 0x9F, 0x00, 0x00, 0x09, 0xF1, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x0C,
+  0xE0, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x0B, 0xF1, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0xBE, 0x10, 0x00, 0x5F, 0x50, 0x00, 0x1E, 0x90,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x01, 0x30, 0x1D,
+  0x00, 0x40, 0x3D, 0x92, 0xD2, 0xBC, 0x10, 0x07, 0xDF, 0xD5, 0x00, 0x00,
+  0x5D, 0xFB, 0x30, 0x02, 0xBB, 0x3D, 0x4C, 0xA1, 0x15, 0x01, 0xD0, 0x06,
+  0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x02, 0x22, 0x27, 0xF4, 0x22, 0x22, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x58, 0xF6, 0x55, 0x54, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x03, 0x83,
+  0x09, 0xF3, 0x0D, 0xC0, 0x5F, 0x30, 0xB7, 0x00, 0x02, 0x22, 0x21, 0x1F,
+  0xFF, 0xF9, 0x15, 0x55, 0x52, 0x23, 0x1A, 0xF2, 0xDE, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0xCB,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5C, 0xEE, 0x90, 0x00, 0x00, 0x8F, 0xB6, 0xAF, 0x90,
+  0x00, 0x5F, 0x80, 0x00, 0xBF, 0x10, 0x0D, 0xD0, 0x00, 0x07, 0xF3, 0x05,
+  0xF6, 0x00, 0x00, 0x6F, 0x50, 0xAF, 0x10, 0x00, 0x07, 0xF4, 0x0E, 0xD0,
+  0x00, 0x00, 0xAF, 0x21, 0xFA, 0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90, 0x00,
+  0x03, 0xF9, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x20, 0x0D, 0xD0, 0x00, 0x5F,
+  0x90, 0x00, 0x6F, 0xB7, 0x9F, 0xB0, 0x00, 0x00, 0x7D, 0xFD, 0x70, 0x00,
+  0x00, 0x00, 0x07, 0xAD, 0xFD, 0x00, 0x03, 0xFC, 0xAF, 0xA0, 0x00, 0x00,
+  0x04, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0A, 0xF1, 0x00,
+  0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x04, 0xF7,
+  0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00,
+  0xCE, 0x00, 0x00, 0x77, 0x7F, 0xD7, 0x74, 0x1F, 0xFF, 0xFF, 0xFF, 0x50,
+  0x00, 0x27, 0xBD, 0xED, 0x70, 0x00, 0x09, 0xFB, 0x88, 0xDF, 0x90, 0x00,
+  0x41, 0x00, 0x01, 0xEF, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x00, 0x00,
+  0x00, 0x01, 0xED, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00,
+  0xAF, 0x70, 0x00, 0x00, 0x01, 0xCF, 0x50, 0x00, 0x00, 0x03, 0xDE, 0x40,
+  0x00, 0x00, 0x04, 0xED, 0x20, 0x00, 0x00, 0x06, 0xFB, 0x10, 0x00, 0x00,
+  0x07, 0xFE, 0x77, 0x77, 0x75, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x29, 0xCE, 0xFD, 0x81, 0x00, 0x6C, 0x97, 0x7B, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x01, 0x22, 0x4B,
+  0xE3, 0x00, 0x07, 0xFF, 0xFA, 0x10, 0x00, 0x03, 0x46, 0xAF, 0x90, 0x00,
+  0x00, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00,
+  0x0C, 0xF1, 0x20, 0x00, 0x00, 0x7F, 0x90, 0xCD, 0x97, 0x8C, 0xFB, 0x10,
+  0x7C, 0xEF, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x00,
+  0x00, 0xAF, 0xF7, 0x00, 0x00, 0x07, 0xFA, 0xF5, 0x00, 0x00, 0x4F, 0x69,
+  0xF2, 0x00, 0x02, 0xE9, 0x0C, 0xE0, 0x00, 0x1C, 0xB0, 0x0E, 0xB0, 0x00,
+  0xAD, 0x10, 0x2F, 0x80, 0x07, 0xE3, 0x00, 0x5F, 0x60, 0x4F, 0x72, 0x22,
+  0x9F, 0x52, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x35, 0x55, 0x55, 0xED, 0x53,
+  0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x0C,
+  0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xFC, 0x77, 0x77, 0x70, 0x00, 0x3F, 0x60,
+  0x00, 0x00, 0x00, 0x06, 0xF3, 0x10, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFB,
+  0x20, 0x00, 0x0A, 0x86, 0x6A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0x20, 0x10, 0x00, 0x00, 0x6F, 0x90, 0x07, 0xD9,
+  0x77, 0xBF, 0xB1, 0x00, 0x5B, 0xEF, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x01,
+  0x8C, 0xEE, 0xB3, 0x00, 0x3D, 0xEA, 0x88, 0xC3, 0x01, 0xEA, 0x10, 0x00,
+  0x00, 0x09, 0xD1, 0x01, 0x00, 0x00, 0x1F, 0x8A, 0xFF, 0xE6, 0x00, 0x6F,
+  0xEB, 0x66, 0xDF, 0x50, 0xAF, 0xB0, 0x00, 0x3F, 0xB0, 0xCF, 0x30, 0x00,
+  0x0E, 0xC0, 0xDE, 0x00, 0x00, 0x0F, 0xB0, 0xDE, 0x00, 0x00, 0x4F, 0x70,
+  0xAF, 0x30, 0x01, 0xCE, 0x10, 0x3F, 0xE7, 0x7D, 0xF4, 0x00, 0x03, 0xBE,
+  0xEB, 0x30, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x77, 0x77, 0x7C,
+  0xF7, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00,
+  0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00, 0x7F,
+  0x70, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00,
+  0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0xDE, 0x10, 0x00, 0x00, 0x07, 0xF7,
+  0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xED,
+  0x92, 0x00, 0x03, 0xEE, 0x86, 0x8E, 0xE1, 0x00, 0xBF, 0x20, 0x00, 0x6F,
+  0x60, 0x0D, 0xD0, 0x00, 0x07, 0xF5, 0x00, 0x7F, 0x82, 0x27, 0xED, 0x10,
+  0x00, 0x9F, 0xFF, 0xFB, 0x20, 0x02, 0xDD, 0x75, 0x8D, 0x40, 0x00, 0xCD,
+  0x10, 0x00, 0x7F, 0x20, 0x4F, 0x70, 0x00, 0x03, 0xF7, 0x06, 0xF5, 0x00,
+  0x00, 0x5F, 0x70, 0x4F, 0xA0, 0x00, 0x1C, 0xF3, 0x00, 0xCF, 0xA7, 0x8D,
+  0xF8, 0x00, 0x01, 0x8D, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFC,
+  0x50, 0x00, 0x03, 0xEE, 0x87, 0xCF, 0x60, 0x01, 0xDD, 0x10, 0x00, 0xDD,
+  0x00, 0x5F, 0x50, 0x00, 0x0A, 0xF1, 0x08, 0xF2, 0x00, 0x00, 0xCF, 0x10,
+  0x8F, 0x40, 0x00, 0x4F, 0xF0, 0x04, 0xFC, 0x42, 0x6E, 0xFD, 0x00, 0x07,
+  0xFF, 0xFE, 0x6F, 0xA0, 0x00, 0x01, 0x33, 0x06, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x01, 0xE9, 0x79, 0xDE,
+  0x50, 0x00, 0x1A, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x01, 0x32, 0x07, 0xF6,
+  0x0A, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0xCF, 0x00, 0xFC, 0x00, 0x00, 0x03, 0x20, 0x04, 0xF8, 0x00, 0x7F, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10,
+  0x09, 0xF3, 0x00, 0xDD, 0x00, 0x5F, 0x30, 0x0B, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDE, 0x00, 0x00,
+  0x01, 0x6B, 0xFF, 0xB5, 0x00, 0x04, 0xAE, 0xFC, 0x71, 0x00, 0x18, 0xEF,
+  0xD8, 0x20, 0x00, 0x00, 0x2F, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x05, 0xBF,
+  0xFB, 0x51, 0x00, 0x00, 0x00, 0x02, 0x7C, 0xFE, 0x94, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x07, 0xCF,
+  0xFA, 0x50, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFE, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0xEF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0x00, 0x00,
+  0x01, 0x6C, 0xFE, 0xA4, 0x00, 0x15, 0xBF, 0xFB, 0x61, 0x00, 0x19, 0xEF,
+  0xD7, 0x20, 0x00, 0x00, 0x2E, 0x93, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE,
+  0xEB, 0x29, 0xD9, 0x7B, 0xFC, 0x40, 0x00, 0x0D, 0xF0, 0x00, 0x01, 0xEC,
+  0x00, 0x01, 0xBF, 0x30, 0x02, 0xCE, 0x40, 0x01, 0xDD, 0x20, 0x00, 0x8F,
+  0x20, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x85, 0x00, 0x00, 0x13, 0x10, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C,
+  0xEF, 0xEB, 0x50, 0x00, 0x00, 0x01, 0xAF, 0xB7, 0x43, 0x58, 0xEB, 0x10,
+  0x00, 0x2D, 0xC3, 0x00, 0x00, 0x00, 0x2C, 0xB0, 0x01, 0xEA, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xE5, 0x0A, 0xC0, 0x00, 0x8D, 0xFC, 0x4F, 0x20, 0xAA,
+  0x3F, 0x30, 0x0B, 0xD6, 0x48, 0xEE, 0x00, 0x8B, 0x9B, 0x00, 0x6E, 0x20,
+  0x00, 0xDB, 0x00, 0xAA, 0xC7, 0x00, 0xB9, 0x00, 0x00, 0xD8, 0x01, 0xE6,
+  0xE5, 0x00, 0xD8, 0x00, 0x03, 0xF5, 0x08, 0xD0, 0xE5, 0x00, 0x9E, 0x31,
+  0x5D, 0xF4, 0x9D, 0x20, 0xB8, 0x00, 0x1B, 0xFF, 0xD8, 0xFE, 0x81, 0x00,
+  0x6E, 0x10, 0x00, 0x22, 0x01, 0x20, 0x00, 0x00, 0x0C, 0xB1, 0x00, 0x00,
+  0x00, 0x53, 0x00, 0x00, 0x02, 0xDD, 0x62, 0x12, 0x5B, 0xF6, 0x00, 0x00,
+  0x00, 0x18, 0xEF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x6E, 0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7, 0xBE, 0x00, 0x00, 0x00,
+  0x08, 0xD1, 0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60, 0x5F, 0x40, 0x00, 0x00,
+  0xAC, 0x00, 0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xA0, 0x00, 0x0C,
+  0xC2, 0x22, 0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xDA,
+  0x55, 0x55, 0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00, 0x05, 0xF6, 0x2E, 0x90,
+  0x00, 0x00, 0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x2F,
+  0xFF, 0xFF, 0xD9, 0x20, 0x05, 0xFA, 0x77, 0x7B, 0xFB, 0x00, 0x8F, 0x30,
+  0x00, 0x0D, 0xE0, 0x0A, 0xE0, 0x00, 0x00, 0xEC, 0x00, 0xDC, 0x22, 0x24,
+  0xBE, 0x30, 0x1F, 0xFF, 0xFF, 0xFC, 0x20, 0x04, 0xF8, 0x44, 0x59, 0xFB,
+  0x00, 0x7F, 0x30, 0x00, 0x0A, 0xF3, 0x0A, 0xF0, 0x00, 0x00, 0x7F, 0x50,
+  0xDD, 0x00, 0x00, 0x09, 0xF3, 0x1F, 0xA0, 0x00, 0x03, 0xFD, 0x04, 0xFB,
+  0x77, 0x7A, 0xFE, 0x30, 0x7F, 0xFF, 0xFF, 0xD9, 0x20, 0x00, 0x00, 0x00,
+  0x17, 0xCE, 0xFD, 0xA3, 0x00, 0x00, 0x4E, 0xFB, 0x87, 0xAE, 0xF2, 0x00,
+  0x3E, 0xD3, 0x00, 0x00, 0x1A, 0x00, 0x1D, 0xE2, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x04, 0x50, 0x00, 0x2D, 0xFB,
+  0x87, 0x9D, 0xF4, 0x00, 0x00, 0x18, 0xDF, 0xED, 0xA5, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xFE, 0xD9, 0x30, 0x00, 0x05, 0xFA, 0x77, 0x8A, 0xFF, 0x60,
+  0x00, 0x8F, 0x40, 0x00, 0x02, 0xDF, 0x20, 0x0A, 0xF1, 0x00, 0x00, 0x06,
+  0xF8, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x1F, 0xA0, 0x00, 0x00,
+  0x02, 0xFA, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x7F, 0x40, 0x00,
+  0x00, 0x07, 0xF5, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0xCE, 0x10, 0xDD, 0x00,
+  0x00, 0x00, 0x7F, 0x80, 0x1F, 0xB0, 0x00, 0x01, 0x8F, 0xC0, 0x04, 0xFB,
+  0x77, 0x8A, 0xEF, 0xA1, 0x00, 0x7F, 0xFF, 0xFE, 0xC9, 0x30, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0xFA, 0x77, 0x77, 0x76, 0x00,
+  0x8F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDC,
+  0x22, 0x22, 0x22, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xA0, 0x04, 0xF8, 0x55,
+  0x55, 0x53, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00,
+  0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00,
+  0x04, 0xFB, 0x77, 0x77, 0x77, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x05, 0xFA, 0x77, 0x77, 0x71, 0x00,
+  0x8F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDC,
+  0x22, 0x22, 0x20, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x00, 0x04, 0xF8, 0x55,
+  0x55, 0x30, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00,
+  0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0xCE, 0xFE, 0xA5, 0x00, 0x00, 0x3D, 0xFB, 0x87, 0x8C,
+  0xFA, 0x00, 0x3E, 0xE4, 0x00, 0x00, 0x04, 0x60, 0x0C, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x10, 0x00,
+  0x12, 0x22, 0x20, 0x1F, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0x22, 0xFA, 0x00,
+  0x00, 0x25, 0x5D, 0xE0, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0xEB, 0x01, 0xFD,
+  0x00, 0x00, 0x00, 0x2F, 0x90, 0x0A, 0xF7, 0x00, 0x00, 0x06, 0xF6, 0x00,
+  0x2D, 0xFC, 0x87, 0x8C, 0xFE, 0x20, 0x00, 0x18, 0xDF, 0xFD, 0xA6, 0x10,
+  0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x1F, 0xA0, 0x05, 0xF6, 0x00, 0x00,
+  0x04, 0xF7, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x7F, 0x40, 0x0A, 0xF0, 0x00,
+  0x00, 0x0B, 0xF2, 0x00, 0xDC, 0x22, 0x22, 0x22, 0xEE, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB0, 0x04, 0xF9, 0x55, 0x55, 0x58, 0xF8, 0x00, 0x7F,
+  0x30, 0x00, 0x00, 0x7F, 0x50, 0x0A, 0xF1, 0x00, 0x00, 0x0A, 0xF2, 0x00,
+  0xDD, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F, 0xB0,
+  0x04, 0xF7, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x6F,
+  0x60, 0x00, 0x00, 0x2F, 0x90, 0x05, 0xF6, 0x00, 0x8F, 0x40, 0x0A, 0xF1,
+  0x00, 0xDD, 0x00, 0x1F, 0xA0, 0x04, 0xF7, 0x00, 0x7F, 0x40, 0x0A, 0xF1,
+  0x00, 0xDD, 0x00, 0x1F, 0xA0, 0x04, 0xF8, 0x00, 0x7F, 0x50, 0x00, 0x00,
+  0x00, 0x02, 0xF9, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x08, 0xF3, 0x00,
+  0x00, 0x0B, 0xF1, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x1F, 0xA0, 0x00,
+  0x00, 0x4F, 0x70, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xAF, 0x10, 0x00,
+  0x00, 0xCE, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x06, 0xF5, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x59,
+  0xEE, 0x30, 0x00, 0xCE, 0xB3, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x04,
+  0xEE, 0x30, 0x05, 0xF6, 0x00, 0x07, 0xFC, 0x20, 0x00, 0x8F, 0x40, 0x09,
+  0xF9, 0x00, 0x00, 0x0A, 0xF1, 0x2C, 0xF7, 0x00, 0x00, 0x00, 0xDD, 0x3E,
+  0xE4, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC2, 0x00, 0x00, 0x00, 0x04, 0xFE,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5D, 0xE3, 0x00, 0x00, 0x00, 0x0A,
+  0xF1, 0x2E, 0xD1, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x4F, 0xC0, 0x00, 0x00,
+  0x1F, 0xA0, 0x00, 0x7F, 0x90, 0x00, 0x04, 0xF8, 0x00, 0x00, 0xAF, 0x70,
+  0x00, 0x7F, 0x50, 0x00, 0x01, 0xCF, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x00,
+  0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x0B, 0xF1,
+  0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x04,
+  0xF7, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00,
+  0x00, 0xDD, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x04, 0xFB, 0x77,
+  0x77, 0x75, 0x7F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x2F, 0xFA, 0x00, 0x00,
+  0x03, 0xFF, 0xA0, 0x05, 0xFE, 0xD0, 0x00, 0x00, 0xCF, 0xF7, 0x00, 0x8F,
+  0xAF, 0x00, 0x00, 0x5F, 0xAF, 0x40, 0x0A, 0xF5, 0xF3, 0x00, 0x1D, 0xA9,
+  0xF1, 0x00, 0xDC, 0x2F, 0x50, 0x07, 0xF2, 0xCD, 0x00, 0x1F, 0x90, 0xE8,
+  0x02, 0xE8, 0x0F, 0xA0, 0x04, 0xF6, 0x0B, 0xA0, 0xAE, 0x13, 0xF7, 0x00,
+  0x7F, 0x30, 0x8D, 0x3F, 0x60, 0x6F, 0x40, 0x0A, 0xF1, 0x06, 0xFC, 0xC0,
+  0x09, 0xF1, 0x00, 0xDD, 0x00, 0x3F, 0xF4, 0x00, 0xCE, 0x00, 0x1F, 0xA0,
+  0x00, 0x86, 0x00, 0x0E, 0xB0, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF8,
+  0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x2F, 0xF7,
+  0x00, 0x00, 0x1F, 0x90, 0x05, 0xFF, 0xC0, 0x00, 0x04, 0xF6, 0x00, 0x8F,
+  0xAF, 0x20, 0x00, 0x7F, 0x30, 0x0A, 0xF2, 0xF6, 0x00, 0x0A, 0xF1, 0x00,
+  0xDC, 0x0C, 0xB0, 0x00, 0xDD, 0x00, 0x1F, 0x90, 0x8F, 0x10, 0x1F, 0xA0,
+  0x04, 0xF6, 0x03, 0xF6, 0x04, 0xF7, 0x00, 0x7F, 0x30, 0x0D, 0xB0, 0x7F,
+  0x40, 0x0A, 0xF1, 0x00, 0x8F, 0x19, 0xF1, 0x00, 0xDD, 0x00, 0x04, 0xF5,
+  0xCD, 0x00, 0x1F, 0xA0, 0x00, 0x0E, 0xAF, 0xA0, 0x04, 0xF7, 0x00, 0x00,
+  0x9F, 0xF7, 0x00, 0x7F, 0x40, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x17, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C, 0xFC, 0x10,
+  0x00, 0x3E, 0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00, 0x00,
+  0x0E, 0xE0, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1, 0x00,
+  0x00, 0x00, 0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x4F,
+  0x90, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F,
+  0x50, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00, 0x00,
+  0x4E, 0xE2, 0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00, 0x00, 0x18,
+  0xDF, 0xEC, 0x60, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0xC4, 0x00, 0x05,
+  0xFA, 0x77, 0x9F, 0xF3, 0x00, 0x8F, 0x30, 0x00, 0x6F, 0x70, 0x0A, 0xF0,
+  0x00, 0x04, 0xF8, 0x00, 0xDC, 0x00, 0x00, 0x9F, 0x50, 0x1F, 0xA2, 0x23,
+  0x8F, 0xC0, 0x04, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x7F, 0x65, 0x54, 0x10,
+  0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xA0, 0x00, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00,
+  0x00, 0x04, 0xEF, 0xB8, 0x8C, 0xFC, 0x10, 0x00, 0x3E, 0xD3, 0x00, 0x00,
+  0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00, 0x00, 0x0E, 0xE0, 0x07, 0xF7, 0x00,
+  0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x2F,
+  0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x2F,
+  0xC0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x1F, 0xC0, 0x00, 0x00,
+  0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x4E, 0xE2, 0x00, 0x02, 0xDF,
+  0xA7, 0x8B, 0xFD, 0x30, 0x00, 0x00, 0x18, 0xDF, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6,
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0xB3, 0x00, 0x05, 0xFA, 0x77, 0x9F,
+  0xE2, 0x00, 0x8F, 0x30, 0x00, 0x7F, 0x70, 0x0A, 0xF1, 0x00, 0x05, 0xF8,
+  0x00, 0xDD, 0x00, 0x00, 0x9F, 0x50, 0x1F, 0xA2, 0x23, 0x9F, 0xB0, 0x04,
+  0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x7F, 0x75, 0x5A, 0xF9, 0x00, 0x0A, 0xF1,
+  0x00, 0x0C, 0xF1, 0x00, 0xDD, 0x00, 0x00, 0x6F, 0x60, 0x1F, 0xA0, 0x00,
+  0x01, 0xFB, 0x04, 0xF7, 0x00, 0x00, 0x0C, 0xF1, 0x7F, 0x50, 0x00, 0x00,
+  0x7F, 0x50, 0x00, 0x02, 0x8D, 0xFE, 0xDA, 0x40, 0x03, 0xEF, 0xA7, 0x8A,
+  0xF7, 0x00, 0xDE, 0x20, 0x00, 0x01, 0x10, 0x4F, 0x90, 0x00, 0x00, 0x00,
+  0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0x85, 0x10, 0x00, 0x00,
+  0x18, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x26, 0xDF, 0x70, 0x00, 0x00,
+  0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x41, 0x00, 0x00,
+  0x1B, 0xF5, 0x0B, 0xFA, 0x77, 0x9E, 0xF9, 0x00, 0x49, 0xCE, 0xFE, 0xA4,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x17, 0x77, 0x7D, 0xF7,
+  0x77, 0x75, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00,
+  0x04, 0xF7, 0x08, 0xF3, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0, 0x00, 0x00,
+  0x0A, 0xF1, 0x0E, 0xC0, 0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90, 0x00, 0x00,
+  0x1F, 0xA0, 0x5F, 0x60, 0x00, 0x00, 0x4F, 0x70, 0x8F, 0x30, 0x00, 0x00,
+  0x7F, 0x40, 0xBF, 0x00, 0x00, 0x00, 0xAF, 0x20, 0xDD, 0x00, 0x00, 0x00,
+  0xDD, 0x00, 0xED, 0x00, 0x00, 0x04, 0xF9, 0x00, 0xCF, 0x20, 0x00, 0x1C,
+  0xF2, 0x00, 0x5F, 0xE8, 0x79, 0xEF, 0x50, 0x00, 0x04, 0xBE, 0xFD, 0xA3,
+  0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x02, 0xFC, 0x6F, 0x50, 0x00, 0x00,
+  0x0A, 0xF3, 0x3F, 0x70, 0x00, 0x00, 0x3F, 0xA0, 0x0F, 0xA0, 0x00, 0x00,
+  0xBE, 0x20, 0x0D, 0xC0, 0x00, 0x05, 0xF8, 0x00, 0x0A, 0xF0, 0x00, 0x0D,
+  0xD1, 0x00, 0x08, 0xF2, 0x00, 0x7F, 0x50, 0x00, 0x05, 0xF5, 0x01, 0xEC,
+  0x00, 0x00, 0x02, 0xF8, 0x08, 0xF3, 0x00, 0x00, 0x00, 0xFA, 0x2F, 0xA0,
+  0x00, 0x00, 0x00, 0xCD, 0xAE, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xD1, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x06,
+  0xFC, 0x00, 0x00, 0x1E, 0xB3, 0xF7, 0x00, 0x00, 0xCF, 0xD0, 0x00, 0x07,
+  0xF5, 0x2F, 0x80, 0x00, 0x4F, 0xCE, 0x00, 0x00, 0xDD, 0x01, 0xF9, 0x00,
+  0x0A, 0xD7, 0xF0, 0x00, 0x5F, 0x70, 0x0F, 0x90, 0x02, 0xF7, 0x6F, 0x10,
+  0x0B, 0xE1, 0x00, 0xFA, 0x00, 0x9E, 0x15, 0xF1, 0x03, 0xF8, 0x00, 0x0E,
+  0xB0, 0x1E, 0x80, 0x4F, 0x20, 0x9F, 0x20, 0x00, 0xDC, 0x07, 0xF2, 0x03,
+  0xF3, 0x1E, 0xA0, 0x00, 0x0C, 0xD0, 0xDA, 0x00, 0x3F, 0x47, 0xF4, 0x00,
+  0x00, 0xBE, 0x5F, 0x30, 0x02, 0xF5, 0xDC, 0x00, 0x00, 0x0A, 0xFB, 0xC0,
+  0x00, 0x1F, 0xBF, 0x50, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x08, 0xFD, 0x00, 0x00, 0x0E, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xF6, 0x00, 0x00, 0x2E, 0xD1, 0x00, 0x00, 0xDD, 0x00, 0x01, 0xDE,
+  0x30, 0x00, 0x00, 0x6F, 0x50, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0xC0,
+  0x9F, 0x60, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x2E, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x39, 0xF3,
+  0x00, 0x00, 0x00, 0x0B, 0xF4, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x9F, 0x60,
+  0x00, 0xAF, 0x20, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x5F,
+  0xA0, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x7F, 0x73,
+  0xFA, 0x00, 0x00, 0x5F, 0x90, 0x0B, 0xF2, 0x00, 0x3F, 0xB0, 0x00, 0x3F,
+  0x80, 0x2E, 0xD1, 0x00, 0x00, 0xBE, 0x2D, 0xE2, 0x00, 0x00, 0x04, 0xFE,
+  0xF3, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0x00, 0x07, 0x77, 0x77, 0x77, 0xBF, 0xD1, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xED, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xD2, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE2, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xEE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xE3, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xEE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xE3,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xDE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1D,
+  0xFB, 0x77, 0x77, 0x77, 0x72, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x00, 0x00, 0x05, 0xFF, 0xF5, 0x00, 0x08, 0xF4, 0x41, 0x00, 0x0B, 0xD0,
+  0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x06, 0xF2, 0x00,
+  0x00, 0x09, 0xE0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0E, 0x90, 0x00,
+  0x00, 0x2F, 0xFF, 0x70, 0x00, 0x13, 0x33, 0x10, 0x00, 0x7F, 0x00, 0x5F,
+  0x20, 0x3F, 0x40, 0x1F, 0x50, 0x0F, 0x70, 0x0D, 0x90, 0x0B, 0xB0, 0x0A,
+  0xC0, 0x08, 0xE0, 0x06, 0xF1, 0x04, 0xF2, 0x03, 0xF4, 0x01, 0xF6, 0x00,
+  0xE8, 0x00, 0x64, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x34, 0xEB, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x09, 0xF0,
+  0x00, 0x00, 0xCC, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x00, 0x00,
+  0x5F, 0x40, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0E, 0xA0,
+  0x00, 0x02, 0xF7, 0x00, 0x00, 0x5F, 0x50, 0x08, 0xFF, 0xF2, 0x00, 0x23,
+  0x33, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x01, 0xCF, 0xAF,
+  0x90, 0x00, 0x01, 0xBF, 0x50, 0x7F, 0x90, 0x00, 0xBE, 0x40, 0x00, 0x6F,
+  0x80, 0xAE, 0x30, 0x00, 0x00, 0x6F, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x48, 0x10, 0x1E, 0x80, 0x06, 0xF2, 0x00,
+  0xC9, 0x00, 0x18, 0xCE, 0xEC, 0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4, 0x00,
+  0x10, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B, 0xDF,
+  0xFF, 0xF7, 0x08, 0xF9, 0x54, 0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A, 0xF1,
+  0x4F, 0x70, 0x00, 0x6F, 0xD0, 0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04, 0xCF,
+  0xD8, 0x2F, 0x70, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0x29, 0xEE, 0xA1, 0x00, 0x0C, 0xED, 0x96, 0x9F, 0xB0,
+  0x00, 0xEF, 0x40, 0x00, 0x9F, 0x30, 0x2F, 0xB0, 0x00, 0x05, 0xF5, 0x05,
+  0xF4, 0x00, 0x00, 0x5F, 0x40, 0x8F, 0x10, 0x00, 0x08, 0xF1, 0x0B, 0xF1,
+  0x00, 0x01, 0xEB, 0x00, 0xDF, 0x50, 0x00, 0x8F, 0x30, 0x1F, 0xCE, 0x76,
+  0xBF, 0x70, 0x04, 0xF4, 0x7D, 0xFC, 0x50, 0x00, 0x00, 0x02, 0x8D, 0xFE,
+  0xB3, 0x00, 0x3E, 0xE8, 0x67, 0xD4, 0x01, 0xED, 0x20, 0x00, 0x00, 0x09,
+  0xF3, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
+  0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+  0x09, 0xFB, 0x76, 0x9C, 0x00, 0x00, 0x6C, 0xEE, 0xC6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x03,
+  0xBE, 0xE8, 0x2F, 0x60, 0x00, 0x4F, 0xC6, 0x6D, 0xCF, 0x40, 0x02, 0xEB,
+  0x00, 0x02, 0xFF, 0x10, 0x09, 0xF2, 0x00, 0x00, 0xDD, 0x00, 0x0E, 0xB0,
+  0x00, 0x00, 0xEA, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF7, 0x00, 0x2F, 0x80,
+  0x00, 0x08, 0xF5, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0xF2, 0x00, 0x0A, 0xFA,
+  0x68, 0xEE, 0xE0, 0x00, 0x01, 0x9E, 0xEC, 0x5D, 0xB0, 0x00, 0x00, 0x02,
+  0x9D, 0xFD, 0x60, 0x00, 0x4E, 0xD7, 0x6A, 0xF7, 0x01, 0xEB, 0x00, 0x00,
+  0xBD, 0x09, 0xE2, 0x00, 0x00, 0x8F, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F,
+  0x83, 0x33, 0x33, 0x33, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0x10, 0x08, 0xFC, 0x76, 0x8B, 0xB0, 0x00, 0x6C, 0xEE, 0xD9, 0x40,
+  0x00, 0x05, 0xCE, 0xF5, 0x00, 0x3F, 0xB5, 0x51, 0x00, 0x9E, 0x10, 0x00,
+  0x00, 0xDB, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x30, 0x26, 0xF8, 0x44, 0x00,
+  0x06, 0xF3, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,
+  0x0E, 0x90, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00,
+  0x8F, 0x10, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBE, 0xE8,
+  0x3F, 0x60, 0x05, 0xFC, 0x77, 0xDC, 0xF4, 0x02, 0xEB, 0x00, 0x03, 0xFF,
+  0x10, 0x9F, 0x20, 0x00, 0x0E, 0xD0, 0x0E, 0xA0, 0x00, 0x00, 0xEA, 0x02,
+  0xF8, 0x00, 0x00, 0x1F, 0x70, 0x2F, 0x70, 0x00, 0x07, 0xF5, 0x00, 0xFB,
+  0x00, 0x02, 0xEF, 0x20, 0x0A, 0xFA, 0x68, 0xED, 0xE0, 0x00, 0x19, 0xEE,
+  0xB3, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x00, 0x1C,
+  0xE1, 0x00, 0x4C, 0x75, 0x7D, 0xF4, 0x00, 0x03, 0xBE, 0xFE, 0xA3, 0x00,
+  0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
+  0x4F, 0x50, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x9F, 0x18,
+  0xDE, 0xB2, 0x00, 0xCE, 0xDA, 0x79, 0xFB, 0x00, 0xEF, 0x50, 0x00, 0xBE,
+  0x02, 0xF9, 0x00, 0x00, 0xAD, 0x05, 0xF4, 0x00, 0x00, 0xCB, 0x08, 0xF1,
+  0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x03, 0xF5, 0x0E, 0xA0, 0x00, 0x06,
+  0xF2, 0x1F, 0x70, 0x00, 0x09, 0xE0, 0x4F, 0x40, 0x00, 0x0C, 0xC0, 0x00,
+  0x0D, 0xB0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+  0x0C, 0xC0, 0x00, 0xE9, 0x00, 0x2F, 0x60, 0x05, 0xF4, 0x00, 0x8F, 0x10,
+  0x0B, 0xD0, 0x00, 0xEA, 0x00, 0x1F, 0x70, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x0C, 0xC0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x10, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xEA, 0x00, 0x00,
+  0x1F, 0x70, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x0A, 0xE0,
+  0x00, 0x00, 0xCB, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x00, 0x00,
+  0x6F, 0x30, 0x00, 0x0A, 0xE0, 0x00, 0x48, 0xF9, 0x00, 0x0D, 0xE9, 0x10,
+  0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x9F, 0x00, 0x02, 0xCE, 0x40, 0x0C, 0xC0, 0x04, 0xEC, 0x20, 0x00, 0xE9,
+  0x08, 0xF9, 0x00, 0x00, 0x2F, 0x7B, 0xF6, 0x00, 0x00, 0x05, 0xFF, 0xE3,
+  0x00, 0x00, 0x00, 0x8F, 0x9F, 0x50, 0x00, 0x00, 0x0B, 0xD0, 0xBE, 0x30,
+  0x00, 0x00, 0xEA, 0x01, 0xCE, 0x20, 0x00, 0x1F, 0x70, 0x02, 0xEC, 0x10,
+  0x04, 0xF4, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x0D, 0xB0, 0x01, 0xF8, 0x00,
+  0x4F, 0x50, 0x06, 0xF2, 0x00, 0x9E, 0x00, 0x0C, 0xC0, 0x00, 0xE9, 0x00,
+  0x2F, 0x60, 0x05, 0xF3, 0x00, 0x8F, 0x10, 0x0B, 0xD0, 0x00, 0xEA, 0x00,
+  0x1F, 0x70, 0x04, 0xF4, 0x00, 0x00, 0x9F, 0x2A, 0xEE, 0xA1, 0x18, 0xDE,
+  0xB2, 0x00, 0xCE, 0xD6, 0x38, 0xF9, 0xC8, 0x36, 0xFA, 0x00, 0xEE, 0x20,
+  0x00, 0xEF, 0x50, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0xEC, 0x00, 0x00,
+  0xBE, 0x05, 0xF4, 0x00, 0x02, 0xF7, 0x00, 0x00, 0xDB, 0x08, 0xF1, 0x00,
+  0x05, 0xF4, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xF1, 0x00, 0x04,
+  0xF6, 0x0E, 0xA0, 0x00, 0x0A, 0xE0, 0x00, 0x06, 0xF3, 0x1F, 0x70, 0x00,
+  0x0D, 0xB0, 0x00, 0x09, 0xF0, 0x4F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x0C,
+  0xC0, 0x00, 0x9E, 0x29, 0xEE, 0xB2, 0x00, 0xCE, 0xD6, 0x35, 0xEB, 0x00,
+  0xFE, 0x30, 0x00, 0xAE, 0x03, 0xF9, 0x00, 0x00, 0xAD, 0x05, 0xF4, 0x00,
+  0x00, 0xDB, 0x08, 0xF1, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x04, 0xF5,
+  0x0E, 0xA0, 0x00, 0x06, 0xF2, 0x1F, 0x70, 0x00, 0x09, 0xE0, 0x4F, 0x40,
+  0x00, 0x0C, 0xC0, 0x00, 0x03, 0xAE, 0xFC, 0x50, 0x00, 0x5F, 0xC7, 0x6C,
+  0xF5, 0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A, 0xF2, 0x00, 0x00, 0xBE, 0x0E,
+  0xA0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0xDB, 0x2F, 0x80, 0x00,
+  0x04, 0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1, 0x07, 0xFA, 0x67, 0xDE, 0x30,
+  0x00, 0x7D, 0xFD, 0x91, 0x00, 0x00, 0x8F, 0x3B, 0xEE, 0xB2, 0x00, 0x0B,
+  0xEE, 0x96, 0x9F, 0xD0, 0x00, 0xEF, 0x50, 0x00, 0x8F, 0x30, 0x2F, 0xA0,
+  0x00, 0x05, 0xF5, 0x04, 0xF5, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x20, 0x00,
+  0x08, 0xF2, 0x0A, 0xF1, 0x00, 0x01, 0xEC, 0x00, 0xDF, 0x50, 0x00, 0x8F,
+  0x40, 0x1F, 0xCE, 0x76, 0xBF, 0x70, 0x03, 0xF5, 0x7D, 0xFC, 0x50, 0x00,
+  0x6F, 0x20, 0x00, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xBE, 0xE9, 0x3F, 0x70, 0x04, 0xFC, 0x66, 0xDC, 0xF4, 0x02, 0xEB, 0x00,
+  0x02, 0xFF, 0x10, 0x9F, 0x20, 0x00, 0x0E, 0xD0, 0x0E, 0xB0, 0x00, 0x00,
+  0xEB, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x07, 0xF5,
+  0x01, 0xFB, 0x00, 0x03, 0xEF, 0x20, 0x0A, 0xFA, 0x68, 0xED, 0xE0, 0x00,
+  0x19, 0xEE, 0xA2, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00,
+  0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00,
+  0x08, 0xF1, 0x00, 0x00, 0x9F, 0x3A, 0xEF, 0x10, 0x0C, 0xEE, 0x84, 0x50,
+  0x00, 0xEF, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x05, 0xF4, 0x00,
+  0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xEA,
+  0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0xDE, 0xEC, 0x70, 0x1D, 0xE8, 0x67, 0xA9, 0x05, 0xF3, 0x00,
+  0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x01, 0xDF, 0xD9, 0x40, 0x00, 0x00,
+  0x59, 0xEF, 0xA0, 0x00, 0x00, 0x01, 0xBF, 0x11, 0x00, 0x00, 0x0B, 0xE0,
+  0xAD, 0x86, 0x6B, 0xF6, 0x06, 0xBD, 0xFD, 0xB4, 0x00, 0x00, 0x66, 0x00,
+  0x00, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x00, 0x0B, 0xFF, 0xFF, 0xF5, 0x3B,
+  0xF4, 0x44, 0x10, 0xCC, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x02, 0xF7, 0x00,
+  0x00, 0x5F, 0x40, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x07,
+  0xF8, 0x55, 0x00, 0x1A, 0xEF, 0xB0, 0x00, 0x0C, 0xC0, 0x00, 0x05, 0xF4,
+  0x0E, 0x90, 0x00, 0x08, 0xF1, 0x3F, 0x60, 0x00, 0x0A, 0xE0, 0x6F, 0x30,
+  0x00, 0x0D, 0xB0, 0x8F, 0x10, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x5F,
+  0x50, 0xEA, 0x00, 0x00, 0xAF, 0x20, 0xEB, 0x00, 0x05, 0xFF, 0x00, 0xBF,
+  0x97, 0xAD, 0xDC, 0x00, 0x2B, 0xED, 0x81, 0xF9, 0x00, 0xAF, 0x00, 0x00,
+  0x05, 0xF5, 0x7F, 0x30, 0x00, 0x0C, 0xC0, 0x4F, 0x50, 0x00, 0x6F, 0x40,
+  0x2F, 0x80, 0x01, 0xDB, 0x00, 0x0E, 0xA0, 0x07, 0xF3, 0x00, 0x0C, 0xD0,
+  0x1E, 0x90, 0x00, 0x09, 0xF0, 0x8E, 0x20, 0x00, 0x06, 0xF5, 0xF8, 0x00,
+  0x00, 0x04, 0xFE, 0xE1, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x7F,
+  0x10, 0x02, 0xFE, 0x00, 0x06, 0xF3, 0x6F, 0x20, 0x09, 0xFF, 0x00, 0x0C,
+  0xC0, 0x5F, 0x30, 0x1F, 0x9F, 0x10, 0x3F, 0x50, 0x4F, 0x40, 0x8D, 0x3F,
+  0x20, 0xAD, 0x00, 0x3F, 0x40, 0xE7, 0x2F, 0x31, 0xF7, 0x00, 0x2F, 0x56,
+  0xE1, 0x1F, 0x47, 0xE1, 0x00, 0x1F, 0x6D, 0x90, 0x0F, 0x5D, 0x90, 0x00,
+  0x0F, 0xBF, 0x20, 0x0F, 0xBF, 0x20, 0x00, 0x0E, 0xFA, 0x00, 0x0E, 0xFA,
+  0x00, 0x00, 0x0D, 0xF4, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x1E, 0xC0,
+  0x00, 0x0B, 0xE3, 0x00, 0x07, 0xF5, 0x00, 0xAF, 0x40, 0x00, 0x00, 0xDD,
+  0x09, 0xF5, 0x00, 0x00, 0x00, 0x6F, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x0D,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xF9,
+  0xBE, 0x10, 0x00, 0x00, 0x4F, 0xA0, 0x4F, 0x80, 0x00, 0x03, 0xEC, 0x10,
+  0x0B, 0xE1, 0x00, 0x2D, 0xD1, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x9F, 0x10,
+  0x00, 0x05, 0xF5, 0x00, 0x6F, 0x40, 0x00, 0x0D, 0xC0, 0x00, 0x3F, 0x70,
+  0x00, 0x7F, 0x30, 0x00, 0x0E, 0xA0, 0x01, 0xEA, 0x00, 0x00, 0x0B, 0xD0,
+  0x09, 0xF2, 0x00, 0x00, 0x08, 0xF1, 0x2F, 0x80, 0x00, 0x00, 0x05, 0xF4,
+  0xBE, 0x10, 0x00, 0x00, 0x01, 0xFB, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xEB,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, 0x00, 0x00, 0x15, 0x8F, 0x70,
+  0x00, 0x00, 0x00, 0x5F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x01, 0x44, 0x44, 0x5D, 0xF3, 0x00, 0x00, 0x00, 0xBF, 0x50,
+  0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x0B,
+  0xF4, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00,
+  0x00, 0xAF, 0x84, 0x44, 0x44, 0x00, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+  0x00, 0x08, 0xDF, 0x80, 0x00, 0x07, 0xF7, 0x42, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x7F,
+  0x10, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x27, 0xF6, 0x00, 0x00, 0xBF,
+  0xF7, 0x00, 0x00, 0x03, 0x5D, 0xD0, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00,
+  0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x00, 0x01, 0xFB, 0x10, 0x00, 0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00,
+  0x01, 0x32, 0x00, 0x00, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+  0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0x00, 0x0C,
+  0xEC, 0x30, 0x00, 0x00, 0x46, 0xEC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
+  0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x03, 0xF6,
+  0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x02, 0xFA, 0x20, 0x00, 0x00,
+  0x09, 0xFF, 0x80, 0x00, 0x09, 0xF8, 0x41, 0x00, 0x01, 0xF9, 0x00, 0x00,
+  0x00, 0x5F, 0x40, 0x00, 0x00, 0x09, 0xF1, 0x00, 0x00, 0x00, 0xCC, 0x00,
+  0x00, 0x01, 0x6F, 0x70, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x33, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x05, 0xCF, 0xFE,
+  0xA5, 0x23, 0x8D, 0x2F, 0x95, 0x69, 0xDF, 0xFF, 0xD6, 0x12, 0x00, 0x00,
+  0x02, 0x43, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11,
+  0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11,
+  0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11,
+  0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC,
+  0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC,
+  0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE,
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC,
+  0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE,
+  0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x1F,
+  0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE, 0xEE,
+  0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0xEE,
+  0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1F,
+  0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33,
+  0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33,
+  0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x1F, 0xCC, 0xCC, 0xCC, 0xCE, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+  0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00,
+  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x00, 0x1E, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x2F, 0xA0, 0x05, 0xF7, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x67,
+  0x00, 0x0D, 0x90, 0x02, 0xF8, 0x00, 0x5F, 0x60, 0x08, 0xF3, 0x00, 0xBF,
+  0x10, 0x0D, 0xD0, 0x01, 0xFA, 0x00, 0x4F, 0x80, 0x06, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0xB0,
+  0x00, 0x00, 0x5B, 0xFF, 0xD8, 0x00, 0xAF, 0x8A, 0x88, 0xA0, 0x8F, 0x40,
+  0xB2, 0x00, 0x2F, 0x80, 0x0D, 0x00, 0x07, 0xF2, 0x02, 0xB0, 0x00, 0x9E,
+  0x00, 0x58, 0x00, 0x0A, 0xF0, 0x08, 0x50, 0x00, 0x8F, 0x40, 0xA2, 0x00,
+  0x02, 0xFE, 0x7D, 0x7B, 0x50, 0x03, 0xBE, 0xFE, 0xA2, 0x00, 0x00, 0x49,
+  0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7C, 0xEE, 0xB1, 0x00, 0x00, 0x0B, 0xFA, 0x78, 0xC1, 0x00,
+  0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x01, 0x3A, 0xF5, 0x33, 0x20, 0x00, 0x00,
+  0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xA0, 0x00, 0x00, 0x00, 0x27, 0x9F, 0xB7, 0x77, 0x70, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xC8,
+  0x00, 0x10, 0x05, 0xE3, 0x07, 0xFA, 0xDF, 0xE9, 0xFA, 0x00, 0x09, 0xF9,
+  0x58, 0xEC, 0x00, 0x00, 0xC9, 0x00, 0x06, 0xF1, 0x00, 0x0F, 0x50, 0x00,
+  0x2F, 0x40, 0x00, 0xD8, 0x00, 0x05, 0xF2, 0x00, 0x09, 0xF6, 0x25, 0xDC,
+  0x00, 0x04, 0xFC, 0xFF, 0xFC, 0xF7, 0x01, 0xEA, 0x01, 0x42, 0x07, 0xF2,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF7,
+  0x00, 0x6F, 0x30, 0x00, 0x1D, 0xB0, 0x00, 0x1F, 0x90, 0x00, 0xAE, 0x20,
+  0x00, 0x0B, 0xE0, 0x05, 0xF5, 0x00, 0x00, 0x05, 0xF4, 0x2E, 0x80, 0x00,
+  0x08, 0xEE, 0xF9, 0xCF, 0xEE, 0x40, 0x01, 0x22, 0xBF, 0xF4, 0x22, 0x00,
+  0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x1E, 0xEE, 0xEF, 0xEE, 0xEB, 0x00,
+  0x02, 0x22, 0xBF, 0x22, 0x21, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00,
+  0x76, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0x00, 0x00, 0x76, 0xCB, 0xCB,
+  0xCB, 0xCB, 0xCB, 0xCB, 0x00, 0x03, 0xBE, 0xEC, 0x40, 0x03, 0xFB, 0x55,
+  0x95, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x4F,
+  0xF7, 0x00, 0x00, 0x3E, 0x7A, 0xFB, 0x10, 0x0D, 0x80, 0x05, 0xFB, 0x01,
+  0xF7, 0x00, 0x08, 0xF0, 0x0C, 0xF6, 0x00, 0x9C, 0x00, 0x1C, 0xFA, 0x7E,
+  0x40, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
+  0x1F, 0x90, 0x05, 0x51, 0x29, 0xF4, 0x00, 0x9F, 0xFF, 0xD5, 0x00, 0x00,
+  0x13, 0x20, 0x00, 0x00, 0x6C, 0x32, 0xC7, 0xAF, 0x14, 0xF7, 0x00, 0x01,
+  0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1, 0x00,
+  0x03, 0xD2, 0x3A, 0xDD, 0xB3, 0x6B, 0x00, 0x0C, 0x33, 0xFA, 0x32, 0x54,
+  0x09, 0x60, 0x4A, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x76, 0x0E, 0x70,
+  0x00, 0x00, 0x00, 0xC1, 0x85, 0x0E, 0x70, 0x00, 0x00, 0x00, 0xB2, 0x76,
+  0x0C, 0xB0, 0x00, 0x00, 0x00, 0xC1, 0x4A, 0x05, 0xF7, 0x10, 0x22, 0x01,
+  0xD0, 0x0C, 0x30, 0x5D, 0xFE, 0xD4, 0x09, 0x70, 0x03, 0xD3, 0x00, 0x11,
+  0x00, 0x6B, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A, 0xB1, 0x00, 0x00, 0x01,
+  0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xC3, 0x00, 0x44, 0x11,
+  0xBB, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x7C, 0xEF, 0xFA, 0x08, 0xC2, 0x00,
+  0xC7, 0x0B, 0xB1, 0x29, 0xF4, 0x04, 0xDF, 0xC6, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0xB0, 0x00, 0x02, 0xA0, 0x04, 0x80, 0x05, 0xE7,
+  0x07, 0xF5, 0x09, 0xF6, 0x1A, 0xE4, 0x0A, 0xD3, 0x0D, 0xC2, 0x00, 0x8E,
+  0x30, 0xBD, 0x20, 0x00, 0xAE, 0x21, 0xCD, 0x10, 0x00, 0xBA, 0x01, 0xD7,
+  0x00, 0x01, 0x40, 0x02, 0x30, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x55, 0x55, 0x55, 0xAE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7B, 0x02, 0x22, 0x21, 0x1F, 0xFF, 0xF9, 0x15,
+  0x55, 0x52, 0x00, 0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x00, 0x4D, 0x72,
+  0x00, 0x3A, 0xB1, 0x00, 0x03, 0xD2, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x0C,
+  0x30, 0xCE, 0xED, 0x91, 0x09, 0x60, 0x4A, 0x00, 0xC8, 0x01, 0xD8, 0x01,
+  0xD0, 0x76, 0x00, 0xC8, 0x01, 0xD8, 0x00, 0xC1, 0x85, 0x00, 0xCE, 0xEF,
+  0x81, 0x00, 0xB2, 0x76, 0x00, 0xC8, 0x1C, 0xA0, 0x00, 0xC1, 0x4A, 0x00,
+  0xC8, 0x02, 0xF5, 0x01, 0xD0, 0x0C, 0x30, 0xC8, 0x00, 0x8E, 0x19, 0x70,
+  0x03, 0xD3, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x3A,
+  0xB1, 0x00, 0x00, 0x01, 0x7C, 0xDD, 0xA5, 0x00, 0x00, 0x01, 0x11, 0x10,
+  0x9F, 0xFF, 0xF8, 0x24, 0x44, 0x42, 0x03, 0xCE, 0xA2, 0x01, 0xE7, 0x39,
+  0xC0, 0x4C, 0x00, 0x0F, 0x12, 0xE4, 0x06, 0xE0, 0x06, 0xEF, 0xD4, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x02, 0x22, 0x27,
+  0xF4, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x58,
+  0xF6, 0x55, 0x54, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0xAD, 0xEC, 0x30, 0x14, 0x00, 0xBB, 0x00, 0x00,
+  0x0C, 0x80, 0x00, 0x1B, 0xA0, 0x00, 0x3D, 0x60, 0x00, 0x6D, 0x30, 0x00,
+  0x4F, 0xFE, 0xEE, 0x10, 0x02, 0xCD, 0xEA, 0x10, 0x11, 0x01, 0xE6, 0x00,
+  0x00, 0x4E, 0x30, 0x08, 0xEF, 0x50, 0x00, 0x00, 0x8E, 0x02, 0x00, 0x1A,
+  0xC0, 0x7E, 0xED, 0x92, 0x00, 0x00, 0x06, 0x70, 0x06, 0xE4, 0x04, 0xE4,
+  0x03, 0xE4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x04, 0xF5, 0x00, 0x0E, 0xA0,
+  0x00, 0x07, 0xF2, 0x00, 0x2F, 0x70, 0x00, 0x0A, 0xE0, 0x00, 0x4F, 0x40,
+  0x00, 0x0C, 0xC0, 0x00, 0x7F, 0x10, 0x00, 0x1F, 0x90, 0x00, 0xAD, 0x00,
+  0x00, 0x3F, 0x60, 0x00, 0xDB, 0x00, 0x00, 0x8F, 0x30, 0x01, 0xFC, 0x00,
+  0x02, 0xEF, 0x00, 0x03, 0xFE, 0xA6, 0x8E, 0xEF, 0x70, 0x06, 0xF5, 0xCF,
+  0xD5, 0x7E, 0xA0, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3A, 0xDF, 0xFF, 0xF0, 0x6F, 0xFF, 0xF1, 0x7C,
+  0x3F, 0xFF, 0xFC, 0x09, 0x98, 0xFF, 0xFF, 0x90, 0xC6, 0x9F, 0xFF, 0xF6,
+  0x0E, 0x45, 0xFF, 0xFF, 0x32, 0xF1, 0x09, 0xFF, 0xF0, 0x5D, 0x00, 0x01,
+  0x8C, 0x08, 0xA0, 0x00, 0x09, 0x90, 0xB7, 0x00, 0x00, 0xC6, 0x0E, 0x40,
+  0x00, 0x0F, 0x32, 0xF1, 0x00, 0x03, 0xF1, 0x5D, 0x00, 0x00, 0x6D, 0x08,
+  0xA0, 0x00, 0x08, 0xA0, 0xB7, 0x00, 0x00, 0x64, 0x08, 0x30, 0x00, 0x23,
+  0x1B, 0xF2, 0xEE, 0x00, 0x00, 0x05, 0x10, 0x00, 0x98, 0x01, 0x09, 0xA1,
+  0xFF, 0xD3, 0x01, 0x10, 0x00, 0x08, 0xDF, 0x70, 0x03, 0x1F, 0x40, 0x00,
+  0x3F, 0x10, 0x00, 0x6D, 0x00, 0x00, 0x9A, 0x00, 0x00, 0xC7, 0x00, 0xAE,
+  0xFE, 0xE1, 0x00, 0x08, 0xDE, 0xB2, 0x00, 0x0B, 0xB2, 0x1A, 0xD0, 0x05,
+  0xE1, 0x00, 0x4F, 0x10, 0x9B, 0x00, 0x05, 0xF1, 0x09, 0xA0, 0x00, 0x9C,
+  0x00, 0x6E, 0x31, 0x6E, 0x40, 0x00, 0x8E, 0xEB, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0x50, 0x0A, 0x30, 0x00,
+  0x7E, 0x40, 0xAE, 0x20, 0x00, 0x9E, 0x31, 0xCD, 0x10, 0x00, 0xCC, 0x01,
+  0xEA, 0x00, 0x9E, 0x51, 0xBE, 0x42, 0xCD, 0x33, 0xDB, 0x10, 0xAA, 0x10,
+  0xD8, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x02, 0x68, 0x40, 0x00, 0x00,
+  0x01, 0x83, 0x00, 0x09, 0x9E, 0x60, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+  0x1F, 0x30, 0x00, 0x00, 0x8E, 0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x05,
+  0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x70, 0x00, 0x00, 0x00,
+  0x9A, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x0A, 0xC1,
+  0x00, 0x01, 0x85, 0xBE, 0xFE, 0xE1, 0x7E, 0x20, 0x00, 0x1A, 0xE6, 0x00,
+  0x00, 0x04, 0xF5, 0x00, 0x00, 0xA4, 0xF3, 0x00, 0x00, 0x2E, 0x80, 0x00,
+  0x0A, 0x43, 0xF0, 0x00, 0x00, 0xCB, 0x00, 0x00, 0xA5, 0x06, 0xC0, 0x00,
+  0x09, 0xD1, 0x00, 0x02, 0xFE, 0xEF, 0xFB, 0x00, 0x6E, 0x30, 0x00, 0x00,
+  0x00, 0x0C, 0x60, 0x03, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x30, 0x08,
+  0xDF, 0x70, 0x00, 0x00, 0x05, 0xF3, 0x00, 0x04, 0x3E, 0x40, 0x00, 0x00,
+  0x3E, 0x60, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x01, 0xD9, 0x00, 0x00, 0x00,
+  0x6D, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x9D,
+  0x10, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0xBE,
+  0xFE, 0xE1, 0x4F, 0x50, 0x1B, 0xDE, 0xC3, 0x00, 0x00, 0x02, 0xE7, 0x00,
+  0x00, 0x01, 0xBB, 0x00, 0x00, 0x1C, 0xA0, 0x00, 0x00, 0x00, 0xC8, 0x00,
+  0x00, 0xAC, 0x10, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x08, 0xE2, 0x00, 0x00,
+  0x03, 0xC6, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x6C, 0x30, 0x00, 0x03,
+  0xE6, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF1, 0x02, 0xCE, 0xEA, 0x10, 0x00,
+  0x00, 0x4E, 0x40, 0x00, 0x12, 0x02, 0xE6, 0x00, 0x00, 0x2E, 0x70, 0x00,
+  0x00, 0x00, 0x4E, 0x30, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x09, 0xFE, 0x40,
+  0x00, 0x09, 0xD1, 0x00, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x05, 0xF3, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xE0, 0x02, 0xE7, 0x00, 0x00, 0x00, 0x32, 0x02,
+  0xC9, 0x01, 0xCA, 0x00, 0x00, 0x2B, 0x67, 0xDE, 0xD7, 0x00, 0x9D, 0x10,
+  0x00, 0x1C, 0xE6, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x1C, 0x4F, 0x30,
+  0x00, 0x00, 0x3F, 0x60, 0x00, 0x1B, 0x43, 0xF0, 0x00, 0x00, 0x1D, 0xA0,
+  0x00, 0x0B, 0x50, 0x6C, 0x00, 0x00, 0x0A, 0xD1, 0x00, 0x03, 0xFE, 0xEF,
+  0xFB, 0x00, 0x07, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x03, 0xE5,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x30, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00,
+  0x09, 0xF2, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x01, 0xDE, 0x00, 0x00, 0x2D,
+  0xE3, 0x00, 0x02, 0xDE, 0x30, 0x00, 0x0C, 0xE3, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x00, 0x5F, 0x80, 0x00, 0x23, 0x2E, 0xF8, 0x7A, 0xF4, 0x04, 0xCE,
+  0xDB, 0x50, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E,
+  0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7, 0xBE, 0x00, 0x00, 0x00, 0x08, 0xD1,
+  0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60, 0x5F, 0x40, 0x00, 0x00, 0xAC, 0x00,
+  0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xA0, 0x00, 0x0C, 0xC2, 0x22,
+  0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xDA, 0x55, 0x55,
+  0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00, 0x05, 0xF6, 0x2E, 0x90, 0x00, 0x00,
+  0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x71, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x20, 0x00, 0x00, 0x00, 0x03,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7,
+  0xBE, 0x00, 0x00, 0x00, 0x08, 0xD1, 0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60,
+  0x5F, 0x40, 0x00, 0x00, 0xAC, 0x00, 0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00,
+  0x0F, 0xA0, 0x00, 0x0C, 0xC2, 0x22, 0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x01, 0xDA, 0x55, 0x55, 0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00,
+  0x05, 0xF6, 0x2E, 0x90, 0x00, 0x00, 0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00,
+  0x01, 0xFB, 0x00, 0x00, 0x00, 0x02, 0x77, 0x00, 0x00, 0x00, 0x00, 0x3D,
+  0x7C, 0x80, 0x00, 0x00, 0x00, 0x73, 0x01, 0x71, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E,
+  0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7, 0xBE, 0x00, 0x00, 0x00, 0x08, 0xD1,
+  0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60, 0x5F, 0x40, 0x00, 0x00, 0xAC, 0x00,
+  0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xA0, 0x00, 0x0C, 0xC2, 0x22,
+  0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xDA, 0x55, 0x55,
+  0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00, 0x05, 0xF6, 0x2E, 0x90, 0x00, 0x00,
+  0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x5D,
+  0xB1, 0x6A, 0x00, 0x00, 0x01, 0xE4, 0x8E, 0xD2, 0x00, 0x00, 0x00, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7,
+  0xBE, 0x00, 0x00, 0x00, 0x08, 0xD1, 0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60,
+  0x5F, 0x40, 0x00, 0x00, 0xAC, 0x00, 0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00,
+  0x0F, 0xA0, 0x00, 0x0C, 0xC2, 0x22, 0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x01, 0xDA, 0x55, 0x55, 0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00,
+  0x05, 0xF6, 0x2E, 0x90, 0x00, 0x00, 0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00,
+  0x01, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0x06, 0xF6, 0x00, 0x00, 0x00, 0xAA,
+  0x06, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xEB, 0x00, 0x00, 0x00, 0x01, 0xD7,
+  0xBE, 0x00, 0x00, 0x00, 0x08, 0xD1, 0x8F, 0x10, 0x00, 0x00, 0x2E, 0x60,
+  0x5F, 0x40, 0x00, 0x00, 0xAC, 0x00, 0x3F, 0x70, 0x00, 0x03, 0xF4, 0x00,
+  0x0F, 0xA0, 0x00, 0x0C, 0xC2, 0x22, 0x2D, 0xC0, 0x00, 0x6F, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x01, 0xDA, 0x55, 0x55, 0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00,
+  0x05, 0xF6, 0x2E, 0x90, 0x00, 0x00, 0x03, 0xF8, 0xAF, 0x20, 0x00, 0x00,
+  0x01, 0xFB, 0x00, 0x00, 0x00, 0x1A, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x9A,
+  0x3B, 0x80, 0x00, 0x00, 0x00, 0xD3, 0x04, 0xC0, 0x00, 0x00, 0x00, 0x98,
+  0x19, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x8E,
+  0xEB, 0x00, 0x00, 0x00, 0x02, 0xE7, 0xBE, 0x00, 0x00, 0x00, 0x0A, 0xD1,
+  0x8F, 0x20, 0x00, 0x00, 0x3F, 0x60, 0x5F, 0x40, 0x00, 0x00, 0xBC, 0x00,
+  0x3F, 0x70, 0x00, 0x05, 0xF4, 0x00, 0x0F, 0xA0, 0x00, 0x0D, 0xC2, 0x22,
+  0x2D, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF1, 0x01, 0xEA, 0x55, 0x55,
+  0x59, 0xF3, 0x08, 0xF2, 0x00, 0x00, 0x05, 0xF6, 0x2F, 0x90, 0x00, 0x00,
+  0x03, 0xF9, 0xAF, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xCD, 0x6E, 0xD6,
+  0x66, 0x66, 0x62, 0x00, 0x00, 0x00, 0x7F, 0x42, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0xA0, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xE1, 0x08, 0xF5, 0x22, 0x22, 0x20, 0x00, 0x00, 0x04, 0xF6, 0x00,
+  0xBF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0xDB, 0x00, 0x0E, 0xD5, 0x55,
+  0x55, 0x50, 0x00, 0x00, 0x7F, 0x42, 0x23, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD5,
+  0x55, 0x5A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0xAF,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x0D, 0xF7, 0x77, 0x77,
+  0x73, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x17, 0xCE, 0xFD, 0xA3, 0x00, 0x00, 0x4E, 0xFB, 0x87, 0xAE,
+  0xF2, 0x00, 0x3E, 0xD3, 0x00, 0x00, 0x1A, 0x00, 0x1D, 0xE2, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x04, 0x50, 0x00,
+  0x2D, 0xFB, 0x87, 0x9D, 0xF4, 0x00, 0x00, 0x18, 0xDF, 0xFD, 0xA5, 0x00,
+  0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x32, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x71, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0xFA, 0x77, 0x77, 0x76,
+  0x00, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0xDC, 0x22, 0x22, 0x22, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xA0, 0x04, 0xF8,
+  0x55, 0x55, 0x53, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00,
+  0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00,
+  0x00, 0x04, 0xFB, 0x77, 0x77, 0x77, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0xFA, 0x77, 0x77, 0x76, 0x00, 0x8F,
+  0x30, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x22,
+  0x22, 0x22, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xA0, 0x04, 0xF8, 0x55, 0x55,
+  0x53, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x04,
+  0xFB, 0x77, 0x77, 0x77, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x40, 0x00, 0x00, 0x00, 0x9C, 0x6E, 0x20, 0x00, 0x00,
+  0x37, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x05, 0xFA, 0x77, 0x77, 0x76, 0x00, 0x8F, 0x30, 0x00,
+  0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x22, 0x22, 0x22,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xA0, 0x04, 0xF8, 0x55, 0x55, 0x53, 0x00,
+  0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xDD,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x77,
+  0x77, 0x77, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0xDD, 0x00, 0x00, 0x05, 0xC4, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xA7, 0x77, 0x77,
+  0x60, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xC2, 0x22, 0x22, 0x20, 0x01, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x4F,
+  0x85, 0x55, 0x55, 0x30, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x10,
+  0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xB7, 0x77, 0x77, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x00, 0x00, 0x47, 0x00, 0x01, 0xC8, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00,
+  0x2F, 0x90, 0x05, 0xF6, 0x00, 0x8F, 0x40, 0x0A, 0xF1, 0x00, 0xDD, 0x00,
+  0x1F, 0xA0, 0x04, 0xF7, 0x00, 0x7F, 0x40, 0x0A, 0xF1, 0x00, 0xDD, 0x00,
+  0x1F, 0xA0, 0x04, 0xF8, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x28, 0x30,
+  0x00, 0x3E, 0x70, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0x90, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x0A, 0xF1, 0x00,
+  0x00, 0xDD, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x7F,
+  0x40, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x1F, 0xA0, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x06, 0x84, 0x00,
+  0x0A, 0xB7, 0xE1, 0x04, 0x60, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0x90, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x0A, 0xF1, 0x00,
+  0x00, 0xDD, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x7F,
+  0x40, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x1F, 0xA0, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x04, 0xF7, 0x0E, 0xC0,
+  0x5C, 0x31, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x5F,
+  0x60, 0x00, 0x08, 0xF4, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x0D, 0xD0, 0x00,
+  0x01, 0xFA, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xAF,
+  0x10, 0x00, 0x0D, 0xD0, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x07, 0xF5, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0xD9, 0x30, 0x00, 0x03,
+  0xFB, 0x77, 0x7A, 0xEF, 0x70, 0x00, 0x6F, 0x50, 0x00, 0x01, 0xDF, 0x30,
+  0x09, 0xF2, 0x00, 0x00, 0x04, 0xF9, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
+  0xB0, 0x0E, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0xDF, 0xFF, 0xFF, 0x80, 0x00,
+  0x2F, 0xA3, 0x7F, 0x83, 0x31, 0x00, 0x05, 0xF7, 0x08, 0xF3, 0x00, 0x00,
+  0x00, 0xBF, 0x20, 0xBF, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x0E, 0xC0, 0x00,
+  0x00, 0x7F, 0xD1, 0x02, 0xFC, 0x77, 0x89, 0xEF, 0xB1, 0x00, 0x5F, 0xFF,
+  0xFE, 0xC9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBC, 0x42, 0xD1, 0x00,
+  0x00, 0x00, 0xB8, 0x5E, 0xE6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00,
+  0x1F, 0x90, 0x05, 0xFF, 0xC0, 0x00, 0x04, 0xF6, 0x00, 0x8F, 0xAF, 0x20,
+  0x00, 0x7F, 0x30, 0x0A, 0xF2, 0xF6, 0x00, 0x0A, 0xF1, 0x00, 0xDC, 0x0C,
+  0xB0, 0x00, 0xDD, 0x00, 0x1F, 0x90, 0x8F, 0x10, 0x1F, 0xA0, 0x04, 0xF6,
+  0x03, 0xF6, 0x04, 0xF7, 0x00, 0x7F, 0x30, 0x0D, 0xB0, 0x7F, 0x40, 0x0A,
+  0xF1, 0x00, 0x8F, 0x19, 0xF1, 0x00, 0xDD, 0x00, 0x04, 0xF5, 0xCD, 0x00,
+  0x1F, 0xA0, 0x00, 0x0E, 0xAF, 0xA0, 0x04, 0xF7, 0x00, 0x00, 0x9F, 0xF7,
+  0x00, 0x7F, 0x40, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C,
+  0xFC, 0x10, 0x00, 0x3E, 0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20,
+  0x00, 0x00, 0x0E, 0xE0, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D,
+  0xF1, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D,
+  0xF0, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00,
+  0x00, 0x9F, 0x50, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6,
+  0x00, 0x00, 0x4E, 0xE2, 0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00,
+  0x00, 0x18, 0xDF, 0xEC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C, 0xFC,
+  0x10, 0x00, 0x3E, 0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00,
+  0x00, 0x0E, 0xE0, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1,
+  0x00, 0x00, 0x00, 0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF0,
+  0x4F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00,
+  0x9F, 0x50, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00,
+  0x00, 0x4E, 0xE2, 0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00, 0x00,
+  0x18, 0xDF, 0xEC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x4E, 0x49, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x73,
+  0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xCE, 0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C, 0xFC, 0x10,
+  0x00, 0x3E, 0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00, 0x00,
+  0x0E, 0xE0, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1, 0x00,
+  0x00, 0x00, 0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x4F,
+  0x90, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F,
+  0x50, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00, 0x00,
+  0x4E, 0xE2, 0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00, 0x00, 0x18,
+  0xDF, 0xEC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xB2, 0x5A, 0x00,
+  0x00, 0x00, 0x01, 0xE5, 0x7E, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0xCE, 0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C, 0xFC, 0x10, 0x00,
+  0x3E, 0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00, 0x00, 0x0E,
+  0xE0, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x4F, 0x90,
+  0x00, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50,
+  0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x4E,
+  0xE2, 0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00, 0x00, 0x18, 0xDF,
+  0xEC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x13, 0xC5, 0x00, 0x00,
+  0x00, 0x00, 0xCE, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE,
+  0xFD, 0x81, 0x00, 0x00, 0x04, 0xDF, 0xB8, 0x8C, 0xFC, 0x10, 0x00, 0x3E,
+  0xD3, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xDE, 0x20, 0x00, 0x00, 0x0E, 0xE0,
+  0x07, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x0D, 0xF1, 0x00, 0x00, 0x00,
+  0x0B, 0xF2, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x4F, 0x90, 0x00,
+  0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x1F,
+  0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x4E, 0xE2,
+  0x00, 0x02, 0xDF, 0xA7, 0x8B, 0xFD, 0x20, 0x00, 0x00, 0x18, 0xDF, 0xEC,
+  0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x05, 0xF8, 0x00, 0x00,
+  0x1B, 0xF2, 0x08, 0xF8, 0x00, 0x1B, 0xF5, 0x00, 0x08, 0xF8, 0x0B, 0xF5,
+  0x00, 0x00, 0x08, 0xFD, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00,
+  0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00, 0x0A, 0xF5, 0x09, 0xF7, 0x00, 0x0A,
+  0xF6, 0x00, 0x09, 0xF7, 0x05, 0xF6, 0x00, 0x00, 0x09, 0xF2, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x01, 0x7C, 0xEF, 0xC7, 0x06, 0xE1, 0x00, 0x00, 0x4E, 0xFB,
+  0x88, 0xBF, 0xDE, 0x40, 0x00, 0x04, 0xED, 0x30, 0x00, 0x0C, 0xF9, 0x00,
+  0x00, 0x1D, 0xE2, 0x00, 0x00, 0xA9, 0xDE, 0x00, 0x00, 0x7F, 0x70, 0x00,
+  0x1B, 0x90, 0xBF, 0x10, 0x00, 0xDE, 0x10, 0x01, 0xC8, 0x00, 0xBF, 0x20,
+  0x02, 0xFB, 0x00, 0x2D, 0x70, 0x00, 0xDF, 0x00, 0x04, 0xF8, 0x03, 0xE6,
+  0x00, 0x03, 0xFB, 0x00, 0x03, 0xF9, 0x4E, 0x50, 0x00, 0x09, 0xF6, 0x00,
+  0x01, 0xFE, 0xE5, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0xCF, 0x80, 0x00,
+  0x04, 0xEE, 0x20, 0x00, 0x08, 0xED, 0xFA, 0x78, 0xBF, 0xD2, 0x00, 0x00,
+  0x5D, 0x21, 0x8D, 0xFE, 0xC7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x04, 0xF7, 0x08, 0xF3,
+  0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x0A, 0xF1, 0x0E, 0xC0,
+  0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90, 0x00, 0x00, 0x1F, 0xA0, 0x5F, 0x60,
+  0x00, 0x00, 0x4F, 0x70, 0x8F, 0x30, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00,
+  0x00, 0x00, 0xAF, 0x20, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0xED, 0x00,
+  0x00, 0x04, 0xF9, 0x00, 0xCF, 0x20, 0x00, 0x1C, 0xF2, 0x00, 0x5F, 0xE8,
+  0x79, 0xEF, 0x50, 0x00, 0x04, 0xBE, 0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF6,
+  0x00, 0x00, 0x04, 0xF7, 0x08, 0xF3, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0,
+  0x00, 0x00, 0x0A, 0xF1, 0x0E, 0xC0, 0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90,
+  0x00, 0x00, 0x1F, 0xA0, 0x5F, 0x60, 0x00, 0x00, 0x4F, 0x70, 0x8F, 0x30,
+  0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x00, 0xAF, 0x20, 0xDD, 0x00,
+  0x00, 0x00, 0xDD, 0x00, 0xED, 0x00, 0x00, 0x04, 0xF9, 0x00, 0xCF, 0x20,
+  0x00, 0x1C, 0xF2, 0x00, 0x5F, 0xE8, 0x79, 0xEF, 0x50, 0x00, 0x04, 0xBE,
+  0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x70, 0x00, 0x00, 0x00,
+  0x2E, 0x75, 0xE1, 0x00, 0x00, 0x00, 0x55, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x04, 0xF7, 0x08, 0xF3,
+  0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x0A, 0xF1, 0x0E, 0xC0,
+  0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90, 0x00, 0x00, 0x1F, 0xA0, 0x5F, 0x60,
+  0x00, 0x00, 0x4F, 0x70, 0x8F, 0x30, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00,
+  0x00, 0x00, 0xAF, 0x20, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0xED, 0x00,
+  0x00, 0x04, 0xF9, 0x00, 0xCF, 0x20, 0x00, 0x1C, 0xF2, 0x00, 0x5F, 0xE8,
+  0x79, 0xEF, 0x50, 0x00, 0x04, 0xBE, 0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00,
+  0x5C, 0x41, 0xB8, 0x00, 0x00, 0x00, 0x9F, 0x23, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF6,
+  0x00, 0x00, 0x04, 0xF7, 0x08, 0xF3, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0,
+  0x00, 0x00, 0x0A, 0xF1, 0x0E, 0xC0, 0x00, 0x00, 0x0D, 0xD0, 0x2F, 0x90,
+  0x00, 0x00, 0x1F, 0xA0, 0x5F, 0x60, 0x00, 0x00, 0x4F, 0x70, 0x8F, 0x30,
+  0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x00, 0xAF, 0x20, 0xDD, 0x00,
+  0x00, 0x00, 0xDD, 0x00, 0xED, 0x00, 0x00, 0x04, 0xF9, 0x00, 0xCF, 0x20,
+  0x00, 0x1C, 0xF2, 0x00, 0x5F, 0xE8, 0x79, 0xEF, 0x50, 0x00, 0x04, 0xBE,
+  0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x00,
+  0x6E, 0x40, 0x00, 0x00, 0x00, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x7F, 0x73, 0xFA, 0x00, 0x00, 0x5F,
+  0x90, 0x0B, 0xF2, 0x00, 0x3F, 0xB0, 0x00, 0x3F, 0x80, 0x2E, 0xD1, 0x00,
+  0x00, 0xBE, 0x2D, 0xE2, 0x00, 0x00, 0x04, 0xFE, 0xF3, 0x00, 0x00, 0x00,
+  0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xB0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x60,
+  0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x22, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xA1, 0x00, 0x0A, 0xF5, 0x55, 0xBF, 0xB0,
+  0x00, 0xDC, 0x00, 0x00, 0xDF, 0x10, 0x1F, 0xA0, 0x00, 0x0A, 0xF2, 0x04,
+  0xF7, 0x00, 0x00, 0xCF, 0x10, 0x7F, 0x50, 0x00, 0x3F, 0xC0, 0x0A, 0xF4,
+  0x23, 0x6E, 0xF4, 0x00, 0xDF, 0xFF, 0xFF, 0xD4, 0x00, 0x1F, 0xC5, 0x54,
+  0x20, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xA2, 0x00, 0x00, 0x3F, 0xC6, 0x6C,
+  0xD1, 0x00, 0x0C, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF6, 0x00, 0x4A, 0xF5,
+  0x00, 0x6F, 0x20, 0x8E, 0x72, 0x00, 0x09, 0xF0, 0x3F, 0x60, 0x00, 0x00,
+  0xCC, 0x06, 0xF4, 0x00, 0x00, 0x0E, 0x90, 0x3F, 0xD2, 0x00, 0x02, 0xF6,
+  0x00, 0x5F, 0xE3, 0x00, 0x5F, 0x40, 0x00, 0x4F, 0xD0, 0x08, 0xF1, 0x00,
+  0x00, 0xAF, 0x10, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x0D, 0xA4, 0x96, 0x6B,
+  0xF6, 0x01, 0xF8, 0x6E, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xEC,
+  0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4, 0x00, 0x10, 0x00, 0x01, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B, 0xDF, 0xFF, 0xF7, 0x08, 0xF9, 0x54,
+  0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A, 0xF1, 0x4F, 0x70, 0x00, 0x6F, 0xD0,
+  0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04, 0xCF, 0xD8, 0x2F, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0A, 0xC2, 0x00, 0x00, 0x00, 0xAB,
+  0x10, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xCE, 0xEC, 0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4, 0x00, 0x10, 0x00,
+  0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B, 0xDF, 0xFF, 0xF7,
+  0x08, 0xF9, 0x54, 0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A, 0xF1, 0x4F, 0x70,
+  0x00, 0x6F, 0xD0, 0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04, 0xCF, 0xD8, 0x2F,
+  0x70, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x06, 0xEE, 0x40, 0x00,
+  0x00, 0x5D, 0x28, 0xC0, 0x00, 0x00, 0x72, 0x01, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xCE, 0xEC, 0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4,
+  0x00, 0x10, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B,
+  0xDF, 0xFF, 0xF7, 0x08, 0xF9, 0x54, 0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A,
+  0xF1, 0x4F, 0x70, 0x00, 0x6F, 0xD0, 0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04,
+  0xCF, 0xD8, 0x2F, 0x70, 0x00, 0x00, 0x5E, 0xD3, 0x6B, 0x00, 0x01, 0xE4,
+  0x9F, 0xE3, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0xCE, 0xEC, 0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4, 0x00, 0x10,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B, 0xDF, 0xFF,
+  0xF7, 0x08, 0xF9, 0x54, 0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A, 0xF1, 0x4F,
+  0x70, 0x00, 0x6F, 0xD0, 0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04, 0xCF, 0xD8,
+  0x2F, 0x70, 0x00, 0x00, 0xAF, 0x24, 0xF7, 0x00, 0x00, 0x9B, 0x05, 0xC3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xCE, 0xEC, 0x50, 0x00, 0x6C, 0x86, 0x7D, 0xF4, 0x00, 0x10, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4B, 0xDF, 0xFF, 0xF7, 0x08,
+  0xF9, 0x54, 0x37, 0xF4, 0x2F, 0x90, 0x00, 0x0A, 0xF1, 0x4F, 0x70, 0x00,
+  0x6F, 0xD0, 0x1E, 0xE7, 0x6A, 0xCF, 0xA0, 0x04, 0xCF, 0xD8, 0x2F, 0x70,
+  0x00, 0x00, 0x06, 0xDC, 0x40, 0x00, 0x00, 0x3E, 0x45, 0xE1, 0x00, 0x00,
+  0x6A, 0x00, 0xD3, 0x00, 0x00, 0x4D, 0x12, 0xE1, 0x00, 0x00, 0x09, 0xFE,
+  0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0xCE, 0xEC, 0x50, 0x00,
+  0x6C, 0x86, 0x7D, 0xF4, 0x00, 0x10, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0xE9, 0x00, 0x4B, 0xDF, 0xFF, 0xF7, 0x08, 0xF9, 0x54, 0x37, 0xF4,
+  0x2F, 0x90, 0x00, 0x0A, 0xF1, 0x4F, 0x70, 0x00, 0x6F, 0xD0, 0x1E, 0xE7,
+  0x6A, 0xCF, 0xA0, 0x04, 0xCF, 0xD8, 0x2F, 0x70, 0x00, 0x18, 0xCE, 0xFC,
+  0x60, 0x4B, 0xEE, 0xB3, 0x00, 0x06, 0xC8, 0x67, 0xDF, 0xAF, 0xB6, 0x7D,
+  0xF3, 0x00, 0x10, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x1E, 0x90, 0x00, 0x00,
+  0x00, 0x0E, 0xB0, 0x00, 0x00, 0xCB, 0x00, 0x4B, 0xDF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xA0, 0x8F, 0x95, 0x43, 0x7F, 0x53, 0x33, 0x33, 0x32, 0x2F,
+  0x90, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x06, 0xFF,
+  0x80, 0x00, 0x00, 0x10, 0x1E, 0xE7, 0x6A, 0xF5, 0xCF, 0xA6, 0x68, 0xD6,
+  0x00, 0x4C, 0xEE, 0xA3, 0x01, 0x9D, 0xFE, 0xC8, 0x20, 0x00, 0x02, 0x8D,
+  0xFE, 0xB3, 0x00, 0x3E, 0xE8, 0x67, 0xD4, 0x01, 0xED, 0x20, 0x00, 0x00,
+  0x09, 0xF3, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x2F, 0x80,
+  0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+  0x00, 0x09, 0xFB, 0x76, 0x9C, 0x00, 0x00, 0x6C, 0xFF, 0xC6, 0x00, 0x00,
+  0x00, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x42, 0xB9,
+  0x00, 0x00, 0x01, 0xEF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10, 0x00,
+  0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFD,
+  0x60, 0x00, 0x4E, 0xD7, 0x6A, 0xF7, 0x01, 0xEB, 0x00, 0x00, 0xBD, 0x09,
+  0xE2, 0x00, 0x00, 0x8F, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x83, 0x33,
+  0x33, 0x33, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x10,
+  0x08, 0xFC, 0x76, 0x8B, 0xB0, 0x00, 0x6C, 0xEE, 0xD9, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x09, 0xD2, 0x00, 0x00, 0x00, 0x9C,
+  0x10, 0x00, 0x00, 0x03, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x9D, 0xFD, 0x60, 0x00, 0x4E, 0xD7, 0x6A, 0xF7, 0x01, 0xEB, 0x00,
+  0x00, 0xBD, 0x09, 0xE2, 0x00, 0x00, 0x8F, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x2F, 0x83, 0x33, 0x33, 0x33, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x00, 0x10, 0x08, 0xFC, 0x76, 0x8B, 0xB0, 0x00, 0x6C, 0xEE, 0xD9,
+  0x40, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x05, 0xEE, 0x60, 0x00,
+  0x00, 0x4D, 0x36, 0xD0, 0x00, 0x00, 0x72, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x9D, 0xFD, 0x60, 0x00, 0x4E, 0xD7, 0x6A, 0xF7,
+  0x01, 0xEB, 0x00, 0x00, 0xBD, 0x09, 0xE2, 0x00, 0x00, 0x8F, 0x0E, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x2F, 0x83, 0x33, 0x33, 0x33, 0x2F, 0x70, 0x00, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x00, 0x10, 0x08, 0xFC, 0x76, 0x8B, 0xB0, 0x00,
+  0x6C, 0xEE, 0xD9, 0x40, 0x00, 0x00, 0x8F, 0x33, 0xF8, 0x00, 0x00, 0x8B,
+  0x04, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x9D, 0xFD, 0x60, 0x00, 0x4E, 0xD7, 0x6A, 0xF7, 0x01, 0xEB,
+  0x00, 0x00, 0xBD, 0x09, 0xE2, 0x00, 0x00, 0x8F, 0x0E, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x2F, 0x83, 0x33, 0x33, 0x33, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0x10, 0x08, 0xFC, 0x76, 0x8B, 0xB0, 0x00, 0x6C, 0xEE,
+  0xD9, 0x40, 0x03, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x9D, 0x00, 0x01, 0xB5,
+  0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0xCC, 0x00, 0x0E, 0x90, 0x02, 0xF6,
+  0x00, 0x5F, 0x40, 0x08, 0xF1, 0x00, 0xBD, 0x00, 0x0E, 0xA0, 0x01, 0xF7,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x09, 0xD2, 0x00,
+  0x07, 0xD2, 0x00, 0x05, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0,
+  0x00, 0x00, 0xCC, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x02, 0xF6, 0x00, 0x00,
+  0x5F, 0x40, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0E, 0xA0,
+  0x00, 0x01, 0xF7, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x06, 0x60,
+  0x00, 0x05, 0xFF, 0x20, 0x03, 0xE4, 0xB8, 0x01, 0xD5, 0x04, 0xE1, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x0E, 0x90,
+  0x00, 0x02, 0xF6, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x08, 0xF1, 0x00, 0x00,
+  0xBD, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x0B, 0xF1, 0x6F, 0x60, 0xAA, 0x06, 0xC2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,
+  0xE9, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x8F, 0x10,
+  0x00, 0x0B, 0xD0, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x38, 0x20, 0x00, 0x00, 0x9F,
+  0xDB, 0x61, 0x00, 0x19, 0xDB, 0xDE, 0x10, 0x00, 0x00, 0x51, 0x03, 0xFA,
+  0x00, 0x00, 0x03, 0xAE, 0xFF, 0xF3, 0x00, 0x04, 0xFC, 0x65, 0x8F, 0x90,
+  0x02, 0xEA, 0x00, 0x00, 0xCC, 0x00, 0x9E, 0x10, 0x00, 0x0A, 0xE0, 0x0E,
+  0xA0, 0x00, 0x00, 0xBD, 0x02, 0xF7, 0x00, 0x00, 0x0E, 0xA0, 0x3F, 0x70,
+  0x00, 0x05, 0xF5, 0x01, 0xFB, 0x00, 0x02, 0xDC, 0x00, 0x08, 0xFA, 0x68,
+  0xED, 0x20, 0x00, 0x07, 0xDF, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x2C, 0xE6,
+  0x2E, 0x10, 0x00, 0x0A, 0x85, 0xEF, 0x60, 0x00, 0x00, 0x20, 0x01, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x29, 0xEE, 0xB2, 0x00,
+  0x0C, 0xED, 0x63, 0x5E, 0xB0, 0x00, 0xFE, 0x30, 0x00, 0xAE, 0x00, 0x3F,
+  0x90, 0x00, 0x0A, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xDB, 0x00, 0x8F, 0x10,
+  0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x00, 0x04, 0xF5, 0x00, 0xEA, 0x00, 0x00,
+  0x6F, 0x20, 0x1F, 0x70, 0x00, 0x09, 0xE0, 0x04, 0xF4, 0x00, 0x00, 0xCC,
+  0x00, 0x00, 0x00, 0x48, 0x10, 0x00, 0x00, 0x00, 0x1D, 0x90, 0x00, 0x00,
+  0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xAE, 0xFC, 0x50, 0x00, 0x5F, 0xC7, 0x6C, 0xF5,
+  0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A, 0xF2, 0x00, 0x00, 0xBE, 0x0E, 0xA0,
+  0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0xDB, 0x2F, 0x80, 0x00, 0x04,
+  0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1, 0x07, 0xFA, 0x67, 0xDE, 0x30, 0x00,
+  0x7D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x08, 0xD2, 0x00, 0x00, 0x00, 0x8C, 0x10, 0x00, 0x00, 0x02, 0x71, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFC, 0x50, 0x00, 0x5F,
+  0xC7, 0x6C, 0xF5, 0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A, 0xF2, 0x00, 0x00,
+  0xBE, 0x0E, 0xA0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0xDB, 0x2F,
+  0x80, 0x00, 0x04, 0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1, 0x07, 0xFA, 0x67,
+  0xDE, 0x30, 0x00, 0x7D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x04, 0xEE, 0x60, 0x00, 0x00, 0x3D, 0x36, 0xD0, 0x00, 0x00,
+  0x63, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFC,
+  0x50, 0x00, 0x5F, 0xC7, 0x6C, 0xF5, 0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A,
+  0xF2, 0x00, 0x00, 0xBE, 0x0E, 0xA0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00,
+  0x00, 0xDB, 0x2F, 0x80, 0x00, 0x04, 0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1,
+  0x07, 0xFA, 0x67, 0xDE, 0x30, 0x00, 0x7D, 0xFD, 0x91, 0x00, 0x00, 0x00,
+  0x4D, 0xD4, 0x4D, 0x00, 0x00, 0xD6, 0x7F, 0xE4, 0x00, 0x00, 0x20, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFC, 0x50, 0x00,
+  0x5F, 0xC7, 0x6C, 0xF5, 0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A, 0xF2, 0x00,
+  0x00, 0xBE, 0x0E, 0xA0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0xDB,
+  0x2F, 0x80, 0x00, 0x04, 0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1, 0x07, 0xFA,
+  0x67, 0xDE, 0x30, 0x00, 0x7D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x8F, 0x32,
+  0xF9, 0x00, 0x00, 0x8B, 0x14, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFC, 0x50, 0x00, 0x5F, 0xC7,
+  0x6C, 0xF5, 0x02, 0xFB, 0x00, 0x01, 0xEC, 0x0A, 0xF2, 0x00, 0x00, 0xBE,
+  0x0E, 0xA0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0xDB, 0x2F, 0x80,
+  0x00, 0x04, 0xF6, 0x0E, 0xB0, 0x00, 0x1D, 0xD1, 0x07, 0xFA, 0x67, 0xDE,
+  0x30, 0x00, 0x7D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00,
+  0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x3A, 0xEE, 0xC5, 0xBA,
+  0x00, 0x05, 0xFC, 0x76, 0xCF, 0xB0, 0x00, 0x2F, 0xB0, 0x01, 0xBE, 0xB0,
+  0x00, 0xAE, 0x10, 0x1C, 0x7A, 0xE0, 0x00, 0xEA, 0x01, 0xC8, 0x0B, 0xE0,
+  0x02, 0xF8, 0x1C, 0x80, 0x0E, 0xB0, 0x02, 0xF8, 0xC8, 0x00, 0x4F, 0x60,
+  0x00, 0xEF, 0x80, 0x01, 0xDD, 0x10, 0x01, 0xDF, 0xA6, 0x7E, 0xE3, 0x00,
+  0x1C, 0x86, 0xDF, 0xD9, 0x20, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x71, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0x30, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0xC0, 0x00, 0x05, 0xF4, 0x0E, 0x90, 0x00, 0x08, 0xF1, 0x3F,
+  0x60, 0x00, 0x0A, 0xE0, 0x6F, 0x30, 0x00, 0x0D, 0xB0, 0x8F, 0x10, 0x00,
+  0x1F, 0x80, 0xBC, 0x00, 0x00, 0x5F, 0x50, 0xEA, 0x00, 0x00, 0xAF, 0x20,
+  0xEB, 0x00, 0x05, 0xFF, 0x00, 0xBF, 0x97, 0xAD, 0xDC, 0x00, 0x2B, 0xED,
+  0x81, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x9D,
+  0x20, 0x00, 0x00, 0x09, 0xB1, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x05, 0xF4, 0x0E, 0x90, 0x00,
+  0x08, 0xF1, 0x3F, 0x60, 0x00, 0x0A, 0xE0, 0x6F, 0x30, 0x00, 0x0D, 0xB0,
+  0x8F, 0x10, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x5F, 0x50, 0xEA, 0x00,
+  0x00, 0xAF, 0x20, 0xEB, 0x00, 0x05, 0xFF, 0x00, 0xBF, 0x97, 0xAD, 0xDC,
+  0x00, 0x2B, 0xED, 0x81, 0xF9, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
+  0x00, 0x3E, 0xF3, 0x00, 0x00, 0x02, 0xD6, 0x9A, 0x00, 0x00, 0x0A, 0x50,
+  0x2C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x05, 0xF4,
+  0x0E, 0x90, 0x00, 0x08, 0xF1, 0x3F, 0x60, 0x00, 0x0A, 0xE0, 0x6F, 0x30,
+  0x00, 0x0D, 0xB0, 0x8F, 0x10, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x5F,
+  0x50, 0xEA, 0x00, 0x00, 0xAF, 0x20, 0xEB, 0x00, 0x05, 0xFF, 0x00, 0xBF,
+  0x97, 0xAD, 0xDC, 0x00, 0x2B, 0xED, 0x81, 0xF9, 0x00, 0x00, 0x09, 0xF2,
+  0x4F, 0x80, 0x00, 0x09, 0xB0, 0x5C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x05, 0xF4, 0x0E, 0x90,
+  0x00, 0x08, 0xF1, 0x3F, 0x60, 0x00, 0x0A, 0xE0, 0x6F, 0x30, 0x00, 0x0D,
+  0xB0, 0x8F, 0x10, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x5F, 0x50, 0xEA,
+  0x00, 0x00, 0xAF, 0x20, 0xEB, 0x00, 0x05, 0xFF, 0x00, 0xBF, 0x97, 0xAD,
+  0xDC, 0x00, 0x2B, 0xED, 0x81, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x05,
+  0xF5, 0x00, 0x6F, 0x40, 0x00, 0x0D, 0xC0, 0x00, 0x3F, 0x70, 0x00, 0x7F,
+  0x30, 0x00, 0x0E, 0xA0, 0x01, 0xEA, 0x00, 0x00, 0x0B, 0xD0, 0x09, 0xF2,
+  0x00, 0x00, 0x08, 0xF1, 0x2F, 0x80, 0x00, 0x00, 0x05, 0xF4, 0xBE, 0x10,
+  0x00, 0x00, 0x01, 0xFB, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF2, 0x00, 0x00, 0x00, 0x15, 0x8F, 0x70, 0x00, 0x00,
+  0x00, 0x5F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x00,
+  0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x29, 0xEE, 0xB2, 0x00, 0x0C,
+  0xED, 0x96, 0x9F, 0xD0, 0x00, 0xEF, 0x50, 0x00, 0x8F, 0x30, 0x2F, 0xA0,
+  0x00, 0x05, 0xF5, 0x05, 0xF5, 0x00, 0x00, 0x5F, 0x40, 0x8F, 0x20, 0x00,
+  0x08, 0xF2, 0x0A, 0xF1, 0x00, 0x01, 0xEC, 0x00, 0xDF, 0x50, 0x00, 0x8F,
+  0x40, 0x1F, 0xCE, 0x76, 0xBF, 0x70, 0x03, 0xF5, 0x7D, 0xFC, 0x50, 0x00,
+  0x6F, 0x20, 0x00, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xF1, 0x5F, 0x60, 0x00, 0x00, 0x0A, 0xA0, 0x6C, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0x10, 0x00, 0x05, 0xF5, 0x00, 0x6F, 0x40, 0x00, 0x0D, 0xC0, 0x00, 0x3F,
+  0x70, 0x00, 0x7F, 0x30, 0x00, 0x0E, 0xA0, 0x01, 0xEA, 0x00, 0x00, 0x0B,
+  0xD0, 0x09, 0xF2, 0x00, 0x00, 0x08, 0xF1, 0x2F, 0x80, 0x00, 0x00, 0x05,
+  0xF4, 0xBE, 0x10, 0x00, 0x00, 0x01, 0xFB, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x01,
+  0xEB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, 0x00, 0x00, 0x15, 0x8F,
+  0x70, 0x00, 0x00, 0x00, 0x5F, 0xE8, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique9pt8bAa4Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   5,  13,   7,    1,  -13 },   // 0x21 '!'
+  {    33,   6,   5,   8,    1,  -13 },   // 0x22 '"'
+  {    48,  13,  13,  15,    1,  -13 },   // 0x23 '#'
+  {   133,  10,  17,  11,    0,  -14 },   // 0x24 '$'
+  {   218,  15,  13,  17,    1,  -13 },   // 0x25 '%'
+  {   316,  13,  13,  14,    0,  -13 },   // 0x26 '&'
+  {   401,   3,   5,   5,    1,  -13 },   // 0x27 '''
+  {   409,   7,  16,   7,    1,  -14 },   // 0x28 '('
+  {   465,   7,  16,   7,   -1,  -14 },   // 0x29 ')'
+  {   521,   9,   9,   9,    0,  -13 },   // 0x2A '*'
+  {   562,  12,  12,  15,    1,  -12 },   // 0x2B '+'
+  {   634,   4,   5,   6,    0,   -3 },   // 0x2C ','
+  {   644,   6,   3,   6,    0,   -6 },   // 0x2D '-'
+  {   653,   3,   3,   6,    1,   -3 },   // 0x2E '.'
+  {   658,  10,  15,   6,   -2,  -13 },   // 0x2F '/'
+  {   733,  11,  13,  11,    0,  -13 },   // 0x30 '0'
+  {   805,   9,  13,  11,    0,  -13 },   // 0x31 '1'
+  {   864,  11,  13,  11,    0,  -13 },   // 0x32 '2'
+  {   936,  10,  13,  11,    0,  -13 },   // 0x33 '3'
+  {  1001,  10,  13,  11,    0,  -13 },   // 0x34 '4'
+  {  1066,  11,  13,  11,    0,  -13 },   // 0x35 '5'
+  {  1138,  10,  13,  11,    1,  -13 },   // 0x36 '6'
+  {  1203,  10,  13,  11,    1,  -13 },   // 0x37 '7'
+  {  1268,  11,  13,  11,    0,  -13 },   // 0x38 '8'
+  {  1340,  11,  13,  11,    0,  -13 },   // 0x39 '9'
+  {  1412,   4,  10,   6,    1,  -10 },   // 0x3A ':'
+  {  1432,   5,  12,   6,    0,  -10 },   // 0x3B ';'
+  {  1462,  12,  11,  15,    1,  -11 },   // 0x3C '<'
+  {  1528,  12,   7,  15,    1,   -9 },   // 0x3D '='
+  {  1570,  12,  10,  15,    1,  -11 },   // 0x3E '>'
+  {  1630,   7,  13,   9,    2,  -13 },   // 0x3F '?'
+  {  1676,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {  1804,  12,  13,  12,   -1,  -13 },   // 0x41 'A'
+  {  1882,  11,  13,  12,    0,  -13 },   // 0x42 'B'
+  {  1954,  13,  13,  12,    0,  -13 },   // 0x43 'C'
+  {  2039,  13,  13,  14,    0,  -13 },   // 0x44 'D'
+  {  2124,  11,  13,  11,    0,  -13 },   // 0x45 'E'
+  {  2196,  11,  13,  10,    0,  -13 },   // 0x46 'F'
+  {  2268,  13,  13,  14,    0,  -13 },   // 0x47 'G'
+  {  2353,  13,  13,  13,    0,  -13 },   // 0x48 'H'
+  {  2438,   5,  13,   5,    0,  -13 },   // 0x49 'I'
+  {  2471,   8,  17,   5,   -3,  -13 },   // 0x4A 'J'
+  {  2539,  13,  13,  12,    0,  -13 },   // 0x4B 'K'
+  {  2624,   9,  13,  10,    0,  -13 },   // 0x4C 'L'
+  {  2683,  15,  13,  15,    0,  -13 },   // 0x4D 'M'
+  {  2781,  13,  13,  13,    0,  -13 },   // 0x4E 'N'
+  {  2866,  14,  13,  14,    0,  -13 },   // 0x4F 'O'
+  {  2957,  11,  13,  11,    0,  -13 },   // 0x50 'P'
+  {  3029,  14,  15,  14,    0,  -13 },   // 0x51 'Q'
+  {  3134,  11,  13,  12,    0,  -13 },   // 0x52 'R'
+  {  3206,  11,  13,  11,    0,  -13 },   // 0x53 'S'
+  {  3278,  12,  13,  11,    0,  -13 },   // 0x54 'T'
+  {  3356,  12,  13,  13,    1,  -13 },   // 0x55 'U'
+  {  3434,  12,  13,  12,    1,  -13 },   // 0x56 'V'
+  {  3512,  17,  13,  17,    1,  -13 },   // 0x57 'W'
+  {  3623,  14,  13,  12,   -1,  -13 },   // 0x58 'X'
+  {  3714,  11,  13,  11,    1,  -13 },   // 0x59 'Y'
+  {  3786,  14,  13,  12,   -1,  -13 },   // 0x5A 'Z'
+  {  3877,   8,  17,   7,    0,  -14 },   // 0x5B '['
+  {  3945,   4,  15,   6,    1,  -13 },   // 0x5C '\'
+  {  3975,   7,  17,   7,   -1,  -14 },   // 0x5D ']'
+  {  4035,  11,   5,  15,    2,  -13 },   // 0x5E '^'
+  {  4063,  10,   2,   9,   -1,    3 },   // 0x5F '_'
+  {  4073,   4,   4,   9,    3,  -15 },   // 0x60 '`'
+  {  4081,  10,  10,  11,    0,  -10 },   // 0x61 'a'
+  {  4131,  11,  14,  11,    0,  -14 },   // 0x62 'b'
+  {  4208,  10,  10,  10,    0,  -10 },   // 0x63 'c'
+  {  4258,  12,  14,  11,    0,  -14 },   // 0x64 'd'
+  {  4342,  10,  10,  11,    0,  -10 },   // 0x65 'e'
+  {  4392,   8,  14,   6,    1,  -14 },   // 0x66 'f'
+  {  4448,  11,  14,  11,    0,  -10 },   // 0x67 'g'
+  {  4525,  10,  14,  11,    0,  -14 },   // 0x68 'h'
+  {  4595,   5,  14,   5,    0,  -14 },   // 0x69 'i'
+  {  4630,   7,  18,   5,   -2,  -14 },   // 0x6A 'j'
+  {  4693,  11,  14,  10,    0,  -14 },   // 0x6B 'k'
+  {  4770,   5,  14,   5,    0,  -14 },   // 0x6C 'l'
+  {  4805,  16,  10,  17,    0,  -10 },   // 0x6D 'm'
+  {  4885,  10,  10,  11,    0,  -10 },   // 0x6E 'n'
+  {  4935,  10,  10,  11,    0,  -10 },   // 0x6F 'o'
+  {  4985,  11,  14,  11,    0,  -10 },   // 0x70 'p'
+  {  5062,  11,  14,  11,    0,  -10 },   // 0x71 'q'
+  {  5139,   9,  10,   7,    0,  -10 },   // 0x72 'r'
+  {  5184,   9,  10,   9,    0,  -10 },   // 0x73 's'
+  {  5229,   7,  13,   7,    1,  -13 },   // 0x74 't'
+  {  5275,  10,  10,  11,    1,  -10 },   // 0x75 'u'
+  {  5325,  10,  10,  10,    1,  -10 },   // 0x76 'v'
+  {  5375,  14,  10,  14,    1,  -10 },   // 0x77 'w'
+  {  5445,  12,  10,  10,   -1,  -10 },   // 0x78 'x'
+  {  5505,  12,  14,  10,   -1,  -10 },   // 0x79 'y'
+  {  5589,  10,  10,   9,    0,  -10 },   // 0x7A 'z'
+  {  5639,   9,  17,  11,    2,  -14 },   // 0x7B '{'
+  {  5716,   2,  18,   6,    2,  -14 },   // 0x7C '|'
+  {  5734,   9,  17,  11,    0,  -14 },   // 0x7D '}'
+  {  5811,  12,   4,  15,    1,   -8 },   // 0x7E '~'
+  {  5835,  10,  17,  11,    0,  -13 },   // 0x7F
+  {  5920,  10,  17,  11,    0,  -13 },   // 0x80
+  {  6005,  10,  17,  11,    0,  -13 },   // 0x81
+  {  6090,  10,  17,  11,    0,  -13 },   // 0x82
+  {  6175,  10,  17,  11,    0,  -13 },   // 0x83
+  {  6260,  10,  17,  11,    0,  -13 },   // 0x84
+  {  6345,  10,  17,  11,    0,  -13 },   // 0x85
+  {  6430,  10,  17,  11,    0,  -13 },   // 0x86
+  {  6515,  10,  17,  11,    0,  -13 },   // 0x87
+  {  6600,  10,  17,  11,    0,  -13 },   // 0x88
+  {  6685,  10,  17,  11,    0,  -13 },   // 0x89
+  {  6770,  10,  17,  11,    0,  -13 },   // 0x8A
+  {  6855,  10,  17,  11,    0,  -13 },   // 0x8B
+  {  6940,  10,  17,  11,    0,  -13 },   // 0x8C
+  {  7025,  10,  17,  11,    0,  -13 },   // 0x8D
+  {  7110,  10,  17,  11,    0,  -13 },   // 0x8E
+  {  7195,  10,  17,  11,    0,  -13 },   // 0x8F
+  {  7280,  10,  17,  11,    0,  -13 },   // 0x90
+  {  7365,  10,  17,  11,    0,  -13 },   // 0x91
+  {  7450,  10,  17,  11,    0,  -13 },   // 0x92
+  {  7535,  10,  17,  11,    0,  -13 },   // 0x93
+  {  7620,  10,  17,  11,    0,  -13 },   // 0x94
+  {  7705,  10,  17,  11,    0,  -13 },   // 0x95
+  {  7790,  10,  17,  11,    0,  -13 },   // 0x96
+  {  7875,  10,  17,  11,    0,  -13 },   // 0x97
+  {  7960,  10,  17,  11,    0,  -13 },   // 0x98
+  {  8045,  10,  17,  11,    0,  -13 },   // 0x99
+  {  8130,  10,  17,  11,    0,  -13 },   // 0x9A
+  {  8215,  10,  17,  11,    0,  -13 },   // 0x9B
+  {  8300,  10,  17,  11,    0,  -13 },   // 0x9C
+  {  8385,  10,  17,  11,    0,  -13 },   // 0x9D
+  {  8470,  10,  17,  11,    0,  -13 },   // 0x9E
+  {  8555,  10,  17,  11,    0,  -13 },   // 0x9F
+  {  8640,   0,   0,   6,    0,    1 },   // 0xA0
+  {  8640,   5,  14,   7,    1,  -10 },   // 0xA1
+  {  8675,   9,  16,  11,    1,  -13 },   // 0xA2
+  {  8747,  12,  13,  11,    0,  -13 },   // 0xA3
+  {  8825,  11,  11,  11,    0,  -11 },   // 0xA4
+  {  8886,  12,  13,  11,    0,  -13 },   // 0xA5
+  {  8964,   2,  16,   6,    2,  -13 },   // 0xA6
+  {  8980,   9,  16,   9,    0,  -13 },   // 0xA7
+  {  9052,   6,   2,   9,    3,  -14 },   // 0xA8
+  {  9058,  14,  13,  18,    2,  -13 },   // 0xA9
+  {  9149,   8,   9,   8,    0,  -13 },   // 0xAA
+  {  9185,   9,   8,  11,    1,   -9 },   // 0xAB
+  {  9221,  12,   6,  15,    1,   -8 },   // 0xAC
+  {  9257,   6,   3,   6,    0,   -6 },   // 0xAD
+  {  9266,  14,  13,  18,    2,  -13 },   // 0xAE
+  {  9357,   6,   3,   9,    3,  -14 },   // 0xAF
+  {  9366,   7,   6,   9,    1,  -13 },   // 0xB0
+  {  9387,  12,  12,  15,    1,  -12 },   // 0xB1
+  {  9459,   7,   7,   7,    0,  -13 },   // 0xB2
+  {  9484,   7,   7,   7,    0,  -13 },   // 0xB3
+  {  9509,   5,   4,   9,    4,  -15 },   // 0xB4
+  {  9519,  12,  14,  11,   -1,  -10 },   // 0xB5
+  {  9603,   9,  15,  11,    1,  -13 },   // 0xB6
+  {  9671,   3,   3,   6,    2,   -8 },   // 0xB7
+  {  9676,   5,   5,   9,    0,   -1 },   // 0xB8
+  {  9689,   6,   7,   7,    1,  -13 },   // 0xB9
+  {  9710,   9,   9,   8,    0,  -13 },   // 0xBA
+  {  9751,   9,   8,  11,    1,   -9 },   // 0xBB
+  {  9787,  16,  14,  17,    1,  -14 },   // 0xBC
+  {  9899,  16,  13,  17,    1,  -13 },   // 0xBD
+  { 10003,  17,  14,  17,    0,  -14 },   // 0xBE
+  { 10122,   8,  14,   9,    0,  -10 },   // 0xBF
+  { 10178,  12,  17,  12,   -1,  -17 },   // 0xC0
+  { 10280,  12,  17,  12,   -1,  -17 },   // 0xC1
+  { 10382,  12,  17,  12,   -1,  -17 },   // 0xC2
+  { 10484,  12,  17,  12,   -1,  -17 },   // 0xC3
+  { 10586,  12,  16,  12,   -1,  -16 },   // 0xC4
+  { 10682,  12,  17,  12,   -1,  -17 },   // 0xC5
+  { 10784,  19,  13,  17,   -1,  -13 },   // 0xC6
+  { 10908,  13,  17,  12,    0,  -13 },   // 0xC7
+  { 11019,  11,  17,  11,    0,  -17 },   // 0xC8
+  { 11113,  11,  17,  11,    0,  -17 },   // 0xC9
+  { 11207,  11,  17,  11,    0,  -17 },   // 0xCA
+  { 11301,  11,  16,  11,    0,  -16 },   // 0xCB
+  { 11389,   5,  17,   5,    0,  -17 },   // 0xCC
+  { 11432,   7,  17,   5,    0,  -17 },   // 0xCD
+  { 11492,   7,  17,   5,    0,  -17 },   // 0xCE
+  { 11552,   7,  16,   5,    0,  -16 },   // 0xCF
+  { 11608,  13,  13,  14,    0,  -13 },   // 0xD0
+  { 11693,  13,  17,  13,    0,  -17 },   // 0xD1
+  { 11804,  14,  17,  14,    0,  -17 },   // 0xD2
+  { 11923,  14,  17,  14,    0,  -17 },   // 0xD3
+  { 12042,  14,  17,  14,    0,  -17 },   // 0xD4
+  { 12161,  14,  17,  14,    0,  -17 },   // 0xD5
+  { 12280,  14,  17,  14,    0,  -17 },   // 0xD6
+  { 12399,  11,  11,  15,    2,  -11 },   // 0xD7
+  { 12460,  16,  15,  14,   -1,  -14 },   // 0xD8
+  { 12580,  12,  17,  13,    1,  -17 },   // 0xD9
+  { 12682,  12,  17,  13,    1,  -17 },   // 0xDA
+  { 12784,  12,  17,  13,    1,  -17 },   // 0xDB
+  { 12886,  12,  17,  13,    1,  -17 },   // 0xDC
+  { 12988,  11,  17,  11,    1,  -17 },   // 0xDD
+  { 13082,  11,  13,  11,    0,  -13 },   // 0xDE
+  { 13154,  11,  14,  11,    0,  -14 },   // 0xDF
+  { 13231,  10,  15,  11,    0,  -15 },   // 0xE0
+  { 13306,  10,  15,  11,    0,  -15 },   // 0xE1
+  { 13381,  10,  15,  11,    0,  -15 },   // 0xE2
+  { 13456,  10,  14,  11,    0,  -14 },   // 0xE3
+  { 13526,  10,  14,  11,    0,  -14 },   // 0xE4
+  { 13596,  10,  16,  11,    0,  -16 },   // 0xE5
+  { 13676,  17,  10,  18,    0,  -10 },   // 0xE6
+  { 13761,  10,  14,  10,    0,  -10 },   // 0xE7
+  { 13831,  10,  15,  11,    0,  -15 },   // 0xE8
+  { 13906,  10,  15,  11,    0,  -15 },   // 0xE9
+  { 13981,  10,  15,  11,    0,  -15 },   // 0xEA
+  { 14056,  10,  14,  11,    0,  -14 },   // 0xEB
+  { 14126,   5,  15,   5,    0,  -15 },   // 0xEC
+  { 14164,   7,  15,   5,    0,  -15 },   // 0xED
+  { 14217,   7,  15,   5,    0,  -15 },   // 0xEE
+  { 14270,   7,  14,   5,    0,  -14 },   // 0xEF
+  { 14319,  11,  14,  11,    0,  -14 },   // 0xF0
+  { 14396,  11,  14,  11,    0,  -14 },   // 0xF1
+  { 14473,  10,  15,  11,    0,  -15 },   // 0xF2
+  { 14548,  10,  15,  11,    0,  -15 },   // 0xF3
+  { 14623,  10,  15,  11,    0,  -15 },   // 0xF4
+  { 14698,  10,  14,  11,    0,  -14 },   // 0xF5
+  { 14768,  10,  14,  11,    0,  -14 },   // 0xF6
+  { 14838,  12,   9,  15,    1,  -10 },   // 0xF7
+  { 14892,  12,  12,  11,   -1,  -11 },   // 0xF8
+  { 14964,  10,  15,  11,    1,  -15 },   // 0xF9
+  { 15039,  10,  15,  11,    1,  -15 },   // 0xFA
+  { 15114,  10,  15,  11,    1,  -15 },   // 0xFB
+  { 15189,  10,  14,  11,    1,  -14 },   // 0xFC
+  { 15259,  12,  18,  10,   -1,  -14 },   // 0xFD
+  { 15367,  11,  18,  11,    0,  -14 },   // 0xFE
+  { 15466,  12,  18,  10,   -1,  -14 }    // 0xFF
+};
+
+const AaFont DejaVuSans_Oblique9pt8bAa4 = {
+  DejaVuSans_Oblique9pt8bAa4Bitmaps, DejaVuSans_Oblique9pt8bAa4Glyphs, 0x20, 0xFF, 21, 4 };
+
+// Approx. 17150 bytes
+#endif // DEJAVUSANS_OBLIQUE9PT8BAA4_H
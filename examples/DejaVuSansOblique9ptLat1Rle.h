@@ -0,0 +1,524 @@
+#ifndef DEJAVUSANS_OBLIQUE9PT8B_RLE_H
+#define DEJAVUSANS_OBLIQUE9PT8B_RLE_H
+// Police RLE (tools/font_rle.py, src/RleFont.h) : 3436 octets de plages, 3643 octets en bitmap 1 bpp
+#include "RleFont.h"
+const uint8_t DejaVuSans_Oblique9pt8bRleRuns[] PROGMEM = {
+  0x69, 0xA6, 0x92, 0x69, 0xA6, 0x9A, 0x67, 0xD4, 0xD0, 0x09, 0x45, 0x14,
+  0x51, 0x20, 0xA9, 0x2E, 0x0B, 0x5C, 0x16, 0x79, 0x2C, 0xCF, 0x4F, 0xB0,
+  0xB3, 0xC9, 0x66, 0x7A, 0x7D, 0x85, 0x9E, 0x4B, 0x3C, 0x24, 0xB8, 0x49,
+  0x00, 0xC7, 0xA3, 0xB3, 0xE4, 0xB2, 0x51, 0x49, 0x1A, 0x91, 0xD3, 0x99,
+  0x8A, 0x54, 0xA4, 0x4B, 0x25, 0x9E, 0x5E, 0xC7, 0xA3, 0xD1, 0x4F, 0x82,
+  0x8B, 0x34, 0xA3, 0x0C, 0x2C, 0xC2, 0xCC, 0x30, 0xA5, 0x0B, 0x29, 0x66,
+  0x92, 0x79, 0x22, 0xCD, 0x28, 0xC3, 0x0B, 0x30, 0xB3, 0x0C, 0x28, 0xD2,
+  0xCA, 0x59, 0x80, 0xAF, 0x9B, 0x9A, 0x39, 0x76, 0xBB, 0x7C, 0xD6, 0x8A,
+  0x49, 0x92, 0xA2, 0x28, 0xAA, 0xD3, 0x8D, 0xF5, 0x2A, 0x40, 0x1D, 0x80,
+  0xAA, 0x28, 0xA2, 0xAA, 0x2A, 0xA2, 0xAA, 0xAA, 0xAA, 0xAB, 0x1C, 0xB1,
+  0x87, 0x2C, 0x72, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xA2, 0xAA, 0x28, 0xA2,
+  0x65, 0x94, 0x51, 0x24, 0x92, 0x5B, 0x8D, 0x92, 0x49, 0x25, 0x14, 0x59,
+  0xAB, 0xB5, 0xDA, 0xED, 0x76, 0xAF, 0xFD, 0xD5, 0xDA, 0xED, 0x76, 0xBB,
+  0x40, 0x28, 0xC2, 0x40, 0x1D, 0x80, 0x10, 0xE0, 0xF0, 0xB8, 0x3C, 0x2E,
+  0x0F, 0x0B, 0x85, 0x97, 0x0B, 0x83, 0xC2, 0xE0, 0xF0, 0xB8, 0x3C, 0x20,
+  0x92, 0xE6, 0x9B, 0x2A, 0xA2, 0xAC, 0xD3, 0x4D, 0x2A, 0x2A, 0xA2, 0xDA,
+  0x7A, 0xC0, 0x8D, 0xD6, 0x52, 0xCA, 0xAC, 0xB2, 0xCB, 0x2A, 0xB2, 0x7F,
+  0xA0, 0x92, 0x72, 0x8C, 0x7C, 0xAE, 0x57, 0x0F, 0x3C, 0xF3, 0xCE, 0xBD,
+  0xCA, 0xE4, 0x96, 0x70, 0x8D, 0x5C, 0xAE, 0x14, 0xB6, 0xF4, 0xB9, 0x5C,
+  0xA2, 0x6B, 0x3C, 0xBA, 0xE5, 0x70, 0xF3, 0xC4, 0xAA, 0x52, 0x85, 0xA6,
+  0x5A, 0x66, 0x25, 0xFE, 0xCB, 0x85, 0xCA, 0x7C, 0x3E, 0x12, 0xE5, 0x73,
+  0x6E, 0x66, 0x3E, 0x57, 0x2B, 0x94, 0x4C, 0x6B, 0x89, 0x40, 0x96, 0x70,
+  0x9C, 0x25, 0xF0, 0xB8, 0x66, 0x24, 0x71, 0x71, 0x15, 0x51, 0x55, 0x15,
+  0x13, 0xE2, 0x40, 0x1F, 0xDE, 0x1F, 0x0B, 0x87, 0xC2, 0xE1, 0x70, 0xF8,
+  0x5C, 0x3E, 0x17, 0x0B, 0x86, 0x96, 0x70, 0x9B, 0x49, 0x44, 0x93, 0x52,
+  0xCC, 0xD3, 0x65, 0x54, 0x55, 0x45, 0xB6, 0xB8, 0x94, 0x92, 0x70, 0xD4,
+  0x45, 0x54, 0x55, 0x45, 0x46, 0x71, 0x4A, 0x15, 0xCA, 0xE1, 0x93, 0x1A,
+  0xE2, 0x40, 0x49, 0x2F, 0xF2, 0x48, 0x49, 0x2F, 0xF8, 0x49, 0x14, 0x88,
+  0xEC, 0xF1, 0x2D, 0x76, 0x5D, 0x79, 0xBD, 0x5E, 0x67, 0x64, 0x1F, 0xF3,
+  0xFF, 0x3F, 0xF2, 0x07, 0xB9, 0xCD, 0xEA, 0xF3, 0x75, 0x95, 0xDB, 0x38,
+  0x20, 0x34, 0xF3, 0x15, 0x51, 0x46, 0xDB, 0x71, 0x55, 0xE2, 0xA8, 0xDB,
+  0x9E, 0xEC, 0xAD, 0xBE, 0x59, 0x7D, 0xA2, 0xA3, 0x25, 0x57, 0x94, 0x6A,
+  0x13, 0x5A, 0x65, 0x22, 0x9F, 0x49, 0x46, 0x5B, 0x7F, 0x85, 0xC9, 0xB2,
+  0x2E, 0x39, 0xEE, 0x80, 0xE1, 0xF4, 0xF9, 0x9C, 0xCE, 0x11, 0x59, 0xA5,
+  0x53, 0x51, 0xB5, 0x39, 0x7D, 0x27, 0x59, 0x5C, 0x5E, 0x10, 0x7C, 0x4E,
+  0x52, 0xA9, 0x2A, 0x92, 0x89, 0xF0, 0xF9, 0x6A, 0xA4, 0xAA, 0x4A, 0xA4,
+  0xA3, 0x3D, 0x2E, 0x40, 0xBA, 0x74, 0x9E, 0x25, 0xF4, 0xBA, 0x7D, 0x2E,
+  0xD7, 0x6B, 0xB5, 0xE2, 0xC5, 0xF5, 0x70, 0x7C, 0x6E, 0x9A, 0xAD, 0xAE,
+  0x12, 0x5C, 0x24, 0xB8, 0x45, 0xF0, 0x8A, 0xE5, 0x15, 0xC2, 0x4B, 0x34,
+  0xAB, 0x5D, 0xBE, 0x40, 0x7C, 0xBE, 0x52, 0xE9, 0x74, 0xBA, 0xE5, 0x74,
+  0x97, 0x4B, 0xA5, 0xD2, 0xE7, 0xA5, 0xD0, 0x7C, 0x3E, 0x12, 0xE5, 0x72,
+  0xB9, 0xCF, 0x86, 0xB9, 0x5C, 0xAE, 0x57, 0x0B, 0x94, 0xBA, 0x74, 0x9D,
+  0x29, 0xF4, 0xBA, 0x56, 0x15, 0x61, 0x5C, 0x22, 0xB2, 0x4B, 0x24, 0xEA,
+  0x7C, 0xDC, 0x6B, 0x26, 0xB2, 0x4B, 0x26, 0xB2, 0x6B, 0x27, 0xDA, 0xF1,
+  0x2C, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0x2C, 0x9A, 0xC8, 0x69, 0xA4, 0x9A,
+  0x69, 0xA4, 0xD2, 0x69, 0xA6, 0x92, 0x68, 0xCB, 0x2A, 0xB2, 0xCB, 0x2C,
+  0xAA, 0xCB, 0x2C, 0xB2, 0xAB, 0x2A, 0xDC, 0x8C, 0x6A, 0xA8, 0xA2, 0x8A,
+  0x2A, 0x93, 0xC8, 0xAE, 0x67, 0x37, 0x94, 0x5F, 0x09, 0x3C, 0x9A, 0xCA,
+  0x28, 0xAB, 0x6B, 0x30, 0x6B, 0x2A, 0xB2, 0xCB, 0x2A, 0xEA, 0xCB, 0x2C,
+  0xAF, 0xE8, 0x6F, 0x36, 0xEC, 0x52, 0x46, 0x89, 0x91, 0xA2, 0x92, 0x29,
+  0xA2, 0x92, 0x29, 0x32, 0x8A, 0x49, 0x25, 0x12, 0x69, 0xB4, 0x9A, 0x69,
+  0xA6, 0xB9, 0x49, 0x72, 0x9A, 0xE5, 0x00, 0x6E, 0xA6, 0xEA, 0x48, 0xA6,
+  0x9A, 0x29, 0xA6, 0x8A, 0x69, 0xA4, 0x92, 0x4D, 0x22, 0xD2, 0x68, 0xA6,
+  0xA4, 0x6A, 0x46, 0xA4, 0x4B, 0x26, 0xB2, 0xB7, 0x74, 0xDD, 0x49, 0xF0,
+  0x8A, 0xE6, 0x75, 0x3A, 0x9D, 0x4E, 0x51, 0x5C, 0x34, 0xAB, 0x7D, 0x6A,
+  0x7A, 0x70, 0x94, 0x49, 0x44, 0x94, 0x49, 0x36, 0x79, 0x5C, 0x35, 0xCA,
+  0xE5, 0x70, 0xB9, 0x40, 0xB7, 0x74, 0xDD, 0x49, 0xF0, 0x8A, 0xE6, 0x75,
+  0x3A, 0x9D, 0x4E, 0x51, 0x5C, 0x34, 0xAB, 0x7D, 0x6B, 0xE3, 0xF1, 0x80,
+  0x7A, 0x70, 0x94, 0x49, 0x44, 0x94, 0x49, 0x34, 0xB8, 0x7C, 0x34, 0xD3,
+  0x51, 0x25, 0x11, 0x55, 0x15, 0x90, 0xB6, 0x72, 0x9D, 0x29, 0x74, 0xBA,
+  0xBC, 0xDE, 0x9F, 0x4B, 0xA4, 0x55, 0x67, 0xA7, 0x80, 0x1F, 0xF7, 0x57,
+  0x6B, 0xA5, 0xDA, 0xED, 0x74, 0xFA, 0x5D, 0xAE, 0xD7, 0x4B, 0xB4, 0x4B,
+  0x24, 0xB2, 0x2B, 0x24, 0xB2, 0x4B, 0x24, 0xB2, 0x2B, 0x84, 0x56, 0x49,
+  0x64, 0x96, 0x49, 0xB7, 0x39, 0xB4, 0x0B, 0x8B, 0xC2, 0x2B, 0x34, 0xAA,
+  0x6A, 0x28, 0x9B, 0x89, 0xAA, 0x93, 0xC8, 0xAE, 0x27, 0x33, 0x97, 0xD3,
+  0x0A, 0xAD, 0x2A, 0xA8, 0xA8, 0xEA, 0x2A, 0x38, 0x92, 0x68, 0xA6, 0x92,
+  0x68, 0xA4, 0x9A, 0x49, 0x24, 0x9A, 0x49, 0x22, 0xE1, 0x29, 0xA2, 0xAC,
+  0x92, 0xBA, 0xF3, 0xAF, 0x2C, 0x80, 0x4E, 0x36, 0xA2, 0x8D, 0x2C, 0x8A,
+  0xE2, 0xF2, 0xFA, 0x7C, 0xCE, 0x19, 0x59, 0x25, 0x5A, 0x6D, 0xC4, 0x9D,
+  0x60, 0x0B, 0x24, 0xA2, 0x69, 0xB8, 0x92, 0xA8, 0xAD, 0x39, 0x7C, 0xAE,
+  0x97, 0x4B, 0x95, 0xD2, 0xE9, 0x00, 0x5E, 0x2F, 0x3A, 0x7D, 0x3E, 0x9F,
+  0x4F, 0xA7, 0xD3, 0xE9, 0xF4, 0xFA, 0x7D, 0x78, 0xBC, 0x71, 0xC6, 0xA2,
+  0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xAA, 0xAA, 0x39, 0x1C, 0x08, 0xA2, 0x8A,
+  0x45, 0x14, 0x51, 0x48, 0xA2, 0x91, 0x45, 0x14, 0x40, 0x71, 0xC8, 0xE2,
+  0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xAA, 0xAA, 0x27, 0x1C, 0x8F, 0x84, 0x55,
+  0x4D, 0x35, 0x51, 0x5C, 0x20, 0x1F, 0xC0, 0x09, 0xA6, 0x80, 0x75, 0xF0,
+  0x8C, 0x5C, 0x25, 0xC1, 0xEE, 0x22, 0x9B, 0x34, 0xA4, 0xCB, 0x6B, 0x95,
+  0xC3, 0xE1, 0x72, 0x8C, 0x7C, 0xA6, 0x99, 0x71, 0x15, 0x51, 0x55, 0x15,
+  0x12, 0x4D, 0x94, 0x6A, 0x49, 0x80, 0x91, 0xF0, 0x5C, 0x25, 0x65, 0xC2,
+  0xE1, 0x70, 0xD9, 0x7A, 0x40, 0xE9, 0x74, 0xB9, 0x5D, 0x29, 0x0A, 0x74,
+  0xA4, 0xDB, 0x4A, 0x24, 0xAA, 0x4A, 0xA4, 0xA3, 0x4D, 0xB5, 0xCC, 0x85,
+  0x00, 0x92, 0x70, 0x9B, 0x65, 0x5F, 0xFB, 0xE5, 0xC4, 0xB8, 0x94, 0x8D,
+  0xC4, 0xAA, 0x78, 0xE6, 0xA2, 0xAA, 0xAA, 0xAA, 0x8A, 0xA0, 0x70, 0xA5,
+  0x4A, 0x2D, 0xB2, 0xA2, 0x2A, 0xA2, 0xAA, 0x2A, 0xA2, 0xDB, 0x5C, 0x38,
+  0x57, 0x29, 0x18, 0x9F, 0x12, 0x00, 0x6B, 0x95, 0xC3, 0xE1, 0x72, 0x8C,
+  0x7C, 0xA6, 0x99, 0x71, 0x15, 0x51, 0x55, 0x15, 0x51, 0x51, 0x15, 0x51,
+  0x55, 0x00, 0x69, 0xAF, 0x53, 0x49, 0xA4, 0xD3, 0x4D, 0x26, 0x93, 0x40,
+  0xCB, 0x2F, 0xF8, 0x59, 0x57, 0x56, 0x59, 0x65, 0x56, 0x59, 0x65, 0x54,
+  0x91, 0x80, 0x6B, 0x95, 0xC3, 0xE1, 0x72, 0x9A, 0x69, 0x28, 0x8A, 0x96,
+  0xCD, 0x6A, 0x2E, 0x24, 0x9A, 0x89, 0x28, 0xC0, 0x69, 0xA4, 0xD2, 0x69,
+  0xA6, 0x92, 0x69, 0xA6, 0x9A, 0x49, 0xA0, 0x48, 0xB6, 0xDF, 0x06, 0x98,
+  0x9B, 0x45, 0xB5, 0x11, 0x51, 0x44, 0x54, 0x51, 0x15, 0x14, 0xAD, 0x44,
+  0x54, 0x51, 0x15, 0x14, 0x40, 0x48, 0xC7, 0xC9, 0x89, 0x97, 0x11, 0x55,
+  0x15, 0x51, 0x56, 0xC4, 0x55, 0x45, 0x54, 0x92, 0x70, 0x9B, 0x65, 0x59,
+  0xA6, 0x95, 0x16, 0xDA, 0xE2, 0x50, 0x68, 0xC9, 0xCA, 0x6D, 0xA7, 0x12,
+  0x55, 0x25, 0x52, 0x51, 0x26, 0xDA, 0x46, 0xB4, 0x64, 0x5D, 0x2E, 0x57,
+  0x48, 0x70, 0xA5, 0x4A, 0x2D, 0xA4, 0xA2, 0x2A, 0xA2, 0xAA, 0x2A, 0x32,
+  0xDA, 0x5C, 0xB8, 0x57, 0x2B, 0x87, 0xC2, 0xE5, 0x00, 0x48, 0xB5, 0x8C,
+  0x8E, 0xAC, 0xB2, 0xAE, 0xAC, 0x80, 0x75, 0xF0, 0x55, 0x25, 0xF1, 0x74,
+  0xE1, 0x13, 0x51, 0xE1, 0xD0, 0x4A, 0x26, 0x9F, 0xA5, 0x45, 0x13, 0x51,
+  0x45, 0x2A, 0x60, 0x2A, 0xA2, 0xAA, 0x2A, 0x5A, 0x8A, 0xA8, 0xAA, 0x8A,
+  0x8C, 0xA7, 0x0F, 0x2E, 0x14, 0x0A, 0xDA, 0x8B, 0x6D, 0x26, 0x9A, 0x4A,
+  0x22, 0xE2, 0x2A, 0xDC, 0xF8, 0x40, 0x0A, 0x26, 0x8A, 0x6D, 0xA2, 0x9B,
+  0x49, 0x24, 0x89, 0x49, 0x24, 0x89, 0x29, 0xA2, 0x91, 0x29, 0xA2, 0x93,
+  0x91, 0xBA, 0xDA, 0xCA, 0x20, 0x4A, 0x28, 0x92, 0xA8, 0xAE, 0x1F, 0x2B,
+  0xA7, 0xC4, 0xC9, 0x28, 0x9A, 0x6A, 0xA0, 0x2B, 0x32, 0xB2, 0x6A, 0x28,
+  0x9B, 0x89, 0xAA, 0x92, 0xE2, 0x73, 0x39, 0x7D, 0x2E, 0xD7, 0x4B, 0xA7,
+  0xD2, 0x5C, 0xAE, 0x73, 0xCF, 0x3C, 0xF3, 0xCF, 0x72, 0xB9, 0xCE, 0xC8,
+  0xF2, 0xE1, 0x70, 0xB2, 0x96, 0x4E, 0x1F, 0x0B, 0x85, 0x97, 0x0B, 0x85,
+  0xC4, 0xCC, 0x1F, 0xFF, 0xC8, 0x6F, 0x4E, 0x17, 0x0B, 0x85, 0x97, 0x0F,
+  0x89, 0x64, 0x5C, 0x2C, 0xB8, 0x5C, 0x2C, 0xE4, 0xAC, 0x36, 0x7D, 0x28,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17,
+  0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0,
+  0x1D, 0xF0, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0xC2, 0xE1, 0x70, 0xB8,
+  0x5C, 0x2E, 0x17, 0x0B, 0x8E, 0xC0, 0x69, 0xAF, 0x4B, 0x4D, 0x34, 0xD3,
+  0x49, 0x34, 0xD0, 0xC7, 0x93, 0xC9, 0xD1, 0xF0, 0x5A, 0x24, 0x94, 0x8B,
+  0x4C, 0xB4, 0xCB, 0x4C, 0xB6, 0x4A, 0x2B, 0x4B, 0x8F, 0x27, 0x92, 0xD3,
+  0x68, 0x99, 0xAB, 0x95, 0xD2, 0xE3, 0x89, 0xC6, 0x5C, 0xAE, 0x97, 0x1C,
+  0xBE, 0x40, 0x07, 0x82, 0x51, 0x25, 0x2E, 0x19, 0x65, 0xA6, 0x99, 0x65,
+  0xF0, 0x91, 0x25, 0x13, 0xC1, 0x4A, 0x34, 0xA2, 0x69, 0xAA, 0x8B, 0xB6,
+  0x75, 0x57, 0x4A, 0xF5, 0x97, 0x2B, 0xA5, 0xD2, 0x1F, 0x89, 0xF8, 0xB2,
+  0xDA, 0xB9, 0x5D, 0x1E, 0x11, 0x35, 0x26, 0xD3, 0x4D, 0xA5, 0x49, 0x5C,
+  0x1E, 0x97, 0x29, 0xE9, 0x40, 0x08, 0xC2, 0x80, 0x97, 0x2A, 0x9A, 0xE1,
+  0x22, 0xE2, 0x24, 0xB3, 0xC2, 0x47, 0x94, 0x8F, 0x29, 0x1E, 0x53, 0x2C,
+  0xB2, 0x4B, 0x6C, 0xA5, 0xC2, 0x6A, 0xAD, 0x40, 0x37, 0x82, 0xB8, 0x8A,
+  0x36, 0xCB, 0x27, 0x9C, 0x85, 0x96, 0x92, 0x49, 0x22, 0x92, 0x69, 0x28,
+  0x92, 0x89, 0x28, 0x51, 0x1F, 0xF3, 0xD2, 0xE9, 0x74, 0x80, 0x1D, 0x80,
+  0x97, 0x2A, 0x9A, 0xE1, 0x22, 0xA3, 0x24, 0xB2, 0xCB, 0x4C, 0xB2, 0xD3,
+  0x91, 0x32, 0x8C, 0x4C, 0xB2, 0xC9, 0x28, 0xB4, 0x4A, 0x5C, 0x26, 0xAA,
+  0xD4, 0x1E, 0x80, 0x30, 0xA4, 0xE2, 0x8D, 0x23, 0x00, 0xAB, 0xB5, 0xDA,
+  0xBF, 0xF7, 0x57, 0x6B, 0xB5, 0xFB, 0xFF, 0xB0, 0x4D, 0x16, 0x69, 0x89,
+  0x96, 0x9D, 0x36, 0x94, 0xE9, 0xA6, 0x93, 0x00, 0x49, 0x24, 0x80, 0x6A,
+  0x26, 0xA2, 0x4E, 0x24, 0xA3, 0x4A, 0x26, 0xA2, 0x6A, 0x24, 0xDB, 0x5D,
+  0x94, 0x59, 0x65, 0x74, 0xB9, 0x5D, 0x20, 0x78, 0xD5, 0xC2, 0xCB, 0x84,
+  0x4D, 0x45, 0x44, 0x62, 0x46, 0x14, 0xA1, 0x46, 0x94, 0x69, 0x46, 0x24,
+  0x61, 0x4A, 0x14, 0x40, 0x10, 0x65, 0xC0, 0x2D, 0x96, 0x51, 0x65, 0x93,
+  0x00, 0x51, 0x16, 0xEA, 0xAA, 0xB6, 0x54, 0xEB, 0x00, 0x25, 0x98, 0x92,
+  0x89, 0x28, 0x92, 0x69, 0x22, 0x92, 0x49, 0x26, 0x59, 0x2F, 0x95, 0x0F,
+  0x0A, 0x9C, 0xA9, 0xCB, 0x1A, 0xB8, 0x31, 0x68, 0xCD, 0x59, 0x42, 0x4D,
+  0x50, 0xA3, 0x14, 0x28, 0xC5, 0x32, 0x5D, 0x14, 0xBB, 0x20, 0x2F, 0x95,
+  0x0F, 0x0A, 0x9C, 0xA9, 0xCB, 0x1A, 0xB8, 0x31, 0x68, 0xCB, 0x7C, 0x24,
+  0x59, 0xAB, 0x83, 0x17, 0x09, 0xAE, 0x0C, 0x59, 0x45, 0xA8, 0x37, 0x85,
+  0x8E, 0x51, 0xE5, 0xC1, 0xAB, 0x93, 0x17, 0x45, 0xAD, 0x21, 0xAB, 0x85,
+  0x09, 0x39, 0x42, 0x8D, 0x50, 0xA3, 0x54, 0xCD, 0x74, 0x5A, 0xEC, 0x80,
+  0xAA, 0xAF, 0x54, 0x55, 0x46, 0xDB, 0x51, 0x55, 0x54, 0xE4, 0xD0, 0xE1,
+  0x78, 0xBF, 0xE1, 0xF4, 0xF9, 0x9C, 0xCE, 0x11, 0x59, 0xA5, 0x53, 0x51,
+  0xB5, 0x39, 0x7D, 0x27, 0x59, 0x5C, 0x5E, 0x10, 0xE9, 0x74, 0xBF, 0xE1,
+  0xF4, 0xF9, 0x9C, 0xCE, 0x11, 0x59, 0xA5, 0x53, 0x51, 0xB5, 0x39, 0x7D,
+  0x27, 0x59, 0x5C, 0x5E, 0x10, 0xE5, 0xF2, 0x52, 0xFE, 0xBE, 0x9F, 0x33,
+  0x99, 0xC2, 0x2B, 0x34, 0xAA, 0x6A, 0x36, 0xA7, 0x2F, 0xA4, 0xEB, 0x2B,
+  0x8B, 0xC2, 0xE1, 0x23, 0x8A, 0x5F, 0xE7, 0xD3, 0xE6, 0x73, 0x38, 0x45,
+  0x66, 0x95, 0x4D, 0x46, 0xD4, 0xE5, 0xF4, 0x9D, 0x65, 0x71, 0x78, 0x40,
+  0xE1, 0x15, 0xC2, 0x2B, 0xFA, 0xFA, 0x7C, 0xCE, 0x67, 0x08, 0xAC, 0xD2,
+  0xA9, 0xA8, 0xDA, 0x9C, 0xBE, 0x93, 0xAC, 0xAE, 0x2F, 0x08, 0xE1, 0xF2,
+  0x59, 0xE0, 0xB3, 0xC1, 0x67, 0x97, 0xCC, 0xE6, 0x71, 0x78, 0x45, 0x64,
+  0xD5, 0x4D, 0x45, 0x14, 0xE5, 0xF4, 0x9E, 0x45, 0x71, 0x78, 0x40, 0xE7,
+  0xCE, 0x3D, 0xE1, 0x15, 0xF2, 0x4B, 0xD6, 0x97, 0xA9, 0xF3, 0x53, 0xE6,
+  0xB6, 0xBC, 0xE7, 0xBE, 0xBB, 0x55, 0x74, 0xAF, 0x49, 0xDE, 0x80, 0xBA,
+  0x74, 0x9E, 0x25, 0xF4, 0xBA, 0x7D, 0x2E, 0xD7, 0x6B, 0xB5, 0xE2, 0xC5,
+  0xF5, 0x77, 0x47, 0xC3, 0xCB, 0xAB, 0xB5, 0xFB, 0xE5, 0xF2, 0x97, 0x4B,
+  0xA5, 0xD7, 0x2B, 0xA4, 0xBA, 0x5D, 0x2E, 0x97, 0x3D, 0x2E, 0x80, 0xE1,
+  0x72, 0xBF, 0x7C, 0xBE, 0x52, 0xE9, 0x74, 0xBA, 0xE5, 0x74, 0x97, 0x4B,
+  0xA5, 0xD2, 0xE7, 0xA5, 0xD0, 0xCF, 0x82, 0x97, 0xE7, 0x97, 0xCA, 0x5D,
+  0x2E, 0x97, 0x5C, 0xAE, 0x92, 0xE9, 0x74, 0xBA, 0x5C, 0xF4, 0xBA, 0xA8,
+  0xAC, 0x8A, 0xFC, 0xF2, 0xF9, 0x4B, 0xA5, 0xD2, 0xEB, 0x95, 0xD2, 0x5D,
+  0x2E, 0x97, 0x4B, 0x9E, 0x97, 0x40, 0x4A, 0x2E, 0x53, 0x49, 0x34, 0xD3,
+  0x49, 0xA4, 0xD3, 0x4D, 0x24, 0xD0, 0x8A, 0x2F, 0x55, 0x51, 0x55, 0x55,
+  0x51, 0xC5, 0x55, 0x55, 0x45, 0x50, 0x6D, 0x94, 0xBB, 0x55, 0x45, 0x55,
+  0x55, 0x47, 0x15, 0x55, 0x55, 0x15, 0x40, 0x48, 0xA4, 0x8A, 0xED, 0x55,
+  0x15, 0x55, 0x55, 0x1C, 0x55, 0x55, 0x54, 0x55, 0x00, 0x7C, 0x6E, 0x9A,
+  0xAD, 0xAE, 0x12, 0x5C, 0x75, 0x39, 0xA8, 0xAE, 0x51, 0x5C, 0x24, 0xB3,
+  0x4A, 0xB5, 0xDB, 0xE4, 0xC9, 0x1E, 0x0A, 0x5F, 0xD7, 0x53, 0x75, 0x24,
+  0x53, 0x4D, 0x14, 0xD3, 0x45, 0x34, 0xD2, 0x49, 0x26, 0x91, 0x69, 0x34,
+  0x53, 0x52, 0x35, 0x23, 0x52, 0x25, 0x93, 0x59, 0x00, 0xE1, 0x7A, 0xBF,
+  0xE2, 0xEE, 0x9B, 0xA9, 0x3E, 0x11, 0x5C, 0xCE, 0xA7, 0x53, 0xA9, 0xCA,
+  0x2B, 0x86, 0x95, 0x6F, 0xAD, 0x40, 0xE9, 0x76, 0xBF, 0xE2, 0xEE, 0x9B,
+  0xA9, 0x3E, 0x11, 0x5C, 0xCE, 0xA7, 0x53, 0xA9, 0xCA, 0x2B, 0x86, 0x95,
+  0x6F, 0xAD, 0x40, 0xE5, 0xF4, 0x52, 0xFE, 0xDD, 0xD3, 0x75, 0x27, 0xC2,
+  0x2B, 0x99, 0xD4, 0xEA, 0x75, 0x39, 0x45, 0x70, 0xD2, 0xAD, 0xF5, 0xA8,
+  0xE1, 0x23, 0xC1, 0x4B, 0xFD, 0x77, 0x4D, 0xD4, 0x9F, 0x08, 0xAE, 0x67,
+  0x53, 0xA9, 0xD4, 0xE5, 0x15, 0xC3, 0x4A, 0xB7, 0xD6, 0xA0, 0xE1, 0x15,
+  0xCA, 0x2B, 0xFB, 0x77, 0x4D, 0xD4, 0x9F, 0x08, 0xAE, 0x67, 0x53, 0xA9,
+  0xD4, 0xE5, 0x15, 0xC3, 0x4A, 0xB7, 0xD6, 0xA0, 0x27, 0x12, 0xE3, 0x2D,
+  0x37, 0xAC, 0xD2, 0xE6, 0xD3, 0x2E, 0x32, 0x71, 0xD5, 0x99, 0xC9, 0x31,
+  0xD5, 0x1D, 0x8D, 0x54, 0x52, 0x71, 0x24, 0x93, 0x6D, 0x24, 0x94, 0x69,
+  0x15, 0x53, 0x95, 0xB7, 0x5C, 0x27, 0x98, 0x5D, 0xAB, 0xC5, 0xFC, 0x59,
+  0x25, 0x91, 0x59, 0x25, 0x92, 0x59, 0x25, 0x91, 0x5C, 0x22, 0xB2, 0x4B,
+  0x24, 0xB2, 0x4D, 0xB9, 0xCD, 0xA0, 0xE1, 0x74, 0xBF, 0x8B, 0x24, 0xB2,
+  0x2B, 0x24, 0xB2, 0x4B, 0x24, 0xB2, 0x2B, 0x84, 0x56, 0x49, 0x64, 0x96,
+  0x49, 0xB7, 0x39, 0xB4, 0xCF, 0x92, 0x97, 0xE9, 0x64, 0x96, 0x45, 0x64,
+  0x96, 0x49, 0x64, 0x96, 0x45, 0x70, 0x8A, 0xC9, 0x2C, 0x92, 0xC9, 0x36,
+  0xE7, 0x36, 0x80, 0xA8, 0xAE, 0x11, 0x5F, 0xA5, 0x92, 0x59, 0x15, 0x92,
+  0x59, 0x25, 0x92, 0x59, 0x15, 0xC2, 0x2B, 0x24, 0xB2, 0x4B, 0x24, 0xDB,
+  0x9C, 0xDA, 0xCB, 0x95, 0xF9, 0x59, 0x25, 0x13, 0x4D, 0xC4, 0x95, 0x45,
+  0x69, 0xCB, 0xE5, 0x74, 0xBA, 0x5C, 0xAE, 0x97, 0x48, 0x6B, 0x95, 0xC7,
+  0x0F, 0x94, 0xA2, 0x4A, 0x22, 0xE2, 0x2A, 0x33, 0xCA, 0xE1, 0xAE, 0x17,
+  0x28, 0x96, 0x70, 0x9B, 0x49, 0x44, 0x92, 0x51, 0x15, 0x51, 0x6D, 0x36,
+  0x94, 0x65, 0x54, 0x55, 0x45, 0xBA, 0x71, 0x46, 0x80, 0x6B, 0x95, 0xCA,
+  0xFC, 0x57, 0xC2, 0x31, 0x70, 0x97, 0x07, 0xB8, 0x8A, 0x6C, 0xD2, 0x93,
+  0x2C, 0xE1, 0x70, 0xB8, 0x5F, 0xAB, 0x38, 0x66, 0x2E, 0x53, 0xE1, 0x72,
+  0x54, 0x49, 0x36, 0xA9, 0x4D, 0x96, 0xAE, 0xA2, 0x62, 0x4B, 0xDA, 0xF8,
+  0x46, 0x2E, 0x12, 0xE0, 0xF7, 0x11, 0x4D, 0x9A, 0x52, 0x65, 0x80, 0x89,
+  0x16, 0x52, 0xFF, 0x9A, 0xF8, 0x46, 0x2E, 0x12, 0xE0, 0xF7, 0x11, 0x4D,
+  0x9A, 0x52, 0x65, 0x80, 0x68, 0xA8, 0x8A, 0xFF, 0x9A, 0xF8, 0x46, 0x2E,
+  0x12, 0xE0, 0xF7, 0x11, 0x4D, 0x9A, 0x52, 0x65, 0x80, 0xAE, 0x96, 0x61,
+  0x66, 0x16, 0x6B, 0xFA, 0xBE, 0x11, 0x8B, 0x84, 0xB8, 0x3D, 0xC4, 0x53,
+  0x66, 0x94, 0x99, 0x60, 0x75, 0xB9, 0xF3, 0x31, 0xC5, 0xC2, 0xA9, 0x7E,
+  0x0F, 0xEE, 0xAE, 0x14, 0x71, 0x1C, 0xB3, 0x92, 0x00, 0x91, 0xF0, 0x5C,
+  0x25, 0x65, 0xC2, 0xE1, 0x70, 0xD9, 0x7A, 0x4E, 0x0F, 0x26, 0xB0, 0x6B,
+  0xA5, 0xD2, 0xFD, 0xC9, 0xC2, 0x6D, 0x95, 0x7F, 0xEF, 0x97, 0x12, 0xE2,
+  0x50, 0xE1, 0x70, 0xB8, 0x5F, 0xB9, 0x38, 0x4D, 0xB2, 0xAF, 0xFD, 0xF2,
+  0xE2, 0x5C, 0x4A, 0xAF, 0x22, 0x6A, 0x4B, 0xF3, 0x27, 0x09, 0xB6, 0x55,
+  0xFF, 0xBE, 0x5C, 0x4B, 0x89, 0x40, 0x68, 0xAA, 0x8A, 0xFF, 0xD9, 0x38,
+  0x4D, 0xB2, 0xAF, 0xFD, 0xF2, 0xE2, 0x5C, 0x4A, 0x09, 0xA6, 0xB2, 0x48,
+  0xB2, 0x92, 0x49, 0x22, 0xCA, 0x48, 0x8A, 0x28, 0xBD, 0x55, 0x47, 0x15,
+  0x55, 0x55, 0x1C, 0x55, 0x00, 0x4D, 0x22, 0x4A, 0x4B, 0x95, 0x13, 0x6D,
+  0x45, 0x14, 0x4D, 0xB5, 0x10, 0x08, 0xC2, 0xBD, 0x4D, 0x26, 0x93, 0x4D,
+  0x34, 0x9A, 0x4D, 0x00, 0x6D, 0x19, 0x1D, 0xE1, 0x5A, 0xF8, 0x2D, 0xA2,
+  0xA4, 0xB2, 0xC8, 0x8A, 0x6D, 0x69, 0x00, 0x89, 0x18, 0x52, 0xFF, 0xB4,
+  0x63, 0xE4, 0xC4, 0xCB, 0x88, 0xAA, 0x8A, 0xA8, 0xAB, 0x62, 0x2A, 0xA2,
+  0xAA, 0x6B, 0xA5, 0xD2, 0xFD, 0xC9, 0xC2, 0x6D, 0x95, 0x66, 0x9A, 0x54,
+  0x5B, 0x6B, 0x89, 0x40, 0xE1, 0x70, 0xB8, 0x5F, 0xB9, 0x38, 0x4D, 0xB2,
+  0xAC, 0xD3, 0x4A, 0x8B, 0x6D, 0x71, 0x28, 0xAF, 0x22, 0x6A, 0x4B, 0xF3,
+  0x27, 0x09, 0xB6, 0x55, 0x9A, 0x69, 0x51, 0x6D, 0xAE, 0x25, 0x89, 0x18,
+  0x52, 0xFF, 0xD9, 0x38, 0x4D, 0xB2, 0xAC, 0xD3, 0x4A, 0x8B, 0x6D, 0x71,
+  0x28, 0x68, 0xAA, 0x8A, 0xFF, 0xD9, 0x38, 0x4D, 0xB2, 0xAC, 0xD3, 0x4A,
+  0x8B, 0x6D, 0x71, 0x28, 0xAB, 0xB5, 0xFB, 0xFF, 0xBF, 0xDA, 0xED, 0x00,
+  0xFC, 0xC2, 0x9F, 0x0D, 0xA6, 0x9A, 0x25, 0x24, 0x8A, 0x49, 0x22, 0x92,
+  0x44, 0xA6, 0x9A, 0x6F, 0x86, 0x8C, 0x6B, 0xA5, 0xD2, 0xFC, 0x2A, 0x8A,
+  0xA8, 0xA9, 0x6A, 0x2A, 0xA2, 0xAA, 0x2A, 0x32, 0x9C, 0x3C, 0xB8, 0x50,
+  0xE1, 0x70, 0xB8, 0x5F, 0x85, 0x51, 0x55, 0x15, 0x2D, 0x45, 0x54, 0x55,
+  0x45, 0x46, 0x53, 0x87, 0x97, 0x0A, 0xAF, 0x22, 0x6A, 0x4B, 0xD5, 0x51,
+  0x55, 0x15, 0x2D, 0x45, 0x54, 0x55, 0x45, 0x46, 0x53, 0x87, 0x97, 0x0A,
+  0x68, 0xAA, 0x8A, 0xFF, 0xA5, 0x51, 0x55, 0x15, 0x2D, 0x45, 0x54, 0x55,
+  0x45, 0x46, 0x53, 0x87, 0x97, 0x0A, 0xE5, 0x74, 0xBA, 0x5F, 0xB5, 0x99,
+  0x59, 0x35, 0x14, 0x4D, 0xC4, 0xD5, 0x49, 0x71, 0x39, 0x9C, 0xBE, 0x97,
+  0x6B, 0xA5, 0xD3, 0xE9, 0x00, 0x6B, 0xA5, 0xD2, 0xE5, 0x74, 0x94, 0x68,
+  0xD6, 0xDB, 0x4A, 0xA4, 0xAA, 0x2B, 0x22, 0xAA, 0x4D, 0xB5, 0xCB, 0x46,
+  0x45, 0xCA, 0xE9, 0x74, 0x80, 0x88, 0xAE, 0x11, 0x5F, 0xFE, 0x16, 0x65,
+  0x64, 0xD4, 0x51, 0x37, 0x13, 0x55, 0x25, 0xC4, 0xE6, 0x72, 0xFA, 0x5D,
+  0xAE, 0x97, 0x4F, 0xA4
+};
+
+const GFXglyph DejaVuSans_Oblique9pt8bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20
+  {     0,   5,  13,   7,    0,  -12 },   // 0x21
+  {     9,   6,   5,   8,    2,  -12 },   // 0x22
+  {    14,  13,  14,  15,    1,  -13 },   // 0x23
+  {    37,  10,  17,  11,    1,  -13 },   // 0x24
+  {    58,  14,  13,  17,    2,  -12 },   // 0x25
+  {    87,  12,  13,  14,    0,  -12 },   // 0x26
+  {   106,   2,   5,   5,    2,  -12 },   // 0x27
+  {   108,   7,  16,   7,    1,  -13 },   // 0x28
+  {   120,   7,  16,   7,   -1,  -13 },   // 0x29
+  {   132,   7,   8,   9,    1,  -12 },   // 0x2A
+  {   144,  12,  12,  15,    2,  -11 },   // 0x2B
+  {   157,   3,   4,   6,    1,   -1 },   // 0x2C
+  {   160,   5,   2,   7,    1,   -5 },   // 0x2D
+  {   162,   2,   2,   6,    1,   -1 },   // 0x2E
+  {   163,   9,  15,   6,   -1,  -12 },   // 0x2F
+  {   180,  10,  13,  11,    1,  -12 },   // 0x30
+  {   194,   8,  13,  11,    1,  -12 },   // 0x31
+  {   205,  10,  13,  11,    0,  -12 },   // 0x32
+  {   218,  10,  13,  11,    0,  -12 },   // 0x33
+  {   232,  10,  13,  11,    0,  -12 },   // 0x34
+  {   247,  10,  13,  11,    0,  -12 },   // 0x35
+  {   262,  10,  13,  11,    1,  -12 },   // 0x36
+  {   279,  10,  13,  11,    2,  -12 },   // 0x37
+  {   293,  10,  13,  11,    1,  -12 },   // 0x38
+  {   309,  10,  13,  11,    1,  -12 },   // 0x39
+  {   326,   4,   9,   6,    1,   -8 },   // 0x3A
+  {   330,   4,  11,   6,    1,   -8 },   // 0x3B
+  {   336,  11,  10,  15,    2,   -9 },   // 0x3C
+  {   346,  11,   6,  15,    2,   -8 },   // 0x3D
+  {   351,  11,  10,  15,    2,   -9 },   // 0x3E
+  {   361,   7,  13,  10,    2,  -12 },   // 0x3F
+  {   371,  16,  16,  18,    1,  -12 },   // 0x40
+  {   400,  12,  13,  12,   -1,  -12 },   // 0x41
+  {   418,  11,  13,  12,    0,  -12 },   // 0x42
+  {   436,  12,  13,  13,    0,  -12 },   // 0x43
+  {   451,  13,  13,  14,    0,  -12 },   // 0x44
+  {   472,  11,  13,  11,    0,  -12 },   // 0x45
+  {   487,  10,  13,  10,    0,  -12 },   // 0x46
+  {   501,  12,  13,  14,    0,  -12 },   // 0x47
+  {   518,  13,  13,  14,    0,  -12 },   // 0x48
+  {   537,   5,  13,   5,    0,  -12 },   // 0x49
+  {   547,   8,  17,   5,   -3,  -12 },   // 0x4A
+  {   560,  13,  13,  12,    0,  -12 },   // 0x4B
+  {   580,   8,  13,  10,    0,  -12 },   // 0x4C
+  {   590,  15,  13,  16,    0,  -12 },   // 0x4D
+  {   619,  13,  13,  13,    0,  -12 },   // 0x4E
+  {   643,  13,  13,  14,    0,  -12 },   // 0x4F
+  {   660,  10,  13,  11,    0,  -12 },   // 0x50
+  {   676,  13,  15,  14,    0,  -12 },   // 0x51
+  {   696,  10,  13,  13,    0,  -12 },   // 0x52
+  {   714,  11,  13,  11,    0,  -12 },   // 0x53
+  {   729,  12,  13,  11,    1,  -12 },   // 0x54
+  {   743,  12,  13,  13,    1,  -12 },   // 0x55
+  {   762,  12,  13,  12,    1,  -12 },   // 0x56
+  {   780,  17,  13,  18,    2,  -12 },   // 0x57
+  {   810,  12,  13,  12,    0,  -12 },   // 0x58
+  {   829,  11,  13,  11,    1,  -12 },   // 0x59
+  {   846,  13,  13,  12,    0,  -12 },   // 0x5A
+  {   861,   7,  16,   7,    1,  -13 },   // 0x5B
+  {   873,   3,  15,   6,    2,  -12 },   // 0x5C
+  {   885,   7,  16,   7,   -1,  -13 },   // 0x5D
+  {   897,  11,   5,  15,    2,  -12 },   // 0x5E
+  {   905,   9,   2,   9,    0,    3 },   // 0x5F
+  {   907,   4,   3,   9,    3,  -13 },   // 0x60
+  {   910,   9,  10,  10,    1,   -9 },   // 0x61
+  {   922,  10,  14,  11,    1,  -13 },   // 0x62
+  {   942,   9,  10,  10,    1,   -9 },   // 0x63
+  {   953,  11,  14,  11,    1,  -13 },   // 0x64
+  {   973,  10,  10,  11,    1,   -9 },   // 0x65
+  {   983,   7,  14,   6,    1,  -13 },   // 0x66
+  {   994,  10,  14,  11,    1,   -9 },   // 0x67
+  {  1014,  10,  14,  11,    1,  -13 },   // 0x68
+  {  1034,   5,  14,   5,    1,  -13 },   // 0x69
+  {  1044,   8,  18,   5,   -2,  -13 },   // 0x6A
+  {  1058,  10,  14,  10,    1,  -13 },   // 0x6B
+  {  1076,   5,  14,   5,    1,  -13 },   // 0x6C
+  {  1087,  15,  10,  17,    1,   -9 },   // 0x6D
+  {  1109,  10,  10,  11,    1,   -9 },   // 0x6E
+  {  1123,  10,  10,  11,    1,   -9 },   // 0x6F
+  {  1134,  11,  14,  11,    0,   -9 },   // 0x70
+  {  1153,  10,  14,  11,    1,   -9 },   // 0x71
+  {  1173,   8,  10,   8,    0,   -9 },   // 0x72
+  {  1182,   9,  10,   9,    0,   -9 },   // 0x73
+  {  1193,   6,  13,   7,    1,  -12 },   // 0x74
+  {  1203,  10,  10,  11,    1,   -9 },   // 0x75
+  {  1217,  10,  10,  10,    1,   -9 },   // 0x76
+  {  1230,  14,  10,  14,    1,   -9 },   // 0x77
+  {  1253,  11,  10,  10,    0,   -9 },   // 0x78
+  {  1267,  12,  14,  11,    0,   -9 },   // 0x79
+  {  1285,  10,  10,   9,    0,   -9 },   // 0x7A
+  {  1294,   9,  17,  11,    2,  -13 },   // 0x7B
+  {  1310,   2,  18,   6,    2,  -13 },   // 0x7C
+  {  1313,   9,  17,  11,    0,  -13 },   // 0x7D
+  {  1329,  11,   3,  15,    2,   -7 },   // 0x7E
+  {  1332,   9,  16,  11,    1,  -12 },   // 0x7F
+  {  1350,   9,  16,  11,    1,  -12 },   // 0x80
+  {  1368,   9,  16,  11,    1,  -12 },   // 0x81
+  {  1386,   9,  16,  11,    1,  -12 },   // 0x82
+  {  1404,   9,  16,  11,    1,  -12 },   // 0x83
+  {  1422,   9,  16,  11,    1,  -12 },   // 0x84
+  {  1440,   9,  16,  11,    1,  -12 },   // 0x85
+  {  1458,   9,  16,  11,    1,  -12 },   // 0x86
+  {  1476,   9,  16,  11,    1,  -12 },   // 0x87
+  {  1494,   9,  16,  11,    1,  -12 },   // 0x88
+  {  1512,   9,  16,  11,    1,  -12 },   // 0x89
+  {  1530,   9,  16,  11,    1,  -12 },   // 0x8A
+  {  1548,   9,  16,  11,    1,  -12 },   // 0x8B
+  {  1566,   9,  16,  11,    1,  -12 },   // 0x8C
+  {  1584,   9,  16,  11,    1,  -12 },   // 0x8D
+  {  1602,   9,  16,  11,    1,  -12 },   // 0x8E
+  {  1620,   9,  16,  11,    1,  -12 },   // 0x8F
+  {  1638,   9,  16,  11,    1,  -12 },   // 0x90
+  {  1656,   9,  16,  11,    1,  -12 },   // 0x91
+  {  1674,   9,  16,  11,    1,  -12 },   // 0x92
+  {  1692,   9,  16,  11,    1,  -12 },   // 0x93
+  {  1710,   9,  16,  11,    1,  -12 },   // 0x94
+  {  1728,   9,  16,  11,    1,  -12 },   // 0x95
+  {  1746,   9,  16,  11,    1,  -12 },   // 0x96
+  {  1764,   9,  16,  11,    1,  -12 },   // 0x97
+  {  1782,   9,  16,  11,    1,  -12 },   // 0x98
+  {  1800,   9,  16,  11,    1,  -12 },   // 0x99
+  {  1818,   9,  16,  11,    1,  -12 },   // 0x9A
+  {  1836,   9,  16,  11,    1,  -12 },   // 0x9B
+  {  1854,   9,  16,  11,    1,  -12 },   // 0x9C
+  {  1872,   9,  16,  11,    1,  -12 },   // 0x9D
+  {  1890,   9,  16,  11,    1,  -12 },   // 0x9E
+  {  1908,   9,  16,  11,    1,  -12 },   // 0x9F
+  {  1926,   1,   1,   6,    0,    0 },   // 0xA0
+  {  1926,   5,  13,   7,    2,   -9 },   // 0xA1
+  {  1935,   9,  16,  11,    1,  -12 },   // 0xA2
+  {  1955,  11,  13,  11,    0,  -12 },   // 0xA3
+  {  1970,   9,   9,  11,    1,   -9 },   // 0xA4
+  {  1985,  11,  13,  11,    1,  -12 },   // 0xA5
+  {  2000,   2,  16,   6,    2,  -12 },   // 0xA6
+  {  2003,  10,  15,   9,   -1,  -12 },   // 0xA7
+  {  2021,   5,   2,   9,    3,  -13 },   // 0xA8
+  {  2024,  13,  13,  18,    2,  -12 },   // 0xA9
+  {  2048,   7,   9,   8,    1,  -12 },   // 0xAA
+  {  2056,   9,   8,  11,    1,   -8 },   // 0xAB
+  {  2068,  11,   5,  15,    2,   -7 },   // 0xAC
+  {  2074,   5,   2,   7,    1,   -5 },   // 0xAD
+  {  2076,  13,  13,  18,    2,  -12 },   // 0xAE
+  {  2101,   6,   2,   9,    3,  -12 },   // 0xAF
+  {  2103,   6,   6,   9,    2,  -12 },   // 0xB0
+  {  2109,  12,  11,  15,    2,  -10 },   // 0xB1
+  {  2120,   6,   7,   7,    0,  -12 },   // 0xB2
+  {  2126,   6,   7,   7,    0,  -12 },   // 0xB3
+  {  2132,   5,   3,   9,    5,  -13 },   // 0xB4
+  {  2135,  11,  14,  11,    0,   -9 },   // 0xB5
+  {  2155,   9,  15,  11,    1,  -12 },   // 0xB6
+  {  2176,   2,   2,   6,    2,   -6 },   // 0xB7
+  {  2177,   4,   3,   9,    1,    1 },   // 0xB8
+  {  2179,   4,   7,   7,    1,  -12 },   // 0xB9
+  {  2185,   7,   9,   8,    1,  -12 },   // 0xBA
+  {  2193,   9,   8,  11,    1,   -8 },   // 0xBB
+  {  2205,  15,  13,  17,    1,  -12 },   // 0xBC
+  {  2230,  15,  13,  17,    1,  -12 },   // 0xBD
+  {  2254,  16,  13,  17,    0,  -12 },   // 0xBE
+  {  2280,   7,  14,  10,    0,   -9 },   // 0xBF
+  {  2291,  12,  16,  12,   -1,  -15 },   // 0xC0
+  {  2312,  12,  16,  12,   -1,  -15 },   // 0xC1
+  {  2333,  12,  16,  12,   -1,  -15 },   // 0xC2
+  {  2354,  12,  16,  12,   -1,  -15 },   // 0xC3
+  {  2376,  12,  16,  12,   -1,  -15 },   // 0xC4
+  {  2398,  12,  17,  12,   -1,  -16 },   // 0xC5
+  {  2423,  19,  13,  18,   -1,  -12 },   // 0xC6
+  {  2447,  12,  16,  13,    0,  -12 },   // 0xC7
+  {  2465,  11,  16,  11,    0,  -15 },   // 0xC8
+  {  2483,  11,  16,  11,    0,  -15 },   // 0xC9
+  {  2501,  11,  16,  11,    0,  -15 },   // 0xCA
+  {  2519,  11,  16,  11,    0,  -15 },   // 0xCB
+  {  2538,   5,  16,   5,    0,  -15 },   // 0xCC
+  {  2550,   7,  16,   5,    0,  -15 },   // 0xCD
+  {  2562,   7,  16,   5,    0,  -15 },   // 0xCE
+  {  2575,   7,  16,   5,    0,  -15 },   // 0xCF
+  {  2589,  13,  13,  14,    0,  -12 },   // 0xD0
+  {  2608,  13,  16,  13,    0,  -15 },   // 0xD1
+  {  2637,  13,  16,  14,    0,  -15 },   // 0xD2
+  {  2658,  13,  16,  14,    0,  -15 },   // 0xD3
+  {  2679,  13,  16,  14,    0,  -15 },   // 0xD4
+  {  2700,  13,  16,  14,    0,  -15 },   // 0xD5
+  {  2722,  13,  16,  14,    0,  -15 },   // 0xD6
+  {  2744,  10,  10,  15,    2,  -10 },   // 0xD7
+  {  2756,  15,  13,  14,   -1,  -12 },   // 0xD8
+  {  2780,  12,  16,  13,    1,  -15 },   // 0xD9
+  {  2802,  12,  16,  13,    1,  -15 },   // 0xDA
+  {  2824,  12,  16,  13,    1,  -15 },   // 0xDB
+  {  2847,  12,  16,  13,    1,  -15 },   // 0xDC
+  {  2870,  11,  16,  11,    1,  -15 },   // 0xDD
+  {  2889,  10,  13,  11,    0,  -12 },   // 0xDE
+  {  2905,  10,  14,  11,    0,  -13 },   // 0xDF
+  {  2925,   9,  14,  10,    1,  -13 },   // 0xE0
+  {  2941,  10,  14,  10,    1,  -13 },   // 0xE1
+  {  2958,   9,  14,  10,    1,  -13 },   // 0xE2
+  {  2975,   9,  14,  10,    1,  -13 },   // 0xE3
+  {  2992,   9,  14,  10,    1,  -13 },   // 0xE4
+  {  3009,   9,  16,  10,    1,  -15 },   // 0xE5
+  {  3028,  16,  10,  18,    1,   -9 },   // 0xE6
+  {  3045,   9,  13,  10,    1,   -9 },   // 0xE7
+  {  3059,  10,  14,  11,    1,  -13 },   // 0xE8
+  {  3073,  10,  14,  11,    1,  -13 },   // 0xE9
+  {  3087,  10,  14,  11,    1,  -13 },   // 0xEA
+  {  3102,  10,  14,  11,    1,  -13 },   // 0xEB
+  {  3116,   4,  14,   5,    1,  -13 },   // 0xEC
+  {  3126,   7,  14,   5,    1,  -13 },   // 0xED
+  {  3137,   6,  14,   5,    1,  -13 },   // 0xEE
+  {  3149,   5,  14,   5,    1,  -13 },   // 0xEF
+  {  3160,   9,  14,  11,    1,  -13 },   // 0xF0
+  {  3175,  10,  14,  11,    1,  -13 },   // 0xF1
+  {  3193,  10,  14,  11,    1,  -13 },   // 0xF2
+  {  3208,  10,  14,  11,    1,  -13 },   // 0xF3
+  {  3223,  10,  14,  11,    1,  -13 },   // 0xF4
+  {  3238,  10,  14,  11,    1,  -13 },   // 0xF5
+  {  3253,  10,  14,  11,    1,  -13 },   // 0xF6
+  {  3268,  12,   8,  15,    2,   -9 },   // 0xF7
+  {  3276,  11,  12,  11,    0,  -10 },   // 0xF8
+  {  3294,  10,  14,  11,    1,  -13 },   // 0xF9
+  {  3312,  10,  14,  11,    1,  -13 },   // 0xFA
+  {  3330,  10,  14,  11,    1,  -13 },   // 0xFB
+  {  3348,  10,  14,  11,    1,  -13 },   // 0xFC
+  {  3366,  12,  18,  11,    0,  -13 },   // 0xFD
+  {  3389,  11,  18,  12,    0,  -13 },   // 0xFE
+  {  3413,  12,  18,  11,    0,  -13 }    // 0xFF
+};
+
+const RleFont DejaVuSans_Oblique9pt8bRle = {
+  DejaVuSans_Oblique9pt8bRleRuns, DejaVuSans_Oblique9pt8bRleGlyphs, sizeof(DejaVuSans_Oblique9pt8bRleRuns), 0x20, 0xFF, 21 };
+#endif // DEJAVUSANS_OBLIQUE9PT8B_RLE_H
@@ -0,0 +1,914 @@
+/**
+ * Rendu plein écran du compte à rebours - partagé firmware / natif
+ *
+ * Inclus par examples/fullscreen_countdown_web.cpp et par le banc de mesure
+ * natif (examples/native_render_bench.cpp). Le programme qui inclut ce
+ * fichier doit au préalable :
+ *  - définir TOTAL_WIDTH / TOTAL_HEIGHT (#define : TOTAL_HEIGHT borne les
+ *    tailles de police compilées, voir fonts/DejaVuFontFamily.h) et l'objet
+ *    `PxMATRIX display` (compilé avec PxMATRIX_double_buffer), ou un
+ *    FrameMirror (src/FrameSnapshot.h) pour l'aperçu web /frame ;
+ *  - inclure ColorGamma.h (color565Corrected), FontMetrics.h, FontFamily.h,
+ *    GlyphSpans.h, GlyphRun.h et TextLayoutCache.h ;
+ *  - fournir waitFrameSwap() et presentFrame() (bascule du double buffer).
+ */
+#ifndef FULLSCREENCOUNTDOWNRENDER_H
+#define FULLSCREENCOUNTDOWNRENDER_H
+
+// Polices DejaVu avec support Latin-1 complet (accents et caractères spéciaux)
+#include "DejaVuSans9ptLat1.h"      // Normal
+#include "DejaVuSansBold9ptLat1.h"  // Gras
+#include "DejaVuSansOblique9ptLat1.h" // Italique
+// Tailles natives 6-22 pt par style (src/FontFamily.h), limitées à la hauteur du panneau
+#include "fonts/DejaVuFontFamily.h"
+
+// Texte retenu en 9 pt tracé avec la police anti-aliasée du même style
+// (src/AaFont.h) : 4 ou 2 bits de couverture, 0 = tracé 1 bpp seulement.
+#ifndef COUNTDOWN_AA_BPP
+  #define COUNTDOWN_AA_BPP 4
+#endif
+#include "AaFont.h"
+#if COUNTDOWN_AA_BPP == 2
+  #include "DejaVuSans9ptLat1Aa2.h"
+  #include "DejaVuSansBold9ptLat1Aa2.h"
+  #include "DejaVuSansOblique9ptLat1Aa2.h"
+  #define COUNTDOWN_AA(name, part) name##Aa2##part
+#elif COUNTDOWN_AA_BPP
+  #include "DejaVuSans9ptLat1Aa4.h"
+  #include "DejaVuSansBold9ptLat1Aa4.h"
+  #include "DejaVuSansOblique9ptLat1Aa4.h"
+  #define COUNTDOWN_AA(name, part) name##Aa4##part
+#endif
+
+// Double buffer : le rendu dessine librement dans le buffer arrière puis
+// demande la bascule (frameSwapPending). L'ISR de rafraîchissement l'applique
+// juste avant de balayer la ligne 0, jamais au milieu d'un balayage, ce qui
+// évite le tearing et toute section critique longue côté rendu.
+volatile bool frameSwapPending = false;
+void waitFrameSwap();  // attend que la trame précédente soit affichée
+void presentFrame();   // publie le buffer arrière
+
+// Couleurs prédéfinies
+uint16_t myRED      = color565Corrected(255, 0, 0);
+uint16_t myGREEN    = color565Corrected(0, 255, 0);
+uint16_t myBLUE     = color565Corrected(0, 0, 255);
+uint16_t myYELLOW   = color565Corrected(255, 255, 0);
+uint16_t myCYAN     = color565Corrected(0, 255, 255);
+uint16_t myMAGENTA  = color565Corrected(255, 0, 255);
+uint16_t myWHITE    = color565Corrected(255, 255, 255);
+uint16_t myBLACK    = color565Corrected(0, 0, 0);
+uint16_t myORANGE   = color565Corrected(255, 165, 0);
+
+// Reconversion des couleurs prédéfinies après un changement de niveau gamma
+// (colorGammaApplyBrightness)
+void refreshPalette() {
+  myRED     = color565Corrected(255, 0, 0);
+  myGREEN   = color565Corrected(0, 255, 0);
+  myBLUE    = color565Corrected(0, 0, 255);
+  myYELLOW  = color565Corrected(255, 255, 0);
+  myCYAN    = color565Corrected(0, 255, 255);
+  myMAGENTA = color565Corrected(255, 0, 255);
+  myWHITE   = color565Corrected(255, 255, 255);
+  myBLACK   = color565Corrected(0, 0, 0);
+  myORANGE  = color565Corrected(255, 165, 0);
+}
+
+
+// Etat du countdown (mis à jour par CountdownTask / updateCountdown)
+bool countdownExpired = false;
+bool blinkLastSeconds = false;  // Clignotement pour les 10 dernières secondes
+bool blinkState = true;
+unsigned long lastBlinkTime = 0;
+// Paramètres de clignotement configurables (pour les 10 dernières secondes)
+bool blinkEnabled = true;       // 1 = clignote sur la fin du compte à rebours
+int blinkIntervalMs = 500;      // Intervalle de clignotement en ms (modifiable via Web UI)
+int blinkWindowSeconds = 10;    // Nombre de dernières secondes pendant lesquelles le clignotement est actif
+
+// Marquee (défilement) pour le texte final si trop long
+volatile bool marqueeActive = false; // indicateur global pour la tâche d'affichage
+// Paramètres configurables et état du défilement
+bool marqueeEnabled = true;              // activation auto si texte trop long
+int marqueeIntervalMs = 40;              // intervalle ms entre déplacements (1 px)
+int marqueeGap = 24;                     // espace en pixels avant répétition
+int marqueeMode = 0;                     // 0=Auto (si overflow, scroll gauche), 1=Toujours gauche, 2=Aller-Retour, 3=Une fois
+int marqueeReturnIntervalMs = 60;        // vitesse différente pour le retour (aller-retour)
+int marqueeBouncePauseLeftMs = 400;      // pause extrémité gauche (ms)
+int marqueeBouncePauseRightMs = 400;     // pause extrémité droite (ms)
+int marqueeOneShotDelayMs = 800;         // délai centré avant départ (ms)
+bool marqueeOneShotStopCenter = true;    // recadrer au centre à la fin
+int marqueeOneShotRestartSec = 0;        // redémarrage automatique (0=pas de restart)
+// Accélération progressive
+bool marqueeAccelEnabled = false;
+int marqueeAccelStartIntervalMs = 80;    // intervalle initial
+int marqueeAccelEndIntervalMs = 30;      // intervalle final
+int marqueeAccelDurationMs = 3000;       // durée interpolation sur un cycle (ms)
+static int marqueeTextWidth = 0;         // largeur pixels du texte courant
+static int marqueeOffset = 0;            // position X courante
+static unsigned long lastMarqueeStep = 0; // dernière étape
+static int marqueeDirection = -1;        // pour mode aller-retour
+static bool marqueeOneShotDone = false;  // pour mode une fois
+static bool marqueeInPause = false;      // pause extrémités bounce
+static unsigned long marqueePauseUntil = 0; // fin pause
+static bool marqueeOneShotCenterPhase = false; // phase centrée initiale
+static unsigned long marqueeOneShotStart = 0;  // début phase centrée
+static unsigned long marqueeOneShotRestartAt = 0; // moment de relance
+static unsigned long marqueeCycleStartMs = 0;   // début cycle pour accélération
+// Flag de forçage de recalcul layout (modifié via Web)
+volatile bool forceLayout = false;
+// Padding supplémentaire aux extrémités (espaces visuels entrée/sortie défilement)
+int marqueeEdgePadding = 2; // pixels
+// Bande pré-rendue (1 bpp) du texte défilant : rastérisée une seule fois au
+// changement de layout, puis chaque pas ne recopie qu'une fenêtre TOTAL_WIDTH
+static GFXcanvas1 *marqueeStrip = nullptr;
+static int16_t marqueeStripInkX = 0;      // décalage curseur -> 1re colonne d'encre (x1)
+static int16_t marqueeStripTop = 0;       // ligne écran de la 1re ligne de la bande
+static uint16_t marqueeStripPeriod = 0;   // largeur texte + gap (période de bouclage)
+
+// --- Normalisation accents (UTF-8 -> ASCII approximatif) ---
+// Remplace les caractères accentués français communs par leur équivalent non accentué
+// (glyphRunFold). Objectif: permettre un rendu cohérent avec les polices GFX limitées
+// au Basic ASCII. Les autres caractères non ASCII sont ignorés.
+size_t foldAccents(const char *in, char *out, size_t outSize) {
+  if (!in || !out || outSize == 0) return 0;
+  size_t o = 0;
+  const uint8_t *s = (const uint8_t *)in;
+  while (*s && o + 1 < outSize) {
+    uint32_t code = glyphRunNextCodePoint(s);
+    char rep = (code < 0x80) ? (char)code : glyphRunFold(code);
+    if (rep) out[o++] = rep;
+  }
+  out[o] = '\0';
+  return o;
+}
+
+// Conversion UTF-8 -> Latin-1 (ISO-8859-1). Les caractères hors plage 0x00-0xFF
+// sont remplacés par leur équivalent ASCII (glyphRunSubstitute : ' " - ...) ou '?'.
+// Le rendu plein écran n'en a plus besoin (glyphRunBuild décode directement vers
+// les glyphes) ; gardée pour les journaux et l'API web.
+size_t utf8ToLatin1(const char *in, char *out, size_t outSize) {
+  if (!in || !out || outSize == 0) return 0;
+  size_t o = 0;
+  const uint8_t *s = (const uint8_t *)in;
+  while (*s && o + 1 < outSize) {
+    uint32_t code = glyphRunNextCodePoint(s);
+    if (code <= 0xFF) {
+      out[o++] = (char)code;
+      continue;
+    }
+    const char *r = glyphRunSubstitute(code);
+    if (o + strlen(r) >= outSize) r = "."; // fallback partiel si peu de place
+    while (*r) out[o++] = *r++;
+  }
+  out[o] = '\0';
+  return o;
+}
+
+// Paramètres d'affichage configurables via l'interface web
+char countdownTitle[51] = "COUNTDOWN";
+// Polices DejaVu avec taille automatique et style configurable
+int fontStyle = 0; // 0=Normal, 1=Gras, 2=Italique
+int countdownColorR = 0;
+int countdownColorG = 255;
+int countdownColorB = 0;
+uint16_t countdownColor;
+
+// Paramètres du message de fin
+int endMessageColorR = 255;
+int endMessageColorG = 215;
+int endMessageColorB = 0;
+uint16_t endMessageColor;
+int endMessageEffect = 0; // 0=static, 1=blink, 2=fade, 3=rainbow
+
+// Format d'affichage (0=jours, 1=heures, 2=minutes, 3=secondes uniquement)
+int displayFormat = 0;
+
+// Fonction pour obtenir la largeur du texte
+// Table de largeurs générée avec chaque police DejaVu (nullptr : police sans table)
+const FontMetrics* getFontMetrics(const GFXfont* font) {
+  if (font == &DejaVuSans9ptLat1) return &DejaVuSans9pt8bWidths;
+  if (font == &DejaVuSans_Bold9pt8b) return &DejaVuSans_Bold9pt8bWidths;
+  if (font == &DejaVuSans_Oblique9pt8b) return &DejaVuSans_Oblique9pt8bWidths;
+  const FontFamily *families[] = { &DejaVuSansFamily, &DejaVuSansBoldFamily, &DejaVuSansObliqueFamily };
+  for (const FontFamily *family : families) {
+    for (uint8_t i = 0; i < family->count; i++) {
+      if (family->entries[i].font == font) return family->entries[i].metrics;
+    }
+  }
+  return nullptr;
+}
+
+// Largeur du texte (identique à getTextBounds) sans changer la police courante
+uint16_t getTextWidth(const char* text, const GFXfont* font = NULL, uint8_t size = 1) {
+  if (!font) return fontTextBounds(nullptr, text, size);  // police 5x7 intégrée
+  const FontMetrics *metrics = getFontMetrics(font);
+  if (metrics) return fontTextBounds(metrics, text, size);
+
+  // Police sans table de largeurs : repli sur getTextBounds
+  int16_t x1, y1;
+  uint16_t w, h;
+  display.setFont(font);
+  display.setTextSize(size);
+  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  display.setFont();
+  return w;
+}
+
+// Dessine les deux points du séparateur d'horloge
+void drawColon(int16_t x, int16_t y, uint16_t colonColor) {
+  display.fillRect(x, y, 2, 2, colonColor);
+  display.fillRect(x, y+4, 2, 2, colonColor);
+}
+
+// Libère la bande du marquee (texte non défilant ou changement de layout)
+void releaseMarqueeStrip() {
+  delete marqueeStrip;
+  marqueeStrip = nullptr;
+}
+
+// Rastérise le run une fois (taille 1) dans une bande 1 bpp de largeur w + gap.
+bool prepareMarqueeStrip(const GlyphRun &run, const GFXfont *font, int gap) {
+  releaseMarqueeStrip();
+  if (run.w == 0 || run.h == 0) return false;
+  marqueeStrip = new GFXcanvas1(run.w + gap, run.h);
+  if (marqueeStrip == nullptr || marqueeStrip->getBuffer() == nullptr) {
+    releaseMarqueeStrip(); // mémoire insuffisante : rendu direct des glyphes
+    return false;
+  }
+  marqueeStrip->setFont(font);
+  int16_t x = -run.x1; // encre alignée sur (0,0)
+  for (uint8_t i = 0; i < run.length; i++) {
+    marqueeStrip->drawChar(x, -run.y1, font->first + run.glyph[i], 1, 1, 1, 1);
+    x += font->glyph[run.glyph[i]].xAdvance;
+  }
+  marqueeStripInkX = run.x1;
+  marqueeStripPeriod = run.w + gap;
+  return true;
+}
+
+// Recopie la fenêtre visible de la bande pour un curseur en cursorX.
+// repeat : seconde copie après le gap (mode continu), par bouclage modulo période.
+void blitMarqueeStrip(int16_t cursorX, bool repeat, uint16_t color) {
+  const uint8_t *buf = marqueeStrip->getBuffer();
+  const uint16_t stride = (marqueeStrip->width() + 7) / 8;
+  const int32_t start = cursorX + marqueeStripInkX;
+  const int32_t span = repeat ? 2 * (int32_t)marqueeStripPeriod : marqueeStripPeriod;
+  int16_t xFrom = start < 0 ? 0 : start;
+  int32_t xTo = start + span; if (xTo > TOTAL_WIDTH) xTo = TOTAL_WIDTH;
+  for (int16_t row = 0; row < marqueeStrip->height(); row++) {
+    int16_t y = marqueeStripTop + row;
+    if (y < 0 || y >= TOTAL_HEIGHT) continue;
+    const uint8_t *line = buf + row * stride;
+    for (int16_t x = xFrom; x < xTo; x++) {
+      uint16_t col = (uint16_t)((x - start) % marqueeStripPeriod);
+      if (line[col >> 3] & (0x80 >> (col & 7))) display.drawPixel(x, y, color);
+    }
+  }
+}
+
+#if COUNTDOWN_AA_BPP
+// Police AA d'une taille 9 pt 1 bpp ; metrics expose ses glyphes comme un
+// GFXfont pour la mesure (GlyphRun.h, TextLayoutCache.h, mise en page
+// tabulaire) : métriques proches mais pas identiques à celles du 1 bpp.
+struct CountdownAaFace {
+  const GFXfont *mono;
+  const AaFont *aa;
+  GFXfont metrics;
+};
+#define COUNTDOWN_AA_FACE(name) \
+  { &name, &COUNTDOWN_AA(name, ), { (uint8_t *)COUNTDOWN_AA(name, Bitmaps), (GFXglyph *)COUNTDOWN_AA(name, Glyphs), \
+    COUNTDOWN_AA(name, ).first, COUNTDOWN_AA(name, ).last, COUNTDOWN_AA(name, ).yAdvance } }
+static const CountdownAaFace countdownAaFaces[] = {
+  COUNTDOWN_AA_FACE(DejaVuSans9pt8b),
+  COUNTDOWN_AA_FACE(DejaVuSans_Bold9pt8b),
+  COUNTDOWN_AA_FACE(DejaVuSans_Oblique9pt8b),
+};
+
+// Face AA de la police 1 bpp retenue, nullptr si elle n'en a pas
+const CountdownAaFace *countdownAaFace(const GFXfont *mono) {
+  for (const CountdownAaFace &f : countdownAaFaces) {
+    if (f.mono == mono) return &f;
+  }
+  return nullptr;
+}
+
+// Rampe de la couleur sur fond noir, reconstruite seulement quand la couleur
+// change (deux emplacements : texte et effacement d'une cellule tabulaire)
+const AaRamp &countdownAaRamp(uint16_t color) {
+  static AaRamp ramps[2];
+  static bool built[2] = { false, false };
+  static uint8_t next = 0;
+  for (uint8_t i = 0; i < 2; i++) {
+    if (built[i] && ramps[i].fg == color) return ramps[i];
+  }
+  AaRamp &ramp = ramps[next];
+  aaRampBuild(ramp, color, myBLACK, COUNTDOWN_AA_BPP);
+  built[next] = true;
+  next ^= 1;
+  return ramp;
+}
+#endif
+
+// Trace un run de glyphes : police AA si retenue (aa), sinon plages 1 bpp
+void drawCountdownRun(int16_t x, int16_t y, const GlyphRun &run, const GFXfont *font,
+                      const AaFont *aa, uint16_t color) {
+#if COUNTDOWN_AA_BPP
+  if (aa) {
+    aaDrawGlyphs(display, x, y, run.glyph, run.length, *aa, countdownAaRamp(color));
+    return;
+  }
+#else
+  (void)aa;
+#endif
+  glyphRunDraw(display, x, y, run, font, color);
+}
+
+// Layouts du titre (une entrée par taille essayée) et du compte à rebours
+// proportionnel (compteurs exposés par /layout)
+TextLayoutCache countdownLayouts;
+
+// Famille de tailles selon le style choisi (Normal, Gras, Italique)
+const FontFamily& getFontFamily() {
+  switch (fontStyle) {
+    case 1: return DejaVuSansBoldFamily;    // Gras
+    case 2: return DejaVuSansObliqueFamily; // Italique
+    default: return DejaVuSansFamily;       // Normal (défaut)
+  }
+}
+
+// Police ajustée au texte : plus grande taille native de la famille qui tient
+// dans le panneau (recherche dichotomique sur les tables de largeurs, sans
+// rendu d'essai), tracée en taille GFX 1. Trop large même en 6 pt : plus
+// grande taille qui tient en hauteur, le marquee prend le relais.
+const GFXfont* fitFontToText(const char* text) {
+  return fontFamilyFitBox(getFontFamily(), text, TOTAL_WIDTH, TOTAL_HEIGHT).font;
+}
+
+// Même ajustement pour un texte UTF-8 (titre), chaque taille essayée passant
+// par le cache de layouts : le premier essai décode le texte, les suivants
+// re-mesurent son run, un nouvel ajustement du même titre ne fait que des succès.
+const TextLayout& fitLayoutToText(const char* utf8) {
+  const FontFamily &family = getFontFamily();
+  int i = fontFamilyFit(family, [&](const FontFamilyEntry &e) {
+    const TextLayout &l = textLayoutGet(countdownLayouts, utf8, e.font, 1);
+    return l.h <= TOTAL_HEIGHT && l.w <= TOTAL_WIDTH;
+  });
+  if (i < 0) {
+    i = fontFamilyFit(family, [&](const FontFamilyEntry &e) {
+      return textLayoutGet(countdownLayouts, utf8, e.font, 1).h <= TOTAL_HEIGHT;
+    });
+  }
+  return textLayoutGet(countdownLayouts, utf8, family.entries[i < 0 ? 0 : i].font, 1);
+}
+
+// Chiffres tabulaires : pendant le compte à rebours chaque chiffre occupe une
+// cellule de la largeur du chiffre le plus large (glyphe centré dedans). La
+// mise en page ne dépend plus que du format (chiffres remplacés par '0') :
+// calculée une fois par format, sans getTextBounds ni recentrage à chaque
+// seconde, et le texte ne "tremble" plus quand un chiffre change. Seules les
+// cellules dont le chiffre a changé sont réécrites (ancien chiffre tracé en
+// noir, puis le nouveau).
+// 0 = ancien rendu proportionnel recentré à chaque changement de texte.
+#ifndef COUNTDOWN_TABULAR_DIGITS
+  #define COUNTDOWN_TABULAR_DIGITS 1
+#endif
+
+#if COUNTDOWN_TABULAR_DIGITS
+#define TABULAR_MAX_CHARS 16
+
+struct TabularLayout {
+  bool valid;             // calculée pour shape / family
+  bool usable;            // false : rendu proportionnel pour cette forme
+  char shape[TABULAR_MAX_CHARS + 1]; // texte avec chiffres remplacés par '0'
+  const FontFamily *family;
+  const GFXfont *font;    // taille de la famille retenue
+  uint8_t size;
+  bool isolated;          // encres contenues dans leurs cellules : mise à jour par cellule possible
+  int16_t originX;        // curseur du premier caractère
+  int16_t baseline;       // ligne de base commune
+  int16_t digitAdvance;   // largeur d'une cellule de chiffre (pixels)
+  int16_t cellX[TABULAR_MAX_CHARS];
+  const AaFont *aa;       // police AA (font = ses métriques), nullptr : tracé 1 bpp
+};
+static TabularLayout tabularLayout = {};
+// Contenu des deux buffers (double buffer : on dessine dans celui d'il y a 2 trames)
+static char tabularDrawn[2][TABULAR_MAX_CHARS + 1];
+static uint16_t tabularDrawnColor[2];
+static bool tabularDrawnValid[2] = { false, false };
+static uint8_t tabularBackBuffer = 0;
+static bool tabularShown = false;   // dernière trame tracée en mode tabulaire
+
+// Cellule de chiffre : décalage du glyphe pour le centrer dans la cellule
+inline int16_t tabularDigitShift(const GFXfont *font, uint8_t digit, int16_t maxAdvance) {
+  return (maxAdvance - font->glyph['0' + digit - font->first].xAdvance) / 2;
+}
+
+// Calcule la mise en page tabulaire de text ; false si le texte ne s'y prête
+// pas (trop long, caractère hors police, dépasse l'écran ou marquee requis)
+bool computeTabularLayout(const char *text, const GFXfont *font, uint8_t size) {
+  TabularLayout &l = tabularLayout;
+  size_t len = strlen(text);
+  if (len == 0 || len > TABULAR_MAX_CHARS || '0' < font->first || '9' > font->last) return false;
+  for (size_t i = 0; i <= len; i++) l.shape[i] = (text[i] >= '0' && text[i] <= '9') ? '0' : text[i];
+  l.font = font;
+  l.valid = true;
+
+  int16_t maxAdvance = 0;
+  for (uint8_t d = 0; d <= 9; d++) {
+    int16_t a = font->glyph['0' + d - font->first].xAdvance;
+    if (a > maxAdvance) maxAdvance = a;
+  }
+  // Encre de la cellule de chiffre (union des 10 chiffres), unités de police
+  int16_t digitL = 0x7FFF, digitR = -0x7FFF, top = 0x7FFF, bottom = -0x7FFF;
+  for (uint8_t d = 0; d <= 9; d++) {
+    const GFXglyph &g = font->glyph['0' + d - font->first];
+    int16_t shift = tabularDigitShift(font, d, maxAdvance);
+    if (shift + g.xOffset < digitL) digitL = shift + g.xOffset;
+    if (shift + g.xOffset + g.width > digitR) digitR = shift + g.xOffset + g.width;
+    if (g.yOffset < top) top = g.yOffset;
+    if (g.yOffset + g.height > bottom) bottom = g.yOffset + g.height;
+  }
+
+  l.isolated = (digitL >= 0 && digitR <= maxAdvance);
+  int16_t cursor = 0, minX = 0x7FFF, maxX = -0x7FFF;
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = (uint8_t)text[i];
+    bool digit = (c >= '0' && c <= '9');
+    if (c < font->first || c > font->last) return false;
+    const GFXglyph &g = font->glyph[c - font->first];
+    int16_t left, right, advance;
+    if (digit) {
+      left = digitL; right = digitR; advance = maxAdvance;
+    } else {
+      left = g.xOffset; right = g.xOffset + g.width; advance = g.xAdvance;
+      if (g.width > 0 && (left < 0 || right > advance)) l.isolated = false;
+      if (g.width > 0 && g.yOffset < top) top = g.yOffset;
+      if (g.width > 0 && g.yOffset + g.height > bottom) bottom = g.yOffset + g.height;
+    }
+    l.cellX[i] = cursor;
+    if (right > left) {
+      if (cursor + left * size < minX) minX = cursor + left * size;
+      if (cursor + right * size > maxX) maxX = cursor + right * size;
+    }
+    cursor += advance * size;
+  }
+  if (maxX <= minX) return false;
+
+  int16_t w = maxX - minX;
+  // Mêmes règles que le rendu proportionnel : au-delà de l'écran (ou mode
+  // "toujours défiler") le marquee reprend la main
+  if (marqueeEnabled && (marqueeMode == 1 || w > TOTAL_WIDTH)) return false;
+  if (w > TOTAL_WIDTH) return false;
+
+  l.size = size;
+  l.digitAdvance = maxAdvance * size;
+  l.originX = (TOTAL_WIDTH - w) / 2 - minX;
+  l.baseline = (TOTAL_HEIGHT - (bottom - top) * size) / 2 - top * size;
+  tabularDrawnValid[0] = tabularDrawnValid[1] = false;
+  return true;
+}
+
+// Trace le caractère i du texte dans sa cellule
+void drawTabularChar(const char *text, size_t i, uint16_t color) {
+  const TabularLayout &l = tabularLayout;
+  char one[2] = { text[i], '\0' };
+  int16_t x = l.originX + l.cellX[i];
+  if (text[i] >= '0' && text[i] <= '9') {
+    x += tabularDigitShift(l.font, text[i] - '0', l.digitAdvance / l.size) * l.size;
+  }
+#if COUNTDOWN_AA_BPP
+  if (l.aa) {
+    aaDrawChar(display, x, l.baseline, (unsigned char)text[i], *l.aa, countdownAaRamp(color));
+    return;
+  }
+#endif
+  glyphSpanPrint(display, x, l.baseline, one, l.font, l.size, color);
+}
+
+// Compte à rebours en chiffres tabulaires ; false si le rendu proportionnel
+// doit être utilisé (voir computeTabularLayout)
+bool displayTabularCountdown(const char *text, uint16_t color) {
+  TabularLayout &l = tabularLayout;
+  const FontFamily &family = getFontFamily();
+  size_t len = strlen(text);
+
+  // Forme du texte (chiffres -> '0') : la mise en page ne change qu'avec elle
+  bool sameShape = l.valid && !forceLayout && l.family == &family && len <= TABULAR_MAX_CHARS;
+  for (size_t i = 0; sameShape && i <= len; i++) {
+    char c = (text[i] >= '0' && text[i] <= '9') ? '0' : text[i];
+    sameShape = (c == l.shape[i]);
+  }
+  if (!sameShape) {
+    l.valid = false;
+    // Plus grande taille dont les cellules tiennent dans le panneau
+    int best = fontFamilyFit(family, [&](const FontFamilyEntry &e) {
+      return fontTextHeight(e.font, text) <= TOTAL_HEIGHT && computeTabularLayout(text, e.font, 1);
+    });
+    l.usable = best >= 0 && computeTabularLayout(text, family.entries[best].font, 1);
+    l.aa = nullptr;
+#if COUNTDOWN_AA_BPP
+    // 9 pt : mêmes cellules recalculées sur les métriques AA, sinon 1 bpp
+    const CountdownAaFace *face = l.usable ? countdownAaFace(family.entries[best].font) : nullptr;
+    if (face && fontTextHeight(&face->metrics, text) <= TOTAL_HEIGHT &&
+        computeTabularLayout(text, &face->metrics, 1)) {
+      l.aa = face->aa;
+    } else if (face) {
+      computeTabularLayout(text, family.entries[best].font, 1);
+    }
+#endif
+    l.family = &family;
+    if (l.usable) {
+      forceLayout = false;
+      marqueeActive = false;
+      releaseMarqueeStrip();
+    }
+  }
+  if (!l.usable) return false;
+
+  waitFrameSwap();
+  const uint8_t b = tabularBackBuffer;
+  if (!tabularDrawnValid[b] || tabularDrawnColor[b] != color || !l.isolated) {
+    display.clearDisplay();
+    for (size_t i = 0; i < len; i++) drawTabularChar(text, i, color);
+  } else {
+    for (size_t i = 0; i < len; i++) {
+      if (text[i] == tabularDrawn[b][i]) continue;
+      drawTabularChar(tabularDrawn[b], i, myBLACK);  // efface l'ancien chiffre (seul dans sa cellule)
+      drawTabularChar(text, i, color);
+    }
+  }
+  memcpy(tabularDrawn[b], text, len + 1);
+  tabularDrawnColor[b] = color;
+  tabularDrawnValid[b] = true;
+  tabularBackBuffer = b ^ 1;
+  tabularShown = true;
+  presentFrame();
+  return true;
+}
+#endif
+
+// Affichage du compte à rebours en plein écran
+void displayFullscreenCountdown(int days, int hours, int minutes, int seconds) {
+  // --- Cache layout ---
+  static char lastText[16] = "";  // dernier texte du compte à rebours (ASCII)
+  static GlyphRun cachedRun;      // glyphes et boîte du texte affiché
+  static bool lastExpired = false;
+  static int16_t cachedX = 0, cachedY = 0;
+  static const GFXfont *cachedFont = nullptr;
+  static const AaFont *cachedAa = nullptr;  // police AA du run (9 pt), nullptr : 1 bpp
+  static bool cachedIsEndMsg = false;
+  static uint16_t cachedTextPixelWidth = 0; // pour calcul marquee
+  static int16_t cachedFontXOffset = 0;     // x1 pour centrage correct
+
+  // Recalculer systématiquement la couleur utilisateur (évite usage d'une valeur obsolète)
+  int localR, localG, localB;
+  uint16_t userColor;
+  
+  if (countdownExpired) {
+    // Utiliser les couleurs du message de fin
+    localR = endMessageColorR;
+    localG = endMessageColorG;
+    localB = endMessageColorB;
+    if (localR < 0) localR = 0;
+    if (localR > 255) localR = 255;
+    if (localG < 0) localG = 0;
+    if (localG > 255) localG = 255;
+    if (localB < 0) localB = 0;
+    if (localB > 255) localB = 255;
+    userColor = color565Corrected(localR, localG, localB);
+  } else {
+    // Utiliser les couleurs du countdown
+    localR = countdownColorR;
+    localG = countdownColorG;
+    localB = countdownColorB;
+    if (localR < 0) localR = 0;
+    if (localR > 255) localR = 255;
+    if (localG < 0) localG = 0;
+    if (localG > 255) localG = 255;
+    if (localB < 0) localB = 0;
+    if (localB > 255) localB = 255;
+    userColor = color565Corrected(localR, localG, localB);
+  }
+
+  // Gestion des effets d'affichage
+  uint16_t displayColor = userColor;
+  
+  if (countdownExpired) {
+    // Effets pour le message de fin
+    unsigned long currentTime = millis();
+    static unsigned long lastEffectTime = 0;
+    static bool effectState = false;
+    static uint8_t rainbowHue = 0;
+    
+    switch (endMessageEffect) {
+      case 1: // Clignotant
+        if (currentTime - lastEffectTime >= 500) {
+          lastEffectTime = currentTime;
+          effectState = !effectState;
+        }
+        displayColor = effectState ? userColor : myBLACK;
+        break;
+        
+      case 2: // Fade in/out
+        {
+          int fadePhase = (currentTime / 50) % 100; // Cycle de 5 secondes
+          if (fadePhase > 50) fadePhase = 100 - fadePhase;
+          float fadeFactor = fadePhase / 50.0f;
+          int fadeR = (int)(localR * fadeFactor);
+          int fadeG = (int)(localG * fadeFactor);
+          int fadeB = (int)(localB * fadeFactor);
+          displayColor = color565Corrected(fadeR, fadeG, fadeB);
+        }
+        break;
+        
+      case 3: // Arc-en-ciel
+        if (currentTime - lastEffectTime >= 100) {
+          lastEffectTime = currentTime;
+          rainbowHue = (rainbowHue + 5) % 360;
+        }
+        {
+          // Conversion HSV vers RGB simple
+          float h = rainbowHue / 60.0f;
+          float s = 1.0f, v = 1.0f;
+          int i = (int)h;
+          float f = h - i;
+          float p = v * (1 - s);
+          float q = v * (1 - s * f);
+          float t = v * (1 - s * (1 - f));
+          float r, g, b;
+          switch (i) {
+            case 0: r = v; g = t; b = p; break;
+            case 1: r = q; g = v; b = p; break;
+            case 2: r = p; g = v; b = t; break;
+            case 3: r = p; g = q; b = v; break;
+            case 4: r = t; g = p; b = v; break;
+            default: r = v; g = p; b = q; break;
+          }
+          displayColor = color565Corrected((int)(r * 255), (int)(g * 255), (int)(b * 255));
+        }
+        break;
+        
+      default: // Statique
+        displayColor = userColor;
+        break;
+    }
+  } else if (blinkEnabled && blinkLastSeconds) {
+    // Clignotement configurable des 10 dernières secondes (si activé)
+    unsigned long currentTime = millis();
+    int localInterval = blinkIntervalMs;
+    if (localInterval < 50) localInterval = 50;       // bornes de sécurité
+    if (localInterval > 5000) localInterval = 5000;
+    if (currentTime - lastBlinkTime >= (unsigned long)localInterval) {
+      lastBlinkTime = currentTime;
+      blinkState = !blinkState;
+    }
+    displayColor = blinkState ? userColor : myBLACK;
+  }
+
+  // Préparer le texte cible. Le titre (UTF-8) n'est décodé qu'au recalcul du
+  // layout : toute modification de countdownTitle lève forceLayout.
+  char currentText[16] = "";
+  if (!countdownExpired) {
+    switch (displayFormat) {
+      case 0:  snprintf(currentText, sizeof(currentText), "%dD %02d:%02d", days, hours, minutes); break;
+      case 1:  snprintf(currentText, sizeof(currentText), "%02d:%02d:%02d", hours, minutes, seconds); break;
+      case 2:  snprintf(currentText, sizeof(currentText), "%02d:%02d", minutes, seconds); break;
+      default: snprintf(currentText, sizeof(currentText), "%02d", seconds); break;
+    }
+  }
+
+#if COUNTDOWN_TABULAR_DIGITS
+  if (!countdownExpired && displayTabularCountdown(currentText, displayColor)) return;
+  // Rendu proportionnel : les buffers ne correspondent plus aux cellules
+  tabularDrawnValid[0] = tabularDrawnValid[1] = false;
+  bool leftTabular = tabularShown;
+  tabularShown = false;
+#else
+  const bool leftTabular = false;
+#endif
+
+  bool needRecalc = forceLayout || leftTabular || countdownExpired != lastExpired ||
+                    (!countdownExpired && strcmp(currentText, lastText) != 0);
+
+  if (needRecalc) {
+    // Taille native de la famille DejaVu ajustée au panneau (pas de zoom GFX),
+    // glyphes choisis et mesurés en un passage (GlyphRun.h), layout en cache
+    // (TextLayoutCache.h)
+    const char *layoutText = countdownExpired ? countdownTitle : currentText;
+    const TextLayout *layout = countdownExpired
+        ? &fitLayoutToText(countdownTitle)
+        : &textLayoutGet(countdownLayouts, currentText, fitFontToText(currentText), 1);
+    const GFXfont *font = layout->font;
+    cachedAa = nullptr;
+#if COUNTDOWN_AA_BPP
+    // 9 pt : run re-mesuré sur les métriques AA s'il tient de la même façon
+    // (en hauteur, et marquee ou non comme en 1 bpp)
+    const CountdownAaFace *face = countdownAaFace(font);
+    if (face) {
+      const bool monoWide = layout->w > TOTAL_WIDTH;
+      const TextLayout &aaLayout = textLayoutGet(countdownLayouts, layoutText, &face->metrics, 1);
+      if (aaLayout.h <= TOTAL_HEIGHT && (aaLayout.w > TOTAL_WIDTH) == monoWide) {
+        cachedAa = face->aa;
+      }
+      layout = cachedAa ? &aaLayout : &textLayoutGet(countdownLayouts, layoutText, font, 1);
+    }
+#else
+    (void)layoutText;
+#endif
+    cachedRun = layout->run; // copie : l'entrée peut être remplacée plus tard
+    display.setFont(font);
+    display.setTextSize(1);
+    cachedFont = font;
+    
+    int16_t x1 = cachedRun.x1, y1 = cachedRun.y1;
+    uint16_t w = cachedRun.w;
+  cachedTextPixelWidth = w; // conserver largeur
+  cachedY = (TOTAL_HEIGHT - cachedRun.h) / 2 - y1;
+  cachedFontXOffset = x1;
+
+    // Décider activation selon le mode
+    marqueeTextWidth = w;
+    marqueeActive = false;
+    marqueeOneShotDone = (marqueeMode == 3) ? marqueeOneShotDone : false; // réinitialiser si changement de texte
+    if (marqueeEnabled) {
+      switch (marqueeMode) {
+        case 0: // Auto (continuous gauche si dépasse)
+          if (w > TOTAL_WIDTH) marqueeActive = true;
+          break;
+        case 1: // Toujours gauche
+          marqueeActive = true;
+          break;
+        case 2: // Aller-Retour seulement si dépasse
+          if (w > TOTAL_WIDTH) marqueeActive = true;
+          break;
+        case 3: // Une seule fois (si dépasse et pas déjà fini)
+          if (w > TOTAL_WIDTH && !marqueeOneShotDone) marqueeActive = true;
+          break;
+      }
+    }
+
+    if (marqueeActive) {
+      marqueeInPause = false;
+      marqueePauseUntil = 0;
+      if (marqueeMode == 2) { // bounce
+    // Démarre avec padding gauche
+    marqueeOffset = marqueeEdgePadding;
+        marqueeDirection = -1;
+        // pause initiale gauche
+        if (marqueeBouncePauseLeftMs > 0) { marqueeInPause = true; marqueePauseUntil = millis() + marqueeBouncePauseLeftMs; }
+      } else if (marqueeMode == 1 || marqueeMode == 0) {
+    marqueeOffset = TOTAL_WIDTH + marqueeEdgePadding; // continuous depuis la droite + padding
+      } else if (marqueeMode == 3) { // one-shot centré d'abord
+        marqueeOneShotCenterPhase = true;
+        marqueeOneShotStart = millis();
+        cachedX = (TOTAL_WIDTH - w) / 2 - x1; // centré
+      }
+      lastMarqueeStep = millis();
+      marqueeCycleStartMs = millis();
+    } else {
+      cachedX = (TOTAL_WIDTH - w) / 2 - x1; // centré
+    }
+
+    // Si texte court (pas de marquee) on définit cachedX, sinon il sera dynamique
+    if (!marqueeActive) {
+      cachedX = (TOTAL_WIDTH - w) / 2 - x1;
+      releaseMarqueeStrip();
+    } else {
+      int localGap = marqueeGap; if (localGap < 4) localGap = 4; if (localGap > 256) localGap = 256;
+      if (cachedAa) {
+        releaseMarqueeStrip(); // bande 1 bpp : le texte AA est tracé à chaque pas
+      } else if (prepareMarqueeStrip(cachedRun, font, localGap)) {
+        marqueeStripTop = cachedY + y1;
+      }
+    }
+  // Conserver le texte du compte à rebours (comparaison à la trame suivante)
+  strncpy(lastText, currentText, sizeof(lastText)-1);
+  lastText[sizeof(lastText)-1] = '\0';
+    lastExpired = countdownExpired;
+    cachedIsEndMsg = countdownExpired;
+  forceLayout = false;
+  } else {
+    display.setFont(cachedFont);
+    display.setTextSize(1);
+  }
+
+  // Gestion de l'avancement du marquee (hors section critique)
+  if (marqueeActive) {
+    unsigned long nowMs = millis();
+    // ONE SHOT: phase centrée -> attendre délai puis lancer scroll
+    if (marqueeMode == 3 && marqueeOneShotCenterPhase) {
+      if (nowMs - marqueeOneShotStart >= (unsigned long)marqueeOneShotDelayMs) {
+        marqueeOneShotCenterPhase = false;
+        marqueeOffset = TOTAL_WIDTH; // début scroll
+        lastMarqueeStep = nowMs;
+        marqueeCycleStartMs = nowMs;
+      } else {
+        // ne rien faire pendant la phase centrée
+      }
+    } else if (marqueeMode == 3 && marqueeOneShotCenterPhase == false && marqueeOneShotDone) {
+      // terminé : si restart demandé
+      if (marqueeOneShotRestartSec > 0 && nowMs >= marqueeOneShotRestartAt && marqueeOneShotRestartAt != 0) {
+        // relance cycle
+        marqueeOneShotDone = false;
+        marqueeOneShotCenterPhase = true;
+        marqueeOneShotStart = nowMs;
+        lastMarqueeStep = nowMs;
+        marqueeCycleStartMs = nowMs;
+      }
+    } else {
+      // BOUNCE: gestion pause
+      if (marqueeMode == 2 && marqueeInPause) {
+        if (nowMs >= marqueePauseUntil) {
+          marqueeInPause = false;
+          lastMarqueeStep = nowMs; // reset timer pour éviter saut
+          marqueeCycleStartMs = nowMs; // nouveau cycle après pause
+        }
+      }
+      int forwardInt = marqueeIntervalMs; if (forwardInt < 5) forwardInt = 5; if (forwardInt > 500) forwardInt = 500;
+      int returnInt = marqueeReturnIntervalMs; if (returnInt < 5) returnInt = 5; if (returnInt > 500) returnInt = 500;
+
+      // Accélération progressive
+      if (marqueeAccelEnabled) {
+        int startI = marqueeAccelStartIntervalMs; if (startI < 5) startI = 5; if (startI > 500) startI = 500;
+        int endI = marqueeAccelEndIntervalMs; if (endI < 5) endI = 5; if (endI > 500) endI = 500;
+        unsigned long elapsed = nowMs - marqueeCycleStartMs;
+        float t = (marqueeAccelDurationMs <= 0) ? 1.0f : (float)elapsed / (float)marqueeAccelDurationMs;
+        if (t > 1.0f) t = 1.0f;
+        int interp = startI + (int)((endI - startI) * t);
+        // Pour bounce: appliquer sur direction actuelle (séparément pour retour si différent)
+        if (marqueeMode == 2) {
+          if (marqueeDirection == -1) forwardInt = interp; else returnInt = interp; // direction -1 = vers gauche (forward logique), 1 = retour
+        } else if (marqueeMode == 0 || marqueeMode == 1 || marqueeMode == 3) {
+          forwardInt = interp;
+        }
+      }
+      int effectiveInt = forwardInt;
+      if (marqueeMode == 2 && marqueeDirection == 1) effectiveInt = returnInt; // retour
+      if (!marqueeInPause && nowMs - lastMarqueeStep >= (unsigned long)effectiveInt) {
+        lastMarqueeStep = nowMs;
+        if (marqueeMode == 2) { // bounce
+          marqueeOffset += marqueeDirection; // -1 gauche, +1 droite
+          int minX = TOTAL_WIDTH - marqueeTextWidth - marqueeEdgePadding; // borne gauche avec padding
+          if (marqueeOffset <= minX) { marqueeOffset = minX; marqueeDirection = 1; if (marqueeBouncePauseRightMs>0){ marqueeInPause=true; marqueePauseUntil=nowMs+marqueeBouncePauseRightMs; } marqueeCycleStartMs = nowMs; }
+          if (marqueeOffset >= marqueeEdgePadding) { marqueeOffset = marqueeEdgePadding; marqueeDirection = -1; if (marqueeBouncePauseLeftMs>0){ marqueeInPause=true; marqueePauseUntil=nowMs+marqueeBouncePauseLeftMs; } marqueeCycleStartMs = nowMs; }
+        } else if (marqueeMode == 3) { // one-shot scrolling phase
+          if (!marqueeOneShotDone && !marqueeOneShotCenterPhase) {
+            marqueeOffset--; // vers la gauche
+            if (marqueeOffset + marqueeTextWidth < 0) {
+              marqueeActive = false; marqueeOneShotDone = true;
+              if (marqueeOneShotStopCenter) {
+                // recadrer avec correction x1
+                cachedX = (TOTAL_WIDTH - marqueeTextWidth) / 2 - cachedFontXOffset;
+              }
+              if (marqueeOneShotRestartSec > 0) {
+                marqueeOneShotRestartAt = nowMs + (unsigned long)marqueeOneShotRestartSec * 1000UL;
+              }
+            }
+          }
+        } else { // continuous modes
+          marqueeOffset--;
+          int localGap = marqueeGap; if (localGap < 4) localGap = 4; if (localGap > 256) localGap = 256;
+          if (marqueeOffset + marqueeTextWidth < 0) {
+            marqueeOffset = TOTAL_WIDTH + localGap + marqueeEdgePadding; // boucle avec padding
+            marqueeCycleStartMs = nowMs; // nouveau cycle -> reset accel
+          }
+        }
+      }
+    }
+  }
+
+  // Le buffer arrière ne doit pas être réécrit tant que l'ISR n'a pas
+  // basculé sur la trame précédente
+  waitFrameSwap();
+  display.clearDisplay();
+  // Toujours la couleur choisie (même si expiré) conformément à la demande.
+  // Texte tracé par plages depuis le run de glyphes (GlyphRun.h, GlyphSpans.h),
+  // ou par rampe de couleurs en 9 pt (AaFont.h).
+  const GFXfont *textFont = cachedFont;
+  if (marqueeActive) {
+    // Position du curseur selon le mode (seconde copie en mode continu)
+    int drawX = marqueeOffset;
+    int localGap = marqueeGap; if (localGap < 4) localGap = 4; if (localGap > 256) localGap = 256;
+    bool secondCopy = false;
+    if (marqueeMode == 3) { // one-shot
+      if (marqueeOneShotCenterPhase || (marqueeOneShotDone && marqueeOneShotStopCenter)) {
+        drawX = (TOTAL_WIDTH - marqueeTextWidth)/2 - cachedFontXOffset;
+      }
+    } else if (marqueeMode != 2) { // continuous / always
+      secondCopy = (marqueeOffset + marqueeTextWidth + localGap) < TOTAL_WIDTH;
+    }
+    if (marqueeStrip) {
+      blitMarqueeStrip(drawX, secondCopy, displayColor);
+    } else {
+      drawCountdownRun(drawX, cachedY, cachedRun, textFont, cachedAa, displayColor);
+      if (secondCopy) {
+        drawCountdownRun(drawX + marqueeTextWidth + localGap, cachedY, cachedRun,
+                         textFont, cachedAa, displayColor);
+      }
+    }
+  } else {
+    drawCountdownRun(cachedX, cachedY, cachedRun, textFont, cachedAa, displayColor);
+  }
+  presentFrame();
+}
+
+#endif // FULLSCREENCOUNTDOWNRENDER_H
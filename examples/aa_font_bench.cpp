@@ -0,0 +1,192 @@
+/**
+ * Banc natif (PC) des polices anti-aliasées (src/AaFont.h)
+ *
+ * 1. Vérification :
+ *    - rampes de couleurs : niveau 0 = fond, niveau max = texte, canaux
+ *      monotones, pour plusieurs couples texte / fond ;
+ *    - aaDrawChar() == décodage bit à bit de référence (niveau relu dans le
+ *      vert, 6 bits) pour chaque glyphe des polices 2 et 4 bits, en plein
+ *      écran et à cheval sur les quatre bords.
+ * 2. Comparaison avec le tracé 1 bpp (glyphSpanPrint, GlyphSpans.h) : octets
+ *    de glyphes, temps par texte, pixels écrits et pixels de bord (niveaux
+ *    intermédiaires) pour des textes typiques du compte à rebours.
+ *
+ * Lancement : pio run -e native_aa_font_bench -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "GlyphSpans.h"
+#include "AaFont.h"
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#include "DejaVuSansOblique9ptLat1.h"
+#include "DejaVuSans9ptLat1Aa2.h"
+#include "DejaVuSans9ptLat1Aa4.h"
+#include "DejaVuSansBold9ptLat1Aa2.h"
+#include "DejaVuSansBold9ptLat1Aa4.h"
+#include "DejaVuSansOblique9ptLat1Aa2.h"
+#include "DejaVuSansOblique9ptLat1Aa4.h"
+
+struct BenchFont {
+  const char *name;
+  const GFXfont *mono;
+  uint32_t monoBytes;
+  const AaFont *aa2;
+  uint32_t aa2Bytes;
+  const AaFont *aa4;
+  uint32_t aa4Bytes;
+};
+
+static const BenchFont fonts[] = {
+  { "DejaVuSans", &DejaVuSans9ptLat1, sizeof(DejaVuSans9pt8bBitmaps),
+    &DejaVuSans9pt8bAa2, sizeof(DejaVuSans9pt8bAa2Bitmaps), &DejaVuSans9pt8bAa4, sizeof(DejaVuSans9pt8bAa4Bitmaps) },
+  { "DejaVuSans Bold", &DejaVuSans_Bold9pt8b, sizeof(DejaVuSans_Bold9pt8bBitmaps),
+    &DejaVuSans_Bold9pt8bAa2, sizeof(DejaVuSans_Bold9pt8bAa2Bitmaps),
+    &DejaVuSans_Bold9pt8bAa4, sizeof(DejaVuSans_Bold9pt8bAa4Bitmaps) },
+  { "DejaVuSans Oblique", &DejaVuSans_Oblique9pt8b, sizeof(DejaVuSans_Oblique9pt8bBitmaps),
+    &DejaVuSans_Oblique9pt8bAa2, sizeof(DejaVuSans_Oblique9pt8bAa2Bitmaps),
+    &DejaVuSans_Oblique9pt8bAa4, sizeof(DejaVuSans_Oblique9pt8bAa4Bitmaps) },
+};
+
+// 3 panneaux de large comme le firmware par défaut
+#define W 96
+#define H 16
+static PxMATRIX display(W, H, 5, 4, 19, 23, 18);
+static uint16_t expected[W * H];
+
+static int failures = 0;
+
+// Niveau de couverture du pixel (col, row) du glyphe, lecture bit à bit
+static uint8_t refLevel(const AaFont &font, const GFXglyph &g, int16_t col, int16_t row) {
+  uint8_t level = 0;
+  uint32_t bit = ((uint32_t)row * g.width + col) * font.bpp;
+  for (uint8_t k = 0; k < font.bpp; k++, bit++) {
+    level = (level << 1) | ((font.bitmap[g.bitmapOffset + (bit >> 3)] >> (7 - (bit & 7))) & 1);
+  }
+  return level;
+}
+
+static bool checkRamp(uint16_t fg, uint16_t bg, uint8_t bpp) {
+  AaRamp ramp;
+  aaRampBuild(ramp, fg, bg, bpp);
+  const uint8_t top = (1 << bpp) - 1;
+  if (ramp.color[0] != bg || ramp.color[top] != fg) return false;
+  for (uint8_t l = 1; l <= top; l++) {
+    uint16_t a = ramp.color[l - 1], b = ramp.color[l];
+    const int shifts[3] = { 11, 5, 0 };
+    const int masks[3] = { 0x1F, 0x3F, 0x1F };
+    for (int c = 0; c < 3; c++) {
+      int ca = (a >> shifts[c]) & masks[c], cb = (b >> shifts[c]) & masks[c];
+      int cf = (fg >> shifts[c]) & masks[c], cbg = (bg >> shifts[c]) & masks[c];
+      if (cf >= cbg ? cb < ca : cb > ca) return false;
+    }
+  }
+  return true;
+}
+
+static int verifyFont(const char *name, const AaFont &font) {
+  int errors = 0;
+  AaRamp ramp;
+  aaRampBuild(ramp, 0x07E0, 0x0000, font.bpp);   // vert 6 bits : niveaux distincts
+  static const int16_t positions[][2] = { { 40, 12 }, { -3, 12 }, { W - 5, 12 }, { 40, 3 }, { 40, H + 2 } };
+  for (int c = font.first; c <= font.last; c++) {
+    const GFXglyph &g = font.glyph[c - font.first];
+    for (const auto &p : positions) {
+      display.fillScreen(0);
+      memset(expected, 0, sizeof(expected));
+      for (int16_t row = 0; row < g.height; row++) {
+        for (int16_t col = 0; col < g.width; col++) {
+          int16_t x = p[0] + g.xOffset + col, y = p[1] + g.yOffset + row;
+          uint8_t level = refLevel(font, g, col, row);
+          if (level && x >= 0 && x < W && y >= 0 && y < H) expected[y * W + x] = ramp.color[level];
+        }
+      }
+      int16_t advance = aaDrawChar(display, p[0], p[1], (unsigned char)c, font, ramp);
+      if (advance != g.xAdvance || memcmp(display.framebuffer(), expected, sizeof(expected)) != 0) {
+        if (errors < 5) printf("  ECHEC: %s glyphe 0x%02X en (%d,%d)\n", name, c, p[0], p[1]);
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+struct Timing {
+  double ns;
+  double pixels;
+  uint32_t edge;   // pixels de niveau intermédiaire (ni fond ni texte)
+};
+
+template <typename Draw>
+static Timing measure(uint32_t loops, uint16_t color, Draw draw) {
+  display.fillScreen(0);
+  display.resetStats();
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) draw();
+  auto t1 = std::chrono::steady_clock::now();
+  Timing t;
+  t.ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / loops;
+  t.pixels = (double)display.stats().pixelsTouched / loops;
+  t.edge = 0;
+  const uint16_t *fb = display.framebuffer();
+  for (int i = 0; i < W * H; i++) if (fb[i] != 0 && fb[i] != color) t.edge++;
+  return t;
+}
+
+int main() {
+  printf("=== Polices anti-aliasees : verification et comparaison 1 bpp ===\n");
+  static const uint16_t colors[][2] = {
+    { 0xF800, 0x0000 }, { 0x07E0, 0x0000 }, { 0xFFFF, 0x0000 }, { 0x0000, 0xFFFF },
+    { 0x1234, 0xFEDC }, { 0x0841, 0x0000 }, { 0xFD20, 0x001F },
+  };
+  int rampErrors = 0;
+  for (const auto &c : colors) {
+    for (uint8_t bpp = 2; bpp <= 4; bpp += 2) {
+      if (!checkRamp(c[0], c[1], bpp)) {
+        printf("  ECHEC: rampe 0x%04X / 0x%04X %u bits\n", c[0], c[1], bpp);
+        rampErrors++;
+      }
+    }
+  }
+  printf("%-26s %s\n", "rampes (7 couleurs x 2)", rampErrors ? "ECHEC" : "OK");
+  failures += rampErrors;
+
+  for (const BenchFont &f : fonts) {
+    const AaFont *aaFonts[] = { f.aa2, f.aa4 };
+    for (const AaFont *aa : aaFonts) {
+      int e = verifyFont(f.name, *aa);
+      printf("%-20s %u bits %3u glyphes x 5 positions : %s\n", f.name, aa->bpp, aa->last - aa->first + 1,
+             e ? "ECHEC" : "identique a la reference");
+      failures += e;
+    }
+  }
+
+  printf("\n%-20s %12s %12s %12s\n", "police", "1 bpp", "AA 2 bits", "AA 4 bits");
+  for (const BenchFont &f : fonts) {
+    printf("%-20s %10u o %10u o %10u o\n", f.name, f.monoBytes, f.aa2Bytes, f.aa4Bytes);
+  }
+
+  static const char *texts[] = { "12:34:56", "3D 05:59", "BONNE ANNEE 2026 !" };
+  const uint16_t color = 0xFD20;
+  AaRamp ramp2, ramp4;
+  aaRampBuild(ramp2, color, 0x0000, 2);
+  aaRampBuild(ramp4, color, 0x0000, 4);
+  printf("\n%-20s %-20s %8s %8s %8s %8s %8s %8s %6s %6s\n", "police", "texte",
+         "1bpp ns", "AA2 ns", "AA4 ns", "px 1bpp", "px AA2", "px AA4", "bord2", "bord4");
+  for (const BenchFont &f : fonts) {
+    for (const char *text : texts) {
+      Timing a = measure(2000, color, [&]() { glyphSpanPrint(display, 2, 13, text, f.mono, 1, color); });
+      Timing b = measure(2000, color, [&]() { aaDrawText(display, 2, 13, text, *f.aa2, ramp2); });
+      Timing c = measure(2000, color, [&]() { aaDrawText(display, 2, 13, text, *f.aa4, ramp4); });
+      printf("%-20s %-20s %8.0f %8.0f %8.0f %8.1f %8.1f %8.1f %6u %6u\n", f.name, text,
+             a.ns, b.ns, c.ns, a.pixels, b.pixels, c.pixels, b.edge, c.edge);
+    }
+  }
+
+  printf("\n%s (%d ecart(s))\n", failures == 0 ? "SUCCES" : "ECHEC", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/**
+ * Test natif (PC) de l'encodeur de plans de bits BCM
+ * Vérifie src/BitPlaneEncoder.h sans matériel
+ *
+ * Ce test contrôle :
+ * - L'égalité octet par octet entre bcmEncodeFrame() et une référence
+ *   indépendante : l'arithmétique d'index de PxMATRIX::fillMatrixBuffer()
+ *   (2dom/PxMatrix 1.8, ZAGZIG / BINARY) recopiée pixel par pixel, sur des
+ *   trames aléatoires
+ * - Que chaque bit (pixel, couleur, plan) de la référence tombe dans un
+ *   emplacement distinct du buffer, et que tous sont couverts
+ * - Quelques positions connues (coin haut gauche, coin bas droit)
+ * - Le ré-encodage conditionnel (bcmEncodeIfChanged)
+ *
+ * Géométries : 1x1, 2x1, 3x1, 4x1, 6x1, 8x1 et 2x2 panneaux, begin(4),
+ * profondeurs 1 à 8 plans.
+ *
+ * Lancement : pio run -e native_bcm_test -t exec  (code de sortie != 0 si échec)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "BitPlaneEncoder.h"
+#include "NativeCheck.h"
+
+// Référence : index de PxMATRIX::fillMatrixBuffer() pour ZAGZIG, sans
+// rotation ni _flip (noms des membres de la bibliothèque en commentaire).
+// offset : octet dans PxMATRIX_buffer[plan] ; bit : _BV(bit_select).
+struct PxBufferIndex {
+  uint32_t offset[3];  // total_offset_r / _g / _b
+  uint8_t bit;
+};
+
+static PxBufferIndex pxmatrixIndex(const BcmLayout &l, int16_t x, int16_t y) {
+  const uint32_t patternColorBytes = (uint32_t)(l.height / l.rowPattern) * (l.width / 8);  // _pattern_color_bytes
+  const uint32_t sendBufferSize = patternColorBytes * 3;                                   // _send_buffer_size
+  const uint32_t rowOffset = (uint32_t)(y % l.rowPattern) * sendBufferSize + sendBufferSize - 1;  // _row_offset[y]
+  // Panels are naturally flipped
+  x = l.width - 1 - x;
+  const uint32_t baseOffset = rowOffset - (uint32_t)(x / 8) * 2;
+  uint32_t totalOffsetR = 0;
+  uint8_t rowSector = 0;
+  const uint16_t rowSectorOffset = l.width / 4;  // row_sector__offset
+  for (uint16_t yy = 0; yy < l.height; yy += 2 * l.rowPattern) {
+    if (yy <= y && y < yy + l.rowPattern) totalOffsetR = baseOffset - rowSectorOffset * rowSector;
+    if (yy + l.rowPattern <= y && y < yy + 2 * l.rowPattern) totalOffsetR = baseOffset - rowSectorOffset * rowSector - 1;
+    rowSector++;
+  }
+  // ZAGZIG : paire d'octets du bloc échangée
+  if ((y % (2 * l.rowPattern)) < l.rowPattern) totalOffsetR -= 1;
+  else totalOffsetR += 1;
+  PxBufferIndex idx;
+  idx.offset[BCM_RED] = totalOffsetR;
+  idx.offset[BCM_GREEN] = totalOffsetR - patternColorBytes;
+  idx.offset[BCM_BLUE] = totalOffsetR - 2 * patternColorBytes;
+  idx.bit = x % 8;  // bit_select
+  return idx;
+}
+
+// drawPixelRGB565() : canaux 8 bits de la bibliothèque
+static uint8_t pxmatrixChannel(uint16_t color, uint8_t c) {
+  if (c == BCM_RED) return (color >> 8) & 0xF8;
+  if (c == BCM_GREEN) return (color >> 3) & 0xFC;
+  return (color << 3) & 0xF8;
+}
+
+static void referenceEncode(const BcmLayout &l, const uint16_t *fb, std::vector<uint8_t> &out) {
+  out.assign(bcmFrameBytes(l), 0);
+  const uint32_t planeBytes = bcmFrameBytes(l) / l.planes;  // PxMATRIX_buffer[plan]
+  for (uint16_t y = 0; y < l.height; y++) {
+    for (uint16_t x = 0; x < l.width; x++) {
+      const PxBufferIndex idx = pxmatrixIndex(l, x, y);
+      for (uint8_t c = 0; c < 3; c++) {
+        const uint8_t v = pxmatrixChannel(fb[(uint32_t)y * l.width + x], c);
+        for (uint8_t p = 0; p < l.planes; p++) {
+          if ((v >> (p + 8 - l.planes)) & 1) out[p * planeBytes + idx.offset[c]] |= (uint8_t)(1 << idx.bit);
+        }
+      }
+    }
+  }
+}
+
+// Chaque (pixel, couleur) doit occuper un emplacement distinct du buffer
+// d'un plan, et chaque emplacement doit être utilisé
+static void checkCoverage(const BcmLayout &l) {
+  const uint32_t planeBytes = bcmFrameBytes(l) / l.planes;
+  std::vector<uint8_t> seen(planeBytes * 8, 0);
+  for (uint16_t y = 0; y < l.height; y++) {
+    for (uint16_t x = 0; x < l.width; x++) {
+      const PxBufferIndex idx = pxmatrixIndex(l, x, y);
+      for (uint8_t c = 0; c < 3; c++) {
+        CHECK(idx.offset[c] < planeBytes, "(%u,%u) couleur %u hors buffer", x, y, c);
+        if (idx.offset[c] < planeBytes) seen[idx.offset[c] * 8 + idx.bit]++;
+        CHECK(idx.offset[c] / bcmRowBytes(l) == y % l.rowPattern, "ligne %u hors de l'adresse %u", y,
+              y % l.rowPattern);
+      }
+    }
+  }
+  for (uint32_t n = 0; n < seen.size(); n++) {
+    CHECK(seen[n] == 1, "octet %u bit %u utilise %u fois", n / 8, n % 8, seen[n]);
+  }
+}
+
+static void checkKnownPositions(const BcmLayout &l) {
+  std::vector<uint16_t> fb((uint32_t)l.width * l.height, 0);
+  std::vector<uint8_t> out(bcmFrameBytes(l));
+  const uint32_t segBytes = bcmSegmentBytes(l);
+  const uint32_t rowBytes = bcmRowBytes(l);
+
+  // Rouge en (0,0) : adresse 0, segment R, bloc 0 du secteur haut, ligne
+  // haute envoyée en premier dans la paire, MSB
+  fb[0] = 0xF800;
+  bcmEncodeFrame(l, fb.data(), out.data());
+  const uint32_t q = rowBytes - 1 - (uint32_t)(l.width / 8 - 1) * 2 - 1;
+  uint8_t top = 8 - l.planes;
+  for (uint8_t p = 0; p < l.planes; p++) {
+    const uint8_t *row = &out[(uint32_t)p * l.rowPattern * rowBytes];
+    CHECK(row[q] == ((0xF8 >> (top + p)) & 1 ? 0x80 : 0x00), "(0,0) rouge plan %u : 0x%02x", p, row[q]);
+  }
+
+  // Bleu en bas à droite : adresse rowPattern-1, segment B (envoyé en
+  // premier), dernier octet du secteur bas, bit 0
+  fb[0] = 0;
+  fb[(uint32_t)l.height * l.width - 1] = 0x001F;
+  bcmEncodeFrame(l, fb.data(), out.data());
+  const uint8_t *row = &out[((uint32_t)(l.planes - 1) * l.rowPattern + l.rowPattern - 1) * rowBytes];
+  const uint32_t last = segBytes - 1 - (uint32_t)(l.height / (2 * l.rowPattern) - 1) * (l.width / 4);
+  CHECK(row[last] == 0x01, "bas droite bleu : 0x%02x", row[last]);
+  CHECK(bcmMuxAddress(l.rowPattern - 1) == l.rowPattern - 1, "adresse BINARY");
+}
+
+static void checkRandomFrames(const BcmLayout &l, unsigned seed) {
+  std::vector<uint16_t> fb((uint32_t)l.width * l.height);
+  std::vector<uint8_t> out(bcmFrameBytes(l)), ref;
+  srand(seed);
+  for (int frame = 0; frame < 8; frame++) {
+    for (auto &px : fb) px = (uint16_t)((rand() & 0xFF) << 8 | (rand() & 0xFF));
+    CHECK(bcmEncodeFrame(l, fb.data(), out.data()), "geometrie refusee");
+    referenceEncode(l, fb.data(), ref);
+    uint32_t diff = 0;
+    for (uint32_t n = 0; n < out.size(); n++) if (out[n] != ref[n]) diff++;
+    CHECK(diff == 0, "trame %d : %u octets differents de la reference", frame, diff);
+  }
+}
+
+static void checkEncodeIfChanged(const BcmLayout &l) {
+  std::vector<uint16_t> fb((uint32_t)l.width * l.height, 0x07E0);
+  std::vector<uint8_t> out(bcmFrameBytes(l), 0);
+  uint32_t encoded = 0;
+  CHECK(bcmEncodeIfChanged(l, fb.data(), 1, encoded, out.data()), "premiere trame non encodee");
+  CHECK(!bcmEncodeIfChanged(l, fb.data(), 1, encoded, out.data()), "trame inchangee re-encodee");
+  CHECK(bcmEncodeIfChanged(l, fb.data(), 2, encoded, out.data()) && encoded == 2, "nouvelle trame ignoree");
+}
+
+int main() {
+  static const uint8_t panels[][2] = { {1, 1}, {2, 1}, {3, 1}, {4, 1}, {6, 1}, {8, 1}, {2, 2} };
+  printf("=== Test encodeur BCM (ZAGZIG / BINARY) contre fillMatrixBuffer ===\n");
+  for (auto &pn : panels) {
+    for (uint8_t planes = 1; planes <= 8; planes++) {
+      BcmLayout l = { (uint16_t)(32 * pn[0]), (uint16_t)(16 * pn[1]), 4, planes };
+      int before = failures;
+      CHECK(bcmLayoutValid(l), "geometrie %ux%u invalide", l.width, l.height);
+      if (planes == 8) checkCoverage(l);
+      checkKnownPositions(l);
+      checkRandomFrames(l, 1000 * pn[0] + 100 * pn[1] + planes);
+      checkEncodeIfChanged(l);
+      if (planes == 8 || failures != before) {
+        printf("%ux%u panneaux (%ux%u), %u plans, %u octets/trame : %s\n", pn[0], pn[1], l.width, l.height,
+               planes, bcmFrameBytes(l), failures == before ? "OK" : "ECHEC");
+      }
+    }
+  }
+  BcmLayout odd = { 30, 16, 4, 8 };
+  CHECK(!bcmLayoutValid(odd), "largeur non multiple de 8 acceptee");
+
+  return nativeCheckSummary();
+}
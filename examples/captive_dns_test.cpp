@@ -0,0 +1,100 @@
+/**
+ * Test natif (PC) du DNS du portail captif (src/CaptiveDns.h)
+ *
+ * 1. Question A (et ANY) : réponse avec l'adresse du point d'accès, en-tête
+ *    et question recopiés, identifiant conservé, pointeur de nom vers la
+ *    question, TTL CAPTIVE_DNS_TTL.
+ * 2. Autres types (AAAA, HTTPS ...) : réponse NOERROR sans enregistrement.
+ * 3. Paquets ignorés : réponses, opcode != QUERY, 0 ou 2 questions, nom
+ *    tronqué ou compressé, buffer de sortie trop petit.
+ *
+ * Lancement : pio run -e native_captive_dns_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "CaptiveDns.h"
+#include "NativeCheck.h"
+
+static const uint8_t apIp[4] = { 192, 168, 4, 1 };
+
+// Requête standard (RD) pour name, type qtype, classe IN
+static size_t buildQuery(uint8_t *q, uint16_t id, const char *name, uint16_t qtype) {
+  const uint8_t header[12] = { (uint8_t)(id >> 8), (uint8_t)id, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0 };
+  memcpy(q, header, sizeof(header));
+  size_t p = sizeof(header);
+  while (*name) {
+    const char *dot = strchr(name, '.');
+    const size_t n = dot ? (size_t)(dot - name) : strlen(name);
+    q[p++] = (uint8_t)n;
+    memcpy(q + p, name, n);
+    p += n;
+    name += n + (dot ? 1 : 0);
+  }
+  q[p++] = 0;
+  q[p++] = (uint8_t)(qtype >> 8); q[p++] = (uint8_t)qtype;
+  q[p++] = 0; q[p++] = 1;
+  return p;
+}
+
+static uint16_t u16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+
+int main() {
+  printf("=== DNS du portail captif (AsyncUDP) ===\n");
+  uint8_t q[CAPTIVE_DNS_MAX], r[CAPTIVE_DNS_MAX];
+
+  // 1. Questions A et ANY
+  int before = failures;
+  const char *names[] = { "captive.apple.com", "connectivitycheck.gstatic.com", "www.msftconnecttest.com", "a", "" };
+  const uint16_t types[] = { 1, 255 };
+  for (const char *name : names) {
+    for (uint16_t qtype : types) {
+      const size_t len = buildQuery(q, 0xBEEF, name, qtype);
+      const size_t n = captiveDnsAnswer(q, len, apIp, r, sizeof(r));
+      const uint8_t *a = r + len;
+      CHECK(n == len + 16, "%s type %u : %u octets", name, qtype, (unsigned)n);
+      CHECK(u16(r) == 0xBEEF && r[2] == 0x85 && r[3] == 0x80, "%s : en-tete %02X %02X", name, r[2], r[3]);
+      CHECK(u16(r + 4) == 1 && u16(r + 6) == 1 && u16(r + 8) == 0 && u16(r + 10) == 0, "%s : compteurs", name);
+      CHECK(memcmp(r + 12, q + 12, len - 12) == 0, "%s : question differente", name);
+      CHECK(u16(a) == 0xC00C && u16(a + 2) == 1 && u16(a + 4) == 1 && u16(a + 8) == CAPTIVE_DNS_TTL &&
+            u16(a + 10) == 4 && memcmp(a + 12, apIp, 4) == 0, "%s : enregistrement A", name);
+    }
+  }
+  printf("%-34s %s\n", "questions A / ANY -> 192.168.4.1", failures == before ? "OK" : "ECHEC");
+
+  // 2. Autres types : NOERROR sans réponse
+  before = failures;
+  const uint16_t others[] = { 28, 65, 16, 12 };   // AAAA, HTTPS, TXT, PTR
+  for (uint16_t qtype : others) {
+    const size_t len = buildQuery(q, 7, "captive.apple.com", qtype);
+    const size_t n = captiveDnsAnswer(q, len, apIp, r, sizeof(r));
+    CHECK(n == len && (r[3] & 0x0F) == 0 && u16(r + 6) == 0, "type %u : %u octets, ANCOUNT %u", qtype, (unsigned)n,
+          u16(r + 6));
+  }
+  printf("%-34s %s\n", "autres types -> aucune reponse A", failures == before ? "OK" : "ECHEC");
+
+  // 3. Paquets ignorés
+  before = failures;
+  size_t len = buildQuery(q, 1, "captive.apple.com", 1);
+  CHECK(captiveDnsAnswer(q, 11, apIp, r, sizeof(r)) == 0, "en-tete tronque");
+  CHECK(captiveDnsAnswer(q, len - 1, apIp, r, sizeof(r)) == 0, "question tronquee");
+  CHECK(captiveDnsAnswer(q, len, apIp, r, len + 15) == 0, "sortie trop petite");
+  q[2] = 0x81;
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "reponse (QR) acceptee");
+  q[2] = 0x29;                                          // opcode UPDATE
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "opcode UPDATE accepte");
+  q[2] = 0x01;
+  q[5] = 2;
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "2 questions acceptees");
+  q[5] = 0;
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "0 question acceptee");
+  q[5] = 1;
+  q[12] = 0xC0;
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "nom compresse accepte");
+  q[12] = 60;                                           // label qui dépasse le paquet
+  CHECK(captiveDnsAnswer(q, len, apIp, r, sizeof(r)) == 0, "label hors paquet accepte");
+  printf("%-34s %s\n", "paquets invalides ignores", failures == before ? "OK" : "ECHEC");
+
+  return nativeCheckSummary();
+}
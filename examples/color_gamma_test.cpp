@@ -0,0 +1,139 @@
+/**
+ * Test natif (PC) des tables gamma générées à la compilation (src/ColorGamma.h)
+ *
+ * 1. Courbes 16 bits : bornes (0 -> 0, 255 -> 65535), croissance, aucune
+ *    valeur nulle hors 0, écart à pow() (double) de la bibliothèque C.
+ * 2. Tables RGB565 au niveau 255 : bornes par canal (31 / 63 / 31 pas),
+ *    croissance, composante non nulle toujours allumée.
+ * 3. Niveaux : pour chaque niveau, pleine échelle == niveau x maximum du
+ *    canal (arrondi), tables croissantes, jamais au-dessus du niveau
+ *    supérieur ; niveau 0 éteint tout ; retour à 255 == tables d'origine.
+ * 4. colorGammaApplyBrightness : part PxMatrix x niveau / 255 == réglage
+ *    (à un pas près) pour 0..255, croissant, PxMatrix jamais sous
+ *    COLOR_BRIGHTNESS_HW_MIN.
+ *
+ * Lancement : pio run -e native_color_gamma_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "ColorGamma.h"
+#include "NativeCheck.h"
+
+struct Channel {
+  const char *name;
+  const uint16_t *curve;
+  const uint16_t *lut;
+  double gamma;
+  int bits;
+  int shift;
+};
+
+static const Channel channels[3] = {
+  { "R", ColorGamma::curveR, ColorGamma::lutR, COLOR_GAMMA_R, 5, 11 },
+  { "G", ColorGamma::curveG, ColorGamma::lutG, COLOR_GAMMA_G, 6, 5 },
+  { "B", ColorGamma::curveB, ColorGamma::lutB, COLOR_GAMMA_B, 5, 0 },
+};
+
+// Pas du canal (0..31 ou 0..63) d'une entrée de table
+static int steps(const Channel &c, int i) {
+  return (c.lut[i] >> c.shift) & ((1 << c.bits) - 1);
+}
+
+int main() {
+  printf("Tables gamma (gamma R %.2f G %.2f B %.2f)\n\n",
+         (double)COLOR_GAMMA_R, (double)COLOR_GAMMA_G, (double)COLOR_GAMMA_B);
+
+  // 1. Courbes 16 bits
+  int before = failures;
+  double worst = 0.0;
+  for (const Channel &c : channels) {
+    CHECK(c.curve[0] == 0, "%s : courbe[0] = %u", c.name, c.curve[0]);
+    CHECK(c.curve[255] == 65535, "%s : courbe[255] = %u", c.name, c.curve[255]);
+    for (int i = 1; i < 256; i++) {
+      CHECK(c.curve[i] >= c.curve[i - 1], "%s : courbe decroissante en %d", c.name, i);
+      CHECK(c.curve[i] > 0, "%s : courbe[%d] nulle", c.name, i);
+      double ref = pow(i / 255.0, c.gamma) * 65535.0;
+      double err = fabs(c.curve[i] - ref);
+      if (ref < 1.0) err = c.curve[i] == 1 ? 0.0 : err;  // plancher à 1
+      if (err > worst) worst = err;
+      CHECK(err <= 1.0, "%s : courbe[%d] = %u, pow = %.2f", c.name, i, c.curve[i], ref);
+    }
+  }
+  printf("%-34s %s (ecart max a pow %.3f / 65535)\n", "courbes 16 bits", failures == before ? "OK" : "ECHEC", worst);
+
+  // 2. Tables RGB565 au niveau 255
+  before = failures;
+  CHECK(colorGammaLevel() == 255, "niveau initial %u", colorGammaLevel());
+  for (const Channel &c : channels) {
+    CHECK(c.lut[0] == 0, "%s : table[0] = 0x%04X", c.name, c.lut[0]);
+    CHECK(steps(c, 255) == (1 << c.bits) - 1, "%s : table[255] = %d pas", c.name, steps(c, 255));
+    for (int i = 1; i < 256; i++) {
+      CHECK((c.lut[i] & ~(((1 << c.bits) - 1) << c.shift)) == 0, "%s : table[%d] hors du canal", c.name, i);
+      CHECK(steps(c, i) >= steps(c, i - 1), "%s : table decroissante en %d", c.name, i);
+      CHECK(steps(c, i) >= 1, "%s : table[%d] eteinte", c.name, i);
+    }
+  }
+  CHECK(color565Corrected(255, 255, 255) == 0xFFFF, "blanc = 0x%04X", color565Corrected(255, 255, 255));
+  CHECK(color565Corrected(0, 0, 0) == 0x0000, "noir = 0x%04X", color565Corrected(0, 0, 0));
+  CHECK(color565Corrected(255, 0, 0) == 0xF800, "rouge = 0x%04X", color565Corrected(255, 0, 0));
+  printf("%-34s %s\n", "tables RGB565 niveau 255", failures == before ? "OK" : "ECHEC");
+
+  uint16_t fullR[256], fullG[256], fullB[256];
+  memcpy(fullR, ColorGamma::lutR, sizeof(fullR));
+  memcpy(fullG, ColorGamma::lutG, sizeof(fullG));
+  memcpy(fullB, ColorGamma::lutB, sizeof(fullB));
+
+  // 3. Niveaux (décroissants : chaque table comparée à celle du niveau précédent)
+  before = failures;
+  uint16_t upper[3][256];
+  for (int k = 0; k < 3; k++) memcpy(upper[k], channels[k].lut, sizeof(upper[k]));
+  for (int level = 254; level >= 0; level--) {
+    colorGammaSetLevel((uint8_t)level);
+    CHECK(colorGammaLevel() == level, "niveau %d lu %u", level, colorGammaLevel());
+    for (int k = 0; k < 3; k++) {
+      const Channel &c = channels[k];
+      const int max = (1 << c.bits) - 1;
+      int expected = (max * level + 127) / 255;
+      if (level > 0 && expected == 0) expected = 1;
+      CHECK(steps(c, 255) == expected, "%s niveau %d : table[255] = %d pas, attendu %d",
+            c.name, level, steps(c, 255), expected);
+      CHECK(c.lut[0] == 0, "%s niveau %d : table[0] allumee", c.name, level);
+      for (int i = 1; i < 256; i++) {
+        CHECK(steps(c, i) >= steps(c, i - 1), "%s niveau %d : decroissante en %d", c.name, level, i);
+        CHECK(c.lut[i] <= upper[k][i], "%s niveau %d : table[%d] au-dessus du niveau %d", c.name, level, i, level + 1);
+        CHECK(level == 0 ? c.lut[i] == 0 : steps(c, i) >= 1, "%s niveau %d : table[%d] = %d pas",
+              c.name, level, i, steps(c, i));
+      }
+      memcpy(upper[k], c.lut, sizeof(upper[k]));
+    }
+  }
+  CHECK(color565Corrected(255, 255, 255) == 0, "niveau 0 : blanc = 0x%04X", color565Corrected(255, 255, 255));
+  colorGammaSetLevel(255);
+  CHECK(memcmp(fullR, ColorGamma::lutR, sizeof(fullR)) == 0 &&
+        memcmp(fullG, ColorGamma::lutG, sizeof(fullG)) == 0 &&
+        memcmp(fullB, ColorGamma::lutB, sizeof(fullB)) == 0, "retour au niveau 255 != tables d'origine");
+  printf("%-34s %s (niveaux 0 a 255)\n", "mise a l'echelle par niveau", failures == before ? "OK" : "ECHEC");
+
+  // 4. Répartition du réglage de luminosité
+  before = failures;
+  double previous = -1.0;
+  for (int b = 0; b < 256; b++) {
+    uint8_t hw = colorGammaApplyBrightness((uint8_t)b);
+    double product = hw * colorGammaLevel() / 255.0;
+    CHECK(fabs(product - b) <= 1.0, "reglage %d : PxMatrix %u x niveau %u = %.2f", b, hw, colorGammaLevel(), product);
+    CHECK(hw >= COLOR_BRIGHTNESS_HW_MIN || hw == b, "reglage %d : PxMatrix %u", b, hw);
+    CHECK(b < COLOR_BRIGHTNESS_HW_MIN || (hw == b && colorGammaLevel() == 255),
+          "reglage %d : PxMatrix %u, niveau %u", b, hw, colorGammaLevel());
+    CHECK(product >= previous, "reglage %d : luminosite decroissante", b);
+    previous = product;
+  }
+  colorGammaApplyBrightness(255);
+  CHECK(colorGammaLevel() == 255, "reglage 255 : niveau %u", colorGammaLevel());
+  printf("%-34s %s (PxMatrix >= %d)\n", "reglage de luminosite", failures == before ? "OK" : "ECHEC",
+         COLOR_BRIGHTNESS_HW_MIN);
+
+  return nativeCheckSummary();
+}
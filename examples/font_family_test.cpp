@@ -0,0 +1,127 @@
+/**
+ * Test natif (PC) des familles de polices multi-tailles (src/FontFamily.h)
+ *
+ * 1. Familles DejaVu (examples/fonts/DejaVuFontFamily.h, toutes les tailles
+ *    avec FONT_FAMILY_MAX_HEIGHT=32) : triées par taille, largeurs des textes
+ *    de test croissantes avec la taille, fontTextHeight() == h / y1 de
+ *    getTextBounds().
+ * 2. fontFamilyFitBox() (dichotomie) == parcours linéaire de toutes les
+ *    tailles, pour chaque texte et chaque boîte de 16x8 à 256x32.
+ * 3. Taille retenue pour les textes du compte à rebours selon la géométrie,
+ *    et nombre de mesures dichotomie / parcours linéaire.
+ *
+ * Lancement : pio run -e native_font_family_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <stdio.h>
+#include <string.h>
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#define FONT_FAMILY_MAX_HEIGHT 32
+#include "fonts/DejaVuFontFamily.h"
+#include "NativeCheck.h"
+
+struct TestFamily {
+  const char *name;
+  const FontFamily *family;
+};
+
+static const TestFamily families[] = {
+  { "DejaVuSans", &DejaVuSansFamily },
+  { "DejaVuSans Bold", &DejaVuSansBoldFamily },
+  { "DejaVuSans Oblique", &DejaVuSansObliqueFamily },
+};
+
+static const char *texts[] = {
+  "12:34:56", "3D 05:59", "05:09", "42", "00:00:00", "11:11",
+  "FIN !", "BONNE ANNEE 2026 !", "Joyeuses f\xEAtes \xE0 tous", "\xC9t\xE9 \xE0 l'\xE9" "cole",
+};
+
+static PxMATRIX display(32, 16, 5, 4, 19, 23, 18);
+
+// Référence : parcours linéaire, mêmes règles de repli que fontFamilyFitBox
+static int linearFit(const FontFamily &family, const char *text, uint16_t maxW, uint16_t maxH) {
+  int both = -1, height = -1;
+  for (int i = 0; i < family.count; i++) {
+    const FontFamilyEntry &e = family.entries[i];
+    int16_t y1;
+    bool fitsH = fontTextHeight(e.font, text, &y1) <= maxH;
+    if (fitsH) height = i;
+    if (fitsH && fontFamilyTextWidth(e.metrics, text) <= maxW) both = i;
+  }
+  if (both >= 0) return both;
+  return height >= 0 ? height : 0;
+}
+
+int main() {
+  printf("=== Familles de polices multi-tailles ===\n");
+  display.setTextWrap(false);
+
+  for (const TestFamily &t : families) {
+    const FontFamily &f = *t.family;
+    int before = failures;
+    for (uint8_t i = 0; i < f.count; i++) {
+      const FontFamilyEntry &e = f.entries[i];
+      CHECK(i == 0 || e.points > f.entries[i - 1].points, "%s : tailles non triees (%u pt)", t.name, e.points);
+      for (const char *text : texts) {
+        int16_t x1, y1, my1;
+        uint16_t w, h;
+        display.setFont(e.font);
+        display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+        uint16_t mh = fontTextHeight(e.font, text, &my1);
+        CHECK(mh == h && my1 == y1, "%s %u pt \"%s\" : hauteur %u / %u, y1 %d / %d",
+              t.name, e.points, text, mh, h, my1, y1);
+        if (i > 0) {
+          const FontFamilyEntry &p = f.entries[i - 1];
+          CHECK(fontFamilyTextWidth(e.metrics, text) >= fontFamilyTextWidth(p.metrics, text) &&
+                fontTextHeight(e.font, text) >= fontTextHeight(p.font, text),
+                "%s \"%s\" : %u pt plus petit que %u pt", t.name, text, e.points, p.points);
+        }
+      }
+    }
+    display.setFont();
+
+    for (const char *text : texts) {
+      for (uint16_t maxW = 16; maxW <= 256; maxW += 4) {
+        for (uint16_t maxH = 8; maxH <= 32; maxH++) {
+          const FontFamilyEntry &fit = fontFamilyFitBox(f, text, maxW, maxH);
+          const FontFamilyEntry &ref = f.entries[linearFit(f, text, maxW, maxH)];
+          CHECK(&fit == &ref, "%s \"%s\" %ux%u : %u pt / lineaire %u pt",
+                t.name, text, maxW, maxH, fit.points, ref.points);
+        }
+      }
+    }
+    printf("%-20s %2u tailles (%u-%u pt) : %s\n", t.name, f.count, f.entries[0].points,
+           f.entries[f.count - 1].points, failures == before ? "OK" : "ECHEC");
+  }
+
+  // Taille retenue par géométrie (Gras, style par défaut de l'interface)
+  struct Geometry { const char *name; uint16_t w, h; };
+  static const Geometry geometries[] = {
+    { "1x1", 32, 16 }, { "2x1", 64, 16 }, { "3x1", 96, 16 }, { "4x1", 128, 16 },
+    { "2x2", 64, 32 }, { "8x1", 256, 16 },
+  };
+  static const char *shown[] = { "12:34:56", "3D 05:59", "05:09", "42", "FIN !" };
+  const FontFamily &bold = DejaVuSansBoldFamily;
+  printf("\nDejaVuSans Bold : taille retenue (pt)\n%-10s", "geometrie");
+  for (const char *text : shown) printf(" %10s", text);
+  printf("\n");
+  for (const Geometry &g : geometries) {
+    printf("%-4s %3ux%-2u", g.name, g.w, g.h);
+    for (const char *text : shown) {
+      // Le firmware ne compile que les tailles dont les chiffres tiennent en hauteur
+      FontFamily panel = bold;
+      while (panel.count > 1 && fontTextHeight(panel.entries[panel.count - 1].font, "0123456789") > g.h) panel.count--;
+      printf(" %10u", fontFamilyFitBox(panel, text, g.w, g.h).points);
+    }
+    printf("\n");
+  }
+
+  uint32_t probes = 0;
+  fontFamilyFit(bold, [&](const FontFamilyEntry &e) { probes++; return fontFamilyTextWidth(e.metrics, "12:34:56") <= 96; });
+  printf("\nMesures pour %u tailles : dichotomie %u, parcours lineaire %u\n", bold.count, probes, bold.count);
+
+  return nativeCheckSummary();
+}
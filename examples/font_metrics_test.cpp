@@ -0,0 +1,148 @@
+/**
+ * Test natif (PC) des tables de largeurs de police
+ * Vérifie src/FontMetrics.h sans matériel
+ *
+ * fontTextBounds() doit donner la même largeur et le même x1 que
+ * getTextBounds() (tools/native/Adafruit_GFX.h, copie du calcul Adafruit GFX),
+ * setTextWrap(false), pour :
+ * - La police 5x7 intégrée et les trois polices DejaVu Latin-1
+ * - Les tailles 1 à 3
+ * - Chaque caractère seul (0x01-0xFF) et chaque paire de caractères
+ * - Toutes les chaînes littérales des sources du dépôt (src/, examples/),
+ *   telles quelles (octets UTF-8) et converties en Latin-1
+ *
+ * Lancement : pio run -e native_font_metrics_test -t exec  (depuis la racine du projet)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "FontMetrics.h"
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#include "DejaVuSansOblique9ptLat1.h"
+#include "NativeCheck.h"
+
+struct TestFont {
+  const char *name;
+  const GFXfont *font;
+  const FontMetrics *metrics;
+};
+
+static const TestFont fonts[] = {
+  { "5x7 integree", nullptr, nullptr },
+  { "DejaVuSans", &DejaVuSans9ptLat1, &DejaVuSans9pt8bWidths },
+  { "DejaVuSans Bold", &DejaVuSans_Bold9pt8b, &DejaVuSans_Bold9pt8bWidths },
+  { "DejaVuSans Oblique", &DejaVuSans_Oblique9pt8b, &DejaVuSans_Oblique9pt8bWidths },
+};
+
+static PxMATRIX display(32, 16, 5, 4, 19, 23, 18);
+
+static void checkString(const TestFont &f, const std::string &text, uint8_t size) {
+  int16_t x1, y1, mx1;
+  uint16_t w, h;
+  display.setFont(f.font);
+  display.setTextSize(size);
+  display.getTextBounds(text.c_str(), 0, 0, &x1, &y1, &w, &h);
+  uint16_t mw = fontTextBounds(f.metrics, text.c_str(), size, &mx1);
+  bool same = (mw == w) && (w == 0 || mx1 == x1);
+  CHECK(same, "%s taille %u \"%s\" : largeur %u / getTextBounds %u, x1 %d / %d",
+        f.name, size, text.c_str(), mw, w, mx1, x1);
+}
+
+// UTF-8 -> Latin-1 (hors plage : '?'), comme utf8ToLatin1 du compte à rebours
+static std::string toLatin1(const std::string &in) {
+  std::string out;
+  for (size_t i = 0; i < in.size(); i++) {
+    uint8_t c = in[i];
+    if (c < 0x80) { out += (char)c; continue; }
+    uint32_t cp = 0; int extra = 0;
+    if ((c & 0xE0) == 0xC0) { cp = c & 0x1F; extra = 1; }
+    else if ((c & 0xF0) == 0xE0) { cp = c & 0x0F; extra = 2; }
+    else if ((c & 0xF8) == 0xF0) { cp = c & 0x07; extra = 3; }
+    else { out += '?'; continue; }
+    for (int k = 0; k < extra && i + 1 < in.size(); k++) cp = (cp << 6) | (in[++i] & 0x3F);
+    out += cp <= 0xFF ? (char)cp : '?';
+  }
+  return out;
+}
+
+// Chaînes littérales "..." d'un fichier source (séquences d'échappement simples décodées)
+static void collectLiterals(const std::string &path, std::vector<std::string> &out) {
+  FILE *fp = fopen(path.c_str(), "rb");
+  if (!fp) return;
+  std::string src;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) src.append(buf, n);
+  fclose(fp);
+
+  for (size_t i = 0; i < src.size(); i++) {
+    if (src[i] == '\'' && i + 2 < src.size()) {  // caractère littéral : '"' ne commence pas une chaîne
+      i += (src[i + 1] == '\\') ? 3 : 2;
+      continue;
+    }
+    if (src[i] != '"') continue;
+    std::string lit;
+    for (i++; i < src.size() && src[i] != '"' && src[i] != '\n'; i++) {
+      if (src[i] == '\\' && i + 1 < src.size()) {
+        char e = src[++i];
+        lit += (e == 'n') ? '\n' : (e == 'r') ? '\r' : (e == 't') ? '\t' : e;
+      } else {
+        lit += src[i];
+      }
+    }
+    if (!lit.empty()) out.push_back(lit);
+  }
+}
+
+static void collectDirectory(const char *dir, std::vector<std::string> &out) {
+  DIR *d = opendir(dir);
+  if (!d) return;
+  while (struct dirent *e = readdir(d)) {
+    std::string name = e->d_name;
+    bool source = name.size() > 4 && (name.compare(name.size() - 4, 4, ".cpp") == 0);
+    bool header = name.size() > 2 && name.compare(name.size() - 2, 2, ".h") == 0;
+    if ((source || header) && name.find("DejaVu") == std::string::npos) {
+      collectLiterals(std::string(dir) + "/" + name, out);
+    }
+  }
+  closedir(d);
+}
+
+int main() {
+  printf("=== Test des tables de largeurs de police ===\n");
+  display.setTextWrap(false);
+
+  std::vector<std::string> literals;
+  collectDirectory("src", literals);
+  collectDirectory("examples", literals);
+  CHECK(!literals.empty(), "aucune chaine trouvee (lancer depuis la racine du projet)");
+
+  for (const TestFont &f : fonts) {
+    int before = failures;
+    uint32_t checksBefore = checks;
+    for (uint8_t size = 1; size <= 3; size++) {
+      for (int a = 1; a < 256; a++) {
+        checkString(f, std::string(1, (char)a), size);
+        for (int b = 1; b < 256; b += (size == 1) ? 1 : 17) {
+          checkString(f, std::string(1, (char)a) + (char)b, size);
+        }
+      }
+      for (const std::string &lit : literals) {
+        checkString(f, lit, size);
+        checkString(f, toLatin1(lit), size);
+      }
+    }
+    checkString(f, "", 1);
+    checkString(f, "12:34\n56", 1);
+    printf("%-20s %7u comparaisons : %s\n", f.name, checks - checksBefore,
+           failures == before ? "OK" : "ECHEC");
+  }
+  printf("%u chaines litterales du depot\n", (unsigned)literals.size());
+
+  return nativeCheckSummary("comparaisons");
+}
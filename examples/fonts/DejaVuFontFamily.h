@@ -0,0 +1,227 @@
+#ifndef DEJAVUFONTFAMILY_H
+#define DEJAVUFONTFAMILY_H
+// Familles de polices multi-tailles (tools/font_family.py, src/FontFamily.h)
+// Une taille n'est compilée que si ses chiffres tiennent dans FONT_FAMILY_MAX_HEIGHT
+// (hauteur du panneau par défaut) ; la plus petite taille est toujours présente.
+#include "FontFamily.h"
+#ifndef FONT_FAMILY_MAX_HEIGHT
+  #define FONT_FAMILY_MAX_HEIGHT TOTAL_HEIGHT
+#endif
+
+#include "DejaVuSans6ptLat1.h"
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  #include "DejaVuSans7ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  #include "DejaVuSans8ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  #include "../DejaVuSans9ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  #include "DejaVuSans10ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  #include "DejaVuSans11ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  #include "DejaVuSans12ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  #include "DejaVuSans14ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  #include "DejaVuSans16ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  #include "DejaVuSans18ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  #include "DejaVuSans20ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  #include "DejaVuSans22ptLat1.h"
+#endif
+const FontFamilyEntry DejaVuSansFamilyEntries[] = {
+  { &DejaVuSans6pt8b, &DejaVuSans6pt8bWidths, 6 },           // chiffres 9 px
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  { &DejaVuSans7pt8b, &DejaVuSans7pt8bWidths, 7 },           // chiffres 10 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  { &DejaVuSans8pt8b, &DejaVuSans8pt8bWidths, 8 },           // chiffres 12 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  { &DejaVuSans9pt8b, &DejaVuSans9pt8bWidths, 9 },           // chiffres 13 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  { &DejaVuSans10pt8b, &DejaVuSans10pt8bWidths, 10 },        // chiffres 15 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  { &DejaVuSans11pt8b, &DejaVuSans11pt8bWidths, 11 },        // chiffres 16 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  { &DejaVuSans12pt8b, &DejaVuSans12pt8bWidths, 12 },        // chiffres 18 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  { &DejaVuSans14pt8b, &DejaVuSans14pt8bWidths, 14 },        // chiffres 20 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  { &DejaVuSans16pt8b, &DejaVuSans16pt8bWidths, 16 },        // chiffres 23 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  { &DejaVuSans18pt8b, &DejaVuSans18pt8bWidths, 18 },        // chiffres 26 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  { &DejaVuSans20pt8b, &DejaVuSans20pt8bWidths, 20 },        // chiffres 29 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  { &DejaVuSans22pt8b, &DejaVuSans22pt8bWidths, 22 },        // chiffres 32 px
+#endif
+};
+const FontFamily DejaVuSansFamily = { DejaVuSansFamilyEntries, sizeof(DejaVuSansFamilyEntries) / sizeof(DejaVuSansFamilyEntries[0]) };
+
+#include "DejaVuSansBold6ptLat1.h"
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  #include "DejaVuSansBold7ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  #include "DejaVuSansBold8ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  #include "../DejaVuSansBold9ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  #include "DejaVuSansBold10ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  #include "DejaVuSansBold11ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  #include "DejaVuSansBold12ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  #include "DejaVuSansBold14ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  #include "DejaVuSansBold16ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  #include "DejaVuSansBold18ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  #include "DejaVuSansBold20ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  #include "DejaVuSansBold22ptLat1.h"
+#endif
+const FontFamilyEntry DejaVuSansBoldFamilyEntries[] = {
+  { &DejaVuSans_Bold6pt8b, &DejaVuSans_Bold6pt8bWidths, 6 }, // chiffres 9 px
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  { &DejaVuSans_Bold7pt8b, &DejaVuSans_Bold7pt8bWidths, 7 }, // chiffres 10 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  { &DejaVuSans_Bold8pt8b, &DejaVuSans_Bold8pt8bWidths, 8 }, // chiffres 12 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  { &DejaVuSans_Bold9pt8b, &DejaVuSans_Bold9pt8bWidths, 9 }, // chiffres 13 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  { &DejaVuSans_Bold10pt8b, &DejaVuSans_Bold10pt8bWidths, 10 }, // chiffres 15 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  { &DejaVuSans_Bold11pt8b, &DejaVuSans_Bold11pt8bWidths, 11 }, // chiffres 16 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  { &DejaVuSans_Bold12pt8b, &DejaVuSans_Bold12pt8bWidths, 12 }, // chiffres 18 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  { &DejaVuSans_Bold14pt8b, &DejaVuSans_Bold14pt8bWidths, 14 }, // chiffres 20 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  { &DejaVuSans_Bold16pt8b, &DejaVuSans_Bold16pt8bWidths, 16 }, // chiffres 23 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  { &DejaVuSans_Bold18pt8b, &DejaVuSans_Bold18pt8bWidths, 18 }, // chiffres 26 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  { &DejaVuSans_Bold20pt8b, &DejaVuSans_Bold20pt8bWidths, 20 }, // chiffres 29 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  { &DejaVuSans_Bold22pt8b, &DejaVuSans_Bold22pt8bWidths, 22 }, // chiffres 32 px
+#endif
+};
+const FontFamily DejaVuSansBoldFamily = { DejaVuSansBoldFamilyEntries, sizeof(DejaVuSansBoldFamilyEntries) / sizeof(DejaVuSansBoldFamilyEntries[0]) };
+
+#include "DejaVuSansOblique6ptLat1.h"
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  #include "DejaVuSansOblique7ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  #include "DejaVuSansOblique8ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  #include "../DejaVuSansOblique9ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  #include "DejaVuSansOblique10ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  #include "DejaVuSansOblique11ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  #include "DejaVuSansOblique12ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  #include "DejaVuSansOblique14ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  #include "DejaVuSansOblique16ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  #include "DejaVuSansOblique18ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  #include "DejaVuSansOblique20ptLat1.h"
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  #include "DejaVuSansOblique22ptLat1.h"
+#endif
+const FontFamilyEntry DejaVuSansObliqueFamilyEntries[] = {
+  { &DejaVuSans_Oblique6pt8b, &DejaVuSans_Oblique6pt8bWidths, 6 }, // chiffres 9 px
+#if FONT_FAMILY_MAX_HEIGHT >= 10
+  { &DejaVuSans_Oblique7pt8b, &DejaVuSans_Oblique7pt8bWidths, 7 }, // chiffres 10 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 12
+  { &DejaVuSans_Oblique8pt8b, &DejaVuSans_Oblique8pt8bWidths, 8 }, // chiffres 12 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 13
+  { &DejaVuSans_Oblique9pt8b, &DejaVuSans_Oblique9pt8bWidths, 9 }, // chiffres 13 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 15
+  { &DejaVuSans_Oblique10pt8b, &DejaVuSans_Oblique10pt8bWidths, 10 }, // chiffres 15 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 16
+  { &DejaVuSans_Oblique11pt8b, &DejaVuSans_Oblique11pt8bWidths, 11 }, // chiffres 16 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 18
+  { &DejaVuSans_Oblique12pt8b, &DejaVuSans_Oblique12pt8bWidths, 12 }, // chiffres 18 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 20
+  { &DejaVuSans_Oblique14pt8b, &DejaVuSans_Oblique14pt8bWidths, 14 }, // chiffres 20 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 23
+  { &DejaVuSans_Oblique16pt8b, &DejaVuSans_Oblique16pt8bWidths, 16 }, // chiffres 23 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 26
+  { &DejaVuSans_Oblique18pt8b, &DejaVuSans_Oblique18pt8bWidths, 18 }, // chiffres 26 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 29
+  { &DejaVuSans_Oblique20pt8b, &DejaVuSans_Oblique20pt8bWidths, 20 }, // chiffres 29 px
+#endif
+#if FONT_FAMILY_MAX_HEIGHT >= 32
+  { &DejaVuSans_Oblique22pt8b, &DejaVuSans_Oblique22pt8bWidths, 22 }, // chiffres 32 px
+#endif
+};
+const FontFamily DejaVuSansObliqueFamily = { DejaVuSansObliqueFamilyEntries, sizeof(DejaVuSansObliqueFamilyEntries) / sizeof(DejaVuSansObliqueFamilyEntries[0]) };
+
+#endif // DEJAVUFONTFAMILY_H
@@ -0,0 +1,810 @@
+#ifndef DEJAVUSANS10PTLAT1__H
+#define DEJAVUSANS10PTLAT1__H
+const uint8_t DejaVuSans10pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFC, 0x3C, 0xCF, 0x3C, 0xF3, 0xCC, 0x02, 0x30, 0x18,
+  0xC0, 0x62, 0x01, 0x18, 0x7F, 0xFD, 0xFF, 0xF0, 0xC4, 0x03, 0x30, 0x08,
+  0xC3, 0xFF, 0xEF, 0xFF, 0x86, 0x20, 0x11, 0x80, 0xC6, 0x03, 0x10, 0x00,
+  0x08, 0x04, 0x0F, 0x8F, 0xEE, 0x96, 0x43, 0x20, 0xF8, 0x3F, 0x05, 0xC2,
+  0x61, 0x38, 0xBF, 0xF9, 0xF8, 0x10, 0x08, 0x04, 0x00, 0x38, 0x08, 0x36,
+  0x04, 0x31, 0x84, 0x18, 0xC6, 0x0C, 0x62, 0x06, 0x32, 0x01, 0xB1, 0x00,
+  0x71, 0x1C, 0x01, 0x1B, 0x00, 0x98, 0xC0, 0x8C, 0x60, 0xC6, 0x30, 0x43,
+  0x18, 0x40, 0xD8, 0x20, 0x38, 0x0F, 0x00, 0x7E, 0x03, 0x88, 0x0C, 0x00,
+  0x30, 0x00, 0xE0, 0x03, 0xC0, 0x1F, 0x86, 0xE7, 0x3B, 0x0E, 0xCC, 0x1F,
+  0x30, 0x38, 0x71, 0xF1, 0xFE, 0xE1, 0xE1, 0xC0, 0xFF, 0xC0, 0x32, 0x66,
+  0x4C, 0xCC, 0xCC, 0xCC, 0xC6, 0x66, 0x23, 0xC4, 0x66, 0x23, 0x33, 0x33,
+  0x33, 0x36, 0x66, 0x4C, 0x08, 0x04, 0x22, 0x2D, 0x61, 0xC0, 0xE1, 0xAD,
+  0x11, 0x08, 0x04, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F,
+  0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x6D, 0xE8,
+  0xFF, 0xC0, 0xF0, 0x06, 0x1C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60,
+  0xC3, 0x06, 0x0C, 0x38, 0x60, 0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,
+  0x3C, 0x7E, 0x33, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xC3, 0xFD, 0xFE, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x18, 0x0C,
+  0x0C, 0x0E, 0x0E, 0x06, 0x0E, 0x0E, 0x0E, 0x07, 0xFF, 0xFE, 0x7E, 0x3F,
+  0xC8, 0x38, 0x06, 0x01, 0x80, 0xE1, 0xE0, 0x7C, 0x01, 0x80, 0x30, 0x0C,
+  0x03, 0x81, 0xFF, 0xE7, 0xE0, 0x03, 0x80, 0xF0, 0x16, 0x06, 0xC0, 0x98,
+  0x33, 0x0C, 0x61, 0x0C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x03,
+  0x00, 0x60, 0x7F, 0x3F, 0x98, 0x0C, 0x06, 0x03, 0xF1, 0xFC, 0x87, 0x01,
+  0x80, 0xC0, 0x60, 0x38, 0x37, 0xF9, 0xF0, 0x0F, 0x0F, 0xE7, 0x09, 0x80,
+  0xE0, 0x30, 0x0C, 0xF3, 0xFE, 0xE1, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xDF,
+  0xE1, 0xF0, 0xFF, 0xFF, 0xF0, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x0C,
+  0x06, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x03, 0x01, 0x80, 0x3F, 0x1F, 0xEE,
+  0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF1, 0xFE, 0x61, 0xB0, 0x3C, 0x0F, 0x03,
+  0xE1, 0xDF, 0xE3, 0xF0, 0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x3E,
+  0x1D, 0xFF, 0x3C, 0xC0, 0x30, 0x1C, 0x06, 0x43, 0x9F, 0xC3, 0xC0, 0xF0,
+  0x00, 0xF0, 0x6C, 0x00, 0x00, 0x6D, 0xE8, 0x00, 0x08, 0x03, 0xC0, 0xFC,
+  0x3F, 0x0F, 0xC0, 0x78, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xC0,
+  0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x80,
+  0x07, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x3C, 0x07, 0xE1, 0xF8,
+  0x7E, 0x07, 0x80, 0x20, 0x00, 0x7C, 0xFE, 0x87, 0x03, 0x03, 0x07, 0x0E,
+  0x1C, 0x38, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x03, 0xF0, 0x03, 0xFF,
+  0x81, 0xE0, 0xF0, 0xE0, 0x0E, 0x70, 0x01, 0x98, 0x76, 0x3C, 0x3F, 0x8F,
+  0x1C, 0xE3, 0xC6, 0x18, 0xF1, 0x86, 0x7C, 0x73, 0xBB, 0x0F, 0xFC, 0x61,
+  0xDC, 0x1C, 0x00, 0x03, 0x80, 0x40, 0x70, 0x70, 0x0F, 0xF8, 0x00, 0xF8,
+  0x00, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1B, 0x00, 0xD8, 0x0E, 0xE0, 0x63,
+  0x03, 0x18, 0x30, 0x61, 0x83, 0x0F, 0xF8, 0xFF, 0xE6, 0x03, 0x30, 0x1B,
+  0x00, 0x60, 0xFE, 0x3F, 0xCC, 0x3B, 0x06, 0xC1, 0xB0, 0xEF, 0xF3, 0xFC,
+  0xC1, 0xB0, 0x3C, 0x0F, 0x03, 0xC1, 0xFF, 0xEF, 0xF0, 0x0F, 0xE3, 0xFF,
+  0x38, 0x16, 0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+  0xE0, 0x06, 0x00, 0x38, 0x13, 0xFF, 0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0xC1,
+  0xEC, 0x06, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x7C, 0x06, 0xC1, 0xEF, 0xFC, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x18, 0x0C,
+  0x06, 0x03, 0xFF, 0xFF, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x0F, 0xE1, 0xFF, 0x9E, 0x04, 0xC0, 0x0E, 0x00, 0x60,
+  0x03, 0x00, 0x18, 0x1F, 0xC0, 0xFE, 0x00, 0xF8, 0x06, 0xC0, 0x33, 0x81,
+  0x8F, 0xF8, 0x3F, 0x00, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x18, 0xFF, 0xFF, 0xFF, 0xFC, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x63, 0x3F, 0xB8, 0xC1, 0xCC, 0x38, 0xC7, 0x0C, 0xE0, 0xDC,
+  0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF8, 0x0D, 0xC0, 0xCE, 0x0C, 0x70, 0xC3,
+  0x8C, 0x1C, 0xC0, 0xE0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE, 0xF0, 0x7F, 0x83,
+  0xFC, 0x1F, 0xB1, 0xBD, 0x8D, 0xEC, 0x6F, 0x36, 0x79, 0xB3, 0xCD, 0x9E,
+  0x38, 0xF1, 0xC7, 0x8E, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x60, 0xE0, 0x7E,
+  0x0F, 0xC1, 0xFC, 0x3D, 0x87, 0xB8, 0xF3, 0x1E, 0x73, 0xC6, 0x78, 0xEF,
+  0x0D, 0xE1, 0xFC, 0x1F, 0x81, 0xF0, 0x38, 0x0F, 0xC0, 0xFF, 0xC3, 0x87,
+  0x18, 0x06, 0xE0, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3E, 0x01, 0xD8, 0x06, 0x38, 0x70, 0xFF, 0xC0, 0xFC, 0x00, 0xFE, 0x7F,
+  0xB0, 0xF8, 0x3C, 0x1E, 0x0F, 0x0F, 0xFE, 0xFE, 0x60, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x00, 0x0F, 0xC0, 0xFF, 0xC3, 0x87, 0x98, 0x06, 0xE0, 0x1F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xD8, 0x06,
+  0x38, 0x70, 0xFF, 0x80, 0xFC, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0xFE,
+  0x1F, 0xE3, 0x0E, 0x60, 0xCC, 0x19, 0x87, 0x3F, 0xC7, 0xF0, 0xC7, 0x18,
+  0x73, 0x06, 0x60, 0xCC, 0x0D, 0x81, 0xB0, 0x18, 0x3F, 0x1F, 0xEE, 0x0B,
+  0x00, 0xC0, 0x38, 0x07, 0xC0, 0xFC, 0x03, 0x80, 0x30, 0x0C, 0x03, 0x81,
+  0xFF, 0xE7, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x76, 0x0C, 0xFF, 0x87, 0xC0, 0xC0,
+  0x1B, 0x01, 0x98, 0x0C, 0xC0, 0x63, 0x06, 0x18, 0x30, 0xC1, 0x83, 0x18,
+  0x18, 0xC0, 0xEE, 0x03, 0x60, 0x1B, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x1E, 0x19, 0x87, 0x86, 0x63, 0x31, 0x98,
+  0xCC, 0x63, 0x33, 0x30, 0xCC, 0xCC, 0x36, 0x1B, 0x0D, 0x86, 0xC3, 0xE1,
+  0xE0, 0x78, 0x78, 0x1E, 0x1E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x73,
+  0x06, 0x38, 0xC1, 0x9C, 0x0D, 0x80, 0xF0, 0x07, 0x00, 0x70, 0x0F, 0x00,
+  0xF8, 0x19, 0x83, 0x8C, 0x30, 0xE6, 0x06, 0xE0, 0x70, 0xE0, 0x76, 0x06,
+  0x30, 0xC3, 0x9C, 0x19, 0x81, 0xF8, 0x0F, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+  0x60, 0x0C, 0x01, 0xC0, 0x38, 0x07, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x38,
+  0x03, 0x00, 0x60, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xFF, 0xC1, 0xC1, 0x83, 0x06, 0x06, 0x0C, 0x18, 0x18,
+  0x30, 0x60, 0x60, 0xC1, 0x83, 0x83, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0xFF, 0x07, 0x00, 0x6C, 0x06, 0x30, 0x60, 0xC6, 0x03, 0x00,
+  0xFF, 0xFF, 0xF0, 0xC3, 0x0C, 0x30, 0x3E, 0x3F, 0x90, 0xE0, 0x33, 0xFB,
+  0xFF, 0x07, 0x83, 0xC3, 0xFF, 0xDF, 0x60, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xDF, 0x3F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xBF,
+  0xED, 0xF0, 0x1F, 0x3F, 0xDC, 0x3C, 0x0C, 0x06, 0x03, 0x01, 0xC0, 0x70,
+  0xBF, 0xC7, 0xC0, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x3E, 0xDF, 0xF6, 0x1F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xF3, 0xEC, 0x1F, 0x1F,
+  0xE6, 0x1F, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x70, 0x4F, 0xF1, 0xF8,
+  0x1E, 0x7C, 0xC1, 0x8F, 0xFF, 0xCC, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0C, 0x00, 0x3E, 0xDF, 0xF6, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0x61, 0xDF, 0xF3, 0xEC, 0x03, 0x41, 0x9F, 0xE3, 0xE0, 0xC0, 0x60, 0x30,
+  0x18, 0x0D, 0xE7, 0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0F, 0x06, 0xF0, 0xFF, 0xFF, 0xFC, 0x33, 0x00, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x3E, 0xE0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0xB1, 0xCC,
+  0xE3, 0x70, 0xF8, 0x3C, 0x0F, 0x83, 0x70, 0xCE, 0x31, 0xCC, 0x38, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xDE, 0x3C, 0xFF, 0x7E, 0xE3, 0xC7, 0xC1, 0x83, 0xC1,
+  0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1,
+  0x83, 0xDE, 0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x60, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0x61, 0x9F, 0xE1, 0xE0, 0xDF, 0x3F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xE1, 0xBF, 0xED, 0xF3, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x3E,
+  0xDF, 0xF6, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xF3,
+  0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0xDF, 0xFE, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x00, 0x3E, 0xFF, 0xC1, 0xC0, 0xFC, 0x3E, 0x07, 0x03, 0x83,
+  0xFF, 0x7C, 0x60, 0xC1, 0x87, 0xFF, 0xEC, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x07, 0xE7, 0xC0, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xE3, 0xBF, 0xCF, 0x60, 0xC0, 0x6C, 0x19, 0x83, 0x30, 0x63, 0x18, 0x63,
+  0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x00, 0xC3, 0x87, 0x87, 0x0D,
+  0x8A, 0x33, 0x36, 0x66, 0x6C, 0xCC, 0xD9, 0x8D, 0x16, 0x1E, 0x3C, 0x3C,
+  0x78, 0x30, 0x60, 0x60, 0xC0, 0xE0, 0xEE, 0x38, 0xEE, 0x0D, 0x80, 0xE0,
+  0x1C, 0x07, 0xC0, 0xD8, 0x31, 0x8E, 0x3B, 0x83, 0x80, 0xC0, 0x6C, 0x19,
+  0x83, 0x38, 0xC3, 0x18, 0x77, 0x06, 0xC0, 0xD8, 0x0E, 0x01, 0xC0, 0x30,
+  0x06, 0x01, 0xC0, 0xF0, 0x1C, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xE0, 0x60, 0x70, 0x7F, 0xFF, 0xE0, 0x0F, 0x1F, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0xF0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x0F, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0,
+  0x3E, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0x00, 0xF0,
+  0xFF, 0xFF, 0xFC, 0x04, 0x02, 0x01, 0x03, 0xE7, 0xFB, 0xA7, 0x11, 0x88,
+  0xC4, 0x62, 0x31, 0x0E, 0x97, 0xF8, 0xF8, 0x10, 0x08, 0x04, 0x00, 0x0F,
+  0x0F, 0xCE, 0x26, 0x03, 0x01, 0x80, 0xC1, 0xFE, 0xFF, 0x18, 0x0C, 0x06,
+  0x03, 0x07, 0xFF, 0xFE, 0x80, 0xDB, 0x67, 0xF8, 0xCC, 0x61, 0x98, 0x63,
+  0x31, 0xFE, 0x6D, 0xA0, 0x10, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0x0C, 0x19,
+  0x81, 0x98, 0x7F, 0xE0, 0xF0, 0x06, 0x07, 0xFE, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x3E, 0x7E, 0x60,
+  0x60, 0x30, 0x78, 0xCE, 0xC7, 0xC3, 0x63, 0x36, 0x1C, 0x0C, 0x06, 0x06,
+  0x7E, 0x7C, 0xCF, 0x30, 0x0F, 0xC0, 0x61, 0x82, 0x01, 0x11, 0xE2, 0x4C,
+  0x4A, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x14, 0xC4, 0x91,
+  0xE2, 0x20, 0x10, 0x61, 0x80, 0xFC, 0x00, 0x7E, 0x03, 0x01, 0x7F, 0xC1,
+  0x81, 0xC3, 0x7D, 0x00, 0xFF, 0x08, 0x46, 0x33, 0x19, 0x08, 0x84, 0x10,
+  0x83, 0x18, 0x63, 0x08, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0x00, 0x30,
+  0x01, 0x80, 0x0C, 0xFF, 0xC0, 0x07, 0xC0, 0x30, 0x60, 0x80, 0x22, 0x7E,
+  0x24, 0xC6, 0x51, 0x8C, 0x63, 0x18, 0xC7, 0xE1, 0x8C, 0x83, 0x19, 0x85,
+  0x31, 0x92, 0x61, 0xA2, 0x00, 0x83, 0x06, 0x01, 0xF0, 0x00, 0xFF, 0xF0,
+  0x7B, 0x38, 0x61, 0xCD, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xFF,
+  0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x7A, 0x10, 0x43, 0x18, 0xC4, 0x3F, 0xF8, 0x10, 0x4E, 0x04, 0x10,
+  0x7E, 0x19, 0x99, 0x80, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0xC1, 0xB0, 0x6C,
+  0x1B, 0x06, 0xE3, 0xBF, 0xFD, 0xCF, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x3F,
+  0xBE, 0x7F, 0x3F, 0x9F, 0xCF, 0xE5, 0xF2, 0x79, 0x04, 0x82, 0x41, 0x20,
+  0x90, 0x48, 0x24, 0x12, 0x09, 0x04, 0x80, 0xF0, 0x23, 0x3E, 0xE1, 0x08,
+  0x42, 0x10, 0x9F, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x00,
+  0xFF, 0x84, 0x31, 0x86, 0x30, 0x42, 0x08, 0x44, 0x26, 0x33, 0x18, 0x84,
+  0x00, 0xE0, 0x18, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x20,
+  0x80, 0x20, 0x80, 0xF9, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x04, 0x12, 0x08,
+  0x22, 0x08, 0x3F, 0x10, 0x02, 0x30, 0x02, 0xE0, 0x18, 0x20, 0x10, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x20, 0x80, 0x20, 0x80, 0xF9, 0x1E, 0x02,
+  0x21, 0x02, 0x01, 0x04, 0x03, 0x08, 0x06, 0x08, 0x0C, 0x10, 0x10, 0x30,
+  0x3F, 0xF8, 0x0C, 0x02, 0x04, 0x01, 0x04, 0x07, 0x02, 0x00, 0x42, 0x00,
+  0x22, 0x00, 0x11, 0x01, 0xF1, 0x02, 0x01, 0x03, 0x00, 0x82, 0x80, 0x82,
+  0x40, 0x82, 0x20, 0x41, 0xF8, 0x40, 0x08, 0x60, 0x04, 0x0C, 0x0C, 0x00,
+  0x0C, 0x0C, 0x0C, 0x1C, 0x38, 0x70, 0x60, 0xC0, 0xC0, 0xE1, 0x7F, 0x3E,
+  0x06, 0x00, 0x18, 0x00, 0x40, 0x00, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x01,
+  0xB0, 0x0D, 0x80, 0xEE, 0x06, 0x30, 0x31, 0x83, 0x06, 0x18, 0x30, 0xFF,
+  0x8F, 0xFE, 0x60, 0x33, 0x01, 0xB0, 0x06, 0x00, 0x80, 0x0C, 0x00, 0xC0,
+  0x00, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x01, 0xB0, 0x0D, 0x80, 0xEE, 0x06,
+  0x30, 0x31, 0x83, 0x06, 0x18, 0x30, 0xFF, 0x8F, 0xFE, 0x60, 0x33, 0x01,
+  0xB0, 0x06, 0x07, 0x00, 0x28, 0x02, 0x20, 0x00, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x01, 0xB0, 0x0D, 0x80, 0xEE, 0x06, 0x30, 0x31, 0x83, 0x06, 0x18,
+  0x30, 0xFF, 0x8F, 0xFE, 0x60, 0x33, 0x01, 0xB0, 0x06, 0x0E, 0x80, 0x5C,
+  0x00, 0x00, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x36, 0x01, 0xB0, 0x1D, 0xC0,
+  0xC6, 0x06, 0x30, 0x60, 0xC3, 0x06, 0x1F, 0xF1, 0xFF, 0xCC, 0x06, 0x60,
+  0x36, 0x00, 0xC0, 0x0D, 0x80, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x01, 0xB0, 0x0D, 0x80, 0xEE, 0x06, 0x30, 0x31, 0x83, 0x06,
+  0x18, 0x30, 0xFF, 0x8F, 0xFE, 0x60, 0x33, 0x01, 0xB0, 0x06, 0x07, 0x00,
+  0x44, 0x02, 0x20, 0x11, 0x00, 0x70, 0x03, 0x80, 0x3E, 0x01, 0xB0, 0x0D,
+  0x80, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x06, 0x18, 0x30, 0xFF, 0x8F, 0xFE,
+  0x60, 0x33, 0x01, 0xB0, 0x06, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x66, 0x00,
+  0x19, 0x80, 0x0E, 0x60, 0x03, 0x18, 0x00, 0xC7, 0xFC, 0x61, 0xFF, 0x18,
+  0x60, 0x0C, 0x18, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x60, 0x60, 0x18, 0x1F,
+  0xFC, 0x07, 0xFC, 0x0F, 0xE3, 0xFF, 0x38, 0x16, 0x00, 0xE0, 0x0C, 0x00,
+  0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x38, 0x13, 0xFF,
+  0x0F, 0xE0, 0x10, 0x01, 0x80, 0x18, 0x07, 0x00, 0x18, 0x06, 0x01, 0x00,
+  0x0F, 0xFF, 0xFF, 0x01, 0x80, 0xC0, 0x60, 0x3F, 0xFF, 0xFC, 0x06, 0x03,
+  0x01, 0x80, 0xC0, 0x7F, 0xFF, 0xE0, 0x02, 0x03, 0x03, 0x00, 0x0F, 0xFF,
+  0xFF, 0x01, 0x80, 0xC0, 0x60, 0x3F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x7F, 0xFF, 0xE0, 0x0C, 0x0F, 0x0C, 0xC0, 0x0F, 0xFF, 0xFF, 0x01,
+  0x80, 0xC0, 0x60, 0x3F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x7F,
+  0xFF, 0xE0, 0x33, 0x19, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0x80, 0xC0,
+  0x60, 0x3F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x7F, 0xFF, 0xE0,
+  0xC6, 0x20, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x26, 0xC0,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x31, 0xEC, 0xC0, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0xCF,
+  0x30, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0x07, 0x8C, 0x06, 0x30, 0x1C, 0xC0,
+  0x3F, 0xE0, 0xFF, 0x83, 0x30, 0x0C, 0xC0, 0x33, 0x01, 0xCC, 0x06, 0x30,
+  0x78, 0xFF, 0xC3, 0xFC, 0x00, 0x1D, 0x02, 0xE0, 0x00, 0x70, 0x3F, 0x07,
+  0xE0, 0xFE, 0x1E, 0xC3, 0xDC, 0x79, 0x8F, 0x39, 0xE3, 0x3C, 0x77, 0x86,
+  0xF0, 0xFE, 0x0F, 0xC0, 0xF8, 0x1C, 0x06, 0x00, 0x0C, 0x00, 0x10, 0x00,
+  0x00, 0x0F, 0xC0, 0xFF, 0xC3, 0x87, 0x18, 0x06, 0xE0, 0x1F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xD8, 0x06, 0x38, 0x70,
+  0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x80, 0x06, 0x00, 0x30, 0x00, 0x00, 0x0F,
+  0xC0, 0xFF, 0xC3, 0x87, 0x18, 0x06, 0xE0, 0x1F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xD8, 0x06, 0x38, 0x70, 0xFF, 0xC0,
+  0xFC, 0x00, 0x03, 0x00, 0x1E, 0x00, 0xCC, 0x00, 0x00, 0x0F, 0xC0, 0xFF,
+  0xC3, 0x87, 0x18, 0x06, 0xE0, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3E, 0x01, 0xD8, 0x06, 0x38, 0x70, 0xFF, 0xC0, 0xFC, 0x00,
+  0x06, 0x40, 0x26, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0xE1, 0xC6, 0x01,
+  0xB8, 0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80,
+  0x76, 0x01, 0x8E, 0x1C, 0x3F, 0xF0, 0x3F, 0x00, 0x0C, 0xC0, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xC3, 0x87, 0x18, 0x06, 0xE0, 0x1F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xD8, 0x06,
+  0x38, 0x70, 0xFF, 0xC0, 0xFC, 0x00, 0x40, 0x5C, 0x1D, 0xC7, 0x1D, 0xC1,
+  0xF0, 0x1C, 0x07, 0xC1, 0xDC, 0x71, 0xDC, 0x1D, 0x01, 0x00, 0x0F, 0xC4,
+  0xFF, 0xA7, 0x87, 0x98, 0x0E, 0xE0, 0x7B, 0x03, 0x3C, 0x18, 0xF0, 0xC3,
+  0xC6, 0x0F, 0x30, 0x37, 0x81, 0xDC, 0x06, 0x78, 0x79, 0x7F, 0xC8, 0xFC,
+  0x00, 0x18, 0x01, 0x80, 0x10, 0x00, 0x0C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0x07, 0x60,
+  0xCF, 0xF8, 0x7C, 0x00, 0x02, 0x00, 0xC0, 0x30, 0x00, 0x0C, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1F, 0x07, 0x60, 0xCF, 0xF8, 0x7C, 0x00, 0x0E, 0x01, 0x40, 0x44, 0x00,
+  0x0C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x1F, 0x07, 0x60, 0xCF, 0xF8, 0x7C, 0x00, 0x1B, 0x03,
+  0x60, 0x00, 0x00, 0x0C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0x07, 0x60, 0xCF, 0xF8, 0x7C,
+  0x00, 0x01, 0x00, 0x30, 0x06, 0x00, 0x00, 0xE0, 0x76, 0x06, 0x30, 0xC3,
+  0x9C, 0x19, 0x81, 0xF8, 0x0F, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x60, 0x30, 0x1F, 0xCF, 0xF6,
+  0x1F, 0x07, 0x83, 0xC1, 0xE1, 0xFF, 0xDF, 0xCC, 0x06, 0x03, 0x00, 0x3E,
+  0x1F, 0xCE, 0x3B, 0x06, 0xC7, 0xB3, 0x0C, 0xC3, 0x38, 0xC7, 0x30, 0x6C,
+  0x0F, 0x03, 0xD1, 0xF7, 0xEC, 0xF0, 0x60, 0x18, 0x06, 0x01, 0x80, 0x01,
+  0xF1, 0xFC, 0x87, 0x01, 0x9F, 0xDF, 0xF8, 0x3C, 0x1E, 0x1F, 0xFE, 0xFB,
+  0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0xF1, 0xFC, 0x87, 0x01, 0x9F, 0xDF,
+  0xF8, 0x3C, 0x1E, 0x1F, 0xFE, 0xFB, 0x08, 0x0A, 0x05, 0x04, 0x40, 0x01,
+  0xF1, 0xFC, 0x87, 0x01, 0x9F, 0xDF, 0xF8, 0x3C, 0x1E, 0x1F, 0xFE, 0xFB,
+  0x1A, 0x15, 0x0B, 0x00, 0x00, 0x01, 0xF1, 0xFC, 0x87, 0x01, 0x9F, 0xDF,
+  0xF8, 0x3C, 0x1E, 0x1F, 0xFE, 0xFB, 0x36, 0x1B, 0x00, 0x00, 0x03, 0xE3,
+  0xF9, 0x0E, 0x03, 0x3F, 0xBF, 0xF0, 0x78, 0x3C, 0x3F, 0xFD, 0xF6, 0x1C,
+  0x11, 0x08, 0x84, 0x41, 0xC0, 0x00, 0xF8, 0xFE, 0x43, 0x80, 0xCF, 0xEF,
+  0xFC, 0x1E, 0x0F, 0x0F, 0xFF, 0x7D, 0x80, 0x3E, 0x3E, 0x3F, 0xBF, 0x90,
+  0xF0, 0xC0, 0x30, 0x33, 0xFF, 0xFB, 0xFF, 0xFF, 0x06, 0x01, 0x83, 0x00,
+  0xC3, 0xE0, 0xFF, 0x7F, 0xCF, 0x0F, 0xC0, 0x1F, 0x3F, 0xDC, 0x3C, 0x0C,
+  0x06, 0x03, 0x01, 0xC0, 0x70, 0xBF, 0xC7, 0xC0, 0x80, 0x60, 0x30, 0x70,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x07, 0xC7, 0xF9, 0x87, 0xC0, 0xFF,
+  0xFF, 0xFF, 0x00, 0xC0, 0x1C, 0x13, 0xFC, 0x7E, 0x03, 0x01, 0x80, 0xC0,
+  0x60, 0x00, 0x07, 0xC7, 0xF9, 0x87, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0xC0,
+  0x1C, 0x13, 0xFC, 0x7E, 0x0C, 0x07, 0x81, 0x20, 0xCC, 0x00, 0x07, 0xC7,
+  0xF9, 0x87, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x1C, 0x13, 0xFC, 0x7E,
+  0x33, 0x0C, 0xC0, 0x00, 0x00, 0x1F, 0x1F, 0xE6, 0x1F, 0x03, 0xFF, 0xFF,
+  0xFC, 0x03, 0x00, 0x70, 0x4F, 0xF1, 0xF8, 0xC3, 0x0C, 0x30, 0x0C, 0x63,
+  0x18, 0xC6, 0x31, 0x8C, 0x63, 0x19, 0x99, 0x80, 0x31, 0x8C, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x31, 0xE4, 0xB3, 0x00, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0xCF, 0x30, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x00, 0x10, 0x87, 0xC7, 0xC0, 0x18, 0x1F, 0x1F, 0xE6, 0x1B,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0, 0x32, 0x2D,
+  0x13, 0x00, 0x00, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x07, 0x87,
+  0xF9, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x67, 0xF8, 0x78,
+  0x03, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x07, 0x87, 0xF9, 0x86, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x67, 0xF8, 0x78, 0x0C, 0x07, 0x81, 0x20,
+  0xCC, 0x00, 0x07, 0x87, 0xF9, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xD8, 0x67, 0xF8, 0x78, 0x19, 0x0B, 0x42, 0x60, 0x00, 0x00, 0x07, 0x87,
+  0xF9, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x67, 0xF8, 0x78,
+  0x33, 0x0C, 0xC0, 0x00, 0x00, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0, 0x06, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x00, 0x47,
+  0x97, 0xF9, 0x86, 0xC3, 0xF1, 0xBC, 0xCF, 0x63, 0xF0, 0xD8, 0x67, 0xFA,
+  0x78, 0x80, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x06, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x06, 0x06, 0x06,
+  0x06, 0x00, 0x06, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F,
+  0x1D, 0xFE, 0x7B, 0x08, 0x0A, 0x05, 0x04, 0x40, 0x06, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x36, 0x1B, 0x00,
+  0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3E, 0x3B,
+  0xFC, 0xF6, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0x01, 0x80, 0xD8, 0x33,
+  0x06, 0x71, 0x86, 0x30, 0xEE, 0x0D, 0x81, 0xB0, 0x1C, 0x03, 0x80, 0x60,
+  0x0C, 0x03, 0x81, 0xE0, 0x38, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDF,
+  0x3F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xBF, 0xED,
+  0xF3, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x1B, 0x03, 0x60, 0x00, 0x00, 0x0C,
+  0x06, 0xC1, 0x98, 0x33, 0x8C, 0x31, 0x87, 0x70, 0x6C, 0x0D, 0x80, 0xE0,
+  0x1C, 0x03, 0x00, 0x60, 0x1C, 0x0F, 0x01, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   2,  15,   8,    3,  -14 },   // 0x21 '!'
+  {     5,   6,   5,  10,    2,  -14 },   // 0x22 '"'
+  {     9,  14,  15,  17,    2,  -14 },   // 0x23 '#'
+  {    36,   9,  18,  13,    2,  -14 },   // 0x24 '$'
+  {    57,  17,  15,  19,    0,  -14 },   // 0x25 '%'
+  {    89,  14,  15,  15,    1,  -14 },   // 0x26 '&'
+  {   116,   2,   5,   6,    2,  -14 },   // 0x27 '''
+  {   118,   4,  18,   8,    2,  -14 },   // 0x28 '('
+  {   127,   4,  18,   8,    2,  -14 },   // 0x29 ')'
+  {   136,   9,  10,  10,    0,  -14 },   // 0x2A '*'
+  {   148,  12,  12,  17,    2,  -11 },   // 0x2B '+'
+  {   166,   3,   5,   6,    1,   -1 },   // 0x2C ','
+  {   168,   5,   2,   7,    1,   -6 },   // 0x2D '-'
+  {   170,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   171,   7,  16,   7,    0,  -14 },   // 0x2F '/'
+  {   185,  10,  15,  13,    1,  -14 },   // 0x30 '0'
+  {   204,   9,  15,  13,    2,  -14 },   // 0x31 '1'
+  {   221,   9,  15,  13,    1,  -14 },   // 0x32 '2'
+  {   238,  10,  15,  13,    1,  -14 },   // 0x33 '3'
+  {   257,  11,  15,  13,    1,  -14 },   // 0x34 '4'
+  {   278,   9,  15,  13,    1,  -14 },   // 0x35 '5'
+  {   295,  10,  15,  13,    1,  -14 },   // 0x36 '6'
+  {   314,  10,  15,  13,    1,  -14 },   // 0x37 '7'
+  {   333,  10,  15,  13,    1,  -14 },   // 0x38 '8'
+  {   352,  10,  15,  13,    1,  -14 },   // 0x39 '9'
+  {   371,   2,  10,   7,    2,   -9 },   // 0x3A ':'
+  {   374,   3,  13,   7,    1,   -9 },   // 0x3B ';'
+  {   379,  13,  11,  17,    2,  -11 },   // 0x3C '<'
+  {   397,  13,   6,  17,    2,   -8 },   // 0x3D '='
+  {   407,  13,  11,  17,    2,  -11 },   // 0x3E '>'
+  {   425,   8,  15,  11,    1,  -14 },   // 0x3F '?'
+  {   440,  18,  18,  20,    1,  -14 },   // 0x40 '@'
+  {   481,  13,  15,  14,    0,  -14 },   // 0x41 'A'
+  {   506,  10,  15,  14,    2,  -14 },   // 0x42 'B'
+  {   525,  12,  15,  14,    1,  -14 },   // 0x43 'C'
+  {   548,  12,  15,  15,    2,  -14 },   // 0x44 'D'
+  {   571,   9,  15,  13,    2,  -14 },   // 0x45 'E'
+  {   588,   8,  15,  12,    2,  -14 },   // 0x46 'F'
+  {   603,  13,  15,  16,    1,  -14 },   // 0x47 'G'
+  {   628,  11,  15,  15,    2,  -14 },   // 0x48 'H'
+  {   649,   2,  15,   6,    2,  -14 },   // 0x49 'I'
+  {   653,   5,  19,   6,   -1,  -14 },   // 0x4A 'J'
+  {   665,  12,  15,  13,    2,  -14 },   // 0x4B 'K'
+  {   688,   9,  15,  11,    2,  -14 },   // 0x4C 'L'
+  {   705,  13,  15,  17,    2,  -14 },   // 0x4D 'M'
+  {   730,  11,  15,  15,    2,  -14 },   // 0x4E 'N'
+  {   751,  14,  15,  16,    1,  -14 },   // 0x4F 'O'
+  {   778,   9,  15,  12,    2,  -14 },   // 0x50 'P'
+  {   795,  14,  18,  16,    1,  -14 },   // 0x51 'Q'
+  {   827,  11,  15,  14,    2,  -14 },   // 0x52 'R'
+  {   848,  10,  15,  13,    1,  -14 },   // 0x53 'S'
+  {   867,  12,  15,  12,    0,  -14 },   // 0x54 'T'
+  {   890,  11,  15,  15,    2,  -14 },   // 0x55 'U'
+  {   911,  13,  15,  14,    0,  -14 },   // 0x56 'V'
+  {   936,  18,  15,  20,    1,  -14 },   // 0x57 'W'
+  {   970,  12,  15,  14,    1,  -14 },   // 0x58 'X'
+  {   993,  12,  15,  12,    0,  -14 },   // 0x59 'Y'
+  {  1016,  12,  15,  14,    1,  -14 },   // 0x5A 'Z'
+  {  1039,   4,  18,   8,    2,  -14 },   // 0x5B '['
+  {  1048,   7,  16,   7,    0,  -14 },   // 0x5C '\'
+  {  1062,   4,  18,   8,    2,  -14 },   // 0x5D ']'
+  {  1071,  13,   5,  17,    2,  -14 },   // 0x5E '^'
+  {  1080,  10,   2,  10,    0,    4 },   // 0x5F '_'
+  {  1083,   5,   4,  10,    1,  -15 },   // 0x60 '`'
+  {  1086,   9,  11,  12,    1,  -10 },   // 0x61 'a'
+  {  1099,  10,  15,  13,    2,  -14 },   // 0x62 'b'
+  {  1118,   9,  11,  11,    1,  -10 },   // 0x63 'c'
+  {  1131,  10,  15,  13,    1,  -14 },   // 0x64 'd'
+  {  1150,  10,  11,  12,    1,  -10 },   // 0x65 'e'
+  {  1164,   7,  15,   7,    0,  -14 },   // 0x66 'f'
+  {  1178,  10,  15,  13,    1,  -10 },   // 0x67 'g'
+  {  1197,   9,  15,  13,    2,  -14 },   // 0x68 'h'
+  {  1214,   2,  15,   6,    2,  -14 },   // 0x69 'i'
+  {  1218,   4,  19,   6,    0,  -14 },   // 0x6A 'j'
+  {  1228,  10,  15,  12,    2,  -14 },   // 0x6B 'k'
+  {  1247,   2,  15,   6,    2,  -14 },   // 0x6C 'l'
+  {  1251,  16,  11,  20,    2,  -10 },   // 0x6D 'm'
+  {  1273,   9,  11,  13,    2,  -10 },   // 0x6E 'n'
+  {  1286,  10,  11,  12,    1,  -10 },   // 0x6F 'o'
+  {  1300,  10,  15,  13,    2,  -10 },   // 0x70 'p'
+  {  1319,  10,  15,  13,    1,  -10 },   // 0x71 'q'
+  {  1338,   6,  11,   8,    2,  -10 },   // 0x72 'r'
+  {  1347,   8,  11,  10,    1,  -10 },   // 0x73 's'
+  {  1358,   7,  14,   8,    1,  -13 },   // 0x74 't'
+  {  1371,   9,  11,  13,    2,  -10 },   // 0x75 'u'
+  {  1384,  11,  11,  11,    0,  -10 },   // 0x76 'v'
+  {  1400,  15,  11,  17,    1,  -10 },   // 0x77 'w'
+  {  1421,  11,  11,  11,    0,  -10 },   // 0x78 'x'
+  {  1437,  11,  15,  11,    0,  -10 },   // 0x79 'y'
+  {  1458,   9,  11,  11,    1,  -10 },   // 0x7A 'z'
+  {  1471,   8,  18,  13,    3,  -14 },   // 0x7B '{'
+  {  1489,   2,  20,   7,    3,  -14 },   // 0x7C '|'
+  {  1494,   8,  18,  13,    2,  -14 },   // 0x7D '}'
+  {  1512,  13,   4,  17,    2,   -7 },   // 0x7E '~'
+  {  1519,  10,  18,  12,    1,  -13 },   // 0x7F
+  {  1542,  10,  18,  12,    1,  -13 },   // 0x80
+  {  1565,  10,  18,  12,    1,  -13 },   // 0x81
+  {  1588,  10,  18,  12,    1,  -13 },   // 0x82
+  {  1611,  10,  18,  12,    1,  -13 },   // 0x83
+  {  1634,  10,  18,  12,    1,  -13 },   // 0x84
+  {  1657,  10,  18,  12,    1,  -13 },   // 0x85
+  {  1680,  10,  18,  12,    1,  -13 },   // 0x86
+  {  1703,  10,  18,  12,    1,  -13 },   // 0x87
+  {  1726,  10,  18,  12,    1,  -13 },   // 0x88
+  {  1749,  10,  18,  12,    1,  -13 },   // 0x89
+  {  1772,  10,  18,  12,    1,  -13 },   // 0x8A
+  {  1795,  10,  18,  12,    1,  -13 },   // 0x8B
+  {  1818,  10,  18,  12,    1,  -13 },   // 0x8C
+  {  1841,  10,  18,  12,    1,  -13 },   // 0x8D
+  {  1864,  10,  18,  12,    1,  -13 },   // 0x8E
+  {  1887,  10,  18,  12,    1,  -13 },   // 0x8F
+  {  1910,  10,  18,  12,    1,  -13 },   // 0x90
+  {  1933,  10,  18,  12,    1,  -13 },   // 0x91
+  {  1956,  10,  18,  12,    1,  -13 },   // 0x92
+  {  1979,  10,  18,  12,    1,  -13 },   // 0x93
+  {  2002,  10,  18,  12,    1,  -13 },   // 0x94
+  {  2025,  10,  18,  12,    1,  -13 },   // 0x95
+  {  2048,  10,  18,  12,    1,  -13 },   // 0x96
+  {  2071,  10,  18,  12,    1,  -13 },   // 0x97
+  {  2094,  10,  18,  12,    1,  -13 },   // 0x98
+  {  2117,  10,  18,  12,    1,  -13 },   // 0x99
+  {  2140,  10,  18,  12,    1,  -13 },   // 0x9A
+  {  2163,  10,  18,  12,    1,  -13 },   // 0x9B
+  {  2186,  10,  18,  12,    1,  -13 },   // 0x9C
+  {  2209,  10,  18,  12,    1,  -13 },   // 0x9D
+  {  2232,  10,  18,  12,    1,  -13 },   // 0x9E
+  {  2255,  10,  18,  12,    1,  -13 },   // 0x9F
+  {  2278,   1,   1,   6,    0,    0 },   // 0xA0
+  {  2279,   2,  15,   8,    3,  -10 },   // 0xA1
+  {  2283,   9,  17,  13,    2,  -13 },   // 0xA2
+  {  2303,   9,  15,  13,    2,  -14 },   // 0xA3
+  {  2320,  10,  10,  13,    1,  -10 },   // 0xA4
+  {  2333,  12,  15,  13,    0,  -14 },   // 0xA5
+  {  2356,   2,  17,   7,    3,  -13 },   // 0xA6
+  {  2361,   8,  17,  10,    1,  -14 },   // 0xA7
+  {  2378,   6,   2,  10,    2,  -14 },   // 0xA8
+  {  2380,  14,  15,  20,    3,  -14 },   // 0xA9
+  {  2407,   8,  10,   9,    1,  -14 },   // 0xAA
+  {  2417,  10,   9,  12,    2,   -9 },   // 0xAB
+  {  2429,  13,   6,  17,    2,   -7 },   // 0xAC
+  {  2439,   5,   2,   7,    1,   -6 },   // 0xAD
+  {  2441,  15,  15,  20,    3,  -14 },   // 0xAE
+  {  2470,   6,   2,  10,    2,  -14 },   // 0xAF
+  {  2472,   6,   6,  10,    2,  -14 },   // 0xB0
+  {  2477,  12,  13,  17,    3,  -12 },   // 0xB1
+  {  2497,   6,   8,   8,    1,  -14 },   // 0xB2
+  {  2503,   6,   8,   8,    1,  -14 },   // 0xB3
+  {  2509,   5,   4,  10,    3,  -15 },   // 0xB4
+  {  2512,  10,  15,  13,    2,  -10 },   // 0xB5
+  {  2531,   9,  17,  13,    2,  -14 },   // 0xB6
+  {  2551,   2,   2,   6,    2,   -7 },   // 0xB7
+  {  2552,   4,   4,  10,    3,    1 },   // 0xB8
+  {  2554,   5,   8,   8,    2,  -14 },   // 0xB9
+  {  2559,   8,  10,   9,    1,  -14 },   // 0xBA
+  {  2569,  10,   9,  12,    2,   -9 },   // 0xBB
+  {  2581,  16,  15,  19,    2,  -14 },   // 0xBC
+  {  2611,  16,  15,  19,    2,  -14 },   // 0xBD
+  {  2641,  17,  15,  19,    1,  -14 },   // 0xBE
+  {  2673,   8,  15,  11,    1,  -10 },   // 0xBF
+  {  2688,  13,  19,  14,    0,  -18 },   // 0xC0
+  {  2719,  13,  19,  14,    0,  -18 },   // 0xC1
+  {  2750,  13,  19,  14,    0,  -18 },   // 0xC2
+  {  2781,  13,  18,  14,    0,  -17 },   // 0xC3
+  {  2811,  13,  19,  14,    0,  -18 },   // 0xC4
+  {  2842,  13,  19,  14,    0,  -18 },   // 0xC5
+  {  2873,  18,  15,  20,    0,  -14 },   // 0xC6
+  {  2907,  12,  19,  14,    1,  -14 },   // 0xC7
+  {  2936,   9,  19,  13,    2,  -18 },   // 0xC8
+  {  2958,   9,  19,  13,    2,  -18 },   // 0xC9
+  {  2980,   9,  19,  13,    2,  -18 },   // 0xCA
+  {  3002,   9,  19,  13,    2,  -18 },   // 0xCB
+  {  3024,   4,  19,   6,    1,  -18 },   // 0xCC
+  {  3034,   4,  19,   6,    2,  -18 },   // 0xCD
+  {  3044,   6,  19,   6,    0,  -18 },   // 0xCE
+  {  3059,   6,  19,   6,    0,  -18 },   // 0xCF
+  {  3074,  14,  15,  15,    0,  -14 },   // 0xD0
+  {  3101,  11,  18,  15,    2,  -17 },   // 0xD1
+  {  3126,  14,  19,  16,    1,  -18 },   // 0xD2
+  {  3160,  14,  19,  16,    1,  -18 },   // 0xD3
+  {  3194,  14,  19,  16,    1,  -18 },   // 0xD4
+  {  3228,  14,  18,  16,    1,  -17 },   // 0xD5
+  {  3260,  14,  19,  16,    1,  -18 },   // 0xD6
+  {  3294,  11,  11,  17,    3,  -11 },   // 0xD7
+  {  3310,  14,  15,  16,    1,  -14 },   // 0xD8
+  {  3337,  11,  19,  15,    2,  -18 },   // 0xD9
+  {  3364,  11,  19,  15,    2,  -18 },   // 0xDA
+  {  3391,  11,  19,  15,    2,  -18 },   // 0xDB
+  {  3418,  11,  19,  15,    2,  -18 },   // 0xDC
+  {  3445,  12,  19,  12,    0,  -18 },   // 0xDD
+  {  3474,   9,  15,  12,    2,  -14 },   // 0xDE
+  {  3491,  10,  15,  13,    2,  -14 },   // 0xDF
+  {  3510,   9,  16,  12,    1,  -15 },   // 0xE0
+  {  3528,   9,  16,  12,    1,  -15 },   // 0xE1
+  {  3546,   9,  16,  12,    1,  -15 },   // 0xE2
+  {  3564,   9,  16,  12,    1,  -15 },   // 0xE3
+  {  3582,   9,  15,  12,    1,  -14 },   // 0xE4
+  {  3599,   9,  17,  12,    1,  -16 },   // 0xE5
+  {  3619,  17,  11,  19,    1,  -10 },   // 0xE6
+  {  3643,   9,  15,  11,    1,  -10 },   // 0xE7
+  {  3660,  10,  16,  12,    1,  -15 },   // 0xE8
+  {  3680,  10,  16,  12,    1,  -15 },   // 0xE9
+  {  3700,  10,  16,  12,    1,  -15 },   // 0xEA
+  {  3720,  10,  15,  12,    1,  -14 },   // 0xEB
+  {  3739,   5,  16,   6,   -1,  -15 },   // 0xEC
+  {  3749,   5,  16,   6,    1,  -15 },   // 0xED
+  {  3759,   6,  16,   6,    0,  -15 },   // 0xEE
+  {  3771,   6,  15,   6,    0,  -14 },   // 0xEF
+  {  3783,  10,  15,  12,    1,  -14 },   // 0xF0
+  {  3802,   9,  16,  13,    2,  -15 },   // 0xF1
+  {  3820,  10,  16,  12,    1,  -15 },   // 0xF2
+  {  3840,  10,  16,  12,    1,  -15 },   // 0xF3
+  {  3860,  10,  16,  12,    1,  -15 },   // 0xF4
+  {  3880,  10,  16,  12,    1,  -15 },   // 0xF5
+  {  3900,  10,  15,  12,    1,  -14 },   // 0xF6
+  {  3919,  12,  10,  17,    2,  -10 },   // 0xF7
+  {  3934,  10,  13,  12,    1,  -11 },   // 0xF8
+  {  3951,   9,  16,  13,    2,  -15 },   // 0xF9
+  {  3969,   9,  16,  13,    2,  -15 },   // 0xFA
+  {  3987,   9,  16,  13,    2,  -15 },   // 0xFB
+  {  4005,   9,  15,  13,    2,  -14 },   // 0xFC
+  {  4022,  11,  20,  11,    0,  -15 },   // 0xFD
+  {  4050,  10,  19,  13,    2,  -14 },   // 0xFE
+  {  4074,  11,  19,  11,    0,  -14 } }; // 0xFF
+
+const GFXfont DejaVuSans10pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans10pt8bBitmaps,
+  (GFXglyph *)DejaVuSans10pt8bGlyphs,
+  0x20, 0xFF, 23 };
+
+// Approx. 5676 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans10pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   3,   8,   5 },   // 0x21
+  {   2,  10,   8 },   // 0x22
+  {   2,  17,  16 },   // 0x23
+  {   2,  13,  11 },   // 0x24
+  {   0,  19,  17 },   // 0x25
+  {   1,  15,  15 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   8,   6 },   // 0x28
+  {   2,   8,   6 },   // 0x29
+  {   0,  10,   9 },   // 0x2A
+  {   2,  17,  14 },   // 0x2B
+  {   1,   6,   4 },   // 0x2C
+  {   1,   7,   6 },   // 0x2D
+  {   2,   6,   4 },   // 0x2E
+  {   0,   7,   7 },   // 0x2F
+  {   1,  13,  11 },   // 0x30
+  {   2,  13,  11 },   // 0x31
+  {   1,  13,  10 },   // 0x32
+  {   1,  13,  11 },   // 0x33
+  {   1,  13,  12 },   // 0x34
+  {   1,  13,  10 },   // 0x35
+  {   1,  13,  11 },   // 0x36
+  {   1,  13,  11 },   // 0x37
+  {   1,  13,  11 },   // 0x38
+  {   1,  13,  11 },   // 0x39
+  {   2,   7,   4 },   // 0x3A
+  {   1,   7,   4 },   // 0x3B
+  {   2,  17,  15 },   // 0x3C
+  {   2,  17,  15 },   // 0x3D
+  {   2,  17,  15 },   // 0x3E
+  {   1,  11,   9 },   // 0x3F
+  {   1,  20,  19 },   // 0x40
+  {   0,  14,  13 },   // 0x41
+  {   2,  14,  12 },   // 0x42
+  {   1,  14,  13 },   // 0x43
+  {   2,  15,  14 },   // 0x44
+  {   2,  13,  11 },   // 0x45
+  {   2,  12,  10 },   // 0x46
+  {   1,  16,  14 },   // 0x47
+  {   2,  15,  13 },   // 0x48
+  {   2,   6,   4 },   // 0x49
+  {  -1,   6,   4 },   // 0x4A
+  {   2,  13,  14 },   // 0x4B
+  {   2,  11,  11 },   // 0x4C
+  {   2,  17,  15 },   // 0x4D
+  {   2,  15,  13 },   // 0x4E
+  {   1,  16,  15 },   // 0x4F
+  {   2,  12,  11 },   // 0x50
+  {   1,  16,  15 },   // 0x51
+  {   2,  14,  13 },   // 0x52
+  {   1,  13,  11 },   // 0x53
+  {   0,  12,  12 },   // 0x54
+  {   2,  15,  13 },   // 0x55
+  {   0,  14,  13 },   // 0x56
+  {   1,  20,  19 },   // 0x57
+  {   1,  14,  13 },   // 0x58
+  {   0,  12,  12 },   // 0x59
+  {   1,  14,  13 },   // 0x5A
+  {   2,   8,   6 },   // 0x5B
+  {   0,   7,   7 },   // 0x5C
+  {   2,   8,   6 },   // 0x5D
+  {   2,  17,  15 },   // 0x5E
+  {   0,  10,  10 },   // 0x5F
+  {   1,  10,   6 },   // 0x60
+  {   1,  12,  10 },   // 0x61
+  {   2,  13,  12 },   // 0x62
+  {   1,  11,  10 },   // 0x63
+  {   1,  13,  11 },   // 0x64
+  {   1,  12,  11 },   // 0x65
+  {   0,   7,   7 },   // 0x66
+  {   1,  13,  11 },   // 0x67
+  {   2,  13,  11 },   // 0x68
+  {   2,   6,   4 },   // 0x69
+  {   0,   6,   4 },   // 0x6A
+  {   2,  12,  12 },   // 0x6B
+  {   2,   6,   4 },   // 0x6C
+  {   2,  20,  18 },   // 0x6D
+  {   2,  13,  11 },   // 0x6E
+  {   1,  12,  11 },   // 0x6F
+  {   2,  13,  12 },   // 0x70
+  {   1,  13,  11 },   // 0x71
+  {   2,   8,   8 },   // 0x72
+  {   1,  10,   9 },   // 0x73
+  {   1,   8,   8 },   // 0x74
+  {   2,  13,  11 },   // 0x75
+  {   0,  11,  11 },   // 0x76
+  {   1,  17,  16 },   // 0x77
+  {   0,  11,  11 },   // 0x78
+  {   0,  11,  11 },   // 0x79
+  {   1,  11,  10 },   // 0x7A
+  {   3,  13,  11 },   // 0x7B
+  {   3,   7,   5 },   // 0x7C
+  {   2,  13,  10 },   // 0x7D
+  {   2,  17,  15 },   // 0x7E
+  {   1,  12,  11 },   // 0x7F
+  {   1,  12,  11 },   // 0x80
+  {   1,  12,  11 },   // 0x81
+  {   1,  12,  11 },   // 0x82
+  {   1,  12,  11 },   // 0x83
+  {   1,  12,  11 },   // 0x84
+  {   1,  12,  11 },   // 0x85
+  {   1,  12,  11 },   // 0x86
+  {   1,  12,  11 },   // 0x87
+  {   1,  12,  11 },   // 0x88
+  {   1,  12,  11 },   // 0x89
+  {   1,  12,  11 },   // 0x8A
+  {   1,  12,  11 },   // 0x8B
+  {   1,  12,  11 },   // 0x8C
+  {   1,  12,  11 },   // 0x8D
+  {   1,  12,  11 },   // 0x8E
+  {   1,  12,  11 },   // 0x8F
+  {   1,  12,  11 },   // 0x90
+  {   1,  12,  11 },   // 0x91
+  {   1,  12,  11 },   // 0x92
+  {   1,  12,  11 },   // 0x93
+  {   1,  12,  11 },   // 0x94
+  {   1,  12,  11 },   // 0x95
+  {   1,  12,  11 },   // 0x96
+  {   1,  12,  11 },   // 0x97
+  {   1,  12,  11 },   // 0x98
+  {   1,  12,  11 },   // 0x99
+  {   1,  12,  11 },   // 0x9A
+  {   1,  12,  11 },   // 0x9B
+  {   1,  12,  11 },   // 0x9C
+  {   1,  12,  11 },   // 0x9D
+  {   1,  12,  11 },   // 0x9E
+  {   1,  12,  11 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   3,   8,   5 },   // 0xA1
+  {   2,  13,  11 },   // 0xA2
+  {   2,  13,  11 },   // 0xA3
+  {   1,  13,  11 },   // 0xA4
+  {   0,  13,  12 },   // 0xA5
+  {   3,   7,   5 },   // 0xA6
+  {   1,  10,   9 },   // 0xA7
+  {   2,  10,   8 },   // 0xA8
+  {   3,  20,  17 },   // 0xA9
+  {   1,   9,   9 },   // 0xAA
+  {   2,  12,  12 },   // 0xAB
+  {   2,  17,  15 },   // 0xAC
+  {   1,   7,   6 },   // 0xAD
+  {   3,  20,  18 },   // 0xAE
+  {   2,  10,   8 },   // 0xAF
+  {   2,  10,   8 },   // 0xB0
+  {   3,  17,  15 },   // 0xB1
+  {   1,   8,   7 },   // 0xB2
+  {   1,   8,   7 },   // 0xB3
+  {   3,  10,   8 },   // 0xB4
+  {   2,  13,  12 },   // 0xB5
+  {   2,  13,  11 },   // 0xB6
+  {   2,   6,   4 },   // 0xB7
+  {   3,  10,   7 },   // 0xB8
+  {   2,   8,   7 },   // 0xB9
+  {   1,   9,   9 },   // 0xBA
+  {   2,  12,  12 },   // 0xBB
+  {   2,  19,  18 },   // 0xBC
+  {   2,  19,  18 },   // 0xBD
+  {   1,  19,  18 },   // 0xBE
+  {   1,  11,   9 },   // 0xBF
+  {   0,  14,  13 },   // 0xC0
+  {   0,  14,  13 },   // 0xC1
+  {   0,  14,  13 },   // 0xC2
+  {   0,  14,  13 },   // 0xC3
+  {   0,  14,  13 },   // 0xC4
+  {   0,  14,  13 },   // 0xC5
+  {   0,  20,  18 },   // 0xC6
+  {   1,  14,  13 },   // 0xC7
+  {   2,  13,  11 },   // 0xC8
+  {   2,  13,  11 },   // 0xC9
+  {   2,  13,  11 },   // 0xCA
+  {   2,  13,  11 },   // 0xCB
+  {   1,   6,   5 },   // 0xCC
+  {   2,   6,   6 },   // 0xCD
+  {   0,   6,   6 },   // 0xCE
+  {   0,   6,   6 },   // 0xCF
+  {   0,  15,  14 },   // 0xD0
+  {   2,  15,  13 },   // 0xD1
+  {   1,  16,  15 },   // 0xD2
+  {   1,  16,  15 },   // 0xD3
+  {   1,  16,  15 },   // 0xD4
+  {   1,  16,  15 },   // 0xD5
+  {   1,  16,  15 },   // 0xD6
+  {   3,  17,  14 },   // 0xD7
+  {   1,  16,  15 },   // 0xD8
+  {   2,  15,  13 },   // 0xD9
+  {   2,  15,  13 },   // 0xDA
+  {   2,  15,  13 },   // 0xDB
+  {   2,  15,  13 },   // 0xDC
+  {   0,  12,  12 },   // 0xDD
+  {   2,  12,  11 },   // 0xDE
+  {   2,  13,  12 },   // 0xDF
+  {   1,  12,  10 },   // 0xE0
+  {   1,  12,  10 },   // 0xE1
+  {   1,  12,  10 },   // 0xE2
+  {   1,  12,  10 },   // 0xE3
+  {   1,  12,  10 },   // 0xE4
+  {   1,  12,  10 },   // 0xE5
+  {   1,  19,  18 },   // 0xE6
+  {   1,  11,  10 },   // 0xE7
+  {   1,  12,  11 },   // 0xE8
+  {   1,  12,  11 },   // 0xE9
+  {   1,  12,  11 },   // 0xEA
+  {   1,  12,  11 },   // 0xEB
+  {  -1,   6,   4 },   // 0xEC
+  {   1,   6,   6 },   // 0xED
+  {   0,   6,   6 },   // 0xEE
+  {   0,   6,   6 },   // 0xEF
+  {   1,  12,  11 },   // 0xF0
+  {   2,  13,  11 },   // 0xF1
+  {   1,  12,  11 },   // 0xF2
+  {   1,  12,  11 },   // 0xF3
+  {   1,  12,  11 },   // 0xF4
+  {   1,  12,  11 },   // 0xF5
+  {   1,  12,  11 },   // 0xF6
+  {   2,  17,  14 },   // 0xF7
+  {   1,  12,  11 },   // 0xF8
+  {   2,  13,  11 },   // 0xF9
+  {   2,  13,  11 },   // 0xFA
+  {   2,  13,  11 },   // 0xFB
+  {   2,  13,  11 },   // 0xFC
+  {   0,  11,  11 },   // 0xFD
+  {   2,  13,  12 },   // 0xFE
+  {   0,  11,  11 }    // 0xFF
+};
+const FontMetrics DejaVuSans10pt8bWidths = { DejaVuSans10pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS10PTLAT1__H
@@ -0,0 +1,876 @@
+#ifndef DEJAVUSANS11PTLAT1__H
+#define DEJAVUSANS11PTLAT1__H
+const uint8_t DejaVuSans11pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x03, 0x18,
+  0x04, 0x20, 0x18, 0xC0, 0x31, 0x87, 0xFF, 0xEF, 0xFF, 0xC1, 0x18, 0x06,
+  0x30, 0x0C, 0x61, 0xFF, 0xFB, 0xFF, 0xF0, 0xC6, 0x01, 0x8C, 0x02, 0x10,
+  0x0C, 0x60, 0x00, 0x04, 0x00, 0x80, 0x10, 0x1F, 0xC7, 0xFD, 0xC8, 0xB1,
+  0x06, 0x20, 0xF4, 0x0F, 0xE0, 0x7F, 0x02, 0x70, 0x46, 0x08, 0xE1, 0x3F,
+  0xFE, 0x3F, 0x00, 0x80, 0x10, 0x02, 0x00, 0x38, 0x04, 0x1B, 0x01, 0x0C,
+  0x60, 0x83, 0x18, 0x60, 0xC6, 0x10, 0x31, 0x88, 0x0C, 0x66, 0x01, 0xB1,
+  0x1C, 0x38, 0x8D, 0x80, 0x66, 0x30, 0x11, 0x8C, 0x08, 0x63, 0x02, 0x18,
+  0xC1, 0x06, 0x30, 0x80, 0xD8, 0x20, 0x1C, 0x0F, 0x80, 0x3F, 0x80, 0xE1,
+  0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x3F, 0x06, 0x67, 0x0D,
+  0x87, 0x33, 0x07, 0x66, 0x07, 0x8E, 0x07, 0x0E, 0x1F, 0x0F, 0xF7, 0x0F,
+  0x87, 0xFF, 0xF0, 0x19, 0x8C, 0xC6, 0x33, 0x18, 0xC6, 0x31, 0x8C, 0x61,
+  0x8C, 0x61, 0x8C, 0x30, 0xC3, 0x18, 0x63, 0x18, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0xC6, 0x33, 0x19, 0x80, 0x08, 0x04, 0x22, 0x2D, 0x61, 0xC0, 0xE1,
+  0xAD, 0x11, 0x08, 0x04, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x6D, 0xE8, 0xFF, 0xF0, 0xFC, 0x06,
+  0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18,
+  0x30, 0xC1, 0x80, 0x1F, 0x07, 0xF1, 0xC7, 0x30, 0x6C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x36, 0x0C, 0xE3, 0x8F, 0xE0,
+  0xF8, 0x3C, 0x3F, 0x0C, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF, 0x7E, 0x3F, 0xE8,
+  0x1C, 0x03, 0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60,
+  0x30, 0x18, 0x0F, 0xFF, 0xFF, 0x7E, 0x1F, 0xF3, 0x07, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x60, 0xF8, 0x1F, 0x80, 0x18, 0x01, 0x80, 0x30, 0x07, 0x01,
+  0xFF, 0xF3, 0xF8, 0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC0, 0x98, 0x33, 0x0C,
+  0x61, 0x0C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x7F, 0x9F, 0xE6, 0x01, 0x80, 0x60, 0x1F, 0x87, 0xF9, 0x0E, 0x01,
+  0xC0, 0x30, 0x0C, 0x03, 0x01, 0xE0, 0xEF, 0xF9, 0xF8, 0x0F, 0x87, 0xF8,
+  0xC1, 0x30, 0x06, 0x01, 0x80, 0x33, 0xC7, 0xFE, 0xF0, 0xDC, 0x0F, 0x81,
+  0xF0, 0x36, 0x06, 0xE1, 0x8F, 0xF0, 0xF8, 0xFF, 0xFF, 0xF0, 0x18, 0x06,
+  0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x1C, 0x06,
+  0x01, 0x80, 0xC0, 0x1F, 0x0F, 0xFB, 0x83, 0xE0, 0x3C, 0x07, 0x80, 0xD8,
+  0x31, 0xFC, 0x3F, 0x8C, 0x1B, 0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xDF, 0xF0,
+  0xF8, 0x1F, 0x0F, 0xF1, 0x87, 0x60, 0x6C, 0x0F, 0x81, 0xF0, 0x3B, 0x0F,
+  0x7F, 0xE3, 0xCC, 0x01, 0x80, 0x60, 0x0C, 0x83, 0x1F, 0xE1, 0xF0, 0xFC,
+  0x00, 0xFC, 0x6D, 0x80, 0x00, 0x6D, 0xE8, 0x00, 0x04, 0x00, 0xF0, 0x1F,
+  0x83, 0xF0, 0x3F, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x07,
+  0xE0, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x03, 0xF0,
+  0x01, 0xF0, 0x01, 0xF0, 0x07, 0xC0, 0x7C, 0x0F, 0xC1, 0xF8, 0x0F, 0x00,
+  0x20, 0x00, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x18, 0x18, 0x38, 0x18, 0x18,
+  0x0C, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x60, 0x30, 0x01, 0xF8, 0x01, 0xFF,
+  0xC0, 0x78, 0x1C, 0x1C, 0x00, 0xC7, 0x00, 0x0C, 0xC3, 0xD9, 0xF8, 0xFF,
+  0x1E, 0x38, 0xE3, 0xC6, 0x0C, 0x78, 0xC1, 0x8F, 0x18, 0x33, 0xE3, 0x8E,
+  0xEE, 0x3F, 0xF8, 0xC3, 0xDC, 0x1C, 0x00, 0x01, 0xC0, 0x10, 0x1E, 0x0E,
+  0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0x80, 0x07, 0x00, 0x1B, 0x00,
+  0x36, 0x00, 0xEE, 0x01, 0x8C, 0x03, 0x18, 0x0C, 0x18, 0x18, 0x30, 0x30,
+  0x60, 0xFF, 0xE1, 0xFF, 0xC7, 0x01, 0xCC, 0x01, 0x98, 0x03, 0x60, 0x03,
+  0xFF, 0x1F, 0xF3, 0x07, 0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x77, 0xFC, 0xFF,
+  0x98, 0x1B, 0x01, 0xE0, 0x3C, 0x07, 0x81, 0xFF, 0xF7, 0xF8, 0x07, 0xE0,
+  0xFF, 0x8E, 0x06, 0xE0, 0x16, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0,
+  0x06, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x9C, 0x0C, 0x7F, 0xC0, 0xFC,
+  0xFF, 0x07, 0xFE, 0x30, 0x39, 0x80, 0x6C, 0x03, 0xE0, 0x0F, 0x00, 0x78,
+  0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x6C, 0x03, 0x60, 0x73, 0xFF,
+  0x1F, 0xE0, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE,
+  0xFF, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xFE, 0xFF, 0x60, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x01, 0x80, 0x07, 0xC0, 0x7F, 0xC3, 0x81, 0x98, 0x02, 0x60,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x3F, 0xC0, 0xFF, 0x00, 0x3C, 0x00, 0xD8,
+  0x03, 0x70, 0x0C, 0xE0, 0x71, 0xFF, 0x81, 0xF8, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x19, 0xFD,
+  0xC0, 0xC0, 0xE6, 0x0E, 0x30, 0xE1, 0x8E, 0x0C, 0xE0, 0x6E, 0x03, 0xE0,
+  0x1E, 0x00, 0xF8, 0x06, 0xE0, 0x33, 0x81, 0x8E, 0x0C, 0x38, 0x60, 0xE3,
+  0x03, 0x98, 0x0E, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xE0, 0x3F, 0xC0, 0x7E, 0xC1, 0xBD, 0x83, 0x7B, 0x8E, 0xF3, 0x19,
+  0xE6, 0x33, 0xC6, 0xC7, 0x8D, 0x8F, 0x1F, 0x1E, 0x1C, 0x3C, 0x38, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xE0, 0x3F, 0x03, 0xF0, 0x3F, 0x83, 0xD8,
+  0x3C, 0xC3, 0xCC, 0x3C, 0x63, 0xC6, 0x3C, 0x33, 0xC3, 0x3C, 0x1B, 0xC1,
+  0xFC, 0x0F, 0xC0, 0xFC, 0x07, 0x07, 0xC0, 0x3F, 0xE0, 0xE0, 0xE3, 0x80,
+  0xE6, 0x00, 0xD8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1B, 0x00, 0x67, 0x01, 0xC7, 0x07, 0x07, 0xFC, 0x03, 0xE0, 0xFF,
+  0x3F, 0xEC, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xFF, 0xBF, 0xCC,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xE0,
+  0xE3, 0x80, 0xE6, 0x00, 0xD8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07,
+  0x80, 0x0F, 0x00, 0x1B, 0x00, 0x67, 0x01, 0xC7, 0x07, 0x07, 0xFC, 0x03,
+  0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0xFF, 0x0F, 0xF8, 0xC1, 0xCC,
+  0x0C, 0xC0, 0xCC, 0x0C, 0xC1, 0xCF, 0xF8, 0xFF, 0x0C, 0x38, 0xC1, 0x8C,
+  0x0C, 0xC0, 0xCC, 0x06, 0xC0, 0x6C, 0x03, 0x1F, 0x8F, 0xFB, 0x81, 0x60,
+  0x0C, 0x01, 0x80, 0x3C, 0x03, 0xF8, 0x1F, 0xC0, 0x1C, 0x01, 0x80, 0x30,
+  0x07, 0x81, 0xFF, 0xF1, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8, 0xC0, 0x06, 0xC0,
+  0x19, 0x80, 0x33, 0x80, 0xE3, 0x01, 0x86, 0x03, 0x06, 0x0C, 0x0C, 0x18,
+  0x18, 0x30, 0x18, 0xC0, 0x31, 0x80, 0x77, 0x00, 0x6C, 0x00, 0xD8, 0x00,
+  0xE0, 0x01, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x60, 0xF0, 0x66, 0x0F,
+  0x06, 0x61, 0x98, 0x66, 0x19, 0x86, 0x31, 0x98, 0xC3, 0x19, 0x8C, 0x33,
+  0x0C, 0xC3, 0x30, 0xCC, 0x1B, 0x0D, 0x81, 0xB0, 0xD8, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x0E, 0x07, 0x00, 0xE0, 0x70, 0x70, 0x1C, 0xC0, 0x61, 0x83,
+  0x07, 0x18, 0x0C, 0xE0, 0x1B, 0x00, 0x78, 0x00, 0xE0, 0x07, 0x80, 0x1F,
+  0x00, 0xCC, 0x07, 0x18, 0x18, 0x70, 0xC0, 0xC7, 0x01, 0xB8, 0x07, 0xE0,
+  0x1D, 0xC0, 0xE3, 0x03, 0x06, 0x18, 0x1C, 0xE0, 0x33, 0x00, 0x78, 0x01,
+  0xE0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00,
+  0x30, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00,
+  0xE0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x70, 0x07, 0x00, 0x70, 0x03, 0x00,
+  0x30, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x18, 0xC6, 0x3F, 0xF0, 0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C,
+  0x18, 0x30, 0x30, 0x60, 0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C, 0xFF, 0xC6,
+  0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xF0, 0x07,
+  0x80, 0x3F, 0x01, 0xCE, 0x0E, 0x1C, 0x70, 0x3B, 0x80, 0x70, 0xFF, 0xFF,
+  0xFC, 0xC3, 0x0C, 0x30, 0x3F, 0x1F, 0xE4, 0x1C, 0x03, 0x3F, 0xDF, 0xFE,
+  0x0F, 0x03, 0xC1, 0xF8, 0xF7, 0xFC, 0xF3, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x9E, 0x3F, 0xE7, 0x8E, 0xE0, 0xF8, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0xC1, 0xFC, 0x77, 0xFC, 0xCF, 0x00, 0x1F, 0x8F, 0xF7, 0x07, 0x80,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x1C, 0x13, 0xFC, 0x7E, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x3C, 0xCF, 0xFB, 0x8F, 0xE0, 0xF8, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xDC, 0x79, 0xFF, 0x1E, 0x60, 0x1F, 0x07,
+  0xF9, 0xC3, 0x70, 0x3C, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x04,
+  0xFF, 0x8F, 0xE0, 0x0F, 0x1F, 0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1E, 0x67, 0xFD, 0xC7,
+  0xF0, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0, 0xEE, 0x3C, 0xFF, 0x8F,
+  0x30, 0x06, 0x01, 0xD0, 0x73, 0xFC, 0x3F, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x33, 0xCF, 0xFB, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xC0, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x33,
+  0x30, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x83, 0xB0, 0xE6, 0x38, 0xCE, 0x1F, 0x83,
+  0xC0, 0x7C, 0x0D, 0xC1, 0x9C, 0x31, 0xC6, 0x1C, 0xC1, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xCF, 0x0F, 0x3F, 0xEF, 0xEE, 0x1E, 0x1F, 0x03, 0x03,
+  0xC0, 0xC0, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03, 0xC0, 0xC0, 0xF0,
+  0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03, 0xCF, 0x3F, 0xEE, 0x1F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x1F, 0x07, 0xF1,
+  0xC7, 0x70, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0, 0xEE, 0x38, 0xFE,
+  0x0F, 0x80, 0xCF, 0x1F, 0xF3, 0xC7, 0x70, 0x7C, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xE0, 0xFE, 0x3B, 0xFE, 0x67, 0x8C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x00, 0x1E, 0x67, 0xFD, 0xC7, 0xF0, 0x7C, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xE0, 0xEE, 0x3C, 0xFF, 0x8F, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0xCF, 0xFF, 0x87, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x00, 0x3E, 0x3F, 0xB8, 0x58, 0x0E, 0x03, 0xF0, 0x7C, 0x03, 0x01, 0xC1,
+  0xFF, 0xCF, 0xC0, 0x60, 0xC1, 0x87, 0xFF, 0xEC, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xCF, 0x80, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x77, 0xFC, 0xF3, 0xC0, 0x36, 0x06, 0x60,
+  0x66, 0x06, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0x98, 0x19, 0x80, 0xF0, 0x0F,
+  0x00, 0xF0, 0xC3, 0xC3, 0xC3, 0xC3, 0x63, 0xC6, 0x63, 0xC6, 0x66, 0x66,
+  0x66, 0x6E, 0x36, 0x6C, 0x36, 0x6C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1C, 0x38,
+  0x1C, 0x38, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0x98, 0x0F, 0x00, 0xF0, 0x0F,
+  0x01, 0xF8, 0x19, 0x83, 0x0C, 0x70, 0xEE, 0x07, 0xC0, 0x36, 0x06, 0x60,
+  0x67, 0x0E, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0x98, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0x60, 0x06, 0x00, 0xC0, 0x0C, 0x07, 0x80, 0x78, 0x00, 0xFF, 0xFF,
+  0xF0, 0x18, 0x0C, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x30, 0x18, 0x0F, 0xFF,
+  0xFF, 0x0F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xF0,
+  0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C,
+  0x0F, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0x3E,
+  0x07, 0xFF, 0xFC, 0x1F, 0x00, 0x00, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0x00, 0xFC, 0x3F,
+  0xFF, 0xFF, 0x02, 0x00, 0x80, 0x20, 0x3E, 0x3F, 0xDC, 0x9E, 0x23, 0x08,
+  0xC2, 0x30, 0x8C, 0x23, 0x88, 0x72, 0x4F, 0xF0, 0xF8, 0x08, 0x02, 0x00,
+  0x80, 0x07, 0xC1, 0xFC, 0x70, 0x8C, 0x01, 0x80, 0x30, 0x06, 0x03, 0xFC,
+  0x7F, 0x83, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x3F, 0xFF, 0xFF, 0x80,
+  0x6D, 0xD9, 0xFF, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x31, 0x8C, 0x7F, 0xCD,
+  0xDA, 0x00, 0x80, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0x0C, 0x19, 0x81, 0x98,
+  0x7F, 0xE7, 0xFE, 0x0F, 0x00, 0x60, 0x7F, 0xE7, 0xFE, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x1F, 0x3F, 0x98, 0x0C,
+  0x03, 0x01, 0xE1, 0xB9, 0x86, 0xC1, 0xF0, 0xDC, 0x67, 0x60, 0xE0, 0x38,
+  0x0C, 0x06, 0x7F, 0x3E, 0x00, 0xCF, 0x30, 0x07, 0xE0, 0x18, 0x18, 0x30,
+  0x0C, 0x63, 0xC6, 0x4C, 0x22, 0x8C, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98,
+  0x01, 0x98, 0x01, 0x8C, 0x01, 0x4E, 0x22, 0x63, 0xC6, 0x30, 0x0C, 0x18,
+  0x18, 0x07, 0xE0, 0x3E, 0x47, 0x03, 0x3F, 0xE3, 0xC3, 0xC3, 0xE7, 0x7B,
+  0x00, 0xFF, 0x08, 0x46, 0x33, 0x9D, 0xCE, 0xE7, 0x39, 0xC7, 0x38, 0xE7,
+  0x18, 0xC2, 0x10, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0xFF, 0xF0, 0x07, 0xE0, 0x18, 0x18, 0x30, 0x0C, 0x67, 0xE6,
+  0x46, 0x32, 0x86, 0x31, 0x86, 0x31, 0x87, 0xE1, 0x86, 0x41, 0x86, 0x61,
+  0x86, 0x31, 0x46, 0x32, 0x66, 0x1E, 0x30, 0x0C, 0x18, 0x18, 0x07, 0xE0,
+  0xFF, 0xF0, 0x38, 0x8A, 0x0C, 0x18, 0x28, 0x8E, 0x00, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x03,
+  0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x7A, 0x30,
+  0xC3, 0x18, 0xE7, 0x38, 0xFC, 0xFC, 0x0C, 0x19, 0xC0, 0xE0, 0xC1, 0x87,
+  0xF8, 0x19, 0x99, 0x80, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC,
+  0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCE, 0x1C, 0xFF, 0xFD, 0xE7, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00, 0x3F, 0xDF, 0x3F, 0xCF, 0xF3, 0xFC,
+  0xFF, 0x3F, 0xCD, 0xF3, 0x1C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30,
+  0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xFC, 0x23, 0xFE, 0xF0, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0xFC, 0x3C, 0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C,
+  0x00, 0x7E, 0x84, 0x31, 0x8E, 0x71, 0xCE, 0x39, 0xCE, 0x77, 0x3B, 0x9C,
+  0xC6, 0x21, 0x00, 0xF0, 0x06, 0x06, 0x00, 0x80, 0xC0, 0x20, 0x18, 0x0C,
+  0x03, 0x01, 0x00, 0x60, 0x40, 0x0C, 0x18, 0x01, 0x82, 0x06, 0xFC, 0x81,
+  0xC0, 0x30, 0x58, 0x04, 0x0B, 0x01, 0x02, 0x60, 0x60, 0x8C, 0x08, 0x1F,
+  0xC2, 0x00, 0x30, 0xC0, 0x06, 0xF0, 0x06, 0x0C, 0x01, 0x03, 0x00, 0x80,
+  0xC0, 0x60, 0x30, 0x10, 0x0C, 0x08, 0x03, 0x06, 0x00, 0xC1, 0x1E, 0xFC,
+  0x88, 0xC0, 0x60, 0x30, 0x10, 0x0C, 0x08, 0x06, 0x06, 0x03, 0x81, 0x01,
+  0xC0, 0x80, 0xE0, 0x60, 0x3F, 0xFC, 0x03, 0x00, 0x60, 0x20, 0x06, 0x04,
+  0x03, 0x80, 0xC0, 0x0E, 0x08, 0x00, 0x61, 0x00, 0x06, 0x30, 0x00, 0xE2,
+  0x06, 0xF8, 0x40, 0xE0, 0x0C, 0x16, 0x00, 0x81, 0x60, 0x10, 0x26, 0x03,
+  0x04, 0x60, 0x20, 0x7F, 0x04, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x06, 0x03,
+  0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x1C, 0x1C, 0x1C, 0x0C, 0x0C, 0x06,
+  0x03, 0x82, 0xFF, 0x3F, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x60, 0x06, 0xC0, 0x1D, 0xC0,
+  0x31, 0x80, 0x63, 0x01, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x1F, 0xFC, 0x3F,
+  0xF8, 0xE0, 0x39, 0x80, 0x33, 0x00, 0x6C, 0x00, 0x60, 0x00, 0xC0, 0x03,
+  0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x60,
+  0x06, 0xC0, 0x1D, 0xC0, 0x31, 0x80, 0x63, 0x01, 0x83, 0x03, 0x06, 0x06,
+  0x0C, 0x1F, 0xFC, 0x3F, 0xF8, 0xE0, 0x39, 0x80, 0x33, 0x00, 0x6C, 0x00,
+  0x60, 0x03, 0x80, 0x0D, 0x80, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x00, 0xE0, 0x03, 0x60, 0x06, 0xC0, 0x1D, 0xC0, 0x31, 0x80, 0x63, 0x01,
+  0x83, 0x03, 0x06, 0x06, 0x0C, 0x1F, 0xFC, 0x3F, 0xF8, 0xE0, 0x39, 0x80,
+  0x33, 0x00, 0x6C, 0x00, 0x60, 0x07, 0x20, 0x13, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x70, 0x01, 0xB0, 0x03, 0x60, 0x0E, 0xE0, 0x18, 0xC0,
+  0x31, 0x80, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x0F, 0xFE, 0x1F, 0xFC, 0x70,
+  0x1C, 0xC0, 0x19, 0x80, 0x36, 0x00, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x70, 0x01, 0xB0, 0x03, 0x60, 0x0E, 0xE0,
+  0x18, 0xC0, 0x31, 0x80, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x0F, 0xFE, 0x1F,
+  0xFC, 0x70, 0x1C, 0xC0, 0x19, 0x80, 0x36, 0x00, 0x30, 0x03, 0x80, 0x08,
+  0x80, 0x20, 0x80, 0x41, 0x00, 0xC6, 0x00, 0xF8, 0x01, 0xB0, 0x07, 0x70,
+  0x0C, 0x60, 0x18, 0xC0, 0x71, 0xC0, 0xC1, 0x81, 0x83, 0x07, 0x07, 0x0C,
+  0x06, 0x1F, 0xFC, 0x7F, 0xFC, 0xC0, 0x19, 0x80, 0x37, 0x00, 0x7C, 0x00,
+  0x60, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0x03, 0x30, 0x00, 0x73, 0x00, 0x06,
+  0x30, 0x00, 0x63, 0x00, 0x0C, 0x30, 0x00, 0xC3, 0xFE, 0x18, 0x3F, 0xE1,
+  0x83, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x30, 0x30, 0x06, 0x03, 0x00,
+  0x60, 0x3F, 0xFC, 0x03, 0xFF, 0x07, 0xE0, 0xFF, 0x8E, 0x06, 0xE0, 0x16,
+  0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0xC0,
+  0x07, 0x00, 0x9C, 0x0C, 0x7F, 0xC0, 0xFC, 0x01, 0x00, 0x0C, 0x01, 0xE0,
+  0x0E, 0x00, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xBF, 0xEC, 0x03, 0x00, 0xC0, 0x30,
+  0x0C, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0x01, 0x80, 0xC0, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xBF, 0xEC, 0x03,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF, 0xFF, 0xC0, 0x0E, 0x06, 0xC3, 0x18,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF,
+  0xBF, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF, 0xFF, 0xC0, 0x33,
+  0x0C, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0xFE, 0xFF, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 0xFF,
+  0xC6, 0x30, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x36,
+  0xC0, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x3C, 0x66,
+  0xC3, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xCF, 0x30, 0x00, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0xC0,
+  0x7F, 0xE0, 0xC0, 0xE1, 0x80, 0x63, 0x00, 0xE6, 0x00, 0xCC, 0x01, 0xFF,
+  0x83, 0xFF, 0x06, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x73, 0x00, 0xC6, 0x07,
+  0x0F, 0xFC, 0x1F, 0xE0, 0x0C, 0x81, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x83, 0xD8, 0x3C, 0xC3, 0xCC, 0x3C, 0x63, 0xC6, 0x3C,
+  0x33, 0xC3, 0x3C, 0x1B, 0xC1, 0xFC, 0x0F, 0xC0, 0xFC, 0x07, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x1C,
+  0x1C, 0x70, 0x1C, 0xC0, 0x1B, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00,
+  0xF0, 0x01, 0xE0, 0x03, 0x60, 0x0C, 0xE0, 0x38, 0xE0, 0xE0, 0xFF, 0x80,
+  0x7C, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x07, 0xFC, 0x1C, 0x1C, 0x70, 0x1C, 0xC0, 0x1B, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0x60, 0x0C, 0xE0, 0x38,
+  0xE0, 0xE0, 0xFF, 0x80, 0x7C, 0x00, 0x03, 0x80, 0x0D, 0x80, 0x31, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x1C, 0x1C, 0x70, 0x1C, 0xC0,
+  0x1B, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0x60, 0x0C, 0xE0, 0x38, 0xE0, 0xE0, 0xFF, 0x80, 0x7C, 0x00, 0x07, 0x20,
+  0x13, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xFE, 0x0E, 0x0E, 0x38,
+  0x0E, 0x60, 0x0D, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00,
+  0xF0, 0x01, 0xB0, 0x06, 0x70, 0x1C, 0x70, 0x70, 0x7F, 0xC0, 0x3E, 0x00,
+  0x06, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xFE, 0x0E,
+  0x0E, 0x38, 0x0E, 0x60, 0x0D, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xB0, 0x06, 0x70, 0x1C, 0x70, 0x70, 0x7F, 0xC0,
+  0x3E, 0x00, 0x40, 0x2E, 0x07, 0x70, 0xE3, 0x9C, 0x1F, 0x80, 0xF0, 0x0F,
+  0x01, 0xF8, 0x39, 0xC7, 0x0E, 0xE0, 0x74, 0x02, 0x07, 0xC2, 0x3F, 0xE8,
+  0xE0, 0xF3, 0x80, 0xE6, 0x03, 0xD8, 0x0C, 0xF0, 0x31, 0xE0, 0xC3, 0xC3,
+  0x07, 0x8C, 0x0F, 0x30, 0x1B, 0xC0, 0x67, 0x01, 0xCF, 0x07, 0x17, 0xFC,
+  0x63, 0xE0, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E,
+  0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x06, 0x00, 0xF0, 0x19, 0x80, 0x00,
+  0x00, 0x0C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC,
+  0x1F, 0x80, 0x19, 0x81, 0x98, 0x00, 0x00, 0x00, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8, 0x01, 0x80, 0x0C, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x03, 0x80, 0x77, 0x03, 0x8C, 0x0C, 0x18, 0x60,
+  0x73, 0x80, 0xCC, 0x01, 0xE0, 0x07, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0xFC, 0xFF, 0xB0, 0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0xFE,
+  0xFF, 0x30, 0x0C, 0x03, 0x00, 0x3F, 0x0F, 0xF3, 0x87, 0x60, 0x6C, 0x3D,
+  0x8C, 0x33, 0x06, 0x60, 0xCE, 0x18, 0xF3, 0x07, 0x60, 0x7C, 0x07, 0x80,
+  0xF4, 0x3E, 0xFE, 0xCF, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x00,
+  0x03, 0xF1, 0xFE, 0x41, 0xC0, 0x33, 0xFD, 0xFF, 0xE0, 0xF0, 0x3C, 0x1F,
+  0x8F, 0x7F, 0xCF, 0x30, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x00, 0x00, 0x03,
+  0xF1, 0xFE, 0x41, 0xC0, 0x33, 0xFD, 0xFF, 0xE0, 0xF0, 0x3C, 0x1F, 0x8F,
+  0x7F, 0xCF, 0x30, 0x0C, 0x07, 0x81, 0x20, 0xCC, 0x00, 0x00, 0x03, 0xF1,
+  0xFE, 0x41, 0xC0, 0x33, 0xFD, 0xFF, 0xE0, 0xF0, 0x3C, 0x1F, 0x8F, 0x7F,
+  0xCF, 0x30, 0x19, 0x0B, 0x42, 0x60, 0x00, 0x00, 0x0F, 0xC7, 0xF9, 0x07,
+  0x00, 0xCF, 0xF7, 0xFF, 0x83, 0xC0, 0xF0, 0x7E, 0x3D, 0xFF, 0x3C, 0xC0,
+  0x33, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF9, 0x07, 0x00, 0xCF,
+  0xF7, 0xFF, 0x83, 0xC0, 0xF0, 0x7E, 0x3D, 0xFF, 0x3C, 0xC0, 0x1E, 0x0C,
+  0xC2, 0x10, 0x84, 0x33, 0x07, 0x80, 0x00, 0xFC, 0x7F, 0x90, 0x70, 0x0C,
+  0xFF, 0x7F, 0xF8, 0x3C, 0x0F, 0x07, 0xE3, 0xDF, 0xF3, 0xCC, 0x3F, 0x1F,
+  0x0F, 0xF7, 0xF9, 0x07, 0xC3, 0x00, 0x70, 0x33, 0xFC, 0x06, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xFE, 0x06, 0x00, 0xC0, 0xE0, 0x1C, 0x3E, 0x05, 0xFC, 0xFF,
+  0x9E, 0x07, 0xE0, 0x1F, 0x8F, 0xF7, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xE0, 0x1C, 0x13, 0xFC, 0x7E, 0x02, 0x00, 0xC0, 0xF0, 0x38, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0x70, 0xDC,
+  0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x38, 0x03, 0x81, 0x3F, 0xE3, 0xF8,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0x70,
+  0xDC, 0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x38, 0x03, 0x81, 0x3F, 0xE3,
+  0xF8, 0x0E, 0x01, 0x40, 0x6C, 0x18, 0xC0, 0x00, 0x00, 0x07, 0xC1, 0xFE,
+  0x70, 0xDC, 0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x38, 0x03, 0x81, 0x3F,
+  0xE3, 0xF8, 0x19, 0x83, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xF3,
+  0x86, 0xE0, 0x78, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xC0, 0x1C, 0x09, 0xFF,
+  0x1F, 0xC0, 0xC3, 0x0C, 0x30, 0x00, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x80, 0x19, 0x99, 0x80, 0x03, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18,
+  0xC6, 0x00, 0x18, 0x3C, 0x66, 0xC3, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xCF, 0x30, 0x00, 0x00,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x38, 0x43, 0xF8,
+  0x78, 0x3B, 0x80, 0x38, 0x3F, 0x0F, 0xF3, 0x86, 0xE0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3C, 0x07, 0xC1, 0xDC, 0x71, 0xFC, 0x1F, 0x00, 0x1C, 0x8B, 0xA2,
+  0x70, 0x00, 0x00, 0x33, 0xCF, 0xFB, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xC0, 0x30, 0x03, 0x00, 0x30, 0x03,
+  0x00, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x71, 0xDC, 0x1F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF8, 0x3B, 0x8E, 0x3F, 0x83, 0xE0, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x71, 0xDC, 0x1F, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF8, 0x3B, 0x8E, 0x3F, 0x83, 0xE0, 0x0E, 0x01, 0x40,
+  0x6C, 0x18, 0xC0, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x71, 0xDC, 0x1F, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x3B, 0x8E, 0x3F, 0x83, 0xE0, 0x1C, 0x85,
+  0xD0, 0x9C, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x8E, 0xE0, 0xF8, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xDC, 0x71, 0xFC, 0x1F, 0x00, 0x1B, 0x03,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x8E, 0xE0, 0xF8, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xDC, 0x71, 0xFC, 0x1F, 0x00, 0x03, 0x80,
+  0x07, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x23, 0xE4,
+  0xFF, 0x38, 0xEE, 0x1F, 0x86, 0xF1, 0x9E, 0x63, 0xD8, 0x7E, 0x1D, 0xC7,
+  0x3F, 0xC9, 0xF1, 0x00, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00,
+  0x0C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x87, 0x7F, 0xCF, 0x30, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x00, 0x0C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x87,
+  0x7F, 0xCF, 0x30, 0x0C, 0x07, 0x81, 0x20, 0xCC, 0x00, 0x00, 0x0C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x87, 0x7F,
+  0xCF, 0x30, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x30, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xFF, 0x3C, 0xC0,
+  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x36, 0x06,
+  0x60, 0x67, 0x0E, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0x98, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x0C, 0x07, 0x80, 0x78, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x9E, 0x3F, 0xE7, 0x8E, 0xE0, 0xF8,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xFC, 0x77, 0xFC, 0xCF, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x19, 0x81, 0x98, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0x03, 0x60, 0x66, 0x06, 0x70, 0xE3, 0x0C, 0x30, 0xC1, 0x98,
+  0x19, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0,
+  0x78, 0x07, 0x80 };
+
+const GFXglyph DejaVuSans11pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
+  {     1,   2,  16,   9,    3,  -15 },   // 0x21 '!'
+  {     5,   6,   6,  10,    2,  -15 },   // 0x22 '"'
+  {    10,  15,  15,  18,    2,  -14 },   // 0x23 '#'
+  {    39,  11,  20,  14,    2,  -16 },   // 0x24 '$'
+  {    67,  18,  16,  21,    1,  -15 },   // 0x25 '%'
+  {   103,  15,  16,  17,    1,  -15 },   // 0x26 '&'
+  {   133,   2,   6,   6,    2,  -15 },   // 0x27 '''
+  {   135,   5,  20,   9,    2,  -16 },   // 0x28 '('
+  {   148,   5,  20,   9,    2,  -16 },   // 0x29 ')'
+  {   161,   9,  10,  11,    1,  -15 },   // 0x2A '*'
+  {   173,  14,  14,  18,    2,  -13 },   // 0x2B '+'
+  {   198,   3,   5,   7,    2,   -2 },   // 0x2C ','
+  {   200,   6,   2,   8,    1,   -6 },   // 0x2D '-'
+  {   202,   2,   3,   7,    3,   -2 },   // 0x2E '.'
+  {   203,   7,  18,   7,    0,  -15 },   // 0x2F '/'
+  {   219,  11,  16,  14,    1,  -15 },   // 0x30 '0'
+  {   241,  10,  16,  14,    2,  -15 },   // 0x31 '1'
+  {   261,  10,  16,  14,    1,  -15 },   // 0x32 '2'
+  {   281,  11,  16,  14,    1,  -15 },   // 0x33 '3'
+  {   303,  11,  16,  14,    1,  -15 },   // 0x34 '4'
+  {   325,  10,  16,  14,    1,  -15 },   // 0x35 '5'
+  {   345,  11,  16,  14,    1,  -15 },   // 0x36 '6'
+  {   367,  10,  16,  14,    1,  -15 },   // 0x37 '7'
+  {   387,  11,  16,  14,    1,  -15 },   // 0x38 '8'
+  {   409,  11,  16,  14,    1,  -15 },   // 0x39 '9'
+  {   431,   2,  11,   7,    3,  -10 },   // 0x3A ':'
+  {   434,   3,  13,   7,    2,  -10 },   // 0x3B ';'
+  {   439,  14,  12,  18,    2,  -12 },   // 0x3C '<'
+  {   460,  14,   7,  18,    2,  -10 },   // 0x3D '='
+  {   473,  14,  12,  18,    2,  -12 },   // 0x3E '>'
+  {   494,   9,  16,  12,    2,  -15 },   // 0x3F '?'
+  {   512,  19,  19,  22,    1,  -14 },   // 0x40 '@'
+  {   558,  15,  16,  15,    0,  -15 },   // 0x41 'A'
+  {   588,  11,  16,  15,    2,  -15 },   // 0x42 'B'
+  {   610,  13,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   636,  13,  16,  17,    2,  -15 },   // 0x44 'D'
+  {   662,  10,  16,  14,    2,  -15 },   // 0x45 'E'
+  {   682,   9,  16,  13,    2,  -15 },   // 0x46 'F'
+  {   700,  14,  16,  17,    1,  -15 },   // 0x47 'G'
+  {   728,  12,  16,  17,    2,  -15 },   // 0x48 'H'
+  {   752,   2,  16,   6,    2,  -15 },   // 0x49 'I'
+  {   756,   5,  20,   6,   -1,  -15 },   // 0x4A 'J'
+  {   769,  13,  16,  14,    2,  -15 },   // 0x4B 'K'
+  {   795,  10,  16,  12,    2,  -15 },   // 0x4C 'L'
+  {   815,  15,  16,  19,    2,  -15 },   // 0x4D 'M'
+  {   845,  12,  16,  16,    2,  -15 },   // 0x4E 'N'
+  {   869,  15,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {   899,  10,  16,  13,    2,  -15 },   // 0x50 'P'
+  {   919,  15,  19,  17,    1,  -15 },   // 0x51 'Q'
+  {   955,  12,  16,  15,    2,  -15 },   // 0x52 'R'
+  {   979,  11,  16,  14,    1,  -15 },   // 0x53 'S'
+  {  1001,  14,  16,  13,    0,  -15 },   // 0x54 'T'
+  {  1029,  12,  16,  16,    2,  -15 },   // 0x55 'U'
+  {  1053,  15,  16,  15,    0,  -15 },   // 0x56 'V'
+  {  1083,  20,  16,  22,    1,  -15 },   // 0x57 'W'
+  {  1123,  14,  16,  16,    1,  -15 },   // 0x58 'X'
+  {  1151,  14,  16,  13,    0,  -15 },   // 0x59 'Y'
+  {  1179,  13,  16,  15,    1,  -15 },   // 0x5A 'Z'
+  {  1205,   5,  20,   9,    2,  -16 },   // 0x5B '['
+  {  1218,   7,  18,   7,    0,  -15 },   // 0x5C '\'
+  {  1234,   5,  20,   9,    2,  -16 },   // 0x5D ']'
+  {  1247,  14,   6,  18,    2,  -15 },   // 0x5E '^'
+  {  1258,  11,   2,  11,    0,    4 },   // 0x5F '_'
+  {  1261,   5,   4,  11,    2,  -17 },   // 0x60 '`'
+  {  1264,  10,  12,  13,    1,  -11 },   // 0x61 'a'
+  {  1279,  11,  17,  14,    2,  -16 },   // 0x62 'b'
+  {  1303,  10,  12,  12,    1,  -11 },   // 0x63 'c'
+  {  1318,  11,  17,  14,    1,  -16 },   // 0x64 'd'
+  {  1342,  11,  12,  13,    1,  -11 },   // 0x65 'e'
+  {  1359,   8,  17,   8,    0,  -16 },   // 0x66 'f'
+  {  1376,  11,  17,  14,    1,  -11 },   // 0x67 'g'
+  {  1400,  10,  17,  14,    2,  -16 },   // 0x68 'h'
+  {  1422,   2,  17,   6,    2,  -16 },   // 0x69 'i'
+  {  1427,   4,  22,   6,    0,  -16 },   // 0x6A 'j'
+  {  1438,  11,  17,  13,    2,  -16 },   // 0x6B 'k'
+  {  1462,   2,  17,   6,    2,  -16 },   // 0x6C 'l'
+  {  1467,  18,  12,  22,    2,  -11 },   // 0x6D 'm'
+  {  1494,  10,  12,  14,    2,  -11 },   // 0x6E 'n'
+  {  1509,  11,  12,  13,    1,  -11 },   // 0x6F 'o'
+  {  1526,  11,  17,  14,    2,  -11 },   // 0x70 'p'
+  {  1550,  11,  17,  14,    1,  -11 },   // 0x71 'q'
+  {  1574,   7,  12,   9,    2,  -11 },   // 0x72 'r'
+  {  1585,   9,  12,  11,    1,  -11 },   // 0x73 's'
+  {  1599,   7,  15,   9,    1,  -14 },   // 0x74 't'
+  {  1613,  10,  12,  14,    2,  -11 },   // 0x75 'u'
+  {  1628,  12,  12,  14,    1,  -11 },   // 0x76 'v'
+  {  1646,  16,  12,  18,    1,  -11 },   // 0x77 'w'
+  {  1670,  12,  12,  14,    1,  -11 },   // 0x78 'x'
+  {  1688,  12,  17,  14,    1,  -11 },   // 0x79 'y'
+  {  1714,  10,  12,  12,    1,  -11 },   // 0x7A 'z'
+  {  1729,   8,  20,  14,    3,  -16 },   // 0x7B '{'
+  {  1749,   2,  22,   7,    3,  -16 },   // 0x7C '|'
+  {  1755,   8,  20,  14,    3,  -16 },   // 0x7D '}'
+  {  1775,  14,   4,  18,    2,   -8 },   // 0x7E '~'
+  {  1782,  11,  19,  13,    1,  -15 },   // 0x7F
+  {  1809,  11,  19,  13,    1,  -15 },   // 0x80
+  {  1836,  11,  19,  13,    1,  -15 },   // 0x81
+  {  1863,  11,  19,  13,    1,  -15 },   // 0x82
+  {  1890,  11,  19,  13,    1,  -15 },   // 0x83
+  {  1917,  11,  19,  13,    1,  -15 },   // 0x84
+  {  1944,  11,  19,  13,    1,  -15 },   // 0x85
+  {  1971,  11,  19,  13,    1,  -15 },   // 0x86
+  {  1998,  11,  19,  13,    1,  -15 },   // 0x87
+  {  2025,  11,  19,  13,    1,  -15 },   // 0x88
+  {  2052,  11,  19,  13,    1,  -15 },   // 0x89
+  {  2079,  11,  19,  13,    1,  -15 },   // 0x8A
+  {  2106,  11,  19,  13,    1,  -15 },   // 0x8B
+  {  2133,  11,  19,  13,    1,  -15 },   // 0x8C
+  {  2160,  11,  19,  13,    1,  -15 },   // 0x8D
+  {  2187,  11,  19,  13,    1,  -15 },   // 0x8E
+  {  2214,  11,  19,  13,    1,  -15 },   // 0x8F
+  {  2241,  11,  19,  13,    1,  -15 },   // 0x90
+  {  2268,  11,  19,  13,    1,  -15 },   // 0x91
+  {  2295,  11,  19,  13,    1,  -15 },   // 0x92
+  {  2322,  11,  19,  13,    1,  -15 },   // 0x93
+  {  2349,  11,  19,  13,    1,  -15 },   // 0x94
+  {  2376,  11,  19,  13,    1,  -15 },   // 0x95
+  {  2403,  11,  19,  13,    1,  -15 },   // 0x96
+  {  2430,  11,  19,  13,    1,  -15 },   // 0x97
+  {  2457,  11,  19,  13,    1,  -15 },   // 0x98
+  {  2484,  11,  19,  13,    1,  -15 },   // 0x99
+  {  2511,  11,  19,  13,    1,  -15 },   // 0x9A
+  {  2538,  11,  19,  13,    1,  -15 },   // 0x9B
+  {  2565,  11,  19,  13,    1,  -15 },   // 0x9C
+  {  2592,  11,  19,  13,    1,  -15 },   // 0x9D
+  {  2619,  11,  19,  13,    1,  -15 },   // 0x9E
+  {  2646,  11,  19,  13,    1,  -15 },   // 0x9F
+  {  2673,   1,   1,   7,    0,    0 },   // 0xA0
+  {  2674,   2,  16,   9,    3,  -11 },   // 0xA1
+  {  2678,  10,  18,  14,    2,  -14 },   // 0xA2
+  {  2701,  11,  16,  14,    1,  -15 },   // 0xA3
+  {  2723,  11,  11,  14,    1,  -11 },   // 0xA4
+  {  2739,  12,  16,  14,    1,  -15 },   // 0xA5
+  {  2763,   2,  19,   7,    3,  -14 },   // 0xA6
+  {  2768,   9,  18,  11,    1,  -15 },   // 0xA7
+  {  2789,   6,   2,  11,    2,  -16 },   // 0xA8
+  {  2791,  16,  16,  22,    3,  -15 },   // 0xA9
+  {  2823,   8,  11,  10,    1,  -15 },   // 0xAA
+  {  2834,  10,  10,  13,    2,  -10 },   // 0xAB
+  {  2847,  14,   6,  18,    2,   -8 },   // 0xAC
+  {  2858,   6,   2,   8,    1,   -6 },   // 0xAD
+  {  2860,  16,  16,  22,    3,  -15 },   // 0xAE
+  {  2892,   6,   2,  11,    2,  -15 },   // 0xAF
+  {  2894,   7,   7,  11,    2,  -15 },   // 0xB0
+  {  2901,  14,  14,  18,    2,  -13 },   // 0xB1
+  {  2926,   6,   9,   9,    1,  -15 },   // 0xB2
+  {  2933,   7,   9,   9,    1,  -15 },   // 0xB3
+  {  2941,   5,   4,  11,    4,  -17 },   // 0xB4
+  {  2944,  12,  17,  14,    2,  -11 },   // 0xB5
+  {  2970,  10,  18,  14,    2,  -15 },   // 0xB6
+  {  2993,   2,   3,   7,    2,   -8 },   // 0xB7
+  {  2994,   4,   4,  11,    3,    1 },   // 0xB8
+  {  2996,   6,   9,   9,    2,  -15 },   // 0xB9
+  {  3003,   8,  11,  10,    1,  -15 },   // 0xBA
+  {  3014,  10,  10,  13,    2,  -10 },   // 0xBB
+  {  3027,  19,  16,  21,    2,  -15 },   // 0xBC
+  {  3065,  18,  16,  21,    2,  -15 },   // 0xBD
+  {  3101,  20,  16,  21,    1,  -15 },   // 0xBE
+  {  3141,   9,  17,  12,    2,  -11 },   // 0xBF
+  {  3161,  15,  21,  15,    0,  -20 },   // 0xC0
+  {  3201,  15,  21,  15,    0,  -20 },   // 0xC1
+  {  3241,  15,  21,  15,    0,  -20 },   // 0xC2
+  {  3281,  15,  20,  15,    0,  -19 },   // 0xC3
+  {  3319,  15,  20,  15,    0,  -19 },   // 0xC4
+  {  3357,  15,  21,  15,    0,  -20 },   // 0xC5
+  {  3397,  20,  16,  21,    0,  -15 },   // 0xC6
+  {  3437,  13,  20,  15,    1,  -15 },   // 0xC7
+  {  3470,  10,  21,  14,    2,  -20 },   // 0xC8
+  {  3497,  10,  21,  14,    2,  -20 },   // 0xC9
+  {  3524,  10,  21,  14,    2,  -20 },   // 0xCA
+  {  3551,  10,  20,  14,    2,  -19 },   // 0xCB
+  {  3576,   4,  21,   6,    1,  -20 },   // 0xCC
+  {  3587,   4,  21,   6,    2,  -20 },   // 0xCD
+  {  3598,   8,  21,   6,   -1,  -20 },   // 0xCE
+  {  3619,   6,  20,   6,    0,  -19 },   // 0xCF
+  {  3634,  15,  16,  17,    0,  -15 },   // 0xD0
+  {  3664,  12,  20,  16,    2,  -19 },   // 0xD1
+  {  3694,  15,  21,  17,    1,  -20 },   // 0xD2
+  {  3734,  15,  21,  17,    1,  -20 },   // 0xD3
+  {  3774,  15,  21,  17,    1,  -20 },   // 0xD4
+  {  3814,  15,  20,  17,    1,  -19 },   // 0xD5
+  {  3852,  15,  20,  17,    1,  -19 },   // 0xD6
+  {  3890,  12,  12,  18,    3,  -12 },   // 0xD7
+  {  3908,  15,  16,  17,    1,  -15 },   // 0xD8
+  {  3938,  12,  21,  16,    2,  -20 },   // 0xD9
+  {  3970,  12,  21,  16,    2,  -20 },   // 0xDA
+  {  4002,  12,  21,  16,    2,  -20 },   // 0xDB
+  {  4034,  12,  20,  16,    2,  -19 },   // 0xDC
+  {  4064,  14,  21,  13,    0,  -20 },   // 0xDD
+  {  4101,  10,  16,  13,    2,  -15 },   // 0xDE
+  {  4121,  11,  17,  14,    2,  -16 },   // 0xDF
+  {  4145,  10,  18,  13,    1,  -17 },   // 0xE0
+  {  4168,  10,  18,  13,    1,  -17 },   // 0xE1
+  {  4191,  10,  18,  13,    1,  -17 },   // 0xE2
+  {  4214,  10,  17,  13,    1,  -16 },   // 0xE3
+  {  4236,  10,  17,  13,    1,  -16 },   // 0xE4
+  {  4258,  10,  19,  13,    1,  -18 },   // 0xE5
+  {  4282,  19,  12,  21,    1,  -11 },   // 0xE6
+  {  4311,  10,  16,  12,    1,  -11 },   // 0xE7
+  {  4331,  11,  18,  13,    1,  -17 },   // 0xE8
+  {  4356,  11,  18,  13,    1,  -17 },   // 0xE9
+  {  4381,  11,  18,  13,    1,  -17 },   // 0xEA
+  {  4406,  11,  17,  13,    1,  -16 },   // 0xEB
+  {  4430,   5,  18,   6,    0,  -17 },   // 0xEC
+  {  4442,   5,  18,   6,    2,  -17 },   // 0xED
+  {  4454,   8,  18,   6,   -1,  -17 },   // 0xEE
+  {  4472,   6,  17,   6,    0,  -16 },   // 0xEF
+  {  4485,  11,  17,  13,    1,  -16 },   // 0xF0
+  {  4509,  10,  17,  14,    2,  -16 },   // 0xF1
+  {  4531,  11,  18,  13,    1,  -17 },   // 0xF2
+  {  4556,  11,  18,  13,    1,  -17 },   // 0xF3
+  {  4581,  11,  18,  13,    1,  -17 },   // 0xF4
+  {  4606,  11,  17,  13,    1,  -16 },   // 0xF5
+  {  4630,  11,  17,  13,    1,  -16 },   // 0xF6
+  {  4654,  15,  12,  18,    2,  -12 },   // 0xF7
+  {  4677,  11,  14,  13,    1,  -12 },   // 0xF8
+  {  4697,  10,  18,  14,    2,  -17 },   // 0xF9
+  {  4720,  10,  18,  14,    2,  -17 },   // 0xFA
+  {  4743,  10,  18,  14,    2,  -17 },   // 0xFB
+  {  4766,  10,  17,  14,    2,  -16 },   // 0xFC
+  {  4788,  12,  23,  14,    1,  -17 },   // 0xFD
+  {  4823,  11,  22,  14,    2,  -16 },   // 0xFE
+  {  4854,  12,  22,  14,    1,  -16 } }; // 0xFF
+
+const GFXfont DejaVuSans11pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans11pt8bBitmaps,
+  (GFXglyph *)DejaVuSans11pt8bGlyphs,
+  0x20, 0xFF, 25 };
+
+// Approx. 6462 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans11pt8bMetrics[] PROGMEM = {
+  {   0,   7,   1 },   // 0x20
+  {   3,   9,   5 },   // 0x21
+  {   2,  10,   8 },   // 0x22
+  {   2,  18,  17 },   // 0x23
+  {   2,  14,  13 },   // 0x24
+  {   1,  21,  19 },   // 0x25
+  {   1,  17,  16 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   9,   7 },   // 0x28
+  {   2,   9,   7 },   // 0x29
+  {   1,  11,  10 },   // 0x2A
+  {   2,  18,  16 },   // 0x2B
+  {   2,   7,   5 },   // 0x2C
+  {   1,   8,   7 },   // 0x2D
+  {   3,   7,   5 },   // 0x2E
+  {   0,   7,   7 },   // 0x2F
+  {   1,  14,  12 },   // 0x30
+  {   2,  14,  12 },   // 0x31
+  {   1,  14,  11 },   // 0x32
+  {   1,  14,  12 },   // 0x33
+  {   1,  14,  12 },   // 0x34
+  {   1,  14,  11 },   // 0x35
+  {   1,  14,  12 },   // 0x36
+  {   1,  14,  11 },   // 0x37
+  {   1,  14,  12 },   // 0x38
+  {   1,  14,  12 },   // 0x39
+  {   3,   7,   5 },   // 0x3A
+  {   2,   7,   5 },   // 0x3B
+  {   2,  18,  16 },   // 0x3C
+  {   2,  18,  16 },   // 0x3D
+  {   2,  18,  16 },   // 0x3E
+  {   2,  12,  11 },   // 0x3F
+  {   1,  22,  20 },   // 0x40
+  {   0,  15,  15 },   // 0x41
+  {   2,  15,  13 },   // 0x42
+  {   1,  15,  14 },   // 0x43
+  {   2,  17,  15 },   // 0x44
+  {   2,  14,  12 },   // 0x45
+  {   2,  13,  11 },   // 0x46
+  {   1,  17,  15 },   // 0x47
+  {   2,  17,  14 },   // 0x48
+  {   2,   6,   4 },   // 0x49
+  {  -1,   6,   4 },   // 0x4A
+  {   2,  14,  15 },   // 0x4B
+  {   2,  12,  12 },   // 0x4C
+  {   2,  19,  17 },   // 0x4D
+  {   2,  16,  14 },   // 0x4E
+  {   1,  17,  16 },   // 0x4F
+  {   2,  13,  12 },   // 0x50
+  {   1,  17,  16 },   // 0x51
+  {   2,  15,  14 },   // 0x52
+  {   1,  14,  12 },   // 0x53
+  {   0,  13,  14 },   // 0x54
+  {   2,  16,  14 },   // 0x55
+  {   0,  15,  15 },   // 0x56
+  {   1,  22,  21 },   // 0x57
+  {   1,  16,  15 },   // 0x58
+  {   0,  13,  14 },   // 0x59
+  {   1,  15,  14 },   // 0x5A
+  {   2,   9,   7 },   // 0x5B
+  {   0,   7,   7 },   // 0x5C
+  {   2,   9,   7 },   // 0x5D
+  {   2,  18,  16 },   // 0x5E
+  {   0,  11,  11 },   // 0x5F
+  {   2,  11,   7 },   // 0x60
+  {   1,  13,  11 },   // 0x61
+  {   2,  14,  13 },   // 0x62
+  {   1,  12,  11 },   // 0x63
+  {   1,  14,  12 },   // 0x64
+  {   1,  13,  12 },   // 0x65
+  {   0,   8,   8 },   // 0x66
+  {   1,  14,  12 },   // 0x67
+  {   2,  14,  12 },   // 0x68
+  {   2,   6,   4 },   // 0x69
+  {   0,   6,   4 },   // 0x6A
+  {   2,  13,  13 },   // 0x6B
+  {   2,   6,   4 },   // 0x6C
+  {   2,  22,  20 },   // 0x6D
+  {   2,  14,  12 },   // 0x6E
+  {   1,  13,  12 },   // 0x6F
+  {   2,  14,  13 },   // 0x70
+  {   1,  14,  12 },   // 0x71
+  {   2,   9,   9 },   // 0x72
+  {   1,  11,  10 },   // 0x73
+  {   1,   9,   8 },   // 0x74
+  {   2,  14,  12 },   // 0x75
+  {   1,  14,  13 },   // 0x76
+  {   1,  18,  17 },   // 0x77
+  {   1,  14,  13 },   // 0x78
+  {   1,  14,  13 },   // 0x79
+  {   1,  12,  11 },   // 0x7A
+  {   3,  14,  11 },   // 0x7B
+  {   3,   7,   5 },   // 0x7C
+  {   3,  14,  11 },   // 0x7D
+  {   2,  18,  16 },   // 0x7E
+  {   1,  13,  12 },   // 0x7F
+  {   1,  13,  12 },   // 0x80
+  {   1,  13,  12 },   // 0x81
+  {   1,  13,  12 },   // 0x82
+  {   1,  13,  12 },   // 0x83
+  {   1,  13,  12 },   // 0x84
+  {   1,  13,  12 },   // 0x85
+  {   1,  13,  12 },   // 0x86
+  {   1,  13,  12 },   // 0x87
+  {   1,  13,  12 },   // 0x88
+  {   1,  13,  12 },   // 0x89
+  {   1,  13,  12 },   // 0x8A
+  {   1,  13,  12 },   // 0x8B
+  {   1,  13,  12 },   // 0x8C
+  {   1,  13,  12 },   // 0x8D
+  {   1,  13,  12 },   // 0x8E
+  {   1,  13,  12 },   // 0x8F
+  {   1,  13,  12 },   // 0x90
+  {   1,  13,  12 },   // 0x91
+  {   1,  13,  12 },   // 0x92
+  {   1,  13,  12 },   // 0x93
+  {   1,  13,  12 },   // 0x94
+  {   1,  13,  12 },   // 0x95
+  {   1,  13,  12 },   // 0x96
+  {   1,  13,  12 },   // 0x97
+  {   1,  13,  12 },   // 0x98
+  {   1,  13,  12 },   // 0x99
+  {   1,  13,  12 },   // 0x9A
+  {   1,  13,  12 },   // 0x9B
+  {   1,  13,  12 },   // 0x9C
+  {   1,  13,  12 },   // 0x9D
+  {   1,  13,  12 },   // 0x9E
+  {   1,  13,  12 },   // 0x9F
+  {   0,   7,   1 },   // 0xA0
+  {   3,   9,   5 },   // 0xA1
+  {   2,  14,  12 },   // 0xA2
+  {   1,  14,  12 },   // 0xA3
+  {   1,  14,  12 },   // 0xA4
+  {   1,  14,  13 },   // 0xA5
+  {   3,   7,   5 },   // 0xA6
+  {   1,  11,  10 },   // 0xA7
+  {   2,  11,   8 },   // 0xA8
+  {   3,  22,  19 },   // 0xA9
+  {   1,  10,   9 },   // 0xAA
+  {   2,  13,  12 },   // 0xAB
+  {   2,  18,  16 },   // 0xAC
+  {   1,   8,   7 },   // 0xAD
+  {   3,  22,  19 },   // 0xAE
+  {   2,  11,   8 },   // 0xAF
+  {   2,  11,   9 },   // 0xB0
+  {   2,  18,  16 },   // 0xB1
+  {   1,   9,   7 },   // 0xB2
+  {   1,   9,   8 },   // 0xB3
+  {   4,  11,   9 },   // 0xB4
+  {   2,  14,  14 },   // 0xB5
+  {   2,  14,  12 },   // 0xB6
+  {   2,   7,   4 },   // 0xB7
+  {   3,  11,   7 },   // 0xB8
+  {   2,   9,   8 },   // 0xB9
+  {   1,  10,   9 },   // 0xBA
+  {   2,  13,  12 },   // 0xBB
+  {   2,  21,  21 },   // 0xBC
+  {   2,  21,  20 },   // 0xBD
+  {   1,  21,  21 },   // 0xBE
+  {   2,  12,  11 },   // 0xBF
+  {   0,  15,  15 },   // 0xC0
+  {   0,  15,  15 },   // 0xC1
+  {   0,  15,  15 },   // 0xC2
+  {   0,  15,  15 },   // 0xC3
+  {   0,  15,  15 },   // 0xC4
+  {   0,  15,  15 },   // 0xC5
+  {   0,  21,  20 },   // 0xC6
+  {   1,  15,  14 },   // 0xC7
+  {   2,  14,  12 },   // 0xC8
+  {   2,  14,  12 },   // 0xC9
+  {   2,  14,  12 },   // 0xCA
+  {   2,  14,  12 },   // 0xCB
+  {   1,   6,   5 },   // 0xCC
+  {   2,   6,   6 },   // 0xCD
+  {  -1,   6,   7 },   // 0xCE
+  {   0,   6,   6 },   // 0xCF
+  {   0,  17,  15 },   // 0xD0
+  {   2,  16,  14 },   // 0xD1
+  {   1,  17,  16 },   // 0xD2
+  {   1,  17,  16 },   // 0xD3
+  {   1,  17,  16 },   // 0xD4
+  {   1,  17,  16 },   // 0xD5
+  {   1,  17,  16 },   // 0xD6
+  {   3,  18,  15 },   // 0xD7
+  {   1,  17,  16 },   // 0xD8
+  {   2,  16,  14 },   // 0xD9
+  {   2,  16,  14 },   // 0xDA
+  {   2,  16,  14 },   // 0xDB
+  {   2,  16,  14 },   // 0xDC
+  {   0,  13,  14 },   // 0xDD
+  {   2,  13,  12 },   // 0xDE
+  {   2,  14,  13 },   // 0xDF
+  {   1,  13,  11 },   // 0xE0
+  {   1,  13,  11 },   // 0xE1
+  {   1,  13,  11 },   // 0xE2
+  {   1,  13,  11 },   // 0xE3
+  {   1,  13,  11 },   // 0xE4
+  {   1,  13,  11 },   // 0xE5
+  {   1,  21,  20 },   // 0xE6
+  {   1,  12,  11 },   // 0xE7
+  {   1,  13,  12 },   // 0xE8
+  {   1,  13,  12 },   // 0xE9
+  {   1,  13,  12 },   // 0xEA
+  {   1,  13,  12 },   // 0xEB
+  {   0,   6,   5 },   // 0xEC
+  {   2,   6,   7 },   // 0xED
+  {  -1,   6,   7 },   // 0xEE
+  {   0,   6,   6 },   // 0xEF
+  {   1,  13,  12 },   // 0xF0
+  {   2,  14,  12 },   // 0xF1
+  {   1,  13,  12 },   // 0xF2
+  {   1,  13,  12 },   // 0xF3
+  {   1,  13,  12 },   // 0xF4
+  {   1,  13,  12 },   // 0xF5
+  {   1,  13,  12 },   // 0xF6
+  {   2,  18,  17 },   // 0xF7
+  {   1,  13,  12 },   // 0xF8
+  {   2,  14,  12 },   // 0xF9
+  {   2,  14,  12 },   // 0xFA
+  {   2,  14,  12 },   // 0xFB
+  {   2,  14,  12 },   // 0xFC
+  {   1,  14,  13 },   // 0xFD
+  {   2,  14,  13 },   // 0xFE
+  {   1,  14,  13 }    // 0xFF
+};
+const FontMetrics DejaVuSans11pt8bWidths = { DejaVuSans11pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS11PTLAT1__H
@@ -0,0 +1,950 @@
+#ifndef DEJAVUSANS12PTLAT1__H
+#define DEJAVUSANS12PTLAT1__H
+const uint8_t DejaVuSans12pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xC0,
+  0x03, 0x08, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x02, 0x18, 0x7F, 0xFF,
+  0x7F, 0xFF, 0x06, 0x30, 0x04, 0x30, 0x0C, 0x20, 0x0C, 0x60, 0xFF, 0xFE,
+  0xFF, 0xFE, 0x18, 0x40, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x10, 0xC0,
+  0x04, 0x00, 0x80, 0x10, 0x0F, 0xC7, 0xFD, 0xC8, 0xB1, 0x06, 0x20, 0xE4,
+  0x0F, 0x80, 0xFE, 0x03, 0xE0, 0x4E, 0x08, 0xC1, 0x1C, 0x27, 0xFF, 0xC7,
+  0xE0, 0x10, 0x02, 0x00, 0x40, 0x08, 0x00, 0x3C, 0x03, 0x06, 0x60, 0x70,
+  0xC3, 0x06, 0x0C, 0x30, 0xC0, 0xC3, 0x1C, 0x0C, 0x31, 0x80, 0xC3, 0x38,
+  0x0C, 0x33, 0x00, 0x66, 0x63, 0xC3, 0xC6, 0x66, 0x00, 0xCC, 0x30, 0x1C,
+  0xC3, 0x01, 0x8C, 0x30, 0x38, 0xC3, 0x03, 0x0C, 0x30, 0x60, 0xC3, 0x0E,
+  0x06, 0x60, 0xC0, 0x3C, 0x0F, 0xC0, 0x1F, 0xE0, 0x38, 0x20, 0x30, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x77, 0x06,
+  0xE3, 0x86, 0xC1, 0xCC, 0xC0, 0xEC, 0xC0, 0x78, 0xE0, 0x38, 0x70, 0xFC,
+  0x3F, 0xCE, 0x0F, 0x87, 0xFF, 0xFC, 0x19, 0x8C, 0xC6, 0x33, 0x18, 0xC6,
+  0x31, 0x8C, 0x63, 0x0C, 0x63, 0x0C, 0x61, 0x80, 0xC3, 0x18, 0x63, 0x18,
+  0x63, 0x18, 0xC6, 0x31, 0x8C, 0x66, 0x31, 0x98, 0xCC, 0x00, 0x04, 0x00,
+  0x83, 0x11, 0xBA, 0xE1, 0xF0, 0x3E, 0x1D, 0x76, 0x23, 0x04, 0x00, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x6D, 0xBD, 0x80, 0xFF,
+  0xF0, 0xFC, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x1C, 0x18,
+  0x18, 0x38, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x0F, 0x03,
+  0xFC, 0x70, 0xE6, 0x06, 0x60, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x06, 0x60, 0x67, 0x0E, 0x3F, 0xC0,
+  0xF0, 0x3C, 0x3F, 0x0C, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+  0x3F, 0x1F, 0xFB, 0x07, 0x00, 0x70, 0x06, 0x00, 0xC0, 0x18, 0x06, 0x01,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x00, 0xFF, 0xFF,
+  0xFC, 0x3F, 0x07, 0xFC, 0x40, 0xC0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x0C, 0x1F, 0x81, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x03, 0x00, 0x78,
+  0x0E, 0xFF, 0xC3, 0xF8, 0x01, 0xC0, 0x1E, 0x00, 0xB0, 0x0D, 0x80, 0xCC,
+  0x06, 0x60, 0x63, 0x07, 0x18, 0x30, 0xC3, 0x06, 0x18, 0x31, 0x81, 0x8F,
+  0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x7F, 0xCF,
+  0xF9, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1F, 0xC3, 0xFC, 0x41, 0xC0, 0x1C,
+  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x3C, 0x0E, 0xFF, 0x8F, 0xC0, 0x07,
+  0xC1, 0xFE, 0x38, 0x27, 0x00, 0x60, 0x0C, 0x00, 0xCF, 0x8D, 0xFC, 0xF8,
+  0xEF, 0x07, 0xE0, 0x3E, 0x03, 0xE0, 0x36, 0x03, 0x70, 0x77, 0x8E, 0x3F,
+  0xC0, 0xF8, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x00, 0x60,
+  0x18, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x07, 0x00, 0xC0,
+  0x18, 0x06, 0x00, 0x1F, 0x87, 0xFE, 0x70, 0xEC, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x37, 0x0E, 0x3F, 0xC3, 0xFC, 0x70, 0xEC, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x37, 0x0E, 0x7F, 0xE1, 0xF8, 0x1F, 0x03, 0xFC, 0x71, 0xEE, 0x0E,
+  0xC0, 0x6C, 0x07, 0xC0, 0x7C, 0x07, 0xE0, 0xF7, 0x1F, 0x3F, 0xB1, 0xF3,
+  0x00, 0x30, 0x06, 0x00, 0xE4, 0x1C, 0x7F, 0x83, 0xE0, 0xFC, 0x00, 0x3F,
+  0x6D, 0x80, 0x00, 0x0D, 0xB7, 0xB0, 0x00, 0x02, 0x00, 0x3C, 0x03, 0xF0,
+  0x3F, 0x01, 0xF8, 0x1F, 0x80, 0x38, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x01, 0xE0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0x80, 0x3F,
+  0x03, 0xF0, 0x1F, 0x81, 0xF8, 0x07, 0x80, 0x08, 0x00, 0x00, 0x3E, 0x3F,
+  0xB0, 0xF0, 0x30, 0x18, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E, 0x06, 0x03, 0x01,
+  0x80, 0x00, 0x00, 0x30, 0x18, 0x0C, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xF8,
+  0x03, 0xC0, 0xF0, 0x38, 0x01, 0xC3, 0x00, 0x07, 0x38, 0x79, 0x99, 0x8F,
+  0xFC, 0xFC, 0x71, 0xE3, 0xC6, 0x07, 0x1E, 0x30, 0x18, 0xF1, 0x80, 0xC7,
+  0x8C, 0x06, 0x3C, 0x60, 0x73, 0x71, 0xC7, 0xB9, 0x8F, 0xFF, 0x8E, 0x1E,
+  0x70, 0x38, 0x00, 0x00, 0xE0, 0x04, 0x03, 0xC0, 0xE0, 0x0F, 0xFE, 0x00,
+  0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06,
+  0x60, 0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18,
+  0x18, 0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06, 0x60,
+  0x06, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x6C, 0x06,
+  0xC0, 0x6C, 0x0C, 0xFF, 0x8F, 0xFC, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x06, 0xFF, 0xEF, 0xF8, 0x07, 0xE0, 0x7F, 0xE3, 0xC1, 0xDC,
+  0x01, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x4F, 0x07, 0x1F, 0xF8,
+  0x1F, 0x80, 0xFF, 0x81, 0xFF, 0xE3, 0x01, 0xE6, 0x00, 0xEC, 0x00, 0xD8,
+  0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0xF8, 0x01, 0xB0, 0x07, 0x60, 0x3C, 0xFF, 0xF1, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF,
+  0xDF, 0xFB, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF,
+  0xBF, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00,
+  0x07, 0xE0, 0x3F, 0xF0, 0xE0, 0x73, 0x80, 0x26, 0x00, 0x1C, 0x00, 0x30,
+  0x00, 0x60, 0x00, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+  0x6C, 0x00, 0xDC, 0x01, 0x9E, 0x07, 0x1F, 0xFC, 0x0F, 0xE0, 0xC0, 0x1E,
+  0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x1B, 0xEF, 0x00, 0xC0, 0x73, 0x03, 0x8C, 0x1C, 0x30, 0xE0, 0xC7, 0x03,
+  0x38, 0x0D, 0xC0, 0x3E, 0x00, 0xF0, 0x03, 0xF0, 0x0C, 0xE0, 0x31, 0xC0,
+  0xC3, 0x83, 0x07, 0x0C, 0x0E, 0x30, 0x1C, 0xC0, 0x3B, 0x00, 0x70, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF, 0xFC,
+  0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0xD8, 0x1B, 0xD8, 0x1B,
+  0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xC6, 0x63, 0xC6, 0x63, 0xC7, 0xE3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0x83, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xE0, 0x1F, 0x80, 0xFC, 0x07, 0xF0, 0x3D, 0x81, 0xE6, 0x0F, 0x30, 0x78,
+  0xC3, 0xC6, 0x1E, 0x18, 0xF0, 0xC7, 0x83, 0x3C, 0x19, 0xE0, 0x6F, 0x03,
+  0x78, 0x0F, 0xC0, 0x7E, 0x01, 0xC0, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C,
+  0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x0E,
+  0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0x1F, 0xFB, 0x03, 0x60, 0x3C,
+  0x07, 0x80, 0xF0, 0x1E, 0x06, 0xFF, 0xDF, 0xE3, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C,
+  0x1C, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70,
+  0x0E, 0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xF0, 0x00, 0x38, 0x00, 0x18, 0x00,
+  0x0C, 0xFF, 0x07, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01,
+  0x98, 0x18, 0xFF, 0xC7, 0xFC, 0x30, 0x71, 0x81, 0x8C, 0x06, 0x60, 0x33,
+  0x01, 0xD8, 0x06, 0xC0, 0x36, 0x00, 0xC0, 0x1F, 0xC7, 0xFE, 0x70, 0x6C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x07, 0x00, 0x7F, 0x01, 0xFC, 0x01, 0xE0,
+  0x07, 0x00, 0x30, 0x03, 0x00, 0x3C, 0x0E, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
+  0x80, 0x3C, 0x01, 0xE0, 0x0D, 0x80, 0xCE, 0x0E, 0x3F, 0xE0, 0xFE, 0x00,
+  0xC0, 0x03, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x30, 0x0C,
+  0x38, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30,
+  0x06, 0x60, 0x06, 0x60, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x36, 0x07, 0x81, 0x98, 0x1E, 0x06, 0x60,
+  0xEC, 0x19, 0x83, 0x30, 0x63, 0x0C, 0xC3, 0x0C, 0x33, 0x0C, 0x31, 0xCE,
+  0x30, 0xC6, 0x18, 0xC1, 0x98, 0x66, 0x06, 0x61, 0x98, 0x19, 0x86, 0x60,
+  0x6C, 0x0D, 0x80, 0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x38,
+  0x07, 0x00, 0x70, 0x0E, 0x60, 0x18, 0x60, 0x60, 0xE1, 0xC0, 0xC7, 0x00,
+  0xCC, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0x80, 0x07, 0x80, 0x1F, 0x00, 0x37,
+  0x00, 0xC6, 0x03, 0x86, 0x0E, 0x0E, 0x18, 0x0C, 0x60, 0x0D, 0xC0, 0x1C,
+  0xE0, 0x1D, 0x80, 0x63, 0x03, 0x0E, 0x1C, 0x18, 0x60, 0x73, 0x80, 0xFC,
+  0x01, 0xE0, 0x07, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x01, 0x80, 0x0E, 0x00, 0x70, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x80,
+  0x1C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xE0, 0x07, 0x00, 0x18, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC6, 0x31, 0xFF, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06,
+  0x07, 0x03, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+  0x18, 0xC7, 0xFF, 0x80, 0x03, 0x80, 0x0F, 0x80, 0x3B, 0x80, 0xE3, 0x83,
+  0x83, 0x8E, 0x03, 0xB8, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0xC1, 0x83,
+  0x3F, 0x0F, 0xF9, 0x03, 0x00, 0x30, 0x06, 0x3F, 0xDF, 0xFF, 0x03, 0xC0,
+  0x78, 0x1F, 0x87, 0xBF, 0xF3, 0xE6, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+  0xC0, 0x0C, 0xF8, 0xFF, 0xCF, 0x0E, 0xE0, 0x6C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xE0, 0x6F, 0x0E, 0xFF, 0xCC, 0xF8, 0x0F, 0x8F, 0xF7,
+  0x05, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x07, 0x04, 0xFF,
+  0x1F, 0x80, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x31, 0xF3, 0x3F,
+  0xF7, 0x0F, 0x60, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60,
+  0x77, 0x0F, 0x3F, 0xF1, 0xF3, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x03, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x23, 0xFE, 0x0F,
+  0xC0, 0x0F, 0x1F, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x33, 0xFF, 0x70, 0xFE,
+  0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xF3,
+  0xFF, 0x1F, 0x30, 0x03, 0x00, 0x72, 0x0E, 0x3F, 0xC1, 0xF8, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x9F, 0x3F, 0xF7, 0x87, 0xE0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0C, 0xFC,
+  0x3F, 0xFF, 0xFF, 0xF0, 0x18, 0xC6, 0x00, 0x0C, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x18, 0xC6, 0x31, 0xFB, 0x80, 0xC0, 0x0C, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x1C, 0xC3, 0x8C, 0x70, 0xCE, 0x0D, 0xC0, 0xF8, 0x0F,
+  0x80, 0xDC, 0x0C, 0xE0, 0xC7, 0x0C, 0x38, 0xC1, 0xCC, 0x0E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xCF, 0x87, 0xCF, 0xFD, 0xFE, 0xF0, 0xF8, 0x7E, 0x07,
+  0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0,
+  0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x3C, 0x06, 0x03, 0xC0, 0x60, 0x30,
+  0xCF, 0x9F, 0xFB, 0xC3, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x06, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x06,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x06, 0x70, 0xE3, 0xFC,
+  0x1F, 0x80, 0xCF, 0x8F, 0xFC, 0xF0, 0xEE, 0x06, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3E, 0x06, 0xF0, 0xEF, 0xFC, 0xCF, 0x8C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x1F, 0x33, 0xFF, 0x70, 0xF6, 0x07, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x07, 0x70, 0xF3, 0xFF, 0x1F,
+  0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xCF, 0xFF, 0xF0, 0xE0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x1F, 0xEE,
+  0x0B, 0x00, 0xC0, 0x3F, 0x03, 0xF8, 0x1F, 0x00, 0xC0, 0x38, 0x1F, 0xFE,
+  0x7F, 0x00, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x1F, 0xC0, 0x78, 0x0F, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x1F, 0x87, 0xBF, 0xF3,
+  0xE6, 0xC0, 0x1B, 0x01, 0x98, 0x0C, 0xC0, 0xE3, 0x06, 0x18, 0x30, 0x63,
+  0x83, 0x18, 0x18, 0xC0, 0x6C, 0x03, 0x60, 0x1F, 0x00, 0x70, 0x00, 0xC1,
+  0xE0, 0xF0, 0x78, 0x36, 0x1E, 0x19, 0x87, 0x86, 0x63, 0x31, 0x9C, 0xCC,
+  0xE3, 0x33, 0x30, 0xCC, 0xCC, 0x36, 0x1B, 0x07, 0x87, 0x81, 0xE1, 0xE0,
+  0x78, 0x78, 0x1C, 0x0E, 0x00, 0xE0, 0x3B, 0x83, 0x8E, 0x38, 0x31, 0x80,
+  0xD8, 0x07, 0xC0, 0x1C, 0x01, 0xF0, 0x1D, 0xC0, 0xC6, 0x0C, 0x18, 0xE0,
+  0xEE, 0x03, 0x80, 0xC0, 0x1B, 0x01, 0x98, 0x0C, 0xE0, 0xE3, 0x06, 0x18,
+  0x70, 0x63, 0x03, 0x18, 0x0D, 0x80, 0x6C, 0x03, 0xE0, 0x0E, 0x00, 0x70,
+  0x03, 0x00, 0x18, 0x01, 0x80, 0x7C, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
+  0x03, 0x00, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x01, 0x80,
+  0x7F, 0xFF, 0xFE, 0x07, 0x87, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x0E, 0x3E, 0x1F, 0x01, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xF8, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0E, 0x03, 0xE1, 0xF1,
+  0xC0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0x87, 0x80, 0x3E,
+  0x02, 0xFF, 0x0F, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x02, 0x00, 0x80, 0x20, 0x3E, 0x3F, 0xDC, 0x96, 0x23, 0x08, 0xC2,
+  0x30, 0x8C, 0x23, 0x08, 0x62, 0x1C, 0x93, 0xFC, 0x3E, 0x02, 0x00, 0x80,
+  0x20, 0x03, 0xE0, 0xFF, 0x0C, 0x11, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x07, 0xFC, 0x7F, 0xC1, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0x80, 0x77, 0x7B, 0x8F, 0xFC, 0x18,
+  0x60, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x61, 0x83, 0xFF, 0x1D,
+  0xEE, 0xE0, 0x1D, 0x00, 0x20, 0xC0, 0x36, 0x06, 0x60, 0x63, 0x0C, 0x30,
+  0xC3, 0x98, 0x19, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0, 0x06, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xC0, 0x1F, 0x0F, 0xE7, 0x09, 0x80, 0x60, 0x0E, 0x03, 0xC1, 0xBC,
+  0xC3, 0xB0, 0x7E, 0x0D, 0xC3, 0x3D, 0x83, 0xC0, 0x38, 0x06, 0x01, 0x90,
+  0xE7, 0xF0, 0xF8, 0xCF, 0x30, 0x03, 0xE0, 0x06, 0x0C, 0x0C, 0x01, 0x84,
+  0x7C, 0x44, 0xE1, 0x16, 0x60, 0x0A, 0x60, 0x03, 0x30, 0x01, 0x98, 0x00,
+  0xCC, 0x00, 0x66, 0x00, 0x29, 0x80, 0x24, 0xE1, 0x11, 0x1F, 0x10, 0xC0,
+  0x18, 0x18, 0x30, 0x03, 0xE0, 0x00, 0x3E, 0x21, 0x80, 0x60, 0x33, 0xFF,
+  0x0F, 0x07, 0x83, 0xE3, 0xBE, 0xC0, 0x1F, 0xF0, 0x04, 0x10, 0xC3, 0x1C,
+  0x73, 0x8E, 0x71, 0xCE, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x70, 0xC3, 0x04,
+  0x10, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00,
+  0xC0, 0x01, 0x80, 0xFF, 0xF0, 0x03, 0xE0, 0x06, 0x0C, 0x0C, 0x01, 0x84,
+  0xFC, 0x44, 0x63, 0x16, 0x31, 0x8A, 0x18, 0xC3, 0x0C, 0x61, 0x87, 0xC0,
+  0xC3, 0x20, 0x61, 0x98, 0x28, 0xC6, 0x24, 0x63, 0x11, 0x30, 0xD0, 0xC0,
+  0x18, 0x18, 0x30, 0x03, 0xE0, 0x00, 0xFF, 0xFC, 0x38, 0x8A, 0x0C, 0x18,
+  0x28, 0x8E, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x79,
+  0x1C, 0x18, 0x30, 0xE3, 0x8E, 0x18, 0x61, 0xFC, 0xFC, 0x0C, 0x18, 0x33,
+  0x81, 0xC1, 0x83, 0x0F, 0xF0, 0x18, 0xC6, 0x30, 0xC0, 0x66, 0x03, 0x30,
+  0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03,
+  0x38, 0x39, 0xFF, 0xFD, 0xF3, 0xE0, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06,
+  0x00, 0x00, 0x1F, 0xEF, 0xCD, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0xFF, 0x9B,
+  0xF3, 0x3E, 0x61, 0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x33,
+  0x06, 0x60, 0xCC, 0x19, 0x83, 0x30, 0xFC, 0x10, 0xC7, 0xFF, 0x00, 0xF0,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 0xF0, 0x3E, 0x31, 0xB0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0x63, 0x1F, 0x00, 0x0F, 0xE0, 0x82, 0x0C, 0x30,
+  0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x38, 0xE7, 0x1C, 0xE3, 0x8C, 0x30,
+  0x82, 0x00, 0xF0, 0x03, 0x80, 0xC0, 0x0C, 0x03, 0x00, 0x70, 0x0C, 0x01,
+  0x80, 0x30, 0x0C, 0x00, 0xC0, 0x70, 0x03, 0x01, 0x80, 0x0C, 0x0E, 0x00,
+  0x30, 0x30, 0x33, 0xF1, 0x81, 0xC0, 0x0E, 0x0B, 0x00, 0x30, 0x6C, 0x01,
+  0xC1, 0x30, 0x06, 0x08, 0xC0, 0x30, 0x63, 0x01, 0xC1, 0xFF, 0x06, 0x00,
+  0x30, 0x38, 0x00, 0xC0, 0xF0, 0x03, 0x83, 0x00, 0x30, 0x30, 0x07, 0x03,
+  0x00, 0x60, 0x30, 0x0C, 0x03, 0x01, 0xC0, 0x30, 0x18, 0x03, 0x03, 0x80,
+  0x30, 0x33, 0xCF, 0xC6, 0x47, 0x00, 0xE0, 0x30, 0x0C, 0x03, 0x01, 0xC0,
+  0x70, 0x18, 0x0E, 0x03, 0x01, 0xC0, 0x70, 0x18, 0x06, 0x03, 0x00, 0xE0,
+  0x7F, 0xFC, 0x01, 0xC0, 0x0C, 0x03, 0x00, 0x18, 0x0E, 0x00, 0x30, 0x18,
+  0x03, 0x80, 0x60, 0x01, 0xC1, 0xC0, 0x01, 0x83, 0x00, 0x03, 0x0E, 0x00,
+  0x0E, 0x18, 0x19, 0xF0, 0x60, 0x70, 0x01, 0xC1, 0x60, 0x03, 0x06, 0xC0,
+  0x0E, 0x09, 0x80, 0x18, 0x23, 0x00, 0x60, 0xC6, 0x01, 0xC1, 0xFF, 0x03,
+  0x00, 0x18, 0x0E, 0x00, 0x30, 0x0C, 0x06, 0x03, 0x00, 0x00, 0x00, 0x60,
+  0x30, 0x18, 0x1C, 0x1C, 0x1C, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0xC3, 0x7F,
+  0x1F, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x06, 0x60, 0x0C, 0x30,
+  0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18, 0x18, 0x38, 0x1C, 0x3F, 0xFC,
+  0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0xC0, 0x03, 0x00, 0xC0,
+  0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x07, 0xE0, 0x06, 0x60, 0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30,
+  0x18, 0x18, 0x18, 0x18, 0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06,
+  0x60, 0x06, 0x60, 0x06, 0xC0, 0x03, 0x01, 0x80, 0x03, 0xC0, 0x06, 0x60,
+  0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60,
+  0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18, 0x18,
+  0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06,
+  0xC0, 0x03, 0x07, 0x10, 0x08, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30,
+  0x0C, 0x30, 0x18, 0x18, 0x18, 0x18, 0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC,
+  0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0xC0, 0x03, 0x06, 0x60, 0x06, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0,
+  0x06, 0x60, 0x06, 0x60, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18,
+  0x18, 0x18, 0x38, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06,
+  0x60, 0x06, 0xC0, 0x03, 0x03, 0xC0, 0x06, 0x60, 0x04, 0x20, 0x04, 0x20,
+  0x06, 0x60, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x06, 0x60,
+  0x0E, 0x70, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x30, 0x0C, 0x3F, 0xFC, 0x3F, 0xFC, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06,
+  0xC0, 0x03, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xCC, 0x00, 0x06, 0x60,
+  0x00, 0x63, 0x00, 0x03, 0x18, 0x00, 0x38, 0xC0, 0x01, 0x86, 0x00, 0x0C,
+  0x3F, 0xF0, 0xC1, 0xFF, 0x86, 0x0C, 0x00, 0x30, 0x60, 0x03, 0xFF, 0x00,
+  0x1F, 0xF8, 0x01, 0xC0, 0xC0, 0x0C, 0x06, 0x00, 0x60, 0x3F, 0xFE, 0x01,
+  0xFF, 0xC0, 0x07, 0xE0, 0x7F, 0xE3, 0xC1, 0xDC, 0x01, 0x60, 0x03, 0x80,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xE0,
+  0x01, 0x80, 0x07, 0x00, 0x4F, 0x07, 0x1F, 0xF8, 0x1F, 0x80, 0x04, 0x00,
+  0x18, 0x00, 0x60, 0x0F, 0x80, 0x3C, 0x00, 0x1C, 0x01, 0x80, 0x18, 0x00,
+  0x0F, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F,
+  0xFD, 0xFF, 0xB0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFF,
+  0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFD, 0xFF, 0xB0, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFF, 0xFF, 0xC0, 0x0E, 0x03, 0x60,
+  0xC6, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0F, 0xFD, 0xFF, 0xB0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0F, 0xFF, 0xFF, 0xC0, 0x19, 0x83, 0x30, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFD, 0xFF, 0xB0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFF, 0xFF, 0xC0, 0xE6,
+  0x30, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x36, 0xC0,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x3C, 0x66, 0xC3,
+  0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xCF, 0x30, 0x00, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0,
+  0x3F, 0xE0, 0x1F, 0xFE, 0x0C, 0x07, 0x86, 0x00, 0xE3, 0x00, 0x31, 0x80,
+  0x1C, 0xC0, 0x06, 0x60, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xCC, 0x00, 0x66,
+  0x00, 0x33, 0x00, 0x39, 0x80, 0x18, 0xC0, 0x1C, 0x60, 0x3C, 0x3F, 0xF8,
+  0x1F, 0xF0, 0x00, 0x0E, 0x40, 0x9C, 0x00, 0x01, 0xC0, 0x3F, 0x01, 0xF8,
+  0x0F, 0xE0, 0x7B, 0x03, 0xCC, 0x1E, 0x60, 0xF1, 0x87, 0x8C, 0x3C, 0x31,
+  0xE1, 0x8F, 0x06, 0x78, 0x33, 0xC0, 0xDE, 0x06, 0xF0, 0x1F, 0x80, 0xFC,
+  0x03, 0x80, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x00, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3C, 0x1C, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07,
+  0x60, 0x06, 0x70, 0x0E, 0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0x00, 0xC0,
+  0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C,
+  0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x0E,
+  0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0x01, 0x80, 0x03, 0xC0, 0x06, 0x60,
+  0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C, 0x70, 0x0E, 0x60, 0x06,
+  0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x0E, 0x38, 0x1C, 0x1F, 0xF8,
+  0x07, 0xE0, 0x07, 0x10, 0x08, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8,
+  0x3C, 0x1C, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06,
+  0x70, 0x0E, 0x38, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0x06, 0x60, 0x06, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x1C, 0x70, 0x0E,
+  0x60, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x0E, 0x38, 0x1C,
+  0x1F, 0xF8, 0x07, 0xE0, 0x40, 0x0B, 0x80, 0x77, 0x03, 0x8E, 0x1C, 0x1C,
+  0xE0, 0x3F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x73, 0x83, 0x87, 0x1C,
+  0x0E, 0xE0, 0x1D, 0x00, 0x20, 0x07, 0xE3, 0x1F, 0xFB, 0x3C, 0x3E, 0x70,
+  0x0E, 0x60, 0x1E, 0xE0, 0x37, 0xC0, 0x63, 0xC0, 0xE3, 0xC1, 0xC3, 0xC3,
+  0x83, 0xC7, 0x03, 0xC6, 0x03, 0xEC, 0x07, 0x78, 0x06, 0x70, 0x0E, 0x7C,
+  0x1C, 0x5F, 0xF8, 0xC7, 0xE0, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x0C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0C,
+  0xE0, 0xE3, 0xFE, 0x0F, 0xE0, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x0C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0C,
+  0xE0, 0xE3, 0xFE, 0x0F, 0xE0, 0x07, 0x00, 0x6C, 0x06, 0x30, 0x00, 0x0C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0C,
+  0xE0, 0xE3, 0xFE, 0x0F, 0xE0, 0x0D, 0x80, 0x6C, 0x00, 0x00, 0x00, 0x0C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0C,
+  0xE0, 0xE3, 0xFE, 0x0F, 0xE0, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x00, 0x00,
+  0xE0, 0x1D, 0x80, 0x63, 0x03, 0x0E, 0x1C, 0x18, 0x60, 0x73, 0x80, 0xFC,
+  0x01, 0xE0, 0x07, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x7F, 0x8F, 0xFD, 0x81, 0xB0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0x7F,
+  0xEF, 0xF1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x1F, 0x07, 0xFC,
+  0xE0, 0xCC, 0x06, 0xC0, 0xEC, 0x38, 0xC6, 0x0C, 0x60, 0xC6, 0x0C, 0x78,
+  0xC1, 0xCC, 0x0E, 0xC0, 0x3C, 0x03, 0xC0, 0x3D, 0x07, 0xDF, 0xEC, 0xF8,
+  0x38, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x40,
+  0xC0, 0x0C, 0x01, 0x8F, 0xF7, 0xFF, 0xC0, 0xF0, 0x1E, 0x07, 0xE1, 0xEF,
+  0xFC, 0xF9, 0x80, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x0F,
+  0xC3, 0xFE, 0x40, 0xC0, 0x0C, 0x01, 0x8F, 0xF7, 0xFF, 0xC0, 0xF0, 0x1E,
+  0x07, 0xE1, 0xEF, 0xFC, 0xF9, 0x80, 0x0E, 0x01, 0x40, 0x6C, 0x18, 0xC0,
+  0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x40, 0xC0, 0x0C, 0x01, 0x8F, 0xF7, 0xFF,
+  0xC0, 0xF0, 0x1E, 0x07, 0xE1, 0xEF, 0xFC, 0xF9, 0x80, 0x1C, 0x85, 0xD0,
+  0x9C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x40, 0xC0, 0x0C, 0x01,
+  0x8F, 0xF7, 0xFF, 0xC0, 0xF0, 0x1E, 0x07, 0xE1, 0xEF, 0xFC, 0xF9, 0x80,
+  0x1B, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xF2, 0x06, 0x00,
+  0x60, 0x0C, 0x7F, 0xBF, 0xFE, 0x07, 0x80, 0xF0, 0x3F, 0x0F, 0x7F, 0xE7,
+  0xCC, 0x0F, 0x03, 0x30, 0x42, 0x08, 0x41, 0x98, 0x1E, 0x00, 0x00, 0x00,
+  0x3F, 0x0F, 0xF9, 0x03, 0x00, 0x30, 0x06, 0x3F, 0xDF, 0xFF, 0x03, 0xC0,
+  0x78, 0x1F, 0x87, 0xBF, 0xF3, 0xE6, 0x3F, 0x0F, 0xC3, 0xFE, 0xFF, 0x10,
+  0x3E, 0x1C, 0x00, 0xE0, 0x30, 0x06, 0x01, 0x8F, 0xFF, 0xFD, 0xFF, 0xFF,
+  0xFC, 0x0C, 0x00, 0xC0, 0x60, 0x06, 0x07, 0x80, 0x38, 0x6E, 0x04, 0xFF,
+  0x3F, 0xE3, 0xE0, 0x7E, 0x00, 0x0F, 0x8F, 0xF7, 0x05, 0x80, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0xC0, 0x18, 0x07, 0x04, 0xFF, 0x1F, 0x80, 0x40, 0x18,
+  0x06, 0x0F, 0x83, 0xC0, 0x1C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC,
+  0x00, 0xC0, 0x06, 0x00, 0x70, 0x23, 0xFE, 0x0F, 0xC0, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x03,
+  0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x23, 0xFE,
+  0x0F, 0xC0, 0x06, 0x00, 0xF0, 0x19, 0x83, 0x0C, 0x00, 0x00, 0x00, 0x0F,
+  0x83, 0xFC, 0x70, 0xE6, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0,
+  0x06, 0x00, 0x70, 0x23, 0xFE, 0x0F, 0xC0, 0x0C, 0xC0, 0xCC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x3F, 0xC7, 0x0E, 0x60, 0x3C, 0x03, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x0C, 0x00, 0x60, 0x07, 0x02, 0x3F, 0xE0, 0xFC, 0xE0, 0xC1,
+  0x83, 0x00, 0x01, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61,
+  0x80, 0x18, 0xC6, 0x30, 0x00, 0x06, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x00, 0x18, 0x3C, 0x66, 0xC3, 0x00, 0x00, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xCF,
+  0x30, 0x00, 0x00, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC0, 0x18, 0x20, 0xDE, 0x1E, 0x07, 0x30, 0x01, 0x81, 0xFC, 0x3F, 0xE7,
+  0x06, 0x60, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x67,
+  0x0E, 0x3F, 0xC1, 0xF8, 0x1C, 0x44, 0xC8, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0xE7, 0xFE, 0xF0, 0xFC, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0x80, 0x38, 0x00, 0xC0, 0x06, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x06, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x80,
+  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC,
+  0x70, 0xEE, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x06,
+  0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x06, 0x00, 0xF0, 0x09, 0x01, 0x98, 0x00,
+  0x00, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x06, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3E, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x1C, 0x42,
+  0x64, 0x23, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xEE,
+  0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x06, 0x70, 0xE3,
+  0xFC, 0x1F, 0x80, 0x19, 0x81, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
+  0x3F, 0xC7, 0x0E, 0xE0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xE0, 0x67, 0x0E, 0x3F, 0xC1, 0xF8, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x11, 0xF9, 0x3F, 0xF7, 0x0E, 0xE0,
+  0xEC, 0x1B, 0xC3, 0x3C, 0x63, 0xCC, 0x3D, 0x83, 0x70, 0x67, 0x0E, 0x7F,
+  0xC9, 0xF8, 0x80, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00,
+  0x30, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x07, 0xE1, 0xEF, 0xFC, 0xF9, 0x80, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x00, 0x00, 0x00, 0x30, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x1E, 0x07, 0xE1, 0xEF, 0xFC, 0xF9, 0x80, 0x0E, 0x01,
+  0x40, 0x6C, 0x18, 0xC0, 0x00, 0x00, 0x30, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0xE1, 0xEF, 0xFC, 0xF9,
+  0x80, 0x1B, 0x03, 0x60, 0x00, 0x00, 0x00, 0x01, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x3F, 0x0F, 0x7F,
+  0xE7, 0xCC, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x6C, 0x06, 0x60, 0x33, 0x83, 0x8C, 0x18, 0x61, 0xC1, 0x8C, 0x0C,
+  0x60, 0x36, 0x01, 0xB0, 0x0F, 0x80, 0x38, 0x01, 0xC0, 0x0C, 0x00, 0x60,
+  0x06, 0x01, 0xF0, 0x0F, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0xF8, 0xFF, 0xCF, 0x0E, 0xE0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xE0, 0x6F, 0x0E, 0xFF, 0xCC, 0xF8, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x00, 0x0D, 0x80, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x0D, 0x80, 0xCC, 0x06, 0x70, 0x71, 0x83, 0x0C, 0x38, 0x31, 0x81,
+  0x8C, 0x06, 0xC0, 0x36, 0x01, 0xF0, 0x07, 0x00, 0x38, 0x01, 0x80, 0x0C,
+  0x00, 0xC0, 0x3E, 0x01, 0xE0, 0x00 };
+
+const GFXglyph DejaVuSans12pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   2,  18,  10,    4,  -17 },   // 0x21 '!'
+  {     6,   6,   7,  11,    2,  -17 },   // 0x22 '"'
+  {    12,  16,  18,  20,    2,  -17 },   // 0x23 '#'
+  {    48,  11,  22,  15,    2,  -17 },   // 0x24 '$'
+  {    79,  20,  18,  23,    1,  -17 },   // 0x25 '%'
+  {   124,  16,  18,  19,    1,  -17 },   // 0x26 '&'
+  {   160,   2,   7,   7,    2,  -17 },   // 0x27 '''
+  {   162,   5,  21,   9,    2,  -17 },   // 0x28 '('
+  {   176,   5,  21,   9,    2,  -17 },   // 0x29 ')'
+  {   190,  11,  10,  12,    0,  -17 },   // 0x2A '*'
+  {   204,  16,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   236,   3,   6,   8,    2,   -2 },   // 0x2C ','
+  {   239,   6,   2,   9,    1,   -7 },   // 0x2D '-'
+  {   241,   2,   3,   8,    3,   -2 },   // 0x2E '.'
+  {   242,   8,  20,   8,    0,  -17 },   // 0x2F '/'
+  {   262,  12,  18,  15,    2,  -17 },   // 0x30 '0'
+  {   289,  10,  18,  15,    3,  -17 },   // 0x31 '1'
+  {   312,  11,  18,  15,    2,  -17 },   // 0x32 '2'
+  {   337,  12,  18,  15,    2,  -17 },   // 0x33 '3'
+  {   364,  13,  18,  15,    1,  -17 },   // 0x34 '4'
+  {   394,  11,  18,  15,    2,  -17 },   // 0x35 '5'
+  {   419,  12,  18,  15,    2,  -17 },   // 0x36 '6'
+  {   446,  11,  18,  15,    2,  -17 },   // 0x37 '7'
+  {   471,  12,  18,  15,    2,  -17 },   // 0x38 '8'
+  {   498,  12,  18,  15,    2,  -17 },   // 0x39 '9'
+  {   525,   2,  12,   8,    3,  -11 },   // 0x3A ':'
+  {   528,   3,  15,   8,    2,  -11 },   // 0x3B ';'
+  {   534,  15,  13,  20,    3,  -13 },   // 0x3C '<'
+  {   559,  15,   7,  20,    3,  -10 },   // 0x3D '='
+  {   573,  15,  13,  20,    3,  -13 },   // 0x3E '>'
+  {   598,   9,  18,  13,    2,  -17 },   // 0x3F '?'
+  {   619,  21,  21,  24,    2,  -16 },   // 0x40 '@'
+  {   675,  16,  18,  16,    0,  -17 },   // 0x41 'A'
+  {   711,  12,  18,  16,    2,  -17 },   // 0x42 'B'
+  {   738,  14,  18,  17,    1,  -17 },   // 0x43 'C'
+  {   770,  15,  18,  18,    2,  -17 },   // 0x44 'D'
+  {   804,  11,  18,  15,    2,  -17 },   // 0x45 'E'
+  {   829,  10,  18,  14,    2,  -17 },   // 0x46 'F'
+  {   852,  15,  18,  19,    1,  -17 },   // 0x47 'G'
+  {   886,  13,  18,  18,    2,  -17 },   // 0x48 'H'
+  {   916,   2,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   921,   6,  23,   7,   -2,  -17 },   // 0x4A 'J'
+  {   939,  14,  18,  16,    2,  -17 },   // 0x4B 'K'
+  {   971,  11,  18,  13,    2,  -17 },   // 0x4C 'L'
+  {   996,  16,  18,  21,    2,  -17 },   // 0x4D 'M'
+  {  1032,  13,  18,  18,    2,  -17 },   // 0x4E 'N'
+  {  1062,  16,  18,  19,    1,  -17 },   // 0x4F 'O'
+  {  1098,  11,  18,  14,    2,  -17 },   // 0x50 'P'
+  {  1123,  16,  21,  19,    1,  -17 },   // 0x51 'Q'
+  {  1165,  13,  18,  17,    2,  -17 },   // 0x52 'R'
+  {  1195,  12,  18,  15,    2,  -17 },   // 0x53 'S'
+  {  1222,  14,  18,  15,    0,  -17 },   // 0x54 'T'
+  {  1254,  13,  18,  18,    2,  -17 },   // 0x55 'U'
+  {  1284,  16,  18,  16,    0,  -17 },   // 0x56 'V'
+  {  1320,  22,  18,  24,    1,  -17 },   // 0x57 'W'
+  {  1370,  15,  18,  17,    1,  -17 },   // 0x58 'X'
+  {  1404,  14,  18,  15,    0,  -17 },   // 0x59 'Y'
+  {  1436,  14,  18,  16,    1,  -17 },   // 0x5A 'Z'
+  {  1468,   5,  21,   9,    2,  -17 },   // 0x5B '['
+  {  1482,   8,  20,   8,    0,  -17 },   // 0x5C '\'
+  {  1502,   5,  21,   9,    2,  -17 },   // 0x5D ']'
+  {  1516,  15,   7,  20,    3,  -17 },   // 0x5E '^'
+  {  1530,  12,   2,  12,    0,    5 },   // 0x5F '_'
+  {  1533,   6,   4,  12,    2,  -18 },   // 0x60 '`'
+  {  1536,  11,  13,  14,    1,  -12 },   // 0x61 'a'
+  {  1554,  12,  18,  15,    2,  -17 },   // 0x62 'b'
+  {  1581,  10,  13,  13,    1,  -12 },   // 0x63 'c'
+  {  1598,  12,  18,  15,    1,  -17 },   // 0x64 'd'
+  {  1625,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1645,   8,  18,   8,    1,  -17 },   // 0x66 'f'
+  {  1663,  12,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1690,  11,  18,  15,    2,  -17 },   // 0x68 'h'
+  {  1715,   2,  18,   7,    2,  -17 },   // 0x69 'i'
+  {  1720,   5,  23,   7,   -1,  -17 },   // 0x6A 'j'
+  {  1735,  12,  18,  14,    2,  -17 },   // 0x6B 'k'
+  {  1762,   2,  18,   6,    2,  -17 },   // 0x6C 'l'
+  {  1767,  20,  13,  24,    2,  -12 },   // 0x6D 'm'
+  {  1800,  11,  13,  15,    2,  -12 },   // 0x6E 'n'
+  {  1818,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  1838,  12,  18,  15,    2,  -12 },   // 0x70 'p'
+  {  1865,  12,  18,  15,    1,  -12 },   // 0x71 'q'
+  {  1892,   8,  13,  10,    2,  -12 },   // 0x72 'r'
+  {  1905,  10,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1922,   8,  17,   9,    0,  -16 },   // 0x74 't'
+  {  1939,  11,  13,  15,    2,  -12 },   // 0x75 'u'
+  {  1957,  13,  13,  15,    1,  -12 },   // 0x76 'v'
+  {  1979,  18,  13,  20,    1,  -12 },   // 0x77 'w'
+  {  2009,  13,  13,  15,    1,  -12 },   // 0x78 'x'
+  {  2031,  13,  18,  15,    1,  -12 },   // 0x79 'y'
+  {  2061,  11,  13,  13,    1,  -12 },   // 0x7A 'z'
+  {  2079,   9,  22,  15,    3,  -17 },   // 0x7B '{'
+  {  2104,   2,  24,   8,    3,  -17 },   // 0x7C '|'
+  {  2110,   9,  22,  15,    3,  -17 },   // 0x7D '}'
+  {  2135,  15,   4,  20,    3,   -8 },   // 0x7E '~'
+  {  2143,  12,  21,  14,    1,  -16 },   // 0x7F
+  {  2175,  12,  21,  14,    1,  -16 },   // 0x80
+  {  2207,  12,  21,  14,    1,  -16 },   // 0x81
+  {  2239,  12,  21,  14,    1,  -16 },   // 0x82
+  {  2271,  12,  21,  14,    1,  -16 },   // 0x83
+  {  2303,  12,  21,  14,    1,  -16 },   // 0x84
+  {  2335,  12,  21,  14,    1,  -16 },   // 0x85
+  {  2367,  12,  21,  14,    1,  -16 },   // 0x86
+  {  2399,  12,  21,  14,    1,  -16 },   // 0x87
+  {  2431,  12,  21,  14,    1,  -16 },   // 0x88
+  {  2463,  12,  21,  14,    1,  -16 },   // 0x89
+  {  2495,  12,  21,  14,    1,  -16 },   // 0x8A
+  {  2527,  12,  21,  14,    1,  -16 },   // 0x8B
+  {  2559,  12,  21,  14,    1,  -16 },   // 0x8C
+  {  2591,  12,  21,  14,    1,  -16 },   // 0x8D
+  {  2623,  12,  21,  14,    1,  -16 },   // 0x8E
+  {  2655,  12,  21,  14,    1,  -16 },   // 0x8F
+  {  2687,  12,  21,  14,    1,  -16 },   // 0x90
+  {  2719,  12,  21,  14,    1,  -16 },   // 0x91
+  {  2751,  12,  21,  14,    1,  -16 },   // 0x92
+  {  2783,  12,  21,  14,    1,  -16 },   // 0x93
+  {  2815,  12,  21,  14,    1,  -16 },   // 0x94
+  {  2847,  12,  21,  14,    1,  -16 },   // 0x95
+  {  2879,  12,  21,  14,    1,  -16 },   // 0x96
+  {  2911,  12,  21,  14,    1,  -16 },   // 0x97
+  {  2943,  12,  21,  14,    1,  -16 },   // 0x98
+  {  2975,  12,  21,  14,    1,  -16 },   // 0x99
+  {  3007,  12,  21,  14,    1,  -16 },   // 0x9A
+  {  3039,  12,  21,  14,    1,  -16 },   // 0x9B
+  {  3071,  12,  21,  14,    1,  -16 },   // 0x9C
+  {  3103,  12,  21,  14,    1,  -16 },   // 0x9D
+  {  3135,  12,  21,  14,    1,  -16 },   // 0x9E
+  {  3167,  12,  21,  14,    1,  -16 },   // 0x9F
+  {  3199,   1,   1,   8,    0,    0 },   // 0xA0
+  {  3200,   2,  18,  10,    4,  -12 },   // 0xA1
+  {  3205,  10,  19,  15,    2,  -15 },   // 0xA2
+  {  3229,  12,  18,  15,    1,  -17 },   // 0xA3
+  {  3256,  14,  14,  15,    1,  -14 },   // 0xA4
+  {  3281,  12,  18,  15,    1,  -17 },   // 0xA5
+  {  3308,   2,  21,   8,    3,  -16 },   // 0xA6
+  {  3314,  10,  20,  12,    1,  -17 },   // 0xA7
+  {  3339,   6,   2,  12,    3,  -17 },   // 0xA8
+  {  3341,  17,  17,  24,    3,  -16 },   // 0xA9
+  {  3378,   9,  12,  11,    1,  -17 },   // 0xAA
+  {  3392,  12,  11,  15,    2,  -11 },   // 0xAB
+  {  3409,  15,   7,  20,    3,   -9 },   // 0xAC
+  {  3423,   6,   2,   9,    1,   -7 },   // 0xAD
+  {  3425,  17,  17,  24,    3,  -16 },   // 0xAE
+  {  3462,   7,   2,  12,    3,  -17 },   // 0xAF
+  {  3464,   7,   7,  12,    2,  -17 },   // 0xB0
+  {  3471,  16,  16,  20,    2,  -15 },   // 0xB1
+  {  3503,   7,  10,  10,    1,  -17 },   // 0xB2
+  {  3512,   7,  10,  10,    1,  -17 },   // 0xB3
+  {  3521,   6,   4,  12,    4,  -18 },   // 0xB4
+  {  3524,  13,  18,  15,    2,  -12 },   // 0xB5
+  {  3554,  11,  20,  15,    2,  -17 },   // 0xB6
+  {  3582,   2,   3,   8,    3,   -9 },   // 0xB7
+  {  3583,   5,   5,  12,    3,    1 },   // 0xB8
+  {  3587,   6,  10,  10,    2,  -17 },   // 0xB9
+  {  3595,   9,  12,  11,    1,  -17 },   // 0xBA
+  {  3609,  12,  11,  15,    2,  -11 },   // 0xBB
+  {  3626,  22,  18,  23,    2,  -17 },   // 0xBC
+  {  3676,  20,  18,  23,    2,  -17 },   // 0xBD
+  {  3721,  23,  18,  23,    1,  -17 },   // 0xBE
+  {  3773,   9,  18,  13,    2,  -12 },   // 0xBF
+  {  3794,  16,  22,  16,    0,  -21 },   // 0xC0
+  {  3838,  16,  22,  16,    0,  -21 },   // 0xC1
+  {  3882,  16,  22,  16,    0,  -21 },   // 0xC2
+  {  3926,  16,  21,  16,    0,  -20 },   // 0xC3
+  {  3968,  16,  22,  16,    0,  -21 },   // 0xC4
+  {  4012,  16,  23,  16,    0,  -22 },   // 0xC5
+  {  4058,  21,  18,  23,    0,  -17 },   // 0xC6
+  {  4106,  14,  23,  17,    1,  -17 },   // 0xC7
+  {  4147,  11,  22,  15,    2,  -21 },   // 0xC8
+  {  4178,  11,  22,  15,    2,  -21 },   // 0xC9
+  {  4209,  11,  22,  15,    2,  -21 },   // 0xCA
+  {  4240,  11,  22,  15,    2,  -21 },   // 0xCB
+  {  4271,   4,  22,   7,    1,  -21 },   // 0xCC
+  {  4282,   4,  22,   7,    2,  -21 },   // 0xCD
+  {  4293,   8,  22,   7,   -1,  -21 },   // 0xCE
+  {  4315,   6,  22,   7,    0,  -21 },   // 0xCF
+  {  4332,  17,  18,  19,    0,  -17 },   // 0xD0
+  {  4371,  13,  21,  18,    2,  -20 },   // 0xD1
+  {  4406,  16,  22,  19,    1,  -21 },   // 0xD2
+  {  4450,  16,  22,  19,    1,  -21 },   // 0xD3
+  {  4494,  16,  22,  19,    1,  -21 },   // 0xD4
+  {  4538,  16,  21,  19,    1,  -20 },   // 0xD5
+  {  4580,  16,  22,  19,    1,  -21 },   // 0xD6
+  {  4624,  14,  14,  20,    3,  -13 },   // 0xD7
+  {  4649,  16,  18,  19,    1,  -17 },   // 0xD8
+  {  4685,  13,  22,  18,    2,  -21 },   // 0xD9
+  {  4721,  13,  22,  18,    2,  -21 },   // 0xDA
+  {  4757,  13,  22,  18,    2,  -21 },   // 0xDB
+  {  4793,  13,  22,  18,    2,  -21 },   // 0xDC
+  {  4829,  14,  22,  15,    0,  -21 },   // 0xDD
+  {  4868,  11,  18,  15,    2,  -17 },   // 0xDE
+  {  4893,  12,  18,  15,    2,  -17 },   // 0xDF
+  {  4920,  11,  19,  14,    1,  -18 },   // 0xE0
+  {  4947,  11,  19,  14,    1,  -18 },   // 0xE1
+  {  4974,  11,  19,  14,    1,  -18 },   // 0xE2
+  {  5001,  11,  19,  14,    1,  -18 },   // 0xE3
+  {  5028,  11,  18,  14,    1,  -17 },   // 0xE4
+  {  5053,  11,  21,  14,    1,  -20 },   // 0xE5
+  {  5082,  21,  13,  23,    1,  -12 },   // 0xE6
+  {  5117,  10,  18,  13,    1,  -12 },   // 0xE7
+  {  5140,  12,  19,  14,    1,  -18 },   // 0xE8
+  {  5169,  12,  19,  14,    1,  -18 },   // 0xE9
+  {  5198,  12,  19,  14,    1,  -18 },   // 0xEA
+  {  5227,  12,  18,  14,    1,  -17 },   // 0xEB
+  {  5254,   6,  19,   7,   -1,  -18 },   // 0xEC
+  {  5269,   6,  19,   7,    1,  -18 },   // 0xED
+  {  5284,   8,  19,   7,   -1,  -18 },   // 0xEE
+  {  5303,   6,  18,   7,    0,  -17 },   // 0xEF
+  {  5317,  12,  18,  14,    1,  -17 },   // 0xF0
+  {  5344,  11,  19,  15,    2,  -18 },   // 0xF1
+  {  5371,  12,  19,  14,    1,  -18 },   // 0xF2
+  {  5400,  12,  19,  14,    1,  -18 },   // 0xF3
+  {  5429,  12,  19,  14,    1,  -18 },   // 0xF4
+  {  5458,  12,  19,  14,    1,  -18 },   // 0xF5
+  {  5487,  12,  18,  14,    1,  -17 },   // 0xF6
+  {  5514,  15,  12,  20,    3,  -13 },   // 0xF7
+  {  5537,  12,  15,  14,    1,  -13 },   // 0xF8
+  {  5560,  11,  19,  15,    2,  -18 },   // 0xF9
+  {  5587,  11,  19,  15,    2,  -18 },   // 0xFA
+  {  5614,  11,  19,  15,    2,  -18 },   // 0xFB
+  {  5641,  11,  18,  15,    2,  -17 },   // 0xFC
+  {  5666,  13,  24,  15,    1,  -18 },   // 0xFD
+  {  5705,  12,  23,  15,    2,  -17 },   // 0xFE
+  {  5740,  13,  23,  15,    1,  -17 } }; // 0xFF
+
+const GFXfont DejaVuSans12pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans12pt8bBitmaps,
+  (GFXglyph *)DejaVuSans12pt8bGlyphs,
+  0x20, 0xFF, 27 };
+
+// Approx. 7353 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans12pt8bMetrics[] PROGMEM = {
+  {   0,   8,   1 },   // 0x20
+  {   4,  10,   6 },   // 0x21
+  {   2,  11,   8 },   // 0x22
+  {   2,  20,  18 },   // 0x23
+  {   2,  15,  13 },   // 0x24
+  {   1,  23,  21 },   // 0x25
+  {   1,  19,  17 },   // 0x26
+  {   2,   7,   4 },   // 0x27
+  {   2,   9,   7 },   // 0x28
+  {   2,   9,   7 },   // 0x29
+  {   0,  12,  11 },   // 0x2A
+  {   3,  20,  19 },   // 0x2B
+  {   2,   8,   5 },   // 0x2C
+  {   1,   9,   7 },   // 0x2D
+  {   3,   8,   5 },   // 0x2E
+  {   0,   8,   8 },   // 0x2F
+  {   2,  15,  14 },   // 0x30
+  {   3,  15,  13 },   // 0x31
+  {   2,  15,  13 },   // 0x32
+  {   2,  15,  14 },   // 0x33
+  {   1,  15,  14 },   // 0x34
+  {   2,  15,  13 },   // 0x35
+  {   2,  15,  14 },   // 0x36
+  {   2,  15,  13 },   // 0x37
+  {   2,  15,  14 },   // 0x38
+  {   2,  15,  14 },   // 0x39
+  {   3,   8,   5 },   // 0x3A
+  {   2,   8,   5 },   // 0x3B
+  {   3,  20,  18 },   // 0x3C
+  {   3,  20,  18 },   // 0x3D
+  {   3,  20,  18 },   // 0x3E
+  {   2,  13,  11 },   // 0x3F
+  {   2,  24,  23 },   // 0x40
+  {   0,  16,  16 },   // 0x41
+  {   2,  16,  14 },   // 0x42
+  {   1,  17,  15 },   // 0x43
+  {   2,  18,  17 },   // 0x44
+  {   2,  15,  13 },   // 0x45
+  {   2,  14,  12 },   // 0x46
+  {   1,  19,  16 },   // 0x47
+  {   2,  18,  15 },   // 0x48
+  {   2,   7,   4 },   // 0x49
+  {  -2,   7,   4 },   // 0x4A
+  {   2,  16,  16 },   // 0x4B
+  {   2,  13,  13 },   // 0x4C
+  {   2,  21,  18 },   // 0x4D
+  {   2,  18,  15 },   // 0x4E
+  {   1,  19,  17 },   // 0x4F
+  {   2,  14,  13 },   // 0x50
+  {   1,  19,  17 },   // 0x51
+  {   2,  17,  15 },   // 0x52
+  {   2,  15,  14 },   // 0x53
+  {   0,  15,  14 },   // 0x54
+  {   2,  18,  15 },   // 0x55
+  {   0,  16,  16 },   // 0x56
+  {   1,  24,  23 },   // 0x57
+  {   1,  17,  16 },   // 0x58
+  {   0,  15,  14 },   // 0x59
+  {   1,  16,  15 },   // 0x5A
+  {   2,   9,   7 },   // 0x5B
+  {   0,   8,   8 },   // 0x5C
+  {   2,   9,   7 },   // 0x5D
+  {   3,  20,  18 },   // 0x5E
+  {   0,  12,  12 },   // 0x5F
+  {   2,  12,   8 },   // 0x60
+  {   1,  14,  12 },   // 0x61
+  {   2,  15,  14 },   // 0x62
+  {   1,  13,  11 },   // 0x63
+  {   1,  15,  13 },   // 0x64
+  {   1,  14,  13 },   // 0x65
+  {   1,   8,   9 },   // 0x66
+  {   1,  15,  13 },   // 0x67
+  {   2,  15,  13 },   // 0x68
+  {   2,   7,   4 },   // 0x69
+  {  -1,   7,   4 },   // 0x6A
+  {   2,  14,  14 },   // 0x6B
+  {   2,   6,   4 },   // 0x6C
+  {   2,  24,  22 },   // 0x6D
+  {   2,  15,  13 },   // 0x6E
+  {   1,  14,  13 },   // 0x6F
+  {   2,  15,  14 },   // 0x70
+  {   1,  15,  13 },   // 0x71
+  {   2,  10,  10 },   // 0x72
+  {   1,  12,  11 },   // 0x73
+  {   0,   9,   8 },   // 0x74
+  {   2,  15,  13 },   // 0x75
+  {   1,  15,  14 },   // 0x76
+  {   1,  20,  19 },   // 0x77
+  {   1,  15,  14 },   // 0x78
+  {   1,  15,  14 },   // 0x79
+  {   1,  13,  12 },   // 0x7A
+  {   3,  15,  12 },   // 0x7B
+  {   3,   8,   5 },   // 0x7C
+  {   3,  15,  12 },   // 0x7D
+  {   3,  20,  18 },   // 0x7E
+  {   1,  14,  13 },   // 0x7F
+  {   1,  14,  13 },   // 0x80
+  {   1,  14,  13 },   // 0x81
+  {   1,  14,  13 },   // 0x82
+  {   1,  14,  13 },   // 0x83
+  {   1,  14,  13 },   // 0x84
+  {   1,  14,  13 },   // 0x85
+  {   1,  14,  13 },   // 0x86
+  {   1,  14,  13 },   // 0x87
+  {   1,  14,  13 },   // 0x88
+  {   1,  14,  13 },   // 0x89
+  {   1,  14,  13 },   // 0x8A
+  {   1,  14,  13 },   // 0x8B
+  {   1,  14,  13 },   // 0x8C
+  {   1,  14,  13 },   // 0x8D
+  {   1,  14,  13 },   // 0x8E
+  {   1,  14,  13 },   // 0x8F
+  {   1,  14,  13 },   // 0x90
+  {   1,  14,  13 },   // 0x91
+  {   1,  14,  13 },   // 0x92
+  {   1,  14,  13 },   // 0x93
+  {   1,  14,  13 },   // 0x94
+  {   1,  14,  13 },   // 0x95
+  {   1,  14,  13 },   // 0x96
+  {   1,  14,  13 },   // 0x97
+  {   1,  14,  13 },   // 0x98
+  {   1,  14,  13 },   // 0x99
+  {   1,  14,  13 },   // 0x9A
+  {   1,  14,  13 },   // 0x9B
+  {   1,  14,  13 },   // 0x9C
+  {   1,  14,  13 },   // 0x9D
+  {   1,  14,  13 },   // 0x9E
+  {   1,  14,  13 },   // 0x9F
+  {   0,   8,   1 },   // 0xA0
+  {   4,  10,   6 },   // 0xA1
+  {   2,  15,  12 },   // 0xA2
+  {   1,  15,  13 },   // 0xA3
+  {   1,  15,  15 },   // 0xA4
+  {   1,  15,  13 },   // 0xA5
+  {   3,   8,   5 },   // 0xA6
+  {   1,  12,  11 },   // 0xA7
+  {   3,  12,   9 },   // 0xA8
+  {   3,  24,  20 },   // 0xA9
+  {   1,  11,  10 },   // 0xAA
+  {   2,  15,  14 },   // 0xAB
+  {   3,  20,  18 },   // 0xAC
+  {   1,   9,   7 },   // 0xAD
+  {   3,  24,  20 },   // 0xAE
+  {   3,  12,  10 },   // 0xAF
+  {   2,  12,   9 },   // 0xB0
+  {   2,  20,  18 },   // 0xB1
+  {   1,  10,   8 },   // 0xB2
+  {   1,  10,   8 },   // 0xB3
+  {   4,  12,  10 },   // 0xB4
+  {   2,  15,  15 },   // 0xB5
+  {   2,  15,  13 },   // 0xB6
+  {   3,   8,   5 },   // 0xB7
+  {   3,  12,   8 },   // 0xB8
+  {   2,  10,   8 },   // 0xB9
+  {   1,  11,  10 },   // 0xBA
+  {   2,  15,  14 },   // 0xBB
+  {   2,  23,  24 },   // 0xBC
+  {   2,  23,  22 },   // 0xBD
+  {   1,  23,  24 },   // 0xBE
+  {   2,  13,  11 },   // 0xBF
+  {   0,  16,  16 },   // 0xC0
+  {   0,  16,  16 },   // 0xC1
+  {   0,  16,  16 },   // 0xC2
+  {   0,  16,  16 },   // 0xC3
+  {   0,  16,  16 },   // 0xC4
+  {   0,  16,  16 },   // 0xC5
+  {   0,  23,  21 },   // 0xC6
+  {   1,  17,  15 },   // 0xC7
+  {   2,  15,  13 },   // 0xC8
+  {   2,  15,  13 },   // 0xC9
+  {   2,  15,  13 },   // 0xCA
+  {   2,  15,  13 },   // 0xCB
+  {   1,   7,   5 },   // 0xCC
+  {   2,   7,   6 },   // 0xCD
+  {  -1,   7,   7 },   // 0xCE
+  {   0,   7,   6 },   // 0xCF
+  {   0,  19,  17 },   // 0xD0
+  {   2,  18,  15 },   // 0xD1
+  {   1,  19,  17 },   // 0xD2
+  {   1,  19,  17 },   // 0xD3
+  {   1,  19,  17 },   // 0xD4
+  {   1,  19,  17 },   // 0xD5
+  {   1,  19,  17 },   // 0xD6
+  {   3,  20,  17 },   // 0xD7
+  {   1,  19,  17 },   // 0xD8
+  {   2,  18,  15 },   // 0xD9
+  {   2,  18,  15 },   // 0xDA
+  {   2,  18,  15 },   // 0xDB
+  {   2,  18,  15 },   // 0xDC
+  {   0,  15,  14 },   // 0xDD
+  {   2,  15,  13 },   // 0xDE
+  {   2,  15,  14 },   // 0xDF
+  {   1,  14,  12 },   // 0xE0
+  {   1,  14,  12 },   // 0xE1
+  {   1,  14,  12 },   // 0xE2
+  {   1,  14,  12 },   // 0xE3
+  {   1,  14,  12 },   // 0xE4
+  {   1,  14,  12 },   // 0xE5
+  {   1,  23,  22 },   // 0xE6
+  {   1,  13,  11 },   // 0xE7
+  {   1,  14,  13 },   // 0xE8
+  {   1,  14,  13 },   // 0xE9
+  {   1,  14,  13 },   // 0xEA
+  {   1,  14,  13 },   // 0xEB
+  {  -1,   7,   5 },   // 0xEC
+  {   1,   7,   7 },   // 0xED
+  {  -1,   7,   7 },   // 0xEE
+  {   0,   7,   6 },   // 0xEF
+  {   1,  14,  13 },   // 0xF0
+  {   2,  15,  13 },   // 0xF1
+  {   1,  14,  13 },   // 0xF2
+  {   1,  14,  13 },   // 0xF3
+  {   1,  14,  13 },   // 0xF4
+  {   1,  14,  13 },   // 0xF5
+  {   1,  14,  13 },   // 0xF6
+  {   3,  20,  18 },   // 0xF7
+  {   1,  14,  13 },   // 0xF8
+  {   2,  15,  13 },   // 0xF9
+  {   2,  15,  13 },   // 0xFA
+  {   2,  15,  13 },   // 0xFB
+  {   2,  15,  13 },   // 0xFC
+  {   1,  15,  14 },   // 0xFD
+  {   2,  15,  14 },   // 0xFE
+  {   1,  15,  14 }    // 0xFF
+};
+const FontMetrics DejaVuSans12pt8bWidths = { DejaVuSans12pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS12PTLAT1__H
@@ -0,0 +1,1087 @@
+#ifndef DEJAVUSANS14PTLAT1__H
+#define DEJAVUSANS14PTLAT1__H
+const uint8_t DejaVuSans14pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF0, 0xC7, 0x8F, 0x1E,
+  0x3C, 0x78, 0xF1, 0x80, 0x01, 0x86, 0x00, 0x61, 0x80, 0x18, 0x60, 0x0E,
+  0x30, 0x03, 0x0C, 0x1F, 0xFF, 0xF7, 0xFF, 0xFC, 0x1C, 0x60, 0x06, 0x18,
+  0x01, 0x86, 0x00, 0x63, 0x83, 0xFF, 0xFE, 0xFF, 0xFF, 0x83, 0x0C, 0x00,
+  0xC7, 0x00, 0x61, 0x80, 0x18, 0x60, 0x06, 0x18, 0x00, 0x02, 0x00, 0x10,
+  0x00, 0x80, 0x3F, 0x87, 0xFF, 0x39, 0x1B, 0x88, 0x1C, 0x40, 0xE2, 0x07,
+  0xF0, 0x1F, 0xF0, 0x7F, 0xC0, 0x7F, 0x01, 0x3C, 0x08, 0xE0, 0x47, 0x02,
+  0x3E, 0x13, 0xBF, 0xFC, 0x7F, 0x80, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40,
+  0x3E, 0x00, 0xE0, 0xFE, 0x01, 0x81, 0x8C, 0x06, 0x06, 0x0C, 0x1C, 0x0C,
+  0x18, 0x30, 0x18, 0x30, 0xE0, 0x30, 0x61, 0x80, 0x60, 0xC6, 0x00, 0x63,
+  0x1C, 0x00, 0xFE, 0x31, 0xF0, 0xF8, 0xC7, 0xF0, 0x03, 0x8C, 0x60, 0x06,
+  0x30, 0x60, 0x1C, 0x60, 0xC0, 0x30, 0xC1, 0x80, 0xC1, 0x83, 0x03, 0x83,
+  0x06, 0x06, 0x03, 0x18, 0x18, 0x07, 0xF0, 0x70, 0x07, 0xC0, 0x07, 0xE0,
+  0x03, 0xFE, 0x00, 0xF0, 0x40, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x06, 0xF0, 0x39, 0x8F, 0x07,
+  0x70, 0xF0, 0xCE, 0x0F, 0x39, 0xC0, 0xE6, 0x38, 0x1F, 0xC7, 0x01, 0xF0,
+  0x70, 0x1E, 0x0F, 0x07, 0xE0, 0xFF, 0xDE, 0x07, 0xE1, 0xE0, 0xFF, 0xFC,
+  0x0C, 0x61, 0x8C, 0x31, 0xC7, 0x18, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0x61, 0xC7, 0x0C, 0x30, 0x61, 0x83, 0xC1, 0x86, 0x1C, 0x30, 0xE3, 0x86,
+  0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x18, 0xE3, 0x8C, 0x71, 0x86, 0x30,
+  0x06, 0x00, 0x60, 0xC6, 0x3E, 0x67, 0x3F, 0xC0, 0xF0, 0x0F, 0x03, 0xFC,
+  0xE6, 0x7C, 0x63, 0x06, 0x00, 0x60, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x77, 0x76, 0xEC, 0xFF, 0xFC, 0xFF, 0x80, 0x01, 0x81, 0xC0,
+  0xC0, 0x60, 0x70, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80,
+  0xC0, 0xC0, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x0E, 0x06, 0x00, 0x0F, 0xC0,
+  0x7F, 0x83, 0x87, 0x1C, 0x0E, 0x70, 0x3B, 0x80, 0x6E, 0x01, 0xF8, 0x07,
+  0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01,
+  0x9C, 0x0E, 0x70, 0x38, 0xE1, 0xC1, 0xFE, 0x03, 0xF0, 0x1F, 0x0F, 0xF0,
+  0xE7, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x7F, 0xF7, 0xFF, 0x3F, 0x0F, 0xFC, 0xE1, 0xE8, 0x0F, 0x00, 0x70, 0x07,
+  0x00, 0x70, 0x07, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x83, 0xFF,
+  0x10, 0x38, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1C, 0x1F, 0x80,
+  0xFE, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x74, 0x07, 0xBF, 0xF8, 0x7F, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0xC0,
+  0x1B, 0x80, 0x77, 0x00, 0xCE, 0x03, 0x1C, 0x0E, 0x38, 0x18, 0x70, 0x60,
+  0xE1, 0xC1, 0xC3, 0x03, 0x8C, 0x07, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x7F, 0xF3, 0xFF, 0x9C,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0xF0, 0x7F, 0xE2, 0x07,
+  0x80, 0x1C, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x74,
+  0x07, 0xBF, 0xF8, 0x7F, 0x00, 0x03, 0xF0, 0x3F, 0xE1, 0xC0, 0x8E, 0x00,
+  0x70, 0x01, 0xC0, 0x0E, 0x00, 0x39, 0xF0, 0xEF, 0xF3, 0xE1, 0xEF, 0x03,
+  0xB8, 0x07, 0xE0, 0x1F, 0x80, 0x76, 0x01, 0xD8, 0x07, 0x70, 0x38, 0xE1,
+  0xE1, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x1E, 0x00, 0xE0, 0x07,
+  0x00, 0x70, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0xF0, 0x07, 0x00,
+  0x38, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x38,
+  0x00, 0x0F, 0xE0, 0xFF, 0xC7, 0x87, 0xB8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
+  0x01, 0xDE, 0x1E, 0x1F, 0xE0, 0x7F, 0x87, 0x87, 0x9C, 0x0E, 0xE0, 0x1F,
+  0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0, 0x3D, 0xE1, 0xE3, 0xFF, 0x03, 0xF0,
+  0x0F, 0x80, 0xFF, 0x87, 0x87, 0x1C, 0x0E, 0xE0, 0x1B, 0x80, 0x6E, 0x01,
+  0xF8, 0x07, 0xE0, 0x1D, 0xC0, 0xF7, 0x87, 0xCF, 0xF7, 0x0F, 0x9C, 0x00,
+  0x70, 0x03, 0x80, 0x0E, 0x00, 0x71, 0x03, 0x87, 0xFC, 0x0F, 0xC0, 0xFF,
+  0x80, 0x00, 0x00, 0x7F, 0xC0, 0x77, 0x70, 0x00, 0x00, 0x00, 0x07, 0x77,
+  0x6E, 0xC0, 0x00, 0x00, 0x80, 0x03, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
+  0x03, 0xF0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
+  0x7E, 0x00, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x80,
+  0x00, 0x78, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+  0x0F, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x0F, 0xFB, 0x87, 0x40, 0x70, 0x0E,
+  0x01, 0xC0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x38, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0x00, 0x00, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x00, 0x7F, 0x00,
+  0x03, 0xFF, 0xC0, 0x07, 0x80, 0xF0, 0x0E, 0x00, 0x38, 0x18, 0x00, 0x1C,
+  0x30, 0x00, 0x0E, 0x70, 0x7C, 0xC6, 0x60, 0xFE, 0xC7, 0xE1, 0xC3, 0xC3,
+  0xC3, 0x81, 0xC3, 0xC3, 0x00, 0xC3, 0xC3, 0x00, 0xC3, 0xC3, 0x00, 0xC3,
+  0xC3, 0x00, 0xC6, 0xC3, 0x81, 0xC6, 0xE1, 0xC3, 0xDC, 0x60, 0xFE, 0xF8,
+  0x70, 0x7C, 0xE0, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1E, 0x00, 0x20,
+  0x07, 0x80, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x73,
+  0x80, 0x1C, 0xE0, 0x0F, 0x3C, 0x03, 0x87, 0x00, 0xE1, 0xC0, 0x70, 0x38,
+  0x1C, 0x0E, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xE0, 0x1C, 0x78, 0x07, 0x9C,
+  0x00, 0xE7, 0x00, 0x3B, 0x80, 0x07, 0xFF, 0xC3, 0xFF, 0xCE, 0x07, 0x38,
+  0x0E, 0xE0, 0x3B, 0x80, 0xEE, 0x03, 0xB8, 0x1C, 0xFF, 0xE3, 0xFF, 0x8E,
+  0x07, 0xB8, 0x0E, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x3F,
+  0x81, 0xEF, 0xFF, 0x3F, 0xF0, 0x03, 0xF8, 0x0F, 0xFE, 0x1E, 0x07, 0x38,
+  0x03, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x38, 0x03, 0x1E, 0x07, 0x0F, 0xFE, 0x03, 0xF8, 0xFF, 0xC0, 0x7F,
+  0xFC, 0x38, 0x0F, 0x1C, 0x01, 0xCE, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x0F,
+  0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00,
+  0x3F, 0x00, 0x1F, 0x80, 0x1D, 0xC0, 0x0E, 0xE0, 0x0E, 0x70, 0x1E, 0x3F,
+  0xFE, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0xF7, 0xFF, 0xB8, 0x01, 0xC0, 0x0E,
+  0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x3F, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xFF, 0xDF, 0xFB, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x07, 0x83, 0xC7,
+  0x00, 0x67, 0x00, 0x13, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00,
+  0x70, 0x00, 0x38, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0x00, 0x1D, 0xC0,
+  0x0E, 0xE0, 0x07, 0x38, 0x03, 0x8F, 0x03, 0xC3, 0xFF, 0xC0, 0x7F, 0x80,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x7E, 0x00,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F,
+  0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+  0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0x7E, 0xF0, 0xE0, 0x3C, 0xE0, 0x78,
+  0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00,
+  0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xEF, 0x80, 0xE7, 0xC0,
+  0xE3, 0xE0, 0xE1, 0xF0, 0xE0, 0xF8, 0xE0, 0x7C, 0xE0, 0x3E, 0xE0, 0x1F,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7F, 0xEE, 0x1D, 0xFB, 0x87, 0x7E, 0xF3, 0xDF, 0x9C, 0xE7,
+  0xE7, 0x39, 0xF9, 0xFE, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0xE1, 0xE1, 0xF8,
+  0x78, 0x7E, 0x1E, 0x1F, 0x83, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00,
+  0x1F, 0x80, 0x07, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0,
+  0xFF, 0xC1, 0xFB, 0x83, 0xF7, 0x87, 0xE7, 0x8F, 0xC7, 0x1F, 0x8F, 0x3F,
+  0x0E, 0x7E, 0x1E, 0xFC, 0x1D, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0,
+  0x7F, 0x80, 0xFF, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xE1, 0xE0,
+  0xE0, 0x1C, 0x70, 0x03, 0x9C, 0x00, 0xEE, 0x00, 0x1F, 0x80, 0x07, 0xE0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00,
+  0x77, 0x00, 0x39, 0xC0, 0x0E, 0x38, 0x07, 0x07, 0x87, 0x80, 0xFF, 0xC0,
+  0x0F, 0xC0, 0xFF, 0x87, 0xFF, 0x38, 0x3D, 0xC0, 0xFE, 0x03, 0xF0, 0x1F,
+  0x80, 0xFC, 0x07, 0xE0, 0x7F, 0x07, 0xBF, 0xF9, 0xFF, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x03,
+  0xF0, 0x03, 0xFF, 0x01, 0xE1, 0xE0, 0xE0, 0x1C, 0x70, 0x03, 0x9C, 0x00,
+  0xEE, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F,
+  0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x77, 0x00, 0x39, 0xC0, 0x0E, 0x38,
+  0x07, 0x07, 0x87, 0x80, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0xFF, 0xC0, 0xFF, 0xE0, 0xE0, 0xF0, 0xE0, 0x38, 0xE0,
+  0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0xFF, 0xE0, 0xFF,
+  0xC0, 0xE1, 0xE0, 0xE0, 0xF0, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x3C, 0xE0,
+  0x1C, 0xE0, 0x1E, 0xE0, 0x0E, 0xE0, 0x0F, 0x0F, 0xE0, 0xFF, 0xE7, 0x83,
+  0xBC, 0x02, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3E, 0x00, 0x7F, 0x80, 0xFF,
+  0x80, 0xFF, 0x80, 0x3E, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x80,
+  0x3F, 0x81, 0xEF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x70,
+  0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E,
+  0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF8, 0x0F, 0x70, 0x1C, 0xF0, 0x78, 0xFF,
+  0xE0, 0x7F, 0x00, 0xE0, 0x01, 0xDC, 0x00, 0xE7, 0x00, 0x39, 0xE0, 0x1E,
+  0x38, 0x07, 0x0E, 0x01, 0xC3, 0xC0, 0xF0, 0x70, 0x38, 0x1C, 0x0E, 0x03,
+  0x87, 0x00, 0xE1, 0xC0, 0x3C, 0xF0, 0x07, 0x38, 0x01, 0xCE, 0x00, 0x7F,
+  0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80,
+  0xE0, 0x1C, 0x03, 0xF0, 0x0E, 0x01, 0xDC, 0x0F, 0x81, 0xCE, 0x06, 0xC0,
+  0xE7, 0x03, 0x60, 0x73, 0x81, 0xB0, 0x38, 0xE0, 0xDC, 0x38, 0x70, 0xC6,
+  0x1C, 0x38, 0x63, 0x0E, 0x1C, 0x31, 0x87, 0x07, 0x18, 0xC7, 0x03, 0x98,
+  0x33, 0x81, 0xCC, 0x19, 0xC0, 0xE6, 0x0C, 0xE0, 0x3B, 0x06, 0xE0, 0x1F,
+  0x01, 0xF0, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0x7C, 0x01, 0xE0, 0x3C, 0x00,
+  0xE0, 0x0E, 0x00, 0x78, 0x07, 0x9E, 0x07, 0x87, 0x03, 0x83, 0xC3, 0xC0,
+  0xE3, 0xC0, 0x79, 0xC0, 0x1F, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0xF0,
+  0x00, 0xF8, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7B, 0xC0, 0x38, 0xF0, 0x3C,
+  0x38, 0x3C, 0x1E, 0x1C, 0x07, 0x1E, 0x01, 0xDE, 0x00, 0xF0, 0xF0, 0x07,
+  0xBC, 0x07, 0x8E, 0x03, 0x87, 0x83, 0xC1, 0xE3, 0xC0, 0x71, 0xC0, 0x3D,
+  0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00,
+  0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8F, 0xFF, 0xC0, 0x70, 0x18, 0x0C, 0x07, 0x01, 0x80, 0xC0, 0x60,
+  0x18, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x60, 0x18, 0x0C, 0x06, 0x03, 0x80,
+  0xC0, 0x60, 0x38, 0x0C, 0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x7F, 0xFF, 0x01, 0xC0,
+  0x01, 0xF0, 0x01, 0xDC, 0x01, 0xC7, 0x01, 0xC1, 0xC1, 0x80, 0x31, 0x80,
+  0x0C, 0xFF, 0xFF, 0xFF, 0xF0, 0xE1, 0xC3, 0x06, 0x0C, 0x3F, 0x87, 0xFC,
+  0x41, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x1F, 0xF7, 0xFF, 0xF0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x0F, 0xF1, 0xF7, 0xF7, 0x3E, 0x70, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x9F, 0x1D, 0xFC, 0xF8, 0xF7, 0x83,
+  0xB8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F,
+  0x83, 0xBE, 0x3D, 0xDF, 0xCE, 0x7C, 0x00, 0x0F, 0xE1, 0xFF, 0x3C, 0x17,
+  0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xF0, 0x07,
+  0x00, 0x3C, 0x11, 0xFF, 0x0F, 0xE0, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x7C, 0xE7, 0xF7, 0x78, 0xFB, 0x83, 0xF8, 0x0F,
+  0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3B, 0x83, 0xDE,
+  0x3E, 0x7F, 0x71, 0xF3, 0x80, 0x0F, 0xC0, 0x7F, 0xC3, 0x87, 0x9C, 0x0E,
+  0xE0, 0x1F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0x80, 0x0F, 0x00,
+  0x1C, 0x00, 0x3C, 0x08, 0x7F, 0xE0, 0xFE, 0x00, 0x0F, 0xC7, 0xF3, 0xC0,
+  0xE0, 0x38, 0x0E, 0x0F, 0xFB, 0xFE, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x00, 0x1F,
+  0x39, 0xFD, 0xDE, 0x3E, 0xE0, 0xFE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07,
+  0xE0, 0x3F, 0x01, 0xF8, 0x0E, 0xE0, 0xF7, 0x8F, 0x9F, 0xDC, 0x7C, 0xE0,
+  0x07, 0x00, 0x38, 0x03, 0x88, 0x3C, 0x7F, 0xC1, 0xF8, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE7, 0xCE, 0xFE, 0xF8, 0xEF,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x1C, 0x71, 0xC0, 0x00, 0x01, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x3F, 0xEF, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x83, 0xDC, 0x3C,
+  0xE3, 0xC7, 0x3C, 0x3B, 0xC1, 0xFC, 0x0F, 0xC0, 0x7E, 0x03, 0xF8, 0x1D,
+  0xE0, 0xE7, 0x87, 0x1E, 0x38, 0x79, 0xC3, 0xEE, 0x0F, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0x83, 0xE7, 0x7F, 0x3F, 0xBE,
+  0x3B, 0x1D, 0xE0, 0xF0, 0x7E, 0x07, 0x03, 0xF0, 0x38, 0x1F, 0x81, 0xC0,
+  0xFC, 0x0E, 0x07, 0xE0, 0x70, 0x3F, 0x03, 0x81, 0xF8, 0x1C, 0x0F, 0xC0,
+  0xE0, 0x7E, 0x07, 0x03, 0xF0, 0x38, 0x1F, 0x81, 0xC0, 0xE0, 0xE7, 0xCE,
+  0xFE, 0xF8, 0xEF, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0x0F, 0xC0, 0xFF,
+  0xC7, 0x87, 0x9C, 0x0E, 0xF0, 0x3F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x1F, 0x80, 0x7F, 0x03, 0xDC, 0x0E, 0x78, 0x78, 0xFF, 0xC0, 0xFC, 0x00,
+  0xE7, 0xC7, 0x7F, 0x3E, 0x3D, 0xE0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC,
+  0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xE0, 0xEF, 0x8F, 0x77, 0xF3, 0x9F,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x1F,
+  0x39, 0xFD, 0xDE, 0x3E, 0xE0, 0xFE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07,
+  0xE0, 0x3F, 0x01, 0xF8, 0x0E, 0xE0, 0xF7, 0x8F, 0x9F, 0xDC, 0x7C, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0xE7, 0xF7,
+  0xFE, 0x1E, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+  0x07, 0x03, 0x80, 0x1F, 0x8F, 0xFB, 0xC1, 0x70, 0x0E, 0x01, 0xE0, 0x1F,
+  0x81, 0xFC, 0x07, 0xC0, 0x3C, 0x03, 0x80, 0x78, 0x1F, 0xFF, 0x8F, 0xC0,
+  0x38, 0x0E, 0x03, 0x80, 0xE0, 0xFF, 0xFF, 0xF3, 0x80, 0xE0, 0x38, 0x0E,
+  0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3C, 0x07, 0xF0, 0xFC,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x0F, 0x71, 0xF7, 0xF7, 0x3E, 0x70, 0xE0,
+  0x1D, 0xC0, 0xE7, 0x03, 0x9C, 0x0E, 0x38, 0x70, 0xE1, 0xC3, 0xCF, 0x07,
+  0x38, 0x1C, 0xE0, 0x7F, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x1E, 0x00,
+  0x78, 0x00, 0xE0, 0xE0, 0x7E, 0x0F, 0x07, 0x70, 0xF0, 0xE7, 0x0F, 0x0E,
+  0x71, 0xF8, 0xE7, 0x99, 0x9E, 0x39, 0x99, 0xC3, 0x99, 0x9C, 0x3B, 0x8D,
+  0xC3, 0xF0, 0xFC, 0x1F, 0x0F, 0x81, 0xF0, 0xF8, 0x1E, 0x07, 0x80, 0xE0,
+  0x78, 0x0E, 0x07, 0x00, 0xF0, 0x3D, 0xE1, 0xE3, 0xCF, 0x07, 0x38, 0x1F,
+  0xE0, 0x3F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3F, 0x01, 0xFE, 0x0F,
+  0x3C, 0x38, 0x71, 0xE1, 0xEF, 0x03, 0xC0, 0xE0, 0x1D, 0xC0, 0xE7, 0x03,
+  0x9E, 0x1E, 0x38, 0x70, 0xE1, 0xC3, 0xCF, 0x07, 0x38, 0x1D, 0xE0, 0x3F,
+  0x00, 0xFC, 0x03, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x01, 0xC0, 0x0F,
+  0x00, 0x38, 0x01, 0xE0, 0x1F, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+  0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x01, 0xC0, 0x3C,
+  0x07, 0x80, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0xFC, 0x3C, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x70, 0x7C, 0x0F,
+  0x80, 0x38, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0xC0, 0x3F, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xF8, 0x1F, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xF0, 0x3E, 0x0E, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x87, 0xE0, 0xF8, 0x00,
+  0x3F, 0x00, 0xBF, 0xE1, 0xF0, 0x7F, 0xD0, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x07, 0xE1, 0xFF, 0x3D, 0x17, 0x10,
+  0xF1, 0x0E, 0x10, 0xE1, 0x0E, 0x10, 0xE1, 0x0E, 0x10, 0xF1, 0x07, 0x10,
+  0x39, 0x11, 0xFF, 0x07, 0xE0, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x03,
+  0xF0, 0x3F, 0xC3, 0x82, 0x3C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x3F, 0xF9, 0xFF, 0xC1, 0xC0, 0x0E, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x40, 0x05, 0xC0, 0x1D,
+  0xDF, 0x71, 0xFF, 0xC1, 0xC7, 0x07, 0x07, 0x0C, 0x06, 0x18, 0x0C, 0x30,
+  0x18, 0x70, 0x70, 0x71, 0xC1, 0xFF, 0xC7, 0x7D, 0xDC, 0x01, 0xD0, 0x01,
+  0x00, 0xF0, 0x1E, 0xE0, 0x39, 0xE0, 0xF1, 0xC1, 0xC3, 0xC7, 0x83, 0x8E,
+  0x07, 0xBC, 0x07, 0x70, 0x7F, 0xFC, 0xFF, 0xF8, 0x1F, 0x00, 0x1C, 0x00,
+  0x38, 0x0F, 0xFF, 0x9F, 0xFF, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x1F, 0x87, 0xF9,
+  0xC1, 0x30, 0x06, 0x00, 0xE0, 0x0F, 0x03, 0xF0, 0x67, 0x98, 0x3B, 0x03,
+  0xE0, 0x3E, 0x06, 0xF0, 0xCF, 0xB0, 0x7C, 0x03, 0x80, 0x38, 0x03, 0x00,
+  0x64, 0x1C, 0xFF, 0x0F, 0xC0, 0xE7, 0xE7, 0xE7, 0x01, 0xF8, 0x00, 0x60,
+  0x60, 0x18, 0x01, 0x83, 0x0F, 0xCC, 0x23, 0x82, 0x44, 0x60, 0x02, 0x46,
+  0x00, 0x28, 0xC0, 0x01, 0x8C, 0x00, 0x18, 0xC0, 0x01, 0x8C, 0x00, 0x18,
+  0xC0, 0x01, 0x8C, 0x00, 0x14, 0x60, 0x02, 0x46, 0x00, 0x22, 0x38, 0x24,
+  0x30, 0xFC, 0xC1, 0x80, 0x18, 0x06, 0x06, 0x00, 0x1F, 0x80, 0x3F, 0x10,
+  0x60, 0x0C, 0x03, 0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC1, 0xD8, 0xF3, 0xEC,
+  0x00, 0xFF, 0xC0, 0x04, 0x10, 0xC3, 0x1C, 0x73, 0x8E, 0x71, 0xCE, 0x38,
+  0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x0C, 0x30, 0x41, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06,
+  0x00, 0x03, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x60, 0x60, 0x18, 0x01, 0x83,
+  0x7F, 0x8C, 0x26, 0x0E, 0x44, 0x60, 0x62, 0x46, 0x06, 0x28, 0x60, 0xE1,
+  0x87, 0xF8, 0x18, 0x63, 0x81, 0x86, 0x1C, 0x18, 0x61, 0xC1, 0x86, 0x0C,
+  0x14, 0x60, 0xE2, 0x46, 0x06, 0x22, 0x60, 0x64, 0x36, 0x07, 0xC1, 0x80,
+  0x18, 0x06, 0x06, 0x00, 0x1F, 0x80, 0xFF, 0xFF, 0x3C, 0x7E, 0xE7, 0xC3,
+  0xC3, 0xE7, 0x7E, 0x3C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x7C, 0x86, 0x03, 0x03, 0x07, 0x06, 0x0C, 0x1C, 0x38, 0x60,
+  0xFF, 0x7C, 0x87, 0x03, 0x07, 0x3C, 0x06, 0x03, 0x03, 0x03, 0x86, 0x7C,
+  0x1C, 0xE3, 0x18, 0xC0, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0,
+  0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38,
+  0x3C, 0xF0, 0xF3, 0xFF, 0xFE, 0xF3, 0xF8, 0x00, 0xE0, 0x03, 0x80, 0x0E,
+  0x00, 0x38, 0x00, 0xE0, 0x00, 0x1F, 0xF3, 0xFF, 0x7E, 0x3F, 0xE3, 0xFE,
+  0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x37, 0xE3, 0x3E, 0x30, 0xE3, 0x06,
+  0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06,
+  0x30, 0x63, 0x06, 0x30, 0xFF, 0x80, 0x30, 0xC7, 0xFF, 0x00, 0x38, 0xD8,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x1E, 0x1C, 0xE6,
+  0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9C, 0xE1, 0xE0, 0x00,
+  0x7F, 0x80, 0x82, 0x0C, 0x30, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C,
+  0x73, 0x8E, 0x71, 0xCE, 0x38, 0xC3, 0x08, 0x20, 0x38, 0x01, 0xC1, 0xB0,
+  0x03, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x60, 0x03, 0x01,
+  0xC0, 0x06, 0x03, 0x00, 0x0C, 0x0E, 0x00, 0x18, 0x18, 0x00, 0x30, 0x60,
+  0x33, 0xFC, 0xC0, 0xE0, 0x03, 0x02, 0xC0, 0x0E, 0x0D, 0x80, 0x18, 0x13,
+  0x00, 0x70, 0x46, 0x00, 0xC1, 0x8C, 0x03, 0x03, 0xFE, 0x0E, 0x00, 0x30,
+  0x18, 0x00, 0x60, 0x70, 0x00, 0xC0, 0x38, 0x01, 0xC3, 0x60, 0x06, 0x01,
+  0x80, 0x38, 0x06, 0x00, 0xC0, 0x18, 0x06, 0x00, 0x60, 0x38, 0x01, 0x80,
+  0xC0, 0x06, 0x07, 0x00, 0x18, 0x18, 0x00, 0x60, 0xC7, 0xCF, 0xF3, 0x21,
+  0x80, 0x18, 0x03, 0x00, 0xE0, 0x0C, 0x03, 0x00, 0x70, 0x1C, 0x01, 0x80,
+  0x60, 0x0C, 0x03, 0x00, 0x70, 0x1C, 0x03, 0x80, 0x60, 0x18, 0x03, 0x80,
+  0xFF, 0x7C, 0x00, 0xE0, 0x87, 0x00, 0xC0, 0x03, 0x01, 0xC0, 0x07, 0x01,
+  0x80, 0x3C, 0x03, 0x00, 0x06, 0x07, 0x00, 0x03, 0x06, 0x00, 0x03, 0x0E,
+  0x00, 0x03, 0x0C, 0x00, 0x86, 0x18, 0x0C, 0x7C, 0x18, 0x1C, 0x00, 0x30,
+  0x2C, 0x00, 0x70, 0x6C, 0x00, 0x60, 0x4C, 0x00, 0xE0, 0x8C, 0x00, 0xC1,
+  0x8C, 0x01, 0x81, 0xFF, 0x03, 0x80, 0x0C, 0x03, 0x00, 0x0C, 0x07, 0x00,
+  0x0C, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x01, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x05, 0xC3, 0xBF, 0xE1, 0xF0, 0x03, 0x80, 0x00, 0x30, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1C, 0xE0, 0x07, 0x38, 0x03,
+  0xCF, 0x00, 0xE1, 0xC0, 0x38, 0x70, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xFF,
+  0xF0, 0xFF, 0xFC, 0x38, 0x07, 0x1E, 0x01, 0xE7, 0x00, 0x39, 0xC0, 0x0E,
+  0xE0, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x7F, 0x80, 0x1C, 0xE0, 0x07, 0x38, 0x03, 0xCF, 0x00, 0xE1,
+  0xC0, 0x38, 0x70, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xFF, 0xF0, 0xFF, 0xFC,
+  0x38, 0x07, 0x1E, 0x01, 0xE7, 0x00, 0x39, 0xC0, 0x0E, 0xE0, 0x01, 0xC0,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x33, 0x00, 0x18, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x1F, 0xE0, 0x07, 0x38, 0x01, 0xCE, 0x00, 0xF3, 0xC0, 0x38, 0x70,
+  0x0E, 0x1C, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x0E,
+  0x01, 0xC7, 0x80, 0x79, 0xC0, 0x0E, 0x70, 0x03, 0xB8, 0x00, 0x70, 0x03,
+  0x98, 0x01, 0xFE, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80,
+  0x1C, 0xE0, 0x07, 0x38, 0x03, 0xCF, 0x00, 0xE1, 0xC0, 0x38, 0x70, 0x1C,
+  0x0E, 0x07, 0x03, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x38, 0x07, 0x1E, 0x01,
+  0xE7, 0x00, 0x39, 0xC0, 0x0E, 0xE0, 0x01, 0xC0, 0x07, 0x38, 0x01, 0xCE,
+  0x00, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00,
+  0x07, 0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1C, 0xE0, 0x07,
+  0x38, 0x03, 0xCF, 0x00, 0xE1, 0xC0, 0x38, 0x70, 0x1C, 0x0E, 0x07, 0x03,
+  0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x38, 0x07, 0x1E, 0x01, 0xE7, 0x00, 0x39,
+  0xC0, 0x0E, 0xE0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x73, 0x80,
+  0x18, 0x60, 0x06, 0x18, 0x01, 0xCE, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0x38, 0x01, 0xCE,
+  0x00, 0xE1, 0xC0, 0x38, 0x70, 0x0E, 0x1C, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0xFF, 0xFC, 0x3F, 0xFF, 0x0E, 0x01, 0xC7, 0x80, 0x39, 0xC0, 0x0E, 0x70,
+  0x03, 0xB8, 0x00, 0x70, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x7B,
+  0x80, 0x00, 0x39, 0xC0, 0x00, 0x3C, 0xE0, 0x00, 0x1C, 0x70, 0x00, 0x0E,
+  0x38, 0x00, 0x0F, 0x1C, 0x00, 0x07, 0x0F, 0xFF, 0x07, 0x87, 0xFF, 0x83,
+  0x83, 0x80, 0x01, 0xC1, 0xC0, 0x01, 0xC0, 0xE0, 0x00, 0xFF, 0xF0, 0x00,
+  0xFF, 0xF8, 0x00, 0x70, 0x1C, 0x00, 0x78, 0x0E, 0x00, 0x38, 0x07, 0x00,
+  0x1C, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xF8, 0x0F, 0xFE, 0x1E,
+  0x07, 0x38, 0x03, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x38, 0x03, 0x1E, 0x07, 0x0F, 0xFE, 0x03, 0xF8, 0x00,
+  0xC0, 0x00, 0x60, 0x00, 0x60, 0x03, 0xE0, 0x03, 0xC0, 0x1C, 0x00, 0x30,
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xE0, 0x07,
+  0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x7F, 0xFB, 0xFF, 0xDC, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x03, 0x80, 0x38, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x7F,
+  0xFB, 0xFF, 0xDC, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x78, 0x06, 0x60,
+  0x61, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xFF, 0xDF, 0xFE, 0xE0, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x39, 0xC1, 0xCE, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x7F,
+  0xFB, 0xFF, 0xDC, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0xE1, 0x86, 0x00, 0x1C, 0xE7,
+  0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x38, 0x3B,
+  0xB8, 0x00, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7,
+  0x39, 0xCE, 0x70, 0x1C, 0x1B, 0x18, 0xDC, 0x70, 0x00, 0x00, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0xEF, 0xDF, 0xB8,
+  0x00, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x1F, 0xF8, 0x01, 0xFF, 0xF0,
+  0x1C, 0x07, 0x81, 0xC0, 0x1C, 0x1C, 0x00, 0xE1, 0xC0, 0x0E, 0x1C, 0x00,
+  0x71, 0xC0, 0x07, 0x1C, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x71, 0xC0,
+  0x07, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x1C, 0x00, 0xE1, 0xC0, 0x0E, 0x1C,
+  0x01, 0xC1, 0xC0, 0x78, 0x1F, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0x30, 0x3F,
+  0xE0, 0x67, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xFE, 0x03, 0xFC, 0x07,
+  0xFC, 0x0F, 0xF8, 0x1F, 0xF8, 0x3F, 0x70, 0x7E, 0xF0, 0xFC, 0xF1, 0xF8,
+  0xE3, 0xF1, 0xE7, 0xE1, 0xCF, 0xC3, 0xDF, 0x83, 0xBF, 0x07, 0xFE, 0x07,
+  0xFC, 0x0F, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x1E, 0x07, 0x00, 0x00, 0x60,
+  0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0,
+  0x78, 0x78, 0x38, 0x07, 0x1C, 0x00, 0xE7, 0x00, 0x3B, 0x80, 0x07, 0xE0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00,
+  0x7E, 0x00, 0x1D, 0xC0, 0x0E, 0x70, 0x03, 0x8E, 0x01, 0xC1, 0xE1, 0xE0,
+  0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x78, 0x78, 0x38,
+  0x07, 0x1C, 0x00, 0xE7, 0x00, 0x3B, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00,
+  0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1D,
+  0xC0, 0x0E, 0x70, 0x03, 0x8E, 0x01, 0xC1, 0xE1, 0xE0, 0x3F, 0xF0, 0x03,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x33, 0x00, 0x18, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x1E, 0x1E, 0x0E, 0x01,
+  0xC7, 0x00, 0x39, 0xC0, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F,
+  0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0x70,
+  0x03, 0x9C, 0x00, 0xE3, 0x80, 0x70, 0x78, 0x78, 0x0F, 0xFC, 0x00, 0xFC,
+  0x00, 0x03, 0x98, 0x01, 0xFE, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x78, 0x78, 0x38, 0x07, 0x1C, 0x00, 0xE7,
+  0x00, 0x3B, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1D, 0xC0, 0x0E, 0x70, 0x03,
+  0x8E, 0x01, 0xC1, 0xE1, 0xE0, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x07, 0x38,
+  0x01, 0xCE, 0x00, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0xFF, 0xC0, 0x78, 0x78, 0x38, 0x07, 0x1C, 0x00, 0xE7, 0x00, 0x3B, 0x80,
+  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01,
+  0xF8, 0x00, 0x7E, 0x00, 0x1D, 0xC0, 0x0E, 0x70, 0x03, 0x8E, 0x01, 0xC1,
+  0xE1, 0xE0, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x40, 0x05, 0xC0, 0x1D, 0xC0,
+  0x71, 0xC1, 0xC1, 0xC7, 0x01, 0xDC, 0x01, 0xF0, 0x01, 0xC0, 0x07, 0xC0,
+  0x1D, 0xC0, 0x71, 0xC1, 0xC1, 0xC7, 0x01, 0xDC, 0x01, 0xD0, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xFC, 0x30, 0xFF, 0xD8, 0x78, 0x7C, 0x38, 0x07, 0x1C,
+  0x03, 0xE7, 0x00, 0xFB, 0x80, 0x67, 0xE0, 0x31, 0xF8, 0x18, 0x7E, 0x0E,
+  0x1F, 0x87, 0x07, 0xE1, 0x81, 0xF8, 0xC0, 0x7E, 0x60, 0x1D, 0xF0, 0x0E,
+  0x7C, 0x03, 0x8E, 0x01, 0xC3, 0xE1, 0xE1, 0xBF, 0xF0, 0xC3, 0xF0, 0x00,
+  0x00, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00,
+  0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7F, 0x01, 0xEE, 0x03, 0x9E, 0x0F, 0x1F, 0xFC, 0x0F,
+  0xE0, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E,
+  0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x00, 0x7F, 0x01, 0xEE, 0x03, 0x9E, 0x0F, 0x1F, 0xFC, 0x0F, 0xE0,
+  0x03, 0x80, 0x0D, 0x00, 0x1B, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F,
+  0x00, 0x7E, 0x00, 0xFE, 0x03, 0xDC, 0x07, 0x3C, 0x1E, 0x3F, 0xF8, 0x1F,
+  0xC0, 0x0E, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E,
+  0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x00, 0x7F, 0x01, 0xEE, 0x03, 0x9E, 0x0F, 0x1F, 0xFC, 0x0F, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
+  0x3D, 0xE0, 0x3C, 0x70, 0x1C, 0x3C, 0x1E, 0x0F, 0x1E, 0x03, 0x8E, 0x01,
+  0xEF, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xFF,
+  0x0F, 0xFE, 0x70, 0x7B, 0x81, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F,
+  0xC0, 0xFE, 0x0F, 0x7F, 0xF3, 0xFE, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x00, 0x1F, 0x03, 0xFE, 0x1C, 0x71, 0xC1, 0xCE, 0x0E, 0x70,
+  0xF3, 0x8E, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xC7, 0x0E, 0x1C,
+  0x70, 0x7B, 0x81, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF9, 0x1F, 0xCF, 0xEE,
+  0x3E, 0x00, 0x38, 0x01, 0xC0, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x7F, 0xC4, 0x1E, 0x00, 0xE0, 0x07, 0x00, 0x71, 0xFF, 0x7F,
+  0xFF, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFF, 0x1F, 0x7F, 0x73, 0xE7, 0x01,
+  0xC0, 0x38, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F,
+  0xC4, 0x1E, 0x00, 0xE0, 0x07, 0x00, 0x71, 0xFF, 0x7F, 0xFF, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0xFF, 0x1F, 0x7F, 0x73, 0xE7, 0x06, 0x00, 0xF0, 0x09,
+  0x01, 0x98, 0x30, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xC4, 0x1E, 0x00,
+  0xE0, 0x07, 0x00, 0x71, 0xFF, 0x7F, 0xFF, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0xFF, 0x1F, 0x7F, 0x73, 0xE7, 0x1C, 0xC3, 0xCC, 0x33, 0xC3, 0x38, 0x00,
+  0x00, 0x00, 0x3F, 0x87, 0xFC, 0x41, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x1F,
+  0xF7, 0xFF, 0xF0, 0x7E, 0x07, 0xE0, 0x7E, 0x0F, 0xF1, 0xF7, 0xF7, 0x3E,
+  0x70, 0x39, 0xC3, 0x9C, 0x39, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xC4,
+  0x1E, 0x00, 0xE0, 0x07, 0x00, 0x71, 0xFF, 0x7F, 0xFF, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0xFF, 0x1F, 0x7F, 0x73, 0xE7, 0x07, 0x00, 0xF8, 0x18, 0xC1,
+  0x8C, 0x18, 0xC0, 0xF8, 0x07, 0x00, 0x00, 0x3F, 0x87, 0xFC, 0x41, 0xE0,
+  0x0E, 0x00, 0x70, 0x07, 0x1F, 0xF7, 0xFF, 0xF0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x0F, 0xF1, 0xF7, 0xF7, 0x3E, 0x70, 0x3F, 0x87, 0xE1, 0xFF, 0x7F, 0xC4,
+  0x1F, 0xC7, 0x80, 0x3E, 0x0E, 0x00, 0x70, 0x1C, 0x01, 0xC0, 0x71, 0xFF,
+  0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x70, 0x03, 0x81, 0xC0, 0x0E, 0x07, 0x80,
+  0x38, 0x3E, 0x00, 0xF1, 0xDC, 0x09, 0xFE, 0x7F, 0xE3, 0xF0, 0x7F, 0x00,
+  0x0F, 0xE1, 0xFF, 0x3C, 0x17, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x0E, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x11, 0xFF, 0x0F, 0xE0, 0x30,
+  0x01, 0x80, 0x18, 0x0F, 0x80, 0xF0, 0x1C, 0x00, 0x38, 0x00, 0x60, 0x00,
+  0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xF0, 0xE1, 0xE7,
+  0x03, 0xB8, 0x07, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x03,
+  0xC0, 0x07, 0x00, 0x0F, 0x02, 0x1F, 0xF8, 0x3F, 0x80, 0x00, 0xE0, 0x07,
+  0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F,
+  0xF0, 0xE1, 0xE7, 0x03, 0xB8, 0x07, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0F, 0x02, 0x1F, 0xF8, 0x3F, 0x80,
+  0x03, 0x00, 0x1E, 0x00, 0x68, 0x03, 0x30, 0x18, 0x60, 0x00, 0x00, 0x00,
+  0x03, 0xF0, 0x1F, 0xF0, 0xE1, 0xE7, 0x03, 0xB8, 0x07, 0xE0, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0F, 0x02, 0x1F,
+  0xF8, 0x3F, 0x80, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x01, 0xFF, 0x0E, 0x1E, 0x70, 0x3B, 0x80, 0x7E, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xF0, 0x21, 0xFF,
+  0x83, 0xF8, 0xE1, 0xC3, 0x06, 0x0C, 0x00, 0x0E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE0, 0x1C, 0xE3, 0x18, 0xC0, 0x00,
+  0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x80,
+  0x1C, 0x1F, 0x0D, 0x8C, 0x6C, 0x18, 0x00, 0x00, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0xEF, 0xDF, 0xB8, 0x00, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC0, 0x1C, 0x00, 0x38, 0xC0, 0x7E,
+  0x01, 0xC0, 0x3F, 0x80, 0x86, 0x00, 0x0C, 0x03, 0xF8, 0x3F, 0xF1, 0xE0,
+  0xE7, 0x03, 0xB8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x1D, 0xC0, 0xE7, 0x87, 0x8F, 0xFC, 0x0F, 0xC0, 0x1C, 0x63, 0xE6, 0x33,
+  0xE3, 0x1C, 0x00, 0x00, 0x00, 0xE7, 0xCE, 0xFE, 0xF8, 0xEF, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0x7E, 0x07, 0xE0, 0x70, 0x1C, 0x00, 0x38, 0x00, 0x60, 0x00, 0xC0, 0x01,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xF1, 0xE1, 0xE7, 0x03, 0xBC,
+  0x0F, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7,
+  0x03, 0x9E, 0x1E, 0x3F, 0xF0, 0x3F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x18,
+  0x00, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xF1, 0xE1,
+  0xE7, 0x03, 0xBC, 0x0F, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x1F, 0xC0, 0xF7, 0x03, 0x9E, 0x1E, 0x3F, 0xF0, 0x3F, 0x00, 0x03, 0x00,
+  0x1E, 0x00, 0x48, 0x03, 0x30, 0x18, 0x60, 0x00, 0x00, 0x00, 0x03, 0xF0,
+  0x3F, 0xF1, 0xE1, 0xE7, 0x03, 0xBC, 0x0F, 0xE0, 0x1F, 0x80, 0x7E, 0x01,
+  0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7, 0x03, 0x9E, 0x1E, 0x3F, 0xF0, 0x3F,
+  0x00, 0x0E, 0x60, 0x79, 0x81, 0x9E, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x0F, 0xFC, 0x78, 0x79, 0xC0, 0xEF, 0x03, 0xF8, 0x07, 0xE0, 0x1F,
+  0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0, 0x3D, 0xC0, 0xE7, 0x87, 0x8F, 0xFC,
+  0x0F, 0xC0, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x03, 0xFF, 0x1E, 0x1E, 0x70, 0x3B, 0xC0, 0xFE, 0x01, 0xF8, 0x07, 0xE0,
+  0x1F, 0x80, 0x7E, 0x01, 0xFC, 0x0F, 0x70, 0x39, 0xE1, 0xE3, 0xFF, 0x03,
+  0xF0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x38, 0x00, 0x00, 0x02, 0x07, 0xE6, 0x1F, 0xFC, 0x3C, 0x38, 0x38,
+  0x3C, 0x78, 0x6C, 0x70, 0x6E, 0x70, 0xCE, 0x71, 0x8E, 0x73, 0x0E, 0x76,
+  0x0E, 0x76, 0x1E, 0x3C, 0x1C, 0x1C, 0x3C, 0x3F, 0xF8, 0x67, 0xE0, 0x40,
+  0x00, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x00, 0x00, 0x0E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xF7, 0x1F, 0x7F, 0x73, 0xE7, 0x00, 0xE0,
+  0x1C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0xF7, 0x1F, 0x7F, 0x73, 0xE7, 0x06, 0x00, 0xF0, 0x09, 0x01,
+  0x98, 0x30, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xF7,
+  0x1F, 0x7F, 0x73, 0xE7, 0x39, 0xC3, 0x9C, 0x39, 0xC0, 0x00, 0x00, 0x0E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xF7, 0x1F, 0x7F, 0x73, 0xE7, 0x00, 0xE0,
+  0x07, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07,
+  0x70, 0x39, 0xC0, 0xE7, 0x87, 0x8E, 0x1C, 0x38, 0x70, 0xF3, 0xC1, 0xCE,
+  0x07, 0x78, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x1C,
+  0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0x78, 0x07, 0xC0, 0x1E, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x9F, 0x1D, 0xFC,
+  0xF8, 0xF7, 0x83, 0xB8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC,
+  0x07, 0xE0, 0x3F, 0x83, 0xBE, 0x3D, 0xDF, 0xCE, 0x7C, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0x1C, 0xE0, 0x73, 0x81, 0xCE,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x77, 0x03, 0x9C, 0x0E, 0x78, 0x78, 0xE1,
+  0xC3, 0x87, 0x0F, 0x3C, 0x1C, 0xE0, 0x77, 0x80, 0xFC, 0x03, 0xF0, 0x0F,
+  0xC0, 0x1E, 0x00, 0x78, 0x01, 0xC0, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x07,
+  0x80, 0x7C, 0x01, 0xE0, 0x00 };
+
+const GFXglyph DejaVuSans14pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
+  {     1,   3,  20,  11,    4,  -19 },   // 0x21 '!'
+  {     9,   7,   7,  12,    3,  -19 },   // 0x22 '"'
+  {    16,  18,  18,  23,    2,  -17 },   // 0x23 '#'
+  {    57,  13,  24,  17,    2,  -19 },   // 0x24 '$'
+  {    96,  23,  20,  26,    1,  -19 },   // 0x25 '%'
+  {   154,  19,  20,  21,    2,  -19 },   // 0x26 '&'
+  {   202,   2,   7,   7,    3,  -19 },   // 0x27 '''
+  {   204,   6,  24,  11,    2,  -20 },   // 0x28 '('
+  {   222,   6,  24,  11,    2,  -20 },   // 0x29 ')'
+  {   240,  12,  12,  14,    1,  -19 },   // 0x2A '*'
+  {   258,  16,  16,  23,    3,  -15 },   // 0x2B '+'
+  {   290,   4,   6,   9,    2,   -2 },   // 0x2C ','
+  {   293,   7,   2,  10,    1,   -7 },   // 0x2D '-'
+  {   295,   3,   3,   9,    3,   -2 },   // 0x2E '.'
+  {   297,   9,  22,   9,    0,  -19 },   // 0x2F '/'
+  {   322,  14,  20,  17,    2,  -19 },   // 0x30 '0'
+  {   357,  12,  20,  17,    3,  -19 },   // 0x31 '1'
+  {   387,  12,  20,  17,    2,  -19 },   // 0x32 '2'
+  {   417,  13,  20,  17,    2,  -19 },   // 0x33 '3'
+  {   450,  15,  20,  17,    1,  -19 },   // 0x34 '4'
+  {   488,  13,  20,  17,    2,  -19 },   // 0x35 '5'
+  {   521,  14,  20,  17,    2,  -19 },   // 0x36 '6'
+  {   556,  13,  20,  17,    2,  -19 },   // 0x37 '7'
+  {   589,  14,  20,  17,    2,  -19 },   // 0x38 '8'
+  {   624,  14,  20,  17,    2,  -19 },   // 0x39 '9'
+  {   659,   3,  14,   9,    3,  -13 },   // 0x3A ':'
+  {   665,   4,  17,   9,    2,  -13 },   // 0x3B ';'
+  {   674,  17,  14,  23,    3,  -15 },   // 0x3C '<'
+  {   704,  17,   7,  23,    3,  -11 },   // 0x3D '='
+  {   719,  17,  14,  23,    3,  -15 },   // 0x3E '>'
+  {   749,  11,  20,  14,    2,  -19 },   // 0x3F '?'
+  {   777,  24,  24,  27,    2,  -18 },   // 0x40 '@'
+  {   849,  18,  20,  18,    0,  -19 },   // 0x41 'A'
+  {   894,  14,  20,  19,    3,  -19 },   // 0x42 'B'
+  {   929,  16,  20,  19,    2,  -19 },   // 0x43 'C'
+  {   969,  17,  20,  21,    3,  -19 },   // 0x44 'D'
+  {  1012,  13,  20,  17,    3,  -19 },   // 0x45 'E'
+  {  1045,  11,  20,  16,    3,  -19 },   // 0x46 'F'
+  {  1073,  17,  20,  21,    2,  -19 },   // 0x47 'G'
+  {  1116,  15,  20,  20,    3,  -19 },   // 0x48 'H'
+  {  1154,   3,  20,   8,    3,  -19 },   // 0x49 'I'
+  {  1162,   7,  25,   8,   -1,  -19 },   // 0x4A 'J'
+  {  1184,  16,  20,  18,    3,  -19 },   // 0x4B 'K'
+  {  1224,  12,  20,  15,    3,  -19 },   // 0x4C 'L'
+  {  1254,  18,  20,  23,    3,  -19 },   // 0x4D 'M'
+  {  1299,  15,  20,  20,    3,  -19 },   // 0x4E 'N'
+  {  1337,  18,  20,  21,    2,  -19 },   // 0x4F 'O'
+  {  1382,  13,  20,  16,    3,  -19 },   // 0x50 'P'
+  {  1415,  18,  23,  21,    2,  -19 },   // 0x51 'Q'
+  {  1467,  16,  20,  19,    3,  -19 },   // 0x52 'R'
+  {  1507,  14,  20,  17,    2,  -19 },   // 0x53 'S'
+  {  1542,  17,  20,  17,    0,  -19 },   // 0x54 'T'
+  {  1585,  15,  20,  20,    3,  -19 },   // 0x55 'U'
+  {  1623,  18,  20,  18,    0,  -19 },   // 0x56 'V'
+  {  1668,  25,  20,  27,    1,  -19 },   // 0x57 'W'
+  {  1731,  17,  20,  19,    1,  -19 },   // 0x58 'X'
+  {  1774,  17,  20,  17,    0,  -19 },   // 0x59 'Y'
+  {  1817,  16,  20,  19,    1,  -19 },   // 0x5A 'Z'
+  {  1857,   6,  24,  11,    2,  -20 },   // 0x5B '['
+  {  1875,   9,  22,   9,    0,  -19 },   // 0x5C '\'
+  {  1900,   6,  24,  11,    3,  -20 },   // 0x5D ']'
+  {  1918,  17,   7,  23,    3,  -19 },   // 0x5E '^'
+  {  1933,  14,   2,  14,    0,    5 },   // 0x5F '_'
+  {  1937,   6,   5,  14,    3,  -21 },   // 0x60 '`'
+  {  1941,  12,  15,  17,    2,  -14 },   // 0x61 'a'
+  {  1964,  13,  21,  17,    2,  -20 },   // 0x62 'b'
+  {  1999,  12,  15,  15,    2,  -14 },   // 0x63 'c'
+  {  2022,  13,  21,  17,    2,  -20 },   // 0x64 'd'
+  {  2057,  14,  15,  17,    2,  -14 },   // 0x65 'e'
+  {  2084,  10,  21,  10,    1,  -20 },   // 0x66 'f'
+  {  2111,  13,  21,  17,    2,  -14 },   // 0x67 'g'
+  {  2146,  12,  21,  17,    2,  -20 },   // 0x68 'h'
+  {  2178,   3,  21,   8,    2,  -20 },   // 0x69 'i'
+  {  2186,   6,  27,   8,   -1,  -20 },   // 0x6A 'j'
+  {  2207,  13,  21,  16,    2,  -20 },   // 0x6B 'k'
+  {  2242,   3,  21,   8,    2,  -20 },   // 0x6C 'l'
+  {  2250,  21,  15,  26,    2,  -14 },   // 0x6D 'm'
+  {  2290,  12,  15,  17,    2,  -14 },   // 0x6E 'n'
+  {  2313,  14,  15,  17,    2,  -14 },   // 0x6F 'o'
+  {  2340,  13,  21,  17,    2,  -14 },   // 0x70 'p'
+  {  2375,  13,  21,  17,    2,  -14 },   // 0x71 'q'
+  {  2410,   9,  15,  11,    2,  -14 },   // 0x72 'r'
+  {  2427,  11,  15,  14,    2,  -14 },   // 0x73 's'
+  {  2448,  10,  19,  11,    0,  -18 },   // 0x74 't'
+  {  2472,  12,  15,  17,    2,  -14 },   // 0x75 'u'
+  {  2495,  14,  15,  16,    1,  -14 },   // 0x76 'v'
+  {  2522,  20,  15,  22,    1,  -14 },   // 0x77 'w'
+  {  2560,  14,  15,  16,    1,  -14 },   // 0x78 'x'
+  {  2587,  14,  21,  16,    1,  -14 },   // 0x79 'y'
+  {  2624,  12,  15,  14,    1,  -14 },   // 0x7A 'z'
+  {  2647,  11,  25,  17,    3,  -20 },   // 0x7B '{'
+  {  2682,   2,  27,   9,    3,  -20 },   // 0x7C '|'
+  {  2689,  11,  25,  17,    3,  -20 },   // 0x7D '}'
+  {  2724,  17,   4,  23,    3,   -9 },   // 0x7E '~'
+  {  2733,  14,  24,  16,    1,  -18 },   // 0x7F
+  {  2775,  14,  24,  16,    1,  -18 },   // 0x80
+  {  2817,  14,  24,  16,    1,  -18 },   // 0x81
+  {  2859,  14,  24,  16,    1,  -18 },   // 0x82
+  {  2901,  14,  24,  16,    1,  -18 },   // 0x83
+  {  2943,  14,  24,  16,    1,  -18 },   // 0x84
+  {  2985,  14,  24,  16,    1,  -18 },   // 0x85
+  {  3027,  14,  24,  16,    1,  -18 },   // 0x86
+  {  3069,  14,  24,  16,    1,  -18 },   // 0x87
+  {  3111,  14,  24,  16,    1,  -18 },   // 0x88
+  {  3153,  14,  24,  16,    1,  -18 },   // 0x89
+  {  3195,  14,  24,  16,    1,  -18 },   // 0x8A
+  {  3237,  14,  24,  16,    1,  -18 },   // 0x8B
+  {  3279,  14,  24,  16,    1,  -18 },   // 0x8C
+  {  3321,  14,  24,  16,    1,  -18 },   // 0x8D
+  {  3363,  14,  24,  16,    1,  -18 },   // 0x8E
+  {  3405,  14,  24,  16,    1,  -18 },   // 0x8F
+  {  3447,  14,  24,  16,    1,  -18 },   // 0x90
+  {  3489,  14,  24,  16,    1,  -18 },   // 0x91
+  {  3531,  14,  24,  16,    1,  -18 },   // 0x92
+  {  3573,  14,  24,  16,    1,  -18 },   // 0x93
+  {  3615,  14,  24,  16,    1,  -18 },   // 0x94
+  {  3657,  14,  24,  16,    1,  -18 },   // 0x95
+  {  3699,  14,  24,  16,    1,  -18 },   // 0x96
+  {  3741,  14,  24,  16,    1,  -18 },   // 0x97
+  {  3783,  14,  24,  16,    1,  -18 },   // 0x98
+  {  3825,  14,  24,  16,    1,  -18 },   // 0x99
+  {  3867,  14,  24,  16,    1,  -18 },   // 0x9A
+  {  3909,  14,  24,  16,    1,  -18 },   // 0x9B
+  {  3951,  14,  24,  16,    1,  -18 },   // 0x9C
+  {  3993,  14,  24,  16,    1,  -18 },   // 0x9D
+  {  4035,  14,  24,  16,    1,  -18 },   // 0x9E
+  {  4077,  14,  24,  16,    1,  -18 },   // 0x9F
+  {  4119,   1,   1,   9,    0,    0 },   // 0xA0
+  {  4120,   3,  20,  11,    4,  -14 },   // 0xA1
+  {  4128,  12,  23,  17,    2,  -18 },   // 0xA2
+  {  4163,  13,  20,  17,    2,  -19 },   // 0xA3
+  {  4196,  15,  15,  17,    1,  -15 },   // 0xA4
+  {  4225,  15,  20,  17,    1,  -19 },   // 0xA5
+  {  4263,   2,  24,   9,    3,  -18 },   // 0xA6
+  {  4269,  11,  23,  14,    1,  -19 },   // 0xA7
+  {  4301,   8,   3,  14,    3,  -19 },   // 0xA8
+  {  4304,  20,  20,  27,    4,  -19 },   // 0xA9
+  {  4354,  10,  13,  13,    2,  -19 },   // 0xAA
+  {  4371,  12,  12,  17,    2,  -13 },   // 0xAB
+  {  4389,  17,   8,  23,    3,  -10 },   // 0xAC
+  {  4406,   7,   2,  10,    1,   -7 },   // 0xAD
+  {  4408,  20,  20,  27,    4,  -19 },   // 0xAE
+  {  4458,   8,   2,  14,    3,  -19 },   // 0xAF
+  {  4460,   8,   8,  14,    3,  -19 },   // 0xB0
+  {  4468,  16,  17,  23,    3,  -16 },   // 0xB1
+  {  4502,   8,  11,  11,    1,  -19 },   // 0xB2
+  {  4513,   8,  11,  11,    1,  -19 },   // 0xB3
+  {  4524,   6,   5,  14,    5,  -21 },   // 0xB4
+  {  4528,  14,  21,  17,    2,  -14 },   // 0xB5
+  {  4565,  12,  23,  17,    2,  -19 },   // 0xB6
+  {  4600,   3,   3,   9,    3,  -10 },   // 0xB7
+  {  4602,   5,   5,  14,    4,    1 },   // 0xB8
+  {  4606,   8,  11,  11,    2,  -19 },   // 0xB9
+  {  4617,  10,  13,  13,    1,  -19 },   // 0xBA
+  {  4634,  12,  12,  17,    3,  -13 },   // 0xBB
+  {  4652,  23,  20,  26,    2,  -19 },   // 0xBC
+  {  4710,  22,  20,  26,    2,  -19 },   // 0xBD
+  {  4765,  24,  20,  26,    1,  -19 },   // 0xBE
+  {  4825,  11,  21,  14,    2,  -14 },   // 0xBF
+  {  4854,  18,  25,  18,    0,  -24 },   // 0xC0
+  {  4911,  18,  25,  18,    0,  -24 },   // 0xC1
+  {  4968,  18,  26,  18,    0,  -25 },   // 0xC2
+  {  5027,  18,  25,  18,    0,  -24 },   // 0xC3
+  {  5084,  18,  25,  18,    0,  -24 },   // 0xC4
+  {  5141,  18,  26,  18,    0,  -25 },   // 0xC5
+  {  5200,  25,  20,  26,    0,  -19 },   // 0xC6
+  {  5263,  16,  25,  19,    2,  -19 },   // 0xC7
+  {  5313,  13,  25,  17,    3,  -24 },   // 0xC8
+  {  5354,  13,  25,  17,    3,  -24 },   // 0xC9
+  {  5395,  13,  26,  17,    3,  -25 },   // 0xCA
+  {  5438,  13,  25,  17,    3,  -24 },   // 0xCB
+  {  5479,   5,  25,   8,    1,  -24 },   // 0xCC
+  {  5495,   5,  25,   8,    2,  -24 },   // 0xCD
+  {  5511,   9,  26,   8,    0,  -25 },   // 0xCE
+  {  5541,   7,  25,   8,    1,  -24 },   // 0xCF
+  {  5563,  20,  20,  21,    0,  -19 },   // 0xD0
+  {  5613,  15,  25,  20,    3,  -24 },   // 0xD1
+  {  5660,  18,  25,  21,    2,  -24 },   // 0xD2
+  {  5717,  18,  25,  21,    2,  -24 },   // 0xD3
+  {  5774,  18,  26,  21,    2,  -25 },   // 0xD4
+  {  5833,  18,  25,  21,    2,  -24 },   // 0xD5
+  {  5890,  18,  25,  21,    2,  -24 },   // 0xD6
+  {  5947,  15,  15,  23,    4,  -15 },   // 0xD7
+  {  5976,  18,  22,  21,    2,  -20 },   // 0xD8
+  {  6026,  15,  25,  20,    3,  -24 },   // 0xD9
+  {  6073,  15,  25,  20,    3,  -24 },   // 0xDA
+  {  6120,  15,  26,  20,    3,  -25 },   // 0xDB
+  {  6169,  15,  25,  20,    3,  -24 },   // 0xDC
+  {  6216,  17,  25,  17,    0,  -24 },   // 0xDD
+  {  6270,  13,  20,  16,    3,  -19 },   // 0xDE
+  {  6303,  13,  21,  17,    2,  -20 },   // 0xDF
+  {  6338,  12,  22,  17,    2,  -21 },   // 0xE0
+  {  6371,  12,  22,  17,    2,  -21 },   // 0xE1
+  {  6404,  12,  22,  17,    2,  -21 },   // 0xE2
+  {  6437,  12,  21,  17,    2,  -20 },   // 0xE3
+  {  6469,  12,  20,  17,    2,  -19 },   // 0xE4
+  {  6499,  12,  23,  17,    2,  -22 },   // 0xE5
+  {  6534,  22,  15,  27,    2,  -14 },   // 0xE6
+  {  6576,  12,  20,  15,    2,  -14 },   // 0xE7
+  {  6606,  14,  22,  17,    2,  -21 },   // 0xE8
+  {  6645,  14,  22,  17,    2,  -21 },   // 0xE9
+  {  6684,  14,  22,  17,    2,  -21 },   // 0xEA
+  {  6723,  14,  20,  17,    2,  -19 },   // 0xEB
+  {  6758,   6,  22,   8,    0,  -21 },   // 0xEC
+  {  6775,   6,  22,   8,    2,  -21 },   // 0xED
+  {  6792,   9,  22,   8,   -1,  -21 },   // 0xEE
+  {  6817,   7,  20,   8,    0,  -19 },   // 0xEF
+  {  6835,  14,  21,  17,    2,  -20 },   // 0xF0
+  {  6872,  12,  21,  17,    2,  -20 },   // 0xF1
+  {  6904,  14,  22,  17,    2,  -21 },   // 0xF2
+  {  6943,  14,  22,  17,    2,  -21 },   // 0xF3
+  {  6982,  14,  22,  17,    2,  -21 },   // 0xF4
+  {  7021,  14,  21,  17,    2,  -20 },   // 0xF5
+  {  7058,  14,  20,  17,    2,  -19 },   // 0xF6
+  {  7093,  17,  12,  23,    3,  -13 },   // 0xF7
+  {  7119,  16,  17,  17,    1,  -15 },   // 0xF8
+  {  7153,  12,  22,  17,    2,  -21 },   // 0xF9
+  {  7186,  12,  22,  17,    2,  -21 },   // 0xFA
+  {  7219,  12,  22,  17,    2,  -21 },   // 0xFB
+  {  7252,  12,  20,  17,    2,  -19 },   // 0xFC
+  {  7282,  14,  28,  16,    1,  -21 },   // 0xFD
+  {  7331,  13,  27,  17,    2,  -20 },   // 0xFE
+  {  7375,  14,  26,  16,    1,  -19 } }; // 0xFF
+
+const GFXfont DejaVuSans14pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans14pt8bBitmaps,
+  (GFXglyph *)DejaVuSans14pt8bGlyphs,
+  0x20, 0xFF, 32 };
+
+// Approx. 8996 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans14pt8bMetrics[] PROGMEM = {
+  {   0,   9,   1 },   // 0x20
+  {   4,  11,   7 },   // 0x21
+  {   3,  12,  10 },   // 0x22
+  {   2,  23,  20 },   // 0x23
+  {   2,  17,  15 },   // 0x24
+  {   1,  26,  24 },   // 0x25
+  {   2,  21,  21 },   // 0x26
+  {   3,   7,   5 },   // 0x27
+  {   2,  11,   8 },   // 0x28
+  {   2,  11,   8 },   // 0x29
+  {   1,  14,  13 },   // 0x2A
+  {   3,  23,  19 },   // 0x2B
+  {   2,   9,   6 },   // 0x2C
+  {   1,  10,   8 },   // 0x2D
+  {   3,   9,   6 },   // 0x2E
+  {   0,   9,   9 },   // 0x2F
+  {   2,  17,  16 },   // 0x30
+  {   3,  17,  15 },   // 0x31
+  {   2,  17,  14 },   // 0x32
+  {   2,  17,  15 },   // 0x33
+  {   1,  17,  16 },   // 0x34
+  {   2,  17,  15 },   // 0x35
+  {   2,  17,  16 },   // 0x36
+  {   2,  17,  15 },   // 0x37
+  {   2,  17,  16 },   // 0x38
+  {   2,  17,  16 },   // 0x39
+  {   3,   9,   6 },   // 0x3A
+  {   2,   9,   6 },   // 0x3B
+  {   3,  23,  20 },   // 0x3C
+  {   3,  23,  20 },   // 0x3D
+  {   3,  23,  20 },   // 0x3E
+  {   2,  14,  13 },   // 0x3F
+  {   2,  27,  26 },   // 0x40
+  {   0,  18,  18 },   // 0x41
+  {   3,  19,  17 },   // 0x42
+  {   2,  19,  18 },   // 0x43
+  {   3,  21,  20 },   // 0x44
+  {   3,  17,  16 },   // 0x45
+  {   3,  16,  14 },   // 0x46
+  {   2,  21,  19 },   // 0x47
+  {   3,  20,  18 },   // 0x48
+  {   3,   8,   6 },   // 0x49
+  {  -1,   8,   6 },   // 0x4A
+  {   3,  18,  19 },   // 0x4B
+  {   3,  15,  15 },   // 0x4C
+  {   3,  23,  21 },   // 0x4D
+  {   3,  20,  18 },   // 0x4E
+  {   2,  21,  20 },   // 0x4F
+  {   3,  16,  16 },   // 0x50
+  {   2,  21,  20 },   // 0x51
+  {   3,  19,  19 },   // 0x52
+  {   2,  17,  16 },   // 0x53
+  {   0,  17,  17 },   // 0x54
+  {   3,  20,  18 },   // 0x55
+  {   0,  18,  18 },   // 0x56
+  {   1,  27,  26 },   // 0x57
+  {   1,  19,  18 },   // 0x58
+  {   0,  17,  17 },   // 0x59
+  {   1,  19,  17 },   // 0x5A
+  {   2,  11,   8 },   // 0x5B
+  {   0,   9,   9 },   // 0x5C
+  {   3,  11,   9 },   // 0x5D
+  {   3,  23,  20 },   // 0x5E
+  {   0,  14,  14 },   // 0x5F
+  {   3,  14,   9 },   // 0x60
+  {   2,  17,  14 },   // 0x61
+  {   2,  17,  15 },   // 0x62
+  {   2,  15,  14 },   // 0x63
+  {   2,  17,  15 },   // 0x64
+  {   2,  17,  16 },   // 0x65
+  {   1,  10,  11 },   // 0x66
+  {   2,  17,  15 },   // 0x67
+  {   2,  17,  14 },   // 0x68
+  {   2,   8,   5 },   // 0x69
+  {  -1,   8,   5 },   // 0x6A
+  {   2,  16,  15 },   // 0x6B
+  {   2,   8,   5 },   // 0x6C
+  {   2,  26,  23 },   // 0x6D
+  {   2,  17,  14 },   // 0x6E
+  {   2,  17,  16 },   // 0x6F
+  {   2,  17,  15 },   // 0x70
+  {   2,  17,  15 },   // 0x71
+  {   2,  11,  11 },   // 0x72
+  {   2,  14,  13 },   // 0x73
+  {   0,  11,  10 },   // 0x74
+  {   2,  17,  14 },   // 0x75
+  {   1,  16,  15 },   // 0x76
+  {   1,  22,  21 },   // 0x77
+  {   1,  16,  15 },   // 0x78
+  {   1,  16,  15 },   // 0x79
+  {   1,  14,  13 },   // 0x7A
+  {   3,  17,  14 },   // 0x7B
+  {   3,   9,   5 },   // 0x7C
+  {   3,  17,  14 },   // 0x7D
+  {   3,  23,  20 },   // 0x7E
+  {   1,  16,  15 },   // 0x7F
+  {   1,  16,  15 },   // 0x80
+  {   1,  16,  15 },   // 0x81
+  {   1,  16,  15 },   // 0x82
+  {   1,  16,  15 },   // 0x83
+  {   1,  16,  15 },   // 0x84
+  {   1,  16,  15 },   // 0x85
+  {   1,  16,  15 },   // 0x86
+  {   1,  16,  15 },   // 0x87
+  {   1,  16,  15 },   // 0x88
+  {   1,  16,  15 },   // 0x89
+  {   1,  16,  15 },   // 0x8A
+  {   1,  16,  15 },   // 0x8B
+  {   1,  16,  15 },   // 0x8C
+  {   1,  16,  15 },   // 0x8D
+  {   1,  16,  15 },   // 0x8E
+  {   1,  16,  15 },   // 0x8F
+  {   1,  16,  15 },   // 0x90
+  {   1,  16,  15 },   // 0x91
+  {   1,  16,  15 },   // 0x92
+  {   1,  16,  15 },   // 0x93
+  {   1,  16,  15 },   // 0x94
+  {   1,  16,  15 },   // 0x95
+  {   1,  16,  15 },   // 0x96
+  {   1,  16,  15 },   // 0x97
+  {   1,  16,  15 },   // 0x98
+  {   1,  16,  15 },   // 0x99
+  {   1,  16,  15 },   // 0x9A
+  {   1,  16,  15 },   // 0x9B
+  {   1,  16,  15 },   // 0x9C
+  {   1,  16,  15 },   // 0x9D
+  {   1,  16,  15 },   // 0x9E
+  {   1,  16,  15 },   // 0x9F
+  {   0,   9,   1 },   // 0xA0
+  {   4,  11,   7 },   // 0xA1
+  {   2,  17,  14 },   // 0xA2
+  {   2,  17,  15 },   // 0xA3
+  {   1,  17,  16 },   // 0xA4
+  {   1,  17,  16 },   // 0xA5
+  {   3,   9,   5 },   // 0xA6
+  {   1,  14,  12 },   // 0xA7
+  {   3,  14,  11 },   // 0xA8
+  {   4,  27,  24 },   // 0xA9
+  {   2,  13,  12 },   // 0xAA
+  {   2,  17,  14 },   // 0xAB
+  {   3,  23,  20 },   // 0xAC
+  {   1,  10,   8 },   // 0xAD
+  {   4,  27,  24 },   // 0xAE
+  {   3,  14,  11 },   // 0xAF
+  {   3,  14,  11 },   // 0xB0
+  {   3,  23,  19 },   // 0xB1
+  {   1,  11,   9 },   // 0xB2
+  {   1,  11,   9 },   // 0xB3
+  {   5,  14,  11 },   // 0xB4
+  {   2,  17,  16 },   // 0xB5
+  {   2,  17,  14 },   // 0xB6
+  {   3,   9,   6 },   // 0xB7
+  {   4,  14,   9 },   // 0xB8
+  {   2,  11,  10 },   // 0xB9
+  {   1,  13,  11 },   // 0xBA
+  {   3,  17,  15 },   // 0xBB
+  {   2,  26,  25 },   // 0xBC
+  {   2,  26,  24 },   // 0xBD
+  {   1,  26,  25 },   // 0xBE
+  {   2,  14,  13 },   // 0xBF
+  {   0,  18,  18 },   // 0xC0
+  {   0,  18,  18 },   // 0xC1
+  {   0,  18,  18 },   // 0xC2
+  {   0,  18,  18 },   // 0xC3
+  {   0,  18,  18 },   // 0xC4
+  {   0,  18,  18 },   // 0xC5
+  {   0,  26,  25 },   // 0xC6
+  {   2,  19,  18 },   // 0xC7
+  {   3,  17,  16 },   // 0xC8
+  {   3,  17,  16 },   // 0xC9
+  {   3,  17,  16 },   // 0xCA
+  {   3,  17,  16 },   // 0xCB
+  {   1,   8,   6 },   // 0xCC
+  {   2,   8,   7 },   // 0xCD
+  {   0,   8,   9 },   // 0xCE
+  {   1,   8,   8 },   // 0xCF
+  {   0,  21,  20 },   // 0xD0
+  {   3,  20,  18 },   // 0xD1
+  {   2,  21,  20 },   // 0xD2
+  {   2,  21,  20 },   // 0xD3
+  {   2,  21,  20 },   // 0xD4
+  {   2,  21,  20 },   // 0xD5
+  {   2,  21,  20 },   // 0xD6
+  {   4,  23,  19 },   // 0xD7
+  {   2,  21,  20 },   // 0xD8
+  {   3,  20,  18 },   // 0xD9
+  {   3,  20,  18 },   // 0xDA
+  {   3,  20,  18 },   // 0xDB
+  {   3,  20,  18 },   // 0xDC
+  {   0,  17,  17 },   // 0xDD
+  {   3,  16,  16 },   // 0xDE
+  {   2,  17,  15 },   // 0xDF
+  {   2,  17,  14 },   // 0xE0
+  {   2,  17,  14 },   // 0xE1
+  {   2,  17,  14 },   // 0xE2
+  {   2,  17,  14 },   // 0xE3
+  {   2,  17,  14 },   // 0xE4
+  {   2,  17,  14 },   // 0xE5
+  {   2,  27,  24 },   // 0xE6
+  {   2,  15,  14 },   // 0xE7
+  {   2,  17,  16 },   // 0xE8
+  {   2,  17,  16 },   // 0xE9
+  {   2,  17,  16 },   // 0xEA
+  {   2,  17,  16 },   // 0xEB
+  {   0,   8,   6 },   // 0xEC
+  {   2,   8,   8 },   // 0xED
+  {  -1,   8,   8 },   // 0xEE
+  {   0,   8,   7 },   // 0xEF
+  {   2,  17,  16 },   // 0xF0
+  {   2,  17,  14 },   // 0xF1
+  {   2,  17,  16 },   // 0xF2
+  {   2,  17,  16 },   // 0xF3
+  {   2,  17,  16 },   // 0xF4
+  {   2,  17,  16 },   // 0xF5
+  {   2,  17,  16 },   // 0xF6
+  {   3,  23,  20 },   // 0xF7
+  {   1,  17,  17 },   // 0xF8
+  {   2,  17,  14 },   // 0xF9
+  {   2,  17,  14 },   // 0xFA
+  {   2,  17,  14 },   // 0xFB
+  {   2,  17,  14 },   // 0xFC
+  {   1,  16,  15 },   // 0xFD
+  {   2,  17,  15 },   // 0xFE
+  {   1,  16,  15 }    // 0xFF
+};
+const FontMetrics DejaVuSans14pt8bWidths = { DejaVuSans14pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS14PTLAT1__H
@@ -0,0 +1,1280 @@
+#ifndef DEJAVUSANS16PTLAT1__H
+#define DEJAVUSANS16PTLAT1__H
+const uint8_t DejaVuSans16pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF8, 0xE3, 0xF1,
+  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0x00, 0x61, 0xC0, 0x07, 0x0E,
+  0x00, 0x30, 0x60, 0x01, 0x83, 0x00, 0x1C, 0x38, 0x00, 0xE1, 0x80, 0xFF,
+  0xFF, 0xE7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x1C, 0x38, 0x00, 0xE1, 0x80,
+  0x06, 0x0C, 0x00, 0x70, 0xE0, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF,
+  0xFC, 0x06, 0x1C, 0x00, 0x70, 0xE0, 0x03, 0x06, 0x00, 0x18, 0x30, 0x00,
+  0xC3, 0x80, 0x0E, 0x1C, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18,
+  0x00, 0xFF, 0x07, 0xFF, 0x9F, 0xFF, 0x79, 0x86, 0xE3, 0x01, 0xC6, 0x03,
+  0x8C, 0x07, 0x98, 0x07, 0xF0, 0x07, 0xFE, 0x07, 0xFE, 0x01, 0xFE, 0x03,
+  0x1E, 0x06, 0x1C, 0x0C, 0x38, 0x18, 0x7C, 0x33, 0xFF, 0xFF, 0xBF, 0xFE,
+  0x1F, 0xF0, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x1E, 0x00, 0x18, 0x1F, 0xE0, 0x0E, 0x06, 0x18, 0x03, 0x03, 0x87, 0x01,
+  0x80, 0xC0, 0xC0, 0xE0, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x18, 0x03, 0x03,
+  0x0E, 0x00, 0xE1, 0xC3, 0x00, 0x18, 0x61, 0x80, 0x07, 0xF8, 0xE0, 0x00,
+  0x78, 0x30, 0x78, 0x00, 0x1C, 0x7F, 0x80, 0x06, 0x18, 0x60, 0x03, 0x0E,
+  0x1C, 0x01, 0xC3, 0x03, 0x00, 0x60, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x1C,
+  0x0C, 0x0C, 0x06, 0x03, 0x87, 0x03, 0x00, 0x61, 0x81, 0xC0, 0x1F, 0xE0,
+  0x60, 0x01, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x3C,
+  0x18, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x00,
+  0x0E, 0x00, 0x00, 0x78, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0x80, 0xE7, 0x9E,
+  0x07, 0x78, 0x78, 0x73, 0x81, 0xE3, 0x9C, 0x07, 0xB8, 0xE0, 0x1F, 0xC7,
+  0x80, 0x7C, 0x3C, 0x07, 0xE0, 0xF8, 0x7F, 0x83, 0xFF, 0xBE, 0x0F, 0xF8,
+  0xF8, 0x1F, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x18, 0x70, 0xC3, 0x86,
+  0x1C, 0x38, 0x71, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x83,
+  0x87, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x30, 0x70, 0xE0, 0xC1, 0xC1, 0x83,
+  0x83, 0x07, 0x0E, 0x1C, 0x18, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x30, 0xE1, 0xC3, 0x86, 0x1C, 0x30, 0xE1, 0x87, 0x00, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x10, 0xC2, 0xF3, 0x3C, 0xFF, 0xC0, 0xFC, 0x03, 0xF0, 0x3F,
+  0xF3, 0xCC, 0xF4, 0x30, 0x80, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0xE0,
+  0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0,
+  0x00, 0x38, 0x00, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
+  0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x77, 0x77, 0x6E, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xC0, 0xF0, 0x38, 0x0E, 0x03, 0x81,
+  0xE0, 0x70, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x38, 0x1E, 0x07, 0x01, 0xC0,
+  0x70, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x70, 0x1C, 0x07, 0x03, 0xC0, 0xE0,
+  0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x3C, 0x3C, 0x78, 0x1E, 0x70,
+  0x0E, 0x70, 0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x70, 0x0E, 0x70,
+  0x0E, 0x78, 0x1E, 0x3C, 0x3C, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x1F,
+  0x07, 0xF8, 0x3F, 0xC1, 0xCE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x3F, 0xC3, 0xFF, 0xCF, 0xFF, 0xB0, 0x1E, 0x00, 0x3C, 0x00, 0x70,
+  0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x00, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3E, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0xFF, 0xE1, 0xFF, 0xE3,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x3C, 0x00,
+  0xF0, 0x3F, 0xC0, 0x7E, 0x00, 0xFF, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x7E, 0x01, 0xEF, 0xFF, 0xDF, 0xFE, 0x0F,
+  0xF0, 0x00, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0xB8,
+  0x03, 0x38, 0x07, 0x38, 0x06, 0x38, 0x0E, 0x38, 0x1C, 0x38, 0x18, 0x38,
+  0x38, 0x38, 0x70, 0x38, 0x70, 0x38, 0xE0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 0xE3, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0xE3, 0x03, 0xE0, 0x01,
+  0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x76,
+  0x03, 0xEF, 0xFF, 0x9F, 0xFE, 0x0F, 0xF0, 0x00, 0x01, 0xF8, 0x0F, 0xFE,
+  0x1F, 0xFE, 0x3E, 0x06, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xE3, 0xF0, 0xEF, 0xF8, 0xFF, 0xFE, 0xFC, 0x1E, 0xF8, 0x0F,
+  0xF0, 0x07, 0xF0, 0x07, 0x70, 0x07, 0x70, 0x07, 0x78, 0x0F, 0x3C, 0x1E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x01,
+  0xE0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0,
+  0x03, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xC0, 0x07,
+  0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x78, 0x1E,
+  0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x78, 0x1C, 0x3C, 0x3C, 0x1F, 0xF8,
+  0x07, 0xE0, 0x3F, 0xFC, 0x78, 0x1E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xF0, 0x0F, 0x78, 0x1E, 0x7F, 0xFE, 0x3F, 0xFC, 0x0F, 0xF0,
+  0x07, 0xE0, 0x1F, 0xF0, 0x3F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xE0, 0x0E,
+  0xE0, 0x0E, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x1F, 0x78, 0x3F, 0x7F, 0xFF,
+  0x3F, 0xF7, 0x0F, 0xC7, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E,
+  0x00, 0x3C, 0x60, 0x7C, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0x80, 0xFF, 0xF0,
+  0x00, 0x00, 0x0F, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77,
+  0x6E, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x1F, 0xE0,
+  0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xF8, 0x00, 0x1F,
+  0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80,
+  0x03, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x1E, 0x00, 0x03,
+  0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xE0,
+  0x00, 0xFF, 0x00, 0x03, 0xE0, 0x03, 0xFC, 0x01, 0xFE, 0x01, 0xFE, 0x01,
+  0xFF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0x80, 0x00, 0x80, 0x00, 0x00,
+  0x1F, 0x87, 0xFC, 0xFF, 0xEE, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x70, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xF0, 0x3F,
+  0x01, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF3, 0xC1,
+  0xF3, 0x8E, 0x70, 0x7F, 0x71, 0xEE, 0x1F, 0xFE, 0x1F, 0x87, 0xC7, 0xC3,
+  0xF0, 0xE0, 0x78, 0x7E, 0x1C, 0x07, 0x0F, 0xC3, 0x80, 0xE1, 0xF8, 0x70,
+  0x1C, 0x7F, 0x0E, 0x07, 0x8E, 0xE1, 0xF1, 0xF7, 0x8E, 0x1F, 0xFF, 0xF1,
+  0xC1, 0xFD, 0xF8, 0x3C, 0x1F, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00,
+  0x10, 0x07, 0xC0, 0x07, 0x00, 0x7E, 0x03, 0xE0, 0x07, 0xFF, 0xF0, 0x00,
+  0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x03, 0xF8, 0x00, 0x1D, 0xC0, 0x00, 0xEE, 0x00, 0x0F,
+  0x38, 0x00, 0x71, 0xC0, 0x07, 0x8F, 0x00, 0x38, 0x38, 0x01, 0xC1, 0xC0,
+  0x1E, 0x0F, 0x00, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x70, 0x07, 0x03, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x38, 0xF0, 0x01, 0xE7,
+  0x00, 0x07, 0x38, 0x00, 0x3B, 0x80, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0xF8,
+  0xFF, 0xFC, 0xE0, 0x3E, 0xE0, 0x1E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E,
+  0xE0, 0x1E, 0xE0, 0x3C, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xFC, 0xE0, 0x1E,
+  0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1E,
+  0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF0, 0x01, 0xFE, 0x01, 0xFF, 0xE1, 0xFF,
+  0xFC, 0x7C, 0x07, 0x3C, 0x00, 0x5E, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38,
+  0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x04, 0x7C, 0x07, 0x1F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x70, 0x0F, 0xCE, 0x00, 0x79, 0xC0, 0x07,
+  0xB8, 0x00, 0x77, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0F,
+  0xE0, 0x01, 0xDC, 0x00, 0x7B, 0x80, 0x1E, 0x70, 0x0F, 0xCF, 0xFF, 0xF1,
+  0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xDC, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x3F, 0xFD, 0xFF, 0xEF, 0xFF, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0xE1, 0xF0,
+  0x1E, 0x3C, 0x00, 0x27, 0x80, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x0F, 0xFE,
+  0x00, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0x70, 0x00, 0x77, 0x80, 0x07,
+  0x3C, 0x00, 0x71, 0xF0, 0x1F, 0x0F, 0xFF, 0xE0, 0x7F, 0xFC, 0x01, 0xFE,
+  0x00, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F,
+  0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0,
+  0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F,
+  0x80, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F,
+  0x1E, 0xFE, 0xFC, 0xF0, 0xE0, 0x0F, 0x38, 0x07, 0x8E, 0x03, 0xC3, 0x81,
+  0xE0, 0xE0, 0xF0, 0x38, 0x78, 0x0E, 0x3C, 0x03, 0x9E, 0x00, 0xEF, 0x00,
+  0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x3B, 0xE0, 0x0E,
+  0x7C, 0x03, 0x8F, 0x80, 0xE1, 0xF0, 0x38, 0x3E, 0x0E, 0x07, 0xC3, 0x80,
+  0xF8, 0xE0, 0x1F, 0x38, 0x03, 0xEE, 0x00, 0x78, 0xE0, 0x03, 0x80, 0x0E,
+  0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03,
+  0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00,
+  0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xF8, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFE,
+  0xE0, 0x3B, 0xF7, 0x01, 0xDF, 0xBC, 0x1E, 0xFC, 0xE0, 0xE7, 0xE7, 0x07,
+  0x3F, 0x3C, 0x79, 0xF8, 0xE3, 0x8F, 0xC7, 0x1C, 0x7E, 0x1D, 0xC3, 0xF0,
+  0xEE, 0x1F, 0x87, 0x70, 0xFC, 0x1F, 0x07, 0xE0, 0xF8, 0x3F, 0x07, 0xC1,
+  0xF8, 0x1C, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80,
+  0x00, 0xE0, 0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xE0,
+  0x3F, 0x70, 0x1F, 0xBC, 0x0F, 0xCE, 0x07, 0xE7, 0x83, 0xF1, 0xC1, 0xF8,
+  0xF0, 0xFC, 0x38, 0x7E, 0x1E, 0x3F, 0x07, 0x1F, 0x83, 0xCF, 0xC0, 0xE7,
+  0xE0, 0x7B, 0xF0, 0x1D, 0xF8, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x00,
+  0x7F, 0x80, 0x1E, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xF0, 0x3E,
+  0x0F, 0x83, 0xC0, 0x1E, 0x3C, 0x00, 0x79, 0xC0, 0x01, 0xDE, 0x00, 0x0E,
+  0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
+  0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0x70, 0x00, 0x73,
+  0xC0, 0x07, 0x8F, 0x00, 0x78, 0x7E, 0x0F, 0x81, 0xFF, 0xFC, 0x03, 0xFF,
+  0x80, 0x07, 0xF0, 0x00, 0xFF, 0xE1, 0xFF, 0xF3, 0xFF, 0xF7, 0x01, 0xEE,
+  0x01, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x80,
+  0xF7, 0xFF, 0xEF, 0xFF, 0x9F, 0xFC, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xF0, 0x3E, 0x0F, 0x83, 0xC0,
+  0x1E, 0x3C, 0x00, 0x79, 0xC0, 0x01, 0xDE, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
+  0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0E, 0x70, 0x00, 0x73, 0xC0, 0x07, 0x8F,
+  0x00, 0x78, 0x3E, 0x0F, 0x81, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xF8,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0xFF,
+  0xE0, 0x3F, 0xFE, 0x0F, 0xFF, 0xC3, 0x80, 0xF0, 0xE0, 0x1E, 0x38, 0x03,
+  0x8E, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x1E, 0x38, 0x0F, 0x0F, 0xFF, 0xC3,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x38, 0x1E, 0x0E, 0x03, 0xC3, 0x80, 0x70, 0xE0,
+  0x0E, 0x38, 0x03, 0x8E, 0x00, 0x73, 0x80, 0x1C, 0xE0, 0x07, 0xB8, 0x00,
+  0xEE, 0x00, 0x3C, 0x07, 0xF8, 0x3F, 0xFE, 0x7F, 0xFE, 0x78, 0x06, 0xF0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x3F,
+  0xE0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x0F, 0xC0, 0x1E, 0xFF, 0xFE, 0xFF, 0xFC, 0x3F,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38,
+  0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70,
+  0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
+  0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F,
+  0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF8, 0x03, 0xDC, 0x01,
+  0xCF, 0x83, 0xE3, 0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0xE0, 0x00, 0x3B,
+  0x80, 0x03, 0x9C, 0x00, 0x1C, 0xF0, 0x01, 0xE3, 0x80, 0x0E, 0x1C, 0x00,
+  0x70, 0xF0, 0x07, 0x83, 0x80, 0x38, 0x1C, 0x01, 0xC0, 0x70, 0x1C, 0x03,
+  0x80, 0xE0, 0x1E, 0x0F, 0x00, 0x70, 0x70, 0x03, 0x83, 0x80, 0x0E, 0x3C,
+  0x00, 0x71, 0xC0, 0x03, 0x8E, 0x00, 0x0E, 0xE0, 0x00, 0x77, 0x00, 0x03,
+  0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x0F,
+  0x80, 0x3F, 0x00, 0x7C, 0x01, 0xDC, 0x03, 0xE0, 0x1C, 0xE0, 0x3B, 0x80,
+  0xE7, 0x01, 0xDC, 0x07, 0x38, 0x0E, 0xE0, 0x38, 0xE0, 0x77, 0x03, 0x87,
+  0x07, 0x1C, 0x1C, 0x38, 0x38, 0xE0, 0xE1, 0xC1, 0xC7, 0x07, 0x07, 0x0E,
+  0x38, 0x70, 0x38, 0xE0, 0xE3, 0x81, 0xC7, 0x07, 0x1C, 0x0E, 0x38, 0x38,
+  0xE0, 0x39, 0xC1, 0xCE, 0x01, 0xDC, 0x07, 0x70, 0x0E, 0xE0, 0x3B, 0x80,
+  0x77, 0x01, 0xDC, 0x01, 0xF8, 0x0F, 0xC0, 0x0F, 0xC0, 0x7E, 0x00, 0x7C,
+  0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x00, 0x78, 0x00, 0x78, 0x01,
+  0xE7, 0x80, 0x78, 0x70, 0x0E, 0x0F, 0x03, 0xC0, 0xE0, 0xF0, 0x1E, 0x1C,
+  0x01, 0xE7, 0x80, 0x1D, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xC0,
+  0x00, 0x78, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x00, 0xEF, 0x00, 0x3C, 0xE0,
+  0x0F, 0x1E, 0x01, 0xC1, 0xE0, 0x78, 0x1C, 0x1E, 0x03, 0xC3, 0x80, 0x38,
+  0xF0, 0x03, 0xBC, 0x00, 0x78, 0xF0, 0x01, 0xEF, 0x00, 0x78, 0xE0, 0x0E,
+  0x1E, 0x03, 0xC1, 0xE0, 0xF0, 0x1C, 0x1C, 0x03, 0xC7, 0x80, 0x3D, 0xE0,
+  0x03, 0xB8, 0x00, 0x7F, 0x00, 0x07, 0xC0, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00,
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x0F,
+  0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x70, 0xE1, 0xFF, 0xFF, 0xF0, 0xE0, 0x3C, 0x07, 0x01, 0xC0, 0x70, 0x0E,
+  0x03, 0x80, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x70, 0x1E, 0x03, 0x80, 0xE0,
+  0x38, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x03, 0x80, 0xE0, 0x38, 0x0F, 0x01,
+  0xC0, 0xFF, 0xFF, 0xF8, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x3E, 0x00, 0x0E, 0xE0, 0x03, 0x8E, 0x00,
+  0xE0, 0xE0, 0x78, 0x0E, 0x1E, 0x00, 0xF7, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC1, 0xC0, 0x1F, 0xC1, 0xFF,
+  0xC7, 0xFF, 0x98, 0x1E, 0x00, 0x1C, 0x00, 0x70, 0xFF, 0xCF, 0xFF, 0x7F,
+  0xFF, 0xE0, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x3F, 0xC1, 0xF7, 0xFF, 0xDF,
+  0xF7, 0x1F, 0x1C, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0x1C, 0x00, 0x38, 0x00, 0x71, 0xF0, 0xEF, 0xF1, 0xFF, 0xF3, 0xE0, 0xF7,
+  0x80, 0xEF, 0x01, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
+  0x1F, 0xC0, 0x7F, 0x80, 0xEF, 0x83, 0xDF, 0xFF, 0x3B, 0xFC, 0x71, 0xF0,
+  0x07, 0xF0, 0xFF, 0xCF, 0xFE, 0xF8, 0x17, 0x00, 0x78, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x3E, 0x04, 0xFF,
+  0xE3, 0xFF, 0x07, 0xF0, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xE0, 0x01, 0xC0, 0x03, 0x87, 0xC7, 0x1F, 0xEE, 0x7F, 0xFD, 0xE0,
+  0xFB, 0x80, 0xFF, 0x01, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F,
+  0xC0, 0x1F, 0xC0, 0x7B, 0x80, 0xF7, 0x83, 0xE7, 0xFF, 0xC7, 0xFB, 0x87,
+  0xC7, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x1E, 0x70, 0x0E, 0xF0,
+  0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0,
+  0x00, 0x70, 0x02, 0x7C, 0x0E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0x03,
+  0xE1, 0xFC, 0x3F, 0x8F, 0x01, 0xC0, 0x38, 0x07, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x0F, 0x8E, 0x3F, 0xDC,
+  0xFF, 0xFB, 0xC1, 0xF7, 0x01, 0xFE, 0x03, 0xF8, 0x03, 0xF0, 0x07, 0xE0,
+  0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x80, 0xF7, 0x01, 0xEF, 0x07, 0xCF, 0xFF,
+  0x8F, 0xF7, 0x0F, 0x8E, 0x00, 0x3C, 0x00, 0x71, 0x03, 0xE3, 0xFF, 0x87,
+  0xFE, 0x07, 0xF8, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0,
+  0x03, 0x80, 0x0E, 0x00, 0x38, 0xF8, 0xEF, 0xF3, 0xFF, 0xEF, 0x87, 0xBC,
+  0x0F, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
+  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x71, 0xC7, 0x00, 0x00,
+  0x07, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x73, 0xFE, 0xFB, 0x80, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x1E, 0xE0, 0x79, 0xC1,
+  0xE3, 0x8F, 0x87, 0x3E, 0x0E, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0x7E, 0x00,
+  0xFE, 0x01, 0xDE, 0x03, 0x9E, 0x07, 0x1E, 0x0E, 0x1E, 0x1C, 0x1E, 0x38,
+  0x1F, 0x70, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE0, 0x7C, 0x77, 0xF8, 0xFF, 0x3F, 0xFE, 0xFF, 0xDF, 0x07, 0x60,
+  0xEF, 0x03, 0xE0, 0x7F, 0x00, 0xE0, 0x1F, 0x80, 0x70, 0x0F, 0xC0, 0x38,
+  0x07, 0xE0, 0x1C, 0x03, 0xF0, 0x0E, 0x01, 0xF8, 0x07, 0x00, 0xFC, 0x03,
+  0x80, 0x7E, 0x01, 0xC0, 0x3F, 0x00, 0xE0, 0x1F, 0x80, 0x70, 0x0F, 0xC0,
+  0x38, 0x07, 0xE0, 0x1C, 0x03, 0x80, 0xE3, 0xE3, 0xBF, 0xCF, 0xFF, 0xBE,
+  0x1E, 0xF0, 0x3F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
+  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1C,
+  0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0, 0x0F,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F,
+  0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xE3, 0xE1,
+  0xDF, 0xE3, 0xFF, 0xE7, 0xC1, 0xEF, 0x01, 0xDE, 0x03, 0xF8, 0x03, 0xF0,
+  0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x80, 0xFF, 0x01, 0xDF, 0x07,
+  0xBF, 0xFE, 0x77, 0xF8, 0xE3, 0xE1, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x8E, 0x3F, 0xDC, 0xFF, 0xFB,
+  0xC1, 0xF7, 0x01, 0xFE, 0x03, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x80, 0xF7, 0x01, 0xEF, 0x07, 0xCF, 0xFF, 0x8F, 0xF7,
+  0x0F, 0x8E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0xE3, 0xFB, 0xFF, 0xFF, 0xE0, 0xF0, 0x3C, 0x0E, 0x03, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x00,
+  0x1F, 0xE3, 0xFF, 0xBF, 0xFD, 0xE0, 0x2E, 0x00, 0x78, 0x03, 0xFE, 0x0F,
+  0xFC, 0x0F, 0xF0, 0x07, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xF0, 0x3F, 0xFF,
+  0xCF, 0xFC, 0x1F, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x81, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0, 0x1F, 0xF1, 0xFE, 0x0F, 0xC0, 0xE0,
+  0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0, 0x3F, 0xC1, 0xF7,
+  0xFF, 0xCF, 0xF7, 0x1F, 0x1C, 0xE0, 0x03, 0xB8, 0x03, 0x9C, 0x01, 0xCF,
+  0x01, 0xE3, 0x80, 0xE1, 0xC0, 0x70, 0xF0, 0x78, 0x38, 0x38, 0x1C, 0x1C,
+  0x07, 0x1C, 0x03, 0x8E, 0x01, 0xEF, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x0F,
+  0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xE0, 0x38, 0x0F, 0xC0, 0x70, 0x3D,
+  0xC0, 0xE0, 0x73, 0x83, 0x60, 0xE7, 0x06, 0xC1, 0xCF, 0x0D, 0x87, 0x8E,
+  0x1B, 0x0E, 0x1C, 0x63, 0x1C, 0x38, 0xC6, 0x38, 0x39, 0x8C, 0xF0, 0x77,
+  0x1D, 0xC0, 0xEC, 0x1B, 0x81, 0xD8, 0x37, 0x01, 0xF0, 0x7C, 0x03, 0xC0,
+  0x78, 0x07, 0x80, 0xF0, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x3C, 0x1E, 0x1C,
+  0x1C, 0x1E, 0x3C, 0x0F, 0x78, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x01,
+  0xC0, 0x03, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x1E, 0x78, 0x1C, 0x3C, 0x3C,
+  0x1C, 0x78, 0x1E, 0xF0, 0x0F, 0xF0, 0x03, 0xB8, 0x03, 0x9C, 0x01, 0xC7,
+  0x01, 0xE3, 0x80, 0xE1, 0xE0, 0xF0, 0x70, 0x70, 0x3C, 0x38, 0x0E, 0x38,
+  0x07, 0x9C, 0x01, 0xDE, 0x00, 0xEE, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F,
+  0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x01, 0xF0, 0x3F, 0x07, 0xF0, 0x78, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0xFE, 0x0F, 0x80, 0xFE, 0x01, 0xE0,
+  0x0F, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x78, 0x07, 0xF0, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x0F, 0xC0, 0xFE,
+  0x01, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x00, 0xF0, 0x07, 0xF0, 0x1F, 0x07, 0xF0, 0x70, 0x0F, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0xFC,
+  0x0F, 0xC0, 0xF0, 0x00, 0x1F, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xE8, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x80, 0x0C, 0x00,
+  0x60, 0x03, 0x00, 0x7F, 0x0F, 0xFC, 0xFF, 0xEF, 0xB1, 0x71, 0x87, 0x8C,
+  0x38, 0x61, 0xC3, 0x0E, 0x18, 0x70, 0xC3, 0x86, 0x1E, 0x30, 0x71, 0x83,
+  0xCC, 0x4F, 0xFE, 0x3F, 0xF0, 0x7F, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01,
+  0x80, 0x00, 0xFC, 0x07, 0xFC, 0x1F, 0xF8, 0x3C, 0x10, 0xF0, 0x01, 0xC0,
+  0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x03, 0xFF, 0xC7,
+  0xFF, 0x8F, 0xFF, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x40, 0x01, 0x70,
+  0x01, 0xDC, 0x71, 0xC7, 0xFF, 0xC1, 0xFF, 0xC0, 0xF1, 0xE0, 0x70, 0x70,
+  0x70, 0x1C, 0x38, 0x0E, 0x1C, 0x07, 0x07, 0x07, 0x03, 0xC7, 0x81, 0xFF,
+  0xC1, 0xFF, 0xF1, 0xC7, 0x1D, 0xC0, 0x07, 0x40, 0x01, 0x00, 0xF0, 0x07,
+  0xB8, 0x03, 0x9E, 0x03, 0xC7, 0x01, 0xC3, 0xC1, 0xE0, 0xE0, 0xE0, 0x78,
+  0xF0, 0x1C, 0x70, 0x07, 0x70, 0x3F, 0xBF, 0x9F, 0xFF, 0xC0, 0x7C, 0x00,
+  0x1C, 0x00, 0x0E, 0x01, 0xFF, 0xFC, 0xFF, 0xFE, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xC1, 0xFF,
+  0x1E, 0x18, 0xE0, 0x47, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x80, 0x1F, 0x03,
+  0xBE, 0x38, 0x79, 0xC1, 0xEE, 0x07, 0xF8, 0x1D, 0xE0, 0xE7, 0xCE, 0x0F,
+  0x60, 0x3E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x00, 0x39, 0x01, 0xCE, 0x1C,
+  0x7F, 0xE0, 0xFC, 0x00, 0xE3, 0xF1, 0xF8, 0xE0, 0x00, 0xFC, 0x00, 0x1F,
+  0xFE, 0x00, 0xF0, 0x3C, 0x07, 0x00, 0x38, 0x38, 0x00, 0x71, 0xC3, 0xF0,
+  0xE6, 0x1F, 0xE1, 0x98, 0xE0, 0x86, 0xC7, 0x00, 0x0F, 0x18, 0x00, 0x3C,
+  0x60, 0x00, 0xF1, 0x80, 0x03, 0xC6, 0x00, 0x0F, 0x1C, 0x00, 0x36, 0x38,
+  0x21, 0x98, 0x7F, 0x86, 0x70, 0xFC, 0x38, 0xE0, 0x01, 0xC1, 0xC0, 0x0E,
+  0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x87, 0xFE,
+  0x40, 0x60, 0x03, 0x1F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x7E, 0x0F,
+  0x7F, 0xB3, 0xF3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0x08, 0x30,
+  0xC3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x1C, 0x70, 0x71, 0xC1,
+  0xC7, 0x07, 0x1C, 0x1C, 0x70, 0x61, 0x81, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x00,
+  0x1F, 0xFE, 0x00, 0xF0, 0x3C, 0x07, 0x00, 0x38, 0x38, 0x00, 0x71, 0xC7,
+  0xE0, 0xE6, 0x1F, 0xC1, 0x98, 0x61, 0x86, 0xC1, 0x86, 0x0F, 0x06, 0x18,
+  0x3C, 0x1F, 0xC0, 0xF0, 0x7E, 0x03, 0xC1, 0x98, 0x0F, 0x06, 0x30, 0x36,
+  0x18, 0xE1, 0x98, 0x61, 0x86, 0x71, 0x83, 0x38, 0xE0, 0x01, 0xC1, 0xC0,
+  0x0E, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86,
+  0x7F, 0x87, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70,
+  0x00, 0x0E, 0x00, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x18, 0x18, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1F, 0xFF, 0xF8, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x39,
+  0xF8, 0xFC, 0x07, 0x01, 0x80, 0xE0, 0xFF, 0xE7, 0xE0, 0x0E, 0x38, 0xE1,
+  0x86, 0x1C, 0x00, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+  0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+  0x1C, 0xE0, 0x1C, 0xF0, 0x3C, 0xF8, 0x7C, 0xFF, 0xFF, 0xEF, 0xCF, 0xE7,
+  0x8E, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0x0F, 0xFC, 0xFF, 0xF7, 0xF8, 0xDF, 0xE3, 0xFF, 0x8F, 0xFE, 0x3F,
+  0xF8, 0xFF, 0xE3, 0xFF, 0x8D, 0xFE, 0x37, 0xF8, 0xCF, 0xE3, 0x0F, 0x8C,
+  0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63,
+  0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x30, 0xFF,
+  0xF0, 0x38, 0x61, 0xC7, 0xFF, 0xE0, 0x38, 0xF8, 0xD8, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x1F, 0x83, 0xFC, 0x70, 0xEE,
+  0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC1,
+  0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE7, 0xFE, 0x82, 0x06, 0x18, 0x38, 0xE0,
+  0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xC7, 0x0C, 0x30, 0x41, 0x00, 0x38, 0x00, 0x38, 0x1F, 0x00, 0x06,
+  0x03, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x70, 0x01, 0x80, 0x0C, 0x00, 0x30,
+  0x03, 0x80, 0x06, 0x00, 0xE0, 0x00, 0xC0, 0x18, 0x00, 0x18, 0x07, 0x00,
+  0x03, 0x00, 0xC0, 0x00, 0x60, 0x30, 0x0E, 0x7F, 0x8E, 0x01, 0xCF, 0xF1,
+  0x80, 0x78, 0x00, 0x60, 0x1B, 0x00, 0x1C, 0x02, 0x60, 0x03, 0x00, 0xCC,
+  0x00, 0xE0, 0x11, 0x80, 0x38, 0x04, 0x30, 0x06, 0x01, 0x86, 0x01, 0xC0,
+  0x3F, 0xF0, 0x30, 0x07, 0xFE, 0x0C, 0x00, 0x03, 0x03, 0x80, 0x00, 0x60,
+  0x38, 0x00, 0x38, 0x3E, 0x00, 0x0C, 0x0D, 0x80, 0x06, 0x00, 0x60, 0x03,
+  0x80, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x01, 0x80, 0x38, 0x00, 0x60,
+  0x0C, 0x00, 0x18, 0x07, 0x00, 0x06, 0x01, 0x80, 0x01, 0x80, 0xC3, 0xF3,
+  0xFC, 0x71, 0xFE, 0xFF, 0x18, 0x41, 0xC0, 0x0C, 0x00, 0x30, 0x07, 0x00,
+  0x0C, 0x01, 0x80, 0x06, 0x00, 0xE0, 0x03, 0x80, 0x70, 0x01, 0xC0, 0x18,
+  0x00, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x38, 0x01, 0x80, 0x1F, 0xF0,
+  0xE0, 0x07, 0xFC, 0x7E, 0x00, 0x1C, 0x0F, 0xF0, 0x01, 0x80, 0x83, 0x80,
+  0x30, 0x00, 0x18, 0x07, 0x00, 0x03, 0x80, 0x60, 0x03, 0xF0, 0x0E, 0x00,
+  0x3F, 0x01, 0xC0, 0x00, 0x38, 0x18, 0x00, 0x01, 0x83, 0x80, 0x00, 0x18,
+  0x30, 0x00, 0x83, 0x86, 0x01, 0xCF, 0xF0, 0xE0, 0x1C, 0x7E, 0x0C, 0x03,
+  0xC0, 0x01, 0x80, 0x6C, 0x00, 0x38, 0x04, 0xC0, 0x03, 0x00, 0xCC, 0x00,
+  0x70, 0x08, 0xC0, 0x0E, 0x01, 0x0C, 0x00, 0xC0, 0x30, 0xC0, 0x1C, 0x03,
+  0xFF, 0x01, 0x80, 0x3F, 0xF0, 0x30, 0x00, 0x0C, 0x07, 0x00, 0x00, 0xC0,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x0F, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00,
+  0xE0, 0x0E, 0x00, 0xE0, 0x1F, 0x07, 0x7F, 0xF3, 0xFE, 0x1F, 0x80, 0x01,
+  0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x77, 0x00, 0x03, 0xB8, 0x00, 0x3C, 0xE0, 0x01, 0xC7, 0x00,
+  0x1E, 0x3C, 0x00, 0xE0, 0xE0, 0x07, 0x07, 0x00, 0x78, 0x3C, 0x03, 0x80,
+  0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x1C, 0x0F, 0xFF, 0xE0, 0xFF, 0xFF, 0x87,
+  0xFF, 0xFC, 0x38, 0x00, 0xE3, 0xC0, 0x07, 0x9C, 0x00, 0x1C, 0xE0, 0x00,
+  0xEE, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x1C, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x1F,
+  0x00, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x77, 0x00, 0x03, 0xB8, 0x00,
+  0x3C, 0xE0, 0x01, 0xC7, 0x00, 0x1E, 0x3C, 0x00, 0xE0, 0xE0, 0x07, 0x07,
+  0x00, 0x78, 0x3C, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x1C, 0x0F,
+  0xFF, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFC, 0x38, 0x00, 0xE3, 0xC0, 0x07,
+  0x9C, 0x00, 0x1C, 0xE0, 0x00, 0xEE, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00,
+  0x06, 0xC0, 0x00, 0x63, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x77, 0x00, 0x03, 0xB8, 0x00, 0x3C, 0xE0, 0x01, 0xC7, 0x00, 0x1E, 0x3C,
+  0x00, 0xE0, 0xE0, 0x07, 0x07, 0x00, 0x78, 0x3C, 0x03, 0x80, 0xE0, 0x1C,
+  0x07, 0x01, 0xC0, 0x1C, 0x0F, 0xFF, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFC,
+  0x38, 0x00, 0xE3, 0xC0, 0x07, 0x9C, 0x00, 0x1C, 0xE0, 0x00, 0xEE, 0x00,
+  0x03, 0x80, 0x01, 0xC6, 0x00, 0x1F, 0x30, 0x00, 0xCF, 0x80, 0x06, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0x00, 0x03, 0xB8, 0x00, 0x1D, 0xC0,
+  0x01, 0xE7, 0x00, 0x0E, 0x38, 0x00, 0xF1, 0xE0, 0x07, 0x07, 0x00, 0x38,
+  0x38, 0x03, 0xC1, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x0E, 0x00, 0xE0,
+  0x7F, 0xFF, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xE1, 0xC0, 0x07, 0x1E, 0x00,
+  0x3C, 0xE0, 0x00, 0xE7, 0x00, 0x07, 0x70, 0x00, 0x1C, 0x03, 0x8E, 0x00,
+  0x1C, 0x70, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x77, 0x00, 0x03, 0xB8, 0x00, 0x3C, 0xE0, 0x01, 0xC7, 0x00, 0x1E, 0x3C,
+  0x00, 0xE0, 0xE0, 0x07, 0x07, 0x00, 0x78, 0x3C, 0x03, 0x80, 0xE0, 0x1C,
+  0x07, 0x01, 0xC0, 0x1C, 0x0F, 0xFF, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFC,
+  0x38, 0x00, 0xE3, 0xC0, 0x07, 0x9C, 0x00, 0x1C, 0xE0, 0x00, 0xEE, 0x00,
+  0x03, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0xE3, 0x80, 0x06, 0x0C,
+  0x00, 0x30, 0x60, 0x01, 0xC7, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00, 0x00,
+  0xF8, 0x00, 0x0E, 0xE0, 0x00, 0x77, 0x00, 0x07, 0xBC, 0x00, 0x38, 0xE0,
+  0x01, 0xC7, 0x00, 0x1E, 0x3C, 0x00, 0xE0, 0xE0, 0x07, 0x07, 0x00, 0x70,
+  0x1C, 0x03, 0x80, 0xE0, 0x3C, 0x07, 0x81, 0xC0, 0x1C, 0x0F, 0xFF, 0xE0,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFC, 0x38, 0x00, 0xE3, 0xC0, 0x03, 0x9C, 0x00,
+  0x1C, 0xE0, 0x00, 0xEE, 0x00, 0x03, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x01, 0xE7, 0x00, 0x00, 0x0E, 0x38,
+  0x00, 0x00, 0xF1, 0xC0, 0x00, 0x07, 0x0E, 0x00, 0x00, 0x38, 0x70, 0x00,
+  0x03, 0x83, 0x80, 0x00, 0x1C, 0x1C, 0x00, 0x01, 0xE0, 0xFF, 0xFC, 0x0E,
+  0x07, 0xFF, 0xE0, 0xF0, 0x3F, 0xFF, 0x07, 0x01, 0xC0, 0x00, 0x38, 0x0E,
+  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00,
+  0x0E, 0x00, 0xE0, 0x00, 0xF0, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xFF, 0xB8,
+  0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x01, 0xFE, 0x01, 0xFF, 0xE1,
+  0xFF, 0xFC, 0x7C, 0x07, 0x3C, 0x00, 0x5E, 0x00, 0x07, 0x00, 0x03, 0xC0,
+  0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x1E, 0x00, 0x03,
+  0xC0, 0x04, 0x7C, 0x07, 0x1F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0x01,
+  0xC0, 0x00, 0x30, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x07, 0xE0, 0x01, 0xF0,
+  0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF,
+  0xF7, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xC0, 0x03, 0x00,
+  0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00,
+  0x70, 0x00, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xF7, 0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x03, 0x80, 0x0D, 0x80, 0x31, 0x80, 0xE3, 0x80, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xFF, 0xFD, 0xFF,
+  0xFB, 0xFF, 0xF7, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1C, 0x70,
+  0x38, 0xE0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xF7, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE1, 0xC3, 0x86, 0x00, 0x03, 0x8E, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8E, 0x38, 0x18, 0xC7, 0x38, 0x00, 0x07, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x70, 0x1C, 0x1B, 0x18, 0xDC, 0x70, 0x00, 0x00, 0x70, 0x38, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE3, 0xF1,
+  0xF8, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0x1F, 0xFC, 0x00, 0x7F, 0xFE,
+  0x01, 0xFF, 0xFE, 0x07, 0x00, 0xFC, 0x1C, 0x00, 0xF0, 0x70, 0x01, 0xE1,
+  0xC0, 0x03, 0x87, 0x00, 0x0F, 0x1C, 0x00, 0x1C, 0x70, 0x00, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1C, 0x70, 0x00, 0x71, 0xC0, 0x01,
+  0xC7, 0x00, 0x0F, 0x1C, 0x00, 0x38, 0x70, 0x01, 0xE1, 0xC0, 0x0F, 0x07,
+  0x00, 0xFC, 0x1F, 0xFF, 0xE0, 0x7F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x07,
+  0x18, 0x07, 0xCC, 0x03, 0x3E, 0x01, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xE0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0xC0,
+  0x7E, 0xE0, 0x3F, 0x78, 0x1F, 0x9C, 0x0F, 0xCF, 0x07, 0xE3, 0x83, 0xF1,
+  0xE1, 0xF8, 0x70, 0xFC, 0x3C, 0x7E, 0x0E, 0x3F, 0x07, 0x9F, 0x81, 0xCF,
+  0xC0, 0xF7, 0xE0, 0x3B, 0xF0, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0xFE, 0x00,
+  0xFF, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xC0, 0xF8, 0x3E, 0x0F, 0x00, 0x78, 0xF0, 0x01, 0xE7, 0x00,
+  0x07, 0x78, 0x00, 0x3B, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F,
+  0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00,
+  0x3D, 0xC0, 0x01, 0xCF, 0x00, 0x1E, 0x3C, 0x01, 0xE1, 0xF8, 0x3E, 0x07,
+  0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x01,
+  0x80, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0xF8, 0x3E, 0x0F, 0x00,
+  0x78, 0xF0, 0x01, 0xE7, 0x00, 0x07, 0x78, 0x00, 0x3B, 0x80, 0x00, 0xFC,
+  0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF8, 0x00, 0x3D, 0xC0, 0x01, 0xCF, 0x00, 0x1E, 0x3C,
+  0x01, 0xE1, 0xF8, 0x3E, 0x07, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0,
+  0x00, 0x00, 0x70, 0x00, 0x06, 0xC0, 0x00, 0x63, 0x00, 0x07, 0x1C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xC0, 0xF8, 0x3E, 0x0F, 0x00, 0x78, 0xF0, 0x01, 0xE7, 0x00, 0x07, 0x78,
+  0x00, 0x3B, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01,
+  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x3D, 0xC0,
+  0x01, 0xCF, 0x00, 0x1E, 0x3C, 0x01, 0xE1, 0xF8, 0x3E, 0x07, 0xFF, 0xF0,
+  0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xC6, 0x00, 0x1F, 0x30, 0x00,
+  0xCF, 0x80, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x80, 0x07, 0xFF, 0x00, 0xFF, 0xFE, 0x07, 0xC1, 0xF0, 0x78,
+  0x03, 0xC7, 0x80, 0x0F, 0x38, 0x00, 0x3B, 0xC0, 0x01, 0xDC, 0x00, 0x07,
+  0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
+  0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xEE, 0x00, 0x0E, 0x78, 0x00, 0xF1,
+  0xE0, 0x0F, 0x0F, 0xC1, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0xFE,
+  0x00, 0x03, 0x8E, 0x00, 0x1C, 0x70, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xC0, 0xF8, 0x3E, 0x0F, 0x00, 0x78, 0xF0, 0x01, 0xE7, 0x00, 0x07, 0x78,
+  0x00, 0x3B, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01,
+  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x3D, 0xC0,
+  0x01, 0xCF, 0x00, 0x1E, 0x3C, 0x01, 0xE1, 0xF8, 0x3E, 0x07, 0xFF, 0xF0,
+  0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x20, 0x02, 0x78, 0x03, 0xDE, 0x03,
+  0xC7, 0x83, 0xC3, 0xE3, 0xE0, 0xFB, 0xE0, 0x3D, 0xE0, 0x0F, 0xE0, 0x03,
+  0xE0, 0x01, 0xF0, 0x01, 0xFC, 0x01, 0xEF, 0x01, 0xF7, 0xC1, 0xF1, 0xF0,
+  0xF0, 0x78, 0xF0, 0x1E, 0xF0, 0x07, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xE0, 0xC1, 0xFF, 0xCE, 0x3F, 0xFF, 0x63, 0xF0, 0x7E, 0x1E, 0x00,
+  0xF1, 0xE0, 0x07, 0xCE, 0x00, 0x7E, 0xF0, 0x07, 0x77, 0x00, 0x71, 0xF8,
+  0x07, 0x0F, 0xC0, 0x70, 0x7E, 0x07, 0x03, 0xF0, 0x70, 0x1F, 0x87, 0x00,
+  0xFC, 0x70, 0x07, 0x77, 0x00, 0x7B, 0xF0, 0x03, 0x9F, 0x00, 0x3C, 0x78,
+  0x03, 0xC3, 0xF0, 0x7E, 0x37, 0xFF, 0xE3, 0x9F, 0xFC, 0x18, 0x3F, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
+  0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F,
+  0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x0F, 0x70, 0x07, 0x3E, 0x0F, 0x8F, 0xFF,
+  0x83, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
+  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x0F, 0x70, 0x07, 0x3E, 0x0F,
+  0x8F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x01, 0xC0, 0x01, 0xB0, 0x01,
+  0x8C, 0x01, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0F, 0xC0, 0x07,
+  0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
+  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x0F, 0x70, 0x07,
+  0x3E, 0x0F, 0x8F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x0E, 0x38, 0x07,
+  0x1C, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0F,
+  0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00,
+  0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x0F,
+  0x70, 0x07, 0x3E, 0x0F, 0x8F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x00,
+  0x30, 0x00, 0x0C, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0x00, 0x7B, 0xC0, 0x1E, 0x38, 0x03, 0x87, 0x80, 0xF0, 0x78,
+  0x3C, 0x07, 0x07, 0x00, 0xF1, 0xE0, 0x0F, 0x78, 0x00, 0xEE, 0x00, 0x1F,
+  0xC0, 0x01, 0xF0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0F, 0xFE, 0x1F, 0xFF, 0x3F, 0xFF, 0x70, 0x1E, 0xE0,
+  0x1F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x01, 0xFC, 0x07, 0xBF, 0xFF,
+  0x7F, 0xFC, 0xFF, 0xE1, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0xC1, 0xFF, 0xC3, 0xC3, 0x8F,
+  0x03, 0x9C, 0x07, 0x38, 0x1E, 0x70, 0xF0, 0xE3, 0xC1, 0xC7, 0x03, 0x8E,
+  0x07, 0x1C, 0x0E, 0x1C, 0x1C, 0x3C, 0x38, 0x1E, 0x70, 0x1E, 0xE0, 0x1F,
+  0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x41, 0xFC, 0xFF, 0xB9, 0xFF, 0x71,
+  0xF8, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0xC7, 0xFF, 0x98, 0x1E, 0x00, 0x1C,
+  0x00, 0x70, 0xFF, 0xCF, 0xFF, 0x7F, 0xFF, 0xE0, 0x7E, 0x01, 0xF8, 0x07,
+  0xE0, 0x3F, 0xC1, 0xF7, 0xFF, 0xDF, 0xF7, 0x1F, 0x1C, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0x60, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xC1, 0xFF, 0xC7, 0xFF, 0x98, 0x1E, 0x00, 0x1C, 0x00, 0x70, 0xFF, 0xCF,
+  0xFF, 0x7F, 0xFF, 0xE0, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x3F, 0xC1, 0xF7,
+  0xFF, 0xDF, 0xF7, 0x1F, 0x1C, 0x03, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0x30,
+  0x18, 0x60, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0xC7, 0xFF,
+  0x98, 0x1E, 0x00, 0x1C, 0x00, 0x70, 0xFF, 0xCF, 0xFF, 0x7F, 0xFF, 0xE0,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x3F, 0xC1, 0xF7, 0xFF, 0xDF, 0xF7, 0x1F,
+  0x1C, 0x1E, 0x30, 0x7C, 0xC3, 0x3E, 0x0C, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xF0, 0x7F, 0xF1, 0xFF, 0xE6, 0x07, 0x80, 0x07, 0x00, 0x1C,
+  0x3F, 0xF3, 0xFF, 0xDF, 0xFF, 0xF8, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x0F,
+  0xF0, 0x7D, 0xFF, 0xF7, 0xFD, 0xC7, 0xC7, 0x1C, 0xE0, 0x73, 0x81, 0xCE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xF1, 0xFF,
+  0xE6, 0x07, 0x80, 0x07, 0x00, 0x1C, 0x3F, 0xF3, 0xFF, 0xDF, 0xFF, 0xF8,
+  0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x0F, 0xF0, 0x7D, 0xFF, 0xF7, 0xFD, 0xC7,
+  0xC7, 0x07, 0x80, 0x3F, 0x01, 0xCE, 0x06, 0x18, 0x18, 0x60, 0x73, 0x80,
+  0xFC, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xFC, 0x7F, 0xF9,
+  0x81, 0xE0, 0x01, 0xC0, 0x07, 0x0F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFE, 0x07,
+  0xE0, 0x1F, 0x80, 0x7E, 0x03, 0xFC, 0x1F, 0x7F, 0xFD, 0xFF, 0x71, 0xF1,
+  0xC0, 0x1F, 0xC0, 0xFC, 0x1F, 0xFC, 0xFF, 0x87, 0xFF, 0xFF, 0xF1, 0x81,
+  0xFC, 0x1E, 0x00, 0x1E, 0x03, 0x80, 0x07, 0x00, 0x70, 0xFF, 0xC0, 0x1C,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x01, 0xC0,
+  0x03, 0x80, 0x70, 0x00, 0xE0, 0x3E, 0x00, 0xBC, 0x1F, 0xE0, 0xE7, 0xFE,
+  0x7F, 0xF9, 0xFF, 0x0F, 0xFC, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xF0, 0xFF,
+  0xCF, 0xFE, 0xF8, 0x17, 0x00, 0x78, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07,
+  0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x3E, 0x04, 0xFF, 0xE3, 0xFF, 0x07,
+  0xF0, 0x1C, 0x00, 0x60, 0x03, 0x80, 0x1C, 0x07, 0xE0, 0x3E, 0x00, 0x1C,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x1E, 0x70,
+  0x0E, 0xF0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0xE0, 0x00, 0x70, 0x02, 0x7C, 0x0E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07,
+  0xF0, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x1E, 0x70, 0x0E, 0xF0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x02, 0x7C, 0x0E, 0x3F, 0xFE, 0x1F,
+  0xFC, 0x07, 0xF0, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x0C,
+  0x30, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F,
+  0xFC, 0x7C, 0x1E, 0x70, 0x0E, 0xF0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x02, 0x7C, 0x0E, 0x3F,
+  0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F,
+  0xFC, 0x7C, 0x1E, 0x70, 0x0E, 0xF0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x02, 0x7C, 0x0E, 0x3F,
+  0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC1, 0xC0, 0x00,
+  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x0E, 0x38, 0xE1, 0x86, 0x1C, 0x00, 0x00, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+  0xE0, 0x0E, 0x03, 0xE0, 0xEE, 0x18, 0xC7, 0x1D, 0xC1, 0xC0, 0x00, 0x00,
+  0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00,
+  0xE3, 0xF1, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0x70, 0x38, 0x0C, 0x00, 0x0E, 0x1C, 0x07, 0xF8, 0x07, 0xC0, 0x3F,
+  0xC0, 0x30, 0xE0, 0x00, 0x70, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x7C,
+  0x1E, 0x70, 0x0E, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F,
+  0xF8, 0x07, 0xE0, 0x1E, 0x30, 0x7C, 0xC3, 0x3E, 0x0C, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0xF8, 0xEF, 0xF3, 0xFF, 0xEF, 0x87, 0xBC, 0x0F,
+  0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01,
+  0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0E, 0xF0,
+  0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0,
+  0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x70,
+  0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07,
+  0xE0, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x0C, 0x30, 0x1C,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F,
+  0xF8, 0x07, 0xE0, 0x0F, 0x18, 0x0F, 0x98, 0x19, 0xF0, 0x18, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F,
+  0xF8, 0x07, 0xE0, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C,
+  0x3E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x0F, 0x70, 0x0E, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F,
+  0xF8, 0x07, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0xFC, 0x60, 0xFF, 0xB8,
+  0x7F, 0xFC, 0x3E, 0x1E, 0x0E, 0x03, 0xC7, 0x81, 0xF1, 0xC0, 0xCE, 0x70,
+  0x63, 0x9C, 0x30, 0xE7, 0x18, 0x39, 0xCC, 0x0E, 0x3E, 0x07, 0x8F, 0x01,
+  0xC1, 0xE1, 0xF0, 0xFF, 0xF8, 0x77, 0xFC, 0x18, 0xFC, 0x04, 0x00, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0,
+  0x3F, 0xC1, 0xF7, 0xFF, 0xCF, 0xF7, 0x1F, 0x1C, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0x60, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F,
+  0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07,
+  0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xF0, 0x3F, 0xC1, 0xF7, 0xFF,
+  0xCF, 0xF7, 0x1F, 0x1C, 0x03, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0x30, 0x18,
+  0x60, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
+  0x01, 0xF8, 0x07, 0xF0, 0x3F, 0xC1, 0xF7, 0xFF, 0xCF, 0xF7, 0x1F, 0x1C,
+  0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFC, 0x0F, 0xF0,
+  0x7D, 0xFF, 0xF3, 0xFD, 0xC7, 0xC7, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x03, 0xB8, 0x03, 0x9C, 0x01, 0xC7, 0x01, 0xE3, 0x80, 0xE1, 0xE0, 0xF0,
+  0x70, 0x70, 0x3C, 0x38, 0x0E, 0x38, 0x07, 0x9C, 0x01, 0xDE, 0x00, 0xEE,
+  0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01,
+  0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x71, 0xF0, 0xEF, 0xF1, 0xFF, 0xF3, 0xE0, 0xF7, 0x80, 0xEF, 0x01,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F,
+  0x80, 0xEF, 0x83, 0xDF, 0xFF, 0x3B, 0xFC, 0x71, 0xF0, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x70, 0x07,
+  0x38, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xE0, 0x07, 0x70, 0x07, 0x38, 0x03, 0x8E, 0x03, 0xC7, 0x01, 0xC3, 0xC1,
+  0xE0, 0xE0, 0xE0, 0x78, 0x70, 0x1C, 0x70, 0x0F, 0x38, 0x03, 0xBC, 0x01,
+  0xDC, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x03, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF0,
+  0x00 };
+
+const GFXglyph DejaVuSans16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
+  {     1,   3,  23,  12,    5,  -22 },   // 0x21 '!'
+  {    10,   9,   8,  14,    3,  -22 },   // 0x22 '"'
+  {    19,  21,  22,  26,    2,  -21 },   // 0x23 '#'
+  {    77,  15,  29,  20,    2,  -23 },   // 0x24 '$'
+  {   132,  26,  23,  29,    2,  -22 },   // 0x25 '%'
+  {   207,  21,  23,  24,    2,  -22 },   // 0x26 '&'
+  {   268,   3,   8,   9,    3,  -22 },   // 0x27 '''
+  {   271,   7,  28,  12,    3,  -23 },   // 0x28 '('
+  {   296,   7,  28,  12,    2,  -23 },   // 0x29 ')'
+  {   321,  14,  14,  16,    1,  -22 },   // 0x2A '*'
+  {   346,  19,  19,  26,    3,  -18 },   // 0x2B '+'
+  {   392,   4,   7,  10,    3,   -3 },   // 0x2C ','
+  {   396,   8,   3,  11,    2,   -9 },   // 0x2D '-'
+  {   399,   3,   4,  10,    4,   -3 },   // 0x2E '.'
+  {   401,  10,  25,  10,    0,  -22 },   // 0x2F '/'
+  {   433,  16,  23,  20,    2,  -22 },   // 0x30 '0'
+  {   479,  13,  23,  20,    4,  -22 },   // 0x31 '1'
+  {   517,  14,  23,  20,    2,  -22 },   // 0x32 '2'
+  {   558,  15,  23,  20,    2,  -22 },   // 0x33 '3'
+  {   602,  16,  23,  20,    2,  -22 },   // 0x34 '4'
+  {   648,  15,  23,  20,    2,  -22 },   // 0x35 '5'
+  {   692,  16,  23,  20,    2,  -22 },   // 0x36 '6'
+  {   738,  15,  23,  20,    2,  -22 },   // 0x37 '7'
+  {   782,  16,  23,  20,    2,  -22 },   // 0x38 '8'
+  {   828,  16,  23,  20,    2,  -22 },   // 0x39 '9'
+  {   874,   3,  16,  10,    4,  -15 },   // 0x3A ':'
+  {   880,   4,  19,  10,    3,  -15 },   // 0x3B ';'
+  {   890,  19,  17,  26,    3,  -17 },   // 0x3C '<'
+  {   931,  19,  10,  26,    3,  -14 },   // 0x3D '='
+  {   955,  19,  17,  26,    3,  -17 },   // 0x3E '>'
+  {   996,  12,  23,  16,    2,  -22 },   // 0x3F '?'
+  {  1031,  27,  27,  31,    2,  -21 },   // 0x40 '@'
+  {  1123,  21,  23,  21,    0,  -22 },   // 0x41 'A'
+  {  1184,  16,  23,  21,    3,  -22 },   // 0x42 'B'
+  {  1230,  18,  23,  22,    2,  -22 },   // 0x43 'C'
+  {  1282,  19,  23,  24,    3,  -22 },   // 0x44 'D'
+  {  1337,  15,  23,  20,    3,  -22 },   // 0x45 'E'
+  {  1381,  13,  23,  18,    3,  -22 },   // 0x46 'F'
+  {  1419,  20,  23,  24,    2,  -22 },   // 0x47 'G'
+  {  1477,  17,  23,  23,    3,  -22 },   // 0x48 'H'
+  {  1526,   3,  23,   9,    3,  -22 },   // 0x49 'I'
+  {  1535,   8,  29,   9,   -2,  -22 },   // 0x4A 'J'
+  {  1564,  18,  23,  20,    3,  -22 },   // 0x4B 'K'
+  {  1616,  14,  23,  17,    3,  -22 },   // 0x4C 'L'
+  {  1657,  21,  23,  27,    3,  -22 },   // 0x4D 'M'
+  {  1718,  17,  23,  23,    3,  -22 },   // 0x4E 'N'
+  {  1767,  21,  23,  24,    2,  -22 },   // 0x4F 'O'
+  {  1828,  15,  23,  19,    3,  -22 },   // 0x50 'P'
+  {  1872,  21,  27,  24,    2,  -22 },   // 0x51 'Q'
+  {  1943,  18,  23,  22,    3,  -22 },   // 0x52 'R'
+  {  1995,  16,  23,  20,    2,  -22 },   // 0x53 'S'
+  {  2041,  19,  23,  19,    0,  -22 },   // 0x54 'T'
+  {  2096,  17,  23,  23,    3,  -22 },   // 0x55 'U'
+  {  2145,  21,  23,  21,    0,  -22 },   // 0x56 'V'
+  {  2206,  29,  23,  31,    1,  -22 },   // 0x57 'W'
+  {  2290,  19,  23,  21,    1,  -22 },   // 0x58 'X'
+  {  2345,  19,  23,  19,    0,  -22 },   // 0x59 'Y'
+  {  2400,  18,  23,  21,    1,  -22 },   // 0x5A 'Z'
+  {  2452,   7,  28,  12,    3,  -23 },   // 0x5B '['
+  {  2477,  10,  25,  10,    0,  -22 },   // 0x5C '\'
+  {  2509,   7,  28,  12,    3,  -23 },   // 0x5D ']'
+  {  2534,  19,   8,  26,    3,  -22 },   // 0x5E '^'
+  {  2553,  16,   3,  16,    0,    5 },   // 0x5F '_'
+  {  2559,   7,   6,  16,    3,  -24 },   // 0x60 '`'
+  {  2565,  14,  17,  19,    2,  -16 },   // 0x61 'a'
+  {  2595,  15,  24,  20,    3,  -23 },   // 0x62 'b'
+  {  2640,  13,  17,  17,    2,  -16 },   // 0x63 'c'
+  {  2668,  15,  24,  20,    2,  -23 },   // 0x64 'd'
+  {  2713,  16,  17,  19,    2,  -16 },   // 0x65 'e'
+  {  2747,  11,  24,  11,    0,  -23 },   // 0x66 'f'
+  {  2780,  15,  23,  20,    2,  -16 },   // 0x67 'g'
+  {  2824,  14,  24,  20,    3,  -23 },   // 0x68 'h'
+  {  2866,   3,  24,   9,    3,  -23 },   // 0x69 'i'
+  {  2875,   6,  30,   9,    0,  -23 },   // 0x6A 'j'
+  {  2898,  15,  24,  18,    3,  -23 },   // 0x6B 'k'
+  {  2943,   3,  24,   9,    3,  -23 },   // 0x6C 'l'
+  {  2952,  25,  17,  30,    3,  -16 },   // 0x6D 'm'
+  {  3006,  14,  17,  20,    3,  -16 },   // 0x6E 'n'
+  {  3036,  16,  17,  19,    2,  -16 },   // 0x6F 'o'
+  {  3070,  15,  23,  20,    3,  -16 },   // 0x70 'p'
+  {  3114,  15,  23,  20,    2,  -16 },   // 0x71 'q'
+  {  3158,  10,  17,  13,    3,  -16 },   // 0x72 'r'
+  {  3180,  13,  17,  16,    2,  -16 },   // 0x73 's'
+  {  3208,  11,  22,  12,    1,  -21 },   // 0x74 't'
+  {  3239,  14,  17,  20,    3,  -16 },   // 0x75 'u'
+  {  3269,  17,  17,  18,    1,  -16 },   // 0x76 'v'
+  {  3306,  23,  17,  25,    1,  -16 },   // 0x77 'w'
+  {  3355,  16,  17,  18,    1,  -16 },   // 0x78 'x'
+  {  3389,  17,  23,  18,    1,  -16 },   // 0x79 'y'
+  {  3438,  14,  17,  16,    1,  -16 },   // 0x7A 'z'
+  {  3468,  12,  29,  20,    4,  -23 },   // 0x7B '{'
+  {  3512,   3,  31,  10,    4,  -23 },   // 0x7C '|'
+  {  3524,  12,  29,  20,    4,  -23 },   // 0x7D '}'
+  {  3568,  19,   5,  26,    3,  -11 },   // 0x7E '~'
+  {  3580,  16,  27,  19,    2,  -21 },   // 0x7F
+  {  3634,  16,  27,  19,    2,  -21 },   // 0x80
+  {  3688,  16,  27,  19,    2,  -21 },   // 0x81
+  {  3742,  16,  27,  19,    2,  -21 },   // 0x82
+  {  3796,  16,  27,  19,    2,  -21 },   // 0x83
+  {  3850,  16,  27,  19,    2,  -21 },   // 0x84
+  {  3904,  16,  27,  19,    2,  -21 },   // 0x85
+  {  3958,  16,  27,  19,    2,  -21 },   // 0x86
+  {  4012,  16,  27,  19,    2,  -21 },   // 0x87
+  {  4066,  16,  27,  19,    2,  -21 },   // 0x88
+  {  4120,  16,  27,  19,    2,  -21 },   // 0x89
+  {  4174,  16,  27,  19,    2,  -21 },   // 0x8A
+  {  4228,  16,  27,  19,    2,  -21 },   // 0x8B
+  {  4282,  16,  27,  19,    2,  -21 },   // 0x8C
+  {  4336,  16,  27,  19,    2,  -21 },   // 0x8D
+  {  4390,  16,  27,  19,    2,  -21 },   // 0x8E
+  {  4444,  16,  27,  19,    2,  -21 },   // 0x8F
+  {  4498,  16,  27,  19,    2,  -21 },   // 0x90
+  {  4552,  16,  27,  19,    2,  -21 },   // 0x91
+  {  4606,  16,  27,  19,    2,  -21 },   // 0x92
+  {  4660,  16,  27,  19,    2,  -21 },   // 0x93
+  {  4714,  16,  27,  19,    2,  -21 },   // 0x94
+  {  4768,  16,  27,  19,    2,  -21 },   // 0x95
+  {  4822,  16,  27,  19,    2,  -21 },   // 0x96
+  {  4876,  16,  27,  19,    2,  -21 },   // 0x97
+  {  4930,  16,  27,  19,    2,  -21 },   // 0x98
+  {  4984,  16,  27,  19,    2,  -21 },   // 0x99
+  {  5038,  16,  27,  19,    2,  -21 },   // 0x9A
+  {  5092,  16,  27,  19,    2,  -21 },   // 0x9B
+  {  5146,  16,  27,  19,    2,  -21 },   // 0x9C
+  {  5200,  16,  27,  19,    2,  -21 },   // 0x9D
+  {  5254,  16,  27,  19,    2,  -21 },   // 0x9E
+  {  5308,  16,  27,  19,    2,  -21 },   // 0x9F
+  {  5362,   1,   1,  10,    0,    0 },   // 0xA0
+  {  5363,   3,  23,  12,    5,  -16 },   // 0xA1
+  {  5372,  13,  25,  20,    3,  -20 },   // 0xA2
+  {  5413,  15,  23,  20,    2,  -22 },   // 0xA3
+  {  5457,  17,  17,  20,    1,  -17 },   // 0xA4
+  {  5494,  17,  23,  20,    1,  -22 },   // 0xA5
+  {  5543,   3,  26,  10,    4,  -20 },   // 0xA6
+  {  5553,  13,  26,  16,    1,  -22 },   // 0xA7
+  {  5596,   9,   3,  16,    3,  -23 },   // 0xA8
+  {  5600,  22,  22,  31,    4,  -21 },   // 0xA9
+  {  5661,  12,  16,  15,    2,  -22 },   // 0xAA
+  {  5685,  13,  14,  19,    2,  -15 },   // 0xAB
+  {  5708,  19,   9,  26,    3,  -12 },   // 0xAC
+  {  5730,   8,   3,  11,    2,   -9 },   // 0xAD
+  {  5733,  22,  22,  31,    4,  -21 },   // 0xAE
+  {  5794,   9,   3,  16,    3,  -22 },   // 0xAF
+  {  5798,  10,  10,  16,    3,  -22 },   // 0xB0
+  {  5811,  19,  20,  26,    4,  -19 },   // 0xB1
+  {  5859,   9,  13,  12,    1,  -22 },   // 0xB2
+  {  5874,   9,  13,  12,    1,  -22 },   // 0xB3
+  {  5889,   7,   6,  16,    6,  -24 },   // 0xB4
+  {  5895,  16,  23,  20,    3,  -16 },   // 0xB5
+  {  5941,  14,  26,  20,    2,  -22 },   // 0xB6
+  {  5987,   3,   4,  10,    3,  -12 },   // 0xB7
+  {  5989,   6,   6,  16,    4,    1 },   // 0xB8
+  {  5994,   8,  13,  12,    2,  -22 },   // 0xB9
+  {  6007,  12,  16,  15,    1,  -22 },   // 0xBA
+  {  6031,  13,  14,  19,    3,  -15 },   // 0xBB
+  {  6054,  27,  23,  30,    2,  -22 },   // 0xBC
+  {  6132,  26,  23,  30,    2,  -22 },   // 0xBD
+  {  6207,  28,  23,  30,    1,  -22 },   // 0xBE
+  {  6288,  12,  23,  16,    2,  -16 },   // 0xBF
+  {  6323,  21,  29,  21,    0,  -28 },   // 0xC0
+  {  6400,  21,  29,  21,    0,  -28 },   // 0xC1
+  {  6477,  21,  29,  21,    0,  -28 },   // 0xC2
+  {  6554,  21,  30,  21,    0,  -29 },   // 0xC3
+  {  6633,  21,  29,  21,    0,  -28 },   // 0xC4
+  {  6710,  21,  29,  21,    0,  -28 },   // 0xC5
+  {  6787,  29,  23,  30,    0,  -22 },   // 0xC6
+  {  6871,  18,  29,  22,    2,  -22 },   // 0xC7
+  {  6937,  15,  29,  20,    3,  -28 },   // 0xC8
+  {  6992,  15,  29,  20,    3,  -28 },   // 0xC9
+  {  7047,  15,  29,  20,    3,  -28 },   // 0xCA
+  {  7102,  15,  29,  20,    3,  -28 },   // 0xCB
+  {  7157,   6,  29,   9,    1,  -28 },   // 0xCC
+  {  7179,   6,  29,   9,    2,  -28 },   // 0xCD
+  {  7201,   9,  29,   9,    0,  -28 },   // 0xCE
+  {  7234,   9,  29,   9,    0,  -28 },   // 0xCF
+  {  7267,  22,  23,  24,    0,  -22 },   // 0xD0
+  {  7331,  17,  30,  23,    3,  -29 },   // 0xD1
+  {  7395,  21,  29,  24,    2,  -28 },   // 0xD2
+  {  7472,  21,  29,  24,    2,  -28 },   // 0xD3
+  {  7549,  21,  29,  24,    2,  -28 },   // 0xD4
+  {  7626,  21,  30,  24,    2,  -29 },   // 0xD5
+  {  7705,  21,  29,  24,    2,  -28 },   // 0xD6
+  {  7782,  17,  18,  26,    4,  -17 },   // 0xD7
+  {  7821,  21,  25,  24,    2,  -23 },   // 0xD8
+  {  7887,  17,  29,  23,    3,  -28 },   // 0xD9
+  {  7949,  17,  29,  23,    3,  -28 },   // 0xDA
+  {  8011,  17,  29,  23,    3,  -28 },   // 0xDB
+  {  8073,  17,  29,  23,    3,  -28 },   // 0xDC
+  {  8135,  19,  29,  19,    0,  -28 },   // 0xDD
+  {  8204,  15,  23,  19,    3,  -22 },   // 0xDE
+  {  8248,  15,  24,  20,    3,  -23 },   // 0xDF
+  {  8293,  14,  25,  19,    2,  -24 },   // 0xE0
+  {  8337,  14,  25,  19,    2,  -24 },   // 0xE1
+  {  8381,  14,  25,  19,    2,  -24 },   // 0xE2
+  {  8425,  14,  24,  19,    2,  -23 },   // 0xE3
+  {  8467,  14,  24,  19,    2,  -23 },   // 0xE4
+  {  8509,  14,  27,  19,    2,  -26 },   // 0xE5
+  {  8557,  26,  17,  30,    2,  -16 },   // 0xE6
+  {  8613,  13,  23,  17,    2,  -16 },   // 0xE7
+  {  8651,  16,  25,  19,    2,  -24 },   // 0xE8
+  {  8701,  16,  25,  19,    2,  -24 },   // 0xE9
+  {  8751,  16,  25,  19,    2,  -24 },   // 0xEA
+  {  8801,  16,  24,  19,    2,  -23 },   // 0xEB
+  {  8849,   7,  25,   9,    0,  -24 },   // 0xEC
+  {  8871,   7,  25,   9,    3,  -24 },   // 0xED
+  {  8893,  11,  25,   9,   -1,  -24 },   // 0xEE
+  {  8928,   9,  24,   9,    0,  -23 },   // 0xEF
+  {  8955,  16,  24,  19,    2,  -23 },   // 0xF0
+  {  9003,  14,  24,  20,    3,  -23 },   // 0xF1
+  {  9045,  16,  25,  19,    2,  -24 },   // 0xF2
+  {  9095,  16,  25,  19,    2,  -24 },   // 0xF3
+  {  9145,  16,  25,  19,    2,  -24 },   // 0xF4
+  {  9195,  16,  24,  19,    2,  -23 },   // 0xF5
+  {  9243,  16,  24,  19,    2,  -23 },   // 0xF6
+  {  9291,  20,  15,  26,    3,  -16 },   // 0xF7
+  {  9329,  18,  19,  19,    1,  -17 },   // 0xF8
+  {  9372,  14,  25,  20,    3,  -24 },   // 0xF9
+  {  9416,  14,  25,  20,    3,  -24 },   // 0xFA
+  {  9460,  14,  25,  20,    3,  -24 },   // 0xFB
+  {  9504,  14,  24,  20,    3,  -23 },   // 0xFC
+  {  9546,  17,  31,  18,    1,  -24 },   // 0xFD
+  {  9612,  15,  30,  20,    3,  -23 },   // 0xFE
+  {  9669,  17,  30,  18,    1,  -23 } }; // 0xFF
+
+const GFXfont DejaVuSans16pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans16pt8bBitmaps,
+  (GFXglyph *)DejaVuSans16pt8bGlyphs,
+  0x20, 0xFF, 36 };
+
+// Approx. 11308 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans16pt8bMetrics[] PROGMEM = {
+  {   0,  10,   1 },   // 0x20
+  {   5,  12,   8 },   // 0x21
+  {   3,  14,  12 },   // 0x22
+  {   2,  26,  23 },   // 0x23
+  {   2,  20,  17 },   // 0x24
+  {   2,  29,  28 },   // 0x25
+  {   2,  24,  23 },   // 0x26
+  {   3,   9,   6 },   // 0x27
+  {   3,  12,  10 },   // 0x28
+  {   2,  12,   9 },   // 0x29
+  {   1,  16,  15 },   // 0x2A
+  {   3,  26,  22 },   // 0x2B
+  {   3,  10,   7 },   // 0x2C
+  {   2,  11,  10 },   // 0x2D
+  {   4,  10,   7 },   // 0x2E
+  {   0,  10,  10 },   // 0x2F
+  {   2,  20,  18 },   // 0x30
+  {   4,  20,  17 },   // 0x31
+  {   2,  20,  16 },   // 0x32
+  {   2,  20,  17 },   // 0x33
+  {   2,  20,  18 },   // 0x34
+  {   2,  20,  17 },   // 0x35
+  {   2,  20,  18 },   // 0x36
+  {   2,  20,  17 },   // 0x37
+  {   2,  20,  18 },   // 0x38
+  {   2,  20,  18 },   // 0x39
+  {   4,  10,   7 },   // 0x3A
+  {   3,  10,   7 },   // 0x3B
+  {   3,  26,  22 },   // 0x3C
+  {   3,  26,  22 },   // 0x3D
+  {   3,  26,  22 },   // 0x3E
+  {   2,  16,  14 },   // 0x3F
+  {   2,  31,  29 },   // 0x40
+  {   0,  21,  21 },   // 0x41
+  {   3,  21,  19 },   // 0x42
+  {   2,  22,  20 },   // 0x43
+  {   3,  24,  22 },   // 0x44
+  {   3,  20,  18 },   // 0x45
+  {   3,  18,  16 },   // 0x46
+  {   2,  24,  22 },   // 0x47
+  {   3,  23,  20 },   // 0x48
+  {   3,   9,   6 },   // 0x49
+  {  -2,   9,   6 },   // 0x4A
+  {   3,  20,  21 },   // 0x4B
+  {   3,  17,  17 },   // 0x4C
+  {   3,  27,  24 },   // 0x4D
+  {   3,  23,  20 },   // 0x4E
+  {   2,  24,  23 },   // 0x4F
+  {   3,  19,  18 },   // 0x50
+  {   2,  24,  23 },   // 0x51
+  {   3,  22,  21 },   // 0x52
+  {   2,  20,  18 },   // 0x53
+  {   0,  19,  19 },   // 0x54
+  {   3,  23,  20 },   // 0x55
+  {   0,  21,  21 },   // 0x56
+  {   1,  31,  30 },   // 0x57
+  {   1,  21,  20 },   // 0x58
+  {   0,  19,  19 },   // 0x59
+  {   1,  21,  19 },   // 0x5A
+  {   3,  12,  10 },   // 0x5B
+  {   0,  10,  10 },   // 0x5C
+  {   3,  12,  10 },   // 0x5D
+  {   3,  26,  22 },   // 0x5E
+  {   0,  16,  16 },   // 0x5F
+  {   3,  16,  10 },   // 0x60
+  {   2,  19,  16 },   // 0x61
+  {   3,  20,  18 },   // 0x62
+  {   2,  17,  15 },   // 0x63
+  {   2,  20,  17 },   // 0x64
+  {   2,  19,  18 },   // 0x65
+  {   0,  11,  11 },   // 0x66
+  {   2,  20,  17 },   // 0x67
+  {   3,  20,  17 },   // 0x68
+  {   3,   9,   6 },   // 0x69
+  {   0,   9,   6 },   // 0x6A
+  {   3,  18,  18 },   // 0x6B
+  {   3,   9,   6 },   // 0x6C
+  {   3,  30,  28 },   // 0x6D
+  {   3,  20,  17 },   // 0x6E
+  {   2,  19,  18 },   // 0x6F
+  {   3,  20,  18 },   // 0x70
+  {   2,  20,  17 },   // 0x71
+  {   3,  13,  13 },   // 0x72
+  {   2,  16,  15 },   // 0x73
+  {   1,  12,  12 },   // 0x74
+  {   3,  20,  17 },   // 0x75
+  {   1,  18,  18 },   // 0x76
+  {   1,  25,  24 },   // 0x77
+  {   1,  18,  17 },   // 0x78
+  {   1,  18,  18 },   // 0x79
+  {   1,  16,  15 },   // 0x7A
+  {   4,  20,  16 },   // 0x7B
+  {   4,  10,   7 },   // 0x7C
+  {   4,  20,  16 },   // 0x7D
+  {   3,  26,  22 },   // 0x7E
+  {   2,  19,  18 },   // 0x7F
+  {   2,  19,  18 },   // 0x80
+  {   2,  19,  18 },   // 0x81
+  {   2,  19,  18 },   // 0x82
+  {   2,  19,  18 },   // 0x83
+  {   2,  19,  18 },   // 0x84
+  {   2,  19,  18 },   // 0x85
+  {   2,  19,  18 },   // 0x86
+  {   2,  19,  18 },   // 0x87
+  {   2,  19,  18 },   // 0x88
+  {   2,  19,  18 },   // 0x89
+  {   2,  19,  18 },   // 0x8A
+  {   2,  19,  18 },   // 0x8B
+  {   2,  19,  18 },   // 0x8C
+  {   2,  19,  18 },   // 0x8D
+  {   2,  19,  18 },   // 0x8E
+  {   2,  19,  18 },   // 0x8F
+  {   2,  19,  18 },   // 0x90
+  {   2,  19,  18 },   // 0x91
+  {   2,  19,  18 },   // 0x92
+  {   2,  19,  18 },   // 0x93
+  {   2,  19,  18 },   // 0x94
+  {   2,  19,  18 },   // 0x95
+  {   2,  19,  18 },   // 0x96
+  {   2,  19,  18 },   // 0x97
+  {   2,  19,  18 },   // 0x98
+  {   2,  19,  18 },   // 0x99
+  {   2,  19,  18 },   // 0x9A
+  {   2,  19,  18 },   // 0x9B
+  {   2,  19,  18 },   // 0x9C
+  {   2,  19,  18 },   // 0x9D
+  {   2,  19,  18 },   // 0x9E
+  {   2,  19,  18 },   // 0x9F
+  {   0,  10,   1 },   // 0xA0
+  {   5,  12,   8 },   // 0xA1
+  {   3,  20,  16 },   // 0xA2
+  {   2,  20,  17 },   // 0xA3
+  {   1,  20,  18 },   // 0xA4
+  {   1,  20,  18 },   // 0xA5
+  {   4,  10,   7 },   // 0xA6
+  {   1,  16,  14 },   // 0xA7
+  {   3,  16,  12 },   // 0xA8
+  {   4,  31,  26 },   // 0xA9
+  {   2,  15,  14 },   // 0xAA
+  {   2,  19,  15 },   // 0xAB
+  {   3,  26,  22 },   // 0xAC
+  {   2,  11,  10 },   // 0xAD
+  {   4,  31,  26 },   // 0xAE
+  {   3,  16,  12 },   // 0xAF
+  {   3,  16,  13 },   // 0xB0
+  {   4,  26,  23 },   // 0xB1
+  {   1,  12,  10 },   // 0xB2
+  {   1,  12,  10 },   // 0xB3
+  {   6,  16,  13 },   // 0xB4
+  {   3,  20,  19 },   // 0xB5
+  {   2,  20,  16 },   // 0xB6
+  {   3,  10,   6 },   // 0xB7
+  {   4,  16,  10 },   // 0xB8
+  {   2,  12,  10 },   // 0xB9
+  {   1,  15,  13 },   // 0xBA
+  {   3,  19,  16 },   // 0xBB
+  {   2,  30,  29 },   // 0xBC
+  {   2,  30,  28 },   // 0xBD
+  {   1,  30,  29 },   // 0xBE
+  {   2,  16,  14 },   // 0xBF
+  {   0,  21,  21 },   // 0xC0
+  {   0,  21,  21 },   // 0xC1
+  {   0,  21,  21 },   // 0xC2
+  {   0,  21,  21 },   // 0xC3
+  {   0,  21,  21 },   // 0xC4
+  {   0,  21,  21 },   // 0xC5
+  {   0,  30,  29 },   // 0xC6
+  {   2,  22,  20 },   // 0xC7
+  {   3,  20,  18 },   // 0xC8
+  {   3,  20,  18 },   // 0xC9
+  {   3,  20,  18 },   // 0xCA
+  {   3,  20,  18 },   // 0xCB
+  {   1,   9,   7 },   // 0xCC
+  {   2,   9,   8 },   // 0xCD
+  {   0,   9,   9 },   // 0xCE
+  {   0,   9,   9 },   // 0xCF
+  {   0,  24,  22 },   // 0xD0
+  {   3,  23,  20 },   // 0xD1
+  {   2,  24,  23 },   // 0xD2
+  {   2,  24,  23 },   // 0xD3
+  {   2,  24,  23 },   // 0xD4
+  {   2,  24,  23 },   // 0xD5
+  {   2,  24,  23 },   // 0xD6
+  {   4,  26,  21 },   // 0xD7
+  {   2,  24,  23 },   // 0xD8
+  {   3,  23,  20 },   // 0xD9
+  {   3,  23,  20 },   // 0xDA
+  {   3,  23,  20 },   // 0xDB
+  {   3,  23,  20 },   // 0xDC
+  {   0,  19,  19 },   // 0xDD
+  {   3,  19,  18 },   // 0xDE
+  {   3,  20,  18 },   // 0xDF
+  {   2,  19,  16 },   // 0xE0
+  {   2,  19,  16 },   // 0xE1
+  {   2,  19,  16 },   // 0xE2
+  {   2,  19,  16 },   // 0xE3
+  {   2,  19,  16 },   // 0xE4
+  {   2,  19,  16 },   // 0xE5
+  {   2,  30,  28 },   // 0xE6
+  {   2,  17,  15 },   // 0xE7
+  {   2,  19,  18 },   // 0xE8
+  {   2,  19,  18 },   // 0xE9
+  {   2,  19,  18 },   // 0xEA
+  {   2,  19,  18 },   // 0xEB
+  {   0,   9,   7 },   // 0xEC
+  {   3,   9,  10 },   // 0xED
+  {  -1,   9,  10 },   // 0xEE
+  {   0,   9,   9 },   // 0xEF
+  {   2,  19,  18 },   // 0xF0
+  {   3,  20,  17 },   // 0xF1
+  {   2,  19,  18 },   // 0xF2
+  {   2,  19,  18 },   // 0xF3
+  {   2,  19,  18 },   // 0xF4
+  {   2,  19,  18 },   // 0xF5
+  {   2,  19,  18 },   // 0xF6
+  {   3,  26,  23 },   // 0xF7
+  {   1,  19,  19 },   // 0xF8
+  {   3,  20,  17 },   // 0xF9
+  {   3,  20,  17 },   // 0xFA
+  {   3,  20,  17 },   // 0xFB
+  {   3,  20,  17 },   // 0xFC
+  {   1,  18,  18 },   // 0xFD
+  {   3,  20,  18 },   // 0xFE
+  {   1,  18,  18 }    // 0xFF
+};
+const FontMetrics DejaVuSans16pt8bWidths = { DejaVuSans16pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS16PTLAT1__H
@@ -0,0 +1,1496 @@
+#ifndef DEJAVUSANS18PTLAT1__H
+#define DEJAVUSANS18PTLAT1__H
+const uint8_t DejaVuSans18pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0xE1,
+  0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xC0, 0x00,
+  0x38, 0x30, 0x00, 0x30, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70, 0x00,
+  0x70, 0xE0, 0x00, 0x60, 0xE0, 0x00, 0xE0, 0xE0, 0x3F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x01, 0xC1, 0xC0, 0x01, 0xC1, 0xC0, 0x01,
+  0xC1, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07,
+  0x06, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E,
+  0x0C, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0xFF,
+  0x81, 0xFF, 0xF1, 0xFF, 0xF8, 0xF3, 0x0C, 0xF1, 0x80, 0x70, 0xC0, 0x38,
+  0x60, 0x1C, 0x30, 0x0F, 0x18, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x01, 0xFF, 0x00, 0xC7, 0x80, 0x61, 0xE0, 0x30, 0x70, 0x18, 0x38, 0x0C,
+  0x1E, 0x06, 0x1F, 0xC3, 0x3E, 0xFF, 0xFE, 0x3F, 0xFE, 0x03, 0xFC, 0x00,
+  0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x1F, 0x80,
+  0x06, 0x01, 0xFE, 0x00, 0x70, 0x1E, 0x78, 0x03, 0x00, 0xE1, 0xC0, 0x30,
+  0x0E, 0x07, 0x03, 0x80, 0x70, 0x38, 0x18, 0x03, 0x81, 0xC1, 0xC0, 0x1C,
+  0x0E, 0x0C, 0x00, 0xE0, 0x70, 0xC0, 0x07, 0x03, 0x8E, 0x00, 0x1C, 0x38,
+  0x60, 0x00, 0xF3, 0xC7, 0x00, 0x03, 0xFC, 0x30, 0xFC, 0x0F, 0xC3, 0x0F,
+  0xF0, 0x00, 0x38, 0xF3, 0xC0, 0x01, 0x87, 0x0E, 0x00, 0x1C, 0x70, 0x38,
+  0x00, 0xC3, 0x81, 0xC0, 0x0C, 0x1C, 0x0E, 0x00, 0xE0, 0xE0, 0x70, 0x06,
+  0x07, 0x03, 0x80, 0x70, 0x38, 0x1C, 0x03, 0x00, 0xE1, 0xC0, 0x30, 0x07,
+  0x9E, 0x03, 0x80, 0x1F, 0xE0, 0x18, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
+  0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0x03, 0x00, 0x1E, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0xE0, 0x0E,
+  0x78, 0xF0, 0x0E, 0x70, 0x78, 0x1E, 0xF0, 0x3C, 0x1C, 0xE0, 0x1F, 0x1C,
+  0xE0, 0x0F, 0xB8, 0xE0, 0x07, 0xF8, 0xE0, 0x03, 0xF0, 0xF0, 0x01, 0xF0,
+  0x78, 0x03, 0xF0, 0x3E, 0x0F, 0xF8, 0x3F, 0xFF, 0x7C, 0x0F, 0xFE, 0x3E,
+  0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x0E, 0x1E, 0x1C, 0x18,
+  0x38, 0x38, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0x60, 0x70, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x1C,
+  0x0E, 0x07, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0x70, 0xE0, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x41, 0x82, 0xF1, 0x8F, 0x39, 0x9C, 0x1F, 0xF8, 0x07,
+  0xE0, 0x07, 0xE0, 0x1F, 0xF0, 0x39, 0x9C, 0xF1, 0x8F, 0x41, 0x82, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x77, 0x77, 0x6E, 0xEC, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x70,
+  0x0F, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80,
+  0x38, 0x03, 0x80, 0x78, 0x07, 0x00, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x07,
+  0x00, 0x70, 0x0F, 0x00, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF,
+  0xE0, 0xF8, 0x7C, 0x38, 0x07, 0x1E, 0x01, 0xE7, 0x00, 0x39, 0xC0, 0x0E,
+  0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x77, 0x00,
+  0x39, 0xC0, 0x0E, 0x78, 0x07, 0x8E, 0x01, 0xC3, 0xE1, 0xF0, 0x7F, 0xF8,
+  0x0F, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC,
+  0xF0, 0x3E, 0x80, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE0,
+  0x3F, 0xFC, 0x1F, 0xFF, 0x0C, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x81, 0xFF, 0x80,
+  0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x7C, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3B, 0x00, 0x7D, 0xFF,
+  0xFC, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x01,
+  0xF8, 0x00, 0x77, 0x00, 0x0E, 0xE0, 0x03, 0x9C, 0x00, 0xE3, 0x80, 0x1C,
+  0x70, 0x07, 0x0E, 0x00, 0xE1, 0xC0, 0x38, 0x38, 0x0E, 0x07, 0x01, 0xC0,
+  0xE0, 0x70, 0x1C, 0x1C, 0x03, 0x83, 0x80, 0x70, 0xE0, 0x0E, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x7F, 0xFE, 0x3F, 0xFF,
+  0x1F, 0xFF, 0x8E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC6, 0x03, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x7B, 0x00, 0xFD, 0xFF, 0xFC, 0xFF,
+  0xF8, 0x1F, 0xF0, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x7C,
+  0x0C, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0xF0, 0x00,
+  0x38, 0xFE, 0x0E, 0x7F, 0xE3, 0xBF, 0xFC, 0xFE, 0x0F, 0xBE, 0x00, 0xEF,
+  0x80, 0x3F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x77, 0x00, 0x1D, 0xC0,
+  0x07, 0x78, 0x03, 0xCE, 0x00, 0xE3, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE,
+  0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01,
+  0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x03,
+  0xFF, 0xF0, 0xF0, 0x3C, 0x78, 0x07, 0x9C, 0x00, 0xE7, 0x00, 0x39, 0xC0,
+  0x0E, 0x70, 0x03, 0x8E, 0x01, 0xC3, 0xC0, 0xF0, 0x7F, 0xF8, 0x07, 0xF8,
+  0x07, 0xFF, 0x87, 0xC0, 0xF9, 0xC0, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xF7, 0xC0, 0xF8, 0xFF,
+  0xFC, 0x1F, 0xFE, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF,
+  0xE1, 0xF0, 0x7C, 0x70, 0x07, 0x3C, 0x01, 0xEE, 0x00, 0x3B, 0x80, 0x0E,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0x70, 0x07, 0xDF,
+  0x07, 0xF3, 0xFF, 0xDC, 0x7F, 0xE7, 0x07, 0xF1, 0xC0, 0x00, 0xF0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0xC3, 0x03, 0xE0, 0xFF, 0xF0,
+  0x3F, 0xF8, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+  0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x6E, 0xEC, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+  0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF0,
+  0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x1F, 0xC1, 0xFF, 0xCF, 0xFF, 0xBC, 0x1E, 0x80, 0x3C, 0x00, 0x70,
+  0x01, 0xC0, 0x07, 0x00, 0x78, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0,
+  0x3C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
+  0x80, 0x7E, 0x00, 0x7C, 0x00, 0x3E, 0x01, 0xE0, 0x00, 0x1E, 0x07, 0x80,
+  0x00, 0x1E, 0x1E, 0x00, 0x00, 0x1E, 0x38, 0x0F, 0x8E, 0x1C, 0xF0, 0x7F,
+  0xDC, 0x39, 0xC1, 0xFF, 0xF8, 0x3F, 0x83, 0xC1, 0xF0, 0x7E, 0x0F, 0x01,
+  0xE0, 0xFC, 0x1C, 0x01, 0xC1, 0xF8, 0x38, 0x03, 0x83, 0xF0, 0x70, 0x07,
+  0x07, 0xE0, 0xE0, 0x0E, 0x1F, 0xC1, 0xC0, 0x1C, 0x3B, 0x83, 0xC0, 0x78,
+  0xF7, 0x83, 0xC1, 0xF3, 0xC7, 0x07, 0xFF, 0xFF, 0x0E, 0x07, 0xFD, 0xF8,
+  0x0E, 0x03, 0xE3, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  0x1E, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x0E, 0x00, 0x1F, 0x80, 0xFC, 0x00,
+  0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x1D, 0xC0, 0x00, 0x71, 0xC0, 0x00, 0xE3, 0x80, 0x03,
+  0xC7, 0x80, 0x07, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x3C, 0x1E, 0x00, 0x70,
+  0x1C, 0x00, 0xE0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x00, 0x70, 0x1E, 0x00,
+  0xF0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xC3, 0x80, 0x03,
+  0x87, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0x70, 0x00, 0x1D,
+  0xC0, 0x00, 0x1C, 0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0x80, 0x3C,
+  0xE0, 0x07, 0xB8, 0x00, 0xEE, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x03, 0xB8,
+  0x01, 0xEE, 0x00, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC, 0x3F, 0xFF, 0xCE, 0x00,
+  0xFB, 0x80, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0xFB, 0xFF, 0xFC, 0xFF, 0xFE, 0x3F,
+  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0x01,
+  0xF3, 0xE0, 0x01, 0x9E, 0x00, 0x05, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x9F, 0x00, 0x0C,
+  0x7E, 0x03, 0xE1, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
+  0xF0, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xE1, 0xC0, 0x1F, 0x8E, 0x00, 0x3E,
+  0x70, 0x00, 0x73, 0x80, 0x03, 0xDC, 0x00, 0x0E, 0xE0, 0x00, 0x7F, 0x00,
+  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
+  0x1D, 0xC0, 0x01, 0xEE, 0x00, 0x0E, 0x70, 0x01, 0xF3, 0x80, 0x3F, 0x1F,
+  0xFF, 0xF0, 0xFF, 0xFE, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0xFF, 0xEF, 0xFF,
+  0xDF, 0xFF, 0xB8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0x87, 0xE0, 0x3E,
+  0x3E, 0x00, 0x18, 0xE0, 0x00, 0x27, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x70,
+  0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x07,
+  0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1D,
+  0xC0, 0x00, 0x77, 0x00, 0x01, 0xDE, 0x00, 0x07, 0x38, 0x00, 0x1C, 0xF8,
+  0x00, 0x71, 0xF8, 0x07, 0xC3, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x03, 0xFE,
+  0x00, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00,
+  0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
+  0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
+  0xFC, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x0E, 0x1E, 0xFE, 0xFC, 0xF0, 0xE0, 0x03,
+  0xCE, 0x00, 0x78, 0xE0, 0x0F, 0x0E, 0x01, 0xE0, 0xE0, 0x3C, 0x0E, 0x07,
+  0x80, 0xE0, 0xF0, 0x0E, 0x1E, 0x00, 0xE3, 0xC0, 0x0E, 0x78, 0x00, 0xEF,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xEF, 0x80, 0x0E,
+  0x7C, 0x00, 0xE3, 0xE0, 0x0E, 0x1F, 0x00, 0xE0, 0xF8, 0x0E, 0x07, 0xC0,
+  0xE0, 0x3E, 0x0E, 0x01, 0xF0, 0xE0, 0x0F, 0x8E, 0x00, 0x7C, 0xE0, 0x03,
+  0xEE, 0x00, 0x1F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00,
+  0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x0F, 0xFD, 0xC0, 0x1D,
+  0xFB, 0x80, 0x3B, 0xF3, 0x80, 0xE7, 0xE7, 0x01, 0xCF, 0xCF, 0x07, 0x9F,
+  0x8E, 0x0E, 0x3F, 0x1C, 0x1C, 0x7E, 0x1C, 0x70, 0xFC, 0x38, 0xE1, 0xF8,
+  0x71, 0xC3, 0xF0, 0x77, 0x07, 0xE0, 0xEE, 0x0F, 0xC1, 0xFC, 0x1F, 0x81,
+  0xF0, 0x3F, 0x03, 0xE0, 0x7E, 0x03, 0x80, 0xFC, 0x00, 0x01, 0xF8, 0x00,
+  0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1C, 0xF8, 0x00,
+  0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x0F, 0xDC, 0x01,
+  0xFB, 0xC0, 0x3F, 0x38, 0x07, 0xE7, 0x80, 0xFC, 0x70, 0x1F, 0x8F, 0x03,
+  0xF0, 0xE0, 0x7E, 0x0E, 0x0F, 0xC1, 0xC1, 0xF8, 0x1C, 0x3F, 0x03, 0xC7,
+  0xE0, 0x38, 0xFC, 0x07, 0x9F, 0x80, 0x73, 0xF0, 0x0F, 0x7E, 0x00, 0xEF,
+  0xC0, 0x1F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7C,
+  0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8,
+  0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E,
+  0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+  0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E,
+  0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC,
+  0xE0, 0x3E, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3E, 0x00,
+  0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x3C, 0x00,
+  0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0xFF, 0xE0, 0x1F, 0xFF, 0x03,
+  0xFF, 0xF8, 0x70, 0x1F, 0x0E, 0x00, 0xF1, 0xC0, 0x0E, 0x38, 0x01, 0xC7,
+  0x00, 0x38, 0xE0, 0x07, 0x1C, 0x00, 0xE3, 0x80, 0x3C, 0x70, 0x0F, 0x0F,
+  0xFF, 0xC1, 0xFF, 0xF0, 0x3F, 0xFE, 0x07, 0x01, 0xE0, 0xE0, 0x1E, 0x1C,
+  0x01, 0xC3, 0x80, 0x3C, 0x70, 0x03, 0x8E, 0x00, 0x79, 0xC0, 0x07, 0x38,
+  0x00, 0xE7, 0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x1C, 0x07, 0xFC, 0x07,
+  0xFF, 0xC3, 0xFF, 0xF1, 0xF0, 0x0C, 0xF0, 0x00, 0x38, 0x00, 0x0E, 0x00,
+  0x03, 0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0x80,
+  0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0xEF, 0x00,
+  0xFB, 0xFF, 0xFC, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00,
+  0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00,
+  0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F,
+  0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F,
+  0x80, 0x03, 0xF8, 0x00, 0xF7, 0x00, 0x1C, 0xF0, 0x07, 0x8F, 0x01, 0xE1,
+  0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0xE0, 0x00, 0x0E, 0xE0, 0x00,
+  0x39, 0xC0, 0x00, 0x73, 0x80, 0x01, 0xE3, 0x80, 0x03, 0x87, 0x00, 0x07,
+  0x0F, 0x00, 0x1E, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x70, 0x3C, 0x01, 0xE0,
+  0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x1C, 0x00, 0xE0, 0x38, 0x01,
+  0xE0, 0xF0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0x80, 0x07, 0x8F, 0x00, 0x07,
+  0x1C, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0xE0, 0x00, 0x1D, 0xC0, 0x00, 0x3F,
+  0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xE0, 0x03,
+  0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x70, 0x07, 0xE0, 0x0E, 0x70, 0x07,
+  0xE0, 0x0E, 0x70, 0x07, 0xE0, 0x0E, 0x70, 0x0F, 0xF0, 0x0E, 0x38, 0x0E,
+  0x70, 0x1C, 0x38, 0x0E, 0x70, 0x1C, 0x38, 0x0E, 0x70, 0x1C, 0x38, 0x1E,
+  0x78, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x1C, 0x1C, 0x38, 0x38, 0x1C, 0x1C,
+  0x38, 0x38, 0x1C, 0x1C, 0x38, 0x38, 0x0E, 0x38, 0x1C, 0x70, 0x0E, 0x38,
+  0x1C, 0x70, 0x0E, 0x38, 0x1C, 0x70, 0x0E, 0x38, 0x1C, 0x70, 0x0F, 0x70,
+  0x0E, 0xE0, 0x07, 0x70, 0x0E, 0xE0, 0x07, 0x70, 0x0E, 0xE0, 0x07, 0x70,
+  0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xE0,
+  0x07, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x78, 0x00, 0x78, 0xF0, 0x03, 0xC1,
+  0xC0, 0x0E, 0x07, 0x80, 0x78, 0x0F, 0x03, 0xC0, 0x1C, 0x0E, 0x00, 0x78,
+  0x78, 0x00, 0xF3, 0xC0, 0x01, 0xCE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0x80, 0x03, 0xCF, 0x00, 0x0E, 0x1C, 0x00, 0x78, 0x78, 0x03, 0xC0,
+  0xF0, 0x0E, 0x01, 0xC0, 0x78, 0x07, 0x83, 0xC0, 0x0F, 0x0E, 0x00, 0x1C,
+  0x78, 0x00, 0x7B, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x7B, 0xC0, 0x07, 0x8E,
+  0x00, 0x38, 0x78, 0x03, 0xC1, 0xE0, 0x3C, 0x07, 0x01, 0xC0, 0x3C, 0x1E,
+  0x00, 0xF1, 0xE0, 0x03, 0x8E, 0x00, 0x1E, 0xF0, 0x00, 0x7F, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00,
+  0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00,
+  0x03, 0x80, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0x00,
+  0x01, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+  0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x01, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+  0x0F, 0xFF, 0xFF, 0x80, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x78, 0x03,
+  0x80, 0x38, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x70, 0x03, 0x80, 0x38, 0x03, 0x80,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0x70,
+  0xFF, 0xFF, 0xF8, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
+  0x00, 0xF3, 0xC0, 0x07, 0x87, 0x80, 0x3C, 0x0F, 0x01, 0xE0, 0x1E, 0x0F,
+  0x00, 0x3C, 0x78, 0x00, 0x7B, 0xC0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xF0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x0F, 0xE0, 0x3F,
+  0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x0F,
+  0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0xE3, 0xF0, 0x77, 0xFE, 0x3F, 0xFF, 0x9F, 0x83,
+  0xCF, 0x80, 0xF7, 0x80, 0x3B, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x3B, 0xE0, 0x3D,
+  0xF8, 0x3C, 0xFF, 0xFE, 0x77, 0xFE, 0x38, 0xFC, 0x00, 0x03, 0xF8, 0x1F,
+  0xFC, 0x7F, 0xF9, 0xF0, 0x37, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E,
+  0x00, 0x1F, 0x03, 0x1F, 0xFE, 0x1F, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x07, 0xE3, 0x8F, 0xFD, 0xCF, 0xFF, 0xE7, 0x83, 0xF7, 0x80,
+  0xFB, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x3D, 0xE0, 0x3E, 0x78, 0x3F,
+  0x3F, 0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0, 0x03, 0xF8, 0x03, 0xFF, 0x81,
+  0xFF, 0xF0, 0xF8, 0x3E, 0x78, 0x03, 0x9C, 0x00, 0xEE, 0x00, 0x1F, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x07, 0x80, 0x08, 0xF8, 0x0E, 0x1F, 0xFF, 0x83, 0xFF, 0xC0,
+  0x3F, 0xC0, 0x03, 0xF0, 0x7F, 0x0F, 0xF1, 0xE0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0xFF, 0xEF, 0xFE, 0xFF, 0xE1, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0x07, 0xE3, 0x8F, 0xFD, 0xCF,
+  0xFF, 0xEF, 0x83, 0xF7, 0x80, 0xFB, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07,
+  0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80,
+  0x3D, 0xE0, 0x3E, 0xF8, 0x3F, 0x3F, 0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0xC0, 0x7C, 0x7F, 0xFC, 0x3F, 0xFC,
+  0x07, 0xF8, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0xF0, 0xEF, 0xFC, 0xFF,
+  0xFE, 0xFC, 0x1E, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x1C, 0x38, 0x70,
+  0x00, 0x00, 0x00, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0xFE,
+  0xF9, 0xE0, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x0F, 0x70, 0x0F, 0x38,
+  0x1F, 0x1C, 0x1F, 0x0E, 0x1F, 0x07, 0x1E, 0x03, 0x9E, 0x01, 0xFE, 0x00,
+  0xFE, 0x00, 0x7F, 0x00, 0x3B, 0xC0, 0x1C, 0xF0, 0x0E, 0x3C, 0x07, 0x0F,
+  0x03, 0x83, 0xC1, 0xC0, 0xF0, 0xE0, 0x3C, 0x70, 0x0F, 0x38, 0x03, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xE3,
+  0xF0, 0x1F, 0x87, 0x7F, 0xE3, 0xFF, 0x3F, 0xFF, 0xBF, 0xFD, 0xF8, 0x3D,
+  0xC1, 0xEF, 0x00, 0xF8, 0x07, 0xF8, 0x03, 0xC0, 0x1F, 0x80, 0x1C, 0x00,
+  0xFC, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0x00, 0x3F, 0x00, 0x38, 0x01, 0xF8,
+  0x01, 0xC0, 0x0F, 0xC0, 0x0E, 0x00, 0x7E, 0x00, 0x70, 0x03, 0xF0, 0x03,
+  0x80, 0x1F, 0x80, 0x1C, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0x00,
+  0x3F, 0x00, 0x38, 0x01, 0xF8, 0x01, 0xC0, 0x0E, 0xE3, 0xF0, 0xEF, 0xFC,
+  0xFF, 0xFE, 0xFC, 0x1E, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x03, 0xF0,
+  0x03, 0xFF, 0x03, 0xFF, 0xF0, 0xF0, 0x3C, 0x78, 0x07, 0x9C, 0x00, 0xEE,
+  0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x07, 0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF0, 0x3C, 0x3F, 0xFF,
+  0x03, 0xFF, 0x00, 0x3F, 0x00, 0xE3, 0xF0, 0x77, 0xFE, 0x3F, 0xFF, 0x9F,
+  0x83, 0xCF, 0x80, 0xF7, 0x80, 0x3B, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x3B, 0xE0,
+  0x3D, 0xF8, 0x3C, 0xFF, 0xFE, 0x77, 0xFE, 0x38, 0xFC, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+  0x00, 0x07, 0xE3, 0x8F, 0xFD, 0xCF, 0xFF, 0xE7, 0x83, 0xF7, 0x80, 0xFB,
+  0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00,
+  0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x3D, 0xE0, 0x3E, 0x78, 0x3F, 0x3F,
+  0xFF, 0x8F, 0xFD, 0xC1, 0xF8, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0xE3, 0xFD, 0xFF,
+  0xFF, 0xFE, 0x0F, 0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x00,
+  0x0F, 0xF0, 0x7F, 0xF9, 0xFF, 0xF7, 0xC0, 0x6E, 0x00, 0x1C, 0x00, 0x3C,
+  0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0xF0, 0x00,
+  0xE0, 0x01, 0xE0, 0x03, 0xF8, 0x1F, 0xFF, 0xFC, 0xFF, 0xF0, 0x3F, 0x80,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x3F, 0xC7, 0xF8, 0x3F, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xF0, 0x0F, 0x78, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0xE0,
+  0x00, 0xEE, 0x00, 0x39, 0xC0, 0x07, 0x3C, 0x01, 0xE3, 0x80, 0x38, 0x70,
+  0x07, 0x0F, 0x01, 0xE0, 0xE0, 0x38, 0x1C, 0x0F, 0x01, 0xC1, 0xC0, 0x38,
+  0x38, 0x07, 0x8F, 0x00, 0x71, 0xC0, 0x0E, 0x38, 0x00, 0xEE, 0x00, 0x1D,
+  0xC0, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xE0, 0x1E, 0x01,
+  0xFC, 0x0F, 0xC0, 0xF7, 0x03, 0xF0, 0x39, 0xC0, 0xFC, 0x0E, 0x70, 0x3F,
+  0x03, 0x9E, 0x1C, 0xE1, 0xE3, 0x87, 0x38, 0x70, 0xE1, 0xCE, 0x1C, 0x38,
+  0x73, 0x87, 0x07, 0x38, 0x73, 0x81, 0xCE, 0x1C, 0xE0, 0x73, 0x87, 0x38,
+  0x1D, 0xE1, 0xEE, 0x03, 0xF0, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x3F, 0x03,
+  0xF0, 0x0F, 0xC0, 0xFC, 0x01, 0xE0, 0x1E, 0x00, 0x78, 0x07, 0x80, 0x78,
+  0x01, 0xE7, 0x80, 0x78, 0x78, 0x1E, 0x07, 0x03, 0x80, 0xF0, 0xF0, 0x0F,
+  0x3C, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07,
+  0xE0, 0x01, 0xFE, 0x00, 0x79, 0xC0, 0x1E, 0x3C, 0x03, 0x83, 0xC0, 0xF0,
+  0x38, 0x3C, 0x07, 0x8F, 0x00, 0x7B, 0xC0, 0x07, 0x80, 0xE0, 0x00, 0xEE,
+  0x00, 0x39, 0xC0, 0x07, 0x1C, 0x01, 0xE3, 0x80, 0x38, 0x78, 0x0F, 0x07,
+  0x01, 0xC0, 0xF0, 0x38, 0x0E, 0x0E, 0x01, 0xC1, 0xC0, 0x1C, 0x78, 0x03,
+  0x8E, 0x00, 0x79, 0xC0, 0x07, 0x70, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x1E, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0xF8, 0x1F, 0xC0, 0xFE, 0x0F, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x03, 0xF8, 0x1F,
+  0x00, 0xFE, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x78, 0x01, 0xFC,
+  0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x07, 0xF0, 0x3F, 0x80, 0x1E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E,
+  0x00, 0x70, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0x03, 0xF8, 0x1E, 0x01, 0xE0,
+  0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0xF0, 0x7F, 0x03, 0xF8, 0x1F, 0x00, 0x0F, 0xC0, 0x05,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0xC0, 0x0F, 0xE0, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x01, 0x80, 0x03,
+  0x00, 0x06, 0x00, 0x0C, 0x00, 0x7F, 0x03, 0xFF, 0x9F, 0xFF, 0x3C, 0xC6,
+  0xF1, 0x81, 0xC3, 0x07, 0x06, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x30, 0x70,
+  0x60, 0xE0, 0xC1, 0xC1, 0x81, 0xC3, 0x03, 0xC6, 0x03, 0xCC, 0x67, 0xFF,
+  0xC7, 0xFF, 0x83, 0xFE, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00,
+  0x0C, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xF0, 0x30, 0x70,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x03, 0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 0xF8,
+  0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x38, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0x00,
+  0x5C, 0x00, 0x1D, 0xE7, 0xCF, 0x1F, 0xFF, 0xC1, 0xFF, 0xF0, 0x3C, 0x1E,
+  0x07, 0x01, 0xC1, 0xC0, 0x1C, 0x38, 0x03, 0x87, 0x00, 0x70, 0xE0, 0x0E,
+  0x1C, 0x01, 0xC1, 0xC0, 0x70, 0x3C, 0x1E, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC,
+  0x79, 0xF1, 0xDC, 0x00, 0x1D, 0x00, 0x01, 0x00, 0xF0, 0x01, 0xEE, 0x00,
+  0x39, 0xE0, 0x0F, 0x1C, 0x01, 0xC3, 0xC0, 0x78, 0x38, 0x0E, 0x07, 0x83,
+  0xC0, 0x70, 0x70, 0x0F, 0x1E, 0x00, 0xE3, 0x80, 0x1E, 0xF0, 0x3F, 0xDF,
+  0xE7, 0xFF, 0xFC, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x00, 0xE0,
+  0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0,
+  0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0,
+  0xFF, 0xC3, 0x87, 0x1C, 0x04, 0x70, 0x01, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x1F, 0x00, 0xFE, 0x07, 0x3E, 0x38, 0x7C, 0xE0, 0x7B, 0x80, 0xFE, 0x01,
+  0xFC, 0x07, 0x7C, 0x1C, 0xF8, 0xE0, 0xFB, 0x81, 0xF8, 0x01, 0xF0, 0x03,
+  0xC0, 0x07, 0x80, 0x0E, 0x00, 0x39, 0x00, 0xE7, 0x07, 0x1F, 0xF8, 0x1F,
+  0xC0, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+  0xE0, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x07, 0x01, 0xC0, 0x01, 0xC1, 0xC3,
+  0xF8, 0x71, 0xC3, 0xFE, 0x18, 0xC3, 0xC1, 0x06, 0x63, 0x80, 0x03, 0x63,
+  0xC0, 0x00, 0xF1, 0xC0, 0x00, 0x78, 0xE0, 0x00, 0x3C, 0x70, 0x00, 0x1E,
+  0x38, 0x00, 0x0F, 0x1C, 0x00, 0x07, 0x8F, 0x00, 0x03, 0x63, 0x80, 0x03,
+  0x30, 0xF0, 0x41, 0x9C, 0x3F, 0xE1, 0xC7, 0x0F, 0xE1, 0xC1, 0xC0, 0x01,
+  0xC0, 0x70, 0x01, 0xC0, 0x1E, 0x03, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0x3F, 0x87, 0xFE, 0x40, 0xE0, 0x07, 0x00, 0x71, 0xFF, 0x7F,
+  0xFF, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFF, 0x1F, 0x7F, 0x73, 0xE7, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x06, 0x0C, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xE1, 0xC0, 0xE1, 0xC0,
+  0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xC1, 0x80, 0x81, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+  0xE0, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x07, 0x01, 0xC0, 0x01, 0xC1, 0xC7,
+  0xF8, 0x71, 0xC3, 0xFE, 0x18, 0xC1, 0xC7, 0x86, 0x60, 0xE1, 0xC3, 0x60,
+  0x70, 0xE0, 0xF0, 0x38, 0xF0, 0x78, 0x1F, 0xF0, 0x3C, 0x0F, 0xE0, 0x1E,
+  0x07, 0x38, 0x0F, 0x03, 0x8C, 0x07, 0x81, 0xC7, 0x03, 0x60, 0xE3, 0x83,
+  0x30, 0x70, 0xE1, 0x9C, 0x38, 0x71, 0xC7, 0x1C, 0x1D, 0xC1, 0xC0, 0x01,
+  0xC0, 0x70, 0x01, 0xC0, 0x1E, 0x03, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x7C,
+  0x07, 0x80, 0xF0, 0x1F, 0x07, 0x71, 0xC7, 0xF0, 0x7C, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80,
+  0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00,
+  0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x7E, 0x3F, 0xEC, 0x1C, 0x03, 0x00, 0xC0, 0x70, 0x18, 0x0C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xFF, 0xFF, 0xF0, 0x1F, 0x8F, 0xF9, 0x83,
+  0x80, 0x30, 0x0E, 0x3F, 0x87, 0xF0, 0x07, 0x00, 0x60, 0x0C, 0x01, 0xC0,
+  0xFF, 0xFC, 0xFE, 0x00, 0x0F, 0x1E, 0x1C, 0x38, 0x70, 0xE0, 0xE0, 0x07,
+  0x38, 0x01, 0xCE, 0x00, 0x73, 0x80, 0x1C, 0xE0, 0x07, 0x38, 0x01, 0xCE,
+  0x00, 0x73, 0x80, 0x1C, 0xE0, 0x07, 0x38, 0x01, 0xCE, 0x00, 0x73, 0x80,
+  0x1C, 0xE0, 0x07, 0x38, 0x01, 0xCF, 0x00, 0xF3, 0xE0, 0xFC, 0xFF, 0xFF,
+  0xFB, 0xFC, 0xFE, 0x7E, 0x3B, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E,
+  0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x03, 0xFF, 0x1F,
+  0xFF, 0x3F, 0xE3, 0x7F, 0xE3, 0x7F, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
+  0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0x7F, 0xE3, 0x3F, 0xE3, 0x1F, 0xE3, 0x0F,
+  0xE3, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0xFF, 0xF0, 0x18, 0x18, 0x38,
+  0x78, 0xFF, 0xFF, 0x00, 0x3C, 0x3F, 0x0C, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0x0F, 0x81,
+  0xFF, 0x1E, 0x3C, 0xE0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0,
+  0x3F, 0x01, 0xDC, 0x1C, 0xF1, 0xE3, 0xFE, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x7F, 0xF3, 0xFF, 0x80, 0x81, 0x01, 0x83, 0x03, 0x87, 0x03, 0x87, 0x03,
+  0x87, 0x03, 0x87, 0x03, 0x87, 0x03, 0x87, 0x07, 0x0E, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x30, 0x60, 0x40, 0x80, 0x3C, 0x00,
+  0x07, 0x03, 0xF0, 0x00, 0x18, 0x0C, 0xC0, 0x00, 0xC0, 0x03, 0x00, 0x07,
+  0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0x00, 0xC0, 0x07, 0x00,
+  0x03, 0x00, 0x18, 0x00, 0x0C, 0x00, 0xE0, 0x00, 0x30, 0x03, 0x00, 0x00,
+  0xC0, 0x18, 0x00, 0x03, 0x00, 0xE0, 0x1C, 0xFF, 0xC3, 0x00, 0xF3, 0xFF,
+  0x18, 0x07, 0xC0, 0x00, 0xE0, 0x3B, 0x00, 0x03, 0x01, 0xCC, 0x00, 0x18,
+  0x06, 0x30, 0x00, 0xE0, 0x30, 0xC0, 0x03, 0x01, 0x83, 0x00, 0x1C, 0x0C,
+  0x0C, 0x00, 0xE0, 0x3F, 0xFC, 0x03, 0x00, 0xFF, 0xF0, 0x1C, 0x00, 0x03,
+  0x00, 0x60, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x30, 0x1C, 0x00, 0x00, 0x00,
+  0x3C, 0x00, 0x07, 0x07, 0xE0, 0x00, 0x30, 0x33, 0x00, 0x03, 0x00, 0x18,
+  0x00, 0x38, 0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x1C, 0x00, 0x30, 0x01,
+  0xC0, 0x01, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0xE0, 0x00, 0x60, 0x06, 0x00,
+  0x03, 0x00, 0x60, 0x00, 0x18, 0x07, 0x1F, 0x8F, 0xFC, 0x31, 0xFF, 0x7F,
+  0xE3, 0x0C, 0x1C, 0x00, 0x38, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x18,
+  0x00, 0x38, 0x01, 0xC0, 0x01, 0x80, 0x0C, 0x00, 0x18, 0x00, 0xE0, 0x03,
+  0x80, 0x0E, 0x00, 0x38, 0x00, 0x60, 0x03, 0x80, 0x07, 0x00, 0x38, 0x00,
+  0x30, 0x03, 0xFF, 0x03, 0x00, 0x1F, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x1F,
+  0x80, 0x03, 0x80, 0xFF, 0x80, 0x06, 0x01, 0x83, 0x80, 0x18, 0x00, 0x03,
+  0x00, 0x70, 0x00, 0x0E, 0x00, 0xC0, 0x03, 0xF8, 0x03, 0x80, 0x07, 0xF0,
+  0x0E, 0x00, 0x00, 0x70, 0x18, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 0xC0,
+  0xC0, 0x00, 0x01, 0x83, 0x00, 0x04, 0x0F, 0x0E, 0x01, 0xCF, 0xFC, 0x18,
+  0x07, 0x8F, 0xE0, 0x60, 0x1F, 0x00, 0x01, 0xC0, 0x76, 0x00, 0x03, 0x01,
+  0xCC, 0x00, 0x0C, 0x03, 0x18, 0x00, 0x38, 0x0C, 0x30, 0x00, 0x60, 0x30,
+  0x60, 0x01, 0xC0, 0xC0, 0xC0, 0x07, 0x01, 0xFF, 0xE0, 0x0C, 0x03, 0xFF,
+  0xC0, 0x38, 0x00, 0x06, 0x00, 0x60, 0x00, 0x0C, 0x01, 0x80, 0x00, 0x18,
+  0x07, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00,
+  0x70, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x01, 0xE0, 0x0E,
+  0x00, 0x38, 0x00, 0xE0, 0x03, 0xC0, 0x1F, 0x81, 0xDF, 0xFF, 0x3F, 0xF8,
+  0x3F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xB8, 0x00, 0x07, 0x70,
+  0x00, 0x0E, 0xE0, 0x00, 0x38, 0xE0, 0x00, 0x71, 0xC0, 0x01, 0xE3, 0xC0,
+  0x03, 0x83, 0x80, 0x07, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x0E, 0x00,
+  0x70, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x0F, 0x00, 0x78, 0x1F,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xC0, 0x01, 0xC3, 0x80,
+  0x03, 0x8E, 0x00, 0x03, 0x9C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0xE0, 0x00,
+  0x0E, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xB8, 0x00, 0x07, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x38, 0xE0, 0x00, 0x71, 0xC0, 0x01, 0xE3, 0xC0, 0x03,
+  0x83, 0x80, 0x07, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x0E, 0x00, 0x70,
+  0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x0F, 0x00, 0x78, 0x1F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xC0, 0x01, 0xC3, 0x80, 0x03,
+  0x8E, 0x00, 0x03, 0x9C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0xE0, 0x00, 0x0E,
+  0x00, 0x38, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xB0, 0x00, 0x06, 0x30, 0x00,
+  0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xB8, 0x00, 0x07, 0x70, 0x00, 0x0E,
+  0xE0, 0x00, 0x38, 0xE0, 0x00, 0x71, 0xC0, 0x01, 0xE3, 0xC0, 0x03, 0x83,
+  0x80, 0x07, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x0E, 0x00, 0x70, 0x1C,
+  0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x0F, 0x00, 0x78, 0x1F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xC0, 0x01, 0xC3, 0x80, 0x03, 0x8E,
+  0x00, 0x03, 0x9C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0xE0, 0x00, 0x0E, 0x01,
+  0xE1, 0x80, 0x03, 0xF3, 0x00, 0x0C, 0xFC, 0x00, 0x18, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C,
+  0x00, 0x01, 0xDC, 0x00, 0x03, 0xB8, 0x00, 0x07, 0x70, 0x00, 0x1C, 0x70,
+  0x00, 0x38, 0xE0, 0x00, 0xF1, 0xE0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0x80,
+  0x0F, 0x07, 0x80, 0x1C, 0x07, 0x00, 0x38, 0x0E, 0x00, 0xE0, 0x0E, 0x01,
+  0xC0, 0x1C, 0x07, 0x80, 0x3C, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F,
+  0xFF, 0xF0, 0xE0, 0x00, 0xE1, 0xC0, 0x01, 0xC7, 0x00, 0x01, 0xCE, 0x00,
+  0x03, 0x9C, 0x00, 0x07, 0x70, 0x00, 0x07, 0x03, 0xC7, 0x80, 0x07, 0x8F,
+  0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xDC, 0x00,
+  0x03, 0xB8, 0x00, 0x07, 0x70, 0x00, 0x1C, 0x70, 0x00, 0x38, 0xE0, 0x00,
+  0xF1, 0xE0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0x80, 0x0F, 0x07, 0x80, 0x1C,
+  0x07, 0x00, 0x38, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x07, 0x80,
+  0x3C, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0xE0, 0x00,
+  0xE1, 0xC0, 0x01, 0xC7, 0x00, 0x01, 0xCE, 0x00, 0x03, 0x9C, 0x00, 0x07,
+  0x70, 0x00, 0x07, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x18, 0x00,
+  0x0C, 0x18, 0x00, 0x18, 0x30, 0x00, 0x30, 0x60, 0x00, 0x71, 0xC0, 0x00,
+  0x7F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xB8, 0x00, 0x07,
+  0x70, 0x00, 0x0E, 0xE0, 0x00, 0x38, 0xE0, 0x00, 0x71, 0xC0, 0x01, 0xE3,
+  0xC0, 0x03, 0x83, 0x80, 0x07, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x0E,
+  0x00, 0x70, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x0F, 0x00, 0x78,
+  0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xC0, 0x01, 0xC3,
+  0x80, 0x03, 0x8E, 0x00, 0x03, 0x9C, 0x00, 0x07, 0x38, 0x00, 0x0E, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF,
+  0xFF, 0xF8, 0x03, 0x8E, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x1E, 0x38,
+  0x00, 0x00, 0x38, 0x70, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x01, 0xC1, 0xC0,
+  0x00, 0x03, 0x83, 0x80, 0x00, 0x0F, 0x07, 0x00, 0x00, 0x1C, 0x0F, 0xFF,
+  0xE0, 0x78, 0x1F, 0xFF, 0xC0, 0xE0, 0x3F, 0xFF, 0x81, 0xC0, 0x70, 0x00,
+  0x07, 0x00, 0xE0, 0x00, 0x0E, 0x01, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+  0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x1C, 0x00, 0x07,
+  0x00, 0x38, 0x00, 0x1E, 0x00, 0x70, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0x70,
+  0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xFF,
+  0x83, 0xFF, 0xFE, 0x3F, 0x01, 0xF3, 0xE0, 0x01, 0x9E, 0x00, 0x05, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00,
+  0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x9F, 0x00, 0x0C, 0x7E, 0x03, 0xE1, 0xFF, 0xFF, 0x03, 0xFF,
+  0xF0, 0x07, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x00, 0x02, 0x38, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0,
+  0x07, 0xE0, 0x06, 0x60, 0x0E, 0x70, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xC0, 0x00, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x1C, 0x70, 0xE3, 0x8E, 0x00, 0x00, 0x70, 0xE1, 0xC3, 0x87, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0x1F, 0x03, 0xE0, 0xEE, 0x38, 0xEE,
+  0x0E, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,
+  0x80, 0x70, 0x0E, 0x00, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xF0, 0x00, 0x00,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x1C, 0x01, 0xF8,
+  0x1C, 0x00, 0x7C, 0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x1E, 0x1C, 0x00, 0x0E,
+  0x1C, 0x00, 0x0F, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07,
+  0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x07, 0x1C, 0x00, 0x07,
+  0x1C, 0x00, 0x07, 0x1C, 0x00, 0x0F, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x1E,
+  0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x7C, 0x1C, 0x01, 0xF8, 0x1F, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x07, 0x86, 0x00, 0xFC, 0xC0, 0x33,
+  0xF0, 0x06, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0xC0,
+  0x07, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xF7, 0x00, 0x7E, 0xF0,
+  0x0F, 0xCE, 0x01, 0xF9, 0xE0, 0x3F, 0x1C, 0x07, 0xE3, 0xC0, 0xFC, 0x38,
+  0x1F, 0x83, 0x83, 0xF0, 0x70, 0x7E, 0x07, 0x0F, 0xC0, 0xF1, 0xF8, 0x0E,
+  0x3F, 0x01, 0xE7, 0xE0, 0x1C, 0xFC, 0x03, 0xDF, 0x80, 0x3B, 0xF0, 0x07,
+  0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0x00, 0xF0,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00,
+  0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00,
+  0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x3E, 0x00,
+  0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3E, 0x00,
+  0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E, 0x70, 0x00,
+  0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x3C, 0x00,
+  0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0xE7, 0x00, 0x01, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81,
+  0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00,
+  0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00,
+  0x1E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF1, 0x80, 0x00, 0xF9,
+  0x80, 0x01, 0x9F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81,
+  0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00,
+  0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00,
+  0x1E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xE7, 0x80, 0x01, 0xE7,
+  0x80, 0x01, 0xE7, 0x80, 0x01, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81,
+  0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x70, 0x00,
+  0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00,
+  0x1E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x47, 0x00, 0x0E,
+  0xF8, 0x01, 0xF7, 0xC0, 0x3E, 0x3E, 0x07, 0xC1, 0xF0, 0xF8, 0x0F, 0x9F,
+  0x00, 0x7F, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F,
+  0xC0, 0x07, 0xFE, 0x00, 0xF9, 0xF0, 0x1F, 0x0F, 0x83, 0xE0, 0x7C, 0x7C,
+  0x03, 0xEF, 0x80, 0x1F, 0x70, 0x00, 0xE2, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x03, 0x03, 0xFF, 0xC7, 0x0F, 0xFF, 0xFE, 0x1F, 0x81, 0xFC,
+  0x1E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x7E, 0x70, 0x00, 0xEE,
+  0x70, 0x01, 0xCE, 0xE0, 0x03, 0x87, 0xE0, 0x07, 0x07, 0xE0, 0x0E, 0x07,
+  0xE0, 0x1C, 0x07, 0xE0, 0x38, 0x07, 0xE0, 0x70, 0x07, 0xE0, 0xE0, 0x07,
+  0xE1, 0xC0, 0x07, 0xF3, 0x80, 0x0E, 0x77, 0x00, 0x0E, 0x7E, 0x00, 0x1E,
+  0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x78, 0x3F, 0x81, 0xF8, 0x7F, 0xFF, 0xF0,
+  0xE3, 0xFF, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
+  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
+  0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
+  0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
+  0x07, 0xB8, 0x00, 0xE7, 0x80, 0x3C, 0x78, 0x0F, 0x0F, 0xFF, 0xE0, 0x7F,
+  0xF0, 0x03, 0xF8, 0x00, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0xE0,
+  0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
+  0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xB8, 0x00, 0xE7, 0x80,
+  0x3C, 0x78, 0x0F, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x03, 0xF8, 0x00, 0x00,
+  0xE0, 0x00, 0x3E, 0x00, 0x06, 0xC0, 0x01, 0x8C, 0x00, 0x60, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00,
+  0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0xC0, 0x07, 0xB8, 0x00, 0xE7, 0x80, 0x3C, 0x78, 0x0F, 0x0F, 0xFF,
+  0xE0, 0x7F, 0xF0, 0x03, 0xF8, 0x00, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x3C,
+  0x78, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00,
+  0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
+  0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0x3D, 0xC0, 0x07, 0x3C, 0x01,
+  0xE3, 0xC0, 0x78, 0x7F, 0xFF, 0x03, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x1C,
+  0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x78, 0x00, 0xF1, 0xC0, 0x07,
+  0x0F, 0x00, 0x78, 0x3C, 0x07, 0x80, 0xE0, 0x38, 0x07, 0x83, 0xC0, 0x1E,
+  0x3C, 0x00, 0x71, 0xC0, 0x03, 0xDE, 0x00, 0x0F, 0xE0, 0x00, 0x3E, 0x00,
+  0x01, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+  0xE0, 0xFF, 0xF8, 0xFF, 0xFC, 0xE0, 0x3E, 0xE0, 0x0F, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x3E, 0xFF,
+  0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFE, 0x0F,
+  0x07, 0x8F, 0x01, 0xC7, 0x00, 0x73, 0x80, 0x39, 0xC0, 0xFC, 0xE1, 0xF0,
+  0x70, 0xE0, 0x38, 0xE0, 0x1C, 0x70, 0x0E, 0x38, 0x07, 0x1E, 0x03, 0x87,
+  0xC1, 0xC1, 0xF8, 0xE0, 0x7E, 0x70, 0x0F, 0xB8, 0x01, 0xDC, 0x00, 0x7E,
+  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xCC, 0x1F, 0xE7, 0xFF, 0x73, 0xFF,
+  0x38, 0xFE, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
+  0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x0F,
+  0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF8, 0x7F, 0xFC, 0x70,
+  0x1E, 0x40, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x0F, 0xFF, 0x3F, 0xFF, 0x7F,
+  0xFF, 0x78, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xF8,
+  0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x03, 0x80, 0x03, 0xC0, 0x07,
+  0xE0, 0x06, 0x60, 0x0C, 0x30, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0x3F, 0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00,
+  0x07, 0x00, 0x07, 0x0F, 0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F,
+  0xF7, 0x0F, 0xC7, 0x0F, 0x18, 0x0F, 0x98, 0x19, 0x98, 0x19, 0xF0, 0x18,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF8, 0x7F,
+  0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x0F, 0xFF, 0x3F,
+  0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0,
+  0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x1E, 0x78, 0x1E,
+  0x78, 0x1E, 0x78, 0x1E, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0x3F, 0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00,
+  0x07, 0x00, 0x07, 0x0F, 0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F,
+  0xF7, 0x0F, 0xC7, 0x03, 0xE0, 0x07, 0xF0, 0x0E, 0x38, 0x0C, 0x18, 0x0C,
+  0x18, 0x0C, 0x18, 0x0E, 0x38, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0x3F, 0xF8, 0x7F, 0xFC, 0x70, 0x1E, 0x40, 0x0E, 0x00,
+  0x07, 0x00, 0x07, 0x0F, 0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x78, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x3F,
+  0xF7, 0x0F, 0xC7, 0x0F, 0xE0, 0x1F, 0x80, 0xFF, 0xE1, 0xFF, 0x87, 0xFF,
+  0xFF, 0xFF, 0x1C, 0x07, 0xF8, 0x3E, 0x40, 0x0F, 0xC0, 0x38, 0x00, 0x1E,
+  0x00, 0xE0, 0x00, 0x70, 0x01, 0xC3, 0xFF, 0xC0, 0x07, 0x3F, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0x80, 0x7F, 0xFF, 0xF8, 0x01, 0xC0, 0x00,
+  0xE0, 0x07, 0x00, 0x03, 0x80, 0x3E, 0x00, 0x0E, 0x01, 0xFC, 0x00, 0xBE,
+  0x0F, 0x78, 0x0E, 0x7F, 0xF9, 0xFF, 0xF8, 0xFF, 0xC1, 0xFF, 0xC0, 0xFC,
+  0x01, 0xFC, 0x00, 0x03, 0xF8, 0x1F, 0xFC, 0x7F, 0xF9, 0xF0, 0x37, 0x80,
+  0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1F, 0x03, 0x1F, 0xFE, 0x1F,
+  0xFC, 0x0F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x02, 0x38,
+  0x07, 0xF0, 0x0F, 0xC0, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x7F, 0xFC, 0x3E, 0x0F, 0x9E, 0x00, 0xE7,
+  0x00, 0x3B, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x02, 0x3E, 0x03,
+  0x87, 0xFF, 0xE0, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x7F, 0xFC, 0x3E, 0x0F,
+  0x9E, 0x00, 0xE7, 0x00, 0x3B, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xE0,
+  0x02, 0x3E, 0x03, 0x87, 0xFF, 0xE0, 0xFF, 0xF0, 0x0F, 0xF0, 0x01, 0xE0,
+  0x00, 0x7C, 0x00, 0x3F, 0x00, 0x1C, 0xE0, 0x0E, 0x1C, 0x07, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x7F,
+  0xFC, 0x3E, 0x0F, 0x9E, 0x00, 0xE7, 0x00, 0x3B, 0x80, 0x07, 0xE0, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x07,
+  0x00, 0x01, 0xE0, 0x02, 0x3E, 0x03, 0x87, 0xFF, 0xE0, 0xFF, 0xF0, 0x0F,
+  0xF0, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x81,
+  0xFF, 0xF0, 0xF8, 0x3E, 0x78, 0x03, 0x9C, 0x00, 0xEE, 0x00, 0x1F, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x07, 0x80, 0x08, 0xF8, 0x0E, 0x1F, 0xFF, 0x83, 0xFF, 0xC0,
+  0x3F, 0xC0, 0xF0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x1E, 0x1C, 0x38, 0x70, 0xE0,
+  0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0E, 0x03,
+  0xE0, 0xEE, 0x18, 0xC7, 0x1D, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
+  0xC0, 0x38, 0x00, 0x0F, 0x00, 0x03, 0xE1, 0xC0, 0x7F, 0xF0, 0x0F, 0xE0,
+  0x0F, 0xE0, 0x0F, 0x3C, 0x02, 0x07, 0x80, 0x00, 0xF0, 0x03, 0xFE, 0x03,
+  0xFF, 0xC1, 0xFF, 0xF0, 0xF8, 0x1E, 0x78, 0x03, 0x9C, 0x00, 0xFF, 0x00,
+  0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF0, 0x3C, 0x1F, 0xFE, 0x03,
+  0xFF, 0x00, 0x3F, 0x00, 0x07, 0x0C, 0x0F, 0x8C, 0x19, 0xCC, 0x18, 0xF8,
+  0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xF0, 0xEF, 0xFC,
+  0xFF, 0xFE, 0xFC, 0x1E, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x1E, 0x00,
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0xFF,
+  0xFC, 0x3C, 0x0F, 0x1E, 0x01, 0xE7, 0x00, 0x3B, 0x80, 0x0F, 0xE0, 0x01,
+  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xF7,
+  0x00, 0x39, 0xE0, 0x1E, 0x3C, 0x0F, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F,
+  0xC0, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x0F, 0x1E, 0x01, 0xE7, 0x00, 0x3B, 0x80,
+  0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01,
+  0xFC, 0x00, 0xF7, 0x00, 0x39, 0xE0, 0x1E, 0x3C, 0x0F, 0x0F, 0xFF, 0xC0,
+  0xFF, 0xC0, 0x0F, 0xC0, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x0C,
+  0xC0, 0x06, 0x18, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0xFC, 0x3C, 0x0F, 0x1E, 0x01, 0xE7,
+  0x00, 0x3B, 0x80, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x07, 0xE0, 0x01, 0xFC, 0x00, 0xF7, 0x00, 0x39, 0xE0, 0x1E, 0x3C, 0x0F,
+  0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xC0, 0x07, 0x8C, 0x01, 0xF3, 0x00,
+  0xCC, 0xC0, 0x33, 0xE0, 0x0C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xF0, 0xF0, 0x3C, 0x78, 0x07,
+  0x9C, 0x00, 0xEE, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x07, 0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF0,
+  0x3C, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x0F, 0x3C, 0x03, 0xCF,
+  0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xF0, 0xF0, 0x3C, 0x78,
+  0x07, 0x9C, 0x00, 0xEE, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00,
+  0x7E, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78,
+  0xF0, 0x3C, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x20, 0x1F,
+  0x87, 0x07, 0xFE, 0xE1, 0xFF, 0xFC, 0x1E, 0x07, 0x83, 0xC0, 0x3C, 0x38,
+  0x07, 0xC7, 0x80, 0xEE, 0x70, 0x1C, 0xE7, 0x07, 0x8E, 0x70, 0xF0, 0xE7,
+  0x1C, 0x0E, 0x73, 0x80, 0xE7, 0x70, 0x1E, 0x3E, 0x01, 0xC3, 0xC0, 0x3C,
+  0x1E, 0x07, 0x83, 0xFF, 0xF8, 0x77, 0xFE, 0x06, 0x1F, 0x80, 0x40, 0x00,
+  0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0,
+  0x0F, 0x78, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0x78, 0x3F, 0x7F,
+  0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x03, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x06,
+  0x60, 0x0C, 0x30, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0x78, 0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F,
+  0xC7, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0x78,
+  0x3F, 0x7F, 0xFF, 0x3F, 0xF7, 0x0F, 0xC7, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1D, 0xC0, 0x07, 0x38, 0x00, 0xE3,
+  0x80, 0x3C, 0x70, 0x07, 0x0F, 0x01, 0xE0, 0xE0, 0x38, 0x1E, 0x07, 0x01,
+  0xC1, 0xC0, 0x38, 0x38, 0x03, 0x8F, 0x00, 0x71, 0xC0, 0x0F, 0x38, 0x00,
+  0xEE, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00,
+  0x70, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x1E, 0x00, 0x3F,
+  0x80, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,
+  0xE3, 0xF0, 0x77, 0xFE, 0x3F, 0xFF, 0x9F, 0x83, 0xCF, 0x80, 0xF7, 0x80,
+  0x3B, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
+  0x00, 0x7E, 0x00, 0x3F, 0x80, 0x3B, 0xE0, 0x3D, 0xF8, 0x3C, 0xFF, 0xFE,
+  0x77, 0xFE, 0x38, 0xFC, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x0F, 0x1E, 0x01, 0xE3,
+  0xC0, 0x3C, 0x78, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0xEE, 0x00, 0x39, 0xC0, 0x07, 0x1C, 0x01,
+  0xE3, 0x80, 0x38, 0x78, 0x0F, 0x07, 0x01, 0xC0, 0xF0, 0x38, 0x0E, 0x0E,
+  0x01, 0xC1, 0xC0, 0x1C, 0x78, 0x03, 0x8E, 0x00, 0x79, 0xC0, 0x07, 0x70,
+  0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0x80,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x01, 0xFC, 0x00,
+  0x3F, 0x00, 0x07, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   3,  26,  14,    5,  -25 },   // 0x21 '!'
+  {    11,  10,   9,  16,    3,  -25 },   // 0x22 '"'
+  {    23,  24,  25,  29,    3,  -24 },   // 0x23 '#'
+  {    98,  17,  32,  22,    3,  -26 },   // 0x24 '$'
+  {   166,  29,  26,  33,    2,  -25 },   // 0x25 '%'
+  {   261,  24,  26,  27,    2,  -25 },   // 0x26 '&'
+  {   339,   3,   9,  10,    3,  -25 },   // 0x27 '''
+  {   343,   8,  31,  14,    3,  -26 },   // 0x28 '('
+  {   374,   8,  31,  14,    3,  -26 },   // 0x29 ')'
+  {   405,  16,  16,  18,    1,  -25 },   // 0x2A '*'
+  {   437,  23,  23,  29,    4,  -22 },   // 0x2B '+'
+  {   504,   4,   8,  11,    3,   -3 },   // 0x2C ','
+  {   508,   9,   3,  13,    2,  -10 },   // 0x2D '-'
+  {   512,   3,   4,  11,    4,   -3 },   // 0x2E '.'
+  {   514,  12,  29,  12,    0,  -25 },   // 0x2F '/'
+  {   558,  18,  26,  22,    2,  -25 },   // 0x30 '0'
+  {   617,  15,  26,  22,    4,  -25 },   // 0x31 '1'
+  {   666,  16,  26,  22,    3,  -25 },   // 0x32 '2'
+  {   718,  17,  26,  22,    3,  -25 },   // 0x33 '3'
+  {   774,  19,  26,  22,    2,  -25 },   // 0x34 '4'
+  {   836,  17,  26,  22,    3,  -25 },   // 0x35 '5'
+  {   892,  18,  26,  22,    2,  -25 },   // 0x36 '6'
+  {   951,  16,  26,  22,    3,  -25 },   // 0x37 '7'
+  {  1003,  18,  26,  22,    2,  -25 },   // 0x38 '8'
+  {  1062,  18,  26,  22,    2,  -25 },   // 0x39 '9'
+  {  1121,   3,  18,  12,    4,  -17 },   // 0x3A ':'
+  {  1128,   4,  22,  12,    3,  -17 },   // 0x3B ';'
+  {  1139,  22,  19,  29,    4,  -19 },   // 0x3C '<'
+  {  1192,  22,  10,  29,    4,  -15 },   // 0x3D '='
+  {  1220,  22,  19,  29,    4,  -19 },   // 0x3E '>'
+  {  1273,  14,  26,  19,    3,  -25 },   // 0x3F '?'
+  {  1319,  31,  31,  35,    2,  -24 },   // 0x40 '@'
+  {  1440,  23,  26,  24,    0,  -25 },   // 0x41 'A'
+  {  1515,  18,  26,  24,    3,  -25 },   // 0x42 'B'
+  {  1574,  21,  26,  24,    2,  -25 },   // 0x43 'C'
+  {  1643,  21,  26,  27,    3,  -25 },   // 0x44 'D'
+  {  1712,  16,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  1764,  15,  26,  20,    3,  -25 },   // 0x46 'F'
+  {  1813,  22,  26,  27,    2,  -25 },   // 0x47 'G'
+  {  1885,  19,  26,  26,    3,  -25 },   // 0x48 'H'
+  {  1947,   3,  26,  10,    3,  -25 },   // 0x49 'I'
+  {  1957,   8,  33,  10,   -2,  -25 },   // 0x4A 'J'
+  {  1990,  20,  26,  23,    3,  -25 },   // 0x4B 'K'
+  {  2055,  16,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  2107,  23,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  2182,  19,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  2244,  24,  26,  28,    2,  -25 },   // 0x4F 'O'
+  {  2322,  16,  26,  21,    3,  -25 },   // 0x50 'P'
+  {  2374,  24,  31,  28,    2,  -25 },   // 0x51 'Q'
+  {  2467,  19,  26,  24,    3,  -25 },   // 0x52 'R'
+  {  2529,  18,  26,  22,    2,  -25 },   // 0x53 'S'
+  {  2588,  21,  26,  21,    0,  -25 },   // 0x54 'T'
+  {  2657,  19,  26,  26,    3,  -25 },   // 0x55 'U'
+  {  2719,  23,  26,  24,    0,  -25 },   // 0x56 'V'
+  {  2794,  32,  26,  35,    1,  -25 },   // 0x57 'W'
+  {  2898,  22,  26,  24,    1,  -25 },   // 0x58 'X'
+  {  2970,  21,  26,  21,    0,  -25 },   // 0x59 'Y'
+  {  3039,  21,  26,  24,    2,  -25 },   // 0x5A 'Z'
+  {  3108,   7,  31,  14,    3,  -26 },   // 0x5B '['
+  {  3136,  12,  29,  12,    0,  -25 },   // 0x5C '\'
+  {  3180,   7,  31,  14,    3,  -26 },   // 0x5D ']'
+  {  3208,  22,  10,  29,    4,  -25 },   // 0x5E '^'
+  {  3236,  18,   3,  18,    0,    6 },   // 0x5F '_'
+  {  3243,   8,   6,  18,    3,  -27 },   // 0x60 '`'
+  {  3249,  16,  19,  21,    2,  -18 },   // 0x61 'a'
+  {  3287,  17,  27,  22,    3,  -26 },   // 0x62 'b'
+  {  3345,  15,  19,  19,    2,  -18 },   // 0x63 'c'
+  {  3381,  17,  27,  22,    2,  -26 },   // 0x64 'd'
+  {  3439,  18,  19,  22,    2,  -18 },   // 0x65 'e'
+  {  3482,  12,  27,  12,    1,  -26 },   // 0x66 'f'
+  {  3523,  17,  26,  22,    2,  -18 },   // 0x67 'g'
+  {  3579,  16,  27,  22,    3,  -26 },   // 0x68 'h'
+  {  3633,   3,  27,  10,    3,  -26 },   // 0x69 'i'
+  {  3644,   7,  34,  10,   -1,  -26 },   // 0x6A 'j'
+  {  3674,  17,  27,  20,    3,  -26 },   // 0x6B 'k'
+  {  3732,   3,  27,  10,    3,  -26 },   // 0x6C 'l'
+  {  3743,  29,  19,  34,    3,  -18 },   // 0x6D 'm'
+  {  3812,  16,  19,  22,    3,  -18 },   // 0x6E 'n'
+  {  3850,  18,  19,  21,    2,  -18 },   // 0x6F 'o'
+  {  3893,  17,  26,  22,    3,  -18 },   // 0x70 'p'
+  {  3949,  17,  26,  22,    2,  -18 },   // 0x71 'q'
+  {  4005,  11,  19,  14,    3,  -18 },   // 0x72 'r'
+  {  4032,  15,  19,  18,    2,  -18 },   // 0x73 's'
+  {  4068,  11,  24,  14,    1,  -23 },   // 0x74 't'
+  {  4101,  16,  19,  22,    3,  -18 },   // 0x75 'u'
+  {  4139,  19,  19,  21,    1,  -18 },   // 0x76 'v'
+  {  4185,  26,  19,  29,    1,  -18 },   // 0x77 'w'
+  {  4247,  19,  19,  21,    1,  -18 },   // 0x78 'x'
+  {  4293,  19,  26,  21,    1,  -18 },   // 0x79 'y'
+  {  4355,  15,  19,  18,    2,  -18 },   // 0x7A 'z'
+  {  4391,  13,  32,  22,    5,  -26 },   // 0x7B '{'
+  {  4443,   3,  35,  12,    4,  -26 },   // 0x7C '|'
+  {  4457,  13,  32,  22,    4,  -26 },   // 0x7D '}'
+  {  4509,  22,   6,  29,    4,  -13 },   // 0x7E '~'
+  {  4526,  18,  31,  21,    2,  -24 },   // 0x7F
+  {  4596,  18,  31,  21,    2,  -24 },   // 0x80
+  {  4666,  18,  31,  21,    2,  -24 },   // 0x81
+  {  4736,  18,  31,  21,    2,  -24 },   // 0x82
+  {  4806,  18,  31,  21,    2,  -24 },   // 0x83
+  {  4876,  18,  31,  21,    2,  -24 },   // 0x84
+  {  4946,  18,  31,  21,    2,  -24 },   // 0x85
+  {  5016,  18,  31,  21,    2,  -24 },   // 0x86
+  {  5086,  18,  31,  21,    2,  -24 },   // 0x87
+  {  5156,  18,  31,  21,    2,  -24 },   // 0x88
+  {  5226,  18,  31,  21,    2,  -24 },   // 0x89
+  {  5296,  18,  31,  21,    2,  -24 },   // 0x8A
+  {  5366,  18,  31,  21,    2,  -24 },   // 0x8B
+  {  5436,  18,  31,  21,    2,  -24 },   // 0x8C
+  {  5506,  18,  31,  21,    2,  -24 },   // 0x8D
+  {  5576,  18,  31,  21,    2,  -24 },   // 0x8E
+  {  5646,  18,  31,  21,    2,  -24 },   // 0x8F
+  {  5716,  18,  31,  21,    2,  -24 },   // 0x90
+  {  5786,  18,  31,  21,    2,  -24 },   // 0x91
+  {  5856,  18,  31,  21,    2,  -24 },   // 0x92
+  {  5926,  18,  31,  21,    2,  -24 },   // 0x93
+  {  5996,  18,  31,  21,    2,  -24 },   // 0x94
+  {  6066,  18,  31,  21,    2,  -24 },   // 0x95
+  {  6136,  18,  31,  21,    2,  -24 },   // 0x96
+  {  6206,  18,  31,  21,    2,  -24 },   // 0x97
+  {  6276,  18,  31,  21,    2,  -24 },   // 0x98
+  {  6346,  18,  31,  21,    2,  -24 },   // 0x99
+  {  6416,  18,  31,  21,    2,  -24 },   // 0x9A
+  {  6486,  18,  31,  21,    2,  -24 },   // 0x9B
+  {  6556,  18,  31,  21,    2,  -24 },   // 0x9C
+  {  6626,  18,  31,  21,    2,  -24 },   // 0x9D
+  {  6696,  18,  31,  21,    2,  -24 },   // 0x9E
+  {  6766,  18,  31,  21,    2,  -24 },   // 0x9F
+  {  6836,   1,   1,  11,    0,    0 },   // 0xA0
+  {  6837,   3,  26,  14,    5,  -18 },   // 0xA1
+  {  6847,  15,  29,  22,    3,  -23 },   // 0xA2
+  {  6902,  17,  26,  22,    2,  -25 },   // 0xA3
+  {  6958,  19,  19,  22,    2,  -19 },   // 0xA4
+  {  7004,  19,  26,  22,    1,  -25 },   // 0xA5
+  {  7066,   3,  31,  12,    4,  -24 },   // 0xA6
+  {  7078,  14,  29,  18,    2,  -25 },   // 0xA7
+  {  7129,  11,   4,  18,    4,  -26 },   // 0xA8
+  {  7135,  25,  25,  35,    5,  -24 },   // 0xA9
+  {  7214,  12,  18,  16,    2,  -25 },   // 0xAA
+  {  7241,  15,  16,  21,    3,  -17 },   // 0xAB
+  {  7271,  22,  10,  29,    4,  -14 },   // 0xAC
+  {  7299,   9,   3,  13,    2,  -10 },   // 0xAD
+  {  7303,  25,  25,  35,    5,  -24 },   // 0xAE
+  {  7382,  10,   3,  18,    4,  -25 },   // 0xAF
+  {  7386,  11,  11,  18,    3,  -25 },   // 0xB0
+  {  7402,  23,  22,  29,    3,  -21 },   // 0xB1
+  {  7466,  10,  14,  14,    2,  -25 },   // 0xB2
+  {  7484,  11,  14,  14,    2,  -25 },   // 0xB3
+  {  7504,   8,   6,  18,    7,  -27 },   // 0xB4
+  {  7510,  18,  26,  22,    3,  -18 },   // 0xB5
+  {  7569,  16,  29,  22,    3,  -25 },   // 0xB6
+  {  7627,   3,   4,  11,    4,  -13 },   // 0xB7
+  {  7629,   7,   7,  18,    5,    1 },   // 0xB8
+  {  7636,  10,  14,  14,    3,  -25 },   // 0xB9
+  {  7654,  13,  18,  16,    2,  -25 },   // 0xBA
+  {  7684,  15,  16,  21,    3,  -17 },   // 0xBB
+  {  7714,  30,  26,  34,    3,  -25 },   // 0xBC
+  {  7812,  29,  26,  34,    3,  -25 },   // 0xBD
+  {  7907,  31,  26,  34,    2,  -25 },   // 0xBE
+  {  8008,  14,  26,  19,    2,  -18 },   // 0xBF
+  {  8054,  23,  33,  24,    0,  -32 },   // 0xC0
+  {  8149,  23,  33,  24,    0,  -32 },   // 0xC1
+  {  8244,  23,  33,  24,    0,  -32 },   // 0xC2
+  {  8339,  23,  32,  24,    0,  -31 },   // 0xC3
+  {  8431,  23,  32,  24,    0,  -31 },   // 0xC4
+  {  8523,  23,  33,  24,    0,  -32 },   // 0xC5
+  {  8618,  31,  26,  34,    0,  -25 },   // 0xC6
+  {  8719,  21,  33,  24,    2,  -25 },   // 0xC7
+  {  8806,  16,  33,  22,    3,  -32 },   // 0xC8
+  {  8872,  16,  33,  22,    3,  -32 },   // 0xC9
+  {  8938,  16,  33,  22,    3,  -32 },   // 0xCA
+  {  9004,  16,  32,  22,    3,  -31 },   // 0xCB
+  {  9068,   7,  33,  10,    1,  -32 },   // 0xCC
+  {  9097,   7,  33,  10,    3,  -32 },   // 0xCD
+  {  9126,  11,  33,  10,   -1,  -32 },   // 0xCE
+  {  9172,  11,  32,  10,   -1,  -31 },   // 0xCF
+  {  9216,  24,  26,  27,    1,  -25 },   // 0xD0
+  {  9294,  19,  32,  26,    3,  -31 },   // 0xD1
+  {  9370,  24,  33,  28,    2,  -32 },   // 0xD2
+  {  9469,  24,  33,  28,    2,  -32 },   // 0xD3
+  {  9568,  24,  33,  28,    2,  -32 },   // 0xD4
+  {  9667,  24,  32,  28,    2,  -31 },   // 0xD5
+  {  9763,  24,  32,  28,    2,  -31 },   // 0xD6
+  {  9859,  20,  20,  29,    5,  -20 },   // 0xD7
+  {  9909,  24,  28,  28,    2,  -26 },   // 0xD8
+  {  9993,  19,  33,  26,    3,  -32 },   // 0xD9
+  { 10072,  19,  33,  26,    3,  -32 },   // 0xDA
+  { 10151,  19,  33,  26,    3,  -32 },   // 0xDB
+  { 10230,  19,  32,  26,    3,  -31 },   // 0xDC
+  { 10306,  21,  33,  21,    0,  -32 },   // 0xDD
+  { 10393,  16,  26,  21,    3,  -25 },   // 0xDE
+  { 10445,  17,  27,  22,    3,  -26 },   // 0xDF
+  { 10503,  16,  28,  21,    2,  -27 },   // 0xE0
+  { 10559,  16,  28,  21,    2,  -27 },   // 0xE1
+  { 10615,  16,  28,  21,    2,  -27 },   // 0xE2
+  { 10671,  16,  27,  21,    2,  -26 },   // 0xE3
+  { 10725,  16,  27,  21,    2,  -26 },   // 0xE4
+  { 10779,  16,  30,  21,    2,  -29 },   // 0xE5
+  { 10839,  30,  19,  34,    2,  -18 },   // 0xE6
+  { 10911,  15,  26,  19,    2,  -18 },   // 0xE7
+  { 10960,  18,  28,  22,    2,  -27 },   // 0xE8
+  { 11023,  18,  28,  22,    2,  -27 },   // 0xE9
+  { 11086,  18,  28,  22,    2,  -27 },   // 0xEA
+  { 11149,  18,  27,  22,    2,  -26 },   // 0xEB
+  { 11210,   8,  28,  10,   -1,  -27 },   // 0xEC
+  { 11238,   8,  28,  10,    3,  -27 },   // 0xED
+  { 11266,  11,  28,  10,   -1,  -27 },   // 0xEE
+  { 11305,  11,  27,  10,   -1,  -26 },   // 0xEF
+  { 11343,  18,  27,  21,    2,  -26 },   // 0xF0
+  { 11404,  16,  27,  22,    3,  -26 },   // 0xF1
+  { 11458,  18,  28,  21,    2,  -27 },   // 0xF2
+  { 11521,  18,  28,  21,    2,  -27 },   // 0xF3
+  { 11584,  18,  28,  21,    2,  -27 },   // 0xF4
+  { 11647,  18,  27,  21,    2,  -26 },   // 0xF5
+  { 11708,  18,  27,  21,    2,  -26 },   // 0xF6
+  { 11769,  22,  17,  29,    4,  -19 },   // 0xF7
+  { 11816,  20,  21,  21,    1,  -19 },   // 0xF8
+  { 11869,  16,  28,  22,    3,  -27 },   // 0xF9
+  { 11925,  16,  28,  22,    3,  -27 },   // 0xFA
+  { 11981,  16,  28,  22,    3,  -27 },   // 0xFB
+  { 12037,  16,  27,  22,    3,  -26 },   // 0xFC
+  { 12091,  19,  35,  21,    1,  -27 },   // 0xFD
+  { 12175,  17,  34,  22,    3,  -26 },   // 0xFE
+  { 12248,  19,  34,  21,    1,  -26 } }; // 0xFF
+
+const GFXfont DejaVuSans18pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans18pt8bBitmaps,
+  (GFXglyph *)DejaVuSans18pt8bGlyphs,
+  0x20, 0xFF, 41 };
+
+// Approx. 13904 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans18pt8bMetrics[] PROGMEM = {
+  {   0,  11,   1 },   // 0x20
+  {   5,  14,   8 },   // 0x21
+  {   3,  16,  13 },   // 0x22
+  {   3,  29,  27 },   // 0x23
+  {   3,  22,  20 },   // 0x24
+  {   2,  33,  31 },   // 0x25
+  {   2,  27,  26 },   // 0x26
+  {   3,  10,   6 },   // 0x27
+  {   3,  14,  11 },   // 0x28
+  {   3,  14,  11 },   // 0x29
+  {   1,  18,  17 },   // 0x2A
+  {   4,  29,  27 },   // 0x2B
+  {   3,  11,   7 },   // 0x2C
+  {   2,  13,  11 },   // 0x2D
+  {   4,  11,   7 },   // 0x2E
+  {   0,  12,  12 },   // 0x2F
+  {   2,  22,  20 },   // 0x30
+  {   4,  22,  19 },   // 0x31
+  {   3,  22,  19 },   // 0x32
+  {   3,  22,  20 },   // 0x33
+  {   2,  22,  21 },   // 0x34
+  {   3,  22,  20 },   // 0x35
+  {   2,  22,  20 },   // 0x36
+  {   3,  22,  19 },   // 0x37
+  {   2,  22,  20 },   // 0x38
+  {   2,  22,  20 },   // 0x39
+  {   4,  12,   7 },   // 0x3A
+  {   3,  12,   7 },   // 0x3B
+  {   4,  29,  26 },   // 0x3C
+  {   4,  29,  26 },   // 0x3D
+  {   4,  29,  26 },   // 0x3E
+  {   3,  19,  17 },   // 0x3F
+  {   2,  35,  33 },   // 0x40
+  {   0,  24,  23 },   // 0x41
+  {   3,  24,  21 },   // 0x42
+  {   2,  24,  23 },   // 0x43
+  {   3,  27,  24 },   // 0x44
+  {   3,  22,  19 },   // 0x45
+  {   3,  20,  18 },   // 0x46
+  {   2,  27,  24 },   // 0x47
+  {   3,  26,  22 },   // 0x48
+  {   3,  10,   6 },   // 0x49
+  {  -2,  10,   6 },   // 0x4A
+  {   3,  23,  23 },   // 0x4B
+  {   3,  20,  19 },   // 0x4C
+  {   3,  30,  26 },   // 0x4D
+  {   3,  26,  22 },   // 0x4E
+  {   2,  28,  26 },   // 0x4F
+  {   3,  21,  19 },   // 0x50
+  {   2,  28,  26 },   // 0x51
+  {   3,  24,  22 },   // 0x52
+  {   2,  22,  20 },   // 0x53
+  {   0,  21,  21 },   // 0x54
+  {   3,  26,  22 },   // 0x55
+  {   0,  24,  23 },   // 0x56
+  {   1,  35,  33 },   // 0x57
+  {   1,  24,  23 },   // 0x58
+  {   0,  21,  21 },   // 0x59
+  {   2,  24,  23 },   // 0x5A
+  {   3,  14,  10 },   // 0x5B
+  {   0,  12,  12 },   // 0x5C
+  {   3,  14,  10 },   // 0x5D
+  {   4,  29,  26 },   // 0x5E
+  {   0,  18,  18 },   // 0x5F
+  {   3,  18,  11 },   // 0x60
+  {   2,  21,  18 },   // 0x61
+  {   3,  22,  20 },   // 0x62
+  {   2,  19,  17 },   // 0x63
+  {   2,  22,  19 },   // 0x64
+  {   2,  22,  20 },   // 0x65
+  {   1,  12,  13 },   // 0x66
+  {   2,  22,  19 },   // 0x67
+  {   3,  22,  19 },   // 0x68
+  {   3,  10,   6 },   // 0x69
+  {  -1,  10,   6 },   // 0x6A
+  {   3,  20,  20 },   // 0x6B
+  {   3,  10,   6 },   // 0x6C
+  {   3,  34,  32 },   // 0x6D
+  {   3,  22,  19 },   // 0x6E
+  {   2,  21,  20 },   // 0x6F
+  {   3,  22,  20 },   // 0x70
+  {   2,  22,  19 },   // 0x71
+  {   3,  14,  14 },   // 0x72
+  {   2,  18,  17 },   // 0x73
+  {   1,  14,  12 },   // 0x74
+  {   3,  22,  19 },   // 0x75
+  {   1,  21,  20 },   // 0x76
+  {   1,  29,  27 },   // 0x77
+  {   1,  21,  20 },   // 0x78
+  {   1,  21,  20 },   // 0x79
+  {   2,  18,  17 },   // 0x7A
+  {   5,  22,  18 },   // 0x7B
+  {   4,  12,   7 },   // 0x7C
+  {   4,  22,  17 },   // 0x7D
+  {   4,  29,  26 },   // 0x7E
+  {   2,  21,  20 },   // 0x7F
+  {   2,  21,  20 },   // 0x80
+  {   2,  21,  20 },   // 0x81
+  {   2,  21,  20 },   // 0x82
+  {   2,  21,  20 },   // 0x83
+  {   2,  21,  20 },   // 0x84
+  {   2,  21,  20 },   // 0x85
+  {   2,  21,  20 },   // 0x86
+  {   2,  21,  20 },   // 0x87
+  {   2,  21,  20 },   // 0x88
+  {   2,  21,  20 },   // 0x89
+  {   2,  21,  20 },   // 0x8A
+  {   2,  21,  20 },   // 0x8B
+  {   2,  21,  20 },   // 0x8C
+  {   2,  21,  20 },   // 0x8D
+  {   2,  21,  20 },   // 0x8E
+  {   2,  21,  20 },   // 0x8F
+  {   2,  21,  20 },   // 0x90
+  {   2,  21,  20 },   // 0x91
+  {   2,  21,  20 },   // 0x92
+  {   2,  21,  20 },   // 0x93
+  {   2,  21,  20 },   // 0x94
+  {   2,  21,  20 },   // 0x95
+  {   2,  21,  20 },   // 0x96
+  {   2,  21,  20 },   // 0x97
+  {   2,  21,  20 },   // 0x98
+  {   2,  21,  20 },   // 0x99
+  {   2,  21,  20 },   // 0x9A
+  {   2,  21,  20 },   // 0x9B
+  {   2,  21,  20 },   // 0x9C
+  {   2,  21,  20 },   // 0x9D
+  {   2,  21,  20 },   // 0x9E
+  {   2,  21,  20 },   // 0x9F
+  {   0,  11,   1 },   // 0xA0
+  {   5,  14,   8 },   // 0xA1
+  {   3,  22,  18 },   // 0xA2
+  {   2,  22,  19 },   // 0xA3
+  {   2,  22,  21 },   // 0xA4
+  {   1,  22,  20 },   // 0xA5
+  {   4,  12,   7 },   // 0xA6
+  {   2,  18,  16 },   // 0xA7
+  {   4,  18,  15 },   // 0xA8
+  {   5,  35,  30 },   // 0xA9
+  {   2,  16,  14 },   // 0xAA
+  {   3,  21,  18 },   // 0xAB
+  {   4,  29,  26 },   // 0xAC
+  {   2,  13,  11 },   // 0xAD
+  {   5,  35,  30 },   // 0xAE
+  {   4,  18,  14 },   // 0xAF
+  {   3,  18,  14 },   // 0xB0
+  {   3,  29,  26 },   // 0xB1
+  {   2,  14,  12 },   // 0xB2
+  {   2,  14,  13 },   // 0xB3
+  {   7,  18,  15 },   // 0xB4
+  {   3,  22,  21 },   // 0xB5
+  {   3,  22,  19 },   // 0xB6
+  {   4,  11,   7 },   // 0xB7
+  {   5,  18,  12 },   // 0xB8
+  {   3,  14,  13 },   // 0xB9
+  {   2,  16,  15 },   // 0xBA
+  {   3,  21,  18 },   // 0xBB
+  {   3,  34,  33 },   // 0xBC
+  {   3,  34,  32 },   // 0xBD
+  {   2,  34,  33 },   // 0xBE
+  {   2,  19,  16 },   // 0xBF
+  {   0,  24,  23 },   // 0xC0
+  {   0,  24,  23 },   // 0xC1
+  {   0,  24,  23 },   // 0xC2
+  {   0,  24,  23 },   // 0xC3
+  {   0,  24,  23 },   // 0xC4
+  {   0,  24,  23 },   // 0xC5
+  {   0,  34,  31 },   // 0xC6
+  {   2,  24,  23 },   // 0xC7
+  {   3,  22,  19 },   // 0xC8
+  {   3,  22,  19 },   // 0xC9
+  {   3,  22,  19 },   // 0xCA
+  {   3,  22,  19 },   // 0xCB
+  {   1,  10,   8 },   // 0xCC
+  {   3,  10,  10 },   // 0xCD
+  {  -1,  10,  10 },   // 0xCE
+  {  -1,  10,  10 },   // 0xCF
+  {   1,  27,  25 },   // 0xD0
+  {   3,  26,  22 },   // 0xD1
+  {   2,  28,  26 },   // 0xD2
+  {   2,  28,  26 },   // 0xD3
+  {   2,  28,  26 },   // 0xD4
+  {   2,  28,  26 },   // 0xD5
+  {   2,  28,  26 },   // 0xD6
+  {   5,  29,  25 },   // 0xD7
+  {   2,  28,  26 },   // 0xD8
+  {   3,  26,  22 },   // 0xD9
+  {   3,  26,  22 },   // 0xDA
+  {   3,  26,  22 },   // 0xDB
+  {   3,  26,  22 },   // 0xDC
+  {   0,  21,  21 },   // 0xDD
+  {   3,  21,  19 },   // 0xDE
+  {   3,  22,  20 },   // 0xDF
+  {   2,  21,  18 },   // 0xE0
+  {   2,  21,  18 },   // 0xE1
+  {   2,  21,  18 },   // 0xE2
+  {   2,  21,  18 },   // 0xE3
+  {   2,  21,  18 },   // 0xE4
+  {   2,  21,  18 },   // 0xE5
+  {   2,  34,  32 },   // 0xE6
+  {   2,  19,  17 },   // 0xE7
+  {   2,  22,  20 },   // 0xE8
+  {   2,  22,  20 },   // 0xE9
+  {   2,  22,  20 },   // 0xEA
+  {   2,  22,  20 },   // 0xEB
+  {  -1,  10,   7 },   // 0xEC
+  {   3,  10,  11 },   // 0xED
+  {  -1,  10,  10 },   // 0xEE
+  {  -1,  10,  10 },   // 0xEF
+  {   2,  21,  20 },   // 0xF0
+  {   3,  22,  19 },   // 0xF1
+  {   2,  21,  20 },   // 0xF2
+  {   2,  21,  20 },   // 0xF3
+  {   2,  21,  20 },   // 0xF4
+  {   2,  21,  20 },   // 0xF5
+  {   2,  21,  20 },   // 0xF6
+  {   4,  29,  26 },   // 0xF7
+  {   1,  21,  21 },   // 0xF8
+  {   3,  22,  19 },   // 0xF9
+  {   3,  22,  19 },   // 0xFA
+  {   3,  22,  19 },   // 0xFB
+  {   3,  22,  19 },   // 0xFC
+  {   1,  21,  20 },   // 0xFD
+  {   3,  22,  20 },   // 0xFE
+  {   1,  21,  20 }    // 0xFF
+};
+const FontMetrics DejaVuSans18pt8bWidths = { DejaVuSans18pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS18PTLAT1__H
@@ -0,0 +1,1736 @@
+#ifndef DEJAVUSANS20PTLAT1__H
+#define DEJAVUSANS20PTLAT1__H
+const uint8_t DejaVuSans20pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0F, 0xFF, 0xFF, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F,
+  0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x00, 0x1C, 0x0E, 0x00, 0x03, 0x83, 0xC0,
+  0x00, 0xF0, 0x70, 0x00, 0x1C, 0x0E, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x70,
+  0x78, 0x00, 0x0E, 0x0E, 0x00, 0x03, 0x81, 0xC0, 0x3F, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x38, 0x00, 0x0E, 0x07,
+  0x00, 0x01, 0xC1, 0xE0, 0x00, 0x78, 0x38, 0x00, 0x0E, 0x07, 0x00, 0x01,
+  0xC0, 0xE0, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xC0, 0x38, 0x1C, 0x00, 0x07, 0x07, 0x80, 0x01, 0xE0, 0xE0, 0x00, 0x38,
+  0x1C, 0x00, 0x07, 0x03, 0x80, 0x00, 0xE0, 0xF0, 0x00, 0x3C, 0x1C, 0x00,
+  0x07, 0x03, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+  0x00, 0x07, 0xFC, 0x07, 0xFF, 0xC3, 0xFF, 0xF1, 0xF3, 0x0C, 0xF8, 0xC0,
+  0x3C, 0x30, 0x0F, 0x0C, 0x03, 0xC3, 0x00, 0xF8, 0xC0, 0x1F, 0xF0, 0x07,
+  0xFF, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xE0, 0x0C, 0xF8, 0x03,
+  0x1F, 0x00, 0xC3, 0xC0, 0x30, 0xF0, 0x0C, 0x3C, 0x03, 0x0F, 0x80, 0xC7,
+  0xFC, 0x33, 0xEF, 0xFF, 0xF1, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x30, 0x00,
+  0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x0F,
+  0x80, 0x01, 0xE0, 0x1F, 0xF0, 0x00, 0xE0, 0x1E, 0x3C, 0x00, 0xF0, 0x0E,
+  0x0E, 0x00, 0xF0, 0x0E, 0x03, 0x80, 0x70, 0x07, 0x01, 0xC0, 0x78, 0x03,
+  0x80, 0xE0, 0x38, 0x01, 0xC0, 0x70, 0x3C, 0x00, 0xE0, 0x38, 0x3C, 0x00,
+  0x70, 0x1C, 0x1C, 0x00, 0x38, 0x0E, 0x1E, 0x00, 0x0E, 0x0E, 0x0E, 0x00,
+  0x07, 0x8F, 0x0E, 0x00, 0x01, 0xFF, 0x0F, 0x00, 0x00, 0x3E, 0x07, 0x03,
+  0xE0, 0x00, 0x07, 0x87, 0xFC, 0x00, 0x03, 0x87, 0x8F, 0x00, 0x03, 0x83,
+  0x83, 0x80, 0x03, 0xC3, 0x80, 0xE0, 0x01, 0xC1, 0xC0, 0x70, 0x01, 0xE0,
+  0xE0, 0x38, 0x01, 0xE0, 0x70, 0x1C, 0x00, 0xE0, 0x38, 0x0E, 0x00, 0xF0,
+  0x1C, 0x07, 0x00, 0x70, 0x0E, 0x03, 0x80, 0x78, 0x03, 0x83, 0x80, 0x78,
+  0x01, 0xE3, 0xC0, 0x38, 0x00, 0x7F, 0xC0, 0x3C, 0x00, 0x0F, 0x80, 0x01,
+  0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xC1, 0xC0,
+  0x01, 0xF0, 0x08, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0x7C,
+  0x00, 0xF3, 0xC7, 0xC0, 0x1E, 0x78, 0x7C, 0x03, 0x9E, 0x07, 0xC0, 0xF3,
+  0xC0, 0x7C, 0x1E, 0x78, 0x07, 0xC3, 0x8F, 0x00, 0x7C, 0xF1, 0xE0, 0x07,
+  0xFC, 0x3E, 0x00, 0x7F, 0x03, 0xC0, 0x07, 0xE0, 0x7C, 0x01, 0xFE, 0x07,
+  0xE0, 0xFF, 0xE0, 0x7F, 0xFE, 0x7E, 0x07, 0xFF, 0x87, 0xE0, 0x1F, 0xC0,
+  0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0x83, 0x83, 0xC1, 0xC1, 0xE0,
+  0xE0, 0xF0, 0x78, 0x38, 0x3C, 0x1E, 0x0F, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0xF0, 0x78, 0x3C, 0x0E,
+  0x07, 0x83, 0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0x03, 0x80, 0xE0, 0xE0, 0x38,
+  0x1E, 0x07, 0x03, 0xC0, 0xE0, 0x78, 0x3C, 0x0E, 0x07, 0x83, 0xC1, 0xE0,
+  0x70, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1C,
+  0x1E, 0x0F, 0x07, 0x83, 0x83, 0xC1, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38,
+  0x38, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x41, 0x82, 0xE1, 0x87,
+  0x79, 0x9E, 0x3D, 0xBC, 0x0F, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x3D, 0xBC, 0x79, 0x9E, 0xE1, 0x87, 0x41, 0x82, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x70,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0xF3, 0xCF,
+  0x39, 0xC7, 0x38, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x00,
+  0x38, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0x0F, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x00,
+  0xE0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03,
+  0xC0, 0x1C, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x01, 0xF0,
+  0xF8, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x78,
+  0x01, 0xEF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x78, 0x01,
+  0xE3, 0xC0, 0x3C, 0x3C, 0x03, 0xC1, 0xF0, 0xF8, 0x0F, 0xFF, 0x00, 0x7F,
+  0xE0, 0x01, 0xF8, 0x00, 0x1F, 0xE0, 0x7F, 0xF0, 0x3F, 0xF8, 0x1E, 0x3C,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x3F, 0xFF, 0xDF,
+  0xFF, 0xEF, 0xFF, 0xF0, 0x0F, 0xF0, 0x1F, 0xFF, 0x0F, 0xFF, 0xF3, 0xE0,
+  0x7E, 0xE0, 0x0F, 0xA0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xC0,
+  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
+  0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00,
+  0x3F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x30, 0x0F, 0xC0, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x1E,
+  0x00, 0x0F, 0x80, 0x7F, 0xE0, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFC,
+  0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E,
+  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x1E, 0x80, 0x07, 0xDE, 0x03, 0xF3,
+  0xFF, 0xFC, 0x7F, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC,
+  0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0x78, 0x00, 0x7B, 0xC0, 0x03,
+  0x9E, 0x00, 0x38, 0xF0, 0x03, 0xC7, 0x80, 0x3C, 0x3C, 0x01, 0xC1, 0xE0,
+  0x1E, 0x0F, 0x01, 0xE0, 0x78, 0x0E, 0x03, 0xC0, 0xE0, 0x1E, 0x0F, 0x00,
+  0xF0, 0x70, 0x07, 0x87, 0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x7F, 0xFF, 0x1F,
+  0xFF, 0xC7, 0xFF, 0xF1, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xC1, 0xFF, 0xF8,
+  0x60, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
+  0x7A, 0x00, 0x3E, 0xE0, 0x3F, 0x3F, 0xFF, 0x8F, 0xFF, 0xC0, 0xFF, 0x80,
+  0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0xF8, 0x1C, 0x1E, 0x00,
+  0x43, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0xFC, 0x0F, 0x3F, 0xF0, 0xF7, 0xFF, 0x8F, 0xF0, 0x7C, 0xFE,
+  0x03, 0xEF, 0xC0, 0x1E, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF,
+  0x80, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x78, 0x01, 0xF3, 0xC0, 0x1E,
+  0x3E, 0x03, 0xE1, 0xF0, 0x7C, 0x0F, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFC,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x07, 0x80,
+  0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x01,
+  0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0,
+  0x00, 0xF8, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83,
+  0xE0, 0x7C, 0x7C, 0x03, 0xE7, 0x80, 0x1E, 0x78, 0x01, 0xE7, 0x80, 0x1E,
+  0x78, 0x01, 0xE7, 0x80, 0x1E, 0x3C, 0x03, 0xC1, 0xE0, 0x78, 0x0F, 0xFF,
+  0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0x83, 0xE0, 0x7C, 0x7C, 0x03, 0xE7, 0x80,
+  0x1E, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x80, 0x1F, 0x7C, 0x03, 0xE7, 0xE0, 0x7E, 0x3F, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF,
+  0x03, 0xE0, 0xF8, 0x7C, 0x07, 0xC7, 0x80, 0x3C, 0xF0, 0x01, 0xEF, 0x00,
+  0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
+  0x01, 0xF7, 0x80, 0x3F, 0x7C, 0x07, 0xF3, 0xE0, 0xFF, 0x1F, 0xFE, 0xF0,
+  0xFF, 0xCF, 0x03, 0xF0, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x20, 0x07, 0x83, 0x81, 0xF0, 0x3F, 0xFE,
+  0x03, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x3C, 0xF3, 0xCE, 0x71, 0xCE, 0x30, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFE, 0x00, 0x0F,
+  0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0,
+  0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F,
+  0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x03,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
+  0x00, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00,
+  0x00, 0x0F, 0xE0, 0xFF, 0xE3, 0xFF, 0xF7, 0x83, 0xEC, 0x03, 0xF0, 0x03,
+  0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
+  0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
+  0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xF0, 0x0F,
+  0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0xF0, 0x00,
+  0x01, 0xE0, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x07, 0x8E, 0x01,
+  0xF8, 0xE0, 0xE7, 0x80, 0xFF, 0xB8, 0x39, 0xC0, 0x7F, 0xFE, 0x07, 0x70,
+  0x3E, 0x1F, 0x81, 0xF8, 0x0E, 0x01, 0xE0, 0x7E, 0x07, 0x80, 0x78, 0x1F,
+  0x81, 0xC0, 0x0E, 0x07, 0xE0, 0x70, 0x03, 0x81, 0xF8, 0x1C, 0x00, 0xE0,
+  0x7E, 0x07, 0x00, 0x38, 0x3B, 0x81, 0xC0, 0x1E, 0x1E, 0xE0, 0x38, 0x07,
+  0x87, 0x1C, 0x0F, 0x87, 0xE7, 0x87, 0x01, 0xFF, 0xFF, 0xC1, 0xE0, 0x3F,
+  0xEF, 0xE0, 0x38, 0x07, 0xE3, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x20, 0x01,
+  0xF8, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x03, 0xFF, 0xFF, 0x00,
+  0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xCF, 0x00, 0x00,
+  0xF3, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x87, 0xC0,
+  0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x80, 0x1E, 0x01,
+  0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x00, 0xF0,
+  0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01, 0xE7, 0x80, 0x00,
+  0x7B, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xCF,
+  0x00, 0x7C, 0xF0, 0x03, 0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x1E,
+  0xF0, 0x01, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xF8, 0xF0, 0x07, 0xCF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x01, 0xFF, 0x00, 0x1E, 0xF0, 0x07, 0xEF, 0xFF, 0xFC, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x7F,
+  0x03, 0xF1, 0xF0, 0x00, 0xE7, 0xC0, 0x00, 0xCF, 0x00, 0x00, 0xBE, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x9F, 0x00, 0x03, 0x1F,
+  0x00, 0x0E, 0x1F, 0xC0, 0xFC, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x03,
+  0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xF0,
+  0x07, 0xF0, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0xF0,
+  0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
+  0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x7C, 0xF0,
+  0x00, 0xF8, 0xF0, 0x07, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x81, 0xFC,
+  0x07, 0xE1, 0xF0, 0x00, 0xF1, 0xF0, 0x00, 0x18, 0xF0, 0x00, 0x04, 0xF8,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x07, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01,
+  0xEF, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x7B, 0xC0, 0x00, 0x3C, 0xF0, 0x00,
+  0x1E, 0x7C, 0x00, 0x0F, 0x1F, 0x00, 0x07, 0x87, 0xF0, 0x0F, 0xC1, 0xFF,
+  0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x0F, 0xBF, 0xCF, 0xE3, 0xE0,
+  0xF0, 0x01, 0xF9, 0xE0, 0x07, 0xE3, 0xC0, 0x1F, 0x87, 0x80, 0x7E, 0x0F,
+  0x01, 0xF8, 0x1E, 0x07, 0xE0, 0x3C, 0x1F, 0x80, 0x78, 0x7E, 0x00, 0xF1,
+  0xF8, 0x01, 0xE7, 0xE0, 0x03, 0xDF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xF7, 0xE0,
+  0x01, 0xE7, 0xE0, 0x03, 0xC3, 0xE0, 0x07, 0x83, 0xE0, 0x0F, 0x03, 0xE0,
+  0x1E, 0x03, 0xE0, 0x3C, 0x03, 0xE0, 0x78, 0x03, 0xE0, 0xF0, 0x03, 0xE1,
+  0xE0, 0x03, 0xE3, 0xC0, 0x03, 0xE7, 0x80, 0x03, 0xE0, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFD, 0xE0, 0x1E, 0xFF, 0x78, 0x07, 0xBF, 0xDF,
+  0x03, 0xEF, 0xF3, 0xC0, 0xF3, 0xFC, 0xF0, 0x3C, 0xFF, 0x1E, 0x1E, 0x3F,
+  0xC7, 0x87, 0x8F, 0xF1, 0xF3, 0xE3, 0xFC, 0x3C, 0xF0, 0xFF, 0x0F, 0x3C,
+  0x3F, 0xC3, 0xFF, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07,
+  0xF8, 0x3F, 0xC0, 0xFC, 0x0F, 0xF0, 0x3F, 0x03, 0xFC, 0x07, 0x80, 0xFF,
+  0x01, 0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
+  0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0xFF,
+  0xF8, 0x03, 0xFD, 0xF0, 0x0F, 0xF3, 0xC0, 0x3F, 0xCF, 0x80, 0xFF, 0x1E,
+  0x03, 0xFC, 0x7C, 0x0F, 0xF0, 0xF0, 0x3F, 0xC3, 0xE0, 0xFF, 0x07, 0xC3,
+  0xFC, 0x0F, 0x0F, 0xF0, 0x3E, 0x3F, 0xC0, 0x78, 0xFF, 0x01, 0xF3, 0xFC,
+  0x03, 0xCF, 0xF0, 0x0F, 0xBF, 0xC0, 0x1F, 0xFF, 0x00, 0x7F, 0xFC, 0x00,
+  0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0x03,
+  0xF0, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x00, 0xF1, 0xF0,
+  0x00, 0x3E, 0x78, 0x00, 0x07, 0x9E, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3D, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0x9F, 0x00, 0x03, 0xE3,
+  0xC0, 0x00, 0xF0, 0xF8, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x03, 0xF0, 0x3F,
+  0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF,
+  0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xC0, 0x7E, 0xF0, 0x07, 0xBC, 0x01,
+  0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x1F, 0xF0, 0x07, 0xBC, 0x07, 0xEF, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF,
+  0xF0, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x80,
+  0x3F, 0x03, 0xF0, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x00,
+  0xF1, 0xF0, 0x00, 0x3E, 0x78, 0x00, 0x07, 0x9E, 0x00, 0x01, 0xEF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0x9F, 0x00,
+  0x03, 0xE3, 0xC0, 0x00, 0xF0, 0xF8, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x03,
+  0xF0, 0x3F, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xE0,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x3C, 0x07, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x0F, 0x0F, 0x00, 0x3C,
+  0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x7C, 0x3C,
+  0x01, 0xE0, 0xF0, 0x1F, 0x83, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x80, 0xF0, 0x3F, 0x03, 0xC0, 0x3C, 0x0F, 0x00, 0xF8, 0x3C, 0x01, 0xF0,
+  0xF0, 0x07, 0xC3, 0xC0, 0x0F, 0x8F, 0x00, 0x1E, 0x3C, 0x00, 0x7C, 0xF0,
+  0x00, 0xF3, 0xC0, 0x03, 0xEF, 0x00, 0x07, 0xBC, 0x00, 0x1F, 0x03, 0xFC,
+  0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0xC7, 0xE0, 0x7C, 0x78, 0x00, 0xCF, 0x80,
+  0x04, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
+  0x1F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xE0, 0x03,
+  0xEF, 0x80, 0x7E, 0xFF, 0xFF, 0xC7, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xE0, 0x01, 0xE7,
+  0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3F, 0x03, 0xF0, 0x7F, 0xFF, 0x80, 0xFF,
+  0xFC, 0x00, 0x7F, 0x80, 0xF0, 0x00, 0x03, 0xDE, 0x00, 0x01, 0xE7, 0x80,
+  0x00, 0x79, 0xF0, 0x00, 0x3E, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC1,
+  0xE0, 0x01, 0xF0, 0x78, 0x00, 0x78, 0x1F, 0x00, 0x3E, 0x03, 0xC0, 0x0F,
+  0x00, 0xF0, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0x78, 0x01, 0xE0,
+  0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xE1, 0xF0, 0x00,
+  0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0,
+  0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0x80, 0x1F, 0x78, 0x01, 0xF8, 0x01,
+  0xE7, 0x80, 0x1F, 0x80, 0x1E, 0x78, 0x01, 0xF8, 0x01, 0xE7, 0xC0, 0x3F,
+  0xC0, 0x3E, 0x3C, 0x03, 0x9C, 0x03, 0xC3, 0xC0, 0x39, 0xC0, 0x3C, 0x3C,
+  0x03, 0x9C, 0x03, 0xC3, 0xE0, 0x79, 0xE0, 0x7C, 0x1E, 0x07, 0x0E, 0x07,
+  0x81, 0xE0, 0x70, 0xE0, 0x78, 0x1E, 0x07, 0x0E, 0x07, 0x81, 0xF0, 0xF0,
+  0xF0, 0xF8, 0x0F, 0x0E, 0x07, 0x0F, 0x00, 0xF0, 0xE0, 0x70, 0xF0, 0x0F,
+  0x0E, 0x07, 0x0F, 0x00, 0xF9, 0xE0, 0x79, 0xF0, 0x07, 0x9C, 0x03, 0x9E,
+  0x00, 0x79, 0xC0, 0x39, 0xE0, 0x07, 0x9C, 0x03, 0x9E, 0x00, 0x7F, 0xC0,
+  0x3F, 0xE0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x03,
+  0xF8, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x01, 0xF0, 0x00, 0xF8,
+  0x00, 0x1F, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1E,
+  0x00, 0x78, 0x1F, 0x00, 0xF8, 0x0F, 0x81, 0xF0, 0x07, 0x81, 0xE0, 0x07,
+  0xC3, 0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xE7, 0x80, 0x01, 0xFF, 0x80, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03,
+  0xE7, 0xC0, 0x03, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0x81, 0xF0, 0x0F,
+  0x00, 0xF0, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x7C, 0x7C,
+  0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x3E,
+  0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x81, 0xF0, 0x0F,
+  0x81, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x01,
+  0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xFF, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
+  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C,
+  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+  0x7C, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E,
+  0x00, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x07, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x07, 0x00, 0x3C, 0x00,
+  0xE0, 0x07, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0xE0, 0x07,
+  0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x07, 0xFF, 0xFF,
+  0xFF, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01,
+  0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x07, 0xC3, 0xE0, 0x0F, 0x81, 0xF0, 0x1E,
+  0x00, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x3C, 0x0F, 0x03, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xE0, 0x7C,
+  0x20, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC1,
+  0xFF, 0xF1, 0xFF, 0xFD, 0xFF, 0xFF, 0x7C, 0x03, 0xFE, 0x00, 0xFF, 0x00,
+  0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xFE, 0x03, 0xF7, 0xC1, 0xFD, 0xFF, 0xEF,
+  0x3F, 0xF3, 0xC3, 0xF0, 0xF0, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00,
+  0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0xF8, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F, 0x07, 0xCF, 0xC0, 0x7D,
+  0xF0, 0x07, 0xBE, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F,
+  0xC0, 0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xFB, 0xF8, 0x3E, 0x7B, 0xFF, 0x8F,
+  0x3F, 0xE1, 0xE1, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xFF, 0x87, 0xFF, 0xE7,
+  0xE0, 0x73, 0xC0, 0x0B, 0xE0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xE0,
+  0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x4F, 0xC0, 0xE3, 0xFF, 0xF0,
+  0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x03,
+  0xE1, 0xE1, 0xFF, 0x3C, 0x7F, 0xF7, 0x9F, 0x07, 0xF7, 0xC0, 0x7E, 0xF0,
+  0x07, 0xDE, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7B, 0xC0,
+  0x1F, 0x78, 0x03, 0xEF, 0x80, 0xFC, 0xF8, 0x3F, 0x8F, 0xFE, 0xF0, 0xFF,
+  0x9E, 0x07, 0xC3, 0xC0, 0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x83,
+  0xF0, 0x7C, 0x3C, 0x03, 0xE7, 0x80, 0x1E, 0x78, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x02, 0x3F, 0x01, 0xE1, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x1F, 0xE0, 0x01,
+  0xFC, 0x1F, 0xF0, 0xFF, 0xC3, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x1E, 0x03, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00,
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0x3C, 0x7F, 0xF7, 0x9F,
+  0x07, 0xF7, 0xC0, 0x7E, 0xF0, 0x07, 0xDE, 0x00, 0xFF, 0x80, 0x0F, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7B, 0xC0, 0x1F, 0x78, 0x03, 0xEF, 0x80, 0xFC, 0xF8,
+  0x3F, 0x8F, 0xFE, 0xF0, 0xFF, 0x9E, 0x07, 0xC3, 0xC0, 0x00, 0x78, 0x00,
+  0x1F, 0x00, 0x03, 0xC2, 0x00, 0xF8, 0x70, 0x3E, 0x0F, 0xFF, 0xC0, 0xFF,
+  0xE0, 0x07, 0xF0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0xFC,
+  0x3C, 0xFF, 0x8F, 0x7F, 0xF3, 0xF8, 0x3E, 0xFC, 0x07, 0xBE, 0x01, 0xFF,
+  0x80, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xF0,
+  0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x1E, 0xFE, 0xFC, 0xF0, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00,
+  0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0x00, 0x1E, 0x01, 0xFB, 0xC0, 0x7E, 0x78, 0x1F, 0x8F, 0x07, 0xE1,
+  0xE1, 0xF8, 0x3C, 0x7E, 0x07, 0xBF, 0x80, 0xFF, 0xC0, 0x1F, 0xF0, 0x03,
+  0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF8, 0x01, 0xEF, 0x80, 0x3C, 0xF8, 0x07,
+  0x8F, 0x80, 0xF0, 0xF8, 0x1E, 0x0F, 0x83, 0xC0, 0xF8, 0x78, 0x0F, 0x8F,
+  0x00, 0xF9, 0xE0, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x07, 0xC3,
+  0xCF, 0xF0, 0x7F, 0xCF, 0x7F, 0xE3, 0xFF, 0x3F, 0x87, 0xDC, 0x3E, 0xFC,
+  0x0F, 0xE0, 0x7B, 0xE0, 0x3F, 0x01, 0xFF, 0x80, 0x7C, 0x03, 0xFC, 0x01,
+  0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0xFF, 0x00, 0x78,
+  0x03, 0xFC, 0x01, 0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x3F, 0xC0, 0x1E, 0x00,
+  0xFF, 0x00, 0x78, 0x03, 0xFC, 0x01, 0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x3F,
+  0xC0, 0x1E, 0x00, 0xFF, 0x00, 0x78, 0x03, 0xFC, 0x01, 0xE0, 0x0F, 0xF0,
+  0x07, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0xFC, 0x3C, 0xFF, 0x8F,
+  0x7F, 0xF3, 0xF8, 0x3E, 0xFC, 0x07, 0xBE, 0x01, 0xFF, 0x80, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xF0, 0x01, 0xFC, 0x00,
+  0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xF0, 0xFC, 0x7C, 0x03, 0xC7, 0x80, 0x1E,
+  0x78, 0x01, 0xEF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF7, 0x80,
+  0x1E, 0x78, 0x01, 0xE7, 0xC0, 0x3E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F,
+  0xFF, 0x00, 0x3F, 0x80, 0x00, 0xF8, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F,
+  0x07, 0xCF, 0xC0, 0x7D, 0xF0, 0x07, 0xBE, 0x00, 0xF7, 0x80, 0x0F, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xFB, 0xF8,
+  0x3E, 0x7B, 0xFF, 0x8F, 0x3F, 0xE1, 0xE1, 0xF0, 0x3C, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0x3C, 0x7F, 0xF7, 0x9F,
+  0x07, 0xF7, 0xC0, 0x7E, 0xF0, 0x07, 0xDE, 0x00, 0xFF, 0x80, 0x0F, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7B, 0xC0, 0x1F, 0x78, 0x03, 0xEF, 0x80, 0xFC, 0xF8,
+  0x3F, 0x8F, 0xFE, 0xF0, 0xFF, 0x9E, 0x07, 0xC3, 0xC0, 0x00, 0x78, 0x00,
+  0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+  0x1E, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0x9F, 0xFD, 0xFF, 0xFE, 0x1F, 0xC0,
+  0x7C, 0x03, 0xE0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
+  0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x00, 0x0F, 0xF0, 0x3F, 0xFC, 0x7F, 0xFE, 0x7C, 0x0E,
+  0xF8, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x7F, 0x00,
+  0x3F, 0xF0, 0x0F, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x0F,
+  0x00, 0x0F, 0x80, 0x1F, 0xF0, 0x3E, 0xFF, 0xFE, 0xFF, 0xF8, 0x3F, 0xE0,
+  0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0xFC, 0x1F, 0xF0, 0x1F, 0xC0,
+  0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
+  0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F,
+  0xF8, 0x07, 0xDE, 0x03, 0xF7, 0xC1, 0xFC, 0xFF, 0xEF, 0x1F, 0xF3, 0xC3,
+  0xF0, 0xF0, 0xF0, 0x00, 0x7B, 0xC0, 0x07, 0x9E, 0x00, 0x3C, 0xF8, 0x03,
+  0xE3, 0xC0, 0x1E, 0x1E, 0x00, 0xF0, 0x78, 0x0F, 0x83, 0xC0, 0x78, 0x1F,
+  0x07, 0xC0, 0x78, 0x3C, 0x03, 0xC1, 0xE0, 0x1F, 0x1F, 0x00, 0x78, 0xF0,
+  0x03, 0xEF, 0x80, 0x0F, 0x78, 0x00, 0x7B, 0xC0, 0x03, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x0F,
+  0x80, 0x7F, 0xC0, 0x7C, 0x07, 0xDE, 0x03, 0xE0, 0x3C, 0xF0, 0x3F, 0x81,
+  0xE7, 0x81, 0xDC, 0x0F, 0x3E, 0x0E, 0xE0, 0xF8, 0xF0, 0x77, 0x07, 0x87,
+  0x87, 0x9C, 0x3C, 0x3C, 0x38, 0xE1, 0xE0, 0xF1, 0xC7, 0x1E, 0x07, 0x8E,
+  0x38, 0xF0, 0x3C, 0xE0, 0xE7, 0x81, 0xF7, 0x07, 0x7C, 0x07, 0xB8, 0x3B,
+  0xC0, 0x3F, 0xC1, 0xFE, 0x01, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80,
+  0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x0F, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x3C,
+  0x01, 0xE0, 0x00, 0x7C, 0x00, 0xF9, 0xF0, 0x0F, 0x87, 0xC0, 0xF8, 0x1F,
+  0x0F, 0x80, 0xFC, 0xFC, 0x03, 0xE7, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0,
+  0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x1F,
+  0xE0, 0x01, 0xFF, 0x80, 0x1F, 0x7C, 0x01, 0xF9, 0xF0, 0x0F, 0x87, 0xC0,
+  0xF8, 0x3E, 0x0F, 0x80, 0xF8, 0xF8, 0x03, 0xEF, 0xC0, 0x0F, 0x80, 0xF8,
+  0x00, 0xFB, 0xC0, 0x07, 0x9E, 0x00, 0x3C, 0xF8, 0x03, 0xE3, 0xC0, 0x1E,
+  0x1F, 0x01, 0xF0, 0x78, 0x0F, 0x03, 0xE0, 0x78, 0x0F, 0x07, 0xC0, 0x78,
+  0x3C, 0x03, 0xE3, 0xE0, 0x0F, 0x1E, 0x00, 0x7D, 0xF0, 0x01, 0xEF, 0x00,
+  0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3E,
+  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01,
+  0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x00,
+  0x7C, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0xFF, 0x03, 0xE0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0xFF, 0x00, 0xFC,
+  0x00, 0xFF, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x07, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xFF, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0xFF, 0x80,
+  0xFF, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0x3F, 0xF0, 0x03, 0x7F, 0xFE,
+  0x0F, 0xF0, 0x7F, 0xFE, 0xC0, 0x0F, 0xFC, 0x80, 0x03, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x30,
+  0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0F, 0xE0, 0x1F,
+  0xFC, 0x3F, 0xFF, 0x3F, 0x33, 0x9F, 0x18, 0x5F, 0x0C, 0x0F, 0x06, 0x0F,
+  0x83, 0x07, 0x81, 0x83, 0xC0, 0xC1, 0xE0, 0x60, 0xF0, 0x30, 0x78, 0x18,
+  0x3C, 0x0C, 0x1F, 0x06, 0x07, 0x83, 0x03, 0xE1, 0x80, 0xF8, 0xC2, 0x7E,
+  0x67, 0x1F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x06, 0x00, 0x03, 0x00,
+  0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x3F, 0x80, 0x0F, 0xFE, 0x01,
+  0xFF, 0xF0, 0x3F, 0x07, 0x03, 0xC0, 0x10, 0x7C, 0x00, 0x07, 0x80, 0x00,
+  0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00,
+  0x07, 0x80, 0x00, 0x78, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x20, 0x00, 0x11, 0xC0, 0x00,
+  0xEF, 0x80, 0x07, 0xDF, 0x3F, 0x3E, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80,
+  0xF8, 0x7C, 0x03, 0x80, 0x70, 0x1E, 0x01, 0xE0, 0x70, 0x03, 0x81, 0xC0,
+  0x0E, 0x07, 0x00, 0x38, 0x1C, 0x00, 0xE0, 0x78, 0x07, 0x80, 0xE0, 0x1C,
+  0x03, 0xE1, 0xF0, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC7, 0xCF, 0xCF, 0xBE,
+  0x00, 0x1F, 0x70, 0x00, 0x38, 0x80, 0x00, 0x40, 0xF8, 0x00, 0x7D, 0xE0,
+  0x01, 0xE7, 0xC0, 0x0F, 0x8F, 0x80, 0x7C, 0x3E, 0x01, 0xF0, 0x7C, 0x0F,
+  0x80, 0xF0, 0x3C, 0x03, 0xE1, 0xF0, 0x07, 0x87, 0x80, 0x1F, 0x3E, 0x00,
+  0x3F, 0xF0, 0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF8, 0x03, 0xF0, 0x00, 0x0F,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+  0x80, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x07, 0xF0, 0x1F, 0xFC, 0x3F, 0xFC, 0x7C, 0x0C, 0x78, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x1F, 0xC0,
+  0x3B, 0xF0, 0x78, 0xF8, 0xF0, 0x7C, 0xF0, 0x3E, 0xF0, 0x1F, 0xF0, 0x0F,
+  0xF8, 0x0F, 0x7C, 0x0F, 0x3E, 0x0F, 0x1F, 0x9E, 0x07, 0xFC, 0x03, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+  0x30, 0x3E, 0x3F, 0xFC, 0x3F, 0xF8, 0x0F, 0xE0, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xC0, 0x7C,
+  0x00, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x07, 0x01, 0xC0, 0x00, 0x38, 0x38,
+  0x1F, 0xC1, 0xC3, 0x07, 0xFF, 0x0C, 0x60, 0xF0, 0x30, 0x66, 0x1E, 0x00,
+  0x06, 0xE1, 0xC0, 0x00, 0x7C, 0x38, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x3C,
+  0x38, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x3C, 0x38, 0x00, 0x03, 0xC3, 0x80,
+  0x00, 0x3C, 0x1C, 0x00, 0x07, 0x61, 0xE0, 0x00, 0x66, 0x0F, 0x01, 0x06,
+  0x30, 0x7F, 0xF0, 0xC3, 0x81, 0xFC, 0x1C, 0x1C, 0x00, 0x03, 0x80, 0xE0,
+  0x00, 0x70, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0xFF, 0xF0,
+  0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC1, 0xFF, 0xC6, 0x07, 0x80, 0x0E, 0x00,
+  0x1C, 0x00, 0x70, 0xFF, 0xCF, 0xFF, 0x78, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
+  0x0F, 0xE0, 0x3D, 0xC3, 0xF7, 0xFD, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0x7C, 0x7C,
+  0x1F, 0x1F, 0x03, 0xC3, 0xC0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0E, 0x0E, 0x03,
+  0x03, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
+  0x03, 0xC0, 0x7C, 0x00, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x07, 0x01, 0xC0,
+  0x00, 0x38, 0x38, 0xFF, 0x81, 0xC3, 0x0F, 0xFE, 0x0C, 0x60, 0xE0, 0xF0,
+  0x66, 0x0E, 0x07, 0x06, 0xE0, 0xE0, 0x70, 0x7C, 0x0E, 0x07, 0x03, 0xC0,
+  0xE0, 0xE0, 0x3C, 0x0F, 0xFE, 0x03, 0xC0, 0xFF, 0x00, 0x3C, 0x0E, 0x38,
+  0x03, 0xC0, 0xE1, 0xC0, 0x3C, 0x0E, 0x1E, 0x07, 0x60, 0xE0, 0xE0, 0x66,
+  0x0E, 0x07, 0x06, 0x30, 0xE0, 0x70, 0xC3, 0x8E, 0x03, 0x9C, 0x1C, 0x00,
+  0x03, 0x80, 0xE0, 0x00, 0x70, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x03, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x70, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0xFB,
+  0x07, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0x1F, 0x87, 0xFE, 0x60, 0xF0,
+  0x07, 0x00, 0x70, 0x0E, 0x1F, 0xC1, 0xFC, 0x01, 0xE0, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x78, 0x1E, 0xFF, 0xC7, 0xF0, 0x07, 0x87, 0x87, 0x83, 0x83,
+  0x83, 0x83, 0x80, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF1, 0xE0,
+  0x07, 0x8F, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x78,
+  0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF1, 0xE0, 0x07, 0x8F, 0x00,
+  0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0xF8, 0xF8, 0x07, 0xC7,
+  0xE0, 0xFE, 0x3F, 0xFF, 0xFF, 0xEF, 0xF3, 0xFF, 0x3F, 0x0F, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC7, 0xFF,
+  0xF3, 0xFE, 0x1D, 0xFF, 0x87, 0x7F, 0xE1, 0xFF, 0xF8, 0x7F, 0xFE, 0x1F,
+  0xFF, 0x87, 0xFF, 0xE1, 0xFF, 0xF8, 0x7F, 0xFE, 0x1D, 0xFF, 0x87, 0x7F,
+  0xE1, 0xCF, 0xF8, 0x71, 0xFE, 0x1C, 0x0F, 0x87, 0x00, 0xE1, 0xC0, 0x38,
+  0x70, 0x0E, 0x1C, 0x03, 0x87, 0x00, 0xE1, 0xC0, 0x38, 0x70, 0x0E, 0x1C,
+  0x03, 0x87, 0x00, 0xE1, 0xC0, 0x38, 0x70, 0x0E, 0x1C, 0x03, 0x87, 0x00,
+  0xE1, 0xC0, 0x38, 0x70, 0x0E, 0x1C, 0x03, 0x87, 0xFF, 0xFF, 0xF0, 0x0C,
+  0x06, 0x07, 0x07, 0x07, 0x8F, 0xFE, 0xFC, 0x3E, 0x1F, 0xC3, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x3F, 0xFF, 0xFF, 0x07, 0xE0, 0x3F, 0xE0, 0xE0, 0xE3, 0x80,
+  0xE7, 0x01, 0xDC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3B, 0x80, 0xE7, 0x01, 0xC7, 0x8F, 0x07, 0xFC, 0x03, 0xF0, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xF3, 0xFF, 0xE0, 0x80, 0x80, 0x60, 0x60, 0x38,
+  0x38, 0x1E, 0x1E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0x7C, 0x7C, 0x1F, 0x1F,
+  0x07, 0x87, 0x87, 0xC7, 0xC7, 0xC7, 0xC7, 0x87, 0x87, 0x87, 0x87, 0x87,
+  0x83, 0x83, 0x81, 0x81, 0x80, 0x80, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xE0,
+  0x3F, 0x80, 0x00, 0x70, 0x0C, 0xE0, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x1E,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x03, 0x80,
+  0x0E, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x0E,
+  0x00, 0xE0, 0x00, 0x03, 0x80, 0x78, 0x07, 0x8F, 0xFE, 0x1C, 0x01, 0xE3,
+  0xFF, 0x8F, 0x00, 0xF8, 0x00, 0x03, 0x80, 0x6E, 0x00, 0x01, 0xC0, 0x33,
+  0x80, 0x00, 0xF0, 0x1C, 0xE0, 0x00, 0x38, 0x06, 0x38, 0x00, 0x1E, 0x03,
+  0x0E, 0x00, 0x07, 0x01, 0x83, 0x80, 0x03, 0x80, 0xC0, 0xE0, 0x01, 0xE0,
+  0x3F, 0xFF, 0x00, 0x70, 0x0F, 0xFF, 0xC0, 0x3C, 0x00, 0x03, 0x80, 0x1E,
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x38, 0x03, 0xC0, 0x00, 0x0E, 0x00,
+  0x3E, 0x00, 0x01, 0xE0, 0xFE, 0x00, 0x01, 0xC0, 0xCE, 0x00, 0x03, 0xC0,
+  0x0E, 0x00, 0x07, 0x80, 0x0E, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0F, 0x00,
+  0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x3C, 0x00,
+  0x0E, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x70, 0x00,
+  0x0E, 0x00, 0xE0, 0x00, 0x0E, 0x01, 0xE1, 0xF8, 0xFF, 0xE1, 0xC7, 0xFE,
+  0xFF, 0xE3, 0xC6, 0x0E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x0F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78,
+  0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0x80,
+  0x01, 0xC0, 0x07, 0xFF, 0x03, 0xC0, 0x07, 0xFF, 0x1F, 0x80, 0x00, 0xF0,
+  0x0F, 0xFC, 0x00, 0x1C, 0x01, 0x83, 0xC0, 0x07, 0x80, 0x00, 0x38, 0x01,
+  0xE0, 0x00, 0x07, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x0F, 0x00, 0x07, 0xF0,
+  0x01, 0xC0, 0x00, 0xFE, 0x00, 0x70, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00,
+  0x0E, 0x03, 0x80, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x00, 0x38, 0x1C, 0x00,
+  0x00, 0x07, 0x07, 0x00, 0x01, 0x03, 0xC1, 0xE0, 0x1E, 0x3F, 0xF0, 0x38,
+  0x03, 0xC3, 0xF8, 0x0F, 0x00, 0xF8, 0x00, 0x01, 0xC0, 0x37, 0x00, 0x00,
+  0x70, 0x0C, 0xE0, 0x00, 0x1E, 0x03, 0x9C, 0x00, 0x03, 0x80, 0x63, 0x80,
+  0x00, 0xF0, 0x18, 0x70, 0x00, 0x1C, 0x06, 0x0E, 0x00, 0x07, 0x01, 0x81,
+  0xC0, 0x01, 0xE0, 0x3F, 0xFF, 0x00, 0x38, 0x07, 0xFF, 0xE0, 0x0F, 0x00,
+  0x00, 0xE0, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x03, 0x80, 0x1E,
+  0x00, 0x00, 0x70, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x1E, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x01,
+  0xF8, 0x06, 0xF8, 0x3D, 0xFF, 0xF8, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00,
+  0x0F, 0x87, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F,
+  0x80, 0x1E, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F, 0x80, 0x07, 0x83,
+  0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01,
+  0xE7, 0x80, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xCF, 0x00, 0x00,
+  0xF3, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x87, 0xC0,
+  0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x80, 0x1E, 0x01,
+  0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x00, 0xF0,
+  0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01, 0xE7, 0x80, 0x00,
+  0x7B, 0xC0, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
+  0x38, 0x00, 0x03, 0x87, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
+  0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00,
+  0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x87, 0xC0, 0x03, 0xC0, 0xF0,
+  0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x80, 0x1E, 0x01, 0xE0, 0x0F, 0x80,
+  0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1E,
+  0x00, 0x1E, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3C,
+  0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x7B, 0xC0, 0x00,
+  0x0F, 0x00, 0x70, 0x60, 0x00, 0x3F, 0x18, 0x00, 0x18, 0xFC, 0x00, 0x06,
+  0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F,
+  0xFC, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0x78, 0x00,
+  0x1E, 0x1E, 0x00, 0x0F, 0x87, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C,
+  0x00, 0x7C, 0x0F, 0x80, 0x1E, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F,
+  0x80, 0x07, 0x83, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F,
+  0x9E, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x01, 0xE1,
+  0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00,
+  0x0F, 0x87, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F,
+  0x80, 0x1E, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F, 0x80, 0x07, 0x83,
+  0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01,
+  0xE7, 0x80, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x00, 0x1F,
+  0xE0, 0x00, 0x06, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xC0, 0x00,
+  0x30, 0x30, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x87, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x01,
+  0xF3, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x03, 0xC0,
+  0x03, 0xC0, 0xF0, 0x01, 0xF0, 0x3E, 0x00, 0x78, 0x07, 0x80, 0x1E, 0x01,
+  0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x00, 0xF0,
+  0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x9E, 0x00, 0x01, 0xE7, 0x80, 0x00,
+  0x7B, 0xC0, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+  0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0x3C, 0x00, 0x00, 0x03, 0xC7,
+  0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x03,
+  0xC3, 0xC0, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00,
+  0x07, 0xC1, 0xE0, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xE0, 0x1E, 0x07, 0xFF,
+  0xFC, 0x07, 0xC0, 0xFF, 0xFF, 0x80, 0xF0, 0x1E, 0x00, 0x00, 0x3E, 0x03,
+  0xC0, 0x00, 0x07, 0x80, 0x78, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x01, 0xE0, 0x03, 0xC0,
+  0x00, 0x7C, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFD, 0xE0, 0x01,
+  0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xF0, 0x7F, 0x03, 0xF1, 0xF0, 0x00, 0xE7, 0xC0, 0x00,
+  0xCF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0,
+  0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00,
+  0x00, 0x9F, 0x00, 0x03, 0x1F, 0x00, 0x0E, 0x1F, 0xC0, 0xFC, 0x1F, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x8F, 0x00,
+  0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1C,
+  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x01, 0xE0, 0x00, 0xFC, 0x00, 0x73, 0x80, 0x38, 0x70, 0x1C, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF,
+  0xFF, 0xEF, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x03,
+  0xC3, 0xC0, 0xF0, 0xF0, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x00,
+  0x00, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+  0xF1, 0xE0, 0x1E, 0x38, 0xE3, 0x8E, 0x00, 0x00, 0x00, 0xF1, 0xE3, 0xC7,
+  0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x80, 0x0F, 0x01,
+  0xF8, 0x39, 0xC7, 0x0E, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0xF0, 0x07, 0xF0,
+  0x0F, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x7C, 0x0F, 0x00, 0x03, 0xC0, 0xF0,
+  0x00, 0x1E, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1F, 0x0F, 0x00, 0x00,
+  0xF0, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xFC, 0x00, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00,
+  0x0F, 0x0F, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x01, 0xE0,
+  0xF0, 0x00, 0x3C, 0x0F, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0xF8, 0x0F, 0x00,
+  0x7F, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+  0x01, 0xC1, 0x80, 0x0F, 0xC6, 0x00, 0x63, 0xF0, 0x01, 0x83, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x3F,
+  0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFD, 0xF0, 0x0F, 0xF3, 0xC0, 0x3F, 0xCF,
+  0x80, 0xFF, 0x1E, 0x03, 0xFC, 0x7C, 0x0F, 0xF0, 0xF0, 0x3F, 0xC3, 0xE0,
+  0xFF, 0x07, 0xC3, 0xFC, 0x0F, 0x0F, 0xF0, 0x3E, 0x3F, 0xC0, 0x78, 0xFF,
+  0x01, 0xF3, 0xFC, 0x03, 0xCF, 0xF0, 0x0F, 0xBF, 0xC0, 0x1F, 0xFF, 0x00,
+  0x7F, 0xFC, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F,
+  0xFC, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00,
+  0xFC, 0x0F, 0xC0, 0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x00, 0x03,
+  0xC7, 0xC0, 0x00, 0xF9, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x79, 0xE0, 0x00, 0x1E, 0x7C, 0x00,
+  0x0F, 0x8F, 0x00, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x0F,
+  0xC0, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0xFC, 0x0F, 0xC0,
+  0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x00, 0x03, 0xC7, 0xC0, 0x00,
+  0xF9, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xF7, 0x80, 0x00, 0x79, 0xE0, 0x00, 0x1E, 0x7C, 0x00, 0x0F, 0x8F, 0x00,
+  0x03, 0xC3, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x01,
+  0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x07, 0x38, 0x00, 0x03, 0x87, 0x00, 0x01, 0xC0,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01,
+  0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0xFC, 0x0F, 0xC0, 0x7C, 0x00, 0xF8,
+  0x3E, 0x00, 0x1F, 0x0F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF9, 0xE0, 0x00,
+  0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF7, 0x80, 0x00,
+  0x79, 0xE0, 0x00, 0x1E, 0x7C, 0x00, 0x0F, 0x8F, 0x00, 0x03, 0xC3, 0xE0,
+  0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x01, 0xFF, 0xFE, 0x00,
+  0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x70, 0x60, 0x00, 0x3F, 0x18,
+  0x00, 0x18, 0xFC, 0x00, 0x06, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFE, 0x00, 0xFC, 0x0F, 0xC0, 0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x1F,
+  0x0F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF9, 0xE0, 0x00, 0x1E, 0x78, 0x00,
+  0x07, 0xBC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x79, 0xE0, 0x00,
+  0x1E, 0x7C, 0x00, 0x0F, 0x8F, 0x00, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0x7C,
+  0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E,
+  0x00, 0x07, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00,
+  0xFC, 0x0F, 0xC0, 0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x1F, 0x0F, 0x00, 0x03,
+  0xC7, 0xC0, 0x00, 0xF9, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x79, 0xE0, 0x00, 0x1E, 0x7C, 0x00,
+  0x0F, 0x8F, 0x00, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x0F,
+  0xC0, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x00,
+  0x40, 0x00, 0x11, 0x80, 0x00, 0x6F, 0x00, 0x03, 0xDE, 0x00, 0x1E, 0x3C,
+  0x00, 0xF0, 0x78, 0x07, 0x80, 0xF0, 0x3C, 0x01, 0xE1, 0xE0, 0x03, 0xCF,
+  0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00,
+  0x0F, 0x3C, 0x00, 0x78, 0x78, 0x03, 0xC0, 0xF0, 0x1E, 0x01, 0xE0, 0xF0,
+  0x03, 0xC7, 0x80, 0x07, 0xBC, 0x00, 0x0F, 0x60, 0x00, 0x19, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x80, 0x1F, 0xE0, 0x70, 0x1F, 0xFE, 0x3C, 0x1F,
+  0xFF, 0xEE, 0x0F, 0xC0, 0xFF, 0x07, 0xC0, 0x0F, 0x83, 0xE0, 0x01, 0xF0,
+  0xF0, 0x00, 0xFC, 0x7C, 0x00, 0x7F, 0x9E, 0x00, 0x3D, 0xE7, 0x80, 0x0E,
+  0x7B, 0xC0, 0x07, 0x0F, 0xF0, 0x03, 0x83, 0xFC, 0x01, 0xC0, 0xFF, 0x00,
+  0xF0, 0x3F, 0xC0, 0x78, 0x0F, 0xF0, 0x3C, 0x03, 0xFC, 0x0E, 0x00, 0xFF,
+  0x07, 0x00, 0x3F, 0xC3, 0x80, 0x0F, 0x79, 0xC0, 0x07, 0x9E, 0xF0, 0x01,
+  0xE7, 0xF8, 0x00, 0xF8, 0xFC, 0x00, 0x3C, 0x3E, 0x00, 0x1F, 0x07, 0xC0,
+  0x0F, 0x83, 0xFC, 0x0F, 0xC1, 0xFF, 0xFF, 0xE0, 0x71, 0xFF, 0xE0, 0x38,
+  0x1F, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3D, 0xE0, 0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3F, 0x03,
+  0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x1E, 0x00,
+  0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xE0, 0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00,
+  0x3E, 0x3F, 0x03, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80,
+  0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x1C, 0xE0, 0x00, 0xE1, 0xC0, 0x07,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xE0, 0x01, 0xE7, 0x80,
+  0x07, 0x9F, 0x00, 0x3E, 0x3F, 0x03, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC,
+  0x00, 0x7F, 0x80, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0x78, 0x01,
+  0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xE0,
+  0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3F, 0x03, 0xF0, 0x7F, 0xFF,
+  0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E,
+  0x3E, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x81, 0xF0,
+  0x0F, 0x81, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0,
+  0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0xE3, 0xFF, 0xFC,
+  0xF0, 0x1F, 0xBC, 0x01, 0xEF, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xEF, 0x01,
+  0xFB, 0xFF, 0xFC, 0xFF, 0xFE, 0x3F, 0xFC, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xF0, 0x03,
+  0xFF, 0x80, 0xFF, 0xF8, 0x3E, 0x0F, 0x87, 0x80, 0xF1, 0xE0, 0x0F, 0x3C,
+  0x01, 0xE7, 0x80, 0xFC, 0xF0, 0x7F, 0x9E, 0x1F, 0x03, 0xC3, 0xC0, 0x78,
+  0xF0, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x3C, 0x78, 0x07, 0x8F, 0x80, 0xF0,
+  0xF8, 0x1E, 0x0F, 0xC3, 0xC0, 0x7C, 0x78, 0x07, 0xEF, 0x00, 0x7D, 0xE0,
+  0x07, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0xCC,
+  0x1F, 0x79, 0xFF, 0xEF, 0x3F, 0xF9, 0xE3, 0xFC, 0x00, 0x1E, 0x00, 0x03,
+  0xC0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0xFF, 0xFC,
+  0x38, 0x1F, 0x08, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x7F, 0xFC, 0x7F, 0xFF, 0x7F, 0xFF, 0xDF, 0x00, 0xFF, 0x80,
+  0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0xFD, 0xF0, 0x7F,
+  0x7F, 0xFB, 0xCF, 0xFC, 0xF0, 0xFC, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x38, 0x1F,
+  0x08, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x7F, 0xFC, 0x7F, 0xFF, 0x7F, 0xFF, 0xDF, 0x00, 0xFF, 0x80, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0xFD, 0xF0, 0x7F, 0x7F, 0xFB,
+  0xCF, 0xFC, 0xF0, 0xFC, 0x3C, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3F, 0x00,
+  0x1C, 0xE0, 0x06, 0x18, 0x03, 0x87, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x38, 0x1F, 0x08, 0x01,
+  0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x7F, 0xFC,
+  0x7F, 0xFF, 0x7F, 0xFF, 0xDF, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF0,
+  0x07, 0xFC, 0x01, 0xFF, 0x80, 0xFD, 0xF0, 0x7F, 0x7F, 0xFB, 0xCF, 0xFC,
+  0xF0, 0xFC, 0x3C, 0x07, 0x06, 0x03, 0xF1, 0x81, 0x9E, 0x60, 0x63, 0xF0,
+  0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07,
+  0xFF, 0x83, 0xFF, 0xF0, 0xE0, 0x7C, 0x20, 0x07, 0x80, 0x01, 0xE0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC1, 0xFF, 0xF1, 0xFF, 0xFD, 0xFF, 0xFF,
+  0x7C, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xFE,
+  0x03, 0xF7, 0xC1, 0xFD, 0xFF, 0xEF, 0x3F, 0xF3, 0xC3, 0xF0, 0xF0, 0x1E,
+  0x1E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0,
+  0xE0, 0x7C, 0x20, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC1, 0xFF, 0xF1, 0xFF, 0xFD, 0xFF, 0xFF, 0x7C, 0x03, 0xFE, 0x00,
+  0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xFE, 0x03, 0xF7, 0xC1, 0xFD,
+  0xFF, 0xEF, 0x3F, 0xF3, 0xC3, 0xF0, 0xF0, 0x01, 0xE0, 0x01, 0xFE, 0x00,
+  0x61, 0x80, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0xC0, 0xC0, 0x18,
+  0x60, 0x07, 0xF8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
+  0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xE0, 0x7C, 0x20, 0x07, 0x80, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC1, 0xFF, 0xF1, 0xFF, 0xFD, 0xFF,
+  0xFF, 0x7C, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07,
+  0xFE, 0x03, 0xF7, 0xC1, 0xFD, 0xFF, 0xEF, 0x3F, 0xF3, 0xC3, 0xF0, 0xF0,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xFF, 0xCF, 0xFF,
+  0x07, 0x03, 0xEF, 0x07, 0xC2, 0x00, 0x7F, 0x01, 0xF0, 0x00, 0x3F, 0x00,
+  0x78, 0x00, 0x0F, 0x80, 0x1C, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x03, 0xC0,
+  0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xC0, 0x3C, 0x00, 0x07, 0xC0, 0x1E, 0x00, 0x03, 0xC0, 0x0F,
+  0x00, 0x01, 0xE0, 0x0F, 0xC0, 0x00, 0xF0, 0x07, 0xE0, 0x00, 0x7C, 0x07,
+  0x78, 0x00, 0x9F, 0x07, 0x9F, 0x03, 0xCF, 0xFF, 0x87, 0xFF, 0xE3, 0xFF,
+  0x81, 0xFF, 0xE0, 0x7F, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x03, 0xFF, 0x87,
+  0xFF, 0xE7, 0xE0, 0x73, 0xC0, 0x0B, 0xE0, 0x01, 0xE0, 0x01, 0xF0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x4F, 0xC0, 0xE3,
+  0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x23, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+  0x07, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x07, 0xC3, 0xC0, 0x3E, 0x78, 0x01,
+  0xE7, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x23, 0xF0, 0x1E, 0x1F, 0xFF, 0xE0,
+  0x7F, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0x01, 0xFF, 0xF8, 0x3F,
+  0x07, 0xC3, 0xC0, 0x3E, 0x78, 0x01, 0xE7, 0x80, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00,
+  0x23, 0xF0, 0x1E, 0x1F, 0xFF, 0xE0, 0x7F, 0xFC, 0x01, 0xFE, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x39, 0xC0, 0x03, 0x8C, 0x00,
+  0x70, 0xE0, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+  0x07, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x07, 0xC3, 0xC0, 0x3E, 0x78, 0x01,
+  0xE7, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x23, 0xF0, 0x1E, 0x1F, 0xFF, 0xE0,
+  0x7F, 0xFC, 0x01, 0xFE, 0x00, 0x07, 0x87, 0x80, 0x78, 0x78, 0x07, 0x87,
+  0x80, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x83, 0xF0, 0x7C, 0x3C,
+  0x03, 0xE7, 0x80, 0x1E, 0x78, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x02, 0x3F, 0x01,
+  0xE1, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x1F, 0xE0, 0xF0, 0x3C, 0x0F, 0x03,
+  0x80, 0xE0, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x07, 0x87, 0x87, 0x83, 0x83,
+  0x83, 0x83, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x0F, 0x00, 0xF0, 0x1F, 0x83, 0x9C,
+  0x30, 0xC7, 0x0E, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0x00, 0x78, 0x18, 0x03, 0xCF, 0xC0, 0x1F, 0xE0,
+  0x03, 0xF0, 0x01, 0xFF, 0x80, 0x3C, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1E,
+  0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x81, 0xFF, 0xFC, 0x3F, 0x03, 0xC7, 0xC0,
+  0x1E, 0x78, 0x01, 0xE7, 0x80, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF7,
+  0x80, 0x1E, 0x78, 0x01, 0xE3, 0xC0, 0x3C, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8,
+  0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0x06, 0x07, 0xE1, 0x83, 0x9C, 0xE0,
+  0xC3, 0xF0, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x3C, 0xFF, 0x8F, 0x7F, 0xF3, 0xF8, 0x3E, 0xFC, 0x07, 0xBE, 0x01,
+  0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
+  0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
+  0xF0, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xC0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xC0, 0x3C,
+  0x78, 0x01, 0xE7, 0x80, 0x1E, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x7C, 0x03, 0xE3, 0xF0, 0xFC, 0x1F,
+  0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xFF, 0x01, 0xFF,
+  0xF8, 0x3F, 0x0F, 0xC7, 0xC0, 0x3C, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x78, 0x01, 0xE7, 0x80, 0x1E,
+  0x7C, 0x03, 0xE3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xF8,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x39, 0xC0, 0x03,
+  0x0C, 0x00, 0x70, 0xE0, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xC0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xC0, 0x3C,
+  0x78, 0x01, 0xE7, 0x80, 0x1E, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x7C, 0x03, 0xE3, 0xF0, 0xFC, 0x1F,
+  0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x03, 0x83, 0x00, 0x7E, 0x30,
+  0x0C, 0xF3, 0x00, 0xC7, 0xE0, 0x0C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xF0,
+  0xFC, 0x7C, 0x03, 0xC7, 0x80, 0x1E, 0x78, 0x01, 0xEF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xF7, 0x80, 0x1E, 0x78, 0x01, 0xE7, 0xC0, 0x3E,
+  0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0x0F,
+  0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x1F,
+  0xFF, 0x83, 0xF0, 0xFC, 0x7C, 0x03, 0xC7, 0x80, 0x1E, 0x78, 0x01, 0xEF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF7, 0x80, 0x1E, 0x78, 0x01,
+  0xE7, 0xC0, 0x3E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F,
+  0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07,
+  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x18, 0x07, 0xF0, 0xF0, 0x7F, 0xF7, 0x83, 0xFF, 0xFC,
+  0x1F, 0x87, 0xE0, 0xF8, 0x07, 0x83, 0xC0, 0x3F, 0x0F, 0x01, 0xFC, 0x7C,
+  0x0E, 0x79, 0xE0, 0x39, 0xE7, 0x81, 0xC7, 0x9E, 0x0E, 0x1E, 0x78, 0x70,
+  0x79, 0xE3, 0x81, 0xE7, 0x9C, 0x07, 0x9E, 0x70, 0x1E, 0x3F, 0x80, 0xF0,
+  0xFC, 0x03, 0xC1, 0xE0, 0x1F, 0x07, 0xE1, 0xF8, 0x3F, 0xFF, 0xC1, 0xEF,
+  0xFE, 0x07, 0x0F, 0xE0, 0x18, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01,
+  0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x07, 0xFE, 0x01, 0xF7, 0x80, 0xFD, 0xF0, 0x7F, 0x3F, 0xFB,
+  0xC7, 0xFC, 0xF0, 0xFC, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
+  0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
+  0x07, 0xFE, 0x01, 0xF7, 0x80, 0xFD, 0xF0, 0x7F, 0x3F, 0xFB, 0xC7, 0xFC,
+  0xF0, 0xFC, 0x3C, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x1C, 0xE0,
+  0x06, 0x18, 0x03, 0x87, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
+  0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xFE,
+  0x01, 0xF7, 0x80, 0xFD, 0xF0, 0x7F, 0x3F, 0xFB, 0xC7, 0xFC, 0xF0, 0xFC,
+  0x3C, 0x1E, 0x1E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0x78, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x07, 0xDE, 0x03, 0xF7,
+  0xC1, 0xFC, 0xFF, 0xEF, 0x1F, 0xF3, 0xC3, 0xF0, 0xF0, 0x00, 0x07, 0x80,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x3E, 0xF0, 0x01, 0xE7, 0x80, 0x0F, 0x3E, 0x00, 0xF8, 0xF0, 0x07,
+  0x87, 0xC0, 0x7C, 0x1E, 0x03, 0xC0, 0xF8, 0x1E, 0x03, 0xC1, 0xF0, 0x1E,
+  0x0F, 0x00, 0xF8, 0xF8, 0x03, 0xC7, 0x80, 0x1F, 0x7C, 0x00, 0x7B, 0xC0,
+  0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xC0,
+  0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78,
+  0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0xF8, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F, 0x07, 0xCF, 0xC0, 0x7D, 0xF0,
+  0x07, 0xBE, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC0,
+  0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xFB, 0xF8, 0x3E, 0x7B, 0xFF, 0x8F, 0x3F,
+  0xE1, 0xE1, 0xF0, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07,
+  0x8F, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+  0x07, 0xDE, 0x00, 0x3C, 0xF0, 0x01, 0xE7, 0xC0, 0x1F, 0x1E, 0x00, 0xF0,
+  0xF8, 0x0F, 0x83, 0xC0, 0x78, 0x1F, 0x03, 0xC0, 0x78, 0x3E, 0x03, 0xC1,
+  0xE0, 0x1F, 0x1F, 0x00, 0x78, 0xF0, 0x03, 0xEF, 0x80, 0x0F, 0x78, 0x00,
+  0x7F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00,
+  0x1F, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans20pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   4,  28,  16,    6,  -27 },   // 0x21 '!'
+  {    15,  10,  11,  18,    4,  -27 },   // 0x22 '"'
+  {    29,  27,  28,  33,    3,  -27 },   // 0x23 '#'
+  {   124,  18,  35,  25,    3,  -28 },   // 0x24 '$'
+  {   203,  33,  29,  37,    2,  -28 },   // 0x25 '%'
+  {   323,  27,  29,  30,    2,  -28 },   // 0x26 '&'
+  {   421,   3,  11,  11,    4,  -27 },   // 0x27 '''
+  {   426,   9,  35,  15,    3,  -29 },   // 0x28 '('
+  {   466,   9,  35,  15,    3,  -29 },   // 0x29 ')'
+  {   506,  16,  18,  20,    2,  -28 },   // 0x2A '*'
+  {   542,  25,  25,  33,    4,  -24 },   // 0x2B '+'
+  {   621,   6,   9,  12,    3,   -4 },   // 0x2C ','
+  {   628,  10,   3,  14,    2,  -11 },   // 0x2D '-'
+  {   632,   4,   5,  12,    5,   -4 },   // 0x2E '.'
+  {   635,  13,  32,  13,    0,  -27 },   // 0x2F '/'
+  {   687,  20,  29,  25,    3,  -28 },   // 0x30 '0'
+  {   760,  17,  28,  25,    4,  -27 },   // 0x31 '1'
+  {   820,  18,  29,  25,    3,  -28 },   // 0x32 '2'
+  {   886,  19,  29,  25,    3,  -28 },   // 0x33 '3'
+  {   955,  21,  28,  25,    2,  -27 },   // 0x34 '4'
+  {  1029,  18,  28,  25,    3,  -27 },   // 0x35 '5'
+  {  1092,  20,  29,  25,    3,  -28 },   // 0x36 '6'
+  {  1165,  18,  28,  25,    3,  -27 },   // 0x37 '7'
+  {  1228,  20,  29,  25,    3,  -28 },   // 0x38 '8'
+  {  1301,  20,  29,  25,    3,  -28 },   // 0x39 '9'
+  {  1374,   4,  20,  13,    5,  -19 },   // 0x3A ':'
+  {  1384,   6,  24,  13,    3,  -19 },   // 0x3B ';'
+  {  1402,  24,  21,  33,    4,  -22 },   // 0x3C '<'
+  {  1465,  24,  11,  33,    4,  -17 },   // 0x3D '='
+  {  1498,  24,  21,  33,    4,  -22 },   // 0x3E '>'
+  {  1561,  15,  29,  21,    3,  -28 },   // 0x3F '?'
+  {  1616,  34,  34,  39,    3,  -26 },   // 0x40 '@'
+  {  1761,  26,  28,  27,    0,  -27 },   // 0x41 'A'
+  {  1852,  20,  28,  27,    4,  -27 },   // 0x42 'B'
+  {  1922,  23,  29,  27,    2,  -28 },   // 0x43 'C'
+  {  2006,  24,  28,  30,    4,  -27 },   // 0x44 'D'
+  {  2090,  18,  28,  25,    4,  -27 },   // 0x45 'E'
+  {  2153,  16,  28,  22,    4,  -27 },   // 0x46 'F'
+  {  2209,  25,  29,  30,    2,  -28 },   // 0x47 'G'
+  {  2300,  22,  28,  29,    4,  -27 },   // 0x48 'H'
+  {  2377,   4,  28,  12,    4,  -27 },   // 0x49 'I'
+  {  2391,  10,  36,  12,   -2,  -27 },   // 0x4A 'J'
+  {  2436,  23,  28,  26,    4,  -27 },   // 0x4B 'K'
+  {  2517,  18,  28,  22,    4,  -27 },   // 0x4C 'L'
+  {  2580,  26,  28,  34,    4,  -27 },   // 0x4D 'M'
+  {  2671,  22,  28,  29,    4,  -27 },   // 0x4E 'N'
+  {  2748,  26,  29,  31,    2,  -28 },   // 0x4F 'O'
+  {  2843,  18,  28,  24,    4,  -27 },   // 0x50 'P'
+  {  2906,  26,  34,  31,    2,  -28 },   // 0x51 'Q'
+  {  3017,  22,  28,  27,    4,  -27 },   // 0x52 'R'
+  {  3094,  20,  29,  25,    3,  -28 },   // 0x53 'S'
+  {  3167,  24,  28,  24,    0,  -27 },   // 0x54 'T'
+  {  3251,  22,  28,  29,    4,  -27 },   // 0x55 'U'
+  {  3328,  26,  28,  27,    0,  -27 },   // 0x56 'V'
+  {  3419,  36,  28,  39,    1,  -27 },   // 0x57 'W'
+  {  3545,  24,  28,  26,    1,  -27 },   // 0x58 'X'
+  {  3629,  24,  28,  24,    0,  -27 },   // 0x59 'Y'
+  {  3713,  23,  28,  27,    2,  -27 },   // 0x5A 'Z'
+  {  3794,   9,  35,  15,    3,  -29 },   // 0x5B '['
+  {  3834,  13,  32,  13,    0,  -27 },   // 0x5C '\'
+  {  3886,   9,  35,  15,    4,  -29 },   // 0x5D ']'
+  {  3926,  24,  11,  33,    4,  -27 },   // 0x5E '^'
+  {  3959,  20,   3,  20,    0,    7 },   // 0x5F '_'
+  {  3967,   9,   7,  20,    3,  -30 },   // 0x60 '`'
+  {  3975,  18,  22,  24,    2,  -21 },   // 0x61 'a'
+  {  4025,  19,  30,  25,    4,  -29 },   // 0x62 'b'
+  {  4097,  17,  22,  21,    2,  -21 },   // 0x63 'c'
+  {  4144,  19,  30,  25,    2,  -29 },   // 0x64 'd'
+  {  4216,  20,  22,  24,    2,  -21 },   // 0x65 'e'
+  {  4271,  14,  30,  14,    1,  -29 },   // 0x66 'f'
+  {  4324,  19,  30,  25,    2,  -21 },   // 0x67 'g'
+  {  4396,  18,  30,  25,    4,  -29 },   // 0x68 'h'
+  {  4464,   4,  30,  11,    4,  -29 },   // 0x69 'i'
+  {  4479,   8,  38,  11,    0,  -29 },   // 0x6A 'j'
+  {  4517,  19,  30,  23,    4,  -29 },   // 0x6B 'k'
+  {  4589,   4,  30,  11,    4,  -29 },   // 0x6C 'l'
+  {  4604,  30,  22,  38,    4,  -21 },   // 0x6D 'm'
+  {  4687,  18,  22,  25,    4,  -21 },   // 0x6E 'n'
+  {  4737,  20,  22,  24,    2,  -21 },   // 0x6F 'o'
+  {  4792,  19,  30,  25,    4,  -21 },   // 0x70 'p'
+  {  4864,  19,  30,  25,    2,  -21 },   // 0x71 'q'
+  {  4936,  13,  22,  16,    4,  -21 },   // 0x72 'r'
+  {  4972,  16,  22,  20,    2,  -21 },   // 0x73 's'
+  {  5016,  14,  27,  15,    1,  -26 },   // 0x74 't'
+  {  5064,  18,  22,  25,    4,  -21 },   // 0x75 'u'
+  {  5114,  21,  21,  23,    1,  -20 },   // 0x76 'v'
+  {  5170,  29,  21,  32,    2,  -20 },   // 0x77 'w'
+  {  5247,  21,  21,  23,    1,  -20 },   // 0x78 'x'
+  {  5303,  21,  29,  23,    1,  -20 },   // 0x79 'y'
+  {  5380,  17,  21,  20,    2,  -20 },   // 0x7A 'z'
+  {  5425,  16,  36,  25,    5,  -29 },   // 0x7B '{'
+  {  5497,   3,  39,  13,    5,  -29 },   // 0x7C '|'
+  {  5512,  16,  36,  25,    5,  -29 },   // 0x7D '}'
+  {  5584,  24,   6,  33,    4,  -14 },   // 0x7E '~'
+  {  5602,  20,  34,  23,    2,  -27 },   // 0x7F
+  {  5687,  20,  34,  23,    2,  -27 },   // 0x80
+  {  5772,  20,  34,  23,    2,  -27 },   // 0x81
+  {  5857,  20,  34,  23,    2,  -27 },   // 0x82
+  {  5942,  20,  34,  23,    2,  -27 },   // 0x83
+  {  6027,  20,  34,  23,    2,  -27 },   // 0x84
+  {  6112,  20,  34,  23,    2,  -27 },   // 0x85
+  {  6197,  20,  34,  23,    2,  -27 },   // 0x86
+  {  6282,  20,  34,  23,    2,  -27 },   // 0x87
+  {  6367,  20,  34,  23,    2,  -27 },   // 0x88
+  {  6452,  20,  34,  23,    2,  -27 },   // 0x89
+  {  6537,  20,  34,  23,    2,  -27 },   // 0x8A
+  {  6622,  20,  34,  23,    2,  -27 },   // 0x8B
+  {  6707,  20,  34,  23,    2,  -27 },   // 0x8C
+  {  6792,  20,  34,  23,    2,  -27 },   // 0x8D
+  {  6877,  20,  34,  23,    2,  -27 },   // 0x8E
+  {  6962,  20,  34,  23,    2,  -27 },   // 0x8F
+  {  7047,  20,  34,  23,    2,  -27 },   // 0x90
+  {  7132,  20,  34,  23,    2,  -27 },   // 0x91
+  {  7217,  20,  34,  23,    2,  -27 },   // 0x92
+  {  7302,  20,  34,  23,    2,  -27 },   // 0x93
+  {  7387,  20,  34,  23,    2,  -27 },   // 0x94
+  {  7472,  20,  34,  23,    2,  -27 },   // 0x95
+  {  7557,  20,  34,  23,    2,  -27 },   // 0x96
+  {  7642,  20,  34,  23,    2,  -27 },   // 0x97
+  {  7727,  20,  34,  23,    2,  -27 },   // 0x98
+  {  7812,  20,  34,  23,    2,  -27 },   // 0x99
+  {  7897,  20,  34,  23,    2,  -27 },   // 0x9A
+  {  7982,  20,  34,  23,    2,  -27 },   // 0x9B
+  {  8067,  20,  34,  23,    2,  -27 },   // 0x9C
+  {  8152,  20,  34,  23,    2,  -27 },   // 0x9D
+  {  8237,  20,  34,  23,    2,  -27 },   // 0x9E
+  {  8322,  20,  34,  23,    2,  -27 },   // 0x9F
+  {  8407,   1,   1,  12,    0,    0 },   // 0xA0
+  {  8408,   4,  28,  16,    6,  -20 },   // 0xA1
+  {  8422,  17,  32,  25,    3,  -26 },   // 0xA2
+  {  8490,  20,  29,  25,    2,  -28 },   // 0xA3
+  {  8563,  22,  22,  25,    1,  -22 },   // 0xA4
+  {  8624,  22,  28,  25,    2,  -27 },   // 0xA5
+  {  8701,   3,  33,  13,    5,  -26 },   // 0xA6
+  {  8714,  16,  33,  20,    2,  -28 },   // 0xA7
+  {  8780,  12,   4,  20,    4,  -29 },   // 0xA8
+  {  8786,  28,  28,  39,    5,  -27 },   // 0xA9
+  {  8884,  14,  20,  18,    2,  -28 },   // 0xAA
+  {  8919,  17,  17,  24,    3,  -19 },   // 0xAB
+  {  8956,  24,  11,  33,    4,  -15 },   // 0xAC
+  {  8989,  10,   3,  14,    2,  -11 },   // 0xAD
+  {  8993,  28,  28,  39,    5,  -27 },   // 0xAE
+  {  9091,  11,   3,  20,    4,  -28 },   // 0xAF
+  {  9096,  12,  12,  20,    4,  -28 },   // 0xB0
+  {  9114,  25,  24,  33,    4,  -23 },   // 0xB1
+  {  9189,  11,  16,  16,    2,  -28 },   // 0xB2
+  {  9211,  12,  16,  16,    2,  -28 },   // 0xB3
+  {  9235,   9,   7,  20,    7,  -30 },   // 0xB4
+  {  9243,  21,  29,  25,    4,  -20 },   // 0xB5
+  {  9320,  18,  32,  25,    3,  -27 },   // 0xB6
+  {  9392,   4,   5,  12,    4,  -15 },   // 0xB7
+  {  9395,   8,   8,  20,    6,    1 },   // 0xB8
+  {  9403,  11,  16,  16,    3,  -28 },   // 0xB9
+  {  9425,  15,  20,  18,    2,  -28 },   // 0xBA
+  {  9463,  17,  17,  24,    4,  -19 },   // 0xBB
+  {  9500,  34,  29,  38,    3,  -28 },   // 0xBC
+  {  9624,  32,  29,  38,    3,  -28 },   // 0xBD
+  {  9740,  35,  29,  38,    2,  -28 },   // 0xBE
+  {  9867,  15,  29,  21,    3,  -20 },   // 0xBF
+  {  9922,  26,  36,  27,    0,  -35 },   // 0xC0
+  { 10039,  26,  36,  27,    0,  -35 },   // 0xC1
+  { 10156,  26,  36,  27,    0,  -35 },   // 0xC2
+  { 10273,  26,  36,  27,    0,  -35 },   // 0xC3
+  { 10390,  26,  36,  27,    0,  -35 },   // 0xC4
+  { 10507,  26,  36,  27,    0,  -35 },   // 0xC5
+  { 10624,  35,  28,  38,    0,  -27 },   // 0xC6
+  { 10747,  23,  37,  27,    2,  -28 },   // 0xC7
+  { 10854,  18,  36,  25,    4,  -35 },   // 0xC8
+  { 10935,  18,  36,  25,    4,  -35 },   // 0xC9
+  { 11016,  18,  36,  25,    4,  -35 },   // 0xCA
+  { 11097,  18,  36,  25,    4,  -35 },   // 0xCB
+  { 11178,   7,  36,  12,    2,  -35 },   // 0xCC
+  { 11210,   7,  36,  12,    4,  -35 },   // 0xCD
+  { 11242,  12,  36,  12,    0,  -35 },   // 0xCE
+  { 11296,  12,  36,  12,    0,  -35 },   // 0xCF
+  { 11350,  28,  28,  30,    0,  -27 },   // 0xD0
+  { 11448,  22,  36,  29,    4,  -35 },   // 0xD1
+  { 11547,  26,  36,  31,    2,  -35 },   // 0xD2
+  { 11664,  26,  36,  31,    2,  -35 },   // 0xD3
+  { 11781,  26,  36,  31,    2,  -35 },   // 0xD4
+  { 11898,  26,  36,  31,    2,  -35 },   // 0xD5
+  { 12015,  26,  36,  31,    2,  -35 },   // 0xD6
+  { 12132,  22,  22,  33,    5,  -22 },   // 0xD7
+  { 12193,  26,  31,  31,    2,  -29 },   // 0xD8
+  { 12294,  22,  36,  29,    4,  -35 },   // 0xD9
+  { 12393,  22,  36,  29,    4,  -35 },   // 0xDA
+  { 12492,  22,  36,  29,    4,  -35 },   // 0xDB
+  { 12591,  22,  36,  29,    4,  -35 },   // 0xDC
+  { 12690,  24,  36,  24,    0,  -35 },   // 0xDD
+  { 12798,  18,  28,  24,    4,  -27 },   // 0xDE
+  { 12861,  19,  30,  25,    4,  -29 },   // 0xDF
+  { 12933,  18,  31,  24,    2,  -30 },   // 0xE0
+  { 13003,  18,  31,  24,    2,  -30 },   // 0xE1
+  { 13073,  18,  31,  24,    2,  -30 },   // 0xE2
+  { 13143,  18,  30,  24,    2,  -29 },   // 0xE3
+  { 13211,  18,  30,  24,    2,  -29 },   // 0xE4
+  { 13279,  18,  34,  24,    2,  -33 },   // 0xE5
+  { 13356,  33,  22,  38,    2,  -21 },   // 0xE6
+  { 13447,  17,  30,  21,    2,  -21 },   // 0xE7
+  { 13511,  20,  31,  24,    2,  -30 },   // 0xE8
+  { 13589,  20,  31,  24,    2,  -30 },   // 0xE9
+  { 13667,  20,  31,  24,    2,  -30 },   // 0xEA
+  { 13745,  20,  30,  24,    2,  -29 },   // 0xEB
+  { 13820,   9,  31,  11,   -1,  -30 },   // 0xEC
+  { 13855,   9,  31,  11,    3,  -30 },   // 0xED
+  { 13890,  12,  31,  11,    0,  -30 },   // 0xEE
+  { 13937,  12,  30,  11,    0,  -29 },   // 0xEF
+  { 13982,  20,  30,  24,    2,  -29 },   // 0xF0
+  { 14057,  18,  30,  25,    4,  -29 },   // 0xF1
+  { 14125,  20,  31,  24,    2,  -30 },   // 0xF2
+  { 14203,  20,  31,  24,    2,  -30 },   // 0xF3
+  { 14281,  20,  31,  24,    2,  -30 },   // 0xF4
+  { 14359,  20,  30,  24,    2,  -29 },   // 0xF5
+  { 14434,  20,  30,  24,    2,  -29 },   // 0xF6
+  { 14509,  25,  19,  33,    4,  -21 },   // 0xF7
+  { 14569,  22,  24,  24,    1,  -22 },   // 0xF8
+  { 14635,  18,  31,  25,    4,  -30 },   // 0xF9
+  { 14705,  18,  31,  25,    4,  -30 },   // 0xFA
+  { 14775,  18,  31,  25,    4,  -30 },   // 0xFB
+  { 14845,  18,  30,  25,    4,  -29 },   // 0xFC
+  { 14913,  21,  39,  23,    1,  -30 },   // 0xFD
+  { 15016,  19,  38,  25,    4,  -29 },   // 0xFE
+  { 15107,  21,  38,  23,    1,  -29 } }; // 0xFF
+
+const GFXfont DejaVuSans20pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans20pt8bBitmaps,
+  (GFXglyph *)DejaVuSans20pt8bGlyphs,
+  0x20, 0xFF, 46 };
+
+// Approx. 16782 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans20pt8bMetrics[] PROGMEM = {
+  {   0,  12,   1 },   // 0x20
+  {   6,  16,  10 },   // 0x21
+  {   4,  18,  14 },   // 0x22
+  {   3,  33,  30 },   // 0x23
+  {   3,  25,  21 },   // 0x24
+  {   2,  37,  35 },   // 0x25
+  {   2,  30,  29 },   // 0x26
+  {   4,  11,   7 },   // 0x27
+  {   3,  15,  12 },   // 0x28
+  {   3,  15,  12 },   // 0x29
+  {   2,  20,  18 },   // 0x2A
+  {   4,  33,  29 },   // 0x2B
+  {   3,  12,   9 },   // 0x2C
+  {   2,  14,  12 },   // 0x2D
+  {   5,  12,   9 },   // 0x2E
+  {   0,  13,  13 },   // 0x2F
+  {   3,  25,  23 },   // 0x30
+  {   4,  25,  21 },   // 0x31
+  {   3,  25,  21 },   // 0x32
+  {   3,  25,  22 },   // 0x33
+  {   2,  25,  23 },   // 0x34
+  {   3,  25,  21 },   // 0x35
+  {   3,  25,  23 },   // 0x36
+  {   3,  25,  21 },   // 0x37
+  {   3,  25,  23 },   // 0x38
+  {   3,  25,  23 },   // 0x39
+  {   5,  13,   9 },   // 0x3A
+  {   3,  13,   9 },   // 0x3B
+  {   4,  33,  28 },   // 0x3C
+  {   4,  33,  28 },   // 0x3D
+  {   4,  33,  28 },   // 0x3E
+  {   3,  21,  18 },   // 0x3F
+  {   3,  39,  37 },   // 0x40
+  {   0,  27,  26 },   // 0x41
+  {   4,  27,  24 },   // 0x42
+  {   2,  27,  25 },   // 0x43
+  {   4,  30,  28 },   // 0x44
+  {   4,  25,  22 },   // 0x45
+  {   4,  22,  20 },   // 0x46
+  {   2,  30,  27 },   // 0x47
+  {   4,  29,  26 },   // 0x48
+  {   4,  12,   8 },   // 0x49
+  {  -2,  12,   8 },   // 0x4A
+  {   4,  26,  27 },   // 0x4B
+  {   4,  22,  22 },   // 0x4C
+  {   4,  34,  30 },   // 0x4D
+  {   4,  29,  26 },   // 0x4E
+  {   2,  31,  28 },   // 0x4F
+  {   4,  24,  22 },   // 0x50
+  {   2,  31,  28 },   // 0x51
+  {   4,  27,  26 },   // 0x52
+  {   3,  25,  23 },   // 0x53
+  {   0,  24,  24 },   // 0x54
+  {   4,  29,  26 },   // 0x55
+  {   0,  27,  26 },   // 0x56
+  {   1,  39,  37 },   // 0x57
+  {   1,  26,  25 },   // 0x58
+  {   0,  24,  24 },   // 0x59
+  {   2,  27,  25 },   // 0x5A
+  {   3,  15,  12 },   // 0x5B
+  {   0,  13,  13 },   // 0x5C
+  {   4,  15,  13 },   // 0x5D
+  {   4,  33,  28 },   // 0x5E
+  {   0,  20,  20 },   // 0x5F
+  {   3,  20,  12 },   // 0x60
+  {   2,  24,  20 },   // 0x61
+  {   4,  25,  23 },   // 0x62
+  {   2,  21,  19 },   // 0x63
+  {   2,  25,  21 },   // 0x64
+  {   2,  24,  22 },   // 0x65
+  {   1,  14,  15 },   // 0x66
+  {   2,  25,  21 },   // 0x67
+  {   4,  25,  22 },   // 0x68
+  {   4,  11,   8 },   // 0x69
+  {   0,  11,   8 },   // 0x6A
+  {   4,  23,  23 },   // 0x6B
+  {   4,  11,   8 },   // 0x6C
+  {   4,  38,  34 },   // 0x6D
+  {   4,  25,  22 },   // 0x6E
+  {   2,  24,  22 },   // 0x6F
+  {   4,  25,  23 },   // 0x70
+  {   2,  25,  21 },   // 0x71
+  {   4,  16,  17 },   // 0x72
+  {   2,  20,  18 },   // 0x73
+  {   1,  15,  15 },   // 0x74
+  {   4,  25,  22 },   // 0x75
+  {   1,  23,  22 },   // 0x76
+  {   2,  32,  31 },   // 0x77
+  {   1,  23,  22 },   // 0x78
+  {   1,  23,  22 },   // 0x79
+  {   2,  20,  19 },   // 0x7A
+  {   5,  25,  21 },   // 0x7B
+  {   5,  13,   8 },   // 0x7C
+  {   5,  25,  21 },   // 0x7D
+  {   4,  33,  28 },   // 0x7E
+  {   2,  23,  22 },   // 0x7F
+  {   2,  23,  22 },   // 0x80
+  {   2,  23,  22 },   // 0x81
+  {   2,  23,  22 },   // 0x82
+  {   2,  23,  22 },   // 0x83
+  {   2,  23,  22 },   // 0x84
+  {   2,  23,  22 },   // 0x85
+  {   2,  23,  22 },   // 0x86
+  {   2,  23,  22 },   // 0x87
+  {   2,  23,  22 },   // 0x88
+  {   2,  23,  22 },   // 0x89
+  {   2,  23,  22 },   // 0x8A
+  {   2,  23,  22 },   // 0x8B
+  {   2,  23,  22 },   // 0x8C
+  {   2,  23,  22 },   // 0x8D
+  {   2,  23,  22 },   // 0x8E
+  {   2,  23,  22 },   // 0x8F
+  {   2,  23,  22 },   // 0x90
+  {   2,  23,  22 },   // 0x91
+  {   2,  23,  22 },   // 0x92
+  {   2,  23,  22 },   // 0x93
+  {   2,  23,  22 },   // 0x94
+  {   2,  23,  22 },   // 0x95
+  {   2,  23,  22 },   // 0x96
+  {   2,  23,  22 },   // 0x97
+  {   2,  23,  22 },   // 0x98
+  {   2,  23,  22 },   // 0x99
+  {   2,  23,  22 },   // 0x9A
+  {   2,  23,  22 },   // 0x9B
+  {   2,  23,  22 },   // 0x9C
+  {   2,  23,  22 },   // 0x9D
+  {   2,  23,  22 },   // 0x9E
+  {   2,  23,  22 },   // 0x9F
+  {   0,  12,   1 },   // 0xA0
+  {   6,  16,  10 },   // 0xA1
+  {   3,  25,  20 },   // 0xA2
+  {   2,  25,  22 },   // 0xA3
+  {   1,  25,  23 },   // 0xA4
+  {   2,  25,  24 },   // 0xA5
+  {   5,  13,   8 },   // 0xA6
+  {   2,  20,  18 },   // 0xA7
+  {   4,  20,  16 },   // 0xA8
+  {   5,  39,  33 },   // 0xA9
+  {   2,  18,  16 },   // 0xAA
+  {   3,  24,  20 },   // 0xAB
+  {   4,  33,  28 },   // 0xAC
+  {   2,  14,  12 },   // 0xAD
+  {   5,  39,  33 },   // 0xAE
+  {   4,  20,  15 },   // 0xAF
+  {   4,  20,  16 },   // 0xB0
+  {   4,  33,  29 },   // 0xB1
+  {   2,  16,  13 },   // 0xB2
+  {   2,  16,  14 },   // 0xB3
+  {   7,  20,  16 },   // 0xB4
+  {   4,  25,  25 },   // 0xB5
+  {   3,  25,  21 },   // 0xB6
+  {   4,  12,   8 },   // 0xB7
+  {   6,  20,  14 },   // 0xB8
+  {   3,  16,  14 },   // 0xB9
+  {   2,  18,  17 },   // 0xBA
+  {   4,  24,  21 },   // 0xBB
+  {   3,  38,  37 },   // 0xBC
+  {   3,  38,  35 },   // 0xBD
+  {   2,  38,  37 },   // 0xBE
+  {   3,  21,  18 },   // 0xBF
+  {   0,  27,  26 },   // 0xC0
+  {   0,  27,  26 },   // 0xC1
+  {   0,  27,  26 },   // 0xC2
+  {   0,  27,  26 },   // 0xC3
+  {   0,  27,  26 },   // 0xC4
+  {   0,  27,  26 },   // 0xC5
+  {   0,  38,  35 },   // 0xC6
+  {   2,  27,  25 },   // 0xC7
+  {   4,  25,  22 },   // 0xC8
+  {   4,  25,  22 },   // 0xC9
+  {   4,  25,  22 },   // 0xCA
+  {   4,  25,  22 },   // 0xCB
+  {   2,  12,   9 },   // 0xCC
+  {   4,  12,  11 },   // 0xCD
+  {   0,  12,  12 },   // 0xCE
+  {   0,  12,  12 },   // 0xCF
+  {   0,  30,  28 },   // 0xD0
+  {   4,  29,  26 },   // 0xD1
+  {   2,  31,  28 },   // 0xD2
+  {   2,  31,  28 },   // 0xD3
+  {   2,  31,  28 },   // 0xD4
+  {   2,  31,  28 },   // 0xD5
+  {   2,  31,  28 },   // 0xD6
+  {   5,  33,  27 },   // 0xD7
+  {   2,  31,  28 },   // 0xD8
+  {   4,  29,  26 },   // 0xD9
+  {   4,  29,  26 },   // 0xDA
+  {   4,  29,  26 },   // 0xDB
+  {   4,  29,  26 },   // 0xDC
+  {   0,  24,  24 },   // 0xDD
+  {   4,  24,  22 },   // 0xDE
+  {   4,  25,  23 },   // 0xDF
+  {   2,  24,  20 },   // 0xE0
+  {   2,  24,  20 },   // 0xE1
+  {   2,  24,  20 },   // 0xE2
+  {   2,  24,  20 },   // 0xE3
+  {   2,  24,  20 },   // 0xE4
+  {   2,  24,  20 },   // 0xE5
+  {   2,  38,  35 },   // 0xE6
+  {   2,  21,  19 },   // 0xE7
+  {   2,  24,  22 },   // 0xE8
+  {   2,  24,  22 },   // 0xE9
+  {   2,  24,  22 },   // 0xEA
+  {   2,  24,  22 },   // 0xEB
+  {  -1,  11,   8 },   // 0xEC
+  {   3,  11,  12 },   // 0xED
+  {   0,  11,  12 },   // 0xEE
+  {   0,  11,  12 },   // 0xEF
+  {   2,  24,  22 },   // 0xF0
+  {   4,  25,  22 },   // 0xF1
+  {   2,  24,  22 },   // 0xF2
+  {   2,  24,  22 },   // 0xF3
+  {   2,  24,  22 },   // 0xF4
+  {   2,  24,  22 },   // 0xF5
+  {   2,  24,  22 },   // 0xF6
+  {   4,  33,  29 },   // 0xF7
+  {   1,  24,  23 },   // 0xF8
+  {   4,  25,  22 },   // 0xF9
+  {   4,  25,  22 },   // 0xFA
+  {   4,  25,  22 },   // 0xFB
+  {   4,  25,  22 },   // 0xFC
+  {   1,  23,  22 },   // 0xFD
+  {   4,  25,  23 },   // 0xFE
+  {   1,  23,  22 }    // 0xFF
+};
+const FontMetrics DejaVuSans20pt8bWidths = { DejaVuSans20pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS20PTLAT1__H
@@ -0,0 +1,2020 @@
+#ifndef DEJAVUSANS22PTLAT1__H
+#define DEJAVUSANS22PTLAT1__H
+const uint8_t DejaVuSans22pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00,
+  0x0E, 0x07, 0x80, 0x00, 0x70, 0x38, 0x00, 0x07, 0x81, 0xC0, 0x00, 0x38,
+  0x0E, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x0E, 0x07, 0x00, 0x00, 0xF0, 0x38,
+  0x00, 0x07, 0x81, 0xC0, 0x00, 0x38, 0x1E, 0x01, 0xFF, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0x03, 0xC0, 0x00, 0x38,
+  0x1C, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0x1E, 0x07, 0x00, 0x00, 0xE0, 0x78,
+  0x00, 0x07, 0x03, 0x80, 0x00, 0x78, 0x1C, 0x01, 0xFF, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0x03, 0x80, 0x00, 0x70,
+  0x1C, 0x00, 0x03, 0x81, 0xE0, 0x00, 0x1C, 0x0E, 0x00, 0x01, 0xE0, 0x70,
+  0x00, 0x0F, 0x03, 0x80, 0x00, 0x70, 0x3C, 0x00, 0x03, 0x81, 0xC0, 0x00,
+  0x3C, 0x0E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
+  0x06, 0x00, 0x00, 0x60, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC,
+  0x7E, 0x63, 0xC7, 0x86, 0x04, 0xF0, 0x60, 0x0F, 0x06, 0x00, 0xF0, 0x60,
+  0x0F, 0x06, 0x00, 0xF8, 0x60, 0x07, 0xE6, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x7F, 0xE0, 0x06, 0x3E, 0x00,
+  0x61, 0xF0, 0x06, 0x0F, 0x00, 0x60, 0xF0, 0x06, 0x0F, 0x00, 0x60, 0xF8,
+  0x06, 0x1F, 0xE0, 0x61, 0xEF, 0x86, 0x7E, 0xFF, 0xFF, 0xC7, 0xFF, 0xF0,
+  0x07, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
+  0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x01, 0xFE,
+  0x00, 0x07, 0x80, 0x3F, 0xF0, 0x00, 0x70, 0x07, 0x87, 0x80, 0x0F, 0x00,
+  0x70, 0x38, 0x01, 0xE0, 0x0F, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0x1C, 0x03,
+  0xC0, 0x0E, 0x01, 0xC0, 0x78, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0x0E, 0x01,
+  0xC0, 0xF0, 0x00, 0xE0, 0x1C, 0x0E, 0x00, 0x0E, 0x03, 0xC1, 0xE0, 0x00,
+  0x70, 0x38, 0x3C, 0x00, 0x07, 0x87, 0x83, 0x80, 0x00, 0x3F, 0xF0, 0x78,
+  0x00, 0x01, 0xFE, 0x07, 0x03, 0xF0, 0x0F, 0xC0, 0xE0, 0x7F, 0x80, 0x00,
+  0x1E, 0x0F, 0xFC, 0x00, 0x01, 0xC1, 0xE1, 0xE0, 0x00, 0x3C, 0x1C, 0x0E,
+  0x00, 0x07, 0x83, 0x80, 0xF0, 0x00, 0x70, 0x38, 0x07, 0x00, 0x0F, 0x03,
+  0x80, 0x70, 0x00, 0xE0, 0x38, 0x07, 0x00, 0x1E, 0x03, 0x80, 0x70, 0x03,
+  0xC0, 0x38, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xF0, 0x07, 0x80, 0x1C, 0x0E,
+  0x00, 0xF0, 0x01, 0xE1, 0xE0, 0x0E, 0x00, 0x0F, 0xFC, 0x01, 0xE0, 0x00,
+  0x7F, 0x80, 0x1C, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFF,
+  0x80, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xF8, 0x3C, 0x00, 0x07, 0x80, 0x30,
+  0x00, 0x3C, 0x00, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x07, 0xBF, 0x00, 0x1E, 0x3C, 0x7E, 0x00, 0x79, 0xE0, 0xFC,
+  0x01, 0xE7, 0x81, 0xF8, 0x07, 0x3C, 0x03, 0xF0, 0x3C, 0xF0, 0x07, 0xE0,
+  0xF3, 0xC0, 0x0F, 0xC3, 0x8F, 0x00, 0x1F, 0x9E, 0x3C, 0x00, 0x3F, 0xF0,
+  0xF0, 0x00, 0x7F, 0x81, 0xE0, 0x00, 0xFE, 0x07, 0xC0, 0x01, 0xF8, 0x0F,
+  0x80, 0x0F, 0xF0, 0x1F, 0x81, 0xFF, 0xE0, 0x3F, 0xFF, 0xCF, 0xC0, 0x7F,
+  0xFC, 0x1F, 0x80, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0xC1, 0xE0, 0x78, 0x3C, 0x0E, 0x07, 0x81, 0xE0, 0xF0, 0x3C, 0x0E,
+  0x07, 0x81, 0xE0, 0x78, 0x1C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x70, 0x1E, 0x07, 0x81, 0xE0, 0x38,
+  0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0x80, 0xF0, 0x1E, 0x07, 0x80, 0xF0,
+  0xF0, 0x1E, 0x07, 0x80, 0xF0, 0x3C, 0x07, 0x81, 0xE0, 0x3C, 0x0F, 0x01,
+  0xC0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F,
+  0x03, 0xC0, 0xF0, 0x78, 0x1E, 0x0F, 0x03, 0xC1, 0xE0, 0x78, 0x3C, 0x00,
+  0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x40, 0xC0, 0xBC,
+  0x30, 0xF7, 0x8C, 0x78, 0x7B, 0x78, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x1F, 0xE0, 0x1E, 0xDE, 0x1E, 0x31, 0xEF, 0x0C, 0x3D, 0x03, 0x02,
+  0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0xF3, 0xCF, 0x3D, 0xE7, 0x9C, 0xF3,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x00, 0x3C, 0x01,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x3C, 0x01,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xE1, 0xF8, 0x1E, 0x01,
+  0xE0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x1E, 0x00, 0x1E, 0x78, 0x00, 0x79,
+  0xE0, 0x01, 0xEF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xF7,
+  0x80, 0x07, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x78, 0xF0, 0x03, 0xC3, 0xC0,
+  0x0F, 0x07, 0x80, 0x78, 0x1F, 0x87, 0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8,
+  0x00, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xFE, 0x03, 0xFF, 0xC0, 0x7E, 0x78,
+  0x0C, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x07, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0x07, 0xF8, 0x07, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x8F, 0xC0, 0xFC, 0xE0, 0x03, 0xE8, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00,
+  0x01, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00,
+  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0xF0, 0x1F, 0xC4,
+  0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x03,
+  0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00,
+  0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x07, 0xE0, 0x00, 0x3D,
+  0x80, 0x03, 0xEF, 0x80, 0xFE, 0x7F, 0xFF, 0xE1, 0xFF, 0xFC, 0x01, 0xFF,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3B, 0xC0, 0x01, 0xEF, 0x00, 0x0F, 0x3C, 0x00, 0x38, 0xF0, 0x01,
+  0xE3, 0xC0, 0x0F, 0x0F, 0x00, 0x38, 0x3C, 0x01, 0xE0, 0xF0, 0x0F, 0x03,
+  0xC0, 0x38, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x00, 0xF0, 0x3C, 0x03, 0xC1,
+  0xE0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0x80,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xE0, 0x7F, 0xFF, 0x87,
+  0x01, 0xFC, 0x40, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xE0, 0x00, 0x1F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x80, 0x07, 0xCF, 0x01,
+  0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
+  0x07, 0xFF, 0xC0, 0x7F, 0xFF, 0x03, 0xF0, 0x1C, 0x1F, 0x00, 0x10, 0x78,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x3C, 0x3F, 0x80, 0xF3, 0xFF, 0x83, 0xDF, 0xFF, 0x8F,
+  0xF8, 0x3F, 0x3F, 0x80, 0x3C, 0xFC, 0x00, 0x7B, 0xF0, 0x01, 0xEF, 0x80,
+  0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xF7, 0x80, 0x03,
+  0xDE, 0x00, 0x0F, 0x78, 0x00, 0x3C, 0xF0, 0x01, 0xE3, 0xC0, 0x07, 0x87,
+  0x80, 0x3C, 0x1F, 0x83, 0xF0, 0x3F, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x3F,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80,
+  0x00, 0x78, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0,
+  0x00, 0x1E, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1E,
+  0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFE,
+  0x01, 0xFF, 0xFE, 0x0F, 0xC0, 0xFC, 0x3C, 0x00, 0xF1, 0xF0, 0x03, 0xE7,
+  0x80, 0x07, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xE3, 0xC0,
+  0x0F, 0x0F, 0x00, 0x3C, 0x1F, 0x03, 0xE0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0,
+  0x03, 0xFF, 0xF0, 0x3F, 0x03, 0xF0, 0xF0, 0x03, 0xC7, 0x80, 0x07, 0xBE,
+  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x01, 0xF7, 0x80, 0x07, 0x9F, 0x00, 0x3E,
+  0x3F, 0x03, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x01,
+  0xFC, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F, 0xC1, 0xF8, 0x3C, 0x01,
+  0xE1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x3C, 0x00, 0x1E, 0xF0, 0x00, 0x7B,
+  0xC0, 0x01, 0xEF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
+  0x01, 0xF7, 0x80, 0x0F, 0xDE, 0x00, 0x3F, 0x7C, 0x01, 0xFC, 0xFC, 0x1F,
+  0xF1, 0xFF, 0xFB, 0xC3, 0xFF, 0xCF, 0x01, 0xFC, 0x3C, 0x00, 0x01, 0xE0,
+  0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x08, 0x00, 0xF8, 0x38, 0x0F, 0xC0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0,
+  0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF3, 0xCF, 0x3C, 0xF7, 0x9E, 0x73, 0xCE, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+  0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
+  0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
+  0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
+  0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x3F, 0xFE, 0x3F, 0xFF, 0x9F, 0x07, 0xEE, 0x00, 0xF4,
+  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x07,
+  0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03,
+  0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3F, 0x80, 0x3F, 0x80, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x00,
+  0x1E, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x1E,
+  0x00, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x00, 0x01, 0xC3, 0x80, 0x1F, 0x87,
+  0x03, 0x8E, 0x01, 0xFF, 0x9C, 0x0E, 0x70, 0x0F, 0xFF, 0x70, 0x3D, 0xC0,
+  0x7C, 0x0F, 0xC0, 0x7F, 0x01, 0xE0, 0x1F, 0x01, 0xF8, 0x07, 0x00, 0x3C,
+  0x07, 0xE0, 0x38, 0x00, 0x70, 0x1F, 0x80, 0xE0, 0x01, 0xC0, 0x7E, 0x03,
+  0x80, 0x07, 0x01, 0xF8, 0x0E, 0x00, 0x1C, 0x07, 0xE0, 0x38, 0x00, 0x70,
+  0x3B, 0x80, 0xE0, 0x01, 0xC0, 0xEE, 0x01, 0xC0, 0x0F, 0x07, 0x3C, 0x07,
+  0x80, 0x7C, 0x3C, 0x70, 0x1F, 0x03, 0xF3, 0xE1, 0xC0, 0x3F, 0xFD, 0xFF,
+  0x07, 0x80, 0x7F, 0xE7, 0xF0, 0x0E, 0x00, 0x7E, 0x1E, 0x00, 0x3C, 0x00,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x07, 0xC0,
+  0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0xF7, 0x80, 0x00,
+  0x0F, 0x1E, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x3C,
+  0x1E, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0xF0, 0x1E,
+  0x00, 0x0F, 0x80, 0xF8, 0x00, 0x78, 0x03, 0xC0, 0x03, 0xC0, 0x1E, 0x00,
+  0x3E, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x7C, 0x00, 0x1F, 0x03, 0xC0, 0x00,
+  0x78, 0x1E, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x78,
+  0xF8, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x7B, 0xE0,
+  0x00, 0x01, 0xE0, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3C,
+  0x00, 0xFC, 0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xEF, 0x00, 0x07, 0xBC, 0x00,
+  0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x0F, 0xBC, 0x00, 0x3C,
+  0xF0, 0x03, 0xE3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0xF0,
+  0x03, 0xF3, 0xC0, 0x03, 0xEF, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x01, 0xEF, 0x00, 0x0F, 0xBC, 0x00, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF,
+  0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFE, 0x00,
+  0xFF, 0xFF, 0xC0, 0xFC, 0x03, 0xF0, 0xF8, 0x00, 0x78, 0xF8, 0x00, 0x0C,
+  0xF8, 0x00, 0x02, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x47, 0xC0, 0x00, 0x61, 0xF0, 0x00, 0xF0, 0x7E, 0x01, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x00,
+  0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x03, 0xC0, 0x0F, 0xE0, 0xF0, 0x00,
+  0x7E, 0x3C, 0x00, 0x0F, 0x8F, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3E, 0xF0,
+  0x00, 0x07, 0xBC, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x07, 0xBC, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x7B,
+  0xC0, 0x00, 0x3C, 0xF0, 0x00, 0x1F, 0x3C, 0x00, 0x0F, 0x8F, 0x00, 0x07,
+  0xE3, 0xC0, 0x0F, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0xF8, 0x00, 0x3C, 0x3E,
+  0x00, 0x01, 0x8F, 0x80, 0x00, 0x11, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x07, 0xFF,
+  0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x7B,
+  0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0x3C, 0x7C, 0x00,
+  0x07, 0x87, 0xC0, 0x00, 0xF0, 0x7F, 0x00, 0xFE, 0x07, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x78, 0x1E, 0x0F, 0xBF, 0xCF, 0xE3, 0xE0, 0xF0, 0x00, 0x7E,
+  0x78, 0x00, 0x7E, 0x3C, 0x00, 0x7E, 0x1E, 0x00, 0x7E, 0x0F, 0x00, 0x7E,
+  0x07, 0x80, 0x7E, 0x03, 0xC0, 0x7E, 0x01, 0xE0, 0x7E, 0x00, 0xF0, 0x7E,
+  0x00, 0x78, 0x7E, 0x00, 0x3C, 0xFC, 0x00, 0x1E, 0xFC, 0x00, 0x0F, 0xFC,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x7B, 0xF0, 0x00, 0x3C, 0xFC, 0x00, 0x1E, 0x3F, 0x00, 0x0F,
+  0x07, 0xC0, 0x07, 0x81, 0xF0, 0x03, 0xC0, 0x7C, 0x01, 0xE0, 0x1F, 0x00,
+  0xF0, 0x07, 0xC0, 0x78, 0x01, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x1F,
+  0x0F, 0x00, 0x07, 0xC7, 0x80, 0x01, 0xF3, 0xC0, 0x00, 0x7E, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+  0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFB, 0xC0,
+  0x07, 0xBF, 0xDE, 0x00, 0x3D, 0xFE, 0xF8, 0x03, 0xEF, 0xF3, 0xC0, 0x1E,
+  0x7F, 0x9F, 0x01, 0xF3, 0xFC, 0x78, 0x0F, 0x1F, 0xE3, 0xC0, 0x78, 0xFF,
+  0x1F, 0x07, 0xC7, 0xF8, 0x78, 0x3C, 0x3F, 0xC3, 0xE3, 0xE1, 0xFE, 0x0F,
+  0x1E, 0x0F, 0xF0, 0x78, 0xF0, 0x7F, 0x83, 0xEF, 0x83, 0xFC, 0x0F, 0x78,
+  0x1F, 0xE0, 0x7B, 0xC0, 0xFF, 0x01, 0xFC, 0x07, 0xF8, 0x0F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x01, 0xFE, 0x01, 0xF0, 0x0F, 0xF0, 0x0F, 0x80, 0x7F, 0x80,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xE0, 0xFC, 0x00, 0x0F,
+  0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F,
+  0xFF, 0x80, 0x0F, 0xF7, 0x80, 0x0F, 0xF7, 0xC0, 0x0F, 0xF3, 0xC0, 0x0F,
+  0xF3, 0xE0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF0, 0xF8, 0x0F,
+  0xF0, 0x78, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3E, 0x0F,
+  0xF0, 0x1E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0, 0x0F, 0x8F, 0xF0, 0x0F, 0x8F,
+  0xF0, 0x07, 0xCF, 0xF0, 0x03, 0xCF, 0xF0, 0x03, 0xEF, 0xF0, 0x01, 0xEF,
+  0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+  0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x7E, 0x00, 0xF8, 0x00, 0xF8,
+  0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x3C, 0x7C,
+  0x00, 0x01, 0xF3, 0xC0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xBC, 0x00,
+  0x00, 0x79, 0xE0, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x3E, 0x3C, 0x00, 0x01,
+  0xE1, 0xF0, 0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0, 0x1F, 0x00, 0x1F, 0x00,
+  0x7E, 0x03, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
+  0xFC, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0x00, 0xFC,
+  0xF0, 0x03, 0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00,
+  0x1E, 0xF0, 0x03, 0xEF, 0x00, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF,
+  0xFC, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x7E, 0x00, 0xF8,
+  0x00, 0xF8, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00,
+  0x3C, 0x7C, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x3D,
+  0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xBC, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x3E, 0x3C,
+  0x00, 0x01, 0xE1, 0xF0, 0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0, 0x1F, 0x00,
+  0x1F, 0x00, 0x7E, 0x03, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x03, 0xE0, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xF0,
+  0x07, 0xE0, 0xF0, 0x03, 0xE0, 0xF0, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0xF0,
+  0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0,
+  0x00, 0xF0, 0xF0, 0x01, 0xE0, 0xF0, 0x03, 0xE0, 0xF0, 0x07, 0xC0, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x80, 0xF0,
+  0x07, 0xC0, 0xF0, 0x03, 0xE0, 0xF0, 0x01, 0xE0, 0xF0, 0x01, 0xF0, 0xF0,
+  0x00, 0xF0, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0x78, 0xF0, 0x00, 0x7C, 0xF0,
+  0x00, 0x3C, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1F, 0x01,
+  0xFE, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFF, 0x0F, 0xC0, 0x7C, 0x7C, 0x00,
+  0x71, 0xE0, 0x00, 0x4F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFE,
+  0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xB8, 0x00, 0x3E, 0xFC, 0x03, 0xF3, 0xFF, 0xFF, 0x87, 0xFF, 0xFC,
+  0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x7C,
+  0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xE0, 0x01, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x07,
+  0x9E, 0x00, 0x00, 0x3C, 0xF8, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x1E, 0x1E,
+  0x00, 0x00, 0xF0, 0x78, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x78, 0x1F, 0x00,
+  0x07, 0xC0, 0x78, 0x00, 0x3C, 0x03, 0xC0, 0x01, 0xE0, 0x1F, 0x00, 0x1F,
+  0x00, 0x78, 0x00, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x00, 0x78, 0x00,
+  0x78, 0x03, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x7C,
+  0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x7C, 0x7C,
+  0x00, 0x01, 0xE3, 0xC0, 0x00, 0x0F, 0x1E, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x01, 0xEF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00,
+  0x7E, 0x00, 0x0F, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x78, 0x00, 0xFF, 0x00,
+  0x1E, 0x78, 0x00, 0xFF, 0x00, 0x1E, 0x78, 0x00, 0xFF, 0x00, 0x1E, 0x7C,
+  0x00, 0xFF, 0x00, 0x3E, 0x3C, 0x01, 0xE7, 0x80, 0x3C, 0x3C, 0x01, 0xE7,
+  0x80, 0x3C, 0x3C, 0x01, 0xE7, 0x80, 0x3C, 0x3E, 0x01, 0xE7, 0x80, 0x7C,
+  0x1E, 0x03, 0xC3, 0xC0, 0x78, 0x1E, 0x03, 0xC3, 0xC0, 0x78, 0x1E, 0x03,
+  0xC3, 0xC0, 0x78, 0x1F, 0x03, 0xC3, 0xC0, 0xF8, 0x0F, 0x07, 0x81, 0xE0,
+  0xF0, 0x0F, 0x07, 0x81, 0xE0, 0xF0, 0x0F, 0x07, 0x81, 0xE0, 0xF0, 0x0F,
+  0x87, 0x81, 0xE1, 0xF0, 0x07, 0x8F, 0x00, 0xF1, 0xE0, 0x07, 0x8F, 0x00,
+  0xF1, 0xE0, 0x07, 0x8F, 0x00, 0xF1, 0xE0, 0x07, 0xCF, 0x00, 0xF3, 0xE0,
+  0x03, 0xDE, 0x00, 0x7B, 0xC0, 0x03, 0xDE, 0x00, 0x7B, 0xC0, 0x03, 0xDE,
+  0x00, 0x7B, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x3F,
+  0x80, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00,
+  0xFC, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x07,
+  0xC7, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x0F, 0x80, 0x0F, 0x80, 0xF8,
+  0x03, 0xE0, 0x0F, 0x80, 0xF8, 0x01, 0xF0, 0x1F, 0x00, 0x1F, 0x07, 0xC0,
+  0x01, 0xF1, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x3F,
+  0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xEF,
+  0x00, 0x00, 0x7D, 0xF0, 0x00, 0x1F, 0x1F, 0x00, 0x07, 0xC1, 0xF0, 0x00,
+  0xF8, 0x3E, 0x00, 0x3E, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x01, 0xF0, 0x07,
+  0xC0, 0x7C, 0x00, 0x7C, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0xF8, 0xF8,
+  0x00, 0x0F, 0xBE, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x07, 0xDF, 0x00, 0x03,
+  0xE3, 0xE0, 0x01, 0xF0, 0xF8, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x03, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x03, 0xE0, 0x03, 0xE1, 0xF0, 0x00,
+  0xF8, 0x7C, 0x00, 0x1F, 0x3E, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
+  0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07,
+  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x07, 0x83, 0xC1,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0xFF, 0xFF, 0xFC, 0xF0,
+  0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xF0, 0x03,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0F, 0x07, 0x83, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x1F, 0x1F,
+  0x00, 0x07, 0xC1, 0xF0, 0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x1F,
+  0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0x1F, 0x7C, 0x00, 0x01,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x0F, 0xFC, 0x03, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x83, 0xC0, 0xFC, 0x20, 0x03, 0xE0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x03, 0xFF, 0xF1,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xF7, 0xE0, 0x0F, 0x78, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF8, 0x07,
+  0xF7, 0xC0, 0xFF, 0x3F, 0xFE, 0xF1, 0xFF, 0xCF, 0x07, 0xE0, 0xF0, 0xF0,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0xFC, 0x07, 0x9F,
+  0xF8, 0x3D, 0xFF, 0xF1, 0xFE, 0x0F, 0x8F, 0xE0, 0x3E, 0x7E, 0x00, 0xFB,
+  0xE0, 0x03, 0xDF, 0x00, 0x1E, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
+  0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
+  0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xBE, 0x00, 0x3D, 0xF8, 0x03,
+  0xEF, 0xE0, 0x3E, 0x7F, 0x83, 0xE3, 0xDF, 0xFF, 0x1E, 0x7F, 0xE0, 0xF0,
+  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xFC, 0x3F, 0xFF, 0x8F, 0xC0, 0x73,
+  0xE0, 0x02, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1E,
+  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C,
+  0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x1E,
+  0x00, 0x03, 0xE0, 0x02, 0x3F, 0x01, 0xC3, 0xFF, 0xF8, 0x1F, 0xFF, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x01,
+  0xF8, 0x78, 0x3F, 0xF3, 0xC7, 0xFF, 0xDE, 0x3E, 0x0F, 0xF3, 0xE0, 0x3F,
+  0xBE, 0x00, 0xFD, 0xE0, 0x03, 0xEF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F,
+  0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7B, 0xC0, 0x07, 0xDE, 0x00,
+  0x3E, 0xF8, 0x03, 0xF3, 0xE0, 0x3F, 0x8F, 0x83, 0xFC, 0x7F, 0xFD, 0xE0,
+  0xFF, 0xCF, 0x03, 0xF8, 0x78, 0x00, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xFF,
+  0xFE, 0x07, 0xE0, 0xFC, 0x3E, 0x00, 0xF0, 0xF0, 0x01, 0xE7, 0x80, 0x07,
+  0x9E, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3E, 0x00, 0x08, 0x7E, 0x01, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00,
+  0xFF, 0xE0, 0x00, 0xFE, 0x07, 0xFC, 0x1F, 0xF8, 0x3C, 0x00, 0xF0, 0x01,
+  0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x01, 0xFF, 0xFB, 0xFF, 0xF7, 0xFF,
+  0xE0, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+  0x07, 0x80, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xF3, 0xC7, 0xFF, 0xDE,
+  0x3E, 0x0F, 0xF3, 0xE0, 0x3F, 0xBE, 0x00, 0xFD, 0xE0, 0x03, 0xEF, 0x00,
+  0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
+  0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
+  0x7B, 0xC0, 0x07, 0xDE, 0x00, 0x3E, 0xF8, 0x03, 0xF3, 0xE0, 0x3F, 0x8F,
+  0x83, 0xFC, 0x7F, 0xFD, 0xE0, 0xFF, 0xCF, 0x03, 0xF8, 0x78, 0x00, 0x03,
+  0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x08, 0x00, 0xF0, 0x70,
+  0x1F, 0x83, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xFE, 0x0F, 0x3F, 0xF8, 0xF7,
+  0xFF, 0xCF, 0xF0, 0x7E, 0xFC, 0x03, 0xEF, 0xC0, 0x1E, 0xF8, 0x00, 0xFF,
+  0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xF0,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x7C, 0x3D, 0xFE, 0xFE,
+  0x7C, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00,
+  0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0,
+  0x00, 0x07, 0x80, 0x1F, 0x3C, 0x03, 0xF1, 0xE0, 0x3F, 0x0F, 0x03, 0xF0,
+  0x78, 0x3F, 0x03, 0xC3, 0xF0, 0x1E, 0x3F, 0x00, 0xF3, 0xF0, 0x07, 0xBF,
+  0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03,
+  0xFF, 0x00, 0x1E, 0xFC, 0x00, 0xF1, 0xF0, 0x07, 0x87, 0xC0, 0x3C, 0x1F,
+  0x01, 0xE0, 0x7C, 0x0F, 0x01, 0xF0, 0x78, 0x07, 0xC3, 0xC0, 0x1F, 0x1E,
+  0x00, 0x7C, 0xF0, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC,
+  0x01, 0xF8, 0x3C, 0xFF, 0xC1, 0xFF, 0x8F, 0x7F, 0xF8, 0xFF, 0xF3, 0xFC,
+  0x3F, 0x78, 0x7E, 0xFC, 0x03, 0xD8, 0x07, 0xBE, 0x00, 0xFC, 0x01, 0xEF,
+  0x80, 0x1F, 0x00, 0x3F, 0xC0, 0x07, 0x80, 0x0F, 0xF0, 0x01, 0xE0, 0x03,
+  0xFC, 0x00, 0x78, 0x00, 0xFF, 0x00, 0x1E, 0x00, 0x3F, 0xC0, 0x07, 0x80,
+  0x0F, 0xF0, 0x01, 0xE0, 0x03, 0xFC, 0x00, 0x78, 0x00, 0xFF, 0x00, 0x1E,
+  0x00, 0x3F, 0xC0, 0x07, 0x80, 0x0F, 0xF0, 0x01, 0xE0, 0x03, 0xFC, 0x00,
+  0x78, 0x00, 0xFF, 0x00, 0x1E, 0x00, 0x3F, 0xC0, 0x07, 0x80, 0x0F, 0xF0,
+  0x01, 0xE0, 0x03, 0xFC, 0x00, 0x78, 0x00, 0xFF, 0x00, 0x1E, 0x00, 0x3F,
+  0xC0, 0x07, 0x80, 0x0F, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0xFE, 0x0F,
+  0x3F, 0xF8, 0xF7, 0xFF, 0xCF, 0xF0, 0x7E, 0xFC, 0x03, 0xEF, 0xC0, 0x1E,
+  0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF0,
+  0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xC1, 0xF8, 0x3E,
+  0x01, 0xF1, 0xF0, 0x03, 0xE7, 0x80, 0x07, 0x9E, 0x00, 0x1E, 0xF0, 0x00,
+  0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7D, 0xE0,
+  0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3E, 0x01, 0xF0, 0x7E, 0x0F,
+  0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x07,
+  0x9F, 0xF8, 0x3D, 0xFF, 0xF1, 0xFE, 0x0F, 0x8F, 0xE0, 0x3E, 0x7E, 0x00,
+  0xFB, 0xE0, 0x03, 0xDF, 0x00, 0x1E, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC,
+  0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xBE, 0x00, 0x3D, 0xF8,
+  0x03, 0xEF, 0xE0, 0x3E, 0x7F, 0x83, 0xE3, 0xDF, 0xFF, 0x1E, 0x7F, 0xE0,
+  0xF0, 0xFE, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xF3, 0xC7, 0xFF, 0xDE, 0x3E,
+  0x0F, 0xF3, 0xE0, 0x3F, 0xBE, 0x00, 0xFD, 0xE0, 0x03, 0xEF, 0x00, 0x1F,
+  0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
+  0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7B,
+  0xC0, 0x07, 0xDE, 0x00, 0x3E, 0xF8, 0x03, 0xF3, 0xE0, 0x3F, 0x8F, 0x83,
+  0xFC, 0x7F, 0xFD, 0xE0, 0xFF, 0xCF, 0x03, 0xF8, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xCF,
+  0xFF, 0x7F, 0xFF, 0xC1, 0xFE, 0x03, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x00, 0x07, 0xFE, 0x07, 0xFF, 0xE3, 0xFF, 0xF9,
+  0xF0, 0x1E, 0xF8, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF8,
+  0x00, 0x3F, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xFF,
+  0xC0, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x80, 0x07, 0xBC, 0x03, 0xEF, 0xFF, 0xF3, 0xFF, 0xF8, 0x1F,
+  0xF0, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0xC0, 0x07, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0xF0,
+  0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
+  0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F,
+  0x80, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
+  0xF7, 0x80, 0x1F, 0x78, 0x03, 0xF7, 0xE0, 0xFF, 0x3F, 0xFE, 0xF1, 0xFF,
+  0xCF, 0x07, 0xF0, 0xF0, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x79, 0xE0, 0x00,
+  0xF3, 0xE0, 0x03, 0xE3, 0xC0, 0x07, 0x87, 0x80, 0x0F, 0x0F, 0x80, 0x3E,
+  0x0F, 0x00, 0x78, 0x1E, 0x00, 0xF0, 0x3E, 0x03, 0xE0, 0x3C, 0x07, 0x80,
+  0x7C, 0x1F, 0x00, 0x78, 0x3C, 0x00, 0xF0, 0x78, 0x01, 0xF1, 0xF0, 0x01,
+  0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0xDF, 0x00, 0x07, 0xBC, 0x00, 0x0F,
+  0x78, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3E,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xF8, 0x03, 0xC0, 0x1F, 0x78, 0x07, 0xE0,
+  0x1E, 0x78, 0x07, 0xE0, 0x1E, 0x78, 0x07, 0xE0, 0x1E, 0x7C, 0x07, 0xE0,
+  0x3E, 0x3C, 0x0E, 0x70, 0x3C, 0x3C, 0x0E, 0x70, 0x3C, 0x3C, 0x0E, 0x70,
+  0x3C, 0x3E, 0x0E, 0x70, 0x7C, 0x1E, 0x1C, 0x38, 0x78, 0x1E, 0x1C, 0x38,
+  0x78, 0x1E, 0x1C, 0x38, 0x78, 0x0F, 0x3C, 0x3C, 0xF8, 0x0F, 0x38, 0x1C,
+  0xF0, 0x0F, 0x38, 0x1C, 0xF0, 0x0F, 0x38, 0x1C, 0xF0, 0x07, 0xF8, 0x1F,
+  0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x0F,
+  0xE0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xE0, 0x07,
+  0xC0, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0xF8, 0x7C, 0x03, 0xE0, 0x7C, 0x0F,
+  0x80, 0xF8, 0x1F, 0x00, 0xF8, 0x7C, 0x00, 0xF9, 0xF0, 0x00, 0xFF, 0xC0,
+  0x01, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00,
+  0x07, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xF7, 0xC0, 0x03,
+  0xE7, 0xC0, 0x0F, 0x87, 0x80, 0x3E, 0x0F, 0x80, 0xF8, 0x0F, 0x81, 0xF0,
+  0x0F, 0x87, 0xC0, 0x1F, 0x1F, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8, 0x00,
+  0x3E, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF3, 0xE0, 0x03, 0xE3, 0xC0, 0x07,
+  0x87, 0xC0, 0x1F, 0x07, 0x80, 0x3C, 0x0F, 0x00, 0x78, 0x1F, 0x01, 0xF0,
+  0x1E, 0x03, 0xC0, 0x3E, 0x07, 0x80, 0x3C, 0x1E, 0x00, 0x78, 0x3C, 0x00,
+  0xF8, 0xF8, 0x00, 0xF1, 0xE0, 0x01, 0xF3, 0xC0, 0x01, 0xEF, 0x00, 0x03,
+  0xDE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+  0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00,
+  0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xEF,
+  0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00,
+  0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
+  0xFC, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F,
+  0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x3F,
+  0xE0, 0x1E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01,
+  0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0,
+  0x0F, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0,
+  0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F,
+  0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x07, 0xF0,
+  0x0F, 0xF8, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07,
+  0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x07,
+  0xFC, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x04, 0xFF, 0xF0, 0x03, 0xBF, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFD, 0xC0,
+  0x0F, 0xFF, 0x20, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x18, 0x00, 0x03,
+  0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x3F,
+  0xE0, 0x1F, 0xFF, 0x0F, 0xFF, 0xE3, 0xF3, 0x1C, 0xF8, 0x60, 0x9E, 0x0C,
+  0x07, 0xC1, 0x80, 0xF0, 0x30, 0x3E, 0x06, 0x07, 0x80, 0xC0, 0xF0, 0x18,
+  0x1E, 0x03, 0x03, 0xC0, 0x60, 0x78, 0x0C, 0x0F, 0x01, 0x81, 0xE0, 0x30,
+  0x3E, 0x06, 0x03, 0xC0, 0xC0, 0x78, 0x18, 0x07, 0x83, 0x00, 0xF8, 0x60,
+  0x8F, 0xCC, 0x70, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0xC0,
+  0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x01, 0x80,
+  0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xE0, 0x70, 0x3E,
+  0x00, 0x81, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xE0, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x20, 0x00, 0x04, 0x70, 0x00, 0x0E, 0xF8, 0x00, 0x1F, 0x7C, 0x7E, 0x3E,
+  0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0E, 0x00, 0x70, 0x1E, 0x00, 0x78, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38,
+  0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1E, 0x00, 0x78, 0x0E, 0x00, 0x70,
+  0x0F, 0x00, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+  0x7C, 0x7E, 0x3E, 0xF8, 0x00, 0x1F, 0x70, 0x00, 0x0E, 0x20, 0x00, 0x04,
+  0xF8, 0x00, 0x1F, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C,
+  0x1E, 0x00, 0x78, 0x1F, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x81, 0xF0,
+  0x07, 0x81, 0xE0, 0x07, 0xC3, 0xE0, 0x03, 0xC3, 0xC0, 0x03, 0xE7, 0xC0,
+  0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0xFE, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x07, 0xFF, 0xC3, 0xFF, 0xF0, 0xF8,
+  0x0C, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0xE0, 0x00, 0xFE, 0x00, 0x7F, 0xC0, 0x39, 0xFC, 0x1E, 0x3F, 0x8F,
+  0x03, 0xF3, 0xC0, 0x7E, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x3D, 0xF0,
+  0x0F, 0x7E, 0x03, 0xCF, 0xE0, 0xE1, 0xFC, 0x78, 0x1F, 0xFC, 0x03, 0xFE,
+  0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x01, 0xE0,
+  0x00, 0x78, 0x00, 0x3E, 0x30, 0x1F, 0x0F, 0xFF, 0xC3, 0xFF, 0xC0, 0x3F,
+  0xE0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+  0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x70,
+  0x00, 0x1C, 0x01, 0x80, 0x00, 0x0C, 0x07, 0x03, 0xFC, 0x0C, 0x1C, 0x1F,
+  0xFE, 0x1C, 0x30, 0x7F, 0xFC, 0x18, 0xC1, 0xF0, 0x18, 0x19, 0x87, 0x80,
+  0x00, 0x37, 0x0E, 0x00, 0x00, 0x6C, 0x3C, 0x00, 0x00, 0x78, 0x70, 0x00,
+  0x00, 0xF0, 0xE0, 0x00, 0x01, 0xE1, 0xC0, 0x00, 0x03, 0xC3, 0x80, 0x00,
+  0x07, 0x87, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x1F, 0x0E, 0x00, 0x00,
+  0x66, 0x1E, 0x00, 0x00, 0xCC, 0x1F, 0x01, 0x81, 0x8C, 0x1F, 0xFF, 0x06,
+  0x1C, 0x1F, 0xFE, 0x1C, 0x1C, 0x0F, 0xF0, 0x30, 0x1C, 0x00, 0x00, 0xC0,
+  0x1C, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0x01, 0xF0, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0xF1,
+  0x80, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC3, 0xFF, 0x9F, 0xFF, 0x78,
+  0x0F, 0xE0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x01, 0xFE, 0x07, 0xDE, 0x1F,
+  0x9F, 0xF7, 0x1F, 0x8E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x40, 0x20, 0x18, 0x0C, 0x07, 0x03, 0x81, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x1E, 0x0F, 0x03,
+  0xE1, 0xF0, 0x3E, 0x1F, 0x03, 0xE1, 0xF0, 0x1E, 0x0F, 0x01, 0xE0, 0xF0,
+  0x1E, 0x0F, 0x01, 0xC0, 0xE0, 0x18, 0x0C, 0x01, 0x00, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00,
+  0x00, 0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+  0x70, 0x00, 0x1C, 0x01, 0x80, 0x00, 0x0C, 0x07, 0x1F, 0xF8, 0x0C, 0x1C,
+  0x3F, 0xFC, 0x1C, 0x30, 0x70, 0x38, 0x18, 0xC0, 0xE0, 0x38, 0x19, 0x81,
+  0xC0, 0x70, 0x37, 0x03, 0x80, 0xE0, 0x6C, 0x07, 0x01, 0xC0, 0x78, 0x0E,
+  0x07, 0x00, 0xF0, 0x1F, 0xFC, 0x01, 0xE0, 0x3F, 0xE0, 0x03, 0xC0, 0x71,
+  0xE0, 0x07, 0x80, 0xE1, 0xE0, 0x0F, 0x01, 0xC1, 0xC0, 0x1F, 0x03, 0x83,
+  0xC0, 0x66, 0x07, 0x03, 0x80, 0xCC, 0x0E, 0x07, 0x81, 0x8C, 0x1C, 0x07,
+  0x86, 0x1C, 0x38, 0x07, 0x1C, 0x1C, 0x70, 0x0F, 0x30, 0x1C, 0x00, 0x00,
+  0xC0, 0x1C, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0x01, 0xF0,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x0F, 0x81, 0xFF, 0x1F, 0xFC, 0xF1, 0xEF, 0x07, 0xF0, 0x1F,
+  0x80, 0xFC, 0x07, 0xF0, 0x7B, 0xC7, 0x9F, 0xFC, 0x7F, 0xC0, 0xF8, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x0F, 0xFC, 0xC1,
+  0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x01, 0xE0, 0x3C, 0x03,
+  0x80, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+  0xC3, 0xFF, 0x98, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x03, 0xC3, 0xFC,
+  0x1F, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x01, 0xF0,
+  0x1E, 0xFF, 0xE1, 0xFC, 0x00, 0x07, 0xC1, 0xE0, 0xF0, 0x78, 0x1C, 0x0E,
+  0x07, 0x03, 0xC0, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7,
+  0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78,
+  0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80,
+  0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00,
+  0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xE3, 0xE0, 0x07, 0xC7, 0xE0, 0x1F,
+  0x8F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9F, 0xF8, 0xFC, 0x1E,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xFC, 0x7F, 0xFF, 0x9F, 0xF8, 0x77,
+  0xFF, 0x0E, 0xFF, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x87, 0xFF, 0xF0, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x77, 0xFF, 0x0E, 0xFF, 0xE1, 0xCF,
+  0xFC, 0x38, 0xFF, 0x87, 0x0F, 0xF0, 0xE0, 0x1E, 0x1C, 0x01, 0xC3, 0x80,
+  0x38, 0x70, 0x07, 0x0E, 0x00, 0xE1, 0xC0, 0x1C, 0x38, 0x03, 0x87, 0x00,
+  0x70, 0xE0, 0x0E, 0x1C, 0x01, 0xC3, 0x80, 0x38, 0x70, 0x07, 0x0E, 0x00,
+  0xE1, 0xC0, 0x1C, 0x38, 0x03, 0x87, 0x00, 0x70, 0xE0, 0x0E, 0x1C, 0x01,
+  0xC3, 0x80, 0xFF, 0xFF, 0xF0, 0x0E, 0x03, 0x80, 0xE0, 0x78, 0x7F, 0xFF,
+  0xFD, 0xFC, 0x3E, 0x1F, 0xC3, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0xFF, 0xFF, 0xFC, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x78, 0x1E, 0x70,
+  0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0x70, 0x0E, 0x78, 0x1E, 0x3C, 0x3C, 0x1F, 0xF8, 0x07,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x80, 0x40, 0x18,
+  0x0C, 0x03, 0x81, 0xC0, 0x78, 0x3C, 0x07, 0x83, 0xC0, 0x78, 0x3C, 0x07,
+  0xC3, 0xE0, 0x7C, 0x3E, 0x07, 0xC3, 0xE0, 0x78, 0x3C, 0x1F, 0x0F, 0x87,
+  0xC3, 0xE1, 0xF0, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0xE0,
+  0x70, 0x18, 0x0C, 0x02, 0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x07,
+  0xF0, 0x00, 0x03, 0x80, 0x33, 0x80, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x03,
+  0xC0, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38,
+  0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x0F, 0x00,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x03, 0x80, 0x07, 0x80, 0x00, 0x1C, 0x00,
+  0x78, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x00,
+  0x38, 0x01, 0xC0, 0x0F, 0x01, 0xC0, 0x1E, 0x00, 0xF8, 0xFF, 0xE1, 0xE0,
+  0x07, 0xC7, 0xFF, 0x0E, 0x00, 0x6E, 0x00, 0x00, 0xF0, 0x07, 0x70, 0x00,
+  0x07, 0x00, 0x73, 0x80, 0x00, 0x78, 0x03, 0x1C, 0x00, 0x07, 0x80, 0x38,
+  0xE0, 0x00, 0x38, 0x03, 0x87, 0x00, 0x03, 0xC0, 0x38, 0x38, 0x00, 0x1C,
+  0x01, 0x81, 0xC0, 0x01, 0xC0, 0x1C, 0x0E, 0x00, 0x1E, 0x00, 0xFF, 0xFE,
+  0x00, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0x1C, 0x00, 0xF0, 0x00,
+  0x00, 0xE0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x78, 0x00, 0x00, 0x38, 0x3E,
+  0x00, 0x00, 0x78, 0x1F, 0xC0, 0x00, 0x0E, 0x03, 0x38, 0x00, 0x03, 0xC0,
+  0x07, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x07,
+  0x80, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00,
+  0x0F, 0x00, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x78, 0x00, 0x07,
+  0x00, 0x1E, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x1C, 0x00, 0xF0, 0x00,
+  0x03, 0x80, 0x1C, 0x1F, 0x80, 0x70, 0x07, 0x8F, 0xFC, 0xFF, 0xE1, 0xE1,
+  0x83, 0xDF, 0xFC, 0x38, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x03, 0x80,
+  0x03, 0x80, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x38, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x70,
+  0x00, 0x7F, 0xF8, 0x1E, 0x00, 0x0F, 0xFF, 0x1F, 0xC0, 0x00, 0x3C, 0x01,
+  0xFF, 0xC0, 0x00, 0xE0, 0x06, 0x07, 0x80, 0x07, 0x80, 0x00, 0x0E, 0x00,
+  0x3C, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0xE0, 0x00, 0x1F, 0xE0, 0x07,
+  0x80, 0x00, 0x03, 0xC0, 0x1C, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00,
+  0x0E, 0x07, 0x80, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0xF0,
+  0x00, 0x00, 0x07, 0x83, 0x80, 0x1E, 0x20, 0x3C, 0x1E, 0x00, 0xF8, 0xFF,
+  0xE0, 0xF0, 0x03, 0xE0, 0xFE, 0x03, 0x80, 0x1B, 0x80, 0x00, 0x1E, 0x00,
+  0xEE, 0x00, 0x00, 0x70, 0x07, 0x38, 0x00, 0x03, 0xC0, 0x18, 0xE0, 0x00,
+  0x1E, 0x00, 0xE3, 0x80, 0x00, 0x70, 0x07, 0x0E, 0x00, 0x03, 0xC0, 0x38,
+  0x38, 0x00, 0x0E, 0x00, 0xC0, 0xE0, 0x00, 0x70, 0x07, 0x03, 0x80, 0x03,
+  0xC0, 0x1F, 0xFF, 0xC0, 0x0E, 0x00, 0x7F, 0xFF, 0x00, 0x78, 0x00, 0x00,
+  0xE0, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x78,
+  0x00, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78,
+  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x03,
+  0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
+  0xE0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x1E, 0x00, 0x17, 0x80, 0x1B, 0xF0, 0x7C, 0xFF, 0xFE, 0x3F, 0xFE, 0x07,
+  0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xBC, 0x00,
+  0x00, 0x3D, 0xE0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1E, 0x3C, 0x00, 0x01,
+  0xF1, 0xF0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x78, 0x3C, 0x00, 0x07, 0xC0,
+  0xF0, 0x00, 0x3C, 0x07, 0x80, 0x03, 0xE0, 0x3E, 0x00, 0x1E, 0x00, 0xF0,
+  0x00, 0xF0, 0x07, 0x80, 0x0F, 0x80, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x07,
+  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0x00,
+  0x07, 0xC0, 0xF0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x03,
+  0xC3, 0xC0, 0x00, 0x1E, 0x3E, 0x00, 0x00, 0xF9, 0xE0, 0x00, 0x03, 0xCF,
+  0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x03, 0xC7, 0x80,
+  0x00, 0x1E, 0x3C, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x07, 0x80, 0x00,
+  0x78, 0x3C, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x3C, 0x07, 0x80, 0x03, 0xE0,
+  0x3E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0xF0, 0x07, 0x80, 0x0F, 0x80, 0x3E,
+  0x00, 0x78, 0x00, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x01,
+  0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x1E, 0x07, 0x80,
+  0x00, 0xF0, 0x78, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1E, 0x3E, 0x00, 0x00,
+  0xF9, 0xE0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x78,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00,
+  0x71, 0xC0, 0x00, 0x07, 0x07, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x3D,
+  0xE0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1E, 0x3C, 0x00, 0x01, 0xF1, 0xF0,
+  0x00, 0x0F, 0x07, 0x80, 0x00, 0x78, 0x3C, 0x00, 0x07, 0xC0, 0xF0, 0x00,
+  0x3C, 0x07, 0x80, 0x03, 0xE0, 0x3E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0xF0,
+  0x07, 0x80, 0x0F, 0x80, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x07, 0xFF, 0xFF,
+  0xC0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x07, 0xC0,
+  0xF0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x03, 0xC3, 0xC0,
+  0x00, 0x1E, 0x3E, 0x00, 0x00, 0xF9, 0xE0, 0x00, 0x03, 0xCF, 0x00, 0x00,
+  0x1E, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x38, 0x00, 0x03, 0xF9, 0xC0,
+  0x00, 0x3F, 0xFE, 0x00, 0x01, 0xCF, 0xE0, 0x00, 0x0E, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF7, 0x80, 0x00,
+  0x07, 0xBC, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x3E,
+  0x3E, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0xF8, 0x1E,
+  0x00, 0x07, 0x80, 0xF0, 0x00, 0x7C, 0x07, 0xC0, 0x03, 0xC0, 0x1E, 0x00,
+  0x1E, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0xFF,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x03, 0xE0, 0x00,
+  0xF8, 0x1E, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x78,
+  0x78, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x79, 0xE0,
+  0x00, 0x03, 0xDF, 0x00, 0x00, 0x0F, 0x00, 0x78, 0xF0, 0x00, 0x03, 0xC7,
+  0x80, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0xF7, 0x80,
+  0x00, 0x0F, 0x1E, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0x00,
+  0x3C, 0x1E, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0xF0,
+  0x1E, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x78, 0x03, 0xC0, 0x03, 0xC0, 0x1E,
+  0x00, 0x3E, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x7C, 0x00, 0x1F, 0x03, 0xC0,
+  0x00, 0x78, 0x1E, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00,
+  0x78, 0xF8, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x7B,
+  0xE0, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x07, 0x07, 0x00, 0x00, 0x38,
+  0x38, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x38, 0xE0,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07,
+  0xBC, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x1E, 0x3C,
+  0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x78, 0x3C, 0x00,
+  0x07, 0x80, 0xF0, 0x00, 0x3C, 0x07, 0x80, 0x03, 0xE0, 0x3E, 0x00, 0x1E,
+  0x00, 0xF0, 0x01, 0xF0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x7F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x03, 0xE0, 0x00, 0xF8,
+  0x1E, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x1E, 0x0F, 0x80, 0x00, 0xF8, 0x78,
+  0x00, 0x03, 0xC7, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x79, 0xE0, 0x00,
+  0x03, 0xDF, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0xF0, 0x00,
+  0x00, 0x01, 0xF1, 0xE0, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x0F,
+  0x87, 0x80, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x1E, 0x00,
+  0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x00, 0x07,
+  0xC0, 0xF0, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xFF, 0xC0, 0x3E, 0x03, 0xFF,
+  0xFF, 0x80, 0x78, 0x07, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x03,
+  0xE0, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x78,
+  0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
+  0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x01,
+  0xFF, 0xFF, 0xEF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
+  0x80, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0xFC,
+  0x03, 0xF0, 0xF8, 0x00, 0x78, 0xF8, 0x00, 0x0C, 0xF8, 0x00, 0x02, 0x78,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x47, 0xC0,
+  0x00, 0x61, 0xF0, 0x00, 0xF0, 0x7E, 0x01, 0xF8, 0x1F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x02, 0x1E, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x00, 0x00,
+  0xE0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x1F,
+  0xC0, 0x01, 0xDC, 0x00, 0x38, 0xE0, 0x07, 0x07, 0x00, 0xE0, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xEF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x78, 0x3C, 0x1C, 0x0E, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0F, 0x1E,
+  0x3C, 0x38, 0x70, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x0F, 0xC0, 0x3F, 0x01, 0xFE, 0x0F, 0x3C, 0x78, 0x7B,
+  0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xE0,
+  0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
+  0xF0, 0x03, 0xC0, 0x0F, 0xE0, 0x0F, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x0F,
+  0x80, 0xF0, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x78,
+  0x3C, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x0F, 0x0F,
+  0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+  0x80, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF0, 0xF0, 0x00,
+  0x03, 0xC3, 0xC0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x01,
+  0xE0, 0xF0, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x3E, 0x0F, 0x00, 0x01, 0xF0,
+  0x3C, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0xE0, 0x0F,
+  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01,
+  0xE0, 0xE0, 0x03, 0xF8, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0x1F, 0xC0, 0x07,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF,
+  0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xF7, 0x80, 0x0F, 0xF7,
+  0xC0, 0x0F, 0xF3, 0xC0, 0x0F, 0xF3, 0xE0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF1,
+  0xF0, 0x0F, 0xF0, 0xF8, 0x0F, 0xF0, 0x78, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0,
+  0x3C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x1E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0,
+  0x0F, 0x8F, 0xF0, 0x0F, 0x8F, 0xF0, 0x07, 0xCF, 0xF0, 0x03, 0xCF, 0xF0,
+  0x03, 0xEF, 0xF0, 0x01, 0xEF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xF0,
+  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00,
+  0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x07, 0xC0,
+  0x07, 0xC0, 0x7C, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x3C, 0x00, 0x01,
+  0xE3, 0xE0, 0x00, 0x0F, 0x9E, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x01, 0xEF,
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D,
+  0xE0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x01, 0xF1, 0xE0,
+  0x00, 0x0F, 0x0F, 0x80, 0x00, 0xF8, 0x3E, 0x00, 0x0F, 0x80, 0xF8, 0x00,
+  0xF8, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00,
+  0x7E, 0x03, 0xF0, 0x07, 0xC0, 0x07, 0xC0, 0x7C, 0x00, 0x1F, 0x07, 0xC0,
+  0x00, 0x7C, 0x3C, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x0F, 0x9E, 0x00, 0x00,
+  0x3C, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x7D, 0xE0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E,
+  0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0xF8, 0x3E,
+  0x00, 0x0F, 0x80, 0xF8, 0x00, 0xF8, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xFF,
+  0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x71, 0xC0, 0x00,
+  0x07, 0x07, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
+  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x07, 0xC0, 0x07, 0xC0,
+  0x7C, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x3C, 0x00, 0x01, 0xE3, 0xE0,
+  0x00, 0x0F, 0x9E, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0xE0, 0x00,
+  0x03, 0xCF, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F,
+  0x0F, 0x80, 0x00, 0xF8, 0x3E, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0xF8, 0x03,
+  0xF0, 0x1F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+  0xE0, 0x00, 0x00, 0x3C, 0x38, 0x00, 0x03, 0xF9, 0xC0, 0x00, 0x3F, 0xFE,
+  0x00, 0x01, 0xCF, 0xE0, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x7E, 0x00, 0xF8, 0x00,
+  0xF8, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x3C,
+  0x7C, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x3D, 0xE0,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xBC,
+  0x00, 0x00, 0x79, 0xE0, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x3E, 0x3C, 0x00,
+  0x01, 0xE1, 0xF0, 0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0, 0x1F, 0x00, 0x1F,
+  0x00, 0x7E, 0x03, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1E,
+  0x3C, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x1F, 0xFF, 0xF0, 0x01, 0xF8, 0x0F, 0xC0, 0x1F, 0x00, 0x1F, 0x01, 0xF0,
+  0x00, 0x7C, 0x1F, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x07, 0x8F, 0x80, 0x00,
+  0x3E, 0x78, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1F,
+  0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x0F,
+  0x3C, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x3C, 0x3E,
+  0x00, 0x03, 0xE0, 0xF8, 0x00, 0x3E, 0x03, 0xE0, 0x03, 0xE0, 0x0F, 0xC0,
+  0x7E, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0x80,
+  0x00, 0x40, 0x00, 0x02, 0x60, 0x00, 0x06, 0xF0, 0x00, 0x0F, 0x78, 0x00,
+  0x1E, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x78, 0x0F, 0x00, 0xF0, 0x07, 0x81,
+  0xE0, 0x03, 0xC3, 0xC0, 0x01, 0xE7, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xE7, 0x80, 0x03, 0xC3,
+  0xC0, 0x07, 0x81, 0xE0, 0x0F, 0x00, 0xF0, 0x1E, 0x00, 0x78, 0x3C, 0x00,
+  0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0x60, 0x00, 0x06, 0x40, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xFF, 0x1E,
+  0x07, 0xFF, 0xFF, 0xE0, 0x7E, 0x03, 0xFE, 0x07, 0xC0, 0x07, 0xE0, 0x7C,
+  0x00, 0x1F, 0x07, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xE3, 0xE0, 0x00,
+  0xFF, 0x9E, 0x00, 0x0F, 0x3C, 0xF0, 0x00, 0xF1, 0xEF, 0x00, 0x0F, 0x07,
+  0xF8, 0x00, 0x78, 0x3F, 0xC0, 0x07, 0x81, 0xFE, 0x00, 0x78, 0x0F, 0xF0,
+  0x07, 0x80, 0x7F, 0x80, 0x78, 0x03, 0xFC, 0x07, 0x80, 0x1F, 0xE0, 0x78,
+  0x00, 0xFF, 0x07, 0x80, 0x07, 0xF8, 0x3C, 0x00, 0x7D, 0xE3, 0xC0, 0x03,
+  0xCF, 0x3C, 0x00, 0x1E, 0x7F, 0xC0, 0x01, 0xF3, 0xFC, 0x00, 0x0F, 0x0F,
+  0xC0, 0x00, 0xF8, 0x7E, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0xF8, 0x1F, 0xF0,
+  0x1F, 0x81, 0xFF, 0xFF, 0xF8, 0x0E, 0x3F, 0xFF, 0x00, 0xE0, 0x3F, 0xC0,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1E, 0x78,
+  0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F,
+  0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
+  0x00, 0x1E, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F,
+  0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE7, 0x00, 0x01,
+  0xC3, 0x80, 0x03, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF8, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E,
+  0x00, 0x7C, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01,
+  0xFF, 0x00, 0x03, 0xC3, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0xC3, 0xC0, 0x03,
+  0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
+  0x00, 0x1E, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F,
+  0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0xF0,
+  0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x07, 0xC1, 0xF0, 0x03, 0xE0,
+  0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x01, 0xF0, 0x3E, 0x00, 0x3E, 0x1F,
+  0x00, 0x0F, 0x87, 0xC0, 0x01, 0xF3, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
+  0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F,
+  0x00, 0xFC, 0xF0, 0x03, 0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
+  0xFF, 0x00, 0x1E, 0xF0, 0x03, 0xEF, 0x00, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xF0, 0xFF, 0xFC, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xC0, 0xFC, 0x3F, 0x07, 0x80, 0x78, 0x7C, 0x03, 0xC3, 0xC0,
+  0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x1F, 0xC7, 0x81, 0xFE, 0x3C, 0x1F, 0x01,
+  0xE0, 0xF0, 0x0F, 0x0F, 0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x1E,
+  0x00, 0xF0, 0xF8, 0x07, 0x83, 0xE0, 0x3C, 0x1F, 0x81, 0xE0, 0x7F, 0x0F,
+  0x00, 0xFC, 0x78, 0x03, 0xF3, 0xC0, 0x0F, 0xDE, 0x00, 0x1F, 0xF0, 0x00,
+  0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF9,
+  0x80, 0xFB, 0xCF, 0xFF, 0x9E, 0x7F, 0xF8, 0xF0, 0xFF, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x00, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F,
+  0xFF, 0x03, 0xFF, 0xF8, 0x3C, 0x0F, 0xC2, 0x00, 0x3E, 0x00, 0x01, 0xE0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0xFF,
+  0x1F, 0xFF, 0xF3, 0xFF, 0xFF, 0x7E, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x80,
+  0x7F, 0x7C, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7E, 0x0F, 0x00,
+  0x07, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00,
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+  0x3F, 0xFF, 0x03, 0xFF, 0xF8, 0x3C, 0x0F, 0xC2, 0x00, 0x3E, 0x00, 0x01,
+  0xE0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x3F,
+  0xFF, 0x1F, 0xFF, 0xF3, 0xFF, 0xFF, 0x7E, 0x00, 0xF7, 0x80, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
+  0x80, 0x7F, 0x7C, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7E, 0x0F,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0x9C,
+  0x00, 0x70, 0xE0, 0x07, 0x0E, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x00, 0xFF,
+  0xC0, 0x3F, 0xFF, 0x03, 0xFF, 0xF8, 0x3C, 0x0F, 0xC2, 0x00, 0x3E, 0x00,
+  0x01, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x3F, 0xFF, 0x1F, 0xFF, 0xF3, 0xFF, 0xFF, 0x7E, 0x00, 0xF7, 0x80, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03,
+  0xFF, 0x80, 0x7F, 0x7C, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7E,
+  0x0F, 0x07, 0x83, 0x80, 0xFC, 0x38, 0x0F, 0xE7, 0x81, 0xE7, 0xF0, 0x1C,
+  0x3F, 0x01, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03,
+  0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xC0, 0xFC, 0x20, 0x03, 0xE0, 0x00, 0x1E,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x03, 0xFF,
+  0xF1, 0xFF, 0xFF, 0x3F, 0xFF, 0xF7, 0xE0, 0x0F, 0x78, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF8,
+  0x07, 0xF7, 0xC0, 0xFF, 0x3F, 0xFE, 0xF1, 0xFF, 0xCF, 0x07, 0xE0, 0xF0,
+  0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x83, 0xC0, 0xFC, 0x20, 0x03, 0xE0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x03, 0xFF, 0xF1,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xF7, 0xE0, 0x0F, 0x78, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF8, 0x07,
+  0xF7, 0xC0, 0xFF, 0x3F, 0xFE, 0xF1, 0xFF, 0xCF, 0x07, 0xE0, 0xF0, 0x00,
+  0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFE, 0x00, 0xF0, 0xE0, 0x0E, 0x07, 0x00,
+  0xE0, 0x70, 0x0E, 0x07, 0x00, 0xE0, 0x70, 0x0F, 0x0E, 0x00, 0x7F, 0xE0,
+  0x03, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x03, 0xFF, 0xF8, 0x3C, 0x0F, 0xC2, 0x00, 0x3E, 0x00, 0x01, 0xE0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0x1F,
+  0xFF, 0xF3, 0xFF, 0xFF, 0x7E, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x80, 0x7F,
+  0x7C, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7E, 0x0F, 0x0F, 0xFC,
+  0x00, 0xFC, 0x01, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xFF, 0xE3, 0xFF, 0xF0,
+  0x78, 0x1F, 0xBE, 0x0F, 0xC2, 0x00, 0x3F, 0xE0, 0x1E, 0x00, 0x00, 0xFE,
+  0x00, 0x78, 0x00, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x0E, 0x00,
+  0x00, 0xF0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+  0x78, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00,
+  0xF0, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x7E,
+  0x00, 0x01, 0xE0, 0x07, 0xF8, 0x00, 0x0F, 0x80, 0x7B, 0xE0, 0x01, 0x3E,
+  0x07, 0x8F, 0xC0, 0x78, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x80, 0xFF,
+  0xFE, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0xFC, 0x3F,
+  0xFF, 0x8F, 0xC0, 0x73, 0xE0, 0x02, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00,
+  0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00,
+  0x01, 0xE0, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x02, 0x3F, 0x01, 0xC3, 0xFF,
+  0xF8, 0x1F, 0xFF, 0x00, 0xFF, 0x80, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0x02, 0x1E, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x01, 0xFC,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0x83,
+  0xF0, 0xF8, 0x03, 0xC3, 0xC0, 0x07, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x21,
+  0xF8, 0x07, 0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x00,
+  0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0E,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0x83, 0xF0, 0xF8,
+  0x03, 0xC3, 0xC0, 0x07, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x80,
+  0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x21, 0xF8, 0x07,
+  0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x78, 0x00,
+  0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7B, 0x80, 0x03, 0xCF, 0x00, 0x0E,
+  0x1C, 0x00, 0x70, 0x38, 0x03, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0x83, 0xF0, 0xF8, 0x03, 0xC3,
+  0xC0, 0x07, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x21, 0xF8, 0x07, 0x83, 0xFF,
+  0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xC3, 0xC0, 0x0F, 0x0F,
+  0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xFF,
+  0xFE, 0x07, 0xE0, 0xFC, 0x3E, 0x00, 0xF0, 0xF0, 0x01, 0xE7, 0x80, 0x07,
+  0x9E, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3E, 0x00, 0x08, 0x7E, 0x01, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00,
+  0xFF, 0xE0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0E, 0x01, 0xC0, 0x38, 0x0F,
+  0x00, 0x00, 0x00, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x07, 0xC1, 0xE0,
+  0xF0, 0x78, 0x1C, 0x0E, 0x07, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x81, 0xE0,
+  0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x00, 0x07, 0x80, 0x3F, 0x00, 0xFC, 0x07, 0x38, 0x3C,
+  0xF0, 0xE1, 0xC7, 0x03, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00,
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0,
+  0x07, 0x80, 0x1E, 0x00, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x81, 0x80,
+  0x3F, 0x3F, 0x00, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFB,
+  0xE0, 0x0F, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0xFC,
+  0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x7E, 0x07, 0xC3, 0xE0, 0x0F, 0x9F,
+  0x00, 0x1E, 0x78, 0x00, 0x7B, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3D, 0xE0, 0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3E,
+  0x01, 0xF0, 0x7C, 0x0F, 0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xFE,
+  0x00, 0x07, 0x83, 0x80, 0xFC, 0x38, 0x0F, 0xE7, 0x81, 0xE7, 0xF0, 0x1C,
+  0x3F, 0x01, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
+  0x3F, 0xF8, 0xF7, 0xFF, 0xCF, 0xF0, 0x7E, 0xFC, 0x03, 0xEF, 0xC0, 0x1E,
+  0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF0,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xF8, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0x07, 0xE0,
+  0xF8, 0x07, 0xC7, 0xC0, 0x0F, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x7B, 0xC0,
+  0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xF7,
+  0x80, 0x07, 0x9E, 0x00, 0x1E, 0x7C, 0x00, 0xF8, 0xF8, 0x07, 0xC1, 0xF8,
+  0x3E, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x07,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0x07, 0xE0, 0xF8, 0x07,
+  0xC7, 0xC0, 0x0F, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x7B, 0xC0, 0x01, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xF7, 0x80, 0x07,
+  0x9E, 0x00, 0x1E, 0x7C, 0x00, 0xF8, 0xF8, 0x07, 0xC1, 0xF8, 0x3E, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xCE, 0x00, 0x0E, 0x1C,
+  0x00, 0x38, 0x70, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+  0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0x07, 0xE0, 0xF8, 0x07, 0xC7, 0xC0,
+  0x0F, 0x9E, 0x00, 0x1E, 0x78, 0x00, 0x7B, 0xC0, 0x01, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xF7, 0x80, 0x07, 0x9E, 0x00,
+  0x1E, 0x7C, 0x00, 0xF8, 0xF8, 0x07, 0xC1, 0xF8, 0x3E, 0x03, 0xFF, 0xF0,
+  0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x03, 0xC1, 0xC0, 0x1F, 0x87, 0x00,
+  0x7F, 0x3C, 0x03, 0xCF, 0xE0, 0x0E, 0x1F, 0x80, 0x38, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC,
+  0x07, 0xC1, 0xF8, 0x3E, 0x01, 0xF1, 0xF0, 0x03, 0xE7, 0x80, 0x07, 0x9E,
+  0x00, 0x1E, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x7D, 0xE0, 0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3E,
+  0x01, 0xF0, 0x7E, 0x0F, 0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xFE,
+  0x00, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0x78, 0x01, 0xE1, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xC1, 0xF8, 0x3E, 0x01,
+  0xF1, 0xF0, 0x03, 0xE7, 0x80, 0x07, 0x9E, 0x00, 0x1E, 0xF0, 0x00, 0x7F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7D, 0xE0, 0x01,
+  0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E, 0x3E, 0x01, 0xF0, 0x7E, 0x0F, 0x80,
+  0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0xFF, 0x0F, 0x03, 0xFF, 0xDE, 0x07, 0xFF,
+  0xFC, 0x0F, 0x81, 0xF8, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0xFC, 0x3C, 0x01,
+  0xFC, 0x3C, 0x03, 0xFC, 0x7C, 0x07, 0x9E, 0x78, 0x07, 0x1E, 0x78, 0x0E,
+  0x1E, 0x78, 0x1E, 0x1E, 0x78, 0x3C, 0x1E, 0x78, 0x78, 0x1E, 0x78, 0x70,
+  0x1E, 0x78, 0xE0, 0x1E, 0x79, 0xC0, 0x3E, 0x3F, 0xC0, 0x3C, 0x3F, 0x80,
+  0x3C, 0x3F, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x1F, 0x81, 0xF0, 0x3F, 0xFF,
+  0xE0, 0x7B, 0xFF, 0xC0, 0x70, 0xFF, 0x00, 0x60, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xC0, 0x00, 0x0E,
+  0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0x78, 0x01, 0xF7, 0x80,
+  0x3F, 0x7E, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7F, 0x0F, 0x00,
+  0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00,
+  0x07, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0x78, 0x01, 0xF7,
+  0x80, 0x3F, 0x7E, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7F, 0x0F,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0x9C,
+  0x00, 0x70, 0xE0, 0x07, 0x0E, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0x78, 0x01,
+  0xF7, 0x80, 0x3F, 0x7E, 0x0F, 0xF3, 0xFF, 0xEF, 0x1F, 0xFC, 0xF0, 0x7F,
+  0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xF7, 0x80, 0x1F, 0x78,
+  0x03, 0xF7, 0xE0, 0xFF, 0x3F, 0xFE, 0xF1, 0xFF, 0xCF, 0x07, 0xF0, 0xF0,
+  0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFB, 0xC0, 0x01, 0xE7, 0x80,
+  0x03, 0xCF, 0x80, 0x0F, 0x8F, 0x00, 0x1E, 0x1F, 0x00, 0x7C, 0x1E, 0x00,
+  0xF0, 0x3C, 0x01, 0xE0, 0x7C, 0x07, 0xC0, 0x78, 0x0F, 0x00, 0xF8, 0x1E,
+  0x00, 0xF0, 0x78, 0x01, 0xE0, 0xF0, 0x03, 0xE3, 0xE0, 0x03, 0xC7, 0x80,
+  0x07, 0xCF, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0x78, 0x00, 0x1F, 0xF0, 0x00,
+  0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80,
+  0x00, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0xFC, 0x07, 0x9F, 0xF8, 0x3D, 0xFF, 0xF1, 0xFE, 0x0F, 0x8F,
+  0xE0, 0x3E, 0x7E, 0x00, 0xFB, 0xE0, 0x03, 0xDF, 0x00, 0x1E, 0xF0, 0x00,
+  0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8,
+  0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x07,
+  0xBE, 0x00, 0x3D, 0xF8, 0x03, 0xEF, 0xE0, 0x3E, 0x7F, 0x83, 0xE3, 0xDF,
+  0xFF, 0x1E, 0x7F, 0xE0, 0xF0, 0xFE, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x07, 0x8F,
+  0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x7D,
+  0xE0, 0x00, 0xF3, 0xC0, 0x01, 0xE7, 0xC0, 0x07, 0xC7, 0x80, 0x0F, 0x0F,
+  0x80, 0x3E, 0x0F, 0x00, 0x78, 0x1E, 0x00, 0xF0, 0x3E, 0x03, 0xE0, 0x3C,
+  0x07, 0x80, 0x7C, 0x0F, 0x00, 0x78, 0x3C, 0x00, 0xF0, 0x78, 0x01, 0xF1,
+  0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xE7, 0x80, 0x03, 0xDE, 0x00, 0x07, 0xBC,
+  0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x1F,
+  0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7E, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
+  {     1,   4,  31,  17,    6,  -30 },   // 0x21 '!'
+  {    17,  12,  12,  20,    4,  -30 },   // 0x22 '"'
+  {    35,  29,  31,  36,    3,  -30 },   // 0x23 '#'
+  {   148,  20,  39,  27,    3,  -32 },   // 0x24 '$'
+  {   246,  36,  32,  41,    2,  -31 },   // 0x25 '%'
+  {   390,  30,  32,  34,    2,  -31 },   // 0x26 '&'
+  {   510,   4,  12,  12,    4,  -30 },   // 0x27 '''
+  {   516,  10,  38,  17,    4,  -32 },   // 0x28 '('
+  {   564,  10,  38,  17,    3,  -32 },   // 0x29 ')'
+  {   612,  18,  20,  22,    2,  -31 },   // 0x2A '*'
+  {   657,  27,  27,  36,    5,  -26 },   // 0x2B '+'
+  {   749,   6,  10,  14,    3,   -4 },   // 0x2C ','
+  {   757,  11,   3,  16,    2,  -12 },   // 0x2D '-'
+  {   762,   4,   5,  14,    5,   -4 },   // 0x2E '.'
+  {   765,  14,  35,  14,    0,  -30 },   // 0x2F '/'
+  {   827,  22,  32,  27,    3,  -31 },   // 0x30 '0'
+  {   915,  19,  31,  27,    4,  -30 },   // 0x31 '1'
+  {   989,  20,  32,  27,    3,  -31 },   // 0x32 '2'
+  {  1069,  21,  32,  27,    3,  -31 },   // 0x33 '3'
+  {  1153,  22,  31,  27,    2,  -30 },   // 0x34 '4'
+  {  1239,  20,  31,  27,    3,  -30 },   // 0x35 '5'
+  {  1317,  22,  32,  27,    3,  -31 },   // 0x36 '6'
+  {  1405,  20,  31,  27,    3,  -30 },   // 0x37 '7'
+  {  1483,  22,  32,  27,    3,  -31 },   // 0x38 '8'
+  {  1571,  22,  32,  27,    3,  -31 },   // 0x39 '9'
+  {  1659,   4,  22,  14,    5,  -21 },   // 0x3A ':'
+  {  1670,   6,  27,  14,    3,  -21 },   // 0x3B ';'
+  {  1691,  27,  23,  36,    5,  -24 },   // 0x3C '<'
+  {  1769,  27,  11,  36,    5,  -18 },   // 0x3D '='
+  {  1807,  27,  23,  36,    5,  -24 },   // 0x3E '>'
+  {  1885,  17,  32,  23,    3,  -31 },   // 0x3F '?'
+  {  1953,  38,  38,  43,    3,  -29 },   // 0x40 '@'
+  {  2134,  29,  31,  29,    0,  -30 },   // 0x41 'A'
+  {  2247,  22,  31,  30,    4,  -30 },   // 0x42 'B'
+  {  2333,  25,  32,  30,    2,  -31 },   // 0x43 'C'
+  {  2433,  26,  31,  33,    4,  -30 },   // 0x44 'D'
+  {  2534,  20,  31,  27,    4,  -30 },   // 0x45 'E'
+  {  2612,  18,  31,  25,    4,  -30 },   // 0x46 'F'
+  {  2682,  27,  32,  33,    2,  -31 },   // 0x47 'G'
+  {  2790,  24,  31,  32,    4,  -30 },   // 0x48 'H'
+  {  2883,   4,  31,  13,    4,  -30 },   // 0x49 'I'
+  {  2899,  10,  40,  13,   -2,  -30 },   // 0x4A 'J'
+  {  2949,  25,  31,  28,    4,  -30 },   // 0x4B 'K'
+  {  3046,  20,  31,  24,    4,  -30 },   // 0x4C 'L'
+  {  3124,  29,  31,  37,    4,  -30 },   // 0x4D 'M'
+  {  3237,  24,  31,  32,    4,  -30 },   // 0x4E 'N'
+  {  3330,  29,  32,  34,    2,  -31 },   // 0x4F 'O'
+  {  3446,  20,  31,  26,    4,  -30 },   // 0x50 'P'
+  {  3524,  29,  38,  34,    2,  -31 },   // 0x51 'Q'
+  {  3662,  24,  31,  30,    4,  -30 },   // 0x52 'R'
+  {  3755,  22,  32,  27,    3,  -31 },   // 0x53 'S'
+  {  3843,  26,  31,  26,    0,  -30 },   // 0x54 'T'
+  {  3944,  24,  31,  31,    4,  -30 },   // 0x55 'U'
+  {  4037,  29,  31,  29,    0,  -30 },   // 0x56 'V'
+  {  4150,  40,  31,  43,    1,  -30 },   // 0x57 'W'
+  {  4305,  27,  31,  29,    1,  -30 },   // 0x58 'X'
+  {  4410,  26,  31,  26,    0,  -30 },   // 0x59 'Y'
+  {  4511,  26,  31,  29,    2,  -30 },   // 0x5A 'Z'
+  {  4612,   9,  38,  17,    4,  -32 },   // 0x5B '['
+  {  4655,  14,  35,  14,    0,  -30 },   // 0x5C '\'
+  {  4717,   9,  38,  17,    4,  -32 },   // 0x5D ']'
+  {  4760,  27,  12,  36,    5,  -30 },   // 0x5E '^'
+  {  4801,  22,   3,  22,    0,    8 },   // 0x5F '_'
+  {  4810,  10,   8,  22,    4,  -33 },   // 0x60 '`'
+  {  4820,  20,  25,  26,    2,  -24 },   // 0x61 'a'
+  {  4883,  21,  33,  27,    4,  -32 },   // 0x62 'b'
+  {  4970,  19,  25,  24,    2,  -24 },   // 0x63 'c'
+  {  5030,  21,  33,  27,    2,  -32 },   // 0x64 'd'
+  {  5117,  22,  25,  26,    2,  -24 },   // 0x65 'e'
+  {  5186,  15,  33,  15,    1,  -32 },   // 0x66 'f'
+  {  5248,  21,  34,  27,    2,  -24 },   // 0x67 'g'
+  {  5338,  20,  33,  27,    4,  -32 },   // 0x68 'h'
+  {  5421,   4,  33,  12,    4,  -32 },   // 0x69 'i'
+  {  5438,   9,  42,  12,   -1,  -32 },   // 0x6A 'j'
+  {  5486,  21,  33,  25,    4,  -32 },   // 0x6B 'k'
+  {  5573,   4,  33,  12,    4,  -32 },   // 0x6C 'l'
+  {  5590,  34,  25,  42,    4,  -24 },   // 0x6D 'm'
+  {  5697,  20,  25,  27,    4,  -24 },   // 0x6E 'n'
+  {  5760,  22,  25,  26,    2,  -24 },   // 0x6F 'o'
+  {  5829,  21,  34,  27,    4,  -24 },   // 0x70 'p'
+  {  5919,  21,  34,  27,    2,  -24 },   // 0x71 'q'
+  {  6009,  14,  25,  18,    4,  -24 },   // 0x72 'r'
+  {  6053,  18,  25,  22,    2,  -24 },   // 0x73 's'
+  {  6110,  15,  31,  17,    1,  -30 },   // 0x74 't'
+  {  6169,  20,  25,  27,    4,  -24 },   // 0x75 'u'
+  {  6232,  23,  24,  25,    1,  -23 },   // 0x76 'v'
+  {  6301,  32,  24,  35,    2,  -23 },   // 0x77 'w'
+  {  6397,  23,  24,  25,    1,  -23 },   // 0x78 'x'
+  {  6466,  23,  33,  25,    1,  -23 },   // 0x79 'y'
+  {  6561,  19,  24,  23,    2,  -23 },   // 0x7A 'z'
+  {  6618,  17,  40,  27,    5,  -32 },   // 0x7B '{'
+  {  6703,   4,  43,  14,    5,  -32 },   // 0x7C '|'
+  {  6725,  17,  40,  27,    6,  -32 },   // 0x7D '}'
+  {  6810,  27,   7,  36,    5,  -16 },   // 0x7E '~'
+  {  6834,  22,  38,  26,    2,  -29 },   // 0x7F
+  {  6939,  22,  38,  26,    2,  -29 },   // 0x80
+  {  7044,  22,  38,  26,    2,  -29 },   // 0x81
+  {  7149,  22,  38,  26,    2,  -29 },   // 0x82
+  {  7254,  22,  38,  26,    2,  -29 },   // 0x83
+  {  7359,  22,  38,  26,    2,  -29 },   // 0x84
+  {  7464,  22,  38,  26,    2,  -29 },   // 0x85
+  {  7569,  22,  38,  26,    2,  -29 },   // 0x86
+  {  7674,  22,  38,  26,    2,  -29 },   // 0x87
+  {  7779,  22,  38,  26,    2,  -29 },   // 0x88
+  {  7884,  22,  38,  26,    2,  -29 },   // 0x89
+  {  7989,  22,  38,  26,    2,  -29 },   // 0x8A
+  {  8094,  22,  38,  26,    2,  -29 },   // 0x8B
+  {  8199,  22,  38,  26,    2,  -29 },   // 0x8C
+  {  8304,  22,  38,  26,    2,  -29 },   // 0x8D
+  {  8409,  22,  38,  26,    2,  -29 },   // 0x8E
+  {  8514,  22,  38,  26,    2,  -29 },   // 0x8F
+  {  8619,  22,  38,  26,    2,  -29 },   // 0x90
+  {  8724,  22,  38,  26,    2,  -29 },   // 0x91
+  {  8829,  22,  38,  26,    2,  -29 },   // 0x92
+  {  8934,  22,  38,  26,    2,  -29 },   // 0x93
+  {  9039,  22,  38,  26,    2,  -29 },   // 0x94
+  {  9144,  22,  38,  26,    2,  -29 },   // 0x95
+  {  9249,  22,  38,  26,    2,  -29 },   // 0x96
+  {  9354,  22,  38,  26,    2,  -29 },   // 0x97
+  {  9459,  22,  38,  26,    2,  -29 },   // 0x98
+  {  9564,  22,  38,  26,    2,  -29 },   // 0x99
+  {  9669,  22,  38,  26,    2,  -29 },   // 0x9A
+  {  9774,  22,  38,  26,    2,  -29 },   // 0x9B
+  {  9879,  22,  38,  26,    2,  -29 },   // 0x9C
+  {  9984,  22,  38,  26,    2,  -29 },   // 0x9D
+  { 10089,  22,  38,  26,    2,  -29 },   // 0x9E
+  { 10194,  22,  38,  26,    2,  -29 },   // 0x9F
+  { 10299,   1,   1,  14,    0,    0 },   // 0xA0
+  { 10300,   4,  31,  17,    6,  -23 },   // 0xA1
+  { 10316,  19,  37,  27,    4,  -30 },   // 0xA2
+  { 10404,  21,  32,  27,    3,  -31 },   // 0xA3
+  { 10488,  24,  24,  27,    2,  -24 },   // 0xA4
+  { 10560,  24,  31,  27,    2,  -30 },   // 0xA5
+  { 10653,   4,  38,  14,    5,  -29 },   // 0xA6
+  { 10672,  18,  36,  22,    2,  -31 },   // 0xA7
+  { 10753,  12,   4,  22,    5,  -32 },   // 0xA8
+  { 10759,  31,  31,  43,    6,  -30 },   // 0xA9
+  { 10880,  15,  21,  20,    2,  -31 },   // 0xAA
+  { 10920,  19,  19,  26,    3,  -21 },   // 0xAB
+  { 10966,  27,  12,  36,    5,  -17 },   // 0xAC
+  { 11007,  11,   3,  16,    2,  -12 },   // 0xAD
+  { 11012,  31,  31,  43,    6,  -30 },   // 0xAE
+  { 11133,  13,   3,  22,    4,  -31 },   // 0xAF
+  { 11138,  13,  13,  22,    4,  -31 },   // 0xB0
+  { 11160,  27,  27,  36,    4,  -26 },   // 0xB1
+  { 11252,  12,  18,  17,    2,  -31 },   // 0xB2
+  { 11279,  13,  18,  17,    2,  -31 },   // 0xB3
+  { 11309,  10,   8,  22,    8,  -33 },   // 0xB4
+  { 11319,  23,  33,  27,    4,  -23 },   // 0xB5
+  { 11414,  19,  35,  27,    3,  -30 },   // 0xB6
+  { 11498,   4,   5,  14,    5,  -17 },   // 0xB7
+  { 11501,   9,   8,  22,    6,    1 },   // 0xB8
+  { 11510,  11,  18,  17,    3,  -31 },   // 0xB9
+  { 11535,  16,  21,  20,    2,  -31 },   // 0xBA
+  { 11577,  19,  19,  26,    4,  -21 },   // 0xBB
+  { 11623,  37,  32,  42,    3,  -31 },   // 0xBC
+  { 11771,  35,  32,  42,    3,  -31 },   // 0xBD
+  { 11911,  38,  32,  42,    2,  -31 },   // 0xBE
+  { 12063,  17,  33,  23,    3,  -23 },   // 0xBF
+  { 12134,  29,  41,  29,    0,  -40 },   // 0xC0
+  { 12283,  29,  41,  29,    0,  -40 },   // 0xC1
+  { 12432,  29,  41,  29,    0,  -40 },   // 0xC2
+  { 12581,  29,  40,  29,    0,  -39 },   // 0xC3
+  { 12726,  29,  39,  29,    0,  -38 },   // 0xC4
+  { 12868,  29,  40,  29,    0,  -39 },   // 0xC5
+  { 13013,  39,  31,  42,    0,  -30 },   // 0xC6
+  { 13165,  25,  40,  30,    2,  -31 },   // 0xC7
+  { 13290,  20,  41,  27,    4,  -40 },   // 0xC8
+  { 13393,  20,  41,  27,    4,  -40 },   // 0xC9
+  { 13496,  20,  41,  27,    4,  -40 },   // 0xCA
+  { 13599,  20,  39,  27,    4,  -38 },   // 0xCB
+  { 13697,   8,  41,  13,    1,  -40 },   // 0xCC
+  { 13738,   8,  41,  13,    3,  -40 },   // 0xCD
+  { 13779,  14,  41,  13,   -1,  -40 },   // 0xCE
+  { 13851,  12,  39,  13,    0,  -38 },   // 0xCF
+  { 13910,  30,  31,  33,    0,  -30 },   // 0xD0
+  { 14027,  24,  40,  32,    4,  -39 },   // 0xD1
+  { 14147,  29,  41,  34,    2,  -40 },   // 0xD2
+  { 14296,  29,  41,  34,    2,  -40 },   // 0xD3
+  { 14445,  29,  41,  34,    2,  -40 },   // 0xD4
+  { 14594,  29,  40,  34,    2,  -39 },   // 0xD5
+  { 14739,  29,  39,  34,    2,  -38 },   // 0xD6
+  { 14881,  24,  24,  36,    6,  -25 },   // 0xD7
+  { 14953,  29,  34,  34,    2,  -32 },   // 0xD8
+  { 15077,  24,  41,  31,    4,  -40 },   // 0xD9
+  { 15200,  24,  41,  31,    4,  -40 },   // 0xDA
+  { 15323,  24,  41,  31,    4,  -40 },   // 0xDB
+  { 15446,  24,  39,  31,    4,  -38 },   // 0xDC
+  { 15563,  26,  41,  26,    0,  -40 },   // 0xDD
+  { 15697,  20,  31,  26,    4,  -30 },   // 0xDE
+  { 15775,  21,  33,  27,    4,  -32 },   // 0xDF
+  { 15862,  20,  34,  26,    2,  -33 },   // 0xE0
+  { 15947,  20,  34,  26,    2,  -33 },   // 0xE1
+  { 16032,  20,  34,  26,    2,  -33 },   // 0xE2
+  { 16117,  20,  33,  26,    2,  -32 },   // 0xE3
+  { 16200,  20,  33,  26,    2,  -32 },   // 0xE4
+  { 16283,  20,  38,  26,    2,  -37 },   // 0xE5
+  { 16378,  37,  25,  42,    2,  -24 },   // 0xE6
+  { 16494,  19,  33,  24,    2,  -24 },   // 0xE7
+  { 16573,  22,  34,  26,    2,  -33 },   // 0xE8
+  { 16667,  22,  34,  26,    2,  -33 },   // 0xE9
+  { 16761,  22,  34,  26,    2,  -33 },   // 0xEA
+  { 16855,  22,  33,  26,    2,  -32 },   // 0xEB
+  { 16946,  10,  34,  12,   -1,  -33 },   // 0xEC
+  { 16989,  10,  34,  12,    3,  -33 },   // 0xED
+  { 17032,  14,  34,  12,   -1,  -33 },   // 0xEE
+  { 17092,  12,  33,  12,    0,  -32 },   // 0xEF
+  { 17142,  22,  33,  26,    2,  -32 },   // 0xF0
+  { 17233,  20,  33,  27,    4,  -32 },   // 0xF1
+  { 17316,  22,  34,  26,    2,  -33 },   // 0xF2
+  { 17410,  22,  34,  26,    2,  -33 },   // 0xF3
+  { 17504,  22,  34,  26,    2,  -33 },   // 0xF4
+  { 17598,  22,  33,  26,    2,  -32 },   // 0xF5
+  { 17689,  22,  33,  26,    2,  -32 },   // 0xF6
+  { 17780,  27,  19,  36,    5,  -22 },   // 0xF7
+  { 17845,  24,  27,  26,    1,  -25 },   // 0xF8
+  { 17926,  20,  34,  27,    4,  -33 },   // 0xF9
+  { 18011,  20,  34,  27,    4,  -33 },   // 0xFA
+  { 18096,  20,  34,  27,    4,  -33 },   // 0xFB
+  { 18181,  20,  33,  27,    4,  -32 },   // 0xFC
+  { 18264,  23,  43,  25,    1,  -33 },   // 0xFD
+  { 18388,  21,  42,  27,    4,  -32 },   // 0xFE
+  { 18499,  23,  42,  25,    1,  -32 } }; // 0xFF
+
+const GFXfont DejaVuSans22pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans22pt8bBitmaps,
+  (GFXglyph *)DejaVuSans22pt8bGlyphs,
+  0x20, 0xFF, 50 };
+
+// Approx. 20195 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans22pt8bMetrics[] PROGMEM = {
+  {   0,  14,   1 },   // 0x20
+  {   6,  17,  10 },   // 0x21
+  {   4,  20,  16 },   // 0x22
+  {   3,  36,  32 },   // 0x23
+  {   3,  27,  23 },   // 0x24
+  {   2,  41,  38 },   // 0x25
+  {   2,  34,  32 },   // 0x26
+  {   4,  12,   8 },   // 0x27
+  {   4,  17,  14 },   // 0x28
+  {   3,  17,  13 },   // 0x29
+  {   2,  22,  20 },   // 0x2A
+  {   5,  36,  32 },   // 0x2B
+  {   3,  14,   9 },   // 0x2C
+  {   2,  16,  13 },   // 0x2D
+  {   5,  14,   9 },   // 0x2E
+  {   0,  14,  14 },   // 0x2F
+  {   3,  27,  25 },   // 0x30
+  {   4,  27,  23 },   // 0x31
+  {   3,  27,  23 },   // 0x32
+  {   3,  27,  24 },   // 0x33
+  {   2,  27,  24 },   // 0x34
+  {   3,  27,  23 },   // 0x35
+  {   3,  27,  25 },   // 0x36
+  {   3,  27,  23 },   // 0x37
+  {   3,  27,  25 },   // 0x38
+  {   3,  27,  25 },   // 0x39
+  {   5,  14,   9 },   // 0x3A
+  {   3,  14,   9 },   // 0x3B
+  {   5,  36,  32 },   // 0x3C
+  {   5,  36,  32 },   // 0x3D
+  {   5,  36,  32 },   // 0x3E
+  {   3,  23,  20 },   // 0x3F
+  {   3,  43,  41 },   // 0x40
+  {   0,  29,  29 },   // 0x41
+  {   4,  30,  26 },   // 0x42
+  {   2,  30,  27 },   // 0x43
+  {   4,  33,  30 },   // 0x44
+  {   4,  27,  24 },   // 0x45
+  {   4,  25,  22 },   // 0x46
+  {   2,  33,  29 },   // 0x47
+  {   4,  32,  28 },   // 0x48
+  {   4,  13,   8 },   // 0x49
+  {  -2,  13,   8 },   // 0x4A
+  {   4,  28,  29 },   // 0x4B
+  {   4,  24,  24 },   // 0x4C
+  {   4,  37,  33 },   // 0x4D
+  {   4,  32,  28 },   // 0x4E
+  {   2,  34,  31 },   // 0x4F
+  {   4,  26,  24 },   // 0x50
+  {   2,  34,  31 },   // 0x51
+  {   4,  30,  28 },   // 0x52
+  {   3,  27,  25 },   // 0x53
+  {   0,  26,  26 },   // 0x54
+  {   4,  31,  28 },   // 0x55
+  {   0,  29,  29 },   // 0x56
+  {   1,  43,  41 },   // 0x57
+  {   1,  29,  28 },   // 0x58
+  {   0,  26,  26 },   // 0x59
+  {   2,  29,  28 },   // 0x5A
+  {   4,  17,  13 },   // 0x5B
+  {   0,  14,  14 },   // 0x5C
+  {   4,  17,  13 },   // 0x5D
+  {   5,  36,  32 },   // 0x5E
+  {   0,  22,  22 },   // 0x5F
+  {   4,  22,  14 },   // 0x60
+  {   2,  26,  22 },   // 0x61
+  {   4,  27,  25 },   // 0x62
+  {   2,  24,  21 },   // 0x63
+  {   2,  27,  23 },   // 0x64
+  {   2,  26,  24 },   // 0x65
+  {   1,  15,  16 },   // 0x66
+  {   2,  27,  23 },   // 0x67
+  {   4,  27,  24 },   // 0x68
+  {   4,  12,   8 },   // 0x69
+  {  -1,  12,   8 },   // 0x6A
+  {   4,  25,  25 },   // 0x6B
+  {   4,  12,   8 },   // 0x6C
+  {   4,  42,  38 },   // 0x6D
+  {   4,  27,  24 },   // 0x6E
+  {   2,  26,  24 },   // 0x6F
+  {   4,  27,  25 },   // 0x70
+  {   2,  27,  23 },   // 0x71
+  {   4,  18,  18 },   // 0x72
+  {   2,  22,  20 },   // 0x73
+  {   1,  17,  16 },   // 0x74
+  {   4,  27,  24 },   // 0x75
+  {   1,  25,  24 },   // 0x76
+  {   2,  35,  34 },   // 0x77
+  {   1,  25,  24 },   // 0x78
+  {   1,  25,  24 },   // 0x79
+  {   2,  23,  21 },   // 0x7A
+  {   5,  27,  22 },   // 0x7B
+  {   5,  14,   9 },   // 0x7C
+  {   6,  27,  23 },   // 0x7D
+  {   5,  36,  32 },   // 0x7E
+  {   2,  26,  24 },   // 0x7F
+  {   2,  26,  24 },   // 0x80
+  {   2,  26,  24 },   // 0x81
+  {   2,  26,  24 },   // 0x82
+  {   2,  26,  24 },   // 0x83
+  {   2,  26,  24 },   // 0x84
+  {   2,  26,  24 },   // 0x85
+  {   2,  26,  24 },   // 0x86
+  {   2,  26,  24 },   // 0x87
+  {   2,  26,  24 },   // 0x88
+  {   2,  26,  24 },   // 0x89
+  {   2,  26,  24 },   // 0x8A
+  {   2,  26,  24 },   // 0x8B
+  {   2,  26,  24 },   // 0x8C
+  {   2,  26,  24 },   // 0x8D
+  {   2,  26,  24 },   // 0x8E
+  {   2,  26,  24 },   // 0x8F
+  {   2,  26,  24 },   // 0x90
+  {   2,  26,  24 },   // 0x91
+  {   2,  26,  24 },   // 0x92
+  {   2,  26,  24 },   // 0x93
+  {   2,  26,  24 },   // 0x94
+  {   2,  26,  24 },   // 0x95
+  {   2,  26,  24 },   // 0x96
+  {   2,  26,  24 },   // 0x97
+  {   2,  26,  24 },   // 0x98
+  {   2,  26,  24 },   // 0x99
+  {   2,  26,  24 },   // 0x9A
+  {   2,  26,  24 },   // 0x9B
+  {   2,  26,  24 },   // 0x9C
+  {   2,  26,  24 },   // 0x9D
+  {   2,  26,  24 },   // 0x9E
+  {   2,  26,  24 },   // 0x9F
+  {   0,  14,   1 },   // 0xA0
+  {   6,  17,  10 },   // 0xA1
+  {   4,  27,  23 },   // 0xA2
+  {   3,  27,  24 },   // 0xA3
+  {   2,  27,  26 },   // 0xA4
+  {   2,  27,  26 },   // 0xA5
+  {   5,  14,   9 },   // 0xA6
+  {   2,  22,  20 },   // 0xA7
+  {   5,  22,  17 },   // 0xA8
+  {   6,  43,  37 },   // 0xA9
+  {   2,  20,  17 },   // 0xAA
+  {   3,  26,  22 },   // 0xAB
+  {   5,  36,  32 },   // 0xAC
+  {   2,  16,  13 },   // 0xAD
+  {   6,  43,  37 },   // 0xAE
+  {   4,  22,  17 },   // 0xAF
+  {   4,  22,  17 },   // 0xB0
+  {   4,  36,  31 },   // 0xB1
+  {   2,  17,  14 },   // 0xB2
+  {   2,  17,  15 },   // 0xB3
+  {   8,  22,  18 },   // 0xB4
+  {   4,  27,  27 },   // 0xB5
+  {   3,  27,  22 },   // 0xB6
+  {   5,  14,   9 },   // 0xB7
+  {   6,  22,  15 },   // 0xB8
+  {   3,  17,  14 },   // 0xB9
+  {   2,  20,  18 },   // 0xBA
+  {   4,  26,  23 },   // 0xBB
+  {   3,  42,  40 },   // 0xBC
+  {   3,  42,  38 },   // 0xBD
+  {   2,  42,  40 },   // 0xBE
+  {   3,  23,  20 },   // 0xBF
+  {   0,  29,  29 },   // 0xC0
+  {   0,  29,  29 },   // 0xC1
+  {   0,  29,  29 },   // 0xC2
+  {   0,  29,  29 },   // 0xC3
+  {   0,  29,  29 },   // 0xC4
+  {   0,  29,  29 },   // 0xC5
+  {   0,  42,  39 },   // 0xC6
+  {   2,  30,  27 },   // 0xC7
+  {   4,  27,  24 },   // 0xC8
+  {   4,  27,  24 },   // 0xC9
+  {   4,  27,  24 },   // 0xCA
+  {   4,  27,  24 },   // 0xCB
+  {   1,  13,   9 },   // 0xCC
+  {   3,  13,  11 },   // 0xCD
+  {  -1,  13,  13 },   // 0xCE
+  {   0,  13,  12 },   // 0xCF
+  {   0,  33,  30 },   // 0xD0
+  {   4,  32,  28 },   // 0xD1
+  {   2,  34,  31 },   // 0xD2
+  {   2,  34,  31 },   // 0xD3
+  {   2,  34,  31 },   // 0xD4
+  {   2,  34,  31 },   // 0xD5
+  {   2,  34,  31 },   // 0xD6
+  {   6,  36,  30 },   // 0xD7
+  {   2,  34,  31 },   // 0xD8
+  {   4,  31,  28 },   // 0xD9
+  {   4,  31,  28 },   // 0xDA
+  {   4,  31,  28 },   // 0xDB
+  {   4,  31,  28 },   // 0xDC
+  {   0,  26,  26 },   // 0xDD
+  {   4,  26,  24 },   // 0xDE
+  {   4,  27,  25 },   // 0xDF
+  {   2,  26,  22 },   // 0xE0
+  {   2,  26,  22 },   // 0xE1
+  {   2,  26,  22 },   // 0xE2
+  {   2,  26,  22 },   // 0xE3
+  {   2,  26,  22 },   // 0xE4
+  {   2,  26,  22 },   // 0xE5
+  {   2,  42,  39 },   // 0xE6
+  {   2,  24,  21 },   // 0xE7
+  {   2,  26,  24 },   // 0xE8
+  {   2,  26,  24 },   // 0xE9
+  {   2,  26,  24 },   // 0xEA
+  {   2,  26,  24 },   // 0xEB
+  {  -1,  12,   9 },   // 0xEC
+  {   3,  12,  13 },   // 0xED
+  {  -1,  12,  13 },   // 0xEE
+  {   0,  12,  12 },   // 0xEF
+  {   2,  26,  24 },   // 0xF0
+  {   4,  27,  24 },   // 0xF1
+  {   2,  26,  24 },   // 0xF2
+  {   2,  26,  24 },   // 0xF3
+  {   2,  26,  24 },   // 0xF4
+  {   2,  26,  24 },   // 0xF5
+  {   2,  26,  24 },   // 0xF6
+  {   5,  36,  32 },   // 0xF7
+  {   1,  26,  25 },   // 0xF8
+  {   4,  27,  24 },   // 0xF9
+  {   4,  27,  24 },   // 0xFA
+  {   4,  27,  24 },   // 0xFB
+  {   4,  27,  24 },   // 0xFC
+  {   1,  25,  24 },   // 0xFD
+  {   4,  27,  25 },   // 0xFE
+  {   1,  25,  24 }    // 0xFF
+};
+const FontMetrics DejaVuSans22pt8bWidths = { DejaVuSans22pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS22PTLAT1__H
@@ -0,0 +1,600 @@
+#ifndef DEJAVUSANS6PTLAT1__H
+#define DEJAVUSANS6PTLAT1__H
+const uint8_t DejaVuSans6pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFD, 0x80, 0xB6, 0x80, 0x12, 0x14, 0x7F, 0x24, 0x24, 0xFE, 0x28,
+  0x48, 0x23, 0xAB, 0x4E, 0x1C, 0xB5, 0x71, 0x08, 0x61, 0x24, 0x89, 0x22,
+  0x50, 0x6D, 0x82, 0x91, 0x24, 0x49, 0x21, 0x80, 0x30, 0x48, 0x40, 0x60,
+  0x51, 0x89, 0x86, 0xC4, 0x7B, 0xE0, 0x69, 0x49, 0x24, 0x49, 0x80, 0xC9,
+  0x12, 0x49, 0x4B, 0x00, 0x25, 0x5C, 0xEA, 0x90, 0x10, 0x20, 0x47, 0xF1,
+  0x02, 0x04, 0x00, 0xE0, 0xE0, 0xC0, 0x11, 0x22, 0x24, 0x44, 0x88, 0x79,
+  0x28, 0x61, 0x86, 0x18, 0x52, 0x78, 0xE1, 0x08, 0x42, 0x10, 0x84, 0xF8,
+  0x7A, 0x30, 0x41, 0x08, 0x42, 0x10, 0xFC, 0x7A, 0x10, 0x41, 0x38, 0x10,
+  0x61, 0x78, 0x18, 0x62, 0x92, 0x4A, 0x2F, 0xC2, 0x08, 0xFA, 0x08, 0x3E,
+  0x0C, 0x10, 0x63, 0x78, 0x39, 0x18, 0x2E, 0xCE, 0x18, 0x53, 0x78, 0xFC,
+  0x10, 0x82, 0x10, 0x42, 0x08, 0x40, 0x7A, 0x18, 0x61, 0x7A, 0x18, 0x61,
+  0x78, 0x7B, 0x28, 0x61, 0xCD, 0xD0, 0x62, 0x70, 0xCC, 0xCE, 0x03, 0x1E,
+  0xE0, 0xE0, 0x1E, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x78, 0x07, 0x07, 0x78,
+  0xC0, 0x74, 0x42, 0x22, 0x10, 0x04, 0x20, 0x1F, 0x04, 0x19, 0x01, 0x47,
+  0x99, 0x13, 0x22, 0x64, 0x54, 0x7C, 0x40, 0x04, 0x10, 0x7C, 0x00, 0x18,
+  0x18, 0x24, 0x24, 0x24, 0x42, 0x7E, 0x42, 0x81, 0xFA, 0x18, 0x61, 0xFA,
+  0x18, 0x61, 0xF8, 0x39, 0x18, 0x20, 0x82, 0x08, 0x11, 0x38, 0xF9, 0x0A,
+  0x0C, 0x18, 0x30, 0x60, 0xC2, 0xF8, 0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20,
+  0xFC, 0xFC, 0x21, 0x0F, 0xC2, 0x10, 0x80, 0x3C, 0x86, 0x04, 0x08, 0xF0,
+  0x60, 0xA1, 0x3C, 0x83, 0x06, 0x0C, 0x1F, 0xF0, 0x60, 0xC1, 0x82, 0xFF,
+  0x80, 0x24, 0x92, 0x49, 0x27, 0x00, 0x85, 0x12, 0x45, 0x0C, 0x14, 0x24,
+  0x44, 0x84, 0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, 0x81, 0xC3, 0xC3, 0xA5,
+  0xA5, 0x99, 0x99, 0x81, 0x81, 0xC3, 0x86, 0x8D, 0x19, 0x31, 0x62, 0xC3,
+  0x86, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xA2, 0x38, 0xFA, 0x18, 0x61,
+  0xFA, 0x08, 0x20, 0x80, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xA2, 0x38,
+  0x10, 0x10, 0xF9, 0x0A, 0x14, 0x2F, 0x91, 0x21, 0x42, 0x82, 0x7A, 0x18,
+  0x20, 0x78, 0x10, 0x61, 0x78, 0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08,
+  0x10, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x7C, 0x40, 0x90, 0x22,
+  0x10, 0x84, 0x21, 0x04, 0x81, 0x20, 0x30, 0x0C, 0x00, 0x84, 0x28, 0x89,
+  0x11, 0x25, 0x22, 0xA8, 0x55, 0x0A, 0xA0, 0x88, 0x11, 0x00, 0xC6, 0x88,
+  0xA1, 0x41, 0x05, 0x0A, 0x22, 0x82, 0x82, 0x89, 0x11, 0x42, 0x82, 0x04,
+  0x08, 0x10, 0xFE, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40, 0xFE, 0xEA, 0xAA,
+  0xAC, 0x88, 0x44, 0x42, 0x22, 0x11, 0xD5, 0x55, 0x5C, 0x18, 0x24, 0x42,
+  0xFC, 0x44, 0x7A, 0x10, 0x5F, 0x86, 0x37, 0x40, 0x82, 0x08, 0x3E, 0xCE,
+  0x18, 0x61, 0xCF, 0xE0, 0x76, 0x61, 0x08, 0x65, 0xC0, 0x04, 0x10, 0x5F,
+  0xCE, 0x18, 0x61, 0xCD, 0xF0, 0x7B, 0x38, 0x7F, 0x83, 0x17, 0x80, 0x34,
+  0x4F, 0x44, 0x44, 0x44, 0x7F, 0x38, 0x61, 0x87, 0x37, 0xC1, 0x4C, 0xE0,
+  0x82, 0x08, 0x2E, 0xC6, 0x18, 0x61, 0x86, 0x10, 0xBF, 0x80, 0x45, 0x55,
+  0x57, 0x82, 0x08, 0x22, 0x92, 0x8C, 0x28, 0x92, 0x20, 0xFF, 0xC0, 0xF7,
+  0x44, 0x62, 0x31, 0x18, 0x8C, 0x46, 0x22, 0xBB, 0x18, 0x61, 0x86, 0x18,
+  0x40, 0x7B, 0x38, 0x61, 0x87, 0x37, 0x80, 0xFB, 0x38, 0x61, 0x87, 0x3F,
+  0xA0, 0x82, 0x00, 0x7F, 0x38, 0x61, 0x87, 0x37, 0xC1, 0x04, 0x10, 0xBC,
+  0x88, 0x88, 0x80, 0x74, 0x60, 0xE0, 0xC5, 0xC0, 0x44, 0xF4, 0x44, 0x44,
+  0x70, 0x86, 0x18, 0x61, 0x86, 0x37, 0x40, 0x86, 0x14, 0x92, 0x48, 0xC3,
+  0x00, 0x88, 0xC4, 0x55, 0x4A, 0xA5, 0x51, 0x10, 0x88, 0x85, 0x24, 0x8C,
+  0x49, 0x28, 0x40, 0x86, 0x14, 0x92, 0x28, 0xC1, 0x04, 0x23, 0x00, 0xF8,
+  0x44, 0x44, 0x43, 0xE0, 0x39, 0x08, 0x42, 0x60, 0x84, 0x21, 0x0E, 0xFF,
+  0xF0, 0xE1, 0x08, 0x42, 0x0C, 0x84, 0x21, 0x38, 0x71, 0x8E, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18,
+  0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F,
+  0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18,
+  0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0x00, 0xDF, 0x80, 0x21, 0x1D,
+  0x5A, 0x52, 0x95, 0x71, 0x08, 0x32, 0x50, 0x8F, 0x21, 0x08, 0xF8, 0x82,
+  0xF9, 0x12, 0x24, 0x4F, 0xA0, 0x80, 0x82, 0x88, 0xA3, 0x61, 0x0F, 0x84,
+  0x08, 0x10, 0xF3, 0xC0, 0x7C, 0x31, 0x69, 0xE5, 0xA3, 0x0F, 0x80, 0xA0,
+  0x3E, 0x31, 0xB7, 0xF4, 0x1A, 0x0D, 0x07, 0x7E, 0xC6, 0x3E, 0x00, 0x70,
+  0x5F, 0x1F, 0x83, 0xE0, 0x25, 0xB9, 0x1B, 0x24, 0xFF, 0x01, 0x01, 0xE0,
+  0x3E, 0x31, 0xBF, 0xF4, 0x5B, 0xCD, 0x27, 0x8E, 0xC6, 0x3E, 0x00, 0xF0,
+  0x69, 0x96, 0x10, 0x23, 0xF8, 0x81, 0x00, 0x3F, 0x80, 0xE4, 0xAE, 0xF1,
+  0x61, 0xF0, 0x50, 0x85, 0x0A, 0x14, 0x28, 0x50, 0xBF, 0xC0, 0x81, 0x00,
+  0x7F, 0x7B, 0xD6, 0x94, 0xA5, 0x29, 0x40, 0xC0, 0x70, 0xC9, 0x2E, 0x74,
+  0x63, 0x17, 0x03, 0xE0, 0x93, 0x62, 0x76, 0x90, 0xC1, 0x08, 0x41, 0x08,
+  0x22, 0x0E, 0xC4, 0x11, 0x84, 0x50, 0x8F, 0x20, 0x40, 0xC1, 0x10, 0x84,
+  0x21, 0x10, 0xED, 0xC2, 0x11, 0x04, 0x42, 0x21, 0xC0, 0xF1, 0x02, 0x41,
+  0x88, 0x0A, 0x0F, 0xC4, 0x11, 0x84, 0x50, 0x8F, 0x20, 0x40, 0x21, 0x00,
+  0x42, 0x33, 0x10, 0x8B, 0x80, 0x10, 0x08, 0x00, 0x18, 0x18, 0x24, 0x24,
+  0x24, 0x42, 0x7E, 0x42, 0x81, 0x08, 0x10, 0x00, 0x18, 0x18, 0x24, 0x24,
+  0x24, 0x42, 0x7E, 0x42, 0x81, 0x18, 0x24, 0x00, 0x18, 0x18, 0x24, 0x24,
+  0x24, 0x42, 0x7E, 0x42, 0x81, 0x34, 0x2C, 0x00, 0x18, 0x18, 0x24, 0x24,
+  0x24, 0x42, 0x7E, 0x42, 0x81, 0x24, 0x00, 0x18, 0x18, 0x24, 0x24, 0x24,
+  0x42, 0x7E, 0x42, 0x81, 0x18, 0x24, 0x24, 0x18, 0x18, 0x24, 0x24, 0x24,
+  0x42, 0x7E, 0x42, 0x81, 0x1F, 0xE2, 0x80, 0x50, 0x12, 0x02, 0x7E, 0x88,
+  0x1F, 0x02, 0x20, 0x87, 0xE0, 0x39, 0x18, 0x20, 0x82, 0x08, 0x11, 0x38,
+  0x21, 0x80, 0x20, 0x40, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x10,
+  0x80, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x31, 0x20, 0x3F, 0x82,
+  0x08, 0x3F, 0x82, 0x08, 0x3F, 0x50, 0x0F, 0xE0, 0x82, 0x0F, 0xE0, 0x82,
+  0x0F, 0xC0, 0x92, 0xAA, 0xAA, 0x62, 0xAA, 0xAA, 0x76, 0xC0, 0x42, 0x10,
+  0x84, 0x21, 0x08, 0x40, 0xA1, 0x24, 0x92, 0x49, 0x00, 0x7C, 0x42, 0x41,
+  0x41, 0xF1, 0x41, 0x41, 0x42, 0x7C, 0x74, 0xB8, 0x06, 0x1C, 0x34, 0x68,
+  0xC9, 0x8B, 0x16, 0x1C, 0x30, 0x10, 0x10, 0x01, 0xC4, 0x50, 0x60, 0xC1,
+  0x83, 0x05, 0x11, 0xC0, 0x08, 0x20, 0x01, 0xC4, 0x50, 0x60, 0xC1, 0x83,
+  0x05, 0x11, 0xC0, 0x10, 0x50, 0x01, 0xC4, 0x50, 0x60, 0xC1, 0x83, 0x05,
+  0x11, 0xC0, 0x74, 0xB8, 0x01, 0xC4, 0x50, 0x60, 0xC1, 0x83, 0x05, 0x11,
+  0xC0, 0x28, 0x00, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, 0x82,
+  0x88, 0xA0, 0x82, 0x88, 0xA0, 0x80, 0x3A, 0x8A, 0x1C, 0x59, 0x34, 0x70,
+  0xA2, 0xB8, 0x20, 0x20, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B,
+  0xE0, 0x10, 0x40, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xE0,
+  0x10, 0x50, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xE0, 0x28,
+  0x02, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x8D, 0xF0, 0x08, 0x20, 0x04,
+  0x14, 0x48, 0x8A, 0x14, 0x10, 0x20, 0x40, 0x80, 0x83, 0xE8, 0x61, 0x87,
+  0xE8, 0x20, 0x80, 0x72, 0x28, 0xAC, 0xA2, 0xC8, 0xA1, 0x86, 0xE0, 0x20,
+  0x40, 0x1E, 0x84, 0x17, 0xE1, 0x8D, 0xD0, 0x10, 0x80, 0x1E, 0x84, 0x17,
+  0xE1, 0x8D, 0xD0, 0x31, 0x20, 0x1E, 0x84, 0x17, 0xE1, 0x8D, 0xD0, 0x69,
+  0x60, 0x1E, 0x84, 0x17, 0xE1, 0x8D, 0xD0, 0x48, 0x07, 0xA1, 0x05, 0xF8,
+  0x63, 0x74, 0x31, 0x24, 0x8C, 0x01, 0xE8, 0x41, 0x7E, 0x18, 0xDD, 0x77,
+  0xA3, 0x30, 0x85, 0xFF, 0x88, 0x27, 0x17, 0x78, 0x76, 0x61, 0x08, 0x65,
+  0xC2, 0x30, 0x20, 0x40, 0x1E, 0xCE, 0x1F, 0xE0, 0xC5, 0xE0, 0x10, 0x80,
+  0x1E, 0xCE, 0x1F, 0xE0, 0xC5, 0xE0, 0x31, 0x20, 0x1E, 0xCE, 0x1F, 0xE0,
+  0xC5, 0xE0, 0x28, 0x07, 0xB3, 0x87, 0xF8, 0x31, 0x78, 0x44, 0x24, 0x92,
+  0x48, 0x50, 0x49, 0x24, 0x90, 0x76, 0xC0, 0x42, 0x10, 0x84, 0x21, 0x00,
+  0xA1, 0x24, 0x92, 0x40, 0x49, 0xC1, 0x1E, 0xC6, 0x18, 0x73, 0x78, 0x75,
+  0x70, 0x2E, 0xC6, 0x18, 0x61, 0x86, 0x10, 0x20, 0x40, 0x1E, 0xCE, 0x18,
+  0x61, 0xCD, 0xE0, 0x10, 0x80, 0x1E, 0xCE, 0x18, 0x61, 0xCD, 0xE0, 0x31,
+  0x20, 0x1E, 0xCE, 0x18, 0x61, 0xCD, 0xE0, 0x69, 0x60, 0x1E, 0xCE, 0x18,
+  0x61, 0xCD, 0xE0, 0x48, 0x07, 0xB3, 0x86, 0x18, 0x73, 0x78, 0x10, 0x03,
+  0xF8, 0x01, 0x00, 0x7F, 0x39, 0x69, 0xA7, 0x3F, 0x80, 0x20, 0x40, 0x21,
+  0x86, 0x18, 0x61, 0x8D, 0xD0, 0x10, 0x80, 0x21, 0x86, 0x18, 0x61, 0x8D,
+  0xD0, 0x31, 0x20, 0x21, 0x86, 0x18, 0x61, 0x8D, 0xD0, 0x48, 0x08, 0x61,
+  0x86, 0x18, 0x63, 0x74, 0x08, 0x40, 0x21, 0x85, 0x24, 0x8A, 0x30, 0x41,
+  0x08, 0xC0, 0x82, 0x08, 0x3E, 0xCE, 0x18, 0x61, 0xCF, 0xE8, 0x20, 0x80,
+  0x48, 0x08, 0x61, 0x49, 0x22, 0x8C, 0x10, 0x42, 0x30 };
+
+const GFXglyph DejaVuSans6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   1,   9,   5,    2,   -8 },   // 0x21 '!'
+  {     3,   3,   3,   5,    1,   -8 },   // 0x22 '"'
+  {     5,   8,   8,  10,    1,   -7 },   // 0x23 '#'
+  {    13,   5,  11,   8,    2,   -8 },   // 0x24 '$'
+  {    20,  10,   9,  11,    0,   -8 },   // 0x25 '%'
+  {    32,   8,   9,  10,    1,   -8 },   // 0x26 '&'
+  {    41,   1,   3,   3,    1,   -8 },   // 0x27 '''
+  {    42,   3,  11,   5,    1,   -9 },   // 0x28 '('
+  {    47,   3,  11,   5,    1,   -9 },   // 0x29 ')'
+  {    52,   5,   6,   6,    1,   -8 },   // 0x2A '*'
+  {    56,   7,   7,  10,    1,   -6 },   // 0x2B '+'
+  {    63,   1,   3,   4,    1,   -1 },   // 0x2C ','
+  {    64,   3,   1,   4,    1,   -3 },   // 0x2D '-'
+  {    65,   1,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    66,   4,  10,   4,    0,   -8 },   // 0x2F '/'
+  {    71,   6,   9,   8,    1,   -8 },   // 0x30 '0'
+  {    78,   5,   9,   8,    1,   -8 },   // 0x31 '1'
+  {    84,   6,   9,   8,    1,   -8 },   // 0x32 '2'
+  {    91,   6,   9,   8,    1,   -8 },   // 0x33 '3'
+  {    98,   6,   9,   8,    1,   -8 },   // 0x34 '4'
+  {   105,   6,   9,   8,    1,   -8 },   // 0x35 '5'
+  {   112,   6,   9,   8,    1,   -8 },   // 0x36 '6'
+  {   119,   6,   9,   8,    1,   -8 },   // 0x37 '7'
+  {   126,   6,   9,   8,    1,   -8 },   // 0x38 '8'
+  {   133,   6,   9,   8,    1,   -8 },   // 0x39 '9'
+  {   140,   1,   6,   4,    1,   -5 },   // 0x3A ':'
+  {   141,   1,   7,   4,    1,   -5 },   // 0x3B ';'
+  {   142,   8,   6,  10,    1,   -6 },   // 0x3C '<'
+  {   148,   8,   3,  10,    1,   -4 },   // 0x3D '='
+  {   151,   8,   6,  10,    1,   -6 },   // 0x3E '>'
+  {   157,   5,   9,   6,    0,   -8 },   // 0x3F '?'
+  {   163,  11,  11,  13,    1,   -8 },   // 0x40 '@'
+  {   179,   8,   9,   8,    0,   -8 },   // 0x41 'A'
+  {   188,   6,   9,   8,    1,   -8 },   // 0x42 'B'
+  {   195,   6,   9,   8,    1,   -8 },   // 0x43 'C'
+  {   202,   7,   9,   9,    1,   -8 },   // 0x44 'D'
+  {   210,   6,   9,   8,    1,   -8 },   // 0x45 'E'
+  {   217,   5,   9,   7,    1,   -8 },   // 0x46 'F'
+  {   223,   7,   9,   9,    1,   -8 },   // 0x47 'G'
+  {   231,   7,   9,   9,    1,   -8 },   // 0x48 'H'
+  {   239,   1,   9,   3,    1,   -8 },   // 0x49 'I'
+  {   241,   3,  11,   3,   -1,   -8 },   // 0x4A 'J'
+  {   246,   7,   9,   7,    1,   -8 },   // 0x4B 'K'
+  {   254,   5,   9,   6,    1,   -8 },   // 0x4C 'L'
+  {   260,   8,   9,  10,    1,   -8 },   // 0x4D 'M'
+  {   269,   7,   9,   9,    1,   -8 },   // 0x4E 'N'
+  {   277,   7,   9,   9,    1,   -8 },   // 0x4F 'O'
+  {   285,   6,   9,   8,    1,   -8 },   // 0x50 'P'
+  {   292,   7,  11,   9,    1,   -8 },   // 0x51 'Q'
+  {   302,   7,   9,   8,    1,   -8 },   // 0x52 'R'
+  {   310,   6,   9,   8,    1,   -8 },   // 0x53 'S'
+  {   317,   7,   9,   7,    0,   -8 },   // 0x54 'T'
+  {   325,   7,   9,   9,    1,   -8 },   // 0x55 'U'
+  {   333,  10,   9,   8,   -1,   -8 },   // 0x56 'V'
+  {   345,  11,   9,  11,    0,   -8 },   // 0x57 'W'
+  {   358,   7,   9,   7,    0,   -8 },   // 0x58 'X'
+  {   366,   7,   9,   7,    0,   -8 },   // 0x59 'Y'
+  {   374,   7,   9,   9,    1,   -8 },   // 0x5A 'Z'
+  {   382,   2,  11,   5,    2,   -8 },   // 0x5B '['
+  {   385,   4,  10,   4,    0,   -8 },   // 0x5C '\'
+  {   390,   2,  11,   5,    1,   -8 },   // 0x5D ']'
+  {   393,   8,   3,  10,    1,   -8 },   // 0x5E '^'
+  {   396,   6,   1,   6,    0,    3 },   // 0x5F '_'
+  {   397,   3,   2,   6,    1,   -9 },   // 0x60 '`'
+  {   398,   6,   7,   8,    1,   -6 },   // 0x61 'a'
+  {   404,   6,  10,   8,    1,   -9 },   // 0x62 'b'
+  {   412,   5,   7,   7,    1,   -6 },   // 0x63 'c'
+  {   417,   6,  10,   8,    1,   -9 },   // 0x64 'd'
+  {   425,   6,   7,   8,    1,   -6 },   // 0x65 'e'
+  {   431,   4,  10,   4,    0,   -9 },   // 0x66 'f'
+  {   436,   6,  10,   8,    1,   -6 },   // 0x67 'g'
+  {   444,   6,  10,   8,    1,   -9 },   // 0x68 'h'
+  {   452,   1,   9,   3,    1,   -8 },   // 0x69 'i'
+  {   454,   2,  12,   3,    0,   -8 },   // 0x6A 'j'
+  {   457,   6,  10,   7,    1,   -9 },   // 0x6B 'k'
+  {   465,   1,  10,   3,    1,   -9 },   // 0x6C 'l'
+  {   467,   9,   7,  11,    1,   -6 },   // 0x6D 'm'
+  {   475,   6,   7,   8,    1,   -6 },   // 0x6E 'n'
+  {   481,   6,   7,   8,    1,   -6 },   // 0x6F 'o'
+  {   487,   6,  10,   8,    1,   -6 },   // 0x70 'p'
+  {   495,   6,  10,   8,    1,   -6 },   // 0x71 'q'
+  {   503,   4,   7,   5,    1,   -6 },   // 0x72 'r'
+  {   507,   5,   7,   7,    1,   -6 },   // 0x73 's'
+  {   512,   4,   9,   5,    0,   -8 },   // 0x74 't'
+  {   517,   6,   7,   8,    1,   -6 },   // 0x75 'u'
+  {   523,   6,   7,   6,    0,   -6 },   // 0x76 'v'
+  {   529,   9,   7,   9,    0,   -6 },   // 0x77 'w'
+  {   537,   6,   7,   6,    0,   -6 },   // 0x78 'x'
+  {   543,   6,  10,   6,    0,   -6 },   // 0x79 'y'
+  {   551,   5,   7,   5,    0,   -6 },   // 0x7A 'z'
+  {   556,   5,  11,   8,    2,   -8 },   // 0x7B '{'
+  {   563,   1,  12,   4,    2,   -8 },   // 0x7C '|'
+  {   565,   5,  11,   8,    1,   -8 },   // 0x7D '}'
+  {   572,   8,   2,  10,    1,   -4 },   // 0x7E '~'
+  {   574,   6,  11,   7,    1,   -7 },   // 0x7F
+  {   583,   6,  11,   7,    1,   -7 },   // 0x80
+  {   592,   6,  11,   7,    1,   -7 },   // 0x81
+  {   601,   6,  11,   7,    1,   -7 },   // 0x82
+  {   610,   6,  11,   7,    1,   -7 },   // 0x83
+  {   619,   6,  11,   7,    1,   -7 },   // 0x84
+  {   628,   6,  11,   7,    1,   -7 },   // 0x85
+  {   637,   6,  11,   7,    1,   -7 },   // 0x86
+  {   646,   6,  11,   7,    1,   -7 },   // 0x87
+  {   655,   6,  11,   7,    1,   -7 },   // 0x88
+  {   664,   6,  11,   7,    1,   -7 },   // 0x89
+  {   673,   6,  11,   7,    1,   -7 },   // 0x8A
+  {   682,   6,  11,   7,    1,   -7 },   // 0x8B
+  {   691,   6,  11,   7,    1,   -7 },   // 0x8C
+  {   700,   6,  11,   7,    1,   -7 },   // 0x8D
+  {   709,   6,  11,   7,    1,   -7 },   // 0x8E
+  {   718,   6,  11,   7,    1,   -7 },   // 0x8F
+  {   727,   6,  11,   7,    1,   -7 },   // 0x90
+  {   736,   6,  11,   7,    1,   -7 },   // 0x91
+  {   745,   6,  11,   7,    1,   -7 },   // 0x92
+  {   754,   6,  11,   7,    1,   -7 },   // 0x93
+  {   763,   6,  11,   7,    1,   -7 },   // 0x94
+  {   772,   6,  11,   7,    1,   -7 },   // 0x95
+  {   781,   6,  11,   7,    1,   -7 },   // 0x96
+  {   790,   6,  11,   7,    1,   -7 },   // 0x97
+  {   799,   6,  11,   7,    1,   -7 },   // 0x98
+  {   808,   6,  11,   7,    1,   -7 },   // 0x99
+  {   817,   6,  11,   7,    1,   -7 },   // 0x9A
+  {   826,   6,  11,   7,    1,   -7 },   // 0x9B
+  {   835,   6,  11,   7,    1,   -7 },   // 0x9C
+  {   844,   6,  11,   7,    1,   -7 },   // 0x9D
+  {   853,   6,  11,   7,    1,   -7 },   // 0x9E
+  {   862,   6,  11,   7,    1,   -7 },   // 0x9F
+  {   871,   1,   1,   4,    0,    0 },   // 0xA0
+  {   872,   1,   9,   5,    2,   -6 },   // 0xA1
+  {   874,   5,  11,   8,    1,   -8 },   // 0xA2
+  {   881,   5,   9,   8,    2,   -8 },   // 0xA3
+  {   887,   7,   7,   8,    0,   -6 },   // 0xA4
+  {   894,   7,   9,   8,    1,   -8 },   // 0xA5
+  {   902,   1,  10,   4,    2,   -7 },   // 0xA6
+  {   904,   5,  10,   6,    0,   -8 },   // 0xA7
+  {   911,   3,   1,   6,    2,   -8 },   // 0xA8
+  {   912,   9,   9,  12,    2,   -8 },   // 0xA9
+  {   923,   5,   7,   6,    1,   -8 },   // 0xAA
+  {   928,   6,   5,   7,    1,   -5 },   // 0xAB
+  {   932,   8,   3,  10,    1,   -4 },   // 0xAC
+  {   935,   3,   1,   4,    1,   -3 },   // 0xAD
+  {   936,   9,   9,  12,    2,   -8 },   // 0xAE
+  {   947,   4,   1,   6,    1,   -8 },   // 0xAF
+  {   948,   4,   4,   6,    1,   -8 },   // 0xB0
+  {   950,   7,   7,  10,    2,   -6 },   // 0xB1
+  {   957,   3,   5,   5,    1,   -8 },   // 0xB2
+  {   959,   4,   5,   5,    1,   -8 },   // 0xB3
+  {   962,   3,   2,   6,    2,   -9 },   // 0xB4
+  {   963,   7,  10,   8,    1,   -6 },   // 0xB5
+  {   972,   5,  10,   8,    1,   -8 },   // 0xB6
+  {   979,   1,   2,   4,    1,   -4 },   // 0xB7
+  {   980,   2,   2,   6,    2,    1 },   // 0xB8
+  {   981,   3,   5,   5,    1,   -8 },   // 0xB9
+  {   983,   5,   7,   6,    1,   -8 },   // 0xBA
+  {   988,   6,   5,   7,    1,   -5 },   // 0xBB
+  {   992,  11,   9,  12,    1,   -8 },   // 0xBC
+  {  1005,  10,   9,  12,    1,   -8 },   // 0xBD
+  {  1017,  11,   9,  12,    1,   -8 },   // 0xBE
+  {  1030,   5,  10,   6,    1,   -6 },   // 0xBF
+  {  1037,   8,  12,   8,    0,  -11 },   // 0xC0
+  {  1049,   8,  12,   8,    0,  -11 },   // 0xC1
+  {  1061,   8,  12,   8,    0,  -11 },   // 0xC2
+  {  1073,   8,  12,   8,    0,  -11 },   // 0xC3
+  {  1085,   8,  11,   8,    0,  -10 },   // 0xC4
+  {  1096,   8,  12,   8,    0,  -11 },   // 0xC5
+  {  1108,  11,   9,  12,    0,   -8 },   // 0xC6
+  {  1121,   6,  11,   8,    1,   -8 },   // 0xC7
+  {  1130,   6,  12,   8,    1,  -11 },   // 0xC8
+  {  1139,   6,  12,   8,    1,  -11 },   // 0xC9
+  {  1148,   6,  12,   8,    1,  -11 },   // 0xCA
+  {  1157,   6,  11,   8,    1,  -10 },   // 0xCB
+  {  1166,   2,  12,   3,    1,  -11 },   // 0xCC
+  {  1169,   2,  12,   3,    1,  -11 },   // 0xCD
+  {  1172,   5,  12,   3,   -1,  -11 },   // 0xCE
+  {  1180,   3,  11,   3,    0,  -10 },   // 0xCF
+  {  1185,   8,   9,   9,    0,   -8 },   // 0xD0
+  {  1194,   7,  12,   9,    1,  -11 },   // 0xD1
+  {  1205,   7,  12,   9,    1,  -11 },   // 0xD2
+  {  1216,   7,  12,   9,    1,  -11 },   // 0xD3
+  {  1227,   7,  12,   9,    1,  -11 },   // 0xD4
+  {  1238,   7,  12,   9,    1,  -11 },   // 0xD5
+  {  1249,   7,  11,   9,    1,  -10 },   // 0xD6
+  {  1259,   7,   7,  10,    2,   -6 },   // 0xD7
+  {  1266,   7,   9,   9,    1,   -8 },   // 0xD8
+  {  1274,   7,  12,   9,    1,  -11 },   // 0xD9
+  {  1285,   7,  12,   9,    1,  -11 },   // 0xDA
+  {  1296,   7,  12,   9,    1,  -11 },   // 0xDB
+  {  1307,   7,  11,   9,    1,  -10 },   // 0xDC
+  {  1317,   7,  12,   7,    0,  -11 },   // 0xDD
+  {  1328,   6,   9,   8,    1,   -8 },   // 0xDE
+  {  1335,   6,  10,   8,    1,   -9 },   // 0xDF
+  {  1343,   6,  10,   8,    1,   -9 },   // 0xE0
+  {  1351,   6,  10,   8,    1,   -9 },   // 0xE1
+  {  1359,   6,  10,   8,    1,   -9 },   // 0xE2
+  {  1367,   6,  10,   8,    1,   -9 },   // 0xE3
+  {  1375,   6,   9,   8,    1,   -8 },   // 0xE4
+  {  1382,   6,  12,   8,    1,  -11 },   // 0xE5
+  {  1391,  10,   7,  12,    1,   -6 },   // 0xE6
+  {  1400,   5,   9,   7,    1,   -6 },   // 0xE7
+  {  1406,   6,  10,   8,    1,   -9 },   // 0xE8
+  {  1414,   6,  10,   8,    1,   -9 },   // 0xE9
+  {  1422,   6,  10,   8,    1,   -9 },   // 0xEA
+  {  1430,   6,   9,   8,    1,   -8 },   // 0xEB
+  {  1437,   3,  10,   3,    0,   -9 },   // 0xEC
+  {  1441,   3,  10,   3,    1,   -9 },   // 0xED
+  {  1445,   5,  10,   3,   -1,   -9 },   // 0xEE
+  {  1452,   3,   9,   3,    0,   -8 },   // 0xEF
+  {  1456,   6,   9,   8,    1,   -8 },   // 0xF0
+  {  1463,   6,  10,   8,    1,   -9 },   // 0xF1
+  {  1471,   6,  10,   8,    1,   -9 },   // 0xF2
+  {  1479,   6,  10,   8,    1,   -9 },   // 0xF3
+  {  1487,   6,  10,   8,    1,   -9 },   // 0xF4
+  {  1495,   6,  10,   8,    1,   -9 },   // 0xF5
+  {  1503,   6,   9,   8,    1,   -8 },   // 0xF6
+  {  1510,   7,   5,  10,    1,   -5 },   // 0xF7
+  {  1515,   6,   7,   8,    1,   -6 },   // 0xF8
+  {  1521,   6,  10,   8,    1,   -9 },   // 0xF9
+  {  1529,   6,  10,   8,    1,   -9 },   // 0xFA
+  {  1537,   6,  10,   8,    1,   -9 },   // 0xFB
+  {  1545,   6,   9,   8,    1,   -8 },   // 0xFC
+  {  1552,   6,  13,   6,    0,   -9 },   // 0xFD
+  {  1562,   6,  13,   8,    1,   -9 },   // 0xFE
+  {  1572,   6,  12,   6,    0,   -8 } }; // 0xFF
+
+const GFXfont DejaVuSans6pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans6pt8bBitmaps,
+  (GFXglyph *)DejaVuSans6pt8bGlyphs,
+  0x20, 0xFF, 14 };
+
+// Approx. 3156 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans6pt8bMetrics[] PROGMEM = {
+  {   0,   4,   1 },   // 0x20
+  {   2,   5,   3 },   // 0x21
+  {   1,   5,   4 },   // 0x22
+  {   1,  10,   9 },   // 0x23
+  {   2,   8,   7 },   // 0x24
+  {   0,  11,  10 },   // 0x25
+  {   1,  10,   9 },   // 0x26
+  {   1,   3,   2 },   // 0x27
+  {   1,   5,   4 },   // 0x28
+  {   1,   5,   4 },   // 0x29
+  {   1,   6,   6 },   // 0x2A
+  {   1,  10,   8 },   // 0x2B
+  {   1,   4,   2 },   // 0x2C
+  {   1,   4,   4 },   // 0x2D
+  {   1,   4,   2 },   // 0x2E
+  {   0,   4,   4 },   // 0x2F
+  {   1,   8,   7 },   // 0x30
+  {   1,   8,   6 },   // 0x31
+  {   1,   8,   7 },   // 0x32
+  {   1,   8,   7 },   // 0x33
+  {   1,   8,   7 },   // 0x34
+  {   1,   8,   7 },   // 0x35
+  {   1,   8,   7 },   // 0x36
+  {   1,   8,   7 },   // 0x37
+  {   1,   8,   7 },   // 0x38
+  {   1,   8,   7 },   // 0x39
+  {   1,   4,   2 },   // 0x3A
+  {   1,   4,   2 },   // 0x3B
+  {   1,  10,   9 },   // 0x3C
+  {   1,  10,   9 },   // 0x3D
+  {   1,  10,   9 },   // 0x3E
+  {   0,   6,   5 },   // 0x3F
+  {   1,  13,  12 },   // 0x40
+  {   0,   8,   8 },   // 0x41
+  {   1,   8,   7 },   // 0x42
+  {   1,   8,   7 },   // 0x43
+  {   1,   9,   8 },   // 0x44
+  {   1,   8,   7 },   // 0x45
+  {   1,   7,   6 },   // 0x46
+  {   1,   9,   8 },   // 0x47
+  {   1,   9,   8 },   // 0x48
+  {   1,   3,   2 },   // 0x49
+  {  -1,   3,   2 },   // 0x4A
+  {   1,   7,   8 },   // 0x4B
+  {   1,   6,   6 },   // 0x4C
+  {   1,  10,   9 },   // 0x4D
+  {   1,   9,   8 },   // 0x4E
+  {   1,   9,   8 },   // 0x4F
+  {   1,   8,   7 },   // 0x50
+  {   1,   9,   8 },   // 0x51
+  {   1,   8,   8 },   // 0x52
+  {   1,   8,   7 },   // 0x53
+  {   0,   7,   7 },   // 0x54
+  {   1,   9,   8 },   // 0x55
+  {  -1,   8,   9 },   // 0x56
+  {   0,  11,  11 },   // 0x57
+  {   0,   7,   7 },   // 0x58
+  {   0,   7,   7 },   // 0x59
+  {   1,   9,   8 },   // 0x5A
+  {   2,   5,   4 },   // 0x5B
+  {   0,   4,   4 },   // 0x5C
+  {   1,   5,   3 },   // 0x5D
+  {   1,  10,   9 },   // 0x5E
+  {   0,   6,   6 },   // 0x5F
+  {   1,   6,   4 },   // 0x60
+  {   1,   8,   7 },   // 0x61
+  {   1,   8,   7 },   // 0x62
+  {   1,   7,   6 },   // 0x63
+  {   1,   8,   7 },   // 0x64
+  {   1,   8,   7 },   // 0x65
+  {   0,   4,   4 },   // 0x66
+  {   1,   8,   7 },   // 0x67
+  {   1,   8,   7 },   // 0x68
+  {   1,   3,   2 },   // 0x69
+  {   0,   3,   2 },   // 0x6A
+  {   1,   7,   7 },   // 0x6B
+  {   1,   3,   2 },   // 0x6C
+  {   1,  11,  10 },   // 0x6D
+  {   1,   8,   7 },   // 0x6E
+  {   1,   8,   7 },   // 0x6F
+  {   1,   8,   7 },   // 0x70
+  {   1,   8,   7 },   // 0x71
+  {   1,   5,   5 },   // 0x72
+  {   1,   7,   6 },   // 0x73
+  {   0,   5,   4 },   // 0x74
+  {   1,   8,   7 },   // 0x75
+  {   0,   6,   6 },   // 0x76
+  {   0,   9,   9 },   // 0x77
+  {   0,   6,   6 },   // 0x78
+  {   0,   6,   6 },   // 0x79
+  {   0,   5,   5 },   // 0x7A
+  {   2,   8,   7 },   // 0x7B
+  {   2,   4,   3 },   // 0x7C
+  {   1,   8,   6 },   // 0x7D
+  {   1,  10,   9 },   // 0x7E
+  {   1,   7,   7 },   // 0x7F
+  {   1,   7,   7 },   // 0x80
+  {   1,   7,   7 },   // 0x81
+  {   1,   7,   7 },   // 0x82
+  {   1,   7,   7 },   // 0x83
+  {   1,   7,   7 },   // 0x84
+  {   1,   7,   7 },   // 0x85
+  {   1,   7,   7 },   // 0x86
+  {   1,   7,   7 },   // 0x87
+  {   1,   7,   7 },   // 0x88
+  {   1,   7,   7 },   // 0x89
+  {   1,   7,   7 },   // 0x8A
+  {   1,   7,   7 },   // 0x8B
+  {   1,   7,   7 },   // 0x8C
+  {   1,   7,   7 },   // 0x8D
+  {   1,   7,   7 },   // 0x8E
+  {   1,   7,   7 },   // 0x8F
+  {   1,   7,   7 },   // 0x90
+  {   1,   7,   7 },   // 0x91
+  {   1,   7,   7 },   // 0x92
+  {   1,   7,   7 },   // 0x93
+  {   1,   7,   7 },   // 0x94
+  {   1,   7,   7 },   // 0x95
+  {   1,   7,   7 },   // 0x96
+  {   1,   7,   7 },   // 0x97
+  {   1,   7,   7 },   // 0x98
+  {   1,   7,   7 },   // 0x99
+  {   1,   7,   7 },   // 0x9A
+  {   1,   7,   7 },   // 0x9B
+  {   1,   7,   7 },   // 0x9C
+  {   1,   7,   7 },   // 0x9D
+  {   1,   7,   7 },   // 0x9E
+  {   1,   7,   7 },   // 0x9F
+  {   0,   4,   1 },   // 0xA0
+  {   2,   5,   3 },   // 0xA1
+  {   1,   8,   6 },   // 0xA2
+  {   2,   8,   7 },   // 0xA3
+  {   0,   8,   7 },   // 0xA4
+  {   1,   8,   8 },   // 0xA5
+  {   2,   4,   3 },   // 0xA6
+  {   0,   6,   5 },   // 0xA7
+  {   2,   6,   5 },   // 0xA8
+  {   2,  12,  11 },   // 0xA9
+  {   1,   6,   6 },   // 0xAA
+  {   1,   7,   7 },   // 0xAB
+  {   1,  10,   9 },   // 0xAC
+  {   1,   4,   4 },   // 0xAD
+  {   2,  12,  11 },   // 0xAE
+  {   1,   6,   5 },   // 0xAF
+  {   1,   6,   5 },   // 0xB0
+  {   2,  10,   9 },   // 0xB1
+  {   1,   5,   4 },   // 0xB2
+  {   1,   5,   5 },   // 0xB3
+  {   2,   6,   5 },   // 0xB4
+  {   1,   8,   8 },   // 0xB5
+  {   1,   8,   6 },   // 0xB6
+  {   1,   4,   2 },   // 0xB7
+  {   2,   6,   4 },   // 0xB8
+  {   1,   5,   4 },   // 0xB9
+  {   1,   6,   6 },   // 0xBA
+  {   1,   7,   7 },   // 0xBB
+  {   1,  12,  12 },   // 0xBC
+  {   1,  12,  11 },   // 0xBD
+  {   1,  12,  12 },   // 0xBE
+  {   1,   6,   6 },   // 0xBF
+  {   0,   8,   8 },   // 0xC0
+  {   0,   8,   8 },   // 0xC1
+  {   0,   8,   8 },   // 0xC2
+  {   0,   8,   8 },   // 0xC3
+  {   0,   8,   8 },   // 0xC4
+  {   0,   8,   8 },   // 0xC5
+  {   0,  12,  11 },   // 0xC6
+  {   1,   8,   7 },   // 0xC7
+  {   1,   8,   7 },   // 0xC8
+  {   1,   8,   7 },   // 0xC9
+  {   1,   8,   7 },   // 0xCA
+  {   1,   8,   7 },   // 0xCB
+  {   1,   3,   3 },   // 0xCC
+  {   1,   3,   3 },   // 0xCD
+  {  -1,   3,   4 },   // 0xCE
+  {   0,   3,   3 },   // 0xCF
+  {   0,   9,   8 },   // 0xD0
+  {   1,   9,   8 },   // 0xD1
+  {   1,   9,   8 },   // 0xD2
+  {   1,   9,   8 },   // 0xD3
+  {   1,   9,   8 },   // 0xD4
+  {   1,   9,   8 },   // 0xD5
+  {   1,   9,   8 },   // 0xD6
+  {   2,  10,   9 },   // 0xD7
+  {   1,   9,   8 },   // 0xD8
+  {   1,   9,   8 },   // 0xD9
+  {   1,   9,   8 },   // 0xDA
+  {   1,   9,   8 },   // 0xDB
+  {   1,   9,   8 },   // 0xDC
+  {   0,   7,   7 },   // 0xDD
+  {   1,   8,   7 },   // 0xDE
+  {   1,   8,   7 },   // 0xDF
+  {   1,   8,   7 },   // 0xE0
+  {   1,   8,   7 },   // 0xE1
+  {   1,   8,   7 },   // 0xE2
+  {   1,   8,   7 },   // 0xE3
+  {   1,   8,   7 },   // 0xE4
+  {   1,   8,   7 },   // 0xE5
+  {   1,  12,  11 },   // 0xE6
+  {   1,   7,   6 },   // 0xE7
+  {   1,   8,   7 },   // 0xE8
+  {   1,   8,   7 },   // 0xE9
+  {   1,   8,   7 },   // 0xEA
+  {   1,   8,   7 },   // 0xEB
+  {   0,   3,   3 },   // 0xEC
+  {   1,   3,   4 },   // 0xED
+  {  -1,   3,   4 },   // 0xEE
+  {   0,   3,   3 },   // 0xEF
+  {   1,   8,   7 },   // 0xF0
+  {   1,   8,   7 },   // 0xF1
+  {   1,   8,   7 },   // 0xF2
+  {   1,   8,   7 },   // 0xF3
+  {   1,   8,   7 },   // 0xF4
+  {   1,   8,   7 },   // 0xF5
+  {   1,   8,   7 },   // 0xF6
+  {   1,  10,   8 },   // 0xF7
+  {   1,   8,   7 },   // 0xF8
+  {   1,   8,   7 },   // 0xF9
+  {   1,   8,   7 },   // 0xFA
+  {   1,   8,   7 },   // 0xFB
+  {   1,   8,   7 },   // 0xFC
+  {   0,   6,   6 },   // 0xFD
+  {   1,   8,   7 },   // 0xFE
+  {   0,   6,   6 }    // 0xFF
+};
+const FontMetrics DejaVuSans6pt8bWidths = { DejaVuSans6pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS6PTLAT1__H
@@ -0,0 +1,637 @@
+#ifndef DEJAVUSANS7PTLAT1__H
+#define DEJAVUSANS7PTLAT1__H
+const uint8_t DejaVuSans7pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFC, 0xC0, 0xB6, 0xD0, 0x09, 0x02, 0x40, 0x91, 0xFF, 0x12, 0x04,
+  0x8F, 0xF8, 0x98, 0x24, 0x09, 0x00, 0x10, 0x21, 0xF4, 0x99, 0x1A, 0x1F,
+  0x0B, 0x13, 0x25, 0xF0, 0x81, 0x00, 0x70, 0x88, 0x88, 0x89, 0x08, 0xB0,
+  0x8A, 0xE7, 0x51, 0x0D, 0x10, 0x91, 0x11, 0x11, 0x0E, 0x38, 0x11, 0x04,
+  0x00, 0x80, 0x50, 0x22, 0x18, 0x46, 0x0A, 0x43, 0x0F, 0x30, 0xF0, 0x69,
+  0x49, 0x24, 0x89, 0x10, 0x89, 0x12, 0x49, 0x29, 0x40, 0x11, 0x25, 0xF1,
+  0xCD, 0x62, 0x00, 0x08, 0x04, 0x02, 0x01, 0x0F, 0xF8, 0x40, 0x20, 0x10,
+  0x08, 0x00, 0x58, 0xF0, 0xC0, 0x08, 0xC4, 0x23, 0x10, 0x8C, 0x42, 0x31,
+  0x00, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x44, 0x70, 0x65, 0x08,
+  0x42, 0x10, 0x84, 0x27, 0xC0, 0x7A, 0x30, 0x41, 0x0C, 0x21, 0x08, 0x43,
+  0xF0, 0x7D, 0x0C, 0x08, 0x13, 0xC0, 0xC0, 0x81, 0x86, 0xF0, 0x0C, 0x28,
+  0x91, 0x24, 0x50, 0xBF, 0x82, 0x04, 0x08, 0xFD, 0x02, 0x07, 0xC8, 0x40,
+  0x40, 0x81, 0x84, 0xF0, 0x3C, 0xC7, 0x04, 0x0B, 0xD8, 0xE0, 0xC1, 0x46,
+  0x78, 0xFE, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x80, 0x7D, 0x8E,
+  0x0E, 0x33, 0x98, 0xE0, 0xC1, 0xC6, 0xF8, 0x79, 0x8A, 0x0C, 0x1C, 0x6F,
+  0x40, 0x83, 0x8C, 0xF0, 0xC6, 0x50, 0x16, 0x00, 0x83, 0x8E, 0x1C, 0x0E,
+  0x01, 0xC0, 0x1C, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x80, 0x38, 0x03,
+  0x80, 0x70, 0x38, 0x71, 0xC1, 0x00, 0x74, 0x42, 0x33, 0x10, 0x80, 0x21,
+  0x00, 0x0F, 0x83, 0x04, 0x40, 0x24, 0xE9, 0x99, 0x99, 0x09, 0x90, 0x99,
+  0x9A, 0x4E, 0xC4, 0x00, 0x30, 0x40, 0xF8, 0x08, 0x0A, 0x05, 0x04, 0x42,
+  0x21, 0x11, 0xFC, 0x82, 0x41, 0x40, 0x40, 0xFE, 0x83, 0x81, 0x83, 0xFE,
+  0x83, 0x81, 0x81, 0x83, 0xFE, 0x3E, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xC0, 0x61, 0x3E, 0xFC, 0x41, 0xA0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x03,
+  0x83, 0x7E, 0x00, 0xFF, 0x02, 0x04, 0x0F, 0xF0, 0x20, 0x40, 0x81, 0xFC,
+  0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0x82, 0x00, 0x1F, 0x30, 0x50, 0x10,
+  0x08, 0x04, 0x1E, 0x02, 0x81, 0x60, 0x8F, 0x80, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xC0, 0x24, 0x92, 0x49, 0x24,
+  0x9C, 0x82, 0x84, 0x88, 0x90, 0xE0, 0xA0, 0x90, 0x88, 0x84, 0x82, 0x82,
+  0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF0, 0xC0, 0xF0, 0x3A, 0x16, 0x85,
+  0x92, 0x64, 0x98, 0xC6, 0x31, 0x80, 0x60, 0x10, 0xC1, 0xC1, 0xA1, 0x91,
+  0x91, 0x89, 0x89, 0x85, 0x83, 0x83, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C,
+  0x06, 0x03, 0x83, 0x63, 0x1F, 0x00, 0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA0,
+  0x40, 0x81, 0x00, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83,
+  0x63, 0x1F, 0x00, 0x80, 0x20, 0xFC, 0x86, 0x82, 0x82, 0x86, 0xFC, 0x86,
+  0x82, 0x82, 0x81, 0x7D, 0x86, 0x04, 0x06, 0x03, 0x80, 0x81, 0x86, 0xF8,
+  0xFF, 0x84, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x80, 0xA0,
+  0x90, 0x48, 0x22, 0x21, 0x10, 0x50, 0x28, 0x14, 0x04, 0x00, 0x82, 0x0C,
+  0x28, 0x51, 0x44, 0x8A, 0x24, 0x51, 0x14, 0x50, 0xA2, 0x85, 0x14, 0x28,
+  0xA0, 0x82, 0x00, 0xC1, 0xA0, 0x88, 0x82, 0x80, 0x80, 0xC0, 0x50, 0x44,
+  0x41, 0x60, 0xC0, 0xC1, 0xA0, 0x88, 0x84, 0x41, 0x40, 0x40, 0x20, 0x10,
+  0x08, 0x04, 0x00, 0xFF, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+  0xFF, 0xF2, 0x49, 0x24, 0x92, 0x70, 0x86, 0x10, 0x86, 0x10, 0x86, 0x10,
+  0x86, 0x10, 0xE4, 0x92, 0x49, 0x24, 0xF0, 0x1C, 0x1B, 0x18, 0xD8, 0x30,
+  0xFE, 0xC8, 0x80, 0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD, 0x81, 0x02, 0x05,
+  0xCC, 0x50, 0x60, 0xC1, 0x83, 0x8A, 0xE0, 0x39, 0x18, 0x20, 0x82, 0x04,
+  0x4E, 0x02, 0x04, 0x09, 0xD4, 0x70, 0x60, 0xC1, 0x82, 0x8C, 0xE8, 0x3C,
+  0x8E, 0x0F, 0xF8, 0x10, 0x10, 0x9E, 0x34, 0x4F, 0x44, 0x44, 0x44, 0x40,
+  0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x51, 0x9D, 0x02, 0x8C, 0xF0, 0x81, 0x02,
+  0x05, 0xEC, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x08, 0xDF, 0xE0, 0x24, 0x12,
+  0x49, 0x24, 0x93, 0x80, 0x81, 0x02, 0x04, 0x28, 0x92, 0x38, 0x50, 0x91,
+  0x12, 0x10, 0xFF, 0xE0, 0xB9, 0xD8, 0xC6, 0x10, 0xC2, 0x18, 0x43, 0x08,
+  0x61, 0x0C, 0x21, 0xBD, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x38, 0x8A,
+  0x0C, 0x18, 0x30, 0x51, 0x1C, 0xB9, 0x8A, 0x0C, 0x18, 0x30, 0x71, 0x5C,
+  0x81, 0x02, 0x00, 0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x51, 0x9D, 0x02, 0x04,
+  0x08, 0xBC, 0x88, 0x88, 0x88, 0x7A, 0x18, 0x38, 0x1C, 0x18, 0x5E, 0x42,
+  0x3E, 0x84, 0x21, 0x08, 0x41, 0xC0, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x71,
+  0xBD, 0x83, 0x05, 0x12, 0x24, 0x45, 0x0A, 0x08, 0x88, 0xC4, 0x62, 0x2A,
+  0xA5, 0x52, 0xA8, 0x88, 0x44, 0x82, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x41,
+  0x83, 0x05, 0x12, 0x22, 0x85, 0x04, 0x08, 0x10, 0x43, 0x00, 0xFC, 0x10,
+  0x84, 0x21, 0x08, 0x3F, 0x19, 0x08, 0x42, 0x13, 0x04, 0x21, 0x08, 0x41,
+  0x80, 0xFF, 0xFC, 0xC1, 0x08, 0x42, 0x10, 0x64, 0x21, 0x08, 0x4C, 0x00,
+  0x78, 0xC7, 0x80, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0x00, 0xCF, 0xC0, 0x10, 0x43, 0x95,
+  0x92, 0x49, 0x24, 0x54, 0xE1, 0x04, 0x1C, 0x44, 0x81, 0x02, 0x0F, 0x88,
+  0x10, 0x21, 0xFC, 0x81, 0x7E, 0x66, 0x42, 0x42, 0x66, 0x7E, 0x81, 0x82,
+  0x89, 0x11, 0x4E, 0xE2, 0x3F, 0x88, 0x10, 0x20, 0xF9, 0xF0, 0x7E, 0x0C,
+  0x1C, 0x8E, 0x16, 0x4E, 0x0C, 0x1F, 0x80, 0xA0, 0x1E, 0x18, 0x65, 0xEA,
+  0xC1, 0xA0, 0x68, 0x1B, 0x05, 0x7A, 0x61, 0x87, 0x80, 0x70, 0x5F, 0x18,
+  0xBC, 0x1F, 0x25, 0xBD, 0xB6, 0x6C, 0x90, 0xFF, 0x80, 0x40, 0x20, 0x10,
+  0xF0, 0x1E, 0x18, 0x65, 0xEA, 0x49, 0x9C, 0x65, 0x19, 0x25, 0x4E, 0x61,
+  0x87, 0x80, 0xF0, 0x69, 0x96, 0x08, 0x04, 0x02, 0x1F, 0xF0, 0x80, 0x40,
+  0x20, 0x00, 0xFF, 0x80, 0xE1, 0x12, 0x4F, 0xF1, 0x61, 0x1E, 0x6A, 0x00,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xC6, 0xFB, 0x80, 0x80, 0x80, 0x7F,
+  0xDF, 0x7D, 0x74, 0xD1, 0x45, 0x14, 0x51, 0x40, 0xC0, 0x47, 0x80, 0xC9,
+  0x25, 0xC0, 0x74, 0x63, 0x18, 0xB8, 0x1F, 0x93, 0x66, 0xDB, 0xDA, 0x40,
+  0xC0, 0x84, 0x10, 0x43, 0x04, 0x20, 0x44, 0x2E, 0x46, 0x08, 0xA1, 0x92,
+  0x11, 0xF2, 0x02, 0xC0, 0x84, 0x10, 0x43, 0x04, 0x20, 0x44, 0x0E, 0x4E,
+  0x08, 0x11, 0x81, 0x10, 0x22, 0x04, 0x00, 0xF0, 0xF0, 0x81, 0x10, 0x63,
+  0x01, 0x20, 0x14, 0x2E, 0x46, 0x08, 0xA1, 0x92, 0x11, 0xF2, 0x02, 0x21,
+  0x00, 0x42, 0x11, 0x10, 0x84, 0x5C, 0x10, 0x04, 0x00, 0x01, 0x01, 0x40,
+  0xA0, 0x88, 0x44, 0x22, 0x3F, 0x90, 0x48, 0x28, 0x08, 0x04, 0x04, 0x00,
+  0x01, 0x01, 0x40, 0xA0, 0x88, 0x44, 0x22, 0x3F, 0x90, 0x48, 0x28, 0x08,
+  0x08, 0x0A, 0x00, 0x01, 0x01, 0x40, 0xA0, 0x88, 0x44, 0x22, 0x3F, 0x90,
+  0x48, 0x28, 0x08, 0x3A, 0x17, 0x00, 0x01, 0x01, 0x40, 0xA0, 0x88, 0x44,
+  0x22, 0x3F, 0x90, 0x48, 0x28, 0x08, 0x14, 0x00, 0x02, 0x02, 0x81, 0x41,
+  0x10, 0x88, 0x44, 0x7F, 0x20, 0x90, 0x50, 0x10, 0x1C, 0x0A, 0x05, 0x01,
+  0x00, 0x80, 0xA0, 0x50, 0x44, 0x22, 0x3F, 0x90, 0x48, 0x28, 0x08, 0x0F,
+  0xF8, 0x50, 0x04, 0x80, 0x24, 0x02, 0x3F, 0x91, 0x01, 0xF8, 0x08, 0x40,
+  0x42, 0x04, 0x1F, 0xC0, 0x3E, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xC0,
+  0x61, 0x3E, 0x08, 0x04, 0x1C, 0x20, 0x20, 0x07, 0xF8, 0x10, 0x20, 0x7F,
+  0x81, 0x02, 0x04, 0x0F, 0xE0, 0x08, 0x20, 0x07, 0xF8, 0x10, 0x20, 0x7F,
+  0x81, 0x02, 0x04, 0x0F, 0xE0, 0x18, 0x48, 0x07, 0xF8, 0x10, 0x20, 0x7F,
+  0x81, 0x02, 0x04, 0x0F, 0xE0, 0x28, 0x03, 0xFC, 0x08, 0x10, 0x3F, 0xC0,
+  0x81, 0x02, 0x07, 0xF0, 0x92, 0xAA, 0xAA, 0x80, 0x24, 0x08, 0x88, 0x88,
+  0x88, 0x88, 0x80, 0x76, 0xC0, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x00,
+  0xA1, 0x24, 0x92, 0x49, 0x20, 0x7E, 0x10, 0x64, 0x09, 0x01, 0xF0, 0x50,
+  0x14, 0x05, 0x02, 0x41, 0x9F, 0x80, 0x34, 0x2C, 0x00, 0xC1, 0xC1, 0xA1,
+  0x91, 0x91, 0x89, 0x89, 0x85, 0x83, 0x83, 0x10, 0x04, 0x00, 0x07, 0xC6,
+  0x36, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0x70, 0x6C, 0x63, 0xE0, 0x04, 0x04,
+  0x00, 0x07, 0xC6, 0x36, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0x70, 0x6C, 0x63,
+  0xE0, 0x08, 0x0A, 0x00, 0x07, 0xC6, 0x36, 0x0E, 0x03, 0x01, 0x80, 0xC0,
+  0x70, 0x6C, 0x63, 0xE0, 0x3A, 0x17, 0x00, 0x07, 0xC6, 0x36, 0x0E, 0x03,
+  0x01, 0x80, 0xC0, 0x70, 0x6C, 0x63, 0xE0, 0x14, 0x00, 0x0F, 0x8C, 0x6C,
+  0x1C, 0x06, 0x03, 0x01, 0x80, 0xE0, 0xD8, 0xC7, 0xC0, 0x81, 0x42, 0x24,
+  0x18, 0x18, 0x24, 0x42, 0x81, 0x3E, 0xB1, 0xB0, 0xD0, 0x98, 0x8C, 0x46,
+  0x42, 0xC2, 0x63, 0x5F, 0x00, 0x10, 0x08, 0x00, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x04, 0x08, 0x00, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x18, 0x24, 0x00, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x24, 0x00, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x04, 0x04, 0x00, 0x18,
+  0x34, 0x11, 0x10, 0x88, 0x28, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x81,
+  0xFA, 0x1C, 0x18, 0x30, 0xFF, 0x40, 0x81, 0x00, 0x79, 0x8A, 0x14, 0xC9,
+  0x12, 0x27, 0x43, 0x83, 0x06, 0xF0, 0x60, 0x81, 0x00, 0x7A, 0x10, 0x5F,
+  0x86, 0x18, 0xDD, 0x0C, 0x21, 0x00, 0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD,
+  0x30, 0xC4, 0x80, 0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD, 0x69, 0x60, 0x1E,
+  0x84, 0x17, 0xE1, 0x86, 0x37, 0x40, 0x48, 0x00, 0x1E, 0x84, 0x17, 0xE1,
+  0x86, 0x37, 0x40, 0x31, 0x24, 0x8C, 0x01, 0xE8, 0x41, 0x7E, 0x18, 0x63,
+  0x74, 0x7B, 0xE8, 0x62, 0x04, 0x17, 0xFF, 0x84, 0x08, 0x40, 0x8A, 0x17,
+  0x1E, 0x39, 0x18, 0x20, 0x82, 0x04, 0x4E, 0x10, 0x23, 0x80, 0x60, 0x40,
+  0x40, 0x03, 0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, 0x0C, 0x10, 0x40,
+  0x03, 0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, 0x10, 0x51, 0x10, 0x03,
+  0xC8, 0xE0, 0xFF, 0x81, 0x01, 0x09, 0xE0, 0x28, 0x00, 0x01, 0xE4, 0x70,
+  0x7F, 0xC0, 0x80, 0x84, 0xF0, 0xC8, 0x82, 0x49, 0x24, 0x90, 0x6A, 0x09,
+  0x24, 0x92, 0x40, 0x22, 0xA2, 0x02, 0x10, 0x84, 0x21, 0x08, 0x40, 0xA0,
+  0x24, 0x92, 0x49, 0x00, 0x2C, 0xE0, 0x21, 0xE4, 0x70, 0x60, 0xC1, 0x82,
+  0x88, 0xE0, 0x74, 0xB8, 0x05, 0xEC, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x08,
+  0x60, 0x40, 0x40, 0x03, 0x88, 0xA0, 0xC1, 0x83, 0x05, 0x11, 0xC0, 0x0C,
+  0x10, 0x40, 0x03, 0x88, 0xA0, 0xC1, 0x83, 0x05, 0x11, 0xC0, 0x10, 0x60,
+  0xA0, 0x03, 0x88, 0xA0, 0xC1, 0x83, 0x05, 0x11, 0xC0, 0x74, 0xB8, 0x01,
+  0xC4, 0x50, 0x60, 0xC1, 0x82, 0x88, 0xE0, 0x28, 0x00, 0x01, 0xC4, 0x50,
+  0x60, 0xC1, 0x82, 0x88, 0xE0, 0x0C, 0x03, 0x00, 0x03, 0xFF, 0x00, 0x03,
+  0x00, 0xC0, 0x3A, 0x8A, 0x2C, 0x99, 0x34, 0x51, 0x5C, 0x60, 0x40, 0x40,
+  0x08, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x0C, 0x10, 0x40, 0x08,
+  0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x10, 0x60, 0xA0, 0x08, 0x30,
+  0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x28, 0x00, 0x04, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x8D, 0xE8, 0x06, 0x08, 0x20, 0x08, 0x30, 0x51, 0x22, 0x28,
+  0x50, 0x40, 0x81, 0x04, 0x30, 0x00, 0x81, 0x02, 0x05, 0xCC, 0x50, 0x60,
+  0xC1, 0x83, 0x8A, 0xE4, 0x08, 0x10, 0x00, 0x28, 0x00, 0x04, 0x18, 0x28,
+  0x91, 0x14, 0x28, 0x20, 0x40, 0x82, 0x18, 0x00 };
+
+const GFXglyph DejaVuSans7pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   1,  10,   5,    2,   -9 },   // 0x21 '!'
+  {     3,   3,   4,   5,    1,   -9 },   // 0x22 '"'
+  {     5,  10,  10,  12,    1,   -9 },   // 0x23 '#'
+  {    18,   7,  13,   9,    1,  -10 },   // 0x24 '$'
+  {    30,  12,  10,  13,    0,   -9 },   // 0x25 '%'
+  {    45,  10,  10,  12,    1,   -9 },   // 0x26 '&'
+  {    58,   1,   4,   3,    1,   -9 },   // 0x27 '''
+  {    59,   3,  12,   5,    1,  -10 },   // 0x28 '('
+  {    64,   3,  12,   5,    1,  -10 },   // 0x29 ')'
+  {    69,   7,   6,   7,    0,   -9 },   // 0x2A '*'
+  {    75,   9,   9,  12,    1,   -8 },   // 0x2B '+'
+  {    86,   2,   3,   4,    1,   -1 },   // 0x2C ','
+  {    87,   4,   1,   5,    1,   -3 },   // 0x2D '-'
+  {    88,   1,   2,   4,    2,   -1 },   // 0x2E '.'
+  {    89,   5,  12,   5,    0,   -9 },   // 0x2F '/'
+  {    97,   7,  10,   9,    1,   -9 },   // 0x30 '0'
+  {   106,   5,  10,   9,    2,   -9 },   // 0x31 '1'
+  {   113,   6,  10,   9,    1,   -9 },   // 0x32 '2'
+  {   121,   7,  10,   9,    1,   -9 },   // 0x33 '3'
+  {   130,   7,  10,   9,    1,   -9 },   // 0x34 '4'
+  {   139,   7,  10,   9,    1,   -9 },   // 0x35 '5'
+  {   148,   7,  10,   9,    1,   -9 },   // 0x36 '6'
+  {   157,   7,  10,   9,    1,   -9 },   // 0x37 '7'
+  {   166,   7,  10,   9,    1,   -9 },   // 0x38 '8'
+  {   175,   7,  10,   9,    1,   -9 },   // 0x39 '9'
+  {   184,   1,   7,   5,    2,   -6 },   // 0x3A ':'
+  {   185,   2,   8,   5,    1,   -6 },   // 0x3B ';'
+  {   187,   9,   8,  12,    1,   -7 },   // 0x3C '<'
+  {   196,   9,   4,  12,    1,   -6 },   // 0x3D '='
+  {   201,   9,   8,  12,    1,   -7 },   // 0x3E '>'
+  {   210,   5,  10,   7,    1,   -9 },   // 0x3F '?'
+  {   217,  12,  12,  14,    1,   -9 },   // 0x40 '@'
+  {   235,   9,  10,   9,    0,   -9 },   // 0x41 'A'
+  {   247,   8,  10,  10,    1,   -9 },   // 0x42 'B'
+  {   257,   8,  10,  10,    1,   -9 },   // 0x43 'C'
+  {   267,   9,  10,  11,    1,   -9 },   // 0x44 'D'
+  {   279,   7,  10,   9,    1,   -9 },   // 0x45 'E'
+  {   288,   6,  10,   8,    1,   -9 },   // 0x46 'F'
+  {   296,   9,  10,  11,    1,   -9 },   // 0x47 'G'
+  {   308,   8,  10,  10,    1,   -9 },   // 0x48 'H'
+  {   318,   1,  10,   3,    1,   -9 },   // 0x49 'I'
+  {   320,   3,  13,   3,   -1,   -9 },   // 0x4A 'J'
+  {   325,   8,  10,   9,    1,   -9 },   // 0x4B 'K'
+  {   335,   6,  10,   7,    1,   -9 },   // 0x4C 'L'
+  {   343,  10,  10,  12,    1,   -9 },   // 0x4D 'M'
+  {   356,   8,  10,  10,    1,   -9 },   // 0x4E 'N'
+  {   366,   9,  10,  11,    1,   -9 },   // 0x4F 'O'
+  {   378,   7,  10,   9,    1,   -9 },   // 0x50 'P'
+  {   387,   9,  12,  11,    1,   -9 },   // 0x51 'Q'
+  {   401,   8,  10,  10,    1,   -9 },   // 0x52 'R'
+  {   411,   7,  10,   9,    1,   -9 },   // 0x53 'S'
+  {   420,   9,  10,   9,    0,   -9 },   // 0x54 'T'
+  {   432,   8,  10,  10,    1,   -9 },   // 0x55 'U'
+  {   442,   9,  10,   9,    0,   -9 },   // 0x56 'V'
+  {   454,  13,  10,  13,    0,   -9 },   // 0x57 'W'
+  {   471,   9,  10,   9,    0,   -9 },   // 0x58 'X'
+  {   483,   9,  10,   9,    0,   -9 },   // 0x59 'Y'
+  {   495,   8,  10,  10,    1,   -9 },   // 0x5A 'Z'
+  {   505,   3,  12,   5,    1,  -10 },   // 0x5B '['
+  {   510,   5,  12,   5,    0,   -9 },   // 0x5C '\'
+  {   518,   3,  12,   5,    1,  -10 },   // 0x5D ']'
+  {   523,   9,   4,  12,    1,   -9 },   // 0x5E '^'
+  {   528,   7,   1,   7,    0,    3 },   // 0x5F '_'
+  {   529,   3,   3,   7,    1,  -11 },   // 0x60 '`'
+  {   531,   6,   8,   8,    1,   -7 },   // 0x61 'a'
+  {   537,   7,  11,   9,    1,  -10 },   // 0x62 'b'
+  {   547,   6,   8,   8,    1,   -7 },   // 0x63 'c'
+  {   553,   7,  11,   9,    1,  -10 },   // 0x64 'd'
+  {   563,   7,   8,   9,    1,   -7 },   // 0x65 'e'
+  {   570,   4,  11,   4,    0,  -10 },   // 0x66 'f'
+  {   576,   7,  11,   9,    1,   -7 },   // 0x67 'g'
+  {   586,   7,  11,   9,    1,  -10 },   // 0x68 'h'
+  {   596,   1,  11,   3,    1,  -10 },   // 0x69 'i'
+  {   598,   3,  14,   3,   -1,  -10 },   // 0x6A 'j'
+  {   604,   7,  11,   8,    1,  -10 },   // 0x6B 'k'
+  {   614,   1,  11,   3,    1,  -10 },   // 0x6C 'l'
+  {   616,  11,   8,  13,    1,   -7 },   // 0x6D 'm'
+  {   627,   7,   8,   9,    1,   -7 },   // 0x6E 'n'
+  {   634,   7,   8,   9,    1,   -7 },   // 0x6F 'o'
+  {   641,   7,  11,   9,    1,   -7 },   // 0x70 'p'
+  {   651,   7,  11,   9,    1,   -7 },   // 0x71 'q'
+  {   661,   4,   8,   5,    1,   -7 },   // 0x72 'r'
+  {   665,   6,   8,   8,    1,   -7 },   // 0x73 's'
+  {   671,   5,  10,   5,    0,   -9 },   // 0x74 't'
+  {   678,   7,   8,   9,    1,   -7 },   // 0x75 'u'
+  {   685,   7,   8,   7,    0,   -7 },   // 0x76 'v'
+  {   692,   9,   8,  11,    1,   -7 },   // 0x77 'w'
+  {   701,   7,   8,   7,    0,   -7 },   // 0x78 'x'
+  {   708,   7,  11,   7,    0,   -7 },   // 0x79 'y'
+  {   718,   6,   8,   8,    1,   -7 },   // 0x7A 'z'
+  {   724,   5,  13,   9,    2,  -10 },   // 0x7B '{'
+  {   733,   1,  14,   5,    2,  -10 },   // 0x7C '|'
+  {   735,   5,  13,   9,    3,  -10 },   // 0x7D '}'
+  {   744,   9,   2,  12,    1,   -4 },   // 0x7E '~'
+  {   747,   7,  12,   8,    1,   -9 },   // 0x7F
+  {   758,   7,  12,   8,    1,   -9 },   // 0x80
+  {   769,   7,  12,   8,    1,   -9 },   // 0x81
+  {   780,   7,  12,   8,    1,   -9 },   // 0x82
+  {   791,   7,  12,   8,    1,   -9 },   // 0x83
+  {   802,   7,  12,   8,    1,   -9 },   // 0x84
+  {   813,   7,  12,   8,    1,   -9 },   // 0x85
+  {   824,   7,  12,   8,    1,   -9 },   // 0x86
+  {   835,   7,  12,   8,    1,   -9 },   // 0x87
+  {   846,   7,  12,   8,    1,   -9 },   // 0x88
+  {   857,   7,  12,   8,    1,   -9 },   // 0x89
+  {   868,   7,  12,   8,    1,   -9 },   // 0x8A
+  {   879,   7,  12,   8,    1,   -9 },   // 0x8B
+  {   890,   7,  12,   8,    1,   -9 },   // 0x8C
+  {   901,   7,  12,   8,    1,   -9 },   // 0x8D
+  {   912,   7,  12,   8,    1,   -9 },   // 0x8E
+  {   923,   7,  12,   8,    1,   -9 },   // 0x8F
+  {   934,   7,  12,   8,    1,   -9 },   // 0x90
+  {   945,   7,  12,   8,    1,   -9 },   // 0x91
+  {   956,   7,  12,   8,    1,   -9 },   // 0x92
+  {   967,   7,  12,   8,    1,   -9 },   // 0x93
+  {   978,   7,  12,   8,    1,   -9 },   // 0x94
+  {   989,   7,  12,   8,    1,   -9 },   // 0x95
+  {  1000,   7,  12,   8,    1,   -9 },   // 0x96
+  {  1011,   7,  12,   8,    1,   -9 },   // 0x97
+  {  1022,   7,  12,   8,    1,   -9 },   // 0x98
+  {  1033,   7,  12,   8,    1,   -9 },   // 0x99
+  {  1044,   7,  12,   8,    1,   -9 },   // 0x9A
+  {  1055,   7,  12,   8,    1,   -9 },   // 0x9B
+  {  1066,   7,  12,   8,    1,   -9 },   // 0x9C
+  {  1077,   7,  12,   8,    1,   -9 },   // 0x9D
+  {  1088,   7,  12,   8,    1,   -9 },   // 0x9E
+  {  1099,   7,  12,   8,    1,   -9 },   // 0x9F
+  {  1110,   1,   1,   4,    0,    0 },   // 0xA0
+  {  1111,   1,  10,   5,    2,   -7 },   // 0xA1
+  {  1113,   6,  12,   9,    1,   -9 },   // 0xA2
+  {  1122,   7,  10,   9,    1,   -9 },   // 0xA3
+  {  1131,   8,   8,   9,    1,   -7 },   // 0xA4
+  {  1139,   7,  10,   9,    1,   -9 },   // 0xA5
+  {  1148,   1,  12,   5,    2,   -9 },   // 0xA6
+  {  1150,   6,  11,   7,    0,   -9 },   // 0xA7
+  {  1159,   3,   1,   7,    2,  -10 },   // 0xA8
+  {  1160,  10,  10,  14,    2,   -9 },   // 0xA9
+  {  1173,   5,   8,   7,    1,   -9 },   // 0xAA
+  {  1178,   6,   6,   9,    1,   -6 },   // 0xAB
+  {  1183,   9,   4,  12,    1,   -5 },   // 0xAC
+  {  1188,   4,   1,   5,    1,   -3 },   // 0xAD
+  {  1189,  10,  10,  14,    2,   -9 },   // 0xAE
+  {  1202,   4,   1,   7,    1,  -10 },   // 0xAF
+  {  1203,   4,   4,   7,    1,   -9 },   // 0xB0
+  {  1205,   9,   9,  12,    1,   -8 },   // 0xB1
+  {  1216,   4,   6,   6,    1,   -9 },   // 0xB2
+  {  1219,   4,   6,   6,    1,   -9 },   // 0xB3
+  {  1222,   3,   3,   7,    3,  -11 },   // 0xB4
+  {  1224,   8,  11,   9,    1,   -7 },   // 0xB5
+  {  1235,   6,  11,   9,    1,   -9 },   // 0xB6
+  {  1244,   1,   2,   4,    2,   -5 },   // 0xB7
+  {  1245,   3,   3,   7,    2,    1 },   // 0xB8
+  {  1247,   3,   6,   6,    1,   -9 },   // 0xB9
+  {  1250,   5,   8,   7,    1,   -9 },   // 0xBA
+  {  1255,   6,   6,   9,    1,   -6 },   // 0xBB
+  {  1260,  12,  10,  14,    1,   -9 },   // 0xBC
+  {  1275,  12,  11,  14,    1,   -9 },   // 0xBD
+  {  1292,  12,  10,  14,    1,   -9 },   // 0xBE
+  {  1307,   5,  11,   7,    1,   -7 },   // 0xBF
+  {  1314,   9,  13,   9,    0,  -12 },   // 0xC0
+  {  1329,   9,  13,   9,    0,  -12 },   // 0xC1
+  {  1344,   9,  13,   9,    0,  -12 },   // 0xC2
+  {  1359,   9,  13,   9,    0,  -12 },   // 0xC3
+  {  1374,   9,  12,   9,    0,  -11 },   // 0xC4
+  {  1388,   9,  13,   9,    0,  -12 },   // 0xC5
+  {  1403,  13,  10,  14,    0,   -9 },   // 0xC6
+  {  1420,   8,  13,  10,    1,   -9 },   // 0xC7
+  {  1433,   7,  13,   9,    1,  -12 },   // 0xC8
+  {  1445,   7,  13,   9,    1,  -12 },   // 0xC9
+  {  1457,   7,  13,   9,    1,  -12 },   // 0xCA
+  {  1469,   7,  12,   9,    1,  -11 },   // 0xCB
+  {  1480,   2,  13,   3,    1,  -12 },   // 0xCC
+  {  1484,   4,  13,   3,    1,  -12 },   // 0xCD
+  {  1491,   5,  13,   3,   -1,  -12 },   // 0xCE
+  {  1500,   3,  12,   3,    0,  -11 },   // 0xCF
+  {  1505,  10,  10,  11,    0,   -9 },   // 0xD0
+  {  1518,   8,  13,  10,    1,  -12 },   // 0xD1
+  {  1531,   9,  13,  11,    1,  -12 },   // 0xD2
+  {  1546,   9,  13,  11,    1,  -12 },   // 0xD3
+  {  1561,   9,  13,  11,    1,  -12 },   // 0xD4
+  {  1576,   9,  13,  11,    1,  -12 },   // 0xD5
+  {  1591,   9,  12,  11,    1,  -11 },   // 0xD6
+  {  1605,   8,   8,  12,    2,   -7 },   // 0xD7
+  {  1613,   9,  10,  11,    1,   -9 },   // 0xD8
+  {  1625,   8,  13,  10,    1,  -12 },   // 0xD9
+  {  1638,   8,  13,  10,    1,  -12 },   // 0xDA
+  {  1651,   8,  13,  10,    1,  -12 },   // 0xDB
+  {  1664,   8,  12,  10,    1,  -11 },   // 0xDC
+  {  1676,   9,  13,   9,    0,  -12 },   // 0xDD
+  {  1691,   7,  10,   9,    1,   -9 },   // 0xDE
+  {  1700,   7,  11,   9,    1,  -10 },   // 0xDF
+  {  1710,   6,  12,   8,    1,  -11 },   // 0xE0
+  {  1719,   6,  12,   8,    1,  -11 },   // 0xE1
+  {  1728,   6,  12,   8,    1,  -11 },   // 0xE2
+  {  1737,   6,  11,   8,    1,  -10 },   // 0xE3
+  {  1746,   6,  11,   8,    1,  -10 },   // 0xE4
+  {  1755,   6,  13,   8,    1,  -12 },   // 0xE5
+  {  1765,  12,   8,  14,    1,   -7 },   // 0xE6
+  {  1777,   6,  11,   8,    1,   -7 },   // 0xE7
+  {  1786,   7,  12,   9,    1,  -11 },   // 0xE8
+  {  1797,   7,  12,   9,    1,  -11 },   // 0xE9
+  {  1808,   7,  12,   9,    1,  -11 },   // 0xEA
+  {  1819,   7,  11,   9,    1,  -10 },   // 0xEB
+  {  1829,   3,  12,   3,   -1,  -11 },   // 0xEC
+  {  1834,   3,  12,   3,    1,  -11 },   // 0xED
+  {  1839,   5,  12,   3,   -1,  -11 },   // 0xEE
+  {  1847,   3,  11,   3,    0,  -10 },   // 0xEF
+  {  1852,   7,  11,   9,    1,  -10 },   // 0xF0
+  {  1862,   7,  11,   9,    1,  -10 },   // 0xF1
+  {  1872,   7,  12,   9,    1,  -11 },   // 0xF2
+  {  1883,   7,  12,   9,    1,  -11 },   // 0xF3
+  {  1894,   7,  12,   9,    1,  -11 },   // 0xF4
+  {  1905,   7,  11,   9,    1,  -10 },   // 0xF5
+  {  1915,   7,  11,   9,    1,  -10 },   // 0xF6
+  {  1925,  10,   7,  12,    1,   -7 },   // 0xF7
+  {  1934,   7,   8,   9,    1,   -7 },   // 0xF8
+  {  1941,   7,  12,   9,    1,  -11 },   // 0xF9
+  {  1952,   7,  12,   9,    1,  -11 },   // 0xFA
+  {  1963,   7,  12,   9,    1,  -11 },   // 0xFB
+  {  1974,   7,  11,   9,    1,  -10 },   // 0xFC
+  {  1984,   7,  15,   7,    0,  -11 },   // 0xFD
+  {  1998,   7,  14,   9,    1,  -10 },   // 0xFE
+  {  2011,   7,  14,   7,    0,  -10 } }; // 0xFF
+
+const GFXfont DejaVuSans7pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans7pt8bBitmaps,
+  (GFXglyph *)DejaVuSans7pt8bGlyphs,
+  0x20, 0xFF, 16 };
+
+// Approx. 3599 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans7pt8bMetrics[] PROGMEM = {
+  {   0,   4,   1 },   // 0x20
+  {   2,   5,   3 },   // 0x21
+  {   1,   5,   4 },   // 0x22
+  {   1,  12,  11 },   // 0x23
+  {   1,   9,   8 },   // 0x24
+  {   0,  13,  12 },   // 0x25
+  {   1,  12,  11 },   // 0x26
+  {   1,   3,   2 },   // 0x27
+  {   1,   5,   4 },   // 0x28
+  {   1,   5,   4 },   // 0x29
+  {   0,   7,   7 },   // 0x2A
+  {   1,  12,  10 },   // 0x2B
+  {   1,   4,   3 },   // 0x2C
+  {   1,   5,   5 },   // 0x2D
+  {   2,   4,   3 },   // 0x2E
+  {   0,   5,   5 },   // 0x2F
+  {   1,   9,   8 },   // 0x30
+  {   2,   9,   7 },   // 0x31
+  {   1,   9,   7 },   // 0x32
+  {   1,   9,   8 },   // 0x33
+  {   1,   9,   8 },   // 0x34
+  {   1,   9,   8 },   // 0x35
+  {   1,   9,   8 },   // 0x36
+  {   1,   9,   8 },   // 0x37
+  {   1,   9,   8 },   // 0x38
+  {   1,   9,   8 },   // 0x39
+  {   2,   5,   3 },   // 0x3A
+  {   1,   5,   3 },   // 0x3B
+  {   1,  12,  10 },   // 0x3C
+  {   1,  12,  10 },   // 0x3D
+  {   1,  12,  10 },   // 0x3E
+  {   1,   7,   6 },   // 0x3F
+  {   1,  14,  13 },   // 0x40
+  {   0,   9,   9 },   // 0x41
+  {   1,  10,   9 },   // 0x42
+  {   1,  10,   9 },   // 0x43
+  {   1,  11,  10 },   // 0x44
+  {   1,   9,   8 },   // 0x45
+  {   1,   8,   7 },   // 0x46
+  {   1,  11,  10 },   // 0x47
+  {   1,  10,   9 },   // 0x48
+  {   1,   3,   2 },   // 0x49
+  {  -1,   3,   2 },   // 0x4A
+  {   1,   9,   9 },   // 0x4B
+  {   1,   7,   7 },   // 0x4C
+  {   1,  12,  11 },   // 0x4D
+  {   1,  10,   9 },   // 0x4E
+  {   1,  11,  10 },   // 0x4F
+  {   1,   9,   8 },   // 0x50
+  {   1,  11,  10 },   // 0x51
+  {   1,  10,   9 },   // 0x52
+  {   1,   9,   8 },   // 0x53
+  {   0,   9,   9 },   // 0x54
+  {   1,  10,   9 },   // 0x55
+  {   0,   9,   9 },   // 0x56
+  {   0,  13,  13 },   // 0x57
+  {   0,   9,   9 },   // 0x58
+  {   0,   9,   9 },   // 0x59
+  {   1,  10,   9 },   // 0x5A
+  {   1,   5,   4 },   // 0x5B
+  {   0,   5,   5 },   // 0x5C
+  {   1,   5,   4 },   // 0x5D
+  {   1,  12,  10 },   // 0x5E
+  {   0,   7,   7 },   // 0x5F
+  {   1,   7,   4 },   // 0x60
+  {   1,   8,   7 },   // 0x61
+  {   1,   9,   8 },   // 0x62
+  {   1,   8,   7 },   // 0x63
+  {   1,   9,   8 },   // 0x64
+  {   1,   9,   8 },   // 0x65
+  {   0,   4,   4 },   // 0x66
+  {   1,   9,   8 },   // 0x67
+  {   1,   9,   8 },   // 0x68
+  {   1,   3,   2 },   // 0x69
+  {  -1,   3,   2 },   // 0x6A
+  {   1,   8,   8 },   // 0x6B
+  {   1,   3,   2 },   // 0x6C
+  {   1,  13,  12 },   // 0x6D
+  {   1,   9,   8 },   // 0x6E
+  {   1,   9,   8 },   // 0x6F
+  {   1,   9,   8 },   // 0x70
+  {   1,   9,   8 },   // 0x71
+  {   1,   5,   5 },   // 0x72
+  {   1,   8,   7 },   // 0x73
+  {   0,   5,   5 },   // 0x74
+  {   1,   9,   8 },   // 0x75
+  {   0,   7,   7 },   // 0x76
+  {   1,  11,  10 },   // 0x77
+  {   0,   7,   7 },   // 0x78
+  {   0,   7,   7 },   // 0x79
+  {   1,   8,   7 },   // 0x7A
+  {   2,   9,   7 },   // 0x7B
+  {   2,   5,   3 },   // 0x7C
+  {   3,   9,   8 },   // 0x7D
+  {   1,  12,  10 },   // 0x7E
+  {   1,   8,   8 },   // 0x7F
+  {   1,   8,   8 },   // 0x80
+  {   1,   8,   8 },   // 0x81
+  {   1,   8,   8 },   // 0x82
+  {   1,   8,   8 },   // 0x83
+  {   1,   8,   8 },   // 0x84
+  {   1,   8,   8 },   // 0x85
+  {   1,   8,   8 },   // 0x86
+  {   1,   8,   8 },   // 0x87
+  {   1,   8,   8 },   // 0x88
+  {   1,   8,   8 },   // 0x89
+  {   1,   8,   8 },   // 0x8A
+  {   1,   8,   8 },   // 0x8B
+  {   1,   8,   8 },   // 0x8C
+  {   1,   8,   8 },   // 0x8D
+  {   1,   8,   8 },   // 0x8E
+  {   1,   8,   8 },   // 0x8F
+  {   1,   8,   8 },   // 0x90
+  {   1,   8,   8 },   // 0x91
+  {   1,   8,   8 },   // 0x92
+  {   1,   8,   8 },   // 0x93
+  {   1,   8,   8 },   // 0x94
+  {   1,   8,   8 },   // 0x95
+  {   1,   8,   8 },   // 0x96
+  {   1,   8,   8 },   // 0x97
+  {   1,   8,   8 },   // 0x98
+  {   1,   8,   8 },   // 0x99
+  {   1,   8,   8 },   // 0x9A
+  {   1,   8,   8 },   // 0x9B
+  {   1,   8,   8 },   // 0x9C
+  {   1,   8,   8 },   // 0x9D
+  {   1,   8,   8 },   // 0x9E
+  {   1,   8,   8 },   // 0x9F
+  {   0,   4,   1 },   // 0xA0
+  {   2,   5,   3 },   // 0xA1
+  {   1,   9,   7 },   // 0xA2
+  {   1,   9,   8 },   // 0xA3
+  {   1,   9,   9 },   // 0xA4
+  {   1,   9,   8 },   // 0xA5
+  {   2,   5,   3 },   // 0xA6
+  {   0,   7,   6 },   // 0xA7
+  {   2,   7,   5 },   // 0xA8
+  {   2,  14,  12 },   // 0xA9
+  {   1,   7,   6 },   // 0xAA
+  {   1,   9,   7 },   // 0xAB
+  {   1,  12,  10 },   // 0xAC
+  {   1,   5,   5 },   // 0xAD
+  {   2,  14,  12 },   // 0xAE
+  {   1,   7,   5 },   // 0xAF
+  {   1,   7,   5 },   // 0xB0
+  {   1,  12,  10 },   // 0xB1
+  {   1,   6,   5 },   // 0xB2
+  {   1,   6,   5 },   // 0xB3
+  {   3,   7,   6 },   // 0xB4
+  {   1,   9,   9 },   // 0xB5
+  {   1,   9,   7 },   // 0xB6
+  {   2,   4,   3 },   // 0xB7
+  {   2,   7,   5 },   // 0xB8
+  {   1,   6,   4 },   // 0xB9
+  {   1,   7,   6 },   // 0xBA
+  {   1,   9,   7 },   // 0xBB
+  {   1,  14,  13 },   // 0xBC
+  {   1,  14,  13 },   // 0xBD
+  {   1,  14,  13 },   // 0xBE
+  {   1,   7,   6 },   // 0xBF
+  {   0,   9,   9 },   // 0xC0
+  {   0,   9,   9 },   // 0xC1
+  {   0,   9,   9 },   // 0xC2
+  {   0,   9,   9 },   // 0xC3
+  {   0,   9,   9 },   // 0xC4
+  {   0,   9,   9 },   // 0xC5
+  {   0,  14,  13 },   // 0xC6
+  {   1,  10,   9 },   // 0xC7
+  {   1,   9,   8 },   // 0xC8
+  {   1,   9,   8 },   // 0xC9
+  {   1,   9,   8 },   // 0xCA
+  {   1,   9,   8 },   // 0xCB
+  {   1,   3,   3 },   // 0xCC
+  {   1,   3,   5 },   // 0xCD
+  {  -1,   3,   4 },   // 0xCE
+  {   0,   3,   3 },   // 0xCF
+  {   0,  11,  10 },   // 0xD0
+  {   1,  10,   9 },   // 0xD1
+  {   1,  11,  10 },   // 0xD2
+  {   1,  11,  10 },   // 0xD3
+  {   1,  11,  10 },   // 0xD4
+  {   1,  11,  10 },   // 0xD5
+  {   1,  11,  10 },   // 0xD6
+  {   2,  12,  10 },   // 0xD7
+  {   1,  11,  10 },   // 0xD8
+  {   1,  10,   9 },   // 0xD9
+  {   1,  10,   9 },   // 0xDA
+  {   1,  10,   9 },   // 0xDB
+  {   1,  10,   9 },   // 0xDC
+  {   0,   9,   9 },   // 0xDD
+  {   1,   9,   8 },   // 0xDE
+  {   1,   9,   8 },   // 0xDF
+  {   1,   8,   7 },   // 0xE0
+  {   1,   8,   7 },   // 0xE1
+  {   1,   8,   7 },   // 0xE2
+  {   1,   8,   7 },   // 0xE3
+  {   1,   8,   7 },   // 0xE4
+  {   1,   8,   7 },   // 0xE5
+  {   1,  14,  13 },   // 0xE6
+  {   1,   8,   7 },   // 0xE7
+  {   1,   9,   8 },   // 0xE8
+  {   1,   9,   8 },   // 0xE9
+  {   1,   9,   8 },   // 0xEA
+  {   1,   9,   8 },   // 0xEB
+  {  -1,   3,   2 },   // 0xEC
+  {   1,   3,   4 },   // 0xED
+  {  -1,   3,   4 },   // 0xEE
+  {   0,   3,   3 },   // 0xEF
+  {   1,   9,   8 },   // 0xF0
+  {   1,   9,   8 },   // 0xF1
+  {   1,   9,   8 },   // 0xF2
+  {   1,   9,   8 },   // 0xF3
+  {   1,   9,   8 },   // 0xF4
+  {   1,   9,   8 },   // 0xF5
+  {   1,   9,   8 },   // 0xF6
+  {   1,  12,  11 },   // 0xF7
+  {   1,   9,   8 },   // 0xF8
+  {   1,   9,   8 },   // 0xF9
+  {   1,   9,   8 },   // 0xFA
+  {   1,   9,   8 },   // 0xFB
+  {   1,   9,   8 },   // 0xFC
+  {   0,   7,   7 },   // 0xFD
+  {   1,   9,   8 },   // 0xFE
+  {   0,   7,   7 }    // 0xFF
+};
+const FontMetrics DejaVuSans7pt8bWidths = { DejaVuSans7pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS7PTLAT1__H
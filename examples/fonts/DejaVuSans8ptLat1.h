@@ -0,0 +1,688 @@
+#ifndef DEJAVUSANS8PTLAT1__H
+#define DEJAVUSANS8PTLAT1__H
+const uint8_t DejaVuSans8pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0x30, 0x99, 0x99, 0x0C, 0x81, 0x10, 0x26, 0x3F, 0xF1, 0x90,
+  0x22, 0x04, 0xC7, 0xFE, 0x32, 0x04, 0x40, 0x98, 0x00, 0x10, 0x21, 0xF6,
+  0x99, 0x12, 0x1C, 0x0E, 0x12, 0x26, 0x5B, 0xE1, 0x02, 0x00, 0x70, 0x44,
+  0x42, 0x22, 0x21, 0x13, 0x08, 0x90, 0x39, 0x00, 0x09, 0xC0, 0x91, 0x0C,
+  0x88, 0x44, 0x44, 0x22, 0x20, 0xE0, 0x3C, 0x0C, 0x41, 0x00, 0x20, 0x02,
+  0x00, 0xA0, 0x22, 0x14, 0x22, 0x82, 0x50, 0x31, 0x06, 0x1F, 0x20, 0xF0,
+  0x36, 0x44, 0x88, 0x88, 0x88, 0x44, 0x63, 0xC6, 0x22, 0x11, 0x11, 0x11,
+  0x22, 0x6C, 0x10, 0x22, 0x4B, 0xE3, 0x9A, 0xC4, 0x08, 0x08, 0x04, 0x02,
+  0x01, 0x0F, 0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0x56, 0xF0, 0xC0, 0x08,
+  0x44, 0x21, 0x10, 0x84, 0x42, 0x11, 0x88, 0x00, 0x3C, 0x42, 0x42, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x3C, 0x71, 0xA0, 0x40, 0x81,
+  0x02, 0x04, 0x08, 0x10, 0x20, 0x47, 0xF0, 0x79, 0x8A, 0x08, 0x10, 0x20,
+  0x82, 0x08, 0x20, 0x82, 0x07, 0xF0, 0x7C, 0x83, 0x01, 0x01, 0x03, 0x3C,
+  0x03, 0x01, 0x01, 0x01, 0x82, 0x7C, 0x06, 0x05, 0x02, 0x82, 0x42, 0x22,
+  0x11, 0x09, 0x04, 0xFF, 0x81, 0x00, 0x80, 0x40, 0x7E, 0x40, 0x40, 0x40,
+  0x7C, 0x42, 0x01, 0x01, 0x01, 0x01, 0x82, 0x7C, 0x1C, 0x62, 0x40, 0x80,
+  0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0xFF, 0x01, 0x02, 0x02,
+  0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x3C, 0xC3, 0x81, 0x81,
+  0xC3, 0x3C, 0xC3, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x3C, 0x42, 0x82, 0x81,
+  0x81, 0x81, 0x43, 0x3D, 0x01, 0x02, 0x46, 0x38, 0xC3, 0x50, 0x05, 0x60,
+  0x00, 0x40, 0xE1, 0xC1, 0xC0, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0x40,
+  0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x40,
+  0xE0, 0xE1, 0xC0, 0x80, 0x00, 0x7A, 0x10, 0x41, 0x0C, 0x63, 0x08, 0x20,
+  0x02, 0x08, 0x0F, 0xC0, 0x60, 0xC2, 0x01, 0x91, 0xEA, 0xC8, 0x66, 0x40,
+  0x99, 0x02, 0x64, 0x09, 0x90, 0x27, 0x21, 0xA4, 0x7B, 0x08, 0x00, 0x18,
+  0x30, 0x1F, 0x80, 0x04, 0x00, 0x80, 0x28, 0x05, 0x01, 0x10, 0x22, 0x08,
+  0x21, 0x04, 0x3F, 0x88, 0x09, 0x01, 0x40, 0x10, 0xFE, 0x40, 0xE0, 0x30,
+  0x18, 0x1F, 0xFA, 0x07, 0x01, 0x80, 0xC0, 0x60, 0x5F, 0xC0, 0x1F, 0x10,
+  0xD0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x20, 0x08, 0x63, 0xE0,
+  0xFE, 0x20, 0xC8, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x28, 0x33, 0xF8, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xFF, 0xFF, 0x02, 0x04, 0x08, 0x1F, 0xA0, 0x40, 0x81, 0x02,
+  0x04, 0x00, 0x1F, 0x88, 0x34, 0x06, 0x00, 0x80, 0x20, 0x08, 0x3E, 0x01,
+  0x80, 0x50, 0x12, 0x04, 0x7E, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF8, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xFF, 0xF0, 0x24, 0x92,
+  0x49, 0x24, 0x92, 0x70, 0x81, 0x41, 0x21, 0x11, 0x09, 0x07, 0x02, 0x81,
+  0x20, 0x88, 0x42, 0x20, 0x90, 0x20, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20,
+  0x40, 0x81, 0x02, 0x07, 0xF0, 0xC0, 0x78, 0x0E, 0x82, 0xD0, 0x5A, 0x0B,
+  0x22, 0x64, 0x4C, 0x51, 0x8A, 0x30, 0x86, 0x00, 0xC0, 0x10, 0xC0, 0x68,
+  0x1A, 0x06, 0x41, 0x88, 0x62, 0x18, 0x46, 0x09, 0x82, 0x60, 0x58, 0x16,
+  0x03, 0x1F, 0x04, 0x11, 0x01, 0x40, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x28, 0x08, 0x82, 0x0F, 0x80, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x82,
+  0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x04, 0x11, 0x01, 0x40, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x28, 0x08, 0x83, 0x0F, 0x80, 0x08,
+  0x00, 0x80, 0xFC, 0x20, 0x88, 0x12, 0x04, 0x81, 0x20, 0x8F, 0xE2, 0x08,
+  0x81, 0x20, 0x48, 0x0A, 0x02, 0x3C, 0xC6, 0x80, 0x80, 0x80, 0x70, 0x1E,
+  0x03, 0x01, 0x81, 0xC3, 0x7C, 0xFF, 0x84, 0x02, 0x01, 0x00, 0x80, 0x40,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x14, 0x08, 0xFC, 0x80, 0x30,
+  0x05, 0x01, 0x20, 0x22, 0x08, 0x41, 0x04, 0x40, 0x88, 0x11, 0x01, 0x40,
+  0x28, 0x02, 0x00, 0x81, 0x03, 0x02, 0x05, 0x0A, 0x12, 0x14, 0x24, 0x28,
+  0x44, 0x51, 0x09, 0x12, 0x12, 0x24, 0x14, 0x50, 0x28, 0xA0, 0x20, 0x80,
+  0x41, 0x00, 0xC1, 0xA0, 0x88, 0x84, 0x41, 0x40, 0x40, 0x20, 0x28, 0x22,
+  0x11, 0x10, 0x50, 0x10, 0x80, 0xA0, 0x88, 0x84, 0x41, 0x40, 0x40, 0x20,
+  0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0xFF, 0xC0, 0x10, 0x08, 0x04, 0x02,
+  0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x03, 0xFF, 0xF2, 0x49, 0x24,
+  0x92, 0x49, 0xC0, 0x86, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x80,
+  0xE4, 0x92, 0x49, 0x24, 0x93, 0xC0, 0x0C, 0x07, 0x82, 0x11, 0x02, 0xFF,
+  0xC6, 0x30, 0x3C, 0x8C, 0x0B, 0xFC, 0x30, 0x60, 0xE3, 0x7A, 0x80, 0x80,
+  0x80, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2, 0xBC, 0x3C, 0x86,
+  0x04, 0x08, 0x10, 0x20, 0x21, 0x3C, 0x01, 0x01, 0x01, 0x3D, 0x43, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x38, 0x8A, 0x0C, 0x1F, 0xF0, 0x20,
+  0x21, 0x3C, 0x3A, 0x11, 0xE4, 0x21, 0x08, 0x42, 0x10, 0x80, 0x3D, 0x43,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x42, 0x3C, 0x80, 0x80,
+  0x80, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xDF, 0xF0,
+  0x24, 0x12, 0x49, 0x24, 0x92, 0x70, 0x80, 0x80, 0x80, 0x82, 0x84, 0x88,
+  0x90, 0xE0, 0x90, 0x88, 0x84, 0x82, 0xFF, 0xF0, 0xBC, 0xF6, 0x38, 0xE0,
+  0x83, 0x04, 0x18, 0x20, 0xC1, 0x06, 0x08, 0x30, 0x41, 0x82, 0x08, 0xBC,
+  0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x3C, 0x42, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x42, 0x3C, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xC2, 0xBC, 0x80, 0x80, 0x80, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x43, 0x3D, 0x01, 0x01, 0x01, 0xBE, 0x21, 0x08, 0x42, 0x10, 0x80, 0x7D,
+  0x06, 0x06, 0x07, 0x80, 0xC0, 0xC1, 0x7C, 0x42, 0x3E, 0x84, 0x21, 0x08,
+  0x42, 0x0E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x80,
+  0xA0, 0x24, 0x11, 0x04, 0x22, 0x08, 0x81, 0x40, 0x70, 0x08, 0x00, 0x82,
+  0x0C, 0x10, 0x51, 0x44, 0x8A, 0x24, 0x89, 0x14, 0x50, 0xA2, 0x82, 0x08,
+  0x10, 0x40, 0xC3, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0xC3, 0x80,
+  0xA0, 0x90, 0x44, 0x22, 0x21, 0x10, 0x50, 0x28, 0x0C, 0x04, 0x02, 0x0E,
+  0x00, 0xFE, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40, 0xFE, 0x19, 0x08, 0x42,
+  0x10, 0x98, 0x21, 0x08, 0x42, 0x10, 0x60, 0xFF, 0xFF, 0xC1, 0x08, 0x42,
+  0x10, 0x83, 0x21, 0x08, 0x42, 0x13, 0x00, 0x78, 0x61, 0xE0, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0xFF, 0x00, 0xCF, 0xF0, 0x08, 0x10, 0xF3, 0x58, 0x91,
+  0x22, 0x44, 0x88, 0xD4, 0xF0, 0x40, 0x80, 0x1C, 0x64, 0x81, 0x02, 0x04,
+  0x3F, 0x10, 0x20, 0x40, 0x87, 0xF0, 0x80, 0xBF, 0x98, 0xC8, 0x24, 0x12,
+  0x09, 0x8C, 0xFE, 0x80, 0x80, 0x80, 0xA0, 0x90, 0x44, 0x41, 0x43, 0xB8,
+  0x20, 0x10, 0x7F, 0x04, 0x02, 0x01, 0x00, 0xFC, 0xFC, 0x3C, 0x81, 0x03,
+  0x07, 0x91, 0xA0, 0xE1, 0x62, 0x78, 0x30, 0x20, 0x4F, 0x00, 0x99, 0x0F,
+  0x03, 0x0C, 0x4F, 0x24, 0x82, 0x90, 0x19, 0x01, 0x90, 0x19, 0x01, 0x48,
+  0x24, 0xF2, 0x30, 0xC0, 0xF0, 0x78, 0x17, 0xE1, 0x8D, 0xD0, 0x3F, 0x11,
+  0x33, 0x44, 0x88, 0x44, 0x33, 0x11, 0xFF, 0xC0, 0x10, 0x04, 0x01, 0x00,
+  0x40, 0xF0, 0x0F, 0x03, 0x0C, 0x4F, 0x24, 0x8A, 0x88, 0x98, 0xF1, 0x89,
+  0x18, 0x99, 0x48, 0xA4, 0x8E, 0x30, 0xC0, 0xF0, 0xF8, 0x74, 0x63, 0x17,
+  0x00, 0x08, 0x04, 0x02, 0x1F, 0xF0, 0x80, 0x40, 0x20, 0x00, 0x00, 0x7F,
+  0xC0, 0xF0, 0x42, 0x22, 0x23, 0xE0, 0xF0, 0x42, 0xE0, 0x87, 0xC0, 0x36,
+  0xC0, 0x81, 0x40, 0xA0, 0x50, 0x28, 0x14, 0x0A, 0x05, 0x86, 0xBD, 0xC0,
+  0x20, 0x10, 0x00, 0x3E, 0xF7, 0xEF, 0xDF, 0xAF, 0x4E, 0x85, 0x0A, 0x14,
+  0x28, 0x50, 0xA1, 0x40, 0xC0, 0x47, 0x80, 0xE1, 0x08, 0x42, 0x13, 0xE0,
+  0x7B, 0x38, 0x61, 0xCD, 0xE0, 0x3F, 0x88, 0xCC, 0x22, 0x11, 0x22, 0xCC,
+  0x88, 0xE0, 0x61, 0x02, 0x08, 0x20, 0x41, 0x02, 0x10, 0x11, 0x0B, 0xE8,
+  0xC0, 0x8A, 0x08, 0x50, 0x44, 0x84, 0x3E, 0x60, 0x20, 0xE0, 0x60, 0x81,
+  0x02, 0x08, 0x08, 0x20, 0x21, 0x00, 0x89, 0xEF, 0xA0, 0x41, 0x01, 0x08,
+  0x08, 0x20, 0x41, 0x02, 0x0C, 0x1F, 0xF0, 0x60, 0x42, 0x02, 0x20, 0xE1,
+  0x00, 0x90, 0x05, 0x0B, 0xC8, 0xC0, 0x8A, 0x08, 0x50, 0x44, 0x84, 0x3E,
+  0x60, 0x20, 0x10, 0x40, 0x04, 0x10, 0xC6, 0x30, 0x82, 0x08, 0x5E, 0x18,
+  0x01, 0x80, 0x00, 0x02, 0x00, 0x40, 0x14, 0x02, 0x80, 0x88, 0x11, 0x04,
+  0x10, 0x82, 0x1F, 0xC4, 0x04, 0x80, 0xA0, 0x08, 0x06, 0x01, 0x80, 0x00,
+  0x02, 0x00, 0x40, 0x14, 0x02, 0x80, 0x88, 0x11, 0x04, 0x10, 0x82, 0x1F,
+  0xC4, 0x04, 0x80, 0xA0, 0x08, 0x0E, 0x03, 0x60, 0x00, 0x02, 0x00, 0x40,
+  0x14, 0x02, 0x80, 0x88, 0x11, 0x04, 0x10, 0x82, 0x1F, 0xC4, 0x04, 0x80,
+  0xA0, 0x08, 0x1D, 0x02, 0xE0, 0x00, 0x02, 0x00, 0x40, 0x14, 0x02, 0x80,
+  0x88, 0x11, 0x04, 0x10, 0x82, 0x1F, 0xC4, 0x04, 0x80, 0xA0, 0x08, 0x0A,
+  0x01, 0x40, 0x00, 0x02, 0x00, 0x40, 0x14, 0x02, 0x80, 0x88, 0x11, 0x04,
+  0x10, 0x82, 0x1F, 0xC4, 0x04, 0x80, 0xA0, 0x08, 0x0E, 0x02, 0x20, 0x44,
+  0x07, 0x00, 0xA0, 0x22, 0x04, 0x40, 0x88, 0x20, 0x84, 0x11, 0x01, 0x3F,
+  0xE4, 0x05, 0x00, 0x60, 0x08, 0x07, 0xFE, 0x12, 0x00, 0x24, 0x00, 0x88,
+  0x01, 0x10, 0x02, 0x3F, 0xC8, 0x40, 0x10, 0x80, 0x7F, 0x00, 0x82, 0x01,
+  0x04, 0x04, 0x0F, 0xF0, 0x1F, 0x10, 0xD0, 0x10, 0x08, 0x04, 0x02, 0x01,
+  0x00, 0x80, 0x20, 0x08, 0x63, 0xE0, 0x80, 0x20, 0x70, 0x30, 0x18, 0x00,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+  0x0C, 0x18, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xFF, 0x1C, 0x36, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x24, 0x24, 0x00, 0xFF, 0x80, 0x80,
+  0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xCC, 0x12, 0x49,
+  0x24, 0x92, 0x48, 0x78, 0x24, 0x92, 0x49, 0x24, 0x90, 0x76, 0xC0, 0x42,
+  0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80, 0x8C, 0x40, 0x42, 0x10, 0x84,
+  0x21, 0x08, 0x42, 0x10, 0x80, 0x3F, 0x82, 0x0C, 0x20, 0x22, 0x01, 0x20,
+  0x1F, 0xC1, 0x20, 0x12, 0x01, 0x20, 0x12, 0x02, 0x20, 0xC3, 0xF8, 0x1A,
+  0x05, 0x80, 0x03, 0x01, 0xA0, 0x68, 0x19, 0x06, 0x21, 0x88, 0x61, 0x18,
+  0x26, 0x09, 0x81, 0x60, 0x58, 0x0C, 0x18, 0x01, 0x80, 0x00, 0x0F, 0x82,
+  0x08, 0x80, 0xA0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x14, 0x04,
+  0x41, 0x07, 0xC0, 0x06, 0x01, 0x80, 0x00, 0x0F, 0x82, 0x08, 0x80, 0xA0,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x14, 0x04, 0x41, 0x07, 0xC0,
+  0x0E, 0x03, 0x60, 0x00, 0x0F, 0x82, 0x08, 0x80, 0xA0, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x14, 0x04, 0x41, 0x07, 0xC0, 0x1D, 0x02, 0xE0,
+  0x00, 0x0F, 0x82, 0x08, 0x80, 0xA0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x14, 0x04, 0x41, 0x07, 0xC0, 0x0A, 0x01, 0x40, 0x00, 0x0F, 0x82,
+  0x08, 0x80, 0xA0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x14, 0x04,
+  0x41, 0x07, 0xC0, 0x80, 0xA0, 0x88, 0x82, 0x80, 0x80, 0xA0, 0x88, 0x82,
+  0x80, 0x80, 0x1F, 0x24, 0x19, 0x03, 0x40, 0x98, 0x23, 0x08, 0x61, 0x0C,
+  0x41, 0x90, 0x2C, 0x09, 0x82, 0x4F, 0x80, 0x18, 0x03, 0x00, 0x02, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50,
+  0x23, 0xF0, 0x06, 0x03, 0x00, 0x02, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50, 0x23, 0xF0, 0x0C, 0x04, 0x80,
+  0x02, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x50, 0x23, 0xF0, 0x12, 0x04, 0x80, 0x02, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50, 0x23, 0xF0, 0x06,
+  0x06, 0x00, 0x10, 0x14, 0x11, 0x10, 0x88, 0x28, 0x08, 0x04, 0x02, 0x01,
+  0x00, 0x80, 0x40, 0x20, 0x80, 0x80, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x82,
+  0xFC, 0x80, 0x80, 0x80, 0x7C, 0xC6, 0x82, 0x8E, 0x90, 0x90, 0x98, 0x8E,
+  0x83, 0x81, 0x81, 0xBE, 0x60, 0x60, 0x60, 0x03, 0xC8, 0xC0, 0xBF, 0xC3,
+  0x06, 0x0E, 0x37, 0xA0, 0x06, 0x18, 0x60, 0x03, 0xC8, 0xC0, 0xBF, 0xC3,
+  0x06, 0x0E, 0x37, 0xA0, 0x10, 0x51, 0x10, 0x03, 0xC8, 0xC0, 0xBF, 0xC3,
+  0x06, 0x0E, 0x37, 0xA0, 0x74, 0xB8, 0x01, 0xE4, 0x60, 0x5F, 0xE1, 0x83,
+  0x07, 0x1B, 0xD0, 0x24, 0x48, 0x01, 0xE4, 0x60, 0x5F, 0xE1, 0x83, 0x07,
+  0x1B, 0xD0, 0x18, 0x48, 0x90, 0xC0, 0x07, 0x91, 0x81, 0x7F, 0x86, 0x0C,
+  0x1C, 0x6F, 0x40, 0x3D, 0xF1, 0x1C, 0x20, 0x20, 0x5F, 0x81, 0xC3, 0xFE,
+  0x08, 0x08, 0x20, 0x31, 0x41, 0x78, 0xF8, 0x3C, 0x86, 0x04, 0x08, 0x10,
+  0x20, 0x21, 0x3C, 0x20, 0x21, 0xC0, 0x60, 0x60, 0x60, 0x03, 0x88, 0xA0,
+  0xC1, 0xFF, 0x02, 0x02, 0x13, 0xC0, 0x06, 0x18, 0x60, 0x03, 0x88, 0xA0,
+  0xC1, 0xFF, 0x02, 0x02, 0x13, 0xC0, 0x10, 0x51, 0x10, 0x03, 0x88, 0xA0,
+  0xC1, 0xFF, 0x02, 0x02, 0x13, 0xC0, 0x24, 0x48, 0x01, 0xC4, 0x50, 0x60,
+  0xFF, 0x81, 0x01, 0x09, 0xE0, 0xC6, 0x30, 0x22, 0x22, 0x22, 0x22, 0x20,
+  0x36, 0xC0, 0x88, 0x88, 0x88, 0x88, 0x80, 0x22, 0xA2, 0x02, 0x10, 0x84,
+  0x21, 0x08, 0x42, 0x00, 0x8C, 0x40, 0x42, 0x10, 0x84, 0x21, 0x08, 0x40,
+  0x6C, 0x30, 0xCC, 0x3E, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C,
+  0x74, 0x5C, 0x00, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x60, 0x30, 0x18, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42,
+  0x3C, 0x06, 0x0C, 0x18, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0x18, 0x18, 0x24, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x34, 0x2C, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x24, 0x24, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x0C, 0x03, 0x00, 0x03, 0xFF, 0x00, 0x03, 0x00, 0xC0,
+  0x00, 0x3D, 0x42, 0x85, 0x89, 0x89, 0x91, 0xA1, 0x42, 0xBC, 0x00, 0x60,
+  0x30, 0x18, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D,
+  0x06, 0x0C, 0x18, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43,
+  0x3D, 0x18, 0x18, 0x24, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x43, 0x3D, 0x24, 0x24, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x43, 0x3D, 0x03, 0x03, 0x03, 0x00, 0x08, 0x0A, 0x09, 0x04, 0x42, 0x22,
+  0x11, 0x05, 0x02, 0x80, 0xC0, 0x40, 0x20, 0xE0, 0x80, 0x80, 0x80, 0xBC,
+  0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2, 0xBC, 0x80, 0x80, 0x80, 0x14,
+  0x0A, 0x00, 0x10, 0x14, 0x12, 0x08, 0x84, 0x44, 0x22, 0x0A, 0x05, 0x01,
+  0x80, 0x80, 0x41, 0xC0 };
+
+const GFXglyph DejaVuSans8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   1,  12,   6,    2,  -11 },   // 0x21 '!'
+  {     3,   4,   4,   6,    1,  -11 },   // 0x22 '"'
+  {     5,  11,  11,  13,    1,  -10 },   // 0x23 '#'
+  {    21,   7,  14,  10,    2,  -11 },   // 0x24 '$'
+  {    34,  13,  12,  15,    1,  -11 },   // 0x25 '%'
+  {    54,  11,  12,  12,    1,  -11 },   // 0x26 '&'
+  {    71,   1,   4,   3,    1,  -11 },   // 0x27 '''
+  {    72,   4,  14,   6,    1,  -11 },   // 0x28 '('
+  {    79,   4,  14,   6,    1,  -11 },   // 0x29 ')'
+  {    86,   7,   8,   8,    1,  -11 },   // 0x2A '*'
+  {    93,   9,   9,  13,    2,   -8 },   // 0x2B '+'
+  {   104,   2,   4,   5,    1,   -1 },   // 0x2C ','
+  {   105,   4,   1,   6,    1,   -4 },   // 0x2D '-'
+  {   106,   1,   2,   5,    2,   -1 },   // 0x2E '.'
+  {   107,   5,  13,   5,    0,  -11 },   // 0x2F '/'
+  {   116,   8,  12,  10,    1,  -11 },   // 0x30 '0'
+  {   128,   7,  12,  10,    2,  -11 },   // 0x31 '1'
+  {   139,   7,  12,  10,    1,  -11 },   // 0x32 '2'
+  {   150,   8,  12,  10,    1,  -11 },   // 0x33 '3'
+  {   162,   9,  12,  10,    1,  -11 },   // 0x34 '4'
+  {   176,   8,  12,  10,    1,  -11 },   // 0x35 '5'
+  {   188,   8,  12,  10,    1,  -11 },   // 0x36 '6'
+  {   200,   8,  12,  10,    1,  -11 },   // 0x37 '7'
+  {   212,   8,  12,  10,    1,  -11 },   // 0x38 '8'
+  {   224,   8,  12,  10,    1,  -11 },   // 0x39 '9'
+  {   236,   1,   8,   5,    2,   -7 },   // 0x3A ':'
+  {   237,   2,  10,   5,    1,   -7 },   // 0x3B ';'
+  {   240,  10,   9,  13,    2,   -8 },   // 0x3C '<'
+  {   252,  10,   4,  13,    2,   -6 },   // 0x3D '='
+  {   257,  10,   9,  13,    2,   -8 },   // 0x3E '>'
+  {   269,   6,  12,   9,    1,  -11 },   // 0x3F '?'
+  {   278,  14,  14,  16,    1,  -11 },   // 0x40 '@'
+  {   303,  11,  12,  11,    0,  -11 },   // 0x41 'A'
+  {   320,   9,  12,  11,    1,  -11 },   // 0x42 'B'
+  {   334,   9,  12,  11,    1,  -11 },   // 0x43 'C'
+  {   348,  10,  12,  12,    1,  -11 },   // 0x44 'D'
+  {   363,   8,  12,  10,    1,  -11 },   // 0x45 'E'
+  {   375,   7,  12,   9,    1,  -11 },   // 0x46 'F'
+  {   386,  10,  12,  12,    1,  -11 },   // 0x47 'G'
+  {   401,  10,  12,  12,    1,  -11 },   // 0x48 'H'
+  {   416,   1,  12,   5,    2,  -11 },   // 0x49 'I'
+  {   418,   3,  15,   5,    0,  -11 },   // 0x4A 'J'
+  {   424,   9,  12,  10,    1,  -11 },   // 0x4B 'K'
+  {   438,   7,  12,   9,    1,  -11 },   // 0x4C 'L'
+  {   449,  11,  12,  13,    1,  -11 },   // 0x4D 'M'
+  {   466,  10,  12,  12,    1,  -11 },   // 0x4E 'N'
+  {   481,  11,  12,  13,    1,  -11 },   // 0x4F 'O'
+  {   498,   8,  12,  10,    1,  -11 },   // 0x50 'P'
+  {   510,  11,  14,  13,    1,  -11 },   // 0x51 'Q'
+  {   530,  10,  12,  11,    1,  -11 },   // 0x52 'R'
+  {   545,   8,  12,  10,    1,  -11 },   // 0x53 'S'
+  {   557,   9,  12,   9,    0,  -11 },   // 0x54 'T'
+  {   571,  10,  12,  12,    1,  -11 },   // 0x55 'U'
+  {   586,  11,  12,  11,    0,  -11 },   // 0x56 'V'
+  {   603,  15,  12,  17,    1,  -11 },   // 0x57 'W'
+  {   626,   9,  12,  11,    1,  -11 },   // 0x58 'X'
+  {   640,   9,  12,   9,    0,  -11 },   // 0x59 'Y'
+  {   654,  10,  12,  12,    1,  -11 },   // 0x5A 'Z'
+  {   669,   3,  14,   6,    1,  -11 },   // 0x5B '['
+  {   675,   5,  13,   5,    0,  -11 },   // 0x5C '\'
+  {   684,   3,  14,   6,    2,  -11 },   // 0x5D ']'
+  {   690,  10,   4,  13,    2,  -11 },   // 0x5E '^'
+  {   695,   8,   1,   8,    0,    4 },   // 0x5F '_'
+  {   696,   4,   3,   8,    1,  -12 },   // 0x60 '`'
+  {   698,   7,   9,   9,    1,   -8 },   // 0x61 'a'
+  {   706,   8,  12,  10,    1,  -11 },   // 0x62 'b'
+  {   718,   7,   9,   9,    1,   -8 },   // 0x63 'c'
+  {   726,   8,  12,  10,    1,  -11 },   // 0x64 'd'
+  {   738,   7,   9,   9,    1,   -8 },   // 0x65 'e'
+  {   746,   5,  12,   6,    1,  -11 },   // 0x66 'f'
+  {   754,   8,  12,  10,    1,   -8 },   // 0x67 'g'
+  {   766,   8,  12,  10,    1,  -11 },   // 0x68 'h'
+  {   778,   1,  12,   3,    1,  -11 },   // 0x69 'i'
+  {   780,   3,  15,   3,   -1,  -11 },   // 0x6A 'j'
+  {   786,   8,  12,   9,    1,  -11 },   // 0x6B 'k'
+  {   798,   1,  12,   3,    1,  -11 },   // 0x6C 'l'
+  {   800,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
+  {   815,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   824,   8,   9,  10,    1,   -8 },   // 0x6F 'o'
+  {   833,   8,  12,  10,    1,   -8 },   // 0x70 'p'
+  {   845,   8,  12,  10,    1,   -8 },   // 0x71 'q'
+  {   857,   5,   9,   7,    1,   -8 },   // 0x72 'r'
+  {   863,   7,   9,   9,    1,   -8 },   // 0x73 's'
+  {   871,   5,  11,   6,    0,  -10 },   // 0x74 't'
+  {   878,   8,   9,  10,    1,   -8 },   // 0x75 'u'
+  {   887,  10,   9,   9,    0,   -8 },   // 0x76 'v'
+  {   899,  13,   9,  13,    0,   -8 },   // 0x77 'w'
+  {   914,   8,   9,  10,    1,   -8 },   // 0x78 'x'
+  {   923,   9,  12,   9,    0,   -8 },   // 0x79 'y'
+  {   937,   7,   9,   9,    1,   -8 },   // 0x7A 'z'
+  {   945,   5,  15,  10,    2,  -11 },   // 0x7B '{'
+  {   955,   1,  16,   5,    2,  -11 },   // 0x7C '|'
+  {   957,   5,  15,  10,    2,  -11 },   // 0x7D '}'
+  {   967,  10,   2,  13,    2,   -5 },   // 0x7E '~'
+  {   970,   8,  14,  10,    1,  -10 },   // 0x7F
+  {   984,   8,  14,  10,    1,  -10 },   // 0x80
+  {   998,   8,  14,  10,    1,  -10 },   // 0x81
+  {  1012,   8,  14,  10,    1,  -10 },   // 0x82
+  {  1026,   8,  14,  10,    1,  -10 },   // 0x83
+  {  1040,   8,  14,  10,    1,  -10 },   // 0x84
+  {  1054,   8,  14,  10,    1,  -10 },   // 0x85
+  {  1068,   8,  14,  10,    1,  -10 },   // 0x86
+  {  1082,   8,  14,  10,    1,  -10 },   // 0x87
+  {  1096,   8,  14,  10,    1,  -10 },   // 0x88
+  {  1110,   8,  14,  10,    1,  -10 },   // 0x89
+  {  1124,   8,  14,  10,    1,  -10 },   // 0x8A
+  {  1138,   8,  14,  10,    1,  -10 },   // 0x8B
+  {  1152,   8,  14,  10,    1,  -10 },   // 0x8C
+  {  1166,   8,  14,  10,    1,  -10 },   // 0x8D
+  {  1180,   8,  14,  10,    1,  -10 },   // 0x8E
+  {  1194,   8,  14,  10,    1,  -10 },   // 0x8F
+  {  1208,   8,  14,  10,    1,  -10 },   // 0x90
+  {  1222,   8,  14,  10,    1,  -10 },   // 0x91
+  {  1236,   8,  14,  10,    1,  -10 },   // 0x92
+  {  1250,   8,  14,  10,    1,  -10 },   // 0x93
+  {  1264,   8,  14,  10,    1,  -10 },   // 0x94
+  {  1278,   8,  14,  10,    1,  -10 },   // 0x95
+  {  1292,   8,  14,  10,    1,  -10 },   // 0x96
+  {  1306,   8,  14,  10,    1,  -10 },   // 0x97
+  {  1320,   8,  14,  10,    1,  -10 },   // 0x98
+  {  1334,   8,  14,  10,    1,  -10 },   // 0x99
+  {  1348,   8,  14,  10,    1,  -10 },   // 0x9A
+  {  1362,   8,  14,  10,    1,  -10 },   // 0x9B
+  {  1376,   8,  14,  10,    1,  -10 },   // 0x9C
+  {  1390,   8,  14,  10,    1,  -10 },   // 0x9D
+  {  1404,   8,  14,  10,    1,  -10 },   // 0x9E
+  {  1418,   8,  14,  10,    1,  -10 },   // 0x9F
+  {  1432,   1,   1,   5,    0,    0 },   // 0xA0
+  {  1433,   1,  12,   6,    3,   -8 },   // 0xA1
+  {  1435,   7,  13,  10,    1,  -10 },   // 0xA2
+  {  1447,   7,  12,  10,    1,  -11 },   // 0xA3
+  {  1458,   9,   9,  10,    1,   -8 },   // 0xA4
+  {  1469,   9,  12,  10,    0,  -11 },   // 0xA5
+  {  1483,   1,  14,   5,    2,  -10 },   // 0xA6
+  {  1485,   7,  14,   8,    1,  -11 },   // 0xA7
+  {  1498,   4,   2,   8,    2,  -11 },   // 0xA8
+  {  1499,  12,  12,  16,    2,  -11 },   // 0xA9
+  {  1517,   6,   8,   8,    1,  -11 },   // 0xAA
+  {  1523,   8,   7,  10,    1,   -7 },   // 0xAB
+  {  1530,  10,   5,  13,    2,   -6 },   // 0xAC
+  {  1537,   4,   1,   6,    1,   -4 },   // 0xAD
+  {  1538,  12,  12,  16,    2,  -11 },   // 0xAE
+  {  1556,   5,   1,   8,    2,  -11 },   // 0xAF
+  {  1557,   5,   5,   8,    2,  -11 },   // 0xB0
+  {  1561,   9,  10,  13,    2,   -9 },   // 0xB1
+  {  1573,   5,   7,   6,    1,  -11 },   // 0xB2
+  {  1578,   5,   7,   6,    1,  -11 },   // 0xB3
+  {  1583,   4,   3,   8,    3,  -12 },   // 0xB4
+  {  1585,   9,  12,  10,    1,   -8 },   // 0xB5
+  {  1599,   7,  14,  10,    1,  -11 },   // 0xB6
+  {  1612,   1,   2,   5,    2,   -6 },   // 0xB7
+  {  1613,   3,   3,   8,    2,    1 },   // 0xB8
+  {  1615,   5,   7,   6,    1,  -11 },   // 0xB9
+  {  1620,   6,   8,   8,    1,  -11 },   // 0xBA
+  {  1626,   8,   7,  10,    2,   -7 },   // 0xBB
+  {  1633,  13,  12,  16,    1,  -11 },   // 0xBC
+  {  1653,  14,  12,  16,    1,  -11 },   // 0xBD
+  {  1674,  13,  12,  16,    1,  -11 },   // 0xBE
+  {  1694,   6,  12,   9,    2,   -8 },   // 0xBF
+  {  1703,  11,  15,  11,    0,  -14 },   // 0xC0
+  {  1724,  11,  15,  11,    0,  -14 },   // 0xC1
+  {  1745,  11,  15,  11,    0,  -14 },   // 0xC2
+  {  1766,  11,  15,  11,    0,  -14 },   // 0xC3
+  {  1787,  11,  15,  11,    0,  -14 },   // 0xC4
+  {  1808,  11,  15,  11,    0,  -14 },   // 0xC5
+  {  1829,  15,  12,  16,    0,  -11 },   // 0xC6
+  {  1852,   9,  15,  11,    1,  -11 },   // 0xC7
+  {  1869,   8,  15,  10,    1,  -14 },   // 0xC8
+  {  1884,   8,  15,  10,    1,  -14 },   // 0xC9
+  {  1899,   8,  15,  10,    1,  -14 },   // 0xCA
+  {  1914,   8,  15,  10,    1,  -14 },   // 0xCB
+  {  1929,   3,  15,   5,    0,  -14 },   // 0xCC
+  {  1935,   3,  15,   5,    1,  -14 },   // 0xCD
+  {  1941,   5,  15,   5,    0,  -14 },   // 0xCE
+  {  1951,   5,  15,   5,    0,  -14 },   // 0xCF
+  {  1961,  12,  12,  13,    0,  -11 },   // 0xD0
+  {  1979,  10,  15,  12,    1,  -14 },   // 0xD1
+  {  1998,  11,  15,  13,    1,  -14 },   // 0xD2
+  {  2019,  11,  15,  13,    1,  -14 },   // 0xD3
+  {  2040,  11,  15,  13,    1,  -14 },   // 0xD4
+  {  2061,  11,  15,  13,    1,  -14 },   // 0xD5
+  {  2082,  11,  15,  13,    1,  -14 },   // 0xD6
+  {  2103,   9,   9,  13,    2,   -9 },   // 0xD7
+  {  2114,  11,  12,  13,    1,  -11 },   // 0xD8
+  {  2131,  10,  15,  12,    1,  -14 },   // 0xD9
+  {  2150,  10,  15,  12,    1,  -14 },   // 0xDA
+  {  2169,  10,  15,  12,    1,  -14 },   // 0xDB
+  {  2188,  10,  15,  12,    1,  -14 },   // 0xDC
+  {  2207,   9,  15,   9,    0,  -14 },   // 0xDD
+  {  2224,   8,  12,  10,    1,  -11 },   // 0xDE
+  {  2236,   8,  12,  10,    1,  -11 },   // 0xDF
+  {  2248,   7,  13,   9,    1,  -12 },   // 0xE0
+  {  2260,   7,  13,   9,    1,  -12 },   // 0xE1
+  {  2272,   7,  13,   9,    1,  -12 },   // 0xE2
+  {  2284,   7,  12,   9,    1,  -11 },   // 0xE3
+  {  2295,   7,  12,   9,    1,  -11 },   // 0xE4
+  {  2306,   7,  14,   9,    1,  -13 },   // 0xE5
+  {  2319,  14,   9,  16,    1,   -8 },   // 0xE6
+  {  2335,   7,  12,   9,    1,   -8 },   // 0xE7
+  {  2346,   7,  13,   9,    1,  -12 },   // 0xE8
+  {  2358,   7,  13,   9,    1,  -12 },   // 0xE9
+  {  2370,   7,  13,   9,    1,  -12 },   // 0xEA
+  {  2382,   7,  12,   9,    1,  -11 },   // 0xEB
+  {  2393,   4,  13,   3,   -1,  -12 },   // 0xEC
+  {  2400,   4,  13,   3,    1,  -12 },   // 0xED
+  {  2407,   5,  13,   3,   -1,  -12 },   // 0xEE
+  {  2416,   5,  12,   3,   -1,  -11 },   // 0xEF
+  {  2424,   8,  12,  10,    1,  -11 },   // 0xF0
+  {  2436,   8,  12,  10,    1,  -11 },   // 0xF1
+  {  2448,   8,  13,  10,    1,  -12 },   // 0xF2
+  {  2461,   8,  13,  10,    1,  -12 },   // 0xF3
+  {  2474,   8,  13,  10,    1,  -12 },   // 0xF4
+  {  2487,   8,  12,  10,    1,  -11 },   // 0xF5
+  {  2499,   8,  12,  10,    1,  -11 },   // 0xF6
+  {  2511,  10,   7,  13,    2,   -7 },   // 0xF7
+  {  2520,   8,  11,  10,    1,   -9 },   // 0xF8
+  {  2531,   8,  13,  10,    1,  -12 },   // 0xF9
+  {  2544,   8,  13,  10,    1,  -12 },   // 0xFA
+  {  2557,   8,  13,  10,    1,  -12 },   // 0xFB
+  {  2570,   8,  12,  10,    1,  -11 },   // 0xFC
+  {  2582,   9,  16,   9,    0,  -12 },   // 0xFD
+  {  2600,   8,  15,  10,    1,  -11 },   // 0xFE
+  {  2615,   9,  15,   9,    0,  -11 } }; // 0xFF
+
+const GFXfont DejaVuSans8pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans8pt8bBitmaps,
+  (GFXglyph *)DejaVuSans8pt8bGlyphs,
+  0x20, 0xFF, 18 };
+
+// Approx. 4207 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans8pt8bMetrics[] PROGMEM = {
+  {   0,   5,   1 },   // 0x20
+  {   2,   6,   3 },   // 0x21
+  {   1,   6,   5 },   // 0x22
+  {   1,  13,  12 },   // 0x23
+  {   2,  10,   9 },   // 0x24
+  {   1,  15,  14 },   // 0x25
+  {   1,  12,  12 },   // 0x26
+  {   1,   3,   2 },   // 0x27
+  {   1,   6,   5 },   // 0x28
+  {   1,   6,   5 },   // 0x29
+  {   1,   8,   8 },   // 0x2A
+  {   2,  13,  11 },   // 0x2B
+  {   1,   5,   3 },   // 0x2C
+  {   1,   6,   5 },   // 0x2D
+  {   2,   5,   3 },   // 0x2E
+  {   0,   5,   5 },   // 0x2F
+  {   1,  10,   9 },   // 0x30
+  {   2,  10,   9 },   // 0x31
+  {   1,  10,   8 },   // 0x32
+  {   1,  10,   9 },   // 0x33
+  {   1,  10,  10 },   // 0x34
+  {   1,  10,   9 },   // 0x35
+  {   1,  10,   9 },   // 0x36
+  {   1,  10,   9 },   // 0x37
+  {   1,  10,   9 },   // 0x38
+  {   1,  10,   9 },   // 0x39
+  {   2,   5,   3 },   // 0x3A
+  {   1,   5,   3 },   // 0x3B
+  {   2,  13,  12 },   // 0x3C
+  {   2,  13,  12 },   // 0x3D
+  {   2,  13,  12 },   // 0x3E
+  {   1,   9,   7 },   // 0x3F
+  {   1,  16,  15 },   // 0x40
+  {   0,  11,  11 },   // 0x41
+  {   1,  11,  10 },   // 0x42
+  {   1,  11,  10 },   // 0x43
+  {   1,  12,  11 },   // 0x44
+  {   1,  10,   9 },   // 0x45
+  {   1,   9,   8 },   // 0x46
+  {   1,  12,  11 },   // 0x47
+  {   1,  12,  11 },   // 0x48
+  {   2,   5,   3 },   // 0x49
+  {   0,   5,   3 },   // 0x4A
+  {   1,  10,  10 },   // 0x4B
+  {   1,   9,   8 },   // 0x4C
+  {   1,  13,  12 },   // 0x4D
+  {   1,  12,  11 },   // 0x4E
+  {   1,  13,  12 },   // 0x4F
+  {   1,  10,   9 },   // 0x50
+  {   1,  13,  12 },   // 0x51
+  {   1,  11,  11 },   // 0x52
+  {   1,  10,   9 },   // 0x53
+  {   0,   9,   9 },   // 0x54
+  {   1,  12,  11 },   // 0x55
+  {   0,  11,  11 },   // 0x56
+  {   1,  17,  16 },   // 0x57
+  {   1,  11,  10 },   // 0x58
+  {   0,   9,   9 },   // 0x59
+  {   1,  12,  11 },   // 0x5A
+  {   1,   6,   4 },   // 0x5B
+  {   0,   5,   5 },   // 0x5C
+  {   2,   6,   5 },   // 0x5D
+  {   2,  13,  12 },   // 0x5E
+  {   0,   8,   8 },   // 0x5F
+  {   1,   8,   5 },   // 0x60
+  {   1,   9,   8 },   // 0x61
+  {   1,  10,   9 },   // 0x62
+  {   1,   9,   8 },   // 0x63
+  {   1,  10,   9 },   // 0x64
+  {   1,   9,   8 },   // 0x65
+  {   1,   6,   6 },   // 0x66
+  {   1,  10,   9 },   // 0x67
+  {   1,  10,   9 },   // 0x68
+  {   1,   3,   2 },   // 0x69
+  {  -1,   3,   2 },   // 0x6A
+  {   1,   9,   9 },   // 0x6B
+  {   1,   3,   2 },   // 0x6C
+  {   1,  15,  14 },   // 0x6D
+  {   1,  10,   9 },   // 0x6E
+  {   1,  10,   9 },   // 0x6F
+  {   1,  10,   9 },   // 0x70
+  {   1,  10,   9 },   // 0x71
+  {   1,   7,   6 },   // 0x72
+  {   1,   9,   8 },   // 0x73
+  {   0,   6,   5 },   // 0x74
+  {   1,  10,   9 },   // 0x75
+  {   0,   9,  10 },   // 0x76
+  {   0,  13,  13 },   // 0x77
+  {   1,  10,   9 },   // 0x78
+  {   0,   9,   9 },   // 0x79
+  {   1,   9,   8 },   // 0x7A
+  {   2,  10,   7 },   // 0x7B
+  {   2,   5,   3 },   // 0x7C
+  {   2,  10,   7 },   // 0x7D
+  {   2,  13,  12 },   // 0x7E
+  {   1,  10,   9 },   // 0x7F
+  {   1,  10,   9 },   // 0x80
+  {   1,  10,   9 },   // 0x81
+  {   1,  10,   9 },   // 0x82
+  {   1,  10,   9 },   // 0x83
+  {   1,  10,   9 },   // 0x84
+  {   1,  10,   9 },   // 0x85
+  {   1,  10,   9 },   // 0x86
+  {   1,  10,   9 },   // 0x87
+  {   1,  10,   9 },   // 0x88
+  {   1,  10,   9 },   // 0x89
+  {   1,  10,   9 },   // 0x8A
+  {   1,  10,   9 },   // 0x8B
+  {   1,  10,   9 },   // 0x8C
+  {   1,  10,   9 },   // 0x8D
+  {   1,  10,   9 },   // 0x8E
+  {   1,  10,   9 },   // 0x8F
+  {   1,  10,   9 },   // 0x90
+  {   1,  10,   9 },   // 0x91
+  {   1,  10,   9 },   // 0x92
+  {   1,  10,   9 },   // 0x93
+  {   1,  10,   9 },   // 0x94
+  {   1,  10,   9 },   // 0x95
+  {   1,  10,   9 },   // 0x96
+  {   1,  10,   9 },   // 0x97
+  {   1,  10,   9 },   // 0x98
+  {   1,  10,   9 },   // 0x99
+  {   1,  10,   9 },   // 0x9A
+  {   1,  10,   9 },   // 0x9B
+  {   1,  10,   9 },   // 0x9C
+  {   1,  10,   9 },   // 0x9D
+  {   1,  10,   9 },   // 0x9E
+  {   1,  10,   9 },   // 0x9F
+  {   0,   5,   1 },   // 0xA0
+  {   3,   6,   4 },   // 0xA1
+  {   1,  10,   8 },   // 0xA2
+  {   1,  10,   8 },   // 0xA3
+  {   1,  10,  10 },   // 0xA4
+  {   0,  10,   9 },   // 0xA5
+  {   2,   5,   3 },   // 0xA6
+  {   1,   8,   8 },   // 0xA7
+  {   2,   8,   6 },   // 0xA8
+  {   2,  16,  14 },   // 0xA9
+  {   1,   8,   7 },   // 0xAA
+  {   1,  10,   9 },   // 0xAB
+  {   2,  13,  12 },   // 0xAC
+  {   1,   6,   5 },   // 0xAD
+  {   2,  16,  14 },   // 0xAE
+  {   2,   8,   7 },   // 0xAF
+  {   2,   8,   7 },   // 0xB0
+  {   2,  13,  11 },   // 0xB1
+  {   1,   6,   6 },   // 0xB2
+  {   1,   6,   6 },   // 0xB3
+  {   3,   8,   7 },   // 0xB4
+  {   1,  10,  10 },   // 0xB5
+  {   1,  10,   8 },   // 0xB6
+  {   2,   5,   3 },   // 0xB7
+  {   2,   8,   5 },   // 0xB8
+  {   1,   6,   6 },   // 0xB9
+  {   1,   8,   7 },   // 0xBA
+  {   2,  10,  10 },   // 0xBB
+  {   1,  16,  14 },   // 0xBC
+  {   1,  16,  15 },   // 0xBD
+  {   1,  16,  14 },   // 0xBE
+  {   2,   9,   8 },   // 0xBF
+  {   0,  11,  11 },   // 0xC0
+  {   0,  11,  11 },   // 0xC1
+  {   0,  11,  11 },   // 0xC2
+  {   0,  11,  11 },   // 0xC3
+  {   0,  11,  11 },   // 0xC4
+  {   0,  11,  11 },   // 0xC5
+  {   0,  16,  15 },   // 0xC6
+  {   1,  11,  10 },   // 0xC7
+  {   1,  10,   9 },   // 0xC8
+  {   1,  10,   9 },   // 0xC9
+  {   1,  10,   9 },   // 0xCA
+  {   1,  10,   9 },   // 0xCB
+  {   0,   5,   3 },   // 0xCC
+  {   1,   5,   4 },   // 0xCD
+  {   0,   5,   5 },   // 0xCE
+  {   0,   5,   5 },   // 0xCF
+  {   0,  13,  12 },   // 0xD0
+  {   1,  12,  11 },   // 0xD1
+  {   1,  13,  12 },   // 0xD2
+  {   1,  13,  12 },   // 0xD3
+  {   1,  13,  12 },   // 0xD4
+  {   1,  13,  12 },   // 0xD5
+  {   1,  13,  12 },   // 0xD6
+  {   2,  13,  11 },   // 0xD7
+  {   1,  13,  12 },   // 0xD8
+  {   1,  12,  11 },   // 0xD9
+  {   1,  12,  11 },   // 0xDA
+  {   1,  12,  11 },   // 0xDB
+  {   1,  12,  11 },   // 0xDC
+  {   0,   9,   9 },   // 0xDD
+  {   1,  10,   9 },   // 0xDE
+  {   1,  10,   9 },   // 0xDF
+  {   1,   9,   8 },   // 0xE0
+  {   1,   9,   8 },   // 0xE1
+  {   1,   9,   8 },   // 0xE2
+  {   1,   9,   8 },   // 0xE3
+  {   1,   9,   8 },   // 0xE4
+  {   1,   9,   8 },   // 0xE5
+  {   1,  16,  15 },   // 0xE6
+  {   1,   9,   8 },   // 0xE7
+  {   1,   9,   8 },   // 0xE8
+  {   1,   9,   8 },   // 0xE9
+  {   1,   9,   8 },   // 0xEA
+  {   1,   9,   8 },   // 0xEB
+  {  -1,   3,   3 },   // 0xEC
+  {   1,   3,   5 },   // 0xED
+  {  -1,   3,   4 },   // 0xEE
+  {  -1,   3,   4 },   // 0xEF
+  {   1,  10,   9 },   // 0xF0
+  {   1,  10,   9 },   // 0xF1
+  {   1,  10,   9 },   // 0xF2
+  {   1,  10,   9 },   // 0xF3
+  {   1,  10,   9 },   // 0xF4
+  {   1,  10,   9 },   // 0xF5
+  {   1,  10,   9 },   // 0xF6
+  {   2,  13,  12 },   // 0xF7
+  {   1,  10,   9 },   // 0xF8
+  {   1,  10,   9 },   // 0xF9
+  {   1,  10,   9 },   // 0xFA
+  {   1,  10,   9 },   // 0xFB
+  {   1,  10,   9 },   // 0xFC
+  {   0,   9,   9 },   // 0xFD
+  {   1,  10,   9 },   // 0xFE
+  {   0,   9,   9 }    // 0xFF
+};
+const FontMetrics DejaVuSans8pt8bWidths = { DejaVuSans8pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANS8PTLAT1__H
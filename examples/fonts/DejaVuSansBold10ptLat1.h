@@ -0,0 +1,855 @@
+#ifndef DEJAVUSANSBOLD10PTLAT1__H
+#define DEJAVUSANSBOLD10PTLAT1__H
+const uint8_t DejaVuSans_Bold10pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xCF, 0x3C, 0xF3,
+  0xCC, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x98, 0x7F, 0xFD, 0xFF, 0xF0,
+  0xCE, 0x03, 0x30, 0x18, 0xC3, 0xFF, 0xEF, 0xFF, 0x86, 0x60, 0x39, 0x80,
+  0xC6, 0x03, 0x18, 0x00, 0x06, 0x00, 0x60, 0x1F, 0xC7, 0xFE, 0xE6, 0x2E,
+  0x60, 0xF6, 0x0F, 0xF8, 0x7F, 0xE1, 0xFF, 0x06, 0xF0, 0x67, 0x86, 0x7F,
+  0xFE, 0x3F, 0xC0, 0x60, 0x06, 0x00, 0x60, 0x3C, 0x06, 0x0F, 0xC1, 0x83,
+  0x9C, 0x70, 0x61, 0x8C, 0x0C, 0x33, 0x81, 0xCE, 0x60, 0x1F, 0x98, 0x01,
+  0xE7, 0x3C, 0x00, 0xCF, 0xC0, 0x33, 0x9C, 0x0E, 0x61, 0x81, 0x8C, 0x30,
+  0x71, 0xCE, 0x0C, 0x1F, 0x83, 0x01, 0xE0, 0x0F, 0x80, 0x3F, 0x80, 0xF1,
+  0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0xC7, 0x3F, 0x8E, 0xF3, 0x9D,
+  0xE7, 0xF3, 0xC7, 0xE7, 0x87, 0x87, 0x8F, 0x0F, 0xFF, 0x07, 0xEF, 0x00,
+  0xFF, 0xC0, 0x3C, 0xE7, 0x9C, 0x73, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE1,
+  0xC7, 0x1E, 0x38, 0xF0, 0xF1, 0xC7, 0x8E, 0x38, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0xE3, 0x9E, 0x73, 0xC0, 0x0C, 0x03, 0x0C, 0xCD, 0xFE, 0x1E,
+  0x1F, 0xEC, 0xCC, 0x30, 0x0C, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x7B, 0xDE, 0xF7, 0x73, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x06, 0x1C,
+  0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x38, 0x60,
+  0x1F, 0x83, 0xFC, 0x79, 0xE7, 0x0E, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F,
+  0xF0, 0xFF, 0x0F, 0xF0, 0xF7, 0x0E, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0x7E,
+  0x3F, 0x8D, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x3F, 0xFF, 0xFC, 0x3F, 0x1F, 0xFB, 0x0F, 0xC0, 0xF0,
+  0x1E, 0x03, 0xC0, 0xF8, 0x1F, 0x07, 0xC1, 0xF8, 0x7C, 0x1F, 0x07, 0xC1,
+  0xFF, 0xFF, 0xF8, 0x7F, 0x9F, 0xFA, 0x0F, 0x80, 0xF0, 0x1E, 0x07, 0x87,
+  0xE0, 0xFE, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x3F, 0xFF, 0x9F, 0xC0,
+  0x07, 0xC0, 0x7C, 0x0F, 0xC1, 0xFC, 0x1B, 0xC3, 0xBC, 0x73, 0xC6, 0x3C,
+  0xE3, 0xCC, 0x3C, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7F,
+  0xCF, 0xF9, 0xC0, 0x38, 0x07, 0x00, 0xFE, 0x1F, 0xF2, 0x1E, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF8, 0x3D, 0xFF, 0x9F, 0xC0, 0x0F, 0xC3, 0xFE, 0x3C,
+  0x27, 0x80, 0xF0, 0x0F, 0x78, 0xFF, 0xEF, 0x9F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xF7, 0x0F, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0xFF, 0xFF, 0xFC, 0x0F, 0x81,
+  0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x7C, 0x0F, 0x03, 0xE0, 0x78, 0x1F, 0x03,
+  0xC0, 0x78, 0x1F, 0x00, 0x3F, 0xC7, 0xFE, 0xF9, 0xFF, 0x0F, 0xF0, 0xF7,
+  0x9E, 0x3F, 0xC3, 0xFC, 0x79, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF9, 0xF7,
+  0xFE, 0x1F, 0x80, 0x1F, 0x03, 0xFC, 0x79, 0xEF, 0x0E, 0xF0, 0xFF, 0x0F,
+  0xF0, 0xFF, 0x9F, 0x7F, 0xF1, 0xEF, 0x00, 0xF0, 0x1E, 0x43, 0xC7, 0xFC,
+  0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x7B, 0xDE, 0xF0, 0x00,
+  0x0F, 0x7B, 0xDE, 0xEE, 0x60, 0x00, 0x08, 0x03, 0xC0, 0xFE, 0x3F, 0x0F,
+  0xC0, 0x70, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xC0, 0x02, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x80, 0x07, 0x80,
+  0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1C, 0x07, 0xE1, 0xF8, 0xFE, 0x07,
+  0x80, 0x20, 0x00, 0x7E, 0x7F, 0xA1, 0xE0, 0xF0, 0x78, 0x7C, 0x7C, 0x7C,
+  0x3C, 0x1E, 0x00, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x03, 0xF0, 0x07, 0xFE,
+  0x07, 0x07, 0x87, 0x00, 0xE7, 0x3D, 0xB3, 0x3F, 0xDF, 0x38, 0xE7, 0x98,
+  0x33, 0xCC, 0x19, 0xE6, 0x0C, 0xF3, 0x06, 0x79, 0xC7, 0x66, 0x7F, 0xE3,
+  0x9E, 0xE0, 0xE0, 0x10, 0x38, 0x38, 0x0F, 0xF8, 0x01, 0xF0, 0x00, 0x07,
+  0xC0, 0x0F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0xEE, 0x03, 0xDE, 0x07, 0xBC,
+  0x0E, 0x38, 0x3C, 0x78, 0x78, 0xF0, 0xFF, 0xE3, 0xFF, 0xE7, 0x83, 0xCF,
+  0x07, 0xBC, 0x07, 0x80, 0xFF, 0x8F, 0xFC, 0xF1, 0xEF, 0x1E, 0xF1, 0xEF,
+  0x1E, 0xFF, 0xCF, 0xFE, 0xF1, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF1, 0xFF,
+  0xFE, 0xFF, 0x80, 0x0F, 0xE1, 0xFF, 0x3C, 0x17, 0x80, 0xF8, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x11, 0xFF,
+  0x0F, 0xE0, 0xFF, 0x83, 0xFF, 0x8F, 0x0F, 0x3C, 0x1E, 0xF0, 0x7F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xFC, 0x1E, 0xF0,
+  0xF3, 0xFF, 0x8F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0xFB, 0xFE, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xFF, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x00, 0x07, 0xF0, 0x7F, 0xE3, 0xC0,
+  0x9E, 0x00, 0xF8, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x3F, 0xF0, 0xFF, 0xC0,
+  0xFF, 0x03, 0xDE, 0x0F, 0x3C, 0x3C, 0x7F, 0xF0, 0x7F, 0x00, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x3C, 0x78, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x3F, 0xFB, 0xC0,
+  0xF0, 0x7B, 0xC3, 0xCF, 0x1E, 0x3C, 0xF0, 0xF7, 0x83, 0xFC, 0x0F, 0xE0,
+  0x3F, 0x80, 0xFF, 0x03, 0xFE, 0x0F, 0x7C, 0x3C, 0xF8, 0xF1, 0xF3, 0xC3,
+  0xEF, 0x07, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0xFC, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFE, 0x7F, 0xF6, 0x6F,
+  0xF6, 0x6F, 0xF7, 0xEF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF1, 0x8F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x7F, 0xC3, 0xFF, 0x1F, 0xF8, 0xFF, 0xE7,
+  0xFB, 0x3F, 0xD9, 0xFE, 0xEF, 0xF3, 0x7F, 0x9B, 0xFC, 0xFF, 0xE3, 0xFF,
+  0x1F, 0xF8, 0x7F, 0xC3, 0xE0, 0x0F, 0xE0, 0x3F, 0xE0, 0xF1, 0xE3, 0xC1,
+  0xEF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7B, 0xC1, 0xE3, 0xC7, 0x83, 0xFE, 0x03, 0xF8, 0x00, 0xFF, 0x8F,
+  0xFE, 0xF1, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x1E, 0xFF, 0xEF,
+  0xF8, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0xE0, 0x3F,
+  0xE0, 0xF1, 0xE3, 0xC1, 0xEF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F,
+  0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7B, 0xC1, 0xE3, 0xC7, 0x83, 0xFE, 0x03,
+  0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0xFF, 0x87, 0xFE, 0x3C, 0x79,
+  0xE3, 0xCF, 0x1E, 0x78, 0xF3, 0xC7, 0x1F, 0xF0, 0xFF, 0x87, 0x9E, 0x3C,
+  0xF9, 0xE3, 0xCF, 0x1F, 0x78, 0x7B, 0xC3, 0xE0, 0x1F, 0xE7, 0xFE, 0xF8,
+  0x6F, 0x02, 0xF0, 0x0F, 0x80, 0xFF, 0x87, 0xFE, 0x1F, 0xF0, 0x1F, 0x00,
+  0xF8, 0x0F, 0xE1, 0xFF, 0xFE, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0,
+  0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xF7, 0x8F, 0x3F, 0xF8, 0x7F, 0x00, 0xF0,
+  0x1E, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE3, 0xC7, 0x87, 0x8F, 0x0F, 0x1E,
+  0x0F, 0x78, 0x1E, 0xF0, 0x3D, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x00,
+  0xF8, 0x01, 0xF0, 0x00, 0xF0, 0x70, 0x7F, 0x83, 0x83, 0xDE, 0x3E, 0x3C,
+  0xF1, 0xF1, 0xE7, 0x8D, 0x8F, 0x1C, 0xEE, 0x70, 0xF7, 0x77, 0x87, 0xB1,
+  0xBC, 0x3D, 0x8D, 0xE0, 0xFC, 0x7E, 0x07, 0xE3, 0xF0, 0x3E, 0x0F, 0x80,
+  0xF0, 0x78, 0x07, 0x83, 0xC0, 0x38, 0x0E, 0x00, 0xF8, 0x3E, 0xF0, 0x78,
+  0xF1, 0xE1, 0xF7, 0xC1, 0xEF, 0x01, 0xFC, 0x01, 0xF0, 0x03, 0xE0, 0x0F,
+  0xE0, 0x1F, 0xC0, 0x7B, 0xC1, 0xF7, 0xC3, 0xC7, 0x8F, 0x07, 0xBE, 0x0F,
+  0x80, 0xF8, 0x1F, 0x7C, 0x3E, 0x3C, 0x3C, 0x3E, 0x7C, 0x1E, 0x78, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E,
+  0x03, 0xE0, 0x3E, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x0F,
+  0x80, 0xF8, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0x38, 0xE3,
+  0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xFF, 0xF0, 0xC1, 0xC1,
+  0x83, 0x06, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x60, 0xC1, 0x83, 0x83,
+  0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+  0xFF, 0xF0, 0x07, 0x00, 0x7C, 0x07, 0x70, 0x71, 0xC6, 0x03, 0x00, 0xFF,
+  0xFF, 0xF0, 0xE1, 0xC3, 0x87, 0x3F, 0x8F, 0xF9, 0x07, 0x80, 0xF3, 0xFE,
+  0xFF, 0xFC, 0x7F, 0x8F, 0xF3, 0xEF, 0xFC, 0xF7, 0x80, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF3, 0xCF, 0xFE, 0xF9, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F,
+  0xF0, 0xFF, 0x0F, 0xF9, 0xEF, 0xFE, 0xF3, 0xC0, 0x1F, 0x8F, 0xF7, 0x87,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x78, 0x4F, 0xF1, 0xF8, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x3C, 0xF7, 0xFF, 0x79, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0x79, 0xF7, 0xFF, 0x3C, 0xF0, 0x1F, 0x83, 0xFE,
+  0x79, 0xEF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0x78, 0x23, 0xFE,
+  0x1F, 0xC0, 0x0F, 0x9F, 0xCF, 0x07, 0x8F, 0xFF, 0xFC, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x3C, 0xF7, 0xFF, 0x79, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x79, 0xF7, 0xFF, 0x1C, 0xF0,
+  0x0F, 0x41, 0xE7, 0xFC, 0x3F, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x39, 0xFF, 0xBE, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F,
+  0xE3, 0xFC, 0x78, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C,
+  0xF3, 0xC0, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3F,
+  0xEF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xEF, 0x1C, 0xF3,
+  0x8F, 0x70, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0x78, 0xF3, 0xCF, 0x1E, 0xF0,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF7, 0x8F, 0x3F,
+  0xF7, 0xEF, 0x9F, 0x3F, 0xC7, 0x8F, 0xF1, 0xE3, 0xFC, 0x78, 0xFF, 0x1E,
+  0x3F, 0xC7, 0x8F, 0xF1, 0xE3, 0xFC, 0x78, 0xFF, 0x1E, 0x3C, 0xF3, 0x9F,
+  0xFB, 0xE7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F,
+  0xC7, 0x80, 0x1F, 0x83, 0xFC, 0x79, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0xF3, 0xCF, 0xFE, 0xF9, 0xEF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF9, 0xEF, 0xFE, 0xF3, 0xCF,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x3C, 0xF7, 0xFF, 0x79, 0xFF, 0x0F,
+  0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x79, 0xF7, 0xFF, 0x3C, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xF7, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x9F, 0xFF, 0x07, 0xC0, 0xFC, 0x1F, 0xE1,
+  0xFC, 0x0F, 0x83, 0xFF, 0xE7, 0xF0, 0x3C, 0x0F, 0x03, 0xC3, 0xFF, 0xFF,
+  0xCF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0x87, 0xE0,
+  0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF3,
+  0xEF, 0xFC, 0xE7, 0x80, 0xF0, 0xF7, 0x0E, 0x79, 0xE7, 0x9E, 0x39, 0xC3,
+  0x9C, 0x3F, 0xC1, 0xF8, 0x1F, 0x80, 0xF0, 0x0F, 0x00, 0xF1, 0xC7, 0xF8,
+  0xE3, 0xDC, 0x71, 0xCF, 0x7D, 0xE7, 0xB6, 0xF1, 0xDB, 0x70, 0xED, 0xB8,
+  0x7C, 0x7C, 0x3E, 0x3E, 0x0F, 0x1E, 0x07, 0x8F, 0x00, 0xF0, 0xF7, 0x9E,
+  0x39, 0xC1, 0xF8, 0x1F, 0x80, 0xF0, 0x1F, 0x83, 0xFC, 0x39, 0xC7, 0x9E,
+  0xF0, 0xF0, 0xF0, 0xF7, 0x0F, 0x78, 0xE7, 0x9E, 0x39, 0xC3, 0x9C, 0x1D,
+  0xC1, 0xF8, 0x1F, 0x80, 0xF8, 0x0F, 0x00, 0xF0, 0x1E, 0x07, 0xE0, 0x7C,
+  0x00, 0xFF, 0xFF, 0xF0, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x3F, 0xFF, 0xFC, 0x0F, 0x8F, 0xC7, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x78,
+  0xF8, 0x7C, 0x0F, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1F, 0x87, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x70, 0x3C, 0x0F, 0x87, 0xC7, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0xFC,
+  0x7C, 0x00, 0x7E, 0x0F, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x00, 0xC0,
+  0x30, 0x3E, 0x3F, 0xDF, 0xDF, 0xB3, 0xCC, 0xF3, 0x3C, 0xCF, 0xB1, 0xFD,
+  0x3F, 0xC3, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0x0F, 0xC3, 0xFC, 0xF8, 0x9E,
+  0x03, 0xC0, 0x78, 0x0F, 0x07, 0xFE, 0xFF, 0xC7, 0x80, 0xF0, 0x1E, 0x03,
+  0xC1, 0xFF, 0xFF, 0xF8, 0x40, 0xFF, 0xF7, 0xF9, 0xCE, 0x61, 0x98, 0x67,
+  0x39, 0xFE, 0xFF, 0xD0, 0x20, 0xF8, 0x7D, 0xE1, 0xE7, 0xCF, 0x8F, 0x3C,
+  0x1C, 0xE0, 0x7F, 0x87, 0xFF, 0x9F, 0xFE, 0x07, 0x81, 0xFF, 0xE7, 0xFF,
+  0x81, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xC0, 0x1F, 0x9F, 0xE7, 0x09, 0xC0, 0x7C, 0x0F, 0xC7, 0xFB, 0x8F, 0xE1,
+  0xFC, 0x77, 0xF8, 0xFC, 0x0F, 0x80, 0xE4, 0x39, 0xFE, 0x7E, 0x00, 0xCF,
+  0x30, 0x0F, 0xC0, 0x7F, 0x83, 0x87, 0x19, 0xF6, 0xEC, 0x5F, 0x60, 0x3D,
+  0x80, 0xF6, 0x03, 0xD8, 0x0F, 0xB1, 0x76, 0x7D, 0x8E, 0x1C, 0x1F, 0xE0,
+  0x3F, 0x00, 0x7E, 0x7F, 0x03, 0x7F, 0xC3, 0xC7, 0xFF, 0x7B, 0x00, 0xFF,
+  0xFF, 0x08, 0x46, 0x33, 0x9F, 0x9C, 0xC6, 0x39, 0xC3, 0x9C, 0x63, 0x08,
+  0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xC0, 0x7F, 0x83, 0x87, 0x1B, 0xE6, 0xEC, 0xDF, 0x33,
+  0x3C, 0xCC, 0xF3, 0xE3, 0xCD, 0x8F, 0xB3, 0x76, 0xCD, 0x8E, 0x1C, 0x1F,
+  0xE0, 0x3F, 0x00, 0xFF, 0xF0, 0x38, 0xFB, 0x1E, 0x3C, 0x6F, 0x8E, 0x00,
+  0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7D, 0xFE, 0x18, 0x31, 0xC7, 0x3F,
+  0xFF, 0xFD, 0xFE, 0x19, 0xE0, 0x70, 0xFF, 0xFE, 0x1C, 0xE7, 0x38, 0xF1,
+  0xEF, 0x1E, 0xF1, 0xEF, 0x1E, 0xF1, 0xEF, 0x1E, 0xF1, 0xEF, 0x1E, 0xF1,
+  0xEF, 0xFF, 0xFE, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x3F, 0xDF,
+  0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x37, 0xCC, 0xF3, 0x0C, 0xC3, 0x30, 0xCC,
+  0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC0, 0xFF, 0xFF, 0x23, 0x3F,
+  0xF3, 0xC3, 0x0C, 0x30, 0xCF, 0xFF, 0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1F,
+  0x1D, 0xFC, 0x7C, 0x00, 0x7F, 0xFF, 0xE0, 0x84, 0x31, 0x8E, 0x70, 0xE7,
+  0x18, 0xCE, 0x7E, 0x73, 0x18, 0x84, 0x00, 0xF0, 0x0E, 0x3C, 0x03, 0x03,
+  0x01, 0xC0, 0xC0, 0x60, 0x30, 0x30, 0x0C, 0x1C, 0x0F, 0xC6, 0x03, 0xF3,
+  0x8E, 0x00, 0xC7, 0x80, 0x61, 0xE0, 0x18, 0xB8, 0x0C, 0x6E, 0x07, 0x1F,
+  0xC1, 0x87, 0xF0, 0xE0, 0x38, 0xF0, 0x0E, 0x1E, 0x01, 0x80, 0xC0, 0x70,
+  0x18, 0x0C, 0x03, 0x03, 0x00, 0x60, 0xE0, 0x3F, 0x18, 0x07, 0xE7, 0x3E,
+  0x00, 0xCF, 0xE0, 0x31, 0x0C, 0x06, 0x01, 0x81, 0x80, 0xE0, 0x70, 0x38,
+  0x0C, 0x1F, 0xC3, 0x83, 0xF8, 0xFC, 0x0E, 0x3F, 0x83, 0x08, 0x61, 0xC0,
+  0xF0, 0x60, 0x06, 0x30, 0x21, 0x9C, 0x0F, 0xE6, 0x03, 0xF3, 0x8E, 0x00,
+  0xC7, 0x80, 0x61, 0xE0, 0x18, 0xB8, 0x0C, 0x6E, 0x07, 0x1F, 0xC1, 0x87,
+  0xF0, 0xE0, 0x38, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0x00, 0xF0, 0x78, 0x7C,
+  0x7C, 0x7C, 0x3C, 0x1E, 0x0F, 0x0B, 0xFC, 0xFC, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0E,
+  0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0E,
+  0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x03, 0x80, 0x0D, 0x80,
+  0x31, 0x80, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0E,
+  0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x07, 0x60, 0x1F, 0xC0,
+  0x37, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0E,
+  0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x06, 0xC0, 0x0D, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0E,
+  0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x07, 0xC0, 0x1D, 0xC0,
+  0x31, 0x80, 0x63, 0x00, 0x6C, 0x00, 0xF8, 0x01, 0xF0, 0x07, 0xF0, 0x0E,
+  0xE0, 0x1D, 0xC0, 0x7B, 0xC0, 0xE3, 0x83, 0xC7, 0x87, 0x8F, 0x0F, 0xFE,
+  0x3F, 0xFE, 0x78, 0x3C, 0xF0, 0x7B, 0xC0, 0x78, 0x03, 0xFF, 0xF0, 0x3F,
+  0xFF, 0x07, 0xBC, 0x00, 0x73, 0xC0, 0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x1E,
+  0x3F, 0xE1, 0xE3, 0xFE, 0x1C, 0x3C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07,
+  0x83, 0xC0, 0x78, 0x3C, 0x07, 0x83, 0xFF, 0xF0, 0x3F, 0xF0, 0x0F, 0xE1,
+  0xFF, 0x3C, 0x17, 0x80, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF8, 0x07, 0x80, 0x3C, 0x11, 0xFF, 0x0F, 0xE0, 0x08, 0x00, 0xC0,
+  0x0C, 0x03, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0xFB, 0xFE, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3F, 0xFF, 0xFC, 0x03, 0x81, 0xC0, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0xFB, 0xFE, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3F, 0xFF, 0xFC, 0x1C, 0x0D, 0x86, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0xFB, 0xFE, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3F, 0xFF, 0xFC, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0xFB, 0xFE, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3F, 0xFF, 0xFC, 0xE1, 0xC3, 0x80, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xC0, 0x3B, 0xB8, 0x0F, 0x7B, 0xDE, 0xF7,
+  0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBC, 0x3C, 0x3C, 0x66, 0x00, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0xCF, 0x30, 0x00, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+  0x9E, 0x79, 0xE7, 0x80, 0x3F, 0xE0, 0x3F, 0xF8, 0x3C, 0x3C, 0x3C, 0x1E,
+  0x3C, 0x1E, 0x3C, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F,
+  0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3C, 0x3F, 0xF8, 0x3F, 0xE0, 0x0E, 0xC0,
+  0xFE, 0x06, 0xE0, 0x00, 0x0F, 0x87, 0xFC, 0x3F, 0xF1, 0xFF, 0x8F, 0xFE,
+  0x7F, 0xB3, 0xFD, 0x9F, 0xEE, 0xFF, 0x37, 0xF9, 0xBF, 0xCF, 0xFE, 0x3F,
+  0xF1, 0xFF, 0x87, 0xFC, 0x3E, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xFE, 0x0F, 0x1E, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xBC, 0x1E, 0x3C,
+  0x78, 0x3F, 0xE0, 0x3F, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xFE, 0x0F, 0x1E, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xBC, 0x1E, 0x3C,
+  0x78, 0x3F, 0xE0, 0x3F, 0x80, 0x07, 0x00, 0x1B, 0x00, 0x63, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xFE, 0x0F, 0x1E, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xBC, 0x1E, 0x3C,
+  0x78, 0x3F, 0xE0, 0x3F, 0x80, 0x07, 0x60, 0x1F, 0xC0, 0x37, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xFE, 0x0F, 0x1E, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xBC, 0x1E, 0x3C,
+  0x78, 0x3F, 0xE0, 0x3F, 0x80, 0x06, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x03, 0xFE, 0x0F, 0x1E, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xBC, 0x1E, 0x3C,
+  0x78, 0x3F, 0xE0, 0x3F, 0x80, 0x40, 0x2E, 0x07, 0x70, 0xE3, 0x9C, 0x1F,
+  0x80, 0xF0, 0x0F, 0x01, 0xF8, 0x39, 0xC7, 0x0E, 0xE0, 0x74, 0x02, 0x07,
+  0xF3, 0x0F, 0xFE, 0x1E, 0x3E, 0x3C, 0x1E, 0x38, 0x3F, 0x78, 0x6F, 0x78,
+  0xCF, 0x79, 0xCF, 0x79, 0x8F, 0x7B, 0x0F, 0x7E, 0x0E, 0x3C, 0x1E, 0x3E,
+  0x3C, 0x3F, 0xF8, 0x67, 0xF0, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x00, 0x0F,
+  0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0,
+  0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0x78, 0xF3, 0xFF, 0x87, 0xF0,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x00, 0x0F, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0x78, 0xF3, 0xFF, 0x87, 0xF0, 0x07, 0x00, 0x6C, 0x06, 0x30,
+  0x00, 0x0F, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0x78, 0xF3, 0xFF,
+  0x87, 0xF0, 0x18, 0xC0, 0xC6, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xF8, 0x3F,
+  0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
+  0x3F, 0xC1, 0xFE, 0x0F, 0x78, 0xF3, 0xFF, 0x87, 0xF0, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x00, 0x00, 0xF8, 0x1F, 0x7C, 0x3E, 0x3C, 0x3C, 0x3E,
+  0x7C, 0x1E, 0x78, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xF0,
+  0x0F, 0x00, 0xFF, 0x8F, 0xFE, 0xF1, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x1E, 0xFF, 0xEF, 0xF8, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x3F, 0x87,
+  0xFC, 0xF1, 0xEF, 0x1E, 0xF3, 0xEF, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xEF,
+  0x3F, 0xF0, 0xFF, 0x0F, 0xF4, 0xFF, 0x7E, 0xF3, 0xC0, 0x38, 0x03, 0x80,
+  0x38, 0x03, 0x80, 0x00, 0x7F, 0x1F, 0xF2, 0x0F, 0x01, 0xE7, 0xFD, 0xFF,
+  0xF8, 0xFF, 0x1F, 0xE7, 0xDF, 0xF9, 0xEF, 0x00, 0xE0, 0x38, 0x0E, 0x03,
+  0x80, 0x00, 0x7F, 0x1F, 0xF2, 0x0F, 0x01, 0xE7, 0xFD, 0xFF, 0xF8, 0xFF,
+  0x1F, 0xE7, 0xDF, 0xF9, 0xEF, 0x0E, 0x03, 0xE0, 0x6C, 0x18, 0xC0, 0x00,
+  0x7F, 0x1F, 0xF2, 0x0F, 0x01, 0xE7, 0xFD, 0xFF, 0xF8, 0xFF, 0x1F, 0xE7,
+  0xDF, 0xF9, 0xEF, 0x0D, 0x83, 0xB0, 0x6E, 0x0D, 0x80, 0x00, 0x7F, 0x1F,
+  0xF2, 0x0F, 0x01, 0xE7, 0xFD, 0xFF, 0xF8, 0xFF, 0x1F, 0xE7, 0xDF, 0xF9,
+  0xEF, 0x19, 0x83, 0x30, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x90, 0x78, 0x0F,
+  0x3F, 0xEF, 0xFF, 0xC7, 0xF8, 0xFF, 0x3E, 0xFF, 0xCF, 0x78, 0x0F, 0x03,
+  0x30, 0x42, 0x08, 0x41, 0x98, 0x1E, 0x00, 0x01, 0xFC, 0x7F, 0xC8, 0x3C,
+  0x07, 0x9F, 0xF7, 0xFF, 0xE3, 0xFC, 0x7F, 0x9F, 0x7F, 0xE7, 0xBC, 0x3F,
+  0x1F, 0x0F, 0xF7, 0xF1, 0x07, 0xCF, 0x00, 0xF0, 0xF3, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFC, 0x78, 0x07, 0x8F, 0x00, 0xF3, 0xF0, 0x4F, 0xEF, 0xF8, 0xF0,
+  0xFE, 0x00, 0x1F, 0x8F, 0xF7, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0x78, 0x4F, 0xF1, 0xF8, 0x08, 0x03, 0x00, 0xC0, 0xF0, 0x38, 0x01, 0xC0,
+  0x0E, 0x00, 0x70, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x82, 0x3F, 0xE1, 0xFC, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x82, 0x3F, 0xE1, 0xFC, 0x0E, 0x01, 0xF0,
+  0x1B, 0x03, 0x18, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x82, 0x3F, 0xE1, 0xFC, 0x19, 0x81, 0x98,
+  0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x0F, 0x00, 0x78, 0x23, 0xFE, 0x1F, 0xC0, 0xE1, 0xC3, 0x87, 0x00,
+  0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x0E, 0x38, 0xE3, 0x80,
+  0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0x18, 0x3C,
+  0x66, 0x66, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0xCF, 0x30, 0x00, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79,
+  0xE7, 0x80, 0x1C, 0x60, 0xFC, 0x1F, 0x03, 0x38, 0x01, 0xC1, 0xFC, 0x7F,
+  0xEF, 0x8F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x79, 0xE3, 0xFC, 0x1F,
+  0x80, 0x19, 0x87, 0xB0, 0xDE, 0x19, 0x80, 0x01, 0xE7, 0x3F, 0xF7, 0xCF,
+  0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x9E, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF7, 0x9E, 0x3F, 0xC1, 0xF8, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x9E, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF7, 0x9E, 0x3F, 0xC1, 0xF8, 0x06,
+  0x00, 0xF0, 0x19, 0x81, 0x98, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x9E, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF7, 0x9E, 0x3F, 0xC1, 0xF8, 0x1C,
+  0xC3, 0xCC, 0x33, 0xC3, 0x38, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x9E, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF7, 0x9E, 0x3F, 0xC1, 0xF8, 0x19,
+  0x81, 0x98, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x79, 0xEF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xE0, 0x07,
+  0x00, 0x38, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE7, 0x9E, 0xF1, 0xFF, 0x3F,
+  0xF6, 0xFF, 0xCF, 0xF8, 0xF7, 0x9E, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0x01, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE,
+  0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE7, 0xDF, 0xF9, 0xCF, 0x01, 0xC0, 0x70,
+  0x1C, 0x07, 0x00, 0x01, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7,
+  0xF8, 0xFF, 0x1F, 0xE7, 0xDF, 0xF9, 0xCF, 0x0E, 0x03, 0xE0, 0x6C, 0x18,
+  0xC0, 0x01, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF,
+  0x1F, 0xE7, 0xDF, 0xF9, 0xCF, 0x31, 0x86, 0x30, 0x00, 0x00, 0x0F, 0x1F,
+  0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x3E, 0xFF,
+  0xCE, 0x78, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x0F, 0x0F, 0x70,
+  0xF7, 0x8E, 0x79, 0xE3, 0x9C, 0x39, 0xC1, 0xDC, 0x1F, 0x81, 0xF8, 0x0F,
+  0x80, 0xF0, 0x0F, 0x01, 0xE0, 0x7E, 0x07, 0xC0, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF3, 0xCF, 0xFE, 0xF9, 0xEF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF9, 0xEF, 0xFE, 0xF3, 0xCF, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x00, 0x19, 0x81, 0x98, 0x00, 0x00, 0x00, 0xF0, 0xF7, 0x0F, 0x78, 0xE7,
+  0x9E, 0x39, 0xC3, 0x9C, 0x1D, 0xC1, 0xF8, 0x1F, 0x80, 0xF8, 0x0F, 0x00,
+  0xF0, 0x1E, 0x07, 0xE0, 0x7C, 0x00 };
+
+const GFXglyph DejaVuSans_Bold10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
+  {     1,   4,  15,   9,    3,  -14 },   // 0x21 '!'
+  {     9,   6,   5,  10,    2,  -14 },   // 0x22 '"'
+  {    13,  14,  15,  17,    1,  -14 },   // 0x23 '#'
+  {    40,  12,  18,  14,    1,  -14 },   // 0x24 '$'
+  {    67,  19,  15,  20,    1,  -14 },   // 0x25 '%'
+  {   103,  15,  15,  17,    1,  -14 },   // 0x26 '&'
+  {   132,   2,   5,   6,    2,  -14 },   // 0x27 '''
+  {   134,   6,  18,   9,    2,  -14 },   // 0x28 '('
+  {   148,   6,  18,   9,    1,  -14 },   // 0x29 ')'
+  {   162,  10,   9,  10,    0,  -14 },   // 0x2A '*'
+  {   174,  12,  12,  17,    2,  -11 },   // 0x2B '+'
+  {   192,   5,   7,   8,    1,   -3 },   // 0x2C ','
+  {   197,   6,   3,   8,    1,   -6 },   // 0x2D '-'
+  {   200,   4,   4,   8,    2,   -3 },   // 0x2E '.'
+  {   202,   7,  16,   7,    0,  -14 },   // 0x2F '/'
+  {   216,  12,  15,  14,    1,  -14 },   // 0x30 '0'
+  {   239,  10,  15,  14,    3,  -14 },   // 0x31 '1'
+  {   258,  11,  15,  14,    2,  -14 },   // 0x32 '2'
+  {   279,  11,  15,  14,    1,  -14 },   // 0x33 '3'
+  {   300,  12,  15,  14,    1,  -14 },   // 0x34 '4'
+  {   323,  11,  15,  14,    2,  -14 },   // 0x35 '5'
+  {   344,  12,  15,  14,    1,  -14 },   // 0x36 '6'
+  {   367,  11,  15,  14,    1,  -14 },   // 0x37 '7'
+  {   388,  12,  15,  14,    1,  -14 },   // 0x38 '8'
+  {   411,  12,  15,  14,    1,  -14 },   // 0x39 '9'
+  {   434,   4,  11,   8,    2,  -10 },   // 0x3A ':'
+  {   440,   5,  14,   8,    1,  -10 },   // 0x3B ';'
+  {   449,  13,  11,  17,    2,  -11 },   // 0x3C '<'
+  {   467,  13,   6,  17,    2,   -8 },   // 0x3D '='
+  {   477,  13,  11,  17,    2,  -11 },   // 0x3E '>'
+  {   495,   9,  15,  12,    1,  -14 },   // 0x3F '?'
+  {   512,  17,  18,  20,    1,  -14 },   // 0x40 '@'
+  {   551,  15,  15,  15,    0,  -14 },   // 0x41 'A'
+  {   580,  12,  15,  15,    2,  -14 },   // 0x42 'B'
+  {   603,  12,  15,  15,    1,  -14 },   // 0x43 'C'
+  {   626,  14,  15,  17,    2,  -14 },   // 0x44 'D'
+  {   653,  10,  15,  14,    2,  -14 },   // 0x45 'E'
+  {   672,  10,  15,  14,    2,  -14 },   // 0x46 'F'
+  {   691,  14,  15,  16,    1,  -14 },   // 0x47 'G'
+  {   718,  13,  15,  17,    2,  -14 },   // 0x48 'H'
+  {   743,   4,  15,   7,    2,  -14 },   // 0x49 'I'
+  {   751,   7,  19,   7,   -1,  -14 },   // 0x4A 'J'
+  {   768,  14,  15,  16,    2,  -14 },   // 0x4B 'K'
+  {   795,  10,  15,  13,    2,  -14 },   // 0x4C 'L'
+  {   814,  16,  15,  20,    2,  -14 },   // 0x4D 'M'
+  {   844,  13,  15,  17,    2,  -14 },   // 0x4E 'N'
+  {   869,  15,  15,  17,    1,  -14 },   // 0x4F 'O'
+  {   898,  12,  15,  15,    2,  -14 },   // 0x50 'P'
+  {   921,  15,  18,  17,    1,  -14 },   // 0x51 'Q'
+  {   955,  13,  15,  15,    2,  -14 },   // 0x52 'R'
+  {   980,  12,  15,  14,    1,  -14 },   // 0x53 'S'
+  {  1003,  14,  15,  14,    0,  -14 },   // 0x54 'T'
+  {  1030,  13,  15,  16,    2,  -14 },   // 0x55 'U'
+  {  1055,  15,  15,  15,    0,  -14 },   // 0x56 'V'
+  {  1084,  21,  15,  22,    1,  -14 },   // 0x57 'W'
+  {  1124,  15,  15,  15,    0,  -14 },   // 0x58 'X'
+  {  1153,  16,  15,  14,   -1,  -14 },   // 0x59 'Y'
+  {  1183,  13,  15,  15,    1,  -14 },   // 0x5A 'Z'
+  {  1208,   6,  18,   9,    2,  -14 },   // 0x5B '['
+  {  1222,   7,  16,   7,    0,  -14 },   // 0x5C '\'
+  {  1236,   6,  18,   9,    1,  -14 },   // 0x5D ']'
+  {  1250,  13,   5,  17,    2,  -14 },   // 0x5E '^'
+  {  1259,  10,   2,  10,    0,    4 },   // 0x5F '_'
+  {  1262,   6,   4,  10,    1,  -15 },   // 0x60 '`'
+  {  1265,  11,  11,  14,    1,  -10 },   // 0x61 'a'
+  {  1281,  12,  15,  14,    2,  -14 },   // 0x62 'b'
+  {  1304,  10,  11,  12,    1,  -10 },   // 0x63 'c'
+  {  1318,  12,  15,  14,    1,  -14 },   // 0x64 'd'
+  {  1341,  12,  11,  14,    1,  -10 },   // 0x65 'e'
+  {  1358,   9,  15,   9,    0,  -14 },   // 0x66 'f'
+  {  1375,  12,  15,  14,    1,  -10 },   // 0x67 'g'
+  {  1398,  11,  15,  14,    2,  -14 },   // 0x68 'h'
+  {  1419,   4,  15,   7,    2,  -14 },   // 0x69 'i'
+  {  1427,   6,  19,   7,    0,  -14 },   // 0x6A 'j'
+  {  1442,  12,  15,  13,    2,  -14 },   // 0x6B 'k'
+  {  1465,   4,  15,   7,    2,  -14 },   // 0x6C 'l'
+  {  1473,  18,  11,  21,    2,  -10 },   // 0x6D 'm'
+  {  1498,  11,  11,  14,    2,  -10 },   // 0x6E 'n'
+  {  1514,  12,  11,  14,    1,  -10 },   // 0x6F 'o'
+  {  1531,  12,  15,  14,    2,  -10 },   // 0x70 'p'
+  {  1554,  12,  15,  14,    1,  -10 },   // 0x71 'q'
+  {  1577,   8,  11,  10,    2,  -10 },   // 0x72 'r'
+  {  1588,  10,  11,  12,    1,  -10 },   // 0x73 's'
+  {  1602,  10,  14,  10,    0,  -13 },   // 0x74 't'
+  {  1620,  11,  11,  14,    2,  -10 },   // 0x75 'u'
+  {  1636,  12,  11,  13,    0,  -10 },   // 0x76 'v'
+  {  1653,  17,  11,  18,    1,  -10 },   // 0x77 'w'
+  {  1677,  12,  11,  13,    1,  -10 },   // 0x78 'x'
+  {  1694,  12,  15,  13,    1,  -10 },   // 0x79 'y'
+  {  1717,  10,  11,  12,    1,  -10 },   // 0x7A 'z'
+  {  1731,   9,  18,  14,    3,  -14 },   // 0x7B '{'
+  {  1752,   2,  20,   7,    3,  -14 },   // 0x7C '|'
+  {  1757,   9,  18,  14,    2,  -14 },   // 0x7D '}'
+  {  1778,  13,   4,  17,    2,   -7 },   // 0x7E '~'
+  {  1785,  10,  18,  12,    1,  -13 },   // 0x7F
+  {  1808,  10,  18,  12,    1,  -13 },   // 0x80
+  {  1831,  10,  18,  12,    1,  -13 },   // 0x81
+  {  1854,  10,  18,  12,    1,  -13 },   // 0x82
+  {  1877,  10,  18,  12,    1,  -13 },   // 0x83
+  {  1900,  10,  18,  12,    1,  -13 },   // 0x84
+  {  1923,  10,  18,  12,    1,  -13 },   // 0x85
+  {  1946,  10,  18,  12,    1,  -13 },   // 0x86
+  {  1969,  10,  18,  12,    1,  -13 },   // 0x87
+  {  1992,  10,  18,  12,    1,  -13 },   // 0x88
+  {  2015,  10,  18,  12,    1,  -13 },   // 0x89
+  {  2038,  10,  18,  12,    1,  -13 },   // 0x8A
+  {  2061,  10,  18,  12,    1,  -13 },   // 0x8B
+  {  2084,  10,  18,  12,    1,  -13 },   // 0x8C
+  {  2107,  10,  18,  12,    1,  -13 },   // 0x8D
+  {  2130,  10,  18,  12,    1,  -13 },   // 0x8E
+  {  2153,  10,  18,  12,    1,  -13 },   // 0x8F
+  {  2176,  10,  18,  12,    1,  -13 },   // 0x90
+  {  2199,  10,  18,  12,    1,  -13 },   // 0x91
+  {  2222,  10,  18,  12,    1,  -13 },   // 0x92
+  {  2245,  10,  18,  12,    1,  -13 },   // 0x93
+  {  2268,  10,  18,  12,    1,  -13 },   // 0x94
+  {  2291,  10,  18,  12,    1,  -13 },   // 0x95
+  {  2314,  10,  18,  12,    1,  -13 },   // 0x96
+  {  2337,  10,  18,  12,    1,  -13 },   // 0x97
+  {  2360,  10,  18,  12,    1,  -13 },   // 0x98
+  {  2383,  10,  18,  12,    1,  -13 },   // 0x99
+  {  2406,  10,  18,  12,    1,  -13 },   // 0x9A
+  {  2429,  10,  18,  12,    1,  -13 },   // 0x9B
+  {  2452,  10,  18,  12,    1,  -13 },   // 0x9C
+  {  2475,  10,  18,  12,    1,  -13 },   // 0x9D
+  {  2498,  10,  18,  12,    1,  -13 },   // 0x9E
+  {  2521,  10,  18,  12,    1,  -13 },   // 0x9F
+  {  2544,   1,   1,   7,    0,    0 },   // 0xA0
+  {  2545,   4,  15,   9,    3,  -10 },   // 0xA1
+  {  2553,  10,  17,  14,    2,  -13 },   // 0xA2
+  {  2575,  11,  15,  14,    1,  -14 },   // 0xA3
+  {  2596,  10,  10,  13,    1,  -10 },   // 0xA4
+  {  2609,  14,  15,  14,    0,  -14 },   // 0xA5
+  {  2636,   2,  17,   7,    3,  -13 },   // 0xA6
+  {  2641,  10,  17,  10,    1,  -14 },   // 0xA7
+  {  2663,   6,   2,  10,    2,  -14 },   // 0xA8
+  {  2665,  14,  14,  20,    3,  -13 },   // 0xA9
+  {  2690,   8,  11,  11,    2,  -14 },   // 0xAA
+  {  2701,  10,   9,  13,    2,   -9 },   // 0xAB
+  {  2713,  13,   6,  17,    2,   -8 },   // 0xAC
+  {  2723,   6,   3,   8,    1,   -6 },   // 0xAD
+  {  2726,  14,  14,  20,    3,  -13 },   // 0xAE
+  {  2751,   6,   2,  10,    2,  -14 },   // 0xAF
+  {  2753,   7,   7,  10,    2,  -14 },   // 0xB0
+  {  2760,  12,  12,  17,    2,  -11 },   // 0xB1
+  {  2778,   7,   8,   9,    1,  -14 },   // 0xB2
+  {  2785,   7,   8,   9,    1,  -14 },   // 0xB3
+  {  2792,   6,   4,  10,    4,  -15 },   // 0xB4
+  {  2795,  12,  15,  15,    2,  -10 },   // 0xB5
+  {  2818,  10,  17,  13,    1,  -14 },   // 0xB6
+  {  2840,   4,   4,   8,    2,   -8 },   // 0xB7
+  {  2842,   4,   4,  10,    3,    1 },   // 0xB8
+  {  2844,   6,   8,   9,    1,  -14 },   // 0xB9
+  {  2850,   9,  11,  11,    1,  -14 },   // 0xBA
+  {  2863,  10,   9,  13,    2,   -9 },   // 0xBB
+  {  2875,  18,  15,  21,    1,  -14 },   // 0xBC
+  {  2909,  19,  15,  21,    1,  -14 },   // 0xBD
+  {  2945,  18,  15,  21,    1,  -14 },   // 0xBE
+  {  2979,   9,  15,  12,    1,  -10 },   // 0xBF
+  {  2996,  15,  19,  15,    0,  -18 },   // 0xC0
+  {  3032,  15,  19,  15,    0,  -18 },   // 0xC1
+  {  3068,  15,  19,  15,    0,  -18 },   // 0xC2
+  {  3104,  15,  19,  15,    0,  -18 },   // 0xC3
+  {  3140,  15,  19,  15,    0,  -18 },   // 0xC4
+  {  3176,  15,  19,  15,    0,  -18 },   // 0xC5
+  {  3212,  20,  15,  22,    0,  -14 },   // 0xC6
+  {  3250,  12,  19,  15,    1,  -14 },   // 0xC7
+  {  3279,  10,  19,  14,    2,  -18 },   // 0xC8
+  {  3303,  10,  19,  14,    2,  -18 },   // 0xC9
+  {  3327,  10,  19,  14,    2,  -18 },   // 0xCA
+  {  3351,  10,  19,  14,    2,  -18 },   // 0xCB
+  {  3375,   6,  19,   7,    0,  -18 },   // 0xCC
+  {  3390,   5,  19,   7,    2,  -18 },   // 0xCD
+  {  3402,   8,  19,   7,    0,  -18 },   // 0xCE
+  {  3421,   6,  19,   7,    1,  -18 },   // 0xCF
+  {  3436,  16,  15,  17,    0,  -14 },   // 0xD0
+  {  3466,  13,  19,  17,    2,  -18 },   // 0xD1
+  {  3497,  15,  19,  17,    1,  -18 },   // 0xD2
+  {  3533,  15,  19,  17,    1,  -18 },   // 0xD3
+  {  3569,  15,  19,  17,    1,  -18 },   // 0xD4
+  {  3605,  15,  19,  17,    1,  -18 },   // 0xD5
+  {  3641,  15,  19,  17,    1,  -18 },   // 0xD6
+  {  3677,  12,  12,  17,    3,  -11 },   // 0xD7
+  {  3695,  16,  15,  17,    0,  -14 },   // 0xD8
+  {  3725,  13,  19,  16,    2,  -18 },   // 0xD9
+  {  3756,  13,  19,  16,    2,  -18 },   // 0xDA
+  {  3787,  13,  19,  16,    2,  -18 },   // 0xDB
+  {  3818,  13,  19,  16,    2,  -18 },   // 0xDC
+  {  3849,  16,  19,  14,   -1,  -18 },   // 0xDD
+  {  3887,  12,  15,  15,    2,  -14 },   // 0xDE
+  {  3910,  12,  15,  14,    2,  -14 },   // 0xDF
+  {  3933,  11,  16,  14,    1,  -15 },   // 0xE0
+  {  3955,  11,  16,  14,    1,  -15 },   // 0xE1
+  {  3977,  11,  16,  14,    1,  -15 },   // 0xE2
+  {  3999,  11,  16,  14,    1,  -15 },   // 0xE3
+  {  4021,  11,  15,  14,    1,  -14 },   // 0xE4
+  {  4042,  11,  18,  14,    1,  -17 },   // 0xE5
+  {  4067,  19,  11,  21,    1,  -10 },   // 0xE6
+  {  4094,  10,  15,  12,    1,  -10 },   // 0xE7
+  {  4113,  12,  16,  14,    1,  -15 },   // 0xE8
+  {  4137,  12,  16,  14,    1,  -15 },   // 0xE9
+  {  4161,  12,  16,  14,    1,  -15 },   // 0xEA
+  {  4185,  12,  15,  14,    1,  -14 },   // 0xEB
+  {  4208,   6,  16,   7,    0,  -15 },   // 0xEC
+  {  4220,   7,  16,   7,    2,  -15 },   // 0xED
+  {  4234,   8,  16,   7,    0,  -15 },   // 0xEE
+  {  4250,   6,  15,   7,    1,  -14 },   // 0xEF
+  {  4262,  12,  15,  14,    1,  -14 },   // 0xF0
+  {  4285,  11,  16,  14,    2,  -15 },   // 0xF1
+  {  4307,  12,  16,  14,    1,  -15 },   // 0xF2
+  {  4331,  12,  16,  14,    1,  -15 },   // 0xF3
+  {  4355,  12,  16,  14,    1,  -15 },   // 0xF4
+  {  4379,  12,  16,  14,    1,  -15 },   // 0xF5
+  {  4403,  12,  15,  14,    1,  -14 },   // 0xF6
+  {  4426,  13,  10,  17,    2,  -10 },   // 0xF7
+  {  4443,  12,  13,  14,    1,  -11 },   // 0xF8
+  {  4463,  11,  16,  14,    2,  -15 },   // 0xF9
+  {  4485,  11,  16,  14,    2,  -15 },   // 0xFA
+  {  4507,  11,  16,  14,    2,  -15 },   // 0xFB
+  {  4529,  11,  15,  14,    2,  -14 },   // 0xFC
+  {  4550,  12,  20,  13,    1,  -15 },   // 0xFD
+  {  4580,  12,  19,  14,    2,  -14 },   // 0xFE
+  {  4609,  12,  19,  13,    1,  -14 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold10pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold10pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold10pt8bGlyphs,
+  0x20, 0xFF, 23 };
+
+// Approx. 6213 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold10pt8bMetrics[] PROGMEM = {
+  {   0,   7,   1 },   // 0x20
+  {   3,   9,   7 },   // 0x21
+  {   2,  10,   8 },   // 0x22
+  {   1,  17,  15 },   // 0x23
+  {   1,  14,  13 },   // 0x24
+  {   1,  20,  20 },   // 0x25
+  {   1,  17,  16 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   9,   8 },   // 0x28
+  {   1,   9,   7 },   // 0x29
+  {   0,  10,  10 },   // 0x2A
+  {   2,  17,  14 },   // 0x2B
+  {   1,   8,   6 },   // 0x2C
+  {   1,   8,   7 },   // 0x2D
+  {   2,   8,   6 },   // 0x2E
+  {   0,   7,   7 },   // 0x2F
+  {   1,  14,  13 },   // 0x30
+  {   3,  14,  13 },   // 0x31
+  {   2,  14,  13 },   // 0x32
+  {   1,  14,  12 },   // 0x33
+  {   1,  14,  13 },   // 0x34
+  {   2,  14,  13 },   // 0x35
+  {   1,  14,  13 },   // 0x36
+  {   1,  14,  12 },   // 0x37
+  {   1,  14,  13 },   // 0x38
+  {   1,  14,  13 },   // 0x39
+  {   2,   8,   6 },   // 0x3A
+  {   1,   8,   6 },   // 0x3B
+  {   2,  17,  15 },   // 0x3C
+  {   2,  17,  15 },   // 0x3D
+  {   2,  17,  15 },   // 0x3E
+  {   1,  12,  10 },   // 0x3F
+  {   1,  20,  18 },   // 0x40
+  {   0,  15,  15 },   // 0x41
+  {   2,  15,  14 },   // 0x42
+  {   1,  15,  13 },   // 0x43
+  {   2,  17,  16 },   // 0x44
+  {   2,  14,  12 },   // 0x45
+  {   2,  14,  12 },   // 0x46
+  {   1,  16,  15 },   // 0x47
+  {   2,  17,  15 },   // 0x48
+  {   2,   7,   6 },   // 0x49
+  {  -1,   7,   6 },   // 0x4A
+  {   2,  16,  16 },   // 0x4B
+  {   2,  13,  12 },   // 0x4C
+  {   2,  20,  18 },   // 0x4D
+  {   2,  17,  15 },   // 0x4E
+  {   1,  17,  16 },   // 0x4F
+  {   2,  15,  14 },   // 0x50
+  {   1,  17,  16 },   // 0x51
+  {   2,  15,  15 },   // 0x52
+  {   1,  14,  13 },   // 0x53
+  {   0,  14,  14 },   // 0x54
+  {   2,  16,  15 },   // 0x55
+  {   0,  15,  15 },   // 0x56
+  {   1,  22,  22 },   // 0x57
+  {   0,  15,  15 },   // 0x58
+  {  -1,  14,  15 },   // 0x59
+  {   1,  15,  14 },   // 0x5A
+  {   2,   9,   8 },   // 0x5B
+  {   0,   7,   7 },   // 0x5C
+  {   1,   9,   7 },   // 0x5D
+  {   2,  17,  15 },   // 0x5E
+  {   0,  10,  10 },   // 0x5F
+  {   1,  10,   7 },   // 0x60
+  {   1,  14,  12 },   // 0x61
+  {   2,  14,  14 },   // 0x62
+  {   1,  12,  11 },   // 0x63
+  {   1,  14,  13 },   // 0x64
+  {   1,  14,  13 },   // 0x65
+  {   0,   9,   9 },   // 0x66
+  {   1,  14,  13 },   // 0x67
+  {   2,  14,  13 },   // 0x68
+  {   2,   7,   6 },   // 0x69
+  {   0,   7,   6 },   // 0x6A
+  {   2,  13,  14 },   // 0x6B
+  {   2,   7,   6 },   // 0x6C
+  {   2,  21,  20 },   // 0x6D
+  {   2,  14,  13 },   // 0x6E
+  {   1,  14,  13 },   // 0x6F
+  {   2,  14,  14 },   // 0x70
+  {   1,  14,  13 },   // 0x71
+  {   2,  10,  10 },   // 0x72
+  {   1,  12,  11 },   // 0x73
+  {   0,  10,  10 },   // 0x74
+  {   2,  14,  13 },   // 0x75
+  {   0,  13,  12 },   // 0x76
+  {   1,  18,  18 },   // 0x77
+  {   1,  13,  13 },   // 0x78
+  {   1,  13,  13 },   // 0x79
+  {   1,  12,  11 },   // 0x7A
+  {   3,  14,  12 },   // 0x7B
+  {   3,   7,   5 },   // 0x7C
+  {   2,  14,  11 },   // 0x7D
+  {   2,  17,  15 },   // 0x7E
+  {   1,  12,  11 },   // 0x7F
+  {   1,  12,  11 },   // 0x80
+  {   1,  12,  11 },   // 0x81
+  {   1,  12,  11 },   // 0x82
+  {   1,  12,  11 },   // 0x83
+  {   1,  12,  11 },   // 0x84
+  {   1,  12,  11 },   // 0x85
+  {   1,  12,  11 },   // 0x86
+  {   1,  12,  11 },   // 0x87
+  {   1,  12,  11 },   // 0x88
+  {   1,  12,  11 },   // 0x89
+  {   1,  12,  11 },   // 0x8A
+  {   1,  12,  11 },   // 0x8B
+  {   1,  12,  11 },   // 0x8C
+  {   1,  12,  11 },   // 0x8D
+  {   1,  12,  11 },   // 0x8E
+  {   1,  12,  11 },   // 0x8F
+  {   1,  12,  11 },   // 0x90
+  {   1,  12,  11 },   // 0x91
+  {   1,  12,  11 },   // 0x92
+  {   1,  12,  11 },   // 0x93
+  {   1,  12,  11 },   // 0x94
+  {   1,  12,  11 },   // 0x95
+  {   1,  12,  11 },   // 0x96
+  {   1,  12,  11 },   // 0x97
+  {   1,  12,  11 },   // 0x98
+  {   1,  12,  11 },   // 0x99
+  {   1,  12,  11 },   // 0x9A
+  {   1,  12,  11 },   // 0x9B
+  {   1,  12,  11 },   // 0x9C
+  {   1,  12,  11 },   // 0x9D
+  {   1,  12,  11 },   // 0x9E
+  {   1,  12,  11 },   // 0x9F
+  {   0,   7,   1 },   // 0xA0
+  {   3,   9,   7 },   // 0xA1
+  {   2,  14,  12 },   // 0xA2
+  {   1,  14,  12 },   // 0xA3
+  {   1,  13,  11 },   // 0xA4
+  {   0,  14,  14 },   // 0xA5
+  {   3,   7,   5 },   // 0xA6
+  {   1,  10,  11 },   // 0xA7
+  {   2,  10,   8 },   // 0xA8
+  {   3,  20,  17 },   // 0xA9
+  {   2,  11,  10 },   // 0xAA
+  {   2,  13,  12 },   // 0xAB
+  {   2,  17,  15 },   // 0xAC
+  {   1,   8,   7 },   // 0xAD
+  {   3,  20,  17 },   // 0xAE
+  {   2,  10,   8 },   // 0xAF
+  {   2,  10,   9 },   // 0xB0
+  {   2,  17,  14 },   // 0xB1
+  {   1,   9,   8 },   // 0xB2
+  {   1,   9,   8 },   // 0xB3
+  {   4,  10,  10 },   // 0xB4
+  {   2,  15,  14 },   // 0xB5
+  {   1,  13,  11 },   // 0xB6
+  {   2,   8,   6 },   // 0xB7
+  {   3,  10,   7 },   // 0xB8
+  {   1,   9,   7 },   // 0xB9
+  {   1,  11,  10 },   // 0xBA
+  {   2,  13,  12 },   // 0xBB
+  {   1,  21,  19 },   // 0xBC
+  {   1,  21,  20 },   // 0xBD
+  {   1,  21,  19 },   // 0xBE
+  {   1,  12,  10 },   // 0xBF
+  {   0,  15,  15 },   // 0xC0
+  {   0,  15,  15 },   // 0xC1
+  {   0,  15,  15 },   // 0xC2
+  {   0,  15,  15 },   // 0xC3
+  {   0,  15,  15 },   // 0xC4
+  {   0,  15,  15 },   // 0xC5
+  {   0,  22,  20 },   // 0xC6
+  {   1,  15,  13 },   // 0xC7
+  {   2,  14,  12 },   // 0xC8
+  {   2,  14,  12 },   // 0xC9
+  {   2,  14,  12 },   // 0xCA
+  {   2,  14,  12 },   // 0xCB
+  {   0,   7,   6 },   // 0xCC
+  {   2,   7,   7 },   // 0xCD
+  {   0,   7,   8 },   // 0xCE
+  {   1,   7,   7 },   // 0xCF
+  {   0,  17,  16 },   // 0xD0
+  {   2,  17,  15 },   // 0xD1
+  {   1,  17,  16 },   // 0xD2
+  {   1,  17,  16 },   // 0xD3
+  {   1,  17,  16 },   // 0xD4
+  {   1,  17,  16 },   // 0xD5
+  {   1,  17,  16 },   // 0xD6
+  {   3,  17,  15 },   // 0xD7
+  {   0,  17,  16 },   // 0xD8
+  {   2,  16,  15 },   // 0xD9
+  {   2,  16,  15 },   // 0xDA
+  {   2,  16,  15 },   // 0xDB
+  {   2,  16,  15 },   // 0xDC
+  {  -1,  14,  15 },   // 0xDD
+  {   2,  15,  14 },   // 0xDE
+  {   2,  14,  14 },   // 0xDF
+  {   1,  14,  12 },   // 0xE0
+  {   1,  14,  12 },   // 0xE1
+  {   1,  14,  12 },   // 0xE2
+  {   1,  14,  12 },   // 0xE3
+  {   1,  14,  12 },   // 0xE4
+  {   1,  14,  12 },   // 0xE5
+  {   1,  21,  20 },   // 0xE6
+  {   1,  12,  11 },   // 0xE7
+  {   1,  14,  13 },   // 0xE8
+  {   1,  14,  13 },   // 0xE9
+  {   1,  14,  13 },   // 0xEA
+  {   1,  14,  13 },   // 0xEB
+  {   0,   7,   6 },   // 0xEC
+  {   2,   7,   9 },   // 0xED
+  {   0,   7,   8 },   // 0xEE
+  {   1,   7,   7 },   // 0xEF
+  {   1,  14,  13 },   // 0xF0
+  {   2,  14,  13 },   // 0xF1
+  {   1,  14,  13 },   // 0xF2
+  {   1,  14,  13 },   // 0xF3
+  {   1,  14,  13 },   // 0xF4
+  {   1,  14,  13 },   // 0xF5
+  {   1,  14,  13 },   // 0xF6
+  {   2,  17,  15 },   // 0xF7
+  {   1,  14,  13 },   // 0xF8
+  {   2,  14,  13 },   // 0xF9
+  {   2,  14,  13 },   // 0xFA
+  {   2,  14,  13 },   // 0xFB
+  {   2,  14,  13 },   // 0xFC
+  {   1,  13,  13 },   // 0xFD
+  {   2,  14,  14 },   // 0xFE
+  {   1,  13,  13 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold10pt8bWidths = { DejaVuSans_Bold10pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD10PTLAT1__H
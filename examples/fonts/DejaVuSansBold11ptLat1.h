@@ -0,0 +1,929 @@
+#ifndef DEJAVUSANSBOLD11PTLAT1__H
+#define DEJAVUSANSBOLD11PTLAT1__H
+const uint8_t DejaVuSans_Bold11pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0x03, 0x18, 0x0E, 0x30, 0x1C, 0xE0, 0x31, 0x80, 0x63,
+  0x0F, 0xFF, 0xDF, 0xFF, 0x86, 0x30, 0x0C, 0x60, 0x18, 0xC3, 0xFF, 0xF7,
+  0xFF, 0xE1, 0x8C, 0x03, 0x18, 0x0E, 0x70, 0x18, 0xC0, 0x06, 0x00, 0x60,
+  0x1F, 0xC7, 0xFE, 0xF6, 0x2E, 0x60, 0xE6, 0x0F, 0xF0, 0xFF, 0xE7, 0xFE,
+  0x0F, 0xF0, 0x6F, 0x06, 0x78, 0x67, 0xFF, 0xE3, 0xFC, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x3E, 0x03, 0x03, 0xF8, 0x38, 0x38, 0xE1, 0x81, 0xC7, 0x18,
+  0x0E, 0x39, 0xC0, 0x71, 0xCC, 0x03, 0x8E, 0xE0, 0x0F, 0xE6, 0x7C, 0x3E,
+  0x67, 0xF0, 0x07, 0x71, 0xC0, 0x33, 0x8E, 0x03, 0x9C, 0x70, 0x18, 0xE3,
+  0x81, 0x87, 0x1C, 0x1C, 0x1F, 0xC0, 0xC0, 0x7C, 0x0F, 0xC0, 0x0F, 0xF0,
+  0x0F, 0x08, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x1C, 0xFF,
+  0x0E, 0xFB, 0xCF, 0x78, 0xE7, 0x3C, 0x7F, 0x9E, 0x1F, 0xCF, 0x87, 0xC3,
+  0xE7, 0xE0, 0xFF, 0xF8, 0x3F, 0x9E, 0xFF, 0xFF, 0xC0, 0x1E, 0x38, 0xF1,
+  0xC7, 0x8F, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x1E, 0x3C, 0x38,
+  0x78, 0x70, 0xF0, 0xF0, 0xE1, 0xE1, 0xC3, 0xC7, 0x87, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xCF, 0x1E, 0x38, 0xF1, 0xC7, 0x80, 0x0C, 0x03, 0x0C,
+  0xCF, 0xFF, 0x3F, 0x0F, 0xCF, 0xFF, 0x33, 0x0C, 0x03, 0x00, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+  0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x7B, 0xDE, 0xF7, 0x73,
+  0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x07, 0x07, 0x06, 0x06, 0x0E, 0x0C,
+  0x0C, 0x1C, 0x18, 0x18, 0x38, 0x30, 0x30, 0x70, 0x60, 0x60, 0xE0, 0xE0,
+  0x0F, 0x81, 0xFF, 0x1E, 0x3C, 0xF1, 0xEF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xF7, 0x8F, 0x3C, 0x78, 0xFF,
+  0x81, 0xF0, 0x3F, 0x0F, 0xF0, 0xCF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xFF,
+  0xFF, 0xFF, 0x3F, 0x8F, 0xFE, 0xE1, 0xEC, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x1F, 0x01, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFF,
+  0xFF, 0xFF, 0x3F, 0x87, 0xFE, 0x41, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01,
+  0xE1, 0xFC, 0x1F, 0xE0, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x1F, 0xFF,
+  0xE7, 0xF8, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x1F, 0xC1, 0xFE, 0x1E, 0xF0,
+  0xE7, 0x8E, 0x3C, 0xE1, 0xE6, 0x0F, 0x3F, 0xFF, 0xFF, 0xF0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x7F, 0xE7, 0xFE, 0x70, 0x07, 0x00, 0x70, 0x07,
+  0x00, 0x7F, 0x87, 0xFE, 0x41, 0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFC,
+  0x1E, 0xFF, 0xC3, 0xF8, 0x07, 0xE0, 0xFF, 0x8F, 0x04, 0xF0, 0x07, 0x00,
+  0x7B, 0xE3, 0xFF, 0xDF, 0x1E, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xF7,
+  0x07, 0xBC, 0x78, 0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x1E,
+  0x01, 0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0xF8, 0x0F, 0x01, 0xF0,
+  0x1E, 0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x1F, 0xC3, 0xFF, 0xBE, 0x3F, 0xE0,
+  0xFF, 0x07, 0xF8, 0x3D, 0xE3, 0xC7, 0xFC, 0x3F, 0xE3, 0xC7, 0xBC, 0x1F,
+  0xE0, 0xFF, 0x07, 0xFC, 0x7D, 0xFF, 0xC3, 0xF8, 0x1F, 0x81, 0xFF, 0x1E,
+  0x3D, 0xE0, 0xEF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0x78, 0xFB, 0xFF,
+  0xC7, 0xDE, 0x00, 0xE0, 0x0F, 0x20, 0xF1, 0xFF, 0x07, 0xE0, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x7B, 0xDE, 0xF0, 0x00, 0x00, 0x7B, 0xDE, 0xF7,
+  0x73, 0x00, 0x00, 0x04, 0x00, 0xF0, 0x1F, 0xC3, 0xF8, 0x7F, 0x03, 0xE0,
+  0x0F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xC0, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x03, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xF0,
+  0x07, 0xC0, 0xFE, 0x1F, 0xC3, 0xF8, 0x0F, 0x00, 0x20, 0x00, 0x7F, 0x3F,
+  0xE8, 0x3C, 0x0F, 0x03, 0xC1, 0xE1, 0xF0, 0x78, 0x3C, 0x0F, 0x00, 0x00,
+  0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x01, 0xF8, 0x01, 0xFF, 0xC0, 0x78,
+  0x1E, 0x1C, 0x00, 0xC7, 0x00, 0x0C, 0xC3, 0xD9, 0xF8, 0xFF, 0x1E, 0x38,
+  0xE3, 0xC6, 0x0C, 0x78, 0xC1, 0x8F, 0x18, 0x33, 0xE3, 0x8E, 0xEE, 0x3F,
+  0xF8, 0xC3, 0xDE, 0x1C, 0x00, 0x01, 0xC0, 0x10, 0x1E, 0x0F, 0x01, 0xFF,
+  0xC0, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE,
+  0x00, 0xF7, 0x80, 0x7B, 0xC0, 0x38, 0xE0, 0x3C, 0x78, 0x1E, 0x3C, 0x1E,
+  0x0F, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0x80, 0xF3, 0xC0, 0x79, 0xE0, 0x3D,
+  0xE0, 0x0F, 0xFF, 0x87, 0xFF, 0x3C, 0x7D, 0xE1, 0xEF, 0x0F, 0x78, 0x7B,
+  0xC7, 0xDF, 0xFC, 0xFF, 0xF7, 0x87, 0xBC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
+  0x7F, 0xFF, 0xDF, 0xF8, 0x07, 0xF8, 0x7F, 0xF3, 0xE0, 0xDE, 0x01, 0x78,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x1E,
+  0x00, 0x78, 0x04, 0xF8, 0x31, 0xFF, 0xC1, 0xFE, 0xFF, 0xC1, 0xFF, 0xE3,
+  0xC3, 0xE7, 0x81, 0xEF, 0x03, 0xDE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0,
+  0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x81, 0xEF, 0x03, 0xDE, 0x1F, 0x3F, 0xFC,
+  0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+  0xFE, 0xFF, 0xDE, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xFF, 0xFF,
+  0xFE, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0x07, 0xF8,
+  0x3F, 0xF8, 0xF8, 0x73, 0xC0, 0x27, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x3F, 0xC0, 0x7B, 0xC0, 0xF7, 0x81, 0xE7, 0xC3,
+  0xC7, 0xFF, 0x83, 0xFC, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E,
+  0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x7B, 0xF7, 0x80, 0xF0, 0x3C,
+  0xF0, 0x78, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00,
+  0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0,
+  0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x3E, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xF8,
+  0x7F, 0xFE, 0x1F, 0xFF, 0xCF, 0xFF, 0x73, 0xBF, 0xDF, 0xEF, 0xF3, 0xF3,
+  0xFC, 0xFC, 0xFF, 0x1E, 0x3F, 0xC7, 0x8F, 0xF1, 0xE3, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFE,
+  0x3F, 0xF8, 0xFF, 0x73, 0xFD, 0xCF, 0xF3, 0xBF, 0xCF, 0xFF, 0x1F, 0xFC,
+  0x7F, 0xF0, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x1F, 0x07, 0xF0, 0x0F, 0xFE,
+  0x0F, 0x07, 0x8F, 0x01, 0xE7, 0x80, 0xF7, 0x80, 0x3F, 0xC0, 0x1F, 0xE0,
+  0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xEF, 0x01, 0xE7, 0x80, 0xF1,
+  0xE0, 0xF0, 0x7F, 0xF0, 0x0F, 0xE0, 0xFF, 0xC7, 0xFF, 0xBC, 0x3D, 0xE0,
+  0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x1E, 0xFF, 0xF7, 0xFE, 0x3C, 0x01,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0x07, 0xF0, 0x0F, 0xFE,
+  0x0F, 0x07, 0x8F, 0x01, 0xE7, 0x80, 0xF7, 0x80, 0x3F, 0xC0, 0x1F, 0xE0,
+  0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xEF, 0x01, 0xE7, 0x80, 0xF1,
+  0xE0, 0xF0, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0xFF, 0x83, 0xFF, 0x8F, 0x1F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF,
+  0x0F, 0x3C, 0x78, 0xFF, 0xC3, 0xFF, 0x0F, 0x1E, 0x3C, 0x7C, 0xF0, 0xF3,
+  0xC3, 0xEF, 0x07, 0xBC, 0x1F, 0x1F, 0xF3, 0xFF, 0x9E, 0x1D, 0xE0, 0x2F,
+  0x00, 0x7C, 0x03, 0xFC, 0x0F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0x3E, 0x00,
+  0xF8, 0x07, 0xF0, 0x7B, 0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xE3,
+  0xFF, 0x07, 0xF8, 0xF0, 0x07, 0xBC, 0x07, 0x9E, 0x03, 0xCF, 0x83, 0xE3,
+  0xC1, 0xE1, 0xE0, 0xF0, 0xF8, 0xF8, 0x3C, 0x78, 0x1E, 0x3C, 0x07, 0xBC,
+  0x03, 0xDE, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x07,
+  0xC0, 0xF0, 0x7C, 0x1F, 0xE0, 0xF8, 0x3D, 0xE1, 0xF0, 0xF3, 0xC3, 0xE1,
+  0xE7, 0x8F, 0xE3, 0xCF, 0x1D, 0xC7, 0x8F, 0x3B, 0x9E, 0x1E, 0x77, 0x3C,
+  0x3D, 0xEF, 0x78, 0x7B, 0x8E, 0xF0, 0x7F, 0x1F, 0xE0, 0xFE, 0x3F, 0x81,
+  0xFC, 0x7F, 0x03, 0xF0, 0x7E, 0x07, 0xE0, 0xFC, 0x07, 0xC1, 0xF0, 0xF8,
+  0x1F, 0x7C, 0x3E, 0x3E, 0x7C, 0x3E, 0x7C, 0x1F, 0xF8, 0x0F, 0xF0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3E,
+  0x7C, 0x3C, 0x3C, 0x7C, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0x7C, 0x3E, 0x3C,
+  0x3C, 0x3E, 0x7C, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xC0, 0x3E, 0x01, 0xF8,
+  0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xF0, 0x1F, 0x80,
+  0x7C, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x8F, 0x1E,
+  0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xFF,
+  0xF0, 0xE0, 0xE0, 0x60, 0x60, 0x70, 0x30, 0x30, 0x38, 0x18, 0x18, 0x1C,
+  0x0C, 0x0C, 0x0E, 0x06, 0x06, 0x07, 0x07, 0xFF, 0xFC, 0x78, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xFF,
+  0xF0, 0x07, 0x80, 0x3F, 0x01, 0xFE, 0x0F, 0x3C, 0x78, 0x7B, 0x80, 0x70,
+  0xFF, 0xFF, 0xFC, 0xE1, 0xC3, 0x87, 0x3F, 0x87, 0xFE, 0x41, 0xF0, 0x0F,
+  0x3F, 0xF7, 0xFF, 0xF8, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x7F, 0xF3, 0xCF,
+  0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x79, 0xE3, 0xFF, 0x9F,
+  0x1E, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xE3,
+  0xDF, 0xFC, 0xF3, 0xC0, 0x0F, 0xC7, 0xFD, 0xF0, 0xFC, 0x0F, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF8, 0x0F, 0x84, 0xFF, 0x87, 0xE0, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x8F, 0x3C, 0xFF, 0xEF, 0x1F, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3D, 0xE3, 0xE7, 0xFF, 0x1E,
+  0x78, 0x0F, 0xC1, 0xFF, 0x1E, 0x3D, 0xE0, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0xF0, 0x03, 0xC0, 0x8F, 0xFC, 0x1F, 0x80, 0x0F, 0xC7, 0xF3,
+  0xC0, 0xF0, 0x3C, 0x3F, 0xEF, 0xF8, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x00, 0x1E, 0x79, 0xFF, 0xDE, 0x3F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7B, 0xC7, 0xCF,
+  0xFE, 0x3C, 0xF0, 0x07, 0x80, 0x7D, 0x07, 0xCF, 0xFC, 0x3F, 0x80, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x3C, 0xFF, 0xEF, 0x9F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x3C,
+  0x78, 0xF0, 0x03, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x3C, 0x78, 0xFF, 0xDF, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x7B, 0xC7, 0x9E, 0x78, 0xF7, 0x87, 0xF8, 0x3F, 0x81,
+  0xFE, 0x0F, 0xF8, 0x7B, 0xE3, 0xCF, 0x9E, 0x3E, 0xF0, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF3, 0xC7, 0xCF, 0xFE, 0xFE,
+  0xF8, 0xF8, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0,
+  0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F,
+  0x0F, 0xF3, 0xCF, 0xFE, 0xF9, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x0F, 0xC1, 0xFF, 0x1E, 0x3D,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7B, 0xC7, 0x8F,
+  0xF8, 0x1F, 0x80, 0xF3, 0xC7, 0xFF, 0x3E, 0x3D, 0xE0, 0xFF, 0x07, 0xF8,
+  0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xBF, 0xF9, 0xE7, 0x8F, 0x00,
+  0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0x1E, 0x79, 0xFF, 0xDE, 0x3F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7B, 0xC7, 0xCF,
+  0xFE, 0x3C, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0xF3,
+  0xFF, 0xFE, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x00, 0x3F, 0x8F, 0xFB, 0xC1, 0x78, 0x0F, 0x81, 0xFF, 0x1F, 0xF8, 0x3F,
+  0x01, 0xF0, 0x3F, 0xFF, 0x1F, 0xC0, 0x3C, 0x0F, 0x03, 0xC3, 0xFF, 0xFF,
+  0xCF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xF0,
+  0xFC, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x9F, 0x7F, 0xF3, 0xCF, 0xF0, 0x3D, 0xE1, 0xE7, 0x87,
+  0x9E, 0x1E, 0x3C, 0xF0, 0xF3, 0xC1, 0xCE, 0x07, 0xF8, 0x1F, 0xE0, 0x3F,
+  0x00, 0xFC, 0x01, 0xE0, 0xF0, 0xE1, 0xFE, 0x1C, 0x3D, 0xE7, 0xCF, 0x3C,
+  0xF9, 0xE7, 0x9B, 0x3C, 0xF7, 0x77, 0x8F, 0xEF, 0xE1, 0xF8, 0xFC, 0x3F,
+  0x1F, 0x83, 0xE3, 0xE0, 0x78, 0x3C, 0x0F, 0x07, 0x80, 0xF0, 0x3D, 0xE1,
+  0xE3, 0xCF, 0x07, 0x38, 0x1F, 0xE0, 0x3F, 0x00, 0xFC, 0x07, 0xF8, 0x1C,
+  0xE0, 0xF3, 0xC7, 0x87, 0xBC, 0x0F, 0xF8, 0x3D, 0xE1, 0xE7, 0x87, 0x8E,
+  0x1E, 0x3C, 0xF0, 0xF3, 0xC1, 0xCF, 0x07, 0xF8, 0x0F, 0xE0, 0x3F, 0x00,
+  0x7C, 0x01, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x0F, 0xC0, 0x3E, 0x00,
+  0xFF, 0xFF, 0xFC, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x1E, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xC3, 0xF1, 0xE0, 0x78, 0x1E, 0x07,
+  0x81, 0xE0, 0x78, 0x3E, 0x3F, 0x0F, 0xC0, 0xF8, 0x1E, 0x07, 0x81, 0xE0,
+  0x78, 0x1E, 0x07, 0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xF8, 0x3F, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0,
+  0x78, 0x1F, 0x03, 0xF0, 0xFC, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x07, 0x8F, 0xC3, 0xE0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x00,
+  0x00, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x03, 0x00, 0x60, 0x0C, 0x07, 0xE3, 0xFE, 0xFE, 0x7E, 0xC7, 0x98,
+  0xF3, 0x1E, 0x63, 0xCC, 0x3D, 0x87, 0xF2, 0x7F, 0xC3, 0xF0, 0x18, 0x03,
+  0x00, 0x60, 0x07, 0xE1, 0xFF, 0x3E, 0x13, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x0F, 0xFC, 0xFF, 0xC3, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0xFF,
+  0xFF, 0xFF, 0x40, 0x13, 0x01, 0xBF, 0xFE, 0x7F, 0xC3, 0x8E, 0x18, 0x30,
+  0xC1, 0x86, 0x0C, 0x38, 0xE1, 0xFF, 0x1F, 0xFD, 0xC0, 0x64, 0x00, 0x00,
+  0xF8, 0x7D, 0xE1, 0xE7, 0xCF, 0x8F, 0x3C, 0x3F, 0xF0, 0x7F, 0x8F, 0xFF,
+  0xFF, 0xFF, 0x07, 0x80, 0x1E, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
+  0x1F, 0xC7, 0xF9, 0xC1, 0x38, 0x07, 0xC0, 0x7E, 0x1F, 0xF7, 0x1F, 0xE0,
+  0xFC, 0x1F, 0xE3, 0xBF, 0xE3, 0xF8, 0x0F, 0x80, 0x73, 0x0E, 0x7F, 0x8F,
+  0xE0, 0xE7, 0xE7, 0xE7, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+  0x63, 0xE6, 0xE7, 0xE7, 0xCE, 0x23, 0xCC, 0x03, 0xCC, 0x03, 0xCE, 0x23,
+  0xE7, 0xE7, 0x63, 0xE6, 0x70, 0x0E, 0x3C, 0x3C, 0x1F, 0xF8, 0x07, 0xE0,
+  0x3E, 0x3F, 0xC0, 0xE7, 0xFE, 0x3F, 0x1F, 0x9F, 0xFF, 0x7B, 0x80, 0x3F,
+  0xFF, 0xF0, 0x08, 0x46, 0x33, 0x9D, 0xCE, 0xE7, 0x39, 0xC7, 0x38, 0xE7,
+  0x18, 0xC2, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x00, 0x1C,
+  0x00, 0x70, 0x01, 0xC0, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0xF8, 0x3C,
+  0x3C, 0x70, 0x0E, 0x67, 0xE6, 0xE7, 0xF7, 0xC6, 0x33, 0xC7, 0xF3, 0xC7,
+  0xE3, 0xC6, 0xE3, 0xE6, 0x77, 0x66, 0x36, 0x70, 0x0E, 0x3C, 0x3C, 0x1F,
+  0xF8, 0x07, 0xE0, 0xFF, 0xFC, 0x38, 0xFB, 0x1E, 0x3C, 0x6F, 0x8E, 0x00,
+  0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x81, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x7D, 0xFE, 0x18, 0x30, 0xE3, 0x9E, 0x7F, 0xFE, 0xFD,
+  0xFE, 0x18, 0x33, 0xC0, 0xE1, 0xFF, 0xFC, 0x1C, 0xE7, 0x38, 0xF0, 0xF3,
+  0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C,
+  0xF0, 0xF3, 0xE7, 0xCF, 0xFF, 0xFF, 0xCF, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x00, 0x1F, 0xEF, 0xFF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC,
+  0xFF, 0x9B, 0xF3, 0x1E, 0x60, 0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1,
+  0x98, 0x33, 0x06, 0x60, 0xCC, 0xFF, 0xFF, 0x10, 0xFF, 0xE0, 0x73, 0xCF,
+  0x0C, 0x30, 0xC3, 0x3F, 0xFC, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xE1, 0xF8,
+  0x7F, 0x3D, 0xFE, 0x3F, 0x00, 0x07, 0xF9, 0xFE, 0x84, 0x31, 0x8E, 0x71,
+  0xCE, 0x39, 0xCE, 0x77, 0x3B, 0x9C, 0xC6, 0x21, 0x00, 0x70, 0x0F, 0x1E,
+  0x01, 0xC3, 0xC0, 0x78, 0x18, 0x0E, 0x03, 0x03, 0xC0, 0x60, 0x70, 0x0C,
+  0x1E, 0x07, 0xE3, 0x9C, 0xFC, 0xE7, 0x80, 0x3C, 0xB0, 0x07, 0x36, 0x01,
+  0xEC, 0xC0, 0x39, 0xFE, 0x0F, 0x3F, 0xC1, 0xC0, 0x60, 0x78, 0x0C, 0x70,
+  0x0F, 0x1E, 0x01, 0xC3, 0xC0, 0x78, 0x18, 0x0E, 0x03, 0x03, 0xC0, 0x60,
+  0x70, 0x0C, 0x1E, 0x07, 0xE3, 0xBE, 0xFC, 0xEF, 0xE0, 0x3D, 0x0C, 0x07,
+  0x01, 0x81, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0x0F, 0x01, 0xC3, 0xF8, 0x78,
+  0x7F, 0xFC, 0x07, 0x8F, 0xE0, 0x70, 0x86, 0x0F, 0x00, 0x60, 0xE0, 0x3C,
+  0x1E, 0x00, 0x61, 0xC0, 0x86, 0x3C, 0x0F, 0xE3, 0x9C, 0xFC, 0x73, 0xC0,
+  0x0F, 0x2C, 0x00, 0xE6, 0xC0, 0x1E, 0xCC, 0x01, 0xCF, 0xF0, 0x3C, 0xFF,
+  0x03, 0x80, 0xC0, 0x78, 0x0C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x00, 0x00,
+  0x00, 0xF0, 0x3C, 0x1F, 0x0F, 0x87, 0xC3, 0xE0, 0xF0, 0x3C, 0x0F, 0x05,
+  0xFF, 0x3F, 0x80, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xBC,
+  0x03, 0xDE, 0x01, 0xC7, 0x01, 0xE3, 0xC0, 0xF1, 0xE0, 0xF0, 0x78, 0x7F,
+  0xFC, 0x3F, 0xFE, 0x3C, 0x07, 0x9E, 0x03, 0xCF, 0x01, 0xEF, 0x00, 0x78,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xBC, 0x03, 0xDE, 0x01,
+  0xC7, 0x01, 0xE3, 0xC0, 0xF1, 0xE0, 0xF0, 0x78, 0x7F, 0xFC, 0x3F, 0xFE,
+  0x3C, 0x07, 0x9E, 0x03, 0xCF, 0x01, 0xEF, 0x00, 0x78, 0x03, 0xE0, 0x01,
+  0xB0, 0x01, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0xC0,
+  0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xBC, 0x03, 0xDE, 0x01, 0xC7, 0x01, 0xE3,
+  0xC0, 0xF1, 0xE0, 0xF0, 0x78, 0x7F, 0xFC, 0x3F, 0xFE, 0x3C, 0x07, 0x9E,
+  0x03, 0xCF, 0x01, 0xEF, 0x00, 0x78, 0x03, 0xB0, 0x03, 0xF8, 0x01, 0xB8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x07, 0xBC, 0x03, 0xDE, 0x01, 0xC7, 0x01, 0xE3, 0xC0, 0xF1, 0xE0,
+  0xF0, 0x78, 0x7F, 0xFC, 0x3F, 0xFE, 0x3C, 0x07, 0x9E, 0x03, 0xCF, 0x01,
+  0xEF, 0x00, 0x78, 0x07, 0x70, 0x03, 0xB8, 0x01, 0xDC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xBC,
+  0x03, 0xDE, 0x01, 0xC7, 0x01, 0xE3, 0xC0, 0xF1, 0xE0, 0xF0, 0x78, 0x7F,
+  0xFC, 0x3F, 0xFE, 0x3C, 0x07, 0x9E, 0x03, 0xCF, 0x01, 0xEF, 0x00, 0x78,
+  0x03, 0xE0, 0x03, 0xF8, 0x01, 0x8C, 0x00, 0xC6, 0x00, 0x7F, 0x00, 0x3F,
+  0x80, 0x1F, 0xC0, 0x1F, 0xF0, 0x0F, 0x78, 0x07, 0xBC, 0x07, 0xDF, 0x03,
+  0xC7, 0x81, 0xE3, 0xC1, 0xF1, 0xF0, 0xFF, 0xF8, 0x7F, 0xFC, 0x78, 0x0F,
+  0x3C, 0x07, 0x9E, 0x03, 0xDE, 0x00, 0xF0, 0x01, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xF0, 0x3D, 0xE0, 0x01, 0xF7, 0x80, 0x07, 0x9E, 0x00, 0x3E, 0x78, 0x00,
+  0xF1, 0xE0, 0x03, 0xC7, 0xFE, 0x1F, 0x1F, 0xF8, 0x7F, 0xF8, 0x03, 0xFF,
+  0xE0, 0x0F, 0x07, 0x80, 0x7C, 0x1E, 0x01, 0xE0, 0x78, 0x07, 0x81, 0xFF,
+  0xFE, 0x07, 0xFF, 0x07, 0xF8, 0x7F, 0xF3, 0xE0, 0xDE, 0x01, 0x78, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00,
+  0x78, 0x04, 0xF8, 0x31, 0xFF, 0xC1, 0xFE, 0x00, 0x40, 0x01, 0x80, 0x3E,
+  0x00, 0xF0, 0x38, 0x03, 0x80, 0x38, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF, 0xBC, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0xFD, 0xFF, 0xBC, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xFF, 0xFE,
+  0x1E, 0x07, 0xE1, 0x86, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF, 0xBC, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xC0, 0x7F, 0xFF, 0xFE, 0x39, 0xC7, 0x38, 0xE7, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF,
+  0xBC, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xFF, 0xFE, 0xE1, 0xC3,
+  0x80, 0x00, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0x3B, 0xB8, 0x00, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE,
+  0xF7, 0xBD, 0xEF, 0x00, 0x3C, 0x7E, 0xC3, 0x00, 0x00, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0xE7, 0xE7, 0xE7, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0xF0,
+  0x1F, 0xFE, 0x0F, 0x0F, 0x87, 0x81, 0xE3, 0xC0, 0xF1, 0xE0, 0x3C, 0xF0,
+  0x1F, 0xFF, 0x0F, 0xFF, 0x87, 0x9E, 0x03, 0xCF, 0x01, 0xE7, 0x81, 0xE3,
+  0xC0, 0xF1, 0xE1, 0xF0, 0xFF, 0xF0, 0x7F, 0xE0, 0x0E, 0xC0, 0x7F, 0x01,
+  0xB8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x3F,
+  0xF8, 0xFF, 0xE3, 0xFD, 0xCF, 0xF7, 0x3F, 0xCE, 0xFF, 0x3F, 0xFC, 0x7F,
+  0xF1, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x7C, 0x07, 0x00, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xF0,
+  0x78, 0x3C, 0x78, 0x0F, 0x3C, 0x07, 0xBC, 0x01, 0xFE, 0x00, 0xFF, 0x00,
+  0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0x78, 0x0F, 0x3C, 0x07, 0x8F,
+  0x07, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x78, 0x3C, 0x78,
+  0x0F, 0x3C, 0x07, 0xBC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F,
+  0xC0, 0x1F, 0xE0, 0x0F, 0x78, 0x0F, 0x3C, 0x07, 0x8F, 0x07, 0x83, 0xFF,
+  0x80, 0x7F, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0x0C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x78, 0x3C, 0x78, 0x0F, 0x3C, 0x07,
+  0xBC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0,
+  0x0F, 0x78, 0x0F, 0x3C, 0x07, 0x8F, 0x07, 0x83, 0xFF, 0x80, 0x7F, 0x00,
+  0x03, 0xB0, 0x03, 0xF8, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x7F, 0xF0, 0x78, 0x3C, 0x78, 0x0F, 0x3C, 0x07, 0xBC, 0x01, 0xFE,
+  0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0x78, 0x0F,
+  0x3C, 0x07, 0x8F, 0x07, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x07, 0x70, 0x03,
+  0xB8, 0x01, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xF0,
+  0x78, 0x3C, 0x78, 0x0F, 0x3C, 0x07, 0xBC, 0x01, 0xFE, 0x00, 0xFF, 0x00,
+  0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0x78, 0x0F, 0x3C, 0x07, 0x8F,
+  0x07, 0x83, 0xFF, 0x80, 0x7F, 0x00, 0x40, 0x17, 0x01, 0xDC, 0x1C, 0x71,
+  0xC1, 0xDC, 0x07, 0xC0, 0x1C, 0x01, 0xF0, 0x1D, 0xC1, 0xC7, 0x1C, 0x1D,
+  0xC0, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x98, 0x3F, 0xFE, 0x0F,
+  0x07, 0xC3, 0xC0, 0x78, 0x78, 0x1F, 0x9E, 0x06, 0xF3, 0xC1, 0x9E, 0x78,
+  0x63, 0xCF, 0x18, 0x79, 0xE6, 0x0F, 0x3D, 0x81, 0xE7, 0xE0, 0x78, 0x78,
+  0x0F, 0x0F, 0x83, 0xC1, 0xFF, 0xF0, 0x67, 0xF8, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0x8F, 0xFC, 0x1F, 0xE0, 0x01, 0xC0,
+  0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0x8F, 0xFC, 0x1F, 0xE0, 0x07,
+  0x80, 0x3F, 0x01, 0x86, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0x8F, 0xFC, 0x1F, 0xE0,
+  0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0x8F, 0xFC, 0x1F,
+  0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x1F, 0x7C, 0x3E, 0x3C, 0x3C, 0x3E, 0x7C, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x07, 0x80, 0x3C, 0x01,
+  0xFF, 0x8F, 0xFF, 0x78, 0x7B, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x3D, 0xFF, 0xEF, 0xFC, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0x3F, 0x83, 0xFE,
+  0x3E, 0x79, 0xE1, 0xCF, 0x1E, 0x79, 0xC3, 0xDC, 0x1E, 0xE0, 0xF7, 0x87,
+  0xBF, 0x3C, 0xFD, 0xE1, 0xFF, 0x07, 0xF8, 0x3F, 0xD1, 0xFE, 0xFE, 0xF3,
+  0xE0, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x87,
+  0xFE, 0x41, 0xF0, 0x0F, 0x3F, 0xF7, 0xFF, 0xF8, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x1F, 0x7F, 0xF3, 0xCF, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x00,
+  0x00, 0x3F, 0x87, 0xFE, 0x41, 0xF0, 0x0F, 0x3F, 0xF7, 0xFF, 0xF8, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x1F, 0x7F, 0xF3, 0xCF, 0x0F, 0x00, 0xF0, 0x19, 0x83,
+  0x0C, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xFE, 0x41, 0xF0, 0x0F, 0x3F, 0xF7,
+  0xFF, 0xF8, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x7F, 0xF3, 0xCF, 0x0C, 0xC1,
+  0xEC, 0x1B, 0xC1, 0x98, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xFE, 0x41, 0xF0,
+  0x0F, 0x3F, 0xF7, 0xFF, 0xF8, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x7F, 0xF3,
+  0xCF, 0x1C, 0xE1, 0xCE, 0x1C, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xE4,
+  0x1F, 0x00, 0xF3, 0xFF, 0x7F, 0xFF, 0x8F, 0xF0, 0xFF, 0x0F, 0xF1, 0xF7,
+  0xFF, 0x3C, 0xF0, 0x0F, 0x01, 0xF8, 0x19, 0x81, 0x98, 0x1F, 0x80, 0xF0,
+  0x00, 0x00, 0x00, 0x3F, 0x87, 0xFE, 0x41, 0xF0, 0x0F, 0x3F, 0xF7, 0xFF,
+  0xF8, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x7F, 0xF3, 0xCF, 0x3F, 0x0F, 0xC3,
+  0xFE, 0xFF, 0x10, 0x7E, 0x3C, 0x01, 0xE0, 0xF3, 0xFF, 0x07, 0xBF, 0xFF,
+  0xFF, 0xE3, 0xFF, 0xFE, 0x1E, 0x00, 0xF0, 0xF0, 0x07, 0x8F, 0xC0, 0x9F,
+  0xEF, 0xFC, 0x7C, 0x3F, 0x80, 0x0F, 0xC7, 0xFD, 0xF0, 0xFC, 0x0F, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x0F, 0x84, 0xFF, 0x87, 0xE0, 0x10, 0x03,
+  0x03, 0xE0, 0x78, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x03, 0xC0, 0x0F, 0x02, 0x3F, 0xF0, 0x7E, 0x00, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x78, 0xF7,
+  0x83, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xC0, 0x0F, 0x02, 0x3F,
+  0xF0, 0x7E, 0x00, 0x0F, 0x00, 0x78, 0x06, 0x60, 0x61, 0x80, 0x00, 0x00,
+  0x00, 0x3F, 0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x03, 0xC0, 0x0F, 0x02, 0x3F, 0xF0, 0x7E, 0x00, 0x1C, 0xE0, 0xE7,
+  0x07, 0x38, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x8F, 0x1E, 0xF0, 0x7F,
+  0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x01, 0xE0, 0x47, 0xFE, 0x0F,
+  0xC0, 0xE1, 0xC3, 0x87, 0x00, 0x03, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF0, 0x0E, 0x38, 0xE3, 0x80, 0x00, 0x3C, 0x78, 0xF1, 0xE3,
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE0, 0x3C, 0x3C, 0x66, 0xC3, 0x00,
+  0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0xE7, 0xE7, 0xE7, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x30, 0x7F, 0x83, 0xE0, 0x7F,
+  0x06, 0x3C, 0x00, 0xF0, 0x7F, 0x8F, 0xFE, 0x78, 0xFF, 0x83, 0xFC, 0x1F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3D, 0xE3, 0xC7, 0xFC, 0x1F, 0xC0, 0x0C, 0xC1,
+  0xEC, 0x1B, 0xC1, 0x98, 0x00, 0x00, 0x00, 0xF3, 0xCF, 0xFE, 0xF9, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F,
+  0xC1, 0xEF, 0x1E, 0x3F, 0xE0, 0x7E, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xEF, 0x1E, 0x3F, 0xE0, 0x7E,
+  0x00, 0x07, 0x00, 0x7C, 0x03, 0x60, 0x31, 0x80, 0x00, 0x00, 0x00, 0x3F,
+  0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F,
+  0xC1, 0xEF, 0x1E, 0x3F, 0xE0, 0x7E, 0x00, 0x0C, 0xC0, 0xF6, 0x06, 0xF0,
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x78, 0xF7, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xEF, 0x1E, 0x3F, 0xE0, 0x7E,
+  0x00, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFF,
+  0x8F, 0x1E, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3D,
+  0xE3, 0xC7, 0xFC, 0x0F, 0xC0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x00,
+  0x00, 0x7F, 0xCF, 0xFC, 0xF1, 0xEF, 0x1F, 0xF8, 0xFF, 0xCD, 0xFE, 0xCF,
+  0xFC, 0x7F, 0xE3, 0xDE, 0x3C, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x9F, 0x7F, 0xF3,
+  0xCF, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x9F, 0x7F, 0xF3, 0xCF, 0x0F, 0x00, 0xF0, 0x19, 0x83, 0x0C, 0x00, 0x00,
+  0x00, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x9F, 0x7F, 0xF3, 0xCF, 0x39, 0xC3, 0x9C, 0x39, 0xC0,
+  0x00, 0x00, 0x0F, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF9, 0xF7, 0xFF, 0x3C, 0xF0, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xDE, 0x1E, 0x78,
+  0x78, 0xE1, 0xE3, 0xCF, 0x0F, 0x3C, 0x1C, 0xF0, 0x7F, 0x80, 0xFE, 0x03,
+  0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x00, 0xFC, 0x03,
+  0xE0, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x79, 0xE3,
+  0xFF, 0x9F, 0x1E, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
+  0x3F, 0xE3, 0xDF, 0xFC, 0xF3, 0xC7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0x78, 0x00, 0x0E, 0x70, 0x39, 0xC0, 0xE7, 0x00, 0x00, 0x00, 0x03, 0xE0,
+  0xF7, 0x87, 0x9E, 0x1E, 0x38, 0x78, 0xF3, 0xC3, 0xCF, 0x07, 0x3C, 0x1F,
+  0xE0, 0x3F, 0x80, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x03,
+  0xC0, 0x3F, 0x00, 0xF8, 0x00 };
+
+const GFXglyph DejaVuSans_Bold11pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   4,  16,  10,    3,  -15 },   // 0x21 '!'
+  {     9,   8,   6,  11,    2,  -15 },   // 0x22 '"'
+  {    15,  15,  16,  18,    2,  -15 },   // 0x23 '#'
+  {    45,  12,  19,  15,    2,  -15 },   // 0x24 '$'
+  {    74,  21,  16,  22,    1,  -15 },   // 0x25 '%'
+  {   116,  17,  16,  19,    1,  -15 },   // 0x26 '&'
+  {   150,   3,   6,   7,    2,  -15 },   // 0x27 '''
+  {   153,   7,  20,  10,    2,  -16 },   // 0x28 '('
+  {   171,   7,  20,  10,    2,  -16 },   // 0x29 ')'
+  {   189,  10,  10,  12,    1,  -15 },   // 0x2A '*'
+  {   202,  13,  13,  18,    3,  -12 },   // 0x2B '+'
+  {   224,   5,   7,   8,    1,   -3 },   // 0x2C ','
+  {   229,   7,   3,   9,    1,   -7 },   // 0x2D '-'
+  {   232,   4,   4,   8,    2,   -3 },   // 0x2E '.'
+  {   234,   8,  18,   8,    0,  -15 },   // 0x2F '/'
+  {   252,  13,  16,  15,    1,  -15 },   // 0x30 '0'
+  {   278,  12,  16,  15,    2,  -15 },   // 0x31 '1'
+  {   302,  12,  16,  15,    2,  -15 },   // 0x32 '2'
+  {   326,  12,  16,  15,    1,  -15 },   // 0x33 '3'
+  {   350,  13,  16,  15,    1,  -15 },   // 0x34 '4'
+  {   376,  12,  16,  15,    2,  -15 },   // 0x35 '5'
+  {   400,  13,  16,  15,    1,  -15 },   // 0x36 '6'
+  {   426,  12,  16,  15,    1,  -15 },   // 0x37 '7'
+  {   450,  13,  16,  15,    1,  -15 },   // 0x38 '8'
+  {   476,  13,  16,  15,    1,  -15 },   // 0x39 '9'
+  {   502,   4,  12,   9,    2,  -11 },   // 0x3A ':'
+  {   508,   5,  15,   9,    1,  -11 },   // 0x3B ';'
+  {   518,  14,  12,  18,    2,  -12 },   // 0x3C '<'
+  {   539,  14,   8,  18,    2,  -10 },   // 0x3D '='
+  {   553,  14,  12,  18,    2,  -12 },   // 0x3E '>'
+  {   574,  10,  16,  13,    2,  -15 },   // 0x3F '?'
+  {   594,  19,  19,  22,    1,  -15 },   // 0x40 '@'
+  {   640,  17,  16,  17,    0,  -15 },   // 0x41 'A'
+  {   674,  13,  16,  17,    2,  -15 },   // 0x42 'B'
+  {   700,  14,  16,  16,    1,  -15 },   // 0x43 'C'
+  {   728,  15,  16,  18,    2,  -15 },   // 0x44 'D'
+  {   758,  11,  16,  15,    2,  -15 },   // 0x45 'E'
+  {   780,  11,  16,  15,    2,  -15 },   // 0x46 'F'
+  {   802,  15,  16,  18,    1,  -15 },   // 0x47 'G'
+  {   832,  14,  16,  18,    2,  -15 },   // 0x48 'H'
+  {   860,   4,  16,   8,    2,  -15 },   // 0x49 'I'
+  {   868,   7,  20,   8,   -1,  -15 },   // 0x4A 'J'
+  {   886,  16,  16,  17,    2,  -15 },   // 0x4B 'K'
+  {   918,  11,  16,  14,    2,  -15 },   // 0x4C 'L'
+  {   940,  18,  16,  22,    2,  -15 },   // 0x4D 'M'
+  {   976,  14,  16,  18,    2,  -15 },   // 0x4E 'N'
+  {  1004,  17,  16,  19,    1,  -15 },   // 0x4F 'O'
+  {  1038,  13,  16,  16,    2,  -15 },   // 0x50 'P'
+  {  1064,  17,  19,  19,    1,  -15 },   // 0x51 'Q'
+  {  1105,  14,  16,  17,    2,  -15 },   // 0x52 'R'
+  {  1133,  13,  16,  16,    2,  -15 },   // 0x53 'S'
+  {  1159,  14,  16,  15,    0,  -15 },   // 0x54 'T'
+  {  1187,  14,  16,  18,    2,  -15 },   // 0x55 'U'
+  {  1215,  17,  16,  17,    0,  -15 },   // 0x56 'V'
+  {  1249,  23,  16,  24,    1,  -15 },   // 0x57 'W'
+  {  1295,  16,  16,  17,    0,  -15 },   // 0x58 'X'
+  {  1327,  16,  16,  16,    0,  -15 },   // 0x59 'Y'
+  {  1359,  14,  16,  16,    1,  -15 },   // 0x5A 'Z'
+  {  1387,   7,  20,  10,    2,  -16 },   // 0x5B '['
+  {  1405,   8,  18,   8,    0,  -15 },   // 0x5C '\'
+  {  1423,   7,  20,  10,    2,  -16 },   // 0x5D ']'
+  {  1441,  14,   6,  18,    2,  -15 },   // 0x5E '^'
+  {  1452,  11,   2,  11,    0,    4 },   // 0x5F '_'
+  {  1455,   6,   4,  11,    1,  -17 },   // 0x60 '`'
+  {  1458,  12,  12,  15,    1,  -11 },   // 0x61 'a'
+  {  1476,  13,  17,  16,    2,  -16 },   // 0x62 'b'
+  {  1504,  11,  12,  13,    1,  -11 },   // 0x63 'c'
+  {  1521,  13,  17,  16,    1,  -16 },   // 0x64 'd'
+  {  1549,  13,  12,  15,    1,  -11 },   // 0x65 'e'
+  {  1569,  10,  17,  10,    0,  -16 },   // 0x66 'f'
+  {  1591,  13,  17,  16,    1,  -11 },   // 0x67 'g'
+  {  1619,  12,  17,  16,    2,  -16 },   // 0x68 'h'
+  {  1645,   4,  17,   8,    2,  -16 },   // 0x69 'i'
+  {  1654,   7,  22,   8,   -1,  -16 },   // 0x6A 'j'
+  {  1674,  13,  17,  15,    2,  -16 },   // 0x6B 'k'
+  {  1702,   4,  17,   8,    2,  -16 },   // 0x6C 'l'
+  {  1711,  20,  12,  23,    2,  -11 },   // 0x6D 'm'
+  {  1741,  12,  12,  16,    2,  -11 },   // 0x6E 'n'
+  {  1759,  13,  12,  15,    1,  -11 },   // 0x6F 'o'
+  {  1779,  13,  17,  16,    2,  -11 },   // 0x70 'p'
+  {  1807,  13,  17,  16,    1,  -11 },   // 0x71 'q'
+  {  1835,   9,  12,  11,    2,  -11 },   // 0x72 'r'
+  {  1849,  11,  12,  13,    1,  -11 },   // 0x73 's'
+  {  1866,  10,  15,  11,    0,  -14 },   // 0x74 't'
+  {  1885,  12,  12,  16,    2,  -11 },   // 0x75 'u'
+  {  1903,  14,  12,  14,    0,  -11 },   // 0x76 'v'
+  {  1924,  19,  12,  20,    1,  -11 },   // 0x77 'w'
+  {  1953,  14,  12,  14,    0,  -11 },   // 0x78 'x'
+  {  1974,  14,  17,  14,    0,  -11 },   // 0x79 'y'
+  {  2004,  11,  12,  13,    1,  -11 },   // 0x7A 'z'
+  {  2021,  10,  20,  16,    3,  -16 },   // 0x7B '{'
+  {  2046,   3,  22,   8,    3,  -16 },   // 0x7C '|'
+  {  2055,  10,  20,  16,    3,  -16 },   // 0x7D '}'
+  {  2080,  14,   5,  18,    2,   -8 },   // 0x7E '~'
+  {  2089,  11,  19,  13,    1,  -15 },   // 0x7F
+  {  2116,  11,  19,  13,    1,  -15 },   // 0x80
+  {  2143,  11,  19,  13,    1,  -15 },   // 0x81
+  {  2170,  11,  19,  13,    1,  -15 },   // 0x82
+  {  2197,  11,  19,  13,    1,  -15 },   // 0x83
+  {  2224,  11,  19,  13,    1,  -15 },   // 0x84
+  {  2251,  11,  19,  13,    1,  -15 },   // 0x85
+  {  2278,  11,  19,  13,    1,  -15 },   // 0x86
+  {  2305,  11,  19,  13,    1,  -15 },   // 0x87
+  {  2332,  11,  19,  13,    1,  -15 },   // 0x88
+  {  2359,  11,  19,  13,    1,  -15 },   // 0x89
+  {  2386,  11,  19,  13,    1,  -15 },   // 0x8A
+  {  2413,  11,  19,  13,    1,  -15 },   // 0x8B
+  {  2440,  11,  19,  13,    1,  -15 },   // 0x8C
+  {  2467,  11,  19,  13,    1,  -15 },   // 0x8D
+  {  2494,  11,  19,  13,    1,  -15 },   // 0x8E
+  {  2521,  11,  19,  13,    1,  -15 },   // 0x8F
+  {  2548,  11,  19,  13,    1,  -15 },   // 0x90
+  {  2575,  11,  19,  13,    1,  -15 },   // 0x91
+  {  2602,  11,  19,  13,    1,  -15 },   // 0x92
+  {  2629,  11,  19,  13,    1,  -15 },   // 0x93
+  {  2656,  11,  19,  13,    1,  -15 },   // 0x94
+  {  2683,  11,  19,  13,    1,  -15 },   // 0x95
+  {  2710,  11,  19,  13,    1,  -15 },   // 0x96
+  {  2737,  11,  19,  13,    1,  -15 },   // 0x97
+  {  2764,  11,  19,  13,    1,  -15 },   // 0x98
+  {  2791,  11,  19,  13,    1,  -15 },   // 0x99
+  {  2818,  11,  19,  13,    1,  -15 },   // 0x9A
+  {  2845,  11,  19,  13,    1,  -15 },   // 0x9B
+  {  2872,  11,  19,  13,    1,  -15 },   // 0x9C
+  {  2899,  11,  19,  13,    1,  -15 },   // 0x9D
+  {  2926,  11,  19,  13,    1,  -15 },   // 0x9E
+  {  2953,  11,  19,  13,    1,  -15 },   // 0x9F
+  {  2980,   1,   1,   8,    0,    0 },   // 0xA0
+  {  2981,   4,  16,  10,    3,  -11 },   // 0xA1
+  {  2989,  11,  18,  15,    2,  -14 },   // 0xA2
+  {  3014,  12,  16,  15,    2,  -15 },   // 0xA3
+  {  3038,  13,  13,  14,    0,  -12 },   // 0xA4
+  {  3060,  14,  16,  15,    1,  -15 },   // 0xA5
+  {  3088,   3,  19,   8,    3,  -14 },   // 0xA6
+  {  3096,  11,  18,  11,    1,  -15 },   // 0xA7
+  {  3121,   8,   3,  11,    2,  -16 },   // 0xA8
+  {  3124,  16,  16,  22,    3,  -15 },   // 0xA9
+  {  3156,   9,  12,  12,    2,  -15 },   // 0xAA
+  {  3170,  10,  10,  14,    2,  -10 },   // 0xAB
+  {  3183,  14,   7,  18,    2,   -9 },   // 0xAC
+  {  3196,   7,   3,   9,    1,   -7 },   // 0xAD
+  {  3199,  16,  16,  22,    3,  -15 },   // 0xAE
+  {  3231,   7,   2,  11,    2,  -16 },   // 0xAF
+  {  3233,   7,   7,  11,    2,  -15 },   // 0xB0
+  {  3240,  15,  14,  18,    2,  -13 },   // 0xB1
+  {  3267,   7,   9,  10,    1,  -15 },   // 0xB2
+  {  3275,   7,   9,  10,    1,  -15 },   // 0xB3
+  {  3283,   6,   4,  11,    4,  -17 },   // 0xB4
+  {  3286,  14,  17,  16,    2,  -11 },   // 0xB5
+  {  3316,  11,  18,  14,    1,  -15 },   // 0xB6
+  {  3341,   4,   4,   8,    2,   -9 },   // 0xB7
+  {  3343,   5,   4,  11,    3,    1 },   // 0xB8
+  {  3346,   6,   9,  10,    2,  -15 },   // 0xB9
+  {  3353,  10,  12,  12,    1,  -15 },   // 0xBA
+  {  3368,  10,  10,  14,    2,  -10 },   // 0xBB
+  {  3381,  19,  16,  23,    2,  -15 },   // 0xBC
+  {  3419,  19,  16,  23,    2,  -15 },   // 0xBD
+  {  3457,  20,  16,  23,    1,  -15 },   // 0xBE
+  {  3497,  10,  17,  13,    2,  -11 },   // 0xBF
+  {  3519,  17,  21,  17,    0,  -20 },   // 0xC0
+  {  3564,  17,  21,  17,    0,  -20 },   // 0xC1
+  {  3609,  17,  21,  17,    0,  -20 },   // 0xC2
+  {  3654,  17,  21,  17,    0,  -20 },   // 0xC3
+  {  3699,  17,  21,  17,    0,  -20 },   // 0xC4
+  {  3744,  17,  20,  17,    0,  -19 },   // 0xC5
+  {  3787,  22,  16,  24,    0,  -15 },   // 0xC6
+  {  3831,  14,  20,  16,    1,  -15 },   // 0xC7
+  {  3866,  11,  21,  15,    2,  -20 },   // 0xC8
+  {  3895,  11,  21,  15,    2,  -20 },   // 0xC9
+  {  3924,  11,  21,  15,    2,  -20 },   // 0xCA
+  {  3953,  11,  21,  15,    2,  -20 },   // 0xCB
+  {  3982,   6,  21,   8,    0,  -20 },   // 0xCC
+  {  3998,   5,  21,   8,    2,  -20 },   // 0xCD
+  {  4012,   8,  21,   8,    0,  -20 },   // 0xCE
+  {  4033,   8,  21,   8,    0,  -20 },   // 0xCF
+  {  4054,  17,  16,  18,    0,  -15 },   // 0xD0
+  {  4088,  14,  21,  18,    2,  -20 },   // 0xD1
+  {  4125,  17,  21,  19,    1,  -20 },   // 0xD2
+  {  4170,  17,  21,  19,    1,  -20 },   // 0xD3
+  {  4215,  17,  21,  19,    1,  -20 },   // 0xD4
+  {  4260,  17,  21,  19,    1,  -20 },   // 0xD5
+  {  4305,  17,  21,  19,    1,  -20 },   // 0xD6
+  {  4350,  13,  13,  18,    3,  -12 },   // 0xD7
+  {  4372,  19,  17,  19,    0,  -16 },   // 0xD8
+  {  4413,  14,  21,  18,    2,  -20 },   // 0xD9
+  {  4450,  14,  21,  18,    2,  -20 },   // 0xDA
+  {  4487,  14,  21,  18,    2,  -20 },   // 0xDB
+  {  4524,  14,  21,  18,    2,  -20 },   // 0xDC
+  {  4561,  16,  21,  16,    0,  -20 },   // 0xDD
+  {  4603,  13,  16,  16,    2,  -15 },   // 0xDE
+  {  4629,  13,  17,  16,    2,  -16 },   // 0xDF
+  {  4657,  12,  18,  15,    1,  -17 },   // 0xE0
+  {  4684,  12,  18,  15,    1,  -17 },   // 0xE1
+  {  4711,  12,  18,  15,    1,  -17 },   // 0xE2
+  {  4738,  12,  18,  15,    1,  -17 },   // 0xE3
+  {  4765,  12,  17,  15,    1,  -16 },   // 0xE4
+  {  4791,  12,  20,  15,    1,  -19 },   // 0xE5
+  {  4821,  21,  12,  23,    1,  -11 },   // 0xE6
+  {  4853,  11,  16,  13,    1,  -11 },   // 0xE7
+  {  4875,  13,  18,  15,    1,  -17 },   // 0xE8
+  {  4905,  13,  18,  15,    1,  -17 },   // 0xE9
+  {  4935,  13,  18,  15,    1,  -17 },   // 0xEA
+  {  4965,  13,  17,  15,    1,  -16 },   // 0xEB
+  {  4993,   6,  18,   8,    0,  -17 },   // 0xEC
+  {  5007,   7,  18,   8,    2,  -17 },   // 0xED
+  {  5023,   8,  18,   8,    0,  -17 },   // 0xEE
+  {  5041,   8,  17,   8,    0,  -16 },   // 0xEF
+  {  5058,  13,  17,  15,    1,  -16 },   // 0xF0
+  {  5086,  12,  18,  16,    2,  -17 },   // 0xF1
+  {  5113,  13,  18,  15,    1,  -17 },   // 0xF2
+  {  5143,  13,  18,  15,    1,  -17 },   // 0xF3
+  {  5173,  13,  18,  15,    1,  -17 },   // 0xF4
+  {  5203,  13,  18,  15,    1,  -17 },   // 0xF5
+  {  5233,  13,  17,  15,    1,  -16 },   // 0xF6
+  {  5261,  13,  11,  18,    3,  -11 },   // 0xF7
+  {  5279,  13,  14,  15,    1,  -12 },   // 0xF8
+  {  5302,  12,  18,  16,    2,  -17 },   // 0xF9
+  {  5329,  12,  18,  16,    2,  -17 },   // 0xFA
+  {  5356,  12,  18,  16,    2,  -17 },   // 0xFB
+  {  5383,  12,  17,  16,    2,  -16 },   // 0xFC
+  {  5409,  14,  23,  14,    0,  -17 },   // 0xFD
+  {  5450,  13,  22,  16,    2,  -16 },   // 0xFE
+  {  5486,  14,  22,  14,    0,  -16 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold11pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold11pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold11pt8bGlyphs,
+  0x20, 0xFF, 25 };
+
+// Approx. 7100 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold11pt8bMetrics[] PROGMEM = {
+  {   0,   8,   1 },   // 0x20
+  {   3,  10,   7 },   // 0x21
+  {   2,  11,  10 },   // 0x22
+  {   2,  18,  17 },   // 0x23
+  {   2,  15,  14 },   // 0x24
+  {   1,  22,  22 },   // 0x25
+  {   1,  19,  18 },   // 0x26
+  {   2,   7,   5 },   // 0x27
+  {   2,  10,   9 },   // 0x28
+  {   2,  10,   9 },   // 0x29
+  {   1,  12,  11 },   // 0x2A
+  {   3,  18,  16 },   // 0x2B
+  {   1,   8,   6 },   // 0x2C
+  {   1,   9,   8 },   // 0x2D
+  {   2,   8,   6 },   // 0x2E
+  {   0,   8,   8 },   // 0x2F
+  {   1,  15,  14 },   // 0x30
+  {   2,  15,  14 },   // 0x31
+  {   2,  15,  14 },   // 0x32
+  {   1,  15,  13 },   // 0x33
+  {   1,  15,  14 },   // 0x34
+  {   2,  15,  14 },   // 0x35
+  {   1,  15,  14 },   // 0x36
+  {   1,  15,  13 },   // 0x37
+  {   1,  15,  14 },   // 0x38
+  {   1,  15,  14 },   // 0x39
+  {   2,   9,   6 },   // 0x3A
+  {   1,   9,   6 },   // 0x3B
+  {   2,  18,  16 },   // 0x3C
+  {   2,  18,  16 },   // 0x3D
+  {   2,  18,  16 },   // 0x3E
+  {   2,  13,  12 },   // 0x3F
+  {   1,  22,  20 },   // 0x40
+  {   0,  17,  17 },   // 0x41
+  {   2,  17,  15 },   // 0x42
+  {   1,  16,  15 },   // 0x43
+  {   2,  18,  17 },   // 0x44
+  {   2,  15,  13 },   // 0x45
+  {   2,  15,  13 },   // 0x46
+  {   1,  18,  16 },   // 0x47
+  {   2,  18,  16 },   // 0x48
+  {   2,   8,   6 },   // 0x49
+  {  -1,   8,   6 },   // 0x4A
+  {   2,  17,  18 },   // 0x4B
+  {   2,  14,  13 },   // 0x4C
+  {   2,  22,  20 },   // 0x4D
+  {   2,  18,  16 },   // 0x4E
+  {   1,  19,  18 },   // 0x4F
+  {   2,  16,  15 },   // 0x50
+  {   1,  19,  18 },   // 0x51
+  {   2,  17,  16 },   // 0x52
+  {   2,  16,  15 },   // 0x53
+  {   0,  15,  14 },   // 0x54
+  {   2,  18,  16 },   // 0x55
+  {   0,  17,  17 },   // 0x56
+  {   1,  24,  24 },   // 0x57
+  {   0,  17,  16 },   // 0x58
+  {   0,  16,  16 },   // 0x59
+  {   1,  16,  15 },   // 0x5A
+  {   2,  10,   9 },   // 0x5B
+  {   0,   8,   8 },   // 0x5C
+  {   2,  10,   9 },   // 0x5D
+  {   2,  18,  16 },   // 0x5E
+  {   0,  11,  11 },   // 0x5F
+  {   1,  11,   7 },   // 0x60
+  {   1,  15,  13 },   // 0x61
+  {   2,  16,  15 },   // 0x62
+  {   1,  13,  12 },   // 0x63
+  {   1,  16,  14 },   // 0x64
+  {   1,  15,  14 },   // 0x65
+  {   0,  10,  10 },   // 0x66
+  {   1,  16,  14 },   // 0x67
+  {   2,  16,  14 },   // 0x68
+  {   2,   8,   6 },   // 0x69
+  {  -1,   8,   6 },   // 0x6A
+  {   2,  15,  15 },   // 0x6B
+  {   2,   8,   6 },   // 0x6C
+  {   2,  23,  22 },   // 0x6D
+  {   2,  16,  14 },   // 0x6E
+  {   1,  15,  14 },   // 0x6F
+  {   2,  16,  15 },   // 0x70
+  {   1,  16,  14 },   // 0x71
+  {   2,  11,  11 },   // 0x72
+  {   1,  13,  12 },   // 0x73
+  {   0,  11,  10 },   // 0x74
+  {   2,  16,  14 },   // 0x75
+  {   0,  14,  14 },   // 0x76
+  {   1,  20,  20 },   // 0x77
+  {   0,  14,  14 },   // 0x78
+  {   0,  14,  14 },   // 0x79
+  {   1,  13,  12 },   // 0x7A
+  {   3,  16,  13 },   // 0x7B
+  {   3,   8,   6 },   // 0x7C
+  {   3,  16,  13 },   // 0x7D
+  {   2,  18,  16 },   // 0x7E
+  {   1,  13,  12 },   // 0x7F
+  {   1,  13,  12 },   // 0x80
+  {   1,  13,  12 },   // 0x81
+  {   1,  13,  12 },   // 0x82
+  {   1,  13,  12 },   // 0x83
+  {   1,  13,  12 },   // 0x84
+  {   1,  13,  12 },   // 0x85
+  {   1,  13,  12 },   // 0x86
+  {   1,  13,  12 },   // 0x87
+  {   1,  13,  12 },   // 0x88
+  {   1,  13,  12 },   // 0x89
+  {   1,  13,  12 },   // 0x8A
+  {   1,  13,  12 },   // 0x8B
+  {   1,  13,  12 },   // 0x8C
+  {   1,  13,  12 },   // 0x8D
+  {   1,  13,  12 },   // 0x8E
+  {   1,  13,  12 },   // 0x8F
+  {   1,  13,  12 },   // 0x90
+  {   1,  13,  12 },   // 0x91
+  {   1,  13,  12 },   // 0x92
+  {   1,  13,  12 },   // 0x93
+  {   1,  13,  12 },   // 0x94
+  {   1,  13,  12 },   // 0x95
+  {   1,  13,  12 },   // 0x96
+  {   1,  13,  12 },   // 0x97
+  {   1,  13,  12 },   // 0x98
+  {   1,  13,  12 },   // 0x99
+  {   1,  13,  12 },   // 0x9A
+  {   1,  13,  12 },   // 0x9B
+  {   1,  13,  12 },   // 0x9C
+  {   1,  13,  12 },   // 0x9D
+  {   1,  13,  12 },   // 0x9E
+  {   1,  13,  12 },   // 0x9F
+  {   0,   8,   1 },   // 0xA0
+  {   3,  10,   7 },   // 0xA1
+  {   2,  15,  13 },   // 0xA2
+  {   2,  15,  14 },   // 0xA3
+  {   0,  14,  13 },   // 0xA4
+  {   1,  15,  15 },   // 0xA5
+  {   3,   8,   6 },   // 0xA6
+  {   1,  11,  12 },   // 0xA7
+  {   2,  11,  10 },   // 0xA8
+  {   3,  22,  19 },   // 0xA9
+  {   2,  12,  11 },   // 0xAA
+  {   2,  14,  12 },   // 0xAB
+  {   2,  18,  16 },   // 0xAC
+  {   1,   9,   8 },   // 0xAD
+  {   3,  22,  19 },   // 0xAE
+  {   2,  11,   9 },   // 0xAF
+  {   2,  11,   9 },   // 0xB0
+  {   2,  18,  17 },   // 0xB1
+  {   1,  10,   8 },   // 0xB2
+  {   1,  10,   8 },   // 0xB3
+  {   4,  11,  10 },   // 0xB4
+  {   2,  16,  16 },   // 0xB5
+  {   1,  14,  12 },   // 0xB6
+  {   2,   8,   6 },   // 0xB7
+  {   3,  11,   8 },   // 0xB8
+  {   2,  10,   8 },   // 0xB9
+  {   1,  12,  11 },   // 0xBA
+  {   2,  14,  12 },   // 0xBB
+  {   2,  23,  21 },   // 0xBC
+  {   2,  23,  21 },   // 0xBD
+  {   1,  23,  21 },   // 0xBE
+  {   2,  13,  12 },   // 0xBF
+  {   0,  17,  17 },   // 0xC0
+  {   0,  17,  17 },   // 0xC1
+  {   0,  17,  17 },   // 0xC2
+  {   0,  17,  17 },   // 0xC3
+  {   0,  17,  17 },   // 0xC4
+  {   0,  17,  17 },   // 0xC5
+  {   0,  24,  22 },   // 0xC6
+  {   1,  16,  15 },   // 0xC7
+  {   2,  15,  13 },   // 0xC8
+  {   2,  15,  13 },   // 0xC9
+  {   2,  15,  13 },   // 0xCA
+  {   2,  15,  13 },   // 0xCB
+  {   0,   8,   6 },   // 0xCC
+  {   2,   8,   7 },   // 0xCD
+  {   0,   8,   8 },   // 0xCE
+  {   0,   8,   8 },   // 0xCF
+  {   0,  18,  17 },   // 0xD0
+  {   2,  18,  16 },   // 0xD1
+  {   1,  19,  18 },   // 0xD2
+  {   1,  19,  18 },   // 0xD3
+  {   1,  19,  18 },   // 0xD4
+  {   1,  19,  18 },   // 0xD5
+  {   1,  19,  18 },   // 0xD6
+  {   3,  18,  16 },   // 0xD7
+  {   0,  19,  19 },   // 0xD8
+  {   2,  18,  16 },   // 0xD9
+  {   2,  18,  16 },   // 0xDA
+  {   2,  18,  16 },   // 0xDB
+  {   2,  18,  16 },   // 0xDC
+  {   0,  16,  16 },   // 0xDD
+  {   2,  16,  15 },   // 0xDE
+  {   2,  16,  15 },   // 0xDF
+  {   1,  15,  13 },   // 0xE0
+  {   1,  15,  13 },   // 0xE1
+  {   1,  15,  13 },   // 0xE2
+  {   1,  15,  13 },   // 0xE3
+  {   1,  15,  13 },   // 0xE4
+  {   1,  15,  13 },   // 0xE5
+  {   1,  23,  22 },   // 0xE6
+  {   1,  13,  12 },   // 0xE7
+  {   1,  15,  14 },   // 0xE8
+  {   1,  15,  14 },   // 0xE9
+  {   1,  15,  14 },   // 0xEA
+  {   1,  15,  14 },   // 0xEB
+  {   0,   8,   6 },   // 0xEC
+  {   2,   8,   9 },   // 0xED
+  {   0,   8,   8 },   // 0xEE
+  {   0,   8,   8 },   // 0xEF
+  {   1,  15,  14 },   // 0xF0
+  {   2,  16,  14 },   // 0xF1
+  {   1,  15,  14 },   // 0xF2
+  {   1,  15,  14 },   // 0xF3
+  {   1,  15,  14 },   // 0xF4
+  {   1,  15,  14 },   // 0xF5
+  {   1,  15,  14 },   // 0xF6
+  {   3,  18,  16 },   // 0xF7
+  {   1,  15,  14 },   // 0xF8
+  {   2,  16,  14 },   // 0xF9
+  {   2,  16,  14 },   // 0xFA
+  {   2,  16,  14 },   // 0xFB
+  {   2,  16,  14 },   // 0xFC
+  {   0,  14,  14 },   // 0xFD
+  {   2,  16,  15 },   // 0xFE
+  {   0,  14,  14 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold11pt8bWidths = { DejaVuSans_Bold11pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD11PTLAT1__H
@@ -0,0 +1,1014 @@
+#ifndef DEJAVUSANSBOLD12PTLAT1__H
+#define DEJAVUSANSBOLD12PTLAT1__H
+const uint8_t DejaVuSans_Bold12pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xE3, 0x00,
+  0x63, 0x80, 0x71, 0xC3, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0x06, 0x38,
+  0x07, 0x1C, 0x03, 0x8C, 0x1F, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0xF8, 0x71,
+  0xC0, 0x38, 0xC0, 0x18, 0xE0, 0x1C, 0x70, 0x00, 0x03, 0x00, 0x0C, 0x00,
+  0x30, 0x07, 0xF8, 0x7F, 0xF9, 0xFF, 0xEF, 0xB1, 0xBC, 0xC0, 0xF3, 0x03,
+  0xFE, 0x07, 0xFF, 0x0F, 0xFE, 0x07, 0xFC, 0x0D, 0xF0, 0x33, 0xF0, 0xCF,
+  0xFF, 0xFB, 0xFF, 0xE3, 0xFE, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0x3E, 0x00, 0xC0, 0xFE, 0x03, 0x03, 0xDE, 0x0E, 0x07, 0x1C, 0x18,
+  0x0E, 0x38, 0x60, 0x1C, 0x71, 0xC0, 0x38, 0xE3, 0x00, 0x7B, 0xCE, 0x00,
+  0x7F, 0x18, 0xF8, 0x7C, 0x63, 0xF8, 0x01, 0xCF, 0x78, 0x03, 0x1C, 0x70,
+  0x0E, 0x38, 0xE0, 0x38, 0x71, 0xC0, 0x60, 0xE3, 0x81, 0xC1, 0xEF, 0x03,
+  0x01, 0xFC, 0x0C, 0x01, 0xF0, 0x03, 0xF0, 0x03, 0xFE, 0x01, 0xFF, 0x80,
+  0x78, 0x20, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x3F,
+  0xC7, 0x9F, 0xF9, 0xEF, 0xBF, 0x73, 0xC7, 0xFC, 0xF0, 0xFE, 0x3C, 0x1F,
+  0x8F, 0x83, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xF3, 0xF0, 0xFF, 0xFF,
+  0xF8, 0x1E, 0x38, 0xF1, 0xC7, 0x8F, 0x1C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x1C, 0x3C, 0x78, 0x70, 0xF0, 0xE1, 0xE0, 0xF0, 0xE1, 0xE1, 0xC3,
+  0xC7, 0x87, 0x0F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x1E, 0x3C, 0x71,
+  0xE3, 0x8F, 0x00, 0x06, 0x00, 0x60, 0x46, 0x2F, 0x6F, 0x3F, 0xC0, 0xF0,
+  0x3F, 0xCF, 0x6F, 0x46, 0x20, 0x60, 0x06, 0x00, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x00, 0x7B, 0xDE, 0xF7, 0xBB, 0xDC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0,
+  0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x0C, 0x0E, 0x07,
+  0x03, 0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x00, 0x0F,
+  0xC0, 0x7F, 0x83, 0xFF, 0x1E, 0x1E, 0x78, 0x7B, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xE7,
+  0x87, 0x8F, 0xFC, 0x1F, 0xE0, 0x3F, 0x00, 0x3F, 0x0F, 0xF0, 0xFF, 0x0C,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x87,
+  0xFF, 0x3F, 0xFD, 0xC1, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xF8, 0x0F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC3, 0xFF, 0x9F, 0xFE, 0x81, 0xF0, 0x07,
+  0x80, 0x3C, 0x03, 0xC3, 0xFC, 0x1F, 0xE0, 0xFF, 0x80, 0x3E, 0x00, 0xF0,
+  0x07, 0x80, 0x3F, 0x03, 0xFF, 0xFE, 0xFF, 0xE3, 0xFC, 0x00, 0x01, 0xF0,
+  0x07, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0xFF, 0x03, 0xDE, 0x07, 0x3C, 0x1E,
+  0x78, 0x38, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x07, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x7F, 0xF3, 0xFF, 0x9F,
+  0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xFF, 0x0F, 0xFC, 0x7F, 0xF2, 0x07,
+  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3F, 0x03, 0xFF, 0xFE, 0xFF, 0xE1,
+  0xFC, 0x00, 0x07, 0xF0, 0x7F, 0xE3, 0xFF, 0x9F, 0x02, 0x78, 0x03, 0xC0,
+  0x0F, 0x7E, 0x3F, 0xFC, 0xFF, 0xFB, 0xE1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3D, 0xC0, 0xF7, 0x87, 0x8F, 0xFE, 0x1F, 0xF0, 0x3F, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x7C, 0x03,
+  0xC0, 0x1E, 0x01, 0xF0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x7C, 0x03, 0xC0,
+  0x1E, 0x01, 0xF0, 0x00, 0x1F, 0xE1, 0xFF, 0xEF, 0xFF, 0xFE, 0x1F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x87, 0x9F, 0xFE, 0x1F, 0xE1, 0xFF, 0xE7, 0x87, 0xBC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xDF, 0xFE, 0x3F, 0xF0, 0x7F, 0x80,
+  0x0F, 0xC0, 0xFF, 0x87, 0xFF, 0x1E, 0x1E, 0xF0, 0x3B, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF8, 0x7D, 0xFF, 0xF3, 0xFF, 0xC7, 0xEF, 0x00, 0x38, 0x01,
+  0xE4, 0x0F, 0x9F, 0xFC, 0x7F, 0xE0, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xF0, 0x7B, 0xDE, 0xF7, 0x80, 0x00, 0x7B, 0xDE, 0xF7, 0xBB,
+  0xDC, 0x00, 0x02, 0x00, 0x3C, 0x03, 0xF8, 0x1F, 0xE1, 0xFE, 0x1F, 0xE0,
+  0x3E, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xF0,
+  0x01, 0xE0, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x01, 0xE0,
+  0x03, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x1F,
+  0x01, 0xFE, 0x1F, 0xE1, 0xFE, 0x07, 0xF0, 0x0F, 0x00, 0x10, 0x00, 0x00,
+  0xFF, 0x1F, 0xFB, 0xFF, 0xE1, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x7E, 0x1F,
+  0x07, 0xC0, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xC0, 0xF0, 0x38, 0x01, 0xC3,
+  0x80, 0x07, 0x38, 0x7B, 0x99, 0x8F, 0xFC, 0xFC, 0x71, 0xE3, 0xC7, 0x07,
+  0x1E, 0x38, 0x38, 0xF1, 0xC1, 0xC7, 0x8E, 0x0E, 0x3C, 0x70, 0x73, 0x61,
+  0xC7, 0xB9, 0x8F, 0xFF, 0x8E, 0x1E, 0xF0, 0x30, 0x00, 0x00, 0xE0, 0x04,
+  0x03, 0xC0, 0xE0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3,
+  0xC0, 0x3C, 0xF0, 0x1F, 0x3E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C,
+  0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC,
+  0x00, 0xF0, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0xBC, 0x3E, 0xF0, 0x7B, 0xC1,
+  0xEF, 0x0F, 0xBF, 0xFC, 0xFF, 0xF3, 0xFF, 0xEF, 0x07, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0x80, 0x03, 0xF8,
+  0x1F, 0xFC, 0xFF, 0xF9, 0xF0, 0x77, 0xC0, 0x2F, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80,
+  0x4F, 0x83, 0x9F, 0xFF, 0x0F, 0xFE, 0x07, 0xF0, 0xFF, 0xC0, 0xFF, 0xF0,
+  0xFF, 0xFC, 0xF0, 0x7C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1E, 0xF0, 0x3E,
+  0xF0, 0x7C, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0x8F, 0xFF, 0xC7, 0xC0, 0xE7, 0xC0,
+  0x13, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x3F, 0xF8, 0x1F, 0xFC,
+  0x0F, 0xFE, 0x00, 0xF7, 0x80, 0x7B, 0xE0, 0x3C, 0xF8, 0x1E, 0x3F, 0xFF,
+  0x0F, 0xFF, 0x81, 0xFE, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0xFE, 0xFC,
+  0xF0, 0xF0, 0x3F, 0x78, 0x3F, 0x3C, 0x3E, 0x1E, 0x3E, 0x0F, 0x3E, 0x07,
+  0xBE, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xE0,
+  0x1E, 0xF8, 0x0F, 0x3E, 0x07, 0x8F, 0x83, 0xC3, 0xE1, 0xE0, 0xF8, 0xF0,
+  0x3E, 0x78, 0x0F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFF, 0x07, 0xFF, 0xE0, 0xFF, 0xFC, 0x1F, 0xFD, 0xC7, 0x7F,
+  0xB8, 0xEF, 0xF7, 0xBD, 0xFE, 0x77, 0x3F, 0xCE, 0xE7, 0xF8, 0xF8, 0xFF,
+  0x1F, 0x1F, 0xE3, 0xE3, 0xFC, 0x38, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE,
+  0x00, 0x3C, 0xF8, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F,
+  0xFF, 0x0F, 0xF7, 0x0F, 0xF7, 0x8F, 0xF3, 0x8F, 0xF1, 0xCF, 0xF1, 0xCF,
+  0xF0, 0xEF, 0xF0, 0xEF, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x3F,
+  0xF0, 0x1F, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x78,
+  0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
+  0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9E, 0x01, 0xE7, 0xE1, 0xF8,
+  0xFF, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF,
+  0xBC, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFB, 0xFF,
+  0xCF, 0xFE, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E,
+  0x78, 0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0xDE, 0x01, 0xE7, 0xE1,
+  0xF8, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x78,
+  0x00, 0x1F, 0x00, 0x03, 0xC0, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0,
+  0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x78, 0xFF, 0xF8, 0xFF,
+  0xE0, 0xFF, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3E, 0xF0,
+  0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 0x1F, 0xF0, 0xFF, 0xE7, 0xFF, 0xBE, 0x0E,
+  0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xF0, 0xFF,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03,
+  0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF,
+  0x01, 0xFE, 0x07, 0xDE, 0x0F, 0x3F, 0xFE, 0x3F, 0xF8, 0x1F, 0xC0, 0xF0,
+  0x03, 0xDE, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0x3C, 0x0F, 0x0F, 0x03,
+  0xC3, 0xE1, 0xF0, 0x78, 0x78, 0x1E, 0x1E, 0x07, 0xCF, 0x80, 0xF3, 0xC0,
+  0x3C, 0xF0, 0x0F, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0xF0, 0x3E, 0x07, 0xF8, 0x1F, 0x03, 0xDE, 0x0F,
+  0x83, 0xCF, 0x07, 0xC1, 0xE7, 0x87, 0x70, 0xF3, 0xC3, 0xB8, 0x79, 0xF1,
+  0xDC, 0x7C, 0x78, 0xEE, 0x3C, 0x3C, 0xE3, 0x9E, 0x1E, 0x71, 0xCF, 0x0F,
+  0xB8, 0xEF, 0x83, 0xDC, 0x77, 0x81, 0xFE, 0x3F, 0xC0, 0xFE, 0x0F, 0xE0,
+  0x7F, 0x07, 0xF0, 0x1F, 0x83, 0xF0, 0x0F, 0xC1, 0xF8, 0x07, 0xC0, 0x7C,
+  0x00, 0xF8, 0x07, 0xDF, 0x03, 0xE3, 0xE1, 0xF0, 0xF8, 0x7C, 0x1F, 0x3E,
+  0x03, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x7F, 0x80, 0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x83, 0xE1, 0xF0, 0xF0,
+  0x3C, 0x7C, 0x0F, 0xBE, 0x01, 0xF0, 0xF8, 0x07, 0xDF, 0x03, 0xE3, 0xC1,
+  0xF0, 0xF8, 0x7C, 0x1F, 0x3E, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xE0,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+  0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0x80, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+  0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0x70, 0x18, 0x0E, 0x07, 0x01, 0x80, 0xE0,
+  0x70, 0x18, 0x0E, 0x07, 0x01, 0x80, 0xE0, 0x70, 0x18, 0x0E, 0x07, 0x01,
+  0x80, 0xE0, 0x70, 0xFF, 0xFF, 0xF8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0x80,
+  0x0F, 0x80, 0x3F, 0x80, 0xF7, 0x83, 0xC7, 0x8F, 0x07, 0xB8, 0x03, 0x80,
+  0xFF, 0xFF, 0xFF, 0x70, 0x70, 0x70, 0x70, 0x1F, 0xC3, 0xFF, 0x9F, 0xFC,
+  0x81, 0xF0, 0x07, 0x8F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x87, 0xFF,
+  0xFE, 0xFF, 0xF3, 0xE7, 0x80, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xCF, 0x8F, 0xFF, 0x3F, 0xFE, 0xF8, 0x7B, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xBF, 0xFE, 0xFF, 0xF3, 0xCF,
+  0x80, 0x0F, 0xE3, 0xFF, 0x7F, 0xF7, 0xC1, 0xF8, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF8, 0x07, 0xC1, 0x7F, 0xF3, 0xFF, 0x0F, 0xE0, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x7C, 0xF3, 0xFF, 0xDF, 0xFF, 0x78,
+  0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF7, 0x87, 0xDF,
+  0xFF, 0x3F, 0xFC, 0x7C, 0xF0, 0x0F, 0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E,
+  0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x67, 0xFF,
+  0x8F, 0xFE, 0x0F, 0xE0, 0x0F, 0xC7, 0xF3, 0xFC, 0xF0, 0x3C, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x00, 0x1F, 0x3C, 0xFF, 0xF7, 0xFF, 0xDE, 0x1F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xF7, 0xFF, 0xCF, 0xFF,
+  0x1F, 0x3C, 0x00, 0xF2, 0x07, 0xCF, 0xFE, 0x3F, 0xF0, 0x7F, 0x00, 0xF0,
+  0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x79, 0xF3, 0xFF, 0xDF, 0xFF,
+  0xF8, 0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
+  0x0F, 0xF0, 0x7F, 0x83, 0xC0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1E, 0x3C, 0x78, 0xF0, 0x03, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+  0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x79, 0xFF, 0xDF, 0xBE, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC3, 0xEF, 0x1F, 0x3C,
+  0xF8, 0xF7, 0xC3, 0xFE, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x83, 0xDF, 0x0F,
+  0x3E, 0x3C, 0x7C, 0xF0, 0xFB, 0xC1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC3, 0xCF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+  0x8F, 0x8F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F,
+  0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0,
+  0xF0, 0xF3, 0xE7, 0xFF, 0xBF, 0xFF, 0xF1, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0x80, 0x0F,
+  0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3D, 0xE1, 0xE7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0, 0xF3, 0xE3,
+  0xFF, 0xCF, 0xFF, 0xBE, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xE1, 0xEF, 0xFF, 0xBF, 0xFC, 0xF3, 0xE3, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x1F, 0x3C, 0xFF, 0xF7, 0xFF, 0xDE,
+  0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3D, 0xE1, 0xF7,
+  0xFF, 0xCF, 0xFF, 0x1F, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x3F, 0x87, 0xFE, 0xFF, 0xEF,
+  0x06, 0xF8, 0x0F, 0xFC, 0x7F, 0xE0, 0xFF, 0x00, 0xFC, 0x0F, 0xFF, 0xFF,
+  0xFE, 0x3F, 0x80, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFC, 0x7F, 0x0F,
+  0xC0, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0xFF, 0xF3, 0xE7, 0x80, 0xF0,
+  0x1E, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE3, 0xC7, 0x87, 0x8F, 0x07, 0x1C,
+  0x0F, 0x78, 0x1E, 0xF0, 0x1D, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0x7C, 0x00,
+  0xF0, 0x70, 0x7F, 0xC7, 0xC7, 0xDE, 0x3E, 0x3C, 0xF1, 0xF1, 0xE7, 0x8F,
+  0x8F, 0x3E, 0xEE, 0xF8, 0xF7, 0x77, 0x87, 0xBB, 0xBC, 0x3D, 0xDD, 0xE0,
+  0xFC, 0x7E, 0x07, 0xE3, 0xF0, 0x3F, 0x1F, 0x81, 0xF8, 0xFC, 0x00, 0xF8,
+  0x3E, 0xF8, 0xF8, 0xFB, 0xE0, 0xF7, 0x80, 0xFE, 0x01, 0xFC, 0x01, 0xF0,
+  0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0xF1, 0xE3, 0xE3, 0xEF, 0x83, 0xE0,
+  0xF8, 0x3E, 0xF0, 0x79, 0xE0, 0xF1, 0xE3, 0xE3, 0xC7, 0x87, 0xDF, 0x07,
+  0xBC, 0x0F, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0x7C,
+  0x00, 0xF8, 0x01, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0x7C, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x3E, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x07,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0xFC, 0x3F, 0x87, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xE3, 0xF8, 0x7E, 0x0F, 0xE0,
+  0x3E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xF0, 0x7E, 0x07,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
+  0x83, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0,
+  0x3F, 0x83, 0xF0, 0xFE, 0x3E, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+  0x7F, 0x0F, 0xC1, 0xF0, 0x00, 0x3E, 0x02, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F,
+  0xE0, 0x0F, 0x80, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x03, 0x00, 0x60, 0x0C, 0x07, 0xE3, 0xFE, 0xFF, 0xDF, 0xCF, 0xD8,
+  0xF3, 0x1E, 0x63, 0xCC, 0x7D, 0x87, 0xF2, 0xFF, 0xCF, 0xF8, 0x7E, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x03, 0xF0, 0x7F, 0xC3, 0xFE, 0x3E, 0x11,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x7F, 0xE3, 0xFF, 0x1F, 0xF8, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40,
+  0x09, 0x80, 0x7F, 0xFF, 0x8F, 0xFC, 0x38, 0x70, 0xC0, 0xC3, 0x03, 0x0C,
+  0x0C, 0x30, 0x30, 0xE1, 0xC3, 0xFF, 0x1F, 0xFE, 0x60, 0x19, 0x00, 0x00,
+  0xF8, 0x1F, 0x7C, 0x3E, 0x7C, 0x3E, 0x3E, 0x7C, 0x1E, 0x78, 0x1F, 0xF8,
+  0x0F, 0xF0, 0x7F, 0xFE, 0x7F, 0xFE, 0x03, 0xC0, 0x03, 0xC0, 0x7F, 0xFE,
+  0x7F, 0xFE, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F, 0xC3, 0xFC, 0x78,
+  0x47, 0x80, 0x7C, 0x03, 0xF0, 0x3F, 0xC7, 0xFE, 0xF1, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x8F, 0x7F, 0xE3, 0xFC, 0x0F, 0xC0, 0x3E, 0x01, 0xE6, 0x1E, 0x7F,
+  0xC7, 0xF8, 0xE7, 0xE7, 0xE7, 0x03, 0xE0, 0x07, 0xFC, 0x0F, 0x07, 0x86,
+  0x00, 0xC6, 0x1F, 0x37, 0x3F, 0x9B, 0x3C, 0x47, 0x9C, 0x03, 0xCE, 0x01,
+  0xE7, 0x00, 0xF3, 0xC4, 0x6C, 0xFE, 0x66, 0x3F, 0x31, 0x80, 0x30, 0xF0,
+  0x78, 0x1F, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x1F, 0xE0, 0x3C, 0x07, 0x3F,
+  0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xDF, 0x70, 0x03, 0xFF, 0xFF, 0xC0, 0x04,
+  0x10, 0xC3, 0x1C, 0x77, 0x9E, 0xF3, 0xCE, 0x30, 0xF3, 0xC7, 0x9E, 0x1C,
+  0x70, 0xC3, 0x04, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x70,
+  0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x07,
+  0xFC, 0x0F, 0x07, 0x86, 0x00, 0xC6, 0x7E, 0x37, 0x3F, 0x9B, 0x1D, 0xC7,
+  0x8E, 0xE3, 0xC7, 0xF1, 0xE3, 0xE0, 0xF1, 0xF8, 0x6C, 0xEC, 0x66, 0x77,
+  0x31, 0x80, 0x30, 0xF0, 0x78, 0x1F, 0xF0, 0x03, 0xE0, 0x00, 0xFF, 0xFC,
+  0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x7C, 0xFF, 0x87, 0x07, 0x0E, 0x1E, 0x38, 0x70, 0xFF, 0xFF, 0xFE,
+  0xFF, 0x87, 0x07, 0x3E, 0x3E, 0x07, 0x87, 0xFF, 0xFE, 0x1C, 0x71, 0xC7,
+  0x00, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE7, 0x83, 0xCF, 0x07, 0x9E, 0x0F,
+  0x3C, 0x1E, 0x78, 0x3C, 0xF0, 0x79, 0xF1, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x79, 0xFE, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x1F,
+  0xEF, 0xFD, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0xFF, 0x9B, 0xF3, 0x7E, 0x63,
+  0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0xCC,
+  0x19, 0x83, 0x30, 0xFF, 0xFF, 0xF0, 0x30, 0xC7, 0xFF, 0x00, 0x7C, 0xFC,
+  0xDC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7F, 0x7F, 0x1F, 0x0F, 0xF9, 0xC7,
+  0x70, 0x7E, 0x0F, 0xC1, 0xF8, 0x3B, 0x8E, 0x7F, 0xC3, 0xE0, 0x00, 0x3F,
+  0xE7, 0xFC, 0x82, 0x0C, 0x30, 0xE3, 0x87, 0x9E, 0x3C, 0xF0, 0xC7, 0x3C,
+  0xF7, 0x9E, 0xE3, 0x8C, 0x30, 0x82, 0x00, 0x7C, 0x01, 0xE3, 0xF0, 0x07,
+  0x0D, 0xC0, 0x3C, 0x07, 0x01, 0xE0, 0x1C, 0x07, 0x00, 0x70, 0x3C, 0x01,
+  0xC0, 0xE0, 0x07, 0x07, 0x80, 0x7F, 0x1C, 0x71, 0xFC, 0xE3, 0xC0, 0x07,
+  0x9F, 0x00, 0x1C, 0x7C, 0x00, 0xF3, 0x70, 0x03, 0x99, 0xC0, 0x1E, 0x7F,
+  0xC0, 0xF1, 0xFF, 0x03, 0x80, 0x70, 0x1E, 0x01, 0xC0, 0x7C, 0x01, 0xE1,
+  0xF8, 0x03, 0x83, 0x70, 0x0F, 0x00, 0xE0, 0x3C, 0x01, 0xC0, 0x70, 0x03,
+  0x81, 0xE0, 0x07, 0x03, 0x80, 0x0E, 0x0F, 0x00, 0x7F, 0x1C, 0xF8, 0xFE,
+  0x73, 0xFC, 0x01, 0xE4, 0x38, 0x03, 0x80, 0x70, 0x0F, 0x01, 0xC0, 0x1C,
+  0x07, 0x80, 0x78, 0x1C, 0x01, 0xE0, 0x70, 0x03, 0x81, 0xFE, 0x0F, 0x03,
+  0xFC, 0xFE, 0x01, 0xE3, 0xFC, 0x07, 0x08, 0x70, 0x3C, 0x01, 0xC1, 0xE0,
+  0x3E, 0x07, 0x00, 0xF8, 0x3C, 0x00, 0x70, 0xE0, 0x21, 0xC7, 0x80, 0xFF,
+  0x1C, 0x73, 0xF8, 0xE3, 0xC0, 0x07, 0x9F, 0x00, 0x1C, 0x7C, 0x00, 0xF3,
+  0x70, 0x03, 0x99, 0xC0, 0x1E, 0x7F, 0xC0, 0xF1, 0xFF, 0x03, 0x80, 0x70,
+  0x1E, 0x01, 0xC0, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x01,
+  0xE0, 0x3C, 0x0F, 0x83, 0xE1, 0xF8, 0x3C, 0x0F, 0x01, 0xE0, 0x3E, 0x1F,
+  0xFF, 0x7F, 0xE3, 0xFC, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8,
+  0x03, 0xFF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x1F, 0x3E, 0x07, 0x87, 0x81,
+  0xE1, 0xE0, 0xF8, 0x7C, 0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0,
+  0x1E, 0x78, 0x07, 0xBC, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
+  0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
+  0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x1F, 0x3E, 0x07,
+  0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C, 0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF,
+  0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0xFC,
+  0x00, 0x61, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80,
+  0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x1F,
+  0x3E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C, 0x3F, 0xFF, 0x0F, 0xFF,
+  0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC, 0x00, 0xF0, 0x03, 0x98,
+  0x01, 0xFE, 0x00, 0x67, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3, 0xC0, 0x3C,
+  0xF0, 0x1F, 0x3E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C, 0x3F, 0xFF,
+  0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC, 0x00, 0xF0,
+  0x07, 0x38, 0x01, 0xCE, 0x00, 0x73, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3,
+  0xC0, 0x3C, 0xF0, 0x1F, 0x3E, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0xF8, 0x7C,
+  0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78, 0x07, 0xBC,
+  0x00, 0xF0, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x33, 0x00, 0x0C, 0xC0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
+  0x00, 0xFF, 0xC0, 0x3C, 0xF0, 0x0F, 0x3C, 0x07, 0x87, 0x81, 0xE1, 0xE0,
+  0xF8, 0x7C, 0x3F, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xE0, 0x1E, 0x78,
+  0x07, 0xBC, 0x00, 0xF0, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFF, 0x03, 0xCF, 0x00, 0x03, 0xCF, 0x00, 0x07, 0x8F, 0x00, 0x07, 0x8F,
+  0x00, 0x0F, 0x8F, 0xFE, 0x0F, 0x0F, 0xFE, 0x1F, 0x0F, 0xFE, 0x1E, 0x0F,
+  0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7C, 0x0F,
+  0x00, 0x78, 0x0F, 0xFF, 0x78, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x03, 0xF8,
+  0x1F, 0xFC, 0xFF, 0xF9, 0xF0, 0x77, 0xC0, 0x2F, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80,
+  0x4F, 0x83, 0x9F, 0xFF, 0x0F, 0xFE, 0x07, 0xF0, 0x03, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE,
+  0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x0F, 0x81, 0xDC, 0x38, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xC3, 0x9C,
+  0x39, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xE1, 0xC0, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF0, 0x39,
+  0xCE, 0x00, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xC0, 0x1E, 0x0F, 0xC6, 0x18, 0x00, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x80, 0xE7, 0xE7, 0xE7, 0x00,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0xF0, 0x0F, 0xFF, 0x03, 0xFF,
+  0xF0, 0xF0, 0x7C, 0x3C, 0x0F, 0x8F, 0x01, 0xE3, 0xC0, 0x3F, 0xFE, 0x0F,
+  0xFF, 0x83, 0xFF, 0xE0, 0xF3, 0xC0, 0x3C, 0xF0, 0x0F, 0x3C, 0x07, 0x8F,
+  0x03, 0xE3, 0xC1, 0xF0, 0xFF, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x07,
+  0x30, 0x0F, 0xF0, 0x0C, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0xFC, 0x0F, 0xFC,
+  0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFF, 0x0F, 0xF7, 0x0F, 0xF7, 0x8F, 0xF3,
+  0x8F, 0xF1, 0xCF, 0xF1, 0xCF, 0xF0, 0xEF, 0xF0, 0xEF, 0xF0, 0x7F, 0xF0,
+  0x7F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0x03, 0x80, 0x00, 0x70, 0x00,
+  0x0E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8,
+  0x7E, 0x78, 0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9E, 0x01, 0xE7,
+  0xE1, 0xF8, 0xFF, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF,
+  0xF1, 0xF8, 0x7E, 0x78, 0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9E,
+  0x01, 0xE7, 0xE1, 0xF8, 0xFF, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0x01,
+  0xF0, 0x00, 0xEE, 0x00, 0x71, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF,
+  0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x78, 0x07, 0xBE, 0x01, 0xEF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8,
+  0x07, 0x9E, 0x01, 0xE7, 0xE1, 0xF8, 0xFF, 0xFC, 0x1F, 0xFC, 0x01, 0xFE,
+  0x00, 0x03, 0x98, 0x01, 0xFE, 0x00, 0x67, 0x00, 0x00, 0x00, 0x03, 0xF0,
+  0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x78, 0x07, 0xBE, 0x01, 0xEF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF8, 0x07, 0x9E, 0x01, 0xE7, 0xE1, 0xF8, 0xFF, 0xFC, 0x1F, 0xFC,
+  0x01, 0xFE, 0x00, 0x07, 0x38, 0x01, 0xCE, 0x00, 0x73, 0x80, 0x00, 0x00,
+  0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x78, 0x07, 0xBE,
+  0x01, 0xEF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
+  0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9E, 0x01, 0xE7, 0xE1, 0xF8, 0xFF, 0xFC,
+  0x1F, 0xFC, 0x01, 0xFE, 0x00, 0x40, 0x0B, 0x80, 0x77, 0x03, 0x8E, 0x1C,
+  0x1C, 0xE0, 0x3F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x73, 0x83, 0x87,
+  0x1C, 0x0E, 0xE0, 0x1D, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1F, 0xC6, 0x07,
+  0xFF, 0xE1, 0xFF, 0xFC, 0x1F, 0x0F, 0xC3, 0xC0, 0x7C, 0x3C, 0x0F, 0xE7,
+  0x81, 0xDE, 0x78, 0x39, 0xE7, 0x87, 0x1E, 0x78, 0xE1, 0xE7, 0x9C, 0x1E,
+  0x7B, 0x81, 0xE7, 0xF0, 0x3C, 0x3C, 0x03, 0xC3, 0xF0, 0xF8, 0x3F, 0xFF,
+  0x86, 0xFF, 0xE0, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x00, 0x0F, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0,
+  0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07,
+  0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x7D, 0xE0, 0xF3, 0xFF, 0xE3, 0xFF, 0x81,
+  0xFC, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x0F, 0x01, 0xFE,
+  0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80,
+  0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x7D,
+  0xE0, 0xF3, 0xFF, 0xE3, 0xFF, 0x81, 0xFC, 0x00, 0x07, 0xC0, 0x1D, 0xC0,
+  0x71, 0xC0, 0x00, 0x0F, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0,
+  0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07,
+  0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x7D, 0xE0, 0xF3, 0xFF, 0xE3, 0xFF, 0x81,
+  0xFC, 0x00, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0x00, 0x0F, 0x01, 0xFE,
+  0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80,
+  0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x7D,
+  0xE0, 0xF3, 0xFF, 0xE3, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xDF, 0x03, 0xE3, 0xC1, 0xF0,
+  0xF8, 0x7C, 0x1F, 0x3E, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xE0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF, 0xBC, 0x1F,
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0xFE,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x1F, 0x81, 0xFF, 0x87, 0xFE, 0x3E,
+  0x7C, 0xF0, 0xF3, 0xC7, 0xCF, 0x7C, 0x3D, 0xE0, 0xF7, 0xC3, 0xDF, 0x8F,
+  0x3F, 0xBC, 0x3E, 0xF0, 0x3F, 0xC0, 0xFF, 0x47, 0xFD, 0xFF, 0xF7, 0xFB,
+  0xCF, 0x80, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x0F, 0xFE, 0x7F, 0xF2, 0x07, 0xC0, 0x1E, 0x3F, 0xF7, 0xFF, 0xFF,
+  0xFF, 0xC1, 0xFE, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xFE, 0x7F, 0xF2,
+  0x07, 0xC0, 0x1E, 0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x1F, 0xFF,
+  0xFB, 0xFF, 0xCF, 0x9E, 0x03, 0x80, 0x3E, 0x03, 0xB8, 0x38, 0xE0, 0x00,
+  0x00, 0x00, 0x7F, 0x0F, 0xFE, 0x7F, 0xF2, 0x07, 0xC0, 0x1E, 0x3F, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x0E,
+  0x60, 0xFB, 0x06, 0xF8, 0x33, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xFE,
+  0x7F, 0xF2, 0x07, 0xC0, 0x1E, 0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE,
+  0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xFE, 0x7F, 0xF2, 0x07, 0xC0, 0x1E,
+  0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF,
+  0x9E, 0x03, 0x80, 0x3E, 0x03, 0x18, 0x18, 0xC0, 0xC6, 0x03, 0xE0, 0x0E,
+  0x00, 0x00, 0x1F, 0xC3, 0xFF, 0x9F, 0xFC, 0x81, 0xF0, 0x07, 0x8F, 0xFD,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x87, 0xFF, 0xFE, 0xFF, 0xF3, 0xE7, 0x80,
+  0x1F, 0x87, 0xE0, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xF2, 0x07, 0xE1, 0xE0,
+  0x07, 0x81, 0xE3, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x78, 0x01, 0xE1, 0xF8, 0x1B, 0xFF, 0xFF, 0xF3, 0xFE, 0xFF, 0xE3, 0xF0,
+  0x7F, 0x00, 0x0F, 0xE3, 0xFF, 0x7F, 0xF7, 0xC1, 0xF8, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF8, 0x07, 0xC1, 0x7F, 0xF3, 0xFF, 0x0F, 0xE0, 0x30, 0x01,
+  0x80, 0x18, 0x0F, 0x80, 0xF0, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x06, 0x7F, 0xF8, 0xFF,
+  0xE0, 0xFE, 0x00, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x06, 0x7F, 0xF8, 0xFF, 0xE0, 0xFE,
+  0x00, 0x01, 0xC0, 0x0F, 0x80, 0x77, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x1E, 0x06, 0x7F, 0xF8, 0xFF, 0xE0, 0xFE, 0x00, 0x0E,
+  0x70, 0x39, 0xC0, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
+  0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x1E, 0x06, 0x7F, 0xF8, 0xFF, 0xE0, 0xFE, 0x00, 0x70, 0x70, 0x70,
+  0x70, 0x00, 0x07, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E,
+  0x3C, 0x78, 0x1C, 0x71, 0xC7, 0x00, 0x00, 0x3C, 0x78, 0xF1, 0xE3, 0xC7,
+  0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC0, 0x1E, 0x0F, 0xC3, 0x31, 0x86,
+  0x00, 0x00, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
+  0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xE7, 0xE7, 0xE7, 0x00, 0x00,
+  0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x1E, 0x18, 0x3F, 0xE0, 0xFC, 0x1F, 0xF0, 0x71, 0xE0, 0x03,
+  0xC1, 0xFF, 0x0F, 0xFE, 0x7F, 0xFB, 0xE1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xF7, 0x87, 0x9F, 0xFE, 0x3F, 0xF0, 0x3F, 0x00, 0x0E, 0x60,
+  0xFB, 0x06, 0xF8, 0x33, 0x80, 0x00, 0x00, 0x03, 0xCF, 0x9F, 0xFE, 0xFF,
+  0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
+  0xF0, 0x7F, 0x83, 0xFC, 0x1E, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xDE, 0x1E, 0x7F, 0xF8, 0xFF,
+  0xC0, 0xFC, 0x00, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xDE, 0x1E, 0x7F, 0xF8, 0xFF, 0xC0, 0xFC,
+  0x00, 0x07, 0x80, 0x3F, 0x00, 0xCC, 0x06, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x0F, 0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xFF, 0x03, 0xDE, 0x1E, 0x7F, 0xF8, 0xFF, 0xC0, 0xFC, 0x00, 0x0E,
+  0x60, 0x7D, 0x81, 0xBE, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
+  0xFC, 0x7F, 0xF9, 0xE1, 0xEF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x03, 0xDE, 0x1E, 0x7F, 0xF8, 0xFF, 0xC0, 0xFC, 0x00, 0x1C, 0xE0, 0x73,
+  0x81, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x7F,
+  0xF9, 0xE1, 0xEF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xDE,
+  0x1E, 0x7F, 0xF8, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x00, 0x00, 0x3F, 0x33, 0xFF, 0x9F, 0xFE, 0x78, 0x7B, 0xC3, 0xFF,
+  0x1B, 0xFC, 0xCF, 0xF6, 0x3F, 0xF0, 0xF7, 0x87, 0x9F, 0xFE, 0x7F, 0xF3,
+  0x7F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x00,
+  0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF,
+  0x07, 0xF8, 0x3F, 0xC1, 0xFF, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x00,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xFE, 0x0F,
+  0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFF,
+  0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x07, 0x00, 0x7C, 0x07, 0x70, 0x71,
+  0xC0, 0x00, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFF, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF,
+  0x9E, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1,
+  0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F,
+  0xC1, 0xFF, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0x9E, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xBC, 0x1E, 0x78,
+  0x3C, 0x78, 0xF8, 0xF1, 0xE1, 0xF7, 0xC1, 0xEF, 0x03, 0xFE, 0x03, 0xFC,
+  0x07, 0xF0, 0x07, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x78, 0x07,
+  0xF0, 0x0F, 0xC0, 0x1F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xCF, 0x8F, 0xFF, 0x3F, 0xFE, 0xF8, 0x7B, 0xC0, 0xFF, 0x03,
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x87, 0xBF, 0xFE, 0xFF, 0xF3, 0xCF,
+  0x8F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x0E, 0x70,
+  0x1C, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xBC,
+  0x1E, 0x78, 0x3C, 0x78, 0xF8, 0xF1, 0xE1, 0xF7, 0xC1, 0xEF, 0x03, 0xFE,
+  0x03, 0xFC, 0x07, 0xF0, 0x07, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+  0x78, 0x07, 0xF0, 0x0F, 0xC0, 0x1F, 0x00 };
+
+const GFXglyph DejaVuSans_Bold12pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   4,  18,  11,    3,  -17 },   // 0x21 '!'
+  {    10,   8,   7,  13,    2,  -17 },   // 0x22 '"'
+  {    17,  17,  18,  20,    2,  -17 },   // 0x23 '#'
+  {    56,  14,  23,  17,    1,  -18 },   // 0x24 '$'
+  {    97,  23,  18,  24,    1,  -17 },   // 0x25 '%'
+  {   149,  18,  18,  21,    1,  -17 },   // 0x26 '&'
+  {   190,   3,   7,   7,    2,  -17 },   // 0x27 '''
+  {   193,   7,  21,  11,    2,  -17 },   // 0x28 '('
+  {   212,   7,  21,  11,    2,  -17 },   // 0x29 ')'
+  {   231,  12,  11,  13,    0,  -17 },   // 0x2A '*'
+  {   248,  15,  15,  20,    3,  -14 },   // 0x2B '+'
+  {   277,   5,   8,   9,    1,   -4 },   // 0x2C ','
+  {   282,   7,   3,  10,    1,   -8 },   // 0x2D '-'
+  {   285,   4,   5,   9,    2,   -4 },   // 0x2E '.'
+  {   288,   9,  20,   9,    0,  -17 },   // 0x2F '/'
+  {   311,  14,  18,  17,    1,  -17 },   // 0x30 '0'
+  {   343,  12,  18,  17,    3,  -17 },   // 0x31 '1'
+  {   370,  13,  18,  17,    2,  -17 },   // 0x32 '2'
+  {   400,  13,  18,  17,    1,  -17 },   // 0x33 '3'
+  {   430,  15,  18,  17,    1,  -17 },   // 0x34 '4'
+  {   464,  13,  18,  17,    2,  -17 },   // 0x35 '5'
+  {   494,  14,  18,  17,    1,  -17 },   // 0x36 '6'
+  {   526,  13,  18,  17,    2,  -17 },   // 0x37 '7'
+  {   556,  14,  18,  17,    1,  -17 },   // 0x38 '8'
+  {   588,  14,  18,  17,    1,  -17 },   // 0x39 '9'
+  {   620,   4,  13,  10,    3,  -12 },   // 0x3A ':'
+  {   627,   5,  16,  10,    2,  -12 },   // 0x3B ';'
+  {   637,  15,  14,  20,    3,  -13 },   // 0x3C '<'
+  {   664,  15,   9,  20,    3,  -11 },   // 0x3D '='
+  {   681,  15,  14,  20,    3,  -13 },   // 0x3E '>'
+  {   708,  11,  18,  14,    2,  -17 },   // 0x3F '?'
+  {   733,  21,  21,  24,    2,  -17 },   // 0x40 '@'
+  {   789,  18,  18,  19,    0,  -17 },   // 0x41 'A'
+  {   830,  14,  18,  18,    2,  -17 },   // 0x42 'B'
+  {   862,  15,  18,  18,    1,  -17 },   // 0x43 'C'
+  {   896,  16,  18,  20,    2,  -17 },   // 0x44 'D'
+  {   932,  12,  18,  16,    2,  -17 },   // 0x45 'E'
+  {   959,  12,  18,  16,    2,  -17 },   // 0x46 'F'
+  {   986,  17,  18,  20,    1,  -17 },   // 0x47 'G'
+  {  1025,  16,  18,  20,    2,  -17 },   // 0x48 'H'
+  {  1061,   4,  18,   9,    2,  -17 },   // 0x49 'I'
+  {  1070,   8,  23,   9,   -2,  -17 },   // 0x4A 'J'
+  {  1093,  17,  18,  19,    2,  -17 },   // 0x4B 'K'
+  {  1132,  12,  18,  15,    2,  -17 },   // 0x4C 'L'
+  {  1159,  19,  18,  24,    2,  -17 },   // 0x4D 'M'
+  {  1202,  16,  18,  20,    2,  -17 },   // 0x4E 'N'
+  {  1238,  18,  18,  20,    1,  -17 },   // 0x4F 'O'
+  {  1279,  14,  18,  18,    2,  -17 },   // 0x50 'P'
+  {  1311,  18,  22,  20,    1,  -17 },   // 0x51 'Q'
+  {  1361,  16,  18,  18,    2,  -17 },   // 0x52 'R'
+  {  1397,  14,  18,  17,    2,  -17 },   // 0x53 'S'
+  {  1429,  16,  18,  16,    0,  -17 },   // 0x54 'T'
+  {  1465,  15,  18,  19,    2,  -17 },   // 0x55 'U'
+  {  1499,  18,  18,  19,    0,  -17 },   // 0x56 'V'
+  {  1540,  25,  18,  26,    1,  -17 },   // 0x57 'W'
+  {  1597,  18,  18,  19,    0,  -17 },   // 0x58 'X'
+  {  1638,  18,  18,  17,   -1,  -17 },   // 0x59 'Y'
+  {  1679,  15,  18,  17,    1,  -17 },   // 0x5A 'Z'
+  {  1713,   7,  21,  11,    2,  -17 },   // 0x5B '['
+  {  1732,   9,  20,   9,    0,  -17 },   // 0x5C '\'
+  {  1755,   7,  21,  11,    2,  -17 },   // 0x5D ']'
+  {  1774,  15,   7,  20,    2,  -17 },   // 0x5E '^'
+  {  1788,  12,   2,  12,    0,    5 },   // 0x5F '_'
+  {  1791,   7,   4,  12,    1,  -18 },   // 0x60 '`'
+  {  1795,  13,  13,  16,    1,  -12 },   // 0x61 'a'
+  {  1817,  14,  18,  17,    2,  -17 },   // 0x62 'b'
+  {  1849,  12,  13,  14,    1,  -12 },   // 0x63 'c'
+  {  1869,  14,  18,  17,    1,  -17 },   // 0x64 'd'
+  {  1901,  14,  13,  16,    1,  -12 },   // 0x65 'e'
+  {  1924,  10,  18,  10,    1,  -17 },   // 0x66 'f'
+  {  1947,  14,  18,  17,    1,  -12 },   // 0x67 'g'
+  {  1979,  13,  18,  17,    2,  -17 },   // 0x68 'h'
+  {  2009,   4,  18,   8,    2,  -17 },   // 0x69 'i'
+  {  2018,   7,  23,   8,   -1,  -17 },   // 0x6A 'j'
+  {  2039,  14,  18,  16,    2,  -17 },   // 0x6B 'k'
+  {  2071,   4,  18,   8,    2,  -17 },   // 0x6C 'l'
+  {  2080,  20,  13,  25,    2,  -12 },   // 0x6D 'm'
+  {  2113,  13,  13,  17,    2,  -12 },   // 0x6E 'n'
+  {  2135,  14,  13,  16,    1,  -12 },   // 0x6F 'o'
+  {  2158,  14,  18,  17,    2,  -12 },   // 0x70 'p'
+  {  2190,  14,  18,  17,    1,  -12 },   // 0x71 'q'
+  {  2222,  10,  13,  12,    2,  -12 },   // 0x72 'r'
+  {  2239,  12,  13,  14,    1,  -12 },   // 0x73 's'
+  {  2259,  10,  17,  11,    0,  -16 },   // 0x74 't'
+  {  2281,  13,  13,  17,    2,  -12 },   // 0x75 'u'
+  {  2303,  15,  13,  16,    0,  -12 },   // 0x76 'v'
+  {  2328,  21,  13,  22,    1,  -12 },   // 0x77 'w'
+  {  2363,  15,  13,  15,    0,  -12 },   // 0x78 'x'
+  {  2388,  15,  18,  16,    0,  -12 },   // 0x79 'y'
+  {  2422,  12,  13,  14,    1,  -12 },   // 0x7A 'z'
+  {  2442,  11,  22,  17,    3,  -17 },   // 0x7B '{'
+  {  2473,   3,  24,   9,    3,  -17 },   // 0x7C '|'
+  {  2482,  11,  22,  17,    3,  -17 },   // 0x7D '}'
+  {  2513,  15,   5,  20,    3,   -9 },   // 0x7E '~'
+  {  2523,  12,  21,  14,    1,  -16 },   // 0x7F
+  {  2555,  12,  21,  14,    1,  -16 },   // 0x80
+  {  2587,  12,  21,  14,    1,  -16 },   // 0x81
+  {  2619,  12,  21,  14,    1,  -16 },   // 0x82
+  {  2651,  12,  21,  14,    1,  -16 },   // 0x83
+  {  2683,  12,  21,  14,    1,  -16 },   // 0x84
+  {  2715,  12,  21,  14,    1,  -16 },   // 0x85
+  {  2747,  12,  21,  14,    1,  -16 },   // 0x86
+  {  2779,  12,  21,  14,    1,  -16 },   // 0x87
+  {  2811,  12,  21,  14,    1,  -16 },   // 0x88
+  {  2843,  12,  21,  14,    1,  -16 },   // 0x89
+  {  2875,  12,  21,  14,    1,  -16 },   // 0x8A
+  {  2907,  12,  21,  14,    1,  -16 },   // 0x8B
+  {  2939,  12,  21,  14,    1,  -16 },   // 0x8C
+  {  2971,  12,  21,  14,    1,  -16 },   // 0x8D
+  {  3003,  12,  21,  14,    1,  -16 },   // 0x8E
+  {  3035,  12,  21,  14,    1,  -16 },   // 0x8F
+  {  3067,  12,  21,  14,    1,  -16 },   // 0x90
+  {  3099,  12,  21,  14,    1,  -16 },   // 0x91
+  {  3131,  12,  21,  14,    1,  -16 },   // 0x92
+  {  3163,  12,  21,  14,    1,  -16 },   // 0x93
+  {  3195,  12,  21,  14,    1,  -16 },   // 0x94
+  {  3227,  12,  21,  14,    1,  -16 },   // 0x95
+  {  3259,  12,  21,  14,    1,  -16 },   // 0x96
+  {  3291,  12,  21,  14,    1,  -16 },   // 0x97
+  {  3323,  12,  21,  14,    1,  -16 },   // 0x98
+  {  3355,  12,  21,  14,    1,  -16 },   // 0x99
+  {  3387,  12,  21,  14,    1,  -16 },   // 0x9A
+  {  3419,  12,  21,  14,    1,  -16 },   // 0x9B
+  {  3451,  12,  21,  14,    1,  -16 },   // 0x9C
+  {  3483,  12,  21,  14,    1,  -16 },   // 0x9D
+  {  3515,  12,  21,  14,    1,  -16 },   // 0x9E
+  {  3547,  12,  21,  14,    1,  -16 },   // 0x9F
+  {  3579,   1,   1,   8,    0,    0 },   // 0xA0
+  {  3580,   4,  18,  11,    3,  -12 },   // 0xA1
+  {  3589,  11,  20,  17,    2,  -15 },   // 0xA2
+  {  3617,  13,  18,  17,    1,  -17 },   // 0xA3
+  {  3647,  14,  14,  15,    1,  -14 },   // 0xA4
+  {  3672,  16,  18,  17,    0,  -17 },   // 0xA5
+  {  3708,   3,  21,   9,    3,  -16 },   // 0xA6
+  {  3716,  12,  20,  12,    1,  -17 },   // 0xA7
+  {  3746,   8,   3,  12,    2,  -18 },   // 0xA8
+  {  3749,  17,  17,  24,    3,  -16 },   // 0xA9
+  {  3786,  10,  13,  14,    2,  -17 },   // 0xAA
+  {  3803,  12,  11,  16,    2,  -11 },   // 0xAB
+  {  3820,  15,   7,  20,    3,  -10 },   // 0xAC
+  {  3834,   7,   3,  10,    1,   -8 },   // 0xAD
+  {  3837,  17,  17,  24,    3,  -16 },   // 0xAE
+  {  3874,   7,   2,  12,    2,  -17 },   // 0xAF
+  {  3876,   8,   8,  12,    2,  -17 },   // 0xB0
+  {  3884,  15,  15,  20,    3,  -14 },   // 0xB1
+  {  3913,   8,  10,  11,    1,  -17 },   // 0xB2
+  {  3923,   8,  10,  11,    1,  -17 },   // 0xB3
+  {  3933,   7,   4,  12,    4,  -18 },   // 0xB4
+  {  3937,  15,  18,  18,    2,  -12 },   // 0xB5
+  {  3971,  11,  20,  15,    2,  -17 },   // 0xB6
+  {  3999,   4,   5,   9,    2,  -10 },   // 0xB7
+  {  4002,   5,   5,  12,    3,    1 },   // 0xB8
+  {  4006,   8,  10,  11,    1,  -17 },   // 0xB9
+  {  4016,  11,  13,  14,    1,  -17 },   // 0xBA
+  {  4034,  12,  11,  16,    2,  -11 },   // 0xBB
+  {  4051,  22,  18,  25,    1,  -17 },   // 0xBC
+  {  4101,  23,  18,  25,    1,  -17 },   // 0xBD
+  {  4153,  22,  18,  25,    1,  -17 },   // 0xBE
+  {  4203,  11,  18,  14,    2,  -12 },   // 0xBF
+  {  4228,  18,  22,  19,    0,  -21 },   // 0xC0
+  {  4278,  18,  22,  19,    0,  -21 },   // 0xC1
+  {  4328,  18,  22,  19,    0,  -21 },   // 0xC2
+  {  4378,  18,  22,  19,    0,  -21 },   // 0xC3
+  {  4428,  18,  22,  19,    0,  -21 },   // 0xC4
+  {  4478,  18,  22,  19,    0,  -21 },   // 0xC5
+  {  4528,  24,  18,  26,    0,  -17 },   // 0xC6
+  {  4582,  15,  23,  18,    1,  -17 },   // 0xC7
+  {  4626,  12,  22,  16,    2,  -21 },   // 0xC8
+  {  4659,  12,  22,  16,    2,  -21 },   // 0xC9
+  {  4692,  12,  22,  16,    2,  -21 },   // 0xCA
+  {  4725,  12,  22,  16,    2,  -21 },   // 0xCB
+  {  4758,   6,  22,   9,    0,  -21 },   // 0xCC
+  {  4775,   6,  22,   9,    2,  -21 },   // 0xCD
+  {  4792,  10,  22,   9,   -1,  -21 },   // 0xCE
+  {  4820,   8,  22,   9,    0,  -21 },   // 0xCF
+  {  4842,  18,  18,  20,    0,  -17 },   // 0xD0
+  {  4883,  16,  22,  20,    2,  -21 },   // 0xD1
+  {  4927,  18,  22,  20,    1,  -21 },   // 0xD2
+  {  4977,  18,  22,  20,    1,  -21 },   // 0xD3
+  {  5027,  18,  22,  20,    1,  -21 },   // 0xD4
+  {  5077,  18,  22,  20,    1,  -21 },   // 0xD5
+  {  5127,  18,  22,  20,    1,  -21 },   // 0xD6
+  {  5177,  14,  14,  20,    3,  -14 },   // 0xD7
+  {  5202,  20,  20,  20,    0,  -18 },   // 0xD8
+  {  5252,  15,  22,  19,    2,  -21 },   // 0xD9
+  {  5294,  15,  22,  19,    2,  -21 },   // 0xDA
+  {  5336,  15,  22,  19,    2,  -21 },   // 0xDB
+  {  5378,  15,  22,  19,    2,  -21 },   // 0xDC
+  {  5420,  18,  22,  17,   -1,  -21 },   // 0xDD
+  {  5470,  14,  18,  18,    2,  -17 },   // 0xDE
+  {  5502,  14,  18,  17,    2,  -17 },   // 0xDF
+  {  5534,  13,  19,  16,    1,  -18 },   // 0xE0
+  {  5565,  13,  19,  16,    1,  -18 },   // 0xE1
+  {  5596,  13,  19,  16,    1,  -18 },   // 0xE2
+  {  5627,  13,  19,  16,    1,  -18 },   // 0xE3
+  {  5658,  13,  19,  16,    1,  -18 },   // 0xE4
+  {  5689,  13,  21,  16,    1,  -20 },   // 0xE5
+  {  5724,  23,  13,  25,    1,  -12 },   // 0xE6
+  {  5762,  12,  18,  14,    1,  -12 },   // 0xE7
+  {  5789,  14,  19,  16,    1,  -18 },   // 0xE8
+  {  5823,  14,  19,  16,    1,  -18 },   // 0xE9
+  {  5857,  14,  19,  16,    1,  -18 },   // 0xEA
+  {  5891,  14,  19,  16,    1,  -18 },   // 0xEB
+  {  5925,   7,  19,   8,   -1,  -18 },   // 0xEC
+  {  5942,   7,  19,   8,    2,  -18 },   // 0xED
+  {  5959,  10,  19,   8,   -1,  -18 },   // 0xEE
+  {  5983,   8,  19,   8,    0,  -18 },   // 0xEF
+  {  6002,  14,  18,  16,    1,  -17 },   // 0xF0
+  {  6034,  13,  19,  17,    2,  -18 },   // 0xF1
+  {  6065,  14,  19,  16,    1,  -18 },   // 0xF2
+  {  6099,  14,  19,  16,    1,  -18 },   // 0xF3
+  {  6133,  14,  19,  16,    1,  -18 },   // 0xF4
+  {  6167,  14,  19,  16,    1,  -18 },   // 0xF5
+  {  6201,  14,  19,  16,    1,  -18 },   // 0xF6
+  {  6235,  16,  15,  20,    2,  -14 },   // 0xF7
+  {  6265,  14,  15,  16,    1,  -13 },   // 0xF8
+  {  6292,  13,  19,  17,    2,  -18 },   // 0xF9
+  {  6323,  13,  19,  17,    2,  -18 },   // 0xFA
+  {  6354,  13,  19,  17,    2,  -18 },   // 0xFB
+  {  6385,  13,  19,  17,    2,  -18 },   // 0xFC
+  {  6416,  15,  24,  16,    0,  -18 },   // 0xFD
+  {  6461,  14,  23,  17,    2,  -17 },   // 0xFE
+  {  6502,  15,  24,  16,    0,  -18 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold12pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold12pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold12pt8bGlyphs,
+  0x20, 0xFF, 27 };
+
+// Approx. 8122 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold12pt8bMetrics[] PROGMEM = {
+  {   0,   8,   1 },   // 0x20
+  {   3,  11,   7 },   // 0x21
+  {   2,  13,  10 },   // 0x22
+  {   2,  20,  19 },   // 0x23
+  {   1,  17,  15 },   // 0x24
+  {   1,  24,  24 },   // 0x25
+  {   1,  21,  19 },   // 0x26
+  {   2,   7,   5 },   // 0x27
+  {   2,  11,   9 },   // 0x28
+  {   2,  11,   9 },   // 0x29
+  {   0,  13,  12 },   // 0x2A
+  {   3,  20,  18 },   // 0x2B
+  {   1,   9,   6 },   // 0x2C
+  {   1,  10,   8 },   // 0x2D
+  {   2,   9,   6 },   // 0x2E
+  {   0,   9,   9 },   // 0x2F
+  {   1,  17,  15 },   // 0x30
+  {   3,  17,  15 },   // 0x31
+  {   2,  17,  15 },   // 0x32
+  {   1,  17,  14 },   // 0x33
+  {   1,  17,  16 },   // 0x34
+  {   2,  17,  15 },   // 0x35
+  {   1,  17,  15 },   // 0x36
+  {   2,  17,  15 },   // 0x37
+  {   1,  17,  15 },   // 0x38
+  {   1,  17,  15 },   // 0x39
+  {   3,  10,   7 },   // 0x3A
+  {   2,  10,   7 },   // 0x3B
+  {   3,  20,  18 },   // 0x3C
+  {   3,  20,  18 },   // 0x3D
+  {   3,  20,  18 },   // 0x3E
+  {   2,  14,  13 },   // 0x3F
+  {   2,  24,  23 },   // 0x40
+  {   0,  19,  18 },   // 0x41
+  {   2,  18,  16 },   // 0x42
+  {   1,  18,  16 },   // 0x43
+  {   2,  20,  18 },   // 0x44
+  {   2,  16,  14 },   // 0x45
+  {   2,  16,  14 },   // 0x46
+  {   1,  20,  18 },   // 0x47
+  {   2,  20,  18 },   // 0x48
+  {   2,   9,   6 },   // 0x49
+  {  -2,   9,   6 },   // 0x4A
+  {   2,  19,  19 },   // 0x4B
+  {   2,  15,  14 },   // 0x4C
+  {   2,  24,  21 },   // 0x4D
+  {   2,  20,  18 },   // 0x4E
+  {   1,  20,  19 },   // 0x4F
+  {   2,  18,  16 },   // 0x50
+  {   1,  20,  19 },   // 0x51
+  {   2,  18,  18 },   // 0x52
+  {   2,  17,  16 },   // 0x53
+  {   0,  16,  16 },   // 0x54
+  {   2,  19,  17 },   // 0x55
+  {   0,  19,  18 },   // 0x56
+  {   1,  26,  26 },   // 0x57
+  {   0,  19,  18 },   // 0x58
+  {  -1,  17,  17 },   // 0x59
+  {   1,  17,  16 },   // 0x5A
+  {   2,  11,   9 },   // 0x5B
+  {   0,   9,   9 },   // 0x5C
+  {   2,  11,   9 },   // 0x5D
+  {   2,  20,  17 },   // 0x5E
+  {   0,  12,  12 },   // 0x5F
+  {   1,  12,   8 },   // 0x60
+  {   1,  16,  14 },   // 0x61
+  {   2,  17,  16 },   // 0x62
+  {   1,  14,  13 },   // 0x63
+  {   1,  17,  15 },   // 0x64
+  {   1,  16,  15 },   // 0x65
+  {   1,  10,  11 },   // 0x66
+  {   1,  17,  15 },   // 0x67
+  {   2,  17,  15 },   // 0x68
+  {   2,   8,   6 },   // 0x69
+  {  -1,   8,   6 },   // 0x6A
+  {   2,  16,  16 },   // 0x6B
+  {   2,   8,   6 },   // 0x6C
+  {   2,  25,  22 },   // 0x6D
+  {   2,  17,  15 },   // 0x6E
+  {   1,  16,  15 },   // 0x6F
+  {   2,  17,  16 },   // 0x70
+  {   1,  17,  15 },   // 0x71
+  {   2,  12,  12 },   // 0x72
+  {   1,  14,  13 },   // 0x73
+  {   0,  11,  10 },   // 0x74
+  {   2,  17,  15 },   // 0x75
+  {   0,  16,  15 },   // 0x76
+  {   1,  22,  22 },   // 0x77
+  {   0,  15,  15 },   // 0x78
+  {   0,  16,  15 },   // 0x79
+  {   1,  14,  13 },   // 0x7A
+  {   3,  17,  14 },   // 0x7B
+  {   3,   9,   6 },   // 0x7C
+  {   3,  17,  14 },   // 0x7D
+  {   3,  20,  18 },   // 0x7E
+  {   1,  14,  13 },   // 0x7F
+  {   1,  14,  13 },   // 0x80
+  {   1,  14,  13 },   // 0x81
+  {   1,  14,  13 },   // 0x82
+  {   1,  14,  13 },   // 0x83
+  {   1,  14,  13 },   // 0x84
+  {   1,  14,  13 },   // 0x85
+  {   1,  14,  13 },   // 0x86
+  {   1,  14,  13 },   // 0x87
+  {   1,  14,  13 },   // 0x88
+  {   1,  14,  13 },   // 0x89
+  {   1,  14,  13 },   // 0x8A
+  {   1,  14,  13 },   // 0x8B
+  {   1,  14,  13 },   // 0x8C
+  {   1,  14,  13 },   // 0x8D
+  {   1,  14,  13 },   // 0x8E
+  {   1,  14,  13 },   // 0x8F
+  {   1,  14,  13 },   // 0x90
+  {   1,  14,  13 },   // 0x91
+  {   1,  14,  13 },   // 0x92
+  {   1,  14,  13 },   // 0x93
+  {   1,  14,  13 },   // 0x94
+  {   1,  14,  13 },   // 0x95
+  {   1,  14,  13 },   // 0x96
+  {   1,  14,  13 },   // 0x97
+  {   1,  14,  13 },   // 0x98
+  {   1,  14,  13 },   // 0x99
+  {   1,  14,  13 },   // 0x9A
+  {   1,  14,  13 },   // 0x9B
+  {   1,  14,  13 },   // 0x9C
+  {   1,  14,  13 },   // 0x9D
+  {   1,  14,  13 },   // 0x9E
+  {   1,  14,  13 },   // 0x9F
+  {   0,   8,   1 },   // 0xA0
+  {   3,  11,   7 },   // 0xA1
+  {   2,  17,  13 },   // 0xA2
+  {   1,  17,  14 },   // 0xA3
+  {   1,  15,  15 },   // 0xA4
+  {   0,  17,  16 },   // 0xA5
+  {   3,   9,   6 },   // 0xA6
+  {   1,  12,  13 },   // 0xA7
+  {   2,  12,  10 },   // 0xA8
+  {   3,  24,  20 },   // 0xA9
+  {   2,  14,  12 },   // 0xAA
+  {   2,  16,  14 },   // 0xAB
+  {   3,  20,  18 },   // 0xAC
+  {   1,  10,   8 },   // 0xAD
+  {   3,  24,  20 },   // 0xAE
+  {   2,  12,   9 },   // 0xAF
+  {   2,  12,  10 },   // 0xB0
+  {   3,  20,  18 },   // 0xB1
+  {   1,  11,   9 },   // 0xB2
+  {   1,  11,   9 },   // 0xB3
+  {   4,  12,  11 },   // 0xB4
+  {   2,  18,  17 },   // 0xB5
+  {   2,  15,  13 },   // 0xB6
+  {   2,   9,   6 },   // 0xB7
+  {   3,  12,   8 },   // 0xB8
+  {   1,  11,   9 },   // 0xB9
+  {   1,  14,  12 },   // 0xBA
+  {   2,  16,  14 },   // 0xBB
+  {   1,  25,  23 },   // 0xBC
+  {   1,  25,  24 },   // 0xBD
+  {   1,  25,  23 },   // 0xBE
+  {   2,  14,  13 },   // 0xBF
+  {   0,  19,  18 },   // 0xC0
+  {   0,  19,  18 },   // 0xC1
+  {   0,  19,  18 },   // 0xC2
+  {   0,  19,  18 },   // 0xC3
+  {   0,  19,  18 },   // 0xC4
+  {   0,  19,  18 },   // 0xC5
+  {   0,  26,  24 },   // 0xC6
+  {   1,  18,  16 },   // 0xC7
+  {   2,  16,  14 },   // 0xC8
+  {   2,  16,  14 },   // 0xC9
+  {   2,  16,  14 },   // 0xCA
+  {   2,  16,  14 },   // 0xCB
+  {   0,   9,   6 },   // 0xCC
+  {   2,   9,   8 },   // 0xCD
+  {  -1,   9,   9 },   // 0xCE
+  {   0,   9,   8 },   // 0xCF
+  {   0,  20,  18 },   // 0xD0
+  {   2,  20,  18 },   // 0xD1
+  {   1,  20,  19 },   // 0xD2
+  {   1,  20,  19 },   // 0xD3
+  {   1,  20,  19 },   // 0xD4
+  {   1,  20,  19 },   // 0xD5
+  {   1,  20,  19 },   // 0xD6
+  {   3,  20,  17 },   // 0xD7
+  {   0,  20,  20 },   // 0xD8
+  {   2,  19,  17 },   // 0xD9
+  {   2,  19,  17 },   // 0xDA
+  {   2,  19,  17 },   // 0xDB
+  {   2,  19,  17 },   // 0xDC
+  {  -1,  17,  17 },   // 0xDD
+  {   2,  18,  16 },   // 0xDE
+  {   2,  17,  16 },   // 0xDF
+  {   1,  16,  14 },   // 0xE0
+  {   1,  16,  14 },   // 0xE1
+  {   1,  16,  14 },   // 0xE2
+  {   1,  16,  14 },   // 0xE3
+  {   1,  16,  14 },   // 0xE4
+  {   1,  16,  14 },   // 0xE5
+  {   1,  25,  24 },   // 0xE6
+  {   1,  14,  13 },   // 0xE7
+  {   1,  16,  15 },   // 0xE8
+  {   1,  16,  15 },   // 0xE9
+  {   1,  16,  15 },   // 0xEA
+  {   1,  16,  15 },   // 0xEB
+  {  -1,   8,   6 },   // 0xEC
+  {   2,   8,   9 },   // 0xED
+  {  -1,   8,   9 },   // 0xEE
+  {   0,   8,   8 },   // 0xEF
+  {   1,  16,  15 },   // 0xF0
+  {   2,  17,  15 },   // 0xF1
+  {   1,  16,  15 },   // 0xF2
+  {   1,  16,  15 },   // 0xF3
+  {   1,  16,  15 },   // 0xF4
+  {   1,  16,  15 },   // 0xF5
+  {   1,  16,  15 },   // 0xF6
+  {   2,  20,  18 },   // 0xF7
+  {   1,  16,  15 },   // 0xF8
+  {   2,  17,  15 },   // 0xF9
+  {   2,  17,  15 },   // 0xFA
+  {   2,  17,  15 },   // 0xFB
+  {   2,  17,  15 },   // 0xFC
+  {   0,  16,  15 },   // 0xFD
+  {   2,  17,  16 },   // 0xFE
+  {   0,  16,  15 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold12pt8bWidths = { DejaVuSans_Bold12pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD12PTLAT1__H
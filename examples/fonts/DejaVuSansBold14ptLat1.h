@@ -0,0 +1,1167 @@
+#ifndef DEJAVUSANSBOLD14PTLAT1__H
+#define DEJAVUSANSBOLD14PTLAT1__H
+const uint8_t DejaVuSans_Bold14pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x00, 0x1F, 0xFF,
+  0xFF, 0xF0, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8E, 0x01, 0xC3,
+  0x80, 0x38, 0xE0, 0x07, 0x1C, 0x01, 0xC3, 0x80, 0x38, 0x60, 0x7F, 0xFF,
+  0xCF, 0xFF, 0xF9, 0xFF, 0xFF, 0x07, 0x0E, 0x00, 0xE3, 0x80, 0x1C, 0x70,
+  0x07, 0x0E, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x71, 0xC0,
+  0x1C, 0x38, 0x03, 0x8E, 0x00, 0x71, 0xC0, 0x0E, 0x38, 0x00, 0x03, 0x00,
+  0x0C, 0x00, 0x30, 0x07, 0xF8, 0x3F, 0xF9, 0xFF, 0xEF, 0xB1, 0xBC, 0xC0,
+  0xF3, 0x03, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC, 0x3F, 0xF8, 0x7F, 0xF0, 0x3F,
+  0xC0, 0xCF, 0x03, 0x3F, 0x0C, 0xFF, 0xFF, 0xBF, 0xFC, 0x3F, 0xE0, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x1F, 0x00, 0x60, 0x3F, 0xE0, 0x70,
+  0x1C, 0x70, 0x70, 0x1C, 0x1C, 0x30, 0x0E, 0x0E, 0x38, 0x07, 0x07, 0x18,
+  0x03, 0x83, 0x9C, 0x01, 0xC1, 0xDC, 0x00, 0x71, 0xCE, 0x00, 0x3F, 0xEE,
+  0x3E, 0x07, 0xCE, 0x7F, 0xC0, 0x07, 0x38, 0xE0, 0x07, 0x38, 0x38, 0x03,
+  0x9C, 0x1C, 0x03, 0x8E, 0x0E, 0x03, 0xC7, 0x07, 0x01, 0xC3, 0x83, 0x81,
+  0xC0, 0xE3, 0x81, 0xE0, 0x7F, 0xC0, 0xE0, 0x0F, 0x80, 0x03, 0xF0, 0x00,
+  0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x3E, 0x18, 0x01, 0xF0, 0x40, 0x0F, 0x80,
+  0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0xF1, 0xFF, 0x07, 0x9F,
+  0x7C, 0x7D, 0xF1, 0xF3, 0xCF, 0x87, 0xFE, 0x7C, 0x3F, 0xF3, 0xE0, 0xFF,
+  0x1F, 0x83, 0xF0, 0x7E, 0x1F, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F,
+  0xE3, 0xF0, 0xFF, 0xFF, 0xF8, 0x1E, 0x38, 0xF1, 0xE7, 0x8F, 0x1E, 0x78,
+  0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7,
+  0x87, 0x0F, 0xF0, 0xE1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0E, 0x1E, 0x3C, 0x78,
+  0xF1, 0xE3, 0xC7, 0x8F, 0x1C, 0x78, 0xF1, 0xE7, 0x8F, 0x1C, 0x78, 0x06,
+  0x00, 0x60, 0x46, 0x2E, 0x67, 0x7F, 0xE3, 0xFC, 0x0F, 0x03, 0xFC, 0x7F,
+  0xEE, 0x67, 0x46, 0x20, 0x60, 0x06, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00,
+  0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x7D, 0xF7, 0xDF, 0x7D,
+  0xEF, 0xBC, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+  0xC0, 0x70, 0x38, 0x0E, 0x03, 0x81, 0xC0, 0x70, 0x1C, 0x0E, 0x03, 0x80,
+  0xE0, 0x70, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x38, 0x1C, 0x07, 0x01, 0xC0,
+  0xE0, 0x38, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7E, 0x3E, 0x7C,
+  0x3E, 0x78, 0x1E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x78, 0x1E, 0x7C, 0x3E, 0x7C,
+  0x7E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x3F, 0xC3, 0xFF, 0x0F, 0xFC,
+  0x39, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
+  0xC1, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0x3F, 0xC3, 0xFF, 0xCF, 0xFF, 0xB8,
+  0x3F, 0x80, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xFC, 0x03, 0xF0,
+  0x1F, 0x80, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x1F, 0xE0, 0xFF, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF3, 0x03,
+  0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0xFC, 0x3F, 0xF0,
+  0x7F, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0xC0,
+  0xFF, 0xFF, 0xFB, 0xFF, 0xE1, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+  0xFF, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7B, 0xE0, 0x39, 0xF0, 0x3C, 0xF8,
+  0x3C, 0x7C, 0x1C, 0x3E, 0x1C, 0x1F, 0x1E, 0x0F, 0x8E, 0x07, 0xC7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x7F, 0xFC, 0xFF, 0xF9, 0xFF, 0xF3, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xC1, 0xF8, 0x01, 0xF8, 0x01,
+  0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x3F, 0xC0, 0xFD, 0xFF, 0xF3,
+  0xFF, 0xC1, 0xFE, 0x00, 0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0xFE, 0x3F, 0x06,
+  0x7C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xFB, 0xF0, 0xFF, 0xFC, 0xFF, 0xFE,
+  0xFC, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x78, 0x1F, 0x78, 0x1F,
+  0x7C, 0x3E, 0x3F, 0xFE, 0x1F, 0xF8, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0xFC, 0x01,
+  0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x03, 0xF0,
+  0x07, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0F, 0xF0,
+  0x3F, 0xFC, 0x7F, 0xFE, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0x7C, 0x3E, 0x3F, 0xFC, 0x0F, 0xF0, 0x3F, 0xFC, 0x7C, 0x3E, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7F, 0xFE, 0x3F, 0xFC,
+  0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xF8, 0x7F, 0xFC, 0x7C, 0x3E, 0xF8, 0x1E,
+  0xF8, 0x1E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x7C, 0x3F, 0x7F, 0xFF,
+  0x3F, 0xFF, 0x0F, 0xDF, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x40, 0xFC,
+  0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0, 0x7D, 0xF7, 0xDF, 0x7C, 0x00, 0x00, 0x00, 0x07,
+  0xDF, 0x7D, 0xF7, 0xDE, 0xFB, 0xCE, 0x00, 0x00, 0x00, 0x80, 0x03, 0xC0,
+  0x0F, 0xE0, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x03, 0xF8, 0x01, 0xE0, 0x00,
+  0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xF8, 0x00,
+  0x3C, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80,
+  0x00, 0x78, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF8,
+  0x00, 0xFE, 0x00, 0x0F, 0x00, 0x3F, 0x80, 0xFF, 0x83, 0xFE, 0x0F, 0xF8,
+  0x0F, 0xE0, 0x07, 0x80, 0x02, 0x00, 0x00, 0xFF, 0x8F, 0xFE, 0xFF, 0xEC,
+  0x3F, 0x01, 0xF0, 0x1F, 0x03, 0xF0, 0x7E, 0x0F, 0xC0, 0xF8, 0x1F, 0x81,
+  0xF0, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
+  0xF0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x3E, 0x07, 0x80, 0xF0, 0x03,
+  0x83, 0x80, 0x03, 0x86, 0x00, 0x03, 0x9C, 0x1E, 0xE3, 0x30, 0xFF, 0xC7,
+  0xE1, 0xC7, 0x87, 0x87, 0x07, 0x0F, 0x0E, 0x0E, 0x1E, 0x1C, 0x1C, 0x3C,
+  0x38, 0x38, 0x78, 0x70, 0x71, 0xF0, 0xE0, 0xE3, 0x70, 0xE3, 0xCC, 0x61,
+  0xFF, 0xF0, 0xC0, 0xF7, 0x80, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+  0x04, 0x01, 0xE0, 0x3C, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
+  0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x03,
+  0xFF, 0x80, 0x1F, 0x7C, 0x00, 0xFB, 0xE0, 0x0F, 0xDF, 0x80, 0x7C, 0x7C,
+  0x03, 0xE3, 0xE0, 0x3F, 0x0F, 0x81, 0xF0, 0x7C, 0x1F, 0xFF, 0xF0, 0xFF,
+  0xFF, 0x87, 0xFF, 0xFC, 0x7E, 0x03, 0xF3, 0xE0, 0x0F, 0x9F, 0x00, 0x7D,
+  0xF8, 0x03, 0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0xF8, 0x7E, 0xF8,
+  0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x7E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF,
+  0xFE, 0xF8, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x3F, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF0, 0x01, 0xFE, 0x03, 0xFF, 0xC7,
+  0xFF, 0xE7, 0xF0, 0x77, 0xE0, 0x0B, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00,
+  0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xE0,
+  0x01, 0xF0, 0x00, 0xFC, 0x01, 0x3F, 0x03, 0x8F, 0xFF, 0xC3, 0xFF, 0xE0,
+  0x3F, 0xC0, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x7C, 0x1F, 0xCF,
+  0x80, 0xFD, 0xF0, 0x0F, 0xBE, 0x01, 0xF7, 0xC0, 0x1F, 0xF8, 0x03, 0xFF,
+  0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xBE,
+  0x01, 0xF7, 0xC0, 0x7E, 0xF8, 0x3F, 0x9F, 0xFF, 0xE3, 0xFF, 0xF0, 0x7F,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x03, 0xE0,
+  0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0xBE, 0x00, 0xF8,
+  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0x80, 0x3E, 0x00, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0xBE, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
+  0x01, 0xFF, 0x00, 0xFF, 0xF8, 0x7F, 0xFF, 0x1F, 0xC0, 0xE7, 0xE0, 0x04,
+  0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x03, 0xFF,
+  0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xDF, 0x00, 0xFB,
+  0xF0, 0x1F, 0x3F, 0x03, 0xE3, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0x80,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x87,
+  0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
+  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0xFB, 0xFD,
+  0xFC, 0xF8, 0x00, 0xF8, 0x0F, 0xDF, 0x03, 0xF3, 0xE0, 0xFC, 0x7C, 0x3F,
+  0x0F, 0x8F, 0xC1, 0xF3, 0xF0, 0x3E, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0xC0,
+  0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x01, 0xF7, 0xF0,
+  0x3E, 0x7F, 0x07, 0xC7, 0xF0, 0xF8, 0x7F, 0x1F, 0x07, 0xF3, 0xE0, 0x7F,
+  0x7C, 0x07, 0xF0, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
+  0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0,
+  0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xFE, 0xE1, 0xDF,
+  0xFB, 0xCF, 0x7F, 0xE7, 0x39, 0xFF, 0x9C, 0xE7, 0xFE, 0x3F, 0x1F, 0xF8,
+  0xFC, 0x7F, 0xE3, 0xF1, 0xFF, 0x87, 0x87, 0xFE, 0x1E, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x07, 0xFF,
+  0x81, 0xFF, 0xE0, 0x7F, 0xFC, 0x1F, 0xFF, 0x07, 0xFF, 0xC1, 0xFF, 0xB8,
+  0x7F, 0xEE, 0x1F, 0xF9, 0xC7, 0xFE, 0x71, 0xFF, 0x8E, 0x7F, 0xE3, 0x9F,
+  0xF8, 0x77, 0xFE, 0x1D, 0xFF, 0x87, 0xFF, 0xE0, 0xFF, 0xF8, 0x3F, 0xFE,
+  0x07, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x1F,
+  0xFF, 0x83, 0xF0, 0xFC, 0x7E, 0x07, 0xE7, 0xC0, 0x3E, 0xF8, 0x03, 0xFF,
+  0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F,
+  0xF8, 0x01, 0xFF, 0x80, 0x3F, 0x7C, 0x03, 0xE7, 0xE0, 0x7E, 0x3F, 0x0F,
+  0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0xF0, 0xFF, 0xFC,
+  0xFF, 0xFE, 0xF8, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x3E, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF0, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xF0, 0xFC, 0x7E, 0x07,
+  0xE7, 0xC0, 0x3E, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0x7C,
+  0x03, 0xE7, 0xE0, 0x7E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00,
+  0x3F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x7C,
+  0xFF, 0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0xC3, 0xE1, 0xF8, 0xF8, 0x3E, 0x3E,
+  0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0xF8, 0xF8, 0x7C, 0x3F, 0xFE, 0x0F, 0xFE,
+  0x03, 0xFF, 0xE0, 0xF8, 0xFC, 0x3E, 0x1F, 0x0F, 0x87, 0xE3, 0xE0, 0xFC,
+  0xF8, 0x3F, 0x3E, 0x07, 0xEF, 0x81, 0xFB, 0xE0, 0x3F, 0x0F, 0xF8, 0x3F,
+  0xFE, 0x7F, 0xFE, 0x7C, 0x0E, 0xF8, 0x02, 0xF8, 0x00, 0xF8, 0x00, 0xFE,
+  0x00, 0xFF, 0xE0, 0x7F, 0xFC, 0x3F, 0xFE, 0x0F, 0xFF, 0x00, 0xFF, 0x00,
+  0x1F, 0x00, 0x1F, 0x80, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0xFF, 0xFC, 0x1F,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x1F,
+  0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E,
+  0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C,
+  0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8,
+  0x00, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF,
+  0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03,
+  0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF8, 0x3F, 0x7E,
+  0x3F, 0x1F, 0xFF, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x01, 0xFB, 0xE0,
+  0x0F, 0x9F, 0x00, 0x7C, 0xFC, 0x07, 0xE3, 0xE0, 0x3E, 0x1F, 0x01, 0xF0,
+  0xFC, 0x1F, 0x83, 0xE0, 0xF8, 0x1F, 0x0F, 0xC0, 0x7C, 0x7C, 0x03, 0xE3,
+  0xE0, 0x1F, 0xBF, 0x00, 0x7D, 0xF0, 0x03, 0xEF, 0x80, 0x1F, 0xFC, 0x00,
+  0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8,
+  0x00, 0xF8, 0x1F, 0x81, 0xFF, 0x81, 0xF8, 0x1F, 0x7C, 0x1F, 0x83, 0xE7,
+  0xC1, 0xF8, 0x3E, 0x7C, 0x1F, 0x83, 0xE7, 0xC3, 0x9C, 0x3E, 0x3E, 0x39,
+  0xC7, 0xE3, 0xE3, 0x9C, 0x7C, 0x3E, 0x39, 0xC7, 0xC3, 0xE7, 0x0E, 0x7C,
+  0x3F, 0x70, 0xEF, 0xC1, 0xF7, 0x0E, 0xF8, 0x1F, 0x70, 0xEF, 0x81, 0xFF,
+  0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0xFE, 0x07, 0xF0, 0x0F, 0xE0, 0x7F,
+  0x00, 0xFE, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x7C, 0x03, 0xF0, 0xFC,
+  0x03, 0xF7, 0xE0, 0x7E, 0x3F, 0x0F, 0xC3, 0xF9, 0xFC, 0x1F, 0x9F, 0x80,
+  0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF,
+  0x01, 0xF9, 0xF8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x07, 0xEF, 0xC0,
+  0x3F, 0xFC, 0x01, 0xFB, 0xF0, 0x1F, 0x8F, 0xC1, 0xF8, 0x7E, 0x1F, 0xC1,
+  0xF8, 0xFC, 0x07, 0xEF, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0xE0, 0x03, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x07, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x03,
+  0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00,
+  0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0xE0, 0x1C,
+  0x07, 0x01, 0xC0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1C, 0x07, 0x00, 0xE0,
+  0x38, 0x0E, 0x01, 0xC0, 0x70, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xFE, 0x03,
+  0xEF, 0x83, 0xE3, 0xE3, 0xC0, 0x7B, 0xC0, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x1F, 0xE0, 0xFF, 0xF1, 0xFF,
+  0xF2, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xC7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xE0, 0xFF, 0xC3, 0xFF, 0xFF, 0xEF, 0xF7, 0xCF, 0x8F, 0x80,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0xF0, 0xFB, 0xFC, 0xFF, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x3E,
+  0xFF, 0xFE, 0xFB, 0xFC, 0xF9, 0xF0, 0x07, 0xF0, 0xFF, 0xCF, 0xFE, 0xFC,
+  0x1F, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0x00,
+  0xFC, 0x13, 0xFF, 0x8F, 0xFC, 0x1F, 0xC0, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0F, 0x1F, 0x3F, 0xDF, 0x7F,
+  0xFF, 0x7C, 0x3F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3F, 0x7F, 0xFF, 0x3F, 0xDF, 0x0F,
+  0x9F, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x1E, 0xF8,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
+  0x06, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xF8, 0x07, 0xE3, 0xFC, 0xFF, 0x9F,
+  0x03, 0xE0, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xE7, 0xC0, 0xF8, 0x1F, 0x03,
+  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
+  0x0F, 0x1F, 0x3F, 0xDF, 0x7F, 0xFF, 0x7C, 0x3F, 0xFC, 0x3F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3F,
+  0x7F, 0xFF, 0x3F, 0xDF, 0x0F, 0x9F, 0x00, 0x1F, 0x00, 0x3E, 0x20, 0x7E,
+  0x3F, 0xFC, 0x3F, 0xF8, 0x1F, 0xE0, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x3C, 0x7D, 0xFE, 0xFF, 0xFD, 0xF8,
+  0xFF, 0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F,
+  0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xE0, 0xFF, 0xFF,
+  0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F,
+  0xFE, 0xFC, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x3E, 0xF8, 0x7C, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB,
+  0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xFB, 0xE0, 0xF9,
+  0xF0, 0xF9, 0xF8, 0xF8, 0xFC, 0xF8, 0x7E, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8,
+  0xF0, 0x7C, 0x7D, 0xFC, 0x7F, 0xBF, 0xFF, 0x7F, 0xDF, 0x8F, 0xE3, 0xFF,
+  0xC3, 0xF0, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xF8, 0x3F, 0xF0, 0x7C, 0x1F,
+  0xF8, 0x3E, 0x0F, 0xFC, 0x1F, 0x07, 0xFE, 0x0F, 0x83, 0xFF, 0x07, 0xC1,
+  0xFF, 0x83, 0xE0, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xF8, 0x3E, 0xF8, 0xF1,
+  0xF7, 0xFB, 0xFF, 0xF7, 0xE3, 0xFF, 0xC3, 0xFF, 0x07, 0xFE, 0x0F, 0xFC,
+  0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07,
+  0xFE, 0x0F, 0x80, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC,
+  0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC,
+  0x3F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0xF8, 0xF0, 0xFB,
+  0xFC, 0xFF, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x3E, 0xFF, 0xFE, 0xFB,
+  0xFC, 0xF9, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0x0F, 0x1F, 0x3F, 0xDF, 0x7F, 0xFF, 0x7C, 0x3F, 0xFC,
+  0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC,
+  0x3F, 0x7C, 0x3F, 0x7F, 0xFF, 0x3F, 0xDF, 0x0F, 0x9F, 0x00, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xF9, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x1F, 0xC1, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
+  0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x00, 0x1F, 0xC3, 0xFF, 0xBF, 0xFD, 0xF0,
+  0x6F, 0x00, 0x78, 0x03, 0xFC, 0x0F, 0xFC, 0x1F, 0xF0, 0x0F, 0xC0, 0x1F,
+  0x81, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x3E, 0x03, 0xE0, 0x3E, 0x03,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03,
+  0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0xE1, 0xFE, 0x0F, 0xE0,
+  0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE,
+  0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE1, 0xFF, 0xE3, 0xF7, 0xFF,
+  0xEF, 0xF7, 0xC7, 0x8F, 0x80, 0xFC, 0x1F, 0xBE, 0x0F, 0x9F, 0x07, 0xCF,
+  0xC7, 0xE3, 0xE3, 0xE1, 0xFB, 0xF0, 0x7D, 0xF0, 0x3E, 0xF8, 0x1F, 0xFC,
+  0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x0F,
+  0x80, 0xF8, 0x7C, 0x3F, 0xF8, 0xF8, 0xFD, 0xF1, 0xF1, 0xF3, 0xE3, 0xE3,
+  0xE7, 0xCF, 0xE7, 0xCF, 0xDD, 0xDF, 0x8F, 0xBB, 0xBE, 0x1F, 0x77, 0x7C,
+  0x3F, 0xEF, 0xF8, 0x7F, 0x8F, 0xF0, 0x7F, 0x1F, 0xC0, 0xFE, 0x3F, 0x81,
+  0xFC, 0x7F, 0x03, 0xF0, 0x7E, 0x03, 0xE0, 0xF8, 0x00, 0xFE, 0x3F, 0xBF,
+  0x1F, 0x8F, 0xDF, 0x83, 0xFF, 0x81, 0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0xC0,
+  0x07, 0xE0, 0x07, 0xF0, 0x07, 0xFC, 0x07, 0xFF, 0x03, 0xFF, 0x83, 0xF7,
+  0xE3, 0xF1, 0xFB, 0xF8, 0xFE, 0xFC, 0x1F, 0xBE, 0x0F, 0x9F, 0x07, 0xCF,
+  0xC7, 0xE3, 0xE3, 0xE1, 0xF9, 0xF0, 0x7D, 0xF8, 0x3F, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x03, 0xE0, 0x0F, 0xF0, 0x07, 0xF0, 0x03,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xF0, 0x3F, 0x03, 0xF0,
+  0x3F, 0x83, 0xF8, 0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xFC, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x7F, 0x0F, 0xF0, 0xF8, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x0F, 0xE0, 0xFC, 0x0F, 0xE0,
+  0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8,
+  0x0F, 0xF0, 0x7F, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x0F, 0xE0, 0xFF, 0x01, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x80, 0x7F, 0x03, 0xF0,
+  0x7F, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01,
+  0xF0, 0xFF, 0x0F, 0xE0, 0xFC, 0x00, 0x1F, 0x00, 0xBF, 0xE1, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xE8, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x7F, 0x0F, 0xFC, 0xFF,
+  0xEF, 0xF1, 0xFD, 0x87, 0xCC, 0x3E, 0x61, 0xF3, 0x0F, 0x98, 0x7C, 0xC1,
+  0xF6, 0x0F, 0xF1, 0x3F, 0xF8, 0xFF, 0xC1, 0xFC, 0x03, 0x00, 0x18, 0x00,
+  0xC0, 0x06, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0xFC, 0x11, 0xF0,
+  0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x01, 0xFF, 0xF3, 0xFF, 0xE7,
+  0xFF, 0xC1, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x20, 0x0C, 0xE0, 0x3B, 0xEE, 0xFB, 0xFF,
+  0xE3, 0xFF, 0x83, 0x8E, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0xE0,
+  0xFF, 0xE3, 0xFF, 0xEF, 0xBB, 0xFE, 0x03, 0x88, 0x02, 0x00, 0xFC, 0x07,
+  0xEF, 0xC1, 0xF8, 0xFC, 0x7E, 0x1F, 0x9F, 0xC1, 0xFB, 0xF0, 0x1F, 0xFC,
+  0x01, 0xFF, 0x83, 0xFF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFF, 0xF8, 0x07, 0xC0,
+  0x00, 0xF8, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xC1, 0xFF, 0x1F, 0xF8,
+  0xF0, 0x47, 0x80, 0x3E, 0x00, 0xFE, 0x03, 0xF8, 0x7F, 0xF7, 0xDF, 0xFC,
+  0x3F, 0xE0, 0xFF, 0x87, 0xFE, 0x3D, 0xFF, 0xC7, 0xF8, 0x0F, 0xE0, 0x0F,
+  0x80, 0x3C, 0xC1, 0xE7, 0xFF, 0x3F, 0xF0, 0xFE, 0x00, 0xE7, 0xE7, 0xE7,
+  0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x1E, 0x07, 0x83, 0x80, 0x1C, 0x30, 0xFC,
+  0xC6, 0x3F, 0xC6, 0x67, 0x84, 0x6C, 0xF0, 0x03, 0xCE, 0x00, 0x3C, 0xE0,
+  0x03, 0xCE, 0x00, 0x3C, 0xE0, 0x03, 0xCF, 0x00, 0x36, 0x78, 0x46, 0x63,
+  0xFC, 0x63, 0x1F, 0xCC, 0x38, 0x01, 0xC1, 0xE0, 0x78, 0x07, 0xFE, 0x00,
+  0x1F, 0x80, 0x3F, 0x0F, 0xF9, 0x07, 0x80, 0x73, 0xFE, 0xFF, 0xFC, 0x3F,
+  0x0F, 0xE1, 0xEF, 0xFC, 0xF3, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x02, 0x04, 0x18, 0x31, 0xE3, 0xCF, 0x1E, 0xF9, 0xF3, 0xC7, 0x8F, 0x1C,
+  0x3E, 0x7C, 0x3E, 0x78, 0x78, 0xF0, 0x60, 0xC0, 0x81, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x1E,
+  0x07, 0x83, 0x80, 0x1C, 0x33, 0xF8, 0xC6, 0x3F, 0xE6, 0x63, 0x8E, 0x6C,
+  0x38, 0xE3, 0xC3, 0xFE, 0x3C, 0x3F, 0x83, 0xC3, 0xB8, 0x3C, 0x39, 0xC3,
+  0xC3, 0x9C, 0x36, 0x38, 0xE6, 0x63, 0x8E, 0x63, 0x38, 0xEC, 0x38, 0x01,
+  0xC1, 0xE0, 0x78, 0x07, 0xFE, 0x00, 0x1F, 0x80, 0xFF, 0xFF, 0x3E, 0x3F,
+  0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x8E, 0xFE, 0x3E, 0x00, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7E, 0x7F,
+  0xA0, 0xE0, 0x70, 0x38, 0x38, 0x78, 0x78, 0x78, 0x7F, 0xFF, 0xE0, 0xFE,
+  0x7F, 0xE0, 0xE0, 0x73, 0xF1, 0xF8, 0x1E, 0x07, 0x87, 0xFF, 0xBF, 0x80,
+  0x1E, 0x78, 0xE3, 0x8E, 0x00, 0xF8, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x9F,
+  0x07, 0xCF, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x7C, 0xF8, 0x3E,
+  0x7C, 0x1F, 0x3E, 0x0F, 0x9F, 0x8F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+  0x3F, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
+  0x80, 0x00, 0x0F, 0xFC, 0xFF, 0xF7, 0xF9, 0xFF, 0xE7, 0xFF, 0x9F, 0xFE,
+  0x7F, 0xF9, 0xFF, 0xE7, 0x7F, 0x9C, 0xFE, 0x70, 0xF9, 0xC0, 0xE7, 0x03,
+  0x9C, 0x0E, 0x70, 0x39, 0xC0, 0xE7, 0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0,
+  0xE7, 0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x18,
+  0x30, 0xFF, 0xF8, 0x7C, 0x7E, 0x37, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x7F, 0xFF, 0xE0, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x07,
+  0xFE, 0x7F, 0xE7, 0xFE, 0x81, 0x03, 0x06, 0x0F, 0x1E, 0x1E, 0x3C, 0x3E,
+  0x7C, 0x38, 0xF1, 0xE3, 0xCF, 0x9F, 0x78, 0xF3, 0xC7, 0x8C, 0x18, 0x20,
+  0x40, 0x7C, 0x00, 0xF0, 0xFC, 0x00, 0xE0, 0xDC, 0x01, 0xE0, 0x1C, 0x03,
+  0xC0, 0x1C, 0x03, 0x80, 0x1C, 0x07, 0x80, 0x1C, 0x07, 0x00, 0x1C, 0x0F,
+  0x00, 0x1C, 0x0E, 0x00, 0xFF, 0x9E, 0x3C, 0xFF, 0xBC, 0x3C, 0x00, 0x38,
+  0x7C, 0x00, 0x78, 0xDC, 0x00, 0x71, 0xDC, 0x00, 0xF1, 0x9C, 0x00, 0xE3,
+  0x1C, 0x01, 0xE3, 0xFF, 0x03, 0xC3, 0xFF, 0x03, 0x80, 0x1C, 0x07, 0x80,
+  0x1C, 0x7C, 0x00, 0xF0, 0xFC, 0x00, 0xE0, 0xDC, 0x01, 0xE0, 0x1C, 0x03,
+  0xC0, 0x1C, 0x03, 0x80, 0x1C, 0x07, 0x80, 0x1C, 0x07, 0x00, 0x1C, 0x0F,
+  0x00, 0x1C, 0x0E, 0x00, 0xFF, 0x9E, 0xFC, 0xFF, 0xBD, 0xFE, 0x00, 0x39,
+  0x07, 0x00, 0x78, 0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0,
+  0x3C, 0x01, 0xE0, 0x78, 0x03, 0xC0, 0xF0, 0x03, 0x81, 0xFF, 0x07, 0x81,
+  0xFF, 0xFE, 0x00, 0x78, 0x7F, 0xC0, 0x38, 0x20, 0xE0, 0x3C, 0x00, 0x70,
+  0x3C, 0x03, 0xF0, 0x1C, 0x01, 0xF8, 0x1E, 0x00, 0x1E, 0x0E, 0x00, 0x07,
+  0x0F, 0x00, 0x87, 0x87, 0x00, 0x7F, 0x87, 0x8F, 0x3F, 0x87, 0x87, 0x80,
+  0x03, 0x87, 0xC0, 0x03, 0xC6, 0xE0, 0x01, 0xC7, 0x70, 0x01, 0xE3, 0x38,
+  0x00, 0xE3, 0x1C, 0x00, 0xF1, 0xFF, 0x80, 0xF0, 0xFF, 0xC0, 0x70, 0x03,
+  0x80, 0x78, 0x01, 0xC0, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0xF8, 0x1F, 0x03, 0xF0, 0x7E, 0x07,
+  0xC0, 0xFC, 0x0F, 0x80, 0xF8, 0x0F, 0xC3, 0x7F, 0xF7, 0xFF, 0x1F, 0xF0,
+  0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
+  0x1F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xBE, 0x00, 0x7D, 0xF0, 0x07, 0xEF,
+  0xC0, 0x3E, 0x3E, 0x01, 0xF1, 0xF0, 0x1F, 0x87, 0xC0, 0xF8, 0x3E, 0x0F,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x01, 0xF9, 0xF0, 0x07,
+  0xCF, 0x80, 0x3E, 0xFC, 0x01, 0xF8, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0,
+  0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F,
+  0xBE, 0x00, 0x7D, 0xF0, 0x07, 0xEF, 0xC0, 0x3E, 0x3E, 0x01, 0xF1, 0xF0,
+  0x1F, 0x87, 0xC0, 0xF8, 0x3E, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF,
+  0xFE, 0x3F, 0x01, 0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E, 0xFC, 0x01, 0xF8,
+  0x00, 0xF8, 0x00, 0x0E, 0xE0, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
+  0x1F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xBE, 0x00, 0x7D, 0xF0, 0x07, 0xEF,
+  0xC0, 0x3E, 0x3E, 0x01, 0xF1, 0xF0, 0x1F, 0x87, 0xC0, 0xF8, 0x3E, 0x0F,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x01, 0xF9, 0xF0, 0x07,
+  0xCF, 0x80, 0x3E, 0xFC, 0x01, 0xF8, 0x01, 0xC6, 0x00, 0x1F, 0x30, 0x00,
+  0xCF, 0x80, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0F,
+  0xFE, 0x00, 0x7D, 0xF0, 0x03, 0xEF, 0x80, 0x3F, 0x7E, 0x01, 0xF1, 0xF0,
+  0x0F, 0x8F, 0x80, 0xFC, 0x3E, 0x07, 0xC1, 0xF0, 0x7F, 0xFF, 0xC3, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xF1, 0xF8, 0x0F, 0xCF, 0x80, 0x3E, 0x7C, 0x01, 0xF7,
+  0xE0, 0x0F, 0xC0, 0x01, 0xDC, 0x00, 0x0E, 0xE0, 0x00, 0x77, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xC0,
+  0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xBE, 0x00, 0x7D,
+  0xF0, 0x07, 0xEF, 0xC0, 0x3E, 0x3E, 0x01, 0xF1, 0xF0, 0x1F, 0x87, 0xC0,
+  0xF8, 0x3E, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x01,
+  0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E, 0xFC, 0x01, 0xF8, 0x00, 0x70, 0x00,
+  0x07, 0xC0, 0x00, 0x63, 0x00, 0x03, 0x18, 0x00, 0x18, 0xC0, 0x00, 0xFC,
+  0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
+  0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x7D, 0xF0, 0x07, 0xEF, 0xC0, 0x3E, 0x3E,
+  0x01, 0xF1, 0xF0, 0x1F, 0x8F, 0xC0, 0xF8, 0x3E, 0x0F, 0xFF, 0xF0, 0x7F,
+  0xFF, 0xC3, 0xFF, 0xFE, 0x3F, 0x01, 0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E,
+  0xFC, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+  0xFF, 0x80, 0xFB, 0xE0, 0x00, 0x3F, 0x7C, 0x00, 0x07, 0xCF, 0x80, 0x01,
+  0xF9, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x07, 0xC7, 0xFF, 0xC1, 0xF8, 0xFF,
+  0xF8, 0x3E, 0x1F, 0xFF, 0x0F, 0xC3, 0xE0, 0x01, 0xFF, 0xFC, 0x00, 0x3F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xF0, 0x3E, 0x00, 0x7E, 0x07, 0xC0,
+  0x0F, 0x80, 0xFF, 0xFD, 0xF0, 0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x01,
+  0xFE, 0x03, 0xFF, 0xC7, 0xFF, 0xE7, 0xF0, 0x77, 0xE0, 0x0B, 0xE0, 0x03,
+  0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0x3F, 0x03, 0x8F,
+  0xFF, 0xC3, 0xFF, 0xE0, 0x3F, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x60,
+  0x03, 0xF0, 0x01, 0xF0, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
+  0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xF8, 0x03, 0xE0,
+  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03,
+  0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
+  0xF8, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x7F,
+  0x83, 0x87, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xBF,
+  0xFE, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
+  0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xF8, 0x03, 0xE0,
+  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x70, 0x70, 0x70, 0x00, 0x07, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3,
+  0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x39,
+  0xCE, 0x00, 0x03, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB,
+  0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xF8, 0x1F, 0x07, 0x71, 0xC7, 0x00, 0x00,
+  0x00, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0,
+  0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E,
+  0x07, 0xC0, 0xF8, 0x1F, 0x00, 0xEF, 0xDF, 0xB8, 0x00, 0x0F, 0x9F, 0x3E,
+  0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF,
+  0x9F, 0x3E, 0x7C, 0x3F, 0xFC, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x7C,
+  0x1F, 0xC3, 0xE0, 0x3F, 0x1F, 0x00, 0xF8, 0xF8, 0x07, 0xC7, 0xC0, 0x1F,
+  0x3E, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xF3, 0xE0,
+  0x0F, 0x9F, 0x00, 0xF8, 0xF8, 0x07, 0xC7, 0xC0, 0x7E, 0x3E, 0x0F, 0xE1,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03, 0x8C, 0x01, 0xF3,
+  0x00, 0x67, 0xC0, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F,
+  0xF8, 0x1F, 0xFE, 0x07, 0xFF, 0xC1, 0xFF, 0xF0, 0x7F, 0xFC, 0x1F, 0xFB,
+  0x87, 0xFE, 0xE1, 0xFF, 0x9C, 0x7F, 0xE7, 0x1F, 0xF8, 0xE7, 0xFE, 0x39,
+  0xFF, 0x87, 0x7F, 0xE1, 0xDF, 0xF8, 0x7F, 0xFE, 0x0F, 0xFF, 0x83, 0xFF,
+  0xE0, 0x7F, 0xF8, 0x1F, 0xFE, 0x03, 0xF0, 0x01, 0xC0, 0x00, 0x0E, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xFF,
+  0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xE0, 0x7E, 0x7C, 0x03, 0xEF, 0x80,
+  0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
+  0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xF7, 0xC0, 0x3E, 0x7E, 0x07, 0xE3,
+  0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x38,
+  0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xC0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xE0, 0x7E, 0x7C,
+  0x03, 0xEF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF,
+  0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xF7, 0xC0, 0x3E,
+  0x7E, 0x07, 0xE3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFC,
+  0x00, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7,
+  0xE0, 0x7E, 0x7C, 0x03, 0xEF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x1F,
+  0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03,
+  0xF7, 0xC0, 0x3E, 0x7E, 0x07, 0xE3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF,
+  0xF0, 0x03, 0xFC, 0x00, 0x03, 0x86, 0x00, 0x7E, 0xE0, 0x07, 0x7E, 0x00,
+  0x63, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xF0,
+  0x1F, 0xFF, 0x83, 0xF0, 0xFC, 0x7E, 0x07, 0xE7, 0xC0, 0x3E, 0xF8, 0x03,
+  0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0x7C, 0x03, 0xE7, 0xE0, 0x7E, 0x3F,
+  0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0x9C, 0x00,
+  0x39, 0xC0, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+  0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xE0, 0x7E, 0x7C, 0x03,
+  0xEF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xF7, 0xC0, 0x3E, 0x7E,
+  0x07, 0xE3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFC, 0x00,
+  0x20, 0x04, 0x70, 0x0E, 0xF8, 0x1F, 0x7C, 0x3E, 0x3E, 0x7C, 0x1F, 0xF8,
+  0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3E, 0x7C,
+  0x7C, 0x3E, 0xF8, 0x1F, 0x70, 0x0E, 0x20, 0x04, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x60, 0x7F, 0xFB, 0x83, 0xFF, 0xFC, 0x1F, 0x87, 0xE0, 0xFC, 0x0F,
+  0xC3, 0xE0, 0x3F, 0x1F, 0x01, 0xFE, 0x7C, 0x0E, 0xF9, 0xF0, 0x73, 0xE7,
+  0xC3, 0x8F, 0x9F, 0x1C, 0x3E, 0x7C, 0xE0, 0xF9, 0xF7, 0x03, 0xE7, 0xF8,
+  0x1F, 0x0F, 0xC0, 0x7C, 0x3F, 0x03, 0xF0, 0xFE, 0x1F, 0x83, 0xFF, 0xFC,
+  0x1D, 0xFF, 0xE0, 0xE1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80,
+  0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE,
+  0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB, 0xF1, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8,
+  0x07, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07,
+  0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB,
+  0xF1, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x03,
+  0xB8, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80,
+  0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE,
+  0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB, 0xF1, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8,
+  0x07, 0xF0, 0x00, 0x0E, 0x38, 0x07, 0x1C, 0x03, 0x8E, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07,
+  0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0xC1, 0xFB,
+  0xF1, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x38, 0x00,
+  0x03, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+  0xFD, 0xF8, 0x0F, 0xC7, 0xE0, 0xFC, 0x3F, 0x0F, 0xE0, 0xFC, 0x7E, 0x03,
+  0xF7, 0xE0, 0x1F, 0xFF, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0,
+  0x00, 0x3F, 0x80, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+  0xF0, 0xFF, 0xFC, 0xFF, 0xFE, 0xF8, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3E, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF,
+  0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x7F,
+  0xF8, 0xFC, 0x7C, 0xF8, 0x3C, 0xF8, 0x7C, 0xF8, 0xFC, 0xF9, 0xE0, 0xFB,
+  0xC0, 0xFB, 0xC0, 0xFB, 0xE0, 0xFB, 0xF8, 0xF9, 0xFE, 0xF8, 0x7E, 0xF8,
+  0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFA, 0x3F, 0xFB, 0xFE, 0xFB, 0xFE, 0xF9,
+  0xF8, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF8, 0xFF, 0xF9, 0x01, 0xF0, 0x01, 0xF0,
+  0x03, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x7F, 0xE1,
+  0xFF, 0xFF, 0xF7, 0xFB, 0xE7, 0xC7, 0xC0, 0x00, 0x78, 0x01, 0xE0, 0x03,
+  0x80, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF8,
+  0xFF, 0xF9, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x3F, 0xF0, 0x7F, 0xE1, 0xFF, 0xFF, 0xF7, 0xFB, 0xE7, 0xC7,
+  0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x1F, 0x80, 0x73, 0x81, 0xC3, 0x80, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF8, 0xFF, 0xF9, 0x01, 0xF0, 0x01, 0xF0,
+  0x03, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x7F, 0xE1,
+  0xFF, 0xFF, 0xF7, 0xFB, 0xE7, 0xC7, 0xC0, 0x06, 0x30, 0x1E, 0x60, 0x36,
+  0xC0, 0x67, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF8,
+  0xFF, 0xF9, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x3F, 0xF0, 0x7F, 0xE1, 0xFF, 0xFF, 0xF7, 0xFB, 0xE7, 0xC7,
+  0xC0, 0x0E, 0x70, 0x1C, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0x80, 0xF8, 0x00, 0xF8, 0x01, 0xF1,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xF8, 0x3F, 0xF0, 0xFF, 0xFF,
+  0xFB, 0xFD, 0xF3, 0xE3, 0xE0, 0x03, 0xC0, 0x0F, 0xC0, 0x39, 0xC0, 0x61,
+  0x80, 0xC3, 0x01, 0xCE, 0x01, 0xF8, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0xC1,
+  0xFF, 0xE3, 0xFF, 0xE4, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x8F, 0xFF, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xC1, 0xFF, 0x87, 0xFF, 0xFF, 0xDF, 0xEF,
+  0x9F, 0x1F, 0x1F, 0xE1, 0xF8, 0x1F, 0xFD, 0xFF, 0x87, 0xFF, 0xFF, 0xF1,
+  0x01, 0xFC, 0x3E, 0x00, 0x3F, 0x07, 0x80, 0x0F, 0x81, 0xF1, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x0F, 0x83,
+  0xF0, 0x03, 0xE1, 0xFE, 0x06, 0xFF, 0xEF, 0xFF, 0x9F, 0xF1, 0xFF, 0xE1,
+  0xF0, 0x1F, 0xE0, 0x07, 0xF0, 0xFF, 0xCF, 0xFE, 0xFC, 0x1F, 0xC0, 0x7C,
+  0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0x00, 0xFC, 0x13, 0xFF,
+  0x8F, 0xFC, 0x1F, 0xC0, 0x30, 0x00, 0xC0, 0x06, 0x03, 0xF0, 0x1F, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x1E,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00,
+  0x7E, 0x06, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xF8, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x1E, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x06, 0x3F, 0xFE,
+  0x1F, 0xFE, 0x07, 0xF8, 0x01, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0x38,
+  0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x7C, 0x3E, 0xFC, 0x1E, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x06, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xF8,
+  0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x1E, 0xF8, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x06,
+  0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xF8, 0xF0, 0x78, 0x38, 0x1C, 0x0E, 0x00,
+  0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x1E, 0x1C, 0x38, 0x70, 0x00, 0x00, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0x0E, 0x03, 0xE0, 0xEE, 0x18, 0xC6, 0x0C, 0x00, 0x00, 0x00,
+  0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8,
+  0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x00, 0xEF, 0xDF, 0xB8,
+  0x00, 0x00, 0x1F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C,
+  0xF9, 0xF3, 0xE7, 0xC0, 0x0F, 0x04, 0x07, 0xBC, 0x03, 0xF0, 0x0F, 0xE0,
+  0x3E, 0xE0, 0x30, 0xF0, 0x00, 0x78, 0x0F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE,
+  0x7C, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xFC, 0x3F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x0E, 0x30,
+  0x1E, 0x60, 0x64, 0xC0, 0xCF, 0x01, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  0x78, 0xFB, 0xFD, 0xFF, 0xFB, 0xF1, 0xFF, 0xE1, 0xFF, 0x83, 0xFF, 0x07,
+  0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF,
+  0x83, 0xFF, 0x07, 0xC0, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x7C, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0,
+  0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x3F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F,
+  0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x03, 0xC0, 0x07, 0xE0,
+  0x07, 0xE0, 0x0E, 0x70, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3E, 0x3F, 0xFC,
+  0x1F, 0xF8, 0x07, 0xE0, 0x0E, 0x18, 0x0F, 0x18, 0x1D, 0xB8, 0x18, 0xF0,
+  0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC,
+  0x7C, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0,
+  0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x00, 0x02, 0x07, 0xE7, 0x1F, 0xFE, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x7F,
+  0xF8, 0xFF, 0xF8, 0xDF, 0xF9, 0x9F, 0xFB, 0x1F, 0xFF, 0x1F, 0xFE, 0x3F,
+  0x7C, 0x3E, 0x7F, 0xFC, 0x7F, 0xF8, 0xEF, 0xE0, 0x40, 0x00, 0x3C, 0x00,
+  0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07,
+  0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0xFF, 0xF1, 0xFB, 0xFF, 0xF7,
+  0xFB, 0xE3, 0xC7, 0xC0, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0,
+  0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F,
+  0xF0, 0xFF, 0xF1, 0xFB, 0xFF, 0xF7, 0xFB, 0xE3, 0xC7, 0xC0, 0x03, 0x80,
+  0x0F, 0x80, 0x3B, 0x80, 0x63, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07,
+  0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0xFF, 0xF1, 0xFB, 0xFF, 0xF7,
+  0xFB, 0xE3, 0xC7, 0xC0, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0,
+  0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x7F,
+  0xF8, 0xFD, 0xFF, 0xFB, 0xFD, 0xF1, 0xE3, 0xE0, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
+  0x3F, 0x7C, 0x1F, 0x3E, 0x0F, 0x9F, 0x8F, 0xC7, 0xC7, 0xC3, 0xF3, 0xE0,
+  0xFB, 0xF0, 0x7F, 0xF0, 0x1F, 0xF8, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFE,
+  0x00, 0xFE, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x07,
+  0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF0, 0xFB, 0xFC,
+  0xFF, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x3E, 0xFF, 0xFE, 0xFB, 0xFC,
+  0xF9, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0x07, 0x38, 0x03, 0x9C, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x7E, 0xF8, 0x3E, 0x7C, 0x1F, 0x3F, 0x1F, 0x8F,
+  0x8F, 0x87, 0xE7, 0xC1, 0xF7, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF0,
+  0x0F, 0xF8, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F,
+  0x00, 0x1F, 0x80, 0x0F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans_Bold14pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
+  {     1,   5,  20,  12,    4,  -19 },   // 0x21 '!'
+  {    14,   9,   7,  14,    2,  -19 },   // 0x22 '"'
+  {    22,  19,  20,  23,    2,  -19 },   // 0x23 '#'
+  {    70,  14,  25,  19,    3,  -20 },   // 0x24 '$'
+  {   114,  25,  20,  27,    1,  -19 },   // 0x25 '%'
+  {   177,  21,  20,  24,    1,  -19 },   // 0x26 '&'
+  {   230,   3,   7,   8,    2,  -19 },   // 0x27 '''
+  {   233,   7,  24,  12,    2,  -20 },   // 0x28 '('
+  {   254,   7,  24,  12,    3,  -20 },   // 0x29 ')'
+  {   275,  12,  13,  14,    1,  -19 },   // 0x2A '*'
+  {   295,  17,  17,  23,    3,  -16 },   // 0x2B '+'
+  {   332,   6,   9,  10,    2,   -4 },   // 0x2C ','
+  {   339,   8,   4,  11,    1,   -9 },   // 0x2D '-'
+  {   343,   5,   5,  10,    3,   -4 },   // 0x2E '.'
+  {   347,  10,  22,  10,    0,  -19 },   // 0x2F '/'
+  {   375,  16,  20,  19,    1,  -19 },   // 0x30 '0'
+  {   415,  14,  20,  19,    3,  -19 },   // 0x31 '1'
+  {   450,  14,  20,  19,    2,  -19 },   // 0x32 '2'
+  {   485,  15,  20,  19,    2,  -19 },   // 0x33 '3'
+  {   523,  17,  20,  19,    1,  -19 },   // 0x34 '4'
+  {   566,  15,  20,  19,    2,  -19 },   // 0x35 '5'
+  {   604,  16,  20,  19,    1,  -19 },   // 0x36 '6'
+  {   644,  15,  20,  19,    2,  -19 },   // 0x37 '7'
+  {   682,  16,  20,  19,    1,  -19 },   // 0x38 '8'
+  {   722,  16,  20,  19,    1,  -19 },   // 0x39 '9'
+  {   762,   5,  15,  11,    3,  -14 },   // 0x3A ':'
+  {   772,   6,  19,  11,    2,  -14 },   // 0x3B ';'
+  {   787,  17,  15,  23,    3,  -15 },   // 0x3C '<'
+  {   819,  17,   9,  23,    3,  -12 },   // 0x3D '='
+  {   839,  17,  15,  23,    3,  -15 },   // 0x3E '>'
+  {   871,  12,  20,  16,    2,  -19 },   // 0x3F '?'
+  {   901,  23,  24,  27,    2,  -19 },   // 0x40 '@'
+  {   970,  21,  20,  21,    0,  -19 },   // 0x41 'A'
+  {  1023,  16,  20,  21,    2,  -19 },   // 0x42 'B'
+  {  1063,  17,  20,  20,    1,  -19 },   // 0x43 'C'
+  {  1106,  19,  20,  22,    2,  -19 },   // 0x44 'D'
+  {  1154,  14,  20,  18,    2,  -19 },   // 0x45 'E'
+  {  1189,  14,  20,  18,    2,  -19 },   // 0x46 'F'
+  {  1224,  19,  20,  22,    1,  -19 },   // 0x47 'G'
+  {  1272,  18,  20,  23,    2,  -19 },   // 0x48 'H'
+  {  1317,   5,  20,  10,    2,  -19 },   // 0x49 'I'
+  {  1330,   9,  25,  10,   -2,  -19 },   // 0x4A 'J'
+  {  1359,  19,  20,  21,    2,  -19 },   // 0x4B 'K'
+  {  1407,  14,  20,  17,    2,  -19 },   // 0x4C 'L'
+  {  1442,  22,  20,  27,    2,  -19 },   // 0x4D 'M'
+  {  1497,  18,  20,  23,    2,  -19 },   // 0x4E 'N'
+  {  1542,  20,  20,  23,    1,  -19 },   // 0x4F 'O'
+  {  1592,  16,  20,  20,    2,  -19 },   // 0x50 'P'
+  {  1632,  20,  24,  23,    1,  -19 },   // 0x51 'Q'
+  {  1692,  18,  20,  21,    2,  -19 },   // 0x52 'R'
+  {  1737,  16,  20,  19,    2,  -19 },   // 0x53 'S'
+  {  1777,  19,  20,  18,    0,  -19 },   // 0x54 'T'
+  {  1825,  17,  20,  22,    2,  -19 },   // 0x55 'U'
+  {  1868,  21,  20,  21,    0,  -19 },   // 0x56 'V'
+  {  1921,  28,  20,  30,    1,  -19 },   // 0x57 'W'
+  {  1991,  20,  20,  21,    1,  -19 },   // 0x58 'X'
+  {  2041,  21,  20,  20,   -1,  -19 },   // 0x59 'Y'
+  {  2094,  17,  20,  20,    1,  -19 },   // 0x5A 'Z'
+  {  2137,   8,  24,  12,    2,  -20 },   // 0x5B '['
+  {  2161,  10,  22,  10,    0,  -19 },   // 0x5C '\'
+  {  2189,   8,  24,  12,    2,  -20 },   // 0x5D ']'
+  {  2213,  17,   7,  23,    3,  -19 },   // 0x5E '^'
+  {  2228,  14,   3,  14,    0,    4 },   // 0x5F '_'
+  {  2234,   7,   5,  14,    1,  -21 },   // 0x60 '`'
+  {  2239,  15,  15,  18,    1,  -14 },   // 0x61 'a'
+  {  2268,  16,  21,  19,    2,  -20 },   // 0x62 'b'
+  {  2310,  13,  15,  16,    1,  -14 },   // 0x63 'c'
+  {  2335,  16,  21,  19,    1,  -20 },   // 0x64 'd'
+  {  2377,  16,  15,  18,    1,  -14 },   // 0x65 'e'
+  {  2407,  11,  21,  12,    1,  -20 },   // 0x66 'f'
+  {  2436,  16,  21,  19,    1,  -14 },   // 0x67 'g'
+  {  2478,  15,  21,  19,    2,  -20 },   // 0x68 'h'
+  {  2518,   5,  21,   9,    2,  -20 },   // 0x69 'i'
+  {  2532,   8,  27,   9,   -1,  -20 },   // 0x6A 'j'
+  {  2559,  16,  21,  18,    2,  -20 },   // 0x6B 'k'
+  {  2601,   5,  21,   9,    2,  -20 },   // 0x6C 'l'
+  {  2615,  25,  15,  28,    2,  -14 },   // 0x6D 'm'
+  {  2662,  15,  15,  19,    2,  -14 },   // 0x6E 'n'
+  {  2691,  16,  15,  19,    1,  -14 },   // 0x6F 'o'
+  {  2721,  16,  21,  19,    2,  -14 },   // 0x70 'p'
+  {  2763,  16,  21,  19,    1,  -14 },   // 0x71 'q'
+  {  2805,  11,  15,  13,    2,  -14 },   // 0x72 'r'
+  {  2826,  13,  15,  16,    1,  -14 },   // 0x73 's'
+  {  2851,  12,  19,  13,    0,  -18 },   // 0x74 't'
+  {  2880,  15,  15,  19,    2,  -14 },   // 0x75 'u'
+  {  2909,  17,  15,  18,    0,  -14 },   // 0x76 'v'
+  {  2941,  23,  15,  25,    1,  -14 },   // 0x77 'w'
+  {  2985,  17,  15,  17,    0,  -14 },   // 0x78 'x'
+  {  3017,  17,  21,  18,    0,  -14 },   // 0x79 'y'
+  {  3062,  13,  15,  16,    1,  -14 },   // 0x7A 'z'
+  {  3087,  12,  25,  19,    3,  -20 },   // 0x7B '{'
+  {  3125,   3,  27,  10,    3,  -20 },   // 0x7C '|'
+  {  3136,  12,  25,  19,    3,  -20 },   // 0x7D '}'
+  {  3174,  17,   5,  23,    3,  -10 },   // 0x7E '~'
+  {  3185,  14,  24,  16,    1,  -18 },   // 0x7F
+  {  3227,  14,  24,  16,    1,  -18 },   // 0x80
+  {  3269,  14,  24,  16,    1,  -18 },   // 0x81
+  {  3311,  14,  24,  16,    1,  -18 },   // 0x82
+  {  3353,  14,  24,  16,    1,  -18 },   // 0x83
+  {  3395,  14,  24,  16,    1,  -18 },   // 0x84
+  {  3437,  14,  24,  16,    1,  -18 },   // 0x85
+  {  3479,  14,  24,  16,    1,  -18 },   // 0x86
+  {  3521,  14,  24,  16,    1,  -18 },   // 0x87
+  {  3563,  14,  24,  16,    1,  -18 },   // 0x88
+  {  3605,  14,  24,  16,    1,  -18 },   // 0x89
+  {  3647,  14,  24,  16,    1,  -18 },   // 0x8A
+  {  3689,  14,  24,  16,    1,  -18 },   // 0x8B
+  {  3731,  14,  24,  16,    1,  -18 },   // 0x8C
+  {  3773,  14,  24,  16,    1,  -18 },   // 0x8D
+  {  3815,  14,  24,  16,    1,  -18 },   // 0x8E
+  {  3857,  14,  24,  16,    1,  -18 },   // 0x8F
+  {  3899,  14,  24,  16,    1,  -18 },   // 0x90
+  {  3941,  14,  24,  16,    1,  -18 },   // 0x91
+  {  3983,  14,  24,  16,    1,  -18 },   // 0x92
+  {  4025,  14,  24,  16,    1,  -18 },   // 0x93
+  {  4067,  14,  24,  16,    1,  -18 },   // 0x94
+  {  4109,  14,  24,  16,    1,  -18 },   // 0x95
+  {  4151,  14,  24,  16,    1,  -18 },   // 0x96
+  {  4193,  14,  24,  16,    1,  -18 },   // 0x97
+  {  4235,  14,  24,  16,    1,  -18 },   // 0x98
+  {  4277,  14,  24,  16,    1,  -18 },   // 0x99
+  {  4319,  14,  24,  16,    1,  -18 },   // 0x9A
+  {  4361,  14,  24,  16,    1,  -18 },   // 0x9B
+  {  4403,  14,  24,  16,    1,  -18 },   // 0x9C
+  {  4445,  14,  24,  16,    1,  -18 },   // 0x9D
+  {  4487,  14,  24,  16,    1,  -18 },   // 0x9E
+  {  4529,  14,  24,  16,    1,  -18 },   // 0x9F
+  {  4571,   1,   1,   9,    0,    0 },   // 0xA0
+  {  4572,   5,  20,  12,    4,  -14 },   // 0xA1
+  {  4585,  13,  23,  19,    2,  -18 },   // 0xA2
+  {  4623,  15,  20,  19,    2,  -19 },   // 0xA3
+  {  4661,  15,  15,  17,    1,  -15 },   // 0xA4
+  {  4690,  19,  20,  19,    0,  -19 },   // 0xA5
+  {  4738,   3,  24,  10,    3,  -18 },   // 0xA6
+  {  4747,  13,  23,  14,    1,  -19 },   // 0xA7
+  {  4785,   8,   3,  14,    3,  -20 },   // 0xA8
+  {  4788,  20,  20,  27,    4,  -19 },   // 0xA9
+  {  4838,  11,  16,  15,    2,  -19 },   // 0xAA
+  {  4860,  14,  12,  17,    2,  -13 },   // 0xAB
+  {  4881,  17,   8,  23,    3,  -11 },   // 0xAC
+  {  4898,   8,   4,  11,    1,   -9 },   // 0xAD
+  {  4902,  20,  20,  27,    4,  -19 },   // 0xAE
+  {  4952,   8,   2,  14,    3,  -20 },   // 0xAF
+  {  4954,   9,   9,  14,    2,  -19 },   // 0xB0
+  {  4965,  17,  17,  23,    3,  -16 },   // 0xB1
+  {  5002,   9,  11,  12,    1,  -19 },   // 0xB2
+  {  5015,   9,  11,  12,    1,  -19 },   // 0xB3
+  {  5028,   7,   5,  14,    5,  -21 },   // 0xB4
+  {  5033,  17,  21,  20,    2,  -14 },   // 0xB5
+  {  5078,  14,  23,  17,    1,  -19 },   // 0xB6
+  {  5119,   5,   5,  10,    3,  -11 },   // 0xB7
+  {  5123,   6,   5,  14,    3,    1 },   // 0xB8
+  {  5127,   9,  11,  12,    2,  -19 },   // 0xB9
+  {  5140,  12,  16,  15,    2,  -19 },   // 0xBA
+  {  5164,  14,  12,  17,    3,  -13 },   // 0xBB
+  {  5185,  24,  20,  28,    2,  -19 },   // 0xBC
+  {  5245,  24,  20,  28,    2,  -19 },   // 0xBD
+  {  5305,  25,  20,  28,    1,  -19 },   // 0xBE
+  {  5368,  12,  21,  16,    2,  -14 },   // 0xBF
+  {  5400,  21,  25,  21,    0,  -24 },   // 0xC0
+  {  5466,  21,  25,  21,    0,  -24 },   // 0xC1
+  {  5532,  21,  25,  21,    0,  -24 },   // 0xC2
+  {  5598,  21,  26,  21,    0,  -25 },   // 0xC3
+  {  5667,  21,  25,  21,    0,  -24 },   // 0xC4
+  {  5733,  21,  25,  21,    0,  -24 },   // 0xC5
+  {  5799,  27,  20,  29,    0,  -19 },   // 0xC6
+  {  5867,  17,  25,  20,    1,  -19 },   // 0xC7
+  {  5921,  14,  25,  18,    2,  -24 },   // 0xC8
+  {  5965,  14,  25,  18,    2,  -24 },   // 0xC9
+  {  6009,  14,  25,  18,    2,  -24 },   // 0xCA
+  {  6053,  14,  25,  18,    2,  -24 },   // 0xCB
+  {  6097,   7,  25,  10,    0,  -24 },   // 0xCC
+  {  6119,   6,  25,  10,    2,  -24 },   // 0xCD
+  {  6138,  11,  25,  10,   -1,  -24 },   // 0xCE
+  {  6173,   7,  25,  10,    1,  -24 },   // 0xCF
+  {  6195,  21,  20,  23,    0,  -19 },   // 0xD0
+  {  6248,  18,  26,  23,    2,  -25 },   // 0xD1
+  {  6307,  20,  25,  23,    1,  -24 },   // 0xD2
+  {  6370,  20,  25,  23,    1,  -24 },   // 0xD3
+  {  6433,  20,  25,  23,    1,  -24 },   // 0xD4
+  {  6496,  20,  26,  23,    1,  -25 },   // 0xD5
+  {  6561,  20,  25,  23,    1,  -24 },   // 0xD6
+  {  6624,  16,  16,  23,    3,  -15 },   // 0xD7
+  {  6656,  22,  22,  23,    0,  -20 },   // 0xD8
+  {  6717,  17,  25,  22,    2,  -24 },   // 0xD9
+  {  6771,  17,  25,  22,    2,  -24 },   // 0xDA
+  {  6825,  17,  25,  22,    2,  -24 },   // 0xDB
+  {  6879,  17,  25,  22,    2,  -24 },   // 0xDC
+  {  6933,  21,  25,  20,   -1,  -24 },   // 0xDD
+  {  6999,  16,  20,  20,    2,  -19 },   // 0xDE
+  {  7039,  16,  21,  19,    2,  -20 },   // 0xDF
+  {  7081,  15,  22,  18,    1,  -21 },   // 0xE0
+  {  7123,  15,  22,  18,    1,  -21 },   // 0xE1
+  {  7165,  15,  22,  18,    1,  -21 },   // 0xE2
+  {  7207,  15,  22,  18,    1,  -21 },   // 0xE3
+  {  7249,  15,  21,  18,    1,  -20 },   // 0xE4
+  {  7289,  15,  24,  18,    1,  -23 },   // 0xE5
+  {  7334,  26,  15,  28,    1,  -14 },   // 0xE6
+  {  7383,  13,  20,  16,    1,  -14 },   // 0xE7
+  {  7416,  16,  22,  18,    1,  -21 },   // 0xE8
+  {  7460,  16,  22,  18,    1,  -21 },   // 0xE9
+  {  7504,  16,  22,  18,    1,  -21 },   // 0xEA
+  {  7548,  16,  21,  18,    1,  -20 },   // 0xEB
+  {  7590,   8,  22,   9,   -1,  -21 },   // 0xEC
+  {  7612,   8,  22,   9,    2,  -21 },   // 0xED
+  {  7634,  11,  22,   9,   -1,  -21 },   // 0xEE
+  {  7665,   7,  21,   9,    1,  -20 },   // 0xEF
+  {  7684,  16,  21,  19,    1,  -20 },   // 0xF0
+  {  7726,  15,  22,  19,    2,  -21 },   // 0xF1
+  {  7768,  16,  22,  19,    1,  -21 },   // 0xF2
+  {  7812,  16,  22,  19,    1,  -21 },   // 0xF3
+  {  7856,  16,  22,  19,    1,  -21 },   // 0xF4
+  {  7900,  16,  22,  19,    1,  -21 },   // 0xF5
+  {  7944,  16,  21,  19,    1,  -20 },   // 0xF6
+  {  7986,  16,  15,  23,    3,  -15 },   // 0xF7
+  {  8016,  16,  17,  19,    1,  -15 },   // 0xF8
+  {  8050,  15,  22,  19,    2,  -21 },   // 0xF9
+  {  8092,  15,  22,  19,    2,  -21 },   // 0xFA
+  {  8134,  15,  22,  19,    2,  -21 },   // 0xFB
+  {  8176,  15,  21,  19,    2,  -20 },   // 0xFC
+  {  8216,  17,  28,  18,    0,  -21 },   // 0xFD
+  {  8276,  16,  27,  19,    2,  -20 },   // 0xFE
+  {  8330,  17,  27,  18,    0,  -20 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold14pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold14pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold14pt8bGlyphs,
+  0x20, 0xFF, 32 };
+
+// Approx. 9963 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold14pt8bMetrics[] PROGMEM = {
+  {   0,   9,   1 },   // 0x20
+  {   4,  12,   9 },   // 0x21
+  {   2,  14,  11 },   // 0x22
+  {   2,  23,  21 },   // 0x23
+  {   3,  19,  17 },   // 0x24
+  {   1,  27,  26 },   // 0x25
+  {   1,  24,  22 },   // 0x26
+  {   2,   8,   5 },   // 0x27
+  {   2,  12,   9 },   // 0x28
+  {   3,  12,  10 },   // 0x29
+  {   1,  14,  13 },   // 0x2A
+  {   3,  23,  20 },   // 0x2B
+  {   2,  10,   8 },   // 0x2C
+  {   1,  11,   9 },   // 0x2D
+  {   3,  10,   8 },   // 0x2E
+  {   0,  10,  10 },   // 0x2F
+  {   1,  19,  17 },   // 0x30
+  {   3,  19,  17 },   // 0x31
+  {   2,  19,  16 },   // 0x32
+  {   2,  19,  17 },   // 0x33
+  {   1,  19,  18 },   // 0x34
+  {   2,  19,  17 },   // 0x35
+  {   1,  19,  17 },   // 0x36
+  {   2,  19,  17 },   // 0x37
+  {   1,  19,  17 },   // 0x38
+  {   1,  19,  17 },   // 0x39
+  {   3,  11,   8 },   // 0x3A
+  {   2,  11,   8 },   // 0x3B
+  {   3,  23,  20 },   // 0x3C
+  {   3,  23,  20 },   // 0x3D
+  {   3,  23,  20 },   // 0x3E
+  {   2,  16,  14 },   // 0x3F
+  {   2,  27,  25 },   // 0x40
+  {   0,  21,  21 },   // 0x41
+  {   2,  21,  18 },   // 0x42
+  {   1,  20,  18 },   // 0x43
+  {   2,  22,  21 },   // 0x44
+  {   2,  18,  16 },   // 0x45
+  {   2,  18,  16 },   // 0x46
+  {   1,  22,  20 },   // 0x47
+  {   2,  23,  20 },   // 0x48
+  {   2,  10,   7 },   // 0x49
+  {  -2,  10,   7 },   // 0x4A
+  {   2,  21,  21 },   // 0x4B
+  {   2,  17,  16 },   // 0x4C
+  {   2,  27,  24 },   // 0x4D
+  {   2,  23,  20 },   // 0x4E
+  {   1,  23,  21 },   // 0x4F
+  {   2,  20,  18 },   // 0x50
+  {   1,  23,  21 },   // 0x51
+  {   2,  21,  20 },   // 0x52
+  {   2,  19,  18 },   // 0x53
+  {   0,  18,  19 },   // 0x54
+  {   2,  22,  19 },   // 0x55
+  {   0,  21,  21 },   // 0x56
+  {   1,  30,  29 },   // 0x57
+  {   1,  21,  21 },   // 0x58
+  {  -1,  20,  20 },   // 0x59
+  {   1,  20,  18 },   // 0x5A
+  {   2,  12,  10 },   // 0x5B
+  {   0,  10,  10 },   // 0x5C
+  {   2,  12,  10 },   // 0x5D
+  {   3,  23,  20 },   // 0x5E
+  {   0,  14,  14 },   // 0x5F
+  {   1,  14,   8 },   // 0x60
+  {   1,  18,  16 },   // 0x61
+  {   2,  19,  18 },   // 0x62
+  {   1,  16,  14 },   // 0x63
+  {   1,  19,  17 },   // 0x64
+  {   1,  18,  17 },   // 0x65
+  {   1,  12,  12 },   // 0x66
+  {   1,  19,  17 },   // 0x67
+  {   2,  19,  17 },   // 0x68
+  {   2,   9,   7 },   // 0x69
+  {  -1,   9,   7 },   // 0x6A
+  {   2,  18,  18 },   // 0x6B
+  {   2,   9,   7 },   // 0x6C
+  {   2,  28,  27 },   // 0x6D
+  {   2,  19,  17 },   // 0x6E
+  {   1,  19,  17 },   // 0x6F
+  {   2,  19,  18 },   // 0x70
+  {   1,  19,  17 },   // 0x71
+  {   2,  13,  13 },   // 0x72
+  {   1,  16,  14 },   // 0x73
+  {   0,  13,  12 },   // 0x74
+  {   2,  19,  17 },   // 0x75
+  {   0,  18,  17 },   // 0x76
+  {   1,  25,  24 },   // 0x77
+  {   0,  17,  17 },   // 0x78
+  {   0,  18,  17 },   // 0x79
+  {   1,  16,  14 },   // 0x7A
+  {   3,  19,  15 },   // 0x7B
+  {   3,  10,   6 },   // 0x7C
+  {   3,  19,  15 },   // 0x7D
+  {   3,  23,  20 },   // 0x7E
+  {   1,  16,  15 },   // 0x7F
+  {   1,  16,  15 },   // 0x80
+  {   1,  16,  15 },   // 0x81
+  {   1,  16,  15 },   // 0x82
+  {   1,  16,  15 },   // 0x83
+  {   1,  16,  15 },   // 0x84
+  {   1,  16,  15 },   // 0x85
+  {   1,  16,  15 },   // 0x86
+  {   1,  16,  15 },   // 0x87
+  {   1,  16,  15 },   // 0x88
+  {   1,  16,  15 },   // 0x89
+  {   1,  16,  15 },   // 0x8A
+  {   1,  16,  15 },   // 0x8B
+  {   1,  16,  15 },   // 0x8C
+  {   1,  16,  15 },   // 0x8D
+  {   1,  16,  15 },   // 0x8E
+  {   1,  16,  15 },   // 0x8F
+  {   1,  16,  15 },   // 0x90
+  {   1,  16,  15 },   // 0x91
+  {   1,  16,  15 },   // 0x92
+  {   1,  16,  15 },   // 0x93
+  {   1,  16,  15 },   // 0x94
+  {   1,  16,  15 },   // 0x95
+  {   1,  16,  15 },   // 0x96
+  {   1,  16,  15 },   // 0x97
+  {   1,  16,  15 },   // 0x98
+  {   1,  16,  15 },   // 0x99
+  {   1,  16,  15 },   // 0x9A
+  {   1,  16,  15 },   // 0x9B
+  {   1,  16,  15 },   // 0x9C
+  {   1,  16,  15 },   // 0x9D
+  {   1,  16,  15 },   // 0x9E
+  {   1,  16,  15 },   // 0x9F
+  {   0,   9,   1 },   // 0xA0
+  {   4,  12,   9 },   // 0xA1
+  {   2,  19,  15 },   // 0xA2
+  {   2,  19,  17 },   // 0xA3
+  {   1,  17,  16 },   // 0xA4
+  {   0,  19,  19 },   // 0xA5
+  {   3,  10,   6 },   // 0xA6
+  {   1,  14,  14 },   // 0xA7
+  {   3,  14,  11 },   // 0xA8
+  {   4,  27,  24 },   // 0xA9
+  {   2,  15,  13 },   // 0xAA
+  {   2,  17,  16 },   // 0xAB
+  {   3,  23,  20 },   // 0xAC
+  {   1,  11,   9 },   // 0xAD
+  {   4,  27,  24 },   // 0xAE
+  {   3,  14,  11 },   // 0xAF
+  {   2,  14,  11 },   // 0xB0
+  {   3,  23,  20 },   // 0xB1
+  {   1,  12,  10 },   // 0xB2
+  {   1,  12,  10 },   // 0xB3
+  {   5,  14,  12 },   // 0xB4
+  {   2,  20,  19 },   // 0xB5
+  {   1,  17,  15 },   // 0xB6
+  {   3,  10,   8 },   // 0xB7
+  {   3,  14,   9 },   // 0xB8
+  {   2,  12,  11 },   // 0xB9
+  {   2,  15,  14 },   // 0xBA
+  {   3,  17,  17 },   // 0xBB
+  {   2,  28,  26 },   // 0xBC
+  {   2,  28,  26 },   // 0xBD
+  {   1,  28,  26 },   // 0xBE
+  {   2,  16,  14 },   // 0xBF
+  {   0,  21,  21 },   // 0xC0
+  {   0,  21,  21 },   // 0xC1
+  {   0,  21,  21 },   // 0xC2
+  {   0,  21,  21 },   // 0xC3
+  {   0,  21,  21 },   // 0xC4
+  {   0,  21,  21 },   // 0xC5
+  {   0,  29,  27 },   // 0xC6
+  {   1,  20,  18 },   // 0xC7
+  {   2,  18,  16 },   // 0xC8
+  {   2,  18,  16 },   // 0xC9
+  {   2,  18,  16 },   // 0xCA
+  {   2,  18,  16 },   // 0xCB
+  {   0,  10,   7 },   // 0xCC
+  {   2,  10,   8 },   // 0xCD
+  {  -1,  10,  10 },   // 0xCE
+  {   1,  10,   8 },   // 0xCF
+  {   0,  23,  21 },   // 0xD0
+  {   2,  23,  20 },   // 0xD1
+  {   1,  23,  21 },   // 0xD2
+  {   1,  23,  21 },   // 0xD3
+  {   1,  23,  21 },   // 0xD4
+  {   1,  23,  21 },   // 0xD5
+  {   1,  23,  21 },   // 0xD6
+  {   3,  23,  19 },   // 0xD7
+  {   0,  23,  22 },   // 0xD8
+  {   2,  22,  19 },   // 0xD9
+  {   2,  22,  19 },   // 0xDA
+  {   2,  22,  19 },   // 0xDB
+  {   2,  22,  19 },   // 0xDC
+  {  -1,  20,  20 },   // 0xDD
+  {   2,  20,  18 },   // 0xDE
+  {   2,  19,  18 },   // 0xDF
+  {   1,  18,  16 },   // 0xE0
+  {   1,  18,  16 },   // 0xE1
+  {   1,  18,  16 },   // 0xE2
+  {   1,  18,  16 },   // 0xE3
+  {   1,  18,  16 },   // 0xE4
+  {   1,  18,  16 },   // 0xE5
+  {   1,  28,  27 },   // 0xE6
+  {   1,  16,  14 },   // 0xE7
+  {   1,  18,  17 },   // 0xE8
+  {   1,  18,  17 },   // 0xE9
+  {   1,  18,  17 },   // 0xEA
+  {   1,  18,  17 },   // 0xEB
+  {  -1,   9,   7 },   // 0xEC
+  {   2,   9,  10 },   // 0xED
+  {  -1,   9,  10 },   // 0xEE
+  {   1,   9,   8 },   // 0xEF
+  {   1,  19,  17 },   // 0xF0
+  {   2,  19,  17 },   // 0xF1
+  {   1,  19,  17 },   // 0xF2
+  {   1,  19,  17 },   // 0xF3
+  {   1,  19,  17 },   // 0xF4
+  {   1,  19,  17 },   // 0xF5
+  {   1,  19,  17 },   // 0xF6
+  {   3,  23,  19 },   // 0xF7
+  {   1,  19,  17 },   // 0xF8
+  {   2,  19,  17 },   // 0xF9
+  {   2,  19,  17 },   // 0xFA
+  {   2,  19,  17 },   // 0xFB
+  {   2,  19,  17 },   // 0xFC
+  {   0,  18,  17 },   // 0xFD
+  {   2,  19,  18 },   // 0xFE
+  {   0,  18,  17 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold14pt8bWidths = { DejaVuSans_Bold14pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD14PTLAT1__H
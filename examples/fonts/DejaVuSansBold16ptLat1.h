@@ -0,0 +1,1377 @@
+#ifndef DEJAVUSANSBOLD16PTLAT1__H
+#define DEJAVUSANSBOLD16PTLAT1__H
+const uint8_t DejaVuSans_Bold16pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xCE, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3,
+  0xFC, 0x7F, 0x8F, 0x00, 0xF0, 0xE0, 0x03, 0xC3, 0x80, 0x0E, 0x1E, 0x00,
+  0x38, 0x78, 0x01, 0xE1, 0xC0, 0x07, 0x87, 0x00, 0x1C, 0x3C, 0x0F, 0xFF,
+  0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x38, 0x78, 0x00, 0xE1, 0xE0,
+  0x07, 0x87, 0x00, 0x1E, 0x1C, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xF0, 0x3C, 0x38, 0x00, 0xE1, 0xE0, 0x03, 0x87, 0x00, 0x1E, 0x1C,
+  0x00, 0x78, 0x70, 0x01, 0xC3, 0xC0, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00,
+  0x60, 0x01, 0xFF, 0x03, 0xFF, 0xF3, 0xFF, 0xFB, 0xF6, 0x3D, 0xF3, 0x02,
+  0xF9, 0x80, 0x7C, 0xC0, 0x3F, 0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0xE1, 0xFF,
+  0xF8, 0x3F, 0xFC, 0x03, 0xFF, 0x01, 0x8F, 0x80, 0xC7, 0xE0, 0x63, 0xFE,
+  0x33, 0xFF, 0xFF, 0xF7, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0x00, 0x01, 0x80,
+  0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x1F, 0x80, 0x0E, 0x01, 0xFE,
+  0x00, 0xE0, 0x1F, 0xF8, 0x0F, 0x01, 0xF3, 0xE0, 0x70, 0x0F, 0x0F, 0x07,
+  0x80, 0x78, 0x78, 0x78, 0x03, 0xC3, 0xC3, 0x80, 0x1E, 0x1E, 0x3C, 0x00,
+  0xF9, 0xF1, 0xC0, 0x03, 0xFF, 0x1E, 0x00, 0x0F, 0xF1, 0xE0, 0x00, 0x3F,
+  0x0E, 0x1F, 0x80, 0x00, 0xF1, 0xFE, 0x00, 0x0F, 0x1F, 0xF8, 0x00, 0x71,
+  0xF3, 0xE0, 0x07, 0x8F, 0x0F, 0x00, 0x38, 0x78, 0x78, 0x03, 0xC3, 0xC3,
+  0xC0, 0x3C, 0x1E, 0x1E, 0x01, 0xC0, 0xF9, 0xF0, 0x1E, 0x03, 0xFF, 0x00,
+  0xE0, 0x0F, 0xF0, 0x0E, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF,
+  0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x83, 0x00, 0x1F, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xE0,
+  0x3E, 0x3F, 0xF0, 0x3E, 0x7F, 0xF8, 0x3E, 0x7D, 0xFC, 0x7C, 0xF8, 0xFE,
+  0x7C, 0xF8, 0x7F, 0xFC, 0xF8, 0x3F, 0xF8, 0xF8, 0x1F, 0xF0, 0xFC, 0x0F,
+  0xE0, 0x7E, 0x1F, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xFE,
+  0xFE, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x87, 0x87, 0xC3,
+  0xC3, 0xE1, 0xF1, 0xF0, 0xF8, 0x7C, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x0F, 0x87, 0xC3, 0xE0, 0xF8, 0x7C, 0x1E,
+  0x0F, 0x83, 0xC1, 0xF0, 0xF8, 0x3C, 0x1F, 0x07, 0x83, 0xE1, 0xF0, 0x7C,
+  0x3E, 0x1F, 0x07, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87,
+  0xC3, 0xE3, 0xE1, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3E, 0x1E, 0x1F, 0x00,
+  0x03, 0x80, 0x07, 0x01, 0x0E, 0x17, 0x9C, 0xFF, 0xBB, 0xE7, 0xFF, 0x03,
+  0xF8, 0x07, 0xF0, 0x3F, 0xF9, 0xF7, 0x7F, 0xCE, 0x7A, 0x1C, 0x20, 0x38,
+  0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0x9F, 0x3C,
+  0x71, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0xE0, 0x3C, 0x07, 0x00, 0xE0, 0x3C, 0x07, 0x00, 0xE0, 0x3C, 0x07, 0x00,
+  0xE0, 0x3C, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x1C, 0x07, 0x80,
+  0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x00, 0x03, 0xF8,
+  0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC7, 0xE0, 0xFC, 0xF8, 0x0F,
+  0x9F, 0x01, 0xF7, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F,
+  0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
+  0x7C, 0x07, 0xCF, 0x80, 0xF9, 0xF8, 0x3F, 0x1F, 0xFF, 0xC1, 0xFF, 0xF0,
+  0x1F, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE,
+  0x0E, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
+  0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x3F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x7F, 0x80,
+  0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+  0x7E, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F,
+  0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+  0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0xE6, 0x07, 0xF0, 0x00, 0xF8,
+  0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x07, 0xFE, 0x03, 0xFE, 0x01, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0,
+  0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xEF, 0xFF, 0xE3, 0xFF, 0xE0, 0x7F, 0xC0,
+  0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x3D, 0xF0,
+  0x07, 0x3E, 0x01, 0xE7, 0xC0, 0x78, 0xF8, 0x0E, 0x1F, 0x03, 0xC3, 0xE0,
+  0xF0, 0x7C, 0x1C, 0x0F, 0x87, 0x81, 0xF1, 0xE0, 0x3E, 0x38, 0x07, 0xC7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x7F, 0xFE, 0x3F, 0xFF, 0x1F,
+  0xFF, 0x8F, 0xFF, 0xC7, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xFF, 0xE0,
+  0x7F, 0xFC, 0x3F, 0xFF, 0x1F, 0xFF, 0xCE, 0x07, 0xE4, 0x01, 0xF8, 0x00,
+  0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x0F, 0xDF,
+  0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xE0, 0xFF, 0x80, 0x01, 0xFC, 0x01, 0xFF,
+  0xC0, 0xFF, 0xF8, 0x7F, 0xFE, 0x3F, 0x03, 0x9F, 0x80, 0x27, 0xC0, 0x03,
+  0xE0, 0x00, 0xF9, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0xFE, 0xFE,
+  0x0F, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0x7C, 0x07, 0xDF, 0x01,
+  0xF7, 0xE0, 0xF8, 0xFF, 0xFE, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x3F, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF8, 0x00,
+  0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x00,
+  0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x03, 0xE0,
+  0x03, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7C,
+  0x00, 0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F,
+  0x9F, 0x03, 0xE7, 0xC0, 0xF9, 0xF0, 0x3E, 0x3E, 0x1F, 0x0F, 0xFF, 0xC1,
+  0xFF, 0xE0, 0x7F, 0xF8, 0x7F, 0xFF, 0x9F, 0x87, 0xEF, 0x80, 0x7F, 0xE0,
+  0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF,
+  0x87, 0xFF, 0xC0, 0x7F, 0x80, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xE1,
+  0xFF, 0xFC, 0x7C, 0x1F, 0xBE, 0x03, 0xEF, 0x80, 0xFB, 0xE0, 0x3F, 0xF8,
+  0x0F, 0xFE, 0x03, 0xFF, 0xC1, 0xFD, 0xFF, 0xFF, 0x3F, 0xFF, 0xC7, 0xFF,
+  0xF0, 0x7E, 0x7C, 0x00, 0x1E, 0x00, 0x0F, 0x88, 0x07, 0xE3, 0x83, 0xF0,
+  0xFF, 0xFC, 0x3F, 0xFE, 0x07, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x7C, 0xF9, 0xF3,
+  0xE7, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF3, 0xE7, 0xCF, 0x9F, 0x3C, 0xF9,
+  0xE3, 0x8E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x1F,
+  0xF0, 0x1F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
+  0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x00, 0x04, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x80, 0x00, 0x1E, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
+  0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xE0, 0x00,
+  0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0,
+  0x07, 0xF0, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xCF,
+  0xFF, 0xBF, 0xFF, 0xE0, 0xFE, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xF8,
+  0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x01, 0xF0, 0x07, 0xC0,
+  0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x07,
+  0xF0, 0x3F, 0x01, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x00,
+  0xF3, 0xC0, 0xF3, 0x8E, 0x70, 0x7F, 0x71, 0xEE, 0x1F, 0xFE, 0x1F, 0x83,
+  0xC7, 0xC3, 0xF0, 0xE0, 0x78, 0x7E, 0x1C, 0x07, 0x0F, 0xC3, 0x80, 0xE1,
+  0xF8, 0x70, 0x1C, 0x7F, 0x0E, 0x07, 0x8E, 0xE0, 0xF1, 0xF3, 0xCE, 0x1F,
+  0xFF, 0xF1, 0xC1, 0xFD, 0xFC, 0x3C, 0x1F, 0x3C, 0x03, 0xC0, 0x00, 0x00,
+  0x7C, 0x00, 0x10, 0x07, 0xC0, 0x06, 0x00, 0x7E, 0x03, 0xE0, 0x07, 0xFF,
+  0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x07, 0xE7, 0xE0,
+  0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0x81, 0xF0,
+  0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E,
+  0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF,
+  0xFE, 0x7F, 0xFF, 0xEF, 0x80, 0xFD, 0xF0, 0x0F, 0xBE, 0x01, 0xF7, 0xC0,
+  0x3E, 0xF8, 0x0F, 0xDF, 0xFF, 0xF3, 0xFF, 0xFC, 0x7F, 0xFF, 0xCF, 0xFF,
+  0xFD, 0xF0, 0x1F, 0xBE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
+  0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0x3F, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xF8,
+  0x0E, 0xFC, 0x00, 0x5F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x04, 0xFE, 0x03, 0x8F, 0xFF,
+  0xF0, 0xFF, 0xFE, 0x0F, 0xFF, 0xC0, 0x3F, 0xC0, 0xFF, 0xF0, 0x07, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x8F, 0x81, 0xFE, 0x7C, 0x03, 0xFB,
+  0xE0, 0x0F, 0xDF, 0x00, 0x3E, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
+  0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFF,
+  0x00, 0x3E, 0xF8, 0x03, 0xF7, 0xC0, 0x3F, 0xBE, 0x07, 0xF9, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xF8, 0x7F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF,
+  0xFF, 0x87, 0xFF, 0xFE, 0x3F, 0xC0, 0x79, 0xFC, 0x00, 0x27, 0xE0, 0x00,
+  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x7F, 0xFE,
+  0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x07, 0xDF, 0x00,
+  0x1F, 0x7E, 0x00, 0x7D, 0xFC, 0x01, 0xF3, 0xFC, 0x07, 0xC7, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x0F, 0xF8, 0x00, 0xF8, 0x01, 0xFF,
+  0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F,
+  0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
+  0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xC1,
+  0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C,
+  0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07,
+  0xC1, 0xF0, 0x7C, 0x3F, 0x1F, 0xBF, 0xEF, 0xF3, 0xF8, 0xF8, 0x00, 0xF8,
+  0x07, 0xF3, 0xE0, 0x3F, 0x8F, 0x81, 0xFC, 0x3E, 0x0F, 0xE0, 0xF8, 0x7F,
+  0x03, 0xE3, 0xF8, 0x0F, 0x9F, 0xC0, 0x3E, 0xFE, 0x00, 0xFF, 0xF0, 0x03,
+  0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x03, 0xFF,
+  0xC0, 0x0F, 0xBF, 0x80, 0x3E, 0x7F, 0x00, 0xF8, 0xFE, 0x03, 0xE1, 0xFC,
+  0x0F, 0x83, 0xF8, 0x3E, 0x07, 0xF0, 0xF8, 0x0F, 0xE3, 0xE0, 0x1F, 0xCF,
+  0x80, 0x3F, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xF7,
+  0x83, 0xFF, 0xFB, 0xC1, 0xEF, 0xFD, 0xF1, 0xF7, 0xFE, 0x78, 0xF3, 0xFF,
+  0x3E, 0xF9, 0xFF, 0x8F, 0x78, 0xFF, 0xC7, 0xFC, 0x7F, 0xE1, 0xFC, 0x3F,
+  0xF0, 0xFE, 0x1F, 0xF8, 0x7F, 0x0F, 0xFC, 0x1F, 0x07, 0xFE, 0x0F, 0x83,
+  0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00,
+  0x3E, 0xFC, 0x01, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xFF, 0xF0, 0x1F, 0xFF,
+  0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xC1, 0xFF, 0xBC, 0x1F, 0xFB, 0xE1, 0xFF,
+  0x9E, 0x1F, 0xF9, 0xF1, 0xFF, 0x8F, 0x1F, 0xF8, 0xF9, 0xFF, 0x87, 0x9F,
+  0xF8, 0x7D, 0xFF, 0x83, 0xDF, 0xF8, 0x3F, 0xFF, 0x81, 0xFF, 0xF8, 0x1F,
+  0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x7F, 0xF8, 0x03, 0xF0, 0x00,
+  0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xF8,
+  0x3F, 0x8F, 0xC0, 0x1F, 0x9F, 0x00, 0x1F, 0x7E, 0x00, 0x3E, 0xF8, 0x00,
+  0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03,
+  0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3E, 0x7C, 0x00, 0x7C,
+  0xFC, 0x01, 0xF8, 0xFE, 0x0F, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00,
+  0xFF, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF,
+  0xFE, 0x7F, 0xFF, 0xEF, 0x80, 0xFD, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0,
+  0x1F, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0x7F, 0xFF, 0xEF, 0xFF,
+  0xF9, 0xFF, 0xFE, 0x3F, 0xFF, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF,
+  0x83, 0xF8, 0x3F, 0x8F, 0xC0, 0x1F, 0x9F, 0x00, 0x1F, 0x7E, 0x00, 0x3E,
+  0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+  0x80, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0x7C,
+  0x00, 0x7C, 0xFC, 0x01, 0xF8, 0xFE, 0x0F, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x0F, 0x80, 0xFC, 0x7C,
+  0x03, 0xE3, 0xE0, 0x1F, 0x1F, 0x00, 0xF8, 0xF8, 0x07, 0xC7, 0xC0, 0xFC,
+  0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x83, 0xE0,
+  0xFE, 0x1F, 0x01, 0xF0, 0xF8, 0x0F, 0xC7, 0xC0, 0x3E, 0x3E, 0x01, 0xF9,
+  0xF0, 0x07, 0xCF, 0x80, 0x3F, 0x7C, 0x00, 0xFB, 0xE0, 0x07, 0xE0, 0x07,
+  0xFC, 0x07, 0xFF, 0xE3, 0xFF, 0xF9, 0xFF, 0xFE, 0xFC, 0x07, 0xBE, 0x00,
+  0x2F, 0x80, 0x03, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0,
+  0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0x00,
+  0x07, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF,
+  0x80, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
+  0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
+  0x00, 0x03, 0xE0, 0x00, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC,
+  0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
+  0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0xFD, 0xF8,
+  0x3F, 0x3F, 0xFF, 0xE3, 0xFF, 0xF8, 0x3F, 0xFE, 0x01, 0xFF, 0x00, 0xFC,
+  0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3E,
+  0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x1F, 0x00, 0xF8, 0x1F,
+  0x00, 0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x81, 0xF0, 0x0F, 0xC3, 0xF0, 0x07,
+  0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xE7, 0xE0, 0x03, 0xE7, 0xC0, 0x03,
+  0xE7, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0x07, 0xE0, 0x1F,
+  0xF8, 0x07, 0xE0, 0x1F, 0x7C, 0x07, 0xE0, 0x3E, 0x7C, 0x0F, 0xF0, 0x3E,
+  0x7C, 0x0F, 0xF0, 0x3E, 0x7C, 0x0F, 0xF0, 0x3E, 0x3E, 0x0F, 0xF0, 0x7E,
+  0x3E, 0x1F, 0xF8, 0x7C, 0x3E, 0x1E, 0x78, 0x7C, 0x3E, 0x1E, 0x78, 0x7C,
+  0x3F, 0x1E, 0x78, 0xFC, 0x1F, 0x1E, 0x78, 0xF8, 0x1F, 0x3C, 0x3C, 0xF8,
+  0x1F, 0x3C, 0x3C, 0xF8, 0x1F, 0x3C, 0x3C, 0xF8, 0x0F, 0xBC, 0x3D, 0xF0,
+  0x0F, 0xFC, 0x3F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0,
+  0x07, 0xF8, 0x1F, 0xF0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xE0,
+  0x07, 0xF0, 0x0F, 0xE0, 0xFC, 0x00, 0x7E, 0xFC, 0x01, 0xF8, 0xFC, 0x07,
+  0xE1, 0xFC, 0x1F, 0xC1, 0xF8, 0x3F, 0x01, 0xF8, 0xFC, 0x01, 0xFB, 0xF0,
+  0x03, 0xF7, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
+  0x07, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0x03,
+  0xF7, 0xE0, 0x0F, 0xC7, 0xE0, 0x1F, 0x8F, 0xC0, 0x7E, 0x0F, 0xC1, 0xF8,
+  0x0F, 0xC3, 0xF0, 0x1F, 0x8F, 0xC0, 0x1F, 0xBF, 0x00, 0x1F, 0x80, 0xFC,
+  0x00, 0x7E, 0xFC, 0x01, 0xF8, 0xFC, 0x07, 0xE1, 0xF8, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x01, 0xF8, 0xFC, 0x03, 0xF1, 0xF8, 0x03, 0xF7, 0xE0, 0x03, 0xFF,
+  0x80, 0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+  0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
+  0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
+  0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
+  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x87, 0xC3, 0xE1,
+  0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C,
+  0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0,
+  0xE0, 0x1E, 0x01, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x1C,
+  0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x38, 0x07, 0x00,
+  0xF0, 0x0E, 0x01, 0xC0, 0x3C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0xFF,
+  0xFF, 0xFF, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1,
+  0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C,
+  0x3E, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0x80,
+  0x03, 0xFC, 0x00, 0x7F, 0xE0, 0x0F, 0x9F, 0x01, 0xE0, 0x78, 0x7C, 0x03,
+  0xEF, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF,
+  0xE6, 0x01, 0xF8, 0x00, 0x7C, 0x3F, 0xFE, 0x7F, 0xFF, 0x7F, 0xFF, 0xFE,
+  0x07, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE,
+  0x7F, 0xDF, 0x1F, 0x8F, 0x80, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE3, 0xE0, 0xFB,
+  0xFE, 0x3F, 0xFF, 0xCF, 0xFF, 0xFB, 0xF8, 0x7E, 0xFC, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0xFF,
+  0xF8, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xBF, 0xE3, 0xE3, 0xE0, 0x03,
+  0xF0, 0x1F, 0xF8, 0xFF, 0xFB, 0xFF, 0xF7, 0xE0, 0x7F, 0x80, 0x7E, 0x00,
+  0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x17, 0xF0, 0x6F,
+  0xFF, 0xCF, 0xFF, 0x87, 0xFE, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x01, 0xF0,
+  0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x1F,
+  0x1F, 0x1F, 0xF7, 0xCF, 0xFF, 0xF7, 0xFF, 0xFD, 0xF8, 0x7F, 0xFC, 0x0F,
+  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF,
+  0xC0, 0xFD, 0xF8, 0x7F, 0x7F, 0xFF, 0xCF, 0xFF, 0xF1, 0xFF, 0x7C, 0x1F,
+  0x1F, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F,
+  0xBF, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x03, 0xF0, 0x02, 0x7E, 0x07, 0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x7F,
+  0xFC, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0xC3, 0xFE, 0x3F, 0xF1, 0xF0,
+  0x0F, 0x80, 0x7C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3E, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x07, 0xC7, 0xC7, 0xFD, 0xF3,
+  0xFF, 0xFD, 0xFF, 0xFF, 0x7E, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x7F, 0xE0,
+  0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0x7E, 0x1F,
+  0xDF, 0xFF, 0xF3, 0xFF, 0xFC, 0x7F, 0xDF, 0x07, 0xC7, 0xC0, 0x01, 0xF2,
+  0x00, 0xFC, 0xE0, 0x7E, 0x3F, 0xFF, 0x8F, 0xFF, 0xC1, 0xFF, 0xC0, 0x1F,
+  0xC0, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
+  0xC0, 0x03, 0xE0, 0x01, 0xF1, 0xF8, 0xFB, 0xFE, 0x7F, 0xFF, 0xBF, 0xFF,
+  0xDF, 0xC3, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8,
+  0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F,
+  0xE0, 0x3F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
+  0xF8, 0x00, 0x00, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E,
+  0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87,
+  0xC7, 0xFF, 0xEF, 0xF7, 0xF3, 0xF0, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0xFC, 0xF8, 0x3F, 0x1F, 0x0F, 0xC3, 0xE3, 0xF0, 0x7C, 0xFC, 0x0F, 0xBF,
+  0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0x7E,
+  0x03, 0xE7, 0xE0, 0x7C, 0x7E, 0x0F, 0x87, 0xE1, 0xF0, 0x7E, 0x3E, 0x07,
+  0xE7, 0xC0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x1F, 0x1F, 0x7F, 0x8F,
+  0xF3, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xE3, 0xFC, 0x7F, 0xF8,
+  0x3F, 0x07, 0xFE, 0x07, 0xC0, 0xFF, 0xC0, 0xF8, 0x1F, 0xF8, 0x1F, 0x03,
+  0xFF, 0x03, 0xE0, 0x7F, 0xE0, 0x7C, 0x0F, 0xFC, 0x0F, 0x81, 0xFF, 0x81,
+  0xF0, 0x3F, 0xF0, 0x3E, 0x07, 0xFE, 0x07, 0xC0, 0xFF, 0xC0, 0xF8, 0x1F,
+  0xF8, 0x1F, 0x03, 0xE0, 0xF8, 0xFC, 0x7D, 0xFF, 0x3F, 0xFF, 0xDF, 0xFF,
+  0xEF, 0xE1, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x0F, 0x80, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xE7, 0xE0, 0xFD, 0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xE0, 0xFC,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0xF8, 0xF8,
+  0x3E, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0xFE, 0xFE, 0x1F, 0xBF, 0x03, 0xFF,
+  0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xF0,
+  0x3F, 0xFE, 0x1F, 0xBF, 0xFF, 0xEF, 0xFF, 0xF3, 0xEF, 0xF8, 0xF8, 0xF8,
+  0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x03, 0xE0, 0x00, 0x07, 0xC7, 0xC7, 0xFD, 0xF3, 0xFF, 0xFD, 0xFF,
+  0xFF, 0x7E, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07,
+  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0x7E, 0x1F, 0xDF, 0xFF, 0xF3,
+  0xFF, 0xFC, 0x7F, 0xDF, 0x07, 0xC7, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
+  0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0xF8, 0xFF,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x03, 0xF0, 0x1F, 0x00, 0xF8,
+  0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xF8, 0x00, 0x1F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF7, 0xFF, 0xEF, 0x81, 0xDF,
+  0x80, 0xBF, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0xFC, 0x01,
+  0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x0F, 0xE0, 0x1F, 0x00,
+  0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x0F,
+  0xE0, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF,
+  0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03,
+  0xFF, 0x03, 0xFF, 0xC3, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F,
+  0x8F, 0x80, 0xFC, 0x07, 0xEF, 0x80, 0xF9, 0xF0, 0x1F, 0x3F, 0x07, 0xE3,
+  0xE0, 0xF8, 0x7C, 0x3F, 0x07, 0xC7, 0xE0, 0xF8, 0xF8, 0x1F, 0xBF, 0x01,
+  0xF7, 0xC0, 0x3E, 0xF8, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00,
+  0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0xF8, 0x1E, 0x07, 0xFF, 0x0F,
+  0xC3, 0xF7, 0xC3, 0xF0, 0xF9, 0xF0, 0xFC, 0x3E, 0x7C, 0x3F, 0x0F, 0x9F,
+  0x9F, 0xE7, 0xE3, 0xE7, 0x39, 0xF0, 0xF9, 0xCE, 0x7C, 0x3E, 0x73, 0x9F,
+  0x0F, 0xFC, 0xFF, 0xC1, 0xFE, 0x1F, 0xE0, 0x7F, 0x87, 0xF8, 0x1F, 0xE1,
+  0xFE, 0x07, 0xF8, 0x7F, 0x80, 0xFC, 0x0F, 0xC0, 0x3F, 0x03, 0xF0, 0x0F,
+  0xC0, 0xFC, 0x00, 0xFE, 0x0F, 0xEF, 0xC1, 0xF8, 0xFC, 0x7E, 0x0F, 0xDF,
+  0x81, 0xFF, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8,
+  0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x07, 0xFF, 0x01, 0xFB, 0xF0, 0x3F, 0x7E,
+  0x0F, 0xC7, 0xE3, 0xF0, 0x7E, 0xFE, 0x0F, 0xE0, 0xFC, 0x07, 0xEF, 0x80,
+  0xF9, 0xF0, 0x1F, 0x3F, 0x07, 0xE3, 0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0xC7,
+  0xE0, 0xFC, 0xF8, 0x0F, 0xBF, 0x01, 0xF7, 0xC0, 0x3F, 0xF8, 0x03, 0xFF,
+  0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8,
+  0x00, 0x3E, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xF0, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x0F, 0xC0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
+  0xFE, 0x01, 0xF8, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1, 0xF8, 0x07, 0xC0, 0x1F, 0x00,
+  0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x03, 0xF0, 0x0F, 0xC3,
+  0xFE, 0x0F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0x7C, 0x01, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x80, 0x3F,
+  0xC0, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x03, 0xFC, 0x0F,
+  0xF0, 0x07, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
+  0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0xF0, 0x1F, 0xC1, 0xFF,
+  0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
+  0x03, 0xE0, 0x0F, 0x80, 0x7E, 0x0F, 0xF0, 0x3F, 0xC0, 0xFC, 0x00, 0x1F,
+  0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x00,
+  0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x0E, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x07, 0xE0, 0x7F, 0xE3, 0xFF,
+  0xDF, 0xFF, 0x7F, 0x9F, 0xF6, 0x1F, 0x98, 0x3E, 0x60, 0xF9, 0x83, 0xE6,
+  0x0F, 0x98, 0x3F, 0x61, 0x7F, 0x8D, 0xFF, 0xF3, 0xFF, 0xC7, 0xFE, 0x07,
+  0xE0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x01, 0xF8,
+  0x07, 0xFE, 0x0F, 0xFF, 0x0F, 0xFF, 0x1F, 0x83, 0x1F, 0x81, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC,
+  0xFF, 0xFC, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x03, 0x38, 0x03,
+  0xFE, 0xFB, 0xEF, 0xFF, 0xE3, 0xFF, 0xE0, 0xF1, 0xE0, 0xF0, 0x78, 0x70,
+  0x1C, 0x38, 0x0E, 0x1C, 0x07, 0x0F, 0x07, 0x83, 0xC7, 0x83, 0xFF, 0xE3,
+  0xFF, 0xFB, 0xEF, 0xBF, 0xE0, 0x0E, 0x20, 0x02, 0x00, 0xFC, 0x01, 0xFB,
+  0xF0, 0x1F, 0x8F, 0x80, 0xF8, 0x7E, 0x0F, 0xC1, 0xF8, 0xFC, 0x0F, 0xC7,
+  0xE0, 0x3F, 0x7E, 0x00, 0xFB, 0xE0, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0x9F,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x7C, 0x01, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE3, 0xE0, 0xC7, 0xC0, 0x0F, 0xC0, 0x0F,
+  0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0xFF, 0xF9, 0xE7, 0xF7, 0x83, 0xFF, 0x01,
+  0xFE, 0x03, 0xFE, 0x07, 0xBF, 0x1E, 0x7F, 0xFC, 0x7F, 0xF0, 0x3F, 0xC0,
+  0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0x8C, 0x1F, 0x1F, 0xFC, 0x3F, 0xF8, 0x3F,
+  0xC0, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x00, 0xFC, 0x00, 0x1F, 0xFE, 0x00,
+  0xF0, 0x3C, 0x07, 0x00, 0x38, 0x38, 0x00, 0x71, 0xC1, 0xF8, 0xE6, 0x1F,
+  0xE1, 0x98, 0xFF, 0x86, 0xC7, 0x82, 0x0F, 0x1C, 0x00, 0x3C, 0x70, 0x00,
+  0xF1, 0xC0, 0x03, 0xC7, 0x00, 0x0F, 0x1E, 0x08, 0x36, 0x3F, 0xE1, 0x98,
+  0x7F, 0x86, 0x70, 0xFC, 0x38, 0xE0, 0x01, 0xC1, 0xC0, 0x0E, 0x03, 0xC0,
+  0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xC3, 0xFF, 0x9F, 0xFC,
+  0x81, 0xF1, 0xFF, 0xBF, 0xFF, 0xE1, 0xFE, 0x1F, 0xF0, 0xFF, 0xFF, 0xDF,
+  0xDE, 0x7C, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02,
+  0x04, 0x18, 0x30, 0xE1, 0xC7, 0x8F, 0x7C, 0xFB, 0xE7, 0xCF, 0x1C, 0x3C,
+  0x70, 0xF9, 0xF1, 0xF3, 0xE1, 0xE3, 0xC3, 0x87, 0x06, 0x0C, 0x08, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1E,
+  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xF0, 0x3C, 0x07,
+  0x00, 0x38, 0x38, 0x00, 0x71, 0xC7, 0xF0, 0xE6, 0x1F, 0xE1, 0x98, 0x71,
+  0xC6, 0xC1, 0xC7, 0x0F, 0x07, 0x3C, 0x3C, 0x1F, 0xE0, 0xF0, 0x7F, 0x03,
+  0xC1, 0xDC, 0x0F, 0x07, 0x38, 0x36, 0x1C, 0xF1, 0x98, 0x71, 0xC6, 0x71,
+  0xC7, 0xB8, 0xE0, 0x01, 0xC1, 0xC0, 0x0E, 0x03, 0xC0, 0xF0, 0x07, 0xFF,
+  0x80, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0x1F, 0xE6, 0x1B,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x7F, 0x87, 0x80, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x3F, 0xEC,
+  0x3C, 0x07, 0x01, 0xC0, 0xF0, 0x78, 0x3C, 0x1E, 0x1F, 0x0F, 0x83, 0xFF,
+  0xFF, 0xC0, 0xFF, 0x9F, 0xFB, 0x07, 0x80, 0x70, 0x1E, 0x7F, 0x8F, 0xF0,
+  0x0F, 0x00, 0xE0, 0x1E, 0x07, 0xFF, 0xE7, 0xF0, 0x0F, 0x8F, 0x87, 0x87,
+  0x87, 0x87, 0x80, 0xF8, 0x0F, 0x9F, 0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x07,
+  0xCF, 0x80, 0xF9, 0xF0, 0x1F, 0x3E, 0x03, 0xE7, 0xC0, 0x7C, 0xF8, 0x0F,
+  0x9F, 0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x07, 0xCF, 0xC1, 0xF9, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xE3, 0xFF, 0x00, 0x03, 0xE0, 0x00,
+  0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
+  0x0F, 0xFE, 0x7F, 0xFD, 0xFE, 0x3B, 0xFC, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF,
+  0xE3, 0xFF, 0xC7, 0xFF, 0x8E, 0xFF, 0x1D, 0xFE, 0x39, 0xFC, 0x70, 0xF8,
+  0xE0, 0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x07, 0x1C, 0x0E, 0x38,
+  0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x07,
+  0x1C, 0xFF, 0xFF, 0xFF, 0xFC, 0x0C, 0x0C, 0x18, 0x3F, 0xFF, 0x80, 0x7C,
+  0x7E, 0x37, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x1F,
+  0xFF, 0xF8, 0x0F, 0xC0, 0xFF, 0xC7, 0xFF, 0xBE, 0x1F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x7D, 0xFF, 0xE3, 0xFF, 0x03, 0xF0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x9F, 0xFE, 0x7F, 0xF8, 0x81, 0x03, 0x06, 0x0E,
+  0x1C, 0x3C, 0x78, 0x7C, 0xF8, 0xF9, 0xF0, 0xE3, 0xC3, 0x8F, 0x3E, 0x7D,
+  0xF3, 0xEF, 0x1E, 0x38, 0x70, 0xC1, 0x82, 0x04, 0x00, 0x7C, 0x00, 0x0F,
+  0x1F, 0x80, 0x03, 0xC3, 0x70, 0x00, 0x70, 0x0E, 0x00, 0x1E, 0x01, 0xC0,
+  0x03, 0x80, 0x38, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x07, 0x00,
+  0x1C, 0x01, 0xE0, 0x03, 0x80, 0x78, 0x00, 0x70, 0x0E, 0x1E, 0x7F, 0xC3,
+  0xC3, 0xCF, 0xF8, 0x70, 0xF8, 0x00, 0x1E, 0x3F, 0x00, 0x07, 0x8E, 0xE0,
+  0x00, 0xE1, 0x9C, 0x00, 0x3C, 0x63, 0x80, 0x0F, 0x1C, 0x70, 0x01, 0xC3,
+  0xFF, 0x80, 0x78, 0x7F, 0xF0, 0x0E, 0x00, 0x38, 0x03, 0xC0, 0x07, 0x00,
+  0xF0, 0x00, 0xE0, 0x7C, 0x00, 0x0F, 0x07, 0xE0, 0x00, 0xF0, 0x37, 0x00,
+  0x07, 0x00, 0x38, 0x00, 0x78, 0x01, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x3C,
+  0x00, 0x70, 0x03, 0xC0, 0x03, 0x80, 0x1C, 0x00, 0x1C, 0x01, 0xE0, 0x00,
+  0xE0, 0x1E, 0x00, 0x07, 0x00, 0xE3, 0xF9, 0xFF, 0x0F, 0x3F, 0xEF, 0xF8,
+  0x71, 0x87, 0x80, 0x07, 0x80, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x03, 0x80,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0xF0,
+  0x01, 0xE0, 0x1F, 0x00, 0x0E, 0x01, 0xF0, 0x00, 0xF0, 0x0F, 0xFC, 0x0F,
+  0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x07, 0x8F, 0xFC, 0x00, 0xF0, 0xC1, 0xE0,
+  0x0E, 0x00, 0x0E, 0x01, 0xE0, 0x01, 0xE0, 0x1C, 0x03, 0xFC, 0x03, 0xC0,
+  0x3F, 0xC0, 0x78, 0x00, 0x1E, 0x07, 0x00, 0x00, 0xE0, 0xF0, 0x00, 0x0E,
+  0x1E, 0x00, 0x81, 0xE1, 0xC3, 0xCF, 0xFC, 0x3C, 0x3C, 0x7F, 0x03, 0x87,
+  0xC0, 0x00, 0x78, 0xFC, 0x00, 0x0F, 0x1D, 0xC0, 0x00, 0xE1, 0x9C, 0x00,
+  0x1E, 0x31, 0xC0, 0x03, 0xC7, 0x1C, 0x00, 0x38, 0x7F, 0xF0, 0x07, 0x87,
+  0xFF, 0x00, 0x70, 0x01, 0xC0, 0x0F, 0x00, 0x1C, 0x01, 0xE0, 0x01, 0xC0,
+  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x80, 0x7C, 0x03, 0xF0, 0x3F, 0x80, 0xFC,
+  0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x7F, 0x07, 0x7F,
+  0xFD, 0xFF, 0xF3, 0xFF, 0xC3, 0xFC, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80,
+  0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0,
+  0x07, 0xE7, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0,
+  0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7E, 0x00, 0x7E,
+  0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0x00, 0x0E, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0,
+  0x03, 0xE7, 0xC0, 0x07, 0xE7, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0,
+  0x0F, 0xC3, 0xF0, 0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
+  0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F,
+  0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xE7, 0x00, 0x01, 0xC3, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0,
+  0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x07, 0xE7, 0xE0, 0x07, 0xC3, 0xE0,
+  0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8,
+  0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFC, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E,
+  0xFC, 0x00, 0x3F, 0x00, 0xE0, 0xC0, 0x01, 0xF9, 0xC0, 0x03, 0x9F, 0x80,
+  0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x07, 0xE7, 0xE0,
+  0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0x81, 0xF0,
+  0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E,
+  0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0x01, 0xE7, 0x80, 0x01, 0xE7, 0x80,
+  0x01, 0xE7, 0x80, 0x01, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80,
+  0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0,
+  0x07, 0xE7, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0,
+  0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7E, 0x00, 0x7E,
+  0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0x00, 0x3C, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3, 0x00,
+  0x00, 0xE7, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0,
+  0x03, 0xE7, 0xC0, 0x07, 0xE7, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0,
+  0x0F, 0xC3, 0xF0, 0x0F, 0x81, 0xF0, 0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
+  0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0xFC, 0x00, 0x3F,
+  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8,
+  0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0x9F, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
+  0x7C, 0x7C, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0F,
+  0xC3, 0xFF, 0xF8, 0x1F, 0x07, 0xFF, 0xF0, 0x3E, 0x0F, 0xFF, 0xE0, 0xFC,
+  0x1F, 0xFF, 0xC1, 0xF0, 0x3E, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
+  0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xF8, 0x07,
+  0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xF7, 0xC0, 0x1F, 0xFF, 0xEF, 0x80, 0x3F,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0xFC, 0x3F,
+  0xFF, 0x8F, 0xFF, 0xF3, 0xF8, 0x0E, 0xFC, 0x00, 0x5F, 0x00, 0x03, 0xE0,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0,
+  0x04, 0xFE, 0x03, 0x8F, 0xFF, 0xF0, 0xFF, 0xFE, 0x0F, 0xFF, 0xC0, 0x3F,
+  0xC0, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x7F,
+  0x00, 0x0F, 0xC0, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF,
+  0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
+  0xFE, 0xFF, 0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+  0xC0, 0x0F, 0xE0, 0x1C, 0x70, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
+  0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xF0, 0x3C,
+  0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x38, 0x1C, 0x0E, 0x00,
+  0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1C, 0x71, 0xC7, 0x00, 0x00, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F,
+  0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7,
+  0xCF, 0x80, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x70, 0x00, 0x00, 0x07, 0xC0,
+  0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8,
+  0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F,
+  0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0xF7, 0xFB, 0xFD, 0xFE, 0xF0, 0x00,
+  0x00, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C,
+  0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F,
+  0x87, 0xC3, 0xE0, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xF8, 0x1F, 0x03, 0xFC, 0x1F, 0x00, 0xFE, 0x1F, 0x00, 0x7E,
+  0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x3F,
+  0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x7E, 0x1F, 0x00, 0xFE, 0x1F, 0x03, 0xFC,
+  0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00,
+  0x07, 0x86, 0x00, 0xFC, 0x60, 0x0C, 0xFE, 0x00, 0xC3, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xFF, 0xF0,
+  0x1F, 0xFF, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xC1, 0xFF, 0xBC, 0x1F, 0xFB,
+  0xE1, 0xFF, 0x9E, 0x1F, 0xF9, 0xF1, 0xFF, 0x8F, 0x1F, 0xF8, 0xF9, 0xFF,
+  0x87, 0x9F, 0xF8, 0x7D, 0xFF, 0x83, 0xDF, 0xF8, 0x3F, 0xFF, 0x81, 0xFF,
+  0xF8, 0x1F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x7F, 0xF8, 0x03,
+  0xF0, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE, 0x0F, 0xE3, 0xF0, 0x07, 0xE7,
+  0xC0, 0x07, 0xDF, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x0F, 0x9F, 0x00, 0x1F, 0x3F, 0x00, 0x7E, 0x3F, 0x83,
+  0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE, 0x0F, 0xE3, 0xF0, 0x07, 0xE7,
+  0xC0, 0x07, 0xDF, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x0F, 0x9F, 0x00, 0x1F, 0x3F, 0x00, 0x7E, 0x3F, 0x83,
+  0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0x1C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE, 0x0F, 0xE3, 0xF0, 0x07, 0xE7,
+  0xC0, 0x07, 0xDF, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x0F, 0x9F, 0x00, 0x1F, 0x3F, 0x00, 0x7E, 0x3F, 0x83,
+  0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0x01, 0xE1, 0x80, 0x07, 0xE3, 0x00, 0x0C, 0xFC, 0x00, 0x18, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE, 0x0F, 0xE3, 0xF0, 0x07, 0xE7,
+  0xC0, 0x07, 0xDF, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x0F, 0x9F, 0x00, 0x1F, 0x3F, 0x00, 0x7E, 0x3F, 0x83,
+  0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0x01, 0xEF, 0x00, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE, 0x0F, 0xE3, 0xF0, 0x07, 0xE7,
+  0xC0, 0x07, 0xDF, 0x80, 0x0F, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x0F, 0x9F, 0x00, 0x1F, 0x3F, 0x00, 0x7E, 0x3F, 0x83,
+  0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0x20, 0x01, 0x1C, 0x00, 0xEF, 0x80, 0x7D, 0xF0, 0x3E, 0x3E, 0x1F,
+  0x07, 0xCF, 0x80, 0xFF, 0xC0, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x7F, 0x80, 0x3F, 0xF0, 0x1F, 0x3E, 0x0F, 0x87, 0xC7, 0xC0, 0xFB, 0xE0,
+  0x1F, 0x70, 0x03, 0x88, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1,
+  0x80, 0xFF, 0xFD, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFE, 0x0F,
+  0xE0, 0xFC, 0x01, 0xF8, 0x7C, 0x01, 0xFC, 0x3E, 0x01, 0xFF, 0x3E, 0x01,
+  0xEF, 0x9F, 0x01, 0xE7, 0xCF, 0x81, 0xE3, 0xE7, 0xC3, 0xC1, 0xF3, 0xE3,
+  0xC0, 0xF9, 0xF3, 0xC0, 0x7C, 0xFB, 0xC0, 0x3E, 0x7F, 0xC0, 0x3E, 0x1F,
+  0xC0, 0x1F, 0x0F, 0xC0, 0x1F, 0x83, 0xF8, 0x3F, 0x83, 0xFF, 0xFF, 0x81,
+  0xFF, 0xFF, 0x81, 0xDF, 0xFF, 0x81, 0xC1, 0xFE, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
+  0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
+  0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01,
+  0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x3F, 0x7E, 0x0F,
+  0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0F, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x38,
+  0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3E, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F,
+  0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
+  0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F,
+  0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x3F, 0x7E, 0x0F, 0xCF, 0xFF, 0xF8,
+  0xFF, 0xFE, 0x0F, 0xFF, 0x80, 0x7F, 0xC0, 0x01, 0xF0, 0x00, 0x7F, 0x00,
+  0x1C, 0x70, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFF,
+  0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF,
+  0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF,
+  0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE,
+  0x00, 0xFF, 0xE0, 0x3F, 0x7E, 0x0F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0F,
+  0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x3C, 0x78, 0x07,
+  0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
+  0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
+  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xE0,
+  0x3F, 0x7E, 0x0F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0F, 0xFF, 0x80, 0x7F,
+  0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xBF, 0x00, 0x7E,
+  0x3F, 0x01, 0xF8, 0x7E, 0x03, 0xF0, 0x7E, 0x0F, 0xC0, 0x7E, 0x3F, 0x00,
+  0xFC, 0x7E, 0x00, 0xFD, 0xF8, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x01,
+  0xFF, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07,
+  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xFF,
+  0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xE7, 0xFF, 0xFE, 0xF8, 0x0F, 0xDF, 0x00,
+  0xFF, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFE, 0x03,
+  0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0x9F, 0xFF, 0xE3, 0xFF, 0xF0, 0x7C, 0x00,
+  0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFF,
+  0x07, 0xFF, 0xE1, 0xFF, 0xF8, 0xFC, 0x3F, 0x3E, 0x07, 0xCF, 0x81, 0xF3,
+  0xE1, 0xFC, 0xF8, 0xF8, 0x3E, 0x7C, 0x0F, 0x9F, 0x03, 0xE7, 0xE0, 0xF9,
+  0xFC, 0x3E, 0x3F, 0xCF, 0x87, 0xFB, 0xE0, 0xFE, 0xF8, 0x0F, 0xFE, 0x01,
+  0xFF, 0x80, 0x7F, 0xE4, 0x3F, 0xF9, 0xFF, 0xFE, 0x7F, 0xEF, 0x9F, 0xF3,
+  0xE3, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E,
+  0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F,
+  0xFF, 0xCF, 0xFF, 0xE6, 0x01, 0xF8, 0x00, 0x7C, 0x3F, 0xFE, 0x7F, 0xFF,
+  0x7F, 0xFF, 0xFE, 0x07, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x0F,
+  0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0xE6, 0x01, 0xF8,
+  0x00, 0x7C, 0x3F, 0xFE, 0x7F, 0xFF, 0x7F, 0xFF, 0xFE, 0x07, 0xFE, 0x03,
+  0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F,
+  0x8F, 0x80, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xEE, 0x00, 0x77, 0x00, 0x71,
+  0xC0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F,
+  0xFF, 0xCF, 0xFF, 0xE6, 0x01, 0xF8, 0x00, 0x7C, 0x3F, 0xFE, 0x7F, 0xFF,
+  0x7F, 0xFF, 0xFE, 0x07, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F, 0x8F, 0x80, 0x07, 0x0C, 0x07, 0xE6,
+  0x03, 0x3F, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0xE6, 0x01, 0xF8,
+  0x00, 0x7C, 0x3F, 0xFE, 0x7F, 0xFF, 0x7F, 0xFF, 0xFE, 0x07, 0xFE, 0x03,
+  0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F,
+  0x8F, 0x80, 0x07, 0x9E, 0x03, 0xCF, 0x01, 0xE7, 0x80, 0xF3, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFE, 0x3F, 0xFF, 0x9F,
+  0xFF, 0xCC, 0x03, 0xF0, 0x00, 0xF8, 0x7F, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFC, 0x0F, 0xFC, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xFC, 0xFF, 0xBE, 0x3F, 0x1F, 0x01, 0xF0, 0x01, 0xFC, 0x01, 0xC7, 0x00,
+  0xC1, 0x80, 0x60, 0xC0, 0x30, 0x60, 0x1C, 0x70, 0x07, 0xF0, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0xE3, 0xFF, 0xF9, 0xFF,
+  0xFC, 0xC0, 0x3F, 0x00, 0x0F, 0x87, 0xFF, 0xCF, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xCF, 0xFB, 0xE3, 0xF1, 0xF0, 0x1F, 0xF0, 0x3F, 0x81, 0xFF, 0xF3, 0xFF,
+  0x87, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFE, 0x60, 0x1F, 0xE1, 0xF8,
+  0x00, 0x3F, 0x01, 0xF0, 0xFF, 0xF8, 0x07, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x3E, 0x07,
+  0xF0, 0x02, 0xFC, 0x3F, 0xE0, 0x7B, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xBF,
+  0xFF, 0x8F, 0xFC, 0x7F, 0xFC, 0x1F, 0xC0, 0x7F, 0x80, 0x03, 0xF0, 0x1F,
+  0xF8, 0xFF, 0xFB, 0xFF, 0xF7, 0xE0, 0x7F, 0x80, 0x7E, 0x00, 0x7C, 0x00,
+  0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x17, 0xF0, 0x6F, 0xFF, 0xCF,
+  0xFF, 0x87, 0xFE, 0x03, 0xF0, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x01,
+  0x80, 0x7F, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00,
+  0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F, 0xBF, 0x01,
+  0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
+  0xF0, 0x02, 0x7E, 0x07, 0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0x03,
+  0xF8, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF,
+  0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F, 0xBF, 0x01, 0xFF, 0x80, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xF0, 0x02, 0x7E,
+  0x07, 0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0x03, 0xF8, 0x00, 0x01,
+  0xF0, 0x00, 0x7C, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x07, 0x1C, 0x03, 0x83,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1,
+  0xFF, 0xFE, 0x7E, 0x1F, 0xBF, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xF0, 0x02, 0x7E, 0x07, 0x9F, 0xFF,
+  0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0x9E, 0x01, 0xE7,
+  0x80, 0x79, 0xE0, 0x1E, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xE0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xF9, 0xF8, 0x7E, 0xFC,
+  0x07, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+  0x0F, 0xC0, 0x09, 0xF8, 0x1E, 0x7F, 0xFF, 0x8F, 0xFF, 0xE1, 0xFF, 0xF0,
+  0x0F, 0xE0, 0xF8, 0x3E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x00, 0x00, 0x0F,
+  0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1,
+  0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x80, 0x07, 0xC3, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
+  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
+  0xE0, 0xF8, 0x00, 0x1F, 0x03, 0xE0, 0xEE, 0x1D, 0xC7, 0x1D, 0xC1, 0xC0,
+  0x00, 0x00, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8,
+  0x1F, 0x00, 0xF7, 0xFB, 0xFD, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x3E,
+  0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87,
+  0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x0F, 0xC0, 0x80, 0xFC, 0xF0, 0x0F, 0xFC,
+  0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x7C, 0xFC, 0x04, 0x0F, 0x80, 0x00, 0xF8,
+  0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFF, 0x3F, 0xFF, 0xEF, 0xE0, 0x7F,
+  0xF8, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F,
+  0xF0, 0x1F, 0xBF, 0x07, 0xE7, 0xFF, 0xFC, 0x7F, 0xFF, 0x03, 0xFF, 0x80,
+  0x1F, 0xC0, 0x0F, 0x0C, 0x0F, 0xC6, 0x06, 0x7E, 0x03, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x7D, 0xFF, 0x3F,
+  0xFF, 0xDF, 0xFF, 0xEF, 0xE1, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F,
+  0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0,
+  0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0x80, 0x1F, 0x00, 0x01, 0xF0,
+  0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xE7, 0xE0, 0xFD, 0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xE0, 0xFC, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xE0, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xE7, 0xE0, 0xFD, 0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xE0, 0xFC, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xE0, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x3E,
+  0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x71, 0xC0, 0x1C, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xE7, 0xE0, 0xFD, 0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xE0, 0xFC, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xE0, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x07, 0x86, 0x01, 0xF8,
+  0xC0, 0x33, 0xF0, 0x06, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xE7, 0xE0, 0xFD, 0xF8, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xE0, 0xFC, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xE0, 0xFF, 0xF0, 0x03, 0xF8, 0x00, 0x0F, 0x1E, 0x01, 0xE3,
+  0xC0, 0x3C, 0x78, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xC0, 0x0F, 0xFE, 0x07, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0x07,
+  0xEF, 0xC0, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0xBF, 0x07, 0xE7, 0xFF, 0xFC, 0x7F, 0xFF,
+  0x07, 0xFF, 0x80, 0x1F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x00, 0x00, 0x40, 0x7F, 0x9C, 0x3F, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xFC,
+  0xFC, 0x1F, 0xBF, 0x07, 0xFF, 0xC1, 0xFF, 0xF8, 0x7B, 0xFF, 0x1C, 0x7F,
+  0xEF, 0x0F, 0xFF, 0xC1, 0xFF, 0xE0, 0x7E, 0xFC, 0x1F, 0x9F, 0xFF, 0xF1,
+  0xFF, 0xFC, 0x7F, 0xFE, 0x1C, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x00,
+  0x0F, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF,
+  0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07,
+  0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F,
+  0xDF, 0x1F, 0x8F, 0x80, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F,
+  0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3,
+  0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F, 0x8F, 0x80, 0x03, 0xE0,
+  0x01, 0xF0, 0x01, 0xDC, 0x00, 0xEE, 0x00, 0xE3, 0x80, 0xE0, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF,
+  0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07,
+  0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xC3, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F,
+  0xDF, 0x1F, 0x8F, 0x80, 0x1E, 0x3C, 0x0F, 0x1E, 0x07, 0x8F, 0x03, 0xC7,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0xF7, 0xFF,
+  0xFB, 0xFF, 0xFC, 0xFF, 0xBE, 0x3F, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFC, 0x07, 0xEF, 0x80, 0xF9, 0xF0, 0x1F, 0x3F, 0x07, 0xE3,
+  0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0xC7, 0xE0, 0xFC, 0xF8, 0x0F, 0xBF, 0x01,
+  0xF7, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00,
+  0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x01,
+  0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
+  0x0F, 0x80, 0x03, 0xE3, 0xE0, 0xFB, 0xFE, 0x3F, 0xFF, 0xCF, 0xFF, 0xFB,
+  0xF8, 0x7E, 0xFC, 0x0F, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8,
+  0x07, 0xFE, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xCF, 0xBF, 0xE3, 0xE3, 0xE0, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x9E, 0x00,
+  0xF3, 0xC0, 0x1E, 0x78, 0x03, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x3F, 0x7C, 0x07, 0xCF, 0x80, 0xF9, 0xF8, 0x3F, 0x1F,
+  0x07, 0xC3, 0xF0, 0xF8, 0x3E, 0x3F, 0x07, 0xE7, 0xC0, 0x7D, 0xF8, 0x0F,
+  0xBE, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
+  0xF8, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F,
+  0xC0, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans_Bold16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   5,  23,  14,    4,  -22 },   // 0x21 '!'
+  {    16,  11,   8,  16,    3,  -22 },   // 0x22 '"'
+  {    27,  22,  23,  26,    2,  -22 },   // 0x23 '#'
+  {    91,  17,  28,  22,    2,  -22 },   // 0x24 '$'
+  {   151,  29,  23,  31,    1,  -22 },   // 0x25 '%'
+  {   235,  24,  23,  27,    2,  -22 },   // 0x26 '&'
+  {   304,   4,   8,   9,    3,  -22 },   // 0x27 '''
+  {   308,   9,  28,  14,    3,  -23 },   // 0x28 '('
+  {   340,   9,  28,  14,    2,  -23 },   // 0x29 ')'
+  {   372,  15,  14,  16,    1,  -22 },   // 0x2A '*'
+  {   399,  20,  20,  26,    3,  -19 },   // 0x2B '+'
+  {   449,   7,  10,  12,    1,   -5 },   // 0x2C ','
+  {   458,  10,   4,  13,    2,  -11 },   // 0x2D '-'
+  {   463,   5,   6,  12,    3,   -5 },   // 0x2E '.'
+  {   467,  11,  25,  11,    0,  -22 },   // 0x2F '/'
+  {   502,  19,  23,  22,    1,  -22 },   // 0x30 '0'
+  {   557,  15,  23,  22,    4,  -22 },   // 0x31 '1'
+  {   601,  16,  23,  22,    2,  -22 },   // 0x32 '2'
+  {   647,  17,  23,  22,    2,  -22 },   // 0x33 '3'
+  {   696,  19,  23,  22,    1,  -22 },   // 0x34 '4'
+  {   751,  17,  23,  22,    2,  -22 },   // 0x35 '5'
+  {   800,  18,  23,  22,    2,  -22 },   // 0x36 '6'
+  {   852,  17,  23,  22,    2,  -22 },   // 0x37 '7'
+  {   901,  18,  23,  22,    2,  -22 },   // 0x38 '8'
+  {   953,  18,  23,  22,    2,  -22 },   // 0x39 '9'
+  {  1005,   5,  17,  12,    3,  -16 },   // 0x3A ':'
+  {  1016,   7,  21,  12,    1,  -16 },   // 0x3B ';'
+  {  1035,  19,  18,  26,    3,  -18 },   // 0x3C '<'
+  {  1078,  19,  11,  26,    3,  -14 },   // 0x3D '='
+  {  1105,  19,  18,  26,    3,  -18 },   // 0x3E '>'
+  {  1148,  14,  23,  18,    2,  -22 },   // 0x3F '?'
+  {  1189,  27,  27,  31,    2,  -22 },   // 0x40 '@'
+  {  1281,  24,  23,  24,    0,  -22 },   // 0x41 'A'
+  {  1350,  19,  23,  24,    3,  -22 },   // 0x42 'B'
+  {  1405,  19,  23,  23,    2,  -22 },   // 0x43 'C'
+  {  1460,  21,  23,  26,    3,  -22 },   // 0x44 'D'
+  {  1521,  16,  23,  21,    3,  -22 },   // 0x45 'E'
+  {  1567,  16,  23,  21,    3,  -22 },   // 0x46 'F'
+  {  1613,  22,  23,  25,    2,  -22 },   // 0x47 'G'
+  {  1677,  20,  23,  26,    3,  -22 },   // 0x48 'H'
+  {  1735,   5,  23,  12,    3,  -22 },   // 0x49 'I'
+  {  1750,  10,  29,  12,   -2,  -22 },   // 0x4A 'J'
+  {  1787,  22,  23,  24,    3,  -22 },   // 0x4B 'K'
+  {  1851,  16,  23,  20,    3,  -22 },   // 0x4C 'L'
+  {  1897,  25,  23,  31,    3,  -22 },   // 0x4D 'M'
+  {  1969,  20,  23,  26,    3,  -22 },   // 0x4E 'N'
+  {  2027,  23,  23,  26,    2,  -22 },   // 0x4F 'O'
+  {  2094,  19,  23,  23,    3,  -22 },   // 0x50 'P'
+  {  2149,  23,  28,  26,    2,  -22 },   // 0x51 'Q'
+  {  2230,  21,  23,  24,    3,  -22 },   // 0x52 'R'
+  {  2291,  18,  23,  22,    2,  -22 },   // 0x53 'S'
+  {  2343,  21,  23,  21,    0,  -22 },   // 0x54 'T'
+  {  2404,  19,  23,  25,    3,  -22 },   // 0x55 'U'
+  {  2459,  24,  23,  24,    0,  -22 },   // 0x56 'V'
+  {  2528,  32,  23,  34,    1,  -22 },   // 0x57 'W'
+  {  2620,  23,  23,  24,    1,  -22 },   // 0x58 'X'
+  {  2687,  23,  23,  22,   -1,  -22 },   // 0x59 'Y'
+  {  2754,  20,  23,  22,    1,  -22 },   // 0x5A 'Z'
+  {  2812,   9,  28,  14,    3,  -23 },   // 0x5B '['
+  {  2844,  11,  25,  11,    0,  -22 },   // 0x5C '\'
+  {  2879,   9,  28,  14,    2,  -23 },   // 0x5D ']'
+  {  2911,  20,   8,  26,    3,  -22 },   // 0x5E '^'
+  {  2931,  16,   3,  16,    0,    5 },   // 0x5F '_'
+  {  2937,   9,   6,  16,    1,  -24 },   // 0x60 '`'
+  {  2944,  17,  17,  21,    1,  -16 },   // 0x61 'a'
+  {  2981,  18,  24,  22,    3,  -23 },   // 0x62 'b'
+  {  3035,  15,  17,  18,    1,  -16 },   // 0x63 'c'
+  {  3067,  18,  24,  22,    1,  -23 },   // 0x64 'd'
+  {  3121,  18,  17,  21,    1,  -16 },   // 0x65 'e'
+  {  3160,  13,  24,  13,    0,  -23 },   // 0x66 'f'
+  {  3199,  18,  24,  22,    1,  -16 },   // 0x67 'g'
+  {  3253,  17,  24,  22,    3,  -23 },   // 0x68 'h'
+  {  3304,   5,  24,  11,    3,  -23 },   // 0x69 'i'
+  {  3319,   9,  31,  11,   -1,  -23 },   // 0x6A 'j'
+  {  3354,  19,  24,  21,    3,  -23 },   // 0x6B 'k'
+  {  3411,   5,  24,  11,    3,  -23 },   // 0x6C 'l'
+  {  3426,  27,  17,  32,    3,  -16 },   // 0x6D 'm'
+  {  3484,  17,  17,  22,    3,  -16 },   // 0x6E 'n'
+  {  3521,  19,  17,  21,    1,  -16 },   // 0x6F 'o'
+  {  3562,  18,  24,  22,    3,  -16 },   // 0x70 'p'
+  {  3616,  18,  24,  22,    1,  -16 },   // 0x71 'q'
+  {  3670,  13,  17,  15,    3,  -16 },   // 0x72 'r'
+  {  3698,  15,  17,  18,    2,  -16 },   // 0x73 's'
+  {  3730,  14,  22,  15,    0,  -21 },   // 0x74 't'
+  {  3769,  17,  17,  22,    3,  -16 },   // 0x75 'u'
+  {  3806,  19,  17,  20,    0,  -16 },   // 0x76 'v'
+  {  3847,  26,  17,  29,    1,  -16 },   // 0x77 'w'
+  {  3903,  19,  17,  20,    0,  -16 },   // 0x78 'x'
+  {  3944,  19,  24,  20,    0,  -16 },   // 0x79 'y'
+  {  4001,  15,  17,  18,    1,  -16 },   // 0x7A 'z'
+  {  4033,  14,  29,  22,    4,  -23 },   // 0x7B '{'
+  {  4084,   4,  31,  11,    4,  -23 },   // 0x7C '|'
+  {  4100,  14,  29,  22,    4,  -23 },   // 0x7D '}'
+  {  4151,  19,   6,  26,    3,  -12 },   // 0x7E '~'
+  {  4166,  16,  27,  19,    2,  -21 },   // 0x7F
+  {  4220,  16,  27,  19,    2,  -21 },   // 0x80
+  {  4274,  16,  27,  19,    2,  -21 },   // 0x81
+  {  4328,  16,  27,  19,    2,  -21 },   // 0x82
+  {  4382,  16,  27,  19,    2,  -21 },   // 0x83
+  {  4436,  16,  27,  19,    2,  -21 },   // 0x84
+  {  4490,  16,  27,  19,    2,  -21 },   // 0x85
+  {  4544,  16,  27,  19,    2,  -21 },   // 0x86
+  {  4598,  16,  27,  19,    2,  -21 },   // 0x87
+  {  4652,  16,  27,  19,    2,  -21 },   // 0x88
+  {  4706,  16,  27,  19,    2,  -21 },   // 0x89
+  {  4760,  16,  27,  19,    2,  -21 },   // 0x8A
+  {  4814,  16,  27,  19,    2,  -21 },   // 0x8B
+  {  4868,  16,  27,  19,    2,  -21 },   // 0x8C
+  {  4922,  16,  27,  19,    2,  -21 },   // 0x8D
+  {  4976,  16,  27,  19,    2,  -21 },   // 0x8E
+  {  5030,  16,  27,  19,    2,  -21 },   // 0x8F
+  {  5084,  16,  27,  19,    2,  -21 },   // 0x90
+  {  5138,  16,  27,  19,    2,  -21 },   // 0x91
+  {  5192,  16,  27,  19,    2,  -21 },   // 0x92
+  {  5246,  16,  27,  19,    2,  -21 },   // 0x93
+  {  5300,  16,  27,  19,    2,  -21 },   // 0x94
+  {  5354,  16,  27,  19,    2,  -21 },   // 0x95
+  {  5408,  16,  27,  19,    2,  -21 },   // 0x96
+  {  5462,  16,  27,  19,    2,  -21 },   // 0x97
+  {  5516,  16,  27,  19,    2,  -21 },   // 0x98
+  {  5570,  16,  27,  19,    2,  -21 },   // 0x99
+  {  5624,  16,  27,  19,    2,  -21 },   // 0x9A
+  {  5678,  16,  27,  19,    2,  -21 },   // 0x9B
+  {  5732,  16,  27,  19,    2,  -21 },   // 0x9C
+  {  5786,  16,  27,  19,    2,  -21 },   // 0x9D
+  {  5840,  16,  27,  19,    2,  -21 },   // 0x9E
+  {  5894,  16,  27,  19,    2,  -21 },   // 0x9F
+  {  5948,   1,   1,  11,    0,    0 },   // 0xA0
+  {  5949,   5,  23,  14,    4,  -16 },   // 0xA1
+  {  5964,  14,  26,  22,    3,  -20 },   // 0xA2
+  {  6010,  16,  23,  22,    2,  -22 },   // 0xA3
+  {  6056,  17,  17,  20,    1,  -17 },   // 0xA4
+  {  6093,  21,  23,  22,    0,  -22 },   // 0xA5
+  {  6154,   4,  27,  11,    4,  -21 },   // 0xA6
+  {  6168,  15,  26,  16,    1,  -22 },   // 0xA7
+  {  6217,  10,   4,  16,    3,  -23 },   // 0xA8
+  {  6222,  22,  22,  31,    4,  -21 },   // 0xA9
+  {  6283,  13,  17,  17,    2,  -22 },   // 0xAA
+  {  6311,  14,  14,  20,    2,  -15 },   // 0xAB
+  {  6336,  19,   9,  26,    3,  -13 },   // 0xAC
+  {  6358,  10,   4,  13,    2,  -11 },   // 0xAD
+  {  6363,  22,  22,  31,    4,  -21 },   // 0xAE
+  {  6424,  10,   3,  16,    3,  -23 },   // 0xAF
+  {  6428,  10,  10,  16,    3,  -22 },   // 0xB0
+  {  6441,  20,  19,  26,    3,  -18 },   // 0xB1
+  {  6489,  10,  13,  14,    2,  -22 },   // 0xB2
+  {  6506,  11,  13,  14,    1,  -22 },   // 0xB3
+  {  6524,   9,   6,  16,    6,  -24 },   // 0xB4
+  {  6531,  19,  24,  23,    3,  -16 },   // 0xB5
+  {  6588,  15,  26,  20,    2,  -22 },   // 0xB6
+  {  6637,   5,   6,  12,    3,  -13 },   // 0xB7
+  {  6641,   7,   6,  16,    4,    1 },   // 0xB8
+  {  6647,   9,  13,  14,    2,  -22 },   // 0xB9
+  {  6662,  14,  17,  17,    2,  -22 },   // 0xBA
+  {  6692,  14,  14,  20,    3,  -15 },   // 0xBB
+  {  6717,  27,  23,  32,    2,  -22 },   // 0xBC
+  {  6795,  29,  23,  32,    2,  -22 },   // 0xBD
+  {  6879,  28,  23,  32,    1,  -22 },   // 0xBE
+  {  6960,  14,  24,  18,    2,  -16 },   // 0xBF
+  {  7002,  24,  29,  24,    0,  -28 },   // 0xC0
+  {  7089,  24,  29,  24,    0,  -28 },   // 0xC1
+  {  7176,  24,  29,  24,    0,  -28 },   // 0xC2
+  {  7263,  24,  29,  24,    0,  -28 },   // 0xC3
+  {  7350,  24,  29,  24,    0,  -28 },   // 0xC4
+  {  7437,  24,  29,  24,    0,  -28 },   // 0xC5
+  {  7524,  31,  23,  34,    0,  -22 },   // 0xC6
+  {  7614,  19,  29,  23,    2,  -22 },   // 0xC7
+  {  7683,  16,  29,  21,    3,  -28 },   // 0xC8
+  {  7741,  16,  29,  21,    3,  -28 },   // 0xC9
+  {  7799,  16,  29,  21,    3,  -28 },   // 0xCA
+  {  7857,  16,  29,  21,    3,  -28 },   // 0xCB
+  {  7915,   8,  29,  12,    0,  -28 },   // 0xCC
+  {  7944,   7,  29,  12,    3,  -28 },   // 0xCD
+  {  7970,  11,  29,  12,    0,  -28 },   // 0xCE
+  {  8010,   9,  29,  12,    1,  -28 },   // 0xCF
+  {  8043,  24,  23,  26,    0,  -22 },   // 0xD0
+  {  8112,  20,  29,  26,    3,  -28 },   // 0xD1
+  {  8185,  23,  29,  26,    2,  -28 },   // 0xD2
+  {  8269,  23,  29,  26,    2,  -28 },   // 0xD3
+  {  8353,  23,  29,  26,    2,  -28 },   // 0xD4
+  {  8437,  23,  29,  26,    2,  -28 },   // 0xD5
+  {  8521,  23,  29,  26,    2,  -28 },   // 0xD6
+  {  8605,  18,  18,  26,    4,  -18 },   // 0xD7
+  {  8646,  25,  25,  26,    1,  -23 },   // 0xD8
+  {  8725,  19,  29,  25,    3,  -28 },   // 0xD9
+  {  8794,  19,  29,  25,    3,  -28 },   // 0xDA
+  {  8863,  19,  29,  25,    3,  -28 },   // 0xDB
+  {  8932,  19,  29,  25,    3,  -28 },   // 0xDC
+  {  9001,  23,  29,  22,   -1,  -28 },   // 0xDD
+  {  9085,  19,  23,  23,    3,  -22 },   // 0xDE
+  {  9140,  18,  24,  22,    3,  -23 },   // 0xDF
+  {  9194,  17,  25,  21,    1,  -24 },   // 0xE0
+  {  9248,  17,  25,  21,    1,  -24 },   // 0xE1
+  {  9302,  17,  25,  21,    1,  -24 },   // 0xE2
+  {  9356,  17,  25,  21,    1,  -24 },   // 0xE3
+  {  9410,  17,  24,  21,    1,  -23 },   // 0xE4
+  {  9461,  17,  28,  21,    1,  -27 },   // 0xE5
+  {  9521,  30,  17,  32,    1,  -16 },   // 0xE6
+  {  9585,  15,  23,  18,    1,  -16 },   // 0xE7
+  {  9629,  18,  25,  21,    1,  -24 },   // 0xE8
+  {  9686,  18,  25,  21,    1,  -24 },   // 0xE9
+  {  9743,  18,  25,  21,    1,  -24 },   // 0xEA
+  {  9800,  18,  24,  21,    1,  -23 },   // 0xEB
+  {  9854,   9,  25,  11,   -1,  -24 },   // 0xEC
+  {  9883,  10,  25,  11,    3,  -24 },   // 0xED
+  {  9915,  11,  25,  11,    0,  -24 },   // 0xEE
+  {  9950,   9,  24,  11,    1,  -23 },   // 0xEF
+  {  9977,  19,  24,  21,    1,  -23 },   // 0xF0
+  { 10034,  17,  25,  22,    3,  -24 },   // 0xF1
+  { 10088,  19,  25,  21,    1,  -24 },   // 0xF2
+  { 10148,  19,  25,  21,    1,  -24 },   // 0xF3
+  { 10208,  19,  25,  21,    1,  -24 },   // 0xF4
+  { 10268,  19,  25,  21,    1,  -24 },   // 0xF5
+  { 10328,  19,  24,  21,    1,  -23 },   // 0xF6
+  { 10385,  19,  18,  26,    4,  -18 },   // 0xF7
+  { 10428,  19,  19,  21,    1,  -17 },   // 0xF8
+  { 10474,  17,  25,  22,    3,  -24 },   // 0xF9
+  { 10528,  17,  25,  22,    3,  -24 },   // 0xFA
+  { 10582,  17,  25,  22,    3,  -24 },   // 0xFB
+  { 10636,  17,  24,  22,    3,  -23 },   // 0xFC
+  { 10687,  19,  32,  20,    0,  -24 },   // 0xFD
+  { 10763,  18,  31,  22,    3,  -23 },   // 0xFE
+  { 10833,  19,  31,  20,    0,  -23 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold16pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold16pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold16pt8bGlyphs,
+  0x20, 0xFF, 36 };
+
+// Approx. 12482 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold16pt8bMetrics[] PROGMEM = {
+  {   0,  11,   1 },   // 0x20
+  {   4,  14,   9 },   // 0x21
+  {   3,  16,  14 },   // 0x22
+  {   2,  26,  24 },   // 0x23
+  {   2,  22,  19 },   // 0x24
+  {   1,  31,  30 },   // 0x25
+  {   2,  27,  26 },   // 0x26
+  {   3,   9,   7 },   // 0x27
+  {   3,  14,  12 },   // 0x28
+  {   2,  14,  11 },   // 0x29
+  {   1,  16,  16 },   // 0x2A
+  {   3,  26,  23 },   // 0x2B
+  {   1,  12,   8 },   // 0x2C
+  {   2,  13,  12 },   // 0x2D
+  {   3,  12,   8 },   // 0x2E
+  {   0,  11,  11 },   // 0x2F
+  {   1,  22,  20 },   // 0x30
+  {   4,  22,  19 },   // 0x31
+  {   2,  22,  18 },   // 0x32
+  {   2,  22,  19 },   // 0x33
+  {   1,  22,  20 },   // 0x34
+  {   2,  22,  19 },   // 0x35
+  {   2,  22,  20 },   // 0x36
+  {   2,  22,  19 },   // 0x37
+  {   2,  22,  20 },   // 0x38
+  {   2,  22,  20 },   // 0x39
+  {   3,  12,   8 },   // 0x3A
+  {   1,  12,   8 },   // 0x3B
+  {   3,  26,  22 },   // 0x3C
+  {   3,  26,  22 },   // 0x3D
+  {   3,  26,  22 },   // 0x3E
+  {   2,  18,  16 },   // 0x3F
+  {   2,  31,  29 },   // 0x40
+  {   0,  24,  24 },   // 0x41
+  {   3,  24,  22 },   // 0x42
+  {   2,  23,  21 },   // 0x43
+  {   3,  26,  24 },   // 0x44
+  {   3,  21,  19 },   // 0x45
+  {   3,  21,  19 },   // 0x46
+  {   2,  25,  24 },   // 0x47
+  {   3,  26,  23 },   // 0x48
+  {   3,  12,   8 },   // 0x49
+  {  -2,  12,   8 },   // 0x4A
+  {   3,  24,  25 },   // 0x4B
+  {   3,  20,  19 },   // 0x4C
+  {   3,  31,  28 },   // 0x4D
+  {   3,  26,  23 },   // 0x4E
+  {   2,  26,  25 },   // 0x4F
+  {   3,  23,  22 },   // 0x50
+  {   2,  26,  25 },   // 0x51
+  {   3,  24,  24 },   // 0x52
+  {   2,  22,  20 },   // 0x53
+  {   0,  21,  21 },   // 0x54
+  {   3,  25,  22 },   // 0x55
+  {   0,  24,  24 },   // 0x56
+  {   1,  34,  33 },   // 0x57
+  {   1,  24,  24 },   // 0x58
+  {  -1,  22,  22 },   // 0x59
+  {   1,  22,  21 },   // 0x5A
+  {   3,  14,  12 },   // 0x5B
+  {   0,  11,  11 },   // 0x5C
+  {   2,  14,  11 },   // 0x5D
+  {   3,  26,  23 },   // 0x5E
+  {   0,  16,  16 },   // 0x5F
+  {   1,  16,  10 },   // 0x60
+  {   1,  21,  18 },   // 0x61
+  {   3,  22,  21 },   // 0x62
+  {   1,  18,  16 },   // 0x63
+  {   1,  22,  19 },   // 0x64
+  {   1,  21,  19 },   // 0x65
+  {   0,  13,  13 },   // 0x66
+  {   1,  22,  19 },   // 0x67
+  {   3,  22,  20 },   // 0x68
+  {   3,  11,   8 },   // 0x69
+  {  -1,  11,   8 },   // 0x6A
+  {   3,  21,  22 },   // 0x6B
+  {   3,  11,   8 },   // 0x6C
+  {   3,  32,  30 },   // 0x6D
+  {   3,  22,  20 },   // 0x6E
+  {   1,  21,  20 },   // 0x6F
+  {   3,  22,  21 },   // 0x70
+  {   1,  22,  19 },   // 0x71
+  {   3,  15,  16 },   // 0x72
+  {   2,  18,  17 },   // 0x73
+  {   0,  15,  14 },   // 0x74
+  {   3,  22,  20 },   // 0x75
+  {   0,  20,  19 },   // 0x76
+  {   1,  29,  27 },   // 0x77
+  {   0,  20,  19 },   // 0x78
+  {   0,  20,  19 },   // 0x79
+  {   1,  18,  16 },   // 0x7A
+  {   4,  22,  18 },   // 0x7B
+  {   4,  11,   8 },   // 0x7C
+  {   4,  22,  18 },   // 0x7D
+  {   3,  26,  22 },   // 0x7E
+  {   2,  19,  18 },   // 0x7F
+  {   2,  19,  18 },   // 0x80
+  {   2,  19,  18 },   // 0x81
+  {   2,  19,  18 },   // 0x82
+  {   2,  19,  18 },   // 0x83
+  {   2,  19,  18 },   // 0x84
+  {   2,  19,  18 },   // 0x85
+  {   2,  19,  18 },   // 0x86
+  {   2,  19,  18 },   // 0x87
+  {   2,  19,  18 },   // 0x88
+  {   2,  19,  18 },   // 0x89
+  {   2,  19,  18 },   // 0x8A
+  {   2,  19,  18 },   // 0x8B
+  {   2,  19,  18 },   // 0x8C
+  {   2,  19,  18 },   // 0x8D
+  {   2,  19,  18 },   // 0x8E
+  {   2,  19,  18 },   // 0x8F
+  {   2,  19,  18 },   // 0x90
+  {   2,  19,  18 },   // 0x91
+  {   2,  19,  18 },   // 0x92
+  {   2,  19,  18 },   // 0x93
+  {   2,  19,  18 },   // 0x94
+  {   2,  19,  18 },   // 0x95
+  {   2,  19,  18 },   // 0x96
+  {   2,  19,  18 },   // 0x97
+  {   2,  19,  18 },   // 0x98
+  {   2,  19,  18 },   // 0x99
+  {   2,  19,  18 },   // 0x9A
+  {   2,  19,  18 },   // 0x9B
+  {   2,  19,  18 },   // 0x9C
+  {   2,  19,  18 },   // 0x9D
+  {   2,  19,  18 },   // 0x9E
+  {   2,  19,  18 },   // 0x9F
+  {   0,  11,   1 },   // 0xA0
+  {   4,  14,   9 },   // 0xA1
+  {   3,  22,  17 },   // 0xA2
+  {   2,  22,  18 },   // 0xA3
+  {   1,  20,  18 },   // 0xA4
+  {   0,  22,  21 },   // 0xA5
+  {   4,  11,   8 },   // 0xA6
+  {   1,  16,  16 },   // 0xA7
+  {   3,  16,  13 },   // 0xA8
+  {   4,  31,  26 },   // 0xA9
+  {   2,  17,  15 },   // 0xAA
+  {   2,  20,  16 },   // 0xAB
+  {   3,  26,  22 },   // 0xAC
+  {   2,  13,  12 },   // 0xAD
+  {   4,  31,  26 },   // 0xAE
+  {   3,  16,  13 },   // 0xAF
+  {   3,  16,  13 },   // 0xB0
+  {   3,  26,  23 },   // 0xB1
+  {   2,  14,  12 },   // 0xB2
+  {   1,  14,  12 },   // 0xB3
+  {   6,  16,  15 },   // 0xB4
+  {   3,  23,  22 },   // 0xB5
+  {   2,  20,  17 },   // 0xB6
+  {   3,  12,   8 },   // 0xB7
+  {   4,  16,  11 },   // 0xB8
+  {   2,  14,  11 },   // 0xB9
+  {   2,  17,  16 },   // 0xBA
+  {   3,  20,  17 },   // 0xBB
+  {   2,  32,  29 },   // 0xBC
+  {   2,  32,  31 },   // 0xBD
+  {   1,  32,  29 },   // 0xBE
+  {   2,  18,  16 },   // 0xBF
+  {   0,  24,  24 },   // 0xC0
+  {   0,  24,  24 },   // 0xC1
+  {   0,  24,  24 },   // 0xC2
+  {   0,  24,  24 },   // 0xC3
+  {   0,  24,  24 },   // 0xC4
+  {   0,  24,  24 },   // 0xC5
+  {   0,  34,  31 },   // 0xC6
+  {   2,  23,  21 },   // 0xC7
+  {   3,  21,  19 },   // 0xC8
+  {   3,  21,  19 },   // 0xC9
+  {   3,  21,  19 },   // 0xCA
+  {   3,  21,  19 },   // 0xCB
+  {   0,  12,   8 },   // 0xCC
+  {   3,  12,  10 },   // 0xCD
+  {   0,  12,  11 },   // 0xCE
+  {   1,  12,  10 },   // 0xCF
+  {   0,  26,  24 },   // 0xD0
+  {   3,  26,  23 },   // 0xD1
+  {   2,  26,  25 },   // 0xD2
+  {   2,  26,  25 },   // 0xD3
+  {   2,  26,  25 },   // 0xD4
+  {   2,  26,  25 },   // 0xD5
+  {   2,  26,  25 },   // 0xD6
+  {   4,  26,  22 },   // 0xD7
+  {   1,  26,  26 },   // 0xD8
+  {   3,  25,  22 },   // 0xD9
+  {   3,  25,  22 },   // 0xDA
+  {   3,  25,  22 },   // 0xDB
+  {   3,  25,  22 },   // 0xDC
+  {  -1,  22,  22 },   // 0xDD
+  {   3,  23,  22 },   // 0xDE
+  {   3,  22,  21 },   // 0xDF
+  {   1,  21,  18 },   // 0xE0
+  {   1,  21,  18 },   // 0xE1
+  {   1,  21,  18 },   // 0xE2
+  {   1,  21,  18 },   // 0xE3
+  {   1,  21,  18 },   // 0xE4
+  {   1,  21,  18 },   // 0xE5
+  {   1,  32,  31 },   // 0xE6
+  {   1,  18,  16 },   // 0xE7
+  {   1,  21,  19 },   // 0xE8
+  {   1,  21,  19 },   // 0xE9
+  {   1,  21,  19 },   // 0xEA
+  {   1,  21,  19 },   // 0xEB
+  {  -1,  11,   8 },   // 0xEC
+  {   3,  11,  13 },   // 0xED
+  {   0,  11,  11 },   // 0xEE
+  {   1,  11,  10 },   // 0xEF
+  {   1,  21,  20 },   // 0xF0
+  {   3,  22,  20 },   // 0xF1
+  {   1,  21,  20 },   // 0xF2
+  {   1,  21,  20 },   // 0xF3
+  {   1,  21,  20 },   // 0xF4
+  {   1,  21,  20 },   // 0xF5
+  {   1,  21,  20 },   // 0xF6
+  {   4,  26,  23 },   // 0xF7
+  {   1,  21,  20 },   // 0xF8
+  {   3,  22,  20 },   // 0xF9
+  {   3,  22,  20 },   // 0xFA
+  {   3,  22,  20 },   // 0xFB
+  {   3,  22,  20 },   // 0xFC
+  {   0,  20,  19 },   // 0xFD
+  {   3,  22,  21 },   // 0xFE
+  {   0,  20,  19 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold16pt8bWidths = { DejaVuSans_Bold16pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD16PTLAT1__H
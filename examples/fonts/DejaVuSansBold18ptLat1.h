@@ -0,0 +1,1630 @@
+#ifndef DEJAVUSANSBOLD18PTLAT1__H
+#define DEJAVUSANSBOLD18PTLAT1__H
+const uint8_t DejaVuSans_Bold18pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDE, 0x79, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFE, 0x3F,
+  0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xE0, 0x00, 0x78,
+  0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x0F, 0x00, 0x0F,
+  0x07, 0x80, 0x07, 0x83, 0xC0, 0x03, 0xC3, 0xC0, 0x7F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE0, 0x3C, 0x3C, 0x00,
+  0x1C, 0x1E, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x07, 0x00, 0x07, 0x87, 0x80,
+  0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+  0xC0, 0x78, 0x78, 0x00, 0x78, 0x3C, 0x00, 0x3C, 0x1C, 0x00, 0x1E, 0x1E,
+  0x00, 0x0E, 0x0F, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x0F, 0xFF,
+  0xE3, 0xFF, 0xFC, 0xFC, 0xE3, 0x9F, 0x1C, 0x13, 0xE3, 0x80, 0x7C, 0x70,
+  0x0F, 0xCE, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xC0, 0x7F, 0xFC, 0x03, 0xBF, 0x80, 0x71, 0xF0, 0x0E, 0x3F, 0x01, 0xC7,
+  0xFC, 0x39, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xE0, 0x3F, 0xF0,
+  0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
+  0x0F, 0xC0, 0x03, 0xC0, 0x1F, 0xF8, 0x01, 0xC0, 0x1F, 0xFE, 0x01, 0xE0,
+  0x0F, 0x0F, 0x01, 0xE0, 0x0F, 0x87, 0xC0, 0xE0, 0x07, 0x81, 0xE0, 0xF0,
+  0x03, 0xC0, 0xF0, 0x70, 0x01, 0xE0, 0x78, 0x78, 0x00, 0xF0, 0x3C, 0x78,
+  0x00, 0x7C, 0x3E, 0x38, 0x00, 0x1E, 0x1E, 0x3C, 0x00, 0x0F, 0xFF, 0x1C,
+  0x00, 0x03, 0xFF, 0x1E, 0x1F, 0x80, 0x7E, 0x1E, 0x3F, 0xF0, 0x00, 0x0E,
+  0x3F, 0xFC, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x07, 0x1F, 0x0F, 0x80, 0x07,
+  0x8F, 0x03, 0xC0, 0x07, 0x87, 0x81, 0xE0, 0x03, 0x83, 0xC0, 0xF0, 0x03,
+  0xC1, 0xE0, 0x78, 0x01, 0xC0, 0xF8, 0x7C, 0x01, 0xE0, 0x3C, 0x3C, 0x01,
+  0xE0, 0x1F, 0xFE, 0x00, 0xE0, 0x07, 0xFE, 0x00, 0xF0, 0x00, 0xFC, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
+  0xF0, 0x00, 0xFE, 0x0E, 0x00, 0x1F, 0x80, 0x40, 0x03, 0xF0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x0F, 0xFE, 0x03, 0xE3, 0xFF, 0xE0, 0x7C, 0xFE, 0xFE, 0x0F, 0x9F,
+  0x8F, 0xE3, 0xE7, 0xE0, 0xFE, 0x7C, 0xFC, 0x0F, 0xFF, 0x9F, 0x80, 0xFF,
+  0xE3, 0xF0, 0x0F, 0xFC, 0x7F, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC0, 0xFF,
+  0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xDF,
+  0xC0, 0x7F, 0xC1, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xC3, 0xE0,
+  0xF8, 0x7C, 0x1F, 0x0F, 0xC3, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xC3, 0xF0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x7C, 0x1F,
+  0x87, 0xE1, 0xF8, 0x3E, 0x0F, 0xC1, 0xF0, 0x7C, 0x0F, 0x83, 0xE0, 0x7C,
+  0xF8, 0x1F, 0x07, 0xC0, 0xF8, 0x3E, 0x0F, 0xC1, 0xF0, 0x7E, 0x1F, 0x87,
+  0xE0, 0xF8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
+  0x3F, 0x0F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x0F, 0xC3, 0xE0, 0xF8, 0x7C,
+  0x1F, 0x0F, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x08, 0x38, 0x2F,
+  0x1C, 0x7B, 0xEE, 0xF8, 0x7F, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xFE,
+  0x1F, 0x77, 0xFE, 0x38, 0xF4, 0x1C, 0x10, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00,
+  0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01,
+  0xE0, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x7E, 0x7C, 0x7C,
+  0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0x78,
+  0x03, 0xC0, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x01, 0xE0,
+  0x0F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F,
+  0xFF, 0x83, 0xF0, 0x7E, 0x3F, 0x01, 0xF9, 0xF8, 0x0F, 0xCF, 0x80, 0x7E,
+  0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0,
+  0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF,
+  0xE0, 0x0F, 0xDF, 0x80, 0xFC, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0x1F, 0x83,
+  0xF0, 0x7F, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
+  0x1F, 0xF0, 0x3F, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x38,
+  0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xF8, 0x0F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xEF, 0xC1, 0xFD, 0xC0,
+  0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
+  0x1F, 0x80, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x0F,
+  0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x7F, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC6, 0x03,
+  0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFE, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xFF, 0x03, 0xFF,
+  0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF8, 0x00, 0xFF, 0xE0, 0x3F, 0xBF, 0xFF, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF,
+  0x07, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
+  0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3E, 0xFC, 0x00, 0xF3,
+  0xF0, 0x07, 0xCF, 0xC0, 0x3E, 0x3F, 0x00, 0xF0, 0xFC, 0x07, 0xC3, 0xF0,
+  0x3E, 0x0F, 0xC0, 0xF0, 0x3F, 0x07, 0xC0, 0xFC, 0x3E, 0x03, 0xF0, 0xF0,
+  0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x7F, 0xFF, 0x8F, 0xFF, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF,
+  0xC7, 0xFF, 0xF8, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xF8,
+  0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC7, 0x83, 0xFC, 0x80, 0x1F,
+  0x80, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F,
+  0x80, 0x07, 0xF8, 0x00, 0xFD, 0xE0, 0x7F, 0xBF, 0xFF, 0xE7, 0xFF, 0xF8,
+  0xFF, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
+  0xC1, 0xFF, 0xFC, 0x3F, 0xC1, 0xC3, 0xF0, 0x04, 0x7E, 0x00, 0x07, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0xCF, 0xE0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xEF, 0xF8, 0xFE, 0xFF, 0x07, 0xFF, 0xE0, 0x3F, 0xFE, 0x03, 0xFF,
+  0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x07, 0xE3, 0xF8, 0xFE,
+  0x1F, 0xFF, 0xC1, 0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x1F, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
+  0x80, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0,
+  0x01, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
+  0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x7F, 0x0F,
+  0xE7, 0xE0, 0x7E, 0x7E, 0x07, 0xE7, 0xE0, 0x7E, 0x7E, 0x07, 0xE7, 0xE0,
+  0x7E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xC7, 0xF0, 0xFE, 0xFE, 0x07, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0xFF,
+  0xC0, 0x3F, 0xFE, 0x07, 0xFF, 0xF0, 0xFF, 0x7F, 0xFF, 0xE3, 0xFF, 0xFC,
+  0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF,
+  0x83, 0xFF, 0xF8, 0x7F, 0x1F, 0xC7, 0xE0, 0xFE, 0xFC, 0x07, 0xEF, 0xC0,
+  0x7E, 0xFC, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0x7F,
+  0x1F, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x07, 0xF3, 0xF0,
+  0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC3, 0x03, 0xFC,
+  0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x7E, 0x7C, 0x7C, 0xF8,
+  0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xFF,
+  0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0xFF,
+  0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC,
+  0x00, 0x07, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC,
+  0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
+  0x03, 0xFF, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFC,
+  0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x3F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x7F, 0x80, 0x3F,
+  0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0x01, 0xFC,
+  0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xF0, 0x00, 0xFC, 0x07, 0xE0, 0x0F, 0x80, 0x03, 0xC0, 0x3C,
+  0x00, 0x07, 0x81, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x1E, 0x38, 0x0F,
+  0x3C, 0x39, 0xC0, 0xFE, 0xF0, 0xE7, 0x07, 0xFF, 0xC1, 0xFC, 0x1E, 0x3F,
+  0x07, 0xE0, 0xF8, 0x7C, 0x1F, 0x83, 0xC0, 0xF0, 0x7E, 0x0F, 0x03, 0xC1,
+  0xF8, 0x3C, 0x0F, 0x07, 0xE0, 0xF0, 0x3C, 0x3F, 0x83, 0xC0, 0xF0, 0xEE,
+  0x0F, 0x87, 0xC7, 0xBC, 0x1E, 0x3F, 0x3C, 0x70, 0x7F, 0xFF, 0xE1, 0xC0,
+  0xFE, 0xFF, 0x03, 0x80, 0xF3, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x7C, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x70, 0x01, 0xFC, 0x0F,
+  0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xFC,
+  0x00, 0x0F, 0xDF, 0x80, 0x03, 0xFB, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x0F,
+  0xC7, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x7E, 0x0F, 0xC0, 0x0F, 0xC1, 0xF8,
+  0x03, 0xF8, 0x3F, 0x80, 0x7E, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x03, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8,
+  0x7F, 0xFF, 0xFF, 0x1F, 0xC0, 0x07, 0xF3, 0xF0, 0x00, 0x7E, 0x7E, 0x00,
+  0x0F, 0xDF, 0xC0, 0x01, 0xFC, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF1, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0x7E, 0x01, 0xFB, 0xF0, 0x0F, 0xDF,
+  0x80, 0x7E, 0xFC, 0x03, 0xF7, 0xE0, 0x1F, 0xBF, 0x01, 0xF9, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0xDF, 0x80, 0xFE, 0xFC,
+  0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x3F,
+  0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x7F, 0xFF, 0xC3, 0xFF,
+  0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x80, 0xF7, 0xF8, 0x00, 0x5F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x01, 0x3F, 0xE0, 0x3C,
+  0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFC, 0x07, 0xFC, 0xFC, 0x01, 0xFE, 0xFC,
+  0x00, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0xFE, 0xFC,
+  0x01, 0xFC, 0xFC, 0x07, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFC,
+  0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F, 0xE0, 0x1E,
+  0x7F, 0x80, 0x02, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF,
+  0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0x7E, 0x00, 0x3F,
+  0x7F, 0x00, 0x3F, 0x7F, 0x80, 0x3F, 0x3F, 0xE0, 0x3F, 0x1F, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xC0,
+  0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF,
+  0xC0, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC,
+  0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00,
+  0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x07,
+  0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
+  0xF8, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0,
+  0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC,
+  0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x3F,
+  0x8F, 0xEF, 0xFD, 0xFF, 0x3F, 0xE7, 0xF0, 0xF8, 0x00, 0xFC, 0x01, 0xFE,
+  0x7E, 0x01, 0xFE, 0x3F, 0x01, 0xFE, 0x1F, 0x81, 0xFE, 0x0F, 0xC1, 0xFE,
+  0x07, 0xE1, 0xFE, 0x03, 0xF1, 0xFE, 0x01, 0xF9, 0xFE, 0x00, 0xFD, 0xFE,
+  0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFE,
+  0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0xFD,
+  0xFE, 0x00, 0x7E, 0x7F, 0x80, 0x3F, 0x1F, 0xE0, 0x1F, 0x87, 0xF8, 0x0F,
+  0xC1, 0xFE, 0x07, 0xE0, 0x7F, 0x83, 0xF0, 0x1F, 0xE1, 0xF8, 0x07, 0xF8,
+  0xFC, 0x01, 0xFE, 0x7E, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+  0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0xE0,
+  0x7B, 0xFF, 0xDE, 0x07, 0xBF, 0xFD, 0xF0, 0xFB, 0xFF, 0xCF, 0x0F, 0x3F,
+  0xFC, 0xF9, 0xF3, 0xFF, 0xC7, 0x9E, 0x3F, 0xFC, 0x7B, 0xE3, 0xFF, 0xC3,
+  0xFC, 0x3F, 0xFC, 0x3F, 0xC3, 0xFF, 0xC3, 0xFC, 0x3F, 0xFC, 0x1F, 0x83,
+  0xFF, 0xC1, 0xF8, 0x3F, 0xFC, 0x0F, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
+  0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x03,
+  0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x3F,
+  0xFD, 0xE0, 0x7F, 0xFB, 0xE0, 0xFF, 0xF3, 0xC1, 0xFF, 0xE7, 0xC3, 0xFF,
+  0xC7, 0x87, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x1F, 0xFE, 0x1F, 0x3F, 0xFC,
+  0x1E, 0x7F, 0xF8, 0x3E, 0xFF, 0xF0, 0x3D, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xF8, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x0F, 0xF0, 0x3F, 0xC7,
+  0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x7E, 0x00, 0x1F, 0xBF, 0x80, 0x07,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xDF,
+  0x80, 0x07, 0xE7, 0xF0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0xFF,
+  0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7E, 0x03, 0xFF, 0xF0, 0x0F, 0xFF,
+  0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0xFF,
+  0xFE, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0,
+  0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xF0, 0x03,
+  0xF9, 0xFC, 0x00, 0xFE, 0x7E, 0x00, 0x1F, 0xBF, 0x80, 0x07, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xDF, 0x80, 0x07,
+  0xE7, 0xE0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0x80, 0xFE,
+  0x3F, 0x00, 0xFC, 0x7E, 0x01, 0xF8, 0xFC, 0x03, 0xF1, 0xF8, 0x07, 0xE3,
+  0xF0, 0x3F, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xFC, 0x1F, 0xE1, 0xF8, 0x1F, 0xC3, 0xF0,
+  0x1F, 0xC7, 0xE0, 0x1F, 0x8F, 0xC0, 0x3F, 0x9F, 0x80, 0x7F, 0x3F, 0x00,
+  0x7E, 0x7E, 0x00, 0xFE, 0xFC, 0x00, 0xFD, 0xF8, 0x01, 0xFC, 0x07, 0xFC,
+  0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 0xFF, 0xCF, 0xE0,
+  0x3C, 0xFC, 0x00, 0x4F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+  0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0,
+  0x01, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x3F,
+  0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0x7F, 0xFF,
+  0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+  0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
+  0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
+  0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
+  0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x1F, 0xDF, 0x80, 0x7E, 0x7F, 0x03,
+  0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x07, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xEF, 0xC0, 0x01, 0xF9, 0xF8, 0x00,
+  0x3F, 0x3F, 0x80, 0x0F, 0xE3, 0xF0, 0x01, 0xF8, 0x7E, 0x00, 0x3F, 0x0F,
+  0xE0, 0x0F, 0xE0, 0xFC, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x0F,
+  0xE0, 0x3F, 0x01, 0xF8, 0x07, 0xF0, 0x7F, 0x00, 0x7E, 0x0F, 0xC0, 0x0F,
+  0xC1, 0xF8, 0x01, 0xFC, 0x7F, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xF1, 0xF8,
+  0x00, 0x7F, 0x7F, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F,
+  0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xFF,
+  0xE0, 0x1F, 0xC0, 0x7F, 0x7E, 0x03, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0xC0,
+  0x7E, 0x7E, 0x03, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0xC0, 0x7E, 0x3F, 0x07,
+  0xDE, 0x0F, 0xE3, 0xF0, 0x79, 0xE0, 0xFC, 0x3F, 0x07, 0x9E, 0x0F, 0xC3,
+  0xF0, 0x79, 0xE0, 0xFC, 0x3F, 0x8F, 0x9F, 0x1F, 0xC1, 0xF8, 0xF0, 0xF1,
+  0xF8, 0x1F, 0x8F, 0x0F, 0x1F, 0x81, 0xF8, 0xF0, 0xF1, 0xF8, 0x1F, 0x8F,
+  0x0F, 0x1F, 0x80, 0xFD, 0xE0, 0x7B, 0xF0, 0x0F, 0xDE, 0x07, 0xBF, 0x00,
+  0xFD, 0xE0, 0x7B, 0xF0, 0x0F, 0xDE, 0x07, 0xBF, 0x00, 0xFF, 0xE0, 0x3F,
+  0xF0, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC,
+  0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x03, 0xF8, 0x01, 0xFC, 0x00,
+  0x3F, 0x80, 0x1F, 0xC0, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xE3, 0xF8,
+  0x07, 0xF0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x7F, 0x00,
+  0x7F, 0x3F, 0x80, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFC, 0x00, 0x7F, 0x3F, 0x80, 0x3F, 0xCF, 0xF0, 0x0F, 0xE1, 0xFC,
+  0x07, 0xF0, 0x3F, 0x83, 0xFC, 0x0F, 0xF0, 0xFE, 0x01, 0xFC, 0x7F, 0x00,
+  0x3F, 0xBF, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xE3,
+  0xF8, 0x07, 0xF0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x7F,
+  0x00, 0xFF, 0x3F, 0xC0, 0x1F, 0xCF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF,
+  0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+  0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8,
+  0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x01,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x7F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0,
+  0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80,
+  0x1C, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0,
+  0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x03,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x3F, 0x3F,
+  0x01, 0xF8, 0x7E, 0x0F, 0x80, 0x7C, 0x7C, 0x00, 0xFB, 0xE0, 0x01, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x0F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xE3, 0x81, 0xFC, 0x40, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0xFF, 0x3F, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F,
+  0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xE7, 0xFE, 0xFC, 0x3F, 0x1F,
+  0x80, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F,
+  0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x3F,
+  0x07, 0xE7, 0xFC, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF0, 0x7F, 0x7F,
+  0x01, 0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F,
+  0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFB, 0xFC,
+  0x1F, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xE7, 0xFC, 0x3F, 0x1F, 0x80,
+  0x01, 0xFE, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xF7, 0xF8, 0x3B, 0xF0,
+  0x07, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F,
+  0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x05, 0xFE, 0x0E, 0x7F, 0xFF, 0x1F, 0xFF,
+  0x87, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0,
+  0x00, 0x3F, 0x03, 0xF1, 0xF8, 0x7F, 0xCF, 0xCF, 0xFF, 0xFE, 0x7F, 0xFF,
+  0xF7, 0xF0, 0x7F, 0xBF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC,
+  0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F,
+  0xBF, 0x01, 0xFD, 0xFC, 0x1F, 0xE7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F,
+  0xCF, 0xC1, 0xFC, 0x7E, 0x01, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xC7, 0xF8, 0x7F, 0x3F, 0x01, 0xFB, 0xF8, 0x07, 0xDF, 0x80,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3F, 0x00, 0x09, 0xFC, 0x03, 0xC7, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xF0, 0x7F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8,
+  0xFF, 0xF1, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0xFF, 0xFD, 0xFF,
+  0xFB, 0xFF, 0xF7, 0xFF, 0xE1, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0x03, 0xF1, 0xF8,
+  0x7F, 0xCF, 0xC7, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7, 0xF0, 0x7F, 0xBF, 0x01,
+  0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x3F, 0xBF, 0x01, 0xFD, 0xFC, 0x1F,
+  0xE7, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x7F, 0xCF, 0xC1, 0xFC, 0x7E, 0x00,
+  0x03, 0xF2, 0x00, 0x3F, 0x1C, 0x07, 0xF8, 0xFF, 0xFF, 0x87, 0xFF, 0xF8,
+  0x3F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
+  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
+  0x00, 0xFC, 0x7E, 0x1F, 0x9F, 0xF3, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xFE, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01,
+  0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC3, 0xF0, 0xFC,
+  0x3F, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
+  0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC7, 0xFF, 0xFB, 0xFE,
+  0xFF, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8,
+  0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
+  0xFC, 0x0F, 0xE7, 0xE0, 0xFE, 0x3F, 0x0F, 0xE1, 0xF8, 0xFE, 0x0F, 0xCF,
+  0xE0, 0x7E, 0xFE, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xE0, 0x07,
+  0xFF, 0x80, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x0F, 0xDF, 0xE0, 0x7E, 0x7F,
+  0x83, 0xF1, 0xFE, 0x1F, 0x87, 0xF8, 0xFC, 0x1F, 0xE7, 0xE0, 0x7F, 0xBF,
+  0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC,
+  0x7C, 0x07, 0xC3, 0xF7, 0xFC, 0x7F, 0xCF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xE0, 0xFE,
+  0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0x03,
+  0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0xFF,
+  0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x3F, 0xFC,
+  0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
+  0x7E, 0x1F, 0x9F, 0xF3, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
+  0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0,
+  0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0x80, 0x01, 0xFC, 0x00,
+  0x7F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xF0, 0x7F, 0x3F, 0x01,
+  0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xF9, 0xFC, 0x1F,
+  0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0xFF, 0x00, 0xFC,
+  0x3F, 0x07, 0xE7, 0xFC, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF0, 0x7F,
+  0x7F, 0x01, 0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0,
+  0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFB,
+  0xFC, 0x1F, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC7, 0xE7, 0xFC, 0x3F, 0x1F,
+  0x81, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x7F,
+  0xCF, 0xCF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7, 0xF0, 0x7F, 0xBF, 0x01, 0xFF,
+  0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00,
+  0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xFD, 0xFC, 0x1F, 0xE7,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F, 0xCF, 0xC1, 0xFC, 0x7E, 0x00, 0x03,
+  0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
+  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x3F, 0xF3, 0xFF, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xE0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
+  0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0x9F, 0xFF, 0xDF, 0xFF, 0xEF,
+  0xE0, 0xF7, 0xE0, 0x0B, 0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0xFF,
+  0x83, 0xFF, 0xC0, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x07, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00,
+  0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0,
+  0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xFC, 0x03,
+  0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x03, 0xFE, 0xFC, 0x07, 0xFF, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF,
+  0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xE7,
+  0xFC, 0xFC, 0x3F, 0x1F, 0x80, 0xFE, 0x01, 0xFD, 0xF8, 0x07, 0xE7, 0xE0,
+  0x1F, 0x9F, 0xC0, 0xFE, 0x3F, 0x03, 0xF0, 0xFE, 0x1F, 0xC1, 0xF8, 0x7E,
+  0x07, 0xE1, 0xF8, 0x1F, 0xCF, 0xE0, 0x3F, 0x3F, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
+  0xC0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFC, 0x0F,
+  0xC0, 0xFF, 0xF8, 0x3F, 0x07, 0xF7, 0xE0, 0xFC, 0x1F, 0x9F, 0x83, 0xF0,
+  0x7E, 0x7E, 0x1F, 0xE1, 0xF9, 0xFC, 0x7F, 0x8F, 0xE3, 0xF1, 0xFE, 0x3F,
+  0x0F, 0xC7, 0xF8, 0xFC, 0x3F, 0x3C, 0xF3, 0xF0, 0x7E, 0xF3, 0xDF, 0x81,
+  0xFB, 0xCF, 0x7E, 0x07, 0xEF, 0x3D, 0xF8, 0x1F, 0xF8, 0x7F, 0xE0, 0x3F,
+  0xE1, 0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x03, 0xFE, 0x1F, 0xF0, 0x0F, 0xF0,
+  0x3F, 0xC0, 0x1F, 0xC0, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0xFF, 0x03,
+  0xFD, 0xFE, 0x1F, 0xE3, 0xFC, 0xFF, 0x07, 0xF3, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x07,
+  0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+  0x01, 0xFF, 0xFE, 0x07, 0xF3, 0xF8, 0x3F, 0x87, 0xF1, 0xFE, 0x1F, 0xEF,
+  0xF0, 0x3F, 0xC0, 0xFE, 0x01, 0xFD, 0xF8, 0x07, 0xE7, 0xF0, 0x1F, 0x8F,
+  0xC0, 0xFE, 0x3F, 0x83, 0xF0, 0xFE, 0x1F, 0xC1, 0xF8, 0x7E, 0x07, 0xF1,
+  0xF8, 0x0F, 0xCF, 0xE0, 0x3F, 0xBF, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0,
+  0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x01,
+  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xFC,
+  0x00, 0x07, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x03, 0xFC,
+  0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x01, 0xFF,
+  0x03, 0xFF, 0x07, 0xFF, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
+  0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
+  0xFF, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x03, 0xFF,
+  0x01, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xF8, 0x07, 0xF0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFE, 0x00, 0x1F, 0xC0,
+  0x05, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFB,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x79, 0xE7, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x0F, 0xF0, 0x3F, 0xFE,
+  0x3F, 0xFF, 0x3F, 0xFF, 0xBF, 0xF9, 0xDF, 0xDC, 0x3F, 0xCE, 0x0F, 0xC7,
+  0x07, 0xE3, 0x83, 0xF1, 0xC1, 0xF8, 0xE0, 0xFC, 0x70, 0x7F, 0x38, 0x1F,
+  0xDC, 0x2F, 0xFE, 0x33, 0xFF, 0xF8, 0xFF, 0xFC, 0x3F, 0xFE, 0x03, 0xFC,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x00,
+  0x7F, 0xE0, 0x3F, 0xFC, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0x7F, 0x06, 0x1F,
+  0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F,
+  0x00, 0x07, 0xE0, 0x07, 0xFF, 0xF0, 0xFF, 0xFE, 0x1F, 0xFF, 0xC3, 0xFF,
+  0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC,
+  0x00, 0x1F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x10, 0x00, 0x61, 0xC0, 0x07, 0x9E, 0x00, 0x7D, 0xF9, 0xF3, 0xF7,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x3F, 0xFE, 0x01, 0xF1, 0xF0, 0x1F, 0x07,
+  0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xF0, 0x3C, 0x07, 0x81, 0xF0, 0x7C, 0x07,
+  0xC7, 0xC0, 0x3F, 0xFE, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0xF7, 0xE7, 0xCF,
+  0xFF, 0x00, 0x3C, 0x70, 0x01, 0xC1, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x7F,
+  0x7F, 0x00, 0xFE, 0x3F, 0x81, 0xFC, 0x3F, 0x81, 0xFC, 0x1F, 0xC3, 0xF8,
+  0x1F, 0xC3, 0xF8, 0x0F, 0xE7, 0xF0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
+  0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE,
+  0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x0F, 0xFF, 0x0F, 0xFF,
+  0x8F, 0xFF, 0xC7, 0xF0, 0x63, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F,
+  0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0x8F, 0xDF, 0xEF, 0xC3, 0xFF, 0xC0, 0xFF,
+  0xE0, 0x3F, 0xF8, 0x1F, 0xFE, 0x0F, 0xBF, 0xDF, 0x8F, 0xFF, 0x83, 0xFF,
+  0x80, 0x7F, 0xC0, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x30, 0x7F, 0x1F,
+  0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x80, 0xFF, 0x00, 0xF1, 0xFE, 0x3F, 0xC7,
+  0xF8, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01,
+  0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF1, 0xE0, 0xFC, 0x38,
+  0xE1, 0xFF, 0x0E, 0x71, 0xFF, 0x87, 0x70, 0xF8, 0x41, 0xF8, 0xF8, 0x00,
+  0xFC, 0x78, 0x00, 0x7E, 0x3C, 0x00, 0x3F, 0x1E, 0x00, 0x1F, 0x8F, 0x00,
+  0x0F, 0xC3, 0xC1, 0x07, 0x71, 0xFF, 0x87, 0x38, 0x7F, 0xC3, 0x9E, 0x0F,
+  0xC3, 0xC7, 0x80, 0x03, 0xC1, 0xE0, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x1F,
+  0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC1, 0xFF,
+  0xC7, 0xFF, 0x98, 0x1F, 0x00, 0x3C, 0x7F, 0xF7, 0xFF, 0xFE, 0x0F, 0xF0,
+  0x7F, 0xC1, 0xFF, 0x8F, 0xFF, 0xFF, 0x7F, 0xBC, 0xFC, 0xF0, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x01, 0x03, 0x03, 0x07,
+  0x07, 0x0F, 0x0F, 0x3F, 0x3F, 0x7C, 0x7C, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF8, 0xF8, 0x7C, 0x7C, 0x3F, 0x3F, 0x0F, 0x0F, 0x07, 0x07, 0x03,
+  0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF1,
+  0xE7, 0xFC, 0x38, 0xE3, 0xFF, 0x0E, 0x71, 0xE7, 0xC7, 0x70, 0xF1, 0xE1,
+  0xF8, 0x78, 0xF0, 0xFC, 0x3C, 0xF8, 0x7E, 0x1F, 0xF8, 0x3F, 0x0F, 0xF0,
+  0x1F, 0x87, 0xBC, 0x0F, 0xC3, 0xCF, 0x07, 0x71, 0xE7, 0x87, 0x38, 0xF1,
+  0xE3, 0x9E, 0x78, 0x73, 0xC7, 0x80, 0x03, 0xC1, 0xE0, 0x03, 0xC0, 0x7C,
+  0x07, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x07, 0xF1, 0xFF, 0x78, 0xFE, 0x0F,
+  0xC1, 0xF8, 0x3F, 0x8F, 0x7F, 0xC7, 0xF0, 0x7C, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01,
+  0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x8F,
+  0xFE, 0xFF, 0xFE, 0x1F, 0x80, 0xF0, 0x0F, 0x01, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x8F, 0xFE,
+  0xFF, 0xFC, 0x1F, 0x00, 0xF0, 0x1E, 0x1F, 0xC1, 0xFC, 0x01, 0xE0, 0x0F,
+  0x00, 0xF8, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x00, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0x3F, 0x01, 0xF9,
+  0xF8, 0x0F, 0xCF, 0xC0, 0x7E, 0x7E, 0x03, 0xF3, 0xF0, 0x1F, 0x9F, 0x80,
+  0xFC, 0xFC, 0x07, 0xE7, 0xE0, 0x3F, 0x3F, 0x01, 0xF9, 0xF8, 0x0F, 0xCF,
+  0xC0, 0x7E, 0x7F, 0x07, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0xFF, 0x7C, 0x3D, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
+  0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x07, 0xFF, 0x1F, 0xFF, 0x3F, 0xFF, 0x7F, 0xC7, 0xFF, 0xC7, 0xFF,
+  0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0x7F, 0xC7, 0x3F,
+  0xC7, 0x1F, 0xC7, 0x07, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01,
+  0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01,
+  0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x06, 0x07, 0x07, 0xFF, 0xFF, 0xFC,
+  0x3F, 0x0F, 0xF0, 0xFF, 0x0C, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0x7C, 0x3E, 0x7F, 0xFC, 0x1F,
+  0xF8, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+  0xFE, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFC, 0x3E,
+  0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0xFC,
+  0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x3F, 0x00, 0x01,
+  0xE0, 0xFF, 0x00, 0x03, 0xC0, 0xFF, 0x00, 0x03, 0x80, 0xCF, 0x00, 0x07,
+  0x80, 0x0F, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x78,
+  0x00, 0x0F, 0x00, 0x70, 0x00, 0x0F, 0x00, 0xF0, 0x7C, 0xFF, 0xF0, 0xE0,
+  0xFC, 0xFF, 0xF1, 0xC0, 0xFC, 0xFF, 0xF3, 0xC1, 0xFC, 0x00, 0x03, 0x83,
+  0xBC, 0x00, 0x07, 0x87, 0x3C, 0x00, 0x0F, 0x07, 0x3C, 0x00, 0x0E, 0x0E,
+  0x3C, 0x00, 0x1E, 0x1C, 0x3C, 0x00, 0x3C, 0x1F, 0xFF, 0x00, 0x38, 0x1F,
+  0xFF, 0x00, 0x78, 0x1F, 0xFF, 0x00, 0x70, 0x00, 0x3C, 0x00, 0xF0, 0x00,
+  0x3C, 0x01, 0xE0, 0x00, 0x3C, 0x3F, 0x00, 0x01, 0xE0, 0x7F, 0x80, 0x01,
+  0xE0, 0x3F, 0xC0, 0x00, 0xE0, 0x19, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x1E, 0x00,
+  0x38, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x03, 0xC0,
+  0x1C, 0x00, 0x01, 0xE0, 0x1E, 0x3F, 0x8F, 0xFF, 0x0E, 0x7F, 0xF7, 0xFF,
+  0x8E, 0x3F, 0xFF, 0xFF, 0xCF, 0x1C, 0x3E, 0x00, 0x07, 0x08, 0x0F, 0x00,
+  0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x03, 0x80, 0x07, 0xC0,
+  0x03, 0xC0, 0x07, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x01, 0xC0, 0x07, 0xC0,
+  0x01, 0xE0, 0x0F, 0xC0, 0x00, 0xE0, 0x0F, 0xFF, 0x00, 0xF0, 0x07, 0xFF,
+  0x80, 0xF0, 0x03, 0xFF, 0xC0, 0x7F, 0x80, 0x01, 0xE0, 0xFF, 0xE0, 0x03,
+  0xC0, 0xFF, 0xF0, 0x03, 0x80, 0xC1, 0xF0, 0x07, 0x80, 0x00, 0xF0, 0x07,
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x1F, 0xC0, 0x1E, 0x00, 0x1F, 0xC0, 0x1C,
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0xF0, 0x70,
+  0x00, 0x81, 0xF0, 0xF0, 0x7C, 0xFF, 0xF0, 0xE0, 0xFC, 0xFF, 0xE1, 0xC0,
+  0xFC, 0x7F, 0x83, 0xC1, 0xFC, 0x00, 0x03, 0x83, 0xBC, 0x00, 0x07, 0x87,
+  0x3C, 0x00, 0x0F, 0x07, 0x3C, 0x00, 0x0E, 0x0E, 0x3C, 0x00, 0x1E, 0x1C,
+  0x3C, 0x00, 0x3C, 0x1F, 0xFF, 0x00, 0x38, 0x1F, 0xFF, 0x00, 0x78, 0x1F,
+  0xFF, 0x00, 0x70, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x01, 0xE0, 0x00,
+  0x3C, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07,
+  0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0xFE,
+  0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xFE, 0x0F, 0x7F, 0xFF, 0x7F,
+  0xFF, 0x3F, 0xFF, 0x07, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE,
+  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7E, 0xFC, 0x00, 0x1F, 0xDF, 0xC0, 0x03,
+  0xF1, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x1F, 0xC7, 0xF0, 0x03, 0xF0, 0x7E,
+  0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0xC1, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0xFE,
+  0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x3F, 0x9F, 0x80,
+  0x03, 0xF3, 0xF0, 0x00, 0x7E, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+  0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7E, 0xFC, 0x00,
+  0x1F, 0xDF, 0xC0, 0x03, 0xF1, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x1F, 0xC7,
+  0xF0, 0x03, 0xF0, 0x7E, 0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0xC1, 0xFC, 0x03,
+  0xF0, 0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFE,
+  0x00, 0x3F, 0x9F, 0x80, 0x03, 0xF3, 0xF0, 0x00, 0x7E, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00,
+  0x78, 0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x7E, 0xFC, 0x00, 0x1F, 0xDF, 0xC0, 0x03, 0xF1, 0xF8, 0x00, 0x7E,
+  0x3F, 0x00, 0x1F, 0xC7, 0xF0, 0x03, 0xF0, 0x7E, 0x00, 0x7E, 0x0F, 0xC0,
+  0x1F, 0xC1, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x1F, 0xFF,
+  0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC3,
+  0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x3F, 0x9F, 0x80, 0x03, 0xF3, 0xF0, 0x00,
+  0x7E, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x78, 0x30, 0x00, 0x1F, 0xCE, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0xE7, 0xF0, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE,
+  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7E, 0xFC, 0x00, 0x1F, 0xDF, 0xC0, 0x03,
+  0xF1, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x1F, 0xC7, 0xF0, 0x03, 0xF0, 0x7E,
+  0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0xC1, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0xFE,
+  0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x3F, 0x9F, 0x80,
+  0x03, 0xF3, 0xF0, 0x00, 0x7E, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xF1, 0xE0,
+  0x00, 0x1E, 0x3C, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x78, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+  0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0xFE, 0xFE, 0x00,
+  0x1F, 0x8F, 0xC0, 0x03, 0xF1, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x1F, 0x83,
+  0xF0, 0x03, 0xF0, 0x7E, 0x00, 0xFE, 0x0F, 0xE0, 0x1F, 0x80, 0xFC, 0x07,
+  0xF0, 0x1F, 0xC0, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC7, 0xF0, 0x01, 0xFC, 0xFC,
+  0x00, 0x1F, 0x9F, 0x80, 0x03, 0xF7, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x07,
+  0x1C, 0x00, 0x00, 0xE3, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+  0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7E, 0xFC, 0x00,
+  0x1F, 0xDF, 0xC0, 0x03, 0xF1, 0xF8, 0x00, 0x7E, 0x3F, 0x00, 0x1F, 0xC7,
+  0xF0, 0x03, 0xF0, 0x7E, 0x00, 0xFE, 0x0F, 0xE0, 0x1F, 0x80, 0xFC, 0x03,
+  0xF0, 0x1F, 0x80, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC7, 0xF0, 0x01, 0xFC, 0xFC,
+  0x00, 0x1F, 0x9F, 0x80, 0x03, 0xF7, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0xF0, 0x07, 0xE7, 0xFF, 0xFE, 0x01, 0xFC, 0xFC, 0x00, 0x00,
+  0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x01, 0xFC, 0x7E, 0x00,
+  0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xE1, 0xFF, 0xFF, 0x01, 0xF8, 0x3F,
+  0xFF, 0xE0, 0x7F, 0x07, 0xFF, 0xFC, 0x0F, 0xE0, 0xFF, 0xFF, 0x81, 0xF8,
+  0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+  0x03, 0xF8, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xDF, 0xC0, 0x1F,
+  0xFF, 0xFB, 0xF0, 0x03, 0xFF, 0xFF, 0x7E, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x7F, 0xFF, 0xC3,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x80, 0xF7, 0xF8, 0x00, 0x5F, 0xC0,
+  0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE,
+  0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x01, 0x3F, 0xE0,
+  0x3C, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x01, 0xFF, 0xF8,
+  0x01, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x80, 0x00,
+  0x0E, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x3F, 0xFF, 0xEF, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xEF, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x7B, 0xC0, 0x3C,
+  0x78, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
+  0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0xFB, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
+  0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x1E, 0x03, 0xC7, 0x80,
+  0xF1, 0xE0, 0x3C, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00,
+  0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF,
+  0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7C, 0x3C, 0x1E, 0x0F,
+  0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x8F, 0x87, 0x87, 0x87, 0x80, 0x00, 0x01,
+  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E,
+  0x3F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F,
+  0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x83, 0xCF, 0x0E,
+  0x1C, 0x70, 0x38, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
+  0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
+  0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
+  0x03, 0xF0, 0x0F, 0xC0, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x00, 0x00, 0x03,
+  0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
+  0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
+  0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x1F, 0xFF, 0x80, 0x03,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+  0xF0, 0x3F, 0x03, 0xFF, 0x07, 0xE0, 0x0F, 0xF0, 0xFC, 0x00, 0xFE, 0x1F,
+  0x80, 0x0F, 0xC3, 0xF0, 0x01, 0xFC, 0x7E, 0x00, 0x1F, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x01, 0xF8, 0xFC,
+  0x00, 0x3F, 0x1F, 0x80, 0x0F, 0xE3, 0xF0, 0x01, 0xF8, 0x7E, 0x00, 0x7F,
+  0x0F, 0xC0, 0x1F, 0xC1, 0xF8, 0x1F, 0xF8, 0x3F, 0xFF, 0xFE, 0x07, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
+  0x01, 0xC1, 0x80, 0x07, 0xE3, 0x00, 0x1F, 0xFE, 0x00, 0x31, 0xF8, 0x00,
+  0x60, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFF,
+  0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x1F, 0xFE, 0xF0, 0x3F, 0xFD, 0xF0,
+  0x7F, 0xF9, 0xE0, 0xFF, 0xF3, 0xE1, 0xFF, 0xE3, 0xC3, 0xFF, 0xC7, 0xC7,
+  0xFF, 0x87, 0x8F, 0xFF, 0x0F, 0x9F, 0xFE, 0x0F, 0x3F, 0xFC, 0x1F, 0x7F,
+  0xF8, 0x1E, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFE, 0x01,
+  0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9,
+  0xF8, 0x00, 0x7E, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x1F, 0x9F, 0xC0, 0x0F, 0xE7,
+  0xF0, 0x03, 0xF8, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9,
+  0xF8, 0x00, 0x7E, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x1F, 0x9F, 0xC0, 0x0F, 0xE7,
+  0xF0, 0x03, 0xF8, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x78, 0x00, 0x07, 0x8F, 0x00,
+  0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9,
+  0xF8, 0x00, 0x7E, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x1F, 0x9F, 0xC0, 0x0F, 0xE7,
+  0xF0, 0x03, 0xF8, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0x70, 0x60, 0x00, 0x3F, 0x18, 0x00, 0x1F, 0xFE, 0x00, 0x06, 0x3F, 0x00,
+  0x01, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE7, 0xF0, 0x03, 0xF9,
+  0xF8, 0x00, 0x7E, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x1F, 0x9F, 0xC0, 0x0F, 0xE7,
+  0xF0, 0x03, 0xF8, 0xFF, 0x03, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0xF3, 0xC0, 0x00, 0x3C, 0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xCF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFF,
+  0xC0, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0xFF,
+  0x03, 0xFC, 0x7F, 0x00, 0x3F, 0x9F, 0xC0, 0x0F, 0xE7, 0xE0, 0x01, 0xFB,
+  0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x01, 0xFD, 0xF8, 0x00, 0x7E, 0x7F, 0x00, 0x3F, 0x9F, 0xC0, 0x0F, 0xE3,
+  0xFC, 0x0F, 0xF0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x20, 0x00, 0x23, 0x80, 0x03,
+  0xBE, 0x00, 0x3E, 0xF8, 0x03, 0xE3, 0xE0, 0x3E, 0x0F, 0x83, 0xE0, 0x3E,
+  0x3E, 0x00, 0xFB, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x3E, 0x00,
+  0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xEF, 0x80, 0x3E, 0x3E, 0x03, 0xE0,
+  0xF8, 0x3E, 0x03, 0xE3, 0xE0, 0x0F, 0xBE, 0x00, 0x3E, 0xE0, 0x00, 0xE2,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x06, 0x01, 0xFF,
+  0xF8, 0xF0, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8,
+  0x1F, 0xE0, 0x7F, 0x83, 0xF8, 0x01, 0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xF0,
+  0x07, 0xFC, 0x7F, 0x00, 0xF7, 0xE7, 0xE0, 0x1E, 0x7E, 0x7E, 0x07, 0xC7,
+  0xE7, 0xE0, 0xF8, 0x7E, 0x7E, 0x1E, 0x07, 0xE7, 0xE3, 0xC0, 0x7E, 0x7E,
+  0x78, 0x07, 0xE7, 0xEF, 0x00, 0xFE, 0x3F, 0xE0, 0x0F, 0xC3, 0xFC, 0x01,
+  0xFC, 0x3F, 0x80, 0x1F, 0xC1, 0xFE, 0x07, 0xF8, 0x1F, 0xFF, 0xFF, 0x03,
+  0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x0F, 0x1F, 0xFF, 0x80, 0xE0, 0x7F,
+  0xC0, 0x04, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
+  0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
+  0x00, 0xFF, 0xF0, 0x07, 0xF7, 0xE0, 0x1F, 0x9F, 0xC0, 0xFE, 0x7F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00,
+  0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0,
+  0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03,
+  0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x07, 0xF7,
+  0xE0, 0x1F, 0x9F, 0xC0, 0xFE, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC1, 0xFF,
+  0xFE, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF8,
+  0x00, 0x3C, 0xF0, 0x00, 0xE1, 0xC0, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
+  0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x07, 0xF7, 0xE0, 0x1F, 0x9F, 0xC0, 0xFE,
+  0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x01,
+  0xFE, 0x00, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0x78, 0x01, 0xE1,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
+  0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
+  0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
+  0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
+  0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFD, 0xF8,
+  0x07, 0xE7, 0xF0, 0x3F, 0x9F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF,
+  0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x7F, 0x00, 0x3F, 0x8F,
+  0xE0, 0x1F, 0xC3, 0xFC, 0x0F, 0xF0, 0x7F, 0x03, 0xF8, 0x0F, 0xE1, 0xFC,
+  0x03, 0xFC, 0xFF, 0x00, 0x7F, 0x3F, 0x80, 0x0F, 0xFF, 0xC0, 0x03, 0xFF,
+  0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F,
+  0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x7F,
+  0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFC, 0x7F, 0xFF, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0xFF,
+  0xFF, 0x8F, 0xF0, 0x7C, 0x7F, 0x01, 0xF3, 0xF0, 0x0F, 0x9F, 0x81, 0xFC,
+  0xFC, 0x3F, 0xE7, 0xE3, 0xF0, 0x3F, 0x3E, 0x01, 0xF9, 0xF0, 0x0F, 0xCF,
+  0x80, 0x7E, 0x7F, 0x03, 0xF3, 0xFE, 0x1F, 0x8F, 0xFC, 0xFC, 0x3F, 0xF7,
+  0xE0, 0x7F, 0xBF, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x1F, 0xFE, 0x00,
+  0xFF, 0xF2, 0x0F, 0xFF, 0x9F, 0xFE, 0xFC, 0xFF, 0xF7, 0xE7, 0xFF, 0x3F,
+  0x0F, 0xE0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0x80, 0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x70, 0x3F, 0x88,
+  0x01, 0xF8, 0x00, 0x3F, 0x07, 0xFF, 0xE7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x7F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFC, 0xFF, 0xDF, 0x87, 0xE3, 0xF0, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xC3, 0xFF, 0xFC, 0x70, 0x3F, 0x88, 0x01, 0xF8, 0x00, 0x3F, 0x07,
+  0xFF, 0xE7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF8,
+  0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0xFF,
+  0xDF, 0x87, 0xE3, 0xF0, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x0E, 0xE0, 0x03,
+  0x8E, 0x00, 0xF1, 0xE0, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x80, 0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x70,
+  0x3F, 0x88, 0x01, 0xF8, 0x00, 0x3F, 0x07, 0xFF, 0xE7, 0xFF, 0xFD, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0xFF, 0xDF, 0x87, 0xE3, 0xF0, 0x01,
+  0xC3, 0x00, 0x7E, 0x60, 0x1F, 0xFC, 0x03, 0x3F, 0x00, 0x61, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x70, 0x3F, 0x88, 0x01, 0xF8, 0x00,
+  0x3F, 0x07, 0xFF, 0xE7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x7F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFC, 0xFF, 0xDF, 0x87, 0xE3, 0xF0, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x3C,
+  0x78, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0xFE, 0x1F, 0xFF, 0xE3, 0x81,
+  0xFC, 0x40, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0xFF, 0x3F, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF, 0x87,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xE7, 0xFE, 0xFC, 0x3F, 0x1F, 0x80, 0x00,
+  0xF0, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x03, 0xCF, 0x00, 0x70, 0xE0, 0x0E,
+  0x1C, 0x01, 0xE7, 0x80, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xFE, 0x0F, 0xFF, 0xE1, 0xFF,
+  0xFE, 0x38, 0x1F, 0xC4, 0x00, 0xFC, 0x00, 0x1F, 0x83, 0xFF, 0xF3, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x07, 0xFF, 0x81,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0x7F, 0xEF, 0xC3, 0xF1,
+  0xF8, 0x0F, 0xF8, 0x0F, 0xE0, 0x1F, 0xFF, 0x1F, 0xFC, 0x0F, 0xFF, 0xDF,
+  0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC3, 0x81, 0xFF, 0x87, 0xF1, 0x00, 0x3F,
+  0x81, 0xF8, 0x00, 0x1F, 0xC0, 0x7E, 0x0F, 0xFF, 0xC0, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7E, 0x00, 0x07, 0xE0, 0x7F, 0x80, 0x0B, 0xF8,
+  0x7F, 0xE0, 0x3D, 0xFF, 0xFB, 0xFF, 0xFE, 0x7F, 0xFC, 0xFF, 0xFF, 0x1F,
+  0xF8, 0x3F, 0xFF, 0x83, 0xF0, 0x03, 0xFF, 0x00, 0x01, 0xFE, 0x07, 0xFF,
+  0xC7, 0xFF, 0xE7, 0xFF, 0xF7, 0xF8, 0x3B, 0xF0, 0x07, 0xF8, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x03,
+  0xF0, 0x05, 0xFE, 0x0E, 0x7F, 0xFF, 0x1F, 0xFF, 0x87, 0xFF, 0xC0, 0x7F,
+  0x80, 0x06, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x70, 0x07, 0xF8, 0x03,
+  0xFC, 0x01, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83,
+  0xFF, 0xFE, 0x3F, 0xC3, 0xF9, 0xF8, 0x0F, 0xDF, 0xC0, 0x3E, 0xFC, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x01, 0xF8, 0x00, 0x4F, 0xE0, 0x1E, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x83, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00,
+  0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xE0, 0x3F,
+  0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0xC3, 0xF9, 0xF8, 0x0F, 0xDF, 0xC0, 0x3E,
+  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x4F, 0xE0, 0x1E, 0x3F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x77, 0x00, 0x07, 0x1C, 0x00, 0x78, 0xF0, 0x07, 0x83, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF,
+  0xE0, 0x3F, 0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0xC3, 0xF9, 0xF8, 0x0F, 0xDF,
+  0xC0, 0x3E, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x4F, 0xE0, 0x1E, 0x3F,
+  0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x07, 0x8F,
+  0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xFC,
+  0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xF8, 0x7F, 0x3F, 0x01, 0xFB, 0xF8,
+  0x07, 0xDF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x09, 0xFC, 0x03, 0xC7, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x7F, 0xE0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x7E,
+  0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F,
+  0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x00, 0x07,
+  0x80, 0x3F, 0x01, 0xFE, 0x0F, 0x3C, 0x38, 0x71, 0xC0, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
+  0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
+  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
+  0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F,
+  0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x07, 0xE0,
+  0x20, 0x1F, 0x9F, 0x00, 0x7F, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
+  0xFF, 0x00, 0x38, 0xFC, 0x01, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x1F, 0xFE,
+  0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0xE7, 0xFF, 0xFF, 0x3F, 0x83, 0xFB, 0xF8,
+  0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F,
+  0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xF9, 0xFC, 0x1F, 0xC7, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0x83, 0x00,
+  0xFC, 0x60, 0x3F, 0xFC, 0x06, 0x3F, 0x00, 0xC1, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC3, 0xF3, 0xFE, 0x7F,
+  0xFF, 0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF0, 0x3F, 0xFC,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8,
+  0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x1F, 0xFE, 0x03, 0xF0, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83,
+  0xFF, 0xFE, 0x3F, 0x83, 0xF9, 0xF8, 0x0F, 0xDF, 0xC0, 0x7F, 0xFC, 0x01,
+  0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x01, 0xFD, 0xF8, 0x0F, 0xCF, 0xE0, 0xFE, 0x3F, 0xFF, 0xE0, 0xFF, 0xFE,
+  0x03, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00,
+  0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xE0, 0x3F,
+  0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0x83, 0xF9, 0xF8, 0x0F, 0xDF, 0xC0, 0x7F,
+  0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0,
+  0x1F, 0xFF, 0x01, 0xFD, 0xF8, 0x0F, 0xCF, 0xE0, 0xFE, 0x3F, 0xFF, 0xE0,
+  0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x77, 0x00, 0x07, 0x1C, 0x00, 0x78, 0x70, 0x07, 0x83, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF,
+  0xE0, 0x3F, 0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0x83, 0xF9, 0xF8, 0x0F, 0xDF,
+  0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03,
+  0xFF, 0xC0, 0x1F, 0xFF, 0x01, 0xFD, 0xF8, 0x0F, 0xCF, 0xE0, 0xFE, 0x3F,
+  0xFF, 0xE0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x03, 0xC1,
+  0x80, 0x3F, 0x9C, 0x03, 0xFF, 0xE0, 0x1C, 0xFE, 0x00, 0xC1, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
+  0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83, 0xFF, 0xFE, 0x3F, 0x83, 0xF9, 0xF8,
+  0x0F, 0xDF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F,
+  0xF8, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x01, 0xFD, 0xF8, 0x0F, 0xCF, 0xE0,
+  0xFE, 0x3F, 0xFF, 0xE0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x07, 0xF8, 0x00,
+  0x07, 0x8F, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
+  0x7F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xF0, 0x7F, 0x3F, 0x01,
+  0xFB, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
+  0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xBF, 0x01, 0xF9, 0xFC, 0x1F,
+  0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0xFF, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+  0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00,
+  0x00, 0x10, 0x0F, 0xF1, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFE,
+  0x3F, 0x83, 0xF9, 0xF8, 0x1F, 0xDF, 0xC1, 0xFF, 0xFC, 0x1D, 0xFF, 0xE1,
+  0xCF, 0xFF, 0x1C, 0x7F, 0xF9, 0xC3, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFD,
+  0xFC, 0x0F, 0xCF, 0xE0, 0xFE, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xE1, 0xC7, 0xF8, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF,
+  0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF,
+  0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF,
+  0x87, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFC, 0xFF, 0x9F, 0x87,
+  0xE3, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF,
+  0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE,
+  0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xEF, 0xFF, 0xFC, 0xFF, 0x9F, 0x87, 0xE3, 0xF0, 0x01, 0xF0, 0x00,
+  0x7F, 0x00, 0x0E, 0xE0, 0x03, 0x8E, 0x00, 0xF1, 0xE0, 0x3C, 0x1E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0xF0, 0x1F, 0xFE,
+  0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8,
+  0x1F, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFC, 0xFF,
+  0x9F, 0x87, 0xE3, 0xF0, 0x0F, 0x1E, 0x01, 0xE3, 0xC0, 0x3C, 0x78, 0x07,
+  0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8,
+  0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0,
+  0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xE7, 0xFC, 0xFC, 0x3F, 0x1F, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07,
+  0xF7, 0xE0, 0x1F, 0x9F, 0xC0, 0x7E, 0x3F, 0x03, 0xF8, 0xFE, 0x0F, 0xC3,
+  0xF8, 0x7F, 0x07, 0xE1, 0xF8, 0x1F, 0xC7, 0xE0, 0x3F, 0x3F, 0x80, 0xFE,
+  0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xFE,
+  0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
+  0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
+  0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x07, 0xE7, 0xFC,
+  0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF0, 0x7F, 0x7F, 0x01, 0xFB, 0xF8,
+  0x0F, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F,
+  0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFB, 0xFC, 0x1F, 0xDF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xC7, 0xE7, 0xFC, 0x3F, 0x1F, 0x81, 0xF8, 0x00, 0x0F,
+  0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00,
+  0x07, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78,
+  0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x01, 0xFD, 0xF8, 0x07, 0xE7, 0xF0, 0x1F, 0x8F, 0xC0,
+  0xFE, 0x3F, 0x83, 0xF0, 0xFE, 0x1F, 0xC1, 0xF8, 0x7E, 0x07, 0xF1, 0xF8,
+  0x0F, 0xCF, 0xE0, 0x3F, 0xBF, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x03,
+  0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFE,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00,
+  0x07, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
+  0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Bold18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   6,  26,  16,    5,  -25 },   // 0x21 '!'
+  {    21,  11,   9,  18,    3,  -25 },   // 0x22 '"'
+  {    34,  25,  26,  29,    2,  -25 },   // 0x23 '#'
+  {   116,  19,  32,  24,    3,  -26 },   // 0x24 '$'
+  {   192,  33,  26,  35,    1,  -25 },   // 0x25 '%'
+  {   300,  27,  26,  31,    2,  -25 },   // 0x26 '&'
+  {   388,   4,   9,  11,    3,  -25 },   // 0x27 '''
+  {   393,  10,  31,  16,    3,  -26 },   // 0x28 '('
+  {   432,  10,  31,  16,    3,  -26 },   // 0x29 ')'
+  {   471,  17,  16,  18,    1,  -25 },   // 0x2A '*'
+  {   505,  22,  22,  29,    4,  -21 },   // 0x2B '+'
+  {   566,   8,  12,  13,    2,   -6 },   // 0x2C ','
+  {   578,  11,   5,  15,    2,  -12 },   // 0x2D '-'
+  {   585,   6,   7,  13,    4,   -6 },   // 0x2E '.'
+  {   591,  13,  29,  13,    0,  -25 },   // 0x2F '/'
+  {   639,  21,  26,  24,    2,  -25 },   // 0x30 '0'
+  {   708,  18,  26,  24,    4,  -25 },   // 0x31 '1'
+  {   767,  19,  26,  24,    3,  -25 },   // 0x32 '2'
+  {   829,  19,  26,  24,    2,  -25 },   // 0x33 '3'
+  {   891,  22,  26,  24,    2,  -25 },   // 0x34 '4'
+  {   963,  19,  26,  24,    3,  -25 },   // 0x35 '5'
+  {  1025,  20,  26,  24,    2,  -25 },   // 0x36 '6'
+  {  1090,  19,  26,  24,    2,  -25 },   // 0x37 '7'
+  {  1152,  20,  26,  24,    2,  -25 },   // 0x38 '8'
+  {  1217,  20,  26,  24,    2,  -25 },   // 0x39 '9'
+  {  1282,   6,  19,  14,    4,  -18 },   // 0x3A ':'
+  {  1297,   8,  24,  14,    2,  -18 },   // 0x3B ';'
+  {  1321,  22,  20,  29,    4,  -20 },   // 0x3C '<'
+  {  1376,  22,  12,  29,    4,  -16 },   // 0x3D '='
+  {  1409,  22,  20,  29,    4,  -20 },   // 0x3E '>'
+  {  1464,  16,  26,  20,    2,  -25 },   // 0x3F '?'
+  {  1516,  30,  31,  35,    2,  -25 },   // 0x40 '@'
+  {  1633,  27,  26,  27,    0,  -25 },   // 0x41 'A'
+  {  1721,  21,  26,  27,    3,  -25 },   // 0x42 'B'
+  {  1790,  22,  26,  26,    2,  -25 },   // 0x43 'C'
+  {  1862,  24,  26,  29,    3,  -25 },   // 0x44 'D'
+  {  1940,  18,  26,  24,    3,  -25 },   // 0x45 'E'
+  {  1999,  18,  26,  24,    3,  -25 },   // 0x46 'F'
+  {  2058,  24,  26,  29,    2,  -25 },   // 0x47 'G'
+  {  2136,  23,  26,  29,    3,  -25 },   // 0x48 'H'
+  {  2211,   6,  26,  13,    3,  -25 },   // 0x49 'I'
+  {  2231,  11,  33,  13,   -2,  -25 },   // 0x4A 'J'
+  {  2277,  25,  26,  27,    3,  -25 },   // 0x4B 'K'
+  {  2359,  18,  26,  22,    3,  -25 },   // 0x4C 'L'
+  {  2418,  28,  26,  35,    3,  -25 },   // 0x4D 'M'
+  {  2509,  23,  26,  29,    3,  -25 },   // 0x4E 'N'
+  {  2584,  26,  26,  30,    2,  -25 },   // 0x4F 'O'
+  {  2669,  21,  26,  26,    3,  -25 },   // 0x50 'P'
+  {  2738,  26,  31,  30,    2,  -25 },   // 0x51 'Q'
+  {  2839,  23,  26,  27,    3,  -25 },   // 0x52 'R'
+  {  2914,  20,  26,  25,    3,  -25 },   // 0x53 'S'
+  {  2979,  22,  26,  24,    1,  -25 },   // 0x54 'T'
+  {  3051,  22,  26,  28,    3,  -25 },   // 0x55 'U'
+  {  3123,  27,  26,  27,    0,  -25 },   // 0x56 'V'
+  {  3211,  36,  26,  39,    1,  -25 },   // 0x57 'W'
+  {  3328,  26,  26,  27,    1,  -25 },   // 0x58 'X'
+  {  3413,  26,  26,  25,   -1,  -25 },   // 0x59 'Y'
+  {  3498,  22,  26,  25,    2,  -25 },   // 0x5A 'Z'
+  {  3570,  11,  31,  16,    3,  -26 },   // 0x5B '['
+  {  3613,  13,  29,  13,    0,  -25 },   // 0x5C '\'
+  {  3661,  11,  31,  16,    2,  -26 },   // 0x5D ']'
+  {  3704,  22,  10,  29,    4,  -25 },   // 0x5E '^'
+  {  3732,  18,   3,  18,    0,    6 },   // 0x5F '_'
+  {  3739,  10,   6,  18,    2,  -27 },   // 0x60 '`'
+  {  3747,  19,  19,  24,    2,  -18 },   // 0x61 'a'
+  {  3793,  21,  27,  25,    3,  -26 },   // 0x62 'b'
+  {  3864,  17,  19,  21,    2,  -18 },   // 0x63 'c'
+  {  3905,  21,  27,  25,    2,  -26 },   // 0x64 'd'
+  {  3976,  21,  19,  24,    2,  -18 },   // 0x65 'e'
+  {  4026,  15,  27,  15,    1,  -26 },   // 0x66 'f'
+  {  4077,  21,  26,  25,    2,  -18 },   // 0x67 'g'
+  {  4146,  19,  27,  25,    3,  -26 },   // 0x68 'h'
+  {  4211,   6,  27,  12,    3,  -26 },   // 0x69 'i'
+  {  4232,  10,  34,  12,   -1,  -26 },   // 0x6A 'j'
+  {  4275,  21,  27,  23,    3,  -26 },   // 0x6B 'k'
+  {  4346,   6,  27,  12,    3,  -26 },   // 0x6C 'l'
+  {  4367,  30,  19,  36,    3,  -18 },   // 0x6D 'm'
+  {  4439,  19,  19,  25,    3,  -18 },   // 0x6E 'n'
+  {  4485,  21,  19,  24,    2,  -18 },   // 0x6F 'o'
+  {  4535,  21,  26,  25,    3,  -18 },   // 0x70 'p'
+  {  4604,  21,  26,  25,    2,  -18 },   // 0x71 'q'
+  {  4673,  14,  19,  17,    3,  -18 },   // 0x72 'r'
+  {  4707,  17,  19,  21,    2,  -18 },   // 0x73 's'
+  {  4748,  15,  25,  17,    1,  -24 },   // 0x74 't'
+  {  4795,  19,  19,  25,    3,  -18 },   // 0x75 'u'
+  {  4841,  22,  19,  23,    1,  -18 },   // 0x76 'v'
+  {  4894,  30,  19,  32,    1,  -18 },   // 0x77 'w'
+  {  4966,  22,  19,  23,    1,  -18 },   // 0x78 'x'
+  {  5019,  22,  26,  23,    0,  -18 },   // 0x79 'y'
+  {  5091,  17,  19,  20,    2,  -18 },   // 0x7A 'z'
+  {  5132,  16,  32,  25,    5,  -26 },   // 0x7B '{'
+  {  5196,   4,  35,  13,    4,  -26 },   // 0x7C '|'
+  {  5214,  16,  32,  25,    4,  -26 },   // 0x7D '}'
+  {  5278,  22,   7,  29,    4,  -13 },   // 0x7E '~'
+  {  5298,  18,  31,  21,    2,  -24 },   // 0x7F
+  {  5368,  18,  31,  21,    2,  -24 },   // 0x80
+  {  5438,  18,  31,  21,    2,  -24 },   // 0x81
+  {  5508,  18,  31,  21,    2,  -24 },   // 0x82
+  {  5578,  18,  31,  21,    2,  -24 },   // 0x83
+  {  5648,  18,  31,  21,    2,  -24 },   // 0x84
+  {  5718,  18,  31,  21,    2,  -24 },   // 0x85
+  {  5788,  18,  31,  21,    2,  -24 },   // 0x86
+  {  5858,  18,  31,  21,    2,  -24 },   // 0x87
+  {  5928,  18,  31,  21,    2,  -24 },   // 0x88
+  {  5998,  18,  31,  21,    2,  -24 },   // 0x89
+  {  6068,  18,  31,  21,    2,  -24 },   // 0x8A
+  {  6138,  18,  31,  21,    2,  -24 },   // 0x8B
+  {  6208,  18,  31,  21,    2,  -24 },   // 0x8C
+  {  6278,  18,  31,  21,    2,  -24 },   // 0x8D
+  {  6348,  18,  31,  21,    2,  -24 },   // 0x8E
+  {  6418,  18,  31,  21,    2,  -24 },   // 0x8F
+  {  6488,  18,  31,  21,    2,  -24 },   // 0x90
+  {  6558,  18,  31,  21,    2,  -24 },   // 0x91
+  {  6628,  18,  31,  21,    2,  -24 },   // 0x92
+  {  6698,  18,  31,  21,    2,  -24 },   // 0x93
+  {  6768,  18,  31,  21,    2,  -24 },   // 0x94
+  {  6838,  18,  31,  21,    2,  -24 },   // 0x95
+  {  6908,  18,  31,  21,    2,  -24 },   // 0x96
+  {  6978,  18,  31,  21,    2,  -24 },   // 0x97
+  {  7048,  18,  31,  21,    2,  -24 },   // 0x98
+  {  7118,  18,  31,  21,    2,  -24 },   // 0x99
+  {  7188,  18,  31,  21,    2,  -24 },   // 0x9A
+  {  7258,  18,  31,  21,    2,  -24 },   // 0x9B
+  {  7328,  18,  31,  21,    2,  -24 },   // 0x9C
+  {  7398,  18,  31,  21,    2,  -24 },   // 0x9D
+  {  7468,  18,  31,  21,    2,  -24 },   // 0x9E
+  {  7538,  18,  31,  21,    2,  -24 },   // 0x9F
+  {  7608,   1,   1,  12,    0,    0 },   // 0xA0
+  {  7609,   6,  26,  16,    5,  -18 },   // 0xA1
+  {  7629,  17,  29,  24,    3,  -23 },   // 0xA2
+  {  7691,  19,  26,  24,    2,  -25 },   // 0xA3
+  {  7753,  21,  21,  22,    1,  -20 },   // 0xA4
+  {  7809,  24,  26,  24,    0,  -25 },   // 0xA5
+  {  7887,   4,  30,  13,    4,  -23 },   // 0xA6
+  {  7902,  17,  29,  18,    1,  -25 },   // 0xA7
+  {  7964,  11,   4,  18,    3,  -26 },   // 0xA8
+  {  7970,  25,  25,  35,    5,  -24 },   // 0xA9
+  {  8049,  14,  19,  20,    3,  -25 },   // 0xAA
+  {  8083,  16,  16,  23,    3,  -17 },   // 0xAB
+  {  8115,  22,  11,  29,    4,  -15 },   // 0xAC
+  {  8146,  11,   5,  15,    2,  -12 },   // 0xAD
+  {  8153,  25,  25,  35,    5,  -24 },   // 0xAE
+  {  8232,  11,   3,  18,    3,  -26 },   // 0xAF
+  {  8237,  11,  11,  18,    3,  -25 },   // 0xB0
+  {  8253,  22,  22,  29,    4,  -21 },   // 0xB1
+  {  8314,  12,  15,  15,    2,  -25 },   // 0xB2
+  {  8337,  12,  15,  15,    2,  -25 },   // 0xB3
+  {  8360,  10,   6,  18,    6,  -27 },   // 0xB4
+  {  8368,  21,  26,  26,    3,  -18 },   // 0xB5
+  {  8437,  16,  29,  22,    3,  -25 },   // 0xB6
+  {  8495,   6,   7,  13,    4,  -14 },   // 0xB7
+  {  8501,   8,   7,  18,    5,    1 },   // 0xB8
+  {  8508,  12,  15,  15,    2,  -25 },   // 0xB9
+  {  8531,  16,  19,  20,    2,  -25 },   // 0xBA
+  {  8569,  16,  16,  23,    3,  -17 },   // 0xBB
+  {  8601,  32,  26,  36,    2,  -25 },   // 0xBC
+  {  8705,  33,  26,  36,    2,  -25 },   // 0xBD
+  {  8813,  32,  26,  36,    2,  -25 },   // 0xBE
+  {  8917,  16,  26,  20,    2,  -18 },   // 0xBF
+  {  8969,  27,  33,  27,    0,  -32 },   // 0xC0
+  {  9081,  27,  33,  27,    0,  -32 },   // 0xC1
+  {  9193,  27,  33,  27,    0,  -32 },   // 0xC2
+  {  9305,  27,  33,  27,    0,  -32 },   // 0xC3
+  {  9417,  27,  32,  27,    0,  -31 },   // 0xC4
+  {  9525,  27,  32,  27,    0,  -31 },   // 0xC5
+  {  9633,  35,  26,  38,    0,  -25 },   // 0xC6
+  {  9747,  22,  33,  26,    2,  -25 },   // 0xC7
+  {  9838,  18,  33,  24,    3,  -32 },   // 0xC8
+  {  9913,  18,  33,  24,    3,  -32 },   // 0xC9
+  {  9988,  18,  33,  24,    3,  -32 },   // 0xCA
+  { 10063,  18,  32,  24,    3,  -31 },   // 0xCB
+  { 10135,   8,  33,  13,    1,  -32 },   // 0xCC
+  { 10168,   9,  33,  13,    3,  -32 },   // 0xCD
+  { 10206,  14,  33,  13,   -1,  -32 },   // 0xCE
+  { 10264,  10,  32,  13,    1,  -31 },   // 0xCF
+  { 10304,  27,  26,  29,    0,  -25 },   // 0xD0
+  { 10392,  23,  33,  29,    3,  -32 },   // 0xD1
+  { 10487,  26,  33,  30,    2,  -32 },   // 0xD2
+  { 10595,  26,  33,  30,    2,  -32 },   // 0xD3
+  { 10703,  26,  33,  30,    2,  -32 },   // 0xD4
+  { 10811,  26,  33,  30,    2,  -32 },   // 0xD5
+  { 10919,  26,  32,  30,    2,  -31 },   // 0xD6
+  { 11023,  21,  21,  29,    4,  -20 },   // 0xD7
+  { 11079,  28,  28,  30,    1,  -26 },   // 0xD8
+  { 11177,  22,  33,  28,    3,  -32 },   // 0xD9
+  { 11268,  22,  33,  28,    3,  -32 },   // 0xDA
+  { 11359,  22,  33,  28,    3,  -32 },   // 0xDB
+  { 11450,  22,  32,  28,    3,  -31 },   // 0xDC
+  { 11538,  26,  33,  25,   -1,  -32 },   // 0xDD
+  { 11646,  21,  26,  26,    3,  -25 },   // 0xDE
+  { 11715,  21,  27,  25,    3,  -26 },   // 0xDF
+  { 11786,  19,  28,  24,    2,  -27 },   // 0xE0
+  { 11853,  19,  28,  24,    2,  -27 },   // 0xE1
+  { 11920,  19,  28,  24,    2,  -27 },   // 0xE2
+  { 11987,  19,  28,  24,    2,  -27 },   // 0xE3
+  { 12054,  19,  27,  24,    2,  -26 },   // 0xE4
+  { 12119,  19,  31,  24,    2,  -30 },   // 0xE5
+  { 12193,  33,  19,  37,    2,  -18 },   // 0xE6
+  { 12272,  17,  26,  21,    2,  -18 },   // 0xE7
+  { 12328,  21,  28,  24,    2,  -27 },   // 0xE8
+  { 12402,  21,  28,  24,    2,  -27 },   // 0xE9
+  { 12476,  21,  28,  24,    2,  -27 },   // 0xEA
+  { 12550,  21,  27,  24,    2,  -26 },   // 0xEB
+  { 12621,  10,  28,  12,    0,  -27 },   // 0xEC
+  { 12656,  11,  28,  12,    3,  -27 },   // 0xED
+  { 12695,  14,  28,  12,   -1,  -27 },   // 0xEE
+  { 12744,  10,  27,  12,    1,  -26 },   // 0xEF
+  { 12778,  21,  27,  24,    2,  -26 },   // 0xF0
+  { 12849,  19,  28,  25,    3,  -27 },   // 0xF1
+  { 12916,  21,  28,  24,    2,  -27 },   // 0xF2
+  { 12990,  21,  28,  24,    2,  -27 },   // 0xF3
+  { 13064,  21,  28,  24,    2,  -27 },   // 0xF4
+  { 13138,  21,  28,  24,    2,  -27 },   // 0xF5
+  { 13212,  21,  27,  24,    2,  -26 },   // 0xF6
+  { 13283,  21,  18,  29,    4,  -19 },   // 0xF7
+  { 13331,  21,  21,  24,    2,  -19 },   // 0xF8
+  { 13387,  19,  28,  25,    3,  -27 },   // 0xF9
+  { 13454,  19,  28,  25,    3,  -27 },   // 0xFA
+  { 13521,  19,  28,  25,    3,  -27 },   // 0xFB
+  { 13588,  19,  27,  25,    3,  -26 },   // 0xFC
+  { 13653,  22,  35,  23,    0,  -27 },   // 0xFD
+  { 13750,  21,  34,  25,    3,  -26 },   // 0xFE
+  { 13840,  22,  34,  23,    0,  -26 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold18pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold18pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold18pt8bGlyphs,
+  0x20, 0xFF, 41 };
+
+// Approx. 15509 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold18pt8bMetrics[] PROGMEM = {
+  {   0,  12,   1 },   // 0x20
+  {   5,  16,  11 },   // 0x21
+  {   3,  18,  14 },   // 0x22
+  {   2,  29,  27 },   // 0x23
+  {   3,  24,  22 },   // 0x24
+  {   1,  35,  34 },   // 0x25
+  {   2,  31,  29 },   // 0x26
+  {   3,  11,   7 },   // 0x27
+  {   3,  16,  13 },   // 0x28
+  {   3,  16,  13 },   // 0x29
+  {   1,  18,  18 },   // 0x2A
+  {   4,  29,  26 },   // 0x2B
+  {   2,  13,  10 },   // 0x2C
+  {   2,  15,  13 },   // 0x2D
+  {   4,  13,  10 },   // 0x2E
+  {   0,  13,  13 },   // 0x2F
+  {   2,  24,  23 },   // 0x30
+  {   4,  24,  22 },   // 0x31
+  {   3,  24,  22 },   // 0x32
+  {   2,  24,  21 },   // 0x33
+  {   2,  24,  24 },   // 0x34
+  {   3,  24,  22 },   // 0x35
+  {   2,  24,  22 },   // 0x36
+  {   2,  24,  21 },   // 0x37
+  {   2,  24,  22 },   // 0x38
+  {   2,  24,  22 },   // 0x39
+  {   4,  14,  10 },   // 0x3A
+  {   2,  14,  10 },   // 0x3B
+  {   4,  29,  26 },   // 0x3C
+  {   4,  29,  26 },   // 0x3D
+  {   4,  29,  26 },   // 0x3E
+  {   2,  20,  18 },   // 0x3F
+  {   2,  35,  32 },   // 0x40
+  {   0,  27,  27 },   // 0x41
+  {   3,  27,  24 },   // 0x42
+  {   2,  26,  24 },   // 0x43
+  {   3,  29,  27 },   // 0x44
+  {   3,  24,  21 },   // 0x45
+  {   3,  24,  21 },   // 0x46
+  {   2,  29,  26 },   // 0x47
+  {   3,  29,  26 },   // 0x48
+  {   3,  13,   9 },   // 0x49
+  {  -2,  13,   9 },   // 0x4A
+  {   3,  27,  28 },   // 0x4B
+  {   3,  22,  21 },   // 0x4C
+  {   3,  35,  31 },   // 0x4D
+  {   3,  29,  26 },   // 0x4E
+  {   2,  30,  28 },   // 0x4F
+  {   3,  26,  24 },   // 0x50
+  {   2,  30,  28 },   // 0x51
+  {   3,  27,  26 },   // 0x52
+  {   3,  25,  23 },   // 0x53
+  {   1,  24,  23 },   // 0x54
+  {   3,  28,  25 },   // 0x55
+  {   0,  27,  27 },   // 0x56
+  {   1,  39,  37 },   // 0x57
+  {   1,  27,  27 },   // 0x58
+  {  -1,  25,  25 },   // 0x59
+  {   2,  25,  24 },   // 0x5A
+  {   3,  16,  14 },   // 0x5B
+  {   0,  13,  13 },   // 0x5C
+  {   2,  16,  13 },   // 0x5D
+  {   4,  29,  26 },   // 0x5E
+  {   0,  18,  18 },   // 0x5F
+  {   2,  18,  12 },   // 0x60
+  {   2,  24,  21 },   // 0x61
+  {   3,  25,  24 },   // 0x62
+  {   2,  21,  19 },   // 0x63
+  {   2,  25,  23 },   // 0x64
+  {   2,  24,  23 },   // 0x65
+  {   1,  15,  16 },   // 0x66
+  {   2,  25,  23 },   // 0x67
+  {   3,  25,  22 },   // 0x68
+  {   3,  12,   9 },   // 0x69
+  {  -1,  12,   9 },   // 0x6A
+  {   3,  23,  24 },   // 0x6B
+  {   3,  12,   9 },   // 0x6C
+  {   3,  36,  33 },   // 0x6D
+  {   3,  25,  22 },   // 0x6E
+  {   2,  24,  23 },   // 0x6F
+  {   3,  25,  24 },   // 0x70
+  {   2,  25,  23 },   // 0x71
+  {   3,  17,  17 },   // 0x72
+  {   2,  21,  19 },   // 0x73
+  {   1,  17,  16 },   // 0x74
+  {   3,  25,  22 },   // 0x75
+  {   1,  23,  23 },   // 0x76
+  {   1,  32,  31 },   // 0x77
+  {   1,  23,  23 },   // 0x78
+  {   0,  23,  22 },   // 0x79
+  {   2,  20,  19 },   // 0x7A
+  {   5,  25,  21 },   // 0x7B
+  {   4,  13,   8 },   // 0x7C
+  {   4,  25,  20 },   // 0x7D
+  {   4,  29,  26 },   // 0x7E
+  {   2,  21,  20 },   // 0x7F
+  {   2,  21,  20 },   // 0x80
+  {   2,  21,  20 },   // 0x81
+  {   2,  21,  20 },   // 0x82
+  {   2,  21,  20 },   // 0x83
+  {   2,  21,  20 },   // 0x84
+  {   2,  21,  20 },   // 0x85
+  {   2,  21,  20 },   // 0x86
+  {   2,  21,  20 },   // 0x87
+  {   2,  21,  20 },   // 0x88
+  {   2,  21,  20 },   // 0x89
+  {   2,  21,  20 },   // 0x8A
+  {   2,  21,  20 },   // 0x8B
+  {   2,  21,  20 },   // 0x8C
+  {   2,  21,  20 },   // 0x8D
+  {   2,  21,  20 },   // 0x8E
+  {   2,  21,  20 },   // 0x8F
+  {   2,  21,  20 },   // 0x90
+  {   2,  21,  20 },   // 0x91
+  {   2,  21,  20 },   // 0x92
+  {   2,  21,  20 },   // 0x93
+  {   2,  21,  20 },   // 0x94
+  {   2,  21,  20 },   // 0x95
+  {   2,  21,  20 },   // 0x96
+  {   2,  21,  20 },   // 0x97
+  {   2,  21,  20 },   // 0x98
+  {   2,  21,  20 },   // 0x99
+  {   2,  21,  20 },   // 0x9A
+  {   2,  21,  20 },   // 0x9B
+  {   2,  21,  20 },   // 0x9C
+  {   2,  21,  20 },   // 0x9D
+  {   2,  21,  20 },   // 0x9E
+  {   2,  21,  20 },   // 0x9F
+  {   0,  12,   1 },   // 0xA0
+  {   5,  16,  11 },   // 0xA1
+  {   3,  24,  20 },   // 0xA2
+  {   2,  24,  21 },   // 0xA3
+  {   1,  22,  22 },   // 0xA4
+  {   0,  24,  24 },   // 0xA5
+  {   4,  13,   8 },   // 0xA6
+  {   1,  18,  18 },   // 0xA7
+  {   3,  18,  14 },   // 0xA8
+  {   5,  35,  30 },   // 0xA9
+  {   3,  20,  17 },   // 0xAA
+  {   3,  23,  19 },   // 0xAB
+  {   4,  29,  26 },   // 0xAC
+  {   2,  15,  13 },   // 0xAD
+  {   5,  35,  30 },   // 0xAE
+  {   3,  18,  14 },   // 0xAF
+  {   3,  18,  14 },   // 0xB0
+  {   4,  29,  26 },   // 0xB1
+  {   2,  15,  14 },   // 0xB2
+  {   2,  15,  14 },   // 0xB3
+  {   6,  18,  16 },   // 0xB4
+  {   3,  26,  24 },   // 0xB5
+  {   3,  22,  19 },   // 0xB6
+  {   4,  13,  10 },   // 0xB7
+  {   5,  18,  13 },   // 0xB8
+  {   2,  15,  14 },   // 0xB9
+  {   2,  20,  18 },   // 0xBA
+  {   3,  23,  19 },   // 0xBB
+  {   2,  36,  34 },   // 0xBC
+  {   2,  36,  35 },   // 0xBD
+  {   2,  36,  34 },   // 0xBE
+  {   2,  20,  18 },   // 0xBF
+  {   0,  27,  27 },   // 0xC0
+  {   0,  27,  27 },   // 0xC1
+  {   0,  27,  27 },   // 0xC2
+  {   0,  27,  27 },   // 0xC3
+  {   0,  27,  27 },   // 0xC4
+  {   0,  27,  27 },   // 0xC5
+  {   0,  38,  35 },   // 0xC6
+  {   2,  26,  24 },   // 0xC7
+  {   3,  24,  21 },   // 0xC8
+  {   3,  24,  21 },   // 0xC9
+  {   3,  24,  21 },   // 0xCA
+  {   3,  24,  21 },   // 0xCB
+  {   1,  13,   9 },   // 0xCC
+  {   3,  13,  12 },   // 0xCD
+  {  -1,  13,  13 },   // 0xCE
+  {   1,  13,  11 },   // 0xCF
+  {   0,  29,  27 },   // 0xD0
+  {   3,  29,  26 },   // 0xD1
+  {   2,  30,  28 },   // 0xD2
+  {   2,  30,  28 },   // 0xD3
+  {   2,  30,  28 },   // 0xD4
+  {   2,  30,  28 },   // 0xD5
+  {   2,  30,  28 },   // 0xD6
+  {   4,  29,  25 },   // 0xD7
+  {   1,  30,  29 },   // 0xD8
+  {   3,  28,  25 },   // 0xD9
+  {   3,  28,  25 },   // 0xDA
+  {   3,  28,  25 },   // 0xDB
+  {   3,  28,  25 },   // 0xDC
+  {  -1,  25,  25 },   // 0xDD
+  {   3,  26,  24 },   // 0xDE
+  {   3,  25,  24 },   // 0xDF
+  {   2,  24,  21 },   // 0xE0
+  {   2,  24,  21 },   // 0xE1
+  {   2,  24,  21 },   // 0xE2
+  {   2,  24,  21 },   // 0xE3
+  {   2,  24,  21 },   // 0xE4
+  {   2,  24,  21 },   // 0xE5
+  {   2,  37,  35 },   // 0xE6
+  {   2,  21,  19 },   // 0xE7
+  {   2,  24,  23 },   // 0xE8
+  {   2,  24,  23 },   // 0xE9
+  {   2,  24,  23 },   // 0xEA
+  {   2,  24,  23 },   // 0xEB
+  {   0,  12,  10 },   // 0xEC
+  {   3,  12,  14 },   // 0xED
+  {  -1,  12,  13 },   // 0xEE
+  {   1,  12,  11 },   // 0xEF
+  {   2,  24,  23 },   // 0xF0
+  {   3,  25,  22 },   // 0xF1
+  {   2,  24,  23 },   // 0xF2
+  {   2,  24,  23 },   // 0xF3
+  {   2,  24,  23 },   // 0xF4
+  {   2,  24,  23 },   // 0xF5
+  {   2,  24,  23 },   // 0xF6
+  {   4,  29,  25 },   // 0xF7
+  {   2,  24,  23 },   // 0xF8
+  {   3,  25,  22 },   // 0xF9
+  {   3,  25,  22 },   // 0xFA
+  {   3,  25,  22 },   // 0xFB
+  {   3,  25,  22 },   // 0xFC
+  {   0,  23,  22 },   // 0xFD
+  {   3,  25,  24 },   // 0xFE
+  {   0,  23,  22 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold18pt8bWidths = { DejaVuSans_Bold18pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD18PTLAT1__H
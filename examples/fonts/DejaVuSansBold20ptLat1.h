@@ -0,0 +1,1892 @@
+#ifndef DEJAVUSANSBOLD20PTLAT1__H
+#define DEJAVUSANSBOLD20PTLAT1__H
+const uint8_t DejaVuSans_Bold20pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xDF, 0x3E, 0x7C, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF0, 0x00, 0x3C, 0x1F, 0x00, 0x07,
+  0x83, 0xC0, 0x00, 0xF0, 0x78, 0x00, 0x1E, 0x0F, 0x00, 0x07, 0x83, 0xE0,
+  0x00, 0xF0, 0x78, 0x00, 0x1E, 0x0F, 0x00, 0x03, 0xC1, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xE7, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xF0,
+  0x1F, 0x0F, 0x80, 0x03, 0xC1, 0xE0, 0x00, 0x78, 0x3C, 0x00, 0x0F, 0x07,
+  0x80, 0x03, 0xC1, 0xF0, 0x1F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFE, 0x7F,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF8, 0x0F, 0x07, 0x80, 0x01, 0xE0, 0xF0,
+  0x00, 0x3C, 0x1E, 0x00, 0x0F, 0x87, 0xC0, 0x01, 0xE0, 0xF0, 0x00, 0x3C,
+  0x1E, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
+  0x1C, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFC, 0x7E, 0x71, 0xE7, 0xE3, 0x81, 0x3F, 0x1C, 0x01, 0xF8,
+  0xE0, 0x0F, 0xE7, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x81, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x07,
+  0x3F, 0x80, 0x38, 0xFC, 0x01, 0xC7, 0xF0, 0x0E, 0x3F, 0xF0, 0x73, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xF9, 0xFF, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x38,
+  0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
+  0x1C, 0x00, 0x0F, 0xE0, 0x00, 0x78, 0x00, 0xFF, 0x80, 0x07, 0xC0, 0x0F,
+  0xFE, 0x00, 0x3C, 0x00, 0xF8, 0xF8, 0x03, 0xE0, 0x0F, 0x87, 0xE0, 0x1E,
+  0x00, 0x7C, 0x1F, 0x01, 0xE0, 0x03, 0xE0, 0xF8, 0x1F, 0x00, 0x1F, 0x07,
+  0xC0, 0xF0, 0x00, 0xF8, 0x3E, 0x0F, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x00,
+  0x3E, 0x1F, 0x87, 0x80, 0x00, 0xF8, 0xF8, 0x7C, 0x00, 0x03, 0xFF, 0x83,
+  0xC0, 0x00, 0x0F, 0xF8, 0x3C, 0x00, 0x00, 0x3F, 0x83, 0xE0, 0xFE, 0x00,
+  0x00, 0x1E, 0x0F, 0xF8, 0x00, 0x01, 0xE0, 0xFF, 0xE0, 0x00, 0x1F, 0x0F,
+  0x8F, 0x80, 0x00, 0xF0, 0xF8, 0x7E, 0x00, 0x0F, 0x87, 0xC1, 0xF0, 0x00,
+  0x78, 0x3E, 0x0F, 0x80, 0x07, 0x81, 0xF0, 0x7C, 0x00, 0x7C, 0x0F, 0x83,
+  0xE0, 0x03, 0xC0, 0x7C, 0x1F, 0x00, 0x3C, 0x03, 0xE0, 0xF8, 0x03, 0xE0,
+  0x0F, 0x8F, 0x80, 0x1E, 0x00, 0x3F, 0xF8, 0x01, 0xF0, 0x00, 0xFF, 0x80,
+  0x0F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0xC0,
+  0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+  0x3F, 0xC0, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0x0F, 0xFE, 0x01, 0xF8, 0x7F, 0xFC, 0x07, 0xE3, 0xFF, 0xF8,
+  0x1F, 0x9F, 0xCF, 0xF0, 0xFC, 0x7F, 0x1F, 0xC3, 0xF3, 0xF8, 0x3F, 0x9F,
+  0xCF, 0xE0, 0x7F, 0xFE, 0x3F, 0x81, 0xFF, 0xF8, 0xFE, 0x03, 0xFF, 0xC3,
+  0xFC, 0x07, 0xFE, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x7F, 0xF0, 0x7F,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+  0xF3, 0xFE, 0x01, 0xFE, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x07, 0xE1, 0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x3E, 0x0F, 0xC1, 0xF8, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F,
+  0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x03, 0xF0, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x1F, 0x83, 0xF0, 0x3E, 0x07, 0xE0, 0xFC, 0x0F, 0xC1, 0xF8, 0x1F,
+  0x80, 0xFC, 0x0F, 0xC1, 0xF8, 0x1F, 0x83, 0xF0, 0x3E, 0x07, 0xE0, 0xFC,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x3E, 0x0F, 0xC1, 0xF8, 0x7E, 0x0F, 0xC3,
+  0xF0, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x20, 0x70, 0x27,
+  0x0E, 0x1D, 0xF9, 0xCF, 0xCF, 0xFF, 0xE0, 0x7F, 0xF0, 0x03, 0xFC, 0x00,
+  0xFF, 0x80, 0x3F, 0xFC, 0x1F, 0xFF, 0xCF, 0xCE, 0x7E, 0xE1, 0xC3, 0x90,
+  0x38, 0x10, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+  0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80,
+  0x00, 0x1F, 0x00, 0x00, 0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0xFC, 0xFE,
+  0x7E, 0x7E, 0x3E, 0x1F, 0x1F, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x3C, 0x01, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x7C, 0x01, 0xE0, 0x07, 0x80, 0x3E, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00,
+  0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF,
+  0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xF8, 0x7F,
+  0x1F, 0xC0, 0x7F, 0x3F, 0x80, 0xFE, 0x7F, 0x01, 0xFD, 0xFC, 0x01, 0xFF,
+  0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x07, 0xF7, 0xF0, 0x1F, 0xCF, 0xE0, 0x3F, 0x9F, 0xC0,
+  0x7F, 0x1F, 0xE3, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF,
+  0x80, 0x1F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xFC, 0x0F, 0xFF, 0xC0,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0x1F, 0xC0, 0x01, 0xFC,
+  0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
+  0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01,
+  0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00,
+  0x1F, 0xC0, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
+  0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x07, 0xFC, 0x03, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x7E, 0x0F, 0xFB, 0x80, 0x1F, 0xF0,
+  0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07,
+  0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00,
+  0x7F, 0x80, 0x07, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x80,
+  0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFC,
+  0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x3C,
+  0x0F, 0xF9, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F,
+  0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x1F,
+  0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x01, 0xFE,
+  0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x01,
+  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x01,
+  0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0,
+  0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xF7, 0xF0,
+  0x03, 0xF7, 0xF0, 0x07, 0xE7, 0xF0, 0x07, 0xC7, 0xF0, 0x0F, 0xC7, 0xF0,
+  0x1F, 0x87, 0xF0, 0x1F, 0x07, 0xF0, 0x3E, 0x07, 0xF0, 0x7E, 0x07, 0xF0,
+  0xFC, 0x07, 0xF0, 0xF8, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0,
+  0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF,
+  0xFF, 0xC7, 0xFF, 0xFE, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0xFC, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xFF, 0x3C, 0x0F, 0xF9, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xF0, 0x03,
+  0xFB, 0xE0, 0x7F, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFC, 0x0F, 0x0F, 0xE0,
+  0x02, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0xFE,
+  0x07, 0xF7, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+  0x7F, 0xE1, 0xFE, 0xFF, 0x81, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x03, 0xFF,
+  0xF8, 0x07, 0xF7, 0xF0, 0x0F, 0xEF, 0xE0, 0x1F, 0xDF, 0xE0, 0x7F, 0x1F,
+  0xE1, 0xFE, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xF8, 0x00, 0x1F, 0xC0,
+  0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0,
+  0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x7F,
+  0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFF,
+  0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF9, 0xFE, 0x1F, 0xE7,
+  0xF0, 0x3F, 0x9F, 0xC0, 0xFE, 0x7F, 0x03, 0xF9, 0xFC, 0x0F, 0xE3, 0xF8,
+  0x7F, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x01, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xFC, 0x7F, 0x87, 0xF9, 0xFC, 0x0F, 0xEF, 0xE0, 0x1F, 0xFF,
+  0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xE1,
+  0xFF, 0x7F, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03, 0xFF, 0xF0,
+  0x03, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x81,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0x1F, 0xC0, 0xFF, 0x7F,
+  0x00, 0xFE, 0xFE, 0x01, 0xFD, 0xFC, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xF0, 0x3F, 0xEF, 0xF0, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF,
+  0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xFD, 0xFC, 0x0F, 0xE3, 0xF8, 0x00, 0x0F,
+  0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x88, 0x01, 0xFE, 0x1C, 0x07, 0xFC,
+  0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x9F,
+  0xCF, 0xE7, 0xF3, 0xF9, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFE, 0x7F, 0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0xF9, 0xF8,
+  0xF8, 0x7C, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x03,
+  0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFE,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x1F,
+  0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+  0x03, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00,
+  0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF,
+  0xC0, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0F,
+  0xF0, 0x3F, 0xFE, 0x3F, 0xFF, 0x9F, 0xFF, 0xEF, 0xFF, 0xFF, 0x83, 0xFF,
+  0x00, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F,
+  0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
+  0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x3F,
+  0x00, 0xF8, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00,
+  0x0F, 0x0F, 0x00, 0xF9, 0xE3, 0xE7, 0xC0, 0xFF, 0x78, 0x79, 0xE0, 0x7F,
+  0xFE, 0x1F, 0x78, 0x3F, 0xFF, 0x83, 0xFC, 0x0F, 0x87, 0xE0, 0xFF, 0x07,
+  0xC0, 0xF8, 0x3F, 0xC1, 0xE0, 0x1E, 0x0F, 0xF0, 0x78, 0x07, 0x83, 0xFC,
+  0x1E, 0x01, 0xE0, 0xFF, 0x07, 0x80, 0x78, 0x7F, 0xC1, 0xE0, 0x1E, 0x1E,
+  0xF0, 0x7C, 0x0F, 0x8F, 0x9E, 0x0F, 0x87, 0xE7, 0xC7, 0x83, 0xFF, 0xFF,
+  0xE1, 0xF0, 0x7F, 0xFF, 0xF0, 0x3C, 0x0F, 0xF7, 0xF8, 0x0F, 0x81, 0xF9,
+  0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0x00, 0x0F, 0xE0,
+  0x00, 0xE0, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03,
+  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF3,
+  0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F,
+  0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x01, 0xFC, 0x0F, 0xE0,
+  0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x07,
+  0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
+  0xFF, 0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7F, 0x80, 0x07, 0xF9, 0xFC, 0x00,
+  0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F,
+  0xC0, 0x7F, 0xBF, 0x80, 0x7F, 0x7F, 0x00, 0xFE, 0xFE, 0x01, 0xFD, 0xFC,
+  0x03, 0xFB, 0xF8, 0x0F, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x1F, 0xFF,
+  0xFC, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0xFE, 0x03, 0xFD, 0xFC, 0x03,
+  0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x3F,
+  0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xF0, 0x1F,
+  0x3F, 0xC0, 0x03, 0x7F, 0x80, 0x01, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01,
+  0x3F, 0xC0, 0x03, 0x1F, 0xF8, 0x1F, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFF, 0xE1, 0xFC, 0x07, 0xFE, 0x3F, 0x80, 0x3F, 0xE7, 0xF0, 0x01, 0xFE,
+  0xFE, 0x00, 0x3F, 0xDF, 0xC0, 0x03, 0xFB, 0xF8, 0x00, 0x7F, 0xFF, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
+  0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
+  0x7F, 0x7F, 0x00, 0x1F, 0xEF, 0xE0, 0x03, 0xFD, 0xFC, 0x01, 0xFF, 0x3F,
+  0x80, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x0F,
+  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x1F,
+  0x8F, 0xF8, 0x00, 0x73, 0xFC, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x0F, 0xE0,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01,
+  0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xBF, 0x80, 0x07, 0xF7,
+  0xF8, 0x00, 0xFE, 0xFF, 0x00, 0x1F, 0xCF, 0xF0, 0x03, 0xF8, 0xFF, 0xC0,
+  0x7F, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x80,
+  0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
+  0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+  0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F,
+  0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
+  0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F,
+  0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0,
+  0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F,
+  0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x83, 0xFC,
+  0x3F, 0xDF, 0xFE, 0xFF, 0xE7, 0xFE, 0x3F, 0xE1, 0xF8, 0x00, 0xFE, 0x00,
+  0x3F, 0xCF, 0xE0, 0x0F, 0xF8, 0xFE, 0x01, 0xFF, 0x0F, 0xE0, 0x3F, 0xE0,
+  0xFE, 0x07, 0xFC, 0x0F, 0xE0, 0xFF, 0x80, 0xFE, 0x1F, 0xF0, 0x0F, 0xE3,
+  0xFE, 0x00, 0xFE, 0x7F, 0xC0, 0x0F, 0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0x00,
+  0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF,
+  0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xEF, 0xF8,
+  0x00, 0xFE, 0x7F, 0xC0, 0x0F, 0xE3, 0xFE, 0x00, 0xFE, 0x1F, 0xF0, 0x0F,
+  0xE0, 0xFF, 0x80, 0xFE, 0x07, 0xFC, 0x0F, 0xE0, 0x3F, 0xE0, 0xFE, 0x01,
+  0xFF, 0x0F, 0xE0, 0x0F, 0xF8, 0xFE, 0x00, 0x7F, 0xCF, 0xE0, 0x03, 0xFE,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0xFC,
+  0x3F, 0x7F, 0xFE, 0xFC, 0x3F, 0x7F, 0xFE, 0x7C, 0x3E, 0x7F, 0xFE, 0x7E,
+  0x7E, 0x7F, 0xFE, 0x3E, 0x7C, 0x7F, 0xFE, 0x3F, 0xFC, 0x7F, 0xFE, 0x3F,
+  0xFC, 0x7F, 0xFE, 0x1F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF8, 0x7F, 0xFE, 0x0F,
+  0xF0, 0x7F, 0xFE, 0x0F, 0xF0, 0x7F, 0xFE, 0x07, 0xE0, 0x7F, 0xFE, 0x07,
+  0xE0, 0x7F, 0xFE, 0x07, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xBF, 0x0F,
+  0xFF, 0xDF, 0x87, 0xFF, 0xE7, 0xE3, 0xFF, 0xF3, 0xF1, 0xFF, 0xF8, 0xFC,
+  0xFF, 0xFC, 0x7E, 0x7F, 0xFE, 0x1F, 0xBF, 0xFF, 0x0F, 0xDF, 0xFF, 0x83,
+  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0x80, 0x3F, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF,
+  0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC,
+  0x1F, 0xF8, 0x3F, 0xF0, 0xFF, 0x00, 0x7F, 0x8F, 0xF0, 0x01, 0xFE, 0x7F,
+  0x00, 0x07, 0xF3, 0xF8, 0x00, 0x3F, 0xBF, 0xC0, 0x01, 0xFF, 0xFC, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+  0x80, 0x01, 0xFE, 0xFE, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x7F, 0x3F, 0xC0,
+  0x07, 0xF8, 0xFF, 0x00, 0x7F, 0x87, 0xFE, 0x0F, 0xFC, 0x1F, 0xFF, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF, 0xC0, 0x7F, 0xBF, 0x80, 0x7F,
+  0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF,
+  0xF0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x7F, 0xBF, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0,
+  0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0xFF,
+  0x00, 0x7F, 0x8F, 0xF0, 0x01, 0xFE, 0x7F, 0x00, 0x07, 0xF3, 0xF8, 0x00,
+  0x3F, 0xBF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE,
+  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFE, 0xFE, 0x00,
+  0x0F, 0xE7, 0xF0, 0x00, 0x7F, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x7F,
+  0x87, 0xFE, 0x0F, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0x00, 0x3F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8,
+  0x3F, 0x81, 0xFF, 0x0F, 0xE0, 0x3F, 0xC3, 0xF8, 0x07, 0xF0, 0xFE, 0x01,
+  0xFC, 0x3F, 0x80, 0x7F, 0x0F, 0xE0, 0x1F, 0xC3, 0xF8, 0x0F, 0xE0, 0xFE,
+  0x07, 0xF8, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x0F, 0xE0, 0xFF, 0x83, 0xF8, 0x1F,
+  0xE0, 0xFE, 0x03, 0xFC, 0x3F, 0x80, 0x7F, 0x0F, 0xE0, 0x1F, 0xE3, 0xF8,
+  0x03, 0xF8, 0xFE, 0x00, 0xFF, 0x3F, 0x80, 0x1F, 0xEF, 0xE0, 0x07, 0xFB,
+  0xF8, 0x00, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF, 0x1F,
+  0xFF, 0xFC, 0x7F, 0xFF, 0xF3, 0xFE, 0x03, 0xCF, 0xE0, 0x01, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x01,
+  0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
+  0xFE, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFB,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
+  0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80,
+  0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xFB, 0xF8, 0x03, 0xF9,
+  0xFF, 0x07, 0xFC, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE,
+  0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0xFC,
+  0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0x9F, 0xE0, 0x01, 0xFE, 0x3F, 0x80,
+  0x07, 0xF0, 0xFE, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0xFF, 0x07, 0xF0, 0x03,
+  0xF8, 0x1F, 0xE0, 0x1F, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC,
+  0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xF0, 0x3F, 0x80, 0x1F, 0xC0, 0xFE, 0x00,
+  0x7F, 0x87, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x07,
+  0xF3, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFF,
+  0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
+  0x00, 0x0F, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
+  0x80, 0x1F, 0xDF, 0xC0, 0x3F, 0xE0, 0x1F, 0xCF, 0xE0, 0x1F, 0xF0, 0x0F,
+  0xE7, 0xF0, 0x0F, 0xF8, 0x07, 0xF3, 0xF8, 0x07, 0xFC, 0x03, 0xF8, 0xFE,
+  0x07, 0xFF, 0x03, 0xF8, 0x7F, 0x03, 0xEF, 0x81, 0xFC, 0x3F, 0x81, 0xF7,
+  0xC0, 0xFE, 0x1F, 0xC0, 0xFB, 0xE0, 0x7F, 0x07, 0xF0, 0xFD, 0xF8, 0x7F,
+  0x03, 0xF8, 0x7C, 0x7C, 0x3F, 0x81, 0xFC, 0x3E, 0x3E, 0x1F, 0xC0, 0xFE,
+  0x1F, 0x1F, 0x0F, 0xE0, 0x3F, 0x9F, 0x8F, 0xCF, 0xF0, 0x1F, 0xCF, 0x83,
+  0xE7, 0xF0, 0x0F, 0xE7, 0xC1, 0xF3, 0xF8, 0x07, 0xF3, 0xE0, 0xF9, 0xFC,
+  0x01, 0xFF, 0xF0, 0x7F, 0xFE, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x7F,
+  0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x03,
+  0xFF, 0xC0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
+  0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F,
+  0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x7F, 0x8F,
+  0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0x7F, 0x81, 0xFE, 0x03, 0xFC, 0x07, 0xF8,
+  0x3F, 0xC0, 0x1F, 0xE3, 0xFC, 0x00, 0xFF, 0x1F, 0xE0, 0x03, 0xFD, 0xFE,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0x7F,
+  0x00, 0x07, 0xFB, 0xFC, 0x00, 0x7F, 0x8F, 0xF0, 0x07, 0xF8, 0x3F, 0xC0,
+  0x3F, 0xC1, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x3F, 0xC0, 0x1F, 0xE1, 0xFE,
+  0x00, 0xFF, 0x1F, 0xE0, 0x03, 0xFD, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+  0x07, 0xFB, 0xFC, 0x00, 0x7F, 0x8F, 0xF0, 0x07, 0xF8, 0x7F, 0x80, 0x3F,
+  0xC1, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xC1, 0xFE, 0x00,
+  0xFF, 0x1F, 0xE0, 0x03, 0xFD, 0xFE, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x7F,
+  0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
+  0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
+  0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
+  0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00,
+  0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F,
+  0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x03, 0xE0,
+  0x07, 0x80, 0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF8, 0x01,
+  0xE0, 0x07, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F,
+  0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xBF,
+  0x80, 0x3F, 0x8F, 0xE0, 0x3F, 0x01, 0xF8, 0x3F, 0x00, 0x7E, 0x3F, 0x00,
+  0x1F, 0xBE, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80,
+  0x78, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xF8, 0xF0, 0x1F, 0xE2, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x03,
+  0xFF, 0xFC, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x81,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0x7F, 0x1F, 0xF9, 0xFC, 0x3F,
+  0x87, 0xF0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0xFE, 0x1F, 0x81, 0xFC, 0xFF, 0xC3, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xFF, 0x9F, 0xF0, 0x7F, 0xBF, 0xC0, 0x7F, 0x7F, 0x80, 0xFF,
+  0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0xFE, 0xFF,
+  0x83, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xE7,
+  0xFE, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF,
+  0x8F, 0xFF, 0xF3, 0xFF, 0xFE, 0xFF, 0x81, 0xDF, 0xE0, 0x0F, 0xF8, 0x00,
+  0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01,
+  0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x01, 0x7F, 0xC0, 0xE7, 0xFF, 0xFC,
+  0x7F, 0xFF, 0x87, 0xFF, 0xF0, 0x7F, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x03, 0xF0, 0xFE,
+  0x1F, 0xF9, 0xFC, 0x7F, 0xFB, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF,
+  0xF0, 0x7F, 0xDF, 0xC0, 0x7F, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC,
+  0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0,
+  0x1F, 0xFF, 0xC0, 0x7F, 0xBF, 0x80, 0xFF, 0x7F, 0x83, 0xFE, 0x7F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xF7, 0xF0, 0xFF, 0xCF, 0xE0, 0x7E, 0x1F,
+  0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF,
+  0x83, 0xFF, 0xFF, 0x8F, 0xF8, 0x7F, 0x9F, 0xC0, 0x7F, 0x7F, 0x80, 0x7F,
+  0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0x3F, 0x80, 0x0E, 0x7F,
+  0xC0, 0x7C, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0x0F,
+  0xFF, 0x1F, 0xFF, 0x1F, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xF9, 0xFC, 0x7F,
+  0xFB, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0xF0, 0x7F, 0xDF, 0xC0,
+  0x7F, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F,
+  0xBF, 0x80, 0xFF, 0x7F, 0x83, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xF7, 0xF0, 0xFF, 0xCF, 0xE0, 0x7E, 0x1F, 0xC0, 0x00, 0x7F, 0x88,
+  0x00, 0xFE, 0x1C, 0x07, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0,
+  0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03,
+  0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x1F, 0x87, 0xF3, 0xFE, 0x3F, 0xBF,
+  0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xE0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE,
+  0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F,
+  0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F,
+  0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x0F, 0xFF, 0xFE, 0xFF, 0xEF, 0xFC,
+  0xFF, 0x8F, 0xE0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x07, 0xF3, 0xF8, 0x1F, 0xC7, 0xF0,
+  0x7F, 0x0F, 0xE1, 0xFC, 0x1F, 0xC7, 0xF0, 0x3F, 0x9F, 0xC0, 0x7F, 0x7F,
+  0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xBF, 0xC0, 0x7F, 0x3F, 0xC0,
+  0xFE, 0x3F, 0xC1, 0xFC, 0x3F, 0xC3, 0xF8, 0x3F, 0xC7, 0xF0, 0x3F, 0xCF,
+  0xE0, 0x3F, 0xDF, 0xC0, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x00,
+  0x7C, 0x1F, 0xCF, 0xF8, 0x3F, 0xE3, 0xFB, 0xFF, 0x8F, 0xFE, 0x7F, 0xFF,
+  0xFB, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF,
+  0xC1, 0xFF, 0x03, 0xFF, 0xF8, 0x1F, 0xE0, 0x7F, 0xFE, 0x03, 0xF8, 0x0F,
+  0xFF, 0xC0, 0x7F, 0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC,
+  0x07, 0xFF, 0xE0, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0x80,
+  0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xC0, 0x7F, 0xFE, 0x03, 0xF8, 0x0F, 0xFF,
+  0xC0, 0x7F, 0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x07,
+  0xFF, 0xE0, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x1F,
+  0x87, 0xF3, 0xFE, 0x3F, 0xBF, 0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F,
+  0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F,
+  0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF,
+  0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x01, 0xFF, 0x00, 0x0F,
+  0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xF0,
+  0x7F, 0x9F, 0xC0, 0x7F, 0x7F, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xC0, 0x7F, 0xBF, 0x80, 0xFE, 0x7F, 0x83, 0xFC, 0x7F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0x1F, 0x81, 0xFC, 0xFF, 0xC3, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0x9F, 0xF0, 0x7F, 0xBF, 0xC0, 0x7F, 0x7F, 0x80, 0xFF, 0xFE,
+  0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0xFE, 0xFF, 0x83,
+  0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xF7, 0xFF, 0x8F, 0xE7, 0xFE,
+  0x1F, 0xC3, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01,
+  0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xF9, 0xFC, 0x7F, 0xFB, 0xF9,
+  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0xF0, 0x7F, 0xDF, 0xC0, 0x7F, 0xFF,
+  0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0,
+  0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F, 0xBF, 0x80,
+  0xFF, 0x7F, 0x83, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xF7,
+  0xF0, 0xFF, 0xCF, 0xE0, 0x7E, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xFE, 0x7F, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00,
+  0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+  0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+  0xFE, 0x00, 0x07, 0xFC, 0x07, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFF, 0xEF,
+  0xFF, 0xFD, 0xFC, 0x07, 0xBF, 0x00, 0x17, 0xE0, 0x00, 0xFF, 0x00, 0x0F,
+  0xFF, 0x81, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x1F, 0xC0,
+  0x01, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xE7, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+  0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF8, 0x01, 0xFC, 0x00, 0xFE,
+  0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03,
+  0xF8, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF,
+  0x03, 0xFF, 0x80, 0x7F, 0xC0, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80,
+  0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xE1, 0xFF, 0x7F,
+  0xFF, 0xFB, 0xFF, 0xFF, 0xCF, 0xFE, 0xFE, 0x3F, 0xE7, 0xF0, 0xFC, 0x3F,
+  0x80, 0xFE, 0x00, 0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFE, 0x7F, 0x00,
+  0xFE, 0x3F, 0x00, 0xFC, 0x3F, 0x81, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x81,
+  0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0xE7, 0xF0, 0x07, 0xE7,
+  0xE0, 0x07, 0xE7, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFE, 0x03, 0xE0, 0x3F, 0xFF, 0x03, 0xF8, 0x1F,
+  0xDF, 0x81, 0xFC, 0x0F, 0xCF, 0xC0, 0xFE, 0x07, 0xE7, 0xF0, 0x7F, 0x07,
+  0xF3, 0xF8, 0x7F, 0xC3, 0xF8, 0xFC, 0x3F, 0xE1, 0xF8, 0x7E, 0x1E, 0xF0,
+  0xFC, 0x3F, 0x8F, 0x78, 0xFE, 0x0F, 0xCF, 0xBE, 0x7F, 0x07, 0xE7, 0xDF,
+  0x3F, 0x03, 0xF3, 0xC7, 0x9F, 0x81, 0xFD, 0xE3, 0xDF, 0xC0, 0x7F, 0xF1,
+  0xFF, 0xC0, 0x3F, 0xF8, 0xFF, 0xE0, 0x1F, 0xF8, 0x3F, 0xF0, 0x0F, 0xFC,
+  0x1F, 0xF8, 0x03, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0xFF,
+  0x01, 0xFE, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x7F, 0x81,
+  0xFE, 0x3F, 0x81, 0xFC, 0x1F, 0xC3, 0xF8, 0x1F, 0xE7, 0xF8, 0x0F, 0xEF,
+  0xF0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xE7, 0xF0, 0x1F, 0xC3, 0xF8, 0x1F, 0xC3,
+  0xF8, 0x3F, 0x81, 0xFC, 0x7F, 0x00, 0xFE, 0xFF, 0x00, 0xFF, 0xFE, 0x00,
+  0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x3F, 0x80,
+  0xFC, 0x3F, 0x81, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0xC1, 0xF8, 0x0F, 0xC3,
+  0xF8, 0x0F, 0xE3, 0xF0, 0x07, 0xE3, 0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xF7,
+  0xE0, 0x03, 0xF7, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFC,
+  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
+  0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
+  0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x07, 0xFF,
+  0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F,
+  0x00, 0x3F, 0x80, 0xFF, 0xE0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x80,
+  0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
+  0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x3F, 0xF0,
+  0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFF, 0xC0, 0x3F,
+  0xF0, 0x0F, 0xFC, 0x07, 0xFF, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0xFF, 0xE0, 0x3F, 0xF8,
+  0x0F, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0x3F, 0xF0, 0x03, 0x7F,
+  0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xC0,
+  0x0F, 0xFC, 0x80, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01,
+  0xF3, 0xE7, 0xCF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x01, 0xFF, 0x01, 0xFF, 0xF8, 0x7F, 0xFF, 0x3F,
+  0xFF, 0xE7, 0xFF, 0xFD, 0xFF, 0xE3, 0xBF, 0xDC, 0x1F, 0xF3, 0x81, 0xFC,
+  0x70, 0x3F, 0x8E, 0x07, 0xF1, 0xC0, 0xFE, 0x38, 0x1F, 0xC7, 0x03, 0xF8,
+  0xE0, 0x7F, 0x9C, 0x07, 0xFB, 0x82, 0xFF, 0xF1, 0xCF, 0xFF, 0xF8, 0xFF,
+  0xFF, 0x0F, 0xFF, 0xE0, 0xFF, 0xFC, 0x03, 0xFE, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x00,
+  0x3F, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF,
+  0x83, 0xFC, 0x0C, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+  0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x7F, 0xFF, 0xE3,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01,
+  0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x10, 0x00, 0x30, 0xE0, 0x01, 0xE7, 0x80, 0x0F,
+  0xBF, 0x3F, 0x3F, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x03,
+  0xE1, 0xF0, 0x1F, 0x03, 0xE0, 0x78, 0x07, 0x81, 0xE0, 0x1E, 0x07, 0x80,
+  0x78, 0x1E, 0x01, 0xE0, 0x7C, 0x0F, 0x80, 0xF8, 0x7C, 0x03, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xF1, 0xFF, 0xFF, 0xEF, 0xCF, 0xCF, 0xFF, 0x00, 0x1E, 0x38,
+  0x00, 0x70, 0x40, 0x00, 0x80, 0xFF, 0x00, 0x7F, 0xBF, 0x80, 0x3F, 0x9F,
+  0xE0, 0x3F, 0xC7, 0xF0, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0xFF, 0x1F, 0xE0,
+  0x3F, 0x8F, 0xE0, 0x1F, 0xEF, 0xF0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
+  0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0xE0, 0x7F, 0xFC, 0x1F, 0xFF, 0x83,
+  0xF8, 0x30, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF8, 0x03,
+  0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC7, 0xF7, 0xFD, 0xF8, 0x3F, 0xFE,
+  0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0xBF,
+  0xF7, 0xE3, 0xFF, 0xF8, 0x3F, 0xFE, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
+  0x7F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x10, 0x07, 0xE3, 0xC1, 0xFC, 0x7F,
+  0xFF, 0x0F, 0xFF, 0xE1, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0xF8, 0xFF, 0xC7,
+  0xFE, 0x3F, 0xF1, 0xFF, 0x8F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF,
+  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0x00, 0x1F, 0x01,
+  0xE0, 0x00, 0x78, 0x3C, 0x1F, 0xE3, 0xC3, 0x87, 0xFF, 0x1C, 0x78, 0xFF,
+  0xF1, 0xE7, 0x1F, 0xFF, 0x0E, 0xF1, 0xF0, 0x10, 0xFE, 0x3E, 0x00, 0x07,
+  0xE3, 0xC0, 0x00, 0x7E, 0x3C, 0x00, 0x07, 0xE3, 0xC0, 0x00, 0x7E, 0x3C,
+  0x00, 0x07, 0xE3, 0xE0, 0x00, 0x7F, 0x1F, 0x01, 0x0F, 0x71, 0xFF, 0xF0,
+  0xE7, 0x0F, 0xFF, 0x0E, 0x38, 0x7F, 0xF1, 0xC3, 0xC0, 0xFC, 0x3C, 0x1E,
+  0x00, 0x07, 0x80, 0xF0, 0x00, 0xF0, 0x07, 0xE0, 0x7E, 0x00, 0x3F, 0xFF,
+  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x7F, 0xFC,
+  0x7F, 0xFE, 0x60, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x0F, 0xFF, 0x3F, 0xFF,
+  0x7F, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0x7F, 0xFF,
+  0x7F, 0xDF, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x40, 0x60, 0x30, 0x38, 0x1C, 0x1E,
+  0x0F, 0x1F, 0x8F, 0xCF, 0xC7, 0xE7, 0xE3, 0xF3, 0xF1, 0xF0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0xC7, 0xC1, 0xF8, 0xFC, 0x3F, 0x1F, 0x87, 0xE3, 0xF0,
+  0x78, 0x3C, 0x0E, 0x07, 0x01, 0x80, 0xC0, 0x20, 0x10, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF,
+  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0x00, 0x1F, 0x01,
+  0xE0, 0x00, 0x78, 0x3C, 0xFF, 0x83, 0xC3, 0x8F, 0xFE, 0x1C, 0x78, 0xFF,
+  0xF1, 0xE7, 0x0F, 0x1F, 0x0E, 0xF0, 0xF0, 0xF0, 0xFE, 0x0F, 0x1F, 0x07,
+  0xE0, 0xFF, 0xE0, 0x7E, 0x0F, 0xFE, 0x07, 0xE0, 0xFF, 0x80, 0x7E, 0x0F,
+  0x7C, 0x07, 0xE0, 0xF3, 0xC0, 0x7F, 0x0F, 0x1E, 0x0F, 0x70, 0xF1, 0xE0,
+  0xE7, 0x0F, 0x0F, 0x0E, 0x38, 0xF0, 0xF1, 0xC3, 0xCF, 0x07, 0xBC, 0x1E,
+  0x00, 0x07, 0x80, 0xF0, 0x00, 0xF0, 0x07, 0xE0, 0x7E, 0x00, 0x3F, 0xFF,
+  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x0F, 0x81, 0xFF, 0x1F, 0xFC, 0xF1, 0xEF, 0x07, 0xF0, 0x1F,
+  0x80, 0xFC, 0x07, 0xF0, 0x7B, 0xC7, 0x9F, 0xFC, 0x7F, 0xC0, 0xF8, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0,
+  0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xC7, 0xFF, 0xBF, 0xFD,
+  0xC3, 0xF8, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x07,
+  0xE0, 0x7E, 0x07, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC3, 0xFF,
+  0x9F, 0xFE, 0x83, 0xF0, 0x0F, 0x80, 0xFC, 0x7F, 0xC3, 0xF8, 0x1F, 0xF0,
+  0x0F, 0xC0, 0x3E, 0x01, 0xF8, 0x1F, 0xFF, 0xFB, 0xFF, 0xCF, 0xF8, 0x07,
+  0xC1, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x00, 0xFE, 0x03, 0xF8,
+  0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8,
+  0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8,
+  0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8,
+  0xFE, 0x03, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xF8, 0x3E,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x03, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x0F, 0x7F, 0xF0,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xF0, 0xF7, 0xFF, 0x0F, 0x7F, 0xF0, 0xF3, 0xFF, 0x0F, 0x1F,
+  0xF0, 0xF0, 0x3F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0,
+  0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F,
+  0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0,
+  0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x06, 0x03, 0x80, 0xE0, 0x78, 0x7F, 0xFF, 0xFC, 0xFC,
+  0x3F, 0x0F, 0xF0, 0xFF, 0x0C, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF8, 0x7E, 0x7C, 0x0F, 0xBE,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80,
+  0x7D, 0xF0, 0x3E, 0x7E, 0x1F, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0xFF, 0xFE, 0x7F, 0xFF, 0x9F,
+  0xFF, 0xE0, 0x80, 0x40, 0x30, 0x18, 0x0E, 0x07, 0x03, 0xC1, 0xE0, 0xFC,
+  0x7E, 0x1F, 0x8F, 0xC3, 0xF1, 0xF8, 0x3E, 0x3F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x3F, 0x3F, 0x1F, 0x8F, 0x07, 0x83,
+  0x81, 0xC0, 0xC0, 0x60, 0x20, 0x10, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x1F,
+  0xE0, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x67, 0x80, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x03,
+  0xC0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x01, 0xE0,
+  0x07, 0x80, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x00,
+  0xF0, 0x0F, 0x00, 0x01, 0xFF, 0xE3, 0xE0, 0x3E, 0x3F, 0xFC, 0x78, 0x0F,
+  0xC7, 0xFF, 0x9F, 0x01, 0xF8, 0x00, 0x03, 0xC0, 0x7F, 0x00, 0x00, 0xF0,
+  0x1D, 0xE0, 0x00, 0x3E, 0x07, 0x3C, 0x00, 0x07, 0x80, 0xE7, 0x80, 0x01,
+  0xE0, 0x38, 0xF0, 0x00, 0x3C, 0x0E, 0x1E, 0x00, 0x0F, 0x03, 0xC3, 0xC0,
+  0x03, 0xE0, 0x7F, 0xFF, 0x00, 0x78, 0x0F, 0xFF, 0xE0, 0x1E, 0x01, 0xFF,
+  0xFC, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x3E, 0x00,
+  0x00, 0xF0, 0x3F, 0x00, 0x01, 0xF0, 0x0F, 0xF0, 0x00, 0x1E, 0x00, 0xFF,
+  0x00, 0x03, 0xC0, 0x0C, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x7C, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0xF0, 0x00,
+  0x0F, 0xFF, 0x1F, 0x07, 0xF8, 0xFF, 0xF1, 0xE1, 0xFF, 0xEF, 0xFF, 0x3E,
+  0x1F, 0xFE, 0x00, 0x03, 0xC1, 0xC3, 0xF0, 0x00, 0x78, 0x10, 0x1F, 0x00,
+  0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x03,
+  0xE0, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x07, 0xC0,
+  0x03, 0xF0, 0x00, 0x78, 0x00, 0x7E, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,
+  0xF0, 0x01, 0xFF, 0xF0, 0x1E, 0x00, 0x1F, 0xFF, 0x03, 0xE0, 0x01, 0xFF,
+  0xF0, 0x3F, 0xC0, 0x00, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x00, 0x7F, 0xF8,
+  0x01, 0xE0, 0x04, 0x1F, 0x80, 0x1E, 0x00, 0x00, 0xF8, 0x03, 0xC0, 0x00,
+  0x1F, 0x80, 0x7C, 0x00, 0x1F, 0xF0, 0x07, 0x80, 0x01, 0xFC, 0x00, 0xF0,
+  0x00, 0x1F, 0xF0, 0x0F, 0x00, 0x00, 0x1F, 0x81, 0xE0, 0x00, 0x00, 0xF8,
+  0x3E, 0x00, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x81, 0xF8, 0x78, 0x00, 0x0F,
+  0xFF, 0x0F, 0x80, 0xF8, 0xFF, 0xF0, 0xF0, 0x1F, 0x87, 0xFC, 0x1F, 0x01,
+  0xF8, 0x00, 0x01, 0xE0, 0x3F, 0x80, 0x00, 0x3C, 0x07, 0x78, 0x00, 0x07,
+  0xC0, 0xE7, 0x80, 0x00, 0x78, 0x0E, 0x78, 0x00, 0x0F, 0x01, 0xC7, 0x80,
+  0x00, 0xF0, 0x38, 0x78, 0x00, 0x1E, 0x07, 0x87, 0x80, 0x03, 0xE0, 0x7F,
+  0xFF, 0x00, 0x3C, 0x07, 0xFF, 0xF0, 0x07, 0x80, 0x7F, 0xFF, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00, 0x07, 0x80,
+  0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
+  0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0x7F, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
+  0x3F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xF8,
+  0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xE0,
+  0x7F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
+  0xFF, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF,
+  0xE0, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x1F, 0xE1, 0xFE,
+  0x00, 0x7F, 0x03, 0xF8, 0x01, 0xFC, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0,
+  0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0,
+  0x01, 0xFC, 0x7F, 0x80, 0x07, 0xF9, 0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
+  0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF3, 0xF8,
+  0x00, 0x1F, 0xCF, 0xE0, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00,
+  0x1F, 0xE1, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x01, 0xFC, 0x0F, 0xE0, 0x0F,
+  0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7F, 0x80, 0x07, 0xF9, 0xFC, 0x00, 0x0F,
+  0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFC, 0xFE, 0x00,
+  0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0xFE, 0x1F, 0xC0, 0x03,
+  0xF8, 0x7F, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x01, 0xFC,
+  0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF,
+  0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7F, 0x80, 0x07, 0xF9,
+  0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0x00,
+  0x3C, 0x1C, 0x00, 0x01, 0xFC, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3C,
+  0xFE, 0x00, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+  0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x01,
+  0xFC, 0xFE, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0xFE,
+  0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x7F, 0x03,
+  0xF8, 0x01, 0xFC, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F,
+  0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7F,
+  0x80, 0x07, 0xF9, 0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
+  0x00, 0xFF, 0x00, 0x7C, 0xF8, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x07, 0xCF,
+  0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
+  0xFF, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF,
+  0xE0, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x1F, 0xE1, 0xFE,
+  0x00, 0x7F, 0x03, 0xF8, 0x01, 0xFC, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0,
+  0x3F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0,
+  0x01, 0xFC, 0x7F, 0x80, 0x07, 0xF9, 0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
+  0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x70, 0x38, 0x00,
+  0x01, 0xC0, 0xE0, 0x00, 0x07, 0x03, 0x80, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF3, 0xF8,
+  0x00, 0x3F, 0x87, 0xF0, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00,
+  0x1F, 0xC0, 0xFE, 0x00, 0x7F, 0x03, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
+  0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x01, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x0F,
+  0xE7, 0xF0, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x01,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF9, 0xFF, 0xFF, 0xE0, 0x0F, 0xE3, 0xF8,
+  0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x00,
+  0xFE, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x7F,
+  0x00, 0x00, 0x0F, 0xE0, 0xFF, 0xFF, 0xE0, 0x3F, 0x81, 0xFF, 0xFF, 0xC0,
+  0x7F, 0x03, 0xFF, 0xFF, 0x80, 0xFE, 0x07, 0xFF, 0xFF, 0x03, 0xF8, 0x0F,
+  0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
+  0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
+  0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00,
+  0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0x7F, 0x00, 0x1F, 0xFF, 0xFE, 0xFE, 0x00,
+  0x3F, 0xFF, 0xFD, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
+  0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xF0, 0x1F, 0x3F, 0xC0, 0x03, 0x7F, 0x80,
+  0x01, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0x3F, 0xC0, 0x03, 0x1F, 0xF8,
+  0x1F, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0xE0, 0x00, 0x21, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
+  0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFE, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C,
+  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0x3C, 0x01,
+  0xE1, 0xE0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFE, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F,
+  0x01, 0xF1, 0xF0, 0x1F, 0x1F, 0x01, 0xF1, 0xF0, 0x1F, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0x00,
+  0x00, 0x00, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F,
+  0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7,
+  0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC,
+  0x7F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F,
+  0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0xFC, 0xFE, 0x7F, 0x3F, 0x9F, 0xCF,
+  0xE7, 0xF3, 0xF9, 0xFC, 0xFE, 0x7F, 0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9,
+  0xFC, 0xFE, 0x7F, 0x3F, 0x9F, 0xC0, 0x0F, 0xE0, 0x3F, 0xE0, 0x7B, 0xC1,
+  0xE3, 0xC7, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F,
+  0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03,
+  0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE,
+  0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80,
+  0x7F, 0x00, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xF1, 0xFF, 0x8F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F,
+  0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC,
+  0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81,
+  0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F,
+  0x80, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0x01, 0xFF, 0x81,
+  0xFC, 0x01, 0xFF, 0x07, 0xF0, 0x03, 0xFE, 0x1F, 0xC0, 0x07, 0xF8, 0x7F,
+  0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x7F, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xFC, 0x01, 0xFC, 0x7F, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x3F,
+  0x87, 0xF0, 0x01, 0xFE, 0x1F, 0xC0, 0x0F, 0xF8, 0x7F, 0x00, 0x7F, 0xC1,
+  0xFC, 0x0F, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0x7F,
+  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0xE1,
+  0xC0, 0x01, 0xF8, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0xE7, 0xF0, 0x00, 0x70,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xFC, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xBF, 0x0F, 0xFF, 0xDF, 0x87,
+  0xFF, 0xE7, 0xE3, 0xFF, 0xF3, 0xF1, 0xFF, 0xF8, 0xFC, 0xFF, 0xFC, 0x7E,
+  0x7F, 0xFE, 0x1F, 0xBF, 0xFF, 0x0F, 0xDF, 0xFF, 0x83, 0xFF, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC,
+  0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF,
+  0xC0, 0x0F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00,
+  0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF,
+  0x07, 0xFE, 0x1F, 0xE0, 0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x00,
+  0xFE, 0x7F, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF,
+  0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+  0x3F, 0xDF, 0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0xFF,
+  0x1F, 0xE0, 0x0F, 0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F,
+  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x07,
+  0xFE, 0x1F, 0xE0, 0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0xFE,
+  0x7F, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFC,
+  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F,
+  0xDF, 0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0xFF, 0x1F,
+  0xE0, 0x0F, 0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1E, 0x78, 0x00,
+  0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
+  0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x07, 0xFE,
+  0x1F, 0xE0, 0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0xFE, 0x7F,
+  0x00, 0x07, 0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xDF,
+  0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0xFF, 0x1F, 0xE0,
+  0x0F, 0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+  0x00, 0x3C, 0x38, 0x00, 0x03, 0xF1, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x01,
+  0xCF, 0xE0, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x1F,
+  0xE0, 0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0xFE, 0x7F, 0x00,
+  0x07, 0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07,
+  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xC0,
+  0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0xFF, 0x1F, 0xE0, 0x0F,
+  0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+  0xF8, 0xF8, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x3E, 0x3E, 0x00, 0x01, 0xF1,
+  0xF0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x1F, 0xE0,
+  0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0xFE, 0x7F, 0x00, 0x07,
+  0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xC0, 0x01,
+  0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0xFF, 0x1F, 0xE0, 0x0F, 0xF0,
+  0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x10, 0x00,
+  0x10, 0x70, 0x00, 0x71, 0xF0, 0x01, 0xF7, 0xF0, 0x07, 0xF7, 0xF0, 0x1F,
+  0xC7, 0xF0, 0x7F, 0x07, 0xF1, 0xFC, 0x07, 0xF7, 0xF0, 0x07, 0xFF, 0xC0,
+  0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
+  0x7F, 0xF0, 0x01, 0xFF, 0xF0, 0x07, 0xF7, 0xF0, 0x1F, 0xC7, 0xF0, 0x7F,
+  0x07, 0xF1, 0xFC, 0x07, 0xF7, 0xF0, 0x07, 0xF7, 0xC0, 0x07, 0xC7, 0x00,
+  0x07, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xE0,
+  0x38, 0x03, 0xFF, 0xF8, 0x78, 0x0F, 0xFF, 0xFD, 0xE0, 0x7F, 0xFF, 0xFF,
+  0x81, 0xFF, 0xFF, 0xFE, 0x03, 0xFE, 0x0F, 0xFC, 0x0F, 0xF0, 0x07, 0xF8,
+  0x3F, 0xC0, 0x0F, 0xF8, 0x7F, 0x00, 0x3F, 0xF0, 0xFE, 0x00, 0xFF, 0xE3,
+  0xFC, 0x03, 0xEF, 0xE7, 0xF0, 0x0F, 0x9F, 0xCF, 0xE0, 0x3E, 0x3F, 0x9F,
+  0xC0, 0xF8, 0x7F, 0x3F, 0x83, 0xE0, 0xFE, 0x7F, 0x0F, 0x81, 0xFC, 0xFE,
+  0x3E, 0x03, 0xF9, 0xFC, 0xF8, 0x07, 0xF3, 0xFB, 0xC0, 0x1F, 0xE3, 0xFF,
+  0x00, 0x3F, 0x87, 0xFC, 0x00, 0x7F, 0x0F, 0xF0, 0x01, 0xFE, 0x0F, 0xF0,
+  0x07, 0xF8, 0x1F, 0xF8, 0x3F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFF, 0x03, 0xDF, 0xFF, 0xF8, 0x07, 0x0F, 0xFF, 0xE0, 0x1C, 0x03, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
+  0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0,
+  0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
+  0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF,
+  0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F,
+  0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07,
+  0xFB, 0xF8, 0x03, 0xF9, 0xFF, 0x07, 0xFC, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0,
+  0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF,
+  0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xFB, 0xF8, 0x03, 0xF9, 0xFF, 0x07, 0xFC,
+  0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFC,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3D,
+  0xE0, 0x00, 0x3C, 0x78, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
+  0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07, 0xFB, 0xF8,
+  0x03, 0xF9, 0xFF, 0x07, 0xFC, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xE3, 0xE0,
+  0x01, 0xF1, 0xF0, 0x00, 0xF8, 0xF8, 0x00, 0x7C, 0x7C, 0x00, 0x3E, 0x3E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0,
+  0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE,
+  0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xF0, 0x07, 0xFB, 0xF8, 0x03, 0xF9, 0xFF, 0x07, 0xFC, 0x7F, 0xFF,
+  0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x1F,
+  0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFB, 0xFC,
+  0x00, 0x7F, 0x8F, 0xF0, 0x07, 0xF8, 0x7F, 0x80, 0x3F, 0xC1, 0xFE, 0x03,
+  0xFC, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xC1, 0xFE, 0x00, 0xFF, 0x1F, 0xE0,
+  0x03, 0xFD, 0xFE, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x01,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFB, 0xF8, 0x0F, 0xF7, 0xF0, 0x0F, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFE,
+  0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x0F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFF, 0x9F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0xFE, 0x00,
+  0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE,
+  0x1F, 0xF0, 0xFE, 0x3F, 0xC0, 0xFC, 0x7F, 0x01, 0xF8, 0xFE, 0x07, 0xF1,
+  0xFC, 0x3F, 0xE3, 0xF8, 0xFE, 0x07, 0xF1, 0xF0, 0x0F, 0xE7, 0xE0, 0x1F,
+  0xCF, 0xC0, 0x3F, 0x9F, 0xC0, 0x7F, 0x3F, 0xC0, 0xFE, 0x3F, 0xE1, 0xFC,
+  0x7F, 0xE3, 0xF8, 0x7F, 0xE7, 0xF0, 0x3F, 0xEF, 0xE0, 0x1F, 0xFF, 0xC0,
+  0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x41, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xF9, 0xFF, 0xF7, 0xF3, 0xFF, 0xEF, 0xE7, 0xFF, 0x9F, 0xC3, 0xF8,
+  0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F, 0x88, 0x00, 0x7F, 0x00, 0x01, 0xFC,
+  0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x03, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x3F, 0xFD, 0xFC, 0x7F, 0xE7, 0xF0,
+  0xFE, 0x1F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F, 0x88, 0x00, 0x7F, 0x00,
+  0x01, 0xFC, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF,
+  0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x03, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x3F, 0xFD, 0xFC, 0x7F,
+  0xE7, 0xF0, 0xFE, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x0F,
+  0xF0, 0x00, 0x79, 0xE0, 0x01, 0xE7, 0x80, 0x0F, 0x0F, 0x00, 0x78, 0x1E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F, 0x88, 0x00,
+  0x7F, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE,
+  0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x3F, 0xFD,
+  0xFC, 0x7F, 0xE7, 0xF0, 0xFE, 0x1F, 0xC0, 0x00, 0xE1, 0xC0, 0x07, 0xE7,
+  0x00, 0x3F, 0xFC, 0x00, 0xE7, 0xE0, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F,
+  0x88, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+  0x3F, 0xFD, 0xFC, 0x7F, 0xE7, 0xF0, 0xFE, 0x1F, 0xC0, 0x03, 0xE3, 0xE0,
+  0x0F, 0x8F, 0x80, 0x3E, 0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
+  0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xF0, 0x1F, 0xE2,
+  0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F,
+  0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF,
+  0xFF, 0x7F, 0x1F, 0xF9, 0xFC, 0x3F, 0x87, 0xF0, 0x00, 0x7C, 0x00, 0x03,
+  0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0x83, 0x80, 0x0E, 0x0E,
+  0x00, 0x38, 0x38, 0x00, 0xF1, 0xE0, 0x01, 0xFF, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F,
+  0x88, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0xCF,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+  0x3F, 0xFD, 0xFC, 0x7F, 0xE7, 0xF0, 0xFE, 0x1F, 0xC0, 0x03, 0xFC, 0x03,
+  0xFC, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x0F, 0xFF, 0xF7, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0x07, 0xFF, 0x87,
+  0xF8, 0x80, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x7F, 0x07, 0xFF,
+  0xF8, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x5F, 0xC0, 0xFF, 0x80, 0x0E, 0xFF,
+  0x0F, 0xFF, 0x01, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF, 0xFF,
+  0xFC, 0xFF, 0xFC, 0x7F, 0xFF, 0xC3, 0xFF, 0x81, 0xFF, 0xF8, 0x07, 0xF0,
+  0x01, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF,
+  0xF3, 0xFF, 0xFE, 0xFF, 0x81, 0xDF, 0xE0, 0x0F, 0xF8, 0x00, 0xFE, 0x00,
+  0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
+  0x3F, 0xC0, 0x03, 0xFC, 0x01, 0x7F, 0xC0, 0xE7, 0xFF, 0xFC, 0x7F, 0xFF,
+  0x87, 0xFF, 0xF0, 0x7F, 0xFE, 0x01, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x00, 0x00, 0xE0, 0x04, 0x3C, 0x00, 0xFF, 0x80, 0x1F, 0xE0,
+  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F,
+  0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0x3F, 0x80,
+  0xFE, 0xFF, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x02,
+  0x7F, 0x00, 0x1C, 0xFF, 0x80, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0x1F, 0xF0, 0xFF, 0x3F, 0x80, 0xFE, 0xFF, 0x00, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x1C, 0xFF, 0x80, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00,
+  0x3F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x78, 0x78, 0x01, 0xE0, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F,
+  0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0x3F, 0x80,
+  0xFE, 0xFF, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x02,
+  0x7F, 0x00, 0x1C, 0xFF, 0x80, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xE3, 0xE0,
+  0x07, 0xC7, 0xC0, 0x0F, 0x8F, 0x80, 0x1F, 0x1F, 0x00, 0x3E, 0x3E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F,
+  0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xF8,
+  0x7F, 0x9F, 0xC0, 0x7F, 0x7F, 0x80, 0x7F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3F, 0x80, 0x01, 0x3F, 0x80, 0x0E, 0x7F, 0xC0, 0x7C, 0x7F, 0xFF, 0xF8,
+  0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x1F, 0xE0, 0x00,
+  0xFC, 0x07, 0xC0, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1,
+  0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC,
+  0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x03, 0xE0, 0x7C, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x00, 0x07, 0xC0, 0x1F, 0xC0, 0x3F, 0x80,
+  0xF7, 0x83, 0xC7, 0x87, 0x07, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0,
+  0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x03,
+  0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE,
+  0x01, 0xFC, 0x03, 0xF8, 0x00, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xF1, 0xFF,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x3F,
+  0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0,
+  0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07,
+  0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x10, 0x07, 0xE1, 0xF0,
+  0x07, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0xE0, 0x0F,
+  0xEF, 0xE0, 0x0E, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x07,
+  0xFF, 0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF,
+  0xFF, 0x3F, 0xC1, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F,
+  0xBF, 0x80, 0xFE, 0x7F, 0x83, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xE1, 0xC0,
+  0x1F, 0x8E, 0x01, 0xFF, 0xF0, 0x0E, 0x7F, 0x00, 0x70, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
+  0x9F, 0xF1, 0xFD, 0xFF, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFE, 0x1F,
+  0xFF, 0xE0, 0x7F, 0xFF, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC,
+  0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+  0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0,
+  0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x07, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80,
+  0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+  0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F,
+  0xE0, 0xFF, 0x3F, 0x80, 0xFE, 0xFF, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x80, 0xFF, 0x7F, 0x01, 0xFC, 0xFF, 0x07, 0xF8, 0xFF, 0xFF,
+  0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x03,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0x3F, 0x80, 0xFE, 0xFF,
+  0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0x7F, 0x01,
+  0xFC, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE,
+  0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0x00, 0x0F, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x70, 0x78,
+  0x01, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+  0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F,
+  0xE0, 0xFF, 0x3F, 0x80, 0xFE, 0xFF, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x80, 0xFF, 0x7F, 0x01, 0xFC, 0xFF, 0x07, 0xF8, 0xFF, 0xFF,
+  0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC0,
+  0x00, 0x01, 0xE1, 0xC0, 0x07, 0xE3, 0x80, 0x1F, 0xFF, 0x00, 0x39, 0xFC,
+  0x00, 0x70, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x03,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0x3F, 0x80, 0xFE, 0xFF,
+  0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0x7F, 0x01,
+  0xFC, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE,
+  0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xC7, 0xC0, 0x0F, 0x8F,
+  0x80, 0x1F, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xF0, 0x7F, 0x9F,
+  0xC0, 0x7F, 0x7F, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0,
+  0x7F, 0xBF, 0x80, 0xFE, 0x7F, 0x83, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x00, 0x0C, 0x03, 0xFC, 0x3C, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF,
+  0xC3, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0x3F, 0x81, 0xFE,
+  0xFF, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7B, 0xFF, 0xF1, 0xE7, 0xFF,
+  0xE7, 0x8F, 0xFF, 0xDE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0x7F,
+  0x81, 0xFC, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF,
+  0xFF, 0x0F, 0xFF, 0xF8, 0x3C, 0x7F, 0xC0, 0x30, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF,
+  0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0,
+  0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xBF, 0x8F, 0xF9, 0xFC, 0x3F, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+  0x3E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
+  0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xFE,
+  0x07, 0xFF, 0xF8, 0x7F, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF3, 0xFF, 0xBF,
+  0x8F, 0xF9, 0xFC, 0x3F, 0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x7F, 0x00, 0x07, 0xBC, 0x00, 0x78, 0xF0, 0x03, 0x83, 0x80, 0x38, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFC,
+  0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+  0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0,
+  0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xFE, 0x07, 0xFF,
+  0xF8, 0x7F, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF3, 0xFF, 0xBF, 0x8F, 0xF9,
+  0xFC, 0x3F, 0x0F, 0xE0, 0x0F, 0x8F, 0x80, 0x7C, 0x7C, 0x03, 0xE3, 0xE0,
+  0x1F, 0x1F, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF,
+  0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03,
+  0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+  0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0xFF,
+  0xDF, 0xFF, 0xFE, 0x7F, 0xF7, 0xF1, 0xFF, 0x3F, 0x87, 0xE1, 0xFC, 0x00,
+  0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x7E, 0x00, 0x7E, 0x7F,
+  0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x3F, 0x80, 0xFC, 0x3F, 0x81, 0xFC, 0x1F,
+  0x81, 0xF8, 0x1F, 0xC1, 0xF8, 0x0F, 0xC3, 0xF8, 0x0F, 0xE3, 0xF0, 0x07,
+  0xE3, 0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xF7, 0xE0, 0x03, 0xF7, 0xE0, 0x03,
+  0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00,
+  0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x01, 0xFC,
+  0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0,
+  0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x1F, 0x81, 0xFC, 0xFF,
+  0xC3, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xF0, 0x7F,
+  0xBF, 0xC0, 0x7F, 0x7F, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF,
+  0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF,
+  0xC0, 0x7F, 0xFF, 0x80, 0xFE, 0xFF, 0x83, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xE7, 0xF7, 0xFF, 0x8F, 0xE7, 0xFE, 0x1F, 0xC3, 0xF0, 0x3F, 0x80,
+  0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF1,
+  0xF0, 0x01, 0xF1, 0xF0, 0x01, 0xF1, 0xF0, 0x01, 0xF1, 0xF0, 0x01, 0xF1,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x7F, 0x7E, 0x00, 0x7E, 0x7F, 0x00, 0xFE, 0x3F, 0x00,
+  0xFE, 0x3F, 0x80, 0xFC, 0x3F, 0x81, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0xC1,
+  0xF8, 0x0F, 0xC3, 0xF8, 0x0F, 0xE3, 0xF0, 0x07, 0xE3, 0xF0, 0x07, 0xE7,
+  0xE0, 0x07, 0xF7, 0xE0, 0x03, 0xF7, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
+  0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE,
+  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0,
+  0x00, 0x1F, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans_Bold20pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
+  {     1,   7,  28,  18,    5,  -27 },   // 0x21 '!'
+  {    26,  12,  11,  20,    4,  -27 },   // 0x22 '"'
+  {    43,  27,  28,  33,    3,  -27 },   // 0x23 '#'
+  {   138,  21,  35,  27,    3,  -28 },   // 0x24 '$'
+  {   230,  37,  29,  39,    1,  -28 },   // 0x25 '%'
+  {   365,  30,  29,  34,    2,  -28 },   // 0x26 '&'
+  {   474,   4,  11,  12,    4,  -27 },   // 0x27 '''
+  {   480,  11,  35,  18,    3,  -29 },   // 0x28 '('
+  {   529,  11,  35,  18,    3,  -29 },   // 0x29 ')'
+  {   578,  19,  18,  20,    1,  -28 },   // 0x2A '*'
+  {   621,  23,  23,  33,    5,  -22 },   // 0x2B '+'
+  {   688,   9,  13,  15,    2,   -6 },   // 0x2C ','
+  {   703,  12,   6,  16,    2,  -13 },   // 0x2D '-'
+  {   712,   7,   7,  15,    4,   -6 },   // 0x2E '.'
+  {   719,  14,  32,  14,    0,  -27 },   // 0x2F '/'
+  {   775,  23,  29,  27,    2,  -28 },   // 0x30 '0'
+  {   859,  20,  28,  27,    4,  -27 },   // 0x31 '1'
+  {   929,  21,  29,  27,    3,  -28 },   // 0x32 '2'
+  {  1006,  21,  29,  27,    3,  -28 },   // 0x33 '3'
+  {  1083,  24,  28,  27,    2,  -27 },   // 0x34 '4'
+  {  1167,  21,  28,  27,    3,  -27 },   // 0x35 '5'
+  {  1241,  23,  29,  27,    2,  -28 },   // 0x36 '6'
+  {  1325,  21,  28,  27,    3,  -27 },   // 0x37 '7'
+  {  1399,  22,  29,  27,    2,  -28 },   // 0x38 '8'
+  {  1479,  23,  29,  27,    2,  -28 },   // 0x39 '9'
+  {  1563,   7,  21,  16,    4,  -20 },   // 0x3A ':'
+  {  1582,   9,  27,  16,    2,  -20 },   // 0x3B ';'
+  {  1613,  24,  22,  33,    4,  -22 },   // 0x3C '<'
+  {  1679,  24,  14,  33,    4,  -18 },   // 0x3D '='
+  {  1721,  24,  22,  33,    4,  -22 },   // 0x3E '>'
+  {  1787,  17,  28,  23,    3,  -27 },   // 0x3F '?'
+  {  1847,  34,  34,  39,    3,  -26 },   // 0x40 '@'
+  {  1992,  30,  28,  30,    0,  -27 },   // 0x41 'A'
+  {  2097,  23,  28,  30,    4,  -27 },   // 0x42 'B'
+  {  2178,  24,  29,  29,    2,  -28 },   // 0x43 'C'
+  {  2265,  27,  28,  32,    4,  -27 },   // 0x44 'D'
+  {  2360,  20,  28,  27,    4,  -27 },   // 0x45 'E'
+  {  2430,  20,  28,  27,    4,  -27 },   // 0x46 'F'
+  {  2500,  27,  29,  32,    2,  -28 },   // 0x47 'G'
+  {  2598,  25,  28,  33,    4,  -27 },   // 0x48 'H'
+  {  2686,   7,  28,  15,    4,  -27 },   // 0x49 'I'
+  {  2711,  13,  36,  15,   -2,  -27 },   // 0x4A 'J'
+  {  2770,  28,  28,  30,    4,  -27 },   // 0x4B 'K'
+  {  2868,  20,  28,  25,    4,  -27 },   // 0x4C 'L'
+  {  2938,  32,  28,  39,    4,  -27 },   // 0x4D 'M'
+  {  3050,  25,  28,  33,    4,  -27 },   // 0x4E 'N'
+  {  3138,  29,  29,  33,    2,  -28 },   // 0x4F 'O'
+  {  3244,  23,  28,  29,    4,  -27 },   // 0x50 'P'
+  {  3325,  29,  35,  33,    2,  -28 },   // 0x51 'Q'
+  {  3452,  26,  28,  30,    4,  -27 },   // 0x52 'R'
+  {  3543,  22,  29,  28,    3,  -28 },   // 0x53 'S'
+  {  3623,  25,  28,  27,    1,  -27 },   // 0x54 'T'
+  {  3711,  25,  28,  32,    4,  -27 },   // 0x55 'U'
+  {  3799,  30,  28,  30,    0,  -27 },   // 0x56 'V'
+  {  3904,  41,  28,  43,    1,  -27 },   // 0x57 'W'
+  {  4048,  29,  28,  30,    1,  -27 },   // 0x58 'X'
+  {  4150,  29,  28,  28,   -1,  -27 },   // 0x59 'Y'
+  {  4252,  25,  28,  28,    2,  -27 },   // 0x5A 'Z'
+  {  4340,  11,  35,  18,    3,  -29 },   // 0x5B '['
+  {  4389,  14,  32,  14,    0,  -27 },   // 0x5C '\'
+  {  4445,  11,  35,  18,    3,  -29 },   // 0x5D ']'
+  {  4494,  25,  11,  33,    4,  -27 },   // 0x5E '^'
+  {  4529,  20,   4,  20,    0,    6 },   // 0x5F '_'
+  {  4539,  11,   7,  20,    2,  -30 },   // 0x60 '`'
+  {  4549,  22,  22,  26,    2,  -21 },   // 0x61 'a'
+  {  4610,  23,  30,  28,    3,  -29 },   // 0x62 'b'
+  {  4697,  19,  22,  23,    2,  -21 },   // 0x63 'c'
+  {  4750,  23,  30,  28,    2,  -29 },   // 0x64 'd'
+  {  4837,  23,  22,  26,    2,  -21 },   // 0x65 'e'
+  {  4901,  16,  30,  17,    1,  -29 },   // 0x66 'f'
+  {  4961,  23,  30,  28,    2,  -21 },   // 0x67 'g'
+  {  5048,  21,  30,  28,    3,  -29 },   // 0x68 'h'
+  {  5127,   7,  30,  13,    3,  -29 },   // 0x69 'i'
+  {  5154,  12,  38,  13,   -2,  -29 },   // 0x6A 'j'
+  {  5211,  23,  30,  26,    3,  -29 },   // 0x6B 'k'
+  {  5298,   7,  30,  13,    3,  -29 },   // 0x6C 'l'
+  {  5325,  35,  22,  41,    3,  -21 },   // 0x6D 'm'
+  {  5422,  21,  22,  28,    3,  -21 },   // 0x6E 'n'
+  {  5480,  23,  22,  27,    2,  -21 },   // 0x6F 'o'
+  {  5544,  23,  30,  28,    3,  -21 },   // 0x70 'p'
+  {  5631,  23,  30,  28,    2,  -21 },   // 0x71 'q'
+  {  5718,  16,  22,  19,    3,  -21 },   // 0x72 'r'
+  {  5762,  19,  22,  23,    2,  -21 },   // 0x73 's'
+  {  5815,  17,  27,  19,    1,  -26 },   // 0x74 't'
+  {  5873,  21,  21,  28,    3,  -20 },   // 0x75 'u'
+  {  5929,  24,  21,  25,    1,  -20 },   // 0x76 'v'
+  {  5992,  33,  21,  36,    1,  -20 },   // 0x77 'w'
+  {  6079,  24,  21,  25,    1,  -20 },   // 0x78 'x'
+  {  6142,  24,  29,  25,    0,  -20 },   // 0x79 'y'
+  {  6229,  19,  21,  23,    2,  -20 },   // 0x7A 'z'
+  {  6279,  18,  36,  28,    5,  -29 },   // 0x7B '{'
+  {  6360,   4,  39,  14,    5,  -29 },   // 0x7C '|'
+  {  6380,  18,  36,  28,    5,  -29 },   // 0x7D '}'
+  {  6461,  24,   8,  33,    4,  -15 },   // 0x7E '~'
+  {  6485,  20,  34,  23,    2,  -27 },   // 0x7F
+  {  6570,  20,  34,  23,    2,  -27 },   // 0x80
+  {  6655,  20,  34,  23,    2,  -27 },   // 0x81
+  {  6740,  20,  34,  23,    2,  -27 },   // 0x82
+  {  6825,  20,  34,  23,    2,  -27 },   // 0x83
+  {  6910,  20,  34,  23,    2,  -27 },   // 0x84
+  {  6995,  20,  34,  23,    2,  -27 },   // 0x85
+  {  7080,  20,  34,  23,    2,  -27 },   // 0x86
+  {  7165,  20,  34,  23,    2,  -27 },   // 0x87
+  {  7250,  20,  34,  23,    2,  -27 },   // 0x88
+  {  7335,  20,  34,  23,    2,  -27 },   // 0x89
+  {  7420,  20,  34,  23,    2,  -27 },   // 0x8A
+  {  7505,  20,  34,  23,    2,  -27 },   // 0x8B
+  {  7590,  20,  34,  23,    2,  -27 },   // 0x8C
+  {  7675,  20,  34,  23,    2,  -27 },   // 0x8D
+  {  7760,  20,  34,  23,    2,  -27 },   // 0x8E
+  {  7845,  20,  34,  23,    2,  -27 },   // 0x8F
+  {  7930,  20,  34,  23,    2,  -27 },   // 0x90
+  {  8015,  20,  34,  23,    2,  -27 },   // 0x91
+  {  8100,  20,  34,  23,    2,  -27 },   // 0x92
+  {  8185,  20,  34,  23,    2,  -27 },   // 0x93
+  {  8270,  20,  34,  23,    2,  -27 },   // 0x94
+  {  8355,  20,  34,  23,    2,  -27 },   // 0x95
+  {  8440,  20,  34,  23,    2,  -27 },   // 0x96
+  {  8525,  20,  34,  23,    2,  -27 },   // 0x97
+  {  8610,  20,  34,  23,    2,  -27 },   // 0x98
+  {  8695,  20,  34,  23,    2,  -27 },   // 0x99
+  {  8780,  20,  34,  23,    2,  -27 },   // 0x9A
+  {  8865,  20,  34,  23,    2,  -27 },   // 0x9B
+  {  8950,  20,  34,  23,    2,  -27 },   // 0x9C
+  {  9035,  20,  34,  23,    2,  -27 },   // 0x9D
+  {  9120,  20,  34,  23,    2,  -27 },   // 0x9E
+  {  9205,  20,  34,  23,    2,  -27 },   // 0x9F
+  {  9290,   1,   1,  14,    0,    0 },   // 0xA0
+  {  9291,   7,  28,  18,    5,  -20 },   // 0xA1
+  {  9316,  19,  33,  27,    3,  -26 },   // 0xA2
+  {  9395,  21,  29,  27,    3,  -28 },   // 0xA3
+  {  9472,  22,  22,  25,    1,  -22 },   // 0xA4
+  {  9533,  25,  28,  27,    1,  -27 },   // 0xA5
+  {  9621,   4,  33,  14,    5,  -26 },   // 0xA6
+  {  9638,  19,  33,  20,    1,  -28 },   // 0xA7
+  {  9717,  13,   5,  20,    4,  -29 },   // 0xA8
+  {  9726,  28,  28,  39,    5,  -27 },   // 0xA9
+  {  9824,  16,  22,  22,    3,  -28 },   // 0xAA
+  {  9868,  18,  18,  25,    3,  -19 },   // 0xAB
+  {  9909,  24,  12,  33,    4,  -16 },   // 0xAC
+  {  9945,  12,   6,  16,    2,  -13 },   // 0xAD
+  {  9954,  28,  28,  39,    5,  -27 },   // 0xAE
+  { 10052,  12,   4,  20,    4,  -29 },   // 0xAF
+  { 10058,  13,  13,  20,    3,  -28 },   // 0xB0
+  { 10080,  25,  25,  33,    4,  -24 },   // 0xB1
+  { 10159,  13,  16,  17,    2,  -28 },   // 0xB2
+  { 10185,  13,  16,  17,    2,  -28 },   // 0xB3
+  { 10211,  11,   7,  20,    7,  -30 },   // 0xB4
+  { 10221,  24,  29,  29,    3,  -20 },   // 0xB5
+  { 10308,  20,  32,  25,    2,  -27 },   // 0xB6
+  { 10388,   7,   7,  15,    4,  -16 },   // 0xB7
+  { 10395,   9,   8,  20,    5,    1 },   // 0xB8
+  { 10404,  12,  16,  17,    3,  -28 },   // 0xB9
+  { 10428,  18,  22,  22,    2,  -28 },   // 0xBA
+  { 10478,  18,  18,  25,    4,  -19 },   // 0xBB
+  { 10519,  35,  29,  40,    3,  -28 },   // 0xBC
+  { 10646,  36,  29,  40,    3,  -28 },   // 0xBD
+  { 10777,  36,  29,  40,    2,  -28 },   // 0xBE
+  { 10908,  17,  29,  23,    3,  -20 },   // 0xBF
+  { 10970,  30,  36,  30,    0,  -35 },   // 0xC0
+  { 11105,  30,  36,  30,    0,  -35 },   // 0xC1
+  { 11240,  30,  36,  30,    0,  -35 },   // 0xC2
+  { 11375,  30,  36,  30,    0,  -35 },   // 0xC3
+  { 11510,  30,  36,  30,    0,  -35 },   // 0xC4
+  { 11645,  30,  36,  30,    0,  -35 },   // 0xC5
+  { 11780,  39,  28,  42,    0,  -27 },   // 0xC6
+  { 11917,  24,  37,  29,    2,  -28 },   // 0xC7
+  { 12028,  20,  36,  27,    4,  -35 },   // 0xC8
+  { 12118,  20,  36,  27,    4,  -35 },   // 0xC9
+  { 12208,  20,  36,  27,    4,  -35 },   // 0xCA
+  { 12298,  20,  36,  27,    4,  -35 },   // 0xCB
+  { 12388,  10,  36,  15,    1,  -35 },   // 0xCC
+  { 12433,   9,  36,  15,    4,  -35 },   // 0xCD
+  { 12474,  15,  36,  15,    0,  -35 },   // 0xCE
+  { 12542,  13,  36,  15,    1,  -35 },   // 0xCF
+  { 12601,  30,  28,  33,    1,  -27 },   // 0xD0
+  { 12706,  25,  36,  33,    4,  -35 },   // 0xD1
+  { 12819,  29,  36,  33,    2,  -35 },   // 0xD2
+  { 12950,  29,  36,  33,    2,  -35 },   // 0xD3
+  { 13081,  29,  36,  33,    2,  -35 },   // 0xD4
+  { 13212,  29,  36,  33,    2,  -35 },   // 0xD5
+  { 13343,  29,  36,  33,    2,  -35 },   // 0xD6
+  { 13474,  23,  23,  33,    5,  -23 },   // 0xD7
+  { 13541,  31,  31,  33,    1,  -29 },   // 0xD8
+  { 13662,  25,  36,  32,    4,  -35 },   // 0xD9
+  { 13775,  25,  36,  32,    4,  -35 },   // 0xDA
+  { 13888,  25,  36,  32,    4,  -35 },   // 0xDB
+  { 14001,  25,  36,  32,    4,  -35 },   // 0xDC
+  { 14114,  29,  36,  28,   -1,  -35 },   // 0xDD
+  { 14245,  23,  28,  29,    4,  -27 },   // 0xDE
+  { 14326,  23,  30,  28,    3,  -29 },   // 0xDF
+  { 14413,  22,  31,  26,    2,  -30 },   // 0xE0
+  { 14499,  22,  31,  26,    2,  -30 },   // 0xE1
+  { 14585,  22,  31,  26,    2,  -30 },   // 0xE2
+  { 14671,  22,  31,  26,    2,  -30 },   // 0xE3
+  { 14757,  22,  30,  26,    2,  -29 },   // 0xE4
+  { 14840,  22,  35,  26,    2,  -34 },   // 0xE5
+  { 14937,  37,  22,  41,    2,  -21 },   // 0xE6
+  { 15039,  19,  30,  23,    2,  -21 },   // 0xE7
+  { 15111,  23,  31,  26,    2,  -30 },   // 0xE8
+  { 15201,  23,  31,  26,    2,  -30 },   // 0xE9
+  { 15291,  23,  31,  26,    2,  -30 },   // 0xEA
+  { 15381,  23,  30,  26,    2,  -29 },   // 0xEB
+  { 15468,  11,  31,  13,   -1,  -30 },   // 0xEC
+  { 15511,  12,  31,  13,    3,  -30 },   // 0xED
+  { 15558,  15,  31,  13,   -1,  -30 },   // 0xEE
+  { 15617,  13,  30,  13,    0,  -29 },   // 0xEF
+  { 15666,  23,  30,  27,    2,  -29 },   // 0xF0
+  { 15753,  21,  31,  28,    3,  -30 },   // 0xF1
+  { 15835,  23,  31,  27,    2,  -30 },   // 0xF2
+  { 15925,  23,  31,  27,    2,  -30 },   // 0xF3
+  { 16015,  23,  31,  27,    2,  -30 },   // 0xF4
+  { 16105,  23,  31,  27,    2,  -30 },   // 0xF5
+  { 16195,  23,  30,  27,    2,  -29 },   // 0xF6
+  { 16282,  24,  21,  33,    4,  -21 },   // 0xF7
+  { 16345,  23,  24,  27,    2,  -22 },   // 0xF8
+  { 16414,  21,  31,  28,    3,  -30 },   // 0xF9
+  { 16496,  21,  31,  28,    3,  -30 },   // 0xFA
+  { 16578,  21,  31,  28,    3,  -30 },   // 0xFB
+  { 16660,  21,  30,  28,    3,  -29 },   // 0xFC
+  { 16739,  24,  39,  25,    0,  -30 },   // 0xFD
+  { 16856,  23,  38,  28,    3,  -29 },   // 0xFE
+  { 16966,  24,  38,  25,    0,  -29 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold20pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold20pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold20pt8bGlyphs,
+  0x20, 0xFF, 46 };
+
+// Approx. 18655 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold20pt8bMetrics[] PROGMEM = {
+  {   0,  14,   1 },   // 0x20
+  {   5,  18,  12 },   // 0x21
+  {   4,  20,  16 },   // 0x22
+  {   3,  33,  30 },   // 0x23
+  {   3,  27,  24 },   // 0x24
+  {   1,  39,  38 },   // 0x25
+  {   2,  34,  32 },   // 0x26
+  {   4,  12,   8 },   // 0x27
+  {   3,  18,  14 },   // 0x28
+  {   3,  18,  14 },   // 0x29
+  {   1,  20,  20 },   // 0x2A
+  {   5,  33,  28 },   // 0x2B
+  {   2,  15,  11 },   // 0x2C
+  {   2,  16,  14 },   // 0x2D
+  {   4,  15,  11 },   // 0x2E
+  {   0,  14,  14 },   // 0x2F
+  {   2,  27,  25 },   // 0x30
+  {   4,  27,  24 },   // 0x31
+  {   3,  27,  24 },   // 0x32
+  {   3,  27,  24 },   // 0x33
+  {   2,  27,  26 },   // 0x34
+  {   3,  27,  24 },   // 0x35
+  {   2,  27,  25 },   // 0x36
+  {   3,  27,  24 },   // 0x37
+  {   2,  27,  24 },   // 0x38
+  {   2,  27,  25 },   // 0x39
+  {   4,  16,  11 },   // 0x3A
+  {   2,  16,  11 },   // 0x3B
+  {   4,  33,  28 },   // 0x3C
+  {   4,  33,  28 },   // 0x3D
+  {   4,  33,  28 },   // 0x3E
+  {   3,  23,  20 },   // 0x3F
+  {   3,  39,  37 },   // 0x40
+  {   0,  30,  30 },   // 0x41
+  {   4,  30,  27 },   // 0x42
+  {   2,  29,  26 },   // 0x43
+  {   4,  32,  31 },   // 0x44
+  {   4,  27,  24 },   // 0x45
+  {   4,  27,  24 },   // 0x46
+  {   2,  32,  29 },   // 0x47
+  {   4,  33,  29 },   // 0x48
+  {   4,  15,  11 },   // 0x49
+  {  -2,  15,  11 },   // 0x4A
+  {   4,  30,  32 },   // 0x4B
+  {   4,  25,  24 },   // 0x4C
+  {   4,  39,  36 },   // 0x4D
+  {   4,  33,  29 },   // 0x4E
+  {   2,  33,  31 },   // 0x4F
+  {   4,  29,  27 },   // 0x50
+  {   2,  33,  31 },   // 0x51
+  {   4,  30,  30 },   // 0x52
+  {   3,  28,  25 },   // 0x53
+  {   1,  27,  26 },   // 0x54
+  {   4,  32,  29 },   // 0x55
+  {   0,  30,  30 },   // 0x56
+  {   1,  43,  42 },   // 0x57
+  {   1,  30,  30 },   // 0x58
+  {  -1,  28,  28 },   // 0x59
+  {   2,  28,  27 },   // 0x5A
+  {   3,  18,  14 },   // 0x5B
+  {   0,  14,  14 },   // 0x5C
+  {   3,  18,  14 },   // 0x5D
+  {   4,  33,  29 },   // 0x5E
+  {   0,  20,  20 },   // 0x5F
+  {   2,  20,  13 },   // 0x60
+  {   2,  26,  24 },   // 0x61
+  {   3,  28,  26 },   // 0x62
+  {   2,  23,  21 },   // 0x63
+  {   2,  28,  25 },   // 0x64
+  {   2,  26,  25 },   // 0x65
+  {   1,  17,  17 },   // 0x66
+  {   2,  28,  25 },   // 0x67
+  {   3,  28,  24 },   // 0x68
+  {   3,  13,  10 },   // 0x69
+  {  -2,  13,  10 },   // 0x6A
+  {   3,  26,  26 },   // 0x6B
+  {   3,  13,  10 },   // 0x6C
+  {   3,  41,  38 },   // 0x6D
+  {   3,  28,  24 },   // 0x6E
+  {   2,  27,  25 },   // 0x6F
+  {   3,  28,  26 },   // 0x70
+  {   2,  28,  25 },   // 0x71
+  {   3,  19,  19 },   // 0x72
+  {   2,  23,  21 },   // 0x73
+  {   1,  19,  18 },   // 0x74
+  {   3,  28,  24 },   // 0x75
+  {   1,  25,  25 },   // 0x76
+  {   1,  36,  34 },   // 0x77
+  {   1,  25,  25 },   // 0x78
+  {   0,  25,  24 },   // 0x79
+  {   2,  23,  21 },   // 0x7A
+  {   5,  28,  23 },   // 0x7B
+  {   5,  14,   9 },   // 0x7C
+  {   5,  28,  23 },   // 0x7D
+  {   4,  33,  28 },   // 0x7E
+  {   2,  23,  22 },   // 0x7F
+  {   2,  23,  22 },   // 0x80
+  {   2,  23,  22 },   // 0x81
+  {   2,  23,  22 },   // 0x82
+  {   2,  23,  22 },   // 0x83
+  {   2,  23,  22 },   // 0x84
+  {   2,  23,  22 },   // 0x85
+  {   2,  23,  22 },   // 0x86
+  {   2,  23,  22 },   // 0x87
+  {   2,  23,  22 },   // 0x88
+  {   2,  23,  22 },   // 0x89
+  {   2,  23,  22 },   // 0x8A
+  {   2,  23,  22 },   // 0x8B
+  {   2,  23,  22 },   // 0x8C
+  {   2,  23,  22 },   // 0x8D
+  {   2,  23,  22 },   // 0x8E
+  {   2,  23,  22 },   // 0x8F
+  {   2,  23,  22 },   // 0x90
+  {   2,  23,  22 },   // 0x91
+  {   2,  23,  22 },   // 0x92
+  {   2,  23,  22 },   // 0x93
+  {   2,  23,  22 },   // 0x94
+  {   2,  23,  22 },   // 0x95
+  {   2,  23,  22 },   // 0x96
+  {   2,  23,  22 },   // 0x97
+  {   2,  23,  22 },   // 0x98
+  {   2,  23,  22 },   // 0x99
+  {   2,  23,  22 },   // 0x9A
+  {   2,  23,  22 },   // 0x9B
+  {   2,  23,  22 },   // 0x9C
+  {   2,  23,  22 },   // 0x9D
+  {   2,  23,  22 },   // 0x9E
+  {   2,  23,  22 },   // 0x9F
+  {   0,  14,   1 },   // 0xA0
+  {   5,  18,  12 },   // 0xA1
+  {   3,  27,  22 },   // 0xA2
+  {   3,  27,  24 },   // 0xA3
+  {   1,  25,  23 },   // 0xA4
+  {   1,  27,  26 },   // 0xA5
+  {   5,  14,   9 },   // 0xA6
+  {   1,  20,  20 },   // 0xA7
+  {   4,  20,  17 },   // 0xA8
+  {   5,  39,  33 },   // 0xA9
+  {   3,  22,  19 },   // 0xAA
+  {   3,  25,  21 },   // 0xAB
+  {   4,  33,  28 },   // 0xAC
+  {   2,  16,  14 },   // 0xAD
+  {   5,  39,  33 },   // 0xAE
+  {   4,  20,  16 },   // 0xAF
+  {   3,  20,  16 },   // 0xB0
+  {   4,  33,  29 },   // 0xB1
+  {   2,  17,  15 },   // 0xB2
+  {   2,  17,  15 },   // 0xB3
+  {   7,  20,  18 },   // 0xB4
+  {   3,  29,  27 },   // 0xB5
+  {   2,  25,  22 },   // 0xB6
+  {   4,  15,  11 },   // 0xB7
+  {   5,  20,  14 },   // 0xB8
+  {   3,  17,  15 },   // 0xB9
+  {   2,  22,  20 },   // 0xBA
+  {   4,  25,  22 },   // 0xBB
+  {   3,  40,  38 },   // 0xBC
+  {   3,  40,  39 },   // 0xBD
+  {   2,  40,  38 },   // 0xBE
+  {   3,  23,  20 },   // 0xBF
+  {   0,  30,  30 },   // 0xC0
+  {   0,  30,  30 },   // 0xC1
+  {   0,  30,  30 },   // 0xC2
+  {   0,  30,  30 },   // 0xC3
+  {   0,  30,  30 },   // 0xC4
+  {   0,  30,  30 },   // 0xC5
+  {   0,  42,  39 },   // 0xC6
+  {   2,  29,  26 },   // 0xC7
+  {   4,  27,  24 },   // 0xC8
+  {   4,  27,  24 },   // 0xC9
+  {   4,  27,  24 },   // 0xCA
+  {   4,  27,  24 },   // 0xCB
+  {   1,  15,  11 },   // 0xCC
+  {   4,  15,  13 },   // 0xCD
+  {   0,  15,  15 },   // 0xCE
+  {   1,  15,  14 },   // 0xCF
+  {   1,  33,  31 },   // 0xD0
+  {   4,  33,  29 },   // 0xD1
+  {   2,  33,  31 },   // 0xD2
+  {   2,  33,  31 },   // 0xD3
+  {   2,  33,  31 },   // 0xD4
+  {   2,  33,  31 },   // 0xD5
+  {   2,  33,  31 },   // 0xD6
+  {   5,  33,  28 },   // 0xD7
+  {   1,  33,  32 },   // 0xD8
+  {   4,  32,  29 },   // 0xD9
+  {   4,  32,  29 },   // 0xDA
+  {   4,  32,  29 },   // 0xDB
+  {   4,  32,  29 },   // 0xDC
+  {  -1,  28,  28 },   // 0xDD
+  {   4,  29,  27 },   // 0xDE
+  {   3,  28,  26 },   // 0xDF
+  {   2,  26,  24 },   // 0xE0
+  {   2,  26,  24 },   // 0xE1
+  {   2,  26,  24 },   // 0xE2
+  {   2,  26,  24 },   // 0xE3
+  {   2,  26,  24 },   // 0xE4
+  {   2,  26,  24 },   // 0xE5
+  {   2,  41,  39 },   // 0xE6
+  {   2,  23,  21 },   // 0xE7
+  {   2,  26,  25 },   // 0xE8
+  {   2,  26,  25 },   // 0xE9
+  {   2,  26,  25 },   // 0xEA
+  {   2,  26,  25 },   // 0xEB
+  {  -1,  13,  10 },   // 0xEC
+  {   3,  13,  15 },   // 0xED
+  {  -1,  13,  14 },   // 0xEE
+  {   0,  13,  13 },   // 0xEF
+  {   2,  27,  25 },   // 0xF0
+  {   3,  28,  24 },   // 0xF1
+  {   2,  27,  25 },   // 0xF2
+  {   2,  27,  25 },   // 0xF3
+  {   2,  27,  25 },   // 0xF4
+  {   2,  27,  25 },   // 0xF5
+  {   2,  27,  25 },   // 0xF6
+  {   4,  33,  28 },   // 0xF7
+  {   2,  27,  25 },   // 0xF8
+  {   3,  28,  24 },   // 0xF9
+  {   3,  28,  24 },   // 0xFA
+  {   3,  28,  24 },   // 0xFB
+  {   3,  28,  24 },   // 0xFC
+  {   0,  25,  24 },   // 0xFD
+  {   3,  28,  26 },   // 0xFE
+  {   0,  25,  24 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold20pt8bWidths = { DejaVuSans_Bold20pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD20PTLAT1__H
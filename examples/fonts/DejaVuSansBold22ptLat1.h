@@ -0,0 +1,2217 @@
+#ifndef DEJAVUSANSBOLD22PTLAT1__H
+#define DEJAVUSANSBOLD22PTLAT1__H
+const uint8_t DejaVuSans_Bold22pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xE1, 0xFF,
+  0x87, 0xFE, 0x1F, 0xF8, 0x7F, 0xE1, 0xFF, 0x87, 0xFE, 0x1F, 0xF8, 0x7F,
+  0xE1, 0xFF, 0x87, 0xFE, 0x1F, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x1F,
+  0x00, 0x01, 0xE0, 0x7C, 0x00, 0x0F, 0x81, 0xE0, 0x00, 0x3E, 0x0F, 0x80,
+  0x00, 0xF8, 0x3E, 0x00, 0x03, 0xC0, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x0F, 0x03,
+  0xE0, 0x00, 0x7C, 0x0F, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x07, 0xC1, 0xF0,
+  0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x3C, 0x00, 0x07,
+  0xC0, 0xF0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x1F, 0x00, 0x01, 0xE0,
+  0x78, 0x00, 0x0F, 0x81, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xF8, 0x3E,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x38, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0x38, 0x7C, 0xFE,
+  0x38, 0x04, 0xFE, 0x38, 0x00, 0xFE, 0x38, 0x00, 0xFF, 0x38, 0x00, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F,
+  0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x39, 0xFF, 0x00,
+  0x38, 0x7F, 0x00, 0x38, 0x7F, 0x80, 0x38, 0x7F, 0xE0, 0x38, 0x7F, 0xFC,
+  0x38, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x07,
+  0xF0, 0x00, 0x1F, 0x00, 0x1F, 0xFC, 0x00, 0x3E, 0x00, 0x3F, 0xFE, 0x00,
+  0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x7C, 0x00, 0x7E, 0x3F, 0x00, 0x78, 0x00,
+  0xFC, 0x1F, 0x80, 0xF8, 0x00, 0xF8, 0x0F, 0x81, 0xF0, 0x00, 0xF8, 0x0F,
+  0x81, 0xE0, 0x00, 0xF8, 0x0F, 0x83, 0xE0, 0x00, 0xF8, 0x0F, 0x83, 0xC0,
+  0x00, 0xF8, 0x0F, 0x87, 0xC0, 0x00, 0xFC, 0x1F, 0x8F, 0x80, 0x00, 0x7E,
+  0x3F, 0x0F, 0x00, 0x00, 0x7F, 0xFF, 0x1F, 0x00, 0x00, 0x3F, 0xFE, 0x1E,
+  0x00, 0x00, 0x1F, 0xFC, 0x3E, 0x0F, 0xE0, 0x07, 0xF0, 0x7C, 0x3F, 0xF8,
+  0x00, 0x00, 0x78, 0x7F, 0xFC, 0x00, 0x00, 0xF8, 0xFF, 0xFE, 0x00, 0x00,
+  0xF0, 0xFC, 0x7E, 0x00, 0x01, 0xF1, 0xF8, 0x3F, 0x00, 0x03, 0xE1, 0xF0,
+  0x1F, 0x00, 0x03, 0xC1, 0xF0, 0x1F, 0x00, 0x07, 0xC1, 0xF0, 0x1F, 0x00,
+  0x07, 0x81, 0xF0, 0x1F, 0x00, 0x0F, 0x81, 0xF0, 0x1F, 0x00, 0x1F, 0x01,
+  0xF8, 0x3F, 0x00, 0x1E, 0x00, 0xFC, 0x7E, 0x00, 0x3E, 0x00, 0xFF, 0xFE,
+  0x00, 0x3C, 0x00, 0x7F, 0xFC, 0x00, 0x7C, 0x00, 0x3F, 0xF8, 0x00, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
+  0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
+  0x3F, 0xE0, 0xF0, 0x00, 0x1F, 0xE0, 0x08, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x03,
+  0xF8, 0x7F, 0xFF, 0x01, 0xFC, 0x7F, 0xFF, 0xC0, 0xFE, 0x3F, 0xDF, 0xF0,
+  0x7E, 0x3F, 0xC7, 0xF8, 0x7F, 0x1F, 0xE1, 0xFE, 0x3F, 0x9F, 0xE0, 0x7F,
+  0x9F, 0xCF, 0xF0, 0x1F, 0xFF, 0xC7, 0xF8, 0x0F, 0xFF, 0xE3, 0xFC, 0x03,
+  0xFF, 0xE1, 0xFE, 0x00, 0xFF, 0xE0, 0xFF, 0x80, 0x3F, 0xE0, 0x3F, 0xE0,
+  0x1F, 0xF0, 0x1F, 0xFC, 0x1F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE7, 0xFC, 0x01,
+  0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
+  0xF0, 0x7E, 0x07, 0xE0, 0xFC, 0x0F, 0xC1, 0xFC, 0x1F, 0x83, 0xF8, 0x3F,
+  0x83, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE,
+  0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0x7E,
+  0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF8, 0x3F, 0x81, 0xF8, 0x1F,
+  0xC0, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x3F, 0xFC, 0x07, 0xE0, 0x7E,
+  0x03, 0xF0, 0x3F, 0x03, 0xF8, 0x1F, 0x81, 0xFC, 0x1F, 0xC0, 0xFC, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xE0, 0x7E, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
+  0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xE0, 0xFE, 0x0F,
+  0xE0, 0xFE, 0x0F, 0xC1, 0xFC, 0x1F, 0xC1, 0xF8, 0x3F, 0x83, 0xF0, 0x3F,
+  0x07, 0xE0, 0x7E, 0x0F, 0xC0, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07,
+  0x80, 0x18, 0x1E, 0x06, 0x70, 0x78, 0x3B, 0xF1, 0xE3, 0xF7, 0xF7, 0xBF,
+  0x87, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xE1, 0xFD, 0xEF, 0xEF, 0xC7, 0x8F, 0xDC, 0x1E,
+  0x0E, 0x60, 0x78, 0x18, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC,
+  0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFE, 0x7F, 0x1F, 0xC7, 0xE1, 0xF0, 0xF8,
+  0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x00, 0x1F,
+  0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+  0x01, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+  0x07, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00,
+  0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF8,
+  0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x0F, 0xF8,
+  0x7F, 0xC3, 0xFC, 0x0F, 0xF1, 0xFE, 0x01, 0xFE, 0x7F, 0x80, 0x7F, 0x9F,
+  0xE0, 0x1F, 0xE7, 0xF0, 0x03, 0xFB, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00,
+  0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xE7, 0xF8, 0x07, 0xF9, 0xFE, 0x01, 0xFE,
+  0x7F, 0x80, 0x7F, 0x8F, 0xF0, 0x3F, 0xC3, 0xFE, 0x1F, 0xF0, 0x7F, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x01,
+  0xFE, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF,
+  0x80, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0x9F, 0xE0, 0x30, 0x7F, 0x80,
+  0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01,
+  0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE,
+  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00,
+  0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFF,
+  0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xBC, 0x00, 0xFF,
+  0xE0, 0x01, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8,
+  0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00,
+  0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07,
+  0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF8,
+  0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC,
+  0x7F, 0xFF, 0xFC, 0x78, 0x0F, 0xFE, 0x40, 0x03, 0xFE, 0x00, 0x01, 0xFE,
+  0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
+  0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFE,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x07, 0xFE, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x00,
+  0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03,
+  0xEF, 0xF0, 0x01, 0xFB, 0xFC, 0x00, 0xFC, 0xFF, 0x00, 0x7E, 0x3F, 0xC0,
+  0x1F, 0x0F, 0xF0, 0x0F, 0xC3, 0xFC, 0x07, 0xE0, 0xFF, 0x01, 0xF0, 0x3F,
+  0xC0, 0xFC, 0x0F, 0xF0, 0x7E, 0x03, 0xFC, 0x1F, 0x00, 0xFF, 0x0F, 0x80,
+  0x3F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F,
+  0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x7F,
+  0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x78,
+  0x0F, 0xFE, 0x40, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0xFC, 0x0F, 0xFE, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x07,
+  0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0xF0, 0xFF, 0x80, 0x08,
+  0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x00,
+  0x1F, 0xE3, 0xF8, 0x0F, 0xF7, 0xFF, 0x07, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+  0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xE1, 0xFF, 0x7F, 0xE0, 0x7F, 0xBF, 0xE0,
+  0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x03, 0xFD, 0xFE,
+  0x01, 0xFE, 0xFF, 0x00, 0xFF, 0x7F, 0x80, 0x7F, 0x9F, 0xE0, 0x7F, 0x8F,
+  0xF8, 0x7F, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
+  0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00,
+  0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
+  0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE3, 0xFF, 0x1F, 0xF9, 0xFF, 0x07,
+  0xFC, 0xFF, 0x01, 0xFE, 0x7F, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0x9F, 0xE0,
+  0x3F, 0xC7, 0xF8, 0x3F, 0xC3, 0xFE, 0x3F, 0xE0, 0xFF, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x1F,
+  0xF0, 0x7F, 0xCF, 0xF0, 0x1F, 0xEF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xDF, 0xF0, 0x7F, 0xCF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xE0, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
+  0xF0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFE,
+  0x1F, 0xF1, 0xFE, 0x07, 0xF9, 0xFE, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0x7F,
+  0x80, 0x7F, 0xBF, 0xC0, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xF8, 0x07, 0xFD, 0xFE, 0x07, 0xFE, 0xFF, 0x87, 0xFF, 0x7F, 0xFF, 0xFF,
+  0x9F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE0, 0xFF, 0xEF, 0xF0, 0x1F, 0xC7,
+  0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x01,
+  0xFE, 0x10, 0x01, 0xFF, 0x0F, 0x03, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+  0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
+  0x3F, 0xCF, 0xF3, 0xFC, 0xFE, 0x7F, 0x1F, 0xC7, 0xE1, 0xF0, 0xF8, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF,
+  0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
+  0x80, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0,
+  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF,
+  0xC0, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+  0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xEF, 0xFF, 0xFD, 0xF0, 0x7F,
+  0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xFF,
+  0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xE0,
+  0x07, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00,
+  0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x03,
+  0xF8, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00,
+  0xF8, 0x1F, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0F, 0x0F, 0x80,
+  0x7C, 0xF8, 0x7C, 0xF8, 0x0F, 0xF7, 0xC1, 0xE7, 0x80, 0xFF, 0xFE, 0x0F,
+  0x3C, 0x0F, 0xFF, 0xF0, 0x3F, 0xE0, 0x7E, 0x3F, 0x81, 0xFE, 0x03, 0xE0,
+  0xFC, 0x0F, 0xF0, 0x3E, 0x03, 0xE0, 0x7F, 0x81, 0xF0, 0x1F, 0x03, 0xFC,
+  0x0F, 0x80, 0xF8, 0x1F, 0xE0, 0x7C, 0x07, 0xC0, 0xFF, 0x03, 0xE0, 0x3E,
+  0x0F, 0xF8, 0x1F, 0x01, 0xF0, 0x7B, 0xC0, 0xF8, 0x0F, 0x87, 0xDF, 0x03,
+  0xE0, 0xFC, 0x7C, 0x78, 0x1F, 0x8F, 0xE7, 0xE3, 0xC0, 0xFF, 0xFF, 0xFE,
+  0x1F, 0x03, 0xFF, 0xFF, 0xE0, 0x78, 0x0F, 0xF7, 0xFC, 0x03, 0xE0, 0x1F,
+  0x3F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x01,
+  0xF8, 0x00, 0x03, 0x00, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0xF0, 0x1F,
+  0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0,
+  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC,
+  0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x7F, 0xBF,
+  0xC0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x1F, 0xE3,
+  0xFC, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x07, 0xF0,
+  0x1F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFC,
+  0x01, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xE0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x8F,
+  0xF0, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x07, 0xFB,
+  0xFC, 0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFF, 0xE3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xC0, 0x7F, 0xEF,
+  0xF0, 0x0F, 0xFB, 0xFC, 0x01, 0xFE, 0xFF, 0x00, 0x7F, 0xBF, 0xC0, 0x1F,
+  0xEF, 0xF0, 0x07, 0xFB, 0xFC, 0x03, 0xFE, 0xFF, 0x01, 0xFF, 0x3F, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x3F,
+  0xFF, 0xFF, 0xCF, 0xF0, 0x0F, 0xFB, 0xFC, 0x01, 0xFE, 0xFF, 0x00, 0x3F,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
+  0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0x00, 0xF9, 0xFF, 0x80, 0x07,
+  0x3F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+  0xF0, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x3F, 0xF0, 0x00, 0xE3, 0xFF, 0x80,
+  0x7C, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x03,
+  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x80,
+  0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x8F, 0xF0, 0x1F, 0xFE, 0x3F,
+  0xC0, 0x0F, 0xFC, 0xFF, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0,
+  0x00, 0x7F, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03,
+  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF,
+  0xFF, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0, 0x01, 0xFF, 0xBF,
+  0xC0, 0x0F, 0xFC, 0xFF, 0x01, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xE0, 0x1F,
+  0x8F, 0xFC, 0x00, 0x0E, 0x3F, 0xE0, 0x00, 0x09, 0xFF, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xFF, 0x80, 0x03, 0xFD, 0xFE, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x3F,
+  0xCF, 0xF8, 0x00, 0xFF, 0x3F, 0xF0, 0x03, 0xFC, 0x7F, 0xF0, 0x0F, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x07,
+  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0,
+  0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
+  0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC1, 0xFF, 0x07, 0xFC, 0x3F, 0xEF, 0xFF, 0xBF, 0xFC, 0xFF, 0xF3, 0xFF,
+  0x0F, 0xF8, 0x3F, 0x00, 0xFF, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x7F, 0xC3,
+  0xFC, 0x01, 0xFF, 0x07, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x1F, 0xF0, 0x1F,
+  0xE0, 0x7F, 0xC0, 0x3F, 0xC1, 0xFF, 0x00, 0x7F, 0x87, 0xFC, 0x00, 0xFF,
+  0x1F, 0xF0, 0x01, 0xFE, 0x7F, 0xC0, 0x03, 0xFD, 0xFF, 0x00, 0x07, 0xFF,
+  0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
+  0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x0F, 0xF3, 0xFF,
+  0x00, 0x1F, 0xE3, 0xFF, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x83, 0xFF,
+  0x00, 0xFF, 0x03, 0xFF, 0x01, 0xFE, 0x03, 0xFF, 0x03, 0xFC, 0x03, 0xFF,
+  0x07, 0xF8, 0x03, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0x1F, 0xE0, 0x03, 0xFF,
+  0x3F, 0xC0, 0x03, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+  0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xEF,
+  0xC1, 0xFF, 0xFF, 0xFD, 0xF8, 0x3F, 0x7F, 0xFF, 0xBF, 0x07, 0xEF, 0xFF,
+  0xF3, 0xF1, 0xF9, 0xFF, 0xFE, 0x7E, 0x3F, 0x3F, 0xFF, 0xC7, 0xEF, 0xC7,
+  0xFF, 0xF8, 0xFD, 0xF8, 0xFF, 0xFF, 0x1F, 0xBF, 0x1F, 0xFF, 0xE1, 0xFF,
+  0xC3, 0xFF, 0xFC, 0x3F, 0xF8, 0x7F, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xF0,
+  0x7F, 0xC1, 0xFF, 0xFE, 0x07, 0xF0, 0x3F, 0xFF, 0xC0, 0xFE, 0x07, 0xFF,
+  0xF8, 0x1F, 0xC0, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x03,
+  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+  0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xF7, 0xE0, 0xFF, 0xFF, 0x7F, 0x0F, 0xFF, 0xF3, 0xF0, 0xFF,
+  0xFF, 0x3F, 0x8F, 0xFF, 0xF1, 0xF8, 0xFF, 0xFF, 0x1F, 0xCF, 0xFF, 0xF0,
+  0xFC, 0xFF, 0xFF, 0x0F, 0xEF, 0xFF, 0xF0, 0x7E, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xF0,
+  0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
+  0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8,
+  0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE,
+  0x7F, 0x80, 0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+  0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
+  0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x3F,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xFF, 0xEF, 0xF0, 0x0F, 0xFB, 0xFC, 0x01, 0xFF, 0xFF, 0x00,
+  0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0x80, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+  0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03,
+  0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80, 0x01,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01,
+  0xFF, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xC0, 0x03,
+  0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0x0F,
+  0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F,
+  0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x7F, 0xC0, 0xFF, 0x03, 0xFE, 0x0F, 0xF0,
+  0x1F, 0xE0, 0xFF, 0x01, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF,
+  0x8F, 0xF0, 0x07, 0xF8, 0xFF, 0x00, 0x7F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF,
+  0x00, 0x3F, 0xEF, 0xF0, 0x01, 0xFE, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF,
+  0xC0, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF,
+  0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0xF9, 0xFE, 0x00, 0x04, 0xFF,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+  0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
+  0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x07,
+  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+  0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03,
+  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
+  0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0,
+  0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xFB, 0xFC, 0x01, 0xFE,
+  0x7F, 0xE0, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
+  0xFF, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xE0, 0x00, 0x3F,
+  0xCF, 0xF0, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x0F,
+  0xF0, 0xFF, 0x80, 0x0F, 0xF8, 0x3F, 0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x03,
+  0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x01, 0xFE, 0x01, 0xFE, 0x00,
+  0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xE0,
+  0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0xFF,
+  0x1F, 0xE0, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x0F,
+  0xF7, 0xF8, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xE0,
+  0x07, 0xFF, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xDF, 0xC0, 0x0F, 0xF8, 0x01,
+  0xFC, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xE7, 0xF8, 0x03, 0xFF, 0x00, 0xFF,
+  0x3F, 0xC0, 0x3F, 0xF8, 0x07, 0xF8, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0x87,
+  0xF8, 0x0F, 0xBE, 0x03, 0xFC, 0x3F, 0xC0, 0x7D, 0xF0, 0x1F, 0xE1, 0xFE,
+  0x07, 0xEF, 0xC0, 0xFF, 0x07, 0xF0, 0x3F, 0x7E, 0x07, 0xF0, 0x3F, 0xC1,
+  0xFB, 0xF0, 0x7F, 0x81, 0xFE, 0x0F, 0x8F, 0x83, 0xFC, 0x0F, 0xF0, 0xFC,
+  0x7E, 0x1F, 0xE0, 0x7F, 0x87, 0xE3, 0xF0, 0xFF, 0x01, 0xFE, 0x3F, 0x1F,
+  0x87, 0xF0, 0x0F, 0xF1, 0xF0, 0x7C, 0x7F, 0x80, 0x7F, 0x9F, 0x83, 0xF3,
+  0xFC, 0x03, 0xFC, 0xFC, 0x1F, 0x9F, 0xE0, 0x0F, 0xE7, 0xE0, 0xFC, 0xFE,
+  0x00, 0x7F, 0xBE, 0x03, 0xEF, 0xF0, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80,
+  0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x03,
+  0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF,
+  0xF0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00,
+  0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xF8, 0xFF,
+  0x00, 0x1F, 0xE1, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x01, 0xFF, 0x01, 0xFE,
+  0x03, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x03, 0xFE, 0x3F, 0xE0, 0x03, 0xFC,
+  0xFF, 0x80, 0x03, 0xFD, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+  0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xEF, 0xF0,
+  0x00, 0x7F, 0xDF, 0xF0, 0x00, 0xFF, 0x1F, 0xE0, 0x03, 0xFC, 0x1F, 0xE0,
+  0x0F, 0xF8, 0x3F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xC1,
+  0xFF, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x7F, 0xBF,
+  0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xC0, 0x03, 0xFE,
+  0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xF8,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0,
+  0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x01, 0xFF, 0xFF, 0x80,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC,
+  0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x81,
+  0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F,
+  0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0x00, 0xF8, 0x00, 0x7C,
+  0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E,
+  0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x07,
+  0x80, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x01,
+  0xE0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+  0x3E, 0x00, 0x1F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x07,
+  0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFE,
+  0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0,
+  0xFE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x07,
+  0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0x00,
+  0x07, 0xFF, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7F, 0x07, 0xF0, 0x1F, 0xC0,
+  0x7F, 0x07, 0xE0, 0x03, 0xF1, 0xF8, 0x00, 0x3F, 0x7E, 0x00, 0x03, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x07,
+  0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xFE, 0x3C, 0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x07,
+  0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+  0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xC0, 0x7F, 0x9F, 0xF8, 0x3F, 0xDF, 0xFE,
+  0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE7, 0xFF, 0x1F, 0xFB, 0xFE, 0x03,
+  0xFD, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0,
+  0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xBF,
+  0xE0, 0x3F, 0xDF, 0xFC, 0x7F, 0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE3,
+  0xFF, 0xFF, 0xE1, 0xFE, 0x7F, 0xE0, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x7F,
+  0xE0, 0x1F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F,
+  0xF8, 0x1D, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xF8, 0x00,
+  0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC,
+  0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x02,
+  0x7F, 0xE0, 0x73, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x7F,
+  0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00,
+  0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0xF8, 0x7F, 0x83, 0xFF, 0x3F, 0xC3,
+  0xFF, 0xDF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0x1F, 0xFD,
+  0xFE, 0x03, 0xFE, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xBF, 0xC0,
+  0x7F, 0xDF, 0xE0, 0x3F, 0xEF, 0xFC, 0x7F, 0xF3, 0xFF, 0xFF, 0xF8, 0xFF,
+  0xFF, 0xFC, 0x3F, 0xFD, 0xFE, 0x0F, 0xFC, 0xFF, 0x01, 0xF8, 0x7F, 0x80,
+  0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+  0x83, 0xFF, 0xFF, 0xE1, 0xFF, 0x0F, 0xF9, 0xFE, 0x03, 0xFC, 0xFF, 0x00,
+  0xFE, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x9F, 0xF0, 0x01, 0xC7,
+  0xFC, 0x07, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
+  0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xFC,
+  0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFE, 0x1F, 0xF0, 0x03, 0xFC, 0x00,
+  0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF,
+  0xFF, 0xFD, 0xFF, 0xFF, 0x83, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03,
+  0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
+  0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F,
+  0xF0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x3F, 0xC3, 0xFF, 0xDF, 0xE3,
+  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0x1F, 0xFD, 0xFE, 0x07, 0xFE,
+  0xFF, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0xC0, 0x7F, 0xDF, 0xE0,
+  0x7F, 0xEF, 0xFC, 0x7F, 0xF3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F,
+  0xFD, 0xFE, 0x0F, 0xFC, 0xFF, 0x01, 0xF8, 0x7F, 0x80, 0x00, 0x3F, 0xC0,
+  0x00, 0x3F, 0xC2, 0x00, 0x3F, 0xE1, 0xE0, 0x3F, 0xF0, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x07, 0xE0, 0xFF, 0x1F, 0xF8, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xE3, 0xFF, 0xFF, 0xC1,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83,
+  0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x1F, 0xF0,
+  0xFF, 0x7F, 0xFB, 0xFF, 0x9F, 0xFC, 0xFF, 0x87, 0xF0, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xCF, 0xF0, 0x1F, 0xE3, 0xFC, 0x0F,
+  0xF0, 0xFF, 0x07, 0xF8, 0x3F, 0xC3, 0xFC, 0x0F, 0xF1, 0xFE, 0x03, 0xFC,
+  0xFF, 0x00, 0xFF, 0x7F, 0x80, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x03,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFE, 0x00, 0xFF, 0x7F, 0xC0, 0x3F, 0xCF, 0xF8, 0x0F, 0xF1,
+  0xFF, 0x03, 0xFC, 0x3F, 0xE0, 0xFF, 0x07, 0xFC, 0x3F, 0xC0, 0xFF, 0x8F,
+  0xF0, 0x1F, 0xF3, 0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x1F, 0x83,
+  0xFC, 0xFF, 0xC1, 0xFF, 0x8F, 0xF7, 0xFF, 0x8F, 0xFF, 0x3F, 0xFF, 0xFF,
+  0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+  0xFC, 0x3F, 0xF8, 0x7F, 0xFF, 0xE0, 0x7F, 0xC0, 0xFF, 0xFF, 0x81, 0xFF,
+  0x03, 0xFF, 0xFC, 0x07, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xE0, 0x3F, 0xFF,
+  0xC0, 0x7F, 0x80, 0xFF, 0xFF, 0x01, 0xFE, 0x03, 0xFF, 0xFC, 0x07, 0xF8,
+  0x0F, 0xFF, 0xF0, 0x1F, 0xE0, 0x3F, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0xFF,
+  0x01, 0xFE, 0x03, 0xFF, 0xFC, 0x07, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xE0,
+  0x3F, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0xFF, 0x01, 0xFE, 0x03, 0xFF, 0xFC,
+  0x07, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xE0, 0x3F, 0xFF, 0xC0, 0x7F, 0x80,
+  0xFF, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0xFF, 0x1F, 0xF8,
+  0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xE3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x80,
+  0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFF, 0x0F, 0xF8, 0x7F, 0xC7, 0xFC, 0x0F, 0xF9, 0xFE, 0x01, 0xFE, 0xFF,
+  0x80, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
+  0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
+  0xFF, 0xFF, 0x80, 0x7F, 0xDF, 0xE0, 0x1F, 0xE7, 0xFC, 0x0F, 0xF8, 0xFF,
+  0x87, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x9F,
+  0xF8, 0x3F, 0xDF, 0xFE, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE7, 0xFF,
+  0x1F, 0xFB, 0xFE, 0x03, 0xFD, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF,
+  0xF8, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0xC0, 0x7F, 0xBF, 0xE0, 0x3F, 0xDF, 0xFC, 0x7F, 0xEF, 0xFF, 0xFF,
+  0xE7, 0xFF, 0xFF, 0xE3, 0xFD, 0xFF, 0xE1, 0xFE, 0x7F, 0xE0, 0xFF, 0x0F,
+  0xC0, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x3F,
+  0xC3, 0xFF, 0xDF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0x1F,
+  0xFD, 0xFE, 0x03, 0xFE, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xBF,
+  0xC0, 0x7F, 0xDF, 0xE0, 0x3F, 0xEF, 0xFC, 0x7F, 0xF3, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFC, 0x3F, 0xFD, 0xFE, 0x0F, 0xFC, 0xFF, 0x01, 0xF8, 0x7F,
+  0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07,
+  0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x9F, 0xFF, 0xDF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80,
+  0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC,
+  0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F,
+  0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07,
+  0xFF, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE,
+  0x7F, 0x80, 0xF3, 0xF8, 0x00, 0x9F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9F,
+  0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFE, 0x07, 0xFF,
+  0xE0, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+  0xC7, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F,
+  0xFE, 0xFF, 0x1F, 0xF8, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x00, 0x1F, 0xEF,
+  0xE0, 0x03, 0xF9, 0xFC, 0x00, 0xFF, 0x3F, 0xC0, 0x1F, 0xE3, 0xF8, 0x03,
+  0xF8, 0x7F, 0x80, 0xFF, 0x07, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x1F,
+  0xE0, 0xFF, 0x01, 0xFC, 0x1F, 0xC0, 0x3F, 0x83, 0xF8, 0x07, 0xF8, 0xFF,
+  0x00, 0x7F, 0x1F, 0xC0, 0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0xFE, 0x00, 0x1F,
+  0xDF, 0xC0, 0x03, 0xFB, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0,
+  0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xF8, 0x0F,
+  0xE0, 0x3F, 0xDF, 0xC0, 0x7F, 0x01, 0xFC, 0xFE, 0x07, 0xFC, 0x0F, 0xE7,
+  0xF0, 0x3F, 0xE0, 0x7F, 0x3F, 0xC1, 0xFF, 0x07, 0xF8, 0xFE, 0x0F, 0xF8,
+  0x3F, 0x87, 0xF0, 0x7F, 0xC1, 0xFC, 0x3F, 0x87, 0xDF, 0x0F, 0xE1, 0xFE,
+  0x3E, 0xF8, 0xFF, 0x07, 0xF1, 0xF7, 0xC7, 0xF0, 0x3F, 0x8F, 0xBE, 0x3F,
+  0x81, 0xFC, 0xF8, 0xF9, 0xFC, 0x07, 0xF7, 0xC7, 0xDF, 0xE0, 0x3F, 0xBE,
+  0x3E, 0xFE, 0x01, 0xFD, 0xF1, 0xF7, 0xF0, 0x0F, 0xFF, 0x07, 0xFF, 0x80,
+  0x3F, 0xF8, 0x3F, 0xF8, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFE, 0x0F,
+  0xFE, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x0F,
+  0xF8, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0xFF, 0x00, 0x3F, 0xDF,
+  0xE0, 0x1F, 0xE3, 0xFC, 0x0F, 0xF0, 0x7F, 0x07, 0xF8, 0x1F, 0xE1, 0xFE,
+  0x03, 0xFC, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x03, 0xFF,
+  0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF8, 0x01, 0xFC, 0xFE, 0x00, 0xFF, 0x3F, 0xC0, 0x7F, 0x87,
+  0xF8, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xF8, 0x07, 0xFB, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xEF, 0xE0, 0x03, 0xF9, 0xFE, 0x00, 0x7F,
+  0x3F, 0xC0, 0x1F, 0xE3, 0xF8, 0x03, 0xF8, 0x7F, 0x80, 0x7F, 0x07, 0xF0,
+  0x1F, 0xE0, 0xFF, 0x03, 0xF8, 0x0F, 0xE0, 0x7F, 0x01, 0xFC, 0x1F, 0xC0,
+  0x3F, 0xC3, 0xF8, 0x03, 0xF8, 0x7F, 0x00, 0x7F, 0x9F, 0xC0, 0x07, 0xF3,
+  0xF8, 0x00, 0xFE, 0x7E, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F,
+  0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x07,
+  0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
+  0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF0,
+  0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xE0,
+  0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
+  0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
+  0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0xFF,
+  0xC0, 0x0F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00,
+  0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
+  0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFE,
+  0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x0F,
+  0xFF, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0x80,
+  0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
+  0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
+  0xE0, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x01,
+  0xFF, 0xF0, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
+  0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
+  0x03, 0xF8, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x0F, 0xFF, 0x80, 0xFF, 0xF0,
+  0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x23,
+  0xFF, 0x80, 0x1D, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x7F, 0xFF, 0xB8, 0x01, 0xFF, 0xC4, 0x00, 0x07, 0xE0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x01, 0xFF, 0x80, 0x7F,
+  0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x7F, 0xF8, 0xF7,
+  0xFD, 0xC0, 0xBF, 0xCE, 0x03, 0xFE, 0x70, 0x1F, 0xE3, 0x80, 0xFF, 0x1C,
+  0x07, 0xF8, 0xE0, 0x3F, 0xC7, 0x01, 0xFE, 0x38, 0x0F, 0xF1, 0xC0, 0x7F,
+  0x8E, 0x01, 0xFE, 0x70, 0x0F, 0xF3, 0x80, 0x7F, 0xDC, 0x09, 0xFF, 0xE1,
+  0xCF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0x81, 0xFF, 0xFC, 0x01,
+  0xFF, 0x80, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+  0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03,
+  0xFE, 0x07, 0x03, 0xFC, 0x01, 0x07, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x07, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x0C, 0x38,
+  0x00, 0x1E, 0x78, 0x00, 0x3E, 0xFC, 0x7E, 0x3F, 0x7F, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0x00, 0xF0, 0x1F,
+  0x00, 0xF8, 0x1E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1E,
+  0x00, 0x78, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0xF0, 0x0F, 0xC3, 0xF0, 0x0F,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFC, 0xFF, 0x3F, 0x7C,
+  0x00, 0x3E, 0x78, 0x00, 0x1C, 0x10, 0x00, 0x08, 0xFF, 0x00, 0x0F, 0xF7,
+  0xF8, 0x01, 0xFE, 0x7F, 0xC0, 0x3F, 0xE3, 0xFC, 0x03, 0xFC, 0x1F, 0xE0,
+  0x7F, 0x81, 0xFF, 0x0F, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x9F, 0xF0,
+  0x07, 0xF9, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFE, 0x00,
+  0x3F, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFC, 0x3C, 0x1F, 0xC0,
+  0x20, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
+  0xFF, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0xF1, 0xFC, 0xFF,
+  0xDF, 0xC1, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xFC,
+  0x03, 0xFF, 0xF0, 0x3F, 0xBF, 0xE3, 0xF8, 0xFF, 0xFF, 0xC3, 0xFF, 0xF8,
+  0x0F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x01,
+  0xFE, 0x00, 0x07, 0xF0, 0x80, 0x3F, 0x87, 0x83, 0xFC, 0x3F, 0xFF, 0xC1,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0xFF, 0xC7, 0xFE,
+  0x3F, 0xF1, 0xFF, 0x8F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x7C, 0x00, 0x7C,
+  0x01, 0xE0, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x1E, 0x03, 0xFC, 0x3C,
+  0x38, 0x1F, 0xFC, 0x38, 0xF0, 0xFF, 0xF8, 0x79, 0xC1, 0xFF, 0xF0, 0x77,
+  0x87, 0xE0, 0xE0, 0xEE, 0x1F, 0x00, 0x40, 0xFC, 0x3C, 0x00, 0x01, 0xF8,
+  0x78, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x07, 0xE1, 0xE0, 0x00, 0x0F, 0xC3,
+  0xC0, 0x00, 0x1F, 0x87, 0xC0, 0x00, 0x3F, 0x87, 0xE0, 0x20, 0xE7, 0x07,
+  0xFF, 0xC1, 0xCE, 0x0F, 0xFF, 0x87, 0x8E, 0x07, 0xFF, 0x0E, 0x1E, 0x03,
+  0xF8, 0x3C, 0x1E, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x03, 0xC0, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x87, 0xFF,
+  0xF1, 0xFF, 0xFE, 0x60, 0x1F, 0xC0, 0x03, 0xF0, 0x7F, 0xFC, 0xFF, 0xFF,
+  0x7F, 0xFF, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xFC, 0x3F, 0xFF,
+  0xFF, 0xF7, 0xFF, 0x7C, 0xFF, 0x9F, 0x1F, 0x87, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x40, 0x10, 0x0C, 0x03, 0x01, 0xC0, 0x70, 0x7C, 0x1F, 0x0F, 0xC3,
+  0xF1, 0xF8, 0x7E, 0x7F, 0x1F, 0xCF, 0xE3, 0xF8, 0xF8, 0x3E, 0x0F, 0x03,
+  0xC0, 0xF8, 0x3E, 0x0F, 0xE3, 0xF8, 0x7F, 0x1F, 0xC1, 0xF8, 0x7E, 0x0F,
+  0xC3, 0xF0, 0x7C, 0x1F, 0x01, 0xC0, 0x70, 0x0C, 0x03, 0x00, 0x40, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
+  0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x7C, 0x00,
+  0x7C, 0x01, 0xE0, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x1E, 0x3F, 0xF0,
+  0x3C, 0x38, 0x7F, 0xF8, 0x38, 0xF0, 0xFF, 0xF0, 0x79, 0xC1, 0xE1, 0xF0,
+  0x77, 0x83, 0xC1, 0xE0, 0xEE, 0x07, 0x83, 0xC0, 0xFC, 0x0F, 0x0F, 0x81,
+  0xF8, 0x1F, 0xFE, 0x03, 0xF0, 0x3F, 0xF8, 0x07, 0xE0, 0x7F, 0xE0, 0x0F,
+  0xC0, 0xF3, 0xE0, 0x1F, 0x81, 0xE3, 0xC0, 0x3F, 0x83, 0xC7, 0xC0, 0xE7,
+  0x07, 0x87, 0x81, 0xCE, 0x0F, 0x0F, 0x87, 0x8E, 0x1E, 0x0F, 0x0E, 0x1E,
+  0x3C, 0x0F, 0x3C, 0x1E, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x03, 0xC0, 0x1F,
+  0x00, 0x1F, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xC0, 0x7F, 0x83, 0xFF, 0x1E, 0x1E, 0xF0, 0x3F, 0x80,
+  0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7, 0x87, 0x8F, 0xFC, 0x1F,
+  0xE0, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x07, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF0, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
+  0xC3, 0xFF, 0xCF, 0xFF, 0xB8, 0x3F, 0x80, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
+  0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0F,
+  0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0xFF, 0xF9, 0xFF,
+  0xF3, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x0F, 0xFC, 0x1F, 0xF0,
+  0x3F, 0xF8, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xF0, 0x07, 0xF8, 0x3F, 0xFF,
+  0xFE, 0xFF, 0xF8, 0x7F, 0xC0, 0x03, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x1F,
+  0x03, 0xE0, 0x7C, 0x0F, 0x80, 0xFF, 0x00, 0xFF, 0x1F, 0xE0, 0x1F, 0xE3,
+  0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x7F, 0x8F, 0xF0, 0x0F, 0xF1, 0xFE, 0x01,
+  0xFE, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x07, 0xF8, 0xFF, 0x00, 0xFF, 0x1F,
+  0xE0, 0x1F, 0xE3, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x7F, 0x8F, 0xF0, 0x0F,
+  0xF1, 0xFE, 0x01, 0xFE, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x07, 0xF8, 0xFF,
+  0x81, 0xFF, 0x1F, 0xF8, 0x7F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xF9,
+  0xF0, 0x7E, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
+  0x7F, 0xFF, 0xC7, 0xFF, 0xFE, 0x7F, 0xF0, 0xF7, 0xFF, 0x87, 0xBF, 0xFC,
+  0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xF0, 0xF7, 0xFF, 0x87, 0xBF, 0xFC, 0x3C, 0xFF, 0xE1,
+  0xE3, 0xFF, 0x0F, 0x0F, 0xF8, 0x78, 0x0F, 0xC3, 0xC0, 0x1E, 0x1E, 0x00,
+  0xF0, 0xF0, 0x07, 0x87, 0x80, 0x3C, 0x3C, 0x01, 0xE1, 0xE0, 0x0F, 0x0F,
+  0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x1E, 0x00, 0xF0, 0xF0, 0x07,
+  0x87, 0x80, 0x3C, 0x3C, 0x01, 0xE1, 0xE0, 0x0F, 0x0F, 0x00, 0x78, 0x78,
+  0x03, 0xC3, 0xC0, 0x1E, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x06, 0x03, 0x80, 0xE0, 0x78, 0x7F, 0xFF, 0xFC, 0xFC, 0x1F, 0xC3,
+  0xFF, 0x0F, 0xFC, 0x39, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+  0x1F, 0xFF, 0x7F, 0xFD, 0xFF, 0xF0, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0xFF,
+  0xFE, 0x3F, 0xFF, 0xE7, 0xF1, 0xFD, 0xFC, 0x1F, 0xFF, 0x01, 0xFF, 0xE0,
+  0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFF, 0x07, 0xF7, 0xF1,
+  0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0xF0, 0x03, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0x9F, 0xFF,
+  0xF3, 0xFF, 0xFE, 0x80, 0x20, 0x0C, 0x03, 0x00, 0xE0, 0x38, 0x0F, 0x83,
+  0xE0, 0xFC, 0x3F, 0x07, 0xE1, 0xF8, 0x3F, 0x8F, 0xE1, 0xFC, 0x7F, 0x07,
+  0xC1, 0xF0, 0x3C, 0x0F, 0x07, 0xC1, 0xF1, 0xFC, 0x7F, 0x3F, 0x8F, 0xE7,
+  0xE1, 0xF8, 0xFC, 0x3F, 0x0F, 0x83, 0xE0, 0xE0, 0x38, 0x0C, 0x03, 0x00,
+  0x80, 0x20, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x01, 0xFF, 0x80, 0x00, 0x7C,
+  0x03, 0xFF, 0x00, 0x00, 0xF8, 0x07, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x7C,
+  0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x7C,
+  0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x0F,
+  0x80, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x7C,
+  0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x01,
+  0xF0, 0x07, 0x80, 0x7C, 0x3F, 0xFE, 0x1F, 0x01, 0xF8, 0x7F, 0xFC, 0x7C,
+  0x07, 0xF0, 0xFF, 0xF8, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x3F, 0xC0,
+  0x00, 0x07, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0x01, 0xDF, 0x00, 0x00, 0x7C,
+  0x07, 0x3E, 0x00, 0x00, 0xF0, 0x1C, 0x7C, 0x00, 0x03, 0xE0, 0x78, 0xF8,
+  0x00, 0x07, 0x80, 0xE1, 0xF0, 0x00, 0x1F, 0x03, 0xFF, 0xFC, 0x00, 0x7C,
+  0x07, 0xFF, 0xF8, 0x00, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xE0, 0x1F, 0xFF,
+  0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x7C,
+  0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xC0, 0x00, 0x3E,
+  0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0xE7, 0xC0, 0x00, 0x7C, 0x00, 0x07,
+  0xC0, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x01,
+  0xF0, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00,
+  0x07, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x07, 0xC0,
+  0x0F, 0x80, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00,
+  0x00, 0x07, 0xC0, 0x1E, 0x0F, 0xF0, 0x7F, 0xFC, 0x3E, 0x3F, 0xFC, 0x7F,
+  0xFC, 0x7C, 0x3F, 0xFE, 0x7F, 0xFC, 0x78, 0x38, 0x3F, 0x00, 0x00, 0xF8,
+  0x20, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F,
+  0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x00, 0x7E, 0x00, 0x07,
+  0xC0, 0x00, 0xFC, 0x00, 0x07, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03,
+  0xF0, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x00,
+  0x3E, 0x00, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0x00, 0x7C, 0x00,
+  0x3F, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0x3F, 0xF0, 0x00, 0x1F, 0x00,
+  0xFF, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0xF0, 0x00, 0xF8, 0x03, 0x03, 0xF0,
+  0x03, 0xE0, 0x00, 0x03, 0xE0, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x1F, 0x00,
+  0x00, 0x1F, 0x00, 0x7C, 0x00, 0x0F, 0xFC, 0x00, 0xF0, 0x00, 0x1F, 0xF0,
+  0x03, 0xE0, 0x00, 0x3F, 0xF8, 0x07, 0x80, 0x00, 0x03, 0xF0, 0x1F, 0x00,
+  0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x10, 0x07,
+  0xC3, 0xE0, 0x00, 0x38, 0x3F, 0x87, 0x80, 0x7C, 0x7F, 0xFE, 0x1F, 0x01,
+  0xF8, 0xFF, 0xF8, 0x7C, 0x07, 0xF0, 0x7F, 0xC0, 0xF0, 0x0F, 0xE0, 0x00,
+  0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x07, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0x01,
+  0xDF, 0x00, 0x00, 0x7C, 0x07, 0x3E, 0x00, 0x00, 0xF0, 0x1C, 0x7C, 0x00,
+  0x03, 0xE0, 0x78, 0xF8, 0x00, 0x07, 0x80, 0xE1, 0xF0, 0x00, 0x1F, 0x03,
+  0xFF, 0xFC, 0x00, 0x7C, 0x07, 0xFF, 0xF8, 0x00, 0xF0, 0x0F, 0xFF, 0xF0,
+  0x03, 0xE0, 0x1F, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+  0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xFC, 0x03,
+  0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
+  0xE0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x01, 0xFF,
+  0xE1, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0x7F, 0xFF, 0x03,
+  0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+  0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x1F, 0xEF, 0xF0,
+  0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x07, 0xF8, 0xFF,
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xFC, 0x1F, 0xE0, 0x01, 0xFC, 0x07,
+  0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x00,
+  0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x1F, 0xE3, 0xFC,
+  0x00, 0x07, 0xF9, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x01, 0xFE, 0xFF,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
+  0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
+  0xFF, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x1F,
+  0xEF, 0xF0, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x07,
+  0xF8, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xFC, 0x1F, 0xE0, 0x01,
+  0xFC, 0x07, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x00,
+  0x7F, 0x00, 0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x1F,
+  0xE3, 0xFC, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x01,
+  0xFE, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x03,
+  0xC1, 0xE0, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+  0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xDF, 0xE0,
+  0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x0F, 0xF1, 0xFE,
+  0x00, 0x07, 0xF8, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xFC, 0x1F,
+  0xE0, 0x01, 0xFC, 0x07, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x01,
+  0xFE, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x3F, 0xC3, 0xFC,
+  0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x03, 0xFC, 0xFF,
+  0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0x07, 0x00,
+  0x00, 0x1F, 0xE3, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0E, 0x3F, 0xC0,
+  0x00, 0x07, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+  0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x3F,
+  0xDF, 0xE0, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F,
+  0xF1, 0xFE, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x03,
+  0xF8, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x03, 0xFC, 0x00,
+  0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC,
+  0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x3F,
+  0xC7, 0xF8, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x03,
+  0xFD, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x1F,
+  0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x03, 0xE3,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01,
+  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+  0x7F, 0x7F, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00,
+  0x1F, 0xC7, 0xF0, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xF1, 0xFE, 0x00,
+  0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x03, 0xF8, 0x0F, 0xE0,
+  0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0xFE,
+  0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+  0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
+  0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x3F, 0xC7, 0xF8, 0x00,
+  0x0F, 0xF3, 0xFC, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x03, 0xFD, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
+  0xFF, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0x01,
+  0xC0, 0x70, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00,
+  0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+  0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x7F, 0x80,
+  0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x3F, 0xC7, 0xF8,
+  0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x0F, 0xF0, 0x7F,
+  0x80, 0x07, 0xF0, 0x1F, 0xC0, 0x07, 0xF8, 0x0F, 0xE0, 0x03, 0xFC, 0x07,
+  0xF8, 0x01, 0xFC, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0,
+  0x00, 0x7F, 0x87, 0xF0, 0x00, 0x1F, 0xC7, 0xF8, 0x00, 0x0F, 0xF3, 0xFC,
+  0x00, 0x07, 0xF9, 0xFC, 0x00, 0x01, 0xFD, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xE3, 0xFC,
+  0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
+  0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00,
+  0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xF0, 0x3F, 0xFF, 0xFE, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xE0,
+  0x3F, 0xFF, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F,
+  0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
+  0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x7F, 0x80, 0x03,
+  0xFF, 0xFF, 0xF7, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
+  0x81, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF,
+  0x00, 0xF9, 0xFF, 0x80, 0x07, 0x3F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+  0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x3F,
+  0xF0, 0x00, 0xE3, 0xFF, 0x80, 0x7C, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+  0xF0, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00,
+  0x7F, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x87, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF,
+  0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xBF, 0xFF, 0xFE, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0, 0x03,
+  0xE7, 0xC0, 0x1F, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x8F, 0x80, 0x3E,
+  0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xE0, 0x0F, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
+  0xE0, 0x3F, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0,
+  0x0F, 0xC7, 0xE3, 0xF0, 0xF8, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
+  0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
+  0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF,
+  0xF3, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3E, 0x7C,
+  0x7C, 0x3E, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
+  0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
+  0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
+  0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
+  0xC3, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xC0, 0x0F, 0xFC,
+  0x0F, 0xF0, 0x01, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x00, 0x07,
+  0xF8, 0x3F, 0xC0, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0, 0xFF, 0x00, 0x03, 0xFC, 0x3F,
+  0xC0, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x3F, 0xE0,
+  0xFF, 0x00, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF0, 0x1F, 0xFE,
+  0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0xF8, 0x38, 0x00, 0x1F, 0xE3, 0x80, 0x03, 0xFF, 0xF8,
+  0x00, 0x38, 0xFF, 0x00, 0x03, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xFF, 0x7E, 0x0F, 0xFF, 0xF7, 0xF0, 0xFF, 0xFF, 0x3F, 0x0F, 0xFF, 0xF3,
+  0xF8, 0xFF, 0xFF, 0x1F, 0x8F, 0xFF, 0xF1, 0xFC, 0xFF, 0xFF, 0x0F, 0xCF,
+  0xFF, 0xF0, 0xFE, 0xFF, 0xFF, 0x07, 0xEF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x7E,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8,
+  0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80,
+  0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0x80,
+  0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0,
+  0x07, 0xFC, 0x3F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0,
+  0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0x80,
+  0x01, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80,
+  0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF8,
+  0x1F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0xF0,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0,
+  0x03, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xC0,
+  0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFF,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3E,
+  0x07, 0x00, 0x00, 0x7F, 0x8F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF1,
+  0xFE, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0,
+  0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0x80,
+  0x01, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80,
+  0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF8,
+  0x1F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E,
+  0x7C, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8,
+  0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80,
+  0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0x80,
+  0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0,
+  0x07, 0xFC, 0x3F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x10, 0x00, 0x04, 0x1C, 0x00, 0x07,
+  0x1F, 0x00, 0x07, 0xDF, 0xC0, 0x07, 0xF7, 0xF0, 0x07, 0xF1, 0xFC, 0x07,
+  0xF0, 0x7F, 0x07, 0xF0, 0x1F, 0xC7, 0xF0, 0x07, 0xF7, 0xF0, 0x01, 0xFF,
+  0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07,
+  0xFC, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x07,
+  0xF1, 0xFC, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x1F, 0xC7, 0xF0, 0x07, 0xF7,
+  0xF0, 0x01, 0xFD, 0xF0, 0x00, 0x7C, 0x70, 0x00, 0x1C, 0x10, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x00, 0xE0, 0x07, 0xFF,
+  0xF8, 0x7C, 0x07, 0xFF, 0xFF, 0xBE, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F,
+  0xF0, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0xFF, 0xC3, 0xFC, 0x00, 0x7F, 0xF0,
+  0xFF, 0x00, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xFF, 0x9F, 0xE0, 0x0F, 0x9F,
+  0xE7, 0xF8, 0x07, 0xC7, 0xF9, 0xFE, 0x03, 0xE1, 0xFE, 0x7F, 0x81, 0xF0,
+  0x7F, 0x9F, 0xE0, 0xF8, 0x1F, 0xE7, 0xF8, 0x7C, 0x07, 0xF9, 0xFE, 0x3E,
+  0x01, 0xFE, 0x7F, 0x9F, 0x00, 0x7F, 0x9F, 0xFF, 0x80, 0x3F, 0xE3, 0xFF,
+  0x80, 0x0F, 0xF0, 0xFF, 0xC0, 0x07, 0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x07,
+  0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0x9F, 0xFF, 0xFE,
+  0x03, 0xC1, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0xFC, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00,
+  0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+  0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
+  0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xEF, 0xF0, 0x07, 0xF9, 0xFF, 0x83, 0xFF,
+  0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x80,
+  0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+  0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03,
+  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
+  0xEF, 0xF0, 0x07, 0xF9, 0xFF, 0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xC0,
+  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x03,
+  0xEF, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x1E, 0x0F, 0x00, 0x07, 0x80, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+  0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07,
+  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xEF, 0xF0, 0x07, 0xF9, 0xFF,
+  0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x01,
+  0xF1, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0xF8, 0xF8,
+  0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
+  0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00,
+  0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+  0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0x7F,
+  0x80, 0x3F, 0xCF, 0xFC, 0x1F, 0xF8, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+  0xC1, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xC0,
+  0x03, 0xFE, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x1F, 0xF0,
+  0x0F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFC,
+  0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x01, 0xFF,
+  0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFC, 0x03,
+  0xFE, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFB,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xE3, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF8,
+  0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x83, 0xFE, 0x1F, 0xC3, 0xFE, 0x07,
+  0xF1, 0xFE, 0x03, 0xF8, 0xFF, 0x01, 0xFC, 0x7F, 0x83, 0xFE, 0x3F, 0xC3,
+  0xFF, 0x1F, 0xE3, 0xFC, 0x0F, 0xF1, 0xF8, 0x07, 0xF9, 0xFC, 0x03, 0xFC,
+  0xFE, 0x01, 0xFE, 0x7F, 0x00, 0xFF, 0x3F, 0xC0, 0x7F, 0x9F, 0xF0, 0x3F,
+  0xC7, 0xFE, 0x1F, 0xE3, 0xFF, 0x8F, 0xF0, 0xFF, 0xE7, 0xF8, 0x1F, 0xFB,
+  0xFC, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x3F,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xE4, 0x1F, 0xFF, 0xF3, 0xFF, 0xF7, 0xF9, 0xFF,
+  0xFB, 0xFC, 0xFF, 0xF9, 0xFE, 0x7F, 0xF8, 0xFF, 0x0F, 0xF0, 0x00, 0x0F,
+  0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3C, 0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0x87, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F,
+  0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00,
+  0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
+  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3C,
+  0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F,
+  0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x00,
+  0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x01,
+  0xF3, 0xE0, 0x01, 0xE1, 0xE0, 0x03, 0xC0, 0xF0, 0x07, 0x80, 0x78, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3C, 0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0x87, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F,
+  0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x00, 0xF0, 0x70, 0x01, 0xF8, 0x70, 0x01,
+  0xFC, 0x70, 0x03, 0x9F, 0xE0, 0x03, 0x87, 0xE0, 0x03, 0x83, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3C,
+  0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F,
+  0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x03,
+  0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03,
+  0xE3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F,
+  0xFF, 0xFE, 0x3C, 0x03, 0xFE, 0x20, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x07,
+  0xF0, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x00,
+  0xE1, 0xC0, 0x01, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x01,
+  0xC0, 0xE0, 0x00, 0xE1, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3C, 0x03, 0xFE, 0x20,
+  0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0x0F,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F,
+  0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x07, 0xFF, 0x00, 0x7F,
+  0x80, 0x1F, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xFF, 0xFD, 0xFF, 0xFE, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0x1F,
+  0xFF, 0x0F, 0xF8, 0x80, 0x07, 0xFE, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
+  0xFE, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFC, 0x00,
+  0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x7F,
+  0x80, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0xFF, 0xF0, 0x01, 0xDF, 0xF0, 0xFF,
+  0xFC, 0x07, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xF8, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x3F, 0xFC, 0x07, 0xFF, 0xFC, 0x07,
+  0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xC1, 0xFF,
+  0xFE, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F, 0xF8, 0x1D, 0xFF, 0x00, 0x2F,
+  0xF0, 0x00, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
+  0x80, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0x7F, 0xE0, 0x73, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
+  0x30, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x43, 0xC0,
+  0x03, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+  0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0x87, 0xFC, 0xFF, 0x01, 0xFE, 0x7F, 0x80,
+  0x7F, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x4F, 0xF8, 0x00, 0xE3,
+  0xFE, 0x03, 0xF1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xF0, 0xFF, 0x87, 0xFC, 0xFF, 0x01, 0xFE, 0x7F, 0x80, 0x7F,
+  0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x4F, 0xF8, 0x00, 0xE3, 0xFE,
+  0x03, 0xF1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x03,
+  0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xE0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x9F, 0x00, 0x07, 0x87,
+  0x80, 0x07, 0x81, 0xE0, 0x07, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1, 0xFF,
+  0xFF, 0xF0, 0xFF, 0x87, 0xFC, 0xFF, 0x01, 0xFE, 0x7F, 0x80, 0x7F, 0x7F,
+  0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x4F, 0xF8, 0x00, 0xE3, 0xFE, 0x03,
+  0xF1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0xF8, 0xF8, 0x00,
+  0x7C, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE1, 0xFF, 0x0F,
+  0xF9, 0xFE, 0x03, 0xFC, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F,
+  0xC0, 0x00, 0x9F, 0xF0, 0x01, 0xC7, 0xFC, 0x07, 0xE3, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xE0,
+  0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0x80, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83,
+  0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
+  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC0, 0x01, 0xF8, 0x1F,
+  0x81, 0xF8, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF,
+  0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0,
+  0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F,
+  0xE0, 0xFF, 0x07, 0xF8, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F,
+  0xF8, 0x3E, 0x7C, 0x3C, 0x3C, 0x78, 0x1E, 0xF0, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
+  0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
+  0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
+  0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0x06, 0x00, 0x7F, 0x0F, 0x80, 0x1F, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF,
+  0xFC, 0x00, 0x7E, 0x3F, 0x80, 0x1C, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x7F, 0xE0, 0xFF, 0x9F, 0xE0,
+  0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+  0xDF, 0xE0, 0x1F, 0xE7, 0xFC, 0x0F, 0xF8, 0xFF, 0x87, 0xFC, 0x3F, 0xFF,
+  0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00,
+  0xFF, 0xC0, 0x00, 0x03, 0xC0, 0xE0, 0x07, 0xF0, 0xE0, 0x07, 0xF9, 0xE0,
+  0x0F, 0x3F, 0xC0, 0x0E, 0x1F, 0xC0, 0x0E, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x1F, 0xF8,
+  0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xE3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x07, 0xE0, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC3, 0xFE, 0x1F, 0xF1, 0xFF, 0x03,
+  0xFE, 0x7F, 0x80, 0x7F, 0xBF, 0xE0, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xF7, 0xF8, 0x07,
+  0xF9, 0xFF, 0x03, 0xFE, 0x3F, 0xE1, 0xFF, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F,
+  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x00,
+  0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC3, 0xFE, 0x1F,
+  0xF1, 0xFF, 0x03, 0xFE, 0x7F, 0x80, 0x7F, 0xBF, 0xE0, 0x1F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x1F,
+  0xF7, 0xF8, 0x07, 0xF9, 0xFF, 0x03, 0xFE, 0x3F, 0xE1, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
+  0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8,
+  0x00, 0x03, 0xFF, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x3C,
+  0x0F, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+  0xC3, 0xFE, 0x1F, 0xF1, 0xFF, 0x03, 0xFE, 0x7F, 0x80, 0x7F, 0xBF, 0xE0,
+  0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+  0xFF, 0xE0, 0x1F, 0xF7, 0xF8, 0x07, 0xF9, 0xFF, 0x03, 0xFE, 0x3F, 0xE1,
+  0xFF, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x03,
+  0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xF0, 0x38, 0x00, 0xFE, 0x0E,
+  0x00, 0x3F, 0xE7, 0x80, 0x1E, 0x7F, 0xC0, 0x07, 0x07, 0xF0, 0x01, 0xC0,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xFF, 0xC3, 0xFE, 0x1F, 0xF1, 0xFF, 0x03, 0xFE, 0x7F, 0x80,
+  0x7F, 0xBF, 0xE0, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
+  0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xF7, 0xF8, 0x07, 0xF9, 0xFF, 0x03,
+  0xFE, 0x3F, 0xE1, 0xFF, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xE1, 0xF0,
+  0x00, 0xF8, 0x7C, 0x00, 0x3E, 0x1F, 0x00, 0x0F, 0x87, 0xC0, 0x03, 0xE1,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFF, 0x0F, 0xF8, 0x7F, 0xC7, 0xFC, 0x0F, 0xF9, 0xFE, 0x01,
+  0xFE, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xDF, 0xE0, 0x1F, 0xE7, 0xFC, 0x0F,
+  0xF8, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x00, 0x01, 0x80, 0x1F, 0xE0, 0xF0, 0x3F, 0xFF, 0x78, 0x3F, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC3, 0xFE, 0x1F, 0xF1, 0xFF,
+  0x03, 0xFE, 0x7F, 0x81, 0xFF, 0xBF, 0xE0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
+  0xFC, 0x1E, 0xFF, 0xFF, 0x0F, 0x3F, 0xFF, 0xC7, 0x8F, 0xFF, 0xF3, 0xC3,
+  0xFF, 0xFD, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x1F, 0xE7, 0xFE,
+  0x07, 0xF9, 0xFF, 0x03, 0xFE, 0x3F, 0xE1, 0xFF, 0x0F, 0xFF, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3C, 0x3F, 0xE0,
+  0x06, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
+  0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x81,
+  0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
+  0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xF8, 0xFF, 0x07, 0xE0, 0xFF, 0x00, 0x01,
+  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+  0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xF8,
+  0xFF, 0x07, 0xE0, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x03, 0xC3, 0xC0, 0x07, 0x81,
+  0xE0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x81,
+  0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
+  0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xF8, 0xFF, 0x07, 0xE0, 0xFF, 0x07, 0xC3,
+  0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xF8, 0xFF, 0x07, 0xE0,
+  0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x7F, 0xBF, 0x80, 0x0F, 0xE7, 0xF8, 0x01, 0xFC, 0xFF, 0x00, 0x7F,
+  0x8F, 0xE0, 0x0F, 0xE1, 0xFE, 0x01, 0xFC, 0x1F, 0xC0, 0x7F, 0x83, 0xFC,
+  0x0F, 0xE0, 0x3F, 0x81, 0xFC, 0x07, 0xF0, 0x7F, 0x00, 0xFF, 0x0F, 0xE0,
+  0x0F, 0xE1, 0xFC, 0x01, 0xFE, 0x7F, 0x00, 0x1F, 0xCF, 0xE0, 0x03, 0xF9,
+  0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00,
+  0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00,
+  0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xC0, 0x7F, 0x9F, 0xF8, 0x3F, 0xDF,
+  0xFE, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE7, 0xFF, 0x1F, 0xFB, 0xFE,
+  0x03, 0xFD, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+  0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xBF, 0xE0, 0x3F, 0xDF, 0xFC, 0x7F, 0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+  0xE3, 0xFD, 0xFF, 0xE1, 0xFE, 0x7F, 0xE0, 0xFF, 0x0F, 0xC0, 0x7F, 0x80,
+  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
+  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x7C, 0x7C, 0x00, 0x0F, 0x8F,
+  0x80, 0x01, 0xF1, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03,
+  0xFD, 0xFC, 0x00, 0x7F, 0x3F, 0xC0, 0x0F, 0xE7, 0xF8, 0x03, 0xFC, 0x7F,
+  0x00, 0x7F, 0x0F, 0xF0, 0x0F, 0xE0, 0xFE, 0x03, 0xFC, 0x1F, 0xE0, 0x7F,
+  0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x83, 0xF8, 0x07, 0xF8, 0x7F, 0x00, 0x7F,
+  0x0F, 0xE0, 0x0F, 0xF3, 0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x1F, 0xCF, 0xC0,
+  0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F,
+  0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFC, 0x00,
+  0x00 };
+
+const GFXglyph DejaVuSans_Bold22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  15,    0,    0 },   // 0x20 ' '
+  {     1,   8,  31,  20,    6,  -30 },   // 0x21 '!'
+  {    32,  14,  12,  22,    4,  -30 },   // 0x22 '"'
+  {    53,  30,  31,  36,    3,  -30 },   // 0x23 '#'
+  {   170,  24,  39,  30,    3,  -32 },   // 0x24 '$'
+  {   287,  40,  32,  43,    1,  -31 },   // 0x25 '%'
+  {   447,  33,  32,  38,    2,  -31 },   // 0x26 '&'
+  {   579,   5,  12,  13,    4,  -30 },   // 0x27 '''
+  {   587,  12,  38,  20,    4,  -32 },   // 0x28 '('
+  {   644,  12,  38,  20,    4,  -32 },   // 0x29 ')'
+  {   701,  22,  20,  22,    0,  -31 },   // 0x2A '*'
+  {   756,  27,  27,  36,    5,  -26 },   // 0x2B '+'
+  {   848,  10,  14,  16,    2,   -7 },   // 0x2C ','
+  {   866,  13,   6,  18,    2,  -14 },   // 0x2D '-'
+  {   876,   8,   8,  16,    4,   -7 },   // 0x2E '.'
+  {   884,  16,  35,  16,    0,  -30 },   // 0x2F '/'
+  {   954,  26,  32,  30,    2,  -31 },   // 0x30 '0'
+  {  1058,  22,  31,  30,    5,  -30 },   // 0x31 '1'
+  {  1144,  23,  32,  30,    3,  -31 },   // 0x32 '2'
+  {  1236,  24,  32,  30,    3,  -31 },   // 0x33 '3'
+  {  1332,  26,  31,  30,    2,  -30 },   // 0x34 '4'
+  {  1433,  24,  31,  30,    3,  -30 },   // 0x35 '5'
+  {  1526,  25,  32,  30,    3,  -31 },   // 0x36 '6'
+  {  1626,  24,  31,  30,    3,  -30 },   // 0x37 '7'
+  {  1719,  25,  32,  30,    3,  -31 },   // 0x38 '8'
+  {  1819,  25,  32,  30,    2,  -31 },   // 0x39 '9'
+  {  1919,   8,  24,  17,    5,  -23 },   // 0x3A ':'
+  {  1943,  10,  30,  17,    3,  -23 },   // 0x3B ';'
+  {  1981,  27,  24,  36,    5,  -25 },   // 0x3C '<'
+  {  2062,  27,  15,  36,    5,  -20 },   // 0x3D '='
+  {  2113,  27,  24,  36,    5,  -25 },   // 0x3E '>'
+  {  2194,  19,  31,  25,    3,  -30 },   // 0x3F '?'
+  {  2268,  37,  38,  43,    3,  -29 },   // 0x40 '@'
+  {  2444,  33,  31,  33,    0,  -30 },   // 0x41 'A'
+  {  2572,  26,  31,  33,    4,  -30 },   // 0x42 'B'
+  {  2673,  27,  32,  32,    2,  -31 },   // 0x43 'C'
+  {  2781,  30,  31,  36,    4,  -30 },   // 0x44 'D'
+  {  2898,  22,  31,  29,    4,  -30 },   // 0x45 'E'
+  {  2984,  22,  31,  29,    4,  -30 },   // 0x46 'F'
+  {  3070,  30,  32,  35,    2,  -31 },   // 0x47 'G'
+  {  3190,  28,  31,  36,    4,  -30 },   // 0x48 'H'
+  {  3299,   8,  31,  16,    4,  -30 },   // 0x49 'I'
+  {  3330,  14,  40,  16,   -2,  -30 },   // 0x4A 'J'
+  {  3400,  31,  31,  33,    4,  -30 },   // 0x4B 'K'
+  {  3521,  22,  31,  27,    4,  -30 },   // 0x4C 'L'
+  {  3607,  35,  31,  43,    4,  -30 },   // 0x4D 'M'
+  {  3743,  28,  31,  36,    4,  -30 },   // 0x4E 'N'
+  {  3852,  32,  32,  37,    2,  -31 },   // 0x4F 'O'
+  {  3980,  26,  31,  32,    4,  -30 },   // 0x50 'P'
+  {  4081,  32,  38,  37,    2,  -31 },   // 0x51 'Q'
+  {  4233,  28,  31,  33,    4,  -30 },   // 0x52 'R'
+  {  4342,  25,  32,  31,    3,  -31 },   // 0x53 'S'
+  {  4442,  28,  31,  29,    1,  -30 },   // 0x54 'T'
+  {  4551,  27,  31,  35,    4,  -30 },   // 0x55 'U'
+  {  4656,  33,  31,  33,    0,  -30 },   // 0x56 'V'
+  {  4784,  45,  31,  47,    1,  -30 },   // 0x57 'W'
+  {  4959,  31,  31,  33,    1,  -30 },   // 0x58 'X'
+  {  5080,  32,  31,  31,    0,  -30 },   // 0x59 'Y'
+  {  5204,  27,  31,  31,    2,  -30 },   // 0x5A 'Z'
+  {  5309,  13,  38,  20,    4,  -32 },   // 0x5B '['
+  {  5371,  16,  35,  16,    0,  -30 },   // 0x5C '\'
+  {  5441,  13,  38,  20,    3,  -32 },   // 0x5D ']'
+  {  5503,  27,  12,  36,    4,  -30 },   // 0x5E '^'
+  {  5544,  22,   4,  22,    0,    7 },   // 0x5F '_'
+  {  5555,  12,   8,  22,    2,  -33 },   // 0x60 '`'
+  {  5567,  24,  25,  29,    2,  -24 },   // 0x61 'a'
+  {  5642,  25,  33,  31,    4,  -32 },   // 0x62 'b'
+  {  5746,  21,  25,  25,    2,  -24 },   // 0x63 'c'
+  {  5812,  25,  33,  31,    2,  -32 },   // 0x64 'd'
+  {  5916,  25,  25,  29,    2,  -24 },   // 0x65 'e'
+  {  5995,  19,  33,  19,    1,  -32 },   // 0x66 'f'
+  {  6074,  25,  34,  31,    2,  -24 },   // 0x67 'g'
+  {  6181,  24,  33,  31,    4,  -32 },   // 0x68 'h'
+  {  6280,   8,  33,  15,    4,  -32 },   // 0x69 'i'
+  {  6313,  13,  42,  15,   -1,  -32 },   // 0x6A 'j'
+  {  6382,  26,  33,  29,    4,  -32 },   // 0x6B 'k'
+  {  6490,   8,  33,  15,    4,  -32 },   // 0x6C 'l'
+  {  6523,  38,  25,  45,    4,  -24 },   // 0x6D 'm'
+  {  6642,  24,  25,  31,    4,  -24 },   // 0x6E 'n'
+  {  6717,  26,  25,  30,    2,  -24 },   // 0x6F 'o'
+  {  6799,  25,  34,  31,    4,  -24 },   // 0x70 'p'
+  {  6906,  25,  34,  31,    2,  -24 },   // 0x71 'q'
+  {  7013,  17,  25,  21,    4,  -24 },   // 0x72 'r'
+  {  7067,  21,  25,  26,    2,  -24 },   // 0x73 's'
+  {  7133,  20,  30,  21,    0,  -29 },   // 0x74 't'
+  {  7208,  24,  24,  31,    4,  -23 },   // 0x75 'u'
+  {  7280,  27,  24,  28,    1,  -23 },   // 0x76 'v'
+  {  7361,  37,  24,  40,    2,  -23 },   // 0x77 'w'
+  {  7472,  26,  24,  28,    1,  -23 },   // 0x78 'x'
+  {  7550,  27,  33,  28,    1,  -23 },   // 0x79 'y'
+  {  7662,  21,  24,  25,    2,  -23 },   // 0x7A 'z'
+  {  7725,  20,  40,  31,    5,  -32 },   // 0x7B '{'
+  {  7825,   5,  43,  16,    5,  -32 },   // 0x7C '|'
+  {  7852,  20,  40,  31,    6,  -32 },   // 0x7D '}'
+  {  7952,  27,   8,  36,    5,  -16 },   // 0x7E '~'
+  {  7979,  22,  38,  26,    2,  -29 },   // 0x7F
+  {  8084,  22,  38,  26,    2,  -29 },   // 0x80
+  {  8189,  22,  38,  26,    2,  -29 },   // 0x81
+  {  8294,  22,  38,  26,    2,  -29 },   // 0x82
+  {  8399,  22,  38,  26,    2,  -29 },   // 0x83
+  {  8504,  22,  38,  26,    2,  -29 },   // 0x84
+  {  8609,  22,  38,  26,    2,  -29 },   // 0x85
+  {  8714,  22,  38,  26,    2,  -29 },   // 0x86
+  {  8819,  22,  38,  26,    2,  -29 },   // 0x87
+  {  8924,  22,  38,  26,    2,  -29 },   // 0x88
+  {  9029,  22,  38,  26,    2,  -29 },   // 0x89
+  {  9134,  22,  38,  26,    2,  -29 },   // 0x8A
+  {  9239,  22,  38,  26,    2,  -29 },   // 0x8B
+  {  9344,  22,  38,  26,    2,  -29 },   // 0x8C
+  {  9449,  22,  38,  26,    2,  -29 },   // 0x8D
+  {  9554,  22,  38,  26,    2,  -29 },   // 0x8E
+  {  9659,  22,  38,  26,    2,  -29 },   // 0x8F
+  {  9764,  22,  38,  26,    2,  -29 },   // 0x90
+  {  9869,  22,  38,  26,    2,  -29 },   // 0x91
+  {  9974,  22,  38,  26,    2,  -29 },   // 0x92
+  { 10079,  22,  38,  26,    2,  -29 },   // 0x93
+  { 10184,  22,  38,  26,    2,  -29 },   // 0x94
+  { 10289,  22,  38,  26,    2,  -29 },   // 0x95
+  { 10394,  22,  38,  26,    2,  -29 },   // 0x96
+  { 10499,  22,  38,  26,    2,  -29 },   // 0x97
+  { 10604,  22,  38,  26,    2,  -29 },   // 0x98
+  { 10709,  22,  38,  26,    2,  -29 },   // 0x99
+  { 10814,  22,  38,  26,    2,  -29 },   // 0x9A
+  { 10919,  22,  38,  26,    2,  -29 },   // 0x9B
+  { 11024,  22,  38,  26,    2,  -29 },   // 0x9C
+  { 11129,  22,  38,  26,    2,  -29 },   // 0x9D
+  { 11234,  22,  38,  26,    2,  -29 },   // 0x9E
+  { 11339,  22,  38,  26,    2,  -29 },   // 0x9F
+  { 11444,   1,   1,  15,    0,    0 },   // 0xA0
+  { 11445,   8,  31,  20,    6,  -23 },   // 0xA1
+  { 11476,  21,  38,  30,    4,  -30 },   // 0xA2
+  { 11576,  24,  32,  30,    2,  -31 },   // 0xA3
+  { 11672,  24,  24,  27,    2,  -24 },   // 0xA4
+  { 11744,  28,  31,  30,    1,  -30 },   // 0xA5
+  { 11853,   5,  37,  16,    5,  -29 },   // 0xA6
+  { 11877,  21,  36,  22,    1,  -31 },   // 0xA7
+  { 11972,  13,   5,  22,    4,  -32 },   // 0xA8
+  { 11981,  31,  31,  43,    6,  -30 },   // 0xA9
+  { 12102,  18,  24,  24,    3,  -31 },   // 0xAA
+  { 12156,  20,  19,  28,    3,  -21 },   // 0xAB
+  { 12204,  27,  13,  36,    5,  -18 },   // 0xAC
+  { 12248,  13,   6,  18,    2,  -14 },   // 0xAD
+  { 12258,  31,  31,  43,    6,  -30 },   // 0xAE
+  { 12379,  13,   4,  22,    4,  -32 },   // 0xAF
+  { 12386,  14,  14,  22,    4,  -31 },   // 0xB0
+  { 12411,  27,  27,  36,    5,  -26 },   // 0xB1
+  { 12503,  14,  18,  19,    2,  -31 },   // 0xB2
+  { 12535,  15,  18,  19,    2,  -31 },   // 0xB3
+  { 12569,  12,   8,  22,    8,  -33 },   // 0xB4
+  { 12581,  27,  33,  32,    4,  -23 },   // 0xB5
+  { 12693,  21,  35,  27,    3,  -30 },   // 0xB6
+  { 12785,   8,   8,  16,    4,  -18 },   // 0xB7
+  { 12793,   9,   8,  22,    6,    1 },   // 0xB8
+  { 12802,  14,  18,  19,    2,  -31 },   // 0xB9
+  { 12834,  19,  24,  24,    2,  -31 },   // 0xBA
+  { 12891,  20,  19,  28,    4,  -21 },   // 0xBB
+  { 12939,  39,  32,  45,    2,  -31 },   // 0xBC
+  { 13095,  40,  32,  45,    2,  -31 },   // 0xBD
+  { 13255,  39,  32,  45,    2,  -31 },   // 0xBE
+  { 13411,  19,  33,  25,    3,  -23 },   // 0xBF
+  { 13490,  33,  41,  33,    0,  -40 },   // 0xC0
+  { 13660,  33,  41,  33,    0,  -40 },   // 0xC1
+  { 13830,  33,  41,  33,    0,  -40 },   // 0xC2
+  { 14000,  33,  40,  33,    0,  -39 },   // 0xC3
+  { 14165,  33,  40,  33,    0,  -39 },   // 0xC4
+  { 14330,  33,  40,  33,    0,  -39 },   // 0xC5
+  { 14495,  44,  31,  47,    0,  -30 },   // 0xC6
+  { 14666,  27,  40,  32,    2,  -31 },   // 0xC7
+  { 14801,  22,  41,  29,    4,  -40 },   // 0xC8
+  { 14914,  22,  41,  29,    4,  -40 },   // 0xC9
+  { 15027,  22,  41,  29,    4,  -40 },   // 0xCA
+  { 15140,  22,  40,  29,    4,  -39 },   // 0xCB
+  { 15250,  12,  41,  16,    0,  -40 },   // 0xCC
+  { 15312,  10,  41,  16,    4,  -40 },   // 0xCD
+  { 15364,  16,  41,  16,    0,  -40 },   // 0xCE
+  { 15446,  12,  40,  16,    2,  -39 },   // 0xCF
+  { 15506,  34,  31,  36,    0,  -30 },   // 0xD0
+  { 15638,  28,  40,  36,    4,  -39 },   // 0xD1
+  { 15778,  32,  41,  37,    2,  -40 },   // 0xD2
+  { 15942,  32,  41,  37,    2,  -40 },   // 0xD3
+  { 16106,  32,  41,  37,    2,  -40 },   // 0xD4
+  { 16270,  32,  40,  37,    2,  -39 },   // 0xD5
+  { 16430,  32,  40,  37,    2,  -39 },   // 0xD6
+  { 16590,  25,  25,  36,    5,  -25 },   // 0xD7
+  { 16669,  34,  34,  37,    1,  -32 },   // 0xD8
+  { 16814,  27,  41,  35,    4,  -40 },   // 0xD9
+  { 16953,  27,  41,  35,    4,  -40 },   // 0xDA
+  { 17092,  27,  41,  35,    4,  -40 },   // 0xDB
+  { 17231,  27,  40,  35,    4,  -39 },   // 0xDC
+  { 17366,  32,  41,  31,    0,  -40 },   // 0xDD
+  { 17530,  26,  31,  32,    4,  -30 },   // 0xDE
+  { 17631,  25,  33,  31,    4,  -32 },   // 0xDF
+  { 17735,  24,  34,  29,    2,  -33 },   // 0xE0
+  { 17837,  24,  34,  29,    2,  -33 },   // 0xE1
+  { 17939,  24,  34,  29,    2,  -33 },   // 0xE2
+  { 18041,  24,  34,  29,    2,  -33 },   // 0xE3
+  { 18143,  24,  33,  29,    2,  -32 },   // 0xE4
+  { 18242,  24,  38,  29,    2,  -37 },   // 0xE5
+  { 18356,  41,  25,  45,    2,  -24 },   // 0xE6
+  { 18485,  21,  33,  25,    2,  -24 },   // 0xE7
+  { 18572,  25,  34,  29,    2,  -33 },   // 0xE8
+  { 18679,  25,  34,  29,    2,  -33 },   // 0xE9
+  { 18786,  25,  34,  29,    2,  -33 },   // 0xEA
+  { 18893,  25,  33,  29,    2,  -32 },   // 0xEB
+  { 18997,  13,  34,  15,   -1,  -33 },   // 0xEC
+  { 19053,  13,  34,  15,    4,  -33 },   // 0xED
+  { 19109,  16,  34,  15,    0,  -33 },   // 0xEE
+  { 19177,  12,  33,  15,    2,  -32 },   // 0xEF
+  { 19227,  26,  33,  30,    2,  -32 },   // 0xF0
+  { 19335,  24,  34,  31,    4,  -33 },   // 0xF1
+  { 19437,  26,  34,  30,    2,  -33 },   // 0xF2
+  { 19548,  26,  34,  30,    2,  -33 },   // 0xF3
+  { 19659,  26,  34,  30,    2,  -33 },   // 0xF4
+  { 19770,  26,  34,  30,    2,  -33 },   // 0xF5
+  { 19881,  26,  33,  30,    2,  -32 },   // 0xF6
+  { 19989,  26,  23,  36,    5,  -24 },   // 0xF7
+  { 20064,  26,  27,  30,    2,  -25 },   // 0xF8
+  { 20152,  24,  34,  31,    4,  -33 },   // 0xF9
+  { 20254,  24,  34,  31,    4,  -33 },   // 0xFA
+  { 20356,  24,  34,  31,    4,  -33 },   // 0xFB
+  { 20458,  24,  33,  31,    4,  -32 },   // 0xFC
+  { 20557,  27,  43,  28,    1,  -33 },   // 0xFD
+  { 20703,  25,  42,  31,    4,  -32 },   // 0xFE
+  { 20835,  27,  42,  28,    1,  -32 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold22pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold22pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold22pt8bGlyphs,
+  0x20, 0xFF, 50 };
+
+// Approx. 22552 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold22pt8bMetrics[] PROGMEM = {
+  {   0,  15,   1 },   // 0x20
+  {   6,  20,  14 },   // 0x21
+  {   4,  22,  18 },   // 0x22
+  {   3,  36,  33 },   // 0x23
+  {   3,  30,  27 },   // 0x24
+  {   1,  43,  41 },   // 0x25
+  {   2,  38,  35 },   // 0x26
+  {   4,  13,   9 },   // 0x27
+  {   4,  20,  16 },   // 0x28
+  {   4,  20,  16 },   // 0x29
+  {   0,  22,  22 },   // 0x2A
+  {   5,  36,  32 },   // 0x2B
+  {   2,  16,  12 },   // 0x2C
+  {   2,  18,  15 },   // 0x2D
+  {   4,  16,  12 },   // 0x2E
+  {   0,  16,  16 },   // 0x2F
+  {   2,  30,  28 },   // 0x30
+  {   5,  30,  27 },   // 0x31
+  {   3,  30,  26 },   // 0x32
+  {   3,  30,  27 },   // 0x33
+  {   2,  30,  28 },   // 0x34
+  {   3,  30,  27 },   // 0x35
+  {   3,  30,  28 },   // 0x36
+  {   3,  30,  27 },   // 0x37
+  {   3,  30,  28 },   // 0x38
+  {   2,  30,  27 },   // 0x39
+  {   5,  17,  13 },   // 0x3A
+  {   3,  17,  13 },   // 0x3B
+  {   5,  36,  32 },   // 0x3C
+  {   5,  36,  32 },   // 0x3D
+  {   5,  36,  32 },   // 0x3E
+  {   3,  25,  22 },   // 0x3F
+  {   3,  43,  40 },   // 0x40
+  {   0,  33,  33 },   // 0x41
+  {   4,  33,  30 },   // 0x42
+  {   2,  32,  29 },   // 0x43
+  {   4,  36,  34 },   // 0x44
+  {   4,  29,  26 },   // 0x45
+  {   4,  29,  26 },   // 0x46
+  {   2,  35,  32 },   // 0x47
+  {   4,  36,  32 },   // 0x48
+  {   4,  16,  12 },   // 0x49
+  {  -2,  16,  12 },   // 0x4A
+  {   4,  33,  35 },   // 0x4B
+  {   4,  27,  26 },   // 0x4C
+  {   4,  43,  39 },   // 0x4D
+  {   4,  36,  32 },   // 0x4E
+  {   2,  37,  34 },   // 0x4F
+  {   4,  32,  30 },   // 0x50
+  {   2,  37,  34 },   // 0x51
+  {   4,  33,  32 },   // 0x52
+  {   3,  31,  28 },   // 0x53
+  {   1,  29,  29 },   // 0x54
+  {   4,  35,  31 },   // 0x55
+  {   0,  33,  33 },   // 0x56
+  {   1,  47,  46 },   // 0x57
+  {   1,  33,  32 },   // 0x58
+  {   0,  31,  32 },   // 0x59
+  {   2,  31,  29 },   // 0x5A
+  {   4,  20,  17 },   // 0x5B
+  {   0,  16,  16 },   // 0x5C
+  {   3,  20,  16 },   // 0x5D
+  {   4,  36,  31 },   // 0x5E
+  {   0,  22,  22 },   // 0x5F
+  {   2,  22,  14 },   // 0x60
+  {   2,  29,  26 },   // 0x61
+  {   4,  31,  29 },   // 0x62
+  {   2,  25,  23 },   // 0x63
+  {   2,  31,  27 },   // 0x64
+  {   2,  29,  27 },   // 0x65
+  {   1,  19,  20 },   // 0x66
+  {   2,  31,  27 },   // 0x67
+  {   4,  31,  28 },   // 0x68
+  {   4,  15,  12 },   // 0x69
+  {  -1,  15,  12 },   // 0x6A
+  {   4,  29,  30 },   // 0x6B
+  {   4,  15,  12 },   // 0x6C
+  {   4,  45,  42 },   // 0x6D
+  {   4,  31,  28 },   // 0x6E
+  {   2,  30,  28 },   // 0x6F
+  {   4,  31,  29 },   // 0x70
+  {   2,  31,  27 },   // 0x71
+  {   4,  21,  21 },   // 0x72
+  {   2,  26,  23 },   // 0x73
+  {   0,  21,  20 },   // 0x74
+  {   4,  31,  28 },   // 0x75
+  {   1,  28,  28 },   // 0x76
+  {   2,  40,  39 },   // 0x77
+  {   1,  28,  27 },   // 0x78
+  {   1,  28,  28 },   // 0x79
+  {   2,  25,  23 },   // 0x7A
+  {   5,  31,  25 },   // 0x7B
+  {   5,  16,  10 },   // 0x7C
+  {   6,  31,  26 },   // 0x7D
+  {   5,  36,  32 },   // 0x7E
+  {   2,  26,  24 },   // 0x7F
+  {   2,  26,  24 },   // 0x80
+  {   2,  26,  24 },   // 0x81
+  {   2,  26,  24 },   // 0x82
+  {   2,  26,  24 },   // 0x83
+  {   2,  26,  24 },   // 0x84
+  {   2,  26,  24 },   // 0x85
+  {   2,  26,  24 },   // 0x86
+  {   2,  26,  24 },   // 0x87
+  {   2,  26,  24 },   // 0x88
+  {   2,  26,  24 },   // 0x89
+  {   2,  26,  24 },   // 0x8A
+  {   2,  26,  24 },   // 0x8B
+  {   2,  26,  24 },   // 0x8C
+  {   2,  26,  24 },   // 0x8D
+  {   2,  26,  24 },   // 0x8E
+  {   2,  26,  24 },   // 0x8F
+  {   2,  26,  24 },   // 0x90
+  {   2,  26,  24 },   // 0x91
+  {   2,  26,  24 },   // 0x92
+  {   2,  26,  24 },   // 0x93
+  {   2,  26,  24 },   // 0x94
+  {   2,  26,  24 },   // 0x95
+  {   2,  26,  24 },   // 0x96
+  {   2,  26,  24 },   // 0x97
+  {   2,  26,  24 },   // 0x98
+  {   2,  26,  24 },   // 0x99
+  {   2,  26,  24 },   // 0x9A
+  {   2,  26,  24 },   // 0x9B
+  {   2,  26,  24 },   // 0x9C
+  {   2,  26,  24 },   // 0x9D
+  {   2,  26,  24 },   // 0x9E
+  {   2,  26,  24 },   // 0x9F
+  {   0,  15,   1 },   // 0xA0
+  {   6,  20,  14 },   // 0xA1
+  {   4,  30,  25 },   // 0xA2
+  {   2,  30,  26 },   // 0xA3
+  {   2,  27,  26 },   // 0xA4
+  {   1,  30,  29 },   // 0xA5
+  {   5,  16,  10 },   // 0xA6
+  {   1,  22,  22 },   // 0xA7
+  {   4,  22,  17 },   // 0xA8
+  {   6,  43,  37 },   // 0xA9
+  {   3,  24,  21 },   // 0xAA
+  {   3,  28,  23 },   // 0xAB
+  {   5,  36,  32 },   // 0xAC
+  {   2,  18,  15 },   // 0xAD
+  {   6,  43,  37 },   // 0xAE
+  {   4,  22,  17 },   // 0xAF
+  {   4,  22,  18 },   // 0xB0
+  {   5,  36,  32 },   // 0xB1
+  {   2,  19,  16 },   // 0xB2
+  {   2,  19,  17 },   // 0xB3
+  {   8,  22,  20 },   // 0xB4
+  {   4,  32,  31 },   // 0xB5
+  {   3,  27,  24 },   // 0xB6
+  {   4,  16,  12 },   // 0xB7
+  {   6,  22,  15 },   // 0xB8
+  {   2,  19,  16 },   // 0xB9
+  {   2,  24,  21 },   // 0xBA
+  {   4,  28,  24 },   // 0xBB
+  {   2,  45,  41 },   // 0xBC
+  {   2,  45,  42 },   // 0xBD
+  {   2,  45,  41 },   // 0xBE
+  {   3,  25,  22 },   // 0xBF
+  {   0,  33,  33 },   // 0xC0
+  {   0,  33,  33 },   // 0xC1
+  {   0,  33,  33 },   // 0xC2
+  {   0,  33,  33 },   // 0xC3
+  {   0,  33,  33 },   // 0xC4
+  {   0,  33,  33 },   // 0xC5
+  {   0,  47,  44 },   // 0xC6
+  {   2,  32,  29 },   // 0xC7
+  {   4,  29,  26 },   // 0xC8
+  {   4,  29,  26 },   // 0xC9
+  {   4,  29,  26 },   // 0xCA
+  {   4,  29,  26 },   // 0xCB
+  {   0,  16,  12 },   // 0xCC
+  {   4,  16,  14 },   // 0xCD
+  {   0,  16,  16 },   // 0xCE
+  {   2,  16,  14 },   // 0xCF
+  {   0,  36,  34 },   // 0xD0
+  {   4,  36,  32 },   // 0xD1
+  {   2,  37,  34 },   // 0xD2
+  {   2,  37,  34 },   // 0xD3
+  {   2,  37,  34 },   // 0xD4
+  {   2,  37,  34 },   // 0xD5
+  {   2,  37,  34 },   // 0xD6
+  {   5,  36,  30 },   // 0xD7
+  {   1,  37,  35 },   // 0xD8
+  {   4,  35,  31 },   // 0xD9
+  {   4,  35,  31 },   // 0xDA
+  {   4,  35,  31 },   // 0xDB
+  {   4,  35,  31 },   // 0xDC
+  {   0,  31,  32 },   // 0xDD
+  {   4,  32,  30 },   // 0xDE
+  {   4,  31,  29 },   // 0xDF
+  {   2,  29,  26 },   // 0xE0
+  {   2,  29,  26 },   // 0xE1
+  {   2,  29,  26 },   // 0xE2
+  {   2,  29,  26 },   // 0xE3
+  {   2,  29,  26 },   // 0xE4
+  {   2,  29,  26 },   // 0xE5
+  {   2,  45,  43 },   // 0xE6
+  {   2,  25,  23 },   // 0xE7
+  {   2,  29,  27 },   // 0xE8
+  {   2,  29,  27 },   // 0xE9
+  {   2,  29,  27 },   // 0xEA
+  {   2,  29,  27 },   // 0xEB
+  {  -1,  15,  12 },   // 0xEC
+  {   4,  15,  17 },   // 0xED
+  {   0,  15,  16 },   // 0xEE
+  {   2,  15,  14 },   // 0xEF
+  {   2,  30,  28 },   // 0xF0
+  {   4,  31,  28 },   // 0xF1
+  {   2,  30,  28 },   // 0xF2
+  {   2,  30,  28 },   // 0xF3
+  {   2,  30,  28 },   // 0xF4
+  {   2,  30,  28 },   // 0xF5
+  {   2,  30,  28 },   // 0xF6
+  {   5,  36,  31 },   // 0xF7
+  {   2,  30,  28 },   // 0xF8
+  {   4,  31,  28 },   // 0xF9
+  {   4,  31,  28 },   // 0xFA
+  {   4,  31,  28 },   // 0xFB
+  {   4,  31,  28 },   // 0xFC
+  {   1,  28,  28 },   // 0xFD
+  {   4,  31,  29 },   // 0xFE
+  {   1,  28,  28 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold22pt8bWidths = { DejaVuSans_Bold22pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD22PTLAT1__H
@@ -0,0 +1,616 @@
+#ifndef DEJAVUSANSBOLD6PTLAT1__H
+#define DEJAVUSANSBOLD6PTLAT1__H
+const uint8_t DejaVuSans_Bold6pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xF3, 0xC0, 0xB6, 0x80, 0x12, 0x16, 0x7F, 0x24, 0x24, 0xFE,
+  0x68, 0x68, 0x48, 0x10, 0xFB, 0x47, 0x8F, 0xCF, 0xC7, 0x8B, 0xFC, 0x20,
+  0x40, 0x71, 0x11, 0x22, 0x28, 0x47, 0x07, 0x5C, 0x1C, 0x42, 0x88, 0x91,
+  0x11, 0xC0, 0x38, 0x32, 0x18, 0x06, 0x07, 0x9E, 0xEF, 0x3D, 0x8E, 0x7D,
+  0x80, 0xE0, 0x76, 0x6C, 0xCC, 0xCC, 0x66, 0x70, 0xE6, 0x63, 0x33, 0x33,
+  0x66, 0xE0, 0x25, 0x5C, 0xEA, 0x90, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04,
+  0x00, 0x6D, 0x40, 0xFF, 0xF0, 0x13, 0x22, 0x24, 0x44, 0xC8, 0x38, 0xDB,
+  0x1E, 0x3C, 0x78, 0xF1, 0xB6, 0x38, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0xFC, 0x7D, 0x0C, 0x18, 0x30, 0xC3, 0x0C, 0x30, 0xFE, 0x7D, 0x0C, 0x18,
+  0x33, 0xC0, 0xC1, 0xC3, 0x7C, 0x1C, 0x78, 0xB2, 0x6C, 0xD1, 0xBF, 0x86,
+  0x0C, 0xFD, 0x83, 0x07, 0xE0, 0xE0, 0xC1, 0x87, 0xFC, 0x3C, 0xC3, 0x07,
+  0xEC, 0x78, 0xF1, 0xA3, 0x3C, 0xFE, 0x0C, 0x30, 0x61, 0x83, 0x0C, 0x18,
+  0x60, 0x7D, 0x8F, 0x1E, 0x33, 0x98, 0xF1, 0xE3, 0x7C, 0x79, 0x8B, 0x1E,
+  0x3C, 0x6F, 0xC1, 0x86, 0x78, 0xF0, 0x3C, 0x6C, 0x00, 0xDA, 0x80, 0x01,
+  0x0F, 0x78, 0xC0, 0x78, 0x0F, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0xF0, 0x1E,
+  0x03, 0x1E, 0xF0, 0x80, 0xF0, 0xC6, 0x66, 0x30, 0x0C, 0x60, 0x1E, 0x08,
+  0x64, 0x0A, 0x39, 0x92, 0x64, 0x99, 0x2E, 0x3E, 0x40, 0x08, 0x41, 0xF8,
+  0x1C, 0x0E, 0x0D, 0x86, 0xC3, 0x63, 0x19, 0xFC, 0xC6, 0xC1, 0x80, 0xFD,
+  0x8F, 0x1E, 0x3F, 0xD8, 0xF1, 0xE3, 0xFC, 0x3E, 0xC7, 0x06, 0x0C, 0x18,
+  0x30, 0x31, 0x3E, 0xFC, 0xC6, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC6, 0xFC,
+  0xFF, 0x0C, 0x30, 0xFF, 0x0C, 0x30, 0xFC, 0xFF, 0x0C, 0x30, 0xFF, 0x0C,
+  0x30, 0xC0, 0x3F, 0x61, 0xC0, 0xC0, 0xC7, 0xC3, 0xC3, 0x63, 0x3F, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xC0, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xE0, 0xC3, 0x63, 0x33, 0x1B, 0x0F, 0x06, 0xC3,
+  0x31, 0x8C, 0xC3, 0x00, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xFC, 0xE1,
+  0xF8, 0x7F, 0x3F, 0x4B, 0xDE, 0xF3, 0x3C, 0xCF, 0x03, 0xC0, 0xC0, 0xE3,
+  0xE3, 0xF3, 0xD3, 0xDB, 0xCB, 0xCF, 0xC7, 0xC7, 0x3E, 0x31, 0xB0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00, 0xFD, 0x8F, 0x1E, 0x3C, 0x7F,
+  0xB0, 0x60, 0xC0, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6,
+  0x3E, 0x03, 0x00, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xFC, 0xCC, 0xC6, 0xC6,
+  0xC3, 0x7D, 0x8B, 0x07, 0x87, 0xC1, 0xC1, 0xC3, 0xFC, 0xFF, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x7E, 0xC1, 0xB1, 0x98, 0xCC, 0x63, 0x61, 0xB0, 0xD8, 0x38,
+  0x1C, 0x00, 0xC6, 0x3C, 0x63, 0x6F, 0x66, 0xF6, 0x69, 0x67, 0x9E, 0x39,
+  0xC3, 0x0C, 0x30, 0xC0, 0xC1, 0xB1, 0x8D, 0x86, 0xC1, 0xC1, 0xB0, 0xD8,
+  0xC6, 0xC1, 0x80, 0xC3, 0x66, 0x66, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFF, 0xFC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xF0, 0x8C, 0x44, 0x42, 0x22, 0x31, 0xF3, 0x33, 0x33, 0x33,
+  0x33, 0xF0, 0x18, 0x3C, 0x42, 0xFC, 0xCC, 0x3C, 0x8C, 0x1B, 0xFC, 0x78,
+  0xDF, 0x80, 0xC1, 0x83, 0x07, 0xEC, 0x78, 0xF1, 0xE3, 0xC7, 0xF8, 0x39,
+  0x9C, 0x30, 0xC1, 0x93, 0x80, 0x06, 0x0C, 0x1B, 0xFC, 0x78, 0xF1, 0xE3,
+  0xC6, 0xFC, 0x3C, 0xCB, 0x1F, 0xFC, 0x0C, 0x4F, 0x00, 0x3B, 0x19, 0xF6,
+  0x31, 0x8C, 0x63, 0x00, 0x7F, 0xDF, 0x1E, 0x3C, 0x79, 0xDF, 0x83, 0x46,
+  0x78, 0xC1, 0x83, 0x07, 0xEE, 0x78, 0xF1, 0xE3, 0xC7, 0x8C, 0xF3, 0xFF,
+  0xF0, 0x6C, 0x36, 0xDB, 0x6D, 0xBC, 0xC1, 0x83, 0x06, 0x6D, 0x9E, 0x3C,
+  0x6C, 0xCD, 0x8C, 0xFF, 0xFF, 0xF0, 0xFF, 0xB3, 0x3C, 0xCF, 0x33, 0xCC,
+  0xF3, 0x3C, 0xCC, 0xFD, 0xCF, 0x1E, 0x3C, 0x78, 0xF1, 0x80, 0x7D, 0x8F,
+  0x1E, 0x3C, 0x78, 0xDF, 0x00, 0xFD, 0x8F, 0x1E, 0x3C, 0x78, 0xFF, 0x60,
+  0xC1, 0x80, 0x7F, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x83, 0x06, 0x0C, 0xFF,
+  0x31, 0x8C, 0x63, 0x00, 0x7B, 0x1C, 0x1E, 0x0E, 0x37, 0x80, 0x63, 0x3E,
+  0xC6, 0x31, 0x8C, 0x78, 0xC7, 0x8F, 0x1E, 0x3C, 0x79, 0xDF, 0x80, 0xC7,
+  0x8D, 0xB3, 0x66, 0xC7, 0x0E, 0x00, 0xCC, 0xF3, 0x3D, 0xED, 0x7A, 0x73,
+  0x9C, 0xE3, 0x30, 0xC6, 0xD8, 0xE1, 0xC3, 0x8D, 0xB1, 0x80, 0xC7, 0x8D,
+  0xB3, 0x63, 0xC7, 0x06, 0x0C, 0x30, 0xC0, 0xFC, 0x31, 0x8C, 0x63, 0x0F,
+  0xC0, 0x1C, 0xC3, 0x0C, 0x33, 0x83, 0x0C, 0x30, 0xC1, 0xC0, 0xFF, 0xF0,
+  0xE0, 0xC3, 0x0C, 0x30, 0x73, 0x0C, 0x30, 0xCE, 0x00, 0x71, 0x8E, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0x00, 0xF3, 0xFF, 0xC0,
+  0x10, 0x47, 0xBD, 0xD3, 0x4D, 0x1D, 0x38, 0x41, 0x00, 0x3D, 0x86, 0x18,
+  0xF9, 0x86, 0x18, 0xFC, 0x84, 0xFD, 0x12, 0x24, 0x4F, 0xA0, 0x00, 0xC3,
+  0x66, 0x24, 0xFF, 0x18, 0xFF, 0x18, 0x18, 0x18, 0xF3, 0xC0, 0x79, 0x83,
+  0xBF, 0xCF, 0xB3, 0x03, 0x4D, 0xE0, 0xA0, 0x3E, 0x31, 0xB7, 0xF4, 0x1A,
+  0x0D, 0x07, 0x7E, 0xC6, 0x3E, 0x00, 0xF0, 0x5F, 0x17, 0x83, 0xE0, 0x25,
+  0xB9, 0x1B, 0x24, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x3E, 0x31, 0xBF, 0xF4,
+  0x5B, 0xED, 0x37, 0x8E, 0xC6, 0x3E, 0x00, 0xF0, 0x69, 0x96, 0x10, 0x23,
+  0xF8, 0x81, 0x00, 0x3F, 0x80, 0xF9, 0x16, 0xF0, 0xF1, 0x61, 0xF0, 0x78,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFF, 0xC0, 0xC0, 0xC0, 0x7F, 0xDF,
+  0x7D, 0x74, 0x51, 0x45, 0x14, 0x50, 0xF0, 0x3C, 0xC9, 0x2E, 0x74, 0x63,
+  0x17, 0x03, 0xE0, 0x93, 0x62, 0x76, 0x90, 0xC0, 0x88, 0x21, 0x08, 0x21,
+  0x0E, 0x4C, 0x12, 0x82, 0x50, 0x9F, 0x30, 0x40, 0xC0, 0x88, 0x21, 0x08,
+  0x21, 0x0E, 0x5E, 0x12, 0x42, 0x08, 0x86, 0x31, 0xE0, 0xF0, 0x82, 0x21,
+  0x88, 0x09, 0x0F, 0x4C, 0x12, 0x82, 0x50, 0x9F, 0x30, 0x40, 0x31, 0x80,
+  0x63, 0x3B, 0x98, 0xC3, 0xC0, 0x18, 0x06, 0x00, 0x03, 0x81, 0xC1, 0xB0,
+  0xD8, 0x6C, 0x63, 0x3F, 0x98, 0xD8, 0x30, 0x06, 0x06, 0x00, 0x03, 0x81,
+  0xC1, 0xB0, 0xD8, 0x6C, 0x63, 0x3F, 0x98, 0xD8, 0x30, 0x1C, 0x0A, 0x00,
+  0x03, 0x81, 0xC1, 0xB0, 0xD8, 0x6C, 0x63, 0x3F, 0x98, 0xD8, 0x30, 0x3A,
+  0x17, 0x00, 0x03, 0x81, 0xC1, 0xB0, 0xD8, 0x6C, 0x63, 0x3F, 0x98, 0xD8,
+  0x30, 0x14, 0x00, 0x07, 0x03, 0x83, 0x61, 0xB0, 0xD8, 0xC6, 0x7F, 0x31,
+  0xB0, 0x60, 0x1C, 0x0A, 0x07, 0x03, 0x83, 0x61, 0xB0, 0xD8, 0xC6, 0x7F,
+  0x31, 0xB0, 0x60, 0x1F, 0xF1, 0xB0, 0x1B, 0x03, 0x30, 0x33, 0xF7, 0xF0,
+  0x63, 0x06, 0x30, 0xC3, 0xF0, 0x3E, 0xC7, 0x06, 0x0C, 0x18, 0x30, 0x31,
+  0x3E, 0x08, 0x70, 0x60, 0xC0, 0x3F, 0xC3, 0x0C, 0x3F, 0xC3, 0x0C, 0x3F,
+  0x18, 0xC0, 0x3F, 0xC3, 0x0C, 0x3F, 0xC3, 0x0C, 0x3F, 0x31, 0x20, 0x3F,
+  0xC3, 0x0C, 0x3F, 0xC3, 0x0C, 0x3F, 0x50, 0x0F, 0xF0, 0xC3, 0x0F, 0xF0,
+  0xC3, 0x0F, 0xC0, 0xCC, 0x36, 0xDB, 0x6D, 0xB0, 0x78, 0x6D, 0xB6, 0xDB,
+  0x60, 0x69, 0x06, 0x66, 0x66, 0x66, 0x66, 0x90, 0x66, 0x66, 0x66, 0x66,
+  0x60, 0x7E, 0x31, 0x98, 0x6C, 0x3F, 0x1B, 0x0D, 0x86, 0xC6, 0x7E, 0x00,
+  0x34, 0x2C, 0x00, 0xE3, 0xE3, 0xF3, 0xD3, 0xDB, 0xCB, 0xCF, 0xC7, 0xC7,
+  0x30, 0x0C, 0x00, 0x07, 0xC6, 0x36, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+  0xC7, 0xC0, 0x0C, 0x0C, 0x00, 0x07, 0xC6, 0x36, 0x0F, 0x07, 0x83, 0xC1,
+  0xE0, 0xD8, 0xC7, 0xC0, 0x18, 0x12, 0x00, 0x07, 0xC6, 0x36, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xD8, 0xC7, 0xC0, 0x1C, 0x0E, 0x00, 0x07, 0xC6, 0x36,
+  0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xC7, 0xC0, 0x14, 0x00, 0x0F, 0x8C,
+  0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x80, 0x82, 0x88, 0xA0,
+  0x82, 0x88, 0xA0, 0x80, 0x1F, 0x4C, 0x66, 0x1D, 0x8B, 0x64, 0xDA, 0x37,
+  0x0C, 0xC6, 0x5F, 0x00, 0x30, 0x18, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x7E, 0x0C, 0x18, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x7E, 0x18, 0x24, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x7E, 0x24, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x7E, 0x0C, 0x18, 0x00, 0xC3, 0x66, 0x66, 0x3C, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0xC1, 0xFB, 0x1E, 0x3C, 0x78, 0xFF, 0x60, 0xC0, 0x79,
+  0x9B, 0x36, 0xCD, 0x9B, 0x37, 0xE3, 0xC7, 0xB8, 0x60, 0x60, 0x01, 0xE4,
+  0x60, 0xDF, 0xE3, 0xC6, 0xFC, 0x18, 0x60, 0x01, 0xE4, 0x60, 0xDF, 0xE3,
+  0xC6, 0xFC, 0x30, 0x90, 0x01, 0xE4, 0x60, 0xDF, 0xE3, 0xC6, 0xFC, 0x34,
+  0x58, 0x01, 0xE4, 0x60, 0xDF, 0xE3, 0xC6, 0xFC, 0x28, 0x00, 0xF2, 0x30,
+  0x6F, 0xF1, 0xE3, 0x7E, 0x38, 0x50, 0xE0, 0x03, 0xC8, 0xC1, 0xBF, 0xC7,
+  0x8D, 0xF8, 0x3D, 0xC4, 0x72, 0x06, 0x37, 0xFF, 0xC6, 0x0C, 0xF1, 0x7B,
+  0xE0, 0x39, 0x9C, 0x30, 0xC1, 0x93, 0x82, 0x38, 0x60, 0x60, 0x01, 0xE6,
+  0x58, 0xFF, 0xE0, 0x62, 0x78, 0x18, 0x60, 0x01, 0xE6, 0x58, 0xFF, 0xE0,
+  0x62, 0x78, 0x30, 0x90, 0x01, 0xE6, 0x58, 0xFF, 0xE0, 0x62, 0x78, 0x28,
+  0x00, 0xF3, 0x2C, 0x7F, 0xF0, 0x31, 0x3C, 0xCC, 0x36, 0xDB, 0x6C, 0x78,
+  0x6D, 0xB6, 0xD8, 0x69, 0x06, 0x66, 0x66, 0x66, 0x90, 0x66, 0x66, 0x66,
+  0x60, 0x34, 0x30, 0xE0, 0x67, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8, 0x68, 0xB0,
+  0x07, 0xEE, 0x78, 0xF1, 0xE3, 0xC7, 0x8C, 0x60, 0x60, 0x03, 0xEC, 0x78,
+  0xF1, 0xE3, 0xC6, 0xF8, 0x18, 0x60, 0x03, 0xEC, 0x78, 0xF1, 0xE3, 0xC6,
+  0xF8, 0x10, 0x50, 0x03, 0xEC, 0x78, 0xF1, 0xE3, 0xC6, 0xF8, 0x74, 0xB8,
+  0x03, 0xEC, 0x78, 0xF1, 0xE3, 0xC6, 0xF8, 0x28, 0x01, 0xF6, 0x3C, 0x78,
+  0xF1, 0xE3, 0x7C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x18, 0x18, 0x3A, 0x8B,
+  0x3E, 0xBE, 0x68, 0xAE, 0x00, 0x60, 0x60, 0x06, 0x3C, 0x78, 0xF1, 0xE3,
+  0xCE, 0xFC, 0x18, 0x60, 0x06, 0x3C, 0x78, 0xF1, 0xE3, 0xCE, 0xFC, 0x10,
+  0x50, 0x06, 0x3C, 0x78, 0xF1, 0xE3, 0xCE, 0xFC, 0x28, 0x03, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE7, 0x7E, 0x0C, 0x30, 0x06, 0x3C, 0x6D, 0x9B, 0x1E, 0x38,
+  0x30, 0x61, 0x86, 0x00, 0xC1, 0x83, 0x07, 0xEC, 0x78, 0xF1, 0xE3, 0xC7,
+  0xFB, 0x06, 0x0C, 0x00, 0x14, 0x03, 0x1E, 0x36, 0xCD, 0x8F, 0x1C, 0x18,
+  0x30, 0xC3, 0x00 };
+
+const GFXglyph DejaVuSans_Bold6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   2,   9,   5,    2,   -8 },   // 0x21 '!'
+  {     4,   3,   3,   6,    1,   -8 },   // 0x22 '"'
+  {     6,   8,   9,  10,    1,   -8 },   // 0x23 '#'
+  {    15,   7,  11,   8,    1,   -8 },   // 0x24 '$'
+  {    25,  11,   9,  12,    1,   -8 },   // 0x25 '%'
+  {    38,   9,   9,  10,    1,   -8 },   // 0x26 '&'
+  {    49,   1,   3,   4,    1,   -8 },   // 0x27 '''
+  {    50,   4,  11,   5,    1,   -9 },   // 0x28 '('
+  {    56,   4,  11,   5,    0,   -9 },   // 0x29 ')'
+  {    62,   5,   6,   6,    1,   -8 },   // 0x2A '*'
+  {    66,   7,   7,  10,    1,   -6 },   // 0x2B '+'
+  {    73,   3,   4,   5,    0,   -1 },   // 0x2C ','
+  {    75,   4,   2,   5,    1,   -3 },   // 0x2D '-'
+  {    76,   2,   2,   5,    1,   -1 },   // 0x2E '.'
+  {    77,   4,  10,   4,    0,   -8 },   // 0x2F '/'
+  {    82,   7,   9,   8,    1,   -8 },   // 0x30 '0'
+  {    90,   6,   9,   8,    1,   -8 },   // 0x31 '1'
+  {    97,   7,   9,   8,    1,   -8 },   // 0x32 '2'
+  {   105,   7,   9,   8,    1,   -8 },   // 0x33 '3'
+  {   113,   7,   9,   8,    1,   -8 },   // 0x34 '4'
+  {   121,   7,   9,   8,    1,   -8 },   // 0x35 '5'
+  {   129,   7,   9,   8,    1,   -8 },   // 0x36 '6'
+  {   137,   7,   9,   8,    1,   -8 },   // 0x37 '7'
+  {   145,   7,   9,   8,    1,   -8 },   // 0x38 '8'
+  {   153,   7,   9,   8,    1,   -8 },   // 0x39 '9'
+  {   161,   2,   7,   5,    1,   -6 },   // 0x3A ':'
+  {   163,   3,   9,   5,    0,   -6 },   // 0x3B ';'
+  {   167,   8,   7,  10,    1,   -6 },   // 0x3C '<'
+  {   174,   8,   3,  10,    1,   -4 },   // 0x3D '='
+  {   177,   8,   7,  10,    1,   -6 },   // 0x3E '>'
+  {   184,   5,   9,   7,    1,   -8 },   // 0x3F '?'
+  {   190,  10,  11,  12,    1,   -8 },   // 0x40 '@'
+  {   204,   9,   9,   9,    0,   -8 },   // 0x41 'A'
+  {   215,   7,   9,   9,    1,   -8 },   // 0x42 'B'
+  {   223,   7,   9,   9,    1,   -8 },   // 0x43 'C'
+  {   231,   8,   9,  10,    1,   -8 },   // 0x44 'D'
+  {   240,   6,   9,   8,    1,   -8 },   // 0x45 'E'
+  {   247,   6,   9,   8,    1,   -8 },   // 0x46 'F'
+  {   254,   8,   9,  10,    1,   -8 },   // 0x47 'G'
+  {   263,   8,   9,  10,    1,   -8 },   // 0x48 'H'
+  {   272,   2,   9,   4,    1,   -8 },   // 0x49 'I'
+  {   275,   4,  11,   4,   -1,   -8 },   // 0x4A 'J'
+  {   281,   9,   9,   9,    1,   -8 },   // 0x4B 'K'
+  {   292,   6,   9,   8,    1,   -8 },   // 0x4C 'L'
+  {   299,  10,   9,  12,    1,   -8 },   // 0x4D 'M'
+  {   311,   8,   9,  10,    1,   -8 },   // 0x4E 'N'
+  {   320,   9,   9,  11,    1,   -8 },   // 0x4F 'O'
+  {   331,   7,   9,   9,    1,   -8 },   // 0x50 'P'
+  {   339,   9,  11,  10,    1,   -8 },   // 0x51 'Q'
+  {   352,   8,   9,   9,    1,   -8 },   // 0x52 'R'
+  {   361,   7,   9,   9,    1,   -8 },   // 0x53 'S'
+  {   369,   8,   9,   8,    0,   -8 },   // 0x54 'T'
+  {   378,   8,   9,  10,    1,   -8 },   // 0x55 'U'
+  {   387,   9,   9,   9,    0,   -8 },   // 0x56 'V'
+  {   398,  12,   9,  14,    1,   -8 },   // 0x57 'W'
+  {   412,   9,   9,   9,    0,   -8 },   // 0x58 'X'
+  {   423,   8,   9,   8,    0,   -8 },   // 0x59 'Y'
+  {   432,   8,   9,  10,    1,   -8 },   // 0x5A 'Z'
+  {   441,   4,  11,   5,    1,   -9 },   // 0x5B '['
+  {   447,   4,  10,   4,    0,   -8 },   // 0x5C '\'
+  {   452,   4,  11,   5,    0,   -9 },   // 0x5D ']'
+  {   458,   8,   3,  10,    1,   -8 },   // 0x5E '^'
+  {   461,   6,   1,   6,    0,    3 },   // 0x5F '_'
+  {   462,   3,   2,   6,    1,   -9 },   // 0x60 '`'
+  {   463,   7,   7,   9,    1,   -6 },   // 0x61 'a'
+  {   470,   7,  10,   9,    1,   -9 },   // 0x62 'b'
+  {   479,   6,   7,   7,    1,   -6 },   // 0x63 'c'
+  {   485,   7,  10,   9,    1,   -9 },   // 0x64 'd'
+  {   494,   7,   7,   9,    1,   -6 },   // 0x65 'e'
+  {   501,   5,  10,   5,    0,   -9 },   // 0x66 'f'
+  {   508,   7,  10,   9,    1,   -6 },   // 0x67 'g'
+  {   517,   7,  10,   9,    1,   -9 },   // 0x68 'h'
+  {   526,   2,  10,   4,    1,   -9 },   // 0x69 'i'
+  {   529,   3,  13,   4,    0,   -9 },   // 0x6A 'j'
+  {   534,   7,  10,   8,    1,   -9 },   // 0x6B 'k'
+  {   543,   2,  10,   4,    1,   -9 },   // 0x6C 'l'
+  {   546,  10,   7,  12,    1,   -6 },   // 0x6D 'm'
+  {   555,   7,   7,   9,    1,   -6 },   // 0x6E 'n'
+  {   562,   7,   7,   9,    1,   -6 },   // 0x6F 'o'
+  {   569,   7,  10,   9,    1,   -6 },   // 0x70 'p'
+  {   578,   7,  10,   9,    1,   -6 },   // 0x71 'q'
+  {   587,   5,   7,   6,    1,   -6 },   // 0x72 'r'
+  {   592,   6,   7,   8,    1,   -6 },   // 0x73 's'
+  {   598,   5,   9,   6,    0,   -8 },   // 0x74 't'
+  {   604,   7,   7,   9,    1,   -6 },   // 0x75 'u'
+  {   611,   7,   7,   7,    0,   -6 },   // 0x76 'v'
+  {   618,  10,   7,  12,    1,   -6 },   // 0x77 'w'
+  {   627,   7,   7,   7,    0,   -6 },   // 0x78 'x'
+  {   634,   7,  10,   8,    0,   -6 },   // 0x79 'y'
+  {   643,   6,   7,   8,    1,   -6 },   // 0x7A 'z'
+  {   649,   6,  11,   9,    1,   -9 },   // 0x7B '{'
+  {   658,   1,  12,   4,    2,   -8 },   // 0x7C '|'
+  {   660,   6,  11,   9,    1,   -9 },   // 0x7D '}'
+  {   669,   8,   2,  10,    1,   -4 },   // 0x7E '~'
+  {   671,   6,  11,   7,    1,   -7 },   // 0x7F
+  {   680,   6,  11,   7,    1,   -7 },   // 0x80
+  {   689,   6,  11,   7,    1,   -7 },   // 0x81
+  {   698,   6,  11,   7,    1,   -7 },   // 0x82
+  {   707,   6,  11,   7,    1,   -7 },   // 0x83
+  {   716,   6,  11,   7,    1,   -7 },   // 0x84
+  {   725,   6,  11,   7,    1,   -7 },   // 0x85
+  {   734,   6,  11,   7,    1,   -7 },   // 0x86
+  {   743,   6,  11,   7,    1,   -7 },   // 0x87
+  {   752,   6,  11,   7,    1,   -7 },   // 0x88
+  {   761,   6,  11,   7,    1,   -7 },   // 0x89
+  {   770,   6,  11,   7,    1,   -7 },   // 0x8A
+  {   779,   6,  11,   7,    1,   -7 },   // 0x8B
+  {   788,   6,  11,   7,    1,   -7 },   // 0x8C
+  {   797,   6,  11,   7,    1,   -7 },   // 0x8D
+  {   806,   6,  11,   7,    1,   -7 },   // 0x8E
+  {   815,   6,  11,   7,    1,   -7 },   // 0x8F
+  {   824,   6,  11,   7,    1,   -7 },   // 0x90
+  {   833,   6,  11,   7,    1,   -7 },   // 0x91
+  {   842,   6,  11,   7,    1,   -7 },   // 0x92
+  {   851,   6,  11,   7,    1,   -7 },   // 0x93
+  {   860,   6,  11,   7,    1,   -7 },   // 0x94
+  {   869,   6,  11,   7,    1,   -7 },   // 0x95
+  {   878,   6,  11,   7,    1,   -7 },   // 0x96
+  {   887,   6,  11,   7,    1,   -7 },   // 0x97
+  {   896,   6,  11,   7,    1,   -7 },   // 0x98
+  {   905,   6,  11,   7,    1,   -7 },   // 0x99
+  {   914,   6,  11,   7,    1,   -7 },   // 0x9A
+  {   923,   6,  11,   7,    1,   -7 },   // 0x9B
+  {   932,   6,  11,   7,    1,   -7 },   // 0x9C
+  {   941,   6,  11,   7,    1,   -7 },   // 0x9D
+  {   950,   6,  11,   7,    1,   -7 },   // 0x9E
+  {   959,   6,  11,   7,    1,   -7 },   // 0x9F
+  {   968,   1,   1,   4,    0,    0 },   // 0xA0
+  {   969,   2,   9,   5,    2,   -6 },   // 0xA1
+  {   972,   6,  11,   8,    1,   -8 },   // 0xA2
+  {   981,   6,   9,   8,    1,   -8 },   // 0xA3
+  {   988,   7,   7,   8,    0,   -6 },   // 0xA4
+  {   995,   8,   9,   8,    0,   -8 },   // 0xA5
+  {  1004,   1,  10,   4,    2,   -7 },   // 0xA6
+  {  1006,   6,  10,   6,    1,   -8 },   // 0xA7
+  {  1014,   3,   1,   6,    2,   -8 },   // 0xA8
+  {  1015,   9,   9,  12,    2,   -8 },   // 0xA9
+  {  1026,   5,   7,   7,    1,   -8 },   // 0xAA
+  {  1031,   6,   5,   8,    1,   -5 },   // 0xAB
+  {  1035,   8,   4,  10,    1,   -4 },   // 0xAC
+  {  1039,   4,   2,   5,    1,   -3 },   // 0xAD
+  {  1040,   9,   9,  12,    2,   -8 },   // 0xAE
+  {  1051,   4,   1,   6,    1,   -8 },   // 0xAF
+  {  1052,   4,   4,   6,    1,   -8 },   // 0xB0
+  {  1054,   7,   7,  10,    1,   -6 },   // 0xB1
+  {  1061,   4,   5,   5,    1,   -8 },   // 0xB2
+  {  1064,   4,   5,   5,    1,   -8 },   // 0xB3
+  {  1067,   3,   2,   6,    2,   -9 },   // 0xB4
+  {  1068,   8,  10,   9,    1,   -6 },   // 0xB5
+  {  1078,   6,  10,   8,    0,   -8 },   // 0xB6
+  {  1086,   2,   2,   5,    1,   -4 },   // 0xB7
+  {  1087,   3,   2,   6,    2,    1 },   // 0xB8
+  {  1088,   3,   5,   5,    1,   -8 },   // 0xB9
+  {  1090,   5,   7,   7,    1,   -8 },   // 0xBA
+  {  1095,   6,   5,   8,    1,   -5 },   // 0xBB
+  {  1099,  11,   9,  12,    1,   -8 },   // 0xBC
+  {  1112,  11,   9,  12,    1,   -8 },   // 0xBD
+  {  1125,  11,   9,  12,    1,   -8 },   // 0xBE
+  {  1138,   5,  10,   7,    1,   -6 },   // 0xBF
+  {  1145,   9,  12,   9,    0,  -11 },   // 0xC0
+  {  1159,   9,  12,   9,    0,  -11 },   // 0xC1
+  {  1173,   9,  12,   9,    0,  -11 },   // 0xC2
+  {  1187,   9,  12,   9,    0,  -11 },   // 0xC3
+  {  1201,   9,  11,   9,    0,  -10 },   // 0xC4
+  {  1214,   9,  11,   9,    0,  -10 },   // 0xC5
+  {  1227,  12,   9,  13,    0,   -8 },   // 0xC6
+  {  1241,   7,  11,   9,    1,   -8 },   // 0xC7
+  {  1251,   6,  12,   8,    1,  -11 },   // 0xC8
+  {  1260,   6,  12,   8,    1,  -11 },   // 0xC9
+  {  1269,   6,  12,   8,    1,  -11 },   // 0xCA
+  {  1278,   6,  11,   8,    1,  -10 },   // 0xCB
+  {  1287,   3,  12,   4,    0,  -11 },   // 0xCC
+  {  1292,   3,  12,   4,    1,  -11 },   // 0xCD
+  {  1297,   4,  12,   4,    0,  -11 },   // 0xCE
+  {  1303,   4,  11,   4,    0,  -10 },   // 0xCF
+  {  1309,   9,   9,  10,    0,   -8 },   // 0xD0
+  {  1320,   8,  12,  10,    1,  -11 },   // 0xD1
+  {  1332,   9,  12,  11,    1,  -11 },   // 0xD2
+  {  1346,   9,  12,  11,    1,  -11 },   // 0xD3
+  {  1360,   9,  12,  11,    1,  -11 },   // 0xD4
+  {  1374,   9,  12,  11,    1,  -11 },   // 0xD5
+  {  1388,   9,  11,  11,    1,  -10 },   // 0xD6
+  {  1401,   7,   7,  10,    2,   -6 },   // 0xD7
+  {  1408,  10,   9,  11,    0,   -8 },   // 0xD8
+  {  1420,   8,  12,  10,    1,  -11 },   // 0xD9
+  {  1432,   8,  12,  10,    1,  -11 },   // 0xDA
+  {  1444,   8,  12,  10,    1,  -11 },   // 0xDB
+  {  1456,   8,  11,  10,    1,  -10 },   // 0xDC
+  {  1467,   8,  12,   8,    0,  -11 },   // 0xDD
+  {  1479,   7,   9,   9,    1,   -8 },   // 0xDE
+  {  1487,   7,  10,   9,    1,   -9 },   // 0xDF
+  {  1496,   7,  10,   9,    1,   -9 },   // 0xE0
+  {  1505,   7,  10,   9,    1,   -9 },   // 0xE1
+  {  1514,   7,  10,   9,    1,   -9 },   // 0xE2
+  {  1523,   7,  10,   9,    1,   -9 },   // 0xE3
+  {  1532,   7,   9,   9,    1,   -8 },   // 0xE4
+  {  1540,   7,  11,   9,    1,  -10 },   // 0xE5
+  {  1550,  12,   7,  14,    1,   -6 },   // 0xE6
+  {  1561,   6,   9,   7,    1,   -6 },   // 0xE7
+  {  1568,   7,  10,   9,    1,   -9 },   // 0xE8
+  {  1577,   7,  10,   9,    1,   -9 },   // 0xE9
+  {  1586,   7,  10,   9,    1,   -9 },   // 0xEA
+  {  1595,   7,   9,   9,    1,   -8 },   // 0xEB
+  {  1603,   3,  10,   4,    0,   -9 },   // 0xEC
+  {  1607,   3,  10,   4,    1,   -9 },   // 0xED
+  {  1611,   4,  10,   4,    0,   -9 },   // 0xEE
+  {  1616,   4,   9,   4,    0,   -8 },   // 0xEF
+  {  1621,   7,  10,   9,    1,   -9 },   // 0xF0
+  {  1630,   7,  10,   9,    1,   -9 },   // 0xF1
+  {  1639,   7,  10,   9,    1,   -9 },   // 0xF2
+  {  1648,   7,  10,   9,    1,   -9 },   // 0xF3
+  {  1657,   7,  10,   9,    1,   -9 },   // 0xF4
+  {  1666,   7,  10,   9,    1,   -9 },   // 0xF5
+  {  1675,   7,   9,   9,    1,   -8 },   // 0xF6
+  {  1683,   8,   7,  10,    1,   -6 },   // 0xF7
+  {  1690,   7,   7,   9,    1,   -6 },   // 0xF8
+  {  1697,   7,  10,   9,    1,   -9 },   // 0xF9
+  {  1706,   7,  10,   9,    1,   -9 },   // 0xFA
+  {  1715,   7,  10,   9,    1,   -9 },   // 0xFB
+  {  1724,   7,   9,   9,    1,   -8 },   // 0xFC
+  {  1732,   7,  13,   8,    0,   -9 },   // 0xFD
+  {  1744,   7,  13,   9,    1,   -9 },   // 0xFE
+  {  1756,   7,  12,   8,    0,   -8 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold6pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold6pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold6pt8bGlyphs,
+  0x20, 0xFF, 14 };
+
+// Approx. 3342 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold6pt8bMetrics[] PROGMEM = {
+  {   0,   4,   1 },   // 0x20
+  {   2,   5,   4 },   // 0x21
+  {   1,   6,   4 },   // 0x22
+  {   1,  10,   9 },   // 0x23
+  {   1,   8,   8 },   // 0x24
+  {   1,  12,  12 },   // 0x25
+  {   1,  10,  10 },   // 0x26
+  {   1,   4,   2 },   // 0x27
+  {   1,   5,   5 },   // 0x28
+  {   0,   5,   4 },   // 0x29
+  {   1,   6,   6 },   // 0x2A
+  {   1,  10,   8 },   // 0x2B
+  {   0,   5,   3 },   // 0x2C
+  {   1,   5,   5 },   // 0x2D
+  {   1,   5,   3 },   // 0x2E
+  {   0,   4,   4 },   // 0x2F
+  {   1,   8,   8 },   // 0x30
+  {   1,   8,   7 },   // 0x31
+  {   1,   8,   8 },   // 0x32
+  {   1,   8,   8 },   // 0x33
+  {   1,   8,   8 },   // 0x34
+  {   1,   8,   8 },   // 0x35
+  {   1,   8,   8 },   // 0x36
+  {   1,   8,   8 },   // 0x37
+  {   1,   8,   8 },   // 0x38
+  {   1,   8,   8 },   // 0x39
+  {   1,   5,   3 },   // 0x3A
+  {   0,   5,   3 },   // 0x3B
+  {   1,  10,   9 },   // 0x3C
+  {   1,  10,   9 },   // 0x3D
+  {   1,  10,   9 },   // 0x3E
+  {   1,   7,   6 },   // 0x3F
+  {   1,  12,  11 },   // 0x40
+  {   0,   9,   9 },   // 0x41
+  {   1,   9,   8 },   // 0x42
+  {   1,   9,   8 },   // 0x43
+  {   1,  10,   9 },   // 0x44
+  {   1,   8,   7 },   // 0x45
+  {   1,   8,   7 },   // 0x46
+  {   1,  10,   9 },   // 0x47
+  {   1,  10,   9 },   // 0x48
+  {   1,   4,   3 },   // 0x49
+  {  -1,   4,   3 },   // 0x4A
+  {   1,   9,  10 },   // 0x4B
+  {   1,   8,   7 },   // 0x4C
+  {   1,  12,  11 },   // 0x4D
+  {   1,  10,   9 },   // 0x4E
+  {   1,  11,  10 },   // 0x4F
+  {   1,   9,   8 },   // 0x50
+  {   1,  10,  10 },   // 0x51
+  {   1,   9,   9 },   // 0x52
+  {   1,   9,   8 },   // 0x53
+  {   0,   8,   8 },   // 0x54
+  {   1,  10,   9 },   // 0x55
+  {   0,   9,   9 },   // 0x56
+  {   1,  14,  13 },   // 0x57
+  {   0,   9,   9 },   // 0x58
+  {   0,   8,   8 },   // 0x59
+  {   1,  10,   9 },   // 0x5A
+  {   1,   5,   5 },   // 0x5B
+  {   0,   4,   4 },   // 0x5C
+  {   0,   5,   4 },   // 0x5D
+  {   1,  10,   9 },   // 0x5E
+  {   0,   6,   6 },   // 0x5F
+  {   1,   6,   4 },   // 0x60
+  {   1,   9,   8 },   // 0x61
+  {   1,   9,   8 },   // 0x62
+  {   1,   7,   7 },   // 0x63
+  {   1,   9,   8 },   // 0x64
+  {   1,   9,   8 },   // 0x65
+  {   0,   5,   5 },   // 0x66
+  {   1,   9,   8 },   // 0x67
+  {   1,   9,   8 },   // 0x68
+  {   1,   4,   3 },   // 0x69
+  {   0,   4,   3 },   // 0x6A
+  {   1,   8,   8 },   // 0x6B
+  {   1,   4,   3 },   // 0x6C
+  {   1,  12,  11 },   // 0x6D
+  {   1,   9,   8 },   // 0x6E
+  {   1,   9,   8 },   // 0x6F
+  {   1,   9,   8 },   // 0x70
+  {   1,   9,   8 },   // 0x71
+  {   1,   6,   6 },   // 0x72
+  {   1,   8,   7 },   // 0x73
+  {   0,   6,   5 },   // 0x74
+  {   1,   9,   8 },   // 0x75
+  {   0,   7,   7 },   // 0x76
+  {   1,  12,  11 },   // 0x77
+  {   0,   7,   7 },   // 0x78
+  {   0,   8,   7 },   // 0x79
+  {   1,   8,   7 },   // 0x7A
+  {   1,   9,   7 },   // 0x7B
+  {   2,   4,   3 },   // 0x7C
+  {   1,   9,   7 },   // 0x7D
+  {   1,  10,   9 },   // 0x7E
+  {   1,   7,   7 },   // 0x7F
+  {   1,   7,   7 },   // 0x80
+  {   1,   7,   7 },   // 0x81
+  {   1,   7,   7 },   // 0x82
+  {   1,   7,   7 },   // 0x83
+  {   1,   7,   7 },   // 0x84
+  {   1,   7,   7 },   // 0x85
+  {   1,   7,   7 },   // 0x86
+  {   1,   7,   7 },   // 0x87
+  {   1,   7,   7 },   // 0x88
+  {   1,   7,   7 },   // 0x89
+  {   1,   7,   7 },   // 0x8A
+  {   1,   7,   7 },   // 0x8B
+  {   1,   7,   7 },   // 0x8C
+  {   1,   7,   7 },   // 0x8D
+  {   1,   7,   7 },   // 0x8E
+  {   1,   7,   7 },   // 0x8F
+  {   1,   7,   7 },   // 0x90
+  {   1,   7,   7 },   // 0x91
+  {   1,   7,   7 },   // 0x92
+  {   1,   7,   7 },   // 0x93
+  {   1,   7,   7 },   // 0x94
+  {   1,   7,   7 },   // 0x95
+  {   1,   7,   7 },   // 0x96
+  {   1,   7,   7 },   // 0x97
+  {   1,   7,   7 },   // 0x98
+  {   1,   7,   7 },   // 0x99
+  {   1,   7,   7 },   // 0x9A
+  {   1,   7,   7 },   // 0x9B
+  {   1,   7,   7 },   // 0x9C
+  {   1,   7,   7 },   // 0x9D
+  {   1,   7,   7 },   // 0x9E
+  {   1,   7,   7 },   // 0x9F
+  {   0,   4,   1 },   // 0xA0
+  {   2,   5,   4 },   // 0xA1
+  {   1,   8,   7 },   // 0xA2
+  {   1,   8,   7 },   // 0xA3
+  {   0,   8,   7 },   // 0xA4
+  {   0,   8,   8 },   // 0xA5
+  {   2,   4,   3 },   // 0xA6
+  {   1,   6,   7 },   // 0xA7
+  {   2,   6,   5 },   // 0xA8
+  {   2,  12,  11 },   // 0xA9
+  {   1,   7,   6 },   // 0xAA
+  {   1,   8,   7 },   // 0xAB
+  {   1,  10,   9 },   // 0xAC
+  {   1,   5,   5 },   // 0xAD
+  {   2,  12,  11 },   // 0xAE
+  {   1,   6,   5 },   // 0xAF
+  {   1,   6,   5 },   // 0xB0
+  {   1,  10,   8 },   // 0xB1
+  {   1,   5,   5 },   // 0xB2
+  {   1,   5,   5 },   // 0xB3
+  {   2,   6,   5 },   // 0xB4
+  {   1,   9,   9 },   // 0xB5
+  {   0,   8,   6 },   // 0xB6
+  {   1,   5,   3 },   // 0xB7
+  {   2,   6,   5 },   // 0xB8
+  {   1,   5,   4 },   // 0xB9
+  {   1,   7,   6 },   // 0xBA
+  {   1,   8,   7 },   // 0xBB
+  {   1,  12,  12 },   // 0xBC
+  {   1,  12,  12 },   // 0xBD
+  {   1,  12,  12 },   // 0xBE
+  {   1,   7,   6 },   // 0xBF
+  {   0,   9,   9 },   // 0xC0
+  {   0,   9,   9 },   // 0xC1
+  {   0,   9,   9 },   // 0xC2
+  {   0,   9,   9 },   // 0xC3
+  {   0,   9,   9 },   // 0xC4
+  {   0,   9,   9 },   // 0xC5
+  {   0,  13,  12 },   // 0xC6
+  {   1,   9,   8 },   // 0xC7
+  {   1,   8,   7 },   // 0xC8
+  {   1,   8,   7 },   // 0xC9
+  {   1,   8,   7 },   // 0xCA
+  {   1,   8,   7 },   // 0xCB
+  {   0,   4,   3 },   // 0xCC
+  {   1,   4,   4 },   // 0xCD
+  {   0,   4,   4 },   // 0xCE
+  {   0,   4,   4 },   // 0xCF
+  {   0,  10,   9 },   // 0xD0
+  {   1,  10,   9 },   // 0xD1
+  {   1,  11,  10 },   // 0xD2
+  {   1,  11,  10 },   // 0xD3
+  {   1,  11,  10 },   // 0xD4
+  {   1,  11,  10 },   // 0xD5
+  {   1,  11,  10 },   // 0xD6
+  {   2,  10,   9 },   // 0xD7
+  {   0,  11,  10 },   // 0xD8
+  {   1,  10,   9 },   // 0xD9
+  {   1,  10,   9 },   // 0xDA
+  {   1,  10,   9 },   // 0xDB
+  {   1,  10,   9 },   // 0xDC
+  {   0,   8,   8 },   // 0xDD
+  {   1,   9,   8 },   // 0xDE
+  {   1,   9,   8 },   // 0xDF
+  {   1,   9,   8 },   // 0xE0
+  {   1,   9,   8 },   // 0xE1
+  {   1,   9,   8 },   // 0xE2
+  {   1,   9,   8 },   // 0xE3
+  {   1,   9,   8 },   // 0xE4
+  {   1,   9,   8 },   // 0xE5
+  {   1,  14,  13 },   // 0xE6
+  {   1,   7,   7 },   // 0xE7
+  {   1,   9,   8 },   // 0xE8
+  {   1,   9,   8 },   // 0xE9
+  {   1,   9,   8 },   // 0xEA
+  {   1,   9,   8 },   // 0xEB
+  {   0,   4,   3 },   // 0xEC
+  {   1,   4,   4 },   // 0xED
+  {   0,   4,   4 },   // 0xEE
+  {   0,   4,   4 },   // 0xEF
+  {   1,   9,   8 },   // 0xF0
+  {   1,   9,   8 },   // 0xF1
+  {   1,   9,   8 },   // 0xF2
+  {   1,   9,   8 },   // 0xF3
+  {   1,   9,   8 },   // 0xF4
+  {   1,   9,   8 },   // 0xF5
+  {   1,   9,   8 },   // 0xF6
+  {   1,  10,   9 },   // 0xF7
+  {   1,   9,   8 },   // 0xF8
+  {   1,   9,   8 },   // 0xF9
+  {   1,   9,   8 },   // 0xFA
+  {   1,   9,   8 },   // 0xFB
+  {   1,   9,   8 },   // 0xFC
+  {   0,   8,   7 },   // 0xFD
+  {   1,   9,   8 },   // 0xFE
+  {   0,   8,   7 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold6pt8bWidths = { DejaVuSans_Bold6pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD6PTLAT1__H
@@ -0,0 +1,658 @@
+#ifndef DEJAVUSANSBOLD7PTLAT1__H
+#define DEJAVUSANSBOLD7PTLAT1__H
+const uint8_t DejaVuSans_Bold7pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFC, 0xF0, 0xDE, 0xF7, 0xB0, 0x09, 0x86, 0x41, 0x91, 0xFF,
+  0x13, 0x0C, 0x8F, 0xF8, 0x98, 0x26, 0x19, 0x00, 0x10, 0x21, 0xE6, 0xAD,
+  0x1E, 0x1F, 0x0F, 0x17, 0x2D, 0xF0, 0x81, 0x00, 0x70, 0x66, 0xC6, 0x36,
+  0x71, 0xB7, 0x0D, 0xB7, 0x3B, 0x6C, 0x3B, 0x63, 0x9B, 0x18, 0xD9, 0x83,
+  0x80, 0x1E, 0x06, 0x20, 0xC0, 0x1C, 0x06, 0xC7, 0x8C, 0xF0, 0xD6, 0x0E,
+  0x63, 0xC7, 0xCC, 0xFF, 0x76, 0x6C, 0xCC, 0xCC, 0xC6, 0x67, 0xE6, 0x63,
+  0x33, 0x33, 0x36, 0x6E, 0x11, 0x25, 0xF1, 0xC7, 0xD2, 0x44, 0x00, 0x18,
+  0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x6D, 0xA8, 0xFF, 0xFC, 0x18,
+  0xC4, 0x63, 0x10, 0x8C, 0x62, 0x31, 0x80, 0x3C, 0x66, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x72, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x33,
+  0xF0, 0x7D, 0x1C, 0x18, 0x30, 0xE3, 0x8E, 0x38, 0xE1, 0xFC, 0x7E, 0x83,
+  0x03, 0x03, 0x3E, 0x07, 0x03, 0x03, 0x87, 0x7C, 0x0E, 0x16, 0x26, 0x66,
+  0xC6, 0x86, 0xFF, 0x06, 0x06, 0x06, 0xFE, 0xC0, 0xC0, 0xFC, 0x86, 0x03,
+  0x03, 0x03, 0x86, 0x7C, 0x3C, 0x62, 0xC0, 0xFC, 0xE6, 0xC3, 0xC3, 0xC3,
+  0x66, 0x3C, 0xFF, 0x03, 0x06, 0x06, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x30,
+  0x7E, 0xC3, 0xC3, 0xC3, 0x3C, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x66,
+  0xC3, 0xC3, 0xC3, 0x67, 0x3F, 0x03, 0x46, 0x3C, 0xFC, 0x3F, 0x6D, 0x80,
+  0xDB, 0x50, 0x00, 0x83, 0xCF, 0x9E, 0x0F, 0x01, 0xF0, 0x1E, 0x01, 0xFF,
+  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x80, 0x78, 0x0F, 0x80, 0xF0, 0x79,
+  0xF3, 0xC1, 0x00, 0x7A, 0x30, 0xC7, 0x39, 0xC6, 0x00, 0x61, 0x80, 0x0F,
+  0x83, 0x04, 0x40, 0x24, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x4F,
+  0xC4, 0x00, 0x30, 0xC0, 0xF8, 0x0E, 0x01, 0xC0, 0x6C, 0x0D, 0x83, 0x18,
+  0x63, 0x0F, 0xE3, 0x06, 0x60, 0xD8, 0x0C, 0xFE, 0xC3, 0xC3, 0xC3, 0xFE,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0x1F, 0xB8, 0x58, 0x18, 0x0C, 0x06, 0x03,
+  0x00, 0xC0, 0x70, 0x8F, 0xC0, 0xFC, 0x63, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F,
+  0x07, 0x86, 0xC7, 0x7E, 0x00, 0xFF, 0x83, 0x06, 0x0F, 0xF8, 0x30, 0x60,
+  0xC1, 0xFC, 0xFF, 0x83, 0x06, 0x0F, 0xF8, 0x30, 0x60, 0xC1, 0x80, 0x1F,
+  0x9C, 0x26, 0x03, 0x00, 0xC3, 0xF0, 0x3C, 0x0D, 0x83, 0x70, 0xC7, 0xF0,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3F, 0xFE, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xC0,
+  0xFF, 0xFF, 0xF0, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE0, 0xC3, 0x31,
+  0x8C, 0xC3, 0x60, 0xF0, 0x36, 0x0C, 0xC3, 0x18, 0xC3, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xFC, 0xE0, 0xFE, 0x3F, 0xC7,
+  0xED, 0xBD, 0xB7, 0x9C, 0xF3, 0x9E, 0x23, 0xC0, 0x78, 0x0C, 0xE1, 0xF0,
+  0xFC, 0x7A, 0x3D, 0x9E, 0x6F, 0x37, 0x8F, 0xC3, 0xE1, 0xC0, 0x1E, 0x18,
+  0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x87, 0x80, 0xFC,
+  0xC7, 0xC3, 0xC3, 0xC3, 0xC7, 0xFC, 0xC0, 0xC0, 0xC0, 0x1E, 0x18, 0x66,
+  0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x86, 0x61, 0x87, 0x80, 0x30, 0x06,
+  0xFE, 0x61, 0xB0, 0xD8, 0x6C, 0x77, 0xF3, 0x19, 0x86, 0xC3, 0x60, 0xC0,
+  0x7E, 0xC2, 0xC0, 0xF0, 0x7E, 0x1F, 0x03, 0x03, 0x83, 0xFE, 0xFF, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x63, 0x1F, 0x00, 0xC0, 0x6C, 0x19, 0x83,
+  0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0xC7, 0x1E,
+  0x38, 0xF1, 0xC6, 0xCA, 0x66, 0xDB, 0x36, 0xD9, 0xA2, 0xC7, 0x1C, 0x38,
+  0xE1, 0xC7, 0x00, 0xE1, 0xD8, 0x63, 0x30, 0xCC, 0x1E, 0x07, 0x83, 0x30,
+  0xCC, 0x61, 0xB8, 0x70, 0xE1, 0xD8, 0x63, 0x30, 0xCC, 0x1E, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x7F, 0xC0, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xC6,
+  0x10, 0xC6, 0x10, 0x86, 0x30, 0x86, 0x30, 0xF3, 0x33, 0x33, 0x33, 0x33,
+  0x3F, 0x1C, 0x1F, 0x1D, 0xD8, 0x30, 0xFE, 0xC6, 0x30, 0x3C, 0x8C, 0x1B,
+  0xFC, 0x78, 0xF3, 0xBB, 0xC0, 0xC0, 0xC0, 0xDC, 0xE6, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xE6, 0xDC, 0x3C, 0xC7, 0x06, 0x0C, 0x18, 0x18, 0x9E, 0x03, 0x03,
+  0x03, 0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x3C, 0x66, 0xC3,
+  0xFF, 0xC0, 0xC0, 0x61, 0x3E, 0x3B, 0x19, 0xF6, 0x31, 0x8C, 0x63, 0x18,
+  0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x03, 0x46, 0x3C, 0xC0,
+  0xC0, 0xC0, 0xDE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xF3, 0xFF,
+  0xFC, 0x33, 0x03, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xC0, 0x60, 0x30, 0x18,
+  0xCC, 0xC6, 0xC3, 0xC1, 0xB0, 0xCC, 0x63, 0x30, 0xC0, 0xFF, 0xFF, 0xFC,
+  0xDD, 0xEE, 0x73, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63,
+  0xDE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x66, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0xDC, 0xE6, 0xC3, 0xC3, 0xC3, 0xC3, 0xE6, 0xDC,
+  0xC0, 0xC0, 0xC0, 0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x03,
+  0x03, 0x03, 0xDF, 0x8C, 0x30, 0xC3, 0x0C, 0x30, 0x7D, 0x87, 0x07, 0xE7,
+  0xE0, 0xE1, 0xBE, 0x63, 0x3E, 0xC6, 0x31, 0x8C, 0x61, 0xC0, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0xC1, 0xB1, 0x98, 0xCC, 0x63, 0x61,
+  0xB0, 0x70, 0x38, 0xC6, 0x3C, 0x63, 0x66, 0x66, 0xF6, 0x6F, 0x62, 0x94,
+  0x39, 0xC3, 0x9C, 0xE3, 0xB1, 0x8D, 0x83, 0x81, 0xC1, 0xB1, 0x8D, 0xC7,
+  0xC1, 0xB1, 0x98, 0xCC, 0x63, 0x61, 0xB0, 0x58, 0x38, 0x0C, 0x0E, 0x1E,
+  0x00, 0xFE, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x7F, 0x1C, 0xC3, 0x0C, 0x30,
+  0xCE, 0x0C, 0x30, 0xC3, 0x0C, 0x1C, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xC3,
+  0x0C, 0x30, 0xC1, 0xCC, 0x30, 0xC3, 0x0C, 0xE0, 0x78, 0xFF, 0xE3, 0xC0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0x00, 0xF3, 0xFF, 0xF0, 0x10, 0x43, 0x9D, 0xD3, 0x4D,
+  0x34, 0x74, 0xE1, 0x04, 0x1E, 0x31, 0x30, 0x30, 0x7E, 0x30, 0x30, 0x30,
+  0x30, 0xFF, 0x82, 0x7F, 0x66, 0x42, 0x42, 0x66, 0x7E, 0x80, 0xE7, 0x66,
+  0x3C, 0xFF, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xC3, 0xFF, 0x3C,
+  0xC9, 0x81, 0xCE, 0xF8, 0xFB, 0x9C, 0x0C, 0x99, 0xE0, 0xDE, 0xC0, 0x1E,
+  0x18, 0x65, 0xEA, 0xC9, 0xA0, 0x68, 0x1B, 0x05, 0x7A, 0x61, 0x87, 0x80,
+  0xF8, 0x37, 0xF3, 0xCD, 0xF0, 0x3F, 0x25, 0xBD, 0xB6, 0x6C, 0x90, 0xFF,
+  0xFF, 0xC0, 0x60, 0x30, 0xFF, 0x1E, 0x18, 0x65, 0xEA, 0x49, 0x9E, 0x65,
+  0x99, 0x25, 0x4A, 0x61, 0x87, 0x80, 0xF0, 0x74, 0x63, 0x17, 0x00, 0x0C,
+  0x03, 0x0F, 0xFF, 0xFF, 0x0C, 0x03, 0x0F, 0xFF, 0xFF, 0xF4, 0xC6, 0x66,
+  0x7C, 0xF8, 0xDC, 0x39, 0xF8, 0x36, 0xC0, 0xC3, 0x61, 0xB0, 0xD8, 0x6C,
+  0x36, 0x1B, 0x0D, 0xFF, 0xC0, 0x60, 0x30, 0x00, 0x7F, 0xDF, 0x7D, 0xF5,
+  0xD1, 0x45, 0x14, 0x51, 0x40, 0xFC, 0x27, 0x80, 0xF1, 0x8C, 0x63, 0x3C,
+  0x7B, 0x3C, 0xF3, 0xCD, 0xE0, 0x3F, 0x93, 0x66, 0xDB, 0xDA, 0x40, 0xF0,
+  0xE0, 0xC3, 0x03, 0x1C, 0x0C, 0x60, 0x33, 0x01, 0xEC, 0xE0, 0x63, 0x83,
+  0x96, 0x0C, 0xFC, 0x70, 0x60, 0xF0, 0xE0, 0xC3, 0x03, 0x1C, 0x0C, 0x60,
+  0x33, 0x01, 0xED, 0xE0, 0x64, 0xC3, 0x83, 0x0C, 0x18, 0x70, 0xC0, 0x07,
+  0xC0, 0xF9, 0xC0, 0xCC, 0x1C, 0xE0, 0x36, 0x09, 0xE0, 0x7B, 0x38, 0x31,
+  0xC3, 0x96, 0x19, 0xF9, 0xC1, 0x80, 0x18, 0x60, 0x06, 0x18, 0xC6, 0x30,
+  0xC3, 0x17, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x06,
+  0xC0, 0xD8, 0x31, 0x86, 0x30, 0xFE, 0x30, 0x66, 0x0D, 0x80, 0xC0, 0x06,
+  0x01, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x06, 0xC0, 0xD8, 0x31, 0x86,
+  0x30, 0xFE, 0x30, 0x66, 0x0D, 0x80, 0xC0, 0x0E, 0x03, 0x60, 0x00, 0x00,
+  0x00, 0xE0, 0x1C, 0x06, 0xC0, 0xD8, 0x31, 0x86, 0x30, 0xFE, 0x30, 0x66,
+  0x0D, 0x80, 0xC0, 0x1D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x06,
+  0xC0, 0xD8, 0x31, 0x86, 0x30, 0xFE, 0x30, 0x66, 0x0D, 0x80, 0xC0, 0x1B,
+  0x03, 0x60, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x06, 0xC0, 0xD8, 0x31, 0x86,
+  0x30, 0xFE, 0x30, 0x66, 0x0D, 0x80, 0xC0, 0x0E, 0x02, 0x20, 0x44, 0x07,
+  0x01, 0xB0, 0x36, 0x0C, 0x61, 0x8C, 0x31, 0x8F, 0xF9, 0x83, 0x30, 0x6C,
+  0x06, 0x0F, 0xFC, 0x36, 0x01, 0x98, 0x06, 0x60, 0x31, 0xFC, 0xC6, 0x03,
+  0xF8, 0x18, 0x60, 0x61, 0x83, 0x07, 0xF0, 0x1F, 0xB8, 0x58, 0x18, 0x0C,
+  0x06, 0x03, 0x00, 0xC0, 0x70, 0x8F, 0xC0, 0x80, 0x40, 0xE0, 0x60, 0x60,
+  0x00, 0x0F, 0xF8, 0x30, 0x60, 0xFF, 0x83, 0x06, 0x0C, 0x1F, 0xC0, 0x18,
+  0x60, 0x00, 0x0F, 0xF8, 0x30, 0x60, 0xFF, 0x83, 0x06, 0x0C, 0x1F, 0xC0,
+  0x38, 0xD8, 0x00, 0x0F, 0xF8, 0x30, 0x60, 0xFF, 0x83, 0x06, 0x0C, 0x1F,
+  0xC0, 0x6C, 0xD8, 0x00, 0x0F, 0xF8, 0x30, 0x60, 0xFF, 0x83, 0x06, 0x0C,
+  0x1F, 0xC0, 0xCC, 0x06, 0xDB, 0x6D, 0xB6, 0xC0, 0x78, 0x0D, 0xB6, 0xDB,
+  0x6D, 0x80, 0x31, 0x20, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC0, 0xCF, 0x30, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0,
+  0x7E, 0x18, 0xE6, 0x19, 0x83, 0xF8, 0xD8, 0x36, 0x0D, 0x86, 0x63, 0x9F,
+  0x80, 0x3A, 0x17, 0x00, 0x00, 0x0E, 0x1F, 0x0F, 0xC7, 0xA3, 0xD9, 0xE6,
+  0xF3, 0x78, 0xFC, 0x3E, 0x1C, 0x30, 0x06, 0x00, 0x00, 0x00, 0x1E, 0x18,
+  0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x87, 0x80, 0x0C,
+  0x06, 0x00, 0x00, 0x00, 0x1E, 0x18, 0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0D, 0x86, 0x61, 0x87, 0x80, 0x1C, 0x0D, 0x80, 0x00, 0x00, 0x1E, 0x18,
+  0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x87, 0x80, 0x1A,
+  0x05, 0x80, 0x00, 0x00, 0x1E, 0x18, 0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0D, 0x86, 0x61, 0x87, 0x80, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x1E, 0x18,
+  0x66, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x87, 0x80, 0x42,
+  0xE7, 0x7E, 0x3C, 0x3C, 0x7E, 0xE7, 0x42, 0x0F, 0x26, 0x18, 0xC3, 0x30,
+  0xB6, 0x26, 0xC8, 0xDA, 0x19, 0x86, 0x30, 0xC9, 0xE0, 0x30, 0x0C, 0x00,
+  0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x31,
+  0xF0, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x36, 0x31, 0xF0, 0x1C, 0x1B, 0x00, 0x00, 0x0C, 0x1E, 0x0F,
+  0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x31, 0xF0, 0x36, 0x1B, 0x00,
+  0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x31,
+  0xF0, 0x06, 0x03, 0x00, 0x00, 0x00, 0xE1, 0xD8, 0x63, 0x30, 0xCC, 0x1E,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFC, 0xC7, 0xC3, 0xC3,
+  0xC3, 0xC7, 0xFC, 0xC0, 0xC0, 0x7C, 0xC6, 0xC6, 0xCC, 0xD8, 0xD8, 0xDE,
+  0xCF, 0xC3, 0xC3, 0xDE, 0x60, 0x60, 0x60, 0x03, 0xC8, 0xC1, 0xBF, 0xC7,
+  0x8F, 0x3B, 0xB0, 0x06, 0x18, 0x60, 0x03, 0xC8, 0xC1, 0xBF, 0xC7, 0x8F,
+  0x3B, 0xB0, 0x38, 0x51, 0xB0, 0x03, 0xC8, 0xC1, 0xBF, 0xC7, 0x8F, 0x3B,
+  0xB0, 0x34, 0x68, 0xB0, 0x03, 0xC8, 0xC1, 0xBF, 0xC7, 0x8F, 0x3B, 0xB0,
+  0x6C, 0xD8, 0x01, 0xE4, 0x60, 0xDF, 0xE3, 0xC7, 0x9D, 0xD8, 0x18, 0x48,
+  0x90, 0xC0, 0x07, 0x91, 0x83, 0x7F, 0x8F, 0x1E, 0x77, 0x60, 0x3C, 0xF1,
+  0x0E, 0x60, 0x30, 0xDF, 0xFF, 0xC3, 0x03, 0x0C, 0x0C, 0x78, 0x5F, 0x7E,
+  0x3C, 0xC7, 0x06, 0x0C, 0x18, 0x18, 0x9E, 0x08, 0x10, 0xE0, 0x60, 0x30,
+  0x18, 0x00, 0x3C, 0x66, 0xC3, 0xFF, 0xC0, 0xC0, 0x61, 0x3E, 0x06, 0x0C,
+  0x18, 0x00, 0x3C, 0x66, 0xC3, 0xFF, 0xC0, 0xC0, 0x61, 0x3E, 0x38, 0x28,
+  0x6C, 0x00, 0x3C, 0x66, 0xC3, 0xFF, 0xC0, 0xC0, 0x61, 0x3E, 0x6C, 0x6C,
+  0x00, 0x3C, 0x66, 0xC3, 0xFF, 0xC0, 0xC0, 0x61, 0x3E, 0xC6, 0x30, 0x66,
+  0x66, 0x66, 0x66, 0x19, 0x98, 0x0C, 0x63, 0x18, 0xC6, 0x31, 0x80, 0x31,
+  0xE4, 0x80, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xCF, 0x30, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x00, 0x32, 0x1C, 0x7C, 0x0E, 0x3E, 0xE3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0x12, 0x2A, 0x24, 0x00, 0xDE, 0xE3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0x60, 0x30, 0x18, 0x00, 0x3C, 0x66, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0x06, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x24, 0x00, 0x3C, 0x66, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0x32, 0x52, 0x4C, 0x00, 0x3C, 0x66, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x66, 0x3C, 0x66, 0x66, 0x00, 0x3C, 0x66, 0xC3, 0xC3, 0xC3,
+  0xC3, 0x66, 0x3C, 0x18, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0x18, 0x3D,
+  0x66, 0xCF, 0xCB, 0xD3, 0xF3, 0x66, 0xBC, 0x30, 0x18, 0x0C, 0x00, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0x03, 0x06, 0x0C, 0x00, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0x18, 0x3C, 0x24, 0x00, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0x66, 0x66, 0x00, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0x03, 0x03, 0x03, 0x00, 0x0C, 0x1B,
+  0x19, 0x8C, 0xC6, 0x36, 0x1B, 0x05, 0x83, 0x80, 0xC0, 0xE1, 0xE0, 0xC0,
+  0xC0, 0xC0, 0xDC, 0xE6, 0xC3, 0xC3, 0xC3, 0xC3, 0xE6, 0xDC, 0xC0, 0xC0,
+  0xC0, 0x36, 0x1B, 0x00, 0x18, 0x36, 0x33, 0x19, 0x8C, 0x6C, 0x36, 0x0B,
+  0x07, 0x01, 0x81, 0xC3, 0xC0 };
+
+const GFXglyph DejaVuSans_Bold7pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   2,  10,   6,    2,   -9 },   // 0x21 '!'
+  {     4,   5,   4,   7,    1,   -9 },   // 0x22 '"'
+  {     7,  10,  10,  12,    1,   -9 },   // 0x23 '#'
+  {    20,   7,  13,  10,    2,  -10 },   // 0x24 '$'
+  {    32,  13,  10,  14,    1,   -9 },   // 0x25 '%'
+  {    49,  11,  10,  13,    1,   -9 },   // 0x26 '&'
+  {    63,   2,   4,   4,    1,   -9 },   // 0x27 '''
+  {    64,   4,  12,   6,    1,  -10 },   // 0x28 '('
+  {    70,   4,  12,   6,    1,  -10 },   // 0x29 ')'
+  {    76,   7,   7,   7,    0,   -9 },   // 0x2A '*'
+  {    83,   8,   8,  12,    2,   -7 },   // 0x2B '+'
+  {    91,   3,   5,   5,    0,   -2 },   // 0x2C ','
+  {    93,   4,   2,   6,    1,   -4 },   // 0x2D '-'
+  {    94,   2,   3,   5,    1,   -2 },   // 0x2E '.'
+  {    95,   5,  12,   5,    0,   -9 },   // 0x2F '/'
+  {   103,   8,  10,  10,    1,   -9 },   // 0x30 '0'
+  {   113,   6,  10,  10,    2,   -9 },   // 0x31 '1'
+  {   121,   7,  10,  10,    1,   -9 },   // 0x32 '2'
+  {   130,   8,  10,  10,    1,   -9 },   // 0x33 '3'
+  {   140,   8,  10,  10,    1,   -9 },   // 0x34 '4'
+  {   150,   8,  10,  10,    1,   -9 },   // 0x35 '5'
+  {   160,   8,  10,  10,    1,   -9 },   // 0x36 '6'
+  {   170,   8,  10,  10,    1,   -9 },   // 0x37 '7'
+  {   180,   8,  10,  10,    1,   -9 },   // 0x38 '8'
+  {   190,   8,  10,  10,    1,   -9 },   // 0x39 '9'
+  {   200,   2,   8,   6,    1,   -7 },   // 0x3A ':'
+  {   202,   3,  10,   6,    0,   -7 },   // 0x3B ';'
+  {   206,   9,   8,  12,    1,   -7 },   // 0x3C '<'
+  {   215,   9,   6,  12,    1,   -7 },   // 0x3D '='
+  {   222,   9,   8,  12,    1,   -7 },   // 0x3E '>'
+  {   231,   6,  10,   8,    1,   -9 },   // 0x3F '?'
+  {   239,  12,  12,  14,    1,   -9 },   // 0x40 '@'
+  {   257,  11,  10,  11,    0,   -9 },   // 0x41 'A'
+  {   271,   8,  10,  10,    1,   -9 },   // 0x42 'B'
+  {   281,   9,  10,  11,    1,   -9 },   // 0x43 'C'
+  {   293,   9,  10,  11,    1,   -9 },   // 0x44 'D'
+  {   305,   7,  10,   9,    1,   -9 },   // 0x45 'E'
+  {   314,   7,  10,   9,    1,   -9 },   // 0x46 'F'
+  {   323,  10,  10,  12,    1,   -9 },   // 0x47 'G'
+  {   336,   9,  10,  11,    1,   -9 },   // 0x48 'H'
+  {   348,   2,  10,   4,    1,   -9 },   // 0x49 'I'
+  {   351,   4,  13,   4,   -1,   -9 },   // 0x4A 'J'
+  {   358,  10,  10,  11,    1,   -9 },   // 0x4B 'K'
+  {   371,   7,  10,   9,    1,   -9 },   // 0x4C 'L'
+  {   380,  11,  10,  13,    1,   -9 },   // 0x4D 'M'
+  {   394,   9,  10,  11,    1,   -9 },   // 0x4E 'N'
+  {   406,  10,  10,  12,    1,   -9 },   // 0x4F 'O'
+  {   419,   8,  10,  10,    1,   -9 },   // 0x50 'P'
+  {   429,  10,  12,  12,    1,   -9 },   // 0x51 'Q'
+  {   444,   9,  10,  10,    1,   -9 },   // 0x52 'R'
+  {   456,   8,  10,  10,    1,   -9 },   // 0x53 'S'
+  {   466,   8,  10,  10,    1,   -9 },   // 0x54 'T'
+  {   476,   9,  10,  11,    1,   -9 },   // 0x55 'U'
+  {   488,  11,  10,  11,    0,   -9 },   // 0x56 'V'
+  {   502,  13,  10,  15,    1,   -9 },   // 0x57 'W'
+  {   519,  10,  10,  10,    0,   -9 },   // 0x58 'X'
+  {   532,  10,  10,  10,    0,   -9 },   // 0x59 'Y'
+  {   545,   9,  10,  11,    1,   -9 },   // 0x5A 'Z'
+  {   557,   4,  12,   6,    1,  -10 },   // 0x5B '['
+  {   563,   5,  12,   5,    0,   -9 },   // 0x5C '\'
+  {   571,   4,  12,   6,    1,  -10 },   // 0x5D ']'
+  {   577,   9,   4,  12,    1,   -9 },   // 0x5E '^'
+  {   582,   7,   1,   7,    0,    3 },   // 0x5F '_'
+  {   583,   4,   3,   7,    1,  -11 },   // 0x60 '`'
+  {   585,   7,   8,   9,    1,   -7 },   // 0x61 'a'
+  {   592,   8,  11,  10,    1,  -10 },   // 0x62 'b'
+  {   603,   7,   8,   9,    1,   -7 },   // 0x63 'c'
+  {   610,   8,  11,  10,    1,  -10 },   // 0x64 'd'
+  {   621,   8,   8,  10,    1,   -7 },   // 0x65 'e'
+  {   629,   5,  11,   6,    1,  -10 },   // 0x66 'f'
+  {   636,   8,  11,  10,    1,   -7 },   // 0x67 'g'
+  {   647,   8,  11,  10,    1,  -10 },   // 0x68 'h'
+  {   658,   2,  11,   4,    1,  -10 },   // 0x69 'i'
+  {   661,   4,  14,   4,   -1,  -10 },   // 0x6A 'j'
+  {   668,   9,  11,   9,    1,  -10 },   // 0x6B 'k'
+  {   681,   2,  11,   4,    1,  -10 },   // 0x6C 'l'
+  {   684,  12,   8,  14,    1,   -7 },   // 0x6D 'm'
+  {   696,   8,   8,  10,    1,   -7 },   // 0x6E 'n'
+  {   704,   8,   8,  10,    1,   -7 },   // 0x6F 'o'
+  {   712,   8,  11,  10,    1,   -7 },   // 0x70 'p'
+  {   723,   8,  11,  10,    1,   -7 },   // 0x71 'q'
+  {   734,   6,   8,   7,    1,   -7 },   // 0x72 'r'
+  {   740,   7,   8,   9,    1,   -7 },   // 0x73 's'
+  {   747,   5,  10,   6,    0,   -9 },   // 0x74 't'
+  {   754,   8,   8,  10,    1,   -7 },   // 0x75 'u'
+  {   762,   9,   8,   9,    0,   -7 },   // 0x76 'v'
+  {   771,  12,   8,  14,    1,   -7 },   // 0x77 'w'
+  {   783,   9,   8,   9,    0,   -7 },   // 0x78 'x'
+  {   792,   9,  11,   9,    0,   -7 },   // 0x79 'y'
+  {   805,   7,   8,   9,    1,   -7 },   // 0x7A 'z'
+  {   812,   6,  13,  10,    2,  -10 },   // 0x7B '{'
+  {   822,   2,  14,   5,    2,  -10 },   // 0x7C '|'
+  {   826,   6,  13,  10,    2,  -10 },   // 0x7D '}'
+  {   836,   9,   3,  12,    1,   -5 },   // 0x7E '~'
+  {   840,   7,  12,   8,    1,   -9 },   // 0x7F
+  {   851,   7,  12,   8,    1,   -9 },   // 0x80
+  {   862,   7,  12,   8,    1,   -9 },   // 0x81
+  {   873,   7,  12,   8,    1,   -9 },   // 0x82
+  {   884,   7,  12,   8,    1,   -9 },   // 0x83
+  {   895,   7,  12,   8,    1,   -9 },   // 0x84
+  {   906,   7,  12,   8,    1,   -9 },   // 0x85
+  {   917,   7,  12,   8,    1,   -9 },   // 0x86
+  {   928,   7,  12,   8,    1,   -9 },   // 0x87
+  {   939,   7,  12,   8,    1,   -9 },   // 0x88
+  {   950,   7,  12,   8,    1,   -9 },   // 0x89
+  {   961,   7,  12,   8,    1,   -9 },   // 0x8A
+  {   972,   7,  12,   8,    1,   -9 },   // 0x8B
+  {   983,   7,  12,   8,    1,   -9 },   // 0x8C
+  {   994,   7,  12,   8,    1,   -9 },   // 0x8D
+  {  1005,   7,  12,   8,    1,   -9 },   // 0x8E
+  {  1016,   7,  12,   8,    1,   -9 },   // 0x8F
+  {  1027,   7,  12,   8,    1,   -9 },   // 0x90
+  {  1038,   7,  12,   8,    1,   -9 },   // 0x91
+  {  1049,   7,  12,   8,    1,   -9 },   // 0x92
+  {  1060,   7,  12,   8,    1,   -9 },   // 0x93
+  {  1071,   7,  12,   8,    1,   -9 },   // 0x94
+  {  1082,   7,  12,   8,    1,   -9 },   // 0x95
+  {  1093,   7,  12,   8,    1,   -9 },   // 0x96
+  {  1104,   7,  12,   8,    1,   -9 },   // 0x97
+  {  1115,   7,  12,   8,    1,   -9 },   // 0x98
+  {  1126,   7,  12,   8,    1,   -9 },   // 0x99
+  {  1137,   7,  12,   8,    1,   -9 },   // 0x9A
+  {  1148,   7,  12,   8,    1,   -9 },   // 0x9B
+  {  1159,   7,  12,   8,    1,   -9 },   // 0x9C
+  {  1170,   7,  12,   8,    1,   -9 },   // 0x9D
+  {  1181,   7,  12,   8,    1,   -9 },   // 0x9E
+  {  1192,   7,  12,   8,    1,   -9 },   // 0x9F
+  {  1203,   1,   1,   5,    0,    0 },   // 0xA0
+  {  1204,   2,  10,   6,    2,   -7 },   // 0xA1
+  {  1207,   6,  12,  10,    1,   -9 },   // 0xA2
+  {  1216,   8,  10,  10,    0,   -9 },   // 0xA3
+  {  1226,   8,   8,   9,    1,   -7 },   // 0xA4
+  {  1234,   8,  10,  10,    1,   -9 },   // 0xA5
+  {  1244,   2,  12,   5,    2,   -9 },   // 0xA6
+  {  1247,   7,  11,   7,    1,   -9 },   // 0xA7
+  {  1257,   5,   2,   7,    1,  -10 },   // 0xA8
+  {  1259,  10,  10,  14,    2,   -9 },   // 0xA9
+  {  1272,   6,   8,   8,    1,   -9 },   // 0xAA
+  {  1278,   6,   6,   9,    1,   -6 },   // 0xAB
+  {  1283,   9,   4,  12,    1,   -5 },   // 0xAC
+  {  1288,   4,   2,   6,    1,   -4 },   // 0xAD
+  {  1289,  10,  10,  14,    2,   -9 },   // 0xAE
+  {  1302,   4,   1,   7,    2,   -9 },   // 0xAF
+  {  1303,   5,   5,   7,    1,   -9 },   // 0xB0
+  {  1307,  10,   8,  12,    1,   -7 },   // 0xB1
+  {  1317,   5,   6,   6,    1,   -9 },   // 0xB2
+  {  1321,   5,   6,   6,    1,   -9 },   // 0xB3
+  {  1325,   4,   3,   7,    3,  -11 },   // 0xB4
+  {  1327,   9,  11,  10,    1,   -7 },   // 0xB5
+  {  1340,   6,  11,   9,    1,   -9 },   // 0xB6
+  {  1349,   2,   3,   5,    1,   -5 },   // 0xB7
+  {  1350,   3,   3,   7,    2,    1 },   // 0xB8
+  {  1352,   5,   6,   6,    0,   -9 },   // 0xB9
+  {  1356,   6,   8,   8,    1,   -9 },   // 0xBA
+  {  1362,   6,   6,   9,    1,   -6 },   // 0xBB
+  {  1367,  14,  10,  15,    0,   -9 },   // 0xBC
+  {  1385,  14,  11,  15,    0,   -9 },   // 0xBD
+  {  1405,  13,  10,  15,    1,   -9 },   // 0xBE
+  {  1422,   6,  11,   8,    1,   -7 },   // 0xBF
+  {  1431,  11,  14,  11,    0,  -13 },   // 0xC0
+  {  1451,  11,  14,  11,    0,  -13 },   // 0xC1
+  {  1471,  11,  14,  11,    0,  -13 },   // 0xC2
+  {  1491,  11,  14,  11,    0,  -13 },   // 0xC3
+  {  1511,  11,  14,  11,    0,  -13 },   // 0xC4
+  {  1531,  11,  13,  11,    0,  -12 },   // 0xC5
+  {  1549,  14,  10,  15,    0,   -9 },   // 0xC6
+  {  1567,   9,  13,  11,    1,   -9 },   // 0xC7
+  {  1582,   7,  14,   9,    1,  -13 },   // 0xC8
+  {  1595,   7,  14,   9,    1,  -13 },   // 0xC9
+  {  1608,   7,  14,   9,    1,  -13 },   // 0xCA
+  {  1621,   7,  14,   9,    1,  -13 },   // 0xCB
+  {  1634,   3,  14,   4,    0,  -13 },   // 0xCC
+  {  1640,   3,  14,   4,    1,  -13 },   // 0xCD
+  {  1646,   6,  14,   4,   -1,  -13 },   // 0xCE
+  {  1657,   6,  14,   4,   -1,  -13 },   // 0xCF
+  {  1668,  10,  10,  11,    0,   -9 },   // 0xD0
+  {  1681,   9,  14,  11,    1,  -13 },   // 0xD1
+  {  1697,  10,  14,  12,    1,  -13 },   // 0xD2
+  {  1715,  10,  14,  12,    1,  -13 },   // 0xD3
+  {  1733,  10,  14,  12,    1,  -13 },   // 0xD4
+  {  1751,  10,  14,  12,    1,  -13 },   // 0xD5
+  {  1769,  10,  14,  12,    1,  -13 },   // 0xD6
+  {  1787,   8,   8,  12,    2,   -8 },   // 0xD7
+  {  1795,  11,  10,  12,    0,   -9 },   // 0xD8
+  {  1809,   9,  14,  11,    1,  -13 },   // 0xD9
+  {  1825,   9,  14,  11,    1,  -13 },   // 0xDA
+  {  1841,   9,  14,  11,    1,  -13 },   // 0xDB
+  {  1857,   9,  14,  11,    1,  -13 },   // 0xDC
+  {  1873,  10,  14,  10,    0,  -13 },   // 0xDD
+  {  1891,   8,  10,  10,    1,   -9 },   // 0xDE
+  {  1901,   8,  11,  10,    1,  -10 },   // 0xDF
+  {  1912,   7,  12,   9,    1,  -11 },   // 0xE0
+  {  1923,   7,  12,   9,    1,  -11 },   // 0xE1
+  {  1934,   7,  12,   9,    1,  -11 },   // 0xE2
+  {  1945,   7,  12,   9,    1,  -11 },   // 0xE3
+  {  1956,   7,  11,   9,    1,  -10 },   // 0xE4
+  {  1966,   7,  13,   9,    1,  -12 },   // 0xE5
+  {  1978,  14,   8,  16,    1,   -7 },   // 0xE6
+  {  1992,   7,  11,   9,    1,   -7 },   // 0xE7
+  {  2002,   8,  12,  10,    1,  -11 },   // 0xE8
+  {  2014,   8,  12,  10,    1,  -11 },   // 0xE9
+  {  2026,   8,  12,  10,    1,  -11 },   // 0xEA
+  {  2038,   8,  11,  10,    1,  -10 },   // 0xEB
+  {  2049,   4,  12,   4,    0,  -11 },   // 0xEC
+  {  2055,   5,  12,   4,    1,  -11 },   // 0xED
+  {  2063,   6,  12,   4,   -1,  -11 },   // 0xEE
+  {  2072,   6,  11,   4,   -1,  -10 },   // 0xEF
+  {  2081,   8,  11,  10,    1,  -10 },   // 0xF0
+  {  2092,   8,  12,  10,    1,  -11 },   // 0xF1
+  {  2104,   8,  12,  10,    1,  -11 },   // 0xF2
+  {  2116,   8,  12,  10,    1,  -11 },   // 0xF3
+  {  2128,   8,  12,  10,    1,  -11 },   // 0xF4
+  {  2140,   8,  12,  10,    1,  -11 },   // 0xF5
+  {  2152,   8,  11,  10,    1,  -10 },   // 0xF6
+  {  2163,   8,   8,  12,    2,   -7 },   // 0xF7
+  {  2171,   8,   8,  10,    1,   -7 },   // 0xF8
+  {  2179,   8,  12,  10,    1,  -11 },   // 0xF9
+  {  2191,   8,  12,  10,    1,  -11 },   // 0xFA
+  {  2203,   8,  12,  10,    1,  -11 },   // 0xFB
+  {  2215,   8,  11,  10,    1,  -10 },   // 0xFC
+  {  2226,   9,  15,   9,    0,  -11 },   // 0xFD
+  {  2243,   8,  14,  10,    1,  -10 },   // 0xFE
+  {  2257,   9,  14,   9,    0,  -10 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold7pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold7pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold7pt8bGlyphs,
+  0x20, 0xFF, 16 };
+
+// Approx. 3848 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold7pt8bMetrics[] PROGMEM = {
+  {   0,   5,   1 },   // 0x20
+  {   2,   6,   4 },   // 0x21
+  {   1,   7,   6 },   // 0x22
+  {   1,  12,  11 },   // 0x23
+  {   2,  10,   9 },   // 0x24
+  {   1,  14,  14 },   // 0x25
+  {   1,  13,  12 },   // 0x26
+  {   1,   4,   3 },   // 0x27
+  {   1,   6,   5 },   // 0x28
+  {   1,   6,   5 },   // 0x29
+  {   0,   7,   7 },   // 0x2A
+  {   2,  12,  10 },   // 0x2B
+  {   0,   5,   3 },   // 0x2C
+  {   1,   6,   5 },   // 0x2D
+  {   1,   5,   3 },   // 0x2E
+  {   0,   5,   5 },   // 0x2F
+  {   1,  10,   9 },   // 0x30
+  {   2,  10,   8 },   // 0x31
+  {   1,  10,   8 },   // 0x32
+  {   1,  10,   9 },   // 0x33
+  {   1,  10,   9 },   // 0x34
+  {   1,  10,   9 },   // 0x35
+  {   1,  10,   9 },   // 0x36
+  {   1,  10,   9 },   // 0x37
+  {   1,  10,   9 },   // 0x38
+  {   1,  10,   9 },   // 0x39
+  {   1,   6,   3 },   // 0x3A
+  {   0,   6,   3 },   // 0x3B
+  {   1,  12,  10 },   // 0x3C
+  {   1,  12,  10 },   // 0x3D
+  {   1,  12,  10 },   // 0x3E
+  {   1,   8,   7 },   // 0x3F
+  {   1,  14,  13 },   // 0x40
+  {   0,  11,  11 },   // 0x41
+  {   1,  10,   9 },   // 0x42
+  {   1,  11,  10 },   // 0x43
+  {   1,  11,  10 },   // 0x44
+  {   1,   9,   8 },   // 0x45
+  {   1,   9,   8 },   // 0x46
+  {   1,  12,  11 },   // 0x47
+  {   1,  11,  10 },   // 0x48
+  {   1,   4,   3 },   // 0x49
+  {  -1,   4,   3 },   // 0x4A
+  {   1,  11,  11 },   // 0x4B
+  {   1,   9,   8 },   // 0x4C
+  {   1,  13,  12 },   // 0x4D
+  {   1,  11,  10 },   // 0x4E
+  {   1,  12,  11 },   // 0x4F
+  {   1,  10,   9 },   // 0x50
+  {   1,  12,  11 },   // 0x51
+  {   1,  10,  10 },   // 0x52
+  {   1,  10,   9 },   // 0x53
+  {   1,  10,   9 },   // 0x54
+  {   1,  11,  10 },   // 0x55
+  {   0,  11,  11 },   // 0x56
+  {   1,  15,  14 },   // 0x57
+  {   0,  10,  10 },   // 0x58
+  {   0,  10,  10 },   // 0x59
+  {   1,  11,  10 },   // 0x5A
+  {   1,   6,   5 },   // 0x5B
+  {   0,   5,   5 },   // 0x5C
+  {   1,   6,   5 },   // 0x5D
+  {   1,  12,  10 },   // 0x5E
+  {   0,   7,   7 },   // 0x5F
+  {   1,   7,   5 },   // 0x60
+  {   1,   9,   8 },   // 0x61
+  {   1,  10,   9 },   // 0x62
+  {   1,   9,   8 },   // 0x63
+  {   1,  10,   9 },   // 0x64
+  {   1,  10,   9 },   // 0x65
+  {   1,   6,   6 },   // 0x66
+  {   1,  10,   9 },   // 0x67
+  {   1,  10,   9 },   // 0x68
+  {   1,   4,   3 },   // 0x69
+  {  -1,   4,   3 },   // 0x6A
+  {   1,   9,  10 },   // 0x6B
+  {   1,   4,   3 },   // 0x6C
+  {   1,  14,  13 },   // 0x6D
+  {   1,  10,   9 },   // 0x6E
+  {   1,  10,   9 },   // 0x6F
+  {   1,  10,   9 },   // 0x70
+  {   1,  10,   9 },   // 0x71
+  {   1,   7,   7 },   // 0x72
+  {   1,   9,   8 },   // 0x73
+  {   0,   6,   5 },   // 0x74
+  {   1,  10,   9 },   // 0x75
+  {   0,   9,   9 },   // 0x76
+  {   1,  14,  13 },   // 0x77
+  {   0,   9,   9 },   // 0x78
+  {   0,   9,   9 },   // 0x79
+  {   1,   9,   8 },   // 0x7A
+  {   2,  10,   8 },   // 0x7B
+  {   2,   5,   4 },   // 0x7C
+  {   2,  10,   8 },   // 0x7D
+  {   1,  12,  10 },   // 0x7E
+  {   1,   8,   8 },   // 0x7F
+  {   1,   8,   8 },   // 0x80
+  {   1,   8,   8 },   // 0x81
+  {   1,   8,   8 },   // 0x82
+  {   1,   8,   8 },   // 0x83
+  {   1,   8,   8 },   // 0x84
+  {   1,   8,   8 },   // 0x85
+  {   1,   8,   8 },   // 0x86
+  {   1,   8,   8 },   // 0x87
+  {   1,   8,   8 },   // 0x88
+  {   1,   8,   8 },   // 0x89
+  {   1,   8,   8 },   // 0x8A
+  {   1,   8,   8 },   // 0x8B
+  {   1,   8,   8 },   // 0x8C
+  {   1,   8,   8 },   // 0x8D
+  {   1,   8,   8 },   // 0x8E
+  {   1,   8,   8 },   // 0x8F
+  {   1,   8,   8 },   // 0x90
+  {   1,   8,   8 },   // 0x91
+  {   1,   8,   8 },   // 0x92
+  {   1,   8,   8 },   // 0x93
+  {   1,   8,   8 },   // 0x94
+  {   1,   8,   8 },   // 0x95
+  {   1,   8,   8 },   // 0x96
+  {   1,   8,   8 },   // 0x97
+  {   1,   8,   8 },   // 0x98
+  {   1,   8,   8 },   // 0x99
+  {   1,   8,   8 },   // 0x9A
+  {   1,   8,   8 },   // 0x9B
+  {   1,   8,   8 },   // 0x9C
+  {   1,   8,   8 },   // 0x9D
+  {   1,   8,   8 },   // 0x9E
+  {   1,   8,   8 },   // 0x9F
+  {   0,   5,   1 },   // 0xA0
+  {   2,   6,   4 },   // 0xA1
+  {   1,  10,   7 },   // 0xA2
+  {   0,  10,   8 },   // 0xA3
+  {   1,   9,   9 },   // 0xA4
+  {   1,  10,   9 },   // 0xA5
+  {   2,   5,   4 },   // 0xA6
+  {   1,   7,   8 },   // 0xA7
+  {   1,   7,   6 },   // 0xA8
+  {   2,  14,  12 },   // 0xA9
+  {   1,   8,   7 },   // 0xAA
+  {   1,   9,   7 },   // 0xAB
+  {   1,  12,  10 },   // 0xAC
+  {   1,   6,   5 },   // 0xAD
+  {   2,  14,  12 },   // 0xAE
+  {   2,   7,   6 },   // 0xAF
+  {   1,   7,   6 },   // 0xB0
+  {   1,  12,  11 },   // 0xB1
+  {   1,   6,   6 },   // 0xB2
+  {   1,   6,   6 },   // 0xB3
+  {   3,   7,   7 },   // 0xB4
+  {   1,  10,  10 },   // 0xB5
+  {   1,   9,   7 },   // 0xB6
+  {   1,   5,   3 },   // 0xB7
+  {   2,   7,   5 },   // 0xB8
+  {   0,   6,   5 },   // 0xB9
+  {   1,   8,   7 },   // 0xBA
+  {   1,   9,   7 },   // 0xBB
+  {   0,  15,  14 },   // 0xBC
+  {   0,  15,  14 },   // 0xBD
+  {   1,  15,  14 },   // 0xBE
+  {   1,   8,   7 },   // 0xBF
+  {   0,  11,  11 },   // 0xC0
+  {   0,  11,  11 },   // 0xC1
+  {   0,  11,  11 },   // 0xC2
+  {   0,  11,  11 },   // 0xC3
+  {   0,  11,  11 },   // 0xC4
+  {   0,  11,  11 },   // 0xC5
+  {   0,  15,  14 },   // 0xC6
+  {   1,  11,  10 },   // 0xC7
+  {   1,   9,   8 },   // 0xC8
+  {   1,   9,   8 },   // 0xC9
+  {   1,   9,   8 },   // 0xCA
+  {   1,   9,   8 },   // 0xCB
+  {   0,   4,   3 },   // 0xCC
+  {   1,   4,   4 },   // 0xCD
+  {  -1,   4,   5 },   // 0xCE
+  {  -1,   4,   5 },   // 0xCF
+  {   0,  11,  10 },   // 0xD0
+  {   1,  11,  10 },   // 0xD1
+  {   1,  12,  11 },   // 0xD2
+  {   1,  12,  11 },   // 0xD3
+  {   1,  12,  11 },   // 0xD4
+  {   1,  12,  11 },   // 0xD5
+  {   1,  12,  11 },   // 0xD6
+  {   2,  12,  10 },   // 0xD7
+  {   0,  12,  11 },   // 0xD8
+  {   1,  11,  10 },   // 0xD9
+  {   1,  11,  10 },   // 0xDA
+  {   1,  11,  10 },   // 0xDB
+  {   1,  11,  10 },   // 0xDC
+  {   0,  10,  10 },   // 0xDD
+  {   1,  10,   9 },   // 0xDE
+  {   1,  10,   9 },   // 0xDF
+  {   1,   9,   8 },   // 0xE0
+  {   1,   9,   8 },   // 0xE1
+  {   1,   9,   8 },   // 0xE2
+  {   1,   9,   8 },   // 0xE3
+  {   1,   9,   8 },   // 0xE4
+  {   1,   9,   8 },   // 0xE5
+  {   1,  16,  15 },   // 0xE6
+  {   1,   9,   8 },   // 0xE7
+  {   1,  10,   9 },   // 0xE8
+  {   1,  10,   9 },   // 0xE9
+  {   1,  10,   9 },   // 0xEA
+  {   1,  10,   9 },   // 0xEB
+  {   0,   4,   4 },   // 0xEC
+  {   1,   4,   6 },   // 0xED
+  {  -1,   4,   5 },   // 0xEE
+  {  -1,   4,   5 },   // 0xEF
+  {   1,  10,   9 },   // 0xF0
+  {   1,  10,   9 },   // 0xF1
+  {   1,  10,   9 },   // 0xF2
+  {   1,  10,   9 },   // 0xF3
+  {   1,  10,   9 },   // 0xF4
+  {   1,  10,   9 },   // 0xF5
+  {   1,  10,   9 },   // 0xF6
+  {   2,  12,  10 },   // 0xF7
+  {   1,  10,   9 },   // 0xF8
+  {   1,  10,   9 },   // 0xF9
+  {   1,  10,   9 },   // 0xFA
+  {   1,  10,   9 },   // 0xFB
+  {   1,  10,   9 },   // 0xFC
+  {   0,   9,   9 },   // 0xFD
+  {   1,  10,   9 },   // 0xFE
+  {   0,   9,   9 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold7pt8bWidths = { DejaVuSans_Bold7pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD7PTLAT1__H
@@ -0,0 +1,709 @@
+#ifndef DEJAVUSANSBOLD8PTLAT1__H
+#define DEJAVUSANSBOLD8PTLAT1__H
+const uint8_t DejaVuSans_Bold8pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0x3F, 0xCF, 0x3C, 0xF3, 0x0C, 0xC1, 0x90, 0x26, 0x3F,
+  0xF7, 0xFE, 0x32, 0x04, 0xC7, 0xFE, 0xFF, 0xC6, 0x40, 0x98, 0x13, 0x00,
+  0x10, 0x21, 0xE7, 0xED, 0x5A, 0x3E, 0x1F, 0x17, 0x2F, 0xFB, 0xE1, 0x02,
+  0x00, 0x78, 0x31, 0x98, 0xE3, 0x31, 0x86, 0x66, 0x0C, 0xDC, 0x0F, 0x30,
+  0x00, 0xCF, 0x03, 0xB3, 0x06, 0x66, 0x18, 0xCC, 0x71, 0x98, 0xC1, 0xE0,
+  0x1F, 0x03, 0xF8, 0x30, 0x83, 0x00, 0x38, 0x07, 0xC6, 0xEF, 0x6C, 0x3E,
+  0xC1, 0xCE, 0x3C, 0x7F, 0xE3, 0xF7, 0xFF, 0x36, 0x6E, 0xCC, 0xCC, 0xCC,
+  0xE6, 0x63, 0xC6, 0x67, 0x33, 0x33, 0x33, 0x76, 0x6C, 0x11, 0x25, 0xF1,
+  0xC7, 0xD2, 0x44, 0x00, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0x6D, 0xBC, 0xFF, 0xC0, 0xFC, 0x0C, 0x31,
+  0x86, 0x18, 0xC3, 0x0C, 0x61, 0x86, 0x30, 0xC0, 0x3E, 0x3F, 0x98, 0xD8,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x9F, 0xC7, 0xC0, 0x78, 0xF8,
+  0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x7C, 0xFE,
+  0x87, 0x03, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xFF, 0xFF, 0x7E, 0x7F,
+  0xE0, 0x60, 0x33, 0xF1, 0xF8, 0x0E, 0x03, 0x01, 0xC1, 0xFF, 0xCF, 0xC0,
+  0x0F, 0x03, 0xC1, 0xB0, 0xEC, 0x33, 0x1C, 0xC6, 0x33, 0x0C, 0xFF, 0xFF,
+  0xF0, 0x30, 0x0C, 0xFF, 0x7F, 0xB0, 0x18, 0x0F, 0xE7, 0xFA, 0x0E, 0x03,
+  0x01, 0xC1, 0xFF, 0xCF, 0xC0, 0x1E, 0x3F, 0x98, 0x58, 0x0F, 0xE7, 0xFB,
+  0x8F, 0x83, 0xC1, 0xB1, 0xDF, 0xC7, 0xC0, 0xFF, 0xFF, 0xC0, 0xE0, 0x60,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x07, 0x00, 0x7F, 0x7F, 0xF0,
+  0x78, 0x37, 0xF3, 0xFB, 0x8F, 0x83, 0xC1, 0xF1, 0xDF, 0xC7, 0xC0, 0x3E,
+  0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7F, 0x01, 0xA1, 0x9F, 0xC7,
+  0x80, 0xFC, 0x0F, 0xC0, 0x6D, 0x80, 0x1B, 0x6F, 0x00, 0x00, 0x40, 0xF1,
+  0xF3, 0xE0, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0x40, 0xFF, 0xFF, 0xF0,
+  0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x80, 0x3C, 0x03, 0xE0, 0x1F, 0x00, 0xC1,
+  0xF3, 0xE3, 0xC0, 0x80, 0x00, 0x7D, 0xFE, 0x18, 0x30, 0xE3, 0x8E, 0x18,
+  0x00, 0x60, 0xC1, 0x80, 0x0F, 0xC0, 0x60, 0xC2, 0x01, 0x91, 0xFA, 0xCC,
+  0xE6, 0x61, 0x99, 0x86, 0x66, 0x19, 0x98, 0x67, 0x33, 0xA4, 0x7F, 0x08,
+  0x00, 0x18, 0x30, 0x1F, 0x80, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0x98, 0x19,
+  0x83, 0x9C, 0x30, 0xC3, 0xFC, 0x7F, 0xE6, 0x06, 0x60, 0x6C, 0x03, 0xFF,
+  0x3F, 0xFC, 0x1F, 0x03, 0xC1, 0xFF, 0xEF, 0xFB, 0x03, 0xC0, 0xF0, 0x3F,
+  0xFF, 0xFC, 0x1F, 0x8F, 0xF7, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xE0, 0x1C, 0x13, 0xFC, 0x7E, 0xFE, 0x1F, 0xF3, 0x07, 0x60, 0x7C, 0x07,
+  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0x3B, 0xFE, 0x7F, 0x00, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x87,
+  0xF9, 0xC1, 0x70, 0x0C, 0x01, 0x80, 0x30, 0x7E, 0x0F, 0xE0, 0x6E, 0x0C,
+  0xFF, 0x8F, 0xE0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xFF, 0xFF, 0xFF,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x3E, 0xE0, 0xC1, 0x98, 0x63, 0x18, 0x66, 0x0D, 0x81,
+  0xE0, 0x36, 0x06, 0x60, 0xC6, 0x18, 0x63, 0x06, 0x60, 0x60, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0x3F,
+  0x01, 0xFC, 0x1F, 0xE0, 0xFD, 0x8D, 0xEC, 0x6F, 0x36, 0x79, 0xB3, 0xC7,
+  0x1E, 0x38, 0xF0, 0x07, 0x80, 0x30, 0xE0, 0xFC, 0x3F, 0x0F, 0xE3, 0xD8,
+  0xF3, 0x3C, 0xCF, 0x1B, 0xC7, 0xF0, 0xFC, 0x3F, 0x07, 0x1F, 0x83, 0xFC,
+  0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E,
+  0x3F, 0xC1, 0xF8, 0xFF, 0x3F, 0xEC, 0x1F, 0x03, 0xC0, 0xF0, 0x7F, 0xFB,
+  0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x07,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8,
+  0x01, 0xC0, 0x0E, 0xFF, 0x3F, 0xEC, 0x1B, 0x06, 0xC1, 0xBF, 0xCF, 0xF3,
+  0x0E, 0xC1, 0xB0, 0x6C, 0x1F, 0x03, 0x3F, 0x3F, 0xB0, 0x58, 0x0F, 0x03,
+  0xE0, 0x7C, 0x0F, 0x01, 0xC0, 0xFF, 0xCF, 0xC0, 0xFF, 0xFF, 0xF0, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x77,
+  0xF8, 0xFC, 0xC0, 0x36, 0x06, 0x60, 0x66, 0x06, 0x30, 0xC3, 0x0C, 0x30,
+  0xC1, 0x98, 0x19, 0x81, 0x98, 0x0F, 0x00, 0xF0, 0xC1, 0xC1, 0xE0, 0xE0,
+  0xD8, 0xF8, 0xCC, 0x6C, 0x66, 0x36, 0x33, 0x1B, 0x18, 0xD8, 0xD8, 0x6C,
+  0x6C, 0x36, 0x36, 0x1B, 0x1B, 0x07, 0x07, 0x03, 0x83, 0x80, 0xE0, 0x76,
+  0x06, 0x30, 0xC3, 0x9C, 0x1F, 0x80, 0xF0, 0x0F, 0x01, 0x98, 0x39, 0xC3,
+  0x0C, 0x60, 0x6E, 0x07, 0xE1, 0xD8, 0x67, 0x38, 0xCC, 0x1E, 0x07, 0x80,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0x18, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x18, 0x0F, 0xFF, 0xFF, 0xFF, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xC3, 0x06, 0x18, 0x60, 0xC3, 0x0C, 0x18,
+  0x61, 0x83, 0x0C, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x0C, 0x07,
+  0x83, 0x31, 0x86, 0xFF, 0xC6, 0x30, 0x3E, 0x7F, 0x03, 0x7F, 0xFF, 0xC3,
+  0xC7, 0xFF, 0x7B, 0xC0, 0x60, 0x30, 0x1B, 0xCF, 0xF7, 0x1F, 0x07, 0x83,
+  0xC1, 0xF1, 0xFF, 0xDB, 0xC0, 0x3E, 0x7F, 0xE1, 0xC0, 0xC0, 0xC0, 0xE1,
+  0x7F, 0x3E, 0x01, 0x80, 0xC0, 0x67, 0xB7, 0xFF, 0x1F, 0x07, 0x83, 0xC1,
+  0xF1, 0xDF, 0xE7, 0xB0, 0x3E, 0x3F, 0xB0, 0x7F, 0xFF, 0xFE, 0x03, 0x82,
+  0xFF, 0x3F, 0x00, 0x3D, 0xF6, 0x3E, 0xF9, 0x86, 0x18, 0x61, 0x86, 0x18,
+  0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F, 0x8E, 0xFF, 0x3D, 0xA1, 0xDF,
+  0xC7, 0xC0, 0xC0, 0x60, 0x30, 0x1B, 0xEF, 0xFF, 0x0F, 0x07, 0x83, 0xC1,
+  0xE0, 0xF0, 0x78, 0x30, 0xF3, 0xFF, 0xFF, 0x33, 0x03, 0x33, 0x33, 0x33,
+  0x33, 0x3F, 0xE0, 0xC0, 0x30, 0x0C, 0x03, 0x0E, 0xC7, 0x33, 0x8D, 0xC3,
+  0xE0, 0xDC, 0x33, 0x8C, 0x73, 0x0E, 0xFF, 0xFF, 0xFF, 0xDE, 0x7B, 0xFF,
+  0xFE, 0x38, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3,
+  0x0C, 0xDF, 0x7F, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0x80,
+  0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x8E, 0xFE, 0x3E, 0x00, 0xDE,
+  0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x8F, 0xFE, 0xDE, 0x60, 0x30, 0x18,
+  0x00, 0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F, 0x8E, 0xFF, 0x3D, 0x80,
+  0xC0, 0x60, 0x30, 0xCF, 0xFF, 0x86, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x7E,
+  0xFF, 0xC1, 0xF8, 0x7E, 0x07, 0x83, 0xFF, 0x7E, 0x61, 0x8F, 0xFF, 0x61,
+  0x86, 0x18, 0x61, 0xF3, 0xC0, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
+  0x0F, 0xFF, 0x7D, 0x80, 0xC0, 0xD8, 0x66, 0x19, 0x86, 0x33, 0x0C, 0xC1,
+  0xE0, 0x78, 0x1E, 0x00, 0xC2, 0x1E, 0x38, 0xD9, 0xCC, 0xCA, 0x66, 0xDB,
+  0x36, 0xD8, 0xA2, 0x87, 0x1C, 0x38, 0xE0, 0xE1, 0xD8, 0x63, 0x30, 0x78,
+  0x1E, 0x07, 0x83, 0x31, 0x86, 0xE1, 0xC0, 0xC0, 0xD8, 0x66, 0x18, 0xC6,
+  0x33, 0x0C, 0xC1, 0xE0, 0x78, 0x0E, 0x03, 0x07, 0xC1, 0xE0, 0xFF, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, 0x1C, 0xF3, 0x0C, 0x30, 0xC3,
+  0x3C, 0xF0, 0xC3, 0x0C, 0x30, 0xF1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0x3C, 0xC3, 0x0C, 0x33, 0xCE, 0x00, 0x78,
+  0x7F, 0xF8, 0x78, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0x00, 0xFC, 0xFF,
+  0xFF, 0x10, 0x20, 0xF3, 0xFF, 0x3A, 0x34, 0x68, 0xF2, 0xFC, 0xF0, 0x81,
+  0x00, 0x1E, 0x3F, 0x31, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0xFF,
+  0xFF, 0x41, 0x7F, 0xDF, 0xCC, 0x66, 0x33, 0x19, 0xFD, 0xFF, 0x41, 0x00,
+  0xE1, 0xD8, 0x67, 0x38, 0xCC, 0x3F, 0x3F, 0xFF, 0xFC, 0x30, 0xFF, 0xFF,
+  0xF0, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0x3E, 0x7E, 0x62, 0x70, 0x7C,
+  0x7E, 0xC7, 0xC3, 0x7E, 0x3E, 0x0E, 0x46, 0x7E, 0x7C, 0xDE, 0xC0, 0x0F,
+  0x03, 0x0C, 0x40, 0x24, 0x7A, 0x9C, 0x99, 0x81, 0x98, 0x19, 0xC1, 0x47,
+  0xA4, 0x02, 0x30, 0xC0, 0xF0, 0x7C, 0x0D, 0xFE, 0x3C, 0xEF, 0xC0, 0x7F,
+  0xFE, 0x11, 0x33, 0xEE, 0xCC, 0xEE, 0x33, 0x11, 0xFF, 0xFF, 0xF0, 0x0C,
+  0x03, 0x00, 0xC0, 0xFF, 0xC0, 0x0F, 0x03, 0x0C, 0x40, 0x25, 0xF2, 0x99,
+  0x99, 0x99, 0x9F, 0x19, 0xB1, 0x59, 0xA4, 0x02, 0x30, 0xC0, 0xF0, 0xF8,
+  0x74, 0x63, 0x17, 0x00, 0x0C, 0x03, 0x00, 0xC3, 0xFF, 0xFF, 0xC3, 0x00,
+  0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xF4, 0xC6, 0x77, 0x63, 0xE0, 0xF8, 0xDC,
+  0x31, 0xCF, 0xC0, 0x36, 0xC0, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0xC1, 0xB0,
+  0x6E, 0x3B, 0xFF, 0xFE, 0xF0, 0x0C, 0x03, 0x00, 0x3F, 0x7B, 0xFB, 0xFB,
+  0xFB, 0x7B, 0x3B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0xFC, 0x11,
+  0xF0, 0xF0, 0xC3, 0x0C, 0x30, 0xCF, 0xC0, 0x7D, 0x8F, 0x1E, 0x3C, 0x6F,
+  0x80, 0x7F, 0xFE, 0x88, 0xCC, 0x77, 0x33, 0x77, 0xCC, 0x88, 0xF0, 0x70,
+  0xC1, 0x83, 0x0E, 0x0C, 0x30, 0x31, 0x80, 0xC6, 0x6F, 0xF3, 0x81, 0xCE,
+  0x06, 0x58, 0x3B, 0xF0, 0xCF, 0xC7, 0x06, 0xF0, 0x70, 0x60, 0xC0, 0xC3,
+  0x81, 0x86, 0x03, 0x18, 0x06, 0x37, 0xBF, 0xC9, 0x83, 0x83, 0x06, 0x0E,
+  0x1C, 0x38, 0x30, 0xC0, 0xE1, 0xF0, 0xF8, 0x70, 0x61, 0x87, 0x0E, 0x06,
+  0x30, 0x19, 0x82, 0x66, 0x6F, 0x33, 0x81, 0xCE, 0x06, 0x58, 0x3B, 0xF0,
+  0xCF, 0xC7, 0x06, 0x18, 0x30, 0x60, 0x01, 0x87, 0x1C, 0x70, 0xC1, 0x87,
+  0xFB, 0xE0, 0x0C, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x19,
+  0x81, 0x98, 0x39, 0xC3, 0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0,
+  0x30, 0x03, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x19, 0x81,
+  0x98, 0x39, 0xC3, 0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0, 0x30,
+  0x0F, 0x01, 0x98, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x19, 0x81, 0x98,
+  0x39, 0xC3, 0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0, 0x30, 0x0D,
+  0x00, 0xF0, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0x98, 0x19,
+  0x83, 0x9C, 0x30, 0xC3, 0xFC, 0x7F, 0xE6, 0x06, 0x60, 0x6C, 0x03, 0x19,
+  0x81, 0x98, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x19, 0x81, 0x98, 0x39,
+  0xC3, 0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0, 0x30, 0x06, 0x00,
+  0x90, 0x09, 0x00, 0x60, 0x0F, 0x00, 0xF0, 0x19, 0x81, 0x98, 0x19, 0x83,
+  0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0, 0x30, 0x07, 0xFF, 0x0F,
+  0xFF, 0x0C, 0xC0, 0x1C, 0xC0, 0x18, 0xC0, 0x18, 0xFF, 0x30, 0xFF, 0x3F,
+  0xC0, 0x7F, 0xC0, 0x60, 0xC0, 0x60, 0xFF, 0xC0, 0xFF, 0x1F, 0x8F, 0xF7,
+  0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x1C, 0x13, 0xFC, 0x7E,
+  0x01, 0x00, 0x40, 0xF0, 0x30, 0x18, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x0C, 0x18, 0x00, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3C, 0x66,
+  0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF,
+  0xFF, 0x36, 0x36, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0,
+  0xC0, 0xC0, 0xFF, 0xFF, 0x63, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
+  0x6C, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x7B, 0x30, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0xCF, 0x30, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0x7F, 0x07, 0xFC, 0x61,
+  0xE6, 0x07, 0x60, 0x3F, 0x83, 0xF8, 0x36, 0x03, 0x60, 0x76, 0x1E, 0x7F,
+  0xC7, 0xF0, 0x1A, 0x0F, 0x82, 0xC0, 0x00, 0xE0, 0xFC, 0x3F, 0x0F, 0xE3,
+  0xD8, 0xF3, 0x3C, 0xCF, 0x1B, 0xC7, 0xF0, 0xFC, 0x3F, 0x07, 0x0C, 0x00,
+  0x60, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x0E, 0xE0, 0x7C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x03, 0x00, 0x60,
+  0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x0E, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x0F, 0x01, 0x98, 0x00,
+  0x01, 0xF8, 0x3F, 0xC7, 0x0E, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x0D, 0x00, 0xF0, 0x0B, 0x00,
+  0x00, 0x1F, 0x83, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8, 0x19, 0x81, 0x98, 0x00, 0x01,
+  0xF8, 0x3F, 0xC7, 0x0E, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E,
+  0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x41, 0x71, 0xDD, 0xC7, 0xC1, 0xC1,
+  0xF1, 0xDD, 0xC7, 0x41, 0x00, 0x07, 0xC8, 0xFF, 0xCE, 0x1C, 0xE0, 0xF6,
+  0x0D, 0xB1, 0xCD, 0x98, 0x6D, 0x83, 0x78, 0x39, 0xC3, 0x9F, 0xF8, 0x9F,
+  0x80, 0x18, 0x03, 0x00, 0x03, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0, 0x06, 0x03, 0x00, 0x03,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1,
+  0xDF, 0xE3, 0xF0, 0x1E, 0x0C, 0xC0, 0x03, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0, 0x33, 0x0C,
+  0xC0, 0x03, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xE1, 0xDF, 0xE3, 0xF0, 0x06, 0x03, 0x00, 0x03, 0x87, 0x61, 0x9C,
+  0xE3, 0x30, 0x78, 0x1E, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+  0xC0, 0x30, 0x0F, 0xF3, 0xFE, 0xC1, 0xF0, 0x3C, 0x0F, 0x07, 0xFF, 0xBF,
+  0xCC, 0x03, 0x00, 0x3C, 0x7F, 0xB0, 0xD8, 0xEC, 0xC6, 0xC3, 0x79, 0x9E,
+  0xC3, 0xE0, 0xF7, 0xFB, 0xE0, 0x60, 0x30, 0x18, 0x00, 0x3E, 0x7F, 0x03,
+  0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x06, 0x0C, 0x18, 0x00, 0x3E, 0x7F,
+  0x03, 0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x18, 0x3C, 0x66, 0x00, 0x3E,
+  0x7F, 0x03, 0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x1A, 0x3E, 0x2C, 0x00,
+  0x3E, 0x7F, 0x03, 0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x36, 0x36, 0x00,
+  0x3E, 0x7F, 0x03, 0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x18, 0x24, 0x24,
+  0x18, 0x00, 0x3E, 0x7F, 0x03, 0x7F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0x7E,
+  0x7C, 0x7F, 0xFE, 0x01, 0x83, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1, 0x80, 0xC3,
+  0xC1, 0xFE, 0xFF, 0x7C, 0x7E, 0x3E, 0x7F, 0xE1, 0xC0, 0xC0, 0xC0, 0xE1,
+  0x7F, 0x3E, 0x04, 0x04, 0x3C, 0x30, 0x0C, 0x03, 0x00, 0x03, 0xE3, 0xFB,
+  0x07, 0xFF, 0xFF, 0xE0, 0x38, 0x2F, 0xF3, 0xF0, 0x03, 0x03, 0x03, 0x00,
+  0x03, 0xE3, 0xFB, 0x07, 0xFF, 0xFF, 0xE0, 0x38, 0x2F, 0xF3, 0xF0, 0x0C,
+  0x0F, 0x0C, 0xC0, 0x03, 0xE3, 0xFB, 0x07, 0xFF, 0xFF, 0xE0, 0x38, 0x2F,
+  0xF3, 0xF0, 0x36, 0x1B, 0x00, 0x07, 0xC7, 0xF6, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x70, 0x5F, 0xE7, 0xE0, 0xC6, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x36,
+  0xC0, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x31, 0xEC, 0xC0, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0xCF, 0x30, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x79, 0x0F, 0x1F, 0x80, 0xE3, 0xF3, 0xFF, 0x87, 0x83, 0xC1, 0xF1,
+  0xDF, 0xC7, 0xC0, 0x1A, 0x1F, 0x0B, 0x00, 0x0D, 0xF7, 0xFF, 0x87, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x18, 0x30, 0x0C, 0x03, 0x00, 0x03, 0xE3,
+  0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, 0x03, 0x03, 0x03,
+  0x00, 0x03, 0xE3, 0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0,
+  0x1C, 0x0B, 0x08, 0x80, 0x03, 0xE3, 0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF8,
+  0xEF, 0xE3, 0xE0, 0x1A, 0x1F, 0x0B, 0x00, 0x03, 0xE3, 0xFB, 0x8F, 0x83,
+  0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, 0x36, 0x1B, 0x00, 0x07, 0xC7, 0xF7,
+  0x1F, 0x07, 0x83, 0xC1, 0xF1, 0xDF, 0xC7, 0xC0, 0x0C, 0x03, 0x00, 0x03,
+  0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x30, 0x00, 0x1F, 0x5F, 0xDC, 0x7C, 0x7E,
+  0xEF, 0xC7, 0xC7, 0x7F, 0x7F, 0x00, 0x00, 0x30, 0x0C, 0x03, 0x00, 0x0C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0xFF, 0xF7, 0xD8, 0x03, 0x03,
+  0x03, 0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0xFF, 0xF7,
+  0xD8, 0x1C, 0x0A, 0x08, 0x80, 0x0C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0xFF, 0xF7, 0xD8, 0x36, 0x1B, 0x00, 0x18, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE1, 0xFF, 0xEF, 0xB0, 0x03, 0x01, 0x80, 0xC0, 0x00, 0xC0,
+  0xD8, 0x66, 0x18, 0xC6, 0x33, 0x0C, 0xC1, 0xE0, 0x78, 0x0E, 0x03, 0x07,
+  0xC1, 0xE0, 0xC0, 0x60, 0x30, 0x1B, 0xCF, 0xF7, 0x1F, 0x07, 0x83, 0xC1,
+  0xF1, 0xFF, 0xDB, 0xCC, 0x06, 0x03, 0x00, 0x1B, 0x06, 0xC0, 0x03, 0x03,
+  0x61, 0x98, 0x63, 0x18, 0xCC, 0x33, 0x07, 0x81, 0xE0, 0x38, 0x0C, 0x1F,
+  0x07, 0x80 };
+
+const GFXglyph DejaVuSans_Bold8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   2,  12,   7,    2,  -11 },   // 0x21 '!'
+  {     4,   6,   4,   8,    1,  -11 },   // 0x22 '"'
+  {     7,  11,  12,  13,    1,  -11 },   // 0x23 '#'
+  {    24,   7,  14,  11,    3,  -11 },   // 0x24 '$'
+  {    37,  15,  12,  16,    1,  -11 },   // 0x25 '%'
+  {    60,  12,  12,  14,    1,  -11 },   // 0x26 '&'
+  {    78,   2,   4,   5,    1,  -11 },   // 0x27 '''
+  {    79,   4,  14,   7,    1,  -11 },   // 0x28 '('
+  {    86,   4,  14,   7,    1,  -11 },   // 0x29 ')'
+  {    93,   7,   7,   8,    1,  -11 },   // 0x2A '*'
+  {   100,  10,  10,  13,    2,   -9 },   // 0x2B '+'
+  {   113,   3,   5,   6,    0,   -2 },   // 0x2C ','
+  {   115,   5,   2,   7,    1,   -5 },   // 0x2D '-'
+  {   117,   2,   3,   6,    1,   -2 },   // 0x2E '.'
+  {   118,   6,  13,   6,    0,  -11 },   // 0x2F '/'
+  {   128,   9,  12,  11,    1,  -11 },   // 0x30 '0'
+  {   142,   8,  12,  11,    2,  -11 },   // 0x31 '1'
+  {   154,   8,  12,  11,    1,  -11 },   // 0x32 '2'
+  {   166,   9,  12,  11,    1,  -11 },   // 0x33 '3'
+  {   180,  10,  12,  11,    1,  -11 },   // 0x34 '4'
+  {   195,   9,  12,  11,    1,  -11 },   // 0x35 '5'
+  {   209,   9,  12,  11,    1,  -11 },   // 0x36 '6'
+  {   223,   9,  12,  11,    1,  -11 },   // 0x37 '7'
+  {   237,   9,  12,  11,    1,  -11 },   // 0x38 '8'
+  {   251,   9,  12,  11,    1,  -11 },   // 0x39 '9'
+  {   265,   2,   9,   6,    1,   -8 },   // 0x3A ':'
+  {   268,   3,  11,   6,    0,   -8 },   // 0x3B ';'
+  {   273,  10,   9,  13,    2,   -9 },   // 0x3C '<'
+  {   285,  10,   6,  13,    2,   -7 },   // 0x3D '='
+  {   293,  10,   9,  13,    2,   -9 },   // 0x3E '>'
+  {   305,   7,  12,   9,    1,  -11 },   // 0x3F '?'
+  {   316,  14,  14,  16,    1,  -11 },   // 0x40 '@'
+  {   341,  12,  12,  12,    0,  -11 },   // 0x41 'A'
+  {   359,  10,  12,  12,    1,  -11 },   // 0x42 'B'
+  {   374,  10,  12,  12,    1,  -11 },   // 0x43 'C'
+  {   389,  11,  12,  13,    1,  -11 },   // 0x44 'D'
+  {   406,   8,  12,  10,    1,  -11 },   // 0x45 'E'
+  {   418,   8,  12,  10,    1,  -11 },   // 0x46 'F'
+  {   430,  11,  12,  13,    1,  -11 },   // 0x47 'G'
+  {   447,  10,  12,  12,    1,  -11 },   // 0x48 'H'
+  {   462,   2,  12,   6,    2,  -11 },   // 0x49 'I'
+  {   465,   4,  15,   6,    0,  -11 },   // 0x4A 'J'
+  {   473,  11,  12,  11,    1,  -11 },   // 0x4B 'K'
+  {   490,   8,  12,  10,    1,  -11 },   // 0x4C 'L'
+  {   502,  13,  12,  16,    1,  -11 },   // 0x4D 'M'
+  {   522,  10,  12,  13,    1,  -11 },   // 0x4E 'N'
+  {   537,  12,  12,  14,    1,  -11 },   // 0x4F 'O'
+  {   555,  10,  12,  12,    1,  -11 },   // 0x50 'P'
+  {   570,  12,  14,  14,    1,  -11 },   // 0x51 'Q'
+  {   591,  10,  12,  12,    1,  -11 },   // 0x52 'R'
+  {   606,   9,  12,  11,    1,  -11 },   // 0x53 'S'
+  {   620,  10,  12,  11,    0,  -11 },   // 0x54 'T'
+  {   635,  10,  12,  12,    1,  -11 },   // 0x55 'U'
+  {   650,  12,  12,  12,    0,  -11 },   // 0x56 'V'
+  {   668,  17,  12,  18,    0,  -11 },   // 0x57 'W'
+  {   694,  12,  12,  12,    0,  -11 },   // 0x58 'X'
+  {   712,  10,  12,  12,    0,  -11 },   // 0x59 'Y'
+  {   727,  10,  12,  12,    1,  -11 },   // 0x5A 'Z'
+  {   742,   4,  14,   7,    1,  -11 },   // 0x5B '['
+  {   749,   6,  13,   6,    0,  -11 },   // 0x5C '\'
+  {   759,   4,  14,   7,    1,  -11 },   // 0x5D ']'
+  {   766,  10,   4,  13,    2,  -11 },   // 0x5E '^'
+  {   771,   8,   1,   8,    0,    4 },   // 0x5F '_'
+  {   772,   4,   3,   8,    1,  -12 },   // 0x60 '`'
+  {   774,   8,   9,  10,    1,   -8 },   // 0x61 'a'
+  {   783,   9,  12,  11,    1,  -11 },   // 0x62 'b'
+  {   797,   8,   9,  10,    1,   -8 },   // 0x63 'c'
+  {   806,   9,  12,  11,    1,  -11 },   // 0x64 'd'
+  {   820,   9,   9,  11,    1,   -8 },   // 0x65 'e'
+  {   831,   6,  12,   7,    1,  -11 },   // 0x66 'f'
+  {   840,   9,  12,  11,    1,   -8 },   // 0x67 'g'
+  {   854,   9,  12,  11,    1,  -11 },   // 0x68 'h'
+  {   868,   2,  12,   4,    1,  -11 },   // 0x69 'i'
+  {   871,   4,  15,   4,   -1,  -11 },   // 0x6A 'j'
+  {   879,  10,  12,  11,    1,  -11 },   // 0x6B 'k'
+  {   894,   2,  12,   4,    1,  -11 },   // 0x6C 'l'
+  {   897,  14,   9,  16,    1,   -8 },   // 0x6D 'm'
+  {   913,   9,   9,  11,    1,   -8 },   // 0x6E 'n'
+  {   924,   9,   9,  11,    1,   -8 },   // 0x6F 'o'
+  {   935,   9,  12,  11,    1,   -8 },   // 0x70 'p'
+  {   949,   9,  12,  11,    1,   -8 },   // 0x71 'q'
+  {   963,   7,   9,   8,    1,   -8 },   // 0x72 'r'
+  {   971,   8,   9,  10,    1,   -8 },   // 0x73 's'
+  {   980,   6,  11,   8,    1,  -10 },   // 0x74 't'
+  {   989,   9,   9,  11,    1,   -8 },   // 0x75 'u'
+  {  1000,  10,   9,  10,    0,   -8 },   // 0x76 'v'
+  {  1012,  13,   9,  15,    1,   -8 },   // 0x77 'w'
+  {  1027,  10,   9,  10,    0,   -8 },   // 0x78 'x'
+  {  1039,  10,  12,  10,    0,   -8 },   // 0x79 'y'
+  {  1054,   8,   9,   9,    1,   -8 },   // 0x7A 'z'
+  {  1063,   6,  15,  11,    2,  -11 },   // 0x7B '{'
+  {  1075,   2,  16,   6,    2,  -11 },   // 0x7C '|'
+  {  1079,   6,  15,  11,    2,  -11 },   // 0x7D '}'
+  {  1091,  10,   3,  13,    2,   -5 },   // 0x7E '~'
+  {  1095,   8,  14,  10,    1,  -10 },   // 0x7F
+  {  1109,   8,  14,  10,    1,  -10 },   // 0x80
+  {  1123,   8,  14,  10,    1,  -10 },   // 0x81
+  {  1137,   8,  14,  10,    1,  -10 },   // 0x82
+  {  1151,   8,  14,  10,    1,  -10 },   // 0x83
+  {  1165,   8,  14,  10,    1,  -10 },   // 0x84
+  {  1179,   8,  14,  10,    1,  -10 },   // 0x85
+  {  1193,   8,  14,  10,    1,  -10 },   // 0x86
+  {  1207,   8,  14,  10,    1,  -10 },   // 0x87
+  {  1221,   8,  14,  10,    1,  -10 },   // 0x88
+  {  1235,   8,  14,  10,    1,  -10 },   // 0x89
+  {  1249,   8,  14,  10,    1,  -10 },   // 0x8A
+  {  1263,   8,  14,  10,    1,  -10 },   // 0x8B
+  {  1277,   8,  14,  10,    1,  -10 },   // 0x8C
+  {  1291,   8,  14,  10,    1,  -10 },   // 0x8D
+  {  1305,   8,  14,  10,    1,  -10 },   // 0x8E
+  {  1319,   8,  14,  10,    1,  -10 },   // 0x8F
+  {  1333,   8,  14,  10,    1,  -10 },   // 0x90
+  {  1347,   8,  14,  10,    1,  -10 },   // 0x91
+  {  1361,   8,  14,  10,    1,  -10 },   // 0x92
+  {  1375,   8,  14,  10,    1,  -10 },   // 0x93
+  {  1389,   8,  14,  10,    1,  -10 },   // 0x94
+  {  1403,   8,  14,  10,    1,  -10 },   // 0x95
+  {  1417,   8,  14,  10,    1,  -10 },   // 0x96
+  {  1431,   8,  14,  10,    1,  -10 },   // 0x97
+  {  1445,   8,  14,  10,    1,  -10 },   // 0x98
+  {  1459,   8,  14,  10,    1,  -10 },   // 0x99
+  {  1473,   8,  14,  10,    1,  -10 },   // 0x9A
+  {  1487,   8,  14,  10,    1,  -10 },   // 0x9B
+  {  1501,   8,  14,  10,    1,  -10 },   // 0x9C
+  {  1515,   8,  14,  10,    1,  -10 },   // 0x9D
+  {  1529,   8,  14,  10,    1,  -10 },   // 0x9E
+  {  1543,   8,  14,  10,    1,  -10 },   // 0x9F
+  {  1557,   1,   1,   6,    0,    0 },   // 0xA0
+  {  1558,   2,  12,   7,    2,   -8 },   // 0xA1
+  {  1561,   7,  13,  11,    1,  -10 },   // 0xA2
+  {  1573,   8,  12,  11,    1,  -11 },   // 0xA3
+  {  1585,   9,   9,  10,    1,   -8 },   // 0xA4
+  {  1596,  10,  12,  11,    0,  -11 },   // 0xA5
+  {  1611,   2,  14,   6,    2,  -10 },   // 0xA6
+  {  1615,   8,  14,   8,    1,  -11 },   // 0xA7
+  {  1629,   5,   2,   8,    2,  -11 },   // 0xA8
+  {  1631,  12,  12,  16,    2,  -11 },   // 0xA9
+  {  1649,   7,   9,   9,    1,  -11 },   // 0xAA
+  {  1657,   8,   7,  10,    1,   -7 },   // 0xAB
+  {  1664,  10,   5,  13,    2,   -6 },   // 0xAC
+  {  1671,   5,   2,   7,    1,   -5 },   // 0xAD
+  {  1673,  12,  12,  16,    2,  -11 },   // 0xAE
+  {  1691,   5,   1,   8,    2,  -11 },   // 0xAF
+  {  1692,   5,   5,   8,    1,  -11 },   // 0xB0
+  {  1696,  10,  10,  13,    2,   -9 },   // 0xB1
+  {  1709,   5,   7,   7,    1,  -11 },   // 0xB2
+  {  1714,   5,   7,   7,    1,  -11 },   // 0xB3
+  {  1719,   4,   3,   8,    3,  -12 },   // 0xB4
+  {  1721,  10,  12,  12,    1,   -8 },   // 0xB5
+  {  1736,   8,  14,  10,    1,  -11 },   // 0xB6
+  {  1750,   2,   3,   6,    1,   -6 },   // 0xB7
+  {  1751,   4,   3,   8,    2,    1 },   // 0xB8
+  {  1753,   6,   7,   7,    1,  -11 },   // 0xB9
+  {  1759,   7,   9,   9,    1,  -11 },   // 0xBA
+  {  1767,   8,   7,  10,    2,   -7 },   // 0xBB
+  {  1774,  14,  12,  17,    1,  -11 },   // 0xBC
+  {  1795,  15,  12,  17,    1,  -11 },   // 0xBD
+  {  1818,  14,  12,  17,    1,  -11 },   // 0xBE
+  {  1839,   7,  12,   9,    1,   -8 },   // 0xBF
+  {  1850,  12,  15,  12,    0,  -14 },   // 0xC0
+  {  1873,  12,  15,  12,    0,  -14 },   // 0xC1
+  {  1896,  12,  15,  12,    0,  -14 },   // 0xC2
+  {  1919,  12,  16,  12,    0,  -15 },   // 0xC3
+  {  1943,  12,  15,  12,    0,  -14 },   // 0xC4
+  {  1966,  12,  15,  12,    0,  -14 },   // 0xC5
+  {  1989,  16,  12,  17,    0,  -11 },   // 0xC6
+  {  2013,  10,  15,  12,    1,  -11 },   // 0xC7
+  {  2032,   8,  15,  10,    1,  -14 },   // 0xC8
+  {  2047,   8,  15,  10,    1,  -14 },   // 0xC9
+  {  2062,   8,  15,  10,    1,  -14 },   // 0xCA
+  {  2077,   8,  15,  10,    1,  -14 },   // 0xCB
+  {  2092,   4,  15,   6,    0,  -14 },   // 0xCC
+  {  2100,   4,  15,   6,    2,  -14 },   // 0xCD
+  {  2108,   6,  15,   6,    0,  -14 },   // 0xCE
+  {  2120,   6,  15,   6,    0,  -14 },   // 0xCF
+  {  2132,  12,  12,  13,    0,  -11 },   // 0xD0
+  {  2150,  10,  16,  13,    1,  -15 },   // 0xD1
+  {  2170,  12,  15,  14,    1,  -14 },   // 0xD2
+  {  2193,  12,  15,  14,    1,  -14 },   // 0xD3
+  {  2216,  12,  15,  14,    1,  -14 },   // 0xD4
+  {  2239,  12,  16,  14,    1,  -15 },   // 0xD5
+  {  2263,  12,  15,  14,    1,  -14 },   // 0xD6
+  {  2286,   9,   9,  13,    2,   -9 },   // 0xD7
+  {  2297,  13,  12,  14,    0,  -11 },   // 0xD8
+  {  2317,  10,  15,  12,    1,  -14 },   // 0xD9
+  {  2336,  10,  15,  12,    1,  -14 },   // 0xDA
+  {  2355,  10,  15,  12,    1,  -14 },   // 0xDB
+  {  2374,  10,  15,  12,    1,  -14 },   // 0xDC
+  {  2393,  10,  15,  12,    0,  -14 },   // 0xDD
+  {  2412,  10,  12,  12,    1,  -11 },   // 0xDE
+  {  2427,   9,  12,  11,    1,  -11 },   // 0xDF
+  {  2441,   8,  13,  10,    1,  -12 },   // 0xE0
+  {  2454,   8,  13,  10,    1,  -12 },   // 0xE1
+  {  2467,   8,  13,  10,    1,  -12 },   // 0xE2
+  {  2480,   8,  13,  10,    1,  -12 },   // 0xE3
+  {  2493,   8,  12,  10,    1,  -11 },   // 0xE4
+  {  2505,   8,  14,  10,    1,  -13 },   // 0xE5
+  {  2519,  16,   9,  18,    1,   -8 },   // 0xE6
+  {  2537,   8,  12,  10,    1,   -8 },   // 0xE7
+  {  2549,   9,  13,  11,    1,  -12 },   // 0xE8
+  {  2564,   9,  13,  11,    1,  -12 },   // 0xE9
+  {  2579,   9,  13,  11,    1,  -12 },   // 0xEA
+  {  2594,   9,  12,  11,    1,  -11 },   // 0xEB
+  {  2608,   4,  13,   4,   -1,  -12 },   // 0xEC
+  {  2615,   4,  13,   4,    1,  -12 },   // 0xED
+  {  2622,   6,  13,   4,   -1,  -12 },   // 0xEE
+  {  2632,   6,  12,   4,   -1,  -11 },   // 0xEF
+  {  2641,   9,  12,  11,    1,  -11 },   // 0xF0
+  {  2655,   9,  13,  11,    1,  -12 },   // 0xF1
+  {  2670,   9,  13,  11,    1,  -12 },   // 0xF2
+  {  2685,   9,  13,  11,    1,  -12 },   // 0xF3
+  {  2700,   9,  13,  11,    1,  -12 },   // 0xF4
+  {  2715,   9,  13,  11,    1,  -12 },   // 0xF5
+  {  2730,   9,  12,  11,    1,  -11 },   // 0xF6
+  {  2744,  10,   8,  13,    2,   -8 },   // 0xF7
+  {  2754,   9,  11,  11,    1,   -9 },   // 0xF8
+  {  2767,   9,  13,  11,    1,  -12 },   // 0xF9
+  {  2782,   9,  13,  11,    1,  -12 },   // 0xFA
+  {  2797,   9,  13,  11,    1,  -12 },   // 0xFB
+  {  2812,   9,  12,  11,    1,  -11 },   // 0xFC
+  {  2826,  10,  16,  10,    0,  -12 },   // 0xFD
+  {  2846,   9,  15,  11,    1,  -11 },   // 0xFE
+  {  2863,  10,  15,  10,    0,  -11 } }; // 0xFF
+
+const GFXfont DejaVuSans_Bold8pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Bold8pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Bold8pt8bGlyphs,
+  0x20, 0xFF, 18 };
+
+// Approx. 4457 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Bold8pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   2,   7,   4 },   // 0x21
+  {   1,   8,   7 },   // 0x22
+  {   1,  13,  12 },   // 0x23
+  {   3,  11,  10 },   // 0x24
+  {   1,  16,  16 },   // 0x25
+  {   1,  14,  13 },   // 0x26
+  {   1,   5,   3 },   // 0x27
+  {   1,   7,   5 },   // 0x28
+  {   1,   7,   5 },   // 0x29
+  {   1,   8,   8 },   // 0x2A
+  {   2,  13,  12 },   // 0x2B
+  {   0,   6,   3 },   // 0x2C
+  {   1,   7,   6 },   // 0x2D
+  {   1,   6,   3 },   // 0x2E
+  {   0,   6,   6 },   // 0x2F
+  {   1,  11,  10 },   // 0x30
+  {   2,  11,  10 },   // 0x31
+  {   1,  11,   9 },   // 0x32
+  {   1,  11,  10 },   // 0x33
+  {   1,  11,  11 },   // 0x34
+  {   1,  11,  10 },   // 0x35
+  {   1,  11,  10 },   // 0x36
+  {   1,  11,  10 },   // 0x37
+  {   1,  11,  10 },   // 0x38
+  {   1,  11,  10 },   // 0x39
+  {   1,   6,   3 },   // 0x3A
+  {   0,   6,   3 },   // 0x3B
+  {   2,  13,  12 },   // 0x3C
+  {   2,  13,  12 },   // 0x3D
+  {   2,  13,  12 },   // 0x3E
+  {   1,   9,   8 },   // 0x3F
+  {   1,  16,  15 },   // 0x40
+  {   0,  12,  12 },   // 0x41
+  {   1,  12,  11 },   // 0x42
+  {   1,  12,  11 },   // 0x43
+  {   1,  13,  12 },   // 0x44
+  {   1,  10,   9 },   // 0x45
+  {   1,  10,   9 },   // 0x46
+  {   1,  13,  12 },   // 0x47
+  {   1,  12,  11 },   // 0x48
+  {   2,   6,   4 },   // 0x49
+  {   0,   6,   4 },   // 0x4A
+  {   1,  11,  12 },   // 0x4B
+  {   1,  10,   9 },   // 0x4C
+  {   1,  16,  14 },   // 0x4D
+  {   1,  13,  11 },   // 0x4E
+  {   1,  14,  13 },   // 0x4F
+  {   1,  12,  11 },   // 0x50
+  {   1,  14,  13 },   // 0x51
+  {   1,  12,  11 },   // 0x52
+  {   1,  11,  10 },   // 0x53
+  {   0,  11,  10 },   // 0x54
+  {   1,  12,  11 },   // 0x55
+  {   0,  12,  12 },   // 0x56
+  {   0,  18,  17 },   // 0x57
+  {   0,  12,  12 },   // 0x58
+  {   0,  12,  10 },   // 0x59
+  {   1,  12,  11 },   // 0x5A
+  {   1,   7,   5 },   // 0x5B
+  {   0,   6,   6 },   // 0x5C
+  {   1,   7,   5 },   // 0x5D
+  {   2,  13,  12 },   // 0x5E
+  {   0,   8,   8 },   // 0x5F
+  {   1,   8,   5 },   // 0x60
+  {   1,  10,   9 },   // 0x61
+  {   1,  11,  10 },   // 0x62
+  {   1,  10,   9 },   // 0x63
+  {   1,  11,  10 },   // 0x64
+  {   1,  11,  10 },   // 0x65
+  {   1,   7,   7 },   // 0x66
+  {   1,  11,  10 },   // 0x67
+  {   1,  11,  10 },   // 0x68
+  {   1,   4,   3 },   // 0x69
+  {  -1,   4,   3 },   // 0x6A
+  {   1,  11,  11 },   // 0x6B
+  {   1,   4,   3 },   // 0x6C
+  {   1,  16,  15 },   // 0x6D
+  {   1,  11,  10 },   // 0x6E
+  {   1,  11,  10 },   // 0x6F
+  {   1,  11,  10 },   // 0x70
+  {   1,  11,  10 },   // 0x71
+  {   1,   8,   8 },   // 0x72
+  {   1,  10,   9 },   // 0x73
+  {   1,   8,   7 },   // 0x74
+  {   1,  11,  10 },   // 0x75
+  {   0,  10,  10 },   // 0x76
+  {   1,  15,  14 },   // 0x77
+  {   0,  10,  10 },   // 0x78
+  {   0,  10,  10 },   // 0x79
+  {   1,   9,   9 },   // 0x7A
+  {   2,  11,   8 },   // 0x7B
+  {   2,   6,   4 },   // 0x7C
+  {   2,  11,   8 },   // 0x7D
+  {   2,  13,  12 },   // 0x7E
+  {   1,  10,   9 },   // 0x7F
+  {   1,  10,   9 },   // 0x80
+  {   1,  10,   9 },   // 0x81
+  {   1,  10,   9 },   // 0x82
+  {   1,  10,   9 },   // 0x83
+  {   1,  10,   9 },   // 0x84
+  {   1,  10,   9 },   // 0x85
+  {   1,  10,   9 },   // 0x86
+  {   1,  10,   9 },   // 0x87
+  {   1,  10,   9 },   // 0x88
+  {   1,  10,   9 },   // 0x89
+  {   1,  10,   9 },   // 0x8A
+  {   1,  10,   9 },   // 0x8B
+  {   1,  10,   9 },   // 0x8C
+  {   1,  10,   9 },   // 0x8D
+  {   1,  10,   9 },   // 0x8E
+  {   1,  10,   9 },   // 0x8F
+  {   1,  10,   9 },   // 0x90
+  {   1,  10,   9 },   // 0x91
+  {   1,  10,   9 },   // 0x92
+  {   1,  10,   9 },   // 0x93
+  {   1,  10,   9 },   // 0x94
+  {   1,  10,   9 },   // 0x95
+  {   1,  10,   9 },   // 0x96
+  {   1,  10,   9 },   // 0x97
+  {   1,  10,   9 },   // 0x98
+  {   1,  10,   9 },   // 0x99
+  {   1,  10,   9 },   // 0x9A
+  {   1,  10,   9 },   // 0x9B
+  {   1,  10,   9 },   // 0x9C
+  {   1,  10,   9 },   // 0x9D
+  {   1,  10,   9 },   // 0x9E
+  {   1,  10,   9 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   2,   7,   4 },   // 0xA1
+  {   1,  11,   8 },   // 0xA2
+  {   1,  11,   9 },   // 0xA3
+  {   1,  10,  10 },   // 0xA4
+  {   0,  11,  10 },   // 0xA5
+  {   2,   6,   4 },   // 0xA6
+  {   1,   8,   9 },   // 0xA7
+  {   2,   8,   7 },   // 0xA8
+  {   2,  16,  14 },   // 0xA9
+  {   1,   9,   8 },   // 0xAA
+  {   1,  10,   9 },   // 0xAB
+  {   2,  13,  12 },   // 0xAC
+  {   1,   7,   6 },   // 0xAD
+  {   2,  16,  14 },   // 0xAE
+  {   2,   8,   7 },   // 0xAF
+  {   1,   8,   6 },   // 0xB0
+  {   2,  13,  12 },   // 0xB1
+  {   1,   7,   6 },   // 0xB2
+  {   1,   7,   6 },   // 0xB3
+  {   3,   8,   7 },   // 0xB4
+  {   1,  12,  11 },   // 0xB5
+  {   1,  10,   9 },   // 0xB6
+  {   1,   6,   3 },   // 0xB7
+  {   2,   8,   6 },   // 0xB8
+  {   1,   7,   7 },   // 0xB9
+  {   1,   9,   8 },   // 0xBA
+  {   2,  10,  10 },   // 0xBB
+  {   1,  17,  15 },   // 0xBC
+  {   1,  17,  16 },   // 0xBD
+  {   1,  17,  15 },   // 0xBE
+  {   1,   9,   8 },   // 0xBF
+  {   0,  12,  12 },   // 0xC0
+  {   0,  12,  12 },   // 0xC1
+  {   0,  12,  12 },   // 0xC2
+  {   0,  12,  12 },   // 0xC3
+  {   0,  12,  12 },   // 0xC4
+  {   0,  12,  12 },   // 0xC5
+  {   0,  17,  16 },   // 0xC6
+  {   1,  12,  11 },   // 0xC7
+  {   1,  10,   9 },   // 0xC8
+  {   1,  10,   9 },   // 0xC9
+  {   1,  10,   9 },   // 0xCA
+  {   1,  10,   9 },   // 0xCB
+  {   0,   6,   4 },   // 0xCC
+  {   2,   6,   6 },   // 0xCD
+  {   0,   6,   6 },   // 0xCE
+  {   0,   6,   6 },   // 0xCF
+  {   0,  13,  12 },   // 0xD0
+  {   1,  13,  11 },   // 0xD1
+  {   1,  14,  13 },   // 0xD2
+  {   1,  14,  13 },   // 0xD3
+  {   1,  14,  13 },   // 0xD4
+  {   1,  14,  13 },   // 0xD5
+  {   1,  14,  13 },   // 0xD6
+  {   2,  13,  11 },   // 0xD7
+  {   0,  14,  13 },   // 0xD8
+  {   1,  12,  11 },   // 0xD9
+  {   1,  12,  11 },   // 0xDA
+  {   1,  12,  11 },   // 0xDB
+  {   1,  12,  11 },   // 0xDC
+  {   0,  12,  10 },   // 0xDD
+  {   1,  12,  11 },   // 0xDE
+  {   1,  11,  10 },   // 0xDF
+  {   1,  10,   9 },   // 0xE0
+  {   1,  10,   9 },   // 0xE1
+  {   1,  10,   9 },   // 0xE2
+  {   1,  10,   9 },   // 0xE3
+  {   1,  10,   9 },   // 0xE4
+  {   1,  10,   9 },   // 0xE5
+  {   1,  18,  17 },   // 0xE6
+  {   1,  10,   9 },   // 0xE7
+  {   1,  11,  10 },   // 0xE8
+  {   1,  11,  10 },   // 0xE9
+  {   1,  11,  10 },   // 0xEA
+  {   1,  11,  10 },   // 0xEB
+  {  -1,   4,   3 },   // 0xEC
+  {   1,   4,   5 },   // 0xED
+  {  -1,   4,   5 },   // 0xEE
+  {  -1,   4,   5 },   // 0xEF
+  {   1,  11,  10 },   // 0xF0
+  {   1,  11,  10 },   // 0xF1
+  {   1,  11,  10 },   // 0xF2
+  {   1,  11,  10 },   // 0xF3
+  {   1,  11,  10 },   // 0xF4
+  {   1,  11,  10 },   // 0xF5
+  {   1,  11,  10 },   // 0xF6
+  {   2,  13,  12 },   // 0xF7
+  {   1,  11,  10 },   // 0xF8
+  {   1,  11,  10 },   // 0xF9
+  {   1,  11,  10 },   // 0xFA
+  {   1,  11,  10 },   // 0xFB
+  {   1,  11,  10 },   // 0xFC
+  {   0,  10,  10 },   // 0xFD
+  {   1,  11,  10 },   // 0xFE
+  {   0,  10,  10 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Bold8pt8bWidths = { DejaVuSans_Bold8pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSBOLD8PTLAT1__H
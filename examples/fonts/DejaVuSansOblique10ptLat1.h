@@ -0,0 +1,844 @@
+#ifndef DEJAVUSANSOBLIQUE10PTLAT1__H
+#define DEJAVUSANSOBLIQUE10PTLAT1__H
+const uint8_t DejaVuSans_Oblique10pt8bBitmaps[] PROGMEM = {
+  0x00, 0x18, 0xC6, 0x33, 0x18, 0xC6, 0x31, 0x08, 0x00, 0x63, 0x00, 0xCF,
+  0x3C, 0xF3, 0xCC, 0x02, 0x30, 0x18, 0x80, 0x62, 0x01, 0x18, 0x7F, 0xFD,
+  0xFF, 0xF0, 0xC4, 0x03, 0x30, 0x08, 0xC3, 0xFF, 0xEF, 0xFF, 0x86, 0x60,
+  0x11, 0x80, 0x46, 0x03, 0x10, 0x00, 0x02, 0x00, 0x80, 0xF8, 0xFF, 0x74,
+  0x99, 0x06, 0x41, 0xD0, 0x3E, 0x02, 0xE0, 0x98, 0x26, 0x8B, 0xBF, 0xC7,
+  0xE0, 0x40, 0x10, 0x04, 0x00, 0x3C, 0x0C, 0xCC, 0x33, 0x18, 0x46, 0x31,
+  0x0C, 0x66, 0x18, 0xD8, 0x33, 0x20, 0x3C, 0x9E, 0x03, 0x66, 0x0D, 0x8C,
+  0x13, 0x18, 0x46, 0x31, 0x8C, 0x66, 0x19, 0x88, 0x1E, 0x00, 0x07, 0xC0,
+  0x3F, 0x81, 0xC2, 0x06, 0x00, 0x18, 0x00, 0x70, 0x01, 0xC0, 0x0D, 0x83,
+  0x67, 0x1B, 0x0E, 0x6C, 0x1F, 0x30, 0x38, 0xE1, 0xE1, 0xFF, 0xC3, 0xF3,
+  0x80, 0xFF, 0xC0, 0x06, 0x18, 0x60, 0xC3, 0x0E, 0x18, 0x30, 0xC1, 0x83,
+  0x06, 0x0C, 0x18, 0x30, 0x20, 0x60, 0x40, 0x08, 0x18, 0x30, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0C, 0x30, 0x61, 0xC3, 0x0C, 0x18, 0x61, 0x80, 0x08,
+  0x04, 0x22, 0x2D, 0x61, 0xC0, 0xE1, 0xAD, 0x11, 0x08, 0x04, 0x00, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x6D, 0xE8, 0xFF, 0xF0, 0xF0, 0x00, 0x80,
+  0x60, 0x10, 0x0C, 0x02, 0x01, 0x80, 0x40, 0x30, 0x08, 0x06, 0x01, 0x00,
+  0xC0, 0x20, 0x18, 0x04, 0x03, 0x00, 0x07, 0x83, 0xF8, 0xE3, 0x98, 0x36,
+  0x06, 0xC0, 0xF8, 0x1E, 0x03, 0xC0, 0x78, 0x1B, 0x03, 0x60, 0xCE, 0x38,
+  0xFE, 0x0F, 0x00, 0x07, 0x0F, 0x8C, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x03, 0x01, 0x80, 0xC7, 0xFF, 0xFE, 0x0F, 0x83, 0xF8, 0xC3,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x38, 0x0E, 0x03, 0x81, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xFF, 0x3F, 0xE0, 0x0F, 0x83, 0xFC, 0x43, 0x80, 0x30, 0x06,
+  0x01, 0x83, 0xE0, 0x7C, 0x01, 0xC0, 0x18, 0x03, 0x00, 0xE8, 0x39, 0xFE,
+  0x1F, 0x80, 0x00, 0xE0, 0x3C, 0x0F, 0x81, 0x60, 0x4C, 0x19, 0x86, 0x31,
+  0x8E, 0x21, 0x88, 0x33, 0xFF, 0xFF, 0xF0, 0x38, 0x06, 0x00, 0xC0, 0x1F,
+  0xE3, 0xFC, 0x60, 0x0C, 0x03, 0x00, 0x7E, 0x0F, 0xE1, 0x0E, 0x00, 0xC0,
+  0x18, 0x03, 0x00, 0xC8, 0x39, 0xFE, 0x1F, 0x00, 0x07, 0xC3, 0xFC, 0xE0,
+  0x98, 0x06, 0x00, 0xC0, 0x3B, 0xC6, 0xFC, 0xF1, 0xD8, 0x1B, 0x03, 0x60,
+  0x6E, 0x38, 0xFE, 0x0F, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0x00, 0xC0, 0x38,
+  0x06, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x80, 0x60, 0x18, 0x07, 0x00, 0xC0,
+  0x38, 0x00, 0x0F, 0x83, 0xF8, 0xE3, 0x98, 0x33, 0x06, 0x71, 0x87, 0xE1,
+  0xFC, 0x61, 0xD8, 0x1B, 0x03, 0x60, 0x6E, 0x18, 0xFF, 0x0F, 0x80, 0x0F,
+  0x83, 0xF8, 0xE3, 0xB0, 0x36, 0x06, 0xC0, 0xDC, 0x79, 0xFB, 0x1E, 0xE0,
+  0x18, 0x03, 0x00, 0xC8, 0x39, 0xFE, 0x1F, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0xCC, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x63, 0x19, 0x88, 0x00, 0x00, 0x08,
+  0x03, 0xC0, 0xFC, 0x3F, 0x0F, 0xC0, 0x78, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+  0xF0, 0x03, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFC, 0x80, 0x07, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x3C,
+  0x07, 0xE1, 0xF8, 0x7E, 0x07, 0x80, 0x20, 0x00, 0x3E, 0xFF, 0x83, 0x03,
+  0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60, 0x00, 0xC0, 0xC0, 0x01,
+  0xFC, 0x01, 0xFF, 0xC0, 0xF0, 0x78, 0x70, 0x06, 0x38, 0x00, 0xDC, 0x3B,
+  0x36, 0x3F, 0x8F, 0x8C, 0x63, 0xC6, 0x08, 0xF1, 0x86, 0x6C, 0x61, 0xBB,
+  0x1F, 0xFC, 0xC3, 0xDC, 0x18, 0x00, 0x07, 0x00, 0x80, 0xE0, 0xE0, 0x1F,
+  0xF0, 0x01, 0xF0, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x36,
+  0x03, 0x30, 0x19, 0xC1, 0x86, 0x0C, 0x30, 0xC1, 0x8F, 0xFC, 0x7F, 0xE7,
+  0x01, 0xB0, 0x0F, 0x80, 0x60, 0x1F, 0xC1, 0xFF, 0x38, 0x33, 0x03, 0x30,
+  0x33, 0x06, 0x3F, 0xC7, 0xFC, 0x60, 0xE6, 0x06, 0x60, 0x66, 0x06, 0xE0,
+  0xCF, 0xFC, 0xFF, 0x00, 0x07, 0xF0, 0x7F, 0xC7, 0x06, 0x60, 0x07, 0x00,
+  0x30, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0xC0, 0x07,
+  0x02, 0x1F, 0xF0, 0x7E, 0x00, 0x1F, 0xE0, 0x7F, 0xC3, 0x83, 0x8C, 0x07,
+  0x30, 0x0C, 0xC0, 0x33, 0x00, 0xDC, 0x03, 0x60, 0x0D, 0x80, 0x66, 0x01,
+  0x98, 0x0C, 0xE0, 0xF3, 0xFF, 0x0F, 0xF0, 0x00, 0x1F, 0xF1, 0xFF, 0x38,
+  0x03, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xE7, 0xFC, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0x80, 0x1F, 0xE3, 0xFC, 0xE0, 0x18,
+  0x03, 0x00, 0x60, 0x0F, 0xE3, 0xFC, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x0E,
+  0x01, 0x80, 0x30, 0x00, 0x03, 0xF8, 0x3F, 0xF1, 0xC0, 0x8C, 0x00, 0x70,
+  0x01, 0x80, 0x0C, 0x00, 0x30, 0x3E, 0xC0, 0xFB, 0x00, 0xCC, 0x03, 0x38,
+  0x0C, 0x70, 0x70, 0xFF, 0x81, 0xF8, 0x00, 0x18, 0x0C, 0x60, 0x33, 0x81,
+  0xCC, 0x06, 0x30, 0x18, 0xC0, 0x63, 0xFF, 0x9F, 0xFE, 0x60, 0x31, 0x80,
+  0xC6, 0x03, 0x18, 0x0C, 0xE0, 0x73, 0x01, 0x8C, 0x06, 0x00, 0x18, 0xCE,
+  0x63, 0x18, 0xCE, 0x63, 0x18, 0xCE, 0x63, 0x00, 0x01, 0x80, 0xC0, 0xC0,
+  0x60, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0xC0, 0x60,
+  0x30, 0x18, 0x18, 0x7C, 0x38, 0x00, 0x18, 0x38, 0x61, 0xC3, 0x8E, 0x0C,
+  0x70, 0x37, 0x80, 0xF8, 0x03, 0xC0, 0x1F, 0x00, 0x6E, 0x01, 0x98, 0x06,
+  0x30, 0x18, 0x60, 0xE1, 0xC3, 0x03, 0x8C, 0x06, 0x00, 0x18, 0x0C, 0x0E,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0xE0, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0x07,
+  0xFF, 0xFE, 0x1C, 0x0F, 0x1C, 0x0F, 0x3E, 0x1F, 0x36, 0x3E, 0x36, 0x36,
+  0x36, 0x76, 0x36, 0x66, 0x77, 0xEE, 0x63, 0xCC, 0x63, 0x8C, 0x63, 0x8C,
+  0x63, 0x0C, 0xE0, 0x1C, 0xC0, 0x18, 0xC0, 0x18, 0x1C, 0x0C, 0x70, 0x33,
+  0xE1, 0xCD, 0x86, 0x36, 0x18, 0xD8, 0x63, 0x31, 0x9C, 0xCE, 0x63, 0x31,
+  0x8E, 0xC6, 0x1B, 0x18, 0x6C, 0xE1, 0xF3, 0x03, 0x8C, 0x0E, 0x00, 0x03,
+  0xE0, 0x3F, 0xC1, 0xC3, 0x8C, 0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x6C, 0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF, 0x01,
+  0xF0, 0x00, 0x1F, 0x83, 0xF8, 0xE3, 0x98, 0x33, 0x06, 0x60, 0xCC, 0x33,
+  0xFE, 0x7F, 0x0C, 0x01, 0x80, 0x30, 0x0E, 0x01, 0x80, 0x30, 0x00, 0x07,
+  0xE0, 0x3F, 0xC1, 0xC3, 0x8C, 0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x6C, 0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF, 0x01,
+  0xF0, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x1F, 0x83, 0xFC, 0xE1, 0x98,
+  0x33, 0x06, 0x61, 0x8F, 0xE3, 0xFC, 0x61, 0x8C, 0x31, 0x83, 0x30, 0x6E,
+  0x0D, 0x80, 0xF0, 0x18, 0x07, 0xE0, 0xFF, 0x18, 0x33, 0x00, 0x30, 0x03,
+  0x00, 0x3E, 0x00, 0xFC, 0x01, 0xE0, 0x06, 0x00, 0x60, 0x06, 0xC1, 0xCF,
+  0xFC, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x06, 0x00,
+  0x18, 0x00, 0x60, 0x01, 0x80, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x60, 0x01, 0x80, 0x00, 0x30, 0x19, 0x80, 0xD8, 0x06, 0xC0,
+  0x66, 0x03, 0x30, 0x19, 0x80, 0xD8, 0x06, 0xC0, 0x66, 0x03, 0x30, 0x19,
+  0x81, 0xCE, 0x1C, 0x3F, 0xC0, 0xFC, 0x00, 0xC0, 0x3E, 0x01, 0xB0, 0x1C,
+  0xC0, 0xC6, 0x0E, 0x30, 0x61, 0x86, 0x0C, 0x30, 0x63, 0x01, 0xB8, 0x0D,
+  0x80, 0x7C, 0x03, 0xC0, 0x1E, 0x00, 0xE0, 0x00, 0xC1, 0xE0, 0xF0, 0x78,
+  0x6C, 0x3E, 0x1B, 0x0D, 0x8E, 0xC3, 0x63, 0x31, 0x98, 0xCC, 0x66, 0x63,
+  0x31, 0x98, 0xCC, 0x6C, 0x1F, 0x1B, 0x07, 0x87, 0xC1, 0xE1, 0xE0, 0x70,
+  0x78, 0x1C, 0x1C, 0x07, 0x07, 0x00, 0x0C, 0x0E, 0x1C, 0x38, 0x18, 0xE0,
+  0x3B, 0x80, 0x36, 0x00, 0x78, 0x00, 0x70, 0x01, 0xC0, 0x03, 0xC0, 0x0D,
+  0x80, 0x31, 0x80, 0xE3, 0x03, 0x87, 0x0E, 0x06, 0x38, 0x0E, 0x00, 0xC0,
+  0x66, 0x0C, 0x61, 0x86, 0x38, 0x37, 0x03, 0xE0, 0x3C, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x03, 0x80, 0x30, 0x03, 0x00, 0x30, 0x00, 0x1F, 0xFE,
+  0x3F, 0xFC, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
+  0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1F, 0xFE,
+  0x3F, 0xFC, 0x00, 0x1E, 0x3C, 0x61, 0x83, 0x06, 0x0C, 0x18, 0x30, 0xC1,
+  0x83, 0x06, 0x0C, 0x18, 0x60, 0xF1, 0xE0, 0xCC, 0xCC, 0x44, 0x46, 0x66,
+  0x66, 0x22, 0x23, 0x1E, 0x3C, 0x18, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x18, 0xF1, 0xE0, 0x07, 0x00, 0x6C, 0x06, 0x30,
+  0x60, 0xC6, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0xC6, 0x23, 0x0F, 0x8F, 0xF2,
+  0x0C, 0x03, 0x1F, 0xDF, 0xFE, 0x1B, 0x06, 0xC3, 0xBF, 0x67, 0xB0, 0x18,
+  0x03, 0x00, 0xE0, 0x18, 0x03, 0x38, 0x7F, 0x8E, 0x3B, 0x83, 0x60, 0x6C,
+  0x0D, 0x81, 0xB0, 0x6F, 0x1D, 0xBF, 0x33, 0x80, 0x0F, 0x8F, 0xF3, 0x05,
+  0x80, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0xE1, 0x1F, 0xC3, 0xE0, 0x00, 0x30,
+  0x03, 0x00, 0x70, 0x06, 0x0E, 0x63, 0xF6, 0x70, 0xE6, 0x0E, 0xC0, 0xCC,
+  0x0C, 0xC0, 0xCC, 0x1C, 0xE3, 0xC7, 0xF8, 0x3D, 0x80, 0x0F, 0x87, 0xF8,
+  0xC3, 0xB0, 0x3F, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xE0, 0x8F, 0xF0, 0xFC,
+  0x00, 0x0F, 0x1F, 0x38, 0x30, 0xFE, 0xFE, 0x30, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xC0, 0xC0, 0xC0, 0x0E, 0x67, 0xED, 0xC3, 0x30, 0x6C, 0x0D, 0x81,
+  0xB0, 0x36, 0x0C, 0xE3, 0x8F, 0xF0, 0xE6, 0x01, 0x88, 0x71, 0xFC, 0x1F,
+  0x00, 0x18, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x3C, 0x7F, 0xCE, 0x3B, 0x83,
+  0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x6E, 0x0D, 0x81, 0xB0, 0x30, 0x18, 0xC0,
+  0x03, 0x18, 0xCC, 0x63, 0x18, 0xCC, 0x63, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x06, 0x06, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x30, 0xF0, 0xE0, 0x18, 0x01, 0x80, 0x38, 0x03, 0x00, 0x30, 0xE3, 0x1C,
+  0x37, 0x87, 0xE0, 0x7C, 0x07, 0x80, 0x6C, 0x06, 0x60, 0xE7, 0x0C, 0x38,
+  0xC1, 0xC0, 0x18, 0xCE, 0x63, 0x18, 0xCE, 0x63, 0x18, 0xCE, 0x63, 0x00,
+  0x37, 0x8F, 0x1F, 0xEF, 0xCE, 0x3C, 0x6E, 0x1C, 0x36, 0x0C, 0x1B, 0x06,
+  0x0D, 0x83, 0x06, 0xC1, 0x87, 0xC1, 0x83, 0x60, 0xC1, 0xB0, 0x60, 0xC0,
+  0x33, 0xC7, 0xFC, 0xE3, 0xB8, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x06, 0xC0,
+  0xD8, 0x1B, 0x03, 0x00, 0x0F, 0x0F, 0xE7, 0x1D, 0x83, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x06, 0xE3, 0x9F, 0xC3, 0xC0, 0x1B, 0xC1, 0xFE, 0x3C, 0x73, 0x83,
+  0x30, 0x33, 0x03, 0x30, 0x37, 0x06, 0x70, 0xE6, 0xFC, 0x6F, 0x06, 0x00,
+  0xE0, 0x0C, 0x00, 0xC0, 0x00, 0x0E, 0x67, 0xED, 0xC3, 0xB0, 0x6C, 0x0D,
+  0x81, 0xB0, 0x36, 0x0E, 0xE3, 0x8F, 0xF0, 0xE6, 0x00, 0xC0, 0x38, 0x06,
+  0x00, 0xC0, 0x33, 0x9F, 0xCE, 0x0E, 0x06, 0x03, 0x01, 0x80, 0xC0, 0xC0,
+  0x60, 0x30, 0x00, 0x1F, 0x1F, 0xDC, 0x2C, 0x07, 0xC1, 0xF8, 0x1C, 0x06,
+  0x87, 0x7F, 0x1F, 0x00, 0x30, 0x60, 0xC7, 0xFF, 0xEC, 0x18, 0x30, 0xC1,
+  0x83, 0x06, 0x0F, 0x8F, 0x00, 0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x6C, 0x0D,
+  0x81, 0xB0, 0x36, 0x0E, 0xC3, 0x9F, 0xF1, 0xE6, 0x00, 0xC0, 0xF8, 0x1B,
+  0x87, 0x30, 0xC6, 0x30, 0xCE, 0x19, 0x83, 0x70, 0x3C, 0x07, 0x00, 0xE0,
+  0x00, 0xC1, 0x87, 0x87, 0x1B, 0x0E, 0x36, 0x3C, 0xCC, 0xD9, 0x99, 0xB6,
+  0x36, 0x6C, 0x6C, 0xD0, 0xF1, 0xE0, 0xE3, 0x81, 0x87, 0x00, 0x1C, 0x38,
+  0x63, 0x83, 0xB8, 0x0F, 0x80, 0x38, 0x03, 0x80, 0x3E, 0x03, 0xB0, 0x39,
+  0xC3, 0x86, 0x38, 0x38, 0x18, 0x38, 0xC1, 0x86, 0x18, 0x31, 0xC1, 0xCC,
+  0x06, 0xE0, 0x36, 0x01, 0xE0, 0x0F, 0x00, 0x30, 0x03, 0x80, 0x18, 0x01,
+  0x80, 0x7C, 0x03, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x07, 0x01, 0xC0, 0x70,
+  0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1F, 0xF3, 0xFE, 0x00, 0x03, 0xC1, 0xF0,
+  0x60, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0xF8, 0x3C, 0x03, 0x80, 0x60,
+  0x18, 0x0C, 0x03, 0x00, 0xC0, 0x3C, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0E, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x1C, 0x03,
+  0xC1, 0xF0, 0x60, 0x30, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0xF8, 0x3C, 0x00,
+  0x3E, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x7F, 0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F,
+  0xF0, 0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0,
+  0xFF, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0xFF,
+  0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7F, 0xF0, 0x00, 0x18,
+  0xC0, 0x02, 0x11, 0x8C, 0x63, 0x19, 0xCC, 0x63, 0x00, 0x01, 0x00, 0x40,
+  0x20, 0x3E, 0x3F, 0xDC, 0x96, 0x23, 0x18, 0xC4, 0x31, 0x0C, 0x43, 0x94,
+  0x7F, 0x0F, 0x80, 0x80, 0x20, 0x08, 0x00, 0x01, 0xF0, 0x3F, 0x07, 0x10,
+  0x60, 0x06, 0x00, 0xC0, 0x0C, 0x03, 0xFC, 0x3F, 0xC0, 0xC0, 0x18, 0x01,
+  0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, 0x80, 0xDB, 0x67, 0xF8, 0xCC, 0x61,
+  0x98, 0x63, 0x31, 0xFE, 0x6D, 0xA0, 0x10, 0x70, 0x73, 0x06, 0x30, 0xC3,
+  0x9C, 0x1B, 0x81, 0xB0, 0x7F, 0xC0, 0xE0, 0x0C, 0x0F, 0xFC, 0x0C, 0x00,
+  0xC0, 0x18, 0x01, 0x80, 0x18, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x07,
+  0x83, 0xE1, 0x80, 0x60, 0x18, 0x07, 0x03, 0x71, 0x8E, 0x61, 0x9C, 0x63,
+  0xB0, 0x38, 0x06, 0x01, 0x80, 0x63, 0xF0, 0xF8, 0x00, 0xDE, 0xC0, 0x0F,
+  0xC0, 0x61, 0x82, 0x01, 0x11, 0xE2, 0x4C, 0x4A, 0x60, 0x19, 0x80, 0x66,
+  0x01, 0x98, 0x06, 0x60, 0x14, 0xC4, 0x91, 0xE2, 0x20, 0x10, 0x61, 0x80,
+  0xFC, 0x00, 0x7E, 0x01, 0x01, 0x3F, 0xC1, 0x83, 0x87, 0x7A, 0x00, 0xFE,
+  0x04, 0x21, 0x8C, 0xE7, 0x31, 0x8C, 0x60, 0xC6, 0x0C, 0x60, 0xC4, 0x10,
+  0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0xFF,
+  0xF0, 0x07, 0xC0, 0x30, 0x60, 0x80, 0x22, 0x7E, 0x24, 0xC6, 0x51, 0x8C,
+  0x63, 0x18, 0xC7, 0xE1, 0x8C, 0x83, 0x19, 0x85, 0x31, 0x92, 0x61, 0xA2,
+  0x00, 0x83, 0x06, 0x01, 0xF0, 0x00, 0xFF, 0xF0, 0x7B, 0x38, 0x61, 0xCD,
+  0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x1C, 0xC4, 0x08,
+  0x30, 0xC2, 0x18, 0x7E, 0x3C, 0x04, 0x09, 0xE0, 0x40, 0x83, 0x7C, 0x19,
+  0x99, 0x80, 0x18, 0x31, 0x83, 0x38, 0x33, 0x06, 0x30, 0x63, 0x06, 0x30,
+  0x67, 0x0E, 0x71, 0xC7, 0xF7, 0x6E, 0x66, 0x00, 0xE0, 0x0C, 0x00, 0xC0,
+  0x00, 0x1F, 0x9F, 0x27, 0xCB, 0xF2, 0xF9, 0xBE, 0x6F, 0x91, 0xE4, 0x19,
+  0x04, 0xC1, 0x30, 0x48, 0x32, 0x0C, 0x82, 0x60, 0x98, 0x24, 0x00, 0xF0,
+  0x31, 0x1E, 0x38, 0x20, 0x86, 0x10, 0x41, 0x1F, 0x1E, 0x63, 0x41, 0x81,
+  0x81, 0x82, 0xC6, 0x78, 0x00, 0xFE, 0x22, 0x04, 0x60, 0xC6, 0x0C, 0x60,
+  0xC6, 0x31, 0x9C, 0xE6, 0x30, 0x84, 0x00, 0x38, 0x02, 0x04, 0x03, 0x02,
+  0x03, 0x03, 0x03, 0x01, 0x03, 0x00, 0x81, 0x00, 0x41, 0x80, 0xF9, 0x83,
+  0x01, 0x83, 0x81, 0x82, 0x80, 0x82, 0x40, 0xC2, 0x20, 0xC3, 0xF8, 0xC0,
+  0x10, 0xC0, 0x08, 0x38, 0x02, 0x02, 0x01, 0x80, 0x80, 0xC0, 0x60, 0x60,
+  0x10, 0x30, 0x04, 0x08, 0x01, 0x06, 0x01, 0xF3, 0x0E, 0x01, 0x8C, 0x40,
+  0xC0, 0x10, 0x20, 0x0C, 0x18, 0x06, 0x0C, 0x02, 0x06, 0x03, 0x03, 0x01,
+  0xF8, 0x3C, 0x01, 0x00, 0x80, 0xC0, 0x20, 0x60, 0xF0, 0x30, 0x04, 0x18,
+  0x01, 0x04, 0x00, 0xC3, 0x03, 0xE1, 0x83, 0x00, 0xC1, 0xC0, 0x60, 0xA0,
+  0x10, 0x48, 0x0C, 0x22, 0x06, 0x1F, 0xC3, 0x00, 0x41, 0x80, 0x10, 0x03,
+  0x03, 0x00, 0x07, 0x06, 0x06, 0x0E, 0x1C, 0x38, 0x60, 0xC0, 0xC0, 0xC1,
+  0xFF, 0x7E, 0x00, 0xC0, 0x02, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0xF0,
+  0x07, 0x80, 0x7C, 0x03, 0x60, 0x33, 0x01, 0x9C, 0x18, 0x60, 0xC3, 0x0C,
+  0x18, 0xFF, 0xC7, 0xFE, 0x70, 0x1B, 0x00, 0xF8, 0x06, 0x00, 0x30, 0x03,
+  0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x07, 0x80, 0x7C, 0x03, 0x60,
+  0x33, 0x01, 0x9C, 0x18, 0x60, 0xC3, 0x0C, 0x18, 0xFF, 0xC7, 0xFE, 0x70,
+  0x1B, 0x00, 0xF8, 0x06, 0x00, 0xE0, 0x0D, 0x00, 0xCC, 0x00, 0x00, 0x0C,
+  0x00, 0xF0, 0x07, 0x80, 0x7C, 0x03, 0x60, 0x33, 0x01, 0x9C, 0x18, 0x60,
+  0xC3, 0x0C, 0x18, 0xFF, 0xC7, 0xFE, 0x70, 0x1B, 0x00, 0xF8, 0x06, 0x01,
+  0xC8, 0x13, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x07, 0x80, 0x7C,
+  0x03, 0x60, 0x33, 0x01, 0x9C, 0x18, 0x60, 0xC3, 0x0C, 0x18, 0xFF, 0xC7,
+  0xFE, 0x70, 0x1B, 0x00, 0xF8, 0x06, 0x01, 0xB0, 0x0D, 0x80, 0x00, 0x00,
+  0x00, 0x0C, 0x00, 0xF0, 0x07, 0x80, 0x7C, 0x03, 0x60, 0x33, 0x01, 0x9C,
+  0x18, 0x60, 0xC3, 0x0C, 0x18, 0xFF, 0xC7, 0xFE, 0x70, 0x1B, 0x00, 0xF8,
+  0x06, 0x00, 0xE0, 0x08, 0x80, 0x44, 0x02, 0x20, 0x0E, 0x00, 0xF0, 0x07,
+  0x80, 0x7C, 0x03, 0x60, 0x39, 0x81, 0x8C, 0x18, 0x60, 0xC3, 0x0C, 0x18,
+  0xFF, 0xC7, 0xFE, 0x70, 0x1B, 0x00, 0xF8, 0x06, 0x00, 0x7F, 0xF8, 0x07,
+  0xFF, 0xC0, 0x36, 0x00, 0x03, 0x30, 0x00, 0x39, 0x80, 0x01, 0x8C, 0x00,
+  0x18, 0x7F, 0x80, 0xC7, 0xFC, 0x0C, 0x30, 0x00, 0xE1, 0x80, 0x07, 0xFC,
+  0x00, 0x7F, 0xE0, 0x03, 0x06, 0x00, 0x30, 0x3F, 0xF3, 0x81, 0xFF, 0x00,
+  0x07, 0xF0, 0x7F, 0xC7, 0x06, 0x60, 0x07, 0x00, 0x30, 0x03, 0x00, 0x18,
+  0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0xC0, 0x07, 0x02, 0x1F, 0xF0, 0x7E,
+  0x00, 0xC0, 0x02, 0x00, 0x10, 0x07, 0x00, 0x03, 0x00, 0x10, 0x01, 0x80,
+  0x00, 0x1F, 0xF1, 0xFF, 0x38, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xE7,
+  0xFC, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0x80,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x38, 0x03, 0x00,
+  0x30, 0x03, 0x00, 0x3F, 0xE7, 0xFC, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0xE0, 0x0F, 0xFC, 0xFF, 0x80, 0x03, 0x80, 0x68, 0x0C, 0xC0, 0x00, 0x1F,
+  0xF1, 0xFF, 0x38, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xE7, 0xFC, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0x80, 0x06, 0xC0,
+  0x6C, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x38, 0x03, 0x00, 0x30, 0x03,
+  0x00, 0x3F, 0xE7, 0xFC, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0F,
+  0xFC, 0xFF, 0x80, 0x30, 0x86, 0x01, 0x8C, 0xE6, 0x31, 0x8C, 0xE6, 0x31,
+  0x8C, 0xE6, 0x30, 0x0C, 0x30, 0xC0, 0x01, 0x83, 0x0E, 0x18, 0x30, 0x60,
+  0xC3, 0x86, 0x0C, 0x18, 0x30, 0xE1, 0x83, 0x00, 0x39, 0xAC, 0xC0, 0x18,
+  0x63, 0x8C, 0x30, 0xC3, 0x1C, 0x61, 0x86, 0x18, 0xE3, 0x0C, 0x00, 0x6D,
+  0xB0, 0x00, 0x18, 0x63, 0x8C, 0x30, 0xC3, 0x1C, 0x61, 0x86, 0x18, 0xE3,
+  0x0C, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x70, 0x70, 0xC0, 0x71, 0x80, 0x63,
+  0x00, 0xFF, 0xC1, 0xFF, 0x83, 0x30, 0x06, 0x60, 0x18, 0xC0, 0x31, 0x80,
+  0xC7, 0x07, 0x8F, 0xFC, 0x1F, 0xE0, 0x00, 0x07, 0x20, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0x0C, 0x70, 0x33, 0xE1, 0xCD, 0x86, 0x36, 0x18, 0xD8,
+  0x63, 0x31, 0x9C, 0xCE, 0x63, 0x31, 0x8E, 0xC6, 0x1B, 0x18, 0x6C, 0xE1,
+  0xF3, 0x03, 0x8C, 0x0E, 0x00, 0x01, 0x80, 0x02, 0x00, 0x0C, 0x00, 0x00,
+  0x03, 0xE0, 0x3F, 0xC1, 0xC3, 0x8C, 0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x6C, 0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF,
+  0x01, 0xF0, 0x00, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0x00, 0x03, 0xE0,
+  0x3F, 0xC1, 0xC3, 0x8C, 0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x6C, 0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF, 0x01, 0xF0,
+  0x00, 0x01, 0xC0, 0x0D, 0x00, 0x66, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xC1,
+  0xC3, 0x8C, 0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x6C, 0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF, 0x01, 0xF0, 0x00, 0x03,
+  0x90, 0x13, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xC1, 0xC3, 0x8C,
+  0x07, 0x60, 0x0D, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x6C,
+  0x03, 0xB8, 0x0C, 0x70, 0xE0, 0xFF, 0x01, 0xF0, 0x00, 0x03, 0x60, 0x0D,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xC1, 0xC3, 0x8C, 0x07, 0x60,
+  0x0D, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x6C, 0x03, 0xB8,
+  0x0C, 0x70, 0xE0, 0xFF, 0x01, 0xF0, 0x00, 0x40, 0x5C, 0x1D, 0xC7, 0x1D,
+  0xC1, 0xF0, 0x1C, 0x07, 0xC1, 0xDC, 0x71, 0xDC, 0x1D, 0x01, 0x00, 0x00,
+  0xF8, 0x81, 0xFE, 0xC1, 0xC3, 0xC1, 0x80, 0xE1, 0xC1, 0xB0, 0xC1, 0x98,
+  0xC1, 0x8C, 0x61, 0x86, 0x31, 0x83, 0x19, 0x83, 0x0F, 0x03, 0x83, 0x01,
+  0x83, 0xC3, 0x83, 0x7F, 0x83, 0x1F, 0x80, 0x03, 0x00, 0x08, 0x00, 0x60,
+  0x00, 0x03, 0x01, 0x98, 0x0D, 0x80, 0x6C, 0x06, 0x60, 0x33, 0x01, 0x98,
+  0x0D, 0x80, 0x6C, 0x06, 0x60, 0x33, 0x01, 0x98, 0x1C, 0xE1, 0xC3, 0xFC,
+  0x0F, 0xC0, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00, 0x03, 0x01, 0x98, 0x0D,
+  0x80, 0x6C, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0D, 0x80, 0x6C, 0x06, 0x60,
+  0x33, 0x01, 0x98, 0x1C, 0xE1, 0xC3, 0xFC, 0x0F, 0xC0, 0x03, 0x80, 0x34,
+  0x03, 0x30, 0x00, 0x03, 0x01, 0x98, 0x0D, 0x80, 0x6C, 0x06, 0x60, 0x33,
+  0x01, 0x98, 0x0D, 0x80, 0x6C, 0x06, 0x60, 0x33, 0x01, 0x98, 0x1C, 0xE1,
+  0xC3, 0xFC, 0x0F, 0xC0, 0x06, 0xC0, 0x36, 0x00, 0x00, 0x00, 0x03, 0x01,
+  0x98, 0x0D, 0x80, 0x6C, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0D, 0x80, 0x6C,
+  0x06, 0x60, 0x33, 0x01, 0x98, 0x1C, 0xE1, 0xC3, 0xFC, 0x0F, 0xC0, 0x03,
+  0x00, 0x60, 0x0C, 0x00, 0x00, 0xC0, 0x66, 0x0C, 0x61, 0x86, 0x38, 0x37,
+  0x03, 0xE0, 0x3C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x80, 0x30,
+  0x03, 0x00, 0x30, 0x00, 0x18, 0x03, 0x00, 0xE0, 0x1F, 0xC3, 0xFC, 0x61,
+  0xCC, 0x1B, 0x83, 0x60, 0x6C, 0x19, 0xFF, 0x3F, 0x8E, 0x01, 0x80, 0x30,
+  0x00, 0x07, 0x83, 0xF8, 0x61, 0x98, 0x33, 0x1E, 0x6C, 0x0D, 0x83, 0x38,
+  0x63, 0xCC, 0x1D, 0x81, 0xB0, 0x3D, 0x0F, 0xBF, 0xB3, 0xC0, 0x0C, 0x01,
+  0x80, 0x20, 0x0C, 0x00, 0x03, 0xE3, 0xFC, 0x83, 0x00, 0xC7, 0xF7, 0xFF,
+  0x86, 0xC1, 0xB0, 0xEF, 0xD9, 0xEC, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x00,
+  0x03, 0xE3, 0xFC, 0x83, 0x00, 0xC7, 0xF7, 0xFF, 0x86, 0xC1, 0xB0, 0xEF,
+  0xD9, 0xEC, 0x03, 0x01, 0x40, 0xD0, 0x66, 0x00, 0x03, 0xE3, 0xFC, 0x83,
+  0x00, 0xC7, 0xF7, 0xFF, 0x86, 0xC1, 0xB0, 0xEF, 0xD9, 0xEC, 0x0E, 0x46,
+  0xB1, 0x38, 0x00, 0x00, 0x03, 0xE3, 0xFC, 0x83, 0x00, 0xC7, 0xF7, 0xFF,
+  0x86, 0xC1, 0xB0, 0xEF, 0xD9, 0xEC, 0x0D, 0x83, 0x60, 0x00, 0x00, 0x0F,
+  0x8F, 0xF2, 0x0C, 0x03, 0x1F, 0xDF, 0xFE, 0x1B, 0x06, 0xC3, 0xBF, 0x67,
+  0xB0, 0x07, 0x02, 0x20, 0x88, 0x22, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x20,
+  0xC0, 0x31, 0xFD, 0xFF, 0xE1, 0xB0, 0x6C, 0x3B, 0xF6, 0x7B, 0x00, 0x0F,
+  0x0F, 0x0F, 0xE7, 0xE2, 0x0E, 0x1C, 0x03, 0x03, 0x1F, 0xFF, 0xDF, 0xFF,
+  0xFE, 0x0C, 0x03, 0x07, 0x00, 0xC3, 0xC1, 0x3F, 0x9F, 0xC7, 0xC3, 0xE0,
+  0x0F, 0x8F, 0xF3, 0x05, 0x80, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0xE1, 0x1F,
+  0xC3, 0xE0, 0x60, 0x08, 0x02, 0x07, 0x00, 0x0C, 0x00, 0xC0, 0x08, 0x01,
+  0x80, 0x00, 0x1F, 0x0F, 0xF1, 0x87, 0x60, 0x7F, 0xFF, 0xFF, 0xE0, 0x0C,
+  0x01, 0xC1, 0x1F, 0xE1, 0xF8, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00,
+  0x1F, 0x0F, 0xF1, 0x87, 0x60, 0x7F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC1,
+  0x1F, 0xE1, 0xF8, 0x03, 0x00, 0xA0, 0x34, 0x0C, 0xC0, 0x00, 0x1F, 0x0F,
+  0xF1, 0x87, 0x60, 0x7F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC1, 0x1F, 0xE1,
+  0xF8, 0x0D, 0x81, 0xB0, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x8C, 0x3B, 0x03,
+  0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x0E, 0x08, 0xFF, 0x0F, 0xC0, 0xC6, 0x23,
+  0x03, 0x33, 0x66, 0x66, 0x6C, 0xCC, 0x0C, 0x63, 0x18, 0x00, 0xC3, 0x0C,
+  0x61, 0x86, 0x18, 0x63, 0x0C, 0x30, 0x18, 0xA6, 0xB3, 0x00, 0x61, 0x86,
+  0x30, 0xC3, 0x0C, 0x31, 0x86, 0x18, 0xDE, 0xC0, 0x03, 0x18, 0xCC, 0x63,
+  0x18, 0xCC, 0x63, 0x00, 0x0C, 0x41, 0xE3, 0xF0, 0x0C, 0x0F, 0x8F, 0xF7,
+  0x0D, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x06, 0xE3, 0x9F, 0xC3, 0xC0, 0x0E,
+  0x43, 0x58, 0x4E, 0x00, 0x00, 0x00, 0x67, 0x8F, 0xF9, 0xC7, 0x70, 0x6C,
+  0x0D, 0x81, 0xB0, 0x36, 0x0D, 0x81, 0xB0, 0x36, 0x06, 0x0C, 0x01, 0x80,
+  0x20, 0x0C, 0x00, 0x03, 0xC3, 0xF9, 0xC7, 0x60, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC1, 0xB8, 0xE7, 0xF0, 0xF0, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x00, 0x03,
+  0xC3, 0xF9, 0xC7, 0x60, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xB8, 0xE7, 0xF0,
+  0xF0, 0x03, 0x01, 0x40, 0xD0, 0x66, 0x00, 0x03, 0xC3, 0xF9, 0xC7, 0x60,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xB8, 0xE7, 0xF0, 0xF0, 0x0E, 0x46, 0xB1,
+  0x38, 0x00, 0x00, 0x03, 0xC3, 0xF9, 0xC7, 0x60, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC1, 0xB8, 0xE7, 0xF0, 0xF0, 0x0D, 0x83, 0x60, 0x00, 0x00, 0x0F, 0x0F,
+  0xE7, 0x1D, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x06, 0xE3, 0x9F, 0xC3, 0xC0,
+  0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x60, 0x00, 0x00, 0xFB, 0x1F, 0xE3, 0x8E, 0x31, 0xE6, 0x36,
+  0x66, 0x66, 0xC6, 0x78, 0xC3, 0x1C, 0x7F, 0x8D, 0xF0, 0x80, 0x00, 0x0C,
+  0x00, 0xC0, 0x08, 0x01, 0x80, 0x00, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xD8,
+  0x1B, 0x03, 0x60, 0x6C, 0x1D, 0x87, 0x3F, 0xE3, 0xCC, 0x00, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0x00, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xD8, 0x1B, 0x03,
+  0x60, 0x6C, 0x1D, 0x87, 0x3F, 0xE3, 0xCC, 0x03, 0x00, 0xA0, 0x34, 0x0C,
+  0xC0, 0x00, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xD8, 0x1B, 0x03, 0x60, 0x6C,
+  0x1D, 0x87, 0x3F, 0xE3, 0xCC, 0x0D, 0x81, 0xB0, 0x00, 0x00, 0x06, 0x06,
+  0xC0, 0xD8, 0x1B, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x39, 0xFF,
+  0x1E, 0x60, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x00, 0x0C, 0x1C,
+  0x60, 0xC3, 0x0C, 0x18, 0xE0, 0xE6, 0x03, 0x70, 0x1B, 0x00, 0xF0, 0x07,
+  0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x3E, 0x01, 0xE0, 0x00, 0x0C,
+  0x00, 0xC0, 0x1C, 0x01, 0x80, 0x19, 0xC1, 0xFE, 0x1C, 0x73, 0x83, 0x30,
+  0x33, 0x03, 0x30, 0x33, 0x06, 0x78, 0xE6, 0xFC, 0x67, 0x06, 0x00, 0x60,
+  0x0C, 0x00, 0xC0, 0x00, 0x03, 0x60, 0x1B, 0x00, 0x00, 0x00, 0x01, 0x83,
+  0x8C, 0x18, 0x61, 0x83, 0x1C, 0x1C, 0xC0, 0x6E, 0x03, 0x60, 0x1E, 0x00,
+  0xF0, 0x03, 0x00, 0x38, 0x01, 0x80, 0x18, 0x07, 0xC0, 0x3C, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   5,  15,   8,    2,  -14 },   // 0x21 '!'
+  {    11,   6,   5,   9,    2,  -14 },   // 0x22 '"'
+  {    15,  14,  15,  17,    1,  -14 },   // 0x23 '#'
+  {    42,  10,  18,  13,    1,  -14 },   // 0x24 '$'
+  {    65,  15,  15,  19,    2,  -14 },   // 0x25 '%'
+  {    94,  14,  15,  16,    1,  -14 },   // 0x26 '&'
+  {   121,   2,   5,   6,    2,  -14 },   // 0x27 '''
+  {   123,   7,  18,   8,    2,  -14 },   // 0x28 '('
+  {   139,   7,  18,   8,   -1,  -14 },   // 0x29 ')'
+  {   155,   9,  10,  10,    0,  -14 },   // 0x2A '*'
+  {   167,  12,  12,  17,    2,  -11 },   // 0x2B '+'
+  {   185,   3,   5,   6,    1,   -1 },   // 0x2C ','
+  {   187,   6,   2,   7,    1,   -5 },   // 0x2D '-'
+  {   189,   2,   2,   6,    1,   -1 },   // 0x2E '.'
+  {   190,  10,  16,   7,   -1,  -14 },   // 0x2F '/'
+  {   210,  11,  15,  13,    1,  -14 },   // 0x30 '0'
+  {   231,   9,  15,  13,    1,  -14 },   // 0x31 '1'
+  {   248,  11,  15,  13,    0,  -14 },   // 0x32 '2'
+  {   269,  11,  15,  13,    0,  -14 },   // 0x33 '3'
+  {   290,  11,  15,  13,    0,  -14 },   // 0x34 '4'
+  {   311,  11,  15,  13,    0,  -14 },   // 0x35 '5'
+  {   332,  11,  15,  13,    1,  -14 },   // 0x36 '6'
+  {   353,  11,  15,  13,    2,  -14 },   // 0x37 '7'
+  {   374,  11,  15,  13,    1,  -14 },   // 0x38 '8'
+  {   395,  11,  15,  13,    1,  -14 },   // 0x39 '9'
+  {   416,   4,  10,   7,    1,   -9 },   // 0x3A ':'
+  {   421,   5,  13,   7,    1,   -9 },   // 0x3B ';'
+  {   430,  13,  11,  17,    2,  -11 },   // 0x3C '<'
+  {   448,  13,   6,  17,    2,   -8 },   // 0x3D '='
+  {   458,  13,  11,  17,    2,  -11 },   // 0x3E '>'
+  {   476,   8,  15,  11,    3,  -14 },   // 0x3F '?'
+  {   491,  18,  18,  20,    1,  -13 },   // 0x40 '@'
+  {   532,  13,  15,  14,   -1,  -14 },   // 0x41 'A'
+  {   557,  12,  15,  14,    1,  -14 },   // 0x42 'B'
+  {   580,  13,  15,  14,    1,  -14 },   // 0x43 'C'
+  {   605,  14,  15,  15,    1,  -14 },   // 0x44 'D'
+  {   632,  12,  15,  13,    1,  -14 },   // 0x45 'E'
+  {   655,  11,  15,  12,    1,  -14 },   // 0x46 'F'
+  {   676,  14,  15,  16,    1,  -14 },   // 0x47 'G'
+  {   703,  14,  15,  15,    1,  -14 },   // 0x48 'H'
+  {   730,   5,  15,   6,    1,  -14 },   // 0x49 'I'
+  {   740,   9,  19,   6,   -3,  -14 },   // 0x4A 'J'
+  {   762,  14,  15,  13,    1,  -14 },   // 0x4B 'K'
+  {   789,   9,  15,  11,    1,  -14 },   // 0x4C 'L'
+  {   806,  16,  15,  17,    1,  -14 },   // 0x4D 'M'
+  {   836,  14,  15,  15,    1,  -14 },   // 0x4E 'N'
+  {   863,  14,  15,  16,    1,  -14 },   // 0x4F 'O'
+  {   890,  11,  15,  12,    1,  -14 },   // 0x50 'P'
+  {   911,  14,  18,  16,    1,  -14 },   // 0x51 'Q'
+  {   943,  11,  15,  14,    1,  -14 },   // 0x52 'R'
+  {   964,  12,  15,  13,    0,  -14 },   // 0x53 'S'
+  {   987,  14,  15,  12,    1,  -14 },   // 0x54 'T'
+  {  1014,  13,  15,  15,    1,  -14 },   // 0x55 'U'
+  {  1039,  13,  15,  14,    2,  -14 },   // 0x56 'V'
+  {  1064,  18,  15,  20,    2,  -14 },   // 0x57 'W'
+  {  1098,  15,  15,  14,   -1,  -14 },   // 0x58 'X'
+  {  1127,  12,  15,  12,    2,  -14 },   // 0x59 'Y'
+  {  1150,  15,  15,  14,    0,  -14 },   // 0x5A 'Z'
+  {  1179,   7,  18,   8,    1,  -14 },   // 0x5B '['
+  {  1195,   4,  16,   7,    2,  -14 },   // 0x5C '\'
+  {  1203,   7,  18,   8,   -1,  -14 },   // 0x5D ']'
+  {  1219,  13,   5,  17,    2,  -14 },   // 0x5E '^'
+  {  1228,  10,   2,  10,    0,    4 },   // 0x5F '_'
+  {  1231,   4,   4,  10,    4,  -15 },   // 0x60 '`'
+  {  1233,  10,  11,  12,    1,  -10 },   // 0x61 'a'
+  {  1247,  11,  15,  13,    1,  -14 },   // 0x62 'b'
+  {  1268,  10,  11,  11,    1,  -10 },   // 0x63 'c'
+  {  1282,  12,  15,  13,    1,  -14 },   // 0x64 'd'
+  {  1305,  11,  11,  12,    1,  -10 },   // 0x65 'e'
+  {  1321,   8,  15,   7,    1,  -14 },   // 0x66 'f'
+  {  1336,  11,  15,  13,    1,  -10 },   // 0x67 'g'
+  {  1357,  11,  15,  13,    1,  -14 },   // 0x68 'h'
+  {  1378,   5,  15,   6,    1,  -14 },   // 0x69 'i'
+  {  1388,   8,  19,   6,   -2,  -14 },   // 0x6A 'j'
+  {  1407,  12,  15,  12,    1,  -14 },   // 0x6B 'k'
+  {  1430,   5,  15,   6,    1,  -14 },   // 0x6C 'l'
+  {  1440,  17,  11,  20,    1,  -10 },   // 0x6D 'm'
+  {  1464,  11,  11,  13,    1,  -10 },   // 0x6E 'n'
+  {  1480,  10,  11,  12,    1,  -10 },   // 0x6F 'o'
+  {  1494,  12,  15,  13,    0,  -10 },   // 0x70 'p'
+  {  1517,  11,  15,  13,    1,  -10 },   // 0x71 'q'
+  {  1538,   9,  11,   8,    1,  -10 },   // 0x72 'r'
+  {  1551,   9,  11,  10,    1,  -10 },   // 0x73 's'
+  {  1564,   7,  14,   8,    2,  -13 },   // 0x74 't'
+  {  1577,  11,  11,  13,    1,  -10 },   // 0x75 'u'
+  {  1593,  11,  11,  12,    1,  -10 },   // 0x76 'v'
+  {  1609,  15,  11,  16,    2,  -10 },   // 0x77 'w'
+  {  1630,  13,  11,  12,   -1,  -10 },   // 0x78 'x'
+  {  1648,  13,  15,  12,   -1,  -10 },   // 0x79 'y'
+  {  1673,  11,  11,  11,    0,  -10 },   // 0x7A 'z'
+  {  1689,  10,  18,  13,    2,  -14 },   // 0x7B '{'
+  {  1712,   2,  20,   7,    3,  -14 },   // 0x7C '|'
+  {  1717,  10,  18,  13,    0,  -14 },   // 0x7D '}'
+  {  1740,  13,   4,  17,    2,   -7 },   // 0x7E '~'
+  {  1747,  10,  18,  12,    1,  -13 },   // 0x7F
+  {  1770,  10,  18,  12,    1,  -13 },   // 0x80
+  {  1793,  10,  18,  12,    1,  -13 },   // 0x81
+  {  1816,  10,  18,  12,    1,  -13 },   // 0x82
+  {  1839,  10,  18,  12,    1,  -13 },   // 0x83
+  {  1862,  10,  18,  12,    1,  -13 },   // 0x84
+  {  1885,  10,  18,  12,    1,  -13 },   // 0x85
+  {  1908,  10,  18,  12,    1,  -13 },   // 0x86
+  {  1931,  10,  18,  12,    1,  -13 },   // 0x87
+  {  1954,  10,  18,  12,    1,  -13 },   // 0x88
+  {  1977,  10,  18,  12,    1,  -13 },   // 0x89
+  {  2000,  10,  18,  12,    1,  -13 },   // 0x8A
+  {  2023,  10,  18,  12,    1,  -13 },   // 0x8B
+  {  2046,  10,  18,  12,    1,  -13 },   // 0x8C
+  {  2069,  10,  18,  12,    1,  -13 },   // 0x8D
+  {  2092,  10,  18,  12,    1,  -13 },   // 0x8E
+  {  2115,  10,  18,  12,    1,  -13 },   // 0x8F
+  {  2138,  10,  18,  12,    1,  -13 },   // 0x90
+  {  2161,  10,  18,  12,    1,  -13 },   // 0x91
+  {  2184,  10,  18,  12,    1,  -13 },   // 0x92
+  {  2207,  10,  18,  12,    1,  -13 },   // 0x93
+  {  2230,  10,  18,  12,    1,  -13 },   // 0x94
+  {  2253,  10,  18,  12,    1,  -13 },   // 0x95
+  {  2276,  10,  18,  12,    1,  -13 },   // 0x96
+  {  2299,  10,  18,  12,    1,  -13 },   // 0x97
+  {  2322,  10,  18,  12,    1,  -13 },   // 0x98
+  {  2345,  10,  18,  12,    1,  -13 },   // 0x99
+  {  2368,  10,  18,  12,    1,  -13 },   // 0x9A
+  {  2391,  10,  18,  12,    1,  -13 },   // 0x9B
+  {  2414,  10,  18,  12,    1,  -13 },   // 0x9C
+  {  2437,  10,  18,  12,    1,  -13 },   // 0x9D
+  {  2460,  10,  18,  12,    1,  -13 },   // 0x9E
+  {  2483,  10,  18,  12,    1,  -13 },   // 0x9F
+  {  2506,   1,   1,   6,    0,    0 },   // 0xA0
+  {  2507,   5,  15,   8,    2,  -10 },   // 0xA1
+  {  2517,  10,  17,  13,    1,  -13 },   // 0xA2
+  {  2539,  12,  15,  13,    0,  -14 },   // 0xA3
+  {  2562,  10,  10,  13,    1,  -10 },   // 0xA4
+  {  2575,  12,  15,  13,    1,  -14 },   // 0xA5
+  {  2598,   2,  17,   7,    3,  -13 },   // 0xA6
+  {  2603,  10,  17,  10,    0,  -14 },   // 0xA7
+  {  2625,   5,   2,  10,    4,  -14 },   // 0xA8
+  {  2627,  14,  15,  20,    3,  -14 },   // 0xA9
+  {  2654,   8,  10,   9,    1,  -14 },   // 0xAA
+  {  2664,  11,   9,  12,    1,   -9 },   // 0xAB
+  {  2677,  13,   6,  17,    2,   -7 },   // 0xAC
+  {  2687,   6,   2,   7,    1,   -5 },   // 0xAD
+  {  2689,  15,  15,  20,    3,  -14 },   // 0xAE
+  {  2718,   6,   2,  10,    4,  -14 },   // 0xAF
+  {  2720,   6,   6,  10,    2,  -14 },   // 0xB0
+  {  2725,  12,  13,  17,    3,  -12 },   // 0xB1
+  {  2745,   7,   8,   8,    1,  -14 },   // 0xB2
+  {  2752,   7,   8,   8,    0,  -14 },   // 0xB3
+  {  2759,   5,   4,  10,    5,  -15 },   // 0xB4
+  {  2762,  12,  15,  13,    0,  -10 },   // 0xB5
+  {  2785,  10,  17,  13,    2,  -14 },   // 0xB6
+  {  2807,   2,   2,   6,    2,   -7 },   // 0xB7
+  {  2808,   4,   4,  10,    1,    1 },   // 0xB8
+  {  2810,   6,   8,   8,    1,  -14 },   // 0xB9
+  {  2816,   8,  10,   9,    1,  -14 },   // 0xBA
+  {  2826,  11,   9,  12,    1,   -9 },   // 0xBB
+  {  2839,  17,  15,  19,    1,  -14 },   // 0xBC
+  {  2871,  18,  15,  19,    1,  -14 },   // 0xBD
+  {  2905,  18,  15,  19,    0,  -14 },   // 0xBE
+  {  2939,   8,  15,  11,    1,  -10 },   // 0xBF
+  {  2954,  13,  19,  14,   -1,  -18 },   // 0xC0
+  {  2985,  13,  19,  14,   -1,  -18 },   // 0xC1
+  {  3016,  13,  19,  14,   -1,  -18 },   // 0xC2
+  {  3047,  13,  19,  14,   -1,  -18 },   // 0xC3
+  {  3078,  13,  19,  14,   -1,  -18 },   // 0xC4
+  {  3109,  13,  19,  14,   -1,  -18 },   // 0xC5
+  {  3140,  21,  15,  19,   -1,  -14 },   // 0xC6
+  {  3180,  13,  19,  14,    1,  -14 },   // 0xC7
+  {  3211,  12,  19,  13,    1,  -18 },   // 0xC8
+  {  3240,  12,  19,  13,    1,  -18 },   // 0xC9
+  {  3269,  12,  19,  13,    1,  -18 },   // 0xCA
+  {  3298,  12,  19,  13,    1,  -18 },   // 0xCB
+  {  3327,   5,  19,   6,    1,  -18 },   // 0xCC
+  {  3339,   7,  19,   6,    1,  -18 },   // 0xCD
+  {  3356,   6,  19,   6,    1,  -18 },   // 0xCE
+  {  3371,   6,  19,   6,    1,  -18 },   // 0xCF
+  {  3386,  15,  15,  16,    0,  -14 },   // 0xD0
+  {  3415,  14,  19,  15,    1,  -18 },   // 0xD1
+  {  3449,  14,  19,  16,    1,  -18 },   // 0xD2
+  {  3483,  14,  19,  16,    1,  -18 },   // 0xD3
+  {  3517,  14,  19,  16,    1,  -18 },   // 0xD4
+  {  3551,  14,  19,  16,    1,  -18 },   // 0xD5
+  {  3585,  14,  19,  16,    1,  -18 },   // 0xD6
+  {  3619,  11,  11,  17,    3,  -11 },   // 0xD7
+  {  3635,  17,  15,  16,   -1,  -14 },   // 0xD8
+  {  3667,  13,  19,  15,    1,  -18 },   // 0xD9
+  {  3698,  13,  19,  15,    1,  -18 },   // 0xDA
+  {  3729,  13,  19,  15,    1,  -18 },   // 0xDB
+  {  3760,  13,  19,  15,    1,  -18 },   // 0xDC
+  {  3791,  12,  19,  12,    2,  -18 },   // 0xDD
+  {  3820,  11,  15,  12,    1,  -14 },   // 0xDE
+  {  3841,  11,  15,  13,    1,  -14 },   // 0xDF
+  {  3862,  10,  16,  12,    1,  -15 },   // 0xE0
+  {  3882,  10,  16,  12,    1,  -15 },   // 0xE1
+  {  3902,  10,  16,  12,    1,  -15 },   // 0xE2
+  {  3922,  10,  16,  12,    1,  -15 },   // 0xE3
+  {  3942,  10,  15,  12,    1,  -14 },   // 0xE4
+  {  3961,  10,  17,  12,    1,  -16 },   // 0xE5
+  {  3983,  18,  11,  20,    1,  -10 },   // 0xE6
+  {  4008,  10,  15,  11,    1,  -10 },   // 0xE7
+  {  4027,  11,  16,  12,    1,  -15 },   // 0xE8
+  {  4049,  11,  16,  12,    1,  -15 },   // 0xE9
+  {  4071,  11,  16,  12,    1,  -15 },   // 0xEA
+  {  4093,  11,  15,  12,    1,  -14 },   // 0xEB
+  {  4114,   4,  16,   6,    1,  -15 },   // 0xEC
+  {  4122,   6,  16,   6,    1,  -15 },   // 0xED
+  {  4134,   6,  16,   6,    0,  -15 },   // 0xEE
+  {  4146,   5,  15,   6,    1,  -14 },   // 0xEF
+  {  4156,  10,  15,  12,    1,  -14 },   // 0xF0
+  {  4175,  11,  16,  13,    1,  -15 },   // 0xF1
+  {  4197,  10,  16,  12,    1,  -15 },   // 0xF2
+  {  4217,  10,  16,  12,    1,  -15 },   // 0xF3
+  {  4237,  10,  16,  12,    1,  -15 },   // 0xF4
+  {  4257,  10,  16,  12,    1,  -15 },   // 0xF5
+  {  4277,  10,  15,  12,    1,  -14 },   // 0xF6
+  {  4296,  12,  10,  17,    2,  -10 },   // 0xF7
+  {  4311,  12,  13,  12,    0,  -11 },   // 0xF8
+  {  4331,  11,  16,  13,    1,  -15 },   // 0xF9
+  {  4353,  11,  16,  13,    1,  -15 },   // 0xFA
+  {  4375,  11,  16,  13,    1,  -15 },   // 0xFB
+  {  4397,  11,  15,  13,    1,  -14 },   // 0xFC
+  {  4418,  13,  20,  12,   -1,  -15 },   // 0xFD
+  {  4451,  12,  19,  13,    0,  -14 },   // 0xFE
+  {  4480,  13,  19,  12,   -1,  -14 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique10pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique10pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique10pt8bGlyphs,
+  0x20, 0xFF, 23 };
+
+// Approx. 6086 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique10pt8bMetrics[] PROGMEM = {
+  {   0,   6,   1 },   // 0x20
+  {   2,   8,   7 },   // 0x21
+  {   2,   9,   8 },   // 0x22
+  {   1,  17,  15 },   // 0x23
+  {   1,  13,  11 },   // 0x24
+  {   2,  19,  17 },   // 0x25
+  {   1,  16,  15 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   8,   9 },   // 0x28
+  {  -1,   8,   6 },   // 0x29
+  {   0,  10,   9 },   // 0x2A
+  {   2,  17,  14 },   // 0x2B
+  {   1,   6,   4 },   // 0x2C
+  {   1,   7,   7 },   // 0x2D
+  {   1,   6,   3 },   // 0x2E
+  {  -1,   7,   9 },   // 0x2F
+  {   1,  13,  12 },   // 0x30
+  {   1,  13,  10 },   // 0x31
+  {   0,  13,  11 },   // 0x32
+  {   0,  13,  11 },   // 0x33
+  {   0,  13,  11 },   // 0x34
+  {   0,  13,  11 },   // 0x35
+  {   1,  13,  12 },   // 0x36
+  {   2,  13,  13 },   // 0x37
+  {   1,  13,  12 },   // 0x38
+  {   1,  13,  12 },   // 0x39
+  {   1,   7,   5 },   // 0x3A
+  {   1,   7,   6 },   // 0x3B
+  {   2,  17,  15 },   // 0x3C
+  {   2,  17,  15 },   // 0x3D
+  {   2,  17,  15 },   // 0x3E
+  {   3,  11,  11 },   // 0x3F
+  {   1,  20,  19 },   // 0x40
+  {  -1,  14,  12 },   // 0x41
+  {   1,  14,  13 },   // 0x42
+  {   1,  14,  14 },   // 0x43
+  {   1,  15,  15 },   // 0x44
+  {   1,  13,  13 },   // 0x45
+  {   1,  12,  12 },   // 0x46
+  {   1,  16,  15 },   // 0x47
+  {   1,  15,  15 },   // 0x48
+  {   1,   6,   6 },   // 0x49
+  {  -3,   6,   6 },   // 0x4A
+  {   1,  13,  15 },   // 0x4B
+  {   1,  11,  10 },   // 0x4C
+  {   1,  17,  17 },   // 0x4D
+  {   1,  15,  15 },   // 0x4E
+  {   1,  16,  15 },   // 0x4F
+  {   1,  12,  12 },   // 0x50
+  {   1,  16,  15 },   // 0x51
+  {   1,  14,  12 },   // 0x52
+  {   0,  13,  12 },   // 0x53
+  {   1,  12,  15 },   // 0x54
+  {   1,  15,  14 },   // 0x55
+  {   2,  14,  15 },   // 0x56
+  {   2,  20,  20 },   // 0x57
+  {  -1,  14,  14 },   // 0x58
+  {   2,  12,  14 },   // 0x59
+  {   0,  14,  15 },   // 0x5A
+  {   1,   8,   8 },   // 0x5B
+  {   2,   7,   6 },   // 0x5C
+  {  -1,   8,   6 },   // 0x5D
+  {   2,  17,  15 },   // 0x5E
+  {   0,  10,  10 },   // 0x5F
+  {   4,  10,   8 },   // 0x60
+  {   1,  12,  11 },   // 0x61
+  {   1,  13,  12 },   // 0x62
+  {   1,  11,  11 },   // 0x63
+  {   1,  13,  13 },   // 0x64
+  {   1,  12,  12 },   // 0x65
+  {   1,   7,   9 },   // 0x66
+  {   1,  13,  12 },   // 0x67
+  {   1,  13,  12 },   // 0x68
+  {   1,   6,   6 },   // 0x69
+  {  -2,   6,   6 },   // 0x6A
+  {   1,  12,  13 },   // 0x6B
+  {   1,   6,   6 },   // 0x6C
+  {   1,  20,  18 },   // 0x6D
+  {   1,  13,  12 },   // 0x6E
+  {   1,  12,  11 },   // 0x6F
+  {   0,  13,  12 },   // 0x70
+  {   1,  13,  12 },   // 0x71
+  {   1,   8,  10 },   // 0x72
+  {   1,  10,  10 },   // 0x73
+  {   2,   8,   9 },   // 0x74
+  {   1,  13,  12 },   // 0x75
+  {   1,  12,  12 },   // 0x76
+  {   2,  16,  17 },   // 0x77
+  {  -1,  12,  12 },   // 0x78
+  {  -1,  12,  12 },   // 0x79
+  {   0,  11,  11 },   // 0x7A
+  {   2,  13,  12 },   // 0x7B
+  {   3,   7,   5 },   // 0x7C
+  {   0,  13,  10 },   // 0x7D
+  {   2,  17,  15 },   // 0x7E
+  {   1,  12,  11 },   // 0x7F
+  {   1,  12,  11 },   // 0x80
+  {   1,  12,  11 },   // 0x81
+  {   1,  12,  11 },   // 0x82
+  {   1,  12,  11 },   // 0x83
+  {   1,  12,  11 },   // 0x84
+  {   1,  12,  11 },   // 0x85
+  {   1,  12,  11 },   // 0x86
+  {   1,  12,  11 },   // 0x87
+  {   1,  12,  11 },   // 0x88
+  {   1,  12,  11 },   // 0x89
+  {   1,  12,  11 },   // 0x8A
+  {   1,  12,  11 },   // 0x8B
+  {   1,  12,  11 },   // 0x8C
+  {   1,  12,  11 },   // 0x8D
+  {   1,  12,  11 },   // 0x8E
+  {   1,  12,  11 },   // 0x8F
+  {   1,  12,  11 },   // 0x90
+  {   1,  12,  11 },   // 0x91
+  {   1,  12,  11 },   // 0x92
+  {   1,  12,  11 },   // 0x93
+  {   1,  12,  11 },   // 0x94
+  {   1,  12,  11 },   // 0x95
+  {   1,  12,  11 },   // 0x96
+  {   1,  12,  11 },   // 0x97
+  {   1,  12,  11 },   // 0x98
+  {   1,  12,  11 },   // 0x99
+  {   1,  12,  11 },   // 0x9A
+  {   1,  12,  11 },   // 0x9B
+  {   1,  12,  11 },   // 0x9C
+  {   1,  12,  11 },   // 0x9D
+  {   1,  12,  11 },   // 0x9E
+  {   1,  12,  11 },   // 0x9F
+  {   0,   6,   1 },   // 0xA0
+  {   2,   8,   7 },   // 0xA1
+  {   1,  13,  11 },   // 0xA2
+  {   0,  13,  12 },   // 0xA3
+  {   1,  13,  11 },   // 0xA4
+  {   1,  13,  13 },   // 0xA5
+  {   3,   7,   5 },   // 0xA6
+  {   0,  10,  10 },   // 0xA7
+  {   4,  10,   9 },   // 0xA8
+  {   3,  20,  17 },   // 0xA9
+  {   1,   9,   9 },   // 0xAA
+  {   1,  12,  12 },   // 0xAB
+  {   2,  17,  15 },   // 0xAC
+  {   1,   7,   7 },   // 0xAD
+  {   3,  20,  18 },   // 0xAE
+  {   4,  10,  10 },   // 0xAF
+  {   2,  10,   8 },   // 0xB0
+  {   3,  17,  15 },   // 0xB1
+  {   1,   8,   8 },   // 0xB2
+  {   0,   8,   7 },   // 0xB3
+  {   5,  10,  10 },   // 0xB4
+  {   0,  13,  12 },   // 0xB5
+  {   2,  13,  12 },   // 0xB6
+  {   2,   6,   4 },   // 0xB7
+  {   1,  10,   5 },   // 0xB8
+  {   1,   8,   7 },   // 0xB9
+  {   1,   9,   9 },   // 0xBA
+  {   1,  12,  12 },   // 0xBB
+  {   1,  19,  18 },   // 0xBC
+  {   1,  19,  19 },   // 0xBD
+  {   0,  19,  18 },   // 0xBE
+  {   1,  11,   9 },   // 0xBF
+  {  -1,  14,  12 },   // 0xC0
+  {  -1,  14,  12 },   // 0xC1
+  {  -1,  14,  12 },   // 0xC2
+  {  -1,  14,  12 },   // 0xC3
+  {  -1,  14,  12 },   // 0xC4
+  {  -1,  14,  12 },   // 0xC5
+  {  -1,  19,  20 },   // 0xC6
+  {   1,  14,  14 },   // 0xC7
+  {   1,  13,  13 },   // 0xC8
+  {   1,  13,  13 },   // 0xC9
+  {   1,  13,  13 },   // 0xCA
+  {   1,  13,  13 },   // 0xCB
+  {   1,   6,   6 },   // 0xCC
+  {   1,   6,   8 },   // 0xCD
+  {   1,   6,   7 },   // 0xCE
+  {   1,   6,   7 },   // 0xCF
+  {   0,  16,  15 },   // 0xD0
+  {   1,  15,  15 },   // 0xD1
+  {   1,  16,  15 },   // 0xD2
+  {   1,  16,  15 },   // 0xD3
+  {   1,  16,  15 },   // 0xD4
+  {   1,  16,  15 },   // 0xD5
+  {   1,  16,  15 },   // 0xD6
+  {   3,  17,  14 },   // 0xD7
+  {  -1,  16,  16 },   // 0xD8
+  {   1,  15,  14 },   // 0xD9
+  {   1,  15,  14 },   // 0xDA
+  {   1,  15,  14 },   // 0xDB
+  {   1,  15,  14 },   // 0xDC
+  {   2,  12,  14 },   // 0xDD
+  {   1,  12,  12 },   // 0xDE
+  {   1,  13,  12 },   // 0xDF
+  {   1,  12,  11 },   // 0xE0
+  {   1,  12,  11 },   // 0xE1
+  {   1,  12,  11 },   // 0xE2
+  {   1,  12,  11 },   // 0xE3
+  {   1,  12,  11 },   // 0xE4
+  {   1,  12,  11 },   // 0xE5
+  {   1,  20,  19 },   // 0xE6
+  {   1,  11,  11 },   // 0xE7
+  {   1,  12,  12 },   // 0xE8
+  {   1,  12,  12 },   // 0xE9
+  {   1,  12,  12 },   // 0xEA
+  {   1,  12,  12 },   // 0xEB
+  {   1,   6,   5 },   // 0xEC
+  {   1,   6,   7 },   // 0xED
+  {   0,   6,   6 },   // 0xEE
+  {   1,   6,   6 },   // 0xEF
+  {   1,  12,  11 },   // 0xF0
+  {   1,  13,  12 },   // 0xF1
+  {   1,  12,  11 },   // 0xF2
+  {   1,  12,  11 },   // 0xF3
+  {   1,  12,  11 },   // 0xF4
+  {   1,  12,  11 },   // 0xF5
+  {   1,  12,  11 },   // 0xF6
+  {   2,  17,  14 },   // 0xF7
+  {   0,  12,  12 },   // 0xF8
+  {   1,  13,  12 },   // 0xF9
+  {   1,  13,  12 },   // 0xFA
+  {   1,  13,  12 },   // 0xFB
+  {   1,  13,  12 },   // 0xFC
+  {  -1,  12,  12 },   // 0xFD
+  {   0,  13,  12 },   // 0xFE
+  {  -1,  12,  12 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique10pt8bWidths = { DejaVuSans_Oblique10pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE10PTLAT1__H
@@ -0,0 +1,917 @@
+#ifndef DEJAVUSANSOBLIQUE11PTLAT1__H
+#define DEJAVUSANSOBLIQUE11PTLAT1__H
+const uint8_t DejaVuSans_Oblique11pt8bBitmaps[] PROGMEM = {
+  0x00, 0x18, 0xC6, 0x33, 0x18, 0xC6, 0x31, 0x08, 0x00, 0x63, 0x18, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x30, 0x03, 0x10, 0x04, 0x60, 0x08, 0xC0, 0x31, 0x83,
+  0xFF, 0xEF, 0xFF, 0xC1, 0x18, 0x06, 0x30, 0x0C, 0x41, 0xFF, 0xFB, 0xFF,
+  0xF0, 0xC6, 0x01, 0x88, 0x02, 0x30, 0x0C, 0x60, 0x00, 0x00, 0x80, 0x10,
+  0x01, 0x00, 0x7E, 0x1F, 0xF1, 0x93, 0x31, 0x03, 0x20, 0x32, 0x01, 0xF0,
+  0x07, 0xC0, 0x2E, 0x04, 0x60, 0x46, 0xC4, 0xEF, 0xFC, 0x7F, 0x00, 0x80,
+  0x08, 0x00, 0x80, 0x1E, 0x03, 0x33, 0x03, 0x18, 0xC3, 0x18, 0x63, 0x0C,
+  0x31, 0x06, 0x19, 0x83, 0x19, 0x80, 0xCD, 0x9E, 0x79, 0xB3, 0x00, 0x98,
+  0xC0, 0x98, 0x60, 0xCC, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x40, 0xCC, 0x40,
+  0x78, 0x03, 0xE0, 0x1F, 0xE0, 0x70, 0x80, 0xC0, 0x01, 0x80, 0x03, 0x80,
+  0x07, 0x80, 0x1B, 0x03, 0x63, 0x05, 0x87, 0x1B, 0x07, 0x66, 0x07, 0xCC,
+  0x07, 0x1C, 0x1E, 0x1F, 0xFE, 0x1F, 0x8E, 0xFF, 0xF0, 0x03, 0x06, 0x0C,
+  0x18, 0x18, 0x30, 0x70, 0x60, 0x60, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0x40, 0x60, 0x60, 0x20, 0x04, 0x06, 0x06, 0x02, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x0E, 0x0C, 0x18, 0x18, 0x30, 0x60,
+  0xC0, 0x08, 0x04, 0x22, 0x2D, 0x61, 0xC0, 0xE1, 0xAD, 0x11, 0x08, 0x04,
+  0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x6D, 0xE8, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x60, 0x18, 0x03,
+  0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C,
+  0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x00, 0x07, 0xC0, 0xFE,
+  0x1C, 0x63, 0x03, 0x70, 0x36, 0x03, 0x60, 0x3C, 0x03, 0xC0, 0x3C, 0x06,
+  0xC0, 0x6C, 0x0E, 0xC0, 0xC6, 0x18, 0x7F, 0x03, 0xE0, 0x07, 0x0F, 0x8C,
+  0xC0, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0x80, 0xC0,
+  0x63, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0x86, 0x0E, 0x00, 0x30, 0x01, 0x80,
+  0x0C, 0x00, 0xC0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0xC0,
+  0x38, 0x03, 0xFF, 0x9F, 0xFC, 0x07, 0xE0, 0x7F, 0x86, 0x0E, 0x00, 0x30,
+  0x01, 0x80, 0x0C, 0x01, 0xC0, 0xFC, 0x07, 0xE0, 0x03, 0x80, 0x0C, 0x00,
+  0x60, 0x07, 0x60, 0x73, 0xFF, 0x0F, 0xE0, 0x00, 0x70, 0x0F, 0x01, 0xF0,
+  0x36, 0x06, 0x60, 0xC6, 0x18, 0x61, 0x86, 0x30, 0xC6, 0x0C, 0xFF, 0xFF,
+  0xFF, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xF1, 0xFF, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0xF8, 0x3F, 0xC2, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0xCC, 0x1C, 0xFF, 0x87, 0xE0, 0x03, 0xE0, 0xFF, 0x1C, 0x13,
+  0x00, 0x70, 0x06, 0x00, 0x6F, 0x8F, 0xFC, 0xF0, 0xEE, 0x06, 0xC0, 0x6C,
+  0x06, 0xC0, 0xC6, 0x1C, 0x7F, 0x83, 0xE0, 0xFF, 0xFF, 0xFE, 0x00, 0xE0,
+  0x0C, 0x01, 0xC0, 0x18, 0x03, 0x00, 0x70, 0x06, 0x00, 0xC0, 0x1C, 0x01,
+  0x80, 0x38, 0x03, 0x00, 0x60, 0x0E, 0x00, 0x07, 0xC1, 0xFE, 0x18, 0x73,
+  0x03, 0x30, 0x33, 0x03, 0x38, 0x61, 0xFC, 0x3F, 0xC7, 0x0E, 0xC0, 0x6C,
+  0x06, 0xC0, 0x6E, 0x1C, 0x7F, 0xC3, 0xF0, 0x0F, 0x87, 0xF9, 0xC3, 0x30,
+  0x3C, 0x07, 0x80, 0xF0, 0x3F, 0x0F, 0x7F, 0xE7, 0xD8, 0x03, 0x00, 0xE0,
+  0x19, 0x0E, 0x3F, 0x87, 0xE0, 0x33, 0x30, 0x00, 0x00, 0xCC, 0xC0, 0x18,
+  0xC6, 0x00, 0x00, 0x00, 0x63, 0x19, 0x88, 0x00, 0x00, 0x04, 0x00, 0xF0,
+  0x1F, 0x83, 0xF0, 0x3F, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x07, 0xE0, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x07, 0xC0, 0x7C, 0x0F, 0xC1, 0xF8, 0x0F,
+  0x00, 0x20, 0x00, 0x3F, 0x7F, 0xE0, 0x60, 0x30, 0x18, 0x38, 0x30, 0x70,
+  0x30, 0x30, 0x18, 0x00, 0x00, 0x07, 0x03, 0x01, 0x80, 0x00, 0xFE, 0x00,
+  0x3F, 0xF8, 0x0F, 0x81, 0xC1, 0xC0, 0x0E, 0x38, 0x00, 0x73, 0x0F, 0x23,
+  0x61, 0xFA, 0x36, 0x38, 0xE3, 0xC6, 0x04, 0x3C, 0x60, 0x46, 0xC6, 0x0C,
+  0x6C, 0x71, 0xDC, 0xC3, 0xFF, 0x8E, 0x1E, 0xE0, 0x60, 0x00, 0x07, 0x00,
+  0x40, 0x3C, 0x1C, 0x01, 0xFF, 0x80, 0x07, 0xE0, 0x00, 0x00, 0x70, 0x00,
+  0xE0, 0x03, 0xC0, 0x0E, 0xC0, 0x19, 0x80, 0x73, 0x00, 0xC6, 0x03, 0x0C,
+  0x0E, 0x0C, 0x18, 0x18, 0x7F, 0xF0, 0xFF, 0xE3, 0x00, 0xCE, 0x01, 0xD8,
+  0x01, 0xF0, 0x03, 0x1F, 0xE0, 0xFF, 0x86, 0x0E, 0x60, 0x33, 0x01, 0x98,
+  0x0C, 0xC0, 0xC7, 0xFC, 0x7F, 0xE3, 0x03, 0x98, 0x0C, 0xC0, 0x66, 0x03,
+  0x70, 0x73, 0xFF, 0x1F, 0xF0, 0x03, 0xF0, 0x3F, 0xE1, 0xC1, 0xCE, 0x01,
+  0x70, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00,
+  0x30, 0x00, 0xE0, 0x11, 0xC1, 0xC3, 0xFE, 0x07, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xF0, 0x60, 0x71, 0x80, 0x73, 0x00, 0x66, 0x00, 0xCC, 0x01, 0x98, 0x03,
+  0x60, 0x06, 0xC0, 0x0D, 0x80, 0x33, 0x00, 0xE6, 0x03, 0x9C, 0x0E, 0x3F,
+  0xF8, 0x7F, 0xC0, 0x1F, 0xF8, 0xFF, 0xC6, 0x00, 0x60, 0x03, 0x00, 0x18,
+  0x00, 0xC0, 0x07, 0xFC, 0x7F, 0xE3, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00,
+  0x70, 0x03, 0xFF, 0x1F, 0xF8, 0x1F, 0xF1, 0xFF, 0x18, 0x03, 0x00, 0x30,
+  0x03, 0x00, 0x30, 0x03, 0xFC, 0x7F, 0xC6, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x0E, 0x00, 0xC0, 0x0C, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x70, 0x39, 0xC0,
+  0x23, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x7E, 0xC0, 0xFD, 0x80, 0x3B,
+  0x00, 0x66, 0x00, 0xCE, 0x01, 0x8E, 0x07, 0x0F, 0xFC, 0x0F, 0xE0, 0x18,
+  0x06, 0x30, 0x0C, 0x60, 0x39, 0x80, 0x63, 0x00, 0xC6, 0x01, 0x8C, 0x03,
+  0x1F, 0xFE, 0x7F, 0xF8, 0xC0, 0x31, 0x80, 0x63, 0x00, 0xC6, 0x01, 0x9C,
+  0x06, 0x30, 0x0C, 0x60, 0x18, 0x18, 0xC6, 0x63, 0x18, 0xC6, 0x63, 0x18,
+  0xC6, 0x73, 0x18, 0x01, 0x80, 0xC0, 0xE0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x0C, 0x3E,
+  0x1C, 0x00, 0x18, 0x1C, 0x30, 0x70, 0x61, 0xC1, 0x87, 0x03, 0x38, 0x06,
+  0xE0, 0x0F, 0x80, 0x1E, 0x00, 0x6C, 0x00, 0xCC, 0x01, 0x9C, 0x03, 0x1C,
+  0x06, 0x1C, 0x1C, 0x18, 0x30, 0x18, 0x60, 0x38, 0x18, 0x06, 0x01, 0x80,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x38, 0x0F, 0xFF, 0xFF, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x7C, 0xD8,
+  0x3E, 0x36, 0x0D, 0x8D, 0x87, 0x63, 0x31, 0x98, 0xCC, 0xC6, 0x63, 0x73,
+  0x18, 0xD8, 0xC6, 0x3E, 0x31, 0x87, 0x0C, 0x61, 0x83, 0x30, 0x01, 0x8C,
+  0x00, 0x63, 0x00, 0x18, 0x1C, 0x06, 0x3C, 0x0C, 0x78, 0x39, 0xB0, 0x63,
+  0x60, 0xC6, 0x61, 0x8C, 0xC3, 0x19, 0x86, 0x61, 0x98, 0xC3, 0x31, 0x86,
+  0x63, 0x06, 0xC6, 0x0D, 0x9C, 0x1E, 0x30, 0x1C, 0x60, 0x38, 0x03, 0xF0,
+  0x0F, 0xFC, 0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03, 0x60, 0x03, 0x60, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x1C,
+  0x70, 0x78, 0x3F, 0xF0, 0x0F, 0xC0, 0x1F, 0xE0, 0xFF, 0x86, 0x0E, 0x60,
+  0x33, 0x01, 0x98, 0x0C, 0xC0, 0xE6, 0x0E, 0x7F, 0xE3, 0xFE, 0x18, 0x00,
+  0xC0, 0x06, 0x00, 0x70, 0x03, 0x00, 0x18, 0x00, 0x03, 0xF0, 0x0F, 0xFC,
+  0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03, 0x60, 0x03, 0x60, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x78,
+  0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x1F, 0xE0,
+  0xFF, 0x86, 0x0E, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC1, 0xC7, 0xFC, 0x7F,
+  0xC3, 0x07, 0x18, 0x18, 0xC0, 0xE6, 0x03, 0x70, 0x1B, 0x00, 0xF8, 0x03,
+  0x03, 0xF0, 0x7F, 0xC7, 0x06, 0x60, 0x03, 0x00, 0x18, 0x00, 0xE0, 0x03,
+  0xF0, 0x07, 0xE0, 0x03, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x20, 0x73, 0xFF,
+  0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x18,
+  0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x30, 0x0C, 0xC0, 0x37, 0x00, 0xD8,
+  0x06, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0xC0, 0x33, 0x00, 0xCC,
+  0x03, 0x30, 0x0C, 0xC0, 0x63, 0x83, 0x87, 0xFC, 0x0F, 0xC0, 0xC0, 0x0F,
+  0x80, 0x1B, 0x00, 0x73, 0x00, 0xC6, 0x03, 0x0C, 0x0E, 0x18, 0x18, 0x30,
+  0x70, 0x30, 0xC0, 0x63, 0x00, 0xCE, 0x01, 0x98, 0x03, 0x70, 0x06, 0xC0,
+  0x07, 0x00, 0x0E, 0x00, 0xC0, 0xE0, 0x3C, 0x0F, 0x06, 0xC1, 0xF0, 0x6C,
+  0x1B, 0x0C, 0xC1, 0xB0, 0xCC, 0x33, 0x1C, 0xC3, 0x31, 0x8C, 0x63, 0x18,
+  0x66, 0x33, 0x06, 0xE3, 0x30, 0x6C, 0x36, 0x07, 0xC3, 0x60, 0x78, 0x3E,
+  0x07, 0x83, 0xC0, 0x70, 0x3C, 0x07, 0x03, 0x80, 0x0C, 0x07, 0x06, 0x0E,
+  0x06, 0x0C, 0x03, 0x18, 0x03, 0x38, 0x01, 0xF0, 0x01, 0xE0, 0x01, 0xC0,
+  0x01, 0xC0, 0x03, 0x60, 0x06, 0x60, 0x0E, 0x70, 0x1C, 0x30, 0x38, 0x38,
+  0x70, 0x18, 0xE0, 0x1C, 0xC0, 0x3B, 0x01, 0x98, 0x18, 0x61, 0x83, 0x1C,
+  0x0D, 0xC0, 0x7C, 0x01, 0xC0, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x01,
+  0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
+  0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xFF, 0xF8,
+  0xFF, 0xF8, 0x0F, 0x87, 0xC7, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x70, 0x30,
+  0x18, 0x0C, 0x06, 0x07, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x70, 0x3E, 0x1F,
+  0x00, 0xCC, 0xCC, 0xC4, 0x66, 0x66, 0x66, 0x66, 0x23, 0x33, 0x0F, 0x87,
+  0xC0, 0xE0, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0x06, 0x03, 0x01, 0x80, 0xC0,
+  0xE0, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0x3E, 0x1F, 0x00, 0x07, 0x80, 0x3F,
+  0x01, 0xCE, 0x0E, 0x1C, 0x70, 0x3B, 0x80, 0x70, 0xFF, 0xFF, 0xFC, 0xC6,
+  0x23, 0x0F, 0x87, 0xFC, 0x83, 0x80, 0x31, 0xFE, 0xFF, 0xD8, 0x36, 0x06,
+  0xC1, 0xDC, 0x79, 0xFB, 0x1E, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00,
+  0x30, 0x03, 0x3C, 0x3F, 0xE3, 0x87, 0x70, 0x37, 0x03, 0x60, 0x36, 0x03,
+  0x60, 0x66, 0x06, 0xF1, 0xCD, 0xF8, 0xCF, 0x00, 0x07, 0xC3, 0xFC, 0xE0,
+  0xB8, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1C, 0x11, 0xFE, 0x1F,
+  0x80, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x60, 0x03, 0x07, 0x98, 0x7E,
+  0xC7, 0x1E, 0x60, 0x73, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x0E, 0x60, 0x73,
+  0x87, 0x0F, 0xF8, 0x3C, 0xC0, 0x0F, 0x83, 0xF8, 0xC3, 0xB0, 0x36, 0x07,
+  0xFF, 0xFF, 0xFE, 0x00, 0xC0, 0x1C, 0x11, 0xFE, 0x1F, 0x80, 0x0F, 0x8F,
+  0xC6, 0x06, 0x03, 0x07, 0xF3, 0xF8, 0x60, 0x20, 0x30, 0x18, 0x0C, 0x06,
+  0x03, 0x03, 0x01, 0x80, 0xC0, 0x00, 0x0F, 0x31, 0xFB, 0x30, 0xE6, 0x06,
+  0x60, 0x6C, 0x06, 0xC0, 0x6C, 0x0C, 0xC0, 0xCE, 0x1C, 0x7E, 0xC3, 0xCC,
+  0x01, 0x80, 0x18, 0x87, 0x0F, 0xF0, 0x7C, 0x00, 0x18, 0x01, 0x80, 0x18,
+  0x03, 0x00, 0x30, 0x03, 0x3E, 0x37, 0xF3, 0x87, 0x70, 0x37, 0x03, 0x60,
+  0x36, 0x06, 0x60, 0x66, 0x06, 0xC0, 0x6C, 0x0C, 0xC0, 0xC0, 0x18, 0xC6,
+  0x00, 0x18, 0xC6, 0x63, 0x18, 0xC6, 0x33, 0x18, 0xC0, 0x03, 0x03, 0x03,
+  0x00, 0x00, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x30, 0x30, 0xF0, 0xE0, 0x18, 0x00, 0xC0, 0x06, 0x00,
+  0x60, 0x03, 0x00, 0x18, 0x38, 0xC7, 0x86, 0x78, 0x77, 0x03, 0xF0, 0x1E,
+  0x00, 0xF8, 0x06, 0xE0, 0x33, 0x83, 0x0E, 0x18, 0x38, 0xC0, 0xE0, 0x18,
+  0xC6, 0x63, 0x18, 0xC6, 0x73, 0x18, 0xC6, 0x33, 0x18, 0xC0, 0x33, 0xC3,
+  0xC7, 0xFD, 0xFC, 0xE3, 0xE3, 0xB8, 0x38, 0x36, 0x06, 0x06, 0xC0, 0xC0,
+  0xD8, 0x30, 0x33, 0x06, 0x06, 0x60, 0xC0, 0xD8, 0x18, 0x1B, 0x06, 0x06,
+  0x60, 0xC0, 0xC0, 0x33, 0xE3, 0xFF, 0x38, 0x77, 0x03, 0x60, 0x36, 0x03,
+  0x60, 0x66, 0x06, 0x60, 0x6C, 0x06, 0xC0, 0xCC, 0x0C, 0x0F, 0x83, 0xF8,
+  0xC3, 0xB0, 0x36, 0x07, 0x80, 0xF0, 0x1E, 0x06, 0xC0, 0xDC, 0x31, 0xFC,
+  0x1F, 0x00, 0x19, 0xE0, 0xFF, 0x87, 0x0E, 0x70, 0x33, 0x81, 0x98, 0x0C,
+  0xC0, 0x66, 0x06, 0x70, 0x33, 0xC7, 0x1B, 0xF0, 0xCF, 0x06, 0x00, 0x30,
+  0x03, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x0F, 0x31, 0xFB, 0x38, 0xF6, 0x06,
+  0x60, 0x6C, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xEE, 0x1C, 0x7F, 0xC3, 0xCC,
+  0x00, 0xC0, 0x0C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x33, 0x9F, 0xCE, 0x0E,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x00, 0x0F, 0xC3,
+  0xFC, 0xE0, 0x98, 0x03, 0x80, 0x3E, 0x01, 0xF0, 0x06, 0x00, 0xC8, 0x3B,
+  0xFE, 0x1F, 0x00, 0x30, 0x30, 0x30, 0xFF, 0xFE, 0x60, 0x60, 0x60, 0x60,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0x78, 0x30, 0x33, 0x03, 0x60, 0x36, 0x06,
+  0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xEE, 0x1C, 0xFE, 0xC7, 0xCC,
+  0xC0, 0x7C, 0x06, 0xE0, 0xE6, 0x0C, 0x61, 0x86, 0x38, 0x63, 0x06, 0x70,
+  0x36, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0xC3, 0x83, 0xC3, 0x86, 0xC7, 0x86,
+  0xC7, 0x8C, 0xCF, 0x8C, 0xCC, 0xDC, 0xDC, 0xD8, 0x78, 0xF8, 0x78, 0xF0,
+  0x70, 0xF0, 0x70, 0xE0, 0x60, 0xE0, 0x1C, 0x1C, 0x30, 0xE0, 0x67, 0x01,
+  0xB8, 0x03, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xE0, 0x1C, 0xC0, 0xE3, 0x87,
+  0x06, 0x38, 0x1C, 0x18, 0x1C, 0x60, 0x61, 0x83, 0x86, 0x0C, 0x0C, 0x60,
+  0x33, 0x80, 0xCC, 0x03, 0x70, 0x0F, 0x80, 0x1C, 0x00, 0x70, 0x01, 0x80,
+  0x0E, 0x00, 0x30, 0x01, 0xC0, 0x3E, 0x00, 0xF0, 0x00, 0x3F, 0xF3, 0xFF,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xFF, 0xCF, 0xFC, 0x01, 0xC1, 0xF0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0,
+  0x30, 0x18, 0x3E, 0x0F, 0x00, 0xE0, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30,
+  0x0C, 0x03, 0xE0, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x01,
+  0xF0, 0x06, 0x00, 0xC0, 0x18, 0x07, 0x00, 0xC0, 0x18, 0x03, 0x80, 0x3C,
+  0x0F, 0x81, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x01, 0x83, 0xE0,
+  0x78, 0x00, 0x3E, 0x07, 0xFF, 0xFC, 0x1F, 0x00, 0x00, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0x80,
+  0x00, 0x18, 0xC6, 0x00, 0x10, 0x8C, 0x63, 0x18, 0xCE, 0x63, 0x18, 0x01,
+  0x00, 0x20, 0x04, 0x03, 0xE1, 0xFE, 0x74, 0x98, 0x83, 0x10, 0xC2, 0x18,
+  0xC3, 0x10, 0x62, 0x0E, 0x48, 0xFF, 0x0F, 0xC0, 0x40, 0x08, 0x01, 0x00,
+  0x00, 0xF0, 0x1F, 0xC1, 0xC2, 0x0C, 0x00, 0x60, 0x06, 0x00, 0x30, 0x07,
+  0xF8, 0x3F, 0xC0, 0x60, 0x03, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x03, 0xFF,
+  0x9F, 0xF8, 0x80, 0x6D, 0xD9, 0xFF, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x31,
+  0x8C, 0x7F, 0xCD, 0xDA, 0x00, 0x80, 0x30, 0x1C, 0xC0, 0xE1, 0x83, 0x06,
+  0x18, 0x08, 0xE0, 0x33, 0x07, 0xDF, 0x1F, 0xFC, 0x07, 0x00, 0x18, 0x0F,
+  0xFE, 0x3F, 0xF8, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFC, 0x07, 0xE1, 0xF8, 0x70, 0x0C, 0x01, 0xC0, 0x3C, 0x0D,
+  0xC3, 0x0E, 0x60, 0xCC, 0x18, 0xE3, 0x0E, 0xC0, 0xE0, 0x06, 0x00, 0xC0,
+  0x38, 0xFE, 0x1F, 0x80, 0xE7, 0xE7, 0x07, 0xE0, 0x18, 0x18, 0x30, 0x0C,
+  0x63, 0xC6, 0x4C, 0x22, 0x8C, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01,
+  0x98, 0x01, 0x8C, 0x01, 0x4E, 0x22, 0x63, 0xC6, 0x30, 0x0C, 0x18, 0x18,
+  0x07, 0xE0, 0x0F, 0x08, 0xC0, 0x63, 0xF3, 0x1B, 0x09, 0x8C, 0xCE, 0x3B,
+  0x00, 0x3F, 0x80, 0x04, 0x21, 0x8C, 0x63, 0x18, 0xCE, 0x61, 0x8C, 0x18,
+  0xC1, 0x8C, 0x18, 0x82, 0x10, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x03,
+  0x00, 0x0C, 0x00, 0x30, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x18, 0x18, 0x30,
+  0x0C, 0x67, 0xE6, 0x46, 0x32, 0x86, 0x31, 0x86, 0x31, 0x87, 0xE1, 0x86,
+  0x41, 0x86, 0x61, 0x86, 0x31, 0x46, 0x32, 0x66, 0x1E, 0x30, 0x0C, 0x18,
+  0x18, 0x07, 0xE0, 0xFF, 0xFC, 0x38, 0x8A, 0x0C, 0x18, 0x28, 0x8E, 0x00,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x1E, 0x31, 0x80, 0xC0, 0x60, 0x70, 0xF0, 0xE0, 0xE0, 0xFE, 0x00,
+  0x3E, 0x03, 0x03, 0x3C, 0x06, 0x06, 0x06, 0x0C, 0xF8, 0x18, 0xC6, 0x30,
+  0x18, 0x18, 0xC0, 0xC6, 0x06, 0x60, 0x63, 0x03, 0x18, 0x18, 0xC0, 0xC6,
+  0x0E, 0x70, 0x63, 0x87, 0x1F, 0xFC, 0xDE, 0xE6, 0x00, 0x30, 0x03, 0x00,
+  0x18, 0x00, 0xC0, 0x00, 0x0F, 0xE7, 0xC9, 0xF9, 0x7F, 0x2F, 0xCD, 0xF9,
+  0xBF, 0x33, 0xE4, 0x3C, 0x81, 0xB0, 0x26, 0x04, 0xC1, 0x90, 0x32, 0x06,
+  0x40, 0x98, 0x13, 0x02, 0x60, 0xFC, 0x08, 0x7F, 0xE0, 0x3E, 0x06, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x7F, 0x0F, 0x06, 0x63, 0x0D, 0x83, 0x60,
+  0xD8, 0x36, 0x18, 0xCC, 0x1E, 0x00, 0x0F, 0xF0, 0x42, 0x04, 0x60, 0xC6,
+  0x0C, 0x60, 0xC6, 0x19, 0xCC, 0x63, 0x18, 0xC6, 0x10, 0x80, 0x3E, 0x01,
+  0x80, 0x60, 0x30, 0x0C, 0x06, 0x00, 0xC0, 0xC0, 0x0C, 0x18, 0x00, 0xC1,
+  0x00, 0x18, 0x30, 0x01, 0x86, 0x03, 0x7F, 0xC0, 0x70, 0x18, 0x0A, 0x03,
+  0x01, 0x60, 0x30, 0x26, 0x06, 0x06, 0x60, 0xC0, 0x7F, 0x18, 0x00, 0xC3,
+  0x00, 0x0C, 0x3E, 0x01, 0x80, 0x18, 0x0C, 0x00, 0xC0, 0x60, 0x03, 0x03,
+  0x00, 0x0C, 0x18, 0x00, 0x30, 0x40, 0x01, 0x83, 0x00, 0x06, 0x18, 0x3C,
+  0x7F, 0xC3, 0x18, 0x06, 0x00, 0x60, 0x30, 0x01, 0x80, 0xC0, 0x0E, 0x06,
+  0x00, 0xF0, 0x30, 0x07, 0x01, 0x80, 0x38, 0x0C, 0x01, 0xFC, 0x3E, 0x00,
+  0xC0, 0x18, 0x0C, 0x00, 0xC0, 0xC0, 0x78, 0x0C, 0x00, 0x60, 0xC0, 0x03,
+  0x04, 0x00, 0x18, 0x60, 0x01, 0x86, 0x03, 0xF8, 0x60, 0x38, 0x06, 0x02,
+  0x80, 0x60, 0x2C, 0x03, 0x02, 0x60, 0x30, 0x33, 0x03, 0x01, 0xFC, 0x30,
+  0x01, 0x83, 0x00, 0x0C, 0x01, 0x81, 0xC0, 0xC0, 0x00, 0x00, 0x38, 0x18,
+  0x0C, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x06, 0x03, 0x83, 0xFF, 0x7E, 0x00,
+  0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
+  0x1C, 0x00, 0x78, 0x01, 0xD8, 0x03, 0x30, 0x0E, 0x60, 0x18, 0xC0, 0x61,
+  0x81, 0xC1, 0x83, 0x03, 0x0F, 0xFE, 0x1F, 0xFC, 0x60, 0x19, 0xC0, 0x3B,
+  0x00, 0x3E, 0x00, 0x60, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xD8, 0x03, 0x30, 0x0E,
+  0x60, 0x18, 0xC0, 0x61, 0x81, 0xC1, 0x83, 0x03, 0x0F, 0xFE, 0x1F, 0xFC,
+  0x60, 0x19, 0xC0, 0x3B, 0x00, 0x3E, 0x00, 0x60, 0x00, 0x78, 0x01, 0xB0,
+  0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x01,
+  0xD8, 0x03, 0x30, 0x0E, 0x60, 0x18, 0xC0, 0x61, 0x81, 0xC1, 0x83, 0x03,
+  0x0F, 0xFE, 0x1F, 0xFC, 0x60, 0x19, 0xC0, 0x3B, 0x00, 0x3E, 0x00, 0x60,
+  0x00, 0xE6, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0E, 0x00,
+  0x3C, 0x00, 0xEC, 0x01, 0x98, 0x07, 0x30, 0x0C, 0x60, 0x30, 0xC0, 0xE0,
+  0xC1, 0x81, 0x87, 0xFF, 0x0F, 0xFE, 0x30, 0x0C, 0xE0, 0x1D, 0x80, 0x1F,
+  0x00, 0x30, 0x01, 0xCE, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0E, 0x00, 0x3C, 0x00, 0xEC, 0x01, 0x98, 0x07, 0x30, 0x0C, 0x60, 0x30,
+  0xC0, 0xE0, 0xC1, 0x81, 0x87, 0xFF, 0x0F, 0xFE, 0x30, 0x0C, 0xE0, 0x1D,
+  0x80, 0x1F, 0x00, 0x30, 0x00, 0x78, 0x01, 0x18, 0x02, 0x10, 0x04, 0x60,
+  0x07, 0x80, 0x1F, 0x00, 0x36, 0x00, 0xEC, 0x01, 0x98, 0x06, 0x30, 0x0C,
+  0x30, 0x30, 0x60, 0xE0, 0xC1, 0x81, 0x87, 0xFF, 0x0F, 0xFE, 0x30, 0x0C,
+  0xE0, 0x0D, 0x80, 0x1F, 0x00, 0x30, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFC,
+  0x03, 0xB0, 0x00, 0x06, 0x60, 0x00, 0x18, 0xC0, 0x00, 0x71, 0x80, 0x00,
+  0xC3, 0x00, 0x03, 0x8F, 0xFC, 0x06, 0x1F, 0xF8, 0x18, 0x30, 0x00, 0x7F,
+  0xE0, 0x00, 0xFF, 0xC0, 0x03, 0x83, 0x00, 0x06, 0x06, 0x00, 0x18, 0x0F,
+  0xFC, 0x70, 0x1F, 0xF8, 0x03, 0xF0, 0x3F, 0xE1, 0xC1, 0xCE, 0x01, 0x70,
+  0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xE0, 0x11, 0xC1, 0xC3, 0xFE, 0x07, 0xF0, 0x01, 0x00, 0x04, 0x01,
+  0xF0, 0x07, 0x80, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0F,
+  0xFC, 0x7F, 0xE3, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0xFE,
+  0x3F, 0xF1, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0xFF, 0x8F,
+  0xFC, 0x00, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xFC,
+  0x7F, 0xE3, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0xFE, 0x3F,
+  0xF1, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0xFF, 0x8F, 0xFC,
+  0x00, 0x01, 0xE0, 0x1B, 0x01, 0x8C, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F,
+  0xE3, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0xFE, 0x3F, 0xF1,
+  0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0xFF, 0x8F, 0xFC, 0x00,
+  0x07, 0x38, 0x39, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x60, 0x06,
+  0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x7F, 0xC7, 0xFE, 0x30, 0x01, 0x80,
+  0x0C, 0x00, 0x60, 0x07, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x38, 0x60, 0xC0,
+  0x00, 0x61, 0x86, 0x30, 0xC3, 0x0C, 0x31, 0x86, 0x18, 0x61, 0x8E, 0x30,
+  0xC0, 0x06, 0x0C, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0xC0, 0x1E, 0x36,
+  0x63, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0xC0, 0x73, 0xB9, 0xC0, 0x00, 0x01,
+  0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x70, 0x30, 0x18, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x0C, 0x0E,
+  0x18, 0x07, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+  0x30, 0x03, 0x30, 0x06, 0x30, 0x0E, 0x30, 0x1C, 0x70, 0x38, 0x7F, 0xF0,
+  0x7F, 0xC0, 0x01, 0xCC, 0x06, 0x70, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x63,
+  0xC0, 0xC7, 0x83, 0x9B, 0x06, 0x36, 0x0C, 0x66, 0x18, 0xCC, 0x31, 0x98,
+  0x66, 0x19, 0x8C, 0x33, 0x18, 0x66, 0x30, 0x6C, 0x60, 0xD9, 0xC1, 0xE3,
+  0x01, 0xC6, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFC, 0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03,
+  0x60, 0x03, 0x60, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06,
+  0xC0, 0x0C, 0x60, 0x1C, 0x70, 0x78, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0x18,
+  0x00, 0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFC,
+  0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03, 0x60, 0x03, 0x60, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x1C, 0x70, 0x78,
+  0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0x78, 0x00, 0xD8, 0x01, 0x8C, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFC, 0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03,
+  0x60, 0x03, 0x60, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06,
+  0xC0, 0x0C, 0x60, 0x1C, 0x70, 0x78, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0xE6,
+  0x01, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFC, 0x1E, 0x0E,
+  0x38, 0x07, 0x30, 0x03, 0x60, 0x03, 0x60, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x1C, 0x70, 0x78, 0x3F, 0xF0,
+  0x0F, 0xC0, 0x01, 0xCE, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
+  0x0F, 0xFC, 0x1E, 0x0E, 0x38, 0x07, 0x30, 0x03, 0x60, 0x03, 0x60, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x1C,
+  0x70, 0x78, 0x3F, 0xF0, 0x0F, 0xC0, 0x40, 0x2E, 0x07, 0x70, 0xE3, 0x9C,
+  0x1F, 0x80, 0xF0, 0x0F, 0x01, 0xF8, 0x39, 0xC7, 0x0E, 0xE0, 0x74, 0x02,
+  0x00, 0x7C, 0x20, 0x7F, 0xEC, 0x1E, 0x0F, 0x07, 0x00, 0xE0, 0xC0, 0x7C,
+  0x30, 0x19, 0x86, 0x06, 0x31, 0x83, 0x86, 0x30, 0xC0, 0xC6, 0x30, 0x30,
+  0xDC, 0x06, 0x1F, 0x01, 0x81, 0x80, 0x70, 0x78, 0x3C, 0x1B, 0xFF, 0x06,
+  0x1F, 0x80, 0x01, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0x33, 0x00, 0xDC, 0x03, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60,
+  0x1B, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC0, 0x33, 0x01, 0x8E, 0x0E, 0x1F,
+  0xF0, 0x3F, 0x00, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  0xC0, 0x33, 0x00, 0xDC, 0x03, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06,
+  0x60, 0x1B, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC0, 0x33, 0x01, 0x8E, 0x0E,
+  0x1F, 0xF0, 0x3F, 0x00, 0x00, 0xF0, 0x06, 0xC0, 0x31, 0x80, 0x00, 0x00,
+  0x00, 0xC0, 0x33, 0x00, 0xDC, 0x03, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98,
+  0x06, 0x60, 0x1B, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC0, 0x33, 0x01, 0x8E,
+  0x0E, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0x9C, 0x0E, 0x70, 0x00, 0x00, 0x00,
+  0x30, 0x0C, 0xC0, 0x37, 0x00, 0xD8, 0x06, 0x60, 0x19, 0x80, 0x66, 0x01,
+  0x98, 0x06, 0xC0, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC0, 0x63, 0x83,
+  0x87, 0xFC, 0x0F, 0xC0, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  0x60, 0x1D, 0x80, 0xCC, 0x0C, 0x30, 0xC1, 0x8E, 0x06, 0xE0, 0x3E, 0x00,
+  0xE0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0xC0, 0x06, 0x00, 0x30,
+  0x01, 0x80, 0x00, 0x18, 0x01, 0x80, 0x18, 0x03, 0xFC, 0x3F, 0xE3, 0x07,
+  0x30, 0x33, 0x03, 0x60, 0x36, 0x07, 0x60, 0xE7, 0xFC, 0x7F, 0x8E, 0x00,
+  0xC0, 0x0C, 0x00, 0x07, 0xC0, 0xFE, 0x1C, 0x71, 0x83, 0x30, 0x73, 0x1C,
+  0x33, 0x03, 0x30, 0x33, 0x87, 0x1C, 0x60, 0xE6, 0x07, 0x60, 0x36, 0x03,
+  0xE8, 0x7D, 0xFE, 0xCF, 0x80, 0x0C, 0x00, 0xC0, 0x08, 0x01, 0x80, 0x00,
+  0x00, 0x03, 0xE1, 0xFF, 0x20, 0xE0, 0x0C, 0x7F, 0xBF, 0xF6, 0x0D, 0x81,
+  0xB0, 0x77, 0x1E, 0x7E, 0xC7, 0xB0, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x00, 0x00, 0x00, 0x0F, 0x83, 0xFE, 0x20, 0xE0, 0x06, 0x1F, 0xE7, 0xFE,
+  0x60, 0xCC, 0x0C, 0xC1, 0xCE, 0x3C, 0x7E, 0xC3, 0xD8, 0x01, 0x80, 0x78,
+  0x19, 0x06, 0x30, 0x00, 0x00, 0x03, 0xE1, 0xFF, 0x20, 0xE0, 0x0C, 0x7F,
+  0xBF, 0xF6, 0x0D, 0x81, 0xB0, 0x77, 0x1E, 0x7E, 0xC7, 0xB0, 0x07, 0x30,
+  0x5A, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xE2, 0x0E, 0x00, 0x61,
+  0xFE, 0x7F, 0xE6, 0x0C, 0xC0, 0xCC, 0x1C, 0xE3, 0xC7, 0xEC, 0x3D, 0x80,
+  0x0E, 0x70, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xE2, 0x0E,
+  0x00, 0x61, 0xFE, 0x7F, 0xE6, 0x0C, 0xC0, 0xCC, 0x1C, 0xE3, 0xC7, 0xEC,
+  0x3D, 0x80, 0x03, 0xC0, 0xCC, 0x10, 0x82, 0x10, 0x66, 0x07, 0x80, 0x00,
+  0x7C, 0x3F, 0xE4, 0x1C, 0x01, 0x8F, 0xF7, 0xFE, 0xC1, 0xB0, 0x36, 0x0E,
+  0xE3, 0xCF, 0xD8, 0xF6, 0x00, 0x0F, 0x87, 0xC3, 0xFC, 0xFE, 0x20, 0x78,
+  0x70, 0x07, 0x03, 0x1F, 0xE0, 0x37, 0xFF, 0xFF, 0x60, 0x7F, 0xFC, 0x06,
+  0x00, 0xC0, 0xE0, 0x0E, 0x1F, 0x04, 0x7F, 0x3F, 0xC3, 0xC1, 0xF8, 0x07,
+  0xC3, 0xFC, 0xE0, 0xB8, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1C,
+  0x11, 0xFE, 0x1F, 0x80, 0x40, 0x08, 0x1F, 0x03, 0xC0, 0x0C, 0x00, 0xC0,
+  0x08, 0x01, 0x80, 0x00, 0x00, 0x03, 0xE0, 0xFE, 0x30, 0xEC, 0x0D, 0x81,
+  0xFF, 0xFF, 0xFF, 0x80, 0x30, 0x07, 0x04, 0x7F, 0x87, 0xE0, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFC, 0x30, 0xE6,
+  0x06, 0x60, 0x6F, 0xFE, 0xFF, 0xEC, 0x00, 0xC0, 0x0E, 0x08, 0x7F, 0x83,
+  0xF0, 0x01, 0x80, 0x78, 0x19, 0x06, 0x30, 0x00, 0x00, 0x03, 0xE0, 0xFE,
+  0x30, 0xEC, 0x0D, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x30, 0x07, 0x04, 0x7F,
+  0x87, 0xE0, 0x0E, 0x70, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+  0xC3, 0x0E, 0x60, 0x66, 0x06, 0xFF, 0xEF, 0xFE, 0xC0, 0x0C, 0x00, 0xE0,
+  0x87, 0xF8, 0x3F, 0x00, 0xC6, 0x23, 0x00, 0x33, 0x36, 0x66, 0x66, 0x6C,
+  0xCC, 0x06, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x30, 0x30, 0x30, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0x18, 0x79, 0x96, 0x30, 0x00,
+  0x0C, 0x18, 0x30, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x60, 0xC1, 0x80, 0xE7,
+  0xE7, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xC0, 0xC0, 0xC0, 0x06, 0x00, 0x7E, 0x07, 0x01, 0xB8, 0x01, 0xC0,
+  0xFC, 0x1F, 0xE3, 0x86, 0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xCC,
+  0x0C, 0xE1, 0x87, 0xF0, 0x3E, 0x00, 0x07, 0x30, 0x5A, 0x0C, 0xE0, 0x00,
+  0x00, 0x03, 0x3E, 0x3F, 0xF3, 0x87, 0x70, 0x36, 0x03, 0x60, 0x36, 0x06,
+  0x60, 0x66, 0x06, 0xC0, 0x6C, 0x0C, 0xC0, 0xC0, 0x0C, 0x00, 0xC0, 0x08,
+  0x01, 0x80, 0x00, 0x00, 0x03, 0xE0, 0xFE, 0x30, 0xEC, 0x0D, 0x81, 0xE0,
+  0x3C, 0x07, 0x81, 0xB0, 0x37, 0x0C, 0x7F, 0x07, 0xC0, 0x00, 0x60, 0x0C,
+  0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFC, 0x30, 0xE6, 0x06,
+  0x60, 0x6C, 0x06, 0xC0, 0x6C, 0x0C, 0xC0, 0xCE, 0x18, 0x7F, 0x03, 0xE0,
+  0x01, 0x80, 0x78, 0x19, 0x06, 0x30, 0x00, 0x00, 0x03, 0xE0, 0xFE, 0x30,
+  0xEC, 0x0D, 0x81, 0xE0, 0x3C, 0x07, 0x81, 0xB0, 0x37, 0x0C, 0x7F, 0x07,
+  0xC0, 0x07, 0x30, 0x5A, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xC3,
+  0x0E, 0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xCC, 0x0C, 0xE1, 0x87,
+  0xF0, 0x3E, 0x00, 0x0E, 0x70, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x1F, 0xC3, 0x0E, 0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xCC, 0x0C,
+  0xE1, 0x87, 0xF0, 0x3E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3E, 0xC7, 0xFC, 0x30, 0xC3, 0x0F,
+  0x38, 0xD9, 0x8C, 0xCC, 0xC6, 0x6C, 0x73, 0xC3, 0x0C, 0x30, 0xFF, 0x8D,
+  0xF0, 0x40, 0x00, 0x0C, 0x00, 0x60, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x30, 0x33, 0x03, 0x60, 0x36, 0x06, 0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06,
+  0xC0, 0xEE, 0x1C, 0xFE, 0xC7, 0xCC, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x00, 0x00, 0x00, 0x30, 0x33, 0x03, 0x60, 0x36, 0x06, 0x60, 0x66, 0x06,
+  0xC0, 0x6C, 0x06, 0xC0, 0xEE, 0x1C, 0xFE, 0xC7, 0xCC, 0x01, 0x80, 0x3C,
+  0x06, 0x40, 0xC6, 0x00, 0x00, 0x00, 0x30, 0x33, 0x03, 0x60, 0x36, 0x06,
+  0x60, 0x66, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0xEE, 0x1C, 0xFE, 0xC7, 0xCC,
+  0x0E, 0x70, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x30, 0x36, 0x03,
+  0x60, 0x66, 0x06, 0x60, 0x6C, 0x06, 0xC0, 0x6C, 0x0E, 0xE1, 0xCF, 0xEC,
+  0x7C, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x81, 0xC6, 0x06, 0x18, 0x38, 0x60, 0xC0, 0xC6, 0x03, 0x38, 0x0C,
+  0xC0, 0x37, 0x00, 0xF8, 0x01, 0xC0, 0x07, 0x00, 0x18, 0x00, 0xE0, 0x03,
+  0x00, 0x1C, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x0C, 0x00, 0x60, 0x03, 0x00,
+  0x30, 0x01, 0x80, 0x0C, 0xF0, 0x7F, 0xC3, 0x87, 0x38, 0x19, 0xC0, 0xCC,
+  0x06, 0x60, 0x33, 0x03, 0x18, 0x19, 0xE3, 0x8D, 0xF8, 0x67, 0x83, 0x00,
+  0x18, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x00, 0x03, 0x9C, 0x0E, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x71, 0x81, 0x86, 0x0E, 0x18, 0x30, 0x31,
+  0x80, 0xCE, 0x03, 0x30, 0x0D, 0xC0, 0x3E, 0x00, 0x70, 0x01, 0xC0, 0x06,
+  0x00, 0x38, 0x00, 0xC0, 0x07, 0x00, 0xF8, 0x03, 0xC0, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique11pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
+  {     1,   5,  16,   9,    2,  -15 },   // 0x21 '!'
+  {    11,   6,   6,  10,    2,  -15 },   // 0x22 '"'
+  {    16,  15,  15,  18,    2,  -14 },   // 0x23 '#'
+  {    45,  12,  20,  14,    0,  -16 },   // 0x24 '$'
+  {    75,  17,  16,  21,    2,  -15 },   // 0x25 '%'
+  {   109,  15,  16,  17,    1,  -15 },   // 0x26 '&'
+  {   139,   2,   6,   6,    2,  -15 },   // 0x27 '''
+  {   141,   8,  20,   9,    2,  -16 },   // 0x28 '('
+  {   161,   8,  20,   9,   -2,  -16 },   // 0x29 ')'
+  {   181,   9,  10,  11,    1,  -15 },   // 0x2A '*'
+  {   193,  14,  14,  18,    2,  -13 },   // 0x2B '+'
+  {   218,   3,   5,   7,    1,   -2 },   // 0x2C ','
+  {   220,   6,   3,   8,    1,   -6 },   // 0x2D '-'
+  {   223,   2,   3,   7,    1,   -2 },   // 0x2E '.'
+  {   224,  11,  18,   7,   -2,  -15 },   // 0x2F '/'
+  {   249,  12,  16,  14,    1,  -15 },   // 0x30 '0'
+  {   273,   9,  16,  14,    1,  -15 },   // 0x31 '1'
+  {   291,  13,  16,  14,    0,  -15 },   // 0x32 '2'
+  {   317,  13,  16,  14,    0,  -15 },   // 0x33 '3'
+  {   343,  12,  16,  14,    0,  -15 },   // 0x34 '4'
+  {   367,  12,  16,  14,    0,  -15 },   // 0x35 '5'
+  {   391,  12,  16,  14,    1,  -15 },   // 0x36 '6'
+  {   415,  12,  16,  14,    2,  -15 },   // 0x37 '7'
+  {   439,  12,  16,  14,    1,  -15 },   // 0x38 '8'
+  {   463,  11,  16,  14,    2,  -15 },   // 0x39 '9'
+  {   485,   4,  11,   7,    1,  -10 },   // 0x3A ':'
+  {   491,   5,  13,   7,    1,  -10 },   // 0x3B ';'
+  {   500,  14,  12,  18,    2,  -12 },   // 0x3C '<'
+  {   521,  14,   7,  18,    2,  -10 },   // 0x3D '='
+  {   534,  14,  12,  18,    2,  -12 },   // 0x3E '>'
+  {   555,   9,  16,  12,    3,  -15 },   // 0x3F '?'
+  {   573,  20,  19,  22,    1,  -14 },   // 0x40 '@'
+  {   621,  15,  16,  15,   -1,  -15 },   // 0x41 'A'
+  {   651,  13,  16,  15,    1,  -15 },   // 0x42 'B'
+  {   677,  14,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   705,  15,  16,  17,    1,  -15 },   // 0x44 'D'
+  {   735,  13,  16,  14,    1,  -15 },   // 0x45 'E'
+  {   761,  12,  16,  13,    1,  -15 },   // 0x46 'F'
+  {   785,  15,  16,  17,    1,  -15 },   // 0x47 'G'
+  {   815,  15,  16,  17,    1,  -15 },   // 0x48 'H'
+  {   845,   5,  16,   6,    1,  -15 },   // 0x49 'I'
+  {   855,   9,  20,   6,   -4,  -15 },   // 0x4A 'J'
+  {   878,  15,  16,  14,    1,  -15 },   // 0x4B 'K'
+  {   908,  10,  16,  12,    1,  -15 },   // 0x4C 'L'
+  {   928,  18,  16,  19,    1,  -15 },   // 0x4D 'M'
+  {   964,  15,  16,  16,    1,  -15 },   // 0x4E 'N'
+  {   994,  16,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {  1026,  13,  16,  13,    1,  -15 },   // 0x50 'P'
+  {  1052,  16,  19,  17,    1,  -15 },   // 0x51 'Q'
+  {  1090,  13,  16,  15,    1,  -15 },   // 0x52 'R'
+  {  1116,  13,  16,  14,    0,  -15 },   // 0x53 'S'
+  {  1142,  14,  16,  13,    1,  -15 },   // 0x54 'T'
+  {  1170,  14,  16,  16,    1,  -15 },   // 0x55 'U'
+  {  1198,  15,  16,  15,    2,  -15 },   // 0x56 'V'
+  {  1228,  20,  16,  22,    2,  -15 },   // 0x57 'W'
+  {  1268,  16,  16,  15,   -1,  -15 },   // 0x58 'X'
+  {  1300,  13,  16,  13,    1,  -15 },   // 0x59 'Y'
+  {  1326,  16,  16,  15,    0,  -15 },   // 0x5A 'Z'
+  {  1358,   9,  20,   9,    1,  -16 },   // 0x5B '['
+  {  1381,   4,  18,   7,    2,  -15 },   // 0x5C '\'
+  {  1390,   9,  20,   9,   -1,  -16 },   // 0x5D ']'
+  {  1413,  14,   6,  18,    2,  -15 },   // 0x5E '^'
+  {  1424,  11,   2,  11,    0,    4 },   // 0x5F '_'
+  {  1427,   4,   4,  11,    4,  -17 },   // 0x60 '`'
+  {  1429,  11,  12,  13,    1,  -11 },   // 0x61 'a'
+  {  1446,  12,  17,  14,    1,  -16 },   // 0x62 'b'
+  {  1472,  11,  12,  12,    1,  -11 },   // 0x63 'c'
+  {  1489,  13,  17,  14,    1,  -16 },   // 0x64 'd'
+  {  1517,  11,  12,  13,    1,  -11 },   // 0x65 'e'
+  {  1534,   9,  17,   8,    2,  -16 },   // 0x66 'f'
+  {  1554,  12,  17,  14,    1,  -11 },   // 0x67 'g'
+  {  1580,  12,  17,  14,    1,  -16 },   // 0x68 'h'
+  {  1606,   5,  17,   6,    1,  -16 },   // 0x69 'i'
+  {  1617,   8,  22,   6,   -2,  -16 },   // 0x6A 'j'
+  {  1639,  13,  17,  13,    1,  -16 },   // 0x6B 'k'
+  {  1667,   5,  17,   6,    1,  -16 },   // 0x6C 'l'
+  {  1678,  19,  12,  22,    1,  -11 },   // 0x6D 'm'
+  {  1707,  12,  12,  14,    1,  -11 },   // 0x6E 'n'
+  {  1725,  11,  12,  13,    1,  -11 },   // 0x6F 'o'
+  {  1742,  13,  17,  14,    0,  -11 },   // 0x70 'p'
+  {  1770,  12,  17,  14,    1,  -11 },   // 0x71 'q'
+  {  1796,   9,  12,   9,    1,  -11 },   // 0x72 'r'
+  {  1810,  11,  12,  11,    0,  -11 },   // 0x73 's'
+  {  1827,   8,  15,   9,    2,  -14 },   // 0x74 't'
+  {  1842,  12,  12,  14,    1,  -11 },   // 0x75 'u'
+  {  1860,  12,  12,  13,    2,  -11 },   // 0x76 'v'
+  {  1878,  16,  12,  18,    2,  -11 },   // 0x77 'w'
+  {  1902,  14,  12,  13,   -1,  -11 },   // 0x78 'x'
+  {  1923,  14,  17,  13,   -1,  -11 },   // 0x79 'y'
+  {  1953,  12,  12,  12,    0,  -11 },   // 0x7A 'z'
+  {  1971,  10,  20,  14,    3,  -16 },   // 0x7B '{'
+  {  1996,   2,  22,   7,    3,  -16 },   // 0x7C '|'
+  {  2002,  11,  20,  14,    0,  -16 },   // 0x7D '}'
+  {  2030,  14,   4,  18,    2,   -8 },   // 0x7E '~'
+  {  2037,  11,  19,  13,    1,  -15 },   // 0x7F
+  {  2064,  11,  19,  13,    1,  -15 },   // 0x80
+  {  2091,  11,  19,  13,    1,  -15 },   // 0x81
+  {  2118,  11,  19,  13,    1,  -15 },   // 0x82
+  {  2145,  11,  19,  13,    1,  -15 },   // 0x83
+  {  2172,  11,  19,  13,    1,  -15 },   // 0x84
+  {  2199,  11,  19,  13,    1,  -15 },   // 0x85
+  {  2226,  11,  19,  13,    1,  -15 },   // 0x86
+  {  2253,  11,  19,  13,    1,  -15 },   // 0x87
+  {  2280,  11,  19,  13,    1,  -15 },   // 0x88
+  {  2307,  11,  19,  13,    1,  -15 },   // 0x89
+  {  2334,  11,  19,  13,    1,  -15 },   // 0x8A
+  {  2361,  11,  19,  13,    1,  -15 },   // 0x8B
+  {  2388,  11,  19,  13,    1,  -15 },   // 0x8C
+  {  2415,  11,  19,  13,    1,  -15 },   // 0x8D
+  {  2442,  11,  19,  13,    1,  -15 },   // 0x8E
+  {  2469,  11,  19,  13,    1,  -15 },   // 0x8F
+  {  2496,  11,  19,  13,    1,  -15 },   // 0x90
+  {  2523,  11,  19,  13,    1,  -15 },   // 0x91
+  {  2550,  11,  19,  13,    1,  -15 },   // 0x92
+  {  2577,  11,  19,  13,    1,  -15 },   // 0x93
+  {  2604,  11,  19,  13,    1,  -15 },   // 0x94
+  {  2631,  11,  19,  13,    1,  -15 },   // 0x95
+  {  2658,  11,  19,  13,    1,  -15 },   // 0x96
+  {  2685,  11,  19,  13,    1,  -15 },   // 0x97
+  {  2712,  11,  19,  13,    1,  -15 },   // 0x98
+  {  2739,  11,  19,  13,    1,  -15 },   // 0x99
+  {  2766,  11,  19,  13,    1,  -15 },   // 0x9A
+  {  2793,  11,  19,  13,    1,  -15 },   // 0x9B
+  {  2820,  11,  19,  13,    1,  -15 },   // 0x9C
+  {  2847,  11,  19,  13,    1,  -15 },   // 0x9D
+  {  2874,  11,  19,  13,    1,  -15 },   // 0x9E
+  {  2901,  11,  19,  13,    1,  -15 },   // 0x9F
+  {  2928,   1,   1,   7,    0,    0 },   // 0xA0
+  {  2929,   5,  16,   9,    2,  -11 },   // 0xA1
+  {  2939,  11,  18,  14,    2,  -14 },   // 0xA2
+  {  2964,  13,  16,  14,    1,  -15 },   // 0xA3
+  {  2990,  11,  11,  14,    1,  -11 },   // 0xA4
+  {  3006,  14,  16,  14,    1,  -15 },   // 0xA5
+  {  3034,   2,  19,   7,    3,  -14 },   // 0xA6
+  {  3039,  11,  18,  11,    0,  -15 },   // 0xA7
+  {  3064,   8,   2,  11,    4,  -16 },   // 0xA8
+  {  3066,  16,  16,  22,    3,  -15 },   // 0xA9
+  {  3098,   9,  11,  10,    1,  -15 },   // 0xAA
+  {  3111,  11,  10,  14,    1,  -10 },   // 0xAB
+  {  3125,  14,   6,  18,    2,   -8 },   // 0xAC
+  {  3136,   6,   3,   8,    1,   -6 },   // 0xAD
+  {  3139,  16,  16,  22,    3,  -15 },   // 0xAE
+  {  3171,   7,   2,  11,    4,  -15 },   // 0xAF
+  {  3173,   7,   7,  11,    2,  -15 },   // 0xB0
+  {  3180,  14,  14,  18,    2,  -13 },   // 0xB1
+  {  3205,   9,   9,   9,    1,  -15 },   // 0xB2
+  {  3216,   8,   9,   9,    0,  -15 },   // 0xB3
+  {  3225,   6,   4,  11,    6,  -17 },   // 0xB4
+  {  3228,  13,  17,  14,    0,  -11 },   // 0xB5
+  {  3256,  11,  18,  14,    2,  -15 },   // 0xB6
+  {  3281,   2,   3,   7,    3,   -8 },   // 0xB7
+  {  3282,   5,   4,  11,    1,    1 },   // 0xB8
+  {  3285,   8,   9,   9,    1,  -15 },   // 0xB9
+  {  3294,  10,  11,  10,    1,  -15 },   // 0xBA
+  {  3308,  11,  10,  14,    1,  -10 },   // 0xBB
+  {  3322,  20,  16,  21,    1,  -15 },   // 0xBC
+  {  3362,  22,  16,  21,    1,  -15 },   // 0xBD
+  {  3406,  21,  16,  21,    0,  -15 },   // 0xBE
+  {  3448,   9,  17,  12,    1,  -11 },   // 0xBF
+  {  3468,  15,  21,  15,   -1,  -20 },   // 0xC0
+  {  3508,  15,  21,  15,   -1,  -20 },   // 0xC1
+  {  3548,  15,  21,  15,   -1,  -20 },   // 0xC2
+  {  3588,  15,  20,  15,   -1,  -19 },   // 0xC3
+  {  3626,  15,  20,  15,   -1,  -19 },   // 0xC4
+  {  3664,  15,  20,  15,   -1,  -19 },   // 0xC5
+  {  3702,  23,  16,  21,   -1,  -15 },   // 0xC6
+  {  3748,  14,  20,  15,    1,  -15 },   // 0xC7
+  {  3783,  13,  21,  14,    1,  -20 },   // 0xC8
+  {  3818,  13,  21,  14,    1,  -20 },   // 0xC9
+  {  3853,  13,  21,  14,    1,  -20 },   // 0xCA
+  {  3888,  13,  20,  14,    1,  -19 },   // 0xCB
+  {  3921,   6,  21,   6,    1,  -20 },   // 0xCC
+  {  3937,   8,  21,   6,    1,  -20 },   // 0xCD
+  {  3958,   8,  21,   6,    1,  -20 },   // 0xCE
+  {  3979,   9,  20,   6,    1,  -19 },   // 0xCF
+  {  4002,  16,  16,  17,    0,  -15 },   // 0xD0
+  {  4034,  15,  20,  16,    1,  -19 },   // 0xD1
+  {  4072,  16,  21,  17,    1,  -20 },   // 0xD2
+  {  4114,  16,  21,  17,    1,  -20 },   // 0xD3
+  {  4156,  16,  21,  17,    1,  -20 },   // 0xD4
+  {  4198,  16,  20,  17,    1,  -19 },   // 0xD5
+  {  4238,  16,  20,  17,    1,  -19 },   // 0xD6
+  {  4278,  12,  12,  18,    3,  -12 },   // 0xD7
+  {  4296,  19,  16,  17,   -1,  -15 },   // 0xD8
+  {  4334,  14,  21,  16,    1,  -20 },   // 0xD9
+  {  4371,  14,  21,  16,    1,  -20 },   // 0xDA
+  {  4408,  14,  21,  16,    1,  -20 },   // 0xDB
+  {  4445,  14,  20,  16,    1,  -19 },   // 0xDC
+  {  4480,  13,  21,  13,    1,  -20 },   // 0xDD
+  {  4515,  12,  16,  13,    1,  -15 },   // 0xDE
+  {  4539,  12,  17,  14,    1,  -16 },   // 0xDF
+  {  4565,  11,  18,  13,    1,  -17 },   // 0xE0
+  {  4590,  12,  18,  13,    1,  -17 },   // 0xE1
+  {  4617,  11,  18,  13,    1,  -17 },   // 0xE2
+  {  4642,  12,  17,  13,    1,  -16 },   // 0xE3
+  {  4668,  12,  17,  13,    1,  -16 },   // 0xE4
+  {  4694,  11,  19,  13,    1,  -18 },   // 0xE5
+  {  4721,  20,  12,  22,    1,  -11 },   // 0xE6
+  {  4751,  11,  16,  12,    1,  -11 },   // 0xE7
+  {  4773,  11,  18,  13,    1,  -17 },   // 0xE8
+  {  4798,  12,  18,  13,    1,  -17 },   // 0xE9
+  {  4825,  11,  18,  13,    1,  -17 },   // 0xEA
+  {  4850,  12,  17,  13,    1,  -16 },   // 0xEB
+  {  4876,   4,  18,   6,    1,  -17 },   // 0xEC
+  {  4885,   8,  18,   6,    1,  -17 },   // 0xED
+  {  4903,   7,  18,   6,    1,  -17 },   // 0xEE
+  {  4919,   8,  17,   6,    1,  -16 },   // 0xEF
+  {  4936,  12,  17,  13,    1,  -16 },   // 0xF0
+  {  4962,  12,  17,  14,    1,  -16 },   // 0xF1
+  {  4988,  11,  18,  13,    1,  -17 },   // 0xF2
+  {  5013,  12,  18,  13,    1,  -17 },   // 0xF3
+  {  5040,  11,  18,  13,    1,  -17 },   // 0xF4
+  {  5065,  12,  17,  13,    1,  -16 },   // 0xF5
+  {  5091,  12,  17,  13,    1,  -16 },   // 0xF6
+  {  5117,  15,  12,  18,    2,  -12 },   // 0xF7
+  {  5140,  13,  14,  13,    0,  -12 },   // 0xF8
+  {  5163,  12,  18,  14,    1,  -17 },   // 0xF9
+  {  5190,  12,  18,  14,    1,  -17 },   // 0xFA
+  {  5217,  12,  18,  14,    1,  -17 },   // 0xFB
+  {  5244,  12,  17,  14,    1,  -16 },   // 0xFC
+  {  5270,  14,  23,  13,   -1,  -17 },   // 0xFD
+  {  5311,  13,  22,  14,    0,  -16 },   // 0xFE
+  {  5347,  14,  22,  13,   -1,  -16 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique11pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique11pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique11pt8bGlyphs,
+  0x20, 0xFF, 25 };
+
+// Approx. 6961 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique11pt8bMetrics[] PROGMEM = {
+  {   0,   7,   1 },   // 0x20
+  {   2,   9,   7 },   // 0x21
+  {   2,  10,   8 },   // 0x22
+  {   2,  18,  17 },   // 0x23
+  {   0,  14,  12 },   // 0x24
+  {   2,  21,  19 },   // 0x25
+  {   1,  17,  16 },   // 0x26
+  {   2,   6,   4 },   // 0x27
+  {   2,   9,  10 },   // 0x28
+  {  -2,   9,   6 },   // 0x29
+  {   1,  11,  10 },   // 0x2A
+  {   2,  18,  16 },   // 0x2B
+  {   1,   7,   4 },   // 0x2C
+  {   1,   8,   7 },   // 0x2D
+  {   1,   7,   3 },   // 0x2E
+  {  -2,   7,   9 },   // 0x2F
+  {   1,  14,  13 },   // 0x30
+  {   1,  14,  10 },   // 0x31
+  {   0,  14,  13 },   // 0x32
+  {   0,  14,  13 },   // 0x33
+  {   0,  14,  12 },   // 0x34
+  {   0,  14,  12 },   // 0x35
+  {   1,  14,  13 },   // 0x36
+  {   2,  14,  14 },   // 0x37
+  {   1,  14,  13 },   // 0x38
+  {   2,  14,  13 },   // 0x39
+  {   1,   7,   5 },   // 0x3A
+  {   1,   7,   6 },   // 0x3B
+  {   2,  18,  16 },   // 0x3C
+  {   2,  18,  16 },   // 0x3D
+  {   2,  18,  16 },   // 0x3E
+  {   3,  12,  12 },   // 0x3F
+  {   1,  22,  21 },   // 0x40
+  {  -1,  15,  14 },   // 0x41
+  {   1,  15,  14 },   // 0x42
+  {   1,  15,  15 },   // 0x43
+  {   1,  17,  16 },   // 0x44
+  {   1,  14,  14 },   // 0x45
+  {   1,  13,  13 },   // 0x46
+  {   1,  17,  16 },   // 0x47
+  {   1,  17,  16 },   // 0x48
+  {   1,   6,   6 },   // 0x49
+  {  -4,   6,   5 },   // 0x4A
+  {   1,  14,  16 },   // 0x4B
+  {   1,  12,  11 },   // 0x4C
+  {   1,  19,  19 },   // 0x4D
+  {   1,  16,  16 },   // 0x4E
+  {   1,  17,  17 },   // 0x4F
+  {   1,  13,  14 },   // 0x50
+  {   1,  17,  17 },   // 0x51
+  {   1,  15,  14 },   // 0x52
+  {   0,  14,  13 },   // 0x53
+  {   1,  13,  15 },   // 0x54
+  {   1,  16,  15 },   // 0x55
+  {   2,  15,  17 },   // 0x56
+  {   2,  22,  22 },   // 0x57
+  {  -1,  15,  15 },   // 0x58
+  {   1,  13,  14 },   // 0x59
+  {   0,  15,  16 },   // 0x5A
+  {   1,   9,  10 },   // 0x5B
+  {   2,   7,   6 },   // 0x5C
+  {  -1,   9,   8 },   // 0x5D
+  {   2,  18,  16 },   // 0x5E
+  {   0,  11,  11 },   // 0x5F
+  {   4,  11,   8 },   // 0x60
+  {   1,  13,  12 },   // 0x61
+  {   1,  14,  13 },   // 0x62
+  {   1,  12,  12 },   // 0x63
+  {   1,  14,  14 },   // 0x64
+  {   1,  13,  12 },   // 0x65
+  {   2,   8,  11 },   // 0x66
+  {   1,  14,  13 },   // 0x67
+  {   1,  14,  13 },   // 0x68
+  {   1,   6,   6 },   // 0x69
+  {  -2,   6,   6 },   // 0x6A
+  {   1,  13,  14 },   // 0x6B
+  {   1,   6,   6 },   // 0x6C
+  {   1,  22,  20 },   // 0x6D
+  {   1,  14,  13 },   // 0x6E
+  {   1,  13,  12 },   // 0x6F
+  {   0,  14,  13 },   // 0x70
+  {   1,  14,  13 },   // 0x71
+  {   1,   9,  10 },   // 0x72
+  {   0,  11,  11 },   // 0x73
+  {   2,   9,  10 },   // 0x74
+  {   1,  14,  13 },   // 0x75
+  {   2,  13,  14 },   // 0x76
+  {   2,  18,  18 },   // 0x77
+  {  -1,  13,  13 },   // 0x78
+  {  -1,  13,  13 },   // 0x79
+  {   0,  12,  12 },   // 0x7A
+  {   3,  14,  13 },   // 0x7B
+  {   3,   7,   5 },   // 0x7C
+  {   0,  14,  11 },   // 0x7D
+  {   2,  18,  16 },   // 0x7E
+  {   1,  13,  12 },   // 0x7F
+  {   1,  13,  12 },   // 0x80
+  {   1,  13,  12 },   // 0x81
+  {   1,  13,  12 },   // 0x82
+  {   1,  13,  12 },   // 0x83
+  {   1,  13,  12 },   // 0x84
+  {   1,  13,  12 },   // 0x85
+  {   1,  13,  12 },   // 0x86
+  {   1,  13,  12 },   // 0x87
+  {   1,  13,  12 },   // 0x88
+  {   1,  13,  12 },   // 0x89
+  {   1,  13,  12 },   // 0x8A
+  {   1,  13,  12 },   // 0x8B
+  {   1,  13,  12 },   // 0x8C
+  {   1,  13,  12 },   // 0x8D
+  {   1,  13,  12 },   // 0x8E
+  {   1,  13,  12 },   // 0x8F
+  {   1,  13,  12 },   // 0x90
+  {   1,  13,  12 },   // 0x91
+  {   1,  13,  12 },   // 0x92
+  {   1,  13,  12 },   // 0x93
+  {   1,  13,  12 },   // 0x94
+  {   1,  13,  12 },   // 0x95
+  {   1,  13,  12 },   // 0x96
+  {   1,  13,  12 },   // 0x97
+  {   1,  13,  12 },   // 0x98
+  {   1,  13,  12 },   // 0x99
+  {   1,  13,  12 },   // 0x9A
+  {   1,  13,  12 },   // 0x9B
+  {   1,  13,  12 },   // 0x9C
+  {   1,  13,  12 },   // 0x9D
+  {   1,  13,  12 },   // 0x9E
+  {   1,  13,  12 },   // 0x9F
+  {   0,   7,   1 },   // 0xA0
+  {   2,   9,   7 },   // 0xA1
+  {   2,  14,  13 },   // 0xA2
+  {   1,  14,  14 },   // 0xA3
+  {   1,  14,  12 },   // 0xA4
+  {   1,  14,  15 },   // 0xA5
+  {   3,   7,   5 },   // 0xA6
+  {   0,  11,  11 },   // 0xA7
+  {   4,  11,  12 },   // 0xA8
+  {   3,  22,  19 },   // 0xA9
+  {   1,  10,  10 },   // 0xAA
+  {   1,  14,  12 },   // 0xAB
+  {   2,  18,  16 },   // 0xAC
+  {   1,   8,   7 },   // 0xAD
+  {   3,  22,  19 },   // 0xAE
+  {   4,  11,  11 },   // 0xAF
+  {   2,  11,   9 },   // 0xB0
+  {   2,  18,  16 },   // 0xB1
+  {   1,   9,  10 },   // 0xB2
+  {   0,   9,   8 },   // 0xB3
+  {   6,  11,  12 },   // 0xB4
+  {   0,  14,  13 },   // 0xB5
+  {   2,  14,  13 },   // 0xB6
+  {   3,   7,   5 },   // 0xB7
+  {   1,  11,   6 },   // 0xB8
+  {   1,   9,   9 },   // 0xB9
+  {   1,  10,  11 },   // 0xBA
+  {   1,  14,  12 },   // 0xBB
+  {   1,  21,  21 },   // 0xBC
+  {   1,  21,  23 },   // 0xBD
+  {   0,  21,  21 },   // 0xBE
+  {   1,  12,  10 },   // 0xBF
+  {  -1,  15,  14 },   // 0xC0
+  {  -1,  15,  14 },   // 0xC1
+  {  -1,  15,  14 },   // 0xC2
+  {  -1,  15,  14 },   // 0xC3
+  {  -1,  15,  14 },   // 0xC4
+  {  -1,  15,  14 },   // 0xC5
+  {  -1,  21,  22 },   // 0xC6
+  {   1,  15,  15 },   // 0xC7
+  {   1,  14,  14 },   // 0xC8
+  {   1,  14,  14 },   // 0xC9
+  {   1,  14,  14 },   // 0xCA
+  {   1,  14,  14 },   // 0xCB
+  {   1,   6,   7 },   // 0xCC
+  {   1,   6,   9 },   // 0xCD
+  {   1,   6,   9 },   // 0xCE
+  {   1,   6,  10 },   // 0xCF
+  {   0,  17,  16 },   // 0xD0
+  {   1,  16,  16 },   // 0xD1
+  {   1,  17,  17 },   // 0xD2
+  {   1,  17,  17 },   // 0xD3
+  {   1,  17,  17 },   // 0xD4
+  {   1,  17,  17 },   // 0xD5
+  {   1,  17,  17 },   // 0xD6
+  {   3,  18,  15 },   // 0xD7
+  {  -1,  17,  18 },   // 0xD8
+  {   1,  16,  15 },   // 0xD9
+  {   1,  16,  15 },   // 0xDA
+  {   1,  16,  15 },   // 0xDB
+  {   1,  16,  15 },   // 0xDC
+  {   1,  13,  14 },   // 0xDD
+  {   1,  13,  13 },   // 0xDE
+  {   1,  14,  13 },   // 0xDF
+  {   1,  13,  12 },   // 0xE0
+  {   1,  13,  13 },   // 0xE1
+  {   1,  13,  12 },   // 0xE2
+  {   1,  13,  13 },   // 0xE3
+  {   1,  13,  13 },   // 0xE4
+  {   1,  13,  12 },   // 0xE5
+  {   1,  22,  21 },   // 0xE6
+  {   1,  12,  12 },   // 0xE7
+  {   1,  13,  12 },   // 0xE8
+  {   1,  13,  13 },   // 0xE9
+  {   1,  13,  12 },   // 0xEA
+  {   1,  13,  13 },   // 0xEB
+  {   1,   6,   5 },   // 0xEC
+  {   1,   6,   9 },   // 0xED
+  {   1,   6,   8 },   // 0xEE
+  {   1,   6,   9 },   // 0xEF
+  {   1,  13,  13 },   // 0xF0
+  {   1,  14,  13 },   // 0xF1
+  {   1,  13,  12 },   // 0xF2
+  {   1,  13,  13 },   // 0xF3
+  {   1,  13,  12 },   // 0xF4
+  {   1,  13,  13 },   // 0xF5
+  {   1,  13,  13 },   // 0xF6
+  {   2,  18,  17 },   // 0xF7
+  {   0,  13,  13 },   // 0xF8
+  {   1,  14,  13 },   // 0xF9
+  {   1,  14,  13 },   // 0xFA
+  {   1,  14,  13 },   // 0xFB
+  {   1,  14,  13 },   // 0xFC
+  {  -1,  13,  13 },   // 0xFD
+  {   0,  14,  13 },   // 0xFE
+  {  -1,  13,  13 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique11pt8bWidths = { DejaVuSans_Oblique11pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE11PTLAT1__H
@@ -0,0 +1,999 @@
+#ifndef DEJAVUSANSOBLIQUE12PTLAT1__H
+#define DEJAVUSANSOBLIQUE12PTLAT1__H
+const uint8_t DejaVuSans_Oblique12pt8bBitmaps[] PROGMEM = {
+  0x00, 0x0C, 0x30, 0xC3, 0x18, 0x61, 0x86, 0x18, 0x61, 0x0C, 0x00, 0x00,
+  0x30, 0xC3, 0x00, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xC0, 0x01, 0x8C, 0x00,
+  0xC6, 0x00, 0xC3, 0x00, 0x63, 0x00, 0x31, 0x81, 0xFF, 0xFD, 0xFF, 0xFE,
+  0x0C, 0x20, 0x06, 0x30, 0x03, 0x18, 0x03, 0x0C, 0x1F, 0xFF, 0xEF, 0xFF,
+  0xE0, 0x63, 0x00, 0x21, 0x80, 0x30, 0xC0, 0x18, 0xC0, 0x0C, 0x60, 0x00,
+  0x00, 0xC0, 0x04, 0x00, 0x20, 0x07, 0xE0, 0xFF, 0x8E, 0xCC, 0xC4, 0x06,
+  0x20, 0x31, 0x01, 0xC8, 0x07, 0xE0, 0x1F, 0xC0, 0x2F, 0x01, 0x18, 0x08,
+  0xC0, 0xC6, 0xC4, 0x67, 0xFE, 0x1F, 0xE0, 0x08, 0x00, 0xC0, 0x04, 0x00,
+  0x20, 0x00, 0x1C, 0x01, 0x99, 0x80, 0xC6, 0x30, 0x63, 0x0C, 0x10, 0xC3,
+  0x0C, 0x30, 0xC6, 0x0C, 0x33, 0x03, 0x19, 0x80, 0x66, 0x47, 0x0E, 0x36,
+  0x60, 0x19, 0x8C, 0x0C, 0xC3, 0x02, 0x30, 0xC1, 0x8C, 0x30, 0xC3, 0x0C,
+  0x60, 0xC6, 0x30, 0x19, 0x88, 0x03, 0x80, 0x01, 0xF0, 0x01, 0xFC, 0x01,
+  0x82, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x38, 0x00, 0x0C, 0x00,
+  0x1B, 0x00, 0x19, 0xC0, 0xD8, 0x70, 0xD8, 0x1C, 0x6C, 0x07, 0x66, 0x01,
+  0xF3, 0x00, 0x71, 0xE0, 0xF8, 0x7F, 0xEE, 0x0F, 0xC3, 0x80, 0xFF, 0xFC,
+  0x03, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0xE0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x30, 0x0C, 0x06, 0x06,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x18, 0x38, 0x30, 0x60, 0xC0, 0x04, 0x00, 0x83, 0x11, 0xBA, 0xE1,
+  0xF0, 0x3E, 0x1D, 0x76, 0x23, 0x04, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x6D, 0xED, 0x00, 0xFF, 0xFF, 0xF8, 0xFC, 0x00,
+  0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x03,
+  0x00, 0x60, 0x06, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0x18, 0x03, 0x00, 0x30,
+  0x06, 0x00, 0x60, 0x0C, 0x00, 0x03, 0xC0, 0x7F, 0x87, 0x0C, 0x70, 0x33,
+  0x01, 0xB8, 0x0D, 0x80, 0x6C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0D, 0x80,
+  0x6C, 0x07, 0x60, 0x33, 0x03, 0x8C, 0x38, 0x7F, 0x80, 0xF0, 0x00, 0x07,
+  0x87, 0xE3, 0x98, 0x06, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0x07, 0xE0,
+  0x7F, 0xE1, 0x81, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x01, 0xC0, 0x0E,
+  0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0F, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xFF, 0xF3, 0xFF, 0xC0, 0x03, 0xF0, 0x3F, 0xE0, 0x81, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x0E, 0x07, 0xF0, 0x1F, 0xC0,
+  0x03, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x03, 0x30, 0x3C, 0xFF, 0xE1,
+  0xFE, 0x00, 0x00, 0x38, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x33, 0x03, 0x18,
+  0x19, 0xC1, 0x8C, 0x18, 0x61, 0x83, 0x18, 0x18, 0xC1, 0x8F, 0xFF, 0xFF,
+  0xFC, 0x03, 0x00, 0x38, 0x01, 0x80, 0x0C, 0x00, 0x0F, 0xF8, 0x7F, 0xC3,
+  0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x7F, 0x03, 0xFC, 0x30, 0xE0, 0x01,
+  0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x30, 0x01, 0x98, 0x38, 0xFF, 0x83,
+  0xF0, 0x00, 0x03, 0xF0, 0x7F, 0xC7, 0x06, 0x30, 0x03, 0x00, 0x30, 0x01,
+  0x9E, 0x0F, 0xFC, 0xF8, 0x77, 0x01, 0xB8, 0x0D, 0x80, 0x6C, 0x03, 0x60,
+  0x33, 0x01, 0x8C, 0x38, 0x7F, 0x80, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x70, 0x03, 0x00, 0x38,
+  0x01, 0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x07,
+  0x00, 0x00, 0x07, 0xE0, 0x7F, 0x87, 0x0E, 0x70, 0x33, 0x01, 0x98, 0x0C,
+  0xC0, 0xC3, 0x0E, 0x0F, 0xE1, 0xFE, 0x1C, 0x18, 0xC0, 0x6C, 0x03, 0x60,
+  0x1B, 0x01, 0xDC, 0x1C, 0x7F, 0xC0, 0xF8, 0x00, 0x0F, 0x81, 0xFE, 0x38,
+  0x66, 0x03, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0x7E, 0x1F, 0x7F,
+  0xE3, 0xE6, 0x00, 0x60, 0x0C, 0x01, 0xC8, 0x38, 0xFF, 0x07, 0xC0, 0x33,
+  0x30, 0x00, 0x00, 0x0C, 0xCC, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x03, 0x18,
+  0xCC, 0x62, 0x00, 0x00, 0x02, 0x00, 0x3C, 0x03, 0xF0, 0x3F, 0x01, 0xF8,
+  0x1F, 0x80, 0x38, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xF0,
+  0x00, 0xF0, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x01, 0xE0, 0x01, 0xF8, 0x00,
+  0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0x80, 0x3F, 0x03, 0xF0, 0x1F,
+  0x81, 0xF8, 0x07, 0x80, 0x08, 0x00, 0x00, 0x1E, 0x3F, 0xB0, 0xF0, 0x30,
+  0x18, 0x18, 0x0C, 0x1C, 0x1C, 0x18, 0x0C, 0x0C, 0x06, 0x00, 0x00, 0x01,
+  0xC0, 0xC0, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x01, 0xE0, 0x78,
+  0x1C, 0x00, 0xE1, 0xC0, 0x03, 0x1C, 0x3D, 0x9D, 0xC7, 0xFC, 0x6C, 0x71,
+  0xE3, 0x63, 0x06, 0x1E, 0x30, 0x30, 0xF1, 0x81, 0x87, 0x8C, 0x0C, 0x6C,
+  0x60, 0xE7, 0x63, 0x8E, 0x73, 0x0F, 0xDF, 0x0C, 0x3D, 0xE0, 0x60, 0x00,
+  0x01, 0x80, 0x10, 0x0F, 0x03, 0x80, 0x1F, 0xF0, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xCC, 0x01, 0x8C,
+  0x03, 0x8C, 0x03, 0x0C, 0x07, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x06,
+  0x1F, 0xFE, 0x3F, 0xFE, 0x30, 0x06, 0x70, 0x03, 0x60, 0x03, 0xE0, 0x03,
+  0x0F, 0xF0, 0x3F, 0xE1, 0xC1, 0xC6, 0x03, 0x18, 0x0C, 0x60, 0x31, 0x81,
+  0x8C, 0x0E, 0x3F, 0xF0, 0xFF, 0xC3, 0x03, 0x9C, 0x06, 0x60, 0x19, 0x80,
+  0x66, 0x03, 0x98, 0x1C, 0xFF, 0xE3, 0xFF, 0x00, 0x01, 0xF8, 0x07, 0xFE,
+  0x0E, 0x07, 0x1C, 0x01, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+  0x60, 0x08, 0x70, 0x38, 0x3F, 0xF8, 0x0F, 0xE0, 0x0F, 0xF8, 0x07, 0xFF,
+  0x06, 0x03, 0xC3, 0x00, 0x61, 0x80, 0x38, 0xC0, 0x0C, 0x60, 0x06, 0x60,
+  0x03, 0x30, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x6E, 0x00, 0x66, 0x00, 0x33,
+  0x00, 0x31, 0x80, 0x38, 0xC0, 0x78, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x0F,
+  0xFC, 0x3F, 0xF1, 0xC0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x0C,
+  0x00, 0x3F, 0xF0, 0xFF, 0xC3, 0x00, 0x1C, 0x00, 0x60, 0x01, 0x80, 0x06,
+  0x00, 0x18, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x0F, 0xF8, 0x7F, 0xC7, 0x00,
+  0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x06, 0x00, 0x3F, 0xE1, 0xFF, 0x0C,
+  0x00, 0xE0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0xC0, 0x06, 0x00,
+  0x00, 0x01, 0xF8, 0x07, 0xFE, 0x0E, 0x07, 0x18, 0x02, 0x30, 0x00, 0x70,
+  0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x7E, 0xC0, 0x7E, 0xC0, 0x0E, 0xC0,
+  0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0x60, 0x0C, 0x70, 0x3C, 0x3F, 0xF8, 0x0F,
+  0xC0, 0x0C, 0x01, 0x86, 0x00, 0xC7, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x30,
+  0xC0, 0x18, 0x60, 0x1C, 0x60, 0x0C, 0x3F, 0xFE, 0x1F, 0xFF, 0x0C, 0x01,
+  0x8E, 0x01, 0x86, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x30, 0xC0, 0x38, 0xC0,
+  0x18, 0x60, 0x0C, 0x00, 0x0C, 0x31, 0xC6, 0x18, 0x61, 0x8C, 0x30, 0xC3,
+  0x1C, 0x61, 0x86, 0x18, 0xC3, 0x00, 0x00, 0xC0, 0x30, 0x1C, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0xC0,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0xE0, 0x30, 0x1C, 0x3E, 0x0E, 0x00, 0x0C,
+  0x07, 0x06, 0x07, 0x07, 0x07, 0x03, 0x07, 0x01, 0x87, 0x00, 0xCF, 0x00,
+  0x6E, 0x00, 0x6E, 0x00, 0x3E, 0x00, 0x1B, 0x00, 0x0C, 0xC0, 0x0E, 0x70,
+  0x06, 0x1C, 0x03, 0x06, 0x01, 0x81, 0x80, 0xC0, 0xE0, 0xC0, 0x38, 0x60,
+  0x0E, 0x00, 0x0C, 0x01, 0x80, 0x70, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x38, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0xFF, 0xFF, 0xFC, 0x0E, 0x01, 0xE1, 0xE0, 0x3C, 0x7C, 0x0F, 0x0D, 0x81,
+  0xE1, 0xB0, 0x6C, 0x36, 0x1D, 0x86, 0xC3, 0x71, 0x98, 0xEC, 0x31, 0x99,
+  0x86, 0x37, 0x30, 0xC6, 0xC6, 0x38, 0xF1, 0x86, 0x1E, 0x30, 0xC3, 0x86,
+  0x18, 0x70, 0xC3, 0x00, 0x38, 0xC0, 0x06, 0x18, 0x00, 0xC0, 0x0E, 0x01,
+  0x87, 0x00, 0xC6, 0xC0, 0xC3, 0x60, 0x61, 0xB0, 0x30, 0xDC, 0x18, 0x66,
+  0x1C, 0x63, 0x0C, 0x31, 0x86, 0x18, 0x63, 0x0C, 0x31, 0x8E, 0x19, 0x86,
+  0x0E, 0xC3, 0x03, 0x61, 0x81, 0xB0, 0xC0, 0xD8, 0xC0, 0x38, 0x60, 0x1C,
+  0x00, 0x01, 0xF8, 0x03, 0xFF, 0x03, 0x81, 0xC3, 0x80, 0x63, 0x00, 0x3B,
+  0x80, 0x0D, 0x80, 0x06, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
+  0xD8, 0x00, 0x6C, 0x00, 0x76, 0x00, 0x71, 0x80, 0x70, 0xE0, 0x70, 0x3F,
+  0xF0, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xE1, 0x81, 0xC6, 0x03, 0x18,
+  0x0C, 0x60, 0x31, 0x81, 0xCC, 0x0E, 0x3F, 0xF0, 0xFF, 0x03, 0x00, 0x1C,
+  0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x00,
+  0x01, 0xF8, 0x03, 0xFF, 0x03, 0x81, 0xC3, 0x80, 0x63, 0x00, 0x3B, 0x80,
+  0x0D, 0x80, 0x06, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xD8,
+  0x00, 0x6C, 0x00, 0x76, 0x00, 0x71, 0x80, 0x70, 0xE0, 0x70, 0x3F, 0xF0,
+  0x07, 0xE0, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x0F, 0xF0, 0x3F,
+  0xE1, 0x81, 0xC6, 0x03, 0x18, 0x0C, 0x60, 0x31, 0x81, 0xCC, 0x0E, 0x3F,
+  0xF0, 0xFF, 0x83, 0x07, 0x1C, 0x0C, 0x60, 0x39, 0x80, 0x66, 0x01, 0x98,
+  0x06, 0xC0, 0x1F, 0x00, 0x30, 0x03, 0xF8, 0x3F, 0xF1, 0xC0, 0xC6, 0x00,
+  0x30, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x07,
+  0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x03, 0x90, 0x1C, 0x7F, 0xE0, 0xFE,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x06, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x60,
+  0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30,
+  0x06, 0x60, 0x0C, 0xC0, 0x1B, 0x00, 0x36, 0x00, 0xCC, 0x01, 0x98, 0x03,
+  0x30, 0x06, 0x60, 0x0D, 0x80, 0x3B, 0x00, 0x66, 0x00, 0xCC, 0x01, 0x98,
+  0x06, 0x30, 0x0C, 0x30, 0x70, 0x7F, 0xC0, 0x3F, 0x00, 0xC0, 0x07, 0xC0,
+  0x06, 0xC0, 0x0E, 0x60, 0x0C, 0x60, 0x18, 0x60, 0x18, 0x60, 0x30, 0x60,
+  0x70, 0x60, 0x60, 0x30, 0xE0, 0x30, 0xC0, 0x31, 0xC0, 0x31, 0x80, 0x33,
+  0x00, 0x3B, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0xC0, 0x70, 0x0F,
+  0x01, 0xC0, 0x6C, 0x07, 0x01, 0xB0, 0x36, 0x0E, 0xC0, 0xD8, 0x33, 0x06,
+  0x61, 0xCC, 0x19, 0x86, 0x30, 0xE6, 0x18, 0xE3, 0x18, 0xC1, 0x8C, 0x63,
+  0x06, 0x61, 0x9C, 0x19, 0x86, 0x60, 0x6C, 0x1B, 0x81, 0xB0, 0x6C, 0x07,
+  0xC1, 0xB0, 0x1E, 0x07, 0x80, 0x78, 0x1E, 0x01, 0xC0, 0x78, 0x00, 0x06,
+  0x01, 0x81, 0x80, 0xE0, 0x70, 0x70, 0x0C, 0x38, 0x03, 0x9C, 0x00, 0x66,
+  0x00, 0x1F, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x3E, 0x00,
+  0x1C, 0xC0, 0x06, 0x30, 0x03, 0x06, 0x01, 0xC1, 0x80, 0xE0, 0x70, 0x70,
+  0x0C, 0x38, 0x03, 0x80, 0xE0, 0x0E, 0xC0, 0x39, 0xC0, 0x61, 0x81, 0x83,
+  0x87, 0x03, 0x1C, 0x07, 0x70, 0x07, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x18,
+  0x00, 0x70, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01,
+  0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+  0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x0F, 0x87, 0xC3, 0x03, 0x01, 0x80, 0xC0,
+  0x60, 0x30, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0, 0x60,
+  0x30, 0x38, 0x1F, 0x0F, 0x80, 0xCC, 0xCC, 0xC6, 0x66, 0x66, 0x66, 0x66,
+  0x63, 0x33, 0x33, 0x0F, 0x87, 0xC0, 0xE0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x06,
+  0x1F, 0x0F, 0x80, 0x03, 0x80, 0x0F, 0x80, 0x3B, 0x80, 0xE3, 0x83, 0x83,
+  0x8E, 0x03, 0xB8, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xE3, 0x0C, 0x30, 0x0F,
+  0xC3, 0xFE, 0x30, 0x70, 0x03, 0x00, 0x31, 0xFF, 0x7F, 0xF7, 0x06, 0xC0,
+  0x6C, 0x0E, 0xE1, 0xE7, 0xF6, 0x3C, 0xC0, 0x0C, 0x00, 0x60, 0x07, 0x00,
+  0x30, 0x01, 0x80, 0x0C, 0xF0, 0x7F, 0xC7, 0x87, 0x38, 0x19, 0x80, 0xCC,
+  0x06, 0xE0, 0x36, 0x01, 0xB0, 0x19, 0xC1, 0xCE, 0x1C, 0xDF, 0xC6, 0x7C,
+  0x00, 0x07, 0xE1, 0xFF, 0x38, 0x17, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x47, 0xFC, 0x1F, 0x00, 0x00, 0x0C, 0x00,
+  0x30, 0x01, 0x80, 0x06, 0x00, 0x18, 0x3C, 0x61, 0xFF, 0x8E, 0x3C, 0x70,
+  0x71, 0x80, 0xCC, 0x03, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x8C, 0x0E, 0x38,
+  0x78, 0x7F, 0xC0, 0xF3, 0x00, 0x07, 0xC1, 0xFE, 0x38, 0x76, 0x03, 0x60,
+  0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x47, 0xFC, 0x1F,
+  0x80, 0x07, 0xC3, 0xF0, 0xC0, 0x60, 0x18, 0x3F, 0xCF, 0xF0, 0x40, 0x30,
+  0x0C, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x00,
+  0x0F, 0x98, 0xFE, 0xCE, 0x1E, 0xE0, 0x66, 0x03, 0x60, 0x1B, 0x00, 0xD8,
+  0x06, 0xC0, 0x66, 0x07, 0x38, 0x78, 0xFE, 0xC3, 0xCC, 0x00, 0x60, 0x07,
+  0x10, 0x70, 0xFF, 0x03, 0xE0, 0x00, 0x0C, 0x00, 0x60, 0x07, 0x00, 0x30,
+  0x01, 0x80, 0x0C, 0xF8, 0x7F, 0xE7, 0x87, 0x38, 0x19, 0x80, 0xCC, 0x06,
+  0xC0, 0x76, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0xC0, 0x66, 0x03, 0x00,
+  0x0C, 0x30, 0xC0, 0x00, 0x61, 0x8E, 0x30, 0xC3, 0x1C, 0x61, 0x86, 0x18,
+  0xC3, 0x00, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x00, 0x18, 0x0C, 0x06, 0x06,
+  0x03, 0x01, 0x80, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03,
+  0x01, 0x83, 0xC3, 0x80, 0x0C, 0x00, 0x30, 0x01, 0xC0, 0x06, 0x00, 0x18,
+  0x00, 0x60, 0xE1, 0x87, 0x0C, 0x38, 0x33, 0xC0, 0xDC, 0x03, 0xE0, 0x1B,
+  0x00, 0x66, 0x01, 0x9C, 0x06, 0x38, 0x18, 0x70, 0xC0, 0xE3, 0x01, 0xC0,
+  0x0C, 0x31, 0xC6, 0x18, 0x61, 0x8C, 0x30, 0xC3, 0x1C, 0x61, 0x86, 0x18,
+  0xC3, 0x00, 0x19, 0xE0, 0xF0, 0x7F, 0xEF, 0xE3, 0xC3, 0xE1, 0xCE, 0x07,
+  0x03, 0x30, 0x18, 0x0C, 0xC0, 0x60, 0x37, 0x01, 0x81, 0xD8, 0x0C, 0x06,
+  0x60, 0x30, 0x19, 0x80, 0xC0, 0x66, 0x03, 0x01, 0xB0, 0x18, 0x0C, 0xC0,
+  0x60, 0x30, 0x19, 0xE0, 0xFF, 0x8F, 0x0E, 0x70, 0x33, 0x01, 0x98, 0x0D,
+  0xC0, 0xEC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0D, 0x80, 0xCC, 0x06, 0x00,
+  0x07, 0xC1, 0xFE, 0x38, 0x67, 0x03, 0x60, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x6C, 0x0E, 0xE1, 0xC7, 0xF8, 0x3F, 0x00, 0x0C, 0xF0, 0x3F, 0xE1,
+  0xE1, 0xC7, 0x03, 0x18, 0x0C, 0x60, 0x31, 0x80, 0xCC, 0x03, 0x30, 0x18,
+  0xE0, 0xE3, 0xC7, 0x1F, 0xF8, 0x67, 0xC1, 0x80, 0x06, 0x00, 0x18, 0x00,
+  0xC0, 0x03, 0x00, 0x00, 0x0F, 0x98, 0xFE, 0xCE, 0x1C, 0xE0, 0x66, 0x03,
+  0x60, 0x1B, 0x00, 0xD8, 0x0C, 0xC0, 0x66, 0x07, 0x38, 0x78, 0xFF, 0x83,
+  0xCC, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0x80, 0x0C, 0x00, 0x1B, 0xC7,
+  0xF3, 0xC0, 0xE0, 0x30, 0x0C, 0x07, 0x01, 0x80, 0x60, 0x18, 0x06, 0x03,
+  0x00, 0xC0, 0x00, 0x07, 0xE1, 0xFF, 0x38, 0x33, 0x00, 0x30, 0x03, 0xE0,
+  0x1F, 0xC0, 0x1E, 0x00, 0x60, 0x06, 0xC0, 0xEF, 0xFC, 0x3F, 0x00, 0x38,
+  0x30, 0x30, 0x30, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFC, 0x7C, 0x30, 0x19, 0x80, 0xD8, 0x0C, 0xC0, 0x66, 0x03,
+  0x30, 0x1B, 0x81, 0xD8, 0x0C, 0xC0, 0x66, 0x07, 0x38, 0x79, 0xFF, 0x87,
+  0xCC, 0x00, 0xC0, 0x3E, 0x01, 0xB8, 0x1C, 0xC0, 0xC6, 0x0C, 0x30, 0xE1,
+  0x86, 0x0C, 0x70, 0x33, 0x01, 0xB0, 0x0D, 0x80, 0x78, 0x03, 0xC0, 0x00,
+  0xC1, 0xC0, 0xF0, 0x70, 0x6C, 0x3C, 0x1B, 0x0D, 0x8C, 0xC7, 0x63, 0x31,
+  0x99, 0x8C, 0xE6, 0x61, 0xB1, 0xB0, 0x7C, 0x6C, 0x1E, 0x1F, 0x07, 0x87,
+  0x81, 0xC1, 0xE0, 0x70, 0x70, 0x00, 0x0C, 0x0E, 0x18, 0x38, 0x18, 0xE0,
+  0x3B, 0x80, 0x3E, 0x00, 0x78, 0x00, 0xE0, 0x03, 0xE0, 0x0E, 0xC0, 0x38,
+  0xC0, 0xE1, 0x83, 0x81, 0x8E, 0x03, 0x00, 0x18, 0x0E, 0x30, 0x18, 0x60,
+  0x70, 0xE0, 0xC0, 0xC3, 0x01, 0x8E, 0x03, 0x18, 0x06, 0x70, 0x06, 0xC0,
+  0x0F, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x80, 0x0E,
+  0x00, 0xF8, 0x01, 0xE0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x1C, 0x01, 0xC0,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xFF,
+  0xCF, 0xFE, 0x00, 0x01, 0xE0, 0x7C, 0x1C, 0x03, 0x00, 0x60, 0x0C, 0x03,
+  0x00, 0x60, 0x0C, 0x03, 0x83, 0xE0, 0x78, 0x03, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xE0, 0x3C, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x01, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x70, 0x07, 0x80, 0xF0, 0x30, 0x0C, 0x01,
+  0x80, 0x30, 0x0E, 0x01, 0x80, 0x30, 0x0E, 0x0F, 0x81, 0xE0, 0x00, 0x3E,
+  0x02, 0xFF, 0x0F, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0xFF,
+  0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF0, 0x00, 0x0C, 0x30, 0xC0, 0x00,
+  0x03, 0x08, 0x61, 0x86, 0x18, 0x61, 0x8C, 0x30, 0xC3, 0x00, 0x00, 0x80,
+  0x08, 0x01, 0x80, 0x7C, 0x1F, 0xE3, 0x92, 0x71, 0x06, 0x30, 0xC2, 0x0C,
+  0x20, 0xC2, 0x0C, 0x60, 0xC4, 0x0E, 0x48, 0x7F, 0x83, 0xF0, 0x0C, 0x00,
+  0x80, 0x08, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x38, 0x41, 0xC0, 0x06, 0x00,
+  0x18, 0x00, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0xFF, 0x83, 0xFE, 0x03, 0x00,
+  0x0C, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x40,
+  0x0B, 0x80, 0x77, 0x7B, 0x8F, 0xFC, 0x18, 0x60, 0xC0, 0xC3, 0x03, 0x0C,
+  0x0C, 0x30, 0x30, 0x61, 0x83, 0xFF, 0x1D, 0xEE, 0xE0, 0x1D, 0x00, 0x20,
+  0x30, 0x0C, 0x60, 0x38, 0x60, 0x60, 0xC1, 0x81, 0x87, 0x01, 0x9C, 0x03,
+  0x30, 0x3E, 0xFC, 0x7F, 0xF8, 0x0E, 0x00, 0x18, 0x07, 0xFF, 0x8F, 0xFF,
+  0x00, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0xFF, 0xFF,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0xFF, 0x1C, 0x21, 0x80, 0x18, 0x01,
+  0xC0, 0x1F, 0x03, 0x38, 0x61, 0xE6, 0x06, 0x70, 0x63, 0x86, 0x1E, 0xC0,
+  0xF0, 0x03, 0x80, 0x18, 0x01, 0x84, 0x38, 0x7F, 0x03, 0xE0, 0xE7, 0xE7,
+  0x03, 0xE0, 0x06, 0x0C, 0x0C, 0x01, 0x84, 0x7C, 0x44, 0xE1, 0x16, 0x60,
+  0x0A, 0x60, 0x03, 0x30, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x66, 0x00, 0x29,
+  0x80, 0x24, 0xE1, 0x11, 0x1F, 0x10, 0xC0, 0x18, 0x18, 0x30, 0x03, 0xE0,
+  0x00, 0x0F, 0x84, 0x70, 0x0C, 0x03, 0x1F, 0xCC, 0x36, 0x19, 0x86, 0x63,
+  0x8F, 0x60, 0x03, 0xFC, 0x02, 0x08, 0x30, 0xC3, 0x0C, 0x71, 0xC7, 0x18,
+  0x71, 0x81, 0x8E, 0x06, 0x38, 0x18, 0xE0, 0x63, 0x02, 0x08, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80,
+  0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x06, 0x0C, 0x0C, 0x01, 0x84, 0xFC, 0x44,
+  0x63, 0x16, 0x31, 0x8A, 0x18, 0xC3, 0x0C, 0x61, 0x87, 0xC0, 0xC3, 0x20,
+  0x61, 0x98, 0x28, 0xC6, 0x24, 0x63, 0x11, 0x30, 0xD0, 0xC0, 0x18, 0x18,
+  0x30, 0x03, 0xE0, 0x00, 0xFF, 0xFC, 0x38, 0x8A, 0x0C, 0x18, 0x28, 0x8E,
+  0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x31, 0x80,
+  0xC0, 0x60, 0x70, 0x70, 0x70, 0x70, 0xF0, 0x7F, 0x00, 0x3E, 0x03, 0x03,
+  0x06, 0x38, 0x06, 0x06, 0x06, 0x0C, 0xF8, 0x18, 0xC6, 0x30, 0x0C, 0x06,
+  0x18, 0x0C, 0x70, 0x30, 0xC0, 0x61, 0x80, 0xC3, 0x01, 0x86, 0x03, 0x18,
+  0x0C, 0x30, 0x18, 0x60, 0x30, 0xE1, 0xE3, 0xFE, 0xE6, 0x79, 0xCC, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x0F, 0xF3, 0xF3, 0x7F,
+  0x2F, 0xE6, 0xFE, 0x6F, 0xE6, 0xFE, 0x4F, 0xE4, 0x7C, 0xC1, 0xCC, 0x0C,
+  0xC0, 0xC8, 0x0C, 0x80, 0x98, 0x09, 0x81, 0x98, 0x19, 0x01, 0x90, 0x13,
+  0x03, 0x30, 0xFC, 0x30, 0xC7, 0xFF, 0x00, 0x3E, 0x06, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x18, 0x18, 0x7E, 0x0F, 0x06, 0x63, 0x0D, 0x83, 0x60, 0xD8,
+  0x36, 0x0D, 0x86, 0x33, 0x07, 0x80, 0x03, 0xFC, 0x21, 0x01, 0x8C, 0x0E,
+  0x30, 0x38, 0xC0, 0xE3, 0x03, 0x1C, 0x31, 0xC7, 0x1C, 0x61, 0x86, 0x18,
+  0x20, 0x80, 0x3E, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0xC0, 0x0C, 0x07, 0x00, 0x30, 0x18, 0x00, 0xC0, 0xC0, 0x06, 0x06, 0x00,
+  0x18, 0x38, 0x0D, 0xF8, 0xC0, 0x70, 0x06, 0x02, 0xC0, 0x30, 0x16, 0x01,
+  0x80, 0xD8, 0x0E, 0x06, 0x60, 0x30, 0x31, 0x81, 0x80, 0xFF, 0x0C, 0x00,
+  0x30, 0x70, 0x00, 0xC0, 0x3E, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0x60, 0x18, 0x00, 0xC0, 0x70, 0x01, 0x80, 0xC0, 0x03, 0x03, 0x00,
+  0x0C, 0x0C, 0x00, 0x18, 0x38, 0x78, 0xFC, 0x63, 0x18, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0x60, 0x18, 0x01, 0xC0, 0x70, 0x07, 0x00, 0xC0, 0x1C, 0x03,
+  0x00, 0x70, 0x0C, 0x03, 0xC0, 0x38, 0x07, 0xF0, 0x3E, 0x00, 0x30, 0x06,
+  0x00, 0xC0, 0x0C, 0x03, 0x00, 0x30, 0x0C, 0x03, 0x80, 0x38, 0x00, 0xC0,
+  0x60, 0x01, 0x81, 0x80, 0x03, 0x06, 0x00, 0x0C, 0x1C, 0x07, 0xF0, 0x30,
+  0x1C, 0x00, 0xC0, 0x58, 0x03, 0x01, 0x60, 0x0C, 0x06, 0xC0, 0x38, 0x19,
+  0x80, 0x60, 0x63, 0x01, 0x80, 0xFF, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x30,
+  0x01, 0x81, 0xC0, 0xC0, 0x00, 0x00, 0x38, 0x18, 0x0C, 0x0E, 0x0E, 0x0E,
+  0x0C, 0x0C, 0x06, 0x03, 0x03, 0xC3, 0xFF, 0x1E, 0x00, 0x00, 0x70, 0x00,
+  0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00,
+  0xD8, 0x00, 0xCC, 0x01, 0x8C, 0x03, 0x8C, 0x03, 0x0C, 0x07, 0x0C, 0x06,
+  0x0C, 0x0C, 0x06, 0x0C, 0x06, 0x1F, 0xFE, 0x3F, 0xFE, 0x30, 0x06, 0x70,
+  0x03, 0x60, 0x03, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xCC, 0x01,
+  0x8C, 0x03, 0x8C, 0x03, 0x0C, 0x07, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C,
+  0x06, 0x1F, 0xFE, 0x3F, 0xFE, 0x30, 0x06, 0x70, 0x03, 0x60, 0x03, 0xE0,
+  0x03, 0x00, 0x3C, 0x00, 0x6C, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xCC, 0x01, 0x8C, 0x03, 0x8C, 0x03,
+  0x0C, 0x07, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x06, 0x1F, 0xFE, 0x3F,
+  0xFE, 0x30, 0x06, 0x70, 0x03, 0x60, 0x03, 0xE0, 0x03, 0x00, 0x73, 0x00,
+  0xCE, 0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00, 0xD8, 0x00,
+  0xCC, 0x01, 0x8C, 0x03, 0x8C, 0x03, 0x0C, 0x07, 0x0C, 0x06, 0x0C, 0x0C,
+  0x06, 0x0C, 0x06, 0x1F, 0xFE, 0x3F, 0xFE, 0x30, 0x06, 0x70, 0x03, 0x60,
+  0x03, 0xE0, 0x03, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xCC, 0x01, 0x8C, 0x03, 0x8C, 0x03,
+  0x0C, 0x07, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x06, 0x1F, 0xFE, 0x3F,
+  0xFE, 0x30, 0x06, 0x70, 0x03, 0x60, 0x03, 0xE0, 0x03, 0x00, 0x3C, 0x00,
+  0x66, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x6C, 0x00,
+  0xEC, 0x00, 0xCC, 0x01, 0xCC, 0x01, 0x8C, 0x03, 0x06, 0x07, 0x06, 0x06,
+  0x06, 0x0E, 0x06, 0x0C, 0x06, 0x1F, 0xFE, 0x1F, 0xFE, 0x30, 0x03, 0x70,
+  0x03, 0x60, 0x03, 0xE0, 0x03, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0,
+  0x1D, 0x80, 0x00, 0x0C, 0xC0, 0x00, 0x0C, 0x60, 0x00, 0x0E, 0x30, 0x00,
+  0x06, 0x18, 0x00, 0x07, 0x18, 0x00, 0x03, 0x0F, 0xFE, 0x03, 0x07, 0xFF,
+  0x03, 0x83, 0x00, 0x01, 0x81, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
+  0x00, 0xC0, 0x60, 0x00, 0xE0, 0x30, 0x00, 0x60, 0x1F, 0xFC, 0x70, 0x0F,
+  0xFE, 0x00, 0x01, 0xF8, 0x07, 0xFE, 0x0E, 0x07, 0x1C, 0x01, 0x30, 0x00,
+  0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+  0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x08, 0x70, 0x38, 0x3F, 0xF8,
+  0x0F, 0xE0, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0x00, 0x1E, 0x00,
+  0x03, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF1, 0xC0,
+  0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x3F, 0xF0, 0xFF,
+  0xC3, 0x00, 0x1C, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xFF,
+  0xE3, 0xFF, 0x80, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0x00, 0x0F, 0xFC,
+  0x3F, 0xF1, 0xC0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x0C, 0x00,
+  0x3F, 0xF0, 0xFF, 0xC3, 0x00, 0x1C, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
+  0x18, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x01, 0xE0, 0x0D, 0x80, 0x63, 0x00,
+  0x00, 0x0F, 0xFC, 0x3F, 0xF1, 0xC0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
+  0x80, 0x0C, 0x00, 0x3F, 0xF0, 0xFF, 0xC3, 0x00, 0x1C, 0x00, 0x60, 0x01,
+  0x80, 0x06, 0x00, 0x18, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x07, 0x38, 0x1C,
+  0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x70, 0x01, 0x80, 0x06, 0x00, 0x18,
+  0x00, 0x60, 0x03, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xC0, 0x07, 0x00, 0x18,
+  0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x38, 0x60,
+  0xC0, 0x0C, 0x31, 0xC6, 0x18, 0x61, 0x8C, 0x30, 0xC3, 0x1C, 0x61, 0x86,
+  0x18, 0xC3, 0x00, 0x06, 0x0C, 0x18, 0x00, 0x0C, 0x0C, 0x1C, 0x18, 0x18,
+  0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0xC0,
+  0xC0, 0x1E, 0x36, 0x63, 0x00, 0x0C, 0x0C, 0x1C, 0x18, 0x18, 0x18, 0x18,
+  0x30, 0x30, 0x30, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x73,
+  0xB9, 0xC0, 0x01, 0x80, 0xC0, 0xE0, 0x60, 0x30, 0x18, 0x0C, 0x0C, 0x06,
+  0x03, 0x01, 0x81, 0xC0, 0xC0, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x00, 0x07,
+  0xFC, 0x01, 0xFF, 0xC0, 0xC0, 0x78, 0x30, 0x06, 0x0C, 0x01, 0xC3, 0x00,
+  0x30, 0xC0, 0x0C, 0x60, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x31, 0x80, 0x0C,
+  0xE0, 0x06, 0x30, 0x01, 0x8C, 0x00, 0xC3, 0x00, 0x70, 0xC0, 0x78, 0x7F,
+  0xF8, 0x1F, 0xF8, 0x00, 0x01, 0xCC, 0x01, 0x9C, 0x00, 0x00, 0x01, 0xC0,
+  0x30, 0xE0, 0x18, 0xD8, 0x18, 0x6C, 0x0C, 0x36, 0x06, 0x1B, 0x83, 0x0C,
+  0xC3, 0x8C, 0x61, 0x86, 0x30, 0xC3, 0x0C, 0x61, 0x86, 0x31, 0xC3, 0x30,
+  0xC1, 0xD8, 0x60, 0x6C, 0x30, 0x36, 0x18, 0x1B, 0x18, 0x07, 0x0C, 0x03,
+  0x80, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x80,
+  0x3F, 0xF0, 0x38, 0x1C, 0x38, 0x06, 0x30, 0x03, 0xB8, 0x00, 0xD8, 0x00,
+  0x6C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0D, 0x80, 0x06, 0xC0,
+  0x07, 0x60, 0x07, 0x18, 0x07, 0x0E, 0x07, 0x03, 0xFF, 0x00, 0x7E, 0x00,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F,
+  0xF0, 0x38, 0x1C, 0x38, 0x06, 0x30, 0x03, 0xB8, 0x00, 0xD8, 0x00, 0x6C,
+  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0D, 0x80, 0x06, 0xC0, 0x07,
+  0x60, 0x07, 0x18, 0x07, 0x0E, 0x07, 0x03, 0xFF, 0x00, 0x7E, 0x00, 0x00,
+  0x78, 0x00, 0x6C, 0x00, 0x63, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xF0,
+  0x38, 0x1C, 0x38, 0x06, 0x30, 0x03, 0xB8, 0x00, 0xD8, 0x00, 0x6C, 0x00,
+  0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0D, 0x80, 0x06, 0xC0, 0x07, 0x60,
+  0x07, 0x18, 0x07, 0x0E, 0x07, 0x03, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0xE6,
+  0x00, 0xCE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xE0, 0x70, 0x38, 0x70,
+  0x0C, 0x60, 0x07, 0x70, 0x01, 0xB0, 0x00, 0xD8, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x1E, 0x00, 0x1B, 0x00, 0x0D, 0x80, 0x0E, 0xC0, 0x0E, 0x30, 0x0E,
+  0x1C, 0x0E, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x01, 0xCE, 0x00, 0xE7, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x7F, 0xE0, 0x70, 0x38, 0x70, 0x0C, 0x60, 0x07,
+  0x70, 0x01, 0xB0, 0x00, 0xD8, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00,
+  0x1B, 0x00, 0x0D, 0x80, 0x0E, 0xC0, 0x0E, 0x30, 0x0E, 0x1C, 0x0E, 0x07,
+  0xFE, 0x00, 0xFC, 0x00, 0x40, 0x0B, 0x80, 0x77, 0x03, 0x8E, 0x1C, 0x1C,
+  0xE0, 0x3F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x73, 0x83, 0x87, 0x1C,
+  0x0E, 0xE0, 0x1D, 0x00, 0x20, 0x00, 0x7E, 0x10, 0x0F, 0xFD, 0x80, 0xE0,
+  0x78, 0x0E, 0x01, 0x80, 0xE0, 0x3E, 0x0E, 0x03, 0xB0, 0x60, 0x39, 0x83,
+  0x03, 0x0C, 0x30, 0x30, 0x61, 0x87, 0x03, 0x0C, 0x70, 0x30, 0x67, 0x01,
+  0x83, 0x60, 0x1C, 0x1E, 0x01, 0xC0, 0x60, 0x1C, 0x07, 0x81, 0xC0, 0x6F,
+  0xFC, 0x06, 0x1F, 0x80, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x00,
+  0x03, 0x00, 0x66, 0x00, 0xCC, 0x01, 0xB0, 0x03, 0x60, 0x0C, 0xC0, 0x19,
+  0x80, 0x33, 0x00, 0x66, 0x00, 0xD8, 0x03, 0xB0, 0x06, 0x60, 0x0C, 0xC0,
+  0x19, 0x80, 0x63, 0x00, 0xC3, 0x07, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0x00,
+  0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x66, 0x00, 0xCC, 0x01,
+  0xB0, 0x03, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x33, 0x00, 0x66, 0x00, 0xD8,
+  0x03, 0xB0, 0x06, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x63, 0x00, 0xC3, 0x07,
+  0x07, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x03, 0x60, 0x0C, 0x60, 0x00,
+  0x03, 0x00, 0x66, 0x00, 0xCC, 0x01, 0xB0, 0x03, 0x60, 0x0C, 0xC0, 0x19,
+  0x80, 0x33, 0x00, 0x66, 0x00, 0xD8, 0x03, 0xB0, 0x06, 0x60, 0x0C, 0xC0,
+  0x19, 0x80, 0x63, 0x00, 0xC3, 0x07, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0x03,
+  0x9C, 0x07, 0x38, 0x00, 0x01, 0x80, 0x33, 0x00, 0x66, 0x00, 0xD8, 0x01,
+  0xB0, 0x06, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x33, 0x00, 0x6C, 0x01, 0xD8,
+  0x03, 0x30, 0x06, 0x60, 0x0C, 0xC0, 0x31, 0x80, 0x61, 0x83, 0x83, 0xFE,
+  0x01, 0xF8, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00,
+  0xEC, 0x03, 0x9C, 0x06, 0x18, 0x18, 0x38, 0x70, 0x31, 0xC0, 0x77, 0x00,
+  0x7C, 0x00, 0x70, 0x00, 0xC0, 0x01, 0x80, 0x07, 0x00, 0x0C, 0x00, 0x18,
+  0x00, 0x30, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x60,
+  0x07, 0x00, 0x3F, 0xC1, 0xFF, 0x0C, 0x1C, 0x60, 0x66, 0x03, 0x30, 0x19,
+  0x81, 0xCC, 0x1C, 0xFF, 0xC7, 0xFC, 0x30, 0x01, 0x80, 0x0C, 0x00, 0xC0,
+  0x06, 0x00, 0x00, 0x03, 0xE0, 0x7F, 0x87, 0x0E, 0x30, 0x33, 0x83, 0x98,
+  0x70, 0xC6, 0x06, 0x60, 0x33, 0x01, 0x9C, 0x18, 0x78, 0xC0, 0xE6, 0x03,
+  0xB0, 0x0D, 0x80, 0x7D, 0x06, 0xDF, 0xF6, 0x7E, 0x00, 0x07, 0x00, 0x30,
+  0x01, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x30, 0x70, 0x03,
+  0x00, 0x31, 0xFF, 0x7F, 0xF7, 0x06, 0xC0, 0x6C, 0x0E, 0xE1, 0xE7, 0xF6,
+  0x3C, 0xC0, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x0F,
+  0xC3, 0xFE, 0x30, 0x70, 0x03, 0x00, 0x31, 0xFF, 0x7F, 0xF7, 0x06, 0xC0,
+  0x6C, 0x0E, 0xE1, 0xE7, 0xF6, 0x3C, 0xC0, 0x01, 0x80, 0x3C, 0x06, 0x40,
+  0xC6, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x30, 0x70, 0x03, 0x00, 0x31,
+  0xFF, 0x7F, 0xF7, 0x06, 0xC0, 0x6C, 0x0E, 0xE1, 0xE7, 0xF6, 0x3C, 0xC0,
+  0x07, 0x30, 0x5A, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE,
+  0x30, 0x70, 0x03, 0x00, 0x31, 0xFF, 0x7F, 0xF7, 0x06, 0xC0, 0x6C, 0x0E,
+  0xE1, 0xE7, 0xF6, 0x3C, 0xC0, 0x0E, 0x70, 0xE7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFC, 0x3F, 0xE3, 0x07, 0x00, 0x30, 0x03, 0x1F, 0xF7, 0xFF, 0x70,
+  0x6C, 0x06, 0xC0, 0xEE, 0x1E, 0x7F, 0x63, 0xCC, 0x03, 0xC0, 0x66, 0x04,
+  0x20, 0x42, 0x06, 0x60, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x30,
+  0x70, 0x03, 0x00, 0x31, 0xFF, 0x7F, 0xF7, 0x06, 0xC0, 0x6C, 0x0E, 0xE1,
+  0xE7, 0xF6, 0x3C, 0xC0, 0x0F, 0xC3, 0xF0, 0xFF, 0x9F, 0xE3, 0x07, 0xC1,
+  0xC0, 0x0E, 0x03, 0x00, 0x30, 0x0C, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0xDC,
+  0x0C, 0x00, 0xC0, 0x70, 0x03, 0x03, 0xC0, 0x0E, 0x1F, 0x81, 0x1F, 0xE7,
+  0xFC, 0x3E, 0x0F, 0xE0, 0x07, 0xE1, 0xFF, 0x38, 0x17, 0x00, 0x60, 0x0E,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x47, 0xFC, 0x1F, 0x01,
+  0x80, 0x0C, 0x00, 0xC0, 0x7C, 0x07, 0x80, 0x07, 0x00, 0x30, 0x01, 0x80,
+  0x0C, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0x38, 0x76, 0x03, 0x60, 0x3F,
+  0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x47, 0xFC, 0x1F, 0x80,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE,
+  0x38, 0x76, 0x03, 0x60, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x00,
+  0xE0, 0x47, 0xFC, 0x1F, 0x80, 0x01, 0x80, 0x3C, 0x06, 0x40, 0xC6, 0x00,
+  0x00, 0x00, 0x07, 0xC1, 0xFE, 0x38, 0x76, 0x03, 0x60, 0x3F, 0xFF, 0xFF,
+  0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x47, 0xFC, 0x1F, 0x80, 0x0E, 0x70,
+  0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xE3, 0x87, 0x60, 0x36,
+  0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x04, 0x7F, 0xC1,
+  0xF8, 0x70, 0xC1, 0x83, 0x00, 0x01, 0x86, 0x38, 0xC3, 0x0C, 0x71, 0x86,
+  0x18, 0x63, 0x0C, 0x00, 0x06, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x18, 0x18,
+  0x38, 0x30, 0x30, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x18,
+  0x79, 0x96, 0x30, 0x00, 0x06, 0x0C, 0x38, 0x60, 0xC1, 0x87, 0x0C, 0x18,
+  0x30, 0x61, 0x83, 0x00, 0xE7, 0xE7, 0x00, 0x00, 0x00, 0x18, 0x18, 0x38,
+  0x30, 0x30, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x07, 0x00,
+  0x1F, 0x81, 0xE0, 0x3B, 0x80, 0x0E, 0x03, 0xF0, 0x7F, 0x87, 0x0E, 0x70,
+  0x33, 0x01, 0xB0, 0x0D, 0x80, 0x6C, 0x03, 0x60, 0x33, 0x03, 0x9C, 0x38,
+  0x7F, 0x81, 0xF0, 0x00, 0x03, 0x98, 0x16, 0x81, 0x9C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x67, 0x83, 0xFE, 0x3C, 0x39, 0xC0, 0xCC, 0x06, 0x60, 0x37,
+  0x03, 0xB0, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x36, 0x03, 0x30, 0x18, 0x07,
+  0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0x38,
+  0x67, 0x03, 0x60, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0E, 0xE1,
+  0xC7, 0xF8, 0x3F, 0x00, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00,
+  0x00, 0x07, 0xC1, 0xFE, 0x38, 0x67, 0x03, 0x60, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x6C, 0x0E, 0xE1, 0xC7, 0xF8, 0x3F, 0x00, 0x01, 0x80, 0x3C,
+  0x06, 0x40, 0xC6, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0x38, 0x67, 0x03,
+  0x60, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0E, 0xE1, 0xC7, 0xF8,
+  0x3F, 0x00, 0x07, 0x30, 0x5A, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xC1, 0xFE, 0x38, 0x67, 0x03, 0x60, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x6C, 0x0E, 0xE1, 0xC7, 0xF8, 0x3F, 0x00, 0x0E, 0x70, 0xE7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7C, 0x1F, 0xE3, 0x86, 0x70, 0x36, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x06, 0xC0, 0xEE, 0x1C, 0x7F, 0x83, 0xF0, 0x03, 0x80,
+  0x07, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x04, 0x0F,
+  0x30, 0xFF, 0x87, 0x0C, 0x38, 0x78, 0xC3, 0x66, 0x19, 0x98, 0xC6, 0x66,
+  0x19, 0xB0, 0xC7, 0x87, 0x0C, 0x38, 0x7F, 0xC3, 0x3E, 0x08, 0x00, 0x00,
+  0x07, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x66,
+  0x03, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x6E, 0x07, 0x60, 0x33, 0x01,
+  0x98, 0x1C, 0xE1, 0xE7, 0xFE, 0x1F, 0x30, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x66, 0x03, 0x60, 0x33, 0x01, 0x98,
+  0x0C, 0xC0, 0x6E, 0x07, 0x60, 0x33, 0x01, 0x98, 0x1C, 0xE1, 0xE7, 0xFE,
+  0x1F, 0x30, 0x01, 0x80, 0x1E, 0x01, 0x90, 0x18, 0xC0, 0x00, 0x00, 0x00,
+  0xC0, 0x66, 0x03, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x6E, 0x07, 0x60,
+  0x33, 0x01, 0x98, 0x1C, 0xE1, 0xE7, 0xFE, 0x1F, 0x30, 0x0E, 0x70, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0xC0, 0x6C, 0x06, 0x60, 0x33,
+  0x01, 0x98, 0x0D, 0xC0, 0xEC, 0x06, 0x60, 0x33, 0x03, 0x9C, 0x3C, 0xFF,
+  0xC3, 0xE6, 0x00, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x03, 0x8C, 0x06, 0x18, 0x1C, 0x38, 0x30, 0x30, 0xC0,
+  0x63, 0x80, 0xC6, 0x01, 0x9C, 0x01, 0xB0, 0x03, 0xC0, 0x07, 0x80, 0x0E,
+  0x00, 0x1C, 0x00, 0x30, 0x00, 0xE0, 0x03, 0x80, 0x3E, 0x00, 0x78, 0x00,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0x67, 0xC1, 0xBF,
+  0x87, 0x87, 0x1C, 0x0C, 0xE0, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x1C, 0xC0,
+  0x67, 0x03, 0x9E, 0x1C, 0x6F, 0xE1, 0x9E, 0x06, 0x00, 0x18, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x9C, 0x07, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x01, 0xC6, 0x03, 0x0C, 0x0E, 0x1C, 0x18, 0x18, 0x60,
+  0x31, 0xC0, 0x63, 0x00, 0xCE, 0x00, 0xD8, 0x01, 0xE0, 0x03, 0xC0, 0x07,
+  0x00, 0x0E, 0x00, 0x18, 0x00, 0x70, 0x01, 0xC0, 0x1F, 0x00, 0x3C, 0x00,
+  0x00 };
+
+const GFXglyph DejaVuSans_Oblique12pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   6,  18,  10,    2,  -17 },   // 0x21 '!'
+  {    15,   6,   7,  11,    2,  -17 },   // 0x22 '"'
+  {    21,  17,  18,  20,    2,  -17 },   // 0x23 '#'
+  {    60,  13,  23,  15,    1,  -18 },   // 0x24 '$'
+  {    98,  18,  18,  23,    2,  -17 },   // 0x25 '%'
+  {   139,  17,  18,  19,    1,  -17 },   // 0x26 '&'
+  {   178,   2,   7,   7,    2,  -17 },   // 0x27 '''
+  {   180,   8,  21,   9,    2,  -17 },   // 0x28 '('
+  {   201,   8,  21,   9,   -1,  -17 },   // 0x29 ')'
+  {   222,  11,  10,  12,    0,  -17 },   // 0x2A '*'
+  {   236,  16,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   268,   3,   6,   8,    1,   -2 },   // 0x2C ','
+  {   271,   7,   3,   9,    1,   -7 },   // 0x2D '-'
+  {   274,   2,   3,   8,    1,   -2 },   // 0x2E '.'
+  {   275,  12,  20,   8,   -2,  -17 },   // 0x2F '/'
+  {   305,  13,  18,  15,    2,  -17 },   // 0x30 '0'
+  {   335,  10,  18,  15,    1,  -17 },   // 0x31 '1'
+  {   358,  14,  18,  15,    0,  -17 },   // 0x32 '2'
+  {   390,  14,  18,  15,    0,  -17 },   // 0x33 '3'
+  {   422,  13,  18,  15,    0,  -17 },   // 0x34 '4'
+  {   452,  13,  18,  15,    0,  -17 },   // 0x35 '5'
+  {   482,  13,  18,  15,    2,  -17 },   // 0x36 '6'
+  {   512,  13,  18,  15,    2,  -17 },   // 0x37 '7'
+  {   542,  13,  18,  15,    1,  -17 },   // 0x38 '8'
+  {   572,  12,  18,  15,    2,  -17 },   // 0x39 '9'
+  {   599,   4,  12,   8,    1,  -11 },   // 0x3A ':'
+  {   605,   5,  15,   8,    1,  -11 },   // 0x3B ';'
+  {   615,  15,  13,  20,    3,  -13 },   // 0x3C '<'
+  {   640,  15,   7,  20,    3,  -10 },   // 0x3D '='
+  {   654,  15,  13,  20,    3,  -13 },   // 0x3E '>'
+  {   679,   9,  18,  13,    3,  -17 },   // 0x3F '?'
+  {   700,  21,  21,  24,    1,  -16 },   // 0x40 '@'
+  {   756,  16,  18,  16,   -1,  -17 },   // 0x41 'A'
+  {   792,  14,  18,  16,    1,  -17 },   // 0x42 'B'
+  {   824,  16,  18,  17,    1,  -17 },   // 0x43 'C'
+  {   860,  17,  18,  18,    1,  -17 },   // 0x44 'D'
+  {   899,  14,  18,  15,    1,  -17 },   // 0x45 'E'
+  {   931,  13,  18,  14,    1,  -17 },   // 0x46 'F'
+  {   961,  16,  18,  19,    1,  -17 },   // 0x47 'G'
+  {   997,  17,  18,  18,    1,  -17 },   // 0x48 'H'
+  {  1036,   6,  18,   7,    1,  -17 },   // 0x49 'I'
+  {  1050,  10,  23,   7,   -4,  -17 },   // 0x4A 'J'
+  {  1079,  17,  18,  16,    1,  -17 },   // 0x4B 'K'
+  {  1118,  11,  18,  13,    1,  -17 },   // 0x4C 'L'
+  {  1143,  19,  18,  21,    1,  -17 },   // 0x4D 'M'
+  {  1186,  17,  18,  18,    1,  -17 },   // 0x4E 'N'
+  {  1225,  17,  18,  19,    1,  -17 },   // 0x4F 'O'
+  {  1264,  14,  18,  14,    1,  -17 },   // 0x50 'P'
+  {  1296,  17,  21,  19,    1,  -17 },   // 0x51 'Q'
+  {  1341,  14,  18,  17,    1,  -17 },   // 0x52 'R'
+  {  1373,  14,  18,  15,    0,  -17 },   // 0x53 'S'
+  {  1405,  15,  18,  15,    1,  -17 },   // 0x54 'T'
+  {  1439,  15,  18,  18,    1,  -17 },   // 0x55 'U'
+  {  1473,  16,  18,  16,    2,  -17 },   // 0x56 'V'
+  {  1509,  22,  18,  24,    2,  -17 },   // 0x57 'W'
+  {  1559,  18,  18,  16,   -1,  -17 },   // 0x58 'X'
+  {  1600,  15,  18,  15,    1,  -17 },   // 0x59 'Y'
+  {  1634,  17,  18,  16,   -1,  -17 },   // 0x5A 'Z'
+  {  1673,   9,  21,   9,    1,  -17 },   // 0x5B '['
+  {  1697,   4,  20,   8,    2,  -17 },   // 0x5C '\'
+  {  1707,   9,  21,   9,   -1,  -17 },   // 0x5D ']'
+  {  1731,  15,   7,  20,    3,  -17 },   // 0x5E '^'
+  {  1745,  12,   2,  12,    0,    5 },   // 0x5F '_'
+  {  1748,   5,   4,  12,    5,  -18 },   // 0x60 '`'
+  {  1751,  12,  13,  14,    1,  -12 },   // 0x61 'a'
+  {  1771,  13,  18,  15,    1,  -17 },   // 0x62 'b'
+  {  1801,  12,  13,  13,    1,  -12 },   // 0x63 'c'
+  {  1821,  14,  18,  15,    1,  -17 },   // 0x64 'd'
+  {  1853,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1873,  10,  18,   8,    2,  -17 },   // 0x66 'f'
+  {  1896,  13,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1926,  13,  18,  15,    1,  -17 },   // 0x68 'h'
+  {  1956,   6,  18,   7,    1,  -17 },   // 0x69 'i'
+  {  1970,   9,  23,   7,   -3,  -17 },   // 0x6A 'j'
+  {  1996,  14,  18,  14,    1,  -17 },   // 0x6B 'k'
+  {  2028,   6,  18,   7,    1,  -17 },   // 0x6C 'l'
+  {  2042,  22,  13,  24,    1,  -12 },   // 0x6D 'm'
+  {  2078,  13,  13,  15,    1,  -12 },   // 0x6E 'n'
+  {  2100,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  2120,  14,  18,  15,    0,  -12 },   // 0x70 'p'
+  {  2152,  13,  18,  15,    1,  -12 },   // 0x71 'q'
+  {  2182,  10,  13,  10,    1,  -12 },   // 0x72 'r'
+  {  2199,  12,  13,  13,    0,  -12 },   // 0x73 's'
+  {  2219,   8,  17,   9,    2,  -16 },   // 0x74 't'
+  {  2236,  13,  13,  15,    1,  -12 },   // 0x75 'u'
+  {  2258,  13,  13,  14,    2,  -12 },   // 0x76 'v'
+  {  2280,  18,  13,  20,    2,  -12 },   // 0x77 'w'
+  {  2310,  15,  13,  14,   -1,  -12 },   // 0x78 'x'
+  {  2335,  15,  18,  14,   -1,  -12 },   // 0x79 'y'
+  {  2369,  13,  13,  13,    0,  -12 },   // 0x7A 'z'
+  {  2391,  11,  22,  15,    3,  -17 },   // 0x7B '{'
+  {  2422,   2,  24,   8,    3,  -17 },   // 0x7C '|'
+  {  2428,  11,  22,  15,    0,  -17 },   // 0x7D '}'
+  {  2459,  15,   4,  20,    3,   -8 },   // 0x7E '~'
+  {  2467,  12,  21,  14,    1,  -16 },   // 0x7F
+  {  2499,  12,  21,  14,    1,  -16 },   // 0x80
+  {  2531,  12,  21,  14,    1,  -16 },   // 0x81
+  {  2563,  12,  21,  14,    1,  -16 },   // 0x82
+  {  2595,  12,  21,  14,    1,  -16 },   // 0x83
+  {  2627,  12,  21,  14,    1,  -16 },   // 0x84
+  {  2659,  12,  21,  14,    1,  -16 },   // 0x85
+  {  2691,  12,  21,  14,    1,  -16 },   // 0x86
+  {  2723,  12,  21,  14,    1,  -16 },   // 0x87
+  {  2755,  12,  21,  14,    1,  -16 },   // 0x88
+  {  2787,  12,  21,  14,    1,  -16 },   // 0x89
+  {  2819,  12,  21,  14,    1,  -16 },   // 0x8A
+  {  2851,  12,  21,  14,    1,  -16 },   // 0x8B
+  {  2883,  12,  21,  14,    1,  -16 },   // 0x8C
+  {  2915,  12,  21,  14,    1,  -16 },   // 0x8D
+  {  2947,  12,  21,  14,    1,  -16 },   // 0x8E
+  {  2979,  12,  21,  14,    1,  -16 },   // 0x8F
+  {  3011,  12,  21,  14,    1,  -16 },   // 0x90
+  {  3043,  12,  21,  14,    1,  -16 },   // 0x91
+  {  3075,  12,  21,  14,    1,  -16 },   // 0x92
+  {  3107,  12,  21,  14,    1,  -16 },   // 0x93
+  {  3139,  12,  21,  14,    1,  -16 },   // 0x94
+  {  3171,  12,  21,  14,    1,  -16 },   // 0x95
+  {  3203,  12,  21,  14,    1,  -16 },   // 0x96
+  {  3235,  12,  21,  14,    1,  -16 },   // 0x97
+  {  3267,  12,  21,  14,    1,  -16 },   // 0x98
+  {  3299,  12,  21,  14,    1,  -16 },   // 0x99
+  {  3331,  12,  21,  14,    1,  -16 },   // 0x9A
+  {  3363,  12,  21,  14,    1,  -16 },   // 0x9B
+  {  3395,  12,  21,  14,    1,  -16 },   // 0x9C
+  {  3427,  12,  21,  14,    1,  -16 },   // 0x9D
+  {  3459,  12,  21,  14,    1,  -16 },   // 0x9E
+  {  3491,  12,  21,  14,    1,  -16 },   // 0x9F
+  {  3523,   1,   1,   8,    0,    0 },   // 0xA0
+  {  3524,   6,  18,  10,    2,  -12 },   // 0xA1
+  {  3538,  12,  19,  15,    2,  -15 },   // 0xA2
+  {  3567,  14,  18,  15,    1,  -17 },   // 0xA3
+  {  3599,  14,  14,  15,    1,  -14 },   // 0xA4
+  {  3624,  15,  18,  15,    1,  -17 },   // 0xA5
+  {  3658,   2,  21,   8,    3,  -16 },   // 0xA6
+  {  3664,  12,  20,  12,    0,  -17 },   // 0xA7
+  {  3694,   8,   2,  12,    4,  -17 },   // 0xA8
+  {  3696,  17,  17,  24,    3,  -16 },   // 0xA9
+  {  3733,  10,  12,  11,    1,  -17 },   // 0xAA
+  {  3748,  13,  11,  15,    1,  -11 },   // 0xAB
+  {  3766,  15,   7,  20,    3,   -9 },   // 0xAC
+  {  3780,   7,   3,   9,    1,   -7 },   // 0xAD
+  {  3783,  17,  17,  24,    3,  -16 },   // 0xAE
+  {  3820,   7,   2,  11,    4,  -17 },   // 0xAF
+  {  3822,   7,   7,  12,    2,  -17 },   // 0xB0
+  {  3829,  16,  16,  20,    2,  -15 },   // 0xB1
+  {  3861,   9,  10,  10,    1,  -17 },   // 0xB2
+  {  3873,   8,  10,  10,    0,  -17 },   // 0xB3
+  {  3883,   6,   4,  12,    6,  -18 },   // 0xB4
+  {  3886,  15,  18,  15,    0,  -12 },   // 0xB5
+  {  3920,  12,  20,  15,    2,  -17 },   // 0xB6
+  {  3950,   2,   3,   8,    3,   -9 },   // 0xB7
+  {  3951,   5,   5,  12,    1,    1 },   // 0xB8
+  {  3955,   8,  10,  10,    1,  -17 },   // 0xB9
+  {  3965,  10,  12,  11,    1,  -17 },   // 0xBA
+  {  3980,  13,  11,  15,    1,  -11 },   // 0xBB
+  {  3998,  22,  18,  23,    1,  -17 },   // 0xBC
+  {  4048,  23,  18,  23,    1,  -17 },   // 0xBD
+  {  4100,  23,  18,  23,    0,  -17 },   // 0xBE
+  {  4152,   9,  18,  13,    1,  -12 },   // 0xBF
+  {  4173,  16,  22,  16,   -1,  -21 },   // 0xC0
+  {  4217,  16,  22,  16,   -1,  -21 },   // 0xC1
+  {  4261,  16,  22,  16,   -1,  -21 },   // 0xC2
+  {  4305,  16,  21,  16,   -1,  -20 },   // 0xC3
+  {  4347,  16,  21,  16,   -1,  -20 },   // 0xC4
+  {  4389,  16,  22,  16,   -1,  -21 },   // 0xC5
+  {  4433,  25,  18,  23,   -1,  -17 },   // 0xC6
+  {  4490,  16,  23,  17,    1,  -17 },   // 0xC7
+  {  4536,  14,  22,  15,    1,  -21 },   // 0xC8
+  {  4575,  14,  22,  15,    1,  -21 },   // 0xC9
+  {  4614,  14,  22,  15,    1,  -21 },   // 0xCA
+  {  4653,  14,  21,  15,    1,  -20 },   // 0xCB
+  {  4690,   6,  22,   7,    1,  -21 },   // 0xCC
+  {  4707,   8,  22,   7,    1,  -21 },   // 0xCD
+  {  4729,   8,  22,   7,    1,  -21 },   // 0xCE
+  {  4751,   9,  21,   7,    1,  -20 },   // 0xCF
+  {  4775,  18,  18,  19,    0,  -17 },   // 0xD0
+  {  4816,  17,  21,  18,    1,  -20 },   // 0xD1
+  {  4861,  17,  22,  19,    1,  -21 },   // 0xD2
+  {  4908,  17,  22,  19,    1,  -21 },   // 0xD3
+  {  4955,  17,  22,  19,    1,  -21 },   // 0xD4
+  {  5002,  17,  21,  19,    1,  -20 },   // 0xD5
+  {  5047,  17,  21,  19,    1,  -20 },   // 0xD6
+  {  5092,  14,  14,  20,    3,  -13 },   // 0xD7
+  {  5117,  21,  18,  19,   -1,  -17 },   // 0xD8
+  {  5165,  15,  22,  18,    1,  -21 },   // 0xD9
+  {  5207,  15,  22,  18,    1,  -21 },   // 0xDA
+  {  5249,  15,  22,  18,    1,  -21 },   // 0xDB
+  {  5291,  15,  21,  18,    1,  -20 },   // 0xDC
+  {  5331,  15,  22,  15,    1,  -21 },   // 0xDD
+  {  5373,  13,  18,  15,    1,  -17 },   // 0xDE
+  {  5403,  13,  18,  15,    1,  -17 },   // 0xDF
+  {  5433,  12,  19,  14,    1,  -18 },   // 0xE0
+  {  5462,  12,  19,  14,    1,  -18 },   // 0xE1
+  {  5491,  12,  19,  14,    1,  -18 },   // 0xE2
+  {  5520,  12,  19,  14,    1,  -18 },   // 0xE3
+  {  5549,  12,  18,  14,    1,  -17 },   // 0xE4
+  {  5576,  12,  21,  14,    1,  -20 },   // 0xE5
+  {  5608,  22,  13,  24,    1,  -12 },   // 0xE6
+  {  5644,  12,  18,  13,    1,  -12 },   // 0xE7
+  {  5671,  12,  19,  14,    1,  -18 },   // 0xE8
+  {  5700,  12,  19,  14,    1,  -18 },   // 0xE9
+  {  5729,  12,  19,  14,    1,  -18 },   // 0xEA
+  {  5758,  12,  18,  14,    1,  -17 },   // 0xEB
+  {  5785,   6,  19,   7,    1,  -18 },   // 0xEC
+  {  5800,   8,  19,   7,    1,  -18 },   // 0xED
+  {  5819,   7,  19,   7,    1,  -18 },   // 0xEE
+  {  5836,   8,  18,   7,    1,  -17 },   // 0xEF
+  {  5854,  13,  18,  15,    1,  -17 },   // 0xF0
+  {  5884,  13,  19,  15,    1,  -18 },   // 0xF1
+  {  5915,  12,  19,  14,    1,  -18 },   // 0xF2
+  {  5944,  12,  19,  14,    1,  -18 },   // 0xF3
+  {  5973,  12,  19,  14,    1,  -18 },   // 0xF4
+  {  6002,  12,  19,  14,    1,  -18 },   // 0xF5
+  {  6031,  12,  18,  14,    1,  -17 },   // 0xF6
+  {  6058,  15,  12,  20,    3,  -13 },   // 0xF7
+  {  6081,  14,  15,  15,    0,  -13 },   // 0xF8
+  {  6108,  13,  19,  15,    1,  -18 },   // 0xF9
+  {  6139,  13,  19,  15,    1,  -18 },   // 0xFA
+  {  6170,  13,  19,  15,    1,  -18 },   // 0xFB
+  {  6201,  13,  18,  15,    1,  -17 },   // 0xFC
+  {  6231,  15,  24,  14,   -1,  -18 },   // 0xFD
+  {  6276,  14,  23,  15,    0,  -17 },   // 0xFE
+  {  6317,  15,  23,  14,   -1,  -17 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique12pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique12pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique12pt8bGlyphs,
+  0x20, 0xFF, 27 };
+
+// Approx. 7936 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique12pt8bMetrics[] PROGMEM = {
+  {   0,   8,   1 },   // 0x20
+  {   2,  10,   8 },   // 0x21
+  {   2,  11,   8 },   // 0x22
+  {   2,  20,  19 },   // 0x23
+  {   1,  15,  14 },   // 0x24
+  {   2,  23,  20 },   // 0x25
+  {   1,  19,  18 },   // 0x26
+  {   2,   7,   4 },   // 0x27
+  {   2,   9,  10 },   // 0x28
+  {  -1,   9,   7 },   // 0x29
+  {   0,  12,  11 },   // 0x2A
+  {   3,  20,  19 },   // 0x2B
+  {   1,   8,   4 },   // 0x2C
+  {   1,   9,   8 },   // 0x2D
+  {   1,   8,   3 },   // 0x2E
+  {  -2,   8,  10 },   // 0x2F
+  {   2,  15,  15 },   // 0x30
+  {   1,  15,  11 },   // 0x31
+  {   0,  15,  14 },   // 0x32
+  {   0,  15,  14 },   // 0x33
+  {   0,  15,  13 },   // 0x34
+  {   0,  15,  13 },   // 0x35
+  {   2,  15,  15 },   // 0x36
+  {   2,  15,  15 },   // 0x37
+  {   1,  15,  14 },   // 0x38
+  {   2,  15,  14 },   // 0x39
+  {   1,   8,   5 },   // 0x3A
+  {   1,   8,   6 },   // 0x3B
+  {   3,  20,  18 },   // 0x3C
+  {   3,  20,  18 },   // 0x3D
+  {   3,  20,  18 },   // 0x3E
+  {   3,  13,  12 },   // 0x3F
+  {   1,  24,  22 },   // 0x40
+  {  -1,  16,  15 },   // 0x41
+  {   1,  16,  15 },   // 0x42
+  {   1,  17,  17 },   // 0x43
+  {   1,  18,  18 },   // 0x44
+  {   1,  15,  15 },   // 0x45
+  {   1,  14,  14 },   // 0x46
+  {   1,  19,  17 },   // 0x47
+  {   1,  18,  18 },   // 0x48
+  {   1,   7,   7 },   // 0x49
+  {  -4,   7,   6 },   // 0x4A
+  {   1,  16,  18 },   // 0x4B
+  {   1,  13,  12 },   // 0x4C
+  {   1,  21,  20 },   // 0x4D
+  {   1,  18,  18 },   // 0x4E
+  {   1,  19,  18 },   // 0x4F
+  {   1,  14,  15 },   // 0x50
+  {   1,  19,  18 },   // 0x51
+  {   1,  17,  15 },   // 0x52
+  {   0,  15,  14 },   // 0x53
+  {   1,  15,  16 },   // 0x54
+  {   1,  18,  16 },   // 0x55
+  {   2,  16,  18 },   // 0x56
+  {   2,  24,  24 },   // 0x57
+  {  -1,  16,  17 },   // 0x58
+  {   1,  15,  16 },   // 0x59
+  {  -1,  16,  16 },   // 0x5A
+  {   1,   9,  10 },   // 0x5B
+  {   2,   8,   6 },   // 0x5C
+  {  -1,   9,   8 },   // 0x5D
+  {   3,  20,  18 },   // 0x5E
+  {   0,  12,  12 },   // 0x5F
+  {   5,  12,  10 },   // 0x60
+  {   1,  14,  13 },   // 0x61
+  {   1,  15,  14 },   // 0x62
+  {   1,  13,  13 },   // 0x63
+  {   1,  15,  15 },   // 0x64
+  {   1,  14,  13 },   // 0x65
+  {   2,   8,  12 },   // 0x66
+  {   1,  15,  14 },   // 0x67
+  {   1,  15,  14 },   // 0x68
+  {   1,   7,   7 },   // 0x69
+  {  -3,   7,   6 },   // 0x6A
+  {   1,  14,  15 },   // 0x6B
+  {   1,   7,   7 },   // 0x6C
+  {   1,  24,  23 },   // 0x6D
+  {   1,  15,  14 },   // 0x6E
+  {   1,  14,  13 },   // 0x6F
+  {   0,  15,  14 },   // 0x70
+  {   1,  15,  14 },   // 0x71
+  {   1,  10,  11 },   // 0x72
+  {   0,  13,  12 },   // 0x73
+  {   2,   9,  10 },   // 0x74
+  {   1,  15,  14 },   // 0x75
+  {   2,  14,  15 },   // 0x76
+  {   2,  20,  20 },   // 0x77
+  {  -1,  14,  14 },   // 0x78
+  {  -1,  14,  14 },   // 0x79
+  {   0,  13,  13 },   // 0x7A
+  {   3,  15,  14 },   // 0x7B
+  {   3,   8,   5 },   // 0x7C
+  {   0,  15,  11 },   // 0x7D
+  {   3,  20,  18 },   // 0x7E
+  {   1,  14,  13 },   // 0x7F
+  {   1,  14,  13 },   // 0x80
+  {   1,  14,  13 },   // 0x81
+  {   1,  14,  13 },   // 0x82
+  {   1,  14,  13 },   // 0x83
+  {   1,  14,  13 },   // 0x84
+  {   1,  14,  13 },   // 0x85
+  {   1,  14,  13 },   // 0x86
+  {   1,  14,  13 },   // 0x87
+  {   1,  14,  13 },   // 0x88
+  {   1,  14,  13 },   // 0x89
+  {   1,  14,  13 },   // 0x8A
+  {   1,  14,  13 },   // 0x8B
+  {   1,  14,  13 },   // 0x8C
+  {   1,  14,  13 },   // 0x8D
+  {   1,  14,  13 },   // 0x8E
+  {   1,  14,  13 },   // 0x8F
+  {   1,  14,  13 },   // 0x90
+  {   1,  14,  13 },   // 0x91
+  {   1,  14,  13 },   // 0x92
+  {   1,  14,  13 },   // 0x93
+  {   1,  14,  13 },   // 0x94
+  {   1,  14,  13 },   // 0x95
+  {   1,  14,  13 },   // 0x96
+  {   1,  14,  13 },   // 0x97
+  {   1,  14,  13 },   // 0x98
+  {   1,  14,  13 },   // 0x99
+  {   1,  14,  13 },   // 0x9A
+  {   1,  14,  13 },   // 0x9B
+  {   1,  14,  13 },   // 0x9C
+  {   1,  14,  13 },   // 0x9D
+  {   1,  14,  13 },   // 0x9E
+  {   1,  14,  13 },   // 0x9F
+  {   0,   8,   1 },   // 0xA0
+  {   2,  10,   8 },   // 0xA1
+  {   2,  15,  14 },   // 0xA2
+  {   1,  15,  15 },   // 0xA3
+  {   1,  15,  15 },   // 0xA4
+  {   1,  15,  16 },   // 0xA5
+  {   3,   8,   5 },   // 0xA6
+  {   0,  12,  12 },   // 0xA7
+  {   4,  12,  12 },   // 0xA8
+  {   3,  24,  20 },   // 0xA9
+  {   1,  11,  11 },   // 0xAA
+  {   1,  15,  14 },   // 0xAB
+  {   3,  20,  18 },   // 0xAC
+  {   1,   9,   8 },   // 0xAD
+  {   3,  24,  20 },   // 0xAE
+  {   4,  11,  11 },   // 0xAF
+  {   2,  12,   9 },   // 0xB0
+  {   2,  20,  18 },   // 0xB1
+  {   1,  10,  10 },   // 0xB2
+  {   0,  10,   8 },   // 0xB3
+  {   6,  12,  12 },   // 0xB4
+  {   0,  15,  15 },   // 0xB5
+  {   2,  15,  14 },   // 0xB6
+  {   3,   8,   5 },   // 0xB7
+  {   1,  12,   6 },   // 0xB8
+  {   1,  10,   9 },   // 0xB9
+  {   1,  11,  11 },   // 0xBA
+  {   1,  15,  14 },   // 0xBB
+  {   1,  23,  23 },   // 0xBC
+  {   1,  23,  24 },   // 0xBD
+  {   0,  23,  23 },   // 0xBE
+  {   1,  13,  10 },   // 0xBF
+  {  -1,  16,  15 },   // 0xC0
+  {  -1,  16,  15 },   // 0xC1
+  {  -1,  16,  15 },   // 0xC2
+  {  -1,  16,  15 },   // 0xC3
+  {  -1,  16,  15 },   // 0xC4
+  {  -1,  16,  15 },   // 0xC5
+  {  -1,  23,  24 },   // 0xC6
+  {   1,  17,  17 },   // 0xC7
+  {   1,  15,  15 },   // 0xC8
+  {   1,  15,  15 },   // 0xC9
+  {   1,  15,  15 },   // 0xCA
+  {   1,  15,  15 },   // 0xCB
+  {   1,   7,   7 },   // 0xCC
+  {   1,   7,   9 },   // 0xCD
+  {   1,   7,   9 },   // 0xCE
+  {   1,   7,  10 },   // 0xCF
+  {   0,  19,  18 },   // 0xD0
+  {   1,  18,  18 },   // 0xD1
+  {   1,  19,  18 },   // 0xD2
+  {   1,  19,  18 },   // 0xD3
+  {   1,  19,  18 },   // 0xD4
+  {   1,  19,  18 },   // 0xD5
+  {   1,  19,  18 },   // 0xD6
+  {   3,  20,  17 },   // 0xD7
+  {  -1,  19,  20 },   // 0xD8
+  {   1,  18,  16 },   // 0xD9
+  {   1,  18,  16 },   // 0xDA
+  {   1,  18,  16 },   // 0xDB
+  {   1,  18,  16 },   // 0xDC
+  {   1,  15,  16 },   // 0xDD
+  {   1,  15,  14 },   // 0xDE
+  {   1,  15,  14 },   // 0xDF
+  {   1,  14,  13 },   // 0xE0
+  {   1,  14,  13 },   // 0xE1
+  {   1,  14,  13 },   // 0xE2
+  {   1,  14,  13 },   // 0xE3
+  {   1,  14,  13 },   // 0xE4
+  {   1,  14,  13 },   // 0xE5
+  {   1,  24,  23 },   // 0xE6
+  {   1,  13,  13 },   // 0xE7
+  {   1,  14,  13 },   // 0xE8
+  {   1,  14,  13 },   // 0xE9
+  {   1,  14,  13 },   // 0xEA
+  {   1,  14,  13 },   // 0xEB
+  {   1,   7,   7 },   // 0xEC
+  {   1,   7,   9 },   // 0xED
+  {   1,   7,   8 },   // 0xEE
+  {   1,   7,   9 },   // 0xEF
+  {   1,  15,  14 },   // 0xF0
+  {   1,  15,  14 },   // 0xF1
+  {   1,  14,  13 },   // 0xF2
+  {   1,  14,  13 },   // 0xF3
+  {   1,  14,  13 },   // 0xF4
+  {   1,  14,  13 },   // 0xF5
+  {   1,  14,  13 },   // 0xF6
+  {   3,  20,  18 },   // 0xF7
+  {   0,  15,  14 },   // 0xF8
+  {   1,  15,  14 },   // 0xF9
+  {   1,  15,  14 },   // 0xFA
+  {   1,  15,  14 },   // 0xFB
+  {   1,  15,  14 },   // 0xFC
+  {  -1,  14,  14 },   // 0xFD
+  {   0,  15,  14 },   // 0xFE
+  {  -1,  14,  14 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique12pt8bWidths = { DejaVuSans_Oblique12pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE12PTLAT1__H
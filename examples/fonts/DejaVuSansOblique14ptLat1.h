@@ -0,0 +1,1148 @@
+#ifndef DEJAVUSANSOBLIQUE14PTLAT1__H
+#define DEJAVUSANSOBLIQUE14PTLAT1__H
+const uint8_t DejaVuSans_Oblique14pt8bBitmaps[] PROGMEM = {
+  0x00, 0x0E, 0x1C, 0x78, 0xE1, 0xC3, 0x87, 0x1C, 0x38, 0x70, 0xE1, 0x83,
+  0x0E, 0x00, 0x00, 0x01, 0xC3, 0x87, 0x00, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+  0xF1, 0x80, 0x00, 0xC3, 0x00, 0x38, 0xE0, 0x06, 0x18, 0x00, 0xC3, 0x00,
+  0x18, 0x60, 0x7F, 0xFF, 0xCF, 0xFF, 0xF8, 0x18, 0x60, 0x03, 0x0C, 0x00,
+  0xC3, 0x00, 0x18, 0x60, 0x7F, 0xFF, 0xCF, 0xFF, 0xF8, 0x18, 0x60, 0x03,
+  0x0C, 0x00, 0x61, 0x80, 0x1C, 0x70, 0x03, 0x0C, 0x00, 0x00, 0x40, 0x03,
+  0x00, 0x08, 0x00, 0xFE, 0x0F, 0xFC, 0x72, 0x33, 0x88, 0x0E, 0x20, 0x39,
+  0x00, 0xF4, 0x01, 0xF0, 0x03, 0xF8, 0x03, 0xF0, 0x05, 0xE0, 0x23, 0x80,
+  0x8E, 0x02, 0x39, 0x09, 0xCF, 0xFE, 0x0F, 0xE0, 0x06, 0x00, 0x10, 0x00,
+  0x40, 0x01, 0x00, 0x1E, 0x00, 0x71, 0xF8, 0x03, 0x18, 0xE0, 0x31, 0xC3,
+  0x03, 0x0C, 0x18, 0x30, 0x60, 0xC3, 0x03, 0x06, 0x38, 0x18, 0x61, 0x80,
+  0xE7, 0x18, 0x03, 0xF1, 0x8F, 0x0F, 0x18, 0xFC, 0x01, 0xCE, 0x70, 0x0C,
+  0xE1, 0x80, 0xC6, 0x0C, 0x0C, 0x30, 0x60, 0xC1, 0x83, 0x0C, 0x0C, 0x30,
+  0xE0, 0x73, 0x86, 0x01, 0xF8, 0x60, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x7F,
+  0x80, 0x1C, 0x10, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0xC0,
+  0x00, 0x38, 0x00, 0x0F, 0x80, 0x07, 0xF8, 0x1C, 0xE7, 0x83, 0x38, 0x70,
+  0xEE, 0x0F, 0x1D, 0xC0, 0xF7, 0x38, 0x0F, 0xC7, 0x00, 0xF0, 0xF0, 0x1E,
+  0x0F, 0x0F, 0xE0, 0xFF, 0xFC, 0x0F, 0xF3, 0xC0, 0xFF, 0xFC, 0x01, 0xC0,
+  0xE0, 0x70, 0x18, 0x0E, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0x1C, 0x07, 0x03,
+  0xC0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x01, 0x80, 0x70,
+  0x1C, 0x03, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x38, 0x0E, 0x01, 0x80, 0x70,
+  0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xC0, 0xE0, 0x38, 0x1C,
+  0x07, 0x03, 0x80, 0xE0, 0x70, 0x18, 0x0E, 0x07, 0x03, 0x80, 0x06, 0x00,
+  0x60, 0xC6, 0x3E, 0x67, 0x3F, 0xC0, 0xF0, 0x0F, 0x03, 0xFC, 0xE6, 0x7C,
+  0x63, 0x06, 0x00, 0x60, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x39, 0xCE, 0xE6, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x18, 0x01,
+  0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x70, 0x03, 0x00, 0x38, 0x01, 0x80,
+  0x1C, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x30, 0x03, 0x80, 0x18,
+  0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x70, 0x00, 0x03, 0xE0, 0x1F,
+  0xC0, 0xE3, 0x87, 0x07, 0x38, 0x1C, 0xE0, 0x77, 0x01, 0xDC, 0x07, 0x70,
+  0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x0E, 0xE0, 0x3B, 0x80, 0xEE, 0x07, 0x38,
+  0x1C, 0xE0, 0xE1, 0xC7, 0x83, 0xF8, 0x07, 0xC0, 0x03, 0xE1, 0xFE, 0x18,
+  0xE0, 0x0E, 0x00, 0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x03,
+  0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x07, 0x00, 0x70, 0xFF,
+  0xFF, 0xFF, 0x07, 0xF0, 0x0F, 0xFC, 0x1C, 0x1C, 0x10, 0x0E, 0x00, 0x0E,
+  0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xFF, 0xF8, 0xFF, 0xF0, 0x03, 0xF0, 0x1F, 0xF8, 0x20, 0x78,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x07, 0xF0, 0x0F,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E,
+  0x00, 0x39, 0x81, 0xE3, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0xF0,
+  0x07, 0xC0, 0x3E, 0x01, 0xB8, 0x0C, 0xE0, 0x73, 0x81, 0x9E, 0x0C, 0x70,
+  0x61, 0xC3, 0x07, 0x1C, 0x1C, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xC0, 0x38,
+  0x00, 0xE0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x0F, 0xFE, 0x1F, 0xFC, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0xF0, 0x1F, 0xF0,
+  0x20, 0xF0, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x1C, 0x00, 0x79, 0x81, 0xE3, 0xFF, 0x83, 0xF8, 0x00, 0x01, 0xF8, 0x1F,
+  0xF0, 0xE0, 0xC7, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x00, 0x1C, 0xF0, 0x7F,
+  0xF3, 0xE1, 0xCF, 0x03, 0xBC, 0x0E, 0xE0, 0x3B, 0x80, 0xEE, 0x03, 0xB8,
+  0x1C, 0xE0, 0x71, 0xC3, 0x83, 0xFC, 0x07, 0xC0, 0x7F, 0xFD, 0xFF, 0xF0,
+  0x03, 0x80, 0x1E, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x70, 0x03, 0xC0,
+  0x0E, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0x00,
+  0x38, 0x01, 0xE0, 0x07, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x78,
+  0x79, 0xE0, 0x73, 0x80, 0xE7, 0x01, 0xCE, 0x07, 0x0E, 0x1C, 0x0F, 0xF0,
+  0x3F, 0xE0, 0xE1, 0xE3, 0x81, 0xEE, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x70,
+  0x0E, 0xE0, 0x38, 0xF0, 0xF0, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xF0, 0x0F,
+  0xF0, 0x38, 0x70, 0xE0, 0x71, 0xC0, 0xE7, 0x01, 0xCE, 0x03, 0x9C, 0x07,
+  0x38, 0x1E, 0x70, 0x3C, 0xF0, 0xF8, 0xFF, 0xE0, 0xF9, 0xC0, 0x03, 0x00,
+  0x0E, 0x00, 0x18, 0x00, 0x70, 0x83, 0xC1, 0xFF, 0x01, 0xF0, 0x00, 0x1C,
+  0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE3, 0x80, 0x0E, 0x1C,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC3, 0x87, 0x1C, 0x30,
+  0xC0, 0x00, 0x00, 0x80, 0x03, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03,
+  0xF0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
+  0x00, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00,
+  0x78, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x0F,
+  0x00, 0x04, 0x00, 0x00, 0x1F, 0x1F, 0xEC, 0x3E, 0x07, 0x01, 0xC0, 0x70,
+  0x38, 0x1E, 0x0F, 0x07, 0x83, 0xC0, 0xE0, 0x78, 0x1C, 0x07, 0x00, 0x00,
+  0x00, 0x3C, 0x0E, 0x03, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xF0, 0x03,
+  0xE0, 0x78, 0x07, 0x00, 0x1C, 0x0E, 0x00, 0x0E, 0x1C, 0x00, 0x06, 0x38,
+  0x3E, 0xC3, 0x30, 0x7F, 0xC3, 0x60, 0xE3, 0xC3, 0x61, 0x81, 0xC3, 0xE3,
+  0x81, 0xC3, 0xC3, 0x01, 0x83, 0xC3, 0x01, 0x86, 0xC3, 0x01, 0x86, 0xC3,
+  0x03, 0x8C, 0xC3, 0x87, 0xB8, 0xC1, 0xFD, 0xF0, 0x60, 0xFB, 0x80, 0x60,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x80, 0x1E, 0x07, 0x80, 0x0F,
+  0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x03, 0xE0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x0E, 0xE0, 0x07, 0x9C, 0x03,
+  0xC7, 0x00, 0xE1, 0xC0, 0x78, 0x70, 0x1C, 0x1C, 0x0F, 0x03, 0x83, 0xFF,
+  0xE1, 0xFF, 0xF8, 0x70, 0x0E, 0x38, 0x03, 0x9E, 0x00, 0xF7, 0x00, 0x1F,
+  0xC0, 0x07, 0x0F, 0xFC, 0x0F, 0xFE, 0x1E, 0x0F, 0x1C, 0x07, 0x1C, 0x07,
+  0x1C, 0x07, 0x1C, 0x0E, 0x3C, 0x1E, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x1C,
+  0x38, 0x0E, 0x78, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x1C,
+  0xF0, 0x3C, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0xF8,
+  0x3C, 0x78, 0x03, 0x1C, 0x00, 0x4E, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38,
+  0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x02, 0x0F, 0x03, 0x81, 0xFF,
+  0xE0, 0x1F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x78, 0x1E, 0x0E, 0x00,
+  0xE1, 0xC0, 0x1C, 0x38, 0x01, 0xC7, 0x00, 0x39, 0xE0, 0x07, 0x38, 0x00,
+  0xE7, 0x00, 0x1C, 0xE0, 0x03, 0x9C, 0x00, 0x77, 0x80, 0x1C, 0xE0, 0x03,
+  0x9C, 0x00, 0xE3, 0x80, 0x3C, 0x70, 0x0F, 0x1E, 0x07, 0xC3, 0xFF, 0xE0,
+  0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x1E, 0x00, 0x1C, 0x00, 0x1C,
+  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x38,
+  0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0xFE, 0x1F, 0xFC, 0x78,
+  0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x3F, 0xF8,
+  0x7F, 0xE0, 0xE0, 0x01, 0xC0, 0x07, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x01, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0xFF, 0xE0, 0xF8, 0x3C, 0x78, 0x03, 0x1C, 0x00, 0x8E, 0x00, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x03, 0xFB, 0x80, 0xFE,
+  0xE0, 0x07, 0xB8, 0x01, 0xCE, 0x00, 0x73, 0xC0, 0x1C, 0x70, 0x07, 0x0F,
+  0x07, 0xC1, 0xFF, 0xE0, 0x3F, 0xC0, 0x0E, 0x00, 0xE1, 0xC0, 0x1C, 0x78,
+  0x07, 0x8E, 0x00, 0xE1, 0xC0, 0x1C, 0x38, 0x03, 0x87, 0x00, 0x71, 0xE0,
+  0x1E, 0x3F, 0xFF, 0x87, 0xFF, 0xF0, 0xE0, 0x0E, 0x1C, 0x01, 0xC7, 0x80,
+  0x78, 0xE0, 0x0E, 0x1C, 0x01, 0xC3, 0x80, 0x38, 0x70, 0x07, 0x1E, 0x01,
+  0xE3, 0x80, 0x38, 0x70, 0x07, 0x00, 0x0E, 0x1C, 0x78, 0xE1, 0xC3, 0x87,
+  0x1E, 0x38, 0x70, 0xE1, 0xC7, 0x8E, 0x1C, 0x38, 0x71, 0xE3, 0x87, 0x00,
+  0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1E,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38,
+  0x03, 0x80, 0x78, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x1E, 0x0F, 0xC0,
+  0xF0, 0x00, 0x0E, 0x01, 0xC1, 0xC0, 0x70, 0x78, 0x1C, 0x0E, 0x07, 0x01,
+  0xC3, 0x80, 0x38, 0xE0, 0x07, 0x38, 0x01, 0xEE, 0x00, 0x3F, 0x80, 0x07,
+  0xE0, 0x00, 0xFE, 0x00, 0x1D, 0xE0, 0x07, 0x9C, 0x00, 0xE3, 0xC0, 0x1C,
+  0x3C, 0x03, 0x83, 0xC0, 0x70, 0x3C, 0x1E, 0x03, 0x83, 0x80, 0x78, 0x70,
+  0x07, 0x80, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x07, 0x80, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F,
+  0x00, 0x7C, 0x3C, 0x01, 0xF1, 0xF0, 0x0F, 0xC7, 0xC0, 0x3E, 0x1F, 0x81,
+  0xB8, 0x76, 0x06, 0xE1, 0xD8, 0x33, 0x8F, 0x61, 0xDE, 0x39, 0x86, 0x70,
+  0xE6, 0x39, 0xC3, 0x8C, 0xC7, 0x0E, 0x37, 0x1C, 0x78, 0xD8, 0xF1, 0xC3,
+  0xC3, 0x87, 0x0F, 0x0E, 0x1C, 0x38, 0x38, 0x70, 0x00, 0xE3, 0xC0, 0x07,
+  0x8E, 0x00, 0x1C, 0x38, 0x00, 0x70, 0x0E, 0x00, 0xE1, 0xE0, 0x1C, 0x7C,
+  0x07, 0x8F, 0x80, 0xE1, 0xF8, 0x1C, 0x3B, 0x03, 0x87, 0x60, 0x71, 0xEC,
+  0x1E, 0x38, 0xC3, 0x87, 0x18, 0x70, 0xE3, 0x0E, 0x1C, 0x31, 0xC7, 0x86,
+  0x78, 0xE0, 0xCE, 0x1C, 0x19, 0xC3, 0x81, 0xB8, 0x70, 0x37, 0x1E, 0x07,
+  0xE3, 0x80, 0x78, 0x70, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xE0, 0x3E,
+  0x1E, 0x0F, 0x00, 0xE1, 0xC0, 0x1C, 0x70, 0x01, 0xDC, 0x00, 0x3B, 0x80,
+  0x07, 0x70, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xEE, 0x00,
+  0x1D, 0xC0, 0x03, 0xB8, 0x00, 0xE3, 0x80, 0x38, 0x70, 0x0F, 0x07, 0x87,
+  0xC0, 0x7F, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xFE, 0x1E, 0x0E,
+  0x1C, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x3C, 0x07, 0x38, 0x0E,
+  0x38, 0x1C, 0x3F, 0xF8, 0x3F, 0xE0, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xFC,
+  0x00, 0x7F, 0xE0, 0x3E, 0x1E, 0x0F, 0x00, 0xE1, 0xC0, 0x1C, 0x70, 0x01,
+  0xDC, 0x00, 0x3B, 0x80, 0x07, 0x70, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0xFE, 0x00, 0x1D, 0xC0, 0x03, 0xB8, 0x00, 0xE3, 0x80, 0x3C,
+  0x70, 0x0F, 0x07, 0x87, 0xC0, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0x07, 0x80,
+  0x00, 0x70, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x1F, 0xF8, 0x78, 0x78, 0xE0,
+  0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x9E, 0x0E, 0x38, 0x38, 0x7F, 0xE0,
+  0xFF, 0x81, 0xC3, 0x87, 0x83, 0x8E, 0x07, 0x1C, 0x0E, 0x38, 0x0C, 0x70,
+  0x1D, 0xE0, 0x3B, 0x80, 0x77, 0x00, 0x70, 0x00, 0xFE, 0x03, 0xFF, 0x07,
+  0x07, 0x0E, 0x01, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x1F,
+  0xE0, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x0E, 0x80, 0x1C, 0xF0, 0x78, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+  0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x1C, 0x01, 0xC7, 0x00, 0x73, 0x80,
+  0x3C, 0xE0, 0x0E, 0x38, 0x03, 0x8E, 0x00, 0xE3, 0x80, 0x39, 0xC0, 0x1E,
+  0x70, 0x07, 0x1C, 0x01, 0xC7, 0x00, 0x73, 0xC0, 0x1C, 0xE0, 0x0F, 0x38,
+  0x03, 0x8E, 0x00, 0xE3, 0x80, 0x78, 0xF0, 0x1C, 0x1E, 0x1E, 0x03, 0xFF,
+  0x00, 0x7F, 0x00, 0xE0, 0x03, 0xF8, 0x00, 0xEE, 0x00, 0x79, 0xC0, 0x1C,
+  0x70, 0x0E, 0x1C, 0x07, 0x87, 0x01, 0xC1, 0xC0, 0xF0, 0x78, 0x38, 0x0E,
+  0x1E, 0x03, 0x87, 0x00, 0xE3, 0x80, 0x39, 0xE0, 0x0E, 0x70, 0x01, 0xFC,
+  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0xE0, 0x1C, 0x07, 0xF0, 0x0E, 0x03, 0xB8, 0x0F, 0x01, 0xDC, 0x07, 0x81,
+  0xCE, 0x06, 0xC0, 0xE7, 0x03, 0x60, 0xF3, 0x83, 0xB0, 0x71, 0xC1, 0x98,
+  0x78, 0x71, 0xCC, 0x38, 0x38, 0xC6, 0x1C, 0x1C, 0x63, 0x1C, 0x0E, 0x61,
+  0x8E, 0x07, 0x30, 0xCF, 0x03, 0xB0, 0x37, 0x01, 0xD8, 0x1F, 0x80, 0xFC,
+  0x0F, 0x80, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xC0, 0x1E, 0x01, 0xE0, 0x0F,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0xF0, 0x78, 0x1E, 0x03, 0x83, 0xC0, 0x3C,
+  0x78, 0x01, 0xCF, 0x00, 0x1F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00,
+  0x78, 0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xDC, 0x00,
+  0x79, 0xC0, 0x07, 0x8E, 0x00, 0xF0, 0xE0, 0x1E, 0x07, 0x03, 0xC0, 0x70,
+  0x78, 0x07, 0x8F, 0x00, 0x38, 0xF0, 0x0F, 0x38, 0x0F, 0x1E, 0x07, 0x07,
+  0x07, 0x83, 0x87, 0x80, 0xE7, 0x80, 0x77, 0x80, 0x1F, 0x80, 0x0F, 0x80,
+  0x03, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00,
+  0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07,
+  0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F,
+  0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F,
+  0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xF8, 0x07, 0xE0, 0xFC, 0x38, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x3F, 0x07, 0xE0, 0xC6,
+  0x39, 0xC6, 0x31, 0x8C, 0x63, 0x9C, 0x63, 0x18, 0xC6, 0x31, 0xC6, 0x31,
+  0x8C, 0x07, 0xE0, 0xFC, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x0C,
+  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x1C, 0x3F, 0x07, 0xE0, 0x01, 0xC0,
+  0x01, 0xF0, 0x01, 0xDC, 0x01, 0xC7, 0x01, 0xC1, 0xC1, 0x80, 0x31, 0x80,
+  0x0C, 0xFF, 0xFF, 0xFF, 0xF0, 0xE3, 0x0C, 0x61, 0x80, 0x07, 0xF0, 0x7F,
+  0xE1, 0x83, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0xFF, 0xCF, 0xFF, 0x78,
+  0x3B, 0x80, 0xEE, 0x07, 0xB8, 0x1C, 0xF1, 0xF1, 0xFD, 0xC3, 0xE7, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x3C, 0x0F, 0xFE, 0x3E, 0x1C, 0x78, 0x3C, 0xF0, 0x39, 0xC0, 0x73, 0x80,
+  0xEF, 0x01, 0xDC, 0x03, 0xB8, 0x0E, 0x70, 0x1C, 0xE0, 0x73, 0xE1, 0xC7,
+  0x7F, 0x0E, 0x7C, 0x00, 0x03, 0xF0, 0x7F, 0xC7, 0x82, 0x70, 0x07, 0x00,
+  0x38, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x07,
+  0x82, 0x3F, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00,
+  0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x07, 0xCE, 0x0F, 0xEE, 0x1C, 0x3C, 0x38,
+  0x3C, 0x70, 0x1C, 0x70, 0x1C, 0xE0, 0x1C, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+  0x38, 0xE0, 0x78, 0xF0, 0x78, 0x70, 0xF0, 0x7F, 0xF0, 0x3E, 0x70, 0x03,
+  0xE0, 0x3F, 0xE1, 0xC3, 0x8E, 0x07, 0x70, 0x1D, 0xC0, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x78, 0x31, 0xFF, 0x81,
+  0xFC, 0x00, 0x03, 0xE1, 0xFC, 0x38, 0x0F, 0x01, 0xC0, 0x38, 0x3F, 0xE7,
+  0xFC, 0x1C, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x00, 0x07, 0xCE, 0x1F, 0xDC, 0x70,
+  0xF9, 0xC0, 0xE7, 0x01, 0xCE, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0xE0, 0x39,
+  0xC0, 0x73, 0x80, 0xE7, 0x03, 0xC7, 0x0F, 0x8F, 0xFE, 0x07, 0x9C, 0x00,
+  0x38, 0x00, 0xF0, 0x01, 0xC2, 0x0F, 0x07, 0xFC, 0x07, 0xE0, 0x00, 0x0E,
+  0x00, 0x38, 0x00, 0xE0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xCF, 0x07,
+  0xFE, 0x3E, 0x3C, 0xF0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1D, 0xC0, 0xF7,
+  0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0, 0xEF, 0x07, 0xB8, 0x1C, 0xE0, 0x70,
+  0x0E, 0x1C, 0x38, 0x00, 0x00, 0x07, 0x0E, 0x3C, 0x70, 0xE1, 0xC3, 0x8F,
+  0x1C, 0x38, 0x70, 0xE3, 0xC7, 0x0E, 0x00, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x1C, 0x1F, 0x83, 0xC0, 0x00, 0x0E, 0x00, 0x0E,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x3E, 0x1C,
+  0x7C, 0x38, 0xF8, 0x3B, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0x7F,
+  0x00, 0x77, 0x80, 0x77, 0x80, 0x73, 0xC0, 0x71, 0xE0, 0xF0, 0xF0, 0xE0,
+  0x78, 0xE0, 0x3C, 0x0E, 0x1C, 0x38, 0xE1, 0xC3, 0x87, 0x0E, 0x38, 0x70,
+  0xE1, 0xC3, 0x8F, 0x1C, 0x38, 0x70, 0xE3, 0xC7, 0x0E, 0x00, 0x1C, 0xF0,
+  0x7C, 0x1F, 0xF8, 0xFE, 0x3E, 0x3F, 0x8F, 0x3C, 0x1E, 0x07, 0x38, 0x1E,
+  0x07, 0x38, 0x1C, 0x07, 0x38, 0x1C, 0x07, 0x78, 0x3C, 0x0F, 0x70, 0x38,
+  0x0E, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0xF0, 0x78,
+  0x1E, 0xE0, 0x70, 0x1C, 0xE0, 0x70, 0x1C, 0x1C, 0xF0, 0x7F, 0xE3, 0xE3,
+  0xCF, 0x07, 0x38, 0x1C, 0xE0, 0x73, 0x81, 0xDE, 0x0F, 0x70, 0x39, 0xC0,
+  0xE7, 0x03, 0x9C, 0x0E, 0xF0, 0x7B, 0x81, 0xCE, 0x07, 0x00, 0x07, 0xE0,
+  0x3F, 0xC1, 0xC3, 0x8E, 0x07, 0x70, 0x1D, 0xC0, 0x7E, 0x01, 0xF8, 0x07,
+  0xE0, 0x1F, 0x80, 0xEE, 0x03, 0xB8, 0x1C, 0x70, 0xE0, 0xFF, 0x01, 0xF8,
+  0x00, 0x0E, 0x7C, 0x0F, 0xFE, 0x0F, 0x0E, 0x1E, 0x07, 0x1E, 0x07, 0x1C,
+  0x07, 0x1C, 0x07, 0x1C, 0x07, 0x38, 0x07, 0x38, 0x0E, 0x38, 0x0E, 0x3C,
+  0x1C, 0x3C, 0x38, 0x77, 0xF0, 0x73, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xCE, 0x1F, 0xDC, 0x70,
+  0xF9, 0xC0, 0xE7, 0x01, 0xCE, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0xE0, 0x39,
+  0xC0, 0x73, 0x80, 0xE7, 0x03, 0xC7, 0x0F, 0x8F, 0xFE, 0x0F, 0x9C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+  0xF1, 0xFF, 0x3F, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x07, 0x80, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x00, 0x07, 0xF0,
+  0x7F, 0xC7, 0x02, 0x70, 0x03, 0x80, 0x1F, 0x00, 0xFF, 0x03, 0xFC, 0x03,
+  0xF0, 0x07, 0x80, 0x1C, 0x00, 0xE4, 0x0E, 0x7F, 0xE0, 0xFE, 0x00, 0x1C,
+  0x0E, 0x0E, 0x07, 0x0F, 0xFF, 0xFC, 0xE0, 0xF0, 0x70, 0x38, 0x1C, 0x0E,
+  0x0F, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x7F, 0x0F, 0x80, 0x38, 0x1C, 0xE0,
+  0x77, 0x83, 0xDC, 0x0E, 0x70, 0x39, 0xC0, 0xE7, 0x03, 0x9C, 0x1E, 0xE0,
+  0x73, 0x81, 0xCE, 0x0F, 0x38, 0x7C, 0xF3, 0xF1, 0xFB, 0x83, 0xCE, 0x00,
+  0xE0, 0x3F, 0x80, 0xEE, 0x07, 0x9C, 0x1C, 0x70, 0xF1, 0xC3, 0x87, 0x1C,
+  0x1C, 0xF0, 0x7B, 0x80, 0xFE, 0x03, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0xF8,
+  0x01, 0xC0, 0x00, 0xE0, 0xE0, 0xFE, 0x0F, 0x0E, 0xE1, 0xF0, 0xEE, 0x1B,
+  0x1C, 0xE3, 0xB1, 0xCE, 0x33, 0x3C, 0xE3, 0x33, 0x87, 0x63, 0x78, 0x76,
+  0x37, 0x07, 0xC3, 0xF0, 0x7C, 0x3E, 0x07, 0xC3, 0xE0, 0x78, 0x3C, 0x07,
+  0x83, 0xC0, 0x70, 0x38, 0x00, 0x0E, 0x0F, 0x87, 0x87, 0x81, 0xC7, 0x80,
+  0x77, 0x80, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x80, 0x03, 0xE0,
+  0x03, 0xF0, 0x03, 0xDC, 0x03, 0xCF, 0x03, 0xE3, 0x83, 0xE1, 0xE3, 0xE0,
+  0x70, 0x1C, 0x07, 0x8E, 0x03, 0x87, 0x83, 0xC1, 0xC1, 0xC0, 0xE1, 0xC0,
+  0x71, 0xE0, 0x38, 0xE0, 0x0E, 0xF0, 0x07, 0x70, 0x03, 0xF8, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0F,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x1F, 0xFE,
+  0x3F, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1F, 0xFE,
+  0x3F, 0xFC, 0x00, 0x00, 0x78, 0x0F, 0xC0, 0x70, 0x07, 0x80, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xFC, 0x0F, 0xC0,
+  0x0F, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0xF0, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x07, 0x80, 0x1F, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0,
+  0x03, 0x80, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x3F,
+  0x00, 0xF8, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x3F, 0x00, 0xF8, 0x00, 0x3F,
+  0x00, 0xBF, 0xE1, 0xF0, 0x7F, 0xD0, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x00, 0x0E, 0x1C, 0x38, 0x00, 0x00, 0x07, 0x0E, 0x18, 0x70,
+  0xE1, 0xC3, 0x8F, 0x1C, 0x38, 0x70, 0xE3, 0x87, 0x00, 0x00, 0x20, 0x01,
+  0x80, 0x06, 0x00, 0x10, 0x03, 0xF8, 0x3F, 0xF1, 0xEC, 0x8E, 0x30, 0x70,
+  0x81, 0xC2, 0x0E, 0x08, 0x38, 0x60, 0xE1, 0x83, 0x84, 0x0E, 0x10, 0x3C,
+  0x40, 0x7B, 0x20, 0xFF, 0x81, 0xFC, 0x00, 0x80, 0x02, 0x00, 0x18, 0x00,
+  0x60, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xC0, 0x3C, 0x20, 0x1C, 0x00, 0x1C,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x0F,
+  0xFF, 0x07, 0xFF, 0x80, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x07, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0x80, 0x40, 0x05, 0xC0,
+  0x1D, 0xDF, 0x71, 0xFF, 0xC1, 0xC7, 0x07, 0x07, 0x0C, 0x06, 0x18, 0x0C,
+  0x30, 0x18, 0x70, 0x70, 0x71, 0xC1, 0xFF, 0xC7, 0x7D, 0xDC, 0x01, 0xD0,
+  0x01, 0x00, 0x1C, 0x03, 0xC7, 0x01, 0xE1, 0xE0, 0x70, 0x38, 0x3C, 0x0E,
+  0x1E, 0x03, 0xC7, 0x00, 0x73, 0x80, 0x1D, 0xE0, 0x7F, 0xFF, 0x1F, 0xFF,
+  0xC0, 0x3E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x1F, 0xFF, 0x8F, 0xFF, 0xE0,
+  0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xF8, 0x0F, 0xF0, 0x38, 0x81, 0xC0,
+  0x07, 0x00, 0x1C, 0x00, 0x30, 0x01, 0xE0, 0x0E, 0xE0, 0x71, 0xC3, 0x87,
+  0x8E, 0x0E, 0x3C, 0x38, 0x79, 0xC0, 0x6E, 0x00, 0x70, 0x01, 0x80, 0x07,
+  0x00, 0x1C, 0x00, 0x70, 0x83, 0x83, 0xFC, 0x07, 0xE0, 0x00, 0xE7, 0xE7,
+  0xE7, 0x01, 0xF8, 0x00, 0x60, 0x60, 0x18, 0x01, 0x83, 0x0F, 0xCC, 0x23,
+  0x82, 0x44, 0x60, 0x02, 0x46, 0x00, 0x28, 0xC0, 0x01, 0x8C, 0x00, 0x18,
+  0xC0, 0x01, 0x8C, 0x00, 0x18, 0xC0, 0x01, 0x8C, 0x00, 0x14, 0x60, 0x02,
+  0x46, 0x00, 0x22, 0x38, 0x24, 0x30, 0xFC, 0xC1, 0x80, 0x18, 0x06, 0x06,
+  0x00, 0x1F, 0x80, 0x0F, 0xC2, 0x1C, 0x01, 0x80, 0x30, 0xFE, 0x60, 0xD8,
+  0x3B, 0x06, 0x61, 0xCE, 0x78, 0xFB, 0x00, 0x0F, 0xF8, 0x02, 0x10, 0x63,
+  0x0E, 0x71, 0x8E, 0x73, 0x8E, 0x70, 0xC7, 0x06, 0x38, 0x31, 0x83, 0x8C,
+  0x18, 0x41, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x60, 0x00, 0x30,
+  0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x01,
+  0xF8, 0x00, 0x60, 0x60, 0x18, 0x01, 0x83, 0x7F, 0x8C, 0x26, 0x0E, 0x44,
+  0x60, 0x62, 0x46, 0x06, 0x28, 0x60, 0xE1, 0x87, 0xF8, 0x18, 0x63, 0x81,
+  0x86, 0x1C, 0x18, 0x61, 0xC1, 0x86, 0x0C, 0x14, 0x60, 0xE2, 0x46, 0x06,
+  0x22, 0x60, 0x64, 0x36, 0x07, 0xC1, 0x80, 0x18, 0x06, 0x06, 0x00, 0x1F,
+  0x80, 0xFF, 0xFF, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0xC0,
+  0x60, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x3F, 0xC0, 0x0F, 0x8C,
+  0x30, 0x0C, 0x06, 0x1E, 0x00, 0xE0, 0x18, 0x06, 0x01, 0xA0, 0xC7, 0xC0,
+  0x0E, 0x38, 0xC3, 0x0C, 0x00, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x1C,
+  0x07, 0x1C, 0x0F, 0x1C, 0x0E, 0x1C, 0x0E, 0x1C, 0x0E, 0x38, 0x0E, 0x38,
+  0x1E, 0x38, 0x1C, 0x38, 0x3C, 0x3C, 0x7C, 0x77, 0xFF, 0x73, 0xCE, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07,
+  0xFC, 0x7F, 0xF3, 0xF8, 0xDF, 0xE3, 0xFF, 0x8B, 0xFC, 0x6F, 0xF1, 0xBF,
+  0xC6, 0xFF, 0x19, 0xFC, 0x43, 0xE3, 0x03, 0x8C, 0x06, 0x30, 0x18, 0xC0,
+  0x62, 0x01, 0x18, 0x0C, 0x60, 0x31, 0x80, 0xC6, 0x03, 0x18, 0x08, 0xC0,
+  0x63, 0x01, 0x8C, 0x00, 0xFF, 0x80, 0x18, 0x30, 0xFF, 0xF8, 0x1E, 0x26,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x18, 0x18, 0xFF, 0x07, 0x83, 0x18,
+  0xC1, 0x98, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x06, 0x60, 0xC6, 0x30, 0x7C,
+  0x00, 0x0F, 0xF8, 0x41, 0x02, 0x18, 0x31, 0xC1, 0x8C, 0x1C, 0x60, 0xE3,
+  0x0E, 0x71, 0xCE, 0x71, 0x8E, 0x70, 0xC6, 0x08, 0x40, 0x1E, 0x00, 0x30,
+  0x4C, 0x00, 0xC0, 0x30, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x38, 0x01,
+  0x80, 0x60, 0x03, 0x01, 0x80, 0x0E, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x30,
+  0x70, 0x1F, 0xFC, 0xC0, 0x78, 0x03, 0x00, 0xB0, 0x0C, 0x03, 0x40, 0x38,
+  0x0D, 0x80, 0xE0, 0x33, 0x01, 0x80, 0xC6, 0x06, 0x03, 0x0C, 0x18, 0x07,
+  0xFC, 0x70, 0x00, 0x61, 0xC0, 0x00, 0xC0, 0x1E, 0x00, 0x30, 0x4C, 0x00,
+  0xC0, 0x30, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x38, 0x01, 0x80, 0x60,
+  0x03, 0x01, 0x80, 0x0E, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x30, 0x70, 0xFB,
+  0xFC, 0xC2, 0x38, 0x03, 0x00, 0x30, 0x0C, 0x00, 0x60, 0x38, 0x01, 0xC0,
+  0xE0, 0x07, 0x01, 0x80, 0x1C, 0x06, 0x00, 0x70, 0x18, 0x01, 0xC0, 0x70,
+  0x0F, 0x01, 0xC0, 0x1F, 0xE0, 0x0F, 0x80, 0x0C, 0x18, 0x60, 0x0C, 0x00,
+  0x30, 0x0C, 0x00, 0x30, 0x0E, 0x01, 0xE0, 0x0E, 0x00, 0x1C, 0x06, 0x00,
+  0x06, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x87, 0x00, 0x41, 0x87, 0x01,
+  0xDF, 0x03, 0x01, 0xE0, 0x03, 0x00, 0xB0, 0x03, 0x00, 0xD0, 0x03, 0x80,
+  0xD8, 0x03, 0x80, 0xCC, 0x01, 0x80, 0xC6, 0x01, 0x80, 0xC3, 0x01, 0x80,
+  0x7F, 0xC1, 0xC0, 0x01, 0x81, 0xC0, 0x00, 0xC0, 0x01, 0xC0, 0xF0, 0x38,
+  0x00, 0x00, 0x01, 0xE0, 0x70, 0x1C, 0x07, 0x03, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x07, 0x03, 0x80, 0xE0, 0x38, 0x1F, 0x0D, 0xFE, 0x3E, 0x00, 0x00,
+  0x38, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xE0,
+  0x03, 0xB8, 0x01, 0xE7, 0x00, 0xF1, 0xC0, 0x38, 0x70, 0x1E, 0x1C, 0x07,
+  0x07, 0x03, 0xC0, 0xE0, 0xFF, 0xF8, 0x7F, 0xFE, 0x1C, 0x03, 0x8E, 0x00,
+  0xE7, 0x80, 0x3D, 0xC0, 0x07, 0xF0, 0x01, 0xC0, 0x00, 0x06, 0x00, 0x03,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0xE0,
+  0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x03, 0xB8, 0x01,
+  0xE7, 0x00, 0xF1, 0xC0, 0x38, 0x70, 0x1E, 0x1C, 0x07, 0x07, 0x03, 0xC0,
+  0xE0, 0xFF, 0xF8, 0x7F, 0xFE, 0x1C, 0x03, 0x8E, 0x00, 0xE7, 0x80, 0x3D,
+  0xC0, 0x07, 0xF0, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x0D, 0x80, 0x06, 0x60,
+  0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF8, 0x00, 0xEE, 0x00, 0x79,
+  0xC0, 0x3C, 0x70, 0x0E, 0x1C, 0x07, 0x87, 0x01, 0xC1, 0xC0, 0xF0, 0x38,
+  0x3F, 0xFE, 0x1F, 0xFF, 0x87, 0x00, 0xE3, 0x80, 0x39, 0xE0, 0x0F, 0x70,
+  0x01, 0xFC, 0x00, 0x70, 0x00, 0x79, 0x80, 0x1F, 0xC0, 0x0C, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x03, 0xB8, 0x01, 0xE7, 0x00, 0xF1, 0xC0,
+  0x38, 0x70, 0x1E, 0x1C, 0x07, 0x07, 0x03, 0xC0, 0xE0, 0xFF, 0xF8, 0x7F,
+  0xFE, 0x1C, 0x03, 0x8E, 0x00, 0xE7, 0x80, 0x3D, 0xC0, 0x07, 0xF0, 0x01,
+  0xC0, 0x00, 0xE7, 0x00, 0x39, 0xC0, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x0F, 0xE0, 0x03, 0xB8, 0x01, 0xE7, 0x00, 0xF1, 0xC0, 0x38, 0x70, 0x1E,
+  0x1C, 0x07, 0x07, 0x03, 0xC0, 0xE0, 0xFF, 0xF8, 0x7F, 0xFE, 0x1C, 0x03,
+  0x8E, 0x00, 0xE7, 0x80, 0x3D, 0xC0, 0x07, 0xF0, 0x01, 0xC0, 0x00, 0x1C,
+  0x00, 0x0F, 0x80, 0x06, 0x30, 0x01, 0x8C, 0x00, 0x63, 0x00, 0x0F, 0x80,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x03,
+  0xB8, 0x01, 0xEE, 0x00, 0x73, 0x80, 0x38, 0x70, 0x1E, 0x1C, 0x07, 0x07,
+  0x03, 0xC1, 0xC0, 0xFF, 0xF8, 0x7F, 0xFE, 0x1C, 0x03, 0x8E, 0x00, 0xE7,
+  0x80, 0x39, 0xC0, 0x07, 0xF0, 0x01, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFF, 0x00, 0x1D, 0xC0, 0x00, 0x03, 0x9C, 0x00, 0x00, 0x79, 0xC0,
+  0x00, 0x07, 0x38, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x0E, 0x38, 0x00, 0x01,
+  0xC3, 0xFF, 0xC0, 0x3C, 0x3F, 0xFC, 0x03, 0x87, 0x80, 0x00, 0x78, 0x70,
+  0x00, 0x0F, 0x07, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x01,
+  0xC0, 0xF0, 0x00, 0x3C, 0x0E, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x70, 0x0F,
+  0xFF, 0x8F, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0xF8, 0x3C,
+  0x78, 0x03, 0x1C, 0x00, 0x4E, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x70,
+  0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x02, 0x0F, 0x03, 0x81, 0xFF, 0xE0,
+  0x1F, 0xE0, 0x01, 0x80, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0x0F, 0xFF, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+  0x1C, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x38, 0x00, 0x38, 0x00,
+  0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00,
+  0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+  0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x38, 0x00,
+  0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0xD8, 0x01, 0x98,
+  0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x1E, 0x00,
+  0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3F, 0xFC,
+  0x3F, 0xFC, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x03, 0x9C,
+  0x03, 0x9C, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFF,
+  0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00,
+  0x3F, 0xFC, 0x3F, 0xFC, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8,
+  0x1C, 0x18, 0x18, 0x00, 0x01, 0xC3, 0x8F, 0x1C, 0x38, 0x70, 0xE3, 0xC7,
+  0x0E, 0x1C, 0x38, 0xF1, 0xC3, 0x87, 0x0E, 0x3C, 0x70, 0xE0, 0x03, 0x03,
+  0x03, 0x00, 0x00, 0x00, 0x70, 0x38, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83,
+  0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xC1,
+  0xC0, 0xE0, 0x00, 0x0E, 0x0D, 0x8C, 0xCC, 0x30, 0x00, 0x00, 0x38, 0x1C,
+  0x1E, 0x0E, 0x07, 0x03, 0x81, 0xC1, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x1E,
+  0x0E, 0x07, 0x03, 0x81, 0xC1, 0xE0, 0xE0, 0x70, 0x00, 0x73, 0xB9, 0xDC,
+  0xE0, 0x00, 0x00, 0x70, 0x38, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xC1,
+  0xC0, 0xE0, 0x70, 0x38, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xC1, 0xC0,
+  0xE0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xF8, 0x0F, 0x03, 0xC0, 0xE0, 0x0E,
+  0x0E, 0x00, 0xE0, 0xE0, 0x07, 0x0E, 0x00, 0x71, 0xE0, 0x07, 0xFF, 0xC0,
+  0x7F, 0xFC, 0x07, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x3C, 0x00, 0xE3, 0x80,
+  0x0E, 0x38, 0x01, 0xC3, 0x80, 0x3C, 0x38, 0x07, 0x87, 0x81, 0xF0, 0x7F,
+  0xFC, 0x07, 0xFE, 0x00, 0x00, 0xF3, 0x00, 0x1F, 0xC0, 0x06, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC3, 0xC0, 0x38, 0xF8, 0x0F, 0x1F,
+  0x01, 0xC3, 0xF0, 0x38, 0x76, 0x07, 0x0E, 0xC0, 0xE3, 0xD8, 0x3C, 0x71,
+  0x87, 0x0E, 0x30, 0xE1, 0xC6, 0x1C, 0x38, 0x63, 0x8F, 0x0C, 0xF1, 0xC1,
+  0x9C, 0x38, 0x33, 0x87, 0x03, 0x70, 0xE0, 0x6E, 0x3C, 0x0F, 0xC7, 0x00,
+  0xF0, 0xE0, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xC0, 0x7C, 0x3C, 0x1E,
+  0x01, 0xC3, 0x80, 0x38, 0xE0, 0x03, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0xE0,
+  0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xDC, 0x00, 0x3B, 0x80,
+  0x07, 0x70, 0x01, 0xC7, 0x00, 0x70, 0xE0, 0x1E, 0x0F, 0x0F, 0x80, 0xFF,
+  0xC0, 0x07, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xC0, 0x7C, 0x3C, 0x1E,
+  0x01, 0xC3, 0x80, 0x38, 0xE0, 0x03, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0xE0,
+  0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xDC, 0x00, 0x3B, 0x80,
+  0x07, 0x70, 0x01, 0xC7, 0x00, 0x70, 0xE0, 0x1E, 0x0F, 0x0F, 0x80, 0xFF,
+  0xC0, 0x07, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x06, 0xC0, 0x01, 0x98, 0x00,
+  0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xF8, 0x0F,
+  0x87, 0x83, 0xC0, 0x38, 0x70, 0x07, 0x1C, 0x00, 0x77, 0x00, 0x0E, 0xE0,
+  0x01, 0xDC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3B, 0x80,
+  0x07, 0x70, 0x00, 0xEE, 0x00, 0x38, 0xE0, 0x0E, 0x1C, 0x03, 0xC1, 0xE1,
+  0xF0, 0x1F, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x79, 0x80, 0x0F, 0xE0, 0x03,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xC0, 0x7C,
+  0x3C, 0x1E, 0x01, 0xC3, 0x80, 0x38, 0xE0, 0x03, 0xB8, 0x00, 0x77, 0x00,
+  0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xDC, 0x00,
+  0x3B, 0x80, 0x07, 0x70, 0x01, 0xC7, 0x00, 0x70, 0xE0, 0x1E, 0x0F, 0x0F,
+  0x80, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0xE7, 0x00, 0x1C, 0xE0, 0x03,
+  0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xC0, 0x7C,
+  0x3C, 0x1E, 0x01, 0xC3, 0x80, 0x38, 0xE0, 0x03, 0xB8, 0x00, 0x77, 0x00,
+  0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xDC, 0x00,
+  0x3B, 0x80, 0x07, 0x70, 0x01, 0xC7, 0x00, 0x70, 0xE0, 0x1E, 0x0F, 0x0F,
+  0x80, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x40, 0x05, 0xC0, 0x1D, 0xC0, 0x71,
+  0xC1, 0xC1, 0xC7, 0x01, 0xDC, 0x01, 0xF0, 0x01, 0xC0, 0x07, 0xC0, 0x1D,
+  0xC0, 0x71, 0xC1, 0xC1, 0xC7, 0x01, 0xDC, 0x01, 0xD0, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x7E, 0x18, 0x03, 0xFF, 0x70, 0x1F, 0x0F, 0xC0, 0x78,
+  0x07, 0x00, 0xE0, 0x1E, 0x03, 0x80, 0x6E, 0x0F, 0x01, 0x9C, 0x1C, 0x06,
+  0x38, 0x38, 0x18, 0x70, 0xE0, 0x60, 0xE1, 0xC1, 0x81, 0xC3, 0x86, 0x07,
+  0x07, 0x38, 0x0E, 0x0E, 0xE0, 0x1C, 0x1F, 0x80, 0x70, 0x1E, 0x01, 0xC0,
+  0x38, 0x07, 0x80, 0xFC, 0x3E, 0x03, 0xBF, 0xF0, 0x0C, 0x1F, 0x80, 0x00,
+  0x00, 0xE0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x71, 0xC0, 0x1C, 0xE0, 0x0F, 0x38, 0x03, 0x8E, 0x00, 0xE3, 0x80,
+  0x38, 0xE0, 0x0E, 0x70, 0x07, 0x9C, 0x01, 0xC7, 0x00, 0x71, 0xC0, 0x1C,
+  0xF0, 0x07, 0x38, 0x03, 0xCE, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x1E, 0x3C,
+  0x07, 0x07, 0x87, 0x80, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x18, 0x00,
+  0x0C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x71, 0xC0,
+  0x1C, 0xE0, 0x0F, 0x38, 0x03, 0x8E, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x0E,
+  0x70, 0x07, 0x9C, 0x01, 0xC7, 0x00, 0x71, 0xC0, 0x1C, 0xF0, 0x07, 0x38,
+  0x03, 0xCE, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x1E, 0x3C, 0x07, 0x07, 0x87,
+  0x80, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x36, 0x00, 0x19,
+  0x80, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1C, 0x70, 0x07,
+  0x38, 0x03, 0xCE, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x0E, 0x38, 0x03, 0x9C,
+  0x01, 0xE7, 0x00, 0x71, 0xC0, 0x1C, 0x70, 0x07, 0x3C, 0x01, 0xCE, 0x00,
+  0xF3, 0x80, 0x38, 0xE0, 0x0E, 0x38, 0x07, 0x8F, 0x01, 0xC1, 0xE1, 0xE0,
+  0x3F, 0xF0, 0x07, 0xF0, 0x00, 0x03, 0x9C, 0x00, 0xE7, 0x00, 0x39, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x71, 0xC0, 0x1C, 0xE0, 0x0F, 0x38,
+  0x03, 0x8E, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x0E, 0x70, 0x07, 0x9C, 0x01,
+  0xC7, 0x00, 0x71, 0xC0, 0x1C, 0xF0, 0x07, 0x38, 0x03, 0xCE, 0x00, 0xE3,
+  0x80, 0x38, 0xE0, 0x1E, 0x3C, 0x07, 0x07, 0x87, 0x80, 0xFF, 0xC0, 0x1F,
+  0xC0, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0x79, 0xC0, 0x78, 0xF0, 0x38, 0x38, 0x3C, 0x1C, 0x3C, 0x07,
+  0x3C, 0x03, 0xBC, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x78, 0x00, 0xFF, 0x81, 0xFF, 0xC3, 0x83, 0x87, 0x03, 0x9E, 0x07, 0x38,
+  0x0E, 0x70, 0x1C, 0xE0, 0x39, 0xC0, 0xE7, 0x83, 0xCF, 0xFF, 0x1F, 0xF8,
+  0x38, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x01, 0xF0,
+  0x0F, 0xF8, 0x3C, 0x78, 0x70, 0x71, 0xE0, 0xE3, 0x87, 0xC7, 0x1E, 0x0E,
+  0x38, 0x1C, 0xE0, 0x71, 0xC0, 0xE3, 0xC1, 0xC3, 0xC3, 0x83, 0xC7, 0x03,
+  0xDC, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0xE0, 0x1D, 0xD0, 0x77, 0x3F, 0xCE,
+  0x3E, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x00, 0xC0, 0x00,
+  0x00, 0x00, 0x01, 0xFC, 0x1F, 0xF8, 0x60, 0xF0, 0x01, 0xC0, 0x07, 0x00,
+  0x1C, 0x3F, 0xF3, 0xFF, 0xDE, 0x0E, 0xE0, 0x3B, 0x81, 0xEE, 0x07, 0x3C,
+  0x7C, 0x7F, 0x70, 0xF9, 0xC0, 0x00, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x30,
+  0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xF8, 0x60, 0xF0, 0x01,
+  0xC0, 0x07, 0x00, 0x1C, 0x3F, 0xF3, 0xFF, 0xDE, 0x0E, 0xE0, 0x3B, 0x81,
+  0xEE, 0x07, 0x3C, 0x7C, 0x7F, 0x70, 0xF9, 0xC0, 0x00, 0xC0, 0x07, 0x00,
+  0x36, 0x01, 0x88, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xF8,
+  0x60, 0xF0, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x3F, 0xF3, 0xFF, 0xDE, 0x0E,
+  0xE0, 0x3B, 0x81, 0xEE, 0x07, 0x3C, 0x7C, 0x7F, 0x70, 0xF9, 0xC0, 0x03,
+  0x18, 0x1E, 0x60, 0xCF, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07,
+  0xFE, 0x18, 0x3C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x0F, 0xFC, 0xFF, 0xF7,
+  0x83, 0xB8, 0x0E, 0xE0, 0x7B, 0x81, 0xCF, 0x1F, 0x1F, 0xDC, 0x3E, 0x70,
+  0x07, 0x38, 0x1C, 0xE0, 0x73, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFF,
+  0x86, 0x0F, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC3, 0xFF, 0x3F, 0xFD, 0xE0,
+  0xEE, 0x03, 0xB8, 0x1E, 0xE0, 0x73, 0xC7, 0xC7, 0xF7, 0x0F, 0x9C, 0x00,
+  0xE0, 0x07, 0xC0, 0x31, 0x80, 0xC6, 0x03, 0x18, 0x07, 0xC0, 0x0E, 0x00,
+  0x00, 0x07, 0xF0, 0x7F, 0xE1, 0x83, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70,
+  0xFF, 0xCF, 0xFF, 0x78, 0x3B, 0x80, 0xEE, 0x07, 0xB8, 0x1C, 0xF1, 0xF1,
+  0xFD, 0xC3, 0xE7, 0x00, 0x07, 0xF0, 0x7C, 0x0F, 0xFC, 0xFF, 0x86, 0x0F,
+  0xE1, 0xC0, 0x03, 0xC0, 0x70, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x1C, 0x3F,
+  0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x78, 0x18, 0x00, 0x70, 0x1C, 0x00, 0x38,
+  0x0E, 0x00, 0x1C, 0x0F, 0x80, 0x0F, 0x0F, 0xE0, 0x63, 0xFE, 0x7F, 0xE0,
+  0xFC, 0x0F, 0xE0, 0x03, 0xF0, 0x7F, 0xC7, 0x82, 0x70, 0x07, 0x00, 0x38,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x07, 0x82,
+  0x3F, 0xF0, 0x7E, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x0F, 0xC0, 0x7C, 0x00,
+  0x07, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x0F, 0xF8, 0x70, 0xE3, 0x81, 0xDC, 0x07, 0x70, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x1E, 0x0C, 0x7F,
+  0xE0, 0x7F, 0x00, 0x00, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x30, 0x01, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xF8, 0x70, 0xE3, 0x81, 0xDC, 0x07,
+  0x70, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00,
+  0x1E, 0x0C, 0x7F, 0xE0, 0x7F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x36, 0x01,
+  0x88, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xF8, 0x70, 0xE3,
+  0x81, 0xDC, 0x07, 0x70, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xE0, 0x03,
+  0x80, 0x0F, 0x00, 0x1E, 0x0C, 0x7F, 0xE0, 0x7F, 0x00, 0x07, 0x38, 0x1C,
+  0xE0, 0x73, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x87, 0x0E, 0x38,
+  0x1D, 0xC0, 0x77, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x00, 0x38,
+  0x00, 0xF0, 0x01, 0xE0, 0xC7, 0xFE, 0x07, 0xF0, 0x70, 0xC1, 0x86, 0x0C,
+  0x00, 0x07, 0x1C, 0xF3, 0x8E, 0x38, 0xE7, 0x9C, 0x71, 0xC7, 0x3C, 0xE3,
+  0x80, 0x01, 0xC0, 0xE0, 0x60, 0x30, 0x18, 0x00, 0x00, 0x00, 0x70, 0x1C,
+  0x0F, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x07, 0x81, 0xC0, 0x70, 0x1C, 0x07,
+  0x03, 0xC0, 0xE0, 0x38, 0x00, 0x0C, 0x1C, 0x36, 0x62, 0xC3, 0x00, 0x00,
+  0x1C, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0x70, 0x70,
+  0xF0, 0xE0, 0xE0, 0x73, 0xB9, 0xDC, 0xE0, 0x00, 0x00, 0xE0, 0x70, 0x78,
+  0x38, 0x1C, 0x0E, 0x07, 0x07, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x78, 0x38,
+  0x1C, 0x00, 0x07, 0x80, 0x07, 0x18, 0x0F, 0xE0, 0x0E, 0x00, 0xFE, 0x01,
+  0x1C, 0x00, 0x3C, 0x03, 0xFC, 0x0F, 0xF8, 0x78, 0x78, 0xE0, 0x73, 0x80,
+  0xE7, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x1C, 0xE0, 0x39, 0xC0, 0xE1,
+  0xC3, 0xC3, 0xFE, 0x01, 0xF8, 0x00, 0x01, 0x8C, 0x0F, 0x30, 0x67, 0x81,
+  0x8C, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x07, 0xFE, 0x3E, 0x3C, 0xF0, 0x73,
+  0x81, 0xCE, 0x07, 0x38, 0x1D, 0xE0, 0xF7, 0x03, 0x9C, 0x0E, 0x70, 0x39,
+  0xC0, 0xEF, 0x07, 0xB8, 0x1C, 0xE0, 0x70, 0x03, 0x80, 0x06, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xF0, 0x70,
+  0xE3, 0x81, 0xDC, 0x07, 0x70, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
+  0x3B, 0x80, 0xEE, 0x07, 0x1C, 0x38, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x0E,
+  0x00, 0x38, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xF0, 0x0F, 0xF0, 0x38, 0x70, 0xE0, 0x73, 0x80, 0xE7, 0x01, 0xDC, 0x03,
+  0xB8, 0x07, 0x70, 0x0E, 0xE0, 0x39, 0xC0, 0x73, 0x81, 0xC3, 0x87, 0x03,
+  0xFC, 0x03, 0xF0, 0x00, 0x00, 0x60, 0x03, 0x80, 0x1B, 0x00, 0xC4, 0x06,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xF0, 0x70, 0xE3, 0x81, 0xDC,
+  0x07, 0x70, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x3B, 0x80, 0xEE,
+  0x07, 0x1C, 0x38, 0x3F, 0xC0, 0x7E, 0x00, 0x01, 0x8C, 0x0F, 0x30, 0x67,
+  0x81, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x1C, 0x38, 0xE0,
+  0x77, 0x01, 0xDC, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x0E, 0xE0,
+  0x3B, 0x81, 0xC7, 0x0E, 0x0F, 0xF0, 0x1F, 0x80, 0x03, 0x9C, 0x0E, 0x70,
+  0x39, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0x07, 0x0E, 0x38, 0x1D,
+  0xC0, 0x77, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x03, 0xB8, 0x0E,
+  0xE0, 0x71, 0xC3, 0x83, 0xFC, 0x07, 0xE0, 0x01, 0xC0, 0x00, 0xE0, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80,
+  0x7E, 0x60, 0x3F, 0xF0, 0x3C, 0x38, 0x0E, 0x0F, 0x07, 0x07, 0xC1, 0xC3,
+  0x70, 0xE1, 0x9C, 0x38, 0xC7, 0x0E, 0x61, 0xC3, 0xB0, 0xE0, 0xF8, 0x38,
+  0x3C, 0x1C, 0x07, 0x0F, 0x03, 0xFF, 0x01, 0x9F, 0x80, 0xC0, 0x00, 0x00,
+  0x0E, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x0E, 0x07, 0x38, 0x1D, 0xE0, 0xF7, 0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0,
+  0xE7, 0x07, 0xB8, 0x1C, 0xE0, 0x73, 0x83, 0xCE, 0x1F, 0x3C, 0xFC, 0x7E,
+  0xE0, 0xF3, 0x80, 0x00, 0x38, 0x01, 0xC0, 0x0C, 0x00, 0x60, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x0E, 0x07, 0x38, 0x1D, 0xE0, 0xF7, 0x03, 0x9C, 0x0E,
+  0x70, 0x39, 0xC0, 0xE7, 0x07, 0xB8, 0x1C, 0xE0, 0x73, 0x83, 0xCE, 0x1F,
+  0x3C, 0xFC, 0x7E, 0xE0, 0xF3, 0x80, 0x01, 0x80, 0x0E, 0x00, 0x6C, 0x03,
+  0x10, 0x18, 0x60, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x38, 0x1D, 0xE0, 0xF7,
+  0x03, 0x9C, 0x0E, 0x70, 0x39, 0xC0, 0xE7, 0x07, 0xB8, 0x1C, 0xE0, 0x73,
+  0x83, 0xCE, 0x1F, 0x3C, 0xFC, 0x7E, 0xE0, 0xF3, 0x80, 0x0E, 0x70, 0x39,
+  0xC0, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x73, 0x81, 0xDE, 0x0F, 0x70,
+  0x39, 0xC0, 0xE7, 0x03, 0x9C, 0x0E, 0x70, 0x7B, 0x81, 0xCE, 0x07, 0x38,
+  0x3C, 0xE1, 0xF3, 0xCF, 0xC7, 0xEE, 0x0F, 0x38, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x0F, 0x1C, 0x07, 0x0F, 0x07, 0x83, 0x83, 0x81, 0xC3, 0x80, 0xE3, 0xC0,
+  0x71, 0xC0, 0x1D, 0xE0, 0x0E, 0xE0, 0x07, 0xF0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0x78, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E,
+  0x00, 0x0E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x7C, 0x0F, 0xFE,
+  0x1F, 0x0E, 0x1E, 0x07, 0x1E, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x3C, 0x07,
+  0x38, 0x07, 0x38, 0x0E, 0x38, 0x0E, 0x3C, 0x1C, 0x3C, 0x38, 0x77, 0xF0,
+  0x73, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0x01, 0xCE, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xE0, 0x3C, 0x70, 0x1C, 0x3C, 0x1E, 0x0E, 0x0E, 0x07, 0x0E, 0x03,
+  0x8F, 0x01, 0xC7, 0x00, 0x77, 0x80, 0x3B, 0x80, 0x1F, 0xC0, 0x0F, 0xC0,
+  0x07, 0xE0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique14pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
+  {     1,   7,  20,  11,    2,  -19 },   // 0x21 '!'
+  {    19,   7,   7,  12,    3,  -19 },   // 0x22 '"'
+  {    26,  19,  18,  23,    2,  -17 },   // 0x23 '#'
+  {    69,  14,  24,  17,    1,  -19 },   // 0x24 '$'
+  {   111,  21,  20,  26,    2,  -19 },   // 0x25 '%'
+  {   164,  19,  20,  21,    1,  -19 },   // 0x26 '&'
+  {   212,   2,   7,   7,    3,  -19 },   // 0x27 '''
+  {   214,  10,  24,  11,    2,  -20 },   // 0x28 '('
+  {   244,  10,  24,  11,   -2,  -20 },   // 0x29 ')'
+  {   274,  12,  12,  14,    1,  -19 },   // 0x2A '*'
+  {   292,  16,  16,  23,    3,  -15 },   // 0x2B '+'
+  {   324,   5,   6,   9,    0,   -2 },   // 0x2C ','
+  {   328,   8,   3,  10,    1,   -7 },   // 0x2D '-'
+  {   331,   3,   3,   9,    2,   -2 },   // 0x2E '.'
+  {   333,  13,  22,   9,   -2,  -19 },   // 0x2F '/'
+  {   369,  14,  20,  17,    2,  -19 },   // 0x30 '0'
+  {   404,  12,  20,  17,    1,  -19 },   // 0x31 '1'
+  {   434,  16,  20,  17,    0,  -19 },   // 0x32 '2'
+  {   474,  15,  20,  17,    0,  -19 },   // 0x33 '3'
+  {   512,  14,  20,  17,    0,  -19 },   // 0x34 '4'
+  {   547,  15,  20,  17,    1,  -19 },   // 0x35 '5'
+  {   585,  14,  20,  17,    2,  -19 },   // 0x36 '6'
+  {   620,  14,  20,  17,    3,  -19 },   // 0x37 '7'
+  {   655,  15,  20,  17,    1,  -19 },   // 0x38 '8'
+  {   693,  15,  20,  17,    0,  -19 },   // 0x39 '9'
+  {   731,   6,  14,   9,    1,  -13 },   // 0x3A ':'
+  {   742,   7,  17,   9,    0,  -13 },   // 0x3B ';'
+  {   757,  17,  14,  23,    3,  -15 },   // 0x3C '<'
+  {   787,  17,   7,  23,    3,  -11 },   // 0x3D '='
+  {   802,  17,  14,  23,    3,  -15 },   // 0x3E '>'
+  {   832,  10,  20,  14,    3,  -19 },   // 0x3F '?'
+  {   857,  24,  24,  27,    2,  -18 },   // 0x40 '@'
+  {   929,  18,  20,  18,   -1,  -19 },   // 0x41 'A'
+  {   974,  16,  20,  19,    1,  -19 },   // 0x42 'B'
+  {  1014,  18,  20,  19,    1,  -19 },   // 0x43 'C'
+  {  1059,  19,  20,  21,    1,  -19 },   // 0x44 'D'
+  {  1107,  16,  20,  17,    1,  -19 },   // 0x45 'E'
+  {  1147,  15,  20,  16,    1,  -19 },   // 0x46 'F'
+  {  1185,  18,  20,  21,    1,  -19 },   // 0x47 'G'
+  {  1230,  19,  20,  20,    1,  -19 },   // 0x48 'H'
+  {  1278,   7,  20,   8,    1,  -19 },   // 0x49 'I'
+  {  1296,  12,  25,   8,   -4,  -19 },   // 0x4A 'J'
+  {  1334,  19,  20,  18,    1,  -19 },   // 0x4B 'K'
+  {  1382,  13,  20,  15,    1,  -19 },   // 0x4C 'L'
+  {  1415,  22,  20,  23,    1,  -19 },   // 0x4D 'M'
+  {  1470,  19,  20,  20,    1,  -19 },   // 0x4E 'N'
+  {  1518,  19,  20,  21,    1,  -19 },   // 0x4F 'O'
+  {  1566,  16,  20,  16,    1,  -19 },   // 0x50 'P'
+  {  1606,  19,  23,  21,    1,  -19 },   // 0x51 'Q'
+  {  1661,  15,  20,  19,    1,  -19 },   // 0x52 'R'
+  {  1699,  16,  20,  17,    0,  -19 },   // 0x53 'S'
+  {  1739,  17,  20,  17,    1,  -19 },   // 0x54 'T'
+  {  1782,  18,  20,  20,    2,  -19 },   // 0x55 'U'
+  {  1827,  18,  20,  18,    2,  -19 },   // 0x56 'V'
+  {  1872,  25,  20,  27,    3,  -19 },   // 0x57 'W'
+  {  1935,  20,  20,  19,   -1,  -19 },   // 0x58 'X'
+  {  1985,  17,  20,  17,    2,  -19 },   // 0x59 'Y'
+  {  2028,  20,  20,  19,   -1,  -19 },   // 0x5A 'Z'
+  {  2078,  11,  24,  11,    1,  -20 },   // 0x5B '['
+  {  2111,   5,  22,   9,    2,  -19 },   // 0x5C '\'
+  {  2125,  11,  24,  11,   -1,  -20 },   // 0x5D ']'
+  {  2158,  17,   7,  23,    3,  -19 },   // 0x5E '^'
+  {  2173,  14,   2,  14,    0,    5 },   // 0x5F '_'
+  {  2177,   5,   5,  14,    5,  -21 },   // 0x60 '`'
+  {  2181,  14,  15,  17,    1,  -14 },   // 0x61 'a'
+  {  2208,  15,  21,  17,    1,  -20 },   // 0x62 'b'
+  {  2248,  13,  15,  15,    1,  -14 },   // 0x63 'c'
+  {  2273,  16,  21,  17,    1,  -20 },   // 0x64 'd'
+  {  2315,  14,  15,  17,    1,  -14 },   // 0x65 'e'
+  {  2342,  11,  21,  10,    2,  -20 },   // 0x66 'f'
+  {  2371,  15,  21,  17,    1,  -14 },   // 0x67 'g'
+  {  2411,  14,  21,  17,    1,  -20 },   // 0x68 'h'
+  {  2448,   7,  21,   8,    1,  -20 },   // 0x69 'i'
+  {  2467,  11,  27,   8,   -3,  -20 },   // 0x6A 'j'
+  {  2505,  16,  21,  16,    1,  -20 },   // 0x6B 'k'
+  {  2547,   7,  21,   8,    1,  -20 },   // 0x6C 'l'
+  {  2566,  24,  15,  26,    1,  -14 },   // 0x6D 'm'
+  {  2611,  14,  15,  17,    1,  -14 },   // 0x6E 'n'
+  {  2638,  14,  15,  17,    1,  -14 },   // 0x6F 'o'
+  {  2665,  16,  21,  17,    0,  -14 },   // 0x70 'p'
+  {  2707,  15,  21,  17,    1,  -14 },   // 0x71 'q'
+  {  2747,  12,  15,  11,    1,  -14 },   // 0x72 'r'
+  {  2770,  13,  15,  14,    0,  -14 },   // 0x73 's'
+  {  2795,   9,  19,  11,    2,  -18 },   // 0x74 't'
+  {  2817,  14,  15,  17,    2,  -14 },   // 0x75 'u'
+  {  2844,  14,  15,  16,    2,  -14 },   // 0x76 'v'
+  {  2871,  20,  15,  22,    2,  -14 },   // 0x77 'w'
+  {  2909,  17,  15,  16,   -1,  -14 },   // 0x78 'x'
+  {  2941,  17,  21,  16,   -1,  -14 },   // 0x79 'y'
+  {  2986,  15,  15,  14,    0,  -14 },   // 0x7A 'z'
+  {  3015,  13,  25,  17,    3,  -20 },   // 0x7B '{'
+  {  3056,   2,  27,   9,    3,  -20 },   // 0x7C '|'
+  {  3063,  14,  25,  17,    0,  -20 },   // 0x7D '}'
+  {  3107,  17,   4,  23,    3,   -9 },   // 0x7E '~'
+  {  3116,  14,  24,  16,    1,  -18 },   // 0x7F
+  {  3158,  14,  24,  16,    1,  -18 },   // 0x80
+  {  3200,  14,  24,  16,    1,  -18 },   // 0x81
+  {  3242,  14,  24,  16,    1,  -18 },   // 0x82
+  {  3284,  14,  24,  16,    1,  -18 },   // 0x83
+  {  3326,  14,  24,  16,    1,  -18 },   // 0x84
+  {  3368,  14,  24,  16,    1,  -18 },   // 0x85
+  {  3410,  14,  24,  16,    1,  -18 },   // 0x86
+  {  3452,  14,  24,  16,    1,  -18 },   // 0x87
+  {  3494,  14,  24,  16,    1,  -18 },   // 0x88
+  {  3536,  14,  24,  16,    1,  -18 },   // 0x89
+  {  3578,  14,  24,  16,    1,  -18 },   // 0x8A
+  {  3620,  14,  24,  16,    1,  -18 },   // 0x8B
+  {  3662,  14,  24,  16,    1,  -18 },   // 0x8C
+  {  3704,  14,  24,  16,    1,  -18 },   // 0x8D
+  {  3746,  14,  24,  16,    1,  -18 },   // 0x8E
+  {  3788,  14,  24,  16,    1,  -18 },   // 0x8F
+  {  3830,  14,  24,  16,    1,  -18 },   // 0x90
+  {  3872,  14,  24,  16,    1,  -18 },   // 0x91
+  {  3914,  14,  24,  16,    1,  -18 },   // 0x92
+  {  3956,  14,  24,  16,    1,  -18 },   // 0x93
+  {  3998,  14,  24,  16,    1,  -18 },   // 0x94
+  {  4040,  14,  24,  16,    1,  -18 },   // 0x95
+  {  4082,  14,  24,  16,    1,  -18 },   // 0x96
+  {  4124,  14,  24,  16,    1,  -18 },   // 0x97
+  {  4166,  14,  24,  16,    1,  -18 },   // 0x98
+  {  4208,  14,  24,  16,    1,  -18 },   // 0x99
+  {  4250,  14,  24,  16,    1,  -18 },   // 0x9A
+  {  4292,  14,  24,  16,    1,  -18 },   // 0x9B
+  {  4334,  14,  24,  16,    1,  -18 },   // 0x9C
+  {  4376,  14,  24,  16,    1,  -18 },   // 0x9D
+  {  4418,  14,  24,  16,    1,  -18 },   // 0x9E
+  {  4460,  14,  24,  16,    1,  -18 },   // 0x9F
+  {  4502,   1,   1,   9,    0,    0 },   // 0xA0
+  {  4503,   7,  20,  11,    2,  -14 },   // 0xA1
+  {  4521,  14,  23,  17,    2,  -18 },   // 0xA2
+  {  4562,  17,  20,  17,    1,  -19 },   // 0xA3
+  {  4605,  15,  15,  17,    1,  -15 },   // 0xA4
+  {  4634,  18,  20,  17,    1,  -19 },   // 0xA5
+  {  4679,   2,  24,   9,    3,  -18 },   // 0xA6
+  {  4685,  14,  23,  14,   -1,  -19 },   // 0xA7
+  {  4726,   8,   3,  14,    5,  -19 },   // 0xA8
+  {  4729,  20,  20,  27,    4,  -19 },   // 0xA9
+  {  4779,  11,  13,  13,    1,  -19 },   // 0xAA
+  {  4797,  12,  12,  17,    2,  -13 },   // 0xAB
+  {  4815,  17,   8,  23,    3,  -10 },   // 0xAC
+  {  4832,   8,   3,  10,    1,   -7 },   // 0xAD
+  {  4835,  20,  20,  27,    4,  -19 },   // 0xAE
+  {  4885,   8,   2,  13,    5,  -19 },   // 0xAF
+  {  4887,   8,   8,  14,    3,  -19 },   // 0xB0
+  {  4895,  16,  17,  23,    3,  -16 },   // 0xB1
+  {  4929,   9,  11,  11,    1,  -19 },   // 0xB2
+  {  4942,  10,  11,  11,    0,  -19 },   // 0xB3
+  {  4956,   7,   5,  14,    7,  -21 },   // 0xB4
+  {  4961,  16,  21,  17,    0,  -14 },   // 0xB5
+  {  5003,  14,  23,  17,    2,  -19 },   // 0xB6
+  {  5044,   3,   3,   9,    3,  -10 },   // 0xB7
+  {  5046,   6,   5,  14,    1,    1 },   // 0xB8
+  {  5050,   8,  11,  11,    2,  -19 },   // 0xB9
+  {  5061,  11,  13,  13,    1,  -19 },   // 0xBA
+  {  5079,  12,  12,  17,    2,  -13 },   // 0xBB
+  {  5097,  23,  20,  26,    2,  -19 },   // 0xBC
+  {  5155,  23,  20,  26,    2,  -19 },   // 0xBD
+  {  5213,  25,  20,  26,    0,  -19 },   // 0xBE
+  {  5276,  10,  21,  14,    1,  -14 },   // 0xBF
+  {  5303,  18,  25,  18,   -1,  -24 },   // 0xC0
+  {  5360,  18,  25,  18,   -1,  -24 },   // 0xC1
+  {  5417,  18,  26,  18,   -1,  -25 },   // 0xC2
+  {  5476,  18,  25,  18,   -1,  -24 },   // 0xC3
+  {  5533,  18,  25,  18,   -1,  -24 },   // 0xC4
+  {  5590,  18,  25,  18,   -1,  -24 },   // 0xC5
+  {  5647,  28,  20,  26,   -1,  -19 },   // 0xC6
+  {  5717,  18,  25,  19,    1,  -19 },   // 0xC7
+  {  5774,  16,  25,  17,    1,  -24 },   // 0xC8
+  {  5824,  16,  25,  17,    1,  -24 },   // 0xC9
+  {  5874,  16,  26,  17,    1,  -25 },   // 0xCA
+  {  5926,  16,  25,  17,    1,  -24 },   // 0xCB
+  {  5976,   7,  25,   8,    1,  -24 },   // 0xCC
+  {  5998,   9,  25,   8,    1,  -24 },   // 0xCD
+  {  6027,   9,  26,   8,    1,  -25 },   // 0xCE
+  {  6057,   9,  25,   8,    1,  -24 },   // 0xCF
+  {  6086,  20,  20,  21,    0,  -19 },   // 0xD0
+  {  6136,  19,  25,  20,    1,  -24 },   // 0xD1
+  {  6196,  19,  25,  21,    1,  -24 },   // 0xD2
+  {  6256,  19,  25,  21,    1,  -24 },   // 0xD3
+  {  6316,  19,  26,  21,    1,  -25 },   // 0xD4
+  {  6378,  19,  25,  21,    1,  -24 },   // 0xD5
+  {  6438,  19,  25,  21,    1,  -24 },   // 0xD6
+  {  6498,  15,  15,  23,    4,  -15 },   // 0xD7
+  {  6527,  23,  21,  21,   -1,  -20 },   // 0xD8
+  {  6588,  18,  25,  20,    2,  -24 },   // 0xD9
+  {  6645,  18,  25,  20,    2,  -24 },   // 0xDA
+  {  6702,  18,  26,  20,    2,  -25 },   // 0xDB
+  {  6761,  18,  25,  20,    2,  -24 },   // 0xDC
+  {  6818,  17,  25,  17,    2,  -24 },   // 0xDD
+  {  6872,  15,  20,  16,    1,  -19 },   // 0xDE
+  {  6910,  15,  21,  17,    1,  -20 },   // 0xDF
+  {  6950,  14,  22,  17,    1,  -21 },   // 0xE0
+  {  6989,  14,  22,  17,    1,  -21 },   // 0xE1
+  {  7028,  14,  22,  17,    1,  -21 },   // 0xE2
+  {  7067,  14,  21,  17,    1,  -20 },   // 0xE3
+  {  7104,  14,  20,  17,    1,  -19 },   // 0xE4
+  {  7139,  14,  23,  17,    1,  -22 },   // 0xE5
+  {  7180,  25,  15,  27,    1,  -14 },   // 0xE6
+  {  7227,  13,  20,  15,    1,  -14 },   // 0xE7
+  {  7260,  14,  22,  17,    1,  -21 },   // 0xE8
+  {  7299,  14,  22,  17,    1,  -21 },   // 0xE9
+  {  7338,  14,  22,  17,    1,  -21 },   // 0xEA
+  {  7377,  14,  20,  17,    1,  -19 },   // 0xEB
+  {  7412,   6,  22,   8,    1,  -21 },   // 0xEC
+  {  7429,  10,  22,   8,    1,  -21 },   // 0xED
+  {  7457,   8,  22,   8,    1,  -21 },   // 0xEE
+  {  7479,   9,  20,   8,    1,  -19 },   // 0xEF
+  {  7502,  15,  21,  17,    1,  -20 },   // 0xF0
+  {  7542,  14,  21,  17,    1,  -20 },   // 0xF1
+  {  7579,  14,  22,  17,    1,  -21 },   // 0xF2
+  {  7618,  15,  22,  17,    1,  -21 },   // 0xF3
+  {  7660,  14,  22,  17,    1,  -21 },   // 0xF4
+  {  7699,  14,  21,  17,    1,  -20 },   // 0xF5
+  {  7736,  14,  20,  17,    1,  -19 },   // 0xF6
+  {  7771,  17,  12,  23,    3,  -13 },   // 0xF7
+  {  7797,  18,  17,  17,   -1,  -15 },   // 0xF8
+  {  7836,  14,  22,  17,    2,  -21 },   // 0xF9
+  {  7875,  14,  22,  17,    2,  -21 },   // 0xFA
+  {  7914,  14,  22,  17,    2,  -21 },   // 0xFB
+  {  7953,  14,  20,  17,    2,  -19 },   // 0xFC
+  {  7988,  17,  28,  16,   -1,  -21 },   // 0xFD
+  {  8048,  16,  27,  17,    0,  -20 },   // 0xFE
+  {  8102,  17,  26,  16,   -1,  -19 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique14pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique14pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique14pt8bGlyphs,
+  0x20, 0xFF, 32 };
+
+// Approx. 9733 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique14pt8bMetrics[] PROGMEM = {
+  {   0,   9,   1 },   // 0x20
+  {   2,  11,   9 },   // 0x21
+  {   3,  12,  10 },   // 0x22
+  {   2,  23,  21 },   // 0x23
+  {   1,  17,  15 },   // 0x24
+  {   2,  26,  23 },   // 0x25
+  {   1,  21,  20 },   // 0x26
+  {   3,   7,   5 },   // 0x27
+  {   2,  11,  12 },   // 0x28
+  {  -2,  11,   8 },   // 0x29
+  {   1,  14,  13 },   // 0x2A
+  {   3,  23,  19 },   // 0x2B
+  {   0,   9,   5 },   // 0x2C
+  {   1,  10,   9 },   // 0x2D
+  {   2,   9,   5 },   // 0x2E
+  {  -2,   9,  11 },   // 0x2F
+  {   2,  17,  16 },   // 0x30
+  {   1,  17,  13 },   // 0x31
+  {   0,  17,  16 },   // 0x32
+  {   0,  17,  15 },   // 0x33
+  {   0,  17,  14 },   // 0x34
+  {   1,  17,  16 },   // 0x35
+  {   2,  17,  16 },   // 0x36
+  {   3,  17,  17 },   // 0x37
+  {   1,  17,  16 },   // 0x38
+  {   0,  17,  15 },   // 0x39
+  {   1,   9,   7 },   // 0x3A
+  {   0,   9,   7 },   // 0x3B
+  {   3,  23,  20 },   // 0x3C
+  {   3,  23,  20 },   // 0x3D
+  {   3,  23,  20 },   // 0x3E
+  {   3,  14,  13 },   // 0x3F
+  {   2,  27,  26 },   // 0x40
+  {  -1,  18,  17 },   // 0x41
+  {   1,  19,  17 },   // 0x42
+  {   1,  19,  19 },   // 0x43
+  {   1,  21,  20 },   // 0x44
+  {   1,  17,  17 },   // 0x45
+  {   1,  16,  16 },   // 0x46
+  {   1,  21,  19 },   // 0x47
+  {   1,  20,  20 },   // 0x48
+  {   1,   8,   8 },   // 0x49
+  {  -4,   8,   8 },   // 0x4A
+  {   1,  18,  20 },   // 0x4B
+  {   1,  15,  14 },   // 0x4C
+  {   1,  23,  23 },   // 0x4D
+  {   1,  20,  20 },   // 0x4E
+  {   1,  21,  20 },   // 0x4F
+  {   1,  16,  17 },   // 0x50
+  {   1,  21,  20 },   // 0x51
+  {   1,  19,  16 },   // 0x52
+  {   0,  17,  16 },   // 0x53
+  {   1,  17,  18 },   // 0x54
+  {   2,  20,  20 },   // 0x55
+  {   2,  18,  20 },   // 0x56
+  {   3,  27,  28 },   // 0x57
+  {  -1,  19,  19 },   // 0x58
+  {   2,  17,  19 },   // 0x59
+  {  -1,  19,  19 },   // 0x5A
+  {   1,  11,  12 },   // 0x5B
+  {   2,   9,   7 },   // 0x5C
+  {  -1,  11,  10 },   // 0x5D
+  {   3,  23,  20 },   // 0x5E
+  {   0,  14,  14 },   // 0x5F
+  {   5,  14,  10 },   // 0x60
+  {   1,  17,  15 },   // 0x61
+  {   1,  17,  16 },   // 0x62
+  {   1,  15,  14 },   // 0x63
+  {   1,  17,  17 },   // 0x64
+  {   1,  17,  15 },   // 0x65
+  {   2,  10,  13 },   // 0x66
+  {   1,  17,  16 },   // 0x67
+  {   1,  17,  15 },   // 0x68
+  {   1,   8,   8 },   // 0x69
+  {  -3,   8,   8 },   // 0x6A
+  {   1,  16,  17 },   // 0x6B
+  {   1,   8,   8 },   // 0x6C
+  {   1,  26,  25 },   // 0x6D
+  {   1,  17,  15 },   // 0x6E
+  {   1,  17,  15 },   // 0x6F
+  {   0,  17,  16 },   // 0x70
+  {   1,  17,  16 },   // 0x71
+  {   1,  11,  13 },   // 0x72
+  {   0,  14,  13 },   // 0x73
+  {   2,  11,  11 },   // 0x74
+  {   2,  17,  16 },   // 0x75
+  {   2,  16,  16 },   // 0x76
+  {   2,  22,  22 },   // 0x77
+  {  -1,  16,  16 },   // 0x78
+  {  -1,  16,  16 },   // 0x79
+  {   0,  14,  15 },   // 0x7A
+  {   3,  17,  16 },   // 0x7B
+  {   3,   9,   5 },   // 0x7C
+  {   0,  17,  14 },   // 0x7D
+  {   3,  23,  20 },   // 0x7E
+  {   1,  16,  15 },   // 0x7F
+  {   1,  16,  15 },   // 0x80
+  {   1,  16,  15 },   // 0x81
+  {   1,  16,  15 },   // 0x82
+  {   1,  16,  15 },   // 0x83
+  {   1,  16,  15 },   // 0x84
+  {   1,  16,  15 },   // 0x85
+  {   1,  16,  15 },   // 0x86
+  {   1,  16,  15 },   // 0x87
+  {   1,  16,  15 },   // 0x88
+  {   1,  16,  15 },   // 0x89
+  {   1,  16,  15 },   // 0x8A
+  {   1,  16,  15 },   // 0x8B
+  {   1,  16,  15 },   // 0x8C
+  {   1,  16,  15 },   // 0x8D
+  {   1,  16,  15 },   // 0x8E
+  {   1,  16,  15 },   // 0x8F
+  {   1,  16,  15 },   // 0x90
+  {   1,  16,  15 },   // 0x91
+  {   1,  16,  15 },   // 0x92
+  {   1,  16,  15 },   // 0x93
+  {   1,  16,  15 },   // 0x94
+  {   1,  16,  15 },   // 0x95
+  {   1,  16,  15 },   // 0x96
+  {   1,  16,  15 },   // 0x97
+  {   1,  16,  15 },   // 0x98
+  {   1,  16,  15 },   // 0x99
+  {   1,  16,  15 },   // 0x9A
+  {   1,  16,  15 },   // 0x9B
+  {   1,  16,  15 },   // 0x9C
+  {   1,  16,  15 },   // 0x9D
+  {   1,  16,  15 },   // 0x9E
+  {   1,  16,  15 },   // 0x9F
+  {   0,   9,   1 },   // 0xA0
+  {   2,  11,   9 },   // 0xA1
+  {   2,  17,  16 },   // 0xA2
+  {   1,  17,  18 },   // 0xA3
+  {   1,  17,  16 },   // 0xA4
+  {   1,  17,  19 },   // 0xA5
+  {   3,   9,   5 },   // 0xA6
+  {  -1,  14,  13 },   // 0xA7
+  {   5,  14,  13 },   // 0xA8
+  {   4,  27,  24 },   // 0xA9
+  {   1,  13,  12 },   // 0xAA
+  {   2,  17,  14 },   // 0xAB
+  {   3,  23,  20 },   // 0xAC
+  {   1,  10,   9 },   // 0xAD
+  {   4,  27,  24 },   // 0xAE
+  {   5,  13,  13 },   // 0xAF
+  {   3,  14,  11 },   // 0xB0
+  {   3,  23,  19 },   // 0xB1
+  {   1,  11,  10 },   // 0xB2
+  {   0,  11,  10 },   // 0xB3
+  {   7,  14,  14 },   // 0xB4
+  {   0,  17,  16 },   // 0xB5
+  {   2,  17,  16 },   // 0xB6
+  {   3,   9,   6 },   // 0xB7
+  {   1,  14,   7 },   // 0xB8
+  {   2,  11,  10 },   // 0xB9
+  {   1,  13,  12 },   // 0xBA
+  {   2,  17,  14 },   // 0xBB
+  {   2,  26,  25 },   // 0xBC
+  {   2,  26,  25 },   // 0xBD
+  {   0,  26,  25 },   // 0xBE
+  {   1,  14,  11 },   // 0xBF
+  {  -1,  18,  17 },   // 0xC0
+  {  -1,  18,  17 },   // 0xC1
+  {  -1,  18,  17 },   // 0xC2
+  {  -1,  18,  17 },   // 0xC3
+  {  -1,  18,  17 },   // 0xC4
+  {  -1,  18,  17 },   // 0xC5
+  {  -1,  26,  27 },   // 0xC6
+  {   1,  19,  19 },   // 0xC7
+  {   1,  17,  17 },   // 0xC8
+  {   1,  17,  17 },   // 0xC9
+  {   1,  17,  17 },   // 0xCA
+  {   1,  17,  17 },   // 0xCB
+  {   1,   8,   8 },   // 0xCC
+  {   1,   8,  10 },   // 0xCD
+  {   1,   8,  10 },   // 0xCE
+  {   1,   8,  10 },   // 0xCF
+  {   0,  21,  20 },   // 0xD0
+  {   1,  20,  20 },   // 0xD1
+  {   1,  21,  20 },   // 0xD2
+  {   1,  21,  20 },   // 0xD3
+  {   1,  21,  20 },   // 0xD4
+  {   1,  21,  20 },   // 0xD5
+  {   1,  21,  20 },   // 0xD6
+  {   4,  23,  19 },   // 0xD7
+  {  -1,  21,  22 },   // 0xD8
+  {   2,  20,  20 },   // 0xD9
+  {   2,  20,  20 },   // 0xDA
+  {   2,  20,  20 },   // 0xDB
+  {   2,  20,  20 },   // 0xDC
+  {   2,  17,  19 },   // 0xDD
+  {   1,  16,  16 },   // 0xDE
+  {   1,  17,  16 },   // 0xDF
+  {   1,  17,  15 },   // 0xE0
+  {   1,  17,  15 },   // 0xE1
+  {   1,  17,  15 },   // 0xE2
+  {   1,  17,  15 },   // 0xE3
+  {   1,  17,  15 },   // 0xE4
+  {   1,  17,  15 },   // 0xE5
+  {   1,  27,  26 },   // 0xE6
+  {   1,  15,  14 },   // 0xE7
+  {   1,  17,  15 },   // 0xE8
+  {   1,  17,  15 },   // 0xE9
+  {   1,  17,  15 },   // 0xEA
+  {   1,  17,  15 },   // 0xEB
+  {   1,   8,   7 },   // 0xEC
+  {   1,   8,  11 },   // 0xED
+  {   1,   8,   9 },   // 0xEE
+  {   1,   8,  10 },   // 0xEF
+  {   1,  17,  16 },   // 0xF0
+  {   1,  17,  15 },   // 0xF1
+  {   1,  17,  15 },   // 0xF2
+  {   1,  17,  16 },   // 0xF3
+  {   1,  17,  15 },   // 0xF4
+  {   1,  17,  15 },   // 0xF5
+  {   1,  17,  15 },   // 0xF6
+  {   3,  23,  20 },   // 0xF7
+  {  -1,  17,  17 },   // 0xF8
+  {   2,  17,  16 },   // 0xF9
+  {   2,  17,  16 },   // 0xFA
+  {   2,  17,  16 },   // 0xFB
+  {   2,  17,  16 },   // 0xFC
+  {  -1,  16,  16 },   // 0xFD
+  {   0,  17,  16 },   // 0xFE
+  {  -1,  16,  16 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique14pt8bWidths = { DejaVuSans_Oblique14pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE14PTLAT1__H
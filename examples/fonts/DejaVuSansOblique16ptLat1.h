@@ -0,0 +1,1362 @@
+#ifndef DEJAVUSANSOBLIQUE16PTLAT1__H
+#define DEJAVUSANSOBLIQUE16PTLAT1__H
+const uint8_t DejaVuSans_Oblique16pt8bBitmaps[] PROGMEM = {
+  0x00, 0x0E, 0x1C, 0x38, 0xE1, 0xC3, 0x87, 0x0E, 0x38, 0x70, 0xE1, 0xC3,
+  0x86, 0x1C, 0x38, 0x00, 0x00, 0x03, 0x87, 0x1C, 0x38, 0x00, 0xE3, 0xF1,
+  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0x00, 0x60, 0xC0, 0x01, 0x83,
+  0x00, 0x0E, 0x1C, 0x00, 0x38, 0x70, 0x00, 0xC1, 0x80, 0x03, 0x06, 0x03,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x06, 0x0C, 0x00, 0x38,
+  0x70, 0x00, 0xE1, 0x80, 0x03, 0x06, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0x3F, 0xFF, 0xFC, 0x06, 0x0C, 0x00, 0x18, 0x30, 0x00, 0xE1, 0xC0, 0x03,
+  0x86, 0x00, 0x0C, 0x18, 0x00, 0x30, 0x60, 0x00, 0x00, 0x30, 0x00, 0x20,
+  0x00, 0x20, 0x00, 0x20, 0x01, 0xFE, 0x07, 0xFF, 0x0F, 0xFF, 0x1E, 0x43,
+  0x3C, 0x40, 0x38, 0x40, 0x38, 0xC0, 0x38, 0xC0, 0x3E, 0x80, 0x1F, 0xF0,
+  0x07, 0xF8, 0x01, 0xFC, 0x01, 0x9E, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x1E,
+  0xC3, 0x3C, 0xFF, 0xFC, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0x00, 0x02, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x0E, 0x3F, 0xC0, 0x1C,
+  0x70, 0xE0, 0x38, 0x60, 0x60, 0x30, 0xC0, 0x60, 0x60, 0xC0, 0x60, 0xC0,
+  0xC0, 0x61, 0xC0, 0xC0, 0x63, 0x80, 0xC0, 0xC7, 0x00, 0xE1, 0xC6, 0x00,
+  0x7F, 0x8C, 0x00, 0x3E, 0x18, 0x7C, 0x00, 0x39, 0xFE, 0x00, 0x73, 0x87,
+  0x00, 0xE3, 0x03, 0x00, 0xC6, 0x03, 0x01, 0x86, 0x03, 0x03, 0x06, 0x03,
+  0x07, 0x06, 0x03, 0x0E, 0x06, 0x06, 0x1C, 0x07, 0x0E, 0x18, 0x03, 0xFC,
+  0x30, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07,
+  0x82, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x03, 0xF0, 0x00, 0x3B, 0xC0, 0x73, 0x8F,
+  0x03, 0x38, 0x3C, 0x39, 0x80, 0xF1, 0x9C, 0x07, 0x9C, 0xE0, 0x1F, 0xC7,
+  0x00, 0x7C, 0x3C, 0x03, 0xE1, 0xF0, 0x7F, 0x07, 0xFF, 0xFC, 0x1F, 0xFE,
+  0xF0, 0x3F, 0xC7, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x38, 0x0E, 0x03,
+  0x80, 0x70, 0x1C, 0x07, 0x80, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x38, 0x07,
+  0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
+  0xC0, 0x18, 0x03, 0x80, 0x70, 0x06, 0x00, 0xE0, 0x0C, 0x00, 0x03, 0x00,
+  0x70, 0x06, 0x00, 0xE0, 0x1C, 0x01, 0x80, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x78, 0x0E,
+  0x03, 0xC0, 0x70, 0x1E, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x70,
+  0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x10, 0xC2, 0xF3, 0x3C, 0xFF, 0xC0,
+  0xFC, 0x03, 0xF0, 0x3F, 0xF3, 0xCC, 0xF4, 0x30, 0x80, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00,
+  0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00,
+  0x1C, 0xF3, 0x8C, 0x71, 0x8C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x77,
+  0xEE, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00,
+  0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x01,
+  0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60,
+  0x00, 0xE0, 0x00, 0x00, 0xF8, 0x01, 0xFF, 0x01, 0xFF, 0xC1, 0xE1, 0xE1,
+  0xE0, 0x79, 0xE0, 0x1C, 0xE0, 0x0E, 0xF0, 0x07, 0x70, 0x03, 0xB8, 0x01,
+  0xDC, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x1D, 0xC0,
+  0x1E, 0xE0, 0x0E, 0x70, 0x0F, 0x3C, 0x0F, 0x0F, 0x0F, 0x07, 0xFF, 0x01,
+  0xFF, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0, 0x63, 0x80,
+  0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x0F, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x07, 0x80, 0x0E, 0x00, 0x1C, 0x0F, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0x00,
+  0x01, 0xFC, 0x03, 0xFF, 0xC0, 0xFF, 0xF8, 0x30, 0x1F, 0x00, 0x01, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0x3F,
+  0xFF, 0x8F, 0xFF, 0xE0, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF8, 0x30,
+  0x1F, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x03, 0xC0, 0x3F, 0xE0, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0x07, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xE3, 0x00,
+  0xF8, 0xFF, 0xFC, 0x3F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x07,
+  0xC0, 0x06, 0xE0, 0x07, 0xE0, 0x07, 0x70, 0x07, 0x38, 0x03, 0x1C, 0x03,
+  0x0E, 0x03, 0x8F, 0x03, 0x87, 0x03, 0x83, 0x83, 0x81, 0xC1, 0x80, 0xE1,
+  0xC0, 0x71, 0xC0, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
+  0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x07, 0xFF, 0x83,
+  0xFF, 0xC1, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0F, 0xF0, 0x0F, 0xFE, 0x07, 0xFF, 0x83, 0x03, 0xE0, 0x00,
+  0xF0, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x98, 0x0F, 0x8F, 0xFF, 0x87, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xFE,
+  0x03, 0xFF, 0x07, 0xFF, 0x0F, 0x83, 0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0x71, 0xF0, 0x77, 0xF8, 0xFF, 0xFC, 0xFC, 0x1E,
+  0xF0, 0x0E, 0xF0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x1C, 0xE0, 0x1C,
+  0x70, 0x78, 0x7F, 0xF8, 0x3F, 0xE0, 0x0F, 0xC0, 0x7F, 0xFF, 0xBF, 0xFF,
+  0xDF, 0xFF, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00,
+  0x07, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x01,
+  0xFF, 0x01, 0xFF, 0xC1, 0xE1, 0xF1, 0xE0, 0x38, 0xE0, 0x1C, 0x70, 0x0E,
+  0x38, 0x07, 0x1C, 0x07, 0x07, 0x07, 0x01, 0xFF, 0x00, 0xFE, 0x01, 0xFF,
+  0x81, 0xE1, 0xE1, 0xC0, 0x79, 0xC0, 0x1C, 0xE0, 0x0E, 0x70, 0x07, 0x38,
+  0x07, 0x9F, 0x07, 0x87, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0x00, 0x03, 0xF0,
+  0x07, 0xFC, 0x1F, 0xFE, 0x1E, 0x1E, 0x38, 0x07, 0x38, 0x07, 0x70, 0x07,
+  0x70, 0x07, 0x70, 0x0F, 0x70, 0x0F, 0x78, 0x3F, 0x3F, 0xFF, 0x1F, 0xEE,
+  0x0F, 0x8E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78,
+  0x81, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0x7E, 0x00, 0x1C, 0x73, 0x8E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xCE, 0x38, 0x07, 0x07, 0x0E, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x38, 0x38,
+  0x70, 0x60, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x1F,
+  0xE0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xF8, 0x00,
+  0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x1E, 0x00,
+  0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F,
+  0xE0, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x03, 0xFC, 0x01, 0xFE, 0x01, 0xFE,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0x80, 0x00, 0x80, 0x00,
+  0x00, 0x0F, 0x87, 0xFE, 0xFF, 0xFE, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x70,
+  0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x01, 0xE0, 0x1C, 0x03, 0x80, 0x38, 0x03,
+  0x80, 0x70, 0x00, 0x00, 0x00, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+  0x80, 0xFC, 0x07, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0x1E, 0x1E, 0x00, 0x00,
+  0xE1, 0xC0, 0xF9, 0x87, 0x38, 0x3F, 0xD8, 0x77, 0x87, 0xFF, 0x87, 0x70,
+  0xF8, 0x78, 0x77, 0x0E, 0x03, 0x07, 0xE1, 0xC0, 0x30, 0x7E, 0x1C, 0x03,
+  0x0E, 0xE1, 0xC0, 0x71, 0xEE, 0x1C, 0x07, 0x1C, 0xE1, 0xE1, 0xE7, 0x8E,
+  0x0F, 0xFF, 0xF0, 0xE0, 0xFF, 0x7E, 0x07, 0x03, 0xC7, 0x00, 0x70, 0x00,
+  0x00, 0x07, 0x80, 0x01, 0x00, 0x3E, 0x00, 0x70, 0x01, 0xF8, 0x1F, 0x00,
+  0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xDC,
+  0x00, 0x1E, 0xE0, 0x00, 0xE7, 0x00, 0x0E, 0x38, 0x00, 0xF1, 0xC0, 0x07,
+  0x0F, 0x00, 0x78, 0x38, 0x03, 0x81, 0xC0, 0x3C, 0x0E, 0x03, 0xC0, 0x70,
+  0x1C, 0x03, 0x81, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x87, 0x00,
+  0x1C, 0x70, 0x00, 0xE7, 0x80, 0x07, 0xB8, 0x00, 0x1F, 0xC0, 0x00, 0xE0,
+  0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0xFF, 0x0E, 0x00, 0xF1, 0xC0, 0x0E,
+  0x38, 0x01, 0xC7, 0x00, 0x38, 0xE0, 0x07, 0x1C, 0x01, 0xC7, 0x00, 0xF0,
+  0xFF, 0xFC, 0x1F, 0xFF, 0x03, 0xFF, 0xF8, 0x70, 0x0F, 0x1E, 0x00, 0x73,
+  0x80, 0x0E, 0x70, 0x01, 0xCE, 0x00, 0x39, 0xC0, 0x0E, 0x38, 0x07, 0xCF,
+  0xFF, 0xF1, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xFE,
+  0x07, 0xFF, 0xF0, 0xFC, 0x0F, 0x1F, 0x00, 0x21, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00,
+  0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0,
+  0x00, 0x0F, 0x00, 0x08, 0x78, 0x01, 0x87, 0xC0, 0x78, 0x3F, 0xFF, 0x01,
+  0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF,
+  0xFF, 0x07, 0x00, 0x7C, 0x1C, 0x00, 0x78, 0x70, 0x00, 0xE1, 0xC0, 0x01,
+  0xC7, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0xE0, 0x00, 0x73, 0x80, 0x01, 0xCE,
+  0x00, 0x07, 0x38, 0x00, 0x1C, 0xE0, 0x00, 0xE7, 0x80, 0x03, 0x9C, 0x00,
+  0x1E, 0x70, 0x00, 0x71, 0xC0, 0x03, 0x87, 0x00, 0x3E, 0x1C, 0x03, 0xF0,
+  0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE1,
+  0xFF, 0xFC, 0x3F, 0xFF, 0x8E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07,
+  0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFE, 0x1F,
+  0xFF, 0x83, 0xFF, 0xF0, 0x70, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x70,
+  0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x0F, 0xFF, 0xE1, 0xFF,
+  0xFC, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0xE3, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C,
+  0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0xFF, 0xC1, 0xC0, 0x01, 0xE0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0x80, 0xFF,
+  0xFE, 0x1F, 0x80, 0xF1, 0xF0, 0x01, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x03, 0xFD, 0xC0, 0x1F,
+  0xEE, 0x00, 0xFF, 0x70, 0x00, 0x73, 0x80, 0x03, 0x9C, 0x00, 0x1C, 0xE0,
+  0x00, 0xE7, 0x80, 0x07, 0x1E, 0x00, 0x70, 0xF8, 0x0F, 0x83, 0xFF, 0xFC,
+  0x0F, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x0E, 0x00, 0x1C, 0x38, 0x00, 0x70,
+  0xE0, 0x01, 0xC7, 0x00, 0x0E, 0x1C, 0x00, 0x38, 0x70, 0x00, 0xE1, 0xC0,
+  0x03, 0x87, 0x00, 0x0E, 0x1C, 0x00, 0x78, 0xE0, 0x01, 0xC3, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xE0, 0x01, 0xC7, 0x80, 0x0E, 0x1C,
+  0x00, 0x38, 0x70, 0x00, 0xE1, 0xC0, 0x03, 0x87, 0x00, 0x0E, 0x1C, 0x00,
+  0x38, 0xE0, 0x01, 0xC3, 0x80, 0x07, 0x0E, 0x00, 0x1C, 0x00, 0x0E, 0x1C,
+  0x38, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x70, 0xE1, 0xC3, 0x87, 0x1E, 0x38,
+  0x70, 0xE1, 0xC3, 0x8E, 0x1C, 0x38, 0x00, 0x00, 0x38, 0x01, 0xC0, 0x1E,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x00, 0xE0, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E,
+  0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x07, 0x00,
+  0x78, 0x3F, 0x81, 0xF8, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0xF8, 0x38, 0x07,
+  0xC0, 0xE0, 0x3E, 0x07, 0x01, 0xF0, 0x1C, 0x1F, 0x00, 0x70, 0xF8, 0x01,
+  0xC7, 0xC0, 0x07, 0x7C, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xEF, 0x00, 0x07, 0x9E, 0x00,
+  0x1C, 0x3C, 0x00, 0x70, 0x78, 0x01, 0xC0, 0xF0, 0x07, 0x01, 0xC0, 0x1C,
+  0x07, 0x80, 0xF0, 0x0F, 0x03, 0x80, 0x1E, 0x0E, 0x00, 0x3C, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x1E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0x80, 0x0F, 0x87, 0xC0,
+  0x07, 0xC3, 0xE0, 0x07, 0xE3, 0xB8, 0x03, 0xE1, 0xDC, 0x03, 0xF0, 0xEE,
+  0x01, 0xB8, 0x77, 0x01, 0xDC, 0x3B, 0x80, 0xCE, 0x1C, 0xC0, 0xCF, 0x1C,
+  0x60, 0x67, 0x0E, 0x30, 0x63, 0x87, 0x1C, 0x71, 0xC3, 0x8E, 0x30, 0xE1,
+  0xC3, 0x38, 0x71, 0xE1, 0x98, 0x70, 0xE0, 0xDC, 0x38, 0x70, 0x6C, 0x1C,
+  0x38, 0x3C, 0x0E, 0x1C, 0x1E, 0x07, 0x0E, 0x00, 0x03, 0x8E, 0x00, 0x03,
+  0x87, 0x00, 0x01, 0xC3, 0x80, 0x00, 0xE0, 0x0F, 0x80, 0x1C, 0x3E, 0x00,
+  0x70, 0xFC, 0x01, 0xC7, 0x70, 0x0E, 0x1D, 0xC0, 0x38, 0x73, 0x80, 0xE1,
+  0xCE, 0x03, 0x87, 0x3C, 0x0E, 0x1C, 0x70, 0x78, 0xE1, 0xC1, 0xC3, 0x87,
+  0x87, 0x0E, 0x0E, 0x1C, 0x38, 0x38, 0x70, 0xE0, 0x71, 0xC7, 0x81, 0xCE,
+  0x1C, 0x07, 0x38, 0x70, 0x0E, 0xE1, 0xC0, 0x3B, 0x87, 0x00, 0xFE, 0x1C,
+  0x01, 0xF8, 0xE0, 0x07, 0xC3, 0x80, 0x1F, 0x0E, 0x00, 0x3C, 0x00, 0x00,
+  0x3F, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x03, 0xF0, 0x3C, 0x0F, 0x00,
+  0x78, 0x78, 0x00, 0xE3, 0xC0, 0x01, 0xCE, 0x00, 0x07, 0x70, 0x00, 0x1D,
+  0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80,
+  0x00, 0xEE, 0x00, 0x03, 0xB8, 0x00, 0x1C, 0xE0, 0x00, 0xF1, 0xC0, 0x07,
+  0x87, 0x80, 0x3C, 0x1F, 0x03, 0xF0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00,
+  0x3F, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF8, 0x70, 0x1F,
+  0x1C, 0x01, 0xC7, 0x00, 0x71, 0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x03, 0xCE,
+  0x00, 0xE3, 0x80, 0xF8, 0xFF, 0xFC, 0x3F, 0xFE, 0x0F, 0xFC, 0x07, 0x80,
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF,
+  0x80, 0x3F, 0xFF, 0x03, 0xF0, 0x3E, 0x0F, 0x00, 0x78, 0x78, 0x00, 0xE3,
+  0xC0, 0x01, 0xCE, 0x00, 0x07, 0x70, 0x00, 0x1D, 0xC0, 0x00, 0x7F, 0x00,
+  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xEE, 0x00, 0x03,
+  0xB8, 0x00, 0x1C, 0xE0, 0x00, 0xF3, 0xC0, 0x07, 0x87, 0x80, 0x3C, 0x1F,
+  0x03, 0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFE,
+  0x03, 0xFF, 0xC0, 0xFF, 0xF8, 0x70, 0x1F, 0x1C, 0x01, 0xC7, 0x00, 0x71,
+  0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x03, 0x8E, 0x03, 0xC3, 0xFF, 0xE0, 0xFF,
+  0xE0, 0x3F, 0xFC, 0x0E, 0x07, 0x87, 0x80, 0xE1, 0xC0, 0x3C, 0x70, 0x07,
+  0x1C, 0x01, 0xC7, 0x00, 0x79, 0xC0, 0x0E, 0xE0, 0x03, 0xB8, 0x00, 0xEE,
+  0x00, 0x1C, 0x00, 0x7F, 0x80, 0xFF, 0xF0, 0x7F, 0xFC, 0x3E, 0x03, 0x0E,
+  0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0xE0,
+  0x00, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x38,
+  0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x71, 0x80, 0x7C, 0x7F,
+  0xFE, 0x3F, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xE0, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00,
+  0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00,
+  0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x78, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x38, 0x00, 0x73,
+  0x80, 0x0F, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x38, 0x00, 0xE7, 0x80, 0x0E,
+  0x70, 0x01, 0xE7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00, 0x1C, 0x70, 0x01,
+  0xCE, 0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x03, 0x8E, 0x00,
+  0x70, 0xF0, 0x0F, 0x07, 0x83, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x0F,
+  0xE0, 0x00, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xB8, 0x00, 0x3C, 0xE0, 0x03,
+  0xC7, 0x00, 0x1C, 0x38, 0x01, 0xE1, 0xC0, 0x0E, 0x0E, 0x00, 0xF0, 0x78,
+  0x07, 0x01, 0xC0, 0x78, 0x0E, 0x07, 0x80, 0x70, 0x38, 0x03, 0x83, 0xC0,
+  0x1C, 0x1C, 0x00, 0x71, 0xE0, 0x03, 0x8E, 0x00, 0x1C, 0xE0, 0x00, 0xEF,
+  0x00, 0x07, 0x70, 0x00, 0x3F, 0x80, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
+  0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00, 0x78, 0x03, 0xB8, 0x07,
+  0xC0, 0x1D, 0xC0, 0x3E, 0x01, 0xCE, 0x01, 0xF0, 0x0E, 0x70, 0x1D, 0x80,
+  0xF3, 0x80, 0xEC, 0x07, 0x1C, 0x0E, 0x70, 0x78, 0x70, 0x73, 0x83, 0x83,
+  0x83, 0x1C, 0x1C, 0x1C, 0x38, 0xE1, 0xC0, 0xE1, 0x87, 0x0E, 0x07, 0x1C,
+  0x38, 0xE0, 0x38, 0xE1, 0xC7, 0x01, 0xC6, 0x0E, 0x78, 0x0E, 0x70, 0x33,
+  0x80, 0x73, 0x01, 0xBC, 0x03, 0xB8, 0x0F, 0xC0, 0x1D, 0x80, 0x7E, 0x00,
+  0xEC, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0,
+  0x07, 0x80, 0x00, 0x03, 0x80, 0x1E, 0x07, 0x00, 0x78, 0x0F, 0x01, 0xE0,
+  0x0E, 0x07, 0x80, 0x1E, 0x1E, 0x00, 0x1C, 0x78, 0x00, 0x3C, 0xF0, 0x00,
+  0x3B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7B, 0xC0, 0x01, 0xE3,
+  0x80, 0x07, 0x87, 0x00, 0x0F, 0x07, 0x00, 0x3C, 0x0E, 0x00, 0xF0, 0x0E,
+  0x03, 0xC0, 0x1C, 0x0F, 0x00, 0x1C, 0x3C, 0x00, 0x38, 0x00, 0xF0, 0x01,
+  0xEE, 0x00, 0x79, 0xE0, 0x1E, 0x1C, 0x07, 0x83, 0xC0, 0xF0, 0x38, 0x3C,
+  0x07, 0x8F, 0x00, 0x73, 0xC0, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x00,
+  0x01, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F,
+  0xFF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xE0, 0xFC,
+  0x1F, 0x87, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x1E, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x1F, 0x83, 0xF0, 0x7E, 0x00,
+  0xE3, 0x8E, 0x38, 0x61, 0x86, 0x18, 0x71, 0xC7, 0x1C, 0x70, 0xC3, 0x0C,
+  0x38, 0xE3, 0x8E, 0x38, 0x61, 0x86, 0x18, 0x0F, 0xE1, 0xFC, 0x3F, 0x80,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x1F, 0x83, 0xF0, 0x7E, 0x00, 0x00, 0xE0,
+  0x00, 0x3E, 0x00, 0x0E, 0xE0, 0x03, 0x8E, 0x00, 0xE0, 0xE0, 0x78, 0x0E,
+  0x1E, 0x00, 0xF7, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1,
+  0xC3, 0x0E, 0x18, 0x70, 0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0xFE, 0x18, 0x0F,
+  0x00, 0x07, 0x00, 0x07, 0x07, 0xFF, 0x1F, 0xFF, 0x7F, 0xFE, 0x78, 0x0E,
+  0xE0, 0x0E, 0xE0, 0x1E, 0xE0, 0x3E, 0xF0, 0x7C, 0xFF, 0xDC, 0x7F, 0x9C,
+  0x1F, 0x1C, 0x07, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x3C, 0xF8, 0x1C, 0xFE, 0x0E, 0xFF, 0x87,
+  0xC3, 0xE3, 0xC0, 0xF3, 0xC0, 0x39, 0xE0, 0x1C, 0xE0, 0x0E, 0x70, 0x07,
+  0x38, 0x03, 0xB8, 0x03, 0x9E, 0x01, 0xCF, 0x01, 0xC7, 0xC3, 0xE3, 0xFF,
+  0xE3, 0x9F, 0xE1, 0xC7, 0xC0, 0x01, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0xF0,
+  0x33, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0F, 0x00, 0x1F, 0x02, 0x1F, 0xFC, 0x1F, 0xF8, 0x0F,
+  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03,
+  0x80, 0x00, 0xE0, 0x00, 0x38, 0x0F, 0x1C, 0x0F, 0xF7, 0x07, 0xFD, 0xC3,
+  0xE1, 0xF0, 0xE0, 0x3C, 0x70, 0x0E, 0x1C, 0x03, 0x8E, 0x00, 0xE3, 0x80,
+  0x38, 0xE0, 0x1E, 0x38, 0x07, 0x0E, 0x03, 0xC3, 0xC0, 0xF0, 0xF8, 0xFC,
+  0x1F, 0xFF, 0x03, 0xFB, 0x80, 0x78, 0xE0, 0x01, 0xF0, 0x07, 0xFC, 0x1F,
+  0xFE, 0x3E, 0x1E, 0x38, 0x07, 0x70, 0x07, 0x70, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x04, 0xF8, 0x18, 0x7F,
+  0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0xC3, 0xFE, 0x1C, 0x00,
+  0xE0, 0x0E, 0x00, 0x70, 0x1F, 0xFC, 0xFF, 0xE7, 0xFE, 0x06, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x03, 0xE3, 0x87, 0xF9,
+  0xC7, 0xFF, 0xE7, 0xC3, 0xE3, 0x80, 0xF3, 0xC0, 0x39, 0xC0, 0x1D, 0xE0,
+  0x0E, 0xE0, 0x0E, 0x70, 0x07, 0x38, 0x03, 0x9C, 0x03, 0xCF, 0x03, 0xE7,
+  0xC3, 0xE1, 0xFF, 0xF0, 0x7F, 0xB8, 0x1F, 0x3C, 0x00, 0x1C, 0x00, 0x1E,
+  0x10, 0x3E, 0x0F, 0xFE, 0x07, 0xFE, 0x01, 0xFC, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E,
+  0x7C, 0x1C, 0xFE, 0x1D, 0xFF, 0x1F, 0x0F, 0x1E, 0x07, 0x3C, 0x07, 0x38,
+  0x07, 0x38, 0x07, 0x38, 0x0F, 0x38, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70,
+  0x0E, 0x70, 0x0E, 0x70, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x07, 0x07, 0x0E,
+  0x0E, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0x00, 0x38, 0x01,
+  0xC0, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70,
+  0x07, 0x80, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x03, 0xC0, 0xFC, 0x07, 0xC0, 0x3C, 0x00, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x00, 0x78, 0x3E, 0x1C, 0x1F, 0x07, 0x0F, 0x81, 0xC7, 0xC0, 0x77,
+  0xC0, 0x3B, 0xE0, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0x80,
+  0x1C, 0xF0, 0x07, 0x1E, 0x01, 0xC3, 0xC0, 0x70, 0x78, 0x1C, 0x0F, 0x0E,
+  0x01, 0xE3, 0x80, 0x78, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0xE0, 0xE0, 0x1C, 0x7C, 0x0F, 0x83, 0xBF, 0xC7, 0xF8, 0x7F,
+  0xFD, 0xFF, 0x9F, 0x87, 0xF0, 0xF3, 0xE0, 0x7C, 0x0E, 0x78, 0x0F, 0x01,
+  0xCE, 0x01, 0xC0, 0x39, 0xC0, 0x38, 0x07, 0x78, 0x07, 0x00, 0xEE, 0x01,
+  0xC0, 0x39, 0xC0, 0x38, 0x07, 0x38, 0x07, 0x00, 0xE7, 0x00, 0xE0, 0x1C,
+  0xE0, 0x1C, 0x03, 0xBC, 0x07, 0x80, 0xE7, 0x00, 0xE0, 0x1C, 0xE0, 0x1C,
+  0x03, 0x80, 0x1C, 0x7C, 0x1D, 0xFE, 0x1F, 0xFF, 0x3F, 0x0F, 0x3E, 0x07,
+  0x3C, 0x07, 0x38, 0x07, 0x38, 0x07, 0x78, 0x0F, 0x70, 0x0E, 0x70, 0x0E,
+  0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
+  0x03, 0xF0, 0x0F, 0xFC, 0x1F, 0xFE, 0x3E, 0x1E, 0x38, 0x0F, 0x70, 0x07,
+  0x70, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0E, 0xE0, 0x0E,
+  0xF0, 0x1C, 0x78, 0x7C, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x07, 0x3E,
+  0x01, 0xDF, 0xE0, 0xFF, 0xF8, 0x3F, 0x1F, 0x0F, 0x03, 0xC3, 0x80, 0x70,
+  0xE0, 0x1C, 0x78, 0x07, 0x1C, 0x01, 0xC7, 0x00, 0x71, 0xC0, 0x38, 0xF0,
+  0x0E, 0x3C, 0x07, 0x0F, 0x87, 0xC3, 0xFF, 0xE0, 0xEF, 0xF0, 0x71, 0xF0,
+  0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E,
+  0x00, 0x00, 0x03, 0xE3, 0x87, 0xF9, 0xC7, 0xFF, 0xC7, 0xC3, 0xE3, 0x80,
+  0xF3, 0x80, 0x39, 0xC0, 0x3D, 0xC0, 0x1C, 0xE0, 0x0E, 0x70, 0x07, 0x38,
+  0x03, 0x9C, 0x03, 0xCF, 0x03, 0xC7, 0x83, 0xE1, 0xFF, 0x70, 0x7F, 0x38,
+  0x1F, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03,
+  0x80, 0x01, 0xC0, 0x1C, 0x78, 0xEF, 0xC7, 0xFE, 0x7E, 0x03, 0xE0, 0x1E,
+  0x00, 0xE0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x38, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x7F,
+  0xF9, 0xF0, 0x33, 0x80, 0x07, 0x80, 0x0F, 0xF0, 0x0F, 0xF8, 0x07, 0xF8,
+  0x00, 0xF8, 0x00, 0x70, 0x00, 0xE8, 0x03, 0xDE, 0x0F, 0x3F, 0xFE, 0x3F,
+  0xF8, 0x1F, 0xC0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x03, 0xC1, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x38, 0x07, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x7F, 0x87, 0xF0, 0x7E, 0x00, 0x38, 0x07,
+  0x38, 0x07, 0x38, 0x07, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E,
+  0x70, 0x0E, 0xF0, 0x1E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C,
+  0xF0, 0xFC, 0xFF, 0xF8, 0x7F, 0xB8, 0x3E, 0x38, 0xE0, 0x07, 0xF0, 0x03,
+  0xBC, 0x03, 0xCE, 0x03, 0xC7, 0x01, 0xC3, 0x81, 0xE1, 0xC0, 0xE0, 0xE0,
+  0xF0, 0x38, 0x70, 0x1C, 0x70, 0x0E, 0x78, 0x07, 0x38, 0x03, 0xBC, 0x00,
+  0xFC, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x38, 0x1F,
+  0xC0, 0xF0, 0x3B, 0x81, 0xE0, 0x77, 0x03, 0xC1, 0xCE, 0x0D, 0x83, 0x9C,
+  0x19, 0x8E, 0x38, 0x63, 0x1C, 0x38, 0xC6, 0x78, 0x73, 0x0C, 0xE0, 0xE6,
+  0x1B, 0xC1, 0xDC, 0x37, 0x03, 0xB0, 0x7E, 0x07, 0xE0, 0xF8, 0x0F, 0x81,
+  0xF0, 0x1F, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x78, 0x0E, 0x00, 0x0F, 0x03,
+  0xE0, 0xE0, 0x78, 0x1E, 0x1E, 0x01, 0xC7, 0x80, 0x3D, 0xE0, 0x03, 0xF8,
+  0x00, 0x7E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xE0,
+  0x03, 0xDC, 0x00, 0xF3, 0xC0, 0x3C, 0x38, 0x0F, 0x07, 0x83, 0xE0, 0x70,
+  0xF8, 0x0F, 0x00, 0x1C, 0x01, 0xE3, 0xC0, 0x38, 0x38, 0x0F, 0x07, 0x03,
+  0xC0, 0xE0, 0x70, 0x1C, 0x1E, 0x01, 0xC3, 0x80, 0x38, 0xF0, 0x07, 0x3C,
+  0x00, 0xE7, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xFF,
+  0x8F, 0xFF, 0xC7, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
+  0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x01,
+  0xE0, 0x01, 0xE0, 0x01, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x00,
+  0x3E, 0x01, 0xFC, 0x03, 0xF8, 0x0F, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xF0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x0F, 0xE0, 0x1F,
+  0x00, 0x3F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3C, 0x00,
+  0x7F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0,
+  0x07, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x03, 0x80, 0x07, 0x80, 0x07, 0xE0, 0x07, 0xC0, 0x3F, 0x80, 0xF0,
+  0x01, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x01,
+  0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x01, 0xF8, 0x07, 0xF0, 0x0F, 0x80,
+  0x00, 0x1F, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xE8, 0x01,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x1C, 0x70, 0xE0,
+  0x00, 0x00, 0x0E, 0x1C, 0x38, 0x61, 0xC3, 0x87, 0x0E, 0x3C, 0x70, 0xE1,
+  0xC3, 0x8F, 0x1C, 0x38, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0xC0, 0x01,
+  0x00, 0x1F, 0xC0, 0xFF, 0xC3, 0xFF, 0x8F, 0x33, 0x3C, 0x60, 0xF0, 0x81,
+  0xC3, 0x07, 0x06, 0x0E, 0x0C, 0x1C, 0x10, 0x38, 0x20, 0x70, 0xC0, 0xF1,
+  0x81, 0xF2, 0x31, 0xFF, 0xE1, 0xFF, 0x80, 0xFE, 0x00, 0x60, 0x00, 0xC0,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x80,
+  0x78, 0x30, 0x0E, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xE0, 0x7F,
+  0xFC, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x38,
+  0x00, 0x07, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0x40,
+  0x01, 0x70, 0x01, 0xDC, 0x71, 0xC7, 0xFF, 0xC1, 0xFF, 0xC0, 0xF1, 0xE0,
+  0x70, 0x70, 0x70, 0x1C, 0x38, 0x0E, 0x1C, 0x07, 0x07, 0x07, 0x03, 0xC7,
+  0x81, 0xFF, 0xC1, 0xFF, 0xF1, 0xC7, 0x1D, 0xC0, 0x07, 0x40, 0x01, 0x00,
+  0x1C, 0x00, 0xE1, 0xC0, 0x1E, 0x1C, 0x03, 0xC0, 0xE0, 0x78, 0x0E, 0x07,
+  0x00, 0xF0, 0xF0, 0x07, 0x1E, 0x00, 0x73, 0xC0, 0x07, 0xBC, 0x07, 0xFF,
+  0xF8, 0x7F, 0xFF, 0x80, 0x3E, 0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00, 0x7F,
+  0xFF, 0x0F, 0xFF, 0xF0, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00,
+  0x38, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFC, 0x07, 0xFC,
+  0x1F, 0xF8, 0x78, 0x20, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07,
+  0xC0, 0x3B, 0xC0, 0xE3, 0xE3, 0x81, 0xE7, 0x01, 0xCF, 0x03, 0x8F, 0x07,
+  0x0F, 0x1C, 0x0F, 0xF0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0x1C, 0x20, 0x78, 0x7F, 0xE0, 0xFF, 0x80, 0xFC, 0x00, 0x71, 0xFC, 0xFE,
+  0x38, 0x00, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xF0, 0x3C, 0x07, 0x00, 0x38,
+  0x38, 0x00, 0x71, 0xC3, 0xF0, 0xE6, 0x1F, 0xE1, 0x98, 0xE0, 0x86, 0xC7,
+  0x00, 0x0F, 0x18, 0x00, 0x3C, 0x60, 0x00, 0xF1, 0x80, 0x03, 0xC6, 0x00,
+  0x0F, 0x1C, 0x00, 0x36, 0x38, 0x21, 0x98, 0x7F, 0x86, 0x70, 0xFC, 0x38,
+  0xE0, 0x01, 0xC1, 0xC0, 0x0E, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x80, 0x03,
+  0xF0, 0x00, 0x07, 0xE0, 0xFF, 0x84, 0x0E, 0x00, 0x30, 0xFF, 0x9F, 0xFC,
+  0xC0, 0xEC, 0x06, 0x60, 0x73, 0x87, 0x8F, 0xEC, 0x3C, 0xE0, 0x00, 0x00,
+  0x03, 0xFF, 0x9F, 0xFC, 0x00, 0x81, 0x01, 0x83, 0x03, 0x07, 0x0F, 0x1E,
+  0x1C, 0x38, 0x78, 0xF0, 0xF1, 0xE0, 0xE1, 0xC0, 0x70, 0xE0, 0x38, 0x70,
+  0x1C, 0x38, 0x0E, 0x1C, 0x04, 0x0C, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xF0, 0x3C, 0x07, 0x00, 0x38, 0x38, 0x00,
+  0x71, 0xC7, 0xE0, 0xE6, 0x1F, 0xC1, 0x98, 0x61, 0x86, 0xC1, 0x86, 0x0F,
+  0x06, 0x18, 0x3C, 0x1F, 0xC0, 0xF0, 0x7E, 0x03, 0xC1, 0x98, 0x0F, 0x06,
+  0x30, 0x36, 0x18, 0xE1, 0x98, 0x61, 0x86, 0x71, 0x83, 0x38, 0xE0, 0x01,
+  0xC1, 0xC0, 0x0E, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0D, 0x86, 0x7F, 0x87, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80,
+  0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x87, 0xF8, 0xC3, 0x80, 0x30, 0x06,
+  0x01, 0xC0, 0x70, 0x3C, 0x0E, 0x03, 0x81, 0xE0, 0x7F, 0xEF, 0xFC, 0x0F,
+  0x83, 0xFC, 0x41, 0x80, 0x30, 0x0C, 0x1F, 0x03, 0xE0, 0x0E, 0x00, 0xC0,
+  0x1A, 0x07, 0x7F, 0xC7, 0xE0, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0x07,
+  0x00, 0xE0, 0xE0, 0x1C, 0x3C, 0x03, 0x87, 0x00, 0xE0, 0xE0, 0x1C, 0x1C,
+  0x03, 0x83, 0x80, 0x70, 0xE0, 0x0E, 0x1C, 0x03, 0x83, 0x80, 0x70, 0x70,
+  0x0E, 0x1E, 0x03, 0xC3, 0xC0, 0x78, 0x7C, 0x3F, 0x0F, 0xFE, 0xF1, 0xDF,
+  0x9E, 0x71, 0xE3, 0x8E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xFC, 0xFF, 0x1B,
+  0xFE, 0x37, 0xF8, 0xFF, 0xF1, 0xBF, 0xE3, 0x7F, 0xC6, 0xFF, 0x8D, 0xFE,
+  0x39, 0xFC, 0x63, 0xF8, 0xC1, 0xF1, 0x80, 0x63, 0x01, 0x8C, 0x03, 0x18,
+  0x06, 0x30, 0x0C, 0x60, 0x38, 0xC0, 0x63, 0x00, 0xC6, 0x01, 0x8C, 0x03,
+  0x18, 0x0E, 0x30, 0x18, 0xC0, 0x31, 0x80, 0x77, 0xEE, 0x0C, 0x0C, 0x18,
+  0x7F, 0xDF, 0x00, 0x1E, 0x7C, 0x98, 0x60, 0xC1, 0x83, 0x06, 0x1C, 0x30,
+  0x67, 0xFF, 0xE0, 0x07, 0xE0, 0x7F, 0x87, 0x0E, 0x60, 0x33, 0x01, 0xB0,
+  0x0D, 0x80, 0x6C, 0x07, 0x60, 0x33, 0x87, 0x0F, 0xF0, 0x1F, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x9F, 0xFC, 0x20, 0x40, 0x30, 0x20, 0x38, 0x70, 0x1C,
+  0x38, 0x0E, 0x1C, 0x07, 0x0E, 0x03, 0x87, 0x07, 0x8F, 0x0F, 0x1E, 0x1C,
+  0x38, 0x78, 0xF0, 0xE0, 0xC0, 0xC1, 0x80, 0x81, 0x00, 0x1E, 0x00, 0x06,
+  0x07, 0xC0, 0x01, 0xC0, 0x98, 0x00, 0x70, 0x06, 0x00, 0x1C, 0x00, 0xC0,
+  0x07, 0x00, 0x18, 0x01, 0xC0, 0x03, 0x00, 0x30, 0x00, 0x60, 0x0E, 0x00,
+  0x1C, 0x03, 0x80, 0x03, 0x00, 0xE0, 0x00, 0x60, 0x38, 0x03, 0xFF, 0x0E,
+  0x00, 0xFF, 0xE1, 0x80, 0x36, 0x00, 0x70, 0x0C, 0x80, 0x1C, 0x03, 0x30,
+  0x07, 0x00, 0x46, 0x01, 0xC0, 0x10, 0xC0, 0x30, 0x04, 0x18, 0x0C, 0x01,
+  0xFF, 0x83, 0x80, 0x3F, 0xF0, 0xE0, 0x00, 0x18, 0x38, 0x00, 0x03, 0x0E,
+  0x00, 0x00, 0x60, 0x1E, 0x00, 0x06, 0x03, 0xE0, 0x00, 0xE0, 0x26, 0x00,
+  0x1C, 0x00, 0xC0, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x00, 0xC0, 0x0E, 0x00,
+  0x0C, 0x00, 0xC0, 0x00, 0xC0, 0x1C, 0x00, 0x1C, 0x03, 0x80, 0x01, 0x80,
+  0x70, 0x00, 0x18, 0x0E, 0x07, 0xCF, 0xE1, 0xC1, 0xFE, 0xFE, 0x18, 0x18,
+  0x70, 0x03, 0x80, 0x03, 0x00, 0x70, 0x00, 0x30, 0x0E, 0x00, 0x07, 0x01,
+  0xC0, 0x00, 0xE0, 0x18, 0x00, 0x3C, 0x03, 0x00, 0x07, 0x00, 0x70, 0x00,
+  0xE0, 0x0E, 0x00, 0x3C, 0x01, 0xC0, 0x07, 0xFE, 0x38, 0x00, 0x7F, 0xE0,
+  0x0F, 0x80, 0x03, 0x01, 0xFE, 0x00, 0x70, 0x10, 0x60, 0x0E, 0x00, 0x06,
+  0x01, 0xC0, 0x00, 0xC0, 0x38, 0x00, 0xF8, 0x07, 0x00, 0x0F, 0x80, 0x60,
+  0x00, 0x1C, 0x0E, 0x00, 0x00, 0xC1, 0xC0, 0x00, 0x0C, 0x38, 0x00, 0x81,
+  0xC7, 0x00, 0x7F, 0xF8, 0xE0, 0x0F, 0x7E, 0x0C, 0x01, 0xB0, 0x01, 0xC0,
+  0x32, 0x00, 0x38, 0x06, 0x60, 0x07, 0x00, 0x46, 0x00, 0xE0, 0x08, 0x60,
+  0x0C, 0x01, 0x06, 0x01, 0x80, 0x3F, 0xF0, 0x38, 0x03, 0xFF, 0x07, 0x00,
+  0x00, 0xC0, 0xE0, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0xC0, 0x00, 0x70, 0x07,
+  0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x03, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x1F, 0x07, 0xFF, 0xE7, 0xFE, 0x3F, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x60, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07,
+  0x70, 0x00, 0x7B, 0x80, 0x03, 0x9C, 0x00, 0x38, 0xE0, 0x03, 0xC7, 0x00,
+  0x1C, 0x3C, 0x01, 0xE0, 0xE0, 0x0E, 0x07, 0x00, 0xF0, 0x38, 0x0F, 0x01,
+  0xC0, 0x70, 0x0E, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFE, 0x1C,
+  0x00, 0x71, 0xC0, 0x03, 0x9E, 0x00, 0x1E, 0xE0, 0x00, 0x7F, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x80, 0x00, 0xFC, 0x00, 0x07, 0x70, 0x00, 0x7B, 0x80, 0x03, 0x9C, 0x00,
+  0x38, 0xE0, 0x03, 0xC7, 0x00, 0x1C, 0x3C, 0x01, 0xE0, 0xE0, 0x0E, 0x07,
+  0x00, 0xF0, 0x38, 0x0F, 0x01, 0xC0, 0x70, 0x0E, 0x07, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xC3, 0xFF, 0xFE, 0x1C, 0x00, 0x71, 0xC0, 0x03, 0x9E, 0x00, 0x1E,
+  0xE0, 0x00, 0x7F, 0x00, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x1B, 0x00,
+  0x01, 0x8C, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0x70, 0x00,
+  0x7B, 0x80, 0x03, 0x9C, 0x00, 0x38, 0xE0, 0x03, 0xC7, 0x00, 0x1C, 0x3C,
+  0x01, 0xE0, 0xE0, 0x0E, 0x07, 0x00, 0xF0, 0x38, 0x0F, 0x01, 0xC0, 0x70,
+  0x0E, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFE, 0x1C, 0x00, 0x71,
+  0xC0, 0x03, 0x9E, 0x00, 0x1E, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0x80, 0x00,
+  0x07, 0x0C, 0x00, 0x3E, 0x60, 0x01, 0xCF, 0x80, 0x06, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80,
+  0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0x70, 0x00, 0x3D, 0xC0, 0x00,
+  0xE7, 0x00, 0x07, 0x1C, 0x00, 0x3C, 0x70, 0x00, 0xE1, 0xE0, 0x07, 0x83,
+  0x80, 0x1C, 0x0E, 0x00, 0xF0, 0x38, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0x80,
+  0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x70, 0x01, 0xC3, 0x80,
+  0x07, 0x1E, 0x00, 0x1E, 0x70, 0x00, 0x3B, 0xC0, 0x00, 0xE0, 0x00, 0x0E,
+  0x38, 0x00, 0xF3, 0xC0, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC,
+  0x00, 0x07, 0x70, 0x00, 0x7B, 0x80, 0x03, 0x9C, 0x00, 0x38, 0xE0, 0x03,
+  0xC7, 0x00, 0x1C, 0x3C, 0x01, 0xE0, 0xE0, 0x0E, 0x07, 0x00, 0xF0, 0x38,
+  0x0F, 0x01, 0xC0, 0x70, 0x0E, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF,
+  0xFE, 0x1C, 0x00, 0x71, 0xC0, 0x03, 0x9E, 0x00, 0x1E, 0xE0, 0x00, 0x7F,
+  0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x7E, 0x00, 0x07, 0x38, 0x00,
+  0x30, 0xC0, 0x01, 0x86, 0x00, 0x0E, 0x70, 0x00, 0x3F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0x80, 0x03,
+  0x9C, 0x00, 0x3C, 0xE0, 0x03, 0xC7, 0x00, 0x1C, 0x38, 0x01, 0xE1, 0xE0,
+  0x0E, 0x07, 0x00, 0xF0, 0x38, 0x07, 0x01, 0xC0, 0x70, 0x0E, 0x07, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFE, 0x1C, 0x00, 0x71, 0xE0, 0x03, 0x9E,
+  0x00, 0x1E, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xFF,
+  0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0E, 0x70, 0x00,
+  0x00, 0x1E, 0x70, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x00, 0x38, 0xF0, 0x00,
+  0x00, 0x78, 0xE0, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0xF0, 0xE0, 0x00,
+  0x01, 0xE0, 0xFF, 0xFC, 0x01, 0xC1, 0xFF, 0xF8, 0x03, 0xC1, 0xFF, 0xF8,
+  0x03, 0x81, 0xC0, 0x00, 0x07, 0x81, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1C, 0x03, 0x80, 0x00,
+  0x3C, 0x03, 0x80, 0x00, 0x78, 0x03, 0xFF, 0xF0, 0x70, 0x03, 0xFF, 0xF0,
+  0xF0, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x1F, 0xFE, 0x07, 0xFF, 0xF0,
+  0xFC, 0x0F, 0x1F, 0x00, 0x21, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00,
+  0x70, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00,
+  0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+  0x08, 0x78, 0x01, 0x87, 0xC0, 0x78, 0x3F, 0xFF, 0x01, 0xFF, 0xE0, 0x07,
+  0xF8, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0xE0, 0x00,
+  0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x60,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF,
+  0x0F, 0xFF, 0xE3, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xE0,
+  0xFF, 0xFC, 0x1C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F,
+  0xFF, 0xE0, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xE3,
+  0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07,
+  0x00, 0x01, 0xC0, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xE0, 0xFF, 0xFC, 0x1C,
+  0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70,
+  0x00, 0x0E, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xE0, 0x00,
+  0x1E, 0x00, 0x06, 0xC0, 0x01, 0x8C, 0x00, 0x61, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xE3, 0x80, 0x00, 0x70,
+  0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xC0,
+  0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xE0, 0xFF, 0xFC, 0x1C, 0x00, 0x07, 0x80,
+  0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0xE3, 0x80, 0x3C,
+  0xF0, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xE3, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xFF,
+  0x87, 0xFF, 0xE0, 0xFF, 0xFC, 0x1C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x03, 0xFF, 0xF8,
+  0x7F, 0xFF, 0x0F, 0xFF, 0xE0, 0x0E, 0x03, 0x80, 0xC0, 0x30, 0x00, 0x00,
+  0x38, 0x1C, 0x0E, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x07, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x38, 0x1C,
+  0x0E, 0x00, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0x70, 0x0E, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x03, 0xC0, 0x6C, 0x0C, 0x61, 0x87,
+  0x00, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0,
+  0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80,
+  0x78, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00,
+  0xE0, 0x00, 0x1C, 0x73, 0xCF, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x78, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x07, 0xFF,
+  0x80, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x70, 0x07, 0xC0, 0xE0, 0x03,
+  0xC1, 0xC0, 0x03, 0x83, 0x80, 0x03, 0x87, 0x00, 0x07, 0x0E, 0x00, 0x0E,
+  0x38, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xE3,
+  0x80, 0x03, 0x87, 0x00, 0x07, 0x1C, 0x00, 0x1E, 0x38, 0x00, 0x38, 0x70,
+  0x00, 0xE0, 0xE0, 0x07, 0xC1, 0xC0, 0x3F, 0x07, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x60, 0x01, 0xF3, 0x00, 0x0E,
+  0x7C, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x07, 0x0F, 0x80, 0x1C, 0x3F, 0x00, 0x71, 0xDC, 0x03, 0x87,
+  0x70, 0x0E, 0x1C, 0xE0, 0x38, 0x73, 0x80, 0xE1, 0xCF, 0x03, 0x87, 0x1C,
+  0x1E, 0x38, 0x70, 0x70, 0xE1, 0xE1, 0xC3, 0x83, 0x87, 0x0E, 0x0E, 0x1C,
+  0x38, 0x1C, 0x71, 0xE0, 0x73, 0x87, 0x01, 0xCE, 0x1C, 0x03, 0xB8, 0x70,
+  0x0E, 0xE1, 0xC0, 0x3F, 0x87, 0x00, 0x7E, 0x38, 0x01, 0xF0, 0xE0, 0x07,
+  0xC3, 0x80, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0x7F, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0x07, 0x87, 0x80,
+  0x0E, 0x3C, 0x00, 0x1C, 0xE0, 0x00, 0x77, 0x00, 0x01, 0xDC, 0x00, 0x07,
+  0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0E, 0xE0,
+  0x00, 0x3B, 0x80, 0x01, 0xCE, 0x00, 0x0F, 0x1C, 0x00, 0x78, 0x78, 0x03,
+  0xC1, 0xF0, 0x3F, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+  0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0x07, 0x87, 0x80, 0x0E, 0x3C, 0x00, 0x1C,
+  0xE0, 0x00, 0x77, 0x00, 0x01, 0xDC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80,
+  0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0E, 0xE0, 0x00, 0x3B, 0x80, 0x01,
+  0xCE, 0x00, 0x0F, 0x1C, 0x00, 0x78, 0x78, 0x03, 0xC1, 0xF0, 0x3F, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x1B, 0x00, 0x00, 0xC6, 0x00, 0x06, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0x03, 0xC0,
+  0xF0, 0x07, 0x87, 0x80, 0x0E, 0x3C, 0x00, 0x1C, 0xE0, 0x00, 0x77, 0x00,
+  0x01, 0xDC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03,
+  0xF8, 0x00, 0x0E, 0xE0, 0x00, 0x3B, 0x80, 0x01, 0xCE, 0x00, 0x0F, 0x1C,
+  0x00, 0x78, 0x78, 0x03, 0xC1, 0xF0, 0x3F, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
+  0x80, 0x03, 0xF0, 0x00, 0x00, 0x0E, 0x18, 0x00, 0x7C, 0xC0, 0x03, 0x9F,
+  0x00, 0x0C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0xFC, 0x0F, 0x03, 0xC0,
+  0x1E, 0x1E, 0x00, 0x38, 0xF0, 0x00, 0x73, 0x80, 0x01, 0xDC, 0x00, 0x07,
+  0x70, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3B, 0x80, 0x00, 0xEE, 0x00, 0x07, 0x38, 0x00, 0x3C, 0x70, 0x01,
+  0xE1, 0xE0, 0x0F, 0x07, 0xC0, 0xFC, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00,
+  0x0F, 0xC0, 0x00, 0x00, 0x1C, 0x70, 0x00, 0xF3, 0xC0, 0x03, 0x8E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F,
+  0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0x03, 0xC0, 0xF0, 0x07, 0x87, 0x80, 0x0E,
+  0x3C, 0x00, 0x1C, 0xE0, 0x00, 0x77, 0x00, 0x01, 0xDC, 0x00, 0x07, 0xF0,
+  0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0E, 0xE0, 0x00,
+  0x3B, 0x80, 0x01, 0xCE, 0x00, 0x0F, 0x1C, 0x00, 0x78, 0x78, 0x03, 0xC1,
+  0xF0, 0x3F, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x20,
+  0x02, 0x78, 0x03, 0xDE, 0x03, 0xC7, 0x83, 0xC3, 0xE3, 0xE0, 0xFB, 0xE0,
+  0x3D, 0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xFC, 0x01, 0xEF,
+  0x01, 0xF7, 0xC1, 0xF1, 0xF0, 0xF0, 0x78, 0xF0, 0x1E, 0xF0, 0x07, 0x90,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF0, 0x20, 0x07, 0xFF, 0x1C,
+  0x03, 0xFF, 0xEE, 0x03, 0xF0, 0x3F, 0x00, 0xF0, 0x07, 0x80, 0x78, 0x01,
+  0xE0, 0x3C, 0x01, 0xDC, 0x0E, 0x00, 0xE7, 0x07, 0x00, 0x71, 0xC1, 0xC0,
+  0x38, 0x70, 0xF0, 0x3C, 0x1C, 0x38, 0x1C, 0x07, 0x0E, 0x0E, 0x03, 0xC3,
+  0x87, 0x00, 0xE0, 0xE3, 0x80, 0x38, 0x3B, 0xC0, 0x1E, 0x0F, 0xC0, 0x0F,
+  0x01, 0xE0, 0x07, 0x80, 0x78, 0x03, 0xE0, 0x3F, 0x03, 0xF0, 0x1D, 0xFF,
+  0xF0, 0x06, 0x3F, 0xF8, 0x03, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x38, 0x00, 0x73, 0x80,
+  0x0F, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x38, 0x00, 0xE7, 0x80, 0x0E, 0x70,
+  0x01, 0xE7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00, 0x1C, 0x70, 0x01, 0xCE,
+  0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x03, 0x8E, 0x00, 0x70,
+  0xF0, 0x0F, 0x07, 0x83, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x0F, 0xE0,
+  0x00, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x38, 0x00, 0x73,
+  0x80, 0x0F, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x38, 0x00, 0xE7, 0x80, 0x0E,
+  0x70, 0x01, 0xE7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00, 0x1C, 0x70, 0x01,
+  0xCE, 0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x03, 0x8E, 0x00,
+  0x70, 0xF0, 0x0F, 0x07, 0x83, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x0F,
+  0xE0, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x60, 0x00, 0x63, 0x00, 0x0C, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x38, 0x00,
+  0x73, 0x80, 0x0F, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x38, 0x00, 0xE7, 0x80,
+  0x0E, 0x70, 0x01, 0xE7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00, 0x1C, 0x70,
+  0x01, 0xCE, 0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x03, 0x8E,
+  0x00, 0x70, 0xF0, 0x0F, 0x07, 0x83, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80,
+  0x0F, 0xE0, 0x00, 0x00, 0xE3, 0x80, 0x1E, 0x78, 0x01, 0xC7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x38,
+  0x00, 0x73, 0x80, 0x0F, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x38, 0x00, 0xE7,
+  0x80, 0x0E, 0x70, 0x01, 0xE7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00, 0x1C,
+  0x70, 0x01, 0xCE, 0x00, 0x3C, 0xE0, 0x03, 0x8E, 0x00, 0x38, 0xE0, 0x03,
+  0x8E, 0x00, 0x70, 0xF0, 0x0F, 0x07, 0x83, 0xE0, 0x7F, 0xFC, 0x03, 0xFF,
+  0x80, 0x0F, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7B, 0x80, 0x1E, 0x78,
+  0x07, 0x87, 0x01, 0xE0, 0xF0, 0x3C, 0x0E, 0x0F, 0x01, 0xE3, 0xC0, 0x1C,
+  0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38,
+  0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x00, 0xE0,
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7F, 0xFC, 0x38, 0x0F, 0x1C, 0x03, 0x9C, 0x01, 0xCE, 0x00,
+  0xE7, 0x00, 0x73, 0x80, 0x71, 0xC0, 0xF9, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F,
+  0xF0, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0xC1, 0xE0, 0xF0, 0xE0,
+  0x38, 0x70, 0x1C, 0x70, 0x3E, 0x38, 0x7C, 0x1C, 0x70, 0x0E, 0x70, 0x07,
+  0x38, 0x07, 0x1E, 0x03, 0x8F, 0x81, 0xC3, 0xE0, 0xE0, 0xF8, 0x70, 0x1E,
+  0x70, 0x0F, 0x38, 0x03, 0x9C, 0x01, 0xCE, 0x00, 0xE7, 0x41, 0xE7, 0xBF,
+  0xF3, 0x9F, 0xF1, 0xC7, 0xE0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00,
+  0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F,
+  0xFE, 0x1F, 0xFE, 0x18, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x07, 0xFF, 0x1F,
+  0xFF, 0x7F, 0xFE, 0x78, 0x0E, 0xE0, 0x0E, 0xE0, 0x1E, 0xE0, 0x3E, 0xF0,
+  0x7C, 0xFF, 0xDC, 0x7F, 0x9C, 0x1F, 0x1C, 0x00, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x07, 0xFF, 0x07, 0xFF, 0x83, 0x01, 0xE0, 0x00, 0x70, 0x00,
+  0x38, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x3C, 0x07, 0x38, 0x03, 0x9C,
+  0x03, 0xCE, 0x03, 0xE7, 0x83, 0xE3, 0xFF, 0x70, 0xFF, 0x38, 0x1F, 0x1C,
+  0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xE6, 0x01, 0xC6, 0x03,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0xFE, 0x18,
+  0x0F, 0x00, 0x07, 0x00, 0x07, 0x07, 0xFF, 0x1F, 0xFF, 0x7F, 0xFE, 0x78,
+  0x0E, 0xE0, 0x0E, 0xE0, 0x1E, 0xE0, 0x3E, 0xF0, 0x7C, 0xFF, 0xDC, 0x7F,
+  0x9C, 0x1F, 0x1C, 0x00, 0xE1, 0x80, 0xF9, 0xC0, 0xE7, 0xC0, 0x61, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF,
+  0x06, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF,
+  0xFC, 0x78, 0x0E, 0x70, 0x07, 0x38, 0x07, 0x9C, 0x07, 0xCF, 0x07, 0xC7,
+  0xFE, 0xE1, 0xFE, 0x70, 0x3E, 0x38, 0x00, 0xE3, 0x80, 0xF3, 0xC0, 0x71,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F,
+  0xFE, 0x0F, 0xFF, 0x06, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x3F, 0xF8,
+  0x7F, 0xFC, 0xFF, 0xFC, 0x78, 0x0E, 0x70, 0x07, 0x38, 0x07, 0x9C, 0x07,
+  0xCF, 0x07, 0xC7, 0xFE, 0xE1, 0xFE, 0x70, 0x3E, 0x38, 0x00, 0x78, 0x00,
+  0xFC, 0x01, 0xCE, 0x01, 0x86, 0x01, 0x86, 0x01, 0xCE, 0x00, 0xFC, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0xFE, 0x18,
+  0x0F, 0x00, 0x07, 0x00, 0x07, 0x07, 0xFF, 0x1F, 0xFF, 0x7F, 0xFE, 0x78,
+  0x0E, 0xE0, 0x0E, 0xE0, 0x1E, 0xE0, 0x3E, 0xF0, 0x7C, 0xFF, 0xDC, 0x7F,
+  0x9C, 0x1F, 0x1C, 0x07, 0xF0, 0x1F, 0x00, 0xFF, 0xC7, 0xFC, 0x1F, 0xFC,
+  0xFF, 0xE1, 0x81, 0xFC, 0x1E, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x70, 0x07,
+  0x07, 0xFE, 0x00, 0x71, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0x80,
+  0xFF, 0xFF, 0xE0, 0x0C, 0x00, 0x0E, 0x01, 0xC0, 0x00, 0xE0, 0x3E, 0x00,
+  0x4F, 0x06, 0xF0, 0x18, 0xFF, 0xE7, 0xFF, 0x87, 0xFC, 0x3F, 0xF0, 0x1F,
+  0x00, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0xF0, 0x33, 0xC0,
+  0x0F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0F, 0x00, 0x1F, 0x02, 0x1F, 0xFC, 0x1F, 0xF8, 0x0F, 0xE0, 0x06,
+  0x00, 0x06, 0x00, 0x0C, 0x00, 0x38, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFC, 0x1F, 0xFE, 0x3E, 0x1E, 0x38,
+  0x07, 0x70, 0x07, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x04, 0xF8, 0x18, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F,
+  0xC0, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFE, 0x07, 0xFF,
+  0x87, 0xC3, 0xC3, 0x80, 0x73, 0x80, 0x39, 0xC0, 0x1D, 0xFF, 0xFE, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xB8, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x47, 0xC0, 0xC1,
+  0xFF, 0xE0, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00,
+  0x7C, 0x00, 0xE6, 0x01, 0xC6, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xF0, 0x07, 0xFC, 0x1F, 0xFE, 0x3E, 0x1E, 0x38, 0x07, 0x70, 0x07, 0x70,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x04, 0xF8, 0x18, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0xE3, 0x80,
+  0xF3, 0xC0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x07, 0xFC, 0x0F, 0xFF, 0x0F, 0x87, 0x87, 0x00, 0xE7, 0x00,
+  0x73, 0x80, 0x3B, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x8F, 0x81, 0x83, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0x80,
+  0x70, 0x70, 0x60, 0xE0, 0xC1, 0xC0, 0x00, 0x1C, 0x38, 0x71, 0xC3, 0x87,
+  0x0E, 0x1C, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x38, 0x70, 0xE0, 0x00, 0xE0,
+  0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80,
+  0x70, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x78, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x00, 0x07, 0x03, 0xC1,
+  0xF0, 0xE6, 0x71, 0xB8, 0x30, 0x00, 0x00, 0x1C, 0x07, 0x01, 0xC0, 0xE0,
+  0x38, 0x0E, 0x03, 0x80, 0xE0, 0x78, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x0E, 0x03, 0x80, 0xE0, 0x00, 0x38, 0xEF, 0x3D, 0xC7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x03, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0x03, 0xC0, 0x00, 0xF3, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0xFF,
+  0x80, 0x61, 0xC0, 0x00, 0xF0, 0x07, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0x0F,
+  0x83, 0xC7, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x3B, 0x80, 0x1D, 0xC0, 0x0E,
+  0xE0, 0x0F, 0x70, 0x07, 0x38, 0x07, 0x9E, 0x03, 0x87, 0x87, 0xC3, 0xFF,
+  0xC0, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0xE1, 0x80, 0xF9, 0xC0, 0xE7, 0xC0,
+  0x61, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF8, 0x1D, 0xFE,
+  0x0F, 0xFF, 0x8F, 0xC3, 0xC7, 0xC0, 0xE3, 0xC0, 0x71, 0xC0, 0x38, 0xE0,
+  0x1C, 0xF0, 0x1E, 0x70, 0x0E, 0x38, 0x07, 0x1C, 0x03, 0x8E, 0x01, 0xC7,
+  0x00, 0xE7, 0x00, 0xE3, 0x80, 0x71, 0xC0, 0x38, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xF0, 0x0F, 0xFC, 0x1F, 0xFE, 0x3E, 0x1E, 0x38, 0x0F, 0x70, 0x07,
+  0x70, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0E, 0xE0, 0x0E,
+  0xF0, 0x1C, 0x78, 0x7C, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0xC3, 0xC3,
+  0x80, 0xF3, 0x80, 0x39, 0xC0, 0x1D, 0xC0, 0x0E, 0xE0, 0x07, 0x70, 0x03,
+  0xB8, 0x03, 0x9C, 0x01, 0xCF, 0x01, 0xC3, 0xC3, 0xE1, 0xFF, 0xE0, 0x7F,
+  0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xE6,
+  0x01, 0xC6, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFC,
+  0x1F, 0xFE, 0x3E, 0x1E, 0x38, 0x0F, 0x70, 0x07, 0x70, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0E, 0xE0, 0x0E, 0xF0, 0x1C, 0x78, 0x7C,
+  0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0xE1, 0x80, 0xF9, 0xC0, 0xE7,
+  0xC0, 0x61, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F,
+  0xFC, 0x0F, 0xFF, 0x0F, 0x87, 0x87, 0x01, 0xE7, 0x00, 0x73, 0x80, 0x3B,
+  0x80, 0x1D, 0xC0, 0x0E, 0xE0, 0x07, 0x70, 0x07, 0x38, 0x03, 0x9E, 0x03,
+  0x87, 0x87, 0xC3, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0xE3, 0x80,
+  0xF3, 0xC0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xE0, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F, 0x87, 0x87, 0x01, 0xE7, 0x00,
+  0x73, 0x80, 0x3B, 0x80, 0x1D, 0xC0, 0x0E, 0xE0, 0x07, 0x70, 0x07, 0x38,
+  0x03, 0x9E, 0x03, 0x87, 0x87, 0xC3, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0x80,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x20, 0x0F, 0xC7, 0x03, 0xFE, 0xE0, 0x7F, 0xFC,
+  0x0F, 0x87, 0x81, 0xE0, 0x7C, 0x1C, 0x0F, 0xC1, 0xC1, 0xDC, 0x38, 0x31,
+  0xC3, 0x86, 0x1C, 0x38, 0xC1, 0xC3, 0xB8, 0x38, 0x3F, 0x03, 0x83, 0xE0,
+  0x70, 0x1E, 0x1F, 0x03, 0xFF, 0xE0, 0x77, 0xFC, 0x0E, 0x3F, 0x00, 0x40,
+  0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x60,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07,
+  0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0xF0, 0x1E,
+  0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C, 0xF0, 0xFC, 0xFF, 0xF8,
+  0x7F, 0xB8, 0x3E, 0x38, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x38, 0x07,
+  0x38, 0x07, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E,
+  0xF0, 0x1E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C, 0xF0, 0xFC,
+  0xFF, 0xF8, 0x7F, 0xB8, 0x3E, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF8,
+  0x01, 0xCC, 0x03, 0x8C, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07,
+  0x38, 0x07, 0x38, 0x07, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E,
+  0x70, 0x0E, 0xF0, 0x1E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C,
+  0xF0, 0xFC, 0xFF, 0xF8, 0x7F, 0xB8, 0x3E, 0x38, 0x01, 0xC7, 0x03, 0xCF,
+  0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07,
+  0x38, 0x07, 0x38, 0x07, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E,
+  0x70, 0x0E, 0xF0, 0x1E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C,
+  0xF0, 0xFC, 0xFF, 0xF8, 0x7F, 0xB8, 0x3E, 0x38, 0x00, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x01, 0xE3, 0xC0, 0x38, 0x38, 0x0F, 0x07, 0x03,
+  0xC0, 0xE0, 0x70, 0x1C, 0x1E, 0x01, 0xC3, 0x80, 0x38, 0xF0, 0x07, 0x3C,
+  0x00, 0xE7, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x3C, 0xF8, 0x0E, 0x7F, 0x83, 0xBF, 0xE0, 0xF8, 0x7C, 0x3C,
+  0x0F, 0x1E, 0x01, 0xC7, 0x80, 0x71, 0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x03,
+  0xCF, 0x00, 0xE3, 0xC0, 0x38, 0xF0, 0x1C, 0x3E, 0x1F, 0x0F, 0xFF, 0x87,
+  0xBF, 0xC1, 0xC7, 0xC0, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0,
+  0x00, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x71, 0xC0, 0x1E, 0x78, 0x03,
+  0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+  0x0F, 0x1E, 0x01, 0xC1, 0xC0, 0x78, 0x38, 0x1E, 0x07, 0x03, 0x80, 0xE0,
+  0xF0, 0x0E, 0x1C, 0x01, 0xC7, 0x80, 0x39, 0xE0, 0x07, 0x38, 0x00, 0xFF,
+  0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x3F, 0x00,
+  0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
+  {     1,   7,  23,  12,    2,  -22 },   // 0x21 '!'
+  {    22,   9,   8,  14,    3,  -22 },   // 0x22 '"'
+  {    31,  22,  22,  26,    2,  -21 },   // 0x23 '#'
+  {    92,  16,  29,  20,    1,  -23 },   // 0x24 '$'
+  {   150,  24,  23,  29,    3,  -22 },   // 0x25 '%'
+  {   219,  21,  23,  24,    1,  -22 },   // 0x26 '&'
+  {   280,   3,   8,   9,    3,  -22 },   // 0x27 '''
+  {   283,  11,  28,  12,    2,  -23 },   // 0x28 '('
+  {   322,  11,  28,  12,   -2,  -23 },   // 0x29 ')'
+  {   361,  14,  14,  16,    1,  -22 },   // 0x2A '*'
+  {   386,  19,  19,  26,    3,  -18 },   // 0x2B '+'
+  {   432,   6,   7,  10,    0,   -3 },   // 0x2C ','
+  {   438,   9,   4,  11,    1,   -9 },   // 0x2D '-'
+  {   443,   4,   4,  10,    2,   -3 },   // 0x2E '.'
+  {   445,  16,  25,  10,   -2,  -22 },   // 0x2F '/'
+  {   495,  17,  23,  20,    2,  -22 },   // 0x30 '0'
+  {   544,  15,  23,  20,    2,  -22 },   // 0x31 '1'
+  {   588,  18,  23,  20,    0,  -22 },   // 0x32 '2'
+  {   640,  18,  23,  20,    0,  -22 },   // 0x33 '3'
+  {   692,  17,  23,  20,    1,  -22 },   // 0x34 '4'
+  {   741,  17,  23,  20,    1,  -22 },   // 0x35 '5'
+  {   790,  16,  23,  20,    2,  -22 },   // 0x36 '6'
+  {   836,  17,  23,  20,    3,  -22 },   // 0x37 '7'
+  {   885,  17,  23,  20,    1,  -22 },   // 0x38 '8'
+  {   934,  16,  23,  20,    1,  -22 },   // 0x39 '9'
+  {   980,   6,  16,  10,    2,  -15 },   // 0x3A ':'
+  {   992,   8,  19,  10,    0,  -15 },   // 0x3B ';'
+  {  1011,  19,  17,  26,    3,  -17 },   // 0x3C '<'
+  {  1052,  19,  10,  26,    3,  -14 },   // 0x3D '='
+  {  1076,  19,  17,  26,    3,  -17 },   // 0x3E '>'
+  {  1117,  12,  23,  16,    4,  -22 },   // 0x3F '?'
+  {  1152,  28,  27,  31,    2,  -21 },   // 0x40 '@'
+  {  1247,  21,  23,  21,   -2,  -22 },   // 0x41 'A'
+  {  1308,  19,  23,  21,    1,  -22 },   // 0x42 'B'
+  {  1363,  20,  23,  22,    1,  -22 },   // 0x43 'C'
+  {  1421,  22,  23,  24,    1,  -22 },   // 0x44 'D'
+  {  1485,  19,  23,  20,    1,  -22 },   // 0x45 'E'
+  {  1540,  17,  23,  18,    1,  -22 },   // 0x46 'F'
+  {  1589,  21,  23,  24,    1,  -22 },   // 0x47 'G'
+  {  1650,  22,  23,  23,    1,  -22 },   // 0x48 'H'
+  {  1714,   7,  23,   9,    1,  -22 },   // 0x49 'I'
+  {  1735,  13,  29,   9,   -5,  -22 },   // 0x4A 'J'
+  {  1783,  22,  23,  20,    1,  -22 },   // 0x4B 'K'
+  {  1847,  15,  23,  17,    1,  -22 },   // 0x4C 'L'
+  {  1891,  25,  23,  27,    1,  -22 },   // 0x4D 'M'
+  {  1963,  22,  23,  23,    1,  -22 },   // 0x4E 'N'
+  {  2027,  22,  23,  24,    1,  -22 },   // 0x4F 'O'
+  {  2091,  18,  23,  19,    1,  -22 },   // 0x50 'P'
+  {  2143,  22,  27,  24,    1,  -22 },   // 0x51 'Q'
+  {  2218,  18,  23,  22,    1,  -22 },   // 0x52 'R'
+  {  2270,  18,  23,  20,    0,  -22 },   // 0x53 'S'
+  {  2322,  20,  23,  19,    1,  -22 },   // 0x54 'T'
+  {  2380,  20,  23,  23,    2,  -22 },   // 0x55 'U'
+  {  2438,  21,  23,  21,    2,  -22 },   // 0x56 'V'
+  {  2499,  29,  23,  31,    3,  -22 },   // 0x57 'W'
+  {  2583,  23,  23,  21,   -1,  -22 },   // 0x58 'X'
+  {  2650,  19,  23,  19,    2,  -22 },   // 0x59 'Y'
+  {  2705,  22,  23,  21,   -1,  -22 },   // 0x5A 'Z'
+  {  2769,  11,  28,  12,    1,  -23 },   // 0x5B '['
+  {  2808,   6,  25,  10,    3,  -22 },   // 0x5C '\'
+  {  2827,  11,  28,  12,   -1,  -23 },   // 0x5D ']'
+  {  2866,  19,   8,  26,    3,  -22 },   // 0x5E '^'
+  {  2885,  16,   3,  16,    0,    5 },   // 0x5F '_'
+  {  2891,   6,   6,  16,    6,  -24 },   // 0x60 '`'
+  {  2896,  16,  17,  19,    1,  -16 },   // 0x61 'a'
+  {  2930,  17,  24,  20,    1,  -23 },   // 0x62 'b'
+  {  2981,  15,  17,  17,    1,  -16 },   // 0x63 'c'
+  {  3013,  18,  24,  20,    1,  -23 },   // 0x64 'd'
+  {  3067,  16,  17,  19,    1,  -16 },   // 0x65 'e'
+  {  3101,  13,  24,  11,    2,  -23 },   // 0x66 'f'
+  {  3140,  17,  23,  20,    1,  -16 },   // 0x67 'g'
+  {  3189,  16,  24,  20,    1,  -23 },   // 0x68 'h'
+  {  3237,   8,  24,   9,    1,  -23 },   // 0x69 'i'
+  {  3261,  13,  30,   9,   -4,  -23 },   // 0x6A 'j'
+  {  3310,  18,  24,  18,    1,  -23 },   // 0x6B 'k'
+  {  3364,   8,  24,   9,    1,  -23 },   // 0x6C 'l'
+  {  3388,  27,  17,  30,    1,  -16 },   // 0x6D 'm'
+  {  3446,  16,  17,  20,    1,  -16 },   // 0x6E 'n'
+  {  3480,  16,  17,  19,    1,  -16 },   // 0x6F 'o'
+  {  3514,  18,  23,  20,    0,  -16 },   // 0x70 'p'
+  {  3566,  17,  23,  20,    1,  -16 },   // 0x71 'q'
+  {  3615,  13,  17,  13,    1,  -16 },   // 0x72 'r'
+  {  3643,  15,  17,  16,    1,  -16 },   // 0x73 's'
+  {  3675,  11,  22,  12,    2,  -21 },   // 0x74 't'
+  {  3706,  16,  17,  20,    2,  -16 },   // 0x75 'u'
+  {  3740,  17,  17,  18,    2,  -16 },   // 0x76 'v'
+  {  3777,  23,  17,  25,    3,  -16 },   // 0x77 'w'
+  {  3826,  19,  17,  18,   -1,  -16 },   // 0x78 'x'
+  {  3867,  19,  23,  18,   -1,  -16 },   // 0x79 'y'
+  {  3922,  17,  17,  16,    0,  -16 },   // 0x7A 'z'
+  {  3959,  15,  29,  20,    4,  -23 },   // 0x7B '{'
+  {  4014,   3,  31,  10,    4,  -23 },   // 0x7C '|'
+  {  4026,  15,  29,  20,    0,  -23 },   // 0x7D '}'
+  {  4081,  19,   5,  26,    3,  -11 },   // 0x7E '~'
+  {  4093,  16,  27,  19,    2,  -21 },   // 0x7F
+  {  4147,  16,  27,  19,    2,  -21 },   // 0x80
+  {  4201,  16,  27,  19,    2,  -21 },   // 0x81
+  {  4255,  16,  27,  19,    2,  -21 },   // 0x82
+  {  4309,  16,  27,  19,    2,  -21 },   // 0x83
+  {  4363,  16,  27,  19,    2,  -21 },   // 0x84
+  {  4417,  16,  27,  19,    2,  -21 },   // 0x85
+  {  4471,  16,  27,  19,    2,  -21 },   // 0x86
+  {  4525,  16,  27,  19,    2,  -21 },   // 0x87
+  {  4579,  16,  27,  19,    2,  -21 },   // 0x88
+  {  4633,  16,  27,  19,    2,  -21 },   // 0x89
+  {  4687,  16,  27,  19,    2,  -21 },   // 0x8A
+  {  4741,  16,  27,  19,    2,  -21 },   // 0x8B
+  {  4795,  16,  27,  19,    2,  -21 },   // 0x8C
+  {  4849,  16,  27,  19,    2,  -21 },   // 0x8D
+  {  4903,  16,  27,  19,    2,  -21 },   // 0x8E
+  {  4957,  16,  27,  19,    2,  -21 },   // 0x8F
+  {  5011,  16,  27,  19,    2,  -21 },   // 0x90
+  {  5065,  16,  27,  19,    2,  -21 },   // 0x91
+  {  5119,  16,  27,  19,    2,  -21 },   // 0x92
+  {  5173,  16,  27,  19,    2,  -21 },   // 0x93
+  {  5227,  16,  27,  19,    2,  -21 },   // 0x94
+  {  5281,  16,  27,  19,    2,  -21 },   // 0x95
+  {  5335,  16,  27,  19,    2,  -21 },   // 0x96
+  {  5389,  16,  27,  19,    2,  -21 },   // 0x97
+  {  5443,  16,  27,  19,    2,  -21 },   // 0x98
+  {  5497,  16,  27,  19,    2,  -21 },   // 0x99
+  {  5551,  16,  27,  19,    2,  -21 },   // 0x9A
+  {  5605,  16,  27,  19,    2,  -21 },   // 0x9B
+  {  5659,  16,  27,  19,    2,  -21 },   // 0x9C
+  {  5713,  16,  27,  19,    2,  -21 },   // 0x9D
+  {  5767,  16,  27,  19,    2,  -21 },   // 0x9E
+  {  5821,  16,  27,  19,    2,  -21 },   // 0x9F
+  {  5875,   1,   1,  10,    0,    0 },   // 0xA0
+  {  5876,   7,  23,  12,    3,  -16 },   // 0xA1
+  {  5897,  15,  25,  20,    2,  -20 },   // 0xA2
+  {  5944,  19,  23,  20,    1,  -22 },   // 0xA3
+  {  5999,  17,  17,  20,    1,  -17 },   // 0xA4
+  {  6036,  20,  23,  20,    1,  -22 },   // 0xA5
+  {  6094,   3,  26,  10,    4,  -20 },   // 0xA6
+  {  6104,  15,  26,  16,    1,  -22 },   // 0xA7
+  {  6153,  10,   3,  16,    6,  -23 },   // 0xA8
+  {  6157,  22,  22,  31,    4,  -21 },   // 0xA9
+  {  6218,  13,  16,  15,    1,  -22 },   // 0xAA
+  {  6244,  16,  14,  19,    2,  -15 },   // 0xAB
+  {  6272,  19,   9,  26,    3,  -12 },   // 0xAC
+  {  6294,   9,   4,  11,    1,   -9 },   // 0xAD
+  {  6299,  22,  22,  31,    4,  -21 },   // 0xAE
+  {  6360,   9,   3,  15,    6,  -22 },   // 0xAF
+  {  6364,  10,  10,  16,    3,  -22 },   // 0xB0
+  {  6377,  19,  20,  26,    4,  -19 },   // 0xB1
+  {  6425,  11,  13,  12,    1,  -22 },   // 0xB2
+  {  6443,  11,  13,  12,    1,  -22 },   // 0xB3
+  {  6461,   8,   6,  16,    8,  -24 },   // 0xB4
+  {  6467,  19,  23,  20,    0,  -16 },   // 0xB5
+  {  6522,  15,  26,  20,    2,  -22 },   // 0xB6
+  {  6571,   4,   4,  10,    4,  -12 },   // 0xB7
+  {  6573,   7,   6,  16,    1,    1 },   // 0xB8
+  {  6579,   7,  13,  12,    2,  -22 },   // 0xB9
+  {  6591,  13,  16,  15,    1,  -22 },   // 0xBA
+  {  6617,  16,  14,  19,    2,  -15 },   // 0xBB
+  {  6645,  27,  23,  30,    2,  -22 },   // 0xBC
+  {  6723,  28,  23,  30,    2,  -22 },   // 0xBD
+  {  6804,  28,  23,  30,    1,  -22 },   // 0xBE
+  {  6885,  12,  23,  16,    1,  -16 },   // 0xBF
+  {  6920,  21,  29,  21,   -2,  -28 },   // 0xC0
+  {  6997,  21,  29,  21,   -2,  -28 },   // 0xC1
+  {  7074,  21,  29,  21,   -2,  -28 },   // 0xC2
+  {  7151,  22,  30,  21,   -2,  -29 },   // 0xC3
+  {  7234,  21,  29,  21,   -2,  -28 },   // 0xC4
+  {  7311,  21,  29,  21,   -2,  -28 },   // 0xC5
+  {  7388,  32,  23,  30,   -1,  -22 },   // 0xC6
+  {  7480,  20,  29,  22,    1,  -22 },   // 0xC7
+  {  7553,  19,  29,  20,    1,  -28 },   // 0xC8
+  {  7622,  19,  29,  20,    1,  -28 },   // 0xC9
+  {  7691,  19,  29,  20,    1,  -28 },   // 0xCA
+  {  7760,  19,  29,  20,    1,  -28 },   // 0xCB
+  {  7829,   9,  29,   9,    1,  -28 },   // 0xCC
+  {  7862,  11,  29,   9,    1,  -28 },   // 0xCD
+  {  7902,  12,  29,   9,    1,  -28 },   // 0xCE
+  {  7946,  12,  29,   9,    1,  -28 },   // 0xCF
+  {  7990,  23,  23,  24,    0,  -22 },   // 0xD0
+  {  8057,  22,  30,  23,    1,  -29 },   // 0xD1
+  {  8140,  22,  29,  24,    1,  -28 },   // 0xD2
+  {  8220,  22,  29,  24,    1,  -28 },   // 0xD3
+  {  8300,  22,  29,  24,    1,  -28 },   // 0xD4
+  {  8380,  22,  30,  24,    1,  -29 },   // 0xD5
+  {  8463,  22,  29,  24,    1,  -28 },   // 0xD6
+  {  8543,  17,  18,  26,    4,  -17 },   // 0xD7
+  {  8582,  26,  25,  24,   -1,  -23 },   // 0xD8
+  {  8664,  20,  29,  23,    2,  -28 },   // 0xD9
+  {  8737,  20,  29,  23,    2,  -28 },   // 0xDA
+  {  8810,  20,  29,  23,    2,  -28 },   // 0xDB
+  {  8883,  20,  29,  23,    2,  -28 },   // 0xDC
+  {  8956,  19,  29,  19,    2,  -28 },   // 0xDD
+  {  9025,  17,  23,  19,    1,  -22 },   // 0xDE
+  {  9074,  17,  24,  20,    1,  -23 },   // 0xDF
+  {  9125,  16,  25,  19,    1,  -24 },   // 0xE0
+  {  9175,  17,  25,  19,    1,  -24 },   // 0xE1
+  {  9229,  16,  25,  19,    1,  -24 },   // 0xE2
+  {  9279,  17,  24,  19,    1,  -23 },   // 0xE3
+  {  9330,  17,  24,  19,    1,  -23 },   // 0xE4
+  {  9381,  16,  27,  19,    1,  -26 },   // 0xE5
+  {  9435,  28,  17,  31,    1,  -16 },   // 0xE6
+  {  9495,  15,  23,  17,    1,  -16 },   // 0xE7
+  {  9539,  16,  25,  19,    1,  -24 },   // 0xE8
+  {  9589,  17,  25,  19,    1,  -24 },   // 0xE9
+  {  9643,  16,  25,  19,    1,  -24 },   // 0xEA
+  {  9693,  17,  24,  19,    1,  -23 },   // 0xEB
+  {  9744,   7,  25,   9,    1,  -24 },   // 0xEC
+  {  9766,  11,  25,   9,    1,  -24 },   // 0xED
+  {  9801,  10,  25,   9,    1,  -24 },   // 0xEE
+  {  9833,  11,  24,   9,    1,  -23 },   // 0xEF
+  {  9866,  17,  24,  19,    1,  -23 },   // 0xF0
+  {  9917,  17,  24,  20,    1,  -23 },   // 0xF1
+  {  9968,  16,  25,  19,    1,  -24 },   // 0xF2
+  { 10018,  17,  25,  19,    1,  -24 },   // 0xF3
+  { 10072,  16,  25,  19,    1,  -24 },   // 0xF4
+  { 10122,  17,  24,  19,    1,  -23 },   // 0xF5
+  { 10173,  17,  24,  19,    1,  -23 },   // 0xF6
+  { 10224,  20,  15,  26,    3,  -16 },   // 0xF7
+  { 10262,  20,  19,  19,   -1,  -17 },   // 0xF8
+  { 10310,  16,  25,  20,    2,  -24 },   // 0xF9
+  { 10360,  16,  25,  20,    2,  -24 },   // 0xFA
+  { 10410,  16,  25,  20,    2,  -24 },   // 0xFB
+  { 10460,  16,  24,  20,    2,  -23 },   // 0xFC
+  { 10508,  19,  31,  18,   -1,  -24 },   // 0xFD
+  { 10582,  18,  30,  20,    0,  -23 },   // 0xFE
+  { 10650,  19,  30,  18,   -1,  -23 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique16pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique16pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique16pt8bGlyphs,
+  0x20, 0xFF, 36 };
+
+// Approx. 12297 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique16pt8bMetrics[] PROGMEM = {
+  {   0,  10,   1 },   // 0x20
+  {   2,  12,   9 },   // 0x21
+  {   3,  14,  12 },   // 0x22
+  {   2,  26,  24 },   // 0x23
+  {   1,  20,  17 },   // 0x24
+  {   3,  29,  27 },   // 0x25
+  {   1,  24,  22 },   // 0x26
+  {   3,   9,   6 },   // 0x27
+  {   2,  12,  13 },   // 0x28
+  {  -2,  12,   9 },   // 0x29
+  {   1,  16,  15 },   // 0x2A
+  {   3,  26,  22 },   // 0x2B
+  {   0,  10,   6 },   // 0x2C
+  {   1,  11,  10 },   // 0x2D
+  {   2,  10,   6 },   // 0x2E
+  {  -2,  10,  14 },   // 0x2F
+  {   2,  20,  19 },   // 0x30
+  {   2,  20,  17 },   // 0x31
+  {   0,  20,  18 },   // 0x32
+  {   0,  20,  18 },   // 0x33
+  {   1,  20,  18 },   // 0x34
+  {   1,  20,  18 },   // 0x35
+  {   2,  20,  18 },   // 0x36
+  {   3,  20,  20 },   // 0x37
+  {   1,  20,  18 },   // 0x38
+  {   1,  20,  17 },   // 0x39
+  {   2,  10,   8 },   // 0x3A
+  {   0,  10,   8 },   // 0x3B
+  {   3,  26,  22 },   // 0x3C
+  {   3,  26,  22 },   // 0x3D
+  {   3,  26,  22 },   // 0x3E
+  {   4,  16,  16 },   // 0x3F
+  {   2,  31,  30 },   // 0x40
+  {  -2,  21,  19 },   // 0x41
+  {   1,  21,  20 },   // 0x42
+  {   1,  22,  21 },   // 0x43
+  {   1,  24,  23 },   // 0x44
+  {   1,  20,  20 },   // 0x45
+  {   1,  18,  18 },   // 0x46
+  {   1,  24,  22 },   // 0x47
+  {   1,  23,  23 },   // 0x48
+  {   1,   9,   8 },   // 0x49
+  {  -5,   9,   8 },   // 0x4A
+  {   1,  20,  23 },   // 0x4B
+  {   1,  17,  16 },   // 0x4C
+  {   1,  27,  26 },   // 0x4D
+  {   1,  23,  23 },   // 0x4E
+  {   1,  24,  23 },   // 0x4F
+  {   1,  19,  19 },   // 0x50
+  {   1,  24,  23 },   // 0x51
+  {   1,  22,  19 },   // 0x52
+  {   0,  20,  18 },   // 0x53
+  {   1,  19,  21 },   // 0x54
+  {   2,  23,  22 },   // 0x55
+  {   2,  21,  23 },   // 0x56
+  {   3,  31,  32 },   // 0x57
+  {  -1,  21,  22 },   // 0x58
+  {   2,  19,  21 },   // 0x59
+  {  -1,  21,  21 },   // 0x5A
+  {   1,  12,  12 },   // 0x5B
+  {   3,  10,   9 },   // 0x5C
+  {  -1,  12,  10 },   // 0x5D
+  {   3,  26,  22 },   // 0x5E
+  {   0,  16,  16 },   // 0x5F
+  {   6,  16,  12 },   // 0x60
+  {   1,  19,  17 },   // 0x61
+  {   1,  20,  18 },   // 0x62
+  {   1,  17,  16 },   // 0x63
+  {   1,  20,  19 },   // 0x64
+  {   1,  19,  17 },   // 0x65
+  {   2,  11,  15 },   // 0x66
+  {   1,  20,  18 },   // 0x67
+  {   1,  20,  17 },   // 0x68
+  {   1,   9,   9 },   // 0x69
+  {  -4,   9,   9 },   // 0x6A
+  {   1,  18,  19 },   // 0x6B
+  {   1,   9,   9 },   // 0x6C
+  {   1,  30,  28 },   // 0x6D
+  {   1,  20,  17 },   // 0x6E
+  {   1,  19,  17 },   // 0x6F
+  {   0,  20,  18 },   // 0x70
+  {   1,  20,  18 },   // 0x71
+  {   1,  13,  14 },   // 0x72
+  {   1,  16,  16 },   // 0x73
+  {   2,  12,  13 },   // 0x74
+  {   2,  20,  18 },   // 0x75
+  {   2,  18,  19 },   // 0x76
+  {   3,  25,  26 },   // 0x77
+  {  -1,  18,  18 },   // 0x78
+  {  -1,  18,  18 },   // 0x79
+  {   0,  16,  17 },   // 0x7A
+  {   4,  20,  19 },   // 0x7B
+  {   4,  10,   7 },   // 0x7C
+  {   0,  20,  15 },   // 0x7D
+  {   3,  26,  22 },   // 0x7E
+  {   2,  19,  18 },   // 0x7F
+  {   2,  19,  18 },   // 0x80
+  {   2,  19,  18 },   // 0x81
+  {   2,  19,  18 },   // 0x82
+  {   2,  19,  18 },   // 0x83
+  {   2,  19,  18 },   // 0x84
+  {   2,  19,  18 },   // 0x85
+  {   2,  19,  18 },   // 0x86
+  {   2,  19,  18 },   // 0x87
+  {   2,  19,  18 },   // 0x88
+  {   2,  19,  18 },   // 0x89
+  {   2,  19,  18 },   // 0x8A
+  {   2,  19,  18 },   // 0x8B
+  {   2,  19,  18 },   // 0x8C
+  {   2,  19,  18 },   // 0x8D
+  {   2,  19,  18 },   // 0x8E
+  {   2,  19,  18 },   // 0x8F
+  {   2,  19,  18 },   // 0x90
+  {   2,  19,  18 },   // 0x91
+  {   2,  19,  18 },   // 0x92
+  {   2,  19,  18 },   // 0x93
+  {   2,  19,  18 },   // 0x94
+  {   2,  19,  18 },   // 0x95
+  {   2,  19,  18 },   // 0x96
+  {   2,  19,  18 },   // 0x97
+  {   2,  19,  18 },   // 0x98
+  {   2,  19,  18 },   // 0x99
+  {   2,  19,  18 },   // 0x9A
+  {   2,  19,  18 },   // 0x9B
+  {   2,  19,  18 },   // 0x9C
+  {   2,  19,  18 },   // 0x9D
+  {   2,  19,  18 },   // 0x9E
+  {   2,  19,  18 },   // 0x9F
+  {   0,  10,   1 },   // 0xA0
+  {   3,  12,  10 },   // 0xA1
+  {   2,  20,  17 },   // 0xA2
+  {   1,  20,  20 },   // 0xA3
+  {   1,  20,  18 },   // 0xA4
+  {   1,  20,  21 },   // 0xA5
+  {   4,  10,   7 },   // 0xA6
+  {   1,  16,  16 },   // 0xA7
+  {   6,  16,  16 },   // 0xA8
+  {   4,  31,  26 },   // 0xA9
+  {   1,  15,  14 },   // 0xAA
+  {   2,  19,  18 },   // 0xAB
+  {   3,  26,  22 },   // 0xAC
+  {   1,  11,  10 },   // 0xAD
+  {   4,  31,  26 },   // 0xAE
+  {   6,  15,  15 },   // 0xAF
+  {   3,  16,  13 },   // 0xB0
+  {   4,  26,  23 },   // 0xB1
+  {   1,  12,  12 },   // 0xB2
+  {   1,  12,  12 },   // 0xB3
+  {   8,  16,  16 },   // 0xB4
+  {   0,  20,  19 },   // 0xB5
+  {   2,  20,  17 },   // 0xB6
+  {   4,  10,   8 },   // 0xB7
+  {   1,  16,   8 },   // 0xB8
+  {   2,  12,   9 },   // 0xB9
+  {   1,  15,  14 },   // 0xBA
+  {   2,  19,  18 },   // 0xBB
+  {   2,  30,  29 },   // 0xBC
+  {   2,  30,  30 },   // 0xBD
+  {   1,  30,  29 },   // 0xBE
+  {   1,  16,  13 },   // 0xBF
+  {  -2,  21,  19 },   // 0xC0
+  {  -2,  21,  19 },   // 0xC1
+  {  -2,  21,  19 },   // 0xC2
+  {  -2,  21,  20 },   // 0xC3
+  {  -2,  21,  19 },   // 0xC4
+  {  -2,  21,  19 },   // 0xC5
+  {  -1,  30,  31 },   // 0xC6
+  {   1,  22,  21 },   // 0xC7
+  {   1,  20,  20 },   // 0xC8
+  {   1,  20,  20 },   // 0xC9
+  {   1,  20,  20 },   // 0xCA
+  {   1,  20,  20 },   // 0xCB
+  {   1,   9,  10 },   // 0xCC
+  {   1,   9,  12 },   // 0xCD
+  {   1,   9,  13 },   // 0xCE
+  {   1,   9,  13 },   // 0xCF
+  {   0,  24,  23 },   // 0xD0
+  {   1,  23,  23 },   // 0xD1
+  {   1,  24,  23 },   // 0xD2
+  {   1,  24,  23 },   // 0xD3
+  {   1,  24,  23 },   // 0xD4
+  {   1,  24,  23 },   // 0xD5
+  {   1,  24,  23 },   // 0xD6
+  {   4,  26,  21 },   // 0xD7
+  {  -1,  24,  25 },   // 0xD8
+  {   2,  23,  22 },   // 0xD9
+  {   2,  23,  22 },   // 0xDA
+  {   2,  23,  22 },   // 0xDB
+  {   2,  23,  22 },   // 0xDC
+  {   2,  19,  21 },   // 0xDD
+  {   1,  19,  18 },   // 0xDE
+  {   1,  20,  18 },   // 0xDF
+  {   1,  19,  17 },   // 0xE0
+  {   1,  19,  18 },   // 0xE1
+  {   1,  19,  17 },   // 0xE2
+  {   1,  19,  18 },   // 0xE3
+  {   1,  19,  18 },   // 0xE4
+  {   1,  19,  17 },   // 0xE5
+  {   1,  31,  29 },   // 0xE6
+  {   1,  17,  16 },   // 0xE7
+  {   1,  19,  17 },   // 0xE8
+  {   1,  19,  18 },   // 0xE9
+  {   1,  19,  17 },   // 0xEA
+  {   1,  19,  18 },   // 0xEB
+  {   1,   9,   8 },   // 0xEC
+  {   1,   9,  12 },   // 0xED
+  {   1,   9,  11 },   // 0xEE
+  {   1,   9,  12 },   // 0xEF
+  {   1,  19,  18 },   // 0xF0
+  {   1,  20,  18 },   // 0xF1
+  {   1,  19,  17 },   // 0xF2
+  {   1,  19,  18 },   // 0xF3
+  {   1,  19,  17 },   // 0xF4
+  {   1,  19,  18 },   // 0xF5
+  {   1,  19,  18 },   // 0xF6
+  {   3,  26,  23 },   // 0xF7
+  {  -1,  19,  19 },   // 0xF8
+  {   2,  20,  18 },   // 0xF9
+  {   2,  20,  18 },   // 0xFA
+  {   2,  20,  18 },   // 0xFB
+  {   2,  20,  18 },   // 0xFC
+  {  -1,  18,  18 },   // 0xFD
+  {   0,  20,  18 },   // 0xFE
+  {  -1,  18,  18 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique16pt8bWidths = { DejaVuSans_Oblique16pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE16PTLAT1__H
@@ -0,0 +1,1598 @@
+#ifndef DEJAVUSANSOBLIQUE18PTLAT1__H
+#define DEJAVUSANSOBLIQUE18PTLAT1__H
+const uint8_t DejaVuSans_Oblique18pt8bBitmaps[] PROGMEM = {
+  0x00, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x18, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x70, 0xE0, 0xE0, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F,
+  0x87, 0xE1, 0xC0, 0x00, 0x38, 0x38, 0x00, 0x1C, 0x1C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0E, 0x0E, 0x00, 0x07, 0x07, 0x00, 0x03, 0x83, 0x80, 0x01, 0x83,
+  0x80, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x38,
+  0x30, 0x00, 0x38, 0x38, 0x00, 0x1C, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x06,
+  0x0E, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00,
+  0xC1, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x38, 0x38, 0x00,
+  0x18, 0x38, 0x00, 0x1C, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x06, 0x00, 0x07, 0xFC, 0x03, 0xFF,
+  0xC1, 0xFF, 0xF8, 0x7C, 0xC3, 0x0E, 0x18, 0x03, 0x83, 0x00, 0x70, 0xC0,
+  0x0E, 0x18, 0x01, 0xE3, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
+  0x00, 0x7F, 0x80, 0x0C, 0x78, 0x01, 0x87, 0x00, 0x60, 0xE0, 0x0C, 0x1C,
+  0x01, 0x83, 0x90, 0x30, 0xE7, 0x86, 0x7C, 0xFF, 0xFF, 0x0F, 0xFF, 0x80,
+  0x7F, 0xC0, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00,
+  0x18, 0x00, 0x0F, 0x80, 0x03, 0x83, 0xFC, 0x00, 0x60, 0xE3, 0x80, 0x1C,
+  0x38, 0x38, 0x07, 0x07, 0x07, 0x01, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0C, 0x07, 0x03, 0x83, 0x80, 0xE0, 0x70, 0xE0, 0x1C, 0x1C, 0x38, 0x03,
+  0x83, 0x8E, 0x00, 0x38, 0xE1, 0x80, 0x07, 0xF8, 0x71, 0xF0, 0x3E, 0x1C,
+  0x7F, 0x80, 0x07, 0x1C, 0x70, 0x01, 0xC7, 0x07, 0x00, 0x30, 0xE0, 0xE0,
+  0x0E, 0x38, 0x1C, 0x03, 0x87, 0x03, 0x80, 0xE0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x06, 0x03, 0x83, 0x81, 0x80, 0x70, 0x70, 0x70, 0x07, 0x1C, 0x1C,
+  0x00, 0xFF, 0x07, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0,
+  0x01, 0xFF, 0xE0, 0x03, 0xC0, 0x40, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0x80, 0x00,
+  0x07, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1C, 0xF0, 0x07, 0x38, 0x78, 0x07,
+  0x70, 0x3C, 0x0E, 0x70, 0x3E, 0x0E, 0xE0, 0x1E, 0x1C, 0xE0, 0x0F, 0x3C,
+  0xE0, 0x07, 0xF8, 0xE0, 0x03, 0xF0, 0xF0, 0x03, 0xE0, 0xF0, 0x03, 0xF0,
+  0x7C, 0x0F, 0xF0, 0x7F, 0xFF, 0x78, 0x1F, 0xFC, 0x3C, 0x07, 0xF0, 0x3C,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x80,
+  0x70, 0x0E, 0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x70, 0x07,
+  0x00, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x30, 0x03,
+  0x80, 0x18, 0x00, 0x01, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x00, 0x60, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07,
+  0x00, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x3C,
+  0x03, 0x80, 0x70, 0x07, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x41, 0x82, 0xF1, 0x8F,
+  0x39, 0x9C, 0x1F, 0xF8, 0x07, 0xE0, 0x07, 0xE0, 0x1F, 0xF0, 0x39, 0x9C,
+  0xF1, 0x8F, 0x41, 0x82, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x38,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80,
+  0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x70, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0xF3, 0x8E, 0x71, 0x8E, 0x30, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0xEE, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01,
+  0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00,
+  0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F,
+  0xE0, 0x0F, 0xFE, 0x03, 0xC1, 0xE0, 0xF0, 0x1C, 0x3C, 0x01, 0xC7, 0x00,
+  0x39, 0xE0, 0x07, 0x38, 0x00, 0xEF, 0x00, 0x1D, 0xC0, 0x03, 0xB8, 0x00,
+  0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x77, 0x00, 0x0E, 0xE0, 0x03,
+  0xDC, 0x00, 0x73, 0x80, 0x0E, 0x70, 0x03, 0x8E, 0x00, 0xF0, 0xE0, 0x3C,
+  0x1E, 0x0F, 0x01, 0xFF, 0xC0, 0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x01, 0xF8,
+  0x1F, 0xF0, 0x3F, 0xE0, 0x71, 0xC0, 0x03, 0x80, 0x0F, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0x3C, 0x00, 0x70, 0x00, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0x78, 0x1E, 0x04, 0x00, 0xF0,
+  0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x0F,
+  0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F,
+  0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C,
+  0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xE0,
+  0x60, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07,
+  0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x1F, 0xF0, 0x01, 0xFE,
+  0x00, 0x1F, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xC0, 0x00,
+  0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x78, 0x60,
+  0x1F, 0x0F, 0xFF, 0xE0, 0xFF, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xDC, 0x00, 0x73, 0x80,
+  0x1C, 0x70, 0x07, 0x1E, 0x01, 0xC3, 0x80, 0x38, 0x70, 0x0E, 0x0E, 0x03,
+  0x81, 0xC0, 0xE0, 0x38, 0x38, 0x0E, 0x0E, 0x01, 0xC1, 0xC0, 0x38, 0x70,
+  0x07, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x03,
+  0xFF, 0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x83, 0x80, 0x00, 0x70, 0x00, 0x0E,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x01, 0xFF, 0x80, 0x3F,
+  0xFC, 0x07, 0xFF, 0xC0, 0x80, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x70, 0x00,
+  0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0x78, 0x00, 0x1E, 0x18, 0x0F, 0x87, 0xFF, 0xE0, 0xFF, 0xF8, 0x07, 0xF8,
+  0x00, 0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x3F, 0xFC, 0x1F, 0x03, 0x0F, 0x00,
+  0x07, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1C, 0x7E, 0x07,
+  0x7F, 0xE1, 0xFF, 0xFC, 0x7E, 0x0F, 0x3E, 0x01, 0xEF, 0x00, 0x3B, 0xC0,
+  0x0E, 0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00, 0x3B, 0x80, 0x1C, 0xE0, 0x07,
+  0x1C, 0x03, 0x87, 0x83, 0xE0, 0xFF, 0xF0, 0x1F, 0xF8, 0x01, 0xF0, 0x00,
+  0x7F, 0xFF, 0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x01, 0xC0, 0x00, 0x78,
+  0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x07, 0x80,
+  0x00, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00,
+  0x1E, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x01,
+  0xE0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0xF8, 0x1E,
+  0x0E, 0x00, 0xF1, 0xE0, 0x07, 0x1C, 0x00, 0x71, 0xC0, 0x07, 0x1C, 0x00,
+  0xE1, 0xE0, 0x0E, 0x0F, 0x03, 0xC0, 0x7F, 0xF8, 0x07, 0xFE, 0x01, 0xFF,
+  0xF0, 0x3E, 0x0F, 0x87, 0x80, 0x38, 0x70, 0x01, 0xCE, 0x00, 0x1C, 0xE0,
+  0x01, 0xCE, 0x00, 0x1C, 0xE0, 0x03, 0xCF, 0x00, 0x78, 0x78, 0x1F, 0x87,
+  0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0x80,
+  0xFF, 0xF0, 0x7C, 0x1E, 0x1C, 0x03, 0x8E, 0x00, 0x73, 0x80, 0x1D, 0xC0,
+  0x07, 0x70, 0x01, 0xDC, 0x00, 0x77, 0x00, 0x3D, 0xC0, 0x0F, 0x78, 0x07,
+  0xCF, 0x07, 0xF3, 0xFF, 0xF8, 0x7F, 0xEE, 0x07, 0xE3, 0x80, 0x01, 0xC0,
+  0x00, 0x70, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x0C, 0x07, 0x83, 0xFF,
+  0xC0, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0x0E, 0x1C, 0x70, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x38, 0xE1, 0xC0, 0x03, 0x81,
+  0xC1, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x78, 0x38, 0x1C, 0x1C, 0x0C, 0x0E, 0x06, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+  0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF0,
+  0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0xFF, 0xEF, 0xFF, 0xBC, 0x0F, 0x80, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x01, 0xE0, 0x0F, 0x00,
+  0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07,
+  0xF0, 0x1F, 0x80, 0x3F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x0F, 0x03, 0xE0,
+  0x00, 0x0F, 0x07, 0x00, 0x00, 0x0E, 0x1E, 0x03, 0xE7, 0x1E, 0x78, 0x1F,
+  0xEC, 0x1C, 0xE0, 0x7F, 0xF8, 0x3B, 0xC1, 0xE1, 0xF0, 0x77, 0x07, 0x81,
+  0xE0, 0xEE, 0x0E, 0x01, 0xC1, 0xF8, 0x38, 0x03, 0x03, 0xF0, 0x70, 0x06,
+  0x0E, 0xE0, 0xE0, 0x0C, 0x1D, 0xC1, 0xC0, 0x38, 0x73, 0x83, 0x80, 0xF1,
+  0xC7, 0x07, 0x83, 0xEF, 0x8E, 0x07, 0xFF, 0xFC, 0x1E, 0x07, 0xFB, 0xF0,
+  0x1C, 0x07, 0xC7, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x7E, 0x03, 0xE0, 0x00,
+  0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00,
+  0x00, 0xEE, 0x00, 0x03, 0xDC, 0x00, 0x07, 0x3C, 0x00, 0x1E, 0x38, 0x00,
+  0x38, 0x70, 0x00, 0xF0, 0xE0, 0x01, 0xC1, 0xC0, 0x07, 0x83, 0x80, 0x0E,
+  0x03, 0x80, 0x38, 0x07, 0x00, 0xF0, 0x0E, 0x01, 0xC0, 0x1C, 0x07, 0x80,
+  0x38, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xE0, 0x01,
+  0xC3, 0x80, 0x03, 0x8E, 0x00, 0x07, 0x3C, 0x00, 0x0F, 0x70, 0x00, 0x0F,
+  0xE0, 0x00, 0x1C, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF, 0xFC, 0x1C,
+  0x01, 0xF0, 0xE0, 0x03, 0x87, 0x00, 0x1C, 0x38, 0x00, 0xE1, 0xC0, 0x07,
+  0x1C, 0x00, 0x70, 0xE0, 0x03, 0x87, 0x00, 0x78, 0x3F, 0xFF, 0x81, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xF0, 0xE0, 0x07, 0x87, 0x00, 0x1E, 0x38, 0x00, 0x71,
+  0xC0, 0x03, 0x9E, 0x00, 0x1C, 0xE0, 0x00, 0xE7, 0x00, 0x0F, 0x38, 0x00,
+  0xF1, 0xC0, 0x1F, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0x07, 0xFF, 0xC0, 0x00,
+  0x00, 0x1F, 0xE0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0x01, 0xF0,
+  0xF8, 0x00, 0xE1, 0xE0, 0x00, 0x87, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x02,
+  0x0F, 0x00, 0x0C, 0x0F, 0x80, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0,
+  0x03, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF8,
+  0x0E, 0x00, 0xFC, 0x0E, 0x00, 0x1E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0F,
+  0x0E, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07,
+  0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x00, 0x0E,
+  0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x1C, 0x78, 0x00, 0x1C,
+  0x70, 0x00, 0x38, 0x70, 0x00, 0x78, 0x70, 0x01, 0xF0, 0x70, 0x07, 0xE0,
+  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x00, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0xE0, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0x87, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0x07,
+  0xFF, 0xF0, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00,
+  0xE0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xFF, 0xF8,
+  0x1F, 0xFF, 0x83, 0xFF, 0xF0, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00,
+  0x03, 0x80, 0x00, 0x78, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x03, 0xE0, 0x1F, 0x07,
+  0x80, 0x07, 0x0F, 0x00, 0x02, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0,
+  0x07, 0xFE, 0xE0, 0x07, 0xFE, 0xE0, 0x07, 0xFC, 0xE0, 0x00, 0x1C, 0xE0,
+  0x00, 0x1C, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x1C, 0xF0, 0x00, 0x38, 0x70,
+  0x00, 0x38, 0x78, 0x00, 0x38, 0x3E, 0x01, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F,
+  0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07,
+  0x00, 0x0F, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E,
+  0x00, 0x0E, 0x0E, 0x00, 0x1E, 0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x1C, 0x1C,
+  0x00, 0x1C, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x38,
+  0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x78,
+  0x00, 0x70, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70,
+  0x00, 0x70, 0xF0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x07,
+  0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0x70, 0x70, 0xF0, 0xE0,
+  0xE0, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0,
+  0x03, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x38, 0x01, 0xE0, 0x3F, 0xC0, 0x7F,
+  0x00, 0xF8, 0x00, 0x07, 0x00, 0x1E, 0x07, 0x00, 0x3C, 0x07, 0x00, 0xF8,
+  0x0E, 0x01, 0xF0, 0x0E, 0x03, 0xE0, 0x0E, 0x07, 0x80, 0x0E, 0x0F, 0x00,
+  0x0E, 0x3E, 0x00, 0x1C, 0x7C, 0x00, 0x1C, 0xF8, 0x00, 0x1D, 0xE0, 0x00,
+  0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3B, 0xC0, 0x00, 0x39, 0xE0, 0x00,
+  0x38, 0xE0, 0x00, 0x38, 0xF0, 0x00, 0x38, 0x78, 0x00, 0x78, 0x3C, 0x00,
+  0x70, 0x1E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0x70, 0x07, 0x80,
+  0xF0, 0x03, 0xC0, 0xE0, 0x01, 0xE0, 0xE0, 0x01, 0xE0, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x07, 0xC0, 0x03, 0xF0, 0x7C, 0x00, 0x3F, 0x07, 0xE0, 0x07, 0xF0,
+  0xEE, 0x00, 0x7E, 0x0E, 0xE0, 0x0F, 0xE0, 0xEE, 0x00, 0xEE, 0x0E, 0xE0,
+  0x1C, 0xE0, 0xEE, 0x03, 0xDE, 0x1C, 0x70, 0x39, 0xC1, 0xC7, 0x07, 0x9C,
+  0x1C, 0x70, 0x71, 0xC1, 0xC7, 0x0F, 0x1C, 0x1C, 0x70, 0xE1, 0xC3, 0x83,
+  0x9C, 0x38, 0x38, 0x3B, 0xC3, 0x83, 0x83, 0xB8, 0x38, 0x38, 0x3F, 0x83,
+  0x83, 0x83, 0xF0, 0x38, 0x78, 0x3F, 0x07, 0x07, 0x01, 0xE0, 0x70, 0x70,
+  0x1C, 0x07, 0x07, 0x00, 0x00, 0x70, 0x70, 0x00, 0x07, 0x0F, 0x00, 0x00,
+  0xE0, 0xE0, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x07, 0xC0, 0x07, 0x07,
+  0xC0, 0x07, 0x07, 0xC0, 0x0F, 0x0F, 0xE0, 0x0E, 0x0E, 0xE0, 0x0E, 0x0E,
+  0xE0, 0x0E, 0x0E, 0xE0, 0x0E, 0x0E, 0x70, 0x1E, 0x1C, 0x70, 0x1C, 0x1C,
+  0x70, 0x1C, 0x1C, 0x78, 0x1C, 0x1C, 0x38, 0x1C, 0x1C, 0x38, 0x1C, 0x38,
+  0x38, 0x38, 0x38, 0x1C, 0x38, 0x38, 0x1C, 0x38, 0x38, 0x1C, 0x38, 0x38,
+  0x0E, 0x38, 0x78, 0x0E, 0x70, 0x70, 0x0E, 0x70, 0x70, 0x0F, 0x70, 0x70,
+  0x07, 0x70, 0x70, 0x07, 0x70, 0xF0, 0x07, 0xE0, 0xE0, 0x03, 0xE0, 0xE0,
+  0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
+  0x7C, 0x07, 0xC0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0x38, 0x78, 0x00, 0x1E,
+  0x78, 0x00, 0x07, 0x38, 0x00, 0x03, 0xBC, 0x00, 0x01, 0xDC, 0x00, 0x00,
+  0xEE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x1D, 0xC0, 0x00, 0x0E, 0xE0, 0x00, 0x0F, 0x70, 0x00, 0x07, 0x38, 0x00,
+  0x07, 0x9E, 0x00, 0x07, 0x87, 0x00, 0x07, 0x83, 0xC0, 0x07, 0x80, 0xF8,
+  0x0F, 0x80, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0xE0, 0x1F, 0x0E, 0x00,
+  0xF0, 0xE0, 0x07, 0x0E, 0x00, 0x70, 0xE0, 0x07, 0x1C, 0x00, 0x71, 0xC0,
+  0x0F, 0x1C, 0x01, 0xE1, 0xC0, 0x3E, 0x1F, 0xFF, 0xC3, 0xFF, 0xF0, 0x3F,
+  0xFC, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x78, 0x00, 0x07,
+  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00,
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFC, 0x00,
+  0x7F, 0xFF, 0x00, 0x7C, 0x07, 0xC0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0x38,
+  0x78, 0x00, 0x1E, 0x78, 0x00, 0x07, 0x38, 0x00, 0x03, 0xBC, 0x00, 0x01,
+  0xDC, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x1D, 0xC0, 0x00, 0x0E, 0xE0, 0x00, 0x0F, 0x70, 0x00,
+  0x07, 0x38, 0x00, 0x07, 0x9E, 0x00, 0x07, 0x87, 0x00, 0x07, 0x83, 0xC0,
+  0x07, 0x80, 0xF8, 0x0F, 0x80, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x01,
+  0xFF, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x07,
+  0xFF, 0xE0, 0xE0, 0x1F, 0x0E, 0x00, 0xF0, 0xE0, 0x07, 0x0E, 0x00, 0x70,
+  0xE0, 0x07, 0x1C, 0x00, 0x71, 0xC0, 0x0E, 0x1C, 0x01, 0xE1, 0xC0, 0x3C,
+  0x1F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F, 0xFF, 0x03, 0x80, 0xF8, 0x38, 0x07,
+  0x83, 0x80, 0x3C, 0x78, 0x03, 0xC7, 0x00, 0x1C, 0x70, 0x01, 0xC7, 0x00,
+  0x1E, 0x70, 0x00, 0xEF, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x07, 0x00,
+  0x7F, 0xC0, 0x3F, 0xFF, 0x07, 0xFF, 0xE0, 0xF8, 0x06, 0x1E, 0x00, 0x03,
+  0xC0, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00,
+  0x3F, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00,
+  0x1C, 0x00, 0x03, 0x88, 0x00, 0x78, 0xF0, 0x1F, 0x0F, 0xFF, 0xE0, 0xFF,
+  0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x1C,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00,
+  0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x1C, 0x00, 0x1C, 0x70, 0x00, 0x73, 0xC0, 0x01, 0xCE, 0x00, 0x07,
+  0x38, 0x00, 0x3C, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x78,
+  0x00, 0x39, 0xC0, 0x00, 0xE7, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0x70, 0x00,
+  0x71, 0xC0, 0x01, 0xCF, 0x00, 0x07, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3,
+  0x80, 0x03, 0x8E, 0x00, 0x1E, 0x38, 0x00, 0x70, 0xE0, 0x03, 0xC3, 0xC0,
+  0x0E, 0x07, 0xC0, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xC0,
+  0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3B, 0x80, 0x00, 0xF3, 0x80, 0x01,
+  0xC7, 0x00, 0x07, 0x0E, 0x00, 0x1E, 0x1C, 0x00, 0x38, 0x38, 0x00, 0xF0,
+  0x70, 0x01, 0xC0, 0x70, 0x07, 0x80, 0xE0, 0x0E, 0x01, 0xC0, 0x3C, 0x03,
+  0x80, 0x70, 0x07, 0x01, 0xC0, 0x0F, 0x07, 0x80, 0x0E, 0x0E, 0x00, 0x1C,
+  0x3C, 0x00, 0x38, 0x70, 0x00, 0x71, 0xE0, 0x00, 0xE3, 0x80, 0x01, 0xEF,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80,
+  0x00, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0xE0, 0x07, 0xC0, 0x0E,
+  0xE0, 0x07, 0xC0, 0x0E, 0xE0, 0x0F, 0xC0, 0x1E, 0xE0, 0x0F, 0xC0, 0x1C,
+  0xE0, 0x0F, 0xC0, 0x3C, 0xE0, 0x1D, 0xC0, 0x38, 0xE0, 0x1D, 0xC0, 0x78,
+  0x70, 0x3C, 0xE0, 0x70, 0x70, 0x38, 0xE0, 0x70, 0x70, 0x78, 0xE0, 0xE0,
+  0x70, 0x70, 0xE0, 0xE0, 0x70, 0xF0, 0xE1, 0xE0, 0x70, 0xE0, 0xE1, 0xC0,
+  0x70, 0xE0, 0xE3, 0xC0, 0x71, 0xC0, 0xE3, 0x80, 0x71, 0xC0, 0xE3, 0x80,
+  0x73, 0xC0, 0xE7, 0x00, 0x73, 0x80, 0xE7, 0x00, 0x77, 0x80, 0xEF, 0x00,
+  0x77, 0x00, 0xEE, 0x00, 0x77, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0xFC, 0x00,
+  0x7E, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0xF8, 0x00,
+  0x01, 0xC0, 0x03, 0xC0, 0x78, 0x01, 0xE0, 0x0E, 0x00, 0xF0, 0x03, 0xC0,
+  0x78, 0x00, 0x70, 0x3C, 0x00, 0x1E, 0x0F, 0x00, 0x03, 0x87, 0x80, 0x00,
+  0xE3, 0xC0, 0x00, 0x1D, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF8,
+  0x00, 0x01, 0xEE, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0x70, 0x00, 0x1E,
+  0x1C, 0x00, 0x0F, 0x03, 0x80, 0x07, 0x80, 0xE0, 0x03, 0xC0, 0x1C, 0x01,
+  0xE0, 0x07, 0x00, 0xF0, 0x01, 0xE0, 0x78, 0x00, 0x38, 0x3C, 0x00, 0x0F,
+  0x00, 0xF0, 0x00, 0x7B, 0x80, 0x07, 0x9C, 0x00, 0x78, 0x70, 0x07, 0x83,
+  0x80, 0x78, 0x1E, 0x07, 0x80, 0x70, 0x3C, 0x03, 0xC3, 0xC0, 0x0E, 0x3C,
+  0x00, 0x73, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x01,
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00,
+  0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+  0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x83, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x1F, 0xC1,
+  0xFC, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0F, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x00, 0xE3,
+  0x8E, 0x38, 0xE1, 0x87, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC3, 0x0C, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x18, 0x71, 0xC7, 0x1C, 0x07, 0xF8, 0x3F,
+  0xC1, 0xFE, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01,
+  0xC0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x0F, 0xF0, 0x7F, 0x03, 0xF8, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xF3, 0xC0, 0x07,
+  0x87, 0x80, 0x3C, 0x0F, 0x01, 0xE0, 0x1E, 0x0F, 0x00, 0x3C, 0x78, 0x00,
+  0x7B, 0xC0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0,
+  0xE0, 0xE0, 0xE1, 0xC1, 0xC0, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF8,
+  0x38, 0x1F, 0x10, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x0F, 0xFF, 0x1F,
+  0xFF, 0xCF, 0xFF, 0xE7, 0xC0, 0x3B, 0xC0, 0x0E, 0xE0, 0x07, 0xB8, 0x01,
+  0xEE, 0x00, 0xF3, 0xC0, 0xFC, 0x7F, 0xF7, 0x0F, 0xF9, 0xC1, 0xF8, 0x70,
+  0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x1C, 0x3E, 0x03, 0x9F, 0xF0,
+  0x77, 0xFF, 0x0F, 0xC1, 0xE1, 0xF0, 0x1E, 0x7C, 0x01, 0xCF, 0x00, 0x39,
+  0xE0, 0x07, 0x38, 0x00, 0xE7, 0x00, 0x1C, 0xE0, 0x07, 0xB8, 0x00, 0xE7,
+  0x80, 0x1C, 0xF0, 0x07, 0x1E, 0x01, 0xE3, 0xF0, 0xF8, 0xFF, 0xFE, 0x1C,
+  0xFF, 0x83, 0x87, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x83, 0xFF, 0xE3,
+  0xE0, 0x73, 0xC0, 0x11, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+  0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0xC0,
+  0x10, 0xF0, 0x38, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x01, 0xF8, 0xE0, 0x3F, 0xE7,
+  0x03, 0xFF, 0xB8, 0x3E, 0x0F, 0xC3, 0xC0, 0x3E, 0x1C, 0x00, 0xF1, 0xE0,
+  0x07, 0x0E, 0x00, 0x38, 0xF0, 0x01, 0xC7, 0x00, 0x0E, 0x38, 0x00, 0xF1,
+  0xC0, 0x07, 0x0E, 0x00, 0x78, 0x70, 0x03, 0xC3, 0xC0, 0x3E, 0x0F, 0x07,
+  0xF0, 0x7F, 0xFF, 0x01, 0xFF, 0x38, 0x03, 0xE1, 0xC0, 0x00, 0xFC, 0x01,
+  0xFF, 0xC0, 0xFF, 0xF8, 0x7C, 0x1E, 0x3C, 0x03, 0xCE, 0x00, 0x77, 0x80,
+  0x1D, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x11, 0xE0, 0x38, 0x7F, 0xFE, 0x0F,
+  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1, 0xE0, 0x07,
+  0x00, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0x7F, 0xF1, 0xFF, 0xCF, 0xFE, 0x07,
+  0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x38, 0x00, 0xE0, 0x03,
+  0x80, 0x0E, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x03,
+  0x80, 0x0E, 0x00, 0x00, 0x01, 0xF0, 0xE0, 0xFF, 0x9C, 0x3F, 0xFF, 0x8F,
+  0x83, 0xE3, 0xC0, 0x3C, 0x70, 0x07, 0x9C, 0x00, 0x73, 0x80, 0x1E, 0xE0,
+  0x03, 0x9C, 0x00, 0x73, 0x80, 0x0E, 0x70, 0x01, 0xCE, 0x00, 0x79, 0xC0,
+  0x0E, 0x3C, 0x03, 0xC3, 0xC1, 0xF8, 0x7F, 0xF7, 0x07, 0xFD, 0xC0, 0x7E,
+  0x38, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x30, 0x3E, 0x07, 0xFF,
+  0x80, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70,
+  0x00, 0x1C, 0x3F, 0x03, 0x9F, 0xF8, 0x77, 0xFF, 0x0F, 0xC1, 0xF1, 0xF0,
+  0x1E, 0x78, 0x01, 0xCF, 0x00, 0x39, 0xC0, 0x07, 0x38, 0x01, 0xE7, 0x00,
+  0x38, 0xE0, 0x07, 0x38, 0x00, 0xE7, 0x00, 0x3C, 0xE0, 0x07, 0x1C, 0x00,
+  0xE3, 0x80, 0x1C, 0xF0, 0x07, 0x9C, 0x00, 0xE3, 0x80, 0x1C, 0x00, 0x07,
+  0x07, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x1E, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0xE0, 0xE0, 0x00, 0x38, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x80, 0x3C, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x07, 0x80, 0x38, 0x1F, 0xC0, 0xFC, 0x07, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x03, 0xE1, 0xC0, 0x7C, 0x1C,
+  0x0F, 0x81, 0xC3, 0xE0, 0x1C, 0x7C, 0x03, 0xCF, 0x80, 0x3B, 0xE0, 0x03,
+  0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x07, 0x3C, 0x00,
+  0x71, 0xE0, 0x07, 0x0F, 0x00, 0x70, 0x78, 0x07, 0x03, 0xC0, 0xF0, 0x1E,
+  0x0E, 0x00, 0xF0, 0xE0, 0x0F, 0x00, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0x0E, 0x3E, 0x03,
+  0xE0, 0x3B, 0xFE, 0x1F, 0xE1, 0xFF, 0xF9, 0xFF, 0x87, 0xE1, 0xF6, 0x0F,
+  0x1F, 0x03, 0xF0, 0x3C, 0x78, 0x07, 0x80, 0x71, 0xC0, 0x1C, 0x01, 0xCF,
+  0x00, 0x70, 0x07, 0x38, 0x01, 0xC0, 0x3C, 0xE0, 0x0E, 0x00, 0xE3, 0x80,
+  0x38, 0x03, 0x8E, 0x00, 0xE0, 0x0E, 0x70, 0x03, 0x80, 0x79, 0xC0, 0x1C,
+  0x01, 0xC7, 0x00, 0x70, 0x07, 0x1C, 0x01, 0xC0, 0x1C, 0x70, 0x07, 0x00,
+  0x73, 0x80, 0x38, 0x03, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0x0E, 0x1F, 0x01,
+  0xCF, 0xF8, 0x7F, 0xFF, 0x0F, 0xC1, 0xF1, 0xF0, 0x1E, 0x3C, 0x01, 0xC7,
+  0x00, 0x39, 0xE0, 0x07, 0x38, 0x01, 0xE7, 0x00, 0x38, 0xE0, 0x07, 0x1C,
+  0x00, 0xE7, 0x00, 0x3C, 0xE0, 0x07, 0x1C, 0x00, 0xE3, 0x80, 0x1C, 0x70,
+  0x03, 0x9C, 0x00, 0xE3, 0x80, 0x1C, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7C, 0x1E, 0x3C, 0x03, 0xCE, 0x00, 0x77, 0x00, 0x1D, 0xC0,
+  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0E, 0xE0, 0x03,
+  0xB8, 0x01, 0xCF, 0x00, 0xF1, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00,
+  0xFE, 0x00, 0x07, 0x0F, 0x80, 0x39, 0xFF, 0x01, 0xFF, 0xFC, 0x1F, 0xC1,
+  0xE0, 0xF8, 0x07, 0x87, 0x80, 0x1C, 0x3C, 0x00, 0xE1, 0xC0, 0x07, 0x1E,
+  0x00, 0x38, 0xE0, 0x01, 0xC7, 0x00, 0x1E, 0x38, 0x00, 0xE1, 0xC0, 0x0F,
+  0x1E, 0x00, 0x70, 0xF8, 0x07, 0x87, 0xE0, 0xF8, 0x3B, 0xFF, 0x81, 0xDF,
+  0xF8, 0x1E, 0x3F, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
+  0xF8, 0xE0, 0xFF, 0x9C, 0x3F, 0xFF, 0x8F, 0x83, 0xE3, 0xC0, 0x3C, 0x70,
+  0x07, 0x9C, 0x00, 0x73, 0x80, 0x0E, 0xE0, 0x03, 0x9C, 0x00, 0x73, 0x80,
+  0x0E, 0x70, 0x01, 0xCE, 0x00, 0x79, 0xC0, 0x1E, 0x3C, 0x07, 0xC3, 0xC1,
+  0xF8, 0x7F, 0xF7, 0x07, 0xFC, 0xE0, 0x7E, 0x38, 0x00, 0x07, 0x00, 0x00,
+  0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x0E, 0x3E, 0x1D, 0xFC, 0x7F, 0xF8, 0xFE, 0x01, 0xF0, 0x03, 0xC0,
+  0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x01, 0xC0, 0x03, 0x80,
+  0x00, 0x00, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xE1, 0xE0, 0x31, 0xC0, 0x00,
+  0xE0, 0x00, 0x78, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x0F,
+  0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x39, 0x00, 0x3C, 0xE0, 0x3C, 0xFF,
+  0xFC, 0x3F, 0xFC, 0x03, 0xF8, 0x00, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0,
+  0x1C, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x03, 0x80, 0x38, 0x07, 0x80,
+  0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+  0xF0, 0x0F, 0xF8, 0x7F, 0x83, 0xF8, 0x1C, 0x00, 0xE3, 0x80, 0x1C, 0xE0,
+  0x07, 0x1C, 0x00, 0xE3, 0x80, 0x1C, 0x70, 0x03, 0x9E, 0x00, 0x73, 0x80,
+  0x1C, 0x70, 0x03, 0x8E, 0x00, 0x73, 0xC0, 0x0E, 0x70, 0x03, 0xCE, 0x00,
+  0x71, 0xC0, 0x1E, 0x3C, 0x07, 0xC7, 0xC1, 0xF8, 0x7F, 0xFF, 0x0F, 0xF9,
+  0xC0, 0x7C, 0x38, 0x00, 0xE0, 0x01, 0xFC, 0x00, 0x3B, 0xC0, 0x0F, 0x38,
+  0x03, 0xC7, 0x00, 0x70, 0xE0, 0x1E, 0x1C, 0x03, 0x83, 0x80, 0xF0, 0x38,
+  0x1C, 0x07, 0x07, 0x00, 0xE1, 0xE0, 0x1C, 0x38, 0x03, 0x8F, 0x00, 0x39,
+  0xC0, 0x07, 0x78, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7C,
+  0x00, 0x00, 0xE0, 0x3E, 0x03, 0xF8, 0x0F, 0x80, 0xEE, 0x03, 0xE0, 0x3B,
+  0x81, 0xF8, 0x1C, 0xE0, 0x7E, 0x07, 0x38, 0x3B, 0x83, 0x8E, 0x0E, 0xE0,
+  0xE1, 0xC7, 0x38, 0x78, 0x71, 0xCE, 0x1C, 0x1C, 0xF1, 0xCF, 0x07, 0x38,
+  0x73, 0x81, 0xDE, 0x1D, 0xE0, 0x77, 0x07, 0x70, 0x1F, 0xC1, 0xFC, 0x07,
+  0xE0, 0x7E, 0x01, 0xF8, 0x1F, 0x80, 0x7C, 0x07, 0xC0, 0x1F, 0x01, 0xF0,
+  0x07, 0x80, 0x78, 0x00, 0x07, 0x00, 0x7C, 0x1E, 0x03, 0xE0, 0x38, 0x0F,
+  0x00, 0xF0, 0x78, 0x01, 0xC3, 0xC0, 0x03, 0x9E, 0x00, 0x0F, 0xF0, 0x00,
+  0x1F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
+  0x00, 0x03, 0xCE, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0x70, 0x07, 0x81, 0xE0,
+  0x3E, 0x03, 0x81, 0xF0, 0x0F, 0x0F, 0x80, 0x1C, 0x00, 0x0E, 0x00, 0x3C,
+  0x38, 0x00, 0xE0, 0xE0, 0x07, 0x03, 0x80, 0x3C, 0x07, 0x00, 0xE0, 0x1C,
+  0x07, 0x80, 0x70, 0x3C, 0x01, 0xC0, 0xE0, 0x07, 0x87, 0x80, 0x0E, 0x1C,
+  0x00, 0x38, 0xF0, 0x00, 0xE7, 0x80, 0x03, 0x9C, 0x00, 0x07, 0xF0, 0x00,
+  0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE1,
+  0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
+  0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
+  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x7F,
+  0xFF, 0x1F, 0xFF, 0xE3, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xE0,
+  0x07, 0xF8, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03,
+  0x80, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0,
+  0x01, 0xE0, 0x07, 0xF0, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xC0, 0x00,
+  0x70, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C,
+  0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0F, 0x00,
+  0x03, 0xFC, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x01,
+  0xFC, 0x00, 0xFF, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x78, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x3C, 0x00,
+  0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x03, 0xF8,
+  0x03, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x05, 0xFF, 0xE0, 0x7F, 0xFF,
+  0xFF, 0xFC, 0x1F, 0xFE, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x07, 0x0E, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0x00, 0x18, 0x00, 0x0C, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x01, 0x00, 0x07, 0xE0, 0x0F, 0xFC, 0x1F, 0xFF,
+  0x1F, 0x33, 0x9E, 0x18, 0x8E, 0x08, 0x0E, 0x0C, 0x07, 0x06, 0x07, 0x03,
+  0x03, 0x81, 0x01, 0xC1, 0x80, 0xE0, 0xC0, 0x70, 0x60, 0x38, 0x30, 0x1E,
+  0x10, 0x87, 0x99, 0xC3, 0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0x01, 0x00,
+  0x00, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x03, 0xF0,
+  0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0x02, 0x00, 0x78, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xFE, 0x01,
+  0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00,
+  0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x40, 0x00, 0x5C,
+  0x00, 0x1D, 0xE7, 0xCF, 0x1F, 0xFF, 0xC1, 0xFF, 0xF0, 0x3C, 0x1E, 0x07,
+  0x01, 0xC1, 0xC0, 0x1C, 0x38, 0x03, 0x87, 0x00, 0x70, 0xE0, 0x0E, 0x1C,
+  0x01, 0xC1, 0xC0, 0x70, 0x3C, 0x1E, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x79,
+  0xF1, 0xDC, 0x00, 0x1D, 0x00, 0x01, 0x00, 0x38, 0x00, 0x79, 0xE0, 0x03,
+  0x87, 0x00, 0x3C, 0x38, 0x03, 0xC1, 0xE0, 0x1C, 0x07, 0x01, 0xE0, 0x38,
+  0x1E, 0x01, 0xE0, 0xE0, 0x07, 0x0F, 0x00, 0x38, 0xF0, 0x01, 0xC7, 0x00,
+  0xFF, 0x7F, 0x87, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xC0, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0x07, 0x00, 0x00,
+  0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x78,
+  0x30, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x03,
+  0xF8, 0x03, 0xBE, 0x03, 0x87, 0xC3, 0x81, 0xE1, 0xC0, 0x78, 0xE0, 0x1C,
+  0x78, 0x0E, 0x1E, 0x06, 0x07, 0xC7, 0x01, 0xF7, 0x00, 0x3E, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x30, 0x78, 0x1F,
+  0xFC, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x70, 0xFE, 0x3F, 0xC7, 0xF0, 0xE0,
+  0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x07,
+  0x01, 0xC0, 0x01, 0xC1, 0xC3, 0xF8, 0x71, 0xC3, 0xFE, 0x18, 0xC3, 0xC1,
+  0x06, 0x63, 0x80, 0x03, 0x63, 0xC0, 0x00, 0xF1, 0xC0, 0x00, 0x78, 0xE0,
+  0x00, 0x3C, 0x70, 0x00, 0x1E, 0x38, 0x00, 0x0F, 0x1C, 0x00, 0x07, 0x8F,
+  0x00, 0x03, 0x63, 0x80, 0x03, 0x30, 0xF0, 0x41, 0x9C, 0x3F, 0xE1, 0xC7,
+  0x0F, 0xE1, 0xC1, 0xC0, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0x1E, 0x03, 0xC0,
+  0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xE0, 0x83,
+  0xC0, 0x07, 0x00, 0x1C, 0x1F, 0xF1, 0xFF, 0xCE, 0x06, 0x70, 0x39, 0xC0,
+  0xE7, 0x07, 0x9E, 0x3E, 0x3F, 0xB0, 0x7C, 0xC0, 0x00, 0x00, 0x00, 0xFF,
+  0xE3, 0xFF, 0x80, 0x00, 0x40, 0x40, 0x30, 0x30, 0x1C, 0x1C, 0x1E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x87, 0x87, 0x87, 0x83, 0xC3, 0xC0, 0xE0, 0xE0, 0x1C,
+  0x1C, 0x03, 0x83, 0x80, 0x70, 0x70, 0x0E, 0x0E, 0x01, 0xC3, 0x80, 0x20,
+  0x60, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00,
+  0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x07,
+  0x01, 0xC0, 0x01, 0xC1, 0xC7, 0xF8, 0x71, 0xC3, 0xFE, 0x18, 0xC1, 0xC7,
+  0x86, 0x60, 0xE1, 0xC3, 0x60, 0x70, 0xE0, 0xF0, 0x38, 0xF0, 0x78, 0x1F,
+  0xF0, 0x3C, 0x0F, 0xE0, 0x1E, 0x07, 0x38, 0x0F, 0x03, 0x8C, 0x07, 0x81,
+  0xC7, 0x03, 0x60, 0xE3, 0x83, 0x30, 0x70, 0xE1, 0x9C, 0x38, 0x71, 0xC7,
+  0x1C, 0x1D, 0xC1, 0xC0, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0x1E, 0x03, 0xC0,
+  0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x7C, 0x07, 0x80, 0xF0, 0x1F, 0x07, 0x71,
+  0xC7, 0xF0, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0,
+  0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC1, 0xFE, 0x10,
+  0x70, 0x03, 0x00, 0x30, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x1C,
+  0x07, 0x80, 0xFF, 0xEF, 0xFE, 0x07, 0xC1, 0xFF, 0x10, 0x70, 0x03, 0x00,
+  0x60, 0xFC, 0x0F, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x6C, 0x1C, 0xFF,
+  0x87, 0xE0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x07, 0x00, 0x38,
+  0x38, 0x01, 0xC1, 0xC0, 0x1E, 0x1C, 0x00, 0xE0, 0xE0, 0x07, 0x07, 0x00,
+  0x38, 0x38, 0x01, 0xC1, 0xC0, 0x1C, 0x1C, 0x00, 0xE0, 0xE0, 0x07, 0x07,
+  0x00, 0x38, 0x38, 0x01, 0xC1, 0xC0, 0x1C, 0x1E, 0x00, 0xE0, 0xF0, 0x0F,
+  0x07, 0xC1, 0xF8, 0x3F, 0xFD, 0xF1, 0xDF, 0xCF, 0x9E, 0x7C, 0x38, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xE0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x87, 0xF8,
+  0xC7, 0xFC, 0x67, 0xFE, 0x33, 0xFE, 0x3B, 0xFF, 0x1D, 0xFF, 0x8C, 0xFF,
+  0xC6, 0x7F, 0xE3, 0x3F, 0xE3, 0x8F, 0xF1, 0xC7, 0xF8, 0xC0, 0xFC, 0x60,
+  0x0E, 0x30, 0x07, 0x38, 0x03, 0x1C, 0x01, 0x8E, 0x01, 0xC6, 0x00, 0xE3,
+  0x00, 0x71, 0x80, 0x31, 0xC0, 0x18, 0xE0, 0x0C, 0x60, 0x0E, 0x30, 0x07,
+  0x18, 0x03, 0x1C, 0x01, 0x8E, 0x00, 0xC6, 0x00, 0x77, 0xEE, 0x06, 0x03,
+  0x03, 0x03, 0x87, 0xFE, 0xFC, 0x0F, 0x1F, 0x8C, 0xC0, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x87, 0xFF, 0xFC, 0x03, 0xF0, 0x1F,
+  0xF0, 0x78, 0x70, 0xE0, 0x73, 0x80, 0xEE, 0x01, 0xDC, 0x03, 0xB8, 0x07,
+  0x70, 0x0E, 0xE0, 0x39, 0xC0, 0xF1, 0xC3, 0xC1, 0xFF, 0x01, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xE0, 0x10, 0x10, 0x06, 0x04, 0x01,
+  0xC1, 0x80, 0x70, 0x70, 0x0E, 0x0E, 0x01, 0xC1, 0xC0, 0x38, 0x38, 0x07,
+  0x07, 0x03, 0xC3, 0xC1, 0xE1, 0xE1, 0xE1, 0xE0, 0xF0, 0xF0, 0x78, 0x78,
+  0x38, 0x38, 0x0C, 0x0C, 0x02, 0x02, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x3F,
+  0x00, 0x01, 0xC0, 0x33, 0x00, 0x03, 0x80, 0x06, 0x00, 0x07, 0x00, 0x06,
+  0x00, 0x0E, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x06,
+  0x00, 0x38, 0x00, 0x06, 0x00, 0x70, 0x00, 0x0C, 0x00, 0xE0, 0x00, 0x0C,
+  0x00, 0xE0, 0x00, 0x0C, 0x01, 0xC0, 0x0E, 0x7F, 0x83, 0x80, 0x1E, 0xFF,
+  0x87, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x6C, 0x00, 0x1E, 0x00, 0xCC, 0x00,
+  0x1C, 0x01, 0x9C, 0x00, 0x38, 0x03, 0x1C, 0x00, 0x70, 0x06, 0x18, 0x00,
+  0xE0, 0x0C, 0x18, 0x01, 0xE0, 0x1F, 0xFE, 0x01, 0xC0, 0x1F, 0xFE, 0x03,
+  0x80, 0x00, 0x38, 0x07, 0x00, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x30, 0x1E,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x7E, 0x00, 0x03, 0x80, 0xCC,
+  0x00, 0x0E, 0x00, 0x30, 0x00, 0x38, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0,
+  0x01, 0xC0, 0x01, 0x80, 0x07, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x06, 0x00,
+  0x70, 0x00, 0x18, 0x01, 0xC0, 0x00, 0x30, 0x03, 0x80, 0x00, 0x60, 0x0E,
+  0x0F, 0xC7, 0xF8, 0x38, 0x3F, 0xDF, 0xF0, 0xE0, 0x41, 0xC0, 0x03, 0x80,
+  0x01, 0x80, 0x0F, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x70, 0x00,
+  0x38, 0x01, 0xC0, 0x00, 0xE0, 0x07, 0x00, 0x07, 0x80, 0x1E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0xC0, 0x03, 0x80, 0x0F, 0xFE,
+  0x0E, 0x00, 0x1F, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x70,
+  0x0F, 0xF8, 0x00, 0x70, 0x04, 0x1C, 0x00, 0x70, 0x00, 0x06, 0x00, 0x70,
+  0x00, 0x06, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x38,
+  0x00, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x60, 0x38, 0x00, 0x00, 0x30, 0x38,
+  0x00, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x38, 0x1C, 0x00, 0xEF, 0xF8, 0x1C,
+  0x00, 0xF3, 0xF0, 0x1C, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0xD8, 0x00, 0x1E,
+  0x00, 0xCC, 0x00, 0x0E, 0x00, 0xCE, 0x00, 0x0E, 0x00, 0xC7, 0x00, 0x0E,
+  0x00, 0xC3, 0x00, 0x0E, 0x00, 0xC1, 0x80, 0x0F, 0x00, 0xFF, 0xF0, 0x07,
+  0x00, 0x7F, 0xF8, 0x07, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x30, 0x07,
+  0x00, 0x00, 0x18, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70,
+  0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x07, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x1F, 0x03,
+  0xDF, 0xFE, 0x7F, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
+  0x1F, 0x80, 0x00, 0x77, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x9E, 0x00, 0x0F,
+  0x1C, 0x00, 0x1C, 0x38, 0x00, 0x78, 0x70, 0x00, 0xE0, 0xE0, 0x03, 0xC1,
+  0xC0, 0x07, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x0E,
+  0x03, 0xC0, 0x1C, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0,
+  0xF0, 0x00, 0xE1, 0xC0, 0x01, 0xC7, 0x00, 0x03, 0x9E, 0x00, 0x07, 0xB8,
+  0x00, 0x07, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00,
+  0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
+  0x80, 0x00, 0x77, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x9E, 0x00, 0x0F, 0x1C,
+  0x00, 0x1C, 0x38, 0x00, 0x78, 0x70, 0x00, 0xE0, 0xE0, 0x03, 0xC1, 0xC0,
+  0x07, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x0E, 0x03,
+  0xC0, 0x1C, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xF0,
+  0x00, 0xE1, 0xC0, 0x01, 0xC7, 0x00, 0x03, 0x9E, 0x00, 0x07, 0xB8, 0x00,
+  0x07, 0xF0, 0x00, 0x0E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x1C,
+  0xE0, 0x00, 0x70, 0xC0, 0x01, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
+  0x00, 0x77, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x9E, 0x00, 0x0F, 0x1C, 0x00,
+  0x1C, 0x38, 0x00, 0x78, 0x70, 0x00, 0xE0, 0xE0, 0x03, 0xC1, 0xC0, 0x07,
+  0x01, 0xC0, 0x1C, 0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x0E, 0x03, 0xC0,
+  0x1C, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xF0, 0x00,
+  0xE1, 0xC0, 0x01, 0xC7, 0x00, 0x03, 0x9E, 0x00, 0x07, 0xB8, 0x00, 0x07,
+  0xF0, 0x00, 0x0E, 0x00, 0x07, 0x86, 0x00, 0x1F, 0x98, 0x00, 0x33, 0xF0,
+  0x00, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3B, 0x80, 0x00,
+  0xF7, 0x00, 0x01, 0xCF, 0x00, 0x07, 0x8E, 0x00, 0x0E, 0x1C, 0x00, 0x3C,
+  0x38, 0x00, 0x70, 0x70, 0x01, 0xE0, 0xE0, 0x03, 0x80, 0xE0, 0x0E, 0x01,
+  0xC0, 0x3C, 0x03, 0x80, 0x70, 0x07, 0x01, 0xE0, 0x0E, 0x03, 0xFF, 0xFC,
+  0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x78, 0x00, 0x70, 0xE0, 0x00, 0xE3,
+  0x80, 0x01, 0xCF, 0x00, 0x03, 0xDC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0x00,
+  0x07, 0x0E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x70, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x07,
+  0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3B, 0x80, 0x00, 0xF7, 0x00, 0x01, 0xCF,
+  0x00, 0x07, 0x8E, 0x00, 0x0E, 0x1C, 0x00, 0x3C, 0x38, 0x00, 0x70, 0x70,
+  0x01, 0xE0, 0xE0, 0x03, 0x80, 0xE0, 0x0E, 0x01, 0xC0, 0x3C, 0x03, 0x80,
+  0x70, 0x07, 0x01, 0xE0, 0x0E, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xF8, 0x78, 0x00, 0x70, 0xE0, 0x00, 0xE3, 0x80, 0x01, 0xCF, 0x00,
+  0x03, 0xDC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0x00, 0x03, 0xE0, 0x00, 0x0F,
+  0xE0, 0x00, 0x38, 0xE0, 0x00, 0x60, 0xC0, 0x00, 0xC1, 0x80, 0x01, 0xC7,
+  0x00, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3B, 0x80, 0x00, 0xF7, 0x00, 0x01, 0xC7, 0x00, 0x07, 0x8E, 0x00,
+  0x0E, 0x1C, 0x00, 0x3C, 0x38, 0x00, 0x70, 0x70, 0x01, 0xE0, 0xE0, 0x03,
+  0x80, 0xE0, 0x0E, 0x01, 0xC0, 0x3C, 0x03, 0x80, 0x70, 0x07, 0x01, 0xE0,
+  0x0E, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x78, 0x00,
+  0x71, 0xE0, 0x00, 0xE3, 0x80, 0x01, 0xCF, 0x00, 0x01, 0xDC, 0x00, 0x03,
+  0xF8, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
+  0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x78, 0xE0, 0x00, 0x00, 0x07, 0x1E,
+  0x00, 0x00, 0x00, 0xF1, 0xC0, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x01,
+  0xE1, 0xC0, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x03, 0x81, 0xC0, 0x00,
+  0x00, 0x78, 0x38, 0x00, 0x00, 0x07, 0x03, 0xFF, 0xF8, 0x00, 0xF0, 0x3F,
+  0xFF, 0x80, 0x1E, 0x03, 0xFF, 0xF8, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x3C,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xE0,
+  0x00, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x07, 0x80,
+  0x0F, 0xFF, 0xF0, 0x70, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x1F, 0xFF, 0xF0,
+  0x00, 0x1F, 0xE0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0x01, 0xF0,
+  0xF8, 0x00, 0xE1, 0xE0, 0x00, 0x87, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x02,
+  0x0F, 0x00, 0x0C, 0x0F, 0x80, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0,
+  0x03, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00,
+  0x03, 0x00, 0x01, 0x0E, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xC3, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00,
+  0x38, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xFC, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x00, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
+  0xFF, 0x00, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x07,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xFC, 0x1C, 0x00, 0x00,
+  0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x1C,
+  0xE0, 0x01, 0xC3, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0x80, 0x00, 0x1C, 0x00,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x1C,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xFC,
+  0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0xC0,
+  0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03,
+  0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x70, 0xE0, 0x07,
+  0x8F, 0x00, 0x3C, 0x78, 0x01, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x70, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x03,
+  0x80, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
+  0x83, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x78,
+  0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00,
+  0x7F, 0xFF, 0xC3, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x1E, 0x07, 0x01, 0xC0,
+  0xE0, 0x38, 0x00, 0x00, 0x0E, 0x07, 0x03, 0x83, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0xC1, 0xC0, 0xE0, 0x00, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x01,
+  0xC0, 0x1C, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x07,
+  0x80, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x00,
+  0x07, 0xC0, 0xFC, 0x1C, 0xE3, 0x86, 0x70, 0x70, 0x00, 0x00, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80,
+  0x38, 0x07, 0x80, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x0E, 0x00,
+  0xE0, 0x00, 0x1C, 0x39, 0xE3, 0xCF, 0x1E, 0x70, 0xE0, 0x00, 0x00, 0x00,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07,
+  0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07,
+  0x00, 0x78, 0x03, 0x80, 0x1C, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0x00, 0xE0, 0x0F, 0xC0, 0x70, 0x00, 0xF0, 0x38, 0x00,
+  0x38, 0x1C, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x0E, 0x00, 0x03, 0x87, 0x00,
+  0x01, 0xC3, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF,
+  0xC0, 0x1C, 0x70, 0x00, 0x1C, 0x38, 0x00, 0x0E, 0x1C, 0x00, 0x07, 0x0E,
+  0x00, 0x07, 0x0F, 0x00, 0x03, 0x87, 0x00, 0x03, 0x83, 0x80, 0x03, 0xC1,
+  0xC0, 0x07, 0xC0, 0xE0, 0x0F, 0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x80,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x18, 0x00, 0x3F, 0x30, 0x00, 0x33,
+  0xF0, 0x00, 0x61, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+  0x07, 0x07, 0xC0, 0x07, 0x07, 0xC0, 0x0F, 0x0F, 0xE0, 0x0E, 0x0E, 0xE0,
+  0x0E, 0x0E, 0xE0, 0x0E, 0x0E, 0xE0, 0x0E, 0x0E, 0x70, 0x1E, 0x1C, 0x70,
+  0x1C, 0x1C, 0x70, 0x1C, 0x1C, 0x78, 0x1C, 0x1C, 0x38, 0x1C, 0x1C, 0x38,
+  0x1C, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x38, 0x38, 0x1C, 0x38, 0x38, 0x1C,
+  0x38, 0x38, 0x0E, 0x38, 0x78, 0x0E, 0x70, 0x70, 0x0E, 0x70, 0x70, 0x0F,
+  0x70, 0x70, 0x07, 0x70, 0x70, 0x07, 0x70, 0xF0, 0x07, 0xE0, 0xE0, 0x03,
+  0xE0, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00,
+  0xF8, 0x0F, 0x80, 0xF0, 0x01, 0xE0, 0xF0, 0x00, 0x70, 0xF0, 0x00, 0x3C,
+  0xF0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0x78, 0x00, 0x03, 0xB8, 0x00, 0x01,
+  0xDC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x3B, 0x80, 0x00, 0x1D, 0xC0, 0x00, 0x1E, 0xE0, 0x00, 0x0E, 0x70, 0x00,
+  0x0F, 0x3C, 0x00, 0x0F, 0x0E, 0x00, 0x0F, 0x07, 0x80, 0x0F, 0x01, 0xF0,
+  0x1F, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0xF8, 0x0F, 0x80, 0xF0,
+  0x01, 0xE0, 0xF0, 0x00, 0x70, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x0E, 0x70,
+  0x00, 0x07, 0x78, 0x00, 0x03, 0xB8, 0x00, 0x01, 0xDC, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3B, 0x80, 0x00, 0x1D,
+  0xC0, 0x00, 0x1E, 0xE0, 0x00, 0x0E, 0x70, 0x00, 0x0F, 0x3C, 0x00, 0x0F,
+  0x0E, 0x00, 0x0F, 0x07, 0x80, 0x0F, 0x01, 0xF0, 0x1F, 0x00, 0x7F, 0xFF,
+  0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x03, 0xF0, 0x00, 0x03, 0x9C, 0x00, 0x03, 0x86, 0x00, 0x03, 0x83, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFE, 0x00, 0xF8, 0x0F, 0x80, 0xF0, 0x01, 0xE0, 0xF0, 0x00,
+  0x70, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0x78, 0x00,
+  0x03, 0xB8, 0x00, 0x01, 0xDC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x3B, 0x80, 0x00, 0x1D, 0xC0, 0x00, 0x1E, 0xE0,
+  0x00, 0x0E, 0x70, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x0E, 0x00, 0x0F, 0x07,
+  0x80, 0x0F, 0x01, 0xF0, 0x1F, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0xCC, 0x00, 0x06,
+  0x7E, 0x00, 0x06, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x1F, 0x01,
+  0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xE1, 0xE0, 0x00, 0x79, 0xE0, 0x00, 0x1C,
+  0xE0, 0x00, 0x0E, 0xF0, 0x00, 0x07, 0x70, 0x00, 0x03, 0xB8, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x77, 0x00, 0x00,
+  0x3B, 0x80, 0x00, 0x3D, 0xC0, 0x00, 0x1C, 0xE0, 0x00, 0x1E, 0x78, 0x00,
+  0x1E, 0x1C, 0x00, 0x1E, 0x0F, 0x00, 0x1E, 0x03, 0xE0, 0x3E, 0x00, 0xFF,
+  0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0E, 0x1C, 0x00,
+  0x0F, 0x1E, 0x00, 0x07, 0x8F, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFC,
+  0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xE1, 0xE0, 0x00,
+  0x79, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x0E, 0xF0, 0x00, 0x07, 0x70, 0x00,
+  0x03, 0xB8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x77, 0x00, 0x00, 0x3B, 0x80, 0x00, 0x3D, 0xC0, 0x00, 0x1C, 0xE0,
+  0x00, 0x1E, 0x78, 0x00, 0x1E, 0x1C, 0x00, 0x1E, 0x0F, 0x00, 0x1E, 0x03,
+  0xE0, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xF8, 0x00,
+  0x20, 0x00, 0x47, 0x00, 0x0E, 0xF8, 0x01, 0xF7, 0xC0, 0x3E, 0x3E, 0x07,
+  0xC1, 0xF0, 0xF8, 0x0F, 0x9F, 0x00, 0x7F, 0xE0, 0x03, 0xFC, 0x00, 0x1F,
+  0x80, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xFE, 0x00, 0xF9, 0xF0, 0x1F,
+  0x0F, 0x83, 0xE0, 0x7C, 0x7C, 0x03, 0xEF, 0x80, 0x1F, 0x70, 0x00, 0xE2,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xC0, 0x07, 0xFF,
+  0x8E, 0x00, 0xFF, 0xFE, 0xE0, 0x0F, 0xC0, 0xFE, 0x00, 0xF0, 0x01, 0xE0,
+  0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x01, 0xFC, 0x0F, 0x00, 0x1E, 0xE0, 0x70,
+  0x01, 0xE7, 0x07, 0x80, 0x1C, 0x38, 0x38, 0x01, 0xC1, 0xC1, 0xC0, 0x3C,
+  0x0E, 0x1C, 0x03, 0xC0, 0x70, 0xE0, 0x3C, 0x03, 0x87, 0x03, 0x80, 0x38,
+  0x38, 0x78, 0x01, 0xC1, 0xC7, 0x80, 0x1E, 0x0E, 0x78, 0x00, 0xE0, 0x77,
+  0x00, 0x0F, 0x03, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x78, 0x00,
+  0xF0, 0x07, 0xF0, 0x1F, 0x00, 0x77, 0xFF, 0xF0, 0x07, 0x1F, 0xFE, 0x00,
+  0x30, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0xF0, 0x00, 0x73,
+  0x80, 0x01, 0xCE, 0x00, 0x0F, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80,
+  0x03, 0x9E, 0x00, 0x0E, 0x70, 0x00, 0x39, 0xC0, 0x01, 0xC7, 0x00, 0x07,
+  0x1C, 0x00, 0x1C, 0x70, 0x00, 0x73, 0xC0, 0x01, 0xCE, 0x00, 0x0E, 0x38,
+  0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x07, 0x8E, 0x00, 0x1C, 0x38, 0x00,
+  0xF0, 0xF0, 0x03, 0x81, 0xF0, 0x3E, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x00,
+  0x07, 0xF0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00,
+  0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x07, 0x1C, 0x00, 0x1C, 0xF0, 0x00, 0x73, 0x80, 0x01, 0xCE, 0x00, 0x0F,
+  0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x9E, 0x00, 0x0E, 0x70,
+  0x00, 0x39, 0xC0, 0x01, 0xC7, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0x70, 0x00,
+  0x73, 0xC0, 0x01, 0xCE, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3,
+  0x80, 0x07, 0x8E, 0x00, 0x1C, 0x38, 0x00, 0xF0, 0xF0, 0x03, 0x81, 0xF0,
+  0x3E, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x7E, 0x00, 0x03, 0x9C, 0x00, 0x1C, 0x30, 0x00, 0xE0, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x1C, 0x00, 0x1C, 0xF0,
+  0x00, 0x73, 0x80, 0x01, 0xCE, 0x00, 0x0F, 0x38, 0x00, 0x38, 0xE0, 0x00,
+  0xE3, 0x80, 0x03, 0x9E, 0x00, 0x0E, 0x70, 0x00, 0x39, 0xC0, 0x01, 0xC7,
+  0x00, 0x07, 0x1C, 0x00, 0x1C, 0x70, 0x00, 0x73, 0xC0, 0x01, 0xCE, 0x00,
+  0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x07, 0x8E, 0x00, 0x1C,
+  0x38, 0x00, 0xF0, 0xF0, 0x03, 0x81, 0xF0, 0x3E, 0x03, 0xFF, 0xF0, 0x07,
+  0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x38, 0x70, 0x01, 0xE3, 0xC0, 0x07,
+  0x8F, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01,
+  0xC7, 0x00, 0x07, 0x3C, 0x00, 0x1C, 0xE0, 0x00, 0x73, 0x80, 0x03, 0xCE,
+  0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE7, 0x80, 0x03, 0x9C, 0x00,
+  0x0E, 0x70, 0x00, 0x71, 0xC0, 0x01, 0xC7, 0x00, 0x07, 0x1C, 0x00, 0x1C,
+  0xF0, 0x00, 0x73, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0,
+  0x01, 0xE3, 0x80, 0x07, 0x0E, 0x00, 0x3C, 0x3C, 0x00, 0xE0, 0x7C, 0x0F,
+  0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x70, 0x00, 0xF3, 0x80, 0x0F, 0x0E,
+  0x00, 0xF0, 0x70, 0x0F, 0x03, 0xC0, 0xF0, 0x0E, 0x07, 0x80, 0x78, 0x78,
+  0x01, 0xC7, 0x80, 0x0E, 0x78, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x00, 0x0F,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70,
+  0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x1F, 0xFE, 0x03, 0xFF, 0xE0, 0x7F, 0xFE, 0x1C, 0x03, 0xE3, 0x80, 0x3C,
+  0x70, 0x03, 0x8E, 0x00, 0x71, 0xC0, 0x0E, 0x70, 0x01, 0xCE, 0x00, 0x79,
+  0xC0, 0x1E, 0x38, 0x07, 0x87, 0xFF, 0xF1, 0xFF, 0xF8, 0x3F, 0xFC, 0x07,
+  0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x1C,
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x03, 0xE0, 0xF0,
+  0x70, 0x0E, 0x1C, 0x01, 0xC3, 0x80, 0x38, 0x70, 0x3F, 0x1C, 0x1E, 0x03,
+  0x87, 0x00, 0x71, 0xC0, 0x0E, 0x38, 0x01, 0xC7, 0x00, 0x78, 0xF0, 0x0E,
+  0x1F, 0x01, 0xC1, 0xF0, 0x38, 0x1F, 0x07, 0x01, 0xF0, 0xE0, 0x0F, 0x38,
+  0x00, 0xE7, 0x00, 0x1C, 0xE0, 0x03, 0x9C, 0x00, 0xF3, 0xB0, 0x3C, 0xF7,
+  0xFF, 0x1C, 0xFF, 0xC3, 0x8F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00,
+  0x07, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x0E, 0x07,
+  0xC4, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x03, 0xFF, 0xC7, 0xFF, 0xF3,
+  0xFF, 0xF9, 0xF0, 0x0E, 0xF0, 0x03, 0xB8, 0x01, 0xEE, 0x00, 0x7B, 0x80,
+  0x3C, 0xF0, 0x3F, 0x1F, 0xFD, 0xC3, 0xFE, 0x70, 0x7E, 0x1C, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF0, 0x3F,
+  0xFE, 0x0E, 0x07, 0xC4, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x03, 0xFF,
+  0xC7, 0xFF, 0xF3, 0xFF, 0xF9, 0xF0, 0x0E, 0xF0, 0x03, 0xB8, 0x01, 0xEE,
+  0x00, 0x7B, 0x80, 0x3C, 0xF0, 0x3F, 0x1F, 0xFD, 0xC3, 0xFE, 0x70, 0x7E,
+  0x1C, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x07, 0x60, 0x03, 0x9C, 0x01, 0xC3,
+  0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+  0x7F, 0xF0, 0x3F, 0xFE, 0x0E, 0x07, 0xC4, 0x00, 0x70, 0x00, 0x1C, 0x00,
+  0x07, 0x03, 0xFF, 0xC7, 0xFF, 0xF3, 0xFF, 0xF9, 0xF0, 0x0E, 0xF0, 0x03,
+  0xB8, 0x01, 0xEE, 0x00, 0x7B, 0x80, 0x3C, 0xF0, 0x3F, 0x1F, 0xFD, 0xC3,
+  0xFE, 0x70, 0x7E, 0x1C, 0x00, 0xF0, 0xC0, 0x7E, 0x70, 0x1B, 0x98, 0x0C,
+  0x7E, 0x03, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+  0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x38, 0x1F, 0x10, 0x01, 0xC0, 0x00, 0x70,
+  0x00, 0x1C, 0x0F, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0xE7, 0xC0, 0x3B, 0xC0,
+  0x0E, 0xE0, 0x07, 0xB8, 0x01, 0xEE, 0x00, 0xF3, 0xC0, 0xFC, 0x7F, 0xF7,
+  0x0F, 0xF9, 0xC1, 0xF8, 0x70, 0x01, 0xC3, 0x80, 0xF1, 0xE0, 0x3C, 0x78,
+  0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x38, 0x1F, 0x10, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x1C, 0x0F, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0xE7, 0xC0, 0x3B,
+  0xC0, 0x0E, 0xE0, 0x07, 0xB8, 0x01, 0xEE, 0x00, 0xF3, 0xC0, 0xFC, 0x7F,
+  0xF7, 0x0F, 0xF9, 0xC1, 0xF8, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1C,
+  0x70, 0x06, 0x0C, 0x01, 0x83, 0x00, 0x60, 0xC0, 0x1C, 0x70, 0x03, 0xF8,
+  0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xFF, 0x03,
+  0xFF, 0xE0, 0xE0, 0x7C, 0x40, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x3F,
+  0xFC, 0x7F, 0xFF, 0x3F, 0xFF, 0x9F, 0x00, 0xEF, 0x00, 0x3B, 0x80, 0x1E,
+  0xE0, 0x07, 0xB8, 0x03, 0xCF, 0x03, 0xF1, 0xFF, 0xDC, 0x3F, 0xE7, 0x07,
+  0xE1, 0xC0, 0x01, 0xFC, 0x07, 0xF0, 0x07, 0xFE, 0x1F, 0xF8, 0x0F, 0xFF,
+  0x3F, 0xFC, 0x0E, 0x07, 0xF8, 0x1E, 0x10, 0x03, 0xF0, 0x0F, 0x00, 0x01,
+  0xE0, 0x07, 0x00, 0x01, 0xC0, 0x07, 0x03, 0xFF, 0x80, 0x07, 0x1F, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7C, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xE0, 0x0F, 0x80, 0x00, 0xE0, 0x1F,
+  0x80, 0x04, 0xF0, 0x39, 0xE0, 0x38, 0x7F, 0xF1, 0xFF, 0xF8, 0x7F, 0xE0,
+  0xFF, 0xF0, 0x1F, 0x80, 0x3F, 0xC0, 0x00, 0xFC, 0x01, 0xFF, 0x83, 0xFF,
+  0xE3, 0xE0, 0x73, 0xC0, 0x11, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xF0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0xC0, 0x10, 0xF0, 0x38, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x60,
+  0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x87, 0x00, 0x7F, 0x00, 0x3F,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x1F, 0x07, 0x8F, 0x00, 0xF3, 0x80, 0x1D,
+  0xE0, 0x07, 0x70, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x04, 0x78, 0x0E, 0x1F, 0xFF,
+  0x83, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x1F, 0x07, 0x8F, 0x00,
+  0xF3, 0x80, 0x1D, 0xE0, 0x07, 0x70, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x04, 0x78,
+  0x0E, 0x1F, 0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x1C, 0x00, 0x0F,
+  0x80, 0x07, 0x60, 0x03, 0x9C, 0x01, 0xC3, 0x00, 0xE0, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x1F,
+  0x07, 0x8F, 0x00, 0xF3, 0x80, 0x1D, 0xE0, 0x07, 0x70, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03,
+  0xC0, 0x04, 0x78, 0x0E, 0x1F, 0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0xC0, 0x01,
+  0xC3, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF8,
+  0x7C, 0x1E, 0x3C, 0x03, 0xCE, 0x00, 0x77, 0x80, 0x1D, 0xC0, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x0F, 0x00, 0x11, 0xE0, 0x38, 0x7F, 0xFE, 0x0F, 0xFF, 0x00, 0xFF, 0x00,
+  0x3C, 0x0E, 0x03, 0x80, 0xE0, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x03,
+  0x83, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x83,
+  0x81, 0xC0, 0xE0, 0x70, 0x38, 0x38, 0x1C, 0x00, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x03, 0x80, 0x3C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x3C, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x38, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x7C, 0x0E, 0xC1, 0xCE,
+  0x38, 0x67, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x01, 0xE0,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80,
+  0x38, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00,
+  0x38, 0x77, 0x8F, 0x78, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0E, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0xC0,
+  0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x1C, 0x01, 0xFF,
+  0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x1F, 0x3C, 0x03, 0x03, 0x80, 0x00, 0x78,
+  0x00, 0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFE, 0x0F, 0x81, 0xE3, 0xC0, 0x1C,
+  0x70, 0x03, 0x9C, 0x00, 0x73, 0x80, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x3B,
+  0x80, 0x0F, 0x70, 0x01, 0xCE, 0x00, 0x39, 0xC0, 0x0E, 0x3C, 0x03, 0xC3,
+  0xC1, 0xF0, 0x3F, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x78,
+  0x60, 0x1F, 0x9C, 0x03, 0x73, 0x00, 0xC7, 0xE0, 0x18, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0x01, 0xCF, 0xF8, 0x7F, 0xFF,
+  0x0F, 0xC1, 0xF1, 0xF0, 0x1E, 0x3C, 0x01, 0xC7, 0x00, 0x39, 0xE0, 0x07,
+  0x38, 0x01, 0xE7, 0x00, 0x38, 0xE0, 0x07, 0x1C, 0x00, 0xE7, 0x00, 0x3C,
+  0xE0, 0x07, 0x1C, 0x00, 0xE3, 0x80, 0x1C, 0x70, 0x03, 0x9C, 0x00, 0xE3,
+  0x80, 0x1C, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0,
+  0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x1F, 0x07, 0x8F, 0x00, 0xF3, 0x80,
+  0x1D, 0xC0, 0x07, 0x70, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00, 0x73, 0xC0, 0x3C, 0x78, 0x3E, 0x1F,
+  0xFF, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x1F, 0x07, 0x8F,
+  0x00, 0xF3, 0x80, 0x1D, 0xC0, 0x07, 0x70, 0x01, 0xF8, 0x00, 0x7E, 0x00,
+  0x1F, 0x80, 0x07, 0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00, 0x73, 0xC0, 0x3C,
+  0x78, 0x3E, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x1C, 0x00,
+  0x0F, 0x80, 0x07, 0x60, 0x03, 0x9C, 0x01, 0xC3, 0x00, 0xE0, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x3F, 0xFE,
+  0x1F, 0x07, 0x8F, 0x00, 0xF3, 0x80, 0x1D, 0xC0, 0x07, 0x70, 0x01, 0xF8,
+  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xB8, 0x00, 0xEE, 0x00,
+  0x73, 0xC0, 0x3C, 0x78, 0x3E, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x3F, 0x80,
+  0x00, 0xF0, 0xC0, 0x7E, 0x70, 0x1B, 0x98, 0x0C, 0x7E, 0x03, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0xFF,
+  0xF8, 0x7C, 0x1E, 0x3C, 0x03, 0xCE, 0x00, 0x77, 0x00, 0x1D, 0xC0, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0E, 0xE0, 0x03, 0xB8,
+  0x01, 0xCF, 0x00, 0xF1, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00, 0xFE,
+  0x00, 0x01, 0xC3, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0E, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xC0,
+  0xFF, 0xF8, 0x7C, 0x1E, 0x3C, 0x03, 0xCE, 0x00, 0x77, 0x00, 0x1D, 0xC0,
+  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0E, 0xE0, 0x03,
+  0xB8, 0x01, 0xCF, 0x00, 0xF1, 0xE0, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00,
+  0xFE, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0xFC, 0x70, 0x1F, 0xFB, 0x80, 0xFF, 0xFC,
+  0x07, 0xC1, 0xE0, 0x3C, 0x07, 0x81, 0xE0, 0x3F, 0x07, 0x01, 0xDC, 0x1C,
+  0x0E, 0x70, 0xE0, 0x71, 0xC3, 0x87, 0x07, 0x0E, 0x38, 0x1C, 0x39, 0xC0,
+  0xE0, 0xEE, 0x03, 0x83, 0xF0, 0x1C, 0x07, 0x80, 0xF0, 0x1E, 0x0F, 0x80,
+  0xFF, 0xFC, 0x07, 0x7F, 0xE0, 0x38, 0xFE, 0x00, 0x40, 0x00, 0x00, 0x01,
+  0xE0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1C, 0x70,
+  0x03, 0x9C, 0x00, 0xE3, 0x80, 0x1C, 0x70, 0x03, 0x8E, 0x00, 0x73, 0xC0,
+  0x0E, 0x70, 0x03, 0x8E, 0x00, 0x71, 0xC0, 0x0E, 0x78, 0x01, 0xCE, 0x00,
+  0x79, 0xC0, 0x0E, 0x38, 0x03, 0xC7, 0x80, 0xF8, 0xF8, 0x3F, 0x0F, 0xFF,
+  0xE1, 0xFF, 0x38, 0x0F, 0x87, 0x00, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x1C, 0x70, 0x03, 0x9C, 0x00, 0xE3, 0x80,
+  0x1C, 0x70, 0x03, 0x8E, 0x00, 0x73, 0xC0, 0x0E, 0x70, 0x03, 0x8E, 0x00,
+  0x71, 0xC0, 0x0E, 0x78, 0x01, 0xCE, 0x00, 0x79, 0xC0, 0x0E, 0x38, 0x03,
+  0xC7, 0x80, 0xF8, 0xF8, 0x3F, 0x0F, 0xFF, 0xE1, 0xFF, 0x38, 0x0F, 0x87,
+  0x00, 0x00, 0x1C, 0x00, 0x07, 0xC0, 0x01, 0xD8, 0x00, 0x73, 0x80, 0x1C,
+  0x30, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0x1C, 0x70, 0x03, 0x9C, 0x00, 0xE3, 0x80, 0x1C, 0x70, 0x03, 0x8E, 0x00,
+  0x73, 0xC0, 0x0E, 0x70, 0x03, 0x8E, 0x00, 0x71, 0xC0, 0x0E, 0x78, 0x01,
+  0xCE, 0x00, 0x79, 0xC0, 0x0E, 0x38, 0x03, 0xC7, 0x80, 0xF8, 0xF8, 0x3F,
+  0x0F, 0xFF, 0xE1, 0xFF, 0x38, 0x0F, 0x87, 0x00, 0x01, 0xC3, 0x80, 0x78,
+  0xF0, 0x0F, 0x1E, 0x01, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x00, 0xE3, 0x80, 0x1C, 0xE0, 0x07, 0x1C, 0x00,
+  0xE3, 0x80, 0x1C, 0x70, 0x03, 0x9E, 0x00, 0x73, 0x80, 0x1C, 0x70, 0x03,
+  0x8E, 0x00, 0x73, 0xC0, 0x0E, 0x70, 0x03, 0xCE, 0x00, 0x71, 0xC0, 0x1E,
+  0x3C, 0x07, 0xC7, 0xC1, 0xF8, 0x7F, 0xFF, 0x0F, 0xF9, 0xC0, 0x7C, 0x38,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0xF0, 0xE0, 0x03, 0x83, 0x80, 0x1C, 0x0E, 0x00,
+  0xF0, 0x1C, 0x03, 0x80, 0x70, 0x1E, 0x01, 0xC0, 0xF0, 0x07, 0x03, 0x80,
+  0x1E, 0x1E, 0x00, 0x38, 0x70, 0x00, 0xE3, 0xC0, 0x03, 0x9E, 0x00, 0x0E,
+  0x70, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xC0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x0F, 0xC0, 0x39, 0xFF, 0x01, 0xDF, 0xFC, 0x0F, 0xC1, 0xE0, 0xF8, 0x07,
+  0x87, 0x80, 0x1C, 0x3C, 0x00, 0xE1, 0xC0, 0x07, 0x0E, 0x00, 0x38, 0xF0,
+  0x01, 0xC7, 0x00, 0x1E, 0x38, 0x00, 0xE1, 0xC0, 0x07, 0x0E, 0x00, 0x70,
+  0xF8, 0x07, 0x87, 0xE0, 0xF8, 0x3B, 0xFF, 0x81, 0xCF, 0xF8, 0x0E, 0x3F,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E,
+  0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0x01,
+  0xE3, 0xC0, 0x07, 0x8F, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C, 0x38, 0x00, 0xE0,
+  0xE0, 0x07, 0x03, 0x80, 0x3C, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0x70,
+  0x3C, 0x01, 0xC0, 0xE0, 0x07, 0x87, 0x80, 0x0E, 0x1C, 0x00, 0x38, 0xF0,
+  0x00, 0xE7, 0x80, 0x03, 0x9C, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00,
+  0x7E, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x70,
+  0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
+  0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   8,  26,  14,    3,  -25 },   // 0x21 '!'
+  {    27,  10,   9,  16,    3,  -25 },   // 0x22 '"'
+  {    39,  25,  25,  29,    2,  -24 },   // 0x23 '#'
+  {   118,  19,  32,  22,    1,  -26 },   // 0x24 '$'
+  {   194,  27,  26,  33,    3,  -25 },   // 0x25 '%'
+  {   282,  24,  26,  27,    1,  -25 },   // 0x26 '&'
+  {   360,   3,   9,  10,    3,  -25 },   // 0x27 '''
+  {   364,  12,  31,  14,    3,  -26 },   // 0x28 '('
+  {   411,  12,  31,  14,   -2,  -26 },   // 0x29 ')'
+  {   458,  16,  16,  18,    1,  -25 },   // 0x2A '*'
+  {   490,  23,  23,  29,    4,  -22 },   // 0x2B '+'
+  {   557,   6,   8,  11,    0,   -3 },   // 0x2C ','
+  {   563,  10,   4,  13,    2,  -10 },   // 0x2D '-'
+  {   568,   4,   4,  11,    2,   -3 },   // 0x2E '.'
+  {   570,  17,  29,  12,   -3,  -25 },   // 0x2F '/'
+  {   632,  19,  26,  22,    2,  -25 },   // 0x30 '0'
+  {   694,  15,  26,  22,    2,  -25 },   // 0x31 '1'
+  {   743,  20,  26,  22,    0,  -25 },   // 0x32 '2'
+  {   808,  20,  26,  22,    0,  -25 },   // 0x33 '3'
+  {   873,  19,  26,  22,    1,  -25 },   // 0x34 '4'
+  {   935,  19,  26,  22,    1,  -25 },   // 0x35 '5'
+  {   997,  18,  26,  22,    2,  -25 },   // 0x36 '6'
+  {  1056,  19,  26,  22,    3,  -25 },   // 0x37 '7'
+  {  1118,  20,  26,  22,    1,  -25 },   // 0x38 '8'
+  {  1183,  18,  26,  22,    2,  -25 },   // 0x39 '9'
+  {  1242,   7,  18,  12,    2,  -17 },   // 0x3A ':'
+  {  1258,   9,  22,  12,    0,  -17 },   // 0x3B ';'
+  {  1283,  22,  19,  29,    4,  -19 },   // 0x3C '<'
+  {  1336,  22,  10,  29,    4,  -15 },   // 0x3D '='
+  {  1364,  22,  19,  29,    4,  -19 },   // 0x3E '>'
+  {  1417,  14,  26,  19,    4,  -25 },   // 0x3F '?'
+  {  1463,  31,  31,  35,    2,  -24 },   // 0x40 '@'
+  {  1584,  23,  26,  24,   -2,  -25 },   // 0x41 'A'
+  {  1659,  21,  26,  24,    1,  -25 },   // 0x42 'B'
+  {  1728,  23,  26,  24,    1,  -25 },   // 0x43 'C'
+  {  1803,  24,  26,  27,    1,  -25 },   // 0x44 'D'
+  {  1881,  21,  26,  22,    1,  -25 },   // 0x45 'E'
+  {  1950,  20,  26,  20,    1,  -25 },   // 0x46 'F'
+  {  2015,  24,  26,  27,    1,  -25 },   // 0x47 'G'
+  {  2093,  24,  26,  26,    1,  -25 },   // 0x48 'H'
+  {  2171,   8,  26,  10,    1,  -25 },   // 0x49 'I'
+  {  2197,  15,  33,  10,   -6,  -25 },   // 0x4A 'J'
+  {  2259,  24,  26,  23,    1,  -25 },   // 0x4B 'K'
+  {  2337,  16,  26,  20,    1,  -25 },   // 0x4C 'L'
+  {  2389,  28,  26,  30,    1,  -25 },   // 0x4D 'M'
+  {  2480,  24,  26,  26,    1,  -25 },   // 0x4E 'N'
+  {  2558,  25,  26,  28,    1,  -25 },   // 0x4F 'O'
+  {  2640,  20,  26,  21,    1,  -25 },   // 0x50 'P'
+  {  2705,  25,  31,  28,    1,  -25 },   // 0x51 'Q'
+  {  2802,  20,  26,  24,    1,  -25 },   // 0x52 'R'
+  {  2867,  20,  26,  22,    1,  -25 },   // 0x53 'S'
+  {  2932,  21,  26,  21,    1,  -25 },   // 0x54 'T'
+  {  3001,  22,  26,  26,    2,  -25 },   // 0x55 'U'
+  {  3073,  23,  26,  24,    3,  -25 },   // 0x56 'V'
+  {  3148,  32,  26,  35,    3,  -25 },   // 0x57 'W'
+  {  3252,  26,  26,  24,   -2,  -25 },   // 0x58 'X'
+  {  3337,  21,  26,  21,    2,  -25 },   // 0x59 'Y'
+  {  3406,  25,  26,  24,   -1,  -25 },   // 0x5A 'Z'
+  {  3488,  13,  31,  14,    1,  -26 },   // 0x5B '['
+  {  3539,   6,  29,  12,    3,  -25 },   // 0x5C '\'
+  {  3561,  13,  31,  14,   -1,  -26 },   // 0x5D ']'
+  {  3612,  22,  10,  29,    4,  -25 },   // 0x5E '^'
+  {  3640,  18,   3,  18,    0,    6 },   // 0x5F '_'
+  {  3647,   7,   6,  18,    7,  -27 },   // 0x60 '`'
+  {  3653,  18,  19,  21,    2,  -18 },   // 0x61 'a'
+  {  3696,  19,  27,  22,    1,  -26 },   // 0x62 'b'
+  {  3761,  17,  19,  19,    2,  -18 },   // 0x63 'c'
+  {  3802,  21,  27,  22,    2,  -26 },   // 0x64 'd'
+  {  3873,  18,  19,  22,    2,  -18 },   // 0x65 'e'
+  {  3916,  14,  27,  12,    2,  -26 },   // 0x66 'f'
+  {  3964,  19,  26,  22,    2,  -18 },   // 0x67 'g'
+  {  4026,  19,  27,  22,    1,  -26 },   // 0x68 'h'
+  {  4091,   8,  27,  10,    1,  -26 },   // 0x69 'i'
+  {  4118,  13,  34,  10,   -4,  -26 },   // 0x6A 'j'
+  {  4174,  20,  27,  20,    1,  -26 },   // 0x6B 'k'
+  {  4242,   8,  27,  10,    1,  -26 },   // 0x6C 'l'
+  {  4269,  30,  19,  34,    1,  -18 },   // 0x6D 'm'
+  {  4341,  19,  19,  22,    1,  -18 },   // 0x6E 'n'
+  {  4387,  18,  19,  21,    2,  -18 },   // 0x6F 'o'
+  {  4430,  21,  26,  22,    0,  -18 },   // 0x70 'p'
+  {  4499,  19,  26,  22,    2,  -18 },   // 0x71 'q'
+  {  4561,  15,  19,  14,    1,  -18 },   // 0x72 'r'
+  {  4597,  17,  19,  18,    0,  -18 },   // 0x73 's'
+  {  4638,  12,  24,  14,    3,  -23 },   // 0x74 't'
+  {  4674,  19,  19,  22,    2,  -18 },   // 0x75 'u'
+  {  4720,  19,  19,  21,    3,  -18 },   // 0x76 'v'
+  {  4766,  26,  19,  29,    3,  -18 },   // 0x77 'w'
+  {  4828,  22,  19,  21,   -1,  -18 },   // 0x78 'x'
+  {  4881,  22,  26,  21,   -1,  -18 },   // 0x79 'y'
+  {  4953,  19,  19,  18,    0,  -18 },   // 0x7A 'z'
+  {  4999,  18,  32,  22,    4,  -26 },   // 0x7B '{'
+  {  5071,   3,  35,  12,    4,  -26 },   // 0x7C '|'
+  {  5085,  17,  32,  22,    0,  -26 },   // 0x7D '}'
+  {  5153,  22,   6,  29,    4,  -13 },   // 0x7E '~'
+  {  5170,  18,  31,  21,    2,  -24 },   // 0x7F
+  {  5240,  18,  31,  21,    2,  -24 },   // 0x80
+  {  5310,  18,  31,  21,    2,  -24 },   // 0x81
+  {  5380,  18,  31,  21,    2,  -24 },   // 0x82
+  {  5450,  18,  31,  21,    2,  -24 },   // 0x83
+  {  5520,  18,  31,  21,    2,  -24 },   // 0x84
+  {  5590,  18,  31,  21,    2,  -24 },   // 0x85
+  {  5660,  18,  31,  21,    2,  -24 },   // 0x86
+  {  5730,  18,  31,  21,    2,  -24 },   // 0x87
+  {  5800,  18,  31,  21,    2,  -24 },   // 0x88
+  {  5870,  18,  31,  21,    2,  -24 },   // 0x89
+  {  5940,  18,  31,  21,    2,  -24 },   // 0x8A
+  {  6010,  18,  31,  21,    2,  -24 },   // 0x8B
+  {  6080,  18,  31,  21,    2,  -24 },   // 0x8C
+  {  6150,  18,  31,  21,    2,  -24 },   // 0x8D
+  {  6220,  18,  31,  21,    2,  -24 },   // 0x8E
+  {  6290,  18,  31,  21,    2,  -24 },   // 0x8F
+  {  6360,  18,  31,  21,    2,  -24 },   // 0x90
+  {  6430,  18,  31,  21,    2,  -24 },   // 0x91
+  {  6500,  18,  31,  21,    2,  -24 },   // 0x92
+  {  6570,  18,  31,  21,    2,  -24 },   // 0x93
+  {  6640,  18,  31,  21,    2,  -24 },   // 0x94
+  {  6710,  18,  31,  21,    2,  -24 },   // 0x95
+  {  6780,  18,  31,  21,    2,  -24 },   // 0x96
+  {  6850,  18,  31,  21,    2,  -24 },   // 0x97
+  {  6920,  18,  31,  21,    2,  -24 },   // 0x98
+  {  6990,  18,  31,  21,    2,  -24 },   // 0x99
+  {  7060,  18,  31,  21,    2,  -24 },   // 0x9A
+  {  7130,  18,  31,  21,    2,  -24 },   // 0x9B
+  {  7200,  18,  31,  21,    2,  -24 },   // 0x9C
+  {  7270,  18,  31,  21,    2,  -24 },   // 0x9D
+  {  7340,  18,  31,  21,    2,  -24 },   // 0x9E
+  {  7410,  18,  31,  21,    2,  -24 },   // 0x9F
+  {  7480,   1,   1,  11,    0,    0 },   // 0xA0
+  {  7481,   8,  26,  14,    3,  -18 },   // 0xA1
+  {  7507,  17,  29,  22,    3,  -23 },   // 0xA2
+  {  7569,  22,  26,  22,    1,  -25 },   // 0xA3
+  {  7641,  19,  19,  22,    2,  -19 },   // 0xA4
+  {  7687,  21,  26,  22,    2,  -25 },   // 0xA5
+  {  7756,   3,  31,  12,    4,  -24 },   // 0xA6
+  {  7768,  17,  29,  18,    0,  -25 },   // 0xA7
+  {  7830,  11,   4,  18,    6,  -26 },   // 0xA8
+  {  7836,  25,  25,  35,    5,  -24 },   // 0xA9
+  {  7915,  14,  18,  16,    1,  -25 },   // 0xAA
+  {  7947,  18,  16,  22,    2,  -17 },   // 0xAB
+  {  7983,  22,  10,  29,    4,  -14 },   // 0xAC
+  {  8011,  10,   4,  13,    2,  -10 },   // 0xAD
+  {  8016,  25,  25,  35,    5,  -24 },   // 0xAE
+  {  8095,  11,   3,  18,    7,  -25 },   // 0xAF
+  {  8100,  11,  11,  18,    3,  -25 },   // 0xB0
+  {  8116,  23,  22,  29,    3,  -21 },   // 0xB1
+  {  8180,  12,  14,  14,    1,  -25 },   // 0xB2
+  {  8201,  12,  14,  14,    1,  -25 },   // 0xB3
+  {  8222,   9,   6,  18,    9,  -27 },   // 0xB4
+  {  8229,  21,  26,  22,    0,  -18 },   // 0xB5
+  {  8298,  17,  29,  22,    3,  -25 },   // 0xB6
+  {  8360,   4,   4,  11,    4,  -13 },   // 0xB7
+  {  8362,   8,   7,  18,    1,    1 },   // 0xB8
+  {  8369,   9,  14,  14,    2,  -25 },   // 0xB9
+  {  8385,  15,  18,  16,    2,  -25 },   // 0xBA
+  {  8419,  18,  16,  22,    2,  -17 },   // 0xBB
+  {  8455,  32,  26,  34,    2,  -25 },   // 0xBC
+  {  8559,  31,  26,  34,    2,  -25 },   // 0xBD
+  {  8660,  33,  26,  34,    1,  -25 },   // 0xBE
+  {  8768,  14,  26,  19,    1,  -18 },   // 0xBF
+  {  8814,  23,  33,  24,   -2,  -32 },   // 0xC0
+  {  8909,  23,  33,  24,   -2,  -32 },   // 0xC1
+  {  9004,  23,  33,  24,   -2,  -32 },   // 0xC2
+  {  9099,  23,  32,  24,   -2,  -31 },   // 0xC3
+  {  9191,  23,  32,  24,   -2,  -31 },   // 0xC4
+  {  9283,  23,  32,  24,   -2,  -31 },   // 0xC5
+  {  9375,  36,  26,  34,   -2,  -25 },   // 0xC6
+  {  9492,  23,  33,  24,    1,  -25 },   // 0xC7
+  {  9587,  21,  33,  22,    1,  -32 },   // 0xC8
+  {  9674,  21,  33,  22,    1,  -32 },   // 0xC9
+  {  9761,  21,  33,  22,    1,  -32 },   // 0xCA
+  {  9848,  21,  32,  22,    1,  -31 },   // 0xCB
+  {  9932,   9,  33,  10,    1,  -32 },   // 0xCC
+  {  9970,  12,  33,  10,    1,  -32 },   // 0xCD
+  { 10020,  12,  33,  10,    1,  -32 },   // 0xCE
+  { 10070,  13,  32,  10,    1,  -31 },   // 0xCF
+  { 10122,  25,  26,  27,    0,  -25 },   // 0xD0
+  { 10204,  24,  32,  26,    1,  -31 },   // 0xD1
+  { 10300,  25,  33,  28,    1,  -32 },   // 0xD2
+  { 10404,  25,  33,  28,    1,  -32 },   // 0xD3
+  { 10508,  25,  33,  28,    1,  -32 },   // 0xD4
+  { 10612,  25,  32,  28,    1,  -31 },   // 0xD5
+  { 10712,  25,  32,  28,    1,  -31 },   // 0xD6
+  { 10812,  20,  20,  29,    5,  -20 },   // 0xD7
+  { 10862,  29,  28,  28,   -1,  -26 },   // 0xD8
+  { 10964,  22,  33,  26,    2,  -32 },   // 0xD9
+  { 11055,  22,  33,  26,    2,  -32 },   // 0xDA
+  { 11146,  22,  33,  26,    2,  -32 },   // 0xDB
+  { 11237,  22,  32,  26,    2,  -31 },   // 0xDC
+  { 11325,  21,  33,  21,    2,  -32 },   // 0xDD
+  { 11412,  19,  26,  21,    1,  -25 },   // 0xDE
+  { 11474,  19,  27,  22,    2,  -26 },   // 0xDF
+  { 11539,  18,  28,  21,    2,  -27 },   // 0xE0
+  { 11602,  18,  28,  21,    2,  -27 },   // 0xE1
+  { 11665,  18,  28,  21,    2,  -27 },   // 0xE2
+  { 11728,  18,  27,  21,    2,  -26 },   // 0xE3
+  { 11789,  18,  27,  21,    2,  -26 },   // 0xE4
+  { 11850,  18,  30,  21,    2,  -29 },   // 0xE5
+  { 11918,  32,  19,  35,    2,  -18 },   // 0xE6
+  { 11994,  17,  26,  19,    2,  -18 },   // 0xE7
+  { 12050,  18,  28,  22,    2,  -27 },   // 0xE8
+  { 12113,  18,  28,  22,    2,  -27 },   // 0xE9
+  { 12176,  18,  28,  22,    2,  -27 },   // 0xEA
+  { 12239,  18,  27,  22,    2,  -26 },   // 0xEB
+  { 12300,   9,  28,  10,    1,  -27 },   // 0xEC
+  { 12332,  13,  28,  10,    1,  -27 },   // 0xED
+  { 12378,  12,  28,  10,    1,  -27 },   // 0xEE
+  { 12420,  12,  27,  10,    1,  -26 },   // 0xEF
+  { 12461,  19,  27,  21,    2,  -26 },   // 0xF0
+  { 12526,  19,  27,  22,    1,  -26 },   // 0xF1
+  { 12591,  18,  28,  21,    2,  -27 },   // 0xF2
+  { 12654,  18,  28,  21,    2,  -27 },   // 0xF3
+  { 12717,  18,  28,  21,    2,  -27 },   // 0xF4
+  { 12780,  18,  27,  21,    2,  -26 },   // 0xF5
+  { 12841,  18,  27,  21,    2,  -26 },   // 0xF6
+  { 12902,  22,  17,  29,    4,  -19 },   // 0xF7
+  { 12949,  22,  21,  21,    0,  -19 },   // 0xF8
+  { 13007,  19,  28,  22,    2,  -27 },   // 0xF9
+  { 13074,  19,  28,  22,    2,  -27 },   // 0xFA
+  { 13141,  19,  28,  22,    2,  -27 },   // 0xFB
+  { 13208,  19,  27,  22,    2,  -26 },   // 0xFC
+  { 13273,  22,  35,  21,   -1,  -27 },   // 0xFD
+  { 13370,  21,  34,  22,    0,  -26 },   // 0xFE
+  { 13460,  22,  34,  21,   -1,  -26 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique18pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique18pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique18pt8bGlyphs,
+  0x20, 0xFF, 41 };
+
+// Approx. 15129 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique18pt8bMetrics[] PROGMEM = {
+  {   0,  11,   1 },   // 0x20
+  {   3,  14,  11 },   // 0x21
+  {   3,  16,  13 },   // 0x22
+  {   2,  29,  27 },   // 0x23
+  {   1,  22,  20 },   // 0x24
+  {   3,  33,  30 },   // 0x25
+  {   1,  27,  25 },   // 0x26
+  {   3,  10,   6 },   // 0x27
+  {   3,  14,  15 },   // 0x28
+  {  -2,  14,  10 },   // 0x29
+  {   1,  18,  17 },   // 0x2A
+  {   4,  29,  27 },   // 0x2B
+  {   0,  11,   6 },   // 0x2C
+  {   2,  13,  12 },   // 0x2D
+  {   2,  11,   6 },   // 0x2E
+  {  -3,  12,  14 },   // 0x2F
+  {   2,  22,  21 },   // 0x30
+  {   2,  22,  17 },   // 0x31
+  {   0,  22,  20 },   // 0x32
+  {   0,  22,  20 },   // 0x33
+  {   1,  22,  20 },   // 0x34
+  {   1,  22,  20 },   // 0x35
+  {   2,  22,  20 },   // 0x36
+  {   3,  22,  22 },   // 0x37
+  {   1,  22,  21 },   // 0x38
+  {   2,  22,  20 },   // 0x39
+  {   2,  12,   9 },   // 0x3A
+  {   0,  12,   9 },   // 0x3B
+  {   4,  29,  26 },   // 0x3C
+  {   4,  29,  26 },   // 0x3D
+  {   4,  29,  26 },   // 0x3E
+  {   4,  19,  18 },   // 0x3F
+  {   2,  35,  33 },   // 0x40
+  {  -2,  24,  21 },   // 0x41
+  {   1,  24,  22 },   // 0x42
+  {   1,  24,  24 },   // 0x43
+  {   1,  27,  25 },   // 0x44
+  {   1,  22,  22 },   // 0x45
+  {   1,  20,  21 },   // 0x46
+  {   1,  27,  25 },   // 0x47
+  {   1,  26,  25 },   // 0x48
+  {   1,  10,   9 },   // 0x49
+  {  -6,  10,   9 },   // 0x4A
+  {   1,  23,  25 },   // 0x4B
+  {   1,  20,  17 },   // 0x4C
+  {   1,  30,  29 },   // 0x4D
+  {   1,  26,  25 },   // 0x4E
+  {   1,  28,  26 },   // 0x4F
+  {   1,  21,  21 },   // 0x50
+  {   1,  28,  26 },   // 0x51
+  {   1,  24,  21 },   // 0x52
+  {   1,  22,  21 },   // 0x53
+  {   1,  21,  22 },   // 0x54
+  {   2,  26,  24 },   // 0x55
+  {   3,  24,  26 },   // 0x56
+  {   3,  35,  35 },   // 0x57
+  {  -2,  24,  24 },   // 0x58
+  {   2,  21,  23 },   // 0x59
+  {  -1,  24,  24 },   // 0x5A
+  {   1,  14,  14 },   // 0x5B
+  {   3,  12,   9 },   // 0x5C
+  {  -1,  14,  12 },   // 0x5D
+  {   4,  29,  26 },   // 0x5E
+  {   0,  18,  18 },   // 0x5F
+  {   7,  18,  14 },   // 0x60
+  {   2,  21,  20 },   // 0x61
+  {   1,  22,  20 },   // 0x62
+  {   2,  19,  19 },   // 0x63
+  {   2,  22,  23 },   // 0x64
+  {   2,  22,  20 },   // 0x65
+  {   2,  12,  16 },   // 0x66
+  {   2,  22,  21 },   // 0x67
+  {   1,  22,  20 },   // 0x68
+  {   1,  10,   9 },   // 0x69
+  {  -4,  10,   9 },   // 0x6A
+  {   1,  20,  21 },   // 0x6B
+  {   1,  10,   9 },   // 0x6C
+  {   1,  34,  31 },   // 0x6D
+  {   1,  22,  20 },   // 0x6E
+  {   2,  21,  20 },   // 0x6F
+  {   0,  22,  21 },   // 0x70
+  {   2,  22,  21 },   // 0x71
+  {   1,  14,  16 },   // 0x72
+  {   0,  18,  17 },   // 0x73
+  {   3,  14,  15 },   // 0x74
+  {   2,  22,  21 },   // 0x75
+  {   3,  21,  22 },   // 0x76
+  {   3,  29,  29 },   // 0x77
+  {  -1,  21,  21 },   // 0x78
+  {  -1,  21,  21 },   // 0x79
+  {   0,  18,  19 },   // 0x7A
+  {   4,  22,  22 },   // 0x7B
+  {   4,  12,   7 },   // 0x7C
+  {   0,  22,  17 },   // 0x7D
+  {   4,  29,  26 },   // 0x7E
+  {   2,  21,  20 },   // 0x7F
+  {   2,  21,  20 },   // 0x80
+  {   2,  21,  20 },   // 0x81
+  {   2,  21,  20 },   // 0x82
+  {   2,  21,  20 },   // 0x83
+  {   2,  21,  20 },   // 0x84
+  {   2,  21,  20 },   // 0x85
+  {   2,  21,  20 },   // 0x86
+  {   2,  21,  20 },   // 0x87
+  {   2,  21,  20 },   // 0x88
+  {   2,  21,  20 },   // 0x89
+  {   2,  21,  20 },   // 0x8A
+  {   2,  21,  20 },   // 0x8B
+  {   2,  21,  20 },   // 0x8C
+  {   2,  21,  20 },   // 0x8D
+  {   2,  21,  20 },   // 0x8E
+  {   2,  21,  20 },   // 0x8F
+  {   2,  21,  20 },   // 0x90
+  {   2,  21,  20 },   // 0x91
+  {   2,  21,  20 },   // 0x92
+  {   2,  21,  20 },   // 0x93
+  {   2,  21,  20 },   // 0x94
+  {   2,  21,  20 },   // 0x95
+  {   2,  21,  20 },   // 0x96
+  {   2,  21,  20 },   // 0x97
+  {   2,  21,  20 },   // 0x98
+  {   2,  21,  20 },   // 0x99
+  {   2,  21,  20 },   // 0x9A
+  {   2,  21,  20 },   // 0x9B
+  {   2,  21,  20 },   // 0x9C
+  {   2,  21,  20 },   // 0x9D
+  {   2,  21,  20 },   // 0x9E
+  {   2,  21,  20 },   // 0x9F
+  {   0,  11,   1 },   // 0xA0
+  {   3,  14,  11 },   // 0xA1
+  {   3,  22,  20 },   // 0xA2
+  {   1,  22,  23 },   // 0xA3
+  {   2,  22,  21 },   // 0xA4
+  {   2,  22,  23 },   // 0xA5
+  {   4,  12,   7 },   // 0xA6
+  {   0,  18,  17 },   // 0xA7
+  {   6,  18,  17 },   // 0xA8
+  {   5,  35,  30 },   // 0xA9
+  {   1,  16,  15 },   // 0xAA
+  {   2,  22,  20 },   // 0xAB
+  {   4,  29,  26 },   // 0xAC
+  {   2,  13,  12 },   // 0xAD
+  {   5,  35,  30 },   // 0xAE
+  {   7,  18,  18 },   // 0xAF
+  {   3,  18,  14 },   // 0xB0
+  {   3,  29,  26 },   // 0xB1
+  {   1,  14,  13 },   // 0xB2
+  {   1,  14,  13 },   // 0xB3
+  {   9,  18,  18 },   // 0xB4
+  {   0,  22,  21 },   // 0xB5
+  {   3,  22,  20 },   // 0xB6
+  {   4,  11,   8 },   // 0xB7
+  {   1,  18,   9 },   // 0xB8
+  {   2,  14,  11 },   // 0xB9
+  {   2,  16,  17 },   // 0xBA
+  {   2,  22,  20 },   // 0xBB
+  {   2,  34,  34 },   // 0xBC
+  {   2,  34,  33 },   // 0xBD
+  {   1,  34,  34 },   // 0xBE
+  {   1,  19,  15 },   // 0xBF
+  {  -2,  24,  21 },   // 0xC0
+  {  -2,  24,  21 },   // 0xC1
+  {  -2,  24,  21 },   // 0xC2
+  {  -2,  24,  21 },   // 0xC3
+  {  -2,  24,  21 },   // 0xC4
+  {  -2,  24,  21 },   // 0xC5
+  {  -2,  34,  34 },   // 0xC6
+  {   1,  24,  24 },   // 0xC7
+  {   1,  22,  22 },   // 0xC8
+  {   1,  22,  22 },   // 0xC9
+  {   1,  22,  22 },   // 0xCA
+  {   1,  22,  22 },   // 0xCB
+  {   1,  10,  10 },   // 0xCC
+  {   1,  10,  13 },   // 0xCD
+  {   1,  10,  13 },   // 0xCE
+  {   1,  10,  14 },   // 0xCF
+  {   0,  27,  25 },   // 0xD0
+  {   1,  26,  25 },   // 0xD1
+  {   1,  28,  26 },   // 0xD2
+  {   1,  28,  26 },   // 0xD3
+  {   1,  28,  26 },   // 0xD4
+  {   1,  28,  26 },   // 0xD5
+  {   1,  28,  26 },   // 0xD6
+  {   5,  29,  25 },   // 0xD7
+  {  -1,  28,  28 },   // 0xD8
+  {   2,  26,  24 },   // 0xD9
+  {   2,  26,  24 },   // 0xDA
+  {   2,  26,  24 },   // 0xDB
+  {   2,  26,  24 },   // 0xDC
+  {   2,  21,  23 },   // 0xDD
+  {   1,  21,  20 },   // 0xDE
+  {   2,  22,  21 },   // 0xDF
+  {   2,  21,  20 },   // 0xE0
+  {   2,  21,  20 },   // 0xE1
+  {   2,  21,  20 },   // 0xE2
+  {   2,  21,  20 },   // 0xE3
+  {   2,  21,  20 },   // 0xE4
+  {   2,  21,  20 },   // 0xE5
+  {   2,  35,  34 },   // 0xE6
+  {   2,  19,  19 },   // 0xE7
+  {   2,  22,  20 },   // 0xE8
+  {   2,  22,  20 },   // 0xE9
+  {   2,  22,  20 },   // 0xEA
+  {   2,  22,  20 },   // 0xEB
+  {   1,  10,  10 },   // 0xEC
+  {   1,  10,  14 },   // 0xED
+  {   1,  10,  13 },   // 0xEE
+  {   1,  10,  13 },   // 0xEF
+  {   2,  21,  21 },   // 0xF0
+  {   1,  22,  20 },   // 0xF1
+  {   2,  21,  20 },   // 0xF2
+  {   2,  21,  20 },   // 0xF3
+  {   2,  21,  20 },   // 0xF4
+  {   2,  21,  20 },   // 0xF5
+  {   2,  21,  20 },   // 0xF6
+  {   4,  29,  26 },   // 0xF7
+  {   0,  21,  22 },   // 0xF8
+  {   2,  22,  21 },   // 0xF9
+  {   2,  22,  21 },   // 0xFA
+  {   2,  22,  21 },   // 0xFB
+  {   2,  22,  21 },   // 0xFC
+  {  -1,  21,  21 },   // 0xFD
+  {   0,  22,  21 },   // 0xFE
+  {  -1,  21,  21 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique18pt8bWidths = { DejaVuSans_Oblique18pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE18PTLAT1__H
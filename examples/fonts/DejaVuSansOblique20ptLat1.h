@@ -0,0 +1,1867 @@
+#ifndef DEJAVUSANSOBLIQUE20PTLAT1__H
+#define DEJAVUSANSOBLIQUE20PTLAT1__H
+const uint8_t DejaVuSans_Oblique20pt8bBitmaps[] PROGMEM = {
+  0x00, 0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
+  0x83, 0xE0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x38, 0x1E, 0x07, 0x81,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x3E, 0x0F, 0x03, 0xC0,
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8,
+  0x7E, 0x1C, 0x00, 0x1C, 0x1E, 0x00, 0x03, 0x83, 0x80, 0x00, 0xF0, 0x70,
+  0x00, 0x1C, 0x0E, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x70, 0x70, 0x00, 0x0E,
+  0x0E, 0x00, 0x03, 0x81, 0xC0, 0x1F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x38, 0x00, 0x0E, 0x07, 0x00, 0x01, 0xC1,
+  0xC0, 0x00, 0x38, 0x38, 0x00, 0x0E, 0x07, 0x00, 0x01, 0xC0, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x38, 0x1C,
+  0x00, 0x07, 0x07, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x38, 0x1C, 0x00, 0x07,
+  0x03, 0x80, 0x00, 0xE0, 0xE0, 0x00, 0x1C, 0x1C, 0x00, 0x07, 0x03, 0x80,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00,
+  0x03, 0xFE, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xE1, 0xF9, 0x83, 0x0F, 0x0C,
+  0x00, 0xF0, 0x60, 0x07, 0x86, 0x00, 0x3C, 0x30, 0x01, 0xF1, 0x80, 0x0F,
+  0xEC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+  0x00, 0x0C, 0x7C, 0x00, 0x61, 0xE0, 0x02, 0x0F, 0x00, 0x30, 0x78, 0x01,
+  0x83, 0xC8, 0x0C, 0x3C, 0x60, 0x61, 0xE3, 0xE3, 0x3E, 0x3F, 0xFF, 0xE0,
+  0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00,
+  0x70, 0x7F, 0xC0, 0x03, 0x83, 0xC3, 0x80, 0x1E, 0x1E, 0x0F, 0x00, 0x70,
+  0x70, 0x1C, 0x03, 0x83, 0xC0, 0x70, 0x1C, 0x0E, 0x01, 0xC0, 0xE0, 0x38,
+  0x07, 0x07, 0x00, 0xE0, 0x1C, 0x1C, 0x03, 0x80, 0xE0, 0xE0, 0x0E, 0x03,
+  0x87, 0x00, 0x38, 0x1E, 0x38, 0x00, 0x70, 0xF1, 0xC0, 0x00, 0xFF, 0x87,
+  0x00, 0x01, 0xF8, 0x38, 0x7E, 0x00, 0x01, 0xC7, 0xFC, 0x00, 0x0E, 0x3C,
+  0x38, 0x00, 0x71, 0xE0, 0xF0, 0x03, 0xC7, 0x01, 0xC0, 0x0E, 0x3C, 0x07,
+  0x00, 0x70, 0xE0, 0x1C, 0x03, 0x83, 0x80, 0x70, 0x1C, 0x0E, 0x01, 0xC0,
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x1C, 0x03, 0x81, 0xC0, 0xE0,
+  0x07, 0x0F, 0x07, 0x00, 0x0F, 0xF8, 0x38, 0x00, 0x1F, 0x80, 0x00, 0x0F,
+  0xC0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7C, 0x1C, 0x00,
+  0x1E, 0x01, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
+  0x78, 0xF1, 0xF0, 0x0E, 0x3C, 0x3F, 0x03, 0xCF, 0x03, 0xE0, 0x79, 0xE0,
+  0x3E, 0x1E, 0x78, 0x03, 0xE3, 0x8F, 0x00, 0x3E, 0xF1, 0xE0, 0x07, 0xFC,
+  0x3C, 0x00, 0x7F, 0x07, 0xC0, 0x07, 0xC0, 0x78, 0x01, 0xFC, 0x0F, 0xC0,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xCF, 0x80, 0x7F, 0xC0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x00, 0x3C, 0x01, 0xE0,
+  0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x03, 0xE0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x80, 0x0E,
+  0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x0F,
+  0x00, 0x3C, 0x00, 0x70, 0x01, 0xE0, 0x07, 0x80, 0x0E, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x0F, 0x00,
+  0x78, 0x01, 0xE0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x41, 0x82, 0xE1, 0x87, 0x79, 0x9E, 0x3D, 0xBC, 0x0F,
+  0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0xF0, 0x3D, 0xBC, 0x79, 0x9E, 0xE1,
+  0x87, 0x41, 0x82, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x1C, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x1C, 0x00, 0x00, 0x0F, 0x0F, 0x1E, 0x1E, 0x3C, 0x38, 0x78, 0x70,
+  0x60, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7B, 0xFF, 0xEF, 0x00, 0x00,
+  0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00,
+  0x0F, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00,
+  0x70, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x07,
+  0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38,
+  0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0xC0,
+  0x00, 0x70, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x1C, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xF8, 0x0F,
+  0xC3, 0xE0, 0x78, 0x0F, 0x07, 0x80, 0x78, 0x78, 0x01, 0xE3, 0xC0, 0x0F,
+  0x3C, 0x00, 0x79, 0xE0, 0x03, 0xDF, 0x00, 0x1E, 0xF0, 0x00, 0xF7, 0x80,
+  0x07, 0xBC, 0x00, 0x3F, 0xE0, 0x01, 0xFE, 0x00, 0x1E, 0xF0, 0x00, 0xF7,
+  0x80, 0x07, 0xBC, 0x00, 0x7D, 0xE0, 0x03, 0xCF, 0x00, 0x1E, 0x78, 0x01,
+  0xE3, 0xC0, 0x0F, 0x0F, 0x00, 0xF0, 0x78, 0x0F, 0x83, 0xE0, 0xF8, 0x0F,
+  0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF,
+  0x03, 0xFF, 0x81, 0xE3, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01,
+  0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x03,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x3E, 0x07, 0xC0, 0x70, 0x07, 0x80, 0x80,
+  0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F,
+  0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00,
+  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03,
+  0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF,
+  0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xC0, 0x3F, 0xFF, 0x81, 0xC0, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F,
+  0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF8, 0x40, 0x07, 0xC3, 0xC0, 0x7E, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+  0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
+  0x00, 0x0F, 0xE0, 0x00, 0xEF, 0x00, 0x0F, 0x78, 0x00, 0xF3, 0xC0, 0x0F,
+  0x3C, 0x00, 0x71, 0xE0, 0x07, 0x0F, 0x00, 0x70, 0x78, 0x07, 0x07, 0x80,
+  0x70, 0x3C, 0x07, 0x81, 0xE0, 0x78, 0x0F, 0x07, 0x80, 0x78, 0x38, 0x07,
+  0x83, 0x80, 0x3C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0,
+  0x3F, 0xFF, 0x80, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8,
+  0x03, 0xFF, 0xF0, 0x0C, 0x07, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x10, 0x01, 0xF0,
+  0xF0, 0x1F, 0x83, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00,
+  0x1F, 0xE0, 0x07, 0xFF, 0x01, 0xFF, 0xF0, 0x3E, 0x07, 0x07, 0x80, 0x10,
+  0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x38, 0x7E, 0x07, 0xBF, 0xF0, 0x7F, 0xFF, 0x87, 0xF0, 0x7C, 0xFE, 0x03,
+  0xEF, 0xC0, 0x1E, 0xF8, 0x01, 0xEF, 0x80, 0x1E, 0xF0, 0x01, 0xEF, 0x00,
+  0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x3C, 0xF0, 0x03, 0xCF, 0x80, 0x78, 0x78,
+  0x0F, 0x87, 0xC1, 0xF0, 0x3F, 0xFE, 0x01, 0xFF, 0xC0, 0x07, 0xE0, 0x00,
+  0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x03, 0xE0, 0x00,
+  0x3E, 0x00, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00,
+  0x03, 0xC0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x01, 0xF0,
+  0x3E, 0x0F, 0x80, 0x7C, 0x7C, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F,
+  0x1E, 0x00, 0x3C, 0x78, 0x01, 0xE0, 0xF0, 0x0F, 0x03, 0xE0, 0x78, 0x03,
+  0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xF8, 0x07, 0xC1, 0xF0, 0x3C, 0x01,
+  0xE1, 0xE0, 0x07, 0xC7, 0x80, 0x0F, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0xF3,
+  0xC0, 0x03, 0xCF, 0x00, 0x1F, 0x3C, 0x00, 0x78, 0x78, 0x03, 0xE1, 0xF8,
+  0x3F, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x3F,
+  0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xF8, 0x0F, 0x83, 0xE0, 0xF8, 0x0F, 0x07,
+  0x80, 0x78, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x3C, 0x00, 0x79, 0xE0, 0x03,
+  0xCF, 0x00, 0x1E, 0x78, 0x01, 0xF3, 0xC0, 0x0F, 0x9E, 0x00, 0xFC, 0xF8,
+  0x0F, 0xC3, 0xE0, 0xFE, 0x1F, 0xFF, 0xF0, 0x7F, 0xE7, 0x80, 0xFC, 0x38,
+  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00,
+  0xF0, 0x40, 0x0F, 0x03, 0x81, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0xE0, 0x03,
+  0xFC, 0x00, 0x00, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0xF8, 0xF0, 0xF0, 0x01,
+  0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x03, 0xC0,
+  0x78, 0x1E, 0x03, 0x80, 0xF0, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
+  0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFE,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
+  0x80, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0F,
+  0xF0, 0x7F, 0xF1, 0xFF, 0xF7, 0xC3, 0xFC, 0x01, 0xF0, 0x03, 0xC0, 0x07,
+  0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
+  0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0,
+  0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x03,
+  0xE0, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x00,
+  0x0F, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x00,
+  0xE0, 0x3C, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x01, 0xC3, 0xC0, 0x1F,
+  0x1C, 0x1C, 0xF0, 0x0F, 0xF3, 0x83, 0x9C, 0x07, 0xFF, 0x60, 0x77, 0x81,
+  0xF0, 0x7C, 0x0E, 0xE0, 0x38, 0x07, 0x81, 0xDC, 0x0E, 0x00, 0xF0, 0x3F,
+  0x81, 0xC0, 0x0E, 0x07, 0xE0, 0x70, 0x03, 0x81, 0xDC, 0x0E, 0x00, 0x70,
+  0x3B, 0x81, 0xC0, 0x0E, 0x0E, 0x70, 0x38, 0x03, 0xC3, 0xCE, 0x07, 0x80,
+  0xF8, 0xF1, 0xC0, 0x78, 0x3E, 0x7C, 0x38, 0x0F, 0xFF, 0xFE, 0x07, 0x80,
+  0xFF, 0xBF, 0x80, 0x70, 0x07, 0xC7, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x18,
+  0x00, 0x1E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0xFF,
+  0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0,
+  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x3E,
+  0xF0, 0x00, 0x1F, 0x3C, 0x00, 0x07, 0x8F, 0x80, 0x03, 0xE1, 0xE0, 0x00,
+  0xF0, 0x78, 0x00, 0x7C, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0x81, 0xE0,
+  0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+  0xF0, 0x1F, 0xFF, 0xFC, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x01, 0xE1, 0xF0,
+  0x00, 0x78, 0x78, 0x00, 0x1E, 0x3E, 0x00, 0x07, 0x9F, 0x00, 0x01, 0xF7,
+  0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xF0, 0x3C, 0x03, 0xF0, 0x78, 0x01, 0xE0, 0xF0, 0x03, 0xC1,
+  0xE0, 0x07, 0x87, 0x80, 0x0F, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x78, 0x3C,
+  0x03, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x07, 0x80,
+  0x3E, 0x0F, 0x00, 0x3C, 0x3E, 0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00,
+  0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x9E, 0x00, 0x1E,
+  0x3C, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x07,
+  0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF,
+  0xC0, 0x7F, 0x03, 0xF0, 0x7E, 0x00, 0x78, 0x7C, 0x00, 0x0C, 0x3C, 0x00,
+  0x04, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xE0, 0x00, 0x20, 0xF8, 0x00, 0x30, 0x3E, 0x00, 0x38, 0x1F, 0x80, 0xFC,
+  0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xC0, 0x1F, 0x80,
+  0x78, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x81, 0xE0, 0x00, 0xF0, 0x78, 0x00,
+  0x1F, 0x0F, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0xF1, 0xE0, 0x00, 0x1E, 0x3C, 0x00, 0x03, 0xC7, 0x80, 0x00,
+  0x78, 0xF0, 0x00, 0x1E, 0x3E, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x78, 0xF0,
+  0x00, 0x1E, 0x1E, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF8, 0xF0, 0x00, 0x3E,
+  0x1E, 0x00, 0x0F, 0x83, 0xC0, 0x03, 0xE0, 0x78, 0x03, 0xF8, 0x0F, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFC,
+  0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x81, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF, 0x01,
+  0xE0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+  0x00, 0xFC, 0x03, 0xF0, 0x3E, 0x00, 0x1E, 0x0F, 0x80, 0x00, 0xC3, 0xC0,
+  0x00, 0x10, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x3C, 0x00, 0x7F, 0xF7, 0x80, 0x0F, 0xFE, 0xF0, 0x01, 0xFF, 0x9E,
+  0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1E, 0x78, 0x00, 0x03, 0xCF, 0x00, 0x00,
+  0x79, 0xF0, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x78, 0x3E,
+  0x00, 0x1F, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFC,
+  0x00, 0x1F, 0xF8, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x78, 0x00, 0x3C, 0x1F,
+  0x00, 0x0F, 0x03, 0xC0, 0x01, 0xE0, 0x78, 0x00, 0x3C, 0x0F, 0x00, 0x07,
+  0x81, 0xE0, 0x01, 0xF0, 0x78, 0x00, 0x3C, 0x0F, 0x00, 0x07, 0x81, 0xE0,
+  0x00, 0xF0, 0x3C, 0x00, 0x1E, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xFE, 0x07, 0x80, 0x03, 0xC0, 0xF0, 0x00, 0x78, 0x3E, 0x00,
+  0x1E, 0x07, 0x80, 0x03, 0xC0, 0xF0, 0x00, 0x78, 0x1E, 0x00, 0x0F, 0x03,
+  0xC0, 0x01, 0xE0, 0xF0, 0x00, 0x78, 0x1E, 0x00, 0x0F, 0x03, 0xC0, 0x01,
+  0xE0, 0x78, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x83, 0xC0, 0x01, 0xE0, 0x78,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3E,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F,
+  0x03, 0xC0, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78,
+  0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03,
+  0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x0F, 0x80,
+  0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x78,
+  0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x03, 0xC0, 0x1F, 0x00, 0x78, 0x07, 0x80,
+  0x0F, 0x03, 0xE0, 0x01, 0xE0, 0xF8, 0x00, 0x78, 0x3E, 0x00, 0x0F, 0x0F,
+  0x80, 0x01, 0xE3, 0xC0, 0x00, 0x3D, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xF7, 0xC0,
+  0x00, 0x3E, 0x7C, 0x00, 0x07, 0x87, 0xC0, 0x00, 0xF0, 0xFC, 0x00, 0x1E,
+  0x0F, 0x80, 0x03, 0xC0, 0xF8, 0x00, 0xF0, 0x0F, 0x80, 0x1E, 0x00, 0xF8,
+  0x03, 0xC0, 0x1F, 0x80, 0x78, 0x01, 0xF0, 0x0F, 0x00, 0x1F, 0x03, 0xC0,
+  0x01, 0xF0, 0x78, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00,
+  0x7F, 0x03, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0xFE, 0x07, 0xF0, 0x00,
+  0xFE, 0x07, 0xF0, 0x01, 0xFE, 0x07, 0xF0, 0x01, 0xDE, 0x07, 0xB8, 0x03,
+  0x9E, 0x0F, 0x38, 0x07, 0xBC, 0x0F, 0x38, 0x07, 0x3C, 0x0F, 0x38, 0x0F,
+  0x3C, 0x0F, 0x38, 0x0E, 0x3C, 0x0F, 0x38, 0x1E, 0x7C, 0x1E, 0x1C, 0x1C,
+  0x78, 0x1E, 0x1C, 0x3C, 0x78, 0x1E, 0x1C, 0x38, 0x78, 0x1E, 0x1C, 0x70,
+  0x78, 0x3E, 0x1C, 0xF0, 0xF0, 0x3C, 0x0E, 0xE0, 0xF0, 0x3C, 0x0F, 0xE0,
+  0xF0, 0x3C, 0x0F, 0xC0, 0xF0, 0x3C, 0x0F, 0xC0, 0xF0, 0x78, 0x0F, 0x81,
+  0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x78, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x01,
+  0xE0, 0x78, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03,
+  0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x7C, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0x03,
+  0xF8, 0x01, 0xE0, 0x7F, 0x00, 0x3C, 0x0F, 0xE0, 0x07, 0x81, 0xEE, 0x01,
+  0xF0, 0x79, 0xC0, 0x3C, 0x0F, 0x38, 0x07, 0x81, 0xE7, 0x80, 0xF0, 0x3C,
+  0x70, 0x1E, 0x07, 0x8E, 0x07, 0xC1, 0xE1, 0xC0, 0xF0, 0x3C, 0x1C, 0x1E,
+  0x07, 0x83, 0x83, 0xC0, 0xF0, 0x70, 0x78, 0x3E, 0x07, 0x1E, 0x07, 0x80,
+  0xE3, 0xC0, 0xF0, 0x1C, 0x78, 0x1E, 0x03, 0xCF, 0x03, 0xC0, 0x39, 0xE0,
+  0xF0, 0x07, 0x78, 0x1E, 0x00, 0xEF, 0x03, 0xC0, 0x0F, 0xE0, 0x78, 0x01,
+  0xFC, 0x0F, 0x00, 0x3F, 0x83, 0xC0, 0x03, 0xE0, 0x78, 0x00, 0x7C, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
+  0x81, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x78, 0x00, 0x3E, 0x0F, 0x00, 0x01,
+  0xE1, 0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x3C,
+  0x00, 0x00, 0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xF7, 0x80, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x01, 0xEF,
+  0x00, 0x00, 0x1E, 0xF0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x3C, 0xF0, 0x00,
+  0x07, 0x8F, 0x80, 0x00, 0xF8, 0x78, 0x00, 0x0F, 0x07, 0xC0, 0x01, 0xE0,
+  0x3E, 0x00, 0x7C, 0x01, 0xF0, 0x1F, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0,
+  0x7F, 0xFF, 0x81, 0xE0, 0x3E, 0x07, 0x80, 0x7C, 0x1E, 0x00, 0xF0, 0x78,
+  0x03, 0xC3, 0xE0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x07,
+  0xC3, 0xC0, 0x1E, 0x1E, 0x00, 0xF8, 0x78, 0x07, 0xC1, 0xFF, 0xFE, 0x07,
+  0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0x81,
+  0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x78, 0x00, 0x3E, 0x0F, 0x00, 0x01, 0xE1,
+  0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x3C, 0x00,
+  0x00, 0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xEF, 0x00,
+  0x00, 0x1E, 0xF0, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x07,
+  0xCF, 0x80, 0x00, 0xF8, 0x78, 0x00, 0x0F, 0x07, 0xC0, 0x01, 0xE0, 0x3E,
+  0x00, 0x7C, 0x01, 0xF0, 0x1F, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFC,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0x81, 0xE0, 0x3E, 0x07, 0x80, 0x7C,
+  0x1E, 0x00, 0xF0, 0x78, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C,
+  0x00, 0xF0, 0xF0, 0x07, 0x83, 0xC0, 0x3E, 0x1E, 0x01, 0xF0, 0x7F, 0xFF,
+  0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x3E, 0x07, 0xC0, 0xF0, 0x0F, 0x03,
+  0xC0, 0x1E, 0x0F, 0x00, 0x78, 0x3C, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80,
+  0x0F, 0x1E, 0x00, 0x1C, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xEF, 0x00, 0x07,
+  0xBC, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF8,
+  0x3F, 0x03, 0xF0, 0x78, 0x00, 0xC1, 0xE0, 0x00, 0x83, 0x80, 0x00, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x3F,
+  0xF8, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
+  0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x78,
+  0xE0, 0x01, 0xF1, 0xF8, 0x0F, 0xC3, 0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x00,
+  0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+  0xF8, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00,
+  0x07, 0xC3, 0xC0, 0x01, 0xE1, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E,
+  0x00, 0x07, 0x87, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C,
+  0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00,
+  0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x01, 0xE1, 0xE0,
+  0x00, 0xF8, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3,
+  0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x0F,
+  0x01, 0xE0, 0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xEF,
+  0x80, 0x00, 0xF9, 0xE0, 0x00, 0x7C, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x0F,
+  0x87, 0x80, 0x03, 0xC1, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0xF8, 0x0F, 0x00,
+  0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x03, 0xE0, 0x0F,
+  0x01, 0xF0, 0x01, 0xE0, 0x78, 0x00, 0x78, 0x3E, 0x00, 0x1E, 0x0F, 0x00,
+  0x07, 0x87, 0xC0, 0x01, 0xE3, 0xE0, 0x00, 0x7C, 0xF8, 0x00, 0x0F, 0x7C,
+  0x00, 0x03, 0xDE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0xF0, 0x00, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0x00, 0x1E, 0xF0, 0x01, 0xF0,
+  0x03, 0xEF, 0x00, 0x3F, 0x00, 0x3C, 0xF0, 0x03, 0xF0, 0x03, 0xCF, 0x00,
+  0x3F, 0x00, 0x7C, 0xF0, 0x07, 0x70, 0x07, 0x8F, 0x00, 0x77, 0x00, 0xF8,
+  0x78, 0x0E, 0x70, 0x0F, 0x07, 0x80, 0xE7, 0x81, 0xF0, 0x78, 0x1E, 0x38,
+  0x1E, 0x07, 0x81, 0xC3, 0x83, 0xE0, 0x78, 0x3C, 0x38, 0x3C, 0x07, 0x83,
+  0x83, 0x83, 0xC0, 0x78, 0x78, 0x38, 0x78, 0x07, 0x87, 0x03, 0x87, 0x80,
+  0x78, 0x70, 0x38, 0xF8, 0x07, 0x8E, 0x03, 0x8F, 0x00, 0x78, 0xE0, 0x39,
+  0xF0, 0x07, 0x9C, 0x03, 0x9E, 0x00, 0x79, 0xC0, 0x3B, 0xE0, 0x07, 0xBC,
+  0x03, 0xBC, 0x00, 0x7B, 0x80, 0x3F, 0xC0, 0x07, 0xF8, 0x03, 0xF8, 0x00,
+  0x3F, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x3F,
+  0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x07, 0x80,
+  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0xF8,
+  0x00, 0x1E, 0x0F, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xCF, 0xC0, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF7, 0x80, 0x00,
+  0x3F, 0x3E, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0,
+  0x1E, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xC0, 0x1F, 0x80, 0x1E,
+  0x01, 0xF8, 0x00, 0xF8, 0x1F, 0x80, 0x03, 0xC1, 0xF8, 0x00, 0x1F, 0x00,
+  0xF8, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x87, 0x80, 0x1F,
+  0x83, 0xE0, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x3C, 0x0F, 0x80, 0x1F, 0x0F,
+  0x80, 0x07, 0x8F, 0x80, 0x03, 0xEF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
+  0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
+  0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x01, 0xFE, 0x03, 0xFC, 0x0F, 0xF0,
+  0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x0F,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xFF, 0x81, 0xFF, 0x03, 0xFC, 0x00,
+  0xE1, 0xC3, 0xC7, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xE3, 0xC3, 0x87,
+  0x0E, 0x1C, 0x38, 0x70, 0xF1, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x78,
+  0xF0, 0xE1, 0xC3, 0x87, 0x01, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x07, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x01, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xE0, 0x01, 0xC0, 0x7F, 0x81, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xE7,
+  0xC0, 0x07, 0xC3, 0xE0, 0x0F, 0x81, 0xF0, 0x1E, 0x00, 0x78, 0x3C, 0x00,
+  0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xF0, 0x78, 0x38, 0x3C, 0x1E, 0x0E, 0x07, 0x00, 0x7F,
+  0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x70, 0x3E, 0x08, 0x01, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0x0F,
+  0xFF, 0xF3, 0xFF, 0xFE, 0x7E, 0x01, 0xE7, 0x80, 0x1E, 0xF0, 0x03, 0xEF,
+  0x00, 0x3C, 0xF0, 0x07, 0xCF, 0x00, 0xFC, 0xF8, 0x3F, 0xC7, 0xFF, 0x78,
+  0x3F, 0xE7, 0x81, 0xF8, 0x78, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x0F, 0x80, 0x79, 0xFE, 0x03, 0xDF, 0xF8, 0x1F, 0xC3,
+  0xE1, 0xF8, 0x0F, 0x0F, 0xC0, 0x7C, 0x7C, 0x01, 0xE3, 0xC0, 0x0F, 0x1E,
+  0x00, 0x79, 0xF0, 0x03, 0xCF, 0x00, 0x1E, 0x78, 0x00, 0xF3, 0xC0, 0x0F,
+  0x1E, 0x00, 0x79, 0xF0, 0x03, 0xCF, 0x80, 0x3C, 0x7C, 0x03, 0xE3, 0xF0,
+  0x1E, 0x1F, 0xC3, 0xE1, 0xF7, 0xFE, 0x0F, 0x3F, 0xE0, 0x78, 0x7C, 0x00,
+  0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0x87, 0xE0, 0x71, 0xF0, 0x04,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07,
+  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x21, 0xF8, 0x1C, 0x1F, 0xFF, 0x01,
+  0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x78, 0x07, 0xFC, 0xF0, 0x1F, 0xFD,
+  0xE0, 0x7C, 0x3B, 0xC1, 0xF0, 0x1F, 0x87, 0xC0, 0x3E, 0x0F, 0x00, 0x7C,
+  0x3C, 0x00, 0x78, 0x78, 0x00, 0xF0, 0xF0, 0x03, 0xE3, 0xC0, 0x07, 0x87,
+  0x80, 0x0F, 0x0F, 0x00, 0x1E, 0x1E, 0x00, 0x7C, 0x3C, 0x00, 0xF8, 0x78,
+  0x03, 0xE0, 0xF8, 0x07, 0xC0, 0xF0, 0x1F, 0x81, 0xF0, 0xEF, 0x01, 0xFF,
+  0xFE, 0x03, 0xFF, 0x78, 0x01, 0xF8, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F,
+  0xF8, 0x07, 0xFF, 0xC0, 0xF8, 0x3E, 0x1F, 0x01, 0xE3, 0xE0, 0x0F, 0x3C,
+  0x00, 0xF7, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0x80, 0x08, 0x7E, 0x07, 0x83, 0xFF, 0xF0, 0x1F, 0xFE,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xC0, 0x07,
+  0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x7F, 0xF8, 0x7F,
+  0xF8, 0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+  0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C,
+  0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFC, 0xF0, 0x3F, 0xFB, 0xC1,
+  0xF0, 0x7F, 0x0F, 0x80, 0xF8, 0x7C, 0x03, 0xE1, 0xE0, 0x07, 0x8F, 0x00,
+  0x1E, 0x3C, 0x00, 0x78, 0xF0, 0x03, 0xC7, 0x80, 0x0F, 0x1E, 0x00, 0x3C,
+  0x78, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0x7C,
+  0x03, 0xE0, 0xF0, 0x1F, 0x83, 0xE0, 0xFE, 0x07, 0xFF, 0xF0, 0x1F, 0xFB,
+  0xC0, 0x1F, 0x8F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x81,
+  0x00, 0x7C, 0x07, 0x03, 0xE0, 0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x7F,
+  0x80, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0x0F, 0xC0, 0x79, 0xFF, 0x03, 0xDF, 0xFC, 0x1F, 0xC3, 0xF1, 0xF8, 0x0F,
+  0x8F, 0x80, 0x3C, 0x7C, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x79, 0xF0,
+  0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x79,
+  0xF0, 0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00,
+  0x79, 0xF0, 0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0xF0,
+  0x7C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x3C,
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x07, 0xC1, 0xE0, 0x78, 0x1E, 0x07, 0x83, 0xE0, 0xF0, 0x3C, 0x00, 0x00,
+  0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x01,
+  0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0xFF, 0x00, 0xFE,
+  0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01,
+  0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xE0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x03, 0xE0, 0xF0, 0x1F, 0x03, 0xC0, 0xF8,
+  0x1F, 0x07, 0xC0, 0x78, 0x7C, 0x01, 0xE3, 0xE0, 0x07, 0x9F, 0x00, 0x1E,
+  0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0,
+  0x00, 0xF7, 0xC0, 0x07, 0xCF, 0x80, 0x1E, 0x1F, 0x00, 0x78, 0x3E, 0x01,
+  0xE0, 0x7C, 0x07, 0x81, 0xF8, 0x3E, 0x03, 0xF0, 0xF0, 0x07, 0xC3, 0xC0,
+  0x0F, 0x80, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3E,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F,
+  0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xC1, 0xE0, 0x78, 0x1E, 0x07, 0x83,
+  0xE0, 0xF0, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x03, 0xCF, 0xF0, 0x7F,
+  0xC0, 0xF7, 0xFE, 0x3F, 0xF8, 0x3F, 0x87, 0xDC, 0x3F, 0x1F, 0x81, 0xFE,
+  0x07, 0xC7, 0xC0, 0x3F, 0x00, 0xF1, 0xF0, 0x0F, 0x80, 0x3C, 0x78, 0x03,
+  0xC0, 0x0F, 0x1E, 0x00, 0xF0, 0x03, 0xCF, 0x00, 0x3C, 0x01, 0xF3, 0xC0,
+  0x1E, 0x00, 0x78, 0xF0, 0x07, 0x80, 0x1E, 0x3C, 0x01, 0xE0, 0x07, 0x8F,
+  0x00, 0x78, 0x01, 0xE7, 0xC0, 0x3E, 0x00, 0xF9, 0xE0, 0x0F, 0x00, 0x3C,
+  0x78, 0x03, 0xC0, 0x0F, 0x1E, 0x00, 0xF0, 0x03, 0xC7, 0x80, 0x3C, 0x00,
+  0xF3, 0xE0, 0x1F, 0x00, 0x7C, 0xF0, 0x07, 0x80, 0x1E, 0x3C, 0x01, 0xE0,
+  0x07, 0x80, 0x00, 0x0F, 0xC0, 0x79, 0xFF, 0x03, 0xDF, 0xFC, 0x1F, 0xC3,
+  0xF1, 0xF8, 0x0F, 0x8F, 0x80, 0x3C, 0x7C, 0x01, 0xE3, 0xC0, 0x0F, 0x1E,
+  0x00, 0x79, 0xE0, 0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F,
+  0x1E, 0x00, 0x79, 0xF0, 0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0,
+  0x0F, 0x1E, 0x00, 0x79, 0xF0, 0x07, 0xCF, 0x00, 0x3C, 0x78, 0x01, 0xE0,
+  0x00, 0x7E, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xC0, 0xF8, 0x3E, 0x1E, 0x01,
+  0xE3, 0xE0, 0x1F, 0x3C, 0x00, 0xF7, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0x80,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xEF, 0x00, 0x1E, 0xF0,
+  0x01, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xC7, 0x80, 0x78, 0x7C, 0x1F, 0x03,
+  0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x07, 0x9F,
+  0xF0, 0x0F, 0x7F, 0xF0, 0x3F, 0xC3, 0xE0, 0x7E, 0x03, 0xE0, 0xF8, 0x07,
+  0xC1, 0xF0, 0x07, 0x83, 0xC0, 0x0F, 0x0F, 0x80, 0x1E, 0x1F, 0x00, 0x3C,
+  0x3C, 0x00, 0x78, 0x78, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xE0, 0x07, 0x87,
+  0x80, 0x0F, 0x0F, 0x80, 0x3C, 0x1F, 0x00, 0xF8, 0x3E, 0x03, 0xE0, 0xF7,
+  0x0F, 0x81, 0xEF, 0xFE, 0x03, 0xCF, 0xF8, 0x07, 0x8F, 0xC0, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x0F, 0xFC, 0xF0, 0x7F, 0xFB, 0xC3, 0xE0, 0xFE, 0x1F, 0x00, 0xF8,
+  0xF8, 0x03, 0xE3, 0xC0, 0x0F, 0x9E, 0x00, 0x3E, 0x78, 0x00, 0xF1, 0xE0,
+  0x03, 0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0xF3, 0xC0, 0x07,
+  0x8F, 0x00, 0x1E, 0x3C, 0x00, 0xF8, 0xF8, 0x03, 0xE1, 0xE0, 0x1F, 0x87,
+  0xC1, 0xFC, 0x0F, 0xFE, 0xF0, 0x3F, 0xF3, 0xC0, 0x3F, 0x0F, 0x00, 0x00,
+  0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78,
+  0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x87,
+  0xBF, 0xC3, 0xFF, 0xC1, 0xFC, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x00,
+  0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0,
+  0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E,
+  0x00, 0x1F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x00, 0xFE, 0x00, 0xFF,
+  0xF8, 0x3F, 0xFF, 0x8F, 0xC0, 0xE1, 0xE0, 0x04, 0x78, 0x00, 0x0F, 0x00,
+  0x01, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0xFF,
+  0x80, 0x07, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07,
+  0x90, 0x01, 0xE3, 0xC0, 0xFC, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0,
+  0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x0F,
+  0xFF, 0xBF, 0xFE, 0xFF, 0xF8, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0xFF, 0xC1, 0xFF, 0x01, 0xFC,
+  0x00, 0x1E, 0x00, 0x78, 0xF0, 0x03, 0xCF, 0x80, 0x3E, 0x78, 0x01, 0xE3,
+  0xC0, 0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x03, 0xCF, 0x80, 0x3E, 0x78, 0x01,
+  0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x03, 0xCF, 0x00, 0x3E, 0x78,
+  0x01, 0xE3, 0xC0, 0x1F, 0x1E, 0x00, 0xF8, 0xF8, 0x1F, 0xC7, 0xC1, 0xDE,
+  0x1F, 0xFD, 0xE0, 0x7F, 0xCF, 0x01, 0xF8, 0x78, 0x00, 0xF0, 0x00, 0xFF,
+  0x80, 0x0F, 0xBE, 0x00, 0x7C, 0xF0, 0x07, 0xC7, 0x80, 0x3C, 0x3C, 0x03,
+  0xE1, 0xE0, 0x1E, 0x0F, 0x01, 0xF0, 0x3C, 0x1F, 0x01, 0xE0, 0xF0, 0x0F,
+  0x0F, 0x80, 0x78, 0x78, 0x03, 0xC7, 0xC0, 0x0F, 0x7C, 0x00, 0x7B, 0xE0,
+  0x03, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x1F,
+  0x80, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xFF, 0x80, 0x7C, 0x07,
+  0xBC, 0x07, 0xE0, 0x7D, 0xE0, 0x3F, 0x03, 0xCF, 0x03, 0xB8, 0x3E, 0x78,
+  0x1D, 0xC1, 0xE3, 0xC1, 0xEE, 0x0F, 0x0F, 0x0E, 0x70, 0xF0, 0x78, 0xF3,
+  0x87, 0x83, 0xC7, 0x1C, 0x7C, 0x1E, 0x78, 0xE3, 0xC0, 0xF3, 0x87, 0x3E,
+  0x07, 0xBC, 0x39, 0xE0, 0x3D, 0xC0, 0xFF, 0x01, 0xFE, 0x07, 0xF0, 0x0F,
+  0xE0, 0x3F, 0x80, 0x7F, 0x01, 0xF8, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0x07, 0xC0,
+  0x3F, 0x03, 0xC0, 0x7E, 0x03, 0xE0, 0xFC, 0x01, 0xE1, 0xF8, 0x01, 0xF3,
+  0xF0, 0x00, 0xF7, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x3F,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xE7, 0x80, 0x0F, 0xC7,
+  0xC0, 0x1F, 0x83, 0xC0, 0x3F, 0x03, 0xE0, 0x7E, 0x01, 0xE0, 0xFC, 0x01,
+  0xF0, 0x0F, 0x00, 0x1F, 0x0F, 0x00, 0x3E, 0x0F, 0x00, 0x3E, 0x07, 0x80,
+  0x7C, 0x07, 0x80, 0x78, 0x07, 0x80, 0xF8, 0x07, 0x81, 0xF0, 0x07, 0xC1,
+  0xF0, 0x03, 0xC3, 0xE0, 0x03, 0xC3, 0xC0, 0x03, 0xC7, 0xC0, 0x03, 0xC7,
+  0x80, 0x01, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF, 0xFE,
+  0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03,
+  0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00,
+  0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
+  0x03, 0xF0, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00,
+  0x00, 0x07, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x1E, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00,
+  0x3E, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xC0, 0x00,
+  0x78, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03,
+  0xC0, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00,
+  0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xF8,
+  0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFC,
+  0x00, 0xFF, 0x00, 0x3E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+  0x3E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x0F,
+  0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0x3F, 0xF0,
+  0x03, 0x7F, 0xFE, 0x0F, 0xF0, 0x7F, 0xFE, 0xC0, 0x0F, 0xFC, 0x80, 0x03,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
+  0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
+  0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81,
+  0xE0, 0x78, 0x1E, 0x07, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xE0,
+  0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3C, 0x0F, 0x03, 0xC0, 0x00, 0x06,
+  0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x7F,
+  0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0x0F, 0xCC, 0xE3, 0xE1, 0x84, 0x78, 0x60,
+  0x1E, 0x0C, 0x07, 0xC1, 0x80, 0xF0, 0x30, 0x1E, 0x06, 0x07, 0x81, 0x80,
+  0xF0, 0x30, 0x1E, 0x06, 0x03, 0xC0, 0xC0, 0x78, 0x18, 0x0F, 0x06, 0x01,
+  0xF0, 0xC0, 0x1E, 0x18, 0x43, 0xF3, 0x38, 0x3F, 0xFF, 0x03, 0xFF, 0xC0,
+  0x1F, 0xC0, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00,
+  0x0C, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFE, 0x00,
+  0x3E, 0x06, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+  0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x20, 0x00, 0x11, 0xC0, 0x00, 0xEF, 0x80,
+  0x07, 0xDF, 0x3F, 0x3E, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0xF8, 0x7C,
+  0x03, 0x80, 0x70, 0x1E, 0x01, 0xE0, 0x70, 0x03, 0x81, 0xC0, 0x0E, 0x07,
+  0x00, 0x38, 0x1C, 0x00, 0xE0, 0x78, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0xE1,
+  0xF0, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC7, 0xCF, 0xCF, 0xBE, 0x00, 0x1F,
+  0x70, 0x00, 0x38, 0x80, 0x00, 0x40, 0x1E, 0x00, 0x3F, 0x1E, 0x00, 0x3E,
+  0x1F, 0x00, 0x7C, 0x0F, 0x00, 0xF8, 0x0F, 0x01, 0xF8, 0x07, 0x81, 0xF0,
+  0x07, 0x83, 0xE0, 0x07, 0x87, 0xC0, 0x03, 0xCF, 0xC0, 0x03, 0xCF, 0x80,
+  0x03, 0xDF, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x01, 0xFC, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xE0, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00,
+  0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xFF,
+  0x00, 0x7F, 0xF0, 0x0F, 0x83, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x3D,
+  0xE0, 0x07, 0x9F, 0x80, 0xF0, 0x7C, 0x1E, 0x03, 0xE1, 0xE0, 0x3E, 0x1E,
+  0x01, 0xE1, 0xF0, 0x1E, 0x0F, 0x81, 0xC0, 0x7C, 0x3C, 0x03, 0xE7, 0x80,
+  0x0F, 0xF0, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xE0,
+  0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x06, 0x07, 0xC0, 0x7F, 0xF8,
+  0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x78, 0x7F, 0xC3, 0xFC, 0x3D, 0xE1,
+  0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xC0, 0x7C, 0x00,
+  0x70, 0x00, 0xE0, 0x0E, 0x00, 0x07, 0x01, 0xC0, 0x00, 0x38, 0x38, 0x1F,
+  0xC1, 0xC3, 0x07, 0xFF, 0x0C, 0x60, 0xF0, 0x30, 0x66, 0x1E, 0x00, 0x06,
+  0xE1, 0xC0, 0x00, 0x7C, 0x38, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x3C, 0x38,
+  0x00, 0x03, 0xC3, 0x80, 0x00, 0x3C, 0x38, 0x00, 0x03, 0xC3, 0x80, 0x00,
+  0x3C, 0x1C, 0x00, 0x07, 0x61, 0xE0, 0x00, 0x66, 0x0F, 0x01, 0x06, 0x30,
+  0x7F, 0xF0, 0xC3, 0x81, 0xFC, 0x1C, 0x1C, 0x00, 0x03, 0x80, 0xE0, 0x00,
+  0x70, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
+  0x03, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xFE, 0x0C, 0x0F, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x07, 0xFF, 0x1F, 0xFF, 0x3C, 0x0F, 0x78, 0x0E, 0x70,
+  0x0E, 0x70, 0x1E, 0x70, 0x3E, 0x78, 0x7C, 0x3F, 0xFC, 0x1F, 0x9C, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x20, 0x10, 0x06, 0x03,
+  0x00, 0xE0, 0x60, 0x3C, 0x1E, 0x07, 0x83, 0xC1, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x07, 0x83, 0xC0, 0xF0, 0x70, 0x0F, 0x07, 0x80, 0x78, 0x3C, 0x03, 0xC1,
+  0xE0, 0x1E, 0x0F, 0x00, 0xF0, 0x78, 0x07, 0x03, 0x80, 0x30, 0x18, 0x01,
+  0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
+  0x03, 0xC0, 0x7C, 0x00, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x07, 0x01, 0xC0,
+  0x00, 0x38, 0x38, 0xFF, 0x81, 0xC3, 0x0F, 0xFE, 0x0C, 0x60, 0xE0, 0xF0,
+  0x66, 0x0E, 0x07, 0x06, 0xE0, 0xE0, 0x70, 0x7C, 0x0E, 0x07, 0x03, 0xC0,
+  0xE0, 0xE0, 0x3C, 0x0F, 0xFE, 0x03, 0xC0, 0xFF, 0x00, 0x3C, 0x0E, 0x38,
+  0x03, 0xC0, 0xE1, 0xC0, 0x3C, 0x0E, 0x1E, 0x07, 0x60, 0xE0, 0xE0, 0x66,
+  0x0E, 0x07, 0x06, 0x30, 0xE0, 0x70, 0xC3, 0x8E, 0x03, 0x9C, 0x1C, 0x00,
+  0x03, 0x80, 0xE0, 0x00, 0x70, 0x07, 0x00, 0x0E, 0x00, 0x3E, 0x03, 0xC0,
+  0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xE0, 0x77, 0x0E, 0x3F, 0xC1, 0xF8, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x70, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0x3F,
+  0xF0, 0x60, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x0F, 0x00, 0x3C,
+  0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3F,
+  0xFC, 0x7F, 0xF8, 0x07, 0xF0, 0x7F, 0xE1, 0x83, 0xC0, 0x07, 0x00, 0x1C,
+  0x00, 0xE0, 0x7E, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x0E,
+  0x00, 0x7B, 0x03, 0xCF, 0xFE, 0x0F, 0xE0, 0x01, 0xC0, 0x70, 0x1C, 0x07,
+  0x03, 0xC0, 0xF0, 0x3C, 0x00, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x1F, 0x07,
+  0xC0, 0x1E, 0x07, 0x80, 0x1E, 0x07, 0x80, 0x1E, 0x07, 0x80, 0x1E, 0x07,
+  0x80, 0x3E, 0x0F, 0x80, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F,
+  0x00, 0x3C, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1E,
+  0x00, 0x78, 0x1E, 0x00, 0xF8, 0x1F, 0x01, 0xF8, 0x3F, 0x83, 0xF8, 0x3F,
+  0xFF, 0x7E, 0x3D, 0xFE, 0x7E, 0x3C, 0xFC, 0x3C, 0x3C, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F,
+  0xFF, 0x0F, 0xF8, 0x73, 0xFF, 0x86, 0x3F, 0xF8, 0xE7, 0xFF, 0x0E, 0xFF,
+  0xF0, 0xEF, 0xFF, 0x0E, 0xFF, 0xF0, 0xCF, 0xFF, 0x1C, 0xFF, 0xE1, 0xCF,
+  0xFE, 0x1C, 0x7F, 0xE1, 0xC3, 0xFE, 0x18, 0x1F, 0xE3, 0x80, 0x7C, 0x38,
+  0x01, 0xC3, 0x80, 0x1C, 0x38, 0x01, 0xC3, 0x00, 0x1C, 0x70, 0x01, 0x87,
+  0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0x38, 0x60, 0x03, 0x8E, 0x00, 0x30,
+  0xE0, 0x07, 0x0E, 0x00, 0x70, 0xE0, 0x07, 0x0C, 0x00, 0x71, 0xC0, 0x06,
+  0x1C, 0x00, 0xE1, 0xC0, 0x7B, 0xFF, 0xEF, 0x00, 0x07, 0x01, 0x80, 0xE0,
+  0x70, 0x3C, 0x3F, 0xFD, 0xF8, 0x07, 0xC7, 0xF8, 0xCE, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0xE0, 0x1C,
+  0x3F, 0xFF, 0xFF, 0x01, 0xF8, 0x07, 0xFC, 0x0E, 0x1E, 0x1C, 0x0F, 0x38,
+  0x07, 0x38, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70,
+  0x0E, 0x70, 0x0E, 0x38, 0x1C, 0x3C, 0x38, 0x1F, 0xF0, 0x0F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x10, 0x08, 0x01, 0x80, 0xC0,
+  0x1C, 0x0E, 0x01, 0xE0, 0xF0, 0x0F, 0x07, 0x80, 0x78, 0x3C, 0x03, 0xC1,
+  0xE0, 0x1E, 0x0F, 0x00, 0xE0, 0xF0, 0x3C, 0x1E, 0x07, 0x83, 0xC1, 0xF0,
+  0xF8, 0x3C, 0x1E, 0x07, 0x83, 0xC0, 0x60, 0x70, 0x0C, 0x06, 0x00, 0x80,
+  0x40, 0x00, 0x07, 0xC0, 0x00, 0x1C, 0x07, 0xF8, 0x00, 0x07, 0x00, 0xCE,
+  0x00, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x1E, 0x00,
+  0x07, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x38,
+  0x00, 0x07, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x03, 0xC0, 0x00, 0x1C, 0x00,
+  0xF0, 0x00, 0x03, 0x80, 0x3C, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x1C,
+  0x01, 0xC0, 0x07, 0xBF, 0xF8, 0x70, 0x01, 0xF7, 0xFF, 0x1E, 0x00, 0x7E,
+  0x00, 0x07, 0x80, 0x1D, 0x80, 0x01, 0xE0, 0x07, 0x70, 0x00, 0x38, 0x01,
+  0xCE, 0x00, 0x0E, 0x00, 0x71, 0xC0, 0x03, 0x80, 0x1C, 0x38, 0x00, 0xF0,
+  0x03, 0x0E, 0x00, 0x3C, 0x00, 0xC1, 0xC0, 0x07, 0x00, 0x3F, 0xFE, 0x01,
+  0xC0, 0x07, 0xFF, 0xC0, 0x70, 0x00, 0x00, 0xE0, 0x1E, 0x00, 0x00, 0x38,
+  0x07, 0x80, 0x00, 0x07, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x07, 0xC0, 0x00,
+  0x1C, 0x07, 0xF8, 0x00, 0x07, 0x00, 0xCE, 0x00, 0x01, 0xC0, 0x01, 0xC0,
+  0x00, 0x78, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x07, 0x80, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x07, 0x00, 0x0E, 0x00,
+  0x00, 0xE0, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x3C,
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0xFC, 0x3F, 0xF8,
+  0x70, 0x7F, 0xE7, 0xFF, 0x1E, 0x0C, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xC0,
+  0x01, 0xE0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x01,
+  0xE0, 0x03, 0x80, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x3C, 0x00,
+  0x0F, 0x80, 0x07, 0x00, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0xF0, 0x00, 0x70,
+  0x00, 0x7C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x07, 0xFF, 0x81,
+  0xE0, 0x00, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0x00, 0xFF, 0xC0, 0x00,
+  0x70, 0x06, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x01,
+  0xC0, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x1F, 0x80, 0x03, 0x80,
+  0x00, 0xFC, 0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0x80, 0x00, 0x01, 0xC0,
+  0x3C, 0x00, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x00, 0x70, 0x3C, 0x00, 0x00,
+  0x07, 0x81, 0xC0, 0x00, 0x60, 0x78, 0x1C, 0x00, 0x7B, 0xFF, 0x81, 0xC0,
+  0x07, 0xC7, 0xF0, 0x1E, 0x00, 0x7E, 0x00, 0x01, 0xE0, 0x07, 0x60, 0x00,
+  0x1E, 0x00, 0x77, 0x00, 0x00, 0xE0, 0x07, 0x38, 0x00, 0x0E, 0x00, 0x71,
+  0xC0, 0x00, 0xE0, 0x07, 0x0E, 0x00, 0x0F, 0x00, 0x30, 0xE0, 0x00, 0xF0,
+  0x03, 0x07, 0x00, 0x07, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x01, 0xFF, 0xF0,
+  0x07, 0x00, 0x00, 0x0E, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x00,
+  0x07, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00,
+  0x3C, 0x00, 0x78, 0x01, 0xF0, 0x07, 0xF8, 0x7D, 0xFF, 0xF1, 0xFF, 0xC1,
+  0xFE, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x7B, 0xC0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0x3C, 0x00, 0x07, 0x8F,
+  0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0x78, 0x00, 0x7C, 0x1E, 0x00, 0x3E,
+  0x07, 0x80, 0x0F, 0x81, 0xE0, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x0F, 0x80, 0x07,
+  0x83, 0xC0, 0x01, 0xE1, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x3E, 0x00,
+  0x07, 0x9F, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7B, 0xC0,
+  0x00, 0x3E, 0xF0, 0x00, 0x1F, 0x3C, 0x00, 0x07, 0x8F, 0x80, 0x03, 0xE1,
+  0xE0, 0x00, 0xF0, 0x78, 0x00, 0x7C, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F,
+  0x81, 0xE0, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xFF, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x01,
+  0xE1, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x3E, 0x00, 0x07, 0x9F, 0x00,
+  0x01, 0xF7, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0x1C, 0x00, 0x07, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x3E, 0xF0,
+  0x00, 0x1F, 0x3C, 0x00, 0x07, 0x8F, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0,
+  0x78, 0x00, 0x7C, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0x81, 0xE0, 0x07,
+  0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFC, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x01, 0xE1, 0xF0, 0x00,
+  0x78, 0x78, 0x00, 0x1E, 0x3E, 0x00, 0x07, 0x9F, 0x00, 0x01, 0xF7, 0xC0,
+  0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x7F, 0x18,
+  0x00, 0x0C, 0x7F, 0x00, 0x03, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x7D, 0xE0, 0x00,
+  0x1F, 0x3C, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF8, 0x78, 0x00, 0x1E, 0x0F,
+  0x00, 0x07, 0xC1, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0x3E, 0x07, 0x80, 0x0F,
+  0x80, 0x78, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
+  0x03, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x78, 0x1E, 0x00, 0x0F, 0x07, 0xC0,
+  0x01, 0xE0, 0xF0, 0x00, 0x3C, 0x3E, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xF9,
+  0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC3, 0xC0, 0x01,
+  0xF0, 0xF0, 0x00, 0x78, 0x7C, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03,
+  0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x3E, 0xF0, 0x00,
+  0x1F, 0x3C, 0x00, 0x07, 0x8F, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0x78,
+  0x00, 0x7C, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0x81, 0xE0, 0x07, 0xC0,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xFC, 0x0F, 0x80, 0x07, 0x83, 0xC0, 0x01, 0xE1, 0xF0, 0x00, 0x78,
+  0x78, 0x00, 0x1E, 0x3E, 0x00, 0x07, 0x9F, 0x00, 0x01, 0xF7, 0xC0, 0x00,
+  0x3F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x18, 0x60, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xC0,
+  0x00, 0x30, 0x30, 0x00, 0x0E, 0x1C, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x3E, 0x78, 0x00, 0x0F, 0x1E, 0x00,
+  0x07, 0xC7, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0x78, 0x00, 0x7C, 0x1E,
+  0x00, 0x1E, 0x03, 0xC0, 0x0F, 0x80, 0xF0, 0x07, 0xC0, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x0F,
+  0x80, 0x07, 0x83, 0xE0, 0x01, 0xE1, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x1E,
+  0x3E, 0x00, 0x07, 0x9F, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
+  0x0F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
+  0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3E, 0x78, 0x00, 0x00, 0x00, 0x1F,
+  0x3C, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00,
+  0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x00,
+  0x07, 0x83, 0xC0, 0x00, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x07, 0xC0,
+  0xFF, 0xFF, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x7F, 0xFF,
+  0xE0, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x01,
+  0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x78, 0x01, 0xE0, 0x00,
+  0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x3E,
+  0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x1F,
+  0xFF, 0xF8, 0x1F, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0x00, 0x0F, 0xFF, 0xFE,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x7F,
+  0x03, 0xF0, 0x7E, 0x00, 0x78, 0x7C, 0x00, 0x0C, 0x3C, 0x00, 0x04, 0x3C,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00,
+  0x20, 0xF8, 0x00, 0x30, 0x3E, 0x00, 0x38, 0x1F, 0x80, 0xFC, 0x07, 0xFF,
+  0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x02,
+  0x1E, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0,
+  0x00, 0x0F, 0xE0, 0x00, 0x1E, 0xF0, 0x00, 0x3C, 0x70, 0x00, 0x70, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x3C,
+  0x00, 0x7C, 0x3C, 0x00, 0x78, 0x7C, 0x00, 0x78, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x1F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x0F, 0x01, 0xC0,
+  0x38, 0x0E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x7C, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1E, 0x07,
+  0x81, 0xE0, 0x78, 0x3E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x0F, 0x03, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00,
+  0x7C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
+  0x3E, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x1F,
+  0xC0, 0xF7, 0x87, 0x8E, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x3E, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x00, 0x3C, 0x00,
+  0x1E, 0x1E, 0x7C, 0x3C, 0xF0, 0xF9, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+  0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x00, 0x3C, 0x01, 0xF8, 0x03, 0xC0,
+  0x07, 0xC0, 0x3C, 0x00, 0x3E, 0x07, 0xC0, 0x01, 0xE0, 0x78, 0x00, 0x1F,
+  0x07, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0x0F, 0x00, 0x00,
+  0xF1, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E,
+  0x00, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x3E, 0x00, 0x07, 0x83, 0xC0, 0x00,
+  0xF8, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xE0, 0x3C, 0x01, 0xFC, 0x07,
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07,
+  0x87, 0x00, 0x03, 0xF8, 0xC0, 0x00, 0x63, 0xF8, 0x00, 0x1C, 0x3C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xE0, 0x01, 0xE0, 0x7C, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0x03,
+  0xF8, 0x01, 0xE0, 0x7F, 0x00, 0x3C, 0x0F, 0xE0, 0x07, 0x81, 0xEE, 0x01,
+  0xF0, 0x79, 0xC0, 0x3C, 0x0F, 0x38, 0x07, 0x81, 0xE7, 0x80, 0xF0, 0x3C,
+  0x70, 0x1E, 0x07, 0x8E, 0x07, 0xC1, 0xE1, 0xC0, 0xF0, 0x3C, 0x1C, 0x1E,
+  0x07, 0x83, 0x83, 0xC0, 0xF0, 0x70, 0x78, 0x3E, 0x07, 0x1E, 0x07, 0x80,
+  0xE3, 0xC0, 0xF0, 0x1C, 0x78, 0x1E, 0x03, 0xCF, 0x03, 0xC0, 0x39, 0xE0,
+  0xF0, 0x07, 0x78, 0x1E, 0x00, 0xEF, 0x03, 0xC0, 0x0F, 0xE0, 0x78, 0x01,
+  0xFC, 0x0F, 0x00, 0x3F, 0x83, 0xC0, 0x03, 0xE0, 0x78, 0x00, 0x7C, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01,
+  0xF8, 0x1F, 0x80, 0x3E, 0x00, 0x7C, 0x07, 0x80, 0x03, 0xE0, 0xF0, 0x00,
+  0x1E, 0x1F, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3,
+  0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x1E,
+  0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x00,
+  0x00, 0x78, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00, 0xF0, 0x7C, 0x00, 0x1E,
+  0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+  0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xF8, 0x1F, 0x80, 0x3E, 0x00, 0x7C,
+  0x07, 0x80, 0x03, 0xE0, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x01, 0xF1, 0xE0,
+  0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00,
+  0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x01, 0xEF, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00,
+  0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x0F, 0x87,
+  0x80, 0x00, 0xF0, 0x7C, 0x00, 0x1E, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x01,
+  0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xBC, 0x00, 0x00,
+  0xF1, 0xC0, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01,
+  0xF8, 0x1F, 0x80, 0x3E, 0x00, 0x7C, 0x07, 0x80, 0x03, 0xE0, 0xF0, 0x00,
+  0x1E, 0x1F, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3,
+  0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x1E,
+  0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x00,
+  0x00, 0x78, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00, 0xF0, 0x7C, 0x00, 0x1E,
+  0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xC3, 0x80, 0x00, 0xFE,
+  0x30, 0x00, 0x0C, 0x7F, 0x00, 0x01, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+  0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xF8, 0x1F, 0x80, 0x3E, 0x00, 0x7C,
+  0x07, 0x80, 0x03, 0xE0, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x01, 0xF1, 0xE0,
+  0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00,
+  0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x01, 0xEF, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00,
+  0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x0F, 0x87,
+  0x80, 0x00, 0xF0, 0x7C, 0x00, 0x1E, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x01,
+  0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x0F, 0x0F, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01,
+  0xF8, 0x1F, 0x80, 0x3E, 0x00, 0x7C, 0x07, 0x80, 0x03, 0xE0, 0xF0, 0x00,
+  0x1E, 0x1F, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3,
+  0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x0F, 0x78, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x1E,
+  0xF0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x00,
+  0x00, 0x78, 0xF8, 0x00, 0x0F, 0x87, 0x80, 0x00, 0xF0, 0x7C, 0x00, 0x1E,
+  0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x40, 0x00, 0x11, 0x80, 0x00, 0x6F,
+  0x00, 0x03, 0xDE, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0x78, 0x07, 0x80, 0xF0,
+  0x3C, 0x01, 0xE1, 0xE0, 0x03, 0xCF, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x3C, 0x00, 0x78, 0x78, 0x03,
+  0xC0, 0xF0, 0x1E, 0x01, 0xE0, 0xF0, 0x03, 0xC7, 0x80, 0x07, 0xBC, 0x00,
+  0x0F, 0x60, 0x00, 0x19, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x7F, 0x81, 0xC0, 0x01, 0xFF, 0xF1, 0xE0, 0x03, 0xFF, 0xFF, 0xE0,
+  0x03, 0xF0, 0x1F, 0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x03, 0xC0, 0x01, 0xF0,
+  0x03, 0xC0, 0x01, 0xF8, 0x03, 0xE0, 0x01, 0xFE, 0x01, 0xE0, 0x01, 0xCF,
+  0x01, 0xE0, 0x03, 0xC7, 0x80, 0xF0, 0x03, 0xC3, 0xC0, 0xF0, 0x03, 0xC1,
+  0xE0, 0x78, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0x78, 0x3C, 0x03, 0xC0,
+  0x3C, 0x1E, 0x03, 0xC0, 0x3C, 0x0F, 0x03, 0x80, 0x1E, 0x07, 0x83, 0x80,
+  0x0F, 0x03, 0xC7, 0x80, 0x0F, 0x01, 0xE7, 0x80, 0x07, 0x80, 0xF7, 0x80,
+  0x07, 0x80, 0x3F, 0x80, 0x07, 0xC0, 0x1F, 0x80, 0x03, 0xC0, 0x0F, 0x80,
+  0x03, 0xC0, 0x07, 0xE0, 0x07, 0xC0, 0x07, 0xFC, 0x0F, 0xC0, 0x07, 0x3F,
+  0xFF, 0xC0, 0x07, 0x0F, 0xFF, 0x80, 0x07, 0x01, 0xFE, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xC3, 0xC0, 0x01, 0xE1,
+  0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x03,
+  0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00,
+  0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E,
+  0x00, 0x07, 0x87, 0x80, 0x01, 0xE1, 0xE0, 0x00, 0xF8, 0x78, 0x00, 0x3C,
+  0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00,
+  0x78, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x0F, 0x01, 0xE0, 0x07, 0xC0, 0x7E,
+  0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x07, 0xC3, 0xC0, 0x01, 0xE1, 0xE0, 0x00, 0x78,
+  0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x03, 0xE1, 0xE0, 0x00,
+  0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0,
+  0x01, 0xF0, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87,
+  0x80, 0x01, 0xE1, 0xE0, 0x00, 0xF8, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x0F,
+  0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x78, 0x3C, 0x00,
+  0x3E, 0x0F, 0x80, 0x0F, 0x01, 0xE0, 0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x0F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x03, 0xF8, 0x00, 0x01, 0xEF, 0x00, 0x00, 0xF1, 0xC0, 0x00, 0x70,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x07, 0xC3, 0xC0, 0x01, 0xE1, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E,
+  0x1E, 0x00, 0x07, 0x87, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00,
+  0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0,
+  0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x01, 0xE1,
+  0xE0, 0x00, 0xF8, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03,
+  0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x3E, 0x0F, 0x80,
+  0x0F, 0x01, 0xE0, 0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x1F, 0x0F,
+  0x00, 0x07, 0x87, 0xC0, 0x01, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xC3,
+  0xC0, 0x01, 0xE1, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x1E, 0x1E, 0x00, 0x07,
+  0x87, 0x80, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00,
+  0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x78, 0x78,
+  0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87, 0x80, 0x01, 0xE1, 0xE0, 0x00, 0xF8,
+  0x78, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x01,
+  0xF0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x0F, 0x01, 0xE0,
+  0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00,
+  0x1F, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+  0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x1F, 0x00,
+  0x1F, 0x87, 0x80, 0x1F, 0x83, 0xE0, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x3C,
+  0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x07, 0x8F, 0x80, 0x03, 0xEF, 0x80, 0x00,
+  0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
+  0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1E,
+  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xFF, 0xC0,
+  0x1F, 0xFF, 0x81, 0xFF, 0xFE, 0x0F, 0x01, 0xF0, 0x78, 0x07, 0xC3, 0xC0,
+  0x1E, 0x1E, 0x00, 0xF1, 0xE0, 0x07, 0x8F, 0x00, 0x3C, 0x78, 0x01, 0xE3,
+  0xC0, 0x1F, 0x3E, 0x00, 0xF1, 0xE0, 0x0F, 0x8F, 0x00, 0xF8, 0x7F, 0xFF,
+  0x83, 0xFF, 0xF8, 0x3F, 0xFE, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xC3, 0xE0, 0x7C, 0x07, 0x83,
+  0xC0, 0x3C, 0x3E, 0x01, 0xE1, 0xE0, 0x3F, 0x0F, 0x07, 0xF8, 0x78, 0x7C,
+  0x03, 0xC7, 0x80, 0x3C, 0x3C, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x78,
+  0xF8, 0x03, 0xC7, 0xE0, 0x3E, 0x1F, 0x81, 0xE0, 0x7E, 0x0F, 0x01, 0xF8,
+  0x78, 0x07, 0xE3, 0xC0, 0x1F, 0x1E, 0x00, 0x79, 0xE0, 0x03, 0xCF, 0x00,
+  0x1E, 0x78, 0x00, 0xF3, 0xC0, 0x0F, 0x1E, 0xC0, 0xF9, 0xF7, 0xFF, 0x8F,
+  0x3F, 0xF8, 0x78, 0xFE, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0xC0, 0x7F, 0xFE, 0x07,
+  0x03, 0xE0, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0x3F, 0xFF, 0xE7, 0xE0, 0x1E,
+  0x78, 0x01, 0xEF, 0x00, 0x3E, 0xF0, 0x03, 0xCF, 0x00, 0x7C, 0xF0, 0x0F,
+  0xCF, 0x83, 0xFC, 0x7F, 0xF7, 0x83, 0xFE, 0x78, 0x1F, 0x87, 0x80, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x70, 0x3E, 0x04, 0x00, 0xF8,
+  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0xFF,
+  0xFC, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0x00, 0xF1, 0xE0, 0x07, 0x9E,
+  0x00, 0x7C, 0xF0, 0x03, 0xC7, 0x80, 0x3E, 0x3C, 0x03, 0xF1, 0xF0, 0x7F,
+  0x87, 0xFF, 0x78, 0x1F, 0xF3, 0xC0, 0x7E, 0x1E, 0x00, 0x00, 0x0E, 0x00,
+  0x01, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0x70, 0x00, 0xE3, 0x80, 0x1C, 0x18,
+  0x03, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xFF,
+  0xC0, 0x7F, 0xFE, 0x07, 0x03, 0xE0, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xE7, 0xE0, 0x1E, 0x78, 0x01, 0xEF, 0x00, 0x3E, 0xF0, 0x03, 0xCF,
+  0x00, 0x7C, 0xF0, 0x0F, 0xCF, 0x83, 0xFC, 0x7F, 0xF7, 0x83, 0xFE, 0x78,
+  0x1F, 0x87, 0x80, 0x00, 0x78, 0x70, 0x0F, 0xC7, 0x01, 0x9E, 0xE0, 0x38,
+  0xFC, 0x03, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x70, 0x3E, 0x08, 0x01, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0xFF,
+  0x0F, 0xFF, 0xF3, 0xFF, 0xFE, 0x7E, 0x01, 0xE7, 0x80, 0x1E, 0xF0, 0x03,
+  0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xCF, 0x00, 0xFC, 0xF8, 0x3F, 0xC7, 0xFF,
+  0x78, 0x3F, 0xE7, 0x81, 0xF8, 0x78, 0x00, 0xF0, 0xF0, 0x1F, 0x0F, 0x01,
+  0xE1, 0xE0, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x70, 0x3E,
+  0x08, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xF3, 0xFF, 0xFE, 0x7E, 0x01, 0xE7, 0x80,
+  0x1E, 0xF0, 0x03, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xCF, 0x00, 0xFC, 0xF8,
+  0x3F, 0xC7, 0xFF, 0x78, 0x3F, 0xE7, 0x81, 0xF8, 0x78, 0x00, 0x1E, 0x00,
+  0x07, 0xF8, 0x00, 0x61, 0x80, 0x0C, 0x0C, 0x00, 0xC0, 0xC0, 0x0C, 0x0C,
+  0x00, 0xC0, 0xC0, 0x06, 0x18, 0x00, 0x7F, 0x80, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x70,
+  0x3E, 0x08, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xF3, 0xFF, 0xFE, 0x7E, 0x01, 0xE7,
+  0x80, 0x1E, 0xF0, 0x03, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xCF, 0x00, 0xFC,
+  0xF8, 0x3F, 0xC7, 0xFF, 0x78, 0x3F, 0xE7, 0x81, 0xF8, 0x78, 0x00, 0x7F,
+  0x00, 0x7E, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x07, 0xFF, 0xE7, 0xFF, 0xC0,
+  0x70, 0x3F, 0xF8, 0x3E, 0x08, 0x00, 0xFE, 0x01, 0xE0, 0x00, 0x07, 0xC0,
+  0x0F, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x00,
+  0x70, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x1E, 0x00,
+  0x00, 0xF0, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x03,
+  0xF0, 0x00, 0x0F, 0x00, 0xFF, 0x80, 0x08, 0xFC, 0x1E, 0x7C, 0x07, 0x87,
+  0xFF, 0xC7, 0xFF, 0xF0, 0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0xFC, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0x87, 0xE0, 0x71, 0xF0,
+  0x04, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x21, 0xF8, 0x1C, 0x1F, 0xFF,
+  0x01, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x0C, 0x00, 0x01, 0xC0,
+  0x00, 0x38, 0x00, 0x07, 0x00, 0x21, 0xE0, 0x07, 0xF8, 0x00, 0xFC, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xE0, 0x03, 0xFF, 0x80, 0x7F, 0xFC, 0x0F, 0x83, 0xE1, 0xF0, 0x1E,
+  0x3E, 0x00, 0xF3, 0xC0, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x87, 0xE0, 0x78, 0x3F,
+  0xFF, 0x01, 0xFF, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07,
+  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xE0,
+  0x0F, 0xFF, 0x80, 0xF8, 0x3E, 0x0F, 0x80, 0xF0, 0xF8, 0x03, 0xC7, 0x80,
+  0x1E, 0x78, 0x00, 0xF3, 0xC0, 0x07, 0x9F, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0xC0, 0x00, 0x1E, 0x00, 0x20, 0xFC, 0x0F, 0x03, 0xFF, 0xF0, 0x0F,
+  0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x3F,
+  0x00, 0x07, 0x70, 0x00, 0xE3, 0x80, 0x1C, 0x18, 0x03, 0x81, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xFF, 0x80, 0x7F, 0xFC, 0x0F,
+  0x83, 0xE1, 0xF0, 0x1E, 0x3E, 0x00, 0xF3, 0xC0, 0x0F, 0x78, 0x00, 0xF7,
+  0x80, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00,
+  0x87, 0xE0, 0x78, 0x3F, 0xFF, 0x01, 0xFF, 0xE0, 0x07, 0xF0, 0x00, 0x00,
+  0xF0, 0xF0, 0x1F, 0x0F, 0x01, 0xE1, 0xE0, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF8,
+  0x07, 0xFF, 0xC0, 0xF8, 0x3E, 0x1F, 0x01, 0xE3, 0xE0, 0x0F, 0x3C, 0x00,
+  0xF7, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0x80, 0x08, 0x7E, 0x07, 0x83, 0xFF, 0xF0, 0x1F, 0xFE, 0x00,
+  0x7F, 0x00, 0x78, 0x1E, 0x07, 0x03, 0xC0, 0xF0, 0x38, 0x0E, 0x00, 0x00,
+  0x00, 0x03, 0xC1, 0xE0, 0xF0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x0F, 0x87, 0x83,
+  0xC0, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x78, 0x00,
+  0xF0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0,
+  0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x78, 0x00,
+  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x00,
+  0x03, 0x80, 0x78, 0x0F, 0xC1, 0xDC, 0x38, 0xE7, 0x06, 0xE0, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xE0, 0x1E, 0x01, 0xE0,
+  0x1E, 0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xC0,
+  0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0xF8, 0x0F, 0x00, 0xF0, 0x00, 0x3C,
+  0x3D, 0xF0, 0xF7, 0x87, 0x9E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x3E, 0x00,
+  0xF0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC1, 0xC0, 0x1E, 0x7E,
+  0x00, 0xFF, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0x00, 0x1E, 0x7C, 0x00, 0x81,
+  0xF0, 0x00, 0x07, 0x80, 0x07, 0xFE, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0,
+  0xF8, 0x1E, 0x0F, 0x00, 0xF8, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x78, 0x00,
+  0xF3, 0xC0, 0x07, 0xBC, 0x00, 0x3D, 0xE0, 0x01, 0xEF, 0x00, 0x1E, 0x78,
+  0x00, 0xF3, 0xC0, 0x07, 0x9E, 0x00, 0x78, 0xF0, 0x07, 0xC3, 0xC0, 0x3C,
+  0x1F, 0x07, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x00,
+  0x1E, 0x1C, 0x00, 0xFC, 0x70, 0x06, 0x7B, 0x80, 0x38, 0xFC, 0x00, 0xE1,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+  0x3C, 0xFF, 0x80, 0xF7, 0xFF, 0x03, 0xF8, 0x7E, 0x1F, 0x80, 0xF8, 0x7C,
+  0x01, 0xE1, 0xF0, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0xF0, 0x03,
+  0xE3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC7,
+  0xC0, 0x1F, 0x1E, 0x00, 0x78, 0x78, 0x01, 0xE1, 0xE0, 0x07, 0x87, 0x80,
+  0x1E, 0x3E, 0x00, 0xF8, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03,
+  0xFF, 0x80, 0x7F, 0xFC, 0x0F, 0x83, 0xE1, 0xE0, 0x1E, 0x3E, 0x01, 0xF3,
+  0xC0, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x78, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x1E, 0xF0, 0x03,
+  0xCF, 0x00, 0x7C, 0x78, 0x07, 0x87, 0xC1, 0xF0, 0x3F, 0xFE, 0x01, 0xFF,
+  0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
+  0xF8, 0x3E, 0x0F, 0x00, 0xF0, 0xF8, 0x07, 0xC7, 0x80, 0x1E, 0x78, 0x00,
+  0xF3, 0xC0, 0x07, 0x9E, 0x00, 0x3D, 0xE0, 0x01, 0xEF, 0x00, 0x0F, 0x78,
+  0x00, 0xF3, 0xC0, 0x07, 0x9E, 0x00, 0x3C, 0xF0, 0x03, 0xC7, 0x80, 0x3E,
+  0x1E, 0x01, 0xE0, 0xF8, 0x3E, 0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x1F,
+  0x80, 0x00, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0x70,
+  0x00, 0xE3, 0x80, 0x1C, 0x18, 0x03, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x03, 0xFF, 0x80, 0x7F, 0xFC, 0x0F, 0x83, 0xE1, 0xE0,
+  0x1E, 0x3E, 0x01, 0xF3, 0xC0, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x78,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1E, 0xF0, 0x01, 0xEF,
+  0x00, 0x1E, 0xF0, 0x03, 0xCF, 0x00, 0x7C, 0x78, 0x07, 0x87, 0xC1, 0xF0,
+  0x3F, 0xFE, 0x01, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x78, 0x70, 0x0F,
+  0xC7, 0x01, 0x9E, 0xE0, 0x38, 0xFC, 0x03, 0x87, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xC0,
+  0xF8, 0x3E, 0x1E, 0x01, 0xE3, 0xE0, 0x1F, 0x3C, 0x00, 0xF7, 0x80, 0x0F,
+  0x78, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
+  0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0xC7, 0x80,
+  0x78, 0x7C, 0x1F, 0x03, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x7E, 0x00, 0x00,
+  0xF0, 0xF0, 0x1F, 0x0F, 0x01, 0xE1, 0xE0, 0x1E, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF8,
+  0x07, 0xFF, 0xC0, 0xF8, 0x3E, 0x1E, 0x01, 0xE3, 0xE0, 0x1F, 0x3C, 0x00,
+  0xF7, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x01, 0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x00, 0x3C, 0xF0,
+  0x07, 0xC7, 0x80, 0x78, 0x7C, 0x1F, 0x03, 0xFF, 0xE0, 0x1F, 0xFC, 0x00,
+  0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3F, 0x87, 0x00, 0xFF, 0xEE, 0x01,
+  0xFF, 0xFC, 0x03, 0xE0, 0xF8, 0x07, 0x80, 0x78, 0x0F, 0x00, 0xFC, 0x0F,
+  0x01, 0xFC, 0x1E, 0x03, 0xBC, 0x1E, 0x07, 0x3C, 0x1C, 0x0E, 0x3C, 0x3C,
+  0x1C, 0x3C, 0x3C, 0x38, 0x3C, 0x3C, 0x70, 0x78, 0x3C, 0xE0, 0x78, 0x3D,
+  0xC0, 0x78, 0x3F, 0x80, 0xF0, 0x3F, 0x01, 0xF0, 0x1E, 0x01, 0xE0, 0x1F,
+  0x07, 0xC0, 0x3F, 0xFF, 0x80, 0x77, 0xFF, 0x00, 0xE1, 0xFC, 0x00, 0xC0,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0, 0x0F,
+  0x9E, 0x00, 0x78, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0,
+  0x0F, 0x9E, 0x00, 0x78, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3,
+  0xC0, 0x0F, 0x9E, 0x00, 0x78, 0xF0, 0x07, 0xC7, 0x80, 0x3E, 0x3E, 0x07,
+  0xF1, 0xF0, 0x77, 0x87, 0xFF, 0x78, 0x1F, 0xF3, 0xC0, 0x7E, 0x1E, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0, 0x0F, 0x9E, 0x00,
+  0x78, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0, 0x0F, 0x9E,
+  0x00, 0x78, 0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xC0, 0x0F,
+  0x9E, 0x00, 0x78, 0xF0, 0x07, 0xC7, 0x80, 0x3E, 0x3E, 0x07, 0xF1, 0xF0,
+  0x77, 0x87, 0xFF, 0x78, 0x1F, 0xF3, 0xC0, 0x7E, 0x1E, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xEE, 0x00, 0x0E, 0x38, 0x00,
+  0xE0, 0xC0, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0, 0x0F, 0x9E, 0x00, 0x78, 0xF0,
+  0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xE0, 0x0F, 0x9E, 0x00, 0x78,
+  0xF0, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF3, 0xC0, 0x0F, 0x9E, 0x00,
+  0x78, 0xF0, 0x07, 0xC7, 0x80, 0x3E, 0x3E, 0x07, 0xF1, 0xF0, 0x77, 0x87,
+  0xFF, 0x78, 0x1F, 0xF3, 0xC0, 0x7E, 0x1E, 0x00, 0x00, 0xF0, 0xF0, 0x0F,
+  0x87, 0x80, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC7, 0x80,
+  0x1E, 0x7C, 0x01, 0xF3, 0xC0, 0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x03, 0xC7,
+  0x80, 0x1E, 0x7C, 0x01, 0xF3, 0xC0, 0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x03,
+  0xC7, 0x80, 0x1E, 0x78, 0x01, 0xF3, 0xC0, 0x0F, 0x1E, 0x00, 0xF8, 0xF0,
+  0x07, 0xC7, 0xC0, 0xFE, 0x3E, 0x0E, 0xF0, 0xFF, 0xEF, 0x03, 0xFE, 0x78,
+  0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x70, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F,
+  0x0F, 0x00, 0x3E, 0x0F, 0x00, 0x3E, 0x07, 0x80, 0x7C, 0x07, 0x80, 0x78,
+  0x07, 0x80, 0xF8, 0x07, 0x81, 0xF0, 0x07, 0xC1, 0xF0, 0x03, 0xC3, 0xE0,
+  0x03, 0xC3, 0xC0, 0x03, 0xC7, 0xC0, 0x03, 0xC7, 0x80, 0x01, 0xEF, 0x80,
+  0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
+  0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x07,
+  0xC7, 0xE0, 0x0F, 0x3F, 0xF0, 0x1E, 0xFF, 0xE0, 0x3F, 0x83, 0xE0, 0x7E,
+  0x03, 0xC1, 0xF8, 0x07, 0xC3, 0xE0, 0x07, 0x87, 0xC0, 0x0F, 0x0F, 0x00,
+  0x1E, 0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x78, 0xF8, 0x00, 0xF1, 0xE0, 0x03,
+  0xC3, 0xC0, 0x07, 0x87, 0x80, 0x0F, 0x0F, 0x00, 0x3C, 0x3F, 0x00, 0xF8,
+  0x7E, 0x03, 0xE0, 0xFE, 0x0F, 0x81, 0xEF, 0xFE, 0x03, 0xCF, 0xF8, 0x07,
+  0x8F, 0xC0, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x3E, 0x1E, 0x00, 0x3C, 0x3C, 0x00,
+  0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x0F, 0x00, 0x3E, 0x0F,
+  0x00, 0x3E, 0x07, 0x80, 0x7C, 0x07, 0x80, 0x78, 0x07, 0x80, 0xF8, 0x07,
+  0x81, 0xF0, 0x07, 0xC1, 0xF0, 0x03, 0xC3, 0xE0, 0x03, 0xC3, 0xC0, 0x03,
+  0xC7, 0xC0, 0x03, 0xC7, 0x80, 0x01, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x01,
+  0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
+  0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique20pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,  10,  28,  16,    3,  -27 },   // 0x21 '!'
+  {    36,  10,  11,  18,    4,  -27 },   // 0x22 '"'
+  {    50,  27,  28,  33,    3,  -27 },   // 0x23 '#'
+  {   145,  21,  35,  25,    1,  -28 },   // 0x24 '$'
+  {   237,  30,  29,  37,    4,  -28 },   // 0x25 '%'
+  {   346,  27,  29,  30,    2,  -28 },   // 0x26 '&'
+  {   444,   3,  11,  11,    4,  -27 },   // 0x27 '''
+  {   449,  14,  35,  15,    3,  -29 },   // 0x28 '('
+  {   511,  14,  35,  15,   -2,  -29 },   // 0x29 ')'
+  {   573,  16,  18,  20,    2,  -28 },   // 0x2A '*'
+  {   609,  25,  25,  33,    4,  -24 },   // 0x2B '+'
+  {   688,   8,   9,  12,    0,   -4 },   // 0x2C ','
+  {   697,  11,   4,  14,    2,  -11 },   // 0x2D '-'
+  {   703,   5,   5,  12,    2,   -4 },   // 0x2E '.'
+  {   707,  19,  32,  13,   -3,  -27 },   // 0x2F '/'
+  {   783,  21,  29,  25,    3,  -28 },   // 0x30 '0'
+  {   860,  17,  28,  25,    2,  -27 },   // 0x31 '1'
+  {   920,  23,  29,  25,    0,  -28 },   // 0x32 '2'
+  {  1004,  22,  29,  25,    0,  -28 },   // 0x33 '3'
+  {  1084,  21,  28,  25,    1,  -27 },   // 0x34 '4'
+  {  1158,  22,  28,  25,    1,  -27 },   // 0x35 '5'
+  {  1235,  20,  29,  25,    3,  -28 },   // 0x36 '6'
+  {  1308,  21,  28,  25,    4,  -27 },   // 0x37 '7'
+  {  1382,  22,  29,  25,    1,  -28 },   // 0x38 '8'
+  {  1462,  21,  29,  25,    1,  -28 },   // 0x39 '9'
+  {  1539,   8,  20,  13,    2,  -19 },   // 0x3A ':'
+  {  1559,  11,  24,  13,   -1,  -19 },   // 0x3B ';'
+  {  1592,  24,  21,  33,    4,  -22 },   // 0x3C '<'
+  {  1655,  24,  11,  33,    4,  -17 },   // 0x3D '='
+  {  1688,  24,  21,  33,    4,  -22 },   // 0x3E '>'
+  {  1751,  15,  29,  21,    5,  -28 },   // 0x3F '?'
+  {  1806,  35,  34,  39,    2,  -26 },   // 0x40 '@'
+  {  1955,  26,  28,  27,   -2,  -27 },   // 0x41 'A'
+  {  2046,  23,  28,  27,    1,  -27 },   // 0x42 'B'
+  {  2127,  25,  29,  27,    2,  -28 },   // 0x43 'C'
+  {  2218,  27,  28,  30,    1,  -27 },   // 0x44 'D'
+  {  2313,  24,  28,  25,    1,  -27 },   // 0x45 'E'
+  {  2397,  22,  28,  22,    1,  -27 },   // 0x46 'F'
+  {  2474,  27,  29,  30,    2,  -28 },   // 0x47 'G'
+  {  2572,  27,  28,  29,    1,  -27 },   // 0x48 'H'
+  {  2667,  10,  28,  12,    1,  -27 },   // 0x49 'I'
+  {  2702,  17,  36,  12,   -6,  -27 },   // 0x4A 'J'
+  {  2779,  27,  28,  26,    1,  -27 },   // 0x4B 'K'
+  {  2874,  18,  28,  22,    1,  -27 },   // 0x4C 'L'
+  {  2937,  32,  28,  34,    1,  -27 },   // 0x4D 'M'
+  {  3049,  27,  28,  29,    1,  -27 },   // 0x4E 'N'
+  {  3144,  28,  29,  31,    2,  -28 },   // 0x4F 'O'
+  {  3246,  22,  28,  24,    1,  -27 },   // 0x50 'P'
+  {  3323,  28,  34,  31,    2,  -28 },   // 0x51 'Q'
+  {  3442,  22,  28,  27,    1,  -27 },   // 0x52 'R'
+  {  3519,  23,  29,  25,    1,  -28 },   // 0x53 'S'
+  {  3603,  26,  28,  24,    2,  -27 },   // 0x54 'T'
+  {  3694,  26,  28,  29,    2,  -27 },   // 0x55 'U'
+  {  3785,  26,  28,  27,    3,  -27 },   // 0x56 'V'
+  {  3876,  36,  28,  39,    4,  -27 },   // 0x57 'W'
+  {  4002,  29,  28,  27,   -2,  -27 },   // 0x58 'X'
+  {  4104,  25,  28,  24,    2,  -27 },   // 0x59 'Y'
+  {  4192,  28,  28,  27,   -1,  -27 },   // 0x5A 'Z'
+  {  4290,  15,  35,  15,    2,  -29 },   // 0x5B '['
+  {  4356,   7,  32,  13,    3,  -27 },   // 0x5C '\'
+  {  4384,  15,  35,  15,   -1,  -29 },   // 0x5D ']'
+  {  4450,  24,  11,  33,    4,  -27 },   // 0x5E '^'
+  {  4483,  20,   3,  20,    0,    7 },   // 0x5F '_'
+  {  4491,   8,   7,  20,    7,  -30 },   // 0x60 '`'
+  {  4498,  20,  22,  24,    2,  -21 },   // 0x61 'a'
+  {  4553,  21,  30,  25,    1,  -29 },   // 0x62 'b'
+  {  4632,  19,  22,  21,    2,  -21 },   // 0x63 'c'
+  {  4685,  23,  30,  25,    2,  -29 },   // 0x64 'd'
+  {  4772,  20,  22,  24,    2,  -21 },   // 0x65 'e'
+  {  4827,  16,  30,  14,    3,  -29 },   // 0x66 'f'
+  {  4887,  22,  30,  25,    1,  -21 },   // 0x67 'g'
+  {  4970,  21,  30,  25,    1,  -29 },   // 0x68 'h'
+  {  5049,  10,  30,  11,    1,  -29 },   // 0x69 'i'
+  {  5087,  16,  38,  11,   -4,  -29 },   // 0x6A 'j'
+  {  5163,  22,  30,  23,    1,  -29 },   // 0x6B 'k'
+  {  5246,  10,  30,  11,    1,  -29 },   // 0x6C 'l'
+  {  5284,  34,  22,  38,    1,  -21 },   // 0x6D 'm'
+  {  5378,  21,  22,  25,    1,  -21 },   // 0x6E 'n'
+  {  5436,  20,  22,  24,    2,  -21 },   // 0x6F 'o'
+  {  5491,  23,  30,  25,    0,  -21 },   // 0x70 'p'
+  {  5578,  22,  30,  25,    2,  -21 },   // 0x71 'q'
+  {  5661,  17,  22,  16,    1,  -21 },   // 0x72 'r'
+  {  5708,  19,  22,  20,    1,  -21 },   // 0x73 's'
+  {  5761,  14,  27,  15,    3,  -26 },   // 0x74 't'
+  {  5809,  21,  21,  25,    2,  -20 },   // 0x75 'u'
+  {  5865,  21,  21,  23,    3,  -20 },   // 0x76 'v'
+  {  5921,  29,  21,  32,    3,  -20 },   // 0x77 'w'
+  {  5998,  24,  21,  23,   -1,  -20 },   // 0x78 'x'
+  {  6061,  24,  29,  23,   -1,  -20 },   // 0x79 'y'
+  {  6148,  21,  21,  20,    0,  -20 },   // 0x7A 'z'
+  {  6204,  19,  36,  25,    5,  -29 },   // 0x7B '{'
+  {  6290,   3,  39,  13,    5,  -29 },   // 0x7C '|'
+  {  6305,  19,  36,  25,    0,  -29 },   // 0x7D '}'
+  {  6391,  24,   6,  33,    4,  -14 },   // 0x7E '~'
+  {  6409,  20,  34,  23,    2,  -27 },   // 0x7F
+  {  6494,  20,  34,  23,    2,  -27 },   // 0x80
+  {  6579,  20,  34,  23,    2,  -27 },   // 0x81
+  {  6664,  20,  34,  23,    2,  -27 },   // 0x82
+  {  6749,  20,  34,  23,    2,  -27 },   // 0x83
+  {  6834,  20,  34,  23,    2,  -27 },   // 0x84
+  {  6919,  20,  34,  23,    2,  -27 },   // 0x85
+  {  7004,  20,  34,  23,    2,  -27 },   // 0x86
+  {  7089,  20,  34,  23,    2,  -27 },   // 0x87
+  {  7174,  20,  34,  23,    2,  -27 },   // 0x88
+  {  7259,  20,  34,  23,    2,  -27 },   // 0x89
+  {  7344,  20,  34,  23,    2,  -27 },   // 0x8A
+  {  7429,  20,  34,  23,    2,  -27 },   // 0x8B
+  {  7514,  20,  34,  23,    2,  -27 },   // 0x8C
+  {  7599,  20,  34,  23,    2,  -27 },   // 0x8D
+  {  7684,  20,  34,  23,    2,  -27 },   // 0x8E
+  {  7769,  20,  34,  23,    2,  -27 },   // 0x8F
+  {  7854,  20,  34,  23,    2,  -27 },   // 0x90
+  {  7939,  20,  34,  23,    2,  -27 },   // 0x91
+  {  8024,  20,  34,  23,    2,  -27 },   // 0x92
+  {  8109,  20,  34,  23,    2,  -27 },   // 0x93
+  {  8194,  20,  34,  23,    2,  -27 },   // 0x94
+  {  8279,  20,  34,  23,    2,  -27 },   // 0x95
+  {  8364,  20,  34,  23,    2,  -27 },   // 0x96
+  {  8449,  20,  34,  23,    2,  -27 },   // 0x97
+  {  8534,  20,  34,  23,    2,  -27 },   // 0x98
+  {  8619,  20,  34,  23,    2,  -27 },   // 0x99
+  {  8704,  20,  34,  23,    2,  -27 },   // 0x9A
+  {  8789,  20,  34,  23,    2,  -27 },   // 0x9B
+  {  8874,  20,  34,  23,    2,  -27 },   // 0x9C
+  {  8959,  20,  34,  23,    2,  -27 },   // 0x9D
+  {  9044,  20,  34,  23,    2,  -27 },   // 0x9E
+  {  9129,  20,  34,  23,    2,  -27 },   // 0x9F
+  {  9214,   1,   1,  12,    0,    0 },   // 0xA0
+  {  9215,  10,  28,  16,    3,  -20 },   // 0xA1
+  {  9250,  19,  32,  25,    3,  -26 },   // 0xA2
+  {  9326,  24,  29,  25,    1,  -28 },   // 0xA3
+  {  9413,  22,  22,  25,    1,  -22 },   // 0xA4
+  {  9474,  24,  28,  25,    2,  -27 },   // 0xA5
+  {  9558,   3,  33,  13,    5,  -26 },   // 0xA6
+  {  9571,  20,  33,  20,   -1,  -28 },   // 0xA7
+  {  9654,  13,   4,  20,    7,  -29 },   // 0xA8
+  {  9661,  28,  28,  39,    5,  -27 },   // 0xA9
+  {  9759,  16,  20,  18,    2,  -28 },   // 0xAA
+  {  9799,  20,  17,  24,    2,  -19 },   // 0xAB
+  {  9842,  24,  11,  33,    4,  -15 },   // 0xAC
+  {  9875,  11,   4,  14,    2,  -11 },   // 0xAD
+  {  9881,  28,  28,  39,    5,  -27 },   // 0xAE
+  {  9979,  12,   3,  19,    7,  -28 },   // 0xAF
+  {  9984,  12,  12,  20,    4,  -28 },   // 0xB0
+  { 10002,  25,  24,  33,    4,  -23 },   // 0xB1
+  { 10077,  15,  16,  16,    1,  -28 },   // 0xB2
+  { 10107,  14,  16,  16,    1,  -28 },   // 0xB3
+  { 10135,  11,   7,  20,   10,  -30 },   // 0xB4
+  { 10145,  24,  29,  25,   -1,  -20 },   // 0xB5
+  { 10232,  20,  32,  25,    3,  -27 },   // 0xB6
+  { 10312,   5,   5,  12,    4,  -15 },   // 0xB7
+  { 10316,   9,   8,  20,    1,    1 },   // 0xB8
+  { 10325,  11,  16,  16,    3,  -28 },   // 0xB9
+  { 10347,  16,  20,  18,    2,  -28 },   // 0xBA
+  { 10387,  20,  17,  24,    2,  -19 },   // 0xBB
+  { 10430,  35,  29,  38,    3,  -28 },   // 0xBC
+  { 10557,  35,  29,  38,    3,  -28 },   // 0xBD
+  { 10684,  37,  29,  38,    1,  -28 },   // 0xBE
+  { 10819,  15,  29,  21,    1,  -20 },   // 0xBF
+  { 10874,  26,  36,  27,   -2,  -35 },   // 0xC0
+  { 10991,  26,  36,  27,   -2,  -35 },   // 0xC1
+  { 11108,  26,  36,  27,   -2,  -35 },   // 0xC2
+  { 11225,  27,  36,  27,   -2,  -35 },   // 0xC3
+  { 11347,  26,  36,  27,   -2,  -35 },   // 0xC4
+  { 11464,  26,  36,  27,   -2,  -35 },   // 0xC5
+  { 11581,  41,  28,  38,   -2,  -27 },   // 0xC6
+  { 11725,  25,  37,  27,    2,  -28 },   // 0xC7
+  { 11841,  24,  36,  25,    1,  -35 },   // 0xC8
+  { 11949,  24,  36,  25,    1,  -35 },   // 0xC9
+  { 12057,  24,  36,  25,    1,  -35 },   // 0xCA
+  { 12165,  24,  36,  25,    1,  -35 },   // 0xCB
+  { 12273,  10,  36,  12,    1,  -35 },   // 0xCC
+  { 12318,  14,  36,  12,    1,  -35 },   // 0xCD
+  { 12381,  14,  36,  12,    1,  -35 },   // 0xCE
+  { 12444,  15,  36,  12,    1,  -35 },   // 0xCF
+  { 12512,  28,  28,  30,    0,  -27 },   // 0xD0
+  { 12610,  27,  36,  29,    1,  -35 },   // 0xD1
+  { 12732,  28,  36,  31,    2,  -35 },   // 0xD2
+  { 12858,  28,  36,  31,    2,  -35 },   // 0xD3
+  { 12984,  28,  36,  31,    2,  -35 },   // 0xD4
+  { 13110,  28,  36,  31,    2,  -35 },   // 0xD5
+  { 13236,  28,  36,  31,    2,  -35 },   // 0xD6
+  { 13362,  22,  22,  33,    5,  -22 },   // 0xD7
+  { 13423,  33,  31,  31,   -1,  -29 },   // 0xD8
+  { 13551,  26,  36,  29,    2,  -35 },   // 0xD9
+  { 13668,  26,  36,  29,    2,  -35 },   // 0xDA
+  { 13785,  26,  36,  29,    2,  -35 },   // 0xDB
+  { 13902,  26,  36,  29,    2,  -35 },   // 0xDC
+  { 14019,  25,  36,  24,    2,  -35 },   // 0xDD
+  { 14132,  21,  28,  24,    1,  -27 },   // 0xDE
+  { 14206,  21,  30,  25,    2,  -29 },   // 0xDF
+  { 14285,  20,  31,  24,    2,  -30 },   // 0xE0
+  { 14363,  21,  31,  24,    2,  -30 },   // 0xE1
+  { 14445,  20,  31,  24,    2,  -30 },   // 0xE2
+  { 14523,  20,  30,  24,    2,  -29 },   // 0xE3
+  { 14598,  20,  30,  24,    2,  -29 },   // 0xE4
+  { 14673,  20,  34,  24,    2,  -33 },   // 0xE5
+  { 14758,  36,  22,  39,    2,  -21 },   // 0xE6
+  { 14857,  19,  30,  21,    2,  -21 },   // 0xE7
+  { 14929,  20,  31,  24,    2,  -30 },   // 0xE8
+  { 15007,  21,  31,  24,    2,  -30 },   // 0xE9
+  { 15089,  20,  31,  24,    2,  -30 },   // 0xEA
+  { 15167,  20,  30,  24,    2,  -29 },   // 0xEB
+  { 15242,   9,  31,  11,    1,  -30 },   // 0xEC
+  { 15277,  15,  31,  11,    1,  -30 },   // 0xED
+  { 15336,  12,  31,  11,    1,  -30 },   // 0xEE
+  { 15383,  14,  30,  11,    1,  -29 },   // 0xEF
+  { 15436,  21,  30,  24,    2,  -29 },   // 0xF0
+  { 15515,  22,  30,  25,    1,  -29 },   // 0xF1
+  { 15598,  20,  31,  24,    2,  -30 },   // 0xF2
+  { 15676,  21,  31,  24,    2,  -30 },   // 0xF3
+  { 15758,  20,  31,  24,    2,  -30 },   // 0xF4
+  { 15836,  20,  30,  24,    2,  -29 },   // 0xF5
+  { 15911,  20,  30,  24,    2,  -29 },   // 0xF6
+  { 15986,  25,  19,  33,    4,  -21 },   // 0xF7
+  { 16046,  24,  24,  24,    0,  -22 },   // 0xF8
+  { 16118,  21,  31,  25,    2,  -30 },   // 0xF9
+  { 16200,  21,  31,  25,    2,  -30 },   // 0xFA
+  { 16282,  21,  31,  25,    2,  -30 },   // 0xFB
+  { 16364,  21,  30,  25,    2,  -29 },   // 0xFC
+  { 16443,  24,  39,  23,   -1,  -30 },   // 0xFD
+  { 16560,  23,  38,  25,    0,  -29 },   // 0xFE
+  { 16670,  24,  38,  23,   -1,  -29 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique20pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique20pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique20pt8bGlyphs,
+  0x20, 0xFF, 46 };
+
+// Approx. 18359 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique20pt8bMetrics[] PROGMEM = {
+  {   0,  12,   1 },   // 0x20
+  {   3,  16,  13 },   // 0x21
+  {   4,  18,  14 },   // 0x22
+  {   3,  33,  30 },   // 0x23
+  {   1,  25,  22 },   // 0x24
+  {   4,  37,  34 },   // 0x25
+  {   2,  30,  29 },   // 0x26
+  {   4,  11,   7 },   // 0x27
+  {   3,  15,  17 },   // 0x28
+  {  -2,  15,  12 },   // 0x29
+  {   2,  20,  18 },   // 0x2A
+  {   4,  33,  29 },   // 0x2B
+  {   0,  12,   8 },   // 0x2C
+  {   2,  14,  13 },   // 0x2D
+  {   2,  12,   7 },   // 0x2E
+  {  -3,  13,  16 },   // 0x2F
+  {   3,  25,  24 },   // 0x30
+  {   2,  25,  19 },   // 0x31
+  {   0,  25,  23 },   // 0x32
+  {   0,  25,  22 },   // 0x33
+  {   1,  25,  22 },   // 0x34
+  {   1,  25,  23 },   // 0x35
+  {   3,  25,  23 },   // 0x36
+  {   4,  25,  25 },   // 0x37
+  {   1,  25,  23 },   // 0x38
+  {   1,  25,  22 },   // 0x39
+  {   2,  13,  10 },   // 0x3A
+  {  -1,  13,  10 },   // 0x3B
+  {   4,  33,  28 },   // 0x3C
+  {   4,  33,  28 },   // 0x3D
+  {   4,  33,  28 },   // 0x3E
+  {   5,  21,  20 },   // 0x3F
+  {   2,  39,  37 },   // 0x40
+  {  -2,  27,  24 },   // 0x41
+  {   1,  27,  24 },   // 0x42
+  {   2,  27,  27 },   // 0x43
+  {   1,  30,  28 },   // 0x44
+  {   1,  25,  25 },   // 0x45
+  {   1,  22,  23 },   // 0x46
+  {   2,  30,  29 },   // 0x47
+  {   1,  29,  28 },   // 0x48
+  {   1,  12,  11 },   // 0x49
+  {  -6,  12,  11 },   // 0x4A
+  {   1,  26,  28 },   // 0x4B
+  {   1,  22,  19 },   // 0x4C
+  {   1,  34,  33 },   // 0x4D
+  {   1,  29,  28 },   // 0x4E
+  {   2,  31,  30 },   // 0x4F
+  {   1,  24,  23 },   // 0x50
+  {   2,  31,  30 },   // 0x51
+  {   1,  27,  23 },   // 0x52
+  {   1,  25,  24 },   // 0x53
+  {   2,  24,  28 },   // 0x54
+  {   2,  29,  28 },   // 0x55
+  {   3,  27,  29 },   // 0x56
+  {   4,  39,  40 },   // 0x57
+  {  -2,  27,  27 },   // 0x58
+  {   2,  24,  27 },   // 0x59
+  {  -1,  27,  27 },   // 0x5A
+  {   2,  15,  17 },   // 0x5B
+  {   3,  13,  10 },   // 0x5C
+  {  -1,  15,  14 },   // 0x5D
+  {   4,  33,  28 },   // 0x5E
+  {   0,  20,  20 },   // 0x5F
+  {   7,  20,  15 },   // 0x60
+  {   2,  24,  22 },   // 0x61
+  {   1,  25,  22 },   // 0x62
+  {   2,  21,  21 },   // 0x63
+  {   2,  25,  25 },   // 0x64
+  {   2,  24,  22 },   // 0x65
+  {   3,  14,  19 },   // 0x66
+  {   1,  25,  23 },   // 0x67
+  {   1,  25,  22 },   // 0x68
+  {   1,  11,  11 },   // 0x69
+  {  -4,  11,  12 },   // 0x6A
+  {   1,  23,  23 },   // 0x6B
+  {   1,  11,  11 },   // 0x6C
+  {   1,  38,  35 },   // 0x6D
+  {   1,  25,  22 },   // 0x6E
+  {   2,  24,  22 },   // 0x6F
+  {   0,  25,  23 },   // 0x70
+  {   2,  25,  24 },   // 0x71
+  {   1,  16,  18 },   // 0x72
+  {   1,  20,  20 },   // 0x73
+  {   3,  15,  17 },   // 0x74
+  {   2,  25,  23 },   // 0x75
+  {   3,  23,  24 },   // 0x76
+  {   3,  32,  32 },   // 0x77
+  {  -1,  23,  23 },   // 0x78
+  {  -1,  23,  23 },   // 0x79
+  {   0,  20,  21 },   // 0x7A
+  {   5,  25,  24 },   // 0x7B
+  {   5,  13,   8 },   // 0x7C
+  {   0,  25,  19 },   // 0x7D
+  {   4,  33,  28 },   // 0x7E
+  {   2,  23,  22 },   // 0x7F
+  {   2,  23,  22 },   // 0x80
+  {   2,  23,  22 },   // 0x81
+  {   2,  23,  22 },   // 0x82
+  {   2,  23,  22 },   // 0x83
+  {   2,  23,  22 },   // 0x84
+  {   2,  23,  22 },   // 0x85
+  {   2,  23,  22 },   // 0x86
+  {   2,  23,  22 },   // 0x87
+  {   2,  23,  22 },   // 0x88
+  {   2,  23,  22 },   // 0x89
+  {   2,  23,  22 },   // 0x8A
+  {   2,  23,  22 },   // 0x8B
+  {   2,  23,  22 },   // 0x8C
+  {   2,  23,  22 },   // 0x8D
+  {   2,  23,  22 },   // 0x8E
+  {   2,  23,  22 },   // 0x8F
+  {   2,  23,  22 },   // 0x90
+  {   2,  23,  22 },   // 0x91
+  {   2,  23,  22 },   // 0x92
+  {   2,  23,  22 },   // 0x93
+  {   2,  23,  22 },   // 0x94
+  {   2,  23,  22 },   // 0x95
+  {   2,  23,  22 },   // 0x96
+  {   2,  23,  22 },   // 0x97
+  {   2,  23,  22 },   // 0x98
+  {   2,  23,  22 },   // 0x99
+  {   2,  23,  22 },   // 0x9A
+  {   2,  23,  22 },   // 0x9B
+  {   2,  23,  22 },   // 0x9C
+  {   2,  23,  22 },   // 0x9D
+  {   2,  23,  22 },   // 0x9E
+  {   2,  23,  22 },   // 0x9F
+  {   0,  12,   1 },   // 0xA0
+  {   3,  16,  13 },   // 0xA1
+  {   3,  25,  22 },   // 0xA2
+  {   1,  25,  25 },   // 0xA3
+  {   1,  25,  23 },   // 0xA4
+  {   2,  25,  26 },   // 0xA5
+  {   5,  13,   8 },   // 0xA6
+  {  -1,  20,  19 },   // 0xA7
+  {   7,  20,  20 },   // 0xA8
+  {   5,  39,  33 },   // 0xA9
+  {   2,  18,  18 },   // 0xAA
+  {   2,  24,  22 },   // 0xAB
+  {   4,  33,  28 },   // 0xAC
+  {   2,  14,  13 },   // 0xAD
+  {   5,  39,  33 },   // 0xAE
+  {   7,  19,  19 },   // 0xAF
+  {   4,  20,  16 },   // 0xB0
+  {   4,  33,  29 },   // 0xB1
+  {   1,  16,  16 },   // 0xB2
+  {   1,  16,  15 },   // 0xB3
+  {  10,  20,  21 },   // 0xB4
+  {  -1,  25,  23 },   // 0xB5
+  {   3,  25,  23 },   // 0xB6
+  {   4,  12,   9 },   // 0xB7
+  {   1,  20,  10 },   // 0xB8
+  {   3,  16,  14 },   // 0xB9
+  {   2,  18,  18 },   // 0xBA
+  {   2,  24,  22 },   // 0xBB
+  {   3,  38,  38 },   // 0xBC
+  {   3,  38,  38 },   // 0xBD
+  {   1,  38,  38 },   // 0xBE
+  {   1,  21,  16 },   // 0xBF
+  {  -2,  27,  24 },   // 0xC0
+  {  -2,  27,  24 },   // 0xC1
+  {  -2,  27,  24 },   // 0xC2
+  {  -2,  27,  25 },   // 0xC3
+  {  -2,  27,  24 },   // 0xC4
+  {  -2,  27,  24 },   // 0xC5
+  {  -2,  38,  39 },   // 0xC6
+  {   2,  27,  27 },   // 0xC7
+  {   1,  25,  25 },   // 0xC8
+  {   1,  25,  25 },   // 0xC9
+  {   1,  25,  25 },   // 0xCA
+  {   1,  25,  25 },   // 0xCB
+  {   1,  12,  11 },   // 0xCC
+  {   1,  12,  15 },   // 0xCD
+  {   1,  12,  15 },   // 0xCE
+  {   1,  12,  16 },   // 0xCF
+  {   0,  30,  28 },   // 0xD0
+  {   1,  29,  28 },   // 0xD1
+  {   2,  31,  30 },   // 0xD2
+  {   2,  31,  30 },   // 0xD3
+  {   2,  31,  30 },   // 0xD4
+  {   2,  31,  30 },   // 0xD5
+  {   2,  31,  30 },   // 0xD6
+  {   5,  33,  27 },   // 0xD7
+  {  -1,  31,  32 },   // 0xD8
+  {   2,  29,  28 },   // 0xD9
+  {   2,  29,  28 },   // 0xDA
+  {   2,  29,  28 },   // 0xDB
+  {   2,  29,  28 },   // 0xDC
+  {   2,  24,  27 },   // 0xDD
+  {   1,  24,  22 },   // 0xDE
+  {   2,  25,  23 },   // 0xDF
+  {   2,  24,  22 },   // 0xE0
+  {   2,  24,  23 },   // 0xE1
+  {   2,  24,  22 },   // 0xE2
+  {   2,  24,  22 },   // 0xE3
+  {   2,  24,  22 },   // 0xE4
+  {   2,  24,  22 },   // 0xE5
+  {   2,  39,  38 },   // 0xE6
+  {   2,  21,  21 },   // 0xE7
+  {   2,  24,  22 },   // 0xE8
+  {   2,  24,  23 },   // 0xE9
+  {   2,  24,  22 },   // 0xEA
+  {   2,  24,  22 },   // 0xEB
+  {   1,  11,  10 },   // 0xEC
+  {   1,  11,  16 },   // 0xED
+  {   1,  11,  13 },   // 0xEE
+  {   1,  11,  15 },   // 0xEF
+  {   2,  24,  23 },   // 0xF0
+  {   1,  25,  23 },   // 0xF1
+  {   2,  24,  22 },   // 0xF2
+  {   2,  24,  23 },   // 0xF3
+  {   2,  24,  22 },   // 0xF4
+  {   2,  24,  22 },   // 0xF5
+  {   2,  24,  22 },   // 0xF6
+  {   4,  33,  29 },   // 0xF7
+  {   0,  24,  24 },   // 0xF8
+  {   2,  25,  23 },   // 0xF9
+  {   2,  25,  23 },   // 0xFA
+  {   2,  25,  23 },   // 0xFB
+  {   2,  25,  23 },   // 0xFC
+  {  -1,  23,  23 },   // 0xFD
+  {   0,  25,  23 },   // 0xFE
+  {  -1,  23,  23 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique20pt8bWidths = { DejaVuSans_Oblique20pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE20PTLAT1__H
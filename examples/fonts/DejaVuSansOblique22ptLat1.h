@@ -0,0 +1,2175 @@
+#ifndef DEJAVUSANSOBLIQUE22PTLAT1__H
+#define DEJAVUSANSOBLIQUE22PTLAT1__H
+const uint8_t DejaVuSans_Oblique22pt8bBitmaps[] PROGMEM = {
+  0x00, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0,
+  0xF8, 0x3C, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x0F,
+  0x03, 0x80, 0x00, 0x38, 0x1E, 0x00, 0x00, 0xE0, 0x78, 0x00, 0x07, 0x81,
+  0xC0, 0x00, 0x1E, 0x07, 0x00, 0x00, 0x70, 0x3C, 0x00, 0x01, 0xC0, 0xF0,
+  0x00, 0x07, 0x03, 0x80, 0x00, 0x3C, 0x0E, 0x00, 0x7F, 0xFF, 0xFF, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x1C, 0x00, 0x01,
+  0xC0, 0xF0, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0xF0,
+  0x38, 0x00, 0x03, 0x81, 0xE0, 0x00, 0x0E, 0x07, 0x80, 0x1F, 0xFF, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0x0F, 0x00,
+  0x00, 0x70, 0x38, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0x0E, 0x07, 0x80, 0x00,
+  0x38, 0x1E, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x07, 0x81, 0xC0, 0x00, 0x1C,
+  0x07, 0x00, 0x00, 0x70, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00, 0x07, 0xFE,
+  0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x07, 0xE6, 0x3C, 0x1F, 0x0C, 0x08,
+  0x3C, 0x30, 0x00, 0xF0, 0x60, 0x01, 0xE0, 0xC0, 0x03, 0xC1, 0x80, 0x07,
+  0x83, 0x00, 0x0F, 0x8C, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x0F,
+  0xFF, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x3F, 0x00, 0x0C,
+  0x3E, 0x00, 0x18, 0x3C, 0x00, 0x30, 0x78, 0x00, 0x60, 0xF0, 0x01, 0x81,
+  0xE4, 0x03, 0x07, 0x8E, 0x06, 0x1F, 0x1F, 0x0C, 0xFC, 0x3F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x0E, 0x07, 0xFC, 0x00, 0x0E, 0x07, 0xFF, 0x00, 0x0F,
+  0x07, 0x87, 0x80, 0x0F, 0x07, 0x81, 0xE0, 0x0F, 0x03, 0x80, 0x70, 0x07,
+  0x03, 0xC0, 0x38, 0x07, 0x01, 0xC0, 0x1C, 0x07, 0x00, 0xE0, 0x0E, 0x07,
+  0x80, 0x70, 0x07, 0x07, 0x80, 0x38, 0x07, 0x83, 0x80, 0x1C, 0x03, 0x83,
+  0x80, 0x0F, 0x03, 0xC3, 0x80, 0x03, 0xC3, 0xC3, 0xC0, 0x01, 0xFF, 0xC3,
+  0xC0, 0x00, 0x7F, 0xC3, 0xC1, 0xF0, 0x1F, 0x81, 0xC3, 0xFE, 0x00, 0x01,
+  0xC3, 0xFF, 0x80, 0x01, 0xC3, 0xC3, 0xC0, 0x01, 0xE3, 0xC0, 0xF0, 0x01,
+  0xE1, 0xC0, 0x38, 0x00, 0xE1, 0xE0, 0x1C, 0x00, 0xE0, 0xE0, 0x0E, 0x00,
+  0xE0, 0x70, 0x07, 0x00, 0xF0, 0x38, 0x03, 0x80, 0xF0, 0x1C, 0x03, 0xC0,
+  0xF0, 0x0E, 0x01, 0xC0, 0x70, 0x07, 0x81, 0xE0, 0x70, 0x01, 0xE1, 0xE0,
+  0x70, 0x00, 0xFF, 0xE0, 0x78, 0x00, 0x3F, 0xE0, 0x78, 0x00, 0x07, 0xC0,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x3E, 0x07, 0x80, 0x01, 0xF0, 0x06, 0x00, 0x07, 0x80, 0x08, 0x00, 0x3C,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xDF, 0x80, 0x0F,
+  0x1E, 0x3E, 0x00, 0x3C, 0xF0, 0x7C, 0x01, 0xE7, 0x80, 0xF8, 0x07, 0x9E,
+  0x01, 0xF0, 0x3C, 0x70, 0x03, 0xE0, 0xF3, 0xC0, 0x0F, 0xC7, 0x8F, 0x00,
+  0x1F, 0xBE, 0x3C, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x7F, 0x83, 0xC0, 0x00,
+  0xFC, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x00, 0x3F, 0xE0, 0x7F, 0x03, 0xFF,
+  0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xFF, 0xF8, 0x3E, 0x00, 0xFF, 0x80, 0x7C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x78, 0x01, 0xE0,
+  0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x3E, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00,
+  0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80,
+  0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3E,
+  0x00, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C,
+  0x00, 0x03, 0x00, 0x40, 0xC0, 0xBC, 0x30, 0xF7, 0x8C, 0x78, 0x7B, 0x78,
+  0x07, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x1E, 0xDE, 0x1E,
+  0x31, 0xEF, 0x0C, 0x3D, 0x03, 0x02, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C,
+  0x00, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F,
+  0x0F, 0x1E, 0x1E, 0x1C, 0x3C, 0x38, 0x70, 0x70, 0xE0, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7B, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x38,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0x87, 0xC0, 0x7C, 0x07,
+  0xC0, 0xF0, 0x07, 0x83, 0xC0, 0x07, 0x8F, 0x80, 0x0F, 0x1E, 0x00, 0x1E,
+  0x7C, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF7, 0x80, 0x01, 0xEF,
+  0x00, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xE0,
+  0x00, 0x7B, 0xC0, 0x00, 0xF7, 0x80, 0x01, 0xEF, 0x00, 0x07, 0x9E, 0x00,
+  0x0F, 0x3C, 0x00, 0x3E, 0x78, 0x00, 0x78, 0xF0, 0x01, 0xF1, 0xE0, 0x03,
+  0xC1, 0xE0, 0x0F, 0x03, 0xC0, 0x3E, 0x03, 0xE1, 0xF8, 0x07, 0xFF, 0xE0,
+  0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF8, 0x07,
+  0xFF, 0x80, 0x7E, 0x78, 0x06, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0,
+  0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x00, 0x3C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0,
+  0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xC0,
+  0xFC, 0x03, 0x80, 0x0F, 0x01, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03,
+  0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+  0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00,
+  0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00,
+  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x3C, 0x07, 0xE0, 0x30, 0x00, 0xF8,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x1E, 0x0C, 0x00, 0x3E, 0x0F,
+  0xC0, 0x7F, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
+  0x00, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0,
+  0x00, 0x3B, 0xC0, 0x00, 0xE7, 0x80, 0x03, 0xCF, 0x00, 0x0F, 0x3E, 0x00,
+  0x3C, 0x78, 0x00, 0xF0, 0xF0, 0x03, 0xC1, 0xE0, 0x0F, 0x03, 0xC0, 0x1C,
+  0x0F, 0x80, 0x70, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0x78, 0x1E, 0x00,
+  0xF0, 0x78, 0x01, 0xE1, 0xE0, 0x07, 0x83, 0x80, 0x0F, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x03, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFE,
+  0x01, 0xFF, 0xFE, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
+  0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x07, 0x03, 0xF8,
+  0x08, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0,
+  0x40, 0x03, 0xE0, 0xF8, 0x0F, 0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00,
+  0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0,
+  0x7C, 0x07, 0x03, 0xC0, 0x04, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80,
+  0x00, 0x1E, 0x00, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x1F, 0xC0,
+  0x79, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xF8, 0x3F, 0x1F, 0x80, 0x3C, 0xFC,
+  0x00, 0xFB, 0xF0, 0x01, 0xEF, 0x80, 0x07, 0xBE, 0x00, 0x1E, 0xF0, 0x00,
+  0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x07, 0xBC, 0x00, 0x3C, 0xF0, 0x00, 0xF3,
+  0xC0, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0xF0, 0x3E, 0x0F, 0x80, 0x7F,
+  0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFD, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1E,
+  0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80,
+  0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xF0,
+  0x7E, 0x07, 0xC0, 0x1F, 0x07, 0x80, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x00,
+  0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x1E, 0x07, 0x80,
+  0x3C, 0x07, 0xE0, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x07, 0xFF,
+  0xE0, 0x1F, 0x83, 0xF0, 0x3E, 0x00, 0xF8, 0x3C, 0x00, 0x78, 0x78, 0x00,
+  0x3C, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
+  0x3C, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x78, 0xF8, 0x00, 0xF8, 0x7C, 0x01,
+  0xF0, 0x7E, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x03, 0xFC,
+  0x00, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x1F, 0x07,
+  0xC0, 0x78, 0x07, 0xC1, 0xE0, 0x07, 0x87, 0xC0, 0x07, 0x8F, 0x00, 0x0F,
+  0x1E, 0x00, 0x1E, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF3,
+  0xC0, 0x03, 0xE7, 0x80, 0x07, 0xCF, 0x00, 0x1F, 0x9F, 0x00, 0x3F, 0x1F,
+  0x00, 0xFC, 0x3F, 0x07, 0xF8, 0x3F, 0xFF, 0xF0, 0x3F, 0xF9, 0xE0, 0x1F,
+  0xC3, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x02, 0x00, 0x3C, 0x07, 0x01, 0xF0,
+  0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x0F, 0x1F,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x78, 0x78, 0xF8, 0xF0, 0xF0, 0x01, 0xE0, 0x3C, 0x0F, 0x81,
+  0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x3C, 0x0F, 0x01, 0xE0,
+  0x38, 0x0F, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE0, 0x00,
+  0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
+  0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
+  0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
+  0x0F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x1F, 0xFF, 0x1F, 0xFF, 0xDF, 0x03, 0xFE, 0x00, 0xFC, 0x00, 0x3C,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x07,
+  0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07,
+  0x80, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0,
+  0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x07, 0x80,
+  0x1E, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0x80, 0x00,
+  0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0xE1, 0xE0, 0x07, 0xE3, 0x83, 0xC7,
+  0x00, 0x7F, 0xEE, 0x07, 0x3C, 0x03, 0xFF, 0xB8, 0x1C, 0xE0, 0x1F, 0x0F,
+  0xE0, 0x77, 0x80, 0xF0, 0x0F, 0x81, 0xDC, 0x07, 0x80, 0x3C, 0x07, 0x70,
+  0x1C, 0x00, 0xF0, 0x1F, 0xC0, 0x70, 0x01, 0xC0, 0xFE, 0x03, 0x80, 0x0F,
+  0x03, 0xB8, 0x0E, 0x00, 0x3C, 0x0E, 0xE0, 0x38, 0x00, 0xE0, 0x73, 0x80,
+  0xE0, 0x07, 0x83, 0xCE, 0x03, 0x80, 0x1E, 0x1E, 0x38, 0x0F, 0x00, 0xF8,
+  0xF0, 0xE0, 0x1E, 0x0F, 0xEF, 0x83, 0x80, 0x7F, 0xFF, 0xFC, 0x0F, 0x00,
+  0xFF, 0xDF, 0xC0, 0x1C, 0x00, 0xFC, 0x78, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x08, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
+  0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x79,
+  0xF0, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xE1, 0xE0,
+  0x00, 0x3E, 0x0F, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x1F, 0x01, 0xE0, 0x00,
+  0xF0, 0x0F, 0x00, 0x0F, 0x80, 0x78, 0x00, 0x78, 0x03, 0xC0, 0x07, 0xC0,
+  0x1E, 0x00, 0x7C, 0x00, 0x78, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE,
+  0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x3E, 0x0F,
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x07, 0x87, 0x80, 0x00, 0x3C, 0x7C, 0x00,
+  0x01, 0xE7, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01,
+  0xE0, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1E,
+  0x00, 0x3E, 0x07, 0x80, 0x07, 0xC1, 0xE0, 0x00, 0xF0, 0x78, 0x00, 0x3C,
+  0x1E, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xE0, 0xF0, 0x00,
+  0x78, 0x3C, 0x00, 0x3C, 0x0F, 0x00, 0x3E, 0x07, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x1E, 0x00, 0x7E, 0x07, 0x80, 0x07, 0x83,
+  0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03,
+  0xC3, 0xC0, 0x00, 0xF1, 0xF0, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x1E, 0x00,
+  0x0F, 0x87, 0x80, 0x07, 0xC1, 0xE0, 0x07, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x00, 0xF0,
+  0x7C, 0x00, 0x06, 0x07, 0x80, 0x00, 0x20, 0xF0, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x10, 0x3C, 0x00, 0x03, 0x03, 0xE0, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x00,
+  0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
+  0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xE0, 0x03,
+  0xF8, 0x07, 0x80, 0x03, 0xF0, 0x1E, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x07,
+  0x81, 0xE0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0xF0,
+  0xF0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x78,
+  0x00, 0x00, 0xF1, 0xE0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F, 0x1E, 0x00,
+  0x00, 0x3C, 0x78, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x07, 0x8F, 0x00, 0x00,
+  0x1E, 0x3C, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1E,
+  0x1F, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x3E, 0x07,
+  0x80, 0x03, 0xF0, 0x1E, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+  0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xFF,
+  0xFE, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x78, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x00,
+  0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x1E, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xF8, 0x07, 0xF0,
+  0x3F, 0x00, 0x07, 0x83, 0xE0, 0x00, 0x0C, 0x1E, 0x00, 0x00, 0x41, 0xE0,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xFE, 0xF0, 0x00, 0xFF, 0xF7, 0x80,
+  0x07, 0xFF, 0xBC, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x03, 0xCF, 0x00, 0x00,
+  0x1E, 0x78, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x9E, 0x00, 0x00, 0x78,
+  0x78, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0xF0, 0x7C,
+  0x00, 0x0F, 0x81, 0xF8, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x0F, 0x00, 0x00,
+  0xF0, 0x7C, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x78,
+  0x1E, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x3E, 0x0F,
+  0x00, 0x00, 0xF0, 0x3C, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0x03, 0xC0,
+  0x00, 0x3C, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+  0xFE, 0x07, 0x80, 0x00, 0x78, 0x1E, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x07,
+  0x83, 0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x03, 0xC0,
+  0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x3C, 0x1F, 0x00, 0x01, 0xE0, 0x78,
+  0x00, 0x07, 0x81, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x78, 0x1E, 0x00,
+  0x01, 0xE0, 0xF8, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x3C, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
+  0x83, 0xE0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x78, 0x1E, 0x07, 0x81,
+  0xE0, 0xF8, 0x3C, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F,
+  0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3E,
+  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF8,
+  0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xE0,
+  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x80,
+  0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x1E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x0F, 0x00, 0x07, 0xC0,
+  0x7C, 0x00, 0x3E, 0x01, 0xE0, 0x03, 0xF0, 0x07, 0x80, 0x1F, 0x00, 0x1E,
+  0x01, 0xF8, 0x00, 0x78, 0x0F, 0xC0, 0x01, 0xE0, 0x7C, 0x00, 0x0F, 0x07,
+  0xE0, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0xF3, 0xF8, 0x00, 0x03, 0xDF, 0x80,
+  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x7B, 0xF0, 0x00, 0x03,
+  0xE7, 0xE0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0xF0,
+  0x3E, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x78, 0x03,
+  0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x1E, 0x00, 0x1F,
+  0x00, 0xF8, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0xFC, 0x0F, 0x00, 0x01, 0xF8,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00,
+  0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00,
+  0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x07, 0xE0,
+  0x7F, 0x00, 0x01, 0xFC, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F,
+  0xE0, 0x7B, 0x80, 0x03, 0xFC, 0x0F, 0x78, 0x00, 0x77, 0x81, 0xEF, 0x00,
+  0x1E, 0xF0, 0x3D, 0xE0, 0x03, 0xBE, 0x0F, 0x3C, 0x00, 0xE7, 0x81, 0xE3,
+  0x80, 0x3C, 0xF0, 0x3C, 0x70, 0x07, 0x1E, 0x07, 0x8E, 0x01, 0xE3, 0xC0,
+  0xF1, 0xE0, 0x38, 0xF8, 0x3C, 0x3C, 0x0E, 0x1E, 0x07, 0x87, 0x83, 0xC3,
+  0xC0, 0xF0, 0x70, 0x70, 0x78, 0x1E, 0x0E, 0x1E, 0x0F, 0x03, 0xC1, 0xC3,
+  0x81, 0xE0, 0xF8, 0x38, 0xF0, 0x78, 0x1E, 0x07, 0xBC, 0x0F, 0x03, 0xC0,
+  0x77, 0x01, 0xE0, 0x78, 0x0F, 0xE0, 0x3C, 0x0F, 0x01, 0xF8, 0x07, 0x83,
+  0xE0, 0x3F, 0x01, 0xE0, 0x78, 0x07, 0xC0, 0x3C, 0x0F, 0x00, 0x00, 0x07,
+  0x81, 0xE0, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x1E, 0x0F, 0x80, 0x00,
+  0x07, 0xC1, 0xE0, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x03,
+  0xF0, 0x00, 0x3C, 0x0F, 0xE0, 0x00, 0xF0, 0x7F, 0x80, 0x07, 0xC1, 0xFE,
+  0x00, 0x1E, 0x07, 0xFC, 0x00, 0x78, 0x1E, 0xF0, 0x01, 0xE0, 0x7B, 0xC0,
+  0x07, 0x81, 0xEF, 0x80, 0x3E, 0x0F, 0x1E, 0x00, 0xF0, 0x3C, 0x78, 0x03,
+  0xC0, 0xF1, 0xF0, 0x0F, 0x03, 0xC3, 0xC0, 0x3C, 0x0F, 0x0F, 0x01, 0xF0,
+  0x78, 0x3E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x0F, 0x07, 0x83, 0xE0, 0x3C, 0x3C, 0x0F, 0x00,
+  0xF0, 0xF0, 0x3C, 0x01, 0xE3, 0xC0, 0xF0, 0x07, 0x8F, 0x03, 0xC0, 0x1E,
+  0x3C, 0x1F, 0x00, 0x3D, 0xE0, 0x78, 0x00, 0xF7, 0x81, 0xE0, 0x03, 0xDE,
+  0x07, 0x80, 0x07, 0xF8, 0x1E, 0x00, 0x1F, 0xE0, 0xF8, 0x00, 0x7F, 0x83,
+  0xC0, 0x00, 0xFC, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0x01, 0xF8, 0x01,
+  0xF0, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x07, 0x83, 0xC0,
+  0x00, 0x1E, 0x1F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF3, 0xC0, 0x00,
+  0x03, 0xCF, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00,
+  0xF7, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E, 0xF0,
+  0x00, 0x00, 0xF3, 0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0x3C, 0x00,
+  0x00, 0xF8, 0x78, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1E, 0x03, 0xC0, 0x00,
+  0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x80, 0xFC, 0x00, 0x3F, 0xFF, 0xE0,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0xF0, 0x07, 0xE0, 0x78, 0x00, 0xF0,
+  0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x07,
+  0x87, 0x80, 0x03, 0xC3, 0xC0, 0x01, 0xE1, 0xE0, 0x01, 0xF0, 0xF0, 0x00,
+  0xF0, 0xF0, 0x00, 0xF8, 0x78, 0x00, 0xF8, 0x3C, 0x01, 0xF8, 0x1F, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0x01, 0xF8,
+  0x03, 0xF0, 0x01, 0xF0, 0x1F, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x07, 0x83,
+  0xC0, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF3, 0xC0,
+  0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x00, 0xF7, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E,
+  0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0x3C,
+  0x00, 0x00, 0xF8, 0x78, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1E, 0x03, 0xC0,
+  0x00, 0xF8, 0x0F, 0x80, 0x0F, 0xC0, 0x1F, 0x80, 0xFC, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0xF0, 0x07, 0xE0, 0x78, 0x00, 0xF0,
+  0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x07,
+  0x87, 0x80, 0x03, 0xC3, 0xC0, 0x01, 0xE1, 0xE0, 0x01, 0xE0, 0xF0, 0x01,
+  0xF0, 0xF0, 0x01, 0xF0, 0x78, 0x03, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xF8, 0x0F, 0x80, 0x7E, 0x07, 0x80, 0x1F, 0x03, 0xC0,
+  0x07, 0xC1, 0xE0, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0xF8, 0x00, 0x7C, 0x78,
+  0x00, 0x1E, 0x3C, 0x00, 0x0F, 0x1E, 0x00, 0x07, 0xCF, 0x00, 0x01, 0xEF,
+  0x80, 0x00, 0xF7, 0x80, 0x00, 0x7B, 0xC0, 0x00, 0x1E, 0x00, 0x0F, 0xF8,
+  0x00, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x7E, 0x03, 0xF0, 0x7C, 0x00,
+  0x38, 0x7C, 0x00, 0x08, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x01,
+  0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x1F, 0x0E, 0x00, 0x1F,
+  0x0F, 0xC0, 0x3F, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFC,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E,
+  0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xE3, 0xE0,
+  0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03,
+  0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78,
+  0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00,
+  0xF0, 0x78, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0F, 0x0F,
+  0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00,
+  0x3C, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0xF8, 0x07, 0xE0, 0x3F, 0x00,
+  0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x7C, 0xF0, 0x00,
+  0x07, 0xC7, 0x80, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x3E,
+  0x0F, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF0, 0x0F,
+  0x00, 0x0F, 0x80, 0x78, 0x00, 0x78, 0x03, 0xC0, 0x07, 0xC0, 0x1F, 0x00,
+  0x7C, 0x00, 0x78, 0x03, 0xC0, 0x03, 0xC0, 0x3E, 0x00, 0x1E, 0x01, 0xE0,
+  0x00, 0xF0, 0x1F, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x00,
+  0xF0, 0xF8, 0x00, 0x07, 0x87, 0x80, 0x00, 0x3C, 0x7C, 0x00, 0x01, 0xE7,
+  0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0xF0, 0x00, 0xFC,
+  0x00, 0x1E, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0xF0, 0x00, 0xFC, 0x00, 0x3C,
+  0xF0, 0x01, 0xFC, 0x00, 0x3C, 0xF0, 0x01, 0xFC, 0x00, 0x7C, 0xF0, 0x03,
+  0xFC, 0x00, 0x78, 0xF0, 0x03, 0xDE, 0x00, 0xF8, 0x78, 0x03, 0xDE, 0x00,
+  0xF0, 0x78, 0x07, 0x9E, 0x01, 0xF0, 0x78, 0x07, 0x9E, 0x01, 0xE0, 0x78,
+  0x0F, 0x1E, 0x03, 0xE0, 0x78, 0x0F, 0x0E, 0x03, 0xC0, 0x78, 0x1E, 0x0E,
+  0x07, 0xC0, 0x78, 0x1E, 0x0E, 0x07, 0x80, 0x78, 0x1C, 0x0E, 0x07, 0x80,
+  0x78, 0x3C, 0x0E, 0x0F, 0x80, 0x78, 0x3C, 0x0F, 0x0F, 0x00, 0x78, 0x78,
+  0x0F, 0x1F, 0x00, 0x78, 0x78, 0x0F, 0x1E, 0x00, 0x78, 0x70, 0x0F, 0x3E,
+  0x00, 0x78, 0xF0, 0x0F, 0x3C, 0x00, 0x78, 0xE0, 0x0F, 0x7C, 0x00, 0x79,
+  0xE0, 0x0F, 0x78, 0x00, 0x3D, 0xC0, 0x0F, 0x78, 0x00, 0x3F, 0xC0, 0x0F,
+  0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00,
+  0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x7E, 0x00,
+  0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x3C, 0x01, 0xF0, 0x00,
+  0x3E, 0x03, 0xE0, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00,
+  0x0F, 0x1F, 0x80, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00,
+  0x7E, 0x3C, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x01, 0xF8, 0x1E, 0x00, 0x01,
+  0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x0F, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x0F,
+  0x80, 0x07, 0x80, 0x1F, 0x00, 0x07, 0x80, 0x3F, 0x00, 0x03, 0xC0, 0x7E,
+  0x00, 0x03, 0xC0, 0xFC, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x07, 0xDE, 0x00,
+  0x03, 0xE7, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0xF8, 0x3E, 0x00, 0x7E, 0x07,
+  0x80, 0x3F, 0x01, 0xF0, 0x1F, 0x80, 0x3C, 0x07, 0xC0, 0x0F, 0x83, 0xE0,
+  0x01, 0xE1, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0,
+  0x00, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFE, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07,
+  0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+  0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+  0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xFF,
+  0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70,
+  0x70, 0x78, 0x78, 0x78, 0x78, 0x78, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x1E,
+  0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78,
+  0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+  0x01, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x7F, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x1F, 0x1F,
+  0x00, 0x07, 0xC1, 0xF0, 0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x1F,
+  0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0x1F, 0x7C, 0x00, 0x01,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x3C,
+  0x0F, 0x07, 0x81, 0xE0, 0x78, 0x1C, 0x0F, 0x00, 0xFF, 0x80, 0x1F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x03, 0xC0, 0x7E, 0x08, 0x00, 0x7C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x0F,
+  0xFF, 0xC1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xFC, 0x01, 0xE7, 0xC0, 0x07,
+  0x9E, 0x00, 0x1E, 0xF0, 0x00, 0xFB, 0xC0, 0x03, 0xCF, 0x00, 0x1F, 0x3C,
+  0x00, 0xFC, 0xF8, 0x07, 0xF1, 0xF0, 0x7F, 0x87, 0xFF, 0xDE, 0x0F, 0xFE,
+  0x78, 0x0F, 0xC1, 0xE0, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x87, 0xE0, 0x0F, 0x1F, 0xF8, 0x0F, 0x7F,
+  0xFC, 0x0F, 0xF0, 0x7E, 0x0F, 0xE0, 0x3E, 0x0F, 0xC0, 0x1E, 0x1F, 0x80,
+  0x1F, 0x1F, 0x00, 0x0F, 0x1F, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00,
+  0x0F, 0x3E, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x3C, 0x00,
+  0x1E, 0x3C, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00,
+  0x78, 0x7E, 0x00, 0xF8, 0x7E, 0x01, 0xF0, 0x7F, 0x83, 0xE0, 0xFB, 0xFF,
+  0xC0, 0xF1, 0xFF, 0x80, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFF,
+  0xC0, 0xFF, 0xFE, 0x0F, 0xC0, 0xF0, 0xF8, 0x01, 0x0F, 0x80, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0xC0, 0x08, 0x1F, 0x01, 0xC0, 0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x03, 0xFE,
+  0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x3F, 0x0F, 0x00, 0x7F, 0xF3, 0xC0, 0x3F, 0xFE,
+  0xF0, 0x1F, 0x83, 0xBC, 0x0F, 0x80, 0x7F, 0x07, 0xC0, 0x0F, 0xC1, 0xE0,
+  0x03, 0xE0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x1E, 0x1E, 0x00, 0x07, 0x87,
+  0x80, 0x01, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x0F,
+  0x0F, 0x00, 0x07, 0xC3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0x7C, 0x3C, 0x00,
+  0x3E, 0x0F, 0x00, 0x0F, 0x83, 0xE0, 0x07, 0xE0, 0x7C, 0x03, 0xF8, 0x1F,
+  0x83, 0xDE, 0x03, 0xFF, 0xEF, 0x00, 0x7F, 0xF3, 0xC0, 0x07, 0xE0, 0xF0,
+  0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x3F, 0x07,
+  0xE0, 0xF8, 0x07, 0xC3, 0xE0, 0x07, 0xC7, 0x80, 0x07, 0x9E, 0x00, 0x0F,
+  0x3C, 0x00, 0x1E, 0xF0, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
+  0x01, 0x07, 0xE0, 0x1E, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF,
+  0x80, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF8, 0x07, 0x80, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x1F, 0xFF, 0x87,
+  0xFF, 0xE3, 0xFF, 0xF8, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0xE3, 0xC0, 0x7F,
+  0xF9, 0xE0, 0x7C, 0x0F, 0xF0, 0x78, 0x03, 0xF0, 0x78, 0x00, 0xF8, 0x3C,
+  0x00, 0x7C, 0x3C, 0x00, 0x3E, 0x1E, 0x00, 0x1F, 0x1E, 0x00, 0x0F, 0x0F,
+  0x00, 0x07, 0x87, 0x00, 0x03, 0xC7, 0x80, 0x01, 0xE3, 0xC0, 0x00, 0xF1,
+  0xE0, 0x00, 0x70, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x3E,
+  0x1E, 0x00, 0x1F, 0x0F, 0x80, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x3F,
+  0xC0, 0x7F, 0xFD, 0xE0, 0x1F, 0xF8, 0xF0, 0x03, 0xF0, 0xF0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x02, 0x00,
+  0x3E, 0x01, 0xC0, 0x7E, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x87, 0xE0, 0x1E, 0x3F, 0xF0, 0x3D, 0xFF, 0xF0, 0x7F,
+  0x83, 0xE0, 0xFC, 0x03, 0xE1, 0xF0, 0x03, 0xC7, 0xC0, 0x07, 0x8F, 0x80,
+  0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0xF9, 0xF0, 0x01,
+  0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E,
+  0x3C, 0x00, 0x7C, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7,
+  0x80, 0x07, 0x8F, 0x00, 0x0F, 0x3E, 0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0,
+  0x00, 0xF0, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xE0, 0x78, 0x3E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0x07,
+  0x81, 0xE0, 0x78, 0x1E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x07, 0x83, 0xC0, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x03,
+  0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0,
+  0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78,
+  0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x7C,
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x0F, 0x83, 0xC0, 0x0F,
+  0x81, 0xE0, 0x0F, 0x80, 0xF0, 0x1F, 0x00, 0x78, 0x1F, 0x00, 0x78, 0x1F,
+  0x00, 0x3C, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x0F, 0x3E, 0x00, 0x07, 0xFC,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xF7,
+  0xC0, 0x00, 0x79, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x3F, 0x00, 0x1E,
+  0x0F, 0xC0, 0x0F, 0x03, 0xF0, 0x07, 0x80, 0xF8, 0x03, 0xC0, 0x3E, 0x03,
+  0xE0, 0x0F, 0x81, 0xE0, 0x03, 0xE0, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xC0,
+  0xF0, 0x3C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F, 0x83, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC1, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xF8, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F,
+  0x83, 0xC0, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x3C, 0xFF, 0x81,
+  0xFF, 0x01, 0xEF, 0xFE, 0x3F, 0xFC, 0x1F, 0xE1, 0xFB, 0xC3, 0xE0, 0xFE,
+  0x07, 0xF8, 0x0F, 0x87, 0xC0, 0x1F, 0x80, 0x3C, 0x3E, 0x00, 0xF8, 0x01,
+  0xE1, 0xE0, 0x07, 0xC0, 0x0F, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0xF0, 0x01,
+  0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0x01, 0xE1,
+  0xE0, 0x07, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0xF0, 0x01, 0xE0,
+  0x03, 0xC7, 0x80, 0x0F, 0x00, 0x1E, 0x3C, 0x00, 0xF8, 0x01, 0xF1, 0xE0,
+  0x07, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0xF0, 0x01, 0xE0, 0x03,
+  0xC7, 0x80, 0x0F, 0x00, 0x1E, 0x3C, 0x00, 0x78, 0x00, 0xF1, 0xE0, 0x07,
+  0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+  0x00, 0x07, 0xE0, 0x0F, 0x3F, 0xF0, 0x1E, 0xFF, 0xF0, 0x7F, 0x83, 0xE0,
+  0xFE, 0x03, 0xE1, 0xF8, 0x03, 0xC3, 0xE0, 0x07, 0x87, 0x80, 0x0F, 0x1F,
+  0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0xF8, 0xF0, 0x01, 0xE1, 0xE0,
+  0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00,
+  0x7C, 0x78, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07,
+  0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF0,
+  0x00, 0x3F, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x01, 0xF0, 0x7C, 0x0F,
+  0x00, 0x78, 0x78, 0x01, 0xE3, 0xE0, 0x03, 0xCF, 0x00, 0x0F, 0x78, 0x00,
+  0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0,
+  0x03, 0xCF, 0x00, 0x1F, 0x1E, 0x00, 0x78, 0x78, 0x03, 0xC0, 0xF8, 0x3E,
+  0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF0,
+  0x01, 0xE7, 0xFE, 0x00, 0xF7, 0xFF, 0x80, 0x7F, 0x87, 0xE0, 0x7F, 0x01,
+  0xF0, 0x3F, 0x00, 0x7C, 0x1F, 0x00, 0x1E, 0x0F, 0x80, 0x0F, 0x07, 0x80,
+  0x07, 0x87, 0xC0, 0x03, 0xC3, 0xE0, 0x01, 0xE1, 0xE0, 0x00, 0xF0, 0xF0,
+  0x00, 0x78, 0x78, 0x00, 0x78, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x1E, 0x1E,
+  0x00, 0x1E, 0x0F, 0x80, 0x0F, 0x07, 0xC0, 0x0F, 0x03, 0xE0, 0x07, 0x83,
+  0xF8, 0x07, 0x81, 0xEE, 0x0F, 0x80, 0xF7, 0xFF, 0x80, 0x79, 0xFF, 0x80,
+  0x3C, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
+  0xFF, 0xCF, 0x03, 0xFF, 0xEF, 0x07, 0xC0, 0xFF, 0x0F, 0x80, 0x7E, 0x1F,
+  0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x3C, 0x00, 0x1E, 0x3C, 0x00, 0x3E, 0x78,
+  0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0,
+  0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0xF0, 0x00, 0x78, 0xF0,
+  0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF8, 0x01, 0xF8, 0x7C, 0x03, 0xF0, 0x7E,
+  0x0F, 0xF0, 0x3F, 0xFE, 0xF0, 0x1F, 0xFC, 0xF0, 0x07, 0xE0, 0xF0, 0x00,
+  0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
+  0x03, 0xC0, 0x00, 0x07, 0xC1, 0xE7, 0xF0, 0x7B, 0xFC, 0x3F, 0xC2, 0x0F,
+  0xE0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x7F, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFE, 0x0F, 0x80, 0xE0, 0xF0, 0x01,
+  0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xFC,
+  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xE0,
+  0x00, 0x7F, 0x80, 0x00, 0xFC, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x78, 0x00, 0x07, 0x84, 0x00, 0x3C, 0x7C, 0x07, 0xC3, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x78, 0x01, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xFE, 0x0F,
+  0xFC, 0x07, 0xF8, 0x00, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00,
+  0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F,
+  0x1E, 0x00, 0x3C, 0x7C, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE3,
+  0xC0, 0x03, 0xC7, 0x80, 0x0F, 0x0F, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78,
+  0x00, 0xF8, 0xF0, 0x01, 0xF1, 0xE0, 0x07, 0xC3, 0xC0, 0x0F, 0x87, 0xC0,
+  0x7F, 0x0F, 0xC1, 0xDE, 0x0F, 0xFF, 0x7C, 0x0F, 0xFC, 0xF0, 0x0F, 0xE1,
+  0xE0, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7B, 0xE0, 0x01, 0xF3, 0xC0, 0x07,
+  0xC7, 0x80, 0x0F, 0x0F, 0x00, 0x3E, 0x1E, 0x00, 0x78, 0x3C, 0x01, 0xF0,
+  0x3C, 0x03, 0xC0, 0x78, 0x0F, 0x80, 0xF0, 0x1E, 0x01, 0xE0, 0x7C, 0x03,
+  0xC1, 0xF0, 0x07, 0xC3, 0xC0, 0x07, 0x8F, 0x80, 0x0F, 0x1E, 0x00, 0x1E,
+  0x7C, 0x00, 0x3C, 0xF0, 0x00, 0x7B, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0xFF,
+  0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xF0, 0x03,
+  0xC0, 0x1F, 0xF0, 0x07, 0xC0, 0x1E, 0xF0, 0x07, 0xC0, 0x3E, 0xF0, 0x0F,
+  0xE0, 0x3C, 0xF0, 0x0E, 0xE0, 0x3C, 0xF0, 0x1E, 0xE0, 0x7C, 0xF0, 0x1C,
+  0xE0, 0x78, 0x78, 0x3C, 0xE0, 0xF8, 0x78, 0x38, 0xE0, 0xF0, 0x78, 0x38,
+  0xE1, 0xF0, 0x78, 0x70, 0xE1, 0xE0, 0x78, 0x70, 0xE3, 0xE0, 0x78, 0xF0,
+  0xE3, 0xC0, 0x78, 0xE0, 0xE7, 0xC0, 0x79, 0xE0, 0xE7, 0x80, 0x79, 0xC0,
+  0xE7, 0x80, 0x7B, 0xC0, 0xEF, 0x80, 0x7B, 0x80, 0xEF, 0x00, 0x7F, 0x80,
+  0x7F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x7E, 0x00,
+  0x7C, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x07, 0xE0, 0x7C, 0x01, 0xF8, 0x07, 0x80, 0x7E, 0x00, 0xF8, 0x1F, 0x80,
+  0x0F, 0x07, 0xE0, 0x01, 0xF1, 0xF8, 0x00, 0x1E, 0x3E, 0x00, 0x03, 0xEF,
+  0x80, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x07, 0xDE, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x7C, 0x3C, 0x00, 0x1F,
+  0x07, 0xC0, 0x07, 0xE0, 0x78, 0x01, 0xF8, 0x0F, 0x80, 0x7E, 0x00, 0xF0,
+  0x1F, 0x80, 0x1F, 0x07, 0xE0, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xE1, 0xF0,
+  0x00, 0xF8, 0x1E, 0x00, 0x1F, 0x03, 0xC0, 0x07, 0xC0, 0x78, 0x00, 0xF0,
+  0x0F, 0x00, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x01, 0xF0, 0x03, 0xC0,
+  0x7C, 0x00, 0x78, 0x0F, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0xF0, 0x78, 0x00,
+  0x1E, 0x1F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x78, 0xF8, 0x00, 0x07, 0xBE,
+  0x00, 0x00, 0xF7, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
+  0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00,
+  0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
+  0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
+  0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00,
+  0x7F, 0x80, 0x07, 0xFC, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x3E,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x3C, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3F, 0xE0, 0x01, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
+  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+  0x1F, 0xE0, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x00,
+  0x1F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
+  0x00, 0x7C, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x0F,
+  0x80, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x03,
+  0xC0, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xFF, 0xF0, 0x03, 0xBF, 0xFF,
+  0xC1, 0xFF, 0x83, 0xFF, 0xFD, 0xC0, 0x0F, 0xFF, 0x20, 0x00, 0x3F, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xC0,
+  0xF0, 0x7C, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3C, 0x0F,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x00,
+  0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x80, 0x1F, 0xFF, 0x03, 0xFF,
+  0xF8, 0x3F, 0x33, 0xC3, 0xE3, 0x84, 0x3E, 0x18, 0x01, 0xE0, 0xC0, 0x1E,
+  0x06, 0x01, 0xF0, 0x30, 0x0F, 0x01, 0x80, 0x78, 0x18, 0x07, 0x80, 0xC0,
+  0x3C, 0x06, 0x01, 0xE0, 0x30, 0x0F, 0x01, 0x80, 0x78, 0x1C, 0x03, 0xC0,
+  0xC0, 0x1E, 0x06, 0x00, 0xF0, 0x30, 0x03, 0xC1, 0x80, 0x1F, 0x0C, 0x20,
+  0x7C, 0xC7, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x0C,
+  0x00, 0x00, 0xE0, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
+  0xFF, 0x80, 0x03, 0xE0, 0x70, 0x00, 0xF8, 0x02, 0x00, 0x1E, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xF8,
+  0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x78, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0xC0, 0x20, 0x00, 0x04, 0x70, 0x00, 0x0E, 0xF8, 0x00, 0x1F,
+  0x7C, 0x7E, 0x3E, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xC3, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0E, 0x00, 0x70, 0x1E, 0x00, 0x78, 0x1C, 0x00, 0x38,
+  0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1E, 0x00, 0x78,
+  0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFC, 0x7C, 0x7E, 0x3E, 0xF8, 0x00, 0x1F, 0x70, 0x00, 0x0E,
+  0x20, 0x00, 0x04, 0x1F, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x7C, 0x0F, 0x00,
+  0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xE0,
+  0x03, 0xC0, 0x3E, 0x00, 0x3C, 0x07, 0xC0, 0x03, 0xE0, 0xF8, 0x00, 0x1E,
+  0x0F, 0x00, 0x01, 0xE1, 0xF0, 0x00, 0x1F, 0x3E, 0x00, 0x3F, 0xF7, 0xFF,
+  0x03, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x78, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x0F, 0xE0, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x01, 0xF0, 0x30, 0x1F, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x1E, 0x00, 0x03, 0xFC, 0x00, 0x3D, 0xF0, 0x03, 0xC7, 0xE0,
+  0x3C, 0x1F, 0x83, 0xC0, 0x7C, 0x1E, 0x01, 0xF0, 0xF0, 0x07, 0x87, 0xC0,
+  0x3C, 0x3E, 0x01, 0xE0, 0xF8, 0x0E, 0x03, 0xF0, 0xF0, 0x0F, 0xCF, 0x00,
+  0x3E, 0xF0, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3E,
+  0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x60,
+  0x3E, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x78, 0x7F,
+  0xC3, 0xFC, 0x3D, 0xE1, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x07, 0xC0, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x1C,
+  0x01, 0x80, 0x00, 0x0C, 0x07, 0x03, 0xFC, 0x0C, 0x1C, 0x1F, 0xFE, 0x1C,
+  0x30, 0x7F, 0xFC, 0x18, 0xC1, 0xF0, 0x18, 0x19, 0x87, 0x80, 0x00, 0x37,
+  0x0E, 0x00, 0x00, 0x6C, 0x3C, 0x00, 0x00, 0x78, 0x70, 0x00, 0x00, 0xF0,
+  0xE0, 0x00, 0x01, 0xE1, 0xC0, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x07, 0x87,
+  0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x1F, 0x0E, 0x00, 0x00, 0x66, 0x1E,
+  0x00, 0x00, 0xCC, 0x1F, 0x01, 0x81, 0x8C, 0x1F, 0xFF, 0x06, 0x1C, 0x1F,
+  0xFE, 0x1C, 0x1C, 0x0F, 0xF0, 0x30, 0x1C, 0x00, 0x00, 0xC0, 0x1C, 0x00,
+  0x07, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0x83, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x0F, 0xFE, 0x1F, 0xFF, 0x3C,
+  0x07, 0x9C, 0x03, 0x9C, 0x01, 0xCE, 0x01, 0xE7, 0x00, 0xF3, 0x80, 0xF9,
+  0xE1, 0xF8, 0x7F, 0xDC, 0x0F, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0x8F, 0xFF, 0xC0, 0x00, 0x10, 0x08, 0x01, 0x80, 0xC0, 0x1C, 0x0E, 0x03,
+  0xC1, 0xE0, 0x3E, 0x1F, 0x03, 0xC1, 0xF0, 0x7C, 0x3E, 0x07, 0xC3, 0xE0,
+  0x78, 0x3E, 0x07, 0x83, 0xC0, 0x3C, 0x1F, 0x00, 0xF0, 0x7C, 0x03, 0xC1,
+  0xF0, 0x0F, 0x07, 0x80, 0x3C, 0x1E, 0x00, 0xF0, 0x78, 0x03, 0x01, 0xC0,
+  0x18, 0x06, 0x00, 0x40, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
+  0xF8, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x70, 0x00,
+  0x1C, 0x01, 0x80, 0x00, 0x0C, 0x07, 0x1F, 0xF8, 0x0C, 0x1C, 0x3F, 0xFC,
+  0x1C, 0x30, 0x70, 0x38, 0x18, 0xC0, 0xE0, 0x38, 0x19, 0x81, 0xC0, 0x70,
+  0x37, 0x03, 0x80, 0xE0, 0x6C, 0x07, 0x01, 0xC0, 0x78, 0x0E, 0x07, 0x00,
+  0xF0, 0x1F, 0xFC, 0x01, 0xE0, 0x3F, 0xE0, 0x03, 0xC0, 0x71, 0xE0, 0x07,
+  0x80, 0xE1, 0xE0, 0x0F, 0x01, 0xC1, 0xC0, 0x1F, 0x03, 0x83, 0xC0, 0x66,
+  0x07, 0x03, 0x80, 0xCC, 0x0E, 0x07, 0x81, 0x8C, 0x1C, 0x07, 0x86, 0x1C,
+  0x38, 0x07, 0x1C, 0x1C, 0x70, 0x0F, 0x30, 0x1C, 0x00, 0x00, 0xC0, 0x1C,
+  0x00, 0x07, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x0F, 0x81, 0xFF, 0x1F, 0xFC, 0xF1, 0xEF, 0x07, 0xF0, 0x1F, 0x80, 0xFC,
+  0x07, 0xF0, 0x7B, 0xC7, 0x9F, 0xFC, 0x7F, 0xC0, 0xF8, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xF0, 0x1F, 0xFC, 0x18, 0x1E,
+  0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x7C,
+  0x00, 0xF8, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+  0x78, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x03, 0xF0, 0x1F, 0xF8, 0x20, 0x78,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x0F, 0x03, 0xF8, 0x07, 0xF0, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x0E, 0x60, 0x7C,
+  0xFF, 0xE0, 0x7F, 0x00, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x01, 0xE0, 0x3C,
+  0x00, 0x78, 0x1E, 0x00, 0x1E, 0x07, 0x80, 0x07, 0x81, 0xE0, 0x01, 0xE0,
+  0x78, 0x00, 0xF0, 0x1E, 0x00, 0x3C, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x03,
+  0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x1E, 0x03, 0xC0,
+  0x07, 0x81, 0xE0, 0x01, 0xE0, 0x78, 0x00, 0x78, 0x1E, 0x00, 0x3E, 0x07,
+  0x80, 0x0F, 0x01, 0xE0, 0x07, 0xC0, 0xFC, 0x03, 0xF0, 0x3F, 0x83, 0xFC,
+  0x8F, 0xFF, 0xEF, 0xE3, 0xDF, 0xF3, 0xF0, 0xF1, 0xF0, 0x78, 0x3C, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xF1,
+  0xFF, 0x87, 0x3F, 0xF8, 0x77, 0xFF, 0x86, 0x7F, 0xF0, 0xEF, 0xFF, 0x0E,
+  0xFF, 0xF0, 0xEF, 0xFF, 0x0E, 0xFF, 0xF0, 0xEF, 0xFE, 0x1C, 0xFF, 0xE1,
+  0xCF, 0xFE, 0x1C, 0x7F, 0xE1, 0xC3, 0xFE, 0x1C, 0x1F, 0xC3, 0x80, 0x7C,
+  0x38, 0x01, 0xC3, 0x80, 0x1C, 0x38, 0x01, 0xC3, 0x80, 0x3C, 0x30, 0x03,
+  0x87, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00,
+  0x70, 0xE0, 0x07, 0x0E, 0x00, 0x70, 0xE0, 0x07, 0x0E, 0x00, 0x70, 0xE0,
+  0x0E, 0x1C, 0x00, 0xE1, 0xC0, 0x0E, 0x1C, 0x00, 0x7B, 0xFF, 0xEF, 0x00,
+  0x07, 0x01, 0x80, 0xE0, 0x78, 0x7F, 0xFF, 0xFD, 0xF8, 0x03, 0xE0, 0xFF,
+  0x06, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0xF0, 0x78, 0x78, 0x0E,
+  0x1C, 0x01, 0xCE, 0x00, 0x73, 0x80, 0x1D, 0xC0, 0x07, 0x70, 0x01, 0xDC,
+  0x00, 0x77, 0x00, 0x39, 0xC0, 0x0E, 0x70, 0x07, 0x0E, 0x03, 0xC3, 0xC1,
+  0xE0, 0x7F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
+  0xFF, 0xFE, 0x00, 0x10, 0x04, 0x00, 0xC0, 0x30, 0x07, 0x01, 0x80, 0x3C,
+  0x1E, 0x00, 0xF0, 0x78, 0x03, 0xC1, 0xE0, 0x1F, 0x07, 0x80, 0x7C, 0x1E,
+  0x01, 0xF0, 0x78, 0x07, 0x83, 0xC0, 0xFC, 0x3C, 0x0F, 0x87, 0xC0, 0xF8,
+  0x7C, 0x0F, 0x07, 0x81, 0xF0, 0xF8, 0x0F, 0x07, 0x80, 0xE0, 0x70, 0x06,
+  0x03, 0x00, 0x20, 0x10, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x00, 0x7F, 0x80,
+  0x00, 0x3C, 0x01, 0x9C, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x0F, 0x00,
+  0x01, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00,
+  0x0F, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x00,
+  0x0E, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x03,
+  0x80, 0x00, 0x03, 0x80, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x00,
+  0x70, 0x07, 0x80, 0x07, 0x81, 0xC0, 0x3C, 0x00, 0x3E, 0xFF, 0xF8, 0xE0,
+  0x01, 0xFB, 0xFF, 0xE7, 0x80, 0x0E, 0xC0, 0x00, 0x3C, 0x00, 0x33, 0x00,
+  0x01, 0xE0, 0x01, 0xDC, 0x00, 0x0F, 0x00, 0x0E, 0x70, 0x00, 0x38, 0x00,
+  0x71, 0xC0, 0x01, 0xE0, 0x03, 0x87, 0x00, 0x0F, 0x00, 0x1C, 0x38, 0x00,
+  0x78, 0x00, 0xE0, 0xE0, 0x03, 0xC0, 0x07, 0x03, 0x80, 0x1E, 0x00, 0x1F,
+  0xFF, 0xC0, 0x70, 0x00, 0x7F, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x1E,
+  0x00, 0x00, 0x07, 0x00, 0xF0, 0x00, 0x00, 0x1C, 0x07, 0x80, 0x00, 0x00,
+  0x70, 0x03, 0xE0, 0x00, 0x07, 0x00, 0x3F, 0xC0, 0x00, 0x1E, 0x00, 0x67,
+  0x00, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00, 0x07,
+  0x80, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x00,
+  0xE0, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x00, 0x07, 0x00, 0x0F,
+  0x00, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x01, 0xC0, 0x1E,
+  0x03, 0xF8, 0x03, 0x80, 0x78, 0x1F, 0xFC, 0xFF, 0xF8, 0xE0, 0x30, 0x3D,
+  0xFF, 0xF3, 0xC0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x3C,
+  0x00, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x0F,
+  0x80, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x78,
+  0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x00, 0x7C,
+  0x00, 0x0E, 0x00, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xF0,
+  0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x7F, 0xFC, 0x0F, 0x00, 0x00, 0xFF,
+  0xF8, 0x03, 0xF0, 0x00, 0x01, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xC0, 0x08,
+  0x1E, 0x00, 0x07, 0x80, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00,
+  0x1E, 0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x07, 0xF0, 0x00, 0x78, 0x00, 0x07, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x38,
+  0x01, 0xE0, 0x00, 0x00, 0x1C, 0x03, 0xC0, 0x00, 0x00, 0x1C, 0x03, 0x80,
+  0x00, 0x00, 0x1C, 0x07, 0x80, 0x00, 0x00, 0x1C, 0x0F, 0x00, 0x00, 0x00,
+  0x38, 0x1E, 0x00, 0x1E, 0xC0, 0xF8, 0x3C, 0x00, 0x3E, 0xFF, 0xE0, 0x38,
+  0x00, 0x7E, 0x3F, 0x80, 0x78, 0x00, 0xEC, 0x00, 0x00, 0xF0, 0x00, 0xCC,
+  0x00, 0x01, 0xE0, 0x01, 0xDC, 0x00, 0x03, 0xC0, 0x03, 0x9C, 0x00, 0x03,
+  0x80, 0x07, 0x1C, 0x00, 0x07, 0x80, 0x0E, 0x1C, 0x00, 0x0F, 0x00, 0x1C,
+  0x38, 0x00, 0x1E, 0x00, 0x38, 0x38, 0x00, 0x3C, 0x00, 0x70, 0x38, 0x00,
+  0x78, 0x00, 0x7F, 0xFF, 0x00, 0x70, 0x00, 0x7F, 0xFE, 0x00, 0xF0, 0x00,
+  0x00, 0x38, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x03, 0xC0, 0x00, 0x00, 0x70,
+  0x07, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0,
+  0x01, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01,
+  0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
+  0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00,
+  0x3C, 0x00, 0x1E, 0x00, 0x1F, 0x80, 0x3B, 0xE0, 0x7D, 0xFF, 0xFC, 0x7F,
+  0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x01, 0xF1,
+  0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x0F, 0x83, 0xC0,
+  0x00, 0x7C, 0x1E, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x3C, 0x03, 0xC0, 0x03,
+  0xE0, 0x1E, 0x00, 0x1E, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0x80, 0x1F, 0x00,
+  0x1E, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC,
+  0x07, 0xC0, 0x01, 0xE0, 0x7C, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x3C, 0x3E,
+  0x00, 0x01, 0xE1, 0xE0, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x79, 0xF0, 0x00,
+  0x03, 0xEF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xEF, 0x00, 0x00,
+  0x1E, 0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF8,
+  0x78, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x7C, 0x1E, 0x00, 0x07, 0xC0, 0x78,
+  0x00, 0x3C, 0x03, 0xC0, 0x03, 0xE0, 0x1E, 0x00, 0x1E, 0x00, 0xF0, 0x01,
+  0xF0, 0x07, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x07, 0xC0, 0x01, 0xE0, 0x7C, 0x00, 0x0F,
+  0x83, 0xC0, 0x00, 0x3C, 0x3E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x0F, 0x1F,
+  0x00, 0x00, 0x79, 0xF0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1E,
+  0xE0, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x1E, 0x1C, 0x00, 0x01, 0xE0, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
+  0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x03, 0xEF, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00,
+  0x0F, 0x0F, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x7C,
+  0x1E, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xE0, 0x1E,
+  0x00, 0x1E, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0x80, 0x1F, 0x00, 0x1E, 0x00,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x07, 0xC0,
+  0x01, 0xE0, 0x7C, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x3C, 0x3E, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x03, 0xEF,
+  0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x70, 0x00,
+  0x0F, 0xE7, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0x3F, 0x80, 0x00, 0x70,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0x7D, 0xE0, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x3E, 0x3C,
+  0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1F, 0x0F, 0x00, 0x01, 0xF0, 0x78, 0x00,
+  0x0F, 0x83, 0xC0, 0x00, 0xF8, 0x0F, 0x00, 0x07, 0x80, 0x78, 0x00, 0x7C,
+  0x03, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x3E, 0x00, 0xF0, 0x03, 0xE0, 0x03,
+  0xC0, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80,
+  0xF8, 0x00, 0x3C, 0x0F, 0x80, 0x01, 0xF0, 0x78, 0x00, 0x07, 0x87, 0xC0,
+  0x00, 0x3C, 0x3C, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x0F, 0x3E, 0x00, 0x00,
+  0x7D, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xE1, 0xE0,
+  0x00, 0x1F, 0x0F, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x07, 0x87, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x0F, 0xBC, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x3C,
+  0x3C, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x01, 0xF0, 0x78,
+  0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x80, 0x78, 0x00,
+  0x78, 0x03, 0xC0, 0x07, 0xC0, 0x1E, 0x00, 0x7C, 0x00, 0x78, 0x03, 0xFF,
+  0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x07,
+  0x81, 0xF0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0x3C, 0x7C, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0x0F, 0xBE, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1C, 0x0E,
+  0x00, 0x00, 0xE0, 0x70, 0x00, 0x07, 0x03, 0x80, 0x00, 0x38, 0x1C, 0x00,
+  0x00, 0xE1, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x3D, 0xF0, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x3E, 0x3C, 0x00,
+  0x01, 0xF1, 0xE0, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x0F,
+  0x81, 0xE0, 0x00, 0xF8, 0x0F, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x7C, 0x03,
+  0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0xC0,
+  0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0xF8,
+  0x00, 0x3C, 0x0F, 0x80, 0x00, 0xF0, 0x7C, 0x00, 0x07, 0x87, 0xC0, 0x00,
+  0x3C, 0x3C, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x7D,
+  0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF9, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x7C, 0x78, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0x00,
+  0x3C, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x3E,
+  0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x03,
+  0xC0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0x81, 0xFF,
+  0xFF, 0xE0, 0x00, 0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0x80, 0x78, 0x00,
+  0x00, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00,
+  0x00, 0x3E, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x80,
+  0x0F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x00, 0x07, 0xC0, 0x03,
+  0xC0, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xFF,
+  0xFF, 0xF0, 0x3E, 0x00, 0x0F, 0xFF, 0xFF, 0x83, 0xE0, 0x00, 0x7F, 0xFF,
+  0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
+  0xE0, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x06, 0x07,
+  0x80, 0x00, 0x20, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x3C, 0x00, 0x03,
+  0x03, 0xE0, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x00, 0xFF, 0xFF, 0xE0, 0x03,
+  0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x1E, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
+  0xE0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0x80, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
+  0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xE0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0x80, 0x00,
+  0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7B, 0x80,
+  0x00, 0x3C, 0xF0, 0x00, 0x1E, 0x1C, 0x00, 0x0F, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xE0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07,
+  0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x0F, 0x87, 0x80, 0x03,
+  0xC3, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xF0, 0x7F, 0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
+  0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x78, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x00, 0x0F,
+  0x00, 0xF0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x01, 0xE0, 0x7C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+  0x0F, 0x03, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x3E, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0xE0,
+  0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01,
+  0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0,
+  0x03, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01,
+  0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0,
+  0x00, 0x01, 0xF0, 0x07, 0xF0, 0x1E, 0xE0, 0x79, 0xE1, 0xE1, 0xC7, 0x81,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+  0x7C, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
+  0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x3E, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x1E, 0x1E, 0x7C, 0x3C, 0xF0, 0xF9,
+  0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07,
+  0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+  0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07,
+  0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0,
+  0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
+  0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x1E, 0x00, 0x3F, 0x80,
+  0x3C, 0x00, 0x1F, 0x80, 0x78, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0x03,
+  0xE0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x3C, 0x1E,
+  0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+  0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0x87, 0x80, 0x00, 0x0F, 0x0F, 0x00,
+  0x00, 0x1E, 0x3E, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0xF0, 0xF0, 0x00,
+  0x01, 0xE1, 0xE0, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00,
+  0x3C, 0x1F, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x03, 0xE0, 0x78, 0x00, 0x0F,
+  0x80, 0xF0, 0x00, 0x7E, 0x01, 0xE0, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC1,
+  0xC0, 0x00, 0x1F, 0xCE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0x9F, 0xC0,
+  0x00, 0x1C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x3F,
+  0x80, 0x03, 0xC1, 0xFE, 0x00, 0x1F, 0x07, 0xF8, 0x00, 0x78, 0x1F, 0xF0,
+  0x01, 0xE0, 0x7B, 0xC0, 0x07, 0x81, 0xEF, 0x00, 0x1E, 0x07, 0xBE, 0x00,
+  0xF8, 0x3C, 0x78, 0x03, 0xC0, 0xF1, 0xE0, 0x0F, 0x03, 0xC7, 0xC0, 0x3C,
+  0x0F, 0x0F, 0x00, 0xF0, 0x3C, 0x3C, 0x07, 0xC1, 0xE0, 0xF8, 0x1E, 0x07,
+  0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0,
+  0x3C, 0x1E, 0x0F, 0x80, 0xF0, 0xF0, 0x3C, 0x03, 0xC3, 0xC0, 0xF0, 0x07,
+  0x8F, 0x03, 0xC0, 0x1E, 0x3C, 0x0F, 0x00, 0x78, 0xF0, 0x7C, 0x00, 0xF7,
+  0x81, 0xE0, 0x03, 0xDE, 0x07, 0x80, 0x0F, 0x78, 0x1E, 0x00, 0x1F, 0xE0,
+  0x78, 0x00, 0x7F, 0x83, 0xE0, 0x01, 0xFE, 0x0F, 0x00, 0x03, 0xF0, 0x3C,
+  0x00, 0x0F, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0,
+  0x00, 0xFC, 0x07, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x00, 0x0F, 0x01,
+  0xE0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xF1, 0xE0,
+  0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x00, 0xF7, 0x80, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E,
+  0xF0, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x3C,
+  0x00, 0x00, 0x78, 0xF0, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x0F, 0x07, 0x80,
+  0x00, 0x78, 0x0F, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x03,
+  0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFC,
+  0x07, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x00, 0x0F, 0x01, 0xE0, 0x00,
+  0x1E, 0x0F, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x03,
+  0xCF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0xF7,
+  0x80, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E, 0xF0, 0x00,
+  0x00, 0x7B, 0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00,
+  0x78, 0xF0, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x78,
+  0x0F, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x03, 0xF0, 0x00,
+  0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x70, 0x00, 0x00,
+  0x79, 0xE0, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x1E, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFC, 0x07, 0xE0,
+  0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x1E, 0x0F,
+  0x00, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x03, 0xCF, 0x00,
+  0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0xF7, 0x80, 0x00,
+  0x03, 0xDE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x7B,
+  0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x78, 0xF0,
+  0x00, 0x03, 0xE1, 0xE0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x78, 0x0F, 0x00,
+  0x03, 0xC0, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xE0,
+  0xE0, 0x00, 0x0F, 0xE7, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xCF, 0xE0,
+  0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07,
+  0xFF, 0xFC, 0x00, 0x3F, 0x01, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x0F, 0x00,
+  0x03, 0xC0, 0x78, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x1E, 0x1F, 0x00, 0x00,
+  0x7C, 0x78, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F,
+  0x78, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xEF, 0x00,
+  0x00, 0x07, 0xBC, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
+  0x03, 0xCF, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x03,
+  0xC1, 0xE0, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0xF0, 0x0F, 0x80, 0x0F, 0x80,
+  0x1F, 0x80, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1F, 0x0F, 0x00, 0x00,
+  0x78, 0x7C, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x7C, 0x00, 0x7C,
+  0x03, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x07, 0x87,
+  0xC0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0xF3, 0xC0,
+  0x00, 0x03, 0xDE, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+  0x7B, 0xC0, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x3C,
+  0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x3E, 0x1E,
+  0x00, 0x00, 0xF0, 0x78, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x3C, 0x03, 0xE0,
+  0x03, 0xE0, 0x07, 0xE0, 0x3F, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x02, 0x60, 0x00, 0x06,
+  0xF0, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x78,
+  0x0F, 0x00, 0xF0, 0x07, 0x81, 0xE0, 0x03, 0xC3, 0xC0, 0x01, 0xE7, 0x80,
+  0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00,
+  0x01, 0xE7, 0x80, 0x03, 0xC3, 0xC0, 0x07, 0x81, 0xE0, 0x0F, 0x00, 0xF0,
+  0x1E, 0x00, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F,
+  0x60, 0x00, 0x06, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x07, 0xF8, 0x0E, 0x00, 0x03, 0xFF, 0xF1, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
+  0x00, 0x1F, 0x80, 0xFF, 0x80, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x78, 0x00,
+  0x1F, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x3E,
+  0x00, 0x0F, 0x78, 0x03, 0xC0, 0x01, 0xE7, 0x80, 0x78, 0x00, 0x3C, 0x78,
+  0x07, 0x80, 0x07, 0x87, 0x80, 0xF0, 0x01, 0xF0, 0x78, 0x0F, 0x00, 0x3E,
+  0x07, 0x80, 0xF0, 0x07, 0xC0, 0x78, 0x1F, 0x00, 0xF0, 0x07, 0x81, 0xE0,
+  0x1E, 0x00, 0xF8, 0x1E, 0x03, 0xC0, 0x0F, 0x01, 0xE0, 0x78, 0x00, 0xF0,
+  0x1E, 0x0F, 0x00, 0x0F, 0x01, 0xE1, 0xE0, 0x01, 0xE0, 0x1E, 0x3C, 0x00,
+  0x1E, 0x01, 0xE7, 0x80, 0x03, 0xC0, 0x1F, 0xF0, 0x00, 0x7C, 0x00, 0xFE,
+  0x00, 0x07, 0x80, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x1E, 0x00,
+  0x0F, 0xC0, 0x07, 0xC0, 0x03, 0xFF, 0x01, 0xF8, 0x00, 0x79, 0xFF, 0xFF,
+  0x00, 0x0F, 0x0F, 0xFF, 0xC0, 0x00, 0xE0, 0x1F, 0xE0, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E,
+  0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
+  0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00,
+  0x07, 0x87, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0,
+  0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1E, 0x0F, 0x00,
+  0x01, 0xE0, 0xF0, 0x00, 0x3C, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0xF8,
+  0x07, 0xE0, 0x3F, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E,
+  0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
+  0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00,
+  0x07, 0x87, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0,
+  0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1E, 0x0F, 0x00,
+  0x01, 0xE0, 0xF0, 0x00, 0x3C, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0xF8,
+  0x07, 0xE0, 0x3F, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07,
+  0xB8, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1E, 0x1C, 0x00, 0x03, 0xC0, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x1F, 0x1E, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E,
+  0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
+  0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00,
+  0x07, 0x87, 0x80, 0x00, 0xF0, 0x78, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0,
+  0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x1E, 0x0F, 0x00,
+  0x01, 0xE0, 0xF0, 0x00, 0x3C, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0xF8,
+  0x07, 0xE0, 0x3F, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x3C,
+  0x3E, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xF0,
+  0x00, 0x1F, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01,
+  0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3C, 0x3C,
+  0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
+  0x3C, 0x3C, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87,
+  0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0xF0, 0x78, 0x00,
+  0x0F, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0xE0,
+  0xF0, 0x00, 0x1E, 0x0F, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x3C, 0x0F, 0x80,
+  0x07, 0xC0, 0x7C, 0x00, 0xF8, 0x07, 0xE0, 0x3F, 0x00, 0x3F, 0xFF, 0xE0,
+  0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0xE0, 0x00, 0x3E, 0x7C,
+  0x00, 0x1F, 0x0F, 0x00, 0x0F, 0x83, 0xE0, 0x07, 0xE0, 0x78, 0x03, 0xF0,
+  0x1F, 0x01, 0xF8, 0x03, 0xC0, 0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x1E, 0x1F,
+  0x00, 0x07, 0xCF, 0x80, 0x00, 0xF7, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07,
+  0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80,
+  0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xFC, 0x0F, 0x00, 0x7E, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x1F, 0x0F, 0x00,
+  0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00,
+  0x0F, 0x1E, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3C, 0x00, 0x3E, 0x3C, 0x00,
+  0x7C, 0x3C, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF,
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF,
+  0xE0, 0x03, 0xFF, 0xE0, 0x0F, 0x83, 0xE0, 0x3E, 0x03, 0xE0, 0xF8, 0x03,
+  0xC1, 0xE0, 0x07, 0x83, 0xC0, 0x0F, 0x0F, 0x80, 0xFE, 0x1E, 0x07, 0xF8,
+  0x3C, 0x1F, 0x00, 0x78, 0x7C, 0x00, 0xF0, 0xF0, 0x01, 0xE3, 0xC0, 0x07,
+  0x87, 0x80, 0x0F, 0x0F, 0x00, 0x1E, 0x1F, 0x00, 0x3C, 0x3F, 0x00, 0x78,
+  0x3F, 0x01, 0xF0, 0x3F, 0x03, 0xC0, 0x3F, 0x07, 0x80, 0x3F, 0x0F, 0x00,
+  0x3E, 0x1E, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00,
+  0xF3, 0xC0, 0x01, 0xE7, 0x80, 0x07, 0x8F, 0x20, 0x3E, 0x3E, 0xFF, 0xF8,
+  0x79, 0xFF, 0xE0, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x70, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFE,
+  0x01, 0xFF, 0xFC, 0x0F, 0x01, 0xF8, 0x20, 0x01, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x3F,
+  0xFF, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xE3, 0xF0, 0x07, 0x9F, 0x00, 0x1E,
+  0x78, 0x00, 0x7B, 0xC0, 0x03, 0xEF, 0x00, 0x0F, 0x3C, 0x00, 0x7C, 0xF0,
+  0x03, 0xF3, 0xE0, 0x1F, 0xC7, 0xC1, 0xFE, 0x1F, 0xFF, 0x78, 0x3F, 0xF9,
+  0xE0, 0x3F, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x80, 0xF0, 0x1F, 0x81, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x07,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xC0, 0x1E, 0x3E, 0x00,
+  0x3C, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xF3, 0xC0, 0x03, 0xC7, 0x80, 0x0F,
+  0x8F, 0x00, 0x3F, 0x1F, 0x00, 0xFE, 0x1F, 0x07, 0xF8, 0x3F, 0xFE, 0xF0,
+  0x3F, 0xF9, 0xE0, 0x1F, 0x83, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00,
+  0x01, 0xFC, 0x00, 0x07, 0x70, 0x00, 0x39, 0xC0, 0x01, 0xC3, 0x80, 0x0E,
+  0x0E, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFE,
+  0x01, 0xFF, 0xFC, 0x0F, 0x01, 0xF8, 0x20, 0x01, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x3F,
+  0xFF, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xE3, 0xF0, 0x07, 0x9F, 0x00, 0x1E,
+  0x78, 0x00, 0x7B, 0xC0, 0x03, 0xEF, 0x00, 0x0F, 0x3C, 0x00, 0x7C, 0xF0,
+  0x03, 0xF3, 0xE0, 0x1F, 0xC7, 0xC1, 0xFE, 0x1F, 0xFF, 0x78, 0x3F, 0xF9,
+  0xE0, 0x3F, 0x07, 0x80, 0x00, 0x3C, 0x1C, 0x01, 0xF8, 0x70, 0x0F, 0xF3,
+  0x80, 0x39, 0xFE, 0x01, 0xC3, 0xF0, 0x07, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x03, 0xC0,
+  0x7E, 0x08, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xC1, 0xFF, 0xFF, 0x1F,
+  0xFF, 0xF8, 0xFC, 0x01, 0xE7, 0xC0, 0x07, 0x9E, 0x00, 0x1E, 0xF0, 0x00,
+  0xFB, 0xC0, 0x03, 0xCF, 0x00, 0x1F, 0x3C, 0x00, 0xFC, 0xF8, 0x07, 0xF1,
+  0xF0, 0x7F, 0x87, 0xFF, 0xDE, 0x0F, 0xFE, 0x78, 0x0F, 0xC1, 0xE0, 0x00,
+  0x78, 0x78, 0x03, 0xE1, 0xE0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x03, 0xC0, 0x7E, 0x08, 0x00, 0x7C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0xF0, 0x0F, 0xFF, 0xC1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xFC, 0x01, 0xE7,
+  0xC0, 0x07, 0x9E, 0x00, 0x1E, 0xF0, 0x00, 0xFB, 0xC0, 0x03, 0xCF, 0x00,
+  0x1F, 0x3C, 0x00, 0xFC, 0xF8, 0x07, 0xF1, 0xF0, 0x7F, 0x87, 0xFF, 0xDE,
+  0x0F, 0xFE, 0x78, 0x0F, 0xC1, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0x80,
+  0x03, 0xFF, 0x00, 0x1E, 0x1C, 0x00, 0x70, 0x38, 0x01, 0xC0, 0xE0, 0x07,
+  0x03, 0x80, 0x1C, 0x0E, 0x00, 0x78, 0x70, 0x00, 0xFF, 0xC0, 0x01, 0xFE,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFE, 0x01,
+  0xFF, 0xFC, 0x0F, 0x01, 0xF8, 0x20, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x3F, 0xFF,
+  0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xE3, 0xF0, 0x07, 0x9F, 0x00, 0x1E, 0x78,
+  0x00, 0x7B, 0xC0, 0x03, 0xEF, 0x00, 0x0F, 0x3C, 0x00, 0x7C, 0xF0, 0x03,
+  0xF3, 0xE0, 0x1F, 0xC7, 0xC1, 0xFE, 0x1F, 0xFF, 0x78, 0x3F, 0xF9, 0xE0,
+  0x3F, 0x07, 0x80, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFF, 0xC1, 0xFF,
+  0xE0, 0x1F, 0xFF, 0xCF, 0xFF, 0xE0, 0x78, 0x0F, 0xFF, 0x07, 0xE0, 0x80,
+  0x07, 0xF8, 0x07, 0xC0, 0x00, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x0F, 0x80,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0x00,
+  0x00, 0x70, 0x00, 0x3C, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE0, 0x0E, 0x00, 0x00, 0x1F,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x07, 0xE0, 0x00, 0x07,
+  0x80, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x7F, 0xC0, 0x01, 0x0F, 0x83, 0xE7,
+  0xE0, 0x1E, 0x1F, 0xFF, 0x8F, 0xFF, 0xF8, 0x1F, 0xFE, 0x07, 0xFF, 0xF0,
+  0x0F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0xC0, 0xFF,
+  0xFE, 0x0F, 0xC0, 0xF0, 0xF8, 0x01, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0,
+  0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x08,
+  0x1F, 0x01, 0xC0, 0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x07,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x08, 0x78, 0x00,
+  0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01,
+  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x80, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7E, 0x0F, 0xC1, 0xF0, 0x0F,
+  0x87, 0xC0, 0x0F, 0x8F, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x3D,
+  0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0,
+  0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x02, 0x0F, 0xC0,
+  0x3C, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7E, 0x0F, 0xC1,
+  0xF0, 0x0F, 0x87, 0xC0, 0x0F, 0x8F, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x78,
+  0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x02,
+  0x0F, 0xC0, 0x3C, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xEE, 0x00,
+  0x03, 0x9C, 0x00, 0x0E, 0x1C, 0x00, 0x38, 0x38, 0x00, 0xE0, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7E,
+  0x0F, 0xC1, 0xF0, 0x0F, 0x87, 0xC0, 0x0F, 0x8F, 0x00, 0x0F, 0x3C, 0x00,
+  0x1E, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F,
+  0x80, 0x02, 0x0F, 0xC0, 0x3C, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07,
+  0xFF, 0x00, 0x00, 0x78, 0x78, 0x01, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x07,
+  0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x3F, 0x07,
+  0xE0, 0xF8, 0x07, 0xC3, 0xE0, 0x07, 0xC7, 0x80, 0x07, 0x9E, 0x00, 0x0F,
+  0x3C, 0x00, 0x1E, 0xF0, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
+  0x01, 0x07, 0xE0, 0x1E, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF,
+  0x80, 0x7C, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x38, 0x0F, 0x00,
+  0x00, 0x00, 0x78, 0x1E, 0x0F, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xC1,
+  0xE0, 0x78, 0x1E, 0x07, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xE0,
+  0x78, 0x1E, 0x07, 0x81, 0xE0, 0xF0, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00,
+  0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+  0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x3E, 0x03, 0xF8, 0x1D, 0xC1, 0xCE,
+  0x1C, 0x39, 0xC1, 0xDC, 0x07, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x00,
+  0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0x00,
+  0x3C, 0x3D, 0xF0, 0xF7, 0x87, 0x9E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x3C,
+  0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0xF8, 0x1C, 0x00, 0xF9, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFC,
+  0x00, 0x0F, 0xF0, 0x01, 0xFD, 0xE0, 0x03, 0xC3, 0xE0, 0x00, 0x03, 0xE0,
+  0x00, 0x03, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x81,
+  0xF8, 0x1F, 0x03, 0xC0, 0x1F, 0x0F, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78,
+  0x00, 0x79, 0xE0, 0x00, 0xF3, 0xC0, 0x01, 0xEF, 0x00, 0x03, 0xDE, 0x00,
+  0x07, 0xBC, 0x00, 0x1E, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x01,
+  0xE3, 0xC0, 0x03, 0xC7, 0xC0, 0x0F, 0x07, 0x80, 0x3E, 0x0F, 0xC1, 0xF8,
+  0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1E, 0x0E,
+  0x00, 0x7E, 0x1C, 0x01, 0xFE, 0x70, 0x03, 0x9F, 0xE0, 0x0E, 0x1F, 0x80,
+  0x1C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F,
+  0x3F, 0xF0, 0x1E, 0xFF, 0xF0, 0x7F, 0x83, 0xE0, 0xFE, 0x03, 0xE1, 0xF8,
+  0x03, 0xC3, 0xE0, 0x07, 0x87, 0x80, 0x0F, 0x1F, 0x00, 0x1E, 0x3C, 0x00,
+  0x3C, 0x78, 0x00, 0xF8, 0xF0, 0x01, 0xE1, 0xE0, 0x03, 0xC7, 0x80, 0x07,
+  0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x7C, 0x78, 0x00, 0xF1,
+  0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E,
+  0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x01,
+  0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x70, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x1F, 0xFC, 0x00, 0xFF, 0xFC, 0x07, 0xC1, 0xF0, 0x3C, 0x01, 0xE1, 0xE0,
+  0x07, 0x8F, 0x80, 0x0F, 0x3C, 0x00, 0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03,
+  0xDE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x0F, 0x3C, 0x00,
+  0x7C, 0x78, 0x01, 0xE1, 0xE0, 0x0F, 0x03, 0xE0, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x0F, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x07,
+  0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x7C, 0x1F, 0x01, 0xE0, 0x0F, 0x07, 0x80,
+  0x1E, 0x1F, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00,
+  0xF3, 0xC0, 0x01, 0xEF, 0x00, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x0F,
+  0x78, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF3, 0xC0, 0x03, 0xC7,
+  0x80, 0x0F, 0x87, 0x80, 0x1E, 0x0F, 0x00, 0x78, 0x0F, 0x83, 0xE0, 0x1F,
+  0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x3E, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x70, 0x00, 0x39, 0xC0, 0x01, 0xC3,
+  0x80, 0x0E, 0x0E, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x1F, 0xFC, 0x00, 0xFF, 0xFC, 0x07, 0xC1, 0xF0, 0x3C, 0x01, 0xE1, 0xE0,
+  0x07, 0x8F, 0x80, 0x0F, 0x3C, 0x00, 0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03,
+  0xDE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x0F, 0x3C, 0x00,
+  0x7C, 0x78, 0x01, 0xE1, 0xE0, 0x0F, 0x03, 0xE0, 0xF8, 0x0F, 0xFF, 0xC0,
+  0x0F, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3C, 0x1C, 0x01, 0xF8, 0x70,
+  0x0F, 0xF3, 0x80, 0x39, 0xFE, 0x01, 0xC3, 0xF0, 0x07, 0x07, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF,
+  0x01, 0xF0, 0x7C, 0x0F, 0x00, 0x78, 0x78, 0x01, 0xE3, 0xE0, 0x03, 0xCF,
+  0x00, 0x0F, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xBC, 0x00, 0x1E,
+  0xF0, 0x00, 0x7B, 0xC0, 0x03, 0xCF, 0x00, 0x1F, 0x1E, 0x00, 0x78, 0x78,
+  0x03, 0xC0, 0xF8, 0x3E, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x07, 0xF8,
+  0x00, 0x00, 0x78, 0x78, 0x03, 0xE1, 0xE0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x01, 0xF0, 0x7C, 0x0F, 0x00,
+  0x78, 0x78, 0x01, 0xE3, 0xE0, 0x03, 0xCF, 0x00, 0x0F, 0x78, 0x00, 0x3D,
+  0xE0, 0x00, 0xF7, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x03,
+  0xCF, 0x00, 0x1F, 0x1E, 0x00, 0x78, 0x78, 0x03, 0xC0, 0xF8, 0x3E, 0x03,
+  0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFE, 0x1C, 0x00, 0xFF, 0xF7, 0x00,
+  0x3F, 0xFF, 0xC0, 0x0F, 0x83, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
+  0xC0, 0x3C, 0x01, 0xFC, 0x07, 0x80, 0x77, 0x81, 0xE0, 0x1C, 0xF0, 0x3C,
+  0x07, 0x9E, 0x07, 0x81, 0xE3, 0xC1, 0xE0, 0x78, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x87, 0x81, 0xE0, 0xF1, 0xE0, 0x78, 0x1E, 0x78, 0x0F, 0x03, 0xDE,
+  0x01, 0xE0, 0x7F, 0x80, 0x78, 0x0F, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xC0,
+  0x1E, 0x00, 0xF0, 0x03, 0xF0, 0x7C, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF,
+  0xC0, 0x0E, 0x1F, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80,
+  0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00,
+  0xF1, 0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F,
+  0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xE3,
+  0xC0, 0x07, 0xC7, 0x80, 0x1F, 0x0F, 0x00, 0x3E, 0x1F, 0x01, 0xFC, 0x3F,
+  0x07, 0x78, 0x3F, 0xFD, 0xF0, 0x3F, 0xF3, 0xC0, 0x3F, 0x87, 0x80, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03,
+  0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C,
+  0x78, 0x00, 0xF1, 0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F,
+  0x00, 0x0F, 0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0,
+  0x03, 0xE3, 0xC0, 0x07, 0xC7, 0x80, 0x1F, 0x0F, 0x00, 0x3E, 0x1F, 0x01,
+  0xFC, 0x3F, 0x07, 0x78, 0x3F, 0xFD, 0xF0, 0x3F, 0xF3, 0xC0, 0x3F, 0x87,
+  0x80, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xEE,
+  0x00, 0x03, 0x9C, 0x00, 0x0E, 0x1C, 0x00, 0x38, 0x38, 0x00, 0xE0, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1,
+  0xE0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C,
+  0x00, 0x3C, 0x78, 0x00, 0xF1, 0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80,
+  0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x78, 0xF0, 0x00,
+  0xF1, 0xE0, 0x03, 0xE3, 0xC0, 0x07, 0xC7, 0x80, 0x1F, 0x0F, 0x00, 0x3E,
+  0x1F, 0x01, 0xFC, 0x3F, 0x07, 0x78, 0x3F, 0xFD, 0xF0, 0x3F, 0xF3, 0xC0,
+  0x3F, 0x87, 0x80, 0x00, 0x78, 0x78, 0x01, 0xF0, 0xF0, 0x03, 0xC3, 0xC0,
+  0x07, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0,
+  0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00,
+  0x1E, 0x3C, 0x00, 0x78, 0xF8, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03,
+  0xC7, 0x80, 0x07, 0x8F, 0x00, 0x1E, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0x78,
+  0xF0, 0x01, 0xF1, 0xE0, 0x03, 0xE3, 0xC0, 0x0F, 0x87, 0x80, 0x1F, 0x0F,
+  0x80, 0xFE, 0x1F, 0x83, 0xBC, 0x1F, 0xFE, 0xF8, 0x1F, 0xF9, 0xE0, 0x1F,
+  0xC3, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3C, 0x00, 0x0F, 0x87, 0xC0, 0x03, 0xE0, 0x78, 0x00, 0x7C, 0x0F, 0x00,
+  0x1F, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00,
+  0x78, 0x07, 0xC0, 0x0F, 0x01, 0xF0, 0x01, 0xE0, 0x3C, 0x00, 0x3E, 0x0F,
+  0x80, 0x03, 0xC1, 0xE0, 0x00, 0x78, 0x7C, 0x00, 0x0F, 0x0F, 0x00, 0x01,
+  0xE3, 0xE0, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC3, 0xF0, 0x01, 0xE7, 0xFE, 0x00,
+  0xF7, 0xFF, 0x80, 0x7F, 0x87, 0xE0, 0x3F, 0x00, 0xF0, 0x3F, 0x00, 0x7C,
+  0x1F, 0x80, 0x1E, 0x0F, 0x80, 0x0F, 0x07, 0xC0, 0x07, 0x83, 0xC0, 0x03,
+  0xC3, 0xE0, 0x01, 0xE1, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x78, 0x78, 0x00,
+  0x78, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x1F, 0x00, 0x1F, 0x0F, 0x80,
+  0x0F, 0x07, 0xC0, 0x0F, 0x83, 0xE0, 0x07, 0x81, 0xF8, 0x07, 0x81, 0xEE,
+  0x0F, 0x80, 0xF7, 0xFF, 0x80, 0x79, 0xFF, 0x80, 0x3C, 0x3F, 0x00, 0x1E,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03,
+  0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xE1, 0xE0, 0x00,
+  0x78, 0x78, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0x7C, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xE0, 0x78, 0x00, 0xF8,
+  0x0F, 0x00, 0x1E, 0x01, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0xF0, 0x03, 0xC0,
+  0x3E, 0x00, 0x78, 0x0F, 0x80, 0x0F, 0x01, 0xE0, 0x01, 0xF0, 0x7C, 0x00,
+  0x1E, 0x0F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x78, 0x78, 0x00, 0x0F, 0x1F,
+  0x00, 0x00, 0xF7, 0xC0, 0x00, 0x1E, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x03, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
+  {     1,  10,  31,  17,    3,  -30 },   // 0x21 '!'
+  {    40,  12,  12,  20,    4,  -30 },   // 0x22 '"'
+  {    58,  30,  31,  36,    3,  -30 },   // 0x23 '#'
+  {   175,  23,  39,  27,    2,  -32 },   // 0x24 '$'
+  {   288,  33,  32,  41,    4,  -31 },   // 0x25 '%'
+  {   420,  30,  32,  34,    2,  -31 },   // 0x26 '&'
+  {   540,   4,  12,  12,    4,  -30 },   // 0x27 '''
+  {   546,  15,  38,  17,    3,  -32 },   // 0x28 '('
+  {   618,  15,  38,  17,   -3,  -32 },   // 0x29 ')'
+  {   690,  18,  20,  22,    2,  -31 },   // 0x2A '*'
+  {   735,  27,  27,  36,    5,  -26 },   // 0x2B '+'
+  {   827,   8,  10,  14,    0,   -4 },   // 0x2C ','
+  {   837,  12,   5,  16,    2,  -13 },   // 0x2D '-'
+  {   845,   5,   5,  14,    3,   -4 },   // 0x2E '.'
+  {   849,  22,  35,  14,   -3,  -30 },   // 0x2F '/'
+  {   946,  23,  32,  27,    3,  -31 },   // 0x30 '0'
+  {  1038,  20,  31,  27,    2,  -30 },   // 0x31 '1'
+  {  1116,  26,  32,  27,    0,  -31 },   // 0x32 '2'
+  {  1220,  25,  32,  27,    0,  -31 },   // 0x33 '3'
+  {  1320,  23,  31,  27,    1,  -30 },   // 0x34 '4'
+  {  1410,  24,  31,  27,    1,  -30 },   // 0x35 '5'
+  {  1503,  22,  32,  27,    3,  -31 },   // 0x36 '6'
+  {  1591,  23,  31,  27,    4,  -30 },   // 0x37 '7'
+  {  1681,  24,  32,  27,    1,  -31 },   // 0x38 '8'
+  {  1777,  23,  32,  27,    1,  -31 },   // 0x39 '9'
+  {  1869,   8,  22,  14,    2,  -21 },   // 0x3A ':'
+  {  1891,  11,  27,  14,    0,  -21 },   // 0x3B ';'
+  {  1929,  27,  23,  36,    5,  -24 },   // 0x3C '<'
+  {  2007,  27,  11,  36,    5,  -18 },   // 0x3D '='
+  {  2045,  27,  23,  36,    5,  -24 },   // 0x3E '>'
+  {  2123,  17,  32,  23,    5,  -31 },   // 0x3F '?'
+  {  2191,  38,  38,  43,    3,  -29 },   // 0x40 '@'
+  {  2372,  29,  31,  29,   -2,  -30 },   // 0x41 'A'
+  {  2485,  26,  31,  30,    1,  -30 },   // 0x42 'B'
+  {  2586,  28,  32,  30,    2,  -31 },   // 0x43 'C'
+  {  2698,  30,  31,  33,    1,  -30 },   // 0x44 'D'
+  {  2815,  26,  31,  27,    1,  -30 },   // 0x45 'E'
+  {  2916,  24,  31,  25,    1,  -30 },   // 0x46 'F'
+  {  3009,  29,  32,  33,    2,  -31 },   // 0x47 'G'
+  {  3125,  30,  31,  32,    1,  -30 },   // 0x48 'H'
+  {  3242,  10,  31,  13,    1,  -30 },   // 0x49 'I'
+  {  3281,  19,  40,  13,   -7,  -30 },   // 0x4A 'J'
+  {  3376,  30,  31,  28,    1,  -30 },   // 0x4B 'K'
+  {  3493,  20,  31,  24,    1,  -30 },   // 0x4C 'L'
+  {  3571,  35,  31,  37,    1,  -30 },   // 0x4D 'M'
+  {  3707,  30,  31,  32,    1,  -30 },   // 0x4E 'N'
+  {  3824,  30,  32,  34,    2,  -31 },   // 0x4F 'O'
+  {  3944,  25,  31,  26,    1,  -30 },   // 0x50 'P'
+  {  4041,  30,  38,  34,    2,  -31 },   // 0x51 'Q'
+  {  4184,  25,  31,  30,    1,  -30 },   // 0x52 'R'
+  {  4281,  25,  32,  27,    1,  -31 },   // 0x53 'S'
+  {  4381,  27,  31,  26,    2,  -30 },   // 0x54 'T'
+  {  4486,  28,  31,  31,    3,  -30 },   // 0x55 'U'
+  {  4595,  29,  31,  29,    3,  -30 },   // 0x56 'V'
+  {  4708,  40,  31,  43,    4,  -30 },   // 0x57 'W'
+  {  4863,  32,  31,  29,   -2,  -30 },   // 0x58 'X'
+  {  4987,  26,  31,  26,    3,  -30 },   // 0x59 'Y'
+  {  5088,  31,  31,  29,   -1,  -30 },   // 0x5A 'Z'
+  {  5209,  16,  38,  17,    2,  -32 },   // 0x5B '['
+  {  5285,   8,  35,  14,    4,  -30 },   // 0x5C '\'
+  {  5320,  16,  38,  17,   -2,  -32 },   // 0x5D ']'
+  {  5396,  27,  12,  36,    5,  -30 },   // 0x5E '^'
+  {  5437,  22,   3,  22,    0,    8 },   // 0x5F '_'
+  {  5446,   9,   8,  22,    8,  -33 },   // 0x60 '`'
+  {  5455,  22,  25,  26,    2,  -24 },   // 0x61 'a'
+  {  5524,  24,  33,  27,    2,  -32 },   // 0x62 'b'
+  {  5623,  21,  25,  24,    2,  -24 },   // 0x63 'c'
+  {  5689,  26,  33,  27,    2,  -32 },   // 0x64 'd'
+  {  5797,  23,  25,  26,    2,  -24 },   // 0x65 'e'
+  {  5869,  18,  33,  15,    3,  -32 },   // 0x66 'f'
+  {  5944,  25,  34,  27,    1,  -24 },   // 0x67 'g'
+  {  6051,  23,  33,  27,    2,  -32 },   // 0x68 'h'
+  {  6146,  10,  33,  12,    2,  -32 },   // 0x69 'i'
+  {  6188,  17,  42,  12,   -5,  -32 },   // 0x6A 'j'
+  {  6278,  25,  33,  25,    2,  -32 },   // 0x6B 'k'
+  {  6382,  10,  33,  12,    2,  -32 },   // 0x6C 'l'
+  {  6424,  37,  25,  42,    2,  -24 },   // 0x6D 'm'
+  {  6540,  23,  25,  27,    2,  -24 },   // 0x6E 'n'
+  {  6612,  22,  25,  26,    2,  -24 },   // 0x6F 'o'
+  {  6681,  25,  34,  27,    0,  -24 },   // 0x70 'p'
+  {  6788,  24,  34,  27,    2,  -24 },   // 0x71 'q'
+  {  6890,  18,  25,  18,    2,  -24 },   // 0x72 'r'
+  {  6947,  21,  25,  22,    1,  -24 },   // 0x73 's'
+  {  7013,  15,  31,  17,    3,  -30 },   // 0x74 't'
+  {  7072,  23,  24,  27,    2,  -23 },   // 0x75 'u'
+  {  7141,  23,  24,  25,    3,  -23 },   // 0x76 'v'
+  {  7210,  32,  24,  35,    4,  -23 },   // 0x77 'w'
+  {  7306,  27,  24,  25,   -1,  -23 },   // 0x78 'x'
+  {  7387,  27,  33,  25,   -1,  -23 },   // 0x79 'y'
+  {  7499,  23,  24,  23,    0,  -23 },   // 0x7A 'z'
+  {  7568,  21,  40,  27,    5,  -32 },   // 0x7B '{'
+  {  7673,   4,  43,  14,    5,  -32 },   // 0x7C '|'
+  {  7695,  21,  40,  27,    0,  -32 },   // 0x7D '}'
+  {  7800,  27,   7,  36,    5,  -16 },   // 0x7E '~'
+  {  7824,  22,  38,  26,    2,  -29 },   // 0x7F
+  {  7929,  22,  38,  26,    2,  -29 },   // 0x80
+  {  8034,  22,  38,  26,    2,  -29 },   // 0x81
+  {  8139,  22,  38,  26,    2,  -29 },   // 0x82
+  {  8244,  22,  38,  26,    2,  -29 },   // 0x83
+  {  8349,  22,  38,  26,    2,  -29 },   // 0x84
+  {  8454,  22,  38,  26,    2,  -29 },   // 0x85
+  {  8559,  22,  38,  26,    2,  -29 },   // 0x86
+  {  8664,  22,  38,  26,    2,  -29 },   // 0x87
+  {  8769,  22,  38,  26,    2,  -29 },   // 0x88
+  {  8874,  22,  38,  26,    2,  -29 },   // 0x89
+  {  8979,  22,  38,  26,    2,  -29 },   // 0x8A
+  {  9084,  22,  38,  26,    2,  -29 },   // 0x8B
+  {  9189,  22,  38,  26,    2,  -29 },   // 0x8C
+  {  9294,  22,  38,  26,    2,  -29 },   // 0x8D
+  {  9399,  22,  38,  26,    2,  -29 },   // 0x8E
+  {  9504,  22,  38,  26,    2,  -29 },   // 0x8F
+  {  9609,  22,  38,  26,    2,  -29 },   // 0x90
+  {  9714,  22,  38,  26,    2,  -29 },   // 0x91
+  {  9819,  22,  38,  26,    2,  -29 },   // 0x92
+  {  9924,  22,  38,  26,    2,  -29 },   // 0x93
+  { 10029,  22,  38,  26,    2,  -29 },   // 0x94
+  { 10134,  22,  38,  26,    2,  -29 },   // 0x95
+  { 10239,  22,  38,  26,    2,  -29 },   // 0x96
+  { 10344,  22,  38,  26,    2,  -29 },   // 0x97
+  { 10449,  22,  38,  26,    2,  -29 },   // 0x98
+  { 10554,  22,  38,  26,    2,  -29 },   // 0x99
+  { 10659,  22,  38,  26,    2,  -29 },   // 0x9A
+  { 10764,  22,  38,  26,    2,  -29 },   // 0x9B
+  { 10869,  22,  38,  26,    2,  -29 },   // 0x9C
+  { 10974,  22,  38,  26,    2,  -29 },   // 0x9D
+  { 11079,  22,  38,  26,    2,  -29 },   // 0x9E
+  { 11184,  22,  38,  26,    2,  -29 },   // 0x9F
+  { 11289,   1,   1,  14,    0,    0 },   // 0xA0
+  { 11290,  10,  31,  17,    4,  -23 },   // 0xA1
+  { 11329,  21,  37,  27,    3,  -30 },   // 0xA2
+  { 11427,  27,  32,  27,    1,  -31 },   // 0xA3
+  { 11535,  24,  24,  27,    2,  -24 },   // 0xA4
+  { 11607,  28,  31,  27,    2,  -30 },   // 0xA5
+  { 11716,   4,  38,  14,    5,  -29 },   // 0xA6
+  { 11735,  21,  36,  22,   -1,  -31 },   // 0xA7
+  { 11830,  13,   4,  22,    8,  -32 },   // 0xA8
+  { 11837,  31,  31,  43,    6,  -30 },   // 0xA9
+  { 11958,  17,  21,  20,    2,  -31 },   // 0xAA
+  { 12003,  21,  19,  27,    3,  -21 },   // 0xAB
+  { 12053,  27,  12,  36,    5,  -17 },   // 0xAC
+  { 12094,  12,   5,  16,    2,  -13 },   // 0xAD
+  { 12102,  31,  31,  43,    6,  -30 },   // 0xAE
+  { 12223,  13,   3,  21,    8,  -31 },   // 0xAF
+  { 12228,  13,  13,  22,    4,  -31 },   // 0xB0
+  { 12250,  27,  27,  36,    4,  -26 },   // 0xB1
+  { 12342,  16,  18,  17,    2,  -31 },   // 0xB2
+  { 12378,  15,  18,  17,    1,  -31 },   // 0xB3
+  { 12412,  12,   8,  22,   11,  -33 },   // 0xB4
+  { 12424,  26,  33,  27,   -1,  -23 },   // 0xB5
+  { 12532,  20,  35,  27,    3,  -30 },   // 0xB6
+  { 12620,   5,   5,  14,    5,  -17 },   // 0xB7
+  { 12624,   9,   8,  22,    2,    1 },   // 0xB8
+  { 12633,  13,  18,  17,    3,  -31 },   // 0xB9
+  { 12663,  18,  21,  20,    2,  -31 },   // 0xBA
+  { 12711,  21,  19,  27,    3,  -21 },   // 0xBB
+  { 12761,  38,  32,  42,    3,  -31 },   // 0xBC
+  { 12913,  39,  32,  42,    3,  -31 },   // 0xBD
+  { 13069,  40,  32,  42,    1,  -31 },   // 0xBE
+  { 13229,  17,  33,  23,    2,  -23 },   // 0xBF
+  { 13300,  29,  41,  29,   -2,  -40 },   // 0xC0
+  { 13449,  29,  41,  29,   -2,  -40 },   // 0xC1
+  { 13598,  29,  41,  29,   -2,  -40 },   // 0xC2
+  { 13747,  29,  40,  29,   -2,  -39 },   // 0xC3
+  { 13892,  29,  39,  29,   -2,  -38 },   // 0xC4
+  { 14034,  29,  40,  29,   -2,  -39 },   // 0xC5
+  { 14179,  45,  31,  42,   -2,  -30 },   // 0xC6
+  { 14354,  28,  40,  30,    2,  -31 },   // 0xC7
+  { 14494,  26,  41,  27,    1,  -40 },   // 0xC8
+  { 14628,  26,  41,  27,    1,  -40 },   // 0xC9
+  { 14762,  26,  41,  27,    1,  -40 },   // 0xCA
+  { 14896,  26,  39,  27,    1,  -38 },   // 0xCB
+  { 15023,  11,  41,  13,    1,  -40 },   // 0xCC
+  { 15080,  15,  41,  13,    1,  -40 },   // 0xCD
+  { 15157,  15,  41,  13,    1,  -40 },   // 0xCE
+  { 15234,  15,  39,  13,    1,  -38 },   // 0xCF
+  { 15308,  31,  31,  33,    0,  -30 },   // 0xD0
+  { 15429,  30,  40,  32,    1,  -39 },   // 0xD1
+  { 15579,  30,  41,  34,    2,  -40 },   // 0xD2
+  { 15733,  30,  41,  34,    2,  -40 },   // 0xD3
+  { 15887,  30,  41,  34,    2,  -40 },   // 0xD4
+  { 16041,  30,  40,  34,    2,  -39 },   // 0xD5
+  { 16191,  30,  39,  34,    2,  -38 },   // 0xD6
+  { 16338,  24,  24,  36,    6,  -25 },   // 0xD7
+  { 16410,  36,  34,  34,   -1,  -32 },   // 0xD8
+  { 16563,  28,  41,  31,    3,  -40 },   // 0xD9
+  { 16707,  28,  41,  31,    3,  -40 },   // 0xDA
+  { 16851,  28,  41,  31,    3,  -40 },   // 0xDB
+  { 16995,  28,  39,  31,    3,  -38 },   // 0xDC
+  { 17132,  26,  41,  26,    3,  -40 },   // 0xDD
+  { 17266,  24,  31,  26,    1,  -30 },   // 0xDE
+  { 17359,  23,  33,  27,    2,  -32 },   // 0xDF
+  { 17454,  22,  34,  26,    2,  -33 },   // 0xE0
+  { 17548,  23,  34,  26,    2,  -33 },   // 0xE1
+  { 17646,  22,  34,  26,    2,  -33 },   // 0xE2
+  { 17740,  22,  33,  26,    2,  -32 },   // 0xE3
+  { 17831,  22,  33,  26,    2,  -32 },   // 0xE4
+  { 17922,  22,  38,  26,    2,  -37 },   // 0xE5
+  { 18027,  39,  25,  43,    2,  -24 },   // 0xE6
+  { 18149,  21,  33,  24,    2,  -24 },   // 0xE7
+  { 18236,  23,  34,  26,    2,  -33 },   // 0xE8
+  { 18334,  23,  34,  26,    2,  -33 },   // 0xE9
+  { 18432,  23,  34,  26,    2,  -33 },   // 0xEA
+  { 18530,  23,  33,  26,    2,  -32 },   // 0xEB
+  { 18625,  10,  34,  12,    2,  -33 },   // 0xEC
+  { 18668,  16,  34,  12,    2,  -33 },   // 0xED
+  { 18736,  13,  34,  12,    2,  -33 },   // 0xEE
+  { 18792,  14,  33,  12,    2,  -32 },   // 0xEF
+  { 18850,  23,  33,  26,    2,  -32 },   // 0xF0
+  { 18945,  23,  33,  27,    2,  -32 },   // 0xF1
+  { 19040,  22,  34,  26,    2,  -33 },   // 0xF2
+  { 19134,  23,  34,  26,    2,  -33 },   // 0xF3
+  { 19232,  22,  34,  26,    2,  -33 },   // 0xF4
+  { 19326,  22,  33,  26,    2,  -32 },   // 0xF5
+  { 19417,  22,  33,  26,    2,  -32 },   // 0xF6
+  { 19508,  27,  19,  36,    5,  -22 },   // 0xF7
+  { 19573,  27,  27,  26,   -1,  -25 },   // 0xF8
+  { 19665,  23,  34,  27,    2,  -33 },   // 0xF9
+  { 19763,  23,  34,  27,    2,  -33 },   // 0xFA
+  { 19861,  23,  34,  27,    2,  -33 },   // 0xFB
+  { 19959,  23,  33,  27,    2,  -32 },   // 0xFC
+  { 20054,  27,  43,  25,   -1,  -33 },   // 0xFD
+  { 20200,  25,  42,  27,    0,  -32 },   // 0xFE
+  { 20332,  27,  42,  25,   -1,  -32 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique22pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique22pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique22pt8bGlyphs,
+  0x20, 0xFF, 50 };
+
+// Approx. 22049 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique22pt8bMetrics[] PROGMEM = {
+  {   0,  14,   1 },   // 0x20
+  {   3,  17,  13 },   // 0x21
+  {   4,  20,  16 },   // 0x22
+  {   3,  36,  33 },   // 0x23
+  {   2,  27,  25 },   // 0x24
+  {   4,  41,  37 },   // 0x25
+  {   2,  34,  32 },   // 0x26
+  {   4,  12,   8 },   // 0x27
+  {   3,  17,  18 },   // 0x28
+  {  -3,  17,  12 },   // 0x29
+  {   2,  22,  20 },   // 0x2A
+  {   5,  36,  32 },   // 0x2B
+  {   0,  14,   8 },   // 0x2C
+  {   2,  16,  14 },   // 0x2D
+  {   3,  14,   8 },   // 0x2E
+  {  -3,  14,  19 },   // 0x2F
+  {   3,  27,  26 },   // 0x30
+  {   2,  27,  22 },   // 0x31
+  {   0,  27,  26 },   // 0x32
+  {   0,  27,  25 },   // 0x33
+  {   1,  27,  24 },   // 0x34
+  {   1,  27,  25 },   // 0x35
+  {   3,  27,  25 },   // 0x36
+  {   4,  27,  27 },   // 0x37
+  {   1,  27,  25 },   // 0x38
+  {   1,  27,  24 },   // 0x39
+  {   2,  14,  10 },   // 0x3A
+  {   0,  14,  11 },   // 0x3B
+  {   5,  36,  32 },   // 0x3C
+  {   5,  36,  32 },   // 0x3D
+  {   5,  36,  32 },   // 0x3E
+  {   5,  23,  22 },   // 0x3F
+  {   3,  43,  41 },   // 0x40
+  {  -2,  29,  27 },   // 0x41
+  {   1,  30,  27 },   // 0x42
+  {   2,  30,  30 },   // 0x43
+  {   1,  33,  31 },   // 0x44
+  {   1,  27,  27 },   // 0x45
+  {   1,  25,  25 },   // 0x46
+  {   2,  33,  31 },   // 0x47
+  {   1,  32,  31 },   // 0x48
+  {   1,  13,  11 },   // 0x49
+  {  -7,  13,  12 },   // 0x4A
+  {   1,  28,  31 },   // 0x4B
+  {   1,  24,  21 },   // 0x4C
+  {   1,  37,  36 },   // 0x4D
+  {   1,  32,  31 },   // 0x4E
+  {   2,  34,  32 },   // 0x4F
+  {   1,  26,  26 },   // 0x50
+  {   2,  34,  32 },   // 0x51
+  {   1,  30,  26 },   // 0x52
+  {   1,  27,  26 },   // 0x53
+  {   2,  26,  29 },   // 0x54
+  {   3,  31,  31 },   // 0x55
+  {   3,  29,  32 },   // 0x56
+  {   4,  43,  44 },   // 0x57
+  {  -2,  29,  30 },   // 0x58
+  {   3,  26,  29 },   // 0x59
+  {  -1,  29,  30 },   // 0x5A
+  {   2,  17,  18 },   // 0x5B
+  {   4,  14,  12 },   // 0x5C
+  {  -2,  17,  14 },   // 0x5D
+  {   5,  36,  32 },   // 0x5E
+  {   0,  22,  22 },   // 0x5F
+  {   8,  22,  17 },   // 0x60
+  {   2,  26,  24 },   // 0x61
+  {   2,  27,  26 },   // 0x62
+  {   2,  24,  23 },   // 0x63
+  {   2,  27,  28 },   // 0x64
+  {   2,  26,  25 },   // 0x65
+  {   3,  15,  21 },   // 0x66
+  {   1,  27,  26 },   // 0x67
+  {   2,  27,  25 },   // 0x68
+  {   2,  12,  12 },   // 0x69
+  {  -5,  12,  12 },   // 0x6A
+  {   2,  25,  27 },   // 0x6B
+  {   2,  12,  12 },   // 0x6C
+  {   2,  42,  39 },   // 0x6D
+  {   2,  27,  25 },   // 0x6E
+  {   2,  26,  24 },   // 0x6F
+  {   0,  27,  25 },   // 0x70
+  {   2,  27,  26 },   // 0x71
+  {   2,  18,  20 },   // 0x72
+  {   1,  22,  22 },   // 0x73
+  {   3,  17,  18 },   // 0x74
+  {   2,  27,  25 },   // 0x75
+  {   3,  25,  26 },   // 0x76
+  {   4,  35,  36 },   // 0x77
+  {  -1,  25,  26 },   // 0x78
+  {  -1,  25,  26 },   // 0x79
+  {   0,  23,  23 },   // 0x7A
+  {   5,  27,  26 },   // 0x7B
+  {   5,  14,   9 },   // 0x7C
+  {   0,  27,  21 },   // 0x7D
+  {   5,  36,  32 },   // 0x7E
+  {   2,  26,  24 },   // 0x7F
+  {   2,  26,  24 },   // 0x80
+  {   2,  26,  24 },   // 0x81
+  {   2,  26,  24 },   // 0x82
+  {   2,  26,  24 },   // 0x83
+  {   2,  26,  24 },   // 0x84
+  {   2,  26,  24 },   // 0x85
+  {   2,  26,  24 },   // 0x86
+  {   2,  26,  24 },   // 0x87
+  {   2,  26,  24 },   // 0x88
+  {   2,  26,  24 },   // 0x89
+  {   2,  26,  24 },   // 0x8A
+  {   2,  26,  24 },   // 0x8B
+  {   2,  26,  24 },   // 0x8C
+  {   2,  26,  24 },   // 0x8D
+  {   2,  26,  24 },   // 0x8E
+  {   2,  26,  24 },   // 0x8F
+  {   2,  26,  24 },   // 0x90
+  {   2,  26,  24 },   // 0x91
+  {   2,  26,  24 },   // 0x92
+  {   2,  26,  24 },   // 0x93
+  {   2,  26,  24 },   // 0x94
+  {   2,  26,  24 },   // 0x95
+  {   2,  26,  24 },   // 0x96
+  {   2,  26,  24 },   // 0x97
+  {   2,  26,  24 },   // 0x98
+  {   2,  26,  24 },   // 0x99
+  {   2,  26,  24 },   // 0x9A
+  {   2,  26,  24 },   // 0x9B
+  {   2,  26,  24 },   // 0x9C
+  {   2,  26,  24 },   // 0x9D
+  {   2,  26,  24 },   // 0x9E
+  {   2,  26,  24 },   // 0x9F
+  {   0,  14,   1 },   // 0xA0
+  {   4,  17,  14 },   // 0xA1
+  {   3,  27,  24 },   // 0xA2
+  {   1,  27,  28 },   // 0xA3
+  {   2,  27,  26 },   // 0xA4
+  {   2,  27,  30 },   // 0xA5
+  {   5,  14,   9 },   // 0xA6
+  {  -1,  22,  20 },   // 0xA7
+  {   8,  22,  21 },   // 0xA8
+  {   6,  43,  37 },   // 0xA9
+  {   2,  20,  19 },   // 0xAA
+  {   3,  27,  24 },   // 0xAB
+  {   5,  36,  32 },   // 0xAC
+  {   2,  16,  14 },   // 0xAD
+  {   6,  43,  37 },   // 0xAE
+  {   8,  21,  21 },   // 0xAF
+  {   4,  22,  17 },   // 0xB0
+  {   4,  36,  31 },   // 0xB1
+  {   2,  17,  18 },   // 0xB2
+  {   1,  17,  16 },   // 0xB3
+  {  11,  22,  23 },   // 0xB4
+  {  -1,  27,  25 },   // 0xB5
+  {   3,  27,  23 },   // 0xB6
+  {   5,  14,  10 },   // 0xB7
+  {   2,  22,  11 },   // 0xB8
+  {   3,  17,  16 },   // 0xB9
+  {   2,  20,  20 },   // 0xBA
+  {   3,  27,  24 },   // 0xBB
+  {   3,  42,  41 },   // 0xBC
+  {   3,  42,  42 },   // 0xBD
+  {   1,  42,  41 },   // 0xBE
+  {   2,  23,  19 },   // 0xBF
+  {  -2,  29,  27 },   // 0xC0
+  {  -2,  29,  27 },   // 0xC1
+  {  -2,  29,  27 },   // 0xC2
+  {  -2,  29,  27 },   // 0xC3
+  {  -2,  29,  27 },   // 0xC4
+  {  -2,  29,  27 },   // 0xC5
+  {  -2,  42,  43 },   // 0xC6
+  {   2,  30,  30 },   // 0xC7
+  {   1,  27,  27 },   // 0xC8
+  {   1,  27,  27 },   // 0xC9
+  {   1,  27,  27 },   // 0xCA
+  {   1,  27,  27 },   // 0xCB
+  {   1,  13,  12 },   // 0xCC
+  {   1,  13,  16 },   // 0xCD
+  {   1,  13,  16 },   // 0xCE
+  {   1,  13,  16 },   // 0xCF
+  {   0,  33,  31 },   // 0xD0
+  {   1,  32,  31 },   // 0xD1
+  {   2,  34,  32 },   // 0xD2
+  {   2,  34,  32 },   // 0xD3
+  {   2,  34,  32 },   // 0xD4
+  {   2,  34,  32 },   // 0xD5
+  {   2,  34,  32 },   // 0xD6
+  {   6,  36,  30 },   // 0xD7
+  {  -1,  34,  35 },   // 0xD8
+  {   3,  31,  31 },   // 0xD9
+  {   3,  31,  31 },   // 0xDA
+  {   3,  31,  31 },   // 0xDB
+  {   3,  31,  31 },   // 0xDC
+  {   3,  26,  29 },   // 0xDD
+  {   1,  26,  25 },   // 0xDE
+  {   2,  27,  25 },   // 0xDF
+  {   2,  26,  24 },   // 0xE0
+  {   2,  26,  25 },   // 0xE1
+  {   2,  26,  24 },   // 0xE2
+  {   2,  26,  24 },   // 0xE3
+  {   2,  26,  24 },   // 0xE4
+  {   2,  26,  24 },   // 0xE5
+  {   2,  43,  41 },   // 0xE6
+  {   2,  24,  23 },   // 0xE7
+  {   2,  26,  25 },   // 0xE8
+  {   2,  26,  25 },   // 0xE9
+  {   2,  26,  25 },   // 0xEA
+  {   2,  26,  25 },   // 0xEB
+  {   2,  12,  12 },   // 0xEC
+  {   2,  12,  18 },   // 0xED
+  {   2,  12,  15 },   // 0xEE
+  {   2,  12,  16 },   // 0xEF
+  {   2,  26,  25 },   // 0xF0
+  {   2,  27,  25 },   // 0xF1
+  {   2,  26,  24 },   // 0xF2
+  {   2,  26,  25 },   // 0xF3
+  {   2,  26,  24 },   // 0xF4
+  {   2,  26,  24 },   // 0xF5
+  {   2,  26,  24 },   // 0xF6
+  {   5,  36,  32 },   // 0xF7
+  {  -1,  26,  26 },   // 0xF8
+  {   2,  27,  25 },   // 0xF9
+  {   2,  27,  25 },   // 0xFA
+  {   2,  27,  25 },   // 0xFB
+  {   2,  27,  25 },   // 0xFC
+  {  -1,  25,  26 },   // 0xFD
+  {   0,  27,  25 },   // 0xFE
+  {  -1,  25,  26 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique22pt8bWidths = { DejaVuSans_Oblique22pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE22PTLAT1__H
@@ -0,0 +1,613 @@
+#ifndef DEJAVUSANSOBLIQUE6PTLAT1__H
+#define DEJAVUSANSOBLIQUE6PTLAT1__H
+const uint8_t DejaVuSans_Oblique6pt8bBitmaps[] PROGMEM = {
+  0x00, 0x25, 0x24, 0x84, 0x80, 0xB6, 0x80, 0x12, 0x14, 0x7F, 0x24, 0x24,
+  0xFE, 0x28, 0x48, 0x08, 0xF5, 0x54, 0x70, 0x72, 0x69, 0x78, 0x82, 0x00,
+  0x71, 0x49, 0x24, 0x92, 0x8E, 0xB8, 0xA4, 0x92, 0x49, 0x47, 0x00, 0x1C,
+  0x22, 0x20, 0x20, 0x51, 0x8A, 0x86, 0x84, 0x7A, 0xE0, 0x12, 0x44, 0x88,
+  0x88, 0x88, 0x40, 0x21, 0x11, 0x11, 0x12, 0x24, 0x80, 0x25, 0x5C, 0xEA,
+  0x90, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0x58, 0xE0, 0xC0, 0x04,
+  0x20, 0x84, 0x10, 0x82, 0x10, 0x42, 0x00, 0x39, 0x94, 0x61, 0x86, 0x18,
+  0xA2, 0x70, 0x70, 0x84, 0x23, 0x10, 0x84, 0xF8, 0x1C, 0x44, 0x08, 0x10,
+  0x43, 0x08, 0x20, 0xFC, 0x1C, 0xC4, 0x08, 0x23, 0x80, 0x81, 0x46, 0x78,
+  0x04, 0x31, 0x4A, 0x4A, 0x2F, 0xC4, 0x10, 0x3C, 0x41, 0x83, 0xC0, 0x40,
+  0x81, 0x44, 0x70, 0x1D, 0x94, 0x2E, 0xC6, 0x18, 0x62, 0x70, 0xFC, 0x20,
+  0x84, 0x10, 0x86, 0x10, 0x80, 0x3C, 0xC5, 0x0A, 0x23, 0x98, 0xA1, 0x46,
+  0x78, 0x39, 0x18, 0x61, 0x8D, 0xD0, 0xA6, 0xF0, 0x50, 0xA0, 0x24, 0x04,
+  0xA0, 0x03, 0x1E, 0xE0, 0xE0, 0x1E, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x78,
+  0x07, 0x07, 0x78, 0xC0, 0x7C, 0x42, 0x26, 0x20, 0x10, 0x80, 0x0F, 0x86,
+  0x09, 0x80, 0xA7, 0x99, 0x93, 0x22, 0x64, 0x54, 0x7C, 0xC0, 0x0C, 0x20,
+  0xF8, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12, 0x22, 0x7F, 0x41, 0x81, 0x3E,
+  0x45, 0x0A, 0x17, 0xC8, 0x50, 0xC3, 0xFC, 0x1E, 0x21, 0x40, 0x80, 0x80,
+  0x80, 0x80, 0xC2, 0x3C, 0x3E, 0x23, 0x41, 0x41, 0x41, 0x41, 0x42, 0x86,
+  0xF8, 0x3E, 0x41, 0x02, 0x07, 0xC8, 0x10, 0x40, 0xFC, 0x3E, 0x41, 0x02,
+  0x07, 0xC8, 0x10, 0x40, 0x80, 0x1E, 0x21, 0x40, 0x80, 0x87, 0x81, 0x83,
+  0xC2, 0x7C, 0x20, 0x90, 0x50, 0x48, 0x27, 0xF2, 0x09, 0x05, 0x04, 0x82,
+  0x00, 0x25, 0x24, 0x94, 0x80, 0x08, 0x42, 0x21, 0x08, 0x42, 0x21, 0x30,
+  0x22, 0x24, 0x48, 0x50, 0x60, 0x50, 0x48, 0x84, 0x82, 0x20, 0x84, 0x10,
+  0x41, 0x04, 0x20, 0xFC, 0x20, 0xC8, 0x55, 0x19, 0x4A, 0x54, 0x95, 0x24,
+  0x8A, 0x04, 0x81, 0x00, 0x20, 0x98, 0x54, 0x49, 0x24, 0x92, 0x49, 0x15,
+  0x0C, 0x82, 0x00, 0x3C, 0xCD, 0x0C, 0x18, 0x30, 0x61, 0x66, 0x78, 0x3C,
+  0x45, 0x0A, 0x37, 0xC8, 0x10, 0x40, 0x80, 0x3C, 0xCD, 0x0C, 0x18, 0x30,
+  0x61, 0x66, 0x78, 0x20, 0x20, 0x3C, 0x45, 0x0A, 0x37, 0x88, 0x91, 0x41,
+  0x82, 0x1E, 0x61, 0x40, 0x40, 0x3C, 0x02, 0x02, 0x86, 0x7C, 0xFE, 0x20,
+  0x41, 0x02, 0x04, 0x08, 0x20, 0x40, 0x42, 0x85, 0x0C, 0x28, 0x50, 0xA1,
+  0x44, 0x70, 0x81, 0x82, 0x82, 0x44, 0x48, 0x48, 0x50, 0x50, 0x60, 0x84,
+  0x31, 0x8A, 0x31, 0x4A, 0x49, 0x49, 0x4A, 0x29, 0x42, 0x10, 0x42, 0x00,
+  0x10, 0x88, 0x82, 0x81, 0x80, 0x80, 0xA0, 0x90, 0x84, 0x82, 0x00, 0x82,
+  0x89, 0x22, 0x82, 0x04, 0x08, 0x20, 0x40, 0x3F, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x32, 0x24, 0x44, 0x44, 0x88, 0xC0,
+  0xAA, 0x95, 0x50, 0x71, 0x12, 0x22, 0x22, 0x44, 0xC0, 0x18, 0x24, 0x42,
+  0xFC, 0x90, 0x3C, 0x84, 0x0B, 0xF8, 0x30, 0x9F, 0x00, 0x20, 0x41, 0x82,
+  0xE6, 0x28, 0x50, 0xE1, 0xC5, 0x70, 0x39, 0x18, 0x20, 0x82, 0x27, 0x00,
+  0x01, 0x01, 0x03, 0x3A, 0x46, 0x82, 0x82, 0x86, 0x8C, 0x74, 0x3C, 0x86,
+  0x0F, 0xF8, 0x10, 0x9E, 0x00, 0x3A, 0x11, 0xE4, 0x21, 0x10, 0x84, 0x00,
+  0x3A, 0x8E, 0x1C, 0x28, 0x51, 0x9D, 0x04, 0x89, 0xE0, 0x20, 0x41, 0x82,
+  0xE6, 0x28, 0x50, 0xE1, 0x85, 0x08, 0x20, 0x24, 0xB4, 0x90, 0x10, 0x02,
+  0x22, 0x24, 0x44, 0x44, 0x80, 0x20, 0x41, 0x82, 0x24, 0x8A, 0x18, 0x68,
+  0x89, 0x08, 0x25, 0xA4, 0x96, 0x90, 0x5D, 0xD9, 0x94, 0x47, 0x11, 0x84,
+  0x62, 0x28, 0x88, 0x5C, 0xC5, 0x0E, 0x18, 0x30, 0xA1, 0x00, 0x3C, 0x86,
+  0x0C, 0x18, 0x30, 0x9E, 0x00, 0x2E, 0x31, 0x61, 0x41, 0x41, 0x62, 0x7C,
+  0xC0, 0x80, 0x80, 0x3A, 0x8E, 0x1C, 0x28, 0x51, 0x9D, 0x06, 0x08, 0x10,
+  0x7B, 0x11, 0x88, 0x42, 0x00, 0x39, 0x14, 0x0E, 0x0A, 0x27, 0x00, 0x44,
+  0xF4, 0x88, 0x88, 0xE0, 0x42, 0x86, 0x0C, 0x38, 0x51, 0x9D, 0x00, 0x86,
+  0x28, 0x94, 0x51, 0x84, 0x00, 0x88, 0xC4, 0xA6, 0x55, 0x4A, 0xA6, 0x22,
+  0x10, 0x31, 0x12, 0x1C, 0x18, 0x3C, 0x64, 0xC6, 0x21, 0x22, 0x22, 0x14,
+  0x14, 0x18, 0x18, 0x10, 0x30, 0xE0, 0x3E, 0x08, 0x20, 0x82, 0x08, 0x3F,
+  0x00, 0x1C, 0x42, 0x08, 0x23, 0x04, 0x10, 0x41, 0x07, 0x00, 0xFF, 0xF0,
+  0x38, 0x20, 0x82, 0x08, 0x31, 0x04, 0x10, 0x8E, 0x00, 0x71, 0x8E, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+  0x1F, 0xC0, 0xFE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0xFE,
+  0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0, 0x00, 0x24, 0x24, 0x94,
+  0x80, 0x08, 0x23, 0x95, 0x92, 0x49, 0x26, 0x70, 0x82, 0x00, 0x0F, 0x08,
+  0x10, 0x10, 0x7C, 0x10, 0x20, 0x20, 0xFE, 0x82, 0xF9, 0x12, 0x24, 0x4F,
+  0xA0, 0x80, 0x41, 0x22, 0x24, 0x6E, 0x10, 0xFC, 0x10, 0x20, 0x20, 0xF3,
+  0xC0, 0x3A, 0x18, 0xE8, 0xC5, 0xC2, 0x17, 0x00, 0xA0, 0x3E, 0x31, 0xB7,
+  0xF4, 0x1A, 0x0D, 0x07, 0x7E, 0xC6, 0x3E, 0x00, 0x78, 0x5F, 0x1F, 0x03,
+  0xC0, 0x2A, 0xA8, 0xA5, 0x00, 0xFF, 0x01, 0x01, 0xE0, 0x3E, 0x31, 0xBF,
+  0xF4, 0x5B, 0xCD, 0x27, 0x8E, 0xC6, 0x3E, 0x00, 0xF0, 0x69, 0x96, 0x10,
+  0x23, 0xF8, 0x81, 0x00, 0x3F, 0x80, 0x71, 0x24, 0xF0, 0x71, 0x61, 0xE0,
+  0x50, 0x22, 0x22, 0x62, 0x42, 0x42, 0x44, 0x7E, 0xC0, 0x80, 0x80, 0x3F,
+  0xDF, 0x7A, 0x68, 0xA2, 0x8A, 0x51, 0x40, 0xC0, 0x3C, 0x65, 0x2E, 0x76,
+  0x63, 0x37, 0x03, 0xC0, 0x92, 0x8A, 0xAA, 0x00, 0x60, 0x88, 0x44, 0x21,
+  0x10, 0xE4, 0xC2, 0x51, 0x28, 0x8F, 0x40, 0x80, 0x60, 0x88, 0x44, 0x21,
+  0x10, 0xE5, 0xC2, 0x11, 0x08, 0x84, 0x43, 0xC0, 0x70, 0x42, 0x11, 0x84,
+  0x09, 0x0E, 0x26, 0x09, 0x42, 0x50, 0x8F, 0x20, 0x40, 0x08, 0x40, 0x11,
+  0x11, 0x10, 0x8B, 0x80, 0x04, 0x02, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12,
+  0x22, 0x7F, 0x41, 0x81, 0x02, 0x04, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12,
+  0x22, 0x7F, 0x41, 0x81, 0x06, 0x09, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12,
+  0x22, 0x7F, 0x41, 0x81, 0x05, 0x0A, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12,
+  0x22, 0x7F, 0x41, 0x81, 0x0A, 0x00, 0x06, 0x0A, 0x0A, 0x12, 0x12, 0x22,
+  0x7F, 0x41, 0x81, 0x0E, 0x0A, 0x04, 0x0C, 0x0A, 0x12, 0x12, 0x22, 0x7E,
+  0x41, 0x81, 0x07, 0xF0, 0x90, 0x0A, 0x01, 0x20, 0x13, 0xE2, 0x20, 0x7E,
+  0x04, 0x20, 0x87, 0xE0, 0x1E, 0x21, 0x40, 0x80, 0x80, 0x80, 0x80, 0xC2,
+  0x3C, 0x08, 0x38, 0x08, 0x08, 0x01, 0xF2, 0x08, 0x10, 0x3E, 0x40, 0x82,
+  0x07, 0xE0, 0x04, 0x10, 0x01, 0xF2, 0x08, 0x10, 0x3E, 0x40, 0x82, 0x07,
+  0xE0, 0x0C, 0x24, 0x01, 0xF2, 0x08, 0x10, 0x3E, 0x40, 0x82, 0x07, 0xE0,
+  0x14, 0x00, 0xF9, 0x04, 0x08, 0x1F, 0x20, 0x41, 0x03, 0xF0, 0x21, 0x02,
+  0x24, 0x44, 0x44, 0x88, 0x11, 0x00, 0x42, 0x21, 0x08, 0x42, 0x21, 0x00,
+  0x32, 0x40, 0x42, 0x21, 0x08, 0x42, 0x21, 0x00, 0x50, 0x22, 0x44, 0x44,
+  0x48, 0x80, 0x3E, 0x23, 0x41, 0x41, 0xF1, 0x41, 0x42, 0x86, 0xF8, 0x0A,
+  0x0A, 0x00, 0x04, 0x13, 0x0A, 0x89, 0x24, 0x92, 0x49, 0x22, 0xA1, 0x90,
+  0x40, 0x04, 0x04, 0x01, 0xE6, 0x68, 0x60, 0xC1, 0x83, 0x0B, 0x33, 0xC0,
+  0x02, 0x04, 0x00, 0x3C, 0x66, 0x42, 0x82, 0x82, 0x82, 0x84, 0xCC, 0x78,
+  0x06, 0x09, 0x00, 0x3C, 0x66, 0x42, 0x82, 0x82, 0x82, 0x84, 0xCC, 0x78,
+  0x05, 0x0A, 0x00, 0x3C, 0x66, 0x42, 0x82, 0x82, 0x82, 0x84, 0xCC, 0x78,
+  0x0A, 0x00, 0xF3, 0x34, 0x30, 0x60, 0xC1, 0x85, 0x99, 0xE0, 0x82, 0x88,
+  0xA0, 0x82, 0x88, 0xA0, 0x80, 0x1E, 0x99, 0x88, 0xC8, 0xA4, 0x92, 0x89,
+  0x88, 0xCC, 0xBC, 0x00, 0x10, 0x10, 0x02, 0x14, 0x28, 0x61, 0x42, 0x85,
+  0x0A, 0x23, 0x80, 0x08, 0x20, 0x02, 0x14, 0x28, 0x61, 0x42, 0x85, 0x0A,
+  0x23, 0x80, 0x18, 0x48, 0x02, 0x14, 0x28, 0x61, 0x42, 0x85, 0x0A, 0x23,
+  0x80, 0x28, 0x01, 0x0A, 0x14, 0x30, 0xA1, 0x42, 0x85, 0x11, 0xC0, 0x08,
+  0x20, 0x04, 0x14, 0x49, 0x14, 0x10, 0x20, 0x41, 0x02, 0x00, 0x20, 0x79,
+  0x0A, 0x14, 0x6F, 0x90, 0x40, 0x80, 0x1C, 0x44, 0x8A, 0x64, 0x89, 0x11,
+  0x21, 0x83, 0x78, 0x10, 0x10, 0x01, 0xE4, 0x20, 0x5F, 0xC1, 0x84, 0xF8,
+  0x04, 0x10, 0x01, 0xE4, 0x20, 0x5F, 0xC1, 0x84, 0xF8, 0x18, 0x48, 0x01,
+  0xE4, 0x20, 0x5F, 0xC1, 0x84, 0xF8, 0x14, 0x50, 0x01, 0xE4, 0x20, 0x5F,
+  0xC1, 0x84, 0xF8, 0x14, 0x00, 0xF2, 0x10, 0x2F, 0xE0, 0xC2, 0x7C, 0x18,
+  0x48, 0x90, 0xC0, 0x07, 0x90, 0x81, 0x7F, 0x06, 0x13, 0xE0, 0x3D, 0xC8,
+  0xC4, 0x10, 0xBF, 0xF8, 0x41, 0x18, 0x9C, 0xE0, 0x39, 0x18, 0x20, 0x82,
+  0x27, 0x04, 0x70, 0x10, 0x10, 0x01, 0xE4, 0x30, 0x7F, 0xC0, 0x84, 0xF0,
+  0x04, 0x10, 0x01, 0xE4, 0x30, 0x7F, 0xC0, 0x84, 0xF0, 0x18, 0x48, 0x01,
+  0xE4, 0x30, 0x7F, 0xC0, 0x84, 0xF0, 0x14, 0x00, 0xF2, 0x18, 0x3F, 0xE0,
+  0x42, 0x78, 0x91, 0x5E, 0xA0, 0x24, 0x04, 0x44, 0xC8, 0x88, 0x69, 0x02,
+  0x22, 0x64, 0x44, 0xA1, 0x25, 0xA4, 0x80, 0x14, 0x77, 0x82, 0x3D, 0x18,
+  0x61, 0x89, 0xC0, 0x14, 0x50, 0x02, 0xE6, 0x28, 0x70, 0xC1, 0x85, 0x08,
+  0x10, 0x10, 0x01, 0xE4, 0x30, 0x60, 0xC1, 0x84, 0xF0, 0x04, 0x10, 0x01,
+  0xE4, 0x30, 0x60, 0xC1, 0x84, 0xF0, 0x18, 0x48, 0x01, 0xE4, 0x30, 0x60,
+  0xC1, 0x84, 0xF0, 0x14, 0x50, 0x01, 0xE4, 0x30, 0x60, 0xC1, 0x84, 0xF0,
+  0x14, 0x00, 0xF2, 0x18, 0x30, 0x60, 0xC2, 0x78, 0x10, 0x03, 0xF8, 0x01,
+  0x00, 0x1E, 0x26, 0x4A, 0x52, 0x62, 0x44, 0xF8, 0x10, 0x10, 0x02, 0x14,
+  0x30, 0x61, 0xC2, 0x8C, 0xE8, 0x04, 0x10, 0x02, 0x14, 0x30, 0x61, 0xC2,
+  0x8C, 0xE8, 0x18, 0x48, 0x02, 0x14, 0x30, 0x61, 0xC2, 0x8C, 0xE8, 0x14,
+  0x01, 0x0A, 0x18, 0x30, 0xE1, 0x46, 0x74, 0x02, 0x04, 0x00, 0x21, 0x22,
+  0x22, 0x14, 0x14, 0x18, 0x18, 0x10, 0x30, 0xE0, 0x20, 0x40, 0x82, 0xE6,
+  0x28, 0x50, 0xA1, 0x44, 0xF2, 0x04, 0x08, 0x00, 0x0A, 0x00, 0x21, 0x22,
+  0x22, 0x14, 0x14, 0x18, 0x18, 0x10, 0x30, 0xE0 };
+
+const GFXglyph DejaVuSans_Oblique6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   3,   9,   5,    1,   -8 },   // 0x21 '!'
+  {     5,   3,   3,   6,    1,   -8 },   // 0x22 '"'
+  {     7,   8,   8,  10,    1,   -7 },   // 0x23 '#'
+  {    15,   6,  11,   8,    0,   -8 },   // 0x24 '$'
+  {    24,   9,   9,  11,    1,   -8 },   // 0x25 '%'
+  {    35,   8,   9,   9,    0,   -8 },   // 0x26 '&'
+  {    44,   1,   3,   3,    1,   -8 },   // 0x27 '''
+  {    45,   4,  11,   5,    1,   -9 },   // 0x28 '('
+  {    51,   4,  11,   5,   -1,   -9 },   // 0x29 ')'
+  {    57,   5,   6,   6,    1,   -8 },   // 0x2A '*'
+  {    61,   7,   7,  10,    1,   -6 },   // 0x2B '+'
+  {    68,   2,   3,   4,    0,   -1 },   // 0x2C ','
+  {    69,   3,   1,   4,    1,   -3 },   // 0x2D '-'
+  {    70,   1,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    71,   6,  10,   4,   -1,   -8 },   // 0x2F '/'
+  {    79,   6,   9,   8,    1,   -8 },   // 0x30 '0'
+  {    86,   5,   9,   8,    1,   -8 },   // 0x31 '1'
+  {    92,   7,   9,   8,    0,   -8 },   // 0x32 '2'
+  {   100,   7,   9,   8,    0,   -8 },   // 0x33 '3'
+  {   108,   6,   9,   8,    1,   -8 },   // 0x34 '4'
+  {   115,   7,   9,   8,    1,   -8 },   // 0x35 '5'
+  {   123,   6,   9,   8,    1,   -8 },   // 0x36 '6'
+  {   130,   6,   9,   8,    2,   -8 },   // 0x37 '7'
+  {   137,   7,   9,   8,    1,   -8 },   // 0x38 '8'
+  {   145,   6,   9,   8,    1,   -8 },   // 0x39 '9'
+  {   152,   2,   6,   4,    1,   -5 },   // 0x3A ':'
+  {   154,   3,   7,   4,    0,   -5 },   // 0x3B ';'
+  {   157,   8,   6,  10,    1,   -6 },   // 0x3C '<'
+  {   163,   8,   3,  10,    1,   -4 },   // 0x3D '='
+  {   166,   8,   6,  10,    1,   -6 },   // 0x3E '>'
+  {   172,   5,   9,   6,    1,   -8 },   // 0x3F '?'
+  {   178,  11,  11,  12,    1,   -7 },   // 0x40 '@'
+  {   194,   8,   9,   8,   -1,   -8 },   // 0x41 'A'
+  {   203,   7,   9,   8,    0,   -8 },   // 0x42 'B'
+  {   211,   8,   9,   8,    0,   -8 },   // 0x43 'C'
+  {   220,   8,   9,   9,    0,   -8 },   // 0x44 'D'
+  {   229,   7,   9,   8,    0,   -8 },   // 0x45 'E'
+  {   237,   7,   9,   7,    0,   -8 },   // 0x46 'F'
+  {   245,   8,   9,   9,    0,   -8 },   // 0x47 'G'
+  {   254,   9,   9,   9,    0,   -8 },   // 0x48 'H'
+  {   265,   3,   9,   4,    0,   -8 },   // 0x49 'I'
+  {   269,   5,  11,   4,   -2,   -8 },   // 0x4A 'J'
+  {   276,   8,   9,   8,    0,   -8 },   // 0x4B 'K'
+  {   285,   6,   9,   7,    0,   -8 },   // 0x4C 'L'
+  {   292,  10,   9,  10,    0,   -8 },   // 0x4D 'M'
+  {   304,   9,   9,   9,    0,   -8 },   // 0x4E 'N'
+  {   315,   7,   9,   8,    0,   -8 },   // 0x4F 'O'
+  {   323,   7,   9,   7,    0,   -8 },   // 0x50 'P'
+  {   331,   7,  11,   8,    0,   -8 },   // 0x51 'Q'
+  {   341,   7,   9,   8,    0,   -8 },   // 0x52 'R'
+  {   349,   8,   9,   8,    0,   -8 },   // 0x53 'S'
+  {   358,   7,   9,   7,    1,   -8 },   // 0x54 'T'
+  {   366,   7,   9,   9,    1,   -8 },   // 0x55 'U'
+  {   374,   8,   9,   8,    1,   -8 },   // 0x56 'V'
+  {   383,  11,   9,  12,    1,   -8 },   // 0x57 'W'
+  {   396,   9,   9,   8,   -1,   -8 },   // 0x58 'X'
+  {   407,   7,   9,   7,    1,   -8 },   // 0x59 'Y'
+  {   415,   9,   9,   8,    0,   -8 },   // 0x5A 'Z'
+  {   426,   4,  11,   5,    0,   -9 },   // 0x5B '['
+  {   432,   2,  10,   4,    1,   -8 },   // 0x5C '\'
+  {   435,   4,  11,   5,    0,   -9 },   // 0x5D ']'
+  {   441,   8,   3,  10,    1,   -8 },   // 0x5E '^'
+  {   444,   6,   1,   6,    0,    3 },   // 0x5F '_'
+  {   445,   2,   2,   6,    2,   -9 },   // 0x60 '`'
+  {   446,   7,   7,   8,    0,   -6 },   // 0x61 'a'
+  {   453,   7,  10,   8,    0,   -9 },   // 0x62 'b'
+  {   462,   6,   7,   7,    0,   -6 },   // 0x63 'c'
+  {   468,   8,  10,   8,    0,   -9 },   // 0x64 'd'
+  {   478,   7,   7,   8,    0,   -6 },   // 0x65 'e'
+  {   485,   5,  10,   4,    0,   -9 },   // 0x66 'f'
+  {   492,   7,  10,   8,    0,   -6 },   // 0x67 'g'
+  {   501,   7,  10,   8,    0,   -9 },   // 0x68 'h'
+  {   510,   3,  10,   3,    0,   -9 },   // 0x69 'i'
+  {   514,   4,  13,   3,   -1,   -9 },   // 0x6A 'j'
+  {   521,   7,  10,   7,    0,   -9 },   // 0x6B 'k'
+  {   530,   3,  10,   3,    0,   -9 },   // 0x6C 'l'
+  {   534,  10,   7,  11,    0,   -6 },   // 0x6D 'm'
+  {   543,   7,   7,   8,    0,   -6 },   // 0x6E 'n'
+  {   550,   7,   7,   8,    0,   -6 },   // 0x6F 'o'
+  {   557,   8,  10,   8,   -1,   -6 },   // 0x70 'p'
+  {   567,   7,  10,   8,    0,   -6 },   // 0x71 'q'
+  {   576,   5,   7,   5,    0,   -6 },   // 0x72 'r'
+  {   581,   6,   7,   6,    0,   -6 },   // 0x73 's'
+  {   587,   4,   9,   5,    1,   -8 },   // 0x74 't'
+  {   592,   7,   7,   8,    0,   -6 },   // 0x75 'u'
+  {   599,   6,   7,   6,    0,   -6 },   // 0x76 'v'
+  {   605,   9,   7,  10,    1,   -6 },   // 0x77 'w'
+  {   613,   8,   7,   7,   -1,   -6 },   // 0x78 'x'
+  {   620,   8,  10,   7,   -1,   -6 },   // 0x79 'y'
+  {   630,   7,   7,   6,   -1,   -6 },   // 0x7A 'z'
+  {   637,   6,  11,   8,    2,   -9 },   // 0x7B '{'
+  {   646,   1,  12,   4,    2,   -8 },   // 0x7C '|'
+  {   648,   6,  11,   8,    0,   -9 },   // 0x7D '}'
+  {   657,   8,   2,  10,    1,   -4 },   // 0x7E '~'
+  {   659,   6,  11,   7,    1,   -7 },   // 0x7F
+  {   668,   6,  11,   7,    1,   -7 },   // 0x80
+  {   677,   6,  11,   7,    1,   -7 },   // 0x81
+  {   686,   6,  11,   7,    1,   -7 },   // 0x82
+  {   695,   6,  11,   7,    1,   -7 },   // 0x83
+  {   704,   6,  11,   7,    1,   -7 },   // 0x84
+  {   713,   6,  11,   7,    1,   -7 },   // 0x85
+  {   722,   6,  11,   7,    1,   -7 },   // 0x86
+  {   731,   6,  11,   7,    1,   -7 },   // 0x87
+  {   740,   6,  11,   7,    1,   -7 },   // 0x88
+  {   749,   6,  11,   7,    1,   -7 },   // 0x89
+  {   758,   6,  11,   7,    1,   -7 },   // 0x8A
+  {   767,   6,  11,   7,    1,   -7 },   // 0x8B
+  {   776,   6,  11,   7,    1,   -7 },   // 0x8C
+  {   785,   6,  11,   7,    1,   -7 },   // 0x8D
+  {   794,   6,  11,   7,    1,   -7 },   // 0x8E
+  {   803,   6,  11,   7,    1,   -7 },   // 0x8F
+  {   812,   6,  11,   7,    1,   -7 },   // 0x90
+  {   821,   6,  11,   7,    1,   -7 },   // 0x91
+  {   830,   6,  11,   7,    1,   -7 },   // 0x92
+  {   839,   6,  11,   7,    1,   -7 },   // 0x93
+  {   848,   6,  11,   7,    1,   -7 },   // 0x94
+  {   857,   6,  11,   7,    1,   -7 },   // 0x95
+  {   866,   6,  11,   7,    1,   -7 },   // 0x96
+  {   875,   6,  11,   7,    1,   -7 },   // 0x97
+  {   884,   6,  11,   7,    1,   -7 },   // 0x98
+  {   893,   6,  11,   7,    1,   -7 },   // 0x99
+  {   902,   6,  11,   7,    1,   -7 },   // 0x9A
+  {   911,   6,  11,   7,    1,   -7 },   // 0x9B
+  {   920,   6,  11,   7,    1,   -7 },   // 0x9C
+  {   929,   6,  11,   7,    1,   -7 },   // 0x9D
+  {   938,   6,  11,   7,    1,   -7 },   // 0x9E
+  {   947,   6,  11,   7,    1,   -7 },   // 0x9F
+  {   956,   1,   1,   4,    0,    0 },   // 0xA0
+  {   957,   3,   9,   5,    1,   -6 },   // 0xA1
+  {   961,   6,  11,   8,    1,   -8 },   // 0xA2
+  {   970,   8,   9,   8,    0,   -8 },   // 0xA3
+  {   979,   7,   7,   8,    0,   -6 },   // 0xA4
+  {   986,   8,   9,   8,    0,   -8 },   // 0xA5
+  {   995,   1,  10,   4,    2,   -7 },   // 0xA6
+  {   997,   5,  10,   6,    1,   -8 },   // 0xA7
+  {  1004,   3,   1,   6,    2,   -8 },   // 0xA8
+  {  1005,   9,   9,  12,    2,   -8 },   // 0xA9
+  {  1016,   5,   7,   6,    1,   -8 },   // 0xAA
+  {  1021,   5,   5,   7,    1,   -5 },   // 0xAB
+  {  1025,   8,   3,  10,    1,   -4 },   // 0xAC
+  {  1028,   3,   1,   4,    1,   -3 },   // 0xAD
+  {  1029,   9,   9,  12,    2,   -8 },   // 0xAE
+  {  1040,   4,   1,   6,    2,   -8 },   // 0xAF
+  {  1041,   4,   4,   6,    1,   -8 },   // 0xB0
+  {  1043,   7,   7,  10,    2,   -6 },   // 0xB1
+  {  1050,   4,   5,   5,    0,   -8 },   // 0xB2
+  {  1053,   4,   5,   5,    0,   -8 },   // 0xB3
+  {  1056,   3,   2,   6,    3,   -9 },   // 0xB4
+  {  1057,   8,  10,   8,    0,   -6 },   // 0xB5
+  {  1067,   6,  10,   8,    1,   -8 },   // 0xB6
+  {  1075,   1,   2,   4,    1,   -4 },   // 0xB7
+  {  1076,   3,   2,   6,    0,    1 },   // 0xB8
+  {  1077,   3,   5,   5,    1,   -8 },   // 0xB9
+  {  1079,   5,   7,   6,    1,   -8 },   // 0xBA
+  {  1084,   5,   5,   7,    1,   -5 },   // 0xBB
+  {  1088,  10,   9,  12,    1,   -8 },   // 0xBC
+  {  1100,  10,   9,  12,    1,   -8 },   // 0xBD
+  {  1112,  11,   9,  12,    0,   -8 },   // 0xBE
+  {  1125,   5,  10,   6,    0,   -6 },   // 0xBF
+  {  1132,   8,  12,   8,   -1,  -11 },   // 0xC0
+  {  1144,   8,  12,   8,   -1,  -11 },   // 0xC1
+  {  1156,   8,  12,   8,   -1,  -11 },   // 0xC2
+  {  1168,   8,  12,   8,   -1,  -11 },   // 0xC3
+  {  1180,   8,  11,   8,   -1,  -10 },   // 0xC4
+  {  1191,   8,  11,   8,   -1,  -10 },   // 0xC5
+  {  1202,  12,   9,  12,   -1,   -8 },   // 0xC6
+  {  1216,   8,  11,   8,    0,   -8 },   // 0xC7
+  {  1227,   7,  12,   8,    0,  -11 },   // 0xC8
+  {  1238,   7,  12,   8,    0,  -11 },   // 0xC9
+  {  1249,   7,  12,   8,    0,  -11 },   // 0xCA
+  {  1260,   7,  11,   8,    0,  -10 },   // 0xCB
+  {  1270,   4,  12,   4,    0,  -11 },   // 0xCC
+  {  1276,   5,  12,   4,    0,  -11 },   // 0xCD
+  {  1284,   5,  12,   4,    0,  -11 },   // 0xCE
+  {  1292,   4,  11,   4,    0,  -10 },   // 0xCF
+  {  1298,   8,   9,   9,    0,   -8 },   // 0xD0
+  {  1307,   9,  12,   9,    0,  -11 },   // 0xD1
+  {  1321,   7,  12,   8,    0,  -11 },   // 0xD2
+  {  1332,   8,  12,   8,    0,  -11 },   // 0xD3
+  {  1344,   8,  12,   8,    0,  -11 },   // 0xD4
+  {  1356,   8,  12,   8,    0,  -11 },   // 0xD5
+  {  1368,   7,  11,   8,    0,  -10 },   // 0xD6
+  {  1378,   7,   7,  10,    2,   -6 },   // 0xD7
+  {  1385,   9,   9,   8,   -1,   -8 },   // 0xD8
+  {  1396,   7,  12,   9,    1,  -11 },   // 0xD9
+  {  1407,   7,  12,   9,    1,  -11 },   // 0xDA
+  {  1418,   7,  12,   9,    1,  -11 },   // 0xDB
+  {  1429,   7,  11,   9,    1,  -10 },   // 0xDC
+  {  1439,   7,  12,   7,    1,  -11 },   // 0xDD
+  {  1450,   7,   9,   7,    0,   -8 },   // 0xDE
+  {  1458,   7,  10,   8,    0,   -9 },   // 0xDF
+  {  1467,   7,  10,   8,    0,   -9 },   // 0xE0
+  {  1476,   7,  10,   8,    0,   -9 },   // 0xE1
+  {  1485,   7,  10,   8,    0,   -9 },   // 0xE2
+  {  1494,   7,  10,   8,    0,   -9 },   // 0xE3
+  {  1503,   7,   9,   8,    0,   -8 },   // 0xE4
+  {  1511,   7,  12,   8,    0,  -11 },   // 0xE5
+  {  1522,  11,   7,  12,    0,   -6 },   // 0xE6
+  {  1532,   6,   9,   7,    0,   -6 },   // 0xE7
+  {  1539,   7,  10,   8,    0,   -9 },   // 0xE8
+  {  1548,   7,  10,   8,    0,   -9 },   // 0xE9
+  {  1557,   7,  10,   8,    0,   -9 },   // 0xEA
+  {  1566,   7,   9,   8,    0,   -8 },   // 0xEB
+  {  1574,   2,  10,   3,    0,   -9 },   // 0xEC
+  {  1577,   4,  10,   3,    0,   -9 },   // 0xED
+  {  1582,   4,  10,   3,   -1,   -9 },   // 0xEE
+  {  1587,   3,   9,   3,    0,   -8 },   // 0xEF
+  {  1591,   6,  10,   7,    0,   -9 },   // 0xF0
+  {  1599,   7,  10,   8,    0,   -9 },   // 0xF1
+  {  1608,   7,  10,   8,    0,   -9 },   // 0xF2
+  {  1617,   7,  10,   8,    0,   -9 },   // 0xF3
+  {  1626,   7,  10,   8,    0,   -9 },   // 0xF4
+  {  1635,   7,  10,   8,    0,   -9 },   // 0xF5
+  {  1644,   7,   9,   8,    0,   -8 },   // 0xF6
+  {  1652,   7,   5,  10,    1,   -5 },   // 0xF7
+  {  1657,   8,   7,   7,   -1,   -6 },   // 0xF8
+  {  1664,   7,  10,   8,    0,   -9 },   // 0xF9
+  {  1673,   7,  10,   8,    0,   -9 },   // 0xFA
+  {  1682,   7,  10,   8,    0,   -9 },   // 0xFB
+  {  1691,   7,   9,   8,    0,   -8 },   // 0xFC
+  {  1699,   8,  13,   7,   -1,   -9 },   // 0xFD
+  {  1712,   7,  13,   8,    0,   -9 },   // 0xFE
+  {  1724,   8,  12,   7,   -1,   -8 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique6pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique6pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique6pt8bGlyphs,
+  0x20, 0xFF, 14 };
+
+// Approx. 3311 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique6pt8bMetrics[] PROGMEM = {
+  {   0,   4,   1 },   // 0x20
+  {   1,   5,   4 },   // 0x21
+  {   1,   6,   4 },   // 0x22
+  {   1,  10,   9 },   // 0x23
+  {   0,   8,   6 },   // 0x24
+  {   1,  11,  10 },   // 0x25
+  {   0,   9,   8 },   // 0x26
+  {   1,   3,   2 },   // 0x27
+  {   1,   5,   5 },   // 0x28
+  {  -1,   5,   3 },   // 0x29
+  {   1,   6,   6 },   // 0x2A
+  {   1,  10,   8 },   // 0x2B
+  {   0,   4,   2 },   // 0x2C
+  {   1,   4,   4 },   // 0x2D
+  {   1,   4,   2 },   // 0x2E
+  {  -1,   4,   5 },   // 0x2F
+  {   1,   8,   7 },   // 0x30
+  {   1,   8,   6 },   // 0x31
+  {   0,   8,   7 },   // 0x32
+  {   0,   8,   7 },   // 0x33
+  {   1,   8,   7 },   // 0x34
+  {   1,   8,   8 },   // 0x35
+  {   1,   8,   7 },   // 0x36
+  {   2,   8,   8 },   // 0x37
+  {   1,   8,   8 },   // 0x38
+  {   1,   8,   7 },   // 0x39
+  {   1,   4,   3 },   // 0x3A
+  {   0,   4,   3 },   // 0x3B
+  {   1,  10,   9 },   // 0x3C
+  {   1,  10,   9 },   // 0x3D
+  {   1,  10,   9 },   // 0x3E
+  {   1,   6,   6 },   // 0x3F
+  {   1,  12,  12 },   // 0x40
+  {  -1,   8,   7 },   // 0x41
+  {   0,   8,   7 },   // 0x42
+  {   0,   8,   8 },   // 0x43
+  {   0,   9,   8 },   // 0x44
+  {   0,   8,   7 },   // 0x45
+  {   0,   7,   7 },   // 0x46
+  {   0,   9,   8 },   // 0x47
+  {   0,   9,   9 },   // 0x48
+  {   0,   4,   3 },   // 0x49
+  {  -2,   4,   3 },   // 0x4A
+  {   0,   8,   8 },   // 0x4B
+  {   0,   7,   6 },   // 0x4C
+  {   0,  10,  10 },   // 0x4D
+  {   0,   9,   9 },   // 0x4E
+  {   0,   8,   7 },   // 0x4F
+  {   0,   7,   7 },   // 0x50
+  {   0,   8,   7 },   // 0x51
+  {   0,   8,   7 },   // 0x52
+  {   0,   8,   8 },   // 0x53
+  {   1,   7,   8 },   // 0x54
+  {   1,   9,   8 },   // 0x55
+  {   1,   8,   9 },   // 0x56
+  {   1,  12,  12 },   // 0x57
+  {  -1,   8,   8 },   // 0x58
+  {   1,   7,   8 },   // 0x59
+  {   0,   8,   9 },   // 0x5A
+  {   0,   5,   4 },   // 0x5B
+  {   1,   4,   3 },   // 0x5C
+  {   0,   5,   4 },   // 0x5D
+  {   1,  10,   9 },   // 0x5E
+  {   0,   6,   6 },   // 0x5F
+  {   2,   6,   4 },   // 0x60
+  {   0,   8,   7 },   // 0x61
+  {   0,   8,   7 },   // 0x62
+  {   0,   7,   6 },   // 0x63
+  {   0,   8,   8 },   // 0x64
+  {   0,   8,   7 },   // 0x65
+  {   0,   4,   5 },   // 0x66
+  {   0,   8,   7 },   // 0x67
+  {   0,   8,   7 },   // 0x68
+  {   0,   3,   3 },   // 0x69
+  {  -1,   3,   3 },   // 0x6A
+  {   0,   7,   7 },   // 0x6B
+  {   0,   3,   3 },   // 0x6C
+  {   0,  11,  10 },   // 0x6D
+  {   0,   8,   7 },   // 0x6E
+  {   0,   8,   7 },   // 0x6F
+  {  -1,   8,   7 },   // 0x70
+  {   0,   8,   7 },   // 0x71
+  {   0,   5,   5 },   // 0x72
+  {   0,   6,   6 },   // 0x73
+  {   1,   5,   5 },   // 0x74
+  {   0,   8,   7 },   // 0x75
+  {   0,   6,   6 },   // 0x76
+  {   1,  10,  10 },   // 0x77
+  {  -1,   7,   7 },   // 0x78
+  {  -1,   7,   7 },   // 0x79
+  {  -1,   6,   6 },   // 0x7A
+  {   2,   8,   8 },   // 0x7B
+  {   2,   4,   3 },   // 0x7C
+  {   0,   8,   6 },   // 0x7D
+  {   1,  10,   9 },   // 0x7E
+  {   1,   7,   7 },   // 0x7F
+  {   1,   7,   7 },   // 0x80
+  {   1,   7,   7 },   // 0x81
+  {   1,   7,   7 },   // 0x82
+  {   1,   7,   7 },   // 0x83
+  {   1,   7,   7 },   // 0x84
+  {   1,   7,   7 },   // 0x85
+  {   1,   7,   7 },   // 0x86
+  {   1,   7,   7 },   // 0x87
+  {   1,   7,   7 },   // 0x88
+  {   1,   7,   7 },   // 0x89
+  {   1,   7,   7 },   // 0x8A
+  {   1,   7,   7 },   // 0x8B
+  {   1,   7,   7 },   // 0x8C
+  {   1,   7,   7 },   // 0x8D
+  {   1,   7,   7 },   // 0x8E
+  {   1,   7,   7 },   // 0x8F
+  {   1,   7,   7 },   // 0x90
+  {   1,   7,   7 },   // 0x91
+  {   1,   7,   7 },   // 0x92
+  {   1,   7,   7 },   // 0x93
+  {   1,   7,   7 },   // 0x94
+  {   1,   7,   7 },   // 0x95
+  {   1,   7,   7 },   // 0x96
+  {   1,   7,   7 },   // 0x97
+  {   1,   7,   7 },   // 0x98
+  {   1,   7,   7 },   // 0x99
+  {   1,   7,   7 },   // 0x9A
+  {   1,   7,   7 },   // 0x9B
+  {   1,   7,   7 },   // 0x9C
+  {   1,   7,   7 },   // 0x9D
+  {   1,   7,   7 },   // 0x9E
+  {   1,   7,   7 },   // 0x9F
+  {   0,   4,   1 },   // 0xA0
+  {   1,   5,   4 },   // 0xA1
+  {   1,   8,   7 },   // 0xA2
+  {   0,   8,   8 },   // 0xA3
+  {   0,   8,   7 },   // 0xA4
+  {   0,   8,   8 },   // 0xA5
+  {   2,   4,   3 },   // 0xA6
+  {   1,   6,   6 },   // 0xA7
+  {   2,   6,   5 },   // 0xA8
+  {   2,  12,  11 },   // 0xA9
+  {   1,   6,   6 },   // 0xAA
+  {   1,   7,   6 },   // 0xAB
+  {   1,  10,   9 },   // 0xAC
+  {   1,   4,   4 },   // 0xAD
+  {   2,  12,  11 },   // 0xAE
+  {   2,   6,   6 },   // 0xAF
+  {   1,   6,   5 },   // 0xB0
+  {   2,  10,   9 },   // 0xB1
+  {   0,   5,   4 },   // 0xB2
+  {   0,   5,   4 },   // 0xB3
+  {   3,   6,   6 },   // 0xB4
+  {   0,   8,   8 },   // 0xB5
+  {   1,   8,   7 },   // 0xB6
+  {   1,   4,   2 },   // 0xB7
+  {   0,   6,   3 },   // 0xB8
+  {   1,   5,   4 },   // 0xB9
+  {   1,   6,   6 },   // 0xBA
+  {   1,   7,   6 },   // 0xBB
+  {   1,  12,  11 },   // 0xBC
+  {   1,  12,  11 },   // 0xBD
+  {   0,  12,  11 },   // 0xBE
+  {   0,   6,   5 },   // 0xBF
+  {  -1,   8,   7 },   // 0xC0
+  {  -1,   8,   7 },   // 0xC1
+  {  -1,   8,   7 },   // 0xC2
+  {  -1,   8,   7 },   // 0xC3
+  {  -1,   8,   7 },   // 0xC4
+  {  -1,   8,   7 },   // 0xC5
+  {  -1,  12,  11 },   // 0xC6
+  {   0,   8,   8 },   // 0xC7
+  {   0,   8,   7 },   // 0xC8
+  {   0,   8,   7 },   // 0xC9
+  {   0,   8,   7 },   // 0xCA
+  {   0,   8,   7 },   // 0xCB
+  {   0,   4,   4 },   // 0xCC
+  {   0,   4,   5 },   // 0xCD
+  {   0,   4,   5 },   // 0xCE
+  {   0,   4,   4 },   // 0xCF
+  {   0,   9,   8 },   // 0xD0
+  {   0,   9,   9 },   // 0xD1
+  {   0,   8,   7 },   // 0xD2
+  {   0,   8,   8 },   // 0xD3
+  {   0,   8,   8 },   // 0xD4
+  {   0,   8,   8 },   // 0xD5
+  {   0,   8,   7 },   // 0xD6
+  {   2,  10,   9 },   // 0xD7
+  {  -1,   8,   8 },   // 0xD8
+  {   1,   9,   8 },   // 0xD9
+  {   1,   9,   8 },   // 0xDA
+  {   1,   9,   8 },   // 0xDB
+  {   1,   9,   8 },   // 0xDC
+  {   1,   7,   8 },   // 0xDD
+  {   0,   7,   7 },   // 0xDE
+  {   0,   8,   7 },   // 0xDF
+  {   0,   8,   7 },   // 0xE0
+  {   0,   8,   7 },   // 0xE1
+  {   0,   8,   7 },   // 0xE2
+  {   0,   8,   7 },   // 0xE3
+  {   0,   8,   7 },   // 0xE4
+  {   0,   8,   7 },   // 0xE5
+  {   0,  12,  11 },   // 0xE6
+  {   0,   7,   6 },   // 0xE7
+  {   0,   8,   7 },   // 0xE8
+  {   0,   8,   7 },   // 0xE9
+  {   0,   8,   7 },   // 0xEA
+  {   0,   8,   7 },   // 0xEB
+  {   0,   3,   2 },   // 0xEC
+  {   0,   3,   4 },   // 0xED
+  {  -1,   3,   3 },   // 0xEE
+  {   0,   3,   3 },   // 0xEF
+  {   0,   7,   6 },   // 0xF0
+  {   0,   8,   7 },   // 0xF1
+  {   0,   8,   7 },   // 0xF2
+  {   0,   8,   7 },   // 0xF3
+  {   0,   8,   7 },   // 0xF4
+  {   0,   8,   7 },   // 0xF5
+  {   0,   8,   7 },   // 0xF6
+  {   1,  10,   8 },   // 0xF7
+  {  -1,   7,   7 },   // 0xF8
+  {   0,   8,   7 },   // 0xF9
+  {   0,   8,   7 },   // 0xFA
+  {   0,   8,   7 },   // 0xFB
+  {   0,   8,   7 },   // 0xFC
+  {  -1,   7,   7 },   // 0xFD
+  {   0,   8,   7 },   // 0xFE
+  {  -1,   7,   7 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique6pt8bWidths = { DejaVuSans_Oblique6pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE6PTLAT1__H
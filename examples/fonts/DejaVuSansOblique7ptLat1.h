@@ -0,0 +1,653 @@
+#ifndef DEJAVUSANSOBLIQUE7PTLAT1__H
+#define DEJAVUSANSOBLIQUE7PTLAT1__H
+const uint8_t DejaVuSans_Oblique7pt8bBitmaps[] PROGMEM = {
+  0x00, 0x25, 0x24, 0x80, 0x90, 0xB6, 0xD0, 0x09, 0x02, 0x40, 0x91, 0xFF,
+  0x12, 0x04, 0x8F, 0xF8, 0x90, 0x24, 0x09, 0x00, 0x04, 0x04, 0x1E, 0x6A,
+  0x48, 0x48, 0x3C, 0x16, 0x12, 0x96, 0xF8, 0x20, 0x20, 0x70, 0x59, 0x12,
+  0x24, 0x45, 0x09, 0xFC, 0xEE, 0x42, 0x88, 0x91, 0x22, 0x68, 0x38, 0x0E,
+  0x0C, 0x42, 0x00, 0x80, 0x30, 0x12, 0x18, 0x4A, 0x0E, 0xC3, 0x1F, 0x20,
+  0xF0, 0x19, 0x88, 0x84, 0x42, 0x10, 0x84, 0x20, 0x80, 0x10, 0x42, 0x10,
+  0x84, 0x22, 0x11, 0x19, 0x80, 0x11, 0x25, 0xF1, 0xCD, 0x62, 0x00, 0x08,
+  0x04, 0x02, 0x01, 0x0F, 0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0x58, 0xF0,
+  0xC0, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x00,
+  0x1E, 0x23, 0x41, 0x41, 0x81, 0x81, 0x82, 0x82, 0xC4, 0x78, 0x19, 0xA0,
+  0x84, 0x10, 0x41, 0x08, 0x23, 0xF0, 0x1E, 0x21, 0x01, 0x01, 0x02, 0x04,
+  0x18, 0x30, 0x40, 0xFE, 0x1E, 0x21, 0x01, 0x02, 0x1C, 0x02, 0x02, 0x02,
+  0x84, 0x78, 0x03, 0x05, 0x0A, 0x12, 0x22, 0x42, 0xFF, 0x04, 0x04, 0x04,
+  0x3E, 0x20, 0x20, 0x3C, 0x46, 0x02, 0x02, 0x02, 0x84, 0x78, 0x1E, 0x21,
+  0x40, 0x40, 0xBC, 0xC2, 0x82, 0x82, 0x84, 0x78, 0xFE, 0x08, 0x10, 0x40,
+  0x82, 0x08, 0x10, 0x41, 0x00, 0x1E, 0x61, 0x41, 0x42, 0x3C, 0x46, 0x82,
+  0x82, 0xC4, 0x78, 0x3C, 0x86, 0x0C, 0x18, 0x6F, 0x41, 0x82, 0x8C, 0xE0,
+  0x50, 0x28, 0x24, 0x00, 0x94, 0x00, 0x83, 0x8E, 0x1C, 0x0E, 0x01, 0xC0,
+  0x1C, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x80, 0x38, 0x03, 0x80, 0x70,
+  0x38, 0x71, 0xC1, 0x00, 0x74, 0x42, 0x22, 0x21, 0x00, 0x84, 0x00, 0x0F,
+  0x81, 0x86, 0x20, 0x34, 0x79, 0xC9, 0x99, 0x09, 0x90, 0xB9, 0x12, 0x8F,
+  0xC4, 0x00, 0x61, 0x81, 0xF0, 0x06, 0x03, 0x02, 0x41, 0x21, 0x10, 0x88,
+  0xFC, 0x81, 0x40, 0xC0, 0x40, 0x3E, 0x21, 0x61, 0x42, 0x7C, 0x42, 0x42,
+  0xC2, 0x86, 0xFC, 0x1F, 0x18, 0x50, 0x08, 0x08, 0x04, 0x02, 0x01, 0x02,
+  0x42, 0x1E, 0x00, 0x3F, 0x08, 0x26, 0x05, 0x01, 0x40, 0x50, 0x14, 0x0B,
+  0x02, 0x83, 0x3F, 0x00, 0x3F, 0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0,
+  0x80, 0xFC, 0x3F, 0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0, 0x80, 0x80,
+  0x0F, 0x8C, 0x14, 0x01, 0x00, 0x80, 0x20, 0xF8, 0x06, 0x02, 0x40, 0x8F,
+  0xC0, 0x20, 0x24, 0x05, 0x81, 0xA0, 0x27, 0xFC, 0x80, 0x90, 0x16, 0x06,
+  0x80, 0x90, 0x10, 0x25, 0xA4, 0x96, 0x90, 0x04, 0x10, 0x42, 0x08, 0x20,
+  0x82, 0x10, 0x41, 0x08, 0xE0, 0x20, 0x88, 0x46, 0x61, 0x20, 0x70, 0x14,
+  0x04, 0x83, 0x10, 0x82, 0x20, 0x40, 0x20, 0x41, 0x82, 0x04, 0x08, 0x10,
+  0x60, 0x81, 0xFC, 0x30, 0x66, 0x0C, 0xC3, 0x28, 0xA4, 0x94, 0x94, 0x93,
+  0x12, 0x64, 0x80, 0x90, 0x10, 0x30, 0x26, 0x05, 0xA1, 0xA4, 0x24, 0x44,
+  0x88, 0x90, 0x96, 0x16, 0x81, 0x90, 0x30, 0x1E, 0x10, 0x90, 0x28, 0x18,
+  0x0C, 0x06, 0x05, 0x02, 0x42, 0x1E, 0x00, 0x3E, 0x21, 0x61, 0x41, 0x42,
+  0x7C, 0x40, 0xC0, 0x80, 0x80, 0x1E, 0x10, 0x90, 0x28, 0x18, 0x0C, 0x06,
+  0x05, 0x02, 0x42, 0x1E, 0x02, 0x00, 0x80, 0x3E, 0x21, 0x61, 0x41, 0x42,
+  0x7C, 0x42, 0xC2, 0x81, 0x81, 0x1E, 0x21, 0x40, 0x40, 0x70, 0x1E, 0x02,
+  0x02, 0x86, 0x78, 0xFF, 0x84, 0x02, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20,
+  0x20, 0x10, 0x00, 0x40, 0xA0, 0x90, 0x50, 0x28, 0x14, 0x0A, 0x09, 0x04,
+  0x86, 0x3C, 0x00, 0x80, 0xC0, 0xA0, 0x48, 0x44, 0x42, 0x21, 0x20, 0x90,
+  0x50, 0x10, 0x00, 0x82, 0x0C, 0x30, 0xA1, 0x85, 0x14, 0x48, 0xA2, 0x49,
+  0x22, 0x49, 0x14, 0x30, 0x61, 0x82, 0x08, 0x00, 0x08, 0x20, 0x88, 0x12,
+  0x01, 0x80, 0x20, 0x0A, 0x02, 0x40, 0x84, 0x20, 0x88, 0x08, 0x80, 0xA0,
+  0x98, 0x84, 0x81, 0x80, 0x80, 0x40, 0x20, 0x20, 0x10, 0x00, 0x3F, 0xC0,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x3F, 0xC0, 0x39,
+  0x08, 0x84, 0x21, 0x08, 0x44, 0x21, 0xC0, 0xAA, 0xF5, 0x55, 0x38, 0x42,
+  0x21, 0x08, 0x42, 0x11, 0x09, 0xC0, 0x1C, 0x1B, 0x18, 0xD8, 0x30, 0xFE,
+  0x88, 0x80, 0x3C, 0x84, 0x09, 0xFC, 0x30, 0xE3, 0x3A, 0x20, 0x20, 0x20,
+  0x5E, 0x63, 0x41, 0x41, 0x41, 0xC2, 0xC6, 0xBC, 0x1C, 0xC5, 0x04, 0x08,
+  0x10, 0x31, 0x3C, 0x00, 0x80, 0x40, 0x23, 0xA6, 0x32, 0x0A, 0x05, 0x06,
+  0x82, 0x63, 0x1E, 0x80, 0x1E, 0x63, 0x41, 0xFF, 0x80, 0x80, 0xC2, 0x7C,
+  0x3A, 0x11, 0xE4, 0x21, 0x10, 0x84, 0x20, 0x3D, 0x63, 0x42, 0x82, 0x82,
+  0x82, 0xC6, 0x7C, 0x04, 0x8C, 0xF0, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x41,
+  0x41, 0x41, 0x82, 0x82, 0x82, 0x24, 0x12, 0x92, 0x52, 0x00, 0x08, 0x40,
+  0x21, 0x08, 0x44, 0x21, 0x08, 0x42, 0x20, 0x20, 0x20, 0x20, 0x42, 0x44,
+  0x48, 0x50, 0x60, 0x90, 0x88, 0x84, 0x24, 0xA4, 0x92, 0x92, 0x00, 0x2E,
+  0xE3, 0x31, 0x42, 0x14, 0x21, 0x42, 0x14, 0x42, 0x84, 0x28, 0x42, 0x5E,
+  0x61, 0x41, 0x41, 0x81, 0x82, 0x82, 0x82, 0x1E, 0x63, 0x41, 0x81, 0x81,
+  0x82, 0xC6, 0x78, 0x2F, 0x18, 0xC8, 0x2C, 0x14, 0x0A, 0x09, 0x8C, 0xB8,
+  0x80, 0x40, 0x20, 0x00, 0x3D, 0x63, 0x43, 0x82, 0x82, 0x82, 0xC6, 0x7A,
+  0x04, 0x04, 0x04, 0x39, 0x10, 0x84, 0x22, 0x10, 0x3C, 0x85, 0x03, 0x80,
+  0xC0, 0xA1, 0x3C, 0x42, 0x3E, 0x84, 0x42, 0x10, 0x87, 0x80, 0x41, 0x41,
+  0x41, 0x81, 0x82, 0x82, 0x86, 0x7A, 0x83, 0x0A, 0x12, 0x44, 0x8A, 0x14,
+  0x30, 0x84, 0x63, 0x18, 0xCA, 0x52, 0x95, 0x29, 0x4A, 0x53, 0x18, 0x11,
+  0x09, 0x02, 0x81, 0x80, 0xC1, 0xA1, 0x89, 0x84, 0x20, 0x90, 0x88, 0x42,
+  0x41, 0x60, 0xA0, 0x70, 0x10, 0x10, 0x08, 0x38, 0x00, 0x3F, 0x02, 0x04,
+  0x08, 0x10, 0x20, 0x40, 0xFE, 0x0C, 0x41, 0x08, 0x20, 0x8C, 0x08, 0x21,
+  0x04, 0x10, 0x70, 0xFF, 0xFC, 0x1C, 0x08, 0x10, 0x20, 0x81, 0x81, 0x84,
+  0x08, 0x20, 0x40, 0x8E, 0x00, 0x78, 0xC7, 0x80, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0F, 0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F,
+  0xF0, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0,
+  0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0F, 0xF0, 0x00,
+  0x24, 0x04, 0x92, 0x90, 0x08, 0x10, 0xF3, 0x64, 0x92, 0x24, 0x48, 0xD0,
+  0xF0, 0x81, 0x00, 0x07, 0x84, 0x04, 0x02, 0x01, 0x03, 0xF0, 0x40, 0x40,
+  0x20, 0x7F, 0x00, 0x81, 0x7E, 0x66, 0x42, 0x42, 0x66, 0x7E, 0x81, 0x41,
+  0x42, 0x22, 0x24, 0xEE, 0x10, 0xFE, 0x10, 0x20, 0x20, 0xF9, 0xF0, 0x3D,
+  0x06, 0x1E, 0x8E, 0x1C, 0x5E, 0x08, 0x2F, 0x00, 0x99, 0x1E, 0x18, 0x65,
+  0xEA, 0xC1, 0xA0, 0x68, 0x1B, 0x05, 0x7A, 0x61, 0x87, 0x80, 0x78, 0x5F,
+  0x19, 0xF8, 0x1E, 0x12, 0x4B, 0x66, 0xC6, 0xC4, 0x80, 0xFF, 0x80, 0x40,
+  0x20, 0x10, 0xF0, 0x1E, 0x18, 0x65, 0xEA, 0x49, 0x9C, 0x65, 0x19, 0x25,
+  0x4E, 0x61, 0x87, 0x80, 0xF0, 0x69, 0x96, 0x08, 0x04, 0x02, 0x1F, 0xF0,
+  0x80, 0x40, 0x20, 0x00, 0xFF, 0x80, 0x78, 0x42, 0x64, 0x78, 0x78, 0x4C,
+  0x10, 0xF8, 0x24, 0x80, 0x21, 0x21, 0x21, 0x41, 0x41, 0x42, 0x46, 0x7B,
+  0x80, 0x80, 0x80, 0x3D, 0xDF, 0x7F, 0xE9, 0xA2, 0x8A, 0x79, 0x45, 0x00,
+  0xC0, 0x27, 0x80, 0x64, 0xA5, 0xC0, 0x72, 0x63, 0x19, 0x38, 0x1E, 0x48,
+  0xD8, 0xD9, 0xB4, 0x92, 0x00, 0x60, 0x44, 0x10, 0x84, 0x21, 0x04, 0x21,
+  0xC8, 0xC2, 0x28, 0x89, 0x22, 0x48, 0x7C, 0x01, 0x00, 0x60, 0x42, 0x08,
+  0x21, 0x04, 0x20, 0x42, 0x0E, 0x4F, 0x08, 0x11, 0x01, 0x20, 0x64, 0x08,
+  0x01, 0xE0, 0x78, 0x20, 0x84, 0x30, 0x80, 0x90, 0x09, 0x0F, 0x23, 0x04,
+  0x50, 0x89, 0x11, 0x22, 0x1F, 0x00, 0x20, 0x08, 0x40, 0x11, 0x09, 0x88,
+  0x84, 0x5C, 0x04, 0x01, 0x00, 0x00, 0xC0, 0x60, 0x48, 0x24, 0x22, 0x11,
+  0x1F, 0x90, 0x28, 0x18, 0x08, 0x01, 0x01, 0x00, 0x00, 0xC0, 0x60, 0x48,
+  0x24, 0x22, 0x11, 0x1F, 0x90, 0x28, 0x18, 0x08, 0x06, 0x04, 0x80, 0x00,
+  0xC0, 0x60, 0x48, 0x24, 0x22, 0x11, 0x1F, 0x90, 0x28, 0x18, 0x08, 0x06,
+  0x85, 0x80, 0x00, 0xC0, 0x60, 0x48, 0x24, 0x22, 0x11, 0x1F, 0x90, 0x28,
+  0x18, 0x08, 0x09, 0x04, 0x80, 0x00, 0xC0, 0x60, 0x48, 0x24, 0x22, 0x11,
+  0x1F, 0x90, 0x28, 0x18, 0x08, 0x06, 0x02, 0x40, 0x90, 0x18, 0x0A, 0x02,
+  0x81, 0x10, 0x44, 0x21, 0x0F, 0xC4, 0x09, 0x02, 0x80, 0x80, 0x03, 0xFE,
+  0x05, 0x00, 0x12, 0x00, 0x44, 0x00, 0x8F, 0xC2, 0x20, 0x0F, 0xC0, 0x10,
+  0x80, 0x41, 0x01, 0x03, 0xF0, 0x1F, 0x18, 0x50, 0x08, 0x08, 0x04, 0x02,
+  0x01, 0x02, 0x42, 0x1E, 0x01, 0x00, 0x81, 0xC0, 0x08, 0x04, 0x00, 0x3F,
+  0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0, 0x80, 0xFC, 0x02, 0x04, 0x00,
+  0x3F, 0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0, 0x80, 0xFC, 0x0C, 0x12,
+  0x00, 0x3F, 0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0, 0x80, 0xFC, 0x12,
+  0x12, 0x00, 0x3F, 0x20, 0x60, 0x40, 0x7E, 0x40, 0x40, 0xC0, 0x80, 0xFC,
+  0x21, 0x02, 0x26, 0x44, 0x44, 0xC8, 0x80, 0x08, 0x40, 0x08, 0x21, 0x84,
+  0x10, 0x41, 0x0C, 0x20, 0x80, 0x32, 0x40, 0x42, 0x31, 0x08, 0x42, 0x31,
+  0x08, 0x00, 0x4A, 0x40, 0x42, 0x31, 0x08, 0x42, 0x31, 0x08, 0x00, 0x3F,
+  0x08, 0x26, 0x05, 0x01, 0xF8, 0x50, 0x14, 0x0B, 0x02, 0x83, 0x3F, 0x00,
+  0x06, 0x81, 0x60, 0x00, 0x18, 0x13, 0x02, 0xD0, 0xD2, 0x12, 0x22, 0x44,
+  0x48, 0x4B, 0x0B, 0x40, 0xC8, 0x18, 0x08, 0x02, 0x00, 0x03, 0xC2, 0x12,
+  0x05, 0x03, 0x01, 0x80, 0xC0, 0xA0, 0x48, 0x43, 0xC0, 0x02, 0x02, 0x00,
+  0x03, 0xC2, 0x12, 0x05, 0x03, 0x01, 0x80, 0xC0, 0xA0, 0x48, 0x43, 0xC0,
+  0x0C, 0x09, 0x00, 0x03, 0xC2, 0x12, 0x05, 0x03, 0x01, 0x80, 0xC0, 0xA0,
+  0x48, 0x43, 0xC0, 0x0D, 0x0B, 0x00, 0x03, 0xC2, 0x12, 0x05, 0x03, 0x01,
+  0x80, 0xC0, 0xA0, 0x48, 0x43, 0xC0, 0x12, 0x09, 0x00, 0x03, 0xC2, 0x12,
+  0x05, 0x03, 0x01, 0x80, 0xC0, 0xA0, 0x48, 0x43, 0xC0, 0x81, 0x42, 0x24,
+  0x18, 0x18, 0x24, 0x42, 0x81, 0x0F, 0xA2, 0x18, 0x87, 0x11, 0x24, 0x44,
+  0x90, 0x94, 0x23, 0x04, 0x61, 0x17, 0xC0, 0x08, 0x02, 0x00, 0x08, 0x14,
+  0x12, 0x0A, 0x05, 0x02, 0x81, 0x41, 0x20, 0x90, 0xC7, 0x80, 0x02, 0x02,
+  0x00, 0x08, 0x14, 0x12, 0x0A, 0x05, 0x02, 0x81, 0x41, 0x20, 0x90, 0xC7,
+  0x80, 0x0C, 0x09, 0x00, 0x08, 0x14, 0x12, 0x0A, 0x05, 0x02, 0x81, 0x41,
+  0x20, 0x90, 0xC7, 0x80, 0x12, 0x09, 0x00, 0x08, 0x14, 0x12, 0x0A, 0x05,
+  0x02, 0x81, 0x41, 0x20, 0x90, 0xC7, 0x80, 0x04, 0x04, 0x00, 0x10, 0x14,
+  0x13, 0x10, 0x90, 0x30, 0x10, 0x08, 0x04, 0x04, 0x02, 0x00, 0x20, 0x3E,
+  0x61, 0x41, 0x41, 0x42, 0x7C, 0xC0, 0x80, 0x80, 0x1E, 0x31, 0x21, 0x26,
+  0x48, 0x48, 0x4C, 0x46, 0x41, 0x81, 0xBE, 0x10, 0x10, 0x10, 0x03, 0xC8,
+  0x40, 0x9F, 0xC3, 0x0E, 0x33, 0xA0, 0x02, 0x04, 0x08, 0x00, 0x3C, 0x42,
+  0x02, 0x3E, 0xC2, 0x86, 0x8C, 0x74, 0x04, 0x18, 0x48, 0x03, 0xC8, 0x40,
+  0x9F, 0xC3, 0x0E, 0x33, 0xA0, 0x0D, 0x16, 0x00, 0x3C, 0x42, 0x02, 0x3E,
+  0xC2, 0x86, 0x8C, 0x74, 0x12, 0x24, 0x01, 0xE4, 0x20, 0x4F, 0xE1, 0x87,
+  0x19, 0xD0, 0x0C, 0x24, 0x48, 0x60, 0x07, 0x90, 0x81, 0x3F, 0x86, 0x1C,
+  0x67, 0x40, 0x3C, 0xF2, 0x18, 0x40, 0x82, 0x7F, 0xFC, 0x20, 0x43, 0x02,
+  0x38, 0x4F, 0x3C, 0x1C, 0xC5, 0x04, 0x08, 0x10, 0x31, 0x3C, 0x08, 0x10,
+  0xE0, 0x10, 0x08, 0x04, 0x00, 0x1E, 0x63, 0x41, 0xFF, 0x80, 0x80, 0xC2,
+  0x7C, 0x02, 0x04, 0x08, 0x00, 0x1E, 0x63, 0x41, 0xFF, 0x80, 0x80, 0xC2,
+  0x7C, 0x04, 0x0C, 0x12, 0x00, 0x1E, 0x63, 0x41, 0xFF, 0x80, 0x80, 0xC2,
+  0x7C, 0x12, 0x12, 0x00, 0x1E, 0x63, 0x41, 0xFF, 0x80, 0x80, 0xC2, 0x7C,
+  0x88, 0x82, 0x52, 0x4A, 0x40, 0x11, 0x10, 0x02, 0x11, 0x08, 0x42, 0x21,
+  0x00, 0x26, 0x90, 0x22, 0x44, 0x44, 0x88, 0x99, 0x02, 0x24, 0x44, 0x48,
+  0x80, 0x1E, 0x70, 0x11, 0xF6, 0x28, 0x60, 0xC1, 0x85, 0x19, 0xE0, 0x0D,
+  0x16, 0x00, 0x5E, 0x61, 0x41, 0x41, 0x81, 0x82, 0x82, 0x82, 0x10, 0x08,
+  0x04, 0x00, 0x1E, 0x63, 0x41, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x02, 0x04,
+  0x08, 0x00, 0x1E, 0x63, 0x41, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x04, 0x0C,
+  0x12, 0x00, 0x1E, 0x63, 0x41, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x0D, 0x16,
+  0x00, 0x1E, 0x63, 0x41, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x12, 0x12, 0x00,
+  0x1E, 0x63, 0x41, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x0C, 0x03, 0x00, 0x03,
+  0xFF, 0x00, 0x03, 0x00, 0xC0, 0x1E, 0x99, 0x89, 0x49, 0x24, 0x92, 0x91,
+  0x99, 0x78, 0x10, 0x08, 0x04, 0x00, 0x41, 0x41, 0x41, 0x81, 0x82, 0x82,
+  0x86, 0x7A, 0x02, 0x04, 0x08, 0x00, 0x41, 0x41, 0x41, 0x81, 0x82, 0x82,
+  0x86, 0x7A, 0x04, 0x0C, 0x12, 0x00, 0x41, 0x41, 0x41, 0x81, 0x82, 0x82,
+  0x86, 0x7A, 0x12, 0x12, 0x00, 0x41, 0x41, 0x41, 0x81, 0x82, 0x82, 0x86,
+  0x7A, 0x01, 0x01, 0x01, 0x00, 0x02, 0x09, 0x08, 0x84, 0x24, 0x16, 0x0A,
+  0x07, 0x01, 0x01, 0x00, 0x83, 0x80, 0x10, 0x10, 0x20, 0x2E, 0x31, 0x21,
+  0x21, 0x41, 0x42, 0x62, 0x5C, 0x40, 0x80, 0x80, 0x09, 0x04, 0x80, 0x04,
+  0x12, 0x11, 0x08, 0x48, 0x2C, 0x14, 0x0E, 0x02, 0x02, 0x01, 0x07, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique7pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   3,  10,   6,    1,   -9 },   // 0x21 '!'
+  {     5,   3,   4,   6,    1,   -9 },   // 0x22 '"'
+  {     7,  10,  10,  12,    1,   -9 },   // 0x23 '#'
+  {    20,   8,  13,   9,    1,  -10 },   // 0x24 '$'
+  {    33,  11,  10,  13,    1,   -9 },   // 0x25 '%'
+  {    47,  10,  10,  11,    0,   -9 },   // 0x26 '&'
+  {    60,   1,   4,   4,    1,   -9 },   // 0x27 '''
+  {    61,   5,  12,   5,    1,  -10 },   // 0x28 '('
+  {    69,   5,  12,   5,   -1,  -10 },   // 0x29 ')'
+  {    77,   7,   6,   7,    0,   -9 },   // 0x2A '*'
+  {    83,   9,   9,  12,    1,   -8 },   // 0x2B '+'
+  {    94,   2,   3,   4,    0,   -1 },   // 0x2C ','
+  {    95,   4,   1,   5,    0,   -3 },   // 0x2D '-'
+  {    96,   1,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    97,   7,  12,   5,   -1,   -9 },   // 0x2F '/'
+  {   108,   8,  10,   9,    1,   -9 },   // 0x30 '0'
+  {   118,   6,  10,   9,    1,   -9 },   // 0x31 '1'
+  {   126,   8,  10,   9,    0,   -9 },   // 0x32 '2'
+  {   136,   8,  10,   9,    1,   -9 },   // 0x33 '3'
+  {   146,   8,  10,   9,    1,   -9 },   // 0x34 '4'
+  {   156,   8,  10,   9,    1,   -9 },   // 0x35 '5'
+  {   166,   8,  10,   9,    1,   -9 },   // 0x36 '6'
+  {   176,   7,  10,   9,    2,   -9 },   // 0x37 '7'
+  {   185,   8,  10,   9,    1,   -9 },   // 0x38 '8'
+  {   195,   7,  10,   9,    2,   -9 },   // 0x39 '9'
+  {   204,   2,   7,   5,    1,   -6 },   // 0x3A ':'
+  {   206,   3,   8,   5,    0,   -6 },   // 0x3B ';'
+  {   209,   9,   8,  12,    1,   -7 },   // 0x3C '<'
+  {   218,   9,   4,  12,    1,   -6 },   // 0x3D '='
+  {   223,   9,   8,  12,    1,   -7 },   // 0x3E '>'
+  {   232,   5,  10,   7,    2,   -9 },   // 0x3F '?'
+  {   239,  12,  12,  14,    1,   -9 },   // 0x40 '@'
+  {   257,   9,  10,  10,   -1,   -9 },   // 0x41 'A'
+  {   269,   8,  10,  10,    0,   -9 },   // 0x42 'B'
+  {   279,   9,  10,  10,    0,   -9 },   // 0x43 'C'
+  {   291,  10,  10,  11,    0,   -9 },   // 0x44 'D'
+  {   304,   8,  10,   9,    0,   -9 },   // 0x45 'E'
+  {   314,   8,  10,   8,    0,   -9 },   // 0x46 'F'
+  {   324,  10,  10,  11,    0,   -9 },   // 0x47 'G'
+  {   337,  11,  10,  11,    0,   -9 },   // 0x48 'H'
+  {   351,   3,  10,   4,    0,   -9 },   // 0x49 'I'
+  {   355,   6,  13,   4,   -2,   -9 },   // 0x4A 'J'
+  {   365,  10,  10,   9,    0,   -9 },   // 0x4B 'K'
+  {   378,   7,  10,   8,    0,   -9 },   // 0x4C 'L'
+  {   387,  11,  10,  12,    0,   -9 },   // 0x4D 'M'
+  {   401,  11,  10,  11,    0,   -9 },   // 0x4E 'N'
+  {   415,   9,  10,  11,    1,   -9 },   // 0x4F 'O'
+  {   427,   8,  10,   8,    0,   -9 },   // 0x50 'P'
+  {   437,   9,  12,  11,    1,   -9 },   // 0x51 'Q'
+  {   451,   8,  10,  10,    0,   -9 },   // 0x52 'R'
+  {   461,   8,  10,   9,    0,   -9 },   // 0x53 'S'
+  {   471,   9,  10,   9,    0,   -9 },   // 0x54 'T'
+  {   483,   9,  10,  10,    1,   -9 },   // 0x55 'U'
+  {   495,   9,  10,  10,    1,   -9 },   // 0x56 'V'
+  {   507,  13,  10,  14,    1,   -9 },   // 0x57 'W'
+  {   524,  11,  10,  10,   -2,   -9 },   // 0x58 'X'
+  {   538,   9,  10,   9,    1,   -9 },   // 0x59 'Y'
+  {   550,  10,  10,  10,    0,   -9 },   // 0x5A 'Z'
+  {   563,   5,  12,   5,    1,  -10 },   // 0x5B '['
+  {   571,   2,  12,   5,    1,   -9 },   // 0x5C '\'
+  {   574,   5,  12,   5,   -1,  -10 },   // 0x5D ']'
+  {   582,   9,   4,  12,    1,   -9 },   // 0x5E '^'
+  {   587,   7,   1,   7,    0,    3 },   // 0x5F '_'
+  {   588,   3,   3,   7,    2,  -11 },   // 0x60 '`'
+  {   590,   7,   8,   8,    0,   -7 },   // 0x61 'a'
+  {   597,   8,  11,   9,    0,  -10 },   // 0x62 'b'
+  {   608,   7,   8,   8,    0,   -7 },   // 0x63 'c'
+  {   615,   9,  11,   9,    0,  -10 },   // 0x64 'd'
+  {   628,   8,   8,   9,    0,   -7 },   // 0x65 'e'
+  {   636,   5,  11,   4,    0,  -10 },   // 0x66 'f'
+  {   643,   8,  11,   9,    0,   -7 },   // 0x67 'g'
+  {   654,   8,  11,   9,    0,  -10 },   // 0x68 'h'
+  {   665,   3,  11,   3,    0,  -10 },   // 0x69 'i'
+  {   670,   5,  14,   3,   -3,  -10 },   // 0x6A 'j'
+  {   679,   8,  11,   8,    0,  -10 },   // 0x6B 'k'
+  {   690,   3,  11,   3,    0,  -10 },   // 0x6C 'l'
+  {   695,  12,   8,  13,    0,   -7 },   // 0x6D 'm'
+  {   707,   8,   8,   9,    0,   -7 },   // 0x6E 'n'
+  {   715,   8,   8,   9,    0,   -7 },   // 0x6F 'o'
+  {   723,   9,  11,   9,   -1,   -7 },   // 0x70 'p'
+  {   736,   8,  11,   9,    0,   -7 },   // 0x71 'q'
+  {   747,   5,   8,   5,    0,   -7 },   // 0x72 'r'
+  {   752,   7,   8,   7,   -1,   -7 },   // 0x73 's'
+  {   759,   5,  10,   5,    0,   -9 },   // 0x74 't'
+  {   766,   8,   8,   9,    0,   -7 },   // 0x75 'u'
+  {   774,   7,   8,   8,    0,   -7 },   // 0x76 'v'
+  {   781,  10,   8,  11,    0,   -7 },   // 0x77 'w'
+  {   791,   9,   8,   8,   -1,   -7 },   // 0x78 'x'
+  {   800,   9,  11,   8,   -1,   -7 },   // 0x79 'y'
+  {   813,   8,   8,   7,   -1,   -7 },   // 0x7A 'z'
+  {   821,   6,  13,   9,    2,  -10 },   // 0x7B '{'
+  {   831,   1,  14,   5,    2,  -10 },   // 0x7C '|'
+  {   833,   7,  13,   9,    0,  -10 },   // 0x7D '}'
+  {   845,   9,   2,  12,    1,   -4 },   // 0x7E '~'
+  {   848,   7,  12,   8,    1,   -9 },   // 0x7F
+  {   859,   7,  12,   8,    1,   -9 },   // 0x80
+  {   870,   7,  12,   8,    1,   -9 },   // 0x81
+  {   881,   7,  12,   8,    1,   -9 },   // 0x82
+  {   892,   7,  12,   8,    1,   -9 },   // 0x83
+  {   903,   7,  12,   8,    1,   -9 },   // 0x84
+  {   914,   7,  12,   8,    1,   -9 },   // 0x85
+  {   925,   7,  12,   8,    1,   -9 },   // 0x86
+  {   936,   7,  12,   8,    1,   -9 },   // 0x87
+  {   947,   7,  12,   8,    1,   -9 },   // 0x88
+  {   958,   7,  12,   8,    1,   -9 },   // 0x89
+  {   969,   7,  12,   8,    1,   -9 },   // 0x8A
+  {   980,   7,  12,   8,    1,   -9 },   // 0x8B
+  {   991,   7,  12,   8,    1,   -9 },   // 0x8C
+  {  1002,   7,  12,   8,    1,   -9 },   // 0x8D
+  {  1013,   7,  12,   8,    1,   -9 },   // 0x8E
+  {  1024,   7,  12,   8,    1,   -9 },   // 0x8F
+  {  1035,   7,  12,   8,    1,   -9 },   // 0x90
+  {  1046,   7,  12,   8,    1,   -9 },   // 0x91
+  {  1057,   7,  12,   8,    1,   -9 },   // 0x92
+  {  1068,   7,  12,   8,    1,   -9 },   // 0x93
+  {  1079,   7,  12,   8,    1,   -9 },   // 0x94
+  {  1090,   7,  12,   8,    1,   -9 },   // 0x95
+  {  1101,   7,  12,   8,    1,   -9 },   // 0x96
+  {  1112,   7,  12,   8,    1,   -9 },   // 0x97
+  {  1123,   7,  12,   8,    1,   -9 },   // 0x98
+  {  1134,   7,  12,   8,    1,   -9 },   // 0x99
+  {  1145,   7,  12,   8,    1,   -9 },   // 0x9A
+  {  1156,   7,  12,   8,    1,   -9 },   // 0x9B
+  {  1167,   7,  12,   8,    1,   -9 },   // 0x9C
+  {  1178,   7,  12,   8,    1,   -9 },   // 0x9D
+  {  1189,   7,  12,   8,    1,   -9 },   // 0x9E
+  {  1200,   7,  12,   8,    1,   -9 },   // 0x9F
+  {  1211,   1,   1,   4,    0,    0 },   // 0xA0
+  {  1212,   3,  10,   6,    1,   -7 },   // 0xA1
+  {  1216,   7,  12,   9,    1,   -9 },   // 0xA2
+  {  1227,   9,  10,   9,    0,   -9 },   // 0xA3
+  {  1239,   8,   8,   9,    1,   -7 },   // 0xA4
+  {  1247,   8,  10,   9,    1,   -9 },   // 0xA5
+  {  1257,   1,  12,   5,    2,   -9 },   // 0xA6
+  {  1259,   6,  11,   7,    1,   -9 },   // 0xA7
+  {  1268,   4,   2,   7,    2,  -10 },   // 0xA8
+  {  1269,  10,  10,  14,    2,   -9 },   // 0xA9
+  {  1282,   5,   8,   7,    1,   -9 },   // 0xAA
+  {  1287,   7,   6,   9,    1,   -6 },   // 0xAB
+  {  1293,   9,   4,  12,    1,   -5 },   // 0xAC
+  {  1298,   4,   1,   5,    0,   -3 },   // 0xAD
+  {  1299,  10,  10,  14,    2,   -9 },   // 0xAE
+  {  1312,   4,   1,   7,    3,   -9 },   // 0xAF
+  {  1313,   4,   4,   7,    1,   -9 },   // 0xB0
+  {  1315,   9,   9,  12,    1,   -8 },   // 0xB1
+  {  1326,   5,   6,   6,    0,   -9 },   // 0xB2
+  {  1330,   5,   6,   6,    0,   -9 },   // 0xB3
+  {  1334,   4,   3,   7,    3,  -11 },   // 0xB4
+  {  1336,   8,  11,   9,    0,   -7 },   // 0xB5
+  {  1347,   6,  11,   9,    1,   -9 },   // 0xB6
+  {  1356,   1,   2,   4,    2,   -5 },   // 0xB7
+  {  1357,   3,   3,   7,    1,    1 },   // 0xB8
+  {  1359,   3,   6,   6,    1,   -9 },   // 0xB9
+  {  1362,   5,   8,   7,    1,   -9 },   // 0xBA
+  {  1367,   7,   6,   9,    1,   -6 },   // 0xBB
+  {  1373,  11,  11,  14,    1,   -9 },   // 0xBC
+  {  1389,  12,  11,  14,    1,   -9 },   // 0xBD
+  {  1406,  12,  11,  14,    0,   -9 },   // 0xBE
+  {  1423,   5,  11,   7,    0,   -7 },   // 0xBF
+  {  1430,   9,  13,  10,   -1,  -12 },   // 0xC0
+  {  1445,   9,  13,  10,   -1,  -12 },   // 0xC1
+  {  1460,   9,  13,  10,   -1,  -12 },   // 0xC2
+  {  1475,   9,  13,  10,   -1,  -12 },   // 0xC3
+  {  1490,   9,  13,  10,   -1,  -12 },   // 0xC4
+  {  1505,  10,  13,  10,   -1,  -12 },   // 0xC5
+  {  1522,  15,  10,  14,   -1,   -9 },   // 0xC6
+  {  1541,   9,  13,  10,    0,   -9 },   // 0xC7
+  {  1556,   8,  13,   9,    0,  -12 },   // 0xC8
+  {  1569,   8,  13,   9,    0,  -12 },   // 0xC9
+  {  1582,   8,  13,   9,    0,  -12 },   // 0xCA
+  {  1595,   8,  13,   9,    0,  -12 },   // 0xCB
+  {  1608,   4,  13,   4,    0,  -12 },   // 0xCC
+  {  1615,   6,  13,   4,    0,  -12 },   // 0xCD
+  {  1625,   5,  13,   4,    0,  -12 },   // 0xCE
+  {  1634,   5,  13,   4,    0,  -12 },   // 0xCF
+  {  1643,  10,  10,  11,    0,   -9 },   // 0xD0
+  {  1656,  11,  13,  11,    0,  -12 },   // 0xD1
+  {  1674,   9,  13,  11,    1,  -12 },   // 0xD2
+  {  1689,   9,  13,  11,    1,  -12 },   // 0xD3
+  {  1704,   9,  13,  11,    1,  -12 },   // 0xD4
+  {  1719,   9,  13,  11,    1,  -12 },   // 0xD5
+  {  1734,   9,  13,  11,    1,  -12 },   // 0xD6
+  {  1749,   8,   8,  12,    2,   -7 },   // 0xD7
+  {  1757,  11,  10,  11,    0,   -9 },   // 0xD8
+  {  1771,   9,  13,  10,    1,  -12 },   // 0xD9
+  {  1786,   9,  13,  10,    1,  -12 },   // 0xDA
+  {  1801,   9,  13,  10,    1,  -12 },   // 0xDB
+  {  1816,   9,  13,  10,    1,  -12 },   // 0xDC
+  {  1831,   9,  13,   9,    1,  -12 },   // 0xDD
+  {  1846,   8,  10,   9,    0,   -9 },   // 0xDE
+  {  1856,   8,  11,   9,    0,  -10 },   // 0xDF
+  {  1867,   7,  12,   8,    0,  -11 },   // 0xE0
+  {  1878,   8,  12,   8,    0,  -11 },   // 0xE1
+  {  1890,   7,  12,   8,    0,  -11 },   // 0xE2
+  {  1901,   8,  11,   8,    0,  -10 },   // 0xE3
+  {  1912,   7,  11,   8,    0,  -10 },   // 0xE4
+  {  1922,   7,  13,   8,    0,  -12 },   // 0xE5
+  {  1934,  13,   8,  14,    0,   -7 },   // 0xE6
+  {  1947,   7,  11,   8,    0,   -7 },   // 0xE7
+  {  1957,   8,  12,   9,    0,  -11 },   // 0xE8
+  {  1969,   8,  12,   9,    0,  -11 },   // 0xE9
+  {  1981,   8,  12,   9,    0,  -11 },   // 0xEA
+  {  1993,   8,  11,   9,    0,  -10 },   // 0xEB
+  {  2004,   3,  12,   4,    0,  -11 },   // 0xEC
+  {  2009,   5,  12,   4,    0,  -11 },   // 0xED
+  {  2017,   4,  12,   4,    0,  -11 },   // 0xEE
+  {  2023,   4,  11,   4,    0,  -10 },   // 0xEF
+  {  2029,   7,  11,   9,    0,  -10 },   // 0xF0
+  {  2039,   8,  11,   9,    0,  -10 },   // 0xF1
+  {  2050,   8,  12,   9,    0,  -11 },   // 0xF2
+  {  2062,   8,  12,   9,    0,  -11 },   // 0xF3
+  {  2074,   8,  12,   9,    0,  -11 },   // 0xF4
+  {  2086,   8,  11,   9,    0,  -10 },   // 0xF5
+  {  2097,   8,  11,   9,    0,  -10 },   // 0xF6
+  {  2108,  10,   7,  12,    1,   -7 },   // 0xF7
+  {  2117,   9,   8,   9,   -1,   -7 },   // 0xF8
+  {  2126,   8,  12,   9,    0,  -11 },   // 0xF9
+  {  2138,   8,  12,   9,    0,  -11 },   // 0xFA
+  {  2150,   8,  12,   9,    0,  -11 },   // 0xFB
+  {  2162,   8,  11,   9,    0,  -10 },   // 0xFC
+  {  2173,   9,  15,   8,   -1,  -11 },   // 0xFD
+  {  2190,   8,  14,   9,   -1,  -10 },   // 0xFE
+  {  2204,   9,  14,   8,   -1,  -10 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique7pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique7pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique7pt8bGlyphs,
+  0x20, 0xFF, 16 };
+
+// Approx. 3795 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique7pt8bMetrics[] PROGMEM = {
+  {   0,   4,   1 },   // 0x20
+  {   1,   6,   4 },   // 0x21
+  {   1,   6,   4 },   // 0x22
+  {   1,  12,  11 },   // 0x23
+  {   1,   9,   9 },   // 0x24
+  {   1,  13,  12 },   // 0x25
+  {   0,  11,  10 },   // 0x26
+  {   1,   4,   2 },   // 0x27
+  {   1,   5,   6 },   // 0x28
+  {  -1,   5,   4 },   // 0x29
+  {   0,   7,   7 },   // 0x2A
+  {   1,  12,  10 },   // 0x2B
+  {   0,   4,   2 },   // 0x2C
+  {   0,   5,   4 },   // 0x2D
+  {   1,   4,   2 },   // 0x2E
+  {  -1,   5,   6 },   // 0x2F
+  {   1,   9,   9 },   // 0x30
+  {   1,   9,   7 },   // 0x31
+  {   0,   9,   8 },   // 0x32
+  {   1,   9,   9 },   // 0x33
+  {   1,   9,   9 },   // 0x34
+  {   1,   9,   9 },   // 0x35
+  {   1,   9,   9 },   // 0x36
+  {   2,   9,   9 },   // 0x37
+  {   1,   9,   9 },   // 0x38
+  {   2,   9,   9 },   // 0x39
+  {   1,   5,   3 },   // 0x3A
+  {   0,   5,   3 },   // 0x3B
+  {   1,  12,  10 },   // 0x3C
+  {   1,  12,  10 },   // 0x3D
+  {   1,  12,  10 },   // 0x3E
+  {   2,   7,   7 },   // 0x3F
+  {   1,  14,  13 },   // 0x40
+  {  -1,  10,   8 },   // 0x41
+  {   0,  10,   8 },   // 0x42
+  {   0,  10,   9 },   // 0x43
+  {   0,  11,  10 },   // 0x44
+  {   0,   9,   8 },   // 0x45
+  {   0,   8,   8 },   // 0x46
+  {   0,  11,  10 },   // 0x47
+  {   0,  11,  11 },   // 0x48
+  {   0,   4,   3 },   // 0x49
+  {  -2,   4,   4 },   // 0x4A
+  {   0,   9,  10 },   // 0x4B
+  {   0,   8,   7 },   // 0x4C
+  {   0,  12,  11 },   // 0x4D
+  {   0,  11,  11 },   // 0x4E
+  {   1,  11,  10 },   // 0x4F
+  {   0,   8,   8 },   // 0x50
+  {   1,  11,  10 },   // 0x51
+  {   0,  10,   8 },   // 0x52
+  {   0,   9,   8 },   // 0x53
+  {   0,   9,   9 },   // 0x54
+  {   1,  10,  10 },   // 0x55
+  {   1,  10,  10 },   // 0x56
+  {   1,  14,  14 },   // 0x57
+  {  -2,  10,   9 },   // 0x58
+  {   1,   9,  10 },   // 0x59
+  {   0,  10,  10 },   // 0x5A
+  {   1,   5,   6 },   // 0x5B
+  {   1,   5,   3 },   // 0x5C
+  {  -1,   5,   4 },   // 0x5D
+  {   1,  12,  10 },   // 0x5E
+  {   0,   7,   7 },   // 0x5F
+  {   2,   7,   5 },   // 0x60
+  {   0,   8,   7 },   // 0x61
+  {   0,   9,   8 },   // 0x62
+  {   0,   8,   7 },   // 0x63
+  {   0,   9,   9 },   // 0x64
+  {   0,   9,   8 },   // 0x65
+  {   0,   4,   5 },   // 0x66
+  {   0,   9,   8 },   // 0x67
+  {   0,   9,   8 },   // 0x68
+  {   0,   3,   3 },   // 0x69
+  {  -3,   3,   2 },   // 0x6A
+  {   0,   8,   8 },   // 0x6B
+  {   0,   3,   3 },   // 0x6C
+  {   0,  13,  12 },   // 0x6D
+  {   0,   9,   8 },   // 0x6E
+  {   0,   9,   8 },   // 0x6F
+  {  -1,   9,   8 },   // 0x70
+  {   0,   9,   8 },   // 0x71
+  {   0,   5,   5 },   // 0x72
+  {  -1,   7,   6 },   // 0x73
+  {   0,   5,   5 },   // 0x74
+  {   0,   9,   8 },   // 0x75
+  {   0,   8,   7 },   // 0x76
+  {   0,  11,  10 },   // 0x77
+  {  -1,   8,   8 },   // 0x78
+  {  -1,   8,   8 },   // 0x79
+  {  -1,   7,   7 },   // 0x7A
+  {   2,   9,   8 },   // 0x7B
+  {   2,   5,   3 },   // 0x7C
+  {   0,   9,   7 },   // 0x7D
+  {   1,  12,  10 },   // 0x7E
+  {   1,   8,   8 },   // 0x7F
+  {   1,   8,   8 },   // 0x80
+  {   1,   8,   8 },   // 0x81
+  {   1,   8,   8 },   // 0x82
+  {   1,   8,   8 },   // 0x83
+  {   1,   8,   8 },   // 0x84
+  {   1,   8,   8 },   // 0x85
+  {   1,   8,   8 },   // 0x86
+  {   1,   8,   8 },   // 0x87
+  {   1,   8,   8 },   // 0x88
+  {   1,   8,   8 },   // 0x89
+  {   1,   8,   8 },   // 0x8A
+  {   1,   8,   8 },   // 0x8B
+  {   1,   8,   8 },   // 0x8C
+  {   1,   8,   8 },   // 0x8D
+  {   1,   8,   8 },   // 0x8E
+  {   1,   8,   8 },   // 0x8F
+  {   1,   8,   8 },   // 0x90
+  {   1,   8,   8 },   // 0x91
+  {   1,   8,   8 },   // 0x92
+  {   1,   8,   8 },   // 0x93
+  {   1,   8,   8 },   // 0x94
+  {   1,   8,   8 },   // 0x95
+  {   1,   8,   8 },   // 0x96
+  {   1,   8,   8 },   // 0x97
+  {   1,   8,   8 },   // 0x98
+  {   1,   8,   8 },   // 0x99
+  {   1,   8,   8 },   // 0x9A
+  {   1,   8,   8 },   // 0x9B
+  {   1,   8,   8 },   // 0x9C
+  {   1,   8,   8 },   // 0x9D
+  {   1,   8,   8 },   // 0x9E
+  {   1,   8,   8 },   // 0x9F
+  {   0,   4,   1 },   // 0xA0
+  {   1,   6,   4 },   // 0xA1
+  {   1,   9,   8 },   // 0xA2
+  {   0,   9,   9 },   // 0xA3
+  {   1,   9,   9 },   // 0xA4
+  {   1,   9,   9 },   // 0xA5
+  {   2,   5,   3 },   // 0xA6
+  {   1,   7,   7 },   // 0xA7
+  {   2,   7,   6 },   // 0xA8
+  {   2,  14,  12 },   // 0xA9
+  {   1,   7,   6 },   // 0xAA
+  {   1,   9,   8 },   // 0xAB
+  {   1,  12,  10 },   // 0xAC
+  {   0,   5,   4 },   // 0xAD
+  {   2,  14,  12 },   // 0xAE
+  {   3,   7,   7 },   // 0xAF
+  {   1,   7,   5 },   // 0xB0
+  {   1,  12,  10 },   // 0xB1
+  {   0,   6,   5 },   // 0xB2
+  {   0,   6,   5 },   // 0xB3
+  {   3,   7,   7 },   // 0xB4
+  {   0,   9,   8 },   // 0xB5
+  {   1,   9,   7 },   // 0xB6
+  {   2,   4,   3 },   // 0xB7
+  {   1,   7,   4 },   // 0xB8
+  {   1,   6,   4 },   // 0xB9
+  {   1,   7,   6 },   // 0xBA
+  {   1,   9,   8 },   // 0xBB
+  {   1,  14,  12 },   // 0xBC
+  {   1,  14,  13 },   // 0xBD
+  {   0,  14,  12 },   // 0xBE
+  {   0,   7,   5 },   // 0xBF
+  {  -1,  10,   8 },   // 0xC0
+  {  -1,  10,   8 },   // 0xC1
+  {  -1,  10,   8 },   // 0xC2
+  {  -1,  10,   8 },   // 0xC3
+  {  -1,  10,   8 },   // 0xC4
+  {  -1,  10,   9 },   // 0xC5
+  {  -1,  14,  14 },   // 0xC6
+  {   0,  10,   9 },   // 0xC7
+  {   0,   9,   8 },   // 0xC8
+  {   0,   9,   8 },   // 0xC9
+  {   0,   9,   8 },   // 0xCA
+  {   0,   9,   8 },   // 0xCB
+  {   0,   4,   4 },   // 0xCC
+  {   0,   4,   6 },   // 0xCD
+  {   0,   4,   5 },   // 0xCE
+  {   0,   4,   5 },   // 0xCF
+  {   0,  11,  10 },   // 0xD0
+  {   0,  11,  11 },   // 0xD1
+  {   1,  11,  10 },   // 0xD2
+  {   1,  11,  10 },   // 0xD3
+  {   1,  11,  10 },   // 0xD4
+  {   1,  11,  10 },   // 0xD5
+  {   1,  11,  10 },   // 0xD6
+  {   2,  12,  10 },   // 0xD7
+  {   0,  11,  11 },   // 0xD8
+  {   1,  10,  10 },   // 0xD9
+  {   1,  10,  10 },   // 0xDA
+  {   1,  10,  10 },   // 0xDB
+  {   1,  10,  10 },   // 0xDC
+  {   1,   9,  10 },   // 0xDD
+  {   0,   9,   8 },   // 0xDE
+  {   0,   9,   8 },   // 0xDF
+  {   0,   8,   7 },   // 0xE0
+  {   0,   8,   8 },   // 0xE1
+  {   0,   8,   7 },   // 0xE2
+  {   0,   8,   8 },   // 0xE3
+  {   0,   8,   7 },   // 0xE4
+  {   0,   8,   7 },   // 0xE5
+  {   0,  14,  13 },   // 0xE6
+  {   0,   8,   7 },   // 0xE7
+  {   0,   9,   8 },   // 0xE8
+  {   0,   9,   8 },   // 0xE9
+  {   0,   9,   8 },   // 0xEA
+  {   0,   9,   8 },   // 0xEB
+  {   0,   4,   3 },   // 0xEC
+  {   0,   4,   5 },   // 0xED
+  {   0,   4,   4 },   // 0xEE
+  {   0,   4,   4 },   // 0xEF
+  {   0,   9,   7 },   // 0xF0
+  {   0,   9,   8 },   // 0xF1
+  {   0,   9,   8 },   // 0xF2
+  {   0,   9,   8 },   // 0xF3
+  {   0,   9,   8 },   // 0xF4
+  {   0,   9,   8 },   // 0xF5
+  {   0,   9,   8 },   // 0xF6
+  {   1,  12,  11 },   // 0xF7
+  {  -1,   9,   8 },   // 0xF8
+  {   0,   9,   8 },   // 0xF9
+  {   0,   9,   8 },   // 0xFA
+  {   0,   9,   8 },   // 0xFB
+  {   0,   9,   8 },   // 0xFC
+  {  -1,   8,   8 },   // 0xFD
+  {  -1,   9,   7 },   // 0xFE
+  {  -1,   8,   8 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique7pt8bWidths = { DejaVuSans_Oblique7pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE7PTLAT1__H
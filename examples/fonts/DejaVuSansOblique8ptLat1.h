@@ -0,0 +1,708 @@
+#ifndef DEJAVUSANSOBLIQUE8PTLAT1__H
+#define DEJAVUSANSOBLIQUE8PTLAT1__H
+const uint8_t DejaVuSans_Oblique8pt8bBitmaps[] PROGMEM = {
+  0x00, 0x24, 0xA4, 0x94, 0x02, 0x40, 0x99, 0x99, 0x0C, 0x81, 0x10, 0x26,
+  0x3F, 0xF1, 0x90, 0x22, 0x04, 0xC7, 0xFE, 0x32, 0x04, 0x40, 0x98, 0x00,
+  0x01, 0x00, 0x80, 0xF8, 0x4A, 0x22, 0x09, 0x03, 0xC0, 0x3C, 0x04, 0x82,
+  0x24, 0x91, 0xF8, 0x10, 0x04, 0x00, 0x38, 0x24, 0x44, 0x84, 0xC8, 0x58,
+  0x89, 0x07, 0x20, 0x04, 0xE0, 0xD1, 0x1A, 0x11, 0x21, 0x22, 0x24, 0x1C,
+  0x0F, 0x02, 0x10, 0x80, 0x10, 0x02, 0x00, 0x60, 0x12, 0x0C, 0x22, 0x82,
+  0x50, 0x33, 0x0A, 0x3E, 0x20, 0xF0, 0x18, 0x88, 0xC4, 0x22, 0x10, 0x84,
+  0x21, 0x0C, 0x20, 0x10, 0xC2, 0x10, 0x84, 0x21, 0x10, 0x8C, 0x44, 0x60,
+  0x10, 0x22, 0x4B, 0xE3, 0x9A, 0xC4, 0x08, 0x08, 0x04, 0x02, 0x01, 0x0F,
+  0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0x56, 0xF0, 0xC0, 0x01, 0x03, 0x02,
+  0x06, 0x04, 0x08, 0x18, 0x10, 0x30, 0x20, 0x60, 0x40, 0xC0, 0x0E, 0x18,
+  0x88, 0x28, 0x14, 0x0C, 0x06, 0x03, 0x02, 0x81, 0x41, 0x91, 0x8F, 0x00,
+  0x0C, 0x68, 0x10, 0x40, 0x81, 0x02, 0x04, 0x18, 0x20, 0x47, 0xF0, 0x1F,
+  0x18, 0xC8, 0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x18, 0x10, 0x10, 0x1F,
+  0xE0, 0x0F, 0x18, 0x40, 0x20, 0x10, 0x10, 0xF0, 0x0C, 0x02, 0x01, 0x00,
+  0xA1, 0x8F, 0x80, 0x01, 0x81, 0x41, 0x21, 0x21, 0x11, 0x09, 0x05, 0x02,
+  0xFF, 0x81, 0x00, 0x80, 0x40, 0x1F, 0x88, 0x08, 0x04, 0x03, 0xE2, 0x18,
+  0x04, 0x02, 0x01, 0x01, 0x21, 0x8F, 0x00, 0x0F, 0x18, 0x48, 0x08, 0x07,
+  0xE6, 0x1A, 0x05, 0x02, 0x81, 0x41, 0x11, 0x87, 0x80, 0xFF, 0x80, 0x80,
+  0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x00, 0x1F,
+  0x10, 0xD0, 0x28, 0x16, 0x11, 0xF1, 0x0D, 0x02, 0x81, 0x40, 0xB0, 0x8F,
+  0x80, 0x3C, 0x62, 0x41, 0x81, 0x81, 0x83, 0xC7, 0x7D, 0x02, 0x02, 0x84,
+  0x78, 0x24, 0x00, 0x24, 0x24, 0x00, 0x12, 0x50, 0x00, 0x40, 0xE1, 0xC1,
+  0xC0, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0x40, 0xFF, 0xC0, 0x00, 0x03,
+  0xFF, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x40, 0xE0, 0xE1, 0xC0, 0x80,
+  0x00, 0x7A, 0x10, 0x42, 0x10, 0x84, 0x10, 0x40, 0x08, 0x20, 0x07, 0xE0,
+  0x30, 0x43, 0x00, 0x89, 0xF9, 0x48, 0xC7, 0x21, 0x19, 0x04, 0x64, 0x11,
+  0x90, 0xCA, 0x67, 0x48, 0xFE, 0x10, 0x00, 0x20, 0xC0, 0x7E, 0x00, 0x01,
+  0x80, 0x50, 0x0A, 0x02, 0x40, 0xC4, 0x10, 0x84, 0x10, 0x82, 0x3F, 0xC8,
+  0x05, 0x00, 0xC0, 0x10, 0x3F, 0x88, 0x12, 0x05, 0x01, 0x40, 0x9F, 0xC4,
+  0x19, 0x02, 0x40, 0xA0, 0x28, 0x13, 0xF8, 0x0F, 0x8C, 0x32, 0x05, 0x00,
+  0x40, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x04, 0x30, 0xF8, 0x3F, 0x84,
+  0x18, 0x80, 0xA0, 0x14, 0x02, 0x80, 0x50, 0x0A, 0x01, 0x40, 0x50, 0x12,
+  0x06, 0x7F, 0x00, 0x3F, 0xC8, 0x02, 0x01, 0x00, 0x40, 0x1F, 0xE4, 0x01,
+  0x00, 0x40, 0x20, 0x08, 0x03, 0xFC, 0x3F, 0x90, 0x08, 0x08, 0x04, 0x03,
+  0xF1, 0x00, 0x80, 0x40, 0x40, 0x20, 0x10, 0x00, 0x0F, 0xC2, 0x0C, 0x80,
+  0x20, 0x04, 0x01, 0x00, 0x20, 0xFC, 0x01, 0x80, 0x50, 0x09, 0x03, 0x1F,
+  0xC0, 0x20, 0x12, 0x01, 0x20, 0x14, 0x02, 0x40, 0x27, 0xFE, 0x40, 0x24,
+  0x02, 0x40, 0x28, 0x04, 0x80, 0x48, 0x04, 0x24, 0xA4, 0x92, 0x52, 0x40,
+  0x02, 0x04, 0x08, 0x20, 0x40, 0x81, 0x02, 0x08, 0x10, 0x20, 0x41, 0x02,
+  0x38, 0x00, 0x20, 0x44, 0x10, 0x84, 0x23, 0x04, 0x80, 0xA0, 0x1C, 0x02,
+  0x40, 0x44, 0x10, 0x42, 0x04, 0x40, 0x40, 0x20, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xFF, 0x30, 0x19, 0x80, 0xCA, 0x0A,
+  0x90, 0xA4, 0x85, 0x24, 0x49, 0x22, 0x49, 0x22, 0x46, 0x14, 0x31, 0x20,
+  0x09, 0x00, 0x40, 0x30, 0x12, 0x81, 0x28, 0x14, 0x82, 0x44, 0x24, 0x42,
+  0x42, 0x24, 0x22, 0x41, 0x28, 0x14, 0x81, 0x48, 0x0C, 0x0F, 0x82, 0x08,
+  0x80, 0xA0, 0x14, 0x03, 0x00, 0x60, 0x0C, 0x02, 0x80, 0x50, 0x11, 0x04,
+  0x1F, 0x00, 0x3F, 0x10, 0xC8, 0x28, 0x14, 0x0A, 0x09, 0xF8, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x00, 0x0F, 0x82, 0x08, 0x80, 0xA0, 0x14, 0x03, 0x00,
+  0x60, 0x0C, 0x02, 0x80, 0x50, 0x11, 0x06, 0x1F, 0x00, 0x20, 0x06, 0x00,
+  0x3F, 0x10, 0xC8, 0x28, 0x14, 0x0A, 0x09, 0xF8, 0x82, 0x41, 0x40, 0xA0,
+  0x30, 0x10, 0x1F, 0x10, 0xD0, 0x28, 0x04, 0x01, 0x80, 0x38, 0x02, 0x01,
+  0x40, 0xB0, 0x8F, 0x80, 0xFF, 0x84, 0x02, 0x01, 0x01, 0x00, 0x80, 0x40,
+  0x20, 0x10, 0x10, 0x08, 0x04, 0x00, 0x40, 0x50, 0x14, 0x09, 0x02, 0x80,
+  0xA0, 0x28, 0x0A, 0x04, 0x81, 0x20, 0x4C, 0x21, 0xF0, 0x80, 0x30, 0x0A,
+  0x01, 0x20, 0x44, 0x10, 0x82, 0x10, 0x82, 0x10, 0x24, 0x05, 0x00, 0xA0,
+  0x18, 0x00, 0x81, 0x03, 0x02, 0x0A, 0x0C, 0x14, 0x18, 0x48, 0x50, 0x90,
+  0xA1, 0x22, 0x44, 0x44, 0x88, 0x50, 0xA0, 0xA1, 0x41, 0x83, 0x03, 0x06,
+  0x00, 0x10, 0x10, 0x82, 0x08, 0x40, 0x48, 0x05, 0x00, 0x20, 0x06, 0x00,
+  0x90, 0x11, 0x02, 0x08, 0x40, 0x88, 0x04, 0x80, 0x50, 0x24, 0x10, 0x88,
+  0x24, 0x06, 0x01, 0x00, 0x40, 0x10, 0x08, 0x02, 0x00, 0x80, 0x3F, 0xF0,
+  0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10, 0x02,
+  0x00, 0x40, 0x0F, 0xFC, 0x1C, 0x42, 0x08, 0x20, 0x82, 0x10, 0x41, 0x04,
+  0x10, 0x83, 0x80, 0x9B, 0x24, 0x92, 0x6C, 0x92, 0x3C, 0x10, 0x82, 0x08,
+  0x20, 0x84, 0x10, 0x41, 0x04, 0x23, 0x80, 0x0C, 0x07, 0x82, 0x11, 0x02,
+  0xFF, 0xC9, 0x80, 0x3E, 0x41, 0x01, 0x3F, 0x41, 0x83, 0x83, 0x86, 0x7A,
+  0x20, 0x10, 0x08, 0x09, 0xE7, 0x1B, 0x05, 0x02, 0x81, 0x40, 0xE0, 0xB0,
+  0x97, 0x80, 0x1E, 0x21, 0x40, 0x80, 0x80, 0x80, 0x80, 0xC4, 0x7C, 0x00,
+  0x40, 0x10, 0x04, 0x7A, 0x21, 0x90, 0x28, 0x0A, 0x02, 0x81, 0xA0, 0x4C,
+  0x71, 0xF4, 0x1E, 0x23, 0x41, 0xC1, 0xFF, 0x80, 0x80, 0xC2, 0x7C, 0x1E,
+  0x41, 0x07, 0xE4, 0x08, 0x10, 0x60, 0x81, 0x02, 0x04, 0x00, 0x1E, 0x90,
+  0xD0, 0x50, 0x28, 0x14, 0x0A, 0x0D, 0x8C, 0x7A, 0x01, 0x21, 0x1F, 0x00,
+  0x20, 0x10, 0x08, 0x09, 0xE7, 0x0B, 0x05, 0x02, 0x81, 0x40, 0xC0, 0xA0,
+  0x50, 0x20, 0x24, 0x24, 0x96, 0x92, 0x40, 0x08, 0x40, 0x21, 0x08, 0x44,
+  0x21, 0x08, 0x42, 0x13, 0x00, 0x20, 0x10, 0x08, 0x08, 0x24, 0x22, 0x61,
+  0x40, 0xC0, 0x50, 0x44, 0x21, 0x10, 0x40, 0x24, 0xA4, 0x92, 0x52, 0x40,
+  0x5E, 0x79, 0x87, 0x14, 0x10, 0x50, 0x41, 0xC1, 0x06, 0x04, 0x18, 0x20,
+  0xA0, 0x82, 0x82, 0x08, 0x5F, 0x30, 0x50, 0x28, 0x1C, 0x0C, 0x06, 0x05,
+  0x02, 0x81, 0x00, 0x1E, 0x10, 0xD0, 0x30, 0x18, 0x0C, 0x06, 0x04, 0x84,
+  0x3C, 0x00, 0x2F, 0x8E, 0x32, 0x05, 0x81, 0x40, 0x50, 0x14, 0x09, 0x84,
+  0x5E, 0x20, 0x08, 0x02, 0x00, 0x1E, 0x90, 0xD0, 0x70, 0x28, 0x14, 0x0A,
+  0x0D, 0x8E, 0x79, 0x01, 0x00, 0x80, 0x40, 0x5D, 0x84, 0x10, 0xC2, 0x08,
+  0x20, 0x80, 0x1E, 0x61, 0x40, 0x60, 0x38, 0x06, 0x02, 0x86, 0x78, 0x20,
+  0x8F, 0x90, 0x41, 0x08, 0x20, 0x82, 0x07, 0x00, 0x40, 0xA0, 0x50, 0x30,
+  0x18, 0x1C, 0x0A, 0x05, 0x06, 0x7D, 0x00, 0x80, 0xC0, 0xA0, 0x90, 0x44,
+  0x42, 0x41, 0x20, 0xA0, 0x60, 0x00, 0x82, 0x18, 0x61, 0x8A, 0x28, 0xA2,
+  0x92, 0x49, 0x24, 0xA2, 0x8A, 0x28, 0xC3, 0x00, 0x10, 0x84, 0x40, 0xB0,
+  0x38, 0x0C, 0x07, 0x03, 0x21, 0x84, 0xC1, 0x00, 0x20, 0x48, 0x22, 0x08,
+  0x44, 0x11, 0x04, 0x81, 0x40, 0x30, 0x08, 0x02, 0x01, 0x03, 0x80, 0x1F,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x07, 0x08,
+  0x08, 0x08, 0x08, 0x10, 0x10, 0xE0, 0x30, 0x10, 0x20, 0x20, 0x20, 0x20,
+  0x18, 0xFF, 0xFF, 0x18, 0x04, 0x04, 0x04, 0x04, 0x08, 0x0C, 0x06, 0x08,
+  0x08, 0x18, 0x10, 0x10, 0x10, 0xE0, 0x78, 0x61, 0xE0, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xFF, 0x00, 0x24, 0x04, 0x92, 0x5A, 0x40, 0x04, 0x08, 0x7B,
+  0x54, 0x91, 0x22, 0x48, 0x91, 0xA9, 0xE0, 0x82, 0x00, 0x07, 0xC3, 0x00,
+  0x80, 0x40, 0x10, 0x04, 0x07, 0xF0, 0x40, 0x20, 0x08, 0x02, 0x03, 0xFC,
+  0x80, 0xBF, 0x98, 0xC8, 0x24, 0x12, 0x09, 0x8C, 0xFE, 0x80, 0x80, 0x40,
+  0xA0, 0x90, 0x44, 0x42, 0x47, 0x38, 0x60, 0x30, 0xFF, 0x08, 0x08, 0x04,
+  0x00, 0xFC, 0xFC, 0x3D, 0x04, 0x1C, 0x7A, 0x38, 0x61, 0xC5, 0xE1, 0x82,
+  0x0B, 0xC0, 0xDE, 0xC0, 0x0F, 0x03, 0x0C, 0x4F, 0x24, 0x82, 0x90, 0x19,
+  0x01, 0x90, 0x19, 0x01, 0x48, 0x24, 0xF2, 0x30, 0xC0, 0xF0, 0x78, 0x17,
+  0xE1, 0x8F, 0xE0, 0x3E, 0x12, 0x6D, 0xB4, 0x84, 0x8D, 0x89, 0x00, 0xFF,
+  0xC0, 0x10, 0x04, 0x01, 0x00, 0x40, 0xF0, 0x0F, 0x03, 0x0C, 0x4F, 0x24,
+  0x8A, 0x88, 0x98, 0xF1, 0x89, 0x18, 0x99, 0x48, 0xA4, 0x8E, 0x30, 0xC0,
+  0xF0, 0xF8, 0x74, 0x63, 0x17, 0x00, 0x08, 0x04, 0x02, 0x1F, 0xF0, 0x80,
+  0x40, 0x20, 0x00, 0x00, 0x7F, 0xC0, 0x78, 0x10, 0x42, 0x31, 0x0F, 0x80,
+  0x38, 0x10, 0x4E, 0x04, 0x1F, 0x80, 0x36, 0xC0, 0x20, 0x90, 0x48, 0x28,
+  0x14, 0x12, 0x09, 0x04, 0x86, 0x7F, 0xC0, 0x20, 0x10, 0x00, 0x3F, 0x79,
+  0xF9, 0xF9, 0xF3, 0xF2, 0x72, 0x12, 0x12, 0x32, 0x32, 0x24, 0x24, 0x24,
+  0xC0, 0x11, 0xE0, 0x70, 0x84, 0x42, 0x13, 0xE0, 0x39, 0x18, 0x61, 0x89,
+  0xC0, 0x3E, 0x48, 0xD8, 0x90, 0x96, 0xDB, 0x24, 0x00, 0x70, 0x11, 0x02,
+  0x10, 0x42, 0x08, 0x21, 0x02, 0x21, 0xFA, 0x30, 0x45, 0x08, 0x91, 0x12,
+  0x21, 0xF4, 0x02, 0x70, 0x10, 0x40, 0x81, 0x04, 0x08, 0x20, 0x21, 0x00,
+  0x89, 0xEF, 0xA0, 0x41, 0x01, 0x08, 0x08, 0x40, 0xC2, 0x04, 0x10, 0x3E,
+  0x38, 0x08, 0x20, 0x81, 0x08, 0x70, 0x80, 0x48, 0x02, 0x87, 0xE4, 0x60,
+  0x45, 0x04, 0x48, 0x44, 0x84, 0x3E, 0x40, 0x20, 0x02, 0x04, 0x00, 0x20,
+  0x41, 0x04, 0x10, 0xC1, 0x02, 0x13, 0xC0, 0x01, 0x00, 0x10, 0x00, 0x00,
+  0xC0, 0x28, 0x05, 0x01, 0x20, 0x62, 0x08, 0x42, 0x08, 0x41, 0x1F, 0xE4,
+  0x02, 0x80, 0x60, 0x08, 0x00, 0x40, 0x10, 0x00, 0x00, 0xC0, 0x28, 0x05,
+  0x01, 0x20, 0x62, 0x08, 0x42, 0x08, 0x41, 0x1F, 0xE4, 0x02, 0x80, 0x60,
+  0x08, 0x01, 0x80, 0x48, 0x00, 0x00, 0xC0, 0x28, 0x05, 0x01, 0x20, 0x62,
+  0x08, 0x42, 0x08, 0x41, 0x1F, 0xE4, 0x02, 0x80, 0x60, 0x08, 0x01, 0x90,
+  0x26, 0x00, 0x00, 0x18, 0x02, 0x80, 0x28, 0x04, 0x80, 0xC4, 0x08, 0x41,
+  0x04, 0x10, 0x43, 0xFC, 0x40, 0x24, 0x02, 0x80, 0x20, 0x06, 0xC0, 0xD8,
+  0x00, 0x00, 0xC0, 0x28, 0x05, 0x01, 0x20, 0x62, 0x08, 0x42, 0x08, 0x41,
+  0x1F, 0xE4, 0x02, 0x80, 0x60, 0x08, 0x01, 0x80, 0x48, 0x09, 0x00, 0xC0,
+  0x28, 0x05, 0x01, 0x20, 0x22, 0x08, 0x42, 0x08, 0x41, 0x1F, 0xE2, 0x02,
+  0x80, 0x60, 0x08, 0x01, 0xFF, 0x80, 0xA0, 0x00, 0x90, 0x00, 0x88, 0x00,
+  0x44, 0x00, 0x43, 0xF8, 0x42, 0x00, 0x21, 0x00, 0x3F, 0x80, 0x20, 0x40,
+  0x10, 0x20, 0x10, 0x3F, 0xC0, 0x0F, 0x8C, 0x32, 0x05, 0x00, 0x40, 0x20,
+  0x08, 0x02, 0x00, 0x80, 0x20, 0x04, 0x30, 0xF8, 0x04, 0x01, 0x03, 0x80,
+  0x04, 0x00, 0x80, 0x00, 0xFF, 0x20, 0x08, 0x04, 0x01, 0x00, 0x7F, 0x90,
+  0x04, 0x01, 0x00, 0x80, 0x20, 0x0F, 0xF0, 0x01, 0x00, 0x80, 0x00, 0xFF,
+  0x20, 0x08, 0x04, 0x01, 0x00, 0x7F, 0x90, 0x04, 0x01, 0x00, 0x80, 0x20,
+  0x0F, 0xF0, 0x06, 0x02, 0x40, 0x00, 0xFF, 0x20, 0x08, 0x04, 0x01, 0x00,
+  0x7F, 0x90, 0x04, 0x01, 0x00, 0x80, 0x20, 0x0F, 0xF0, 0x1B, 0x06, 0xC0,
+  0x00, 0xFF, 0x20, 0x08, 0x04, 0x01, 0x00, 0x7F, 0x90, 0x04, 0x01, 0x00,
+  0x80, 0x20, 0x0F, 0xF0, 0x20, 0x80, 0x42, 0x11, 0x08, 0x42, 0x10, 0x88,
+  0x42, 0x00, 0x08, 0x40, 0x08, 0x20, 0x84, 0x10, 0x41, 0x04, 0x10, 0x82,
+  0x08, 0x00, 0x32, 0x40, 0x42, 0x11, 0x08, 0x42, 0x10, 0x88, 0x42, 0x00,
+  0xDE, 0xC0, 0x42, 0x11, 0x08, 0x42, 0x10, 0x88, 0x42, 0x00, 0x3F, 0x84,
+  0x18, 0x80, 0xA0, 0x14, 0x03, 0xF0, 0x50, 0x0A, 0x01, 0x40, 0x50, 0x12,
+  0x04, 0x7F, 0x00, 0x03, 0x20, 0x4C, 0x00, 0x03, 0x01, 0x28, 0x12, 0x81,
+  0x48, 0x24, 0x42, 0x44, 0x24, 0x22, 0x42, 0x24, 0x12, 0x81, 0x48, 0x14,
+  0x80, 0xC0, 0x02, 0x00, 0x20, 0x00, 0x07, 0xC1, 0x04, 0x40, 0x50, 0x0A,
+  0x01, 0x80, 0x30, 0x06, 0x01, 0x40, 0x28, 0x08, 0x82, 0x0F, 0x80, 0x00,
+  0x80, 0x20, 0x00, 0x07, 0xC1, 0x04, 0x40, 0x50, 0x0A, 0x01, 0x80, 0x30,
+  0x06, 0x01, 0x40, 0x28, 0x08, 0x82, 0x0F, 0x80, 0x03, 0x00, 0x90, 0x00,
+  0x07, 0xC1, 0x04, 0x40, 0x50, 0x0A, 0x01, 0x80, 0x30, 0x06, 0x01, 0x40,
+  0x28, 0x08, 0x82, 0x0F, 0x80, 0x03, 0x20, 0x98, 0x00, 0x07, 0xC1, 0x04,
+  0x40, 0x50, 0x0A, 0x01, 0x80, 0x30, 0x06, 0x01, 0x40, 0x28, 0x08, 0x82,
+  0x0F, 0x80, 0x0D, 0x81, 0xB0, 0x00, 0x07, 0xC1, 0x04, 0x40, 0x50, 0x0A,
+  0x01, 0x80, 0x30, 0x06, 0x01, 0x40, 0x28, 0x08, 0x82, 0x0F, 0x80, 0x80,
+  0xA0, 0x88, 0x82, 0x80, 0x80, 0xA0, 0x88, 0x82, 0x80, 0x80, 0x07, 0xC8,
+  0x41, 0x84, 0x0C, 0x40, 0xA2, 0x19, 0x21, 0x09, 0x10, 0x49, 0x04, 0x50,
+  0x23, 0x02, 0x18, 0x21, 0x3E, 0x00, 0x04, 0x00, 0x80, 0x01, 0x01, 0x40,
+  0x50, 0x24, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x12, 0x04, 0x81, 0x30, 0x87,
+  0xC0, 0x01, 0x00, 0x80, 0x01, 0x01, 0x40, 0x50, 0x24, 0x0A, 0x02, 0x80,
+  0xA0, 0x28, 0x12, 0x04, 0x81, 0x30, 0x87, 0xC0, 0x06, 0x02, 0x40, 0x01,
+  0x01, 0x40, 0x50, 0x24, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x12, 0x04, 0x81,
+  0x30, 0x87, 0xC0, 0x1B, 0x06, 0xC0, 0x01, 0x01, 0x40, 0x50, 0x24, 0x0A,
+  0x02, 0x80, 0xA0, 0x28, 0x12, 0x04, 0x81, 0x30, 0x87, 0xC0, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x40, 0x90, 0x42, 0x20, 0x90, 0x18, 0x04, 0x01, 0x00,
+  0x40, 0x20, 0x08, 0x02, 0x00, 0x20, 0x10, 0x0F, 0xC8, 0x34, 0x0A, 0x05,
+  0x02, 0x82, 0x7E, 0x40, 0x20, 0x10, 0x00, 0x0F, 0x08, 0x48, 0x24, 0x72,
+  0x43, 0x21, 0x10, 0x84, 0x41, 0x20, 0x60, 0x73, 0xC0, 0x18, 0x08, 0x0C,
+  0x00, 0x3E, 0x41, 0x01, 0x3F, 0x41, 0x83, 0x83, 0x86, 0x7A, 0x03, 0x06,
+  0x0C, 0x00, 0x3E, 0x41, 0x01, 0x3F, 0x41, 0x83, 0x83, 0x86, 0x7A, 0x06,
+  0x0E, 0x19, 0x00, 0x3E, 0x41, 0x01, 0x3F, 0x41, 0x83, 0x83, 0x86, 0x7A,
+  0x0C, 0x89, 0x80, 0x07, 0xC4, 0x10, 0x08, 0xFC, 0x82, 0x83, 0x41, 0xA1,
+  0x8F, 0x40, 0x1B, 0x1B, 0x00, 0x3E, 0x41, 0x01, 0x3F, 0x41, 0x83, 0x83,
+  0x86, 0x7A, 0x0C, 0x12, 0x12, 0x0C, 0x00, 0x3E, 0x41, 0x01, 0x3F, 0x41,
+  0x83, 0x83, 0x86, 0x7A, 0x3E, 0x7C, 0x83, 0x8C, 0x06, 0x09, 0xF8, 0x14,
+  0x1F, 0xF0, 0x20, 0x20, 0xC0, 0x43, 0xC2, 0x78, 0xF8, 0x1E, 0x21, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0xC4, 0x7C, 0x08, 0x08, 0x70, 0x18, 0x08, 0x0C,
+  0x00, 0x1E, 0x23, 0x41, 0xC1, 0xFF, 0x80, 0x80, 0xC2, 0x7C, 0x03, 0x06,
+  0x0C, 0x00, 0x1E, 0x23, 0x41, 0xC1, 0xFF, 0x80, 0x80, 0xC2, 0x7C, 0x06,
+  0x0E, 0x19, 0x00, 0x1E, 0x23, 0x41, 0xC1, 0xFF, 0x80, 0x80, 0xC2, 0x7C,
+  0x1B, 0x1B, 0x00, 0x1E, 0x23, 0x41, 0xC1, 0xFF, 0x80, 0x80, 0xC2, 0x7C,
+  0xC9, 0x82, 0x52, 0x49, 0x48, 0x19, 0x98, 0x02, 0x11, 0x08, 0x42, 0x11,
+  0x08, 0x00, 0x33, 0xB2, 0x02, 0x11, 0x08, 0x42, 0x11, 0x08, 0x00, 0xDE,
+  0xC0, 0x42, 0x21, 0x08, 0x42, 0x21, 0x00, 0x0B, 0x3C, 0x02, 0x1F, 0x21,
+  0x41, 0x81, 0x81, 0x81, 0x82, 0xC6, 0x78, 0x0C, 0x89, 0x80, 0x0B, 0xE6,
+  0x0A, 0x05, 0x03, 0x81, 0x80, 0xC0, 0xA0, 0x50, 0x20, 0x18, 0x04, 0x03,
+  0x00, 0x01, 0xE1, 0x0D, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x48, 0x43, 0xC0,
+  0x03, 0x03, 0x03, 0x00, 0x01, 0xE1, 0x0D, 0x03, 0x01, 0x80, 0xC0, 0x60,
+  0x48, 0x43, 0xC0, 0x06, 0x07, 0x06, 0x40, 0x01, 0xE1, 0x0D, 0x03, 0x01,
+  0x80, 0xC0, 0x60, 0x48, 0x43, 0xC0, 0x0C, 0x89, 0x80, 0x03, 0xC2, 0x1A,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x90, 0x87, 0x80, 0x1B, 0x0D, 0x80, 0x03,
+  0xC2, 0x1A, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x90, 0x87, 0x80, 0x0C, 0x03,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0x00, 0xC0, 0x0F, 0x44, 0x62, 0x19, 0x0A,
+  0x4C, 0x94, 0x26, 0x11, 0x88, 0xBC, 0x00, 0x18, 0x04, 0x03, 0x00, 0x04,
+  0x0A, 0x05, 0x03, 0x01, 0x81, 0xC0, 0xA0, 0x50, 0x67, 0xD0, 0x03, 0x03,
+  0x03, 0x00, 0x04, 0x0A, 0x05, 0x03, 0x01, 0x81, 0xC0, 0xA0, 0x50, 0x67,
+  0xD0, 0x06, 0x07, 0x06, 0x40, 0x04, 0x0A, 0x05, 0x03, 0x01, 0x81, 0xC0,
+  0xA0, 0x50, 0x67, 0xD0, 0x1B, 0x0D, 0x80, 0x08, 0x14, 0x0A, 0x06, 0x03,
+  0x03, 0x81, 0x40, 0xA0, 0xCF, 0xA0, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x20,
+  0x48, 0x22, 0x08, 0x44, 0x11, 0x04, 0x81, 0x40, 0x30, 0x08, 0x02, 0x01,
+  0x03, 0x80, 0x10, 0x08, 0x0C, 0x05, 0xE3, 0x19, 0x04, 0x82, 0xC1, 0x40,
+  0xA0, 0x98, 0xCB, 0x8C, 0x04, 0x02, 0x00, 0x0D, 0x83, 0x60, 0x00, 0x81,
+  0x20, 0x88, 0x21, 0x10, 0x44, 0x12, 0x05, 0x00, 0xC0, 0x20, 0x08, 0x04,
+  0x0E, 0x00 };
+
+const GFXglyph DejaVuSans_Oblique8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   3,  12,   6,    1,  -11 },   // 0x21 '!'
+  {     6,   4,   4,   7,    1,  -11 },   // 0x22 '"'
+  {     8,  11,  11,  13,    1,  -10 },   // 0x23 '#'
+  {    24,  10,  14,  10,    0,  -11 },   // 0x24 '$'
+  {    42,  12,  12,  15,    1,  -11 },   // 0x25 '%'
+  {    60,  11,  12,  12,    0,  -11 },   // 0x26 '&'
+  {    77,   1,   4,   4,    1,  -11 },   // 0x27 '''
+  {    78,   5,  14,   6,    1,  -11 },   // 0x28 '('
+  {    87,   5,  14,   6,   -1,  -11 },   // 0x29 ')'
+  {    96,   7,   8,   8,    1,  -11 },   // 0x2A '*'
+  {   103,   9,   9,  13,    2,   -8 },   // 0x2B '+'
+  {   114,   2,   4,   5,    0,   -1 },   // 0x2C ','
+  {   115,   4,   1,   6,    1,   -4 },   // 0x2D '-'
+  {   116,   1,   2,   5,    1,   -1 },   // 0x2E '.'
+  {   117,   8,  13,   5,   -1,  -11 },   // 0x2F '/'
+  {   130,   9,  12,  10,    1,  -11 },   // 0x30 '0'
+  {   144,   7,  12,  10,    1,  -11 },   // 0x31 '1'
+  {   155,   9,  12,  10,    0,  -11 },   // 0x32 '2'
+  {   169,   9,  12,  10,    1,  -11 },   // 0x33 '3'
+  {   183,   9,  12,  10,    1,  -11 },   // 0x34 '4'
+  {   197,   9,  12,  10,    1,  -11 },   // 0x35 '5'
+  {   211,   9,  12,  10,    1,  -11 },   // 0x36 '6'
+  {   225,   9,  12,  10,    2,  -11 },   // 0x37 '7'
+  {   239,   9,  12,  10,    1,  -11 },   // 0x38 '8'
+  {   253,   8,  12,  10,    2,  -11 },   // 0x39 '9'
+  {   265,   3,   8,   5,    1,   -7 },   // 0x3A ':'
+  {   268,   3,  10,   5,    0,   -7 },   // 0x3B ';'
+  {   272,  10,   9,  13,    2,   -8 },   // 0x3C '<'
+  {   284,  10,   4,  13,    2,   -6 },   // 0x3D '='
+  {   289,  10,   9,  13,    2,   -8 },   // 0x3E '>'
+  {   301,   6,  12,   9,    2,  -11 },   // 0x3F '?'
+  {   310,  14,  14,  16,    1,  -10 },   // 0x40 '@'
+  {   335,  11,  12,  11,   -1,  -11 },   // 0x41 'A'
+  {   352,  10,  12,  11,    0,  -11 },   // 0x42 'B'
+  {   367,  10,  12,  11,    0,  -11 },   // 0x43 'C'
+  {   382,  11,  12,  12,    0,  -11 },   // 0x44 'D'
+  {   399,  10,  12,  10,    0,  -11 },   // 0x45 'E'
+  {   414,   9,  12,   9,    0,  -11 },   // 0x46 'F'
+  {   428,  11,  12,  12,    0,  -11 },   // 0x47 'G'
+  {   445,  12,  12,  12,    0,  -11 },   // 0x48 'H'
+  {   463,   3,  12,   5,    0,  -11 },   // 0x49 'I'
+  {   468,   7,  15,   5,   -3,  -11 },   // 0x4A 'J'
+  {   482,  11,  12,  11,    0,  -11 },   // 0x4B 'K'
+  {   499,   8,  12,   9,    0,  -11 },   // 0x4C 'L'
+  {   511,  13,  12,  14,    0,  -11 },   // 0x4D 'M'
+  {   531,  12,  12,  12,    0,  -11 },   // 0x4E 'N'
+  {   549,  11,  12,  13,    1,  -11 },   // 0x4F 'O'
+  {   566,   9,  12,  10,    0,  -11 },   // 0x50 'P'
+  {   580,  11,  14,  13,    1,  -11 },   // 0x51 'Q'
+  {   600,   9,  12,  11,    0,  -11 },   // 0x52 'R'
+  {   614,   9,  12,  10,    1,  -11 },   // 0x53 'S'
+  {   628,   9,  12,  10,    1,  -11 },   // 0x54 'T'
+  {   642,  10,  12,  12,    1,  -11 },   // 0x55 'U'
+  {   657,  11,  12,  11,    1,  -11 },   // 0x56 'V'
+  {   674,  15,  12,  16,    2,  -11 },   // 0x57 'W'
+  {   697,  12,  12,  11,   -1,  -11 },   // 0x58 'X'
+  {   715,  10,  12,  10,    1,  -11 },   // 0x59 'Y'
+  {   730,  12,  12,  11,    0,  -11 },   // 0x5A 'Z'
+  {   748,   6,  14,   6,    1,  -11 },   // 0x5B '['
+  {   759,   3,  13,   5,    1,  -11 },   // 0x5C '\'
+  {   764,   6,  14,   6,    0,  -11 },   // 0x5D ']'
+  {   775,  10,   4,  13,    2,  -11 },   // 0x5E '^'
+  {   780,   8,   1,   8,    0,    4 },   // 0x5F '_'
+  {   781,   3,   3,   8,    2,  -12 },   // 0x60 '`'
+  {   783,   8,   9,   9,    0,   -8 },   // 0x61 'a'
+  {   792,   9,  12,  10,    0,  -11 },   // 0x62 'b'
+  {   806,   8,   9,   9,    0,   -8 },   // 0x63 'c'
+  {   815,  10,  12,  10,    0,  -11 },   // 0x64 'd'
+  {   830,   8,   9,   9,    0,   -8 },   // 0x65 'e'
+  {   839,   7,  12,   6,    0,  -11 },   // 0x66 'f'
+  {   850,   9,  12,  10,    0,   -8 },   // 0x67 'g'
+  {   864,   9,  12,  10,    0,  -11 },   // 0x68 'h'
+  {   878,   3,  12,   3,    0,  -11 },   // 0x69 'i'
+  {   883,   5,  15,   3,   -3,  -11 },   // 0x6A 'j'
+  {   893,   9,  12,   9,    0,  -11 },   // 0x6B 'k'
+  {   907,   3,  12,   3,    0,  -11 },   // 0x6C 'l'
+  {   912,  14,   9,  15,    0,   -8 },   // 0x6D 'm'
+  {   928,   9,   9,  10,    0,   -8 },   // 0x6E 'n'
+  {   939,   9,   9,  10,    0,   -8 },   // 0x6F 'o'
+  {   950,  10,  12,  10,   -1,   -8 },   // 0x70 'p'
+  {   965,   9,  12,  10,    0,   -8 },   // 0x71 'q'
+  {   979,   6,   9,   7,    0,   -8 },   // 0x72 'r'
+  {   986,   8,   9,   8,    0,   -8 },   // 0x73 's'
+  {   995,   6,  11,   6,    1,  -10 },   // 0x74 't'
+  {  1004,   9,   9,  10,    0,   -8 },   // 0x75 'u'
+  {  1015,   9,   9,   9,    0,   -8 },   // 0x76 'v'
+  {  1026,  12,   9,  13,    1,   -8 },   // 0x77 'w'
+  {  1040,  10,   9,   9,   -1,   -8 },   // 0x78 'x'
+  {  1052,  10,  12,   9,   -1,   -8 },   // 0x79 'y'
+  {  1067,   9,   9,   8,   -1,   -8 },   // 0x7A 'z'
+  {  1078,   8,  15,  10,    2,  -11 },   // 0x7B '{'
+  {  1093,   1,  16,   5,    2,  -11 },   // 0x7C '|'
+  {  1095,   8,  15,  10,    0,  -11 },   // 0x7D '}'
+  {  1110,  10,   2,  13,    2,   -5 },   // 0x7E '~'
+  {  1113,   8,  14,  10,    1,  -10 },   // 0x7F
+  {  1127,   8,  14,  10,    1,  -10 },   // 0x80
+  {  1141,   8,  14,  10,    1,  -10 },   // 0x81
+  {  1155,   8,  14,  10,    1,  -10 },   // 0x82
+  {  1169,   8,  14,  10,    1,  -10 },   // 0x83
+  {  1183,   8,  14,  10,    1,  -10 },   // 0x84
+  {  1197,   8,  14,  10,    1,  -10 },   // 0x85
+  {  1211,   8,  14,  10,    1,  -10 },   // 0x86
+  {  1225,   8,  14,  10,    1,  -10 },   // 0x87
+  {  1239,   8,  14,  10,    1,  -10 },   // 0x88
+  {  1253,   8,  14,  10,    1,  -10 },   // 0x89
+  {  1267,   8,  14,  10,    1,  -10 },   // 0x8A
+  {  1281,   8,  14,  10,    1,  -10 },   // 0x8B
+  {  1295,   8,  14,  10,    1,  -10 },   // 0x8C
+  {  1309,   8,  14,  10,    1,  -10 },   // 0x8D
+  {  1323,   8,  14,  10,    1,  -10 },   // 0x8E
+  {  1337,   8,  14,  10,    1,  -10 },   // 0x8F
+  {  1351,   8,  14,  10,    1,  -10 },   // 0x90
+  {  1365,   8,  14,  10,    1,  -10 },   // 0x91
+  {  1379,   8,  14,  10,    1,  -10 },   // 0x92
+  {  1393,   8,  14,  10,    1,  -10 },   // 0x93
+  {  1407,   8,  14,  10,    1,  -10 },   // 0x94
+  {  1421,   8,  14,  10,    1,  -10 },   // 0x95
+  {  1435,   8,  14,  10,    1,  -10 },   // 0x96
+  {  1449,   8,  14,  10,    1,  -10 },   // 0x97
+  {  1463,   8,  14,  10,    1,  -10 },   // 0x98
+  {  1477,   8,  14,  10,    1,  -10 },   // 0x99
+  {  1491,   8,  14,  10,    1,  -10 },   // 0x9A
+  {  1505,   8,  14,  10,    1,  -10 },   // 0x9B
+  {  1519,   8,  14,  10,    1,  -10 },   // 0x9C
+  {  1533,   8,  14,  10,    1,  -10 },   // 0x9D
+  {  1547,   8,  14,  10,    1,  -10 },   // 0x9E
+  {  1561,   8,  14,  10,    1,  -10 },   // 0x9F
+  {  1575,   1,   1,   5,    0,    0 },   // 0xA0
+  {  1576,   3,  12,   6,    1,   -8 },   // 0xA1
+  {  1581,   7,  13,  10,    1,  -10 },   // 0xA2
+  {  1593,  10,  12,  10,    0,  -11 },   // 0xA3
+  {  1608,   9,   9,  10,    1,   -8 },   // 0xA4
+  {  1619,   9,  12,  10,    1,  -11 },   // 0xA5
+  {  1633,   1,  14,   5,    2,  -10 },   // 0xA6
+  {  1635,   6,  14,   8,    1,  -11 },   // 0xA7
+  {  1646,   5,   2,   8,    2,  -11 },   // 0xA8
+  {  1648,  12,  12,  16,    2,  -11 },   // 0xA9
+  {  1666,   6,   8,   8,    1,  -11 },   // 0xAA
+  {  1672,   7,   7,  10,    1,   -7 },   // 0xAB
+  {  1679,  10,   5,  13,    2,   -6 },   // 0xAC
+  {  1686,   4,   1,   6,    1,   -4 },   // 0xAD
+  {  1687,  12,  12,  16,    2,  -11 },   // 0xAE
+  {  1705,   5,   1,   8,    3,  -11 },   // 0xAF
+  {  1706,   5,   5,   8,    2,  -11 },   // 0xB0
+  {  1710,   9,  10,  13,    2,   -9 },   // 0xB1
+  {  1722,   6,   7,   6,    0,  -11 },   // 0xB2
+  {  1728,   6,   7,   6,    0,  -11 },   // 0xB3
+  {  1734,   4,   3,   8,    3,  -12 },   // 0xB4
+  {  1736,   9,  12,  10,    0,   -8 },   // 0xB5
+  {  1750,   8,  14,  10,    1,  -11 },   // 0xB6
+  {  1764,   1,   2,   5,    2,   -6 },   // 0xB7
+  {  1765,   4,   3,   8,    0,    1 },   // 0xB8
+  {  1767,   5,   7,   6,    1,  -11 },   // 0xB9
+  {  1772,   6,   8,   8,    1,  -11 },   // 0xBA
+  {  1778,   7,   7,  10,    1,   -7 },   // 0xBB
+  {  1785,  12,  12,  16,    1,  -11 },   // 0xBC
+  {  1803,  14,  12,  16,    1,  -11 },   // 0xBD
+  {  1824,  13,  12,  16,    0,  -11 },   // 0xBE
+  {  1844,   7,  12,   9,    1,   -8 },   // 0xBF
+  {  1855,  11,  15,  11,   -1,  -14 },   // 0xC0
+  {  1876,  11,  15,  11,   -1,  -14 },   // 0xC1
+  {  1897,  11,  15,  11,   -1,  -14 },   // 0xC2
+  {  1918,  12,  15,  11,   -1,  -14 },   // 0xC3
+  {  1941,  11,  15,  11,   -1,  -14 },   // 0xC4
+  {  1962,  11,  15,  11,   -1,  -14 },   // 0xC5
+  {  1983,  17,  12,  16,   -1,  -11 },   // 0xC6
+  {  2009,  10,  15,  11,    0,  -11 },   // 0xC7
+  {  2028,  10,  15,  10,    0,  -14 },   // 0xC8
+  {  2047,  10,  15,  10,    0,  -14 },   // 0xC9
+  {  2066,  10,  15,  10,    0,  -14 },   // 0xCA
+  {  2085,  10,  15,  10,    0,  -14 },   // 0xCB
+  {  2104,   5,  15,   5,    0,  -14 },   // 0xCC
+  {  2114,   6,  15,   5,    0,  -14 },   // 0xCD
+  {  2126,   5,  15,   5,    0,  -14 },   // 0xCE
+  {  2136,   5,  15,   5,    0,  -14 },   // 0xCF
+  {  2146,  11,  12,  12,    0,  -11 },   // 0xD0
+  {  2163,  12,  15,  12,    0,  -14 },   // 0xD1
+  {  2186,  11,  15,  13,    1,  -14 },   // 0xD2
+  {  2207,  11,  15,  13,    1,  -14 },   // 0xD3
+  {  2228,  11,  15,  13,    1,  -14 },   // 0xD4
+  {  2249,  11,  15,  13,    1,  -14 },   // 0xD5
+  {  2270,  11,  15,  13,    1,  -14 },   // 0xD6
+  {  2291,   9,   9,  13,    2,   -9 },   // 0xD7
+  {  2302,  13,  12,  13,    0,  -11 },   // 0xD8
+  {  2322,  10,  15,  12,    1,  -14 },   // 0xD9
+  {  2341,  10,  15,  12,    1,  -14 },   // 0xDA
+  {  2360,  10,  15,  12,    1,  -14 },   // 0xDB
+  {  2379,  10,  15,  12,    1,  -14 },   // 0xDC
+  {  2398,  10,  15,  10,    1,  -14 },   // 0xDD
+  {  2417,   9,  12,  10,    0,  -11 },   // 0xDE
+  {  2431,   9,  12,  10,    0,  -11 },   // 0xDF
+  {  2445,   8,  13,   9,    0,  -12 },   // 0xE0
+  {  2458,   8,  13,   9,    0,  -12 },   // 0xE1
+  {  2471,   8,  13,   9,    0,  -12 },   // 0xE2
+  {  2484,   9,  12,   9,    0,  -11 },   // 0xE3
+  {  2498,   8,  12,   9,    0,  -11 },   // 0xE4
+  {  2510,   8,  14,   9,    0,  -13 },   // 0xE5
+  {  2524,  15,   9,  16,    0,   -8 },   // 0xE6
+  {  2541,   8,  12,   9,    0,   -8 },   // 0xE7
+  {  2553,   8,  13,   9,    0,  -12 },   // 0xE8
+  {  2566,   8,  13,   9,    0,  -12 },   // 0xE9
+  {  2579,   8,  13,   9,    0,  -12 },   // 0xEA
+  {  2592,   8,  12,   9,    0,  -11 },   // 0xEB
+  {  2604,   3,  13,   4,    0,  -12 },   // 0xEC
+  {  2609,   5,  13,   4,    0,  -12 },   // 0xED
+  {  2618,   5,  13,   4,    0,  -12 },   // 0xEE
+  {  2627,   5,  12,   4,    0,  -11 },   // 0xEF
+  {  2635,   8,  12,  10,    0,  -11 },   // 0xF0
+  {  2647,   9,  12,  10,    0,  -11 },   // 0xF1
+  {  2661,   9,  13,  10,    0,  -12 },   // 0xF2
+  {  2676,   9,  13,  10,    0,  -12 },   // 0xF3
+  {  2691,   9,  13,  10,    0,  -12 },   // 0xF4
+  {  2706,   9,  12,  10,    0,  -11 },   // 0xF5
+  {  2720,   9,  12,  10,    0,  -11 },   // 0xF6
+  {  2734,  10,   7,  13,    2,   -7 },   // 0xF7
+  {  2743,  10,   9,   9,   -1,   -8 },   // 0xF8
+  {  2755,   9,  13,  10,    0,  -12 },   // 0xF9
+  {  2770,   9,  13,  10,    0,  -12 },   // 0xFA
+  {  2785,   9,  13,  10,    0,  -12 },   // 0xFB
+  {  2800,   9,  12,  10,    0,  -11 },   // 0xFC
+  {  2814,  10,  16,   9,   -1,  -12 },   // 0xFD
+  {  2834,   9,  15,   9,   -1,  -11 },   // 0xFE
+  {  2851,  10,  15,   9,   -1,  -11 } }; // 0xFF
+
+const GFXfont DejaVuSans_Oblique8pt8b PROGMEM = {
+  (uint8_t  *)DejaVuSans_Oblique8pt8bBitmaps,
+  (GFXglyph *)DejaVuSans_Oblique8pt8bGlyphs,
+  0x20, 0xFF, 18 };
+
+// Approx. 4445 bytes
+// --- Métriques horizontales (tools/font_metrics.py) ---
+#include "FontMetrics.h"
+const GlyphMetrics DejaVuSans_Oblique8pt8bMetrics[] PROGMEM = {
+  {   0,   5,   1 },   // 0x20
+  {   1,   6,   4 },   // 0x21
+  {   1,   7,   5 },   // 0x22
+  {   1,  13,  12 },   // 0x23
+  {   0,  10,  10 },   // 0x24
+  {   1,  15,  13 },   // 0x25
+  {   0,  12,  11 },   // 0x26
+  {   1,   4,   2 },   // 0x27
+  {   1,   6,   6 },   // 0x28
+  {  -1,   6,   4 },   // 0x29
+  {   1,   8,   8 },   // 0x2A
+  {   2,  13,  11 },   // 0x2B
+  {   0,   5,   2 },   // 0x2C
+  {   1,   6,   5 },   // 0x2D
+  {   1,   5,   2 },   // 0x2E
+  {  -1,   5,   7 },   // 0x2F
+  {   1,  10,  10 },   // 0x30
+  {   1,  10,   8 },   // 0x31
+  {   0,  10,   9 },   // 0x32
+  {   1,  10,  10 },   // 0x33
+  {   1,  10,  10 },   // 0x34
+  {   1,  10,  10 },   // 0x35
+  {   1,  10,  10 },   // 0x36
+  {   2,  10,  11 },   // 0x37
+  {   1,  10,  10 },   // 0x38
+  {   2,  10,  10 },   // 0x39
+  {   1,   5,   4 },   // 0x3A
+  {   0,   5,   3 },   // 0x3B
+  {   2,  13,  12 },   // 0x3C
+  {   2,  13,  12 },   // 0x3D
+  {   2,  13,  12 },   // 0x3E
+  {   2,   9,   8 },   // 0x3F
+  {   1,  16,  15 },   // 0x40
+  {  -1,  11,  10 },   // 0x41
+  {   0,  11,  10 },   // 0x42
+  {   0,  11,  10 },   // 0x43
+  {   0,  12,  11 },   // 0x44
+  {   0,  10,  10 },   // 0x45
+  {   0,   9,   9 },   // 0x46
+  {   0,  12,  11 },   // 0x47
+  {   0,  12,  12 },   // 0x48
+  {   0,   5,   3 },   // 0x49
+  {  -3,   5,   4 },   // 0x4A
+  {   0,  11,  11 },   // 0x4B
+  {   0,   9,   8 },   // 0x4C
+  {   0,  14,  13 },   // 0x4D
+  {   0,  12,  12 },   // 0x4E
+  {   1,  13,  12 },   // 0x4F
+  {   0,  10,   9 },   // 0x50
+  {   1,  13,  12 },   // 0x51
+  {   0,  11,   9 },   // 0x52
+  {   1,  10,  10 },   // 0x53
+  {   1,  10,  10 },   // 0x54
+  {   1,  12,  11 },   // 0x55
+  {   1,  11,  12 },   // 0x56
+  {   2,  16,  17 },   // 0x57
+  {  -1,  11,  11 },   // 0x58
+  {   1,  10,  11 },   // 0x59
+  {   0,  11,  12 },   // 0x5A
+  {   1,   6,   7 },   // 0x5B
+  {   1,   5,   4 },   // 0x5C
+  {   0,   6,   6 },   // 0x5D
+  {   2,  13,  12 },   // 0x5E
+  {   0,   8,   8 },   // 0x5F
+  {   2,   8,   5 },   // 0x60
+  {   0,   9,   8 },   // 0x61
+  {   0,  10,   9 },   // 0x62
+  {   0,   9,   8 },   // 0x63
+  {   0,  10,  10 },   // 0x64
+  {   0,   9,   8 },   // 0x65
+  {   0,   6,   7 },   // 0x66
+  {   0,  10,   9 },   // 0x67
+  {   0,  10,   9 },   // 0x68
+  {   0,   3,   3 },   // 0x69
+  {  -3,   3,   2 },   // 0x6A
+  {   0,   9,   9 },   // 0x6B
+  {   0,   3,   3 },   // 0x6C
+  {   0,  15,  14 },   // 0x6D
+  {   0,  10,   9 },   // 0x6E
+  {   0,  10,   9 },   // 0x6F
+  {  -1,  10,   9 },   // 0x70
+  {   0,  10,   9 },   // 0x71
+  {   0,   7,   6 },   // 0x72
+  {   0,   8,   8 },   // 0x73
+  {   1,   6,   7 },   // 0x74
+  {   0,  10,   9 },   // 0x75
+  {   0,   9,   9 },   // 0x76
+  {   1,  13,  13 },   // 0x77
+  {  -1,   9,   9 },   // 0x78
+  {  -1,   9,   9 },   // 0x79
+  {  -1,   8,   8 },   // 0x7A
+  {   2,  10,  10 },   // 0x7B
+  {   2,   5,   3 },   // 0x7C
+  {   0,  10,   8 },   // 0x7D
+  {   2,  13,  12 },   // 0x7E
+  {   1,  10,   9 },   // 0x7F
+  {   1,  10,   9 },   // 0x80
+  {   1,  10,   9 },   // 0x81
+  {   1,  10,   9 },   // 0x82
+  {   1,  10,   9 },   // 0x83
+  {   1,  10,   9 },   // 0x84
+  {   1,  10,   9 },   // 0x85
+  {   1,  10,   9 },   // 0x86
+  {   1,  10,   9 },   // 0x87
+  {   1,  10,   9 },   // 0x88
+  {   1,  10,   9 },   // 0x89
+  {   1,  10,   9 },   // 0x8A
+  {   1,  10,   9 },   // 0x8B
+  {   1,  10,   9 },   // 0x8C
+  {   1,  10,   9 },   // 0x8D
+  {   1,  10,   9 },   // 0x8E
+  {   1,  10,   9 },   // 0x8F
+  {   1,  10,   9 },   // 0x90
+  {   1,  10,   9 },   // 0x91
+  {   1,  10,   9 },   // 0x92
+  {   1,  10,   9 },   // 0x93
+  {   1,  10,   9 },   // 0x94
+  {   1,  10,   9 },   // 0x95
+  {   1,  10,   9 },   // 0x96
+  {   1,  10,   9 },   // 0x97
+  {   1,  10,   9 },   // 0x98
+  {   1,  10,   9 },   // 0x99
+  {   1,  10,   9 },   // 0x9A
+  {   1,  10,   9 },   // 0x9B
+  {   1,  10,   9 },   // 0x9C
+  {   1,  10,   9 },   // 0x9D
+  {   1,  10,   9 },   // 0x9E
+  {   1,  10,   9 },   // 0x9F
+  {   0,   5,   1 },   // 0xA0
+  {   1,   6,   4 },   // 0xA1
+  {   1,  10,   8 },   // 0xA2
+  {   0,  10,  10 },   // 0xA3
+  {   1,  10,  10 },   // 0xA4
+  {   1,  10,  10 },   // 0xA5
+  {   2,   5,   3 },   // 0xA6
+  {   1,   8,   7 },   // 0xA7
+  {   2,   8,   7 },   // 0xA8
+  {   2,  16,  14 },   // 0xA9
+  {   1,   8,   7 },   // 0xAA
+  {   1,  10,   8 },   // 0xAB
+  {   2,  13,  12 },   // 0xAC
+  {   1,   6,   5 },   // 0xAD
+  {   2,  16,  14 },   // 0xAE
+  {   3,   8,   8 },   // 0xAF
+  {   2,   8,   7 },   // 0xB0
+  {   2,  13,  11 },   // 0xB1
+  {   0,   6,   6 },   // 0xB2
+  {   0,   6,   6 },   // 0xB3
+  {   3,   8,   7 },   // 0xB4
+  {   0,  10,   9 },   // 0xB5
+  {   1,  10,   9 },   // 0xB6
+  {   2,   5,   3 },   // 0xB7
+  {   0,   8,   4 },   // 0xB8
+  {   1,   6,   6 },   // 0xB9
+  {   1,   8,   7 },   // 0xBA
+  {   1,  10,   8 },   // 0xBB
+  {   1,  16,  13 },   // 0xBC
+  {   1,  16,  15 },   // 0xBD
+  {   0,  16,  13 },   // 0xBE
+  {   1,   9,   8 },   // 0xBF
+  {  -1,  11,  10 },   // 0xC0
+  {  -1,  11,  10 },   // 0xC1
+  {  -1,  11,  10 },   // 0xC2
+  {  -1,  11,  11 },   // 0xC3
+  {  -1,  11,  10 },   // 0xC4
+  {  -1,  11,  10 },   // 0xC5
+  {  -1,  16,  16 },   // 0xC6
+  {   0,  11,  10 },   // 0xC7
+  {   0,  10,  10 },   // 0xC8
+  {   0,  10,  10 },   // 0xC9
+  {   0,  10,  10 },   // 0xCA
+  {   0,  10,  10 },   // 0xCB
+  {   0,   5,   5 },   // 0xCC
+  {   0,   5,   6 },   // 0xCD
+  {   0,   5,   5 },   // 0xCE
+  {   0,   5,   5 },   // 0xCF
+  {   0,  12,  11 },   // 0xD0
+  {   0,  12,  12 },   // 0xD1
+  {   1,  13,  12 },   // 0xD2
+  {   1,  13,  12 },   // 0xD3
+  {   1,  13,  12 },   // 0xD4
+  {   1,  13,  12 },   // 0xD5
+  {   1,  13,  12 },   // 0xD6
+  {   2,  13,  11 },   // 0xD7
+  {   0,  13,  13 },   // 0xD8
+  {   1,  12,  11 },   // 0xD9
+  {   1,  12,  11 },   // 0xDA
+  {   1,  12,  11 },   // 0xDB
+  {   1,  12,  11 },   // 0xDC
+  {   1,  10,  11 },   // 0xDD
+  {   0,  10,   9 },   // 0xDE
+  {   0,  10,   9 },   // 0xDF
+  {   0,   9,   8 },   // 0xE0
+  {   0,   9,   8 },   // 0xE1
+  {   0,   9,   8 },   // 0xE2
+  {   0,   9,   9 },   // 0xE3
+  {   0,   9,   8 },   // 0xE4
+  {   0,   9,   8 },   // 0xE5
+  {   0,  16,  15 },   // 0xE6
+  {   0,   9,   8 },   // 0xE7
+  {   0,   9,   8 },   // 0xE8
+  {   0,   9,   8 },   // 0xE9
+  {   0,   9,   8 },   // 0xEA
+  {   0,   9,   8 },   // 0xEB
+  {   0,   4,   3 },   // 0xEC
+  {   0,   4,   5 },   // 0xED
+  {   0,   4,   5 },   // 0xEE
+  {   0,   4,   5 },   // 0xEF
+  {   0,  10,   8 },   // 0xF0
+  {   0,  10,   9 },   // 0xF1
+  {   0,  10,   9 },   // 0xF2
+  {   0,  10,   9 },   // 0xF3
+  {   0,  10,   9 },   // 0xF4
+  {   0,  10,   9 },   // 0xF5
+  {   0,  10,   9 },   // 0xF6
+  {   2,  13,  12 },   // 0xF7
+  {  -1,   9,   9 },   // 0xF8
+  {   0,  10,   9 },   // 0xF9
+  {   0,  10,   9 },   // 0xFA
+  {   0,  10,   9 },   // 0xFB
+  {   0,  10,   9 },   // 0xFC
+  {  -1,   9,   9 },   // 0xFD
+  {  -1,   9,   8 },   // 0xFE
+  {  -1,   9,   9 }    // 0xFF
+};
+const FontMetrics DejaVuSans_Oblique8pt8bWidths = { DejaVuSans_Oblique8pt8bMetrics, 0x20, 0xFF };
+// --- Fin des métriques ---
+
+#endif // DEJAVUSANSOBLIQUE8PTLAT1__H
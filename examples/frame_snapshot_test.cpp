@@ -0,0 +1,322 @@
+/**
+ * Test natif (PC) de l'instantané du framebuffer (src/FrameSnapshot.h)
+ *
+ * 1. frameEncode() : le décodeur de référence (même algorithme que
+ *    decodeFrame() de la page web) redonne l'image exacte, complète ou en
+ *    delta, pour des images unies, en dégradé, en damier, aléatoires et
+ *    des deltas épars ; taille <= FRAME_BLOB_MAX ; buffer trop petit :
+ *    0 sans écriture au-delà.
+ * 2. FrameMirror == panneau : rendu réel du compte à rebours
+ *    (FullscreenCountdownRender.h, formats 0-3, titre statique, marquee
+ *    continu et aller-retour) ; après chaque bascule, la trame reçue par
+ *    un client (deltas enchaînés) et par un second client (images
+ *    complètes) est identique au buffer affiché du PxMATRIX de
+ *    substitution. Rotations 0-3 sur un tracé par plages.
+ * 3. Recopie au repos : sans requête depuis FRAME_MIRROR_IDLE_MS, la
+ *    recopie s'arrête et les images sont libérées ; à la requête suivante, 0 (503) puis, après la
+ *    trame redessinée (forceLayout), trames de nouveau identiques au
+ *    panneau (format tabulaire incrémental, titre statique, marquee).
+ * 4. Octets par trame reçue (image complète, delta, trame inchangée).
+ *
+ * Lancement : pio run -e native_frame_snapshot_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#define PxMATRIX_double_buffer true
+#include <PxMatrix.h>
+#include <stdio.h>
+#include <string.h>
+#include "ColorGamma.h"
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "TextLayoutCache.h"
+#include "FrameSnapshot.h"
+#include "NativeCheck.h"
+
+#define TOTAL_WIDTH  96
+#define TOTAL_HEIGHT 16
+#define PIXELS (TOTAL_WIDTH * TOTAL_HEIGHT)
+#define BLOB_MAX FRAME_BLOB_MAX(PIXELS)
+
+// --- Décodeur de référence (decodeFrame() de MAIN_page) ---
+static uint16_t get16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+static uint32_t get32(const uint8_t *p) { return get16(p) | (uint32_t)get16(p + 2) << 16; }
+
+// Pixels seuls (sans en-tête) appliqués à img ; faux si le flux est mal formé
+static bool decodePixels(const uint8_t *in, size_t len, uint16_t *img, size_t pixels) {
+  size_t p = 0, o = 0;
+  while (o < len) {
+    const uint8_t t = in[o++];
+    const size_t n = (t < 0x80 ? (t & 0x3F) : (t & 0x7F)) + 1;
+    if (p + n > pixels) return false;
+    if (t < 0x40) {
+      p += n;
+    } else if (t < 0x80) {
+      if (o + 2 > len) return false;
+      for (size_t k = 0; k < n; k++) img[p++] = get16(in + o);
+      o += 2;
+    } else {
+      if (o + 2 * n > len) return false;
+      for (size_t k = 0; k < n; k++, o += 2) img[p++] = get16(in + o);
+    }
+  }
+  return p == pixels;
+}
+
+// Client web : image courante et numéro de la dernière trame reçue
+struct FrameClient {
+  uint16_t img[PIXELS];
+  uint32_t seq;
+  uint32_t bytes, frames, full, delta, same;
+};
+
+static bool clientApply(FrameClient &c, const uint8_t *blob, size_t len) {
+  if (len < FRAME_HEADER || blob[0] != FRAME_MAGIC) return false;
+  if (get16(blob + 2) != TOTAL_WIDTH || get16(blob + 4) != TOTAL_HEIGHT) return false;
+  const uint8_t kind = blob[1];
+  c.bytes += (uint32_t)len;
+  c.frames++;
+  if (kind == FRAME_SAME) { c.same++; return len == FRAME_HEADER && get32(blob + 6) == c.seq; }
+  if (kind == FRAME_DELTA) {
+    if (get32(blob + 10) != c.seq) return false;
+    c.delta++;
+  } else {
+    c.full++;
+  }
+  if (!decodePixels(blob + FRAME_HEADER, len - FRAME_HEADER, c.img, PIXELS)) return false;
+  c.seq = get32(blob + 6);
+  return true;
+}
+
+// --- 1. Encodeur seul ---
+static uint32_t rng = 12345;
+static uint16_t rnd() { rng = rng * 1103515245u + 12345u; return (uint16_t)(rng >> 16); }
+
+static void checkEncode(const char *name, const uint16_t *cur, const uint16_t *base) {
+  static uint8_t out[BLOB_MAX];
+  static uint16_t img[PIXELS];
+  const size_t n = frameEncode(cur, base, PIXELS, out, sizeof(out) - FRAME_HEADER);
+  CHECK(n > 0 && n + FRAME_HEADER <= BLOB_MAX, "%s : %u octets (max %u)", name, (unsigned)n, (unsigned)BLOB_MAX);
+  if (base) memcpy(img, base, sizeof(img));
+  else memset(img, 0xA5, sizeof(img));
+  CHECK(decodePixels(out, n, img, PIXELS) && memcmp(img, cur, sizeof(img)) == 0, "%s : image decodee differente", name);
+
+  // Buffer trop petit : 0, rien d'écrit au-delà
+  static uint8_t small[BLOB_MAX + 16];
+  const size_t sizes[] = { 0, 1, n / 2, n - 1 };
+  for (size_t size : sizes) {
+    if (size >= n) continue;
+    memset(small, 0x5A, sizeof(small));
+    const size_t m = frameEncode(cur, base, PIXELS, small, size);
+    bool canary = true;
+    for (size_t i = size; i < sizeof(small); i++) canary = canary && small[i] == 0x5A;
+    CHECK(m == 0 && canary, "%s : buffer %u octets -> %u, ecriture au-dela %d", name, (unsigned)size, (unsigned)m,
+          !canary);
+  }
+}
+
+static void testEncoder() {
+  static uint16_t a[PIXELS], b[PIXELS];
+  int before = failures;
+  memset(a, 0, sizeof(a));
+  checkEncode("noir", a, nullptr);
+  checkEncode("noir / noir", a, a);
+  for (int i = 0; i < PIXELS; i++) a[i] = 0xF800;
+  checkEncode("rouge", a, nullptr);
+  for (int i = 0; i < PIXELS; i++) a[i] = (uint16_t)i;
+  checkEncode("degrade", a, nullptr);
+  for (int i = 0; i < PIXELS; i++) a[i] = ((i + i / TOTAL_WIDTH) & 1) ? 0xFFFF : 0;
+  checkEncode("damier", a, nullptr);
+  for (int i = 0; i < PIXELS; i++) b[i] = ((i + i / TOTAL_WIDTH) & 1) ? 0 : 0xFFFF;
+  checkEncode("damier inverse", b, a);
+  for (int i = 0; i < PIXELS; i++) a[i] = (i % 3) ? 0x07E0 : (uint16_t)(0x001F + i);
+  checkEncode("plages de 2 et litteraux", a, nullptr);
+  for (int round = 0; round < 200; round++) {
+    for (int i = 0; i < PIXELS; i++) a[i] = (round & 1) ? rnd() : (uint16_t)(rnd() & 3);
+    checkEncode("aleatoire", a, nullptr);
+    memcpy(b, a, sizeof(b));
+    const int changes = 1 + rnd() % 200;
+    for (int k = 0; k < changes; k++) b[rnd() % PIXELS] = (round & 2) ? rnd() : (uint16_t)(rnd() & 1);
+    checkEncode("delta epars", b, a);
+    for (int i = 0; i < PIXELS; i++) b[i] = (rnd() & 1) ? a[i] : rnd();
+    checkEncode("delta dense", b, a);
+  }
+  printf("%-38s %s\n", "frameEncode -> decodage exact", failures == before ? "OK" : "ECHEC");
+}
+
+// --- 2. Rendu réel du compte à rebours dans un FrameMirror ---
+#define P_LAT 5
+#define P_A   19
+#define P_B   23
+#define P_C   18
+#define P_OE  4
+
+namespace countdownfw {
+FrameMirror<TOTAL_WIDTH, TOTAL_HEIGHT> display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
+#include "FullscreenCountdownRender.h"
+
+// Pas d'ISR en natif : la bascule demandée est appliquée avant la trame suivante
+void waitFrameSwap() {
+  if (frameSwapPending) {
+    display.showBuffer();
+    frameSwapPending = false;
+  }
+}
+void presentFrame() {
+  display.publishFrame();
+  frameSwapPending = true;
+}
+} // namespace countdownfw
+
+static FrameClient live, other;
+static uint8_t blob[BLOB_MAX];
+
+// Trame affichée (après bascule) reçue par les deux clients
+static void pollAndCompare(const char *name, bool otherClient) {
+  using namespace countdownfw;
+  waitFrameSwap();
+  size_t len = display.snapshot(blob, sizeof(blob), live.seq, millis());
+  CHECK(clientApply(live, blob, len), "%s : trame %u refusee (%u octets)", name, display.frameSeq(), (unsigned)len);
+  CHECK(memcmp(live.img, display.visibleBuffer(), sizeof(live.img)) == 0, "%s : trame %u != panneau", name,
+        display.frameSeq());
+  len = display.snapshot(blob, sizeof(blob), live.seq, millis());
+  CHECK(len == FRAME_HEADER && blob[1] == FRAME_SAME, "%s : trame deja recue, %u octets", name, (unsigned)len);
+  if (otherClient) {
+    len = display.snapshot(blob, sizeof(blob), FRAME_SINCE_NONE, millis());
+    CHECK(clientApply(other, blob, len) && blob[1] == FRAME_FULL &&
+          memcmp(other.img, display.visibleBuffer(), sizeof(other.img)) == 0, "%s : second client", name);
+  }
+}
+
+// Tâche d'affichage : reprise de la recopie avant la trame
+template <typename Step>
+static void drawFrame(uint32_t i, unsigned long msPerFrame, Step step) {
+  using namespace countdownfw;
+  nativeAdvanceMillis(msPerFrame);
+  if (display.updateMirroring(millis())) forceLayout = true;
+  step(i);
+}
+
+template <typename Step>
+static void runScenario(const char *name, uint32_t frames, unsigned long msPerFrame, Step step) {
+  const int before = failures;
+  const uint32_t bytes = live.bytes, received = live.frames;
+  for (uint32_t i = 0; i < frames; i++) {
+    drawFrame(i, msPerFrame, step);
+    pollAndCompare(name, i % 50 == 0);
+  }
+  printf("%-38s %s (%.1f octets / trame)\n", name, failures == before ? "OK" : "ECHEC",
+         (double)(live.bytes - bytes) / (live.frames - received));
+}
+
+// Aperçu fermé puis rouvert : recopie arrêtée, 0 à la reprise, puis
+// trames identiques au panneau
+template <typename Step>
+static void runIdle(const char *name, const char *resumeName, unsigned long msPerFrame, Step step) {
+  using namespace countdownfw;
+  const int before = failures;
+  uint32_t i = 0;
+  for (unsigned long t = 0; t < FRAME_MIRROR_IDLE_MS + 1000; t += msPerFrame) {
+    drawFrame(i++, msPerFrame, step);
+    waitFrameSwap();
+  }
+  CHECK(!display.mirroring(), "%s : recopie active sans requete", name);
+  CHECK(display.mirrorBytes() == 0, "%s : %u octets gardes au repos", name, (unsigned)display.mirrorBytes());
+  const size_t len = display.snapshot(blob, sizeof(blob), live.seq, millis());
+  CHECK(len == 0, "%s : miroir perime servi (%u octets)", name, (unsigned)len);
+  CHECK(!display.mirroring(), "%s : recopie relancee avant la trame", name);
+  printf("%-38s %s\n", name, failures == before ? "OK" : "ECHEC");
+  runScenario(resumeName, 100, msPerFrame, step);
+  CHECK(display.mirroring(), "%s : recopie arretee pendant les requetes", resumeName);
+  CHECK(display.mirrorBytes() == 3 * PIXELS * 2, "%s : %u octets alloues", resumeName,
+        (unsigned)display.mirrorBytes());
+}
+
+static void testMirror() {
+  using namespace countdownfw;
+  display.setTextWrap(false);
+  memset(&live, 0, sizeof(live));
+  memset(&other, 0, sizeof(other));
+
+  // Aucune requête encore : pas de recopie, rien à servir
+  int before = failures;
+  CHECK(!display.mirroring() && display.mirrorBytes() == 0, "recopie active au demarrage");
+  CHECK(display.snapshot(blob, sizeof(blob), FRAME_SINCE_NONE, millis()) == 0, "trame servie avant recopie");
+  printf("%-38s %s\n", "demarrage sans recopie", failures == before ? "OK" : "ECHEC");
+
+  static const char *formatNames[4] = {
+    "format 0 (jours, 1 s)", "format 1 (HH:MM:SS, 1 s)", "format 2 (MM:SS, 1 s)", "format 3 (SS, 1 s)",
+  };
+  countdownExpired = false;
+  for (int f = 0; f < 4; f++) {
+    displayFormat = f;
+    forceLayout = true;
+    runScenario(formatNames[f], 300, 1000, [](uint32_t i) {
+      int total = 3 * 86400 + 5 * 3600 + 59 * 60 + 59 - (int)i;
+      displayFullscreenCountdown(total / 86400, (total % 86400) / 3600, (total % 3600) / 60, total % 60);
+    });
+  }
+
+  countdownExpired = true;
+  endMessageEffect = 0;
+  marqueeMode = 0;
+  strcpy(countdownTitle, "FIN !");
+  forceLayout = true;
+  runScenario("titre statique", 100, 150, [](uint32_t) { displayFullscreenCountdown(0, 0, 0, 0); });
+
+  strcpy(countdownTitle, "BONNE ANNÉE 2026 ! Joyeuses fêtes à tous");
+  forceLayout = true;
+  runScenario("marquee continu (40 ms)", 600, 40, [](uint32_t) { displayFullscreenCountdown(0, 0, 0, 0); });
+  marqueeMode = 2;
+  forceLayout = true;
+  runScenario("marquee aller-retour (40 ms)", 600, 40, [](uint32_t) { displayFullscreenCountdown(0, 0, 0, 0); });
+  marqueeMode = 0;
+
+  // Aperçu fermé puis rouvert : le rendu incrémental ne repasse pas sur
+  // les pixels dessinés pendant le repos
+  countdownExpired = false;
+  displayFormat = 1;
+  forceLayout = true;
+  runIdle("repos format 1", "reprise format 1", 1000, [](uint32_t i) {
+    int total = 5 * 3600 + 59 * 60 + 59 - (int)i;
+    displayFullscreenCountdown(0, total / 3600, (total % 3600) / 60, total % 60);
+  });
+  countdownExpired = true;
+  strcpy(countdownTitle, "FIN !");
+  forceLayout = true;
+  runIdle("repos titre statique", "reprise titre statique", 150,
+          [](uint32_t) { displayFullscreenCountdown(0, 0, 0, 0); });
+  strcpy(countdownTitle, "BONNE ANNÉE 2026 ! Joyeuses fêtes à tous");
+  forceLayout = true;
+  runIdle("repos marquee", "reprise marquee", 40, [](uint32_t) { displayFullscreenCountdown(0, 0, 0, 0); });
+
+  // Rotations : tracé par plages, fillRect et fillScreen
+  before = failures;
+  for (uint8_t r = 0; r < 4; r++) {
+    display.setRotation(r);
+    display.fillScreen(myBLUE);
+    display.fillRect(1, 1, 5, 3, myRED);
+    glyphSpanPrint(display, 2, 12, "R0T", &DejaVuSans9ptLat1, 1, myWHITE);
+    presentFrame();
+    pollAndCompare("rotation", true);
+    display.clearDisplay();
+    presentFrame();
+    pollAndCompare("rotation (effacement)", false);
+  }
+  display.setRotation(0);
+  printf("%-38s %s\n", "rotations 0-3", failures == before ? "OK" : "ECHEC");
+}
+
+int main() {
+  printf("=== Instantane du framebuffer (/frame) ===\n");
+  testEncoder();
+  testMirror();
+
+  printf("\nOctets recus par le client (%u trames, %ux%u pixels)\n", live.frames, TOTAL_WIDTH, TOTAL_HEIGHT);
+  printf("  images completes : %u, deltas : %u, trames inchangees : %u\n", live.full, live.delta, live.same);
+  printf("  moyenne %.1f octets / trame (RGB565 brut : %u)\n", (double)live.bytes / live.frames, PIXELS * 2);
+
+  return nativeCheckSummary();
+}
@@ -31,16 +31,15 @@
 #endif
 
 #include <Arduino.h>
+// Double buffer PxMatrix : rendu dans le buffer arrière, bascule dans l'ISR
+#define PxMATRIX_double_buffer true
 #include <PxMatrix.h>
 #include <RTClib.h>
-// Polices DejaVu avec support Latin-1 complet (accents et caractères spéciaux)
-#include "DejaVuSans9ptLat1.h"      // Normal
-#include "DejaVuSansBold9ptLat1.h"  // Gras
-#include "DejaVuSansOblique9ptLat1.h" // Italique
 #include <WiFi.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#define WEB_ASYNC_SERVER 1   // WebGzip.h / WebTemplate.h : variantes AsyncWebServerRequest
 #include <Preferences.h>
-#include <DNSServer.h>
 #include <time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -48,6 +47,22 @@
 #include "freertos/semphr.h"
 #include "nvs_flash.h"
 #include "esp_err.h"
+#include "RefreshScheduler.h"
+#include "IsrMetrics.h"
+#include "ColorGamma.h"
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "TextLayoutCache.h"
+#include "WebGzip.h"
+#include "WebTemplate.h"
+#include "JsonWriter.h"
+#include "CaptiveDns.h"
+#include "FrameSnapshot.h"
+#include "JsonPatch.h"
+#include "CountdownSettings.h"
+#include "CountdownPageGz.h"  // MAIN_page gzip (tools/web_gzip.py)
 
 // Version firmware (uniformisé avec main)
 static const char* FIRMWARE_VERSION = "1.0.0"; // garder synchro avec src/main.cpp
@@ -72,7 +87,7 @@ static const char* GITHUB_URL = "https://github.com/electron-rare";
 // Taille des stacks pour les tâches
 #define TASK_DISPLAY_STACK     4096
 #define TASK_WEBSERVER_STACK   4096
-#define TASK_COUNTDOWN_STACK   2048
+#define TASK_COUNTDOWN_STACK   3072  // publie aussi le flux /events
 #define TASK_NETWORK_STACK     4096
 
 // Handles pour les tâches
@@ -103,6 +118,10 @@ SemaphoreHandle_t preferencesMutex;
 #define MATRIX_PANELS_Y 1
 #endif
 
+// Lignes balayées par cycle (display.begin()) : PxMatrix::display() allume
+// une ligne par appel, la ligne 0 revient tous les DISPLAY_ROW_PATTERN appels
+#define DISPLAY_ROW_PATTERN 4
+
 // Calcul des dimensions totales
 #define TOTAL_WIDTH (MATRIX_WIDTH * MATRIX_PANELS_X)
 #define TOTAL_HEIGHT (MATRIX_HEIGHT * MATRIX_PANELS_Y)
@@ -111,11 +130,15 @@ SemaphoreHandle_t preferencesMutex;
 hw_timer_t * timer = nullptr;
 portMUX_TYPE timerMux = portMUX_INITIALIZER_UNLOCKED;
 
-// Temps d'affichage ajusté selon le nombre de panneaux
-uint8_t display_draw_time = (MATRIX_PANELS_X * MATRIX_PANELS_Y > 4) ? 20 : 30;
+// Temps d'affichage, piloté par refreshScheduler selon la durée mesurée de l'ISR
+uint8_t display_draw_time = 30;
+RefreshScheduler refreshScheduler;
+#if ISR_METRICS
+IsrMetrics isrMetrics;  // durées, gigue et dépassements de display_updater
+#endif
 
-// Objet matrice
-PxMATRIX display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
+// Objet matrice, avec image miroir des pixels dessinés pour /frame
+FrameMirror<TOTAL_WIDTH, TOTAL_HEIGHT> display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
 
 // RTC
 RTC_DS3231 rtc;
@@ -130,7 +153,7 @@ const char* password = "YOUR_WIFI_PASSWORD";
 // Configuration Point d'accès (si pas de WiFi)
 // DNS pour le portail captif
 const byte DNS_PORT = 53;
-DNSServer dnsServer;
+CaptiveDns captiveDns;
 const char* ap_ssid = "HOKA_CLOCK";
 const char* ap_password = "hokahoka";
 
@@ -138,19 +161,12 @@ const char* ap_password = "hokahoka";
 // Mode de fonctionnement WiFi
 bool useStationMode = false; // true = se connecter au WiFi, false = créer un point d'accès
 
-// Serveur web
-WebServer server(80);
+// Serveur web asynchrone : gestionnaires exécutés dans la tâche AsyncTCP
+AsyncWebServer server(80);
+AsyncEventSource events("/events"); // état en direct (SSE), voir pushLiveState()
 
-// Couleurs prédéfinies
-uint16_t myRED      = display.color565(255, 0, 0);
-uint16_t myGREEN    = display.color565(0, 255, 0);
-uint16_t myBLUE     = display.color565(0, 0, 255);
-uint16_t myYELLOW   = display.color565(255, 255, 0);
-uint16_t myCYAN     = display.color565(0, 255, 255);
-uint16_t myMAGENTA  = display.color565(255, 0, 255);
-uint16_t myWHITE    = display.color565(255, 255, 255);
-uint16_t myBLACK    = display.color565(0, 0, 0);
-uint16_t myORANGE   = display.color565(255, 165, 0);
+// Rendu plein écran (polices, couleurs, état du marquee, displayFullscreenCountdown)
+#include "FullscreenCountdownRender.h"
 
 // Prototypes des fonctions
 void IRAM_ATTR display_updater();
@@ -367,173 +383,17 @@ void DisplayTask(void * parameter);
 void CountdownTask(void * parameter);
 void NetWebTask(void * parameter);
 
-// Variables pour le countdown
+// Date cible du countdown
 DateTime countdownTarget;
-bool countdownExpired = false;
-bool blinkLastSeconds = false;  // Clignotement pour les 10 dernières secondes
-bool blinkState = true;
-unsigned long lastBlinkTime = 0;
-// Paramètres de clignotement configurables (pour les 10 dernières secondes)
-bool blinkEnabled = true;       // 1 = clignote sur la fin du compte à rebours
-int blinkIntervalMs = 500;      // Intervalle de clignotement en ms (modifiable via Web UI)
-int blinkWindowSeconds = 10;    // Nombre de dernières secondes pendant lesquelles le clignotement est actif
-
-// Marquee (défilement) pour le texte final si trop long
-volatile bool marqueeActive = false; // indicateur global pour la tâche d'affichage
-// Paramètres configurables et état du défilement
-bool marqueeEnabled = true;              // activation auto si texte trop long
-int marqueeIntervalMs = 40;              // intervalle ms entre déplacements (1 px)
-int marqueeGap = 24;                     // espace en pixels avant répétition
-int marqueeMode = 0;                     // 0=Auto (si overflow, scroll gauche), 1=Toujours gauche, 2=Aller-Retour, 3=Une fois
-int marqueeReturnIntervalMs = 60;        // vitesse différente pour le retour (aller-retour)
-int marqueeBouncePauseLeftMs = 400;      // pause extrémité gauche (ms)
-int marqueeBouncePauseRightMs = 400;     // pause extrémité droite (ms)
-int marqueeOneShotDelayMs = 800;         // délai centré avant départ (ms)
-bool marqueeOneShotStopCenter = true;    // recadrer au centre à la fin
-int marqueeOneShotRestartSec = 0;        // redémarrage automatique (0=pas de restart)
-// Accélération progressive
-bool marqueeAccelEnabled = false;
-int marqueeAccelStartIntervalMs = 80;    // intervalle initial
-int marqueeAccelEndIntervalMs = 30;      // intervalle final
-int marqueeAccelDurationMs = 3000;       // durée interpolation sur un cycle (ms)
-static int marqueeTextWidth = 0;         // largeur pixels du texte courant
-static int marqueeOffset = 0;            // position X courante
-static unsigned long lastMarqueeStep = 0; // dernière étape
-static int marqueeDirection = -1;        // pour mode aller-retour
-static bool marqueeOneShotDone = false;  // pour mode une fois
-static bool marqueeInPause = false;      // pause extrémités bounce
-static unsigned long marqueePauseUntil = 0; // fin pause
-static bool marqueeOneShotCenterPhase = false; // phase centrée initiale
-static unsigned long marqueeOneShotStart = 0;  // début phase centrée
-static unsigned long marqueeOneShotRestartAt = 0; // moment de relance
-static unsigned long marqueeCycleStartMs = 0;   // début cycle pour accélération
-// Flag de forçage de recalcul layout (modifié via Web)
-volatile bool forceLayout = false;
-// Padding supplémentaire aux extrémités (espaces visuels entrée/sortie défilement)
-int marqueeEdgePadding = 2; // pixels
-
-// --- Normalisation accents (UTF-8 -> ASCII approximatif) ---
-// Remplace les caractères accentués français communs par leur équivalent non accentué.
-// Objectif: permettre un rendu cohérent avec les polices GFX limitées au Basic ASCII.
-size_t foldAccents(const char *in, char *out, size_t outSize) {
-  if (!in || !out || outSize == 0) return 0;
-  size_t o = 0;
-  while (*in && o + 1 < outSize) {
-    unsigned char c = (unsigned char)*in;
-    if (c < 0x80) {
-      // ASCII direct
-      out[o++] = *in++;
-    } else if ((c == 0xC3) && in[1]) {
-      unsigned char d = (unsigned char)in[1];
-      char rep = 0; // remplacement
-      switch (d) {
-        case 0x80: case 0x81: rep='A'; break; // ÀÁ
-        case 0x82: rep='A'; break; // Â
-        case 0x84: rep='A'; break; // Ä
-        case 0x87: rep='C'; break; // Ç
-        case 0x88: case 0x89: rep='E'; break; // ÈÉ
-        case 0x8A: case 0x8B: rep='E'; break; // ÊË
-        case 0x8E: case 0x8F: rep='I'; break; // ÎÏ
-        case 0x94: case 0x96: rep='O'; break; // ÔÖ
-        case 0x99: case 0x9B: rep='U'; break; // ÙÛ
-        case 0x9C: rep='U'; break; // Ü
-        case 0xA0: case 0xA1: rep='a'; break; // àá
-        case 0xA2: rep='a'; break; // â
-        case 0xA4: rep='a'; break; // ä
-        case 0xA7: rep='c'; break; // ç
-        case 0xA8: case 0xA9: rep='e'; break; // è é
-        case 0xAA: case 0xAB: rep='e'; break; // ê ë
-        case 0xAE: case 0xAF: rep='i'; break; // î ï
-        case 0xB4: case 0xB6: rep='o'; break; // ô ö
-        case 0xB9: case 0xBB: rep='u'; break; // ù û
-        case 0xBC: rep='u'; break; // ü
-      }
-      if (rep) {
-        out[o++] = rep;
-        in += 2;
-      } else {
-        // caractère non géré -> ignorer les deux bytes
-        in += 2;
-      }
-    } else {
-      // Séquence multioctet non gérée -> ignorer octet
-      in++;
-    }
-  }
-  out[o] = '\0';
-  return o;
-}
-
-// Conversion UTF-8 -> Latin-1 (ISO-8859-1). Les caractères hors plage 0x00-0xFF
-// (émojis, symboles hors Latin-1) sont remplacés par '?'.
-// Nécessaire car la police étendue générée couvre 0x20-0xFF (octets simples) alors
-// que l'entrée (depuis le formulaire web) est en UTF-8 multioctet.
-size_t utf8ToLatin1(const char *in, char *out, size_t outSize) {
-  if (!in || !out || outSize == 0) return 0;
-  size_t o = 0;
-  while (*in && o + 1 < outSize) {
-    unsigned char c = (unsigned char)*in;
-    if (c < 0x80) { // ASCII direct
-      out[o++] = c; in++;
-    } else if ((c & 0xE0) == 0xC0 && in[1]) { // 2 octets
-      unsigned char c2 = (unsigned char)in[1];
-      if ((c2 & 0xC0) == 0x80) {
-        uint16_t code = ((c & 0x1F) << 6) | (c2 & 0x3F); // U+0080..U+07FF
-        if (code <= 0x00FF) {
-          out[o++] = (char)code;
-        } else {
-          out[o++] = '?';
-        }
-        in += 2;
-      } else {
-        out[o++] = '?'; in++;
-      }
-    } else if ((c & 0xF0) == 0xE0 && in[1] && in[2]) { // 3 octets
-      unsigned char c2 = (unsigned char)in[1];
-      unsigned char c3 = (unsigned char)in[2];
-      if (((c2 & 0xC0) == 0x80) && ((c3 & 0xC0) == 0x80)) {
-        uint16_t code = ((c & 0x0F) << 12) | ((c2 & 0x3F) << 6) | (c3 & 0x3F);
-        if (code <= 0x00FF) {
-          out[o++] = (char)code;
-        } else {
-          // Remplacements spécifiques ponctuation “smart” courante
-          switch (code) {
-            case 0x2018: // ‘
-            case 0x2019: // ’
-              out[o++] = '\''; break;
-            case 0x201C: // “
-            case 0x201D: // ”
-              out[o++] = '"'; break;
-            case 0x2013: // –
-            case 0x2014: // —
-              out[o++] = '-'; break;
-            case 0x2026: // …
-              if (o + 3 < outSize) { out[o++]='.'; out[o++]='.'; out[o++]='.'; }
-              else out[o++]='.'; // fallback partiel si peu de place
-              break;
-            default:
-              out[o++] = '?';
-          }
-        }
-        in += 3;
-      } else {
-        out[o++] = '?'; in++;
-      }
-    } else { // 4 octets ou séquence invalide -> non représentable
-      out[o++] = '?';
-      // Skipper au moins 1 octet (si séquence UTF-8 valide on pourrait consommer tous, mais
-      // pour simplicité on avance octet par octet sur séquences plus longues)
-      in++;
-    }
-  }
-  out[o] = '\0';
-  return o;
-}
 
 // Variable pour indiquer qu'il faut sauvegarder les paramètres
 volatile bool saveRequested = false;
 volatile unsigned long saveRequestTime = 0;
 
+// État de la sauvegarde publié sur /events
+enum SaveStatus : uint8_t { SAVE_IDLE = 0, SAVE_PENDING = 1, SAVE_DONE = 2, SAVE_FAILED = 3 };
+volatile uint8_t saveStatus = SAVE_IDLE;
+
 // Paramètres configurables via l'interface web
 int countdownYear = 2025;
 int countdownMonth = 12;
@@ -541,26 +401,9 @@ int countdownDay = 31;
 int countdownHour = 23;
 int countdownMinute = 59;
 int countdownSecond = 0;
-char countdownTitle[51] = "COUNTDOWN";
-// Polices DejaVu avec taille automatique et style configurable
-int fontStyle = 0; // 0=Normal, 1=Gras, 2=Italique
-int countdownColorR = 0;
-int countdownColorG = 255;
-int countdownColorB = 0;
-uint16_t countdownColor;
-
-// Paramètres du message de fin
-int endMessageColorR = 255;
-int endMessageColorG = 215;
-int endMessageColorB = 0;
-uint16_t endMessageColor;
-int endMessageEffect = 0; // 0=static, 1=blink, 2=fade, 3=rainbow
 
 int displayBrightness = -1; // -1 = auto (calculé selon nombre de panneaux)
 
-// Format d'affichage (0=jours, 1=heures, 2=minutes, 3=secondes uniquement)
-int displayFormat = 0;
-
 // HTML Page
 const char MAIN_page[] PROGMEM = R"rawliteral(
 <!DOCTYPE html><html lang="fr"><head>
@@ -608,12 +451,8 @@ button.danger { --b:var(--danger); background:linear-gradient(135deg,#d13737,#ef
 .swatch:hover { transform:scale(1.1); box-shadow:0 0 0 2px #1f2d35,0 0 0 5px rgba(0,0,0,.55); }
 .swatch.active { outline:2px solid #fff; }
 .preview-panel { padding:18px 12px 24px; border-radius:16px; background:#000; position:relative; display:flex; justify-content:center; align-items:center; }
-.led-matrix { display:grid; grid-template-columns:repeat(96,4px); grid-template-rows:repeat(16,4px); gap:1px; background:#111; border:2px solid #333; padding:4px; border-radius:8px; }
-.led-pixel { width:4px; height:4px; background:#001100; border-radius:1px; transition:background 0.1s; }
-.led-pixel.active { box-shadow:0 0 2px currentColor; }
+.led-matrix { display:block; width:100%; max-width:576px; height:auto; image-rendering:pixelated; background:#000; border:2px solid #333; padding:4px; border-radius:8px; }
 #titlePreview { display:block; font-size:.65rem; margin-top:8px; color:var(--muted); text-align:center; }
-.blink .led-pixel.active { animation:ledBlink .9s steps(2,start) infinite; }
-@keyframes ledBlink { to { background:#001100 !important; box-shadow:none !important; } }
 .swatches { display:flex; flex-wrap:wrap; gap:6px; margin-top:6px; }
 .swatch { width:30px; height:30px; border-radius:6px; cursor:pointer; position:relative; box-shadow:0 0 0 2px #141c22, 0 0 0 4px rgba(0,0,0,.3); transition:.2s transform,.2s box-shadow; }
 .swatch:hover { transform:scale(1.1); box-shadow:0 0 0 2px #1f2d35,0 0 0 5px rgba(0,0,0,.55); }
@@ -636,7 +475,7 @@ footer { margin:40px 0 10px; text-align:center; font-size:.6rem; letter-spacing:
 <div class="wrap grid" style="gap:18px;">
   <div class="card preview-panel" id="previewCard">
     <div class="save-indicator" id="saveState"><span class="dot"></span><span id="saveLabel">PRÊT</span></div>
-    <div class="led-matrix" id="ledMatrix"></div>
+    <canvas class="led-matrix" id="ledMatrix" width="96" height="16"></canvas>
     <span id="titlePreview"></span>
     <div class="inline-note" id="expireNote" style="display:none;">Le compte à rebours est terminé.</div>
     <div class="quick" aria-label="Ajustements rapides">
@@ -894,26 +733,84 @@ function triggerAutoSave() {
   if (autoSaveTimeout) clearTimeout(autoSaveTimeout);
   
   autoSaveTimeout = setTimeout(() => {
+    autoSaveTimeout = null;
     if (!isAutoSaving) {
       performAutoSave();
     }
   }, 1500); // Attendre 1.5s après la dernière modification
 }
 
+// Paramètres du module tels que publiés (/getSettings puis réponses de /api/settings)
+let savedSettings = null;
+const END_EFFECTS = ['static', 'blink', 'fade', 'rainbow'];
+
+// Formulaire avec les clés de /api/settings
+function formSettings() {
+  const num = id => parseInt(el(id).value, 10);
+  const flag = id => el(id).value === '1';
+  const d = el('date').value.split('-').map(Number);
+  const t = (el('time').value || '00:00:00').split(':').map(Number);
+  return {
+    title: el('title').value,
+    year: d[0], month: d[1], day: d[2],
+    hour: t[0] || 0, minute: t[1] || 0, second: t[2] || 0,
+    fontStyle: num('fontStyle'),
+    colorR: num('colorR'), colorG: num('colorG'), colorB: num('colorB'),
+    endColorR: num('endColorR'), endColorG: num('endColorG'), endColorB: num('endColorB'),
+    endEffect: END_EFFECTS.indexOf(el('endEffect').value),
+    blinkEnabled: flag('blinkEnabled'),
+    blinkIntervalMs: num('blinkInterval'),
+    blinkWindow: num('blinkWindow'),
+    marqueeEnabled: flag('marqueeEnabled'),
+    marqueeIntervalMs: num('marqueeInterval'),
+    marqueeGap: num('marqueeGap'),
+    marqueeMode: num('marqueeMode'),
+    marqueeReturnIntervalMs: num('marqueeReturnInterval'),
+    marqueeBouncePauseLeftMs: num('marqueeBouncePauseLeft'),
+    marqueeBouncePauseRightMs: num('marqueeBouncePauseRight'),
+    marqueeOneShotDelayMs: num('marqueeOneShotDelay'),
+    marqueeOneShotStopCenter: flag('marqueeOneShotStopCenter'),
+    marqueeOneShotRestartSec: num('marqueeOneShotRestart'),
+    marqueeAccelEnabled: flag('marqueeAccelEnabled'),
+    marqueeAccelStartIntervalMs: num('marqueeAccelStart'),
+    marqueeAccelEndIntervalMs: num('marqueeAccelEnd'),
+    marqueeAccelDurationMs: num('marqueeAccelDuration'),
+    brightness: num('brightnessHidden')
+  };
+}
+
+// Envoie seulement les champs modifiés : le module valide le tout et
+// l'applique d'un bloc, ou refuse avec la raison
 function performAutoSave() {
+  const form = formSettings();
+  const patch = {};
+  for (const k in form) {
+    const v = form[k];
+    if (typeof v === 'number' && isNaN(v)) continue;
+    if (!savedSettings || savedSettings[k] !== (typeof v === 'boolean' ? +v : v)) patch[k] = v;
+  }
+  if (Object.keys(patch).length === 0) {
+    showAutoSaveIndicator('✅ Déjà à jour', 'success');
+    return;
+  }
   isAutoSaving = true;
   showAutoSaveIndicator('💾 Sauvegarde en cours...', 'info');
-  
-  const formData = new FormData(el('settingsForm'));
-  
-  fetch('/settings', {
+  fetch('/api/settings', {
     method: 'POST',
-    body: formData
+    headers: { 'Content-Type': 'application/json' },
+    body: JSON.stringify(patch)
   })
-  .then(r => r.text())
-  .then(() => {
-    showAutoSaveIndicator('✅ Sauvegardé automatiquement', 'success');
+  .then(r => r.json())
+  .then(res => {
     isAutoSaving = false;
+    if (res.status !== 'OK') {
+      showAutoSaveIndicator('❌ Refusé : ' + res.msg, 'error');
+      return;
+    }
+    if (savedSettings) {
+      for (const k in patch) savedSettings[k] = typeof patch[k] === 'boolean' ? +patch[k] : patch[k];
+    }
+    showAutoSaveIndicator('✅ Sauvegardé automatiquement', 'success');
   })
   .catch(() => {
     showAutoSaveIndicator('❌ Erreur de sauvegarde', 'error');
@@ -1036,78 +933,62 @@ class ColorWheel {
   }
 }
 
-// === Création de la matrice LED ===
-const MATRIX_WIDTH = 96; // 3 panneaux de 32px
-const MATRIX_HEIGHT = 16;
-let ledPixels = [];
-
-// Initialiser la matrice LED
-function initLedMatrix() {
-  ledMatrix.innerHTML = '';
-  ledPixels = [];
-  for(let i = 0; i < MATRIX_WIDTH * MATRIX_HEIGHT; i++) {
-    const pixel = document.createElement('div');
-    pixel.className = 'led-pixel';
-    ledMatrix.appendChild(pixel);
-    ledPixels.push(pixel);
-  }
-}
-
-// Fonction pour allumer un pixel à une position donnée
-function setPixel(x, y, color) {
-  if(x >= 0 && x < MATRIX_WIDTH && y >= 0 && y < MATRIX_HEIGHT) {
-    const index = y * MATRIX_WIDTH + x;
-    if(ledPixels[index]) {
-      ledPixels[index].style.backgroundColor = color;
-      ledPixels[index].classList.add('active');
+// === Aperçu fidèle : trame affichée par le module (/frame) ===
+// Trame RGB565 codée par plages (src/FrameSnapshot.h), en delta de la
+// dernière trame reçue ; une requête à la fois, FRAME_INTERVAL_MS entre
+// deux demandes. Couleurs telles qu'envoyées au panneau (gamma compris).
+const FRAME_INTERVAL_MS = 100;
+const frameCtx = ledMatrix.getContext('2d');
+let frameImage = null;
+let frameSeq = 0; // 0 : aucune trame, le module répond une image complète
+
+function decodeFrame(buf) {
+  const v = new DataView(buf);
+  if (buf.byteLength < 14 || v.getUint8(0) !== 70) return false; // 'F'
+  const kind = v.getUint8(1), w = v.getUint16(2, true), h = v.getUint16(4, true);
+  const seq = v.getUint32(6, true), base = v.getUint32(10, true);
+  if (kind === 2) return true; // trame déjà à jour
+  if (!frameImage || frameImage.width !== w || frameImage.height !== h) {
+    if (kind !== 0) return false;
+    ledMatrix.width = w; ledMatrix.height = h;
+    frameImage = frameCtx.createImageData(w, h);
+  }
+  if (kind === 1 && base !== frameSeq) return false;
+  const px = frameImage.data, n = w * h;
+  let p = 0, o = 14;
+  const put = c => {
+    if (p >= n) return;
+    const q = 4 * p++;
+    px[q] = (c >> 8 & 0xF8) | c >> 13;
+    px[q + 1] = (c >> 3 & 0xFC) | (c >> 9 & 3);
+    px[q + 2] = (c << 3 & 0xF8) | (c >> 2 & 7);
+    px[q + 3] = 255;
+  };
+  while (p < n && o < buf.byteLength) {
+    const t = v.getUint8(o++);
+    if (t < 0x40) { p += t + 1; }                       // pixels inchangés
+    else if (t < 0x80) {                                // plage d'une couleur
+      const c = v.getUint16(o, true); o += 2;
+      for (let k = 0; k <= (t & 0x3F); k++) put(c);
+    } else {                                            // couleurs littérales
+      for (let k = 0; k <= (t & 0x7F); k++, o += 2) put(v.getUint16(o, true));
     }
   }
+  frameCtx.putImageData(frameImage, 0, 0);
+  frameSeq = seq;
+  return true;
 }
 
-// Effacer tous les pixels
-function clearMatrix() {
-  ledPixels.forEach(pixel => {
-    pixel.style.backgroundColor = '#001100';
-    pixel.classList.remove('active');
-  });
-}
-
-// Dessiner du texte simplifié sur la matrice (simulation basique)
-function drawTextOnMatrix(text, color) {
-  clearMatrix();
-  
-  // Police bitmap 5x7 simplifiée pour les chiffres et :
-  const font = {
-    '0': [[1,1,1],[1,0,1],[1,0,1],[1,0,1],[1,1,1]],
-    '1': [[0,1,0],[1,1,0],[0,1,0],[0,1,0],[1,1,1]],
-    '2': [[1,1,1],[0,0,1],[1,1,1],[1,0,0],[1,1,1]],
-    '3': [[1,1,1],[0,0,1],[1,1,1],[0,0,1],[1,1,1]],
-    '4': [[1,0,1],[1,0,1],[1,1,1],[0,0,1],[0,0,1]],
-    '5': [[1,1,1],[1,0,0],[1,1,1],[0,0,1],[1,1,1]],
-    '6': [[1,1,1],[1,0,0],[1,1,1],[1,0,1],[1,1,1]],
-    '7': [[1,1,1],[0,0,1],[0,0,1],[0,0,1],[0,0,1]],
-    '8': [[1,1,1],[1,0,1],[1,1,1],[1,0,1],[1,1,1]],
-    '9': [[1,1,1],[1,0,1],[1,1,1],[0,0,1],[1,1,1]],
-    ':': [[0],[1],[0],[1],[0]],
-    ' ': [[0,0,0],[0,0,0],[0,0,0],[0,0,0],[0,0,0]],
-    '-': [[0,0,0],[0,0,0],[1,1,1],[0,0,0],[0,0,0]]
-  };
-  
-  let x = 8; // Position de départ
-  for(let i = 0; i < text.length; i++) {
-    const char = text[i];
-    const pattern = font[char];
-    if(pattern) {
-      for(let row = 0; row < pattern.length; row++) {
-        for(let col = 0; col < pattern[row].length; col++) {
-          if(pattern[row][col]) {
-            setPixel(x + col, 5 + row, color);
-          }
-        }
-      }
-      x += (pattern[0] ? pattern[0].length : 3) + 1; // Espacement entre caractères
-    }
-  }
+function pollFrame() {
+  const start = Date.now();
+  fetch('/frame?since=' + frameSeq, { cache: 'no-store' })
+    .then(r => r.ok ? r.arrayBuffer() : null)
+    .then(b => { if (!b || !decodeFrame(b)) frameSeq = 0; })
+    .catch(() => { frameSeq = 0; })
+    .finally(() => {
+      const wait = document.hidden ? 1000 : FRAME_INTERVAL_MS - (Date.now() - start);
+      setTimeout(pollFrame, Math.max(0, wait));
+    });
 }
 
 // === Configuration des swatches ===
@@ -1138,8 +1019,8 @@ function createSwatches(containerId, colorWheel) {
 
 // === Variables de logique ===
 let target = null; // Date target JS
-let expired=false; let blink=false; let lastBlink=0;
-let lastServerSync = 0; let offsetMs = 0; // Diff client/serveur (si future sync ajoutée)
+let expired=false;
+let lastServerSync = 0; let offsetMs = 0; // Diff client/module (recalée par /events)
 
 function showToast(msg,ok=true){toast.textContent=msg;toast.classList.add('show');toast.style.background= ok?'#1e2c31':'#452222'; setTimeout(()=>toast.classList.remove('show'),2600);} 
 
@@ -1162,52 +1043,13 @@ function parseFormDateTime(){ const d=el('date').value; const t=el('time').value
 
 function refreshTarget(){ target = parseFormDateTime(); }
 
-// Fonction pour mettre à jour la prévisualisation LED
+// Note de fin : la matrice affiche la trame du module (pollFrame), seule
+// l'échéance est déduite de la cible du formulaire
 function updateLedPreview() {
   if(!target) return;
-  
   const now = new Date(Date.now()+offsetMs);
-  let diff = (target - now)/1000;
-  let displayText = '';
-  let color = mainColorWheel ? mainColorWheel.currentColor : '#00ff00';
-  
-  if(diff <= 0) {
-    displayText = el('title').value || 'FINI';
-    expired = true;
-    expireNote.style.display='block';
-    
-    // Utiliser la couleur du message de fin
-    if(endColorWheel) {
-      color = endColorWheel.currentColor;
-    }
-  } else {
-    expired = false;
-    expireNote.style.display='none';
-    let d=Math.floor(diff/86400);
-    let h=Math.floor(diff%86400/3600);
-    let m=Math.floor(diff%3600/60);
-    let s=Math.floor(diff%60);
-    
-    // Format adaptatif comme dans l'original
-    if(d>0) displayText=`${d}d ${h.toString().padStart(2,'0')}:${m.toString().padStart(2,'0')}`;
-    else if(h>0) displayText=`${h.toString().padStart(2,'0')}:${m.toString().padStart(2,'0')}:${s.toString().padStart(2,'0')}`;
-    else if(m>0) displayText=`${m.toString().padStart(2,'0')}:${s.toString().padStart(2,'0')}`;
-    else displayText=s.toString().padStart(2,'0');
-    
-    // Gestion du clignotement pour les dernières secondes
-    const bw = parseInt(el('blinkWindow').value)||10;
-    if(d===0 && h===0 && m===0 && s<=bw) {
-      if(Date.now()-lastBlink>450) {
-        lastBlink=Date.now();
-        blink=!blink;
-        ledMatrix.classList.toggle('blink',blink);
-      }
-    } else {
-      ledMatrix.classList.remove('blink');
-    }
-  }
-  
-  drawTextOnMatrix(displayText, color);
+  expired = (target - now) <= 0;
+  expireNote.style.display = expired ? 'block' : 'none';
 }
 
 function updatePreviewLoop(ts){ 
@@ -1216,6 +1058,25 @@ function updatePreviewLoop(ts){
 }
 requestAnimationFrame(updatePreviewLoop);
 
+// === État en direct poussé par le module (SSE /events, 1 par seconde) ===
+// Recale l'horloge de l'aperçu sur celle du module (offsetMs) quand le
+// formulaire n'a pas de modification en attente d'envoi.
+let deviceState = null;
+const saveLabels = ['PRÊT', 'SAUVEGARDE', 'SAUVÉ', 'ÉCHEC'];
+if (window.EventSource) {
+  const live = new EventSource('/events');
+  live.addEventListener('state', e => {
+    const d = JSON.parse(e.data);
+    deviceState = d;
+    if (target && !autoSaveTimeout && !isAutoSaving && d.s !== 1 && !d.x) {
+      const o = target.getTime() - d.r * 1000 - Date.now();
+      if (Math.abs(o - offsetMs) > 1000) offsetMs = o; // r est arrondi à la seconde
+    }
+    setSaving(d.s === 1, saveLabels[d.s]);
+  });
+  live.onerror = () => setSaving(false, 'HORS LIGNE');
+}
+
 function syncFieldsToPreview(){ 
   titlePreview.textContent = (el('title').value||'').toUpperCase(); 
   refreshTarget(); 
@@ -1312,8 +1173,8 @@ document.querySelectorAll('.quick button[data-add], .quick button[data-set]').fo
 
 // Chargement initial depuis l'ESP32
 window.addEventListener('load',()=>{
-  // Initialiser la matrice LED
-  initLedMatrix();
+  // Aperçu de la matrice : trames du module
+  pollFrame();
   
   // Initialiser les roues de couleur
   initializeColorWheels();
@@ -1324,7 +1185,7 @@ window.addEventListener('load',()=>{
   // Injecter version firmware (fourni côté C++ via endpoint futur ou placeholder compilé)
   document.getElementById('fwVer').textContent = 'v__FWVER__';
   const now=new Date(); const tomorrow=new Date(now.getTime()+86400000); el('date').value=tomorrow.toISOString().split('T')[0]; el('time').value='23:59:59';
-  fetch('/getSettings').then(r=>r.json()).then(d=>{ el('title').value=d.title; const ds=`${d.year}-${String(d.month).padStart(2,'0')}-${String(d.day).padStart(2,'0')}`; el('date').value=ds; const ts=`${String(d.hour).padStart(2,'0')}:${String(d.minute).padStart(2,'0')}:${String(d.second).padStart(2,'0')}`; el('time').value=ts; if(d.blinkEnabled!==undefined){ el('blinkEnabled').value = d.blinkEnabled ? '1' : '0'; } if(d.blinkIntervalMs!==undefined){ el('blinkInterval').value = d.blinkIntervalMs; } if(d.blinkWindow!==undefined){ el('blinkWindow').value = d.blinkWindow; } if(d.marqueeEnabled!==undefined){ el('marqueeEnabled').value = d.marqueeEnabled ? '1':'0'; } if(d.marqueeIntervalMs!==undefined){ el('marqueeInterval').value = d.marqueeIntervalMs; } if(d.marqueeGap!==undefined){ el('marqueeGap').value = d.marqueeGap; } if(d.marqueeMode!==undefined){ el('marqueeMode').value = d.marqueeMode; } if(d.marqueeReturnIntervalMs!==undefined){ el('marqueeReturnInterval').value = d.marqueeReturnIntervalMs; } if(d.marqueeBouncePauseLeftMs!==undefined){ el('marqueeBouncePauseLeft').value = d.marqueeBouncePauseLeftMs; } if(d.marqueeBouncePauseRightMs!==undefined){ el('marqueeBouncePauseRight').value = d.marqueeBouncePauseRightMs; } if(d.marqueeOneShotDelayMs!==undefined){ el('marqueeOneShotDelay').value = d.marqueeOneShotDelayMs; } if(d.marqueeOneShotStopCenter!==undefined){ el('marqueeOneShotStopCenter').value = d.marqueeOneShotStopCenter? '1':'0'; } if(d.marqueeOneShotRestartSec!==undefined){ el('marqueeOneShotRestart').value = d.marqueeOneShotRestartSec; } if(d.marqueeAccelEnabled!==undefined){ el('marqueeAccelEnabled').value = d.marqueeAccelEnabled? '1':'0'; } if(d.marqueeAccelStartIntervalMs!==undefined){ el('marqueeAccelStart').value = d.marqueeAccelStartIntervalMs; } if(d.marqueeAccelEndIntervalMs!==undefined){ el('marqueeAccelEnd').value = d.marqueeAccelEndIntervalMs; } if(d.marqueeAccelDurationMs!==undefined){ el('marqueeAccelDuration').value = d.marqueeAccelDurationMs; } if(d.brightness!==undefined){ if(parseInt(d.brightness,10)===-1){ el('brightnessMode').value='auto'; el('brightnessHidden').value='-1'; } else { el('brightnessMode').value='manual'; el('brightness').value=d.brightness; el('brightnessHidden').value=d.brightness; } } if(d.fontStyle!==undefined){ el('fontStyle').value = d.fontStyle; } const color=rgbToHex(d.colorR,d.colorG,d.colorB); el('colorPicker').value=color; updateColor(color); syncFieldsToPreview(); setSaving(false,'PRÊT'); showToast('Paramètres chargés'); }).catch(()=>{ showToast('Échec chargement paramètres',false); setSaving(false,'HORS LIGNE'); syncFieldsToPreview(); });
+  fetch('/getSettings').then(r=>r.json()).then(d=>{ savedSettings=d; el('title').value=d.title; const ds=`${d.year}-${String(d.month).padStart(2,'0')}-${String(d.day).padStart(2,'0')}`; el('date').value=ds; const ts=`${String(d.hour).padStart(2,'0')}:${String(d.minute).padStart(2,'0')}:${String(d.second).padStart(2,'0')}`; el('time').value=ts; if(d.blinkEnabled!==undefined){ el('blinkEnabled').value = d.blinkEnabled ? '1' : '0'; } if(d.blinkIntervalMs!==undefined){ el('blinkInterval').value = d.blinkIntervalMs; } if(d.blinkWindow!==undefined){ el('blinkWindow').value = d.blinkWindow; } if(d.marqueeEnabled!==undefined){ el('marqueeEnabled').value = d.marqueeEnabled ? '1':'0'; } if(d.marqueeIntervalMs!==undefined){ el('marqueeInterval').value = d.marqueeIntervalMs; } if(d.marqueeGap!==undefined){ el('marqueeGap').value = d.marqueeGap; } if(d.marqueeMode!==undefined){ el('marqueeMode').value = d.marqueeMode; } if(d.marqueeReturnIntervalMs!==undefined){ el('marqueeReturnInterval').value = d.marqueeReturnIntervalMs; } if(d.marqueeBouncePauseLeftMs!==undefined){ el('marqueeBouncePauseLeft').value = d.marqueeBouncePauseLeftMs; } if(d.marqueeBouncePauseRightMs!==undefined){ el('marqueeBouncePauseRight').value = d.marqueeBouncePauseRightMs; } if(d.marqueeOneShotDelayMs!==undefined){ el('marqueeOneShotDelay').value = d.marqueeOneShotDelayMs; } if(d.marqueeOneShotStopCenter!==undefined){ el('marqueeOneShotStopCenter').value = d.marqueeOneShotStopCenter? '1':'0'; } if(d.marqueeOneShotRestartSec!==undefined){ el('marqueeOneShotRestart').value = d.marqueeOneShotRestartSec; } if(d.marqueeAccelEnabled!==undefined){ el('marqueeAccelEnabled').value = d.marqueeAccelEnabled? '1':'0'; } if(d.marqueeAccelStartIntervalMs!==undefined){ el('marqueeAccelStart').value = d.marqueeAccelStartIntervalMs; } if(d.marqueeAccelEndIntervalMs!==undefined){ el('marqueeAccelEnd').value = d.marqueeAccelEndIntervalMs; } if(d.marqueeAccelDurationMs!==undefined){ el('marqueeAccelDuration').value = d.marqueeAccelDurationMs; } if(d.brightness!==undefined){ if(parseInt(d.brightness,10)===-1){ el('brightnessMode').value='auto'; el('brightnessHidden').value='-1'; } else { el('brightnessMode').value='manual'; el('brightness').value=d.brightness; el('brightnessHidden').value=d.brightness; } } if(d.fontStyle!==undefined){ el('fontStyle').value = d.fontStyle; } if(d.endEffect!==undefined){ el('endEffect').value = END_EFFECTS[d.endEffect]; } if(d.endColorR!==undefined){ el('endColorR').value=d.endColorR; el('endColorG').value=d.endColorG; el('endColorB').value=d.endColorB; endColorWheel.setColor(rgbToHex(d.endColorR,d.endColorG,d.endColorB)); } const color=rgbToHex(d.colorR,d.colorG,d.colorB); el('colorPicker').value=color; updateColor(color); syncFieldsToPreview(); setSaving(false,'PRÊT'); showToast('Paramètres chargés'); }).catch(()=>{ showToast('Échec chargement paramètres',false); setSaving(false,'HORS LIGNE'); syncFieldsToPreview(); });
 });
 </script>
 </body></html>
@@ -1402,379 +1263,22 @@ void updateDisplayFormat(int days, int hours, int minutes, int seconds) {
   }
 }
 
-// Fonction pour obtenir la largeur du texte
-uint16_t getTextWidth(const char* text, const GFXfont* font = NULL) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  
-  if (font) display.setFont(font);
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-  display.setFont(); // Reset to default font
-  
-  return w;
-}
-
-// Dessine les deux points du séparateur d'horloge
-void drawColon(int16_t x, int16_t y, uint16_t colonColor) {
-  display.fillRect(x, y, 2, 2, colonColor);
-  display.fillRect(x, y+4, 2, 2, colonColor);
-}
-
-// Sélection de police selon le style choisi (Normal, Gras, Italique)
-const GFXfont* getOptimalFont() {
-  switch (fontStyle) {
-    case 1: return &DejaVuSans_Bold9pt8b;    // Gras
-    case 2: return &DejaVuSans_Oblique9pt8b; // Italique
-    default: return &DejaVuSans9ptLat1;      // Normal (défaut)
-  }
-}
-
-// Calcul automatique de la taille optimale selon le texte et la police
-int calculateAutoTextSize(const char* text, const GFXfont* font) {
-  // Taille de base selon la largeur totale disponible - ajustée pour minuteur
-  int baseSize;
-  if (TOTAL_WIDTH >= 128) {
-    baseSize = 2; // Taille réduite pour 4+ panneaux (128+ pixels)
-  } else if (TOTAL_WIDTH >= 96) {
-    baseSize = 1; // Taille réduite pour 3 panneaux (96 pixels) - mieux pour minuteur
-  } else if (TOTAL_WIDTH >= 64) {
-    baseSize = 1; // Taille appropriée pour 2 panneaux (64 pixels)
+// Luminosité effective (auto si -1) : part matérielle PxMatrix et niveau des
+// tables gamma, puis reconversion des couleurs déjà calculées
+void applyBrightness() {
+  int effectiveBrightness;
+  if (displayBrightness < 0) {
+    effectiveBrightness = 150;
+    if (MATRIX_PANELS_X > 2) effectiveBrightness = 100;
+    if (MATRIX_PANELS_X > 4) effectiveBrightness = 80;
+    if (MATRIX_PANELS_X > 6) effectiveBrightness = 60;
   } else {
-    baseSize = 1; // Taille standard pour 1 panneau (32 pixels)
+    effectiveBrightness = displayBrightness > 255 ? 255 : displayBrightness;
   }
-  
-  // Adapter selon la longueur du texte (textes longs = taille plus petite)
-  int textLen = strlen(text);
-  if (textLen > 8 && baseSize > 1) {
-    return baseSize - 1; // Réduire la taille pour les textes longs (seuil abaissé)
-  }
-  
-  return baseSize;
-}
-
-// Affichage du compte à rebours en plein écran
-void displayFullscreenCountdown(int days, int hours, int minutes, int seconds) {
-  // --- Cache layout ---
-  static char lastText[64] = ""; // élargi pour titres jusqu'à 50 chars
-  static bool lastExpired = false;
-  static int16_t cachedX = 0, cachedY = 0;
-  static uint8_t cachedSetSize = 1;
-  static bool cachedIsEndMsg = false;
-  static uint16_t cachedTextPixelWidth = 0; // pour calcul marquee
-  static int16_t cachedFontXOffset = 0;     // x1 pour centrage correct
-
-  // Recalculer systématiquement la couleur utilisateur (évite usage d'une valeur obsolète)
-  int localR, localG, localB;
-  uint16_t userColor;
-  
-  if (countdownExpired) {
-    // Utiliser les couleurs du message de fin
-    localR = endMessageColorR;
-    localG = endMessageColorG;
-    localB = endMessageColorB;
-    if (localR < 0) localR = 0; if (localR > 255) localR = 255;
-    if (localG < 0) localG = 0; if (localG > 255) localG = 255;
-    if (localB < 0) localB = 0; if (localB > 255) localB = 255;
-    userColor = display.color565(localR, localG, localB);
-  } else {
-    // Utiliser les couleurs du countdown
-    localR = countdownColorR;
-    localG = countdownColorG;
-    localB = countdownColorB;
-    if (localR < 0) localR = 0; if (localR > 255) localR = 255;
-    if (localG < 0) localG = 0; if (localG > 255) localG = 255;
-    if (localB < 0) localB = 0; if (localB > 255) localB = 255;
-    userColor = display.color565(localR, localG, localB);
-  }
-
-  // Gestion des effets d'affichage
-  uint16_t displayColor = userColor;
-  
-  if (countdownExpired) {
-    // Effets pour le message de fin
-    unsigned long currentTime = millis();
-    static unsigned long lastEffectTime = 0;
-    static bool effectState = false;
-    static uint8_t rainbowHue = 0;
-    
-    switch (endMessageEffect) {
-      case 1: // Clignotant
-        if (currentTime - lastEffectTime >= 500) {
-          lastEffectTime = currentTime;
-          effectState = !effectState;
-        }
-        displayColor = effectState ? userColor : myBLACK;
-        break;
-        
-      case 2: // Fade in/out
-        {
-          int fadePhase = (currentTime / 50) % 100; // Cycle de 5 secondes
-          if (fadePhase > 50) fadePhase = 100 - fadePhase;
-          float fadeFactor = fadePhase / 50.0f;
-          int fadeR = (int)(localR * fadeFactor);
-          int fadeG = (int)(localG * fadeFactor);
-          int fadeB = (int)(localB * fadeFactor);
-          displayColor = display.color565(fadeR, fadeG, fadeB);
-        }
-        break;
-        
-      case 3: // Arc-en-ciel
-        if (currentTime - lastEffectTime >= 100) {
-          lastEffectTime = currentTime;
-          rainbowHue = (rainbowHue + 5) % 360;
-        }
-        {
-          // Conversion HSV vers RGB simple
-          float h = rainbowHue / 60.0f;
-          float s = 1.0f, v = 1.0f;
-          int i = (int)h;
-          float f = h - i;
-          float p = v * (1 - s);
-          float q = v * (1 - s * f);
-          float t = v * (1 - s * (1 - f));
-          float r, g, b;
-          switch (i) {
-            case 0: r = v; g = t; b = p; break;
-            case 1: r = q; g = v; b = p; break;
-            case 2: r = p; g = v; b = t; break;
-            case 3: r = p; g = q; b = v; break;
-            case 4: r = t; g = p; b = v; break;
-            default: r = v; g = p; b = q; break;
-          }
-          displayColor = display.color565((int)(r * 255), (int)(g * 255), (int)(b * 255));
-        }
-        break;
-        
-      default: // Statique
-        displayColor = userColor;
-        break;
-    }
-  } else if (blinkEnabled && blinkLastSeconds) {
-    // Clignotement configurable des 10 dernières secondes (si activé)
-    unsigned long currentTime = millis();
-    int localInterval = blinkIntervalMs;
-    if (localInterval < 50) localInterval = 50;       // bornes de sécurité
-    if (localInterval > 5000) localInterval = 5000;
-    if (currentTime - lastBlinkTime >= (unsigned long)localInterval) {
-      lastBlinkTime = currentTime;
-      blinkState = !blinkState;
-    }
-    displayColor = blinkState ? userColor : myBLACK;
-  }
-
-  // Préparer le texte cible
-  char currentText[64];
-  if (countdownExpired) {
-    // Police DejaVu avec support complet UTF-8 -> Latin-1
-    utf8ToLatin1(countdownTitle, currentText, sizeof(currentText));
-  } else {
-    switch (displayFormat) {
-      case 0:  snprintf(currentText, sizeof(currentText), "%dD %02d:%02d", days, hours, minutes); break;
-      case 1:  snprintf(currentText, sizeof(currentText), "%02d:%02d:%02d", hours, minutes, seconds); break;
-      case 2:  snprintf(currentText, sizeof(currentText), "%02d:%02d", minutes, seconds); break;
-      default: snprintf(currentText, sizeof(currentText), "%02d", seconds); break;
-    }
-  }
-
-  bool needRecalc = forceLayout || countdownExpired != lastExpired || (strcmp(currentText, lastText) != 0);
-
-  if (needRecalc) {
-    // Utiliser uniquement la police DejaVu optimale
-    const GFXfont *font = getOptimalFont();
-    display.setFont(font);
-    
-    // Calcul automatique de la taille basé sur la résolution du panneau
-    int optimalSize = calculateAutoTextSize(currentText, font);
-    display.setTextSize(optimalSize);
-    cachedSetSize = optimalSize;
-    
-    int16_t x1, y1; uint16_t w, h;
-    display.getTextBounds(currentText, 0, 0, &x1, &y1, &w, &h);
-  cachedTextPixelWidth = w; // conserver largeur
-  cachedY = (TOTAL_HEIGHT - h) / 2 - y1;
-  cachedFontXOffset = x1;
-
-    // Décider activation selon le mode
-    marqueeTextWidth = w;
-    marqueeActive = false;
-    marqueeOneShotDone = (marqueeMode == 3) ? marqueeOneShotDone : false; // réinitialiser si changement de texte
-    if (marqueeEnabled) {
-      switch (marqueeMode) {
-        case 0: // Auto (continuous gauche si dépasse)
-          if (w > TOTAL_WIDTH) marqueeActive = true;
-          break;
-        case 1: // Toujours gauche
-          marqueeActive = true;
-          break;
-        case 2: // Aller-Retour seulement si dépasse
-          if (w > TOTAL_WIDTH) marqueeActive = true;
-          break;
-        case 3: // Une seule fois (si dépasse et pas déjà fini)
-          if (w > TOTAL_WIDTH && !marqueeOneShotDone) marqueeActive = true;
-          break;
-      }
-    }
-
-    if (marqueeActive) {
-      marqueeInPause = false;
-      marqueePauseUntil = 0;
-      if (marqueeMode == 2) { // bounce
-    // Démarre avec padding gauche
-    marqueeOffset = marqueeEdgePadding;
-        marqueeDirection = -1;
-        // pause initiale gauche
-        if (marqueeBouncePauseLeftMs > 0) { marqueeInPause = true; marqueePauseUntil = millis() + marqueeBouncePauseLeftMs; }
-      } else if (marqueeMode == 1 || marqueeMode == 0) {
-    marqueeOffset = TOTAL_WIDTH + marqueeEdgePadding; // continuous depuis la droite + padding
-      } else if (marqueeMode == 3) { // one-shot centré d'abord
-        marqueeOneShotCenterPhase = true;
-        marqueeOneShotStart = millis();
-        cachedX = (TOTAL_WIDTH - w) / 2 - x1; // centré
-      }
-      lastMarqueeStep = millis();
-      marqueeCycleStartMs = millis();
-    } else {
-      cachedX = (TOTAL_WIDTH - w) / 2 - x1; // centré
-    }
-
-    // Si texte court (pas de marquee) on définit cachedX, sinon il sera dynamique
-    if (!marqueeActive) {
-      cachedX = (TOTAL_WIDTH - w) / 2 - x1;
-    }
-  // Conserver version pliée (marquee & mesure)
-  strncpy(lastText, currentText, sizeof(lastText)-1);
-  lastText[sizeof(lastText)-1] = '\0';
-    lastExpired = countdownExpired;
-    cachedIsEndMsg = countdownExpired;
-  forceLayout = false;
-  } else {
-    const GFXfont *font = getOptimalFont();
-    display.setFont(font);
-    display.setTextSize(cachedSetSize);
-  }
-
-  // Gestion de l'avancement du marquee (hors section critique)
-  if (marqueeActive) {
-    unsigned long nowMs = millis();
-    // ONE SHOT: phase centrée -> attendre délai puis lancer scroll
-    if (marqueeMode == 3 && marqueeOneShotCenterPhase) {
-      if (nowMs - marqueeOneShotStart >= (unsigned long)marqueeOneShotDelayMs) {
-        marqueeOneShotCenterPhase = false;
-        marqueeOffset = TOTAL_WIDTH; // début scroll
-        lastMarqueeStep = nowMs;
-        marqueeCycleStartMs = nowMs;
-      } else {
-        // ne rien faire pendant la phase centrée
-      }
-    } else if (marqueeMode == 3 && marqueeOneShotCenterPhase == false && marqueeOneShotDone) {
-      // terminé : si restart demandé
-      if (marqueeOneShotRestartSec > 0 && nowMs >= marqueeOneShotRestartAt && marqueeOneShotRestartAt != 0) {
-        // relance cycle
-        marqueeOneShotDone = false;
-        marqueeOneShotCenterPhase = true;
-        marqueeOneShotStart = nowMs;
-        lastMarqueeStep = nowMs;
-        marqueeCycleStartMs = nowMs;
-      }
-    } else {
-      // BOUNCE: gestion pause
-      if (marqueeMode == 2 && marqueeInPause) {
-        if (nowMs >= marqueePauseUntil) {
-          marqueeInPause = false;
-          lastMarqueeStep = nowMs; // reset timer pour éviter saut
-          marqueeCycleStartMs = nowMs; // nouveau cycle après pause
-        }
-      }
-      int forwardInt = marqueeIntervalMs; if (forwardInt < 5) forwardInt = 5; if (forwardInt > 500) forwardInt = 500;
-      int returnInt = marqueeReturnIntervalMs; if (returnInt < 5) returnInt = 5; if (returnInt > 500) returnInt = 500;
-
-      // Accélération progressive
-      if (marqueeAccelEnabled) {
-        int startI = marqueeAccelStartIntervalMs; if (startI < 5) startI = 5; if (startI > 500) startI = 500;
-        int endI = marqueeAccelEndIntervalMs; if (endI < 5) endI = 5; if (endI > 500) endI = 500;
-        unsigned long elapsed = nowMs - marqueeCycleStartMs;
-        float t = (marqueeAccelDurationMs <= 0) ? 1.0f : (float)elapsed / (float)marqueeAccelDurationMs;
-        if (t > 1.0f) t = 1.0f;
-        int interp = startI + (int)((endI - startI) * t);
-        // Pour bounce: appliquer sur direction actuelle (séparément pour retour si différent)
-        if (marqueeMode == 2) {
-          if (marqueeDirection == -1) forwardInt = interp; else returnInt = interp; // direction -1 = vers gauche (forward logique), 1 = retour
-        } else if (marqueeMode == 0 || marqueeMode == 1 || marqueeMode == 3) {
-          forwardInt = interp;
-        }
-      }
-      int effectiveInt = forwardInt;
-      if (marqueeMode == 2 && marqueeDirection == 1) effectiveInt = returnInt; // retour
-      if (!marqueeInPause && nowMs - lastMarqueeStep >= (unsigned long)effectiveInt) {
-        lastMarqueeStep = nowMs;
-        if (marqueeMode == 2) { // bounce
-          marqueeOffset += marqueeDirection; // -1 gauche, +1 droite
-          int minX = TOTAL_WIDTH - marqueeTextWidth - marqueeEdgePadding; // borne gauche avec padding
-          if (marqueeOffset <= minX) { marqueeOffset = minX; marqueeDirection = 1; if (marqueeBouncePauseRightMs>0){ marqueeInPause=true; marqueePauseUntil=nowMs+marqueeBouncePauseRightMs; } marqueeCycleStartMs = nowMs; }
-          if (marqueeOffset >= marqueeEdgePadding) { marqueeOffset = marqueeEdgePadding; marqueeDirection = -1; if (marqueeBouncePauseLeftMs>0){ marqueeInPause=true; marqueePauseUntil=nowMs+marqueeBouncePauseLeftMs; } marqueeCycleStartMs = nowMs; }
-        } else if (marqueeMode == 3) { // one-shot scrolling phase
-          if (!marqueeOneShotDone && !marqueeOneShotCenterPhase) {
-            marqueeOffset--; // vers la gauche
-            if (marqueeOffset + marqueeTextWidth < 0) {
-              marqueeActive = false; marqueeOneShotDone = true;
-              if (marqueeOneShotStopCenter) {
-                // recadrer avec correction x1
-                cachedX = (TOTAL_WIDTH - marqueeTextWidth) / 2 - cachedFontXOffset;
-              }
-              if (marqueeOneShotRestartSec > 0) {
-                marqueeOneShotRestartAt = nowMs + (unsigned long)marqueeOneShotRestartSec * 1000UL;
-              }
-            }
-          }
-        } else { // continuous modes
-          marqueeOffset--;
-          int localGap = marqueeGap; if (localGap < 4) localGap = 4; if (localGap > 256) localGap = 256;
-          if (marqueeOffset + marqueeTextWidth < 0) {
-            marqueeOffset = TOTAL_WIDTH + localGap + marqueeEdgePadding; // boucle avec padding
-            marqueeCycleStartMs = nowMs; // nouveau cycle -> reset accel
-          }
-        }
-      }
-    }
-  }
-
-  // Section critique minimale : effacement + écriture tampon
-  portENTER_CRITICAL(&timerMux);
-  display.clearDisplay();
-  // Toujours la couleur choisie (même si expiré) conformément à la demande
-  display.setTextColor(displayColor);
-  if (marqueeActive) {
-    if (marqueeMode == 2) { // bounce
-      display.setCursor(marqueeOffset, cachedY);
-      display.print(lastText);
-    } else if (marqueeMode == 3) { // one-shot
-      if (marqueeOneShotCenterPhase) {
-        display.setCursor((TOTAL_WIDTH - marqueeTextWidth)/2 - cachedFontXOffset, cachedY);
-        display.print(lastText);
-      } else if (marqueeOneShotDone && marqueeOneShotStopCenter) {
-        display.setCursor((TOTAL_WIDTH - marqueeTextWidth)/2 - cachedFontXOffset, cachedY);
-        display.print(lastText);
-      } else {
-        display.setCursor(marqueeOffset, cachedY);
-        display.print(lastText);
-      }
-    } else {
-      // continuous / always
-      int drawX = marqueeOffset;
-      display.setCursor(drawX, cachedY);
-      display.print(lastText);
-      int localGap = marqueeGap; if (localGap < 4) localGap = 4; if (localGap > 256) localGap = 256;
-      int secondX = marqueeOffset + marqueeTextWidth + localGap;
-      if (secondX < TOTAL_WIDTH) {
-        display.setCursor(secondX, cachedY);
-        display.print(lastText);
-      }
-    }
-  } else {
-    display.setCursor(cachedX, cachedY);
-    display.print(lastText);
-  }
-  portEXIT_CRITICAL(&timerMux);
+  display.setBrightness(colorGammaApplyBrightness((uint8_t)effectiveBrightness));
+  refreshPalette();
+  countdownColor = color565Corrected(countdownColorR, countdownColorG, countdownColorB);
+  forceLayout = true;  // trame suivante redessinée avec les nouvelles tables
 }
 
 // Chargement des paramètres depuis la mémoire flash (version thread-safe)
@@ -1807,6 +1311,13 @@ void loadSettings() {
     countdownHour = preferences.getInt("cd_Hour", 23);
     countdownMinute = preferences.getInt("cd_Minute", 59);
     countdownSecond = preferences.getInt("cd_Second", 0);
+    // Date enregistrée par une version antérieure : jour ramené dans le mois
+    if (countdownYear < 2000 || countdownYear > 2099) countdownYear = 2025;
+    if (countdownMonth < 1 || countdownMonth > 12) countdownMonth = 12;
+    if (countdownDay < 1) countdownDay = 1;
+    if (countdownDay > countdownDaysInMonth(countdownYear, countdownMonth)) {
+      countdownDay = countdownDaysInMonth(countdownYear, countdownMonth);
+    }
     
     // Paramètres d'affichage - style de police et couleur
     fontStyle = preferences.getInt("fontStyle", 0); // 0=Normal, 1=Gras, 2=Italique
@@ -1849,22 +1360,12 @@ void loadSettings() {
   }
   
   // Mise à jour de la couleur
-  countdownColor = display.color565(countdownColorR, countdownColorG, countdownColorB);
+  countdownColor = color565Corrected(countdownColorR, countdownColorG, countdownColorB);
   
   // Mise à jour de la date cible
   countdownTarget = DateTime(countdownYear, countdownMonth, countdownDay, 
                            countdownHour, countdownMinute, countdownSecond);
-  // Appliquer brightness (auto si -1)
-  int effectiveBrightness;
-  if (displayBrightness < 0) {
-    effectiveBrightness = 150;
-    if (MATRIX_PANELS_X > 2) effectiveBrightness = 100;
-    if (MATRIX_PANELS_X > 4) effectiveBrightness = 80;
-    if (MATRIX_PANELS_X > 6) effectiveBrightness = 60;
-  } else {
-    effectiveBrightness = displayBrightness;
-  }
-  display.setBrightness(effectiveBrightness);
+  applyBrightness();
 }
 
 // Sauvegarde des paramètres dans la mémoire flash (version thread-safe optimisée)
@@ -1874,8 +1375,10 @@ void saveSettings() {
   // Vérifications de sécurité préliminaires
   if (!checkMutexSanity()) {
     Serial.println("Mutex sanity check failed - aborting save");
+    saveStatus = SAVE_FAILED;
     return;
   }
+  bool saved = false;
   
   // Désactiver temporairement le timer d'affichage pour éviter les conflits
   bool timerWasEnabled = (timer != nullptr);
@@ -1973,9 +1476,10 @@ void saveSettings() {
         preferences.putString("cd_Title", String(countdownTitle));
         
         Serial.println("Settings saved successfully");
+        saved = true;
         
         // Mise à jour de la couleur et de la date cible en dehors du contexte NVS
-        countdownColor = display.color565(colorR, colorG, colorB);
+        countdownColor = color565Corrected(colorR, colorG, colorB);
         countdownTarget = DateTime(year, month, day, hour, minute, second);
         
       } catch (...) {
@@ -1997,6 +1501,7 @@ void saveSettings() {
     vTaskDelay(pdMS_TO_TICKS(5)); // Petit délai avant réactivation
     display_update_enable(true);
   }
+  saveStatus = saved ? SAVE_DONE : SAVE_FAILED;
 }
 
 // Connexion WiFi
@@ -2041,60 +1546,253 @@ void set_ESP32_Access_Point() {
   Serial.print("AP IP : "); Serial.println(WiFi.softAPIP());
 }
 
-// Gestionnaire de la page principale
-void handleRoot() {
-  String page = MAIN_page;
-  page.replace("v__FWVER__", String(FIRMWARE_VERSION));
-  page.replace("__AUTHOR_NAME__", String(AUTHOR_NAME));
-  page.replace("__GITHUB_URL__", String(GITHUB_URL));
-  server.send(200, "text/html", page);
+// === Paramètres publiés (POST /api/settings) ===
+// Deux exemplaires de CountdownSettings : settingsSlots[settingsCurrent] est
+// la configuration publiée. Un corps JSON est appliqué à une copie dans
+// l'autre exemplaire, hors mutex ; s'il est valide, la publication est un
+// échange d'indice suivi de settingsSeq++. DisplayTask recopie ensuite la
+// configuration publiée dans les globales entre deux trames, en une seule
+// prise courte de countdownMutex : aucune mise à jour partielle n'est vue.
+// Écrivains : tâche AsyncTCP (/api/settings, /settings et /reset,
+// gestionnaires exécutés un à un) et setup().
+static_assert(sizeof(CountdownSettings::title) == sizeof(countdownTitle), "taille du titre");
+CountdownSettings settingsSlots[2];
+volatile uint8_t settingsCurrent = 0;
+volatile uint32_t settingsSeq = 0;        // incrémenté à chaque publication
+volatile uint32_t settingsAppliedSeq = 0; // publication recopiée dans les globales
+
+void settingsCapture(CountdownSettings &s) {
+  memcpy(s.title, countdownTitle, sizeof(s.title));
+  s.year = countdownYear; s.month = countdownMonth; s.day = countdownDay;
+  s.hour = countdownHour; s.minute = countdownMinute; s.second = countdownSecond;
+  s.fontStyle = fontStyle;
+  s.colorR = countdownColorR; s.colorG = countdownColorG; s.colorB = countdownColorB;
+  s.endColorR = endMessageColorR; s.endColorG = endMessageColorG; s.endColorB = endMessageColorB;
+  s.endEffect = endMessageEffect;
+  s.blinkEnabled = blinkEnabled;
+  s.blinkIntervalMs = blinkIntervalMs;
+  s.blinkWindow = blinkWindowSeconds;
+  s.marqueeEnabled = marqueeEnabled;
+  s.marqueeIntervalMs = marqueeIntervalMs;
+  s.marqueeGap = marqueeGap;
+  s.marqueeMode = marqueeMode;
+  s.marqueeReturnIntervalMs = marqueeReturnIntervalMs;
+  s.marqueeBouncePauseLeftMs = marqueeBouncePauseLeftMs;
+  s.marqueeBouncePauseRightMs = marqueeBouncePauseRightMs;
+  s.marqueeOneShotDelayMs = marqueeOneShotDelayMs;
+  s.marqueeOneShotStopCenter = marqueeOneShotStopCenter;
+  s.marqueeOneShotRestartSec = marqueeOneShotRestartSec;
+  s.marqueeAccelEnabled = marqueeAccelEnabled;
+  s.marqueeAccelStartIntervalMs = marqueeAccelStartIntervalMs;
+  s.marqueeAccelEndIntervalMs = marqueeAccelEndIntervalMs;
+  s.marqueeAccelDurationMs = marqueeAccelDurationMs;
+  s.brightness = displayBrightness;
+}
+
+// Republie les globales après une modification directe (loadSettings) :
+// elles sont déjà appliquées
+void settingsRepublish() {
+  const uint8_t next = settingsCurrent ^ 1;
+  settingsCapture(settingsSlots[next]);
+  __sync_synchronize();
+  settingsCurrent = next;
+  __sync_synchronize();
+  settingsAppliedSeq = ++settingsSeq;
+}
+
+// Publie la copie de travail settingsSlots[next] (gestionnaires HTTP) :
+// DisplayTask l'applique avant la trame suivante, sauvegarde différée
+void settingsPublish(uint8_t next) {
+  __sync_synchronize();
+  settingsCurrent = next;
+  __sync_synchronize();
+  settingsSeq++;
+  saveRequested = true;
+  saveRequestTime = millis();
+  saveStatus = SAVE_PENDING;
+}
+
+// Copie cohérente de la configuration publiée depuis une autre tâche :
+// nouvelle lecture si une publication a eu lieu pendant la copie
+bool settingsTakePublished(CountdownSettings &out, uint32_t &seq) {
+  for (uint8_t attempt = 0; attempt < 4; attempt++) {
+    seq = settingsSeq;
+    __sync_synchronize();
+    memcpy(&out, (const void *)&settingsSlots[settingsCurrent], sizeof(out));
+    __sync_synchronize();
+    if (settingsSeq == seq) return true;
+  }
+  return false;
+}
+
+// Recopie s dans les globales (countdownMutex tenu)
+void settingsApply(const CountdownSettings &s) {
+  const bool targetChanged = s.year != countdownYear || s.month != countdownMonth || s.day != countdownDay ||
+                             s.hour != countdownHour || s.minute != countdownMinute || s.second != countdownSecond;
+  if (s.marqueeMode != marqueeMode) marqueeOneShotDone = false;
+  memcpy(countdownTitle, s.title, sizeof(countdownTitle));
+  countdownYear = s.year; countdownMonth = s.month; countdownDay = s.day;
+  countdownHour = s.hour; countdownMinute = s.minute; countdownSecond = s.second;
+  fontStyle = s.fontStyle;
+  countdownColorR = s.colorR; countdownColorG = s.colorG; countdownColorB = s.colorB;
+  endMessageColorR = s.endColorR; endMessageColorG = s.endColorG; endMessageColorB = s.endColorB;
+  endMessageEffect = s.endEffect;
+  blinkEnabled = s.blinkEnabled;
+  blinkIntervalMs = s.blinkIntervalMs;
+  blinkWindowSeconds = s.blinkWindow;
+  marqueeEnabled = s.marqueeEnabled;
+  marqueeIntervalMs = s.marqueeIntervalMs;
+  marqueeGap = s.marqueeGap;
+  marqueeMode = s.marqueeMode;
+  marqueeReturnIntervalMs = s.marqueeReturnIntervalMs;
+  marqueeBouncePauseLeftMs = s.marqueeBouncePauseLeftMs;
+  marqueeBouncePauseRightMs = s.marqueeBouncePauseRightMs;
+  marqueeOneShotDelayMs = s.marqueeOneShotDelayMs;
+  marqueeOneShotStopCenter = s.marqueeOneShotStopCenter;
+  marqueeOneShotRestartSec = s.marqueeOneShotRestartSec;
+  marqueeAccelEnabled = s.marqueeAccelEnabled;
+  marqueeAccelStartIntervalMs = s.marqueeAccelStartIntervalMs;
+  marqueeAccelEndIntervalMs = s.marqueeAccelEndIntervalMs;
+  marqueeAccelDurationMs = s.marqueeAccelDurationMs;
+  displayBrightness = s.brightness;
+
+  countdownColor = color565Corrected(countdownColorR, countdownColorG, countdownColorB);
+  if (targetChanged) {
+    countdownTarget = DateTime(countdownYear, countdownMonth, countdownDay,
+                               countdownHour, countdownMinute, countdownSecond);
+    countdownExpired = false;
+  }
+  forceLayout = true;
+  applyBrightness();
+}
+
+// Applique la dernière publication si elle ne l'est pas encore (DisplayTask
+// entre deux trames)
+void settingsApplyPending() {
+  if (settingsSeq == settingsAppliedSeq) return;
+  static CountdownSettings published;  // appels sérialisés par countdownMutex
+  uint32_t seq;
+  MUTEX_GUARD(countdownMutex, MUTEX_TIMEOUT_FAST);
+  if (!guard_countdownMutex.isLocked()) return;
+  if (!settingsTakePublished(published, seq) || seq == settingsAppliedSeq) return;
+  settingsApply(published);
+  settingsAppliedSeq = seq;
+}
+
+// Gestionnaire de la page principale : version gzip (marqueurs remplacés à la
+// compilation) si le navigateur l'accepte, sinon page brute envoyée depuis la
+// flash par morceaux, marqueurs remplacés au passage (aucune copie en RAM)
+void handleRoot(AsyncWebServerRequest *request) {
+  if (webSendGzip(request, "text/html", MAIN_page_gz, MAIN_page_gz_len)) return;
+  static const WebTemplateField fields[] = {  // lus pendant l'envoi, après le retour du gestionnaire
+    { "v__FWVER__", FIRMWARE_VERSION },
+    { "__AUTHOR_NAME__", AUTHOR_NAME },
+    { "__GITHUB_URL__", GITHUB_URL },
+  };
+  webSendTemplate(request, 200, "text/html", MAIN_page, fields, sizeof(fields) / sizeof(fields[0]));
+}
+
+// Gestionnaire des paramètres actuels en JSON : configuration publiée
+// (settingsSlots), écrite dans un buffer fixe sans String temporaire
+// (JsonWriter.h). Les gestionnaires étant les seuls écrivains et exécutés un
+// à un, l'exemplaire publié ne change pas pendant l'écriture.
+#define SETTINGS_JSON_SIZE 1280
+void handleGetSettings(AsyncWebServerRequest *request) {
+  static char json[SETTINGS_JSON_SIZE]; // gestionnaires exécutés un à un (tâche AsyncTCP)
+  const size_t len = countdownSettingsToJson(settingsSlots[settingsCurrent], json, sizeof(json));
+  if (len == 0) {
+    request->send(500, "application/json", "{\"status\":\"ERR\",\"msg\":\"settings too large\"}");
+    return;
+  }
+  // La réponse asynchrone part après le retour du gestionnaire : elle garde sa
+  // propre copie (une seule allocation, taille exacte)
+  request->send(200, "application/json", json);
+}
+
+// Modification des paramètres en JSON : POST /api/settings avec les seuls
+// champs modifiés, {"marqueeGap":32,"title":"FIN"} (clés de /getSettings).
+// Le corps est appliqué à une copie de la configuration publiée, sans mutex,
+// puis validé en entier (CountdownSettings.h) : refusé, rien n'est modifié
+// (400 et message) ; accepté, la copie est publiée d'un échange d'indice et
+// DisplayTask l'applique avant la trame suivante.
+#define SETTINGS_PATCH_MAX 2048
+void handleApiSettingsBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+  if (index == 0) {
+    if (total > SETTINGS_PATCH_MAX) return;
+    request->_tempObject = malloc(total + 1); // libéré avec la requête
+  }
+  char *body = (char *)request->_tempObject;
+  if (body == nullptr || index + len > total) return;
+  memcpy(body + index, data, len);
+  if (index + len == total) body[total] = '\0';
+}
+
+void handleApiSettings(AsyncWebServerRequest *request) {
+  const char *body = (const char *)request->_tempObject;
+  if (body == nullptr) {
+    if (request->contentLength() > SETTINGS_PATCH_MAX) {
+      request->send(413, "application/json", "{\"status\":\"ERR\",\"msg\":\"body too large\"}");
+    } else {
+      request->send(400, "application/json", "{\"status\":\"ERR\",\"msg\":\"missing body\"}");
+    }
+    return;
+  }
+  const uint8_t next = settingsCurrent ^ 1;
+  CountdownSettings &staging = settingsSlots[next];
+  staging = settingsSlots[settingsCurrent];
+  char err[64];
+  const int n = countdownSettingsPatch(staging, body, request->contentLength(), err, sizeof(err));
+  char json[128];
+  JsonWriter w;
+  jsonBegin(w, json, sizeof(json));
+  if (n < 0) {
+    jsonAddString(w, "status", "ERR");
+    jsonAddString(w, "msg", err);
+    jsonEnd(w);
+    Serial.printf("[api/settings] rejected: %s\n", err);
+    request->send(400, "application/json", json);
+    return;
+  }
+  if (n > 0) settingsPublish(next);
+  jsonAddString(w, "status", "OK");
+  jsonAddInt(w, "fields", n);
+  jsonEnd(w);
+  Serial.printf("[api/settings] %d field(s) published\n", n);
+  request->send(200, "application/json", json);
 }
 
-// Gestionnaire des paramètres actuels en JSON
-void handleGetSettings() {
-  String json = "{";
-  json += "\"title\":\"" + String(countdownTitle) + "\",";
-  json += "\"year\":" + String(countdownYear) + ",";
-  json += "\"month\":" + String(countdownMonth) + ",";
-  json += "\"day\":" + String(countdownDay) + ",";
-  json += "\"hour\":" + String(countdownHour) + ",";
-  json += "\"minute\":" + String(countdownMinute) + ",";
-  json += "\"second\":" + String(countdownSecond) + ",";
-  json += "\"fontStyle\":" + String(fontStyle) + ",";
-  json += "\"colorR\":" + String(countdownColorR) + ",";
-  json += "\"colorG\":" + String(countdownColorG) + ",";
-  json += "\"colorB\":" + String(countdownColorB) + ",";
-  json += "\"blinkEnabled\":" + String(blinkEnabled ? 1 : 0) + ",";
-  json += "\"blinkIntervalMs\":" + String(blinkIntervalMs) + ",";
-  json += "\"blinkWindow\":" + String(blinkWindowSeconds) + ",";
-  json += "\"marqueeEnabled\":" + String(marqueeEnabled ? 1 : 0) + ",";
-  json += "\"marqueeIntervalMs\":" + String(marqueeIntervalMs) + ",";
-  json += "\"marqueeGap\":" + String(marqueeGap) + ",";
-  json += "\"marqueeMode\":" + String(marqueeMode) + ",";
-  json += "\"marqueeReturnIntervalMs\":" + String(marqueeReturnIntervalMs) + ",";
-  json += "\"marqueeBouncePauseLeftMs\":" + String(marqueeBouncePauseLeftMs) + ",";
-  json += "\"marqueeBouncePauseRightMs\":" + String(marqueeBouncePauseRightMs) + ",";
-  json += "\"marqueeOneShotDelayMs\":" + String(marqueeOneShotDelayMs) + ",";
-  json += "\"marqueeOneShotStopCenter\":" + String(marqueeOneShotStopCenter ? 1:0) + ",";
-  json += "\"marqueeOneShotRestartSec\":" + String(marqueeOneShotRestartSec) + ",";
-  json += "\"marqueeAccelEnabled\":" + String(marqueeAccelEnabled ? 1:0) + ",";
-  json += "\"marqueeAccelStartIntervalMs\":" + String(marqueeAccelStartIntervalMs) + ",";
-  json += "\"marqueeAccelEndIntervalMs\":" + String(marqueeAccelEndIntervalMs) + ",";
-  json += "\"marqueeAccelDurationMs\":" + String(marqueeAccelDurationMs);
-  json += ",\"brightness\":" + String(displayBrightness);
-  json += "}";
-  
-  server.send(200, "application/json", json);
+// Trame affichée, codée par plages (FrameSnapshot.h) : /frame?since=<n° de
+// trame> répond un delta de cette trame si possible. Lecture de l'image
+// miroir seulement : ni l'ISR ni la tâche d'affichage ne sont bloquées.
+// La première requête relance la recopie : 503 le temps d'une trame.
+// Instantané codé dans un buffer de la requête (recopié par la réponse) :
+// rien de réservé sans aperçu ouvert.
+#define FRAME_BLOB_SIZE FRAME_BLOB_MAX(TOTAL_WIDTH * TOTAL_HEIGHT)
+void handleFrame(AsyncWebServerRequest *request) {
+  uint32_t since = FRAME_SINCE_NONE;
+  if (request->hasArg("since")) since = strtoul(request->arg("since").c_str(), nullptr, 10);
+  uint8_t *blob = (uint8_t *)malloc(FRAME_BLOB_SIZE);
+  const size_t len = blob ? display.snapshot(blob, FRAME_BLOB_SIZE, since, millis()) : 0;
+  if (len == 0) {
+    free(blob);
+    request->send(503, "text/plain", "frame busy");
+    return;
+  }
+  AsyncResponseStream *response = request->beginResponseStream("application/octet-stream", len);
+  response->addHeader("Cache-Control", "no-store");
+  response->write(blob, len);
+  free(blob);
+  request->send(response);
 }
 
 // Synchronisation de l'heure depuis le navigateur (client envoie son epoch ms + offset minutes)
-void handleSyncTime() {
-  if (!server.hasArg("epoch")) {
-    server.send(400, "application/json", "{\"status\":\"ERR\",\"msg\":\"missing epoch\"}");
+void handleSyncTime(AsyncWebServerRequest *request) {
+  if (!request->hasArg("epoch")) {
+    request->send(400, "application/json", "{\"status\":\"ERR\",\"msg\":\"missing epoch\"}");
     return;
   }
-  String epochStr = server.arg("epoch");
-  String tzStr = server.hasArg("tz") ? server.arg("tz") : String("0");
+  String epochStr = request->arg("epoch");
+  String tzStr = request->hasArg("tz") ? request->arg("tz") : String("0");
   unsigned long long epochMs = strtoull(epochStr.c_str(), nullptr, 10);
   long tzMinutes = tzStr.toInt(); // JS getTimezoneOffset(): UTC = local + offset
   // epochMs est en UTC. Nous voulons régler le RTC sur l'heure locale perçue par l'utilisateur.
@@ -2104,7 +1802,7 @@ void handleSyncTime() {
   DateTime localDT(localSec);
   // Protection simple : vérifier année raisonnable
   if (localDT.year() < 2020 || localDT.year() > 2099) {
-    server.send(400, "application/json", "{\"status\":\"ERR\",\"msg\":\"invalid time\"}");
+    request->send(400, "application/json", "{\"status\":\"ERR\",\"msg\":\"invalid time\"}");
     return;
   }
   // Ajuster le RTC (mutex countdown pas nécessaire pour simple set, mais on peut briefer)
@@ -2113,280 +1811,248 @@ void handleSyncTime() {
   // Réponse
   String resp = "{\"status\":\"OK\",\"set\":\"";
   resp += String(localDT.year()) + "-" + String(localDT.month()) + "-" + String(localDT.day()) + "T" + String(localDT.hour()) + ":" + String(localDT.minute()) + ":" + String(localDT.second()) + "\"}";
-  server.send(200, "application/json", resp);
+  request->send(200, "application/json", resp);
   Serial.printf("RTC synchronized to client local time: %04d-%02d-%02d %02d:%02d:%02d (tz offset %ld mn)\n", localDT.year(), localDT.month(), localDT.day(), localDT.hour(), localDT.minute(), localDT.second(), tzMinutes);
 }
 
-// Gestionnaire des paramètres
-void handleSettings() {
+// Gestionnaire des paramètres (formulaire) : les champs reçus, ramenés dans
+// leurs bornes, sont écrits dans une copie de la configuration publiée puis
+// publiés comme /api/settings. Ni mutex ni timer : DisplayTask applique la
+// copie avant la trame suivante, luminosité comprise.
+void handleSettings(AsyncWebServerRequest *request) {
   Serial.println("\n-------------Settings");
 
-  // Désactiver temporairement le timer d'affichage pour éviter conflits ISR pendant mise à jour
-  bool displayTimerWasOn = (timer != nullptr);
-  if (displayTimerWasOn) {
-    Serial.println("[handleSettings] Pause display timer");
-    display_update_enable(false);
-  }
-
   // Récupérer les valeurs de la requête
-  String title = server.hasArg("title") ? server.arg("title") : String("");
-  String dateStr = server.hasArg("date") ? server.arg("date") : String("");
-  String timeStr = server.hasArg("time") ? server.arg("time") : String("");
+  String title = request->hasArg("title") ? request->arg("title") : String("");
+  String dateStr = request->hasArg("date") ? request->arg("date") : String("");
+  String timeStr = request->hasArg("time") ? request->arg("time") : String("");
 
   if (dateStr.length() < 10 || timeStr.length() < 5) {
-    server.send(400, "text/plain", "Parametres invalides");
+    request->send(400, "text/plain", "Parametres invalides");
     return;
   }
-  
+
+  const uint8_t next = settingsCurrent ^ 1;
+  CountdownSettings &s = settingsSlots[next];
+  s = settingsSlots[settingsCurrent];
+
   // Parser la date (format YYYY-MM-DD)
-  // Protéger modifications
-  if (countdownMutex != NULL && xSemaphoreTake(countdownMutex, pdMS_TO_TICKS(200))) {
-    countdownYear = dateStr.substring(0, 4).toInt();
-    countdownMonth = dateStr.substring(5, 7).toInt();
-    countdownDay = dateStr.substring(8, 10).toInt();
-  
+  s.year = dateStr.substring(0, 4).toInt();
+  s.month = dateStr.substring(5, 7).toInt();
+  s.day = dateStr.substring(8, 10).toInt();
+
   // Parser l'heure (format HH:MM:SS)
-  countdownHour = timeStr.substring(0, 2).toInt();
-  countdownMinute = timeStr.substring(3, 5).toInt();
-  countdownSecond = timeStr.length() > 5 ? timeStr.substring(6, 8).toInt() : 0;
-  
+  s.hour = timeStr.substring(0, 2).toInt();
+  s.minute = timeStr.substring(3, 5).toInt();
+  s.second = timeStr.length() > 5 ? timeStr.substring(6, 8).toInt() : 0;
+
   // Récupérer le style de police et la couleur
-  fontStyle = server.hasArg("fontStyle") ? server.arg("fontStyle").toInt() : fontStyle;
-  countdownColorR = server.hasArg("colorR") ? server.arg("colorR").toInt() : countdownColorR;
-  countdownColorG = server.hasArg("colorG") ? server.arg("colorG").toInt() : countdownColorG;
-  countdownColorB = server.hasArg("colorB") ? server.arg("colorB").toInt() : countdownColorB;
-  
+  if (request->hasArg("fontStyle")) s.fontStyle = request->arg("fontStyle").toInt();
+  if (request->hasArg("colorR")) s.colorR = request->arg("colorR").toInt();
+  if (request->hasArg("colorG")) s.colorG = request->arg("colorG").toInt();
+  if (request->hasArg("colorB")) s.colorB = request->arg("colorB").toInt();
+
   // Récupérer les paramètres du message de fin
-  if (server.hasArg("endColorR")) {
-    endMessageColorR = server.arg("endColorR").toInt();
+  if (request->hasArg("endColorR")) {
+    s.endColorR = request->arg("endColorR").toInt();
   }
-  if (server.hasArg("endColorG")) {
-    endMessageColorG = server.arg("endColorG").toInt();
+  if (request->hasArg("endColorG")) {
+    s.endColorG = request->arg("endColorG").toInt();
   }
-  if (server.hasArg("endColorB")) {
-    endMessageColorB = server.arg("endColorB").toInt();
+  if (request->hasArg("endColorB")) {
+    s.endColorB = request->arg("endColorB").toInt();
   }
-  if (server.hasArg("endEffect")) {
-    String effect = server.arg("endEffect");
-    if (effect == "static") endMessageEffect = 0;
-    else if (effect == "blink") endMessageEffect = 1;
-    else if (effect == "fade") endMessageEffect = 2;
-    else if (effect == "rainbow") endMessageEffect = 3;
+  if (request->hasArg("endEffect")) {
+    String effect = request->arg("endEffect");
+    if (effect == "static") s.endEffect = 0;
+    else if (effect == "blink") s.endEffect = 1;
+    else if (effect == "fade") s.endEffect = 2;
+    else if (effect == "rainbow") s.endEffect = 3;
   }
-  if (server.hasArg("blinkEnabled")) {
-    blinkEnabled = server.arg("blinkEnabled").toInt() != 0;
+  if (request->hasArg("blinkEnabled")) {
+    s.blinkEnabled = request->arg("blinkEnabled").toInt() != 0;
   }
-  if (server.hasArg("blinkInterval")) {
-    int bi = server.arg("blinkInterval").toInt();
+  if (request->hasArg("blinkInterval")) {
+    int bi = request->arg("blinkInterval").toInt();
     if (bi < 50) bi = 50; if (bi > 5000) bi = 5000; // bornes logiques
-    blinkIntervalMs = bi;
+    s.blinkIntervalMs = bi;
   }
-  if (server.hasArg("blinkWindow")) {
-    int bw = server.arg("blinkWindow").toInt();
+  if (request->hasArg("blinkWindow")) {
+    int bw = request->arg("blinkWindow").toInt();
     if (bw < 1) bw = 1; if (bw > 3600) bw = 3600;
-    blinkWindowSeconds = bw;
+    s.blinkWindow = bw;
   }
-  if (server.hasArg("marqueeEnabled")) {
-    marqueeEnabled = server.arg("marqueeEnabled").toInt() != 0;
-  forceLayout = true;
+  if (request->hasArg("marqueeEnabled")) {
+    s.marqueeEnabled = request->arg("marqueeEnabled").toInt() != 0;
   }
-  if (server.hasArg("marqueeInterval")) {
-    int mi = server.arg("marqueeInterval").toInt();
+  if (request->hasArg("marqueeInterval")) {
+    int mi = request->arg("marqueeInterval").toInt();
     if (mi < 5) mi = 5; if (mi > 500) mi = 500;
-    marqueeIntervalMs = mi;
-  forceLayout = true;
+    s.marqueeIntervalMs = mi;
   }
-  if (server.hasArg("marqueeGap")) {
-    int mg = server.arg("marqueeGap").toInt();
+  if (request->hasArg("marqueeGap")) {
+    int mg = request->arg("marqueeGap").toInt();
     if (mg < 4) mg = 4; if (mg > 256) mg = 256;
-    marqueeGap = mg;
-  forceLayout = true;
+    s.marqueeGap = mg;
   }
-  if (server.hasArg("marqueeMode")) {
-    int mm = server.arg("marqueeMode").toInt();
+  if (request->hasArg("marqueeMode")) {
+    int mm = request->arg("marqueeMode").toInt();
     if (mm < 0) mm = 0; if (mm > 3) mm = 3;
-    marqueeMode = mm;
-    // réinitialiser états spécifiques
-    marqueeOneShotDone = false;
-  forceLayout = true;
+    s.marqueeMode = mm;
   }
-  if (server.hasArg("marqueeReturnInterval")) {
-    int ri = server.arg("marqueeReturnInterval").toInt();
+  if (request->hasArg("marqueeReturnInterval")) {
+    int ri = request->arg("marqueeReturnInterval").toInt();
     if (ri < 5) ri = 5; if (ri > 500) ri = 500;
-    marqueeReturnIntervalMs = ri;
-  forceLayout = true;
+    s.marqueeReturnIntervalMs = ri;
   }
-  if (server.hasArg("marqueeBouncePauseLeft")) {
-    int bpL = server.arg("marqueeBouncePauseLeft").toInt();
+  if (request->hasArg("marqueeBouncePauseLeft")) {
+    int bpL = request->arg("marqueeBouncePauseLeft").toInt();
     if (bpL < 0) bpL = 0; if (bpL > 5000) bpL = 5000;
-    marqueeBouncePauseLeftMs = bpL;
-  forceLayout = true;
+    s.marqueeBouncePauseLeftMs = bpL;
   }
-  if (server.hasArg("marqueeBouncePauseRight")) {
-    int bpR = server.arg("marqueeBouncePauseRight").toInt();
+  if (request->hasArg("marqueeBouncePauseRight")) {
+    int bpR = request->arg("marqueeBouncePauseRight").toInt();
     if (bpR < 0) bpR = 0; if (bpR > 5000) bpR = 5000;
-    marqueeBouncePauseRightMs = bpR;
-  forceLayout = true;
+    s.marqueeBouncePauseRightMs = bpR;
   }
-  if (server.hasArg("marqueeOneShotDelay")) {
-    int od = server.arg("marqueeOneShotDelay").toInt();
+  if (request->hasArg("marqueeOneShotDelay")) {
+    int od = request->arg("marqueeOneShotDelay").toInt();
     if (od < 0) od = 0; if (od > 10000) od = 10000;
-    marqueeOneShotDelayMs = od;
-  forceLayout = true;
+    s.marqueeOneShotDelayMs = od;
   }
-  if (server.hasArg("marqueeOneShotStopCenter")) {
-    marqueeOneShotStopCenter = server.arg("marqueeOneShotStopCenter") == "1";
-  forceLayout = true;
+  if (request->hasArg("marqueeOneShotStopCenter")) {
+    s.marqueeOneShotStopCenter = request->arg("marqueeOneShotStopCenter") == "1";
   }
-  if (server.hasArg("marqueeOneShotRestart")) {
-    int rs = server.arg("marqueeOneShotRestart").toInt();
+  if (request->hasArg("marqueeOneShotRestart")) {
+    int rs = request->arg("marqueeOneShotRestart").toInt();
     if (rs < 0) rs = 0; if (rs > 86400) rs = 86400;
-    marqueeOneShotRestartSec = rs;
-  forceLayout = true;
+    s.marqueeOneShotRestartSec = rs;
   }
-  if (server.hasArg("marqueeAccelEnabled")) {
-    marqueeAccelEnabled = server.arg("marqueeAccelEnabled") == "1";
-  forceLayout = true;
+  if (request->hasArg("marqueeAccelEnabled")) {
+    s.marqueeAccelEnabled = request->arg("marqueeAccelEnabled") == "1";
   }
-  if (server.hasArg("marqueeAccelStart")) {
-    int as = server.arg("marqueeAccelStart").toInt();
-    if (as < 5) as = 5; if (as > 500) as = 500; marqueeAccelStartIntervalMs = as;
-  forceLayout = true;
+  if (request->hasArg("marqueeAccelStart")) {
+    int as = request->arg("marqueeAccelStart").toInt();
+    if (as < 5) as = 5; if (as > 500) as = 500; s.marqueeAccelStartIntervalMs = as;
   }
-  if (server.hasArg("marqueeAccelEnd")) {
-    int ae = server.arg("marqueeAccelEnd").toInt();
-    if (ae < 5) ae = 5; if (ae > 500) ae = 500; marqueeAccelEndIntervalMs = ae;
-  forceLayout = true;
+  if (request->hasArg("marqueeAccelEnd")) {
+    int ae = request->arg("marqueeAccelEnd").toInt();
+    if (ae < 5) ae = 5; if (ae > 500) ae = 500; s.marqueeAccelEndIntervalMs = ae;
   }
-  if (server.hasArg("marqueeAccelDuration")) {
-    int ad = server.arg("marqueeAccelDuration").toInt();
-    if (ad < 50) ad = 50; if (ad > 600000) ad = 600000; marqueeAccelDurationMs = ad;
-  forceLayout = true;
+  if (request->hasArg("marqueeAccelDuration")) {
+    int ad = request->arg("marqueeAccelDuration").toInt();
+    if (ad < 50) ad = 50; if (ad > 600000) ad = 600000; s.marqueeAccelDurationMs = ad;
   }
-  if (server.hasArg("brightness")) {
-    int b = server.arg("brightness").toInt();
+  if (request->hasArg("brightness")) {
+    int b = request->arg("brightness").toInt();
     if (b < -1) b = -1; if (b > 255) b = 255;
-    displayBrightness = b;
+    s.brightness = b;
   }
-  
+
   // Valider le style de police (0=Normal, 1=Gras, 2=Italique)
-  if (fontStyle < 0) fontStyle = 0;
-  if (fontStyle > 2) fontStyle = 2;
-  
+  if (s.fontStyle < 0) s.fontStyle = 0;
+  if (s.fontStyle > 2) s.fontStyle = 2;
+
   // Mettre à jour le titre
-    if (title.length() > 0) {
-      utf8SafeCopyTruncate(title, countdownTitle, sizeof(countdownTitle), 50);
-    }
-  
-  // Valider la date
-  if (countdownMonth < 1) countdownMonth = 1;
-  if (countdownMonth > 12) countdownMonth = 12;
-  if (countdownDay < 1) countdownDay = 1;
-  if (countdownDay > 31) countdownDay = 31;
-  
-  // Valider l'heure
-    if (countdownHour > 23) countdownHour = 23;
-    if (countdownMinute > 59) countdownMinute = 59;
-    if (countdownSecond > 59) countdownSecond = 59;
-
-    // Recalculer couleur immédiate (affichage plus réactif)
-    countdownColor = display.color565(countdownColorR, countdownColorG, countdownColorB);
-    // Mettre à jour cible localement pour affichage avant sauvegarde
-    countdownTarget = DateTime(countdownYear, countdownMonth, countdownDay, 
-                               countdownHour, countdownMinute, countdownSecond);
-    xSemaphoreGive(countdownMutex);
-  } else {
-    Serial.println("Could not get countdown mutex in handleSettings");
+  if (title.length() > 0) {
+    utf8SafeCopyTruncate(title, s.title, sizeof(s.title), 50);
   }
-  
-  // Sauvegarder les paramètres (demander la sauvegarde plutôt que de la faire directement)
-  saveRequested = true;
-  saveRequestTime = millis();
 
-  // Ajuster luminosité immédiatement
-  int effectiveBrightness;
-  if (displayBrightness < 0) {
-    effectiveBrightness = 150;
-    if (MATRIX_PANELS_X > 2) effectiveBrightness = 100;
-    if (MATRIX_PANELS_X > 4) effectiveBrightness = 80;
-    if (MATRIX_PANELS_X > 6) effectiveBrightness = 60;
-  } else {
-    effectiveBrightness = displayBrightness;
-  }
-  display.setBrightness(effectiveBrightness);
-  
-  Serial.println("Settings updated:");
-  Serial.printf("Target: %d-%02d-%02d %02d:%02d:%02d\n", 
-                countdownYear, countdownMonth, countdownDay,
-                countdownHour, countdownMinute, countdownSecond);
-  Serial.printf("Title: %s\n", countdownTitle);
+  // Valider la date (plage de DateTime)
+  if (s.year < 2000) s.year = 2000;
+  if (s.year > 2099) s.year = 2099;
+  if (s.month < 1) s.month = 1;
+  if (s.month > 12) s.month = 12;
+  if (s.day < 1) s.day = 1;
+  if (s.day > countdownDaysInMonth(s.year, s.month)) s.day = countdownDaysInMonth(s.year, s.month);
+
+  // Valider l'heure
+  if (s.hour < 0) s.hour = 0;
+  if (s.hour > 23) s.hour = 23;
+  if (s.minute < 0) s.minute = 0;
+  if (s.minute > 59) s.minute = 59;
+  if (s.second < 0) s.second = 0;
+  if (s.second > 59) s.second = 59;
+
+  settingsPublish(next);
+
+  Serial.println("Settings published:");
+  Serial.printf("Target: %d-%02d-%02d %02d:%02d:%02d\n",
+                s.year, s.month, s.day, s.hour, s.minute, s.second);
+  Serial.printf("Title: %s\n", s.title);
   const char* fontStyleNames[] = {"Normal", "Gras", "Italique"};
-  Serial.printf("Font: DejaVu %s (taille automatique)\n", fontStyleNames[fontStyle]);
-  Serial.printf("Color (RGB): %d,%d,%d\n", countdownColorR, countdownColorG, countdownColorB);
-  Serial.printf("Blink: enabled=%d interval=%dms window=%ds\n", blinkEnabled, blinkIntervalMs, blinkWindowSeconds);
+  Serial.printf("Font: DejaVu %s (taille automatique)\n", fontStyleNames[s.fontStyle]);
+  Serial.printf("Color (RGB): %d,%d,%d\n", s.colorR, s.colorG, s.colorB);
+  Serial.printf("Blink: enabled=%d interval=%dms window=%ds\n", s.blinkEnabled, s.blinkIntervalMs, s.blinkWindow);
   Serial.printf("Marquee: en=%d mode=%d fwdInt=%d retInt=%d gap=%d LPause=%d RPause=%d accel=%d start=%d end=%d dur=%d oneDelay=%d oneStopC=%d oneRst=%d\n",
-    marqueeEnabled, marqueeMode, marqueeIntervalMs, marqueeReturnIntervalMs, marqueeGap,
-    marqueeBouncePauseLeftMs, marqueeBouncePauseRightMs, marqueeAccelEnabled?1:0,
-    marqueeAccelStartIntervalMs, marqueeAccelEndIntervalMs, marqueeAccelDurationMs,
-    marqueeOneShotDelayMs, marqueeOneShotStopCenter?1:0, marqueeOneShotRestartSec);
-  Serial.printf("Brightness setting: %d ( -1 = auto )\n", displayBrightness);
-  
-  // Répondre avec une redirection vers la page principale
-  server.sendHeader("Location", "/", true);
-  server.send(302, "text/plain", "");
+    s.marqueeEnabled, s.marqueeMode, s.marqueeIntervalMs, s.marqueeReturnIntervalMs, s.marqueeGap,
+    s.marqueeBouncePauseLeftMs, s.marqueeBouncePauseRightMs, s.marqueeAccelEnabled?1:0,
+    s.marqueeAccelStartIntervalMs, s.marqueeAccelEndIntervalMs, s.marqueeAccelDurationMs,
+    s.marqueeOneShotDelayMs, s.marqueeOneShotStopCenter?1:0, s.marqueeOneShotRestartSec);
+  Serial.printf("Brightness setting: %d ( -1 = auto )\n", s.brightness);
 
-  // Réactiver timer si nécessaire
-  if (displayTimerWasOn) {
-    Serial.println("[handleSettings] Resume display timer");
-    display_update_enable(true);
-    // Forcer un redraw complet
-    forceLayout = true;
-  }
+  // Répondre avec une redirection vers la page principale
+  request->redirect("/");
 }
 
-// Gestionnaire de reset
-void handleReset() {
-  // Vérification clé supprimée
+// Gestionnaire de reset : valeurs par défaut publiées comme /settings
+void handleReset(AsyncWebServerRequest *request) {
+  const uint8_t next = settingsCurrent ^ 1;
+  CountdownSettings &s = settingsSlots[next];
+  s = settingsSlots[settingsCurrent];
 
   // Réinitialiser aux valeurs par défaut
-  if (countdownMutex != NULL && xSemaphoreTake(countdownMutex, pdMS_TO_TICKS(200))) {
-    countdownYear = 2025;
-    countdownMonth = 12;
-    countdownDay = 31;
-    countdownHour = 23;
-    countdownMinute = 59;
-    countdownSecond = 0;
-    strcpy(countdownTitle, "COUNTDOWN");
-    fontStyle = 0; // Normal par défaut
-    countdownColorR = 0;
-    countdownColorG = 255;
-    countdownColorB = 0;
-    countdownColor = display.color565(countdownColorR, countdownColorG, countdownColorB);
-    countdownTarget = DateTime(countdownYear, countdownMonth, countdownDay, 
-                               countdownHour, countdownMinute, countdownSecond);
-    xSemaphoreGive(countdownMutex);
-  }
-  
-  // Sauvegarder les paramètres (demander la sauvegarde plutôt que de la faire directement)
-  saveRequested = true;
-  saveRequestTime = millis();
-  
+  s.year = 2025;
+  s.month = 12;
+  s.day = 31;
+  s.hour = 23;
+  s.minute = 59;
+  s.second = 0;
+  strcpy(s.title, "COUNTDOWN");
+  s.fontStyle = 0; // Normal par défaut
+  s.colorR = 0;
+  s.colorG = 255;
+  s.colorB = 0;
+  settingsPublish(next);
+
   Serial.println("Settings reset to defaults");
-  
+
   // Répondre avec une redirection vers la page principale
-  server.sendHeader("Location", "/", true);
-  server.send(302, "text/plain", "");
+  request->redirect("/");
 }
 
 // Configuration et démarrage du serveur
 void prepare_and_start_The_Server() {
-  dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
-  server.on("/", handleRoot);
+  if (!useStationMode && !captiveDnsBegin(captiveDns, DNS_PORT, WiFi.softAPIP())) {
+    Serial.println("Captive DNS start failed");
+  }
+  server.on("/", HTTP_GET, handleRoot);
   server.on("/settings", HTTP_POST, handleSettings);
-  server.on("/getSettings", handleGetSettings);
+  server.on("/getSettings", HTTP_GET, handleGetSettings);
+  server.on("/api/settings", HTTP_POST, handleApiSettings, nullptr, handleApiSettingsBody);
+  server.on("/frame", HTTP_GET, handleFrame);
   server.on("/syncTime", HTTP_GET, handleSyncTime);
   server.on("/reset", HTTP_POST, handleReset);
-  server.onNotFound([]() { server.sendHeader("Location", "/", true); server.send(302, "text/plain", ""); });
+  server.on("/refresh", HTTP_GET, [](AsyncWebServerRequest *request) {
+    char json[200];
+    refreshSchedulerToJson(refreshScheduler, json, sizeof(json));
+    request->send(200, "application/json", json);
+  });
+  server.on("/layout", HTTP_GET, [](AsyncWebServerRequest *request) {
+    char json[96];
+    textLayoutCacheToJson(countdownLayouts, json, sizeof(json));
+    request->send(200, "application/json", json);
+  });
+#if ISR_METRICS
+  server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+    static IsrMetricsScratch scratch;
+    char json[320];
+    isrMetricsToJson(isrMetricsReport(isrMetrics, scratch), json, sizeof(json));
+    request->send(200, "application/json", json);
+  });
+#endif
+  server.addHandler(&events);
+  server.onNotFound([](AsyncWebServerRequest *request) { request->redirect("/"); });
   server.begin();
   Serial.println("HTTP server started (fast)");
   if (useStationMode) {
@@ -2397,20 +2063,81 @@ void prepare_and_start_The_Server() {
 }
 
 // Fonction de callback pour le timer d'affichage
+// Ligne que balaiera le prochain display() : suit le compteur interne de
+// PxMatrix, display_updater étant le seul appelant de display()
+volatile uint8_t displayScanRow = 0;
+
 void IRAM_ATTR display_updater() {
   // Vérification rapide de la validité avant d'entrer en section critique
   if (timer == nullptr) {
     return; // Timer désactivé
   }
   
+  uint32_t isrStart = ISR_CYCLES();
   portENTER_CRITICAL_ISR(&timerMux);
   // Double vérification dans la section critique
   if (timer != nullptr) {
+    // Bascule du double buffer seulement avant l'appel qui balaie la ligne 0 :
+    // chaque balayage du panneau lit ainsi un seul buffer
+    if (frameSwapPending && displayScanRow == 0) {
+      display.showBuffer();
+      frameSwapPending = false;
+    }
     display.display(display_draw_time);
+    if (++displayScanRow >= DISPLAY_ROW_PATTERN) displayScanRow = 0;
+    uint32_t isrEnd = ISR_CYCLES();
+    refreshSchedulerRecordIsr(refreshScheduler, isrEnd - isrStart);
+    ISR_METRICS_RECORD(isrMetrics, isrStart, isrEnd);
   }
   portEXIT_CRITICAL_ISR(&timerMux);
 }
 
+// Ajustement périodique de la période du timer et du draw time (DisplayTask)
+void refreshSchedulerUpdate() {
+  uint32_t now = millis();
+  if (!refreshSchedulerDue(refreshScheduler, now)) return;
+  portENTER_CRITICAL(&timerMux);
+  RefreshWindow window = refreshSchedulerSnapshot(refreshScheduler);
+  portEXIT_CRITICAL(&timerMux);
+  if (refreshSchedulerApply(refreshScheduler, window, now)) {
+    display_draw_time = refreshScheduler.drawTime;
+    if (timer != nullptr) timerAlarmWrite(timer, refreshScheduler.periodUs, true);
+#if ISR_METRICS
+    isrMetricsSetPeriod(isrMetrics, refreshScheduler.periodUs);
+#endif
+    Serial.printf("[Refresh] period %u us, draw time %u, %.0f Hz (ISR avg %u us, max %u us, backoff %u)\n",
+                  (unsigned)refreshScheduler.periodUs, display_draw_time, refreshScheduler.achievedHz,
+                  (unsigned)refreshScheduler.isrAvgUs, (unsigned)refreshScheduler.isrMaxUs,
+                  refreshScheduler.backoff);
+  }
+}
+
+// Attente de la bascule de la trame précédente par display_updater (au plus
+// DISPLAY_ROW_PATTERN périodes du timer). Sans timer actif (sauvegarde NVS,
+// démarrage) ou si l'ISR ne tourne plus, la bascule est faite ici.
+void waitFrameSwap() {
+  uint32_t start = millis();
+  while (frameSwapPending) {
+    if (timer == nullptr || millis() - start > 50) {
+      portENTER_CRITICAL(&timerMux);
+      if (frameSwapPending) {
+        display.showBuffer();
+        frameSwapPending = false;
+      }
+      portEXIT_CRITICAL(&timerMux);
+      break;
+    }
+    vTaskDelay(1);
+  }
+}
+
+// Publication du buffer arrière : appliquée par l'ISR à la prochaine trame
+// (et à l'aperçu web, via l'image miroir)
+void presentFrame() {
+  display.publishFrame();
+  frameSwapPending = true;
+}
+
 // Activation/désactivation du timer d'affichage
 void display_update_enable(bool is_enable) {
   if (is_enable) {
@@ -2418,7 +2145,7 @@ void display_update_enable(bool is_enable) {
       timer = timerBegin(0, 80, true);
       if (timer != nullptr) {
         timerAttachInterrupt(timer, &display_updater, true);
-        timerAlarmWrite(timer, 4000, true);
+        timerAlarmWrite(timer, refreshScheduler.periodUs, true);
         timerAlarmEnable(timer);
         Serial.println("Display timer enabled");
       } else {
@@ -2467,7 +2194,7 @@ void setup() {
   Serial.println("RTC initialized successfully");
   
   // Initialisation de l'affichage avec configuration P10 optimisée
-  display.begin(4); // 1/8 scan pour P10
+  display.begin(DISPLAY_ROW_PATTERN); // 1/8 scan pour P10
   display.setScanPattern(ZAGZIG);
   display.setMuxPattern(BINARY); 
   const int muxdelay = 10; // Délai de multiplexage
@@ -2480,14 +2207,24 @@ void setup() {
   if (MATRIX_PANELS_X > 4) brightness = 80;
   if (MATRIX_PANELS_X > 6) brightness = 60;
   
-  display.setBrightness(brightness);
+  display.setBrightness(colorGammaApplyBrightness(brightness));
   Serial.printf("Brightness set to: %d\n", brightness);
   
+  // Période et draw time initiaux (4000 us comme avant), ajustés ensuite en continu
+  refreshSchedulerInit(refreshScheduler, MATRIX_PANELS_X * MATRIX_PANELS_Y, 4000, millis(), ESP.getCpuFreqMHz());
+  display_draw_time = refreshScheduler.drawTime;
+#if ISR_METRICS
+  isrMetricsInit(isrMetrics, ESP.getCpuFreqMHz(), refreshScheduler.periodUs);
+#endif
+  Serial.printf("Refresh target: %u Hz, ISR budget %u%%, draw time %u\n",
+                refreshScheduler.profile.targetHz, refreshScheduler.profile.cpuBudgetPct, display_draw_time);
+  
   display.setTextWrap(false);
   display.setRotation(0);
   
   // Chargement des paramètres
   loadSettings();
+  settingsRepublish(); // configuration publiée de départ (/getSettings, /api/settings)
   // Affichage initial (y compris si déjà expiré au démarrage)
   {
     int d=0,h=0,m=0,s=0;
@@ -2585,7 +2322,20 @@ void DisplayTask(void * parameter) {
   
   int prevSeconds = -1, prevMinutes = -1, prevHours = -1, prevDays = -1;
   bool prevExpired = false;
+  uint32_t baseDelay = 150;
+  uint32_t lastLoop = millis();
   for(;;) {
+    // Intervalle réel vs délai demandé : signale une famine à l'ordonnanceur
+    uint32_t loopStart = millis();
+    refreshSchedulerTaskLoop(refreshScheduler, baseDelay, loopStart - lastLoop);
+    lastLoop = loopStart;
+    // Paramètres publiés par /api/settings : appliqués entre deux trames
+    settingsApplyPending();
+    // Aperçu /frame ouvert depuis peu : miroirs périmés, tout redessiner
+    if (display.updateMirroring(loopStart)) {
+      forceLayout = true;
+      prevSeconds = -1;
+    }
     // Utiliser MUTEX_GUARD avec timeout optimisé pour l'affichage
     {
       MUTEX_GUARD(displayMutex, MUTEX_TIMEOUT_FAST);
@@ -2605,21 +2355,27 @@ void DisplayTask(void * parameter) {
       }
     }
     
+    refreshSchedulerUpdate();
+    
     // Fréquence un peu plus élevée si marquee actif pour fluidité, sinon économe
-    uint32_t baseDelay = marqueeActive ? 40 : 150;
+    baseDelay = marqueeActive ? 40 : 150;
     if (blinkLastSeconds && baseDelay > 50) baseDelay = 50;
     vTaskDelay(pdMS_TO_TICKS(baseDelay));
   }
 }
 
-// Tâche combinée réseau + web
+// Tâche réseau : surveillance WiFi et retard des tâches. HTTP (AsyncTCP) et
+// DNS captif (AsyncUDP) sont traités à la réception, sans scrutation ici.
+#define NETWEB_PERIOD_MS 50
 void NetWebTask(void * parameter) {
   vTaskDelay(pdMS_TO_TICKS(1200));
   Serial.println("NetWeb task started on core " + String(xPortGetCoreID()));
   uint32_t lastReconnectCheck = 0;
+  uint32_t lastLoop = millis();
   for(;;) {
-    dnsServer.processNextRequest();
-    server.handleClient();
+    uint32_t loopStart = millis();
+    refreshSchedulerTaskLoop(refreshScheduler, NETWEB_PERIOD_MS, loopStart - lastLoop);
+    lastLoop = loopStart;
     if (useStationMode) {
       uint32_t now = millis();
       if (WiFi.status() != WL_CONNECTED && now - lastReconnectCheck > 5000) {
@@ -2628,16 +2384,41 @@ void NetWebTask(void * parameter) {
         WiFi.reconnect();
       }
     }
-    vTaskDelay(pdMS_TO_TICKS(5));
+    vTaskDelay(pdMS_TO_TICKS(NETWEB_PERIOD_MS));
   }
 }
 
+// Flux SSE /events : enregistrement compact sérialisé une seule fois par envoi,
+// le même message part vers tous les clients (coût indépendant de leur nombre).
+// {"r":secondes restantes,"x":expiré,"m":position du marquee,"b":luminosité
+// (-1 = auto),"s":sauvegarde (0 rien, 1 demandée, 2 faite, 3 échec)}
+// Appelé uniquement depuis CountdownTask : buffer statique sans concurrence.
+// La tâche AsyncTCP ajoute et retire les clients pendant ce temps :
+// ESP32Async/ESPAsyncWebServer parcourt la liste sous verrou dans send() et
+// count() (la version me-no-dev ne la protégeait pas).
+#define LIVE_PUSH_INTERVAL_MS 1000
+void pushLiveState(int32_t remaining) {
+  if (events.count() == 0) return;
+  static char json[96];
+  static uint32_t seq = 0;
+  JsonWriter w;
+  jsonBegin(w, json, sizeof(json));
+  jsonAddInt(w, "r", remaining);
+  jsonAddInt(w, "x", countdownExpired ? 1 : 0);
+  jsonAddInt(w, "m", marqueeOffset);
+  jsonAddInt(w, "b", displayBrightness);
+  jsonAddInt(w, "s", saveStatus);
+  if (jsonEnd(w)) events.send(json, "state", ++seq);
+}
+
 // Tâche de gestion du compte à rebours
 void CountdownTask(void * parameter) {
   // Attendre que le RTC soit prêt
   vTaskDelay(pdMS_TO_TICKS(1500));
   
   Serial.println("Countdown task started on core " + String(xPortGetCoreID()));
+  int32_t remaining = 0;
+  uint32_t lastLivePush = 0;
   
   for(;;) {
     // Vérifier s'il faut sauvegarder les paramètres (avec délai de sécurité)
@@ -2650,6 +2431,7 @@ void CountdownTask(void * parameter) {
         vTaskDelay(pdMS_TO_TICKS(100));
         saveSettings();
         Serial.println("Settings saved from CountdownTask");
+        pushLiveState(remaining); // fin de sauvegarde signalée sans attendre la seconde suivante
       } else {
         Serial.println("Unsafe context - delaying save");
         saveRequested = true; // Re-programmer la sauvegarde
@@ -2666,20 +2448,50 @@ void CountdownTask(void * parameter) {
           if (now >= countdownTarget) {
             countdownExpired = true;
           }
+          remaining = countdownExpired ? 0 : (countdownTarget - now).totalseconds();
+          if (remaining < 0) remaining = 0;
         } else {
           Serial.println("RTC read error!");
         }
       }
     }
+    if (millis() - lastLivePush >= LIVE_PUSH_INTERVAL_MS) {
+      lastLivePush = millis();
+      pushLiveState(remaining);
+    }
     vTaskDelay(pdMS_TO_TICKS(100));
   }
 }
 
 // Ancienne NetworkTask fusionnée dans NetWebTask
 
+// Commandes série : METRICS (synthèse de l'ISR d'affichage), METRICS RESET
+void serialCommands() {
+  if (!Serial.available()) return;
+  String cmd = Serial.readStringUntil('\n');
+  cmd.trim();
+  cmd.toUpperCase();
+#if ISR_METRICS
+  if (cmd == "METRICS") {
+    static IsrMetricsScratch scratch;
+    char text[320];
+    isrMetricsToText(isrMetricsReport(isrMetrics, scratch), text, sizeof(text));
+    Serial.print(text);
+  } else if (cmd == "METRICS RESET") {
+    portENTER_CRITICAL(&timerMux);
+    isrMetricsReset(isrMetrics);
+    portEXIT_CRITICAL(&timerMux);
+    Serial.println("ISR metrics reset");
+  }
+#else
+  if (cmd.startsWith("METRICS")) Serial.println("ISR metrics disabled (ISR_METRICS=0)");
+#endif
+}
+
 void loop() {
   // Surveillance du système et pause pour éviter les problèmes de watchdog
   systemWatchdog();
+  serialCommands();
   
   // Les tâches FreeRTOS gèrent tout le travail
   vTaskDelay(pdMS_TO_TICKS(1000));
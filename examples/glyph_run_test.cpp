@@ -0,0 +1,200 @@
+/**
+ * Test natif (PC) des runs de glyphes (src/GlyphRun.h)
+ *
+ * 1. glyphRunBuild() sur des titres UTF-8 (accents, ponctuation
+ *    typographique, émojis, séquences invalides) doit donner la même boîte
+ *    que getTextBounds() et la même image que print() du texte Latin-1
+ *    attendu, pour les trois polices DejaVu 9 pt et pour une police limitée
+ *    à l'ASCII (repli sans accents).
+ * 2. glyphRunMeasure() == getTextBounds() pour chaque taille des familles
+ *    DejaVu (run construit une seule fois avec la plus petite taille).
+ * 3. Run plein (GLYPH_RUN_MAX glyphes) : texte tronqué sans débordement.
+ * 4. Temps par trame : conversion + comparaison + mesure + tracé à chaque
+ *    trame contre tracé du run en cache (effacement de l'écran exclu).
+ *
+ * Lancement : pio run -e native_glyph_run_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#include "DejaVuSansOblique9ptLat1.h"
+#define FONT_FAMILY_MAX_HEIGHT 32
+#include "fonts/DejaVuFontFamily.h"
+#include "NativeCheck.h"
+
+// Police DejaVu réduite à 0x20-0x7E : exerce le repli sans accents
+static const GFXfont DejaVuSansAscii = {
+  DejaVuSans9ptLat1.bitmap, DejaVuSans9ptLat1.glyph, 0x20, 0x7E, DejaVuSans9ptLat1.yAdvance
+};
+
+struct TestFont {
+  const char *name;
+  const GFXfont *font;
+  bool ascii;
+};
+
+static const TestFont fonts[] = {
+  { "DejaVuSans", &DejaVuSans9ptLat1, false },
+  { "DejaVuSans Bold", &DejaVuSans_Bold9pt8b, false },
+  { "DejaVuSans Oblique", &DejaVuSans_Oblique9pt8b, false },
+  { "DejaVuSans ASCII", &DejaVuSansAscii, true },
+};
+
+// Titre UTF-8, texte attendu pour une police Latin-1, puis pour une police ASCII
+struct TestText {
+  const char *utf8;
+  const char *latin1;
+  const char *ascii;
+};
+
+static const TestText texts[] = {
+  { "COUNTDOWN", "COUNTDOWN", "COUNTDOWN" },
+  { "FIN !", "FIN !", "FIN !" },
+  { "BONNE ANN\xC3\x89" "E 2026 !", "BONNE ANN\xC9" "E 2026 !", "BONNE ANNEE 2026 !" },
+  { "\xC3\x89t\xC3\xA9 \xC3\xA0 l\xE2\x80\x99\xC3\xA9" "cole\xE2\x80\xA6",
+    "\xC9t\xE9 \xE0 l'\xE9" "cole...", "Ete a l'ecole..." },
+  { "\xE2\x80\x9C" "No\xC3\xABl\xE2\x80\x9D \xE2\x80\x93 f\xC3\xAAtes",
+    "\"No\xEBl\" - f\xEAtes", "\"Noel\" - fetes" },
+  { "Gar\xC3\xA7on \xC3\x87" "a \xC3\x94 \xC3\xB9", "Gar\xE7on \xC7" "a \xD4 \xF9", "Garcon Ca O u" },
+  { "50 \xE2\x82\xAC \xC2\xB0 \xC2\xB5", "50 ? \xB0 \xB5", "50 ? ? ?" },   // € hors Latin-1
+  { "F\xC3\xAAte \xF0\x9F\x8E\x89 !", "F\xEAte ? !", "Fete ? !" },            // émoji 4 octets
+  { "a\xC3" "b\x80" "c\xE2\x82", "a?b?c??", "a?b?c??" },                    // séquences invalides
+  { "ligne\ncontr\xC3\xB4le\r", "lignecontr\xF4le", "lignecontrole" },     // codes de contrôle ignorés
+  { "", "", "" },
+};
+
+#define W 96
+#define H 16
+static PxMATRIX display(W, H, 5, 4, 19, 23, 18);
+static uint16_t expected[W * H];
+
+static bool sameBounds(const GlyphRun &run, const GFXfont *font, const char *text) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  display.setFont(font);
+  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  return run.w == w && run.h == h && (w == 0 || run.x1 == x1) && (h == 0 || run.y1 == y1);
+}
+
+static void checkText(const TestFont &f, const TestText &t) {
+  const char *text = f.ascii ? t.ascii : t.latin1;
+  GlyphRun run;
+  glyphRunBuild(run, t.utf8, f.font);
+  CHECK(run.length == strlen(text), "%s \"%s\" : %u glyphes / %u", f.name, text, run.length, (unsigned)strlen(text));
+  CHECK(sameBounds(run, f.font, text), "%s \"%s\" : boite differente de getTextBounds", f.name, text);
+
+  static const int16_t positions[][2] = { { 2, 13 }, { -7, 12 }, { W - 20, 12 }, { 10, 4 }, { 10, H + 3 } };
+  for (const auto &p : positions) {
+    display.fillScreen(0);
+    display.setFont(f.font);
+    display.setTextColor(0xFD20);
+    display.setCursor(p[0], p[1]);
+    display.print(text);
+    int16_t refX = display.getCursorX();
+    memcpy(expected, display.framebuffer(), sizeof(expected));
+    display.fillScreen(0);
+    int16_t x = glyphRunDraw(display, p[0], p[1], run, f.font, 0xFD20);
+    CHECK(x == refX && memcmp(display.framebuffer(), expected, sizeof(expected)) == 0,
+          "%s \"%s\" en (%d,%d) : image differente de print()", f.name, text, p[0], p[1]);
+  }
+}
+
+// Conversion vers un buffer Latin-1, comme utf8ToLatin1 (ancien chemin de rendu)
+static void toLatin1(const char *in, char *out, size_t outSize) {
+  size_t o = 0;
+  for (const uint8_t *s = (const uint8_t *)in; *s && o + 1 < outSize;) {
+    uint32_t code = glyphRunNextCodePoint(s);
+    const char *r = (code <= 0xFF) ? nullptr : glyphRunSubstitute(code);
+    if (!r) out[o++] = (char)code;
+    else while (*r && o + 1 < outSize) out[o++] = *r++;
+  }
+  out[o] = '\0';
+}
+
+int main() {
+  printf("=== Runs de glyphes (decodage UTF-8 + mesure en un passage) ===\n");
+  display.setTextWrap(false);
+
+  for (const TestFont &f : fonts) {
+    int before = failures;
+    for (const TestText &t : texts) checkText(f, t);
+    printf("%-20s %2u titres x 5 positions : %s\n", f.name, (unsigned)(sizeof(texts) / sizeof(texts[0])),
+           failures == before ? "identique a print()" : "ECHEC");
+  }
+
+  // Re-mesure pour chaque taille de la famille
+  const FontFamily *families[] = { &DejaVuSansFamily, &DejaVuSansBoldFamily, &DejaVuSansObliqueFamily };
+  int before = failures;
+  for (const FontFamily *family : families) {
+    for (const TestText &t : texts) {
+      GlyphRun run;
+      glyphRunBuild(run, t.utf8, family->entries[0].font);
+      for (uint8_t i = 0; i < family->count; i++) {
+        glyphRunMeasure(run, family->entries[i].font);
+        CHECK(sameBounds(run, family->entries[i].font, t.latin1), "famille %u pt \"%s\" : boite differente",
+              family->entries[i].points, t.latin1);
+      }
+    }
+  }
+  printf("%-20s 3 familles, %u tailles : %s\n", "glyphRunMeasure", DejaVuSansFamily.count,
+         failures == before ? "OK" : "ECHEC");
+
+  // Run plein : troncature à GLYPH_RUN_MAX glyphes (points de suspension compris)
+  char longText[4 * GLYPH_RUN_MAX];
+  longText[0] = '\0';
+  for (int i = 0; i < GLYPH_RUN_MAX; i++) strcat(longText, "\xE2\x80\xA6");
+  GlyphRun full;
+  glyphRunBuild(full, longText, &DejaVuSans9ptLat1);
+  bool allDots = full.length == GLYPH_RUN_MAX;
+  for (uint8_t i = 0; i < full.length; i++) allDots = allDots && full.glyph[i] == '.' - DejaVuSans9ptLat1.first;
+  CHECK(allDots, "run plein : %u glyphes", full.length);
+  printf("%-20s %u glyphes : %s\n", "troncature", full.length, allDots ? "OK" : "ECHEC");
+
+  // Coût par trame : préparation du texte (ancien chemin, à chaque trame) et
+  // construction du run (au changement de titre seulement), puis tracé
+  const char *title = texts[3].utf8;
+  const GFXfont *font = &DejaVuSans_Bold9pt8b;
+  const uint32_t loops = 100000;
+  static char lastText[64];
+  char currentText[64];
+  int16_t x1 = 0, y1 = 0;
+  uint16_t w = 0, h = 0;
+  display.setFont(font);
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    toLatin1(title, currentText, sizeof(currentText));
+    if (strcmp(currentText, lastText) != 0) strcpy(lastText, currentText);
+    display.getTextBounds(currentText, 0, 0, &x1, &y1, &w, &h);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  GlyphRun run;
+  for (uint32_t i = 0; i < loops; i++) glyphRunBuild(run, title, font);
+  auto t2 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    glyphSpanPrint(display, (W - w) / 2 - x1, (H - h) / 2 - y1, currentText, font, 1, 0xFD20);
+  }
+  auto t3 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    glyphRunDraw(display, (W - run.w) / 2 - run.x1, (H - run.h) / 2 - run.y1, run, font, 0xFD20);
+  }
+  auto t4 = std::chrono::steady_clock::now();
+  auto ns = [&](std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count() / loops;
+  };
+  printf("\nTitre \"%s\" (%u glyphes, DejaVuSans Bold)\n", texts[3].ascii, run.length);
+  printf("  preparation a chaque trame (conversion, strcmp, getTextBounds) : %6.0f ns\n", ns(t0, t1));
+  printf("  glyphRunBuild (au changement de titre seulement)               : %6.0f ns\n", ns(t1, t2));
+  printf("  trace glyphSpanPrint (texte Latin-1)                           : %6.0f ns\n", ns(t2, t3));
+  printf("  trace glyphRunDraw (run en cache)                              : %6.0f ns\n", ns(t3, t4));
+
+  return nativeCheckSummary();
+}
@@ -0,0 +1,142 @@
+/**
+ * Test natif (PC) du tracé de texte par plages (src/GlyphSpans.h)
+ *
+ * 1. Images de référence : glyphSpanPrint() doit produire le même
+ *    framebuffer que setCursor() + print() (setTextWrap(false)) pour :
+ *    - la police 5x7 intégrée et les trois polices DejaVu Latin-1 ;
+ *    - les tailles 1 à 3 ;
+ *    - chaque glyphe seul et des textes du compte à rebours / de l'horloge
+ *      (avec '\n', '\r', accents Latin-1 et codes hors police) ;
+ *    - des positions balayant l'écran et ses bords (découpage partiel
+ *      à gauche, à droite, en haut, en bas, glyphes entièrement dehors) ;
+ *    - les rotations 0 et 2.
+ * 2. Comparaison print / plages : temps par texte et écritures hors écran.
+ *
+ * Lancement : pio run -e native_glyph_span_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "GlyphSpans.h"
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#include "DejaVuSansOblique9ptLat1.h"
+#include "NativeCheck.h"
+
+struct TestFont {
+  const char *name;
+  const GFXfont *font;
+};
+
+static const TestFont fonts[] = {
+  { "5x7 integree", nullptr },
+  { "DejaVuSans", &DejaVuSans9ptLat1 },
+  { "DejaVuSans Bold", &DejaVuSans_Bold9pt8b },
+  { "DejaVuSans Oblique", &DejaVuSans_Oblique9pt8b },
+};
+
+static const char *texts[] = {
+  "12:34:56", "3D 05:59", "05:09", "42",
+  "BONNE ANNEE 2026 !", "F\xEAte \xE0 l'\xE9t\xE9 \xA9\xB0",
+  "Ligne 1\nLigne 2\r", "\x01\x7F\xFF", "",
+};
+
+// 3 panneaux de large comme le firmware par défaut
+static PxMATRIX ref(96, 16, 5, 4, 19, 23, 18);
+static PxMATRIX spans(96, 16, 5, 4, 19, 23, 18);
+
+static bool sameFramebuffers() {
+  return memcmp(ref.framebuffer(), spans.framebuffer(), 96 * 16 * sizeof(uint16_t)) == 0;
+}
+
+static void checkText(const TestFont &f, const char *text, uint8_t size, int16_t x, int16_t y) {
+  ref.fillScreen(0);
+  spans.fillScreen(0);
+  ref.setFont(f.font);
+  ref.setTextSize(size);
+  ref.setTextColor(0xF81F);
+  ref.setCursor(x, y);
+  ref.print(text);
+  glyphSpanPrint(spans, x, y, text, f.font, size, 0xF81F);
+  CHECK(sameFramebuffers(), "%s taille %u rotation %u (%d,%d) \"%s\"", f.name, size, ref.getRotation(), x, y, text);
+}
+
+// Positions : bords, moitiés de glyphes dehors, glyphes entièrement dehors
+static void sweep(const TestFont &f, const char *text, uint8_t size, int16_t step) {
+  const int16_t baseline = f.font ? 12 * size : 0;  // ligne de base (GFX) ou haut de cellule (5x7)
+  for (int16_t x = -40 * size; x <= ref.width() + 8; x += step) {
+    checkText(f, text, size, x, baseline);
+  }
+  for (int16_t y = baseline - 20 * size; y <= baseline + 20 * size; y++) {
+    checkText(f, text, size, 3, y);
+    checkText(f, text, size, -7, y);
+  }
+}
+
+template <typename Draw>
+static double nsPerCall(uint32_t loops, Draw draw) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) draw();
+  auto t1 = std::chrono::steady_clock::now();
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / loops;
+}
+
+int main() {
+  printf("=== Test du trace de texte par plages ===\n");
+  ref.setTextWrap(false);
+
+  for (uint8_t rotation = 0; rotation <= 2; rotation += 2) {
+    ref.setRotation(rotation);
+    spans.setRotation(rotation);
+    for (const TestFont &f : fonts) {
+      int before = failures;
+      uint32_t checksBefore = checks;
+      for (uint8_t size = 1; size <= 3; size++) {
+        char one[2] = { 0, 0 };
+        for (int c = 1; c < 256; c++) {
+          one[0] = (char)c;
+          checkText(f, one, size, 10, f.font ? 13 : 4);
+          checkText(f, one, size, -3 * size, f.font ? 4 * size : -3 * size);
+          checkText(f, one, size, ref.width() - 4 * size, f.font ? 20 * size : 10);
+        }
+        for (const char *text : texts) sweep(f, text, size, (rotation == 0) ? 1 : 5);
+      }
+      printf("%-20s rotation %u %7u comparaisons : %s\n", f.name, rotation, checks - checksBefore,
+             failures == before ? "identique a print" : "ECHEC");
+    }
+  }
+  ref.setRotation(0);
+  spans.setRotation(0);
+
+  printf("\n%-20s %-20s %6s %6s %10s %10s %10s %10s\n", "police", "texte", "taille", "x",
+         "print ns", "plages ns", "hors ecran", "hors ecran");
+  printf("%-20s %-20s %6s %6s %10s %10s %10s %10s\n", "", "", "", "", "", "", "print", "plages");
+  struct Case { const char *text; uint8_t size; int16_t x; };
+  static const Case cases[] = {
+    { "12:34:56", 1, 20 }, { "12:34:56", 2, -10 },
+    { "BONNE ANNEE 2026 !", 1, 5 }, { "BONNE ANNEE 2026 !", 2, -60 },
+  };
+  for (const TestFont &f : fonts) {
+    if (!f.font) continue;
+    for (const Case &k : cases) {
+      ref.setFont(f.font);
+      ref.setTextSize(k.size);
+      ref.setTextColor(0x07E0);
+      int16_t y = 12 * k.size;
+      ref.resetStats();
+      double a = nsPerCall(2000, [&]() { ref.setCursor(k.x, y); ref.print(k.text); });
+      uint32_t clippedA = ref.stats().pixelsClipped / 2000;
+      spans.resetStats();
+      double b = nsPerCall(2000, [&]() { glyphSpanPrint(spans, k.x, y, k.text, f.font, k.size, 0x07E0); });
+      uint32_t clippedB = spans.stats().pixelsClipped / 2000;
+      printf("%-20s %-20s %6u %6d %10.0f %10.0f %10u %10u\n", f.name, k.text, k.size, k.x,
+             a, b, clippedA, clippedB);
+    }
+  }
+  ref.setFont();
+
+  return nativeCheckSummary("comparaisons");
+}
@@ -0,0 +1,151 @@
+/**
+ * Test natif (PC) de l'écriture JSON sans allocation (src/JsonWriter.h)
+ *
+ * 1. Échappement des chaînes : guillemets, antislash, caractères de
+ *    contrôle (\n, \u0001 ...), UTF-8 inchangé.
+ * 2. Réponse /getSettings (29 membres d'origine de handleGetSettings) :
+ *    identique à l'ancienne concaténation pour un titre sans caractère
+ *    spécial, titre échappé sinon ; pire cas (titre de 50 octets de
+ *    contrôle, entiers 32 bits minimaux) dans SETTINGS_JSON_SIZE.
+ * 3. Débordement : pour chaque taille de buffer trop petite, jsonEnd()
+ *    renvoie 0 sans écrire au-delà du buffer.
+ * 4. Tas par requête : compteur d'allocations (operator new global).
+ *    L'ancienne concaténation est reproduite avec std::string (petites
+ *    chaînes sans allocation, comme String d'arduino-esp32).
+ *
+ * Lancement : pio run -e native_json_writer_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <limits.h>
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "JsonWriter.h"
+#include "NativeCheck.h"
+
+// --- Compteur d'allocations : operator new global ---
+static bool heapArmed = false;
+static uint32_t heapAllocations = 0;
+
+void *operator new(size_t n) {
+  void *p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  if (heapArmed) heapAllocations++;
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+// SETTINGS_JSON_SIZE de examples/fullscreen_countdown_web.cpp
+#define SETTINGS_JSON_SIZE 1280
+
+// Valeurs des paramètres, dans l'ordre de handleGetSettings
+static const char *keys[] = {
+  "year", "month", "day", "hour", "minute", "second", "fontStyle", "colorR", "colorG", "colorB",
+  "blinkEnabled", "blinkIntervalMs", "blinkWindow", "marqueeEnabled", "marqueeIntervalMs", "marqueeGap",
+  "marqueeMode", "marqueeReturnIntervalMs", "marqueeBouncePauseLeftMs", "marqueeBouncePauseRightMs",
+  "marqueeOneShotDelayMs", "marqueeOneShotStopCenter", "marqueeOneShotRestartSec", "marqueeAccelEnabled",
+  "marqueeAccelStartIntervalMs", "marqueeAccelEndIntervalMs", "marqueeAccelDurationMs", "brightness",
+};
+#define NKEYS (sizeof(keys) / sizeof(keys[0]))
+
+static size_t settingsJson(char *buf, size_t size, const char *title, const long *values) {
+  JsonWriter w;
+  jsonBegin(w, buf, size);
+  jsonAddString(w, "title", title);
+  for (size_t i = 0; i < NKEYS; i++) jsonAddInt(w, keys[i], values[i]);
+  return jsonEnd(w);
+}
+
+// Ancienne construction : json += "\"cle\":" + String(x) + "," (String -> std::string)
+static std::string legacyJson(const char *title, const long *values) {
+  std::string json = "{";
+  json += "\"title\":\"" + std::string(title) + "\",";
+  for (size_t i = 0; i < NKEYS; i++) {
+    json += "\"" + std::string(keys[i]) + "\":" + std::to_string(values[i]);
+    if (i + 1 < NKEYS) json += ",";
+  }
+  json += "}";
+  return json;
+}
+
+static void checkEscape(const char *in, const char *expected) {
+  char buf[128];
+  JsonWriter w;
+  jsonBegin(w, buf, sizeof(buf));
+  jsonAddString(w, "t", in);
+  const size_t len = jsonEnd(w);
+  std::string want = std::string("{\"t\":\"") + expected + "\"}";
+  CHECK(len == want.size() && strcmp(buf, want.c_str()) == 0, "echappement : %s au lieu de %s", buf, want.c_str());
+}
+
+int main() {
+  printf("=== Ecriture JSON sans allocation ===\n");
+
+  // 1. Échappement
+  int before = failures;
+  checkEscape("COUNTDOWN", "COUNTDOWN");
+  checkEscape("", "");
+  checkEscape("Le \"grand\" jour", "Le \\\"grand\\\" jour");
+  checkEscape("C:\\temp\\", "C:\\\\temp\\\\");
+  checkEscape("a\nb\rc\td\be\ff", "a\\nb\\rc\\td\\be\\ff");
+  checkEscape("\x01\x1F\x7F", "\\u0001\\u001f\x7F");
+  checkEscape("BONNE ANN\xC3\x89" "E \xF0\x9F\x8E\x89", "BONNE ANN\xC3\x89" "E \xF0\x9F\x8E\x89");
+  checkEscape("</script>", "</script>");
+  printf("%-36s %s\n", "echappement des chaines", failures == before ? "OK" : "ECHEC");
+
+  // 2. Réponse /getSettings
+  before = failures;
+  const long defaults[NKEYS] = { 2025, 12, 31, 23, 59, 0, 0, 255, 128, 0, 1, 500, 10, 1, 40, 24, 0, 60, 400,
+                                 400, 800, 1, 0, 0, 80, 20, 3000, -1 };
+  static char json[SETTINGS_JSON_SIZE];
+  size_t len = settingsJson(json, sizeof(json), "NEW YEAR 2026", defaults);
+  const std::string legacy = legacyJson("NEW YEAR 2026", defaults);
+  CHECK(len == legacy.size() && strcmp(json, legacy.c_str()) == 0, "getSettings : %s\n  attendu %s", json, legacy.c_str());
+  const size_t typical = len;
+  len = settingsJson(json, sizeof(json), "Dites \"FIN\"\n", defaults);
+  CHECK(len > 0 && strstr(json, "{\"title\":\"Dites \\\"FIN\\\"\\n\",\"year\":2025,") == json, "titre echappe : %s", json);
+
+  long worst[NKEYS];
+  for (size_t i = 0; i < NKEYS; i++) worst[i] = INT32_MIN;
+  char worstTitle[51];
+  memset(worstTitle, 0x01, 50);
+  worstTitle[50] = '\0';
+  const size_t worstLen = settingsJson(json, sizeof(json), worstTitle, worst);
+  CHECK(worstLen > 0, "pire cas au-dela de %u octets", SETTINGS_JSON_SIZE);
+  printf("%-36s %s (typique %u octets, pire cas %u / %u)\n", "/getSettings == ancienne reponse",
+         failures == before ? "OK" : "ECHEC", (unsigned)typical, (unsigned)worstLen, SETTINGS_JSON_SIZE);
+
+  // 3. Débordement : jamais d'écriture hors du buffer
+  before = failures;
+  static char small[SETTINGS_JSON_SIZE + 16];
+  for (size_t size = 0; size <= typical + 1; size++) {
+    memset(small, 0x5A, sizeof(small));
+    len = settingsJson(small, size, "NEW YEAR 2026", defaults);
+    bool canary = true;
+    for (size_t i = size; i < sizeof(small); i++) canary = canary && small[i] == 0x5A;
+    CHECK(canary, "buffer %u : ecriture au-dela", (unsigned)size);
+    CHECK(size <= typical ? len == 0 : len == typical, "buffer %u : longueur %u", (unsigned)size, (unsigned)len);
+  }
+  printf("%-36s %s (buffers 0 a %u octets)\n", "debordement detecte", failures == before ? "OK" : "ECHEC",
+         (unsigned)(typical + 1));
+
+  // 4. Allocations par requête
+  heapAllocations = 0;
+  heapArmed = true;
+  std::string old = legacyJson("NEW YEAR 2026", defaults);
+  heapArmed = false;
+  const uint32_t legacyAllocations = heapAllocations;
+  heapAllocations = 0;
+  heapArmed = true;
+  len = settingsJson(json, sizeof(json), "NEW YEAR 2026", defaults);
+  heapArmed = false;
+  CHECK(heapAllocations == 0, "JsonWriter : %u allocation(s)", heapAllocations);
+  printf("\nAllocations par requete /getSettings (%u octets)\n", (unsigned)len);
+  printf("  avant : concatenations String      : %u\n", legacyAllocations);
+  printf("  apres : JsonWriter (buffer fixe)   : %u\n", heapAllocations);
+
+  return nativeCheckSummary();
+}
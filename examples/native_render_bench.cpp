@@ -0,0 +1,323 @@
+/**
+ * Banc de mesure natif (PC) du rendu P10
+ *
+ * Compile le code de rendu réel du firmware contre un PxMATRIX de substitution
+ * (tools/native/PxMatrix.h, framebuffer RGB565 en mémoire) :
+ *  - src/ClockRender.h : DisplayTask (displayTaskStep), run_Scrolling_Text, drawColon
+ *  - examples/FullscreenCountdownRender.h : displayFullscreenCountdown (titre
+ *    9 pt tracé anti-aliasé, src/AaFont.h)
+ *  - src/BitPlaneEncoder.h : encodage BCM d'une trame
+ *  - src/ColorGamma.h : couleurs corrigées (color565Corrected)
+ *
+ * Pour chaque scénario on rapporte :
+ *  - ns/frame        : temps CPU hôte moyen par frame (valeur relative, pas ESP32)
+ *  - pixels/frame    : écritures de pixels dans le framebuffer
+ *  - appels GFX/frame: primitives Adafruit GFX appelées par le code de rendu
+ *  - hors-écran/frame: écritures de pixels rejetées par le clipping
+ *  - empreinte       : hash FNV-1a du framebuffer final (comparaison d'images)
+ *
+ * La géométrie vient des build flags (MATRIX_PANELS_X / MATRIX_PANELS_Y),
+ * comme pour les environnements cascade_* :
+ *   pio run -e native -t exec
+ *   pio run -e native_cascade_3x1 -t exec
+ *   ./tools/native_bench.sh          (toutes les géométries)
+ *
+ * Auteur: Clément Saillant (electron-rare)
+ */
+
+#include <Arduino.h>
+// Comme fullscreen_countdown_web.cpp : rendu dans le buffer arrière
+#define PxMATRIX_double_buffer true
+#include <PxMatrix.h>
+#include <chrono>
+#include <vector>
+#include "BitPlaneEncoder.h"
+#include "ColorGamma.h"
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "TextLayoutCache.h"
+
+#ifndef MATRIX_WIDTH
+  #define MATRIX_WIDTH 32
+#endif
+#ifndef MATRIX_HEIGHT
+  #define MATRIX_HEIGHT 16
+#endif
+#ifndef MATRIX_PANELS_X
+  #define MATRIX_PANELS_X 1
+#endif
+#ifndef MATRIX_PANELS_Y
+  #define MATRIX_PANELS_Y 1
+#endif
+
+#define TOTAL_WIDTH (MATRIX_WIDTH * MATRIX_PANELS_X)
+#define TOTAL_HEIGHT (MATRIX_HEIGHT * MATRIX_PANELS_Y)
+
+// Pins (sans effet en natif, conservés pour garder la même construction)
+#define P_LAT 5
+#define P_A   19
+#define P_B   23
+#define P_C   18
+#define P_OE  4
+
+// ============================================================================
+// Rendu de l'horloge (src/main.cpp)
+// ============================================================================
+namespace clockfw {
+PxMATRIX display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
+#include "ClockRender.h"
+
+// Heure simulée : avance d'une minute toutes les 60 lectures (1 lecture / s)
+static int simHour = 12, simMinute = 34, simSecond = 0;
+void get_Time() {
+  if (++simSecond >= 60) {
+    simSecond = 0;
+    if (++simMinute >= 60) { simMinute = 0; simHour = (simHour + 1) % 24; }
+  }
+  sprintf(chr_t_Hour, "%02d", simHour);
+  sprintf(chr_t_Minute, "%02d", simMinute);
+}
+void get_Date() {
+  strcpy(day_and_date_Text, "MERCREDI, 31-12-2025");
+}
+void updateCountdown() {
+  strcpy(countdown_Text, "NEW YEAR: 12d 03h 45m 06s");
+}
+} // namespace clockfw
+
+// ============================================================================
+// Rendu du compte à rebours plein écran (examples/fullscreen_countdown_web.cpp)
+// ============================================================================
+namespace countdownfw {
+PxMATRIX display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
+#include "FullscreenCountdownRender.h"
+
+// Pas d'ISR en natif : la bascule demandée est appliquée avant la trame suivante
+void waitFrameSwap() {
+  if (frameSwapPending) {
+    display.showBuffer();
+    frameSwapPending = false;
+  }
+}
+void presentFrame() {
+  frameSwapPending = true;
+}
+} // namespace countdownfw
+
+// ============================================================================
+// Mesure
+// ============================================================================
+struct BenchResult {
+  const char *name;
+  uint32_t frames;
+  double nsPerFrame;
+  double pixelsPerFrame;
+  double callsPerFrame;
+  double clippedPerFrame;
+  uint32_t fingerprint;
+};
+
+static uint32_t framebufferFingerprint(const PxMATRIX &d) {
+  uint32_t h = 2166136261u;
+  const uint16_t *fb = d.framebuffer();
+  for (int32_t i = 0; i < (int32_t)TOTAL_WIDTH * TOTAL_HEIGHT; i++) {
+    h = (h ^ (fb[i] & 0xFF)) * 16777619u;
+    h = (h ^ (fb[i] >> 8)) * 16777619u;
+  }
+  return h;
+}
+
+// Exécute `frames` fois `step`, en avançant l'horloge simulée de `msPerFrame`
+template <typename Step>
+static BenchResult runScenario(const char *name, PxMATRIX &d, uint32_t frames, unsigned long msPerFrame, Step step) {
+  d.resetStats();
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < frames; i++) {
+    nativeAdvanceMillis(msPerFrame);
+    step(i);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  const Adafruit_GFX::Stats &st = d.stats();
+  BenchResult r;
+  r.name = name;
+  r.frames = frames;
+  r.nsPerFrame = ns / frames;
+  r.pixelsPerFrame = (double)st.pixelsTouched / frames;
+  r.callsPerFrame = (double)st.gfxCalls / frames;
+  r.clippedPerFrame = (double)st.pixelsClipped / frames;
+  r.fingerprint = framebufferFingerprint(d);
+  return r;
+}
+
+static void printHeader() {
+  printf("\n=== Banc de rendu natif : %dx%d panneaux (%dx%d pixels) ===\n",
+         MATRIX_PANELS_X, MATRIX_PANELS_Y, TOTAL_WIDTH, TOTAL_HEIGHT);
+  printf("%-40s %7s %11s %13s %13s %13s %10s\n",
+         "scenario", "frames", "ns/frame", "pixels/frame", "appels/frame", "hors-ecran", "empreinte");
+}
+
+static void printResult(const BenchResult &r) {
+  printf("%-40s %7u %11.0f %13.1f %13.1f %13.1f   %08x\n",
+         r.name, r.frames, r.nsPerFrame, r.pixelsPerFrame, r.callsPerFrame, r.clippedPerFrame, r.fingerprint);
+}
+
+// Zones redessinées par frame (damage tracking de ClockRender.h)
+static void printDamage(uint32_t zones, uint32_t frames) {
+  printf("    -> zones redessinees/frame : %.3f\n", (double)zones / frames);
+}
+
+// Succès / échecs du cache de layouts pendant le dernier scénario
+static void printLayoutCache(const TextLayoutCache &cache, uint32_t hitsStart, uint32_t missesStart) {
+  printf("    -> cache de layouts : %u succes, %u echecs\n",
+         (unsigned)(cache.hits - hitsStart), (unsigned)(cache.misses - missesStart));
+}
+
+// --- Scénarios horloge (src/main.cpp) ---
+static void benchClock() {
+  using namespace clockfw;
+  display.setTextWrap(false);
+  display.setTextSize(1);
+
+  // Bloc HH:MM seul, à la cadence réelle (500 ms)
+  display.clearDisplay();
+  invalidate_Clock();
+  get_Time();
+  uint32_t damageStart = damage_Total;
+  printResult(runScenario("clock/showClock (500 ms)", display, 2000, 500, [](uint32_t i) {
+    if ((i & 1) == 0) { get_Time(); blink_Colon = !blink_Colon; }
+    showClock();
+  }));
+  printDamage(damage_Total - damageStart, 2000);
+
+  // Une minute par frame, deux points figés : coût des seuls chiffres
+  // (cellules redessinées : unités à chaque frame, dizaines toutes les 10 min)
+  damageStart = damage_Total;
+  printResult(runScenario("clock/showClock (1 min / frame)", display, 1440, 500, [](uint32_t) {
+    for (int s = 0; s < 60; s++) get_Time();
+    showClock();
+  }));
+  printDamage(damage_Total - damageStart, 1440);
+
+  // Défilement d'un texte de 150 caractères, une frame = un pas de 1 px
+  display.clearDisplay();
+  invalidate_Clock();
+  memset(input_Scrolling_Text, 'A', 150);
+  input_Scrolling_Text[150] = '\0';
+  for (int k = 0; k < 150; k += 7) input_Scrolling_Text[k] = ' ';
+  strcpy(text_Scrolling_Text, input_Scrolling_Text);
+  start_Scroll_Text = true;
+  set_up_Scrolling_Text_Length = true;
+  printResult(runScenario("clock/run_Scrolling_Text (150 car.)", display, 1000, input_Scrolling_Speed, [](uint32_t) {
+    if (!start_Scroll_Text) { start_Scroll_Text = true; set_up_Scrolling_Text_Length = true; }
+    run_Scrolling_Text(8, input_Scrolling_Speed, text_Scrolling_Text, text_Color);
+  }));
+
+  // Boucle DisplayTask complète (10 ms) : date, texte, countdown en rotation
+  display.clearDisplay();
+  invalidate_Clock();
+  strcpy(input_Scrolling_Text, "ESP32 P10 RGB Digital Clock with PlatformIO");
+  countdown_Active = true;
+  reset_Scrolling_Text = true;
+  scrolling_text_Display_Order = 0;
+  damageStart = damage_Total;
+  uint32_t hitsStart = scroll_Layouts.hits, missesStart = scroll_Layouts.misses;
+  printResult(runScenario("clock/DisplayTask (10 ms, 60 s)", display, 6000, 10, [](uint32_t) {
+    displayTaskStep();
+  }));
+  printDamage(damage_Total - damageStart, 6000);
+  printLayoutCache(scroll_Layouts, hitsStart, missesStart);
+}
+
+// --- Scénarios compte à rebours (examples/fullscreen_countdown_web.cpp) ---
+static void benchCountdown() {
+  using namespace countdownfw;
+  display.setTextWrap(false);
+
+  static const char *formatNames[4] = {
+    "countdown/format 0 (jours, 1 s)",
+    "countdown/format 1 (HH:MM:SS, 1 s)",
+    "countdown/format 2 (MM:SS, 1 s)",
+    "countdown/format 3 (SS, 1 s)",
+  };
+  countdownExpired = false;
+  blinkLastSeconds = false;
+  for (int f = 0; f < 4; f++) {
+    displayFormat = f;
+    forceLayout = true;
+    printResult(runScenario(formatNames[f], display, 600, 1000, [](uint32_t i) {
+      int total = 3 * 86400 + 5 * 3600 + 59 * 60 + 59 - (int)i;
+      displayFullscreenCountdown(total / 86400, (total % 86400) / 3600, (total % 3600) / 60, total % 60);
+    }));
+  }
+
+  // Message de fin court, statique (centré)
+  countdownExpired = true;
+  endMessageEffect = 0;
+  marqueeMode = 0;
+  strcpy(countdownTitle, "FIN !");
+  forceLayout = true;
+  uint32_t hitsStart = countdownLayouts.hits, missesStart = countdownLayouts.misses;
+  printResult(runScenario("countdown/titre statique", display, 600, 150, [](uint32_t i) {
+    if (i % 100 == 99) forceLayout = true; // réglages web réenregistrés, même titre
+    displayFullscreenCountdown(0, 0, 0, 0);
+  }));
+  printLayoutCache(countdownLayouts, hitsStart, missesStart);
+
+  // Titre ajusté en 9 pt (plus long préfixe qui tient dans le panneau à
+  // cette taille) : tracé anti-aliasé (AaFont.h, COUNTDOWN_AA_BPP)
+  static const char *words = "BONNE ANNEE 2026 A TOUS ET BON REVEILLON A TOUTE LA FAMILLE";
+  countdownTitle[0] = '\0';
+  for (size_t n = strlen(words); n > 0; n--) {
+    char prefix[64];
+    memcpy(prefix, words, n);
+    prefix[n] = '\0';
+    if (fitLayoutToText(prefix).font == &DejaVuSans9pt8b) {
+      strcpy(countdownTitle, prefix);
+      break;
+    }
+  }
+  if (countdownTitle[0]) {
+    forceLayout = true;
+    printResult(runScenario("countdown/titre 9 pt", display, 600, 150, [](uint32_t) {
+      displayFullscreenCountdown(0, 0, 0, 0);
+    }));
+    printf("    -> \"%s\"\n", countdownTitle);
+  }
+
+  // Message de fin long : marquee continu (mode auto) à 40 ms / px
+  strcpy(countdownTitle, "BONNE ANNÉE 2026 ! Joyeuses fêtes à tous");
+  marqueeMode = 0;
+  forceLayout = true;
+  printResult(runScenario("countdown/marquee continu (40 ms)", display, 2000, 40, [](uint32_t) {
+    displayFullscreenCountdown(0, 0, 0, 0);
+  }));
+
+  // Marquee aller-retour
+  marqueeMode = 2;
+  forceLayout = true;
+  printResult(runScenario("countdown/marquee aller-retour (40 ms)", display, 2000, 40, [](uint32_t) {
+    displayFullscreenCountdown(0, 0, 0, 0);
+  }));
+  marqueeMode = 0;
+}
+
+// --- Encodage BCM de la trame affichée (src/BitPlaneEncoder.h) ---
+static void benchBitPlanes() {
+  static const BcmLayout layout = { TOTAL_WIDTH, TOTAL_HEIGHT, 4, 8 };
+  static std::vector<uint8_t> planes(bcmFrameBytes(layout));
+  printResult(runScenario("bcm/encodage trame (begin(4), 8 plans)", countdownfw::display, 1000, 0, [](uint32_t) {
+    bcmEncodeFrame(layout, countdownfw::display.visibleBuffer(), planes.data());
+  }));
+  printf("    -> %u octets de plans par trame\n", bcmFrameBytes(layout));
+}
+
+int main() {
+  printHeader();
+  benchClock();
+  benchCountdown();
+  benchBitPlanes();
+  return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * Test natif (PC) de l'ordonnanceur adaptatif du rafraîchissement (src/RefreshScheduler.h)
+ *
+ * 1. Profils : cible, budget CPU et draw time maximal selon le nombre de
+ *    panneaux (bornes 2 / 4 / 6), valeurs de départ de refreshSchedulerInit.
+ * 2. Cible tenable : période = 1 s / fréquence cible, draw time remonté d'un
+ *    cran par fenêtre jusqu'au maximum du profil ; durées en cycles CPU
+ *    converties en µs (ticksPerUs) comme le relevé ISR_CYCLES du firmware.
+ * 3. Cible intenable sans famine : draw time réduit d'abord, jamais sous
+ *    REFRESH_MIN_DRAW_TIME, puis période allongée.
+ * 4. Famine : budget réduit d'un quart par niveau (3 niveaux au plus), la
+ *    période suit le budget, retour d'un niveau après REFRESH_CALM_WINDOWS
+ *    fenêtres calmes ; seuil de refreshSchedulerTaskLoop.
+ * 5. Bornes de la période : 1000 us minimum, 8000 us maximum, et au moins
+ *    5/4 de la durée maximale de l'ISR.
+ *
+ * Lancement : pio run -e native_refresh_scheduler_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "RefreshScheduler.h"
+#include "NativeCheck.h"
+
+// Fréquence CPU simulée : durées d'ISR relevées en cycles (ISR_CYCLES)
+#define CPU_MHZ 240
+
+static uint32_t nowMs = 0;
+
+// Une fenêtre de REFRESH_WINDOW_MS : `calls` appels d'ISR de avgUs (dont un
+// de maxUs), puis ajustement. Retourne la valeur de refreshSchedulerApply.
+static bool runWindow(RefreshScheduler &s, uint32_t calls, uint32_t avgUs, uint32_t maxUs, bool starved = false) {
+  for (uint32_t i = 0; i < calls; i++) {
+    uint32_t us = (i == 0) ? maxUs : avgUs;
+    refreshSchedulerRecordIsr(s, us * CPU_MHZ);
+  }
+  if (starved) refreshSchedulerTaskLoop(s, 10, 100);
+  nowMs += REFRESH_WINDOW_MS;
+  CHECK(refreshSchedulerDue(s, nowMs), "fenetre non echue a %u ms", nowMs);
+  RefreshWindow w = refreshSchedulerSnapshot(s);
+  CHECK(s.isrCount == 0 && s.isrTimeSum == 0 && s.isrTimeMax == 0, "compteurs ISR non remis a zero");
+  return refreshSchedulerApply(s, w, nowMs);
+}
+
+// Budget effectif (%) au niveau de repli courant
+static uint32_t budgetPct(const RefreshScheduler &s) {
+  return (uint32_t)s.profile.cpuBudgetPct * (4 - s.backoff) / 4;
+}
+
+int main() {
+  printf("Ordonnanceur du rafraichissement (fenetre %u ms, CPU %u MHz)\n\n", REFRESH_WINDOW_MS, CPU_MHZ);
+
+  // 1. Profils
+  int before = failures;
+  struct { uint8_t panels; uint16_t hz; uint8_t pct; uint8_t draw; } profiles[] = {
+    { 1, 650, 40, 30 }, { 2, 650, 40, 30 }, { 3, 500, 35, 25 }, { 4, 500, 35, 25 },
+    { 5, 350, 30, 20 }, { 6, 350, 30, 20 }, { 7, 250, 25, 15 }, { 8, 250, 25, 15 }, { 16, 250, 25, 15 },
+  };
+  for (const auto &p : profiles) {
+    RefreshProfile r = refreshProfileFor(p.panels);
+    CHECK(r.targetHz == p.hz && r.cpuBudgetPct == p.pct && r.maxDrawTime == p.draw,
+          "%u panneaux : %u Hz %u %% draw %u", p.panels, r.targetHz, r.cpuBudgetPct, r.maxDrawTime);
+    RefreshScheduler s;
+    refreshSchedulerInit(s, p.panels, 4000, 1234, CPU_MHZ);
+    CHECK(s.periodUs == 4000 && s.drawTime == p.draw && s.backoff == 0 && s.ticksPerUs == CPU_MHZ &&
+          s.windowStartMs == 1234 && !s.starved, "%u panneaux : etat initial", p.panels);
+  }
+  RefreshScheduler zero;
+  refreshSchedulerInit(zero, 1, 1500, 0, 0);
+  CHECK(zero.ticksPerUs == 1, "ticksPerUs 0 -> %u", zero.ticksPerUs);
+  printf("%-34s %s\n", "profils par nombre de panneaux", failures == before ? "OK" : "ECHEC");
+
+  // 2. Cible tenable : 3 panneaux, 500 Hz (2000 us), budget 35 % = 700 us
+  before = failures;
+  RefreshScheduler s;
+  nowMs = 0;
+  refreshSchedulerInit(s, 3, 4000, nowMs, CPU_MHZ);
+  s.drawTime = 20;
+  CHECK(!refreshSchedulerDue(s, REFRESH_WINDOW_MS - 1), "fenetre echue trop tot");
+  CHECK(runWindow(s, 1000, 300, 400), "cible tenable : aucun changement signale");
+  CHECK(s.periodUs == 2000, "periode %u us, attendu 2000", s.periodUs);
+  CHECK(s.isrAvgUs == 300 && s.isrMaxUs == 400, "duree ISR %u / %u us (cycles mal convertis)", s.isrAvgUs, s.isrMaxUs);
+  CHECK(s.achievedHz > 1999.0f && s.achievedHz < 2001.0f, "frequence mesuree %.1f Hz", s.achievedHz);
+  CHECK(s.drawTime == 21, "draw time %u, attendu 21", s.drawTime);
+  for (int i = 0; i < 10; i++) runWindow(s, 1000, 300, 400);
+  CHECK(s.drawTime == s.profile.maxDrawTime, "draw time %u au-dela du profil", s.drawTime);
+  CHECK(!runWindow(s, 1000, 300, 400), "regime etabli : changement signale");
+  // Sans appel d'ISR : rien n'est ajusté
+  nowMs += REFRESH_WINDOW_MS;
+  RefreshWindow empty = refreshSchedulerSnapshot(s);
+  CHECK(!refreshSchedulerApply(s, empty, nowMs) && s.periodUs == 2000, "fenetre vide appliquee");
+  printf("%-34s %s\n", "cible tenable", failures == before ? "OK" : "ECHEC");
+
+  // 3. Cible intenable sans famine : draw time d'abord, puis période
+  before = failures;
+  nowMs = 0;
+  refreshSchedulerInit(s, 3, 2000, nowMs, CPU_MHZ);
+  uint8_t lastDraw = s.drawTime;
+  uint32_t guard = 0;
+  while (s.drawTime > REFRESH_MIN_DRAW_TIME && guard++ < 50) {
+    runWindow(s, 1000, 1400, 1500);
+    CHECK(s.drawTime < lastDraw, "draw time %u non reduit (avant %u)", s.drawTime, lastDraw);
+    CHECK(s.periodUs == 2000 || s.drawTime == REFRESH_MIN_DRAW_TIME, "periode %u changee avant le draw time", s.periodUs);
+    lastDraw = s.drawTime;
+  }
+  CHECK(s.drawTime == REFRESH_MIN_DRAW_TIME, "draw time %u, plancher %u", s.drawTime, REFRESH_MIN_DRAW_TIME);
+  runWindow(s, 1000, 1400, 1500);
+  CHECK(s.drawTime == REFRESH_MIN_DRAW_TIME, "draw time %u sous le plancher", s.drawTime);
+  CHECK(s.periodUs == 1400 * 100 / 35, "periode %u us, attendu %u", s.periodUs, 1400 * 100 / 35);
+  printf("%-34s %s\n", "cible intenable", failures == before ? "OK" : "ECHEC");
+
+  // 4. Famine : budget par quarts, période allongée à chaque niveau
+  before = failures;
+  nowMs = 0;
+  refreshSchedulerInit(s, 1, 1538, nowMs, CPU_MHZ);  // 650 Hz, budget 40 %
+  refreshSchedulerTaskLoop(s, 10, 30);
+  CHECK(!s.starved, "boucle a 30 ms (10 ms nominal) signalee affamee");
+  refreshSchedulerTaskLoop(s, 10, 31);
+  CHECK(s.starved, "boucle a 31 ms (10 ms nominal) non signalee");
+  s.starved = false;
+  for (uint8_t level = 1; level <= REFRESH_MAX_BACKOFF + 2; level++) {
+    runWindow(s, 600, 300, 300, true);
+    uint8_t expected = level > REFRESH_MAX_BACKOFF ? REFRESH_MAX_BACKOFF : level;
+    CHECK(s.backoff == expected, "famine %u : repli %u, attendu %u", level, s.backoff, expected);
+    CHECK(budgetPct(s) == 40u * (4 - expected) / 4, "famine %u : budget %u %%", level, budgetPct(s));
+    uint32_t needed = 300 * 100 / budgetPct(s);
+    uint32_t period = needed > 1538 ? needed : 1538;
+    CHECK(s.periodUs == period, "famine %u : periode %u us, attendu %u", level, s.periodUs, period);
+    CHECK(s.drawTime == 30, "famine %u : draw time %u reduit avant la frequence", level, s.drawTime);
+    CHECK(!s.starved, "famine %u : signal non consomme", level);
+  }
+  char json[200];
+  refreshSchedulerToJson(s, json, sizeof(json));
+  CHECK(strstr(json, "\"budget_pct\":10,\"backoff\":3}") != nullptr, "JSON %s", json);
+  for (uint8_t level = REFRESH_MAX_BACKOFF; level > 0; level--) {
+    for (uint8_t w = 1; w < REFRESH_CALM_WINDOWS; w++) {
+      runWindow(s, 600, 300, 300);
+      CHECK(s.backoff == level, "repli %u : relache apres %u fenetre(s) calme(s)", level, w);
+    }
+    runWindow(s, 600, 300, 300);
+    CHECK(s.backoff == level - 1, "repli %u : %u apres %u fenetres calmes", level, s.backoff, REFRESH_CALM_WINDOWS);
+  }
+  CHECK(s.periodUs == 1538, "periode %u us apres retour au budget complet", s.periodUs);
+  // Famine pendant le retour : compteur de fenêtres calmes remis à zéro
+  runWindow(s, 600, 300, 300, true);
+  runWindow(s, 600, 300, 300);
+  runWindow(s, 600, 300, 300, true);
+  CHECK(s.backoff == 2 && s.calmWindows == 0, "famines rapprochees : repli %u, calme %u", s.backoff, s.calmWindows);
+  printf("%-34s %s\n", "repli par quarts de budget", failures == before ? "OK" : "ECHEC");
+
+  // 5. Bornes de la période
+  before = failures;
+  nowMs = 0;
+  refreshSchedulerInit(s, 8, 4000, nowMs, CPU_MHZ);   // 250 Hz, budget 25 %
+  s.drawTime = REFRESH_MIN_DRAW_TIME;
+  runWindow(s, 100, 3000, 3000);                       // 12000 us nécessaires
+  CHECK(s.periodUs == REFRESH_MAX_PERIOD_US, "periode %u us au-dela de %u", s.periodUs, REFRESH_MAX_PERIOD_US);
+  runWindow(s, 100, 100, 7900);                        // pic d'ISR : 5/4 x 7900 > 8000
+  CHECK(s.periodUs == REFRESH_MAX_PERIOD_US, "pic d'ISR : periode %u us", s.periodUs);
+  runWindow(s, 100, 100, 4000);                        // 5/4 x 4000 = 5000 > 4000 (cible)
+  CHECK(s.periodUs == 5000, "pic d'ISR : periode %u us, attendu 5000", s.periodUs);
+  runWindow(s, 100, 100, 100);
+  CHECK(s.periodUs == 4000, "retour a la cible : periode %u us", s.periodUs);
+  // Cible au-delà de 1 kHz (profil modifié) : période bornée à 1000 us
+  s.profile.targetHz = 2000;
+  runWindow(s, 100, 50, 60);
+  CHECK(s.periodUs == REFRESH_MIN_PERIOD_US, "2 kHz : periode %u us sous %u", s.periodUs, REFRESH_MIN_PERIOD_US);
+  printf("%-34s %s (%u a %u us)\n", "bornes de la periode", failures == before ? "OK" : "ECHEC",
+         REFRESH_MIN_PERIOD_US, REFRESH_MAX_PERIOD_US);
+
+  return nativeCheckSummary();
+}
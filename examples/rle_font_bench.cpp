@@ -0,0 +1,157 @@
+/**
+ * Banc natif (PC) des polices RLE (src/RleFont.h)
+ *
+ * 1. Vérification : pour chaque glyphe des trois polices DejaVu Latin-1,
+ *    tailles 1 à 3, rleDrawChar() doit produire le même framebuffer que
+ *    drawChar() avec le GFXfont 1 bpp d'origine.
+ * 2. Comparaison taille / vitesse : octets de glyphes (bitmap 1 bpp vs
+ *    plages RLE) et, pour des textes typiques du compte à rebours, temps par
+ *    texte, primitives de dessin appelées (writePixel / writeFillRect par bit
+ *    pour print, un segment par plage pour RLE) et pixels écrits.
+ *
+ * Lancement : pio run -e native_rle_font_bench -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#include "DejaVuSansOblique9ptLat1.h"
+#include "DejaVuSans9ptLat1Rle.h"
+#include "DejaVuSansBold9ptLat1Rle.h"
+#include "DejaVuSansOblique9ptLat1Rle.h"
+
+struct BenchFont {
+  const char *name;
+  const GFXfont *gfx;
+  const RleFont *rle;
+  uint32_t bitmapBytes;
+};
+
+static const BenchFont fonts[] = {
+  { "DejaVuSans", &DejaVuSans9ptLat1, &DejaVuSans9pt8bRle, sizeof(DejaVuSans9pt8bBitmaps) },
+  { "DejaVuSans Bold", &DejaVuSans_Bold9pt8b, &DejaVuSans_Bold9pt8bRle, sizeof(DejaVuSans_Bold9pt8bBitmaps) },
+  { "DejaVuSans Oblique", &DejaVuSans_Oblique9pt8b, &DejaVuSans_Oblique9pt8bRle, sizeof(DejaVuSans_Oblique9pt8bBitmaps) },
+};
+
+// Compte les primitives appelées par le code de texte (hors appels internes)
+class CountingMatrix : public PxMATRIX {
+public:
+  using PxMATRIX::PxMATRIX;
+  uint32_t primitives = 0;
+  void writePixel(int16_t x, int16_t y, uint16_t c) override { Count n(this); PxMATRIX::writePixel(x, y, c); }
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override {
+    Count n(this); PxMATRIX::writeFillRect(x, y, w, h, c);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) override {
+    Count n(this); PxMATRIX::drawFastHLine(x, y, w, c);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override {
+    Count n(this); PxMATRIX::fillRect(x, y, w, h, c);
+  }
+private:
+  int depth = 0;
+  struct Count {
+    CountingMatrix *m;
+    explicit Count(CountingMatrix *cm) : m(cm) { if (m->depth++ == 0) m->primitives++; }
+    ~Count() { m->depth--; }
+  };
+};
+
+// Assez large pour un glyphe en taille 3 ; 256 px pour les textes (8 panneaux)
+static CountingMatrix ref(256, 64, 5, 4, 19, 23, 18);
+static CountingMatrix rle(256, 64, 5, 4, 19, 23, 18);
+
+static bool sameFramebuffers() {
+  return memcmp(ref.framebuffer(), rle.framebuffer(), 256 * 64 * sizeof(uint16_t)) == 0;
+}
+
+static int verifyFont(const BenchFont &f) {
+  int failures = 0;
+  ref.setTextWrap(false);
+  ref.setFont(f.gfx);
+  for (uint8_t size = 1; size <= 3; size++) {
+    for (int c = f.gfx->first; c <= f.gfx->last; c++) {
+      ref.fillScreen(0);
+      rle.fillScreen(0);
+      ref.drawChar(8, 40, (unsigned char)c, 0xFFFF, 0xFFFF, size, size);
+      rleDrawChar(rle, 8, 40, (unsigned char)c, *f.rle, size, 0xFFFF);
+      if (!sameFramebuffers()) {
+        if (failures < 5) printf("  ECHEC: %s taille %u glyphe 0x%02X\n", f.name, size, c);
+        failures++;
+      }
+    }
+  }
+  return failures;
+}
+
+struct Timing {
+  double ns;
+  double calls;
+  double pixels;
+};
+
+template <typename Draw>
+static Timing measure(CountingMatrix &d, uint32_t loops, Draw draw) {
+  d.fillScreen(0);
+  d.resetStats();
+  d.primitives = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) draw();
+  auto t1 = std::chrono::steady_clock::now();
+  Timing t;
+  t.ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / loops;
+  t.calls = (double)d.primitives / loops;
+  t.pixels = (double)d.stats().pixelsTouched / loops;
+  return t;
+}
+
+int main() {
+  printf("=== Polices RLE : verification et comparaison ===\n");
+  int failures = 0;
+  for (const BenchFont &f : fonts) {
+    int e = verifyFont(f);
+    printf("%-20s %3u glyphes x 3 tailles : %s\n", f.name, f.gfx->last - f.gfx->first + 1, e ? "ECHEC" : "identique a drawChar");
+    failures += e;
+  }
+
+  printf("\n%-20s %12s %12s %8s\n", "police", "bitmap 1bpp", "plages RLE", "gain");
+  uint32_t totalBitmap = 0, totalRle = 0;
+  for (const BenchFont &f : fonts) {
+    totalBitmap += f.bitmapBytes;
+    totalRle += f.rle->runsSize;
+    printf("%-20s %10u o %10u o %7.1f%%\n", f.name, f.bitmapBytes, f.rle->runsSize,
+           100.0 * ((double)f.bitmapBytes - f.rle->runsSize) / f.bitmapBytes);
+  }
+  printf("%-20s %10u o %10u o %7.1f%%\n", "total", totalBitmap, totalRle,
+         100.0 * ((double)totalBitmap - totalRle) / totalBitmap);
+
+  static const char *texts[] = { "12:34:56", "3D 05:59", "BONNE ANNEE 2026 !" };
+  printf("\n%-20s %-20s %6s %10s %10s %8s %8s %9s %9s\n", "police", "texte", "taille",
+         "print ns", "rle ns", "prim.", "prim.", "pixels", "pixels");
+  printf("%-20s %-20s %6s %10s %10s %8s %8s %9s %9s\n", "", "", "", "", "", "print", "rle", "print", "rle");
+  for (const BenchFont &f : fonts) {
+    for (const char *text : texts) {
+      for (uint8_t size = 1; size <= 2; size++) {
+        ref.setFont(f.gfx);
+        ref.setTextSize(size);
+        ref.setTextColor(0xF800);
+        Timing a = measure(ref, 2000, [&]() { ref.setCursor(0, 30); ref.print(text); });
+        Timing b = measure(rle, 2000, [&]() { rleDrawText(rle, 0, 30, text, *f.rle, size, 0xF800); });
+        if (!sameFramebuffers()) {
+          printf("  ECHEC: %s \"%s\" taille %u differe de print\n", f.name, text, size);
+          failures++;
+        }
+        printf("%-20s %-20s %6u %10.0f %10.0f %8.1f %8.1f %9.1f %9.1f\n", f.name, text, size,
+               a.ns, b.ns, a.calls, b.calls, a.pixels, b.pixels);
+      }
+    }
+  }
+  ref.setFont();
+
+  printf("\n%s (%d ecart(s))\n", failures == 0 ? "SUCCES" : "ECHEC", failures);
+  return failures == 0 ? 0 : 1;
+}
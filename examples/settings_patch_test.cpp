@@ -0,0 +1,263 @@
+/**
+ * Test natif (PC) de POST /api/settings (src/JsonPatch.h,
+ * examples/CountdownSettings.h)
+ *
+ * 1. Corps valides : seuls les membres présents changent, les autres
+ *    gardent la valeur de la copie ; échappements du titre (\", \u00c9,
+ *    paire de substitution), booléens true/false/0/1, espaces.
+ * 2. Bornes : pour chaque champ entier de la table, min et max acceptés,
+ *    min-1 et max+1 refusés.
+ * 3. Corps refusés, message « clé: raison » : clé inconnue, type
+ *    inattendu, fraction, exposant, objet ou tableau imbriqué, virgule
+ *    finale, données après l'objet, chaque préfixe tronqué d'un corps
+ *    valide, titre trop long / vide / UTF-8 invalide / \u0000, surrogate
+ *    isolé, 31 avril, 29 février hors année bissextile. Configuration
+ *    publiée déjà hors du mois (31 février de l'ancien /settings) : seuls
+ *    les corps qui touchent à la date sont vérifiés.
+ * 4. Aller-retour : countdownSettingsToJson() (réponse de /getSettings)
+ *    relu par countdownSettingsPatch() redonne la même structure ; pire cas
+ *    dans SETTINGS_JSON_SIZE.
+ * 5. Tas : aucune allocation (operator new global).
+ *
+ * Lancement : pio run -e native_settings_patch_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include "CountdownSettings.h"
+#include "NativeCheck.h"
+
+// --- Compteur d'allocations : operator new global ---
+static bool heapArmed = false;
+static uint32_t heapAllocations = 0;
+
+void *operator new(size_t n) {
+  void *p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  if (heapArmed) heapAllocations++;
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+// SETTINGS_JSON_SIZE de examples/fullscreen_countdown_web.cpp
+#define SETTINGS_JSON_SIZE 1280
+#define NFIELDS (sizeof(countdownSettingsFields) / sizeof(countdownSettingsFields[0]))
+
+// Valeurs par défaut de loadSettings()
+static CountdownSettings defaults() {
+  CountdownSettings s;
+  memset(&s, 0, sizeof(s));
+  strcpy(s.title, "COUNTDOWN");
+  s.year = 2025; s.month = 12; s.day = 31; s.hour = 23; s.minute = 59; s.second = 0;
+  s.fontStyle = 0;
+  s.colorR = 0; s.colorG = 255; s.colorB = 0;
+  s.endColorR = 255; s.endColorG = 215; s.endColorB = 0;
+  s.endEffect = 0;
+  s.blinkEnabled = true; s.blinkIntervalMs = 500; s.blinkWindow = 10;
+  s.marqueeEnabled = true; s.marqueeIntervalMs = 40; s.marqueeGap = 24; s.marqueeMode = 0;
+  s.marqueeReturnIntervalMs = 60; s.marqueeBouncePauseLeftMs = 400; s.marqueeBouncePauseRightMs = 400;
+  s.marqueeOneShotDelayMs = 800; s.marqueeOneShotStopCenter = true; s.marqueeOneShotRestartSec = 0;
+  s.marqueeAccelEnabled = false; s.marqueeAccelStartIntervalMs = 80; s.marqueeAccelEndIntervalMs = 30;
+  s.marqueeAccelDurationMs = 3000;
+  s.brightness = -1;
+  return s;
+}
+
+static char err[64];
+
+static int patch(CountdownSettings &s, const char *json) {
+  return countdownSettingsPatch(s, json, strlen(json), err, sizeof(err));
+}
+
+// Corps refusé avec un message commençant par prefix
+static void expectReject(const char *json, const char *prefix) {
+  CountdownSettings s = defaults();
+  const int n = patch(s, json);
+  CHECK(n == -1, "%s : accepte (%d)", json, n);
+  CHECK(strncmp(err, prefix, strlen(prefix)) == 0, "%s : message \"%s\", attendu \"%s...\"", json, err, prefix);
+}
+
+static int intField(const CountdownSettings &s, const JsonPatchField &f) {
+  int v;
+  memcpy(&v, (const uint8_t *)&s + f.offset, sizeof(v));
+  return v;
+}
+
+int main() {
+  printf("=== Test natif POST /api/settings (JsonPatch.h) ===\n\n");
+
+  // 1. Corps valides
+  int before = failures;
+  {
+    CountdownSettings s = defaults();
+    const CountdownSettings ref = defaults();
+    CHECK(patch(s, "{\"marqueeGap\":32}") == 1, "marqueeGap : %s", err);
+    CHECK(s.marqueeGap == 32, "marqueeGap = %d", s.marqueeGap);
+    CountdownSettings expect = ref;
+    expect.marqueeGap = 32;
+    CHECK(memcmp(&s, &expect, sizeof(s)) == 0, "marqueeGap : autres champs modifies");
+
+    s = defaults();
+    CHECK(patch(s, " { \"title\" : \"FIN \\\"2026\\\"\" ,\n\t\"blinkEnabled\":false, \"marqueeEnabled\":0,"
+                   "\"marqueeAccelEnabled\":true,\"marqueeOneShotStopCenter\":1 } ") == 5, "booleens : %s", err);
+    CHECK(strcmp(s.title, "FIN \"2026\"") == 0, "titre echappe : %s", s.title);
+    CHECK(!s.blinkEnabled && !s.marqueeEnabled && s.marqueeAccelEnabled && s.marqueeOneShotStopCenter,
+          "booleens : %d %d %d %d", s.blinkEnabled, s.marqueeEnabled, s.marqueeAccelEnabled,
+          s.marqueeOneShotStopCenter);
+
+    s = defaults();
+    CHECK(patch(s, "{\"title\":\"\\u00c9T\\u00c9 \\ud83c\\udf89\"}") == 1, "\\u : %s", err);
+    CHECK(strcmp(s.title, "\xC3\x89T\xC3\x89 \xF0\x9F\x8E\x89") == 0, "\\u : titre %s", s.title);
+
+    s = defaults();
+    CHECK(patch(s, "{\"title\":\"BONNE ANNÉE\",\"brightness\":-1,\"year\":2028,\"month\":2,\"day\":29}") == 5,
+          "29 fevrier bissextile : %s", err);
+    CHECK(s.year == 2028 && s.month == 2 && s.day == 29, "date %d-%d-%d", s.year, s.month, s.day);
+
+    s = defaults();
+    CHECK(patch(s, "{}") == 0 && memcmp(&s, &ref, sizeof(s)) == 0, "objet vide : %s", err);
+  }
+  printf("%-34s %s\n", "corps valides", failures == before ? "OK" : "ECHEC");
+
+  // 2. Bornes de chaque champ entier
+  before = failures;
+  uint32_t intFields = 0;
+  for (size_t i = 0; i < NFIELDS; i++) {
+    const JsonPatchField &f = countdownSettingsFields[i];
+    if (f.type != JSON_PATCH_INT) continue;
+    intFields++;
+    char json[96];
+    const int32_t edges[4] = { f.min, f.max, f.min - 1, f.max + 1 };
+    for (int k = 0; k < 4; k++) {
+      CountdownSettings s = defaults();
+      s.day = 1;   // jour valide quel que soit le mois essayé
+      snprintf(json, sizeof(json), "{\"%s\":%ld}", f.key, (long)edges[k]);
+      const int n = patch(s, json);
+      if (k < 2) {
+        CHECK(n == 1 && intField(s, f) == edges[k], "%s : refuse (%s)", json, err);
+      } else {
+        CHECK(n == -1, "%s : accepte", json);
+        char expect[48];
+        snprintf(expect, sizeof(expect), "%s: hors bornes", f.key);
+        CHECK(strcmp(err, expect) == 0, "%s : message \"%s\"", json, err);
+      }
+    }
+  }
+  printf("%-34s %s (%u champs entiers)\n", "bornes par champ", failures == before ? "OK" : "ECHEC", intFields);
+
+  // 3. Corps refusés
+  before = failures;
+  expectReject("{\"marqueeGapp\":32}", "marqueeGapp: cle inconnue");
+  expectReject("{\"marqueeGap\":\"32\"}", "marqueeGap: entier attendu");
+  expectReject("{\"marqueeGap\":32.5}", "marqueeGap: entier invalide");
+  expectReject("{\"marqueeGap\":3e1}", "marqueeGap: entier invalide");
+  expectReject("{\"marqueeGap\":99999999999}", "marqueeGap: entier invalide");
+  expectReject("{\"marqueeGap\":{\"v\":32}}", "marqueeGap: entier attendu");
+  expectReject("{\"marqueeGap\":[32]}", "marqueeGap: entier attendu");
+  expectReject("{\"title\":32}", "title: chaine attendue");
+  expectReject("{\"blinkEnabled\":2}", "blinkEnabled: booleen attendu");
+  expectReject("{\"blinkEnabled\":\"true\"}", "blinkEnabled: booleen attendu");
+  expectReject("{\"marqueeGap\":32,}", "cle attendue");
+  expectReject("{\"marqueeGap\":32 \"marqueeMode\":1}", "marqueeGap: ',' ou '}' attendu");
+  expectReject("{\"marqueeGap\":32}x", "donnees apres l'objet");
+  expectReject("{\"marqueeGap\":32}{}", "donnees apres l'objet");
+  expectReject("[{\"marqueeGap\":32}]", "objet JSON attendu");
+  expectReject("", "objet JSON attendu");
+  expectReject("{\"title\":\"123456789012345678901234567890123456789012345678901\"}", "title: trop long");
+  expectReject("{\"title\":\"\"}", "title: vide");
+  expectReject("{\"title\":\"A\\u0000B\"}", "title: caractere nul");
+  expectReject("{\"title\":\"\\ud83c\"}", "title: chaine mal formee");
+  expectReject("{\"title\":\"\\udf89\"}", "title: chaine mal formee");
+  expectReject("{\"title\":\"\\q\"}", "title: chaine mal formee");
+  expectReject("{\"title\":\"A\nB\"}", "title: chaine mal formee");
+  expectReject("{\"title\":\"\xC3\"}", "title: UTF-8 invalide");
+  expectReject("{\"title\":\"\xC0\xAF\"}", "title: UTF-8 invalide");
+  expectReject("{\"title\":\"\xED\xA0\x80\"}", "title: UTF-8 invalide");
+  expectReject("{\"month\":4,\"day\":31}", "day: hors du mois");
+  expectReject("{\"year\":2026,\"month\":2,\"day\":29}", "day: hors du mois");
+  expectReject("{\"year\":2100,\"month\":2,\"day\":28}", "year: hors bornes");
+  {
+    // Configuration publiée déjà invalide : le jour n'est vérifié que si le
+    // corps modifie la date
+    CountdownSettings s = defaults();
+    s.month = 2; s.day = 31;
+    CHECK(patch(s, "{\"marqueeGap\":32}") == 1 && s.marqueeGap == 32, "31 fevrier publie, marqueeGap : %s", err);
+    CHECK(patch(s, "{\"title\":\"FIN\",\"brightness\":10}") == 2, "31 fevrier publie, titre : %s", err);
+    CHECK(patch(s, "{\"day\":31}") == -1 && strcmp(err, "day: hors du mois") == 0, "31 fevrier renvoye : %s", err);
+    s.day = 31;
+    CHECK(patch(s, "{\"year\":2026}") == -1 && strcmp(err, "day: hors du mois") == 0, "annee seule : %s", err);
+    s.year = 2025; s.day = 31;
+    CHECK(patch(s, "{\"month\":3}") == 1 && s.month == 3 && s.day == 31, "mois corrige : %s", err);
+  }
+  {
+    // Titre de 50 octets accepté, 51 refusé même en UTF-8 (É = 2 octets)
+    CountdownSettings s = defaults();
+    CHECK(patch(s, "{\"title\":\"ÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉ\"}") == 1 && strlen(s.title) == 50, "titre 50 octets : %s",
+          err);
+    expectReject("{\"title\":\"ÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉÉA\"}", "title: trop long");
+  }
+  // Chaque préfixe strict d'un corps valide est refusé
+  const char *full = "{\"title\":\"F\\u00c9TE\",\"marqueeGap\":32,\"blinkEnabled\":true,\"brightness\":-1}";
+  uint32_t truncated = 0;
+  for (size_t len = 0; len < strlen(full); len++) {
+    CountdownSettings s = defaults();
+    const int n = countdownSettingsPatch(s, full, len, err, sizeof(err));
+    CHECK(n == -1, "prefixe de %u octets accepte", (unsigned)len);
+    truncated++;
+  }
+  printf("%-34s %s (%u prefixes tronques)\n", "corps refuses", failures == before ? "OK" : "ECHEC", truncated);
+
+  // 4. Aller-retour /getSettings -> /api/settings
+  before = failures;
+  char json[SETTINGS_JSON_SIZE];
+  {
+    CountdownSettings src = defaults();
+    strcpy(src.title, "NOËL \"2026\"\\");
+    src.endEffect = 3; src.brightness = 200; src.blinkEnabled = false; src.marqueeMode = 2;
+    const size_t len = countdownSettingsToJson(src, json, sizeof(json));
+    CHECK(len > 0, "countdownSettingsToJson : debordement");
+    CountdownSettings dst = defaults();
+    strcpy(dst.title, "AUTRE");
+    dst.marqueeGap = 100;
+    const int n = countdownSettingsPatch(dst, json, len, err, sizeof(err));
+    CHECK(n == (int)NFIELDS, "aller-retour : %d champ(s), %s", n, err);
+    CHECK(memcmp(&src, &dst, sizeof(src)) == 0, "aller-retour : structures differentes");
+  }
+  // Pire cas : titre de 50 caractères de contrôle, bornes négatives ou maximales
+  size_t worst = 0;
+  {
+    CountdownSettings s = defaults();
+    memset(s.title, 0x01, 50);
+    s.title[50] = '\0';
+    for (size_t i = 0; i < NFIELDS; i++) {
+      const JsonPatchField &f = countdownSettingsFields[i];
+      if (f.type != JSON_PATCH_INT) continue;
+      const int v = f.min < 0 ? (int)f.min : (int)f.max;
+      memcpy((uint8_t *)&s + f.offset, &v, sizeof(v));
+    }
+    worst = countdownSettingsToJson(s, json, sizeof(json));
+    CHECK(worst > 0, "pire cas > SETTINGS_JSON_SIZE");
+  }
+  printf("%-34s %s (pire cas %u / %u octets)\n", "aller-retour /getSettings", failures == before ? "OK" : "ECHEC",
+         (unsigned)worst, SETTINGS_JSON_SIZE);
+
+  // 5. Allocations
+  before = failures;
+  {
+    CountdownSettings s = defaults();
+    const size_t len = countdownSettingsToJson(s, json, sizeof(json));
+    heapAllocations = 0;
+    heapArmed = true;
+    const int n = countdownSettingsPatch(s, json, len, err, sizeof(err));
+    patch(s, "{\"marqueeGap\":3}");
+    heapArmed = false;
+    CHECK(n == (int)NFIELDS, "corps complet : %s", err);
+    CHECK(heapAllocations == 0, "%u allocation(s)", heapAllocations);
+  }
+  printf("%-34s %s (%u allocation(s))\n", "tas par requete", failures == before ? "OK" : "ECHEC", heapAllocations);
+
+  return nativeCheckSummary();
+}
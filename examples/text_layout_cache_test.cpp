@@ -0,0 +1,118 @@
+/**
+ * Test natif (PC) du cache LRU des layouts de texte (src/TextLayoutCache.h)
+ *
+ * 1. Layout en cache == getTextBounds() (boîte et x1) et run == glyphRunBuild,
+ *    pour la police 5x7 intégrée et les polices DejaVu, tailles 1 à 3, que
+ *    l'entrée soit construite, retrouvée ou dérivée d'une autre taille de la
+ *    famille (re-mesure du run).
+ * 2. Politique LRU : au-delà de TEXT_LAYOUT_CACHE_SIZE textes, l'entrée la
+ *    moins récemment utilisée est remplacée ; une entrée relue est gardée.
+ * 3. Rotation date / texte / countdown du défilement : succès à chaque tour
+ *    après le premier.
+ *
+ * Lancement : pio run -e native_text_layout_cache_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <PxMatrix.h>
+#include <stdio.h>
+#include <string.h>
+#include "FontMetrics.h"
+#include "FontFamily.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "TextLayoutCache.h"
+#include "DejaVuSans9ptLat1.h"
+#include "DejaVuSansBold9ptLat1.h"
+#define FONT_FAMILY_MAX_HEIGHT 32
+#include "fonts/DejaVuFontFamily.h"
+#include "NativeCheck.h"
+
+static PxMATRIX display(96, 16, 5, 4, 19, 23, 18);
+
+// Textes sans accents : même octets pour getTextBounds et pour le décodage UTF-8
+static const char *texts[] = {
+  "MERCREDI, 31-12-2025", "ESP32 P10 RGB Digital Clock", "NEW YEAR: 12d 03h 45m 06s",
+  "12:34:56", "FIN !", "BONNE ANNEE 2026 !", "42",
+};
+
+static void checkLayout(const TextLayout &l, const char *text, const GFXfont *font, uint8_t size, const char *how) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  display.setFont(font);
+  display.setTextSize(size);
+  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  bool ok = l.w == w && l.h == h && (w == 0 || l.x1 == x1) && (h == 0 || l.y1 == y1);
+  if (font) {
+    GlyphRun ref;
+    glyphRunBuild(ref, text, font);
+    ok = ok && l.run.length == ref.length && memcmp(l.run.glyph, ref.glyph, ref.length) == 0;
+  }
+  CHECK(ok, "%s \"%s\" taille %u (%s) : %ux%u en (%d,%d) / %ux%u en (%d,%d)", font ? "DejaVu" : "5x7",
+        text, size, how, l.w, l.h, l.x1, l.y1, w, h, x1, y1);
+}
+
+int main() {
+  printf("=== Cache LRU des layouts de texte ===\n");
+  display.setTextWrap(false);
+  static TextLayoutCache cache;
+
+  // 1. Exactitude : construit, retrouvé
+  const GFXfont *fonts[] = { nullptr, &DejaVuSans9ptLat1, &DejaVuSans_Bold9pt8b };
+  int before = failures;
+  for (const GFXfont *font : fonts) {
+    for (uint8_t size = 1; size <= 3; size++) {
+      for (const char *text : texts) {
+        textLayoutCacheClear(cache);
+        checkLayout(textLayoutGet(cache, text, font, size), text, font, size, "construit");
+        checkLayout(textLayoutGet(cache, text, font, size), text, font, size, "en cache");
+        CHECK(cache.hits == 1 && cache.misses == 1, "compteurs %u / %u", (unsigned)cache.hits, (unsigned)cache.misses);
+      }
+    }
+  }
+  // Dérivé d'une autre taille de la famille (run re-mesuré)
+  const FontFamily &family = DejaVuSansBoldFamily;
+  for (const char *text : texts) {
+    textLayoutCacheClear(cache);
+    for (uint8_t i = 0; i < family.count; i++) {
+      const uint8_t k = (i * 5) % family.count;  // ordre mélangé, comme la dichotomie
+      checkLayout(textLayoutGet(cache, text, family.entries[k].font, 1), text, family.entries[k].font, 1, "derive");
+    }
+  }
+  display.setTextSize(1);
+  display.setFont();
+  printf("%-32s %s\n", "layouts == getTextBounds", failures == before ? "OK" : "ECHEC");
+
+  // 2. LRU : TEXT_LAYOUT_CACHE_SIZE + 1 textes, le premier relu avant le dernier
+  before = failures;
+  textLayoutCacheClear(cache);
+  char names[TEXT_LAYOUT_CACHE_SIZE + 1][8];
+  for (int i = 0; i <= TEXT_LAYOUT_CACHE_SIZE; i++) snprintf(names[i], sizeof(names[i]), "T%d", i);
+  for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++) textLayoutGet(cache, names[i], &DejaVuSans9ptLat1, 1);
+  textLayoutGet(cache, names[0], &DejaVuSans9ptLat1, 1);                      // T0 relu
+  textLayoutGet(cache, names[TEXT_LAYOUT_CACHE_SIZE], &DejaVuSans9ptLat1, 1); // remplace T1
+  uint32_t misses = cache.misses;
+  textLayoutGet(cache, names[0], &DejaVuSans9ptLat1, 1);
+  CHECK(cache.misses == misses, "T0 relu puis remplace");
+  textLayoutGet(cache, names[1], &DejaVuSans9ptLat1, 1);
+  CHECK(cache.misses == misses + 1, "T1 (moins recent) encore en cache");
+  textLayoutGet(cache, names[0], &DejaVuSans9ptLat1, 2);
+  CHECK(cache.misses == misses + 2, "taille differente retrouvee");
+  textLayoutGet(cache, names[0], &DejaVuSans_Bold9pt8b, 1);
+  CHECK(cache.misses == misses + 3, "police differente retrouvee");
+  printf("%-32s %s (%u entrees)\n", "remplacement LRU", failures == before ? "OK" : "ECHEC", TEXT_LAYOUT_CACHE_SIZE);
+
+  // 3. Rotation du défilement (police 5x7, comme getTextWidth de ClockRender.h)
+  textLayoutCacheClear(cache);
+  const char *rotation[] = { texts[0], texts[1], texts[2] };
+  for (int round = 0; round < 10; round++) {
+    for (const char *text : rotation) textLayoutGet(cache, text, nullptr, 1);
+  }
+  CHECK(cache.misses == 3 && cache.hits == 27, "rotation : %u succes, %u echecs", (unsigned)cache.hits, (unsigned)cache.misses);
+  char json[96];
+  textLayoutCacheToJson(cache, json, sizeof(json));
+  printf("%-32s %u succes, %u echecs  %s\n", "rotation date/texte/countdown", (unsigned)cache.hits,
+         (unsigned)cache.misses, json);
+
+  return nativeCheckSummary();
+}
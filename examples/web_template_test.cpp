@@ -0,0 +1,258 @@
+/**
+ * Test natif (PC) de l'envoi de page à marqueurs sans copie (src/WebTemplate.h)
+ *
+ * 1. webSendTemplate() envoie exactement la page obtenue par remplacements
+ *    successifs (String::replace de l'ancien handleRoot), Content-Length
+ *    compris : page de la taille de MAIN_page du compte à rebours, marqueurs
+ *    collés, en tête, en fin, absents, valeur vide, préfixes de marqueurs.
+ *    webTemplateRead() (serveur asynchrone) redonne la même page lue par
+ *    fenêtres de 1 octet à plus que la page.
+ * 2. Tas par requête : compteur d'allocations (operator new / malloc de
+ *    l'ancien chemin émulé) ; le nouveau chemin ne doit rien allouer.
+ *    L'ancien chemin copie la page dans une String puis réalloue à chaque
+ *    replace() plus long (WString.cpp : copy() puis changeBuffer()).
+ *
+ * Lancement : pio run -e native_web_template_test -t exec  (code de sortie != 0 si écart)
+ */
+
+#include <Arduino.h>
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "NativeCheck.h"
+
+// --- Compteur de tas : operator new global + malloc/realloc de l'ancien chemin ---
+struct HeapCounter {
+  bool armed;
+  uint32_t allocations;
+  size_t live, peak;
+};
+static HeapCounter heap;
+
+static void heapAdd(size_t n) {
+  if (!heap.armed) return;
+  heap.allocations++;
+  heap.live += n;
+  if (heap.live > heap.peak) heap.peak = heap.live;
+}
+
+static void heapRelease(size_t n) {
+  if (heap.armed) heap.live -= n;
+}
+
+static void heapArm() {
+  memset(&heap, 0, sizeof(heap));
+  heap.armed = true;
+}
+
+// En-tête de taille devant chaque bloc pour décompter à la libération
+void *operator new(size_t n) {
+  size_t *p = (size_t *)malloc(n + sizeof(size_t));
+  if (!p) throw std::bad_alloc();
+  *p = n;
+  heapAdd(n);
+  return p + 1;
+}
+void operator delete(void *ptr) noexcept {
+  if (!ptr) return;
+  size_t *p = (size_t *)ptr - 1;
+  heapRelease(*p);
+  free(p);
+}
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+
+// --- WebServer de substitution : réponse écrite dans un buffer statique ---
+#define RESPONSE_MAX 65536
+class WebServer {
+public:
+  char body[RESPONSE_MAX];
+  size_t bodyLength;
+  size_t contentLength;
+  int code;
+  uint32_t writes;
+
+  void setContentLength(size_t n) { contentLength = n; }
+  void send(int c, const char *, const char *content) {
+    code = c;
+    bodyLength = 0;
+    writes = 0;
+    sendContent_P(content, strlen(content));
+  }
+  void sendContent_P(PGM_P content, size_t n) {
+    if (n == 0) return;
+    if (bodyLength + n <= RESPONSE_MAX) memcpy(body + bodyLength, content, n);
+    bodyLength += n;
+    writes++;
+  }
+};
+
+#include "WebTemplate.h"
+
+static WebServer server;
+
+// --- Ancien chemin : String page = MAIN_page; page.replace(...) x3 ---
+// Émulation de WString (ESP32) : buffer exact au constructeur, replace() en
+// place si la valeur est plus courte, sinon realloc à la taille finale
+struct LegacyString {
+  char *buf;
+  size_t len, capacity;
+
+  explicit LegacyString(const char *s) {
+    len = capacity = strlen(s);
+    buf = (char *)malloc(capacity + 1);
+    heapAdd(capacity + 1);
+    memcpy(buf, s, len + 1);
+  }
+  ~LegacyString() {
+    heapRelease(capacity + 1);
+    free(buf);
+  }
+  void replace(const char *find, const char *repl) {
+    const size_t fl = strlen(find), rl = strlen(repl);
+    size_t count = 0;
+    for (const char *p = strstr(buf, find); p; p = strstr(p + fl, find)) count++;
+    if (count == 0) return;
+    const size_t size = len + count * rl - count * fl;
+    if (size > capacity) {
+      heapAdd(size + 1);            // nouveau bloc avant libération de l'ancien
+      heapRelease(capacity + 1);
+      buf = (char *)realloc(buf, size + 1);
+      capacity = size;
+    }
+    heap.armed = false;          // copie de travail hors compteur : seul le résultat importe ici
+    {
+      std::string out;
+      out.reserve(size);
+      const char *p = buf;
+      for (const char *q = strstr(p, find); q; q = strstr(p, find)) {
+        out.append(p, q - p);
+        out.append(repl);
+        p = q + fl;
+      }
+      out.append(p);
+      memcpy(buf, out.c_str(), size + 1);
+    }
+    len = size;
+    heap.armed = true;
+  }
+};
+
+// Référence : remplacements successifs (hors compteur)
+static std::string expectedPage(const char *page, const WebTemplateField *fields, size_t count) {
+  std::string s = page;
+  for (size_t i = 0; i < count; i++) {
+    const size_t fl = strlen(fields[i].marker);
+    if (fl == 0) continue;
+    for (size_t at = s.find(fields[i].marker); at != std::string::npos;
+         at = s.find(fields[i].marker, at + strlen(fields[i].value))) {
+      s.replace(at, fl, fields[i].value);
+    }
+  }
+  return s;
+}
+
+static const WebTemplateField countdownFields[] = {
+  { "v__FWVER__", "1.0.0" },
+  { "__AUTHOR_NAME__", "Cl\xC3\xA9ment Saillant (electron-rare)" },
+  { "__GITHUB_URL__", "https://github.com/electron-rare" },
+};
+
+static void checkSend(const char *name, const char *page, const WebTemplateField *fields, size_t count) {
+  heap.armed = false;
+  const std::string expected = expectedPage(page, fields, count);
+  heapArm();
+  webSendTemplate(server, 200, "text/html", page, fields, count);
+  heap.armed = false;
+  CHECK(server.code == 200 && server.contentLength == expected.size() && server.bodyLength == expected.size() &&
+        memcmp(server.body, expected.data(), expected.size()) == 0,
+        "%s : %u octets envoyes, Content-Length %u, attendu %u", name, (unsigned)server.bodyLength,
+        (unsigned)server.contentLength, (unsigned)expected.size());
+  CHECK(heap.allocations == 0, "%s : %u allocation(s)", name, heap.allocations);
+}
+
+// Page de la taille de MAIN_page (compte à rebours) : marqueurs aux mêmes endroits
+static char countdownPage[40000];
+
+static void buildCountdownPage() {
+  std::string s = "<!DOCTYPE html><html lang=\"fr\"><head>\n<meta charset=\"utf-8\" />\n"
+                  "<meta name=\"author\" content=\"__AUTHOR_NAME__\">\n";
+  const char *css = ".card{background:#1b1b1b;border:1px solid #333;border-radius:8px;padding:.8rem}\n";
+  while (s.size() < 11000) s += css;
+  s += "<footer>ESP32 P10 RGB Fullscreen Countdown \xE2\x80\xA2 2025 \xE2\x80\xA2 __AUTHOR_NAME__ (<a href=\"__GITHUB_URL__\">"
+       "GitHub</a>) \xE2\x80\xA2 <a href=\"/about\">\xC3\x80 propos</a></footer>\n<script>\n";
+  const char *js = "function el(i){return document.getElementById(i);} // __AUTHOR sans fin, __GITHUB_\n";
+  while (s.size() < 33000) s += js;
+  s += "document.getElementById('fwVer').textContent = 'v__FWVER__';\n";
+  while (s.size() < 36200) s += js;
+  s += "</script>\n</body></html>\n";
+  strcpy(countdownPage, s.c_str());
+}
+
+int main() {
+  printf("=== Page a marqueurs envoyee sans copie ===\n");
+  buildCountdownPage();
+  const size_t nFields = sizeof(countdownFields) / sizeof(countdownFields[0]);
+
+  // 1. Exactitude
+  checkSend("page compte a rebours", countdownPage, countdownFields, nFields);
+  const uint32_t writes = server.writes;
+  const size_t pageLength = server.bodyLength;
+  static char sent[RESPONSE_MAX];
+  memcpy(sent, server.body, pageLength);
+  checkSend("sans marqueur", "<html><body>rien</body></html>", countdownFields, nFields);
+  checkSend("marqueurs en tete et en fin", "__GITHUB_URL__ milieu v__FWVER__", countdownFields, nFields);
+  checkSend("marqueurs colles", "__AUTHOR_NAME____AUTHOR_NAME__v__FWVER____GITHUB_URL__", countdownFields, nFields);
+  checkSend("page = marqueur", "__AUTHOR_NAME__", countdownFields, nFields);
+  checkSend("prefixes", "__AUTHOR_NAME_ _AUTHOR_NAME__ v__FWVER_ __GITHUB_URL", countdownFields, nFields);
+  checkSend("page vide", "", countdownFields, nFields);
+  const WebTemplateField empty[] = { { "__X__", "" }, { "__Y__", "y" } };
+  checkSend("valeur vide", "a__X__b__Y__c__X__", empty, 2);
+  checkSend("aucun champ", countdownPage, countdownFields, 0);
+  printf("%-34s %s (%u octets en %u ecritures)\n", "reponse == replace() successifs",
+         failures == 0 ? "OK" : "ECHEC", (unsigned)pageLength, writes);
+
+  // Lecture par fenêtres (remplissage à la demande du serveur asynchrone)
+  int before = failures;
+  static const size_t windows[] = { 1, 7, 64, 1436, 5744, RESPONSE_MAX };
+  static uint8_t reread[RESPONSE_MAX];
+  for (size_t window : windows) {
+    size_t index = 0, n;
+    heapArm();
+    while ((n = webTemplateRead(countdownPage, countdownFields, nFields, reread + index, window, index)) > 0) {
+      index += n;
+      if (index > pageLength) break;
+    }
+    heap.armed = false;
+    CHECK(index == pageLength && memcmp(reread, sent, pageLength) == 0, "fenetre %u : %u octets relus",
+          (unsigned)window, (unsigned)index);
+    CHECK(heap.allocations == 0, "fenetre %u : %u allocation(s)", (unsigned)window, heap.allocations);
+  }
+  printf("%-34s %s (fenetres 1 a %u octets)\n", "webTemplateRead == page envoyee",
+         failures == before ? "OK" : "ECHEC", RESPONSE_MAX);
+
+  // 2. Tas par requête, ancien chemin
+  heapArm();
+  {
+    LegacyString page(countdownPage);
+    page.replace("v__FWVER__", countdownFields[0].value);
+    page.replace("__AUTHOR_NAME__", countdownFields[1].value);
+    page.replace("__GITHUB_URL__", countdownFields[2].value);
+    CHECK(page.len == pageLength && memcmp(page.buf, sent, pageLength) == 0, "ancien chemin : page differente");
+  }
+  heap.armed = false;
+  const size_t legacyPeak = heap.peak;
+  const uint32_t legacyAllocations = heap.allocations;
+  heapArm();
+  webSendTemplate(server, 200, "text/html", countdownPage, countdownFields, nFields);
+  heap.armed = false;
+
+  printf("\nTas par requete (page %u octets)\n", (unsigned)strlen(countdownPage));
+  printf("  avant : String + 3 replace()     : %u allocations, pic %6u octets (realloc deplace)\n",
+         legacyAllocations, (unsigned)legacyPeak);
+  printf("                                     pic %6u octets (realloc en place)\n", (unsigned)(pageLength + 1));
+  printf("  apres : webSendTemplate()        : %u allocation,  pic %6u octets\n", heap.allocations, (unsigned)heap.peak);
+  CHECK(heap.allocations == 0 && heap.peak == 0, "nouveau chemin : %u allocation(s)", heap.allocations);
+
+  return nativeCheckSummary();
+}
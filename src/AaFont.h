@@ -0,0 +1,132 @@
+/**
+ * Polices anti-aliasées 2 / 4 bits par pixel, tracées par rampe de couleurs
+ *
+ * Format produit par tools/_fontbuild/fontconvert_aa.c (ou
+ * generate_latin1_font.sh -a) : comme un GFXfont, mais chaque pixel de la
+ * boîte du glyphe porte un niveau de couverture sur bpp bits (MSB en premier,
+ * chaque glyphe commence sur un octet). Niveau 0 = transparent, niveau
+ * maximal = couleur pleine.
+ *
+ * Pas de multiplication par pixel : aaRampBuild() précalcule une fois par
+ * couleur de texte (et de fond) la couleur RGB565 de chaque niveau, le tracé
+ * n'est plus qu'une lecture de table. Les couleurs RGB565 de ce projet sont
+ * déjà corrigées gamma (color565Corrected) : la valeur RGB565 est
+ * proportionnelle au rapport cyclique PWM de PxMatrix, donc à la lumière
+ * émise, et l'interpolation linéaire canal par canal mélange correctement
+ * la couverture. Les niveaux intermédiaires passent par les plans de
+ * couleur (PWM) de PxMatrix comme toute autre couleur.
+ *
+ * Le fond n'est pas relu (PxMatrix ne l'expose pas) : la rampe suppose un
+ * fond uni connu, noir pour le compte à rebours (clearDisplay avant tracé).
+ * Taille 1 uniquement (tailles natives, voir FontFamily.h).
+ *
+ * Tracé sur toute matrice exposant drawPixelRGB565 (PxMATRIX ou FrameMirror,
+ * src/FrameSnapshot.h). Le compte à rebours plein écran trace en AA les
+ * textes retenus en 9 pt (examples/FullscreenCountdownRender.h).
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus PxMatrix.h.
+ * Comparaison avec le tracé 1 bpp : examples/aa_font_bench.cpp.
+ */
+#ifndef AAFONT_H
+#define AAFONT_H
+
+#include <stdint.h>
+
+#define AA_FONT_MAX_LEVELS 16
+
+struct AaFont {
+  const uint8_t *bitmap;   // niveaux de couverture de tous les glyphes
+  const GFXglyph *glyph;   // métriques GFX, bitmapOffset en octets dans bitmap
+  uint8_t first, last;
+  uint8_t yAdvance;
+  uint8_t bpp;             // 2 ou 4
+};
+
+// Couleur RGB565 de chaque niveau de couverture, pour un couple texte / fond
+struct AaRamp {
+  uint16_t color[AA_FONT_MAX_LEVELS];
+  uint16_t fg, bg;
+  uint8_t bpp;
+};
+
+// Canal du niveau level sur top : fond + (texte - fond) * level / top, arrondi
+inline int32_t aaMixChannel(int32_t fg, int32_t bg, int32_t level, int32_t top) {
+  int32_t delta = (fg - bg) * level * 2;
+  return bg + (delta >= 0 ? (delta + top) / (2 * top) : -((top - delta) / (2 * top)));
+}
+
+// Précalcule la rampe (2^bpp niveaux). À refaire quand la couleur change,
+// jamais par pixel.
+inline void aaRampBuild(AaRamp &ramp, uint16_t fg, uint16_t bg, uint8_t bpp) {
+  const int32_t top = (1 << bpp) - 1;
+  for (int32_t level = 0; level <= top; level++) {
+    int32_t r = aaMixChannel(fg >> 11, bg >> 11, level, top);
+    int32_t g = aaMixChannel((fg >> 5) & 0x3F, (bg >> 5) & 0x3F, level, top);
+    int32_t b = aaMixChannel(fg & 0x1F, bg & 0x1F, level, top);
+    ramp.color[level] = (uint16_t)((r << 11) | (g << 5) | b);
+  }
+  ramp.fg = fg;
+  ramp.bg = bg;
+  ramp.bpp = bpp;
+}
+
+// Trace le glyphe c au curseur (x, y = ligne de base). Retourne l'avance en pixels.
+template <class Matrix>
+inline int16_t aaDrawChar(Matrix &d, int16_t x, int16_t y, unsigned char c,
+                          const AaFont &font, const AaRamp &ramp) {
+  if (c < font.first || c > font.last) return 0;
+  const GFXglyph &g = font.glyph[c - font.first];
+  const int16_t w = g.width, h = g.height;
+  const int16_t gx = x + g.xOffset, gy = y + g.yOffset;
+  const int16_t screenW = d.width(), screenH = d.height();
+  if (w == 0 || gx >= screenW || gy >= screenH || gx + w <= 0 || gy + h <= 0) return g.xAdvance;
+
+  const uint8_t bpp = font.bpp;
+  const uint8_t mask = (1 << bpp) - 1;
+  const uint8_t *bits = font.bitmap + g.bitmapOffset;
+  const int16_t colFrom = (gx < 0) ? -gx : 0;
+  const int16_t colTo = (gx + w > screenW) ? screenW - gx : w;
+  const int16_t rowFrom = (gy < 0) ? -gy : 0;
+  const int16_t rowTo = (gy + h > screenH) ? screenH - gy : h;
+  for (int16_t row = rowFrom; row < rowTo; row++) {
+    uint32_t bit = ((uint32_t)row * w + colFrom) * bpp;
+    for (int16_t col = colFrom; col < colTo; col++, bit += bpp) {
+      uint8_t byte = bits[bit >> 3];
+      if (byte == 0) {                  // octet entièrement transparent
+        int16_t skip = (int16_t)((8 - (bit & 7)) / bpp) - 1;
+        col += skip;
+        bit += (uint32_t)skip * bpp;
+        continue;
+      }
+      uint8_t level = (byte >> (8 - bpp - (bit & 7))) & mask;
+      if (level) d.drawPixelRGB565(gx + col, gy + row, ramp.color[level]);
+    }
+  }
+  return g.xAdvance;
+}
+
+// Trace une chaîne (octets Latin-1, '\n' = ligne suivante). Retourne x final.
+template <class Matrix>
+inline int16_t aaDrawText(Matrix &d, int16_t x, int16_t y, const char *text,
+                          const AaFont &font, const AaRamp &ramp) {
+  const int16_t x0 = x;
+  for (const uint8_t *s = (const uint8_t *)text; *s; s++) {
+    if (*s == '\n') { x = x0; y += font.yAdvance; continue; }
+    if (*s == '\r') continue;
+    x += aaDrawChar(d, x, y, *s, font, ramp);
+  }
+  return x;
+}
+
+// Trace une suite d'indices de glyphes (code - font.first, comme GlyphRun.h)
+// sur une ligne. Retourne x final.
+template <class Matrix>
+inline int16_t aaDrawGlyphs(Matrix &d, int16_t x, int16_t y, const uint8_t *glyphs, uint8_t count,
+                            const AaFont &font, const AaRamp &ramp) {
+  for (uint8_t i = 0; i < count; i++) {
+    x += aaDrawChar(d, x, y, (unsigned char)(font.first + glyphs[i]), font, ramp);
+  }
+  return x;
+}
+
+#endif // AAFONT_H
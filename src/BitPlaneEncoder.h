@@ -0,0 +1,147 @@
+/**
+ * Encodeur de trame en plans de bits BCM (Binary Code Modulation)
+ *
+ * Transforme un framebuffer RGB565 en flux prêt à être décalé dans les
+ * registres des panneaux P10, une seule fois par trame modifiée. L'ISR de
+ * rafraîchissement n'aurait plus qu'à envoyer, pour chaque plan et chaque
+ * adresse de multiplexage, une ligne d'octets préparée, puis à allumer la
+ * ligne pendant bcmPlaneShowTime().
+ *
+ * Fonctions pures (aucune dépendance Arduino) : compilables et vérifiables
+ * sur PC, voir examples/bcm_encoder_test.cpp (pio run -e native_bcm_test -t exec).
+ *
+ * Disposition : celle du buffer de PxMatrix (fillMatrixBuffer, begin(rowPattern),
+ * ZAGZIG, BINARY), octet pour octet, afin de pouvoir un jour la substituer au
+ * remplissage pixel par pixel de la bibliothèque.
+ *  - Une ligne du flux (adresse a) contient 3 segments de
+ *    (height / rowPattern) * (width / 8) octets, envoyés B, G puis R ; chaque
+ *    segment chaîne les moitiés du panneau (R2 puis R1).
+ *  - Dans un segment, les lignes a, a + rowPattern, ... sont regroupées par
+ *    secteur de 2 * rowPattern lignes (width / 4 octets, dernier secteur
+ *    envoyé en premier) ; dans un secteur, 2 octets par bloc de 8 colonnes,
+ *    colonnes 0-7 envoyées en premier (panneaux « naturellement retournés »).
+ *  - ZAGZIG : dans la paire d'octets d'un bloc, la ligne haute du secteur
+ *    (y % (2 * rowPattern) < rowPattern) est envoyée en premier.
+ *  - Dans un octet (MSB envoyé en premier), la colonne x % 8 = i occupe le
+ *    bit 7 - i.
+ *  - BINARY : les lignes A, B, C, ... reçoivent les bits de l'adresse a.
+ *  - Plan p : bit (8 - planes + p) du canal sur 8 bits, obtenu comme PxMatrix
+ *    par simple décalage du RGB565 (r5 << 3, g6 << 2, b5 << 3).
+ *
+ * Disposition de la sortie : out[((p * rowPattern) + a) * bcmRowBytes() + octet],
+ * soit PxMATRIX_buffer[p][a * _send_buffer_size + octet].
+ *
+ * Non branché sur le rafraîchissement : l'ISR envoie toujours le buffer
+ * privé de PxMatrix. L'encodeur sert au banc natif (coût par trame) et à son
+ * test, qui le compare à l'arithmétique d'index de fillMatrixBuffer.
+ */
+#ifndef BITPLANEENCODER_H
+#define BITPLANEENCODER_H
+
+#include <stdint.h>
+#include <string.h>
+
+struct BcmLayout {
+  uint16_t width;      // largeur totale en pixels (multiple de 8)
+  uint16_t height;     // hauteur totale en pixels
+  uint8_t rowPattern;  // nombre d'adresses de multiplexage (display.begin(rowPattern))
+  uint8_t planes;      // profondeur BCM par canal (1..8)
+};
+
+enum { BCM_RED = 0, BCM_GREEN = 1, BCM_BLUE = 2 };
+
+// Lignes allumées par adresse (les deux moitiés)
+inline uint16_t bcmRowsPerAddress(const BcmLayout &l) {
+  return l.height / l.rowPattern;
+}
+
+// Octets d'un segment (une couleur, _pattern_color_bytes de PxMatrix) et
+// d'une ligne complète du flux (_send_buffer_size)
+inline uint32_t bcmSegmentBytes(const BcmLayout &l) {
+  return (uint32_t)l.width * bcmRowsPerAddress(l) / 8;
+}
+inline uint32_t bcmRowBytes(const BcmLayout &l) {
+  return 3 * bcmSegmentBytes(l);
+}
+inline uint32_t bcmFrameBytes(const BcmLayout &l) {
+  return (uint32_t)l.planes * l.rowPattern * bcmRowBytes(l);
+}
+
+inline bool bcmLayoutValid(const BcmLayout &l) {
+  return l.width > 0 && (l.width % 8) == 0 &&
+         l.rowPattern > 0 && l.height > 0 && (l.height % (2 * l.rowPattern)) == 0 &&
+         l.planes >= 1 && l.planes <= 8;
+}
+
+// Lignes d'adresse (bit 0 = A, bit 1 = B, ...) pour le multiplexage BINARY
+inline uint8_t bcmMuxAddress(uint8_t a) {
+  return a;
+}
+
+// Durée d'allumage du plan p : poids binaire 2^p de la durée de base
+inline uint32_t bcmPlaneShowTime(uint32_t baseTime, uint8_t p) {
+  return baseTime << p;
+}
+
+// Canal sur 8 bits d'une couleur RGB565 (même conversion que PxMatrix)
+inline uint8_t bcmChannel8(uint16_t color, uint8_t channel) {
+  switch (channel) {
+    case BCM_RED:   return ((color >> 11) & 0x1F) << 3;
+    case BCM_GREEN: return ((color >> 5) & 0x3F) << 2;
+    default:        return (color & 0x1F) << 3;
+  }
+}
+
+// Encode toute la trame. fb : width * height pixels RGB565, ligne par ligne ;
+// out : bcmFrameBytes() octets. Retourne false si la géométrie n'est pas gérée.
+inline bool bcmEncodeFrame(const BcmLayout &l, const uint16_t *fb, uint8_t *out) {
+  if (!bcmLayoutValid(l)) return false;
+  const uint16_t blocks = l.width / 8;
+  const uint32_t rowBytes = bcmRowBytes(l);
+  const uint32_t segBytes = bcmSegmentBytes(l);
+  const uint32_t sectorBytes = l.width / 4;
+  const uint8_t shift = 8 - l.planes;
+
+  for (uint16_t y = 0; y < l.height; y++) {
+    const uint8_t a = y % l.rowPattern;
+    const uint16_t sector = y / (2 * l.rowPattern);
+    const bool upper = (y % (2 * l.rowPattern)) < l.rowPattern;
+    // Octet rouge du bloc 0 (colonnes 0-7) dans la ligne de l'adresse a
+    const uint32_t red0 = rowBytes - 1 - (uint32_t)(blocks - 1) * 2 - sectorBytes * sector - (upper ? 1 : 0);
+    const uint16_t *line = fb + (uint32_t)y * l.width;
+    for (uint16_t cb = 0; cb < blocks; cb++) {
+      // Bloc de 8 colonnes : un octet par couleur et par plan
+      const uint16_t *px = line + cb * 8;
+      uint8_t bits[3][8];
+      memset(bits, 0, sizeof(bits));
+      for (uint8_t i = 0; i < 8; i++) {
+        for (uint8_t c = 0; c < 3; c++) {
+          uint8_t v = bcmChannel8(px[i], c) >> shift;
+          for (uint8_t p = 0; v; p++, v >>= 1) {
+            if (v & 1) bits[c][p] |= (uint8_t)(0x80 >> i);
+          }
+        }
+      }
+      const uint32_t red = red0 + (uint32_t)cb * 2;
+      for (uint8_t p = 0; p < l.planes; p++) {
+        uint8_t *row = out + ((uint32_t)p * l.rowPattern + a) * rowBytes;
+        for (uint8_t c = 0; c < 3; c++) {
+          row[red - c * segBytes] = bits[c][p];
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Ré-encode seulement si la trame a changé depuis le dernier encodage
+// (generation : compteur incrémenté par le rendu à chaque trame publiée).
+inline bool bcmEncodeIfChanged(const BcmLayout &l, const uint16_t *fb, uint32_t generation,
+                               uint32_t &encodedGeneration, uint8_t *out) {
+  if (generation == encodedGeneration) return false;
+  if (!bcmEncodeFrame(l, fb, out)) return false;
+  encodedGeneration = generation;
+  return true;
+}
+
+#endif // BITPLANEENCODER_H
@@ -0,0 +1,86 @@
+/**
+ * DNS du portail captif sur AsyncUDP (sans scrutation)
+ *
+ * DNSServer doit être scruté (processNextRequest) depuis une tâche ; ici
+ * chaque requête est traitée dans le callback AsyncUDP dès sa réception :
+ * toute question de type A (ou ANY) reçoit l'adresse du point d'accès,
+ * comme dnsServer.start(53, "*", ip). Les autres types reçoivent une
+ * réponse sans enregistrement (NOERROR), les paquets qui ne sont pas une
+ * requête standard à une question sont ignorés.
+ *
+ * captiveDnsAnswer() construit la réponse dans un buffer fourni, sans
+ * allocation (testé en natif : examples/captive_dns_test.cpp).
+ */
+#ifndef CAPTIVEDNS_H
+#define CAPTIVEDNS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CAPTIVE_DNS_HEADER 12
+#define CAPTIVE_DNS_TTL    60   // secondes
+#define CAPTIVE_DNS_MAX    512  // taille maximale d'un message DNS sur UDP
+
+// Réponse à query (len octets) dans out ; longueur de la réponse, 0 si le
+// paquet doit être ignoré. ip : adresse IPv4, octet de poids fort en premier.
+inline size_t captiveDnsAnswer(const uint8_t *query, size_t len, const uint8_t ip[4], uint8_t *out, size_t outSize) {
+  if (len < CAPTIVE_DNS_HEADER || len > CAPTIVE_DNS_MAX) return 0;
+  if (query[2] & 0xF8) return 0;                          // réponse (QR) ou opcode != QUERY
+  if (query[4] != 0 || query[5] != 1) return 0;           // une seule question
+  // Nom de la question : suite de labels terminée par 0 (pas de compression)
+  size_t p = CAPTIVE_DNS_HEADER;
+  while (p < len && query[p] != 0) {
+    if (query[p] & 0xC0) return 0;
+    p += 1 + query[p];
+  }
+  if (p + 5 > len) return 0;
+  const size_t questionEnd = p + 5;                       // zéro final + type + classe
+  const uint16_t qtype = (uint16_t)(query[p + 1] << 8 | query[p + 2]);
+  const uint16_t qclass = (uint16_t)(query[p + 3] << 8 | query[p + 4]);
+  const bool answer = (qtype == 1 || qtype == 255) && qclass == 1;
+  const size_t size = questionEnd + (answer ? 16 : 0);
+  if (size > outSize) return 0;
+
+  memcpy(out, query, questionEnd);                        // en-tête + question recopiés
+  out[2] = 0x84 | (query[2] & 0x01);                      // QR, AA, RD recopié
+  out[3] = 0x80;                                          // RA, RCODE = 0
+  out[6] = 0; out[7] = answer ? 1 : 0;                    // ANCOUNT
+  memset(out + 8, 0, 4);                                  // NSCOUNT, ARCOUNT
+  if (answer) {
+    uint8_t *a = out + questionEnd;
+    a[0] = 0xC0; a[1] = CAPTIVE_DNS_HEADER;               // nom : pointeur vers la question
+    a[2] = 0; a[3] = 1;                                   // type A
+    a[4] = 0; a[5] = 1;                                   // classe IN
+    a[6] = 0; a[7] = 0; a[8] = 0; a[9] = CAPTIVE_DNS_TTL;
+    a[10] = 0; a[11] = 4;
+    memcpy(a + 12, ip, 4);
+  }
+  return size;
+}
+
+#ifndef NATIVE_BUILD
+#include <AsyncUDP.h>
+
+struct CaptiveDns {
+  AsyncUDP udp;
+  uint8_t ip[4];
+  uint32_t answered;
+};
+
+inline bool captiveDnsBegin(CaptiveDns &dns, uint16_t port, IPAddress ip) {
+  for (uint8_t i = 0; i < 4; i++) dns.ip[i] = ip[i];
+  dns.answered = 0;
+  if (!dns.udp.listen(port)) return false;
+  dns.udp.onPacket([&dns](AsyncUDPPacket &packet) {
+    uint8_t reply[CAPTIVE_DNS_MAX];
+    const size_t n = captiveDnsAnswer(packet.data(), packet.length(), dns.ip, reply, sizeof(reply));
+    if (n == 0) return;
+    packet.write(reply, n);
+    dns.answered++;
+  });
+  return true;
+}
+#endif
+
+#endif // CAPTIVEDNS_H
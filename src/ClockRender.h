@@ -0,0 +1,401 @@
+/**
+ * Rendu de l'horloge (zone heure + texte défilant) - partagé firmware / natif
+ *
+ * Inclus par src/main.cpp et par le banc de mesure natif
+ * (examples/native_render_bench.cpp). Le programme qui inclut ce fichier doit
+ * au préalable :
+ *  - définir TOTAL_WIDTH / TOTAL_HEIGHT et l'objet `PxMATRIX display` ;
+ *  - inclure ColorGamma.h (color565Corrected), FontMetrics.h, GlyphSpans.h,
+ *    GlyphRun.h et TextLayoutCache.h ;
+ *  - fournir get_Time(), get_Date() et updateCountdown() (lecture RTC).
+ */
+#ifndef CLOCKRENDER_H
+#define CLOCKRENDER_H
+
+// Fonctions fournies par le programme hôte (accès RTC)
+void get_Time();
+void get_Date();
+void updateCountdown();
+
+// Couleurs prédéfinies
+uint16_t myRED      = color565Corrected(255, 0, 0);
+uint16_t myGREEN    = color565Corrected(0, 255, 0);
+uint16_t myBLUE     = color565Corrected(0, 0, 255);
+uint16_t myYELLOW   = color565Corrected(255, 255, 0);
+uint16_t myCYAN     = color565Corrected(0, 255, 255);
+uint16_t myFUCHSIA  = color565Corrected(255, 0, 255);
+uint16_t myWHITE    = color565Corrected(255, 255, 255);
+uint16_t myBLACK    = color565Corrected(0, 0, 0);
+
+uint16_t myCOLOR_ARRAY[7] = {myRED, myGREEN, myBLUE, myYELLOW, myCYAN, myFUCHSIA, myWHITE};
+int cnt_Color = 0;
+int myCOLOR_ARRAY_Length = sizeof(myCOLOR_ARRAY) / sizeof(myCOLOR_ARRAY[0]);
+
+// Reconversion des couleurs prédéfinies après un changement de niveau
+// (colorGammaApplyBrightness)
+void refresh_Palette() {
+  myRED     = color565Corrected(255, 0, 0);
+  myGREEN   = color565Corrected(0, 255, 0);
+  myBLUE    = color565Corrected(0, 0, 255);
+  myYELLOW  = color565Corrected(255, 255, 0);
+  myCYAN    = color565Corrected(0, 255, 255);
+  myFUCHSIA = color565Corrected(255, 0, 255);
+  myWHITE   = color565Corrected(255, 255, 255);
+  myBLACK   = color565Corrected(0, 0, 0);
+  const uint16_t palette[7] = {myRED, myGREEN, myBLUE, myYELLOW, myCYAN, myFUCHSIA, myWHITE};
+  memcpy(myCOLOR_ARRAY, palette, sizeof(myCOLOR_ARRAY));
+}
+
+// Variables pour le texte défilant
+unsigned long prevMill_Scroll_Text = 0;
+int scrolling_Y_Pos = 0;
+long scrolling_X_Pos;
+long scrolling_X_Pos_CT;
+uint16_t scrolling_Text_Color;
+uint16_t text_Color;
+char text_Scrolling_Text[151];
+uint16_t text_Length_In_Pixel;
+bool set_up_Scrolling_Text_Length = true;
+bool start_Scroll_Text = false;
+int scrolling_text_Display_Order = 0;
+bool reset_Scrolling_Text = false;
+
+// Mode "bande" du texte défilant : le texte est rastérisé une fois dans une
+// bande colonne par colonne (1 octet = 8 lignes), puis chaque pas ne réécrit
+// que les pixels de la bande qui changent. Coût proportionnel à la largeur
+// de la bande, indépendant de la longueur du texte. 0 = ancien rendu
+// (impression en noir à x+1 puis en couleur à x).
+#ifndef SCROLL_BAND_MODE
+  #define SCROLL_BAND_MODE 1
+#endif
+#define SCROLL_BAND_HEIGHT 8
+uint8_t scroll_Band_Cols[151 * 6]; // 150 caractères max, cellule 6 px
+uint16_t scroll_Band_Len = 0;
+
+// Variables de temps
+unsigned long prevMill_Update_Time = 0;
+const long interval_Update_Time = 1000;
+unsigned long prevMill_Show_Clock = 0;
+const long interval_Show_Clock = 500;
+
+// Variables pour l'heure affichée
+char chr_t_Minute[3];
+char chr_t_Hour[3];
+char day_and_date_Text[25];
+bool blink_Colon = false;
+uint16_t clock_Color;
+uint16_t day_and_date_Text_Color;
+
+// Suivi des zones modifiées (damage tracking) : chaque cellule de l'horloge
+// (un chiffre ou les deux points) et la bande de défilement a son rectangle,
+// redessiné seulement s'il a changé
+struct Damage_Rect {
+  int16_t x, y, w, h;
+  bool dirty;
+};
+enum {
+  DAMAGE_HOUR_TENS, DAMAGE_HOUR_UNITS, DAMAGE_COLON, DAMAGE_MINUTE_TENS, DAMAGE_MINUTE_UNITS,
+  DAMAGE_SCROLL, DAMAGE_COUNT
+};
+Damage_Rect damage_Rects[DAMAGE_COUNT];
+volatile uint8_t damage_Count = 0;   // zones de la dernière frame dessinée (displayTaskStep), /refresh
+volatile uint32_t damage_Total = 0;  // cumul depuis le démarrage
+
+// Cellules de l'horloge HH:MM (indices = DAMAGE_HOUR_TENS..DAMAGE_MINUTE_UNITS) :
+// dernier caractère et couleur dessinés, '\0' = jamais dessiné.
+// Les deux points valent ':' (allumés) ou ' ' (éteints).
+#define CLOCK_CELL_COUNT 5
+struct Clock_Cell {
+  char drawn;
+  uint16_t color;
+};
+Clock_Cell clock_Cells[CLOCK_CELL_COUNT];
+bool scroll_Band_Stale = false; // défilement interrompu : bande à effacer
+
+void mark_Damage(uint8_t id, int16_t x, int16_t y, int16_t w, int16_t h) {
+  damage_Rects[id].x = x;
+  damage_Rects[id].y = y;
+  damage_Rects[id].w = w;
+  damage_Rects[id].h = h;
+  damage_Rects[id].dirty = true;
+}
+
+// Zone redessinée : la retirer des zones à traiter et la compter
+void clear_Damage(uint8_t id) {
+  damage_Rects[id].dirty = false;
+  damage_Total++;
+}
+
+// Forcer le redessin complet de l'horloge (après clearDisplay)
+void invalidate_Clock() {
+  for (uint8_t i = 0; i < CLOCK_CELL_COUNT; i++) clock_Cells[i].drawn = '\0';
+}
+
+// Paramètres d'affichage (modifiés par l'interface web)
+uint8_t input_Display_Mode = 1;
+uint8_t input_Scrolling_Speed = 45;
+int Color_Clock_R = 255, Color_Clock_G = 0, Color_Clock_B = 0;
+int Color_Date_R = 0, Color_Date_G = 255, Color_Date_B = 0;
+int Color_Text_R = 0, Color_Text_G = 0, Color_Text_B = 255;
+char input_Scrolling_Text[151] = "ESP32 P10 RGB Digital Clock with PlatformIO";
+
+// Etat du countdown affiché dans le défilement
+bool countdown_Active = false;
+char countdown_Text[101];
+bool countdown_Expired = false;
+int Color_Countdown_R = 255, Color_Countdown_G = 165, Color_Countdown_B = 0; // Orange par défaut
+
+// Layouts des textes défilants : la rotation date / texte / countdown
+// retrouve la largeur en cache (compteurs exposés par /layout)
+TextLayoutCache scroll_Layouts;
+
+// Fonction pour obtenir la largeur du texte en pixels
+// Police 5x7 intégrée en taille 1 : même largeur que getTextBounds
+uint16_t getTextWidth(const char* text) {
+  return textLayoutGet(scroll_Layouts, text, nullptr, 1).w;
+}
+
+// Fonction pour dessiner les deux points de l'heure
+void drawColon(int16_t x, int16_t y, uint16_t colonColor) {
+  display.drawPixel(x, y, colonColor);
+  display.drawPixel(x+1, y, colonColor);
+  display.drawPixel(x, y+1, colonColor);
+  display.drawPixel(x+1, y+1, colonColor);
+
+  display.drawPixel(x, y+3, colonColor);
+  display.drawPixel(x+1, y+3, colonColor);
+  display.drawPixel(x, y+4, colonColor);
+  display.drawPixel(x+1, y+4, colonColor);
+}
+
+#if SCROLL_BAND_MODE
+// Rastérise st_Text dans scroll_Band_Cols (bit r = ligne r de la bande)
+void setup_Scroll_Band(const char * st_Text, uint16_t length_In_Pixel) {
+  scroll_Band_Len = length_In_Pixel;
+  if (scroll_Band_Len > sizeof(scroll_Band_Cols)) scroll_Band_Len = sizeof(scroll_Band_Cols);
+  memset(scroll_Band_Cols, 0, sizeof(scroll_Band_Cols));
+  GFXcanvas1 canvas(scroll_Band_Len, SCROLL_BAND_HEIGHT);
+  if (canvas.getBuffer() == nullptr) {
+    scroll_Band_Len = 0;
+    return;
+  }
+  canvas.setTextWrap(false);
+  canvas.setTextSize(1);
+  canvas.setTextColor(1);
+  canvas.setCursor(0, 0);
+  canvas.print(st_Text);
+  for (uint16_t c = 0; c < scroll_Band_Len; c++) {
+    uint8_t col = 0;
+    for (uint8_t r = 0; r < SCROLL_BAND_HEIGHT; r++) {
+      if (canvas.getPixel(c, r)) col |= (1 << r);
+    }
+    scroll_Band_Cols[c] = col;
+  }
+}
+
+// Colonne de la bande à l'indice i (vide hors du texte)
+inline uint8_t scroll_Band_Col(long i) {
+  return (i >= 0 && i < scroll_Band_Len) ? scroll_Band_Cols[i] : 0;
+}
+
+// Décale la bande d'un pixel vers la gauche : le contenu affiché correspond
+// au texte en x_Pos + 1, seuls les pixels différents du texte en x_Pos sont
+// réécrits (PxMatrix ne permet pas de relire/décaler son framebuffer).
+void shift_Scroll_Band(long x_Pos, uint8_t st_Y_Pos, uint16_t st_Color) {
+  for (int16_t x = 0; x < TOTAL_WIDTH; x++) {
+    uint8_t new_Col = scroll_Band_Col(x - x_Pos);
+    uint8_t changed = new_Col ^ scroll_Band_Col(x - x_Pos - 1);
+    while (changed) {
+      uint8_t r = __builtin_ctz(changed);
+      display.drawPixel(x, st_Y_Pos + r, (new_Col & (1 << r)) ? st_Color : myBLACK);
+      changed &= changed - 1;
+    }
+  }
+}
+#endif
+
+// Fonction de texte défilant adaptée aux panneaux multiples
+void run_Scrolling_Text(uint8_t st_Y_Pos, byte st_Speed, char * st_Text, uint16_t st_Color) {
+  if (start_Scroll_Text == true && set_up_Scrolling_Text_Length == true) {
+    if (strlen(st_Text) > 0) {
+      text_Length_In_Pixel = getTextWidth(st_Text);
+      scrolling_X_Pos = TOTAL_WIDTH; // Utiliser la largeur totale
+      set_up_Scrolling_Text_Length = false;
+#if SCROLL_BAND_MODE
+      setup_Scroll_Band(st_Text, text_Length_In_Pixel);
+      if (scroll_Band_Stale) {
+        // Texte précédent interrompu : la bande ne correspond plus au cache
+        display.fillRect(0, st_Y_Pos, TOTAL_WIDTH, SCROLL_BAND_HEIGHT, myBLACK);
+        scroll_Band_Stale = false;
+      }
+#endif
+    } else {
+      start_Scroll_Text = false;
+      return;
+    }
+  }
+
+  unsigned long currentMillis_Scroll_Text = millis();
+  if (currentMillis_Scroll_Text - prevMill_Scroll_Text >= st_Speed) {
+    prevMill_Scroll_Text = currentMillis_Scroll_Text;
+
+    scrolling_X_Pos--;
+    if (scrolling_X_Pos < -(TOTAL_WIDTH + text_Length_In_Pixel)) { // Utiliser la largeur totale
+      set_up_Scrolling_Text_Length = true;
+      start_Scroll_Text = false;
+      return;
+    }
+
+    mark_Damage(DAMAGE_SCROLL, 0, st_Y_Pos, TOTAL_WIDTH, SCROLL_BAND_HEIGHT);
+#if SCROLL_BAND_MODE
+    shift_Scroll_Band(scrolling_X_Pos, st_Y_Pos, st_Color);
+#else
+    scrolling_X_Pos_CT = scrolling_X_Pos + 1;
+
+    glyphSpanPrint(display, scrolling_X_Pos_CT, st_Y_Pos, st_Text, NULL, 1, myBLACK);
+    glyphSpanPrint(display, scrolling_X_Pos, st_Y_Pos, st_Text, NULL, 1, st_Color);
+#endif
+    clear_Damage(DAMAGE_SCROLL);
+  }
+}
+
+// Affichage de l'horloge HH:MM (toutes les 500 ms) : une cellule par chiffre
+// et une pour les deux points ; seule une cellule dont le caractère ou la
+// couleur a changé est effacée puis redessinée (les deux points seulement
+// quand blink_Colon bascule)
+void showClock() {
+  // Couleur selon le mode
+  if (input_Display_Mode == 1) {
+    clock_Color = color565Corrected(Color_Clock_R, Color_Clock_G, Color_Clock_B);
+  } else {
+    clock_Color = myCOLOR_ARRAY[cnt_Color];
+  }
+  int clock_width = 30;
+  int clock_x = (TOTAL_WIDTH - clock_width) / 2;
+  if (clock_x < 1) clock_x = 1;
+
+  // Contenu et position de chaque cellule (police 5x7 : chiffre 5x7, pas de 6 px)
+  const char cell_Char[CLOCK_CELL_COUNT] = {
+    chr_t_Hour[0], chr_t_Hour[1], blink_Colon ? ':' : ' ', chr_t_Minute[0], chr_t_Minute[1]
+  };
+  const int16_t cell_X[CLOCK_CELL_COUNT] = { (int16_t)clock_x, (int16_t)(clock_x + 6), (int16_t)(clock_x + 14),
+                                             (int16_t)(clock_x + 19), (int16_t)(clock_x + 25) };
+
+  for (uint8_t id = DAMAGE_HOUR_TENS; id <= DAMAGE_MINUTE_UNITS; id++) {
+    Clock_Cell &cell = clock_Cells[id];
+    bool lit = cell_Char[id] != ' ';
+    if (cell.drawn == cell_Char[id] && (!lit || cell.color == clock_Color)) continue;
+    if (id == DAMAGE_COLON) mark_Damage(id, cell_X[id], 1, 2, 5);
+    else mark_Damage(id, cell_X[id], 0, 5, 7);
+  }
+
+  for (uint8_t id = DAMAGE_HOUR_TENS; id <= DAMAGE_MINUTE_UNITS; id++) {
+    Damage_Rect &r = damage_Rects[id];
+    if (!r.dirty) continue;
+    if (id == DAMAGE_COLON) {
+      drawColon(r.x, r.y, blink_Colon ? clock_Color : myBLACK);
+    } else {
+      display.fillRect(r.x, r.y, r.w, r.h, myBLACK);
+      display.drawChar(r.x, r.y, cell_Char[id], clock_Color, clock_Color, 1, 1);
+    }
+    clock_Cells[id].drawn = cell_Char[id];
+    clock_Cells[id].color = clock_Color;
+    clear_Damage(id);
+  }
+}
+
+// Choix du prochain texte défilant (date, texte personnalisé, countdown)
+void selectScrollingText() {
+  scrolling_text_Display_Order++;
+  int maxOrder = countdown_Active ? 3 : 2;
+  if (input_Display_Mode == 2) {
+    maxOrder++;
+  }
+  if (scrolling_text_Display_Order > maxOrder) scrolling_text_Display_Order = 1;
+  if (scrolling_text_Display_Order == 1) {
+    get_Date();
+    display.setTextSize(1);
+    scrolling_Y_Pos = 8;
+    if (input_Display_Mode == 1) {
+      scrolling_Text_Color = color565Corrected(Color_Date_R, Color_Date_G, Color_Date_B);
+    } else {
+      int next_cnt_Color = (cnt_Color + 1) % myCOLOR_ARRAY_Length;
+      scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
+    }
+    strcpy(text_Scrolling_Text, day_and_date_Text);
+  }
+  if (scrolling_text_Display_Order == 2) {
+    display.setTextSize(1);
+    scrolling_Y_Pos = 8;
+    if (input_Display_Mode == 1) {
+      scrolling_Text_Color = color565Corrected(Color_Text_R, Color_Text_G, Color_Text_B);
+    } else {
+      int next_cnt_Color = (cnt_Color + 2) % myCOLOR_ARRAY_Length;
+      scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
+    }
+    strcpy(text_Scrolling_Text, input_Scrolling_Text);
+  }
+  if (scrolling_text_Display_Order == 3 && countdown_Active) {
+    display.setTextSize(1);
+    scrolling_Y_Pos = 8;
+    if (input_Display_Mode == 1) {
+      if (countdown_Expired) {
+        scrolling_Text_Color = myRED;
+      } else {
+        scrolling_Text_Color = color565Corrected(Color_Countdown_R, Color_Countdown_G, Color_Countdown_B);
+      }
+    } else {
+      int next_cnt_Color = (cnt_Color + 3) % myCOLOR_ARRAY_Length;
+      scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
+    }
+    strcpy(text_Scrolling_Text, countdown_Text);
+  }
+  int colorChangeOrder = countdown_Active ? 4 : 3;
+  if (scrolling_text_Display_Order == colorChangeOrder && input_Display_Mode == 2) {
+    cnt_Color = (cnt_Color + 1) % myCOLOR_ARRAY_Length;
+    strcpy(text_Scrolling_Text, "");
+  }
+  start_Scroll_Text = true;
+}
+
+// Une itération de DisplayTask (appelée toutes les 10 ms)
+void displayTaskStep() {
+  const uint32_t damage_Start = damage_Total;
+
+  // Mise à jour de l'heure et du countdown
+  unsigned long currentMillis_Update_Time = millis();
+  if (currentMillis_Update_Time - prevMill_Update_Time >= interval_Update_Time) {
+    prevMill_Update_Time = currentMillis_Update_Time;
+    get_Time();
+    blink_Colon = !blink_Colon;
+    if (countdown_Active) {
+      updateCountdown();
+    }
+  }
+
+  // Affichage de l'horloge
+  unsigned long currentMillis_Show_Clock = millis();
+  if (currentMillis_Show_Clock - prevMill_Show_Clock >= interval_Show_Clock) {
+    prevMill_Show_Clock = currentMillis_Show_Clock;
+    showClock();
+  }
+
+  // Gestion du texte défilant
+  if (reset_Scrolling_Text) {
+    if (start_Scroll_Text) scroll_Band_Stale = true;
+    start_Scroll_Text = false;
+    set_up_Scrolling_Text_Length = true;
+    reset_Scrolling_Text = false;
+  }
+  if (start_Scroll_Text == false) {
+    selectScrollingText();
+  }
+  if (start_Scroll_Text) {
+    run_Scrolling_Text(scrolling_Y_Pos, input_Scrolling_Speed, text_Scrolling_Text, scrolling_Text_Color);
+  }
+
+  // Publié en une écriture, seulement si la frame a redessiné quelque chose
+  if (damage_Total != damage_Start) damage_Count = (uint8_t)(damage_Total - damage_Start);
+}
+
+#endif // CLOCKRENDER_H
@@ -0,0 +1,148 @@
+/**
+ * Correction gamma des couleurs RGB565 (tables générées à la compilation)
+ *
+ * display.color565(r, g, b) tronque simplement chaque canal : aux faibles
+ * luminosités les couleurs sombres s'écrasent. color565Corrected() passe
+ * chaque canal par une table gamma puis renvoie directement les bits RGB565,
+ * soit trois lectures de table et deux OR par couleur.
+ *
+ *  - Gamma par canal, choisi à la compilation : -DCOLOR_GAMMA=2.2 ou
+ *    -DCOLOR_GAMMA_R / _G / _B. Les tables 16 bits sont constexpr (C++11).
+ *  - Un multiplicateur de niveau (0-255) est intégré aux tables RGB565 :
+ *    colorGammaSetLevel() les recalcule une fois (768 entrées), rien n'est
+ *    recalculé par pixel. Les couleurs déjà converties doivent être
+ *    reconverties par l'appelant après un changement de niveau.
+ *  - colorGammaApplyBrightness() répartit le réglage de luminosité : PxMatrix
+ *    (setBrightness) dimme jusqu'à COLOR_BRIGHTNESS_HW_MIN, en dessous les
+ *    tables prennent le reste au lieu de raccourcir encore les plans BCM.
+ *  - Une composante non nulle reste allumée (au moins 1 pas RGB565).
+ *
+ * Courbes, bornes et niveaux vérifiés en natif : examples/color_gamma_test.cpp.
+ */
+#ifndef COLORGAMMA_H
+#define COLORGAMMA_H
+
+#include <stdint.h>
+
+#ifndef COLOR_GAMMA
+  #define COLOR_GAMMA 2.2
+#endif
+#ifndef COLOR_GAMMA_R
+  #define COLOR_GAMMA_R COLOR_GAMMA
+#endif
+#ifndef COLOR_GAMMA_G
+  #define COLOR_GAMMA_G COLOR_GAMMA
+#endif
+#ifndef COLOR_GAMMA_B
+  #define COLOR_GAMMA_B COLOR_GAMMA
+#endif
+
+// --- Fonctions mathématiques constexpr (C++11 : une seule expression) ---
+
+// ln(x) pour x dans ]0, 1] : ramené dans [0.5, 1[ puis série de atanh
+constexpr double gammaAtanhSeries(double y2, double term, int k) {
+  return k > 12 ? 0.0 : term / (2 * k + 1) + gammaAtanhSeries(y2, term * y2, k + 1);
+}
+constexpr double gammaLnReduced(double x) {
+  return 2.0 * gammaAtanhSeries(((x - 1) / (x + 1)) * ((x - 1) / (x + 1)), (x - 1) / (x + 1), 0);
+}
+constexpr double gammaLn(double x, int n = 0) {
+  return x < 0.5 ? gammaLn(x * 2, n + 1) : gammaLnReduced(x) - n * 0.69314718055994531;
+}
+
+// exp(z) : série de Taylor sur z / 256 puis 8 mises au carré
+constexpr double gammaExpSeries(double w, double term, int k) {
+  return k > 10 ? 0.0 : term + gammaExpSeries(w, term * w / (k + 1), k + 1);
+}
+constexpr double gammaSquare(double v, int n) {
+  return n == 0 ? v : gammaSquare(v * v, n - 1);
+}
+constexpr double gammaExp(double z) {
+  return gammaSquare(gammaExpSeries(z / 256.0, 1.0, 0), 8);
+}
+
+// Valeur 16 bits de (i / 255) ^ gamma (au moins 1 si i > 0)
+constexpr uint16_t gammaValue16Raw(int i, double gamma) {
+  return (uint16_t)(gammaExp(gamma * gammaLn(i / 255.0)) * 65535.0 + 0.5);
+}
+constexpr uint16_t gammaValue16(int i, double gamma) {
+  return i == 0 ? 0 : (gammaValue16Raw(i, gamma) == 0 ? 1 : gammaValue16Raw(i, gamma));
+}
+
+// Entrée RGB565 d'un canal : valeur 16 bits x niveau, sur `bits` bits, décalée
+constexpr uint16_t gammaScaled(uint32_t v16, uint8_t level, int bits) {
+  return (uint16_t)((v16 * level * ((1u << bits) - 1) + 255u * 32767u) / (255u * 65535u));
+}
+constexpr uint16_t gammaLutEntry(uint16_t v16, uint8_t level, int bits, int shift) {
+  return (uint16_t)(((v16 != 0 && level != 0 && gammaScaled(v16, level, bits) == 0)
+                       ? 1 : gammaScaled(v16, level, bits)) << shift);
+}
+
+// --- Tables, générées par expansion d'une suite d'indices 0..255 ---
+
+template <int... I> struct GammaIndexSeq {};
+template <int N, int... I> struct GammaMakeSeq : GammaMakeSeq<N - 1, N - 1, I...> {};
+template <int... I> struct GammaMakeSeq<0, I...> { typedef GammaIndexSeq<I...> type; };
+
+template <typename Seq> struct GammaTables;
+template <int... I> struct GammaTables<GammaIndexSeq<I...> > {
+  // Courbes gamma 16 bits (constantes)
+  static constexpr uint16_t curveR[256] = { gammaValue16(I, COLOR_GAMMA_R)... };
+  static constexpr uint16_t curveG[256] = { gammaValue16(I, COLOR_GAMMA_G)... };
+  static constexpr uint16_t curveB[256] = { gammaValue16(I, COLOR_GAMMA_B)... };
+  // Bits RGB565 au niveau courant (initialisés à la compilation au niveau 255)
+  static uint16_t lutR[256];
+  static uint16_t lutG[256];
+  static uint16_t lutB[256];
+  static uint8_t level;
+};
+
+template <int... I> constexpr uint16_t GammaTables<GammaIndexSeq<I...> >::curveR[256];
+template <int... I> constexpr uint16_t GammaTables<GammaIndexSeq<I...> >::curveG[256];
+template <int... I> constexpr uint16_t GammaTables<GammaIndexSeq<I...> >::curveB[256];
+template <int... I> uint16_t GammaTables<GammaIndexSeq<I...> >::lutR[256] =
+  { gammaLutEntry(gammaValue16(I, COLOR_GAMMA_R), 255, 5, 11)... };
+template <int... I> uint16_t GammaTables<GammaIndexSeq<I...> >::lutG[256] =
+  { gammaLutEntry(gammaValue16(I, COLOR_GAMMA_G), 255, 6, 5)... };
+template <int... I> uint16_t GammaTables<GammaIndexSeq<I...> >::lutB[256] =
+  { gammaLutEntry(gammaValue16(I, COLOR_GAMMA_B), 255, 5, 0)... };
+template <int... I> uint8_t GammaTables<GammaIndexSeq<I...> >::level = 255;
+
+typedef GammaTables<GammaMakeSeq<256>::type> ColorGamma;
+
+// Couleur RGB565 corrigée (gamma + niveau) : remplace display.color565()
+inline uint16_t color565Corrected(uint8_t r, uint8_t g, uint8_t b) {
+  return ColorGamma::lutR[r] | ColorGamma::lutG[g] | ColorGamma::lutB[b];
+}
+
+// Multiplicateur de niveau intégré aux tables (255 = pleine échelle)
+inline void colorGammaSetLevel(uint8_t level) {
+  if (level == ColorGamma::level) return;
+  for (int i = 0; i < 256; i++) {
+    ColorGamma::lutR[i] = gammaLutEntry(ColorGamma::curveR[i], level, 5, 11);
+    ColorGamma::lutG[i] = gammaLutEntry(ColorGamma::curveG[i], level, 6, 5);
+    ColorGamma::lutB[i] = gammaLutEntry(ColorGamma::curveB[i], level, 5, 0);
+  }
+  ColorGamma::level = level;
+}
+
+inline uint8_t colorGammaLevel() {
+  return ColorGamma::level;
+}
+
+#ifndef COLOR_BRIGHTNESS_HW_MIN
+  #define COLOR_BRIGHTNESS_HW_MIN 64
+#endif
+
+// Luminosité 0-255 : règle le niveau des tables et renvoie la valeur à
+// passer à display.setBrightness() (produit des deux ~ brightness)
+inline uint8_t colorGammaApplyBrightness(uint8_t brightness) {
+  if (brightness >= COLOR_BRIGHTNESS_HW_MIN) {
+    colorGammaSetLevel(255);
+    return brightness;
+  }
+  colorGammaSetLevel((uint8_t)((brightness * 255u + COLOR_BRIGHTNESS_HW_MIN / 2) / COLOR_BRIGHTNESS_HW_MIN));
+  return COLOR_BRIGHTNESS_HW_MIN;
+}
+
+#endif // COLORGAMMA_H
@@ -0,0 +1,109 @@
+/**
+ * Familles de polices multi-tailles et ajustement automatique au panneau
+ *
+ * Une famille regroupe les tailles natives d'un style (6, 7, 8 ... pt,
+ * générées par tools/generate_latin1_font.sh -F, déclarées par
+ * tools/font_family.py) triées par taille croissante. Au lieu d'agrandir une
+ * police 9 pt par le zoom entier GFX (glyphes en blocs 2x2), on choisit la
+ * plus grande taille native dont le texte tient dans la boîte.
+ *
+ * La largeur vient des tables FontMetrics (fontTextBounds) et la hauteur des
+ * yOffset / height des glyphes : aucun rendu d'essai ni getTextBounds. La
+ * largeur comme la hauteur croissent avec la taille, d'où une recherche
+ * dichotomique (log2(n) mesures au lieu de n).
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus FontMetrics.h.
+ */
+#ifndef FONTFAMILY_H
+#define FONTFAMILY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct FontFamilyEntry {
+  const GFXfont *font;
+  const FontMetrics *metrics;  // table <police>Widths
+  uint8_t points;              // taille de génération (information)
+};
+
+struct FontFamily {
+  const FontFamilyEntry *entries;  // taille croissante
+  uint8_t count;
+};
+
+// Hauteur d'encre du texte en taille 1 (y1 optionnel : haut de l'encre par
+// rapport à la ligne de base), comme h / y1 de getTextBounds sur une ligne
+inline uint16_t fontTextHeight(const GFXfont *font, const char *text, int16_t *y1 = nullptr) {
+  int16_t y = 0, miny = 0x7FFF, maxy = -0x7FFF;
+  for (const uint8_t *p = (const uint8_t *)text; *p; p++) {
+    uint8_t c = *p;
+    if (c == '\n') { y += font->yAdvance; continue; }
+    if (c == '\r' || c < font->first || c > font->last) continue;
+    const GFXglyph &g = font->glyph[c - font->first];
+    if (g.width == 0 || g.height == 0) continue;
+    if (y + g.yOffset < miny) miny = y + g.yOffset;
+    if (y + g.yOffset + g.height > maxy) maxy = y + g.yOffset + g.height;
+  }
+  if (maxy <= miny) {
+    if (y1) *y1 = 0;
+    return 0;
+  }
+  if (y1) *y1 = miny;
+  return maxy - miny;
+}
+
+// Largeur de text en taille 1, chaque chiffre mesuré comme le chiffre dont
+// l'encre est la plus large : la taille retenue ne change pas quand seuls les
+// chiffres changent (compte à rebours). Texte limité à FONT_FAMILY_MAX_TEXT.
+#ifndef FONT_FAMILY_MAX_TEXT
+  #define FONT_FAMILY_MAX_TEXT 64
+#endif
+inline uint16_t fontFamilyTextWidth(const FontMetrics *metrics, const char *text) {
+  char widest = '0';
+  if (metrics->first <= '0' && metrics->last >= '9') {
+    int16_t best = -1;
+    for (char d = '0'; d <= '9'; d++) {
+      const GlyphMetrics &g = metrics->glyphs[d - metrics->first];
+      if (g.xRight - g.xOffset > best) { best = g.xRight - g.xOffset; widest = d; }
+    }
+  }
+  char shape[FONT_FAMILY_MAX_TEXT];
+  size_t i = 0;
+  for (; text[i] && i < sizeof(shape) - 1; i++) shape[i] = (text[i] >= '0' && text[i] <= '9') ? widest : text[i];
+  shape[i] = '\0';
+  return fontTextBounds(metrics, shape, 1);
+}
+
+// Plus grand indice dont l'entrée satisfait fits (croissant puis faux), -1 si aucun
+template <typename Fits>
+int fontFamilyFit(const FontFamily &family, Fits fits) {
+  int lo = 0, hi = (int)family.count - 1, best = -1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (fits(family.entries[mid])) {
+      best = mid;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return best;
+}
+
+// Plus grande taille dont text tient dans maxW x maxH. Si aucune ne tient en
+// largeur : plus grande taille qui tient en hauteur (le texte défilera),
+// sinon la plus petite.
+inline const FontFamilyEntry &fontFamilyFitBox(const FontFamily &family, const char *text,
+                                               uint16_t maxW, uint16_t maxH) {
+  int i = fontFamilyFit(family, [&](const FontFamilyEntry &e) {
+    return fontTextHeight(e.font, text) <= maxH && fontFamilyTextWidth(e.metrics, text) <= maxW;
+  });
+  if (i < 0) {
+    i = fontFamilyFit(family, [&](const FontFamilyEntry &e) {
+      return fontTextHeight(e.font, text) <= maxH;
+    });
+  }
+  return family.entries[i < 0 ? 0 : i];
+}
+
+#endif // FONTFAMILY_H
@@ -0,0 +1,63 @@
+/**
+ * Métriques horizontales des polices : largeur de texte sans getTextBounds
+ *
+ * Pour chaque glyphe on ne garde que ce qui fixe la largeur d'une ligne :
+ * décalage gauche (xOffset), avance (xAdvance) et bord droit
+ * (xRight = xOffset + width), soit 3 octets au lieu des 7 d'un GFXglyph.
+ * Les tables sont générées avec la police (tools/font_metrics.py,
+ * tools/_fontbuild/bdf2adafruit_simple.py) sous le nom <police>Widths.
+ *
+ * fontTextBounds() parcourt le texte une seule fois, sans setFont() ni lecture
+ * des glyphes complets, et donne la même largeur (et le même x1) que
+ * display.getTextBounds(text, 0, 0, ...) sans retour à la ligne automatique
+ * (setTextWrap(false)). Vérifié par examples/font_metrics_test.cpp.
+ */
+#ifndef FONTMETRICS_H
+#define FONTMETRICS_H
+
+#include <stdint.h>
+
+struct GlyphMetrics {
+  int8_t xOffset;    // bord gauche par rapport au curseur
+  uint8_t xAdvance;  // avance du curseur
+  int8_t xRight;     // bord droit (exclu) : xOffset + largeur du bitmap
+};
+
+struct FontMetrics {
+  const GlyphMetrics *glyphs;
+  uint8_t first;
+  uint8_t last;
+};
+
+// Largeur du texte en pixels. metrics == nullptr : police 5x7 intégrée (cellule 6x8).
+// x1 (optionnel) : bord gauche, comme le x1 de getTextBounds.
+inline uint16_t fontTextBounds(const FontMetrics *metrics, const char *text, uint8_t size,
+                               int16_t *x1 = nullptr) {
+  int16_t x = 0, minx = 0x7FFF, maxx = -1;
+  for (const uint8_t *p = (const uint8_t *)text; *p; p++) {
+    uint8_t c = *p;
+    if (c == '\n') { x = 0; continue; }
+    if (c == '\r') continue;
+    if (metrics == nullptr) {
+      if (x < minx) minx = x;
+      x += 6 * size;
+      if (x - 1 > maxx) maxx = x - 1;
+      continue;
+    }
+    if (c < metrics->first || c > metrics->last) continue;
+    const GlyphMetrics &g = metrics->glyphs[c - metrics->first];
+    int16_t left = x + g.xOffset * size;
+    int16_t right = x + g.xRight * size - 1;
+    if (left < minx) minx = left;
+    if (right > maxx) maxx = right;
+    x += g.xAdvance * size;
+  }
+  if (maxx < minx) {
+    if (x1) *x1 = 0;
+    return 0;
+  }
+  if (x1) *x1 = minx;
+  return maxx - minx + 1;
+}
+
+#endif // FONTMETRICS_H
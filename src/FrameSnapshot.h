@@ -0,0 +1,275 @@
+/**
+ * Instantané du framebuffer pour l'aperçu web (/frame)
+ *
+ * PxMatrix ne sait pas relire ses buffers (plans de bits dans l'ordre de
+ * balayage du panneau). FrameMirror dérive de PxMATRIX et recopie chaque
+ * pixel dessiné dans une image RGB565 « miroir » par buffer du double
+ * buffer, depuis la tâche qui dessine. publishFrame() (appelé par
+ * presentFrame) publie le miroir du buffer arrière et incrémente le numéro
+ * de trame ; l'ISR de rafraîchissement n'est pas modifiée.
+ *
+ * La recopie ne tourne que si /frame a été demandé depuis moins de
+ * FRAME_MIRROR_IDLE_MS : sans aperçu ouvert, un dessin ne coûte qu'un test.
+ * updateMirroring() (tâche qui dessine, avant chaque trame) signale la
+ * reprise : les miroirs sont alors périmés, l'appelant redessine tout
+ * (forceLayout) et snapshot() répond 0 jusqu'à la trame suivante publiée.
+ * RAM : les deux miroirs plus la dernière trame servie (base des deltas),
+ * 3 x W x H x 2 octets alloués à la reprise et libérés à l'arrêt de la
+ * recopie ; rien au repos. L'instantané est codé directement depuis le
+ * miroir publié.
+ *
+ * Les appels non virtuels (drawPixelRGB565, clearDisplay) ne sont recopiés
+ * que si l'appelant voit le type réel : GlyphSpans.h et GlyphRun.h sont
+ * des templates pour cette raison.
+ *
+ * Format de l'instantané (entiers petit-boutistes) :
+ *   en-tête FRAME_HEADER octets : 'F', type (FRAME_FULL / FRAME_DELTA /
+ *   FRAME_SAME), largeur u16, hauteur u16, numéro de trame u32, numéro de
+ *   la trame de référence u32 (delta), puis les pixels ligne par ligne :
+ *     0x00-0x3F  n+1 pixels inchangés (delta seulement)
+ *     0x40-0x7F  n+1 pixels d'une couleur (u16 qui suit)
+ *     0x80-0xFF  n+1 couleurs littérales (u16 chacune)
+ * Compte à rebours 3x1 panneaux (3072 octets bruts) : ~40 octets par
+ * trame pour un titre fixe, ~160 quand les secondes changent, ~740 en
+ * marquee ; FRAME_HEADER seul si la trame demandée est déjà à jour.
+ *
+ * Testé en natif, rendu réel du compte à rebours compris :
+ * examples/frame_snapshot_test.cpp.
+ */
+#ifndef FRAMESNAPSHOT_H
+#define FRAMESNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_HEADER   14
+#define FRAME_MAGIC    'F'
+#define FRAME_SKIP_MAX 64
+#define FRAME_RUN_MAX  64
+#define FRAME_LIT_MAX  128
+#define FRAME_SINCE_NONE 0   // aucune trame côté client (numéros de trame >= 1)
+
+#ifndef FRAME_MIRROR_IDLE_MS
+#define FRAME_MIRROR_IDLE_MS 2000  // recopie arrêtée sans requête /frame depuis ce délai
+#endif
+
+// Taille maximale d'un instantané de `pixels` pixels (littéraux partout)
+#define FRAME_BLOB_MAX(pixels) (FRAME_HEADER + 2 * (pixels) + (pixels) / FRAME_LIT_MAX + 2)
+
+enum FrameKind : uint8_t {
+  FRAME_FULL = 0,   // image complète
+  FRAME_DELTA = 1,  // différences avec la trame de référence
+  FRAME_SAME = 2,   // trame demandée déjà à jour : en-tête seul
+};
+
+inline void framePut16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+inline void framePut32(uint8_t *p, uint32_t v) {
+  framePut16(p, (uint16_t)v);
+  framePut16(p + 2, (uint16_t)(v >> 16));
+}
+
+inline void frameWriteHeader(uint8_t *out, uint8_t kind, uint16_t width, uint16_t height, uint32_t seq,
+                             uint32_t base) {
+  out[0] = FRAME_MAGIC;
+  out[1] = kind;
+  framePut16(out + 2, width);
+  framePut16(out + 4, height);
+  framePut32(out + 6, seq);
+  framePut32(out + 10, base);
+}
+
+// Pixels de cur codés dans out (sans en-tête), en delta de base si non NULL.
+// Retourne la longueur, 0 si out est trop petit.
+inline size_t frameEncode(const uint16_t *cur, const uint16_t *base, size_t pixels, uint8_t *out,
+                          size_t outSize) {
+  size_t i = 0, o = 0;
+  while (i < pixels) {
+    if (base && cur[i] == base[i]) {
+      size_t n = 1;
+      while (i + n < pixels && n < FRAME_SKIP_MAX && cur[i + n] == base[i + n]) n++;
+      if (o + 1 > outSize) return 0;
+      out[o++] = (uint8_t)(n - 1);
+      i += n;
+      continue;
+    }
+    size_t n = 1;
+    while (i + n < pixels && n < FRAME_RUN_MAX && cur[i + n] == cur[i]) n++;
+    if (n >= 2) {
+      if (o + 3 > outSize) return 0;
+      out[o++] = (uint8_t)(0x40 | (n - 1));
+      framePut16(out + o, cur[i]);
+      o += 2;
+      i += n;
+      continue;
+    }
+    // Littéraux jusqu'au prochain pixel inchangé ou au début d'une plage
+    n = 1;
+    while (i + n < pixels && n < FRAME_LIT_MAX && !(base && cur[i + n] == base[i + n]) &&
+           !(i + n + 1 < pixels && cur[i + n] == cur[i + n + 1])) {
+      n++;
+    }
+    if (o + 1 + 2 * n > outSize) return 0;
+    out[o++] = (uint8_t)(0x80 | (n - 1));
+    for (size_t k = 0; k < n; k++, o += 2) framePut16(out + o, cur[i + k]);
+    i += n;
+  }
+  return o;
+}
+
+// Matrice dont chaque pixel dessiné est recopié dans une image RGB565 :
+// remplace `PxMATRIX display(...)` (mêmes arguments). W x H : taille du panneau.
+template <uint16_t W, uint16_t H>
+class FrameMirror : public PxMATRIX {
+public:
+  FrameMirror(uint16_t width, uint16_t height, uint8_t LATCH, uint8_t OE, uint8_t A, uint8_t B, uint8_t C)
+    : PxMATRIX(width, height, LATCH, OE, A, B, C) {}
+  ~FrameMirror() { free(_frames); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    mirrorPixel(x, y, color);
+    PxMATRIX::drawPixel(x, y, color);
+  }
+  void drawPixelRGB565(int16_t x, int16_t y, uint16_t color) {
+    mirrorPixel(x, y, color);
+    PxMATRIX::drawPixelRGB565(x, y, color);
+  }
+  void fillScreen(uint16_t color) override {
+    if (_mirroring) {
+      uint16_t *img = image(_back);
+      for (uint32_t i = 0; i < (uint32_t)W * H; i++) img[i] = color;
+    }
+    PxMATRIX::fillScreen(color);
+  }
+  void clearDisplay() {
+    if (_mirroring) memset(image(_back), 0, IMAGE_BYTES);
+    PxMATRIX::clearDisplay();
+  }
+
+  // Recopie active si /frame a été demandé récemment : images allouées à la
+  // reprise, libérées à l'arrêt. Retourne true à la reprise : les trames
+  // suivantes (deux buffers) doivent être redessinées entièrement. À appeler
+  // par la tâche qui dessine, avant la trame.
+  bool updateMirroring(uint32_t nowMs) {
+    const uint32_t requestMs = _requestMs;
+    const bool wanted = requestMs != 0 && nowMs - requestMs < FRAME_MIRROR_IDLE_MS;
+    if (!wanted) {
+      if (_mirroring) {
+        _mirroring = false;
+        _valid = false;
+        _requestMs = 0;
+      }
+      // snapshot() lève _reading avant de lire _valid : libération remise
+      // à l'appel suivant si une lecture est en cours
+      __sync_synchronize();
+      if (_frames && !_reading) {
+        free(_frames);
+        _frames = nullptr;
+        _sentSeq = FRAME_SINCE_NONE;
+      }
+      return false;
+    }
+    if (_mirroring) return false;
+    if (!_frames) {
+      _frames = (uint16_t *)calloc(3, IMAGE_BYTES);
+      if (!_frames) return false;  // nouvel essai à la trame suivante
+    }
+    _valid = false;
+    _mirroring = true;
+    return true;
+  }
+  bool mirroring() const { return _mirroring; }
+  size_t mirrorBytes() const { return _frames ? 3 * IMAGE_BYTES : 0; }
+
+  // Le buffer arrière devient la trame publiée (avant la bascule par l'ISR)
+  void publishFrame() {
+#ifdef PxMATRIX_double_buffer
+    _shown = _back;
+    _back ^= 1;
+#endif
+    __sync_synchronize();
+    if (++_seq == FRAME_SINCE_NONE) _seq = 1;
+    if (_mirroring) _valid = true;
+  }
+  uint32_t frameSeq() const { return _seq; }
+
+  // Instantané de la trame publiée dans out (FRAME_BLOB_MAX(W * H) octets) :
+  // FRAME_SAME si since est la trame publiée, delta si since est la dernière
+  // trame servie, image complète sinon. Retourne la longueur, 0 si la trame
+  // n'a pu être lue (miroir en reprise, publication pendant la lecture).
+  // Chaque appel prolonge la recopie. Appels à sérialiser (gestionnaires de
+  // la tâche AsyncTCP).
+  size_t snapshot(uint8_t *out, size_t outSize, uint32_t since, uint32_t nowMs) {
+    _requestMs = nowMs ? nowMs : 1;
+    if (outSize < FRAME_HEADER) return 0;
+    _reading = true;  // images conservées jusqu'à la fin de la lecture
+    __sync_synchronize();
+    const size_t n = snapshotImages(out, outSize, since);
+    __sync_synchronize();
+    _reading = false;
+    return n;
+  }
+
+private:
+  static const size_t IMAGE_BYTES = (size_t)W * H * sizeof(uint16_t);
+
+  // Images 0 et 1 : miroirs des buffers PxMatrix ; 2 : dernière trame servie
+  uint16_t *image(uint8_t i) const { return _frames + (size_t)i * W * H; }
+
+  size_t snapshotImages(uint8_t *out, size_t outSize, uint32_t since) {
+    for (uint8_t attempt = 0; attempt < 4; attempt++) {
+      const uint32_t seq = _seq;
+      if (since == seq) {
+        frameWriteHeader(out, FRAME_SAME, W, H, seq, since);
+        return FRAME_HEADER;
+      }
+      if (!_valid) return 0;
+      // Le miroir publié redevient buffer de dessin à la trame suivante :
+      // codage puis nouvelle lecture si une publication a eu lieu entre-temps
+      __sync_synchronize();
+      const uint16_t *cur = image(_shown);
+      uint16_t *last = image(2);
+      const bool delta = since != FRAME_SINCE_NONE && since == _sentSeq;
+      const size_t n = frameEncode(cur, delta ? last : nullptr, (size_t)W * H, out + FRAME_HEADER,
+                                   outSize - FRAME_HEADER);
+      __sync_synchronize();
+      if (_seq != seq || !_valid) continue;
+      if (n == 0) return 0;
+      // Base du prochain delta : perdue si la copie a été interrompue
+      memcpy(last, cur, IMAGE_BYTES);
+      __sync_synchronize();
+      _sentSeq = _seq == seq ? seq : FRAME_SINCE_NONE;
+      frameWriteHeader(out, delta ? FRAME_DELTA : FRAME_FULL, W, H, seq, delta ? since : FRAME_SINCE_NONE);
+      return FRAME_HEADER + n;
+    }
+    return 0;
+  }
+
+  // Même transformation que PxMATRIX::drawPixelRGB565 : image du panneau
+  void mirrorPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!_mirroring) return;
+    const uint8_t r = getRotation();
+    if (r == 1) { int16_t t = x; x = W - 1 - y; y = t; }
+    else if (r == 2) { x = W - 1 - x; y = H - 1 - y; }
+    else if (r == 3) { int16_t t = x; x = y; y = H - 1 - t; }
+    if (x < 0 || y < 0 || x >= W || y >= H) return;
+    image(_back)[y * W + x] = color;
+  }
+
+  uint16_t *_frames = nullptr;       // 3 images (voir image()), nullptr au repos
+  volatile uint8_t _back = 0;        // miroir du buffer de dessin
+  volatile uint8_t _shown = 0;       // miroir de la trame publiée
+  volatile uint32_t _seq = 1;        // numéro de la trame publiée
+  volatile uint32_t _requestMs = 0;  // dernière requête /frame, 0 : aucune
+  volatile bool _mirroring = false;  // recopie des pixels active
+  volatile bool _valid = false;      // miroir publié complet depuis la reprise
+  volatile bool _reading = false;    // snapshot() en cours (tâche AsyncTCP)
+  volatile uint32_t _sentSeq = FRAME_SINCE_NONE;
+};
+
+#endif // FRAMESNAPSHOT_H
@@ -0,0 +1,164 @@
+/**
+ * Run de glyphes : décodage UTF-8, choix des glyphes et mesure en un passage
+ *
+ * Le titre du compte à rebours arrive du formulaire web en UTF-8 alors que
+ * les polices couvrent des octets (0x20-0x7E ou Latin-1 0x20-0xFF). Plutôt
+ * que convertir dans un buffer (utf8ToLatin1), comparer (strcmp), mesurer
+ * (getTextBounds) puis tracer (print) à chaque trame, glyphRunBuild() fait en
+ * une seule boucle :
+ *  - décodage des points de code UTF-8 (séquences de 1 à 4 octets) ;
+ *  - correspondance avec un glyphe de la police : caractère direct, sinon
+ *    lettre sans accent (glyphRunFold, police sans Latin-1), ponctuation
+ *    typographique remplacée (’ “ – …), sinon '?' ;
+ *  - mesure de la boîte d'encre comme getTextBounds(text, 0, 0, ...).
+ *
+ * Le résultat est une suite compacte d'indices dans font->glyph (un octet
+ * par glyphe), gardée tant que le texte ne change pas : le tracé
+ * (glyphRunDraw) ne relit ni le texte ni les octets hors police. Une seule
+ * ligne ('\n' et autres codes de contrôle sans glyphe sont ignorés).
+ *
+ * Les tailles d'une famille (FontFamily.h) partagent la même plage de
+ * caractères : un run construit avec une taille se re-mesure pour une autre
+ * (glyphRunMeasure) sans nouveau décodage.
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus PxMatrix.h et GlyphSpans.h.
+ */
+#ifndef GLYPHRUN_H
+#define GLYPHRUN_H
+
+#include <stdint.h>
+
+#ifndef GLYPH_RUN_MAX
+  #define GLYPH_RUN_MAX 64
+#endif
+
+struct GlyphRun {
+  uint8_t glyph[GLYPH_RUN_MAX];  // indices dans font->glyph (code - font->first)
+  uint8_t length;
+  int16_t advance;               // position du curseur après le dernier glyphe
+  int16_t x1, y1;                // coin haut gauche de l'encre, curseur en (0, 0)
+  uint16_t w, h;                 // boîte d'encre (0 x 0 si aucun glyphe)
+};
+
+// Lettre Latin-1 accentuée (U+00C0..U+00FF) -> lettre ASCII, 0 si aucune
+inline char glyphRunFold(uint16_t code) {
+  switch (code) {
+    case 0xC0: case 0xC1: case 0xC2: case 0xC4: return 'A'; // ÀÁÂÄ
+    case 0xC7: return 'C';                                  // Ç
+    case 0xC8: case 0xC9: case 0xCA: case 0xCB: return 'E'; // ÈÉÊË
+    case 0xCE: case 0xCF: return 'I';                       // ÎÏ
+    case 0xD4: case 0xD6: return 'O';                       // ÔÖ
+    case 0xD9: case 0xDB: case 0xDC: return 'U';            // ÙÛÜ
+    case 0xE0: case 0xE1: case 0xE2: case 0xE4: return 'a'; // àáâä
+    case 0xE7: return 'c';                                  // ç
+    case 0xE8: case 0xE9: case 0xEA: case 0xEB: return 'e'; // èéêë
+    case 0xEE: case 0xEF: return 'i';                       // îï
+    case 0xF4: case 0xF6: return 'o';                       // ôö
+    case 0xF9: case 0xFB: case 0xFC: return 'u';            // ùûü
+    default: return 0;
+  }
+}
+
+// Remplacement ASCII des caractères hors Latin-1 (ponctuation typographique)
+inline const char *glyphRunSubstitute(uint32_t code) {
+  switch (code) {
+    case 0x2018: case 0x2019: return "'";   // ‘ ’
+    case 0x201C: case 0x201D: return "\"";  // “ ”
+    case 0x2013: case 0x2014: return "-";   // – —
+    case 0x2026: return "...";              // …
+    default: return "?";
+  }
+}
+
+// Point de code suivant ; avance s. Séquence invalide : '?' et un octet consommé.
+inline uint32_t glyphRunNextCodePoint(const uint8_t *&s) {
+  uint8_t c = *s++;
+  if (c < 0x80) return c;
+  uint8_t extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : 0;
+  if (extra == 0) return '?';
+  uint32_t code = c & (0x3F >> extra);
+  for (uint8_t i = 0; i < extra; i++) {
+    if ((s[i] & 0xC0) != 0x80) return '?';  // s[i] == 0 compris : fin de chaîne
+    code = (code << 6) | (s[i] & 0x3F);
+  }
+  s += extra;
+  return code;
+}
+
+// Boîte d'encre en cours de construction (mêmes règles que charBounds de GFX)
+struct GlyphRunBounds {
+  int16_t x = 0, minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+  void add(const GFXglyph &g) {
+    int16_t left = x + g.xOffset, top = g.yOffset;
+    int16_t right = left + g.width - 1, bottom = top + g.height - 1;
+    if (left < minx) minx = left;
+    if (top < miny) miny = top;
+    if (right > maxx) maxx = right;
+    if (bottom > maxy) maxy = bottom;
+    x += g.xAdvance;
+  }
+
+  void store(GlyphRun &run) const {
+    run.advance = x;
+    run.x1 = run.y1 = 0;
+    run.w = run.h = 0;
+    if (maxx >= minx) { run.x1 = minx; run.w = maxx - minx + 1; }
+    if (maxy >= miny) { run.y1 = miny; run.h = maxy - miny + 1; }
+  }
+};
+
+// Ajoute le glyphe du caractère c (ou de son repli) ; false si run plein
+inline bool glyphRunAppend(GlyphRun &run, GlyphRunBounds &bounds, const GFXfont *font, uint8_t c) {
+  if (run.length >= GLYPH_RUN_MAX) return false;
+  if (c < font->first || c > font->last) {
+    char folded = (c >= 0xC0) ? glyphRunFold(c) : 0;
+    if (folded) c = (uint8_t)folded;
+    else if (c >= 0x80) c = '?';
+    if (c < font->first || c > font->last) return true;  // pas de glyphe : ignoré
+  }
+  run.glyph[run.length++] = c - font->first;
+  bounds.add(font->glyph[c - font->first]);
+  return true;
+}
+
+// Décode utf8, choisit les glyphes de font et mesure, en un passage. Retourne run.length.
+inline uint8_t glyphRunBuild(GlyphRun &run, const char *utf8, const GFXfont *font) {
+  GlyphRunBounds bounds;
+  run.length = 0;
+  const uint8_t *s = (const uint8_t *)utf8;
+  bool room = true;
+  while (room && *s) {
+    uint32_t code = glyphRunNextCodePoint(s);
+    if (code <= 0xFF) {
+      room = glyphRunAppend(run, bounds, font, (uint8_t)code);
+    } else {
+      for (const char *r = glyphRunSubstitute(code); room && *r; r++) {
+        room = glyphRunAppend(run, bounds, font, (uint8_t)*r);
+      }
+    }
+  }
+  bounds.store(run);
+  return run.length;
+}
+
+// Re-mesure le run pour une autre police de même plage (autre taille de la famille)
+inline void glyphRunMeasure(GlyphRun &run, const GFXfont *font) {
+  GlyphRunBounds bounds;
+  for (uint8_t i = 0; i < run.length; i++) bounds.add(font->glyph[run.glyph[i]]);
+  bounds.store(run);
+}
+
+// Trace le run en taille 1, curseur en (x, y) (ligne de base) ; retourne x final
+template <class Matrix>
+inline int16_t glyphRunDraw(Matrix &d, int16_t x, int16_t y, const GlyphRun &run,
+                            const GFXfont *font, uint16_t color) {
+  for (uint8_t i = 0; i < run.length; i++) {
+    const GFXglyph *glyph = &font->glyph[run.glyph[i]];
+    glyphSpanDrawChar(d, x, y, glyph, font->bitmap, 1, color);
+    x += glyph->xAdvance;
+  }
+  return x;
+}
+
+#endif // GLYPHRUN_H
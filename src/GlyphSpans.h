@@ -0,0 +1,117 @@
+/**
+ * Tracé de texte par plages (spans) pour les polices GFX
+ *
+ * Remplace display.setCursor() + display.print() dans les chemins chauds
+ * (compte à rebours plein écran, texte défilant). Adafruit GFX teste chaque
+ * bit du glyphe et appelle writePixel (taille 1) ou writeFillRect (taille > 1)
+ * pour chaque bit allumé, hors écran compris. Ici :
+ *  - un glyphe entièrement hors écran est ignoré sans lire son bitmap ;
+ *  - seules les lignes visibles du glyphe sont décodées, en plages de bits
+ *    allumés consécutifs (octets nuls sautés d'un coup) ;
+ *  - chaque plage est découpée une seule fois contre l'écran puis écrite
+ *    pixel par pixel avec drawPixelRGB565 (non virtuel) sur un rectangle
+ *    déjà valide : plus de test bit à bit ni d'appel virtuel par pixel.
+ *
+ * PxMatrix garde son framebuffer privé (plans de bits) : pas d'écriture par
+ * mot possible depuis l'extérieur, la plage reste le plus petit grain.
+ *
+ * La police 5x7 intégrée (font == NULL) n'expose pas son bitmap
+ * (glcdfont.c est statique dans Adafruit GFX) : ses glyphes passent par
+ * drawChar(), qui rejette déjà les glyphes hors écran.
+ *
+ * Le résultat est identique pixel pour pixel à print() avec
+ * setTextWrap(false) et une couleur de texte sans fond (setTextColor(c)).
+ * Vérifié par examples/glyph_span_test.cpp (pio run -e native_glyph_span_test -t exec).
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus PxMatrix.h. Les
+ * fonctions acceptent un PxMATRIX ou une classe dérivée : drawPixelRGB565
+ * est résolu sur le type réel (FrameMirror, src/FrameSnapshot.h, recopie
+ * ainsi chaque plage dans son image miroir).
+ */
+#ifndef GLYPHSPANS_H
+#define GLYPHSPANS_H
+
+#include <stdint.h>
+
+// Rectangle de plage (coordonnées déjà découpées contre l'écran)
+template <class Matrix>
+inline void glyphSpanFill(Matrix &d, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) d.drawPixelRGB565(x + i, y + j, color);
+  }
+}
+
+// Trace un glyphe GFX, curseur en (x, y) (ligne de base)
+template <class Matrix>
+inline void glyphSpanDrawChar(Matrix &d, int16_t x, int16_t y, const GFXglyph *glyph,
+                              const uint8_t *bitmap, uint8_t size, uint16_t color) {
+  const int16_t w = glyph->width;
+  const int16_t h = glyph->height;
+  const int16_t gx = x + glyph->xOffset * size;
+  const int16_t gy = y + glyph->yOffset * size;
+  const int16_t screenW = d.width(), screenH = d.height();
+
+  // Découpage unique au niveau du glyphe
+  if (gx >= screenW || gy >= screenH || gx + w * size <= 0 || gy + h * size <= 0) return;
+  int16_t rowFrom = (gy < 0) ? (int16_t)((-gy) / size) : 0;
+  int16_t rowTo = h;
+  if (gy + h * size > screenH) rowTo = (screenH - gy + size - 1) / size;
+
+  const uint8_t *bits = bitmap + glyph->bitmapOffset;
+  uint32_t bit = (uint32_t)rowFrom * w;
+  for (int16_t row = rowFrom; row < rowTo; row++) {
+    int16_t py = gy + row * size, ph = size;
+    if (py < 0) { ph += py; py = 0; }
+    if (py + ph > screenH) ph = screenH - py;
+
+    // Décodage de la ligne en plages de bits allumés
+    int16_t col = 0;
+    while (col < w) {
+      uint8_t byte = bits[bit >> 3] << (bit & 7);
+      if (byte == 0) {                 // reste de l'octet éteint : saut direct
+        int16_t skip = 8 - (bit & 7);
+        col += skip; bit += skip;
+        continue;
+      }
+      if (!(byte & 0x80)) { col++; bit++; continue; }
+      int16_t start = col;
+      while (col < w && (bits[bit >> 3] & (0x80 >> (bit & 7)))) { col++; bit++; }
+
+      int16_t px = gx + start * size, pw = (col - start) * size;
+      if (px < 0) { pw += px; px = 0; }
+      if (px + pw > screenW) pw = screenW - px;
+      if (pw > 0) glyphSpanFill(d, px, py, pw, ph, color);
+    }
+    bit -= col - w;                    // un saut d'octet a pu dépasser la fin de ligne
+  }
+}
+
+// Équivalent de setCursor(x, y) + print(text) ; retourne la position x finale
+template <class Matrix>
+inline int16_t glyphSpanPrint(Matrix &d, int16_t x, int16_t y, const char *text,
+                              const GFXfont *font, uint8_t size, uint16_t color) {
+  if (size == 0) size = 1;
+  if (!font) {
+    for (const uint8_t *s = (const uint8_t *)text; *s; s++) {
+      if (*s == '\n') { x = 0; y += size * 8; continue; }
+      if (*s == '\r') continue;
+      d.drawChar(x, y, *s, color, color, size, size);
+      x += size * 6;
+    }
+    return x;
+  }
+
+  const uint8_t first = font->first, last = font->last;
+  const GFXglyph *glyphs = font->glyph;
+  for (const uint8_t *s = (const uint8_t *)text; *s; s++) {
+    uint8_t c = *s;
+    if (c == '\n') { x = 0; y += (int16_t)size * font->yAdvance; continue; }
+    if (c == '\r' || c < first || c > last) continue;
+    const GFXglyph *glyph = &glyphs[c - first];
+    glyphSpanDrawChar(d, x, y, glyph, font->bitmap, size, color);
+    x += glyph->xAdvance * (int16_t)size;
+  }
+  return x;
+}
+
+#endif // GLYPHSPANS_H
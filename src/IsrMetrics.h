@@ -0,0 +1,205 @@
+/**
+ * Instrumentation de l'ISR de rafraîchissement (display_updater)
+ *
+ * À chaque appel, l'ISR lit le compteur de cycles CPU en entrée et en sortie
+ * et range dans un anneau (ISR_METRICS_RING échantillons) :
+ *  - la durée de l'appel,
+ *  - la gigue : écart entre l'intervalle depuis l'appel précédent et la
+ *    période programmée du timer.
+ * Elle tient aussi des compteurs cumulés : appels, dépassements (durée >
+ * période du timer), durée min / max.
+ *
+ * Anneau sans verrou : un seul écrivain (l'ISR) qui écrit l'échantillon puis
+ * publie l'indice `head`. Le lecteur (page /metrics, commande série) relit
+ * `head` après la copie et écarte les échantillons écrasés entre-temps.
+ *
+ * L'ISR lit le compteur une fois en entrée et une fois en sortie
+ * (ISR_CYCLES) ; la même durée alimente l'ordonnanceur (RefreshScheduler.h).
+ * Désactivation à la compilation : -DISR_METRICS=0. ISR_METRICS_RECORD
+ * devient vide, seul l'ordonnanceur reçoit la mesure.
+ */
+#ifndef ISRMETRICS_H
+#define ISRMETRICS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef ISR_METRICS
+  #define ISR_METRICS 1
+#endif
+
+#define ISR_METRICS_RING 256   // puissance de 2
+
+struct IsrSample {
+  uint32_t durationCycles;
+  uint32_t jitterCycles;
+};
+
+struct IsrMetrics {
+  IsrSample ring[ISR_METRICS_RING];
+  volatile uint32_t head;          // nombre total d'échantillons écrits
+  volatile uint32_t periodCycles;  // période du timer en cycles
+  volatile uint32_t overruns;
+  volatile uint32_t minCycles;
+  volatile uint32_t maxCycles;
+  uint32_t lastStart;              // entrée de l'appel précédent (0 = aucun)
+  uint32_t cyclesPerUs;            // fréquence CPU en MHz
+};
+
+// Copie de travail de l'anneau : une par lecteur (pas de buffer partagé entre tâches)
+struct IsrMetricsScratch {
+  uint32_t durations[ISR_METRICS_RING];
+  uint32_t jitters[ISR_METRICS_RING];
+};
+
+// Synthèse calculée côté tâche sur le contenu de l'anneau
+struct IsrMetricsReport {
+  uint32_t calls;
+  uint32_t overruns;
+  uint32_t samples;        // échantillons valides dans l'anneau
+  float periodUs;
+  float minUs, maxUs;      // depuis la remise à zéro
+  float p50Us, p99Us;      // sur l'anneau
+  float jitterAvgUs, jitterP99Us, jitterMaxUs;
+};
+
+inline void isrMetricsReset(IsrMetrics &m) {
+  m.head = 0;
+  m.overruns = 0;
+  m.minCycles = UINT32_MAX;
+  m.maxCycles = 0;
+  m.lastStart = 0;
+}
+
+inline void isrMetricsInit(IsrMetrics &m, uint32_t cpuMHz, uint32_t periodUs) {
+  m.cyclesPerUs = cpuMHz;
+  m.periodCycles = periodUs * cpuMHz;
+  isrMetricsReset(m);
+}
+
+// À rappeler à chaque timerAlarmWrite()
+inline void isrMetricsSetPeriod(IsrMetrics &m, uint32_t periodUs) {
+  m.periodCycles = periodUs * m.cyclesPerUs;
+}
+
+// Enregistrement depuis l'ISR : start / end = compteur de cycles
+__attribute__((always_inline)) inline void isrMetricsRecord(IsrMetrics &m, uint32_t start, uint32_t end) {
+  uint32_t duration = end - start;
+  uint32_t jitter = 0;
+  if (m.lastStart != 0) {
+    uint32_t interval = start - m.lastStart;
+    jitter = interval > m.periodCycles ? interval - m.periodCycles : m.periodCycles - interval;
+  }
+  m.lastStart = start;
+  if (duration > m.periodCycles) m.overruns++;
+  if (duration < m.minCycles) m.minCycles = duration;
+  if (duration > m.maxCycles) m.maxCycles = duration;
+
+  uint32_t h = m.head;
+  IsrSample &s = m.ring[h & (ISR_METRICS_RING - 1)];
+  s.durationCycles = duration;
+  s.jitterCycles = jitter;
+  __sync_synchronize();   // échantillon visible avant la publication de head
+  m.head = h + 1;
+}
+
+// Tri par insertion en place (au plus ISR_METRICS_RING valeurs, hors ISR)
+inline void isrMetricsSort(uint32_t *v, uint32_t n) {
+  for (uint32_t i = 1; i < n; i++) {
+    uint32_t x = v[i];
+    uint32_t j = i;
+    while (j > 0 && v[j - 1] > x) { v[j] = v[j - 1]; j--; }
+    v[j] = x;
+  }
+}
+
+inline uint32_t isrMetricsPercentile(const uint32_t *sorted, uint32_t n, uint32_t pct) {
+  if (n == 0) return 0;
+  uint32_t idx = (n * pct + 99) / 100;   // rang supérieur
+  return sorted[idx == 0 ? 0 : idx - 1];
+}
+
+// Lecture sans verrou de l'anneau et calcul de la synthèse (hors ISR)
+inline IsrMetricsReport isrMetricsReport(const IsrMetrics &m, IsrMetricsScratch &scratch) {
+  uint32_t *durations = scratch.durations;
+  uint32_t *jitters = scratch.jitters;
+  IsrMetricsReport r = {};
+
+  uint32_t h1 = m.head;
+  __sync_synchronize();
+  uint32_t first = h1 > ISR_METRICS_RING ? h1 - ISR_METRICS_RING : 0;
+  uint32_t n = 0;
+  for (uint32_t i = first; i < h1; i++) {
+    const IsrSample &s = m.ring[i & (ISR_METRICS_RING - 1)];
+    durations[n] = s.durationCycles;
+    jitters[n] = s.jitterCycles;
+    n++;
+  }
+  __sync_synchronize();
+  // Échantillons réécrits par l'ISR pendant la copie : on les écarte
+  uint32_t h2 = m.head;
+  uint32_t skip = 0;
+  if (h2 - first >= ISR_METRICS_RING) {
+    skip = h2 - first - ISR_METRICS_RING + 1;
+    if (skip > n) skip = n;
+  }
+  uint32_t *d = durations + skip;
+  uint32_t *j = jitters + skip;
+  n -= skip;
+
+  const float cpu = m.cyclesPerUs ? (float)m.cyclesPerUs : 1.0f;
+  uint64_t jitterSum = 0;
+  for (uint32_t i = 0; i < n; i++) jitterSum += j[i];
+  isrMetricsSort(d, n);
+  isrMetricsSort(j, n);
+
+  r.calls = h2;
+  r.overruns = m.overruns;
+  r.samples = n;
+  r.periodUs = m.periodCycles / cpu;
+  r.minUs = (h2 ? m.minCycles : 0) / cpu;
+  r.maxUs = m.maxCycles / cpu;
+  r.p50Us = isrMetricsPercentile(d, n, 50) / cpu;
+  r.p99Us = isrMetricsPercentile(d, n, 99) / cpu;
+  r.jitterAvgUs = n ? (float)jitterSum / n / cpu : 0;
+  r.jitterP99Us = isrMetricsPercentile(j, n, 99) / cpu;
+  r.jitterMaxUs = n ? j[n - 1] / cpu : 0;
+  return r;
+}
+
+// Synthèse en JSON (endpoint /metrics)
+inline int isrMetricsToJson(const IsrMetricsReport &r, char *buf, size_t size) {
+  return snprintf(buf, size,
+    "{\"calls\":%u,\"overruns\":%u,\"samples\":%u,\"period_us\":%.1f,"
+    "\"min_us\":%.1f,\"max_us\":%.1f,\"p50_us\":%.1f,\"p99_us\":%.1f,"
+    "\"jitter_avg_us\":%.1f,\"jitter_p99_us\":%.1f,\"jitter_max_us\":%.1f}",
+    (unsigned)r.calls, (unsigned)r.overruns, (unsigned)r.samples, r.periodUs,
+    r.minUs, r.maxUs, r.p50Us, r.p99Us, r.jitterAvgUs, r.jitterP99Us, r.jitterMaxUs);
+}
+
+// Synthèse lisible (commande série METRICS)
+inline int isrMetricsToText(const IsrMetricsReport &r, char *buf, size_t size) {
+  return snprintf(buf, size,
+    "ISR: %u appels, %u depassements, periode %.1f us\n"
+    "  duree : min %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us (%u echantillons)\n"
+    "  gigue : moy %.1f us, p99 %.1f us, max %.1f us\n",
+    (unsigned)r.calls, (unsigned)r.overruns, r.periodUs,
+    r.minUs, r.p50Us, r.p99Us, r.maxUs, (unsigned)r.samples,
+    r.jitterAvgUs, r.jitterP99Us, r.jitterMaxUs);
+}
+
+// Lecture du compteur de cycles dans l'ISR : mesure unique, partagée avec
+// l'ordonnanceur (refreshSchedulerRecordIsr) même sans instrumentation
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <xtensa/core-macros.h>
+  #define ISR_CYCLES() xthal_get_ccount()
+#else
+  #define ISR_CYCLES() ((uint32_t)micros())
+#endif
+#if ISR_METRICS
+  #define ISR_METRICS_RECORD(m, start, end) isrMetricsRecord((m), (start), (end))
+#else
+  #define ISR_METRICS_RECORD(m, start, end)
+#endif
+
+#endif // ISRMETRICS_H
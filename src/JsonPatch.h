@@ -0,0 +1,252 @@
+/**
+ * Application d'un objet JSON plat à une structure, champ par champ
+ *
+ * Pendant de JsonWriter.h pour les requêtes : le corps
+ * {"marqueeGap":32,"title":"FIN"} est lu directement depuis le buffer reçu,
+ * sans String ni allocation, et chaque membre est écrit dans la structure
+ * cible d'après une table (clé, type, offsetof, bornes). Seuls les membres
+ * présents sont modifiés : la cible est une copie de travail, publiée par
+ * l'appelant seulement si tout le corps est valide.
+ *
+ * Refusé (message « clé: raison » dans err) : JSON mal formé, objets ou
+ * tableaux imbriqués, clé inconnue, type inattendu, entier hors bornes ou
+ * non entier, chaîne trop longue ou contenant \u0000. Les booléens
+ * acceptent aussi 0 et 1 (valeurs du formulaire).
+ *
+ * Usage :
+ *   static const JsonPatchField fields[] = {
+ *     { "marqueeGap", JSON_PATCH_INT, offsetof(Settings, marqueeGap), 4, 256 },
+ *     { "title", JSON_PATCH_STRING, offsetof(Settings, title), 0, sizeof(Settings::title) },
+ *   };
+ *   int n = jsonPatchApply(body, len, fields, 2, &staging, err, sizeof(err));
+ */
+#ifndef JSONPATCH_H
+#define JSONPATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+enum JsonPatchType : uint8_t {
+  JSON_PATCH_INT,     // int, bornes min..max
+  JSON_PATCH_BOOL,    // bool
+  JSON_PATCH_STRING,  // char[max], zéro final compris
+};
+
+struct JsonPatchField {
+  const char *key;
+  uint8_t type;
+  uint16_t offset;    // offsetof dans la structure cible
+  int32_t min, max;
+};
+
+#define JSON_PATCH_KEY_MAX 32
+
+struct JsonPatchReader {
+  const char *p, *end;
+  char *err;
+  size_t errSize;
+};
+
+// Message d'erreur « prefix: reason » tronqué à errSize
+inline bool jsonPatchFail(JsonPatchReader &r, const char *prefix, const char *reason) {
+  if (r.errSize == 0) return false;
+  size_t o = 0;
+  const char *parts[3] = { prefix, prefix[0] ? ": " : "", reason };
+  for (const char *s : parts) {
+    while (*s && o + 1 < r.errSize) r.err[o++] = *s++;
+  }
+  r.err[o] = '\0';
+  return false;
+}
+
+inline void jsonPatchSkipSpace(JsonPatchReader &r) {
+  while (r.p < r.end && (*r.p == ' ' || *r.p == '\t' || *r.p == '\n' || *r.p == '\r')) r.p++;
+}
+
+inline int jsonPatchHex(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+inline bool jsonPatchHex4(JsonPatchReader &r, uint32_t &v) {
+  if (r.end - r.p < 4) return false;
+  v = 0;
+  for (int i = 0; i < 4; i++) {
+    const int h = jsonPatchHex(*r.p++);
+    if (h < 0) return false;
+    v = v << 4 | (uint32_t)h;
+  }
+  return true;
+}
+
+// Chaîne JSON (r.p sur le guillemet ouvrant) décodée en UTF-8 dans out
+// (size octets, zéro final compris). Résultat : longueur, -1 si mal formée,
+// -2 si trop longue, -3 si \u0000.
+inline int jsonPatchString(JsonPatchReader &r, char *out, size_t size) {
+  r.p++;
+  size_t o = 0;
+  bool tooLong = false;
+  while (r.p < r.end && *r.p != '"') {
+    char utf8[4];
+    size_t n = 1;
+    const uint8_t c = (uint8_t)*r.p++;
+    if (c < 0x20) return -1;
+    utf8[0] = (char)c;
+    if (c == '\\') {
+      if (r.p >= r.end) return -1;
+      const char e = *r.p++;
+      switch (e) {
+        case '"': case '\\': case '/': utf8[0] = e; break;
+        case 'b': utf8[0] = '\b'; break;
+        case 'f': utf8[0] = '\f'; break;
+        case 'n': utf8[0] = '\n'; break;
+        case 'r': utf8[0] = '\r'; break;
+        case 't': utf8[0] = '\t'; break;
+        case 'u': {
+          uint32_t cp;
+          if (!jsonPatchHex4(r, cp)) return -1;
+          if (cp >= 0xDC00 && cp <= 0xDFFF) return -1;
+          if (cp >= 0xD800 && cp <= 0xDBFF) {   // paire de substitution
+            uint32_t lo;
+            if (r.end - r.p < 2 || r.p[0] != '\\' || r.p[1] != 'u') return -1;
+            r.p += 2;
+            if (!jsonPatchHex4(r, lo) || lo < 0xDC00 || lo > 0xDFFF) return -1;
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+          }
+          if (cp == 0) return -3;
+          if (cp < 0x80) {
+            utf8[0] = (char)cp;
+          } else if (cp < 0x800) {
+            utf8[0] = (char)(0xC0 | cp >> 6);
+            utf8[1] = (char)(0x80 | (cp & 0x3F));
+            n = 2;
+          } else if (cp < 0x10000) {
+            utf8[0] = (char)(0xE0 | cp >> 12);
+            utf8[1] = (char)(0x80 | (cp >> 6 & 0x3F));
+            utf8[2] = (char)(0x80 | (cp & 0x3F));
+            n = 3;
+          } else {
+            utf8[0] = (char)(0xF0 | cp >> 18);
+            utf8[1] = (char)(0x80 | (cp >> 12 & 0x3F));
+            utf8[2] = (char)(0x80 | (cp >> 6 & 0x3F));
+            utf8[3] = (char)(0x80 | (cp & 0x3F));
+            n = 4;
+          }
+          break;
+        }
+        default: return -1;
+      }
+    }
+    if (o + n >= size) tooLong = true;
+    else { memcpy(out + o, utf8, n); o += n; }
+  }
+  if (r.p >= r.end) return -1;
+  r.p++;
+  if (size > 0) out[tooLong ? 0 : o] = '\0';
+  return tooLong ? -2 : (int)o;
+}
+
+// Entier JSON ; faux si fraction, exposant ou hors de int32_t
+inline bool jsonPatchInt(JsonPatchReader &r, int32_t &value) {
+  const bool negative = r.p < r.end && *r.p == '-';
+  if (negative) r.p++;
+  if (r.p >= r.end || *r.p < '0' || *r.p > '9') return false;
+  int64_t v = 0;
+  while (r.p < r.end && *r.p >= '0' && *r.p <= '9') {
+    v = v * 10 + (*r.p++ - '0');
+    if (v > 0x80000000LL) return false;
+  }
+  if (r.p < r.end && (*r.p == '.' || *r.p == 'e' || *r.p == 'E')) return false;
+  if (negative) v = -v;
+  if (v > INT32_MAX) return false;
+  value = (int32_t)v;
+  return true;
+}
+
+inline bool jsonPatchLiteral(JsonPatchReader &r, const char *word) {
+  const size_t n = strlen(word);
+  if ((size_t)(r.end - r.p) < n || memcmp(r.p, word, n) != 0) return false;
+  r.p += n;
+  return true;
+}
+
+// Valeur du membre key écrite dans target selon son champ
+inline bool jsonPatchValue(JsonPatchReader &r, const JsonPatchField &f, const char *key, void *target) {
+  uint8_t *dst = (uint8_t *)target + f.offset;
+  const char c = r.p < r.end ? *r.p : '\0';
+  if (f.type == JSON_PATCH_STRING) {
+    if (c != '"') return jsonPatchFail(r, key, "chaine attendue");
+    const int n = jsonPatchString(r, (char *)dst, (size_t)f.max);
+    if (n == -2) return jsonPatchFail(r, key, "trop long");
+    if (n == -3) return jsonPatchFail(r, key, "caractere nul");
+    if (n < 0) return jsonPatchFail(r, key, "chaine mal formee");
+    return true;
+  }
+  int32_t v;
+  if (f.type == JSON_PATCH_BOOL) {
+    if (jsonPatchLiteral(r, "true")) v = 1;
+    else if (jsonPatchLiteral(r, "false")) v = 0;
+    else if (!jsonPatchInt(r, v) || (v != 0 && v != 1)) return jsonPatchFail(r, key, "booleen attendu");
+    const bool b = v != 0;
+    memcpy(dst, &b, sizeof(b));
+    return true;
+  }
+  if (c != '-' && (c < '0' || c > '9')) return jsonPatchFail(r, key, "entier attendu");
+  if (!jsonPatchInt(r, v)) return jsonPatchFail(r, key, "entier invalide");
+  if (v < f.min || v > f.max) return jsonPatchFail(r, key, "hors bornes");
+  const int i = (int)v;
+  memcpy(dst, &i, sizeof(i));
+  return true;
+}
+
+// Applique l'objet json (len octets) à target ; nombre de membres appliqués,
+// -1 si le corps est refusé (target partiellement modifiée : la jeter).
+// present (facultatif) : bit i levé si fields[i] figure dans le corps
+// (64 premiers champs).
+inline int jsonPatchApply(const char *json, size_t len, const JsonPatchField *fields, size_t count, void *target,
+                          char *err, size_t errSize, uint64_t *present = nullptr) {
+  JsonPatchReader r = { json, json + len, err, errSize };
+  if (errSize) err[0] = '\0';
+  if (present) *present = 0;
+  jsonPatchSkipSpace(r);
+  if (r.p >= r.end || *r.p != '{') { jsonPatchFail(r, "", "objet JSON attendu"); return -1; }
+  r.p++;
+  int applied = 0;
+  jsonPatchSkipSpace(r);
+  if (r.p < r.end && *r.p == '}') {
+    r.p++;
+  } else {
+    for (;;) {
+      jsonPatchSkipSpace(r);
+      char key[JSON_PATCH_KEY_MAX];
+      if (r.p >= r.end || *r.p != '"') { jsonPatchFail(r, "", "cle attendue"); return -1; }
+      const int kn = jsonPatchString(r, key, sizeof(key));
+      if (kn == -1) { jsonPatchFail(r, "", "cle mal formee"); return -1; }
+      const JsonPatchField *f = nullptr;
+      for (size_t i = 0; kn >= 0 && i < count && !f; i++) {
+        if (strcmp(fields[i].key, key) == 0) f = &fields[i];
+      }
+      if (!f) { jsonPatchFail(r, kn >= 0 ? key : "", "cle inconnue"); return -1; }
+      jsonPatchSkipSpace(r);
+      if (r.p >= r.end || *r.p != ':') { jsonPatchFail(r, key, "':' attendu"); return -1; }
+      r.p++;
+      jsonPatchSkipSpace(r);
+      if (!jsonPatchValue(r, *f, key, target)) return -1;
+      if (present && f - fields < 64) *present |= (uint64_t)1 << (f - fields);
+      applied++;
+      jsonPatchSkipSpace(r);
+      if (r.p < r.end && *r.p == ',') { r.p++; continue; }
+      if (r.p < r.end && *r.p == '}') { r.p++; break; }
+      jsonPatchFail(r, key, "',' ou '}' attendu");
+      return -1;
+    }
+  }
+  jsonPatchSkipSpace(r);
+  if (r.p != r.end) { jsonPatchFail(r, "", "donnees apres l'objet"); return -1; }
+  return applied;
+}
+
+#endif // JSONPATCH_H
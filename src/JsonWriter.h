@@ -0,0 +1,120 @@
+/**
+ * Écriture JSON dans un buffer fixe, sans allocation
+ *
+ * Remplace les concaténations « json += "\"cle\":" + String(x) + "," » :
+ * chaque expression créait des String temporaires et pouvait réallouer la
+ * réponse, à chaque interrogation de l'interface web. Ici les clés et les
+ * valeurs sont écrites directement dans le buffer fourni (entiers convertis
+ * à la main, pas de printf), les chaînes sont échappées (guillemets,
+ * antislash, caractères de contrôle ; l'UTF-8 passe tel quel).
+ *
+ * Buffer trop petit : overflow est levé, l'écriture s'arrête et jsonEnd()
+ * renvoie 0 (le gestionnaire répond alors une erreur plutôt qu'un JSON
+ * tronqué).
+ *
+ * Usage :
+ *   JsonWriter w;
+ *   jsonBegin(w, buf, sizeof(buf));
+ *   jsonAddString(w, "title", countdownTitle);
+ *   jsonAddInt(w, "year", countdownYear);
+ *   size_t len = jsonEnd(w);
+ */
+#ifndef JSONWRITER_H
+#define JSONWRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+struct JsonWriter {
+  char *buf;
+  size_t size;      // taille du buffer (zéro final compris)
+  size_t length;    // octets écrits
+  bool first;       // aucun membre écrit depuis jsonBegin
+  bool overflow;
+};
+
+inline void jsonPut(JsonWriter &w, const char *s, size_t n) {
+  if (w.overflow || w.length + n >= w.size) {
+    w.overflow = true;
+    return;
+  }
+  memcpy(w.buf + w.length, s, n);
+  w.length += n;
+}
+
+inline void jsonPutChar(JsonWriter &w, char c) {
+  jsonPut(w, &c, 1);
+}
+
+inline void jsonBegin(JsonWriter &w, char *buf, size_t size) {
+  w.buf = buf;
+  w.size = size;
+  w.length = 0;
+  w.first = true;
+  w.overflow = size == 0;
+  jsonPutChar(w, '{');
+}
+
+// Chaîne entre guillemets, échappée
+inline void jsonPutString(JsonWriter &w, const char *s) {
+  static const char hex[] = "0123456789abcdef";
+  jsonPutChar(w, '"');
+  const char *run = s;   // octets sans échappement, copiés d'un bloc
+  for (; *s; s++) {
+    const uint8_t c = (uint8_t)*s;
+    if (c >= 0x20 && c != '"' && c != '\\') continue;
+    jsonPut(w, run, (size_t)(s - run));
+    run = s + 1;
+    char esc[6] = { '\\', (char)c, 0, 0, 0, 0 };
+    size_t n = 2;
+    switch (c) {
+      case '"': case '\\': break;
+      case '\n': esc[1] = 'n'; break;
+      case '\r': esc[1] = 'r'; break;
+      case '\t': esc[1] = 't'; break;
+      case '\b': esc[1] = 'b'; break;
+      case '\f': esc[1] = 'f'; break;
+      default:
+        esc[1] = 'u'; esc[2] = '0'; esc[3] = '0'; esc[4] = hex[c >> 4]; esc[5] = hex[c & 15];
+        n = 6;
+        break;
+    }
+    jsonPut(w, esc, n);
+  }
+  jsonPut(w, run, (size_t)(s - run));
+  jsonPutChar(w, '"');
+}
+
+// Séparateur et clé d'un membre
+inline void jsonPutKey(JsonWriter &w, const char *key) {
+  if (!w.first) jsonPutChar(w, ',');
+  w.first = false;
+  jsonPutString(w, key);
+  jsonPutChar(w, ':');
+}
+
+inline void jsonAddInt(JsonWriter &w, const char *key, long value) {
+  jsonPutKey(w, key);
+  char digits[24];
+  size_t n = 0;
+  unsigned long v = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+  do { digits[sizeof(digits) - 1 - n++] = (char)('0' + v % 10); v /= 10; } while (v);
+  if (value < 0) digits[sizeof(digits) - 1 - n++] = '-';
+  jsonPut(w, digits + sizeof(digits) - n, n);
+}
+
+inline void jsonAddString(JsonWriter &w, const char *key, const char *value) {
+  jsonPutKey(w, key);
+  jsonPutString(w, value);
+}
+
+// Ferme l'objet ; longueur du JSON (zéro final écrit), 0 si le buffer a débordé
+inline size_t jsonEnd(JsonWriter &w) {
+  jsonPutChar(w, '}');
+  if (w.overflow) return 0;
+  w.buf[w.length] = '\0';
+  return w.length;
+}
+
+#endif // JSONWRITER_H
@@ -0,0 +1,166 @@
+// Généré par tools/web_gzip.py depuis src/PageIndex.h : ne pas modifier
+#ifndef PAGEINDEXGZ_H
+#define PAGEINDEXGZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MAIN_page : 4678 octets -> 1647 octets gzip (35 %)
+static const uint8_t MAIN_page_gz[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xA5, 0x58, 0xEF, 0x72, 0xDB, 0xB8,
+  0x11, 0x7F, 0x15, 0xF4, 0x32, 0x3D, 0x48, 0x53, 0x4B, 0x14, 0x65, 0x2B, 0x71, 0xF4, 0x87, 0x1D,
+  0xC7, 0x71, 0x9A, 0xDE, 0x25, 0x17, 0x4F, 0xEC, 0xEB, 0x4D, 0x3E, 0x79, 0x20, 0x72, 0x29, 0xA1,
+  0x01, 0x01, 0x06, 0x00, 0x6D, 0xAB, 0x1A, 0xCD, 0xDC, 0xA3, 0xF4, 0x6B, 0x9E, 0xC3, 0x2F, 0xD6,
+  0x05, 0x41, 0x49, 0x94, 0xAC, 0x68, 0x64, 0xF7, 0x8B, 0x04, 0x2C, 0x16, 0xBF, 0x5D, 0xFC, 0x80,
+  0xDD, 0x05, 0x38, 0xFC, 0xCB, 0xDB, 0x4F, 0xE7, 0xD7, 0x5F, 0x2E, 0x2F, 0xC8, 0xD4, 0x66, 0x22,
+  0x1A, 0xBA, 0x5F, 0x22, 0x98, 0x9C, 0x8C, 0x68, 0xAA, 0x29, 0xF6, 0x81, 0x25, 0xD1, 0x30, 0x03,
+  0xCB, 0x48, 0x3C, 0x65, 0xDA, 0x80, 0x1D, 0xD1, 0xDF, 0xAF, 0xDF, 0xB5, 0x4E, 0x69, 0x25, 0x95,
+  0x2C, 0x83, 0x11, 0xBD, 0xE5, 0x70, 0x97, 0x2B, 0x6D, 0x29, 0x89, 0x95, 0xB4, 0x20, 0x51, 0xEB,
+  0x8E, 0x27, 0x76, 0x3A, 0x4A, 0xE0, 0x96, 0xC7, 0xD0, 0x2A, 0x3B, 0x47, 0x5C, 0x72, 0xCB, 0x99,
+  0x68, 0x99, 0x98, 0x09, 0x18, 0x85, 0x9B, 0x10, 0xAC, 0xB0, 0x53, 0xA5, 0x6B, 0x00, 0xE7, 0xE2,
+  0xE1, 0x7B, 0x86, 0x2D, 0x72, 0xC5, 0xB8, 0x40, 0x97, 0x2C, 0x69, 0x80, 0x80, 0xD8, 0x6A, 0x25,
+  0x5B, 0x9A, 0x69, 0x68, 0xE2, 0x7C, 0xCB, 0xAD, 0x80, 0xE8, 0xE2, 0xEA, 0xF2, 0xB8, 0x4B, 0x2E,
+  0xC3, 0x0E, 0x39, 0x17, 0x2A, 0xFE, 0x3A, 0x0C, 0xBC, 0x78, 0x68, 0xEC, 0x0C, 0xFF, 0xC6, 0x2A,
+  0x99, 0xCD, 0x53, 0x44, 0x6D, 0xA5, 0x2C, 0xE3, 0x62, 0xD6, 0x3F, 0xD3, 0xE8, 0xC4, 0xD1, 0x7B,
+  0x10, 0xB7, 0x60, 0x79, 0xCC, 0x8E, 0x0C, 0x93, 0xA6, 0x65, 0x40, 0xF3, 0x74, 0x90, 0x31, 0x3D,
+  0xE1, 0xB2, 0xDF, 0x19, 0xE4, 0x2C, 0x49, 0xB8, 0x9C, 0xF4, 0x43, 0x0D, 0xD9, 0x60, 0xCC, 0xE2,
+  0xAF, 0x13, 0xAD, 0x0A, 0x99, 0xF4, 0x5F, 0x84, 0x61, 0x38, 0x88, 0x95, 0x50, 0xBA, 0xFF, 0x02,
+  0x00, 0x16, 0xD3, 0x70, 0x6E, 0xE1, 0xDE, 0xB6, 0x98, 0xE0, 0x13, 0xD9, 0x8F, 0xD1, 0x5D, 0xD0,
+  0xCB, 0xF1, 0x93, 0x98, 0xA5, 0xBD, 0xCE, 0xA0, 0x34, 0x6D, 0xF8, 0x7F, 0xA0, 0x1F, 0xB6, 0x4F,
+  0x1C, 0x5C, 0x65, 0xA4, 0xDD, 0xC5, 0x0E, 0xE9, 0x2C, 0x52, 0x0E, 0x22, 0x41, 0x62, 0xE7, 0x63,
+  0xA5, 0x13, 0xD0, 0xFD, 0x30, 0xBF, 0x27, 0x46, 0x09, 0x9E, 0x90, 0x17, 0xC7, 0xC7, 0xC7, 0x03,
+  0x2F, 0xC5, 0x15, 0x27, 0xBC, 0x30, 0xFD, 0x97, 0xF9, 0xFD, 0xCA, 0x49, 0xD2, 0x21, 0xA5, 0x7B,
+  0x4B, 0x5F, 0xDB, 0xA7, 0xD8, 0x5B, 0x08, 0x98, 0x80, 0x4C, 0xE6, 0x4B, 0x61, 0x87, 0xB4, 0x7B,
+  0x4E, 0x69, 0x87, 0x4F, 0x77, 0xC0, 0x27, 0x53, 0xDB, 0x1F, 0x2B, 0x91, 0x2C, 0x04, 0x1B, 0x83,
+  0x98, 0x27, 0xDC, 0xE4, 0x82, 0xCD, 0xFA, 0x63, 0x47, 0x63, 0x65, 0xA7, 0x65, 0x55, 0xDE, 0xF7,
+  0x18, 0xEB, 0x95, 0xB4, 0x4F, 0x9D, 0x60, 0xC1, 0x65, 0x5E, 0xD8, 0x23, 0x53, 0x6E, 0xCB, 0xBC,
+  0xDC, 0xE3, 0x7E, 0xD8, 0xE9, 0xFC, 0x75, 0xED, 0x51, 0x6D, 0xBD, 0x1E, 0xA7, 0xBB, 0xCD, 0x67,
+  0xB7, 0xDB, 0x1D, 0x3C, 0x5E, 0xF8, 0xC9, 0xC9, 0x49, 0x8D, 0xE5, 0x2D, 0x0E, 0x4E, 0x90, 0x83,
+  0x9A, 0x2B, 0xAF, 0x9D, 0x27, 0xE3, 0xC2, 0x5A, 0x25, 0xE7, 0x75, 0x53, 0xAF, 0x9C, 0xA9, 0x9A,
+  0x53, 0x75, 0xAB, 0x15, 0x0D, 0x95, 0x89, 0x34, 0x4D, 0x97, 0x3E, 0x48, 0x25, 0x61, 0xED, 0x7E,
+  0xCF, 0xAD, 0x92, 0x78, 0xA4, 0xBA, 0xC5, 0x92, 0x8D, 0xC7, 0x4E, 0xC5, 0x85, 0x36, 0x88, 0x97,
+  0x2B, 0xEE, 0x8E, 0xC1, 0xA2, 0x3D, 0xD1, 0x3C, 0x59, 0x71, 0xEA, 0x3A, 0x03, 0xF7, 0xD3, 0xB2,
+  0x90, 0xA1, 0xC4, 0x42, 0x0B, 0xCD, 0x17, 0x99, 0x34, 0x7D, 0x0D, 0x39, 0x30, 0xDB, 0xC0, 0x08,
+  0x50, 0xAD, 0x94, 0xDB, 0xA3, 0x8C, 0xCB, 0x8C, 0xDD, 0x37, 0xC2, 0xB0, 0x93, 0xDF, 0x1F, 0x85,
+  0xA9, 0x6E, 0x36, 0x07, 0x13, 0x56, 0x6D, 0xC2, 0xA2, 0x9D, 0x2A, 0x85, 0xE8, 0x3B, 0x8E, 0x5D,
+  0xCD, 0xC3, 0x97, 0xBD, 0x2D, 0xE2, 0xCB, 0x83, 0xA2, 0x72, 0x16, 0x73, 0x3B, 0xC3, 0xE1, 0x05,
+  0x6B, 0x0B, 0x2E, 0xBF, 0xB6, 0xC6, 0x56, 0xAE, 0x1C, 0xE4, 0x12, 0x45, 0xD0, 0xAA, 0xEF, 0x3D,
+  0xEE, 0x57, 0xC9, 0x40, 0xA7, 0xB6, 0xA3, 0x9E, 0x92, 0x97, 0x8F, 0xE2, 0xE2, 0xF5, 0xAB, 0x97,
+  0x49, 0xB7, 0xCE, 0x68, 0xE9, 0x60, 0x02, 0xB1, 0xD2, 0xCC, 0x72, 0x25, 0x3D, 0xB5, 0x7B, 0x77,
+  0xF2, 0x55, 0xB9, 0xC0, 0x61, 0xE0, 0xE3, 0x76, 0x68, 0x62, 0xCD, 0x73, 0x1B, 0xA5, 0x85, 0x8C,
+  0x1D, 0x00, 0xF9, 0x66, 0x1A, 0xBC, 0x39, 0xD7, 0x60, 0x0B, 0x2D, 0x49, 0xA2, 0xE2, 0xC2, 0x65,
+  0x87, 0xF6, 0x04, 0xEC, 0x85, 0x00, 0xD7, 0x7C, 0x33, 0xFB, 0x67, 0x82, 0x1A, 0x83, 0xC5, 0x6A,
+  0x86, 0xC1, 0x48, 0x68, 0xF0, 0xA4, 0x39, 0xC7, 0xA4, 0x62, 0x2C, 0x49, 0x47, 0x0E, 0x22, 0x69,
+  0x0E, 0x7C, 0x37, 0x1F, 0x49, 0xB8, 0x23, 0xBF, 0x7F, 0xFE, 0x70, 0x05, 0x4C, 0xC7, 0xD3, 0x4B,
+  0xA6, 0x59, 0x66, 0x1A, 0x4E, 0xF6, 0x4E, 0xE9, 0xEC, 0x2D, 0xB3, 0xAC, 0x91, 0x22, 0xF5, 0x29,
+  0xD8, 0x78, 0xDA, 0xA0, 0x01, 0x86, 0xA8, 0x45, 0x0A, 0xCC, 0xDF, 0xE9, 0xDF, 0xF2, 0xB6, 0x55,
+  0x57, 0x56, 0x63, 0xAF, 0xD1, 0x6C, 0xB6, 0xED, 0x14, 0x64, 0x43, 0x8F, 0x22, 0xDD, 0x76, 0x4B,
+  0x5E, 0x49, 0x1A, 0xCD, 0x51, 0x34, 0x47, 0x83, 0x34, 0x33, 0x13, 0xDA, 0x2C, 0xC7, 0xCE, 0x97,
+  0xB9, 0xED, 0xD3, 0xAF, 0x74, 0x80, 0x78, 0xD7, 0x3C, 0x03, 0x55, 0xD8, 0x52, 0xF5, 0x07, 0x9A,
+  0xF4, 0x28, 0xEC, 0x75, 0x3A, 0xB8, 0xA8, 0xE6, 0xA0, 0x5A, 0x79, 0xCA, 0x84, 0x81, 0x81, 0xA3,
+  0xC9, 0xF3, 0x33, 0x0C, 0x7C, 0x92, 0x76, 0x79, 0x0E, 0x13, 0x76, 0x58, 0x4B, 0x87, 0x9F, 0xFF,
+  0xF1, 0x66, 0x99, 0x12, 0x51, 0x3E, 0x4C, 0xF8, 0x2D, 0xE1, 0xC9, 0xA8, 0x34, 0x43, 0x4A, 0x92,
+  0x47, 0x74, 0xEF, 0x31, 0x72, 0x09, 0x65, 0x30, 0xF5, 0x69, 0xA2, 0x3C, 0x41, 0x98, 0x72, 0x03,
+  0x44, 0x89, 0x86, 0x29, 0x32, 0x54, 0x62, 0x59, 0x5C, 0x82, 0xA3, 0x8B, 0x12, 0xE4, 0xB4, 0x18,
+  0x67, 0xDC, 0x8E, 0x7E, 0xAA, 0x1C, 0x2D, 0xD9, 0x5F, 0x2B, 0x34, 0x7F, 0xC2, 0x69, 0x55, 0xAE,
+  0x8B, 0x86, 0x3E, 0x4D, 0x45, 0xC8, 0x32, 0x90, 0x9F, 0xC9, 0x7B, 0x28, 0x34, 0x0C, 0x83, 0x4A,
+  0x38, 0x2C, 0xF3, 0x0A, 0xB1, 0xB3, 0x1C, 0x1D, 0x9C, 0xF2, 0x24, 0x01, 0x49, 0xAB, 0x2A, 0x61,
+  0x2C, 0xA3, 0xE4, 0x96, 0x89, 0xC2, 0xB5, 0x3D, 0x81, 0x0E, 0x82, 0xFA, 0xC5, 0xC5, 0x82, 0x19,
+  0x33, 0xA2, 0x2E, 0xCA, 0xBC, 0x04, 0xED, 0xB8, 0xC4, 0x16, 0x9D, 0x49, 0xF9, 0xF0, 0x1D, 0x2A,
+  0x5C, 0x8F, 0x94, 0xDC, 0x7C, 0xC1, 0x6D, 0xA7, 0x95, 0x15, 0x59, 0x64, 0x63, 0xC0, 0x1E, 0x86,
+  0xDE, 0x88, 0x76, 0x3B, 0xDD, 0x13, 0x6C, 0xB2, 0x7B, 0xD7, 0x7C, 0xFD, 0x9A, 0x12, 0x0D, 0xDF,
+  0x0A, 0xAE, 0x01, 0x3D, 0x0B, 0x3C, 0x5E, 0xC5, 0x42, 0xCD, 0xC2, 0x47, 0xC5, 0xCD, 0x16, 0xFE,
+  0x47, 0x24, 0x72, 0xBA, 0xD3, 0x40, 0x58, 0xA1, 0x87, 0xDD, 0x83, 0xB0, 0x7F, 0x51, 0x85, 0xDE,
+  0xC2, 0x7E, 0xCB, 0x66, 0x7B, 0x91, 0x8F, 0xC3, 0x83, 0x90, 0x3D, 0xEF, 0x75, 0x68, 0x7B, 0xF3,
+  0x1E, 0xAD, 0xED, 0xC4, 0xEE, 0x2C, 0x39, 0x39, 0x3E, 0x8C, 0x11, 0x2E, 0x0B, 0xBB, 0x0D, 0xEE,
+  0x85, 0x7B, 0xE1, 0x7B, 0x87, 0x11, 0x7E, 0x85, 0x99, 0x45, 0x26, 0xDB, 0xF8, 0x5E, 0xFA, 0x6C,
+  0x7C, 0xFF, 0xEB, 0x8B, 0x49, 0xF4, 0x11, 0x03, 0x5E, 0x03, 0x79, 0xF8, 0x2F, 0x11, 0x74, 0xEA,
+  0x0F, 0x68, 0x35, 0x32, 0x0C, 0xD6, 0x07, 0x39, 0x70, 0xA1, 0x50, 0x0B, 0x88, 0xB1, 0x76, 0xE1,
+  0xB2, 0x37, 0x24, 0x6A, 0x2A, 0x3B, 0x83, 0xE2, 0x43, 0x81, 0x0E, 0x2B, 0xC3, 0xED, 0xC3, 0xF7,
+  0x67, 0xC4, 0xC4, 0x9B, 0x12, 0x5D, 0x82, 0x31, 0x74, 0xC9, 0xD5, 0xBF, 0xF0, 0xBE, 0x55, 0x68,
+  0xD2, 0xE8, 0xB4, 0xBA, 0xBD, 0x5E, 0x73, 0x83, 0xB2, 0xB2, 0x7D, 0x53, 0x9B, 0xB3, 0x77, 0xE7,
+  0x7B, 0xBD, 0x95, 0xA5, 0xB0, 0xDB, 0xA3, 0x6B, 0xFA, 0x2A, 0x62, 0xCE, 0xF2, 0x5C, 0xF0, 0x6F,
+  0x05, 0xE8, 0x83, 0xA8, 0xC2, 0x04, 0xA6, 0x84, 0xD8, 0x4B, 0x55, 0x4D, 0x65, 0x27, 0x55, 0xD7,
+  0x98, 0xBE, 0x80, 0x24, 0x0F, 0xDF, 0x53, 0xEE, 0xAE, 0x88, 0xCF, 0xA0, 0xEB, 0xAA, 0xB4, 0x80,
+  0xA9, 0xDC, 0x41, 0xAD, 0x18, 0xF3, 0xB8, 0x0D, 0xCC, 0xBD, 0x6E, 0xE5, 0xBB, 0x28, 0x5B, 0xCD,
+  0xBB, 0x29, 0x27, 0x3A, 0x35, 0x01, 0x72, 0x82, 0x77, 0x5E, 0x8A, 0xB3, 0x56, 0x16, 0x7C, 0x32,
+  0x2E, 0x13, 0xF1, 0x87, 0x4F, 0xE7, 0xBF, 0x3E, 0xA6, 0xEC, 0x42, 0x6A, 0x98, 0x70, 0x83, 0x27,
+  0xED, 0x30, 0xD2, 0x32, 0x95, 0xEC, 0x4F, 0xB8, 0x2B, 0x85, 0x9D, 0x84, 0x7D, 0xC4, 0xD1, 0x67,
+  0xB0, 0xF4, 0xD6, 0x5F, 0x12, 0xDC, 0x6C, 0xBA, 0x4E, 0x79, 0x08, 0xE5, 0x2F, 0x7F, 0x1B, 0xCC,
+  0x54, 0xBA, 0x37, 0x95, 0xB2, 0xCA, 0xCB, 0x5A, 0xBC, 0x3C, 0x36, 0x34, 0xBA, 0xB2, 0x78, 0x21,
+  0xC0, 0x43, 0x32, 0x0C, 0xFC, 0xD0, 0xB6, 0x4A, 0x97, 0x46, 0xE7, 0xB3, 0x58, 0x6C, 0xAA, 0x04,
+  0xDE, 0xD0, 0xFF, 0x79, 0xE2, 0x62, 0xBC, 0xAC, 0xEC, 0x8F, 0xCD, 0xB5, 0xC6, 0x4E, 0xFA, 0xCE,
+  0xDD, 0x70, 0xA2, 0xEE, 0xE4, 0x33, 0x38, 0x5C, 0xCD, 0x5D, 0x31, 0x78, 0x86, 0xD7, 0x94, 0x74,
+  0x93, 0xC2, 0x78, 0xA9, 0x74, 0xE3, 0x06, 0x6F, 0x1F, 0x13, 0x58, 0x96, 0x7F, 0x1A, 0xFD, 0xA6,
+  0xE4, 0x8F, 0xF8, 0xB3, 0xBA, 0x40, 0x85, 0x4F, 0x05, 0xDF, 0xC3, 0xDE, 0x53, 0xAB, 0xE5, 0xDA,
+  0xAD, 0x83, 0xAB, 0xE6, 0x53, 0x8A, 0xE5, 0x1A, 0xFE, 0xA0, 0xA2, 0xF9, 0x94, 0x5A, 0xB9, 0x86,
+  0x3E, 0xA0, 0x66, 0x3E, 0xA9, 0x54, 0xAE, 0x91, 0x0F, 0x29, 0x99, 0x4F, 0xAB, 0x94, 0x35, 0x42,
+  0x0E, 0xAA, 0x98, 0x4F, 0x2C, 0x94, 0x6B, 0xF8, 0xC3, 0x0A, 0xE6, 0xEE, 0x3A, 0x59, 0xA5, 0x4A,
+  0x6E, 0x7F, 0x48, 0xCC, 0xB5, 0x7B, 0x88, 0x6F, 0xE4, 0xC6, 0x5A, 0x6A, 0xFC, 0xED, 0xE2, 0x0F,
+  0xF2, 0xE5, 0xE2, 0xEC, 0xF3, 0x9E, 0x32, 0x42, 0x6A, 0xF1, 0xF6, 0xE3, 0xF0, 0xAE, 0x1D, 0x66,
+  0x03, 0xE5, 0xCD, 0xBF, 0xC5, 0xCA, 0x3F, 0x57, 0x01, 0xD9, 0x72, 0x68, 0xF9, 0xE0, 0xA1, 0x64,
+  0xAA, 0x21, 0x1D, 0xD5, 0x2E, 0xF4, 0x18, 0xA7, 0x23, 0x0D, 0xAE, 0x16, 0xCC, 0x0C, 0x3E, 0xCE,
+  0x68, 0xF4, 0x19, 0xB0, 0xA2, 0xE0, 0x13, 0xA8, 0xCC, 0xC9, 0xAC, 0xC6, 0xE9, 0x12, 0xCB, 0xBF,
+  0xC1, 0x68, 0xF4, 0x8E, 0xEB, 0xEC, 0x8E, 0xE1, 0x25, 0xE1, 0x0F, 0x18, 0x13, 0xDC, 0x29, 0x9E,
+  0x31, 0x41, 0x7E, 0x8E, 0x55, 0x3E, 0x1B, 0x10, 0x8C, 0x87, 0xDE, 0x70, 0xAC, 0xA3, 0x4B, 0xAD,
+  0xFE, 0x0D, 0xF8, 0xDA, 0x60, 0xB8, 0x9A, 0xC7, 0x9F, 0x34, 0xD0, 0x3F, 0xEF, 0xCE, 0xD4, 0xDA,
+  0xDC, 0xF4, 0x83, 0x60, 0xC2, 0xED, 0xB4, 0x18, 0xB7, 0x63, 0x95, 0x05, 0x1B, 0x9F, 0x3B, 0x56,
+  0x37, 0xF6, 0x8D, 0x97, 0x3C, 0x6E, 0x1C, 0xBE, 0xD4, 0xDC, 0x57, 0x99, 0x9B, 0x31, 0x02, 0x7E,
+  0x75, 0x57, 0x1B, 0x81, 0xFB, 0xA8, 0x54, 0x0E, 0xD2, 0x79, 0xB8, 0x81, 0xE1, 0x16, 0xD3, 0x74,
+  0x3E, 0xAD, 0xAC, 0x06, 0x6C, 0x8C, 0x0F, 0x90, 0x6D, 0xEC, 0xD3, 0xD3, 0x53, 0x1A, 0x3D, 0xFC,
+  0x49, 0x72, 0xAD, 0x72, 0x65, 0x48, 0x40, 0x3E, 0x70, 0x7C, 0x1C, 0xC4, 0x50, 0x23, 0x23, 0xF0,
+  0xCF, 0x8D, 0xA0, 0xFC, 0x6C, 0xF4, 0x3F, 0x0D, 0xD8, 0xC9, 0x14, 0x46, 0x12, 0x00, 0x00,
+};
+static const size_t MAIN_page_gz_len = sizeof(MAIN_page_gz);
+
+// ABOUT_page : 1116 octets -> 706 octets gzip (63 %)
+static const uint8_t ABOUT_page_gz[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x54, 0xDB, 0x6E, 0xD3, 0x40,
+  0x10, 0x7D, 0xCF, 0x57, 0x0C, 0xAA, 0x84, 0x13, 0xA9, 0x89, 0x1B, 0xF7, 0x02, 0x72, 0x36, 0x96,
+  0x4A, 0x7A, 0x51, 0xA5, 0x96, 0x46, 0x6D, 0x40, 0xF0, 0x84, 0xD6, 0xF6, 0xD8, 0x5E, 0xBA, 0xDE,
+  0xB5, 0xC6, 0xEB, 0x92, 0x50, 0x55, 0xE2, 0x77, 0xF2, 0xCE, 0x1F, 0xE4, 0xC7, 0xD8, 0xB5, 0x69,
+  0x49, 0x41, 0xBC, 0xD8, 0x9E, 0xDD, 0x33, 0xE3, 0x33, 0x73, 0xCE, 0x2E, 0x7B, 0x75, 0x72, 0x3D,
+  0x5B, 0x7C, 0x9E, 0x9F, 0x42, 0x61, 0x4A, 0x19, 0x31, 0xF7, 0x04, 0xC9, 0x55, 0x3E, 0xF5, 0x32,
+  0xF2, 0x6C, 0x8C, 0x3C, 0x8D, 0x58, 0x89, 0x86, 0x43, 0x52, 0x70, 0xAA, 0xD1, 0x4C, 0xBD, 0x0F,
+  0x8B, 0xB3, 0xE1, 0x5B, 0xBB, 0x67, 0x84, 0x91, 0x18, 0x6D, 0x7E, 0x40, 0x45, 0xBA, 0xD2, 0x35,
+  0xF3, 0xBB, 0x05, 0x56, 0x9B, 0x95, 0x7D, 0xC5, 0x3A, 0x5D, 0x3D, 0x64, 0x5A, 0x99, 0x61, 0xC6,
+  0x4B, 0x21, 0x57, 0xE1, 0x31, 0x09, 0x2E, 0x27, 0x31, 0x4F, 0xEE, 0x72, 0xD2, 0x8D, 0x4A, 0xC3,
+  0x9D, 0xF1, 0x78, 0x3C, 0x49, 0xB4, 0xD4, 0x14, 0xEE, 0x20, 0xE2, 0xA4, 0xE2, 0x69, 0x2A, 0x54,
+  0x1E, 0x8E, 0x09, 0xCB, 0x89, 0x14, 0x0A, 0x87, 0x05, 0x8A, 0xBC, 0x30, 0xE1, 0x78, 0x74, 0xF0,
+  0xC8, 0x1F, 0x7E, 0x23, 0x0F, 0x12, 0x9E, 0x1D, 0xEE, 0x3D, 0x26, 0x3A, 0xC5, 0x87, 0xED, 0x62,
+  0x41, 0x10, 0x3C, 0x57, 0x08, 0xAA, 0x25, 0x1C, 0x54, 0xCB, 0x49, 0xAC, 0x29, 0x45, 0x1A, 0x12,
+  0x4F, 0x45, 0x53, 0x87, 0xFB, 0xD5, 0xF2, 0x91, 0xF9, 0x1D, 0x3B, 0xE6, 0x77, 0x9D, 0x39, 0x96,
+  0xB6, 0xCB, 0xF1, 0x76, 0x1B, 0x36, 0x62, 0x95, 0x6B, 0x83, 0xB4, 0xCA, 0xA3, 0x39, 0xE9, 0xAF,
+  0x68, 0x20, 0x74, 0x99, 0xED, 0x02, 0x9C, 0xDE, 0xCE, 0xF7, 0x03, 0x98, 0x8F, 0xF7, 0xE0, 0xE6,
+  0xFC, 0x1D, 0xEC, 0x07, 0xCB, 0xF1, 0x11, 0x9C, 0x88, 0x5C, 0x18, 0x2E, 0x61, 0x26, 0x75, 0x72,
+  0x07, 0xFD, 0xB9, 0xE4, 0x26, 0xD3, 0x54, 0x5E, 0x5C, 0x0F, 0x98, 0x5F, 0x6D, 0x97, 0x3B, 0x6E,
+  0x0C, 0x36, 0xB4, 0x5D, 0x6E, 0x26, 0x37, 0xEB, 0x12, 0x95, 0x81, 0x5B, 0x2E, 0xA4, 0x1D, 0xBD,
+  0x81, 0x3E, 0xE3, 0x50, 0x10, 0x66, 0x53, 0xAF, 0x30, 0xA6, 0xAA, 0x43, 0xDF, 0xB7, 0xC5, 0x8B,
+  0x26, 0x1E, 0x25, 0xBA, 0xF4, 0x51, 0x62, 0xE2, 0x32, 0x6D, 0x57, 0x84, 0x1E, 0x18, 0x4E, 0xB9,
+  0x13, 0xE5, 0x4B, 0x6C, 0x53, 0xEF, 0x3C, 0x20, 0x94, 0x53, 0x4F, 0x69, 0x5D, 0xA1, 0x42, 0x2B,
+  0xE0, 0x0B, 0x34, 0xF3, 0x79, 0xD4, 0xF1, 0x29, 0x82, 0x68, 0x46, 0x9B, 0x75, 0x2A, 0x8C, 0xEB,
+  0x37, 0x88, 0x58, 0x63, 0xB5, 0x97, 0x22, 0x9A, 0x73, 0xA5, 0x90, 0x37, 0x50, 0x09, 0xA9, 0xCD,
+  0x66, 0x0D, 0xF7, 0x82, 0x03, 0xC3, 0x32, 0x9A, 0x2F, 0xAF, 0xB8, 0x21, 0xB1, 0x64, 0xBE, 0x0D,
+  0x98, 0x6F, 0x91, 0x0E, 0x7D, 0xB3, 0x98, 0x3D, 0x23, 0xEC, 0xB7, 0x14, 0x71, 0xBB, 0x0F, 0xFD,
+  0xE3, 0x94, 0x67, 0xD4, 0x08, 0x33, 0xF8, 0x03, 0x45, 0x95, 0x36, 0x60, 0x70, 0x69, 0xF0, 0x39,
+  0xE5, 0x09, 0x05, 0xE7, 0x67, 0x9F, 0xB6, 0x0A, 0xFB, 0x8E, 0x8B, 0xE5, 0x74, 0x29, 0x12, 0x54,
+  0x09, 0x76, 0xFC, 0xAA, 0x68, 0x86, 0x4E, 0x20, 0x27, 0x05, 0xD6, 0x06, 0x52, 0x61, 0xC7, 0x27,
+  0xE2, 0xC6, 0x72, 0xAC, 0x75, 0x53, 0x83, 0xEC, 0xC0, 0x70, 0x75, 0xB1, 0x18, 0xC1, 0x47, 0x2D,
+  0x08, 0x24, 0x42, 0x26, 0x92, 0x42, 0x20, 0x01, 0x73, 0x66, 0x89, 0x2E, 0x2F, 0x66, 0xA7, 0xEF,
+  0x6F, 0x4F, 0x99, 0xDF, 0x46, 0x90, 0x72, 0x55, 0x3B, 0x50, 0xBA, 0x59, 0x57, 0x9B, 0x9F, 0x66,
+  0xD4, 0xE9, 0x44, 0x08, 0xAD, 0x41, 0xA6, 0xDE, 0xFF, 0xBC, 0x35, 0x7A, 0xE3, 0xEC, 0xF9, 0xD2,
+  0x59, 0x47, 0xD6, 0x6B, 0xFA, 0x1E, 0x29, 0x93, 0xFA, 0x5B, 0xC8, 0x1B, 0xA3, 0x27, 0xAD, 0xF1,
+  0x6B, 0xF1, 0x1D, 0x3B, 0xBC, 0x17, 0x59, 0x62, 0xD0, 0x76, 0x54, 0x63, 0xAF, 0x37, 0xD3, 0xD5,
+  0x8A, 0x9C, 0xB5, 0xA1, 0x9F, 0x0C, 0x20, 0xD8, 0x0B, 0x0E, 0xFF, 0x75, 0x41, 0xAF, 0x37, 0x47,
+  0x2A, 0x45, 0x5D, 0x0B, 0xAD, 0x40, 0xD4, 0x50, 0x20, 0x61, 0xBC, 0x82, 0x9C, 0xEC, 0x1E, 0xA6,
+  0xBB, 0x90, 0x11, 0x22, 0xE8, 0xAC, 0x3D, 0x96, 0x39, 0xEE, 0x82, 0xD1, 0xC0, 0xD5, 0x0A, 0x2A,
+  0xA4, 0xDA, 0x26, 0xE8, 0xD8, 0x70, 0xA1, 0x2C, 0x5F, 0xB0, 0x07, 0xD7, 0xFE, 0xAD, 0x37, 0x1A,
+  0x8D, 0xA0, 0x6F, 0x29, 0xB6, 0xE5, 0x78, 0x6C, 0xC5, 0xCF, 0x37, 0x6B, 0x97, 0xD6, 0x4A, 0x62,
+  0x8D, 0x55, 0x49, 0x3B, 0xDA, 0xBF, 0x86, 0x32, 0x00, 0x9B, 0xD6, 0xB3, 0x93, 0x21, 0x6C, 0x3D,
+  0xFC, 0x64, 0x4B, 0xDF, 0x8B, 0x5E, 0x4B, 0x4E, 0x34, 0x81, 0x1B, 0x34, 0xBA, 0x21, 0x67, 0xAC,
+  0x76, 0x7E, 0x7E, 0x77, 0x9E, 0xFC, 0xF6, 0x32, 0xF9, 0x05, 0x9B, 0x92, 0xE7, 0x7C, 0x5C, 0x04,
+  0x00, 0x00,
+};
+static const size_t ABOUT_page_gz_len = sizeof(ABOUT_page_gz);
+
+#endif // PAGEINDEXGZ_H
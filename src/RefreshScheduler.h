@@ -0,0 +1,186 @@
+/**
+ * Ordonnanceur adaptatif du rafraîchissement des panneaux P10
+ *
+ * Remplace la période fixe du timer (timerAlarmWrite) et l'échelle de
+ * display_draw_time selon MATRIX_PANELS_X. L'ISR mesure sa durée à chaque
+ * appel ; toutes les REFRESH_WINDOW_MS la tâche d'affichage ajuste :
+ *  - display_draw_time (luminosité) pour tenir le budget CPU de l'ISR,
+ *  - la période du timer pour viser la fréquence cible du profil, allongée
+ *    seulement si le draw time minimal ne suffit pas.
+ * Si une tâche (rendu, web) signale qu'elle est affamée, le budget est réduit
+ * d'un quart par niveau de repli (la fréquence baisse avant la luminosité),
+ * puis rétabli après plusieurs fenêtres calmes.
+ *
+ * Logique pure (sans Arduino) : l'appelant fournit millis(), protège la prise
+ * de mesures par sa section critique et applique les valeurs au timer. L'ISR
+ * enregistre sa durée dans l'unité de son compteur (cycles CPU, ISR_CYCLES
+ * d'IsrMetrics.h) ; la conversion en µs se fait côté tâche, une fois par
+ * fenêtre.
+ *
+ * Vérifié en natif : examples/refresh_scheduler_test.cpp.
+ */
+#ifndef REFRESHSCHEDULER_H
+#define REFRESHSCHEDULER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define REFRESH_WINDOW_MS       500   // fenêtre de mesure
+#define REFRESH_MIN_PERIOD_US   1000  // période minimale du timer
+#define REFRESH_MAX_PERIOD_US   8000  // au-delà le scintillement devient visible
+#define REFRESH_MIN_DRAW_TIME   10    // draw time minimal (luminosité plancher)
+#define REFRESH_MAX_BACKOFF     3     // budget minimal = 1/4 du budget du profil
+#define REFRESH_CALM_WINDOWS    4     // fenêtres sans famine avant de relâcher
+
+// Cible par nombre de panneaux
+struct RefreshProfile {
+  uint16_t targetHz;     // fréquence d'appel visée de l'ISR
+  uint8_t cpuBudgetPct;  // part maximale du CPU prise par l'ISR
+  uint8_t maxDrawTime;   // display_draw_time maximal (ancienne échelle 30/25/20/15)
+};
+
+inline RefreshProfile refreshProfileFor(uint8_t panels) {
+  if (panels > 6) return { 250, 25, 15 };
+  if (panels > 4) return { 350, 30, 20 };
+  if (panels > 2) return { 500, 35, 25 };
+  return { 650, 40, 30 };
+}
+
+struct RefreshScheduler {
+  RefreshProfile profile;
+  uint32_t periodUs;      // période appliquée au timer
+  uint8_t drawTime;       // display_draw_time appliqué
+  uint8_t backoff;        // niveau de repli (0 = budget complet)
+  uint8_t calmWindows;
+  uint32_t ticksPerUs;    // unité des mesures de l'ISR (MHz CPU, 1 = µs)
+  // Mesures écrites par l'ISR, en ticks
+  volatile uint32_t isrCount;
+  volatile uint32_t isrTimeSum;
+  volatile uint32_t isrTimeMax;
+  // Signal de famine écrit par les tâches
+  volatile bool starved;
+  // Résultats de la dernière fenêtre
+  uint32_t windowStartMs;
+  float achievedHz;
+  uint32_t isrAvgUs;
+  uint32_t isrMaxUs;
+};
+
+// Mesures d'une fenêtre, relevées sous la section critique de l'appelant
+struct RefreshWindow {
+  uint32_t count;
+  uint32_t timeSum;
+  uint32_t timeMax;
+};
+
+// startPeriodUs : période de démarrage (ancienne valeur fixe du programme)
+// ticksPerUs : ticks du compteur de l'ISR par µs (ESP.getCpuFreqMHz() pour ISR_CYCLES)
+inline void refreshSchedulerInit(RefreshScheduler &s, uint8_t panels, uint32_t startPeriodUs, uint32_t nowMs,
+                                 uint32_t ticksPerUs = 1) {
+  s.profile = refreshProfileFor(panels);
+  s.periodUs = startPeriodUs;
+  s.drawTime = s.profile.maxDrawTime;
+  s.backoff = 0;
+  s.calmWindows = 0;
+  s.ticksPerUs = ticksPerUs ? ticksPerUs : 1;
+  s.isrCount = 0;
+  s.isrTimeSum = 0;
+  s.isrTimeMax = 0;
+  s.starved = false;
+  s.windowStartMs = nowMs;
+  s.achievedHz = 0;
+  s.isrAvgUs = 0;
+  s.isrMaxUs = 0;
+}
+
+// Appelé par l'ISR après display.display() : toujours inliné (code en IRAM)
+__attribute__((always_inline)) inline void refreshSchedulerRecordIsr(RefreshScheduler &s, uint32_t isrTicks) {
+  s.isrCount++;
+  s.isrTimeSum += isrTicks;
+  if (isrTicks > s.isrTimeMax) s.isrTimeMax = isrTicks;
+}
+
+// Appelé par une tâche périodique avec son intervalle nominal et mesuré
+inline void refreshSchedulerTaskLoop(RefreshScheduler &s, uint32_t expectedMs, uint32_t actualMs) {
+  if (actualMs > 2 * expectedMs + 10) s.starved = true;
+}
+
+inline bool refreshSchedulerDue(const RefreshScheduler &s, uint32_t nowMs) {
+  return nowMs - s.windowStartMs >= REFRESH_WINDOW_MS;
+}
+
+// Relève et remet à zéro les compteurs de l'ISR (sous section critique)
+inline RefreshWindow refreshSchedulerSnapshot(RefreshScheduler &s) {
+  RefreshWindow w = { s.isrCount, s.isrTimeSum, s.isrTimeMax };
+  s.isrCount = 0;
+  s.isrTimeSum = 0;
+  s.isrTimeMax = 0;
+  return w;
+}
+
+// Calcule période et draw time pour la fenêtre écoulée.
+// Retourne true si periodUs ou drawTime ont changé.
+inline bool refreshSchedulerApply(RefreshScheduler &s, const RefreshWindow &w, uint32_t nowMs) {
+  uint32_t elapsed = nowMs - s.windowStartMs;
+  s.windowStartMs = nowMs;
+  if (elapsed == 0 || w.count == 0) return false;
+  s.achievedHz = w.count * 1000.0f / elapsed;
+  s.isrAvgUs = w.timeSum / w.count / s.ticksPerUs;
+  s.isrMaxUs = w.timeMax / s.ticksPerUs;
+
+  // Repli multiplicatif en cas de famine, retour progressif ensuite
+  if (s.starved) {
+    s.starved = false;
+    s.calmWindows = 0;
+    if (s.backoff < REFRESH_MAX_BACKOFF) s.backoff++;
+  } else if (s.backoff > 0 && ++s.calmWindows >= REFRESH_CALM_WINDOWS) {
+    s.calmWindows = 0;
+    s.backoff--;
+  }
+
+  uint32_t oldPeriod = s.periodUs;
+  uint8_t oldDraw = s.drawTime;
+  uint32_t budgetPct = (uint32_t)s.profile.cpuBudgetPct * (4 - s.backoff) / 4;
+  uint32_t targetPeriod = 1000000UL / s.profile.targetHz;
+  uint32_t budgetUs = targetPeriod * budgetPct / 100;   // durée d'ISR tenable à la cible
+
+  // Période à laquelle l'ISR consomme exactement le budget
+  uint32_t needed = s.isrAvgUs * 100 / budgetPct;
+  if (needed > targetPeriod) {
+    // Cible intenable. En repli (famine) on baisse d'abord la fréquence, ce
+    // qui se voit moins que la luminosité ; sinon d'abord le draw time.
+    bool lowerRate = s.backoff > 0 || s.drawTime <= REFRESH_MIN_DRAW_TIME;
+    if (lowerRate && needed <= REFRESH_MAX_PERIOD_US) {
+      s.periodUs = needed;
+    } else if (s.drawTime > REFRESH_MIN_DRAW_TIME) {
+      uint32_t step = (uint32_t)s.drawTime * (s.isrAvgUs - budgetUs) / s.isrAvgUs;
+      if (step < 1) step = 1;
+      s.drawTime = (s.drawTime - step < REFRESH_MIN_DRAW_TIME) ? REFRESH_MIN_DRAW_TIME : s.drawTime - step;
+    } else {
+      s.periodUs = needed;
+    }
+  } else {
+    // Cible tenable : y revenir, puis remonter la luminosité s'il reste de la marge
+    s.periodUs = targetPeriod;
+    if (s.isrAvgUs < budgetUs * 85 / 100 && s.drawTime < s.profile.maxDrawTime) s.drawTime++;
+  }
+
+  // L'ISR doit toujours se terminer avant l'appel suivant
+  if (s.periodUs < s.isrMaxUs * 5 / 4) s.periodUs = s.isrMaxUs * 5 / 4;
+  if (s.periodUs < REFRESH_MIN_PERIOD_US) s.periodUs = REFRESH_MIN_PERIOD_US;
+  if (s.periodUs > REFRESH_MAX_PERIOD_US) s.periodUs = REFRESH_MAX_PERIOD_US;
+
+  return s.periodUs != oldPeriod || s.drawTime != oldDraw;
+}
+
+// Valeurs choisies et mesurées, en JSON (endpoint /refresh)
+inline int refreshSchedulerToJson(const RefreshScheduler &s, char *buf, size_t size) {
+  return snprintf(buf, size,
+    "{\"period_us\":%u,\"draw_time\":%u,\"target_hz\":%u,\"achieved_hz\":%.1f,"
+    "\"isr_avg_us\":%u,\"isr_max_us\":%u,\"budget_pct\":%u,\"backoff\":%u}",
+    (unsigned)s.periodUs, (unsigned)s.drawTime, (unsigned)s.profile.targetHz, s.achievedHz,
+    (unsigned)s.isrAvgUs, (unsigned)s.isrMaxUs,
+    (unsigned)(s.profile.cpuBudgetPct * (4 - s.backoff) / 4), (unsigned)s.backoff);
+}
+
+#endif // REFRESHSCHEDULER_H
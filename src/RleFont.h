@@ -0,0 +1,88 @@
+/**
+ * Polices RLE : glyphes codés en plages, tracés par segments horizontaux
+ *
+ * Format produit par tools/font_rle.py (ou bdf2adafruit_simple.py --rle) :
+ * chaque glyphe est lu ligne par ligne dans sa boîte comme une suite de
+ * plages alternées éteint / allumé (la première est éteinte), codées sur
+ * 3 bits MSB en premier : 0..6 = longueur puis changement de couleur,
+ * 7 = +7 pixels et la plage continue. La dernière plage éteinte est omise ;
+ * chaque glyphe commence sur un octet et se termine où commence le suivant.
+ *
+ * rleDrawChar() trace une plage allumée par drawFastHLine (taille 1) ou
+ * fillRect (taille > 1), au lieu du test bit à bit de drawChar(). Le résultat
+ * est identique pixel pour pixel à drawChar() avec le GFXfont d'origine
+ * (vérifié par examples/rle_font_bench.cpp).
+ */
+#ifndef RLEFONT_H
+#define RLEFONT_H
+
+#include <stdint.h>
+
+#define RLE_FONT_BITS     3
+#define RLE_FONT_CONTINUE ((1 << RLE_FONT_BITS) - 1)
+
+struct RleFont {
+  const uint8_t *runs;     // plages de tous les glyphes
+  const GFXglyph *glyph;   // métriques GFX, bitmapOffset = offset dans runs
+  uint16_t runsSize;       // octets de runs (fin du dernier glyphe)
+  uint8_t first, last;
+  uint8_t yAdvance;
+};
+
+// Trace le glyphe c au curseur (x, y = ligne de base). Retourne l'avance en pixels.
+inline int16_t rleDrawChar(Adafruit_GFX &gfx, int16_t x, int16_t y, unsigned char c,
+                           const RleFont &font, uint8_t size, uint16_t color) {
+  if (c < font.first || c > font.last) return 0;
+  uint16_t index = c - font.first;
+  const GFXglyph &g = font.glyph[index];
+  const uint16_t w = g.width;
+  const uint32_t total = (uint32_t)w * g.height;
+  if (total == 0) return g.xAdvance * size;
+
+  const uint8_t *p = font.runs + g.bitmapOffset;
+  const uint32_t endBit = (uint32_t)((index < font.last - font.first) ? font.glyph[index + 1].bitmapOffset
+                                                                       : font.runsSize) * 8
+                          - (uint32_t)g.bitmapOffset * 8;
+  const int16_t ox = x + g.xOffset * size;
+  const int16_t oy = y + g.yOffset * size;
+
+  uint32_t pos = 0, bit = 0;
+  uint16_t col = 0, row = 0;   // position de pos dans la boîte
+  bool on = false;
+  while (pos < total && bit + RLE_FONT_BITS <= endBit) {
+    uint8_t code = 0;
+    for (uint8_t k = 0; k < RLE_FONT_BITS; k++, bit++) {
+      code = (code << 1) | ((p[bit >> 3] >> (7 - (bit & 7))) & 1);
+    }
+    uint32_t run = code;
+    if (run > total - pos) run = total - pos;
+    pos += run;
+    // Plage allumée : un segment par ligne traversée
+    while (run > 0) {
+      uint16_t len = (run < (uint32_t)(w - col)) ? (uint16_t)run : (uint16_t)(w - col);
+      if (on) {
+        if (size == 1) gfx.drawFastHLine(ox + col, oy + row, len, color);
+        else gfx.fillRect(ox + col * size, oy + row * size, len * size, size, color);
+      }
+      col += len;
+      run -= len;
+      if (col == w) { col = 0; row++; }
+    }
+    if (code != RLE_FONT_CONTINUE) on = !on;
+  }
+  return g.xAdvance * size;
+}
+
+// Trace une chaîne (octets Latin-1, '\n' = ligne suivante). Retourne x final.
+inline int16_t rleDrawText(Adafruit_GFX &gfx, int16_t x, int16_t y, const char *text,
+                           const RleFont &font, uint8_t size, uint16_t color) {
+  const int16_t x0 = x;
+  for (const uint8_t *s = (const uint8_t *)text; *s; s++) {
+    if (*s == '\n') { x = x0; y += font.yAdvance * size; continue; }
+    if (*s == '\r') continue;
+    x += rleDrawChar(gfx, x, y, *s, font, size, color);
+  }
+  return x;
+}
+
+#endif // RLEFONT_H
@@ -0,0 +1,122 @@
+/**
+ * Cache LRU des layouts de texte : run de glyphes, largeur et boîte d'encre
+ *
+ * Un petit nombre de textes revient en boucle : date, texte personnalisé et
+ * countdown du défilement de l'horloge, titre de fin mesuré pour chaque
+ * taille essayée par l'ajustement plein écran. textLayoutGet() retrouve le
+ * layout par (hash 32 bits du texte, longueur, police, taille) au lieu de
+ * redécoder et remesurer ; TEXT_LAYOUT_CACHE_SIZE entrées (8 par défaut),
+ * la moins récemment utilisée est remplacée.
+ *
+ * Une entrée manquante dont le même texte est déjà en cache pour une autre
+ * taille de même plage de caractères (famille, FontFamily.h) reprend ce run
+ * et le re-mesure (glyphRunMeasure) sans nouveau décodage UTF-8.
+ *
+ * Police 5x7 intégrée (font == nullptr) : pas de run (police sans table de
+ * glyphes accessible), seule la boîte est gardée (fontTextBounds, cellule 6x8).
+ *
+ * La clé est un hash FNV-1a : deux textes de même longueur et de même hash
+ * partageraient un layout (probabilité ~ 2^-32 par paire). Le hash coûte un
+ * passage sur le texte, sans copie.
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus FontMetrics.h et GlyphRun.h.
+ */
+#ifndef TEXTLAYOUTCACHE_H
+#define TEXTLAYOUTCACHE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef TEXT_LAYOUT_CACHE_SIZE
+  #define TEXT_LAYOUT_CACHE_SIZE 8
+#endif
+
+struct TextLayout {
+  uint32_t hash;          // FNV-1a du texte (octets)
+  uint16_t length;        // longueur du texte en octets (clé)
+  const GFXfont *font;    // nullptr : police 5x7 intégrée
+  uint8_t size;           // taille GFX
+  uint32_t lastUse;       // horloge LRU, 0 = entrée libre
+  GlyphRun run;           // glyphes et boîte en taille 1 (police GFX uniquement)
+  int16_t x1, y1;         // boîte d'encre en taille size, curseur en (0, 0)
+  uint16_t w, h;
+};
+
+struct TextLayoutCache {
+  TextLayout entries[TEXT_LAYOUT_CACHE_SIZE];
+  uint32_t clock;
+  uint32_t hits, misses;
+};
+
+inline void textLayoutCacheClear(TextLayoutCache &cache) {
+  memset(&cache, 0, sizeof(cache));
+}
+
+// FNV-1a 32 bits ; length reçoit la longueur du texte
+inline uint32_t textLayoutHash(const char *text, uint16_t *length) {
+  uint32_t h = 2166136261u;
+  const uint8_t *p = (const uint8_t *)text;
+  for (; *p; p++) h = (h ^ *p) * 16777619u;
+  *length = (uint16_t)(p - (const uint8_t *)text);
+  return h;
+}
+
+// Layout de text (UTF-8) pour font / size, construit au premier appel.
+// La référence reste valide jusqu'au prochain appel sur le même cache.
+inline const TextLayout &textLayoutGet(TextLayoutCache &cache, const char *text,
+                                       const GFXfont *font, uint8_t size) {
+  if (size == 0) size = 1;
+  uint16_t length;
+  const uint32_t hash = textLayoutHash(text, &length);
+  TextLayout *victim = &cache.entries[0];
+  TextLayout *sibling = nullptr;
+  for (TextLayout &e : cache.entries) {
+    if (e.lastUse != 0 && e.hash == hash && e.length == length) {
+      if (e.font == font && e.size == size) {
+        e.lastUse = ++cache.clock;
+        cache.hits++;
+        return e;
+      }
+      if (font && e.font && e.font->first == font->first && e.font->last == font->last) sibling = &e;
+    }
+    if (e.lastUse < victim->lastUse) victim = &e;
+  }
+
+  cache.misses++;
+  TextLayout &l = *victim;
+  if (font == nullptr) {
+    l.run.length = 0;
+    l.w = fontTextBounds(nullptr, text, size, &l.x1);
+    l.y1 = 0;
+    l.h = l.w ? 8 * size : 0;
+  } else {
+    if (sibling) {
+      if (sibling != victim) l.run = sibling->run;
+      glyphRunMeasure(l.run, font);
+    } else {
+      glyphRunBuild(l.run, text, font);
+    }
+    // getTextBounds en taille n : boîte de la taille 1 multipliée par n
+    l.x1 = l.run.x1 * size;
+    l.y1 = l.run.y1 * size;
+    l.w = l.run.w * size;
+    l.h = l.run.h * size;
+  }
+  l.hash = hash;
+  l.length = length;
+  l.font = font;
+  l.size = size;
+  l.lastUse = ++cache.clock;
+  return l;
+}
+
+// Compteurs (endpoint /layout)
+inline int textLayoutCacheToJson(const TextLayoutCache &cache, char *buf, size_t size) {
+  uint8_t used = 0;
+  for (const TextLayout &e : cache.entries) used += e.lastUse != 0;
+  return snprintf(buf, size, "{\"hits\":%u,\"misses\":%u,\"entries\":%u,\"capacity\":%u}",
+                  (unsigned)cache.hits, (unsigned)cache.misses, used, (unsigned)TEXT_LAYOUT_CACHE_SIZE);
+}
+
+#endif // TEXTLAYOUTCACHE_H
@@ -0,0 +1,63 @@
+/**
+ * Envoi des pages web précompressées (gzip)
+ *
+ * Les pages sont compressées à la compilation par tools/web_gzip.py
+ * (<page>_gz[] / <page>_gz_len en PROGMEM) et envoyées telles quelles avec
+ * Content-Encoding: gzip : 3 à 4 fois moins d'octets sur le lien softAP,
+ * aucune décompression ni copie côté ESP32. Un client qui n'annonce pas gzip
+ * dans Accept-Encoding reçoit la page brute (fallback du gestionnaire).
+ *
+ * WebServer ne garde que les en-têtes demandés : webGzipBegin() doit être
+ * appelé avant server.begin().
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus WebServer.h, ou
+ * ESPAsyncWebServer.h après avoir défini WEB_ASYNC_SERVER (variante
+ * AsyncWebServerRequest, tous les en-têtes sont conservés).
+ */
+#ifndef WEBGZIP_H
+#define WEBGZIP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef WEB_ASYNC_SERVER
+
+inline bool webClientAcceptsGzip(AsyncWebServerRequest *request) {
+  const AsyncWebHeader *h = request->getHeader("Accept-Encoding");
+  return h && h->value().indexOf("gzip") >= 0;
+}
+
+// Envoie la page précompressée (lue en flash pendant l'envoi) si le client l'accepte
+inline bool webSendGzip(AsyncWebServerRequest *request, const char *contentType, const uint8_t *gz, size_t gzLen) {
+  if (!webClientAcceptsGzip(request)) return false;
+  AsyncWebServerResponse *response = request->beginResponse_P(200, contentType, gz, gzLen);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("Vary", "Accept-Encoding");
+  request->send(response);
+  return true;
+}
+
+#else
+
+// Demande à WebServer de conserver l'en-tête Accept-Encoding des requêtes
+inline void webGzipBegin(WebServer &server) {
+  static const char *headerKeys[] = { "Accept-Encoding" };
+  server.collectHeaders(headerKeys, 1);
+}
+
+inline bool webClientAcceptsGzip(WebServer &server) {
+  return server.header("Accept-Encoding").indexOf("gzip") >= 0;
+}
+
+// Envoie la page précompressée si le client l'accepte ; false sinon (page brute à envoyer)
+inline bool webSendGzip(WebServer &server, const char *contentType, const uint8_t *gz, size_t gzLen) {
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (!webClientAcceptsGzip(server)) return false;
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, contentType, (PGM_P)gz, gzLen);
+  return true;
+}
+
+#endif // WEB_ASYNC_SERVER
+
+#endif // WEBGZIP_H
@@ -0,0 +1,115 @@
+/**
+ * Envoi d'une page web à marqueurs sans copie en RAM
+ *
+ * Remplace le motif « String page = MAIN_page; page.replace(...) » : la page
+ * (PROGMEM, lue en place) est envoyée par morceaux avec sendContent_P(),
+ * coupée autour des marqueurs (__AUTHOR_NAME__ ...), chaque marqueur étant
+ * remplacé par sa valeur au passage. Aucune allocation pour le corps de la
+ * page : l'ancien chemin copiait toute la page dans le tas (36 Ko pour la
+ * page du compte à rebours) puis réallouait à chaque replace() plus long.
+ *
+ * La longueur finale est calculée par un premier passage (setContentLength),
+ * la réponse reste en Content-Length et non en chunked.
+ *
+ * Serveur asynchrone (WEB_ASYNC_SERVER défini avant l'inclusion, après
+ * ESPAsyncWebServer.h) : la réponse est remplie par morceaux à la demande de
+ * la pile TCP (webTemplateRead, position dans la page finale) ; fields doit
+ * rester valide jusqu'à la fin de l'envoi (tableau static).
+ *
+ * Le programme qui inclut ce fichier doit avoir inclus WebServer.h ou
+ * ESPAsyncWebServer.h.
+ */
+#ifndef WEBTEMPLATE_H
+#define WEBTEMPLATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef WEB_TEMPLATE_MAX_FIELDS
+  #define WEB_TEMPLATE_MAX_FIELDS 8
+#endif
+
+struct WebTemplateField {
+  const char *marker;   // texte remplacé dans la page
+  const char *value;    // texte envoyé à la place
+};
+
+// Parcourt page en appelant emit(morceau, longueur) pour le texte entre les
+// marqueurs et pour la valeur de chaque marqueur rencontré (le plus tôt
+// d'abord ; recherche reprise après le marqueur, comme String::replace)
+template <typename Emit>
+inline void webTemplateWalk(PGM_P page, const WebTemplateField *fields, size_t count, Emit emit) {
+  if (count > WEB_TEMPLATE_MAX_FIELDS) count = WEB_TEMPLATE_MAX_FIELDS;
+  const char *next[WEB_TEMPLATE_MAX_FIELDS];
+  for (size_t i = 0; i < count; i++) next[i] = fields[i].marker[0] ? strstr(page, fields[i].marker) : nullptr;
+  const char *p = page;
+  for (;;) {
+    size_t best = count;
+    for (size_t i = 0; i < count; i++) {
+      if (next[i] && (best == count || next[i] < next[best])) best = i;
+    }
+    if (best == count) break;
+    if (next[best] > p) emit(p, (size_t)(next[best] - p));
+    const size_t valueLength = strlen(fields[best].value);
+    if (valueLength) emit(fields[best].value, valueLength);
+    p = next[best] + strlen(fields[best].marker);
+    for (size_t i = 0; i < count; i++) {
+      if (next[i] && next[i] < p) next[i] = strstr(p, fields[i].marker);
+    }
+  }
+  const size_t tail = strlen(p);
+  if (tail) emit(p, tail);
+}
+
+// Longueur de la page après remplacement des marqueurs
+inline size_t webTemplateLength(PGM_P page, const WebTemplateField *fields, size_t count) {
+  size_t length = 0;
+  webTemplateWalk(page, fields, count, [&length](const char *, size_t n) { length += n; });
+  return length;
+}
+
+// Copie dans buf au plus maxLen octets de la page finale à partir de index ;
+// nombre d'octets copiés (0 : fin de page)
+inline size_t webTemplateRead(PGM_P page, const WebTemplateField *fields, size_t count,
+                              uint8_t *buf, size_t maxLen, size_t index) {
+  size_t pos = 0, copied = 0;
+  webTemplateWalk(page, fields, count, [&](const char *chunk, size_t n) {
+    const size_t end = pos + n;
+    if (end > index && copied < maxLen) {
+      const size_t from = index > pos ? index - pos : 0;
+      size_t take = n - from;
+      if (take > maxLen - copied) take = maxLen - copied;
+      memcpy(buf + copied, chunk + from, take);
+      copied += take;
+      index += take;
+    }
+    pos = end;
+  });
+  return copied;
+}
+
+#ifdef WEB_ASYNC_SERVER
+
+inline void webSendTemplate(AsyncWebServerRequest *request, int code, const char *contentType, PGM_P page,
+                            const WebTemplateField *fields, size_t count) {
+  AsyncWebServerResponse *response = request->beginResponse(contentType, webTemplateLength(page, fields, count),
+      [page, fields, count](uint8_t *buf, size_t maxLen, size_t index) -> size_t {
+        return webTemplateRead(page, fields, count, buf, maxLen, index);
+      });
+  response->setCode(code);
+  request->send(response);
+}
+
+#else
+
+inline void webSendTemplate(WebServer &server, int code, const char *contentType, PGM_P page,
+                            const WebTemplateField *fields, size_t count) {
+  server.setContentLength(webTemplateLength(page, fields, count));
+  server.send(code, contentType, "");
+  webTemplateWalk(page, fields, count, [&server](const char *chunk, size_t n) { server.sendContent_P(chunk, n); });
+}
+
+#endif // WEB_ASYNC_SERVER
+
+#endif // WEBTEMPLATE_H
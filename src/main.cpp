@@ -45,6 +45,15 @@ static inline bool isFastBoot(){
 #include <DNSServer.h>
 #include <nvs_flash.h>
 #include "PageIndex.h"
+#include "PageIndexGz.h"     // pages gzip (tools/web_gzip.py)
+#include "WebGzip.h"
+#include "RefreshScheduler.h"
+#include "IsrMetrics.h"
+#include "ColorGamma.h"
+#include "FontMetrics.h"
+#include "GlyphSpans.h"
+#include "GlyphRun.h"
+#include "TextLayoutCache.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <driver/timer.h>
@@ -61,9 +70,17 @@ void WiFiTask(void *pvParameters);
 void handleRoot();
 void handleSettings();
 void handleAbout();
+void handleRefresh();
+void handleLayout();
+#if ISR_METRICS
+void handleMetrics();
+#endif
 void handleCaptivePortal();
 void handleNotFound();
 
+// Luminosité (PxMatrix + niveau des tables gamma)
+void apply_Brightness();
+
 // Pins pour la matrice LED
 #define P_LAT 5
 #define P_A   19
@@ -94,70 +111,33 @@ void handleNotFound();
 hw_timer_t * timer = NULL;
 portMUX_TYPE timerMux = portMUX_INITIALIZER_UNLOCKED;
 
-// Temps d'affichage (plus élevé = plus lumineux, mais attention aux crashs)
-uint8_t display_draw_time = 30; // 30-70 est généralement correct
+// Temps d'affichage (plus élevé = plus lumineux), piloté par refreshScheduler
+uint8_t display_draw_time = 30;
+
+// Ordonnanceur adaptatif : période du timer et draw time selon la durée mesurée de l'ISR
+RefreshScheduler refreshScheduler;
+
+#if ISR_METRICS
+// Durées, gigue et dépassements de display_updater (/metrics, commande série METRICS)
+IsrMetrics isrMetrics;
+#endif
 
 // Objet matrice avec dimensions totales calculées
 PxMATRIX display(TOTAL_WIDTH, TOTAL_HEIGHT, P_LAT, P_OE, P_A, P_B, P_C);
 
-// Couleurs prédéfinies
-uint16_t myRED      = display.color565(255, 0, 0);
-uint16_t myGREEN    = display.color565(0, 255, 0);
-uint16_t myBLUE     = display.color565(0, 0, 255);
-uint16_t myYELLOW   = display.color565(255, 255, 0);
-uint16_t myCYAN     = display.color565(0, 255, 255);
-uint16_t myFUCHSIA  = display.color565(255, 0, 255);
-uint16_t myWHITE    = display.color565(255, 255, 255);
-uint16_t myBLACK    = display.color565(0, 0, 0);
-
-uint16_t myCOLOR_ARRAY[7] = {myRED, myGREEN, myBLUE, myYELLOW, myCYAN, myFUCHSIA, myWHITE};
-int cnt_Color = 0;
-int myCOLOR_ARRAY_Length = sizeof(myCOLOR_ARRAY) / sizeof(myCOLOR_ARRAY[0]);
-
-// Variables pour le texte défilant
-unsigned long prevMill_Scroll_Text = 0;
-int scrolling_Y_Pos = 0;
-long scrolling_X_Pos;
-long scrolling_X_Pos_CT;
-uint16_t scrolling_Text_Color;
-uint16_t text_Color;
-char text_Scrolling_Text[151];
-uint16_t text_Length_In_Pixel;
-bool set_up_Scrolling_Text_Length = true;
-bool start_Scroll_Text = false;
-int scrolling_text_Display_Order = 0;
-bool reset_Scrolling_Text = false;
-
-// Variables de temps
-unsigned long prevMill_Update_Time = 0;
-const long interval_Update_Time = 1000;
-unsigned long prevMill_Show_Clock = 0;
-const long interval_Show_Clock = 500;
+// Rendu horloge + texte défilant (couleurs, état du défilement, paramètres d'affichage)
+#include "ClockRender.h"
 
 // Variables pour la date et l'heure
 char daysOfTheWeek[7][10] = {"LUNDI", "MARDI", "MERCREDI", "JEUDI", "VENDREDI", "SAMEDI", "DIMANCHE"};
-char chr_t_Minute[3];
-uint8_t minute_Val, last_minute_Val;
-char chr_t_Hour[3];
-char day_and_date_Text[25];
-bool blink_Colon = false;
-uint16_t clock_Color;
-uint16_t day_and_date_Text_Color;
 
 // Variables de configuration
 int d_Year;
 uint8_t d_Month, d_Day;
 uint8_t t_Hour, t_Minute, t_Second;
-uint8_t input_Display_Mode = 1;
 uint8_t input_Brightness = 125;
-uint8_t input_Scrolling_Speed = 45;
-int Color_Clock_R = 255, Color_Clock_G = 0, Color_Clock_B = 0;
-int Color_Date_R = 0, Color_Date_G = 255, Color_Date_B = 0;
-int Color_Text_R = 0, Color_Text_G = 0, Color_Text_B = 255;
-char input_Scrolling_Text[151] = "ESP32 P10 RGB Digital Clock with PlatformIO";
 
 // Variables pour le countdown
-bool countdown_Active = false;
 int countdown_Year = 2025;
 int countdown_Month = 12;
 int countdown_Day = 31;
@@ -165,9 +145,6 @@ int countdown_Hour = 23;
 int countdown_Minute = 59;
 int countdown_Second = 59;
 char countdown_Title[51] = "NEW YEAR";
-char countdown_Text[101];
-bool countdown_Expired = false;
-int Color_Countdown_R = 255, Color_Countdown_G = 165, Color_Countdown_B = 0; // Orange par défaut
 
 // Configuration WiFi - Modifiez selon vos besoins
 const char* ssid = "YOUR_WIFI_SSID";
@@ -197,11 +174,33 @@ const IPAddress apIP(192, 168, 1, 1);
 
 // Gestionnaire d'interruption pour l'affichage
 void IRAM_ATTR display_updater() {
-  //if (timer != NULL) {
-    portENTER_CRITICAL_ISR(&timerMux);
-    display.display(display_draw_time);
-    portEXIT_CRITICAL_ISR(&timerMux);
-  //}
+  uint32_t isr_Start = ISR_CYCLES();
+  portENTER_CRITICAL_ISR(&timerMux);
+  display.display(display_draw_time);
+  uint32_t isr_End = ISR_CYCLES();
+  refreshSchedulerRecordIsr(refreshScheduler, isr_End - isr_Start);
+  ISR_METRICS_RECORD(isrMetrics, isr_Start, isr_End);
+  portEXIT_CRITICAL_ISR(&timerMux);
+}
+
+// Ajustement périodique de la période du timer et du draw time (DisplayTask)
+void refresh_scheduler_update() {
+  uint32_t now = millis();
+  if (!refreshSchedulerDue(refreshScheduler, now)) return;
+  portENTER_CRITICAL(&timerMux);
+  RefreshWindow window = refreshSchedulerSnapshot(refreshScheduler);
+  portEXIT_CRITICAL(&timerMux);
+  if (refreshSchedulerApply(refreshScheduler, window, now)) {
+    display_draw_time = refreshScheduler.drawTime;
+    if (timer != NULL) timerAlarmWrite(timer, refreshScheduler.periodUs, true);
+#if ISR_METRICS
+    isrMetricsSetPeriod(isrMetrics, refreshScheduler.periodUs);
+#endif
+    Serial.printf("Refresh: période %u us, draw time %u, %.0f Hz (ISR moy %u us, max %u us, repli %u)\n",
+                  (unsigned)refreshScheduler.periodUs, display_draw_time, refreshScheduler.achievedHz,
+                  (unsigned)refreshScheduler.isrAvgUs, (unsigned)refreshScheduler.isrMaxUs,
+                  refreshScheduler.backoff);
+  }
 }
 
 // Activation/désactivation du timer d'affichage
@@ -211,7 +210,7 @@ void display_update_enable(bool is_enable) {
       timer = timerBegin(0, 80, true);
       if (timer != NULL) {
         timerAttachInterrupt(timer, &display_updater, true);
-        timerAlarmWrite(timer, 1500, true);
+        timerAlarmWrite(timer, refreshScheduler.periodUs, true);
         timerAlarmEnable(timer);
         Serial.println("Display timer enabled successfully");
       } else {
@@ -333,67 +332,9 @@ void updateCountdown() {
   }
 }
 
-// Fonction pour obtenir la largeur du texte en pixels
-uint16_t getTextWidth(const char* text) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-  return w;
-}
-
-// Fonction pour dessiner les deux points de l'heure
-void drawColon(int16_t x, int16_t y, uint16_t colonColor) {
-  display.drawPixel(x, y, colonColor);
-  display.drawPixel(x+1, y, colonColor);
-  display.drawPixel(x, y+1, colonColor);
-  display.drawPixel(x+1, y+1, colonColor);
-
-  display.drawPixel(x, y+3, colonColor);
-  display.drawPixel(x+1, y+3, colonColor);
-  display.drawPixel(x, y+4, colonColor);
-  display.drawPixel(x+1, y+4, colonColor);
-}
-
-// Fonction de texte défilant adaptée aux panneaux multiples
-void run_Scrolling_Text(uint8_t st_Y_Pos, byte st_Speed, char * st_Text, uint16_t st_Color) {
-  if (start_Scroll_Text == true && set_up_Scrolling_Text_Length == true) {
-    if (strlen(st_Text) > 0) {
-      text_Length_In_Pixel = getTextWidth(st_Text);
-      scrolling_X_Pos = TOTAL_WIDTH; // Utiliser la largeur totale
-      set_up_Scrolling_Text_Length = false;
-    } else {
-      start_Scroll_Text = false;
-      return;
-    }
-  }
-
-  unsigned long currentMillis_Scroll_Text = millis();
-  if (currentMillis_Scroll_Text - prevMill_Scroll_Text >= st_Speed) {
-    prevMill_Scroll_Text = currentMillis_Scroll_Text;
-
-    scrolling_X_Pos--;
-    if (scrolling_X_Pos < -(TOTAL_WIDTH + text_Length_In_Pixel)) { // Utiliser la largeur totale
-      set_up_Scrolling_Text_Length = true;
-      start_Scroll_Text = false;
-      return;
-    }
-
-    scrolling_X_Pos_CT = scrolling_X_Pos + 1;
-    
-    display.setTextColor(myBLACK);
-    display.setCursor(scrolling_X_Pos_CT, st_Y_Pos);
-    display.print(st_Text);
-    
-    display.setTextColor(st_Color);
-    display.setCursor(scrolling_X_Pos, st_Y_Pos);
-    display.print(st_Text);
-  }
-}
-
 // Récupération de l'heure
 void get_Time() {
   DateTime now = rtc.now();
-  minute_Val = now.minute();
   sprintf(chr_t_Hour, "%02d", now.hour());
   sprintf(chr_t_Minute, "%02d", now.minute());
 }
@@ -444,11 +385,19 @@ void loadSettings() {
   preferences.end();
   
   // Application des paramètres
-  display.setBrightness(input_Brightness);
+  apply_Brightness();
+}
+
+// Luminosité : part matérielle (PxMatrix) et niveau des tables gamma, puis
+// reconversion des couleurs déjà calculées
+void apply_Brightness() {
+  display.setBrightness(colorGammaApplyBrightness(input_Brightness));
+  refresh_Palette();
+  invalidate_Clock();
   if (input_Display_Mode == 1) {
-    clock_Color = display.color565(Color_Clock_R, Color_Clock_G, Color_Clock_B);
-    day_and_date_Text_Color = display.color565(Color_Date_R, Color_Date_G, Color_Date_B);
-    text_Color = display.color565(Color_Text_R, Color_Text_G, Color_Text_B);
+    clock_Color = color565Corrected(Color_Clock_R, Color_Clock_G, Color_Clock_B);
+    day_and_date_Text_Color = color565Corrected(Color_Date_R, Color_Date_G, Color_Date_B);
+    text_Color = color565Corrected(Color_Text_R, Color_Text_G, Color_Text_B);
   }
 }
 
@@ -480,14 +429,45 @@ void handleNotFound() {
   }
 }
 
-// Gestionnaire de la page principale
+// Gestionnaire de la page principale (gzip si accepté, sinon page brute)
 void handleRoot() {
-  server.send(200, "text/html", MAIN_page);
+  if (webSendGzip(server, "text/html", MAIN_page_gz, MAIN_page_gz_len)) return;
+  server.send_P(200, "text/html", MAIN_page); // sans copie en String
 }
 
 // Page À propos
 void handleAbout(){
-  server.send(200, "text/html", ABOUT_page);
+  if (webSendGzip(server, "text/html", ABOUT_page_gz, ABOUT_page_gz_len)) return;
+  server.send_P(200, "text/html", ABOUT_page);
+}
+
+#if ISR_METRICS
+// Instrumentation de l'ISR d'affichage (durées min/p50/p99/max, gigue, dépassements)
+void handleMetrics() {
+  static IsrMetricsScratch scratch;
+  char json[320];
+  isrMetricsToJson(isrMetricsReport(isrMetrics, scratch), json, sizeof(json));
+  server.send(200, "application/json", json);
+}
+#endif
+
+// État de l'ordonnanceur de rafraîchissement (période, draw time, Hz mesurés)
+void handleRefresh() {
+  char json[256];
+  const int n = refreshSchedulerToJson(refreshScheduler, json, sizeof(json));
+  // Zones de l'horloge redessinées (ClockRender.h), ajoutées avant '}'
+  if (n > 0 && n < (int)sizeof(json)) {
+    snprintf(json + n - 1, sizeof(json) - (n - 1), ",\"damage_count\":%u,\"damage_total\":%lu}",
+             (unsigned)damage_Count, (unsigned long)damage_Total);
+  }
+  server.send(200, "application/json", json);
+}
+
+// Cache des layouts du texte défilant (succès / échecs)
+void handleLayout() {
+  char json[96];
+  textLayoutCacheToJson(scroll_Layouts, json, sizeof(json));
+  server.send(200, "application/json", json);
 }
 
 // Gestionnaire des paramètres
@@ -536,12 +516,13 @@ void handleSettings() {
     display_update_enable(true);
     
     if (input_Display_Mode == 1) {
-      clock_Color = display.color565(Color_Clock_R, Color_Clock_G, Color_Clock_B);
-      day_and_date_Text_Color = display.color565(Color_Date_R, Color_Date_G, Color_Date_B);
-      text_Color = display.color565(Color_Text_R, Color_Text_G, Color_Text_B);
+      clock_Color = color565Corrected(Color_Clock_R, Color_Clock_G, Color_Clock_B);
+      day_and_date_Text_Color = color565Corrected(Color_Date_R, Color_Date_G, Color_Date_B);
+      text_Color = color565Corrected(Color_Text_R, Color_Text_G, Color_Text_B);
     }
     
     display.clearDisplay();
+    invalidate_Clock();
     reset_Scrolling_Text = true;
     scrolling_text_Display_Order = 0;
   }
@@ -565,7 +546,8 @@ void handleSettings() {
     
     delay(50);
     display_update_enable(true);
-    display.setBrightness(input_Brightness);
+    apply_Brightness();
+    reset_Scrolling_Text = true; // couleur du texte défilant reconvertie à la reprise
   }
 
   // Définir la vitesse de défilement
@@ -608,7 +590,7 @@ void handleSettings() {
     
     delay(50);
     display_update_enable(true);
-    clock_Color = display.color565(Color_Clock_R, Color_Clock_G, Color_Clock_B);
+    clock_Color = color565Corrected(Color_Clock_R, Color_Clock_G, Color_Clock_B);
   }
 
   // Définir la couleur de la date
@@ -637,7 +619,7 @@ void handleSettings() {
     
     delay(50);
     display_update_enable(true);
-    day_and_date_Text_Color = display.color565(Color_Date_R, Color_Date_G, Color_Date_B);
+    day_and_date_Text_Color = color565Corrected(Color_Date_R, Color_Date_G, Color_Date_B);
   }
 
   // Définir la couleur du texte
@@ -666,7 +648,7 @@ void handleSettings() {
     
     delay(50);
     display_update_enable(true);
-    text_Color = display.color565(Color_Text_R, Color_Text_G, Color_Text_B);
+    text_Color = color565Corrected(Color_Text_R, Color_Text_G, Color_Text_B);
   }
 
   // Définir le texte défilant
@@ -769,6 +751,11 @@ void prepare_and_start_The_Server() {
   server.on("/", handleRoot);
   server.on("/settings", handleSettings);
   server.on("/about", handleAbout);
+  server.on("/refresh", handleRefresh);
+  server.on("/layout", handleLayout);
+#if ISR_METRICS
+  server.on("/metrics", handleMetrics);
+#endif
   
   // Routes communes pour le portail captif
   server.on("/generate_204", handleRoot);  // Android
@@ -780,6 +767,7 @@ void prepare_and_start_The_Server() {
   
   delay(500);
 
+  webGzipBegin(server); // conserver Accept-Encoding
   server.begin();
   Serial.println("\nHTTP server started");
   
@@ -800,6 +788,29 @@ void prepare_and_start_The_Server() {
   delay(500);
 }
 
+// Commandes série : METRICS (synthèse de l'ISR d'affichage), METRICS RESET
+void serial_Commands() {
+  if (!Serial.available()) return;
+  String cmd = Serial.readStringUntil('\n');
+  cmd.trim();
+  cmd.toUpperCase();
+#if ISR_METRICS
+  if (cmd == "METRICS") {
+    static IsrMetricsScratch scratch;
+    char text[320];
+    isrMetricsToText(isrMetricsReport(isrMetrics, scratch), text, sizeof(text));
+    Serial.print(text);
+  } else if (cmd == "METRICS RESET") {
+    portENTER_CRITICAL(&timerMux);
+    isrMetricsReset(isrMetrics);
+    portEXIT_CRITICAL(&timerMux);
+    Serial.println("Métriques ISR remises à zéro");
+  }
+#else
+  if (cmd.startsWith("METRICS")) Serial.println("Métriques ISR désactivées (ISR_METRICS=0)");
+#endif
+}
+
 void setup() {
   // Délai réduit (1s -> 100ms) si FAST_BOOT
   delay(isFastBoot() ? 100 : 1000);
@@ -818,28 +829,31 @@ void setup() {
   Serial.printf("Taille totale: %dx%d pixels\n", TOTAL_WIDTH, TOTAL_HEIGHT);
   Serial.printf("Nombre total panneaux: %d\n", MATRIX_PANELS_X * MATRIX_PANELS_Y);
   
-  // Ajustement automatique de la luminosité et du draw_time selon le nombre de panneaux
+  // Ajustement automatique de la luminosité selon le nombre de panneaux
   int auto_brightness = 125;
-  uint8_t auto_draw_time = 30;
   
   if (MATRIX_PANELS_X > 2) {
     auto_brightness = 100;
-    auto_draw_time = 25;
   }
   if (MATRIX_PANELS_X > 4) {
     auto_brightness = 80;
-    auto_draw_time = 20;
   }
   if (MATRIX_PANELS_X > 6) {
     auto_brightness = 60;
-    auto_draw_time = 15;
   }
   
   input_Brightness = auto_brightness;
-  display_draw_time = auto_draw_time;
+  
+  // Période et draw time initiaux, ajustés ensuite par l'ordonnanceur
+  refreshSchedulerInit(refreshScheduler, MATRIX_PANELS_X * MATRIX_PANELS_Y, 1500, millis(), ESP.getCpuFreqMHz());
+  display_draw_time = refreshScheduler.drawTime;
+#if ISR_METRICS
+  isrMetricsInit(isrMetrics, ESP.getCpuFreqMHz(), refreshScheduler.periodUs);
+#endif
   
   Serial.printf("Luminosité auto-ajustée: %d\n", auto_brightness);
-  Serial.printf("Draw time ajusté: %d\n", auto_draw_time);
+  Serial.printf("Refresh cible: %u Hz, budget ISR %u%%, draw time max %u\n",
+                refreshScheduler.profile.targetHz, refreshScheduler.profile.cpuBudgetPct, display_draw_time);
   Serial.println("------------------------------");
 
   // Initialisation du RTC
@@ -869,7 +883,7 @@ void setup() {
   loadSettings();
 
   // Appliquer la luminosité ajustée si pas de sauvegarde
-  display.setBrightness(input_Brightness);
+  apply_Brightness();
 
   // Test d'affichage des couleurs avec message adapté - SANS timer
   Serial.println("Testing display colors...");
@@ -981,110 +995,13 @@ void DisplayTask(void *pvParameters) {
   // Attendre un peu que le système soit complètement initialisé
   vTaskDelay(pdMS_TO_TICKS(100));
   
+  uint32_t last_Loop = millis();
   for (;;) {
-    // Mise à jour de l'heure et du countdown
-    unsigned long currentMillis_Update_Time = millis();
-    if (currentMillis_Update_Time - prevMill_Update_Time >= interval_Update_Time) {
-      prevMill_Update_Time = currentMillis_Update_Time;
-      get_Time();
-      blink_Colon = !blink_Colon;
-      if (countdown_Active) {
-        updateCountdown();
-      }
-    }
-
-    // Affichage de l'horloge
-    unsigned long currentMillis_Show_Clock = millis();
-    if (currentMillis_Show_Clock - prevMill_Show_Clock >= interval_Show_Clock) {
-      prevMill_Show_Clock = currentMillis_Show_Clock;
-      display.setTextSize(1);
-      // Couleur selon le mode
-      if (input_Display_Mode == 1) {
-        clock_Color = display.color565(Color_Clock_R, Color_Clock_G, Color_Clock_B);
-      } else {
-        clock_Color = myCOLOR_ARRAY[cnt_Color];
-      }
-      int clock_width = 30;
-      int clock_x = (TOTAL_WIDTH - clock_width) / 2;
-      if (clock_x < 1) clock_x = 1;
-      if (last_minute_Val != minute_Val) display.fillRect(clock_x, 0, 11, 7, myBLACK);
-      display.setTextColor(clock_Color);
-      display.setCursor(clock_x, 0);
-      display.print(chr_t_Hour);
-      int colon_x = clock_x + 14;
-      if (blink_Colon) {
-        drawColon(colon_x, 1, clock_Color);
-      } else {
-        drawColon(colon_x, 1, myBLACK);
-      }
-      if (last_minute_Val != minute_Val) display.fillRect(clock_x + 19, 0, 11, 7, myBLACK);
-      display.setTextColor(clock_Color);
-      display.setCursor(clock_x + 19, 0);
-      display.print(chr_t_Minute);
-      last_minute_Val = minute_Val;
-    }
-
-    // Gestion du texte défilant
-    if (reset_Scrolling_Text) {
-      start_Scroll_Text = false;
-      set_up_Scrolling_Text_Length = true;
-      reset_Scrolling_Text = false;
-    }
-    if (start_Scroll_Text == false) {
-      scrolling_text_Display_Order++;
-      int maxOrder = countdown_Active ? 3 : 2;
-      if (input_Display_Mode == 2) {
-        maxOrder++;
-      }
-      if (scrolling_text_Display_Order > maxOrder) scrolling_text_Display_Order = 1;
-      if (scrolling_text_Display_Order == 1) {
-        get_Date();
-        display.setTextSize(1);
-        scrolling_Y_Pos = 8;
-        if (input_Display_Mode == 1) {
-          scrolling_Text_Color = display.color565(Color_Date_R, Color_Date_G, Color_Date_B);
-        } else {
-          int next_cnt_Color = (cnt_Color + 1) % myCOLOR_ARRAY_Length;
-          scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
-        }
-        strcpy(text_Scrolling_Text, day_and_date_Text);
-      }
-      if (scrolling_text_Display_Order == 2) {
-        display.setTextSize(1);
-        scrolling_Y_Pos = 8;
-        if (input_Display_Mode == 1) {
-          scrolling_Text_Color = display.color565(Color_Text_R, Color_Text_G, Color_Text_B);
-        } else {
-          int next_cnt_Color = (cnt_Color + 2) % myCOLOR_ARRAY_Length;
-          scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
-        }
-        strcpy(text_Scrolling_Text, input_Scrolling_Text);
-      }
-      if (scrolling_text_Display_Order == 3 && countdown_Active) {
-        display.setTextSize(1);
-        scrolling_Y_Pos = 8;
-        if (input_Display_Mode == 1) {
-          if (countdown_Expired) {
-            scrolling_Text_Color = myRED;
-          } else {
-            scrolling_Text_Color = display.color565(Color_Countdown_R, Color_Countdown_G, Color_Countdown_B);
-          }
-        } else {
-          int next_cnt_Color = (cnt_Color + 3) % myCOLOR_ARRAY_Length;
-          scrolling_Text_Color = myCOLOR_ARRAY[next_cnt_Color];
-        }
-        strcpy(text_Scrolling_Text, countdown_Text);
-      }
-      int colorChangeOrder = countdown_Active ? 4 : 3;
-      if (scrolling_text_Display_Order == colorChangeOrder && input_Display_Mode == 2) {
-        cnt_Color = (cnt_Color + 1) % myCOLOR_ARRAY_Length;
-        strcpy(text_Scrolling_Text, "");
-      }
-      start_Scroll_Text = true;
-    }
-    if (start_Scroll_Text) {
-      run_Scrolling_Text(scrolling_Y_Pos, input_Scrolling_Speed, text_Scrolling_Text, scrolling_Text_Color);
-    }
+    uint32_t now = millis();
+    refreshSchedulerTaskLoop(refreshScheduler, 10, now - last_Loop);
+    last_Loop = now;
+    displayTaskStep();
+    refresh_scheduler_update();
     vTaskDelay(pdMS_TO_TICKS(10)); // FreeRTOS : délai approprié de 10ms
   }
 }
@@ -1102,7 +1019,11 @@ void WebServerTask(void *pvParameters) {
       dnsServer.processNextRequest();
     }
     
+    // Retard de réveil seul : l'envoi d'une page (souvent > 20 ms en AP)
+    // n'est pas une famine
+    uint32_t sleep_Start = millis();
     vTaskDelay(pdMS_TO_TICKS(5)); // FreeRTOS : délai approprié de 5ms
+    refreshSchedulerTaskLoop(refreshScheduler, 5, millis() - sleep_Start);
   }
 }
 
@@ -1120,6 +1041,7 @@ void WiFiTask(void *pvParameters) {
 // Fonction loop() vide requise par le framework Arduino
 // Toute la logique est maintenant gérée par les tâches FreeRTOS
 void loop() {
-  // Fonction vide - toute la logique est dans les tâches FreeRTOS
-  delay(1000); // Utiliser delay() Arduino au lieu de vTaskDelay
+  // Toute la logique est dans les tâches FreeRTOS ; seules les commandes série sont lues ici
+  serial_Commands();
+  delay(100); // Utiliser delay() Arduino au lieu de vTaskDelay
 }
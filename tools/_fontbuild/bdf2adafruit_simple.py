@@ -1,10 +1,15 @@
 #!/usr/bin/env python3
 
+import os
 import sys
 import re
 
-def convert_bdf_to_adafruit(bdf_filename, start_char=32, end_char=255):
-    """Convert BDF font to Adafruit GFX format"""
+# Encodeur RLE partagé (tools/font_rle.py)
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+from font_rle import emit_rle_font
+
+def convert_bdf_to_adafruit(bdf_filename, start_char=32, end_char=255, rle=False):
+    """Convert BDF font to Adafruit GFX format (rle=True : format RLE de src/RleFont.h)"""
     
     with open(bdf_filename, 'r') as f:
         lines = f.readlines()
@@ -77,6 +82,10 @@ def convert_bdf_to_adafruit(bdf_filename, start_char=32, end_char=255):
                 }
         i += 1
     
+    if rle:
+        emit_bdf_rle(header_name, font_size, char_data)
+        return
+
     # Generate bitmap data
     bitmap_bytes = []
     for char_code in sorted(char_data.keys()):
@@ -122,10 +131,45 @@ def convert_bdf_to_adafruit(bdf_filename, start_char=32, end_char=255):
     print(f"  (uint8_t  *){header_name}Bitmaps,")
     print(f"  (GFXglyph *){header_name}Glyphs,")
     print(f"  {first_char}, {last_char}, {font_size} }};")
+    print()
+
+    # Métriques horizontales (src/FontMetrics.h) : {xOffset, xAdvance, xRight}
+    print('#include "FontMetrics.h"')
+    print(f"const GlyphMetrics {header_name}Metrics[] PROGMEM = {{")
+    for char_code in range(first_char, last_char + 1):
+        char = char_data.get(char_code, {'width': 0, 'advance': 0, 'x_offset': 0})
+        sep = "," if char_code < last_char else " "
+        print(f"  {{ {char['x_offset']:3d}, {char['advance']:3d}, {char['x_offset'] + char['width']:3d} }}{sep}   // 0x{char_code:02X}")
+    print("};")
+    print(f"const FontMetrics {header_name}Widths = {{ {header_name}Metrics, {first_char}, {last_char} }};")
+
+def bdf_rows(char):
+    """Lignes 0/1 d'un glyphe BDF (lignes hexadécimales alignées sur l'octet)"""
+    rows = []
+    for hex_line in char['bitmap']:
+        value = int(hex_line, 16)
+        nbits = len(hex_line) * 4
+        rows.append([(value >> (nbits - 1 - x)) & 1 for x in range(char['width'])])
+    return rows
+
+def emit_bdf_rle(header_name, font_size, char_data):
+    """Sortie au format RLE : mêmes glyphes et métriques que la sortie bitmap"""
+    first_char = min(char_data.keys())
+    last_char = max(char_data.keys())
+    glyph_list = []
+    for char_code in range(first_char, last_char + 1):
+        char = char_data.get(char_code)
+        if char is None:
+            glyph_list.append(([], 0, 0, 0, 0, 0))
+            continue
+        glyph_list.append((bdf_rows(char), char['width'], char['height'], char['advance'],
+                           char['x_offset'], char['y_offset']))
+    emit_rle_font(header_name, first_char, last_char, font_size, glyph_list)
 
 if __name__ == "__main__":
-    if len(sys.argv) != 2:
-        print("Usage: python3 bdf2adafruit.py <font.bdf>")
+    args = [a for a in sys.argv[1:] if a != "--rle"]
+    if len(args) != 1:
+        print("Usage: python3 bdf2adafruit.py [--rle] <font.bdf>")
         sys.exit(1)
     
-    convert_bdf_to_adafruit(sys.argv[1])
+    convert_bdf_to_adafruit(args[0], rle="--rle" in sys.argv)
@@ -0,0 +1,157 @@
+/*
+ * fontconvert_aa : police TTF -> glyphes anti-aliasés 2 ou 4 bits/pixel (src/AaFont.h)
+ *
+ * Même principe que fontconvert d'Adafruit GFX (FreeType, 141 DPI, même
+ * nommage <police><taille>pt<7|8>b) mais rendu en niveaux de gris
+ * (FT_RENDER_MODE_NORMAL, hinting "light") puis quantifié sur 4 ou 16
+ * niveaux de couverture. Les pixels sont rangés ligne par ligne dans la
+ * boîte du glyphe, bpp bits MSB en premier, chaque glyphe commence sur un
+ * octet. Les lignes et colonnes dont la couverture quantifiée est nulle
+ * sont retirées de la boîte.
+ *
+ * Compilation (faite par tools/generate_latin1_font.sh -a) :
+ *   gcc $(pkg-config --cflags freetype2) fontconvert_aa.c $(pkg-config --libs freetype2) -o fontconvert_aa
+ * Usage :
+ *   ./fontconvert_aa DejaVuSans.ttf 9 32 255 4 > DejaVuSans9ptLat1Aa4.h
+ */
+#include <ctype.h>
+#include <ft2build.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include FT_GLYPH_H
+
+#define DPI 141
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t width, height, xAdvance;
+  int8_t xOffset, yOffset;
+} Glyph;
+
+static int row = 0, acc = 0, nbits = 0, firstByte = 1, total = 0;
+
+static void emitByte(int value) {
+  if (!firstByte) {
+    if (++row >= 12) { printf(",\n  "); row = 0; }
+    else printf(", ");
+  }
+  printf("0x%02X", value);
+  firstByte = 0;
+  total++;
+}
+
+static void emitLevel(int level, int bpp) {
+  acc = (acc << bpp) | level;
+  nbits += bpp;
+  if (nbits == 8) { emitByte(acc); acc = 0; nbits = 0; }
+}
+
+static void flushGlyph(void) {
+  if (nbits) { emitByte(acc << (8 - nbits)); acc = 0; nbits = 0; }
+}
+
+int main(int argc, char *argv[]) {
+  int i, j, err, size, first = ' ', last = '~', bpp = 4;
+  char *fontName, c, *ptr;
+  FT_Library library;
+  FT_Face face;
+
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s police.ttf taille [premier dernier [bpp 2|4]]\n", argv[0]);
+    return 1;
+  }
+  size = atoi(argv[2]);
+  if (argc >= 5) { first = atoi(argv[3]); last = atoi(argv[4]); }
+  if (argc >= 6) bpp = atoi(argv[5]);
+  if (bpp != 2 && bpp != 4) { fprintf(stderr, "bpp doit valoir 2 ou 4\n"); return 1; }
+  if (last < first) { i = first; first = last; last = i; }
+  const int levels = 1 << bpp;
+
+  ptr = strrchr(argv[1], '/');
+  ptr = ptr ? ptr + 1 : argv[1];
+  fontName = malloc(strlen(ptr) + 24);
+  strcpy(fontName, ptr);
+  if ((ptr = strrchr(fontName, '.'))) *ptr = 0;
+  sprintf(&fontName[strlen(fontName)], "%dpt%dbAa%d", size, (last > 127) ? 8 : 7, bpp);
+  for (i = 0; (c = fontName[i]); i++) {
+    if (isspace((unsigned char)c) || ispunct((unsigned char)c)) fontName[i] = '_';
+  }
+
+  if ((err = FT_Init_FreeType(&library))) { fprintf(stderr, "FreeType : erreur %d\n", err); return err; }
+  if ((err = FT_New_Face(library, argv[1], 0, &face))) { fprintf(stderr, "Police illisible (%d)\n", err); return err; }
+  FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
+
+  Glyph *table = calloc(last - first + 1, sizeof(Glyph));
+  uint8_t *q = NULL;
+  char guard[128];
+  for (i = 0; fontName[i] && i < 120; i++) guard[i] = toupper((unsigned char)fontName[i]);
+  strcpy(&guard[i], "_H");
+
+  printf("#ifndef %s\n#define %s\n", guard, guard);
+  printf("// Police anti-aliasée %d bits/pixel (tools/_fontbuild/fontconvert_aa.c, src/AaFont.h)\n", bpp);
+  printf("#include \"AaFont.h\"\n");
+  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  for (i = first, j = 0; i <= last; i++, j++) {
+    table[j].bitmapOffset = total;
+    if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_LIGHT))) { fprintf(stderr, "Erreur %d chargement '%c'\n", err, i); continue; }
+    if ((err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL))) { fprintf(stderr, "Erreur %d rendu '%c'\n", err, i); continue; }
+    FT_Bitmap *bitmap = &face->glyph->bitmap;
+    int w = bitmap->width, h = bitmap->rows, x, y;
+    table[j].xAdvance = (face->glyph->advance.x + 32) >> 6;
+
+    // Quantification (arrondi) puis boîte réduite aux niveaux non nuls
+    q = realloc(q, (w * h > 0) ? w * h : 1);
+    int minX = w, maxX = -1, minY = h, maxY = -1;
+    for (y = 0; y < h; y++) {
+      for (x = 0; x < w; x++) {
+        int level = (bitmap->buffer[y * bitmap->pitch + x] * (levels - 1) + 127) / 255;
+        q[y * w + x] = level;
+        if (level) {
+          if (x < minX) minX = x;
+          if (x > maxX) maxX = x;
+          if (y < minY) minY = y;
+          if (y > maxY) maxY = y;
+        }
+      }
+    }
+    if (maxX < 0) {
+      table[j].width = table[j].height = 0;
+      table[j].xOffset = 0;
+      table[j].yOffset = 1;
+      continue;
+    }
+    table[j].width = maxX - minX + 1;
+    table[j].height = maxY - minY + 1;
+    table[j].xOffset = face->glyph->bitmap_left + minX;
+    table[j].yOffset = minY - face->glyph->bitmap_top;
+    for (y = minY; y <= maxY; y++) {
+      for (x = minX; x <= maxX; x++) emitLevel(q[y * w + x], bpp);
+    }
+    flushGlyph();
+  }
+  printf(" };\n\n");
+
+  printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
+  for (i = first, j = 0; i <= last; i++, j++) {
+    printf("  { %5u, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset, table[j].width, table[j].height,
+           table[j].xAdvance, table[j].xOffset, table[j].yOffset);
+    printf("%s   // 0x%02X", (i < last) ? "," : " ", i);
+    if (i >= ' ' && i <= '~') printf(" '%c'", i);
+    putchar('\n');
+  }
+  printf("};\n\n");
+
+  long yAdvance = face->size->metrics.height >> 6;
+  printf("const AaFont %s = {\n", fontName);
+  printf("  %sBitmaps, %sGlyphs, 0x%02X, 0x%02X, %ld, %d };\n\n", fontName, fontName, first, last, yAdvance, bpp);
+  printf("// Approx. %d bytes\n", total + (last - first + 1) * 7 + 8);
+  printf("#endif // %s\n", guard);
+
+  if (total > 0xFFFF) fprintf(stderr, "Attention : %d octets, bitmapOffset GFXglyph limité à 65535\n", total);
+  free(q);
+  free(table);
+  FT_Done_FreeType(library);
+  return 0;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+Génère le header de familles de polices multi-tailles (src/FontFamily.h)
+
+Les headers GFX (fontconvert + tools/font_metrics.py) sont regroupés par style
+d'après le nom de leur GFXfont (<base><taille>pt<7|8>b, ex. DejaVuSans_Bold12pt8b
+-> famille DejaVuSansBoldFamily) puis triés par hauteur d'encre des chiffres.
+Chaque taille, sauf la plus petite de la famille, est gardée par
+#if FONT_FAMILY_MAX_HEIGHT >= <hauteur des chiffres> : seules les tailles qui
+tiennent dans la hauteur du panneau sont compilées (flash).
+
+Usage :
+  python3 tools/font_family.py -o examples/fonts/DejaVuFontFamily.h \\
+      examples/DejaVuSans*9ptLat1.h examples/fonts/DejaVuSans*ptLat1.h
+
+Appelé par tools/generate_latin1_font.sh -F.
+"""
+
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from font_metrics import parse_font
+
+NAME_RE = re.compile(r"^(\w+?)(\d+)pt\d+b$")
+
+
+def digit_height(first, glyphs):
+    """Hauteur d'encre de l'union des chiffres '0'-'9' (pixels, taille 1)"""
+    top = min(glyphs[c - first][5] for c in range(ord("0"), ord("9") + 1))
+    bottom = max(glyphs[c - first][5] + glyphs[c - first][2] for c in range(ord("0"), ord("9") + 1))
+    return bottom - top
+
+
+def load(path):
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+    name, first, glyphs = parse_font(source)
+    if f"{name}Widths" not in source:
+        raise ValueError(f"{path} : table {name}Widths absente (tools/font_metrics.py --append)")
+    m = NAME_RE.match(name)
+    if not m:
+        raise ValueError(f"{path} : nom {name} hors convention <base><taille>pt<n>b")
+    if first > ord("0") or first + len(glyphs) - 1 < ord("9"):
+        raise ValueError(f"{path} : chiffres absents de la police")
+    family = m.group(1).replace("_", "") + "Family"
+    return family, int(m.group(2)), digit_height(first, glyphs), name, path
+
+
+def emit(fonts, output, out=sys.stdout):
+    families = {}
+    for f in fonts:
+        families.setdefault(f[0], []).append(f)
+    out_dir = os.path.dirname(os.path.abspath(output)) if output else os.getcwd()
+    guard = re.sub(r"[^A-Z0-9]", "_", os.path.basename(output or "FontFamilies.h").upper())
+
+    print(f"#ifndef {guard}", file=out)
+    print(f"#define {guard}", file=out)
+    print("// Familles de polices multi-tailles (tools/font_family.py, src/FontFamily.h)", file=out)
+    print("// Une taille n'est compilée que si ses chiffres tiennent dans FONT_FAMILY_MAX_HEIGHT", file=out)
+    print("// (hauteur du panneau par défaut) ; la plus petite taille est toujours présente.", file=out)
+    print('#include "FontFamily.h"', file=out)
+    print("#ifndef FONT_FAMILY_MAX_HEIGHT", file=out)
+    print("  #define FONT_FAMILY_MAX_HEIGHT TOTAL_HEIGHT", file=out)
+    print("#endif", file=out)
+    for family, members in families.items():
+        members.sort(key=lambda f: (f[2], f[1]))
+        print(file=out)
+        for i, (_, points, height, name, path) in enumerate(members):
+            inc = os.path.relpath(os.path.abspath(path), out_dir).replace(os.sep, "/")
+            if i == 0:
+                print(f'#include "{inc}"', file=out)
+            else:
+                print(f"#if FONT_FAMILY_MAX_HEIGHT >= {height}", file=out)
+                print(f'  #include "{inc}"', file=out)
+                print("#endif", file=out)
+        print(f"const FontFamilyEntry {family}Entries[] = {{", file=out)
+        for i, (_, points, height, name, path) in enumerate(members):
+            entry = f"{{ &{name}, &{name}Widths, {points} }},"
+            if i == 0:
+                print(f"  {entry:<58} // chiffres {height} px", file=out)
+            else:
+                print(f"#if FONT_FAMILY_MAX_HEIGHT >= {height}", file=out)
+                print(f"  {entry:<58} // chiffres {height} px", file=out)
+                print("#endif", file=out)
+        print("};", file=out)
+        print(f"const FontFamily {family} = {{ {family}Entries, "
+              f"sizeof({family}Entries) / sizeof({family}Entries[0]) }};", file=out)
+    print(file=out)
+    print(f"#endif // {guard}", file=out)
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    output = None
+    if len(args) >= 2 and args[0] == "-o":
+        output = args[1]
+        args = args[2:]
+    if not args:
+        print(__doc__)
+        sys.exit(1)
+    fonts = [load(p) for p in args]
+    if output:
+        with open(output, "w", encoding="utf-8") as f:
+            emit(fonts, output, f)
+        print(f"[OK] {len(fonts)} polices -> {output}")
+    else:
+        emit(fonts, None)
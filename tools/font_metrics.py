@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Génère la table de métriques horizontales (src/FontMetrics.h) d'une police
+Adafruit GFX déjà convertie (sortie fontconvert ou bdf2adafruit_simple.py).
+
+Usage :
+  python3 tools/font_metrics.py examples/DejaVuSans9ptLat1.h           # affiche le bloc
+  python3 tools/font_metrics.py --append examples/DejaVuSans9ptLat1.h  # l'insère dans le header
+
+Avec --append le bloc est placé avant le dernier #endif du header ; un bloc
+existant est remplacé (relance sans effet de bord).
+"""
+
+import re
+import sys
+
+BEGIN_MARK = "// --- Métriques horizontales (tools/font_metrics.py) ---"
+END_MARK = "// --- Fin des métriques ---"
+
+GLYPH_RE = re.compile(r"\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*\}")
+FONT_RE = re.compile(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?,\s*[^,]*?,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,", re.S)
+
+
+def parse_font(source):
+    """Retourne (nom, first, [(offset, w, h, xa, xo, yo), ...])"""
+    font = FONT_RE.search(source)
+    if not font:
+        raise ValueError("structure GFXfont introuvable")
+    name = font.group(1)
+    first = int(font.group(2), 0)
+    last = int(font.group(3), 0)
+    start = source.find(f"{name}Glyphs[]")
+    if start < 0:
+        raise ValueError(f"table {name}Glyphs introuvable")
+    end = source.find("};", start)
+    glyphs = [tuple(int(v) for v in m.groups()) for m in GLYPH_RE.finditer(source, start, end)]
+    if len(glyphs) != last - first + 1:
+        raise ValueError(f"{len(glyphs)} glyphes pour la plage 0x{first:02X}-0x{last:02X}")
+    return name, first, glyphs
+
+
+def metrics_block(name, first, glyphs):
+    """Bloc C : table GlyphMetrics {xOffset, xAdvance, xRight} et FontMetrics <nom>Widths"""
+    lines = [BEGIN_MARK, '#include "FontMetrics.h"', f"const GlyphMetrics {name}Metrics[] PROGMEM = {{"]
+    for i, (_, w, _, xa, xo, _) in enumerate(glyphs):
+        sep = "," if i < len(glyphs) - 1 else " "
+        lines.append(f"  {{ {xo:3d}, {xa:3d}, {xo + w:3d} }}{sep}   // 0x{first + i:02X}")
+    lines.append("};")
+    last = first + len(glyphs) - 1
+    lines.append(f"const FontMetrics {name}Widths = {{ {name}Metrics, 0x{first:02X}, 0x{last:02X} }};")
+    lines.append(END_MARK)
+    return "\n".join(lines) + "\n"
+
+
+def append_to_header(path):
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+    name, first, glyphs = parse_font(source)
+    block = metrics_block(name, first, glyphs)
+    b = source.find(BEGIN_MARK)
+    if b >= 0:
+        e = source.find(END_MARK, b) + len(END_MARK)
+        source = source[:b] + block.rstrip("\n") + source[e:]
+    else:
+        e = source.rfind("#endif")
+        if e < 0:
+            raise ValueError("#endif final introuvable")
+        source = source[:e] + block + "\n" + source[e:]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(source)
+    print(f"[OK] {name}Widths ({len(glyphs)} glyphes) -> {path}")
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    append = "--append" in args
+    files = [a for a in args if a != "--append"]
+    if not files:
+        print(__doc__)
+        sys.exit(1)
+    for path in files:
+        if append:
+            append_to_header(path)
+        else:
+            with open(path, "r", encoding="utf-8") as f:
+                print(metrics_block(*parse_font(f.read())))
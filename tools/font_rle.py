@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Format de police RLE (src/RleFont.h) : conversion et encodeur partagé
+
+Chaque glyphe est parcouru ligne par ligne dans sa boîte (width x height) comme
+une suite unique de pixels. On code les longueurs de plages alternées éteint /
+allumé (la première plage est éteinte, éventuellement vide) sur 3 bits, MSB
+en premier :
+  0..6 : longueur de la plage, puis plage suivante (couleur inverse)
+  7    : +7 pixels, la même plage continue au code suivant
+La dernière plage éteinte est omise. Chaque glyphe commence sur un octet ;
+l'offset de glyphe (bitmapOffset) pointe dans la table des plages.
+
+Usage :
+  python3 tools/font_rle.py examples/DejaVuSans9ptLat1.h > examples/DejaVuSans9ptLat1Rle.h
+
+Encodeur importé par tools/_fontbuild/bdf2adafruit_simple.py (--rle).
+"""
+
+import os
+import re
+import sys
+
+RLE_BITS = 3
+RLE_CONTINUE = (1 << RLE_BITS) - 1
+
+
+def rle_encode_rows(rows):
+    """rows : liste de lignes (listes de 0/1). Retourne les octets du glyphe."""
+    flat = [v for r in rows for v in r]
+    runs = []
+    cur, count = 0, 0
+    for v in flat:
+        if v == cur:
+            count += 1
+        else:
+            runs.append(count)
+            cur, count = v, 1
+    if cur == 1:
+        runs.append(count)     # plage allumée finale ; une plage éteinte finale est omise
+    codes = []
+    for run in runs:
+        while run >= RLE_CONTINUE:
+            codes.append(RLE_CONTINUE)
+            run -= RLE_CONTINUE
+        codes.append(run)
+    out = bytearray()
+    acc, nbits = 0, 0
+    for code in codes:
+        acc = (acc << RLE_BITS) | code
+        nbits += RLE_BITS
+        while nbits >= 8:
+            nbits -= 8
+            out.append((acc >> nbits) & 0xFF)
+    if nbits:
+        out.append((acc << (8 - nbits)) & 0xFF)
+    return bytes(out)
+
+
+def rle_decode(data, width, height):
+    """Inverse de rle_encode_rows (vérification)"""
+    total = width * height
+    flat = [0] * total
+    pos, on, bit = 0, 0, 0
+    while bit + RLE_BITS <= len(data) * 8 and pos < total:
+        code = 0
+        for _ in range(RLE_BITS):
+            code = (code << 1) | ((data[bit >> 3] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        run = min(code, total - pos)
+        if on:
+            for i in range(run):
+                flat[pos + i] = 1
+        pos += run
+        if code != RLE_CONTINUE:
+            on ^= 1
+    return [flat[y * width:(y + 1) * width] for y in range(height)]
+
+
+# --- Lecture d'un header Adafruit GFX (fontconvert / bdf2adafruit_simple.py) ---
+
+GLYPH_RE = re.compile(r"\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*\}")
+FONT_RE = re.compile(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?,\s*[^,]*?,\s*(0x[0-9A-Fa-f]+|\d+)\s*,"
+                     r"\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}", re.S)
+
+
+def parse_gfx_header(source):
+    """Retourne (nom, first, last, yAdvance, bitmaps, glyphes)"""
+    font = FONT_RE.search(source)
+    if not font:
+        raise ValueError("structure GFXfont introuvable")
+    name = font.group(1)
+    first, last, y_advance = int(font.group(2), 0), int(font.group(3), 0), int(font.group(4))
+    b = source.find(f"{name}Bitmaps[]")
+    b = source.find("{", b)
+    bitmaps = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})\b", source[b:source.find("};", b)])]
+    g = source.find(f"{name}Glyphs[]")
+    glyphs = [tuple(int(v) for v in m.groups()) for m in GLYPH_RE.finditer(source, g, source.find("};", g))]
+    if len(glyphs) != last - first + 1:
+        raise ValueError(f"{len(glyphs)} glyphes pour la plage 0x{first:02X}-0x{last:02X}")
+    return name, first, last, y_advance, bitmaps, glyphs
+
+
+def glyph_rows(bitmaps, offset, width, height):
+    """Lignes d'un glyphe GFX (bits contigus, MSB en premier)"""
+    rows = []
+    bit = offset * 8
+    for _ in range(height):
+        row = []
+        for _ in range(width):
+            row.append((bitmaps[bit >> 3] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        rows.append(row)
+    return rows
+
+
+def emit_rle_font(name, first, last, y_advance, glyph_list, source_bytes=None, out=sys.stdout):
+    """glyph_list : [(rows, width, height, xAdvance, xOffset, yOffset)] de first à last"""
+    data = bytearray()
+    entries = []
+    for rows, w, h, xa, xo, yo in glyph_list:
+        entries.append((len(data), w, h, xa, xo, yo))
+        data += rle_encode_rows(rows)
+    guard = f"{name.upper()}_RLE_H"
+    print(f"#ifndef {guard}", file=out)
+    print(f"#define {guard}", file=out)
+    print(f"// Police RLE (tools/font_rle.py, src/RleFont.h) : {len(data)} octets de plages"
+          + (f", {source_bytes} octets en bitmap 1 bpp" if source_bytes is not None else ""), file=out)
+    print('#include "RleFont.h"', file=out)
+    print(f"const uint8_t {name}RleRuns[] PROGMEM = {{", file=out)
+    for i in range(0, len(data), 12):
+        chunk = ", ".join(f"0x{v:02X}" for v in data[i:i + 12])
+        print(f"  {chunk}" + ("," if i + 12 < len(data) else ""), file=out)
+    print("};", file=out)
+    print(file=out)
+    print(f"const GFXglyph {name}RleGlyphs[] PROGMEM = {{", file=out)
+    for i, (off, w, h, xa, xo, yo) in enumerate(entries):
+        sep = "," if i < len(entries) - 1 else " "
+        print(f"  {{ {off:5d}, {w:3d}, {h:3d}, {xa:3d}, {xo:4d}, {yo:4d} }}{sep}   // 0x{first + i:02X}", file=out)
+    print("};", file=out)
+    print(file=out)
+    print(f"const RleFont {name}Rle = {{", file=out)
+    print(f"  {name}RleRuns, {name}RleGlyphs, sizeof({name}RleRuns), 0x{first:02X}, 0x{last:02X}, {y_advance} }};",
+          file=out)
+    print(f"#endif // {guard}", file=out)
+
+
+def convert_header(path):
+    with open(path, "r", encoding="utf-8") as f:
+        name, first, last, y_advance, bitmaps, glyphs = parse_gfx_header(f.read())
+    glyph_list = []
+    for off, w, h, xa, xo, yo in glyphs:
+        rows = glyph_rows(bitmaps, off, w, h)
+        if rle_decode(rle_encode_rows(rows), w, h) != rows:
+            raise ValueError(f"aller-retour RLE incorrect pour un glyphe de {name}")
+        glyph_list.append((rows, w, h, xa, xo, yo))
+    emit_rle_font(name, first, last, y_advance, glyph_list, source_bytes=len(bitmaps))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+    convert_header(sys.argv[1])
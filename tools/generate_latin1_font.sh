@@ -3,6 +3,9 @@ set -euo pipefail
 
 # Script de génération d'une police Latin-1 (0x20-0xFF) pour Adafruit GFX
 # Produit: DejaVuSans9ptLat1.h (remplace le placeholder existant)
+# Avec -r : une taille native par point (ex: 6-24) au lieu du zoom entier GFX
+# Avec -F : famille DejaVu complète (Normal, Gras, Italique) dans examples/fonts/
+# Avec -a : glyphes anti-aliasés 2 ou 4 bits/pixel (src/AaFont.h, fontconvert_aa.c)
 # Plateformes: macOS / Linux
 # Dépendances: git, make, g++, freetype (brew install freetype), curl (si téléchargement du TTF)
 
@@ -12,6 +15,12 @@ LAST_CODE=255
 FONT_TTF=""
 FONT_NAME="DejaVuSans"
 OUTPUT_NAME="DejaVuSans9ptLat1.h"
+SIZE_RANGE=""
+FAMILY_MODE=0
+AA_BPP=""
+# Tailles de la famille par défaut : 9 pt réutilise les headers existants
+# (examples/DejaVuSans*9ptLat1.h), 24 pt dépasse 32 px de haut
+FAMILY_SIZES="6 7 8 10 11 12 14 16 18 20 22"
 PROJECT_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
 EXAMPLES_DIR="${PROJECT_ROOT}/examples"
 TOOLS_DIR="${PROJECT_ROOT}/tools"
@@ -19,41 +28,76 @@ WORK_DIR="${TOOLS_DIR}/_fontbuild"
 ADAFRUIT_GFX_DIR="${WORK_DIR}/Adafruit-GFX-Library"
 FONTSUBDIR="fontconvert"
 FONTCVT="${ADAFRUIT_GFX_DIR}/${FONTSUBDIR}/fontconvert"
+FONTCVT_AA="${WORK_DIR}/fontconvert_aa"
+DEST_DIR="${EXAMPLES_DIR}"
+FAMILY_DIR="${EXAMPLES_DIR}/fonts"
 
 usage() {
   cat <<EOF
-Usage: $0 [-f /chemin/police.ttf] [-s taille] [-o NomSortie.h]
+Usage: $0 [-f /chemin/police.ttf] [-s taille | -r tailles] [-o NomSortie.h] [-d dossier] [-F | -a bpp]
 
 Options:
   -f  Chemin vers le fichier .ttf (sinon tentative de téléchargement DejaVu Sans)
   -s  Taille en points (défaut: ${POINT_SIZE})
+  -r  Plusieurs tailles : "MIN-MAX" ou liste "6 8 10" ; -o sert de modèle,
+      le nombre avant "pt" y est remplacé par chaque taille
   -o  Nom du header généré (défaut: ${OUTPUT_NAME})
+  -d  Dossier de sortie (défaut: examples, examples/fonts avec -F)
+  -F  Famille DejaVu Sans / Bold / Oblique (TTF cherchés à côté de -f), tailles
+      ${FAMILY_SIZES} par défaut, puis examples/fonts/DejaVuFontFamily.h
+      (tools/font_family.py) pour l'ajustement automatique du compte à rebours
+  -a  Glyphes anti-aliasés 2 ou 4 bits/pixel (src/AaFont.h) : <NomSortie>Aa<bpp>.h,
+      compile tools/_fontbuild/fontconvert_aa.c (pas de -F)
   -h  Aide
 
 Exemple:
   $0 -f ~/Library/Fonts/DejaVuSans.ttf
   $0 -s 10 -o CustomSans10ptLat1.h
+  $0 -r 6-24 -d /tmp/dejavu
+  $0 -F
+  $0 -F -r 6-24     # panneaux de plus de 32 px de haut
+  $0 -a 4 -f .../DejaVuSans-Bold.ttf -o DejaVuSansBold9ptLat1.h
 EOF
 }
 
-while getopts "f:s:o:h" opt; do
+while getopts "f:s:r:o:d:Fa:h" opt; do
   case $opt in
     f) FONT_TTF="$OPTARG" ;;
     s) POINT_SIZE="$OPTARG" ;;
+    r) SIZE_RANGE="$OPTARG" ;;
     o) OUTPUT_NAME="$OPTARG" ;;
+    d) DEST_DIR="$OPTARG"; FAMILY_DIR="$OPTARG" ;;
+    F) FAMILY_MODE=1 ;;
+    a) AA_BPP="$OPTARG" ;;
     h) usage; exit 0 ;;
     *) usage; exit 1 ;;
   esac
 done
 
+if [[ -n "${AA_BPP}" && "${AA_BPP}" != "2" && "${AA_BPP}" != "4" ]]; then
+  echo "[ERREUR] -a : 2 ou 4 bits/pixel" >&2; exit 1
+fi
+if [[ -n "${AA_BPP}" && ${FAMILY_MODE} -eq 1 ]]; then
+  echo "[ERREUR] -a et -F ne se combinent pas (familles 1 bpp)" >&2; exit 1
+fi
+
+# Liste des tailles : -r "MIN-MAX" ou "6 8 10", sinon -s
+SIZES="${POINT_SIZE}"
+if [[ -n "${SIZE_RANGE}" ]]; then
+  if [[ "${SIZE_RANGE}" =~ ^([0-9]+)-([0-9]+)$ ]]; then
+    SIZES="$(seq "${BASH_REMATCH[1]}" "${BASH_REMATCH[2]}" | tr '\n' ' ')"
+  else
+    SIZES="${SIZE_RANGE}"
+  fi
+elif [[ ${FAMILY_MODE} -eq 1 ]]; then
+  SIZES="${FAMILY_SIZES}"
+fi
+
 echo "[INFO] Racine projet: ${PROJECT_ROOT}"
 mkdir -p "${WORK_DIR}"
 
-# 1. Récupération / compilation fontconvert
-if [[ ! -x "${FONTCVT}" ]]; then
-  echo "[INFO] Clonage Adafruit-GFX-Library..."
-  rm -rf "${ADAFRUIT_GFX_DIR}" || true
-  git clone --depth=1 https://github.com/adafruit/Adafruit-GFX-Library.git "${ADAFRUIT_GFX_DIR}"
+# Options de compilation FreeType (Homebrew puis pkg-config)
+detect_freetype() {
   echo "[INFO] Détection FreeType..."
   FT_PREFIX=""
   if command -v brew >/dev/null 2>&1; then
@@ -79,6 +123,21 @@ if [[ ! -x "${FONTCVT}" ]]; then
     LDFLAGS_VAR+=" $PKG_LIBS"
     echo "[INFO] pkg-config freetype2: $PKG_CFLAGS | $PKG_LIBS"
   fi
+}
+
+# 1. Récupération / compilation fontconvert (fontconvert_aa avec -a)
+if [[ -n "${AA_BPP}" ]]; then
+  if [[ ! -x "${FONTCVT_AA}" ]]; then
+    detect_freetype
+    echo "[INFO] Compilation fontconvert_aa ..."
+    gcc -Wall $EXTRA_CFLAGS "${WORK_DIR}/fontconvert_aa.c" $LDFLAGS_VAR -lfreetype -o "${FONTCVT_AA}" \
+      || { echo "[ERREUR] Échec compilation fontconvert_aa"; exit 3; }
+  fi
+elif [[ ! -x "${FONTCVT}" ]]; then
+  echo "[INFO] Clonage Adafruit-GFX-Library..."
+  rm -rf "${ADAFRUIT_GFX_DIR}" || true
+  git clone --depth=1 https://github.com/adafruit/Adafruit-GFX-Library.git "${ADAFRUIT_GFX_DIR}"
+  detect_freetype
   echo "[INFO] Compilation fontconvert (directe) ..."
   (cd "${ADAFRUIT_GFX_DIR}/${FONTSUBDIR}" && \
      gcc -Wall $EXTRA_CFLAGS fontconvert.c $LDFLAGS_VAR -lfreetype -o fontconvert 2>/dev/null || \
@@ -112,39 +171,94 @@ if [[ ! -f "${FONT_TTF}" ]]; then
 fi
 echo "[INFO] Utilisation TTF: ${FONT_TTF}"
 
-# 3. Génération
-OUT_TMP="${WORK_DIR}/${OUTPUT_NAME}"
-echo "[INFO] Génération ${OUTPUT_NAME} (plage ${FIRST_CODE}-${LAST_CODE}, ${POINT_SIZE}pt)"
-"${FONTCVT}" "${FONT_TTF}" "${POINT_SIZE}" "${FIRST_CODE}" "${LAST_CODE}" > "${OUT_TMP}"
+# 3-6. Génération d'un header : generate_font <ttf> <taille> <NomSortie.h> <dossier>
+generate_font() {
+  local ttf="$1" size="$2" output_name="$3" dest_dir="$4"
+  if [[ -n "${AA_BPP}" ]]; then
+    # Glyphes anti-aliasés : header complet (garde, AaFont) produit par l'outil
+    output_name="${output_name%.h}Aa${AA_BPP}.h"
+    echo "[INFO] Génération ${output_name} (plage ${FIRST_CODE}-${LAST_CODE}, ${size}pt, ${AA_BPP} bits/pixel)"
+    mkdir -p "${dest_dir}"
+    "${FONTCVT_AA}" "${ttf}" "${size}" "${FIRST_CODE}" "${LAST_CODE}" "${AA_BPP}" > "${dest_dir}/${output_name}"
+    echo "[OK] Police générée: ${dest_dir}/${output_name}"
+    return
+  fi
+  local out_tmp="${WORK_DIR}/${output_name}"
+  echo "[INFO] Génération ${output_name} (plage ${FIRST_CODE}-${LAST_CODE}, ${size}pt)"
+  "${FONTCVT}" "${ttf}" "${size}" "${FIRST_CODE}" "${LAST_CODE}" > "${out_tmp}"
 
-# 4. Renommage symbole interne probable (ex: DejaVuSans9pt7b -> DejaVuSans9ptLat1)
-ORIG_SYM="DejaVuSans${POINT_SIZE}pt7b"
-NEW_SYM_BASE="${OUTPUT_NAME%.h}"
+  # 4. Renommage symbole interne probable (ex: DejaVuSans9pt7b -> DejaVuSans9ptLat1)
+  local orig_sym="DejaVuSans${size}pt7b"
+  local new_sym_base="${output_name%.h}"
 
-if grep -q "${ORIG_SYM}" "${OUT_TMP}"; then
-  echo "[INFO] Renommage symbole ${ORIG_SYM} -> ${NEW_SYM_BASE}"
-  if [[ "$OSTYPE" == "darwin"* ]]; then
-    sed -i '' "s/${ORIG_SYM}/${NEW_SYM_BASE}/g" "${OUT_TMP}"
-  else
-    sed -i "s/${ORIG_SYM}/${NEW_SYM_BASE}/g" "${OUT_TMP}"
+  if grep -q "${orig_sym}" "${out_tmp}"; then
+    echo "[INFO] Renommage symbole ${orig_sym} -> ${new_sym_base}"
+    if [[ "$OSTYPE" == "darwin"* ]]; then
+      sed -i '' "s/${orig_sym}/${new_sym_base}/g" "${out_tmp}"
+    else
+      sed -i "s/${orig_sym}/${new_sym_base}/g" "${out_tmp}"
+    fi
   fi
-fi
 
-# 5. Ajout garde inclusion si absent
-if ! grep -q "#ifndef" "${OUT_TMP}"; then
-  GUARD="$(echo "${NEW_SYM_BASE}" | tr '[:lower:]' '[:upper:]' | tr -c 'A-Z0-9' '_')_H"
-  { echo "#ifndef ${GUARD}"; echo "#define ${GUARD}"; cat "${OUT_TMP}"; echo "#endif // ${GUARD}"; } > "${OUT_TMP}.guard" && mv "${OUT_TMP}.guard" "${OUT_TMP}" 
-fi
+  # 5. Ajout garde inclusion si absent
+  if ! grep -q "#ifndef" "${out_tmp}"; then
+    local guard
+    guard="$(echo "${new_sym_base}" | tr '[:lower:]' '[:upper:]' | tr -c 'A-Z0-9' '_')_H"
+    { echo "#ifndef ${guard}"; echo "#define ${guard}"; cat "${out_tmp}"; echo "#endif // ${guard}"; } > "${out_tmp}.guard" && mv "${out_tmp}.guard" "${out_tmp}" 
+  fi
 
-# 6. Sauvegarde ancienne version si présente
-DEST_FILE="${EXAMPLES_DIR}/${OUTPUT_NAME}"
-if [[ -f "${DEST_FILE}" ]]; then
-  cp -f "${DEST_FILE}" "${DEST_FILE}.bak.$(date +%Y%m%d-%H%M%S)"
-  echo "[INFO] Backup ancienne police -> ${DEST_FILE}.bak.*"
-fi
+  # 5b. Table de métriques horizontales (largeur de texte sans getTextBounds)
+  python3 "${TOOLS_DIR}/font_metrics.py" --append "${out_tmp}"
+
+  # 6. Sauvegarde ancienne version si présente
+  mkdir -p "${dest_dir}"
+  local dest_file="${dest_dir}/${output_name}"
+  if [[ -f "${dest_file}" ]]; then
+    cp -f "${dest_file}" "${dest_file}.bak.$(date +%Y%m%d-%H%M%S)"
+    echo "[INFO] Backup ancienne police -> ${dest_file}.bak.*"
+  fi
+
+  cp "${out_tmp}" "${dest_file}"
+  echo "[OK] Police générée: ${dest_file}"
+}
 
-cp "${OUT_TMP}" "${DEST_FILE}"
-echo "[OK] Police générée: ${DEST_FILE}"
+# Nom de sortie pour une taille : le nombre avant "pt" du modèle est remplacé
+sized_name() {
+  local template="$1" size="$2"
+  if [[ "${template}" =~ ^(.*[^0-9])[0-9]+(pt.*)$ ]]; then
+    echo "${BASH_REMATCH[1]}${size}${BASH_REMATCH[2]}"
+  else
+    echo "${template%.h}${size}pt.h"
+  fi
+}
+
+if [[ ${FAMILY_MODE} -eq 1 ]]; then
+  # Famille : un header par style et par taille, 9 pt repris d'examples/
+  TTF_DIR="$(dirname "${FONT_TTF}")"
+  for style in "" Bold Oblique; do
+    ttf="${TTF_DIR}/DejaVuSans${style:+-${style}}.ttf"
+    if [[ ! -f "${ttf}" ]]; then
+      echo "[ERREUR] ${ttf} introuvable." >&2
+      exit 2
+    fi
+    for size in ${SIZES}; do
+      if [[ "${size}" == "9" ]]; then
+        echo "[INFO] 9pt : examples/DejaVuSans${style}9ptLat1.h réutilisé"
+        continue
+      fi
+      generate_font "${ttf}" "${size}" "DejaVuSans${style}${size}ptLat1.h" "${FAMILY_DIR}"
+    done
+  done
+  python3 "${TOOLS_DIR}/font_family.py" -o "${FAMILY_DIR}/DejaVuFontFamily.h" \
+    "${EXAMPLES_DIR}/DejaVuSans9ptLat1.h" "${EXAMPLES_DIR}/DejaVuSansBold9ptLat1.h" \
+    "${EXAMPLES_DIR}/DejaVuSansOblique9ptLat1.h" "${FAMILY_DIR}"/DejaVuSans*ptLat1.h
+elif [[ -n "${SIZE_RANGE}" ]]; then
+  for size in ${SIZES}; do
+    generate_font "${FONT_TTF}" "${size}" "$(sized_name "${OUTPUT_NAME}" "${size}")" "${DEST_DIR}"
+  done
+else
+  generate_font "${FONT_TTF}" "${POINT_SIZE}" "${OUTPUT_NAME}" "${DEST_DIR}"
+fi
 echo "[NOTE] Recompiler: pio run -e fullscreen_countdown_web"
 
 exit 0
@@ -0,0 +1,312 @@
+/**
+ * Adafruit_GFX de substitution pour l'environnement natif (PC)
+ *
+ * Reprend l'API et les algorithmes de rendu texte d'Adafruit GFX 1.11.x
+ * (write/drawChar/charBounds/getTextBounds, primitives par défaut passant
+ * par writePixel) afin que le coût mesuré en natif soit représentatif du
+ * firmware. Ajoute des compteurs de mesure :
+ *  - gfxCalls      : appels de primitives publiques (hors appels internes)
+ *  - pixelsTouched : écritures de pixels dans le framebuffer
+ *  - pixelsClipped : écritures rejetées hors écran (coût CPU sans effet)
+ *
+ * La police 5x7 intégrée reprend les métriques de glcdfont.c (cellule 6x8)
+ * pour la plage ASCII 0x20-0x7E ; les autres codes sont vides.
+ */
+#ifndef NATIVE_ADAFRUIT_GFX_H
+#define NATIVE_ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+#include "gfxfont.h"
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
+#endif
+
+// Police 5x7 (colonnes, LSB en haut) pour 0x20-0x7E
+static const uint8_t nativeClassicFont[95 * 5] = {
+  0x00,0x00,0x00,0x00,0x00, 0x00,0x00,0x5F,0x00,0x00, 0x00,0x07,0x00,0x07,0x00, 0x14,0x7F,0x14,0x7F,0x14,
+  0x24,0x2A,0x7F,0x2A,0x12, 0x23,0x13,0x08,0x64,0x62, 0x36,0x49,0x56,0x20,0x50, 0x00,0x08,0x07,0x03,0x00,
+  0x00,0x1C,0x22,0x41,0x00, 0x00,0x41,0x22,0x1C,0x00, 0x2A,0x1C,0x7F,0x1C,0x2A, 0x08,0x08,0x3E,0x08,0x08,
+  0x00,0x80,0x70,0x30,0x00, 0x08,0x08,0x08,0x08,0x08, 0x00,0x00,0x60,0x60,0x00, 0x20,0x10,0x08,0x04,0x02,
+  0x3E,0x51,0x49,0x45,0x3E, 0x00,0x42,0x7F,0x40,0x00, 0x72,0x49,0x49,0x49,0x46, 0x21,0x41,0x49,0x4D,0x33,
+  0x18,0x14,0x12,0x7F,0x10, 0x27,0x45,0x45,0x45,0x39, 0x3C,0x4A,0x49,0x49,0x31, 0x41,0x21,0x11,0x09,0x07,
+  0x36,0x49,0x49,0x49,0x36, 0x46,0x49,0x49,0x29,0x1E, 0x00,0x00,0x14,0x00,0x00, 0x00,0x40,0x34,0x00,0x00,
+  0x00,0x08,0x14,0x22,0x41, 0x14,0x14,0x14,0x14,0x14, 0x00,0x41,0x22,0x14,0x08, 0x02,0x01,0x59,0x09,0x06,
+  0x3E,0x41,0x5D,0x59,0x4E, 0x7C,0x12,0x11,0x12,0x7C, 0x7F,0x49,0x49,0x49,0x36, 0x3E,0x41,0x41,0x41,0x22,
+  0x7F,0x41,0x41,0x41,0x3E, 0x7F,0x49,0x49,0x49,0x41, 0x7F,0x09,0x09,0x09,0x01, 0x3E,0x41,0x41,0x51,0x73,
+  0x7F,0x08,0x08,0x08,0x7F, 0x00,0x41,0x7F,0x41,0x00, 0x20,0x40,0x41,0x3F,0x01, 0x7F,0x08,0x14,0x22,0x41,
+  0x7F,0x40,0x40,0x40,0x40, 0x7F,0x02,0x1C,0x02,0x7F, 0x7F,0x04,0x08,0x10,0x7F, 0x3E,0x41,0x41,0x41,0x3E,
+  0x7F,0x09,0x09,0x09,0x06, 0x3E,0x41,0x51,0x21,0x5E, 0x7F,0x09,0x19,0x29,0x46, 0x26,0x49,0x49,0x49,0x32,
+  0x03,0x01,0x7F,0x01,0x03, 0x3F,0x40,0x40,0x40,0x3F, 0x1F,0x20,0x40,0x20,0x1F, 0x3F,0x40,0x38,0x40,0x3F,
+  0x63,0x14,0x08,0x14,0x63, 0x03,0x04,0x78,0x04,0x03, 0x61,0x59,0x49,0x4D,0x43, 0x00,0x7F,0x41,0x41,0x41,
+  0x02,0x04,0x08,0x10,0x20, 0x00,0x41,0x41,0x41,0x7F, 0x04,0x02,0x01,0x02,0x04, 0x40,0x40,0x40,0x40,0x40,
+  0x00,0x03,0x07,0x08,0x00, 0x20,0x54,0x54,0x78,0x40, 0x7F,0x28,0x44,0x44,0x38, 0x38,0x44,0x44,0x44,0x28,
+  0x38,0x44,0x44,0x28,0x7F, 0x38,0x54,0x54,0x54,0x18, 0x00,0x08,0x7E,0x09,0x02, 0x18,0xA4,0xA4,0x9C,0x78,
+  0x7F,0x08,0x04,0x04,0x78, 0x00,0x44,0x7D,0x40,0x00, 0x20,0x40,0x40,0x3D,0x00, 0x7F,0x10,0x28,0x44,0x00,
+  0x00,0x41,0x7F,0x40,0x00, 0x7C,0x04,0x78,0x04,0x78, 0x7C,0x08,0x04,0x04,0x78, 0x38,0x44,0x44,0x44,0x38,
+  0xFC,0x18,0x24,0x24,0x18, 0x18,0x24,0x24,0x18,0xFC, 0x7C,0x08,0x04,0x04,0x08, 0x48,0x54,0x54,0x54,0x24,
+  0x04,0x04,0x3F,0x44,0x24, 0x3C,0x40,0x40,0x20,0x7C, 0x1C,0x20,0x40,0x20,0x1C, 0x3C,0x40,0x30,0x40,0x3C,
+  0x44,0x28,0x10,0x28,0x44, 0x4C,0x90,0x90,0x90,0x7C, 0x44,0x64,0x54,0x4C,0x44, 0x00,0x08,0x36,0x41,0x00,
+  0x00,0x00,0x77,0x00,0x00, 0x00,0x41,0x36,0x08,0x00, 0x02,0x01,0x02,0x04,0x02
+};
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+    _width = w; _height = h;
+  }
+
+  // --- Mesure (spécifique natif) ---
+  struct Stats { uint32_t gfxCalls; uint32_t pixelsTouched; uint32_t pixelsClipped; };
+  void resetStats() { _stats.gfxCalls = _stats.pixelsTouched = _stats.pixelsClipped = 0; }
+  const Stats &stats() const { return _stats; }
+
+  // --- Primitives ---
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void startWrite(void) {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) { _swap_int16_t(x0, y0); _swap_int16_t(x1, y1); }
+    if (x0 > x1) { _swap_int16_t(x0, x1); _swap_int16_t(y0, y1); }
+    int16_t dx = x1 - x0, dy = abs(y1 - y0);
+    int16_t err = dx / 2, ystep = (y0 < y1) ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) writePixel(y0, x0, color); else writePixel(x0, y0, color);
+      err -= dy;
+      if (err < 0) { y0 += ystep; err += dx; }
+    }
+  }
+  virtual void endWrite(void) {}
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    ApiScope s(this);
+    writeLine(x, y, x, y + h - 1, color);
+  }
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    ApiScope s(this);
+    writeLine(x, y, x + w - 1, y, color);
+  }
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    ApiScope s(this);
+    for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, color);
+  }
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    ApiScope s(this);
+    writeLine(x0, y0, x1, y1, color);
+  }
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    ApiScope s(this);
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    ApiScope s(this);
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+      for (int16_t i = 0; i < w; i++) {
+        if (i & 7) b <<= 1; else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+        if (b & 0x80) writePixel(x + i, y, color);
+      }
+    }
+  }
+
+  // --- Texte ---
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+    ApiScope s(this);
+    if (!gfxFont) {
+      if ((x >= _width) || (y >= _height) || ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0)) return;
+      const uint8_t *glyph = (c >= 0x20 && c <= 0x7E) ? &nativeClassicFont[(c - 0x20) * 5] : nullptr;
+      for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = glyph ? glyph[i] : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+          if (line & 1) {
+            if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, color);
+            else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+          } else if (bg != color) {
+            if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, bg);
+            else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+          }
+        }
+      }
+      if (bg != color) {
+        if (size_x == 1 && size_y == 1) writeFastVLine(x + 5, y, 8, bg);
+        else writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+      }
+    } else {
+      c -= (uint8_t)pgm_read_byte(&gfxFont->first);
+      const GFXglyph *glyph = &gfxFont->glyph[c];
+      const uint8_t *bitmap = gfxFont->bitmap;
+      uint16_t bo = glyph->bitmapOffset;
+      uint8_t w = glyph->width, h = glyph->height;
+      int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+      uint8_t xx, yy, bits = 0, bit = 0;
+      int16_t xo16 = xo, yo16 = yo;
+      for (yy = 0; yy < h; yy++) {
+        for (xx = 0; xx < w; xx++) {
+          if (!(bit++ & 7)) bits = pgm_read_byte(&bitmap[bo++]);
+          if (bits & 0x80) {
+            if (size_x == 1 && size_y == 1) writePixel(x + xo + xx, y + yo + yy, color);
+            else writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+          }
+          bits <<= 1;
+        }
+      }
+    }
+  }
+
+  virtual size_t write(uint8_t c) override {
+    if (!gfxFont) {
+      if (c == '\n') { cursor_x = 0; cursor_y += textsize_y * 8; }
+      else if (c != '\r') {
+        if (wrap && ((cursor_x + textsize_x * 6) > _width)) { cursor_x = 0; cursor_y += textsize_y * 8; }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * 6;
+      }
+    } else {
+      if (c == '\n') { cursor_x = 0; cursor_y += (int16_t)textsize_y * gfxFont->yAdvance; }
+      else if (c != '\r') {
+        uint8_t first = gfxFont->first;
+        if ((c >= first) && (c <= (uint8_t)gfxFont->last)) {
+          const GFXglyph *glyph = &gfxFont->glyph[c - first];
+          uint8_t w = glyph->width, h = glyph->height;
+          if ((w > 0) && (h > 0)) {
+            int16_t xo = glyph->xOffset;
+            if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width)) {
+              cursor_x = 0; cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+            }
+            drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+          }
+          cursor_x += glyph->xAdvance * (int16_t)textsize_x;
+        }
+      }
+    }
+    return 1;
+  }
+  using Print::write;
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t getCursorX(void) const { return cursor_x; }
+  int16_t getCursorY(void) const { return cursor_y; }
+  void setTextSize(uint8_t s) { setTextSize(s, s); }
+  void setTextSize(uint8_t sx, uint8_t sy) { textsize_x = (sx > 0) ? sx : 1; textsize_y = (sy > 0) ? sy : 1; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+  void setTextWrap(bool w) { wrap = w; }
+  void cp437(bool x = true) { _cp437 = x; }
+  void setRotation(uint8_t x) {
+    rotation = (x & 3);
+    if (rotation & 1) { _width = HEIGHT; _height = WIDTH; }
+    else { _width = WIDTH; _height = HEIGHT; }
+  }
+  uint8_t getRotation(void) const { return rotation; }
+  void setFont(const GFXfont *f = NULL) {
+    if (f) { if (!gfxFont) cursor_y += 6; }
+    else if (gfxFont) { cursor_y -= 6; }
+    gfxFont = (GFXfont *)f;
+  }
+  void getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    uint8_t c;
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    *x1 = x; *y1 = y; *w = *h = 0;
+    while ((c = *str++)) charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+    if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+  }
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+
+protected:
+  // Compte un appel de primitive uniquement au premier niveau d'imbrication
+  struct ApiScope {
+    Adafruit_GFX *g;
+    explicit ApiScope(Adafruit_GFX *gfx) : g(gfx) { if (g->_statDepth++ == 0) g->_stats.gfxCalls++; }
+    ~ApiScope() { g->_statDepth--; }
+  };
+  void notePixel(bool inside) { if (inside) _stats.pixelsTouched++; else _stats.pixelsClipped++; }
+
+  void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy) {
+    if (gfxFont) {
+      if (c == '\n') { *x = 0; *y += textsize_y * gfxFont->yAdvance; }
+      else if (c != '\r') {
+        uint8_t first = gfxFont->first, last = gfxFont->last;
+        if ((c >= first) && (c <= last)) {
+          const GFXglyph *glyph = &gfxFont->glyph[c - first];
+          uint8_t gw = glyph->width, gh = glyph->height, xa = glyph->xAdvance;
+          int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+          if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x)) > _width)) { *x = 0; *y += textsize_y * gfxFont->yAdvance; }
+          int16_t tsx = (int16_t)textsize_x, tsy = (int16_t)textsize_y;
+          int16_t x1 = *x + xo * tsx, y1 = *y + yo * tsy, x2 = x1 + gw * tsx - 1, y2 = y1 + gh * tsy - 1;
+          if (x1 < *minx) *minx = x1;
+          if (y1 < *miny) *miny = y1;
+          if (x2 > *maxx) *maxx = x2;
+          if (y2 > *maxy) *maxy = y2;
+          *x += xa * tsx;
+        }
+      }
+    } else {
+      if (c == '\n') { *x = 0; *y += textsize_y * 8; }
+      else if (c != '\r') {
+        if (wrap && ((*x + textsize_x * 6) > _width)) { *x = 0; *y += textsize_y * 8; }
+        int x2 = *x + textsize_x * 6 - 1, y2 = *y + textsize_y * 8 - 1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        if (*x < *minx) *minx = *x;
+        if (*y < *miny) *miny = *y;
+        *x += textsize_x * 6;
+      }
+    }
+  }
+
+  int16_t WIDTH, HEIGHT;
+  int16_t _width, _height;
+  int16_t cursor_x = 0, cursor_y = 0;
+  uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+  uint8_t textsize_x = 1, textsize_y = 1;
+  uint8_t rotation = 0;
+  bool wrap = true;
+  bool _cp437 = false;
+  GFXfont *gfxFont = nullptr;
+
+  Stats _stats = {0, 0, 0};
+  uint8_t _statDepth = 0;
+};
+
+// Canevas 1 bit par pixel (lignes alignées sur l'octet, MSB à gauche)
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+    uint32_t bytes = ((w + 7) / 8) * h;
+    buffer = (uint8_t *)calloc(bytes ? bytes : 1, 1);
+  }
+  ~GFXcanvas1() { free(buffer); }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    ApiScope s(this);
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) { notePixel(false); return; }
+    notePixel(true);
+    uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color) *ptr |= 0x80 >> (x & 7);
+    else *ptr &= ~(0x80 >> (x & 7));
+  }
+  bool getPixel(int16_t x, int16_t y) const {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return false;
+    return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+  }
+  void fillScreen(uint16_t color) override {
+    memset(buffer, color ? 0xFF : 0x00, ((WIDTH + 7) / 8) * HEIGHT);
+  }
+  uint8_t *getBuffer(void) const { return buffer; }
+
+private:
+  uint8_t *buffer;
+};
+
+#endif // NATIVE_ADAFRUIT_GFX_H
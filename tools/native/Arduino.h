@@ -0,0 +1,70 @@
+/**
+ * Arduino.h de substitution pour l'environnement natif (PC)
+ *
+ * Fournit le strict nécessaire pour compiler le code de rendu du firmware
+ * (src/ClockRender.h, examples/FullscreenCountdownRender.h) sur Linux/macOS :
+ * types Arduino, PROGMEM, horloge millis() pilotable, sections critiques
+ * FreeRTOS neutralisées et une classe Print minimale.
+ *
+ * Utilisé uniquement par [env:native] (voir platformio.ini).
+ */
+#ifndef NATIVE_ARDUINO_STUB_H
+#define NATIVE_ARDUINO_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define NATIVE_BUILD 1
+
+#define PROGMEM
+#define PGM_P const char *
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) (*(void * const *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Horloge simulée : le banc de mesure avance le temps lui-même
+inline unsigned long &nativeMillisRef() {
+  static unsigned long ms = 0;
+  return ms;
+}
+inline unsigned long millis() { return nativeMillisRef(); }
+inline void nativeAdvanceMillis(unsigned long ms) { nativeMillisRef() += ms; }
+inline void delay(unsigned long ms) { nativeAdvanceMillis(ms); }
+
+// Sections critiques FreeRTOS : sans objet en natif (mono-thread)
+typedef struct { int owner; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux)     ((void)(mux))
+#define portEXIT_CRITICAL(mux)      ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)  ((void)(mux))
+
+// Print minimal (sous-ensemble utilisé par le rendu)
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  size_t write(const char *s) {
+    size_t n = 0;
+    while (s && *s) n += write((uint8_t)*s++);
+    return n;
+  }
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { char b[16]; snprintf(b, sizeof(b), "%d", v); return write(b); }
+  size_t print(long v) { char b[24]; snprintf(b, sizeof(b), "%ld", v); return write(b); }
+  size_t print(unsigned int v) { char b[16]; snprintf(b, sizeof(b), "%u", v); return write(b); }
+};
+
+#endif // NATIVE_ARDUINO_STUB_H
@@ -0,0 +1,39 @@
+/**
+ * Vérifications des tests natifs (examples/xxx_test.cpp)
+ *
+ * CHECK(cond, format, ...) compte la vérification et affiche le message
+ * printf des NATIVE_CHECK_PRINT_MAX premiers échecs. nativeCheckSummary()
+ * affiche le bilan « SUCCES/ECHEC (n echec(s) sur m verifications) » et
+ * donne le code de sortie du test (!= 0 si un échec). Les lignes de
+ * section restent dans chaque test (largeur et détails propres).
+ *
+ * Utilisé uniquement par les environnements [env:native_*] (voir platformio.ini).
+ */
+#ifndef NATIVE_CHECK_H
+#define NATIVE_CHECK_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef NATIVE_CHECK_PRINT_MAX
+#define NATIVE_CHECK_PRINT_MAX 10
+#endif
+
+static int failures = 0;
+static uint32_t checks = 0;
+
+#define CHECK(cond, ...) do { \
+  checks++; \
+  if (!(cond)) { \
+    if (failures < NATIVE_CHECK_PRINT_MAX) { printf("  ECHEC: "); printf(__VA_ARGS__); printf("\n"); } \
+    failures++; \
+  } \
+} while (0)
+
+// Bilan final ; unit : nom des vérifications comptées
+static int nativeCheckSummary(const char *unit = "verifications") {
+  printf("\n%s (%d echec(s) sur %u %s)\n", failures == 0 ? "SUCCES" : "ECHEC", failures, checks, unit);
+  return failures == 0 ? 0 : 1;
+}
+
+#endif // NATIVE_CHECK_H
@@ -0,0 +1,114 @@
+/**
+ * PxMATRIX de substitution pour l'environnement natif (PC)
+ *
+ * Même interface publique que 2dom/PxMatrix (sous-ensemble utilisé par le
+ * firmware) mais le "panneau" est un simple framebuffer RGB565 en mémoire.
+ * Permet de mesurer le coût du rendu (voir examples/native_render_bench.cpp)
+ * et de comparer des images pixel à pixel sans matériel.
+ */
+#ifndef NATIVE_PXMATRIX_STUB_H
+#define NATIVE_PXMATRIX_STUB_H
+
+#include "Adafruit_GFX.h"
+
+enum mux_patterns { BINARY, STRAIGHT, SHIFTREG_ABC, SHIFTREG_SPI_SE, SHIFTREG_ABC_BIN_DE };
+enum scan_patterns { LINE, ZIGZAG, ZZAGG, ZAGGIZ, WZAGZIG, VZAG, ZAGZIG, WZAGZIG2, ZZIAGG };
+enum block_patterns { ABCD, DBCA };
+
+class PxMATRIX : public Adafruit_GFX {
+public:
+  PxMATRIX(uint16_t width, uint16_t height, uint8_t LATCH, uint8_t OE, uint8_t A, uint8_t B, uint8_t C)
+    : Adafruit_GFX(width, height) {
+    (void)LATCH; (void)OE; (void)A; (void)B; (void)C;
+    _buffers[0] = (uint16_t *)calloc((size_t)width * height, sizeof(uint16_t));
+#ifdef PxMATRIX_double_buffer
+    _buffers[1] = (uint16_t *)calloc((size_t)width * height, sizeof(uint16_t));
+#else
+    _buffers[1] = _buffers[0];
+#endif
+    _fb = _buffers[1];
+  }
+  ~PxMATRIX() {
+    if (_buffers[1] != _buffers[0]) free(_buffers[1]);
+    free(_buffers[0]);
+  }
+
+  void begin(uint8_t row_pattern) { _row_pattern = row_pattern; }
+  void begin() { begin(8); }
+  void setScanPattern(scan_patterns p) { _scan_pattern = p; }
+  void setMuxPattern(mux_patterns p) { _mux_pattern = p; }
+  void setMuxDelay(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t) {}
+  void setBrightness(uint8_t b) { _brightness = b; }
+  void setFastUpdate(bool) {}
+
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    ApiScope s(this);
+    drawPixelRGB565(x, y, color);
+  }
+  void drawPixelRGB565(int16_t x, int16_t y, uint16_t color) {
+    if (rotation == 1) { _swap_int16_t(x, y); x = WIDTH - 1 - x; }
+    else if (rotation == 2) { x = WIDTH - 1 - x; y = HEIGHT - 1 - y; }
+    else if (rotation == 3) { _swap_int16_t(x, y); y = HEIGHT - 1 - y; }
+    if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) { notePixel(false); return; }
+    notePixel(true);
+    _fb[y * WIDTH + x] = color;
+  }
+
+  void clearDisplay(void) {
+    ApiScope s(this);
+    memset(_fb, 0, (size_t)WIDTH * HEIGHT * sizeof(uint16_t));
+  }
+  void fillScreen(uint16_t color) override {
+    ApiScope s(this);
+    for (int32_t i = 0; i < (int32_t)WIDTH * HEIGHT; i++) _fb[i] = color;
+    _stats.pixelsTouched += (uint32_t)WIDTH * HEIGHT;
+  }
+
+  // Rafraîchissement : rien à transmettre, on compte seulement les appels
+  void display(uint16_t show_time) { (void)show_time; _refreshCount++; }
+  void display() { display(0); }
+
+#ifdef PxMATRIX_double_buffer
+  // Même sémantique que PxMatrix : le dessin vise le buffer inactif,
+  // showBuffer() le rend visible, copyBuffer() recopie l'un dans l'autre.
+  void showBuffer() {
+    _active_buffer = !_active_buffer;
+    _fb = _buffers[_active_buffer ? 0 : 1];
+    _swapCount++;
+  }
+  void copyBuffer(bool reverse = false) {
+    uint16_t *front = _buffers[_active_buffer ? 1 : 0];
+    if (reverse) memcpy(front, _fb, (size_t)WIDTH * HEIGHT * sizeof(uint16_t));
+    else memcpy(_fb, front, (size_t)WIDTH * HEIGHT * sizeof(uint16_t));
+  }
+#endif
+
+  // --- Accès spécifiques natif ---
+  // Buffer de dessin (buffer arrière en double buffer) et buffer affiché
+  const uint16_t *framebuffer() const { return _fb; }
+  const uint16_t *visibleBuffer() const { return _buffers[_active_buffer ? 1 : 0]; }
+  uint32_t swapCount() const { return _swapCount; }
+  uint16_t getPixel(int16_t x, int16_t y) const {
+    if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) return 0;
+    return _fb[y * WIDTH + x];
+  }
+  uint8_t getBrightness() const { return _brightness; }
+  uint32_t refreshCount() const { return _refreshCount; }
+
+private:
+  uint16_t *_buffers[2];
+  uint16_t *_fb;           // buffer de dessin
+  bool _active_buffer = false;
+  uint32_t _swapCount = 0;
+  uint8_t _row_pattern = 8;
+  uint8_t _brightness = 255;
+  scan_patterns _scan_pattern = LINE;
+  mux_patterns _mux_pattern = BINARY;
+  uint32_t _refreshCount = 0;
+};
+
+#endif // NATIVE_PXMATRIX_STUB_H
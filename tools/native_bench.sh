@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Lance le banc de rendu natif pour chaque géométrie de panneaux
+# (1x1, 2x1, 3x1, 4x1, 2x2, 6x1, 8x1). Voir examples/native_render_bench.cpp.
+PROJECT_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+cd "${PROJECT_ROOT}"
+
+ENVS=(native native_cascade_2x1 native_cascade_3x1 native_cascade_4x1 native_cascade_2x2 native_cascade_6x1 native_cascade_8x1)
+if [[ $# -gt 0 ]]; then
+    ENVS=("$@")
+fi
+
+for env in "${ENVS[@]}"; do
+    pio run -s -e "${env}" -t exec
+done
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Précompresse les pages web (gzip) en tableaux PROGMEM
+
+Les pages restent écrites dans leur source C++ (littéraux concaténés de
+src/PageIndex.h, raw string MAIN_page de examples/fullscreen_countdown_web.cpp).
+Pour chaque page listée dans PAGES, le texte du littéral est extrait, les
+marqueurs (__AUTHOR_NAME__ ...) sont remplacés par la valeur des constantes
+`static const char* NOM = "...";` du même fichier, puis le tout est compressé
+(gzip -9, date nulle : sortie reproductible) dans <page>_gz[] / <page>_gz_len.
+
+Le firmware envoie ce tableau tel quel avec Content-Encoding: gzip quand le
+navigateur l'accepte (src/WebGzip.h), la page brute sinon.
+
+Usage :
+  python3 tools/web_gzip.py            # régénère les headers modifiés
+  python3 tools/web_gzip.py --check    # code de sortie 1 si un header est périmé
+
+Aussi déclaré en extra_scripts (pre:) des environnements main et
+fullscreen_countdown_web : les headers sont régénérés avant chaque
+compilation et réécrits seulement si leur contenu change.
+"""
+
+import gzip
+import os
+import re
+import sys
+
+# (source, pages, header généré, marqueurs -> constante C du source)
+PAGES = [
+    ("src/PageIndex.h", ["MAIN_page", "ABOUT_page"], "src/PageIndexGz.h", {}),
+    ("examples/fullscreen_countdown_web.cpp", ["MAIN_page"], "examples/CountdownPageGz.h", {
+        "v__FWVER__": "FIRMWARE_VERSION",
+        "__AUTHOR_NAME__": "AUTHOR_NAME",
+        "__GITHUB_URL__": "GITHUB_URL",
+    }),
+]
+
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPES = {"n": "\n", "t": "\t", "r": "\r", '"': '"', "'": "'", "\\": "\\", "?": "?", "0": "\0"}
+
+
+def unescape(text):
+    """Séquences d'échappement C simples (pas d'octal ni d'hexadécimal)"""
+    def repl(m):
+        c = m.group(1)
+        if c not in ESCAPES:
+            raise ValueError(f"échappement \\{c} non géré")
+        return ESCAPES[c]
+    return re.sub(r"\\(.)", repl, text)
+
+
+def extract_page(source, name):
+    """Texte du tableau `name` : raw string R"delim(...)delim" ou littéraux concaténés"""
+    m = re.search(r"\b" + re.escape(name) + r"\s*\[\s*\]\s*(?:PROGMEM\s*)?=\s*", source)
+    if not m:
+        raise ValueError(f"page {name} introuvable")
+    rest = source[m.end():]
+    raw = re.match(r'R"([^(\s]*)\(', rest)
+    if raw:
+        end = rest.index(")" + raw.group(1) + '"', raw.end())
+        return rest[raw.end():end]
+    # Littéraux successifs jusqu'au ';' (blancs et commentaires entre eux)
+    parts = []
+    pos = 0
+    skip = re.compile(r"(?:\s+|//[^\n]*|/\*.*?\*/)*", re.S)
+    while True:
+        pos = skip.match(rest, pos).end()
+        s = STRING_RE.match(rest, pos)
+        if not s:
+            break
+        parts.append(unescape(s.group(1)))
+        pos = s.end()
+    if not parts or not rest.startswith(";", pos):
+        raise ValueError(f"page {name} : littéraux illisibles")
+    return "".join(parts)
+
+
+def constant(source, name):
+    m = re.search(r"\b" + re.escape(name) + r'\s*=\s*"((?:[^"\\\n]|\\.)*)"\s*;', source)
+    if not m:
+        raise ValueError(f"constante {name} introuvable")
+    return unescape(m.group(1))
+
+
+def page_bytes(source, name, markers):
+    text = extract_page(source, name)
+    for marker, const in markers.items():
+        text = text.replace(marker, constant(source, const))
+    return text.encode("utf-8")
+
+
+def render(src, names, output, markers, root):
+    with open(os.path.join(root, src), "r", encoding="utf-8") as f:
+        source = f.read()
+    guard = re.sub(r"[^A-Z0-9]", "_", os.path.basename(output).upper())
+    lines = [
+        f"// Généré par tools/web_gzip.py depuis {src} : ne pas modifier",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+    ]
+    for name in names:
+        data = page_bytes(source, name, markers)
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        lines += [
+            "",
+            f"// {name} : {len(data)} octets -> {len(gz)} octets gzip ({100 * len(gz) / len(data):.0f} %)",
+            f"static const uint8_t {name}_gz[] PROGMEM = {{",
+        ]
+        for i in range(0, len(gz), 16):
+            lines.append("  " + ", ".join(f"0x{b:02X}" for b in gz[i:i + 16]) + ",")
+        lines += ["};", f"static const size_t {name}_gz_len = sizeof({name}_gz);"]
+    lines += ["", f"#endif // {guard}", ""]
+    return "\n".join(lines)
+
+
+def generate(root, check=False, log=print):
+    stale = 0
+    for src, names, output, markers in PAGES:
+        text = render(src, names, output, markers, root)
+        path = os.path.join(root, output)
+        current = None
+        if os.path.exists(path):
+            with open(path, "r", encoding="utf-8") as f:
+                current = f.read()
+        if current == text:
+            continue
+        stale += 1
+        if check:
+            log(f"web_gzip: {output} périmé (python3 tools/web_gzip.py)")
+            continue
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(text)
+        log(f"web_gzip: {output} régénéré")
+    return stale
+
+
+def main(argv):
+    check = "--check" in argv
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    stale = generate(root, check)
+    return 1 if check and stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
+elif "Import" in globals():
+    # extra_scripts PlatformIO (pre:) : exécuté par SCons avant la compilation
+    Import("env")  # noqa: F821
+    generate(env["PROJECT_DIR"])  # noqa: F821